@@ -0,0 +1,343 @@
+/**
+ * @file CursesDataSource.cpp
+ * @brief Source file for class CursesDataSource
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CursesDataSource (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "CursesDataSource.h"
+#include "MemoryMapSynchronisedOutputBroker.h"
+#include "MemoryOperationsHelper.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+CursesDataSource::CursesDataSource() :
+        MemoryDataSourceI(),
+        EmbeddedServiceMethodBinderI(),
+        executor(*this) {
+    for (uint32 i = 0u; i < CURSES_DATA_SOURCE_N_SNAPSHOTS; i++) {
+        snapshots[i] = NULL_PTR(uint8 *);
+    }
+    backSnapshot = 0;
+    middleSnapshot = 1;
+    frontSnapshot = 2;
+    numberOfSnapshots = 0;
+    cycleCounter = 0u;
+    refreshPeriod = 200u;
+    samplePeriod = 1u;
+    maxElements = 8u;
+    cpuMask = 0u;
+    terminalFd = -1;
+    screenCleared = false;
+}
+
+/*lint -e{1551} the destructor must guarantee that the refresh thread is stopped before the snapshots are freed.*/
+CursesDataSource::~CursesDataSource() {
+    if (!executor.Stop()) {
+        if (!executor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    if (terminalFd >= 0) {
+        //Leave the cursor below the monitor
+        const char8 * const restore = "\n";
+        (void) write(terminalFd, restore, 1u);
+        if (terminal.Size() > 0u) {
+            (void) close(terminalFd);
+        }
+    }
+    for (uint32 i = 0u; i < CURSES_DATA_SOURCE_N_SNAPSHOTS; i++) {
+        if (snapshots[i] != NULL_PTR(uint8 *)) {
+            delete[] snapshots[i];
+        }
+    }
+}
+
+bool CursesDataSource::Initialise(StructuredDataI &data) {
+    bool ok = MemoryDataSourceI::Initialise(data);
+    if (ok) {
+        if (!data.Read("RefreshPeriod", refreshPeriod)) {
+            refreshPeriod = 200u;
+        }
+        ok = (refreshPeriod > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "RefreshPeriod shall be > 0");
+        }
+    }
+    if (ok) {
+        if (!data.Read("SamplePeriod", samplePeriod)) {
+            samplePeriod = 1u;
+        }
+        ok = (samplePeriod > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "SamplePeriod shall be > 0");
+        }
+    }
+    if (ok) {
+        if (!data.Read("MaxElements", maxElements)) {
+            maxElements = 8u;
+        }
+        ok = (maxElements > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "MaxElements shall be > 0");
+        }
+    }
+    if (ok) {
+        if (!data.Read("Terminal", terminal)) {
+            terminal = "";
+        }
+        if (!data.Read("CPUMask", cpuMask)) {
+            cpuMask = 0u;
+        }
+    }
+    return ok;
+}
+
+bool CursesDataSource::SetConfiguredDatabase(StructuredDataI &data) {
+    bool ok = MemoryDataSourceI::SetConfiguredDatabase(data);
+    uint32 nOfFunctions = GetNumberOfFunctions();
+    for (uint32 f = 0u; (f < nOfFunctions) && (ok); f++) {
+        uint32 nOfFunctionSignals = 0u;
+        if (GetFunctionNumberOfSignals(OutputSignals, f, nOfFunctionSignals)) {
+            for (uint32 n = 0u; (n < nOfFunctionSignals) && (ok); n++) {
+                uint32 nOfSamples = 0u;
+                ok = GetFunctionSignalSamples(OutputSignals, f, n, nOfSamples);
+                if (ok) {
+                    ok = (nOfSamples == 1u);
+                }
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "The number of samples of the signals shall be 1");
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+bool CursesDataSource::AllocateMemory() {
+    bool ok = MemoryDataSourceI::AllocateMemory();
+    for (uint32 i = 0u; (i < CURSES_DATA_SOURCE_N_SNAPSHOTS) && (ok); i++) {
+        if (snapshots[i] == NULL_PTR(uint8 *)) {
+            snapshots[i] = new uint8[totalMemorySize];
+        }
+        ok = MemoryOperationsHelper::Set(snapshots[i], '\0', totalMemorySize);
+    }
+    return ok;
+}
+
+bool CursesDataSource::Synchronise() {
+    cycleCounter++;
+    if ((cycleCounter >= samplePeriod) && (snapshots[0] != NULL_PTR(uint8 *))) {
+        cycleCounter = 0u;
+        (void) MemoryOperationsHelper::Copy(snapshots[backSnapshot], memory, totalMemorySize);
+        //The exchange is a full barrier: the refresh thread sees the whole snapshot before taking it
+        int32 previous = Atomic::Exchange(&middleSnapshot, (backSnapshot | CURSES_DATA_SOURCE_FRESH));
+        backSnapshot = (previous & ~CURSES_DATA_SOURCE_FRESH);
+        Atomic::Increment(&numberOfSnapshots);
+    }
+    return true;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the broker does not depend on the signal configuration.*/
+const char8 *CursesDataSource::GetBrokerName(StructuredDataI &data,
+                                             const SignalDirection direction) {
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == OutputSignals) {
+        brokerName = "MemoryMapSynchronisedOutputBroker";
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "CursesDataSource does not support InputSignals");
+    }
+    return brokerName;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: Input broker not used*/
+bool CursesDataSource::GetInputBrokers(ReferenceContainer &inputBrokers,
+                                       const char8 * const functionName,
+                                       void * const gamMemPtr) {
+    return false;
+}
+
+bool CursesDataSource::GetOutputBrokers(ReferenceContainer &outputBrokers,
+                                        const char8 * const functionName,
+                                        void * const gamMemPtr) {
+    ReferenceT<MemoryMapSynchronisedOutputBroker> broker("MemoryMapSynchronisedOutputBroker");
+    bool ok = broker.IsValid();
+    if (ok) {
+        ok = broker->Init(OutputSignals, *this, functionName, gamMemPtr);
+    }
+    if (ok) {
+        ok = outputBrokers.Insert(broker);
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create the MemoryMapSynchronisedOutputBroker for %s", functionName);
+    }
+    return ok;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: this DataSourceI implementation is independent of the states being changed.*/
+bool CursesDataSource::PrepareNextState(const char8 * const currentStateName,
+                                        const char8 * const nextStateName) {
+    bool ok = true;
+    if (terminalFd < 0) {
+        if (terminal.Size() > 0u) {
+            terminalFd = open(terminal.Buffer(), O_WRONLY | O_NOCTTY);
+            ok = (terminalFd >= 0);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not open the terminal %s", terminal.Buffer());
+            }
+        }
+        else {
+            terminalFd = STDOUT_FILENO;
+        }
+    }
+    if ((ok) && (executor.GetStatus() == EmbeddedThreadI::OffState)) {
+        executor.SetName(GetName());
+        if (cpuMask > 0u) {
+            executor.SetCPUMask(cpuMask);
+        }
+        //The formatting must never compete with the real-time threads
+        executor.SetPriorityClass(Threads::IdlePriorityClass);
+        ok = (executor.Start() == ErrorManagement::NoError);
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType CursesDataSource::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        Sleep::MSec(refreshPeriod);
+        StreamString screen;
+        if (!screenCleared) {
+            //Clear the screen once, afterwards the lines are overwritten in place to avoid flickering
+            screen = "\033[2J";
+            screenCleared = true;
+        }
+        if (Render(screen)) {
+            const char8 *buffer = screen.Buffer();
+            uint32 toWrite = static_cast<uint32>(screen.Size());
+            bool ok = true;
+            while ((toWrite > 0u) && (ok)) {
+                ssize_t written = write(terminalFd, buffer, static_cast<size_t>(toWrite));
+                ok = (written > 0);
+                if (ok) {
+                    buffer = &buffer[written];
+                    toWrite -= static_cast<uint32>(written);
+                }
+            }
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+bool CursesDataSource::Render(StreamString &screen) {
+    bool ok = (numberOfSnapshots > 0) && (snapshots[0] != NULL_PTR(uint8 *));
+    if (ok) {
+        if ((middleSnapshot & CURSES_DATA_SOURCE_FRESH) != 0) {
+            frontSnapshot = (Atomic::Exchange(&middleSnapshot, frontSnapshot) & ~CURSES_DATA_SOURCE_FRESH);
+        }
+        //Home, then each line is erased to its end (\033[K) after being written
+        uint32 nOfSnapshots = GetNumberOfSnapshots();
+        (void) screen.Printf("\033[H%s (snapshot %u)\033[K\n", GetName(), nOfSnapshots);
+        uint32 nOfSignals = GetNumberOfSignals();
+        for (uint32 n = 0u; n < nOfSignals; n++) {
+            PrintSignal(n, snapshots[frontSnapshot], screen);
+            screen += "\033[K\n";
+        }
+        //Erase whatever is left below (e.g. from a previous application)
+        screen += "\033[J";
+    }
+    return ok;
+}
+
+void CursesDataSource::PrintSignal(const uint32 signalIdx,
+                                   const uint8 * const snapshot,
+                                   StreamString &line) {
+    StreamString signalName;
+    (void) GetSignalName(signalIdx, signalName);
+    TypeDescriptor td = GetSignalType(signalIdx);
+    (void) line.Printf("%-32s %-8s ", signalName.Buffer(), TypeDescriptor::GetTypeNameFromTypeDescriptor(td));
+    void *signalAddress = NULL_PTR(void *);
+    uint32 nOfElements = 1u;
+    bool ok = GetSignalMemoryBuffer(signalIdx, 0u, signalAddress);
+    if (ok) {
+        ok = GetSignalNumberOfElements(signalIdx, nOfElements);
+    }
+    if (ok) {
+        /*lint -e{923} -e{9091} pointer to integer conversion required to translate the signal address into the snapshot.*/
+        uintp offset = reinterpret_cast<uintp>(signalAddress) - reinterpret_cast<uintp>(memory);
+        const uint8 *value = &snapshot[offset];
+        uint32 elementSize = static_cast<uint32>(td.numberOfBits) / 8u;
+        if ((td == Character8Bit) && (nOfElements > 1u)) {
+            StreamString text;
+            for (uint32 e = 0u; (e < nOfElements) && (value[e] != 0u); e++) {
+                text += static_cast<char8>(value[e]);
+            }
+            (void) line.Printf("\"%s\"", text.Buffer());
+        }
+        else {
+            uint32 nOfShown = (nOfElements < maxElements) ? (nOfElements) : (maxElements);
+            for (uint32 e = 0u; e < nOfShown; e++) {
+                /*lint -e{9005} the AnyType is only used to read the value*/
+                AnyType element(td, 0u, const_cast<uint8 *>(&value[e * elementSize]));
+                (void) line.Printf("%! ", element);
+            }
+            if (nOfShown < nOfElements) {
+                (void) line.Printf("... (%u elements)", nOfElements);
+            }
+        }
+    }
+}
+
+uint32 CursesDataSource::GetNumberOfSnapshots() const {
+    return static_cast<uint32>(numberOfSnapshots);
+}
+
+uint32 CursesDataSource::GetRefreshPeriod() const {
+    return refreshPeriod;
+}
+
+uint32 CursesDataSource::GetSamplePeriod() const {
+    return samplePeriod;
+}
+
+uint32 CursesDataSource::GetMaxElements() const {
+    return maxElements;
+}
+
+CLASS_REGISTER(CursesDataSource, "1.0")
+}
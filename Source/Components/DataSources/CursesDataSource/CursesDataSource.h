@@ -0,0 +1,280 @@
+/**
+ * @file CursesDataSource.h
+ * @brief Header file for class CursesDataSource
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CursesDataSource
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CURSESDATASOURCE_H_
+#define CURSESDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderI.h"
+#include "MemoryDataSourceI.h"
+#include "SingleThreadService.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The number of snapshot buffers (triple buffering).
+ */
+const uint32 CURSES_DATA_SOURCE_N_SNAPSHOTS = 3u;
+
+/**
+ * Flags a published snapshot which was not yet taken by the refresh thread.
+ */
+const int32 CURSES_DATA_SOURCE_FRESH = 0x4;
+
+/**
+ * @brief A DataSource which shows the live value of its signals on a terminal.
+ * @details The real-time thread only copies the signals (MemoryMapSynchronisedOutputBroker) into one of three snapshot buffers
+ * and publishes it with a single atomic exchange, i.e. it never waits, formats nor writes to the terminal. A background thread,
+ * which runs with the idle priority class, takes the latest published snapshot every RefreshPeriod ms and redraws the screen in place
+ * with ANSI (VT100) escape sequences: one line with the name, type and value of each signal.
+ *
+ * This DataSource is meant to watch values during commissioning, replacing the LoggerDataSource (which prints every sample) at
+ * a fraction of the real-time cost.
+ *
+ * The configuration syntax is (names are only given as an example):
+ *
+ * <pre>
+ * +Monitor = {
+ *     Class = CursesDataSource
+ *     RefreshPeriod = 200 //Optional. Period in ms of the screen refresh. Default = 200.
+ *     SamplePeriod = 1 //Optional. A snapshot is published every SamplePeriod real-time cycles. Default = 1.
+ *     Terminal = "/dev/pts/3" //Optional. The terminal where the signals are shown. Default = the standard output.
+ *     MaxElements = 8 //Optional. Maximum number of elements shown for each array signal. Default = 8.
+ *     CPUMask = 0x1 //Optional. CPU affinity of the refresh thread.
+ *     Signals = {
+ *         Current = {
+ *             Type = float32
+ *         }
+ *         Counters = {
+ *             Type = uint32
+ *             NumberOfElements = 4
+ *         }
+ *         Mode = {
+ *             Type = char8
+ *             NumberOfElements = 16 //Arrays of char8 are shown as strings.
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * Only output signals are supported. Each signal shall have one sample.
+ */
+class CursesDataSource: public MemoryDataSourceI, public EmbeddedServiceMethodBinderI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default constructor.
+     */
+    CursesDataSource();
+
+    /**
+     * @brief Stops the refresh thread, restores the cursor and frees the snapshots.
+     */
+    virtual ~CursesDataSource();
+
+    /**
+     * @brief Reads the parameters listed in the class description.
+     * @return true if MemoryDataSourceI::Initialise succeeds and all the parameters are valid.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Verifies that all the signals have one sample.
+     * @return true if MemoryDataSourceI::SetConfiguredDatabase succeeds and all the signals have one sample.
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI &data);
+
+    /**
+     * @brief Allocates the signal memory and the snapshot buffers.
+     * @return true if the memory could be allocated.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief Copies the signals into the free snapshot buffer and publishes it (every SamplePeriod calls).
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief See DataSourceI::GetBrokerName.
+     * @return MemoryMapSynchronisedOutputBroker for output signals and NULL for input signals.
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction);
+
+    /**
+     * @brief Only OutputBrokers are supported.
+     * @return false.
+     */
+    virtual bool GetInputBrokers(ReferenceContainer &inputBrokers,
+                                 const char8 * const functionName,
+                                 void * const gamMemPtr);
+
+    /**
+     * @brief Adds a MemoryMapSynchronisedOutputBroker to \a outputBrokers.
+     * @return true if the broker could be initialised.
+     */
+    virtual bool GetOutputBrokers(ReferenceContainer &outputBrokers,
+                                  const char8 * const functionName,
+                                  void * const gamMemPtr);
+
+    /**
+     * @brief Opens the terminal and starts the refresh thread (if not already running).
+     * @return true if the terminal could be opened and the refresh thread is running.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief Refresh thread callback. Waits RefreshPeriod ms and redraws the screen with the latest snapshot.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Formats the latest published snapshot (one line per signal, with the ANSI escape sequences).
+     * @param[out] screen the text to be written on the terminal.
+     * @return true if a snapshot was ever published.
+     */
+    bool Render(StreamString &screen);
+
+    /**
+     * @brief Gets the number of snapshots published by the real-time thread.
+     */
+    uint32 GetNumberOfSnapshots() const;
+
+    /**
+     * @brief Gets the refresh period in ms.
+     */
+    uint32 GetRefreshPeriod() const;
+
+    /**
+     * @brief Gets the number of real-time cycles between two snapshots.
+     */
+    uint32 GetSamplePeriod() const;
+
+    /**
+     * @brief Gets the maximum number of elements shown for each array signal.
+     */
+    uint32 GetMaxElements() const;
+
+private:
+
+    /**
+     * @brief Appends the value of the signal \a signalIdx, as held by \a snapshot, to \a line.
+     */
+    void PrintSignal(const uint32 signalIdx,
+                     const uint8 * const snapshot,
+                     StreamString &line);
+
+    /**
+     * The refresh thread.
+     */
+    SingleThreadService executor;
+
+    /**
+     * The snapshot buffers.
+     */
+    uint8 *snapshots[CURSES_DATA_SOURCE_N_SNAPSHOTS];
+
+    /**
+     * The snapshot being written by the real-time thread.
+     */
+    int32 backSnapshot;
+
+    /**
+     * The last published snapshot, or'ed with CURSES_DATA_SOURCE_FRESH if it was not yet taken by the refresh thread.
+     * Exchanged atomically by both threads.
+     */
+    volatile int32 middleSnapshot;
+
+    /**
+     * The snapshot being shown by the refresh thread.
+     */
+    int32 frontSnapshot;
+
+    /**
+     * Number of snapshots published.
+     */
+    volatile int32 numberOfSnapshots;
+
+    /**
+     * Number of real-time cycles since the last snapshot.
+     */
+    uint32 cycleCounter;
+
+    /**
+     * Period in ms of the screen refresh.
+     */
+    uint32 refreshPeriod;
+
+    /**
+     * Number of real-time cycles between two snapshots.
+     */
+    uint32 samplePeriod;
+
+    /**
+     * Maximum number of elements shown for each array signal.
+     */
+    uint32 maxElements;
+
+    /**
+     * CPU affinity of the refresh thread.
+     */
+    uint32 cpuMask;
+
+    /**
+     * The terminal device (empty for the standard output).
+     */
+    StreamString terminal;
+
+    /**
+     * The file descriptor of the terminal.
+     */
+    int32 terminalFd;
+
+    /**
+     * True once the screen was cleared.
+     */
+    bool screenCleared;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* CURSESDATASOURCE_H_ */
@@ -44,9 +44,23 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * Maximum time that a publisher thread waits for queued data before checking again.
+ */
+static const uint32 DAN_PUBLISHER_WAIT_TIMEOUT_MSEC = 200u;
+
+/**
+ * Maximum time to wait for the queued data of each DANStream to be published (see FlushQueues).
+ */
+static const uint32 DAN_PUBLISHER_FLUSH_TIMEOUT_MSEC = 1000u;
+
 DANSource::DANSource() :
-        DataSourceI(), MessageI() {
+        DataSourceI(),
+        MessageI(),
+        EmbeddedServiceMethodBinderI(),
+        publisherService(*this) {
     storeOnTrigger = false;
+    triggerWindow = false;
     numberOfPreTriggers = 0u;
     numberOfPostTriggers = 0u;
     numberOfBuffers = 0u;
@@ -62,6 +76,12 @@ DANSource::DANSource() :
     absoluteStartTime = 0LLU;
     interleave = true;
     danStreams = NULL_PTR(DANStream **);
+    numberOfPublishers = 0u;
+    publisherCPUMask = 0xfu;
+    publisherQueueDepth = 4u;
+    publisherSems = NULL_PTR(EventSem *);
+    publisherWake = NULL_PTR(bool *);
+    publisherError = false;
     filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -72,6 +92,21 @@ DANSource::DANSource() :
 
 /*lint -e{1551} -e{1740} must destroy all the DANStreams in the destructor.*/
 DANSource::~DANSource() {
+    if (!publisherService.Stop()) {
+        if (!publisherService.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the publisher threads.");
+        }
+    }
+    if (publisherSems != NULL_PTR(EventSem *)) {
+        uint32 t;
+        for (t = 0u; t < numberOfPublishers; t++) {
+            (void) publisherSems[t].Close();
+        }
+        delete[] publisherSems;
+    }
+    if (publisherWake != NULL_PTR(bool *)) {
+        delete[] publisherWake;
+    }
     if (danStreams != NULL_PTR(DANStream **)) {
         uint32 s;
         for (s = 0u; s < nOfDANStreams; s++) {
@@ -125,7 +160,10 @@ bool DANSource::GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 buffe
 const char8* DANSource::GetBrokerName(StructuredDataI& data, const SignalDirection direction) {
     const char8* brokerName = "";
     if (direction == OutputSignals) {
-        if (storeOnTrigger) {
+        if (triggerWindow) {
+            brokerName = "MemoryMapSynchronisedOutputBroker";
+        }
+        else if (storeOnTrigger) {
             brokerName = "MemoryMapAsyncTriggerOutputBroker";
         }
         else {
@@ -142,7 +180,18 @@ bool DANSource::GetInputBrokers(ReferenceContainer& inputBrokers, const char8* c
 
 bool DANSource::GetOutputBrokers(ReferenceContainer& outputBrokers, const char8* const functionName, void* const gamMemPtr) {
     bool ok = true;
-    if (storeOnTrigger) {
+    if (triggerWindow) {
+        //Synchronise only queues the blocks, the pre-trigger window is held by the DANStream queues
+        ReferenceT<MemoryMapSynchronisedOutputBroker> broker("MemoryMapSynchronisedOutputBroker");
+        ok = broker.IsValid();
+        if (ok) {
+            ok = broker->Init(OutputSignals, *this, functionName, gamMemPtr);
+        }
+        if (ok) {
+            ok = outputBrokers.Insert(broker);
+        }
+    }
+    else if (storeOnTrigger) {
         brokerAsyncTrigger = ReferenceT<MemoryMapAsyncTriggerOutputBroker>("MemoryMapAsyncTriggerOutputBroker");
         ok = brokerAsyncTrigger->InitWithTriggerParameters(OutputSignals, *this, functionName, gamMemPtr,
                                                               numberOfBuffers, numberOfPreTriggers,
@@ -166,9 +215,77 @@ bool DANSource::GetOutputBrokers(ReferenceContainer& outputBrokers, const char8*
 bool DANSource::Synchronise() {
     bool ok = true;
     uint32 s;
-    for (s = 0u; (s < nOfDANStreams) && (ok); s++) {
-        /*lint -e{613} danStream cannot be NULL as nOfDANStreams is initialised to zero in the constructor*/
-        ok = danStreams[s]->PutData();
+    if (numberOfPublishers > 0u) {
+        //A full queue only discards the data of its own stream
+        for (s = 0u; s < nOfDANStreams; s++) {
+            /*lint -e{613} danStream cannot be NULL as nOfDANStreams is initialised to zero in the constructor*/
+            if (!danStreams[s]->PutData()) {
+                ok = false;
+            }
+            if (danStreams[s]->GetBacklog() > 0u) {
+                /*lint -e{613} publisherWake cannot be NULL if numberOfPublishers > 0*/
+                publisherWake[s % numberOfPublishers] = true;
+            }
+        }
+        uint32 t;
+        for (t = 0u; t < numberOfPublishers; t++) {
+            /*lint -e{613} publisherWake and publisherSems cannot be NULL if numberOfPublishers > 0*/
+            if (publisherWake[t]) {
+                publisherWake[t] = false;
+                (void) publisherSems[t].Post();
+            }
+        }
+        if (publisherError) {
+            ok = false;
+        }
+    }
+    else {
+        for (s = 0u; (s < nOfDANStreams) && (ok); s++) {
+            /*lint -e{613} danStream cannot be NULL as nOfDANStreams is initialised to zero in the constructor*/
+            ok = danStreams[s]->PutData();
+        }
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType DANSource::Execute(ExecutionInfo& info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        uint32 t = info.GetThreadNumber();
+        if ((t < numberOfPublishers) && (publisherSems != NULL_PTR(EventSem *)) && (danStreams != NULL_PTR(DANStream **))) {
+            (void) publisherSems[t].Reset();
+            bool queued = false;
+            uint32 s;
+            for (s = t; (s < nOfDANStreams) && (!queued); s += numberOfPublishers) {
+                queued = (danStreams[s]->GetBacklog() > 0u);
+            }
+            if (!queued) {
+                (void) publisherSems[t].Wait(DAN_PUBLISHER_WAIT_TIMEOUT_MSEC);
+            }
+            for (s = t; s < nOfDANStreams; s += numberOfPublishers) {
+                if (!danStreams[s]->PublishQueued()) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Publisher thread %u failed to publish %s", t, danStreams[s]->GetDANSourceName());
+                    publisherError = true;
+                }
+            }
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+bool DANSource::FlushQueues() {
+    bool ok = true;
+    if ((numberOfPublishers > 0u) && (publisherSems != NULL_PTR(EventSem *)) && (danStreams != NULL_PTR(DANStream **))) {
+        uint32 t;
+        for (t = 0u; t < numberOfPublishers; t++) {
+            (void) publisherSems[t].Post();
+        }
+        uint32 s;
+        for (s = 0u; s < nOfDANStreams; s++) {
+            if (!danStreams[s]->WaitQueued(DAN_PUBLISHER_FLUSH_TIMEOUT_MSEC)) {
+                REPORT_ERROR(ErrorManagement::Warning, "Timeout waiting for the queued data of %s to be published", danStreams[s]->GetDANSourceName());
+                ok = false;
+            }
+        }
     }
     return ok;
 }
@@ -250,6 +367,27 @@ bool DANSource::Initialise(StructuredDataI& data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "DanBufferMultiplier shall be specified");
         }
     }
+    if (ok) {
+        if (!data.Read("NumberOfPublishers", numberOfPublishers)) {
+            numberOfPublishers = 0u;
+        }
+        uint64 publisherCPUMaskIn;
+        if (data.Read("PublisherCPUMask", publisherCPUMaskIn)) {
+            publisherCPUMask = BitSet(publisherCPUMaskIn);
+        }
+        else {
+            publisherCPUMask = cpuMask;
+        }
+        if (!data.Read("PublisherQueueDepth", publisherQueueDepth)) {
+            publisherQueueDepth = 4u;
+        }
+        if (numberOfPublishers > 0u) {
+            ok = (publisherQueueDepth > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "PublisherQueueDepth shall be > 0u");
+            }
+        }
+    }
     uint32 storeOnTriggerU = 0u;
     if (ok) {
         ok = data.Read("StoreOnTrigger", storeOnTriggerU);
@@ -273,6 +411,24 @@ bool DANSource::Initialise(StructuredDataI& data) {
                 REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfPostTriggers shall be specified");
             }
         }
+        if (ok) {
+            uint32 triggerWindowU = 0u;
+            if (data.Read("TriggerWindow", triggerWindowU)) {
+                triggerWindow = (triggerWindowU == 1u);
+            }
+        }
+        if ((ok) && (triggerWindow)) {
+            ok = (numberOfPublishers > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "TriggerWindow requires NumberOfPublishers > 0u");
+            }
+            if (ok) {
+                ok = (publisherQueueDepth > numberOfPreTriggers);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "TriggerWindow requires PublisherQueueDepth > NumberOfPreTriggers");
+                }
+            }
+        }
     }
     if (ok) {
         StreamString icProgName;
@@ -503,6 +659,13 @@ bool DANSource::SetConfiguredDatabase(StructuredDataI& data) {
     uint32 s;
     if (ok) {
         for (s = 0u; (s < nOfDANStreams); s++) {
+            if (numberOfPublishers > 0u) {
+                danStreams[s]->SetQueueDepth(publisherQueueDepth);
+            }
+            if (triggerWindow) {
+                danStreams[s]->SetTriggerWindow(numberOfPreTriggers, numberOfPostTriggers);
+                danStreams[s]->SetTriggerSignal(&trigger);
+            }
             danStreams[s]->Finalise();
             if (useTimeSignal) {
                 if (useAbsoluteTime) {
@@ -514,6 +677,27 @@ bool DANSource::SetConfiguredDatabase(StructuredDataI& data) {
             }
         }
     }
+    if (ok) {
+        if (numberOfPublishers > 0u) {
+            publisherSems = new EventSem[numberOfPublishers];
+            publisherWake = new bool[numberOfPublishers];
+            uint32 t;
+            for (t = 0u; (t < numberOfPublishers) && (ok); t++) {
+                publisherWake[t] = false;
+                ok = publisherSems[t].Create();
+            }
+            if (ok) {
+                publisherService.SetStackSize(stackSize);
+                publisherService.SetCPUMask(publisherCPUMask);
+                publisherService.SetNumberOfPoolThreads(numberOfPublishers);
+                publisherService.SetName(GetName());
+                ok = (publisherService.Start() == ErrorManagement::NoError);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the publisher threads");
+            }
+        }
+    }
 
     return ok;
 }
@@ -521,6 +705,7 @@ bool DANSource::SetConfiguredDatabase(StructuredDataI& data) {
 ErrorManagement::ErrorType DANSource::OpenStream() {
     uint32 t;
     bool ok = (danStreams != NULL_PTR(DANStream **));
+    publisherError = false;
     for (t = 0u; (t < nOfDANStreams) && (ok); t++) {
         /*lint -e{613} danStream cannot be NULL as nOfDANStreams is initialised to zero in the constructor*/
         ok = danStreams[t]->OpenStream();
@@ -533,6 +718,10 @@ ErrorManagement::ErrorType DANSource::OpenStream() {
 ErrorManagement::ErrorType DANSource::CloseStream() {
     uint32 t;
     bool ok = (danStreams != NULL_PTR(DANStream **));
+    if (ok) {
+        //The queued data is still published for the stream that is being closed
+        (void) FlushQueues();
+    }
     for (t = 0u; (t < nOfDANStreams) && (ok); t++) {
         /*lint -e{613} danStream cannot be NULL as nOfDANStreams is initialised to zero in the constructor*/
         ok = danStreams[t]->CloseStream();
@@ -542,6 +731,78 @@ ErrorManagement::ErrorType DANSource::CloseStream() {
     /*lint -e{1762} function cannot be constant as it is registered as an RPC for CLASS_METHOD_REGISTER*/
 }
 
+ErrorManagement::ErrorType DANSource::GetPublisherStatistics(ReferenceContainer &message) {
+    ErrorManagement::ErrorType err;
+    ReferenceT<StructuredDataI> data = message.Get(0u);
+    err.parametersError = !data.IsValid();
+    if (err.ErrorsCleared()) {
+        err.parametersError = !data->Write("NumberOfPublishers", numberOfPublishers);
+    }
+    if (danStreams != NULL_PTR(DANStream **)) {
+        uint32 s;
+        for (s = 0u; (s < nOfDANStreams) && (err.ErrorsCleared()); s++) {
+            StreamString streamStatsName;
+            (void) streamStatsName.Printf("Stream%u", s);
+            bool ok = data->CreateRelative(streamStatsName.Buffer());
+            if (ok) {
+                ok = data->Write("Name", danStreams[s]->GetDANSourceName());
+            }
+            if (ok) {
+                ok = data->Write("PublisherThread", GetStreamPublisher(s));
+            }
+            if (ok) {
+                ok = data->Write("Backlog", danStreams[s]->GetBacklog());
+            }
+            if (ok) {
+                ok = data->Write("MaxBacklog", danStreams[s]->GetMaxBacklog());
+            }
+            if (ok) {
+                ok = data->Write("NumberOfQueueFull", danStreams[s]->GetNumberOfQueueFull());
+            }
+            if (ok) {
+                ok = data->Write("NumberOfPublished", danStreams[s]->GetNumberOfPublished());
+            }
+            if (ok) {
+                ok = data->Write("NumberOfSkipped", danStreams[s]->GetNumberOfSkipped());
+            }
+            if (ok) {
+                ok = data->Write("LastPublishLatency", danStreams[s]->GetLastPublishLatency());
+            }
+            if (ok) {
+                ok = data->Write("MaxPublishLatency", danStreams[s]->GetMaxPublishLatency());
+            }
+            if (ok) {
+                ok = data->MoveToAncestor(1u);
+            }
+            err.parametersError = !ok;
+        }
+    }
+    if (!err.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Message does not contain a ReferenceT<StructuredDataI>");
+    }
+    return err;
+}
+
+uint32 DANSource::GetNumberOfPublishers() const {
+    return numberOfPublishers;
+}
+
+const ProcessorType& DANSource::GetPublisherCPUMask() const {
+    return publisherCPUMask;
+}
+
+uint32 DANSource::GetPublisherQueueDepth() const {
+    return publisherQueueDepth;
+}
+
+uint32 DANSource::GetStreamPublisher(const uint32 streamIdx) const {
+    uint32 publisher = 0u;
+    if (numberOfPublishers > 0u) {
+        publisher = (streamIdx % numberOfPublishers);
+    }
+    return publisher;
+}
+
 const ProcessorType& DANSource::GetCPUMask() const {
     return cpuMask;
 }
@@ -570,6 +831,10 @@ bool DANSource::IsStoreOnTrigger() const {
     return storeOnTrigger;
 }
 
+bool DANSource::IsTriggerWindow() const {
+    return triggerWindow;
+}
+
 int32 DANSource::GetTimeSignalIdx() const {
     return timeSignalIdx;
 }
@@ -591,6 +856,7 @@ void DANSource::Purge(ReferenceContainer &purgeList) {
         (void) brokerAsyncOutput->Flush();
         brokerAsyncOutput->UnlinkDataSource();
     }
+    (void) FlushQueues();
     DataSourceI::Purge(purgeList);
 }
 
@@ -602,6 +868,7 @@ void DANSource::Purge(ReferenceContainer &purgeList) {
 CLASS_REGISTER(DANSource, "1.0")
 CLASS_METHOD_REGISTER(DANSource, OpenStream)
 CLASS_METHOD_REGISTER(DANSource, CloseStream)
+CLASS_METHOD_REGISTER(DANSource, GetPublisherStatistics)
 
 }
 
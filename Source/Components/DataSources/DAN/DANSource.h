@@ -33,9 +33,13 @@
 /*---------------------------------------------------------------------------*/
 #include "DANStream.h"
 #include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
 #include "MemoryMapAsyncOutputBroker.h"
 #include "MemoryMapAsyncTriggerOutputBroker.h"
+#include "MemoryMapSynchronisedOutputBroker.h"
 #include "MessageI.h"
+#include "MultiThreadService.h"
 #include "ProcessorType.h"
 #include "RegisteredMethodsMessageFilter.h"
 
@@ -51,7 +55,21 @@ namespace MARTe {
  * asynchronously flushed to the DAN database in the context of a separate thread.
  * This circular buffer can either be continuously stored or stored only when a given event occurs (see StoreOnTrigger below).
  *
- * This DataSourceI has the functions OpenStream and CloseStream registered as an RPC.
+ * If NumberOfPublishers > 0 the data is not published into DAN by the thread of the broker. Each DANStream queues the interleaved data
+ * (up to PublisherQueueDepth blocks, see DANStream::SetQueueDepth) and the blocks are published by a pool of NumberOfPublishers threads (a MultiThreadService).
+ * The DANStream instances are distributed round-robin by the publisher threads, so that the streams of different threads are published in parallel.
+ * If the queue of a DANStream is full the data is discarded and Synchronise returns false.
+ * The backlog and the publish latency of each stream can be queried with the GetPublisherStatistics RPC.
+ *
+ * If TriggerWindow = 1 (it requires StoreOnTrigger = 1 and NumberOfPublishers > 0) the pre-trigger cycles are not retained by a
+ * MemoryMapAsyncTriggerOutputBroker. The signals are written by a MemoryMapSynchronisedOutputBroker and every cycle is queued by
+ * the DANStream instances (the copy which is anyway required to publish asynchronously), whose queue of PublisherQueueDepth blocks
+ * is also the pre-trigger ring (see DANStream::SetTriggerWindow). The Trigger signal only marks which queued blocks are published,
+ * so that the depth of the pre-trigger window costs neither extra copies nor a broker buffer for all the signals.
+ * The DAN publisher API does not allow to publish the data already written in its own buffer (DanBufferMultiplier), so that this
+ * buffer cannot hold the pre-trigger data.
+ *
+ * This DataSourceI has the functions OpenStream, CloseStream and GetPublisherStatistics registered as an RPC.
  *
  * The configuration syntax is (names are only given as an example):
  * <pre>
@@ -66,6 +84,10 @@ namespace MARTe {
  *     NumberOfPostTriggers = 1 //Compulsory iff StoreOnTrigger = 1.  Number of cycles to store after the trigger.
  *     ICProgName = "MARTeApp.ex" //Optional. If set it will call dan_initLibrary_icprog with the specified name.
  *     Interleave = 1 //Optional. If == 1 => that the data is expected to be interleaved by the DANStream, if == 0, it can be assumed that the data is already interleaved.
+ *     NumberOfPublishers = 4 //Optional. Number of threads which publish the DANStream instances into DAN (with the StackSize above). Default = 0 (the data is published by the thread of the broker).
+ *     PublisherCPUMask = 0xF0 //Optional. Only meaningful if NumberOfPublishers > 0. Affinity of the publisher threads. Default = CPUMask.
+ *     PublisherQueueDepth = 4 //Optional. Only meaningful if NumberOfPublishers > 0. Number of blocks (> 0) that each DANStream can queue. Default = 4.
+ *     TriggerWindow = 1 //Optional. Only meaningful if StoreOnTrigger = 1. If 1 the pre-trigger cycles are retained in the queue of each DANStream (requires NumberOfPublishers > 0 and PublisherQueueDepth > NumberOfPreTriggers). NumberOfBuffers is not used. Default = 0.
  *
  *     Signals = {
  *         Trigger = { //Compulsory when StoreOnTrigger = 1. Must be set in index 0 of the Signals node. When the value of this signal is 1 data will be stored into the DAN database. Shall not be added if StoreOnTrigger = 0.
@@ -88,7 +110,7 @@ namespace MARTe {
  * </pre>
  * A DANStream instance will be created for every different signal_type/sampling_frequency pair. Signals must be listed in the same order as they appear on the DAN xml.
  */
-class DANSource: public DataSourceI, public MessageI {
+class DANSource: public DataSourceI, public MessageI, public EmbeddedServiceMethodBinderI {
 public:
     CLASS_REGISTER_DECLARATION()
     /**
@@ -128,7 +150,7 @@ DANSource    ();
     /**
      * @brief See DataSourceI::GetNumberOfMemoryBuffers.
      * @details Only OutputSignals are supported.
-     * @return MemoryMapAsyncOutputBroker if storeOnTrigger == 0, MemoryMapAsyncTriggerOutputBroker otherwise.
+     * @return MemoryMapAsyncOutputBroker if storeOnTrigger == 0, MemoryMapSynchronisedOutputBroker if triggerWindow, MemoryMapAsyncTriggerOutputBroker otherwise.
      */
     virtual const char8 *GetBrokerName(StructuredDataI &data,
             const SignalDirection direction);
@@ -144,7 +166,7 @@ DANSource    ();
     /**
      * @brief See DataSourceI::GetOutputBrokers.
      * @details If storeOnTrigger == 0 it adds a MemoryMapAsyncOutputBroker instance to
-     *  the inputBrokers, otherwise it adds a MemoryMapAsyncTriggerOutputBroker instance to the outputBrokers.
+     *  the inputBrokers, if triggerWindow a MemoryMapSynchronisedOutputBroker, otherwise it adds a MemoryMapAsyncTriggerOutputBroker instance to the outputBrokers.
      * @pre
      *   GetNumberOfFunctions() == 1u
      */
@@ -154,10 +176,18 @@ DANSource    ();
 
     /**
      * @brief Calls PutData on all the DANStream instances.
-     * @return true if the DANStream::PutData returns true on all the streams.
+     * @details If NumberOfPublishers > 0 wakes the publisher threads of the streams which have queued data.
+     * @return true if the DANStream::PutData returns true on all the streams and if no publisher thread failed to publish.
      */
     virtual bool Synchronise();
 
+    /**
+     * @brief Publisher thread callback (see NumberOfPublishers). Publishes the queued data of the streams of the thread (see DANStream::PublishQueued).
+     * @param[in] info the thread number identifies the group of streams.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo & info);
+
     /**
      * @brief Calls DANStream::Reset on all the DANStream instances.
      * @details If AbsoluteTime = 0 in the configuration entry, calls DANStream::SetAbsoluteStartTime with the current time given by tcn_get_time.
@@ -196,16 +226,53 @@ DANSource    ();
 
     /**
      * @brief Calls dan_publisher_closeStream on every DANStream.
+     * @details If NumberOfPublishers > 0 first waits for the queued data to be published.
      * @return true if all dan_publisher_closeStream return 0.
      */
     ErrorManagement::ErrorType CloseStream();
 
+    /**
+     * @brief Gets the statistics of the data published by each DANStream. Function is registered as an RPC.
+     * @details Writes in the StructuredDataI: NumberOfPublishers and, for each stream s, a node Streams with: Name, PublisherThread,
+     * Backlog (number of blocks queued), MaxBacklog, NumberOfQueueFull (number of times that the data was discarded because the queue was full),
+     * NumberOfPublished, NumberOfSkipped (number of blocks outside the TriggerWindow), LastPublishLatency and MaxPublishLatency (duration of the dan_publisher_putDataBlock in micro-seconds).
+     * The values are read while they are being updated by the publisher threads.
+     * @param[in] message the first element shall be a ReferenceT<StructuredDataI> where the statistics are written.
+     * @return ErrorManagement::NoError if the statistics can be written in the first element of message.
+     */
+    ErrorManagement::ErrorType GetPublisherStatistics(ReferenceContainer &message);
+
     /**
      * @brief Gets the affinity of the thread which is going to be used to asynchronously store the data in the DAN database.
      * @return the affinity of the thread which is going to be used to asynchronously store the data in the DAN database.
      */
     const ProcessorType& GetCPUMask() const;
 
+    /**
+     * @brief Gets the number of threads which publish the DANStream instances.
+     * @return the number of threads which publish the DANStream instances (0 if the data is published by the thread of the broker).
+     */
+    uint32 GetNumberOfPublishers() const;
+
+    /**
+     * @brief Gets the affinity of the publisher threads.
+     * @return the affinity of the publisher threads.
+     */
+    const ProcessorType& GetPublisherCPUMask() const;
+
+    /**
+     * @brief Gets the number of blocks that each DANStream can queue.
+     * @return the number of blocks that each DANStream can queue.
+     */
+    uint32 GetPublisherQueueDepth() const;
+
+    /**
+     * @brief Gets the index of the publisher thread of a DANStream.
+     * @param[in] streamIdx the index of the DANStream.
+     * @return the index of the publisher thread of the DANStream.
+     */
+    uint32 GetStreamPublisher(const uint32 streamIdx) const;
+
     /**
      * @brief Gets the number of buffers in the circular buffer.
      * @return the number of buffers in the circular buffer.
@@ -236,6 +303,12 @@ DANSource    ();
      */
     bool IsStoreOnTrigger() const;
 
+    /**
+     * @brief Returns true if the pre-trigger cycles are retained in the queue of each DANStream (TriggerWindow = 1).
+     * @return true if the pre-trigger cycles are retained in the queue of each DANStream.
+     */
+    bool IsTriggerWindow() const;
+
     /**
      * @brief Checks is AbsoluteTime = 1 was set in the configuration entry.
      * @return true if AbsoluteTime = 1 was set in the TimeSignal of the configuration entry.
@@ -267,11 +340,22 @@ DANSource    ();
 
 private:
 
+    /**
+     * @brief Wakes the publisher threads and waits for all the queued data to be published.
+     * @return true if all the queued data was published.
+     */
+    bool FlushQueues();
+
     /**
      * True if the data is only to be stored in DAN following a trigger.
      */
     bool storeOnTrigger;
 
+    /**
+     * True if the pre-trigger cycles are retained in the queue of each DANStream.
+     */
+    bool triggerWindow;
+
     /**
      * Number of pre buffers when StoreOnTrigger == 1.
      */
@@ -376,7 +460,41 @@ private:
      * If true the data will be interleaved by the DANStream
      */
     bool interleave;
- 
+
+    /**
+     * Number of threads which publish the DANStream instances.
+     */
+    uint32 numberOfPublishers;
+
+    /**
+     * The affinity of the publisher threads.
+     */
+    ProcessorType publisherCPUMask;
+
+    /**
+     * Number of blocks that each DANStream can queue (if numberOfPublishers > 0).
+     */
+    uint32 publisherQueueDepth;
+
+    /**
+     * Posted to wake each publisher thread when its streams have queued data.
+     */
+    EventSem *publisherSems;
+
+    /**
+     * Set by Synchronise for each publisher thread which has to be woken.
+     */
+    bool *publisherWake;
+
+    /**
+     * Set by a publisher thread if a block could not be published.
+     */
+    volatile bool publisherError;
+
+    /**
+     * The publisher threads.
+     */
+    MultiThreadService publisherService;
 };
 }
 
@@ -30,10 +30,13 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "CompilerTypes.h"
 #include "DANAPI.h"
 #include "DANSource.h"
 #include "DANStream.h"
+#include "HighResolutionTimer.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -67,6 +70,26 @@ DANStream::DANStream(const TypeDescriptor & tdIn, const StreamString baseNameIn,
     writeCounts = 0u;
     danSourceName = "";
     interleave = interleaveIn;
+    zeroCopy = false;
+    queueDepth = 0u;
+    queueMemory = NULL_PTR(char8 *);
+    queueTimeStamps = NULL_PTR(uint64 *);
+    queueWriteIdx = 0u;
+    queueReadIdx = 0u;
+    backlog = 0;
+    maxBacklog = 0u;
+    numberOfQueueFull = 0u;
+    numberOfPublished = 0u;
+    lastPublishLatency = 0u;
+    maxPublishLatency = 0u;
+    triggerWindow = false;
+    numberOfPreTriggers = 0u;
+    numberOfPostTriggers = 0u;
+    triggerSignal = NULL_PTR(uint8 *);
+    pendingBlocks = 0u;
+    postTriggersLeft = 0u;
+    queuePublish = NULL_PTR(bool *);
+    numberOfSkipped = 0u;
 }
 
 /*lint -e{1551} the destructor must guarantee that the DANSource is unpublished at the of the object life-cycle. The internal buffering memory is also cleaned in this function.*/
@@ -83,6 +106,15 @@ DANStream::~DANStream() {
     if (blockInterleavedMemory != NULL_PTR(char8 *)) {
         GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(blockInterleavedMemory));
     }
+    if (queueMemory != NULL_PTR(char8 *)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(queueMemory));
+    }
+    if (queueTimeStamps != NULL_PTR(uint64 *)) {
+        delete[] queueTimeStamps;
+    }
+    if (queuePublish != NULL_PTR(bool *)) {
+        delete[] queuePublish;
+    }
     /*lint -e{1740} the pointer danSource is cleaned by the dan_publisher_unpublishSource the pointers timeRelativeSignals and timeAbsoluteSignal are cleaned by the DANSource*/
 }
 
@@ -144,13 +176,143 @@ bool DANStream::PutData() {
         timeStamp += writeCounts * static_cast<uint64>(numberOfSamples) * periodNanos;
         writeCounts++;
     }
-    if ((blockInterleavedMemory != NULL_PTR(char8 *)) && (blockMemory != NULL_PTR(char8 *))) {
-        char8 *src = NULL_PTR(char8 *);
-        char8 *dest = NULL_PTR(char8 *);
-        if (interleave) {
+    if ((queueMemory != NULL_PTR(char8 *)) && (queueTimeStamps != NULL_PTR(uint64 *))) {
+        uint32 currentBacklog = static_cast<uint32>(backlog);
+        //The pre-trigger blocks held by PutData also occupy the queue
+        ok = ((currentBacklog + pendingBlocks) < queueDepth);
+        if (ok) {
+            uint32 queueIdx = queueWriteIdx * blockSize;
+            ok = CopyBlock(&queueMemory[queueIdx]);
+        }
+        else {
+            numberOfQueueFull++;
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "The queue of %s is full. Discarding data", danSourceName.Buffer());
+        }
+        if (ok) {
+            queueTimeStamps[queueWriteIdx] = timeStamp;
+            queueWriteIdx++;
+            if (queueWriteIdx == queueDepth) {
+                queueWriteIdx = 0u;
+            }
+            pendingBlocks++;
+            if ((triggerWindow) && (triggerSignal != NULL_PTR(uint8 *))) {
+                if (*triggerSignal == 1u) {
+                    postTriggersLeft = numberOfPostTriggers;
+                    //The pre-trigger blocks and the triggered block
+                    ReleaseBlocks(pendingBlocks, true);
+                }
+                else if (postTriggersLeft > 0u) {
+                    postTriggersLeft--;
+                    ReleaseBlocks(pendingBlocks, true);
+                }
+                else if (pendingBlocks > numberOfPreTriggers) {
+                    //The oldest block is no longer a pre-trigger block
+                    ReleaseBlocks(1u, false);
+                }
+                else {
+                    //NOOP
+                }
+            }
+            else {
+                ReleaseBlocks(pendingBlocks, true);
+            }
+            currentBacklog = static_cast<uint32>(backlog);
+            if (currentBacklog > maxBacklog) {
+                maxBacklog = currentBacklog;
+            }
+        }
+    }
+    else if (zeroCopy) {
+        ok = (blockMemory != NULL_PTR(char8 *));
+        if (ok) {
+            ok = PublishBlock(timeStamp, blockMemory);
+        }
+    }
+    else if ((blockInterleavedMemory != NULL_PTR(char8 *)) && (blockMemory != NULL_PTR(char8 *))) {
+        ok = CopyBlock(blockInterleavedMemory);
+        if (ok) {
+            ok = PublishBlock(timeStamp, blockInterleavedMemory);
+        }
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+
+void DANStream::ReleaseBlocks(const uint32 count,
+                              const bool publish) {
+    if (queuePublish != NULL_PTR(bool *)) {
+        //The oldest pending block
+        uint32 idx = (queueWriteIdx + queueDepth) - pendingBlocks;
+        uint32 i;
+        for (i = 0u; i < count; i++) {
+            if (idx >= queueDepth) {
+                idx -= queueDepth;
+            }
+            queuePublish[idx] = publish;
+            idx++;
+        }
+    }
+    pendingBlocks -= count;
+    //Atomic::Add is a full memory barrier: the publisher thread sees the blocks before the new backlog
+    Atomic::Add(&backlog, static_cast<int32>(count));
+}
+
+bool DANStream::PublishQueued() {
+    bool ok = true;
+    while ((backlog > 0) && (ok)) {
+        /*lint -e{613} queueMemory, queueTimeStamps and queuePublish cannot be NULL if blocks were queued*/
+        uint32 queueIdx = queueReadIdx * blockSize;
+        if (queuePublish[queueReadIdx]) {
+            ok = PublishBlock(queueTimeStamps[queueReadIdx], &queueMemory[queueIdx]);
+        }
+        else {
+            numberOfSkipped++;
+        }
+        queueReadIdx++;
+        if (queueReadIdx == queueDepth) {
+            queueReadIdx = 0u;
+        }
+        //The block is released (even if it could not be published) only after being read
+        Atomic::Decrement(&backlog);
+    }
+    return ok;
+}
+
+bool DANStream::WaitQueued(const uint32 timeoutMSec) const {
+    uint32 elapsed = 0u;
+    while ((backlog > 0) && (elapsed < timeoutMSec)) {
+        Sleep::MSec(1u);
+        elapsed++;
+    }
+    return (backlog == 0);
+}
+
+bool DANStream::CopyBlock(char8 * const dest) const {
+    bool ok = true;
+    char8 *src = NULL_PTR(char8 *);
+    char8 *destBlock = NULL_PTR(char8 *);
+    if (blockMemory == NULL_PTR(char8 *)) {
+        ok = false;
+    }
+    else if (!zeroCopy) {
+        //Interleave the memory data. The elements with the sizes of the basic types are copied with a single assignment.
+        if (typeSize == 1u) {
+            InterleaveBlock<uint8>(reinterpret_cast<uint8 *>(dest), reinterpret_cast<uint8 *>(blockMemory));
+        }
+        else if (typeSize == 2u) {
+            InterleaveBlock<uint16>(reinterpret_cast<uint16 *>(dest), reinterpret_cast<uint16 *>(blockMemory));
+        }
+        else if (typeSize == 4u) {
+            InterleaveBlock<uint32>(reinterpret_cast<uint32 *>(dest), reinterpret_cast<uint32 *>(blockMemory));
+        }
+        else if (typeSize == 8u) {
+            InterleaveBlock<uint64>(reinterpret_cast<uint64 *>(dest), reinterpret_cast<uint64 *>(blockMemory));
+        }
+        else {
             uint32 s;
             uint32 z;
-            //Interleave the memory data
             for (s = 0u; (s < numberOfSignals) && (ok); s++) {
                 for (z = 0u; (z < numberOfSamples) && (ok); z++) {
                     uint32 blockMemoryIdx = s * numberOfSamples * typeSize;
@@ -159,27 +321,86 @@ bool DANStream::PutData() {
 
                     uint32 blockInterleavedMemoryIdx = s * typeSize;
                     blockInterleavedMemoryIdx += (z * numberOfSignals * typeSize);
-                    dest = &blockInterleavedMemory[blockInterleavedMemoryIdx];
-                    ok = MemoryOperationsHelper::Copy(dest, src, typeSize);
+                    destBlock = &dest[blockInterleavedMemoryIdx];
+                    ok = MemoryOperationsHelper::Copy(destBlock, src, typeSize);
                 }
             }
         }
-        else {
-            src = &blockMemory[0u];
-            dest = &blockInterleavedMemory[0u];
-            ok = MemoryOperationsHelper::Copy(dest, src, blockSize);
-        }
-        if (ok) {
-            //Check for >= 0 as true means == 1 but on CCS 6.0 true will be == 0
-            ok = DANAPI::PutDataBlock(danSource, timeStamp, blockInterleavedMemory, blockSize);
-        }
     }
     else {
-        ok = false;
+        src = &blockMemory[0u];
+        ok = MemoryOperationsHelper::Copy(dest, src, blockSize);
     }
     return ok;
 }
 
+bool DANStream::PublishBlock(const uint64 timeStamp,
+                             char8 * const block) {
+    uint64 startCounter = HighResolutionTimer::Counter();
+    //Check for >= 0 as true means == 1 but on CCS 6.0 true will be == 0
+    bool ok = DANAPI::PutDataBlock(danSource, timeStamp, block, blockSize);
+    float64 latencyF = static_cast<float64>(HighResolutionTimer::Counter() - startCounter) * HighResolutionTimer::Period() * 1e6;
+    lastPublishLatency = static_cast<uint64>(latencyF);
+    if (lastPublishLatency > maxPublishLatency) {
+        maxPublishLatency = lastPublishLatency;
+    }
+    if (ok) {
+        numberOfPublished++;
+    }
+    return ok;
+}
+
+uint32 DANStream::GetBacklog() const {
+    return static_cast<uint32>(backlog);
+}
+
+uint32 DANStream::GetMaxBacklog() const {
+    return maxBacklog;
+}
+
+uint32 DANStream::GetNumberOfQueueFull() const {
+    return numberOfQueueFull;
+}
+
+uint64 DANStream::GetNumberOfSkipped() const {
+    return numberOfSkipped;
+}
+
+uint64 DANStream::GetNumberOfPublished() const {
+    return numberOfPublished;
+}
+
+uint64 DANStream::GetLastPublishLatency() const {
+    return lastPublishLatency;
+}
+
+uint64 DANStream::GetMaxPublishLatency() const {
+    return maxPublishLatency;
+}
+
+const char8 *DANStream::GetDANSourceName() const {
+    return danSourceName.Buffer();
+}
+
+bool DANStream::IsZeroCopy() const {
+    return zeroCopy;
+}
+
+void DANStream::SetQueueDepth(const uint32 queueDepthIn) {
+    queueDepth = queueDepthIn;
+}
+
+void DANStream::SetTriggerWindow(const uint32 numberOfPreTriggersIn,
+                                 const uint32 numberOfPostTriggersIn) {
+    triggerWindow = true;
+    numberOfPreTriggers = numberOfPreTriggersIn;
+    numberOfPostTriggers = numberOfPostTriggersIn;
+}
+
+void DANStream::SetTriggerSignal(uint8 * const triggerSignalIn) {
+    triggerSignal = triggerSignalIn;
+}
+
 bool DANStream::OpenStream() {
     bool ok = DANAPI::OpenStream(danSource, samplingFrequency);
     if (!ok) {
@@ -194,8 +415,17 @@ bool DANStream::CloseStream() {
 
 void DANStream::Finalise() {
     blockSize = numberOfSignals * typeSize * numberOfSamples;
+    //Each signal holds its samples contiguously, which is already the DAN block layout if there is nothing to interleave
+    zeroCopy = ((!interleave) || (numberOfSignals == 1u) || (numberOfSamples == 1u));
     blockMemory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(blockSize));
-    blockInterleavedMemory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(blockSize));
+    if (!zeroCopy) {
+        blockInterleavedMemory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(blockSize));
+    }
+    if (queueDepth > 0u) {
+        queueMemory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(queueDepth * blockSize));
+        queueTimeStamps = new uint64[queueDepth];
+        queuePublish = new bool[queueDepth];
+    }
     (void) danSourceName.Seek(0LLU);
     (void) danSourceName.Printf("%s_%s", baseName.Buffer(), TypeDescriptor::GetTypeNameFromTypeDescriptor(td));
     (void) danSourceName.Seek(0LLU);
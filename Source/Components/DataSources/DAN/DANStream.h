@@ -42,6 +42,19 @@ namespace MARTe {
 /**
  * @brief Wraps a DAN stream (see dan_publisher_openStream).
  * @details The DANSource will create a new DANStream for each signal type/signal frequency pair.
+ *
+ * @details If a queue depth is set (see SetQueueDepth), PutData only interleaves the data (and computes the time stamp) into
+ * a queue of blocks, which are later published into DAN by PublishQueued (called by a publisher thread of the DANSource).
+ * The queue has a single producer (PutData) and a single consumer (PublishQueued).
+ *
+ * @details If a trigger window is set (see SetTriggerWindow) the queue is also the pre-trigger ring: every PutData queues its block,
+ * but a block is only given to PublishQueued when the trigger signal (see SetTriggerSignal) marks it as part of a publish window
+ * (the numberOfPreTriggers blocks before a trigger, the triggered blocks and the numberOfPostTriggers blocks after the last trigger).
+ * The blocks which fall out of the pre-trigger window are given to PublishQueued only to be released, without being published.
+ *
+ * @details The signal memory (see GetSignalMemoryBuffer) holds the samples of each signal contiguously. When this layout is already
+ * the DAN block layout (i.e. the data is not interleaved or there is either only one signal or only one sample per PutData), the
+ * block is published directly from the signal memory, without any intermediate copy.
  */
 class DANStream {
 public:
@@ -91,9 +104,33 @@ public:
      */
     void AddSignal(uint32 signalIdx);
 
+    /**
+     * @brief Sets the number of blocks that PutData can queue to be published by PublishQueued.
+     * @details Shall be called before Finalise.
+     * @param[in] queueDepthIn the number of blocks in the queue. If 0 (default) PutData publishes the data directly.
+     */
+    void SetQueueDepth(const uint32 queueDepthIn);
+
+    /**
+     * @brief Sets the publish window around each trigger (see SetTriggerSignal).
+     * @details Shall be called before Finalise and only if a queue depth > numberOfPreTriggersIn was set.
+     * @param[in] numberOfPreTriggersIn the number of blocks published before each trigger.
+     * @param[in] numberOfPostTriggersIn the number of blocks published after the last trigger.
+     */
+    void SetTriggerWindow(const uint32 numberOfPreTriggersIn,
+                          const uint32 numberOfPostTriggersIn);
+
+    /**
+     * @brief Sets the trigger signal read by PutData if a trigger window is set. The block is triggered if the value is 1.
+     * @param[in] triggerSignalIn the trigger signal.
+     */
+    void SetTriggerSignal(uint8 * const triggerSignalIn);
+
     /**
      * @brief All the signals have been added. Call dan_publisher_publishSource_withDAQBuffer with the final buffer size.
-     * @details The computed buffer size will be given by numberOfSignals * typeSize * numberOfSamples * danBufferMultiplier
+     * @details The computed buffer size will be given by numberOfSignals * typeSize * numberOfSamples * danBufferMultiplier.
+     * Allocates the queue of blocks if a queue depth was set and the interleaving memory only if the signal memory does not already
+     * have the DAN block layout.
      */
     void Finalise();
 
@@ -103,10 +140,81 @@ public:
      * - if useExternalAbsoluteTimingSignal the time is read directly from the signal set with SetAbsoluteTimeSignal and is assumed to be the absolute time in nano-seconds from the Epoch.
      * - if useExternalRelativeTimingSignal the relative time will be read directly from the signal set with SetRelativeTimeSignal and added to the time set in SetAbsoluteStartTime.
      * - otherwise the number of times this function has been called (stored in the counter), multiplied by the period in nano-seconds will be added to the time set in SetAbsoluteStartTime.
-     * @return true if dan_publisher_putDataBlock returns >= 0.
+     *
+     * If a queue depth was set the data is queued (together with its time stamp) to be published by PublishQueued. If a trigger window
+     * is set the block is held as a pre-trigger block until the trigger signal marks its publish window or until it is older than the
+     * numberOfPreTriggers last blocks.
+     * @return true if dan_publisher_putDataBlock returns >= 0 or, if a queue depth was set, if the queue was not full (otherwise the data is discarded).
      */
     bool PutData();
 
+    /**
+     * @brief Publishes into DAN all the blocks queued by PutData (and releases the pre-trigger blocks which were not in a publish window).
+     * @return true if dan_publisher_putDataBlock returns >= 0 for all the blocks.
+     */
+    bool PublishQueued();
+
+    /**
+     * @brief Waits for all the queued blocks to be published.
+     * @param[in] timeoutMSec the maximum time to wait.
+     * @return true if no blocks remain queued.
+     */
+    bool WaitQueued(const uint32 timeoutMSec) const;
+
+    /**
+     * @brief Gets the number of blocks queued and not yet published.
+     * @return the number of blocks queued and not yet published.
+     */
+    uint32 GetBacklog() const;
+
+    /**
+     * @brief Gets the maximum number of blocks that were queued at the same time.
+     * @return the maximum number of blocks that were queued at the same time.
+     */
+    uint32 GetMaxBacklog() const;
+
+    /**
+     * @brief Gets the number of times that PutData discarded the data because the queue was full.
+     * @return the number of times that PutData discarded the data because the queue was full.
+     */
+    uint32 GetNumberOfQueueFull() const;
+
+    /**
+     * @brief Gets the number of blocks released without being published because they were not in a trigger window.
+     * @return the number of blocks released without being published.
+     */
+    uint64 GetNumberOfSkipped() const;
+
+    /**
+     * @brief Gets the number of blocks published into DAN.
+     * @return the number of blocks published into DAN.
+     */
+    uint64 GetNumberOfPublished() const;
+
+    /**
+     * @brief Gets the duration of the latest dan_publisher_putDataBlock.
+     * @return the duration of the latest dan_publisher_putDataBlock in micro-seconds.
+     */
+    uint64 GetLastPublishLatency() const;
+
+    /**
+     * @brief Gets the maximum duration of a dan_publisher_putDataBlock.
+     * @return the maximum duration of a dan_publisher_putDataBlock in micro-seconds.
+     */
+    uint64 GetMaxPublishLatency() const;
+
+    /**
+     * @brief Gets the name with which the stream is published in DAN (valid after Finalise).
+     * @return the name with which the stream is published in DAN.
+     */
+    const char8 *GetDANSourceName() const;
+
+    /**
+     * @brief Returns true if the blocks are published directly from the signal memory (valid after Finalise).
+     * @return true if the signal memory already has the DAN block layout.
+     */
+    bool IsZeroCopy() const;
+
     /**
      * @brief Opens the DANStream.
      * @return true if dan_publisher_openStream returns 0.
@@ -151,6 +259,40 @@ public:
     void SetAbsoluteStartTime(uint64 absoluteStartTimeIn);
 
 private:
+    /**
+     * @brief Copies the signals data from the blockMemory into \a dest, interleaving it if required.
+     * @param[out] dest where to copy the data (with blockSize bytes).
+     * @return true if the data was copied.
+     */
+    bool CopyBlock(char8 * const dest) const;
+
+    /**
+     * @brief Interleaves the samples of all the signals from \a src into \a dest.
+     * @param[out] dest the interleaved block (sample major).
+     * @param[in] src the signals block (signal major).
+     * @tparam elementType an unsigned type with the same size as the stream type.
+     */
+    template<typename elementType>
+    void InterleaveBlock(elementType * const dest,
+                         const elementType * const src) const;
+
+    /**
+     * @brief Calls dan_publisher_putDataBlock and updates the latency statistics.
+     * @param[in] timeStamp the time stamp of the block.
+     * @param[in] block the data to publish.
+     * @return true if dan_publisher_putDataBlock returns >= 0.
+     */
+    bool PublishBlock(const uint64 timeStamp,
+                      char8 * const block);
+
+    /**
+     * @brief Gives the oldest \a count blocks held by PutData to PublishQueued.
+     * @param[in] count the number of blocks.
+     * @param[in] publish true if the blocks are to be published, false if they are only to be released.
+     */
+    void ReleaseBlocks(const uint32 count,
+                       const bool publish);
+
     /**
      * The type descriptor of the stream.
      */
@@ -171,6 +313,11 @@ private:
      */
     char8 *blockInterleavedMemory;
 
+    /**
+     * True if the blockMemory already has the DAN block layout (no interleaving required).
+     */
+    bool zeroCopy;
+
     /**
      * Number of signals held by the DANStream.
      */
@@ -256,6 +403,101 @@ private:
      */
     bool interleave;
 
+    /**
+     * Number of blocks in the queue (0 if PutData publishes directly).
+     */
+    uint32 queueDepth;
+
+    /**
+     * The queued blocks (queueDepth * blockSize).
+     */
+    char8 *queueMemory;
+
+    /**
+     * The time stamp of each queued block.
+     */
+    uint64 *queueTimeStamps;
+
+    /**
+     * The index of the next block to be written by PutData.
+     */
+    uint32 queueWriteIdx;
+
+    /**
+     * The index of the next block to be published by PublishQueued.
+     */
+    uint32 queueReadIdx;
+
+    /**
+     * Number of blocks queued and not yet published.
+     */
+    volatile int32 backlog;
+
+    /**
+     * Maximum number of blocks that were queued at the same time.
+     */
+    uint32 maxBacklog;
+
+    /**
+     * Number of times that PutData discarded the data because the queue was full.
+     */
+    uint32 numberOfQueueFull;
+
+    /**
+     * Number of blocks published into DAN.
+     */
+    uint64 numberOfPublished;
+
+    /**
+     * Duration of the latest dan_publisher_putDataBlock in micro-seconds.
+     */
+    uint64 lastPublishLatency;
+
+    /**
+     * Maximum duration of a dan_publisher_putDataBlock in micro-seconds.
+     */
+    uint64 maxPublishLatency;
+
+    /**
+     * True if the blocks are only published in the window of a trigger.
+     */
+    bool triggerWindow;
+
+    /**
+     * Number of blocks published before each trigger.
+     */
+    uint32 numberOfPreTriggers;
+
+    /**
+     * Number of blocks published after the last trigger.
+     */
+    uint32 numberOfPostTriggers;
+
+    /**
+     * The trigger signal (triggered if 1).
+     */
+    uint8 *triggerSignal;
+
+    /**
+     * Number of blocks held by PutData (queued but not yet given to PublishQueued). At most numberOfPreTriggers.
+     */
+    uint32 pendingBlocks;
+
+    /**
+     * Number of blocks still to be published after the last trigger.
+     */
+    uint32 postTriggersLeft;
+
+    /**
+     * For each queued block, true if it is to be published (false if it is only to be released).
+     */
+    bool *queuePublish;
+
+    /**
+     * Number of blocks released without being published.
+     */
+    uint64 numberOfSkipped;
+
     /*lint -e{1712} This class does not have a default constructor because
      * the constructor input parameters must be defined on construction and both remain constant
      * during the object's lifetime*/
@@ -266,6 +508,23 @@ private:
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+template<typename elementType>
+void DANStream::InterleaveBlock(elementType * const dest,
+                                const elementType * const src) const {
+    uint32 s;
+    uint32 z;
+    for (s = 0u; s < numberOfSignals; s++) {
+        const elementType *signalSrc = &src[s * numberOfSamples];
+        elementType *signalDest = &dest[s];
+        for (z = 0u; z < numberOfSamples; z++) {
+            signalDest[z * numberOfSignals] = signalSrc[z];
+        }
+    }
+}
+
+}
 
 #endif /* SOURCE_COMPONENTS_DATASOURCES_DAN_DANDATABLOCK_H_ */
 
@@ -30,8 +30,9 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "EPICSCAInput.h"
-#include "MemoryMapInputBroker.h"
+#include "MemoryMapSynchronisedInputBroker.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -40,17 +41,25 @@
 namespace MARTe {
 /**
  * @brief Callback function for the ca_create_subscription. Single point of access which
- * delegates the events to the corresponding EPICSPV instance.
+ * delegates the events to the corresponding EPICSCAInputPVBuffer.
  */
-static FastPollingMutexSem eventCallbackFastMux;
 /*lint -e{1746} function must match required prototype and thus cannot be changed to constant reference.*/
 void EPICSCAInputEventCallback(struct event_handler_args const args) {
-    (void) eventCallbackFastMux.FastLock();
-    PVWrapper *pv = static_cast<PVWrapper *>(args.usr);
-    if (pv != NULL_PTR(PVWrapper *)) {
-        (void) MemoryOperationsHelper::Copy(pv->memory, args.dbr, pv->memorySize);
+    EPICSCAInputPVBuffer *pvBuffer = static_cast<EPICSCAInputPVBuffer *>(args.usr);
+    if (pvBuffer != NULL_PTR(EPICSCAInputPVBuffer *)) {
+        //Only serialises the CA callback threads of this PV (and its destruction), never the real-time thread nor the other PVs
+        (void) pvBuffer->callbackMux.FastLock();
+    }
+    if (pvBuffer != NULL_PTR(EPICSCAInputPVBuffer *)) {
+        if (pvBuffer->memory != NULL_PTR(char8 *)) {
+            uint32 backIdx = static_cast<uint32>(pvBuffer->back) * pvBuffer->memorySize;
+            (void) MemoryOperationsHelper::Copy(&pvBuffer->memory[backIdx], args.dbr, pvBuffer->memorySize);
+            //Publish the written buffer and take the previous one (read or never read) to write the next value
+            int32 previous = Atomic::Exchange(&pvBuffer->middle, (pvBuffer->back | EPICS_CA_INPUT_PV_BUFFER_FRESH));
+            pvBuffer->back = (previous & (~EPICS_CA_INPUT_PV_BUFFER_FRESH));
+        }
+        pvBuffer->callbackMux.FastUnLock();
     }
-    eventCallbackFastMux.FastUnLock();
 }
 }
 /*---------------------------------------------------------------------------*/
@@ -60,9 +69,10 @@ namespace MARTe {
 EPICSCAInput::EPICSCAInput() :
         DataSourceI(), EmbeddedServiceMethodBinderI(), executor(*this) {
     pvs = NULL_PTR(PVWrapper *);
+    pvBuffers = NULL_PTR(EPICSCAInputPVBuffer *);
+    numberOfUpdatedPVs = 0u;
     stackSize = THREADS_DEFAULT_STACKSIZE * 4u;
     cpuMask = 0xffu;
-    eventCallbackFastMux.Create();
 }
 
 /*lint -e{1551} must stop the SingleThreadService in the destructor.*/
@@ -72,7 +82,6 @@ EPICSCAInput::~EPICSCAInput() {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
         }
     }
-    (void) eventCallbackFastMux.FastLock();
     uint32 nOfSignals = GetNumberOfSignals();
     if (pvs != NULL_PTR(PVWrapper *)) {
         uint32 n;
@@ -83,7 +92,18 @@ EPICSCAInput::~EPICSCAInput() {
         }
         delete[] pvs;
     }
-    eventCallbackFastMux.FastUnLock();
+    if (pvBuffers != NULL_PTR(EPICSCAInputPVBuffer *)) {
+        uint32 n;
+        for (n = 0u; (n < nOfSignals); n++) {
+            (void) pvBuffers[n].callbackMux.FastLock();
+            if (pvBuffers[n].memory != NULL_PTR(char8 *)) {
+                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(pvBuffers[n].memory));
+                pvBuffers[n].memory = NULL_PTR(char8 *);
+            }
+            pvBuffers[n].callbackMux.FastUnLock();
+        }
+        delete[] pvBuffers;
+    }
 }
 
 bool EPICSCAInput::Initialise(StructuredDataI & data) {
@@ -155,9 +175,16 @@ bool EPICSCAInput::SetConfiguredDatabase(StructuredDataI & data) {
     }
     if (ok) {
         pvs = new PVWrapper[nOfSignals];
+        pvBuffers = new EPICSCAInputPVBuffer[nOfSignals];
         uint32 n;
         for (n = 0u; (n < nOfSignals); n++) {
             pvs[n].memory = NULL_PTR(void *);
+            pvBuffers[n].memory = NULL_PTR(char8 *);
+            pvBuffers[n].memorySize = 0u;
+            pvBuffers[n].back = 0;
+            pvBuffers[n].middle = 1;
+            pvBuffers[n].front = 2;
+            (void) pvBuffers[n].callbackMux.Create();
         }
         for (n = 0u; (n < nOfSignals) && (ok); n++) {
             //Note that the RealTimeApplicationConfigurationBuilder is allowed to change the order of the signals w.r.t. to the originalSignalInformation
@@ -236,6 +263,9 @@ bool EPICSCAInput::SetConfiguredDatabase(StructuredDataI & data) {
                 pvs[n].memorySize /= 8u;
                 pvs[n].memorySize *= numberOfElements;
                 pvs[n].memory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(pvs[n].memorySize);
+                pvBuffers[n].memorySize = pvs[n].memorySize;
+                pvBuffers[n].memory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(
+                        EPICS_CA_INPUT_NUMBER_OF_PV_BUFFERS * pvs[n].memorySize));
                 ok = originalSignalInformation.MoveToAncestor(1u);
             }
         }
@@ -273,13 +303,13 @@ bool EPICSCAInput::GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bu
 const char8* EPICSCAInput::GetBrokerName(StructuredDataI& data, const SignalDirection direction) {
     const char8* brokerName = "";
     if (direction == InputSignals) {
-        brokerName = "MemoryMapInputBroker";
+        brokerName = "MemoryMapSynchronisedInputBroker";
     }
     return brokerName;
 }
 
 bool EPICSCAInput::GetInputBrokers(ReferenceContainer& inputBrokers, const char8* const functionName, void* const gamMemPtr) {
-    ReferenceT<MemoryMapInputBroker> broker("MemoryMapInputBroker");
+    ReferenceT<MemoryMapSynchronisedInputBroker> broker("MemoryMapSynchronisedInputBroker");
     bool ok = broker->Init(InputSignals, *this, functionName, gamMemPtr);
     if (ok) {
         ok = inputBrokers.Insert(broker);
@@ -301,7 +331,6 @@ bool EPICSCAInput::PrepareNextState(const char8* const currentStateName, const c
 ErrorManagement::ErrorType EPICSCAInput::Execute(ExecutionInfo& info) {
     ErrorManagement::ErrorType err = ErrorManagement::NoError;
     if (info.GetStage() == ExecutionInfo::StartupStage) {
-        (void) eventCallbackFastMux.FastLock();
         /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
         if (ca_context_create(ca_enable_preemptive_callback) != ECA_NORMAL) {
             err = ErrorManagement::FatalError;
@@ -319,7 +348,7 @@ ErrorManagement::ErrorType EPICSCAInput::Execute(ExecutionInfo& info) {
                 }
                 if (err.ErrorsCleared()) {
                     /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
-                    if (ca_create_subscription(pvs[n].pvType, pvs[n].numberOfElements, pvs[n].pvChid, DBE_VALUE, &EPICSCAInputEventCallback, &pvs[n],
+                    if (ca_create_subscription(pvs[n].pvType, pvs[n].numberOfElements, pvs[n].pvChid, DBE_VALUE, &EPICSCAInputEventCallback, &pvBuffers[n],
                                                &pvs[n].pvEvid) != ECA_NORMAL) {
                         err = ErrorManagement::FatalError;
                         REPORT_ERROR(err, "ca_create_subscription failed for PV %s", pvs[n].pvName);
@@ -327,13 +356,11 @@ ErrorManagement::ErrorType EPICSCAInput::Execute(ExecutionInfo& info) {
                 }
             }
         }
-        eventCallbackFastMux.FastUnLock();
     }
     else if (info.GetStage() != ExecutionInfo::BadTerminationStage) {
         Sleep::Sec(1.0F);
     }
     else {
-        (void) eventCallbackFastMux.FastLock();
         uint32 n;
         uint32 nOfSignals = GetNumberOfSignals();
         if (pvs != NULL_PTR(PVWrapper *)) {
@@ -345,7 +372,6 @@ ErrorManagement::ErrorType EPICSCAInput::Execute(ExecutionInfo& info) {
         }
         ca_detach_context();
         ca_context_destroy();
-        eventCallbackFastMux.FastUnLock();
     }
 
     return err;
@@ -360,7 +386,27 @@ uint32 EPICSCAInput::GetCPUMask() const {
 }
 
 bool EPICSCAInput::Synchronise() {
-    return false;
+    bool ok = true;
+    numberOfUpdatedPVs = 0u;
+    if ((pvs != NULL_PTR(PVWrapper *)) && (pvBuffers != NULL_PTR(EPICSCAInputPVBuffer *))) {
+        uint32 n;
+        uint32 nOfSignals = GetNumberOfSignals();
+        for (n = 0u; (n < nOfSignals) && (ok); n++) {
+            //A fresh middle buffer can only be replaced by the callback with a fresher one
+            if ((pvBuffers[n].middle & EPICS_CA_INPUT_PV_BUFFER_FRESH) != 0) {
+                int32 fresh = Atomic::Exchange(&pvBuffers[n].middle, pvBuffers[n].front);
+                pvBuffers[n].front = (fresh & (~EPICS_CA_INPUT_PV_BUFFER_FRESH));
+                uint32 frontIdx = static_cast<uint32>(pvBuffers[n].front) * pvBuffers[n].memorySize;
+                ok = MemoryOperationsHelper::Copy(pvs[n].memory, &pvBuffers[n].memory[frontIdx], pvs[n].memorySize);
+                numberOfUpdatedPVs++;
+            }
+        }
+    }
+    return ok;
+}
+
+uint32 EPICSCAInput::GetNumberOfUpdatedPVs() const {
+    return numberOfUpdatedPVs;
 }
 
 CLASS_REGISTER(EPICSCAInput, "1.0")
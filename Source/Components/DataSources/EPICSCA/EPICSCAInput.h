@@ -36,6 +36,7 @@
 #include "DataSourceI.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "EventSem.h"
+#include "FastPollingMutexSem.h"
 #include "SingleThreadService.h"
 
 /*---------------------------------------------------------------------------*/
@@ -94,10 +95,63 @@ struct PVWrapper {
     TypeDescriptor td;
 };
 
+/**
+ * The number of copies of each PV value exchanged between the ca_create_subscription callback and Synchronise.
+ */
+const uint32 EPICS_CA_INPUT_NUMBER_OF_PV_BUFFERS = 3u;
+
+/**
+ * Flags the index of the EPICSCAInputPVBuffer::middle buffer as holding a value which was not yet read.
+ */
+const int32 EPICS_CA_INPUT_PV_BUFFER_FRESH = 4;
+
+/**
+ * @brief The buffers where the ca_create_subscription callback writes the values of a PV (triple buffer).
+ * @details The callback writes into the \a back buffer and exchanges it (flagged with EPICS_CA_INPUT_PV_BUFFER_FRESH) with the \a middle one.
+ * Synchronise exchanges the \a front buffer with the \a middle one only if the latter is flagged. Being the exchanges atomic, neither side
+ * ever waits for the other and a buffer is never written and read at the same time.
+ */
+struct EPICSCAInputPVBuffer {
+    /**
+     * EPICS_CA_INPUT_NUMBER_OF_PV_BUFFERS * memorySize bytes.
+     */
+    char8 *memory;
+
+    /**
+     * The size of each copy of the PV value.
+     */
+    uint32 memorySize;
+
+    /**
+     * The buffer being written by the callback.
+     */
+    int32 back;
+
+    /**
+     * The last written buffer (| EPICS_CA_INPUT_PV_BUFFER_FRESH if it was not yet read).
+     */
+    volatile int32 middle;
+
+    /**
+     * The buffer being read by Synchronise.
+     */
+    int32 front;
+
+    /**
+     * Serialises the callbacks of this PV (which may be called by different CA threads) and the destruction of the buffers.
+     */
+    FastPollingMutexSem callbackMux;
+};
+
 /**
  * @brief A DataSource which allows to retrieved data from any number of PVs using the EPICS channel access client protocol.
  * Data is asynchronously retrieved using ca_create_subscriptions in the context of a different thread (w.r.t. to the real-time thread).
  *
+ * The monitor callbacks write into a triple buffer per PV (see EPICSCAInputPVBuffer). Synchronise (called by the MemoryMapSynchronisedInputBroker)
+ * only copies the PVs which were updated since the previous cycle and never blocks on the CA callback threads.
+ * Each instance creates its own CA client context in its own thread (pinned with CPUs), and the callbacks of the different PVs (and of
+ * different instances) do not share any lock.
+ *
  * The configuration syntax is (names are only given as an example):
  *
  * <pre>
@@ -156,14 +210,14 @@ public:
     /**
      * @brief See DataSourceI::GetNumberOfMemoryBuffers.
      * @details Only InputSignals are supported.
-     * @return MemoryMapInputBroker.
+     * @return MemoryMapSynchronisedInputBroker.
      */
     virtual const char8 *GetBrokerName(StructuredDataI &data,
             const SignalDirection direction);
 
     /**
      * @brief See DataSourceI::GetInputBrokers.
-     * @details adds a memory MemoryMapInputBroker instance to the inputBrokers
+     * @details adds a memory MemoryMapSynchronisedInputBroker instance to the inputBrokers
      * @return true.
      */
     virtual bool GetInputBrokers(ReferenceContainer &inputBrokers,
@@ -225,13 +279,21 @@ public:
 
     /**
      * @brief See DataSourceI::Synchronise.
-     * @return false.
+     * @details Copies the last value of each PV which was updated since the previous call into the signal memory.
+     * The PVs which were not updated keep their value.
+     * @return true.
      */
     virtual bool Synchronise();
 
+    /**
+     * @brief Gets the number of PVs that were copied by the last Synchronise.
+     * @return the number of PVs that were copied by the last Synchronise.
+     */
+    uint32 GetNumberOfUpdatedPVs() const;
+
     /**
      * @brief Registered as the ca_create_subscription callback function.
-     * It calls updates the memory of the corresponding PV variable.
+     * It writes the value into the EPICSCAInputPVBuffer of the corresponding PV variable.
      */
     friend void EPICSCAInputEventCallback(struct event_handler_args args);
 
@@ -242,6 +304,16 @@ private:
      */
     PVWrapper *pvs;
 
+    /**
+     * The buffers of each PV written by the EPICSCAInputEventCallback.
+     */
+    EPICSCAInputPVBuffer *pvBuffers;
+
+    /**
+     * The number of PVs copied by the last Synchronise.
+     */
+    uint32 numberOfUpdatedPVs;
+
     /**
      * The CPU mask for the executor
      */
@@ -32,11 +32,79 @@
 #include "AdvancedErrorManagement.h"
 #include "CLASSMETHODREGISTER.h"
 #include "EPICSCAOutput.h"
+#include "MemoryOperationsHelper.h"
 #include "RegisteredMethodsMessageFilter.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Time given to the channels to connect after being created.
+ */
+static const float64 EPICS_CA_OUTPUT_CONNECT_TIMEOUT = 0.5;
+
+/**
+ * @brief Checks if any of the \a numberOfElements elements of \a value differs by more than \a deadband from \a lastValue.
+ */
+template<typename T>
+static bool ExceedsDeadband(const void * const value,
+                            const void * const lastValue,
+                            const uint32 numberOfElements,
+                            const float64 deadband) {
+    const T *valueT = static_cast<const T *>(value);
+    const T *lastValueT = static_cast<const T *>(lastValue);
+    bool exceeds = false;
+    uint32 i;
+    for (i = 0u; (i < numberOfElements) && (!exceeds); i++) {
+        float64 diff = static_cast<float64>(valueT[i]) - static_cast<float64>(lastValueT[i]);
+        if (diff < 0.0) {
+            diff = -diff;
+        }
+        exceeds = (diff > deadband);
+    }
+    return exceeds;
+}
+
+/**
+ * @brief Calls ExceedsDeadband with the type of the signal.
+ */
+static bool SignalExceedsDeadband(const TypeDescriptor &td,
+                                  const void * const value,
+                                  const void * const lastValue,
+                                  const uint32 numberOfElements,
+                                  const float64 deadband) {
+    bool exceeds = true;
+    if (td == SignedInteger8Bit) {
+        exceeds = ExceedsDeadband<int8>(value, lastValue, numberOfElements, deadband);
+    }
+    else if (td == UnsignedInteger8Bit) {
+        exceeds = ExceedsDeadband<uint8>(value, lastValue, numberOfElements, deadband);
+    }
+    else if (td == SignedInteger16Bit) {
+        exceeds = ExceedsDeadband<int16>(value, lastValue, numberOfElements, deadband);
+    }
+    else if (td == UnsignedInteger16Bit) {
+        exceeds = ExceedsDeadband<uint16>(value, lastValue, numberOfElements, deadband);
+    }
+    else if (td == SignedInteger32Bit) {
+        exceeds = ExceedsDeadband<int32>(value, lastValue, numberOfElements, deadband);
+    }
+    else if (td == UnsignedInteger32Bit) {
+        exceeds = ExceedsDeadband<uint32>(value, lastValue, numberOfElements, deadband);
+    }
+    else if (td == Float32Bit) {
+        exceeds = ExceedsDeadband<float32>(value, lastValue, numberOfElements, deadband);
+    }
+    else if (td == Float64Bit) {
+        exceeds = ExceedsDeadband<float64>(value, lastValue, numberOfElements, deadband);
+    }
+    else {
+        //NOOP (always written)
+    }
+    return exceeds;
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -51,6 +119,11 @@ EPICSCAOutput::EPICSCAOutput() :
     ignoreBufferOverrun = 1u;
     threadContextSet = false;
     signalFlag = NULL_PTR(uint8*);
+    putOnChange = 0u;
+    deadbands = NULL_PTR(float64 *);
+    lastPutMemory = NULL_PTR(void **);
+    lastPutValid = NULL_PTR(bool *);
+    numberOfSkippedPuts = 0u;
     ReferenceT < RegisteredMethodsMessageFilter > filter = ReferenceT < RegisteredMethodsMessageFilter > (GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -71,12 +144,26 @@ EPICSCAOutput::~EPICSCAOutput() {
             if (pvs[n].memory != NULL_PTR(void *)) {
                 GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(pvs[n].memory);
             }
+            if (lastPutMemory != NULL_PTR(void **)) {
+                if (lastPutMemory[n] != NULL_PTR(void *)) {
+                    GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(lastPutMemory[n]);
+                }
+            }
         }
         delete[] pvs;
     }
     if (signalFlag != NULL_PTR(uint8*)) {
         delete[] signalFlag;
     }
+    if (deadbands != NULL_PTR(float64 *)) {
+        delete[] deadbands;
+    }
+    if (lastPutMemory != NULL_PTR(void **)) {
+        delete[] lastPutMemory;
+    }
+    if (lastPutValid != NULL_PTR(bool *)) {
+        delete[] lastPutValid;
+    }
 }
 
 void EPICSCAOutput::Purge(ReferenceContainer &purgeList) {
@@ -107,6 +194,9 @@ bool EPICSCAOutput::Initialise(StructuredDataI & data) {
         if (!data.Read("IgnoreBufferOverrun", ignoreBufferOverrun)) {
             REPORT_ERROR(ErrorManagement::Information, "No IgnoreBufferOverrun defined. Using default = %d", ignoreBufferOverrun);
         }
+        if (!data.Read("PutOnChange", putOnChange)) {
+            putOnChange = 0u;
+        }
 
     }
     if (ok) {
@@ -175,11 +265,17 @@ bool EPICSCAOutput::SetConfiguredDatabase(StructuredDataI & data) {
     if (ok) {
         pvs = new PVWrapper[nOfSignals];
         signalFlag = new uint8[nOfSignals];
+        deadbands = new float64[nOfSignals];
+        lastPutMemory = new void*[nOfSignals];
+        lastPutValid = new bool[nOfSignals];
         uint32 n;
         for (n = 0u; (n < nOfSignals); n++) {
             pvs[n].memory = NULL_PTR(void *);
             pvs[n].pvChid = NULL_PTR(chid);
             signalFlag[n] = 0u;
+            deadbands[n] = 0.0;
+            lastPutMemory[n] = NULL_PTR(void *);
+            lastPutValid[n] = false;
         }
         for (n = 0u; (n < nOfSignals) && (ok); n++) {
             //Note that the RealTimeApplicationConfigurationBuilder is allowed to change the order of the signals w.r.t. to the originalSignalInformation
@@ -198,6 +294,15 @@ bool EPICSCAOutput::SetConfiguredDatabase(StructuredDataI & data) {
                     REPORT_ERROR(ErrorManagement::ParametersError, "No PVName specified for signal at index %d", nn);
                 }
             }
+            if (ok) {
+                if (!originalSignalInformation.Read("Deadband", deadbands[n])) {
+                    deadbands[n] = 0.0;
+                }
+                ok = (deadbands[n] >= 0.0);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "The Deadband of %s shall be >= 0", pvName.Buffer());
+                }
+            }
             TypeDescriptor td = GetSignalType(n);
 
             if (ok) {
@@ -259,6 +364,9 @@ bool EPICSCAOutput::SetConfiguredDatabase(StructuredDataI & data) {
                 pvs[n].memorySize /= 8u;
                 pvs[n].memorySize *= numberOfElements;
                 pvs[n].memory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(pvs[n].memorySize);
+                if (putOnChange == 1u) {
+                    lastPutMemory[n] = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(pvs[n].memorySize);
+                }
                 ok = originalSignalInformation.MoveToAncestor(1u);
             }
         }
@@ -339,6 +447,39 @@ uint32 EPICSCAOutput::GetNumberOfBuffers() const {
     return numberOfBuffers;
 }
 
+bool EPICSCAOutput::IsPutOnChange() const {
+    return (putOnChange == 1u);
+}
+
+float64 EPICSCAOutput::GetDeadband(const uint32 signalIdx) const {
+    float64 deadband = 0.0;
+    if (deadbands != NULL_PTR(float64 *)) {
+        if (signalIdx < numberOfSignals) {
+            deadband = deadbands[signalIdx];
+        }
+    }
+    return deadband;
+}
+
+uint64 EPICSCAOutput::GetNumberOfSkippedPuts() const {
+    return numberOfSkippedPuts;
+}
+
+bool EPICSCAOutput::IsPutRequired(const uint32 n) const {
+    bool required = true;
+    if ((putOnChange == 1u) && (lastPutValid != NULL_PTR(bool *)) && (lastPutMemory != NULL_PTR(void **)) && (pvs != NULL_PTR(PVWrapper *))) {
+        if (lastPutValid[n]) {
+            if ((deadbands[n] > 0.0) && (pvs[n].pvType != DBR_STRING)) {
+                required = SignalExceedsDeadband(GetSignalType(n), pvs[n].memory, lastPutMemory[n], pvs[n].numberOfElements, deadbands[n]);
+            }
+            else {
+                required = (MemoryOperationsHelper::Compare(pvs[n].memory, lastPutMemory[n], pvs[n].memorySize) != 0);
+            }
+        }
+    }
+    return required;
+}
+
 bool EPICSCAOutput::Synchronise() {
     bool ok = true;
     uint32 n;
@@ -360,33 +501,55 @@ bool EPICSCAOutput::Synchronise() {
                     }
                 }
             }
+            //Wait for all the channels to connect at once
+            (void) ca_pend_io(EPICS_CA_OUTPUT_CONNECT_TIMEOUT);
         }
     }
 
     //Allow to write event at the first time!
     if (threadContextSet) {
         if ((pvs != NULL_PTR(PVWrapper *)) && (signalFlag != NULL_PTR(uint8*))) {
+            bool queued = false;
             for (n = 0u; (n < nOfSignals); n++) {
                 if (signalFlag[n] > 0u) {
-
-                    uint32 nRetries = 5u;
-                    ok = false;
-                    while ((nRetries > 0u) && (!ok)) {
+                    if (IsPutRequired(n)) {
+                        bool putOk;
                         /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
                         if (pvs[n].pvType == DBR_STRING) {
-                            ok = (ca_put(pvs[n].pvType, pvs[n].pvChid, pvs[n].memory) == ECA_NORMAL);
+                            putOk = (ca_put(pvs[n].pvType, pvs[n].pvChid, pvs[n].memory) == ECA_NORMAL);
                         }
                         else {
-                            ok = (ca_array_put(pvs[n].pvType, pvs[n].numberOfElements, pvs[n].pvChid, pvs[n].memory) == ECA_NORMAL);
+                            putOk = (ca_array_put(pvs[n].pvType, pvs[n].numberOfElements, pvs[n].pvChid, pvs[n].memory) == ECA_NORMAL);
+                        }
+                        if (putOk) {
+                            queued = true;
+                            if (putOnChange == 1u) {
+                                /*lint -e{613} lastPutMemory and lastPutValid are allocated if putOnChange == 1*/
+                                lastPutValid[n] = MemoryOperationsHelper::Copy(lastPutMemory[n], pvs[n].memory, pvs[n].memorySize);
+                            }
+                        }
+                        else {
+                            if (putOnChange == 1u) {
+                                //Force the ca_put in the next cycle
+                                /*lint -e{613} lastPutValid is allocated if putOnChange == 1*/
+                                lastPutValid[n] = false;
+                            }
+                            ok = false;
+                            REPORT_ERROR(ErrorManagement::FatalError, "ca_put failed for PV: %s", pvs[n].pvName);
                         }
-                        nRetries--;
-                        (void) ca_pend_io(0.5);
                     }
-                    if (!ok) {
-                        REPORT_ERROR(ErrorManagement::FatalError, "ca_put failed for PV: %s", pvs[n].pvName);
+                    else {
+                        numberOfSkippedPuts++;
                     }
                 }
             }
+            //Send all the ca_put of this cycle at once
+            if (queued) {
+                if (ca_flush_io() != ECA_NORMAL) {
+                    ok = false;
+                    REPORT_ERROR(ErrorManagement::FatalError, "ca_flush_io failed");
+                }
+            }
         }
     }
 
@@ -52,6 +52,9 @@ namespace MARTe {
  * @brief A DataSource which allows to output data into any number of PVs using the EPICS channel access client protocol.
  * Data is asynchronously ca_put in the context of a different thread (w.r.t. to the real-time thread).
  *
+ * On every cycle the ca_put of all the PVs are issued in a batch which is sent with a single ca_flush_io. If PutOnChange is set, the PVs
+ * whose value did not change (or did not change more than their Deadband) since the last successful ca_put are not written.
+ *
  * The configuration syntax is (names are only given as an example):
  *
  * <pre>
@@ -61,10 +64,12 @@ namespace MARTe {
  *     CPUs = 0xff //Optional the affinity of the EmbeddedThread (where the EPICS context is attached).
  *     IgnoreBufferOverrun = 1 //Optional. If true no error will be triggered when the thread that writes into EPICS does not consume the data fast enough.
  *     NumberOfBuffers = 10 //Compulsory. Number of buffers in a circular buffer that asynchronously writes the PV values. Each buffer is capable of holding a copy of all the DataSourceI signals.
+ *     PutOnChange = 1 //Optional. Default = 0. If 1 a PV is only written when its value changes.
  *     Signals = {
  *          PV1 = { //At least one shall be defined
  *             PVName = My::PV1 //Compulsory. Name of the PV.
  *             Type = uint32 //Compulsory. Supported types are char8[40], string[40], uint8, int8, uint16, int16, int32, uint32, float32 and float64
+ *             Deadband = 0.5 //Optional. Default = 0. Only meaningful with PutOnChange = 1. The PV is only written when any of its elements changes by more than Deadband. Ignored for strings.
  *          }
  *          ...
  *     }
@@ -153,6 +158,7 @@ public:
      * In particular the following conditions shall be met:
      * - All the signals have the PVName defined
      * - All the signals have one of the following types: uint32, int32, float32 or float64.
+     * - The Deadband, if defined, is >= 0.
      * @return true if all the parameters are valid and the conditions above are met.
      */
     virtual bool SetConfiguredDatabase(StructuredDataI & data);
@@ -175,11 +181,35 @@ public:
      */
     uint32 GetNumberOfBuffers() const;
 
+    /**
+     * @brief Gets if the PVs are only written when their value changes.
+     * @return true if the PVs are only written when their value changes.
+     */
+    bool IsPutOnChange() const;
+
+    /**
+     * @brief Gets the deadband of the PV associated to the signal with index \a signalIdx.
+     * @param[in] signalIdx the signal index.
+     * @return the deadband of the PV (0 if the signal does not exist).
+     * @pre
+     *   SetConfiguredDatabase
+     */
+    float64 GetDeadband(const uint32 signalIdx) const;
+
+    /**
+     * @brief Gets the number of ca_put that were not issued because the PV value did not change.
+     * @return the number of ca_put that were not issued because the PV value did not change.
+     */
+    uint64 GetNumberOfSkippedPuts() const;
+
     /**
      * @brief Provides the context to execute all the EPICS ca_put calls.
      * @details Executes in the context of the MemoryMapAsyncOutputBroker thread the following EPICS calls:
      * ca_context_create, ca_create_channel, ca_create_subscription, ca_clear_subscription,
-     * ca_clear_event, ca_clear_channel, ca_detach_context and ca_context_destroy
+     * ca_clear_event, ca_clear_channel, ca_detach_context and ca_context_destroy.
+     * The channels are created (and their connection waited with a single ca_pend_io) the first time.
+     * On every call the ca_put (or ca_array_put) of all the PVs to be written are queued and sent with a single ca_flush_io.
+     * A PV which fails to be written is written again in the next call, even if its value did not change.
      * @return true if all the EPICS calls return without any error.
      */
     virtual bool Synchronise();
@@ -204,6 +234,13 @@ public:
     virtual void Purge(ReferenceContainer &purgeList);
 
 private:
+    /**
+     * @brief Checks if the value of the PV with index \a n has to be written.
+     * @param[in] n the PV index.
+     * @return true if PutOnChange is not set, if the PV was never written or if its value changed (by more than its deadband).
+     */
+    bool IsPutRequired(const uint32 n) const;
+
     /**
      * List of PVs.
      */
@@ -234,6 +271,31 @@ private:
      */
     bool threadContextSet;
 
+    /**
+     * If 1 the PVs are only written when their value changes.
+     */
+    uint32 putOnChange;
+
+    /**
+     * The deadband of each PV.
+     */
+    float64 *deadbands;
+
+    /**
+     * The value of each PV which was last written with success.
+     */
+    void **lastPutMemory;
+
+    /**
+     * True if the lastPutMemory of the PV holds a value.
+     */
+    bool *lastPutValid;
+
+    /**
+     * Number of ca_put that were not issued because the PV value did not change.
+     */
+    uint64 numberOfSkippedPuts;
+
     /**
      * If true no error will be triggered when the data cannot be consumed by the thread doing the caputs.
      */
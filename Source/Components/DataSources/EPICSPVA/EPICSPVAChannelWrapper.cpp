@@ -31,6 +31,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "EPICSPVAChannelWrapper.h"
 
 /*---------------------------------------------------------------------------*/
@@ -41,15 +42,56 @@
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+EPICSPVAChannelWrapperPutSlot::EPICSPVAChannelWrapperPutSlot() {
+    state = EPICS_PVA_PUT_SLOT_FREE;
+    wrapper = NULL_PTR(EPICSPVAChannelWrapper *);
+}
+
+EPICSPVAChannelWrapperPutSlot::~EPICSPVAChannelWrapperPutSlot() {
+    operation = pvac::Operation();
+    wrapper = NULL_PTR(EPICSPVAChannelWrapper *);
+}
+
+void EPICSPVAChannelWrapperPutSlot::SetChannelWrapper(EPICSPVAChannelWrapper * const wrapperIn) {
+    wrapper = wrapperIn;
+}
+
+void EPICSPVAChannelWrapperPutSlot::putBuild(const epics::pvData::StructureConstPtr& build, pvac::ClientChannel::PutCallback::Args& args) {
+    if (wrapper != NULL_PTR(EPICSPVAChannelWrapper *)) {
+        wrapper->putBuild(build, args);
+        sentFields = args.tosend;
+    }
+    (void) Atomic::Exchange(&state, EPICS_PVA_PUT_SLOT_BUILT);
+}
+
+void EPICSPVAChannelWrapperPutSlot::putDone(const pvac::PutEvent& evt) {
+    if (wrapper != NULL_PTR(EPICSPVAChannelWrapper *)) {
+        wrapper->PutSlotDone(*this, evt);
+    }
+    //Last, as the slot may be reused as soon as it is free
+    (void) Atomic::Exchange(&state, EPICS_PVA_PUT_SLOT_FREE);
+}
+
 EPICSPVAChannelWrapper::EPICSPVAChannelWrapper() {
     numberOfSignals = 0u;
     resolvedStructIndexMap = NULL_PTR(uint32 *);
     cachedSignals = NULL_PTR(EPICSPVAFieldWrapperI **);
     structureResolved = false;
     putFinished = false;
+    hasStructureArrays = false;
+    putSlots = NULL_PTR(EPICSPVAChannelWrapperPutSlot *);
+    maxPutsInFlight = 1u;
+    numberOfPuts = 0u;
+    numberOfCoalescedPuts = 0u;
+    numberOfFailedPuts = 0u;
+    (void) putMux.Create();
 }
 
 EPICSPVAChannelWrapper::~EPICSPVAChannelWrapper() {
+    //Cancel the operations in flight before destroying the structures that they use
+    if (putSlots != NULL_PTR(EPICSPVAChannelWrapperPutSlot *)) {
+        delete[] putSlots;
+    }
     if (cachedSignals != NULL_PTR(EPICSPVAFieldWrapperI **)) {
         for (uint32 n = 0u; (n < numberOfSignals); n++) {
             if (cachedSignals[n] != NULL_PTR(EPICSPVAFieldWrapperI *)) {
@@ -209,19 +251,55 @@ bool EPICSPVAChannelWrapper::Setup(DataSourceI &dataSource) {
     return ok;
 }
 
+void EPICSPVAChannelWrapper::SetMaxPutsInFlight(const uint32 maxPutsInFlightIn) {
+    if (maxPutsInFlightIn > 0u) {
+        maxPutsInFlight = maxPutsInFlightIn;
+    }
+}
+
 void EPICSPVAChannelWrapper::putBuild(const epics::pvData::StructureConstPtr& build, pvac::ClientChannel::PutCallback::Args& args) {
-    args.root = putPVStruct;
-    args.tosend.set(0);
+    //Send a copy of the changed fields, so that Put can keep updating putPVStruct while the operation is in flight
+    epics::pvData::PVStructurePtr sendPVStruct = epics::pvData::getPVDataCreate()->createPVStructure(build);
+    (void) putMux.FastLock();
+    if (putPVStruct ? true : false) {
+        sendPVStruct->copyUnchecked(*putPVStruct, putChangedFields);
+    }
+    args.root = sendPVStruct;
+    args.tosend = putChangedFields;
+    putChangedFields.clear();
     putFinished = true;
+    putMux.FastUnLock();
 }
 
 void EPICSPVAChannelWrapper::putDone(const pvac::PutEvent& evt) {
-    if (evt.event == 0) {
-        std::cout << evt.event << std::endl;
+    if (evt.event == pvac::PutEvent::Fail) {
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "Put failed for channel %s [%s]", channelName.Buffer(), evt.message.c_str());
     }
 }
 
-bool EPICSPVAChannelWrapper::Put() {
+void EPICSPVAChannelWrapper::PutSlotDone(EPICSPVAChannelWrapperPutSlot &slot, const pvac::PutEvent& evt) {
+    putDone(evt);
+    if (evt.event == pvac::PutEvent::Fail) {
+        (void) putMux.FastLock();
+        putChangedFields |= slot.sentFields;
+        numberOfFailedPuts++;
+        putMux.FastUnLock();
+    }
+}
+
+uint64 EPICSPVAChannelWrapper::GetNumberOfPuts() const {
+    return numberOfPuts;
+}
+
+uint64 EPICSPVAChannelWrapper::GetNumberOfCoalescedPuts() const {
+    return numberOfCoalescedPuts;
+}
+
+uint64 EPICSPVAChannelWrapper::GetNumberOfFailedPuts() const {
+    return numberOfFailedPuts;
+}
+
+bool EPICSPVAChannelWrapper::Connect() {
     bool ok = false;
     try {
         if (!channel.valid()) {
@@ -230,13 +308,24 @@ bool EPICSPVAChannelWrapper::Put() {
             channel = pvac::ClientChannel(provider.connect(channelName.Buffer()));
         }
         ok = channel.valid();
+    }
+    catch (epics::pvData::detail::ExceptionMixed<epics::pvData::BaseException> &ignored) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Failed to connect to channel %s [s]", channelName.Buffer(), ignored.what());
+        ok = false;
+    }
+    return ok;
+}
 
+bool EPICSPVAChannelWrapper::ResolvePutStructure() {
+    bool ok = Connect();
+    try {
         if (ok) {
             if (!structureResolved) {
                 uint32 absIndex = 0u;
                 epics::pvData::PVStructurePtr getPVStruct = std::const_pointer_cast<epics::pvData::PVStructure>(channel.get());
                 ok = (getPVStruct) ? true : false;
                 if (ok) {
+                    hasStructureArrays = false;
                     ok = ResolveStructure(getPVStruct, "", absIndex);
                     if (ok) {
                         putPVStruct = getPVStruct;
@@ -245,19 +334,72 @@ bool EPICSPVAChannelWrapper::Put() {
                 }
             }
         }
+    }
+    catch (epics::pvData::detail::ExceptionMixed<epics::pvData::BaseException> &ignored) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Failed to get the structure of channel %s [s]", channelName.Buffer(), ignored.what());
+        ok = false;
+    }
+    return ok;
+}
+
+bool EPICSPVAChannelWrapper::Put() {
+    bool ok = ResolvePutStructure();
+    try {
+        if (ok) {
+            if (putSlots == NULL_PTR(EPICSPVAChannelWrapperPutSlot *)) {
+                putSlots = new EPICSPVAChannelWrapperPutSlot[maxPutsInFlight];
+                uint32 s;
+                for (s = 0u; s < maxPutsInFlight; s++) {
+                    putSlots[s].SetChannelWrapper(this);
+                }
+            }
+        }
+        bool pending = false;
         if (ok) {
             uint32 n;
+            (void) putMux.FastLock();
             for (n = 0u; n < numberOfSignals; n++) {
-                cachedSignals[n]->Put();
+                if (cachedSignals[n]->Put()) {
+                    (void) putChangedFields.set(cachedSignals[n]->GetFieldOffset());
+                }
             }
+            pending = !putChangedFields.isEmpty();
+            putMux.FastUnLock();
         }
-        putFinished = false;
-        pvac::Operation op(channel.put(this));
-        uint32 timeout = 10u;
-        while (ok && (!putFinished)) {
-            Sleep::Sec(0.1);
-            timeout--;
-            ok = (timeout > 0u);
+        if ((ok) && (pending)) {
+            //A started operation which was not yet built will already send the latest values
+            bool building = false;
+            EPICSPVAChannelWrapperPutSlot *freeSlot = NULL_PTR(EPICSPVAChannelWrapperPutSlot *);
+            uint32 s;
+            for (s = 0u; (s < maxPutsInFlight) && (!building); s++) {
+                if (putSlots[s].state == EPICS_PVA_PUT_SLOT_STARTED) {
+                    building = true;
+                }
+                else if (putSlots[s].state == EPICS_PVA_PUT_SLOT_FREE) {
+                    if (freeSlot == NULL_PTR(EPICSPVAChannelWrapperPutSlot *)) {
+                        freeSlot = &putSlots[s];
+                    }
+                }
+                else {
+                    //NOOP
+                }
+            }
+            if ((!building) && (freeSlot != NULL_PTR(EPICSPVAChannelWrapperPutSlot *))) {
+                (void) Atomic::Exchange(&freeSlot->state, EPICS_PVA_PUT_SLOT_STARTED);
+                //Outside of the putMux as putBuild may be called before channel.put returns
+                freeSlot->operation = channel.put(freeSlot);
+                numberOfPuts++;
+            }
+            else {
+                numberOfCoalescedPuts++;
+            }
+        }
+        if (!ok) {
+            //Send all the values again in the next Put
+            uint32 n;
+            for (n = 0u; n < numberOfSignals; n++) {
+                cachedSignals[n]->InvalidateLastPut();
+            }
         }
     }
     catch (epics::pvData::detail::ExceptionMixed<epics::pvData::BaseException> &ignored) {
@@ -326,6 +468,7 @@ bool EPICSPVAChannelWrapper::ResolveStructure(epics::pvData::PVFieldPtr pvField,
                 epics::pvData::PVStructureArray::const_svector arr(static_cast<const epics::pvData::PVStructureArray*>(field.operator ->())->view());
                 uint32 z;
                 REPORT_ERROR_STATIC(ErrorManagement::Debug, "Resolving structureArray [%s - %s] - [%d]", nodeName, field->getFieldName().c_str(), static_cast<int32>(arr.size()));
+                hasStructureArrays = true;
                 StreamString indexFullFieldName = fullFieldName;
                 ok = (arr.size() > 0);
                 for (z = 0u; (z < arr.size()) && (ok); z++) {
@@ -392,16 +535,29 @@ bool EPICSPVAChannelWrapper::Monitor() {
                             structureResolved = (monitorRoot.get() == monitor.root.get());
                         }
                         uint32 absIndex = 0u;
+                        bool refresh = (!structureResolved) || (hasStructureArrays);
                         if (!structureResolved) {
                             if (ok) {
                                 monitorRoot = monitor.root;
+                                hasStructureArrays = false;
                                 ok = ResolveStructure(std::const_pointer_cast<epics::pvData::PVStructure>(monitorRoot), "", absIndex);
                             }
                             structureResolved = ok;
                         }
                         if (ok) {
-                            absIndex = 0u;
-                            ok = RefreshStructure(std::const_pointer_cast<epics::pvData::PVStructure>(monitorRoot), absIndex);
+                            if (refresh) {
+                                absIndex = 0u;
+                                ok = RefreshStructure(std::const_pointer_cast<epics::pvData::PVStructure>(monitorRoot), absIndex);
+                            }
+                            else {
+                                //The fields of the root are updated in place: only copy the ones that changed
+                                uint32 n;
+                                for (n = 0u; (n < numberOfSignals) && (ok); n++) {
+                                    if (cachedSignals[n]->IsChanged(monitor.changed)) {
+                                        ok = cachedSignals[n]->Get();
+                                    }
+                                }
+                            }
                         }
                     }
                 }
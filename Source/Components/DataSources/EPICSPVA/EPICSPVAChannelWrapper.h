@@ -38,6 +38,7 @@
 #include "DataSourceI.h"
 #include "DjbHashFunction.h"
 #include "EPICSPVAFieldWrapper.h"
+#include "FastPollingMutexSem.h"
 #include "StreamString.h"
 #include "StructuredDataI.h"
 
@@ -73,8 +74,86 @@ struct EPICSPVAChannelWrapperCachedSignal {
     epics::pvData::PVFieldPtr pvField;
 };
 #endif
+
+class EPICSPVAChannelWrapper;
+
+/**
+ * State of an EPICSPVAChannelWrapperPutSlot which is not being used.
+ */
+const int32 EPICS_PVA_PUT_SLOT_FREE = 0;
+
+/**
+ * State of an EPICSPVAChannelWrapperPutSlot whose put was started but putBuild was not yet called.
+ */
+const int32 EPICS_PVA_PUT_SLOT_STARTED = 1;
+
+/**
+ * State of an EPICSPVAChannelWrapperPutSlot whose put was built and is waiting for putDone.
+ */
+const int32 EPICS_PVA_PUT_SLOT_BUILT = 2;
+
+/**
+ * @brief Holds one of the put operations that an EPICSPVAChannelWrapper may have in flight.
+ * @details Forwards the callbacks to the EPICSPVAChannelWrapper and tracks the state of the operation.
+ */
+class EPICSPVAChannelWrapperPutSlot: public pvac::ClientChannel::PutCallback {
+public:
+    /**
+     * @brief Constructor. Sets the state to EPICS_PVA_PUT_SLOT_FREE.
+     */
+    EPICSPVAChannelWrapperPutSlot();
+
+    /**
+     * @brief Destructor. Cancels the operation (if any).
+     */
+    virtual ~EPICSPVAChannelWrapperPutSlot();
+
+    /**
+     * @brief Sets the EPICSPVAChannelWrapper which builds and accounts the puts.
+     * @param[in] wrapperIn the EPICSPVAChannelWrapper.
+     */
+    void SetChannelWrapper(EPICSPVAChannelWrapper * const wrapperIn);
+
+    /**
+     * @brief Calls EPICSPVAChannelWrapper::putBuild and sets the state to EPICS_PVA_PUT_SLOT_BUILT.
+     * @param[in] build see pvac::ClientChannel::PutCallback
+     * @param[in,out] args see pvac::ClientChannel::PutCallback
+     */
+    virtual void putBuild(const epics::pvData::StructureConstPtr& build, pvac::ClientChannel::PutCallback::Args& args);
+
+    /**
+     * @brief Calls EPICSPVAChannelWrapper::putDone and sets the state to EPICS_PVA_PUT_SLOT_FREE.
+     * @param[in] evt see pvac::ClientChannel::PutCallback
+     */
+    virtual void putDone(const pvac::PutEvent& evt);
+
+    /**
+     * The operation (kept alive until it is done).
+     */
+    pvac::Operation operation;
+
+    /**
+     * One of EPICS_PVA_PUT_SLOT_FREE, EPICS_PVA_PUT_SLOT_STARTED or EPICS_PVA_PUT_SLOT_BUILT.
+     */
+    volatile int32 state;
+
+    /**
+     * The fields sent by this operation (so that they can be sent again if the operation fails).
+     */
+    epics::pvData::BitSet sentFields;
+
+private:
+    /**
+     * The EPICSPVAChannelWrapper which builds and accounts the puts.
+     */
+    EPICSPVAChannelWrapper *wrapper;
+};
+
 /**
  * @brief Helper class which encapsulates a PVA signal (record) and allows to put/monitor.
+ * @details The puts are asynchronous: Put only updates the PVA structure fields and starts a put operation, without waiting for it
+ * to complete. Up to SetMaxPutsInFlight operations may be in flight. While an operation is waiting to be built, or if all the operations
+ * are in flight, the changed fields are coalesced into the next operation (which sends the latest values).
  */
 class EPICSPVAChannelWrapper: public pvac::ClientChannel::PutCallback {
 public:
@@ -103,15 +182,60 @@ public:
      */
     bool Setup(DataSourceI &dataSource);
 
+    /**
+     * @brief Sets the maximum number of put operations that may be in flight.
+     * @details Shall be called before the first Put.
+     * @param[in] maxPutsInFlightIn the maximum number of put operations in flight (> 0).
+     */
+    void SetMaxPutsInFlight(const uint32 maxPutsInFlightIn);
+
+    /**
+     * @brief Creates the channel (if not already created). Does not wait for the server.
+     * @return true if the channel is valid.
+     */
+    bool Connect();
+
+    /**
+     * @brief Creates the channel (see Connect), gets the PVA structure from the server and resolves the fields of the signals.
+     * @details Waits for the server. Called before the first Put (e.g. at startup) so that the first Put does not wait for the server.
+     * Put resolves the structure itself if this method was not called or failed.
+     * @return true if the structure was resolved.
+     */
+    bool ResolvePutStructure();
+
     /**
      * @brief Copies from each signal memory (see GetSignalMemory) into the relevant PVA structure fields and commit the changes.
-     * @return true if all the signals have been successfully committed into the network.
+     * @details Only the signals whose memory changed since the last successful Put are copied and flagged to be sent
+     * (see putBuild). If no signal changed nothing is sent.
+     * Starts a put operation if no other operation is waiting to be built and if less than the maximum number of operations are
+     * in flight. Otherwise the changes are coalesced with the ones that will be sent by the next operation. Never waits for the server.
+     * @return true if the channel is connected and the signals were copied into the PVA structure fields.
      */
     bool Put();
 
+    /**
+     * @brief Gets the number of put operations started.
+     * @return the number of put operations started.
+     */
+    uint64 GetNumberOfPuts() const;
+
+    /**
+     * @brief Gets the number of Put calls whose changes were coalesced into a later put operation.
+     * @return the number of Put calls whose changes were coalesced into a later put operation.
+     */
+    uint64 GetNumberOfCoalescedPuts() const;
+
+    /**
+     * @brief Gets the number of put operations which failed (their fields are sent again with the next operation).
+     * @return the number of put operations which failed.
+     */
+    uint64 GetNumberOfFailedPuts() const;
+
     /**
      * @brief Copies from relevant PVA structure fields into each signal memory.
      * @details This method has a fixed timeout of 0.2 second.
+     * Once the monitored structure is resolved, and as long it does not contain arrays of structures (whose elements may be replaced),
+     * only the signals flagged as changed in the monitor update are copied, directly from the cached fields.
      * @return true if all the record and the monitor are valid.
      */
     bool Monitor();
@@ -129,7 +253,8 @@ public:
     const char8 * const GetFieldName();
 
     /**
-     * @brief The callback function that is called when the channel.put method is called. Sets the args.root to pvStruct.
+     * @brief The callback function that is called when the channel.put method is called. Sets the args.root to a copy of the
+     * fields of pvStruct which were updated since the previous put operation was built and args.tosend to these fields.
      * @param[in] build see pvac::ClientChannel::PutCallback
      * @param[in,out] args see pvac::ClientChannel::PutCallback
      */
@@ -141,6 +266,14 @@ public:
      */
     virtual void putDone(const pvac::PutEvent& evt);
 
+    /**
+     * @brief Called by an EPICSPVAChannelWrapperPutSlot when its put operation concludes.
+     * @details If the operation failed, its fields are flagged to be sent again.
+     * @param[in] slot the EPICSPVAChannelWrapperPutSlot.
+     * @param[in] evt see pvac::ClientChannel::PutCallback
+     */
+    void PutSlotDone(EPICSPVAChannelWrapperPutSlot &slot, const pvac::PutEvent& evt);
+
 private:
 
     /**
@@ -224,6 +357,46 @@ private:
      */
     ConfigurationDatabase signalsIndexCache;
 
+    /**
+     * The fields updated by Put which were not yet sent by a put operation.
+     */
+    epics::pvData::BitSet putChangedFields;
+
+    /**
+     * Protects the putPVStruct fields and putChangedFields between Put and the putBuild callbacks.
+     */
+    FastPollingMutexSem putMux;
+
+    /**
+     * The put operations.
+     */
+    EPICSPVAChannelWrapperPutSlot *putSlots;
+
+    /**
+     * The maximum number of put operations in flight.
+     */
+    uint32 maxPutsInFlight;
+
+    /**
+     * Number of put operations started.
+     */
+    uint64 numberOfPuts;
+
+    /**
+     * Number of Put calls whose changes were coalesced into a later put operation.
+     */
+    uint64 numberOfCoalescedPuts;
+
+    /**
+     * Number of put operations which failed.
+     */
+    uint64 numberOfFailedPuts;
+
+    /**
+     * True if the resolved structure contains arrays of structures.
+     */
+    bool hasStructureArrays;
+
     /**
      * Maps the absIndex of the recursed structure into the index of the cachedSignals where that signal is stored.
      * See ResolveStructure and RefreshStructure
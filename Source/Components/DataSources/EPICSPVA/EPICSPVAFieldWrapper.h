@@ -57,15 +57,17 @@ public:
     virtual ~EPICSPVAFieldWrapper();
 
     /**
-     * @brief Updates the PVA value from the current memory value.
+     * @brief Updates the PVA value from the current memory value, if the latter changed since the last Put.
+     * @return true if the PVA value was updated.
      * @pre
      *  SetMemory
      *  SetPVAField
      */
-    virtual void Put();
+    virtual bool Put();
 
     /**
      * @brief Updates the memory from the current PVA value.
+     * @details Arrays are copied in bulk (getAs does not copy the array if the PVA type is T).
      * @return true if the value can be successfully read.
      * @pre
      *  SetMemory
@@ -86,67 +88,75 @@ EPICSPVAFieldWrapper<T>::~EPICSPVAFieldWrapper() {
 }
 
 template<typename T>
-void EPICSPVAFieldWrapper<T>::Put() {
-    if (numberOfElements == 1u) {
-        epics::pvData::PVScalarPtr scalarFieldPtr = std::dynamic_pointer_cast<epics::pvData::PVScalar>(pvField);
-        if (scalarFieldPtr ? true : false) {
-            scalarFieldPtr->putFrom<T>(*static_cast<T *>(memory));
+bool EPICSPVAFieldWrapper<T>::Put() {
+    bool changed = UpdateLastPut(numberOfElements * static_cast<uint32>(sizeof(T)));
+    if (changed) {
+        if (numberOfElements == 1u) {
+            if (scalarField ? true : false) {
+                scalarField->putFrom<T>(*static_cast<T *>(memory));
+            }
+            else {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Signal %s has an invalid pv field", qualifiedName);
+                changed = false;
+            }
         }
         else {
-            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Signal %s has an invalid pv field", qualifiedName);
-        }
-    }
-    else {
-        epics::pvData::PVScalarArrayPtr scalarArrayPtr = std::dynamic_pointer_cast<epics::pvData::PVScalarArray>(pvField);
-        if (scalarArrayPtr ? true : false) {
-            epics::pvData::shared_vector<T> out;
-            out.resize(numberOfElements);
-            (void) MemoryOperationsHelper::Copy(reinterpret_cast<void *>(out.data()), memory, numberOfElements * sizeof(T));
-            epics::pvData::shared_vector<const T> outF = freeze(out);
-            scalarArrayPtr->putFrom<T>(outF);
+            if (scalarArrayField ? true : false) {
+                epics::pvData::shared_vector<T> out(numberOfElements);
+                (void) MemoryOperationsHelper::Copy(reinterpret_cast<void *>(out.data()), memory, numberOfElements * sizeof(T));
+                epics::pvData::shared_vector<const T> outF = freeze(out);
+                scalarArrayField->putFrom<T>(outF);
+            }
+            else {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Signal %s has an invalid pv field", qualifiedName);
+                changed = false;
+            }
         }
-        else {
-            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Signal %s has an invalid pv field", qualifiedName);
+        if (!changed) {
+            InvalidateLastPut();
         }
     }
+    return changed;
 }
 
 template<>
-inline void EPICSPVAFieldWrapper<char8>::Put() {
-    epics::pvData::PVScalarPtr scalarFieldPtr = std::dynamic_pointer_cast<epics::pvData::PVScalar>(pvField);
-    if (scalarFieldPtr ? true : false) {
-        std::string value = reinterpret_cast<char8 *>(memory);
-        scalarFieldPtr->putFrom<std::string>(value);
-    }
-    else {
-        REPORT_ERROR_STATIC(ErrorManagement::FatalError,
-                            "Signal %s has an invalid pv field. Note that arrays of strings are not supported in the data-source yet",
-                            qualifiedName.Buffer());
+inline bool EPICSPVAFieldWrapper<char8>::Put() {
+    bool changed = UpdateLastPut(numberOfElements);
+    if (changed) {
+        if (scalarField ? true : false) {
+            std::string value = reinterpret_cast<char8 *>(memory);
+            scalarField->putFrom<std::string>(value);
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError,
+                                "Signal %s has an invalid pv field. Note that arrays of strings are not supported in the data-source yet",
+                                qualifiedName.Buffer());
+            InvalidateLastPut();
+            changed = false;
+        }
     }
+    return changed;
 }
 
 template<typename T>
 bool EPICSPVAFieldWrapper<T>::Get() {
     bool ok = true;
     if (numberOfElements == 1u) {
-        epics::pvData::PVScalarPtr scalarFieldPtr = std::dynamic_pointer_cast<epics::pvData::PVScalar>(pvField);
-        ok = (scalarFieldPtr ? true : false);
+        ok = (scalarField ? true : false);
         if (ok) {
-            *reinterpret_cast<T *>(memory) = scalarFieldPtr->getAs<T>();
+            *reinterpret_cast<T *>(memory) = scalarField->getAs<T>();
         }
     }
     else {
-        epics::pvData::PVScalarArrayPtr scalarArrayPtr = std::dynamic_pointer_cast<epics::pvData::PVScalarArray>(pvField);
-        ok = (scalarArrayPtr ? true : false);
+        ok = (scalarArrayField ? true : false);
         if (ok) {
             epics::pvData::shared_vector<const T> out;
-            scalarArrayPtr->getAs<T>(out);
-            uint32 i;
-            Vector<T> readVec(reinterpret_cast<T *>(memory), numberOfElements);
-            Vector<T> srcVec(const_cast<T *>(reinterpret_cast<const T *>(out.data())), numberOfElements);
-            for (i = 0u; i < numberOfElements; i++) {
-                readVec[i] = srcVec[i];
+            scalarArrayField->getAs<T>(out);
+            uint32 nOfElements = static_cast<uint32>(out.size());
+            if (nOfElements > numberOfElements) {
+                nOfElements = numberOfElements;
             }
+            ok = MemoryOperationsHelper::Copy(memory, reinterpret_cast<const void *>(out.data()), nOfElements * static_cast<uint32>(sizeof(T)));
         }
     }
     return ok;
@@ -154,11 +164,9 @@ bool EPICSPVAFieldWrapper<T>::Get() {
 
 template<>
 inline bool EPICSPVAFieldWrapper<char8>::Get() {
-    bool ok = true;
-    epics::pvData::PVScalarPtr scalarFieldPtr = std::dynamic_pointer_cast<epics::pvData::PVScalar>(pvField);
-    ok = (scalarFieldPtr ? true : false);
+    bool ok = (scalarField ? true : false);
     if (ok) {
-        std::string value = scalarFieldPtr->getAs<std::string>();
+        std::string value = scalarField->getAs<std::string>();
         uint32 maxSize = value.size();
         if (maxSize > numberOfElements) {
             maxSize = numberOfElements;
@@ -32,6 +32,8 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "EPICSPVAFieldWrapperI.h"
+#include "GlobalObjectsDatabase.h"
+#include "MemoryOperationsHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -49,16 +51,70 @@ void EPICSPVAFieldWrapperI::SetMemory(uint32 numberOfElementsIn, const char8 *qu
 }
 
 void EPICSPVAFieldWrapperI::SetPVAField(epics::pvData::PVFieldPtr pvFieldIn) {
-    pvField = pvFieldIn;
+    //The monitor refreshes the fields on every update. Only resolve them again if they were replaced.
+    if (pvFieldIn.get() != pvField.get()) {
+        pvField = pvFieldIn;
+        scalarField = std::dynamic_pointer_cast<epics::pvData::PVScalar>(pvField);
+        scalarArrayField = std::dynamic_pointer_cast<epics::pvData::PVScalarArray>(pvField);
+        fieldOffset = 0u;
+        if (pvField ? true : false) {
+            fieldOffset = static_cast<uint32>(pvField->getFieldOffset());
+        }
+        lastPutValid = false;
+    }
+}
+
+uint32 EPICSPVAFieldWrapperI::GetFieldOffset() const {
+    return fieldOffset;
+}
+
+bool EPICSPVAFieldWrapperI::IsChanged(const epics::pvData::BitSet &changedFields) const {
+    bool changed = changedFields.get(fieldOffset);
+    const epics::pvData::PVStructure *parent = NULL_PTR(const epics::pvData::PVStructure *);
+    if (pvField ? true : false) {
+        parent = pvField->getParent();
+    }
+    while ((!changed) && (parent != NULL_PTR(const epics::pvData::PVStructure *))) {
+        changed = changedFields.get(static_cast<uint32>(parent->getFieldOffset()));
+        parent = parent->getParent();
+    }
+    return changed;
+}
+
+void EPICSPVAFieldWrapperI::InvalidateLastPut() {
+    lastPutValid = false;
+}
+
+bool EPICSPVAFieldWrapperI::UpdateLastPut(const uint32 memorySize) {
+    bool changed = true;
+    if (lastPutMemory == NULL_PTR(void *)) {
+        lastPutMemory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(memorySize);
+    }
+    else if (lastPutValid) {
+        changed = (MemoryOperationsHelper::Compare(memory, lastPutMemory, memorySize) != 0);
+    }
+    else {
+        //NOOP
+    }
+    if (changed) {
+        lastPutValid = MemoryOperationsHelper::Copy(lastPutMemory, memory, memorySize);
+    }
+    return changed;
 }
 
 EPICSPVAFieldWrapperI::EPICSPVAFieldWrapperI() {
     numberOfElements = 0u;
     memory = NULL_PTR(void *);
     qualifiedName = "";
+    fieldOffset = 0u;
+    lastPutMemory = NULL_PTR(void *);
+    lastPutValid = false;
 }
 
 EPICSPVAFieldWrapperI::~EPICSPVAFieldWrapperI() {
+    if (lastPutMemory != NULL_PTR(void *)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(lastPutMemory);
+    }
 }
 }
 
@@ -65,14 +65,39 @@ public:
 
     /**
      * @brief Sets the PVA field.
+     * @details The scalar (or scalar array) interface of the field and its offset are only resolved when the field changes,
+     * in which case the next Put will always update the PVA value.
      * @param[in] pvFieldIn the pvField to set.
      */
     void SetPVAField(epics::pvData::PVFieldPtr pvFieldIn);
 
     /**
-     * @brief Updates the PVA value from the current memory value.
+     * @brief Gets the offset of the PVA field in its top level structure (i.e. its bit in the BitSet of the put and monitor operations).
+     * @return the offset of the PVA field.
+     * @pre
+     *  SetPVAField
      */
-    virtual void Put() = 0;
+    uint32 GetFieldOffset() const;
+
+    /**
+     * @brief Checks if the PVA field (or any of its parent structures) is flagged in \a changedFields.
+     * @param[in] changedFields the BitSet of the changed fields of a monitor update.
+     * @return true if the PVA field value may have changed.
+     * @pre
+     *  SetPVAField
+     */
+    bool IsChanged(const epics::pvData::BitSet &changedFields) const;
+
+    /**
+     * @brief Forces the next Put to update the PVA value, even if the memory value did not change.
+     */
+    void InvalidateLastPut();
+
+    /**
+     * @brief Updates the PVA value from the current memory value, if the memory value changed since the last Put.
+     * @return true if the PVA value was updated.
+     */
+    virtual bool Put() = 0;
 
     /**
      * @brief Updates the memory from the current PVA value.
@@ -81,6 +106,13 @@ public:
     virtual bool Get() = 0;
 
 protected:
+    /**
+     * @brief Checks if the \a memorySize bytes of memory changed since the last call and stores a copy of them.
+     * @param[in] memorySize the size of the signal memory.
+     * @return true if the memory changed or if this is the first call after SetPVAField or InvalidateLastPut.
+     */
+    bool UpdateLastPut(const uint32 memorySize);
+
     /**
      * Number of elements in the record signal.
      */
@@ -100,6 +132,31 @@ protected:
      * The pv field
      */
     epics::pvData::PVFieldPtr pvField;
+
+    /**
+     * The pvField as a scalar (if it is one).
+     */
+    epics::pvData::PVScalarPtr scalarField;
+
+    /**
+     * The pvField as a scalar array (if it is one).
+     */
+    epics::pvData::PVScalarArrayPtr scalarArrayField;
+
+    /**
+     * The offset of the pvField in its top level structure.
+     */
+    uint32 fieldOffset;
+
+    /**
+     * Copy of the memory at the last Put.
+     */
+    void *lastPutMemory;
+
+    /**
+     * True if lastPutMemory holds the value of the last Put.
+     */
+    bool lastPutValid;
 };
 }
 
@@ -42,10 +42,12 @@ EPICSPVAOutput::EPICSPVAOutput() :
     numberOfBrokerBuffers = 0u;
     numberOfChannels = 0u;
     ignoreBufferOverrun = 1u;
+    maxPutsInFlight = 2u;
     channelList = NULL_PTR(EPICSPVAChannelWrapper *);
 }
 
 EPICSPVAOutput::~EPICSPVAOutput() {
+    (void) startup.Wait();
     if (channelList != NULL_PTR(EPICSPVAChannelWrapper *)) {
         delete[] channelList;
     }
@@ -69,6 +71,13 @@ bool EPICSPVAOutput::Initialise(StructuredDataI & data) {
         if (!data.Read("IgnoreBufferOverrun", ignoreBufferOverrun)) {
             REPORT_ERROR(ErrorManagement::Information, "No IgnoreBufferOverrun defined. Using default = %d", ignoreBufferOverrun);
         }
+        if (!data.Read("MaxPutsInFlight", maxPutsInFlight)) {
+            REPORT_ERROR(ErrorManagement::Information, "No MaxPutsInFlight defined. Using default = %d", maxPutsInFlight);
+        }
+        ok = (maxPutsInFlight > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "MaxPutsInFlight shall be > 0");
+        }
 
     }
     if (ok) {
@@ -153,12 +162,30 @@ bool EPICSPVAOutput::AllocateMemory() {
     bool ok = MemoryDataSourceI::AllocateMemory();
     uint32 n;
     for (n = 0u; (n < numberOfChannels) && (ok); n++) {
+        channelList[n].SetMaxPutsInFlight(maxPutsInFlight);
         ok = channelList[n].Setup(*this);
     }
+    if (ok) {
+        ok = startup.Start(*this, GetName());
+    }
 
     return ok;
 }
 
+bool EPICSPVAOutput::ExecuteStartup() {
+    uint32 n;
+    //Create all the channels first, so that the servers are searched for in parallel
+    for (n = 0u; n < numberOfChannels; n++) {
+        (void) channelList[n].Connect();
+    }
+    for (n = 0u; n < numberOfChannels; n++) {
+        if (!channelList[n].ResolvePutStructure()) {
+            REPORT_ERROR(ErrorManagement::Warning, "Record %s not available at startup", channelList[n].GetChannelName());
+        }
+    }
+    return true;
+}
+
 uint32 EPICSPVAOutput::GetNumberOfMemoryBuffers() {
     return 1u;
 }
@@ -183,8 +210,10 @@ bool EPICSPVAOutput::GetOutputBrokers(ReferenceContainer& outputBrokers, const c
     return ok;
 }
 
-/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: NOOP at StateChange, independently of the function parameters.*/
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: independent of the function parameters.*/
 bool EPICSPVAOutput::PrepareNextState(const char8* const currentStateName, const char8* const nextStateName) {
+    //Only waits in the first call
+    (void) startup.Wait();
     return true;
 }
 
@@ -196,11 +225,45 @@ uint32 EPICSPVAOutput::GetCPUMask() const {
     return cpuMask;
 }
 
+uint32 EPICSPVAOutput::GetMaxPutsInFlight() const {
+    return maxPutsInFlight;
+}
+
+uint64 EPICSPVAOutput::GetNumberOfPuts() const {
+    uint64 total = 0u;
+    uint32 n;
+    for (n = 0u; n < numberOfChannels; n++) {
+        total += channelList[n].GetNumberOfPuts();
+    }
+    return total;
+}
+
+uint64 EPICSPVAOutput::GetNumberOfCoalescedPuts() const {
+    uint64 total = 0u;
+    uint32 n;
+    for (n = 0u; n < numberOfChannels; n++) {
+        total += channelList[n].GetNumberOfCoalescedPuts();
+    }
+    return total;
+}
+
+uint64 EPICSPVAOutput::GetNumberOfFailedPuts() const {
+    uint64 total = 0u;
+    uint32 n;
+    for (n = 0u; n < numberOfChannels; n++) {
+        total += channelList[n].GetNumberOfFailedPuts();
+    }
+    return total;
+}
+
 bool EPICSPVAOutput::Synchronise() {
     bool ok = true;
     uint32 n;
-    for (n = 0u; (n < numberOfChannels) && (ok); n++) {
-        ok = channelList[n].Put();
+    //Do not stop at the first record which is not connected, so that the others still get their values
+    for (n = 0u; n < numberOfChannels; n++) {
+        if (!channelList[n].Put()) {
+            ok = false;
+        }
     }
     return ok;
 }
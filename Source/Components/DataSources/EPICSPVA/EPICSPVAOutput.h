@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "AsyncStartup.h"
 #include "EPICSPVAChannelWrapper.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "EventSem.h"
@@ -58,6 +59,7 @@ namespace MARTe {
  *     CPUs = 0xff //Optional the affinity of the EmbeddedThread which actually performs the PVA puts.
  *     IgnoreBufferOverrun = 1 //Optional. If true no error will be triggered when the thread that writes into EPICS does not consume the data fast enough.
  *     NumberOfBuffers = 10 //Compulsory. Number of buffers in a circular buffer that asynchronously writes the values. Each buffer is capable of holding a copy of all the DataSourceI signals.
+ *     MaxPutsInFlight = 2 //Optional (> 0). Default = 2. Maximum number of pva::put operations in flight per record. When reached (or while a put is waiting to be built) the new values are coalesced into the next put.
  *     Signals = {
  *         RecordOut1Value = {//Record name if the Alias field is not set
  *             Alias = "alternative::channel::name"
@@ -78,8 +80,16 @@ namespace MARTe {
  * }
  *
  * </pre>
+ *
+ * The pva::put operations do not wait for the server. Each record sends the latest values of the signals that changed, so that a slow server
+ * drops (coalesces) intermediate values instead of stalling the thread that empties the broker buffers.
+ *
+ * The records are connected, and their structures are resolved, by a separate thread started at the end of AllocateMemory
+ * (see AsyncStartup) and the first PrepareNextState waits for its completion. The records of all the DataSources are thus connected
+ * in parallel and the first put does not wait for the server. Records which are not available at startup are connected again by the
+ * following puts (as before).
  */
-class EPICSPVAOutput: public MemoryDataSourceI {
+class EPICSPVAOutput: public MemoryDataSourceI, public AsyncStartupTaskI {
 public:
     CLASS_REGISTER_DECLARATION()
 
@@ -109,12 +119,19 @@ EPICSPVAOutput    ();
             const SignalDirection direction);
 
     /**
-     * @brief See DataSourceI::PrepareNextState. NOOP.
+     * @brief See DataSourceI::PrepareNextState. Waits for the records to be connected (see AllocateMemory).
      * @return true.
      */
     virtual bool PrepareNextState(const char8 * const currentStateName,
             const char8 * const nextStateName);
 
+    /**
+     * @brief Connects all the records and then resolves their structures (see EPICSPVAChannelWrapper::ResolvePutStructure).
+     * Called by the startup thread.
+     * @return true (records which are not available are only reported, as they are connected again by the puts).
+     */
+    virtual bool ExecuteStartup();
+
     /**
      * @brief Loads and verifies the configuration parameters detailed in the class description.
      * @return true if all the mandatory parameters are correctly specified and if the specified optional parameters have valid values.
@@ -145,15 +162,40 @@ EPICSPVAOutput    ();
     uint32 GetStackSize() const;
 
     /**
-     * @brief Calls EPICSPVAChannelWrapper::Setup and start the threading service.
+     * @brief Gets the maximum number of pva::put operations in flight per record.
+     * @return the maximum number of pva::put operations in flight per record.
+     */
+    uint32 GetMaxPutsInFlight() const;
+
+    /**
+     * @brief Gets the number of pva::put operations started (summed over all the records).
+     * @return the number of pva::put operations started.
+     */
+    uint64 GetNumberOfPuts() const;
+
+    /**
+     * @brief Gets the number of updates which were coalesced into a later pva::put (summed over all the records).
+     * @return the number of updates which were coalesced into a later pva::put.
+     */
+    uint64 GetNumberOfCoalescedPuts() const;
+
+    /**
+     * @brief Gets the number of pva::put operations which failed (summed over all the records).
+     * @return the number of pva::put operations which failed.
+     */
+    uint64 GetNumberOfFailedPuts() const;
+
+    /**
+     * @brief Calls EPICSPVAChannelWrapper::Setup and starts the connection of the records.
      * @details see MemoryDataSourceI::AllocateMemory
-     * @return true if the EPICSPVAChannelWrapper::Setup was successful and the service started.
+     * @return true if the EPICSPVAChannelWrapper::Setup was successful and the connection started.
      */
     virtual bool AllocateMemory();
 
     /**
      * @brief Provides the context to execute all the EPICS calls.
-     * @return true if all the all the variables can be successfully set and exec.
+     * @details Calls EPICSPVAChannelWrapper::Put on all the records, which start (or coalesce) the pva::put without waiting for their completion.
+     * @return true if all the records are connected and their variables can be successfully set.
      */
     virtual bool Synchronise();
 
@@ -184,6 +226,11 @@ private:
      */
     EPICSPVAChannelWrapper *channelList;
 
+    /**
+     * Connects the records in parallel with the other DataSources.
+     */
+    AsyncStartup startup;
+
     /**
      * Number of channels (records).
      */
@@ -209,6 +256,11 @@ private:
      */
     uint32 numberOfBrokerBuffers;
 
+    /**
+     * The maximum number of pva::put operations in flight per record.
+     */
+    uint32 maxPutsInFlight;
+
     /**
      * The broker.
      */
@@ -33,6 +33,7 @@
 
 #include "EpicsInputDataSource.h"
 
+#include "AdvancedErrorManagement.h"
 #include "FastPollingMutexSem.h"
 #include "HeapManager.h"
 #include "MemoryMapSynchronisedInputBroker.h"
@@ -101,7 +102,11 @@ namespace MARTe {
 EpicsInputDataSource::EpicsInputDataSource() :
         DataSourceI(),
         consumer(SDA_NULL_PTR(SDA::SharedDataArea::SigblockConsumer*)),
-        signals(SDA_NULL_PTR(SDA::Sigblock*)) {
+        signals(SDA_NULL_PTR(SDA::Sigblock*)),
+        ringDepth(0u),
+        shmPolicy(),
+        hugeTLBFSPath(),
+        readLatest(false) {
 }
 
 EpicsInputDataSource::~EpicsInputDataSource() {
@@ -114,14 +119,91 @@ EpicsInputDataSource::~EpicsInputDataSource() {
     if (consumer != SDA_NULL_PTR(SDA::SharedDataArea::SigblockConsumer*)) {
         consumer = SDA_NULL_PTR(SDA::SharedDataArea::SigblockConsumer*);
         /*lint -e{1551} Platform::DestroyShm does not throw exceptions*/
-        (void) SDA::Platform::DestroyShm(sharedDataAreaName.Buffer());
+        (void) SDA::Platform::DestroyShm(sharedDataAreaName.Buffer(), shmPolicy);
     }
 }
 
+bool EpicsInputDataSource::Initialise(StructuredDataI &data) {
+    bool ret = DataSourceI::Initialise(data);
+    if (ret) {
+        if (!data.Read("RingDepth", ringDepth)) {
+            ringDepth = 0u;
+        }
+    }
+    if (ret) {
+        StreamString hugePages;
+        if (!data.Read("HugePages", hugePages)) {
+            hugePages = "None";
+        }
+        if (hugePages == "None") {
+            shmPolicy.hugePages = SDA::ShmPolicy::NoHugePages;
+        }
+        else if (hugePages == "Transparent") {
+            shmPolicy.hugePages = SDA::ShmPolicy::TransparentHugePages;
+        }
+        else if (hugePages == "HugeTLBFS") {
+            shmPolicy.hugePages = SDA::ShmPolicy::HugeTLBFSHugePages;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "HugePages shall be None, Transparent or HugeTLBFS");
+            ret = false;
+        }
+    }
+    if (ret) {
+        if (data.Read("HugeTLBFSPath", hugeTLBFSPath)) {
+            shmPolicy.hugeTLBFSPath = hugeTLBFSPath.Buffer();
+        }
+        uint32 hugePageSize;
+        if (data.Read("HugePageSize", hugePageSize)) {
+            ret = (hugePageSize > 0u);
+            if (ret) {
+                shmPolicy.hugePageSize = static_cast<SDA::size_type>(hugePageSize);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "HugePageSize shall be > 0");
+            }
+        }
+    }
+    if (ret) {
+        uint32 lockMemory;
+        if (!data.Read("LockMemory", lockMemory)) {
+            lockMemory = 0u;
+        }
+        shmPolicy.lock = (lockMemory == 1u);
+        uint32 prefault;
+        if (!data.Read("Prefault", prefault)) {
+            prefault = 0u;
+        }
+        shmPolicy.prefault = (prefault == 1u);
+    }
+    if (ret) {
+        StreamString readMode;
+        if (!data.Read("ReadMode", readMode)) {
+            readMode = "All";
+        }
+        if (readMode == "Latest") {
+            readLatest = true;
+        }
+        else if (readMode == "All") {
+            readLatest = false;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "ReadMode shall be All or Latest");
+            ret = false;
+        }
+    }
+    return ret;
+}
+
 bool EpicsInputDataSource::Synchronise() {
     bool ok;
     if ((consumer != SDA_NULL_PTR(SDA::SharedDataArea::SigblockConsumer*)) && (signals != SDA_NULL_PTR(SDA::Sigblock*))) {
-        ok = consumer->ReadSigblock(*signals);
+        if (readLatest) {
+            ok = consumer->ReadLatestSigblock(*signals);
+        }
+        else {
+            ok = consumer->ReadSigblock(*signals);
+        }
     }
     else {
         ok = false;
@@ -155,7 +237,7 @@ bool EpicsInputDataSource::AllocateMemory() {
 
     SDA::SharedDataArea sbpm;
     /*lint -e{9132} array's length given by numberOfSignals*/
-    ret = SDA::SharedDataArea::BuildSharedDataAreaForMARTe(sbpm, sharedDataAreaName.Buffer(), numSignals, smd_for_init);
+    ret = SDA::SharedDataArea::BuildSharedDataAreaForMARTe(sbpm, sharedDataAreaName.Buffer(), numSignals, smd_for_init, ringDepth, shmPolicy);
     if (ret) {
         consumer = sbpm.GetSigblockConsumerInterface();
         SDA::Sigblock::Metadata* sbmd = consumer->GetSigblockMetadata();
@@ -247,6 +329,22 @@ MARTe::StreamString EpicsInputDataSource::GetSharedDataAreaName() const {
     return sharedDataAreaName;
 }
 
+uint32 EpicsInputDataSource::GetOverruns() const {
+    uint32 overruns = 0u;
+    if (consumer != SDA_NULL_PTR(SDA::SharedDataArea::SigblockConsumer*)) {
+        overruns = consumer->GetOverruns();
+    }
+    return overruns;
+}
+
+uint32 EpicsInputDataSource::GetSkipped() const {
+    uint32 skipped = 0u;
+    if (consumer != SDA_NULL_PTR(SDA::SharedDataArea::SigblockConsumer*)) {
+        skipped = consumer->GetSkipped();
+    }
+    return skipped;
+}
+
 CLASS_REGISTER(EpicsInputDataSource, "1.0")
 
 }
@@ -53,10 +53,19 @@ namespace MARTe {
  * area in the OS, named "<application_name>_<datasource_name>", where the ex-
  * change of signals will occur. It is expected that the EPICS IOC connects to
  * the shared memory area and puts in the fresher signals' values.
+ * With RingDepth > 0 the shared memory area holds a wait-free ring of
+ * sigblocks instead of a double buffer (see SDA::SigblockRing).
  *
  * The configuration syntax is (names are only given as an example):
  * +ImportSignalsFromIOC = {
  *     Class = EpicsInputDataSource
+ *     RingDepth = 16 //Optional, defaults to 0 (double buffer). Number of sigblocks queued in the shared memory area.
+ *     HugePages = HugeTLBFS //Optional, defaults to None. None, Transparent (madvise on the POSIX shared memory) or HugeTLBFS (file on a hugetlbfs mount). See SDA::ShmPolicy.
+ *     HugeTLBFSPath = "/dev/hugepages" //Optional, defaults to /dev/hugepages. Mount point of the hugetlbfs, only used if HugePages = HugeTLBFS.
+ *     HugePageSize = 2097152 //Optional, defaults to 2097152 (2MB). Page size of the hugetlbfs mount (e.g. 1073741824 for 1GB pages).
+ *     LockMemory = 1 //Optional, defaults to 0. If 1 the shared memory area is mlocked (requires a large enough RLIMIT_MEMLOCK or CAP_IPC_LOCK).
+ *     Prefault = 1 //Optional, defaults to 0. If 1 every page of the shared memory area is faulted in when it is created.
+ *     ReadMode = All //Optional, defaults to All. All (every sigblock, oldest first) or Latest (the freshest sigblock, discarding the older). Only meaningful if RingDepth > 0.
  * }
  *
  * A signal will be added for each GAM signal that reads to this instance of
@@ -85,6 +94,12 @@ public:
      */
     virtual ~EpicsInputDataSource();
 
+    /**
+     * @see DataSourceI::Initialise()
+     * @note Reads the optional parameters listed in the class description.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
     /**
      * @see DataSourceI::Synchronise()
      * @note It will set the signals' values of the datasource reading them
@@ -151,6 +166,18 @@ public:
      */
     virtual MARTe::StreamString GetSharedDataAreaName() const;
 
+    /**
+     * @brief Returns the number of sigblocks lost because the ring was full
+     * (always 0 if RingDepth = 0).
+     */
+    uint32 GetOverruns() const;
+
+    /**
+     * @brief Returns the number of sigblocks discarded by ReadMode = Latest
+     * (always 0 if RingDepth = 0).
+     */
+    uint32 GetSkipped() const;
+
 private:
 
     /**
@@ -168,6 +195,26 @@ private:
      * The name of the shared data area.
      */
     MARTe::StreamString sharedDataAreaName;
+
+    /**
+     * The number of sigblocks of the ring (0 for a double buffer).
+     */
+    uint32 ringDepth;
+
+    /**
+     * The backing and residency of the shared memory area.
+     */
+    SDA::ShmPolicy shmPolicy;
+
+    /**
+     * Storage of shmPolicy.hugeTLBFSPath.
+     */
+    StreamString hugeTLBFSPath;
+
+    /**
+     * True if ReadMode = Latest.
+     */
+    bool readLatest;
 };
 
 }
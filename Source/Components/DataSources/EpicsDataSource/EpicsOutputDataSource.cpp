@@ -33,7 +33,7 @@
 
 #include "EpicsOutputDataSource.h"
 
-//#include "AdvancedErrorManagement.h"
+#include "AdvancedErrorManagement.h"
 #include "FastPollingMutexSem.h"
 #include "HeapManager.h"
 #include "MemoryMapSynchronisedOutputBroker.h"
@@ -103,7 +103,10 @@ namespace MARTe {
 EpicsOutputDataSource::EpicsOutputDataSource() :
         DataSourceI(),
         producer(SDA_NULL_PTR(SDA::SharedDataArea::SigblockProducer*)),
-        signals(SDA_NULL_PTR(SDA::Sigblock*)) {
+        signals(SDA_NULL_PTR(SDA::Sigblock*)),
+        ringDepth(0u),
+        shmPolicy(),
+        hugeTLBFSPath() {
 }
 
 EpicsOutputDataSource::~EpicsOutputDataSource() {
@@ -116,14 +119,74 @@ EpicsOutputDataSource::~EpicsOutputDataSource() {
     if (producer != SDA_NULL_PTR(SDA::SharedDataArea::SigblockProducer*)) {
         producer = SDA_NULL_PTR(SDA::SharedDataArea::SigblockProducer*);
         /*lint -e{1551} Platform::DestroyShm does not throw exceptions*/
-        (void) SDA::Platform::DestroyShm(sharedDataAreaName.Buffer());
+        (void) SDA::Platform::DestroyShm(sharedDataAreaName.Buffer(), shmPolicy);
     }
 }
 
+bool EpicsOutputDataSource::Initialise(StructuredDataI &data) {
+    bool ret = DataSourceI::Initialise(data);
+    if (ret) {
+        if (!data.Read("RingDepth", ringDepth)) {
+            ringDepth = 0u;
+        }
+    }
+    if (ret) {
+        StreamString hugePages;
+        if (!data.Read("HugePages", hugePages)) {
+            hugePages = "None";
+        }
+        if (hugePages == "None") {
+            shmPolicy.hugePages = SDA::ShmPolicy::NoHugePages;
+        }
+        else if (hugePages == "Transparent") {
+            shmPolicy.hugePages = SDA::ShmPolicy::TransparentHugePages;
+        }
+        else if (hugePages == "HugeTLBFS") {
+            shmPolicy.hugePages = SDA::ShmPolicy::HugeTLBFSHugePages;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "HugePages shall be None, Transparent or HugeTLBFS");
+            ret = false;
+        }
+    }
+    if (ret) {
+        if (data.Read("HugeTLBFSPath", hugeTLBFSPath)) {
+            shmPolicy.hugeTLBFSPath = hugeTLBFSPath.Buffer();
+        }
+        uint32 hugePageSize;
+        if (data.Read("HugePageSize", hugePageSize)) {
+            ret = (hugePageSize > 0u);
+            if (ret) {
+                shmPolicy.hugePageSize = static_cast<SDA::size_type>(hugePageSize);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "HugePageSize shall be > 0");
+            }
+        }
+    }
+    if (ret) {
+        uint32 lockMemory;
+        if (!data.Read("LockMemory", lockMemory)) {
+            lockMemory = 0u;
+        }
+        shmPolicy.lock = (lockMemory == 1u);
+        uint32 prefault;
+        if (!data.Read("Prefault", prefault)) {
+            prefault = 0u;
+        }
+        shmPolicy.prefault = (prefault == 1u);
+    }
+    return ret;
+}
+
 bool EpicsOutputDataSource::Synchronise() {
     bool ok;
     if ((producer != SDA_NULL_PTR(SDA::SharedDataArea::SigblockProducer*)) && (signals != SDA_NULL_PTR(SDA::Sigblock*))) {
         ok = producer->WriteSigblock(*signals);
+        if ((!ok) && (ringDepth > 0u)) {
+            //The sigblock was dropped because the ring is full: it has been counted as an overrun
+            ok = true;
+        }
     }
     else {
         ok = false;
@@ -157,7 +220,7 @@ bool EpicsOutputDataSource::AllocateMemory() {
 
     SDA::SharedDataArea sbpm;
     /*lint -e{9132} array's length given by numberOfSignals*/
-    ret = SDA::SharedDataArea::BuildSharedDataAreaForMARTe(sbpm, sharedDataAreaName.Buffer(), numSignals, smd_for_init);
+    ret = SDA::SharedDataArea::BuildSharedDataAreaForMARTe(sbpm, sharedDataAreaName.Buffer(), numSignals, smd_for_init, ringDepth, shmPolicy);
     if (ret) {
         producer = sbpm.GetSigblockProducerInterface();
         SDA::Sigblock::Metadata* sbmd = producer->GetSigblockMetadata();
@@ -249,6 +312,14 @@ MARTe::StreamString EpicsOutputDataSource::GetSharedDataAreaName() const {
     return sharedDataAreaName;
 }
 
+uint32 EpicsOutputDataSource::GetOverruns() const {
+    uint32 overruns = 0u;
+    if (producer != SDA_NULL_PTR(SDA::SharedDataArea::SigblockProducer*)) {
+        overruns = producer->GetOverruns();
+    }
+    return overruns;
+}
+
 CLASS_REGISTER(EpicsOutputDataSource, "1.0")
 
 }
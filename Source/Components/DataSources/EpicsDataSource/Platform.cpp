@@ -31,10 +31,12 @@
 //#include <cerrno>
 //#include <cstdio>
 #ifndef LINT
+#include <cstdio>       //Import std::snprintf function
 #include <cstdlib>      //Import exit function.
 #include <cstring>      //Import std::memset function
 #endif
 #include <fcntl.h>      //Import file O_* constants.
+#include <limits.h>     //Import PATH_MAX constant.
 #include <sys/stat.h>   //Import file mode constants.
 #include <sys/mman.h>   //Import POSIX shared memory functions.
 #include <unistd.h>     //Import ftruncate function.
@@ -53,6 +55,90 @@ namespace {
 
 /*lint -e{9130} the oflag argument of shm_open is defined as int and it can not be changed*/
 const SDA::uint32 OPEN_MODE = static_cast<SDA::uint32>(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+
+/**
+ * Default size of the huge pages (2MB).
+ */
+const SDA::size_type DEFAULT_HUGE_PAGE_SIZE = 2097152u;
+
+/**
+ * @brief Builds the path of a shared memory on a hugetlbfs.
+ * @return false if the path does not fit on the buffer.
+ */
+bool BuildHugeTLBFSPath(SDA::char8 (&path)[PATH_MAX],
+                        const SDA::char8* const dir,
+                        const SDA::char8* const name) {
+    const SDA::char8* sep = (name[0] == '/') ? "" : "/";
+    SDA::int32 len = std::snprintf(&path[0], static_cast<SDA::size_type>(PATH_MAX), "%s%s%s", dir, sep, name);
+    return ((len > 0) && (len < PATH_MAX));
+}
+
+/**
+ * @brief Opens a shared memory, either as a POSIX shared memory object or
+ * as a file on a hugetlbfs.
+ * @return the file descriptor or -1 on error.
+ */
+SDA::int32 OpenShm(const SDA::char8* const name,
+                   const SDA::uint32 flags,
+                   const bool onHugeTLBFS,
+                   const SDA::ShmPolicy& policy) {
+    SDA::int32 shm_fd = -1;
+    if (onHugeTLBFS) {
+        SDA::char8 path[PATH_MAX];
+        if ((policy.hugeTLBFSPath != SDA_NULL_PTR(const SDA::char8*)) && (BuildHugeTLBFSPath(path, policy.hugeTLBFSPath, name))) {
+            /*lint -e{9130} the oflag argument of open is defined as int and it can not be changed*/
+            shm_fd = open(&path[0], static_cast<SDA::int32>(flags), OPEN_MODE);
+        }
+    }
+    else {
+        shm_fd = shm_open(name, static_cast<SDA::int32>(flags), OPEN_MODE);
+    }
+    return shm_fd;
+}
+
+/**
+ * @brief Maps a shared memory and applies the residency options of the
+ * policy.
+ * @return the base address or NULL on error.
+ */
+void* MapShm(const SDA::int32 shm_fd,
+             const SDA::size_type size,
+             const SDA::ShmPolicy& policy) {
+    bool ok = true;
+    /*lint -e{9130} the prot argument of mmap is defined as int and it can not be changed*/
+    void* result = mmap(SDA_NULL_PTR(void*), size, PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, static_cast<off_t>(0));
+    if (result == /*lint -e(1924) -e(923)*/MAP_FAILED) {
+        ok = false;
+    }
+#ifdef MADV_HUGEPAGE
+    if ((ok) && (policy.hugePages == SDA::ShmPolicy::TransparentHugePages)) {
+        //It is only a hint, so an error does not invalidate the mapping
+        (void) madvise(result, size, MADV_HUGEPAGE);
+    }
+#endif
+    if ((ok) && (policy.prefault)) {
+        //Touching the pages (after the madvise) faults them in with the right page size
+        SDA::size_type pageSize = static_cast<SDA::size_type>(sysconf(_SC_PAGESIZE));
+        if (policy.hugePages == SDA::ShmPolicy::HugeTLBFSHugePages) {
+            pageSize = policy.hugePageSize;
+        }
+        volatile SDA::char8* bytes = static_cast<volatile SDA::char8*>(result);
+        for (SDA::size_type i = 0u; i < size; i += pageSize) {
+            (void) bytes[i];
+        }
+    }
+    if ((ok) && (policy.lock)) {
+        if (mlock(result, size) == -1) {
+            (void) munmap(result, size);
+            ok = false;
+        }
+    }
+    if (!ok) {
+        result = SDA_NULL_PTR(void*);
+    }
+    return result;
+}
+
 }
 
 /*---------------------------------------------------------------------------*/
@@ -61,17 +147,40 @@ const SDA::uint32 OPEN_MODE = static_cast<SDA::uint32>(S_IRUSR | S_IWUSR | S_IRG
 
 namespace SDA {
 
+ShmPolicy::ShmPolicy() :
+        hugePages(NoHugePages),
+        hugeTLBFSPath("/dev/hugepages"),
+        hugePageSize(DEFAULT_HUGE_PAGE_SIZE),
+        lock(false),
+        prefault(false) {
+}
+
 void* Platform::MakeShm(const SDA::char8* const name,
                         const SDA::size_type size) {
+    return MakeShm(name, size, ShmPolicy());
+}
+
+void* Platform::MakeShm(const SDA::char8* const name,
+                        const SDA::size_type size,
+                        const ShmPolicy& policy) {
 
     bool ok;
     void* result = SDA_NULL_PTR(void*);
 
     SDA::int32 shm_fd;
 
+    SDA::size_type mappedSize = size;
+
+    const bool onHugeTLBFS = (policy.hugePages == ShmPolicy::HugeTLBFSHugePages);
+
     const SDA::uint32 OPEN_FLAGS = (static_cast<SDA::uint32>(O_CREAT) | static_cast<SDA::uint32>(O_EXCL) | static_cast<SDA::uint32>(O_RDWR));
 
-    shm_fd = shm_open(name, static_cast<SDA::int32>(OPEN_FLAGS), OPEN_MODE);
+    if ((onHugeTLBFS) && (policy.hugePageSize > 0u)) {
+        //The files of a hugetlbfs can only have a size multiple of the huge page size
+        mappedSize = (((size + policy.hugePageSize) - 1u) / policy.hugePageSize) * policy.hugePageSize;
+    }
+
+    shm_fd = OpenShm(name, OPEN_FLAGS, onHugeTLBFS, policy);
     if (shm_fd == -1) {
         ok = false;
     }
@@ -81,24 +190,35 @@ void* Platform::MakeShm(const SDA::char8* const name,
 
     if (ok) {
         SDA::int32 fret;
-        fret = ftruncate(shm_fd, static_cast<off_t>(size));
+        fret = ftruncate(shm_fd, static_cast<off_t>(mappedSize));
         if (fret == -1) {
             ok = false;
         }
     }
 
     if (ok) {
-        /*lint -e{9130} the prot argument of mmap is defined as int and it can not be changed*/
-        result = mmap(SDA_NULL_PTR(void*), size, PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, static_cast<off_t>(0));
-        if (result == /*lint -e(1924) -e(923)*/MAP_FAILED) {
+        result = MapShm(shm_fd, mappedSize, policy);
+        if (result == SDA_NULL_PTR(void*)) {
             ok = false;
         }
     }
 
+    if (shm_fd != -1) {
+        //The mapping keeps the shared memory referenced
+        (void) close(shm_fd);
+    }
+
     if (ok) {
-        (void) std::memset(result, 0, size);
+        (void) std::memset(result, 0, mappedSize);
         /*lint -e{613} if ok==true, then result!=NULL*/
-        *(static_cast<SDA::size_type*>(result)) = size;
+        *(static_cast<SDA::size_type*>(result)) = mappedSize;
+    }
+    else if (shm_fd != -1) {
+        //Do not leave behind a shared memory which has not been mapped
+        (void) DestroyShm(name, policy);
+    }
+    else {
+        //Nothing to clean
     }
 
     if (!ok) {
@@ -109,18 +229,29 @@ void* Platform::MakeShm(const SDA::char8* const name,
 }
 
 void* Platform::JoinShm(const SDA::char8* const name) {
+    return JoinShm(name, ShmPolicy());
+}
+
+void* Platform::JoinShm(const SDA::char8* const name,
+                        const ShmPolicy& policy) {
 
     bool ok;
     void* result = SDA_NULL_PTR(void*);
-    void* tmp = SDA_NULL_PTR(void*);
 
     SDA::int32 shm_fd;
 
-    SDA::size_type size; //Size of allocated shared memory, including the the size value itself.
+    SDA::size_type size = 0u; //Size of allocated shared memory, including the the size value itself.
 
     const SDA::uint32 OPEN_FLAGS = (static_cast<SDA::uint32>(O_RDWR));
 
-    shm_fd = shm_open(name, static_cast<SDA::int32>(OPEN_FLAGS), OPEN_MODE);
+    ShmPolicy joinPolicy = policy;
+
+    shm_fd = OpenShm(name, OPEN_FLAGS, false, policy);
+    if (shm_fd == -1) {
+        //It may have been made on a hugetlbfs
+        shm_fd = OpenShm(name, OPEN_FLAGS, true, policy);
+        joinPolicy.hugePages = ShmPolicy::HugeTLBFSHugePages;
+    }
     if (shm_fd == -1) {
         ok = false;
     }
@@ -129,32 +260,27 @@ void* Platform::JoinShm(const SDA::char8* const name) {
     }
 
     if (ok) {
-        tmp = mmap(SDA_NULL_PTR(void*), sizeof(SDA::size_type), PROT_READ /*| PROT_WRITE*/, MAP_SHARED, shm_fd, static_cast<off_t>(0));
-        if (tmp == /*lint -e(1924) -e(923)*/MAP_FAILED) {
+        //The size is read from the file and not by mapping its first bytes,
+        //because a hugetlbfs can not partially unmap a huge page.
+        struct stat shm_stat;
+        if (fstat(shm_fd, &shm_stat) == -1) {
             ok = false;
         }
+        else {
+            size = static_cast<SDA::size_type>(shm_stat.st_size);
+            ok = (size >= sizeof(SDA::size_type));
+        }
     }
 
     if (ok) {
-        /*lint -e{613} if ok==true, then result!=NULL*/
-        size = *(static_cast<SDA::size_type*>(tmp));
-    }
-
-    if (ok) {
-        SDA::int32 fret;
-        fret = munmap(tmp, sizeof(SDA::size_type));
-        if (fret == -1) {
+        result = MapShm(shm_fd, size, joinPolicy);
+        if (result == SDA_NULL_PTR(void*)) {
             ok = false;
         }
     }
 
-    if (ok) {
-        /*lint -e{9130} the prot argument of mmap is defined as int and it can not be changed*/
-        /*lint -e{644} if ok==true, then size has been initiliased*/
-        result = mmap(SDA_NULL_PTR(void*), size, PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, static_cast<off_t>(0));
-        if (result == /*lint -e(1924) -e(923)*/MAP_FAILED) {
-            ok = false;
-        }
+    if (shm_fd != -1) {
+        (void) close(shm_fd);
     }
 
     if (!ok) {
@@ -191,4 +317,23 @@ bool Platform::DestroyShm(const SDA::char8* const name) {
     return ok;
 }
 
+bool Platform::DestroyShm(const SDA::char8* const name,
+                          const ShmPolicy& policy) {
+    bool ok;
+    if (policy.hugePages == ShmPolicy::HugeTLBFSHugePages) {
+        SDA::char8 path[PATH_MAX];
+        ok = (policy.hugeTLBFSPath != SDA_NULL_PTR(const SDA::char8*));
+        if (ok) {
+            ok = BuildHugeTLBFSPath(path, policy.hugeTLBFSPath, name);
+        }
+        if (ok) {
+            ok = (unlink(&path[0]) != -1);
+        }
+    }
+    else {
+        ok = DestroyShm(name);
+    }
+    return ok;
+}
+
 }
@@ -40,6 +40,69 @@
 
 namespace SDA {
 
+/**
+ * @brief Backing and residency policy of an interprocess shared memory.
+ * @details By default the shared memory is a POSIX shared memory object
+ * (i.e. tmpfs) with normal pages, which is neither prefaulted nor locked.
+ * For large shared memories the policy allows to reduce the TLB misses on
+ * the real-time thread:
+ * * TransparentHugePages asks the kernel (madvise) to back the tmpfs pages
+ * with transparent huge pages (only effective if
+ * /sys/kernel/mm/transparent_hugepage/shmem_enabled is advise or always).
+ * * HugeTLBFSHugePages creates the shared memory as a file on a mounted
+ * hugetlbfs (hugeTLBFSPath) with a size rounded up to hugePageSize, so
+ * that it is guaranteed to be backed by huge pages of that size.
+ * * prefault touches every page right after mapping it, and lock mlocks
+ * the mapping, so that the first cycles do not take page faults.
+ */
+struct ShmPolicy {
+
+    /**
+     * Kind of pages backing the shared memory.
+     */
+    enum HugePages {
+        NoHugePages,
+        TransparentHugePages,
+        HugeTLBFSHugePages
+    };
+
+    /**
+     * @brief Default constructor
+     * @post
+     *   hugePages == NoHugePages &&
+     *   hugeTLBFSPath == "/dev/hugepages" &&
+     *   hugePageSize == 2MB &&
+     *   !lock && !prefault
+     */
+    ShmPolicy();
+
+    /**
+     * Kind of pages backing the shared memory.
+     */
+    HugePages hugePages;
+
+    /**
+     * Mount point of the hugetlbfs. It is also where JoinShm looks for the
+     * shared memory if there is no POSIX shared memory object with its name.
+     */
+    const SDA::char8* hugeTLBFSPath;
+
+    /**
+     * Size of the huge pages of the hugetlbfs (e.g. 2MB or 1GB).
+     */
+    SDA::size_type hugePageSize;
+
+    /**
+     * Lock the mapping in memory.
+     */
+    bool lock;
+
+    /**
+     * Touch every page of the mapping after mapping it.
+     */
+    bool prefault;
+};
+
 /**
  * @brief Shared memory manager
  * @details This class is a platform specific collection of static methods for
@@ -61,6 +124,17 @@ public:
     static void* MakeShm(const SDA::char8* const name,
                          const SDA::size_type size);
 
+    /**
+     * @brief Makes an interprocess shared memory backed according to a
+     * given policy.
+     * @details As MakeShm(name, size). The size stored at the beginning of
+     * the shared memory is the size actually mapped, which may have been
+     * rounded up to the huge page size.
+     */
+    static void* MakeShm(const SDA::char8* const name,
+                         const SDA::size_type size,
+                         const ShmPolicy& policy);
+
     /**
      * @brief Joins an interprocess shared memory.
      * @details Maps an existing interprocess shared memory to the current
@@ -68,6 +142,15 @@ public:
      */
     static void* JoinShm(const SDA::char8* const name);
 
+    /**
+     * @brief Joins an interprocess shared memory, applying the residency
+     * options (prefault and lock) of a given policy.
+     * @details If there is no POSIX shared memory object with the given
+     * name, it looks for it on policy.hugeTLBFSPath.
+     */
+    static void* JoinShm(const SDA::char8* const name,
+                         const ShmPolicy& policy);
+
     /**
      * @brief Unmaps an interprocess shared memory identified by its base
      * address and a given size.
@@ -80,6 +163,13 @@ public:
      * identified by its system wide unique name.
      */
     static bool DestroyShm(const SDA::char8* const name);
+
+    /**
+     * @brief Deletes an interprocess shared memory made with a given
+     * policy from the system.
+     */
+    static bool DestroyShm(const SDA::char8* const name,
+                           const ShmPolicy& policy);
 };
 
 }
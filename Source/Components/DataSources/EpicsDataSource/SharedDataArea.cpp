@@ -96,10 +96,18 @@ void SharedDataArea::Representation::FillPreHeader(const SDA::size_type sizeOfHe
     hasReader = false;
     hasWriter = false;
     //droppedWrites = 0u; This member is currently disabled (see DroppedWrites()).
+    ringDepth = 0u;
     offsetOfHeader = 0u;
     offsetOfItems = sizeOfHeader;
 }
 
+SDA::size_type SharedDataArea::Representation::AlignedOffsetOfItems(const SDA::size_type sizeOfHeader) {
+    const SDA::size_type alignment = SDA::SigblockRing::SIGBLOCKRING_CACHE_LINE;
+    SDA::size_type end = (sizeof(SharedDataArea::Representation) + sizeOfHeader);
+    end = (((end + alignment) - 1u) / alignment) * alignment;
+    return (end - sizeof(SharedDataArea::Representation));
+}
+
 void SharedDataArea::Representation::FillHeader(const SDA::uint32 signalsCount,
                                                 const SDA::Signal::Metadata signalsMetadata[]) {
     SDA::Sigblock::Metadata* header = Header();
@@ -107,28 +115,44 @@ void SharedDataArea::Representation::FillHeader(const SDA::uint32 signalsCount,
 }
 
 void SharedDataArea::Representation::FillItems(const SDA::size_type sizeOfSigblock) {
-    SDA::SigblockDoubleBuffer* items = Items();
-    items->Init(sizeOfSigblock);
+    if (ringDepth > 0u) {
+        Ring()->Init(sizeOfSigblock, ringDepth);
+    }
+    else {
+        SDA::SigblockDoubleBuffer* items = Items();
+        items->Init(sizeOfSigblock);
+    }
 }
 
 bool SharedDataArea::BuildSharedDataAreaForMARTe(SharedDataArea& sda,
                                                  const SDA::char8* const name,
                                                  const SDA::uint32 signalsCount,
-                                                 const SDA::Signal::Metadata signalsMetadata[]) {
+                                                 const SDA::Signal::Metadata signalsMetadata[],
+                                                 const SDA::uint32 ringDepth,
+                                                 const SDA::ShmPolicy& policy) {
     bool ok;
     SDA::size_type sizeOfSigblock = CalculateSizeOfSigblock(signalsCount, signalsMetadata);
     SDA::size_type sizeOfHeader = SDA::Sigblock::Metadata::SizeOf(signalsCount);
-    SDA::size_type sizeOfItems = SDA::SigblockDoubleBuffer::SizeOf(sizeOfSigblock);
-    SDA::size_type totalSize = (sizeof(SharedDataArea::Representation) + sizeOfHeader + sizeOfItems);
+    SDA::size_type sizeOfItems;
+    SDA::size_type offsetOfItems = sizeOfHeader;
+    if (ringDepth > 0u) {
+        offsetOfItems = Representation::AlignedOffsetOfItems(sizeOfHeader);
+        sizeOfItems = SDA::SigblockRing::SizeOf(sizeOfSigblock, ringDepth);
+    }
+    else {
+        sizeOfItems = SDA::SigblockDoubleBuffer::SizeOf(sizeOfSigblock);
+    }
+    SDA::size_type totalSize = (sizeof(SharedDataArea::Representation) + offsetOfItems + sizeOfItems);
     Representation* tmp_shm_ptr = SDA_NULL_PTR(Representation*);
 
-    void* raw_shm_ptr = SDA::Platform::MakeShm(name, totalSize);
+    void* raw_shm_ptr = SDA::Platform::MakeShm(name, totalSize, policy);
     if (raw_shm_ptr == SDA_NULL_PTR(void*)) {
         ok = false;
     }
     else {
         tmp_shm_ptr = static_cast<SharedDataArea::Representation*>(raw_shm_ptr);
-        tmp_shm_ptr->FillPreHeader(sizeOfHeader);
+        tmp_shm_ptr->FillPreHeader(offsetOfItems);
+        tmp_shm_ptr->ringDepth = ringDepth;
         tmp_shm_ptr->FillHeader(signalsCount, signalsMetadata);
         tmp_shm_ptr->FillItems(sizeOfSigblock);
         sda.shm = tmp_shm_ptr;
@@ -137,11 +161,13 @@ bool SharedDataArea::BuildSharedDataAreaForMARTe(SharedDataArea& sda,
     return ok;
 }
 
-bool SharedDataArea::BuildSharedDataAreaForEPICS(SharedDataArea& sda, const SDA::char8* const name) {
+bool SharedDataArea::BuildSharedDataAreaForEPICS(SharedDataArea& sda,
+                                                 const SDA::char8* const name,
+                                                 const SDA::ShmPolicy& policy) {
     bool ok;
     void* raw_shm_ptr;
     Representation* tmp_shm_ptr = SDA_NULL_PTR(Representation*);
-    raw_shm_ptr = SDA::Platform::JoinShm(name);
+    raw_shm_ptr = SDA::Platform::JoinShm(name, policy);
     if (raw_shm_ptr == SDA_NULL_PTR(void*)) {
         ok = false;
     }
@@ -159,7 +185,12 @@ bool SharedDataArea::BuildSharedDataAreaForEPICS(SharedDataArea& sda, const SDA:
 bool SharedDataArea::SigblockConsumer::ReadSigblock(SDA::Sigblock& sb) {
     bool fret = true;
     if (IsOperational()) {
-        fret = Items()->Get(sb);
+        if (ringDepth > 0u) {
+            fret = Ring()->Get(sb);
+        }
+        else {
+            fret = Items()->Get(sb);
+        }
     }
     else {
         fret = false;
@@ -167,6 +198,38 @@ bool SharedDataArea::SigblockConsumer::ReadSigblock(SDA::Sigblock& sb) {
     return fret;
 }
 
+bool SharedDataArea::SigblockConsumer::ReadLatestSigblock(SDA::Sigblock& sb) {
+    bool fret = true;
+    if (IsOperational()) {
+        if (ringDepth > 0u) {
+            fret = Ring()->GetLatest(sb);
+        }
+        else {
+            fret = Items()->Get(sb);
+        }
+    }
+    else {
+        fret = false;
+    }
+    return fret;
+}
+
+SDA::uint32 SharedDataArea::SigblockConsumer::GetSkipped() {
+    SDA::uint32 skipped = 0u;
+    if (ringDepth > 0u) {
+        skipped = Ring()->GetSkipped();
+    }
+    return skipped;
+}
+
+SDA::uint32 SharedDataArea::SigblockConsumer::GetOverruns() {
+    SDA::uint32 overruns = 0u;
+    if (ringDepth > 0u) {
+        overruns = Ring()->GetOverruns();
+    }
+    return overruns;
+}
+
 SDA::Sigblock::Metadata* SharedDataArea::SigblockConsumer::GetSigblockMetadata() {
     return Header();
 }
@@ -174,7 +237,12 @@ SDA::Sigblock::Metadata* SharedDataArea::SigblockConsumer::GetSigblockMetadata()
 bool SharedDataArea::SigblockProducer::WriteSigblock(const SDA::Sigblock& sb) {
     bool fret = true;
     if (IsOperational()) {
-        fret = Items()->Put(sb);
+        if (ringDepth > 0u) {
+            fret = Ring()->Put(sb);
+        }
+        else {
+            fret = Items()->Put(sb);
+        }
         //if (!fret) {
         //    droppedWrites++; This member is currently disabled (see DroppedWrites()).
         //}
@@ -189,6 +257,14 @@ SDA::Sigblock::Metadata* SharedDataArea::SigblockProducer::GetSigblockMetadata()
     return Header();
 }
 
+SDA::uint32 SharedDataArea::SigblockProducer::GetOverruns() {
+    SDA::uint32 overruns = 0u;
+    if (ringDepth > 0u) {
+        overruns = Ring()->GetOverruns();
+    }
+    return overruns;
+}
+
 //This member function is currently disabled (see DroppedWrites() documentation).
 //SDA::uint64 SharedDataArea::SigblockProducer::DroppedWrites() const {
 //    return SharedDataArea::Representation::droppedWrites;
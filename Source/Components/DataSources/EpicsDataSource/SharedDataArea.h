@@ -32,9 +32,11 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "Platform.h"
 #include "Signal.h"
 #include "Sigblock.h"
 #include "SigblockDoubleBuffer.h"
+#include "SigblockRing.h"
 #include "Types.h"
 
 /*---------------------------------------------------------------------------*/
@@ -53,6 +55,13 @@ namespace SDA {
  * enough maintaining a double buffer, as long as it assures that the consumer
  * always gets the fresher sigblock put by the producer.
  *
+ * Optionally (ringDepth > 0 in BuildSharedDataAreaForMARTe), the double
+ * buffer is replaced by a SigblockRing of ringDepth sigblocks, so that a
+ * consumer which is temporarily slower than the producer does not lose any
+ * sigblock. With the ring, the consumer can choose between reading every
+ * sigblock (ReadSigblock) or only the freshest one (ReadLatestSigblock), and
+ * both sides can query the overrun and skipped counters.
+ *
  * @warning If this class is going to be used by two different applications,
  * then both shall be compiled with the same compiler and version, otherwise
  * bugs could show up at run time (mainly those related to padding between
@@ -120,6 +129,10 @@ private:
          * @brief Gets a typed pointer to items.
          */
         SDA::SigblockDoubleBuffer* Items();
+        /**
+         * @brief Gets a typed pointer to items, when they are a ring.
+         */
+        SDA::SigblockRing* Ring();
         /**
          * @brief Queries if the shared data area is operational,
          * i.e. if it has a reader and a writer.
@@ -138,6 +151,12 @@ private:
          * @brief Initialises the items area's attributes.
          */
         void FillItems(const SDA::size_type sizeOfSigblock);
+        /**
+         * @brief Gets the offset of the items area so that the ring's
+         * slots are aligned to a cache line (the shared memory is page
+         * aligned).
+         */
+        static SDA::size_type AlignedOffsetOfItems(const SDA::size_type sizeOfHeader);
         /**
          * Flag for marking if the shared data area has a reader linked to it.
          */
@@ -151,6 +170,10 @@ private:
          * @remark This member is currently disabled (see DroppedWrites()).
          */
         //SDA::uint64 droppedWrites;
+        /**
+         * Number of slots of the ring (0 if the items area is a double buffer).
+         */
+        SDA::uint32 ringDepth;
         /**
          * Offset of the header area (beginning from rawmem's base address).
          */
@@ -186,6 +209,28 @@ public:
          */
         bool ReadSigblock(SDA::Sigblock& sb);
 
+        /**
+         * @brief Reads the freshest sigblock from the shared data area,
+         * discarding the older ones (same as ReadSigblock if the shared
+         * data area is not a ring).
+         * @param[out] sb The sigblock holder where the signals from the
+         * shared data area must be written.
+         */
+        bool ReadLatestSigblock(SDA::Sigblock& sb);
+
+        /**
+         * @brief Gets the number of sigblocks discarded by
+         * ReadLatestSigblock (always 0 if the shared data area is not a
+         * ring).
+         */
+        SDA::uint32 GetSkipped();
+
+        /**
+         * @brief Gets the number of sigblocks lost because the ring was
+         * full (always 0 if the shared data area is not a ring).
+         */
+        SDA::uint32 GetOverruns();
+
         /**
          * @brief Gets a pointer to sigblock's metadata.
          */
@@ -216,6 +261,12 @@ public:
          */
         bool WriteSigblock(const SDA::Sigblock& sb);
 
+        /**
+         * @brief Gets the number of sigblocks lost because the ring was
+         * full (always 0 if the shared data area is not a ring).
+         */
+        SDA::uint32 GetOverruns();
+
         /**
          * @brief Gets a pointer to sigblock's metadata.
          */
@@ -271,6 +322,10 @@ public:
      * @param[in] name The name of the interprocess shared memory.
      * @param[in] signalsCount The number of signals expected.
      * @param[in] signalsMetadata[] The metadata for each expected signal.
+     * @param[in] ringDepth The number of sigblocks of the ring or 0 for a
+     * double buffer.
+     * @param[in] policy The backing (huge pages) and residency (prefault,
+     * lock) of the interprocess shared memory.
      * @pre An interprocess shared memory identified by the name parameter
      * must not exist.
      * @post The returned SharedDataArea points to a new interprocess shared
@@ -280,7 +335,9 @@ public:
     static bool BuildSharedDataAreaForMARTe(SharedDataArea& sda,
                                             const SDA::char8* const name,
                                             const SDA::uint32 signalsCount,
-                                            const SDA::Signal::Metadata signalsMetadata[]);
+                                            const SDA::Signal::Metadata signalsMetadata[],
+                                            const SDA::uint32 ringDepth = 0u,
+                                            const SDA::ShmPolicy& policy = SDA::ShmPolicy());
 
     /**
      * @brief This static method joins an existent interprocess shared memory
@@ -291,6 +348,8 @@ public:
      * SharedDataArea, but it maps it to the interprocess shared memory.
      * @param[in] sda The SharedDataArea.
      * @param[in] name The name of the interprocess shared memory.
+     * @param[in] policy The residency (prefault, lock) of the interprocess
+     * shared memory on this process (see Platform::JoinShm).
      * @pre An interprocess shared memory identified by the name parameter
      * must exist and must conform to the representation expected by a
      * SharedDataArea object.
@@ -299,7 +358,8 @@ public:
      * to the representation expected by a SharedDataArea object.
      */
     static bool BuildSharedDataAreaForEPICS(SharedDataArea& sda,
-                                            const SDA::char8* const name);
+                                            const SDA::char8* const name,
+                                            const SDA::ShmPolicy& policy = SDA::ShmPolicy());
 
 private:
 
@@ -339,6 +399,11 @@ inline SDA::SigblockDoubleBuffer* SharedDataArea::Representation::Items() {
     return reinterpret_cast<SDA::SigblockDoubleBuffer*>(RawItems());
 }
 
+inline SDA::SigblockRing* SharedDataArea::Representation::Ring() {
+    /*lint -e{927} -e{826} [MISRA C++ Rule 5-2-7] cast from pointer to pointer needed in this case*/
+    return reinterpret_cast<SDA::SigblockRing*>(RawItems());
+}
+
 inline bool SharedDataArea::Representation::IsOperational() const {
     return (hasReader && hasWriter);
 }
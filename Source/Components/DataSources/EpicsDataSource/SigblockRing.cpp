@@ -0,0 +1,141 @@
+/**
+ * @file SigblockRing.cpp
+ * @brief Source file for class SigblockRing
+ * @date 15/10/2026
+ * @author Ivan Herrero Molina
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SigblockRing (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <cstring>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "SigblockRing.h"
+#include "Atomic2.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace SDA {
+
+void SigblockRing::Init(const SDA::size_type sigblockSize,
+                        const SDA::uint32 ringDepth) {
+    this->sizeOfSigblock = sigblockSize;
+    sizeOfSlot = SizeOfSlot(sigblockSize);
+    depth = ringDepth;
+    writeIndex = 0u;
+    overruns = 0u;
+    readIndex = 0u;
+    skipped = 0u;
+    /*lint -e{9132} buffer is the base address of the allocated memory*/
+    (void) std::memset(buffer, 0, sizeOfSlot * ringDepth);
+}
+
+SDA::char8* SigblockRing::Slot(const SDA::uint32 index) {
+    return &(buffer[sizeOfSlot * (index % depth)]);
+}
+
+bool SigblockRing::Get(SDA::Sigblock& item) {
+    bool fret = true;
+    SDA::uint32 r = readIndex;
+    //READ is followed by a full barrier: the slot is read after the index
+    SDA::uint32 w = READ<SDA::uint32>(&writeIndex);
+    if (w != r) {
+        (void) std::memcpy(&item, Slot(r), sizeOfSigblock);
+        //WRITE is preceded by a full barrier: the slot is released after being read
+        WRITE<SDA::uint32>(&readIndex, (r + 1u));
+    }
+    else {
+        fret = false;
+    }
+    return fret;
+}
+
+bool SigblockRing::GetLatest(SDA::Sigblock& item) {
+    bool fret = true;
+    SDA::uint32 r = readIndex;
+    SDA::uint32 w = READ<SDA::uint32>(&writeIndex);
+    if (w != r) {
+        //The slots in [r, w) cannot be overwritten until readIndex moves
+        (void) std::memcpy(&item, Slot(w - 1u), sizeOfSigblock);
+        skipped += ((w - r) - 1u);
+        WRITE<SDA::uint32>(&readIndex, w);
+    }
+    else {
+        fret = false;
+    }
+    return fret;
+}
+
+bool SigblockRing::Put(const SDA::Sigblock& item) {
+    bool fret = true;
+    SDA::uint32 w = writeIndex;
+    SDA::uint32 r = READ<SDA::uint32>(&readIndex);
+    //The indexes are free running, so the unsigned difference is the fill level even after wrapping
+    if ((w - r) < depth) {
+        (void) std::memcpy(Slot(w), &item, sizeOfSigblock);
+        WRITE<SDA::uint32>(&writeIndex, (w + 1u));
+    }
+    else {
+        overruns++;
+        fret = false;
+    }
+    return fret;
+}
+
+SDA::uint32 SigblockRing::GetOverruns() const {
+    return overruns;
+}
+
+SDA::uint32 SigblockRing::GetSkipped() const {
+    return skipped;
+}
+
+SDA::uint32 SigblockRing::GetPending() const {
+    return (writeIndex - readIndex);
+}
+
+SDA::uint32 SigblockRing::GetDepth() const {
+    return depth;
+}
+
+SDA::size_type SigblockRing::SizeOfSlot(const SDA::size_type sigblockSize) {
+    return (((sigblockSize + SIGBLOCKRING_CACHE_LINE) - 1u) / SIGBLOCKRING_CACHE_LINE) * SIGBLOCKRING_CACHE_LINE;
+}
+
+SDA::size_type SigblockRing::SizeOf(const SDA::size_type sigblockSize,
+                                    const SDA::uint32 ringDepth) {
+    return (sizeof(SigblockRing) + (SizeOfSlot(sigblockSize) * ringDepth));
+}
+
+}
@@ -0,0 +1,221 @@
+/**
+ * @file SigblockRing.h
+ * @brief Header file for class SigblockRing
+ * @date 15/10/2026
+ * @author Ivan Herrero Molina
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SigblockRing
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SIGBLOCKRING_H_
+#define SIGBLOCKRING_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "Sigblock.h"
+#include "Types.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace SDA {
+
+/**
+ * @brief Ring of sigblocks
+ *
+ * @details This class implements a fixed depth ring of sigblocks for
+ * interchange sigblocks, meant for SC/SP (single consumer and single
+ * producer) running on different threads or processes through shared
+ * memory. It is an alternative to SigblockDoubleBuffer for consumers which
+ * must not lose any sigblock (e.g. an IOC archiving every cycle).
+ *
+ * Features of the ring:
+ * * It is wait-free on reading and writing sigblocks: each side only
+ * writes its own index and reads the index of the other side.
+ * * If the ring is full, the producer does not block and does not
+ * overwrite any sigblock, it returns error and counts an overrun.
+ * * The consumer can either get the oldest sigblock (Get, "all"
+ * semantics) or the freshest one, discarding the older ones (GetLatest,
+ * "latest" semantics). The discarded sigblocks are counted as skipped.
+ * * The indexes and each slot are aligned to SIGBLOCKRING_CACHE_LINE
+ * bytes (provided that the instance itself is), so that the producer and
+ * the consumer do not share cache lines except while accessing the same
+ * slot.
+ */
+class SigblockRing {
+public:
+
+    /**
+     * The alignment of the indexes and of the slots.
+     */
+    static const SDA::size_type SIGBLOCKRING_CACHE_LINE = 64u;
+
+    /**
+     * @brief Initialise the sigblock ring object.
+     * @param[in] sigblockSize The size of the sigblock
+     * @param[in] ringDepth The number of slots of the ring (> 0)
+     */
+    void Init(const SDA::size_type sigblockSize,
+              const SDA::uint32 ringDepth);
+
+    /**
+     * @brief Gets the oldest sigblock from the ring.
+     * @param[out] item The sigblock holder where the signals
+     * from the ring must be written.
+     * @return false if the ring is empty.
+     */
+    bool Get(SDA::Sigblock& item);
+
+    /**
+     * @brief Gets the freshest sigblock from the ring and discards the
+     * older ones.
+     * @param[out] item The sigblock holder where the signals
+     * from the ring must be written.
+     * @return false if the ring is empty.
+     */
+    bool GetLatest(SDA::Sigblock& item);
+
+    /**
+     * @brief Puts a sigblock into the ring.
+     * @param[in] item The sigblock container of the signals
+     * which must written to the ring.
+     * @return false (and counts an overrun) if the ring is full.
+     */
+    bool Put(const SDA::Sigblock& item);
+
+    /**
+     * @brief Gets the number of sigblocks which could not be put because
+     * the ring was full.
+     */
+    SDA::uint32 GetOverruns() const;
+
+    /**
+     * @brief Gets the number of sigblocks discarded by GetLatest.
+     */
+    SDA::uint32 GetSkipped() const;
+
+    /**
+     * @brief Gets the number of sigblocks ready to be read.
+     */
+    SDA::uint32 GetPending() const;
+
+    /**
+     * @brief Gets the number of slots of the ring.
+     */
+    SDA::uint32 GetDepth() const;
+
+    /**
+     * @brief Gets the size of an instance parameterised by sigblock's size
+     * and ring's depth.
+     * @param[in] sigblockSize The size of the sigblock
+     * @param[in] ringDepth The number of slots of the ring
+     */
+    static SDA::size_type SizeOf(const SDA::size_type sigblockSize,
+                                 const SDA::uint32 ringDepth);
+
+private:
+
+    /**
+     * @brief Default constructor
+     */
+    /*lint -e{1704} instances of this class are not instantiable*/
+    SigblockRing();
+
+    /**
+     * @brief Gets the address of the slot for a given index.
+     */
+    SDA::char8* Slot(const SDA::uint32 index);
+
+    /**
+     * @brief Gets the size of a slot (the sigblock's size rounded up to
+     * SIGBLOCKRING_CACHE_LINE).
+     */
+    static SDA::size_type SizeOfSlot(const SDA::size_type sigblockSize);
+
+    /*
+     * Size of the sigblock
+     */
+    SDA::size_type sizeOfSigblock;
+
+    /*
+     * Size of each slot
+     */
+    SDA::size_type sizeOfSlot;
+
+    /**
+     * Number of slots
+     */
+    SDA::uint32 depth;
+
+    /**
+     * Pads the read-only members to a cache line.
+     */
+    SDA::char8 padding0[SIGBLOCKRING_CACHE_LINE - ((2u * sizeof(SDA::size_type)) + sizeof(SDA::uint32))];
+
+    /**
+     * Number of sigblocks put since Init (only written by the producer).
+     */
+    volatile SDA::uint32 writeIndex;
+
+    /**
+     * See GetOverruns (only written by the producer).
+     */
+    SDA::uint32 overruns;
+
+    /**
+     * Pads the producer members to a cache line.
+     */
+    SDA::char8 padding1[SIGBLOCKRING_CACHE_LINE - (2u * sizeof(SDA::uint32))];
+
+    /**
+     * Number of sigblocks consumed since Init (only written by the consumer).
+     */
+    volatile SDA::uint32 readIndex;
+
+    /**
+     * See GetSkipped (only written by the consumer).
+     */
+    SDA::uint32 skipped;
+
+    /**
+     * Pads the consumer members to a cache line.
+     */
+    SDA::char8 padding2[SIGBLOCKRING_CACHE_LINE - (2u * sizeof(SDA::uint32))];
+
+    /**
+     * Memory holder for the slots
+     */
+    /*lint -e{1501} The following data member has no size because it is
+     * mapped onto a previously allocated memory, whose size is unknown
+     * at compile time.*/
+    SDA::char8 buffer[];
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SIGBLOCKRING_H_ */
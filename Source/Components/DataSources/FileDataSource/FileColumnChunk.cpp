@@ -0,0 +1,190 @@
+/**
+ * @file FileColumnChunk.cpp
+ * @brief Source file for class FileColumnChunk
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FileColumnChunk (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "FileColumnChunk.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+static const char8 FILE_CHUNK_MAGIC[8] = { 'M', 'F', 'W', 'C', 'H', 'U', 'N', 'K' };
+
+/**
+ * @brief Copies a strided sequence of samples (the compiler inlines the usual sizes).
+ */
+static void FileChunkGather(char8 * const destination,
+                            const uint32 destinationStride,
+                            const char8 * const source,
+                            const uint32 sourceStride,
+                            const uint32 sampleSize,
+                            const uint32 numberOfSamples) {
+    uint32 d = 0u;
+    uint32 s = 0u;
+    for (uint32 n = 0u; n < numberOfSamples; n++) {
+        if (sampleSize == 8u) {
+            (void) MemoryOperationsHelper::Copy(&destination[d], &source[s], 8u);
+        }
+        else if (sampleSize == 4u) {
+            (void) MemoryOperationsHelper::Copy(&destination[d], &source[s], 4u);
+        }
+        else if (sampleSize == 2u) {
+            (void) MemoryOperationsHelper::Copy(&destination[d], &source[s], 2u);
+        }
+        else if (sampleSize == 1u) {
+            destination[d] = source[s];
+        }
+        else {
+            (void) MemoryOperationsHelper::Copy(&destination[d], &source[s], sampleSize);
+        }
+        d += destinationStride;
+        s += sourceStride;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+FileColumnChunk::FileColumnChunk() {
+    numberOfSignals = 0u;
+    signalByteSizes = NULL_PTR(uint32 *);
+    rowOffsets = NULL_PTR(uint32 *);
+    rowSize = 0u;
+}
+
+FileColumnChunk::~FileColumnChunk() {
+    if (signalByteSizes != NULL_PTR(uint32 *)) {
+        delete[] signalByteSizes;
+    }
+    if (rowOffsets != NULL_PTR(uint32 *)) {
+        delete[] rowOffsets;
+    }
+}
+
+bool FileColumnChunk::SetSignals(const uint32 numberOfSignalsIn,
+                                 const uint32 * const signalByteSizesIn) {
+    bool ok = (numberOfSignalsIn > 0u) && (signalByteSizes == NULL_PTR(uint32 *));
+    if (ok) {
+        numberOfSignals = numberOfSignalsIn;
+        signalByteSizes = new uint32[numberOfSignals];
+        rowOffsets = new uint32[numberOfSignals];
+        rowSize = 0u;
+        for (uint32 n = 0u; n < numberOfSignals; n++) {
+            signalByteSizes[n] = signalByteSizesIn[n];
+            rowOffsets[n] = rowSize;
+            rowSize += signalByteSizesIn[n];
+        }
+    }
+    return ok;
+}
+
+uint32 FileColumnChunk::GetChunkSize(const uint32 numberOfCycles) const {
+    uint64 size = static_cast<uint64>(sizeof(FileChunkHeader));
+    size += static_cast<uint64>(sizeof(uint64)) * numberOfSignals;
+    size += static_cast<uint64>(rowSize) * numberOfCycles;
+    return (size < 0xFFFFFFFFu) ? static_cast<uint32>(size) : 0xFFFFFFFFu;
+}
+
+bool FileColumnChunk::Encode(const char8 * const rows,
+                             const uint32 numberOfCycles,
+                             const uint64 firstCycle,
+                             char8 * const chunk,
+                             uint32 &chunkSize) const {
+    bool ok = (numberOfSignals > 0u);
+    if (ok) {
+        chunkSize = GetChunkSize(numberOfCycles);
+        FileChunkHeader header;
+        (void) MemoryOperationsHelper::Copy(&header.magic[0], &FILE_CHUNK_MAGIC[0], static_cast<uint32>(sizeof(FILE_CHUNK_MAGIC)));
+        header.numberOfSignals = numberOfSignals;
+        header.numberOfCycles = numberOfCycles;
+        header.firstCycle = firstCycle;
+        header.chunkSize = chunkSize;
+        ok = MemoryOperationsHelper::Copy(chunk, &header, static_cast<uint32>(sizeof(FileChunkHeader)));
+        uint32 directory = static_cast<uint32>(sizeof(FileChunkHeader));
+        uint64 column = static_cast<uint64>(directory) + (static_cast<uint64>(sizeof(uint64)) * numberOfSignals);
+        /*lint -e{613} signalByteSizes and rowOffsets cannot be NULL if numberOfSignals > 0*/
+        for (uint32 n = 0u; (n < numberOfSignals) && (ok); n++) {
+            ok = MemoryOperationsHelper::Copy(&chunk[directory], &column, static_cast<uint32>(sizeof(uint64)));
+            directory += static_cast<uint32>(sizeof(uint64));
+            FileChunkGather(&chunk[column], signalByteSizes[n], &rows[rowOffsets[n]], rowSize, signalByteSizes[n], numberOfCycles);
+            column += static_cast<uint64>(signalByteSizes[n]) * numberOfCycles;
+        }
+    }
+    return ok;
+}
+
+bool FileColumnChunk::Decode(const char8 * const chunk,
+                             const uint32 size,
+                             char8 * const rows,
+                             const uint32 rowsSize,
+                             uint32 &numberOfCycles) const {
+    FileChunkHeader header;
+    bool ok = (numberOfSignals > 0u) && (size >= static_cast<uint32>(sizeof(FileChunkHeader)));
+    if (ok) {
+        ok = ReadHeader(chunk, header);
+    }
+    if (ok) {
+        ok = (header.numberOfSignals == numberOfSignals) && (header.chunkSize == size);
+    }
+    if (ok) {
+        ok = (GetChunkSize(header.numberOfCycles) == size);
+    }
+    if (ok) {
+        ok = ((static_cast<uint64>(rowSize) * header.numberOfCycles) <= rowsSize);
+    }
+    uint32 directory = static_cast<uint32>(sizeof(FileChunkHeader));
+    /*lint -e{613} signalByteSizes and rowOffsets cannot be NULL if numberOfSignals > 0*/
+    for (uint32 n = 0u; (n < numberOfSignals) && (ok); n++) {
+        uint64 column = 0u;
+        ok = MemoryOperationsHelper::Copy(&column, &chunk[directory], static_cast<uint32>(sizeof(uint64)));
+        directory += static_cast<uint32>(sizeof(uint64));
+        if (ok) {
+            ok = ((column + (static_cast<uint64>(signalByteSizes[n]) * header.numberOfCycles)) <= size);
+        }
+        if (ok) {
+            FileChunkGather(&rows[rowOffsets[n]], rowSize, &chunk[column], signalByteSizes[n], signalByteSizes[n], header.numberOfCycles);
+        }
+    }
+    numberOfCycles = ok ? header.numberOfCycles : 0u;
+    return ok;
+}
+
+bool FileColumnChunk::ReadHeader(const char8 * const chunk,
+                                 FileChunkHeader &header) {
+    bool ok = MemoryOperationsHelper::Copy(&header, chunk, static_cast<uint32>(sizeof(FileChunkHeader)));
+    if (ok) {
+        ok = (MemoryOperationsHelper::Compare(&header.magic[0], &FILE_CHUNK_MAGIC[0], static_cast<uint32>(sizeof(FILE_CHUNK_MAGIC))) == 0);
+    }
+    return ok;
+}
+
+}
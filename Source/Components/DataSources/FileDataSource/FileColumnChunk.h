@@ -0,0 +1,161 @@
+/**
+ * @file FileColumnChunk.h
+ * @brief Header file for class FileColumnChunk
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FileColumnChunk
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef FILEDATASOURCE_FILECOLUMNCHUNK_H_
+#define FILEDATASOURCE_FILECOLUMNCHUNK_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief The header of a columnar chunk (stored with the native endianness, as the binary file header).
+ */
+struct FileChunkHeader {
+    /**
+     * The characters MFWCHUNK (not terminated).
+     */
+    char8 magic[8];
+
+    /**
+     * The number of signals (i.e. of entries in the signal directory and of columns).
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * The number of cycles in the chunk.
+     */
+    uint32 numberOfCycles;
+
+    /**
+     * The index of the first cycle of the chunk (counted from when the file was opened).
+     */
+    uint64 firstCycle;
+
+    /**
+     * The size of the chunk, including this header and the signal directory.
+     */
+    uint64 chunkSize;
+};
+
+/**
+ * @brief Converts the cycles of the FileWriter signals (one row per cycle) into columnar chunks and back.
+ * @details A chunk is a FileChunkHeader followed by the signal directory (one uint64 per signal with the offset of its column
+ * from the start of the chunk) and by the columns. The column of a signal holds the value of the signal (all its elements)
+ * for each of the numberOfCycles cycles, i.e. numberOfCycles * signal byte size contiguous bytes. The signals are in the order
+ * of the binary file header, which gives their types and number of elements.
+ */
+class FileColumnChunk {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    FileColumnChunk();
+
+    /**
+     * @brief Destructor. Frees the signal layout.
+     */
+    ~FileColumnChunk();
+
+    /**
+     * @brief Sets the layout of the rows.
+     * @param[in] numberOfSignals the number of signals.
+     * @param[in] signalByteSizes the byte size of each signal (the signals are contiguous in each row).
+     * @return true if numberOfSignals > 0 and the layout was not yet set.
+     */
+    bool SetSignals(const uint32 numberOfSignals,
+                    const uint32 * const signalByteSizes);
+
+    /**
+     * @brief Gets the size of a chunk with numberOfCycles cycles.
+     * @param[in] numberOfCycles the number of cycles.
+     * @return the size of the header, the signal directory and the columns (saturated to 0xFFFFFFFF).
+     */
+    uint32 GetChunkSize(const uint32 numberOfCycles) const;
+
+    /**
+     * @brief Converts rows into a chunk.
+     * @param[in] rows numberOfCycles rows.
+     * @param[in] numberOfCycles the number of cycles.
+     * @param[in] firstCycle the index of the first cycle.
+     * @param[out] chunk where to write the chunk (at least GetChunkSize(numberOfCycles) bytes).
+     * @param[out] chunkSize the number of bytes of the chunk.
+     * @return true if the layout was set.
+     */
+    bool Encode(const char8 * const rows,
+                const uint32 numberOfCycles,
+                const uint64 firstCycle,
+                char8 * const chunk,
+                uint32 &chunkSize) const;
+
+    /**
+     * @brief Converts a chunk into rows.
+     * @param[in] chunk the chunk.
+     * @param[in] size the number of bytes of the chunk.
+     * @param[out] rows where to write the rows.
+     * @param[in] rowsSize the size of rows.
+     * @param[out] numberOfCycles the number of cycles decoded.
+     * @return true if the chunk is consistent with the layout and its rows fit in rowsSize.
+     */
+    bool Decode(const char8 * const chunk,
+                const uint32 size,
+                char8 * const rows,
+                const uint32 rowsSize,
+                uint32 &numberOfCycles) const;
+
+    /**
+     * @brief Reads the header of a chunk.
+     * @param[in] chunk at least sizeof(FileChunkHeader) bytes.
+     * @param[out] header the header.
+     * @return true if the chunk starts with the chunk magic.
+     */
+    static bool ReadHeader(const char8 * const chunk,
+                           FileChunkHeader &header);
+
+private:
+
+    /**
+     * The number of signals, their byte sizes and offsets in the row and the size of the row.
+     */
+    uint32 numberOfSignals;
+    uint32 *signalByteSizes;
+    uint32 *rowOffsets;
+    uint32 rowSize;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FILEDATASOURCE_FILECOLUMNCHUNK_H_ */
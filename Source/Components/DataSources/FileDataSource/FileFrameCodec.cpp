@@ -0,0 +1,387 @@
+/**
+ * @file FileFrameCodec.cpp
+ * @brief Source file for class FileFrameCodec
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FileFrameCodec (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#ifdef FILEDATASOURCE_ZSTD
+#include <zstd.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "FileFrameCodec.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+static const char8 FILE_FRAME_MAGIC[8] = { 'M', 'F', 'W', 'F', 'R', 'A', 'M', 'E' };
+
+/**
+ * LZ4 block format constants: minimum match length, number of bytes which are always literals at the end of the block,
+ * minimum distance between the start of the last match and the end of the block and maximum match offset.
+ */
+static const uint32 LZ4_MIN_MATCH = 4u;
+static const uint32 LZ4_LAST_LITERALS = 5u;
+static const uint32 LZ4_MATCH_FIND_LIMIT = 12u;
+static const uint32 LZ4_MAX_OFFSET = 65535u;
+
+/**
+ * Number of bits of the hash of the 4 byte sequences (i.e. 16 KB of hash table).
+ */
+static const uint32 LZ4_HASH_BITS = 12u;
+
+static uint32 LZ4Read32(const uint8 * const source) {
+    uint32 value = 0u;
+    (void) MemoryOperationsHelper::Copy(&value, source, 4u);
+    return value;
+}
+
+static uint32 LZ4Hash(const uint32 sequence) {
+    return (sequence * 2654435761u) >> (32u - LZ4_HASH_BITS);
+}
+
+/**
+ * @brief Writes a length larger than 14 as a sequence of 255 bytes terminated by a byte < 255.
+ * @return the number of bytes written.
+ */
+static uint32 LZ4WriteLength(uint32 length,
+                             uint8 * const out) {
+    uint32 n = 0u;
+    length -= 15u;
+    while (length >= 255u) {
+        out[n] = 255u;
+        n++;
+        length -= 255u;
+    }
+    out[n] = static_cast<uint8>(length);
+    n++;
+    return n;
+}
+
+/**
+ * @brief Writes a sequence (token, literals and, if matchLength > 0, the match offset and length).
+ * @return the number of bytes written.
+ */
+static uint32 LZ4WriteSequence(const uint8 * const literals,
+                               const uint32 literalLength,
+                               const uint32 offset,
+                               const uint32 matchLength,
+                               uint8 * const out) {
+    uint32 n = 1u;
+    uint8 token = static_cast<uint8>(((literalLength < 15u) ? literalLength : 15u) << 4u);
+    if (literalLength >= 15u) {
+        n += LZ4WriteLength(literalLength, &out[n]);
+    }
+    (void) MemoryOperationsHelper::Copy(&out[n], literals, literalLength);
+    n += literalLength;
+    if (matchLength > 0u) {
+        uint32 length = matchLength - LZ4_MIN_MATCH;
+        token |= static_cast<uint8>((length < 15u) ? length : 15u);
+        out[n] = static_cast<uint8>(offset & 0xFFu);
+        out[n + 1u] = static_cast<uint8>(offset >> 8u);
+        n += 2u;
+        if (length >= 15u) {
+            n += LZ4WriteLength(length, &out[n]);
+        }
+    }
+    out[0] = token;
+    return n;
+}
+
+/**
+ * @brief Reads the extension bytes of a length.
+ * @return false if the source ends before the length or if the length is larger than maxLength.
+ */
+static bool LZ4ReadLength(const uint8 * const source,
+                          const uint32 sourceSize,
+                          uint32 &idx,
+                          uint32 &length,
+                          const uint32 maxLength) {
+    bool ok = true;
+    bool more = true;
+    while ((ok) && (more)) {
+        ok = (idx < sourceSize);
+        if (ok) {
+            uint8 b = source[idx];
+            idx++;
+            length += b;
+            more = (b == 255u);
+            ok = (length <= maxLength);
+        }
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+FileFrameCodec::FileFrameCodec() {
+    codec = FILE_FRAME_CODEC_NONE;
+    level = 3;
+    hashTable = NULL_PTR(uint32 *);
+}
+
+FileFrameCodec::~FileFrameCodec() {
+    if (hashTable != NULL_PTR(uint32 *)) {
+        delete[] hashTable;
+    }
+}
+
+bool FileFrameCodec::SetCodec(const char8 * const name,
+                              const int32 levelIn) {
+    bool ok = true;
+    level = levelIn;
+    if (StringHelper::Compare(name, "none") == 0) {
+        codec = FILE_FRAME_CODEC_NONE;
+    }
+    else if (StringHelper::Compare(name, "lz4") == 0) {
+        codec = FILE_FRAME_CODEC_LZ4;
+        if (hashTable == NULL_PTR(uint32 *)) {
+            hashTable = new uint32[1u << LZ4_HASH_BITS];
+        }
+    }
+    else if (StringHelper::Compare(name, "zstd") == 0) {
+#ifdef FILEDATASOURCE_ZSTD
+        codec = FILE_FRAME_CODEC_ZSTD;
+#else
+        ok = false;
+#endif
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+
+uint32 FileFrameCodec::GetCodec() const {
+    return codec;
+}
+
+uint32 FileFrameCodec::GetMaxFrameSize(const uint32 uncompressedSize) const {
+    uint64 bound = static_cast<uint64>(uncompressedSize) + (uncompressedSize / 255u) + 16u;
+#ifdef FILEDATASOURCE_ZSTD
+    if (codec == FILE_FRAME_CODEC_ZSTD) {
+        bound = static_cast<uint64>(ZSTD_compressBound(static_cast<size_t>(uncompressedSize)));
+    }
+#endif
+    bound += sizeof(FileFrameHeader);
+    return (bound < 0xFFFFFFFFu) ? static_cast<uint32>(bound) : 0xFFFFFFFFu;
+}
+
+bool FileFrameCodec::Encode(const char8 * const source,
+                            const uint32 size,
+                            const uint64 firstCycle,
+                            const uint32 numberOfCycles,
+                            char8 * const frame,
+                            uint32 &frameSize) {
+    FileFrameHeader header;
+    (void) MemoryOperationsHelper::Copy(&header.magic[0], &FILE_FRAME_MAGIC[0], sizeof(FILE_FRAME_MAGIC));
+    header.codec = codec;
+    header.compressedSize = 0u;
+    header.uncompressedSize = size;
+    header.numberOfCycles = numberOfCycles;
+    header.firstCycle = firstCycle;
+    /*lint -e{927} the payload is written as bytes*/
+    uint8 * const payload = reinterpret_cast<uint8 *>(&frame[sizeof(FileFrameHeader)]);
+    bool ok = true;
+    if (codec == FILE_FRAME_CODEC_LZ4) {
+        /*lint -e{927} the source is read as bytes*/
+        header.compressedSize = CompressLZ4(reinterpret_cast<const uint8 *>(source), size, payload);
+    }
+#ifdef FILEDATASOURCE_ZSTD
+    else if (codec == FILE_FRAME_CODEC_ZSTD) {
+        size_t capacity = static_cast<size_t>(GetMaxFrameSize(size) - sizeof(FileFrameHeader));
+        size_t ret = ZSTD_compress(payload, capacity, source, static_cast<size_t>(size), level);
+        ok = (ZSTD_isError(ret) == 0u);
+        if (ok) {
+            header.compressedSize = static_cast<uint32>(ret);
+        }
+    }
+#endif
+    else {
+        ok = false;
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(frame, &header, static_cast<uint32>(sizeof(FileFrameHeader)));
+        frameSize = static_cast<uint32>(sizeof(FileFrameHeader)) + header.compressedSize;
+    }
+    return ok;
+}
+
+bool FileFrameCodec::HasMagic(const FileFrameHeader &header) {
+    return (MemoryOperationsHelper::Compare(&header.magic[0], &FILE_FRAME_MAGIC[0], static_cast<uint32>(sizeof(FILE_FRAME_MAGIC))) == 0);
+}
+
+bool FileFrameCodec::IsValidHeader(const FileFrameHeader &header) {
+    bool ok = HasMagic(header);
+    if (ok) {
+        ok = (header.codec == FILE_FRAME_CODEC_LZ4);
+#ifdef FILEDATASOURCE_ZSTD
+        ok = (ok) || (header.codec == FILE_FRAME_CODEC_ZSTD);
+#endif
+    }
+    return ok;
+}
+
+bool FileFrameCodec::Decode(const FileFrameHeader &header,
+                            const char8 * const source,
+                            char8 * const destination) {
+    bool ok = IsValidHeader(header);
+    if (ok) {
+        if (header.codec == FILE_FRAME_CODEC_LZ4) {
+            /*lint -e{927} the data is decoded as bytes*/
+            ok = DecompressLZ4(reinterpret_cast<const uint8 *>(source), header.compressedSize, reinterpret_cast<uint8 *>(destination),
+                               header.uncompressedSize);
+        }
+#ifdef FILEDATASOURCE_ZSTD
+        else {
+            size_t ret = ZSTD_decompress(destination, static_cast<size_t>(header.uncompressedSize), source, static_cast<size_t>(header.compressedSize));
+            ok = (ZSTD_isError(ret) == 0u);
+            if (ok) {
+                ok = (ret == static_cast<size_t>(header.uncompressedSize));
+            }
+        }
+#endif
+    }
+    return ok;
+}
+
+uint32 FileFrameCodec::CompressLZ4(const uint8 * const source,
+                                   const uint32 size,
+                                   uint8 * const destination) {
+    uint32 n = 0u;
+    uint32 anchor = 0u;
+    /*lint -e{613} hashTable is allocated when the lz4 codec is set*/
+    if (size > LZ4_MATCH_FIND_LIMIT) {
+        (void) MemoryOperationsHelper::Set(hashTable, '\0', static_cast<uint32>(sizeof(uint32) << LZ4_HASH_BITS));
+        const uint32 matchFindLimit = size - LZ4_MATCH_FIND_LIMIT;
+        const uint32 matchLimit = size - LZ4_LAST_LITERALS;
+        uint32 ip = 0u;
+        while (ip < matchFindLimit) {
+            uint32 sequence = LZ4Read32(&source[ip]);
+            uint32 hash = LZ4Hash(sequence);
+            uint32 reference = hashTable[hash];
+            hashTable[hash] = ip + 1u;
+            bool found = (reference > 0u);
+            if (found) {
+                reference--;
+                found = ((ip - reference) <= LZ4_MAX_OFFSET);
+            }
+            if (found) {
+                found = (LZ4Read32(&source[reference]) == sequence);
+            }
+            if (found) {
+                //Extend the match backwards (into the pending literals) and forwards
+                while ((ip > anchor) && (reference > 0u) && (source[ip - 1u] == source[reference - 1u])) {
+                    ip--;
+                    reference--;
+                }
+                uint32 length = LZ4_MIN_MATCH;
+                while (((ip + length) < matchLimit) && (source[ip + length] == source[reference + length])) {
+                    length++;
+                }
+                n += LZ4WriteSequence(&source[anchor], ip - anchor, ip - reference, length, &destination[n]);
+                ip += length;
+                anchor = ip;
+            }
+            else {
+                //Skip faster on data which does not compress
+                ip += 1u + ((ip - anchor) >> 6u);
+            }
+        }
+    }
+    n += LZ4WriteSequence(&source[anchor], size - anchor, 0u, 0u, &destination[n]);
+    return n;
+}
+
+bool FileFrameCodec::DecompressLZ4(const uint8 * const source,
+                                   const uint32 sourceSize,
+                                   uint8 * const destination,
+                                   const uint32 destinationSize) {
+    uint32 ip = 0u;
+    uint32 op = 0u;
+    bool ok = true;
+    bool done = false;
+    while ((ok) && (!done)) {
+        ok = (ip < sourceSize);
+        uint32 token = 0u;
+        uint32 length = 0u;
+        if (ok) {
+            token = source[ip];
+            ip++;
+            length = token >> 4u;
+            if (length == 15u) {
+                ok = LZ4ReadLength(source, sourceSize, ip, length, destinationSize);
+            }
+        }
+        if (ok) {
+            ok = (length <= (sourceSize - ip)) && (length <= (destinationSize - op));
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Copy(&destination[op], &source[ip], length);
+            ip += length;
+            op += length;
+        }
+        //The last sequence only has literals
+        done = (ip == sourceSize);
+        if ((ok) && (!done)) {
+            ok = ((sourceSize - ip) >= 2u);
+            uint32 offset = 0u;
+            if (ok) {
+                offset = static_cast<uint32>(source[ip]) | (static_cast<uint32>(source[ip + 1u]) << 8u);
+                ip += 2u;
+                ok = (offset > 0u) && (offset <= op);
+            }
+            if (ok) {
+                length = token & 0xFu;
+                if (length == 15u) {
+                    ok = LZ4ReadLength(source, sourceSize, ip, length, destinationSize);
+                }
+            }
+            if (ok) {
+                length += LZ4_MIN_MATCH;
+                ok = (length <= (destinationSize - op));
+            }
+            if (ok) {
+                //The match can overlap the bytes being written
+                for (uint32 i = 0u; i < length; i++) {
+                    destination[op] = destination[op - offset];
+                    op++;
+                }
+            }
+        }
+    }
+    if (ok) {
+        ok = (op == destinationSize);
+    }
+    return ok;
+}
+
+}
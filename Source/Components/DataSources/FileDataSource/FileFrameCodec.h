@@ -0,0 +1,205 @@
+/**
+ * @file FileFrameCodec.h
+ * @brief Header file for class FileFrameCodec
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FileFrameCodec
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef FILEDATASOURCE_FILEFRAMECODEC_H_
+#define FILEDATASOURCE_FILEFRAMECODEC_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Codec identifiers stored in the frame header.
+ */
+static const uint32 FILE_FRAME_CODEC_NONE = 0u;
+static const uint32 FILE_FRAME_CODEC_LZ4 = 1u;
+static const uint32 FILE_FRAME_CODEC_ZSTD = 2u;
+
+/**
+ * @brief The header of a compressed frame (stored with the native endianness, as the binary file header).
+ */
+struct FileFrameHeader {
+    /**
+     * The characters MFWFRAME (not terminated).
+     */
+    char8 magic[8];
+
+    /**
+     * The codec of the frame (FILE_FRAME_CODEC_LZ4 or FILE_FRAME_CODEC_ZSTD).
+     */
+    uint32 codec;
+
+    /**
+     * The number of bytes of the compressed data which follows the header.
+     */
+    uint32 compressedSize;
+
+    /**
+     * The number of bytes of the data once decompressed (the cycles, or a columnar chunk, see FileColumnChunk).
+     */
+    uint32 uncompressedSize;
+
+    /**
+     * The number of cycles in the frame.
+     */
+    uint32 numberOfCycles;
+
+    /**
+     * The index of the first cycle of the frame (counted from when the file was opened).
+     */
+    uint64 firstCycle;
+};
+
+/**
+ * @brief Compresses and decompresses the frames of the binary files written by the FileWriter with Compression != none.
+ * @details Each frame is a FileFrameHeader followed by the compressed data. The lz4 codec writes the LZ4 block format
+ * (so that the frames can also be decoded with liblz4) with a built-in single pass compressor. The zstd codec is
+ * only available if the FileDataSource was compiled with ZSTD_DIR set (which defines FILEDATASOURCE_ZSTD).
+ */
+class FileFrameCodec {
+public:
+    /**
+     * @brief Constructor. Sets the codec to FILE_FRAME_CODEC_NONE.
+     */
+    FileFrameCodec();
+
+    /**
+     * @brief Destructor. Frees the compressor memory.
+     */
+    ~FileFrameCodec();
+
+    /**
+     * @brief Sets the codec used by Encode.
+     * @param[in] name the codec name: none, lz4 or zstd.
+     * @param[in] level the compression level (only used by zstd).
+     * @return true if the codec is known and was compiled.
+     */
+    bool SetCodec(const char8 * const name,
+                  const int32 level);
+
+    /**
+     * @brief Gets the codec used by Encode.
+     * @return the codec used by Encode.
+     */
+    uint32 GetCodec() const;
+
+    /**
+     * @brief Gets the size of the largest frame which can be encoded from uncompressedSize bytes.
+     * @param[in] uncompressedSize the number of bytes to encode.
+     * @return the size of the header plus the worst case compressed size.
+     */
+    uint32 GetMaxFrameSize(const uint32 uncompressedSize) const;
+
+    /**
+     * @brief Encodes a frame.
+     * @param[in] source the data to compress.
+     * @param[in] size the number of bytes to compress.
+     * @param[in] firstCycle the index of the first cycle in the data.
+     * @param[in] numberOfCycles the number of cycles in the data.
+     * @param[out] frame where to write the frame (at least GetMaxFrameSize(size) bytes).
+     * @param[out] frameSize the number of bytes of the frame.
+     * @return true if the data was compressed.
+     */
+    bool Encode(const char8 * const source,
+                const uint32 size,
+                const uint64 firstCycle,
+                const uint32 numberOfCycles,
+                char8 * const frame,
+                uint32 &frameSize);
+
+    /**
+     * @brief Checks the magic of a frame header.
+     * @param[in] header the header to check.
+     * @return true if the header starts with the frame magic.
+     */
+    static bool HasMagic(const FileFrameHeader &header);
+
+    /**
+     * @brief Checks the magic and the codec of a frame header.
+     * @param[in] header the header to check.
+     * @return true if the header is valid and its codec was compiled.
+     */
+    static bool IsValidHeader(const FileFrameHeader &header);
+
+    /**
+     * @brief Decompresses the data of a frame.
+     * @param[in] header the header of the frame.
+     * @param[in] source the compressed data (header.compressedSize bytes).
+     * @param[out] destination where to write the decompressed data (header.uncompressedSize bytes).
+     * @return true if the data was decompressed to exactly header.uncompressedSize bytes.
+     */
+    static bool Decode(const FileFrameHeader &header,
+                       const char8 * const source,
+                       char8 * const destination);
+
+private:
+
+    /**
+     * @brief Compresses with the LZ4 block format.
+     * @return the number of bytes written.
+     */
+    uint32 CompressLZ4(const uint8 * const source,
+                       const uint32 size,
+                       uint8 * const destination);
+
+    /**
+     * @brief Decompresses the LZ4 block format (checking all the bounds).
+     * @return true if exactly destinationSize bytes were decoded.
+     */
+    static bool DecompressLZ4(const uint8 * const source,
+                              const uint32 sourceSize,
+                              uint8 * const destination,
+                              const uint32 destinationSize);
+
+    /**
+     * The codec used by Encode.
+     */
+    uint32 codec;
+
+    /**
+     * The zstd compression level.
+     */
+    int32 level;
+
+    /**
+     * The LZ4 hash table (position + 1 of the last occurrence of each hashed 4 byte sequence).
+     */
+    uint32 *hashTable;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FILEDATASOURCE_FILEFRAMECODEC_H_ */
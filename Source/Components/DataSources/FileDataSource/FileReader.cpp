@@ -24,11 +24,16 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "CLASSMETHODREGISTER.h"
 #include "Directory.h"
 #include "FileReader.h"
@@ -45,10 +50,150 @@
 namespace MARTe {
 static const int32 FILE_FORMAT_BINARY = 1;
 static const int32 FILE_FORMAT_CSV = 2;
+static const uint32 PREFETCH_WAIT_TIMEOUT_MSEC = 200u;
+
+/**
+ * @brief Reallocates the buffer (discarding its content) if it is smaller than size.
+ */
+static void FileReaderReserve(char8 *&buffer,
+                              uint32 &bufferSize,
+                              const uint32 size) {
+    if (size > bufferSize) {
+        if (buffer != NULL_PTR(char8*)) {
+            delete[] buffer;
+        }
+        bufferSize = size;
+        buffer = new char8[bufferSize];
+    }
+}
+
+/**
+ * The identifier of the csv sidecar files.
+ */
+static const char8 * const FILE_READER_CSV_CACHE_MAGIC = "MFRCACHE";
+
+/**
+ * @brief The header of the csv sidecar file, followed by the decoded data.
+ */
+struct FileReaderCSVCacheHeader {
+    /**
+     * FILE_READER_CSV_CACHE_MAGIC.
+     */
+    char8 magic[8];
+    /**
+     * The size and modification time (in nanoseconds) of the csv file which was decoded.
+     */
+    uint64 csvSize;
+    uint64 csvModificationTime;
+    /**
+     * The number of bytes of decoded data.
+     */
+    uint64 dataSize;
+    /**
+     * The number of bytes of each cycle and the number of signals.
+     */
+    uint32 numberOfBinaryBytes;
+    uint32 numberOfSignals;
+};
+
+/**
+ * @brief Gets the size and the modification time (in nanoseconds) of a file.
+ * @return true if the file exists.
+ */
+static bool FileReaderStat(const char8 * const fileName,
+                           uint64 &size,
+                           uint64 &modificationTime) {
+    struct stat fileStat;
+    bool ok = (stat(fileName, &fileStat) == 0);
+    if (ok) {
+        size = static_cast<uint64>(fileStat.st_size);
+        modificationTime = (static_cast<uint64>(fileStat.st_mtim.tv_sec) * 1000000000u) + static_cast<uint64>(fileStat.st_mtim.tv_nsec);
+    }
+    return ok;
+}
+
+/**
+ * The identifier of the seek index sidecar files.
+ */
+static const char8 * const FILE_READER_SEEK_INDEX_MAGIC = "MFRSEEK";
+
+/**
+ * @brief The header of the seek index sidecar file, followed by the index entries.
+ */
+struct FileReaderSeekIndexHeader {
+    /**
+     * FILE_READER_SEEK_INDEX_MAGIC.
+     */
+    char8 magic[8];
+    /**
+     * The size and modification time (in nanoseconds) of the file which was indexed.
+     */
+    uint64 fileSize;
+    uint64 fileModificationTime;
+    /**
+     * The number of cycles in the file and the offset of the first cycle (0 if the file is read into memory).
+     */
+    uint64 numberOfCycles;
+    uint64 dataStart;
+    /**
+     * The number of cycles between entries, the index of the XAxisSignal, the number of entries and the number of bytes of each cycle.
+     */
+    uint32 seekIndexStep;
+    uint32 xAxisSignalIdx;
+    uint32 numberOfEntries;
+    uint32 numberOfBinaryBytes;
+};
+
+/**
+ * @brief Converts the value of an XAxisSignal to uint64.
+ * @param[in] type the type of the signal.
+ * @param[in] value pointer to the value.
+ * @return the converted value (0 if the type is not supported).
+ */
+static uint64 FileReaderToUInt64(const TypeDescriptor &type,
+                                 const void * const value) {
+    uint64 converted = 0u;
+    if (type == UnsignedInteger8Bit) {
+        converted = static_cast<uint64>(*reinterpret_cast<const uint8*>(value));
+    }
+    else if (type == SignedInteger8Bit) {
+        converted = static_cast<uint64>(*reinterpret_cast<const int8*>(value));
+    }
+    else if (type == UnsignedInteger16Bit) {
+        converted = static_cast<uint64>(*reinterpret_cast<const uint16*>(value));
+    }
+    else if (type == SignedInteger16Bit) {
+        converted = static_cast<uint64>(*reinterpret_cast<const int16*>(value));
+    }
+    else if (type == UnsignedInteger32Bit) {
+        converted = static_cast<uint64>(*reinterpret_cast<const uint32*>(value));
+    }
+    else if (type == SignedInteger32Bit) {
+        converted = static_cast<uint64>(*reinterpret_cast<const int32*>(value));
+    }
+    else if (type == UnsignedInteger64Bit) {
+        converted = *reinterpret_cast<const uint64*>(value);
+    }
+    else if (type == SignedInteger64Bit) {
+        converted = static_cast<uint64>(*reinterpret_cast<const int64*>(value));
+    }
+    else if (type == Float32Bit) {
+        converted = static_cast<uint64>(*reinterpret_cast<const float32*>(value));
+    }
+    else if (type == Float64Bit) {
+        converted = static_cast<uint64>(*reinterpret_cast<const float64*>(value));
+    }
+    else {
+        //Unreachable...
+    }
+    return converted;
+}
 
 FileReader::FileReader() :
         DataSourceI(),
-        MessageI() {
+        MessageI(),
+        EmbeddedServiceMethodBinderI(),
+        prefetchExecutor(*this) {
     dataSourceMemory = NULL_PTR(char8*);
     offsets = NULL_PTR(uint32*);
     numberOfBinaryBytes = 0u;
@@ -61,8 +206,9 @@ FileReader::FileReader() :
     filename = "";
     fatalFileError = false;
     interpolate = false;
-    interpolatedInputBroker = NULL_PTR(MemoryMapInterpolatedInputBroker*);
-    signalsAnyType = NULL_PTR(AnyType*);
+    interpolatedInputBroker = NULL_PTR(FileReaderInterpolatedInputBroker*);
+    csvBufferSize = 1048576u;
+    csvCache = false;
     filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -74,22 +220,108 @@ FileReader::FileReader() :
     allData.interalBufferIdx = 0u;
     allData.internalBuffer = NULL_PTR(char8*);
     allData.maxDataFileByteSize = 0u;
+    compressed = false;
+    frameCompressed = NULL_PTR(char8*);
+    frameCompressedSize = 0u;
+    frameData = NULL_PTR(char8*);
+    frameDataSize = 0u;
+    frameBytes = 0u;
+    frameIdx = 0u;
+    columnar = false;
+    frameChunk = NULL_PTR(char8*);
+    frameChunkSize = 0u;
+    memoryMap = false;
+    readAheadSize = 16777216u;
+    lockReadAhead = false;
+    mapBase = NULL_PTR(char8*);
+    mapSize = 0u;
+    mapDataStart = 0u;
+    readAheadStep = 0u;
+    readAheadStart = 0u;
+    readAheadEnd = 0u;
+    prefetchCycles = 0u;
+    numberOfPrefetchBuffers = 2u;
+    cpuMask = ProcessorType(0xFFu);
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+    prefetchBuffers = NULL_PTR(char8**);
+    prefetchBytes = NULL_PTR(uint32*);
+    prefetchBufferSize = 0u;
+    prefetchReady = 0;
+    prefetchEnd = false;
+    prefetchFillIndex = 0u;
+    prefetchReadIndex = 0u;
+    prefetchReadOffset = 0u;
+    prefetchDataStart = 0u;
+    numberOfPrefetchStalls = 0u;
+    seekIndexStep = 0u;
+    seekIndexCache = false;
+    seekIndex = NULL_PTR(SeekIndexEntry*);
+    seekIndexSize = 0u;
+    seekNumberOfCycles = 0u;
+    seekDataStart = 0u;
+    seekRequested = false;
+    seekRequestIsTime = false;
+    seekRequestValue = 0u;
+    lastSeekCycle = 0u;
+    if (!seekMutex.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create the FastPollingMutexSem");
+    }
+    if (!prefetchReadySem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create the EventSem");
+    }
+    if (!prefetchFreeSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create the EventSem");
+    }
 }
 
 /*lint -e{1551} -e{1579} the destructor must guarantee that the memory is freed and the file is flushed and closed.. The brokerAsyncTrigger is freed by the ReferenceT */
 FileReader::~FileReader() {
+    if (prefetchExecutor.GetStatus() != EmbeddedThreadI::OffState) {
+        if (!prefetchExecutor.Stop()) {
+            if (!prefetchExecutor.Stop()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the prefetch thread");
+            }
+        }
+    }
+    if (prefetchBuffers != NULL_PTR(char8**)) {
+        for (uint32 i = 0u; i < numberOfPrefetchBuffers; i++) {
+            if (prefetchBuffers[i] != NULL_PTR(char8*)) {
+                delete[] prefetchBuffers[i];
+            }
+        }
+        delete[] prefetchBuffers;
+    }
+    if (prefetchBytes != NULL_PTR(uint32*)) {
+        delete[] prefetchBytes;
+    }
     if (dataSourceMemory != NULL_PTR(char8*)) {
         GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(dataSourceMemory));
     }
     if (offsets != NULL_PTR(uint32*)) {
         delete[] offsets;
     }
-    if (signalsAnyType != NULL_PTR(AnyType*)) {
-        delete[] signalsAnyType;
+    if (mapBase != NULL_PTR(char8*)) {
+        //The allData.internalBuffer points into the mapping
+        (void) munmap(mapBase, static_cast<size_t>(mapSize));
     }
-    if (allData.internalBuffer != NULL_PTR(char8*)) {
+    else if (allData.internalBuffer != NULL_PTR(char8*)) {
         GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(allData.internalBuffer));
     }
+    else {
+        //NOOP
+    }
+    if (frameCompressed != NULL_PTR(char8*)) {
+        delete[] frameCompressed;
+    }
+    if (frameData != NULL_PTR(char8*)) {
+        delete[] frameData;
+    }
+    if (frameChunk != NULL_PTR(char8*)) {
+        delete[] frameChunk;
+    }
+    if (seekIndex != NULL_PTR(SeekIndexEntry*)) {
+        delete[] seekIndex;
+    }
     (void) CloseFile();
 }
 
@@ -120,7 +352,7 @@ const char8* FileReader::GetBrokerName(StructuredDataI &data,
     const char8 *brokerName = "";
     if (direction == InputSignals) {
         if (interpolate) {
-            brokerName = "MemoryMapInterpolatedInputBroker";
+            brokerName = "FileReaderInterpolatedInputBroker";
         }
         else {
             brokerName = "MemoryMapSynchronisedInputBroker";
@@ -134,7 +366,7 @@ bool FileReader::GetInputBrokers(ReferenceContainer &inputBrokers,
                                  void *const gamMemPtr) {
     bool ok = true;
     if (interpolate) {
-        ReferenceT<MemoryMapInterpolatedInputBroker> brokerNew("MemoryMapInterpolatedInputBroker");
+        ReferenceT<FileReaderInterpolatedInputBroker> brokerNew("FileReaderInterpolatedInputBroker");
         interpolatedInputBroker = brokerNew.operator ->();
         ok = interpolatedInputBroker->Init(InputSignals, *this, functionName, gamMemPtr);
         if (ok) {
@@ -173,49 +405,25 @@ bool FileReader::GetOutputBrokers(ReferenceContainer &outputBrokers,
 
 /*lint -e{613} xAxisSignalPtr cannot be NULL as otherwise SetConfiguredDatabase would have failed.*/
 void FileReader::ConvertXAxisSignal() {
-    if (xAxisSignalType == UnsignedInteger8Bit) {
-        xAxisSignal = static_cast<uint64>(*reinterpret_cast<uint8*>(xAxisSignalPtr));
-    }
-    else if (xAxisSignalType == SignedInteger8Bit) {
-        xAxisSignal = static_cast<uint64>(*reinterpret_cast<int8*>(xAxisSignalPtr));
-    }
-    else if (xAxisSignalType == UnsignedInteger16Bit) {
-        xAxisSignal = static_cast<uint64>(*reinterpret_cast<uint16*>(xAxisSignalPtr));
-    }
-    else if (xAxisSignalType == SignedInteger16Bit) {
-        xAxisSignal = static_cast<uint64>(*reinterpret_cast<int16*>(xAxisSignalPtr));
-    }
-    else if (xAxisSignalType == UnsignedInteger32Bit) {
-        xAxisSignal = static_cast<uint64>(*reinterpret_cast<uint32*>(xAxisSignalPtr));
-    }
-    else if (xAxisSignalType == SignedInteger32Bit) {
-        xAxisSignal = static_cast<uint64>(*reinterpret_cast<int32*>(xAxisSignalPtr));
-    }
-    else if (xAxisSignalType == UnsignedInteger64Bit) {
-        xAxisSignal = *reinterpret_cast<uint64*>(xAxisSignalPtr);
-    }
-    else if (xAxisSignalType == SignedInteger64Bit) {
-        xAxisSignal = static_cast<uint64>(*reinterpret_cast<int64*>(xAxisSignalPtr));
-    }
-    else if (xAxisSignalType == Float32Bit) {
-        xAxisSignal = static_cast<uint64>(*reinterpret_cast<float32*>(xAxisSignalPtr));
-    }
-    else if (xAxisSignalType == Float64Bit) {
-        xAxisSignal = static_cast<uint64>(*reinterpret_cast<float64*>(xAxisSignalPtr));
-    }
-    else {
-        //Unreachable...
-    }
+    xAxisSignal = FileReaderToUInt64(xAxisSignalType, xAxisSignalPtr);
 }
 
 bool FileReader::Synchronise() {
     bool ok = !fatalFileError;
+    bool seekApplied = false;
+    if ((ok) && (seekRequested)) {
+        ok = ApplySeek();
+        seekApplied = ok;
+    }
     if (ok) {
         bool lockAtLast = false;
-        if (preload) {
+        if ((preload) || (memoryMap)) {
             if (allData.interalBufferIdx == allData.dataFileByteSize) {
                 if (eofBehaviour == EOFRewind) { //move to the beginning
                     allData.interalBufferIdx = 0u;
+                    if (memoryMap) {
+                        ResetReadAhead();
+                    }
                 }
                 else if (eofBehaviour == EOFLast) {
                     lockAtLast = true;
@@ -242,12 +450,27 @@ bool FileReader::Synchronise() {
                 if (!lockAtLast) {
                     ok = MemoryOperationsHelper::Copy(dataSourceMemory, &(allData.internalBuffer[allData.interalBufferIdx]), numberOfBinaryBytes);
                     allData.interalBufferIdx = allData.interalBufferIdx + numberOfBinaryBytes;
-
+                    if (memoryMap) {
+                        AdvanceReadAhead();
+                    }
                 }
             }
         }
         else {
-            if (inputFile.Position() == inputFile.Size()) {
+            bool endOfData = false;
+            if (prefetchBuffers != NULL_PTR(char8**)) {
+                ok = WaitPrefetchBuffer(endOfData);
+            }
+            else {
+                endOfData = (inputFile.Position() == inputFile.Size());
+                if ((compressed) || (columnar)) {
+                    endOfData = (endOfData) && (frameIdx == frameBytes);
+                }
+                if (fileFormat == FILE_FORMAT_CSV) {
+                    endOfData = (endOfData) && (csvDecoder.IsEmpty());
+                }
+            }
+            if (endOfData) {
                 if (eofBehaviour == EOFRewind) {
                     if (fileFormat == FILE_FORMAT_BINARY) {
                         const uint32 SIGNAL_NAME_MAX_SIZE = 32u;
@@ -260,6 +483,8 @@ bool FileReader::Synchronise() {
                         if (ok) {
                             ok = inputFile.Seek(static_cast<uint64>(headerSize));
                         }
+                        frameBytes = 0u;
+                        frameIdx = 0u;
                     }
                     else {
                         ok = inputFile.Seek(0LLU);
@@ -268,6 +493,7 @@ bool FileReader::Synchronise() {
                             //Skip the header
                             ok = inputFile.GetLine(header);
                         }
+                        csvDecoder.Reset();
                     }
                 }
                 else if (eofBehaviour == EOFLast) {
@@ -278,7 +504,13 @@ bool FileReader::Synchronise() {
                 }
             }
             if (!lockAtLast) {
-                if (fileFormat == FILE_FORMAT_BINARY) {
+                if (prefetchBuffers != NULL_PTR(char8**)) {
+                    ok = (ok) && (ReadPrefetchedCycle());
+                }
+                else if ((fileFormat == FILE_FORMAT_BINARY) && ((compressed) || (columnar))) {
+                    ok = ReadFramedCycle();
+                }
+                else if (fileFormat == FILE_FORMAT_BINARY) {
                     uint32 readSize = numberOfBinaryBytes;
                     ok = inputFile.Read(dataSourceMemory, readSize);
                     if (ok) {
@@ -307,6 +539,10 @@ bool FileReader::Synchronise() {
         if (ok) {
             if (interpolate) {
                 ConvertXAxisSignal();
+                //The interpolation restarts from the first cycle read after the seek
+                if ((seekApplied) && (interpolatedInputBroker != NULL_PTR(FileReaderInterpolatedInputBroker*))) {
+                    interpolatedInputBroker->Reset();
+                }
             }
         }
     }
@@ -345,6 +581,15 @@ bool FileReader::Initialise(StructuredDataI &data) {
             if (!ok) {
                 REPORT_ERROR(ErrorManagement::ParametersError, "FileFormat=csv and CSVSeparator was not specified");
             }
+            if (ok) {
+                if (!data.Read("CSVBufferSize", csvBufferSize)) {
+                    csvBufferSize = 1048576u;
+                }
+                ok = (csvBufferSize > 1u);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "CSVBufferSize shall be at least 2");
+                }
+            }
         }
     }
     if (ok) {
@@ -378,6 +623,66 @@ bool FileReader::Initialise(StructuredDataI &data) {
             }
         }
     }
+    if (ok) {
+        StreamString csvCacheStr;
+        if (data.Read("CSVCache", csvCacheStr)) {
+            csvCache = (csvCacheStr == "yes");
+        }
+        if (csvCache) {
+            ok = ((fileFormat == FILE_FORMAT_CSV) && (preload));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "CSVCache = yes is only supported with FileFormat = csv and Preload = yes");
+            }
+            csvCacheFilename = filename;
+            csvCacheFilename += ".cache";
+        }
+    }
+    if (ok) {
+        StreamString memoryMapStr;
+        if (data.Read("MemoryMap", memoryMapStr)) {
+            memoryMap = (memoryMapStr == "yes");
+        }
+        if (memoryMap) {
+            ok = ((fileFormat == FILE_FORMAT_BINARY) && (!preload));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "MemoryMap = yes is only supported with FileFormat = binary and Preload = no");
+            }
+            if (!data.Read("ReadAheadSize", readAheadSize)) {
+                readAheadSize = 16777216u;
+            }
+            uint8 lockReadAheadU = 0u;
+            if (data.Read("LockReadAhead", lockReadAheadU)) {
+                lockReadAhead = (lockReadAheadU == 1u);
+            }
+        }
+    }
+    if (ok) {
+        if (!data.Read("PrefetchCycles", prefetchCycles)) {
+            prefetchCycles = 0u;
+        }
+        if (prefetchCycles > 0u) {
+            ok = ((fileFormat == FILE_FORMAT_BINARY) && (!preload) && (!memoryMap));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "PrefetchCycles > 0 is only supported with FileFormat = binary, Preload = no and MemoryMap = no");
+            }
+            if (!data.Read("NumberOfPrefetchBuffers", numberOfPrefetchBuffers)) {
+                numberOfPrefetchBuffers = 2u;
+            }
+            if (ok) {
+                ok = (numberOfPrefetchBuffers > 1u);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfPrefetchBuffers shall be at least 2");
+                }
+            }
+            uint32 cpuMaskIn;
+            if (data.Read("CPUMask", cpuMaskIn)) {
+                cpuMask = ProcessorType(cpuMaskIn);
+            }
+            if (!data.Read("StackSize", stackSize)) {
+                stackSize = THREADS_DEFAULT_STACKSIZE;
+            }
+        }
+    }
     if (ok) {
         StreamString interpolateStr;
         ok = data.Read("Interpolate", interpolateStr);
@@ -410,6 +715,31 @@ bool FileReader::Initialise(StructuredDataI &data) {
             }
         }
     }
+    if (ok) {
+        if (!data.Read("SeekIndexStep", seekIndexStep)) {
+            seekIndexStep = 0u;
+        }
+        if (seekIndexStep > 0u) {
+            if (!interpolate) {
+                ok = data.Read("XAxisSignal", xAxisSignalName);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "SeekIndexStep > 0 and the XAxisSignal was not specified");
+                }
+            }
+            if (ok) {
+                ok = (prefetchCycles == 0u);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "SeekIndexStep > 0 is not supported with PrefetchCycles > 0");
+                }
+            }
+            StreamString seekIndexCacheStr;
+            if (data.Read("SeekIndexCache", seekIndexCacheStr)) {
+                seekIndexCache = (seekIndexCacheStr == "yes");
+            }
+            seekIndexFilename = filename;
+            seekIndexFilename += ".seek";
+        }
+    }
     if (ok) {
         StreamString eofStr;
         if (data.Read("EOF", eofStr)) {
@@ -494,7 +824,7 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
     //Check signal properties and compute memory
     numberOfBinaryBytes = 0u;
     if (ok) {
-        //Do not allow samples
+        //Do not allow samples (unless they are interpolated)
         uint32 functionNumberOfSignals = 0u;
         uint32 n;
         if (GetFunctionNumberOfSignals(InputSignals, 0u, functionNumberOfSignals)) {
@@ -502,10 +832,10 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
                 uint32 nSamples;
                 ok = GetFunctionSignalSamples(InputSignals, 0u, n, nSamples);
                 if (ok) {
-                    ok = (nSamples == 1u);
+                    ok = (interpolate) ? (nSamples > 0u) : (nSamples == 1u);
                 }
                 if (!ok) {
-                    REPORT_ERROR(ErrorManagement::ParametersError, "The number of samples shall be exactly 1");
+                    REPORT_ERROR(ErrorManagement::ParametersError, "The number of samples shall be exactly 1 (or at least 1 if Interpolate = yes)");
                 }
             }
         }
@@ -530,6 +860,17 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
                 REPORT_ERROR(ErrorManagement::InitialisationError, "numberOfBinaryBytes = 0. The number of input signal bytes sizes should be positive");
             }
         }
+        //The frames of a compressed file may also hold columnar chunks
+        if ((ok) && ((compressed) || (columnar))) {
+            uint32 *signalByteSizes = new uint32[nOfSignals];
+            for (n = 0u; (n < nOfSignals) && (ok); n++) {
+                ok = GetSignalByteSize(n, signalByteSizes[n]);
+            }
+            if (ok) {
+                ok = columnChunk.SetSignals(nOfSignals, signalByteSizes);
+            }
+            delete[] signalByteSizes;
+        }
     }
     //Only one and one GAM allowed to interact with this DataSourceI
     if (ok) {
@@ -562,7 +903,7 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
 
     }
     //Look for the XAxisSignal
-    if (interpolate) {
+    if ((ok) && ((interpolate) || (seekIndexStep > 0u))) {
         ok = GetSignalIndex(xAxisSignalIdx, xAxisSignalName.Buffer());
         if (!ok) {
             REPORT_ERROR(ErrorManagement::ParametersError, "XAxisSignal: %s was not found", xAxisSignalName.Buffer());
@@ -583,9 +924,38 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
     }
 
     //Allocate memory
+    bool csvCacheValid = false;
     if (ok) {
         dataSourceMemory = reinterpret_cast<char8*>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(numberOfBinaryBytes));
-        if (preload) { //Get the size of the file and allocate memory
+        //If the type is text compile the decoder of the signals in advance
+        if (fileFormat == FILE_FORMAT_CSV) {
+            uint32 nOfSignals = GetNumberOfSignals();
+            ok = csvDecoder.SetNumberOfSignals(nOfSignals);
+            for (uint32 n = 0u; (n < nOfSignals) && (ok); n++) {
+                uint8 nDimensions = 0u;
+                uint32 nElements = 0u;
+                ok = GetSignalNumberOfDimensions(n, nDimensions);
+                if (ok) {
+                    ok = GetSignalNumberOfElements(n, nElements);
+                }
+                /*lint -e{613} dataSourceMemory and offsets cannot be null as otherwise ok would be false*/
+                if (ok) {
+                    ok = csvDecoder.SetSignal(n, GetSignalType(n), &dataSourceMemory[offsets[n]], nElements, (nDimensions == 1u));
+                    if (!ok) {
+                        StreamString signalName;
+                        (void) GetSignalName(n, signalName);
+                        REPORT_ERROR(ErrorManagement::ParametersError, "The type of the signal %s is not supported in csv files", signalName.Buffer());
+                    }
+                }
+            }
+            if (ok) {
+                ok = csvDecoder.Compile(csvSeparator.Buffer(), csvBufferSize);
+            }
+        }
+        if (!ok) {
+            //NOOP
+        }
+        else if (preload) { //Get the size of the file and allocate memory
             if (fileFormat == FILE_FORMAT_BINARY) {
                 const uint32 SIGNAL_NAME_MAX_SIZE = 32u;
                 uint32 headerSize = static_cast<uint32>(sizeof(uint16));
@@ -593,7 +963,12 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
                 headerSize += static_cast<uint32>(sizeof(uint32));
                 headerSize *= GetNumberOfSignals();
                 headerSize += static_cast<uint32>(sizeof(uint32));
-                allData.dataFileByteSize = inputFile.Size() - static_cast<uint64>(headerSize);
+                if ((compressed) || (columnar)) {
+                    ok = GetDecompressedSize(allData.dataFileByteSize);
+                }
+                else {
+                    allData.dataFileByteSize = inputFile.Size() - static_cast<uint64>(headerSize);
+                }
                 //check file size is multiple of numberOfBinaryBytes
                 //lint -e{414} Possible division by 0. numberOfBinaryBytes is different from 0 due to ok is true.
                 uint64 aux = allData.dataFileByteSize / numberOfBinaryBytes;
@@ -606,6 +981,9 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
                             allData.dataFileByteSize, numberOfBinaryBytes);
                 }
             }
+            else if ((csvCache) && (CheckCSVCache())) {
+                csvCacheValid = true;
+            }
             else { //Get the size of data CSV format
                 ok = inputFile.Seek(0LLU);
                 StreamString headerline;
@@ -613,14 +991,17 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
                 if (ok) {
                     ok = inputFile.GetLine(headerline); //Skip header
                 }
+                csvDecoder.Reset();
                 uint64 countLines = 0u;
                 while (ok && (!endFile)) {
-                    ok = inputFile.GetLine(headerline);
-                    if (!ok) { //Should not fail (if the file is not corrupted) since the end of the file is checked before calling GetLine
+                    char8 *line = NULL_PTR(char8*);
+                    uint32 lineSize = 0u;
+                    ok = csvDecoder.ReadLine(inputFile, line, lineSize);
+                    if (!ok) { //Should not fail (if the file is not corrupted) since the end of the file is checked before reading the line
                         REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading line in CSV format");
                     }
                     countLines++;
-                    endFile = inputFile.Position() == inputFile.Size();
+                    endFile = (inputFile.Position() == inputFile.Size()) && (csvDecoder.IsEmpty());
                 }
                 if (ok) {
                     allData.dataFileByteSize = countLines * numberOfBinaryBytes;
@@ -639,34 +1020,91 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
                         static_cast<uint32>(allData.dataFileByteSize)));
             }
         }
-    }
-    //If the type is text prepare the Printf properties in advanced
-    if (fileFormat == FILE_FORMAT_CSV) {
-        uint32 nOfSignals = GetNumberOfSignals();
-        uint32 n;
-        if (ok) {
-            signalsAnyType = new AnyType[nOfSignals];
-        }
-
-        for (n = 0u; (n < nOfSignals) && (ok); n++) {
-            uint8 nDimensions = 0u;
-            uint32 nElements = 0u;
-            ok = GetSignalNumberOfDimensions(n, nDimensions);
+        else if (prefetchCycles > 0u) {
+            const uint32 SIGNAL_NAME_MAX_SIZE = 32u;
+            uint32 headerSize = static_cast<uint32>(sizeof(uint16));
+            headerSize += SIGNAL_NAME_MAX_SIZE;
+            headerSize += static_cast<uint32>(sizeof(uint32));
+            headerSize *= GetNumberOfSignals();
+            headerSize += static_cast<uint32>(sizeof(uint32));
+            prefetchDataStart = static_cast<uint64>(headerSize);
+            ok = ((!compressed) && (!columnar));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "PrefetchCycles > 0 is not supported for compressed or columnar files");
+            }
+            if (ok) {
+                uint64 dataSize = inputFile.Size() - prefetchDataStart;
+                //lint -e{414} Possible division by 0. numberOfBinaryBytes is different from 0 due to ok is true.
+                ok = (dataSize > 0u) && ((dataSize % numberOfBinaryBytes) == 0u);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The data file size (%!) is not a positive multiple of the data to read each cycle (%u)",
+                                 dataSize, numberOfBinaryBytes);
+                }
+            }
             if (ok) {
-                ok = GetSignalNumberOfElements(n, nElements);
+                uint64 bufferSize = static_cast<uint64>(prefetchCycles) * numberOfBinaryBytes;
+                ok = (bufferSize < 0xFFFFFFFFu);
+                if (ok) {
+                    prefetchBufferSize = static_cast<uint32>(bufferSize);
+                }
+                else {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "The prefetch buffers (PrefetchCycles * %u bytes) shall be smaller than 4 GB", numberOfBinaryBytes);
+                }
+            }
+            if ((ok) && (prefetchBuffers == NULL_PTR(char8**))) {
+                prefetchBuffers = new char8*[numberOfPrefetchBuffers];
+                prefetchBytes = new uint32[numberOfPrefetchBuffers];
+                for (uint32 i = 0u; i < numberOfPrefetchBuffers; i++) {
+                    prefetchBuffers[i] = new char8[prefetchBufferSize];
+                    prefetchBytes[i] = 0u;
+                }
+                //The file is positioned after the header
+                prefetchExecutor.SetName(GetName());
+                prefetchExecutor.SetCPUMask(cpuMask);
+                prefetchExecutor.SetStackSize(stackSize);
+                ok = prefetchExecutor.Start();
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Could not start the prefetch thread");
+                }
+            }
+        }
+        else if (memoryMap) {
+            const uint32 SIGNAL_NAME_MAX_SIZE = 32u;
+            uint32 headerSize = static_cast<uint32>(sizeof(uint16));
+            headerSize += SIGNAL_NAME_MAX_SIZE;
+            headerSize += static_cast<uint32>(sizeof(uint32));
+            headerSize *= GetNumberOfSignals();
+            headerSize += static_cast<uint32>(sizeof(uint32));
+            ok = ((!compressed) && (!columnar));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "MemoryMap = yes is not supported for compressed or columnar files");
             }
-            /*lint -e{613} signalsAnyType, dataSourceMemory and offsets cannot be null as otherwise ok would be false*/
             if (ok) {
-                char8 *memPtr = &dataSourceMemory[offsets[n]];
-                void *signalAddress = reinterpret_cast<void*&>(memPtr);
-                signalsAnyType[n] = AnyType(GetSignalType(n), 0u, signalAddress);
-                signalsAnyType[n].SetNumberOfDimensions(nDimensions);
-                signalsAnyType[n].SetNumberOfElements(0u, nElements);
+                ok = MapFile(headerSize);
             }
         }
+        else {
+            //NOOP
+        }
     }
     if (ok && preload) { //Read all the file
-        if (fileFormat == FILE_FORMAT_BINARY) {
+        if ((fileFormat == FILE_FORMAT_BINARY) && ((compressed) || (columnar))) {
+            //The file is positioned after the header
+            while ((allData.interalBufferIdx < allData.dataFileByteSize) && ok) {
+                ok = ReadFrame();
+                if (ok) {
+                    ok = (frameBytes <= (allData.dataFileByteSize - allData.interalBufferIdx));
+                }
+                if (ok) {
+                    ok = MemoryOperationsHelper::Copy(&(allData.internalBuffer[allData.interalBufferIdx]), frameData, frameBytes);
+                    allData.interalBufferIdx = allData.interalBufferIdx + frameBytes;
+                }
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading the compressed or columnar input file");
+                }
+            }
+        }
+        else if (fileFormat == FILE_FORMAT_BINARY) {
             ok = inputFile.Seek(inputFile.Size() - allData.dataFileByteSize);
             uint64 remainingDataToRead = allData.dataFileByteSize;
             uint32 sizeRead;
@@ -697,6 +1135,9 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
                 }
             }
         }
+        else if (csvCacheValid) {
+            ok = ReadCSVCache();
+        }
         else { //FILE_FORMAT_CSV
             ok = inputFile.Seek(0LLU);
             StreamString headerline;
@@ -704,6 +1145,7 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
             if (ok) {
                 ok = inputFile.GetLine(headerline); //Skip header
             }
+            csvDecoder.Reset();
             while (ok && (!endFile)) {
                 ok = ReadLineCSVFormat();
                 if (!ok) {
@@ -712,12 +1154,18 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
                 if (ok) {
                     ok = MemoryOperationsHelper::Copy(&(allData.internalBuffer[allData.interalBufferIdx]), dataSourceMemory, numberOfBinaryBytes);
                 }
-                endFile = inputFile.Position() == inputFile.Size();
+                endFile = (inputFile.Position() == inputFile.Size()) && (csvDecoder.IsEmpty());
                 allData.interalBufferIdx = allData.interalBufferIdx + numberOfBinaryBytes;
             }
+            if ((ok) && (csvCache)) {
+                SaveCSVCache();
+            }
         }
         allData.interalBufferIdx = 0u;
     }
+    if ((ok) && (seekIndexStep > 0u)) {
+        ok = BuildSeekIndex();
+    }
 
     return ok;
 }
@@ -868,6 +1316,42 @@ ErrorManagement::ErrorType FileReader::OpenFile(StructuredDataI &cdb) {
                                  TypeDescriptor::GetTypeNameFromTypeDescriptor(signalType), nOfElements);
                 }
             }
+            //The files written with Compression != none have a frame header after the file header (and with Layout = columnar a chunk header)
+            compressed = false;
+            columnar = false;
+            if (!fatalFileError) {
+                uint64 dataStart = inputFile.Position();
+                if ((inputFile.Size() - dataStart) >= sizeof(FileFrameHeader)) {
+                    FileFrameHeader frameHeader;
+                    readSize = static_cast<uint32>(sizeof(FileFrameHeader));
+                    /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+                    fatalFileError = !inputFile.Read(reinterpret_cast<char8*>(&frameHeader), readSize);
+                    if (!fatalFileError) {
+                        compressed = FileFrameCodec::HasMagic(frameHeader);
+                        if (compressed) {
+                            fatalFileError = !FileFrameCodec::IsValidHeader(frameHeader);
+                            if (fatalFileError) {
+                                REPORT_ERROR(ErrorManagement::FatalError, "The file %s is compressed with an unsupported codec (%u)", filename.Buffer(),
+                                             frameHeader.codec);
+                            }
+                            else {
+                                REPORT_ERROR(ErrorManagement::Information, "The data of %s is compressed", filename.Buffer());
+                            }
+                        }
+                        else {
+                            FileChunkHeader chunkHeader;
+                            /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: both headers have the same size.*/
+                            columnar = FileColumnChunk::ReadHeader(reinterpret_cast<const char8*>(&frameHeader), chunkHeader);
+                            if (columnar) {
+                                REPORT_ERROR(ErrorManagement::Information, "The data of %s is stored in columnar chunks", filename.Buffer());
+                            }
+                        }
+                    }
+                    if (!fatalFileError) {
+                        fatalFileError = !inputFile.Seek(dataStart);
+                    }
+                }
+            }
         }
 
     }
@@ -875,100 +1359,946 @@ ErrorManagement::ErrorType FileReader::OpenFile(StructuredDataI &cdb) {
     return ret;
 }
 bool FileReader::ReadLineCSVFormat() {
-    StreamString token;
-    char8 saveTerminator;
-    uint32 nSignals = GetNumberOfSignals();
-    uint32 signalIdx = 0u;
-    StreamString line;
-    bool ok = inputFile.GetLine(line);
-    if (ok) {
-        ok = line.Seek(0LLU);
-    }
-    if (ok) {
-        ok = line.GetToken(token, csvSeparator.Buffer(), saveTerminator);
-    }
-    /*lint -e{613} signalsAnyType cannot be NULL as otherwise SetConfiguredDatabase would have failed.*/
-    while ((ok) && (signalIdx < nSignals)) {
-        bool isString = (signalsAnyType[signalIdx].GetTypeDescriptor() == CharString);
-        if (!isString) {
-            isString = (signalsAnyType[signalIdx].GetTypeDescriptor() == Character8Bit);
-        }
-        if ((signalsAnyType[signalIdx].GetNumberOfDimensions() == 1u) && (!isString)) {
-            uint32 nElements = signalsAnyType[signalIdx].GetNumberOfElements(0u);
-            StreamString tokenArray;
-            uint32 arrayIdx = 0u;
-            void *signalAddress = signalsAnyType[signalIdx].GetDataPointer();
-            char8 *signalAddressChr = reinterpret_cast<char8*>(signalAddress);
-            if (token[static_cast<uint32>(token.Size()) - 1u] != '}') {
-                token += csvSeparator;
-                ok = line.GetToken(token, "}", saveTerminator);
-                if (ok) {
-                    token += saveTerminator;
-                }
-            }
-            if (ok) {
-                ok = token.Seek(0LLU);
-            }
-            if (ok) {
-                ok = token.GetToken(tokenArray, "{},", saveTerminator);
-            }
-            while ((ok) && (arrayIdx < nElements)) {
-                AnyType sourceStr(CharString, 0u, tokenArray.Buffer());
-                uint32 byteSize = signalsAnyType[signalIdx].GetByteSize();
-                uint32 arrayIdxByteSize = (arrayIdx * byteSize);
-                AnyType destination(signalsAnyType[signalIdx].GetTypeDescriptor(), 0u, &signalAddressChr[arrayIdxByteSize]);
-                ok = TypeConvert(destination, sourceStr);
-                tokenArray = "";
-                arrayIdx++;
-                if (ok) {
-                    ok = token.GetToken(tokenArray, "{},", saveTerminator);
-                }
-            }
-            ok = (arrayIdx == nElements);
-            if (!ok) {
-                StreamString signalName;
-                (void) GetSignalName(signalIdx, signalName);
-                REPORT_ERROR(ErrorManagement::FatalError, "Inconsistent number of elements found in array of signal %s. [%s]", signalName.Buffer(),
-                             line.Buffer());
-            }
-        }
-        else {
-            if (!isString) {
-                AnyType sourceStr(CharString, 0u, token.Buffer());
-                ok = TypeConvert(signalsAnyType[signalIdx], sourceStr);
-            }
-            else {
-                ok = StringHelper::CopyN(reinterpret_cast<char8*>(signalsAnyType[signalIdx].GetDataPointer()), token.Buffer(),
-                                         signalsAnyType[signalIdx].GetNumberOfElements(0u));
-            }
+    char8 *line = NULL_PTR(char8*);
+    uint32 lineSize = 0u;
+    bool ok = csvDecoder.ReadLine(inputFile, line, lineSize);
+    if (ok) {
+        ok = csvDecoder.Decode(line, lineSize);
+        if (!ok) {
+            StreamString signalName;
+            (void) GetSignalName(csvDecoder.GetErrorSignal(), signalName);
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not read the signal %s (inconsistent number of signals or of elements) [%s]", signalName.Buffer(),
+                         line);
         }
-        signalIdx++;
-        token = "";
+    }
+    return ok;
+}
+
+bool FileReader::CheckCSVCache() {
+    uint64 csvSize = 0u;
+    uint64 csvModificationTime = 0u;
+    bool ok = FileReaderStat(filename.Buffer(), csvSize, csvModificationTime);
+    File cacheFile;
+    if (ok) {
+        ok = cacheFile.Open(csvCacheFilename.Buffer(), BasicFile::ACCESS_MODE_R);
+    }
+    FileReaderCSVCacheHeader header;
+    if (ok) {
+        uint32 readSize = static_cast<uint32>(sizeof(FileReaderCSVCacheHeader));
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+        ok = cacheFile.Read(reinterpret_cast<char8*>(&header), readSize);
         if (ok) {
-            if (signalIdx != nSignals) {
-                ok = line.GetToken(token, csvSeparator.Buffer(), saveTerminator);
-            }
+            ok = (readSize == static_cast<uint32>(sizeof(FileReaderCSVCacheHeader)));
         }
     }
     if (ok) {
-        ok = (signalIdx == nSignals);
-        if (!ok) {
-            StreamString signalName;
-            (void) GetSignalName(signalIdx, signalName);
-            REPORT_ERROR(ErrorManagement::FatalError, "Inconsistent number of signals found [%s]", line.Buffer());
-        }
+        ok = (MemoryOperationsHelper::Compare(&header.magic[0], FILE_READER_CSV_CACHE_MAGIC, static_cast<uint32>(sizeof(header.magic))) == 0);
+    }
+    //The sidecar file is only valid for the same csv file and signals
+    if (ok) {
+        ok = (header.csvSize == csvSize) && (header.csvModificationTime == csvModificationTime);
+    }
+    if (ok) {
+        ok = (header.numberOfSignals == GetNumberOfSignals()) && (header.numberOfBinaryBytes == numberOfBinaryBytes);
+    }
+    if (ok) {
+        //lint -e{414} Possible division by 0. numberOfBinaryBytes is different from 0 due to ok is true.
+        ok = (header.dataSize > 0u) && ((header.dataSize % numberOfBinaryBytes) == 0u);
+    }
+    if (ok) {
+        ok = (cacheFile.Size() == (static_cast<uint64>(sizeof(FileReaderCSVCacheHeader)) + header.dataSize));
+    }
+    if (cacheFile.IsOpen()) {
+        (void) cacheFile.Close();
+    }
+    if (ok) {
+        allData.dataFileByteSize = header.dataSize;
+        REPORT_ERROR(ErrorManagement::Information, "Loading the decoded data of %s from %s", filename.Buffer(), csvCacheFilename.Buffer());
     }
     return ok;
 }
-ErrorManagement::ErrorType FileReader::CloseFile() {
-    ErrorManagement::ErrorType err;
-    if (inputFile.IsOpen()) {
-        err = !inputFile.Close();
+
+bool FileReader::ReadCSVCache() {
+    File cacheFile;
+    bool ok = cacheFile.Open(csvCacheFilename.Buffer(), BasicFile::ACCESS_MODE_R);
+    if (ok) {
+        ok = cacheFile.Seek(static_cast<uint64>(sizeof(FileReaderCSVCacheHeader)));
     }
-    return err;
+    uint64 remainingDataToRead = allData.dataFileByteSize;
+    while ((remainingDataToRead > 0u) && (ok)) {
+        uint32 sizeToRead = 500000000u;
+        if (remainingDataToRead < static_cast<uint64>(sizeToRead)) {
+            sizeToRead = static_cast<uint32>(remainingDataToRead);
+        }
+        uint32 sizeRead = sizeToRead;
+        ok = cacheFile.Read(&(allData.internalBuffer[allData.interalBufferIdx]), sizeRead);
+        if (ok) {
+            ok = (sizeRead == sizeToRead);
+        }
+        if (ok) {
+            remainingDataToRead -= sizeRead;
+            allData.interalBufferIdx = allData.interalBufferIdx + sizeRead;
+        }
+    }
+    if (cacheFile.IsOpen()) {
+        (void) cacheFile.Close();
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading the csv cache file %s", csvCacheFilename.Buffer());
+    }
+    return ok;
 }
 
-const StreamString& FileReader::GetFilename() const {
+void FileReader::SaveCSVCache() {
+    FileReaderCSVCacheHeader header;
+    bool ok = MemoryOperationsHelper::Set(&header, '\0', static_cast<uint32>(sizeof(FileReaderCSVCacheHeader)));
+    if (ok) {
+        ok = FileReaderStat(filename.Buffer(), header.csvSize, header.csvModificationTime);
+    }
+    File cacheFile;
+    if (ok) {
+        Directory fileToDelete(csvCacheFilename.Buffer());
+        (void) fileToDelete.Delete();
+        ok = cacheFile.Open(csvCacheFilename.Buffer(), (BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT));
+    }
+    //The header is written last so that an incomplete sidecar file is never valid
+    if (ok) {
+        uint32 writeSize = static_cast<uint32>(sizeof(FileReaderCSVCacheHeader));
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Write function.*/
+        ok = cacheFile.Write(reinterpret_cast<const char8*>(&header), writeSize);
+    }
+    uint64 written = 0u;
+    while ((written < allData.dataFileByteSize) && (ok)) {
+        uint32 writeSize = 500000000u;
+        if ((allData.dataFileByteSize - written) < static_cast<uint64>(writeSize)) {
+            writeSize = static_cast<uint32>(allData.dataFileByteSize - written);
+        }
+        uint32 sizeToWrite = writeSize;
+        ok = cacheFile.Write(&(allData.internalBuffer[written]), writeSize);
+        if (ok) {
+            ok = (writeSize == sizeToWrite);
+        }
+        written += writeSize;
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(&header.magic[0], FILE_READER_CSV_CACHE_MAGIC, static_cast<uint32>(sizeof(header.magic)));
+        header.dataSize = allData.dataFileByteSize;
+        header.numberOfBinaryBytes = numberOfBinaryBytes;
+        header.numberOfSignals = GetNumberOfSignals();
+    }
+    if (ok) {
+        ok = cacheFile.Seek(0LLU);
+    }
+    if (ok) {
+        uint32 writeSize = static_cast<uint32>(sizeof(FileReaderCSVCacheHeader));
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Write function.*/
+        ok = cacheFile.Write(reinterpret_cast<const char8*>(&header), writeSize);
+    }
+    if (cacheFile.IsOpen()) {
+        ok = (cacheFile.Close()) && (ok);
+    }
+    if (ok) {
+        REPORT_ERROR(ErrorManagement::Information, "Stored the decoded data of %s in %s", filename.Buffer(), csvCacheFilename.Buffer());
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::Warning, "Could not write the csv cache file %s", csvCacheFilename.Buffer());
+    }
+}
+
+bool FileReader::ReadFrame() {
+    uint32 size = 0u;
+    uint32 readSize = 0u;
+    bool ok = true;
+    if (compressed) {
+        FileFrameHeader frameHeader;
+        readSize = static_cast<uint32>(sizeof(FileFrameHeader));
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+        ok = inputFile.Read(reinterpret_cast<char8*>(&frameHeader), readSize);
+        if (ok) {
+            ok = (readSize == static_cast<uint32>(sizeof(FileFrameHeader)));
+        }
+        if (ok) {
+            ok = FileFrameCodec::IsValidHeader(frameHeader);
+        }
+        if (ok) {
+            FileReaderReserve(frameCompressed, frameCompressedSize, frameHeader.compressedSize);
+            FileReaderReserve(frameData, frameDataSize, frameHeader.uncompressedSize);
+            readSize = frameHeader.compressedSize;
+            ok = inputFile.Read(frameCompressed, readSize);
+        }
+        if (ok) {
+            ok = (readSize == frameHeader.compressedSize);
+        }
+        if (ok) {
+            ok = FileFrameCodec::Decode(frameHeader, frameCompressed, frameData);
+        }
+        size = frameHeader.uncompressedSize;
+    }
+    else {
+        //Uncompressed columnar chunk
+        char8 headerBytes[sizeof(FileChunkHeader)];
+        FileChunkHeader chunkHeader;
+        readSize = static_cast<uint32>(sizeof(FileChunkHeader));
+        ok = inputFile.Read(&headerBytes[0], readSize);
+        if (ok) {
+            ok = (readSize == static_cast<uint32>(sizeof(FileChunkHeader)));
+        }
+        if (ok) {
+            ok = FileColumnChunk::ReadHeader(&headerBytes[0], chunkHeader);
+        }
+        if (ok) {
+            ok = (chunkHeader.chunkSize > sizeof(FileChunkHeader)) && (chunkHeader.chunkSize < 0xFFFFFFFFu);
+        }
+        if (ok) {
+            size = static_cast<uint32>(chunkHeader.chunkSize);
+            FileReaderReserve(frameData, frameDataSize, size);
+            ok = MemoryOperationsHelper::Copy(frameData, &headerBytes[0], static_cast<uint32>(sizeof(FileChunkHeader)));
+        }
+        if (ok) {
+            readSize = size - static_cast<uint32>(sizeof(FileChunkHeader));
+            ok = inputFile.Read(&frameData[sizeof(FileChunkHeader)], readSize);
+        }
+        if (ok) {
+            ok = (readSize == (size - static_cast<uint32>(sizeof(FileChunkHeader))));
+        }
+    }
+    FileChunkHeader chunkHeader;
+    bool isChunk = false;
+    if ((ok) && (size >= sizeof(FileChunkHeader))) {
+        isChunk = FileColumnChunk::ReadHeader(frameData, chunkHeader);
+    }
+    if (isChunk) {
+        //The cycles are transposed into frameChunk, which then becomes frameData
+        uint64 rowsSize = static_cast<uint64>(chunkHeader.numberOfCycles) * numberOfBinaryBytes;
+        ok = (rowsSize < 0xFFFFFFFFu);
+        uint32 numberOfCycles = 0u;
+        if (ok) {
+            FileReaderReserve(frameChunk, frameChunkSize, static_cast<uint32>(rowsSize));
+            ok = columnChunk.Decode(frameData, size, frameChunk, frameChunkSize, numberOfCycles);
+        }
+        char8 *rows = frameChunk;
+        uint32 rowsBufferSize = frameChunkSize;
+        frameChunk = frameData;
+        frameChunkSize = frameDataSize;
+        frameData = rows;
+        frameDataSize = rowsBufferSize;
+        size = numberOfCycles * numberOfBinaryBytes;
+    }
+    else {
+        ok = (ok) && (compressed);
+    }
+    if (ok) {
+        //lint -e{414} Possible division by 0. numberOfBinaryBytes is different from 0 after SetConfiguredDatabase.
+        ok = (size > 0u) && ((size % numberOfBinaryBytes) == 0u);
+    }
+    frameBytes = ok ? size : 0u;
+    frameIdx = 0u;
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Invalid compressed frame or columnar chunk in %s", filename.Buffer());
+    }
+    return ok;
+}
+
+bool FileReader::MapFile(const uint32 headerSize) {
+    mapSize = inputFile.Size();
+    mapDataStart = static_cast<uint64>(headerSize);
+    allData.dataFileByteSize = (mapSize > mapDataStart) ? (mapSize - mapDataStart) : 0u;
+    //lint -e{414} Possible division by 0. numberOfBinaryBytes is different from 0 after SetConfiguredDatabase.
+    bool ok = (allData.dataFileByteSize > 0u) && ((allData.dataFileByteSize % numberOfBinaryBytes) == 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "The data file size (%!) is not a positive multiple of the data to read each cycle (%u)",
+                     allData.dataFileByteSize, numberOfBinaryBytes);
+    }
+    int32 fd = -1;
+    if (ok) {
+        fd = open(filename.Buffer(), O_RDONLY);
+        ok = (fd >= 0);
+    }
+    if (ok) {
+        void *mem = mmap(NULL_PTR(void*), static_cast<size_t>(mapSize), PROT_READ, MAP_SHARED, fd, 0);
+        ok = (mem != MAP_FAILED);
+        if (ok) {
+            mapBase = static_cast<char8*>(mem);
+        }
+        //The mapping is kept after the descriptor is closed
+        (void) close(fd);
+    }
+    if (ok) {
+        (void) madvise(mapBase, static_cast<size_t>(mapSize), MADV_SEQUENTIAL);
+        allData.internalBuffer = &mapBase[mapDataStart];
+        allData.interalBufferIdx = 0u;
+        uint64 pageSize = static_cast<uint64>(sysconf(_SC_PAGESIZE));
+        readAheadStep = (((readAheadSize / 2u) + pageSize - 1u) / pageSize) * pageSize;
+        if (readAheadStep == 0u) {
+            readAheadStep = pageSize;
+        }
+        ResetReadAhead();
+        REPORT_ERROR(ErrorManagement::Information, "Mapped %! bytes of %s", mapSize, filename.Buffer());
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Could not map the file %s in memory", filename.Buffer());
+    }
+    return ok;
+}
+
+void FileReader::AdvanceReadAhead() {
+    uint64 position = mapDataStart + allData.interalBufferIdx;
+    if (((position + readAheadStep) > readAheadEnd) && (readAheadEnd < mapSize)) {
+        uint64 pageStart = position - (position % readAheadStep);
+        uint64 end = readAheadEnd + readAheadStep;
+        if (end > mapSize) {
+            end = mapSize;
+        }
+        if (lockReadAhead) {
+            if (pageStart > readAheadStart) {
+                (void) munlock(&mapBase[readAheadStart], static_cast<size_t>(pageStart - readAheadStart));
+            }
+            //The pages were already prefetched by the previous call
+            if (mlock(&mapBase[readAheadEnd], static_cast<size_t>(end - readAheadEnd)) != 0) {
+                lockReadAhead = false;
+                (void) munlock(mapBase, static_cast<size_t>(mapSize));
+                REPORT_ERROR(ErrorManagement::Warning, "Could not lock the read ahead window of %s (see RLIMIT_MEMLOCK). Only prefetching.", filename.Buffer());
+            }
+        }
+        if (pageStart > readAheadStart) {
+            readAheadStart = pageStart;
+        }
+        readAheadEnd = end;
+        uint64 adviseEnd = end + readAheadStep;
+        if (adviseEnd > mapSize) {
+            adviseEnd = mapSize;
+        }
+        if (adviseEnd > end) {
+            (void) madvise(&mapBase[end], static_cast<size_t>(adviseEnd - end), MADV_WILLNEED);
+        }
+    }
+}
+
+void FileReader::ResetReadAhead() {
+    if ((lockReadAhead) && (readAheadEnd > readAheadStart)) {
+        (void) munlock(&mapBase[readAheadStart], static_cast<size_t>(readAheadEnd - readAheadStart));
+    }
+    uint64 position = mapDataStart + allData.interalBufferIdx;
+    readAheadStart = position - (position % readAheadStep);
+    readAheadEnd = readAheadStart;
+    uint64 adviseEnd = readAheadStart + readAheadStep;
+    if (adviseEnd > mapSize) {
+        adviseEnd = mapSize;
+    }
+    (void) madvise(&mapBase[readAheadStart], static_cast<size_t>(adviseEnd - readAheadStart), MADV_WILLNEED);
+    AdvanceReadAhead();
+}
+
+ErrorManagement::ErrorType FileReader::Execute(ExecutionInfo& info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        (void) prefetchFreeSem.Reset();
+        if ((static_cast<uint32>(prefetchReady) == numberOfPrefetchBuffers) || (prefetchEnd)) {
+            (void) prefetchFreeSem.Wait(PREFETCH_WAIT_TIMEOUT_MSEC);
+        }
+        while ((static_cast<uint32>(prefetchReady) < numberOfPrefetchBuffers) && (!prefetchEnd)) {
+            bool endOfFile = false;
+            bool ok = FillPrefetchBuffer(prefetchFillIndex, endOfFile);
+            /*lint -e{613} prefetchBytes cannot be NULL if the prefetch thread is running*/
+            if ((ok) && (prefetchBytes[prefetchFillIndex] > 0u)) {
+                prefetchFillIndex++;
+                if (prefetchFillIndex == numberOfPrefetchBuffers) {
+                    prefetchFillIndex = 0u;
+                }
+                //Atomic::Increment is a full memory barrier: Synchronise sees the buffer before the new prefetchReady
+                Atomic::Increment(&prefetchReady);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to prefetch from the file %s", filename.Buffer());
+            }
+            //Set after the last buffer was queued
+            prefetchEnd = ((!ok) || (endOfFile));
+            (void) prefetchReadySem.Post();
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+bool FileReader::FillPrefetchBuffer(const uint32 idx,
+                                    bool &endOfFile) {
+    bool ok = true;
+    uint32 filled = 0u;
+    endOfFile = false;
+    /*lint -e{613} prefetchBuffers cannot be NULL if the prefetch thread is running*/
+    while ((ok) && (filled < prefetchBufferSize) && (!endOfFile)) {
+        uint64 remaining = inputFile.Size() - inputFile.Position();
+        if (remaining == 0u) {
+            if (eofBehaviour == EOFRewind) {
+                ok = inputFile.Seek(prefetchDataStart);
+            }
+            else {
+                endOfFile = true;
+            }
+        }
+        else {
+            uint32 readSize = prefetchBufferSize - filled;
+            if (remaining < readSize) {
+                readSize = static_cast<uint32>(remaining);
+            }
+            ok = inputFile.Read(&prefetchBuffers[idx][filled], readSize);
+            if (ok) {
+                ok = (readSize > 0u);
+                filled += readSize;
+            }
+        }
+    }
+    //The data size is a multiple of numberOfBinaryBytes (see SetConfiguredDatabase)
+    prefetchBytes[idx] = filled;
+    return ok;
+}
+
+bool FileReader::WaitPrefetchBuffer(bool &endOfData) {
+    bool ok = true;
+    bool stalled = false;
+    endOfData = false;
+    while ((ok) && (prefetchReady == 0) && (!endOfData)) {
+        (void) prefetchReadySem.Reset();
+        //Read prefetchEnd before prefetchReady: the last buffer is queued before prefetchEnd is set
+        bool ended = prefetchEnd;
+        if (prefetchReady == 0) {
+            if (ended) {
+                endOfData = true;
+            }
+            else {
+                stalled = true;
+                (void) prefetchReadySem.Wait(PREFETCH_WAIT_TIMEOUT_MSEC);
+                ok = (prefetchExecutor.GetStatus() != EmbeddedThreadI::OffState);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "The prefetch thread is not running");
+                }
+            }
+        }
+    }
+    if (stalled) {
+        numberOfPrefetchStalls++;
+    }
+    return ok;
+}
+
+bool FileReader::ReadPrefetchedCycle() {
+    bool ok = (prefetchReady > 0);
+    if (ok) {
+        /*lint -e{613} prefetchBuffers and prefetchBytes cannot be NULL if the prefetch thread is running*/
+        ok = MemoryOperationsHelper::Copy(dataSourceMemory, &prefetchBuffers[prefetchReadIndex][prefetchReadOffset], numberOfBinaryBytes);
+        prefetchReadOffset += numberOfBinaryBytes;
+        if (prefetchReadOffset >= prefetchBytes[prefetchReadIndex]) {
+            prefetchReadOffset = 0u;
+            prefetchReadIndex++;
+            if (prefetchReadIndex == numberOfPrefetchBuffers) {
+                prefetchReadIndex = 0u;
+            }
+            Atomic::Decrement(&prefetchReady);
+            (void) prefetchFreeSem.Post();
+        }
+    }
+    return ok;
+}
+
+bool FileReader::ReadFramedCycle() {
+    bool ok = true;
+    if (frameIdx == frameBytes) {
+        ok = ReadFrame();
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(dataSourceMemory, &frameData[frameIdx], numberOfBinaryBytes);
+        frameIdx += numberOfBinaryBytes;
+    }
+    return ok;
+}
+
+bool FileReader::GetDecompressedSize(uint64 &size) {
+    uint64 dataStart = inputFile.Position();
+    uint64 fileSize = inputFile.Size();
+    bool ok = true;
+    size = 0u;
+    while ((ok) && (inputFile.Position() < fileSize)) {
+        //Both headers have the same size
+        FileFrameHeader frameHeader;
+        uint32 readSize = static_cast<uint32>(sizeof(FileFrameHeader));
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+        ok = inputFile.Read(reinterpret_cast<char8*>(&frameHeader), readSize);
+        if (ok) {
+            ok = (readSize == static_cast<uint32>(sizeof(FileFrameHeader)));
+        }
+        uint64 skip = 0u;
+        if ((ok) && (compressed)) {
+            ok = FileFrameCodec::IsValidHeader(frameHeader);
+            size += static_cast<uint64>(frameHeader.numberOfCycles) * numberOfBinaryBytes;
+            skip = frameHeader.compressedSize;
+        }
+        else if (ok) {
+            FileChunkHeader chunkHeader;
+            /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: both headers have the same size.*/
+            ok = FileColumnChunk::ReadHeader(reinterpret_cast<const char8*>(&frameHeader), chunkHeader);
+            if (ok) {
+                ok = (chunkHeader.chunkSize >= sizeof(FileChunkHeader));
+            }
+            size += static_cast<uint64>(chunkHeader.numberOfCycles) * numberOfBinaryBytes;
+            skip = chunkHeader.chunkSize - sizeof(FileChunkHeader);
+        }
+        else {
+            //NOOP
+        }
+        if (ok) {
+            ok = (skip <= (fileSize - inputFile.Position()));
+        }
+        if (ok) {
+            ok = inputFile.Seek(inputFile.Position() + skip);
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Invalid compressed frame or columnar chunk header in %s", filename.Buffer());
+    }
+    if (ok) {
+        ok = inputFile.Seek(dataStart);
+    }
+    return ok;
+}
+
+bool FileReader::BuildSeekIndex() {
+    bool inMemory = ((preload) || (memoryMap));
+    bool ok = (inMemory) || ((!compressed) && (!columnar));
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "SeekIndexStep > 0 is not supported for compressed or columnar files which are not preloaded");
+    }
+    bool csvStreaming = ((!inMemory) && (fileFormat == FILE_FORMAT_CSV));
+    if (ok) {
+        //lint -e{414} Possible division by 0. numberOfBinaryBytes is different from 0 due to ok is true.
+        if (inMemory) {
+            seekDataStart = 0u;
+            seekNumberOfCycles = allData.dataFileByteSize / numberOfBinaryBytes;
+        }
+        else if (fileFormat == FILE_FORMAT_BINARY) {
+            const uint32 SIGNAL_NAME_MAX_SIZE = 32u;
+            uint32 headerSize = static_cast<uint32>(sizeof(uint16));
+            headerSize += SIGNAL_NAME_MAX_SIZE;
+            headerSize += static_cast<uint32>(sizeof(uint32));
+            headerSize *= GetNumberOfSignals();
+            headerSize += static_cast<uint32>(sizeof(uint32));
+            seekDataStart = static_cast<uint64>(headerSize);
+            seekNumberOfCycles = (inputFile.Size() - seekDataStart) / numberOfBinaryBytes;
+        }
+        else {
+            ok = inputFile.Seek(0LLU);
+            if (ok) {
+                StreamString header;
+                //Skip the header
+                ok = inputFile.GetLine(header);
+            }
+            if (ok) {
+                seekDataStart = inputFile.Position();
+            }
+            csvDecoder.Reset();
+        }
+    }
+    bool loaded = false;
+    if ((ok) && (seekIndexCache)) {
+        loaded = LoadSeekIndex();
+    }
+    if ((ok) && (!loaded)) {
+        if (csvStreaming) {
+            //The offsets of the lines are only known after reading all the previous lines
+            uint32 capacity = 1024u;
+            seekIndex = new SeekIndexEntry[capacity];
+            seekIndexSize = 0u;
+            uint64 cycle = 0u;
+            bool endOfFile = false;
+            while ((ok) && (!endOfFile)) {
+                uint64 offset = inputFile.Position() - csvDecoder.GetBufferedSize();
+                char8 *line = NULL_PTR(char8*);
+                uint32 lineSize = 0u;
+                endOfFile = !csvDecoder.ReadLine(inputFile, line, lineSize);
+                if ((!endOfFile) && ((cycle % seekIndexStep) == 0u)) {
+                    ok = csvDecoder.Decode(line, lineSize);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::InitialisationError, "Could not decode the line %! while building the seek index", cycle);
+                    }
+                    if ((ok) && (seekIndexSize == capacity)) {
+                        SeekIndexEntry *larger = new SeekIndexEntry[capacity * 2u];
+                        for (uint32 e = 0u; e < seekIndexSize; e++) {
+                            larger[e] = seekIndex[e];
+                        }
+                        delete[] seekIndex;
+                        seekIndex = larger;
+                        capacity *= 2u;
+                    }
+                    if (ok) {
+                        /*lint -e{613} dataSourceMemory and offsets cannot be null as otherwise ok would be false*/
+                        seekIndex[seekIndexSize].xAxisValue = FileReaderToUInt64(xAxisSignalType, &dataSourceMemory[offsets[xAxisSignalIdx]]);
+                        seekIndex[seekIndexSize].cycle = cycle;
+                        seekIndex[seekIndexSize].offset = offset;
+                        seekIndexSize++;
+                    }
+                }
+                if (!endOfFile) {
+                    cycle++;
+                }
+            }
+            seekNumberOfCycles = cycle;
+        }
+        else {
+            uint64 numberOfEntries = (seekNumberOfCycles + seekIndexStep - 1u) / seekIndexStep;
+            ok = (numberOfEntries < 0xFFFFFFFFu);
+            if (ok) {
+                seekIndex = new SeekIndexEntry[numberOfEntries];
+                seekIndexSize = 0u;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Too many seek index entries. Increase the SeekIndexStep");
+            }
+            for (uint64 e = 0u; (e < numberOfEntries) && (ok); e++) {
+                uint64 cycle = e * seekIndexStep;
+                uint64 xAxisValue = 0u;
+                ok = ReadCycleXAxis(cycle, xAxisValue);
+                if (ok) {
+                    seekIndex[seekIndexSize].xAxisValue = xAxisValue;
+                    seekIndex[seekIndexSize].cycle = cycle;
+                    seekIndex[seekIndexSize].offset = seekDataStart + (cycle * numberOfBinaryBytes);
+                    seekIndexSize++;
+                }
+            }
+        }
+        if (ok) {
+            ok = (seekIndexSize > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The file %s has no data to index", filename.Buffer());
+            }
+        }
+        if ((ok) && (seekIndexCache)) {
+            SaveSeekIndex();
+        }
+    }
+    //Move back to the first cycle
+    if ((ok) && (!inMemory)) {
+        ok = inputFile.Seek(seekDataStart);
+        csvDecoder.Reset();
+    }
+    if (ok) {
+        REPORT_ERROR(ErrorManagement::Information, "Indexed %! cycles of %s with %u entries", seekNumberOfCycles, filename.Buffer(), seekIndexSize);
+    }
+    return ok;
+}
+
+bool FileReader::LoadSeekIndex() {
+    uint64 fileSize = 0u;
+    uint64 fileModificationTime = 0u;
+    bool ok = FileReaderStat(filename.Buffer(), fileSize, fileModificationTime);
+    File indexFile;
+    if (ok) {
+        ok = indexFile.Open(seekIndexFilename.Buffer(), BasicFile::ACCESS_MODE_R);
+    }
+    FileReaderSeekIndexHeader header;
+    if (ok) {
+        uint32 readSize = static_cast<uint32>(sizeof(FileReaderSeekIndexHeader));
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+        ok = indexFile.Read(reinterpret_cast<char8*>(&header), readSize);
+        if (ok) {
+            ok = (readSize == static_cast<uint32>(sizeof(FileReaderSeekIndexHeader)));
+        }
+    }
+    if (ok) {
+        ok = (MemoryOperationsHelper::Compare(&header.magic[0], FILE_READER_SEEK_INDEX_MAGIC, static_cast<uint32>(sizeof(header.magic))) == 0);
+    }
+    //The sidecar file is only valid for the same file, signals and step
+    if (ok) {
+        ok = (header.fileSize == fileSize) && (header.fileModificationTime == fileModificationTime);
+    }
+    if (ok) {
+        ok = (header.seekIndexStep == seekIndexStep) && (header.xAxisSignalIdx == xAxisSignalIdx) && (header.numberOfBinaryBytes == numberOfBinaryBytes);
+    }
+    if (ok) {
+        ok = (header.dataStart == seekDataStart);
+    }
+    if (ok) {
+        ok = (header.numberOfEntries > 0u);
+    }
+    if (ok) {
+        uint64 entriesSize = static_cast<uint64>(header.numberOfEntries) * static_cast<uint64>(sizeof(SeekIndexEntry));
+        ok = (indexFile.Size() == (static_cast<uint64>(sizeof(FileReaderSeekIndexHeader)) + entriesSize));
+    }
+    if (ok) {
+        seekIndex = new SeekIndexEntry[header.numberOfEntries];
+        uint32 readSize = header.numberOfEntries * static_cast<uint32>(sizeof(SeekIndexEntry));
+        uint32 sizeToRead = readSize;
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+        ok = indexFile.Read(reinterpret_cast<char8*>(seekIndex), readSize);
+        if (ok) {
+            ok = (readSize == sizeToRead);
+        }
+        if (ok) {
+            seekIndexSize = header.numberOfEntries;
+            seekNumberOfCycles = header.numberOfCycles;
+        }
+        else {
+            delete[] seekIndex;
+            seekIndex = NULL_PTR(SeekIndexEntry*);
+        }
+    }
+    if (indexFile.IsOpen()) {
+        (void) indexFile.Close();
+    }
+    if (ok) {
+        REPORT_ERROR(ErrorManagement::Information, "Loaded the seek index of %s from %s", filename.Buffer(), seekIndexFilename.Buffer());
+    }
+    return ok;
+}
+
+void FileReader::SaveSeekIndex() {
+    FileReaderSeekIndexHeader header;
+    bool ok = MemoryOperationsHelper::Set(&header, '\0', static_cast<uint32>(sizeof(FileReaderSeekIndexHeader)));
+    if (ok) {
+        ok = FileReaderStat(filename.Buffer(), header.fileSize, header.fileModificationTime);
+    }
+    File indexFile;
+    if (ok) {
+        Directory fileToDelete(seekIndexFilename.Buffer());
+        (void) fileToDelete.Delete();
+        ok = indexFile.Open(seekIndexFilename.Buffer(), (BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT));
+    }
+    //The header is written last so that an incomplete sidecar file is never valid
+    if (ok) {
+        uint32 writeSize = static_cast<uint32>(sizeof(FileReaderSeekIndexHeader));
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Write function.*/
+        ok = indexFile.Write(reinterpret_cast<const char8*>(&header), writeSize);
+    }
+    if (ok) {
+        uint32 writeSize = seekIndexSize * static_cast<uint32>(sizeof(SeekIndexEntry));
+        uint32 sizeToWrite = writeSize;
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Write function.*/
+        ok = indexFile.Write(reinterpret_cast<const char8*>(seekIndex), writeSize);
+        if (ok) {
+            ok = (writeSize == sizeToWrite);
+        }
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(&header.magic[0], FILE_READER_SEEK_INDEX_MAGIC, static_cast<uint32>(sizeof(header.magic)));
+        header.numberOfCycles = seekNumberOfCycles;
+        header.dataStart = seekDataStart;
+        header.seekIndexStep = seekIndexStep;
+        header.xAxisSignalIdx = xAxisSignalIdx;
+        header.numberOfEntries = seekIndexSize;
+        header.numberOfBinaryBytes = numberOfBinaryBytes;
+    }
+    if (ok) {
+        ok = indexFile.Seek(0LLU);
+    }
+    if (ok) {
+        uint32 writeSize = static_cast<uint32>(sizeof(FileReaderSeekIndexHeader));
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Write function.*/
+        ok = indexFile.Write(reinterpret_cast<const char8*>(&header), writeSize);
+    }
+    if (indexFile.IsOpen()) {
+        ok = (indexFile.Close()) && (ok);
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::Warning, "Could not write the seek index file %s", seekIndexFilename.Buffer());
+    }
+}
+
+bool FileReader::ReadCycleXAxis(const uint64 cycle,
+                                uint64 &xAxisValue) {
+    uint32 xAxisByteSize = 0u;
+    bool ok = GetSignalByteSize(xAxisSignalIdx, xAxisByteSize);
+    if (ok) {
+        ok = (xAxisByteSize <= static_cast<uint32>(sizeof(uint64)));
+    }
+    //The value is copied as it may not be aligned in the file
+    uint64 value = 0u;
+    /*lint -e{613} offsets cannot be null as otherwise SetConfiguredDatabase would have failed.*/
+    uint64 position = (cycle * numberOfBinaryBytes) + offsets[xAxisSignalIdx];
+    if (ok) {
+        if ((preload) || (memoryMap)) {
+            ok = MemoryOperationsHelper::Copy(&value, &(allData.internalBuffer[position]), xAxisByteSize);
+        }
+        else {
+            ok = inputFile.Seek(seekDataStart + position);
+            if (ok) {
+                uint32 readSize = xAxisByteSize;
+                /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+                ok = inputFile.Read(reinterpret_cast<char8*>(&value), readSize);
+                if (ok) {
+                    ok = (readSize == xAxisByteSize);
+                }
+            }
+        }
+    }
+    if (ok) {
+        xAxisValue = FileReaderToUInt64(xAxisSignalType, &value);
+    }
+    return ok;
+}
+
+bool FileReader::FindSeekCycle(const uint64 xAxisValue,
+                               uint64 &cycle) {
+    //The last entry with a value smaller than the requested one
+    uint32 low = 0u;
+    uint32 high = seekIndexSize;
+    while ((high - low) > 1u) {
+        uint32 middle = low + ((high - low) / 2u);
+        if (seekIndex[middle].xAxisValue < xAxisValue) {
+            low = middle;
+        }
+        else {
+            high = middle;
+        }
+    }
+    cycle = seekIndex[low].cycle;
+    uint64 lastCycle = seekNumberOfCycles;
+    if (high < seekIndexSize) {
+        lastCycle = seekIndex[high].cycle;
+    }
+    bool csvStreaming = ((!preload) && (!memoryMap) && (fileFormat == FILE_FORMAT_CSV));
+    bool found = (seekIndex[low].xAxisValue >= xAxisValue);
+    bool ok = true;
+    if ((!found) && (csvStreaming)) {
+        ok = inputFile.Seek(seekIndex[low].offset);
+        csvDecoder.Reset();
+    }
+    //Scan the cycles between the two entries for the first value greater or equal to the requested one
+    while ((ok) && (!found) && (cycle < lastCycle)) {
+        uint64 value = 0u;
+        if (csvStreaming) {
+            char8 *line = NULL_PTR(char8*);
+            uint32 lineSize = 0u;
+            ok = csvDecoder.ReadLine(inputFile, line, lineSize);
+            if (ok) {
+                ok = csvDecoder.Decode(line, lineSize);
+            }
+            if (ok) {
+                /*lint -e{613} dataSourceMemory and offsets cannot be null as otherwise SetConfiguredDatabase would have failed.*/
+                value = FileReaderToUInt64(xAxisSignalType, &dataSourceMemory[offsets[xAxisSignalIdx]]);
+            }
+        }
+        else {
+            ok = ReadCycleXAxis(cycle, value);
+        }
+        if (ok) {
+            found = (value >= xAxisValue);
+            if (!found) {
+                cycle++;
+            }
+        }
+    }
+    //After the last value
+    if (cycle >= seekNumberOfCycles) {
+        cycle = seekNumberOfCycles - 1u;
+    }
+    return ok;
+}
+
+bool FileReader::SeekToCycle(const uint64 cycle) {
+    uint64 target = cycle;
+    if (target >= seekNumberOfCycles) {
+        target = seekNumberOfCycles - 1u;
+    }
+    bool ok = true;
+    if ((preload) || (memoryMap)) {
+        allData.interalBufferIdx = target * numberOfBinaryBytes;
+        if (memoryMap) {
+            ResetReadAhead();
+        }
+    }
+    else if (fileFormat == FILE_FORMAT_BINARY) {
+        ok = inputFile.Seek(seekDataStart + (target * numberOfBinaryBytes));
+    }
+    else {
+        //Move to the line of the closest entry and skip the remaining lines
+        const SeekIndexEntry &entry = seekIndex[target / seekIndexStep];
+        ok = inputFile.Seek(entry.offset);
+        csvDecoder.Reset();
+        for (uint64 c = entry.cycle; (c < target) && (ok); c++) {
+            char8 *line = NULL_PTR(char8*);
+            uint32 lineSize = 0u;
+            ok = csvDecoder.ReadLine(inputFile, line, lineSize);
+        }
+    }
+    if (ok) {
+        lastSeekCycle = target;
+    }
+    return ok;
+}
+
+bool FileReader::ApplySeek() {
+    bool isTime = false;
+    uint64 value = 0u;
+    bool ok = (seekMutex.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        isTime = seekRequestIsTime;
+        value = seekRequestValue;
+        seekRequested = false;
+        seekMutex.FastUnLock();
+    }
+    uint64 cycle = value;
+    if ((ok) && (isTime)) {
+        ok = FindSeekCycle(value, cycle);
+    }
+    if (ok) {
+        ok = SeekToCycle(cycle);
+    }
+    if (!ok) {
+        fatalFileError = true;
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to move to the requested cycle. No more attempts will be performed.");
+    }
+    return ok;
+}
+
+/*lint -e{1762} function cannot be constant as it is registered as an RPC for CLASS_METHOD_REGISTER*/
+ErrorManagement::ErrorType FileReader::SeekCycle(const uint64 cycle) {
+    ErrorManagement::ErrorType err(seekIndexSize > 0u);
+    if (err.ErrorsCleared()) {
+        err = seekMutex.FastLock();
+    }
+    if (err.ErrorsCleared()) {
+        seekRequestIsTime = false;
+        seekRequestValue = cycle;
+        seekRequested = true;
+        seekMutex.FastUnLock();
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::IllegalOperation, "SeekCycle requires SeekIndexStep > 0");
+    }
+    return err;
+}
+
+/*lint -e{1762} function cannot be constant as it is registered as an RPC for CLASS_METHOD_REGISTER*/
+ErrorManagement::ErrorType FileReader::SeekTime(const uint64 xAxisValue) {
+    ErrorManagement::ErrorType err(seekIndexSize > 0u);
+    if (err.ErrorsCleared()) {
+        err = seekMutex.FastLock();
+    }
+    if (err.ErrorsCleared()) {
+        seekRequestIsTime = true;
+        seekRequestValue = xAxisValue;
+        seekRequested = true;
+        seekMutex.FastUnLock();
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::IllegalOperation, "SeekTime requires SeekIndexStep > 0");
+    }
+    return err;
+}
+
+ErrorManagement::ErrorType FileReader::CloseFile() {
+    ErrorManagement::ErrorType err;
+    //The prefetch thread reads from the file
+    if (prefetchExecutor.GetStatus() != EmbeddedThreadI::OffState) {
+        if (!prefetchExecutor.Stop()) {
+            if (!prefetchExecutor.Stop()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the prefetch thread");
+            }
+        }
+    }
+    if (inputFile.IsOpen()) {
+        err = !inputFile.Close();
+    }
+    return err;
+}
+
+const StreamString& FileReader::GetFilename() const {
     return filename;
 }
 
@@ -992,8 +2322,46 @@ uint64 FileReader::GetInterpolationPeriod() const {
     return interpolationPeriod;
 }
 
+bool FileReader::IsMemoryMap() const {
+    return memoryMap;
+}
+
+uint64 FileReader::GetReadAheadSize() const {
+    return readAheadSize;
+}
+
+uint32 FileReader::GetCSVBufferSize() const {
+    return csvBufferSize;
+}
+
+bool FileReader::IsCSVCache() const {
+    return csvCache;
+}
+
+uint32 FileReader::GetPrefetchCycles() const {
+    return prefetchCycles;
+}
+
+uint64 FileReader::GetNumberOfPrefetchStalls() const {
+    return numberOfPrefetchStalls;
+}
+
+uint32 FileReader::GetSeekIndexStep() const {
+    return seekIndexStep;
+}
+
+uint32 FileReader::GetSeekIndexSize() const {
+    return seekIndexSize;
+}
+
+uint64 FileReader::GetLastSeekCycle() const {
+    return lastSeekCycle;
+}
+
 CLASS_REGISTER(FileReader, "1.0")
 CLASS_METHOD_REGISTER(FileReader, CloseFile)
+CLASS_METHOD_REGISTER(FileReader, SeekCycle)
+CLASS_METHOD_REGISTER(FileReader, SeekTime)
 
 }
 
@@ -32,11 +32,18 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "FastPollingMutexSem.h"
 #include "File.h"
-#include "MemoryMapInterpolatedInputBroker.h"
+#include "FileColumnChunk.h"
+#include "FileFrameCodec.h"
+#include "FileReaderCSVDecoder.h"
+#include "FileReaderInterpolatedInputBroker.h"
 #include "MessageI.h"
 #include "ProcessorType.h"
 #include "RegisteredMethodsMessageFilter.h"
+#include "SingleThreadService.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -53,6 +60,11 @@ namespace MARTe {
  *  definitions is further separated by the CSVSeparator. e.g."#Trigger (uint8)[1];Time (uint32)[1];SignalUInt8 (uint8)[1];SignalUInt16 (uint16)[4]"
  * A new line is expected after all signal samples have been written for any time instant.
  * Arrays are encoded inside brackets as per BufferedStreamI::PrintFormatted. e.g.""1;2000000;{2,2,2,2}"
+ * The lines are read in blocks of CSVBufferSize bytes and decoded in place (see FileReaderCSVDecoder).
+ *
+ * If CSVCache = "yes" (only for csv files with Preload = "yes") the decoded data is stored in a binary sidecar file (the Filename followed by
+ * ".cache") the first time the file is loaded. The next loads read the sidecar directly, as long as the csv file keeps the same size and
+ * modification time and the signals the same size.
  *
  * Strings shall be expressed with the type char8 or string with the number of elements defining the maximum string length (including the \0 terminator).
  * Arrays of strings are not currently supported.
@@ -62,13 +74,40 @@ namespace MARTe {
  *  by exactly 32 bytes to encode the signal name, followed by 4 bytes which store the number of elements of a given signal.
  *  Following the header, the signal samples are consecutively stored in binary format.
  *
- * This DataSourceI has the function CloseFile registered as an RPCs.
+ * The binary files written by the FileWriter with Compression != none are detected (the data after the header starts with a frame
+ * header, see FileFrameCodec) and their frames are decompressed as they are read (or all at once if Preload = "yes"). The binary files
+ * written with Layout = columnar (the data after the header, or of each frame, is a columnar chunk, see FileColumnChunk) are transposed
+ * back into cycles in the same way.
+ *
+ * If MemoryMap = "yes" (only for uncompressed binary files with the row layout and Preload = "no") the file is mapped in memory and each
+ * cycle is copied from the mapping by Synchronise, without any read system call. The ReadAheadSize bytes after the cycle being read
+ * are kept ahead of the read cursor: when the cursor reaches the middle of this window the next half is prefetched (madvise MADV_WILLNEED)
+ * and, if LockReadAhead = 1, the half prefetched before is locked in memory (mlock) while the pages already read are unlocked.
+ *
+ * If PrefetchCycles > 0 (only for uncompressed binary files with the row layout, Preload = "no" and MemoryMap = "no") a prefetch thread reads
+ * the file ahead, PrefetchCycles cycles at a time, into a ring of NumberOfPrefetchBuffers buffers, and Synchronise only copies the next cycle
+ * from the oldest filled buffer (waiting only if the thread fell behind). With EOF = "Rewind" the thread wraps around to the first cycle
+ * itself. This does not depend on the page cache readahead and thus also suits network filesystems.
+ *
+ * If SeekIndexStep > 0 a sparse index with the XAxisSignal value and the file offset of one every SeekIndexStep cycles is built when the
+ * file is configured (or loaded from the Filename followed by ".seek" if SeekIndexCache = "yes" and the file did not change since the index
+ * was stored). The replay can then be moved with the SeekCycle (to a given cycle) and SeekTime (to the first cycle with an XAxisSignal value
+ * greater or equal than the given value, found with a binary search on the index followed by a scan of at most SeekIndexStep cycles) RPCs.
+ * The requests are only stored by the RPCs and applied by the next Synchronise, so that they never race with the real-time thread.
+ * The XAxisSignal is expected to be monotonic. Seeking is supported for csv files and for binary files which are preloaded, mapped in memory
+ * or read with the row layout without compression (i.e. not with PrefetchCycles > 0).
+ *
+ * This DataSourceI has the functions CloseFile, SeekCycle and SeekTime registered as RPCs.
  *
  * Only one and one GAM is allowed to read from this DataSourceI.
  *
  * If any of the signals reading from this DataSourceI asks for a Frequency > 0, the InterpolationPeriod
  * defined below will be ignored and replaced by Frequency * 1e9 and the XAxisSignal will be replaced by this signal name.
  *
+ * If Interpolate = "yes" the signals are interpolated by the FileReaderInterpolatedInputBroker, which converts each row once and interpolates
+ * all the numeric elements in a single (SIMD) pass. The GAM signals may then have more than one sample: each cycle receives that number of
+ * consecutive interpolated values (i.e. the InterpolationPeriod may be shorter than the GAM cycle).
+ *
  * The configuration syntax is (names are only given as an example):
  * <pre>
  * +FileReader_0 = {
@@ -77,11 +116,22 @@ namespace MARTe {
  *     Interpolate = "yes" //Compulsory. If "yes" the data will be interpolated and an XAxisSignal  signal shall be provided. If set to "no" the data will be provided as is.
  *     FileFormat = "binary" //Compulsory. Possible values are: binary and csv.
  *     CSVSeparator = "," //Compulsory if Format=csv. Sets the file separator type.
- *     XAxisSignal = "Time" //Compulsory if Interpolate = "yes" and none of the signals interacting with this FileReader has Frequency > 0. Name of the signal containing the independent variable to generate the interpolation samples.
+ *     CSVBufferSize = 1048576 //Optional. Only meaningful if Format=csv. Initial size of the read buffer (it grows if a line does not fit). Default = 1 MB.
+ *     CSVCache = "yes" //Optional. Default no. Only for Format=csv and Preload = "yes". If set the decoded data is cached in a binary sidecar file.
+ *     XAxisSignal = "Time" //Compulsory if Interpolate = "yes" (and none of the signals interacting with this FileReader has Frequency > 0) or if SeekIndexStep > 0. Name of the signal containing the independent variable to generate the interpolation samples.
  *     InterpolationPeriod = 1000 //Compulsory if Interpolate = "yes" and none of the signals interacting with this FileReader has Frequency > 0. InterpolatedXAxisSignal += InterpolationPeriod. It will be read as an uint64.
  *     EOF = "Rewind" //Optional behaviour to have when reaching the end of the file. If not set EOF = "Rewind". Possible options are: "Error", "Rewind" and "Last". If "Rewind" the file will be read from the start; if "Error" an error will be issues when EOF is reached; if "Last" the last read values are sent.
  *     Preload = "yes" //Optional. Default no. If set the file is load in memory when configuring.
  *     MaxFileByteSize = 1000000 //Optional. Default 4 GB. The maximum data file size to be loaded in Bytes.
+ *     MemoryMap = "yes" //Optional. Default no. Only for binary files (not compressed or columnar) and Preload = "no". If set the file is mapped in memory.
+ *     ReadAheadSize = 16777216 //Optional. Only meaningful if MemoryMap = "yes". Number of bytes to keep prefetched ahead of the read cursor. Default = 16 MB.
+ *     LockReadAhead = 1 //Optional. Only meaningful if MemoryMap = "yes". If 1 the prefetched pages are locked in memory. Default = 0.
+ *     PrefetchCycles = 10000 //Optional. Only for binary files (not compressed or columnar), Preload = "no" and MemoryMap = "no". Number of cycles read at a time by the prefetch thread. Default = 0 (no prefetch thread).
+ *     NumberOfPrefetchBuffers = 2 //Optional. Only meaningful if PrefetchCycles > 0. Number of buffers in the ring (at least 2). Default = 2.
+ *     CPUMask = 0x2 //Optional. Only meaningful if PrefetchCycles > 0. Affinity of the prefetch thread. Default = 0xFF.
+ *     StackSize = 1048576 //Optional. Only meaningful if PrefetchCycles > 0. Stack size of the prefetch thread. Default = THREADS_DEFAULT_STACKSIZE.
+ *     SeekIndexStep = 1000 //Optional. Number of cycles between the entries of the seek index. Default = 0 (no index and the SeekCycle and SeekTime RPCs fail).
+ *     SeekIndexCache = "yes" //Optional. Default no. Only meaningful if SeekIndexStep > 0. If set the seek index is stored in (and loaded from) a sidecar file.
  *     //All the signals are automatically added against the information stored in the header of the input file (format described above).
  *     +Messages = { //Optional. If set a message will be fired every time one of the events below occur
  *         Class = ReferenceContainer
@@ -96,7 +146,7 @@ namespace MARTe {
  * }
  * </pre>
  */
-class FileReader: public DataSourceI, public MessageI {
+class FileReader: public DataSourceI, public MessageI, public EmbeddedServiceMethodBinderI {
 public:CLASS_REGISTER_DECLARATION()
 
     /**
@@ -136,14 +186,14 @@ public:CLASS_REGISTER_DECLARATION()
     /**
      * @brief See DataSourceI::GetBrokerName.
      * @details Only InputSignals are supported.
-     * @return MemoryMapSynchronisedInputBroker if interpolate = false, MemoryMapInterpolatedInputBroker otherwise.
+     * @return MemoryMapSynchronisedInputBroker if interpolate = false, FileReaderInterpolatedInputBroker otherwise.
      */
     virtual const char8* GetBrokerName(StructuredDataI &data,
                                        const SignalDirection direction);
 
     /**
      * @brief See DataSourceI::GetInputBrokers.
-     * @details If interpolate == yes adds a MemoryMapInterpolatedInputBroker instance to
+     * @details If interpolate == yes adds a FileReaderInterpolatedInputBroker instance to
      *  the inputBrokers, otherwise adds a MemoryMapSynchronisedInputBroker instance to the intputBrokers.
      * @pre
      *   GetNumberOfFunctions() == 1u
@@ -166,6 +216,15 @@ public:CLASS_REGISTER_DECLARATION()
      */
     virtual bool Synchronise();
 
+    /**
+     * @brief Fills (in the prefetch thread) the free buffers of the ring with the next cycles of the file.
+     * @details Waits for a free buffer if all the buffers are filled, and wraps around to the first cycle at the end of the file if
+     * EOF = "Rewind". After the last cycle is queued with other EOF values, no more buffers are filled.
+     * @param[in] info see EmbeddedServiceMethodBinderI.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo & info);
+
     /**
      * @brief See DataSourceI::PrepareNextState. NOOP.
      * @return true.
@@ -185,7 +244,7 @@ public:CLASS_REGISTER_DECLARATION()
      *  are valid and consistent with the parameters set during the initialisation phase.
      * In particular the following conditions shall be met:
      * - If relevant, the XAxisSignal shall exist and shall have at most one element.
-     * - The number of samples of all the signals is one.
+     * - The number of samples of all the signals is one (unless Interpolate = "yes").
      * - At least one signal is set.
      * @return true if all the parameters are valid and if the file can be successfully opened.
      */
@@ -197,6 +256,24 @@ public:CLASS_REGISTER_DECLARATION()
      */
     ErrorManagement::ErrorType CloseFile();
 
+    /**
+     * @brief Requests the replay to continue from a given cycle. Function is registered as an RPC.
+     * @details The request is applied by the next Synchronise (cycles after the last one move to the last one).
+     * @param[in] cycle the index of the cycle (the first cycle after the header is 0).
+     * @return ErrorManagement::NoError if the seek index was built.
+     */
+    ErrorManagement::ErrorType SeekCycle(const uint64 cycle);
+
+    /**
+     * @brief Requests the replay to continue from the first cycle with an XAxisSignal value greater or equal than xAxisValue. Function is
+     * registered as an RPC.
+     * @details The request is applied by the next Synchronise (the search is done there). If all the values are smaller the replay
+     * continues from the last cycle.
+     * @param[in] xAxisValue the value of the XAxisSignal (converted to uint64 as for the interpolation).
+     * @return ErrorManagement::NoError if the seek index was built.
+     */
+    ErrorManagement::ErrorType SeekTime(const uint64 xAxisValue);
+
     /**
      * @brief Gets the configured filename.
      * @return the configured filename.
@@ -233,6 +310,60 @@ public:CLASS_REGISTER_DECLARATION()
      */
     uint64 GetInterpolationPeriod() const;
 
+    /**
+     * @brief Returns true if MemoryMap = "yes".
+     * @return true if the file is to be mapped in memory.
+     */
+    bool IsMemoryMap() const;
+
+    /**
+     * @brief Returns the ReadAheadSize value.
+     * @return the number of bytes to keep prefetched ahead of the read cursor.
+     */
+    uint64 GetReadAheadSize() const;
+
+    /**
+     * @brief Returns the CSVBufferSize value.
+     * @return the initial size of the csv read buffer.
+     */
+    uint32 GetCSVBufferSize() const;
+
+    /**
+     * @brief Returns true if CSVCache = "yes".
+     * @return true if the decoded csv data is cached in a binary sidecar file.
+     */
+    bool IsCSVCache() const;
+
+    /**
+     * @brief Returns the PrefetchCycles value.
+     * @return the number of cycles read at a time by the prefetch thread (0 if there is no prefetch thread).
+     */
+    uint32 GetPrefetchCycles() const;
+
+    /**
+     * @brief Returns the number of times that Synchronise had to wait for the prefetch thread.
+     * @return the number of times that no prefetched buffer was ready.
+     */
+    uint64 GetNumberOfPrefetchStalls() const;
+
+    /**
+     * @brief Returns the SeekIndexStep value.
+     * @return the number of cycles between the entries of the seek index.
+     */
+    uint32 GetSeekIndexStep() const;
+
+    /**
+     * @brief Returns the number of entries of the seek index.
+     * @return the number of entries of the seek index (0 if it was not built).
+     */
+    uint32 GetSeekIndexSize() const;
+
+    /**
+     * @brief Returns the cycle where the last seek moved the replay to.
+     * @return the cycle where the last seek moved the replay to.
+     */
+    uint64 GetLastSeekCycle() const;
+
 private:
 
     /**
@@ -328,9 +459,20 @@ private:
     File inputFile;
 
     /**
-     * The signal memory as an AnyType array optimised for reading the data.
+     * Reads and decodes the csv lines into the signal memory.
+     */
+    FileReaderCSVDecoder csvDecoder;
+
+    /**
+     * The CSVBufferSize parameter.
+     */
+    uint32 csvBufferSize;
+
+    /**
+     * The CSVCache parameter and the name of the sidecar file.
      */
-    AnyType *signalsAnyType;
+    bool csvCache;
+    StreamString csvCacheFilename;
 
     /**
      * Filter to receive the RPC which allows to the handle the file with messages.
@@ -340,7 +482,7 @@ private:
     /**
      * The asynchronous triggered broker that provides the interface between the GAMs and the output file.
      */
-    MemoryMapInterpolatedInputBroker *interpolatedInputBroker;
+    FileReaderInterpolatedInputBroker *interpolatedInputBroker;
 
     /**
      * The message to send if there is a runtime error.
@@ -398,6 +540,296 @@ private:
 
     bool ReadLineCSVFormat();
 
+    /**
+     * @brief Checks if the csv sidecar file exists and matches the csv file and the signals and, if so, sets the allData.dataFileByteSize.
+     * @return true if the sidecar file can be loaded (otherwise the csv file is to be decoded).
+     */
+    bool CheckCSVCache();
+
+    /**
+     * @brief Reads the decoded data from the csv sidecar file into the allData.internalBuffer.
+     * @return true if all the data was read.
+     */
+    bool ReadCSVCache();
+
+    /**
+     * @brief Stores the allData.internalBuffer in the csv sidecar file (a failure is only reported as a warning).
+     */
+    void SaveCSVCache();
+
+    /**
+     * @brief Reads (and decompresses and/or transposes) the next frame or columnar chunk of a binary file into frameData.
+     * @return true if the frame or chunk is valid and holds complete cycles.
+     */
+    bool ReadFrame();
+
+    /**
+     * @brief Copies the next cycle of a compressed or columnar binary file into the dataSourceMemory (reading the next frame if required).
+     * @return true if the cycle was read.
+     */
+    bool ReadFramedCycle();
+
+    /**
+     * @brief Computes the number of bytes of the cycles of a compressed or columnar binary file (reading only the frame and chunk headers).
+     * @param[out] size the number of bytes of all the cycles in the frames or chunks.
+     * @return true if all the frame and chunk headers are valid.
+     */
+    bool GetDecompressedSize(uint64 &size);
+
+    /**
+     * @brief Maps the file in memory and points the allData.internalBuffer to the data after the header.
+     * @param[in] headerSize the size of the binary header.
+     * @return true if the file could be mapped.
+     */
+    bool MapFile(const uint32 headerSize);
+
+    /**
+     * @brief Prefetches (and locks) the next half of the read ahead window if the read cursor reached its middle.
+     */
+    void AdvanceReadAhead();
+
+    /**
+     * @brief Unlocks the read ahead window and restarts it from the read cursor (e.g. after a rewind).
+     */
+    void ResetReadAhead();
+
+    /**
+     * The MemoryMap, ReadAheadSize and LockReadAhead parameters.
+     */
+    bool memoryMap;
+    uint64 readAheadSize;
+    bool lockReadAhead;
+
+    /**
+     * The mapping of the file and its size.
+     */
+    char8 *mapBase;
+    uint64 mapSize;
+
+    /**
+     * Offset (in the file) of the first cycle.
+     */
+    uint64 mapDataStart;
+
+    /**
+     * Half of the read ahead window (a multiple of the page size).
+     */
+    uint64 readAheadStep;
+
+    /**
+     * The part of the file (offsets in the file) which was locked (or only prefetched if LockReadAhead = 0).
+     */
+    uint64 readAheadStart;
+    uint64 readAheadEnd;
+
+    /**
+     * @brief Reads (in the prefetch thread) the next cycles of the file into a buffer of the ring.
+     * @param[in] idx the index of the buffer.
+     * @param[out] endOfFile true if the end of the file was reached and EOF != "Rewind".
+     * @return true if the file could be read.
+     */
+    bool FillPrefetchBuffer(const uint32 idx,
+                            bool &endOfFile);
+
+    /**
+     * @brief Waits until a prefetched buffer is ready (or the prefetch thread reached the end of the file).
+     * @param[out] endOfData true if all the prefetched cycles were read and the prefetch thread reached the end of the file.
+     * @return true if the prefetch thread is running.
+     */
+    bool WaitPrefetchBuffer(bool &endOfData);
+
+    /**
+     * @brief Copies the next prefetched cycle into the dataSourceMemory and hands the buffer back to the thread when it was fully read.
+     * @return true if a prefetched buffer was ready.
+     */
+    bool ReadPrefetchedCycle();
+
+    /**
+     * The PrefetchCycles, NumberOfPrefetchBuffers, CPUMask and StackSize parameters.
+     */
+    uint32 prefetchCycles;
+    uint32 numberOfPrefetchBuffers;
+    ProcessorType cpuMask;
+    uint32 stackSize;
+
+    /**
+     * The ring of prefetched buffers, the number of bytes in each buffer and the size of each buffer.
+     */
+    char8 **prefetchBuffers;
+    uint32 *prefetchBytes;
+    uint32 prefetchBufferSize;
+
+    /**
+     * Number of filled buffers (written by both threads).
+     */
+    volatile int32 prefetchReady;
+
+    /**
+     * Set by the prefetch thread after queueing the last buffer (EOF != "Rewind") or on a read error.
+     */
+    volatile bool prefetchEnd;
+
+    /**
+     * The next buffer to be filled (prefetch thread), the next buffer to be read and the offset of the next cycle in it (Synchronise).
+     */
+    uint32 prefetchFillIndex;
+    uint32 prefetchReadIndex;
+    uint32 prefetchReadOffset;
+
+    /**
+     * Offset (in the file) of the first cycle.
+     */
+    uint64 prefetchDataStart;
+
+    /**
+     * Number of times that Synchronise had to wait for the prefetch thread.
+     */
+    uint64 numberOfPrefetchStalls;
+
+    /**
+     * Posted when a buffer is filled and when a buffer is freed.
+     */
+    EventSem prefetchReadySem;
+    EventSem prefetchFreeSem;
+
+    /**
+     * The prefetch thread.
+     */
+    SingleThreadService prefetchExecutor;
+
+    /**
+     * True if the binary file is compressed.
+     */
+    bool compressed;
+
+    /**
+     * True if the (uncompressed) binary file is made of columnar chunks.
+     */
+    bool columnar;
+
+    /**
+     * Transposes the columnar chunks into cycles.
+     */
+    FileColumnChunk columnChunk;
+
+    /**
+     * The cycles transposed from the last columnar chunk (swapped with frameData) and the size of this buffer.
+     */
+    char8 *frameChunk;
+    uint32 frameChunkSize;
+
+    /**
+     * The last compressed frame read, its decompressed data and the size of these buffers.
+     */
+    char8 *frameCompressed;
+    uint32 frameCompressedSize;
+    char8 *frameData;
+    uint32 frameDataSize;
+
+    /**
+     * Number of bytes in frameData and index of the next cycle in frameData.
+     */
+    uint32 frameBytes;
+    uint32 frameIdx;
+
+    /**
+     * @brief An entry of the seek index.
+     */
+    struct SeekIndexEntry {
+        /**
+         * The XAxisSignal value of the cycle.
+         */
+        uint64 xAxisValue;
+        /**
+         * The index of the cycle.
+         */
+        uint64 cycle;
+        /**
+         * The offset of the cycle in the file (or in the allData.internalBuffer if the data is in memory).
+         */
+        uint64 offset;
+    };
+
+    /**
+     * @brief Builds (or loads) the seek index.
+     * @return true if the seek index is supported for the configured file and it could be built.
+     */
+    bool BuildSeekIndex();
+
+    /**
+     * @brief Loads the seek index from its sidecar file.
+     * @return true if the sidecar file exists and matches the file and the signals.
+     */
+    bool LoadSeekIndex();
+
+    /**
+     * @brief Stores the seek index in its sidecar file (a failure is only reported as a warning).
+     */
+    void SaveSeekIndex();
+
+    /**
+     * @brief Reads the XAxisSignal value of a cycle (only if the data is in memory or in a binary file).
+     * @param[in] cycle the index of the cycle.
+     * @param[out] xAxisValue the XAxisSignal value of the cycle.
+     * @return true if the cycle could be read.
+     */
+    bool ReadCycleXAxis(const uint64 cycle,
+                        uint64 &xAxisValue);
+
+    /**
+     * @brief Finds the first cycle with an XAxisSignal value greater or equal than xAxisValue.
+     * @param[in] xAxisValue the XAxisSignal value to search.
+     * @param[out] cycle the cycle found (the last cycle if all the values are smaller).
+     * @return true if the cycles could be read.
+     */
+    bool FindSeekCycle(const uint64 xAxisValue,
+                       uint64 &cycle);
+
+    /**
+     * @brief Moves the replay to a cycle.
+     * @param[in] cycle the index of the cycle.
+     * @return true if the file could be positioned.
+     */
+    bool SeekToCycle(const uint64 cycle);
+
+    /**
+     * @brief Applies (in Synchronise) the last seek requested.
+     * @return true if the replay could be moved.
+     */
+    bool ApplySeek();
+
+    /**
+     * The SeekIndexStep and SeekIndexCache parameters and the name of the sidecar file.
+     */
+    uint32 seekIndexStep;
+    bool seekIndexCache;
+    StreamString seekIndexFilename;
+
+    /**
+     * The seek index and its number of entries.
+     */
+    SeekIndexEntry *seekIndex;
+    uint32 seekIndexSize;
+
+    /**
+     * The number of cycles and the offset of the first cycle in the file.
+     */
+    uint64 seekNumberOfCycles;
+    uint64 seekDataStart;
+
+    /**
+     * Protects the last seek requested, which is either a cycle or a XAxisSignal value.
+     */
+    FastPollingMutexSem seekMutex;
+    volatile bool seekRequested;
+    bool seekRequestIsTime;
+    uint64 seekRequestValue;
+
+    /**
+     * The cycle where the last seek moved the replay to.
+     */
+    uint64 lastSeekCycle;
+
 };
 }
 
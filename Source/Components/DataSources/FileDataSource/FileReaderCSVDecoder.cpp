@@ -0,0 +1,671 @@
+/**
+ * @file FileReaderCSVDecoder.cpp
+ * @brief Source file for class FileReaderCSVDecoder
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FileReaderCSVDecoder (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <string.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AnyType.h"
+#include "FileReaderCSVDecoder.h"
+#include "MemoryOperationsHelper.h"
+#include "TypeConversion.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Maximum number of characters of a value which is converted with the C library or with TypeConvert.
+ */
+static const uint32 CSV_MAX_TOKEN_SIZE = 128u;
+
+/**
+ * Maximum number of significant digits kept in the mantissa (more do not fit in an uint64).
+ */
+static const uint32 CSV_MAX_MANTISSA_DIGITS = 19u;
+
+/**
+ * The powers of ten which are exact in a float64.
+ */
+static const float64 CSV_POWERS_OF_TEN[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18,
+        1e19, 1e20, 1e21, 1e22 };
+
+/**
+ * @brief Checks if the character is a space.
+ */
+static inline bool CSVIsSpace(const char8 c) {
+    return (c == ' ') || (c == '\t') || (c == '\r');
+}
+
+/**
+ * @brief Checks if the character is a decimal digit.
+ */
+static inline bool CSVIsDigit(const char8 c) {
+    return (c >= '0') && (c <= '9');
+}
+
+/**
+ * @brief Parses a decimal unsigned integer (with an optional + sign) which uses all the characters [start, end[.
+ * @return true if the value is valid and does not overflow an uint64.
+ */
+static bool CSVParseUnsigned(const char8 *start,
+                             const char8 * const end,
+                             uint64 &value) {
+    value = 0u;
+    if (start < end) {
+        if (*start == '+') {
+            start++;
+        }
+    }
+    bool ok = (start < end);
+    const uint64 maxValue = 0xFFFFFFFFFFFFFFFFu;
+    while ((start < end) && (ok)) {
+        ok = CSVIsDigit(*start);
+        if (ok) {
+            uint64 digit = static_cast<uint64>(*start - '0');
+            ok = (value <= ((maxValue - digit) / 10u));
+            if (ok) {
+                value = (value * 10u) + digit;
+            }
+        }
+        start++;
+    }
+    return ok;
+}
+
+/**
+ * @brief Parses a decimal signed integer which uses all the characters [start, end[.
+ * @return true if the value is valid and does not overflow an int64.
+ */
+static bool CSVParseSigned(const char8 *start,
+                           const char8 * const end,
+                           int64 &value) {
+    bool negative = false;
+    if (start < end) {
+        negative = (*start == '-');
+        if (negative) {
+            start++;
+        }
+    }
+    uint64 magnitude = 0u;
+    bool ok = CSVParseUnsigned(start, end, magnitude);
+    if ((ok) && (negative)) {
+        ok = (magnitude <= 0x8000000000000000u);
+        if (ok) {
+            //Also valid for the most negative value
+            value = (magnitude == 0u) ? 0 : (-static_cast<int64>(magnitude - 1u) - 1);
+        }
+    }
+    else if (ok) {
+        ok = (magnitude <= 0x7FFFFFFFFFFFFFFFu);
+        if (ok) {
+            value = static_cast<int64>(magnitude);
+        }
+    }
+    else {
+        //NOOP
+    }
+    return ok;
+}
+
+/**
+ * @brief Splits a decimal float which uses all the characters [start, end[ into sign, mantissa and decimal exponent.
+ * @param[out] exact false if the mantissa had more than CSV_MAX_MANTISSA_DIGITS significant digits (and was truncated).
+ * @return true if the value is a valid decimal float.
+ */
+static bool CSVSplitFloat(const char8 *start,
+                          const char8 * const end,
+                          bool &negative,
+                          uint64 &mantissa,
+                          int32 &exponent,
+                          bool &exact) {
+    negative = false;
+    mantissa = 0u;
+    exponent = 0;
+    exact = true;
+    if (start < end) {
+        negative = (*start == '-');
+        if ((negative) || (*start == '+')) {
+            start++;
+        }
+    }
+    uint32 nDigits = 0u;
+    bool anyDigit = false;
+    while ((start < end) && (CSVIsDigit(*start))) {
+        anyDigit = true;
+        if (nDigits < CSV_MAX_MANTISSA_DIGITS) {
+            mantissa = (mantissa * 10u) + static_cast<uint64>(*start - '0');
+            if (mantissa > 0u) {
+                nDigits++;
+            }
+        }
+        else {
+            exact = exact && (*start == '0');
+            exponent++;
+        }
+        start++;
+    }
+    if (start < end) {
+        if (*start == '.') {
+            start++;
+            while ((start < end) && (CSVIsDigit(*start))) {
+                anyDigit = true;
+                if (nDigits < CSV_MAX_MANTISSA_DIGITS) {
+                    mantissa = (mantissa * 10u) + static_cast<uint64>(*start - '0');
+                    if (mantissa > 0u) {
+                        nDigits++;
+                    }
+                    exponent--;
+                }
+                else {
+                    exact = exact && (*start == '0');
+                }
+                start++;
+            }
+        }
+    }
+    bool ok = anyDigit;
+    if ((ok) && (start < end)) {
+        ok = ((*start == 'e') || (*start == 'E'));
+        if (ok) {
+            start++;
+            bool negativeExponent = false;
+            if (start < end) {
+                negativeExponent = (*start == '-');
+                if ((negativeExponent) || (*start == '+')) {
+                    start++;
+                }
+            }
+            ok = (start < end);
+            int32 value = 0;
+            while ((start < end) && (ok)) {
+                ok = CSVIsDigit(*start);
+                //Larger exponents are anyway out of range
+                if ((ok) && (value < 100000)) {
+                    value = (value * 10) + static_cast<int32>(*start - '0');
+                }
+                start++;
+            }
+            exponent += negativeExponent ? -value : value;
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Copies the value [start, end[ into a zero terminated buffer.
+ * @return true if the value fits in the buffer.
+ */
+static bool CSVCopyToken(const char8 * const start,
+                         const char8 * const end,
+                         char8 * const token) {
+    uint32 size = static_cast<uint32>(end - start);
+    bool ok = (size < CSV_MAX_TOKEN_SIZE);
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(token, start, size);
+        token[size] = '\0';
+    }
+    return ok;
+}
+
+/**
+ * @brief Parses a decimal float64 which uses all the characters [start, end[.
+ * @details A mantissa smaller than 2^53 and a decimal exponent in [-22, 22] are both exact in a float64, so that the single
+ * multiplication or division is correctly rounded. The other values are converted with strtod.
+ * @return true if the value is a valid decimal float.
+ */
+static bool CSVParseFloat64(const char8 * const start,
+                            const char8 * const end,
+                            float64 &value) {
+    bool negative;
+    uint64 mantissa;
+    int32 exponent;
+    bool exact;
+    bool ok = CSVSplitFloat(start, end, negative, mantissa, exponent, exact);
+    if (ok) {
+        if ((exact) && (mantissa <= 9007199254740992u) && (exponent >= -22) && (exponent <= 22)) {
+            value = static_cast<float64>(mantissa);
+            if (exponent < 0) {
+                value /= CSV_POWERS_OF_TEN[-exponent];
+            }
+            else {
+                value *= CSV_POWERS_OF_TEN[exponent];
+            }
+            if (negative) {
+                value = -value;
+            }
+        }
+        else {
+            char8 token[CSV_MAX_TOKEN_SIZE];
+            ok = CSVCopyToken(start, end, &token[0]);
+            if (ok) {
+                value = strtod(&token[0], NULL_PTR(char8 **));
+            }
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Parses a decimal float32 which uses all the characters [start, end[.
+ * @details As CSVParseFloat64 with a mantissa smaller than 2^24 and a decimal exponent in [-10, 10] (exact in a float32). The other
+ * values are converted with strtof.
+ * @return true if the value is a valid decimal float.
+ */
+static bool CSVParseFloat32(const char8 * const start,
+                            const char8 * const end,
+                            float32 &value) {
+    bool negative;
+    uint64 mantissa;
+    int32 exponent;
+    bool exact;
+    bool ok = CSVSplitFloat(start, end, negative, mantissa, exponent, exact);
+    if (ok) {
+        if ((exact) && (mantissa <= 16777216u) && (exponent >= -10) && (exponent <= 10)) {
+            value = static_cast<float32>(mantissa);
+            if (exponent < 0) {
+                value /= static_cast<float32>(CSV_POWERS_OF_TEN[-exponent]);
+            }
+            else {
+                value *= static_cast<float32>(CSV_POWERS_OF_TEN[exponent]);
+            }
+            if (negative) {
+                value = -value;
+            }
+        }
+        else {
+            char8 token[CSV_MAX_TOKEN_SIZE];
+            ok = CSVCopyToken(start, end, &token[0]);
+            if (ok) {
+                value = strtof(&token[0], NULL_PTR(char8 **));
+            }
+        }
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+FileReaderCSVDecoder::FileReaderCSVDecoder() {
+    types = NULL_PTR(TypeDescriptor *);
+    addresses = NULL_PTR(char8 **);
+    numberOfElements = NULL_PTR(uint32 *);
+    isArray = NULL_PTR(bool *);
+    numberOfSignals = 0u;
+    buffer = NULL_PTR(char8 *);
+    bufferSize = 0u;
+    bufferStart = 0u;
+    bufferEnd = 0u;
+    errorSignal = 0u;
+}
+
+FileReaderCSVDecoder::~FileReaderCSVDecoder() {
+    if (types != NULL_PTR(TypeDescriptor *)) {
+        delete[] types;
+    }
+    if (addresses != NULL_PTR(char8 **)) {
+        delete[] addresses;
+    }
+    if (numberOfElements != NULL_PTR(uint32 *)) {
+        delete[] numberOfElements;
+    }
+    if (isArray != NULL_PTR(bool *)) {
+        delete[] isArray;
+    }
+    if (buffer != NULL_PTR(char8 *)) {
+        delete[] buffer;
+    }
+}
+
+bool FileReaderCSVDecoder::SetNumberOfSignals(const uint32 numberOfSignalsIn) {
+    bool ok = (numberOfSignalsIn > 0u) && (types == NULL_PTR(TypeDescriptor *));
+    if (ok) {
+        numberOfSignals = numberOfSignalsIn;
+        types = new TypeDescriptor[numberOfSignals];
+        addresses = new char8*[numberOfSignals];
+        numberOfElements = new uint32[numberOfSignals];
+        isArray = new bool[numberOfSignals];
+        for (uint32 n = 0u; n < numberOfSignals; n++) {
+            addresses[n] = NULL_PTR(char8 *);
+            numberOfElements[n] = 0u;
+            isArray[n] = false;
+        }
+    }
+    return ok;
+}
+
+bool FileReaderCSVDecoder::SetSignal(const uint32 signalIdx,
+                                     const TypeDescriptor &type,
+                                     void * const address,
+                                     const uint32 numberOfElementsIn,
+                                     const bool isArrayIn) {
+    bool ok = (signalIdx < numberOfSignals) && (address != NULL_PTR(void *)) && (numberOfElementsIn > 0u);
+    if (ok) {
+        bool isInteger = ((type.type == UnsignedInteger) || (type.type == SignedInteger));
+        bool isFloat = ((type == Float32Bit) || (type == Float64Bit));
+        bool isString = ((type == CharString) || (type == Character8Bit));
+        ok = (isFloat) || (isString) || ((isInteger) && (type.numberOfBits <= 64u));
+    }
+    if (ok) {
+        /*lint -e{613} the arrays cannot be NULL if signalIdx < numberOfSignals*/
+        types[signalIdx] = type;
+        addresses[signalIdx] = static_cast<char8 *>(address);
+        numberOfElements[signalIdx] = numberOfElementsIn;
+        isArray[signalIdx] = isArrayIn;
+    }
+    return ok;
+}
+
+bool FileReaderCSVDecoder::Compile(const char8 * const separatorIn,
+                                   const uint32 bufferSizeIn) {
+    separator = separatorIn;
+    bool ok = (numberOfSignals > 0u) && (bufferSizeIn > 1u) && (separator.Size() > 0u);
+    for (uint32 n = 0u; (n < numberOfSignals) && (ok); n++) {
+        /*lint -e{613} the arrays cannot be NULL if numberOfSignals > 0*/
+        ok = (addresses[n] != NULL_PTR(char8 *));
+    }
+    if (ok) {
+        if (buffer != NULL_PTR(char8 *)) {
+            delete[] buffer;
+        }
+        bufferSize = bufferSizeIn;
+        buffer = new char8[bufferSize];
+        Reset();
+    }
+    return ok;
+}
+
+void FileReaderCSVDecoder::Reset() {
+    bufferStart = 0u;
+    bufferEnd = 0u;
+}
+
+bool FileReaderCSVDecoder::IsEmpty() const {
+    return (bufferStart == bufferEnd);
+}
+
+uint32 FileReaderCSVDecoder::GetBufferedSize() const {
+    return (bufferEnd - bufferStart);
+}
+
+bool FileReaderCSVDecoder::ReadLine(File &file,
+                                    char8 *&line,
+                                    uint32 &lineSize) {
+    bool ok = (buffer != NULL_PTR(char8 *));
+    bool found = false;
+    while ((ok) && (!found)) {
+        void *newLine = NULL_PTR(void *);
+        if (bufferEnd > bufferStart) {
+            newLine = memchr(&buffer[bufferStart], '\n', static_cast<size_t>(bufferEnd - bufferStart));
+        }
+        if (newLine != NULL_PTR(void *)) {
+            char8 *newLineChr = static_cast<char8 *>(newLine);
+            line = &buffer[bufferStart];
+            lineSize = static_cast<uint32>(newLineChr - line);
+            *newLineChr = '\0';
+            bufferStart += (lineSize + 1u);
+            found = true;
+        }
+        else {
+            //Move the incomplete line to the beginning of the buffer and grow it if the line does not fit
+            if (bufferStart > 0u) {
+                ok = MemoryOperationsHelper::Move(&buffer[0], &buffer[bufferStart], bufferEnd - bufferStart);
+                bufferEnd -= bufferStart;
+                bufferStart = 0u;
+            }
+            if ((ok) && ((bufferEnd + 1u) >= bufferSize)) {
+                ok = (bufferSize < 0x7FFFFFFFu);
+                if (ok) {
+                    char8 *newBuffer = new char8[bufferSize * 2u];
+                    ok = MemoryOperationsHelper::Copy(newBuffer, buffer, bufferEnd);
+                    delete[] buffer;
+                    buffer = newBuffer;
+                    bufferSize *= 2u;
+                }
+            }
+            if (ok) {
+                uint64 remaining = file.Size() - file.Position();
+                if (remaining == 0u) {
+                    //Last line without a new line
+                    ok = (bufferEnd > 0u);
+                    if (ok) {
+                        buffer[bufferEnd] = '\0';
+                        line = &buffer[0];
+                        lineSize = bufferEnd;
+                        bufferStart = bufferEnd;
+                        found = true;
+                    }
+                }
+                else {
+                    //Leave space for the terminator of the last line
+                    uint32 readSize = (bufferSize - bufferEnd) - 1u;
+                    if (remaining < static_cast<uint64>(readSize)) {
+                        readSize = static_cast<uint32>(remaining);
+                    }
+                    ok = file.Read(&buffer[bufferEnd], readSize);
+                    if (ok) {
+                        ok = (readSize > 0u);
+                    }
+                    if (ok) {
+                        bufferEnd += readSize;
+                    }
+                }
+            }
+        }
+    }
+    if (found) {
+        //Files written on Windows
+        if (lineSize > 0u) {
+            if (line[lineSize - 1u] == '\r') {
+                lineSize--;
+                line[lineSize] = '\0';
+            }
+        }
+    }
+    return found;
+}
+
+bool FileReaderCSVDecoder::IsSeparator(const char8 c) const {
+    const char8 * const separators = separator.Buffer();
+    bool found = false;
+    for (uint32 i = 0u; (separators[i] != '\0') && (!found); i++) {
+        found = (separators[i] == c);
+    }
+    return found;
+}
+
+bool FileReaderCSVDecoder::DecodeElement(const uint32 signalIdx,
+                                         const uint32 elementIdx,
+                                         const char8 * const start,
+                                         const char8 * const end) const {
+    /*lint -e{613} the arrays cannot be NULL if the decoder was compiled*/
+    const TypeDescriptor &type = types[signalIdx];
+    char8 * const address = addresses[signalIdx];
+    bool ok = false;
+    /*lint -e{826} -e{927} the address points to an array of signal type elements*/
+    if (type == Float32Bit) {
+        float32 value = 0.F;
+        ok = CSVParseFloat32(start, end, value);
+        if (ok) {
+            reinterpret_cast<float32 *>(address)[elementIdx] = value;
+        }
+    }
+    else if (type == Float64Bit) {
+        float64 value = 0.;
+        ok = CSVParseFloat64(start, end, value);
+        if (ok) {
+            reinterpret_cast<float64 *>(address)[elementIdx] = value;
+        }
+    }
+    else if (type.type == UnsignedInteger) {
+        uint64 value = 0u;
+        ok = CSVParseUnsigned(start, end, value);
+        if (ok) {
+            if (type.numberOfBits == 8u) {
+                ok = (value <= 0xFFu);
+                reinterpret_cast<uint8 *>(address)[elementIdx] = static_cast<uint8>(value);
+            }
+            else if (type.numberOfBits == 16u) {
+                ok = (value <= 0xFFFFu);
+                reinterpret_cast<uint16 *>(address)[elementIdx] = static_cast<uint16>(value);
+            }
+            else if (type.numberOfBits == 32u) {
+                ok = (value <= 0xFFFFFFFFu);
+                reinterpret_cast<uint32 *>(address)[elementIdx] = static_cast<uint32>(value);
+            }
+            else if (type.numberOfBits == 64u) {
+                reinterpret_cast<uint64 *>(address)[elementIdx] = value;
+            }
+            else {
+                ok = false;
+            }
+        }
+    }
+    else {
+        int64 value = 0;
+        ok = CSVParseSigned(start, end, value);
+        if (ok) {
+            if (type.numberOfBits == 8u) {
+                ok = (value >= -128) && (value <= 127);
+                reinterpret_cast<int8 *>(address)[elementIdx] = static_cast<int8>(value);
+            }
+            else if (type.numberOfBits == 16u) {
+                ok = (value >= -32768) && (value <= 32767);
+                reinterpret_cast<int16 *>(address)[elementIdx] = static_cast<int16>(value);
+            }
+            else if (type.numberOfBits == 32u) {
+                ok = (value >= -2147483648LL) && (value <= 2147483647LL);
+                reinterpret_cast<int32 *>(address)[elementIdx] = static_cast<int32>(value);
+            }
+            else if (type.numberOfBits == 64u) {
+                reinterpret_cast<int64 *>(address)[elementIdx] = value;
+            }
+            else {
+                ok = false;
+            }
+        }
+    }
+    if (!ok) {
+        //Any other syntax (e.g. hexadecimal or out of range values) is converted as before
+        char8 token[CSV_MAX_TOKEN_SIZE];
+        ok = CSVCopyToken(start, end, &token[0]);
+        if (ok) {
+            uint32 byteSize = static_cast<uint32>(type.numberOfBits) / 8u;
+            AnyType source(CharString, 0u, &token[0]);
+            AnyType destination(type, 0u, &address[elementIdx * byteSize]);
+            ok = TypeConvert(destination, source);
+        }
+    }
+    return ok;
+}
+
+bool FileReaderCSVDecoder::Decode(const char8 * const line,
+                                  const uint32 lineSize) const {
+    const char8 *next = line;
+    const char8 * const end = &line[lineSize];
+    bool ok = (numberOfSignals > 0u);
+    uint32 n;
+    for (n = 0u; (n < numberOfSignals) && (ok); n++) {
+        //Skip the separator(s) and the spaces before the value
+        while ((next < end) && ((IsSeparator(*next)) || (CSVIsSpace(*next)))) {
+            next++;
+        }
+        ok = (next < end);
+        /*lint -e{613} the arrays cannot be NULL if numberOfSignals > 0*/
+        if (!ok) {
+            //NOOP
+        }
+        else if ((types[n] == CharString) || (types[n] == Character8Bit)) {
+            const char8 * const start = next;
+            while ((next < end) && (!IsSeparator(*next))) {
+                next++;
+            }
+            //The number of elements includes the terminator
+            uint32 size = static_cast<uint32>(next - start);
+            if (size >= numberOfElements[n]) {
+                size = numberOfElements[n] - 1u;
+            }
+            ok = MemoryOperationsHelper::Copy(addresses[n], start, size);
+            if (ok) {
+                //Also clears the characters of a previous longer string
+                ok = MemoryOperationsHelper::Set(&addresses[n][size], '\0', numberOfElements[n] - size);
+            }
+        }
+        else if (isArray[n]) {
+            ok = (*next == '{');
+            next++;
+            uint32 e = 0u;
+            bool closed = false;
+            while ((ok) && (!closed)) {
+                while ((next < end) && ((*next == ',') || (CSVIsSpace(*next)))) {
+                    next++;
+                }
+                ok = (next < end);
+                if (ok) {
+                    closed = (*next == '}');
+                    if (closed) {
+                        next++;
+                    }
+                    else {
+                        const char8 * const start = next;
+                        while ((next < end) && (*next != ',') && (*next != '}') && (!CSVIsSpace(*next))) {
+                            next++;
+                        }
+                        //As before, the elements in excess are ignored
+                        if (e < numberOfElements[n]) {
+                            ok = DecodeElement(n, e, start, next);
+                        }
+                        e++;
+                    }
+                }
+            }
+            if (ok) {
+                ok = (e >= numberOfElements[n]);
+            }
+        }
+        else {
+            const char8 * const start = next;
+            while ((next < end) && (!IsSeparator(*next)) && (!CSVIsSpace(*next))) {
+                next++;
+            }
+            ok = DecodeElement(n, 0u, start, next);
+        }
+    }
+    if (!ok) {
+        errorSignal = (n > 0u) ? (n - 1u) : 0u;
+    }
+    return ok;
+}
+
+uint32 FileReaderCSVDecoder::GetErrorSignal() const {
+    return errorSignal;
+}
+
+}
@@ -0,0 +1,194 @@
+/**
+ * @file FileReaderCSVDecoder.h
+ * @brief Header file for class FileReaderCSVDecoder
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FileReaderCSVDecoder
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FILEDATASOURCE_FILEREADERCSVDECODER_H_
+#define FILEDATASOURCE_FILEREADERCSVDECODER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "File.h"
+#include "StreamString.h"
+#include "TypeDescriptor.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Reads the csv lines of the FileReader in large blocks and decodes them without the StreamString tokens and TypeConvert.
+ * @details The lines are split in place in a read buffer (which grows if a line does not fit) and the signal layout (type, address,
+ * number of elements) is compiled once (see SetSignal and Compile), so that each value is parsed directly into the signal memory.
+ *
+ * The accepted syntax is the one of the FileReader: the signals are separated by any of the separator characters (consecutive separators
+ * are skipped), arrays are enclosed in braces with the elements separated by commas and/or spaces (e.g. "{1,2,3}" or "{ 1 2 3 } ") and
+ * the spaces around the values are ignored. Decimal integers and floats are parsed by the decoder (floats with up to 15 significant
+ * digits and a decimal exponent up to 22 are computed exactly, the others with the C library). Any other value (e.g. hexadecimal)
+ * falls back to TypeConvert.
+ */
+class FileReaderCSVDecoder {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    FileReaderCSVDecoder();
+
+    /**
+     * @brief Destructor. Frees the signal layout and the buffer.
+     */
+    ~FileReaderCSVDecoder();
+
+    /**
+     * @brief Allocates the layout of numberOfSignals signals.
+     * @param[in] numberOfSignals the number of signals in each line.
+     * @return true if numberOfSignals > 0.
+     */
+    bool SetNumberOfSignals(const uint32 numberOfSignals);
+
+    /**
+     * @brief Sets the layout of a signal.
+     * @param[in] signalIdx the index of the signal (i.e. its position in the line).
+     * @param[in] type the signal type (integers, floats and strings, i.e. char8 or string, are supported).
+     * @param[in] address the memory of the signal.
+     * @param[in] numberOfElements the number of elements of the signal (the maximum length for strings).
+     * @param[in] isArray if true the elements are read between braces (ignored for strings).
+     * @return true if the signalIdx is valid and the type is supported.
+     */
+    bool SetSignal(const uint32 signalIdx,
+                   const TypeDescriptor &type,
+                   void * const address,
+                   const uint32 numberOfElements,
+                   const bool isArray);
+
+    /**
+     * @brief Allocates the read buffer.
+     * @param[in] separator the separator characters between signals.
+     * @param[in] bufferSize the initial size of the read buffer.
+     * @return true if all the signals were set and bufferSize > 0.
+     */
+    bool Compile(const char8 * const separator,
+                 const uint32 bufferSize);
+
+    /**
+     * @brief Discards the buffered bytes. To be called every time the file is moved with Seek.
+     */
+    void Reset();
+
+    /**
+     * @brief Gets the next line of the file (without the new line characters).
+     * @param[in] file the file to read from (positioned after the bytes already buffered).
+     * @param[out] line the line, zero terminated in the buffer. Valid until the next call.
+     * @param[out] lineSize the number of characters of the line.
+     * @return true if a line was read, false if there are no more lines or if the file could not be read.
+     */
+    bool ReadLine(File &file,
+                  char8 *&line,
+                  uint32 &lineSize);
+
+    /**
+     * @brief Checks if all the buffered bytes were consumed (i.e. if the file position is the position of the next line).
+     * @return true if there are no buffered bytes.
+     */
+    bool IsEmpty() const;
+
+    /**
+     * @brief Gets the number of buffered bytes which were read from the file but not yet consumed.
+     * @details The file offset of the next line is the file position minus this value.
+     * @return the number of unread bytes in the buffer.
+     */
+    uint32 GetBufferedSize() const;
+
+    /**
+     * @brief Decodes a line into the signals memory.
+     * @param[in] line the line to decode.
+     * @param[in] lineSize the number of characters of the line.
+     * @return true if all the signals (and all the elements of the arrays) were found and converted.
+     */
+    bool Decode(const char8 * const line,
+                const uint32 lineSize) const;
+
+    /**
+     * @brief Gets the index of the signal which could not be decoded by the last Decode.
+     * @return the index of the signal which could not be decoded.
+     */
+    uint32 GetErrorSignal() const;
+
+private:
+
+    /**
+     * @brief Converts the value [start, end[ into the element elementIdx of the signal signalIdx.
+     * @return true if the value is valid for the signal type.
+     */
+    bool DecodeElement(const uint32 signalIdx,
+                       const uint32 elementIdx,
+                       const char8 * const start,
+                       const char8 * const end) const;
+
+    /**
+     * @brief Checks if the character is one of the separator characters.
+     */
+    bool IsSeparator(const char8 c) const;
+
+    /**
+     * The type, address, number of elements and array flag of each signal.
+     */
+    TypeDescriptor *types;
+    char8 **addresses;
+    uint32 *numberOfElements;
+    bool *isArray;
+
+    /**
+     * The number of signals.
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * The separator characters.
+     */
+    StreamString separator;
+
+    /**
+     * The read buffer, its size and the unread bytes [bufferStart, bufferEnd[.
+     */
+    char8 *buffer;
+    uint32 bufferSize;
+    uint32 bufferStart;
+    uint32 bufferEnd;
+
+    /**
+     * The signal which could not be decoded by the last Decode.
+     */
+    mutable uint32 errorSignal;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FILEDATASOURCE_FILEREADERCSVDECODER_H_ */
@@ -0,0 +1,463 @@
+/**
+ * @file FileReaderInterpolatedInputBroker.cpp
+ * @brief Source file for class FileReaderInterpolatedInputBroker
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FileReaderInterpolatedInputBroker (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "FileReaderInterpolatedInputBroker.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The number of numeric types (the groups of the runs). The signals of other types are copied.
+ */
+static const uint32 FILE_READER_INTERPOLATION_TYPES = 10u;
+
+/**
+ * @brief Gets the group of a type: uint8, int8, uint16, int16, uint32, int32, uint64, int64, float32 and float64 (in this order).
+ * @return the group index or FILE_READER_INTERPOLATION_TYPES if the type is not numeric.
+ */
+static uint32 FileReaderInterpolationGroup(const TypeDescriptor &type) {
+    uint32 group = FILE_READER_INTERPOLATION_TYPES;
+    if (type == UnsignedInteger8Bit) {
+        group = 0u;
+    }
+    else if (type == SignedInteger8Bit) {
+        group = 1u;
+    }
+    else if (type == UnsignedInteger16Bit) {
+        group = 2u;
+    }
+    else if (type == SignedInteger16Bit) {
+        group = 3u;
+    }
+    else if (type == UnsignedInteger32Bit) {
+        group = 4u;
+    }
+    else if (type == SignedInteger32Bit) {
+        group = 5u;
+    }
+    else if (type == UnsignedInteger64Bit) {
+        group = 6u;
+    }
+    else if (type == SignedInteger64Bit) {
+        group = 7u;
+    }
+    else if (type == Float32Bit) {
+        group = 8u;
+    }
+    else if (type == Float64Bit) {
+        group = 9u;
+    }
+    else {
+        //NOOP
+    }
+    return group;
+}
+
+/**
+ * @brief Converts the elements of the runs [start, end[ (all with the type T) to float64.
+ */
+template<typename T>
+static void FileReaderReadRuns(const FileReaderInterpolationRun * const runs,
+                               const uint32 start,
+                               const uint32 end,
+                               float64 * const row) {
+    for (uint32 r = start; r < end; r++) {
+        /*lint -e{927} -e{826} the run was created for a signal of type T.*/
+        const T * const src = reinterpret_cast<const T *>(runs[r].dataSourcePointer);
+        float64 * const dest = &row[runs[r].valueIdx];
+        for (uint32 e = 0u; e < runs[r].numberOfElements; e++) {
+            dest[e] = static_cast<float64>(src[e]);
+        }
+    }
+}
+
+/**
+ * @brief Converts the interpolated values of the runs [start, end[ (all with the type T) to the sample of the GAM memory.
+ */
+template<typename T>
+static void FileReaderWriteRuns(const FileReaderInterpolationRun * const runs,
+                                const uint32 start,
+                                const uint32 end,
+                                const float64 * const values,
+                                const uint32 sample) {
+    for (uint32 r = start; r < end; r++) {
+        if (sample < runs[r].numberOfSamples) {
+            /*lint -e{927} -e{826} the run was created for a signal of type T.*/
+            T * const dest = &(reinterpret_cast<T *>(runs[r].gamPointer)[sample * runs[r].numberOfElements]);
+            const float64 * const src = &values[runs[r].valueIdx];
+            for (uint32 e = 0u; e < runs[r].numberOfElements; e++) {
+                /*lint -e{734} -e{571} the interpolated value is between two values of the type T.*/
+                dest[e] = static_cast<T>(src[e]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Computes y = y0 + (y1 - y0) * alpha for all the elements.
+ */
+static void FileReaderInterpolate(const float64 * const y0,
+                                  const float64 * const y1,
+                                  const float64 alpha,
+                                  float64 * const y,
+                                  const uint32 numberOfElements) {
+    uint32 i = 0u;
+#if defined(__SSE2__)
+    /*lint -save -e586 -e9016 -e923 SSE2 intrinsics on unaligned memory.*/
+    const __m128d a = _mm_set1_pd(alpha);
+    for (; (i + 4u) <= numberOfElements; i += 4u) {
+        __m128d v0 = _mm_loadu_pd(&y0[i]);
+        __m128d w0 = _mm_loadu_pd(&y0[i + 2u]);
+        __m128d v1 = _mm_loadu_pd(&y1[i]);
+        __m128d w1 = _mm_loadu_pd(&y1[i + 2u]);
+        _mm_storeu_pd(&y[i], _mm_add_pd(v0, _mm_mul_pd(_mm_sub_pd(v1, v0), a)));
+        _mm_storeu_pd(&y[i + 2u], _mm_add_pd(w0, _mm_mul_pd(_mm_sub_pd(w1, w0), a)));
+    }
+    /*lint -restore*/
+#endif
+    for (; i < numberOfElements; i++) {
+        y[i] = y0[i] + ((y1[i] - y0[i]) * alpha);
+    }
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+FileReaderInterpolatedInputBroker::FileReaderInterpolatedInputBroker() :
+        BrokerI() {
+    dataSource = NULL_PTR(DataSourceI *);
+    runs = NULL_PTR(FileReaderInterpolationRun *);
+    runsStart = NULL_PTR(uint32 *);
+    copies = NULL_PTR(FileReaderInterpolationRun *);
+    numberOfRawCopies = 0u;
+    numberOfSamples = 0u;
+    numberOfInterpolatedElements = 0u;
+    y0 = NULL_PTR(float64 *);
+    y1 = NULL_PTR(float64 *);
+    y = NULL_PTR(float64 *);
+    xAxis = NULL_PTR(uint64 *);
+    x0 = 0u;
+    x1 = 0u;
+    xInterpolated = 0u;
+    interpolationPeriod = 0u;
+    restart = true;
+}
+
+/*lint -e{1551} -e{1579} the dataSource is freed by its owner.*/
+FileReaderInterpolatedInputBroker::~FileReaderInterpolatedInputBroker() {
+    if (runs != NULL_PTR(FileReaderInterpolationRun *)) {
+        delete[] runs;
+    }
+    if (runsStart != NULL_PTR(uint32 *)) {
+        delete[] runsStart;
+    }
+    if (copies != NULL_PTR(FileReaderInterpolationRun *)) {
+        delete[] copies;
+    }
+    if (y0 != NULL_PTR(float64 *)) {
+        delete[] y0;
+    }
+    if (y1 != NULL_PTR(float64 *)) {
+        delete[] y1;
+    }
+    if (y != NULL_PTR(float64 *)) {
+        delete[] y;
+    }
+}
+
+bool FileReaderInterpolatedInputBroker::Init(const SignalDirection direction,
+                                             DataSourceI &dataSourceIn,
+                                             const char8 * const functionName,
+                                             void * const gamMemoryAddress) {
+    dataSource = &dataSourceIn;
+    bool ok = (direction == InputSignals);
+    if (ok) {
+        ok = InitFunctionPointers(direction, dataSourceIn, functionName, gamMemoryAddress);
+    }
+    const ClassProperties * properties = GetClassProperties();
+    if (ok) {
+        ok = (properties != NULL);
+    }
+    const char8* brokerClassName = NULL_PTR(const char8*);
+    if (ok) {
+        brokerClassName = properties->GetName();
+        ok = (brokerClassName != NULL);
+    }
+    if (ok) {
+        ok = (numberOfCopies > 0u);
+    }
+    uint32 functionIdx = 0u;
+    if (ok) {
+        ok = dataSource->GetFunctionIndex(functionIdx, functionName);
+    }
+    uint32 functionNumberOfSignals = 0u;
+    if (ok) {
+        ok = dataSource->GetFunctionNumberOfSignals(direction, functionIdx, functionNumberOfSignals);
+    }
+    //A run is added for each signal range (in the order of the copies) and then sorted by type
+    FileReaderInterpolationRun *allRuns = NULL_PTR(FileReaderInterpolationRun *);
+    uint32 *groups = NULL_PTR(uint32 *);
+    if (ok) {
+        allRuns = new FileReaderInterpolationRun[numberOfCopies];
+        groups = new uint32[numberOfCopies];
+    }
+    uint32 c = 0u;
+    for (uint32 n = 0u; (n < functionNumberOfSignals) && (ok); n++) {
+        if (dataSource->IsSupportedBroker(direction, functionIdx, n, brokerClassName)) {
+            uint32 numberOfByteOffsets = 0u;
+            ok = dataSource->GetFunctionSignalNumberOfByteOffsets(direction, functionIdx, n, numberOfByteOffsets);
+            StreamString functionSignalName;
+            if (ok) {
+                ok = dataSource->GetFunctionSignalAlias(direction, functionIdx, n, functionSignalName);
+            }
+            uint32 signalIdx = 0u;
+            if (ok) {
+                ok = dataSource->GetSignalIndex(signalIdx, functionSignalName.Buffer());
+            }
+            uint32 samples = 0u;
+            if (ok) {
+                ok = dataSource->GetFunctionSignalSamples(direction, functionIdx, n, samples);
+            }
+            void *dataSourceSignalAddress = NULL_PTR(void *);
+            if (ok) {
+                ok = dataSource->GetSignalMemoryBuffer(signalIdx, 0u, dataSourceSignalAddress);
+            }
+            TypeDescriptor signalType = dataSource->GetSignalType(signalIdx);
+            uint32 group = FileReaderInterpolationGroup(signalType);
+            uint32 elementSize = static_cast<uint32>(signalType.numberOfBits) / 8u;
+            //Take into account different ranges for the same signal
+            for (uint32 bo = 0u; (bo < numberOfByteOffsets) && (ok); bo++) {
+                uint32 offsetStart = 0u;
+                uint32 offsetSize = 0u;
+                ok = dataSource->GetFunctionSignalByteOffsetInfo(direction, functionIdx, n, bo, offsetStart, offsetSize);
+                if (ok) {
+                    ok = (c < numberOfCopies);
+                }
+                if (ok) {
+                    allRuns[c].dataSourcePointer = &(reinterpret_cast<const char8 *>(dataSourceSignalAddress)[offsetStart]);
+                    allRuns[c].gamPointer = reinterpret_cast<char8 *>(GetFunctionPointer(c));
+                    allRuns[c].numberOfSamples = samples;
+                    allRuns[c].valueIdx = 0u;
+                    //The copies of the signals which are not numeric are counted in bytes
+                    if ((group < FILE_READER_INTERPOLATION_TYPES) && (elementSize > 0u)) {
+                        allRuns[c].numberOfElements = offsetSize / elementSize;
+                    }
+                    else {
+                        group = FILE_READER_INTERPOLATION_TYPES;
+                        allRuns[c].numberOfElements = offsetSize;
+                    }
+                    groups[c] = group;
+                    if (samples > numberOfSamples) {
+                        numberOfSamples = samples;
+                    }
+                    c++;
+                }
+            }
+        }
+    }
+    uint32 numberOfRuns = 0u;
+    if (ok) {
+        runsStart = new uint32[FILE_READER_INTERPOLATION_TYPES + 1u];
+        for (uint32 t = 0u; t <= FILE_READER_INTERPOLATION_TYPES; t++) {
+            runsStart[t] = numberOfRuns;
+            for (uint32 r = 0u; r < c; r++) {
+                if (groups[r] == t) {
+                    numberOfRuns++;
+                }
+            }
+        }
+        numberOfRawCopies = c - runsStart[FILE_READER_INTERPOLATION_TYPES];
+        runs = new FileReaderInterpolationRun[c];
+        uint32 idx = 0u;
+        for (uint32 t = 0u; t <= FILE_READER_INTERPOLATION_TYPES; t++) {
+            for (uint32 r = 0u; r < c; r++) {
+                if (groups[r] == t) {
+                    runs[idx] = allRuns[r];
+                    if (t < FILE_READER_INTERPOLATION_TYPES) {
+                        runs[idx].valueIdx = numberOfInterpolatedElements;
+                        numberOfInterpolatedElements += runs[idx].numberOfElements;
+                    }
+                    idx++;
+                }
+            }
+        }
+        //The raw copies are also kept in their own table
+        if (numberOfRawCopies > 0u) {
+            copies = new FileReaderInterpolationRun[numberOfRawCopies];
+            for (uint32 r = 0u; r < numberOfRawCopies; r++) {
+                copies[r] = runs[runsStart[FILE_READER_INTERPOLATION_TYPES] + r];
+            }
+        }
+        uint32 rowSize = (numberOfInterpolatedElements > 0u) ? numberOfInterpolatedElements : 1u;
+        y0 = new float64[rowSize];
+        y1 = new float64[rowSize];
+        y = new float64[rowSize];
+        for (uint32 e = 0u; e < rowSize; e++) {
+            y0[e] = 0.0;
+            y1[e] = 0.0;
+            y[e] = 0.0;
+        }
+    }
+    if (allRuns != NULL_PTR(FileReaderInterpolationRun *)) {
+        delete[] allRuns;
+    }
+    if (groups != NULL_PTR(uint32 *)) {
+        delete[] groups;
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Could not compute the interpolation tables of %s", functionName);
+    }
+    return ok;
+}
+
+bool FileReaderInterpolatedInputBroker::Execute() {
+    bool ok = (xAxis != NULL_PTR(uint64 *)) && (dataSource != NULL_PTR(DataSourceI *));
+    for (uint32 s = 0u; (s < numberOfSamples) && (ok); s++) {
+        if (restart) {
+            Restart();
+        }
+        //Stop if the rows do not advance (e.g. EOF = "Last") and hold the last row
+        bool advanced = true;
+        while ((ok) && (advanced) && (xInterpolated > x1)) {
+            uint64 previous = x1;
+            ok = NextRow();
+            advanced = (x1 != previous);
+        }
+        if (ok) {
+            float64 alpha = 1.0;
+            if ((x1 > x0) && (xInterpolated < x1)) {
+                alpha = static_cast<float64>(xInterpolated - x0) / static_cast<float64>(x1 - x0);
+            }
+            else if (xInterpolated <= x0) {
+                alpha = 0.0;
+            }
+            else {
+                //NOOP
+            }
+            FileReaderInterpolate(y0, y1, alpha, y, numberOfInterpolatedElements);
+            WriteSample(y, s);
+            xInterpolated += interpolationPeriod;
+        }
+    }
+    return ok;
+}
+
+void FileReaderInterpolatedInputBroker::SetIndependentVariable(uint64 * const xAxisIn,
+                                                               const uint64 interpolationPeriodIn) {
+    xAxis = xAxisIn;
+    interpolationPeriod = interpolationPeriodIn;
+}
+
+void FileReaderInterpolatedInputBroker::Reset() {
+    restart = true;
+}
+
+uint32 FileReaderInterpolatedInputBroker::GetNumberOfInterpolatedElements() const {
+    return numberOfInterpolatedElements;
+}
+
+void FileReaderInterpolatedInputBroker::ReadRow(float64 * const row) const {
+    FileReaderReadRuns<uint8>(runs, runsStart[0u], runsStart[1u], row);
+    FileReaderReadRuns<int8>(runs, runsStart[1u], runsStart[2u], row);
+    FileReaderReadRuns<uint16>(runs, runsStart[2u], runsStart[3u], row);
+    FileReaderReadRuns<int16>(runs, runsStart[3u], runsStart[4u], row);
+    FileReaderReadRuns<uint32>(runs, runsStart[4u], runsStart[5u], row);
+    FileReaderReadRuns<int32>(runs, runsStart[5u], runsStart[6u], row);
+    FileReaderReadRuns<uint64>(runs, runsStart[6u], runsStart[7u], row);
+    FileReaderReadRuns<int64>(runs, runsStart[7u], runsStart[8u], row);
+    FileReaderReadRuns<float32>(runs, runsStart[8u], runsStart[9u], row);
+    FileReaderReadRuns<float64>(runs, runsStart[9u], runsStart[10u], row);
+}
+
+void FileReaderInterpolatedInputBroker::WriteSample(const float64 * const values,
+                                                    const uint32 sample) const {
+    FileReaderWriteRuns<uint8>(runs, runsStart[0u], runsStart[1u], values, sample);
+    FileReaderWriteRuns<int8>(runs, runsStart[1u], runsStart[2u], values, sample);
+    FileReaderWriteRuns<uint16>(runs, runsStart[2u], runsStart[3u], values, sample);
+    FileReaderWriteRuns<int16>(runs, runsStart[3u], runsStart[4u], values, sample);
+    FileReaderWriteRuns<uint32>(runs, runsStart[4u], runsStart[5u], values, sample);
+    FileReaderWriteRuns<int32>(runs, runsStart[5u], runsStart[6u], values, sample);
+    FileReaderWriteRuns<uint64>(runs, runsStart[6u], runsStart[7u], values, sample);
+    FileReaderWriteRuns<int64>(runs, runsStart[7u], runsStart[8u], values, sample);
+    FileReaderWriteRuns<float32>(runs, runsStart[8u], runsStart[9u], values, sample);
+    FileReaderWriteRuns<float64>(runs, runsStart[9u], runsStart[10u], values, sample);
+    //The signals which are not numeric hold the last row
+    for (uint32 r = 0u; r < numberOfRawCopies; r++) {
+        if (sample < copies[r].numberOfSamples) {
+            (void) MemoryOperationsHelper::Copy(&(copies[r].gamPointer[sample * copies[r].numberOfElements]), copies[r].dataSourcePointer,
+                                                copies[r].numberOfElements);
+        }
+    }
+}
+
+bool FileReaderInterpolatedInputBroker::NextRow() {
+    float64 *last = y1;
+    y1 = y0;
+    y0 = last;
+    x0 = x1;
+    bool ok = dataSource->Synchronise();
+    if (ok) {
+        //The DataSourceI may be moved (e.g. rewound or seeked) while reading the row
+        if ((restart) || (*xAxis < x0)) {
+            Restart();
+        }
+        else {
+            x1 = *xAxis;
+            ReadRow(y1);
+        }
+    }
+    return ok;
+}
+
+void FileReaderInterpolatedInputBroker::Restart() {
+    x1 = *xAxis;
+    x0 = x1;
+    xInterpolated = x1;
+    ReadRow(y1);
+    for (uint32 e = 0u; e < numberOfInterpolatedElements; e++) {
+        y0[e] = y1[e];
+    }
+    restart = false;
+}
+
+CLASS_REGISTER(FileReaderInterpolatedInputBroker, "1.0")
+
+}
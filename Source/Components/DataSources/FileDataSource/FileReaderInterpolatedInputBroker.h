@@ -0,0 +1,221 @@
+/**
+ * @file FileReaderInterpolatedInputBroker.h
+ * @brief Header file for class FileReaderInterpolatedInputBroker
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FileReaderInterpolatedInputBroker
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FILEDATASOURCE_FILEREADERINTERPOLATEDINPUTBROKER_H_
+#define FILEDATASOURCE_FILEREADERINTERPOLATEDINPUTBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BrokerI.h"
+#include "DataSourceI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief A run of consecutive elements of the same type which are interpolated by the FileReaderInterpolatedInputBroker.
+ */
+struct FileReaderInterpolationRun {
+    /**
+     * The address of the first element in the DataSourceI memory.
+     */
+    const char8 *dataSourcePointer;
+    /**
+     * The address of the first element of the first sample in the GAM memory.
+     */
+    char8 *gamPointer;
+    /**
+     * The number of elements of each sample.
+     */
+    uint32 numberOfElements;
+    /**
+     * The number of samples written for each cycle.
+     */
+    uint32 numberOfSamples;
+    /**
+     * The index of the first element in the interpolation rows.
+     */
+    uint32 valueIdx;
+};
+
+/**
+ * @brief The input broker used by the FileReader when Interpolate = "yes".
+ * @details The numeric signals are linearly interpolated on the independent variable (the XAxisSignal) between the last two rows
+ * read by the DataSourceI::Synchronise. Each row is converted once to a float64 array (grouped by type, so that each group is converted
+ * with a single loop), the interpolation of all the elements is computed in a single SIMD (SSE2 if available) pass and the result is
+ * converted back to the GAM memory (again grouped by type).
+ *
+ * The interpolated signals may have more than one sample: each GAM cycle receives numberOfSamples consecutive interpolated values
+ * (spaced by the interpolation period), which allows an interpolation period shorter than the GAM cycle. The signals which are not
+ * numeric are copied from the last row read.
+ */
+class FileReaderInterpolatedInputBroker: public BrokerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default constructor. NOOP.
+     */
+    FileReaderInterpolatedInputBroker();
+
+    /**
+     * @brief Destructor. Frees the interpolation tables.
+     */
+    virtual ~FileReaderInterpolatedInputBroker();
+
+    /**
+     * @brief Builds the type grouped tables of the signals of functionName.
+     * @param[in] direction shall be InputSignals.
+     * @param[in] dataSourceIn the DataSourceI which is synchronised when a new row is needed.
+     * @param[in] functionName the name of the function (GAM).
+     * @param[in] gamMemoryAddress the GAM memory.
+     * @return true if the copies could be computed.
+     */
+    virtual bool Init(const SignalDirection direction,
+                      DataSourceI &dataSourceIn,
+                      const char8 * const functionName,
+                      void * const gamMemoryAddress);
+
+    /**
+     * @brief Writes the interpolated samples of the cycle to the GAM memory, calling DataSourceI::Synchronise each time that
+     * the next interpolation point is after the last row read.
+     * @details A row with an independent variable smaller than the previous one (e.g. when the file is rewound) restarts the interpolation.
+     * @return true if the DataSourceI::Synchronise calls succeed.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Sets the address of the independent variable (updated by DataSourceI::Synchronise) and the interpolation period.
+     * @param[in] xAxisIn the address of the independent variable.
+     * @param[in] interpolationPeriodIn the interval of the independent variable between two interpolated samples.
+     */
+    void SetIndependentVariable(uint64 * const xAxisIn,
+                                const uint64 interpolationPeriodIn);
+
+    /**
+     * @brief Restarts the interpolation from the row which is currently in the DataSourceI memory.
+     * @details The first interpolated sample is the value of this row.
+     */
+    void Reset();
+
+    /**
+     * @brief Gets the number of elements which are interpolated for each sample.
+     * @return the number of numeric elements of all the signals.
+     */
+    uint32 GetNumberOfInterpolatedElements() const;
+
+private:
+
+    /**
+     * @brief Converts the row in the DataSourceI memory to float64 (one loop for each type group).
+     * @param[out] row the array where to write the converted elements.
+     */
+    void ReadRow(float64 * const row) const;
+
+    /**
+     * @brief Converts the interpolated values to the GAM memory (one loop for each type group).
+     * @param[in] values the interpolated elements.
+     * @param[in] sample the index of the sample to write.
+     */
+    void WriteSample(const float64 * const values,
+                     const uint32 sample) const;
+
+    /**
+     * @brief Reads a new row which becomes the last one (the previous last one becomes the first one).
+     * @return true if the DataSourceI::Synchronise succeeds.
+     */
+    bool NextRow();
+
+    /**
+     * @brief Makes the row in the DataSourceI memory both the first and the last rows and the first interpolation point.
+     */
+    void Restart();
+
+    /**
+     * The DataSourceI which reads the rows.
+     */
+    DataSourceI *dataSource;
+
+    /**
+     * The runs of elements to interpolate, sorted by type so that runsStart[t] is the first run of the type t (see the .cpp) and
+     * runsStart[t + 1] is the end.
+     */
+    FileReaderInterpolationRun *runs;
+    uint32 *runsStart;
+
+    /**
+     * The copies of the signals which are not numeric (copy sizes in numberOfElements).
+     */
+    FileReaderInterpolationRun *copies;
+    uint32 numberOfRawCopies;
+
+    /**
+     * The largest number of samples of the signals.
+     */
+    uint32 numberOfSamples;
+
+    /**
+     * The number of numeric elements of all the signals.
+     */
+    uint32 numberOfInterpolatedElements;
+
+    /**
+     * The first and the last rows read and the interpolated values.
+     */
+    float64 *y0;
+    float64 *y1;
+    float64 *y;
+
+    /**
+     * The independent variable of the DataSourceI, of the first and the last rows and of the next interpolation point.
+     */
+    uint64 *xAxis;
+    uint64 x0;
+    uint64 x1;
+    uint64 xInterpolated;
+
+    /**
+     * The interval of the independent variable between two interpolated samples.
+     */
+    uint64 interpolationPeriod;
+
+    /**
+     * True if the interpolation shall restart from the row in the DataSourceI memory.
+     */
+    bool restart;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FILEDATASOURCE_FILEREADERINTERPOLATEDINPUTBROKER_H_ */
@@ -24,14 +24,22 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "CLASSMETHODREGISTER.h"
 #include "Directory.h"
 #include "FileWriter.h"
+#include "HeapManager.h"
+#include "HighResolutionTimer.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -43,15 +51,22 @@
 namespace MARTe {
 static const int32 FILE_FORMAT_BINARY = 1;
 static const int32 FILE_FORMAT_CSV = 2;
+/**
+ * Timeout of the waits of the I/O thread and of the thread calling Synchronise, so that stopping (or failing) threads are detected.
+ */
+static const uint32 BATCH_WAIT_TIMEOUT_MSEC = 200u;
 
 FileWriter::FileWriter() :
         DataSourceI(),
-        MessageI() {
+        MessageI(),
+        EmbeddedServiceMethodBinderI(),
+        batchExecutor(*this) {
     storeOnTrigger = false;
     numberOfPreTriggers = 0u;
     numberOfPostTriggers = 0u;
     numberOfBuffers = 0u;
     dataSourceMemory = NULL_PTR(char8 *);
+    memoryHeap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
     offsets = NULL_PTR(uint32 *);
     cpuMask = ProcessorType(0xFEu);
     stackSize = 0u;
@@ -63,6 +78,86 @@ FileWriter::FileWriter() :
     refreshContent = 0u;
     fullNotation =0u;
     signalsAnyType = NULL_PTR(AnyType *);
+    signalNames = NULL_PTR(StreamString *);
+    csvFloatFormat = "fixed";
+    headerPositionMarker = 0u;
+    batchCycles = 0u;
+    numberOfBatchBuffers = 4u;
+    directIO = false;
+    directIOActive = false;
+    preallocateSize = 0u;
+    ioBackend = "pwrite";
+    ioUringActive = false;
+    batchSubmitIndex = 0u;
+    batchSubmitted = 0u;
+    batchInFlight = 0u;
+    batchBufferDone = NULL_PTR(bool *);
+    batchBufferOffsets = NULL_PTR(uint64 *);
+    batchBufferWritten = NULL_PTR(uint32 *);
+    batchSubmitCounters = NULL_PTR(uint64 *);
+    rotateSize = 0u;
+    rotatePeriod = 0u;
+    rotatePeriodCounts = 0u;
+    rotate = false;
+    segmentFilename = "";
+    segmentIndex = 0u;
+    segmentBytes = 0u;
+    segmentStartCounter = 0u;
+    batchCycleCounter = 0u;
+    batchBufferRotate = NULL_PTR(bool *);
+    batchRotateCycles = NULL_PTR(uint64 *);
+    batchRotatePending = false;
+    nextBatchFd = -1;
+    headerBytes = NULL_PTR(char8 *);
+    compression = "none";
+    compressionLevel = 3;
+    frameBuffer = NULL_PTR(char8 *);
+    layout = "row";
+    chunkBuffer = NULL_PTR(char8 *);
+    uncompressedBytesWritten = 0u;
+    batchBufferSize = 0u;
+    batchAlignment = 1u;
+    batchBuffers = NULL_PTR(char8 **);
+    batchBufferBytes = NULL_PTR(uint32 *);
+    batchFillIndex = 0u;
+    batchFillBytes = 0u;
+    batchFillCycles = 0u;
+    batchDirty = false;
+    batchFlushIndex = 0u;
+    batchPending = 0;
+    batchFd = -1;
+    batchFileOffset = 0u;
+    batchFileSize = 0u;
+    batchIOError = false;
+    numberOfBatches = 0u;
+    batchBytesWritten = 0u;
+    numberOfQueueFull = 0u;
+    lastFlushLatency = 0u;
+    maxFlushLatency = 0u;
+    flightRecorderCycles = 0u;
+    flightRecorderFile = "";
+    flightRecorderFd = -1;
+    flightRecorderMemory = NULL_PTR(char8 *);
+    flightRecorderSize = 0u;
+    flightRecorderHeader = NULL_PTR(FileWriterFlightRecorderHeader *);
+    flightRecorderSlots = NULL_PTR(char8 *);
+    flightRecorderPostCycles = 0u;
+    flightRecorderTriggered = false;
+    flightRecorderFirstCycle = 0u;
+    flightRecorderWindowCycles = 0u;
+    flightRecorderPending = 0;
+    flightRecorderDumps = 0u;
+    flightRecorderOverruns = 0u;
+    flightRecorderMissedTriggers = 0u;
+    if (!batchMux.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create the FastPollingMutexSem");
+    }
+    if (!batchQueuedSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create the EventSem");
+    }
+    if (!batchWrittenSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create the EventSem");
+    }
     filter = ReferenceT < RegisteredMethodsMessageFilter > (GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -76,8 +171,74 @@ FileWriter::~FileWriter() {
     if (FlushFile() != ErrorManagement::NoError) {
         REPORT_ERROR(ErrorManagement::FatalError, "Failed to Flush the File");
     }
+    if (batchCycles > 0u) {
+        if (!FlushBatches(true)) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to write the staging buffers");
+        }
+        if (!batchExecutor.Stop()) {
+            if (!batchExecutor.Stop()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the I/O thread.");
+            }
+        }
+        //From now on write (and close) the file as if batching was disabled
+        batchCycles = 0u;
+    }
+    if (flightRecorderCycles > 0u) {
+        if (!batchExecutor.Stop()) {
+            if (!batchExecutor.Stop()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the I/O thread.");
+            }
+        }
+    }
+    if (flightRecorderMemory != NULL_PTR(char8 *)) {
+        (void) munmap(flightRecorderMemory, static_cast<size_t>(flightRecorderSize));
+    }
+    if (flightRecorderFd >= 0) {
+        (void) close(flightRecorderFd);
+    }
+    //The buffers are unregistered before being freed
+    ioRing.Close();
+    if (batchBuffers != NULL_PTR(char8 **)) {
+        for (uint32 i = 0u; i < numberOfBatchBuffers; i++) {
+            if (batchBuffers[i] != NULL_PTR(char8 *)) {
+                /*lint -e{586} the staging buffers are allocated with posix_memalign so that they are page aligned*/
+                free(batchBuffers[i]);
+            }
+        }
+        delete[] batchBuffers;
+    }
+    if (batchBufferBytes != NULL_PTR(uint32 *)) {
+        delete[] batchBufferBytes;
+    }
+    if (batchBufferDone != NULL_PTR(bool *)) {
+        delete[] batchBufferDone;
+    }
+    if (batchBufferOffsets != NULL_PTR(uint64 *)) {
+        delete[] batchBufferOffsets;
+    }
+    if (batchBufferWritten != NULL_PTR(uint32 *)) {
+        delete[] batchBufferWritten;
+    }
+    if (batchSubmitCounters != NULL_PTR(uint64 *)) {
+        delete[] batchSubmitCounters;
+    }
+    if (batchBufferRotate != NULL_PTR(bool *)) {
+        delete[] batchBufferRotate;
+    }
+    if (batchRotateCycles != NULL_PTR(uint64 *)) {
+        delete[] batchRotateCycles;
+    }
+    if (headerBytes != NULL_PTR(char8 *)) {
+        delete[] headerBytes;
+    }
+    if (frameBuffer != NULL_PTR(char8 *)) {
+        delete[] frameBuffer;
+    }
+    if (chunkBuffer != NULL_PTR(char8 *)) {
+        delete[] chunkBuffer;
+    }
     if (dataSourceMemory != NULL_PTR(char8 *)) {
-        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(dataSourceMemory));
+        memoryHeap->Free(reinterpret_cast<void *&>(dataSourceMemory));
     }
     if (offsets != NULL_PTR(uint32 *)) {
         delete[] offsets;
@@ -85,6 +246,9 @@ FileWriter::~FileWriter() {
     if (signalsAnyType != NULL_PTR(AnyType *)) {
         delete[] signalsAnyType;
     }
+    if (signalNames != NULL_PTR(StreamString *)) {
+        delete[] signalNames;
+    }
     (void) CloseFile();
 }
 
@@ -114,7 +278,10 @@ const char8* FileWriter::GetBrokerName(StructuredDataI& data,
                                        const SignalDirection direction) {
     const char8* brokerName = "";
     if (direction == OutputSignals) {
-        if (storeOnTrigger) {
+        if (flightRecorderCycles > 0u) {
+            brokerName = "MemoryMapSynchronisedOutputBroker";
+        }
+        else if (storeOnTrigger) {
             brokerName = "MemoryMapAsyncTriggerOutputBroker";
         }
         else {
@@ -135,7 +302,15 @@ bool FileWriter::GetOutputBrokers(ReferenceContainer& outputBrokers,
                                   const char8* const functionName,
                                   void* const gamMemPtr) {
     bool ok = true;
-    if (storeOnTrigger) {
+    if (flightRecorderCycles > 0u) {
+        //The cycles are copied into the ring by Synchronise, in the real-time thread
+        ReferenceT < MemoryMapSynchronisedOutputBroker > brokerSyncNew("MemoryMapSynchronisedOutputBroker");
+        ok = brokerSyncNew->Init(OutputSignals, *this, functionName, gamMemPtr);
+        if (ok) {
+            ok = outputBrokers.Insert(brokerSyncNew);
+        }
+    }
+    else if (storeOnTrigger) {
         ReferenceT < MemoryMapAsyncTriggerOutputBroker > brokerAsyncTriggerNew("MemoryMapAsyncTriggerOutputBroker");
         ok = brokerAsyncTriggerNew->InitWithTriggerParameters(OutputSignals, *this, functionName, gamMemPtr, numberOfBuffers, numberOfPreTriggers,
                                                               numberOfPostTriggers, cpuMask, stackSize);
@@ -155,48 +330,792 @@ bool FileWriter::GetOutputBrokers(ReferenceContainer& outputBrokers,
     return ok;
 }
 
-bool FileWriter::Synchronise() {
-    bool ok = !fatalFileError;
+bool FileWriter::Synchronise() {
+    bool ok = !fatalFileError;
+    if (ok) {
+        if (refreshContent > 0u) {
+            (void) outputFile.Seek(headerPositionMarker);
+            (void) outputFile.SetSize(headerPositionMarker);
+        }
+
+        if (flightRecorderCycles > 0u) {
+            ok = RecordCycle();
+        }
+        else if ((fileFormat == FILE_FORMAT_BINARY) && (batchCycles > 0u)) {
+            ok = (batchMux.FastLock() == ErrorManagement::NoError);
+            if (ok) {
+                ok = (batchFd >= 0);
+                if (ok) {
+                    /*lint -e{613} batchBuffers cannot be NULL if batchCycles > 0*/
+                    ok = MemoryOperationsHelper::Copy(&batchBuffers[batchFillIndex][batchFillBytes], dataSourceMemory, numberOfBinaryBytes);
+                }
+                if (ok) {
+                    batchFillBytes += numberOfBinaryBytes;
+                    batchFillCycles++;
+                    batchCycleCounter++;
+                    batchDirty = true;
+                    bool nextSegment = false;
+                    if (rotate) {
+                        segmentBytes += numberOfBinaryBytes;
+                        if (rotateSize > 0u) {
+                            nextSegment = (segmentBytes >= rotateSize);
+                        }
+                        if ((!nextSegment) && (rotatePeriodCounts > 0u)) {
+                            nextSegment = ((HighResolutionTimer::Counter() - segmentStartCounter) >= rotatePeriodCounts);
+                        }
+                    }
+                    if (nextSegment) {
+                        ok = StartNextSegment();
+                    }
+                    else if (batchFillCycles == batchCycles) {
+                        ok = QueueBatch(false, false);
+                    }
+                    else {
+                        //NOOP
+                    }
+                }
+                batchMux.FastUnLock();
+            }
+            if (ok) {
+                ok = !batchIOError;
+            }
+        }
+        else if (fileFormat == FILE_FORMAT_BINARY) {
+            uint32 writeSize = numberOfBinaryBytes;
+            ok = outputFile.Write(dataSourceMemory, writeSize);
+            if (ok) {
+                ok = (writeSize == numberOfBinaryBytes);
+            }
+        }
+        else {
+            if ((signalsAnyType != NULL) && (signalNames != NULL) && (fullNotation > 0u)) {
+                for(uint32 i=0u; i<numberOfSignals; i++){
+                    ok = outputFile.Printf("%s = %! %s", signalNames[i].Buffer(), signalsAnyType[i], csvSeparator.Buffer());
+                }
+            }
+            else {
+                uint32 lineSize = csvEncoder.Encode();
+                ok = outputFile.Write(csvEncoder.GetBuffer(), lineSize);
+            }
+            if (refreshContent > 0u) {
+                ok = outputFile.Flush();
+            }
+        }
+        fatalFileError = !ok;
+        if (fatalFileError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to write into file. No more attempts will be performed.");
+            if (fileRuntimeErrorMsg.IsValid()) {
+                //Reset any previous replies
+                fileRuntimeErrorMsg->SetAsReply(false);
+                if (!MessageI::SendMessage(fileRuntimeErrorMsg, this)) {
+                    StreamString destination = fileRuntimeErrorMsg->GetDestination();
+                    StreamString function = fileRuntimeErrorMsg->GetFunction();
+                    REPORT_ERROR(ErrorManagement::FatalError, "Could not send TreeRuntimeError message to %s [%s]", destination.Buffer(), function.Buffer());
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType FileWriter::Execute(ExecutionInfo& info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        (void) batchQueuedSem.Reset();
+        if ((batchPending == 0) && (flightRecorderPending == 0)) {
+            (void) batchQueuedSem.Wait(BATCH_WAIT_TIMEOUT_MSEC);
+        }
+        if (flightRecorderPending > 0) {
+            if (!WriteFlightRecorderWindow()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to write the flight recorder window into the file.");
+            }
+            Atomic::Decrement(&flightRecorderPending);
+            (void) batchWrittenSem.Post();
+        }
+        else if (ioUringActive) {
+            WriteBatchesIOUring();
+        }
+        else {
+            while (batchPending > 0) {
+                /*lint -e{613} the staging buffers cannot be NULL if the I/O thread is running*/
+                if (!batchIOError) {
+                    if ((frameBuffer != NULL_PTR(char8 *)) || (chunkBuffer != NULL_PTR(char8 *))) {
+                        batchIOError = !WriteFrame(batchFlushIndex);
+                    }
+                    else {
+                        batchIOError = !WriteBatch(batchBuffers[batchFlushIndex], batchBufferBytes[batchFlushIndex]);
+                    }
+                    if (batchIOError) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Failed to write a staging buffer into the file.");
+                    }
+                }
+                if ((!batchIOError) && (batchBufferRotate[batchFlushIndex])) {
+                    batchIOError = !RotateBatchFile();
+                }
+                //On error the buffers are discarded so that the thread calling Synchronise never blocks
+                batchFlushIndex++;
+                if (batchFlushIndex == numberOfBatchBuffers) {
+                    batchFlushIndex = 0u;
+                }
+                Atomic::Decrement(&batchPending);
+                (void) batchWrittenSem.Post();
+            }
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+bool FileWriter::WriteBatch(const char8 * const buffer,
+                            const uint32 size) {
+    uint64 startCounter = HighResolutionTimer::Counter();
+    uint32 alignedSize = size - (size % batchAlignment);
+    uint64 offset = batchFileOffset;
+    bool ok = true;
+    for (uint32 done = 0u; (done < size) && (ok);) {
+        if ((done == alignedSize) && (directIOActive)) {
+            //The last partial block cannot be written with O_DIRECT
+            ok = (fcntl(batchFd, F_SETFL, fcntl(batchFd, F_GETFL) & ~O_DIRECT) == 0);
+        }
+        if (ok) {
+            uint32 toWrite = (done < alignedSize) ? (alignedSize - done) : (size - done);
+            ssize_t ret = pwrite(batchFd, &buffer[done], static_cast<size_t>(toWrite), static_cast<off_t>(offset));
+            if (ret > 0) {
+                done += static_cast<uint32>(ret);
+                offset += static_cast<uint64>(ret);
+            }
+            else {
+                ok = ((ret < 0) && (errno == EINTR));
+            }
+        }
+        if ((done == size) && (done > alignedSize) && (directIOActive)) {
+            ok = (fcntl(batchFd, F_SETFL, fcntl(batchFd, F_GETFL) | O_DIRECT) == 0);
+        }
+    }
+    if (ok) {
+        //The bytes after the last multiple of the alignment are rewritten with the next buffer
+        batchFileOffset += alignedSize;
+        if (offset > batchFileSize) {
+            batchFileSize = offset;
+        }
+        UpdateBatchStatistics(startCounter, size);
+    }
+    return ok;
+}
+
+bool FileWriter::WriteFrame(const uint32 idx) {
+    /*lint -e{613} the staging buffers cannot be NULL if the I/O thread is running*/
+    uint32 size = batchBufferBytes[idx];
+    bool ok = true;
+    if ((size > 0u) && (numberOfBinaryBytes > 0u)) {
+        //Without O_DIRECT the staging buffers only hold complete cycles
+        uint32 numberOfCycles = size / numberOfBinaryBytes;
+        uint64 firstCycle = batchRotateCycles[idx] - numberOfCycles;
+        const char8 *data = batchBuffers[idx];
+        uint32 dataSize = size;
+        if (chunkBuffer != NULL_PTR(char8 *)) {
+            ok = columnChunk.Encode(data, numberOfCycles, firstCycle, chunkBuffer, dataSize);
+            data = chunkBuffer;
+        }
+        if ((ok) && (frameBuffer != NULL_PTR(char8 *))) {
+            uint32 frameSize = 0u;
+            ok = frameCodec.Encode(data, dataSize, firstCycle, numberOfCycles, frameBuffer, frameSize);
+            data = frameBuffer;
+            dataSize = frameSize;
+        }
+        if (ok) {
+            ok = WriteBatch(data, dataSize);
+        }
+        if (ok) {
+            uncompressedBytesWritten += size;
+        }
+    }
+    return ok;
+}
+
+void FileWriter::WriteBatchesIOUring() {
+    while (batchPending > 0) {
+        bool blocked = false;
+        //Submit all the queued staging buffers (in order)
+        /*lint -e{613} the staging buffers cannot be NULL if the I/O thread is running*/
+        while ((batchSubmitted < static_cast<uint32>(batchPending)) && (!blocked)) {
+            //The buffers of the next segment are only submitted after the switch
+            blocked = batchRotatePending;
+            uint32 idx = batchSubmitIndex;
+            uint32 size = batchBufferBytes[idx];
+            if (!blocked) {
+                batchBufferDone[idx] = true;
+            }
+            if ((!blocked) && (!batchIOError) && (size > 0u)) {
+                if ((size % batchAlignment) != 0u) {
+                    //The last partial block of a final batch is written with pwrite after all the previous writes are completed
+                    blocked = (batchInFlight > 0u);
+                    if (!blocked) {
+                        batchIOError = !WriteBatch(batchBuffers[idx], size);
+                    }
+                }
+                else {
+                    batchBufferOffsets[idx] = batchFileOffset;
+                    batchBufferWritten[idx] = 0u;
+                    batchSubmitCounters[idx] = HighResolutionTimer::Counter();
+                    batchIOError = !ioRing.PrepareWrite(batchFd, idx, batchBuffers[idx], size, batchFileOffset, static_cast<uint64>(idx));
+                    if (!batchIOError) {
+                        batchBufferDone[idx] = false;
+                        batchFileOffset += size;
+                        batchInFlight++;
+                    }
+                }
+                if (batchIOError) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Failed to write a staging buffer into the file.");
+                }
+            }
+            if (!blocked) {
+                batchRotatePending = batchBufferRotate[idx];
+                batchSubmitted++;
+                batchSubmitIndex++;
+                if (batchSubmitIndex == numberOfBatchBuffers) {
+                    batchSubmitIndex = 0u;
+                }
+            }
+        }
+        //Submit and wait for (at least) one completion
+        if (batchInFlight > 0u) {
+            if (!ioRing.Enter(true)) {
+                REPORT_ERROR(ErrorManagement::FatalError, "io_uring_enter failed.");
+                batchIOError = true;
+            }
+            uint64 userData = 0u;
+            int32 result = 0;
+            while (ioRing.GetCompletion(userData, result)) {
+                uint32 idx = static_cast<uint32>(userData);
+                bool done = true;
+                if (result < 0) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Failed to write a staging buffer into the file (errno = %d).", -result);
+                    batchIOError = true;
+                }
+                else {
+                    batchBufferWritten[idx] += static_cast<uint32>(result);
+                    uint32 remaining = batchBufferBytes[idx] - batchBufferWritten[idx];
+                    if ((remaining > 0u) && (!batchIOError)) {
+                        //Short write: submit the remaining bytes
+                        done = !ioRing.PrepareWrite(batchFd, idx, &batchBuffers[idx][batchBufferWritten[idx]], remaining,
+                                                    batchBufferOffsets[idx] + batchBufferWritten[idx], userData);
+                        batchIOError = done;
+                    }
+                    else if (remaining == 0u) {
+                        uint64 end = batchBufferOffsets[idx] + batchBufferBytes[idx];
+                        if (end > batchFileSize) {
+                            batchFileSize = end;
+                        }
+                        UpdateBatchStatistics(batchSubmitCounters[idx], batchBufferBytes[idx]);
+                    }
+                    else {
+                        //NOOP
+                    }
+                }
+                if (done) {
+                    batchBufferDone[idx] = true;
+                    batchInFlight--;
+                }
+            }
+        }
+        if ((batchRotatePending) && (batchInFlight == 0u)) {
+            if (!batchIOError) {
+                batchIOError = !RotateBatchFile();
+            }
+            batchRotatePending = false;
+        }
+        //Give back the completed staging buffers (in the order they were queued)
+        while ((batchSubmitted > 0u) && (batchBufferDone[batchFlushIndex])) {
+            batchSubmitted--;
+            batchFlushIndex++;
+            if (batchFlushIndex == numberOfBatchBuffers) {
+                batchFlushIndex = 0u;
+            }
+            Atomic::Decrement(&batchPending);
+            (void) batchWrittenSem.Post();
+        }
+    }
+}
+
+void FileWriter::UpdateBatchStatistics(const uint64 startCounter,
+                                       const uint32 size) {
+    uint64 elapsed = HighResolutionTimer::Counter() - startCounter;
+    float64 elapsedUsec = static_cast<float64>(elapsed) * HighResolutionTimer::Period() * 1e6;
+    lastFlushLatency = static_cast<uint32>(elapsedUsec);
+    if (lastFlushLatency > maxFlushLatency) {
+        maxFlushLatency = lastFlushLatency;
+    }
+    numberOfBatches++;
+    batchBytesWritten += size;
+}
+
+bool FileWriter::QueueBatch(const bool finalBatch,
+                            const bool rotate) {
+    uint32 tail = batchFillBytes % batchAlignment;
+    //The bytes after the last multiple of the alignment are only written on the final batch (and rewritten with the next buffer)
+    /*lint -e{613} batchBufferBytes cannot be NULL if batchCycles > 0*/
+    batchBufferBytes[batchFillIndex] = finalBatch ? batchFillBytes : (batchFillBytes - tail);
+    batchBufferRotate[batchFillIndex] = rotate;
+    batchRotateCycles[batchFillIndex] = batchCycleCounter;
+    //Atomic::Increment is a full memory barrier: the I/O thread sees the buffer before the new batchPending
+    Atomic::Increment(&batchPending);
+    (void) batchQueuedSem.Post();
+
+    uint32 previousIndex = batchFillIndex;
+    batchFillIndex++;
+    if (batchFillIndex == numberOfBatchBuffers) {
+        batchFillIndex = 0u;
+    }
+    if (static_cast<uint32>(batchPending) >= numberOfBatchBuffers) {
+        numberOfQueueFull++;
+    }
+    bool ok = WaitBatchQueue(numberOfBatchBuffers - 1u);
+    if ((ok) && (tail > 0u) && (!rotate)) {
+        /*lint -e{613} batchBuffers cannot be NULL if batchCycles > 0*/
+        const char8 * const source = &batchBuffers[previousIndex][batchFillBytes - tail];
+        if (source != batchBuffers[batchFillIndex]) {
+            ok = MemoryOperationsHelper::Copy(batchBuffers[batchFillIndex], source, tail);
+        }
+    }
+    batchFillBytes = tail;
+    batchFillCycles = 0u;
+    batchDirty = ((!finalBatch) && (tail > 0u));
+    return ok;
+}
+
+bool FileWriter::WaitBatchQueue(const uint32 maxPending) {
+    bool ok = true;
+    while ((ok) && (static_cast<uint32>(batchPending) > maxPending)) {
+        (void) batchWrittenSem.Reset();
+        if (static_cast<uint32>(batchPending) > maxPending) {
+            (void) batchWrittenSem.Wait(BATCH_WAIT_TIMEOUT_MSEC);
+        }
+        ok = (batchExecutor.GetStatus() != EmbeddedThreadI::OffState);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "The I/O thread is not running");
+        }
+    }
+    return ok;
+}
+
+bool FileWriter::FlushBatches(const bool closeFile) {
+    bool ok = (batchMux.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        if ((batchDirty) && (batchFd >= 0)) {
+            ok = QueueBatch(true, false);
+        }
+        if (ok) {
+            ok = WaitBatchQueue(0u);
+        }
+        if (ok) {
+            ok = !batchIOError;
+        }
+        if ((closeFile) && (batchFd >= 0)) {
+            ok = (CloseBatchFile()) && (ok);
+        }
+        if ((closeFile) && (nextBatchFd >= 0)) {
+            //The preopened segment was never written
+            (void) close(nextBatchFd);
+            nextBatchFd = -1;
+            StreamString nextName;
+            if (GetSegmentFilename(segmentIndex + 1u, nextName)) {
+                (void) unlink(nextName.Buffer());
+            }
+        }
+        if ((closeFile) && (indexFile.IsOpen())) {
+            ok = (indexFile.Close()) && (ok);
+        }
+        batchMux.FastUnLock();
+    }
+    return ok;
+}
+
+bool FileWriter::OpenBatchFile() {
+    bool ok = outputFile.Flush();
+    if (ok) {
+        ok = (batchMux.FastLock() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        batchFd = open(segmentFilename.Buffer(), O_RDWR);
+        ok = (batchFd >= 0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not open %s for the I/O thread", segmentFilename.Buffer());
+        }
+        directIOActive = false;
+        batchAlignment = 1u;
+        if (headerBytes != NULL_PTR(char8 *)) {
+            delete[] headerBytes;
+        }
+        uint32 headerSize = static_cast<uint32>(headerPositionMarker);
+        headerBytes = new char8[headerSize];
+        if (ok) {
+            //The header was written through the page cache, so that it can be read without O_DIRECT
+            ok = (pread(batchFd, headerBytes, static_cast<size_t>(headerSize), 0) == static_cast<ssize_t>(headerSize));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not read the header of %s", segmentFilename.Buffer());
+            }
+        }
+        if ((ok) && (directIO)) {
+            directIOActive = (fcntl(batchFd, F_SETFL, fcntl(batchFd, F_GETFL) | O_DIRECT) == 0);
+            if (directIOActive) {
+                batchAlignment = static_cast<uint32>(sysconf(_SC_PAGESIZE));
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::Warning, "O_DIRECT is not supported for %s. Writing through the page cache.", segmentFilename.Buffer());
+            }
+        }
+        if (ok) {
+            ok = PrepareBatchFile(batchFd);
+        }
+        //The first write starts at the last multiple of the alignment before the end of the header and rewrites the last header bytes
+        uint32 headerTail = headerSize % batchAlignment;
+        batchFileOffset = headerPositionMarker - headerTail;
+        batchFileSize = headerPositionMarker;
+        batchFillCycles = 0u;
+        batchCycleCounter = 0u;
+        batchDirty = false;
+        segmentBytes = 0u;
+        segmentStartCounter = HighResolutionTimer::Counter();
+        if (ok) {
+            /*lint -e{613} batchBuffers cannot be NULL if batchCycles > 0*/
+            ok = MemoryOperationsHelper::Copy(batchBuffers[batchFillIndex], &headerBytes[headerSize - headerTail], headerTail);
+        }
+        batchFillBytes = ok ? headerTail : 0u;
+        if ((ok) && (rotate)) {
+            StreamString indexFilename = filename;
+            indexFilename += ".idx";
+            Directory indexToDelete(indexFilename.Buffer());
+            (void) indexToDelete.Delete();
+            ok = indexFile.Open(indexFilename.Buffer(), (BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT));
+            if (ok) {
+                ok = indexFile.Printf("%s", "#Cycle;File;Offset\n");
+            }
+            if (ok) {
+                ok = indexFile.Printf("%u;%s;%!\n", 0u, segmentFilename.Buffer(), headerPositionMarker);
+            }
+            if (ok) {
+                ok = indexFile.Flush();
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not write the index file %s", indexFilename.Buffer());
+            }
+            if (ok) {
+                ok = OpenNextSegment();
+            }
+        }
+        batchIOError = !ok;
+        batchMux.FastUnLock();
+    }
+    return ok;
+}
+
+bool FileWriter::PrepareBatchFile(const int32 fd) {
+    bool ok = true;
+    if (directIOActive) {
+        ok = (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_DIRECT) == 0);
+    }
+    if ((ok) && (preallocateSize > 0u)) {
+        if (posix_fallocate(fd, static_cast<off_t>(headerPositionMarker), static_cast<off_t>(preallocateSize)) != 0) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not preallocate %! bytes for %s", preallocateSize, filename.Buffer());
+        }
+    }
+    return ok;
+}
+
+bool FileWriter::CloseBatchFile() {
+    if (preallocateSize > 0u) {
+        if (ftruncate(batchFd, static_cast<off_t>(batchFileSize)) != 0) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not truncate the preallocated file to %! bytes", batchFileSize);
+        }
+    }
+    bool ok = (close(batchFd) == 0);
+    batchFd = -1;
+    return ok;
+}
+
+bool FileWriter::StartNextSegment() {
+    bool ok = QueueBatch(true, true);
+    if (ok) {
+        //The next staging buffer starts with the end of the header of the next segment
+        uint32 headerSize = static_cast<uint32>(headerPositionMarker);
+        uint32 headerTail = headerSize % batchAlignment;
+        /*lint -e{613} batchBuffers and headerBytes cannot be NULL if the file is open*/
+        ok = MemoryOperationsHelper::Copy(batchBuffers[batchFillIndex], &headerBytes[headerSize - headerTail], headerTail);
+        batchFillBytes = headerTail;
+        batchDirty = false;
+    }
+    segmentBytes = 0u;
+    segmentStartCounter = HighResolutionTimer::Counter();
+    return ok;
+}
+
+bool FileWriter::RotateBatchFile() {
+    uint64 firstCycle = batchRotateCycles[batchFlushIndex];
+    if (batchRotatePending) {
+        //io_uring: the buffer which ended the segment was the last one submitted
+        uint32 idx = (batchSubmitIndex == 0u) ? (numberOfBatchBuffers - 1u) : (batchSubmitIndex - 1u);
+        firstCycle = batchRotateCycles[idx];
+    }
+    bool ok = CloseBatchFile();
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not close the segment %u", segmentIndex);
+    }
+    batchFd = nextBatchFd;
+    nextBatchFd = -1;
+    segmentIndex++;
+    if (ok) {
+        ok = (batchFd >= 0);
+    }
+    StreamString name;
+    if (ok) {
+        ok = GetSegmentFilename(segmentIndex, name);
+    }
+    if (ok) {
+        uint32 headerTail = static_cast<uint32>(headerPositionMarker % batchAlignment);
+        batchFileOffset = headerPositionMarker - headerTail;
+        batchFileSize = headerPositionMarker;
+        ok = indexFile.Printf("%!;%s;%!\n", firstCycle, name.Buffer(), headerPositionMarker);
+        if (ok) {
+            ok = indexFile.Flush();
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not write the index of the segment %s", name.Buffer());
+        }
+    }
+    if (ok) {
+        ok = OpenNextSegment();
+    }
+    return ok;
+}
+
+bool FileWriter::OpenNextSegment() {
+    StreamString name;
+    bool ok = GetSegmentFilename(segmentIndex + 1u, name);
+    if (ok) {
+        int32 flags = (O_RDWR | O_CREAT | O_TRUNC);
+        if (!overwrite) {
+            flags |= O_EXCL;
+        }
+        nextBatchFd = open(name.Buffer(), flags, 0644);
+        ok = (nextBatchFd >= 0);
+    }
+    if (ok) {
+        //The header is written through the page cache (O_DIRECT is set afterwards)
+        ok = (pwrite(nextBatchFd, headerBytes, static_cast<size_t>(headerPositionMarker), 0) == static_cast<ssize_t>(headerPositionMarker));
+    }
+    if (ok) {
+        ok = PrepareBatchFile(nextBatchFd);
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create the segment %s", name.Buffer());
+    }
+    return ok;
+}
+
+bool FileWriter::GetSegmentFilename(const uint32 segment,
+                                    StreamString &segmentName) const {
+    const char8 * const name = filename.Buffer();
+    uint32 size = static_cast<uint32>(filename.Size());
+    //The index of the extension dot (only in the last component of the path)
+    uint32 extension = size;
+    bool found = false;
+    for (uint32 i = size; (i > 0u) && (!found); i--) {
+        if (name[i - 1u] == '.') {
+            extension = i - 1u;
+            found = true;
+        }
+        else if (name[i - 1u] == '/') {
+            found = true;
+        }
+        else {
+            //NOOP
+        }
+    }
+    segmentName = "";
+    uint32 prefixSize = extension;
+    bool ok = segmentName.Write(name, prefixSize);
+    if (ok) {
+        ok = segmentName.Printf("_%03u%s", segment, &name[extension]);
+    }
+    return ok;
+}
+
+bool FileWriter::OpenFlightRecorder() {
+    const uint32 SIGNAL_NAME_MAX_SIZE = 32u;
+    uint32 nOfSignals = GetNumberOfSignals();
+    uint64 pageSize = static_cast<uint64>(sysconf(_SC_PAGESIZE));
+    //The FileWriterFlightRecorderHeader and the binary header of the signals, rounded up to a multiple of the page size
+    uint64 headerSize = static_cast<uint64>(sizeof(FileWriterFlightRecorderHeader)) + sizeof(uint32);
+    headerSize += static_cast<uint64>(nOfSignals) * (sizeof(uint16) + SIGNAL_NAME_MAX_SIZE + sizeof(uint32));
+    headerSize = ((headerSize + pageSize - 1u) / pageSize) * pageSize;
+    flightRecorderSize = headerSize + (static_cast<uint64>(numberOfBinaryBytes) * flightRecorderCycles);
+    bool ok = true;
+    int32 flags = MAP_SHARED;
+    if (flightRecorderFile.Size() > 0u) {
+        flightRecorderFd = open(flightRecorderFile.Buffer(), O_RDWR | O_CREAT, 0644);
+        ok = (flightRecorderFd >= 0);
+        if (ok) {
+            ok = (ftruncate(flightRecorderFd, static_cast<off_t>(flightRecorderSize)) == 0);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not create the FlightRecorderFile %s with %! bytes", flightRecorderFile.Buffer(), flightRecorderSize);
+        }
+    }
+    else {
+        flags |= MAP_ANONYMOUS;
+    }
+    if (ok) {
+        void *mem = mmap(NULL_PTR(void *), static_cast<size_t>(flightRecorderSize), PROT_READ | PROT_WRITE, flags, flightRecorderFd, 0);
+        ok = (mem != MAP_FAILED);
+        if (ok) {
+            flightRecorderMemory = static_cast<char8 *>(mem);
+            (void) placement.BindMemory(mem, flightRecorderSize);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not map %! bytes for the flight recorder ring", flightRecorderSize);
+        }
+    }
+    if (ok) {
+        /*lint -e{927} -e{826} the header is at the (page aligned) beginning of the mapping*/
+        flightRecorderHeader = reinterpret_cast<FileWriterFlightRecorderHeader *>(flightRecorderMemory);
+        flightRecorderHeader->magic = FILE_WRITER_FLIGHT_RECORDER_MAGIC;
+        flightRecorderHeader->cycleSize = numberOfBinaryBytes;
+        flightRecorderHeader->numberOfCycles = flightRecorderCycles;
+        flightRecorderHeader->dataOffset = static_cast<uint32>(headerSize);
+        flightRecorderHeader->cyclesWritten = 0u;
+        flightRecorderSlots = &flightRecorderMemory[headerSize];
+        //The binary header of the signals (as written in the file)
+        char8 *header = &flightRecorderMemory[sizeof(FileWriterFlightRecorderHeader)];
+        ok = MemoryOperationsHelper::Copy(header, &nOfSignals, static_cast<uint32>(sizeof(uint32)));
+        header = &header[sizeof(uint32)];
+        for (uint32 n = 0u; (n < nOfSignals) && (ok); n++) {
+            uint16 signalType = GetSignalType(n).all;
+            StreamString signalName;
+            uint32 nOfElements = 0u;
+            ok = MemoryOperationsHelper::Copy(header, &signalType, static_cast<uint32>(sizeof(uint16)));
+            header = &header[sizeof(uint16)];
+            if (ok) {
+                ok = GetSignalName(n, signalName);
+            }
+            if (ok) {
+                uint32 copySize = static_cast<uint32>(signalName.Size());
+                if (copySize > SIGNAL_NAME_MAX_SIZE) {
+                    copySize = SIGNAL_NAME_MAX_SIZE;
+                }
+                //The mapping is zero filled
+                ok = MemoryOperationsHelper::Copy(header, signalName.Buffer(), copySize);
+                header = &header[SIGNAL_NAME_MAX_SIZE];
+            }
+            if (ok) {
+                ok = GetSignalNumberOfElements(n, nOfElements);
+            }
+            if (ok) {
+                ok = MemoryOperationsHelper::Copy(header, &nOfElements, static_cast<uint32>(sizeof(uint32)));
+                header = &header[sizeof(uint32)];
+            }
+        }
+    }
+    return ok;
+}
+
+bool FileWriter::RecordCycle() {
+    /*lint -e{613} flightRecorderHeader and flightRecorderSlots cannot be NULL if flightRecorderCycles > 0*/
+    uint64 cycle = flightRecorderHeader->cyclesWritten;
+    uint64 slot = cycle % flightRecorderCycles;
+    bool ok = MemoryOperationsHelper::Copy(&flightRecorderSlots[slot * numberOfBinaryBytes], dataSourceMemory, numberOfBinaryBytes);
+    flightRecorderHeader->cyclesWritten = cycle + 1u;
+    /*lint -e{613} dataSourceMemory cannot be NULL*/
+    bool trigger = (static_cast<uint8>(dataSourceMemory[0]) == 1u);
+    if (flightRecorderTriggered) {
+        if (trigger) {
+            flightRecorderMissedTriggers++;
+        }
+        flightRecorderPostCycles--;
+    }
+    else if (trigger) {
+        if (flightRecorderPending == 0) {
+            flightRecorderTriggered = true;
+            flightRecorderPostCycles = numberOfPostTriggers;
+            flightRecorderFirstCycle = (cycle > numberOfPreTriggers) ? (cycle - numberOfPreTriggers) : (0u);
+            flightRecorderWindowCycles = static_cast<uint32>(cycle - flightRecorderFirstCycle) + 1u + numberOfPostTriggers;
+        }
+        else {
+            flightRecorderMissedTriggers++;
+        }
+    }
+    else {
+        //NOOP
+    }
+    if ((flightRecorderTriggered) && (flightRecorderPostCycles == 0u)) {
+        flightRecorderTriggered = false;
+        //Atomic::Increment is a full memory barrier: the I/O thread sees the window before the new flightRecorderPending
+        Atomic::Increment(&flightRecorderPending);
+        (void) batchQueuedSem.Post();
+    }
+    return ok;
+}
+
+bool FileWriter::WriteFlightRecorderWindow() {
+    uint64 firstCycle = flightRecorderFirstCycle;
+    uint32 windowCycles = flightRecorderWindowCycles;
+    //Writes of at most 1 GB (but at least one cycle)
+    uint32 maxChunkCycles = (numberOfBinaryBytes < 0x40000000u) ? (0x40000000u / numberOfBinaryBytes) : (1u);
+    bool ok = (batchMux.FastLock() == ErrorManagement::NoError);
     if (ok) {
-        if (refreshContent > 0u) {
-            (void) outputFile.Seek(headerPositionMarker);
-            (void) outputFile.SetSize(headerPositionMarker);
+        ok = ((outputFile.IsOpen()) && (!fatalFileError));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "The file is not open. The flight recorder window is discarded.");
         }
-
-        if (fileFormat == FILE_FORMAT_BINARY) {
-            uint32 writeSize = numberOfBinaryBytes;
-            ok = outputFile.Write(dataSourceMemory, writeSize);
-            if (ok) {
-                ok = (writeSize == numberOfBinaryBytes);
+        //The window is written directly from the ring, in (at most) two contiguous parts
+        uint32 done = 0u;
+        while ((ok) && (done < windowCycles)) {
+            uint64 startCounter = HighResolutionTimer::Counter();
+            uint32 slot = static_cast<uint32>((firstCycle + done) % flightRecorderCycles);
+            uint32 chunkCycles = windowCycles - done;
+            if (chunkCycles > (flightRecorderCycles - slot)) {
+                chunkCycles = flightRecorderCycles - slot;
             }
-        }
-        else {
-            if ((signalsAnyType != NULL) && (fullNotation > 0u)) {
-                for(uint32 i=0u; i<numberOfSignals; i++){
-                    StreamString signalName;
-                    (void)GetSignalName(i, signalName);
-                    ok = outputFile.Printf("%s = %! %s", signalName.Buffer(), signalsAnyType[i], csvSeparator.Buffer());
-                }
+            if (chunkCycles > maxChunkCycles) {
+                chunkCycles = maxChunkCycles;
             }
-            else {
-                ok = outputFile.PrintFormatted(csvPrintfFormat.Buffer(), signalsAnyType);
+            uint32 size = chunkCycles * numberOfBinaryBytes;
+            uint32 writeSize = size;
+            /*lint -e{613} flightRecorderSlots cannot be NULL if flightRecorderCycles > 0*/
+            ok = outputFile.Write(&flightRecorderSlots[static_cast<uint64>(slot) * numberOfBinaryBytes], writeSize);
+            if (ok) {
+                ok = (writeSize == size);
             }
-            if (refreshContent > 0u) {
-                ok = outputFile.Flush();
+            if (ok) {
+                UpdateBatchStatistics(startCounter, size);
             }
+            done += chunkCycles;
         }
-        fatalFileError = !ok;
-        if (fatalFileError) {
-            REPORT_ERROR(ErrorManagement::FatalError, "Failed to write into file. No more attempts will be performed.");
-            if (fileRuntimeErrorMsg.IsValid()) {
-                //Reset any previous replies
-                fileRuntimeErrorMsg->SetAsReply(false);
-                if (!MessageI::SendMessage(fileRuntimeErrorMsg, this)) {
-                    StreamString destination = fileRuntimeErrorMsg->GetDestination();
-                    StreamString function = fileRuntimeErrorMsg->GetFunction();
-                    REPORT_ERROR(ErrorManagement::FatalError, "Could not send TreeRuntimeError message to %s [%s]", destination.Buffer(), function.Buffer());
-                }
-            }
+        if (ok) {
+            ok = outputFile.Flush();
+        }
+        batchMux.FastUnLock();
+    }
+    if (ok) {
+        flightRecorderDumps++;
+    }
+    //The slot of the first cycle is overwritten when the cycle firstCycle + flightRecorderCycles is copied
+    /*lint -e{613} flightRecorderHeader cannot be NULL if flightRecorderCycles > 0*/
+    if (flightRecorderHeader->cyclesWritten >= (firstCycle + flightRecorderCycles)) {
+        flightRecorderOverruns++;
+        REPORT_ERROR(ErrorManagement::Warning, "The flight recorder window was (partially) overwritten before being written");
+    }
+    return ok;
+}
+
+bool FileWriter::WaitFlightRecorder() {
+    bool ok = true;
+    while ((ok) && (flightRecorderPending > 0)) {
+        (void) batchWrittenSem.Reset();
+        if (flightRecorderPending > 0) {
+            (void) batchWrittenSem.Wait(BATCH_WAIT_TIMEOUT_MSEC);
+        }
+        ok = (batchExecutor.GetStatus() != EmbeddedThreadI::OffState);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "The I/O thread is not running");
         }
     }
     return ok;
@@ -222,6 +1141,16 @@ bool FileWriter::Initialise(StructuredDataI& data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfBuffers shall be > 0u");
         }
     }
+    if (ok) {
+        StreamString heapName;
+        if (data.Read("HeapName", heapName)) {
+            memoryHeap = HeapManager::FindHeap(heapName.Buffer());
+            ok = (memoryHeap != NULL_PTR(HeapI *));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Could not find a heap named %s", heapName.Buffer());
+            }
+        }
+    }
     if (ok) {
         // TODO (WARNING) CHANGE FORMAT TO SUPPORT MORE THAN 32 cpus!
         uint32 cpuMaskIn;
@@ -233,6 +1162,13 @@ bool FileWriter::Initialise(StructuredDataI& data) {
             cpuMask = ProcessorType(cpuMaskIn);
         }
     }
+    if (ok) {
+        ok = placement.Initialise(data);
+        if ((ok) && (placement.HasCPUMask())) {
+            //Also used by the brokers which flush the data.
+            cpuMask = placement.GetCPUMask();
+        }
+    }
     if (ok) {
         ok = data.Read("StackSize", stackSize);
         if (!ok) {
@@ -269,6 +1205,15 @@ bool FileWriter::Initialise(StructuredDataI& data) {
             if (!ok) {
                 REPORT_ERROR(ErrorManagement::ParametersError, "FileFormat=csv and CSVSeparator was not specified");
             }
+            if (ok) {
+                if (!data.Read("CSVFloatFormat", csvFloatFormat)) {
+                    csvFloatFormat = "fixed";
+                }
+                ok = ((csvFloatFormat == "fixed") || (csvFloatFormat == "shortest"));
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Invalid CSVFloatFormat %s. Possible values are: fixed and shortest", csvFloatFormat.Buffer());
+                }
+            }
         }
     }
     if (ok) {
@@ -335,6 +1280,127 @@ bool FileWriter::Initialise(StructuredDataI& data) {
         //    fullNotation = 0u;
         //}
     }
+    if (ok) {
+        if (!data.Read("BatchCycles", batchCycles)) {
+            batchCycles = 0u;
+        }
+        if (batchCycles > 0u) {
+            ok = ((fileFormat == FILE_FORMAT_BINARY) && (refreshContent == 0u));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "BatchCycles is only supported with FileFormat = binary and RefreshContent = 0");
+            }
+            if (ok) {
+                if (!data.Read("NumberOfBatchBuffers", numberOfBatchBuffers)) {
+                    numberOfBatchBuffers = 4u;
+                }
+                ok = (numberOfBatchBuffers > 0u);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfBatchBuffers shall be > 0u");
+                }
+            }
+            if (ok) {
+                uint8 directIOU = 0u;
+                if (!data.Read("DirectIO", directIOU)) {
+                    directIOU = 0u;
+                }
+                directIO = (directIOU == 1u);
+                if (!data.Read("PreallocateSize", preallocateSize)) {
+                    preallocateSize = 0u;
+                }
+                if (!data.Read("IOBackend", ioBackend)) {
+                    ioBackend = "pwrite";
+                }
+                ok = ((ioBackend == "pwrite") || (ioBackend == "io_uring"));
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Invalid IOBackend %s. Possible values are: pwrite and io_uring", ioBackend.Buffer());
+                }
+            }
+        }
+        if (!data.Read("RotateSize", rotateSize)) {
+            rotateSize = 0u;
+        }
+        if (!data.Read("RotatePeriod", rotatePeriod)) {
+            rotatePeriod = 0u;
+        }
+        if (!data.Read("Compression", compression)) {
+            compression = "none";
+        }
+        if (!data.Read("CompressionLevel", compressionLevel)) {
+            compressionLevel = 3;
+        }
+        if (ok) {
+            ok = frameCodec.SetCodec(compression.Buffer(), compressionLevel);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Invalid Compression %s. Possible values are: none, lz4 and zstd (only if compiled with ZSTD_DIR)",
+                             compression.Buffer());
+            }
+        }
+        if ((ok) && (frameCodec.GetCodec() != FILE_FRAME_CODEC_NONE)) {
+            ok = ((batchCycles > 0u) && (!directIO) && (ioBackend == "pwrite"));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Compression is only supported with BatchCycles > 0, DirectIO = 0 and IOBackend = pwrite");
+            }
+        }
+        if (!data.Read("Layout", layout)) {
+            layout = "row";
+        }
+        if (ok) {
+            ok = ((layout == "row") || (layout == "columnar"));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Invalid Layout %s. Possible values are: row and columnar", layout.Buffer());
+            }
+        }
+        if ((ok) && (layout == "columnar")) {
+            ok = ((batchCycles > 0u) && (!directIO) && (ioBackend == "pwrite"));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Layout = columnar is only supported with BatchCycles > 0, DirectIO = 0 and IOBackend = pwrite");
+            }
+        }
+        rotatePeriodCounts = static_cast<uint64>(static_cast<float64>(rotatePeriod) * static_cast<float64>(HighResolutionTimer::Frequency()));
+        rotate = ((rotateSize > 0u) || (rotatePeriod > 0u));
+        if ((ok) && (rotate)) {
+            ok = (batchCycles > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "RotateSize and RotatePeriod are only supported with BatchCycles > 0");
+            }
+        }
+    }
+    if (ok) {
+        if (!data.Read("FlightRecorderCycles", flightRecorderCycles)) {
+            flightRecorderCycles = 0u;
+        }
+        if (flightRecorderCycles > 0u) {
+            ok = ((fileFormat == FILE_FORMAT_BINARY) && (!storeOnTrigger) && (refreshContent == 0u) && (batchCycles == 0u));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError,
+                             "FlightRecorderCycles is only supported with FileFormat = binary, StoreOnTrigger = 0, RefreshContent = 0 and BatchCycles = 0");
+            }
+            if (ok) {
+                ok = data.Read("NumberOfPreTriggers", numberOfPreTriggers);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfPreTriggers shall be specified");
+                }
+            }
+            if (ok) {
+                ok = data.Read("NumberOfPostTriggers", numberOfPostTriggers);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfPostTriggers shall be specified");
+                }
+            }
+            if (ok) {
+                //The RT thread shall not overwrite the window while it is being written (see FlightRecorderOverruns)
+                ok = ((static_cast<uint64>(numberOfPreTriggers) + numberOfPostTriggers + 1u) < flightRecorderCycles);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfPreTriggers + NumberOfPostTriggers + 1 shall be < FlightRecorderCycles");
+                }
+            }
+            if (ok) {
+                if (!data.Read("FlightRecorderFile", flightRecorderFile)) {
+                    flightRecorderFile = "";
+                }
+            }
+        }
+    }
 
     if (ok) {
         ok = data.MoveRelative("Signals");
@@ -438,7 +1504,139 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
     }
     //Allocate memory
     if (ok) {
-        dataSourceMemory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(numberOfBinaryBytes));
+        dataSourceMemory = reinterpret_cast<char8 *>(memoryHeap->Malloc(numberOfBinaryBytes));
+        ok = (dataSourceMemory != NULL_PTR(char8 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate %u bytes for the signals", numberOfBinaryBytes);
+        }
+        else {
+            (void) placement.BindMemory(dataSourceMemory, numberOfBinaryBytes);
+        }
+    }
+    //Allocate the staging buffers and start the I/O thread
+    if ((ok) && (batchCycles > 0u) && (batchBuffers == NULL_PTR(char8 **))) {
+        uint32 pageSize = static_cast<uint32>(sysconf(_SC_PAGESIZE));
+        //Room for the bytes carried from the previous buffer (< pageSize) and rounded up to a multiple of the page size
+        uint64 bufferSize = static_cast<uint64>(pageSize) + (static_cast<uint64>(numberOfBinaryBytes) * batchCycles);
+        bufferSize = ((bufferSize + pageSize - 1u) / pageSize) * pageSize;
+        ok = (bufferSize <= 0xFFFFFFFFu);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The staging buffers (BatchCycles * %u bytes) shall be smaller than 4 GB", numberOfBinaryBytes);
+        }
+        if (ok) {
+            batchBufferSize = static_cast<uint32>(bufferSize);
+            batchBuffers = new char8*[numberOfBatchBuffers];
+            batchBufferBytes = new uint32[numberOfBatchBuffers];
+            batchBufferRotate = new bool[numberOfBatchBuffers];
+            batchRotateCycles = new uint64[numberOfBatchBuffers];
+            for (uint32 i = 0u; i < numberOfBatchBuffers; i++) {
+                void *mem = NULL_PTR(void *);
+                if (ok) {
+                    ok = (posix_memalign(&mem, static_cast<size_t>(pageSize), static_cast<size_t>(batchBufferSize)) == 0);
+                }
+                batchBuffers[i] = static_cast<char8 *>(mem);
+                if (ok) {
+                    (void) placement.BindMemory(mem, batchBufferSize);
+                }
+                batchBufferBytes[i] = 0u;
+                batchBufferRotate[i] = false;
+                batchRotateCycles[i] = 0u;
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate %u staging buffers of %u bytes", numberOfBatchBuffers, batchBufferSize);
+            }
+        }
+        uint32 frameDataSize = batchBufferSize;
+        if ((ok) && (layout == "columnar")) {
+            uint32 nOfSignals = GetNumberOfSignals();
+            uint32 *signalByteSizes = new uint32[nOfSignals];
+            for (uint32 n = 0u; (n < nOfSignals) && (ok); n++) {
+                ok = GetSignalByteSize(n, signalByteSizes[n]);
+            }
+            if (ok) {
+                ok = columnChunk.SetSignals(nOfSignals, signalByteSizes);
+            }
+            delete[] signalByteSizes;
+            if (ok) {
+                frameDataSize = columnChunk.GetChunkSize(batchCycles);
+                ok = (frameDataSize < 0xFFFFFFFFu);
+            }
+            if (ok) {
+                chunkBuffer = new char8[frameDataSize];
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The columnar chunks of %u cycles shall be smaller than 4 GB", batchCycles);
+            }
+        }
+        if ((ok) && (frameCodec.GetCodec() != FILE_FRAME_CODEC_NONE)) {
+            uint32 frameBufferSize = frameCodec.GetMaxFrameSize(frameDataSize);
+            ok = (frameBufferSize < 0xFFFFFFFFu);
+            if (ok) {
+                frameBuffer = new char8[frameBufferSize];
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The compressed frames of %u bytes shall be smaller than 4 GB", frameDataSize);
+            }
+        }
+        if ((ok) && (ioBackend == "io_uring")) {
+            ioUringActive = ioRing.Open(numberOfBatchBuffers);
+            if (ioUringActive) {
+                batchBufferDone = new bool[numberOfBatchBuffers];
+                batchBufferOffsets = new uint64[numberOfBatchBuffers];
+                batchBufferWritten = new uint32[numberOfBatchBuffers];
+                batchSubmitCounters = new uint64[numberOfBatchBuffers];
+                for (uint32 i = 0u; i < numberOfBatchBuffers; i++) {
+                    batchBufferDone[i] = true;
+                    batchBufferOffsets[i] = 0u;
+                    batchBufferWritten[i] = 0u;
+                    batchSubmitCounters[i] = 0u;
+                }
+                if (!ioRing.RegisterBuffers(batchBuffers, numberOfBatchBuffers, batchBufferSize)) {
+                    REPORT_ERROR(ErrorManagement::Warning, "Could not register the staging buffers with the io_uring (see RLIMIT_MEMLOCK). Writing with IORING_OP_WRITEV.");
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::Warning, "io_uring is not supported by the kernel. Writing with pwrite.");
+            }
+        }
+        if (ok) {
+            batchExecutor.SetName(GetName());
+            batchExecutor.SetCPUMask(cpuMask);
+            placement.Apply(batchExecutor);
+            batchExecutor.SetStackSize(stackSize);
+            ok = batchExecutor.Start();
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the I/O thread");
+            }
+        }
+    }
+
+    //Map the flight recorder ring and start the I/O thread
+    if ((ok) && (flightRecorderCycles > 0u) && (flightRecorderMemory == NULL_PTR(char8 *))) {
+        ok = (GetSignalType(0u) == UnsignedInteger8Bit);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The first signal (Trigger) shall have type uint8");
+        }
+        if (ok) {
+            uint32 nOfSignals = GetNumberOfSignals();
+            ok = (nOfSignals > 1u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "At least one signal (apart from the Trigger) shall be set");
+            }
+        }
+        if (ok) {
+            ok = OpenFlightRecorder();
+        }
+        if (ok) {
+            batchExecutor.SetName(GetName());
+            batchExecutor.SetCPUMask(cpuMask);
+            placement.Apply(batchExecutor);
+            batchExecutor.SetStackSize(stackSize);
+            ok = batchExecutor.Start();
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the I/O thread");
+            }
+        }
     }
 
     //If the type is text prepare the Printf properties in advanced
@@ -447,6 +1645,13 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
         uint32 n;
         if (ok) {
             signalsAnyType = new AnyType[nOfSignals];
+            ok = csvEncoder.SetNumberOfSignals(nOfSignals);
+        }
+        if ((ok) && (fullNotation > 0u)) {
+            signalNames = new StreamString[nOfSignals];
+            for (n = 0u; (n < nOfSignals) && (ok); n++) {
+                ok = GetSignalName(n, signalNames[n]);
+            }
         }
 
         for (n = 0u; (n < nOfSignals) && (ok); n++) {
@@ -490,6 +1695,16 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
                     REPORT_ERROR(ErrorManagement::ParametersError, "Unsupported signal type.");
                 }
             }
+            /*lint -e{613} dataSourceMemory and offsets cannot be null as otherwise ok would be false*/
+            if (ok) {
+                ok = csvEncoder.SetSignal(n, signalType, &dataSourceMemory[offsets[n]], nElements, (nDimensions > 0u));
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Unsupported signal type.");
+                }
+            }
+        }
+        if (ok) {
+            ok = csvEncoder.Compile(csvSeparator.Buffer(), (csvFloatFormat == "shortest"));
         }
         if (ok) {
             ok = csvPrintfFormat.Printf("%s", "\n");
@@ -505,20 +1720,42 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
 }
 
 ErrorManagement::ErrorType FileWriter::OpenFile(StreamString filenameIn) {
+    bool flightRecorderLocked = false;
+    if (flightRecorderCycles > 0u) {
+        //Write the queued window to the previous file
+        if (!WaitFlightRecorder()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to write the flight recorder window into %s", filename.Buffer());
+        }
+        //The I/O thread does not write while the file is being (re)opened
+        flightRecorderLocked = (batchMux.FastLock() == ErrorManagement::NoError);
+    }
+    if (batchFd >= 0) {
+        //Write all the staging buffers to the previous file
+        if (!FlushBatches(true)) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to write the staging buffers into %s", filename.Buffer());
+        }
+    }
     filename = filenameIn;
-    REPORT_ERROR(ErrorManagement::Information, "Going to open file with name %s", filename.Buffer());
+    segmentFilename = filename;
+    segmentIndex = 0u;
+    if (rotate) {
+        if (!GetSegmentFilename(0u, segmentFilename)) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not set the name of the first segment of %s", filename.Buffer());
+        }
+    }
+    REPORT_ERROR(ErrorManagement::Information, "Going to open file with name %s", segmentFilename.Buffer());
     if (!overwrite) {
         //File already exists!
-        fatalFileError = outputFile.Open(filename.Buffer(), (BasicFile::ACCESS_MODE_R));
+        fatalFileError = outputFile.Open(segmentFilename.Buffer(), (BasicFile::ACCESS_MODE_R));
         if (fatalFileError) {
             (void) outputFile.Close();
             REPORT_ERROR(ErrorManagement::FatalError, "File %s already exists and Overwrite=no", filenameIn.Buffer());
         }
     }
     if (!fatalFileError) {
-        Directory fileToDelete(filename.Buffer());
+        Directory fileToDelete(segmentFilename.Buffer());
         (void) fileToDelete.Delete();
-        fatalFileError = !outputFile.Open(filename.Buffer(), (BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT));
+        fatalFileError = !outputFile.Open(segmentFilename.Buffer(), (BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT));
     }
 
     if (!fatalFileError) {
@@ -607,6 +1844,10 @@ ErrorManagement::ErrorType FileWriter::OpenFile(StreamString filenameIn) {
             }
         }
 
+        if ((!fatalFileError) && (batchCycles > 0u)) {
+            fatalFileError = !OpenBatchFile();
+        }
+
         if (fileOpenedOKMsg.IsValid()) {
             //Reset any previous replies
             fileOpenedOKMsg->SetAsReply(false);
@@ -628,16 +1869,32 @@ ErrorManagement::ErrorType FileWriter::OpenFile(StreamString filenameIn) {
             }
         }
     }
+    if (flightRecorderLocked) {
+        batchMux.FastUnLock();
+    }
     ErrorManagement::ErrorType ret(!fatalFileError);
     return ret;
 }
 
 ErrorManagement::ErrorType FileWriter::CloseFile() {
     ErrorManagement::ErrorType err = FlushFile();
+    if ((err.ErrorsCleared()) && (batchCycles > 0u)) {
+        if (!FlushBatches(true)) {
+            err = ErrorManagement::FatalError;
+        }
+    }
     if (err.ErrorsCleared()) {
+        //The I/O thread does not write while the file is being closed
+        bool flightRecorderLocked = false;
+        if (flightRecorderCycles > 0u) {
+            flightRecorderLocked = (batchMux.FastLock() == ErrorManagement::NoError);
+        }
         if (outputFile.IsOpen()) {
             err = !outputFile.Close();
         }
+        if (flightRecorderLocked) {
+            batchMux.FastUnLock();
+        }
         if (err.ErrorsCleared()) {
             if (fileClosedMsg.IsValid()) {
                 //Reset any previous replies
@@ -670,6 +1927,12 @@ ErrorManagement::ErrorType FileWriter::FlushFile() {
             ok = outputFile.Flush();
         }
     }
+    if ((ok) && (batchCycles > 0u)) {
+        ok = FlushBatches(false);
+    }
+    if ((ok) && (flightRecorderCycles > 0u)) {
+        ok = WaitFlightRecorder();
+    }
 
     ErrorManagement::ErrorType err(ok);
     return err;
@@ -716,6 +1979,109 @@ bool FileWriter::IsOverwrite() const {
     return overwrite;
 }
 
+uint32 FileWriter::GetBatchCycles() const {
+    return batchCycles;
+}
+
+uint32 FileWriter::GetNumberOfBatchBuffers() const {
+    return numberOfBatchBuffers;
+}
+
+bool FileWriter::IsDirectIO() const {
+    return directIO;
+}
+
+const StreamString& FileWriter::GetCSVFloatFormat() const {
+    return csvFloatFormat;
+}
+
+const StreamString& FileWriter::GetIOBackend() const {
+    return ioBackend;
+}
+
+const StreamString& FileWriter::GetCompression() const {
+    return compression;
+}
+
+const StreamString& FileWriter::GetLayout() const {
+    return layout;
+}
+
+uint64 FileWriter::GetRotateSize() const {
+    return rotateSize;
+}
+
+uint32 FileWriter::GetRotatePeriod() const {
+    return rotatePeriod;
+}
+
+uint32 FileWriter::GetFlightRecorderCycles() const {
+    return flightRecorderCycles;
+}
+
+const StreamString& FileWriter::GetFlightRecorderFile() const {
+    return flightRecorderFile;
+}
+
+/*lint -e{1762} function cannot be constant as it is registered as an RPC for CLASS_METHOD_REGISTER*/
+ErrorManagement::ErrorType FileWriter::GetWriterStatistics(ReferenceContainer &message) {
+    ErrorManagement::ErrorType ret = ErrorManagement::NoError;
+    bool ok = (message.Size() == 1u);
+    ReferenceT<StructuredDataI> data;
+    if (ok) {
+        data = message.Get(0u);
+        ok = data.IsValid();
+    }
+    if (!ok) {
+        ret = ErrorManagement::ParametersError;
+        REPORT_ERROR(ret, "Message does not contain a ReferenceT<StructuredDataI>");
+    }
+    else {
+        ok = data->Write("NumberOfBatches", numberOfBatches);
+        if (ok) {
+            ok = data->Write("BytesWritten", batchBytesWritten);
+        }
+        if (ok) {
+            ok = data->Write("NumberOfQueueFull", numberOfQueueFull);
+        }
+        if (ok) {
+            ok = data->Write("LastFlushLatency", lastFlushLatency);
+        }
+        if (ok) {
+            ok = data->Write("MaxFlushLatency", maxFlushLatency);
+        }
+        if (ok) {
+            uint8 directIOU = directIOActive ? 1u : 0u;
+            ok = data->Write("DirectIO", directIOU);
+        }
+        if (ok) {
+            const char8 * const backend = ioUringActive ? "io_uring" : "pwrite";
+            ok = data->Write("IOBackend", backend);
+        }
+        if (ok) {
+            ok = data->Write("Segment", segmentIndex);
+        }
+        if (ok) {
+            uint64 uncompressedBytes = ((frameBuffer != NULL_PTR(char8 *)) || (chunkBuffer != NULL_PTR(char8 *))) ? uncompressedBytesWritten : batchBytesWritten;
+            ok = data->Write("UncompressedBytes", uncompressedBytes);
+        }
+        if (ok) {
+            ok = data->Write("FlightRecorderDumps", flightRecorderDumps);
+        }
+        if (ok) {
+            ok = data->Write("FlightRecorderOverruns", flightRecorderOverruns);
+        }
+        if (ok) {
+            ok = data->Write("FlightRecorderMissedTriggers", flightRecorderMissedTriggers);
+        }
+        if (!ok) {
+            ret = ErrorManagement::ParametersError;
+            REPORT_ERROR(ret, "Could not write the statistics");
+        }
+    }
+    return ret;
+}
+
 void FileWriter::Purge(ReferenceContainer &purgeList) {
     if (FlushFile() != ErrorManagement::NoError) {
         REPORT_ERROR(ErrorManagement::FatalError, "Failed to Flush the File");
@@ -735,6 +2101,7 @@ CLASS_REGISTER(FileWriter, "1.0")
 CLASS_METHOD_REGISTER(FileWriter, FlushFile)
 CLASS_METHOD_REGISTER(FileWriter, OpenFile)
 CLASS_METHOD_REGISTER(FileWriter, CloseFile)
+CLASS_METHOD_REGISTER(FileWriter, GetWriterStatistics)
 
 }
 
@@ -32,17 +32,63 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "FastPollingMutexSem.h"
 #include "File.h"
+#include "FileColumnChunk.h"
+#include "FileFrameCodec.h"
+#include "FileWriterCSVEncoder.h"
+#include "FileWriterIOUring.h"
+#include "HeapI.h"
 #include "MemoryMapAsyncOutputBroker.h"
 #include "MemoryMapAsyncTriggerOutputBroker.h"
+#include "MemoryMapSynchronisedOutputBroker.h"
 #include "MessageI.h"
 #include "ProcessorType.h"
 #include "RegisteredMethodsMessageFilter.h"
+#include "SingleThreadService.h"
+#include "ThreadPlacement.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * @brief The first bytes of the flight recorder ring (see FileWriter), which allow to recover the ring file after a crash.
+ */
+struct FileWriterFlightRecorderHeader {
+    /**
+     * FILE_WRITER_FLIGHT_RECORDER_MAGIC.
+     */
+    uint32 magic;
+
+    /**
+     * The number of bytes of each cycle.
+     */
+    uint32 cycleSize;
+
+    /**
+     * The number of slots of the ring.
+     */
+    uint32 numberOfCycles;
+
+    /**
+     * The offset of the first slot (a multiple of the page size). The binary header of the signals is between this structure and the first slot.
+     */
+    uint32 dataOffset;
+
+    /**
+     * The number of cycles written since the ring was mapped (updated by the real-time thread after each cycle is copied).
+     */
+    volatile uint64 cyclesWritten;
+};
+
+/**
+ * The magic number of the FileWriterFlightRecorderHeader ("MFR1").
+ */
+static const uint32 FILE_WRITER_FLIGHT_RECORDER_MAGIC = 0x3152464Du;
+
 /**
  * @brief A DataSourceI interface which allows to store signals in a file.
  *
@@ -54,13 +100,64 @@ namespace MARTe {
  * If the format is csv the first line will be a comment with each signal name, type and number of elements.
  * e.g."#Trigger (uint8)[1];Time (uint32)[1];SignalUInt8 (uint8)[1];SignalUInt16 (uint16)[4]", where ; is the CSVSeparator.
  * A new line will be added every time all the signal samples are written.
+ * The csv lines are written by a FileWriterCSVEncoder, which formats the signal memory directly into a reusable buffer that is
+ * written with a single Write. The floats are written with 6 decimal digits (as %f) or, if CSVFloatFormat = shortest, with
+ * the shortest representation which is read back as the same value.
  *
  * If the format is binary an header with the following information is created: the first 4 bytes
  * contain the number of signals. Then, for each signal, the signal type will be encoded in two bytes, followed
  *  by 32 bytes to encode the signal name, followed by 4 bytes which store the number of elements of a given signal.
  *  Following the header the signal samples are consecutively stored in binary format.
  *
- * This DataSourceI has the functions FlushFile, OpenFile and CloseFile registered as RPCs.
+ * If BatchCycles > 0 (only for the binary format) the cycles are not written one by one. Each cycle is copied into one of
+ * NumberOfBatchBuffers page aligned staging buffers and, every BatchCycles cycles, the full buffer is queued to a dedicated I/O thread
+ * which writes it with a single write. The queue is bounded: if all the buffers are waiting to be written, the thread calling Synchronise
+ * (i.e. the thread of the asynchronous broker, never the real-time thread) blocks until one buffer is free (and the event is counted in
+ * NumberOfQueueFull). If DirectIO = 1 the data is written with O_DIRECT (bypassing the page cache) in blocks which are multiple of the page size;
+ * the last partial block is written (without O_DIRECT) on FlushFile and CloseFile and rewritten with the next block. If O_DIRECT is not
+ * supported by the file system the file is written through the page cache. If PreallocateSize > 0 the file is preallocated (posix_fallocate)
+ * and truncated to the written size when it is closed. The statistics of the batches (see GetWriterStatistics) can be queried with an RPC.
+ *
+ * If IOBackend = io_uring the I/O thread submits the staging buffers to an io_uring (see FileWriterIOUring) instead of writing them
+ * one by one with pwrite: the staging buffers are registered with the kernel and up to NumberOfBatchBuffers writes are kept in flight.
+ * A staging buffer is only given back to the thread calling Synchronise when its write is completed (the buffers are always recycled
+ * in the order they were queued). If the kernel does not support io_uring the pwrite backend is used (and a warning is reported).
+ *
+ * If RotateSize > 0 or RotatePeriod > 0 (only if BatchCycles > 0) the output is split in segments: the Filename "test.bin" is
+ * written as test_000.bin, test_001.bin, ... and a new segment is started (at a cycle boundary) when the data written in the current
+ * segment reaches RotateSize bytes or when the segment was started RotatePeriod seconds ago. Every segment has its own header.
+ * The next segment is always created, written with the header and preallocated (see PreallocateSize) by the I/O thread in advance,
+ * so that switching to it only requires queueing the current staging buffer. The index file Filename.idx (e.g. test.bin.idx) has one
+ * line (Cycle;File;Offset) for each segment, with the number of cycles written since the file was opened (see OpenFile) before the
+ * first cycle of the segment, the segment file name and the offset of the first cycle in the segment.
+ *
+ * If Compression = lz4 or zstd (only if BatchCycles > 0, DirectIO = 0 and IOBackend = pwrite) the I/O thread compresses each staging buffer
+ * (after it was handed over by the thread calling Synchronise) into a frame (see FileFrameCodec) with the codec, the compressed and uncompressed
+ * sizes, the index of the first cycle and the number of cycles of the frame. The frames are written one after the other after the header
+ * (which is not compressed). The FileReader detects and decompresses these files. With rotation, RotateSize refers to the uncompressed bytes.
+ * The zstd codec is only available if the component was compiled with ZSTD_DIR set.
+ *
+ * If Layout = columnar (only if BatchCycles > 0, DirectIO = 0 and IOBackend = pwrite) the I/O thread transposes each staging buffer
+ * into a chunk (see FileColumnChunk) where the samples of each signal for all the cycles of the buffer are contiguous. Each chunk starts
+ * with a directory of the offsets of the signal columns, so that a post-processing tool can read only the needed signals with large
+ * sequential reads (seeking from chunk to chunk with the chunk size). If Compression != none each chunk is compressed into a frame.
+ * The FileReader detects and reads these files.
+ *
+ * If FlightRecorderCycles > 0 (only for the binary format, StoreOnTrigger = 0, RefreshContent = 0 and BatchCycles = 0) the DataSourceI
+ * works as a flight recorder: every cycle is copied by Synchronise, on the real-time thread (the broker is a MemoryMapSynchronisedOutputBroker),
+ * into a ring of FlightRecorderCycles slots in a memory mapping. No file is written while there is no trigger. When the Trigger signal
+ * (which shall be the first signal) is 1, the NumberOfPreTriggers cycles before the trigger, the trigger cycle and the NumberOfPostTriggers
+ * cycles after it are written, by the I/O thread and directly from the mapping, into the file. A trigger which occurs while the previous
+ * window is still being recorded or written is ignored (and counted in FlightRecorderMissedTriggers). The ring can thus be much deeper than the
+ * NumberOfBuffers of the brokers, without the copies through the broker buffers. If the real-time thread wraps around the ring before a
+ * window is written (i.e. the file system is slower than FlightRecorderCycles - NumberOfPostTriggers cycles) the window is still written
+ * but it is counted in FlightRecorderOverruns.
+ * If FlightRecorderFile is set the ring is a shared mapping of that file (otherwise it is an anonymous mapping). The file then survives
+ * a crash of the process: the first page(s) hold a FileWriterFlightRecorderHeader followed by the binary header described above and the
+ * slots start at FileWriterFlightRecorderHeader::dataOffset. The last cycle written is the cycle cyclesWritten - 1, which is in the slot
+ * (cyclesWritten - 1) % numberOfCycles.
+ *
+ * This DataSourceI has the functions FlushFile, OpenFile, CloseFile and GetWriterStatistics registered as RPCs.
  *
  * Only one and one GAM is allowed to write into this DataSourceI.
  *
@@ -70,19 +167,37 @@ namespace MARTe {
  * +FileWriter_0 = {
  *     Class = FileWriter
  *     NumberOfBuffers = 10 //Compulsory. Number of buffers in the circular buffer defined above. Each buffer is capable of holding a copy of all the DataSourceI signals.
+ *     HeapName = "HugePageHeap" //Optional. Name of the heap (e.g. a HugePageHeap) where the signal memory is allocated. Default = GlobalObjectsDatabase::Instance()->GetStandardHeap().
  *     CPUMask = 0xFEu //Compulsory. Affinity assigned to the threads responsible for asynchronously flush data into the file.
  *     StackSize = 10000000 //Compulsory. Stack size of the thread above.
+ *     ThreadPlacement = { //Optional. See ThreadPlacement. Overrides the CPUMask above, sets the priority of the I/O thread and binds the signal and staging buffers to a NUMA node.
+ *         NearDevice = "/sys/block/nvme0n1/device"
+ *         PriorityClass = NormalPriorityClass
+ *     }
  *     Filename = "test.bin" //Optional. If not set the filename shall be set using the OpenFile RPC.
  *     Overwrite = "yes" //Compulsory. If "yes" the file will be overwritten, otherwise new data will be added to the end of the existent file.
  *     FileFormat = "binary" //Compulsory. Possible values are: binary and csv.
  *     CSVSeparator = "," //Compulsory if Format=csv. Sets the file separator type.
+ *     CSVFloatFormat = "shortest" //Optional. Only meaningful if Format=csv. Possible values are: fixed (6 decimal digits) and shortest (shortest representation which is read back as the same value). Default = fixed.
  *     StoreOnTrigger = 1 //Compulsory. If 0 all the data in the circular buffer is continuously stored. If 1 data is stored when the Trigger signal is 1 (see below).
  *     RefreshContent = 0 //Optional. If set, new data will always overwrite old data, keeping always the last snapshot. Also enables header pretty-printing, which is referred as "Full Notation".
- *     NumberOfPreTriggers = 2 //Compulsory iff StoreOnTrigger = 1.  Number of cycles to store before the trigger.
- *     NumberOfPostTriggers = 1 //Compulsory iff StoreOnTrigger = 1.  Number of cycles to store after the trigger.
+ *     NumberOfPreTriggers = 2 //Compulsory iff StoreOnTrigger = 1 or FlightRecorderCycles > 0.  Number of cycles to store before the trigger.
+ *     NumberOfPostTriggers = 1 //Compulsory iff StoreOnTrigger = 1 or FlightRecorderCycles > 0.  Number of cycles to store after the trigger.
+ *     BatchCycles = 100 //Optional. Only for FileFormat = binary and RefreshContent = 0. Number of cycles written with a single write by the I/O thread. Default = 0 (each cycle is written by Synchronise).
+ *     NumberOfBatchBuffers = 4 //Optional. Only meaningful if BatchCycles > 0. Number of staging buffers (i.e. size of the queue of the I/O thread). Default = 4.
+ *     DirectIO = 1 //Optional. Only meaningful if BatchCycles > 0. If 1 the file is written with O_DIRECT. Default = 0.
+ *     PreallocateSize = 1000000000 //Optional. Only meaningful if BatchCycles > 0. Number of bytes to preallocate after the header when the file is opened. Default = 0.
+ *     IOBackend = "io_uring" //Optional. Only meaningful if BatchCycles > 0. Possible values are: pwrite and io_uring. Default = pwrite.
+ *     RotateSize = 1000000000 //Optional. Only if BatchCycles > 0. Number of data bytes after which a new segment is started. Default = 0 (no size based rotation).
+ *     RotatePeriod = 3600 //Optional. Only if BatchCycles > 0. Number of seconds after which a new segment is started. Default = 0 (no time based rotation).
+ *     Compression = "lz4" //Optional. Only if BatchCycles > 0, DirectIO = 0 and IOBackend = pwrite. Possible values are: none, lz4 and zstd. Default = none.
+ *     CompressionLevel = 3 //Optional. Only meaningful if Compression = zstd. Default = 3.
+ *     Layout = "columnar" //Optional. Only if BatchCycles > 0, DirectIO = 0 and IOBackend = pwrite. Possible values are: row (one cycle after the other) and columnar. Default = row.
+ *     FlightRecorderCycles = 100000 //Optional. Only for FileFormat = binary, StoreOnTrigger = 0, RefreshContent = 0 and BatchCycles = 0. Number of slots of the flight recorder ring. Default = 0 (no flight recorder).
+ *     FlightRecorderFile = "/dev/shm/test.ring" //Optional. Only meaningful if FlightRecorderCycles > 0. File which is mapped as the ring. Default = "" (anonymous mapping).
  *
  *     Signals = {
- *         Trigger = { //Compulsory when StoreOnTrigger = 1. Must be set in index 0 of the Signals node. When the value of this signal is 1 data will be stored.
+ *         Trigger = { //Compulsory when StoreOnTrigger = 1 or FlightRecorderCycles > 0. Must be set in index 0 of the Signals node. When the value of this signal is 1 data will be stored.
  *             Type = 'uint8" //Type must be uint8
  *         }
  *         SignalUInt16F = { //As many as required.
@@ -121,7 +236,7 @@ namespace MARTe {
  *
  * </pre>
  */
-class FileWriter: public DataSourceI, public MessageI {
+class FileWriter: public DataSourceI, public MessageI, public EmbeddedServiceMethodBinderI {
 public:
     CLASS_REGISTER_DECLARATION()
 
@@ -134,7 +249,7 @@ public:
 
     /**
      * @brief Destructor.
-     * @details Flushes the file and frees the circular buffer.
+     * @details Flushes the file, stops the I/O thread and frees the circular buffer and the staging buffers.
      */
     virtual ~FileWriter();
 
@@ -179,6 +294,7 @@ public:
      * @brief See DataSourceI::GetOutputBrokers.
      * @details If storeOnTrigger == 0 it adds a MemoryMapAsyncOutputBroker instance to
      *  the inputBrokers, otherwise it adds a MemoryMapAsyncTriggerOutputBroker instance to the outputBrokers.
+     *  If FlightRecorderCycles > 0 it adds a MemoryMapSynchronisedOutputBroker instance to the outputBrokers.
      * @pre
      *   GetNumberOfFunctions() == 1u
      */
@@ -188,10 +304,20 @@ public:
 
     /**
      * @brief Writes the buffer data into the specified file in the specified format.
-     * @return true if the data can be successfully written into the file.
+     * @details If BatchCycles > 0 the buffer data is copied into the current staging buffer, which is queued to the I/O thread every BatchCycles cycles.
+     * If FlightRecorderCycles > 0 the buffer data is copied into the flight recorder ring (see RecordCycle).
+     * @return true if the data can be successfully written into the file (or into the staging buffer and no error was reported by the I/O thread).
      */
     virtual bool Synchronise();
 
+    /**
+     * @brief Callback function of the I/O thread (only started if BatchCycles > 0 or FlightRecorderCycles > 0).
+     * @details Writes all the staging buffers (or the flight recorder window) which were queued and waits (with a timeout) for the next one.
+     * @param[in] info not used.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo & info);
+
     /**
      * @brief See DataSourceI::PrepareNextState. NOOP.
      * @return true.
@@ -213,12 +339,16 @@ public:
      * - If relevant, the Trigger signal shall have type uint8
      * - The number of samples of all the signals is one.
      * - At least one signal (apart from the eventual Trigger signal) is set.
+     * If BatchCycles > 0, allocates the staging buffers and starts the I/O thread.
+     * If FlightRecorderCycles > 0, maps the ring and starts the I/O thread. The Trigger signal shall be the first signal and have type uint8.
      * @return true if all the parameters are valid and if the file can be successfully opened.
      */
     virtual bool SetConfiguredDatabase(StructuredDataI & data);
 
     /**
      * @brief Flushes the file.
+     * @details If BatchCycles > 0, also queues the staging buffer which is being filled and waits for all the staging buffers to be written.
+     * If FlightRecorderCycles > 0, waits for the queued window (if any) to be written.
      * @return true if the file can be successfully flushed.
      */
     ErrorManagement::ErrorType FlushFile();
@@ -236,6 +366,21 @@ public:
      */
     ErrorManagement::ErrorType CloseFile();
 
+    /**
+     * @brief Gets the statistics of the batches written by the I/O thread. Function is registered as an RPC.
+     * @details Writes in the StructuredDataI: NumberOfBatches (number of writes of the I/O thread), BytesWritten, NumberOfQueueFull (number of
+     * times that Synchronise had to wait for a free staging buffer), LastFlushLatency and MaxFlushLatency (duration of the writes in microseconds)
+     * DirectIO (1 if the file is being written with O_DIRECT) and IOBackend (the backend being used: pwrite or io_uring). With io_uring the
+     * latencies are measured from the submission to the completion of each write. Segment is the index of the segment being written (see RotateSize).
+     * UncompressedBytes is the number of bytes of the cycles before compression (equal to BytesWritten if Compression = none and Layout = row).
+     * FlightRecorderDumps, FlightRecorderOverruns and FlightRecorderMissedTriggers are the number of windows written, of windows which were
+     * (partially) overwritten by the real-time thread before being written and of triggers ignored because a window was still pending.
+     * The values are read while they are being updated by the I/O thread.
+     * @param[in] message the first element shall be a ReferenceT<StructuredDataI> where the statistics are written.
+     * @return ErrorManagement::NoError if the statistics can be written in the first element of message.
+     */
+    ErrorManagement::ErrorType GetWriterStatistics(ReferenceContainer &message);
+
     /**
      * @brief Gets the affinity of the thread which is going to be used to asynchronously store the data in the file.
      * @return the affinity of the thread which is going to be used to asynchronously store the data in the file.
@@ -296,6 +441,72 @@ public:
      */
     bool IsOverwrite() const;
 
+    /**
+     * @brief Gets the number of cycles written with a single write by the I/O thread.
+     * @return the number of cycles written with a single write by the I/O thread (0 if batching is disabled).
+     */
+    uint32 GetBatchCycles() const;
+
+    /**
+     * @brief Gets the number of staging buffers.
+     * @return the number of staging buffers.
+     */
+    uint32 GetNumberOfBatchBuffers() const;
+
+    /**
+     * @brief Returns true if DirectIO = 1.
+     * @return true if DirectIO = 1.
+     */
+    bool IsDirectIO() const;
+
+    /**
+     * @brief Gets the configured CSVFloatFormat.
+     * @return the configured CSVFloatFormat (fixed or shortest).
+     */
+    const StreamString& GetCSVFloatFormat() const;
+
+    /**
+     * @brief Gets the configured IOBackend.
+     * @return the configured IOBackend (pwrite or io_uring).
+     */
+    const StreamString& GetIOBackend() const;
+
+    /**
+     * @brief Gets the configured Compression.
+     * @return the configured Compression (none, lz4 or zstd).
+     */
+    const StreamString& GetCompression() const;
+
+    /**
+     * @brief Gets the configured Layout.
+     * @return the configured Layout (row or columnar).
+     */
+    const StreamString& GetLayout() const;
+
+    /**
+     * @brief Gets the number of data bytes after which a new segment is started.
+     * @return the RotateSize (0 if there is no size based rotation).
+     */
+    uint64 GetRotateSize() const;
+
+    /**
+     * @brief Gets the number of seconds after which a new segment is started.
+     * @return the RotatePeriod (0 if there is no time based rotation).
+     */
+    uint32 GetRotatePeriod() const;
+
+    /**
+     * @brief Gets the number of slots of the flight recorder ring.
+     * @return the FlightRecorderCycles (0 if the flight recorder is disabled).
+     */
+    uint32 GetFlightRecorderCycles() const;
+
+    /**
+     * @brief Gets the file which is mapped as the flight recorder ring.
+     * @return the FlightRecorderFile (empty if the ring is an anonymous mapping).
+     */
+    const StreamString& GetFlightRecorderFile() const;
+
     /**
      * @see DataSourceI::Purge()
      */
@@ -303,6 +514,136 @@ public:
 
 private:
 
+    /**
+     * @brief Queues the staging buffer which is being filled to the I/O thread and waits for the next staging buffer to be free.
+     * @details Copies the bytes after the last multiple of the alignment into the next staging buffer. Shall be called with the batchMux locked.
+     * @param[in] finalBatch if true the I/O thread also writes the bytes after the last multiple of the alignment.
+     * @param[in] rotate if true the I/O thread switches to the next segment after writing the staging buffer (the bytes after the last
+     * multiple of the alignment are then not copied into the next staging buffer).
+     * @return true if the next staging buffer is free.
+     */
+    bool QueueBatch(const bool finalBatch,
+                    const bool rotate);
+
+    /**
+     * @brief Waits (with the batchMux locked) until at most maxPending staging buffers are waiting to be written.
+     * @param[in] maxPending the maximum number of staging buffers waiting to be written.
+     * @return true if the condition was met before the I/O thread failed or stopped.
+     */
+    bool WaitBatchQueue(const uint32 maxPending);
+
+    /**
+     * @brief Queues the staging buffer which is being filled (if it has data not yet written) and waits for all the staging buffers to be written.
+     * @param[in] closeFile if true the batch file descriptor is also closed (and truncated to the written size if it was preallocated).
+     * @return true if all the staging buffers were successfully written.
+     */
+    bool FlushBatches(const bool closeFile);
+
+    /**
+     * @brief Opens the batch file descriptor after the header was written and loads the header bytes after the last multiple of the
+     * alignment into the staging buffer.
+     * @return true if the file can be opened.
+     */
+    bool OpenBatchFile();
+
+    /**
+     * @brief Writes (in the I/O thread) a staging buffer at batchFileOffset.
+     * @details The bytes after the last multiple of the alignment are written without O_DIRECT and batchFileOffset is only
+     * incremented by the multiple of the alignment.
+     * @param[in] buffer the staging buffer.
+     * @param[in] size the number of bytes to write.
+     * @return true if all the bytes were written.
+     */
+    bool WriteBatch(const char8 * const buffer,
+                    const uint32 size);
+
+    /**
+     * @brief Transposes (in the I/O thread) a staging buffer into a columnar chunk and/or compresses it into a frame and writes it with WriteBatch.
+     * @param[in] idx the index of the staging buffer.
+     * @return true if the frame was written.
+     */
+    bool WriteFrame(const uint32 idx);
+
+    /**
+     * @brief Submits (in the I/O thread) all the queued staging buffers to the io_uring and recycles them as their writes are completed.
+     * @details Returns when all the queued staging buffers were recycled. A final batch whose size is not a multiple of the alignment is
+     * written with WriteBatch after all the writes in flight are completed.
+     */
+    void WriteBatchesIOUring();
+
+    /**
+     * @brief Updates the statistics after a staging buffer was written.
+     * @param[in] startCounter the HighResolutionTimer counter when the write was started.
+     * @param[in] size the number of bytes written.
+     */
+    void UpdateBatchStatistics(const uint64 startCounter,
+                               const uint32 size);
+
+    /**
+     * @brief Queues (with the batchMux locked) the staging buffer as the last of the current segment and loads the header bytes after the
+     * last multiple of the alignment into the next staging buffer.
+     * @return true if the staging buffer could be queued.
+     */
+    bool StartNextSegment();
+
+    /**
+     * @brief Switches (in the I/O thread) to the preopened segment, writes its entry in the index file and preopens the following segment.
+     * @return true if the segments could be closed, switched and opened.
+     */
+    bool RotateBatchFile();
+
+    /**
+     * @brief Creates the segment segmentIndex + 1, writes the header and prepares it for the I/O thread (see PrepareBatchFile).
+     * @return true if the segment could be created and the header written.
+     */
+    bool OpenNextSegment();
+
+    /**
+     * @brief Sets O_DIRECT (if directIOActive) and preallocates (if PreallocateSize > 0) a file descriptor written by the I/O thread.
+     * @param[in] fd the file descriptor.
+     * @return true if O_DIRECT could be set.
+     */
+    bool PrepareBatchFile(const int32 fd);
+
+    /**
+     * @brief Truncates (if it was preallocated) and closes the batch file descriptor.
+     * @return true if the file could be closed.
+     */
+    bool CloseBatchFile();
+
+    /**
+     * @brief Gets the name of a segment: the Filename with _NNN before the extension.
+     * @param[in] segment the index of the segment.
+     * @param[out] segmentName the name of the segment.
+     * @return true if the name could be written.
+     */
+    bool GetSegmentFilename(const uint32 segment,
+                            StreamString &segmentName) const;
+
+    /**
+     * @brief Maps the flight recorder ring (FlightRecorderFile or anonymous) and writes its header.
+     * @return true if the ring could be mapped.
+     */
+    bool OpenFlightRecorder();
+
+    /**
+     * @brief Copies (in Synchronise) the cycle into the ring and, after the post-trigger cycles of a trigger, queues the window to the I/O thread.
+     * @return true if the cycle could be copied.
+     */
+    bool RecordCycle();
+
+    /**
+     * @brief Writes (in the I/O thread) the queued window from the ring into the file.
+     * @return true if the window could be written.
+     */
+    bool WriteFlightRecorderWindow();
+
+    /**
+     * @brief Waits until the queued window (if any) is written.
+     * @return true if the window was written before the I/O thread failed or stopped.
+     */
+    bool WaitFlightRecorder();
+
     /**
      * True if the data is only to be stored in the output file following a trigger.
      */
@@ -333,11 +674,21 @@ private:
      */
     char8 *dataSourceMemory;
 
+    /**
+     * The heap where the signal memory is allocated (see HeapName).
+     */
+    HeapI *memoryHeap;
+
     /**
      * The affinity of the thread that asynchronously flushes data into the output file.
      */
     ProcessorType cpuMask;
 
+    /**
+     * The CPU, priority and NUMA placement of the I/O thread and of the buffers.
+     */
+    ThreadPlacement placement;
+
     /**
      * The size of the stack of the thread that asynchronously flushes data into the output file.
      */
@@ -383,6 +734,21 @@ private:
      */
     AnyType *signalsAnyType;
 
+    /**
+     * The signal names, read at configuration so that the full notation lines are written without allocations.
+     */
+    StreamString *signalNames;
+
+    /**
+     * The configured CSVFloatFormat.
+     */
+    StreamString csvFloatFormat;
+
+    /**
+     * Writes the csv lines (if fullNotation is not set).
+     */
+    FileWriterCSVEncoder csvEncoder;
+
     /**
      * If a fatal file error occurred do not try to flush segments nor do further writes.
      */
@@ -439,6 +805,327 @@ private:
      * The message to send if there is a runtime error.
      */
     ReferenceT<Message> fileRuntimeErrorMsg;
+
+    /**
+     * Number of cycles written with a single write by the I/O thread (0 if batching is disabled).
+     */
+    uint32 batchCycles;
+
+    /**
+     * Number of staging buffers.
+     */
+    uint32 numberOfBatchBuffers;
+
+    /**
+     * True if DirectIO = 1.
+     */
+    bool directIO;
+
+    /**
+     * True if the file is being written with O_DIRECT.
+     */
+    bool directIOActive;
+
+    /**
+     * Number of bytes to preallocate after the header.
+     */
+    uint64 preallocateSize;
+
+    /**
+     * The configured IOBackend.
+     */
+    StreamString ioBackend;
+
+    /**
+     * True if the staging buffers are being written with the io_uring.
+     */
+    bool ioUringActive;
+
+    /**
+     * The io_uring of the I/O thread (only open if ioUringActive).
+     */
+    FileWriterIOUring ioRing;
+
+    /**
+     * Index of the next staging buffer to submit to the io_uring.
+     */
+    uint32 batchSubmitIndex;
+
+    /**
+     * Number of queued staging buffers which were already submitted (or discarded) but not yet recycled.
+     */
+    uint32 batchSubmitted;
+
+    /**
+     * Number of writes in flight in the io_uring.
+     */
+    uint32 batchInFlight;
+
+    /**
+     * For each staging buffer: true if its write is completed, the offset in the file where it is written, the number of bytes
+     * already written and the HighResolutionTimer counter when it was submitted.
+     */
+    bool *batchBufferDone;
+    uint64 *batchBufferOffsets;
+    uint32 *batchBufferWritten;
+    uint64 *batchSubmitCounters;
+
+    /**
+     * Number of data bytes after which a new segment is started.
+     */
+    uint64 rotateSize;
+
+    /**
+     * Number of seconds after which a new segment is started and the same in HighResolutionTimer counts.
+     */
+    uint32 rotatePeriod;
+    uint64 rotatePeriodCounts;
+
+    /**
+     * True if RotateSize > 0 or RotatePeriod > 0.
+     */
+    bool rotate;
+
+    /**
+     * The name of the file (or segment) being written.
+     */
+    StreamString segmentFilename;
+
+    /**
+     * Index of the segment being written by the I/O thread.
+     */
+    uint32 segmentIndex;
+
+    /**
+     * Number of data bytes queued in the current segment and HighResolutionTimer counter when it was started (updated by Synchronise).
+     */
+    uint64 segmentBytes;
+    uint64 segmentStartCounter;
+
+    /**
+     * Number of cycles queued since the file was opened.
+     */
+    uint64 batchCycleCounter;
+
+    /**
+     * For each staging buffer: true if it is the last of a segment and the batchCycleCounter after it.
+     */
+    bool *batchBufferRotate;
+    uint64 *batchRotateCycles;
+
+    /**
+     * True if the I/O thread (io_uring backend) shall switch to the next segment once all the writes in flight are completed.
+     */
+    bool batchRotatePending;
+
+    /**
+     * The file descriptor of the preopened next segment (-1 if not open).
+     */
+    int32 nextBatchFd;
+
+    /**
+     * The header of the file (written at the beginning of every segment).
+     */
+    char8 *headerBytes;
+
+    /**
+     * The index file of the segments.
+     */
+    File indexFile;
+
+    /**
+     * The configured Compression and CompressionLevel.
+     */
+    StreamString compression;
+    int32 compressionLevel;
+
+    /**
+     * Compresses the staging buffers (if Compression != none).
+     */
+    FileFrameCodec frameCodec;
+
+    /**
+     * The buffer where the I/O thread encodes the frames.
+     */
+    char8 *frameBuffer;
+
+    /**
+     * The configured Layout.
+     */
+    StreamString layout;
+
+    /**
+     * Transposes the staging buffers (if Layout = columnar).
+     */
+    FileColumnChunk columnChunk;
+
+    /**
+     * The buffer where the I/O thread transposes the chunks.
+     */
+    char8 *chunkBuffer;
+
+    /**
+     * Number of bytes written before compression.
+     */
+    uint64 uncompressedBytesWritten;
+
+    /**
+     * The size of each staging buffer.
+     */
+    uint32 batchBufferSize;
+
+    /**
+     * The write offsets and sizes shall be multiple of the batchAlignment (the page size with O_DIRECT, 1 otherwise).
+     */
+    uint32 batchAlignment;
+
+    /**
+     * The page aligned staging buffers.
+     */
+    char8 **batchBuffers;
+
+    /**
+     * Number of bytes to write of each queued staging buffer.
+     */
+    uint32 *batchBufferBytes;
+
+    /**
+     * The staging buffer being filled (owned by the thread calling Synchronise).
+     */
+    uint32 batchFillIndex;
+
+    /**
+     * Number of bytes in the staging buffer being filled.
+     */
+    uint32 batchFillBytes;
+
+    /**
+     * Number of cycles in the staging buffer being filled.
+     */
+    uint32 batchFillCycles;
+
+    /**
+     * True if the staging buffer being filled has bytes which were not yet written to the file.
+     */
+    bool batchDirty;
+
+    /**
+     * The next staging buffer to be written (owned by the I/O thread).
+     */
+    uint32 batchFlushIndex;
+
+    /**
+     * Number of staging buffers waiting to be written.
+     */
+    volatile int32 batchPending;
+
+    /**
+     * Protects the staging buffer being filled against concurrent Synchronise and FlushFile calls.
+     */
+    FastPollingMutexSem batchMux;
+
+    /**
+     * Posted when a staging buffer is queued.
+     */
+    EventSem batchQueuedSem;
+
+    /**
+     * Posted when a staging buffer is written.
+     */
+    EventSem batchWrittenSem;
+
+    /**
+     * The I/O thread.
+     */
+    SingleThreadService batchExecutor;
+
+    /**
+     * The file descriptor used by the I/O thread (-1 if not open).
+     */
+    int32 batchFd;
+
+    /**
+     * Offset in the file of the next write of the I/O thread (always a multiple of the batchAlignment).
+     */
+    uint64 batchFileOffset;
+
+    /**
+     * Number of bytes written in the file.
+     */
+    uint64 batchFileSize;
+
+    /**
+     * Set by the I/O thread if a write fails.
+     */
+    volatile bool batchIOError;
+
+    /**
+     * Statistics of the I/O thread (see GetWriterStatistics).
+     */
+    uint64 numberOfBatches;
+    uint64 batchBytesWritten;
+    uint32 numberOfQueueFull;
+    uint32 lastFlushLatency;
+    uint32 maxFlushLatency;
+
+    /**
+     * Number of slots of the flight recorder ring (0 if the flight recorder is disabled).
+     */
+    uint32 flightRecorderCycles;
+
+    /**
+     * The file mapped as the ring (empty for an anonymous mapping).
+     */
+    StreamString flightRecorderFile;
+
+    /**
+     * The file descriptor of the FlightRecorderFile (-1 if not open).
+     */
+    int32 flightRecorderFd;
+
+    /**
+     * The ring mapping and its size.
+     */
+    char8 *flightRecorderMemory;
+    uint64 flightRecorderSize;
+
+    /**
+     * The header of the ring (at the beginning of flightRecorderMemory).
+     */
+    FileWriterFlightRecorderHeader *flightRecorderHeader;
+
+    /**
+     * The first slot of the ring.
+     */
+    char8 *flightRecorderSlots;
+
+    /**
+     * Number of post-trigger cycles still to be recorded before the window is queued (0 if no window is being recorded).
+     */
+    uint32 flightRecorderPostCycles;
+
+    /**
+     * True if a window is being recorded (i.e. waiting for the post-trigger cycles).
+     */
+    bool flightRecorderTriggered;
+
+    /**
+     * The first cycle and the number of cycles of the window being recorded or queued.
+     */
+    uint64 flightRecorderFirstCycle;
+    uint32 flightRecorderWindowCycles;
+
+    /**
+     * 1 if a window is waiting to be written by the I/O thread.
+     */
+    volatile int32 flightRecorderPending;
+
+    /**
+     * Statistics of the flight recorder (see GetWriterStatistics).
+     */
+    uint32 flightRecorderDumps;
+    uint32 flightRecorderOverruns;
+    uint32 flightRecorderMissedTriggers;
 };
 }
 
@@ -0,0 +1,376 @@
+/**
+ * @file FileWriterCSVEncoder.cpp
+ * @brief Source file for class FileWriterCSVEncoder
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FileWriterCSVEncoder (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "FileWriterCSVEncoder.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Maximum number of characters of an integer (sign and 20 digits) and of a float written with the C library
+ * (%.6f of the largest float64 and %.17g of any float64).
+ */
+static const uint32 CSV_MAX_INTEGER_SIZE = 21u;
+static const uint32 CSV_MAX_FLOAT32_SIZE = 48u;
+static const uint32 CSV_MAX_FLOAT64_SIZE = 320u;
+
+/**
+ * Floats with a magnitude smaller than this value are written with 6 decimal digits without the C library.
+ */
+static const float64 CSV_FIXED_MAX = 1e9;
+
+/**
+ * @brief Writes an unsigned integer in decimal.
+ * @return the number of characters written.
+ */
+static uint32 CSVFormatUnsigned(uint64 value,
+                                char8 * const out) {
+    char8 digits[20];
+    uint32 n = 0u;
+    do {
+        digits[n] = static_cast<char8>('0' + static_cast<char8>(value % 10u));
+        value /= 10u;
+        n++;
+    }
+    while (value > 0u);
+    for (uint32 i = 0u; i < n; i++) {
+        out[i] = digits[n - 1u - i];
+    }
+    return n;
+}
+
+/**
+ * @brief Writes a signed integer in decimal.
+ * @return the number of characters written.
+ */
+static uint32 CSVFormatSigned(const int64 value,
+                              char8 * const out) {
+    uint32 n = 0u;
+    if (value < 0) {
+        out[0] = '-';
+        //Also valid for the most negative value
+        n = 1u + CSVFormatUnsigned(static_cast<uint64>(-(value + 1)) + 1u, &out[1]);
+    }
+    else {
+        n = CSVFormatUnsigned(static_cast<uint64>(value), out);
+    }
+    return n;
+}
+
+/**
+ * @brief Writes a float with 6 decimal digits, rounded as %f (i.e. to the nearest and ties to even, on the exact binary value).
+ * @details The fraction is multiplied by 1e6 with an exact (Dekker) product, so that the rounding is decided on the exact
+ * value and not on the rounded product.
+ * @return the number of characters written.
+ */
+static uint32 CSVFormatFixed(const float64 value,
+                             char8 * const out) {
+    uint32 n = 0u;
+    if ((value > -CSV_FIXED_MAX) && (value < CSV_FIXED_MAX)) {
+        //-0.0 is also written with the sign
+        bool negative = (value < 0.0) || ((value == 0.0) && ((1.0 / value) < 0.0));
+        float64 magnitude = negative ? -value : value;
+        uint64 integerPart = static_cast<uint64>(magnitude);
+        float64 fraction = magnitude - static_cast<float64>(integerPart);
+        //Exact product fraction * 1e6 = product + error
+        const float64 split = 134217729.0;
+        const float64 scaleHigh = 999424.0;
+        const float64 scaleLow = 576.0;
+        float64 product = fraction * 1e6;
+        float64 splitFraction = split * fraction;
+        float64 fractionHigh = splitFraction - (splitFraction - fraction);
+        float64 fractionLow = fraction - fractionHigh;
+        float64 error = (((fractionHigh * scaleHigh) - product) + (fractionHigh * scaleLow) + (fractionLow * scaleHigh)) + (fractionLow * scaleLow);
+        uint64 scaled = static_cast<uint64>(product);
+        float64 remainder = (product - static_cast<float64>(scaled)) - 0.5;
+        //The error is smaller than the resolution of the remainder, so it only matters if the remainder is exactly half
+        bool roundUp = (remainder > 0.0);
+        if (remainder == 0.0) {
+            roundUp = (error > 0.0) || ((error == 0.0) && ((scaled % 2u) == 1u));
+        }
+        if (roundUp) {
+            scaled++;
+        }
+        if (scaled >= 1000000u) {
+            integerPart++;
+            scaled -= 1000000u;
+        }
+        if (negative) {
+            out[n] = '-';
+            n++;
+        }
+        n += CSVFormatUnsigned(integerPart, &out[n]);
+        out[n] = '.';
+        n++;
+        for (uint32 i = 6u; i > 0u; i--) {
+            out[n + i - 1u] = static_cast<char8>('0' + static_cast<char8>(scaled % 10u));
+            scaled /= 10u;
+        }
+        n += 6u;
+    }
+    else {
+        //Large and non-finite values
+        int32 ret = snprintf(out, static_cast<size_t>(CSV_MAX_FLOAT64_SIZE), "%.6f", value);
+        n = (ret > 0) ? static_cast<uint32>(ret) : 0u;
+    }
+    return n;
+}
+
+/**
+ * @brief Writes a float32 with the shortest %g representation which is read back as the same value.
+ * @return the number of characters written.
+ */
+static uint32 CSVFormatShortest32(const float32 value,
+                                  char8 * const out) {
+    int32 ret = 0;
+    bool done = false;
+    for (int32 precision = 6; (precision <= 9) && (!done); precision++) {
+        ret = snprintf(out, static_cast<size_t>(CSV_MAX_FLOAT32_SIZE), "%.*g", precision, static_cast<float64>(value));
+        done = (strtof(out, NULL_PTR(char8 **)) == value);
+    }
+    return (ret > 0) ? static_cast<uint32>(ret) : 0u;
+}
+
+/**
+ * @brief Writes a float64 with the shortest %g representation which is read back as the same value.
+ * @return the number of characters written.
+ */
+static uint32 CSVFormatShortest64(const float64 value,
+                                  char8 * const out) {
+    int32 ret = 0;
+    bool done = false;
+    for (int32 precision = 15; (precision <= 17) && (!done); precision++) {
+        ret = snprintf(out, static_cast<size_t>(CSV_MAX_FLOAT64_SIZE), "%.*g", precision, value);
+        done = (strtod(out, NULL_PTR(char8 **)) == value);
+    }
+    return (ret > 0) ? static_cast<uint32>(ret) : 0u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+FileWriterCSVEncoder::FileWriterCSVEncoder() {
+    types = NULL_PTR(TypeDescriptor *);
+    addresses = NULL_PTR(const char8 **);
+    numberOfElements = NULL_PTR(uint32 *);
+    isArray = NULL_PTR(bool *);
+    numberOfSignals = 0u;
+    shortestFloats = false;
+    buffer = NULL_PTR(char8 *);
+    bufferSize = 0u;
+}
+
+FileWriterCSVEncoder::~FileWriterCSVEncoder() {
+    if (types != NULL_PTR(TypeDescriptor *)) {
+        delete[] types;
+    }
+    if (addresses != NULL_PTR(const char8 **)) {
+        delete[] addresses;
+    }
+    if (numberOfElements != NULL_PTR(uint32 *)) {
+        delete[] numberOfElements;
+    }
+    if (isArray != NULL_PTR(bool *)) {
+        delete[] isArray;
+    }
+    if (buffer != NULL_PTR(char8 *)) {
+        delete[] buffer;
+    }
+}
+
+bool FileWriterCSVEncoder::SetNumberOfSignals(const uint32 numberOfSignalsIn) {
+    bool ok = (numberOfSignalsIn > 0u) && (types == NULL_PTR(TypeDescriptor *));
+    if (ok) {
+        numberOfSignals = numberOfSignalsIn;
+        types = new TypeDescriptor[numberOfSignals];
+        addresses = new const char8*[numberOfSignals];
+        numberOfElements = new uint32[numberOfSignals];
+        isArray = new bool[numberOfSignals];
+        for (uint32 n = 0u; n < numberOfSignals; n++) {
+            addresses[n] = NULL_PTR(const char8 *);
+            numberOfElements[n] = 0u;
+            isArray[n] = false;
+        }
+    }
+    return ok;
+}
+
+bool FileWriterCSVEncoder::SetSignal(const uint32 signalIdx,
+                                     const TypeDescriptor &type,
+                                     const void * const address,
+                                     const uint32 numberOfElementsIn,
+                                     const bool isArrayIn) {
+    bool ok = (signalIdx < numberOfSignals) && (address != NULL_PTR(const void *));
+    if (ok) {
+        bool isInteger = ((type.type == UnsignedInteger) || (type.type == SignedInteger));
+        bool isFloat = ((type == Float32Bit) || (type == Float64Bit));
+        ok = (isFloat) || ((isInteger) && (type.numberOfBits <= 64u));
+    }
+    if (ok) {
+        /*lint -e{613} the arrays cannot be NULL if signalIdx < numberOfSignals*/
+        types[signalIdx] = type;
+        addresses[signalIdx] = static_cast<const char8 *>(address);
+        numberOfElements[signalIdx] = numberOfElementsIn;
+        isArray[signalIdx] = isArrayIn;
+    }
+    return ok;
+}
+
+bool FileWriterCSVEncoder::Compile(const char8 * const separatorIn,
+                                   const bool shortestFloatsIn) {
+    separator = separatorIn;
+    shortestFloats = shortestFloatsIn;
+    bool ok = (numberOfSignals > 0u);
+    uint64 size = 2u;
+    for (uint32 n = 0u; (n < numberOfSignals) && (ok); n++) {
+        /*lint -e{613} the arrays cannot be NULL if numberOfSignals > 0*/
+        ok = (addresses[n] != NULL_PTR(const char8 *));
+        uint32 elementSize = CSV_MAX_INTEGER_SIZE;
+        if (types[n] == Float32Bit) {
+            elementSize = CSV_MAX_FLOAT32_SIZE;
+        }
+        else if (types[n] == Float64Bit) {
+            elementSize = CSV_MAX_FLOAT64_SIZE;
+        }
+        else {
+            //NOOP
+        }
+        //Each element is followed by a space in arrays, which are enclosed by "{ " and "} "
+        size += (static_cast<uint64>(elementSize) + 1u) * numberOfElements[n];
+        size += 4u + separator.Size();
+    }
+    if (ok) {
+        ok = (size < 0xFFFFFFFFu);
+    }
+    if (ok) {
+        if (buffer != NULL_PTR(char8 *)) {
+            delete[] buffer;
+        }
+        bufferSize = static_cast<uint32>(size);
+        buffer = new char8[bufferSize];
+    }
+    return ok;
+}
+
+uint32 FileWriterCSVEncoder::EncodeElement(const uint32 signalIdx,
+                                           const uint32 elementIdx,
+                                           char8 * const out) const {
+    uint32 n = 0u;
+    /*lint -e{613} the arrays cannot be NULL if the encoder was compiled*/
+    const TypeDescriptor &type = types[signalIdx];
+    const char8 * const address = addresses[signalIdx];
+    /*lint -e{826} -e{927} the address points to an array of signal type elements*/
+    if (type == Float32Bit) {
+        float32 value = reinterpret_cast<const float32 *>(address)[elementIdx];
+        n = shortestFloats ? CSVFormatShortest32(value, out) : CSVFormatFixed(static_cast<float64>(value), out);
+    }
+    else if (type == Float64Bit) {
+        float64 value = reinterpret_cast<const float64 *>(address)[elementIdx];
+        n = shortestFloats ? CSVFormatShortest64(value, out) : CSVFormatFixed(value, out);
+    }
+    else if (type.type == UnsignedInteger) {
+        uint64 value = 0u;
+        if (type.numberOfBits == 8u) {
+            value = reinterpret_cast<const uint8 *>(address)[elementIdx];
+        }
+        else if (type.numberOfBits == 16u) {
+            value = reinterpret_cast<const uint16 *>(address)[elementIdx];
+        }
+        else if (type.numberOfBits == 32u) {
+            value = reinterpret_cast<const uint32 *>(address)[elementIdx];
+        }
+        else {
+            value = reinterpret_cast<const uint64 *>(address)[elementIdx];
+        }
+        n = CSVFormatUnsigned(value, out);
+    }
+    else {
+        int64 value = 0;
+        if (type.numberOfBits == 8u) {
+            value = reinterpret_cast<const int8 *>(address)[elementIdx];
+        }
+        else if (type.numberOfBits == 16u) {
+            value = reinterpret_cast<const int16 *>(address)[elementIdx];
+        }
+        else if (type.numberOfBits == 32u) {
+            value = reinterpret_cast<const int32 *>(address)[elementIdx];
+        }
+        else {
+            value = reinterpret_cast<const int64 *>(address)[elementIdx];
+        }
+        n = CSVFormatSigned(value, out);
+    }
+    return n;
+}
+
+uint32 FileWriterCSVEncoder::Encode() {
+    uint32 size = 0u;
+    uint32 separatorSize = static_cast<uint32>(separator.Size());
+    if (buffer != NULL_PTR(char8 *)) {
+        for (uint32 n = 0u; n < numberOfSignals; n++) {
+            if (n != 0u) {
+                (void) MemoryOperationsHelper::Copy(&buffer[size], separator.Buffer(), separatorSize);
+                size += separatorSize;
+            }
+            /*lint -e{613} isArray and numberOfElements cannot be NULL if the buffer was allocated*/
+            if (isArray[n]) {
+                buffer[size] = '{';
+                buffer[size + 1u] = ' ';
+                size += 2u;
+                for (uint32 e = 0u; e < numberOfElements[n]; e++) {
+                    size += EncodeElement(n, e, &buffer[size]);
+                    buffer[size] = ' ';
+                    size++;
+                }
+                buffer[size] = '}';
+                buffer[size + 1u] = ' ';
+                size += 2u;
+            }
+            else {
+                size += EncodeElement(n, 0u, &buffer[size]);
+            }
+        }
+        buffer[size] = '\n';
+        size++;
+    }
+    return size;
+}
+
+const char8 *FileWriterCSVEncoder::GetBuffer() const {
+    return buffer;
+}
+
+}
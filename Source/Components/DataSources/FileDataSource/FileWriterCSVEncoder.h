@@ -0,0 +1,156 @@
+/**
+ * @file FileWriterCSVEncoder.h
+ * @brief Header file for class FileWriterCSVEncoder
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FileWriterCSVEncoder
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef FILEDATASOURCE_FILEWRITERCSVENCODER_H_
+#define FILEDATASOURCE_FILEWRITERCSVENCODER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "StreamString.h"
+#include "TypeDescriptor.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Encodes one csv line of the FileWriter signals without the AnyType printf machinery.
+ * @details The signal layout (type, address, number of elements) is compiled once (see SetSignal and Compile) into a list of typed
+ * formatters which write into a reusable buffer, sized for the longest possible line.
+ *
+ * The output is the same as the one of PrintFormatted with the %u, %d and %f formats: integers are written in decimal, arrays are
+ * written as "{ e0 e1 ... } " and floats are written with 6 decimal digits (values with a magnitude larger than 1e9 and non-finite
+ * values are written with the C library). If shortestFloats is set, floats are instead written with the shortest
+ * %g representation (up to 9 significant digits for float32 and 17 for float64) which is read back as the same value.
+ */
+class FileWriterCSVEncoder {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    FileWriterCSVEncoder();
+
+    /**
+     * @brief Destructor. Frees the signal layout and the buffer.
+     */
+    ~FileWriterCSVEncoder();
+
+    /**
+     * @brief Allocates the layout of numberOfSignals signals.
+     * @param[in] numberOfSignals the number of signals in each line.
+     * @return true if numberOfSignals > 0.
+     */
+    bool SetNumberOfSignals(const uint32 numberOfSignals);
+
+    /**
+     * @brief Sets the layout of a signal.
+     * @param[in] signalIdx the index of the signal (i.e. its position in the line).
+     * @param[in] type the signal type (only integers and floats are supported).
+     * @param[in] address the memory of the signal.
+     * @param[in] numberOfElements the number of elements of the signal.
+     * @param[in] isArray if true the elements are written between braces.
+     * @return true if the signalIdx is valid and the type is supported.
+     */
+    bool SetSignal(const uint32 signalIdx,
+                   const TypeDescriptor &type,
+                   const void * const address,
+                   const uint32 numberOfElements,
+                   const bool isArray);
+
+    /**
+     * @brief Allocates the buffer for the longest possible line.
+     * @param[in] separator the separator between signals.
+     * @param[in] shortestFloats if true the floats are written with the shortest round-trip representation.
+     * @return true if all the signals were set.
+     */
+    bool Compile(const char8 * const separator,
+                 const bool shortestFloats);
+
+    /**
+     * @brief Encodes the current value of the signals (terminated by a new line).
+     * @return the number of bytes written in the buffer.
+     */
+    uint32 Encode();
+
+    /**
+     * @brief Gets the buffer where the last line was encoded.
+     * @return the buffer where the last line was encoded.
+     */
+    const char8 *GetBuffer() const;
+
+private:
+
+    /**
+     * @brief Writes a single element of the signal signalIdx.
+     * @param[in] signalIdx the index of the signal.
+     * @param[in] elementIdx the index of the element.
+     * @param[out] out where to write the element.
+     * @return the number of bytes written.
+     */
+    uint32 EncodeElement(const uint32 signalIdx,
+                         const uint32 elementIdx,
+                         char8 * const out) const;
+
+    /**
+     * The type, address, number of elements and array flag of each signal.
+     */
+    TypeDescriptor *types;
+    const char8 **addresses;
+    uint32 *numberOfElements;
+    bool *isArray;
+
+    /**
+     * The number of signals.
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * The separator between signals.
+     */
+    StreamString separator;
+
+    /**
+     * True if the floats are written with the shortest round-trip representation.
+     */
+    bool shortestFloats;
+
+    /**
+     * The buffer where the line is encoded and its size.
+     */
+    char8 *buffer;
+    uint32 bufferSize;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FILEDATASOURCE_FILEWRITERCSVENCODER_H_ */
@@ -0,0 +1,268 @@
+/**
+ * @file FileWriterIOUring.cpp
+ * @brief Source file for class FileWriterIOUring
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FileWriterIOUring (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <string.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "FileWriterIOUring.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+FileWriterIOUring::FileWriterIOUring() {
+    ringFd = -1;
+    sqRing = NULL_PTR(void *);
+    sqes = NULL_PTR(void *);
+    cqRing = NULL_PTR(void *);
+    sqRingSize = 0u;
+    sqesSize = 0u;
+    cqRingSize = 0u;
+    sqHead = NULL_PTR(uint32 *);
+    sqTail = NULL_PTR(uint32 *);
+    sqMask = NULL_PTR(uint32 *);
+    sqArray = NULL_PTR(uint32 *);
+    cqHead = NULL_PTR(uint32 *);
+    cqTail = NULL_PTR(uint32 *);
+    cqMask = NULL_PTR(uint32 *);
+    cqes = NULL_PTR(void *);
+    toSubmit = 0u;
+    iovecs = NULL_PTR(struct iovec *);
+    writeIovecs = NULL_PTR(struct iovec *);
+    numberOfIovecs = 0u;
+    registered = false;
+}
+
+FileWriterIOUring::~FileWriterIOUring() {
+    Close();
+}
+
+bool FileWriterIOUring::Open(const uint32 queueDepth) {
+    Close();
+    struct io_uring_params params;
+    (void) memset(&params, 0, sizeof(params));
+    ringFd = static_cast<int32>(syscall(__NR_io_uring_setup, queueDepth, &params));
+    bool ok = (ringFd >= 0);
+    if (ok) {
+        //The queues are always mapped separately (IORING_FEAT_SINGLE_MMAP is only an optimisation of newer kernels)
+        sqRingSize = params.sq_off.array + (params.sq_entries * static_cast<uint32>(sizeof(uint32)));
+        cqRingSize = params.cq_off.cqes + (params.cq_entries * static_cast<uint32>(sizeof(struct io_uring_cqe)));
+        sqesSize = params.sq_entries * static_cast<uint32>(sizeof(struct io_uring_sqe));
+        sqRing = mmap(NULL_PTR(void *), sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+        ok = (sqRing != MAP_FAILED);
+        if (!ok) {
+            sqRing = NULL_PTR(void *);
+        }
+    }
+    if (ok) {
+        cqRing = mmap(NULL_PTR(void *), cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+        ok = (cqRing != MAP_FAILED);
+        if (!ok) {
+            cqRing = NULL_PTR(void *);
+        }
+    }
+    if (ok) {
+        sqes = mmap(NULL_PTR(void *), sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+        ok = (sqes != MAP_FAILED);
+        if (!ok) {
+            sqes = NULL_PTR(void *);
+        }
+    }
+    if (ok) {
+        /*lint -e{925} -e{927} the offsets of the shared fields are given by the kernel*/
+        char8 *sq = static_cast<char8 *>(sqRing);
+        sqHead = reinterpret_cast<uint32 *>(&sq[params.sq_off.head]);
+        sqTail = reinterpret_cast<uint32 *>(&sq[params.sq_off.tail]);
+        sqMask = reinterpret_cast<uint32 *>(&sq[params.sq_off.ring_mask]);
+        sqArray = reinterpret_cast<uint32 *>(&sq[params.sq_off.array]);
+        char8 *cq = static_cast<char8 *>(cqRing);
+        cqHead = reinterpret_cast<uint32 *>(&cq[params.cq_off.head]);
+        cqTail = reinterpret_cast<uint32 *>(&cq[params.cq_off.tail]);
+        cqMask = reinterpret_cast<uint32 *>(&cq[params.cq_off.ring_mask]);
+        cqes = &cq[params.cq_off.cqes];
+        toSubmit = 0u;
+    }
+    else {
+        Close();
+    }
+    return ok;
+}
+
+bool FileWriterIOUring::RegisterBuffers(char8 * const * const buffers,
+                                        const uint32 numberOfBuffers,
+                                        const uint32 bufferSize) {
+    bool ok = IsOpen();
+    if (ok) {
+        if (registered) {
+            (void) syscall(__NR_io_uring_register, ringFd, IORING_UNREGISTER_BUFFERS, NULL_PTR(void *), 0u);
+            registered = false;
+        }
+        delete[] iovecs;
+        delete[] writeIovecs;
+        numberOfIovecs = numberOfBuffers;
+        iovecs = new struct iovec[numberOfBuffers];
+        writeIovecs = new struct iovec[numberOfBuffers];
+        for (uint32 n = 0u; n < numberOfBuffers; n++) {
+            iovecs[n].iov_base = buffers[n];
+            iovecs[n].iov_len = static_cast<size_t>(bufferSize);
+            writeIovecs[n] = iovecs[n];
+        }
+        registered = (syscall(__NR_io_uring_register, ringFd, IORING_REGISTER_BUFFERS, iovecs, numberOfBuffers) == 0);
+        ok = registered;
+    }
+    return ok;
+}
+
+bool FileWriterIOUring::PrepareWrite(const int32 fd,
+                                     const uint32 bufferIdx,
+                                     const char8 * const data,
+                                     const uint32 size,
+                                     const uint64 offset,
+                                     const uint64 userData) {
+    bool ok = (IsOpen()) && (bufferIdx < numberOfIovecs);
+    uint32 tail = 0u;
+    if (ok) {
+        //Only the kernel moves the head
+        uint32 head = __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+        tail = *sqTail + toSubmit;
+        ok = ((tail - head) <= *sqMask);
+    }
+    if (ok) {
+        uint32 index = tail & *sqMask;
+        struct io_uring_sqe *sqe = &(static_cast<struct io_uring_sqe *>(sqes)[index]);
+        (void) memset(sqe, 0, sizeof(struct io_uring_sqe));
+        sqe->fd = fd;
+        sqe->off = offset;
+        sqe->user_data = userData;
+        if (registered) {
+            sqe->opcode = IORING_OP_WRITE_FIXED;
+            sqe->addr = reinterpret_cast<uint64>(data);
+            sqe->len = size;
+            sqe->buf_index = static_cast<uint16>(bufferIdx);
+        }
+        else {
+            /*lint -e{613} writeIovecs cannot be NULL if bufferIdx < numberOfIovecs*/
+            writeIovecs[bufferIdx].iov_base = const_cast<char8 *>(data);
+            writeIovecs[bufferIdx].iov_len = static_cast<size_t>(size);
+            sqe->opcode = IORING_OP_WRITEV;
+            sqe->addr = reinterpret_cast<uint64>(&writeIovecs[bufferIdx]);
+            sqe->len = 1u;
+        }
+        sqArray[index] = index;
+        toSubmit++;
+    }
+    return ok;
+}
+
+bool FileWriterIOUring::Enter(const bool waitCompletion) {
+    bool ok = IsOpen();
+    if (ok) {
+        //Publish the prepared entries before the new tail is seen by the kernel
+        uint32 tail = *sqTail + toSubmit;
+        __atomic_store_n(sqTail, tail, __ATOMIC_RELEASE);
+        toSubmit = 0u;
+        //Also (re)submits the entries which were not consumed by a previous call
+        uint32 notConsumed = tail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+        uint32 minComplete = waitCompletion ? 1u : 0u;
+        uint32 flags = waitCompletion ? static_cast<uint32>(IORING_ENTER_GETEVENTS) : 0u;
+        bool done = false;
+        while (!done) {
+            long ret = syscall(__NR_io_uring_enter, ringFd, notConsumed, minComplete, flags, NULL_PTR(void *), 0u);
+            done = (ret >= 0);
+            if (!done) {
+                ok = (errno == EINTR);
+                done = !ok;
+            }
+        }
+    }
+    return ok;
+}
+
+bool FileWriterIOUring::GetCompletion(uint64 &userData,
+                                      int32 &result) {
+    bool ok = IsOpen();
+    if (ok) {
+        uint32 head = *cqHead;
+        ok = (head != __atomic_load_n(cqTail, __ATOMIC_ACQUIRE));
+        if (ok) {
+            const struct io_uring_cqe *cqe = &(static_cast<struct io_uring_cqe *>(cqes)[head & *cqMask]);
+            userData = cqe->user_data;
+            result = cqe->res;
+            __atomic_store_n(cqHead, head + 1u, __ATOMIC_RELEASE);
+        }
+    }
+    return ok;
+}
+
+void FileWriterIOUring::Close() {
+    if (sqes != NULL_PTR(void *)) {
+        (void) munmap(sqes, sqesSize);
+        sqes = NULL_PTR(void *);
+    }
+    if (cqRing != NULL_PTR(void *)) {
+        (void) munmap(cqRing, cqRingSize);
+        cqRing = NULL_PTR(void *);
+    }
+    if (sqRing != NULL_PTR(void *)) {
+        (void) munmap(sqRing, sqRingSize);
+        sqRing = NULL_PTR(void *);
+    }
+    if (ringFd >= 0) {
+        //Closing the ring also unregisters the buffers
+        (void) close(ringFd);
+        ringFd = -1;
+    }
+    delete[] iovecs;
+    iovecs = NULL_PTR(struct iovec *);
+    delete[] writeIovecs;
+    writeIovecs = NULL_PTR(struct iovec *);
+    numberOfIovecs = 0u;
+    registered = false;
+    toSubmit = 0u;
+}
+
+bool FileWriterIOUring::IsOpen() const {
+    return (ringFd >= 0) && (sqes != NULL_PTR(void *));
+}
+
+bool FileWriterIOUring::IsRegistered() const {
+    return registered;
+}
+
+}
@@ -0,0 +1,195 @@
+/**
+ * @file FileWriterIOUring.h
+ * @brief Header file for class FileWriterIOUring
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FileWriterIOUring
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef FILEDATASOURCE_FILEWRITERIOURING_H_
+#define FILEDATASOURCE_FILEWRITERIOURING_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <sys/uio.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Minimal io_uring submission/completion ring used by the I/O thread of the FileWriter (see IOBackend).
+ * @details The ring is created with the raw io_uring_setup/io_uring_enter/io_uring_register system calls, so that no
+ * additional library is required. The staging buffers of the FileWriter are registered with the kernel (IORING_OP_WRITE_FIXED),
+ * so that they are not mapped on every write. If they cannot be registered (e.g. because of RLIMIT_MEMLOCK) the writes
+ * are submitted with IORING_OP_WRITEV.
+ *
+ * The ring is not thread safe: all the methods shall be called by the same thread (or with an external lock).
+ */
+class FileWriterIOUring {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    FileWriterIOUring();
+
+    /**
+     * @brief Destructor. Calls Close.
+     */
+    ~FileWriterIOUring();
+
+    /**
+     * @brief Creates the ring and maps the submission and completion queues.
+     * @param[in] queueDepth the maximum number of writes in flight.
+     * @return true if the kernel supports io_uring and the queues could be mapped.
+     */
+    bool Open(const uint32 queueDepth);
+
+    /**
+     * @brief Registers the staging buffers with the kernel.
+     * @param[in] buffers the staging buffers.
+     * @param[in] numberOfBuffers the number of staging buffers.
+     * @param[in] bufferSize the size of each staging buffer.
+     * @return true if the buffers could be registered. If false the writes are submitted with IORING_OP_WRITEV.
+     */
+    bool RegisterBuffers(char8 * const * const buffers,
+                         const uint32 numberOfBuffers,
+                         const uint32 bufferSize);
+
+    /**
+     * @brief Adds a write to the submission queue (it is only submitted to the kernel by Enter).
+     * @param[in] fd the file descriptor.
+     * @param[in] bufferIdx the index of the staging buffer which contains the data (at most one write in flight per buffer).
+     * @param[in] data the first byte to write (inside the buffer bufferIdx).
+     * @param[in] size the number of bytes to write.
+     * @param[in] offset the offset in the file.
+     * @param[in] userData returned with the completion of the write.
+     * @return true if there was space in the submission queue.
+     */
+    bool PrepareWrite(const int32 fd,
+                      const uint32 bufferIdx,
+                      const char8 * const data,
+                      const uint32 size,
+                      const uint64 offset,
+                      const uint64 userData);
+
+    /**
+     * @brief Submits the prepared writes and optionally waits for at least one completion.
+     * @param[in] waitCompletion if true blocks until at least one write is completed.
+     * @return true if the io_uring_enter system call succeeds.
+     */
+    bool Enter(const bool waitCompletion);
+
+    /**
+     * @brief Removes the next completion from the completion queue (does not block).
+     * @param[out] userData the userData of the completed write.
+     * @param[out] result the number of bytes written or -errno.
+     * @return true if a completion was available.
+     */
+    bool GetCompletion(uint64 &userData,
+                       int32 &result);
+
+    /**
+     * @brief Unmaps the queues and closes the ring.
+     */
+    void Close();
+
+    /**
+     * @brief Checks if Open succeeded.
+     * @return true if the ring is open.
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Checks if the buffers are registered.
+     * @return true if the writes are submitted with IORING_OP_WRITE_FIXED.
+     */
+    bool IsRegistered() const;
+
+private:
+
+    /**
+     * The ring file descriptor (-1 if not open).
+     */
+    int32 ringFd;
+
+    /**
+     * The mapped submission queue ring, the array of submission queue entries and the completion queue ring.
+     */
+    void *sqRing;
+    void *sqes;
+    void *cqRing;
+
+    /**
+     * The sizes of the mapped regions.
+     */
+    uint32 sqRingSize;
+    uint32 sqesSize;
+    uint32 cqRingSize;
+
+    /**
+     * Pointers to the shared fields of the submission queue.
+     */
+    uint32 *sqHead;
+    uint32 *sqTail;
+    uint32 *sqMask;
+    uint32 *sqArray;
+
+    /**
+     * Pointers to the shared fields of the completion queue.
+     */
+    uint32 *cqHead;
+    uint32 *cqTail;
+    uint32 *cqMask;
+    void *cqes;
+
+    /**
+     * Number of submission queue entries prepared but not yet submitted.
+     */
+    uint32 toSubmit;
+
+    /**
+     * The iovec of each staging buffer (as registered with the kernel).
+     */
+    struct iovec *iovecs;
+    uint32 numberOfIovecs;
+
+    /**
+     * The iovec of the write in flight of each staging buffer (only used with IORING_OP_WRITEV).
+     */
+    struct iovec *writeIovecs;
+
+    /**
+     * True if the buffers were registered with the kernel.
+     */
+    bool registered;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FILEDATASOURCE_FILEWRITERIOURING_H_ */
@@ -0,0 +1,500 @@
+/**
+ * @file ReplayTimer.cpp
+ * @brief Source file for class ReplayTimer
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ReplayTimer (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "File.h"
+#include "FileColumnChunk.h"
+#include "FileFrameCodec.h"
+#include "MemoryOperationsHelper.h"
+#include "ReplayTimer.h"
+#include "TypeConversion.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Size of the signal names in the header of the binary files.
+ */
+const MARTe::uint32 REPLAY_TIMER_SIGNAL_NAME_SIZE = 32u;
+
+/**
+ * Nanoseconds in one second.
+ */
+const MARTe::uint64 REPLAY_TIMER_NSEC_PER_SEC = 1000000000u;
+
+/**
+ * @brief Reads the CLOCK_MONOTONIC time in nanoseconds.
+ */
+MARTe::uint64 MonotonicNs() {
+    struct timespec now;
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+    return (static_cast<MARTe::uint64>(now.tv_sec) * REPLAY_TIMER_NSEC_PER_SEC) + static_cast<MARTe::uint64>(now.tv_nsec);
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+ReplayTimer::ReplayTimer() :
+        MemoryDataSourceI() {
+    filename = "";
+    timeSignal = "";
+    timeUnit = 1e-6;
+    acceleration = 1.0;
+    spinMarginNs = 50000u;
+    rewind = true;
+    lockMemory = false;
+    headerSize = 0u;
+    cycleSize = 0u;
+    mapBase = NULL_PTR(char8 *);
+    mapSize = 0u;
+    numberOfFileCycles = 0u;
+    deadlines = NULL_PTR(uint64 *);
+    rewindPeriodNs = 0u;
+    cycle = 0u;
+    originNs = 0u;
+    rebase = true;
+    numberOfCycles = 0u;
+    overruns = 0u;
+    maxLateness = 0u;
+}
+
+/*lint -e{1551} the destructor must guarantee that the mapping and the deadlines are released.*/
+ReplayTimer::~ReplayTimer() {
+    if (mapBase != NULL_PTR(char8 *)) {
+        (void) munmap(mapBase, static_cast<size_t>(mapSize));
+    }
+    if (deadlines != NULL_PTR(uint64 *)) {
+        delete[] deadlines;
+    }
+}
+
+bool ReplayTimer::Initialise(StructuredDataI &data) {
+    bool ok = MemoryDataSourceI::Initialise(data);
+    if (ok) {
+        ok = data.Read("Filename", filename);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The Filename shall be specified");
+        }
+    }
+    if (ok) {
+        ok = data.Read("TimeSignal", timeSignal);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The TimeSignal shall be specified");
+        }
+    }
+    if (ok) {
+        if (!data.Read("TimeUnit", timeUnit)) {
+            timeUnit = 1e-6;
+        }
+        ok = (timeUnit > 0.0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The TimeUnit shall be > 0");
+        }
+    }
+    if (ok) {
+        if (!data.Read("Acceleration", acceleration)) {
+            acceleration = 1.0;
+        }
+        ok = (acceleration >= 0.0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The Acceleration shall be >= 0");
+        }
+    }
+    if (ok) {
+        uint32 spinMargin = 50u;
+        if (!data.Read("SpinMargin", spinMargin)) {
+            spinMargin = 50u;
+        }
+        spinMarginNs = static_cast<uint64>(spinMargin) * 1000u;
+        StreamString eof;
+        if (data.Read("EOF", eof)) {
+            if (eof == "Rewind") {
+                rewind = true;
+            }
+            else if (eof == "Error") {
+                rewind = false;
+            }
+            else {
+                ok = false;
+                REPORT_ERROR(ErrorManagement::ParametersError, "Unsupported EOF option %s. Possible options are: Rewind and Error", eof.Buffer());
+            }
+        }
+    }
+    if (ok) {
+        uint32 lockMemoryIn = 0u;
+        if (data.Read("LockMemory", lockMemoryIn)) {
+            lockMemory = (lockMemoryIn == 1u);
+        }
+        //The signals are added against the header of the file
+        ok = signalsDatabase.MoveRelative("Signals");
+        if (!ok) {
+            ok = signalsDatabase.CreateRelative("Signals");
+        }
+        if (ok) {
+            ok = ReadHeader(signalsDatabase);
+        }
+        if (ok) {
+            ok = signalsDatabase.Write("Locked", 1u);
+        }
+        if (ok) {
+            ok = signalsDatabase.MoveToAncestor(1u);
+        }
+    }
+    return ok;
+}
+
+bool ReplayTimer::ReadHeader(StructuredDataI &cdb) {
+    File inputFile;
+    bool ok = inputFile.Open(filename.Buffer(), BasicFile::ACCESS_MODE_R);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to open File %s", filename.Buffer());
+    }
+    uint32 nOfSignals = 0u;
+    if (ok) {
+        uint32 readSize = static_cast<uint32>(sizeof(uint32));
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+        ok = inputFile.Read(reinterpret_cast<char8 *>(&nOfSignals), readSize);
+        if (ok) {
+            ok = (readSize == static_cast<uint32>(sizeof(uint32))) && (nOfSignals > 0u);
+        }
+    }
+    for (uint32 n = 0u; (n < nOfSignals) && (ok); n++) {
+        TypeDescriptor signalType;
+        uint32 readSize = static_cast<uint32>(sizeof(uint16));
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+        ok = inputFile.Read(reinterpret_cast<char8 *>(&signalType.all), readSize);
+        char8 signalNameMemory[REPLAY_TIMER_SIGNAL_NAME_SIZE + 1u];
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(&signalNameMemory[0], '\0', REPLAY_TIMER_SIGNAL_NAME_SIZE + 1u);
+        }
+        if (ok) {
+            readSize = REPLAY_TIMER_SIGNAL_NAME_SIZE;
+            ok = inputFile.Read(&signalNameMemory[0], readSize);
+        }
+        if (ok) {
+            ok = (readSize == REPLAY_TIMER_SIGNAL_NAME_SIZE);
+        }
+        uint32 nOfElements = 0u;
+        if (ok) {
+            readSize = static_cast<uint32>(sizeof(uint32));
+            /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+            ok = inputFile.Read(reinterpret_cast<char8 *>(&nOfElements), readSize);
+        }
+        if (ok) {
+            //lint -e{645} signalNameMemory is always initialised if ok
+            ok = cdb.CreateRelative(&signalNameMemory[0]);
+        }
+        if (ok) {
+            ok = cdb.Write("Type", TypeDescriptor::GetTypeNameFromTypeDescriptor(signalType));
+        }
+        if (ok) {
+            ok = cdb.Write("NumberOfElements", nOfElements);
+        }
+        if (ok) {
+            ok = cdb.MoveToAncestor(1u);
+        }
+    }
+    if (ok) {
+        headerSize = static_cast<uint32>(sizeof(uint32))
+                + (nOfSignals * (static_cast<uint32>(sizeof(uint16)) + REPLAY_TIMER_SIGNAL_NAME_SIZE + static_cast<uint32>(sizeof(uint32))));
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not read the header of %s", filename.Buffer());
+    }
+    (void) inputFile.Close();
+    return ok;
+}
+
+bool ReplayTimer::SetConfiguredDatabase(StructuredDataI &data) {
+    bool ok = MemoryDataSourceI::SetConfiguredDatabase(data);
+    uint32 timeSignalIdx = 0u;
+    if (ok) {
+        ok = GetSignalIndex(timeSignalIdx, timeSignal.Buffer());
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The TimeSignal %s is not recorded in %s", timeSignal.Buffer(), filename.Buffer());
+        }
+    }
+    if (ok) {
+        uint32 nOfElements = 0u;
+        ok = GetSignalNumberOfElements(timeSignalIdx, nOfElements);
+        if (ok) {
+            TypeDescriptor timeType = GetSignalType(timeSignalIdx);
+            ok = (nOfElements == 1u) && (timeType.isStructuredData == 0u)
+                    && ((timeType.type == UnsignedInteger) || (timeType.type == SignedInteger) || (timeType.type == Float));
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The TimeSignal shall be a numeric scalar");
+        }
+    }
+    //The cycle is the concatenation of all the signals (in the order of the header)
+    uint32 timeOffset = 0u;
+    cycleSize = 0u;
+    uint32 nOfSignals = GetNumberOfSignals();
+    for (uint32 s = 0u; (s < nOfSignals) && (ok); s++) {
+        if (s == timeSignalIdx) {
+            timeOffset = cycleSize;
+        }
+        uint32 signalSize = 0u;
+        ok = GetSignalByteSize(s, signalSize);
+        cycleSize += signalSize;
+    }
+    int32 fd = -1;
+    if (ok) {
+        fd = open(filename.Buffer(), O_RDONLY);
+        ok = (fd >= 0);
+    }
+    if (ok) {
+        off_t fileSize = lseek(fd, 0, SEEK_END);
+        ok = (fileSize > static_cast<off_t>(headerSize));
+        if (ok) {
+            mapSize = static_cast<uint64>(fileSize);
+            numberOfFileCycles = (mapSize - headerSize) / cycleSize;
+            ok = ((numberOfFileCycles * cycleSize) == (mapSize - headerSize));
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The data size of %s is not a positive multiple of the cycle size (%u)", filename.Buffer(),
+                         cycleSize);
+        }
+    }
+    if (ok) {
+        //Populate the mapping so that the replay does not page fault
+        void *mem = mmap(NULL_PTR(void *), static_cast<size_t>(mapSize), PROT_READ, (MAP_SHARED | MAP_POPULATE), fd, 0);
+        ok = (mem != MAP_FAILED);
+        if (ok) {
+            mapBase = static_cast<char8 *>(mem);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Could not map the file %s in memory", filename.Buffer());
+        }
+    }
+    if (fd >= 0) {
+        //The mapping is kept after the descriptor is closed
+        (void) close(fd);
+    }
+    if ((ok) && ((mapSize - headerSize) >= sizeof(FileFrameHeader))) {
+        FileFrameHeader frameHeader;
+        (void) MemoryOperationsHelper::Copy(&frameHeader, &mapBase[headerSize], static_cast<uint32>(sizeof(FileFrameHeader)));
+        FileChunkHeader chunkHeader;
+        ok = (!FileFrameCodec::HasMagic(frameHeader)) && (!FileColumnChunk::ReadHeader(&mapBase[headerSize], chunkHeader));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The file %s shall be recorded with Compression = none and Layout = row", filename.Buffer());
+        }
+    }
+    if ((ok) && (lockMemory)) {
+        if (mlock(mapBase, static_cast<size_t>(mapSize)) != 0) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not lock the mapping of %s in memory", filename.Buffer());
+        }
+    }
+    if (ok) {
+        deadlines = new uint64[numberOfFileCycles];
+        TypeDescriptor timeType = GetSignalType(timeSignalIdx);
+        float64 firstTime = 0.0;
+        float64 nsPerUnit = (acceleration > 0.0) ? ((timeUnit * static_cast<float64>(REPLAY_TIMER_NSEC_PER_SEC)) / acceleration) : 0.0;
+        bool monotonic = true;
+        for (uint64 c = 0u; (c < numberOfFileCycles) && (ok); c++) {
+            float64 recordedTime = 0.0;
+            AnyType src(timeType, 0u, &mapBase[headerSize + (c * cycleSize) + timeOffset]);
+            AnyType dst(Float64Bit, 0u, &recordedTime);
+            ok = TypeConvert(dst, src);
+            if (c == 0u) {
+                firstTime = recordedTime;
+            }
+            float64 offsetNs = (recordedTime - firstTime) * nsPerUnit;
+            deadlines[c] = (offsetNs > 0.0) ? static_cast<uint64>(offsetNs + 0.5) : 0u;
+            //A timestamp going back (e.g. a counter wrap) keeps the previous deadline
+            if ((c > 0u) && (deadlines[c] < deadlines[c - 1u])) {
+                deadlines[c] = deadlines[c - 1u];
+                monotonic = false;
+            }
+        }
+        if (!monotonic) {
+            REPORT_ERROR(ErrorManagement::Warning, "The TimeSignal %s of %s is not monotonic", timeSignal.Buffer(), filename.Buffer());
+        }
+        rewindPeriodNs = deadlines[numberOfFileCycles - 1u];
+        if (numberOfFileCycles > 1u) {
+            rewindPeriodNs += (deadlines[numberOfFileCycles - 1u] / (numberOfFileCycles - 1u));
+        }
+        REPORT_ERROR(ErrorManagement::Information, "Replaying %! cycles of %s", numberOfFileCycles, filename.Buffer());
+    }
+    return ok;
+}
+
+bool ReplayTimer::AllocateMemory() {
+    bool ok = MemoryDataSourceI::AllocateMemory();
+    if (ok) {
+        //The signals are copied as one block
+        ok = (totalMemorySize == cycleSize);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Only one buffer is supported");
+        }
+    }
+    return ok;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the data is independent of the broker name.*/
+const char8 *ReplayTimer::GetBrokerName(StructuredDataI &data,
+                                        const SignalDirection direction) {
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == InputSignals) {
+        brokerName = "MemoryMapSynchronisedInputBroker";
+    }
+    return brokerName;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the state names are independent of the operation.*/
+bool ReplayTimer::PrepareNextState(const char8 * const currentStateName,
+                                   const char8 * const nextStateName) {
+    rebase = true;
+    return true;
+}
+
+bool ReplayTimer::Synchronise() {
+    bool ok = true;
+    if (cycle >= numberOfFileCycles) {
+        ok = rewind;
+        if (ok) {
+            cycle = 0u;
+            originNs += rewindPeriodNs;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::FatalError, "The end of %s was reached", filename.Buffer());
+        }
+    }
+    if (ok) {
+        if (rebase) {
+            //The current cycle is due now
+            originNs = MonotonicNs() - deadlines[cycle];
+            rebase = false;
+        }
+        else if (acceleration > 0.0) {
+            WaitUntil(originNs + deadlines[cycle]);
+        }
+        else {
+            //Not timed
+        }
+        (void) MemoryOperationsHelper::Copy(memory, &mapBase[headerSize + (cycle * cycleSize)], cycleSize);
+        cycle++;
+        numberOfCycles++;
+    }
+    return ok;
+}
+
+void ReplayTimer::WaitUntil(const uint64 deadlineNs) {
+    uint64 now = MonotonicNs();
+    if (now > deadlineNs) {
+        overruns++;
+    }
+    else {
+        if ((deadlineNs - now) > spinMarginNs) {
+            uint64 wakeUpNs = deadlineNs - spinMarginNs;
+            struct timespec wakeUpTime;
+            wakeUpTime.tv_sec = static_cast<time_t>(wakeUpNs / REPLAY_TIMER_NSEC_PER_SEC);
+            wakeUpTime.tv_nsec = static_cast<long>(wakeUpNs % REPLAY_TIMER_NSEC_PER_SEC);
+            int32 err;
+            do {
+                err = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeUpTime, NULL_PTR(struct timespec *));
+            }
+            while (err == EINTR);
+        }
+        do {
+            now = MonotonicNs();
+        }
+        while (now < deadlineNs);
+        uint64 lateness = now - deadlineNs;
+        if (lateness > maxLateness) {
+            maxLateness = static_cast<uint32>(lateness);
+        }
+    }
+}
+
+const StreamString &ReplayTimer::GetFilename() const {
+    return filename;
+}
+
+const StreamString &ReplayTimer::GetTimeSignal() const {
+    return timeSignal;
+}
+
+float64 ReplayTimer::GetTimeUnit() const {
+    return timeUnit;
+}
+
+float64 ReplayTimer::GetAcceleration() const {
+    return acceleration;
+}
+
+uint32 ReplayTimer::GetSpinMargin() const {
+    return static_cast<uint32>(spinMarginNs / 1000u);
+}
+
+bool ReplayTimer::IsRewind() const {
+    return rewind;
+}
+
+bool ReplayTimer::IsLockMemory() const {
+    return lockMemory;
+}
+
+uint64 ReplayTimer::GetNumberOfFileCycles() const {
+    return numberOfFileCycles;
+}
+
+uint64 ReplayTimer::GetDeadline(const uint64 cycleIdx) const {
+    uint64 deadline = 0u;
+    if (cycleIdx < numberOfFileCycles) {
+        deadline = deadlines[cycleIdx];
+    }
+    return deadline;
+}
+
+uint64 ReplayTimer::GetNumberOfCycles() const {
+    return numberOfCycles;
+}
+
+uint32 ReplayTimer::GetOverruns() const {
+    return overruns;
+}
+
+uint32 ReplayTimer::GetMaxLateness() const {
+    return maxLateness;
+}
+
+CLASS_REGISTER(ReplayTimer, "1.0")
+
+}
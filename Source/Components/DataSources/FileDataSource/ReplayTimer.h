@@ -0,0 +1,316 @@
+/**
+ * @file ReplayTimer.h
+ * @brief Header file for class ReplayTimer
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ReplayTimer
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FILEDATASOURCE_REPLAYTIMER_H_
+#define FILEDATASOURCE_REPLAYTIMER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MemoryDataSourceI.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief A DataSource which replays a binary recording of the FileWriter and drives the real-time thread on the recorded timestamps.
+ * @details Unlike the FileReader (which provides the next cycle whenever the consumer asks for it), Synchronise waits until the time
+ * at which the cycle was recorded (relative to the start of the replay and divided by Acceleration) before providing its signals. Used
+ * as the synchronising DataSource of a thread (instead of the LinuxTimer), it reproduces offline the timing of the recorded application,
+ * including its jitter, in a repeatable way.
+ *
+ * The recording shall be a binary file written by the FileWriter with Compression = none and Layout = row (see FileReader for the
+ * format of the header). All the recorded signals (e.g. the Counter and Time of the LinuxTimer, its Lateness or any other jitter signal,
+ * and the recorded data) are automatically added against the header of the file and any subset of them can be read by the GAMs.
+ * The TimeSignal is the recorded signal which holds the timestamp of each cycle (e.g. the Time of the LinuxTimer, in microseconds, or its
+ * AbsoluteTime, in nanoseconds).
+ *
+ * The file is mapped in memory (and optionally locked) and the timestamps of all the cycles are converted to nanoseconds when the
+ * DataSource is configured, so that Synchronise never accesses the file system: it waits for the deadline of the cycle (sleeping until
+ * SpinMargin microseconds before the deadline and busy waiting the rest, as the Deadline SleepNature of the HighResolutionTimeProvider)
+ * and copies the cycle in the signals. The replay continues from the current cycle after a state change, with the timeline rebased to
+ * the first Synchronise of the new state.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Replay = {
+ *     Class = ReplayTimer
+ *     Filename = "recording.bin" //Compulsory. Binary file written by the FileWriter (Compression = none, Layout = row).
+ *     TimeSignal = "Time" //Compulsory. Name of the recorded (scalar and numeric) signal which holds the timestamp of each cycle.
+ *     TimeUnit = 1e-6 //Optional. Default: 1e-6 (the LinuxTimer Time is in microseconds). Seconds per unit of the TimeSignal.
+ *     Acceleration = 2.0 //Optional. Default: 1.0. Replay speed with respect to the recording (2.0 replays twice as fast). If 0 the cycles are not timed (as fast as possible).
+ *     SpinMargin = 50 //Optional. Default: 50. Microseconds of busy waiting before each deadline.
+ *     EOF = "Rewind" //Optional. Default: "Rewind". Possible options are: "Rewind" (the replay restarts from the first cycle, one mean recorded period after the last one) and "Error" (Synchronise fails after the last cycle).
+ *     LockMemory = 1 //Optional. Default: 0. If 1 the mapping of the file is locked in memory (mlock).
+ *     HeapName = "Default" //Optional. Default: GlobalObjectsDatabase::Instance()->GetStandardHeap(). Heap where the signals are allocated.
+ * }
+ * </pre>
+ *
+ * The Lateness (time between the deadline and the instant when the wait returned) and the Overruns (cycles whose deadline had already
+ * passed when Synchronise was called) can be queried with the getters, e.g. to verify that the replay itself did not add jitter.
+ */
+class ReplayTimer: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default constructor.
+     * @details Initialises all the optional parameters as described in the class description.
+     */
+    ReplayTimer();
+
+    /**
+     * @brief Destructor. Unmaps the file and frees the deadlines.
+     */
+    virtual ~ReplayTimer();
+
+    /**
+     * @brief Loads and verifies the configuration parameters detailed in the class description and adds the signals of the file header.
+     * @return true if all the mandatory parameters are correctly specified, if the specified optional parameters have valid values and if
+     * the header of the file can be read.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Maps the file and computes the deadline of each cycle.
+     * @return true if the TimeSignal exists and is a numeric scalar, if the file is an uncompressed row binary recording with at least one
+     * cycle and if the file can be mapped in memory.
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI &data);
+
+    /**
+     * @brief Allocates the signals (which are laid out as one cycle of the file).
+     * @return true if the memory was allocated.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief See DataSourceI::GetBrokerName.
+     * @return MemoryMapSynchronisedInputBroker for the InputSignals, NULL otherwise.
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction);
+
+    /**
+     * @brief Rebases the timeline (on the next Synchronise) so that the replay continues from the current cycle.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief Waits for the deadline of the next cycle and copies it in the signals.
+     * @return false if the end of the file was reached and EOF = "Error".
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Gets the configured Filename.
+     */
+    const StreamString &GetFilename() const;
+
+    /**
+     * @brief Gets the configured TimeSignal.
+     */
+    const StreamString &GetTimeSignal() const;
+
+    /**
+     * @brief Gets the configured TimeUnit.
+     */
+    float64 GetTimeUnit() const;
+
+    /**
+     * @brief Gets the configured Acceleration.
+     */
+    float64 GetAcceleration() const;
+
+    /**
+     * @brief Gets the configured SpinMargin in microseconds.
+     */
+    uint32 GetSpinMargin() const;
+
+    /**
+     * @brief Returns true if EOF = "Rewind".
+     */
+    bool IsRewind() const;
+
+    /**
+     * @brief Returns true if LockMemory = 1.
+     */
+    bool IsLockMemory() const;
+
+    /**
+     * @brief Gets the number of cycles in the file.
+     */
+    uint64 GetNumberOfFileCycles() const;
+
+    /**
+     * @brief Gets the deadline of a cycle, in nanoseconds from the first cycle of the file (already divided by the Acceleration).
+     * @return the deadline or 0 if the cycle does not exist.
+     */
+    uint64 GetDeadline(const uint64 cycleIdx) const;
+
+    /**
+     * @brief Gets the number of cycles replayed.
+     */
+    uint64 GetNumberOfCycles() const;
+
+    /**
+     * @brief Gets the number of cycles whose deadline had already passed when Synchronise was called.
+     */
+    uint32 GetOverruns() const;
+
+    /**
+     * @brief Gets the maximum lateness of the wake-up with respect to the deadline, in nanoseconds.
+     */
+    uint32 GetMaxLateness() const;
+
+private:
+
+    /**
+     * @brief Reads the header of the file and adds one signal per recorded signal.
+     * @param[out] cdb the database where the signals are written.
+     * @return true if the header could be read.
+     */
+    bool ReadHeader(StructuredDataI &cdb);
+
+    /**
+     * @brief Waits until the absolute (CLOCK_MONOTONIC) time deadlineNs.
+     */
+    void WaitUntil(const uint64 deadlineNs);
+
+    /**
+     * The name of the recording.
+     */
+    StreamString filename;
+
+    /**
+     * The name of the signal holding the timestamps.
+     */
+    StreamString timeSignal;
+
+    /**
+     * Seconds per unit of the timeSignal.
+     */
+    float64 timeUnit;
+
+    /**
+     * The replay speed.
+     */
+    float64 acceleration;
+
+    /**
+     * The busy waiting before each deadline, in nanoseconds.
+     */
+    uint64 spinMarginNs;
+
+    /**
+     * True if the replay restarts at the end of the file.
+     */
+    bool rewind;
+
+    /**
+     * True if the mapping is locked in memory.
+     */
+    bool lockMemory;
+
+    /**
+     * The size of the header of the file.
+     */
+    uint32 headerSize;
+
+    /**
+     * The size of one cycle.
+     */
+    uint32 cycleSize;
+
+    /**
+     * The mapping of the file.
+     */
+    char8 *mapBase;
+
+    /**
+     * The size of the mapping.
+     */
+    uint64 mapSize;
+
+    /**
+     * The number of cycles in the file.
+     */
+    uint64 numberOfFileCycles;
+
+    /**
+     * The deadline of each cycle in nanoseconds from the first cycle of the file.
+     */
+    uint64 *deadlines;
+
+    /**
+     * The time added to the timeline on each rewind (last deadline plus the mean recorded period).
+     */
+    uint64 rewindPeriodNs;
+
+    /**
+     * The next cycle of the file to be replayed.
+     */
+    uint64 cycle;
+
+    /**
+     * The CLOCK_MONOTONIC time (in nanoseconds) of the deadline 0 of the current pass over the file.
+     */
+    uint64 originNs;
+
+    /**
+     * True if the timeline is to be rebased on the next Synchronise.
+     */
+    bool rebase;
+
+    /**
+     * The number of cycles replayed.
+     */
+    uint64 numberOfCycles;
+
+    /**
+     * The number of late cycles.
+     */
+    uint32 overruns;
+
+    /**
+     * The maximum lateness in nanoseconds.
+     */
+    uint32 maxLateness;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FILEDATASOURCE_REPLAYTIMER_H_ */
@@ -46,10 +46,17 @@ namespace MARTe {
 LinkDataSource::LinkDataSource() :
         MemoryDataSourceI() {
     isWriter = 0u;
+    zeroCopy = 0u;
+    heldBuffer = -1;
 }
 
 LinkDataSource::~LinkDataSource() {
-
+    if (heldBuffer >= 0) {
+        if (link.IsValid()) {
+            link->ReleaseRead(static_cast<uint32>(heldBuffer));
+        }
+        heldBuffer = -1;
+    }
 }
 
 bool LinkDataSource::Initialise(StructuredDataI &data) {
@@ -66,6 +73,15 @@ bool LinkDataSource::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Please specify IsWriter");
         }
     }
+    if (ret) {
+        if (!data.Read("ZeroCopy", zeroCopy)) {
+            zeroCopy = 0u;
+        }
+        ret = ((zeroCopy == 0u) || (isWriter == 0u));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "ZeroCopy is only supported by readers (IsWriter = 0)");
+        }
+    }
     if (ret) {
 
         link = ObjectRegistryDatabase::Instance()->Find(linkPath.Buffer());
@@ -109,6 +125,19 @@ bool LinkDataSource::Synchronise() {
             REPORT_ERROR(ErrorManagement::Warning, "Failed MemoryWrite(*): probably all the buffers are busy");
         }
     }
+    else if (zeroCopy > 0u) {
+        uint32 bufferIdx = 0u;
+        ret = link->AcquireRead(bufferIdx);
+        if (ret) {
+            if (heldBuffer >= 0) {
+                link->ReleaseRead(static_cast<uint32>(heldBuffer));
+            }
+            heldBuffer = static_cast<int32>(bufferIdx);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::Warning, "Failed AcquireRead(*): probably all the buffers are busy. Keeping the previous buffer");
+        }
+    }
     else {
         ret = link->MemoryRead(memory);
         if (!ret) {
@@ -118,6 +147,42 @@ bool LinkDataSource::Synchronise() {
     return true;
 }
 
+bool LinkDataSource::GetSignalMemoryBuffer(const uint32 signalIdx,
+                                           const uint32 bufferIdx,
+                                           void *&signalAddress) {
+    bool ret = MemoryDataSourceI::GetSignalMemoryBuffer(signalIdx, bufferIdx, signalAddress);
+    if ((ret) && (zeroCopy > 0u)) {
+        uint8 *gateMemory = link->GetMemory();
+        ret = (gateMemory != NULL_PTR(uint8 *));
+        if (ret) {
+            //Same layout as the memory which is exchanged in copy mode
+            /*lint -e{9016} -e{946} -e{947} pointer arithmetic required to translate the address to the MemoryGate buffer.*/
+            signalAddress = &gateMemory[reinterpret_cast<uint8 *>(signalAddress) - memory];
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::FatalError, "The MemoryGate memory was not allocated");
+        }
+    }
+    return ret;
+}
+
+bool LinkDataSource::GetInputOffset(const uint32 signalIdx,
+                                    const uint32 numberOfSamples,
+                                    uint32 &offset) {
+    bool ret;
+    if (zeroCopy > 0u) {
+        //The whole MemoryGate buffer is held, whatever the signal
+        ret = (heldBuffer >= 0);
+        if (ret) {
+            offset = (static_cast<uint32>(heldBuffer) * totalMemorySize);
+        }
+    }
+    else {
+        ret = MemoryDataSourceI::GetInputOffset(signalIdx, numberOfSamples, offset);
+    }
+    return ret;
+}
+
 /*lint -e{715} currentStateName and nextStateName are not referenced*/
 bool LinkDataSource::PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName) {
     return true;
@@ -49,12 +49,19 @@ namespace MARTe {
  * "IsWriter" that defines if this data source has to write or reads its signals memory from/to the linked
  * MemoryGate within the Synchronise() function.
  *
+ * @details If a reader sets "ZeroCopy", the Synchronise() function does not copy the MemoryGate buffer: it acquires the
+ * newest buffer of the MemoryGate (MemoryGate::AcquireRead), holds it until the next Synchronise() and the brokers copy the
+ * signals directly from it (see GetSignalMemoryBuffer and GetInputOffset). A new buffer is acquired before the previous one
+ * is released, so that each zero-copy reader shall be counted twice in the MemoryGate NumberOfReaders.
+ * If no buffer can be acquired the previous one is kept.
+ *
  * @details Follows an example of configuration.
  * <pre>
  *  +InputDataSource1 = {
  *      Class = LinkDataSource
  *      Link = ExternalComponent1
  *      IsWriter = 0
+ *      ZeroCopy = 1 //Optional. Default = 0. Only allowed if IsWriter = 0.
  *  }
  *  </pre>
  */
@@ -86,17 +93,37 @@ LinkDataSource    ();
      * @details The following configuration variables shall be defined:
      *   Link = "the link of the MemoryGate component"
      *   IsWriter = [0-1] specifies if the signals memory must be written or read in the Synchronise() function.
+     * The following configuration variables are optional:
+     *   ZeroCopy = [0-1] if 1 the brokers read directly from the MemoryGate buffers (only for readers).
      * @return true if all the configuration parameters are correctly defined.
      */
     virtual bool Initialise(StructuredDataI &data);
 
     /**
      * @see DataSourceI::Synchronise.
-     * @details If IsWriter==1 calls MemoryGate::MwmoryWrite() otherwise it calls MemoryGate::MemoryRead.
+     * @details If IsWriter==1 calls MemoryGate::MwmoryWrite() otherwise it calls MemoryGate::MemoryRead. In ZeroCopy mode
+     * acquires the newest MemoryGate buffer and releases the one acquired in the previous call.
      * @return true.
      */
     virtual bool Synchronise();
 
+    /**
+     * @see MemoryDataSourceI::GetSignalMemoryBuffer
+     * @details In ZeroCopy mode returns the address of the signal in the first buffer of the MemoryGate.
+     */
+    virtual bool GetSignalMemoryBuffer(const uint32 signalIdx,
+            const uint32 bufferIdx,
+            void *&signalAddress);
+
+    /**
+     * @see DataSourceI::GetInputOffset
+     * @details In ZeroCopy mode returns the offset of the MemoryGate buffer acquired in the last Synchronise().
+     * @return false if in ZeroCopy mode no buffer was acquired yet.
+     */
+    virtual bool GetInputOffset(const uint32 signalIdx,
+            const uint32 numberOfSamples,
+            uint32 &offset);
+
     /**
      * @brief Returns true.
      */
@@ -127,6 +154,16 @@ protected:
      */
     uint8 isWriter;
 
+    /**
+     * Denotes if the brokers read directly from the MemoryGate buffers.
+     */
+    uint8 zeroCopy;
+
+    /**
+     * The MemoryGate buffer held in ZeroCopy mode (-1 if none).
+     */
+    int32 heldBuffer;
+
 };
 }
 
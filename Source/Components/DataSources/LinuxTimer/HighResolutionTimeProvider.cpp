@@ -24,6 +24,8 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <time.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -38,6 +40,18 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace {
+/**
+ * Default spin margin of the Deadline sleep nature in microseconds.
+ */
+const MARTe::uint32 defaultSpinMarginUs = 50u;
+
+/**
+ * Number of nanoseconds in one second.
+ */
+const MARTe::uint64 nanosecondsInSecond = 1000000000u;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -47,6 +61,9 @@ namespace MARTe {
 HighResolutionTimeProvider::HighResolutionTimeProvider() :
         TimeProvider() {
     yieldSleepPercentage = 0u;
+    spinMarginTicks = 0u;
+    adaptiveSpinMargin = true;
+    wakeUpLatencyTicks = 0u;
     SleepProvidingFunction = &HighResolutionTimeProvider::NullDelegate;
 }
 
@@ -107,6 +124,59 @@ bool HighResolutionTimeProvider::NoMore(const uint64 start,
     return true;
 }
 
+bool HighResolutionTimeProvider::DeadlineSleep(const uint64 start,
+                                               const uint64 delta) {
+    const uint64 deadline = start + delta;
+    uint64 now = HighResolutionTimer::Counter();
+    if ((now < deadline) && ((deadline - now) > spinMarginTicks)) {
+        const uint64 wakeUpTicks = deadline - spinMarginTicks;
+        struct timespec wakeUpTime;
+        bool ok = (clock_gettime(CLOCK_MONOTONIC, &wakeUpTime) == 0);
+        //The ticks are measured after the CLOCK_MONOTONIC so that the wake-up time is not later than wakeUpTicks
+        now = HighResolutionTimer::Counter();
+        if ((ok) && (now < wakeUpTicks)) {
+            float64 sleepNsF = static_cast<float64>(wakeUpTicks - now) * Period() * static_cast<float64>(nanosecondsInSecond);
+            uint64 sleepNs = static_cast<uint64>(sleepNsF) + static_cast<uint64>(wakeUpTime.tv_nsec);
+            wakeUpTime.tv_sec += static_cast<time_t>(sleepNs / nanosecondsInSecond);
+            wakeUpTime.tv_nsec = static_cast<long>(sleepNs % nanosecondsInSecond);
+            int32 err;
+            do {
+                err = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeUpTime, NULL_PTR(struct timespec *));
+            }
+            while (err == EINTR);
+            if (adaptiveSpinMargin) {
+                now = HighResolutionTimer::Counter();
+                uint64 latency = (now > wakeUpTicks) ? (now - wakeUpTicks) : 0u;
+                if (latency > wakeUpLatencyTicks) {
+                    wakeUpLatencyTicks = latency;
+                }
+                else {
+                    wakeUpLatencyTicks -= ((wakeUpLatencyTicks - latency) >> 6u);
+                }
+                spinMarginTicks = wakeUpLatencyTicks + (wakeUpLatencyTicks >> 1u);
+            }
+        }
+    }
+    else if ((now < deadline) && (adaptiveSpinMargin)) {
+        //No wake-up latency can be measured: let the estimate decay so that a single late wake-up does not disable the sleeping
+        wakeUpLatencyTicks -= (wakeUpLatencyTicks >> 6u);
+        spinMarginTicks = wakeUpLatencyTicks + (wakeUpLatencyTicks >> 1u);
+    }
+    else {
+        //NOOP
+    }
+    while (HighResolutionTimer::Counter() < deadline) {
+        ;
+    }
+    //As long the HRT is based on the internals, there should be no way of failing
+    return true;
+}
+
+uint32 HighResolutionTimeProvider::GetSpinMargin() {
+    float64 spinMarginUs = (static_cast<float64>(spinMarginTicks) * Period()) * 1e6;
+    return static_cast<uint32>(spinMarginUs + 0.5);
+}
+
 bool HighResolutionTimeProvider::Sleep(const uint64 start,
                                        const uint64 delta) {
     return (this->*SleepProvidingFunction)(start, delta);
@@ -148,6 +218,25 @@ bool HighResolutionTimeProvider::InnerInitialize(StructuredDataI &data) {
                 REPORT_ERROR(ErrorManagement::Information, "BusySleep delegate selected");
             }
         }
+        else if (tempSleepNature == "Deadline") {
+            uint32 spinMarginUs = defaultSpinMarginUs;
+            if (!data.Read("SpinMargin", spinMarginUs)) {
+                spinMarginUs = defaultSpinMarginUs;
+            }
+            uint8 adaptive = 1u;
+            if (!data.Read("AdaptiveSpinMargin", adaptive)) {
+                adaptive = 1u;
+            }
+            adaptiveSpinMargin = (adaptive == 1u);
+            float64 spinMarginTicksF = (static_cast<float64>(spinMarginUs) * static_cast<float64>(Frequency())) / 1e6;
+            spinMarginTicks = static_cast<uint64>(spinMarginTicksF);
+            //The self-tuned margin is 1.5 times the latency estimate
+            wakeUpLatencyTicks = (spinMarginTicks * 2u) / 3u;
+            SleepProvidingFunction = &HighResolutionTimeProvider::DeadlineSleep;
+            REPORT_ERROR(ErrorManagement::Information, "Deadline sleep nature selected with a %s spin margin of %d us", adaptiveSpinMargin ? "self-tuned" : "fixed",
+                         spinMarginUs);
+            REPORT_ERROR(ErrorManagement::Information, "DeadlineSleep delegate selected");
+        }
         else if (tempSleepNature == "Default") {
             SleepProvidingFunction = &HighResolutionTimeProvider::NoMore;
             REPORT_ERROR(ErrorManagement::Information, "Default sleep nature selected (Sleep::NoMore mode)");
@@ -42,6 +42,26 @@ namespace MARTe {
  * @brief Default plugin which provides time to the LinuxTimer DataSource.
  Relies on underlying HighResolutionTimer Counter() / Period() and Frequency
  primitives and implements the sleep as a busy spin based on them.
+ *
+ * @details The sleep strategy is selected with the SleepNature parameter:
+ *  - Default: Sleep::NoMore of the remaining time.
+ *  - Busy: busy spin of the remaining time or, if SleepPercentage is set, Sleep::SemiBusy (the SleepPercentage of the period is
+ *    spent in the OS sleep).
+ *  - Deadline: clock_nanosleep (CLOCK_MONOTONIC, TIMER_ABSTIME) until SpinMargin microseconds before the absolute deadline of the cycle and
+ *    busy spin of the remaining time. The absolute sleep does not accumulate the drift of the relative sleeps and the spin absorbs the
+ *    wake-up latency of the OS, so that most of the period is given back to the OS with the jitter of a busy spin (as long as the
+ *    wake-up latency is lower than SpinMargin). If AdaptiveSpinMargin = 1 (default) the SpinMargin is the initial value of a margin which
+ *    is self-tuned, after every sleep, to 1.5 times the maximum of the recent wake-up latencies (the maximum decays by 1/64 of
+ *    its difference with the last latency in each cycle).
+ *
+ * <pre>
+ * +TimeProvider = {
+ *     Class = HighResolutionTimeProvider
+ *     SleepNature = Deadline
+ *     SpinMargin = 50 //Optional. Only meaningful if SleepNature = Deadline. In microseconds. Default = 50.
+ *     AdaptiveSpinMargin = 1 //Optional. Only meaningful if SleepNature = Deadline. Default = 1.
+ * }
+ * </pre>
  */
 class HighResolutionTimeProvider: public TimeProvider {
 public:
@@ -98,12 +118,33 @@ public:
      */
     virtual bool BackwardCompatibilityInit(StructuredDataI &compatibilityData);
 
+    /**
+     * @brief Gets the current spin margin of the Deadline sleep nature.
+     * @return the current spin margin in microseconds.
+     */
+    uint32 GetSpinMargin();
+
 private:
     /**
      * @brief Holds the percentage to sleep by yielding the cpu
      */
     uint8 yieldSleepPercentage;
 
+    /**
+     * @brief The ticks before the deadline where the Deadline sleep stops sleeping and starts spinning
+     */
+    uint64 spinMarginTicks;
+
+    /**
+     * @brief True if the spin margin is self-tuned from the measured wake-up latencies
+     */
+    bool adaptiveSpinMargin;
+
+    /**
+     * @brief The (decaying) maximum of the recent wake-up latencies in ticks
+     */
+    uint64 wakeUpLatencyTicks;
+
     /**
      * @brief Pointer to the specific sleep strategy implementation
      */
@@ -128,6 +169,12 @@ private:
     bool NoMore(const uint64 start,
                 const uint64 delta);
 
+    /**
+     * @brief Sleeps with clock_nanosleep until SpinMargin before start + delta and busy spins the remaining time
+     */
+    bool DeadlineSleep(const uint64 start,
+                       const uint64 delta);
+
     /**
      * @brief Null delegate as dummy for initial configuration, to avoid erratic default behaviour.
      * Essentially it does nothing, only fails.
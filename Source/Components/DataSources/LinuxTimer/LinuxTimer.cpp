@@ -26,11 +26,16 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "CLASSMETHODREGISTER.h"
 #include "HighResolutionTimeProvider.h"
 #include "LinuxTimer.h"
 #include "MemoryMapSynchronisedInputBroker.h"
@@ -55,6 +60,11 @@ const uint32 LINUX_TIMER_EXEC_MODE_SPAWNED = 2u;
  * @brief Maximum phase of the signal (default)
  */
 const uint32 USEC_IN_SEC = 1000000u;
+
+/**
+ * @brief Default width of the bins of the latency histogram in nanoseconds.
+ */
+const uint32 LINUX_TIMER_DEFAULT_BIN_WIDTH = 1000u;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -64,6 +74,7 @@ namespace MARTe {
 LinuxTimer::LinuxTimer() :
         DataSourceI(),
         EmbeddedServiceMethodBinderI(),
+        MessageI(),
         executor(*this) {
     startTimeTicks = 0u;
     sleepTimeTicks[0] = 0u;
@@ -84,10 +95,41 @@ LinuxTimer::LinuxTimer() :
     phase = 0u;
     phaseBackup = phase;
     trigRephase = 0u;
+    lateness = 0u;
+    overruns = 0u;
+    missedCycles = 0u;
+    maxLateness = 0u;
+    numberOfCycles = 0u;
+    nsPerTick = 0.;
+    latencyHistogram = NULL_PTR(uint32 *);
+    latencyHistogramBins = 0u;
+    latencyHistogramBinWidth = LINUX_TIMER_DEFAULT_BIN_WIDTH;
+    dumpTelemetry = false;
+    resetPending = 0;
+    masterDivider = 1u;
+    masterPhase = 0u;
+    for (uint32 i = 0u; i < LINUX_TIMER_MAX_SLAVES; i++) {
+        slaves[i] = NULL_PTR(LinuxTimer *);
+    }
+    numberOfSlaves = 0u;
+    masterCycles = 0u;
+    slaveSequence = 0;
+    lastSlaveSequence = 0;
+    slaveDeadlineTicks = 0u;
+    slavePeriodUsecTime = 0u;
+    if (!slavesMux.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create FastPollingMutexSem.");
+    }
 
     if (!synchSem.Create()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem.");
     }
+    filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
+    if (!ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
+    }
 }
 
 /*lint -e{1551} the destructor must guarantee that the Timer SingleThreadService is stopped.*/
@@ -100,6 +142,23 @@ LinuxTimer::~LinuxTimer() {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
         }
     }
+    if (latencyHistogram != NULL_PTR(uint32 *)) {
+        delete[] latencyHistogram;
+    }
+    if (master.IsValid()) {
+        master->UnregisterSlave(this);
+    }
+    //Release any slave which is still waiting
+    if (slavesMux.FastLock() == ErrorManagement::NoError) {
+        for (uint32 i = 0u; i < numberOfSlaves; i++) {
+            /*lint -e{613} slaves[i] cannot be NULL for i < numberOfSlaves*/
+            (void) __sync_fetch_and_add(&slaves[i]->slaveSequence, 1);
+            /*lint -e{613} slaves[i] cannot be NULL for i < numberOfSlaves*/
+            (void) syscall(SYS_futex, &slaves[i]->slaveSequence, FUTEX_WAKE_PRIVATE, INT_MAX, NULL_PTR(void *), NULL_PTR(void *), 0);
+        }
+        numberOfSlaves = 0u;
+        slavesMux.FastUnLock();
+    }
 }
 
 bool LinuxTimer::AllocateMemory() {
@@ -149,6 +208,17 @@ bool LinuxTimer::Initialise(StructuredDataI &data) {
                     ok = slaveCDB.Write("SleepPercentage", sleepPercentage);
                 }
             }
+            else if (sleepNatureStr == "Deadline") {
+                sleepNature = Deadline;
+                uint32 spinMargin = 0u;
+                if (data.Read("SpinMargin", spinMargin)) {
+                    ok = slaveCDB.Write("SpinMargin", spinMargin);
+                }
+                uint8 adaptiveSpinMargin = 0u;
+                if ((ok) && (data.Read("AdaptiveSpinMargin", adaptiveSpinMargin))) {
+                    ok = slaveCDB.Write("AdaptiveSpinMargin", adaptiveSpinMargin);
+                }
+            }
             else {
                 REPORT_ERROR(ErrorManagement::ParametersError, "Unsupported SleepNature.");
                 ok = false;
@@ -185,24 +255,83 @@ bool LinuxTimer::Initialise(StructuredDataI &data) {
                 }
                 cpuMask = ProcessorType(cpuMaskIn);
 
+                ok = placement.Initialise(data);
+                if ((ok) && (placement.HasCPUMask())) {
+                    cpuMask = placement.GetCPUMask();
+                }
+
                 if (!data.Read("StackSize", stackSize)) {
                     stackSize = THREADS_DEFAULT_STACKSIZE;
                     REPORT_ERROR(ErrorManagement::Warning, "StackSize not specified using: %d", stackSize);
                 }
 
-                ok = (stackSize > 0u);
-
-                if (!ok) {
-                    REPORT_ERROR(ErrorManagement::ParametersError, "StackSize shall be > 0u");
+                if (ok) {
+                    ok = (stackSize > 0u);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "StackSize shall be > 0u");
+                    }
                 }
 
                 if (ok) {
                     executor.SetCPUMask(cpuMask);
+                    placement.Apply(executor);
                     executor.SetStackSize(stackSize);
                 }
             }
         }
 
+        if (ok) {
+            if (!data.Read("LatencyHistogramBins", latencyHistogramBins)) {
+                latencyHistogramBins = 0u;
+            }
+            if (!data.Read("LatencyHistogramBinWidth", latencyHistogramBinWidth)) {
+                latencyHistogramBinWidth = LINUX_TIMER_DEFAULT_BIN_WIDTH;
+            }
+            ok = (latencyHistogramBinWidth > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "LatencyHistogramBinWidth shall be > 0u");
+            }
+            uint8 dumpTelemetryIn = 0u;
+            if (!data.Read("DumpTelemetry", dumpTelemetryIn)) {
+                dumpTelemetryIn = 0u;
+            }
+            dumpTelemetry = (dumpTelemetryIn == 1u);
+        }
+
+        if (ok) {
+            if (data.Read("Master", masterPath)) {
+                if (!data.Read("MasterDivider", masterDivider)) {
+                    masterDivider = 1u;
+                }
+                if (!data.Read("MasterPhase", masterPhase)) {
+                    masterPhase = 0u;
+                }
+                ok = (masterDivider > 0u);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "MasterDivider shall be > 0u");
+                }
+                if (ok) {
+                    ok = (masterPhase < masterDivider);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "MasterPhase shall be < MasterDivider");
+                    }
+                }
+                if (ok) {
+                    REPORT_ERROR(ErrorManagement::Information, "Slave of %s firing every %d master cycles with a phase of %d cycles", masterPath.Buffer(),
+                                 masterDivider, masterPhase);
+                }
+            }
+        }
+
+        if (ok) {
+            if (latencyHistogramBins > 0u) {
+                latencyHistogram = new uint32[latencyHistogramBins];
+                for (uint32 i = 0u; i < latencyHistogramBins; i++) {
+                    latencyHistogram[i] = 0u;
+                }
+            }
+        }
+
         if (ok) {
             ok = (Size() < 2u);
             if (!ok) {
@@ -268,6 +397,7 @@ bool LinuxTimer::Initialise(StructuredDataI &data) {
 
         if (ok) {
             ticksPerUs = (static_cast<float64>(timeProvider->Frequency()) / 1.0e6);
+            nsPerTick = (timeProvider->Period() * 1.0e9);
         }
     }
     else {
@@ -282,10 +412,10 @@ bool LinuxTimer::SetConfiguredDatabase(StructuredDataI &data) {
     uint32 tempNumOfSignals = GetNumberOfSignals();
 
     if (ok) {
-        ok = (tempNumOfSignals >= 2u) && (tempNumOfSignals <= 5u);
+        ok = (tempNumOfSignals >= 2u) && (tempNumOfSignals <= 9u);
     }
     if (!ok) {
-        REPORT_ERROR(ErrorManagement::ParametersError, "Number of signal must be between 2 and 5");
+        REPORT_ERROR(ErrorManagement::ParametersError, "Number of signal must be between 2 and 9");
     }
     if (ok) {
         ok = (GetSignalType(0u).numberOfBits == 32u);
@@ -344,6 +474,14 @@ bool LinuxTimer::SetConfiguredDatabase(StructuredDataI &data) {
         }
     }
 
+    for (uint32 i = 5u; (i < tempNumOfSignals) && (ok); i++) {
+        uint16 tempNumOfBits = GetSignalType(i).numberOfBits;
+        ok = ((GetSignalType(i).type == UnsignedInteger) && (tempNumOfBits == 32u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The telemetry signal %d must be a 32 bit unsigned integer", i);
+        }
+    }
+
     if (ok) {
         ReferenceContainer result;
         ReferenceContainerFilterReferences filter(1, ReferenceContainerFilterMode::PATH, this);
@@ -352,6 +490,35 @@ bool LinuxTimer::SetConfiguredDatabase(StructuredDataI &data) {
         ok = rtApp.IsValid();
     }
 
+    if ((ok) && (masterPath.Size() > 0u)) {
+        master = ObjectRegistryDatabase::Instance()->Find(masterPath.Buffer());
+        ok = master.IsValid();
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The Master %s is not a LinuxTimer", masterPath.Buffer());
+        }
+        if (ok) {
+            ok = (master.operator->() != this) && (master->masterPath.Size() == 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The Master %s shall not be a slave", masterPath.Buffer());
+            }
+        }
+        if (ok) {
+            ok = master->RegisterSlave(this);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The Master %s already has %d slaves", masterPath.Buffer(), LINUX_TIMER_MAX_SLAVES);
+            }
+        }
+        if (ok) {
+            //The slave time is measured with the time provider of the master
+            timeProvider = master->timeProvider;
+            ticksPerUs = master->ticksPerUs;
+            nsPerTick = master->nsPerTick;
+        }
+        else {
+            master = Reference();
+        }
+    }
+
     return ok;
 }
 
@@ -379,6 +546,18 @@ bool LinuxTimer::GetSignalMemoryBuffer(const uint32 signalIdx,
     else if (signalIdx == 4u) {
         signalAddress = &trigRephase;
     }
+    else if (signalIdx == 5u) {
+        signalAddress = &lateness;
+    }
+    else if (signalIdx == 6u) {
+        signalAddress = &overruns;
+    }
+    else if (signalIdx == 7u) {
+        signalAddress = &missedCycles;
+    }
+    else if (signalIdx == 8u) {
+        signalAddress = &maxLateness;
+    }
     else {
         ok = false;
     }
@@ -412,7 +591,10 @@ const char8* LinuxTimer::GetBrokerName(StructuredDataI &data,
 
 bool LinuxTimer::Synchronise() {
     ErrorManagement::ErrorType err;
-    if (executionMode == LINUX_TIMER_EXEC_MODE_SPAWNED) {
+    if (master.IsValid()) {
+        err = WaitMaster();
+    }
+    else if (executionMode == LINUX_TIMER_EXEC_MODE_SPAWNED) {
         err = synchSem.ResetWait(TTInfiniteWait);
     }
     else {
@@ -433,6 +615,11 @@ bool LinuxTimer::PrepareNextState(const char8 *const currentStateName,
     nextIndex++;
     nextIndex &= 0x1u;
 
+    if ((dumpTelemetry) && (numberOfCycles > 0u)) {
+        (void) PrintTelemetry();
+    }
+    resetPending = 1;
+
     bool notConsumedNow = true;
     bool notConsumedLater = true;
     for (uint32 idx = 0u; (idx < numberOfSignals) && ok; idx++) {
@@ -495,6 +682,8 @@ bool LinuxTimer::PrepareNextState(const char8 *const currentStateName,
 
             startTimeTicks = 0u;
             phase = phaseBackup;
+            masterCycles = 0u;
+            lastSlaveSequence = slaveSequence;
         }
         if (!notConsumedLater) {
             ok = (tempFrequency >= 0.F);
@@ -513,7 +702,8 @@ bool LinuxTimer::PrepareNextState(const char8 *const currentStateName,
                     sleepTimeTicks[currentIndex] = static_cast<uint64>(sleepTimeT);
                 }
 
-                if (executionMode == LINUX_TIMER_EXEC_MODE_SPAWNED) {
+                //A slave is woken by the master thread
+                if ((executionMode == LINUX_TIMER_EXEC_MODE_SPAWNED) && (!master.IsValid())) {
                     if (executor.GetStatus() == EmbeddedThreadI::OffState) {
                         ok = executor.Start();
                     }
@@ -607,6 +797,8 @@ ErrorManagement::ErrorType LinuxTimer::Execute(ExecutionInfo &info) {
         uint64 microsecs = static_cast<uint64>(seconds) * static_cast<uint64>(USEC_IN_SEC);
         deltaTime = (microsecs - absoluteTime_1);
         absoluteTime_1 = microsecs;
+        UpdateTelemetry(startTimeTicks, newCounter, nCycles);
+        FireSlaves(nCycles);
     }
 
     if (executionMode == LINUX_TIMER_EXEC_MODE_SPAWNED) {
@@ -628,6 +820,210 @@ uint32 LinuxTimer::GetSleepPercentage() const {
     return sleepPercentage;
 }
 
+void LinuxTimer::UpdateTelemetry(const uint64 deadlineTicks,
+                                 const uint64 wakeUpTicks,
+                                 const uint32 nCycles) {
+    if (resetPending != 0) {
+        overruns = 0u;
+        missedCycles = 0u;
+        maxLateness = 0u;
+        numberOfCycles = 0u;
+        for (uint32 i = 0u; i < latencyHistogramBins; i++) {
+            /*lint -e{613} latencyHistogram cannot be NULL if latencyHistogramBins > 0*/
+            latencyHistogram[i] = 0u;
+        }
+        resetPending = 0;
+    }
+    uint64 latenessTicks = (wakeUpTicks > deadlineTicks) ? (wakeUpTicks - deadlineTicks) : 0u;
+    float64 latenessNs = static_cast<float64>(latenessTicks) * nsPerTick;
+    lateness = (latenessNs < 4294967295.0) ? static_cast<uint32>(latenessNs) : 0xFFFFFFFFu;
+    if (lateness > maxLateness) {
+        maxLateness = lateness;
+    }
+    //nCycles is 1 in a cycle which starts before its deadline
+    if (nCycles > 1u) {
+        overruns++;
+        missedCycles += (nCycles - 1u);
+    }
+    numberOfCycles++;
+    if (latencyHistogramBins > 0u) {
+        uint32 binIdx = lateness / latencyHistogramBinWidth;
+        if (binIdx >= latencyHistogramBins) {
+            binIdx = (latencyHistogramBins - 1u);
+        }
+        /*lint -e{613} latencyHistogram cannot be NULL if latencyHistogramBins > 0*/
+        latencyHistogram[binIdx]++;
+    }
+}
+
+bool LinuxTimer::RegisterSlave(LinuxTimer * const slave) {
+    bool ok = (slavesMux.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        bool found = false;
+        for (uint32 i = 0u; (i < numberOfSlaves) && (!found); i++) {
+            found = (slaves[i] == slave);
+        }
+        if (!found) {
+            ok = (numberOfSlaves < LINUX_TIMER_MAX_SLAVES);
+            if (ok) {
+                slaves[numberOfSlaves] = slave;
+                numberOfSlaves++;
+            }
+        }
+        slavesMux.FastUnLock();
+    }
+    return ok;
+}
+
+void LinuxTimer::UnregisterSlave(const LinuxTimer * const slave) {
+    if (slavesMux.FastLock() == ErrorManagement::NoError) {
+        bool found = false;
+        for (uint32 i = 0u; i < numberOfSlaves; i++) {
+            if (slaves[i] == slave) {
+                found = true;
+            }
+            if ((found) && ((i + 1u) < numberOfSlaves)) {
+                slaves[i] = slaves[i + 1u];
+            }
+        }
+        if (found) {
+            numberOfSlaves--;
+            slaves[numberOfSlaves] = NULL_PTR(LinuxTimer *);
+        }
+        slavesMux.FastUnLock();
+    }
+}
+
+uint32 LinuxTimer::GetNumberOfSlaves() {
+    uint32 n = 0u;
+    if (slavesMux.FastLock() == ErrorManagement::NoError) {
+        n = numberOfSlaves;
+        slavesMux.FastUnLock();
+    }
+    return n;
+}
+
+void LinuxTimer::FireSlaves(const uint32 nCycles) {
+    uint64 previousCycles = masterCycles;
+    masterCycles += nCycles;
+    if (numberOfSlaves > 0u) {
+        if (slavesMux.FastLock() == ErrorManagement::NoError) {
+            uint32 masterPeriodUsecTime = timerPeriodUsecTime[rtApp->GetIndex()];
+            for (uint32 i = 0u; i < numberOfSlaves; i++) {
+                LinuxTimer *slave = slaves[i];
+                //Number of master cycles c, in ]previousCycles, masterCycles], where c % MasterDivider == MasterPhase (counting from 1)
+                uint64 divider = static_cast<uint64>(slave->masterDivider);
+                uint64 phase = static_cast<uint64>(slave->masterPhase) + 1u;
+                uint64 firedBefore = (previousCycles >= phase) ? (((previousCycles - phase) / divider) + 1u) : 0u;
+                uint64 firedNow = (masterCycles >= phase) ? (((masterCycles - phase) / divider) + 1u) : 0u;
+                if (firedNow > firedBefore) {
+                    slave->slaveDeadlineTicks = startTimeTicks;
+                    slave->slavePeriodUsecTime = masterPeriodUsecTime * slave->masterDivider;
+                    //The full barrier of the atomic add publishes the deadline and the period before the new sequence
+                    (void) __sync_fetch_and_add(&slave->slaveSequence, static_cast<int32>(firedNow - firedBefore));
+                    (void) syscall(SYS_futex, &slave->slaveSequence, FUTEX_WAKE_PRIVATE, INT_MAX, NULL_PTR(void *), NULL_PTR(void *), 0);
+                }
+            }
+            slavesMux.FastUnLock();
+        }
+    }
+}
+
+bool LinuxTimer::WaitMaster() {
+    int32 sequence = slaveSequence;
+    while (sequence == lastSlaveSequence) {
+        //Returns immediately (EAGAIN) if the master incremented the sequence after it was read
+        (void) syscall(SYS_futex, &slaveSequence, FUTEX_WAIT_PRIVATE, lastSlaveSequence, NULL_PTR(void *), NULL_PTR(void *), 0);
+        sequence = slaveSequence;
+    }
+    __sync_synchronize();
+    uint32 nCycles = static_cast<uint32>(sequence - lastSlaveSequence);
+    lastSlaveSequence = sequence;
+    uint64 deadlineTicks = slaveDeadlineTicks;
+    uint64 wakeUpTicks = timeProvider->Counter();
+    counterAndTimer[0] += nCycles;
+    counterAndTimer[1] = counterAndTimer[0] * slavePeriodUsecTime;
+    uint64 previousAbsoluteTime = absoluteTime;
+    absoluteTime = static_cast<uint64>(deadlineTicks) / static_cast<uint64>(ticksPerUs);
+    deltaTime = absoluteTime - previousAbsoluteTime;
+    UpdateTelemetry(deadlineTicks, wakeUpTicks, nCycles);
+    return true;
+}
+
+uint32 LinuxTimer::GetLatencyHistogramBins() const {
+    return latencyHistogramBins;
+}
+
+uint32 LinuxTimer::GetLatencyHistogramCount(const uint32 binIdx) const {
+    uint32 count = 0u;
+    if (binIdx < latencyHistogramBins) {
+        /*lint -e{613} latencyHistogram cannot be NULL if latencyHistogramBins > 0*/
+        count = latencyHistogram[binIdx];
+    }
+    return count;
+}
+
+/*lint -e{1762} function cannot be constant as it is registered as an RPC for CLASS_METHOD_REGISTER*/
+ErrorManagement::ErrorType LinuxTimer::PrintTelemetry() {
+    REPORT_ERROR(ErrorManagement::Information, "%u cycles, %u overruns, %u missed cycles, maximum lateness = %u ns", numberOfCycles, overruns, missedCycles,
+                 maxLateness);
+    for (uint32 i = 0u; i < latencyHistogramBins; i++) {
+        /*lint -e{613} latencyHistogram cannot be NULL if latencyHistogramBins > 0*/
+        if (latencyHistogram[i] > 0u) {
+            uint32 binStart = i * latencyHistogramBinWidth;
+            if ((i + 1u) < latencyHistogramBins) {
+                REPORT_ERROR(ErrorManagement::Information, "Lateness [%u, %u[ ns: %u cycles", binStart, binStart + latencyHistogramBinWidth, latencyHistogram[i]);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::Information, "Lateness >= %u ns: %u cycles", binStart, latencyHistogram[i]);
+            }
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+ErrorManagement::ErrorType LinuxTimer::GetTelemetry(ReferenceContainer &message) {
+    ErrorManagement::ErrorType ret = ErrorManagement::NoError;
+    bool ok = (message.Size() == 1u);
+    ReferenceT<StructuredDataI> data = message.Get(0u);
+    if (ok) {
+        ok = data.IsValid();
+    }
+    if (!ok) {
+        ret = ErrorManagement::ParametersError;
+        REPORT_ERROR(ret, "Message does not contain a ReferenceT<StructuredDataI>");
+    }
+    else {
+        ok = data->Write("NumberOfCycles", numberOfCycles);
+        if (ok) {
+            ok = data->Write("Overruns", overruns);
+        }
+        if (ok) {
+            ok = data->Write("MissedCycles", missedCycles);
+        }
+        if (ok) {
+            ok = data->Write("MaxLateness", maxLateness);
+        }
+        if (ok) {
+            ok = data->Write("LatencyHistogramBinWidth", latencyHistogramBinWidth);
+        }
+        if ((ok) && (latencyHistogramBins > 0u)) {
+            Vector<uint32> latencyHistogramVector(latencyHistogram, latencyHistogramBins);
+            ok = data->Write("LatencyHistogram", latencyHistogramVector);
+        }
+        if (!ok) {
+            ret = ErrorManagement::ParametersError;
+            REPORT_ERROR(ret, "Could not write the telemetry");
+        }
+    }
+    return ret;
+}
+
+ErrorManagement::ErrorType LinuxTimer::ResetTelemetry() {
+    resetPending = 1;
+    return ErrorManagement::NoError;
+}
+
 void LinuxTimer::Purge(ReferenceContainer &purgeList) {
     if (rtApp.IsValid()) {
         rtApp->Purge(purgeList);
@@ -636,6 +1032,9 @@ void LinuxTimer::Purge(ReferenceContainer &purgeList) {
 }
 
 CLASS_REGISTER(LinuxTimer, "1.0")
+CLASS_METHOD_REGISTER(LinuxTimer, PrintTelemetry)
+CLASS_METHOD_REGISTER(LinuxTimer, GetTelemetry)
+CLASS_METHOD_REGISTER(LinuxTimer, ResetTelemetry)
 
 }
 
@@ -34,8 +34,12 @@
 #include "DataSourceI.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "EventSem.h"
+#include "FastPollingMutexSem.h"
+#include "MessageI.h"
 #include "RealTimeApplication.h"
+#include "RegisteredMethodsMessageFilter.h"
 #include "SingleThreadService.h"
+#include "ThreadPlacement.h"
 #include "TimeProvider.h"
 
 /*---------------------------------------------------------------------------*/
@@ -43,11 +47,16 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * @brief Maximum number of slaves of a master LinuxTimer.
+ */
+const uint32 LINUX_TIMER_MAX_SLAVES = 16u;
+
 /**
  * @brief A DataSource which provides a timing source for a MARTe application.
  * @details The LinuxTimer provides a timing generation facility where generators can be conveniently plugged in.
  * The LinuxTimer itself comes with a default provider which is based on internal HighResolutionTimer.
- * The Timer can be configured with two, three, four or five signals and it shall
+ * The Timer can be configured with two to nine signals and it shall
  * always have a frequency set in one of the signals.
  *
  * @details The default time provider (if no plugin is defined) is the HighResolutionTimeProvider. It relies on the implementation
@@ -63,12 +72,24 @@ namespace MARTe {
  * +Timer = {
  *     Class = LinuxTimer
  *     ExecutionMode = IndependentThread //Optional. If not set ExecutionMode = IndependentThread.
- *     SleepNature = Busy|Default//If SleepNature is not specified then Default is set
+ *     SleepNature = Busy|Default|Deadline//If SleepNature is not specified then Default is set
  *     SleepPercentage = 0 //Only meaningful if SleepNature = Busy. The percentage of time to sleep using the OS sleep.
+ *     SpinMargin = 50 //Only meaningful if SleepNature = Deadline. Microseconds of busy spin before the deadline.
+ *     AdaptiveSpinMargin = 1 //Only meaningful if SleepNature = Deadline. If 1 the SpinMargin is self-tuned.
  *     Phase = 1 //Optional, sets the phase of the timing generation, defaults to 0u
  *     CPUMask = 0x8 //Optional and only relevant if ExecutionMode=IndependentThread
+ *     ThreadPlacement = { //Optional and only relevant if ExecutionMode=IndependentThread. See ThreadPlacement. Overrides the CPUMask above and sets the priority of the timer thread.
+ *         PriorityClass = RealTimePriorityClass
+ *         PriorityLevel = 15
+ *     }
+ *     LatencyHistogramBins = 100 //Optional. Number of bins of the wake-up lateness histogram. Default = 0 (no histogram).
+ *     LatencyHistogramBinWidth = 1000 //Optional. Width of each bin of the histogram in nanoseconds. Default = 1000.
+ *     DumpTelemetry = 1 //Optional. If 1 the telemetry is printed (REPORT_ERROR Information) on every state change. Default = 0.
+ *     Master = App.Data.MasterTimer //Optional. Full path of the master LinuxTimer. If set this LinuxTimer is a slave (see below).
+ *     MasterDivider = 4 //Optional. Only meaningful if Master is set. The slave fires every MasterDivider cycles of the master. Default = 1.
+ *     MasterPhase = 1 //Optional. Only meaningful if Master is set. Offset in master cycles (< MasterDivider) of the slave cycles. Default = 0.
  *     +TimeProvider = { //Optional, if omitted defaults to HighResolutionTimeProvider
- *         //Can be any of the implementing types for the TimeProvider interface
+ *         //Can be any of the implementing types for the TimeProvider interface (e.g. HighResolutionTimeProvider or TscTimeProvider)
            //Please refer to the specific time provider interface for configuration details
  *         //Please refer to the TimeProvider.h header for implementation details
  *         Class = HighResolutionTimeProvider
@@ -89,7 +110,19 @@ namespace MARTe {
  *         }
  *         TrigRephase = { //Optional, can be omitted
  *             Type = uint8 //Only type supported
- *         }*
+ *         }
+ *         Lateness = { //Optional, can be omitted
+ *             Type = uint32 //Only type supported
+ *         }
+ *         Overruns = { //Optional, can be omitted
+ *             Type = uint32 //Only type supported
+ *         }
+ *         MissedCycles = { //Optional, can be omitted
+ *             Type = uint32 //Only type supported
+ *         }
+ *         MaxLateness = { //Optional, can be omitted
+ *             Type = uint32 //Only type supported
+ *         }
  *     }
  * }
  * </pre>
@@ -97,9 +130,11 @@ namespace MARTe {
  * @details ExecutionMode can be IndependentThread or RealTimeThread. In the first case a thread is spawned on the provided \a CPUMask and triggers the Synchronise() at every period.
  * If RealTimeThread, the time synchronisation is performed in the same thread scope.
  *
- * @details SleepNature can be Busy or Default. If SleepNature=Default the TimeProvider would not busy sleep.
+ * @details SleepNature can be Busy, Default or Deadline. If SleepNature=Default the TimeProvider would not busy sleep.
  * If SleepNature=Busy the SleepPercentage is 0 by default (if not specified) suggesting the TimeProvider to busy sleep.
  * If SleepPercentage is defined, the TimeProvider would sleep for the defined percentage of the period.
+ * If SleepNature=Deadline the TimeProvider would sleep until SpinMargin microseconds before the absolute deadline of the cycle and
+ * busy sleep the remaining time (see HighResolutionTimeProvider).
  * By the way remember that this configuration is just forwarded to the TimeProvider so the behavior depends by its implementation.
  *
  * @details Follows a description of the signals
@@ -108,11 +143,32 @@ namespace MARTe {
  *   - AbsoluteTime: uses TimeProvider::Counter and TimeProvider::Period to get an absolute time
  *   - DeltaTime: time difference between two cycles
  *   - TrigRephase: if equal to 1 rephases the time synchronisation when the Execute method is called.
+ *   - Lateness: time, in nanoseconds, between the deadline of the cycle and the instant when the sleep returned.
+ *   - Overruns: number of cycles which started after the deadline of the next cycle (i.e. at least one period was missed).
+ *   - MissedCycles: total number of periods which were missed.
+ *   - MaxLateness: maximum Lateness, in nanoseconds.
+ *
+ * @details The Overruns, MissedCycles, MaxLateness and the histogram of the Lateness (the last bin also counts all the larger values)
+ * are reset on every state change, after being printed if DumpTelemetry = 1. They can also be queried with the following registered methods:
+ *  - PrintTelemetry: prints (REPORT_ERROR Information) the telemetry.
+ *  - GetTelemetry: writes NumberOfCycles, Overruns, MissedCycles, MaxLateness, LatencyHistogramBinWidth and
+ *    LatencyHistogram (if LatencyHistogramBins > 0) in the ConfigurationDatabase which is the first (and only) element of the message.
+ *  - ResetTelemetry: the telemetry is reset on the next cycle.
+ * These methods read the telemetry while it is being updated by the timing thread, so that the values may belong to different cycles.
+ *
+ * @details A LinuxTimer with a Master is a slave of another LinuxTimer (which shall not be a slave itself), so that several threads can run
+ * at harmonically related frequencies with a fixed phase relation and without drifting apart. The slave does not have a thread and does not
+ * sleep: the master thread (IndependentThread or RealTimeThread) wakes the slave (through a futex) at the end of the master cycles n where
+ * n % MasterDivider == MasterPhase (n counted from 0 at the first cycle of the master). The slave signals are computed from the schedule of the
+ * master: the Time signal is Counter times MasterDivider times the master period, AbsoluteTime is the deadline of the master cycle and the
+ * Lateness is measured (with the TimeProvider of the master) from the same deadline. The Frequency of the slave signal shall be set (to mark
+ * the synchronising signal) but only the frequency of the master is used. The ExecutionMode, SleepNature, Phase and TimeProvider of the
+ * slave are ignored. Up to LINUX_TIMER_MAX_SLAVES slaves can be registered in a master.
  *
  * @details When TrigRephase is equal to 1, the phase changes and it is kept across a state change if the data source is consumed in both current and next state.
  * If the data source is not used in the current state the phase will be reset to the configured one before the next state execution.
  */
-class LinuxTimer: public DataSourceI, public EmbeddedServiceMethodBinderI {
+class LinuxTimer: public DataSourceI, public EmbeddedServiceMethodBinderI, public MessageI {
 public:
     CLASS_REGISTER_DECLARATION()
     /**
@@ -124,7 +180,7 @@ public:
     LinuxTimer ();
 
     /**
-     * @brief Destructor. Stops the EmbeddedThread.
+     * @brief Destructor. Stops the EmbeddedThread, frees the latency histogram and unregisters from the master (or releases the slaves).
      */
     virtual ~LinuxTimer();
 
@@ -155,7 +211,7 @@ public:
                                        const SignalDirection direction);
 
     /**
-     * @brief Waits on an EventSem for the period given by 1/Frequency to elapse on Execute.
+     * @brief Waits on an EventSem for the period given by 1/Frequency to elapse on Execute (or, for a slave, for the master to fire).
      * @return true if the semaphore is successfully posted.
      */
     virtual bool Synchronise();
@@ -172,7 +228,7 @@ public:
     /**
      * @brief Resets the counter and the timer to zero and starts the EmbeddedThread.
      * @details See StatefulI::PrepareNextState. Starts the EmbeddedThread (if it was not already started) and loops
-     * on the ExecuteMethod.
+     * on the ExecuteMethod. The telemetry is printed (if DumpTelemetry = 1) and reset.
      * @return true if the EmbeddedThread can be successfully started.
      */
     virtual bool PrepareNextState(const char8 * const currentStateName,
@@ -183,7 +239,7 @@ public:
      * @param[in] data configuration in the form:
      * +Timer = {
      *     Class = LinuxTimer
-     *     SleepNature = Busy|Default//If SleepNature is not specified then Default is set
+     *     SleepNature = Busy|Default|Deadline//If SleepNature is not specified then Default is set
      *     Phase = 1000000u
      *     Signals = {
      *         Counter = {
@@ -205,16 +261,18 @@ public:
      *     }
      * }
      * If the SleepNature=Busy a Sleep::Busy will be used to wait for the 1/Frequency period to elapse
-     * @return true if SleepNature=Busy or SleepNature=Default
+     * @return true if SleepNature=Busy, SleepNature=Default or SleepNature=Deadline and if LatencyHistogramBinWidth > 0
      */
     virtual bool Initialise(StructuredDataI & data);
 
     /**
-     * @brief Verifies that two, and only two, signal are set with the correct type.
-     * @details Verifies that two, and only two, signal are set; that the signals are
-     * 32 bits in size with a SignedInteger or UnsignedInteger type and that a Frequency > 0 was set in one of the two signals.
+     * @brief Verifies that between two and nine signals are set with the correct type.
+     * @details Verifies that between two and nine signals are set; that the first two signals are
+     * 32 bits in size with a SignedInteger or UnsignedInteger type, that the optional signals have the types listed in the
+     * class description and that a Frequency > 0 was set in one of the signals.
+     * For a slave, registers the slave in the master.
      * @param[in] data see DataSourceI::SetConfiguredDatabase
-     * @return true if the rules above are met.
+     * @return true if the rules above are met and, for a slave, if the master is a LinuxTimer which is not a slave and has less than LINUX_TIMER_MAX_SLAVES slaves.
      */
     virtual bool SetConfiguredDatabase(StructuredDataI & data);
 
@@ -236,6 +294,44 @@ public:
      */
     uint32 GetSleepPercentage() const;
 
+    /**
+     * @brief Gets the number of slaves registered in this LinuxTimer.
+     * @return the number of slaves registered in this LinuxTimer.
+     */
+    uint32 GetNumberOfSlaves();
+
+    /**
+     * @brief Gets the number of bins of the latency histogram.
+     * @return the number of bins of the latency histogram.
+     */
+    uint32 GetLatencyHistogramBins() const;
+
+    /**
+     * @brief Gets the number of cycles accumulated in a bin of the latency histogram.
+     * @param[in] binIdx the index of the bin.
+     * @return the number of cycles accumulated in the bin (0 if binIdx >= GetLatencyHistogramBins()).
+     */
+    uint32 GetLatencyHistogramCount(const uint32 binIdx) const;
+
+    /**
+     * @brief Prints (REPORT_ERROR Information) the telemetry.
+     * @return ErrorManagement::NoError.
+     */
+    ErrorManagement::ErrorType PrintTelemetry();
+
+    /**
+     * @brief Writes the telemetry in the StructuredDataI which is the first (and only) element of the \a message.
+     * @param[in] message a ReferenceContainer with a ReferenceT<StructuredDataI> (e.g. a ConfigurationDatabase).
+     * @return ErrorManagement::NoError if the telemetry could be written.
+     */
+    ErrorManagement::ErrorType GetTelemetry(ReferenceContainer &message);
+
+    /**
+     * @brief Requests the reset of the telemetry on the next cycle.
+     * @return ErrorManagement::NoError.
+     */
+    ErrorManagement::ErrorType ResetTelemetry();
+
     /**
     * @brief Purges the DataSource
     */
@@ -244,10 +340,10 @@ public:
 private:
 
     /**
-     * @brief The two supported sleep natures.
+     * @brief The supported sleep natures.
      */
     enum LinuxTimerSleepNature {
-        Default = 0, Busy = 1
+        Default = 0, Busy = 1, Deadline = 2
     };
 
     /**
@@ -305,6 +401,11 @@ private:
      */
     ProcessorType cpuMask;
 
+    /**
+     * @brief The CPU and priority placement of the thread that asynchronously generates the time.
+     */
+    ThreadPlacement placement;
+
     /**
      * @brief The size of the stack of the thread that asynchronously generates the time.
      */
@@ -359,6 +460,161 @@ private:
      * @brief Rephase triggering signals.
      */
     uint8 trigRephase;
+
+    /**
+     * @brief Lateness of the last wake-up in nanoseconds.
+     */
+    uint32 lateness;
+
+    /**
+     * @brief Number of cycles in which at least one period was missed.
+     */
+    uint32 overruns;
+
+    /**
+     * @brief Total number of missed periods.
+     */
+    uint32 missedCycles;
+
+    /**
+     * @brief Maximum lateness in nanoseconds.
+     */
+    uint32 maxLateness;
+
+    /**
+     * @brief Number of cycles accumulated in the telemetry.
+     */
+    uint32 numberOfCycles;
+
+    /**
+     * @brief Number of nanoseconds in a tick of the time provider.
+     */
+    float64 nsPerTick;
+
+    /**
+     * @brief The latency histogram (NULL if latencyHistogramBins == 0).
+     */
+    uint32 *latencyHistogram;
+
+    /**
+     * @brief Number of bins of the latency histogram.
+     */
+    uint32 latencyHistogramBins;
+
+    /**
+     * @brief Width of each bin of the latency histogram in nanoseconds.
+     */
+    uint32 latencyHistogramBinWidth;
+
+    /**
+     * @brief True if the telemetry is printed on every state change.
+     */
+    bool dumpTelemetry;
+
+    /**
+     * @brief Set (e.g. by ResetTelemetry) to request the reset of the telemetry on the next cycle.
+     */
+    volatile int32 resetPending;
+
+    /**
+     * @brief Filter to receive the RPC which allows to query the telemetry.
+     */
+    ReferenceT<RegisteredMethodsMessageFilter> filter;
+
+    /**
+     * @brief Full path of the master LinuxTimer (empty if this LinuxTimer is not a slave).
+     */
+    StreamString masterPath;
+
+    /**
+     * @brief The master LinuxTimer (invalid if this LinuxTimer is not a slave).
+     */
+    ReferenceT<LinuxTimer> master;
+
+    /**
+     * @brief The slave fires every masterDivider cycles of the master.
+     */
+    uint32 masterDivider;
+
+    /**
+     * @brief Offset in master cycles of the slave cycles.
+     */
+    uint32 masterPhase;
+
+    /**
+     * @brief The slaves registered in this LinuxTimer.
+     */
+    LinuxTimer *slaves[LINUX_TIMER_MAX_SLAVES];
+
+    /**
+     * @brief Number of slaves registered in this LinuxTimer.
+     */
+    uint32 numberOfSlaves;
+
+    /**
+     * @brief Protects the slaves array.
+     */
+    FastPollingMutexSem slavesMux;
+
+    /**
+     * @brief Number of cycles of the master since its first cycle (reset when the master is not used in the current state).
+     */
+    uint64 masterCycles;
+
+    /**
+     * @brief Futex word of a slave. Incremented by the master for every slave cycle.
+     */
+    volatile int32 slaveSequence;
+
+    /**
+     * @brief The last slaveSequence which was consumed by the slave.
+     */
+    int32 lastSlaveSequence;
+
+    /**
+     * @brief The deadline of the last master cycle which fired the slave.
+     */
+    volatile uint64 slaveDeadlineTicks;
+
+    /**
+     * @brief The period of the slave in microseconds.
+     */
+    volatile uint32 slavePeriodUsecTime;
+
+    /**
+     * @brief Registers a slave.
+     * @param[in] slave the slave to register.
+     * @return true if less than LINUX_TIMER_MAX_SLAVES slaves were registered.
+     */
+    bool RegisterSlave(LinuxTimer * const slave);
+
+    /**
+     * @brief Unregisters a slave.
+     * @param[in] slave the slave to unregister.
+     */
+    void UnregisterSlave(const LinuxTimer * const slave);
+
+    /**
+     * @brief Fires the slaves whose cycles ended in the last nCycles cycles of the master.
+     * @param[in] nCycles the number of master cycles elapsed in the last Execute.
+     */
+    void FireSlaves(const uint32 nCycles);
+
+    /**
+     * @brief Waits for the master to fire the slave and updates the signals.
+     * @return true.
+     */
+    bool WaitMaster();
+
+    /**
+     * @brief Updates the telemetry at the end of a cycle.
+     * @param[in] deadlineTicks the deadline of the cycle.
+     * @param[in] wakeUpTicks the instant when the sleep returned.
+     * @param[in] nCycles the number of periods elapsed since the previous cycle.
+     */
+    void UpdateTelemetry(const uint64 deadlineTicks,
+                         const uint64 wakeUpTicks,
+                         const uint32 nCycles);
 };
 }
 
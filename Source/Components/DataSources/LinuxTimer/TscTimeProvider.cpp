@@ -0,0 +1,356 @@
+/**
+ * @file TscTimeProvider.cpp
+ * @brief Source file for class TscTimeProvider
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class TscTimeProvider (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if defined(__i386__) || defined(__x86_64__)
+#include <cpuid.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "StreamString.h"
+#include "TscTimeProvider.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+/**
+ * Number of nanoseconds in one second.
+ */
+const MARTe::uint64 nanosecondsInSecond = 1000000000u;
+
+/**
+ * Default duration of the calibration in milliseconds.
+ */
+const MARTe::uint32 defaultCalibrationTimeMs = 50u;
+
+/**
+ * Default spin margin of the Deadline sleep nature in microseconds.
+ */
+const MARTe::uint32 defaultSpinMarginUs = 50u;
+
+/**
+ * Spin margin which makes the sleep a pure busy spin.
+ */
+const MARTe::uint64 busySpinMargin = 0xFFFFFFFFFFFFFFFFull;
+
+/**
+ * @brief Reads the nanoseconds of a clock.
+ */
+MARTe::uint64 ReadClock(const clockid_t clockId) {
+    struct timespec now;
+    MARTe::uint64 ns = 0u;
+    if (clock_gettime(clockId, &now) == 0) {
+        ns = (static_cast<MARTe::uint64>(now.tv_sec) * nanosecondsInSecond) + static_cast<MARTe::uint64>(now.tv_nsec);
+    }
+    return ns;
+}
+
+#if defined(__i386__) || defined(__x86_64__)
+/**
+ * @brief Reads the TSC.
+ */
+inline MARTe::uint64 ReadTsc() {
+    MARTe::uint32 low;
+    MARTe::uint32 high;
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+    return (static_cast<MARTe::uint64>(high) << 32u) | static_cast<MARTe::uint64>(low);
+}
+
+/**
+ * @brief Checks the invariant TSC bit of the CPUID.
+ */
+bool IsTscInvariant() {
+    MARTe::uint32 eax = 0u;
+    MARTe::uint32 ebx = 0u;
+    MARTe::uint32 ecx = 0u;
+    MARTe::uint32 edx = 0u;
+    bool invariant = (__get_cpuid(0x80000000u, &eax, &ebx, &ecx, &edx) != 0);
+    if (invariant) {
+        invariant = (eax >= 0x80000007u);
+    }
+    if (invariant) {
+        invariant = (__get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx) != 0);
+    }
+    if (invariant) {
+        invariant = ((edx & (1u << 8u)) != 0u);
+    }
+    return invariant;
+}
+#else
+inline MARTe::uint64 ReadTsc() {
+    return 0u;
+}
+
+bool IsTscInvariant() {
+    return false;
+}
+#endif
+
+/**
+ * @brief Checks if the current clocksource of the kernel is the TSC.
+ */
+bool IsTscKernelClockSource() {
+    bool isTsc = false;
+    FILE *clockSourceFile = fopen("/sys/devices/system/clocksource/clocksource0/current_clocksource", "r");
+    if (clockSourceFile != NULL) {
+        MARTe::char8 clockSource[32];
+        if (fgets(&clockSource[0], static_cast<MARTe::int32>(sizeof(clockSource)), clockSourceFile) != NULL) {
+            isTsc = (strncmp(&clockSource[0], "tsc", 3u) == 0);
+            if (isTsc) {
+                isTsc = ((clockSource[3] == '\n') || (clockSource[3] == '\0'));
+            }
+        }
+        (void) fclose(clockSourceFile);
+    }
+    return isTsc;
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+TscTimeProvider::TscTimeProvider() :
+        TimeProvider() {
+    useTsc = false;
+    tscFrequency = 0u;
+    tscBase = 0u;
+    nsBase = 0u;
+    tscMultiplier = 0u;
+    tscShift = 0u;
+    spinMarginNs = 0u;
+    sleepPercentage = 0u;
+}
+
+TscTimeProvider::~TscTimeProvider() {
+}
+
+bool TscTimeProvider::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    StreamString source;
+    if (ok) {
+        if (!data.Read("Source", source)) {
+            source = "Auto";
+        }
+        uint32 calibrationTimeMs = defaultCalibrationTimeMs;
+        if (!data.Read("CalibrationTime", calibrationTimeMs)) {
+            calibrationTimeMs = defaultCalibrationTimeMs;
+        }
+        ok = (calibrationTimeMs > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "CalibrationTime shall be > 0");
+        }
+        if (ok) {
+            if (source == "Auto") {
+                useTsc = IsTscInvariant();
+                if (!useTsc) {
+                    REPORT_ERROR(ErrorManagement::Information, "The TSC is not invariant. Falling back to clock_gettime");
+                }
+                else {
+                    useTsc = IsTscKernelClockSource();
+                    if (!useTsc) {
+                        REPORT_ERROR(ErrorManagement::Information, "The TSC is not the clocksource of the kernel. Falling back to clock_gettime");
+                    }
+                }
+            }
+            else if (source == "TSC") {
+                useTsc = IsTscInvariant();
+                ok = useTsc;
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Source = TSC but the TSC is not invariant");
+                }
+            }
+            else if (source == "Clock") {
+                useTsc = false;
+            }
+            else {
+                ok = false;
+                REPORT_ERROR(ErrorManagement::ParametersError, "Source shall be Auto, TSC or Clock");
+            }
+        }
+        if ((ok) && (useTsc)) {
+            ok = Calibrate(calibrationTimeMs);
+        }
+    }
+    if (ok) {
+        ok = InnerInitialize(data);
+    }
+    if (ok) {
+        if (useTsc) {
+            REPORT_ERROR(ErrorManagement::Information, "Counter based on the TSC calibrated at %llu Hz", tscFrequency);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::Information, "Counter based on clock_gettime(CLOCK_MONOTONIC)");
+        }
+    }
+    return ok;
+}
+
+bool TscTimeProvider::Calibrate(const uint32 calibrationTimeMs) {
+    const uint64 calibrationNs = static_cast<uint64>(calibrationTimeMs) * 1000000u;
+    //The TSC is read on both sides of the clock so that the error is bounded by the (short) duration of the clock_gettime
+    uint64 tsc0 = ReadTsc();
+    uint64 raw0 = ReadClock(CLOCK_MONOTONIC_RAW);
+    uint64 tsc0b = ReadTsc();
+    uint64 rawNow = raw0;
+    while ((rawNow - raw0) < calibrationNs) {
+        rawNow = ReadClock(CLOCK_MONOTONIC_RAW);
+    }
+    uint64 tsc1 = ReadTsc();
+    uint64 raw1 = ReadClock(CLOCK_MONOTONIC_RAW);
+    uint64 mono1 = ReadClock(CLOCK_MONOTONIC);
+    uint64 tsc1b = ReadTsc();
+    uint64 tscTicks = ((tsc1 + tsc1b) / 2u) - ((tsc0 + tsc0b) / 2u);
+    float64 tscFrequencyF = (static_cast<float64>(tscTicks) * static_cast<float64>(nanosecondsInSecond)) / static_cast<float64>(raw1 - raw0);
+    tscFrequency = static_cast<uint64>(tscFrequencyF);
+    bool ok = (tscFrequency > 0u);
+    if (ok) {
+        //Largest shift where the multiplier fits in 32 bits, so that the multiplication of the low part of the ticks cannot overflow
+        tscShift = 32u;
+        float64 multiplierF = (static_cast<float64>(nanosecondsInSecond) * 4294967296.0) / static_cast<float64>(tscFrequency);
+        while ((multiplierF >= 4294967296.0) && (tscShift > 0u)) {
+            multiplierF /= 2.0;
+            tscShift--;
+        }
+        tscMultiplier = static_cast<uint64>(multiplierF + 0.5);
+        tscBase = tsc1b;
+        nsBase = mono1;
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not calibrate the TSC");
+    }
+    return ok;
+}
+
+uint64 TscTimeProvider::Counter() {
+    uint64 ns;
+    if (useTsc) {
+        uint64 ticks = ReadTsc() - tscBase;
+        //The ticks are split at tscShift so that neither of the products can overflow (tscMultiplier < 2^32 and tscShift <= 32)
+        uint64 lowMask = (1ull << tscShift) - 1u;
+        ns = nsBase + ((ticks >> tscShift) * tscMultiplier) + (((ticks & lowMask) * tscMultiplier) >> tscShift);
+    }
+    else {
+        ns = ReadClock(CLOCK_MONOTONIC);
+    }
+    return ns;
+}
+
+float64 TscTimeProvider::Period() {
+    return 1e-9;
+}
+
+uint64 TscTimeProvider::Frequency() {
+    return nanosecondsInSecond;
+}
+
+bool TscTimeProvider::Sleep(const uint64 start,
+                            const uint64 delta) {
+    const uint64 deadline = start + delta;
+    uint64 spinNs = spinMarginNs;
+    if (sleepPercentage > 0u) {
+        spinNs = (delta * static_cast<uint64>(100u - sleepPercentage)) / 100u;
+    }
+    uint64 now = Counter();
+    if ((now < deadline) && ((deadline - now) > spinNs)) {
+        //The deadline is converted in the CLOCK_MONOTONIC time base, against which the TSC may drift
+        uint64 wakeUpNs = ReadClock(CLOCK_MONOTONIC) + ((deadline - spinNs) - now);
+        struct timespec wakeUpTime;
+        wakeUpTime.tv_sec = static_cast<time_t>(wakeUpNs / nanosecondsInSecond);
+        wakeUpTime.tv_nsec = static_cast<long>(wakeUpNs % nanosecondsInSecond);
+        int32 err;
+        do {
+            err = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeUpTime, NULL_PTR(struct timespec *));
+        }
+        while (err == EINTR);
+    }
+    while (Counter() < deadline) {
+        ;
+    }
+    return true;
+}
+
+bool TscTimeProvider::BackwardCompatibilityInit(StructuredDataI &compatibilityData) {
+    return InnerInitialize(compatibilityData);
+}
+
+bool TscTimeProvider::IsTscUsed() const {
+    return useTsc;
+}
+
+uint64 TscTimeProvider::GetTscFrequency() const {
+    return useTsc ? tscFrequency : 0u;
+}
+
+bool TscTimeProvider::InnerInitialize(StructuredDataI &data) {
+    bool ok = true;
+    StreamString sleepNature;
+    if (!data.Read("SleepNature", sleepNature)) {
+        sleepNature = "Default";
+    }
+    sleepPercentage = 0u;
+    if (sleepNature == "Default") {
+        spinMarginNs = 0u;
+    }
+    else if (sleepNature == "Busy") {
+        spinMarginNs = busySpinMargin;
+        if (data.Read("SleepPercentage", sleepPercentage)) {
+            if (sleepPercentage > 100u) {
+                REPORT_ERROR(ErrorManagement::Warning, "Sleep percentage over 100. Auto-adjusting from %d to 100", sleepPercentage);
+                sleepPercentage = 100u;
+            }
+        }
+        else {
+            sleepPercentage = 0u;
+        }
+    }
+    else if (sleepNature == "Deadline") {
+        uint32 spinMarginUs = defaultSpinMarginUs;
+        if (!data.Read("SpinMargin", spinMarginUs)) {
+            spinMarginUs = defaultSpinMarginUs;
+        }
+        spinMarginNs = static_cast<uint64>(spinMarginUs) * 1000u;
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Specified sleep nature [%s] is not valid", sleepNature.Buffer());
+        ok = false;
+    }
+    return ok;
+}
+
+CLASS_REGISTER(TscTimeProvider, "1.0")
+}
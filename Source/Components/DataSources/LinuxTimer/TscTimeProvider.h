@@ -0,0 +1,207 @@
+/**
+ * @file TscTimeProvider.h
+ * @brief Header file for class TscTimeProvider
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class TscTimeProvider
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef SOURCE_COMPONENTS_DATASOURCES_LINUXTIMER_TSCTIMEPROVIDER_H_
+#define SOURCE_COMPONENTS_DATASOURCES_LINUXTIMER_TSCTIMEPROVIDER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "TimeProvider.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief TimeProvider plugin which counts nanoseconds from the time stamp counter (TSC) of the cpu, calibrated against
+ * CLOCK_MONOTONIC_RAW, and which falls back to clock_gettime(CLOCK_MONOTONIC) when the TSC is not reliable.
+ *
+ * @details The ticks of this provider are always nanoseconds (i.e. Frequency() = 1000000000 and Period() = 1e-9), so that
+ * Counter() can be directly compared with the CLOCK_MONOTONIC time. With the TSC, Counter() is a rdtsc followed by a fixed-point
+ * multiply-shift conversion of the ticks into nanoseconds (no float64 and no system call). The fallback Counter() is a clock_gettime,
+ * which is served by the vDSO (i.e. without entering the kernel) on the Linux platforms which support it.
+ *
+ * The TSC is used only if (Source = Auto):
+ *  - the cpu is x86 and reports an invariant TSC (CPUID 0x80000007, EDX bit 8), whose rate does not depend on the frequency scaling
+ *    and on the sleep states of the cores;
+ *  - the current clocksource of the kernel is tsc. The kernel disqualifies the TSC when it is not synchronised across the cores or
+ *    when it is not stable (e.g. in most virtual machines), so that a thread migrating between cores always reads a coherent time.
+ *
+ * The frequency of the TSC is calibrated in Initialise by sampling the TSC and CLOCK_MONOTONIC_RAW (which is not slewed by NTP) at
+ * the beginning and at the end of a busy wait of CalibrationTime milliseconds.
+ *
+ * The sleep sleeps (clock_nanosleep with TIMER_ABSTIME on CLOCK_MONOTONIC) until SpinMargin before the deadline and busy spins
+ * on Counter() the remaining time. The SpinMargin is set by the SleepNature (which can also be injected by the LinuxTimer):
+ *  - Default: 0, i.e. only the OS sleep;
+ *  - Busy: the whole period (busy spin) or, if SleepPercentage is set, 100 - SleepPercentage of the period;
+ *  - Deadline: the SpinMargin parameter (in microseconds, default 50).
+ *
+ * <pre>
+ * +TimeProvider = {
+ *     Class = TscTimeProvider
+ *     Source = Auto //Optional. Auto (TSC if reliable), TSC (TSC if invariant, even if it is not the kernel clocksource) or Clock (clock_gettime). Default = Auto.
+ *     CalibrationTime = 50 //Optional. Duration of the TSC calibration in milliseconds. Default = 50.
+ *     SleepNature = Default //Optional. Default, Busy or Deadline. Default = Default.
+ *     SleepPercentage = 50 //Optional. Only meaningful if SleepNature = Busy.
+ *     SpinMargin = 50 //Optional. Only meaningful if SleepNature = Deadline. In microseconds. Default = 50.
+ * }
+ * </pre>
+ */
+class TscTimeProvider: public TimeProvider {
+public:
+
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default constructor. Selects the clock_gettime source.
+     */
+    TscTimeProvider();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~TscTimeProvider();
+
+    /**
+     * @brief Reads the Source and the sleep parameters and calibrates the TSC (if it is used).
+     * @param[in] data the configuration.
+     * @return true if the parameters are valid and, if Source = TSC, the TSC is invariant.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Returns the elapsed nanoseconds.
+     * @return the elapsed nanoseconds in the CLOCK_MONOTONIC time base.
+     */
+    virtual uint64 Counter();
+
+    /**
+     * @brief Returns the period of the ticks.
+     * @return 1e-9.
+     */
+    virtual float64 Period();
+
+    /**
+     * @brief Returns the frequency of the ticks.
+     * @return 1000000000.
+     */
+    virtual uint64 Frequency();
+
+    /**
+     * @brief Sleeps until SpinMargin before start + delta and busy spins the remaining time.
+     * @param[in] start Starting count
+     * @param[in] delta Number of nanoseconds to sleep
+     * @return true.
+     */
+    virtual bool Sleep(const uint64 start,
+                       const uint64 delta);
+
+    /**
+     * @brief See TimeProvider::BackwardCompatibilityInit. Reads the sleep parameters injected by the LinuxTimer.
+     * @param[in] compatibilityData Data which is injected from the plugin management DataSource
+     * @return True if configuration operation succeeds. False otherwise.
+     */
+    virtual bool BackwardCompatibilityInit(StructuredDataI &compatibilityData);
+
+    /**
+     * @brief Returns true if Counter() is based on the TSC.
+     * @return true if Counter() is based on the TSC, false if it is based on clock_gettime.
+     */
+    bool IsTscUsed() const;
+
+    /**
+     * @brief Returns the calibrated frequency of the TSC.
+     * @return the calibrated frequency of the TSC in Hz (0 if the TSC is not used).
+     */
+    uint64 GetTscFrequency() const;
+
+private:
+
+    /**
+     * @brief Reads the sleep parameters (for data coming both directly from the cfg or injected through the backward compatibility method).
+     * @param[in] data Configuration data structure.
+     * @return True if the SleepNature is valid.
+     */
+    bool InnerInitialize(StructuredDataI &data);
+
+    /**
+     * @brief Measures the frequency of the TSC and computes the fixed-point conversion factors.
+     * @param[in] calibrationTimeMs the duration of the calibration in milliseconds.
+     * @return true if the measured frequency is > 0.
+     */
+    bool Calibrate(const uint32 calibrationTimeMs);
+
+    /**
+     * True if Counter() is based on the TSC.
+     */
+    bool useTsc;
+
+    /**
+     * The calibrated frequency of the TSC in Hz.
+     */
+    uint64 tscFrequency;
+
+    /**
+     * The TSC value at the end of the calibration.
+     */
+    uint64 tscBase;
+
+    /**
+     * The CLOCK_MONOTONIC nanoseconds which correspond to tscBase.
+     */
+    uint64 nsBase;
+
+    /**
+     * The nanoseconds per TSC tick, multiplied by 2^tscShift.
+     */
+    uint64 tscMultiplier;
+
+    /**
+     * The fixed-point shift of tscMultiplier.
+     */
+    uint32 tscShift;
+
+    /**
+     * The nanoseconds before the deadline where the sleep stops sleeping and starts spinning.
+     */
+    uint64 spinMarginNs;
+
+    /**
+     * The percentage of the period which is spent in the OS sleep (SleepNature = Busy).
+     */
+    uint32 sleepPercentage;
+};
+}
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_COMPONENTS_DATASOURCES_LINUXTIMER_TSCTIMEPROVIDER_H_ */
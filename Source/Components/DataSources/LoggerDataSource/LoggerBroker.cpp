@@ -31,8 +31,10 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "CompilerTypes.h"
 #include "LoggerBroker.h"
+#include "MemoryOperationsHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -47,6 +49,16 @@ LoggerBroker::LoggerBroker() :
     outputSignals = NULL_PTR(AnyType *);
     cycleCounter = 0u;
     cyclePeriod = 0u;
+    ringMemory = NULL_PTR(uint8 *);
+    ringSize = 0u;
+    recordSize = 0u;
+    recordOffsets = NULL_PTR(uint32 *);
+    copySizes = NULL_PTR(uint32 *);
+    writeCounter = 0;
+    readCounter = 0;
+    overflowCount = 0u;
+    reportedOverflowCount = 0u;
+    rateLimitedCount = 0u;
 }
 
 /*lint -e{1551} the destructor must guarantee that the signalNames and outputSignals are freed.*/
@@ -57,6 +69,15 @@ LoggerBroker::~LoggerBroker() {
     if (outputSignals != NULL_PTR(AnyType *)) {
         delete[] outputSignals;
     }
+    if (ringMemory != NULL_PTR(uint8 *)) {
+        delete[] ringMemory;
+    }
+    if (recordOffsets != NULL_PTR(uint32 *)) {
+        delete[] recordOffsets;
+    }
+    if (copySizes != NULL_PTR(uint32 *)) {
+        delete[] copySizes;
+    }
 }
 
 bool LoggerBroker::Init(SignalDirection const direction,
@@ -70,6 +91,8 @@ bool LoggerBroker::Init(SignalDirection const direction,
     if (ok) {
         outputSignals = new AnyType[numberOfCopies];
         signalNames = new StreamString[numberOfCopies];
+        recordOffsets = new uint32[numberOfCopies];
+        copySizes = new uint32[numberOfCopies];
     }
     //Find the function
     uint32 functionIdx = 0u;
@@ -125,6 +148,12 @@ bool LoggerBroker::Init(SignalDirection const direction,
                 ok = signalNames[c].Printf("%s [%d:%d]", signalAlias.Buffer(), startIdx, endIdx - 1u);
             }
 
+            if ((recordOffsets != NULL_PTR(uint32 *)) && (copySizes != NULL_PTR(uint32 *))) {
+                recordOffsets[c] = recordSize;
+                copySizes[c] = size;
+                recordSize += size;
+            }
+
             AnyType printType(signalDesc, 0u, GetFunctionPointer(c));
             if (outputSignals != NULL_PTR(AnyType *)) {
                 outputSignals[c] = printType;
@@ -141,15 +170,47 @@ void LoggerBroker::SetPeriod(const uint32 cyclePeriodIn) {
     cyclePeriod = cyclePeriodIn;
 }
 
+bool LoggerBroker::SetDeferred(const uint32 ringSizeIn) {
+    bool ok = ((ringSizeIn > 0u) && (recordSize > 0u));
+    if (ok) {
+        if (ringMemory != NULL_PTR(uint8 *)) {
+            delete[] ringMemory;
+        }
+        ringSize = ringSizeIn;
+        ringMemory = new uint8[ringSize * recordSize];
+        writeCounter = 0;
+        readCounter = 0;
+    }
+    return ok;
+}
+
 bool LoggerBroker::Execute() {
 
     cycleCounter++;
     if (cycleCounter >= cyclePeriod) {
 
         uint32 n;
-        for (n = 0u; n < numberOfCopies; n++) {
-            if ((signalNames != NULL_PTR(StreamString *)) && (outputSignals != NULL_PTR(AnyType *))) {
-                REPORT_ERROR(ErrorManagement::Information, "%s:%!", signalNames[n].Buffer(), outputSignals[n]);
+        if (ringMemory != NULL_PTR(uint8 *)) {
+            //Wrap-around safe: the difference of the counters is the number of pending records
+            uint32 pending = (static_cast<uint32>(writeCounter) - static_cast<uint32>(readCounter));
+            if (pending < ringSize) {
+                uint8 *record = &ringMemory[(static_cast<uint32>(writeCounter) % ringSize) * recordSize];
+                for (n = 0u; n < numberOfCopies; n++) {
+                    /*lint -e{613} recordOffsets and copySizes are allocated in Init*/
+                    (void) MemoryOperationsHelper::Copy(&record[recordOffsets[n]], GetFunctionPointer(n), copySizes[n]);
+                }
+                //Atomic::Increment is a full memory barrier: Flush sees the record before the new counter
+                Atomic::Increment(&writeCounter);
+            }
+            else {
+                overflowCount++;
+            }
+        }
+        else {
+            for (n = 0u; n < numberOfCopies; n++) {
+                if ((signalNames != NULL_PTR(StreamString *)) && (outputSignals != NULL_PTR(AnyType *))) {
+                    REPORT_ERROR(ErrorManagement::Information, "%s:%!", signalNames[n].Buffer(), outputSignals[n]);
+                }
             }
         }
         cycleCounter = 0u;
@@ -157,6 +218,47 @@ bool LoggerBroker::Execute() {
     return true;
 }
 
+uint32 LoggerBroker::Flush(const uint32 maxRecords) {
+    uint32 printed = 0u;
+    if ((ringMemory != NULL_PTR(uint8 *)) && (signalNames != NULL_PTR(StreamString *)) && (outputSignals != NULL_PTR(AnyType *))) {
+        uint32 lost = overflowCount;
+        if (lost != reportedOverflowCount) {
+            REPORT_ERROR(ErrorManagement::Warning, "LoggerBroker ring full: %u records lost (%u in total)", (lost - reportedOverflowCount), lost);
+            reportedOverflowCount = lost;
+        }
+        uint32 pending = (static_cast<uint32>(writeCounter) - static_cast<uint32>(readCounter));
+        while (pending > 0u) {
+            if (printed < maxRecords) {
+                uint8 *record = &ringMemory[(static_cast<uint32>(readCounter) % ringSize) * recordSize];
+                uint32 n;
+                for (n = 0u; n < numberOfCopies; n++) {
+                    //Same type and shape of the signal, pointing at the copy in the record
+                    AnyType printType(outputSignals[n].GetTypeDescriptor(), 0u, &record[recordOffsets[n]]);
+                    printType.SetNumberOfDimensions(outputSignals[n].GetNumberOfDimensions());
+                    printType.SetNumberOfElements(0u, outputSignals[n].GetNumberOfElements(0u));
+                    REPORT_ERROR(ErrorManagement::Information, "%s:%!", signalNames[n].Buffer(), printType);
+                }
+                printed++;
+            }
+            else {
+                rateLimitedCount++;
+            }
+            //Atomic::Increment is a full memory barrier: the record is only given back after having been printed
+            Atomic::Increment(&readCounter);
+            pending--;
+        }
+    }
+    return printed;
+}
+
+uint32 LoggerBroker::GetOverflowCount() const {
+    return overflowCount;
+}
+
+uint32 LoggerBroker::GetRateLimitedCount() const {
+    return rateLimitedCount;
+}
+
 CLASS_REGISTER(LoggerBroker, "1.0")
 }
 /*---------------------------------------------------------------------------*/
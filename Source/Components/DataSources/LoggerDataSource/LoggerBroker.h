@@ -42,6 +42,12 @@ namespace MARTe {
  * @brief a BrokerI implementation for the LoggerDataSource.
  * @details The Execute method prints to the REPORT_ERROR stream the value of all
  *  the registered signals, using the AnyType Printf.
+ * @details In deferred mode (see SetDeferred) Execute only copies the raw
+ *  signal bytes into the next record of a preallocated single-producer,
+ *  single-consumer ring. The records are formatted and printed by Flush, which
+ *  is called by the LoggerDataSource background thread. If the ring is full
+ *  the record is discarded and counted (see GetOverflowCount), so that
+ *  Execute never waits.
  */
 class LoggerBroker: public BrokerI {
 
@@ -73,10 +79,46 @@ public:
             void *gamMemoryAddress);
 
 
+    /**
+     * @brief Sets the number of cycles which must pass before the signals are logged.
+     * @param[in] cyclePeriodIn the number of cycles.
+     */
     void SetPeriod(const uint32 cyclePeriodIn);
 
+    /**
+     * @brief Switches the broker to deferred mode.
+     * @details Allocates a ring of \a ringSizeIn records, each large enough to
+     *  hold the bytes of all the signals.
+     * @param[in] ringSizeIn the number of records in the ring.
+     * @return true if \a ringSizeIn > 0 and Init was successfully called before.
+     */
+    bool SetDeferred(const uint32 ringSizeIn);
+
+    /**
+     * @brief Prints the records pending in the ring.
+     * @details Records beyond \a maxRecords are discarded and counted (see
+     *  GetRateLimitedCount). Also warns when records were lost since the last
+     *  call. To be called by a single (background) thread.
+     * @param[in] maxRecords the maximum number of records to print.
+     * @return the number of records printed.
+     */
+    uint32 Flush(const uint32 maxRecords);
+
+    /**
+     * @brief Gets the number of records discarded because the ring was full.
+     * @return the number of records discarded because the ring was full.
+     */
+    uint32 GetOverflowCount() const;
+
+    /**
+     * @brief Gets the number of records discarded by the rate limiting.
+     * @return the number of records discarded by the rate limiting.
+     */
+    uint32 GetRateLimitedCount() const;
+
     /**
      * @brief For all the signals print their AnyType value in the logger stream.
+     * @details In deferred mode copies the signals into the ring instead.
      * @return true.
      */
     virtual bool Execute();
@@ -102,6 +144,56 @@ private:
      * Holds the period of cycles must pass before logger produces an output.
      */
     uint32 cyclePeriod;
+
+    /**
+     * The ring of records (ringSize * recordSize bytes). NULL if not deferred.
+     */
+    uint8 *ringMemory;
+
+    /**
+     * The number of records in the ring.
+     */
+    uint32 ringSize;
+
+    /**
+     * The number of bytes of a record.
+     */
+    uint32 recordSize;
+
+    /**
+     * The offset of each copy inside a record.
+     */
+    uint32 *recordOffsets;
+
+    /**
+     * The number of bytes of each copy.
+     */
+    uint32 *copySizes;
+
+    /**
+     * Number of records written by Execute (only written by the producer).
+     */
+    volatile int32 writeCounter;
+
+    /**
+     * Number of records consumed by Flush (only written by the consumer).
+     */
+    volatile int32 readCounter;
+
+    /**
+     * Number of records discarded because the ring was full.
+     */
+    uint32 overflowCount;
+
+    /**
+     * Value of overflowCount at the last warning.
+     */
+    uint32 reportedOverflowCount;
+
+    /**
+     * Number of records discarded by the rate limiting.
+     */
+    uint32 rateLimitedCount;
 };
 
 }
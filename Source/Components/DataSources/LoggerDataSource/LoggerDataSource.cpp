@@ -30,8 +30,11 @@
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
 #include "LoggerBroker.h"
 #include "LoggerDataSource.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -40,11 +43,26 @@
 namespace MARTe {
 
 LoggerDataSource::LoggerDataSource() :
-    DataSourceI() {
+    DataSourceI(),
+    EmbeddedServiceMethodBinderI(),
+    executor(*this) {
     cyclePeriod = 0u;
+    deferred = 0u;
+    ringSize = 64u;
+    flushPeriod = 100u;
+    maxRecordsPerSecond = 0u;
+    recordCredit = 0.0;
+    lastFlushCounter = 0u;
+    cpuMask = 0u;
 }
 
+/*lint -e{1551} the destructor must guarantee that the background thread is stopped.*/
 LoggerDataSource::~LoggerDataSource() {
+    if (!executor.Stop()) {
+        if (!executor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
 }
 
 bool LoggerDataSource::Initialise(StructuredDataI & data) {
@@ -53,6 +71,27 @@ bool LoggerDataSource::Initialise(StructuredDataI & data) {
         if (!data.Read("CyclePeriod", cyclePeriod)) {
             cyclePeriod = 0u;
         }
+        if (!data.Read("Deferred", deferred)) {
+            deferred = 0u;
+        }
+    }
+    if ((ret) && (deferred > 0u)) {
+        if (!data.Read("RingSize", ringSize)) {
+            ringSize = 64u;
+        }
+        ret = (ringSize > 0u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "RingSize shall be > 0");
+        }
+        if (!data.Read("FlushPeriod", flushPeriod)) {
+            flushPeriod = 100u;
+        }
+        if (!data.Read("MaxRecordsPerSecond", maxRecordsPerSecond)) {
+            maxRecordsPerSecond = 0u;
+        }
+        if (!data.Read("CPUMask", cpuMask)) {
+            cpuMask = 0u;
+        }
     }
     return ret;
 }
@@ -96,6 +135,14 @@ bool LoggerDataSource::GetOutputBrokers(ReferenceContainer& outputBrokers,
     bool ok = broker->Init(OutputSignals, *this, functionName, gamMemPtr);
     if (ok) {
         broker->SetPeriod(cyclePeriod);
+        if (deferred > 0u) {
+            ok = broker->SetDeferred(ringSize);
+            if (ok) {
+                ok = deferredBrokers.Insert(broker);
+            }
+        }
+    }
+    if (ok) {
         ok = outputBrokers.Insert(broker);
     }
     return ok;
@@ -104,7 +151,73 @@ bool LoggerDataSource::GetOutputBrokers(ReferenceContainer& outputBrokers,
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: this DataSourceI implementation is independent of the states being changed.*/
 bool LoggerDataSource::PrepareNextState(const char8 * const currentStateName,
                                         const char8 * const nextStateName) {
-    return true;
+    bool ok = true;
+    if ((deferred > 0u) && (executor.GetStatus() == EmbeddedThreadI::OffState)) {
+        executor.SetName(GetName());
+        if (cpuMask > 0u) {
+            executor.SetCPUMask(cpuMask);
+        }
+        //The formatting must never compete with the real-time threads
+        executor.SetPriorityClass(Threads::IdlePriorityClass);
+        recordCredit = static_cast<float64>(maxRecordsPerSecond);
+        lastFlushCounter = HighResolutionTimer::Counter();
+        ok = (executor.Start() == ErrorManagement::NoError);
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType LoggerDataSource::Execute(ExecutionInfo & info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        Sleep::MSec(flushPeriod);
+        uint32 maxRecords = 0xFFFFFFFFu;
+        if (maxRecordsPerSecond > 0u) {
+            uint64 now = HighResolutionTimer::Counter();
+            float64 elapsed = static_cast<float64>(now - lastFlushCounter) * HighResolutionTimer::Period();
+            lastFlushCounter = now;
+            //Token bucket with a burst of (at most) one second of records
+            recordCredit += (elapsed * static_cast<float64>(maxRecordsPerSecond));
+            if (recordCredit > static_cast<float64>(maxRecordsPerSecond)) {
+                recordCredit = static_cast<float64>(maxRecordsPerSecond);
+            }
+            maxRecords = static_cast<uint32>(recordCredit);
+        }
+        uint32 nOfBrokers = deferredBrokers.Size();
+        for (uint32 b = 0u; b < nOfBrokers; b++) {
+            ReferenceT<LoggerBroker> broker = deferredBrokers.Get(b);
+            if (broker.IsValid()) {
+                uint32 printed = broker->Flush(maxRecords);
+                if (maxRecordsPerSecond > 0u) {
+                    maxRecords -= printed;
+                    recordCredit -= static_cast<float64>(printed);
+                }
+            }
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+uint32 LoggerDataSource::GetOverflowCount() {
+    uint32 count = 0u;
+    uint32 nOfBrokers = deferredBrokers.Size();
+    for (uint32 b = 0u; b < nOfBrokers; b++) {
+        ReferenceT<LoggerBroker> broker = deferredBrokers.Get(b);
+        if (broker.IsValid()) {
+            count += broker->GetOverflowCount();
+        }
+    }
+    return count;
+}
+
+uint32 LoggerDataSource::GetRateLimitedCount() {
+    uint32 count = 0u;
+    uint32 nOfBrokers = deferredBrokers.Size();
+    for (uint32 b = 0u; b < nOfBrokers; b++) {
+        ReferenceT<LoggerBroker> broker = deferredBrokers.Get(b);
+        if (broker.IsValid()) {
+            count += broker->GetRateLimitedCount();
+        }
+    }
+    return count;
 }
 
 CLASS_REGISTER(LoggerDataSource, "1.0")
@@ -32,6 +32,8 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "SingleThreadService.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -47,11 +49,20 @@ namespace MARTe {
  *     Class = LoggerDataSource
  *     CyclePeriod = 0u //Optional, defaults to 0. Period of cycles must pass before logger produces an output.
  *                      //CyclePeriod = 0u means print every sample received.
+ *     Deferred = 1 //Optional, defaults to 0. If 1 the signals are copied into a ring and printed by a background thread.
+ *     RingSize = 64 //Optional, defaults to 64. Number of records in the ring of each LoggerBroker (only if Deferred = 1).
+ *     FlushPeriod = 100 //Optional, defaults to 100. Period in ms of the background thread (only if Deferred = 1).
+ *     MaxRecordsPerSecond = 0 //Optional, defaults to 0 (no limit). Records printed above this rate are discarded (only if Deferred = 1).
+ *     CPUMask = 0x1 //Optional. CPU affinity of the background thread (only if Deferred = 1).
  * }
  *
+ * With Deferred = 1 the real-time thread never formats nor logs: it only copies the signal bytes into a preallocated
+ *  ring and the background thread, which runs with the idle priority class, prints them. Records which do not fit in the
+ *  ring or exceed MaxRecordsPerSecond are discarded and counted (see GetOverflowCount and GetRateLimitedCount).
+ *
  * A signal will be added for each GAM signal that writes to this instance of the DataSourceI.
  */
-class LoggerDataSource: public DataSourceI {
+class LoggerDataSource: public DataSourceI, public EmbeddedServiceMethodBinderI {
 public:
     CLASS_REGISTER_DECLARATION()
     /**
@@ -60,10 +71,14 @@ public:
 LoggerDataSource    ();
 
     /**
-     * @brief Destructor. NOOP.
+     * @brief Destructor. Stops the background thread.
      */
     virtual ~LoggerDataSource();
 
+    /**
+     * @brief Reads the parameters listed in the class description.
+     * @return true if DataSourceI::Initialise succeeds and, if Deferred = 1, RingSize > 0.
+     */
 
     virtual bool Initialise(StructuredDataI & data);
 
@@ -115,6 +130,7 @@ LoggerDataSource    ();
      * @param[out] outputBrokers where the BrokerI instances have to be added to.
      * @param[in] functionName name of the function being queried.
      * @param[in] gamMemPtr the GAM memory where the signals will be written to.
+     * @details If Deferred = 1 the broker is switched to deferred mode and registered for the background thread.
      * @return true iff the LoggerBroker has been successfully initialised and added to the \a outputBrokers.
      */
     virtual bool GetOutputBrokers(ReferenceContainer &outputBrokers,
@@ -122,17 +138,81 @@ LoggerDataSource    ();
             void * const gamMemPtr);
 
     /**
-     * @brief NOOP.
-     * @return true.
+     * @brief If Deferred = 1 starts the background thread (if not already running).
+     * @return true if the background thread is running or Deferred = 0.
      */
     virtual bool PrepareNextState(const char8 * const currentStateName,
             const char8 * const nextStateName);
 
+    /**
+     * @brief Background thread callback. Waits FlushPeriod ms and flushes the rings of all the deferred brokers,
+     *  honouring MaxRecordsPerSecond.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo & info);
+
+    /**
+     * @brief Gets the number of records discarded because a broker ring was full.
+     * @return the sum of LoggerBroker::GetOverflowCount for all the deferred brokers.
+     */
+    uint32 GetOverflowCount();
+
+    /**
+     * @brief Gets the number of records discarded by the rate limiting.
+     * @return the sum of LoggerBroker::GetRateLimitedCount for all the deferred brokers.
+     */
+    uint32 GetRateLimitedCount();
+
 protected:
     /**
      * @brief Holds the period of cycles must pass before logger produces an output.
      */
     uint32 cyclePeriod;
+
+    /**
+     * @brief If the brokers copy the signals into a ring printed by the background thread.
+     */
+    uint8 deferred;
+
+    /**
+     * @brief Number of records in the ring of each broker.
+     */
+    uint32 ringSize;
+
+    /**
+     * @brief Period in ms of the background thread.
+     */
+    uint32 flushPeriod;
+
+    /**
+     * @brief Maximum number of records printed per second (0 means no limit).
+     */
+    uint32 maxRecordsPerSecond;
+
+    /**
+     * @brief Number of records which can still be printed (rate limiting).
+     */
+    float64 recordCredit;
+
+    /**
+     * @brief HighResolutionTimer counter of the last flush.
+     */
+    uint64 lastFlushCounter;
+
+    /**
+     * @brief CPU mask of the background thread.
+     */
+    uint32 cpuMask;
+
+    /**
+     * @brief The deferred brokers.
+     */
+    ReferenceContainer deferredBrokers;
+
+    /**
+     * @brief The background thread.
+     */
+    SingleThreadService executor;
 };
 }
 
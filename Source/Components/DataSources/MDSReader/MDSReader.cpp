@@ -32,6 +32,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "MDSReader.h"
 #include "MemoryMapSynchronisedInputBroker.h"
 
@@ -41,6 +42,149 @@
 
 /*lint -estring(1960, "*MDSplus::*") -estring(1960, "*std::*") Ignore errors that do not belong to this DataSource namespace*/
 
+namespace MARTe {
+/**
+ * Maximum time that the read-ahead thread waits for Synchronise to publish a new segment.
+ */
+static const uint32 READ_AHEAD_WAIT_TIMEOUT_MSEC = 200u;
+
+/**
+ * @brief Frees the buffers of a MDSReaderSegment.
+ */
+static void FreeSegment(MDSReaderSegment &slot) {
+    if (slot.data != NULL_PTR(char8 *)) {
+        delete[] slot.data;
+        slot.data = NULL_PTR(char8 *);
+    }
+    if (slot.time != NULL_PTR(float64 *)) {
+        delete[] slot.time;
+        slot.time = NULL_PTR(float64 *);
+    }
+}
+
+/**
+ * @brief Copies the samples returned by MDSplus into a MDSReaderSegment (reallocating it only if they do not fit) and deletes them.
+ */
+template<typename T>
+static void StoreSegmentSamples(T * const array,
+                                const int32 numberOfSamples,
+                                const uint32 typeSize,
+                                MDSReaderSegment &slot) {
+    if (array != NULL_PTR(T *)) {
+        uint32 nBytes = static_cast<uint32>(numberOfSamples) * typeSize;
+        if (nBytes > slot.dataCapacity) {
+            FreeSegment(slot);
+            slot.data = new char8[nBytes];
+            slot.dataCapacity = nBytes;
+            slot.timeCapacity = 0u;
+        }
+        (void) MemoryOperationsHelper::Copy(reinterpret_cast<void *>(slot.data), reinterpret_cast<const void *>(array), nBytes);
+        delete[] array;
+    }
+}
+
+/**
+ * @brief Copies the times returned by MDSplus into a MDSReaderSegment (reallocating it only if they do not fit) and deletes them.
+ */
+static void StoreSegmentTimes(float64 * const array,
+                              const int32 numberOfTimes,
+                              MDSReaderSegment &slot) {
+    if (array != NULL_PTR(float64 *)) {
+        uint32 nTimes = static_cast<uint32>(numberOfTimes);
+        if (nTimes > slot.timeCapacity) {
+            if (slot.time != NULL_PTR(float64 *)) {
+                delete[] slot.time;
+            }
+            slot.time = new float64[nTimes];
+            slot.timeCapacity = nTimes;
+        }
+        (void) MemoryOperationsHelper::Copy(reinterpret_cast<void *>(slot.time), reinterpret_cast<const void *>(array), nTimes * static_cast<uint32>(sizeof(float64)));
+        delete[] array;
+    }
+}
+
+/**
+ * @brief Gets the begin and the delta of a Range time dimension (as written by the MDSWriter) without evaluating it.
+ * @return false if \a timeD is not a Range with a begin, an ending and a positive delta.
+ */
+static bool GetRangeDimension(MDSplus::Data * const timeD,
+                              float64 &begin,
+                              float64 &delta,
+                              int32 &numberOfTimes) {
+    /*lint -e{929} -e{1774} the dimension of a segment is only known at run time*/
+    MDSplus::Range *range = dynamic_cast<MDSplus::Range *>(timeD);
+    bool ok = (range != NULL_PTR(MDSplus::Range *));
+    if (ok) {
+        MDSplus::Data *beginD = range->getBegin();
+        MDSplus::Data *endD = range->getEnding();
+        MDSplus::Data *deltaD = range->getDeltaVal();
+        ok = ((beginD != NULL_PTR(MDSplus::Data *)) && (endD != NULL_PTR(MDSplus::Data *)) && (deltaD != NULL_PTR(MDSplus::Data *)));
+        float64 end = 0.;
+        if (ok) {
+            begin = beginD->getDouble();
+            end = endD->getDouble();
+            delta = deltaD->getDouble();
+            ok = ((delta > 0.) && (end >= begin));
+        }
+        if (ok) {
+            //The ending is the time of the last sample
+            float64 numberOfTimesF = ((end - begin) / delta) + 0.5;
+            numberOfTimes = static_cast<int32>(numberOfTimesF) + 1;
+        }
+        if (beginD != NULL_PTR(MDSplus::Data *)) {
+            MDSplus::deleteData(beginD);
+        }
+        if (endD != NULL_PTR(MDSplus::Data *)) {
+            MDSplus::deleteData(endD);
+        }
+        if (deltaD != NULL_PTR(MDSplus::Data *)) {
+            MDSplus::deleteData(deltaD);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Computes the times of a Range time dimension into a MDSReaderSegment (reallocating it only if they do not fit).
+ * @details Avoids the evaluation of the Range by MDSplus, which allocates and returns a new array of times.
+ * @return false if \a timeD is not a Range (see GetRangeDimension).
+ */
+static bool StoreSegmentRange(MDSplus::Data * const timeD,
+                              int32 &numberOfTimes,
+                              MDSReaderSegment &slot) {
+    float64 begin = 0.;
+    float64 delta = 0.;
+    bool ok = GetRangeDimension(timeD, begin, delta, numberOfTimes);
+    if (ok) {
+        uint32 nTimes = static_cast<uint32>(numberOfTimes);
+        if (nTimes > slot.timeCapacity) {
+            if (slot.time != NULL_PTR(float64 *)) {
+                delete[] slot.time;
+            }
+            slot.time = new float64[nTimes];
+            slot.timeCapacity = nTimes;
+        }
+        for (uint32 i = 0u; i < nTimes; i++) {
+            slot.time[i] = begin + (static_cast<float64>(i) * delta);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Sets a MDSReaderSegment as empty.
+ */
+static void ResetSegment(MDSReaderSegment &slot) {
+    slot.segment = -1;
+    slot.data = NULL_PTR(char8 *);
+    slot.time = NULL_PTR(float64 *);
+    slot.numberOfSamples = 0u;
+    slot.numberOfTimes = 0u;
+    slot.dataCapacity = 0u;
+    slot.timeCapacity = 0u;
+}
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -48,7 +192,9 @@
 namespace MARTe {
 
 MDSReader::MDSReader() :
-        DataSourceI() {
+        DataSourceI(),
+        EmbeddedServiceMethodBinderI(),
+        readAheadExecutor(*this) {
     tree = NULL_PTR(MDSplus::Tree *);
     nodeName = NULL_PTR(StreamString *);
     nodes = NULL_PTR(MDSplus::TreeNode **);
@@ -78,11 +224,101 @@ MDSReader::MDSReader() :
     elementsConsumed = NULL_PTR(uint32 *);
     endNode = NULL_PTR(bool *);
     nodeSamplingTime = NULL_PTR(float64 *);
+    segmentTMin = NULL_PTR(float64 **);
+    segmentTMax = NULL_PTR(float64 **);
+    readAheadSegments = 0u;
+    cacheSize = 0u;
+    segmentCache = NULL_PTR(MDSReaderSegment *);
+    segmentScratch = NULL_PTR(MDSReaderSegment *);
+    cacheCursor = NULL_PTR(volatile int32 *);
+    readAheadTree = NULL_PTR(MDSplus::Tree *);
+    readAheadNodes = NULL_PTR(MDSplus::TreeNode **);
+    connection = NULL_PTR(MDSplus::Connection *);
+    fetchNodes = NULL_PTR(uint32 *);
+    fetchSegments = NULL_PTR(uint32 *);
+    cpuMask = ProcessorType(0xFFFFFFFFu);
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+    cacheHits = 0u;
+    cacheMisses = 0u;
+    if (!readAheadSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create the EventSem");
+    }
 }
 
 /*lint -e{1551} the destructor must guarantee that the MDSplus are deleted and the shared memory freed*/
 MDSReader::~MDSReader() {
 
+    if (readAheadExecutor.GetStatus() != EmbeddedThreadI::OffState) {
+        if (!readAheadExecutor.Stop()) {
+            if (!readAheadExecutor.Stop()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the read-ahead thread");
+            }
+        }
+    }
+    (void) readAheadSem.Close();
+    if (readAheadNodes != NULL_PTR(MDSplus::TreeNode **)) {
+        for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+            if (readAheadNodes[i] != NULL_PTR(MDSplus::TreeNode *)) {
+                delete readAheadNodes[i];
+                readAheadNodes[i] = NULL_PTR(MDSplus::TreeNode *);
+            }
+        }
+        delete[] readAheadNodes;
+        readAheadNodes = NULL_PTR(MDSplus::TreeNode **);
+    }
+    if (readAheadTree != NULL_PTR(MDSplus::Tree *)) {
+        delete readAheadTree;
+        readAheadTree = NULL_PTR(MDSplus::Tree *);
+    }
+    if (connection != NULL_PTR(MDSplus::Connection *)) {
+        delete connection;
+        connection = NULL_PTR(MDSplus::Connection *);
+    }
+    if (fetchNodes != NULL_PTR(uint32 *)) {
+        delete[] fetchNodes;
+        fetchNodes = NULL_PTR(uint32 *);
+    }
+    if (fetchSegments != NULL_PTR(uint32 *)) {
+        delete[] fetchSegments;
+        fetchSegments = NULL_PTR(uint32 *);
+    }
+    if (segmentCache != NULL_PTR(MDSReaderSegment *)) {
+        for (uint32 i = 0u; i < (numberOfNodeNames * cacheSize); i++) {
+            FreeSegment(segmentCache[i]);
+        }
+        delete[] segmentCache;
+        segmentCache = NULL_PTR(MDSReaderSegment *);
+    }
+    if (segmentScratch != NULL_PTR(MDSReaderSegment *)) {
+        for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+            FreeSegment(segmentScratch[i]);
+        }
+        delete[] segmentScratch;
+        segmentScratch = NULL_PTR(MDSReaderSegment *);
+    }
+    if (cacheCursor != NULL_PTR(volatile int32 *)) {
+        delete[] cacheCursor;
+        cacheCursor = NULL_PTR(volatile int32 *);
+    }
+    if (segmentTMin != NULL_PTR(float64 **)) {
+        for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+            if (segmentTMin[i] != NULL_PTR(float64 *)) {
+                delete[] segmentTMin[i];
+            }
+        }
+        delete[] segmentTMin;
+        segmentTMin = NULL_PTR(float64 **);
+    }
+    if (segmentTMax != NULL_PTR(float64 **)) {
+        for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+            if (segmentTMax[i] != NULL_PTR(float64 *)) {
+                delete[] segmentTMax[i];
+            }
+        }
+        delete[] segmentTMax;
+        segmentTMax = NULL_PTR(float64 **);
+    }
+
     if (tree != NULL_PTR(MDSplus::Tree *)) {
         delete tree;
         tree = NULL_PTR(MDSplus::Tree *);
@@ -209,6 +445,30 @@ bool MDSReader::Initialise(StructuredDataI& data) {
             period = 1.0 / frequency;
         }
     }
+    if (ok) {
+        if (!data.Read("ReadAheadSegments", readAheadSegments)) {
+            readAheadSegments = 0u;
+        }
+        uint64 cpuMaskIn;
+        if (data.Read("CPUMask", cpuMaskIn)) {
+            cpuMask = BitSet(cpuMaskIn);
+        }
+        if (!data.Read("StackSize", stackSize)) {
+            stackSize = THREADS_DEFAULT_STACKSIZE;
+        }
+        ok = (stackSize > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "StackSize shall be > 0u");
+        }
+    }
+    if (ok) {
+        if (data.Read("Server", server)) {
+            ok = (readAheadSegments > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Server requires ReadAheadSegments > 0");
+            }
+        }
+    }
     if (ok) {
         ok = data.MoveRelative("Signals");
         if (!ok) {
@@ -533,6 +793,20 @@ bool MDSReader::SetConfiguredDatabase(StructuredDataI & data) {
             ok = false;
         }
     }
+    if (ok) { //read the time limits of all the segments
+        segmentTMin = new float64*[numberOfNodeNames];
+        segmentTMax = new float64*[numberOfNodeNames];
+        for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+            segmentTMin[i] = NULL_PTR(float64 *);
+            segmentTMax[i] = NULL_PTR(float64 *);
+        }
+        for (uint32 i = 0u; (i < numberOfNodeNames) && ok; i++) {
+            ok = ReadSegmentLimits(i);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Error reading the segment limits of the node %s", nodeName[i].Buffer());
+            }
+        }
+    }
     if (ok) { //read DataManagement from originalSignalInformation
         dataManagement = new uint8[numberOfNodeNames];
         nodeSamplingTime = new float64[numberOfNodeNames];
@@ -630,14 +904,75 @@ bool MDSReader::SetConfiguredDatabase(StructuredDataI & data) {
             endNode[i] = false;
         }
     }
+    if (ok) { //allocate the segments read by the real-time thread
+        segmentScratch = new MDSReaderSegment[numberOfNodeNames];
+        for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+            ResetSegment(segmentScratch[i]);
+        }
+    }
+    if (ok) {
+        if (readAheadSegments > 0u) {
+            cacheSize = readAheadSegments + 2u;
+            segmentCache = new MDSReaderSegment[numberOfNodeNames * cacheSize];
+            for (uint32 i = 0u; i < (numberOfNodeNames * cacheSize); i++) {
+                ResetSegment(segmentCache[i]);
+            }
+            cacheCursor = new volatile int32[numberOfNodeNames];
+            readAheadNodes = new MDSplus::TreeNode *[numberOfNodeNames];
+            for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+                cacheCursor[i] = 0;
+                readAheadNodes[i] = NULL_PTR(MDSplus::TreeNode *);
+            }
+            //The read-ahead thread uses its own tree and nodes (or its own connection to the server)
+            try {
+                if (server.Size() > 0u) {
+                    fetchNodes = new uint32[numberOfNodeNames * (readAheadSegments + 1u)];
+                    fetchSegments = new uint32[numberOfNodeNames * (readAheadSegments + 1u)];
+                    connection = new MDSplus::Connection(server.BufferReference());
+                    connection->openTree(treeName.BufferReference(), shotNumber);
+                }
+                else {
+                    readAheadTree = new MDSplus::Tree(treeName.Buffer(), shotNumber);
+                    for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+                        readAheadNodes[i] = readAheadTree->getNode(nodeName[i].Buffer());
+                    }
+                }
+            }
+            catch (const MDSplus::MdsException &exc) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed opening the tree %s for the read-ahead thread: %s", treeName.Buffer(), exc.what());
+                ok = false;
+            }
+            if (ok) {
+                readAheadExecutor.SetName(GetName());
+                readAheadExecutor.SetCPUMask(cpuMask);
+                readAheadExecutor.SetStackSize(stackSize);
+                ok = readAheadExecutor.Start();
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Could not start the read-ahead thread");
+                }
+            }
+        }
+    }
     return ok;
 }
 
 bool MDSReader::Synchronise() {
     bool ok;
+    bool published = false;
     for (uint32 i = 0u; i < numberOfNodeNames; i++) {
         currentTime = timeCycle;
         endNode[i] = !GetDataNode(i);
+        if (cacheCursor != NULL_PTR(volatile int32 *)) {
+            //Only published after the segments were used: the read-ahead thread does not replace segments >= cacheCursor - 1
+            int32 cursor = static_cast<int32>(lastSegment[i]);
+            if (cacheCursor[i] != cursor) {
+                (void) Atomic::Exchange(&cacheCursor[i], cursor);
+                published = true;
+            }
+        }
+    }
+    if (published) {
+        (void) readAheadSem.Post();
     }
     PublishTime();
     ok = !AllNodesEnd();
@@ -951,59 +1286,44 @@ bool MDSReader::GetDataNode(const uint32 nodeNumber) {
 int8 MDSReader::FindSegment(const float64 t,
                             uint32 &segment,
                             const uint32 nodeIdx) {
-    bool find = false;
-    MDSplus::Data *tminD;
-    MDSplus::Data *tmaxD;
     int8 retVal = -1;
-    float64 tmax = 0.0;
-    float64 tmin = 0.0;
-    for (uint32 i = lastSegment[nodeIdx]; (i < maxNumberOfSegments[nodeIdx]) && (!find); i++) {
-        nodes[nodeIdx]->getSegmentLimits(static_cast<int32>(i), &tminD, &tmaxD);
-        tmax = tmaxD->getDouble();
-        if (t <= tmax) {
-            find = true;
-            tmin = tminD->getDouble();
-            if (t < tmin) {
-                //look the tmax Previous segment and verify if the difference is smaller than the
-                if (i < 2u) {
+    //Binary search of the first segment (from lastSegment) with t <= tmax. The segments are ordered in time.
+    uint32 low = lastSegment[nodeIdx];
+    uint32 high = maxNumberOfSegments[nodeIdx];
+    while (low < high) {
+        uint32 middle = low + ((high - low) / 2u);
+        if (segmentTMax[nodeIdx][middle] < t) {
+            low = middle + 1u;
+        }
+        else {
+            high = middle;
+        }
+    }
+    if (low < maxNumberOfSegments[nodeIdx]) {
+        uint32 i = low;
+        float64 tmin = segmentTMin[nodeIdx][i];
+        //It is very important. Even the segment does not exist the index must be updated saying the next segment to be look for is this one.
+        //At the same time it is used in the case that the tmin does not exist but tmax segment exist.
+        segment = i;
+        lastSegment[nodeIdx] = i;
+        if (t < tmin) {
+            //look the tmax Previous segment and verify if the difference is smaller than the
+            if (i < 2u) {
+                retVal = 0;
+            }
+            else {
+                float64 tmaxPrevious = segmentTMax[nodeIdx][i - 1u];
+                if ((tmin - tmaxPrevious) > (nodeSamplingTime[nodeIdx] * 1.5)) { //1.5 due o numeric errors. if a samples i s not saved the difference should be nodeSamplingTime * 2
                     retVal = 0;
-                    //It is very important. Even the segment does not exist the index must be updated saying the next segment to be look for is this one.
-                    //At the same time it is used in the case that the tmin does not exist but tmax segment exist.
-                    segment = i;
-                    lastSegment[nodeIdx] = i;
                 }
                 else {
-                    MDSplus::Data *tminPreviousD;
-                    MDSplus::Data *tmaxPreviousD;
-                    float64 tmaxPrevious;
-//                    float64 nodeSamplingTime = 0.0;
-                    nodes[nodeIdx]->getSegmentLimits(static_cast<int32>(i) - 1, &tminPreviousD, &tmaxPreviousD);
-                    tmaxPrevious = tmaxPreviousD->getDouble();
-//                    GetNodeSamplingTime(nodeIdx, nodeSamplingTime);
-                    if ((tmin - tmaxPrevious) > (nodeSamplingTime[nodeIdx] * 1.5)) { //1.5 due o numeric errors. if a samples i s not saved the difference should be nodeSamplingTime * 2
-                        retVal = 0;
-                        //It is very important. Even the segment does not exist the index must be updated saying the next segment to be look for is this one.
-                        //At the same time it is used in the case that the tmin does not exist but tmax segment exist.
-                        segment = i;
-                        lastSegment[nodeIdx] = i;
-                    }
-                    else {
-                        retVal = 1;
-                        segment = i;
-                        lastSegment[nodeIdx] = i;
-                    }
-                    MDSplus::deleteData(tminPreviousD);
-                    MDSplus::deleteData(tmaxPreviousD);
+                    retVal = 1;
                 }
             }
-            else {
-                retVal = 1;
-                segment = i;
-                lastSegment[nodeIdx] = i;
-            }
         }
-        MDSplus::deleteData(tminD);
-        MDSplus::deleteData(tmaxD);
+        else {
+            retVal = 1;
+        }
     }
     return retVal;
 }
@@ -1013,27 +1333,14 @@ uint32 MDSReader::CheckDiscontinuityOfTheSegments(const uint32 nodeNumber,
                                                   const uint32 initialSegment,
                                                   const uint32 finalSegment) const {
     uint32 counter = 0u;
-    int32 maxSegment = static_cast<int32>(finalSegment) + 1;
-    MDSplus::Data *tminD = NULL_PTR(MDSplus::Data *);
-    MDSplus::Data *tmaxD = NULL_PTR(MDSplus::Data *);
-
-    float64 tmin = 0.0;
-    float64 tmax;
-
-//    float64 nodeTimeDiff;
-//    GetNodeSamplingTime(nodeNumber, nodeTimeDiff);
-    nodes[nodeNumber]->getSegmentLimits(static_cast<int32>(initialSegment), &tminD, &tmaxD);
-    tmax = tmaxD->getDouble();
-    for (int32 currentSegment = static_cast<int32>(initialSegment) + 1; currentSegment < maxSegment; currentSegment++) {
-        nodes[nodeNumber]->getSegmentLimits(currentSegment, &tminD, &tmaxD);
-        tmin = tminD->getDouble();
+    float64 tmax = segmentTMax[nodeNumber][initialSegment];
+    for (uint32 currentSegment = initialSegment + 1u; (currentSegment <= finalSegment) && (currentSegment < maxNumberOfSegments[nodeNumber]); currentSegment++) {
+        float64 tmin = segmentTMin[nodeNumber][currentSegment];
         if ((tmin - tmax) > (nodeSamplingTime[nodeNumber] * 1.5)) {
             counter++;
         }
-        tmax = tmaxD->getDouble();
+        tmax = segmentTMax[nodeNumber][currentSegment];
     }
-    MDSplus::deleteData(tminD);
-    MDSplus::deleteData(tmaxD);
     return counter;
 }
 
@@ -1043,8 +1350,22 @@ bool MDSReader::GetNodeSamplingTime(const uint32 idx,
     bool ret = true;
     MDSplus::Data *timeD = nodes[idx]->getSegmentDim(0);
     int32 numberOfElementsPerSeg = 0;
-    float64 *timeNode = timeD->getDoubleArray(&numberOfElementsPerSeg);
-    if (numberOfElementsPerSeg < 1) {
+    float64 rangeBegin = 0.;
+    float64 rangeDelta = 0.;
+    float64 *timeNode = NULL_PTR(float64 *);
+    bool isRange = GetRangeDimension(timeD, rangeBegin, rangeDelta, numberOfElementsPerSeg);
+    if (isRange) {
+        //The period of a Range dimension is known without evaluating it (even if the segment has a single sample)
+        tDiff = rangeDelta;
+    }
+    else {
+        timeNode = timeD->getDoubleArray(&numberOfElementsPerSeg);
+        ret = (timeNode != NULL_PTR(float64 *));
+    }
+    if ((isRange) || (!ret)) {
+        //NOOP
+    }
+    else if (numberOfElementsPerSeg < 1) {
         ret = false;
     }
     else if (numberOfElementsPerSeg == 1) {
@@ -1400,21 +1721,11 @@ bool MDSReader::CopyDataAddValuesCopyData(const uint32 nodeNumber,
 
 //lint -e{613} Possible use of null pointer. Not possible.If initialisation fails this function is not called
 bool MDSReader::FindDiscontinuity(const uint32 nodeNumber,
-                                 uint32 &segment,
-                                 float64 &beginningTime,
-                                 float64 &endTime) const {
+                                  uint32 &segment,
+                                  float64 &beginningTime,
+                                  float64 &endTime) const {
     bool find = false;
-//    bool error;
-    MDSplus::Data *tminD = NULL_PTR(MDSplus::Data *);
-    MDSplus::Data *tmaxD = NULL_PTR(MDSplus::Data *);
-
-    float64 tmin;
-    float64 tmax;
-
-//    float64 nodeTimeDiff;
-//    error = !GetNodeSamplingTime(nodeNumber, nodeTimeDiff);
-    nodes[nodeNumber]->getSegmentLimits(static_cast<int32>(segment), &tminD, &tmaxD);
-    tmin = tminD->getDouble();
+    float64 tmin = segmentTMin[nodeNumber][segment];
 //Playing with tolerances
     float64 auxDiff = tmin - currentTime;
     if (auxDiff > 0.00000001) {                        //tolerance is 1/100MHz
@@ -1422,24 +1733,19 @@ bool MDSReader::FindDiscontinuity(const uint32 nodeNumber,
         find = true;
     }
     else {
-        tmax = tmaxD->getDouble();
-        int32 initialSemgnet = static_cast<int32>(segment) + 1;
-        for (int32 currentSegment = initialSemgnet; (currentSegment < static_cast<int32>(maxNumberOfSegments[nodeNumber])) && (!find); currentSegment++) {
-            nodes[nodeNumber]->getSegmentLimits(currentSegment, &tminD, &tmaxD);
-            tmin = tminD->getDouble();
+        float64 tmax = segmentTMax[nodeNumber][segment];
+        for (uint32 currentSegment = segment + 1u; (currentSegment < maxNumberOfSegments[nodeNumber]) && (!find); currentSegment++) {
+            tmin = segmentTMin[nodeNumber][currentSegment];
             if ((tmin - tmax) > (nodeSamplingTime[nodeNumber] * 1.5)) {
                 beginningTime = tmax;
                 endTime = tmin;
                 find = true;
             }
-            tmax = tmaxD->getDouble();
-            segment = static_cast<uint32>(currentSegment);
+            tmax = segmentTMax[nodeNumber][currentSegment];
+            segment = currentSegment;
         }
     }
-    MDSplus::deleteData(tminD);
-    MDSplus::deleteData(tmaxD);
     return find;
-//    return (find && (!error));
 }
 
 //lint -e{613} Possible use of null pointer. Not possible. If initilisation fails this function is not called.
@@ -1601,6 +1907,254 @@ bool MDSReader::CopyRemainingData(const uint32 nodeNumber,
     return ret;
 }
 
+bool MDSReader::ReadSegmentLimits(const uint32 idx) {
+    bool ok = true;
+    uint32 nSegments = maxNumberOfSegments[idx];
+    segmentTMin[idx] = new float64[nSegments];
+    segmentTMax[idx] = new float64[nSegments];
+    for (uint32 i = 0u; (i < nSegments) && ok; i++) {
+        MDSplus::Data *tminD = NULL_PTR(MDSplus::Data *);
+        MDSplus::Data *tmaxD = NULL_PTR(MDSplus::Data *);
+        try {
+            nodes[idx]->getSegmentLimits(static_cast<int32>(i), &tminD, &tmaxD);
+            segmentTMin[idx][i] = tminD->getDouble();
+            segmentTMax[idx][i] = tmaxD->getDouble();
+        }
+        catch (const MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed reading the limits of the segment %u of the node %s: %s", i, nodeName[idx].Buffer(), exc.what());
+            ok = false;
+        }
+        if (tminD != NULL_PTR(MDSplus::Data *)) {
+            MDSplus::deleteData(tminD);
+        }
+        if (tmaxD != NULL_PTR(MDSplus::Data *)) {
+            MDSplus::deleteData(tmaxD);
+        }
+    }
+    return ok;
+}
+
+//lint -e{613} Possible use of null pointer. Not possible. If initialisation fails this function is not called.
+bool MDSReader::ReadSegment(MDSplus::TreeNode * const node,
+                            const uint32 nodeNumber,
+                            const uint32 segment,
+                            const bool readTime,
+                            MDSReaderSegment &slot) const {
+    bool ok = true;
+    MDSplus::Data *dataD = NULL_PTR(MDSplus::Data *);
+    MDSplus::Data *timeD = NULL_PTR(MDSplus::Data *);
+    try {
+        dataD = node->getSegment(static_cast<int32>(segment));
+        if (readTime) {
+            timeD = node->getSegmentDim(static_cast<int32>(segment));
+        }
+        ok = StoreSegment(dataD, timeD, nodeNumber, slot);
+    }
+    catch (const MDSplus::MdsException &exc) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed reading the segment %u of the node %s: %s", segment, nodeName[nodeNumber].Buffer(), exc.what());
+        ok = false;
+    }
+    if (dataD != NULL_PTR(MDSplus::Data *)) {
+        MDSplus::deleteData(dataD);
+    }
+    if (timeD != NULL_PTR(MDSplus::Data *)) {
+        MDSplus::deleteData(timeD);
+    }
+    return ok;
+}
+
+//lint -e{613} Possible use of null pointer. Not possible. If initialisation fails this function is not called.
+bool MDSReader::StoreSegment(MDSplus::Data * const dataD,
+                             MDSplus::Data * const timeD,
+                             const uint32 nodeNumber,
+                             MDSReaderSegment &slot) const {
+    bool ok = true;
+    int32 nSamples = 0;
+    int32 nTimes = 0;
+    if (type[nodeNumber] == UnsignedInteger8Bit) {
+        StoreSegmentSamples(reinterpret_cast<uint8 *>(dataD->getByteUnsignedArray(&nSamples)), nSamples, bytesType[nodeNumber], slot);
+    }
+    else if (type[nodeNumber] == SignedInteger8Bit) {
+        StoreSegmentSamples(reinterpret_cast<int8 *>(dataD->getByteArray(&nSamples)), nSamples, bytesType[nodeNumber], slot);
+    }
+    else if (type[nodeNumber] == UnsignedInteger16Bit) {
+        StoreSegmentSamples(reinterpret_cast<uint16 *>(dataD->getShortUnsignedArray(&nSamples)), nSamples, bytesType[nodeNumber], slot);
+    }
+    else if (type[nodeNumber] == SignedInteger16Bit) {
+        StoreSegmentSamples(reinterpret_cast<int16 *>(dataD->getShortArray(&nSamples)), nSamples, bytesType[nodeNumber], slot);
+    }
+    else if (type[nodeNumber] == UnsignedInteger32Bit) {
+        StoreSegmentSamples(reinterpret_cast<uint32 *>(dataD->getIntUnsignedArray(&nSamples)), nSamples, bytesType[nodeNumber], slot);
+    }
+    else if (type[nodeNumber] == SignedInteger32Bit) {
+        StoreSegmentSamples(reinterpret_cast<int32 *>(dataD->getIntArray(&nSamples)), nSamples, bytesType[nodeNumber], slot);
+    }
+    else if (type[nodeNumber] == UnsignedInteger64Bit) {
+        StoreSegmentSamples(reinterpret_cast<uint64 *>(dataD->getLongUnsignedArray(&nSamples)), nSamples, bytesType[nodeNumber], slot);
+    }
+    else if (type[nodeNumber] == SignedInteger64Bit) {
+        StoreSegmentSamples(reinterpret_cast<int64 *>(dataD->getLongArray(&nSamples)), nSamples, bytesType[nodeNumber], slot);
+    }
+    else if (type[nodeNumber] == Float32Bit) {
+        StoreSegmentSamples(dataD->getFloatArray(&nSamples), nSamples, bytesType[nodeNumber], slot);
+    }
+    else if (type[nodeNumber] == Float64Bit) {
+        StoreSegmentSamples(dataD->getDoubleArray(&nSamples), nSamples, bytesType[nodeNumber], slot);
+    }
+    else {
+        ok = false;
+    }
+    if ((ok) && (timeD != NULL_PTR(MDSplus::Data *))) {
+        //The continuous segments written by the MDSWriter have a Range dimension. Other dimensions are evaluated by MDSplus
+        if (!StoreSegmentRange(timeD, nTimes, slot)) {
+            StoreSegmentTimes(timeD->getDoubleArray(&nTimes), nTimes, slot);
+        }
+    }
+    if (ok) {
+        ok = (nSamples > 0);
+    }
+    if (ok) {
+        slot.numberOfSamples = static_cast<uint32>(nSamples);
+        slot.numberOfTimes = static_cast<uint32>(nTimes);
+        if (timeD != NULL_PTR(MDSplus::Data *)) {
+            ok = (nTimes > 0);
+        }
+    }
+    return ok;
+}
+
+const MDSReaderSegment *MDSReader::GetSegment(const uint32 nodeNumber,
+                                              const uint32 segment,
+                                              const bool readTime) {
+    MDSReaderSegment *ret = NULL_PTR(MDSReaderSegment *);
+    if (segmentCache != NULL_PTR(MDSReaderSegment *)) {
+        MDSReaderSegment *slot = &segmentCache[(nodeNumber * cacheSize) + (segment % cacheSize)];
+        //The read-ahead thread sets the segment (with a memory barrier) only once the slot is filled
+        if (slot->segment == static_cast<int32>(segment)) {
+            ret = slot;
+            cacheHits++;
+        }
+    }
+    if ((ret == NULL_PTR(MDSReaderSegment *)) && (segmentScratch != NULL_PTR(MDSReaderSegment *))) {
+        cacheMisses++;
+        if (ReadSegment(nodes[nodeNumber], nodeNumber, segment, readTime, segmentScratch[nodeNumber])) {
+            ret = &segmentScratch[nodeNumber];
+        }
+    }
+    return ret;
+}
+
+ErrorManagement::ErrorType MDSReader::Execute(ExecutionInfo& info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        (void) readAheadSem.Reset();
+        if (connection != NULL_PTR(MDSplus::Connection *)) {
+            FetchSegments();
+        }
+        else if ((segmentCache != NULL_PTR(MDSReaderSegment *)) && (cacheCursor != NULL_PTR(volatile int32 *)) && (readAheadNodes != NULL_PTR(MDSplus::TreeNode **))) {
+            for (uint32 n = 0u; n < numberOfNodeNames; n++) {
+                //The segments in [cursor - 1, cursor + readAheadSegments] map to different slots, the replaced ones are older than cursor - 1
+                uint32 cursor = static_cast<uint32>(cacheCursor[n]);
+                uint32 last = cursor + readAheadSegments;
+                for (uint32 s = cursor; (s <= last) && (s < maxNumberOfSegments[n]); s++) {
+                    MDSReaderSegment &slot = segmentCache[(n * cacheSize) + (s % cacheSize)];
+                    if (slot.segment != static_cast<int32>(s)) {
+                        (void) Atomic::Exchange(&slot.segment, -1);
+                        if (ReadSegment(readAheadNodes[n], n, s, true, slot)) {
+                            (void) Atomic::Exchange(&slot.segment, static_cast<int32>(s));
+                        }
+                    }
+                }
+            }
+        }
+        else {
+            //NOOP
+        }
+        (void) readAheadSem.Wait(READ_AHEAD_WAIT_TIMEOUT_MSEC);
+    }
+    return ErrorManagement::NoError;
+}
+
+//lint -e{613} Possible use of null pointer. Not possible. FetchSegments is only called if the connection was opened.
+void MDSReader::FetchSegments() {
+    //Build a single expression with the samples and the time of all the segments which are not in the cache
+    StreamString expression;
+    (void) expression.Printf("%s", "SerializeOut(List(*");
+    uint32 nFetch = 0u;
+    for (uint32 n = 0u; n < numberOfNodeNames; n++) {
+        //The segments in [cursor - 1, cursor + readAheadSegments] map to different slots, the replaced ones are older than cursor - 1
+        uint32 cursor = static_cast<uint32>(cacheCursor[n]);
+        uint32 last = cursor + readAheadSegments;
+        for (uint32 s = cursor; (s <= last) && (s < maxNumberOfSegments[n]); s++) {
+            MDSReaderSegment &slot = segmentCache[(n * cacheSize) + (s % cacheSize)];
+            if (slot.segment != static_cast<int32>(s)) {
+                (void) Atomic::Exchange(&slot.segment, -1);
+                (void) expression.Printf(", data(GetSegment(build_path(\"%s\"), %u)), dim_of(GetSegment(build_path(\"%s\"), %u))", nodeName[n].Buffer(), s,
+                                         nodeName[n].Buffer(), s);
+                fetchNodes[nFetch] = n;
+                fetchSegments[nFetch] = s;
+                nFetch++;
+            }
+        }
+    }
+    if (nFetch > 0u) {
+        (void) expression.Printf("%s", "))");
+        MDSplus::Data *serialised = NULL_PTR(MDSplus::Data *);
+        MDSplus::Data *reply = NULL_PTR(MDSplus::Data *);
+        try {
+            //One round trip for all the nodes. The list is serialised as mdsip only transfers arrays.
+            serialised = connection->get(expression.Buffer());
+            reply = MDSplus::deserialize(serialised);
+            MDSplus::List *segments = dynamic_cast<MDSplus::List *>(reply);
+            if (segments != NULL_PTR(MDSplus::List *)) {
+                for (uint32 i = 0u; i < nFetch; i++) {
+                    uint32 n = fetchNodes[i];
+                    uint32 s = fetchSegments[i];
+                    MDSReaderSegment &slot = segmentCache[(n * cacheSize) + (s % cacheSize)];
+                    if (StoreSegment(segments->getElementAt(static_cast<int32>(2u * i)), segments->getElementAt(static_cast<int32>((2u * i) + 1u)), n, slot)) {
+                        (void) Atomic::Exchange(&slot.segment, static_cast<int32>(s));
+                    }
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::FatalError, "The reply from the server %s is not a List", server.Buffer());
+            }
+        }
+        catch (const MDSplus::MdsException &exc) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed fetching %u segments from the server %s: %s", nFetch, server.Buffer(), exc.what());
+        }
+        if (serialised != NULL_PTR(MDSplus::Data *)) {
+            MDSplus::deleteData(serialised);
+        }
+        if (reply != NULL_PTR(MDSplus::Data *)) {
+            MDSplus::deleteData(reply);
+        }
+    }
+}
+
+uint32 MDSReader::GetReadAheadSegments() const {
+    return readAheadSegments;
+}
+
+const ProcessorType& MDSReader::GetCPUMask() const {
+    return cpuMask;
+}
+
+uint32 MDSReader::GetStackSize() const {
+    return stackSize;
+}
+
+const char8 *MDSReader::GetServer() const {
+    return server.Buffer();
+}
+
+uint64 MDSReader::GetCacheHits() const {
+    return cacheHits;
+}
+
+uint64 MDSReader::GetCacheMisses() const {
+    return cacheMisses;
+}
+
 CLASS_REGISTER(MDSReader, "1.0")
 }
 
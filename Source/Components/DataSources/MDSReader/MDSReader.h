@@ -36,7 +36,11 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
 #include "MessageI.h"
+#include "ProcessorType.h"
+#include "SingleThreadService.h"
 #include "StreamString.h"
 
 /*---------------------------------------------------------------------------*/
@@ -45,6 +49,48 @@
 
 namespace MARTe {
 
+/**
+ * @brief A segment of a node copied in memory.
+ * @details Used for the segments read in advance by the read-ahead thread (see MDSReader ReadAheadSegments) and for the segments
+ * read by the real-time thread when they are not in the cache.
+ */
+struct MDSReaderSegment {
+    /**
+     * The index of the segment held or -1 if the slot is empty (or is being filled).
+     */
+    volatile int32 segment;
+
+    /**
+     * The samples of the segment.
+     */
+    char8 *data;
+
+    /**
+     * The time of each sample of the segment.
+     */
+    float64 *time;
+
+    /**
+     * The number of samples in data.
+     */
+    uint32 numberOfSamples;
+
+    /**
+     * The number of times in time.
+     */
+    uint32 numberOfTimes;
+
+    /**
+     * The number of bytes allocated for data.
+     */
+    uint32 dataCapacity;
+
+    /**
+     * The number of elements allocated for time.
+     */
+    uint32 timeCapacity;
+};
+
 /**
  * @brief MDSReader is a data source which allows to read data from a MDSplus tree.
  * @details MDSReader is an input data source which takes data from MDSPlus nodes (as many as desired) and publishes it on a real time application.
@@ -67,6 +113,21 @@ namespace MARTe {
  * <li>1 --> MDSReader fills the absence of data with the last value.</li>
  * </ul>
  *
+ * The time limits of all the segments of each node are read once in SetConfiguredDatabase, so that finding the segments of a cycle is a binary search
+ * on memory. If ReadAheadSegments is set, a thread (with the CPUMask and StackSize below) reads in advance the next ReadAheadSegments segments of each node
+ * (after the last segment used by Synchronise) into a cache of ReadAheadSegments + 2 segments per node, using its own connection to the tree. The segment
+ * of a cache slot is the segment index modulo the cache size, so that, as the segments are only consumed forward, the slot which is replaced is always
+ * the least recently used. In Synchronise the segments are then only copied or interpolated from memory. A segment which is not (yet) in the cache
+ * is read by the real-time thread, as when ReadAheadSegments = 0.
+ *
+ * If Server is set (it requires ReadAheadSegments > 0), the read-ahead thread opens the tree on that mdsip server and fetches all the missing segments
+ * of all the nodes (the next ReadAheadSegments segments of each node) with a single expression, i.e. in one round trip, instead of one request per node
+ * and per segment. The segments and their times are returned in a serialised TDI list which is unpacked into the cache of each node. Synchronise
+ * uses the tree given by TreeName (local or distributed) only for the segments which are not in the cache.
+ *
+ * The time dimension of a segment which is a Range (as written by the MDSWriter for each continuous run) is not evaluated by MDSplus: the
+ * times are computed from its begin and delta directly into the segment buffer, and the sampling time of the node is its delta.
+ *
  * Even if the MDSReader can deal with the absence of data, the sampling time must be constant with-in the node, however the sampling time between
  * nodes can be different.
  *
@@ -103,6 +164,10 @@ namespace MARTe {
  *     TreeName = "test_tree" //Compulsory. Name of the MDSplus tree.
  *     ShotNumber = 1 //Compulsory. 0 --> last shot number (to use 0 shotid.sys must exist)
  *     Frequency = 1000 // in Hz. Is the cycle time of the real time application.
+ *     ReadAheadSegments = 4 //Optional. Default = 0 (no read-ahead thread). Number of segments of each node read in advance by the read-ahead thread.
+ *     CPUMask = 15 //Optional. Default = 0xFFFFFFFF. Affinity of the read-ahead thread.
+ *     StackSize = 10000000 //Optional. Default = THREADS_DEFAULT_STACKSIZE. Stack size of the read-ahead thread.
+ *     Server = "localhost:8000" //Optional. mdsip server from where the read-ahead thread fetches the segments of all the nodes in one round trip. Requires ReadAheadSegments > 0.
  *
  *     Signals = {
  *         S_uint8 = {
@@ -129,7 +194,7 @@ namespace MARTe {
  * }
  * </pre>
  */
-class MDSReader: public DataSourceI {
+class MDSReader: public DataSourceI, public EmbeddedServiceMethodBinderI {
 //TODO Add the macro DLL_API to the class declaration (i.e. class DLL_API MDSReader)
 public:
     CLASS_REGISTER_DECLARATION()
@@ -160,6 +225,7 @@ MDSReader    ();
      * <li>Reads the shot number </li>
      * <li>Opens the tree with the shot number </li>
      * <li>Reads the real-time thread Frequency parameter.</li>
+     * <li>Reads the optional ReadAheadSegments, CPUMask, StackSize and Server parameters.</li>
      * </ul>
      * @param[in] data is the configuration file.
      * @return true if all parameters can be read and the values are valid
@@ -177,6 +243,8 @@ MDSReader    ();
      * <li>Gets number of elements per node (or signal).
      * <li>Gets the the size of the type in bytes</li>
      * <li>Allocates memory
+     * <li>Reads the time limits of all the segments of each node</li>
+     * <li>If ReadAheadSegments > 0, opens the nodes (or the connection to the Server) for the read-ahead thread, allocates the segment cache and starts the thread</li>
      * </ul>
      * @param[in] data is the configuration file.
      * @return true if all parameters can be read and the values are valid
@@ -235,6 +303,52 @@ MDSReader    ();
     virtual bool GetOutputBrokers(ReferenceContainer &outputBrokers,
             const char8* const functionName,
             void * const gamMemPtr);
+
+    /**
+     * @brief Reads in advance the next segments of each node into the segment cache.
+     * @details Callback of the read-ahead thread. For each node, reads the segments from the last segment published by Synchronise
+     * up to ReadAheadSegments segments after it which are not in the cache yet, and then waits for Synchronise to publish a new segment.
+     * @param[in] info not used.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo & info);
+
+    /**
+     * @brief Gets the number of segments read in advance.
+     * @return the number of segments read in advance (0 if no read-ahead thread).
+     */
+    uint32 GetReadAheadSegments() const;
+
+    /**
+     * @brief Gets the affinity of the read-ahead thread.
+     * @return the affinity of the read-ahead thread.
+     */
+    const ProcessorType& GetCPUMask() const;
+
+    /**
+     * @brief Gets the stack size of the read-ahead thread.
+     * @return the stack size of the read-ahead thread.
+     */
+    uint32 GetStackSize() const;
+
+    /**
+     * @brief Gets the mdsip server used by the read-ahead thread.
+     * @return the mdsip server used by the read-ahead thread (empty if the segments are read one by one from the tree).
+     */
+    const char8 *GetServer() const;
+
+    /**
+     * @brief Gets the number of segments which were found in the cache by Synchronise.
+     * @return the number of segments which were found in the cache.
+     */
+    uint64 GetCacheHits() const;
+
+    /**
+     * @brief Gets the number of segments which were read from the tree by Synchronise.
+     * @return the number of segments which were read from the tree.
+     */
+    uint64 GetCacheMisses() const;
+
 private:
     /**
      * @brief Open MDS tree
@@ -490,6 +604,60 @@ private:
 
     bool AllNodesEnd() const;
 
+    /**
+     * @brief Reads the time limits of all the segments of the node idx into segmentTMin and segmentTMax.
+     * @param[in] idx node index.
+     * @return true if the limits of all the segments were read.
+     */
+    bool ReadSegmentLimits(const uint32 idx);
+
+    /**
+     * @brief Reads a segment (and optionally its time) from the tree into a MDSReaderSegment.
+     * @details The slot buffers are only reallocated when the segment does not fit.
+     * @param[in] node the node to read from (\a nodes for the real-time thread and \a readAheadNodes for the read-ahead thread).
+     * @param[in] nodeNumber the node index.
+     * @param[in] segment the segment to read.
+     * @param[in] readTime if true the time of the segment is also read.
+     * @param[out] slot where the segment is copied.
+     * @return true if the segment was read and has at least one sample.
+     */
+    bool ReadSegment(MDSplus::TreeNode * const node,
+            const uint32 nodeNumber,
+            const uint32 segment,
+            const bool readTime,
+            MDSReaderSegment &slot) const;
+
+    /**
+     * @brief Copies the samples (and optionally the time) of a segment into a MDSReaderSegment.
+     * @details May throw a MDSplus::MdsException.
+     * @param[in] dataD the samples of the segment.
+     * @param[in] timeD the time of the samples of the segment (NULL if not needed).
+     * @param[in] nodeNumber the node index.
+     * @param[out] slot where the segment is copied.
+     * @return true if the segment has at least one sample (and one time if timeD is not NULL).
+     */
+    bool StoreSegment(MDSplus::Data * const dataD,
+            MDSplus::Data * const timeD,
+            const uint32 nodeNumber,
+            MDSReaderSegment &slot) const;
+
+    /**
+     * @brief Fetches from the Server, in one round trip, all the segments missing in the cache of all the nodes.
+     * @details Called by the read-ahead thread.
+     */
+    void FetchSegments();
+
+    /**
+     * @brief Gets a segment of a node from the cache or, if it is not there, reads it from the tree.
+     * @param[in] nodeNumber the node index.
+     * @param[in] segment the segment to get.
+     * @param[in] readTime if true the time of the segment is also needed.
+     * @return the segment or NULL if it could not be read.
+     */
+    const MDSReaderSegment *GetSegment(const uint32 nodeNumber,
+            const uint32 segment,
+            const bool readTime);
+
     /**
      * The name of the MDSplus tree to be opened.
      */
@@ -636,6 +804,101 @@ private:
     bool *endNode;
     float64 *nodeSamplingTime;
 
+    /**
+     * The minimum time of each segment of each node (read once in SetConfiguredDatabase).
+     */
+    float64 **segmentTMin;
+
+    /**
+     * The maximum time of each segment of each node (read once in SetConfiguredDatabase).
+     */
+    float64 **segmentTMax;
+
+    /**
+     * The number of segments read in advance by the read-ahead thread.
+     */
+    uint32 readAheadSegments;
+
+    /**
+     * The number of segments in the cache of each node (readAheadSegments + 2).
+     */
+    uint32 cacheSize;
+
+    /**
+     * The segment cache (nodeNumber * cacheSize + (segment % cacheSize)).
+     */
+    MDSReaderSegment *segmentCache;
+
+    /**
+     * The segment of each node read by the real-time thread when not found in the cache.
+     */
+    MDSReaderSegment *segmentScratch;
+
+    /**
+     * The last segment of each node published by Synchronise. The read-ahead thread only replaces segments which are older than cacheCursor - 1.
+     */
+    volatile int32 *cacheCursor;
+
+    /**
+     * The tree opened by the read-ahead thread.
+     */
+    MDSplus::Tree *readAheadTree;
+
+    /**
+     * The nodes opened by the read-ahead thread.
+     */
+    MDSplus::TreeNode **readAheadNodes;
+
+    /**
+     * The mdsip server used by the read-ahead thread.
+     */
+    StreamString server;
+
+    /**
+     * The connection to the server used by the read-ahead thread.
+     */
+    MDSplus::Connection *connection;
+
+    /**
+     * The node of each segment fetched by FetchSegments.
+     */
+    uint32 *fetchNodes;
+
+    /**
+     * The segments fetched by FetchSegments.
+     */
+    uint32 *fetchSegments;
+
+    /**
+     * Posted by Synchronise when a new segment is published.
+     */
+    EventSem readAheadSem;
+
+    /**
+     * The read-ahead thread.
+     */
+    SingleThreadService readAheadExecutor;
+
+    /**
+     * The affinity of the read-ahead thread.
+     */
+    ProcessorType cpuMask;
+
+    /**
+     * The stack size of the read-ahead thread.
+     */
+    uint32 stackSize;
+
+    /**
+     * Number of segments found in the cache by Synchronise.
+     */
+    uint64 cacheHits;
+
+    /**
+     * Number of segments read from the tree by Synchronise.
+     */
+    uint64 cacheMisses;
+
 };
 
 
@@ -659,76 +922,49 @@ uint32 MDSReader::MakeRawCopyTemplate(uint32 nodeNumber,
                                       uint32 SamplesToCopy,
                                       uint32 OffsetSamples) {
 
-    MDSplus::Data *dataD = NULL_PTR(MDSplus::Data *);
+    const MDSReaderSegment *segmentData = NULL_PTR(const MDSReaderSegment *);
     int32 nElements = 0u;
     uint32 bytesToCopy = 0u;
     uint32 extraOffset = OffsetSamples * bytesType[nodeNumber];
     bool endSegment = false;
     uint32 samplesCopied = 0u;
     uint32 remainingSamplesOnTheSegment = 0u;
-    T* data = NULL_PTR(T *);
-    for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (SamplesToCopy != 0); currentSegment++) {
-        dataD = nodes[nodeNumber]->getSegment(currentSegment);
-        if (type[nodeNumber] == UnsignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float32Bit) {
-            data = reinterpret_cast<T *>(dataD->getFloatArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float64Bit) {
-            data = reinterpret_cast<T *>(dataD->getDoubleArray(&nElements));
-        }
-
-        remainingSamplesOnTheSegment = static_cast<uint32>(nElements) - elementsConsumed[nodeNumber];
-        endSegment = remainingSamplesOnTheSegment <= SamplesToCopy;
-        if (!endSegment) {        // no end of segment but no more data need to be copied
-            bytesToCopy = SamplesToCopy * bytesType[nodeNumber];
-            samplesCopied += SamplesToCopy;
-        }
-        else {        // end segment but still more data must be copied
-            bytesToCopy = remainingSamplesOnTheSegment * bytesType[nodeNumber];
-            samplesCopied += remainingSamplesOnTheSegment;
+    bool segmentRead = true;
+    const T* data = NULL_PTR(const T *);
+    for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (SamplesToCopy != 0) && (segmentRead); currentSegment++) {
+        segmentData = GetSegment(nodeNumber, currentSegment, false);
+        segmentRead = (segmentData != NULL_PTR(const MDSReaderSegment *));
+        if (segmentRead) {
+            data = reinterpret_cast<const T *>(segmentData->data);
+            nElements = static_cast<int32>(segmentData->numberOfSamples);
+
+            remainingSamplesOnTheSegment = static_cast<uint32>(nElements) - elementsConsumed[nodeNumber];
+            endSegment = remainingSamplesOnTheSegment <= SamplesToCopy;
+            if (!endSegment) {        // no end of segment but no more data need to be copied
+                bytesToCopy = SamplesToCopy * bytesType[nodeNumber];
+                samplesCopied += SamplesToCopy;
+            }
+            else {        // end segment but still more data must be copied
+                bytesToCopy = remainingSamplesOnTheSegment * bytesType[nodeNumber];
+                samplesCopied += remainingSamplesOnTheSegment;
 
-            //
-        }
-        MemoryOperationsHelper::Copy(reinterpret_cast<void *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]),
-                                     reinterpret_cast<void *>(&data[elementsConsumed[nodeNumber]]), bytesToCopy);
-        extraOffset += bytesToCopy;
-
-//Update values
-        if (!endSegment) {        // no end of segment but no more data need to be copied
-            elementsConsumed[nodeNumber] += SamplesToCopy;
-            SamplesToCopy = 0u;
-        }
-        else {        // end segment but still more data must be copied
-            SamplesToCopy -= ((static_cast<uint32>(nElements)) - elementsConsumed[nodeNumber]);
-            elementsConsumed[nodeNumber] = 0u;
+                //
+            }
+            MemoryOperationsHelper::Copy(reinterpret_cast<void *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]),
+                                         reinterpret_cast<const void *>(&data[elementsConsumed[nodeNumber]]), bytesToCopy);
+            extraOffset += bytesToCopy;
+
+            //Update values
+            if (!endSegment) {        // no end of segment but no more data need to be copied
+                elementsConsumed[nodeNumber] += SamplesToCopy;
+                SamplesToCopy = 0u;
+            }
+            else {        // end segment but still more data must be copied
+                SamplesToCopy -= ((static_cast<uint32>(nElements)) - elementsConsumed[nodeNumber]);
+                elementsConsumed[nodeNumber] = 0u;
+            }
+            *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]) = data[nElements - 1];
         }
-        *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]) = data[nElements - 1];
-        MDSplus::deleteData(dataD);
-        delete data;
-
     }
     return samplesCopied;
 }
@@ -740,9 +976,8 @@ uint32 MDSReader::LinearInterpolationCopyTemplate(uint32 nodeNumber,
                                                   uint32 samplesToCopy,
                                                   uint32 offsetSamples) {
 
-    MDSplus::Array *dataD = NULL_PTR(MDSplus::Array *);
-    MDSplus::Data *timeNodeD = NULL_PTR(MDSplus::Data *);
-    float64 *timeNode = NULL_PTR(float64 *);
+    const MDSReaderSegment *segmentData = NULL_PTR(const MDSReaderSegment *);
+    const float64 *timeNode = NULL_PTR(const float64 *);
     int32 nElements = 0u;
     uint32 extraOffset = offsetSamples * bytesType[nodeNumber];
     bool endSegment = false;
@@ -750,86 +985,56 @@ uint32 MDSReader::LinearInterpolationCopyTemplate(uint32 nodeNumber,
     uint32 iterations = 0u;
     uint32 remainingSamplesOnTheSegment = 0u;
 
-    T* data = NULL_PTR(T *);
-    for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (samplesToCopy != 0); currentSegment++) {
-        //nodes[nodeNumber]->getSegmentAndDimension(currentSegment, dataD, timeNodeD);
-        dataD = nodes[nodeNumber]->getSegment(currentSegment);
-        timeNodeD = nodes[nodeNumber]->getSegmentDim(currentSegment);
-        if (type[nodeNumber] == UnsignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float32Bit) {
-            data = reinterpret_cast<T *>(dataD->getFloatArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float64Bit) {
-            data = reinterpret_cast<T *>(dataD->getDoubleArray(&nElements));
-        }
-        timeNode = timeNodeD->getDoubleArray(&nElements);
-        float64 auxTime = timeNode[nElements - 1] + samplingTime[nodeNumber];
-        remainingSamplesOnTheSegment = ComputeSamplesToCopy(nodeNumber, currentTime, auxTime); //static_cast<uint32>(1 + ((timeNode[nElements - 1] - currentTime) / samplingTime[nodeNumber]));
-        endSegment = (remainingSamplesOnTheSegment <= samplesToCopy);
-        if (!endSegment) {        //no end of segment but no more data need to be copied
-            samplesCopied += samplesToCopy;
-            iterations = samplesToCopy;
-        }
-        else {        // end segment but still more data must be copied
-            samplesCopied += remainingSamplesOnTheSegment;
-            iterations = remainingSamplesOnTheSegment;
-        }
-        float64 outputInterpolation = 0.0;
-        for (uint32 i = 0u; i < iterations; i++) {
-            while ((currentTime >= timeNode[elementsConsumed[nodeNumber]]) && (elementsConsumed[nodeNumber] < static_cast<uint32>(nElements - 1))) {
-                elementsConsumed[nodeNumber]++;
+    bool segmentRead = true;
+    const T* data = NULL_PTR(const T *);
+    for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (samplesToCopy != 0) && (segmentRead); currentSegment++) {
+        segmentData = GetSegment(nodeNumber, currentSegment, true);
+        segmentRead = (segmentData != NULL_PTR(const MDSReaderSegment *));
+        if (segmentRead) {
+            data = reinterpret_cast<const T *>(segmentData->data);
+            timeNode = segmentData->time;
+            nElements = static_cast<int32>(segmentData->numberOfTimes);
+            float64 auxTime = timeNode[nElements - 1] + samplingTime[nodeNumber];
+            remainingSamplesOnTheSegment = ComputeSamplesToCopy(nodeNumber, currentTime, auxTime); //static_cast<uint32>(1 + ((timeNode[nElements - 1] - currentTime) / samplingTime[nodeNumber]));
+            endSegment = (remainingSamplesOnTheSegment <= samplesToCopy);
+            if (!endSegment) {        //no end of segment but no more data need to be copied
+                samplesCopied += samplesToCopy;
+                iterations = samplesToCopy;
             }
-            if (elementsConsumed[nodeNumber] == 0u) {
-                SampleInterpolation<T>(currentTime, *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]), data[elementsConsumed[nodeNumber]],
-                                       lastTime[nodeNumber], timeNode[elementsConsumed[nodeNumber]], &outputInterpolation);
-
-            }
-            else {
-                SampleInterpolation<T>(currentTime, data[elementsConsumed[nodeNumber] - 1], data[elementsConsumed[nodeNumber]],
-                                       timeNode[elementsConsumed[nodeNumber] - 1], timeNode[elementsConsumed[nodeNumber]], &outputInterpolation);
+            else {        // end segment but still more data must be copied
+                samplesCopied += remainingSamplesOnTheSegment;
+                iterations = remainingSamplesOnTheSegment;
             }
-            if ((type[nodeNumber] == Float32Bit) || (type[nodeNumber] == Float64Bit)) {
-                *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = static_cast<T>(outputInterpolation);
+            float64 outputInterpolation = 0.0;
+            for (uint32 i = 0u; i < iterations; i++) {
+                while ((currentTime >= timeNode[elementsConsumed[nodeNumber]]) && (elementsConsumed[nodeNumber] < static_cast<uint32>(nElements - 1))) {
+                    elementsConsumed[nodeNumber]++;
+                }
+                if (elementsConsumed[nodeNumber] == 0u) {
+                    SampleInterpolation<T>(currentTime, *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]), data[elementsConsumed[nodeNumber]],
+                                           lastTime[nodeNumber], timeNode[elementsConsumed[nodeNumber]], &outputInterpolation);
+
+                }
+                else {
+                    SampleInterpolation<T>(currentTime, data[elementsConsumed[nodeNumber] - 1], data[elementsConsumed[nodeNumber]],
+                                           timeNode[elementsConsumed[nodeNumber] - 1], timeNode[elementsConsumed[nodeNumber]], &outputInterpolation);
+                }
+                if ((type[nodeNumber] == Float32Bit) || (type[nodeNumber] == Float64Bit)) {
+                    *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = static_cast<T>(outputInterpolation);
+                }
+                else {
+                    *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = static_cast<T>(round(outputInterpolation));
+                }
+                extraOffset += bytesType[nodeNumber];
+                currentTime += samplingTime[nodeNumber];
+                samplesToCopy--;
             }
-            else {
-                *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = static_cast<T>(round(outputInterpolation));
+            if (endSegment) {
+                *reinterpret_cast<T *>(&(lastValue[offsetLastValue[nodeNumber]])) = data[nElements - 1];
+                lastTime[nodeNumber] = timeNode[nElements - 1];
+                elementsConsumed[nodeNumber] = 0u;
             }
-            extraOffset += bytesType[nodeNumber];
-            currentTime += samplingTime[nodeNumber];
-            samplesToCopy--;
-        }
-        if (endSegment) {
-            *reinterpret_cast<T *>(&(lastValue[offsetLastValue[nodeNumber]])) = data[nElements - 1];
-            lastTime[nodeNumber] = timeNode[nElements - 1];
-            elementsConsumed[nodeNumber] = 0u;
         }
-        MDSplus::deleteData(dataD);
-        MDSplus::deleteData(timeNodeD);
-        delete data;
-        delete timeNode;
     }
     return samplesCopied;
 
@@ -841,9 +1046,8 @@ uint32 MDSReader::HoldCopyTemplate(uint32 nodeNumber,
                                    uint32 samplesToCopy,
                                    uint32 samplesOffset) {
 
-    MDSplus::Array *dataD = NULL_PTR(MDSplus::Array *);
-    MDSplus::Data *timeNodeD = NULL_PTR(MDSplus::Data *);
-    float64 *timeNode = NULL_PTR(float64 *);
+    const MDSReaderSegment *segmentData = NULL_PTR(const MDSReaderSegment *);
+    const float64 *timeNode = NULL_PTR(const float64 *);
     int32 nElements = 0u;
     uint32 extraOffset = samplesOffset * bytesType[nodeNumber];
     bool endSegment = false;
@@ -851,91 +1055,61 @@ uint32 MDSReader::HoldCopyTemplate(uint32 nodeNumber,
     uint32 iterations = 0u;
     uint32 remainingSamplesOnTheSegment = 0u;
 
-    T* data = NULL_PTR(T *);
-    for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (samplesToCopy != 0); currentSegment++) {
-        //nodes[nodeNumber]->getSegmentAndDimension(currentSegment, dataD, timeNodeD);
-        dataD = nodes[nodeNumber]->getSegment(currentSegment);
-        timeNodeD = nodes[nodeNumber]->getSegmentDim(currentSegment);
-        if (type[nodeNumber] == UnsignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float32Bit) {
-            data = reinterpret_cast<T *>(dataD->getFloatArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float64Bit) {
-            data = reinterpret_cast<T *>(dataD->getDoubleArray(&nElements));
-        }
-        timeNode = timeNodeD->getDoubleArray(&nElements);
-        float64 auxTime = timeNode[nElements - 1] + samplingTime[nodeNumber];
-        remainingSamplesOnTheSegment = ComputeSamplesToCopy(nodeNumber, currentTime, auxTime); //static_cast<uint32>(1 + ((timeNode[nElements - 1] - currentTime) / samplingTime[nodeNumber]));
-        endSegment = (remainingSamplesOnTheSegment <= samplesToCopy);
-        if (!endSegment) {        //no end of segment but no more data need to be copied
-            samplesCopied += samplesToCopy;
-            iterations = samplesToCopy;
-        }
-        else {        // end segment but still more data must be copied
-            samplesCopied += remainingSamplesOnTheSegment;
-            iterations = remainingSamplesOnTheSegment;
-        }
-        for (uint32 i = 0u; i < iterations; i++) {
-            while ((currentTime >= timeNode[elementsConsumed[nodeNumber]]) && (elementsConsumed[nodeNumber] < static_cast<uint32>(nElements - 1))) {
-                elementsConsumed[nodeNumber]++;
+    bool segmentRead = true;
+    const T* data = NULL_PTR(const T *);
+    for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (samplesToCopy != 0) && (segmentRead); currentSegment++) {
+        segmentData = GetSegment(nodeNumber, currentSegment, true);
+        segmentRead = (segmentData != NULL_PTR(const MDSReaderSegment *));
+        if (segmentRead) {
+            data = reinterpret_cast<const T *>(segmentData->data);
+            timeNode = segmentData->time;
+            nElements = static_cast<int32>(segmentData->numberOfTimes);
+            float64 auxTime = timeNode[nElements - 1] + samplingTime[nodeNumber];
+            remainingSamplesOnTheSegment = ComputeSamplesToCopy(nodeNumber, currentTime, auxTime); //static_cast<uint32>(1 + ((timeNode[nElements - 1] - currentTime) / samplingTime[nodeNumber]));
+            endSegment = (remainingSamplesOnTheSegment <= samplesToCopy);
+            if (!endSegment) {        //no end of segment but no more data need to be copied
+                samplesCopied += samplesToCopy;
+                iterations = samplesToCopy;
             }
-            if (elementsConsumed[nodeNumber] == 0u) {
-                float64 diff1 = currentTime - lastTime[nodeNumber];
-                float64 diff2 = timeNode[0] - currentTime;
-                if (diff1 < diff2) {
-                    *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) =
-                            *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]);
-                }
-                else {
-                    *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = data[0];
-                }
+            else {        // end segment but still more data must be copied
+                samplesCopied += remainingSamplesOnTheSegment;
+                iterations = remainingSamplesOnTheSegment;
             }
-            else {
-                float64 diff1 = currentTime - timeNode[elementsConsumed[nodeNumber] - 1];
-                float64 diff2 = timeNode[elementsConsumed[nodeNumber]] - currentTime;
-                if (diff1 < diff2) {
-                    *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = data[elementsConsumed[nodeNumber] - 1];
+            for (uint32 i = 0u; i < iterations; i++) {
+                while ((currentTime >= timeNode[elementsConsumed[nodeNumber]]) && (elementsConsumed[nodeNumber] < static_cast<uint32>(nElements - 1))) {
+                    elementsConsumed[nodeNumber]++;
+                }
+                if (elementsConsumed[nodeNumber] == 0u) {
+                    float64 diff1 = currentTime - lastTime[nodeNumber];
+                    float64 diff2 = timeNode[0] - currentTime;
+                    if (diff1 < diff2) {
+                        *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) =
+                                *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]);
+                    }
+                    else {
+                        *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = data[0];
+                    }
                 }
                 else {
-                    *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = data[elementsConsumed[nodeNumber]];
+                    float64 diff1 = currentTime - timeNode[elementsConsumed[nodeNumber] - 1];
+                    float64 diff2 = timeNode[elementsConsumed[nodeNumber]] - currentTime;
+                    if (diff1 < diff2) {
+                        *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = data[elementsConsumed[nodeNumber] - 1];
+                    }
+                    else {
+                        *reinterpret_cast<T *>(&dataSourceMemory[offsets[nodeNumber] + extraOffset]) = data[elementsConsumed[nodeNumber]];
+                    }
                 }
+                extraOffset += bytesType[nodeNumber];
+                currentTime += samplingTime[nodeNumber];
+                samplesToCopy--;
+            }
+            if (endSegment) {
+                *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]) = data[nElements - 1];
+                lastTime[nodeNumber] = timeNode[nElements - 1];
+                elementsConsumed[nodeNumber] = 0u;
             }
-            extraOffset += bytesType[nodeNumber];
-            currentTime += samplingTime[nodeNumber];
-            samplesToCopy--;
-        }
-        if (endSegment) {
-            *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]) = data[nElements - 1];
-            lastTime[nodeNumber] = timeNode[nElements - 1];
-            elementsConsumed[nodeNumber] = 0u;
         }
-        MDSplus::deleteData(dataD);
-        MDSplus::deleteData(timeNodeD);
-        delete data;
-        delete timeNode;
     }
     return samplesCopied;
 }
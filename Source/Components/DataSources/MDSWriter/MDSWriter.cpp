@@ -30,6 +30,7 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "CLASSMETHODREGISTER.h"
+#include "HeapManager.h"
 #include "MDSWriter.h"
 
 /*---------------------------------------------------------------------------*/
@@ -43,9 +44,16 @@ namespace MARTe {
 
 static const int32 MDS_UNDEFINED_PULSE_NUMBER = -3;
 
+/**
+ * Maximum time that a writer thread waits for queued segments before checking again.
+ */
+static const uint32 MDS_WRITER_THREAD_WAIT_TIMEOUT_MSEC = 200u;
+
 MDSWriter::MDSWriter() :
         DataSourceI(),
-        MessageI() {
+        MessageI(),
+        EmbeddedServiceMethodBinderI(),
+        writerService(*this) {
     storeOnTrigger = false;
     numberOfPreTriggers = 0u;
     numberOfPostTriggers = 0u;
@@ -54,6 +62,7 @@ MDSWriter::MDSWriter() :
     timeSignalIdx = -1;
     nodes = NULL_PTR(MDSWriterNode **);
     dataSourceMemory = NULL_PTR(char8 *);
+    memoryHeap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
     offsets = NULL_PTR(uint32 *);
     cpuMask = ProcessorType(0xfu);
     stackSize = 0u;
@@ -64,6 +73,13 @@ MDSWriter::MDSWriter() :
     lastTimeRefreshCount = 0u;
     refreshEveryCounts = 0u;
     fatalTreeNodeError = false;
+    numberOfWriterThreads = 0u;
+    numberOfSegmentBuffers = 4u;
+    nodeWriterThread = NULL_PTR(uint32 *);
+    writerTrees = NULL_PTR(MDSplus::Tree **);
+    writerSems = NULL_PTR(EventSem *);
+    writerWake = NULL_PTR(bool *);
+    writerError = false;
     filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -75,9 +91,28 @@ MDSWriter::MDSWriter() :
 /*lint -e{1551} -e{1579} the destructor must guarantee that the MDSplus are deleted and the shared memory freed. The brokerAsyncTrigger is freed by the ReferenceT */
 MDSWriter::~MDSWriter() {
 
+    (void) startup.Wait();
     if (FlushSegments() != ErrorManagement::NoError) {
         REPORT_ERROR(ErrorManagement::FatalError, "Failed to Flush the MDSWriterNodes");
     }
+    if (!writerService.Stop()) {
+        if (!writerService.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the writer threads.");
+        }
+    }
+    if (writerSems != NULL_PTR(EventSem *)) {
+        uint32 t;
+        for (t = 0u; t < numberOfWriterThreads; t++) {
+            (void) writerSems[t].Close();
+        }
+        delete[] writerSems;
+    }
+    if (writerWake != NULL_PTR(bool *)) {
+        delete[] writerWake;
+    }
+    if (nodeWriterThread != NULL_PTR(uint32 *)) {
+        delete[] nodeWriterThread;
+    }
     if (nodes != NULL_PTR(MDSWriterNode **)) {
         uint32 n;
         for (n = 0u; (n < numberOfMDSSignals); n++) {
@@ -86,7 +121,7 @@ MDSWriter::~MDSWriter() {
         delete[] nodes;
     }
     if (dataSourceMemory != NULL_PTR(char8 *)) {
-        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(dataSourceMemory));
+        memoryHeap->Free(reinterpret_cast<void *&>(dataSourceMemory));
     }
     if (offsets != NULL_PTR(uint32 *)) {
         delete[] offsets;
@@ -94,11 +129,22 @@ MDSWriter::~MDSWriter() {
     if (tree != NULL_PTR(MDSplus::Tree *)) {
         delete tree;
     }
-
+    DeleteWriterTrees();
+    if (writerTrees != NULL_PTR(MDSplus::Tree **)) {
+        delete[] writerTrees;
+    }
 }
 
 bool MDSWriter::AllocateMemory() {
-    return true;
+    bool ok = true;
+    if (startup.IsStarted()) {
+        ok = startup.Wait();
+    }
+    return ok;
+}
+
+bool MDSWriter::ExecuteStartup() {
+    return (OpenPulse(pulseNumber) == ErrorManagement::NoError);
 }
 
 uint32 MDSWriter::GetNumberOfMemoryBuffers() {
@@ -159,21 +205,35 @@ bool MDSWriter::GetOutputBrokers(ReferenceContainer& outputBrokers, const char8*
 
 bool MDSWriter::Synchronise() {
     uint32 n;
+    if ((writerError) && (!fatalTreeNodeError)) {
+        fatalTreeNodeError = true;
+        SendTreeRuntimeError();
+    }
     if (nodes != NULL_PTR(MDSWriterNode **)) {
         for (n = 0u; (n < numberOfMDSSignals) && (!fatalTreeNodeError); n++) {
             fatalTreeNodeError = !nodes[n]->Execute();
             if (fatalTreeNodeError) {
-                if (treeRuntimeErrorMsg.IsValid()) {
-                    //Reset any previous replies
-                    treeRuntimeErrorMsg->SetAsReply(false);
-                    if (!MessageI::SendMessage(treeRuntimeErrorMsg, this)) {
-                        StreamString destination = treeRuntimeErrorMsg->GetDestination();
-                        StreamString function = treeRuntimeErrorMsg->GetFunction();
-                        REPORT_ERROR(ErrorManagement::FatalError, "Could not send TreeRuntimeError message to %s [%s]",
-                                     destination.Buffer(), function.Buffer());
-                    }
+                SendTreeRuntimeError();
+            }
+            else if (numberOfWriterThreads > 0u) {
+                if (nodes[n]->GetBacklog() > 0u) {
+                    /*lint -e{613} writerWake and nodeWriterThread cannot be NULL if numberOfWriterThreads > 0*/
+                    writerWake[nodeWriterThread[n]] = true;
                 }
             }
+            else {
+                //NOOP
+            }
+        }
+    }
+    if (writerWake != NULL_PTR(bool *)) {
+        uint32 t;
+        for (t = 0u; t < numberOfWriterThreads; t++) {
+            if (writerWake[t]) {
+                writerWake[t] = false;
+                /*lint -e{613} writerSems cannot be NULL if writerWake != NULL*/
+                (void) writerSems[t].Post();
+            }
         }
     }
     if ((HighResolutionTimer::Counter() - lastTimeRefreshCount) > refreshEveryCounts) {
@@ -183,6 +243,66 @@ bool MDSWriter::Synchronise() {
     return !fatalTreeNodeError;
 }
 
+ErrorManagement::ErrorType MDSWriter::Execute(ExecutionInfo& info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        uint32 t = info.GetThreadNumber();
+        if ((t < numberOfWriterThreads) && (writerSems != NULL_PTR(EventSem *)) && (nodes != NULL_PTR(MDSWriterNode **))) {
+            (void) writerSems[t].Reset();
+            bool queued = false;
+            uint32 n;
+            for (n = 0u; (n < numberOfMDSSignals) && (!queued); n++) {
+                /*lint -e{613} nodeWriterThread cannot be NULL if numberOfWriterThreads > 0*/
+                if (nodeWriterThread[n] == t) {
+                    queued = (nodes[n]->GetBacklog() > 0u);
+                }
+            }
+            if (!queued) {
+                (void) writerSems[t].Wait(MDS_WRITER_THREAD_WAIT_TIMEOUT_MSEC);
+            }
+            for (n = 0u; n < numberOfMDSSignals; n++) {
+                /*lint -e{613} nodeWriterThread cannot be NULL if numberOfWriterThreads > 0*/
+                if (nodeWriterThread[n] == t) {
+                    if (!nodes[n]->WriteQueuedSegments()) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Writer thread %u failed to write a segment of MDSWriterNode %u", t, n);
+                        writerError = true;
+                    }
+                }
+            }
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+void MDSWriter::SendTreeRuntimeError() {
+    if (treeRuntimeErrorMsg.IsValid()) {
+        //Reset any previous replies
+        treeRuntimeErrorMsg->SetAsReply(false);
+        if (!MessageI::SendMessage(treeRuntimeErrorMsg, this)) {
+            StreamString destination = treeRuntimeErrorMsg->GetDestination();
+            StreamString function = treeRuntimeErrorMsg->GetFunction();
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not send TreeRuntimeError message to %s [%s]",
+                         destination.Buffer(), function.Buffer());
+        }
+    }
+}
+
+void MDSWriter::DeleteWriterTrees() {
+    if (writerTrees != NULL_PTR(MDSplus::Tree **)) {
+        uint32 t;
+        for (t = 0u; t < numberOfWriterThreads; t++) {
+            if (writerTrees[t] != NULL_PTR(MDSplus::Tree *)) {
+                try {
+                    delete writerTrees[t];
+                }
+                catch (const MDSplus::MdsException &exc) {
+                    REPORT_ERROR(ErrorManagement::Warning, "Failed deleting tree %s of writer thread %u. Error: %s", treeName.Buffer(), t, exc.what());
+                }
+                writerTrees[t] = NULL_PTR(MDSplus::Tree *);
+            }
+        }
+    }
+}
+
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: NOOP at StateChange, independently of the function parameters.*/
 bool MDSWriter::PrepareNextState(const char8* const currentStateName, const char8* const nextStateName) {
     return true;
@@ -202,6 +322,16 @@ bool MDSWriter::Initialise(StructuredDataI& data) {
     if (!ok) {
         REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfBuffers shall be > 0u");
     }
+    if (ok) {
+        StreamString heapName;
+        if (data.Read("HeapName", heapName)) {
+            memoryHeap = HeapManager::FindHeap(heapName.Buffer());
+            ok = (memoryHeap != NULL_PTR(HeapI *));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Could not find a heap named %s", heapName.Buffer());
+            }
+        }
+    }
     if (ok) {
         uint64 cpuMaskIn;
         ok = data.Read("CPUMask", cpuMaskIn);
@@ -212,6 +342,13 @@ bool MDSWriter::Initialise(StructuredDataI& data) {
             cpuMask = BitSet(cpuMaskIn);
         }
     }
+    if (ok) {
+        ok = placement.Initialise(data);
+        if ((ok) && (placement.HasCPUMask())) {
+            //Also used by the brokers which flush the data.
+            cpuMask = placement.GetCPUMask();
+        }
+    }
     if (ok) {
         ok = data.Read("StackSize", stackSize);
     }
@@ -272,6 +409,20 @@ bool MDSWriter::Initialise(StructuredDataI& data) {
         //Optional parameter
         (void) (data.Read("PulseNumber", pulseNumber));
     }
+    if (ok) {
+        if (!data.Read("NumberOfWriterThreads", numberOfWriterThreads)) {
+            numberOfWriterThreads = 0u;
+        }
+        if (!data.Read("NumberOfSegmentBuffers", numberOfSegmentBuffers)) {
+            numberOfSegmentBuffers = 4u;
+        }
+        if (numberOfWriterThreads > 0u) {
+            ok = (numberOfSegmentBuffers > 1u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfSegmentBuffers shall be > 1u");
+            }
+        }
+    }
     if (ok) {
         ok = data.MoveRelative("Signals");
         if (!ok) {
@@ -402,8 +553,14 @@ bool MDSWriter::SetConfiguredDatabase(StructuredDataI& data) {
     }
     //Allocate memory
     if (ok) {
-        dataSourceMemory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(
-                totalSignalMemory));
+        dataSourceMemory = reinterpret_cast<char8 *>(memoryHeap->Malloc(totalSignalMemory));
+        ok = (dataSourceMemory != NULL_PTR(char8 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate %u bytes for the signals", totalSignalMemory);
+        }
+        else {
+            (void) placement.BindMemory(dataSourceMemory, totalSignalMemory);
+        }
     }
 
     float64 timeSignalMultiplier = 0.F;
@@ -456,18 +613,56 @@ bool MDSWriter::SetConfiguredDatabase(StructuredDataI& data) {
                 }
             }
             if (originalSignalInformation.Read("NodeName", nodeName)) {
-
+                uint32 writerThread = 0u;
+                //Without writer threads the segments are written by Execute and shall not be queued
+                uint32 nodeSegmentBuffers = 1u;
+                uint32 segmentStreaming = 0u;
+                (void) originalSignalInformation.Read("SegmentStreaming", segmentStreaming);
+                uint8 automaticSegmentation = 0u;
+                StreamString timeDimension;
+                (void) originalSignalInformation.Read("AutomaticSegmentation", automaticSegmentation);
+                if ((automaticSegmentation == 1u) && (originalSignalInformation.Read("TimeDimension", timeDimension))) {
+                    //The rows are streamed on Range segments
+                    if (timeDimension == "Range") {
+                        segmentStreaming = 1u;
+                    }
+                }
+                //The streamed segments are written by Execute
+                if ((numberOfWriterThreads > 0u) && (segmentStreaming == 0u)) {
+                    nodeSegmentBuffers = numberOfSegmentBuffers;
+                }
+                if (ok) {
+                    ok = originalSignalInformation.Write("NumberOfSegmentBuffers", nodeSegmentBuffers);
+                }
+                if (numberOfWriterThreads > 0u) {
+                    if (!originalSignalInformation.Read("WriterThread", writerThread)) {
+                        writerThread = (numberOfMDSSignals % numberOfWriterThreads);
+                    }
+                    if (ok) {
+                        ok = (writerThread < numberOfWriterThreads);
+                        if (!ok) {
+                            REPORT_ERROR(ErrorManagement::ParametersError, "The WriterThread of %s shall be < NumberOfWriterThreads", nodeName.Buffer());
+                        }
+                    }
+                }
                 //Dynamically add MDSWriteNodes to the list
                 uint32 numberOfNodes = (numberOfMDSSignals + 1u);
+                uint32 *tempWriterThread = new uint32[numberOfNodes];
                 MDSWriterNode **tempNodes = new MDSWriterNode*[numberOfNodes];
                 uint32 t;
                 for (t = 0u; t < numberOfMDSSignals; t++) {
                     if (nodes != NULL_PTR(MDSWriterNode **)) {
                         tempNodes[t] = nodes[t];
                     }
+                    if (nodeWriterThread != NULL_PTR(uint32 *)) {
+                        tempWriterThread[t] = nodeWriterThread[t];
+                    }
                 }
+                tempWriterThread[numberOfMDSSignals] = writerThread;
                 tempNodes[numberOfMDSSignals] = new MDSWriterNode();
-                ok = tempNodes[numberOfMDSSignals]->Initialise(originalSignalInformation);
+                if (ok) {
+                    ok = tempNodes[numberOfMDSSignals]->Initialise(originalSignalInformation);
+                }
                 if (ok) {
                     if ((tempNodes != NULL_PTR(MDSWriterNode **)) && (dataSourceMemory != NULL_PTR(char8 *))
                             && (offsets != NULL_PTR(uint32 *))) {
@@ -477,6 +672,8 @@ bool MDSWriter::SetConfiguredDatabase(StructuredDataI& data) {
                 }
                 delete[] nodes;
                 nodes = tempNodes;
+                delete[] nodeWriterThread;
+                nodeWriterThread = tempWriterThread;
                 numberOfMDSSignals++;
             }
             //Check if the signal is defined as a TimeSignal
@@ -544,9 +741,33 @@ bool MDSWriter::SetConfiguredDatabase(StructuredDataI& data) {
             }
         }
     }
+    if (ok) {
+        if (numberOfWriterThreads > 0u) {
+            writerTrees = new MDSplus::Tree*[numberOfWriterThreads];
+            writerSems = new EventSem[numberOfWriterThreads];
+            writerWake = new bool[numberOfWriterThreads];
+            uint32 t;
+            for (t = 0u; (t < numberOfWriterThreads) && (ok); t++) {
+                writerTrees[t] = NULL_PTR(MDSplus::Tree *);
+                writerWake[t] = false;
+                ok = writerSems[t].Create();
+            }
+            if (ok) {
+                writerService.SetStackSize(stackSize);
+                writerService.SetCPUMask(cpuMask);
+                placement.Apply(writerService);
+                writerService.SetNumberOfPoolThreads(numberOfWriterThreads);
+                writerService.SetName(GetName());
+                ok = (writerService.Start() == ErrorManagement::NoError);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the writer threads");
+            }
+        }
+    }
     if (ok) {
         if (pulseNumber != MDS_UNDEFINED_PULSE_NUMBER) {
-            ok = (OpenTree(pulseNumber) == ErrorManagement::NoError);
+            ok = startup.Start(*this, GetName());
         }
     }
     if (signalSamples != NULL_PTR(uint32 *)) {
@@ -556,6 +777,14 @@ bool MDSWriter::SetConfiguredDatabase(StructuredDataI& data) {
 }
 
 ErrorManagement::ErrorType MDSWriter::OpenTree(const int32 pulseNumberIn) {
+    //The tree of the PulseNumber might still be opening
+    if (startup.IsStarted()) {
+        (void) startup.Wait();
+    }
+    return OpenPulse(pulseNumberIn);
+}
+
+ErrorManagement::ErrorType MDSWriter::OpenPulse(const int32 pulseNumberIn) {
     bool ok = true;
     pulseNumber = pulseNumberIn;
     if (tree != NULL_PTR(MDSplus::Tree *)) {
@@ -582,6 +811,19 @@ ErrorManagement::ErrorType MDSWriter::OpenTree(const int32 pulseNumberIn) {
         }
         tree = NULL_PTR(MDSplus::Tree *);
     }
+    if (numberOfWriterThreads > 0u) {
+        //The nodes are about to be reallocated: no segment of the previous pulse can still be queued
+        uint32 n;
+        if ((nodes != NULL_PTR(MDSWriterNode **)) && (writerSems != NULL_PTR(EventSem *))) {
+            for (n = 0u; (n < numberOfMDSSignals); n++) {
+                /*lint -e{613} nodeWriterThread cannot be NULL if numberOfWriterThreads > 0*/
+                (void) writerSems[nodeWriterThread[n]].Post();
+                (void) nodes[n]->WaitQueuedSegments(0u);
+            }
+        }
+        DeleteWriterTrees();
+        writerError = false;
+    }
     //Check for the latest pulse number
     if ((pulseNumber < 0) && (pulseNumber != MDS_UNDEFINED_PULSE_NUMBER)) {
         try {
@@ -659,11 +901,35 @@ ErrorManagement::ErrorType MDSWriter::OpenTree(const int32 pulseNumberIn) {
         }
     }
 
+    if (ok) {
+        //Each writer thread uses its own MDSplus tree (i.e. its own MDSplus context) to write the segments of its nodes
+        uint32 t;
+        if (writerTrees != NULL_PTR(MDSplus::Tree **)) {
+            for (t = 0u; (t < numberOfWriterThreads) && (ok); t++) {
+                try {
+                    writerTrees[t] = new MDSplus::Tree(treeName.Buffer(), pulseNumber);
+                }
+                catch (const MDSplus::MdsException &exc) {
+                    REPORT_ERROR(ErrorManagement::ParametersError,
+                                 "Failed opening tree %s with the pulseNUmber = %d for the writer thread %u. Error: %s",
+                                 treeName.Buffer(), pulseNumber, t, exc.what());
+                    writerTrees[t] = NULL_PTR(MDSplus::Tree *);
+                    ok = false;
+                }
+            }
+        }
+    }
     if (ok) {
         uint32 n;
         if (nodes != NULL_PTR(MDSWriterNode **)) {
             for (n = 0u; (n < numberOfMDSSignals) && (ok); n++) {
-                ok = nodes[n]->AllocateTreeNode(tree);
+                if (writerTrees != NULL_PTR(MDSplus::Tree **)) {
+                    /*lint -e{613} nodeWriterThread cannot be NULL if writerTrees != NULL*/
+                    ok = nodes[n]->AllocateTreeNode(writerTrees[nodeWriterThread[n]]);
+                }
+                else {
+                    ok = nodes[n]->AllocateTreeNode(tree);
+                }
             }
         }
     }
@@ -724,6 +990,20 @@ ErrorManagement::ErrorType MDSWriter::FlushSegments() {
                 REPORT_ERROR(ErrorManagement::FatalError, "Failed to flush MDSWriterNode");
             }
         }
+        //Wait for the writer threads to write all the queued segments
+        if ((numberOfWriterThreads > 0u) && (writerSems != NULL_PTR(EventSem *))) {
+            for (n = 0u; ((n < numberOfMDSSignals) && (ok)); n++) {
+                /*lint -e{613} nodeWriterThread cannot be NULL if numberOfWriterThreads > 0*/
+                (void) writerSems[nodeWriterThread[n]].Post();
+                ok = nodes[n]->WaitQueuedSegments(0u);
+            }
+            if (ok) {
+                ok = !writerError;
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to write the queued segments of the MDSWriterNodes");
+            }
+        }
     }
     if (ok) {
         if (treeFlushedMsg.IsValid()) {
@@ -742,6 +1022,75 @@ ErrorManagement::ErrorType MDSWriter::FlushSegments() {
     /*lint -e{1762} function cannot be constant as it is registered as an RPC for CLASS_METHOD_REGISTER*/
 }
 
+ErrorManagement::ErrorType MDSWriter::GetWriterStatistics(ReferenceContainer &message) {
+    ErrorManagement::ErrorType err;
+    ReferenceT<StructuredDataI> data = message.Get(0u);
+    err.parametersError = !data.IsValid();
+    if (err.ErrorsCleared()) {
+        err.parametersError = !data->Write("NumberOfWriterThreads", numberOfWriterThreads);
+    }
+    if (nodes != NULL_PTR(MDSWriterNode **)) {
+        uint32 n;
+        for (n = 0u; (n < numberOfMDSSignals) && (err.ErrorsCleared()); n++) {
+            StreamString nodeStatsName;
+            (void) nodeStatsName.Printf("Node%u", n);
+            bool ok = data->CreateRelative(nodeStatsName.Buffer());
+            if (ok) {
+                ok = data->Write("NodeName", nodes[n]->GetNodeName().Buffer());
+            }
+            if (ok) {
+                uint32 writerThread = 0u;
+                if (nodeWriterThread != NULL_PTR(uint32 *)) {
+                    writerThread = nodeWriterThread[n];
+                }
+                ok = data->Write("WriterThread", writerThread);
+            }
+            if (ok) {
+                ok = data->Write("Backlog", nodes[n]->GetBacklog());
+            }
+            if (ok) {
+                ok = data->Write("MaxBacklog", nodes[n]->GetMaxBacklog());
+            }
+            if (ok) {
+                ok = data->Write("NumberOfQueueFull", nodes[n]->GetNumberOfQueueFull());
+            }
+            if (ok) {
+                ok = data->Write("NumberOfSegments", nodes[n]->GetNumberOfSegments());
+            }
+            if (ok) {
+                ok = data->Write("LastSegmentLatency", nodes[n]->GetLastSegmentLatency());
+            }
+            if (ok) {
+                ok = data->Write("MaxSegmentLatency", nodes[n]->GetMaxSegmentLatency());
+            }
+            if (ok) {
+                ok = data->MoveToAncestor(1u);
+            }
+            err.parametersError = !ok;
+        }
+    }
+    if (!err.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Message does not contain a ReferenceT<StructuredDataI>");
+    }
+    return err;
+}
+
+uint32 MDSWriter::GetNumberOfWriterThreads() const {
+    return numberOfWriterThreads;
+}
+
+uint32 MDSWriter::GetNumberOfSegmentBuffers() const {
+    return numberOfSegmentBuffers;
+}
+
+uint32 MDSWriter::GetNodeWriterThread(const uint32 nodeIdx) const {
+    uint32 writerThread = 0u;
+    if ((nodeWriterThread != NULL_PTR(uint32 *)) && (nodeIdx < numberOfMDSSignals)) {
+        writerThread = nodeWriterThread[nodeIdx];
+    }
+    return writerThread;
+}
+
 const ProcessorType& MDSWriter::GetCPUMask() const {
     return cpuMask;
 }
@@ -806,5 +1155,6 @@ void MDSWriter::Purge(ReferenceContainer &purgeList) {
 CLASS_REGISTER(MDSWriter, "1.0")
 CLASS_METHOD_REGISTER(MDSWriter, FlushSegments)
 CLASS_METHOD_REGISTER(MDSWriter, OpenTree)
+CLASS_METHOD_REGISTER(MDSWriter, GetWriterStatistics)
 
 }
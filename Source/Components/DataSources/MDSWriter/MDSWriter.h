@@ -31,13 +31,19 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "AsyncStartup.h"
 #include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "HeapI.h"
 #include "MDSWriterNode.h"
 #include "MemoryMapAsyncOutputBroker.h"
 #include "MemoryMapAsyncTriggerOutputBroker.h"
 #include "MessageI.h"
+#include "MultiThreadService.h"
 #include "ProcessorType.h"
 #include "RegisteredMethodsMessageFilter.h"
+#include "ThreadPlacement.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -51,7 +57,13 @@ namespace MARTe {
  * asynchronously flushed to the MDSplus database in the context of a separate thread.
  * This circular buffer can either be continuously stored or stored only when a given event occurs (see StoreOnTrigger below).
  *
- * This DataSourceI has the functions FlushSegments and OpenTree registered as an RPC.
+ * If NumberOfWriterThreads > 0 the segments are not written into MDSplus by the thread of the broker. Each MDSWriterNode queues its complete
+ * segments (up to NumberOfSegmentBuffers, see MDSWriterNode) and the segments are written by a pool of NumberOfWriterThreads threads (a MultiThreadService).
+ * Each writer thread serves a group of nodes (set with WriterThread for each signal, by default the nodes are distributed round-robin) and opens its
+ * own MDSplus::Tree of the pulse, so that a slow or large node only delays the nodes of its group. The thread of the broker only blocks when all the
+ * segment buffers of a node are queued. The backlog and the makeSegment latency of each node can be queried with the GetWriterStatistics RPC.
+ *
+ * This DataSourceI has the functions FlushSegments, OpenTree and GetWriterStatistics registered as an RPC.
  *
  * The configuration syntax is (names are only given as an example):
  *
@@ -59,8 +71,13 @@ namespace MARTe {
  * +MDSWriter_0 = {
  *     Class = MDSWriter
  *     NumberOfBuffers = 10 //Compulsory. Number of buffers in the circular buffer defined above. Each buffer is capable of holding a copy of all the DataSourceI signals.
+ *     HeapName = "HugePageHeap" //Optional. Name of the heap (e.g. a HugePageHeap) where the signal memory is allocated. Default = GlobalObjectsDatabase::Instance()->GetStandardHeap().
  *     CPUMask = 15 //Compulsory. Affinity assigned to the threads responsible for asynchronously flush data into the MDSplus database.
  *     StackSize = 10000000 //Compulsory. Stack size of the thread above.
+ *     ThreadPlacement = { //Optional. See ThreadPlacement. Overrides the CPUMask above, sets the priority of the writer threads and binds the signal memory to a NUMA node.
+ *         NUMANode = 0
+ *         PriorityClass = NormalPriorityClass
+ *     }
  *     TreeName = "mds_m2test" //Compulsory. Name of the MDSplus tree.
  *     PulseNumber = 1 //Optional. If -1 a new pulse will be created and the MDSplus pulse number incremented.
  *     StoreOnTrigger = 1 //Compulsory. If 0 all the data in the circular buffer is continuously stored. If 1 data is stored when the Trigger signal is 1 (see below).
@@ -68,6 +85,8 @@ namespace MARTe {
  *     TimeRefresh = 5 //Compulsory. An event with the name set in the property EventName is sent to jScope when TimeRefresh seconds have elapsed.
  *     NumberOfPreTriggers = 2 //Compulsory iff StoreOnTrigger = 1.  Number of cycles to store before the trigger.
  *     NumberOfPostTriggers = 1 //Compulsory iff StoreOnTrigger = 1.  Number of cycles to store after the trigger.
+ *     NumberOfWriterThreads = 4 //Optional. Number of threads which write the segments into MDSplus (with the CPUMask and StackSize above). Default = 0 (the segments are written by the thread of the broker).
+ *     NumberOfSegmentBuffers = 4 //Optional. Only meaningful if NumberOfWriterThreads > 0. Number of segments (> 1) that each node can queue. Default = 4.
  *
  *     Signals = {
  *         Trigger = { //Compulsory when StoreOnTrigger = 1. Must be set in index 0 of the Signals node. When the value of this signal is 1 data will be stored.
@@ -88,6 +107,10 @@ namespace MARTe {
  *             SamplePhase = 0 //Optional. Shift the time vector by SamplePhase * Period
  *             DiscontinuityFactor = 0. //Optional. A discontinuity is considered if the delta between two consecutive samples is greater than T+DiscontinuityFactor*T (where T is the nominal period) or
  *                                                  minor than max(T-DiscontinuityFactor*T, 0). If a discontinuity is detected, the samples will be flushed and a new segment created for the next ones.
+ *             Compression = 1 //Optional. If 1 the segments of this node are compressed by MDSplus when they are written (i.e. by the writer thread if NumberOfWriterThreads > 0, otherwise by the thread of the broker, never by the real-time thread). Default = 0.
+ *             SegmentStreaming = 1 //Optional. Only meaningful if AutomaticSegmentation = 0. If 1 each segment is preallocated (beginSegment) and the samples are appended at every write (putSegment). With a TimeSignal a discontinuity ends the segment and the next one starts at the time of the discontinuous sample. These nodes are written by the thread of the broker. Default = 0.
+ *             TimeDimension = "Range" //Optional. Only meaningful if AutomaticSegmentation = 1. "Explicit" stores the time of each row (putRow). "Range" appends the rows to streamed segments (as SegmentStreaming = 1, MakeSegmentAfterNWrites is then compulsory) whose time dimension is a start/period Range, so that an explicit time is only stored at each discontinuity. Default = "Explicit".
+ *             WriterThread = 1 //Optional. Only meaningful if NumberOfWriterThreads > 0. Index (< NumberOfWriterThreads) of the thread which writes the segments of this node. Default = node index % NumberOfWriterThreads.
  *         }
  *         ...
  *     }
@@ -115,7 +138,7 @@ namespace MARTe {
  * }
  * </pre>
  */
-class MDSWriter: public DataSourceI, public MessageI {
+class MDSWriter: public DataSourceI, public MessageI, public EmbeddedServiceMethodBinderI, public AsyncStartupTaskI {
 public:
     CLASS_REGISTER_DECLARATION()
 
@@ -133,8 +156,8 @@ MDSWriter    ();
     virtual ~MDSWriter();
 
     /**
-     * @brief See DataSourceI::AllocateMemory. NOOP.
-     * @return true.
+     * @brief See DataSourceI::AllocateMemory. Waits for the tree opened by SetConfiguredDatabase.
+     * @return true if the tree (when PulseNumber is defined) was successfully opened.
      */
     virtual bool AllocateMemory();
 
@@ -182,10 +205,18 @@ MDSWriter    ();
 
     /**
      * @brief Calls Execute on all the MDSWriterNodes and, if sufficient time has elapsed, issues an MDSplus::Event.
-     * @return true if the MDSWriterNode::Execute returns true on all the nodes.
+     * @details If NumberOfWriterThreads > 0 wakes the writer threads of the nodes which have queued segments.
+     * @return true if the MDSWriterNode::Execute returns true on all the nodes and if no writer thread failed to write a segment.
      */
     virtual bool Synchronise();
 
+    /**
+     * @brief Writer thread callback (see NumberOfWriterThreads). Writes the queued segments of the nodes of the thread (see MDSWriterNode::WriteQueuedSegments).
+     * @param[in] info the thread number identifies the group of nodes.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo & info);
+
     /**
      * @brief See DataSourceI::PrepareNextState. NOOP.
      * @return true.
@@ -208,7 +239,9 @@ MDSWriter    ();
      * - If relevant, the Time signal shall have type uint32
      * - The number of samples of all the MDS signals is one.
      * - At least one MDS plus signal (apart from the eventual Trigger and Time signal) is set.
-     * @return true if all the parameters are valid and, when PulseNumber is defined, if an MDSplus Tree can be successfully opened.
+     * When PulseNumber is defined, the MDSplus Tree is opened by a separate thread (see AsyncStartup), so that the trees (and the
+     * connections of the other DataSources) are opened in parallel. AllocateMemory waits for the tree to be opened.
+     * @return true if all the parameters are valid and, when PulseNumber is defined, if the thread which opens the tree was started.
      */
     virtual bool SetConfiguredDatabase(StructuredDataI & data);
 
@@ -219,6 +252,17 @@ MDSWriter    ();
      */
     ErrorManagement::ErrorType FlushSegments();
 
+    /**
+     * @brief Gets the statistics of the segments written by each node. Function is registered as an RPC.
+     * @details Writes in the StructuredDataI: NumberOfWriterThreads and, for each node n, a node Noden with: NodeName, WriterThread,
+     * Backlog (number of segments queued), MaxBacklog, NumberOfQueueFull (number of times that Synchronise had to wait for a free segment buffer),
+     * NumberOfSegments, LastSegmentLatency and MaxSegmentLatency (duration of the makeSegment, or of the putRow of a segment, in microseconds).
+     * The values are read while they are being updated by the writer threads.
+     * @param[in] message the first element shall be a ReferenceT<StructuredDataI> where the statistics are written.
+     * @return ErrorManagement::NoError if the statistics can be written in the first element of message.
+     */
+    ErrorManagement::ErrorType GetWriterStatistics(ReferenceContainer &message);
+
     /**
      * @brief Opens a new MDSplus tree.
      * @param[in] pulseNumberIn the MDSplus pulse number. If -1 a new pulse number will be created.
@@ -226,6 +270,12 @@ MDSWriter    ();
      */
     ErrorManagement::ErrorType OpenTree(int32 pulseNumberIn);
 
+    /**
+     * @brief Opens the tree of the PulseNumber. Called by the startup thread (see SetConfiguredDatabase).
+     * @return true if the tree was successfully opened.
+     */
+    virtual bool ExecuteStartup();
+
     /**
      * @brief Gets the affinity of the thread which is going to be used to asynchronously store the data in the MDS plus database.
      * @return the affinity of the thread which is going to be used to asynchronously store the data in the MDS database.
@@ -292,6 +342,25 @@ MDSWriter    ();
      */
     bool IsStoreOnTrigger() const;
 
+    /**
+     * @brief Gets the number of threads which write the segments into MDSplus.
+     * @return the number of threads which write the segments into MDSplus (0 if the segments are written by the thread of the broker).
+     */
+    uint32 GetNumberOfWriterThreads() const;
+
+    /**
+     * @brief Gets the number of segments that each node can queue.
+     * @return the number of segments that each node can queue.
+     */
+    uint32 GetNumberOfSegmentBuffers() const;
+
+    /**
+     * @brief Gets the index of the writer thread of a node.
+     * @param[in] nodeIdx the index of the node (< GetNumberOfMdsSignals()).
+     * @return the index of the writer thread of the node.
+     */
+    uint32 GetNodeWriterThread(const uint32 nodeIdx) const;
+
     /**
      * @brief Returns the index of the signal which is going to provide the time if the data is based on an external trigger.
      * @return the index of the signal which is going to provide the time if the data is based on an external trigger.
@@ -305,6 +374,26 @@ MDSWriter    ();
 
 private:
 
+    /**
+     * @brief Opens a new MDSplus tree (see OpenTree).
+     */
+    ErrorManagement::ErrorType OpenPulse(const int32 pulseNumberIn);
+
+    /**
+     * Opens the tree of the PulseNumber at startup.
+     */
+    AsyncStartup startup;
+
+    /**
+     * @brief Sends the TreeRuntimeError message (if set).
+     */
+    void SendTreeRuntimeError();
+
+    /**
+     * @brief Closes the MDSplus trees of the writer threads.
+     */
+    void DeleteWriterTrees();
+
     /**
      * CPU count at which the last MDS plus event was fired.
      */
@@ -365,11 +454,21 @@ private:
      */
     char8 *dataSourceMemory;
 
+    /**
+     * The heap where the signal memory is allocated (see HeapName).
+     */
+    HeapI *memoryHeap;
+
     /**
      * The affinity of the thread that asynchronously flushes data into MDSplus.
      */
     ProcessorType cpuMask;
 
+    /**
+     * The CPU, priority and NUMA placement of the writer threads and of the signal memory.
+     */
+    ThreadPlacement placement;
+
     /**
      * The size of the stack of the thread that asynchronously flushes data into MDSplus.
      */
@@ -434,6 +533,46 @@ private:
      * The message to send if there is a runtime error.
      */
     ReferenceT<Message> treeRuntimeErrorMsg;
+
+    /**
+     * Number of threads which write the segments into MDSplus.
+     */
+    uint32 numberOfWriterThreads;
+
+    /**
+     * Number of segments that each node can queue (if numberOfWriterThreads > 0).
+     */
+    uint32 numberOfSegmentBuffers;
+
+    /**
+     * The index of the writer thread of each node.
+     */
+    uint32 *nodeWriterThread;
+
+    /**
+     * The MDSplus tree opened by each writer thread.
+     */
+    MDSplus::Tree **writerTrees;
+
+    /**
+     * Posted to wake each writer thread when its nodes have queued segments.
+     */
+    EventSem *writerSems;
+
+    /**
+     * Set by Synchronise for each writer thread which has to be woken.
+     */
+    bool *writerWake;
+
+    /**
+     * Set by a writer thread if a segment could not be written.
+     */
+    volatile bool writerError;
+
+    /**
+     * The writer threads.
+     */
+    MultiThreadService writerService;
 };
 }
 
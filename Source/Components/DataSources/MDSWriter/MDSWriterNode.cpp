@@ -29,6 +29,8 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
 #include "MDSWriterNode.h"
 
 /*---------------------------------------------------------------------------*/
@@ -58,6 +60,23 @@ MDSWriterNode::MDSWriterNode() {
     typeMultiplier = 0u;
 
     bufferedData = NULL_PTR(char8*);
+    segmentBuffers = NULL_PTR(char8*);
+    segmentBufferSize = 0u;
+    numberOfSegmentBuffers = 1u;
+    segmentStreaming = false;
+    compression = false;
+    segments = NULL_PTR(MDSWriterNodeSegment*);
+    fillIndex = 0u;
+    writeIndex = 0u;
+    backlog = 0;
+    maxBacklog = 0u;
+    numberOfQueueFull = 0u;
+    numberOfSegments = 0u;
+    lastSegmentLatency = 0u;
+    maxSegmentLatency = 0u;
+    if (!segmentWrittenSem.Create()) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not create the EventSem");
+    }
     currentBuffer = 0u;
     makeSegmentAfterNWrites = 0u;
     minMaxResampleFactor = 0;
@@ -90,9 +109,13 @@ MDSWriterNode::~MDSWriterNode() {
         //TODO check if the node should be deleted, or if this is done by the tree...
         delete decimatedNode;
     }
-    if (bufferedData != NULL_PTR(void*)) {
-        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(bufferedData));
+    if (segmentBuffers != NULL_PTR(char8*)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(segmentBuffers));
+    }
+    if (segments != NULL_PTR(MDSWriterNodeSegment*)) {
+        delete[] segments;
     }
+    (void) segmentWrittenSem.Close();
 }
 
 bool MDSWriterNode::Initialise(StructuredDataI &data) {
@@ -119,8 +142,28 @@ bool MDSWriterNode::Initialise(StructuredDataI &data) {
             }
         }
     }
+    //AutomaticSegmentation with TimeDimension = Range appends the rows to streamed Range segments instead of putRow
+    bool rangeRows = false;
     if (ok) {
-        if (!automaticSegmentation) {
+        StreamString timeDimension;
+        if (data.Read("TimeDimension", timeDimension)) {
+            if (timeDimension == "Range") {
+                rangeRows = automaticSegmentation;
+            }
+            else if (timeDimension != "Explicit") {
+                REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "TimeDimension must be Explicit or Range");
+                ok = false;
+            }
+            else {
+                //NOOP
+            }
+        }
+        if (rangeRows) {
+            automaticSegmentation = false;
+        }
+    }
+    if (ok) {
+        if ((!automaticSegmentation) && (!rangeRows)) {
             if (data.Read("DecimatedNodeName", decimatedNodeName)) {
                 decimatedMinMax = true;
                 ok = (data.Read("MinMaxResampleFactor", minMaxResampleFactor));
@@ -274,6 +317,42 @@ bool MDSWriterNode::Initialise(StructuredDataI &data) {
             REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "MakeSegmentAfterNWrites shall be > 0");
         }
     }
+    if (ok) {
+        if (!data.Read("NumberOfSegmentBuffers", numberOfSegmentBuffers)) {
+            numberOfSegmentBuffers = 1u;
+        }
+        ok = (numberOfSegmentBuffers > 0u);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "NumberOfSegmentBuffers shall be > 0");
+        }
+    }
+    if (ok) {
+        uint32 segmentStreamingU = 0u;
+        if (data.Read("SegmentStreaming", segmentStreamingU)) {
+            ok = (segmentStreamingU <= 1u);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "SegmentStreaming must be 0 (false) or 1 (true)");
+            }
+        }
+        segmentStreaming = ((segmentStreamingU == 1u) || (rangeRows));
+        if ((ok) && (segmentStreaming)) {
+            ok = ((!automaticSegmentation) && (!decimatedMinMax) && (numberOfSegmentBuffers == 1u));
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError,
+                                    "SegmentStreaming requires AutomaticSegmentation = 0, no DecimatedNodeName and NumberOfSegmentBuffers = 1");
+            }
+        }
+    }
+    if (ok) {
+        uint32 compressionU = 0u;
+        if (data.Read("Compression", compressionU)) {
+            ok = (compressionU <= 1u);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Compression must be 0 (false) or 1 (true)");
+            }
+        }
+        compression = (compressionU == 1u);
+    }
     if (ok) {
         if ((nodeType == DTYPE_B) || (nodeType == DTYPE_BU)) {
             typeMultiplier = sizeof(uint8);
@@ -297,10 +376,16 @@ bool MDSWriterNode::Initialise(StructuredDataI &data) {
             //A wrong type is already trapped before...
         }
 
-        uint32 bufferedDataSize = static_cast<uint32>(typeMultiplier);
-        bufferedDataSize *= numberOfElements * makeSegmentAfterNWrites * numberOfSamples;
+        segmentBufferSize = static_cast<uint32>(typeMultiplier);
+        segmentBufferSize *= numberOfElements * makeSegmentAfterNWrites * numberOfSamples;
 
-        bufferedData = reinterpret_cast<char8*>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(bufferedDataSize));
+        segmentBuffers = reinterpret_cast<char8*>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(segmentBufferSize * numberOfSegmentBuffers));
+        segments = new MDSWriterNodeSegment[numberOfSegmentBuffers];
+        bufferedData = segmentBuffers;
+        if ((segmentStreaming) && (segmentBuffers != NULL_PTR(char8*))) {
+            //Used to preallocate the rows of each segment
+            ok = MemoryOperationsHelper::Set(segmentBuffers, '\0', segmentBufferSize);
+        }
     }
     return ok;
 }
@@ -316,6 +401,10 @@ bool MDSWriterNode::AllocateTreeNode(MDSplus::Tree *const tree) {
         if (ok) {
             node = tree->getNode(nodeName.Buffer());
             node->deleteData();
+            if (compression) {
+                //The segments are compressed by MDSplus when they are written (i.e. by the thread which calls Execute or WriteQueuedSegments)
+                node->setCompressSegments(true);
+            }
         }
     }
     catch (const MDSplus::MdsException &exc) {
@@ -339,6 +428,10 @@ bool MDSWriterNode::AllocateTreeNode(MDSplus::Tree *const tree) {
         }
     }
     start = static_cast<float64>(phaseShift) * period;
+    if (segmentStreaming) {
+        //The segment being streamed belonged to the previous node
+        currentBuffer = 0u;
+    }
     return ok;
 }
 
@@ -389,7 +482,18 @@ bool MDSWriterNode::Execute() {
         //If data is continuous store in the shared buffer that will be flushed as part of the next segment.
         //If data is not continuous this will trigger the creation of a new segment and this signal data will be added to the beginning of the next segment.
         if (!discontinuityFound) {
-            if (currentBuffer < makeSegmentAfterNWrites) {
+            if ((segmentStreaming) && (currentBuffer < makeSegmentAfterNWrites)) {
+                if (currentBuffer == 0u) {
+                    ok = BeginStreamingSegment();
+                }
+                if (ok) {
+                    ok = PutStreamingSamples();
+                }
+                if (ok) {
+                    currentBuffer++;
+                }
+            }
+            else if (currentBuffer < makeSegmentAfterNWrites) {
                 if ((signalMemory != NULL_PTR(uint32 *)) && (bufferedData != NULL_PTR(void *))) {
                     uint32 signalIdx = currentBuffer * numberOfSamples * numberOfElements * static_cast<uint32>(typeMultiplier);
                     char8 *bufferedDataC = reinterpret_cast<char8*>(bufferedData);
@@ -403,6 +507,9 @@ bool MDSWriterNode::Execute() {
                     currentBuffer++;
                 }
             }
+            else {
+                //NOOP
+            }
         }
     }
 
@@ -426,11 +533,19 @@ bool MDSWriterNode::Execute() {
     }
     //Sufficient data to make a segment
     if ((ok) && (storeNow)) {
-        if (automaticSegmentation) {
-            ok = AddDataToSegment();
+        if (segmentStreaming) {
+            ok = EndStreamingSegment();
         }
         else {
-            ok = ForceSegment();
+            /*lint -e{613} segments cannot be NULL if node != NULL*/
+            PrepareSegment(segments[fillIndex]);
+            if (numberOfSegmentBuffers > 1u) {
+                ok = QueueSegment();
+            }
+            else {
+                /*lint -e{613} segments cannot be NULL if node != NULL*/
+                ok = WriteSegment(segments[0u], bufferedData);
+            }
         }
         nOfExecuteCalls++;
 
@@ -442,19 +557,29 @@ bool MDSWriterNode::Execute() {
                     lastWriteTimeSignal = timeSignalTime;
                 }
             }
-            if ((signalMemory != NULL_PTR(uint32 *)) && (bufferedData != NULL_PTR(void *))) {
+            if (timeSignalMemory != NULL_PTR(uint32 *)) {
+                //Update the start
+                start = static_cast<float64>(timeSignalTime) * timeSignalMultiplier;
+                start += static_cast<float64>(phaseShift) * period;
+            }
+            if (segmentStreaming) {
+                //The discontinuous sample is the first of a new Range segment (the only explicit time of the run)
+                ok = BeginStreamingSegment();
+                if (ok) {
+                    ok = PutStreamingSamples();
+                }
+            }
+            else if ((signalMemory != NULL_PTR(uint32 *)) && (bufferedData != NULL_PTR(void *))) {
                 //currentBuffer had already been incremented. Copy the last buffer to the beginning
                 char8 *bufferedDataC = reinterpret_cast<char8*>(bufferedData);
                 ok = MemoryOperationsHelper::Copy(&bufferedDataC[0u], signalMemory, numberOfSamples * numberOfElements * static_cast<uint32>(typeMultiplier));
             }
+            else {
+                //NOOP
+            }
             if (ok) {
                 currentBuffer = 1u;
             }
-            if (timeSignalMemory != NULL_PTR(uint32 *)) {
-                //Update the start
-                start = static_cast<float64>(timeSignalTime) * timeSignalMultiplier;
-                start += static_cast<float64>(phaseShift) * period;
-            }
         }
         else {
             currentBuffer = 0u;
@@ -463,78 +588,265 @@ bool MDSWriterNode::Execute() {
     return ok;
 }
 
-//lint -e{429} startD, endD, dimension are freed by MDSplus upon deletion of dimension
-bool MDSWriterNode::ForceSegment() {
-    bool ok = true;
+void MDSWriterNode::PrepareSegment(MDSWriterNodeSegment &segment) {
     //Notice that currentBuffer is not incremented if a discontinuity is found
-    int32 numberOfSamplesPerSegment = static_cast<int32>(numberOfSamples) * static_cast<int32>(currentBuffer);
-    segmentDim[0] = numberOfSamplesPerSegment;
-    int32 numberOfSamplesPerSegmentM1 = numberOfSamplesPerSegment - 1;
-    float64 numberOfSamplesPerSegmentF = static_cast<float64>(numberOfSamplesPerSegmentM1);
-    float64 end = 0.;
-    float64 newPeriod = period;
-    if (!useTimeVector) {
-        end = start + (numberOfSamplesPerSegmentF * period);
+    uint32 numberOfSamplesPerSegmentU = numberOfSamples * currentBuffer;
+    segment.numberOfSamples = numberOfSamplesPerSegmentU;
+    segment.start = start;
+    segment.period = period;
+    if (automaticSegmentation) {
+        if (!useTimeVector) {
+            uint32 i;
+            for (i = 0u; i < numberOfSamplesPerSegmentU; i++) {
+                start += period;
+            }
+        }
+        segment.end = start;
     }
     else {
-        end = static_cast<float64>(lastWriteTimeSignal) * timeSignalMultiplier;
-        float64 periodDelta = period;
-        uint32 numberOfSamplesM1 = numberOfSamples - 1u;
-        periodDelta *= static_cast<float64>(numberOfSamplesM1);
-        end += periodDelta;
-        if (!IsEqual(end, start)) {
-            if (numberOfSamplesPerSegmentF > 0.) {
-                newPeriod = (end - start) / numberOfSamplesPerSegmentF;
+        int32 numberOfSamplesPerSegment = static_cast<int32>(numberOfSamplesPerSegmentU);
+        int32 numberOfSamplesPerSegmentM1 = numberOfSamplesPerSegment - 1;
+        float64 numberOfSamplesPerSegmentF = static_cast<float64>(numberOfSamplesPerSegmentM1);
+        float64 end = 0.;
+        float64 newPeriod = period;
+        if (!useTimeVector) {
+            end = start + (numberOfSamplesPerSegmentF * period);
+        }
+        else {
+            end = static_cast<float64>(lastWriteTimeSignal) * timeSignalMultiplier;
+            float64 periodDelta = period;
+            uint32 numberOfSamplesM1 = numberOfSamples - 1u;
+            periodDelta *= static_cast<float64>(numberOfSamplesM1);
+            end += periodDelta;
+            if (!IsEqual(end, start)) {
+                if (numberOfSamplesPerSegmentF > 0.) {
+                    newPeriod = (end - start) / numberOfSamplesPerSegmentF;
+                }
             }
         }
+        segment.end = end;
+        segment.period = newPeriod;
+        if (!useTimeVector) {
+            start += static_cast<float64>(numberOfSamplesPerSegment) * newPeriod;
+        }
+    }
+}
+
+bool MDSWriterNode::QueueSegment() {
+    //Atomic::Increment is a full memory barrier: the writer thread sees the segment before the new backlog
+    Atomic::Increment(&backlog);
+    uint32 currentBacklog = static_cast<uint32>(backlog);
+    if (currentBacklog > maxBacklog) {
+        maxBacklog = currentBacklog;
+    }
+    if (currentBacklog >= numberOfSegmentBuffers) {
+        numberOfQueueFull++;
     }
+    fillIndex++;
+    if (fillIndex == numberOfSegmentBuffers) {
+        fillIndex = 0u;
+    }
+    bool ok = WaitQueuedSegments(numberOfSegmentBuffers - 1u);
+    /*lint -e{613} segmentBuffers cannot be NULL if node != NULL*/
+    bufferedData = &segmentBuffers[fillIndex * segmentBufferSize];
+    return ok;
+}
+
+bool MDSWriterNode::WaitQueuedSegments(const uint32 maxBacklogIn) {
+    bool ok = true;
+    while ((ok) && (static_cast<uint32>(backlog) > maxBacklogIn)) {
+        (void) segmentWrittenSem.Reset();
+        if (static_cast<uint32>(backlog) > maxBacklogIn) {
+            ok = (segmentWrittenSem.Wait(MDS_WRITER_NODE_WAIT_TIMEOUT_MSEC) == ErrorManagement::NoError);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "No segment of the node %s was written in %u ms", nodeName.Buffer(), MDS_WRITER_NODE_WAIT_TIMEOUT_MSEC);
+            }
+        }
+    }
+    return ok;
+}
+
+bool MDSWriterNode::WriteQueuedSegments() {
+    bool ok = true;
+    while (backlog > 0) {
+        if (ok) {
+            /*lint -e{613} segments and segmentBuffers cannot be NULL if segments were queued*/
+            ok = WriteSegment(segments[writeIndex], &segmentBuffers[writeIndex * segmentBufferSize]);
+        }
+        //On error the segment is discarded so that Execute never blocks
+        writeIndex++;
+        if (writeIndex == numberOfSegmentBuffers) {
+            writeIndex = 0u;
+        }
+        Atomic::Decrement(&backlog);
+        (void) segmentWrittenSem.Post();
+    }
+    return ok;
+}
+
+bool MDSWriterNode::WriteSegment(const MDSWriterNodeSegment &segment, void * const data) {
+    uint64 startCounter = HighResolutionTimer::Counter();
+    bool ok = false;
+    if (automaticSegmentation) {
+        ok = AddDataToSegment(segment, data);
+    }
+    else {
+        ok = ForceSegment(segment, data);
+    }
+    float64 latencyF = static_cast<float64>(HighResolutionTimer::Counter() - startCounter) * HighResolutionTimer::Period() * 1e6;
+    lastSegmentLatency = static_cast<uint64>(latencyF);
+    if (lastSegmentLatency > maxSegmentLatency) {
+        maxSegmentLatency = lastSegmentLatency;
+    }
+    numberOfSegments++;
+    return ok;
+}
+
+//lint -e{429} startD, endD, dimension are freed by MDSplus upon deletion of dimension
+bool MDSWriterNode::BeginStreamingSegment() {
+    bool ok = true;
+    //The time dimension of the whole segment is assumed continuous from start. With a time signal a discontinuity ends the segment (see EndStreamingSegment)
+    float64 numberOfSamplesPerSegmentM1 = static_cast<float64>(segmentDim[0] - 1);
+    float64 end = start + (numberOfSamplesPerSegmentM1 * period);
     //lint -e{429} freed by MDSplus upon deletion of dimension
     MDSplus::Data *startD = new MDSplus::Float64(start);
     //lint -e{429} freed by MDSplus upon deletion of dimension
     MDSplus::Data *endD = new MDSplus::Float64(end);
-
     //lint -e{429} freed by MDSplus upon deletion of dimension
-    MDSplus::Data *dimension = new MDSplus::Range(startD, endD, new MDSplus::Float64(newPeriod));
+    MDSplus::Data *dimension = new MDSplus::Range(startD, endD, new MDSplus::Float64(period));
+    //The buffer is never written in streaming mode, so that the segment is preallocated with zeros
     //lint -e{429} freed by MDSplus upon deletion of array
-    MDSplus::Array *array = NULL_PTR(MDSplus::Array*);
+    MDSplus::Array *array = CreateArray(bufferedData, &segmentDim[0]);
+    if (array != NULL_PTR(MDSplus::Array*)) {
+        //lint -e{613} node is checked not to be null in the beginning of Execute
+        try {
+            node->beginSegment(startD, endD, dimension, array);
+        }
+        catch (const MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed beginSegment Error: %s", exc.what());
+            ok = false;
+        }
+        MDSplus::deleteData(array);
+    }
+    MDSplus::deleteData(dimension);
+    return ok;
+}
+
+bool MDSWriterNode::PutStreamingSamples() {
+    bool ok = (signalMemory != NULL_PTR(void *));
+    if (ok) {
+        uint64 startCounter = HighResolutionTimer::Counter();
+        int32 dims[3];
+        dims[0] = static_cast<int32>(numberOfSamples);
+        dims[1] = segmentDim[1];
+        dims[2] = segmentDim[2];
+        //lint -e{429} freed by MDSplus::deleteData
+        MDSplus::Array *array = CreateArray(signalMemory, &dims[0]);
+        ok = (array != NULL_PTR(MDSplus::Array*));
+        if (ok) {
+            //lint -e{613} node is checked not to be null in the beginning of Execute
+            try {
+                //Append after the last row written
+                node->putSegment(array, -1);
+            }
+            catch (const MDSplus::MdsException &exc) {
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed putSegment Error: %s", exc.what());
+                ok = false;
+            }
+            MDSplus::deleteData(array);
+        }
+        float64 latencyF = static_cast<float64>(HighResolutionTimer::Counter() - startCounter) * HighResolutionTimer::Period() * 1e6;
+        lastSegmentLatency = static_cast<uint64>(latencyF);
+        if (lastSegmentLatency > maxSegmentLatency) {
+            maxSegmentLatency = lastSegmentLatency;
+        }
+    }
+    return ok;
+}
 
-    if (!useTimeVector) {
-        start += static_cast<float64>(numberOfSamplesPerSegment) * newPeriod;
+//lint -e{429} startD, endD, dimension are freed by MDSplus upon deletion of dimension
+bool MDSWriterNode::EndStreamingSegment() {
+    bool ok = true;
+    int32 numberOfSamplesPerSegment = static_cast<int32>(numberOfSamples) * static_cast<int32>(currentBuffer);
+    //A flushed segment is not complete: the time dimension is truncated to the samples which were written
+    if (numberOfSamplesPerSegment < segmentDim[0]) {
+        float64 numberOfSamplesPerSegmentM1 = static_cast<float64>(numberOfSamplesPerSegment - 1);
+        //lint -e{429} freed by MDSplus upon deletion of dimension
+        MDSplus::Data *startD = new MDSplus::Float64(start);
+        //lint -e{429} freed by MDSplus upon deletion of dimension
+        MDSplus::Data *endD = new MDSplus::Float64(start + (numberOfSamplesPerSegmentM1 * period));
+        //lint -e{429} freed by MDSplus upon deletion of dimension
+        MDSplus::Data *dimension = new MDSplus::Range(startD, endD, new MDSplus::Float64(period));
+        //lint -e{613} node is checked not to be null in the beginning of Execute
+        try {
+            node->updateSegment(startD, endD, dimension);
+        }
+        catch (const MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed updateSegment Error: %s", exc.what());
+            ok = false;
+        }
+        MDSplus::deleteData(dimension);
     }
+    start += static_cast<float64>(numberOfSamplesPerSegment) * period;
+    numberOfSegments++;
+    return ok;
+}
+
+//lint -e{429} the array is freed by the caller with MDSplus::deleteData
+MDSplus::Array *MDSWriterNode::CreateArray(void * const data, int32 * const dims) const {
+    MDSplus::Array *array = NULL_PTR(MDSplus::Array*);
     if (nodeType == DTYPE_B) {
-        array = new MDSplus::Int8Array(reinterpret_cast<char8*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Int8Array(reinterpret_cast<char8*>(data), 2, dims);
     }
     else if (nodeType == DTYPE_BU) {
-        array = new MDSplus::Uint8Array(reinterpret_cast<uint8*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Uint8Array(reinterpret_cast<uint8*>(data), 2, dims);
     }
     else if (nodeType == DTYPE_W) {
-        array = new MDSplus::Int16Array(reinterpret_cast<int16*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Int16Array(reinterpret_cast<int16*>(data), 2, dims);
     }
     else if (nodeType == DTYPE_WU) {
-        array = new MDSplus::Uint16Array(reinterpret_cast<uint16*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Uint16Array(reinterpret_cast<uint16*>(data), 2, dims);
     }
     else if (nodeType == DTYPE_L) {
-        array = new MDSplus::Int32Array(reinterpret_cast<int32*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Int32Array(reinterpret_cast<int32*>(data), 2, dims);
     }
     else if (nodeType == DTYPE_LU) {
-        array = new MDSplus::Uint32Array(reinterpret_cast<uint32*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Uint32Array(reinterpret_cast<uint32*>(data), 2, dims);
     }
     else if (nodeType == DTYPE_Q) {
-        array = new MDSplus::Int64Array(reinterpret_cast<int64_t*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Int64Array(reinterpret_cast<int64_t*>(data), 2, dims);
     }
     else if (nodeType == DTYPE_QU) {
-        array = new MDSplus::Uint64Array(reinterpret_cast<uint64_t*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Uint64Array(reinterpret_cast<uint64_t*>(data), 2, dims);
     }
     else if (nodeType == DTYPE_FLOAT) {
-        array = new MDSplus::Float32Array(reinterpret_cast<float32*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Float32Array(reinterpret_cast<float32*>(data), 2, dims);
     }
     else if (nodeType == DTYPE_DOUBLE) {
-        array = new MDSplus::Float64Array(reinterpret_cast<float64*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Float64Array(reinterpret_cast<float64*>(data), 2, dims);
     }
     else {
         //An invalid nodeType is trapped before.
     }
+    return array;
+}
+
+//lint -e{429} startD, endD, dimension are freed by MDSplus upon deletion of dimension
+bool MDSWriterNode::ForceSegment(const MDSWriterNodeSegment &segment, void * const data) {
+    bool ok = true;
+    int32 dims[3];
+    dims[0] = static_cast<int32>(segment.numberOfSamples);
+    dims[1] = segmentDim[1];
+    dims[2] = segmentDim[2];
+    //lint -e{429} freed by MDSplus upon deletion of dimension
+    MDSplus::Data *startD = new MDSplus::Float64(segment.start);
+    //lint -e{429} freed by MDSplus upon deletion of dimension
+    MDSplus::Data *endD = new MDSplus::Float64(segment.end);
 
+    //lint -e{429} freed by MDSplus upon deletion of dimension
+    MDSplus::Data *dimension = new MDSplus::Range(startD, endD, new MDSplus::Float64(segment.period));
+    //lint -e{429} freed by MDSplus upon deletion of array
+    MDSplus::Array *array = CreateArray(data, &dims[0]);
     if (array != NULL_PTR(MDSplus::Array*)) {
         if (decimatedMinMax) {
             //lint -e{613} node is checked not to be null in the beginning of the function
@@ -562,51 +874,49 @@ bool MDSWriterNode::ForceSegment() {
     return ok;
 }
 
-/*lint -e{613} -e{429} function only called if bufferedData != NULL. Custodial pointer value freed by mds+*/
-bool MDSWriterNode::AddDataToSegment() {
+/*lint -e{613} -e{429} function only called if data != NULL. Custodial pointer value freed by mds+*/
+bool MDSWriterNode::AddDataToSegment(const MDSWriterNodeSegment &segment, void * const data) {
     bool ok = true;
 
-    //Notice that currentBuffer is not incremented if a discontinuity is found
-    uint32 numberOfSamplesPerSegment = numberOfSamples * currentBuffer;
+    float64 rowTime = segment.start;
     //MDSpluse::putRow() only save one sample at the time
-    segmentDim[0] = 1;
-    for (uint32 i = 0u; i < numberOfSamplesPerSegment; i++) {
-        int64_t auxCurrentTime = static_cast<int64>(start);
+    for (uint32 i = 0u; i < segment.numberOfSamples; i++) {
+        int64_t auxCurrentTime = static_cast<int64>(rowTime);
         if (!useTimeVector) {
-            start += period;
+            rowTime += segment.period;
         }
         if (numberOfElements > 1u) {
             int32 numberElementsInt32 = static_cast<int32>(numberOfElements);
             MDSplus::Array *value = NULL_PTR(MDSplus::Array*);
             if (nodeType == DTYPE_B) {
-                value = new MDSplus::Int8Array(&(reinterpret_cast<char8*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Int8Array(&(reinterpret_cast<char8*>(data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_BU) {
-                value = new MDSplus::Uint8Array(&(reinterpret_cast<uint8*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Uint8Array(&(reinterpret_cast<uint8*>(data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_W) {
-                value = new MDSplus::Int16Array(&(reinterpret_cast<int16*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Int16Array(&(reinterpret_cast<int16*>(data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_WU) {
-                value = new MDSplus::Uint16Array(&(reinterpret_cast<uint16*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Uint16Array(&(reinterpret_cast<uint16*>(data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_L) {
-                value = new MDSplus::Int32Array(&(reinterpret_cast<int32*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Int32Array(&(reinterpret_cast<int32*>(data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_LU) {
-                value = new MDSplus::Uint32Array(&(reinterpret_cast<uint32*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Uint32Array(&(reinterpret_cast<uint32*>(data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_Q) {
-                value = new MDSplus::Int64Array(&(reinterpret_cast<int64_t*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Int64Array(&(reinterpret_cast<int64_t*>(data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_QU) {
-                value = new MDSplus::Uint64Array(&(reinterpret_cast<uint64_t*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Uint64Array(&(reinterpret_cast<uint64_t*>(data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_FLOAT) {
-                value = new MDSplus::Float32Array(&(reinterpret_cast<float32*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Float32Array(&(reinterpret_cast<float32*>(data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_DOUBLE) {
-                value = new MDSplus::Float64Array(&(reinterpret_cast<float64*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Float64Array(&(reinterpret_cast<float64*>(data)[i]), numberElementsInt32);
             }
             else {
                 //An invalid nodeType is trapped before.
@@ -626,34 +936,34 @@ bool MDSWriterNode::AddDataToSegment() {
         else {
             MDSplus::Scalar *value = NULL_PTR(MDSplus::Scalar*);
             if (nodeType == DTYPE_B) {
-                value = new MDSplus::Int8(reinterpret_cast<char8*>(bufferedData)[i]);
+                value = new MDSplus::Int8(reinterpret_cast<char8*>(data)[i]);
             }
             else if (nodeType == DTYPE_BU) {
-                value = new MDSplus::Uint8(reinterpret_cast<uint8*>(bufferedData)[i]);
+                value = new MDSplus::Uint8(reinterpret_cast<uint8*>(data)[i]);
             }
             else if (nodeType == DTYPE_W) {
-                value = new MDSplus::Int16(reinterpret_cast<int16*>(bufferedData)[i]);
+                value = new MDSplus::Int16(reinterpret_cast<int16*>(data)[i]);
             }
             else if (nodeType == DTYPE_WU) {
-                value = new MDSplus::Uint16(reinterpret_cast<uint16*>(bufferedData)[i]);
+                value = new MDSplus::Uint16(reinterpret_cast<uint16*>(data)[i]);
             }
             else if (nodeType == DTYPE_L) {
-                value = new MDSplus::Int32(reinterpret_cast<int32*>(bufferedData)[i]);
+                value = new MDSplus::Int32(reinterpret_cast<int32*>(data)[i]);
             }
             else if (nodeType == DTYPE_LU) {
-                value = new MDSplus::Uint32(reinterpret_cast<uint32*>(bufferedData)[i]);
+                value = new MDSplus::Uint32(reinterpret_cast<uint32*>(data)[i]);
             }
             else if (nodeType == DTYPE_Q) {
-                value = new MDSplus::Int64(reinterpret_cast<int64_t*>(bufferedData)[i]);
+                value = new MDSplus::Int64(reinterpret_cast<int64_t*>(data)[i]);
             }
             else if (nodeType == DTYPE_QU) {
-                value = new MDSplus::Uint64(reinterpret_cast<uint64_t*>(bufferedData)[i]);
+                value = new MDSplus::Uint64(reinterpret_cast<uint64_t*>(data)[i]);
             }
             else if (nodeType == DTYPE_FLOAT) {
-                value = new MDSplus::Float32(reinterpret_cast<float32*>(bufferedData)[i]);
+                value = new MDSplus::Float32(reinterpret_cast<float32*>(data)[i]);
             }
             else if (nodeType == DTYPE_DOUBLE) {
-                value = new MDSplus::Float64(reinterpret_cast<float64*>(bufferedData)[i]);
+                value = new MDSplus::Float64(reinterpret_cast<float64*>(data)[i]);
             }
             else {
                 //An invalid nodeType is trapped before.
@@ -784,4 +1094,40 @@ uint32 MDSWriterNode::GetTypeMultiplier() const {
 bool MDSWriterNode::IsUseTimeVector() const {
     return useTimeVector;
 }
+
+bool MDSWriterNode::IsCompression() const {
+    return compression;
+}
+
+bool MDSWriterNode::IsSegmentStreaming() const {
+    return segmentStreaming;
+}
+
+uint32 MDSWriterNode::GetNumberOfSegmentBuffers() const {
+    return numberOfSegmentBuffers;
+}
+
+uint32 MDSWriterNode::GetBacklog() const {
+    return static_cast<uint32>(backlog);
+}
+
+uint32 MDSWriterNode::GetMaxBacklog() const {
+    return maxBacklog;
+}
+
+uint32 MDSWriterNode::GetNumberOfQueueFull() const {
+    return numberOfQueueFull;
+}
+
+uint64 MDSWriterNode::GetNumberOfSegments() const {
+    return numberOfSegments;
+}
+
+uint64 MDSWriterNode::GetLastSegmentLatency() const {
+    return lastSegmentLatency;
+}
+
+uint64 MDSWriterNode::GetMaxSegmentLatency() const {
+    return maxSegmentLatency;
+}
 }
@@ -34,12 +34,43 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "EventSem.h"
 #include "StreamString.h"
 #include "StructuredDataI.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * Maximum time that Execute (or WaitQueuedSegments) waits for a queued segment to be written.
+ */
+const uint32 MDS_WRITER_NODE_WAIT_TIMEOUT_MSEC = 10000u;
+
+/**
+ * @brief The time information of a segment which is waiting to be written (see MDSWriterNode::WriteQueuedSegments).
+ */
+struct MDSWriterNodeSegment {
+    /**
+     * Time of the first sample of the segment.
+     */
+    float64 start;
+
+    /**
+     * Time of the last sample of the segment.
+     */
+    float64 end;
+
+    /**
+     * Period between the samples of the segment.
+     */
+    float64 period;
+
+    /**
+     * Number of samples in the segment.
+     */
+    uint32 numberOfSamples;
+};
+
 /**
  * @brief Provides an interface between a MARTe signal and an MDSplus::TreeNode.
  * @details This class allocates a shared memory area capable of storing several time samples of a MARTe signal.
@@ -50,6 +81,22 @@ namespace MARTe {
  * A segment will be created when GetNumberOfExecuteCalls() == GetMakeSegmentAfterNWrites() or, in case
  * IsUseTimeVector() == true, when a discontinuity on the time signal is detected, i.e., when the distance between
  *  two time samples is greater than GetExecutePeriod.
+ *
+ * If NumberOfSegmentBuffers > 1 the segments are not written by Execute. Each complete segment buffer is queued (together with its time
+ * information) and Execute continues on the next buffer, while the segments are written into MDS+ by WriteQueuedSegments, which is
+ * expected to be called by a writer thread. Execute only blocks if all the NumberOfSegmentBuffers buffers are queued.
+ *
+ * If SegmentStreaming = 1 the data is not buffered. The first Execute of each segment calls beginSegment with the time dimension of the whole
+ * segment (computed from the Period) and preallocated (zeroed) rows, and each Execute appends its samples with putSegment. This spreads the
+ * I/O cost over all the Execute calls instead of writing the whole segment at once. It is not supported with AutomaticSegmentation,
+ * with a DecimatedNodeName or with NumberOfSegmentBuffers > 1.
+ *
+ * The time dimension of the segments written with makeSegment or beginSegment is always a Range (start, end, period), i.e. only the
+ * start and the period of each continuous run are stored. With a time signal the segment starts at the time of its first sample and a
+ * discontinuity (see DiscontinuityFactor) ends the segment, so that an explicit time is only stored at each discontinuity. With
+ * AutomaticSegmentation = 1 the rows are written with putRow, which stores an explicit (64 bit) time for each row, unless
+ * TimeDimension = Range, in which case the rows are appended to streamed Range segments (as with SegmentStreaming = 1) of
+ * MakeSegmentAfterNWrites writes.
  */
 class MDSWriterNode {
 public:
@@ -90,6 +137,11 @@ public:
      *  - SamplePhase (optional): shift the time vector by SamplePhase * Period
      *  - MakeSegmentAfterNWrites (>0): a segment will be written after MakeSegmentAfterNWrites time samples are available (which in practice means after the Execute method has been called MakeSegmentAfterNWrites)
      *  - MinMaxResampleFactor (>0): the decimation factor to be applied by MDS+ when a DecimatedNodeName is specified
+     *  - NumberOfSegmentBuffers (optional, >0): number of segment buffers. If > 1 the segments are queued and written by WriteQueuedSegments. Default = 1.
+     *  - Compression (optional, 0 or 1): if 1 the segments are compressed by MDSplus (compress segments flag of the node) when they are written. Default = 0.
+     *  - SegmentStreaming (optional, 0 or 1): if 1 each segment is preallocated with beginSegment and the data appended with putSegment. Default = 0.
+     *  - TimeDimension (optional, Explicit or Range): only meaningful if AutomaticSegmentation = 1. If Range the rows are written as with SegmentStreaming = 1
+     *  (and MakeSegmentAfterNWrites is compulsory) instead of with putRow. Default = Explicit.
      * @param data the StructuredDataI with all the parameters described above.
      * @return true if all the parameters above are correctly specified.
      */
@@ -139,6 +191,74 @@ public:
      */
     bool Flush();
 
+    /**
+     * @brief Writes into MDS+ all the segments that were queued by Execute (only if GetNumberOfSegmentBuffers() > 1).
+     * @details The segment buffers are given back to Execute even if the segments cannot be written.
+     * @return true if all the queued segments were successfully written.
+     */
+    bool WriteQueuedSegments();
+
+    /**
+     * @brief Waits until at most \a maxBacklog segments are queued.
+     * @param[in] maxBacklog the maximum number of queued segments.
+     * @return false if no segment was written in MDS_WRITER_NODE_WAIT_TIMEOUT_MSEC.
+     */
+    bool WaitQueuedSegments(const uint32 maxBacklog);
+
+    /**
+     * @brief Gets the number of segment buffers.
+     * @return the number of segment buffers.
+     */
+    uint32 GetNumberOfSegmentBuffers() const;
+
+    /**
+     * @brief Checks if the segments are compressed by MDSplus.
+     * @return true if Compression = 1.
+     */
+    bool IsCompression() const;
+
+    /**
+     * @brief Checks if the segments are streamed with beginSegment/putSegment.
+     * @return true if SegmentStreaming = 1 (or AutomaticSegmentation = 1 and TimeDimension = Range).
+     */
+    bool IsSegmentStreaming() const;
+
+    /**
+     * @brief Gets the number of segments queued and not yet written.
+     * @return the number of segments queued and not yet written.
+     */
+    uint32 GetBacklog() const;
+
+    /**
+     * @brief Gets the maximum number of segments that were queued at the same time.
+     * @return the maximum number of segments that were queued at the same time.
+     */
+    uint32 GetMaxBacklog() const;
+
+    /**
+     * @brief Gets the number of times that Execute had to wait for a free segment buffer.
+     * @return the number of times that Execute had to wait for a free segment buffer.
+     */
+    uint32 GetNumberOfQueueFull() const;
+
+    /**
+     * @brief Gets the number of segments (or set of rows when AutomaticSegmentation = 1) written into MDS+.
+     * @return the number of segments written into MDS+.
+     */
+    uint64 GetNumberOfSegments() const;
+
+    /**
+     * @brief Gets the time (in microseconds) that the last makeSegment (or set of putRow, or putSegment when streaming) took.
+     * @return the time (in microseconds) that the last makeSegment took.
+     */
+    uint64 GetLastSegmentLatency() const;
+
+    /**
+     * @brief Gets the maximum time (in microseconds) that a makeSegment (or set of putRow) took.
+     * @return the maximum time (in microseconds) that a makeSegment took.
+     */
+    uint64 GetMaxSegmentLatency() const;
+
     /**
      * @brief Returns true if MDS+ is to automatically compute a decimated version of the stored signal.
      * @return true if MDS+ is to automatically compute a decimated version of the stored signal.
@@ -322,9 +442,85 @@ private:
     /**
      * Data is stored in this buffer before triggering a makeSegment/makeSegmentMinMax.
      * The segment write will be triggered when (currentBuffer == makeSegmentAfterNWrites)
+     * Points at the segment buffer being filled (segmentBuffers[fillIndex]).
      */
     void *bufferedData;
 
+    /**
+     * Memory of the numberOfSegmentBuffers segment buffers.
+     */
+    char8 *segmentBuffers;
+
+    /**
+     * Size in bytes of one segment buffer.
+     */
+    uint32 segmentBufferSize;
+
+    /**
+     * Number of segment buffers. If > 1 the segments are queued and written by WriteQueuedSegments.
+     */
+    uint32 numberOfSegmentBuffers;
+
+    /**
+     * True if the segments are preallocated with beginSegment and the data appended with putSegment.
+     */
+    bool segmentStreaming;
+
+    /**
+     * True if the compress segments flag is set on the node.
+     */
+    bool compression;
+
+    /**
+     * The time information of the segment in each segment buffer.
+     */
+    MDSWriterNodeSegment *segments;
+
+    /**
+     * Index of the segment buffer being filled by Execute.
+     */
+    uint32 fillIndex;
+
+    /**
+     * Index of the next segment buffer to be written by WriteQueuedSegments.
+     */
+    uint32 writeIndex;
+
+    /**
+     * Number of segments queued and not yet written.
+     */
+    volatile int32 backlog;
+
+    /**
+     * Posted every time that a queued segment is written.
+     */
+    EventSem segmentWrittenSem;
+
+    /**
+     * Maximum number of segments that were queued at the same time.
+     */
+    uint32 maxBacklog;
+
+    /**
+     * Number of times that Execute had to wait for a free segment buffer.
+     */
+    uint32 numberOfQueueFull;
+
+    /**
+     * Number of segments written into MDS+.
+     */
+    uint64 numberOfSegments;
+
+    /**
+     * Time (in microseconds) that the last segment write took.
+     */
+    uint64 lastSegmentLatency;
+
+    /**
+     * Maximum time (in microseconds) that a segment write took.
+     */
+    uint64 maxSegmentLatency;
+
     /**
      * Current pointer where the bufferedData is being written to. Incremented every time the
      * Execute method is called.
@@ -382,20 +578,70 @@ private:
      */
     float64 discontinuityFactor;
 
+    /**
+     * @brief Computes the time information of the segment in the buffer being filled and advances the start of the next segment.
+     * @param[out] segment the time information of the segment.
+     */
+    void PrepareSegment(MDSWriterNodeSegment &segment);
+
+    /**
+     * @brief Queues the segment buffer being filled and moves to the next segment buffer (waiting until it is free).
+     * @return false if no segment buffer was freed in MDS_WRITER_NODE_WAIT_TIMEOUT_MSEC.
+     */
+    bool QueueSegment();
+
+    /**
+     * @brief Writes a segment with ForceSegment or AddDataToSegment and updates the statistics.
+     * @param[in] segment the time information of the segment.
+     * @param[in] data the segment buffer.
+     * @return true if the data can be copied to the MDSplus database.
+     */
+    bool WriteSegment(const MDSWriterNodeSegment &segment, void * const data);
+
     /**
      * @brief Save data in MDSplus using MDSplus::makeSegment() or MDSPlus::makeSegmentMaxMin()
      * @details the number of different time values per segment depends on Samples and the makeSegmentAfterNWrites
+     * @param[in] segment the time information of the segment.
+     * @param[in] data the segment buffer.
      * @return true if the data can be copied to the MDSplus database
      */
-    bool ForceSegment();
+    bool ForceSegment(const MDSWriterNodeSegment &segment, void * const data);
 
     /**
      * @brief Save data in MDSplus tree using MDSplus::putRow()
      * @details the number of different time values per segment is automatically adjusted by MDSplus engine, they are directly
      * related with Samples.
+     * @param[in] segment the time information of the segment.
+     * @param[in] data the segment buffer.
      * @return true if the data can be copied to the MDSplus database.
      */
-    bool AddDataToSegment();
+    bool AddDataToSegment(const MDSWriterNodeSegment &segment, void * const data);
+
+    /**
+     * @brief Creates an MDSplus array of the node type.
+     * @param[in] data the array data.
+     * @param[in] dims the array dimensions (number of samples and number of elements).
+     * @return the array (NULL if the node type is not supported), to be freed with MDSplus::deleteData.
+     */
+    MDSplus::Array *CreateArray(void * const data, int32 * const dims) const;
+
+    /**
+     * @brief Begins a segment with the time dimension computed from the current start and the Period and with all the rows preallocated.
+     * @return true if beginSegment succeeds.
+     */
+    bool BeginStreamingSegment();
+
+    /**
+     * @brief Appends the current signal samples to the segment with putSegment.
+     * @return true if putSegment succeeds.
+     */
+    bool PutStreamingSamples();
+
+    /**
+     * @brief Terminates the segment being streamed, truncating its time dimension (updateSegment) if the segment is not complete (flush).
+     * @return true if the segment can be updated.
+     */
+    bool EndStreamingSegment();
 };
 }
 
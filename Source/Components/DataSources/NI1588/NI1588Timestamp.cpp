@@ -53,7 +53,7 @@ NI1588Timestamp::NI1588Timestamp() :
         CircularBufferThreadInputDataSource() {
     pollTimeout = -1;
 
-    for (uint32 i = 0u; i < 6u; i++) {
+    for (uint32 i = 0u; i < 9u; i++) {
         signalIndexes[i] = 0xFFFFFFFFu;
         if (i < 3u) {
             capturedEventType[i] = 0u;
@@ -66,6 +66,10 @@ NI1588Timestamp::NI1588Timestamp() :
 
     devNum = -1;
     arrivedMask = 0u;
+    eventsBatch = NULL_PTR(uint64 *);
+    maxEvents = 0u;
+    numberOfEvents = 0u;
+    eventsOverflow = 0u;
 }
 
 NI1588Timestamp::~NI1588Timestamp() {
@@ -77,7 +81,9 @@ NI1588Timestamp::~NI1588Timestamp() {
             }
         }
     }
-
+    if (eventsBatch != NULL_PTR(uint64 *)) {
+        delete[] eventsBatch;
+    }
 }
 
 bool NI1588Timestamp::Initialise(StructuredDataI &data) {
@@ -107,7 +113,7 @@ bool NI1588Timestamp::SetConfiguredDatabase(StructuredDataI & data) {
         for (uint32 i = 0u; (i < numberOfSignals) && (ret); i++) {
             StreamString signalName;
             ret = GetSignalName(i, signalName);
-            if ((i != timeStampSignalIndex) && (i != errorCheckSignalIndex)) {
+            if ((i != timeStampSignalIndex) && (i != errorCheckSignalIndex) && (signalName != "Events")) {
                 uint32 numberOfElements = 0u;
                 if (ret) {
                     ret = GetSignalNumberOfElements(i, numberOfElements);
@@ -215,6 +221,49 @@ bool NI1588Timestamp::SetConfiguredDatabase(StructuredDataI & data) {
                         REPORT_ERROR(ErrorManagement::FatalError, "The type of the signal %s must be uint8", signalName.Buffer());
                     }
                 }
+                else if (signalName == "Events") {
+                    //check the type
+                    TypeDescriptor td;
+                    td = GetSignalType(i);
+
+                    ret = (td == UnsignedInteger64Bit);
+                    uint32 numberOfElements = 0u;
+                    if (ret) {
+                        ret = GetSignalNumberOfElements(i, numberOfElements);
+                    }
+                    if (ret) {
+                        ret = ((numberOfElements > 0u) && ((numberOfElements % 2u) == 0u));
+                        if (!ret) {
+                            REPORT_ERROR(ErrorManagement::FatalError, "The signal %s must have an even NumberOfElements", signalName.Buffer());
+                        }
+                    }
+                    else {
+                        REPORT_ERROR(ErrorManagement::FatalError, "The type of the signal %s must be uint64", signalName.Buffer());
+                    }
+                    if (ret) {
+                        maxEvents = (numberOfElements / 2u);
+                        if (eventsBatch != NULL_PTR(uint64 *)) {
+                            delete[] eventsBatch;
+                        }
+                        eventsBatch = new uint64[numberOfElements];
+                        signalIndexes[6] = i;
+                        nRealChannels--;
+                    }
+                }
+                else if ((signalName == "NumberOfEvents") || (signalName == "EventsOverflow")) {
+                    //check the type
+                    TypeDescriptor td;
+                    td = GetSignalType(i);
+
+                    ret = (td == UnsignedInteger32Bit);
+                    if (ret) {
+                        signalIndexes[(signalName == "NumberOfEvents") ? 7u : 8u] = i;
+                        nRealChannels--;
+                    }
+                    else {
+                        REPORT_ERROR(ErrorManagement::FatalError, "The type of the signal %s must be uint32", signalName.Buffer());
+                    }
+                }
                 else {
 
                 }
@@ -256,7 +305,7 @@ bool NI1588Timestamp::SetConfiguredDatabase(StructuredDataI & data) {
         if (ret) {
             ret = (nRealChannels == 0u);
             if (!ret) {
-                REPORT_ERROR(ErrorManagement::FatalError, "This DataSource supports three timestamp signals and their relative events");
+                REPORT_ERROR(ErrorManagement::FatalError, "This DataSource supports three timestamp signals, their relative events and the Events, NumberOfEvents and EventsOverflow signals");
             }
         }
     }
@@ -268,22 +317,53 @@ bool NI1588Timestamp::PrepareNextState(const char8 * const currentStateName, con
     int32 rc = poll(&pollfd[0], static_cast<nfds_t>(3u), 0);
     //empties the queue
     if (rc > 0) {
-        nisync_timestamp_nanos_t ts;
-        (void) MemoryOperationsHelper::Set(&ts, '\0', static_cast<uint32>(sizeof(nisync_timestamp_nanos_t)));
+        nisync_timestamp_nanos_t ts[NI1588_TIMESTAMP_READ_BATCH];
         for (uint32 i = 0u; (i < 3u); i++) {
             /* Skip non-ready terminals */
             if (((static_cast<uint16>(pollfd[i].revents)) & (static_cast<uint16>(POLLIN))) != 0u) {
-                //get the latest
-                while (nisync_read_timestamps_ns(pollfd[i].fd, &ts, static_cast<size_t>(1u)) > 0) {
+                //discard everything, one batch per call
+                while (nisync_read_timestamps_ns(pollfd[i].fd, &ts[0], static_cast<size_t>(NI1588_TIMESTAMP_READ_BATCH)) > 0) {
                 }
             }
         }
     }
+    numberOfEvents = 0u;
+    eventsOverflow = 0u;
+    arrivedMask = 0u;
 
     return CircularBufferThreadInputDataSource::PrepareNextState(currentStateName, nextStateName);
 
 }
 
+void NI1588Timestamp::AddEvent(const uint32 terminal,
+                               const uint8 edge,
+                               const uint64 timestamp) {
+    if (numberOfEvents < maxEvents) {
+        eventsBatch[2u * numberOfEvents] = (static_cast<uint64>(terminal) | (static_cast<uint64>(edge) << 8u));
+        eventsBatch[(2u * numberOfEvents) + 1u] = timestamp;
+        numberOfEvents++;
+    }
+    else {
+        eventsOverflow++;
+    }
+}
+
+void NI1588Timestamp::SortEvents() {
+    //Insertion sort: the batch is the concatenation of (at most) three sorted runs
+    for (uint32 i = 1u; i < numberOfEvents; i++) {
+        uint64 line = eventsBatch[2u * i];
+        uint64 timestamp = eventsBatch[(2u * i) + 1u];
+        uint32 j = i;
+        while ((j > 0u) && (eventsBatch[(2u * (j - 1u)) + 1u] > timestamp)) {
+            eventsBatch[2u * j] = eventsBatch[2u * (j - 1u)];
+            eventsBatch[(2u * j) + 1u] = eventsBatch[(2u * (j - 1u)) + 1u];
+            j--;
+        }
+        eventsBatch[2u * j] = line;
+        eventsBatch[(2u * j) + 1u] = timestamp;
+    }
+}
+
 bool NI1588Timestamp::DriverRead(char8 * const bufferToFill, uint32 &sizeToRead, const uint32 signalIdx) {
 
     uint64 tic = HighResolutionTimer::Counter();
@@ -302,20 +382,30 @@ bool NI1588Timestamp::DriverRead(char8 * const bufferToFill, uint32 &sizeToRead,
         // Read received events from ready terminals
         if (ret) {
             if (rc > 0) {
-                nisync_timestamp_nanos_t ts;
-                (void) MemoryOperationsHelper::Set(&ts, '\0', static_cast<uint32>(sizeof(nisync_timestamp_nanos_t)));
+                /*lint -e{645} ts is only read for the terminals where at least one time-stamp was read*/
+                nisync_timestamp_nanos_t ts[NI1588_TIMESTAMP_READ_BATCH];
+                numberOfEvents = 0u;
                 for (uint32 i = 0u; (i < 3u); i++) {
                     int32 nEventsRead = 0;
+                    int32 lastIdx = 0;
                     /* Skip non-ready terminals */
                     if (((static_cast<uint16>(pollfd[i].revents)) & (static_cast<uint16>(POLLIN))) != 0u) {
-                        int32 count = 1;
+                        int32 count = static_cast<int32>(NI1588_TIMESTAMP_READ_BATCH);
 
-                        //get the latest
-                        while (count > 0) {
-                            count = nisync_read_timestamps_ns(pollfd[i].fd, &ts, static_cast<size_t>(1u));
+                        //drain the FIFO one batch per driver call; a short batch means that the FIFO is empty
+                        while (count == static_cast<int32>(NI1588_TIMESTAMP_READ_BATCH)) {
+                            count = nisync_read_timestamps_ns(pollfd[i].fd, &ts[0], static_cast<size_t>(NI1588_TIMESTAMP_READ_BATCH));
                             if (count < 0) {
                                 count = 0;
                             }
+                            if (signalIndexes[6] != 0xFFFFFFFFu) {
+                                for (int32 k = 0; k < count; k++) {
+                                    AddEvent(i, ts[k].edge, ts[k].nanos);
+                                }
+                            }
+                            if (count > 0) {
+                                lastIdx = (count - 1);
+                            }
                             nEventsRead += count;
                         }
                     }
@@ -342,14 +432,22 @@ bool NI1588Timestamp::DriverRead(char8 * const bufferToFill, uint32 &sizeToRead,
 
                     if (nEventsRead > 0) {
                         readTerm = static_cast<int32>(i);
-                        signalTs[i] = ts.nanos;
-                        capturedEventType[i] = ts.edge;
+                        signalTs[i] = ts[lastIdx].nanos;
+                        capturedEventType[i] = ts[lastIdx].edge;
                         if (signalIndexes[i] != 0xFFFFFFFFu) {
-                            arrivedMask |= static_cast<uint8>(1u << i);
+                            arrivedMask |= static_cast<uint16>(1u << i);
                         }
                         uint32 eventIndex = (i + 3u);
                         if (signalIndexes[eventIndex] != 0xFFFFFFFFu) {
-                            arrivedMask |= static_cast<uint8>(1u << (3u + i));
+                            arrivedMask |= static_cast<uint16>(1u << (3u + i));
+                        }
+                    }
+                }
+                if (readTerm >= 0) {
+                    SortEvents();
+                    for (uint32 i = 6u; i < 9u; i++) {
+                        if (signalIndexes[i] != 0xFFFFFFFFu) {
+                            arrivedMask |= static_cast<uint16>(1u << i);
                         }
                     }
                 }
@@ -437,6 +535,36 @@ bool NI1588Timestamp::DriverRead(char8 * const bufferToFill, uint32 &sizeToRead,
             sizeToRead = 0u;
         }
     }
+    else if (signalIdx == signalIndexes[6]) {
+        if ((arrivedMask & 0x40u) != 0u) {
+            (void) MemoryOperationsHelper::Set(bufferToFill, '\0', sizeToRead);
+            (void) MemoryOperationsHelper::Copy(bufferToFill, &eventsBatch[0], (numberOfEvents * 2u) * static_cast<uint32>(sizeof(uint64)));
+            arrivedMask &= ~(0x40u);
+        }
+        else {
+            sizeToRead = 0u;
+        }
+    }
+    else if (signalIdx == signalIndexes[7]) {
+        if ((arrivedMask & 0x80u) != 0u) {
+            /*lint -e{927} -e{826} The bufferToFill should have the correct signal dimensions.*/
+            *reinterpret_cast<uint32*>(bufferToFill) = numberOfEvents;
+            arrivedMask &= ~(0x80u);
+        }
+        else {
+            sizeToRead = 0u;
+        }
+    }
+    else if (signalIdx == signalIndexes[8]) {
+        if ((arrivedMask & 0x100u) != 0u) {
+            /*lint -e{927} -e{826} The bufferToFill should have the correct signal dimensions.*/
+            *reinterpret_cast<uint32*>(bufferToFill) = eventsOverflow;
+            arrivedMask &= ~(0x100u);
+        }
+        else {
+            sizeToRead = 0u;
+        }
+    }
     else {
         ret = false;
     }
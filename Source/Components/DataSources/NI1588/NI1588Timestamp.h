@@ -39,6 +39,11 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * Number of time-stamps read from a terminal with a single nisync_read_timestamps_ns call.
+ */
+const uint32 NI1588_TIMESTAMP_READ_BATCH = 64u;
+
 /**
  * @brief Circular buffer time stamp acquisition using the NI-1588 PCI-Express board.
  *
@@ -84,6 +89,17 @@ namespace MARTe {
  *         *EventPFI2 = {
  *             Type = uint8
  *         }
+ *         *Events = { //All the events read from the board FIFOs since the previous buffer, as (line, time-stamp) pairs sorted by time-stamp.
+ *             Type = uint64 //Must be uint64
+ *             NumberOfDimensions = 1
+ *             NumberOfElements = 32 //Must be even: 2 x the maximum number of events per buffer. line = terminal index (0, 1, 2) | (edge << 8) with edge 0=RISING or 1=FALLING.
+ *         }
+ *         *NumberOfEvents = { //The number of valid pairs in Events.
+ *             Type = uint32 //Must be uint32
+ *         }
+ *         *EventsOverflow = { //The number of events that did not fit in Events since the DataSource was started.
+ *             Type = uint32 //Must be uint32
+ *         }
  *         *InternalTimeStamp = { //The time-stamp as measured by the
  *             Type = uint64
  *             NumberOfDimensions = 1
@@ -98,6 +114,11 @@ namespace MARTe {
  * }
 
  * </pre>
+ *
+ * @details The board FIFOs are drained by the CircularBufferThreadInputDataSource internal thread, NI1588_TIMESTAMP_READ_BATCH time-stamps per driver call.
+ * The TerminalPFIx and EventPFIx signals keep the latest event of each terminal. The optional Events signal delivers the full batch of
+ * events read in one pass, so that no event is lost when the triggers fire faster than the real-time thread: the batch is stored in the circular buffer
+ * together with the other signals and the events that do not fit are counted in EventsOverflow.
  */
 class NI1588Timestamp: public CircularBufferThreadInputDataSource {
 public:
@@ -130,6 +151,9 @@ public:
      *   EventPFI0: Type=uint8, NumberOfElements=1
      *   EventPFI1: Type=uint8, NumberOfElements=1
      *   EventPFI2: Type=uint8, NumberOfElements=1
+     *   Events: Type=uint64, NumberOfElements even and > 0
+     *   NumberOfEvents: Type=uint32, NumberOfElements=1
+     *   EventsOverflow: Type=uint32, NumberOfElements=1
      *  If none of the signals above is defined this method returns an error. No more signals than the ones above (and the optional signals supported by
      *  CircularBufferThreadInputDataSource) must be defined.
      *
@@ -164,6 +188,21 @@ public:
 
 protected:
 
+    /**
+     * @brief Adds an event to the events batch or, if the batch is full, increments the eventsOverflow.
+     * @param[in] terminal the terminal index (0, 1 or 2).
+     * @param[in] edge the captured edge (0=RISING, 1=FALLING).
+     * @param[in] timestamp the event time-stamp in nanoseconds.
+     */
+    void AddEvent(const uint32 terminal,
+                  const uint8 edge,
+                  const uint64 timestamp);
+
+    /**
+     * @brief Sorts the events batch by time-stamp (each terminal contributes an already sorted run).
+     */
+    void SortEvents();
+
     /**
      * How much time (in milliseconds) to wait for a new
      * event.
@@ -181,9 +220,9 @@ protected:
     uint8 capturedEventType[3];
 
     /**
-     * Used to store the six supported signal in the right order.
+     * Used to store the nine supported signal in the right order (TerminalPFI0-2, EventPFI0-2, Events, NumberOfEvents, EventsOverflow).
      */
-    uint32 signalIndexes[6];
+    uint32 signalIndexes[9];
 
     /**
      * Used to store the time stamp of the three input terminals
@@ -199,7 +238,27 @@ protected:
      * A mask used to check if all the signals have been stored in the internal buffer before a new
      * read from the device.
      */
-    uint8 arrivedMask;
+    uint16 arrivedMask;
+
+    /**
+     * The (line, time-stamp) pairs of the events read in the last pass.
+     */
+    uint64 *eventsBatch;
+
+    /**
+     * Maximum number of pairs in eventsBatch.
+     */
+    uint32 maxEvents;
+
+    /**
+     * Number of valid pairs in eventsBatch.
+     */
+    uint32 numberOfEvents;
+
+    /**
+     * Number of events that did not fit in eventsBatch.
+     */
+    uint32 eventsOverflow;
 };
 }
 
@@ -67,17 +67,14 @@ NI6259ADC::NI6259ADC() :
     currentBufferIdx = 0u;
     lastBufferIdx = 0u;
 
-    currentBufferOffset = 0u;
     lastTimeValue = 0u;
     fastMuxSleepTime = 1e-3F;
 
     counterValue = NULL_PTR(uint32 *);
     timeValue = NULL_PTR(uint32 *);
 
-    dmaReadBuffer = NULL_PTR(int16 *);
     dma = NULL_PTR(struct pxi6259_dma *);
     dmaOffset = 0u;
-    dmaChannel = 0u;
 
     uint32 n;
     for (n = 0u; n < NI6259ADC_MAX_CHANNELS; n++) {
@@ -127,9 +124,6 @@ NI6259ADC::~NI6259ADC() {
             delete[] channelsMemory[b][n];
         }
     }
-    if (dmaReadBuffer != NULL_PTR(int16 *)) {
-        delete[] dmaReadBuffer;
-    }
     if (counterValue != NULL_PTR(uint32 *)) {
         delete[] counterValue;
     }
@@ -219,7 +213,7 @@ bool NI6259ADC::PrepareNextState(const char8* const currentStateName, const char
                 timeValue[b] = 0u;
             }
         }
-        currentBufferOffset = 0u;
+        deinterleaver.NextBlock();
     }
     counterResetFastMux.FastUnLock();
     if (ok) {
@@ -848,6 +842,7 @@ bool NI6259ADC::SetConfiguredDatabase(StructuredDataI& data) {
                 channelsMemory[b][i] = new int16[numberOfSamples];
             }
         }
+        deinterleaver.Reset(numberOfADCsEnabled, numberOfSamples);
     }
 
     if (ok) {
@@ -885,66 +880,56 @@ bool NI6259ADC::SetConfiguredDatabase(StructuredDataI& data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "Could not set the dma for device %s", fullDeviceName);
         }
     }
-    if (ok) {
-        //lint -e{613} dma cannot be null as otherwise ok would be false
-        if (dma->ai.count > 0u) {
-            dmaReadBuffer = new int16[dma->ai.count];
-        }
-    }
 
     return ok;
 }
 
 ErrorManagement::ErrorType NI6259ADC::CopyFromDMA(const size_t numberOfSamplesFromDMA) {
     ErrorManagement::ErrorType err;
-    uint32 s = 0u;
-    if (dmaReadBuffer != NULL_PTR(int16 *)) {
-        (void) (counterResetFastMux.FastLock());
-        while (s < (numberOfSamplesFromDMA)) {
-            channelsMemory[currentBufferIdx][dmaChannel][currentBufferOffset] = dmaReadBuffer[s];
-            s++;
-            dmaChannel++;
-
-            if (dmaChannel == numberOfADCsEnabled) {
-                dmaChannel = 0u;
-                currentBufferOffset++;
-                if (currentBufferOffset == numberOfSamples) {
-                    currentBufferOffset = 0u;
-                    //Don't wait if this fails. At most a cycle will be delayed.
-                    (void) fastMux.FastLock(TTInfiniteWait, fastMuxSleepTime);
-                    currentBufferIdx++;
-                    if (currentBufferIdx == NUMBER_OF_BUFFERS) {
-                        currentBufferIdx = 0u;
-                    }
-                    //This is required as otherwise it could copy the wrong counter value in the consumer thread.
-                    if (counterValue != NULL_PTR(uint32 *)) {
-                        counterValue[currentBufferIdx] = counter;
-                    }
-                    if (counter > 0u) {
-                        uint64 counterSamples = counter;
-                        counterSamples *= numberOfSamples;
-                        counterSamples *= 1000000LLU;
-                        //lint -e{414} singleADCFrequency > 0 guaranteed during configuration.
-                        counterSamples /= singleADCFrequency;
-                        if (timeValue != NULL_PTR(uint32 *)) {
-                            timeValue[currentBufferIdx] = static_cast<uint32>(counterSamples);
-                        }
-                    }
-                    else {
-                        if (timeValue != NULL_PTR(uint32 *)) {
-                            timeValue[currentBufferIdx] = 0u;
-                        }
-                    }
-                    if (synchronising) {
-                        err = !synchSem.Post();
-                    }
-                    fastMux.FastUnLock();
-                    counter++;
+    //lint -e{613} dma cannot be null as CopyFromDMA is only called after checking it
+    const size_t dmaCount = dma->ai.count;
+    //lint -e{613,740,826} dma cannot be null (see above). The DMA samples are 16 bit wide.
+    const int16 * const dmaData = reinterpret_cast<const int16 *>(&dma->ai.data[0]);
+    size_t s = 0u;
+    (void) (counterResetFastMux.FastLock());
+    while (s < numberOfSamplesFromDMA) {
+        //De-interleave straight from the DMA until the current buffer is full (or all the samples were consumed)
+        s += deinterleaver.Copy(dmaData, dmaCount, ((dmaOffset + s) % dmaCount), (numberOfSamplesFromDMA - s), &channelsMemory[currentBufferIdx][0]);
+        if (deinterleaver.IsBlockComplete()) {
+            deinterleaver.NextBlock();
+            //Don't wait if this fails. At most a cycle will be delayed.
+            (void) fastMux.FastLock(TTInfiniteWait, fastMuxSleepTime);
+            currentBufferIdx++;
+            if (currentBufferIdx == NUMBER_OF_BUFFERS) {
+                currentBufferIdx = 0u;
+            }
+            //This is required as otherwise it could copy the wrong counter value in the consumer thread.
+            if (counterValue != NULL_PTR(uint32 *)) {
+                counterValue[currentBufferIdx] = counter;
+            }
+            if (counter > 0u) {
+                uint64 counterSamples = counter;
+                counterSamples *= numberOfSamples;
+                counterSamples *= 1000000LLU;
+                //lint -e{414} singleADCFrequency > 0 guaranteed during configuration.
+                counterSamples /= singleADCFrequency;
+                if (timeValue != NULL_PTR(uint32 *)) {
+                    timeValue[currentBufferIdx] = static_cast<uint32>(counterSamples);
+                }
+            }
+            else {
+                if (timeValue != NULL_PTR(uint32 *)) {
+                    timeValue[currentBufferIdx] = 0u;
                 }
             }
+            if (synchronising) {
+                err = !synchSem.Post();
+            }
+            fastMux.FastUnLock();
+            counter++;
         }
-        counterResetFastMux.FastUnLock();
     }
+    counterResetFastMux.FastUnLock();
     return err;
 }
 
@@ -962,31 +947,22 @@ ErrorManagement::ErrorType NI6259ADC::Execute(ExecutionInfo& info) {
             while (nBytesInDMA > 0u) {
                 dmaOffset = dmaOffset + nBytesInDMA;
                 dmaOffset %= dma->ai.count;
-                dmaChannel = (dma->ai.count % numberOfADCsEnabled);
+                deinterleaver.SetChannel(static_cast<uint32>(dma->ai.count % numberOfADCsEnabled));
                 nBytesInDMA = pxi6259_dma_samples_in_buffer(dma, dmaOffset);
             }
         }
         #endif
     }
     else {
-        if ((dma != NULL_PTR(struct pxi6259_dma *)) && (dmaReadBuffer != NULL_PTR(int16 *))) {
+        //lint -e{9007} no side effects on the right hand side if it is not evaluated.
+        if ((dma != NULL_PTR(struct pxi6259_dma *)) && (numberOfADCsEnabled > 0u) && (dma->ai.count > 0u)) {
             size_t nBytesInDMA = pxi6259_dma_samples_in_buffer(dma, static_cast<off_t>(dmaOffset));
             if (nBytesInDMA > 0u) {
                 if (nBytesInDMA > dma->ai.count) {
                     REPORT_ERROR(ErrorManagement::FatalError, "Overflow while reading from the ADC");
                 }
                 else {
-                    if ((dmaOffset + nBytesInDMA) > (dma->ai.count)) {
-                        //Right part of the DMA
-                        size_t samplesToCopy = (dma->ai.count - dmaOffset);
-                        //Roll to the beginning
-                        size_t samplesToCopyRoll = ((dmaOffset + nBytesInDMA) - dma->ai.count);
-                        memcpy(&dmaReadBuffer[0], &dma->ai.data[dmaOffset], (sizeof(int16) * samplesToCopy));
-                        memcpy(&dmaReadBuffer[samplesToCopy], &dma->ai.data[0], (sizeof(int16) * samplesToCopyRoll));
-                    }
-                    else {
-                        memcpy(&dmaReadBuffer[0], &dma->ai.data[dmaOffset], (sizeof(int16) * nBytesInDMA));
-                    }
+                    //The samples are de-interleaved straight from the DMA (starting at dmaOffset and rolling to the beginning if needed)
                     err = CopyFromDMA(nBytesInDMA);
                 }
                 dmaOffset = dmaOffset + nBytesInDMA;
@@ -33,6 +33,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "DMADeinterleaver.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "EventSem.h"
 #include "SingleThreadService.h"
@@ -224,16 +225,17 @@ private:
     /**
      * @brief Copies from the DMA memory into the broker memory.
      * @details The DMA memory is organised in a different way (see xseries-lib.h) w.r.t. to the broker memory.
-     * This function maps the DMA memory into the broker memory.
+     * This function maps the DMA memory into the broker memory, de-interleaving the samples straight from the DMA
+     * (starting at dmaOffset and rolling to the beginning of the DMA if needed) with the DMADeinterleaver.
      * @param numberOfSamplesFromDMA number of samples to copy between memories.
      * @return ErrorManagement::FatalError if the semaphore cannot be posted.
      */
     ErrorManagement::ErrorType CopyFromDMA(size_t numberOfSamplesFromDMA);
 
     /**
-     * The number of samples written to the current buffer.
+     * De-interleaves the DMA into the current buffer (keeps the current DMA channel and the number of samples written to the current buffer).
      */
-    uint32 currentBufferOffset;
+    DMADeinterleaver<int16> deinterleaver;
 
     /**
      * The counter value
@@ -350,16 +352,6 @@ private:
      */
     struct pxi6259_dma *dma;
 
-    /**
-     * The memory where the DMA is copied to.
-     */
-    int16 *dmaReadBuffer;
-
-    /**
-     * The current DMA channel being copied.
-     */
-    size_t dmaChannel;
-
     /**
      * The ADCs that are enabled
      */
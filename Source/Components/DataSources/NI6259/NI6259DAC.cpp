@@ -50,6 +50,10 @@ NI6259DAC::NI6259DAC() :
     numberOfDACsEnabled = 0u;
     clockUpdateDivisor = 10u;
     triggerSet = false;
+    waveformMode = false;
+    blockNumberOfElements = 1u;
+    preloadBlocks = 2u;
+    preloadedBlocks = 0u;
     clockUpdateSource = AO_UPDATE_SOURCE_SELECT_UI_TC;
     clockUpdatePolarity = AO_UPDATE_SOURCE_POLARITY_RISING_EDGE;
     uint32 n;
@@ -95,7 +99,7 @@ bool NI6259DAC::GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 buffe
     bool ok = (signalIdx < (NI6259DAC_MAX_CHANNELS));
     if (ok) {
         if (channelsMemory != NULL_PTR(float32 *)) {
-            signalAddress = &(channelsMemory[signalIdx]);
+            signalAddress = &(channelsMemory[signalIdx * blockNumberOfElements]);
         }
     }
     return ok;
@@ -327,6 +331,34 @@ bool NI6259DAC::Initialise(StructuredDataI& data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "Unsupported ClockUpdatePolarity");
         }
     }
+    if (ok) {
+        StreamString outputMode;
+        if (!data.Read("OutputMode", outputMode)) {
+            outputMode = "Static";
+        }
+        if (outputMode == "Static") {
+            waveformMode = false;
+        }
+        else if (outputMode == "Waveform") {
+            waveformMode = true;
+        }
+        else {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "Unsupported OutputMode. Possible values: Static, Waveform");
+        }
+    }
+    if (ok) {
+        if (waveformMode) {
+            if (!data.Read("PreloadBlocks", preloadBlocks)) {
+                preloadBlocks = 2u;
+                REPORT_ERROR(ErrorManagement::Information, "No PreloadBlocks specified. Using %u", preloadBlocks);
+            }
+            ok = (preloadBlocks > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The PreloadBlocks shall be > 0");
+            }
+        }
+    }
     //Get individual signal parameters
     uint32 i = 0u;
     if (ok) {
@@ -407,6 +439,27 @@ bool NI6259DAC::SetConfiguredDatabase(StructuredDataI& data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "All the DAC signals shall be of type Float32Bit");
         }
     }
+    if (ok) {
+        for (i = 0u; (i < numberOfDACsEnabled) && (ok); i++) {
+            uint32 nElements = 0u;
+            ok = GetSignalNumberOfElements(i, nElements);
+            if (ok) {
+                if (waveformMode) {
+                    if (i == 0u) {
+                        blockNumberOfElements = nElements;
+                    }
+                    ok = (nElements == blockNumberOfElements);
+                }
+                else {
+                    ok = (nElements == 1u);
+                }
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError,
+                         "All the DAC signals shall have one element (OutputMode = Static) or the same number of elements (OutputMode = Waveform)");
+        }
+    }
 
     uint32 nOfFunctions = GetNumberOfFunctions();
     uint32 functionIdx;
@@ -452,14 +505,22 @@ bool NI6259DAC::SetConfiguredDatabase(StructuredDataI& data) {
             }
         }
     }
-    if (ok) {
+    if ((ok) && (!waveformMode)) {
         ok = (pxi6259_set_ao_attribute(&dacConfiguration, AO_SIGNAL_GENERATION, AO_SIGNAL_GENERATION_STATIC) == 0);
         if (!ok) {
             REPORT_ERROR_PARAMETERS(ErrorManagement::ParametersError, "Could not set the parameter AO_SIGNAL_GENERATION_STATIC %s", fullDeviceName);
         }
     }
+    if ((ok) && (waveformMode)) {
+        ok = (pxi6259_set_ao_attribute(&dacConfiguration, AO_SIGNAL_GENERATION, AO_SIGNAL_GENERATION_WAVEFORM) == 0);
+        if (!ok) {
+            REPORT_ERROR_PARAMETERS(ErrorManagement::ParametersError, "Could not set the parameter AO_SIGNAL_GENERATION_WAVEFORM %s", fullDeviceName);
+        }
+    }
     if (ok) {
-        ok = (pxi6259_set_ao_count(&dacConfiguration, 1u, 1u, 0u) == 0);
+        //In Waveform mode the generation is continuous and fed by the Synchronise, one block at the time
+        uint32 continuous = waveformMode ? 1u : 0u;
+        ok = (pxi6259_set_ao_count(&dacConfiguration, blockNumberOfElements, 1u, continuous) == 0);
         if (!ok) {
             REPORT_ERROR_PARAMETERS(ErrorManagement::ParametersError, "Could not set the number of samples for device %s", fullDeviceName);
         }
@@ -479,7 +540,7 @@ bool NI6259DAC::SetConfiguredDatabase(StructuredDataI& data) {
 
     if (ok) {
         //Allocate memory
-        channelsMemory = new float32[NI6259DAC_MAX_CHANNELS];
+        channelsMemory = new float32[NI6259DAC_MAX_CHANNELS * blockNumberOfElements];
     }
 
     if (ok) {
@@ -503,7 +564,8 @@ bool NI6259DAC::SetConfiguredDatabase(StructuredDataI& data) {
             }
         }
     }
-    if (ok) {
+    //In Waveform mode the board is started by the Synchronise after preloading the FIFO
+    if ((ok) && (!waveformMode)) {
         ok = (pxi6259_start_ao(boardFileDescriptor) == 0);
         if (!ok) {
             REPORT_ERROR_PARAMETERS(ErrorManagement::ParametersError, "Could not start the device %s", fullDeviceName);
@@ -518,7 +580,27 @@ bool NI6259DAC::Synchronise() {
     for (i = 0u; (i < NI6259DAC_MAX_CHANNELS) && (ok); i++) {
         if (dacEnabled[i]) {
             if (channelsMemory != NULL_PTR(float32 *)) {
-                ok = (pxi6259_write_ao(channelsFileDescriptors[i], &(channelsMemory[i]), static_cast<size_t>(1u)) >= 0);
+                size_t samplesToWrite = static_cast<size_t>(blockNumberOfElements);
+                size_t k = static_cast<size_t>(i * blockNumberOfElements);
+                while ((samplesToWrite > 0u) && (ok)) {
+                    ssize_t samplesWritten = pxi6259_write_ao(channelsFileDescriptors[i], &(channelsMemory[k]), samplesToWrite);
+                    if (samplesWritten < 0) {
+                        ok = false;
+                    }
+                    else {
+                        samplesToWrite -= static_cast<size_t>(samplesWritten);
+                        k += static_cast<size_t>(samplesWritten);
+                    }
+                }
+            }
+        }
+    }
+    if ((ok) && (waveformMode) && (preloadedBlocks < preloadBlocks)) {
+        preloadedBlocks++;
+        if (preloadedBlocks == preloadBlocks) {
+            ok = (pxi6259_start_ao(boardFileDescriptor) == 0);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the device after preloading %u blocks", preloadBlocks);
             }
         }
     }
@@ -58,6 +58,8 @@ const uint32 NI6259DAC_MAX_CHANNELS = 4u;
  *     ClockUpdateSource = "UI_TC" //Mandatory. Update clock source. Possible values:UI_TC, PFI0, ..., PFI15, RTSI0, ..., RTSI7, GPCRT0_OUT, STAR_TRIGGER, GPCTR1_OUT, ANALOG_TRIGGER, LOW
  *     ClockUpdatePolarity = "RISING_EDGE" //Mandatory. Possible values: RISING_EDGE, FALLING_EDGE
  *     ClockUpdateDivisor = 10 //Optional. Default value = 10. Only meaningful if ClockUpdateSource == UI_TC.
+ *     OutputMode = "Static" //Optional. Possible values: Static, Waveform. Default value Static.
+ *     PreloadBlocks = 2 //Optional and only relevant if OutputMode == Waveform. Number of blocks written before starting the board (> 0). Default value 2.
  *     Signals = {
  *         DAC0_0 = {
  *             Type = float32 //Mandatory. Only type that is supported.
@@ -69,6 +71,13 @@ const uint32 NI6259DAC_MAX_CHANNELS = 4u;
  * </pre>
  * Note that at least one of the GAMs writing to this DataSource must have set one of the signals with Trigger=1 (which forces the writing of all the signals to the DAC).
  * The clock configuration is fixed to AO_UPDATE_SOURCE_SELECT_UI_TC and AO_UPDATE_SOURCE_POLARITY_RISING_EDGE.
+ *
+ * With OutputMode = Static each DAC signal shall have one element, which is written at every Synchronise.
+ * With OutputMode = Waveform the board is configured for continuous waveform generation and every Synchronise streams a block of
+ * NumberOfElements samples per channel (e.g. generated by a WaveformGAM) into the AO FIFO, from where the samples are output at the rate of the
+ * update clock (i.e. decoupled from the real-time cycle rate). All the DAC signals shall have the same NumberOfElements.
+ * The board is only started after PreloadBlocks blocks were written, so that the FIFO is always PreloadBlocks blocks ahead of the hardware
+ * updates and an occasionally late cycle does not underrun the output.
  */
 class NI6259DAC: public DataSourceI {
 public:
@@ -155,6 +164,8 @@ public:
      * - At least one triggering signal was requested by a GAM (with the property Trigger = 1)
      * - All the DAC channels have type float32.
      * - The number of samples of all the DAC channels is exactly one.
+     * - The number of elements of all the DAC channels is one (OutputMode = Static) or the same (OutputMode = Waveform).
+     * The board is started, unless OutputMode = Waveform (see Synchronise).
      * @return true if all the parameters are valid and consistent with the board parameters and if the board can be successfully configured with
      *  these parameters.
      */
@@ -162,7 +173,8 @@ public:
 
     /**
      * @details Writes the value of all the DAC channels to the board.
-     * @return true if the writing of all the channels is successful.
+     * If OutputMode = Waveform the board is started after PreloadBlocks blocks were written.
+     * @return true if the writing of all the channels (and the start of the board) is successful.
      */
     virtual bool Synchronise();
 
@@ -235,6 +247,26 @@ private:
      */
     bool triggerSet;
 
+    /**
+     * True if OutputMode = Waveform.
+     */
+    bool waveformMode;
+
+    /**
+     * The number of samples written for each channel at every Synchronise (1 if OutputMode = Static).
+     */
+    uint32 blockNumberOfElements;
+
+    /**
+     * The number of blocks to write before starting the board (OutputMode = Waveform).
+     */
+    uint32 preloadBlocks;
+
+    /**
+     * The number of blocks written before starting the board.
+     */
+    uint32 preloadedBlocks;
+
 };
 }
 
@@ -32,6 +32,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "HeapManager.h"
 #include "MemoryMapInputBroker.h"
 #include "NI6368ADCInputBroker.h"
 
@@ -55,6 +56,7 @@ NI6368ADC::NI6368ADC() :
     counter = 0u;
     counterValue = NULL_PTR(uint32 *);
     timeValue = NULL_PTR(uint32 *);
+    memoryHeap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
     scanIntervalCounterDelay = 0u;
     scanIntervalCounterPeriod = 0u;
     numberOfADCsEnabled = 0u;
@@ -66,11 +68,12 @@ NI6368ADC::NI6368ADC() :
     scanIntervalCounterSource = XSERIES_SCAN_INTERVAL_COUNTER_TB3;
     scanIntervalCounterPolarity = XSERIES_SCAN_INTERVAL_COUNTER_POLARITY_RISING_EDGE;
     currentBufferIdx = 0u;
-    currentBufferOffset = 0u;
     nBytesInDMAFromStart = 0u;
     dmaOffset = 0u;
-    dmaChannel = 0u;
     lastTimeValue = 0u;
+    numberOfBuffers = NUMBER_OF_BUFFERS;
+    numberOfOverruns = 0u;
+    lastNumberOfOverruns = 0u;
     fastMuxSleepTime = 1e-3F;
     executionMode = NI6368ADC_EXEC_SPAWNED;
     dma = NULL_PTR(struct xseries_dma *);
@@ -84,12 +87,11 @@ NI6368ADC::NI6368ADC() :
         adcEnabled[n] = false;
         channelsFileDescriptors[n] = -1;
         uint32 b;
-        for (b = 0u; b < NUMBER_OF_BUFFERS; b++) {
+        for (b = 0u; b < NI6368ADC_MAX_NUMBER_OF_BUFFERS; b++) {
             channelsMemory[b][n] = NULL_PTR(int16 *);
             channelsMemory[b][n] = NULL_PTR(int16 *);
         }
     }
-    dmaReadBuffer = NULL_PTR(int16 *);
     if (!synchSem.Create()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem.");
     }
@@ -126,18 +128,18 @@ NI6368ADC::~NI6368ADC() {
     }
     for (n = 0u; n < NI6368ADC_MAX_CHANNELS; n++) {
         uint32 b;
-        for (b = 0u; b < NUMBER_OF_BUFFERS; b++) {
-            delete[] channelsMemory[b][n];
+        for (b = 0u; b < NI6368ADC_MAX_NUMBER_OF_BUFFERS; b++) {
+            if (channelsMemory[b][n] != NULL_PTR(int16 *)) {
+                void *mem = reinterpret_cast<void *>(channelsMemory[b][n]);
+                memoryHeap->Free(mem);
+            }
         }
     }
-    if (dmaReadBuffer != NULL_PTR(int16 *)) {
-        delete[] dmaReadBuffer;
-    }
     if (counterValue != NULL_PTR(uint32 *)) {
-        delete[] counterValue;
+        memoryHeap->Free(reinterpret_cast<void *&>(counterValue));
     }
     if (timeValue != NULL_PTR(uint32 *)) {
-        delete[] timeValue;
+        memoryHeap->Free(reinterpret_cast<void *&>(timeValue));
     }
 }
 
@@ -146,7 +148,7 @@ bool NI6368ADC::AllocateMemory() {
 }
 
 uint32 NI6368ADC::GetNumberOfMemoryBuffers() {
-    return NUMBER_OF_BUFFERS;
+    return numberOfBuffers;
 }
 
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: The memory buffer is independent of the bufferIdx.*/
@@ -214,11 +216,14 @@ bool NI6368ADC::Synchronise() {
         if (executionMode == NI6368ADC_EXEC_RTTHREAD) {
             ExecutionInfo info;
             info.SetStage(ExecutionInfo::MainStage);
-            err = ErrorManagement::NotCompleted;
-            while (err == ErrorManagement::NotCompleted) {
+            //If blocks were already acquired (this thread fell behind) do not wait, but still drain the DMA into the ring.
+            bool pending = (lastBufferIdx != currentBufferIdx);
+            err = Execute(info);
+            while ((err == ErrorManagement::NotCompleted) && (!pending)) {
                 err = Execute(info);
             }
-            if (err == ErrorManagement::Completed) {
+            //lint -e{9007} no side effects on the right hand side if it is not evaluated.
+            if ((err == ErrorManagement::Completed) || (err == ErrorManagement::NotCompleted)) {
                 err = ErrorManagement::NoError;
             }
         }
@@ -236,6 +241,12 @@ bool NI6368ADC::Synchronise() {
             }
         }
     }
+    uint32 currentNumberOfOverruns = numberOfOverruns;
+    if (currentNumberOfOverruns != lastNumberOfOverruns) {
+        REPORT_ERROR(ErrorManagement::Warning, "The real-time thread fell behind by %u buffers. %u blocks dropped (%u in total)", numberOfBuffers,
+                     (currentNumberOfOverruns - lastNumberOfOverruns), currentNumberOfOverruns);
+        lastNumberOfOverruns = currentNumberOfOverruns;
+    }
     if (timeValue != NULL_PTR(uint32 *)) {
         if (lastTimeValue == timeValue[lastBufferIdx]) {
             if (lastTimeValue != 0u) {
@@ -258,7 +269,7 @@ void NI6368ADC::ResetDMA() {
         nBytesInDMAFromStart += nBytesInDMA;
         dma->ai.last_transfer_count = nBytesInDMAFromStart;
         //lint -e{414} numberOfADCsEnabled > 0 guaranteed during configuration.
-        dmaChannel = (dma->ai.last_transfer_count % numberOfADCsEnabled);
+        deinterleaver.SetChannel(static_cast<uint32>(dma->ai.last_transfer_count % numberOfADCsEnabled));
         nBytesInDMA = xsereis_ai_dma_samples_in_buffer(dma);
     }
 }
@@ -274,7 +285,7 @@ bool NI6368ADC::PrepareNextState(const char8* const currentStateName, const char
     if (ok) {
         counter = 0u;
         uint32 b;
-        for (b = 0u; b < NUMBER_OF_BUFFERS; b++) {
+        for (b = 0u; b < numberOfBuffers; b++) {
             if (counterValue != NULL_PTR(uint32 *)) {
                 counterValue[b] = 0u;
             }
@@ -282,7 +293,7 @@ bool NI6368ADC::PrepareNextState(const char8* const currentStateName, const char
                 timeValue[b] = 0u;
             }
         }
-        currentBufferOffset = 0u;
+        deinterleaver.NextBlock();
     }
     counterResetFastMux.FastUnLock();
     if (ok) {
@@ -314,6 +325,16 @@ bool NI6368ADC::Initialise(StructuredDataI& data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "The BoardId shall be specified");
         }
     }
+    if (ok) {
+        StreamString heapName;
+        if (data.Read("HeapName", heapName)) {
+            memoryHeap = HeapManager::FindHeap(heapName.Buffer());
+            ok = (memoryHeap != NULL_PTR(HeapI *));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Could not find a heap named %s", heapName.Buffer());
+            }
+        }
+    }
     if (ok) {
         StreamString executionModeStr;
         if (!data.Read("ExecutionMode", executionModeStr)) {
@@ -352,6 +373,16 @@ bool NI6368ADC::Initialise(StructuredDataI& data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "The DMABufferSize shall be specified");
         }
     }
+    if (ok) {
+        if (!data.Read("NumberOfBuffers", numberOfBuffers)) {
+            numberOfBuffers = NUMBER_OF_BUFFERS;
+            REPORT_ERROR(ErrorManagement::Information, "No NumberOfBuffers specified. Using %u", numberOfBuffers);
+        }
+        ok = ((numberOfBuffers > 1u) && (numberOfBuffers <= NI6368ADC_MAX_NUMBER_OF_BUFFERS));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The NumberOfBuffers shall be > 1 and <= %u", NI6368ADC_MAX_NUMBER_OF_BUFFERS);
+        }
+    }
     if (ok) {
         if (clockSampleSourceStr == "INTERNALTIMING") {
             clockSampleSource = XSERIES_AI_SAMPLE_CONVERT_CLOCK_INTERNALTIMING;
@@ -1127,15 +1158,21 @@ bool NI6368ADC::SetConfiguredDatabase(StructuredDataI& data) {
     }
     if (ok) {
         //Allocate memory
-        counterValue = new uint32[NUMBER_OF_BUFFERS];
-        timeValue = new uint32[NUMBER_OF_BUFFERS];
+        counterValue = static_cast<uint32 *>(memoryHeap->Malloc(static_cast<uint32>(sizeof(uint32)) * numberOfBuffers));
+        timeValue = static_cast<uint32 *>(memoryHeap->Malloc(static_cast<uint32>(sizeof(uint32)) * numberOfBuffers));
+        ok = ((counterValue != NULL_PTR(uint32 *)) && (timeValue != NULL_PTR(uint32 *)));
 
         for (i = 0u; (i < NI6368ADC_MAX_CHANNELS) && (ok); i++) {
             uint32 b;
-            for (b = 0u; (b < NUMBER_OF_BUFFERS) && (ok); b++) {
-                channelsMemory[b][i] = new int16[numberOfSamples];
+            for (b = 0u; (b < numberOfBuffers) && (ok); b++) {
+                channelsMemory[b][i] = static_cast<int16 *>(memoryHeap->Malloc(static_cast<uint32>(sizeof(int16)) * numberOfSamples));
+                ok = (channelsMemory[b][i] != NULL_PTR(int16 *));
             }
         }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate the cycle buffers");
+        }
+        deinterleaver.Reset(static_cast<uint32>(numberOfADCsEnabled), numberOfSamples);
     }
 
     if (ok) {
@@ -1181,79 +1218,83 @@ bool NI6368ADC::SetConfiguredDatabase(StructuredDataI& data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "Could not start the device %s", fullDeviceName);
         }
     }
-    if (ok) {
-        //lint -e{613} dma cannot be null as otherwise ok would be false
-        if (dma->ai.count > 0u) {
-            dmaReadBuffer = new int16[dma->ai.count];
-        }
-    }
     return ok;
 }
 
 uint8 NI6368ADC::GetLastBufferIdx() {
+    //The producer may also move the lastBufferIdx (dropping the oldest block) if the ring is full.
+    (void) fastMux.FastLock(TTInfiniteWait, fastMuxSleepTime);
     uint8 toReadIdx = lastBufferIdx;
-    //This is thread safe since this is executed in the context of the thread which calls Synchronise.
     lastBufferIdx++;
-    if (lastBufferIdx == NUMBER_OF_BUFFERS) {
+    if (lastBufferIdx == numberOfBuffers) {
         lastBufferIdx = 0u;
     }
+    fastMux.FastUnLock();
     return toReadIdx;
 }
 
+uint32 NI6368ADC::GetNumberOfOverruns() const {
+    return numberOfOverruns;
+}
+
 bool NI6368ADC::IsSynchronising() const {
     return synchronising;
 }
 
 ErrorManagement::ErrorType NI6368ADC::CopyFromDMA(const size_t numberOfSamplesFromDMA) {
     ErrorManagement::ErrorType err = ErrorManagement::NotCompleted;
-    uint32 s = 0u;
-    if (dmaReadBuffer != NULL_PTR(int16 *)) {
-        (void) (counterResetFastMux.FastLock());
-        while (s < (numberOfSamplesFromDMA)) {
-            channelsMemory[currentBufferIdx][dmaChannel][currentBufferOffset] = dmaReadBuffer[s];
-            s++;
-            dmaChannel++;
-
-            if (dmaChannel == numberOfADCsEnabled) {
-                dmaChannel = 0u;
-                currentBufferOffset++;
-                if (currentBufferOffset == numberOfSamples) {
-                    currentBufferOffset = 0u;
-                    //Don't wait if this fails. At most a cycle will be delayed.
-                    (void) fastMux.FastLock(TTInfiniteWait, fastMuxSleepTime);
-                    currentBufferIdx++;
-                    if (currentBufferIdx == NUMBER_OF_BUFFERS) {
-                        currentBufferIdx = 0u;
-                    }
-                    //This is required as otherwise it could copy the wrong counter value in the consumer thread.
-                    if (counterValue != NULL_PTR(uint32 *)) {
-                        counterValue[currentBufferIdx] = counter;
-                    }
-                    if (counter > 0u) {
-                        uint64 counterSamples = counter;
-                        counterSamples *= numberOfSamples;
-                        counterSamples *= 1000000LLU;
-                        counterSamples /= NI6368ADC_SAMPLING_FREQUENCY;
-                        if (timeValue != NULL_PTR(uint32 *)) {
-                            timeValue[currentBufferIdx] = static_cast<uint32>(counterSamples);
-                        }
-                    }
-                    else {
-                        if (timeValue != NULL_PTR(uint32 *)) {
-                            timeValue[currentBufferIdx] = 0u;
-                        }
-                    }
-                    if (synchronising) {
-                        err = !synchSem.Post();
-                        err = ErrorManagement::Completed;
-                    }
-                    fastMux.FastUnLock();
-                    counter++;
+    //lint -e{613} dma cannot be null as CopyFromDMA is only called after checking it
+    const size_t dmaCount = dma->ai.count;
+    //lint -e{613,740,826} dma cannot be null (see above). The DMA samples are 16 bit wide.
+    const int16 * const dmaData = reinterpret_cast<const int16 *>(&dma->ai.data[0]);
+    size_t s = 0u;
+    (void) (counterResetFastMux.FastLock());
+    while (s < numberOfSamplesFromDMA) {
+        //De-interleave straight from the DMA until the current buffer is full (or all the samples were consumed)
+        s += deinterleaver.Copy(dmaData, dmaCount, ((dmaOffset + s) % dmaCount), (numberOfSamplesFromDMA - s), &channelsMemory[currentBufferIdx][0]);
+        if (deinterleaver.IsBlockComplete()) {
+            deinterleaver.NextBlock();
+            //Don't wait if this fails. At most a cycle will be delayed.
+            (void) fastMux.FastLock(TTInfiniteWait, fastMuxSleepTime);
+            currentBufferIdx++;
+            if (currentBufferIdx == numberOfBuffers) {
+                currentBufferIdx = 0u;
+            }
+            //The consumer fell behind by the whole ring: the oldest block is dropped as it is going to be overwritten.
+            if (currentBufferIdx == lastBufferIdx) {
+                lastBufferIdx++;
+                if (lastBufferIdx == numberOfBuffers) {
+                    lastBufferIdx = 0u;
                 }
+                numberOfOverruns++;
+            }
+            //This is required as otherwise it could copy the wrong counter value in the consumer thread.
+            if (counterValue != NULL_PTR(uint32 *)) {
+                counterValue[currentBufferIdx] = counter;
             }
+            if (counter > 0u) {
+                uint64 counterSamples = counter;
+                counterSamples *= numberOfSamples;
+                counterSamples *= 1000000LLU;
+                counterSamples /= NI6368ADC_SAMPLING_FREQUENCY;
+                if (timeValue != NULL_PTR(uint32 *)) {
+                    timeValue[currentBufferIdx] = static_cast<uint32>(counterSamples);
+                }
+            }
+            else {
+                if (timeValue != NULL_PTR(uint32 *)) {
+                    timeValue[currentBufferIdx] = 0u;
+                }
+            }
+            if (synchronising) {
+                err = !synchSem.Post();
+                err = ErrorManagement::Completed;
+            }
+            fastMux.FastUnLock();
+            counter++;
         }
-        counterResetFastMux.FastUnLock();
     }
+    counterResetFastMux.FastUnLock();
     return err;
 }
 
@@ -1269,24 +1310,15 @@ ErrorManagement::ErrorType NI6368ADC::Execute(ExecutionInfo& info) {
         }
     }
     else {
-        if ((dma != NULL_PTR(struct xseries_dma *)) && (dmaReadBuffer != NULL_PTR(int16 *))) {
+        //lint -e{9007} no side effects on the right hand side if it is not evaluated.
+        if ((dma != NULL_PTR(struct xseries_dma *)) && (numberOfADCsEnabled > 0u) && (dma->ai.count > 0u)) {
             size_t nBytesInDMA = xsereis_ai_dma_samples_in_buffer(dma);
             if (nBytesInDMA > 0u) {
                 if (nBytesInDMA > dma->ai.count) {
                     REPORT_ERROR(ErrorManagement::FatalError, "Overflow while reading from the ADC");
                 }
                 else {
-                    if ((dmaOffset + nBytesInDMA) > (dma->ai.count)) {
-                        //Right part of the DMA
-                        size_t samplesToCopy = (dma->ai.count - dmaOffset);
-                        //Roll to the beginning
-                        size_t samplesToCopyRoll = ((dmaOffset + nBytesInDMA) - dma->ai.count);
-                        memcpy(&dmaReadBuffer[0], &dma->ai.data[dmaOffset], (sizeof(int16) * samplesToCopy));
-                        memcpy(&dmaReadBuffer[samplesToCopy], &dma->ai.data[0], (sizeof(int16) * samplesToCopyRoll));
-                    }
-                    else {
-                        memcpy(&dmaReadBuffer[0], &dma->ai.data[dmaOffset], (sizeof(int16) * nBytesInDMA));
-                    }
+                    //The samples are de-interleaved straight from the DMA (starting at dmaOffset and rolling to the beginning if needed)
                     err = CopyFromDMA(nBytesInDMA);
                     if (executionMode == NI6368ADC_EXEC_SPAWNED) {
                         //Reset the error if this is being managed by another thread. The NotCompleted is only used in the Synchronise method 
@@ -34,8 +34,10 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "DMADeinterleaver.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "EventSem.h"
+#include "HeapI.h"
 #include "SingleThreadService.h"
 
 /*---------------------------------------------------------------------------*/
@@ -57,9 +59,14 @@ const uint32 NI6368ADC_HEADER_SIZE = 2u;
  */
 const uint32 NI6368ADC_SAMPLING_FREQUENCY = 2000000u;
 /**
- * The number of buffers to synchronise with the DMA
+ * The default number of buffers to synchronise with the DMA
  */
 const uint32 NUMBER_OF_BUFFERS = 8u;
+
+/**
+ * The maximum number of buffers to synchronise with the DMA (see NumberOfBuffers)
+ */
+const uint32 NI6368ADC_MAX_NUMBER_OF_BUFFERS = 64u;
 //If the execution mode is RealTimeThread the synchronisation is performed in the scope of the real-time thread. Otherwise if the mode is IndependentThread then a thread is spawned in order to synchronised with the CPU
 /**
  * Execute in the context of the real-time thread.
@@ -92,6 +99,8 @@ const uint32 NI6368ADC_EXEC_SPAWNED = 2u;
  *     ScanIntervalCounterDelay = 2 //Mandatory. Minimum delay after the start trigger.
  *     CPUs = 0xf //Optional and only relevant if ExecutionMode==IndependentThread. CPU affinity for the thread which reads data from the board.
  *     RealTimeMode = 0 //Optional and onle relevant if ExecutionMode==IndependentThread. If 1 it will busy sleep on the synchronisation semaphores.
+ *     HeapName = "HugePageHeap" //Optional. Name of the heap (e.g. a HugePageHeap) where the cycle buffers are allocated. Default = GlobalObjectsDatabase::Instance()->GetStandardHeap().
+ *     NumberOfBuffers = 8 //Optional. Number of cycle buffers (2 <= NumberOfBuffers <= 64) in the ring between the DMA and the real-time thread. Default value 8.
  *     Signals = {
  *          Counter = { //Mandatory. Number of ticks since last state change.
  *              Type = uint32 //int32 also supported.
@@ -111,6 +120,12 @@ const uint32 NI6368ADC_EXEC_SPAWNED = 2u;
  *     }
  * }
  * </pre>
+ *
+ * The acquired blocks (NumberOfSamples per channel) are stored in a ring of NumberOfBuffers cycle buffers. If the real-time thread
+ * falls behind, the Synchronise returns immediately while there are blocks already acquired, so that the real-time thread catches up
+ * by consuming one block per cycle without waiting (with ExecutionMode = RealTimeThread the DMA is still drained into the ring at every Synchronise).
+ * If the real-time thread falls behind by the whole ring, the oldest block is dropped, the number of overruns (see GetNumberOfOverruns)
+ * is incremented and a warning is reported by the next Synchronise.
  */
 class NI6368ADC: public DataSourceI, public EmbeddedServiceMethodBinderI {
 public:
@@ -136,7 +151,7 @@ NI6368ADC    ();
 
     /**
      * @brief See DataSourceI::GetNumberOfMemoryBuffers.
-     * @return NUMBER_OF_BUFFERS.
+     * @return the NumberOfBuffers (NUMBER_OF_BUFFERS by default).
      */
     virtual uint32 GetNumberOfMemoryBuffers();
 
@@ -173,6 +188,8 @@ NI6368ADC    ();
 
     /**
      * @brief Waits on an EventSem for the requested number of samples to be acquired for all the channels.
+     * @details Does not wait if there are blocks already acquired and not yet read (the real-time thread fell behind).
+     * Reports a warning if blocks were dropped since the last call.
      * @return true if the semaphore is successfully posted.
      */
     virtual bool Synchronise();
@@ -190,6 +207,12 @@ NI6368ADC    ();
      */
     uint8 GetLastBufferIdx();
 
+    /**
+     * @brief Gets the number of blocks dropped because the real-time thread fell behind by the whole ring of buffers.
+     * @return the number of blocks dropped.
+     */
+    uint32 GetNumberOfOverruns() const;
+
     /**
      * @brief Returns true if there is one GAM synchronising on this board.
      * @return true if there is one GAM synchronising on this board.
@@ -242,7 +265,8 @@ private:
     /**
      * @brief Copies from the DMA memory into the broker memory.
      * @details The DMA memory is organised in a different way (see xseries-lib.h) w.r.t. to the broker memory.
-     * This function maps the DMA memory into the broker memory.
+     * This function maps the DMA memory into the broker memory, de-interleaving the samples straight from the DMA
+     * (starting at dmaOffset and rolling to the beginning of the DMA if needed) with the DMADeinterleaver.
      * @param numberOfSamplesFromDMA number of samples to copy between memories.
      * @return ErrorManagement::FatalError if the semaphore cannot be posted.
      */
@@ -263,11 +287,31 @@ private:
      */
     uint32 *timeValue;
 
+    /**
+     * The heap where the signal memory is allocated (see HeapName).
+     */
+    HeapI *memoryHeap;
+
     /**
      * The last time value (for error checking)
      */
     uint32 lastTimeValue;
 
+    /**
+     * The number of cycle buffers in the ring.
+     */
+    uint32 numberOfBuffers;
+
+    /**
+     * The number of blocks dropped because the consumer fell behind by the whole ring.
+     */
+    volatile uint32 numberOfOverruns;
+
+    /**
+     * The number of overruns already reported by the Synchronise.
+     */
+    uint32 lastNumberOfOverruns;
+
     /**
      * The EmbeddedThread where the Execute method waits for the ADC data to be available.
      */
@@ -346,7 +390,7 @@ private:
     /**
      * The signals memory
      */
-    int16 *channelsMemory[NUMBER_OF_BUFFERS][NI6368ADC_MAX_CHANNELS];
+    int16 *channelsMemory[NI6368ADC_MAX_NUMBER_OF_BUFFERS][NI6368ADC_MAX_CHANNELS];
 
     /**
      * Maps the signal index in the signal list to the channel id
@@ -363,16 +407,6 @@ private:
      */
     size_t dmaOffset;
 
-    /**
-     * The memory where the DMA is copied to.
-     */
-    int16 *dmaReadBuffer;
-
-    /**
-     * The current DMA channel being copied.
-     */
-    size_t dmaChannel;
-
     /**
      * Total number of DMA bytes from the beginning
      */
@@ -389,9 +423,9 @@ private:
     uint8 lastBufferIdx;
 
     /**
-     * The number of samples written to the current buffer.
+     * De-interleaves the DMA into the current buffer (keeps the current DMA channel and the number of samples written to the current buffer).
      */
-    uint32 currentBufferOffset;
+    DMADeinterleaver<int16> deinterleaver;
 
     /**
      * The ADCs that are enabled
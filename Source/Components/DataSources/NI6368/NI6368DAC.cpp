@@ -50,6 +50,9 @@ NI6368DAC::NI6368DAC() :
     deviceName = "";
     numberOfDACsEnabled = 0u;
     triggerSet = false;
+    waveformMode = false;
+    preloadBlocks = 2u;
+    preloadedBlocks = 0u;
 
     startTriggerSource = XSERIES_AO_START_TRIGGER_SW_PULSE;
     startTriggerPolarity = XSERIES_AO_POLARITY_RISING_EDGE;
@@ -707,6 +710,34 @@ bool NI6368DAC::Initialise(StructuredDataI& data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "The UpdateIntervalCounterDelay shall be > 0");
         }
     }
+    if (ok) {
+        StreamString outputMode;
+        if (!data.Read("OutputMode", outputMode)) {
+            outputMode = "Static";
+        }
+        if (outputMode == "Static") {
+            waveformMode = false;
+        }
+        else if (outputMode == "Waveform") {
+            waveformMode = true;
+        }
+        else {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "Unsupported OutputMode. Possible values: Static, Waveform");
+        }
+    }
+    if (ok) {
+        if (waveformMode) {
+            if (!data.Read("PreloadBlocks", preloadBlocks)) {
+                preloadBlocks = 2u;
+                REPORT_ERROR(ErrorManagement::Information, "No PreloadBlocks specified. Using %u", preloadBlocks);
+            }
+            ok = (preloadBlocks > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The PreloadBlocks shall be > 0");
+            }
+        }
+    }
 
     //Get individual signal parameters
     uint32 i = 0u;
@@ -799,6 +830,7 @@ bool NI6368DAC::SetConfiguredDatabase(StructuredDataI& data) {
     }
     if (ok) {
         uint32 j = 0u;
+        size_t blockNumberOfElements = 0u;
         for (i = 0u; (i < NI6368DAC_MAX_CHANNELS) && (ok); i++) {
             if (dacEnabled[i]) {
                 ok = (GetSignalType(j) == Float32Bit);
@@ -810,6 +842,14 @@ bool NI6368DAC::SetConfiguredDatabase(StructuredDataI& data) {
                     ok = GetSignalNumberOfElements(j, nElements);
                     numberOfElements[i] = nElements;
                 }
+                //In Waveform mode all the channels are updated together by the update interval counter
+                if ((ok) && (waveformMode) && (j > 0u)) {
+                    ok = (numberOfElements[i] == blockNumberOfElements);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "With OutputMode = Waveform all the DAC signals shall have the same number of elements");
+                    }
+                }
+                blockNumberOfElements = numberOfElements[i];
                 j++;
             }
         }
@@ -860,6 +900,9 @@ bool NI6368DAC::SetConfiguredDatabase(StructuredDataI& data) {
         }
     }
     xseries_ao_conf_t dacConfiguration = xseries_static_ao();
+    if (waveformMode) {
+        dacConfiguration = xseries_continuous_ao();
+    }
     if (ok) {
         ok = (xseries_set_ao_start_trigger(&dacConfiguration, startTriggerSource, startTriggerPolarity, 1u) == 0);
         if (!ok) {
@@ -919,7 +962,8 @@ bool NI6368DAC::SetConfiguredDatabase(StructuredDataI& data) {
             }
         }
     }
-    if (ok) {
+    //In Waveform mode the board is started by the Synchronise after preloading the FIFO
+    if ((ok) && (!waveformMode)) {
         ok = (xseries_start_ao(boardFileDescriptor) == 0);
         if (!ok) {
             REPORT_ERROR(ErrorManagement::ParametersError, "Could not start the device %s", fullDeviceName);
@@ -949,6 +993,15 @@ bool NI6368DAC::Synchronise() {
             }
         }
     }
+    if ((ok) && (waveformMode) && (preloadedBlocks < preloadBlocks)) {
+        preloadedBlocks++;
+        if (preloadedBlocks == preloadBlocks) {
+            ok = (xseries_start_ao(boardFileDescriptor) == 0);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the device after preloading %u blocks", preloadBlocks);
+            }
+        }
+    }
     return ok;
 }
 
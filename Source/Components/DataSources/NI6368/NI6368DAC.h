@@ -63,6 +63,8 @@ const uint32 NI6368DAC_MAX_CHANNELS = 4u;
  *     UpdateIntervalCounterPolarity = "RISING_EDGE" //Mandatory. Possible values: RISING_EDGE, FALLING_EDGE
  *     UpdateIntervalCounterDivisor = 100000 //Mandatory > 0
  *     UpdateIntervalCounterDelay = 2 //Mandatory > 0
+ *     OutputMode = "Static" //Optional. Possible values: Static, Waveform. Default value Static.
+ *     PreloadBlocks = 2 //Optional and only relevant if OutputMode == Waveform. Number of blocks written before starting the board (> 0). Default value 2.
  *     Signals = {
  *         DAC0_0 = {
  *             Type = float32 //Mandatory. Only type that is supported.
@@ -73,6 +75,13 @@ const uint32 NI6368DAC_MAX_CHANNELS = 4u;
  * }
  * </pre>
  * Note that at least one of the GAMs writing to this DataSource must have set one of the signals with Trigger=1 (which forces the writing of all the signals to the DAC).
+ *
+ * With OutputMode = Waveform the board is configured for continuous generation and every Synchronise streams a block of NumberOfElements
+ * samples per channel (e.g. generated by a WaveformGAM) into the AO FIFO, from where the samples are output at the rate of the update interval counter
+ * (i.e. decoupled from the real-time cycle rate). All the DAC signals shall have the same NumberOfElements.
+ * The board is only started after PreloadBlocks blocks were written, so that the FIFO is always PreloadBlocks blocks ahead of the hardware
+ * updates and an occasionally late cycle does not underrun the output. If the FIFO is full the Synchronise waits for the hardware to free space,
+ * so that the real-time thread is paced by the update interval counter.
  */
 class NI6368DAC: public DataSourceI {
 public:
@@ -159,6 +168,8 @@ NI6368DAC    ();
      * - At least one triggering signal was requested by a GAM (with the property Trigger = 1)
      * - All the DAC channels have type float32.
      * - The number of samples of all the DAC channels is the same.
+     * - If OutputMode = Waveform, the number of elements of all the DAC channels is the same.
+     * The board is started, unless OutputMode = Waveform (see Synchronise).
      * @return true if all the parameters are valid and consistent with the board parameters and if the board can be successfully configured with
      *  these parameters.
      */
@@ -166,7 +177,8 @@ NI6368DAC    ();
 
     /**
      * @details Writes the value of all the DAC channels to the board.
-     * @return true if the writing of all the channels is successful.
+     * If OutputMode = Waveform the board is started after PreloadBlocks blocks were written.
+     * @return true if the writing of all the channels (and the start of the board) is successful.
      */
     virtual bool Synchronise();
 
@@ -269,6 +281,21 @@ private:
      */
     bool triggerSet;
 
+    /**
+     * True if OutputMode = Waveform.
+     */
+    bool waveformMode;
+
+    /**
+     * The number of blocks to write before starting the board (OutputMode = Waveform).
+     */
+    uint32 preloadBlocks;
+
+    /**
+     * The number of blocks written before starting the board.
+     */
+    uint32 preloadedBlocks;
+
 };
 }
 
@@ -24,14 +24,18 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <errno.h>
 #include <fcntl.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "GlobalObjectsDatabase.h"
+#include "HighResolutionTimer.h"
 #include "MemoryMapSynchronisedInputBroker.h"
 #include "MemoryMapSynchronisedOutputBroker.h"
+#include "MemoryOperationsHelper.h"
 
 #include "NI6368DIO.h"
 
@@ -70,6 +74,10 @@ NI6368DIO::NI6368DIO() :
     inputPortMask = 0u;
     outputPortMask = 0u;
     portValue = 0u;
+    changeDetectionMode = false;
+    events = NULL_PTR(uint32 *);
+    numberOfEvents = 0u;
+    eventFIFODepth = 0u;
 }
 
 /*lint -e{1551} the destructor must guarantee that all the file descriptors are closed. */
@@ -87,10 +95,25 @@ NI6368DIO::~NI6368DIO() {
         }
         close(boardFileDescriptor);
     }
+    if (events != NULL_PTR(uint32 *)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(events));
+    }
 }
 
 bool NI6368DIO::AllocateMemory() {
-    return true;
+    bool ok = true;
+    if (changeDetectionMode) {
+        /*lint -e{9079} -e{928} allocated as uint32 (two words per event).*/
+        events = reinterpret_cast<uint32 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(2u * eventFIFODepth * static_cast<uint32>(sizeof(uint32))));
+        ok = (events != NULL_PTR(uint32 *));
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(events, '\0', 2u * eventFIFODepth * static_cast<uint32>(sizeof(uint32)));
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate the memory for the events");
+        }
+    }
+    return ok;
 }
 
 uint32 NI6368DIO::GetNumberOfMemoryBuffers() {
@@ -99,8 +122,27 @@ uint32 NI6368DIO::GetNumberOfMemoryBuffers() {
 
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: The memory buffer is independent of the bufferIdx.*/
 bool NI6368DIO::GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bufferIdx, void*& signalAddress) {
-    signalAddress = &portValue;
-    return (signalIdx == 0u);
+    bool ok = (signalIdx == 0u);
+    if (ok) {
+        signalAddress = &portValue;
+    }
+    else if (changeDetectionMode) {
+        if (signalIdx == 1u) {
+            signalAddress = &numberOfEvents;
+            ok = true;
+        }
+        else if (signalIdx == 2u) {
+            signalAddress = events;
+            ok = (events != NULL_PTR(uint32 *));
+        }
+        else {
+            ok = false;
+        }
+    }
+    else {
+        ok = false;
+    }
+    return ok;
 }
 
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: The broker name depends only on the direction.*/
@@ -971,6 +1013,27 @@ bool NI6368DIO::Initialise(StructuredDataI& data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "The UpdateIntervalCounterDelay shall be > 0");
         }
     }
+    if (ok) {
+        StreamString inputMode;
+        if (!data.Read("InputMode", inputMode)) {
+            inputMode = "Static";
+            REPORT_ERROR(ErrorManagement::Information, "No InputMode specified. Using Static");
+        }
+        if (inputMode == "Static") {
+            changeDetectionMode = false;
+        }
+        else if (inputMode == "ChangeDetection") {
+            changeDetectionMode = true;
+            ok = (clockSampleSource == XSERIES_DI_SAMPLE_CONVERT_CLOCK_DIO_CHGDETECT);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The ClockSampleSource shall be DIO_CHGDETECT when InputMode = ChangeDetection");
+            }
+        }
+        else {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "Unsupported InputMode %s", inputMode.Buffer());
+        }
+    }
 
     if (ok) {
         ok = data.MoveRelative("Signals");
@@ -1016,6 +1079,39 @@ bool NI6368DIO::SetConfiguredDatabase(StructuredDataI& data) {
     if (!ok) {
         REPORT_ERROR(ErrorManagement::ParametersError, "All the DIO signals shall have one and only one element.");
     }
+    if ((ok) && (changeDetectionMode)) {
+        ok = (GetNumberOfSignals() == 3u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "In ChangeDetection mode exactly three signals shall be defined (port, number of events and events)");
+        }
+        if (ok) {
+            ok = ((GetSignalType(1u) == UnsignedInteger32Bit) && (GetSignalType(2u) == UnsignedInteger32Bit));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The number of events and the events signals shall be of type UnsignedInteger32Bit");
+            }
+        }
+        if (ok) {
+            ok = (GetSignalNumberOfElements(1u, nElements));
+        }
+        if (ok) {
+            ok = (nElements == 1u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The number of events signal shall have one and only one element");
+            }
+        }
+        if (ok) {
+            ok = (GetSignalNumberOfElements(2u, nElements));
+        }
+        if (ok) {
+            ok = ((nElements > 0u) && ((nElements % 2u) == 0u));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The events signal shall have an even number of elements (port value and timestamp of each event)");
+            }
+        }
+        if (ok) {
+            eventFIFODepth = (nElements / 2u);
+        }
+    }
 
     uint32 nOfFunctions = GetNumberOfFunctions();
     uint32 functionIdx;
@@ -1086,7 +1182,13 @@ bool NI6368DIO::SetConfiguredDatabase(StructuredDataI& data) {
     }
 
     if (inputsEnabled) {
-        xseries_di_conf_t diConfiguration = xseries_static_di(inputPortMask);
+        xseries_di_conf_t diConfiguration;
+        if (changeDetectionMode) {
+            diConfiguration = xseries_continuous_di(inputPortMask);
+        }
+        else {
+            diConfiguration = xseries_static_di(inputPortMask);
+        }
 
         if (ok) {
             ok = (xseries_set_di_sample_clock(&diConfiguration, clockSampleSource, clockSamplePolarity) == 0);
@@ -1152,7 +1254,10 @@ bool NI6368DIO::SetConfiguredDatabase(StructuredDataI& data) {
 
 bool NI6368DIO::Synchronise() {
     bool ok = (xseries_write_do(boardFileDescriptor, &portValue, 1UL) == 1);
-    if (ok) {
+    if ((ok) && (changeDetectionMode)) {
+        ok = ReadEvents();
+    }
+    else if (ok) {
         //EAGAIN is OK
         ssize_t ret = xseries_read_di(boardFileDescriptor, &portValue, 1UL);
         if (ret != 1) {
@@ -1162,6 +1267,29 @@ bool NI6368DIO::Synchronise() {
     return ok;
 }
 
+bool NI6368DIO::ReadEvents() {
+    bool ok = true;
+    //All the events latched since the last cycle are read with one call, the first half of the events buffer is used as the read buffer
+    ssize_t ret = xseries_read_di(boardFileDescriptor, events, static_cast<size_t>(eventFIFODepth));
+    if (ret > 0) {
+        numberOfEvents = static_cast<uint32>(ret);
+        uint32 timestamp = static_cast<uint32>(HighResolutionTimer::Counter());
+        portValue = events[numberOfEvents - 1u];
+        //Spread backwards into (port value, timestamp) pairs, so that no value is overwritten before being moved
+        uint32 e;
+        for (e = numberOfEvents; e > 0u; e--) {
+            events[2u * (e - 1u)] = events[e - 1u];
+            events[(2u * (e - 1u)) + 1u] = timestamp;
+        }
+    }
+    else {
+        //No change since the last cycle (EAGAIN is OK)
+        numberOfEvents = 0u;
+        ok = ((ret == 0) || (ret == EAGAIN) || (errno == EAGAIN));
+    }
+    return ok;
+}
+
 bool NI6368DIO::ReadDIOConfiguration(xseries_di_conf_t * const confDI, xseries_do_conf_t * const confDO) const {
     bool ok = false;
     if (boardFileDescriptor > 0) {
@@ -65,6 +65,7 @@ namespace MARTe {
  *     UpdateIntervalCounterPolarity = "RISING_EDGE" //Mandatory. Possible values: RISING_EDGE, FALLING_EDGE
  *     UpdateIntervalCounterDivisor = 100000 //Mandatory > 0
  *     UpdateIntervalCounterDelay = 2 //Mandatory > 0
+ *     InputMode = "Static" //Optional. Possible values: Static, ChangeDetection. Default = Static.
  *     Signals = {
  *         DIO0_0 = {
  *             Type = uint32 //Mandatory. Only type that is supported.
@@ -74,6 +75,21 @@ namespace MARTe {
  *     }
  * }
  * </pre>
+ *
+ * With InputMode = "ChangeDetection" the digital input is sampled by the board change detection (ClockSampleSource shall be DIO_CHGDETECT),
+ * so that each edge on the input port latches one port value in the DI FIFO. Two additional signals shall then be declared:
+ * <pre>
+ *         NumberOfEvents = {
+ *             Type = uint32 //Mandatory. Number of events read in the last cycle.
+ *         }
+ *         Events = {
+ *             Type = uint32 //Mandatory.
+ *             NumberOfElements = 32 //Mandatory. Even. Holds up to NumberOfElements / 2 (port value, timestamp) pairs.
+ *         }
+ * </pre>
+ * All the events latched since the previous cycle are read with a single read of the DI FIFO and the port signal is updated with the
+ * latest port value (it is left unchanged when no edge occurred). The DI FIFO entries carry no time information, so the timestamp of each
+ * event is the HighResolutionTimer::Counter (lower 32 bits) at which it was read: the events of one cycle share the same timestamp and are in order.
  */
 
 class NI6368DIO: public DataSourceI {
@@ -93,7 +109,8 @@ NI6368DIO    ();
 
     /**
      * @brief See DataSourceI::AllocateMemory.
-     * @return true.
+     * @details If InputMode = ChangeDetection allocates the memory of the Events signal.
+     * @return true if the memory can be allocated.
      */
     virtual bool AllocateMemory();
 
@@ -164,13 +181,15 @@ NI6368DIO    ();
      * - The DIO channel has type uint32.
      * - The number of samples of the DIO channel is exactly one.
      * - The number of elements of the DIO channel is exactly one.
+     * - With InputMode = ChangeDetection, the NumberOfEvents and Events signals are declared as in the class description.
      * @return true if all the parameters are valid and consistent with the board parameters and if the board can be successfully configured with
      *  these parameters.
      */
     virtual bool SetConfiguredDatabase(StructuredDataI & data);
 
     /**
-     * @details Writes the value of all the DIO channels to the board, followed by a read of all the DIO channels from the board.
+     * @details Writes the value of all the DIO channels to the board, followed by a read of all the DIO channels from the board
+     * (or of all the events latched since the last cycle if InputMode = ChangeDetection).
      * @return true if the reading and writing of all the channels is successful.
      */
     virtual bool Synchronise();
@@ -184,6 +203,12 @@ NI6368DIO    ();
     bool ReadDIOConfiguration(xseries_di_conf_t *confDI, xseries_do_conf_t *confDO) const;
 private:
 
+    /**
+     * @brief Reads all the events latched in the DI FIFO since the last cycle.
+     * @return true if the DI FIFO could be read (or if it was empty).
+     */
+    bool ReadEvents();
+
     /**
      * The board identifier
      */
@@ -214,6 +239,26 @@ private:
      */
     uint32 portValue;
 
+    /**
+     * True if InputMode = ChangeDetection.
+     */
+    bool changeDetectionMode;
+
+    /**
+     * The (port value, timestamp) pairs of the events read in the last cycle.
+     */
+    uint32 *events;
+
+    /**
+     * The number of events read in the last cycle.
+     */
+    uint32 numberOfEvents;
+
+    /**
+     * The maximum number of events read in one cycle.
+     */
+    uint32 eventFIFODepth;
+
     /**
      * True if this board is used to write digital values.
      */
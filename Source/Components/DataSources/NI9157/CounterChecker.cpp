@@ -116,18 +116,18 @@ bool CounterChecker::Check(uint8 *sample,
 
     bool ret = true;
     write = true;
+    const uint64 valueMask = GetSampleValueMask();
 
     if (packetCounter == nextPacketCheck) {
-        ret = (MemoryOperationsHelper::Compare(&packetCounter, sample, sampleSize) == 0);
+        ret = (ReadSample(sample) == (packetCounter & valueMask));
     }
     if (ret) {
         nextPacketCheck = (packetCounter + checkCounterAfterNSteps);
         packetCounter += counterStep;
         //before the first packet, check each packet
         if (acquireFromCounter > 0ull) {
-            /*lint -e{340} -e{928} -e{927} -e{826} -e{740} Allowed cast from pointer to pointer*/
             /*lint -e{613} NULL pointer checked*/
-            if (MemoryOperationsHelper::Compare(&(sample[0]), reinterpret_cast<uint8*>((&acquireFromCounter)), sampleSize) != 0) {
+            if (ReadSample(&(sample[0])) != (acquireFromCounter & valueMask)) {
                 nextPacketCheck = packetCounter;
                 //return without adding nothing to the circular buffer
                 write = false;
@@ -150,30 +150,37 @@ bool CounterChecker::Synchronise(uint8 *frames,
     write = true;
     uint32 syncCnt = 1u;
     uint64 candidate = 0ull;
+    const uint64 valueMask = GetSampleValueMask();
     idx = 0u;
 
-    while (idx < sizeToRead) {
-        //try all the elements and compare them with the relative ones in the other frames
-        candidate = 0ull;
-        /*lint -e{340} -e{534} -e{927} -e{928} -e{826} -e{740} Allowed cast from pointer to pointer*/
-        MemoryOperationsHelper::Copy(reinterpret_cast<uint8*>(&candidate), reinterpret_cast<uint8*>(&frames[idx]), sampleSize);
-        syncCnt = 1u;
-        for (uint32 j = 1u; (j < nFrameForSync) && (syncCnt < nFrameForSync); j++) {
-            /*lint -e{9123} -e{647} allowed cast to larger type*/
-            uint64 nextCandidate = candidate + static_cast<uint64>(j * counterStep);
-            uint32 index = (j * sizeToRead) + idx;
-            /*lint -e{340} -e{927} -e{928} -e{826} -e{740} Allowed cast from pointer to pointer*/
-            if (MemoryOperationsHelper::Compare(reinterpret_cast<uint8*>(&nextCandidate), reinterpret_cast<uint8*>(&frames[index]), sampleSize) == 0) {
-                syncCnt++;
-            }
-            else {
-                break;
+    if ((sampleSize > 0u) && (nFrameForSync > 1u)) {
+        uint32 numberOfSamples = (sizeToRead / sampleSize);
+        uint32 s = 0u;
+        while (s < numberOfSamples) {
+            //find the next element which is followed by its value plus counterStep in the second frame, then compare it with the relative ones in the other frames
+            s += FindFirstStep(&frames[s * sampleSize], &frames[sizeToRead + (s * sampleSize)], (numberOfSamples - s), static_cast<uint64>(counterStep));
+            idx = (s * sampleSize);
+            if (s < numberOfSamples) {
+                candidate = ReadSample(&frames[idx]);
+                syncCnt = 2u;
+                for (uint32 j = 2u; (j < nFrameForSync) && (syncCnt < nFrameForSync); j++) {
+                    /*lint -e{9123} -e{647} allowed cast to larger type*/
+                    uint64 nextCandidate = candidate + static_cast<uint64>(j * counterStep);
+                    uint32 index = (j * sizeToRead) + idx;
+                    if (ReadSample(&frames[index]) == (nextCandidate & valueMask)) {
+                        syncCnt++;
+                    }
+                    else {
+                        break;
+                    }
+                }
+                if (syncCnt >= nFrameForSync) {
+                    break;
+                }
+                syncCnt = 1u;
+                s++;
             }
         }
-        if (syncCnt >= nFrameForSync) {
-            break;
-        }
-        idx += sampleSize;
     }
 
     bool ret = (syncCnt >= nFrameForSync);
@@ -192,9 +199,8 @@ bool CounterChecker::Synchronise(uint8 *frames,
 
         //before the first packet, check each packet
         if (acquireFromCounter > 0ull) {
-            /*lint -e{340} -e{928} -e{927} -e{826} -e{740} Allowed cast from pointer to pointer*/
             /*lint -e{613} NULL pointer checked*/
-            if (MemoryOperationsHelper::Compare(reinterpret_cast<uint8*>(&(frames[0])), reinterpret_cast<uint8*>((&acquireFromCounter)), sampleSize) != 0) {
+            if (ReadSample(&(frames[0])) != (acquireFromCounter & valueMask)) {
                 nextPacketCheck = packetCounter;
                 write = false;
             }
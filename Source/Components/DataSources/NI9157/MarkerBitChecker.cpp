@@ -84,17 +84,17 @@ bool MarkerBitChecker::Initialise(StructuredDataI &data) {
 /*lint -e{952} -e{578} parameter 'sample' not declared as const*/
 bool MarkerBitChecker::Check(uint8 *sample,
                              bool &write) {
-    bool ret;
+    bool ret = (sampleSize > 0u);
     write = true;
     uint64 temp = 0ull;
-    
-    ret = MemoryOperationsHelper::Copy(&temp, sample, sampleSize);
+
     if (ret) {
+        temp = ReadSample(sample);
         ret = ((temp & bitMask) != 0ull);
     }
     if (ret) {
         temp &= ~(resetBitMask);
-        ret = MemoryOperationsHelper::Copy(sample, &temp, sampleSize);
+        WriteSample(sample, temp);
     }
 
     return ret;
@@ -109,12 +109,14 @@ bool MarkerBitChecker::Synchronise(uint8 *frames,
     idx = 0u;
     write = true;
 
-    while (idx < sizeToRead) {
-        ret = Check(&frames[idx], write);
-        if (ret) {
-            break;
+    if (sampleSize > 0u) {
+        //search the marker in the whole frame and only check the first sample which has it
+        uint32 numberOfSamples = (sizeToRead / sampleSize);
+        uint32 s = FindFirstMasked(frames, numberOfSamples, bitMask);
+        idx = (s * sampleSize);
+        if (s < numberOfSamples) {
+            ret = Check(&frames[idx], write);
         }
-        idx += sampleSize;
     }
 
     return ret;
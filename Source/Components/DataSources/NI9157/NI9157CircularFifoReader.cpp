@@ -55,6 +55,13 @@ NI9157CircularFifoReader::NI9157CircularFifoReader() :
     numberOfPacketsInFIFO = 10u;
     acqTimeout = 0xFFFFFFFFu;
     nonBlockSleepT = 0.F;
+    maxPacketsPerRead = 1u;
+    batchBuffer = NULL_PTR(uint8 *);
+    batchPackets = 0u;
+    batchIndex = 0u;
+    nextBatchPackets = 1u;
+    nonTemporalCopy = 0u;
+    copyKernel = &NI9157MemoryOperationsHelper::CopyU8;
     if (eventSem.Create()) {
         REPORT_ERROR(ErrorManagement::Information, "NI9157CircularFifoReader::NI9157CircularFifoReader EventSem successfully created");
     }
@@ -75,6 +82,10 @@ NI9157CircularFifoReader::~NI9157CircularFifoReader() {
         delete[] middleBuffer;
         middleBuffer = NULL_PTR(uint8 *);
     }
+    if (batchBuffer != NULL_PTR(uint8 *)) {
+        delete[] batchBuffer;
+        batchBuffer = NULL_PTR(uint8 *);
+    }
 }
 
 bool NI9157CircularFifoReader::Synchronise() {
@@ -133,6 +144,18 @@ bool NI9157CircularFifoReader::Initialise(StructuredDataI &data) {
         if (!data.Read("NonBlockSleepT", nonBlockSleepT)) {
             acqTimeout = 0xFFFFFFFFu;
         }
+        if (!data.Read("NonTemporalCopy", nonTemporalCopy)) {
+            nonTemporalCopy = 0u;
+        }
+        if (!data.Read("MaxPacketsPerRead", maxPacketsPerRead)) {
+            maxPacketsPerRead = 1u;
+        }
+        ret = (maxPacketsPerRead > 0u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "NI9157CircularFifoReader::Initialise - MaxPacketsPerRead must be > 0");
+        }
+    }
+    if (ret) {
         if (checkFrame > 0u) {
             ret = false;
             /*lint -e{9113} -e{9131} known dependence*/
@@ -184,6 +207,10 @@ bool NI9157CircularFifoReader::SetConfiguredDatabase(StructuredDataI & data) {
                             totalReadSize = signalByteSize;
                             uint32 size = (totalReadSize * nFrameForSync);
                             middleBuffer = new uint8[size];
+                            if (maxPacketsPerRead > 1u) {
+                                batchBuffer = new uint8[totalReadSize * maxPacketsPerRead];
+                            }
+                            copyKernel = NI9157MemoryOperationsHelper::GetCopyKernel(sampleByteSize, totalReadSize, (nonTemporalCopy > 0u));
                             break;
                         }
                     }
@@ -255,6 +282,9 @@ bool NI9157CircularFifoReader::PrepareNextState(const char8 * const currentState
         if (ret) {
             uint32 maxSize = (totalReadSize * nFrameForSync);
             (void) MemoryOperationsHelper::Set(middleBuffer, '\0', maxSize);
+            batchPackets = 0u;
+            batchIndex = 0u;
+            nextBatchPackets = 1u;
             stop = 0;
             ret = CircularBufferThreadInputDataSource::PrepareNextState(currentStateName, nextStateName);
         }
@@ -292,26 +322,57 @@ bool NI9157CircularFifoReader::DriverRead(char8 * const bufferToFill, uint32 &si
         runNi = 0u;
         REPORT_ERROR(ret ? ErrorManagement::Information : ErrorManagement::FatalError, "NI9157CircularFifoReader::DriverRead Run call returned %s with status %d", ret ? "true" : "false" , static_cast<int32>(status));
     }
+    //the packet to be checked and put in the circular buffer
+    uint8 *packet = middleBuffer;
     if (ret) {
-        uint32 fifoRemaining = 0u;
-        /*lint -e{613} -e{414} NULL pointer is checked and division by 0 checked*/
-        NiFpga_Status status = niDeviceOperator->NiReadFifo(fifoDev, reinterpret_cast<uint8*> (&(middleBuffer[0])),
-                                (sizeToRead / sampleByteSize), acqTimeout, fifoRemaining);
-        if (!IsEqual(nonBlockSleepT, 0.F)) {
-            while(status == NiFpga_Status_FifoTimeout){
-                Sleep::Sec(nonBlockSleepT);
-                /*lint -e{613} -e{414} NULL pointer is checked and division by 0 checked*/
-                status = niDeviceOperator->NiReadFifo(fifoDev, reinterpret_cast<uint8*> (&(middleBuffer[0])),
-                                (sizeToRead / sampleByteSize), acqTimeout, fifoRemaining);
-            }
+        if (batchIndex < batchPackets) {
+            //the packet was already read from the FIFO with the last batch
+            /*lint -e{613} NULL pointer checked*/
+            packet = &batchBuffer[batchIndex * sizeToRead];
+            batchIndex++;
         }
-        ret = (status == 0);
-        if (status == NiFpga_Status_FifoTimeout) {
-            if (errorCheckSignalIndex != 0xFFFFFFFFu) {
-                uint32 index1 = (currentBuffer[errorCheckSignalIndex]);
-                uint32 errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index1) * static_cast<uint32> (sizeof(uint32))));
-                /*lint -e{340} -e{927} -e{826} -e{740} Allowed cast from pointer to pointer*/
-                *reinterpret_cast<uint32*> (&(memory[errorMemIndex])) |= 4u;
+        else {
+            uint32 fifoRemaining = 0u;
+            /*lint -e{414} division by 0 checked*/
+            uint32 packetElements = (sizeToRead / sampleByteSize);
+            uint32 packetsToRead = 1u;
+            if (maxPacketsPerRead > 1u) {
+                packet = batchBuffer;
+                packetsToRead = nextBatchPackets;
+            }
+            /*lint -e{613} NULL pointer is checked*/
+            NiFpga_Status status = niDeviceOperator->NiReadFifo(fifoDev, packet, (packetsToRead * packetElements), acqTimeout, fifoRemaining);
+            if (!IsEqual(nonBlockSleepT, 0.F)) {
+                while(status == NiFpga_Status_FifoTimeout){
+                    Sleep::Sec(nonBlockSleepT);
+                    /*lint -e{613} NULL pointer is checked*/
+                    status = niDeviceOperator->NiReadFifo(fifoDev, packet, (packetsToRead * packetElements), acqTimeout, fifoRemaining);
+                }
+            }
+            ret = (status == 0);
+            if (ret) {
+                batchPackets = packetsToRead;
+                batchIndex = 1u;
+                //read in the next batch the packets which are already waiting in the FIFO
+                if (packetElements > 0u) {
+                    nextBatchPackets = (fifoRemaining / packetElements) + 1u;
+                }
+                if (nextBatchPackets > maxPacketsPerRead) {
+                    nextBatchPackets = maxPacketsPerRead;
+                }
+            }
+            else {
+                batchPackets = 0u;
+                batchIndex = 0u;
+                nextBatchPackets = 1u;
+            }
+            if (status == NiFpga_Status_FifoTimeout) {
+                if (errorCheckSignalIndex != 0xFFFFFFFFu) {
+                    uint32 index1 = (currentBuffer[errorCheckSignalIndex]);
+                    uint32 errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index1) * static_cast<uint32> (sizeof(uint32))));
+                    /*lint -e{340} -e{927} -e{826} -e{740} Allowed cast from pointer to pointer*/
+                    *reinterpret_cast<uint32*> (&(memory[errorMemIndex])) |= 4u;
+                }
             }
         }
     }
@@ -319,9 +380,18 @@ bool NI9157CircularFifoReader::DriverRead(char8 * const bufferToFill, uint32 &si
     if ((checkFrame > 0u) && (ret)) {
         //check the frame
         /*lint -e{613} NULL pointer checked*/
-        bool ok = checker->Check(reinterpret_cast<uint8*> (&(middleBuffer[0])), writeMemory);
+        bool ok = checker->Check(packet, writeMemory);
         if (!ok) {
             REPORT_ERROR(ErrorManagement::FatalError, "NI9157CircularFifoReader::DriverRead Checker returned false (failed to synchronise)");
+            //the re-sync procedure reads the following frames straight from the FIFO: the rest of the batch is dropped
+            if (packet != middleBuffer) {
+                /*lint -e{613} NULL pointer checked*/
+                (void) MemoryOperationsHelper::Copy(&(middleBuffer[0]), packet, sizeToRead);
+                packet = middleBuffer;
+            }
+            batchPackets = 0u;
+            batchIndex = 0u;
+            nextBatchPackets = 1u;
             //if the check fails
             if (errorCheckSignalIndex != 0xFFFFFFFFu) {
                 uint32 index1 = (currentBuffer[errorCheckSignalIndex]);
@@ -383,7 +453,7 @@ bool NI9157CircularFifoReader::DriverRead(char8 * const bufferToFill, uint32 &si
     if (ret) {
         if (writeMemory) {
             /*lint -e{613} NULL pointer checked*/
-            (void) MemoryOperationsHelper::Copy(bufferToFill, &(middleBuffer[0]), sizeToRead);
+            copyKernel(reinterpret_cast<uint8 *>(bufferToFill), packet, sizeToRead);
             if (numberOfInterleavedSamples[signalIdx] > 0u) {
                 uint32 cnt = 0u;
                 for (uint32 x = 0u; x < signalIdx; x++) {
@@ -391,10 +461,10 @@ bool NI9157CircularFifoReader::DriverRead(char8 * const bufferToFill, uint32 &si
                 }
                 if (headerSize[signalIdx] > 0u) {
                     /*lint -e{613} NULL pointer checked*/
-                    ret = MemoryOperationsHelper::Copy(bufferToFill, middleBuffer, headerSize[signalIdx]);
+                    ret = MemoryOperationsHelper::Copy(bufferToFill, packet, headerSize[signalIdx]);
                 }
                 /*lint -e{613} NULL pointer checked*/
-                NI9157MemoryOperationsHelper::InterleavedToFlat(&(middleBuffer[headerSize[signalIdx]]),
+                NI9157MemoryOperationsHelper::InterleavedToFlat(&(packet[headerSize[signalIdx]]),
                                                                 reinterpret_cast<uint8*> (&bufferToFill[headerSize[signalIdx]]), cnt,
                                                                 &interleavedPacketMemberByteSize[0], interleavedSignalByteSize[signalIdx],
                                                                 numberOfInterleavedSignalMembers[signalIdx], numberOfInterleavedSamples[signalIdx]);
@@ -453,6 +523,9 @@ ErrorManagement::ErrorType NI9157CircularFifoReader::StartAcquisition() {
         REPORT_ERROR(ErrorManagement::Information, "NI9157CircularFifoReader::StartAcquisition FIFO configured");
         uint32 maxSize = (totalReadSize * nFrameForSync);
         (void) MemoryOperationsHelper::Set(middleBuffer, '\0', maxSize);
+        batchPackets = 0u;
+        batchIndex = 0u;
+        nextBatchPackets = 1u;
         stop = 0;
     }
     if(err.ErrorsCleared()){
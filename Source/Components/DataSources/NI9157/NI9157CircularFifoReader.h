@@ -60,6 +60,13 @@ namespace MARTe {
  * file.
  * @details An internal thread is started in the PrepareNextState method and the object starts acquiring from the FIFO and putting the received packets in a
  * circular buffer (see CircularBufferThreadInputDataSource). The Synchronise method, allow the Brokers to get the address of the last written packet in the FIFO.
+ * @details If MaxPacketsPerRead > 1, the packets are read from the FIFO in batches. The size of each batch adapts to the number of elements
+ * which were left in the FIFO by the previous read (up to MaxPacketsPerRead packets), so that a backlog is drained with a few large NiReadFifo calls
+ * while a FIFO which is kept empty is still read one packet at a time. The packets of a batch are then checked and put in the circular buffer one at a time
+ * by the following DriverRead calls, without accessing the FIFO.
+ * @details The packets are copied into the circular buffer with a NI9157MemoryOperationsHelper copy kernel selected in SetConfiguredDatabase
+ * by the FIFO element size. If NonTemporalCopy = 1 and the packets are large enough (see NI9157MemoryOperationsHelper::GetCopyKernel), the copy
+ * bypasses the cache: useful when the packets are only going to be written to disk by the consumers.
  * @details If the signal vector parameter PacketMemberSizes is specified, a interleaved to flat operation (see InterleavedXFlat) is performed before putting the packet in the
  * circular buffer.
  * @details Follows a configuration example:
@@ -77,6 +84,8 @@ namespace MARTe {
  *     RunNi = 1 //if the NI9157Device has to be started by this data source
  *     Timeout = 0xFFFFFFFFu //The miliseconds timeout used by the NiFifoRead method calls within the DriverRead method.
  *     NonBlockSleepT = 0.F //if 0.F, no NiFifoReader call is repeated within the same DriverRead method call. if >0.F, corresponds to the sleep time in seconds between NiReadFifo calls within DriverRead.
+ *     MaxPacketsPerRead = 16 //the maximum number of packets read from the FIFO with a single NiReadFifo call (default 1).
+ *     NonTemporalCopy = 1 //if the packets are copied into the circular buffer with non-temporal stores (default 0).
  *     CounterStep = 2000 //the gap between two consecutive packet counters (default 1)
  *     CheckCounterAfterNSteps = 2000 //when the counter must be checked. It must be multiple of CounterStep (default is equal to CounterStep).
  *     FirstPacketCounter = 1 //the first packet counter that should be acquired from the device.
@@ -113,12 +122,16 @@ public:
      *   checkCounterAfterNSteps = 0u;\n
      *   counterStep = 1u;\n
      *   numberOfPacketsInFIFO = 10u;\n
+     *   maxPacketsPerRead = 1u;\n
+     *   batchBuffer = NULL_PTR(uint8 *);\n
+     *   nonTemporalCopy = 0u;\n
+     *   copyKernel = NI9157MemoryOperationsHelper::CopyU8;\n
      */
     NI9157CircularFifoReader();
 
     /**
      * @brief Destructor
-     * @details Frees the \a niDeviceOperator pointer and the \a middleBuffer memory.
+     * @details Frees the \a niDeviceOperator pointer and the \a middleBuffer and \a batchBuffer memory.
      */
     virtual ~NI9157CircularFifoReader();
 
@@ -129,6 +142,8 @@ public:
      *     NumberOfPacketsInFIFO: the number of packets in the host-side FIFO (default 10)\n
      *     FifoName: the name of the FIFO variable that can be found in the exported Labview header file.\n
      *     RunNi: if the NI9157Device has to be started by this data source\n
+     *     MaxPacketsPerRead: the maximum number of packets read from the FIFO with a single NiReadFifo call (default 1). It must be > 0.\n
+     *     NonTemporalCopy: if the packets are copied into the circular buffer with non-temporal stores (default 0).\n
      *     CheckFrame: if the first element is the packet counter (default 0)\n
      *     if (CheckFrame == 1) then the following parameters mean:\n
      *       NumOfFrameForSync: the number of packets to be used if the synchronisation is lost with the device (checking the packet counter). Default 2.\n
@@ -141,7 +156,8 @@ public:
     virtual bool Initialise(StructuredDataI &data);
 
     /**
-     * @brief Creates the \a niDeviceOperator and the \a middleBuffer memory.
+     * @brief Creates the \a niDeviceOperator, the \a middleBuffer and (if MaxPacketsPerRead > 1) the \a batchBuffer memory
+     * and selects the \a copyKernel.
      * @see CircularBufferThreadInputDataSource::SetConfiguredDatabase
      * @return false if the type of the signal is unsupported (not an integer or boolean type) causing the failure of the \a niDeviceOperator creation.
      */
@@ -164,6 +180,9 @@ public:
     /**
      * @brief Acquires a packet from the NI-9157 device and puts it in the circular buffer.
      * @see CircularBufferThreadInputDataSource::DriverRead
+     * @details If MaxPacketsPerRead > 1 and packets of the last batch are still to be consumed, the next one is taken from the \a batchBuffer.
+     * Otherwise a new batch is read from the FIFO, with as many packets as there were available in the FIFO after the previous read
+     * (at least one and up to MaxPacketsPerRead).
      * @details If CheckFrame==1, the method checks is the first element of the packet is coherent. In particular:
      *   - the counter of the N-th packet should be (FirstPacketCounter+N*CounterStep).\n
      *   - the counter is checked after (CheckCounterAfterNSteps/CounterStep)s acquisitions.\n
@@ -270,7 +289,41 @@ protected:
      * The sleep time between NiReadFifo calls within DriverRead in seconds.
      */
     float32 nonBlockSleepT;
-    
+
+    /**
+     * The maximum number of packets read from the FIFO with a single NiReadFifo call.
+     */
+    uint32 maxPacketsPerRead;
+
+    /**
+     * The buffer where the batches of packets are read (only used if maxPacketsPerRead > 1).
+     */
+    uint8 *batchBuffer;
+
+    /**
+     * The number of packets held in the \a batchBuffer.
+     */
+    uint32 batchPackets;
+
+    /**
+     * The index of the next packet to be consumed from the \a batchBuffer.
+     */
+    uint32 batchIndex;
+
+    /**
+     * The number of packets to be read in the next batch (known to be available in the FIFO after the previous read).
+     */
+    uint32 nextBatchPackets;
+
+    /**
+     * If the packets are copied into the circular buffer with non-temporal stores.
+     */
+    uint8 nonTemporalCopy;
+
+    /**
+     * The kernel used to copy the packets into the circular buffer.
+     */
+    NI9157MemoryOperationsHelper::CopyKernel copyKernel;
 };
 
 }
@@ -30,6 +30,9 @@
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
 #include "NI9157MxiDataSource.h"
 
 /*---------------------------------------------------------------------------*/
@@ -43,7 +46,9 @@ namespace MARTe {
 
 NI9157MxiDataSource::NI9157MxiDataSource() :
         MemoryDataSourceI(),
-        MessageI() {
+        MessageI(),
+        EmbeddedServiceMethodBinderI(),
+        executor(*this) {
 
     blockIfNotRunning = 0u;
     numberOfPacketsInFifo = 0u;
@@ -56,6 +61,29 @@ NI9157MxiDataSource::NI9157MxiDataSource() :
     initialPatterns = NULL_PTR(uint64 *);
     useInitialPattern = NULL_PTR(uint8 *);
     resetInitialPattern = NULL_PTR(uint8 *);
+    prefetchReads = 0u;
+    prefetchSignal = NULL_PTR(uint8 *);
+    prefetchMemory = NULL_PTR(uint8 *);
+    prefetchValid = NULL_PTR(uint8 *);
+    for (uint32 s = 0u; s < NI9157_MXI_PREFETCH_SLOTS; s++) {
+        prefetchFull[s] = 0;
+    }
+    prefetchWriteSlot = 0u;
+    prefetchSignalIdx = 0u;
+    prefetchReadSlot = 0u;
+    prefetchActive = false;
+    cpuMask = 0u;
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+    accessStatistics = NULL_PTR(NI9157MxiAccessStatistics *);
+    arraySignal = NULL_PTR(uint8 *);
+    groupedSignal = NULL_PTR(uint8 *);
+    for (uint32 g = 0u; g < 2u; g++) {
+        groupStatistics[g].numberOfAccesses = 0u;
+        groupStatistics[g].lastTicks = 0u;
+        groupStatistics[g].minTicks = 0xFFFFFFFFFFFFFFFFull;
+        groupStatistics[g].maxTicks = 0u;
+        groupStatistics[g].totalTicks = 0u;
+    }
 
     //Install message filter
     ReferenceT < RegisteredMethodsMessageFilter > filter = ReferenceT < RegisteredMethodsMessageFilter > (GlobalObjectsDatabase::Instance()->GetStandardHeap());
@@ -68,6 +96,9 @@ NI9157MxiDataSource::NI9157MxiDataSource() :
 /*lint -e{1551} possible thrown exception non critical*/
 NI9157MxiDataSource::~NI9157MxiDataSource() {
 
+    if (!StopPrefetch()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "NI9157MxiDataSource::~NI9157MxiDataSource Could not stop the prefetch thread.");
+    }
     if (niDevice != NULL_PTR(NI9157DeviceOperatorTI **)) {
         for (uint32 i = 0u; i < numberOfSignals; i++) {
             if (niDevice[i] != NULL_PTR(NI9157DeviceOperatorTI *)) {
@@ -99,6 +130,24 @@ NI9157MxiDataSource::~NI9157MxiDataSource() {
     if (resetInitialPattern != NULL_PTR(uint8 *)) {
         delete[] resetInitialPattern;
     }
+    if (prefetchSignal != NULL_PTR(uint8 *)) {
+        delete[] prefetchSignal;
+    }
+    if (prefetchMemory != NULL_PTR(uint8 *)) {
+        delete[] prefetchMemory;
+    }
+    if (prefetchValid != NULL_PTR(uint8 *)) {
+        delete[] prefetchValid;
+    }
+    if (accessStatistics != NULL_PTR(NI9157MxiAccessStatistics *)) {
+        delete[] accessStatistics;
+    }
+    if (arraySignal != NULL_PTR(uint8 *)) {
+        delete[] arraySignal;
+    }
+    if (groupedSignal != NULL_PTR(uint8 *)) {
+        delete[] groupedSignal;
+    }
     REPORT_ERROR(ErrorManagement::Information, "NI9157MxiDataSource::~NI9157MxiDataSource MXI Device closed.");
 }
 
@@ -134,6 +183,21 @@ bool NI9157MxiDataSource::Initialise(StructuredDataI & data) {
         if (!data.Read("BlockIfNotRunning", blockIfNotRunning)) {
             blockIfNotRunning = 0u;
         }
+        if (!data.Read("PrefetchReads", prefetchReads)) {
+            prefetchReads = 0u;
+        }
+        if (prefetchReads > 0u) {
+            if (!data.Read("PrefetchCPUMask", cpuMask)) {
+                cpuMask = 0u;
+            }
+            if (!data.Read("PrefetchStackSize", stackSize)) {
+                stackSize = THREADS_DEFAULT_STACKSIZE;
+            }
+            ret = (stackSize > 0u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "NI9157MxiDataSource::Initialise PrefetchStackSize shall be > 0");
+            }
+        }
     }
 
     REPORT_ERROR_PARAMETERS(ret ? ErrorManagement::Information : ErrorManagement::FatalError, "NI9157MxiDataSource::Initialise returning %s", ret ? "true" : "false");
@@ -158,6 +222,24 @@ bool NI9157MxiDataSource::SetConfiguredDatabase(StructuredDataI & data) {
         initialPatterns = new uint64[numberOfSignals];
         useInitialPattern = new uint8[numberOfSignals];
         resetInitialPattern = new uint8[numberOfSignals];
+        prefetchSignal = new uint8[numberOfSignals];
+        prefetchValid = new uint8[NI9157_MXI_PREFETCH_SLOTS * numberOfSignals];
+        accessStatistics = new NI9157MxiAccessStatistics[numberOfSignals];
+        arraySignal = new uint8[numberOfSignals];
+        groupedSignal = new uint8[numberOfSignals];
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            prefetchSignal[i] = 0u;
+            arraySignal[i] = 0u;
+            groupedSignal[i] = 0u;
+            accessStatistics[i].numberOfAccesses = 0u;
+            accessStatistics[i].lastTicks = 0u;
+            accessStatistics[i].minTicks = 0xFFFFFFFFFFFFFFFFull;
+            accessStatistics[i].maxTicks = 0u;
+            accessStatistics[i].totalTicks = 0u;
+        }
+        for (uint32 i = 0u; i < (NI9157_MXI_PREFETCH_SLOTS * numberOfSignals); i++) {
+            prefetchValid[i] = 0u;
+        }
         //Look for all the "PacketMemberSizes". Each signal is potentially a packet
         for (uint32 i = 0u; (i < numberOfSignals) && (ret); i++) {
             initialPatterns[i] = 0u;
@@ -178,6 +260,13 @@ bool NI9157MxiDataSource::SetConfiguredDatabase(StructuredDataI & data) {
                     useInitialPattern[i] = 1u;
                     resetInitialPattern[i] = useInitialPattern[i];
                 }
+                if (!signalsDatabase.Read("Array", arraySignal[i])) {
+                    arraySignal[i] = 0u;
+                }
+                if ((arraySignal[i] > 0u) && (useInitialPattern[i] > 0u)) {
+                    REPORT_ERROR_PARAMETERS(ErrorManagement::InitialisationError, "NI9157MxiDataSource::SetConfiguredDatabase InitialPattern is not supported for the array signal %s", signalName.Buffer());
+                    ret = false;
+                }
             }
         }
         for (uint32 i = 0u; (i < numberOfSignals) && (ret); i++) {
@@ -221,6 +310,16 @@ bool NI9157MxiDataSource::SetConfiguredDatabase(StructuredDataI & data) {
     return ret;
 }
 
+bool NI9157MxiDataSource::AllocateMemory() {
+
+    bool ret = MemoryDataSourceI::AllocateMemory();
+    if ((ret) && (prefetchReads > 0u)) {
+        prefetchMemory = new uint8[NI9157_MXI_PREFETCH_SLOTS * totalMemorySize];
+        ret = MemoryOperationsHelper::Set(prefetchMemory, '\0', (NI9157_MXI_PREFETCH_SLOTS * totalMemorySize));
+    }
+    return ret;
+}
+
 /*lint -e{715} currentStateName and nextStateName are not referenced*/
 bool NI9157MxiDataSource::PrepareNextState(const char8 * const currentStateName,
                                             const char8 * const nextStateName) {
@@ -263,6 +362,12 @@ bool NI9157MxiDataSource::PrepareNextState(const char8 * const currentStateName,
     prepare = (numberOfReadWriteNext > 0u && numberOfReadWriteCurrent == 0u) ||
             (numberOfReadWriteNext == numberOfReadWriteCurrent && numberOfReadWriteCurrent > 0u);
     if (prepare) {
+        ret = StopPrefetch();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "NI9157MxiDataSource::PrepareNextState Could not stop the prefetch thread");
+        }
+    }
+    if ((prepare) && (ret)) {
         for (uint32 i = 0u; (i < numberOfSignals); i++) {
             //get the type and create the device accordingly
             /*lint -e{613} NULL pointer checked*/
@@ -284,7 +389,7 @@ bool NI9157MxiDataSource::PrepareNextState(const char8 * const currentStateName,
             ret = GetSignalNumberOfDimensions(i, numberOfDimensions);
             if (ret) {
                 /*lint -e{613} NULL pointer checked*/
-                if (numberOfDimensions > 0u) {
+                if ((numberOfDimensions > 0u) && (arraySignal[i] == 0u)) {
                     /*lint -e{613} NULL pointer checked*/
                     signalFlag[i] |= 4u;
                 }
@@ -296,7 +401,7 @@ bool NI9157MxiDataSource::PrepareNextState(const char8 * const currentStateName,
                     /*lint -e{613} NULL pointer checked*/
                     ret = GetSignalNumberOfDimensions(i, numberOfDimensions);
                     if (ret) {
-                        if (numberOfDimensions > 0u) {
+                        if ((numberOfDimensions > 0u) && (arraySignal[i] == 0u)) {
                             /*lint -e{613} NULL pointer checked*/
                             fifoSize = (numberOfElements[i] * numberOfPacketsInFifo);
                             /*lint -e{613} NULL pointer checked*/
@@ -320,6 +425,54 @@ bool NI9157MxiDataSource::PrepareNextState(const char8 * const currentStateName,
                 REPORT_ERROR_PARAMETERS(ret ? ErrorManagement::Information : ErrorManagement::FatalError, "NI9157MxiDataSource::PrepareNextState Run returning %s with status=%d", ret ? "true" : "false", static_cast<int32> (status));
             }
         }
+        if ((ret) && (prefetchReads > 0u)) {
+            prefetchActive = false;
+            for (uint32 i = 0u; i < numberOfSignals; i++) {
+                //Only the signals which are read and not written can be read ahead of time
+                /*lint -e{613} NULL pointer checked*/
+                prefetchSignal[i] = ((signalFlag[i] & 0x3u) == 0x1u) ? 1u : 0u;
+                if (prefetchSignal[i] > 0u) {
+                    prefetchActive = true;
+                }
+            }
+        }
+        if (ret) {
+            ret = readGroup.Allocate(numberOfSignals);
+        }
+        if (ret) {
+            ret = writeGroup.Allocate(numberOfSignals);
+        }
+        for (uint32 i = 0u; (i < numberOfSignals) && (ret); i++) {
+            //The FIFOs and the signals still waiting for the initial pattern keep the per-signal access
+            /*lint -e{613} NULL pointer checked*/
+            groupedSignal[i] = 0u;
+            bool groupable = (((signalFlag[i] & 0x4u) == 0u) && (resetInitialPattern[i] == 0u));
+            uint32 registerElements = (arraySignal[i] > 0u) ? numberOfElements[i] : 1u;
+            if ((groupable) && ((signalFlag[i] & 0x1u) != 0u) && (prefetchSignal[i] == 0u)) {
+                ret = readGroup.Add(niDevice[i], varId[i], registerElements, &memory[signalOffsets[i]]);
+                groupedSignal[i] |= 0x1u;
+            }
+            if ((ret) && (groupable) && ((signalFlag[i] & 0x2u) != 0u)) {
+                ret = writeGroup.Add(niDevice[i], varId[i], registerElements, &memory[signalOffsets[i]]);
+                groupedSignal[i] |= 0x2u;
+            }
+        }
+        if (ret) {
+            readGroup.Prepare();
+            writeGroup.Prepare();
+            REPORT_ERROR_PARAMETERS(ErrorManagement::Information, "NI9157MxiDataSource::PrepareNextState Grouped %u reads and %u writes", readGroup.GetNumberOfRegisters(), writeGroup.GetNumberOfRegisters());
+        }
+        if ((ret) && (prefetchReads > 0u)) {
+            if (prefetchActive) {
+                executor.SetName(GetName());
+                if (cpuMask > 0u) {
+                    executor.SetCPUMask(cpuMask);
+                }
+                executor.SetStackSize(stackSize);
+                ret = (executor.Start() == ErrorManagement::NoError);
+                REPORT_ERROR_PARAMETERS(ret ? ErrorManagement::Information : ErrorManagement::FatalError, "NI9157MxiDataSource::PrepareNextState Start of the prefetch thread returned %s", ret ? "true" : "false");
+            }
+        }
     }
 
     REPORT_ERROR_PARAMETERS(ret ? ErrorManagement::Information : ErrorManagement::FatalError, "NI9157MxiDataSource::PrepareNextState returning %s with prepare %s", ret ? "true" : "false", prepare ? "true" : "false");
@@ -371,71 +524,70 @@ bool NI9157MxiDataSource::Synchronise() {
             Sleep::MSec(10u);
         }
     }
-    /*lint -e{9007} accounted for side effects on right hand of logical operator*/
-    for (uint32 i = 0u; (i < numberOfSignals) && (ret) && (niDeviceBoard->IsRunning() != 0u); i++) {
-        /*lint -e{613} NULL pointer checked*/
-        if ((signalFlag[i] & 0x1u) != 0u) {
-            /*lint -e{613} NULL pointer checked*/
-            if ((signalFlag[i] & 0x4u) != 0u) {
-                uint32 elementsRemaining = 0u;
-                if (useInitialPattern[i] > 0u) {
-                    uint64 pattern;
-                    int32 status = niDevice[i]->NiReadFifo(varId[i], &pattern, 1u, 0xFFFFFFFFu, elementsRemaining);
-                    ret = (status == 0);
+    if (prefetchActive) {
+        while ((prefetchFull[prefetchReadSlot] == 0) && (niDeviceBoard->IsRunning() != 0u)) {
+            Sleep::Sec(NI9157_MXI_PREFETCH_POLL_SEC);
+        }
+        if (prefetchFull[prefetchReadSlot] != 0) {
+            const uint8 *slot = &prefetchMemory[prefetchReadSlot * totalMemorySize];
+            const uint8 *valid = &prefetchValid[prefetchReadSlot * numberOfSignals];
+            for (uint32 i = 0u; (i < numberOfSignals) && (ret); i++) {
+                /*lint -e{613} NULL pointer checked*/
+                if ((prefetchSignal[i] > 0u) && (valid[i] > 0u)) {
+                    uint32 signalByteSize = 0u;
+                    ret = GetSignalByteSize(i, signalByteSize);
                     if (ret) {
-                        /*lint -e{928} known recasting from pointer to pointer*/
-                        if (niDevice[i]->Compare(reinterpret_cast<uint8*>(&pattern), reinterpret_cast<uint8*>(&initialPatterns[i])) == 0) {
-                            useInitialPattern[i] = 0u;
-                        }
-                    }
-                }
-                if (useInitialPattern[i] == 0u) {
-                    /*lint -e{613} NULL pointer checked*/
-                    int32 status = niDevice[i]->NiReadFifo(varId[i], &memory[signalOffsets[i]], numberOfElements[i], 0xFFFFFFFFu, elementsRemaining);
-                    ret = (status == 0);
-                    if (!ret) {
-                        REPORT_ERROR(ErrorManagement::FatalError, "Failed Ni9155Device FIFO read. Status = %d", static_cast<int32> (status));
+                        ret = MemoryOperationsHelper::Copy(&memory[signalOffsets[i]], &slot[signalOffsets[i]], signalByteSize);
                     }
                 }
             }
-            else {
-                if (useInitialPattern[i] > 0u) {
-                    uint64 pattern;
-                    int32 status = niDevice[i]->NiRead(varId[i], &pattern);
-                    ret = (status == 0);
-                    if (ret) {
-                        /*lint -e{928} known recasting from pointer to pointer*/
-                        if (niDevice[i]->Compare(reinterpret_cast<uint8*>(&pattern), reinterpret_cast<uint8*>(&initialPatterns[i])) == 0) {
-                            useInitialPattern[i] = 0u;
-                        }
-                    }
-                }
-                if (useInitialPattern[i] == 0u) {
-                    int32 status = niDevice[i]->NiRead(varId[i], &memory[signalOffsets[i]]);
-                    ret = (status == 0);
-                    if (!ret) {
-                        REPORT_ERROR(ErrorManagement::FatalError, "Failed Ni9155Device read. Status = %d", static_cast<int32> (status));
-                    }
+            //Atomic::Exchange is a full memory barrier: the slot is only given back after having been copied
+            (void) Atomic::Exchange(&prefetchFull[prefetchReadSlot], 0);
+            prefetchReadSlot = ((prefetchReadSlot + 1u) % NI9157_MXI_PREFETCH_SLOTS);
+        }
+    }
+    if ((ret) && (readGroup.GetNumberOfRegisters() > 0u) && (niDeviceBoard->IsRunning() != 0u)) {
+        uint64 startTicks = HighResolutionTimer::Counter();
+        NiFpga_Status status = readGroup.Read();
+        UpdateAccessStatistics(groupStatistics[0], startTicks);
+        ret = (status == 0);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed Ni9155Device group read. Status = %d", static_cast<int32> (status));
+        }
+    }
+    /*lint -e{9007} accounted for side effects on right hand of logical operator*/
+    for (uint32 i = 0u; (i < numberOfSignals) && (ret) && (niDeviceBoard->IsRunning() != 0u); i++) {
+        /*lint -e{613} NULL pointer checked*/
+        if (((signalFlag[i] & 0x1u) != 0u) && (prefetchSignal[i] == 0u) && ((groupedSignal[i] & 0x1u) == 0u)) {
+            NiFpga_Status status = 0;
+            if (!ReadSignal(i, &memory[signalOffsets[i]], 0xFFFFFFFFu, status)) {
+                ret = (status == 0);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Failed Ni9155Device read. Status = %d", static_cast<int32> (status));
                 }
             }
         }
         if (ret) {
             /*lint -e{613} NULL pointer checked*/
-            if ((signalFlag[i] & 0x2u) != 0u) {
+            if (((signalFlag[i] & 0x2u) != 0u) && ((groupedSignal[i] & 0x2u) == 0u)) {
                 /*lint -e{613} NULL pointer checked*/
                 if ((signalFlag[i] & 0x4u) != 0u) {
                     uint32 emptyElementsRemaining = 0u;
                     if (useInitialPattern[i] > 0u) {
                         REPORT_ERROR(ErrorManagement::Information, "sending pattern %0x", initialPatterns[i]);
+                        uint64 startTicks = HighResolutionTimer::Counter();
                         int32 status = niDevice[i]->NiWriteFifo(varId[i], &initialPatterns[i], 1u, 0xFFFFFFFFu, emptyElementsRemaining);
+                        UpdateAccessStatistics(accessStatistics[i], startTicks);
                         ret = (status == 0);
                         if (ret) {
                             useInitialPattern[i] = 0u;
                         }
                     }
                     if (useInitialPattern[i] == 0u) {
+                        uint64 startTicks = HighResolutionTimer::Counter();
                         /*lint -e{613} NULL pointer checked*/
                         int32 status = niDevice[i]->NiWriteFifo(varId[i], &memory[signalOffsets[i]], numberOfElements[i], 0xFFFFFFFFu, emptyElementsRemaining);
+                        UpdateAccessStatistics(accessStatistics[i], startTicks);
                         ret = (status == 0);
                         if (!ret) {
                             REPORT_ERROR(ErrorManagement::FatalError, "Failed Ni9155Device FIFO write. Status = %d", static_cast<int32> (status));
@@ -444,15 +596,19 @@ bool NI9157MxiDataSource::Synchronise() {
                 }
                 else {
                     if (useInitialPattern[i] > 0u) {
+                        uint64 startTicks = HighResolutionTimer::Counter();
                         int32 status = niDevice[i]->NiWrite(varId[i], &initialPatterns[i]);
+                        UpdateAccessStatistics(accessStatistics[i], startTicks);
                         ret = (status == 0);
                         if (ret) {
                             useInitialPattern[i] = 0u;
                         }
                     }
                     if (useInitialPattern[i] == 0u) {
+                        uint64 startTicks = HighResolutionTimer::Counter();
                         /*lint -e{613} NULL pointer checked*/
                         int32 status = niDevice[i]->NiWrite(varId[i], &memory[signalOffsets[i]]);
+                        UpdateAccessStatistics(accessStatistics[i], startTicks);
                         ret = (status == 0);
                         if (!ret) {
                             REPORT_ERROR(ErrorManagement::FatalError, "Failed Ni9155Device write. Status = %d", static_cast<int32> (status));
@@ -462,10 +618,191 @@ bool NI9157MxiDataSource::Synchronise() {
             }
         }
     }
+    if ((ret) && (writeGroup.GetNumberOfRegisters() > 0u) && (niDeviceBoard->IsRunning() != 0u)) {
+        uint64 startTicks = HighResolutionTimer::Counter();
+        NiFpga_Status status = writeGroup.Write();
+        UpdateAccessStatistics(groupStatistics[1], startTicks);
+        ret = (status == 0);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed Ni9155Device group write. Status = %d", static_cast<int32> (status));
+        }
+    }
 
     return true;
 }
 
+bool NI9157MxiDataSource::ReadSignal(const uint32 signalIdx,
+                                     uint8 * const destination,
+                                     const uint32 timeout,
+                                     NiFpga_Status &status) {
+
+    bool written = false;
+    uint32 elementsRemaining = 0u;
+    /*lint -e{613} NULL pointer checked*/
+    bool isFifo = ((signalFlag[signalIdx] & 0x4u) != 0u);
+    status = 0;
+    /*lint -e{613} NULL pointer checked*/
+    if (useInitialPattern[signalIdx] > 0u) {
+        uint64 pattern;
+        uint64 startTicks = HighResolutionTimer::Counter();
+        if (isFifo) {
+            status = niDevice[signalIdx]->NiReadFifo(varId[signalIdx], &pattern, 1u, timeout, elementsRemaining);
+        }
+        else {
+            status = niDevice[signalIdx]->NiRead(varId[signalIdx], &pattern);
+        }
+        UpdateAccessStatistics(accessStatistics[signalIdx], startTicks);
+        if (status == 0) {
+            /*lint -e{928} known recasting from pointer to pointer*/
+            if (niDevice[signalIdx]->Compare(reinterpret_cast<uint8*>(&pattern), reinterpret_cast<uint8*>(&initialPatterns[signalIdx])) == 0) {
+                useInitialPattern[signalIdx] = 0u;
+            }
+        }
+    }
+    if ((status == 0) && (useInitialPattern[signalIdx] == 0u)) {
+        uint64 startTicks = HighResolutionTimer::Counter();
+        if (isFifo) {
+            /*lint -e{613} NULL pointer checked*/
+            status = niDevice[signalIdx]->NiReadFifo(varId[signalIdx], destination, numberOfElements[signalIdx], timeout, elementsRemaining);
+        }
+        else if (arraySignal[signalIdx] > 0u) {
+            /*lint -e{613} NULL pointer checked*/
+            status = niDevice[signalIdx]->NiReadArray(varId[signalIdx], destination, numberOfElements[signalIdx]);
+        }
+        else {
+            status = niDevice[signalIdx]->NiRead(varId[signalIdx], destination);
+        }
+        UpdateAccessStatistics(accessStatistics[signalIdx], startTicks);
+        written = (status == 0);
+    }
+    return written;
+}
+
+ErrorManagement::ErrorType NI9157MxiDataSource::Execute(ExecutionInfo & info) {
+
+    ErrorManagement::ErrorType err = ErrorManagement::NoError;
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        if ((niDeviceBoard->IsRunning() == 0u) || (prefetchFull[prefetchWriteSlot] != 0)) {
+            //Wait for the device or for Synchronise to give back the slot
+            Sleep::Sec(NI9157_MXI_PREFETCH_POLL_SEC);
+        }
+        else {
+            uint8 *slot = &prefetchMemory[prefetchWriteSlot * totalMemorySize];
+            uint8 *valid = &prefetchValid[prefetchWriteSlot * numberOfSignals];
+            bool timedOut = false;
+            while ((prefetchSignalIdx < numberOfSignals) && (!timedOut)) {
+                uint32 i = prefetchSignalIdx;
+                /*lint -e{613} NULL pointer checked*/
+                if (prefetchSignal[i] > 0u) {
+                    NiFpga_Status status = 0;
+                    bool written = ReadSignal(i, &slot[signalOffsets[i]], NI9157_MXI_PREFETCH_FIFO_TIMEOUT, status);
+                    //Retry the same signal at the next call so that a stop request is not blocked by the FIFO
+                    timedOut = (status == NiFpga_Status_FifoTimeout);
+                    if ((!timedOut) && (status != 0)) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Failed Ni9155Device prefetch read. Status = %d", static_cast<int32> (status));
+                    }
+                    valid[i] = written ? 1u : 0u;
+                }
+                if (!timedOut) {
+                    prefetchSignalIdx++;
+                }
+            }
+            if (!timedOut) {
+                //Atomic::Exchange is a full memory barrier: Synchronise sees the slot content before the flag
+                (void) Atomic::Exchange(&prefetchFull[prefetchWriteSlot], 1);
+                prefetchWriteSlot = ((prefetchWriteSlot + 1u) % NI9157_MXI_PREFETCH_SLOTS);
+                prefetchSignalIdx = 0u;
+            }
+        }
+    }
+    return err;
+}
+
+bool NI9157MxiDataSource::StopPrefetch() {
+
+    bool ret = (executor.Stop() == ErrorManagement::NoError);
+    if (!ret) {
+        ret = (executor.Stop() == ErrorManagement::NoError);
+    }
+    if (ret) {
+        for (uint32 s = 0u; s < NI9157_MXI_PREFETCH_SLOTS; s++) {
+            prefetchFull[s] = 0;
+        }
+        prefetchWriteSlot = 0u;
+        prefetchSignalIdx = 0u;
+        prefetchReadSlot = 0u;
+    }
+    return ret;
+}
+
+void NI9157MxiDataSource::UpdateAccessStatistics(NI9157MxiAccessStatistics &stats,
+                                                 const uint64 startTicks) {
+
+    uint64 elapsed = (HighResolutionTimer::Counter() - startTicks);
+    stats.numberOfAccesses++;
+    stats.lastTicks = elapsed;
+    stats.totalTicks += elapsed;
+    if (elapsed < stats.minTicks) {
+        stats.minTicks = elapsed;
+    }
+    if (elapsed > stats.maxTicks) {
+        stats.maxTicks = elapsed;
+    }
+}
+
+bool NI9157MxiDataSource::GetAccessStatistics(const uint32 signalIdx,
+                                              NI9157MxiAccessStatistics &statistics) const {
+
+    bool ret = ((signalIdx < numberOfSignals) && (accessStatistics != NULL_PTR(NI9157MxiAccessStatistics *)));
+    if (ret) {
+        statistics = accessStatistics[signalIdx];
+    }
+    return ret;
+}
+
+void NI9157MxiDataSource::GetGroupAccessStatistics(const bool isWriteGroup,
+                                                   NI9157MxiAccessStatistics &statistics) const {
+
+    statistics = groupStatistics[isWriteGroup ? 1u : 0u];
+}
+
+uint32 NI9157MxiDataSource::GetGroupNumberOfRegisters(const bool isWriteGroup) const {
+
+    return isWriteGroup ? writeGroup.GetNumberOfRegisters() : readGroup.GetNumberOfRegisters();
+}
+
+ErrorManagement::ErrorType NI9157MxiDataSource::ReportAccessStatistics() {
+
+    ErrorManagement::ErrorType err;
+    err.fatalError = (accessStatistics == NULL_PTR(NI9157MxiAccessStatistics *));
+    float64 usPerTick = (HighResolutionTimer::Period() * 1e6);
+    for (uint32 i = 0u; (i < numberOfSignals) && (err.ErrorsCleared()); i++) {
+        StreamString signalName;
+        err.fatalError = !GetSignalName(i, signalName);
+        if (err.ErrorsCleared()) {
+            NI9157MxiAccessStatistics &stats = accessStatistics[i];
+            if (stats.numberOfAccesses > 0u) {
+                float64 lastUs = static_cast<float64>(stats.lastTicks) * usPerTick;
+                float64 minUs = static_cast<float64>(stats.minTicks) * usPerTick;
+                float64 maxUs = static_cast<float64>(stats.maxTicks) * usPerTick;
+                float64 meanUs = (static_cast<float64>(stats.totalTicks) * usPerTick) / static_cast<float64>(stats.numberOfAccesses);
+                REPORT_ERROR_PARAMETERS(ErrorManagement::Information, "NI9157MxiDataSource::ReportAccessStatistics %s%s accesses=%u last=%f min=%f mean=%f max=%f (us)", signalName.Buffer(), (prefetchSignal[i] > 0u) ? " (prefetched)" : "", stats.numberOfAccesses, lastUs, minUs, meanUs, maxUs);
+            }
+        }
+    }
+    for (uint32 g = 0u; (g < 2u) && (err.ErrorsCleared()); g++) {
+        const NI9157MxiAccessStatistics &stats = groupStatistics[g];
+        if (stats.numberOfAccesses > 0u) {
+            float64 lastUs = static_cast<float64>(stats.lastTicks) * usPerTick;
+            float64 minUs = static_cast<float64>(stats.minTicks) * usPerTick;
+            float64 maxUs = static_cast<float64>(stats.maxTicks) * usPerTick;
+            float64 meanUs = (static_cast<float64>(stats.totalTicks) * usPerTick) / static_cast<float64>(stats.numberOfAccesses);
+            REPORT_ERROR_PARAMETERS(ErrorManagement::Information, "NI9157MxiDataSource::ReportAccessStatistics %s group (%u registers) accesses=%u last=%f min=%f mean=%f max=%f (us)", (g == 0u) ? "read" : "write", GetGroupNumberOfRegisters(g == 1u), stats.numberOfAccesses, lastUs, minUs, meanUs, maxUs);
+        }
+    }
+    return err;
+}
+
 ErrorManagement::ErrorType NI9157MxiDataSource::AsyncRead(StreamString varName,
                                             uint64 &varValue) {
 
@@ -524,14 +861,17 @@ ErrorManagement::ErrorType NI9157MxiDataSource::Reset() {
     NiFpga_Status status;
     REPORT_ERROR(ErrorManagement::Information, "NI9157MxiDataSource::Reset");
 
-    for (uint32 i = 0u; (i < numberOfSignals); i++) {
+    //The FIFOs cannot be reconfigured while the helper thread is reading them
+    bool stopped = StopPrefetch();
+    err = !stopped;
+    for (uint32 i = 0u; (i < numberOfSignals) && (stopped); i++) {
         /*lint -e{613} NULL pointer checked*/
         err = !GetSignalNumberOfElements(i, numberOfElements[i]);
         if (err.ErrorsCleared()) {
             /*lint -e{613} NULL pointer checked*/
             err = !GetSignalNumberOfDimensions(i, numberOfDimensions);
             if (err.ErrorsCleared()) {
-                if (numberOfDimensions > 0u) {
+                if ((numberOfDimensions > 0u) && (arraySignal[i] == 0u)) {
                     /*lint -e{613} NULL pointer checked*/
                     fifoSize = (numberOfElements[i] * numberOfPacketsInFifo);
                     /*lint -e{613} NULL pointer checked*/
@@ -556,6 +896,9 @@ ErrorManagement::ErrorType NI9157MxiDataSource::Reset() {
             REPORT_ERROR_PARAMETERS(ret ? ErrorManagement::Information : ErrorManagement::FatalError, "NI9157MxiDataSource::Reset Run returned %s with status %d", ret ? "true" : "false", static_cast<int32> (status));
         }
     }
+    if ((err.ErrorsCleared()) && (prefetchActive)) {
+        err = executor.Start();
+    }
 
     ret = err.ErrorsCleared();
     REPORT_ERROR_PARAMETERS(ret ? ErrorManagement::Information : ErrorManagement::FatalError, "NI9157MxiDataSource::Reset returning %s", ret ? "true" : "false");
@@ -568,5 +911,6 @@ CLASS_METHOD_REGISTER(NI9157MxiDataSource, AsyncRead)
 /*lint -e{1023} There is no ambiguity on the function to be called as the compiler can distinguish between both template definitions.*/
 CLASS_METHOD_REGISTER(NI9157MxiDataSource, AsyncWrite)
 CLASS_METHOD_REGISTER(NI9157MxiDataSource, Reset)
+CLASS_METHOD_REGISTER(NI9157MxiDataSource, ReportAccessStatistics)
 
 }
@@ -36,12 +36,15 @@
 #include "AdvancedErrorManagement.h"
 #include "CLASSMETHODREGISTER.h"
 #include "CreateNI9157DeviceOperatorI.h"
+#include "EmbeddedServiceMethodBinderI.h"
 #include "MemoryDataSourceI.h"
 #include "MessageI.h"
 #include "NI9157DeviceOperatorDatabase.h"
 #include "NI9157DeviceOperatorT.h"
+#include "NI9157RegisterGroup.h"
 #include "ObjectRegistryDatabase.h"
 #include "RegisteredMethodsMessageFilter.h"
+#include "SingleThreadService.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -72,6 +75,10 @@ namespace MARTe{
  *                                  // the defined FIFOs. By default it is 5.
  *     BlockIfNotRunning = 0    // If >0 blocks the call inside Syncronise() 
  *                              // until niDeviceBoard->IsRunning() is true.
+ *     PrefetchReads = 0    // If >0 the read-only FIFOs and indicators are
+ *                          // read ahead of time by a helper thread.
+ *     PrefetchCPUMask = 0x2    // Optional. CPU affinity of the helper thread.
+ *     PrefetchStackSize = 1048576  // Optional. Stack of the helper thread.
  *     Signals = {
  *         // read from indicator
  *         IndicatorU32_ticks_counter = {   // 'ticks_counter' in the Fw
@@ -87,6 +94,15 @@ namespace MARTe{
  *         ControlU8_options = {    // 'options' in the Fw
  *             Type = uint8
  *         }
+ *         // read from an array indicator in one transaction
+ *         IndicatorArrayU32_status = {    // 'status' in the Fw
+ *             Type = uint32
+ *             NumberOfDimensions = 1
+ *             NumberOfElements = 64
+ *             Array = 1    // The signal is an array control/indicator
+ *                          // and not a FIFO. InitialPattern is not
+ *                          // supported.
+ *         }
  *         // write on FIFO
  *         HostToTargetFifoU16_FIFO0_U64_W = { // 'FIFO0_U64_W' in the Fw
  *             Type = uint64
@@ -98,8 +114,23 @@ namespace MARTe{
  *     }"
  * }
  * </pre>
+ * @details When PrefetchReads > 0 the signals which are only read in the
+ * next state (FIFOs and indicators without producers) are read by a helper
+ * thread into one of NI9157_MXI_PREFETCH_SLOTS slots. Synchronise waits for
+ * the oldest full slot, copies it into the signal memory and gives it back to
+ * the helper thread, which is then already reading the following one. The
+ * controls, the host to target FIFOs and the signals which are both read and
+ * written are still accessed sequentially from Synchronise.
+ * @details The controls and indicators (including the array ones) without
+ * InitialPattern are grouped in PrepareNextState in one NI9157RegisterGroup
+ * for the reads and one for the writes, sorted by register descriptor.
+ * Synchronise reads the read group before and writes the write group after
+ * the per-signal accesses.
+ * @details The duration of each MXI access is measured and accumulated per
+ * signal (see GetAccessStatistics). The ReportAccessStatistics method prints
+ * them and can be called within a MARTe message.
  */
-class NI9157MxiDataSource: public MemoryDataSourceI, public MessageI {
+class NI9157MxiDataSource: public MemoryDataSourceI, public MessageI, public EmbeddedServiceMethodBinderI {
 public:
     CLASS_REGISTER_DECLARATION()
 
@@ -113,6 +144,11 @@ public:
      *   signalFlag = NULL_PTR(uint8 *);
      *   varId = NULL_PTR(uint32 *);
      *   numberOfElements = NULL_PTR(uint32 *);
+     *   prefetchReads = 0u;
+     *   prefetchMemory = NULL_PTR(uint8 *);
+     *   accessStatistics = NULL_PTR(NI9157MxiAccessStatistics *);
+     *   arraySignal = NULL_PTR(uint8 *);
+     *   groupedSignal = NULL_PTR(uint8 *);
      */
     NI9157MxiDataSource();
 
@@ -130,10 +166,22 @@ public:
      * NI9157DevicePath: the absolute path of the device in the 
      * configuration database.\n
      * NumberOfPacketsInFIFO: the number of packets in the FIFO host side.
-     * This parameter is valid for all the defined FIFOs. By default is 5.
+     * This parameter is valid for all the defined FIFOs. By default is 5.\n
+     * PrefetchReads: if > 0 the read-only signals are read by a helper
+     * thread. By default is 0.\n
+     * PrefetchCPUMask: the CPU affinity of the helper thread. By default no
+     * affinity is set.\n
+     * PrefetchStackSize: the stack size of the helper thread. By default is
+     * THREADS_DEFAULT_STACKSIZE.
      */
     virtual bool Initialise(StructuredDataI &data);
 
+    /**
+     * @see MemoryDataSourceI::AllocateMemory
+     * @details If PrefetchReads > 0 also allocates the prefetch slots.
+     */
+    virtual bool AllocateMemory();
+
     /**
      * @see MemoryDataSourceI::GetBrokerName
      * @details
@@ -151,7 +199,10 @@ public:
      * @see MemoryDataSourceI::PrepareNextState
      * @details Sets the member values of signalFlags for each signal storing
      * if the signal has to be read, write and if it is a FIFO. Then, if 
-     * RunNi == 1, starts the NI-9157 device.
+     * RunNi == 1, starts the NI-9157 device. Builds the read and write
+     * register groups. If PrefetchReads > 0 and at
+     * least one signal is read-only in the next state, (re)starts the helper
+     * thread.
      */
     virtual bool PrepareNextState(const char8 * const currentStateName,
                                             const char8 * const nextStateName);
@@ -167,9 +218,54 @@ public:
     /**
      * @brief Reads and writes all the signals from/to the internal memory
      * buffers.
+     * @details The prefetched signals are copied from the oldest full
+     * prefetch slot, waiting for it if the helper thread is still reading.
      */
     virtual bool Synchronise();
 
+    /**
+     * @brief Callback function for the helper thread.
+     * @details Reads the prefetched signals into the current prefetch slot
+     * and publishes it when all of them have been read. FIFO reads which
+     * time out are retried at the next call, so that the thread can always
+     * be stopped.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo & info);
+
+    /**
+     * @brief Gets the MXI access latency statistics of a signal.
+     * @param[in] signalIdx the signal index.
+     * @param[out] statistics the accumulated statistics.
+     * @return false if \a signalIdx is not a valid signal index.
+     */
+    bool GetAccessStatistics(const uint32 signalIdx,
+                             NI9157MxiAccessStatistics &statistics) const;
+
+    /**
+     * @brief Prints the MXI access latency statistics of all the signals.
+     * @details Reports, in microseconds, the last, minimum, mean and maximum
+     * access time of each signal. It can be called within a MARTe message.
+     */
+    ErrorManagement::ErrorType ReportAccessStatistics();
+
+    /**
+     * @brief Gets the MXI access latency statistics of a register group.
+     * @param[in] isWriteGroup true for the write group, false for the read
+     * group.
+     * @param[out] statistics the accumulated statistics (one access per
+     * Read/Write of the whole group).
+     */
+    void GetGroupAccessStatistics(const bool isWriteGroup,
+                                  NI9157MxiAccessStatistics &statistics) const;
+
+    /**
+     * @brief Gets the number of registers in a register group.
+     * @param[in] isWriteGroup true for the write group, false for the read
+     * group.
+     * @return the number of registers in the group.
+     */
+    uint32 GetGroupNumberOfRegisters(const bool isWriteGroup) const;
+
     /**
      * @brief Asynchronous read for indicators.
      * @details This method allows to read from a Labview exported indicator.
@@ -196,6 +292,33 @@ public:
 
 protected:
 
+    /**
+     * @brief Accumulates the duration of an MXI access.
+     * @param[in,out] stats the statistics to update.
+     * @param[in] startTicks the HighResolutionTimer counter before the access.
+     */
+    void UpdateAccessStatistics(NI9157MxiAccessStatistics &stats,
+                                const uint64 startTicks);
+
+    /**
+     * @brief Reads a FIFO or an indicator handling the initial pattern.
+     * @param[in] signalIdx the signal index.
+     * @param[out] destination where to write the signal value.
+     * @param[in] timeout the FIFO read timeout in ms.
+     * @param[out] status the status of the last NiFpga call.
+     * @return true if \a destination was written.
+     */
+    bool ReadSignal(const uint32 signalIdx,
+                    uint8 * const destination,
+                    const uint32 timeout,
+                    NiFpga_Status &status);
+
+    /**
+     * @brief Stops the helper thread and resets the prefetch slots.
+     * @return true if the thread was stopped.
+     */
+    bool StopPrefetch();
+
     /**
      * The reference to the NI9157Device.
      */
@@ -253,6 +376,99 @@ protected:
      */
     uint8 blockIfNotRunning;
 
+    /**
+     * If the read-only signals have to be read by the helper thread.
+     */
+    uint8 prefetchReads;
+
+    /**
+     * For each signal, 1 if it is read by the helper thread in the current
+     * state.
+     */
+    uint8 *prefetchSignal;
+
+    /**
+     * The prefetch slots (NI9157_MXI_PREFETCH_SLOTS * totalMemorySize).
+     */
+    uint8 *prefetchMemory;
+
+    /**
+     * For each slot and signal, 1 if the signal was read into the slot (it
+     * is not while the initial pattern is being searched).
+     */
+    uint8 *prefetchValid;
+
+    /**
+     * For each slot, 1 if it is full and waiting for Synchronise.
+     */
+    volatile int32 prefetchFull[NI9157_MXI_PREFETCH_SLOTS];
+
+    /**
+     * The slot being filled by the helper thread.
+     */
+    uint32 prefetchWriteSlot;
+
+    /**
+     * The next signal to be read by the helper thread in prefetchWriteSlot.
+     */
+    uint32 prefetchSignalIdx;
+
+    /**
+     * The slot to be consumed by Synchronise.
+     */
+    uint32 prefetchReadSlot;
+
+    /**
+     * True if at least one signal is read by the helper thread.
+     */
+    bool prefetchActive;
+
+    /**
+     * The helper thread.
+     */
+    SingleThreadService executor;
+
+    /**
+     * The CPU mask of the helper thread.
+     */
+    uint32 cpuMask;
+
+    /**
+     * The stack size of the helper thread.
+     */
+    uint32 stackSize;
+
+    /**
+     * The MXI access statistics of each signal.
+     */
+    NI9157MxiAccessStatistics *accessStatistics;
+
+    /**
+     * For each signal, 1 if it is an array control/indicator (Array = 1).
+     */
+    uint8 *arraySignal;
+
+    /**
+     * For each signal, bit 0 set if read through readGroup and bit 1 set if
+     * written through writeGroup.
+     */
+    uint8 *groupedSignal;
+
+    /**
+     * The controls and indicators read in one go.
+     */
+    NI9157RegisterGroup readGroup;
+
+    /**
+     * The controls written in one go.
+     */
+    NI9157RegisterGroup writeGroup;
+
+    /**
+     * The MXI access statistics of readGroup (0) and writeGroup (1).
+     */
+    NI9157MxiAccessStatistics groupStatistics[2];
+
 };
 
 }
@@ -26,6 +26,9 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -35,6 +38,38 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * @brief Copies \a size bytes as elements of type T, which the compiler is free to vectorise.
+ * @details Falls back to the byte copy if any of the memories is not aligned to the element size.
+ */
+template<typename T>
+void CopyTyped(MARTe::uint8 * const destination,
+               const MARTe::uint8 * const source,
+               const MARTe::uint32 size) {
+    using namespace MARTe;
+    /*lint -e{923} -e{9091} the alignment is checked on the pointer values.*/
+    bool aligned = (((reinterpret_cast<uintp>(destination) | reinterpret_cast<uintp>(source)) % sizeof(T)) == 0u);
+    if (aligned) {
+        const uint32 numberOfElements = (size / static_cast<uint32>(sizeof(T)));
+        /*lint -e{927} -e{826} -e{740} alignment checked above.*/
+        T * const dest = reinterpret_cast<T *>(destination);
+        /*lint -e{927} -e{826} -e{740} alignment checked above.*/
+        const T * const src = reinterpret_cast<const T *>(source);
+        for (uint32 i = 0u; i < numberOfElements; i++) {
+            dest[i] = src[i];
+        }
+        const uint32 copied = (numberOfElements * static_cast<uint32>(sizeof(T)));
+        for (uint32 i = copied; i < size; i++) {
+            destination[i] = source[i];
+        }
+    }
+    else {
+        (void) MemoryOperationsHelper::Copy(destination, source, size);
+    }
+}
+}
+
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -52,3 +87,82 @@ void NI9157MemoryOperationsHelper::FlatToInterleaved(MARTe::uint8 * const origin
     /*lint -e{714} symbol referenced*/
     MARTe::MemoryOperationsHelper::FlatToInterleaved(originSource, originDest, beginIndex, packetMemberSize, packetByteSize, numberOfPacketMembers, numberOfSamples);
 }
+
+/*lint -e{9141} -e{714} known global declaration*/
+void NI9157MemoryOperationsHelper::CopyU8(MARTe::uint8 * const destination, const MARTe::uint8 * const source, const MARTe::uint32 size) {
+    (void) MARTe::MemoryOperationsHelper::Copy(destination, source, size);
+}
+
+/*lint -e{9141} -e{714} known global declaration*/
+void NI9157MemoryOperationsHelper::CopyU16(MARTe::uint8 * const destination, const MARTe::uint8 * const source, const MARTe::uint32 size) {
+    CopyTyped<MARTe::uint16>(destination, source, size);
+}
+
+/*lint -e{9141} -e{714} known global declaration*/
+void NI9157MemoryOperationsHelper::CopyU32(MARTe::uint8 * const destination, const MARTe::uint8 * const source, const MARTe::uint32 size) {
+    CopyTyped<MARTe::uint32>(destination, source, size);
+}
+
+/*lint -e{9141} -e{714} known global declaration*/
+void NI9157MemoryOperationsHelper::CopyU64(MARTe::uint8 * const destination, const MARTe::uint8 * const source, const MARTe::uint32 size) {
+    CopyTyped<MARTe::uint64>(destination, source, size);
+}
+
+/*lint -e{9141} -e{714} known global declaration*/
+void NI9157MemoryOperationsHelper::CopyNonTemporal(MARTe::uint8 * const destination, const MARTe::uint8 * const source, const MARTe::uint32 size) {
+    using namespace MARTe;
+#if defined(__SSE2__)
+    /*lint -save -e586 -e9016 -e923 -e826 -e927 SSE2 intrinsics with unaligned source memory.*/
+    //copy the first bytes until the destination is aligned to 16 bytes
+    uint32 head = static_cast<uint32>((16u - (reinterpret_cast<uintp>(destination) & 15u)) & 15u);
+    if (head > size) {
+        head = size;
+    }
+    uint32 i;
+    for (i = 0u; i < head; i++) {
+        destination[i] = source[i];
+    }
+    for (; (i + 64u) <= size; i += 64u) {
+        __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i]));
+        __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i + 16u]));
+        __m128i a2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i + 32u]));
+        __m128i a3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i + 48u]));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(&destination[i]), a0);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(&destination[i + 16u]), a1);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(&destination[i + 32u]), a2);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(&destination[i + 48u]), a3);
+    }
+    for (; (i + 16u) <= size; i += 16u) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(&destination[i]), _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i])));
+    }
+    for (; i < size; i++) {
+        destination[i] = source[i];
+    }
+    //make the streamed stores visible before the block is handed over to the consumers
+    _mm_sfence();
+    /*lint -restore*/
+#else
+    (void) MemoryOperationsHelper::Copy(destination, source, size);
+#endif
+}
+
+/*lint -e{9141} -e{714} known global declaration*/
+NI9157MemoryOperationsHelper::CopyKernel NI9157MemoryOperationsHelper::GetCopyKernel(const MARTe::uint8 elementByteSize, const MARTe::uint32 blockSize, const bool nonTemporal) {
+    CopyKernel kernel = &CopyU8;
+    if ((nonTemporal) && (blockSize >= NON_TEMPORAL_COPY_MIN_SIZE)) {
+        kernel = &CopyNonTemporal;
+    }
+    else if (elementByteSize == 2u) {
+        kernel = &CopyU16;
+    }
+    else if (elementByteSize == 4u) {
+        kernel = &CopyU32;
+    }
+    else if (elementByteSize == 8u) {
+        kernel = &CopyU64;
+    }
+    else {
+        kernel = &CopyU8;
+    }
+    return kernel;
+}
@@ -44,6 +44,57 @@
 /*lint -estring(19, "*NI9157MemoryOperationsHelper*") -estring(757,"*NI9157MemoryOperationsHelper*") -estring(526, "*NI9157MemoryOperationsHelper*") -estring(714, "*NI9157MemoryOperationsHelper*") functions defined, used and required for optimisation.*/
 namespace NI9157MemoryOperationsHelper {
 
+    /**
+     * Blocks smaller than this number of bytes are never copied with non-temporal stores
+     * (the cost of the store fence would not be amortised).
+     */
+    const MARTe::uint32 NON_TEMPORAL_COPY_MIN_SIZE = 4096u;
+
+    /**
+     * @brief A copy kernel selected at configuration time by GetCopyKernel.
+     * @param[out] destination the destination memory.
+     * @param[in] source the source memory.
+     * @param[in] size the number of bytes to copy.
+     */
+    typedef void (*CopyKernel)(MARTe::uint8 * const destination, const MARTe::uint8 * const source, const MARTe::uint32 size);
+
+    /**
+     * @brief Copies \a size bytes as uint8 elements.
+     */
+    void CopyU8(MARTe::uint8 * const destination, const MARTe::uint8 * const source, const MARTe::uint32 size);
+
+    /**
+     * @brief Copies \a size bytes as uint16 elements (if both memories are aligned to the element size, otherwise falls back to CopyU8).
+     */
+    void CopyU16(MARTe::uint8 * const destination, const MARTe::uint8 * const source, const MARTe::uint32 size);
+
+    /**
+     * @brief Copies \a size bytes as uint32 elements (if both memories are aligned to the element size, otherwise falls back to CopyU8).
+     */
+    void CopyU32(MARTe::uint8 * const destination, const MARTe::uint8 * const source, const MARTe::uint32 size);
+
+    /**
+     * @brief Copies \a size bytes as uint64 elements (if both memories are aligned to the element size, otherwise falls back to CopyU8).
+     */
+    void CopyU64(MARTe::uint8 * const destination, const MARTe::uint8 * const source, const MARTe::uint32 size);
+
+    /**
+     * @brief Copies \a size bytes with non-temporal (cache bypassing) stores.
+     * @details Meant for large blocks which are not going to be read again by this core (e.g. packets which are only written to disk).
+     * The destination is aligned to 16 bytes with a normal copy of the first bytes and the rest is streamed in 16 bytes stores,
+     * followed by a store fence. Without SSE2 support this is equivalent to CopyU8.
+     */
+    void CopyNonTemporal(MARTe::uint8 * const destination, const MARTe::uint8 * const source, const MARTe::uint32 size);
+
+    /**
+     * @brief Selects the copy kernel for blocks of \a blockSize bytes made of elements of \a elementByteSize bytes.
+     * @param[in] elementByteSize the size of the FIFO elements (1, 2, 4 or 8, otherwise CopyU8 is returned).
+     * @param[in] blockSize the number of bytes which are going to be copied by each call.
+     * @param[in] nonTemporal if true and blockSize >= NON_TEMPORAL_COPY_MIN_SIZE, CopyNonTemporal is returned.
+     * @return the copy kernel.
+     */
+    CopyKernel GetCopyKernel(const MARTe::uint8 elementByteSize, const MARTe::uint32 blockSize, const bool nonTemporal);
+
     /**
      * @see MemoryOperationsHelper::InterleavedToFlat
      */
@@ -84,4 +84,65 @@ uint8 SampleChecker::GetNumberOfFramesToSync() const{
     return nFrameForSync;
 }
 
+/*lint -e{927} -e{826} -e{740} Allowed cast from pointer to pointer. The samples are aligned to their size in the FIFO buffers.*/
+uint32 SampleChecker::FindFirstMasked(const uint8 * const samples,
+                                      const uint32 numberOfSamples,
+                                      const uint64 mask) const {
+    uint32 i = 0u;
+    if (sampleSize == 1u) {
+        i = FindFirstMaskedT<uint8>(samples, numberOfSamples, static_cast<uint8>(mask));
+    }
+    else if (sampleSize == 2u) {
+        i = FindFirstMaskedT<uint16>(reinterpret_cast<const uint16 *>(samples), numberOfSamples, static_cast<uint16>(mask));
+    }
+    else if (sampleSize == 4u) {
+        i = FindFirstMaskedT<uint32>(reinterpret_cast<const uint32 *>(samples), numberOfSamples, static_cast<uint32>(mask));
+    }
+    else if (sampleSize == 8u) {
+        i = FindFirstMaskedT<uint64>(reinterpret_cast<const uint64 *>(samples), numberOfSamples, mask);
+    }
+    else {
+        bool found = false;
+        while ((i < numberOfSamples) && (!found)) {
+            found = ((ReadSample(&samples[i * sampleSize]) & mask) != 0ull);
+            if (!found) {
+                i++;
+            }
+        }
+    }
+    return i;
+}
+
+/*lint -e{927} -e{826} -e{740} Allowed cast from pointer to pointer. The samples are aligned to their size in the FIFO buffers.*/
+uint32 SampleChecker::FindFirstStep(const uint8 * const first,
+                                    const uint8 * const second,
+                                    const uint32 numberOfSamples,
+                                    const uint64 step) const {
+    uint32 i = 0u;
+    if (sampleSize == 1u) {
+        i = FindFirstStepT<uint8>(first, second, numberOfSamples, static_cast<uint8>(step));
+    }
+    else if (sampleSize == 2u) {
+        i = FindFirstStepT<uint16>(reinterpret_cast<const uint16 *>(first), reinterpret_cast<const uint16 *>(second), numberOfSamples, static_cast<uint16>(step));
+    }
+    else if (sampleSize == 4u) {
+        i = FindFirstStepT<uint32>(reinterpret_cast<const uint32 *>(first), reinterpret_cast<const uint32 *>(second), numberOfSamples, static_cast<uint32>(step));
+    }
+    else if (sampleSize == 8u) {
+        i = FindFirstStepT<uint64>(reinterpret_cast<const uint64 *>(first), reinterpret_cast<const uint64 *>(second), numberOfSamples, step);
+    }
+    else {
+        const uint64 valueMask = GetSampleValueMask();
+        bool found = false;
+        while ((i < numberOfSamples) && (!found)) {
+            uint64 expected = ((ReadSample(&first[i * sampleSize]) + step) & valueMask);
+            found = (ReadSample(&second[i * sampleSize]) == expected);
+            if (!found) {
+                i++;
+            }
+        }
+    }
+    return i;
+}
+
 }
@@ -34,6 +34,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "MemoryOperationsHelper.h"
 #include "Object.h"
 
 /*---------------------------------------------------------------------------*/
@@ -41,6 +42,11 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe { 
 
+/**
+ * The number of samples which are tested together by the SampleChecker search methods.
+ */
+const uint32 SAMPLE_CHECKER_BLOCK_SIZE = 16u;
+
 /**
  * @brief The SampleChecker class. This class is used by the CounterChecker and
  * MarkerBitChecker classes of the NI9157 DataSource.
@@ -95,6 +101,54 @@ public:
 
 protected:
 
+    /**
+     * @brief Reads the sample at \a sample as an unsigned value of sampleSize bytes.
+     * @param[in] sample the memory of the sample.
+     * @return the value of the sample.
+     */
+    inline uint64 ReadSample(const uint8 * const sample) const;
+
+    /**
+     * @brief Writes the sampleSize lower bytes of \a value in \a sample.
+     * @param[out] sample the memory of the sample.
+     * @param[in] value the value to write.
+     */
+    inline void WriteSample(uint8 * const sample,
+                            const uint64 value) const;
+
+    /**
+     * @brief Gets the mask of the bits which fit in a sample.
+     * @return the mask of the sampleSize lower bytes.
+     */
+    inline uint64 GetSampleValueMask() const;
+
+    /**
+     * @brief Finds the first sample with any of the \a mask bits set.
+     * @details For 1, 2, 4 and 8 bytes samples the samples are tested in blocks of SAMPLE_CHECKER_BLOCK_SIZE with a branch-free
+     * reduction (which the compiler can vectorise) and only the block which matches is scanned sample by sample.
+     * @param[in] samples the samples to search.
+     * @param[in] numberOfSamples the number of samples to search.
+     * @param[in] mask the bits to search.
+     * @return the index of the first matching sample or \a numberOfSamples if none matches.
+     */
+    uint32 FindFirstMasked(const uint8 * const samples,
+                           const uint32 numberOfSamples,
+                           const uint64 mask) const;
+
+    /**
+     * @brief Finds the first sample of \a second which is equal to the sample at the same index of \a first plus \a step.
+     * @details The sum wraps around at the sample size. The search is performed in blocks as for FindFirstMasked.
+     * @param[in] first the samples to be incremented.
+     * @param[in] second the samples to compare.
+     * @param[in] numberOfSamples the number of samples to search.
+     * @param[in] step the difference to search.
+     * @return the index of the first matching sample or \a numberOfSamples if none matches.
+     */
+    uint32 FindFirstStep(const uint8 * const first,
+                         const uint8 * const second,
+                         const uint32 numberOfSamples,
+                         const uint64 step) const;
+
     /**
      * The size of each sample in bytes.
      */
@@ -105,6 +159,24 @@ protected:
      */
     uint8 nFrameForSync;
 
+private:
+
+    /**
+     * @brief FindFirstMasked for samples of type T.
+     */
+    template<typename T>
+    static uint32 FindFirstMaskedT(const T * const samples,
+                                   const uint32 numberOfSamples,
+                                   const T mask);
+
+    /**
+     * @brief FindFirstStep for samples of type T.
+     */
+    template<typename T>
+    static uint32 FindFirstStepT(const T * const first,
+                                 const T * const second,
+                                 const uint32 numberOfSamples,
+                                 const T step);
 };
 
 }
@@ -112,5 +184,113 @@ protected:
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/*lint -e{927} -e{826} -e{740} Allowed cast from pointer to pointer. The samples are aligned to their size in the FIFO buffers.*/
+uint64 SampleChecker::ReadSample(const uint8 * const sample) const {
+    uint64 value = 0ull;
+    if (sampleSize == 1u) {
+        value = static_cast<uint64>(*sample);
+    }
+    else if (sampleSize == 2u) {
+        value = static_cast<uint64>(*reinterpret_cast<const uint16 *>(sample));
+    }
+    else if (sampleSize == 4u) {
+        value = static_cast<uint64>(*reinterpret_cast<const uint32 *>(sample));
+    }
+    else if (sampleSize == 8u) {
+        value = *reinterpret_cast<const uint64 *>(sample);
+    }
+    else {
+        (void) MemoryOperationsHelper::Copy(&value, sample, sampleSize);
+    }
+    return value;
+}
+
+/*lint -e{927} -e{826} -e{740} Allowed cast from pointer to pointer. The samples are aligned to their size in the FIFO buffers.*/
+void SampleChecker::WriteSample(uint8 * const sample,
+                                const uint64 value) const {
+    if (sampleSize == 1u) {
+        *sample = static_cast<uint8>(value);
+    }
+    else if (sampleSize == 2u) {
+        *reinterpret_cast<uint16 *>(sample) = static_cast<uint16>(value);
+    }
+    else if (sampleSize == 4u) {
+        *reinterpret_cast<uint32 *>(sample) = static_cast<uint32>(value);
+    }
+    else if (sampleSize == 8u) {
+        *reinterpret_cast<uint64 *>(sample) = value;
+    }
+    else {
+        (void) MemoryOperationsHelper::Copy(sample, &value, sampleSize);
+    }
+}
+
+uint64 SampleChecker::GetSampleValueMask() const {
+    uint64 mask = 0xFFFFFFFFFFFFFFFFull;
+    if (sampleSize < 8u) {
+        mask = ((1ull << (8u * static_cast<uint32>(sampleSize))) - 1ull);
+    }
+    return mask;
+}
+
+template<typename T>
+uint32 SampleChecker::FindFirstMaskedT(const T * const samples,
+                                       const uint32 numberOfSamples,
+                                       const T mask) {
+    uint32 i = 0u;
+    bool found = false;
+    //skip the blocks without any match
+    while (((i + SAMPLE_CHECKER_BLOCK_SIZE) <= numberOfSamples) && (!found)) {
+        T acc = 0u;
+        for (uint32 b = 0u; b < SAMPLE_CHECKER_BLOCK_SIZE; b++) {
+            acc |= samples[i + b];
+        }
+        found = ((acc & mask) != 0u);
+        if (!found) {
+            i += SAMPLE_CHECKER_BLOCK_SIZE;
+        }
+    }
+    found = false;
+    while ((i < numberOfSamples) && (!found)) {
+        found = ((samples[i] & mask) != 0u);
+        if (!found) {
+            i++;
+        }
+    }
+    return i;
+}
+
+template<typename T>
+uint32 SampleChecker::FindFirstStepT(const T * const first,
+                                     const T * const second,
+                                     const uint32 numberOfSamples,
+                                     const T step) {
+    uint32 i = 0u;
+    bool found = false;
+    //skip the blocks without any match
+    while (((i + SAMPLE_CHECKER_BLOCK_SIZE) <= numberOfSamples) && (!found)) {
+        uint8 hit = 0u;
+        for (uint32 b = 0u; b < SAMPLE_CHECKER_BLOCK_SIZE; b++) {
+            hit |= static_cast<uint8>((static_cast<T>(second[i + b] - first[i + b]) == step) ? 1u : 0u);
+        }
+        found = (hit != 0u);
+        if (!found) {
+            i += SAMPLE_CHECKER_BLOCK_SIZE;
+        }
+    }
+    found = false;
+    while ((i < numberOfSamples) && (!found)) {
+        found = (static_cast<T>(second[i] - first[i]) == step);
+        if (!found) {
+            i++;
+        }
+    }
+    return i;
+}
+
+}
+
 
 #endif /* NI9157SAMPLECHECKER_H_ */
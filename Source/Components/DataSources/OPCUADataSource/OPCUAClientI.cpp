@@ -31,11 +31,106 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Directory.h"
+#include "FastPollingMutexSem.h"
+#include "File.h"
 #include "OPCUAClientI.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * First line of the NodeId cache files.
+ */
+const MARTe::char8 *const OPCUA_NODEID_CACHE_MAGIC = "OPCUANodeIdCache 1";
+
+/**
+ * Serialises the accesses to the NodeId cache files (which can be shared by several clients).
+ */
+MARTe::FastPollingMutexSem nodeIdCacheMutex;
+
+/**
+ * @brief Splits a line of the cache file in numberOfFields tab separated fields (the last one takes the rest of the line).
+ */
+bool SplitCacheLine(const MARTe::char8 *const line,
+                    MARTe::StreamString *const fields,
+                    const MARTe::uint32 numberOfFields) {
+    MARTe::uint32 f = 0u;
+    MARTe::uint32 i = 0u;
+    while (line[i] != '\0') {
+        if ((line[i] == '\t') && ((f + 1u) < numberOfFields)) {
+            f++;
+        }
+        else {
+            fields[f] += line[i];
+        }
+        i++;
+    }
+    return ((f + 1u) == numberOfFields);
+}
+
+/**
+ * @brief Parses an unsigned decimal number.
+ */
+bool ParseUnsigned(const MARTe::char8 *const str,
+                   MARTe::uint32 &value) {
+    value = 0u;
+    bool ok = (str[0] != '\0');
+    MARTe::uint32 i = 0u;
+    while ((ok) && (str[i] != '\0')) {
+        ok = ((str[i] >= '0') && (str[i] <= '9'));
+        if (ok) {
+            value = (value * 10u) + static_cast<MARTe::uint32>(str[i] - '0');
+        }
+        i++;
+    }
+    return ok;
+}
+
+/**
+ * @brief Builds the browse path of a node, starting from the Objects folder and following any hierarchical reference.
+ */
+bool BuildBrowsePath(const MARTe::uint16 namespaceIndex,
+                     MARTe::StreamString &nodePath,
+                     UA_BrowsePath &browsePath) {
+    using namespace MARTe;
+    StreamString pathTokenized;
+    uint32 pathSize = 0u;
+    char8 ignore;
+    bool ok = nodePath.Seek(0LLU);
+    if (ok) {
+        /* This cycle is for getting the path size only */
+        while (nodePath.GetToken(pathTokenized, ".", ignore)) {
+            pathSize++;
+            pathTokenized = "";
+        }
+        ok = (pathSize > 0u);
+    }
+    if (ok) {
+        ok = nodePath.Seek(0LLU);
+    }
+    if (ok) {
+        browsePath.startingNode = UA_NODEID_NUMERIC(0u, 85u); /* UA_NS0ID_OBJECTSFOLDER */
+        browsePath.relativePath.elements = reinterpret_cast<UA_RelativePathElement*>(UA_Array_new(static_cast<osulong>(pathSize),
+                                                                                                  &UA_TYPES[UA_TYPES_RELATIVEPATHELEMENT]));
+        browsePath.relativePath.elementsSize = pathSize;
+        for (uint32 j = 0u; (j < pathSize) && (ok); j++) {
+            pathTokenized = "";
+            ok = nodePath.GetToken(pathTokenized, ".", ignore);
+            if (ok) {
+                UA_RelativePathElement *elem = &(browsePath.relativePath.elements[j]);
+                elem->referenceTypeId = UA_NODEID_NUMERIC(0u, 33u); /* UA_NS0ID_HIERARCHICALREFERENCES */
+                /*lint -e{1013} -e{63} -e{40} includeSubtypes is a member of struct UA_RelativePathElement.*/
+                elem->includeSubtypes = true;
+                /*lint -e{1055} -e{64} -e{746} UA_QUALIFIEDNAME is declared in the open62541 library.*/
+                elem->targetName = UA_QUALIFIEDNAME_ALLOC(namespaceIndex, pathTokenized.Buffer());
+            }
+        }
+    }
+    return ok;
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -55,6 +150,8 @@ OPCUAClientI::OPCUAClientI() {
     dataPtr = NULL_PTR(void*);
     tempDataPtr = NULL_PTR(uint8*);
     nOfNodes = 0u;
+    nodeIdCacheFile = "";
+    translateBatchSize = 500u;
 }
 
 /*lint -e{1740} opcuaClient freed by UA_Client_delete*/
@@ -86,6 +183,16 @@ void OPCUAClientI::SetServerAddress(StreamString address) {
     serverAddress = address;
 }
 
+void OPCUAClientI::SetNodeIdCacheFile(const StreamString &fileName) {
+    nodeIdCacheFile = fileName;
+}
+
+void OPCUAClientI::SetTranslateBatchSize(const uint32 batchSize) {
+    if (batchSize > 0u) {
+        translateBatchSize = batchSize;
+    }
+}
+
 bool OPCUAClientI::Connect() {
     UA_StatusCode retval = UA_Client_connect(opcuaClient, const_cast<char8*>(serverAddress.Buffer()));
     return (retval == 0x00U); /* UA_STATUSCODE_GOOD */
@@ -212,6 +319,328 @@ uint32 OPCUAClientI::GetReferences(const UA_BrowseRequest bReq,
     return id;
 }
 
+bool OPCUAClientI::ResolveNodeIds(const uint16 *const namespaceIndexes,
+                                  StreamString *const nodePaths,
+                                  const uint32 numberOfNodes,
+                                  UA_NodeId *const nodeIds) {
+    bool ok = ((nodeIds != NULL_PTR(UA_NodeId*)) && (numberOfNodes > 0u));
+    bool *resolved = NULL_PTR(bool*);
+    StreamString *keys = NULL_PTR(StreamString*);
+    StreamString namespaces;
+    StreamString otherEntries;
+    uint32 numberOfCached = 0u;
+    bool useCache = (nodeIdCacheFile.Size() > 0u);
+    if (ok) {
+        resolved = new bool[numberOfNodes];
+        for (uint32 i = 0u; i < numberOfNodes; i++) {
+            resolved[i] = false;
+        }
+    }
+    if ((ok) && (useCache)) {
+        useCache = ReadNamespaceArray(namespaces);
+        if (!useCache) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not read the NamespaceArray of %s. The NodeId cache is not used.", serverAddress.Buffer());
+        }
+    }
+    if ((ok) && (useCache)) {
+        keys = new StreamString[numberOfNodes];
+        for (uint32 i = 0u; i < numberOfNodes; i++) {
+            (void) keys[i].Printf("%u:%s", namespaceIndexes[i], nodePaths[i].Buffer());
+        }
+        if (nodeIdCacheMutex.FastLock() == ErrorManagement::NoError) {
+            numberOfCached = LoadNodeIdCache(namespaces, keys, numberOfNodes, nodeIds, resolved, otherEntries);
+            nodeIdCacheMutex.FastUnLock();
+        }
+        if (numberOfCached > 0u) {
+            VerifyNodeIds(numberOfNodes, nodeIds, resolved);
+        }
+    }
+    if (ok) {
+        ok = TranslateBrowsePaths(namespaceIndexes, nodePaths, numberOfNodes, nodeIds, resolved);
+    }
+    if ((ok) && (useCache)) {
+        if (nodeIdCacheMutex.FastLock() == ErrorManagement::NoError) {
+            //Collect the entries written by the other clients in the meanwhile
+            otherEntries = "";
+            (void) LoadNodeIdCache(namespaces, keys, numberOfNodes, nodeIds, resolved, otherEntries);
+            SaveNodeIdCache(namespaces, keys, numberOfNodes, nodeIds, otherEntries);
+            nodeIdCacheMutex.FastUnLock();
+        }
+    }
+    if (ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Resolved %u NodeIds (%u from the cache)", numberOfNodes, numberOfCached);
+    }
+    if (resolved != NULL_PTR(bool*)) {
+        delete[] resolved;
+    }
+    if (keys != NULL_PTR(StreamString*)) {
+        delete[] keys;
+    }
+    return ok;
+}
+
+bool OPCUAClientI::ReadNamespaceArray(StreamString &namespaces) {
+    UA_Variant value;
+    UA_Variant_init(&value);
+    /*lint -e{1055} -e{526} -e{628} -e{746} UA_Client_readValueAttribute is declared in the open62541 library.*/
+    UA_StatusCode retval = UA_Client_readValueAttribute(opcuaClient, UA_NODEID_NUMERIC(0u, 2255u), &value); /* UA_NS0ID_SERVER_NAMESPACEARRAY */
+    bool ok = (retval == 0x00U); /* UA_STATUSCODE_GOOD */
+    if (ok) {
+        ok = UA_Variant_hasArrayType(&value, &UA_TYPES[UA_TYPES_STRING]);
+    }
+    if (ok) {
+        const UA_String *uris = reinterpret_cast<const UA_String*>(value.data);
+        for (uint32 i = 0u; (i < value.arrayLength) && (ok); i++) {
+            if (i > 0u) {
+                namespaces += '\t';
+            }
+            uint32 size = static_cast<uint32>(uris[i].length);
+            if (size > 0u) {
+                ok = namespaces.Write(reinterpret_cast<const char8*>(uris[i].data), size);
+            }
+        }
+    }
+    UA_Variant_clear(&value);
+    return ok;
+}
+
+uint32 OPCUAClientI::LoadNodeIdCache(const StreamString &namespaces,
+                                     const StreamString *const keys,
+                                     const uint32 numberOfNodes,
+                                     UA_NodeId *const nodeIds,
+                                     bool *const resolved,
+                                     StreamString &otherEntries) {
+    uint32 numberOfLoaded = 0u;
+    File cacheFile;
+    bool ok = cacheFile.Open(nodeIdCacheFile.Buffer(), BasicFile::ACCESS_MODE_R);
+    StreamString line;
+    if (ok) {
+        ok = cacheFile.GetLine(line);
+        if (ok) {
+            ok = (line == OPCUA_NODEID_CACHE_MAGIC);
+        }
+        line = "";
+        if (ok) {
+            ok = cacheFile.GetLine(line);
+        }
+        if (ok) {
+            ok = (line == serverAddress.Buffer());
+        }
+        line = "";
+        if (ok) {
+            ok = cacheFile.GetLine(line);
+        }
+        if (ok) {
+            ok = (line == namespaces.Buffer());
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "The NodeId cache %s is not valid for the server %s", nodeIdCacheFile.Buffer(),
+                                serverAddress.Buffer());
+        }
+    }
+    if (ok) {
+        line = "";
+        while (cacheFile.GetLine(line)) {
+            StreamString fields[4];
+            uint32 nodeNamespace = 0u;
+            if (SplitCacheLine(line.Buffer(), &fields[0], 4u)) {
+                if (ParseUnsigned(fields[1].Buffer(), nodeNamespace)) {
+                    uint32 j = numberOfNodes;
+                    for (uint32 i = 0u; (i < numberOfNodes) && (j == numberOfNodes); i++) {
+                        if (keys[i] == fields[0].Buffer()) {
+                            j = i;
+                        }
+                    }
+                    if (j == numberOfNodes) {
+                        otherEntries += line;
+                        otherEntries += '\n';
+                    }
+                    else if (!resolved[j]) {
+                        uint32 numericNodeId = 0u;
+                        if (fields[2] == "i") {
+                            resolved[j] = ParseUnsigned(fields[3].Buffer(), numericNodeId);
+                            if (resolved[j]) {
+                                nodeIds[j] = UA_NODEID_NUMERIC(static_cast<uint16>(nodeNamespace), numericNodeId);
+                            }
+                        }
+                        else if (fields[2] == "s") {
+                            nodeIds[j] = UA_NODEID_STRING_ALLOC(static_cast<uint16>(nodeNamespace), fields[3].Buffer());
+                            resolved[j] = true;
+                        }
+                        else {
+                            //Not cached
+                        }
+                        if (resolved[j]) {
+                            numberOfLoaded++;
+                        }
+                    }
+                    else {
+                        //Already resolved
+                    }
+                }
+            }
+            line = "";
+        }
+    }
+    if (cacheFile.IsOpen()) {
+        (void) cacheFile.Close();
+    }
+    return numberOfLoaded;
+}
+
+void OPCUAClientI::VerifyNodeIds(const uint32 numberOfNodes,
+                                 UA_NodeId *const nodeIds,
+                                 bool *const resolved) {
+    uint32 *cached = new uint32[numberOfNodes];
+    uint32 numberOfCached = 0u;
+    for (uint32 i = 0u; i < numberOfNodes; i++) {
+        if (resolved[i]) {
+            cached[numberOfCached] = i;
+            numberOfCached++;
+        }
+    }
+    for (uint32 first = 0u; first < numberOfCached; first += translateBatchSize) {
+        uint32 count = numberOfCached - first;
+        if (count > translateBatchSize) {
+            count = translateBatchSize;
+        }
+        UA_ReadRequest rReq;
+        UA_ReadRequest_init(&rReq);
+        rReq.nodesToRead = reinterpret_cast<UA_ReadValueId*>(UA_Array_new(static_cast<osulong>(count), &UA_TYPES[UA_TYPES_READVALUEID]));
+        rReq.nodesToReadSize = count;
+        for (uint32 k = 0u; k < count; k++) {
+            (void) UA_NodeId_copy(&nodeIds[cached[first + k]], &(rReq.nodesToRead[k].nodeId));
+            rReq.nodesToRead[k].attributeId = 2u; /* UA_ATTRIBUTEID_NODECLASS */
+        }
+        UA_ReadResponse rResp = UA_Client_Service_read(opcuaClient, rReq);
+        bool valid = (rResp.responseHeader.serviceResult == 0x00U); /* UA_STATUSCODE_GOOD */
+        if (valid) {
+            valid = (rResp.resultsSize == count);
+        }
+        for (uint32 k = 0u; k < count; k++) {
+            bool exists = valid;
+            if (exists) {
+                /*lint -e{1013} -e{63} -e{40} hasStatus and hasValue are members of struct UA_DataValue.*/
+                exists = ((!rResp.results[k].hasStatus) || (rResp.results[k].status == 0x00U)) && (rResp.results[k].hasValue);
+            }
+            if (!exists) {
+                uint32 idx = cached[first + k];
+                UA_NodeId_clear(&nodeIds[idx]);
+                resolved[idx] = false;
+            }
+        }
+        UA_ReadResponse_clear(&rResp);
+        UA_ReadRequest_clear(&rReq);
+    }
+    delete[] cached;
+}
+
+bool OPCUAClientI::TranslateBrowsePaths(const uint16 *const namespaceIndexes,
+                                        StreamString *const nodePaths,
+                                        const uint32 numberOfNodes,
+                                        UA_NodeId *const nodeIds,
+                                        bool *const resolved) {
+    bool ok = true;
+    uint32 *pending = new uint32[numberOfNodes];
+    uint32 numberOfPending = 0u;
+    for (uint32 i = 0u; i < numberOfNodes; i++) {
+        if (!resolved[i]) {
+            pending[numberOfPending] = i;
+            numberOfPending++;
+        }
+    }
+    for (uint32 first = 0u; (first < numberOfPending) && (ok); first += translateBatchSize) {
+        uint32 count = numberOfPending - first;
+        if (count > translateBatchSize) {
+            count = translateBatchSize;
+        }
+        UA_TranslateBrowsePathsToNodeIdsRequest tbpReq;
+        UA_TranslateBrowsePathsToNodeIdsRequest_init(&tbpReq);
+        tbpReq.browsePaths = reinterpret_cast<UA_BrowsePath*>(UA_Array_new(static_cast<osulong>(count), &UA_TYPES[UA_TYPES_BROWSEPATH]));
+        tbpReq.browsePathsSize = count;
+        for (uint32 k = 0u; (k < count) && (ok); k++) {
+            uint32 idx = pending[first + k];
+            ok = BuildBrowsePath(namespaceIndexes[idx], nodePaths[idx], tbpReq.browsePaths[k]);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Invalid Path %s", nodePaths[idx].Buffer());
+            }
+        }
+        if (ok) {
+            UA_TranslateBrowsePathsToNodeIdsResponse tbpResp = UA_Client_Service_translateBrowsePathsToNodeIds(opcuaClient, tbpReq);
+            ok = (tbpResp.responseHeader.serviceResult == 0x00U); /* UA_STATUSCODE_GOOD */
+            if (ok) {
+                ok = (tbpResp.resultsSize == count);
+            }
+            if (ok) {
+                for (uint32 k = 0u; k < count; k++) {
+                    uint32 idx = pending[first + k];
+                    if ((tbpResp.results[k].statusCode == 0x00U) && (tbpResp.results[k].targetsSize > 0u)) {
+                        (void) UA_NodeId_copy(&(tbpResp.results[k].targets[0].targetId.nodeId), &nodeIds[idx]);
+                        resolved[idx] = true;
+                    }
+                    else {
+                        REPORT_ERROR_STATIC(ErrorManagement::Information, "An Error occurred on TranslateBrowsePathsToNodeIds service call for %s",
+                                            nodePaths[idx].Buffer());
+                        ok = false;
+                    }
+                }
+            }
+            else {
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "An Error occurred on TranslateBrowsePathsToNodeIds service call");
+            }
+            UA_TranslateBrowsePathsToNodeIdsResponse_clear(&tbpResp);
+        }
+        UA_TranslateBrowsePathsToNodeIdsRequest_clear(&tbpReq);
+    }
+    delete[] pending;
+    return ok;
+}
+
+void OPCUAClientI::SaveNodeIdCache(const StreamString &namespaces,
+                                   const StreamString *const keys,
+                                   const uint32 numberOfNodes,
+                                   const UA_NodeId *const nodeIds,
+                                   const StreamString &otherEntries) {
+    Directory fileToDelete(nodeIdCacheFile.Buffer());
+    (void) fileToDelete.Delete();
+    File cacheFile;
+    bool ok = cacheFile.Open(nodeIdCacheFile.Buffer(), (BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT));
+    if (ok) {
+        ok = cacheFile.Printf("%s\n%s\n%s\n", OPCUA_NODEID_CACHE_MAGIC, serverAddress.Buffer(), namespaces.Buffer());
+    }
+    for (uint32 i = 0u; (i < numberOfNodes) && (ok); i++) {
+        StreamString line;
+        if (nodeIds[i].identifierType == UA_NODEIDTYPE_NUMERIC) {
+            ok = line.Printf("%s\t%u\ti\t%u\n", keys[i].Buffer(), nodeIds[i].namespaceIndex, nodeIds[i].identifier.numeric);
+        }
+        else if (nodeIds[i].identifierType == UA_NODEIDTYPE_STRING) {
+            ok = line.Printf("%s\t%u\ts\t", keys[i].Buffer(), nodeIds[i].namespaceIndex);
+            uint32 size = static_cast<uint32>(nodeIds[i].identifier.string.length);
+            if ((ok) && (size > 0u)) {
+                ok = line.Write(reinterpret_cast<const char8*>(nodeIds[i].identifier.string.data), size);
+            }
+            line += '\n';
+        }
+        else {
+            //GUID and ByteString NodeIds are not cached
+        }
+        uint32 size = static_cast<uint32>(line.Size());
+        if ((ok) && (size > 0u)) {
+            ok = cacheFile.Write(line.Buffer(), size);
+        }
+    }
+    uint32 otherSize = static_cast<uint32>(otherEntries.Size());
+    if ((ok) && (otherSize > 0u)) {
+        ok = cacheFile.Write(otherEntries.Buffer(), otherSize);
+    }
+    if (cacheFile.IsOpen()) {
+        ok = (cacheFile.Close()) && (ok);
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not write the NodeId cache %s", nodeIdCacheFile.Buffer());
+    }
+}
+
 StreamString OPCUAClientI::GetServerAddress() const {
     return serverAddress;
 }
@@ -64,6 +64,18 @@ public:
      */
     void SetServerAddress(StreamString address);
 
+    /**
+     * @brief Sets the file where the NodeIds resolved by SetServiceRequest are cached (see ResolveNodeIds).
+     * @param[in] fileName the name of the cache file (empty to disable the cache, which is the default).
+     */
+    void SetNodeIdCacheFile(const StreamString &fileName);
+
+    /**
+     * @brief Sets the maximum number of browse paths translated (or of cached NodeIds verified) by each request (see ResolveNodeIds).
+     * @param[in] batchSize the maximum number of browse paths per request (> 0). Default = 500.
+     */
+    void SetTranslateBatchSize(const uint32 batchSize);
+
     /**
      * @brief Connects the Client to the Server
      * @pre SetServerAddress
@@ -181,6 +193,27 @@ protected:
                          uint32 &numericNodeId,
                          char8 *&stringNodeId);
 
+    /**
+     * @brief Resolves the NodeIds of a set of browse paths.
+     * @details The browse paths are relative to the Objects folder and every element of a path follows any hierarchical reference
+     * (HierarchicalReferences and its subtypes). All the paths are translated with TranslateBrowsePathsToNodeIds requests of (at most)
+     * SetTranslateBatchSize paths each, instead of one request per path.
+     *
+     * If a cache file is set (see SetNodeIdCacheFile), the NodeIds are first searched in the file, which is only valid for the same server
+     * address and NamespaceArray. The cached NodeIds are verified with a batched Read of their NodeClass and the paths which are not cached
+     * (or no longer exist) are translated. The file is then updated with the new NodeIds (keeping the entries of the other clients which
+     * share the same file). Thus, a restart against the same server does not translate any browse path.
+     * @param[in] namespaceIndexes the namespace index of (all the elements of) each path.
+     * @param[in] nodePaths the browse path of each node (e.g. Object1.Block1.Node1).
+     * @param[in] numberOfNodes the number of paths.
+     * @param[out] nodeIds the NodeId of each path (allocated by the caller).
+     * @return true if all the paths were resolved.
+     */
+    bool ResolveNodeIds(const uint16 *const namespaceIndexes,
+                        StreamString *const nodePaths,
+                        const uint32 numberOfNodes,
+                        UA_NodeId *const nodeIds);
+
     /**
      * Holds the server address
      */
@@ -211,6 +244,60 @@ protected:
      */
     uint8 *tempDataPtr;
 
+private:
+
+    /**
+     * @brief Reads the NamespaceArray of the server (joined with tabs), which validates the cache file.
+     */
+    bool ReadNamespaceArray(StreamString &namespaces);
+
+    /**
+     * @brief Loads the cached NodeIds of the paths in \a keys (the keys of the other clients are appended to otherEntries).
+     * @return the number of NodeIds loaded.
+     */
+    uint32 LoadNodeIdCache(const StreamString &namespaces,
+                           const StreamString *const keys,
+                           const uint32 numberOfNodes,
+                           UA_NodeId *const nodeIds,
+                           bool *const resolved,
+                           StreamString &otherEntries);
+
+    /**
+     * @brief Removes (i.e. sets as not resolved) the cached NodeIds which do not exist in the server.
+     */
+    void VerifyNodeIds(const uint32 numberOfNodes,
+                       UA_NodeId *const nodeIds,
+                       bool *const resolved);
+
+    /**
+     * @brief Translates the browse paths which are not resolved.
+     * @return true if all the paths were resolved.
+     */
+    bool TranslateBrowsePaths(const uint16 *const namespaceIndexes,
+                              StreamString *const nodePaths,
+                              const uint32 numberOfNodes,
+                              UA_NodeId *const nodeIds,
+                              bool *const resolved);
+
+    /**
+     * @brief Writes the cache file.
+     */
+    void SaveNodeIdCache(const StreamString &namespaces,
+                         const StreamString *const keys,
+                         const uint32 numberOfNodes,
+                         const UA_NodeId *const nodeIds,
+                         const StreamString &otherEntries);
+
+    /**
+     * The file where the NodeIds are cached.
+     */
+    StreamString nodeIdCacheFile;
+
+    /**
+     * The maximum number of browse paths per request.
+     */
+    uint32 translateBatchSize;
+
 };
 
 }
@@ -31,6 +31,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
 #include "OPCUAClientMethod.h"
 
 /*---------------------------------------------------------------------------*/
@@ -51,6 +52,18 @@ OPCUAClientMethod::OPCUAClientMethod() :
     eos = NULL_PTR(UA_ExtensionObject*);
     valuePtr = NULL_PTR(UA_ExtensionObject*);
     nOfEos = 0u;
+    maxCallsInFlight = 1u;
+    callsInFlight = 0u;
+    callRequestIds = new UA_UInt32[maxCallsInFlight];
+    callStartCounters = new uint64[maxCallsInFlight];
+    callSlotUsed = new bool[maxCallsInFlight];
+    callSlotUsed[0u] = false;
+    asyncCallFailed = false;
+    numberOfCalls = 0u;
+    numberOfFailedCalls = 0u;
+    lastCallLatency = 0u;
+    maxCallLatency = 0u;
+    totalCallLatency = 0u;
 }
 
 /*lint -e{1579} -e{1740} all pointers have been freed*/
@@ -69,6 +82,12 @@ OPCUAClientMethod::~OPCUAClientMethod() {
             (void) UA_ExtensionObject_clear(eos);
         }
     }
+    /*lint -e{1551} no exception on delete*/
+    delete[] callRequestIds;
+    /*lint -e{1551} no exception on delete*/
+    delete[] callStartCounters;
+    /*lint -e{1551} no exception on delete*/
+    delete[] callSlotUsed;
 }
 
 bool OPCUAClientMethod::SetServiceRequest(const uint16 *const namespaceIndexes,
@@ -80,99 +99,7 @@ bool OPCUAClientMethod::SetServiceRequest(const uint16 *const namespaceIndexes,
     monitoredNodes = reinterpret_cast<UA_NodeId*>(UA_Array_new(static_cast<osulong>(nOfNodes), &UA_TYPES[UA_TYPES_NODEID]));
     tempVariant = reinterpret_cast<UA_Variant*>(UA_Array_new(static_cast<osulong>(nOfNodes), &UA_TYPES[UA_TYPES_VARIANT]));
 
-    for (uint32 i = 0u; i < nOfNodes; i++) {
-        REPORT_ERROR_STATIC(ErrorManagement::Information, "Registering Node %s", nodePaths[i].Buffer());
-        ok = nodePaths[i].Seek(0LLU);
-
-        StreamString pathTokenized;
-        uint32 pathSize = 0u;
-        char8 ignore;
-        if (ok) {
-            /* This cycle is for getting the path size only */
-            do {
-                ok = nodePaths[i].GetToken(pathTokenized, ".", ignore);
-                if (ok) {
-                    pathSize++;
-                }
-                pathTokenized = "";
-            }
-            while (ok);
-        }
-        StreamString *path = NULL_PTR(StreamString*);
-        uint32 *ids;
-        if (pathSize > 0u) {
-            path = new StreamString[pathSize];
-        }
-        ids = new uint32[pathSize];
-        ok = nodePaths[i].Seek(0LLU);
-
-        if (ok) {
-            if (path != NULL_PTR(StreamString*)) {
-                for (uint32 k = 0u; k < pathSize; k++) {
-                    ok = nodePaths[i].GetToken(pathTokenized, ".", ignore);
-                    if (ok) {
-                        StreamString s = pathTokenized;
-                        path[k] = s;
-                    }
-                    pathTokenized = "";
-                }
-            }
-        }
-
-        if (ok) {
-            /* Building request for Browse Service */
-            UA_BrowseRequest bReq;
-            UA_BrowseRequest_init(&bReq);
-            bReq.requestedMaxReferencesPerNode = 0u;
-            bReq.nodesToBrowse = UA_BrowseDescription_new();
-            UA_BrowseDescription_init(bReq.nodesToBrowse);
-            bReq.nodesToBrowseSize = 1u;
-
-            /* Building request for TranslateBrowsePathsToNodeIds */
-            UA_BrowsePath browsePath;
-            browsePath.startingNode = UA_NODEID_NUMERIC(0u, 85u); /* UA_NS0ID_OBJECTSFOLDER */
-            browsePath.relativePath.elements = reinterpret_cast<UA_RelativePathElement*>(UA_Array_new(static_cast<osulong>(pathSize),
-                                                                                                      &UA_TYPES[UA_TYPES_RELATIVEPATHELEMENT]));
-            browsePath.relativePath.elementsSize = pathSize;
-
-            uint32 tempNumericNodeId = 85u; /* UA_NS0ID_OBJECTSFOLDER */
-            uint16 tempNamespaceIndex = 0u;
-            char8 *tempStringNodeId = NULL_PTR(char8*);
-            if ((path != NULL_PTR(StreamString*)) && (ids != NULL_PTR(uint32*))) {
-                for (uint32 j = 0u; j < pathSize; j++) {
-                    ids[j] = GetReferences(bReq, const_cast<char8*>(path[j].Buffer()), tempNamespaceIndex, tempNumericNodeId, tempStringNodeId);
-                    UA_RelativePathElement *elem = &browsePath.relativePath.elements[j];
-                    elem->referenceTypeId = UA_NODEID_NUMERIC(0u, ids[j]);
-                    /*lint -e{1055} -e{64} -e{746} UA_QUALIFIEDNAME is declared in the open62541 library.*/
-                    elem->targetName = UA_QUALIFIEDNAME_ALLOC(namespaceIndexes[i], const_cast<char8*>(path[j].Buffer()));
-                }
-                if (tempStringNodeId != NULL_PTR(char8*)) {
-                    delete tempStringNodeId;
-                }
-            }
-
-            UA_TranslateBrowsePathsToNodeIdsRequest tbpReq;
-            UA_TranslateBrowsePathsToNodeIdsRequest_init(&tbpReq);
-            tbpReq.browsePaths = &browsePath;
-            tbpReq.browsePathsSize = 1u;
-
-            UA_TranslateBrowsePathsToNodeIdsResponse tbpResp = UA_Client_Service_translateBrowsePathsToNodeIds(opcuaClient, tbpReq);
-            ok = (tbpResp.responseHeader.serviceResult == 0x00U); /* UA_STATUSCODE_GOOD */
-            if (ok) {
-                if (tbpResp.results[0].statusCode == 0x00U) {
-                    UA_BrowsePathTarget *ref = &(tbpResp.results[0].targets[0]);
-                    (void) UA_NodeId_copy(&(ref->targetId.nodeId), &monitoredNodes[i]);
-                }
-                else {
-                    REPORT_ERROR_STATIC(ErrorManagement::Information, "An Error occurred on TranslateBrowsePathsToNodeIds service call");
-                    ok = false;
-                }
-            }
-            UA_Array_delete(browsePath.relativePath.elements, static_cast<osulong>(pathSize), &UA_TYPES[UA_TYPES_RELATIVEPATHELEMENT]);
-        }
-        delete[] ids;
-        delete[] path;
-    }
+    ok = ResolveNodeIds(namespaceIndexes, nodePaths, nOfNodes, monitoredNodes);
     return ok;
 }
 
@@ -416,48 +343,247 @@ bool OPCUAClientMethod::SetMethodRequest(const uint16 methodNamespaceIndex,
     return ok;
 }
 
+bool OPCUAClientMethod::PrepareCall() {
+    bool ok = ((eos != NULL_PTR(UA_ExtensionObject*)) && (valuePtr != NULL_PTR(UA_ExtensionObject*)) && (tempVariant != NULL_PTR(UA_Variant*))
+            && (dataPtr != NULL_PTR(void*)));
+    if (ok) {
+        uint32 actualBodyLength;
+        if (nOfEos > 1u) {
+            for (uint32 j = 0u; j < nOfEos; j++) {
+                if (ok) {
+                    /*lint -e{526} -e{628} -e{1055} -e{746} function defined in open62541*/
+                    UA_ExtensionObject_clear(&eos[j]);
+                    (void) UA_ExtensionObject_copy(&valuePtr[j], &eos[j]);
+                    ok = MemoryOperationsHelper::Copy(eos[j].content.encoded.body.data, dataPtr, static_cast<uint32>(eos[j].content.encoded.body.length));
+                    dataPtr = &reinterpret_cast<uint8*>(dataPtr)[eos[j].content.encoded.body.length];
+                }
+            }
+            actualBodyLength = (nOfEos * static_cast<uint32>(eos[0u].content.encoded.body.length));
+            SeekDataPtr(actualBodyLength);
+        }
+        else {
+            /*lint -e{526} -e{628} -e{1055} -e{746} function defined in open62541*/
+            UA_ExtensionObject_clear(eos);
+            (void) UA_ExtensionObject_copy(valuePtr, eos);
+            ok = MemoryOperationsHelper::Copy(eos->content.encoded.body.data, dataPtr, static_cast<uint32>(eos->content.encoded.body.length));
+        }
+    }
+    return ok;
+}
+
 bool OPCUAClientMethod::MethodCall() {
-    bool ok = true;
+    bool ok;
     UA_StatusCode retval;
     retval = readResponse.responseHeader.serviceResult;
     if (retval == 0x00U) {
-        if ((eos != NULL_PTR(UA_ExtensionObject*)) && (valuePtr != NULL_PTR(UA_ExtensionObject*)) && (tempVariant != NULL_PTR(UA_Variant*))
-                && (dataPtr != NULL_PTR(void*))) {
-            uint32 actualBodyLength;
-            if (nOfEos > 1u) {
-                for (uint32 j = 0u; j < nOfEos; j++) {
-                    if (ok) {
-                        (void) UA_ExtensionObject_copy(&valuePtr[j], &eos[j]);
-                        ok = MemoryOperationsHelper::Copy(eos[j].content.encoded.body.data, dataPtr, static_cast<uint32>(eos[j].content.encoded.body.length));
-                        dataPtr = &reinterpret_cast<uint8*>(dataPtr)[eos[j].content.encoded.body.length];
-                    }
-                }
-                actualBodyLength = (nOfEos * static_cast<uint32>(eos[0u].content.encoded.body.length));
-                SeekDataPtr(actualBodyLength);
-            }
-            else {
-                (void) UA_ExtensionObject_copy(valuePtr, eos);
-                ok = MemoryOperationsHelper::Copy(eos->content.encoded.body.data, dataPtr, static_cast<uint32>(eos->content.encoded.body.length));
-            }
-            UA_Variant output;
-            UA_Variant *output2 = &output;
-            UA_Variant_init(&output);
-            size_t outSize[1] = { 0u };
+        if (PrepareCall()) {
+            UA_Variant *output = NULL_PTR(UA_Variant*);
+            size_t outSize = 0u;
             size_t inSize = 1u;
-            if (ok) {
-                retval = UA_Client_call(opcuaClient, objectMethod, methodNodeId, inSize, tempVariant, &outSize[0], &output2);
+            uint64 startCounter = HighResolutionTimer::Counter();
+            retval = UA_Client_call(opcuaClient, objectMethod, methodNodeId, inSize, tempVariant, &outSize, &output);
+            if (retval == 0x00U) { /* UA_STATUSCODE_GOOD */
+                UpdateCallStatistics(HighResolutionTimer::Counter() - startCounter);
             }
+            /* The output arguments are allocated by the client */
+            UA_Array_delete(output, outSize, &UA_TYPES[UA_TYPES_VARIANT]);
         }
     }
     /* Renew Secure Channel when timed out */
     (void) UA_Client_run_iterate(opcuaClient, 100u);
     ok = (retval == 0x00U); /* UA_STATUSCODE_GOOD */
     if (!ok) {
+        numberOfFailedCalls++;
         REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "CallError - OPC UA Status Code (Part 4 - 7.34): %x", retval);
     }
     return ok;
 }
 
+bool OPCUAClientMethod::MethodCallAsync(const uint32 timeout) {
+    /* Process the responses received in the meanwhile and wait for a free slot */
+    bool ok = WaitForCallsInFlight(maxCallsInFlight - 1u, timeout);
+    if (asyncCallFailed) {
+        ok = false;
+    }
+    asyncCallFailed = false;
+    if (ok) {
+        ok = (readResponse.responseHeader.serviceResult == 0x00U);
+    }
+    if (ok) {
+        ok = PrepareCall();
+    }
+    uint32 slot = 0u;
+    if (ok) {
+        ok = false;
+        for (uint32 k = 0u; (k < maxCallsInFlight) && (!ok); k++) {
+            if (!callSlotUsed[k]) {
+                slot = k;
+                ok = true;
+            }
+        }
+    }
+    if (ok) {
+        /* Shallow copies: the request is encoded when sent */
+        UA_CallMethodRequest item;
+        UA_CallMethodRequest_init(&item);
+        item.objectId = objectMethod;
+        item.methodId = methodNodeId;
+        item.inputArguments = tempVariant;
+        item.inputArgumentsSize = 1u;
+        UA_CallRequest request;
+        UA_CallRequest_init(&request);
+        request.methodsToCall = &item;
+        request.methodsToCallSize = 1u;
+        UA_UInt32 requestId = 0u;
+        uint64 startCounter = HighResolutionTimer::Counter();
+        /*lint -e{929} -e{1055} function and types defined in open62541*/
+        UA_StatusCode status = __UA_Client_AsyncService(opcuaClient, &request, &UA_TYPES[UA_TYPES_CALLREQUEST], &OPCUAClientMethod::CallResponseCallback,
+                                                        &UA_TYPES[UA_TYPES_CALLRESPONSE], this, &requestId);
+        ok = (status == 0x00U); /* UA_STATUSCODE_GOOD */
+        if (ok) {
+            callRequestIds[slot] = requestId;
+            callStartCounters[slot] = startCounter;
+            callSlotUsed[slot] = true;
+            callsInFlight++;
+        }
+        else {
+            numberOfFailedCalls++;
+            REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "CallError - Failed to send the asynchronous Method Call: %x", status);
+        }
+    }
+    return ok;
+}
+
+bool OPCUAClientMethod::WaitForCalls(const uint32 timeout) {
+    bool ok = WaitForCallsInFlight(0u, timeout);
+    if (asyncCallFailed) {
+        ok = false;
+    }
+    asyncCallFailed = false;
+    return ok;
+}
+
+bool OPCUAClientMethod::WaitForCallsInFlight(const uint32 maxInFlight,
+                                             const uint32 timeout) {
+    /*lint -e{838} status is overwritten when waiting*/
+    UA_StatusCode status = UA_Client_run_iterate(opcuaClient, 0u);
+    bool ok = (status == 0x00U);
+    uint64 timeoutTicks = HighResolutionTimer::Frequency();
+    timeoutTicks *= timeout;
+    timeoutTicks /= 1000u;
+    uint64 startCounter = HighResolutionTimer::Counter();
+    while ((ok) && (callsInFlight > maxInFlight)) {
+        if ((HighResolutionTimer::Counter() - startCounter) > timeoutTicks) {
+            REPORT_ERROR_STATIC(ErrorManagement::Timeout, "CallError - Timeout waiting for %d asynchronous Method Calls", callsInFlight);
+            ok = false;
+        }
+        else {
+            status = UA_Client_run_iterate(opcuaClient, 10u);
+            ok = (status == 0x00U);
+        }
+    }
+    if (status != 0x00U) {
+        REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "CallError - OPC UA Status Code (Part 4 - 7.34): %x", status);
+    }
+    return ok;
+}
+
+void OPCUAClientMethod::UpdateCallStatistics(const uint64 latencyTicks) {
+    numberOfCalls++;
+    lastCallLatency = latencyTicks;
+    if (latencyTicks > maxCallLatency) {
+        maxCallLatency = latencyTicks;
+    }
+    totalCallLatency += latencyTicks;
+}
+
+void OPCUAClientMethod::CallResponse(const UA_UInt32 requestId,
+                                     const UA_CallResponse &callResponse) {
+    uint64 endCounter = HighResolutionTimer::Counter();
+    uint64 startCounter = endCounter;
+    bool found = false;
+    for (uint32 k = 0u; (k < maxCallsInFlight) && (!found); k++) {
+        if ((callSlotUsed[k]) && (callRequestIds[k] == requestId)) {
+            startCounter = callStartCounters[k];
+            callSlotUsed[k] = false;
+            found = true;
+        }
+    }
+    if ((found) && (callsInFlight > 0u)) {
+        callsInFlight--;
+    }
+    UA_StatusCode retval = callResponse.responseHeader.serviceResult;
+    if ((retval == 0x00U) && (callResponse.resultsSize > 0u)) { /* UA_STATUSCODE_GOOD */
+        retval = callResponse.results[0u].statusCode;
+    }
+    if (retval == 0x00U) {
+        UpdateCallStatistics(endCounter - startCounter);
+    }
+    else {
+        numberOfFailedCalls++;
+        asyncCallFailed = true;
+        REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "CallError - OPC UA Status Code (Part 4 - 7.34): %x", retval);
+    }
+}
+
+/*lint -e{715} client is not needed as the OPCUAClientMethod is passed as userdata*/
+void OPCUAClientMethod::CallResponseCallback(UA_Client *client,
+                                             void *userdata,
+                                             UA_UInt32 requestId,
+                                             void *response) {
+    OPCUAClientMethod *clientMethod = static_cast<OPCUAClientMethod*>(userdata);
+    if ((clientMethod != NULL_PTR(OPCUAClientMethod*)) && (response != NULL_PTR(void*))) {
+        clientMethod->CallResponse(requestId, *static_cast<UA_CallResponse*>(response));
+    }
+}
+
+void OPCUAClientMethod::SetMaxCallsInFlight(const uint32 maxCallsInFlightIn) {
+    if ((maxCallsInFlightIn > 0u) && (callsInFlight == 0u)) {
+        maxCallsInFlight = maxCallsInFlightIn;
+        delete[] callRequestIds;
+        delete[] callStartCounters;
+        delete[] callSlotUsed;
+        callRequestIds = new UA_UInt32[maxCallsInFlight];
+        callStartCounters = new uint64[maxCallsInFlight];
+        callSlotUsed = new bool[maxCallsInFlight];
+        for (uint32 k = 0u; k < maxCallsInFlight; k++) {
+            callSlotUsed[k] = false;
+        }
+    }
+}
+
+uint32 OPCUAClientMethod::GetMaxCallsInFlight() const {
+    return maxCallsInFlight;
+}
+
+uint32 OPCUAClientMethod::GetNumberOfCallsInFlight() const {
+    return callsInFlight;
+}
+
+uint64 OPCUAClientMethod::GetNumberOfCalls() const {
+    return numberOfCalls;
+}
+
+uint64 OPCUAClientMethod::GetNumberOfFailedCalls() const {
+    return numberOfFailedCalls;
+}
+
+float64 OPCUAClientMethod::GetLastCallLatency() const {
+    return (static_cast<float64>(lastCallLatency) * HighResolutionTimer::Period());
+}
+
+float64 OPCUAClientMethod::GetMaxCallLatency() const {
+    return (static_cast<float64>(maxCallLatency) * HighResolutionTimer::Period());
+}
+
+float64 OPCUAClientMethod::GetMeanCallLatency() const {
+    float64 mean = 0.0;
+    if (numberOfCalls > 0u) {
+        mean = (static_cast<float64>(totalCallLatency) * HighResolutionTimer::Period()) / static_cast<float64>(numberOfCalls);
+    }
+    return mean;
+}
+
 bool OPCUAClientMethod::SetExtensionObject() {
     bool ok;
     /* Reading Extension Object Information */
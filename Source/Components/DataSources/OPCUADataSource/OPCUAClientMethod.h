@@ -42,6 +42,8 @@ namespace MARTe {
  * via MARTe Message System.
  * @details This class wraps all the functionalities to call methods on a OPCUA Server.
  * The class supports ExtensionObjects only.
+ * The method can either be called synchronously (see MethodCall) or be pipelined on the same session (see MethodCallAsync),
+ * keeping at most GetMaxCallsInFlight calls in flight. The latency (from the request to the response) of the calls is measured.
  */
 class OPCUAClientMethod: public OPCUAClientI {
 public:
@@ -102,6 +104,72 @@ public:
      */
     bool MethodCall();
 
+    /**
+     * @brief Sends a OPCUA Method Call asynchronously.
+     * @details The input argument is encoded when the request is sent, so that the dataPtr can be modified as soon as this method returns.
+     * If GetMaxCallsInFlight calls are already in flight, waits (at most \a timeout ms) for one of them to complete.
+     * @param[in] timeout the maximum time (in ms) to wait for a free slot.
+     * @pre SetServiceRequest && SetObjectRequest && SetMethodRequest && SetExtensionObject
+     * @return true if the call was sent and if no asynchronous call has failed since the last call to MethodCallAsync or WaitForCalls.
+     */
+    bool MethodCallAsync(const uint32 timeout);
+
+    /**
+     * @brief Waits for all the asynchronous calls in flight to complete.
+     * @param[in] timeout the maximum time (in ms) to wait.
+     * @return true if all the calls completed in time and if no asynchronous call has failed since the last call to MethodCallAsync or WaitForCalls.
+     */
+    bool WaitForCalls(const uint32 timeout);
+
+    /**
+     * @brief Sets the maximum number of asynchronous calls in flight.
+     * @param[in] maxCallsInFlightIn the maximum number of calls in flight (> 0).
+     * @pre GetNumberOfCallsInFlight() == 0
+     */
+    void SetMaxCallsInFlight(const uint32 maxCallsInFlightIn);
+
+    /**
+     * @brief Gets the maximum number of asynchronous calls in flight.
+     * @return the maximum number of asynchronous calls in flight.
+     */
+    uint32 GetMaxCallsInFlight() const;
+
+    /**
+     * @brief Gets the number of asynchronous calls in flight.
+     * @return the number of asynchronous calls in flight.
+     */
+    uint32 GetNumberOfCallsInFlight() const;
+
+    /**
+     * @brief Gets the number of calls (synchronous or asynchronous) completed successfully.
+     * @return the number of calls completed successfully.
+     */
+    uint64 GetNumberOfCalls() const;
+
+    /**
+     * @brief Gets the number of calls (synchronous or asynchronous) which failed.
+     * @return the number of calls which failed.
+     */
+    uint64 GetNumberOfFailedCalls() const;
+
+    /**
+     * @brief Gets the latency of the last call completed successfully.
+     * @return the latency in seconds.
+     */
+    float64 GetLastCallLatency() const;
+
+    /**
+     * @brief Gets the maximum latency of the calls completed successfully.
+     * @return the latency in seconds.
+     */
+    float64 GetMaxCallLatency() const;
+
+    /**
+     * @brief Gets the mean latency of the calls completed successfully.
+     * @return the latency in seconds (0 if no call has been completed).
+     */
+    float64 GetMeanCallLatency() const;
+
     /**
      * @brief Retrieve information from the Secure Channel about the ExtensionObject to be sent.
      * @details This method creates a ReadRequest and saves the ExtensionObject.
@@ -121,6 +189,47 @@ public:
 
 private:
 
+    /**
+     * @brief Copies the dataPtr in the ExtensionObjects of the input argument.
+     * @return true if the ExtensionObjects were set up by SetExtensionObject and the copy succeeded.
+     */
+    bool PrepareCall();
+
+    /**
+     * @brief Processes the responses until at most \a maxInFlight calls are in flight.
+     * @param[in] maxInFlight the number of calls which may remain in flight.
+     * @param[in] timeout the maximum time (in ms) to wait.
+     * @return true if at most \a maxInFlight calls are in flight.
+     */
+    bool WaitForCallsInFlight(const uint32 maxInFlight,
+                              const uint32 timeout);
+
+    /**
+     * @brief Updates the statistics with a call completed successfully.
+     * @param[in] latencyTicks the latency of the call in HighResolutionTimer ticks.
+     */
+    void UpdateCallStatistics(const uint64 latencyTicks);
+
+    /**
+     * @brief Called (by CallResponseCallback) when an asynchronous call completes.
+     * @param[in] requestId the identifier of the request.
+     * @param[in] callResponse the response.
+     */
+    void CallResponse(const UA_UInt32 requestId,
+                      const UA_CallResponse &callResponse);
+
+    /**
+     * @brief open62541 callback of the asynchronous calls.
+     * @param[in] client the open62541 client.
+     * @param[in] userdata the OPCUAClientMethod which sent the request.
+     * @param[in] requestId the identifier of the request.
+     * @param[in] response the UA_CallResponse.
+     */
+    static void CallResponseCallback(UA_Client *client,
+                                     void *userdata,
+                                     UA_UInt32 requestId,
+                                     void *response);
+
     /**
      * The array that stores all the open62541 NodeIDs of the monitored nodes.
      */
@@ -161,6 +270,61 @@ private:
      */
     UA_ReadResponse readResponse;
 
+    /**
+     * The maximum number of asynchronous calls in flight.
+     */
+    uint32 maxCallsInFlight;
+
+    /**
+     * The number of asynchronous calls in flight.
+     */
+    uint32 callsInFlight;
+
+    /**
+     * The request identifier of each call in flight (one slot for each of the maxCallsInFlight calls).
+     */
+    UA_UInt32 *callRequestIds;
+
+    /**
+     * The HighResolutionTimer counter when each call in flight was sent.
+     */
+    uint64 *callStartCounters;
+
+    /**
+     * True if the slot holds a call in flight.
+     */
+    bool *callSlotUsed;
+
+    /**
+     * True if an asynchronous call failed since the last call to MethodCallAsync or WaitForCalls.
+     */
+    bool asyncCallFailed;
+
+    /**
+     * The number of calls completed successfully.
+     */
+    uint64 numberOfCalls;
+
+    /**
+     * The number of calls which failed.
+     */
+    uint64 numberOfFailedCalls;
+
+    /**
+     * The latency of the last call (in ticks).
+     */
+    uint64 lastCallLatency;
+
+    /**
+     * The maximum latency of the calls (in ticks).
+     */
+    uint64 maxCallLatency;
+
+    /**
+     * The sum of the latencies of the calls (in ticks).
+     */
+    uint64 totalCallLatency;
+
 };
 
 }
@@ -49,6 +49,13 @@ OPCUAClientRead::OPCUAClientRead() :
         OPCUAClientI() {
     monitoredNodes = NULL_PTR(UA_NodeId*);
     readValues = NULL_PTR(UA_ReadValueId*);
+    asyncTypes = NULL_PTR(const TypeDescriptor*);
+    asyncNElements = NULL_PTR(const uint32*);
+    maxReadsInFlight = 1u;
+    readsInFlight = 0u;
+    lastResponseId = 0u;
+    asyncReadFailed = false;
+    numberOfReadResponses = 0u;
 }
 
 /*lint -e{1579} all pointers have been freed*/
@@ -73,105 +80,12 @@ bool OPCUAClientRead::SetServiceRequest(const uint16 *const namespaceIndexes,
     /* Setting up Read request */
     UA_ReadRequest_init(&readRequest);
 
-    for (uint32 i = 0u; i < nOfNodes; i++) {
-        REPORT_ERROR_STATIC(ErrorManagement::Information, "Registering Node %s", nodePaths[i].Buffer());
-        ok = nodePaths[i].Seek(0LLU);
-
-        StreamString pathTokenized;
-        uint32 pathSize = 0u;
-        char8 ignore;
-        if (ok) {
-            /* This cycle is for getting the path size only */
-            do {
-                ok = nodePaths[i].GetToken(pathTokenized, ".", ignore);
-                if (ok) {
-                    pathSize++;
-                }
-                pathTokenized = "";
-            }
-            while (ok);
-        }
-        StreamString *path = NULL_PTR(StreamString*);
-        uint32 *ids;
-        if (pathSize > 0u) {
-            path = new StreamString[pathSize];
+    ok = ResolveNodeIds(namespaceIndexes, nodePaths, nOfNodes, monitoredNodes);
+    if ((ok) && (readValues != NULL_PTR(UA_ReadValueId*))) {
+        for (uint32 i = 0u; i < nOfNodes; i++) {
+            readValues[i].attributeId = 13u; /* UA_ATTRIBUTEID_VALUE */
+            (void) UA_NodeId_copy(&monitoredNodes[i], &(readValues[i].nodeId));
         }
-        ids = new uint32[pathSize];
-        ok = nodePaths[i].Seek(0LLU);
-
-        if (ok) {
-            if (path != NULL_PTR(StreamString*)) {
-                for (uint32 k = 0u; k < pathSize; k++) {
-                    ok = nodePaths[i].GetToken(pathTokenized, ".", ignore);
-                    if (ok) {
-                        StreamString s = pathTokenized;
-                        path[k] = s;
-                    }
-                    pathTokenized = "";
-                }
-            }
-        }
-
-        if (ok) {
-            /* Building request for Browse Service */
-            UA_BrowseRequest bReq;
-            UA_BrowseRequest_init(&bReq);
-            bReq.requestedMaxReferencesPerNode = 0u;
-            bReq.nodesToBrowse = UA_BrowseDescription_new();
-            //UA_BrowseDescription_init(bReq.nodesToBrowse);
-            bReq.nodesToBrowseSize = 1u;
-
-            /* Building request for TranslateBrowsePathsToNodeIds */
-            UA_BrowsePath browsePath;
-            UA_BrowsePath_init(&browsePath);
-            browsePath.startingNode = UA_NODEID_NUMERIC(0u, 85u); /* UA_NS0ID_OBJECTSFOLDER */
-            browsePath.relativePath.elements = reinterpret_cast<UA_RelativePathElement*>(UA_Array_new(static_cast<osulong>(pathSize),
-                                                                                                      &UA_TYPES[UA_TYPES_RELATIVEPATHELEMENT]));
-            browsePath.relativePath.elementsSize = pathSize;
-
-            uint32 tempNumericNodeId = 85u; /* UA_NS0ID_OBJECTSFOLDER */
-            uint16 tempNamespaceIndex = 0u;
-            char8 *tempStringNodeId = NULL_PTR(char8*);
-            if ((path != NULL_PTR(StreamString*)) && (ids != NULL_PTR(uint32*))) {
-                for (uint32 j = 0u; j < pathSize; j++) {
-                    ids[j] = GetReferences(bReq, const_cast<char8*>(path[j].Buffer()), tempNamespaceIndex, tempNumericNodeId, tempStringNodeId);
-                    UA_RelativePathElement *elem = &(browsePath.relativePath.elements[j]);
-                    elem->referenceTypeId = UA_NODEID_NUMERIC(0u, ids[j]);
-                    /*lint -e{1055} -e{64} -e{746} UA_QUALIFIEDNAME is declared in the open62541 library.*/
-                    elem->targetName = UA_QUALIFIEDNAME_ALLOC(namespaceIndexes[i], const_cast<char8*>(path[j].Buffer()));
-                }
-                if (tempStringNodeId != NULL_PTR(char8*)) {
-                    delete tempStringNodeId;
-                }
-            }
-
-            UA_TranslateBrowsePathsToNodeIdsRequest tbpReq;
-            UA_TranslateBrowsePathsToNodeIdsRequest_init(&tbpReq);
-            tbpReq.browsePaths = &browsePath;
-            tbpReq.browsePathsSize = 1u;
-
-            UA_TranslateBrowsePathsToNodeIdsResponse tbpResp = UA_Client_Service_translateBrowsePathsToNodeIds(opcuaClient, tbpReq);
-            ok = (tbpResp.responseHeader.serviceResult == 0x00U); /* UA_STATUSCODE_GOOD */
-            if (ok) {
-                if (tbpResp.results[0].statusCode == 0x00U) {
-                    UA_BrowsePathTarget ref;
-                    (void) UA_BrowsePathTarget_copy(&(tbpResp.results[0].targets[0]), &ref);
-                    (void) UA_NodeId_copy(&(ref.targetId.nodeId), &monitoredNodes[i]);
-                    if (readValues != NULL_PTR(UA_ReadValueId*)) {
-                        //UA_ReadValueId_init(&readValues[i]);
-                        readValues[i].attributeId = 13u; /* UA_ATTRIBUTEID_VALUE */
-                        (void) UA_NodeId_copy(&(ref.targetId.nodeId), &(readValues[i].nodeId));
-                    }
-                }
-                else {
-                    REPORT_ERROR_STATIC(ErrorManagement::Information, "An Error occurred on TranslateBrowsePathsToNodeIds service call");
-                    ok = false;
-                }
-            }
-            UA_Array_delete(browsePath.relativePath.elements, static_cast<osulong>(pathSize), &UA_TYPES[UA_TYPES_RELATIVEPATHELEMENT]);
-        }
-        delete[] ids;
-        delete[] path;
     }
     if (ok) {
         readRequest.nodesToRead = readValues;
@@ -235,52 +149,33 @@ bool OPCUAClientRead::GetExtensionObjectByteString(const TypeDescriptor *const&e
     return ok;
 }
 
-bool OPCUAClientRead::Read(const TypeDescriptor *const types,
-                           const uint32 *const nElements) {
-    UA_ReadResponse readResponse;
-    readResponse = UA_Client_Service_read(opcuaClient, readRequest);
-    bool ok = (readResponse.responseHeader.serviceResult == 0x00U); /* UA_STATUSCODE_GOOD */
-    if (ok) {
-        if (valueMemories != NULL_PTR(void**)) {
-            if (readResponse.results[0].value.type->typeId.identifier.numeric == 22u) { /* EXTENSION_OBJECT */
+bool OPCUAClientRead::CopyResponse(const UA_ReadResponse &readResponse,
+                                   const TypeDescriptor *const types,
+                                   const uint32 *const nElements) {
+    bool ok = (readResponse.resultsSize > 0u);
+    if ((ok) && (valueMemories != NULL_PTR(void**))) {
+        const UA_Variant &firstValue = readResponse.results[0].value;
+        ok = (firstValue.type != NULL_PTR(const UA_DataType*));
+        if (ok) {
+            if (firstValue.type->typeId.identifier.numeric == 22u) { /* EXTENSION_OBJECT */
                 if (dataPtr != NULL_PTR(void*)) {
-                    UA_ExtensionObject *valuePtr = reinterpret_cast<UA_ExtensionObject*>(readResponse.results[0].value.data);
-                    UA_ExtensionObject *eos;
-                    if (readResponse.results[0].value.arrayLength > 1u) {
-                        eos = new UA_ExtensionObject[readResponse.results[0].value.arrayLength];
-                        for (uint32 j = 0u; j < readResponse.results[0].value.arrayLength; j++) {
-                            if (ok) {
-                                ok = (UA_ExtensionObject_copy(&valuePtr[j], &eos[j]) == 0x00U);
-                            }
-                        }
-                        if (ok) {
-                            for (uint32 i = 0u; i < readResponse.results[0].value.arrayLength; i++) {
-                                if (ok) {
-                                    ok = MemoryOperationsHelper::Copy(dataPtr, eos[i].content.encoded.body.data,
-                                                                      static_cast<uint32>(eos[i].content.encoded.body.length));
-                                    dataPtr = &reinterpret_cast<uint8*>(dataPtr)[eos[i].content.encoded.body.length];
-                                }
-                            }
-                        }
-                        uint32 actualBodyLength = (static_cast<uint32>(readResponse.results[0].value.arrayLength)
-                                * static_cast<uint32>(eos[0u].content.encoded.body.length));
-                        SeekDataPtr(actualBodyLength);
-                        delete[] eos;
+                    const UA_ExtensionObject *eos = reinterpret_cast<const UA_ExtensionObject*>(firstValue.data);
+                    uint32 nOfObjects = static_cast<uint32>(firstValue.arrayLength);
+                    if (nOfObjects < 1u) {
+                        nOfObjects = 1u;
                     }
-                    else {
-                        eos = UA_ExtensionObject_new();
-                        (void) UA_ExtensionObject_copy(valuePtr, eos);
-                        ok = MemoryOperationsHelper::Copy(dataPtr, eos->content.encoded.body.data, static_cast<uint32>(eos->content.encoded.body.length));
-                        if (ok) {
-                            /*lint -e{526} -e{628} -e{1551} -e{1055} no exception thrown, function defined in open62541*/
-                            (void) UA_ExtensionObject_clear(eos);
-                            UA_ExtensionObject_delete(eos);
-                        }
+                    /* Copy the bodies directly from the response (no copy of the ExtensionObjects) */
+                    uint8 *destination = reinterpret_cast<uint8*>(dataPtr);
+                    for (uint32 i = 0u; (i < nOfObjects) && (ok); i++) {
+                        uint32 bodyLength = static_cast<uint32>(eos[i].content.encoded.body.length);
+                        ok = MemoryOperationsHelper::Copy(destination, eos[i].content.encoded.body.data, bodyLength);
+                        destination = &destination[bodyLength];
                     }
                 }
             }
             else {
-                for (uint32 i = 0u; i < nOfNodes; i++) {
+                ok = (readResponse.resultsSize >= nOfNodes);
+                for (uint32 i = 0u; (i < nOfNodes) && (ok); i++) {
                     if (valueMemories[i] != NULL_PTR(void*)) {
                         uint32 nOfBytes = types[i].numberOfBits;
                         nOfBytes /= 8u;
@@ -291,13 +186,110 @@ bool OPCUAClientRead::Read(const TypeDescriptor *const types,
             }
         }
     }
+    return ok;
+}
+
+bool OPCUAClientRead::Read(const TypeDescriptor *const types,
+                           const uint32 *const nElements) {
+    UA_ReadResponse readResponse;
+    readResponse = UA_Client_Service_read(opcuaClient, readRequest);
+    bool ok = (readResponse.responseHeader.serviceResult == 0x00U); /* UA_STATUSCODE_GOOD */
+    if (ok) {
+        ok = CopyResponse(readResponse, types, nElements);
+    }
     if (!ok) {
         REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "ReadError - OPC UA Status Code (Part 4 - 7.34): %x", readResponse.responseHeader.serviceResult);
         (void) UA_Client_run_iterate(opcuaClient, 100u);
     }
+    /*lint -e{526} -e{628} -e{1055} function defined in open62541*/
+    UA_ReadResponse_clear(&readResponse);
     return ok;
 }
 
+bool OPCUAClientRead::ReadAsync(const TypeDescriptor *const types,
+                                const uint32 *const nElements,
+                                const uint16 timeout) {
+    asyncTypes = types;
+    asyncNElements = nElements;
+    bool ok = !asyncReadFailed;
+    asyncReadFailed = false;
+    if (readsInFlight < maxReadsInFlight) {
+        UA_UInt32 requestId = 0u;
+        /*lint -e{929} -e{1055} function and types defined in open62541*/
+        UA_StatusCode status = __UA_Client_AsyncService(opcuaClient, &readRequest, &UA_TYPES[UA_TYPES_READREQUEST], &OPCUAClientRead::ReadResponseCallback,
+                                                        &UA_TYPES[UA_TYPES_READRESPONSE], this, &requestId);
+        if (status == 0x00U) { /* UA_STATUSCODE_GOOD */
+            readsInFlight++;
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "ReadError - Failed to send the asynchronous Read request: %x", status);
+            ok = false;
+        }
+    }
+    /* Process the responses received in the meanwhile */
+    UA_StatusCode status = UA_Client_run_iterate(opcuaClient, timeout);
+    if (status != 0x00U) {
+        REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "ReadError - OPC UA Status Code (Part 4 - 7.34): %x", status);
+        ok = false;
+    }
+    if (asyncReadFailed) {
+        ok = false;
+    }
+    return ok;
+}
+
+void OPCUAClientRead::ReadResponse(const UA_UInt32 requestId,
+                                   const UA_ReadResponse &readResponse) {
+    if (readsInFlight > 0u) {
+        readsInFlight--;
+    }
+    bool ok = (readResponse.responseHeader.serviceResult == 0x00U); /* UA_STATUSCODE_GOOD */
+    if (ok) {
+        /* Discard the responses older than the one already copied (the request identifiers are increasing) */
+        bool isNewer = (static_cast<int32>(requestId - lastResponseId) > 0);
+        if ((isNewer) && (asyncTypes != NULL_PTR(const TypeDescriptor*)) && (asyncNElements != NULL_PTR(const uint32*))) {
+            ok = CopyResponse(readResponse, asyncTypes, asyncNElements);
+            if (ok) {
+                lastResponseId = requestId;
+                numberOfReadResponses++;
+            }
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "ReadError - OPC UA Status Code (Part 4 - 7.34): %x", readResponse.responseHeader.serviceResult);
+        asyncReadFailed = true;
+    }
+}
+
+/*lint -e{715} client is not needed as the OPCUAClientRead is passed as userdata*/
+void OPCUAClientRead::ReadResponseCallback(UA_Client *client,
+                                           void *userdata,
+                                           UA_UInt32 requestId,
+                                           void *response) {
+    OPCUAClientRead *clientRead = static_cast<OPCUAClientRead*>(userdata);
+    if ((clientRead != NULL_PTR(OPCUAClientRead*)) && (response != NULL_PTR(void*))) {
+        clientRead->ReadResponse(requestId, *static_cast<UA_ReadResponse*>(response));
+    }
+}
+
+void OPCUAClientRead::SetMaxReadsInFlight(const uint32 maxReadsInFlightIn) {
+    if (maxReadsInFlightIn > 0u) {
+        maxReadsInFlight = maxReadsInFlightIn;
+    }
+}
+
+uint32 OPCUAClientRead::GetMaxReadsInFlight() const {
+    return maxReadsInFlight;
+}
+
+uint32 OPCUAClientRead::GetNumberOfReadsInFlight() const {
+    return readsInFlight;
+}
+
+uint64 OPCUAClientRead::GetNumberOfReadResponses() const {
+    return numberOfReadResponses;
+}
+
 bool OPCUAClientRead::RegisterNodes(const UA_NodeId *const monitoredNodes) {
     bool ok = false;
     if (monitoredNodes != NULL_PTR(UA_NodeId*)) {
@@ -42,6 +42,8 @@ namespace MARTe {
  * @brief Wrapper of a OPCUA Client for reading data to a OPCUA Server.
  * @details This class wraps all the functionalities to read data to a OPCUA Server.
  * The class supports both single nodes and ExtensionObjects.
+ * All the nodes are read with a single Read request. The request can either be executed synchronously (see Read) or
+ * be kept in flight asynchronously (see ReadAsync), in which case the values of the latest completed response are copied.
  */
 class OPCUAClientRead: public OPCUAClientI {
 public:
@@ -67,6 +69,45 @@ public:
     bool Read(const TypeDescriptor *const types,
               const uint32 *const nElements);
 
+    /**
+     * @brief Calls the OPCUA Read service asynchronously.
+     * @details Sends a new Read request if less than GetMaxReadsInFlight requests are in flight and then processes the responses received
+     * in the meanwhile (waiting at most \a timeout ms). The values of the latest completed response are written to the valueMemory of
+     * each monitoredNode (the values of older responses which complete later are discarded).
+     * @param[in] types the array with all the TypeDescriptor for each node to read.
+     * @param[in] nElements the array with all the number of elements for each node to read.
+     * @param[in] timeout the maximum time (in ms) to wait for the responses.
+     * @pre SetServiceRequest
+     * @return true if the request was sent and no response failed since the previous call.
+     */
+    bool ReadAsync(const TypeDescriptor *const types,
+                   const uint32 *const nElements,
+                   const uint16 timeout);
+
+    /**
+     * @brief Sets the maximum number of Read requests in flight (see ReadAsync).
+     * @param[in] maxReadsInFlightIn the maximum number of Read requests in flight (> 0).
+     */
+    void SetMaxReadsInFlight(const uint32 maxReadsInFlightIn);
+
+    /**
+     * @brief Gets the maximum number of Read requests in flight.
+     * @return the maximum number of Read requests in flight.
+     */
+    uint32 GetMaxReadsInFlight() const;
+
+    /**
+     * @brief Gets the number of Read requests in flight.
+     * @return the number of Read requests in flight.
+     */
+    uint32 GetNumberOfReadsInFlight() const;
+
+    /**
+     * @brief Gets the number of asynchronous Read responses whose values were copied.
+     * @return the number of asynchronous Read responses whose values were copied.
+     */
+    uint64 GetNumberOfReadResponses() const;
+
     /**
      * @see OPCUAClientI::SetServiceRequest
      */
@@ -105,6 +146,38 @@ private:
      */
     bool UnregisterNodes(const UA_NodeId *const monitoredNodes);
 
+    /**
+     * @brief Copies the values of a Read response into the valueMemory of each monitoredNode (or into the ExtensionObject ByteString).
+     * @details The ExtensionObject bodies are copied directly from the response, using the member layout computed once in GetExtensionObjectByteString.
+     * @param[in] readResponse the Read response.
+     * @param[in] types the array with all the TypeDescriptor for each node to read.
+     * @param[in] nElements the array with all the number of elements for each node to read.
+     * @return true if the values were successfully copied.
+     */
+    bool CopyResponse(const UA_ReadResponse &readResponse,
+                      const TypeDescriptor *const types,
+                      const uint32 *const nElements);
+
+    /**
+     * @brief Called (by ReadResponseCallback) when an asynchronous Read request completes.
+     * @param[in] requestId the identifier of the request.
+     * @param[in] readResponse the Read response.
+     */
+    void ReadResponse(const UA_UInt32 requestId,
+                      const UA_ReadResponse &readResponse);
+
+    /**
+     * @brief open62541 callback of the asynchronous Read requests. Calls ReadResponse on the OPCUAClientRead passed as \a userdata.
+     * @param[in] client the open62541 client.
+     * @param[in] userdata the OPCUAClientRead.
+     * @param[in] requestId the identifier of the request.
+     * @param[in] response the UA_ReadResponse.
+     */
+    static void ReadResponseCallback(UA_Client *client,
+                                     void *userdata,
+                                     UA_UInt32 requestId,
+                                     void *response);
+
     /**
      * The array that stores all the open62541 NodeIDs of the monitored nodes.
      */
@@ -120,6 +193,41 @@ private:
      */
     UA_ReadValueId *readValues;
 
+    /**
+     * The types of the asynchronous Read.
+     */
+    const TypeDescriptor *asyncTypes;
+
+    /**
+     * The number of elements of the asynchronous Read.
+     */
+    const uint32 *asyncNElements;
+
+    /**
+     * The maximum number of Read requests in flight.
+     */
+    uint32 maxReadsInFlight;
+
+    /**
+     * The number of Read requests in flight.
+     */
+    uint32 readsInFlight;
+
+    /**
+     * The identifier of the latest request whose response was copied.
+     */
+    UA_UInt32 lastResponseId;
+
+    /**
+     * True if an asynchronous response failed since the last ReadAsync.
+     */
+    bool asyncReadFailed;
+
+    /**
+     * The number of asynchronous Read responses whose values were copied.
+     */
+    uint64 numberOfReadResponses;
+
 };
 
 }
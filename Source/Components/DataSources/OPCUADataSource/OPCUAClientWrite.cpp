@@ -54,6 +54,18 @@ OPCUAClientWrite::OPCUAClientWrite() :
     eos = NULL_PTR(UA_ExtensionObject*);
     valuePtr = NULL_PTR(UA_ExtensionObject*);
     nOfEos = 0u;
+    nodeSizes = NULL_PTR(uint32*);
+    lastValues = NULL_PTR(void**);
+    lastBody = NULL_PTR(void*);
+    changedWriteValues = NULL_PTR(UA_WriteValue*);
+    changedNodes = NULL_PTR(uint32*);
+    writeOnChange = true;
+    resendAll = true;
+    asyncWriteFailed = false;
+    maxWritesInFlight = 1u;
+    writesInFlight = 0u;
+    numberOfWrites = 0u;
+    numberOfSkippedWrites = 0u;
 }
 
 /*lint -e{1579} all pointers have been freed*/
@@ -78,6 +90,29 @@ OPCUAClientWrite::~OPCUAClientWrite() {
             (void) UA_ExtensionObject_clear(eos);
         }
     }
+    if (lastValues != NULL_PTR(void**)) {
+        for (uint32 i = 0u; i < nOfNodes; i++) {
+            if (lastValues[i] != NULL_PTR(void*)) {
+                /*lint -e{1551} no exception on free*/
+                (void) HeapManager::Free(lastValues[i]);
+            }
+        }
+        delete[] lastValues;
+    }
+    if (lastBody != NULL_PTR(void*)) {
+        /*lint -e{1551} no exception on free*/
+        (void) HeapManager::Free(lastBody);
+    }
+    /* The changedWriteValues are shallow copies of the writeValues and shall not be cleared */
+    if (changedWriteValues != NULL_PTR(UA_WriteValue*)) {
+        delete[] changedWriteValues;
+    }
+    if (changedNodes != NULL_PTR(uint32*)) {
+        delete[] changedNodes;
+    }
+    if (nodeSizes != NULL_PTR(uint32*)) {
+        delete[] nodeSizes;
+    }
 }
 
 bool OPCUAClientWrite::SetServiceRequest(const uint16 *const namespaceIndexes,
@@ -91,108 +126,24 @@ bool OPCUAClientWrite::SetServiceRequest(const uint16 *const namespaceIndexes,
     tempVariant = reinterpret_cast<UA_Variant*>(UA_Array_new(static_cast<osulong>(nOfNodes), &UA_TYPES[UA_TYPES_VARIANT]));
     /* Setting up write request */
     UA_WriteRequest_init(&writeRequest);
+    nodeSizes = new uint32[nOfNodes];
+    lastValues = new void*[nOfNodes];
+    changedWriteValues = new UA_WriteValue[nOfNodes];
+    changedNodes = new uint32[nOfNodes];
+    for (uint32 n = 0u; n < nOfNodes; n++) {
+        nodeSizes[n] = 0u;
+        lastValues[n] = NULL_PTR(void*);
+        changedNodes[n] = 0u;
+    }
 
-    for (uint32 i = 0u; i < nOfNodes; i++) {
-        REPORT_ERROR_STATIC(ErrorManagement::Information, "Registering Node %s", nodePaths[i].Buffer());
-        ok = nodePaths[i].Seek(0LLU);
-
-        StreamString pathTokenized;
-        uint32 pathSize = 0u;
-        char8 ignore;
-        if (ok) {
-            /* This cycle is for getting the path size only */
-            do {
-                ok = nodePaths[i].GetToken(pathTokenized, ".", ignore);
-                if (ok) {
-                    pathSize++;
-                }
-                pathTokenized = "";
-            }
-            while (ok);
-        }
-        StreamString *path = NULL_PTR(StreamString*);
-        uint32 *ids;
-        if (pathSize > 0u) {
-            path = new StreamString[pathSize];
-        }
-        ids = new uint32[pathSize];
-        ok = nodePaths[i].Seek(0LLU);
-
-        if (ok) {
-            if (path != NULL_PTR(StreamString*)) {
-                for (uint32 k = 0u; k < pathSize; k++) {
-                    ok = nodePaths[i].GetToken(pathTokenized, ".", ignore);
-                    if (ok) {
-                        StreamString s = pathTokenized;
-                        path[k] = s;
-                    }
-                    pathTokenized = "";
-                }
-            }
+    ok = ResolveNodeIds(namespaceIndexes, nodePaths, nOfNodes, monitoredNodes);
+    if ((ok) && (writeValues != NULL_PTR(UA_WriteValue*))) {
+        for (uint32 i = 0u; i < nOfNodes; i++) {
+            writeValues[i].attributeId = 13u; /* UA_ATTRIBUTEID_VALUE */
+            (void) UA_NodeId_copy(&monitoredNodes[i], &(writeValues[i].nodeId));
+            /*lint -e{1013} -e{63} -e{40} hasValue is a member of struct UA_DataValue.*/
+            writeValues[i].value.hasValue = true;
         }
-
-        if (ok) {
-            /* Building request for Browse Service */
-            UA_BrowseRequest bReq;
-            UA_BrowseRequest_init(&bReq);
-            bReq.requestedMaxReferencesPerNode = 0u;
-            bReq.nodesToBrowse = UA_BrowseDescription_new();
-            //UA_BrowseDescription_init(bReq.nodesToBrowse);
-            bReq.nodesToBrowseSize = 1u;
-
-            /* Building request for TranslateBrowsePathsToNodeIds */
-            UA_BrowsePath browsePath;
-            UA_BrowsePath_init(&browsePath);
-            browsePath.startingNode = UA_NODEID_NUMERIC(0u, 85u); /* UA_NS0ID_OBJECTSFOLDER */
-            browsePath.relativePath.elements = reinterpret_cast<UA_RelativePathElement*>(UA_Array_new(static_cast<osulong>(pathSize),
-                                                                                                      &UA_TYPES[UA_TYPES_RELATIVEPATHELEMENT]));
-            browsePath.relativePath.elementsSize = pathSize;
-
-            uint32 tempNumericNodeId = 85u; /* UA_NS0ID_OBJECTSFOLDER */
-            uint16 tempNamespaceIndex = 0u;
-            char8 *tempStringNodeId = NULL_PTR(char8*);
-            if ((path != NULL_PTR(StreamString*)) && (ids != NULL_PTR(uint32*))) {
-                for (uint32 j = 0u; j < pathSize; j++) {
-                    ids[j] = GetReferences(bReq, const_cast<char8*>(path[j].Buffer()), tempNamespaceIndex, tempNumericNodeId, tempStringNodeId);
-                    UA_RelativePathElement *elem = &(browsePath.relativePath.elements[j]);
-                    elem->referenceTypeId = UA_NODEID_NUMERIC(0u, ids[j]);
-                    /*lint -e{1055} -e{64} -e{746} UA_QUALIFIEDNAME is declared in the open62541 library.*/
-                    elem->targetName = UA_QUALIFIEDNAME_ALLOC(namespaceIndexes[i], const_cast<char8*>(path[j].Buffer()));
-                }
-                if (tempStringNodeId != NULL_PTR(char8*)) {
-                    delete tempStringNodeId;
-                }
-            }
-
-            UA_TranslateBrowsePathsToNodeIdsRequest tbpReq;
-            UA_TranslateBrowsePathsToNodeIdsRequest_init(&tbpReq);
-            tbpReq.browsePaths = &browsePath;
-            tbpReq.browsePathsSize = 1u;
-
-            UA_TranslateBrowsePathsToNodeIdsResponse tbpResp = UA_Client_Service_translateBrowsePathsToNodeIds(opcuaClient, tbpReq);
-            ok = (tbpResp.responseHeader.serviceResult == 0x00U); /* UA_STATUSCODE_GOOD */
-            if (ok) {
-                if (tbpResp.results[0].statusCode == 0x00U) {
-                    UA_BrowsePathTarget ref;
-                    (void) UA_BrowsePathTarget_copy(&(tbpResp.results[0].targets[0]), &ref);
-                    (void) UA_NodeId_copy(&(ref.targetId.nodeId), &monitoredNodes[i]);
-                    if (writeValues != NULL_PTR(UA_WriteValue*)) {
-                        //UA_WriteValue_init(&writeValues[i]);
-                        writeValues[i].attributeId = 13u; /* UA_ATTRIBUTEID_VALUE */
-                        (void) UA_NodeId_copy(&monitoredNodes[i], &(writeValues[i].nodeId));
-                        /*lint -e{1013} -e{63} -e{40} hasValue is a member of struct UA_DataValue.*/
-                        writeValues[i].value.hasValue = true;
-                    }
-                }
-                else {
-                    REPORT_ERROR_STATIC(ErrorManagement::Information, "An Error occurred on TranslateBrowsePathsToNodeIds service call");
-                    ok = false;
-                }
-            }
-            UA_Array_delete(browsePath.relativePath.elements, static_cast<osulong>(pathSize), &UA_TYPES[UA_TYPES_RELATIVEPATHELEMENT]);
-        }
-        delete[] ids;
-        delete[] path;
     }
     if (ok) {
         ok = RegisterNodes(monitoredNodes);
@@ -443,17 +394,70 @@ void OPCUAClientWrite::SetWriteRequest(const uint32 idx,
     if (writeValues != NULL_PTR(UA_WriteValue*)) {
         writeValues[idx].value.value.storageType = UA_VARIANT_DATA_NODELETE;
     }
+    /* Memory to detect the changes of the node value */
+    if ((nodeSizes != NULL_PTR(uint32*)) && (lastValues != NULL_PTR(void**))) {
+        uint32 nOfBytes = type.numberOfBits;
+        nOfBytes /= 8u;
+        nodeSizes[idx] = (nOfBytes * nElements);
+        if ((lastValues[idx] == NULL_PTR(void*)) && (nodeSizes[idx] > 0u)) {
+            lastValues[idx] = HeapManager::Malloc(nodeSizes[idx]);
+        }
+    }
 
 }
 
-bool OPCUAClientWrite::Write() {
+bool OPCUAClientWrite::PrepareWriteRequest(uint32 &nOfChangedNodes) {
     bool ok = true;
+    nOfChangedNodes = 0u;
     if (dataPtr != NULL_PTR(void*)) {
+        if ((eos != NULL_PTR(UA_ExtensionObject*)) && (valuePtr != NULL_PTR(UA_ExtensionObject*)) && (tempVariant != NULL_PTR(UA_Variant*))) {
+            uint32 bodyLength = (nOfEos * static_cast<uint32>(valuePtr[0u].content.encoded.body.length));
+            bool changed = ((resendAll) || (!writeOnChange) || (lastBody == NULL_PTR(void*)));
+            if (!changed) {
+                changed = (MemoryOperationsHelper::Compare(lastBody, dataPtr, bodyLength) != 0);
+            }
+            if (changed) {
+                nOfChangedNodes = 1u;
+            }
+        }
+    }
+    else {
+        if ((valueMemories != NULL_PTR(void**)) && (lastValues != NULL_PTR(void**)) && (nodeSizes != NULL_PTR(uint32*))
+                && (writeValues != NULL_PTR(UA_WriteValue*)) && (changedWriteValues != NULL_PTR(UA_WriteValue*)) && (changedNodes != NULL_PTR(uint32*))) {
+            for (uint32 i = 0u; i < nOfNodes; i++) {
+                bool changed = ((resendAll) || (!writeOnChange) || (lastValues[i] == NULL_PTR(void*)) || (valueMemories[i] == NULL_PTR(void*)));
+                if (!changed) {
+                    changed = (MemoryOperationsHelper::Compare(lastValues[i], valueMemories[i], nodeSizes[i]) != 0);
+                }
+                if (changed) {
+                    /* Shallow copy: the value still points at valueMemories[i] */
+                    changedWriteValues[nOfChangedNodes] = writeValues[i];
+                    changedNodes[nOfChangedNodes] = i;
+                    nOfChangedNodes++;
+                }
+            }
+            if (nOfChangedNodes == nOfNodes) {
+                writeRequest.nodesToWrite = writeValues;
+            }
+            else {
+                writeRequest.nodesToWrite = changedWriteValues;
+            }
+            writeRequest.nodesToWriteSize = nOfChangedNodes;
+        }
+        else {
+            nOfChangedNodes = nOfNodes;
+            writeRequest.nodesToWrite = writeValues;
+            writeRequest.nodesToWriteSize = nOfNodes;
+        }
+    }
+    if ((dataPtr != NULL_PTR(void*)) && (nOfChangedNodes > 0u)) {
         if ((eos != NULL_PTR(UA_ExtensionObject*)) && (valuePtr != NULL_PTR(UA_ExtensionObject*)) && (tempVariant != NULL_PTR(UA_Variant*))) {
             uint32 actualBodyLength;
             if (nOfEos > 1u) {
                 for (uint32 j = 0u; j < nOfEos; j++) {
                     if (ok) {
+                        /*lint -e{526} -e{628} -e{1055} function defined in open62541*/
+                        UA_ExtensionObject_clear(&eos[j]);
                         (void) UA_ExtensionObject_copy(&valuePtr[j], &eos[j]);
                         ok = MemoryOperationsHelper::Copy(eos[j].content.encoded.body.data, dataPtr, static_cast<uint32>(eos[j].content.encoded.body.length));
                         dataPtr = &reinterpret_cast<uint8*>(dataPtr)[eos[j].content.encoded.body.length];
@@ -463,6 +467,8 @@ bool OPCUAClientWrite::Write() {
                 SeekDataPtr(actualBodyLength);
             }
             else {
+                /*lint -e{526} -e{628} -e{1055} function defined in open62541*/
+                UA_ExtensionObject_clear(eos);
                 (void) UA_ExtensionObject_copy(valuePtr, eos);
                 ok = MemoryOperationsHelper::Copy(eos->content.encoded.body.data, dataPtr, static_cast<uint32>(eos->content.encoded.body.length));
             }
@@ -471,24 +477,157 @@ bool OPCUAClientWrite::Write() {
                 /*lint -e{1013} -e{63} -e{40} hasValue is a member of struct UA_DataValue.*/
                 writeValues[0u].value.hasValue = true;
             }
+            writeRequest.nodesToWrite = writeValues;
             writeRequest.nodesToWriteSize = 1u;
         }
     }
+    return ok;
+}
+
+void OPCUAClientWrite::UpdateLastValues(const uint32 nOfChangedNodes) {
+    if (dataPtr != NULL_PTR(void*)) {
+        if ((nOfChangedNodes > 0u) && (valuePtr != NULL_PTR(UA_ExtensionObject*))) {
+            uint32 bodyLength = (nOfEos * static_cast<uint32>(valuePtr[0u].content.encoded.body.length));
+            if (lastBody == NULL_PTR(void*)) {
+                lastBody = HeapManager::Malloc(bodyLength);
+            }
+            if (lastBody != NULL_PTR(void*)) {
+                (void) MemoryOperationsHelper::Copy(lastBody, dataPtr, bodyLength);
+            }
+        }
+    }
     else {
-        writeRequest.nodesToWriteSize = nOfNodes;
+        if ((valueMemories != NULL_PTR(void**)) && (lastValues != NULL_PTR(void**)) && (nodeSizes != NULL_PTR(uint32*))
+                && (changedNodes != NULL_PTR(uint32*))) {
+            for (uint32 k = 0u; k < nOfChangedNodes; k++) {
+                uint32 i = changedNodes[k];
+                if ((lastValues[i] != NULL_PTR(void*)) && (valueMemories[i] != NULL_PTR(void*))) {
+                    (void) MemoryOperationsHelper::Copy(lastValues[i], valueMemories[i], nodeSizes[i]);
+                }
+            }
+        }
     }
-    writeRequest.nodesToWrite = writeValues;
+    resendAll = false;
+}
+
+bool OPCUAClientWrite::Write() {
+    uint32 nOfChangedNodes = 0u;
+    bool ok = PrepareWriteRequest(nOfChangedNodes);
     if (ok) {
-        UA_WriteResponse wResp = UA_Client_Service_write(opcuaClient, writeRequest);
-        ok = (wResp.responseHeader.serviceResult == 0x00U); /* UA_STATUSCODE_GOOD */
-        if (!ok) {
-            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "WriteError - OPC UA Status Code (Part 4 - 7.34): %x", wResp.responseHeader.serviceResult);
-            (void) UA_Client_run_iterate(opcuaClient, 100u);
+        if (nOfChangedNodes > 0u) {
+            UA_WriteResponse wResp = UA_Client_Service_write(opcuaClient, writeRequest);
+            ok = (wResp.responseHeader.serviceResult == 0x00U); /* UA_STATUSCODE_GOOD */
+            if (ok) {
+                numberOfWrites++;
+                UpdateLastValues(nOfChangedNodes);
+            }
+            else {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "WriteError - OPC UA Status Code (Part 4 - 7.34): %x", wResp.responseHeader.serviceResult);
+                resendAll = true;
+                (void) UA_Client_run_iterate(opcuaClient, 100u);
+            }
+            /*lint -e{526} -e{628} -e{1055} function defined in open62541*/
+            UA_WriteResponse_clear(&wResp);
+        }
+        else {
+            numberOfSkippedWrites++;
         }
     }
     return ok;
 }
 
+bool OPCUAClientWrite::WriteAsync(const uint16 timeout) {
+    bool ok = !asyncWriteFailed;
+    asyncWriteFailed = false;
+    if (writesInFlight < maxWritesInFlight) {
+        uint32 nOfChangedNodes = 0u;
+        if (!PrepareWriteRequest(nOfChangedNodes)) {
+            ok = false;
+        }
+        else if (nOfChangedNodes > 0u) {
+            UA_UInt32 requestId = 0u;
+            /*lint -e{929} -e{1055} function and types defined in open62541*/
+            UA_StatusCode status = __UA_Client_AsyncService(opcuaClient, &writeRequest, &UA_TYPES[UA_TYPES_WRITEREQUEST], &OPCUAClientWrite::WriteResponseCallback,
+                                                            &UA_TYPES[UA_TYPES_WRITERESPONSE], this, &requestId);
+            if (status == 0x00U) { /* UA_STATUSCODE_GOOD */
+                /* The request is encoded when sent: the values can be modified from now on */
+                writesInFlight++;
+                numberOfWrites++;
+                UpdateLastValues(nOfChangedNodes);
+            }
+            else {
+                REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "WriteError - Failed to send the asynchronous Write request: %x", status);
+                ok = false;
+            }
+        }
+        else {
+            numberOfSkippedWrites++;
+        }
+    }
+    else {
+        /* Coalesced: the last values were not updated, so that the changes are detected by the next call */
+        numberOfSkippedWrites++;
+    }
+    /* Process the responses received in the meanwhile */
+    UA_StatusCode status = UA_Client_run_iterate(opcuaClient, timeout);
+    if (status != 0x00U) {
+        REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "WriteError - OPC UA Status Code (Part 4 - 7.34): %x", status);
+        ok = false;
+    }
+    if (asyncWriteFailed) {
+        ok = false;
+    }
+    return ok;
+}
+
+void OPCUAClientWrite::WriteResponse(const UA_WriteResponse &writeResponse) {
+    if (writesInFlight > 0u) {
+        writesInFlight--;
+    }
+    if (writeResponse.responseHeader.serviceResult != 0x00U) { /* UA_STATUSCODE_GOOD */
+        REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "WriteError - OPC UA Status Code (Part 4 - 7.34): %x", writeResponse.responseHeader.serviceResult);
+        asyncWriteFailed = true;
+        resendAll = true;
+    }
+}
+
+/*lint -e{715} client and requestId are not needed as the OPCUAClientWrite is passed as userdata*/
+void OPCUAClientWrite::WriteResponseCallback(UA_Client *client,
+                                             void *userdata,
+                                             UA_UInt32 requestId,
+                                             void *response) {
+    OPCUAClientWrite *clientWrite = static_cast<OPCUAClientWrite*>(userdata);
+    if ((clientWrite != NULL_PTR(OPCUAClientWrite*)) && (response != NULL_PTR(void*))) {
+        clientWrite->WriteResponse(*static_cast<UA_WriteResponse*>(response));
+    }
+}
+
+void OPCUAClientWrite::SetWriteOnChange(const bool writeOnChangeIn) {
+    writeOnChange = writeOnChangeIn;
+}
+
+void OPCUAClientWrite::SetMaxWritesInFlight(const uint32 maxWritesInFlightIn) {
+    if (maxWritesInFlightIn > 0u) {
+        maxWritesInFlight = maxWritesInFlightIn;
+    }
+}
+
+uint32 OPCUAClientWrite::GetMaxWritesInFlight() const {
+    return maxWritesInFlight;
+}
+
+uint32 OPCUAClientWrite::GetNumberOfWritesInFlight() const {
+    return writesInFlight;
+}
+
+uint64 OPCUAClientWrite::GetNumberOfWrites() const {
+    return numberOfWrites;
+}
+
+uint64 OPCUAClientWrite::GetNumberOfSkippedWrites() const {
+    return numberOfSkippedWrites;
+}
+
 bool OPCUAClientWrite::RegisterNodes(const UA_NodeId *const monitoredNodes) {
     bool ok = false;
     if (monitoredNodes != NULL_PTR(UA_NodeId*)) {
@@ -43,6 +43,9 @@ namespace MARTe {
  * @brief Wrapper of a OPCUA Client for writing data to a OPCUA Server.
  * @details This class wraps all the functionalities to write data to a OPCUA Server.
  * The class supports both single nodes and ExtensionObjects.
+ * Only the nodes whose value changed since the last write are sent (see SetWriteOnChange), all with a single Write request.
+ * The request can either be executed synchronously (see Write) or be sent asynchronously (see WriteAsync), in which case
+ * a change is coalesced with the following ones while GetMaxWritesInFlight requests are still in flight.
  */
 class OPCUAClientWrite: public OPCUAClientI {
 public:
@@ -98,11 +101,59 @@ public:
     /**
      * @brief Calls the OPCUA Write service.
      * @details Gets the data from valueMemory and calls the OPCUA Write Value Attribute service
-     * on the monitored nodes.
+     * on the monitored nodes (only on the ones which have changed if SetWriteOnChange(true)).
+     * If no node has changed the service is not called.
      * @pre SetServiceRequest, SetWriteRequest
      */
     bool Write();
 
+    /**
+     * @brief Calls the OPCUA Write service asynchronously.
+     * @details If less than GetMaxWritesInFlight requests are in flight, sends a Write request with the nodes which have changed
+     * (see Write). Otherwise the changes are coalesced and sent with the next request. The responses received in the meanwhile are then
+     * processed (waiting at most \a timeout ms). After a failed request all the nodes are written again.
+     * @param[in] timeout the maximum time (in ms) to wait for the responses.
+     * @pre SetServiceRequest, SetWriteRequest
+     * @return true if the request was sent and if no asynchronous Write request has failed since the last call.
+     */
+    bool WriteAsync(const uint16 timeout);
+
+    /**
+     * @brief Sets if only the nodes whose value changed are written.
+     * @param[in] writeOnChangeIn if true (default) only the nodes whose value changed are written, otherwise all the nodes are always written.
+     */
+    void SetWriteOnChange(const bool writeOnChangeIn);
+
+    /**
+     * @brief Sets the maximum number of Write requests in flight (see WriteAsync).
+     * @param[in] maxWritesInFlightIn the maximum number of Write requests in flight (> 0).
+     */
+    void SetMaxWritesInFlight(const uint32 maxWritesInFlightIn);
+
+    /**
+     * @brief Gets the maximum number of Write requests in flight.
+     * @return the maximum number of Write requests in flight.
+     */
+    uint32 GetMaxWritesInFlight() const;
+
+    /**
+     * @brief Gets the number of Write requests in flight.
+     * @return the number of Write requests in flight.
+     */
+    uint32 GetNumberOfWritesInFlight() const;
+
+    /**
+     * @brief Gets the number of Write requests sent.
+     * @return the number of Write requests sent.
+     */
+    uint64 GetNumberOfWrites() const;
+
+    /**
+     * @brief Gets the number of Write requests not sent, either because no node changed or because they were coalesced.
+     * @return the number of Write requests not sent.
+     */
+    uint64 GetNumberOfSkippedWrites() const;
+
     /**
      * @brief Gets the monitored Nodes pointer. (Testing purposes)
      */
@@ -129,6 +180,37 @@ private:
      */
     bool UnregisterNodes(const UA_NodeId *const monitoredNodes);
 
+    /**
+     * @brief Sets the write request with the nodes whose value changed since the last write.
+     * @param[out] nOfChangedNodes the number of nodes to write (zero if no node changed).
+     * @return true if the ExtensionObject could be copied.
+     */
+    bool PrepareWriteRequest(uint32 &nOfChangedNodes);
+
+    /**
+     * @brief Stores the values sent with the write request, so that the next change can be detected.
+     * @param[in] nOfChangedNodes the number of nodes sent (as returned by PrepareWriteRequest).
+     */
+    void UpdateLastValues(const uint32 nOfChangedNodes);
+
+    /**
+     * @brief Called (by WriteResponseCallback) when an asynchronous Write request completes.
+     * @param[in] writeResponse the response.
+     */
+    void WriteResponse(const UA_WriteResponse &writeResponse);
+
+    /**
+     * @brief open62541 callback of the asynchronous Write requests.
+     * @param[in] client the open62541 client.
+     * @param[in] userdata the OPCUAClientWrite which sent the request.
+     * @param[in] requestId the identifier of the request.
+     * @param[in] response the UA_WriteResponse.
+     */
+    static void WriteResponseCallback(UA_Client *client,
+                                      void *userdata,
+                                      UA_UInt32 requestId,
+                                      void *response);
+
     /**
      * The array that stores all the open62541 NodeIDs of the monitored nodes.
      */
@@ -169,6 +251,66 @@ private:
      */
     UA_ReadResponse readResponse;
 
+    /**
+     * The number of bytes of the value of each node.
+     */
+    uint32 *nodeSizes;
+
+    /**
+     * The last value written to each node.
+     */
+    void **lastValues;
+
+    /**
+     * The last ExtensionObject body written.
+     */
+    void *lastBody;
+
+    /**
+     * Shallow copies of the writeValues of the nodes to write.
+     */
+    UA_WriteValue *changedWriteValues;
+
+    /**
+     * The indexes of the nodes to write.
+     */
+    uint32 *changedNodes;
+
+    /**
+     * True if only the nodes whose value changed are written.
+     */
+    bool writeOnChange;
+
+    /**
+     * True if all the nodes shall be written with the next request (first write and after a failure).
+     */
+    bool resendAll;
+
+    /**
+     * True if an asynchronous Write request failed since the last call to WriteAsync.
+     */
+    bool asyncWriteFailed;
+
+    /**
+     * The maximum number of Write requests in flight.
+     */
+    uint32 maxWritesInFlight;
+
+    /**
+     * The number of Write requests in flight.
+     */
+    uint32 writesInFlight;
+
+    /**
+     * The number of Write requests sent.
+     */
+    uint64 numberOfWrites;
+
+    /**
+     * The number of Write requests not sent.
+     */
+    uint64 numberOfSkippedWrites;
+
 };
 
 }
@@ -61,6 +61,9 @@ OPCUADSInput::OPCUADSInput() :
     readMode = "";
     sync = "";
     samplingTime = 0.0;
+    maxReadsInFlight = 2u;
+    nodeIdCacheFile = "";
+    translateBatchSize = 500u;
     nElements = NULL_PTR(uint32*);
     tempNElements = NULL_PTR(uint32*);
     entryArrayElements = NULL_PTR(uint32*);
@@ -70,10 +73,12 @@ OPCUADSInput::OPCUADSInput() :
     entryTypes = NULL_PTR(TypeDescriptor*);
     cpuMask = 0xffu;
     stackSize = THREADS_DEFAULT_STACKSIZE;
+    extensionObjectBodyLength = 0u;
 }
 
 /*lint -e{1551} must stop the SingleThreadService in the destructor.*/
 OPCUADSInput::~OPCUADSInput() {
+    (void) startup.Wait();
     (void) executor.Stop();
     if (masterClient != NULL_PTR(OPCUAClientRead*)) {
         delete masterClient;
@@ -132,6 +137,27 @@ bool OPCUADSInput::Initialise(StructuredDataI &data) {
                 ok = true;
             }
         }
+        if ((readMode == "AsyncRead") && (ok)) {
+            if (!data.Read("MaxReadsInFlight", maxReadsInFlight)) {
+                REPORT_ERROR(ErrorManagement::Information, "MaxReadsInFlight not set. Using default: %d", maxReadsInFlight);
+            }
+            ok = (maxReadsInFlight > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "MaxReadsInFlight shall be > 0");
+            }
+        }
+        if (ok) {
+            if (!data.Read("NodeIdCacheFile", nodeIdCacheFile)) {
+                nodeIdCacheFile = "";
+            }
+            if (!data.Read("TranslateBatchSize", translateBatchSize)) {
+                REPORT_ERROR(ErrorManagement::Information, "TranslateBatchSize not set. Using default: %d", translateBatchSize);
+            }
+            ok = (translateBatchSize > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "TranslateBatchSize shall be > 0");
+            }
+        }
         if (ok) {
             ok = data.Read("Synchronise", sync);
             if (!ok) {
@@ -385,9 +411,25 @@ bool OPCUADSInput::SetConfiguredDatabase(StructuredDataI &data) {
         }
     }
     if (ok) {
+        extensionObjectBodyLength = bodyLength;
         /* Setting up the master Client who will perform the operations */
         masterClient = new OPCUAClientRead;
         masterClient->SetServerAddress(serverAddress);
+        masterClient->SetMaxReadsInFlight(maxReadsInFlight);
+        masterClient->SetNodeIdCacheFile(nodeIdCacheFile);
+        masterClient->SetTranslateBatchSize(translateBatchSize);
+        /* The connection and the browse of the Address Space are performed by the startup thread, in parallel with the other DataSources */
+        ok = startup.Start(*this, GetName());
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Error during configuration.");
+    }
+    return ok;
+}
+
+bool OPCUADSInput::ExecuteStartup() {
+    bool ok = (masterClient != NULL_PTR(OPCUAClientRead*));
+    if (ok) {
         ok = masterClient->Connect();
         if (!ok) {
             REPORT_ERROR(ErrorManagement::ParametersError, "Cannot Connect to the Server.");
@@ -407,7 +449,7 @@ bool OPCUADSInput::SetConfiguredDatabase(StructuredDataI &data) {
                 else {
                     ok = masterClient->SetServiceRequest(tempNamespaceIndexes, tempPaths, nOfSignals);
                     if (ok) {
-                        masterClient->SetDataPtr(bodyLength);
+                        masterClient->SetDataPtr(extensionObjectBodyLength);
                         masterClient->SetValueMemories(numberOfNodes);
                         for (uint32 k = 0u; k < nOfSignals; k++) {
                             uint32 nodeCounter = 0u;
@@ -430,6 +472,11 @@ bool OPCUADSInput::SetConfiguredDatabase(StructuredDataI &data) {
             }
         }
     }
+    return ok;
+}
+
+bool OPCUADSInput::AllocateMemory() {
+    bool ok = startup.Wait();
     if ((sync == "no") && ok) {
         executor.SetCPUMask(cpuMask);
         executor.SetStackSize(stackSize);
@@ -437,14 +484,10 @@ bool OPCUADSInput::SetConfiguredDatabase(StructuredDataI &data) {
         ok = (executor.Start() == ErrorManagement::NoError);
     }
     if (!ok) {
-        REPORT_ERROR(ErrorManagement::ParametersError, "Error during configuration.");
+        REPORT_ERROR(ErrorManagement::ParametersError, "Error during the startup.");
     }
     return ok;
 }
-
-bool OPCUADSInput::AllocateMemory() {
-    return true;
-}
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: The signalAddress is independent of the bufferIdx.*/
 bool OPCUADSInput::GetSignalMemoryBuffer(const uint32 signalIdx,
                                          const uint32 bufferIdx,
@@ -506,6 +549,13 @@ ErrorManagement::ErrorType OPCUADSInput::Execute(ExecutionInfo &info) {
                     err = ErrorManagement::CommunicationError;
                 }
             }
+            else if (readMode == "AsyncRead") {
+                /* Wait for the responses, as Execute is not called in the context of the real-time thread */
+                ok = masterClient->ReadAsync(types, nElements, 100u);
+                if (!ok) {
+                    err = ErrorManagement::CommunicationError;
+                }
+            }
             else if (readMode == "Monitor") {
                 err = ErrorManagement::UnsupportedFeature;
             }
@@ -524,6 +574,9 @@ bool OPCUADSInput::Synchronise() {
             if (readMode == "Read") {
                 ok = masterClient->Read(types, nElements);
             }
+            else if (readMode == "AsyncRead") {
+                ok = masterClient->ReadAsync(types, nElements, 0u);
+            }
             else if (readMode == "Monitor") {
                 ok = false;
             }
@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
+#include "AsyncStartup.h"
 #include "DataSourceI.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "MemoryMapSynchronisedInputBroker.h"
@@ -62,7 +63,10 @@ namespace MARTe {
  * +OPCUA = {
  *     Class = OPCUADataSource::OPCUADSInput
  *     Address = "opc.tcp://192.168.130.20:4840" //The OPCUA Server Address
- *     ReadMode = "Read" //"Read" uses OPCUA Read Service, "Monitor" uses OPCUA MonitoredItem Service. (Optional) Default = "Read"
+ *     ReadMode = "Read" //"Read" uses OPCUA Read Service, "AsyncRead" keeps OPCUA Read Service requests in flight asynchronously, "Monitor" uses OPCUA MonitoredItem Service. (Optional) Default = "Read"
+ *     MaxReadsInFlight = 2 //(Optional) Only if ReadMode is "AsyncRead". Maximum number of Read requests in flight (> 0). Default = 2
+ *     NodeIdCacheFile = "/tmp/OPCUANodeIds.cache" //(Optional) File where the resolved NodeIds are cached (see OPCUAClientI::ResolveNodeIds). Default = "" (no cache)
+ *     TranslateBatchSize = 500 //(Optional) Maximum number of browse paths translated by each TranslateBrowsePathsToNodeIds request (> 0). Default = 500
  *     SamplingTime = 1 //ms. Only if ReadMode is "Monitor"
  *     Synchronise = "yes" //"yes" uses the Synchronise method (and thus is executed in the context of the real-time thread, "no" to enable a decoupled SingleThreadService Execute method). Default = "no"
  *     CpuMask = 0xffu //(Optional) Only if Synchronise option is "no". Default = 0xffu
@@ -103,10 +107,19 @@ namespace MARTe {
  *     }
  * }
  * </pre>
+ * All the nodes of the DataSource are read with a single Read request. With ReadMode = "AsyncRead" the Synchronise (or Execute) does not wait for the
+ * round trip to the server: a new request is sent (if less than MaxReadsInFlight are in flight) and the values of the latest completed response are served.
+ * As a consequence the values are one or more round trips old.
+ *
  * When using Complex DataType Extension, the DataSource only allows to write 1 structure. If you need to add more signals you must add
  * another OPCUADSInput DataSource to your real time application.
+ *
+ * The connection to the server and the translation of the browse paths are started at the end of SetConfiguredDatabase in a separate
+ * thread (see AsyncStartup) and AllocateMemory waits for their completion: the connections of all the OPC UA (and other network)
+ * DataSources of the application are thus performed in parallel. The browse paths of all the signals are translated with a few batched
+ * requests and, if NodeIdCacheFile is set, the NodeIds are reused across restarts (see OPCUAClientI::ResolveNodeIds).
  */
-class OPCUADSInput: public DataSourceI, public EmbeddedServiceMethodBinderI {
+class OPCUADSInput: public DataSourceI, public EmbeddedServiceMethodBinderI, public AsyncStartupTaskI {
 
 public:
 
@@ -130,18 +143,26 @@ public:
     virtual bool Initialise(StructuredDataI &data);
 
     /**
-     * @brief Gets the actual number of nodes and sets the correct browse path for each signal. Starts the client if Thread Service is enabled.
+     * @brief Gets the actual number of nodes and sets the correct browse path for each signal. Starts the connection to the server.
      * @details This method constructs the actual browse paths for each node
      * adding all the child nodes if the signal is an Introspection Structure.
-     * @return true if all the paths were successfully constructed and the thread service is running.
+     * The connection is performed asynchronously (see ExecuteStartup).
+     * @return true if all the paths were successfully constructed and the connection was started.
      * @see DataSourceI::SetConfiguredDatabase
      */
     virtual bool SetConfiguredDatabase(StructuredDataI &data);
 
+    /**
+     * @brief Connects to the server and translates the browse paths of the nodes. Called by the startup thread.
+     * @return true if the client is connected and all the browse paths were translated.
+     * @see AsyncStartupTaskI::ExecuteStartup
+     */
+    virtual bool ExecuteStartup();
+
     /**
      * @see DataSourceI::AllocateMemory
-     * @brief NOOP.
-     * @return true
+     * @brief Waits for the connection started in SetConfiguredDatabase. Starts the client if Thread Service is enabled.
+     * @return true if the connection succeeded and the thread service is running.
      */
     virtual bool AllocateMemory();
 
@@ -235,6 +256,16 @@ private:
      */
     SingleThreadService executor;
 
+    /**
+     * Connects to the server in parallel with the other DataSources
+     */
+    AsyncStartup startup;
+
+    /**
+     * Length of the ByteString of the ExtensionObject
+     */
+    uint32 extensionObjectBodyLength;
+
     /**
      * Pointer to the Helper Class for the main Client
      */
@@ -245,6 +276,21 @@ private:
      */
     StreamString readMode;
 
+    /**
+     * Holds the value of the configuration parameter MaxReadsInFlight
+     */
+    uint32 maxReadsInFlight;
+
+    /**
+     * Holds the value of the configuration parameter NodeIdCacheFile
+     */
+    StreamString nodeIdCacheFile;
+
+    /**
+     * Holds the value of the configuration parameter TranslateBatchSize
+     */
+    uint32 translateBatchSize;
+
     /**
      * Holds the value of the configuration parameter ExtensionObject
      */
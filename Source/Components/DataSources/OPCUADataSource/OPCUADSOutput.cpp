@@ -57,16 +57,23 @@ OPCUADSOutput::OPCUADSOutput() :
     tempNamespaceIndexes = NULL_PTR(uint16*);
     tempNElements = NULL_PTR(uint32*);
     serverAddress = "";
+    writeMode = "";
+    writeOnChange = "";
+    maxWritesInFlight = 2u;
+    nodeIdCacheFile = "";
+    translateBatchSize = 500u;
     entryArrayElements = NULL_PTR(uint32*);
     entryNumberOfMembers = NULL_PTR(uint32*);
     entryArraySize = 0u;
     entryTypes = NULL_PTR(TypeDescriptor*);
     nElements = NULL_PTR(uint32*);
     types = NULL_PTR(TypeDescriptor*);
+    extensionObjectBodyLength = 0u;
 }
 
 /*lint -e{1551} No exception thrown.*/
 OPCUADSOutput::~OPCUADSOutput() {
+    (void) startup.Wait();
     if (masterClient != NULL_PTR(OPCUAClientWrite*)) {
         delete masterClient;
     }
@@ -115,6 +122,46 @@ bool OPCUADSOutput::Initialise(StructuredDataI &data) {
         if (!ok) {
             REPORT_ERROR(ErrorManagement::ParametersError, "Cannot read the Address attribute");
         }
+        if (ok) {
+            if (!data.Read("WriteMode", writeMode)) {
+                writeMode = "Write";
+                REPORT_ERROR(ErrorManagement::Information, "WriteMode option is not enabled. Using Service Write.");
+            }
+            ok = ((writeMode == "Write") || (writeMode == "AsyncWrite"));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "WriteMode defines an unsupported service.");
+            }
+        }
+        if ((writeMode == "AsyncWrite") && (ok)) {
+            if (!data.Read("MaxWritesInFlight", maxWritesInFlight)) {
+                REPORT_ERROR(ErrorManagement::Information, "MaxWritesInFlight not set. Using default: %d", maxWritesInFlight);
+            }
+            ok = (maxWritesInFlight > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "MaxWritesInFlight shall be > 0");
+            }
+        }
+        if (ok) {
+            if (!data.Read("NodeIdCacheFile", nodeIdCacheFile)) {
+                nodeIdCacheFile = "";
+            }
+            if (!data.Read("TranslateBatchSize", translateBatchSize)) {
+                REPORT_ERROR(ErrorManagement::Information, "TranslateBatchSize not set. Using default: %d", translateBatchSize);
+            }
+            ok = (translateBatchSize > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "TranslateBatchSize shall be > 0");
+            }
+        }
+        if (ok) {
+            if (!data.Read("WriteOnChange", writeOnChange)) {
+                writeOnChange = "yes";
+            }
+            ok = ((writeOnChange == "yes") || (writeOnChange == "no"));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "WriteOnChange shall be \"yes\" or \"no\"");
+            }
+        }
         if (ok) {
             ok = data.MoveRelative("Signals");
             if (!ok) {
@@ -336,9 +383,26 @@ bool OPCUADSOutput::SetConfiguredDatabase(StructuredDataI &data) {
         }
     }
     if (ok) {
+        extensionObjectBodyLength = bodyLength;
         /* Setting up the master Client who will perform the operations */
         masterClient = new OPCUAClientWrite();
         masterClient->SetServerAddress(serverAddress);
+        masterClient->SetWriteOnChange(writeOnChange == "yes");
+        masterClient->SetMaxWritesInFlight(maxWritesInFlight);
+        masterClient->SetNodeIdCacheFile(nodeIdCacheFile);
+        masterClient->SetTranslateBatchSize(translateBatchSize);
+        /* The connection and the browse of the Address Space are performed by the startup thread, in parallel with the other DataSources */
+        ok = startup.Start(*this, GetName());
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Error during configuration.");
+    }
+    return ok;
+}
+
+bool OPCUADSOutput::ExecuteStartup() {
+    bool ok = (masterClient != NULL_PTR(OPCUAClientWrite*));
+    if (ok) {
         ok = masterClient->Connect();
         if (!ok) {
             REPORT_ERROR(ErrorManagement::ParametersError, "Could not connect to the Server.");
@@ -359,7 +423,7 @@ bool OPCUADSOutput::SetConfiguredDatabase(StructuredDataI &data) {
                     ok = masterClient->SetServiceRequest(tempNamespaceIndexes, tempPaths, nOfSignals);
                     if (ok) {
                         masterClient->SetValueMemories(numberOfNodes);
-                        masterClient->SetDataPtr(bodyLength);
+                        masterClient->SetDataPtr(extensionObjectBodyLength);
                         for (uint32 k = 0u; k < nOfSignals; k++) {
                             uint32 nodeCounter = 0u;
                             uint32 index;
@@ -386,14 +450,15 @@ bool OPCUADSOutput::SetConfiguredDatabase(StructuredDataI &data) {
             }
         }
     }
-    if (!ok) {
-        REPORT_ERROR(ErrorManagement::ParametersError, "Error during configuration.");
-    }
     return ok;
 }
 
 bool OPCUADSOutput::AllocateMemory() {
-    return true;
+    bool ok = startup.Wait();
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Error during the startup.");
+    }
+    return ok;
 }
 
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: The signalAddress is independent of the bufferIdx.*/
@@ -449,8 +514,8 @@ bool OPCUADSOutput::PrepareNextState(const char8 *const currentStateName,
 bool OPCUADSOutput::Synchronise() {
     bool ok = true;
     if ((masterClient != NULL_PTR(OPCUAClientWrite*)) && (extensionObject != NULL_PTR(StreamString*))) {
-        if (extensionObject[0u] == "yes") {
-            ok = masterClient->Write();
+        if (writeMode == "AsyncWrite") {
+            ok = masterClient->WriteAsync(0u);
         }
         else {
             ok = masterClient->Write();
@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "AsyncStartup.h"
 #include "DataSourceI.h"
 #include "MemoryMapAsyncOutputBroker.h"
 #include "OPCUAClientWrite.h"
@@ -58,6 +59,11 @@ namespace MARTe {
  * +OPCUA = {
  *     Class = OPCUADataSource::OPCUADSOutput
  *     Address = "opc.tcp://192.168.130.20:4840" //The OPCUA Server Address
+ *     WriteMode = "Write" //"Write" uses OPCUA Write Service, "AsyncWrite" sends the OPCUA Write Service requests asynchronously. (Optional) Default = "Write"
+ *     WriteOnChange = "yes" //"yes" only writes the nodes whose value changed since the last write, "no" writes all the nodes at every cycle. (Optional) Default = "yes"
+ *     MaxWritesInFlight = 2 //(Optional) Only if WriteMode is "AsyncWrite". Maximum number of Write requests in flight (> 0). Default = 2
+ *     NodeIdCacheFile = "/tmp/OPCUANodeIds.cache" //(Optional) File where the resolved NodeIds are cached (see OPCUAClientI::ResolveNodeIds). Default = "" (no cache)
+ *     TranslateBatchSize = 500 //(Optional) Maximum number of browse paths translated by each TranslateBrowsePathsToNodeIds request (> 0). Default = 500
  *     Signals = {
  *         Node1 = {
  *             Type = uint32
@@ -95,8 +101,15 @@ namespace MARTe {
  * </pre>
  * When using Complex DataType Extension, the DataSource only allows to write 1 structure. If you need to add more signals you must add
  * another OPCUADSOuput DataSource to your real time application.
+ *
+ * All the nodes which changed are written with a single Write request (the ExtensionObject is written if any of its members changed).
+ * With WriteMode = "AsyncWrite" the Synchronise does not wait for the round trip to the server: if MaxWritesInFlight requests are
+ * already in flight the changes are coalesced and written by a later Synchronise. After a failed write all the nodes are written again.
+ *
+ * As for the OPCUADSInput, the connection to the server is performed in a separate thread, started at the end of SetConfiguredDatabase
+ * and waited for in AllocateMemory (see AsyncStartup).
  */
-class OPCUADSOutput: public DataSourceI {
+class OPCUADSOutput: public DataSourceI, public AsyncStartupTaskI {
 
 public:
 
@@ -120,17 +133,25 @@ public:
     virtual bool Initialise(StructuredDataI &data);
 
     /**
-     * @brief Gets the actual number of nodes and sets the correct browse path for each signal.
+     * @brief Gets the actual number of nodes and sets the correct browse path for each signal. Starts the connection to the server.
      * @details This method constructs the actual browse paths for each node
      * adding all the child nodes if the signal is an Introspection Structure.
-     * @return true if all the paths were successfully constructed.
+     * The connection is performed asynchronously (see ExecuteStartup).
+     * @return true if all the paths were successfully constructed and the connection was started.
      * @see DataSourceI::SetConfiguredDatabase
      */
     virtual bool SetConfiguredDatabase(StructuredDataI &data);
 
     /**
-     * @brief NOOP.
-     * @return true
+     * @brief Connects to the server and translates the browse paths of the nodes. Called by the startup thread.
+     * @return true if the client is connected and all the browse paths were translated.
+     * @see AsyncStartupTaskI::ExecuteStartup
+     */
+    virtual bool ExecuteStartup();
+
+    /**
+     * @brief Waits for the connection started in SetConfiguredDatabase.
+     * @return true if the connection succeeded.
      * @see DataSourceI::AllocateMemory
      */
     virtual bool AllocateMemory();
@@ -160,7 +181,7 @@ public:
                                   const char8 *const nextStateName);
 
     /**
-     * @details Provides the context to create the OPC UA Write service request.
+     * @details Provides the context to create the OPC UA Write service request (synchronous or asynchronous, see WriteMode).
      * @return true if all the services are executed correctly.
      * @see DataSourceI::Synchronise
      */
@@ -215,11 +236,46 @@ private:
      */
     OPCUAClientWrite * masterClient;
 
+    /**
+     * Connects to the server in parallel with the other DataSources
+     */
+    AsyncStartup startup;
+
+    /**
+     * Length of the ByteString of the ExtensionObject
+     */
+    uint32 extensionObjectBodyLength;
+
     /**
      * Holds the value of the configuration parameter Address
      */
     StreamString serverAddress;
 
+    /**
+     * Holds the value of the configuration parameter WriteMode
+     */
+    StreamString writeMode;
+
+    /**
+     * Holds the value of the configuration parameter WriteOnChange
+     */
+    StreamString writeOnChange;
+
+    /**
+     * Holds the value of the configuration parameter MaxWritesInFlight
+     */
+    uint32 maxWritesInFlight;
+
+    /**
+     * Holds the value of the configuration parameter NodeIdCacheFile
+     */
+    StreamString nodeIdCacheFile;
+
+    /**
+     * Holds the value of the configuration parameter TranslateBatchSize
+     */
+    uint32 translateBatchSize;
+
     /**
      * The number of Signals during initialise
      */
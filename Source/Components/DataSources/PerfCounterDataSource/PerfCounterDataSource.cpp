@@ -0,0 +1,399 @@
+/**
+ * @file PerfCounterDataSource.cpp
+ * @brief Source file for class PerfCounterDataSource
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PerfCounterDataSource (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "PerfCounterDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+/**
+ * Associates the name of an event with its perf_event type and config.
+ */
+struct PerfCounterEvent {
+    const MARTe::char8 *name;
+    MARTe::uint32 type;
+    MARTe::uint64 config;
+};
+
+/**
+ * The supported events.
+ */
+const PerfCounterEvent perfCounterEvents[] = { { "Cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES }, { "Instructions", PERF_TYPE_HARDWARE,
+PERF_COUNT_HW_INSTRUCTIONS }, { "CacheReferences", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES }, { "CacheMisses", PERF_TYPE_HARDWARE,
+PERF_COUNT_HW_CACHE_MISSES }, { "BranchInstructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS }, { "BranchMisses", PERF_TYPE_HARDWARE,
+PERF_COUNT_HW_BRANCH_MISSES }, { "ContextSwitches", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES }, { "CPUMigrations", PERF_TYPE_SOFTWARE,
+PERF_COUNT_SW_CPU_MIGRATIONS }, { "PageFaults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS }, { "TaskClock", PERF_TYPE_SOFTWARE,
+PERF_COUNT_SW_TASK_CLOCK } };
+
+/**
+ * The number of supported events.
+ */
+const MARTe::uint32 perfCounterNumberOfEvents = static_cast<MARTe::uint32>(sizeof(perfCounterEvents) / sizeof(PerfCounterEvent));
+
+#if defined(__x86_64__) || defined(__i386__)
+/**
+ * @brief Reads a performance monitoring counter.
+ */
+inline MARTe::uint64 PerfCounterRdpmc(const MARTe::uint32 counter) {
+    MARTe::uint32 low;
+    MARTe::uint32 high;
+    __asm__ __volatile__("rdpmc" : "=a" (low), "=d" (high) : "c" (counter));
+    return (static_cast<MARTe::uint64>(high) << 32u) | static_cast<MARTe::uint64>(low);
+}
+#endif
+
+/**
+ * @brief Prevents the compiler from reordering the memory accesses.
+ */
+inline void PerfCounterBarrier() {
+    __asm__ __volatile__("" : : : "memory");
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+PerfCounterDataSource::PerfCounterDataSource() :
+        MemoryDataSourceI() {
+    excludeKernel = true;
+    eventTypes = NULL_PTR(uint32 *);
+    eventConfigs = NULL_PTR(uint64 *);
+    descriptors = NULL_PTR(int32 *);
+    pages = NULL_PTR(void **);
+    previousValues = NULL_PTR(uint64 *);
+    signals = NULL_PTR(uint64 **);
+    countersOpen = false;
+    openFailed = false;
+}
+
+PerfCounterDataSource::~PerfCounterDataSource() {
+    CloseCounters();
+    if (eventTypes != NULL_PTR(uint32 *)) {
+        delete[] eventTypes;
+    }
+    if (eventConfigs != NULL_PTR(uint64 *)) {
+        delete[] eventConfigs;
+    }
+    if (descriptors != NULL_PTR(int32 *)) {
+        delete[] descriptors;
+    }
+    if (pages != NULL_PTR(void **)) {
+        delete[] pages;
+    }
+    if (previousValues != NULL_PTR(uint64 *)) {
+        delete[] previousValues;
+    }
+    if (signals != NULL_PTR(uint64 **)) {
+        delete[] signals;
+    }
+}
+
+bool PerfCounterDataSource::Initialise(StructuredDataI &data) {
+    bool ok = MemoryDataSourceI::Initialise(data);
+    if (ok) {
+        uint32 excludeKernelValue = 1u;
+        if (!data.Read("ExcludeKernel", excludeKernelValue)) {
+            excludeKernelValue = 1u;
+        }
+        ok = (excludeKernelValue <= 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "ExcludeKernel shall be 0 or 1");
+        }
+        excludeKernel = (excludeKernelValue == 1u);
+    }
+    if (ok) {
+        if (data.MoveRelative("Signals")) {
+            ok = data.Copy(signalsInformation);
+            if (ok) {
+                ok = data.MoveToAncestor(1u);
+            }
+        }
+    }
+    return ok;
+}
+
+bool PerfCounterDataSource::SetConfiguredDatabase(StructuredDataI &data) {
+    bool ok = MemoryDataSourceI::SetConfiguredDatabase(data);
+    uint32 nOfSignals = GetNumberOfSignals();
+    if (ok) {
+        ok = (nOfSignals > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "At least one signal shall be defined");
+        }
+    }
+    if (ok) {
+        eventTypes = new uint32[nOfSignals];
+        eventConfigs = new uint64[nOfSignals];
+        descriptors = new int32[nOfSignals];
+        pages = new void*[nOfSignals];
+        previousValues = new uint64[nOfSignals];
+        signals = new uint64*[nOfSignals];
+    }
+    for (uint32 i = 0u; (i < nOfSignals) && (ok); i++) {
+        /*lint -e{613} the arrays cannot be NULL as otherwise ok would be false*/
+        descriptors[i] = -1;
+        /*lint -e{613} the arrays cannot be NULL as otherwise ok would be false*/
+        pages[i] = NULL_PTR(void *);
+        /*lint -e{613} the arrays cannot be NULL as otherwise ok would be false*/
+        previousValues[i] = 0u;
+        /*lint -e{613} the arrays cannot be NULL as otherwise ok would be false*/
+        signals[i] = NULL_PTR(uint64 *);
+        StreamString signalName;
+        ok = GetSignalName(i, signalName);
+        if (ok) {
+            ok = (GetSignalType(i) == UnsignedInteger64Bit);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The type of the signal %s shall be uint64", signalName.Buffer());
+            }
+        }
+        uint32 nOfElements = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(i, nOfElements);
+        }
+        if (ok) {
+            ok = (nOfElements == 1u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The signal %s shall have one element", signalName.Buffer());
+            }
+        }
+        StreamString eventName = signalName;
+        if (ok) {
+            ok = signalsInformation.MoveToRoot();
+        }
+        if (ok) {
+            if (signalsInformation.MoveRelative(signalName.Buffer())) {
+                if (!signalsInformation.Read("Event", eventName)) {
+                    eventName = signalName;
+                }
+            }
+        }
+        if (ok) {
+            bool found = false;
+            for (uint32 e = 0u; (e < perfCounterNumberOfEvents) && (!found); e++) {
+                found = (eventName == perfCounterEvents[e].name);
+                if (found) {
+                    /*lint -e{613} the arrays cannot be NULL as otherwise ok would be false*/
+                    eventTypes[i] = perfCounterEvents[e].type;
+                    /*lint -e{613} the arrays cannot be NULL as otherwise ok would be false*/
+                    eventConfigs[i] = perfCounterEvents[e].config;
+                }
+            }
+            ok = found;
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Unsupported Event %s for the signal %s", eventName.Buffer(), signalName.Buffer());
+            }
+        }
+    }
+    if (ok) {
+        //Verify that the counters are available. They are opened again by the thread which reads the DataSource.
+        ok = OpenCounters();
+        CloseCounters();
+    }
+    return ok;
+}
+
+bool PerfCounterDataSource::Synchronise() {
+    uint32 nOfSignals = GetNumberOfSignals();
+    if ((!countersOpen) && (!openFailed)) {
+        countersOpen = OpenCounters();
+        openFailed = !countersOpen;
+        for (uint32 i = 0u; (i < nOfSignals) && (countersOpen); i++) {
+            void *signalAddress = NULL_PTR(void *);
+            countersOpen = GetSignalMemoryBuffer(i, 0u, signalAddress);
+            if (countersOpen) {
+                /*lint -e{613} signals and previousValues cannot be NULL after a successful SetConfiguredDatabase*/
+                signals[i] = static_cast<uint64 *>(signalAddress);
+                /*lint -e{613} signals and previousValues cannot be NULL after a successful SetConfiguredDatabase*/
+                previousValues[i] = ReadCounter(i);
+                /*lint -e{613} signals and previousValues cannot be NULL after a successful SetConfiguredDatabase*/
+                *signals[i] = 0u;
+            }
+        }
+    }
+    else if (countersOpen) {
+        for (uint32 i = 0u; i < nOfSignals; i++) {
+            uint64 value = ReadCounter(i);
+            /*lint -e{613} signals and previousValues cannot be NULL if the counters are open*/
+            *signals[i] = value - previousValues[i];
+            /*lint -e{613} signals and previousValues cannot be NULL if the counters are open*/
+            previousValues[i] = value;
+        }
+    }
+    else {
+        //NOOP
+    }
+    return countersOpen;
+}
+
+bool PerfCounterDataSource::PrepareNextState(const char8 * const currentStateName,
+                                             const char8 * const nextStateName) {
+    CloseCounters();
+    openFailed = false;
+    return true;
+}
+
+const char8 *PerfCounterDataSource::GetBrokerName(StructuredDataI &data,
+                                                  const SignalDirection direction) {
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == InputSignals) {
+        brokerName = "MemoryMapSynchronisedInputBroker";
+    }
+    return brokerName;
+}
+
+bool PerfCounterDataSource::IsExcludeKernel() const {
+    return excludeKernel;
+}
+
+bool PerfCounterDataSource::IsUserSpaceRead(const uint32 signalIdx) const {
+    bool ret = false;
+    if (pages != NULL_PTR(void **)) {
+        if (signalIdx < GetNumberOfSignals()) {
+            ret = (pages[signalIdx] != NULL_PTR(void *));
+        }
+    }
+    return ret;
+}
+
+bool PerfCounterDataSource::OpenCounters() {
+    bool ok = true;
+    uint32 nOfSignals = GetNumberOfSignals();
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    for (uint32 i = 0u; (i < nOfSignals) && (ok); i++) {
+        struct perf_event_attr attributes;
+        (void) memset(&attributes, 0, sizeof(attributes));
+        /*lint -e{613} the arrays cannot be NULL as OpenCounters is only called after their allocation*/
+        attributes.type = eventTypes[i];
+        attributes.size = sizeof(attributes);
+        /*lint -e{613} the arrays cannot be NULL as OpenCounters is only called after their allocation*/
+        attributes.config = eventConfigs[i];
+        //Always on the PMU, i.e. never multiplexed with other events
+        attributes.pinned = 1u;
+        attributes.exclude_kernel = excludeKernel ? 1u : 0u;
+        attributes.exclude_hv = 1u;
+        //pid = 0 and cpu = -1: the calling thread on any CPU
+        /*lint -e{613} the arrays cannot be NULL as OpenCounters is only called after their allocation*/
+        descriptors[i] = static_cast<int32>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+        ok = (descriptors[i] >= 0);
+        if (!ok) {
+            StreamString signalName;
+            (void) GetSignalName(i, signalName);
+            REPORT_ERROR(ErrorManagement::OSError, "Could not open the counter of the signal %s (see /proc/sys/kernel/perf_event_paranoid)",
+                         signalName.Buffer());
+        }
+#if defined(__x86_64__) || defined(__i386__)
+        if ((ok) && (attributes.type == PERF_TYPE_HARDWARE)) {
+            void *page = mmap(NULL_PTR(void *), static_cast<size_t>(pageSize), PROT_READ, MAP_SHARED, descriptors[i], 0);
+            if (page != MAP_FAILED) {
+                if (static_cast<const struct perf_event_mmap_page *>(page)->cap_user_rdpmc != 0u) {
+                    pages[i] = page;
+                }
+                else {
+                    (void) munmap(page, static_cast<size_t>(pageSize));
+                }
+            }
+        }
+#endif
+    }
+    if (!ok) {
+        CloseCounters();
+    }
+    return ok;
+}
+
+void PerfCounterDataSource::CloseCounters() {
+    if (descriptors != NULL_PTR(int32 *)) {
+        const long pageSize = sysconf(_SC_PAGESIZE);
+        uint32 nOfSignals = GetNumberOfSignals();
+        for (uint32 i = 0u; i < nOfSignals; i++) {
+            /*lint -e{613} pages cannot be NULL if descriptors is not NULL*/
+            if (pages[i] != NULL_PTR(void *)) {
+                (void) munmap(pages[i], static_cast<size_t>(pageSize));
+                pages[i] = NULL_PTR(void *);
+            }
+            if (descriptors[i] >= 0) {
+                (void) close(descriptors[i]);
+                descriptors[i] = -1;
+            }
+        }
+    }
+    countersOpen = false;
+}
+
+uint64 PerfCounterDataSource::ReadCounter(const uint32 signalIdx) const {
+    uint64 value = 0u;
+    bool userSpaceRead = false;
+#if defined(__x86_64__) || defined(__i386__)
+    /*lint -e{613} pages cannot be NULL if the counters are open*/
+    const volatile struct perf_event_mmap_page *page = static_cast<const volatile struct perf_event_mmap_page *>(pages[signalIdx]);
+    if (page != NULL_PTR(const volatile struct perf_event_mmap_page *)) {
+        //See the self-monitoring algorithm in linux/perf_event.h
+        uint32 sequence;
+        do {
+            sequence = page->lock;
+            PerfCounterBarrier();
+            uint32 index = page->index;
+            value = static_cast<uint64>(page->offset);
+            if ((page->cap_user_rdpmc != 0u) && (index != 0u)) {
+                uint32 width = static_cast<uint32>(page->pmc_width);
+                int64 counter = static_cast<int64>(PerfCounterRdpmc(index - 1u) << (64u - width));
+                counter >>= (64u - width);
+                value += static_cast<uint64>(counter);
+            }
+            PerfCounterBarrier();
+        }
+        while (page->lock != sequence);
+        userSpaceRead = true;
+    }
+#endif
+    if (!userSpaceRead) {
+        /*lint -e{613} descriptors cannot be NULL if the counters are open*/
+        if (read(descriptors[signalIdx], &value, sizeof(uint64)) != static_cast<ssize_t>(sizeof(uint64))) {
+            value = 0u;
+        }
+    }
+    return value;
+}
+
+CLASS_REGISTER(PerfCounterDataSource, "1.0")
+
+}
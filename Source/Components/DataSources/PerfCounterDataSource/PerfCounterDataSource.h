@@ -0,0 +1,221 @@
+/**
+ * @file PerfCounterDataSource.h
+ * @brief Header file for class PerfCounterDataSource
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class PerfCounterDataSource
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef PERFCOUNTERDATASOURCE_H_
+#define PERFCOUNTERDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "MemoryDataSourceI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Input DataSource which provides, for every cycle of a real-time thread, the number of hardware and software events
+ * (cycles, instructions, cache misses, branch misses, context switches, ...) counted by the Linux perf_event interface.
+ * @details The counters count the events of the thread which reads the DataSource (on any CPU) and are opened, pinned to the
+ * performance monitoring unit (i.e. never multiplexed), by the first Synchronise() after a state change, i.e. in the context of
+ * the real-time thread. Each Synchronise() then reads all the counters and writes in each signal the number of events since the
+ * previous Synchronise() (0 in the first cycle). The signals are read with a MemoryMapSynchronisedInputBroker, so that the
+ * DataSource should be read by the first GAM of the thread (e.g. together with the LinuxTimer signals) for the values to
+ * correspond to the previous cycle.
+ *
+ * On x86 the hardware counters are read in user space with rdpmc (through the perf_event mmap page), i.e. without any system call
+ * in the real-time thread. The software events and the hardware events on other architectures (or if the kernel does not allow
+ * rdpmc, see /sys/bus/event_source/devices/cpu/rdpmc) are read with a read() system call.
+ *
+ * The counters shall be available for the user (see /proc/sys/kernel/perf_event_paranoid); this is verified when the DataSource
+ * is configured.
+ *
+ * Each signal shall be uint64 with one element and counts the event named as the signal, unless the Event property is set in the
+ * Signals section. The supported events are Cycles, Instructions, CacheReferences, CacheMisses, BranchInstructions, BranchMisses
+ * (hardware) and ContextSwitches, CPUMigrations, PageFaults and TaskClock (software, the TaskClock being the CPU time in ns).
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +PerfCounters = {
+ *     Class = PerfCounterDataSource
+ *     ExcludeKernel = 1 //Optional. If 1 the events in kernel mode are not counted. Default = 1.
+ *     Signals = {
+ *         Instructions = {
+ *             Type = uint64
+ *         }
+ *         CacheMisses = {
+ *             Type = uint64
+ *         }
+ *         Switches = {
+ *             Type = uint64
+ *             Event = ContextSwitches //Optional. Default = the name of the signal.
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class PerfCounterDataSource: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    PerfCounterDataSource();
+
+    /**
+     * @brief Destructor. Closes the counters.
+     */
+    virtual ~PerfCounterDataSource();
+
+    /**
+     * @brief Reads ExcludeKernel and stores the Signals section to read the Event properties in SetConfiguredDatabase.
+     * @param[in] data the DataSource configuration.
+     * @return true if MemoryDataSourceI::Initialise succeeds and ExcludeKernel is 0 or 1.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals and that the counters can be opened.
+     * @param[in] data the configured database.
+     * @return true if all the signals are uint64 with one element, count a supported event and the counters can be opened.
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI &data);
+
+    /**
+     * @brief Reads all the counters and writes the number of events since the previous call in each signal.
+     * @details Opens the counters in the calling thread if they are not open.
+     * @return true if the counters are open.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Closes the counters, so that they are opened again by the thread which reads the DataSource in the next state.
+     * @param[in] currentStateName the current state.
+     * @param[in] nextStateName the next state.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief See DataSourceI::GetBrokerName.
+     * @return "MemoryMapSynchronisedInputBroker" for InputSignals, NULL otherwise.
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction);
+
+    /**
+     * @brief Gets the value of the ExcludeKernel parameter.
+     * @return true if ExcludeKernel = 1.
+     */
+    bool IsExcludeKernel() const;
+
+    /**
+     * @brief Checks if a counter is read with rdpmc.
+     * @param[in] signalIdx the index of the signal.
+     * @return true if the counter is open and is read with rdpmc.
+     */
+    bool IsUserSpaceRead(const uint32 signalIdx) const;
+
+private:
+
+    /**
+     * @brief Opens the counters in the calling thread.
+     * @return true if all the counters could be opened.
+     */
+    bool OpenCounters();
+
+    /**
+     * @brief Closes the counters.
+     */
+    void CloseCounters();
+
+    /**
+     * @brief Reads a counter.
+     * @param[in] signalIdx the index of the signal.
+     * @return the current value of the counter.
+     */
+    uint64 ReadCounter(const uint32 signalIdx) const;
+
+    /**
+     * The Signals section of the DataSource configuration.
+     */
+    ConfigurationDatabase signalsInformation;
+
+    /**
+     * True if the events in kernel mode are not counted.
+     */
+    bool excludeKernel;
+
+    /**
+     * The perf_event type and config of the event of each signal.
+     */
+    uint32 *eventTypes;
+    uint64 *eventConfigs;
+
+    /**
+     * The file descriptor of the counter of each signal (-1 if the counter is not open).
+     */
+    int32 *descriptors;
+
+    /**
+     * The perf_event mmap page of the counter of each signal (NULL if the counter is read with read()).
+     */
+    void **pages;
+
+    /**
+     * The value of each counter in the previous Synchronise().
+     */
+    uint64 *previousValues;
+
+    /**
+     * The memory of each signal.
+     */
+    uint64 **signals;
+
+    /**
+     * True if the counters are open.
+     */
+    bool countersOpen;
+
+    /**
+     * True if the counters could not be opened in the current state (they are not opened again until the next state).
+     */
+    bool openFailed;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PERFCOUNTERDATASOURCE_H_ */
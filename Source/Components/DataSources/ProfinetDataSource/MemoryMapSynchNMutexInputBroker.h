@@ -68,8 +68,9 @@ namespace MARTe {
 
             /**
              * @brief Runs the execute method on the DataSource, causing the input/output image copy.
-             * This specific implementation locks inputs on the DataSource, using a SynchroniseInput before copying
-             * and releases it with the shipped TerminateInputCopy, used without input parameters.
+             * This specific implementation lets the DataSource acquire the newest inputs, using a SynchroniseInput before copying
+             * and signals the end of the copy with the shipped TerminateInputCopy, used without input parameters.
+             * The ProfinetDataSource implements both without locking (see the process images in ProfinetDataSource).
             */
             virtual bool Execute();
 
@@ -72,8 +72,9 @@ namespace MARTe {
 
             /**
              * @brief Runs the execute method on the DataSource, causing the input/output image copy.
-             * This specific implementation locks outputs on the DataSource, using a SynchroniseOutput before copying
-             * and releases it with the shipped TerminateOutputCopy, used without input parameters.
+             * This specific implementation notifies the DataSource, using a SynchroniseOutput before copying
+             * and lets it publish the outputs with the shipped TerminateOutputCopy, used without input parameters.
+             * The ProfinetDataSource implements both without locking (see the process images in ProfinetDataSource).
              */
             virtual bool Execute();
 
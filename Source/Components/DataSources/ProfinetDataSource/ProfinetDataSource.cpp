@@ -36,12 +36,54 @@
 #include "ConfigurationDatabase.h"
 #include "ILoggerAdapter.h"
 #include "ProfinetDataSource.h"
+#include "StringHelper.h"
 
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+    /**
+     * @brief The names of the cycle statistics signals, in the order of the ProfinetDataSource cycleStatistics.
+     */
+    static const char8 * const cycleStatisticsSignalNames[PNETDS_CYCLESTATISTICS_COUNT] = {
+        "ProfinetCycleLateness",
+        "ProfinetCycleMaxLateness",
+        "ProfinetMissedCycles",
+        "ProfinetMainThreadLatency"
+    };
+
+    /**
+     * @brief Publishes the process image just written by the producer, making it the newest one.
+     * @param[in,out] sharedImage the index (and fresh flag) of the image exchanged between producer and consumer.
+     * @param[in] writtenImage the index of the image just written by the producer.
+     * @return the index of the image which the producer shall write next.
+     */
+    static int32 PublishProcessImage(volatile int32 &sharedImage, const int32 writtenImage) {
+        //lint -e{9027} Bitwise operations on the index are bounded by the PNETDS_PROCESSIMAGE masks
+        return (Atomic::Exchange(&sharedImage, (writtenImage | PNETDS_PROCESSIMAGE_FRESH)) & PNETDS_PROCESSIMAGE_INDEXMASK);
+    }
+
+    /**
+     * @brief Acquires for the consumer the newest process image, if it was published after the last acquisition.
+     * @details Only the consumer clears the fresh flag, so that the image is never acquired twice nor lost.
+     * @param[in,out] sharedImage the index (and fresh flag) of the image exchanged between producer and consumer.
+     * @param[in,out] readImage the index of the image owned by the consumer, updated with the acquired one.
+     * @return true if a new image was acquired, false if \a readImage is still the newest one.
+     */
+    static bool AcquireProcessImage(volatile int32 &sharedImage, int32 &readImage) {
+        //lint -e{9027} Bitwise operations on the index are bounded by the PNETDS_PROCESSIMAGE masks
+        bool fresh = ((sharedImage & PNETDS_PROCESSIMAGE_FRESH) != 0);
+        if(fresh) {
+            //lint -e{9027} Bitwise operations on the index are bounded by the PNETDS_PROCESSIMAGE masks
+            readImage = (Atomic::Exchange(&sharedImage, readImage) & PNETDS_PROCESSIMAGE_INDEXMASK);
+        }
+        return fresh;
+    }
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -76,10 +118,22 @@ namespace MARTe {
 		outputHeap = NULL_PTR(uint8*);
 		inputHeapHalfSize = 0u;
 		outputHeapHalfSize = 0u;
+		inputImages = NULL_PTR(uint8*);
+		inputImageMARTe = 0;
+		inputImageShared = 1;
+		inputImageProfinet = 2;
+		outputImages = NULL_PTR(uint8*);
+		outputImageProfinet = 0;
+		outputImageShared = 1;
+		outputImageMARTe = 2;
 		profinetLedSignalEnabled = false;
 		profinetLedSignalIndex = 0u;
 		profinetReadySignalEnabled = false;
 		profinetReadySignalIndex = 0u;
+		cycleStatisticsSignalsEnabled = false;
+		for(uint32 i = 0u; i < PNETDS_CYCLESTATISTICS_COUNT; i++) {
+		    cycleStatistics[i] = 0u;
+		}
 		signalIndexer[0] = NULL_PTR(profinet_marte_signal_t*);
 		signalIndexer[1] = NULL_PTR(profinet_marte_signal_t*);
 
@@ -118,6 +172,18 @@ namespace MARTe {
 	    GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(outputHeapTmp);
 	    outputHeap = NULL_PTR(uint8*);
 	}
+
+	if(inputImages != (NULL_PTR(uint8*))) {
+	    void* inputImagesTmp = static_cast<void*>(inputImages);
+	    GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(inputImagesTmp);
+	    inputImages = NULL_PTR(uint8*);
+	}
+
+	if(outputImages != (NULL_PTR(uint8*))) {
+	    void* outputImagesTmp = static_cast<void*>(outputImages);
+	    GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(outputImagesTmp);
+	    outputImages = NULL_PTR(uint8*);
+	}
     }
 
     ProfinetDataSource::~ProfinetDataSource() {
@@ -389,6 +455,8 @@ namespace MARTe {
         uint32 heapSizeToAllocateOutputs = 0u;
         inputHeap = NULL_PTR(uint8*);
         outputHeap = NULL_PTR(uint8*);
+        inputImages = NULL_PTR(uint8*);
+        outputImages = NULL_PTR(uint8*);
 
         //Scan the MARTe2 configuration file to assess the Slot/Subslot configuration for the Profinet peripheral
         if(returnValue) {
@@ -553,6 +621,20 @@ namespace MARTe {
             }
         }
 
+        //Allocate the input process images, exchanged without locking between MARTe and the Profinet cycle
+        if(returnValue) {
+            if(heapSizeToAllocateInputs > 0u) {
+                inputImages = reinterpret_cast<uint8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(heapSizeToAllocateInputs * PNETDS_PROCESSIMAGE_COUNT));
+                returnValue = (inputImages != NULL_PTR(uint8*));
+                if(returnValue) {
+                    returnValue = MemoryOperationsHelper::Set(inputImages, static_cast<char8>(0x00u), heapSizeToAllocateInputs * PNETDS_PROCESSIMAGE_COUNT);
+                }
+                if(!returnValue) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Cannot allocate or clear the input process images");
+                }
+            }
+        }
+
         //Allocate double the memory of the outputs, one half for Profinet, the other for MARTe
         if(returnValue) {
             if(heapSizeToAllocateOutputs > 0u) {
@@ -575,6 +657,20 @@ namespace MARTe {
             }
         }
 
+        //Allocate the output process images, exchanged without locking between the Profinet cycle and MARTe
+        if(returnValue) {
+            if(heapSizeToAllocateOutputs > 0u) {
+                outputImages = reinterpret_cast<uint8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(heapSizeToAllocateOutputs * PNETDS_PROCESSIMAGE_COUNT));
+                returnValue = (outputImages != NULL_PTR(uint8*));
+                if(returnValue) {
+                    returnValue = MemoryOperationsHelper::Set(outputImages, static_cast<char8>(0x00u), heapSizeToAllocateOutputs * PNETDS_PROCESSIMAGE_COUNT);
+                }
+                if(!returnValue) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Cannot allocate or clear the output process images");
+                }
+            }
+        }
+
         //Scan the Profinet Slot/Subslot structure and assign the previously allocated memory, on the first half of each buffer (I/O)
         if(returnValue) {
             uint8* inputHeapIndex = inputHeap;
@@ -679,6 +775,7 @@ namespace MARTe {
                         uint32 signalIndex = signalIndexLoop;
 			REPORT_ERROR(ErrorManagement::Information, "Moving to child %s", data.GetChildName(signalIndex));
                         StreamString tempSignalName = data.GetChildName(signalIndex);
+                        uint32 tempStatisticIndex = 0u;
                         if(data.MoveToChild(signalIndex)) {
                             //First check if we have one of the Profinet special signals, else it will be a standard signal
                             if(tempSignalName == "ProfinetDeviceLed") {
@@ -703,6 +800,15 @@ namespace MARTe {
                                 returnValue = MemoryOperationsHelper::Copy(&signalIndexer[0][signalIndex].marteName[0], &tempSignalName.Buffer()[0], static_cast<uint32>(tempSignalName.Size() + 1u));
                                 profinetReadySignalEnabled = true;
                             }
+                            else if(GetCycleStatisticIndex(tempSignalName.Buffer(), tempStatisticIndex)) {
+                                REPORT_ERROR(ErrorManagement::Information, "Found cycle statistics signal %s", tempSignalName.Buffer());
+                                //Read by MARTe as an output of the Profinet slave, refreshed by SynchroniseInput
+                                signalIndexer[0][signalIndex].firstByteOfSignal = reinterpret_cast<uint8*>(&cycleStatistics[tempStatisticIndex]);
+                                signalIndexer[0][signalIndex].direction = 1u;
+                                signalIndexer[0][signalIndex].needsSwapping = false;
+                                returnValue = MemoryOperationsHelper::Copy(&signalIndexer[0][signalIndex].marteName[0], &tempSignalName.Buffer()[0], static_cast<uint32>(tempSignalName.Size() + 1u));
+                                cycleStatisticsSignalsEnabled = true;
+                            }
                             else {
                                 uint16 tempSlotNumber = 0u;
                                 uint16 tempSubslotNumber = 0u;
@@ -810,8 +916,6 @@ namespace MARTe {
 
         //Last connections to helpers and cycles startup
         if(returnValue) {
-            inputSignalsSemaphore.Create();
-            outputSignalsSemaphore.Create();
 	    //lint -e{613} Adapter cannot be null here. Nullity was checked before
             adapter->cyclicNotificationListener = this;
            
@@ -853,63 +957,66 @@ namespace MARTe {
     }
 
     void ProfinetDataSource::NotifyCycle() {
-        if(inputSignalsSemaphore.FastLock() == ErrorManagement::NoError) {
-            //MARTe inputs must be copied into Profinet inputs (e.g. from the MARTe half to the Profinet half of the heap buffer)
-            //lint -e{613,9016} Null checks on inputHeap variable are done before
-	    bool inputCopy = MemoryOperationsHelper::Copy(inputHeap, inputHeap + inputHeapHalfSize, static_cast<uint32>(inputHeapHalfSize));
-	    if(inputCopy) {
-	        inputSignalsSemaphore.FastUnLock();
-		        
-	        //Swapping occurs outside the critical section, as it is not affecting the MARTe side
-	        //There is no reason to also lock MARTe while swapping data on the Profinet side
-	        //NOTE firstByteOfSignal is on the MARTe side, this is why we have to move pointer backwards to the Profinet section
-	        for(uint32 signalIndex = 0u; signalIndex < signalIndexerCount; signalIndex++) {
-	            if((signalIndexer[0u][signalIndex].direction == 0u) && (signalIndexer[0u][signalIndex].needsSwapping)) {
-	                switch(signalIndexer[0u][signalIndex].signalSize) {
-	                    case 2u:
-			    //lint -e{826,927,9016} Pointer arithmetics should be reasonably safe here
-	                    Endianity::ToBigEndian(*reinterpret_cast<int16*>(signalIndexer[0u][signalIndex].firstByteOfSignal - inputHeapHalfSize));
-	                    break;
-	                    case 4u:
-			    //lint -e{826,927,9016} Pointer arithmetics should be reasonably safe here
-	                    Endianity::ToBigEndian(*reinterpret_cast<int32*>(signalIndexer[0u][signalIndex].firstByteOfSignal - inputHeapHalfSize));
-	                    break;
-	                    case 8u:
-			    //lint -e{826,927,9016} Pointer arithmetics should be reasonably safe here
-	                    Endianity::ToBigEndian(*reinterpret_cast<int64*>(signalIndexer[0u][signalIndex].firstByteOfSignal - inputHeapHalfSize));
-	                    break;
-	                    default:
-	                    //TODO Check if really you can do nothing or cases exists where bigger swaps may occur
-	                    break;
+        //MARTe inputs must be copied into Profinet inputs (e.g. from the newest input image published by MARTe to the Profinet half of the heap buffer)
+        //If MARTe did not publish a new image since the last cycle, the Profinet half keeps the previous (already swapped) signals
+        if(inputHeapHalfSize > 0u) {
+            if(AcquireProcessImage(inputImageShared, inputImageProfinet)) {
+                //lint -e{613,9016} Null checks on inputHeap and inputImages variables are done before
+	        bool inputCopy = MemoryOperationsHelper::Copy(inputHeap, inputImages + (static_cast<uint64>(inputImageProfinet) * inputHeapHalfSize), static_cast<uint32>(inputHeapHalfSize));
+	        if(inputCopy) {
+	            //Swapping occurs on the Profinet side, which is only accessed by the Profinet cycle
+	            //NOTE firstByteOfSignal is on the MARTe side, this is why we have to move pointer backwards to the Profinet section
+	            for(uint32 signalIndex = 0u; signalIndex < signalIndexerCount; signalIndex++) {
+	                if((signalIndexer[0u][signalIndex].direction == 0u) && (signalIndexer[0u][signalIndex].needsSwapping)) {
+	                    switch(signalIndexer[0u][signalIndex].signalSize) {
+	                        case 2u:
+			        //lint -e{826,927,9016} Pointer arithmetics should be reasonably safe here
+	                        Endianity::ToBigEndian(*reinterpret_cast<int16*>(signalIndexer[0u][signalIndex].firstByteOfSignal - inputHeapHalfSize));
+	                        break;
+	                        case 4u:
+			        //lint -e{826,927,9016} Pointer arithmetics should be reasonably safe here
+	                        Endianity::ToBigEndian(*reinterpret_cast<int32*>(signalIndexer[0u][signalIndex].firstByteOfSignal - inputHeapHalfSize));
+	                        break;
+	                        case 8u:
+			        //lint -e{826,927,9016} Pointer arithmetics should be reasonably safe here
+	                        Endianity::ToBigEndian(*reinterpret_cast<int64*>(signalIndexer[0u][signalIndex].firstByteOfSignal - inputHeapHalfSize));
+	                        break;
+	                        default:
+	                        //TODO Check if really you can do nothing or cases exists where bigger swaps may occur
+	                        break;
+	                    }
 	                }
 	            }
 	        }
-	    }
+            }
         }
 
-        if(outputSignalsSemaphore.FastLock() == ErrorManagement::NoError) {
-            //Profinet outputs must be copied into MARTe outputs (e.g. from the Profinet half to the MARTe half of the heap buffer)
-            //lint -e{613,9016} Null checks on outputHeap variable are done before, pointer arithmetics is reasonably safe here
-	    bool outputCopy = MemoryOperationsHelper::Copy(outputHeap + outputHeapHalfSize, outputHeap, static_cast<uint32>(outputHeapHalfSize));
+        //Profinet outputs must be copied into MARTe outputs (e.g. from the Profinet half of the heap buffer to the output image owned by the cycle, which is then published)
+        if(outputHeapHalfSize > 0u) {
+            //lint -e{613,9016} Null checks on outputImages variable are done before, pointer arithmetics is reasonably safe here
+            uint8 *outputImage = outputImages + (static_cast<uint64>(outputImageProfinet) * outputHeapHalfSize);
+            //lint -e{613} Null checks on outputHeap variable are done before
+	    bool outputCopy = MemoryOperationsHelper::Copy(outputImage, outputHeap, static_cast<uint32>(outputHeapHalfSize));
 
 	    if(outputCopy) {
-            	//Swapping occurs inside the critical section, as we are swapping bytes on the MARTe side
-            	//MARTe must still wait before working on the signal buffer
-            	//NOTE firstByteOfSignal is on the MARTe side, this time no need to move pointers
+            	//Swapping occurs on the image, which is not yet visible to MARTe
+            	//NOTE firstByteOfSignal is on the MARTe side, this is why we have to move pointer backwards by the MARTe half start and forward to the image
             	for(uint32 signalIndex = 0u; signalIndex < signalIndexerCount; signalIndex++) {
                     if((signalIndexer[0u][signalIndex].direction == 1u) && (signalIndexer[0u][signalIndex].needsSwapping)) {
+                        //lint -e{613,946,947,9016} Pointer arithmetics should be reasonably safe here, standard signals are inside the MARTe half
+                        uint8 *imageSignal = outputImage + (signalIndexer[0u][signalIndex].firstByteOfSignal - (outputHeap + outputHeapHalfSize));
                     	switch(signalIndexer[0u][signalIndex].signalSize) {
                             case 2u:
-			    //lint -e{826,927,9016} Pointer arithmetics should be reasonably safe here
-                            Endianity::FromBigEndian(*reinterpret_cast<int16*>(signalIndexer[0u][signalIndex].firstByteOfSignal));
+			    //lint -e{826,927} Pointer arithmetics should be reasonably safe here
+                            Endianity::FromBigEndian(*reinterpret_cast<int16*>(imageSignal));
                             break;
                             case 4u:
-			    //lint -e{826,927,9016} Pointer arithmetics should be reasonably safe here
-                            Endianity::FromBigEndian(*reinterpret_cast<int32*>(signalIndexer[0u][signalIndex].firstByteOfSignal));
+			    //lint -e{826,927} Pointer arithmetics should be reasonably safe here
+                            Endianity::FromBigEndian(*reinterpret_cast<int32*>(imageSignal));
                             break;
                             case 8u:
-			    //lint -e{826,927,9016} Pointer arithmetics should be reasonably safe here
-                            Endianity::FromBigEndian(*reinterpret_cast<int64*>(signalIndexer[0u][signalIndex].firstByteOfSignal));
+			    //lint -e{826,927} Pointer arithmetics should be reasonably safe here
+                            Endianity::FromBigEndian(*reinterpret_cast<int64*>(imageSignal));
                             break;
                             default:
                             //TODO Check if really you can do nothing or cases exists where bigger swaps may occur
@@ -917,9 +1024,8 @@ namespace MARTe {
                         }
                     }
                 }
+                outputImageProfinet = PublishProcessImage(outputImageShared, outputImageProfinet);
 	    }
-
-            outputSignalsSemaphore.FastUnLock();
         }
     }
 
@@ -941,6 +1047,13 @@ namespace MARTe {
             if(returnValue) {
                 returnValue = GetSignalByteSize(tempSignalMARTeIndex, signalIndexer[0u][signalIndex].signalSize);
             }
+            uint32 tempStatisticIndex = 0u;
+            if(returnValue && GetCycleStatisticIndex(&signalIndexer[0u][signalIndex].marteName[0u], tempStatisticIndex)) {
+                returnValue = (GetSignalType(tempSignalMARTeIndex) == UnsignedInteger32Bit) && (signalIndexer[0u][signalIndex].signalSize == static_cast<uint32>(sizeof(uint32)));
+                if(!returnValue) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "The cycle statistics signal %s shall be one uint32", cycleStatisticsSignalNames[tempStatisticIndex]);
+                }
+            }
 
 	    if(returnValue) {
                 signalIndexer[0u][signalIndex].marteIndex = tempSignalMARTeIndex;
@@ -1135,29 +1248,47 @@ namespace MARTe {
     }
 
     bool ProfinetDataSource::SynchroniseInput() {
-        return inputSignalsSemaphore.FastTryLock();
+        bool returnValue = true;
+        //The statistics are written by the helpers threads (one aligned word each), a torn set of statistics is harmless
+        if(cycleStatisticsSignalsEnabled) {
+            if(timerHelper.IsValid()) {
+                cycleStatistics[0u] = timerHelper->GetLastLateness();
+                cycleStatistics[1u] = timerHelper->GetMaxLateness();
+                cycleStatistics[2u] = timerHelper->GetMissedCycles();
+            }
+            if(mainHelper.IsValid()) {
+                cycleStatistics[3u] = mainHelper->GetLastLatency();
+            }
+        }
+        //The newest output image published by the Profinet cycle (if any) replaces the MARTe half of the output heap
+        if(outputHeapHalfSize > 0u) {
+            if(AcquireProcessImage(outputImageShared, outputImageMARTe)) {
+                //lint -e{613,9016} Null checks on outputHeap and outputImages variables are done before
+                returnValue = MemoryOperationsHelper::Copy(outputHeap + outputHeapHalfSize, outputImages + (static_cast<uint64>(outputImageMARTe) * outputHeapHalfSize), static_cast<uint32>(outputHeapHalfSize));
+            }
+        }
+        return returnValue;
     }
     
     bool ProfinetDataSource::SynchroniseOutput() {
-        return outputSignalsSemaphore.FastTryLock();
+        return true;
     }
     
     //lint -e{715,830} signalIdx, offset and numberOfSamples are not used in this context as the termination is seen as a whole block signaling
     bool ProfinetDataSource::TerminateInputCopy(const uint32 signalIdx, const uint32 offset, const uint32 numberOfSamples) {
-        bool returnValue = false;
-        if(inputSignalsSemaphore.Locked()) {
-            inputSignalsSemaphore.FastUnLock();
-            returnValue = true;
-        }
-        return returnValue;
+        return true;
     }
 
     //lint -e{715,830} signalIdx, offset and numberOfSamples are not used in this context as the termination is seen as a whole block signaling
     bool ProfinetDataSource::TerminateOutputCopy (const uint32 signalIdx, const uint32 offset, const uint32 numberOfSamples) {
-        bool returnValue = false;
-        if(outputSignalsSemaphore.Locked()) {
-            outputSignalsSemaphore.FastUnLock();
-            returnValue = true;
+        bool returnValue = true;
+        //The MARTe half of the input heap is published as the newest input image, to be acquired by the next Profinet cycle
+        if(inputHeapHalfSize > 0u) {
+            //lint -e{613,9016} Null checks on inputHeap and inputImages variables are done before
+            returnValue = MemoryOperationsHelper::Copy(inputImages + (static_cast<uint64>(inputImageMARTe) * inputHeapHalfSize), inputHeap + inputHeapHalfSize, static_cast<uint32>(inputHeapHalfSize));
+            if(returnValue) {
+                inputImageMARTe = PublishProcessImage(inputImageShared, inputImageMARTe);
+            }
         }
         return returnValue;
     }
@@ -1174,6 +1305,17 @@ namespace MARTe {
         }
     }
 
+    bool ProfinetDataSource::GetCycleStatisticIndex(const char8 * const signalName, uint32 &statisticIndex) {
+        bool found = false;
+        for(uint32 i = 0u; (i < PNETDS_CYCLESTATISTICS_COUNT) && (!found); i++) {
+            found = (StringHelper::Compare(signalName, cycleStatisticsSignalNames[i]) == 0);
+            if(found) {
+                statisticIndex = i;
+            }
+        }
+        return found;
+    }
+
     void ProfinetDataSource::Abort() {
         if(timerHelper.IsValid()) {
             timerHelper->Stop();
@@ -35,11 +35,11 @@
 //lint -estring(1960, "*ProfinetDataSource*")
 //lint -estring(1960, "*cc_assert*")
 
+#include "Atomic.h"
 #include "CompilerTypes.h"
 #include "DataSourceI.h"
 #include "EmbeddedServiceMethodBinderT.h"
 #include "Endianity.h"
-#include "FastPollingMutexSem.h"
 #include "HighResolutionTimer.h"
 
 //lint ++flb "Utility libraries"
@@ -284,6 +284,26 @@
 #define PNETDS_MAXIMUM_MARTE2_SIGNALNAME_SIZE   256
 //lint +e1923
 
+/**
+ * @brief Number of process images exchanged between MARTe2 and Profinet for each direction (triple buffer)
+ */
+#define PNETDS_PROCESSIMAGE_COUNT               static_cast<MARTe::uint32>(3u)
+
+/**
+ * @brief Flag set on the shared process image index when the image was published and not yet acquired
+ */
+#define PNETDS_PROCESSIMAGE_FRESH               static_cast<MARTe::int32>(4)
+
+/**
+ * @brief Mask extracting the process image index from the shared process image index
+ */
+#define PNETDS_PROCESSIMAGE_INDEXMASK           static_cast<MARTe::int32>(3)
+
+/**
+ * @brief Number of cycle statistics special signals (ProfinetCycleLateness, ProfinetCycleMaxLateness, ProfinetMissedCycles and ProfinetMainThreadLatency)
+ */
+#define PNETDS_CYCLESTATISTICS_COUNT            static_cast<MARTe::uint32>(4u)
+
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
@@ -360,9 +380,14 @@ namespace MARTe {
          * happens:
          * <ul>
          *      <li>Each segment (input/output) is split into two halfs, one shared with the pnetdsadapter, the other exclusive property of MARTe2</li>
-         *      <li>Every synchronisation checkpoint the MARTe input part is copied inside the Profinet input part</li>
-         *      <li>Every synchronisation checkpoint the Profinet output part is copied inside the Profinet output part</li>
+         *      <li>Each segment is paired with three process images (triple buffer), which are the only memory shared between MARTe2 and the Profinet cycle</li>
+         *      <li>Every synchronisation checkpoint the MARTe input part is published as the newest input image, which the Profinet cycle copies inside the Profinet input part</li>
+         *      <li>Every Profinet cycle the Profinet output part is published as the newest output image, which the synchronisation checkpoint copies inside the MARTe output part</li>
          * </ul>
+         * The producer of each direction always owns one image and the consumer another one; the third image is exchanged between them
+         * with a single atomic exchange of its index (which also carries a "fresh" flag). Neither side locks, waits or fails:
+         * the consumer always gets the newest complete image (and keeps the previous one if nothing new was published), while the producer
+         * simply overwrites an image not yet acquired. Each direction supports a single producer thread and a single consumer thread.
          * Mechanisms of callback, implemented in form of interfaces from the DataSource, are exposed to specific portions
          * of the adapter, in order to propagate events from the library into the DataSource.
          *
@@ -384,9 +409,9 @@ namespace MARTe {
          * The brokers
          * ProfinetDataSource uses custom brokers, derived from the MemoryMap[Input,Output]Broker. They are similar
          * to the MemoryMapSynchronised[Input,Output]Broker version with a difference in the Synchronise/Terminate phase.
-         * As concurrent access happens at DataSource level, on the shared heap devoted to process image, the DataSource
-         * initiates the copying (and the locking) inside the Synchronise call and terminates it signaling with the ù
-         * Terminate[Input,Output]Copy (unlock).
+         * As concurrent access happens at DataSource level, on the process images, the DataSource
+         * acquires the newest output image inside the SynchroniseInput call and publishes the input image inside the
+         * TerminateOutputCopy call, both without locking.
          * Terminate[Input,Output]Copy methods are mildly abused in terms of MARTe intended usage, 
          * as they are called ignoring their calling parameters.
          * 
@@ -568,6 +593,13 @@ namespace MARTe {
          *               - Implement the mandatory Profinet signalling LED (which can be also stimulated from the master)
          *               - Bring to downstream MARTe2 GAMs the knowledge about the Profinet slave status, which is 1 if correctly
          *                 connected and updating the master, 0 otherwise.
+         *       //NOTE: Four special *optional* uint32 signals publish the statistics of the Profinet cycle scheduling, refreshed at each
+         *               SynchroniseInput:
+         *               - ProfinetCycleLateness: the lateness (in microseconds) of the last Timer tick with respect to its absolute deadline;
+         *               - ProfinetCycleMaxLateness: the maximum lateness (in microseconds) of the Timer ticks;
+         *               - ProfinetMissedCycles: the number of Timer ticks skipped because their deadline was missed by more than one interval;
+         *               - ProfinetMainThreadLatency: the latency (in microseconds) between the notification of the last handled event
+         *                 (e.g. the Timer tick) and its handling in the MainThread.
          *       //NOTE: A knowledge of the slave and of its corresponding GSDML clarifies the next section, considering that
          *               Profinet sees only a chunk of memory and signals are a particular way of seeing data.
          *       //FAQ: Q: What happens if I mess with Slot / Subslot / Offset / Direction values?
@@ -616,6 +648,11 @@ namespace MARTe {
          *                       NumberOfElements = 1
          *                       NumberOfDimensions = 0
          *               }
+         *               ProfinetCycleLateness = {
+         *                       Type = uint32
+         *                       NumberOfElements = 1
+         *                       NumberOfDimensions = 0
+         *               }
          *       }
          * }
          * 
@@ -686,7 +723,7 @@ namespace MARTe {
             virtual bool AllocateMemory();
 
             /**
-             * @brief Returns always one, as the DataSource uses an internal double buffering mechanism which is not exposed to MARTe2
+             * @brief Returns always one, as the DataSource uses an internal triple buffering mechanism which is not exposed to MARTe2
              * @return 1u
              */
             virtual uint32 GetNumberOfMemoryBuffers();
@@ -726,33 +763,34 @@ namespace MARTe {
                     void * const gamMemPtr);
 
             /**
-             * @brief Triggers the Input Synchronisation routine, by locking the relevant heap block (I/O)
-             * @return  True if the locking is successful, false otherwise (true, signals updated, false stale signals).
-             *          Stale approach is done to avoid impairing MARTe2 RT performances.
+             * @brief Triggers the Input Synchronisation routine, acquiring (without locking) the newest output image published by the Profinet cycle
+             * @details The image is copied inside the MARTe half of the output heap. If no new image was published since the last call,
+             *          the MARTe half keeps the previous signals.
+             * @return  true if the copy is successful.
              */
             virtual bool SynchroniseInput();
 
             /**
-             * @brief Triggers the Output Synchronisation routine, by locking the relevant heap block (I/O)
-             * @return  True if the locking is successful, false otherwise (true, signals updated, false stale signals).
-             *          Stale approach is done to avoid impairing MARTe2 RT performances.
+             * @brief Triggers the Output Synchronisation routine. Nothing to do, as the MARTe half of the input heap is only accessed by MARTe.
+             * @return  true
              */
             virtual bool SynchroniseOutput();
 
             /**
-             * @brief Signals the ending of the input copy, from the broker, in order to release concurrent locks.
+             * @brief Signals the ending of the input copy, from the broker. Nothing to release.
              * @return  true
              */
             virtual bool TerminateInputCopy(const uint32 signalIdx, const uint32 offset, const uint32 numberOfSamples);
 
             /**
-             * @brief Signals the ending of the output copy, from the broker, in order to release concurrent locks.
-             * @return  true
+             * @brief Signals the ending of the output copy, from the broker, publishing (without locking) the MARTe half of the input heap as the newest input image.
+             * @return  true if the copy is successful.
              */
             virtual bool TerminateOutputCopy (const uint32 signalIdx, const uint32 offset, const uint32 numberOfSamples);
 
             /**
              * @brief Notification receiver, indicating data memory bank update
+             * @details Copies the newest input image (if any) inside the Profinet input part and publishes the Profinet output part as the newest output image.
              */
             virtual void NotifyCycle();
 
@@ -990,14 +1028,44 @@ namespace MARTe {
                 uint64 outputHeapHalfSize;
 
                 /**
-                 * @brief Protects access to the input signal copy phase
+                 * @brief Input process images (PNETDS_PROCESSIMAGE_COUNT * inputHeapHalfSize), published by MARTe and acquired by the Profinet cycle
+                 */
+                uint8   *inputImages;
+
+                /**
+                 * @brief Index of the input image owned by MARTe (written by TerminateOutputCopy)
+                 */
+                int32 inputImageMARTe;
+
+                /**
+                 * @brief Index (and fresh flag) of the input image exchanged between MARTe and the Profinet cycle
+                 */
+                volatile int32 inputImageShared;
+
+                /**
+                 * @brief Index of the input image owned by the Profinet cycle (read by NotifyCycle)
+                 */
+                int32 inputImageProfinet;
+
+                /**
+                 * @brief Output process images (PNETDS_PROCESSIMAGE_COUNT * outputHeapHalfSize), published by the Profinet cycle and acquired by MARTe
+                 */
+                uint8   *outputImages;
+
+                /**
+                 * @brief Index of the output image owned by the Profinet cycle (written by NotifyCycle)
+                 */
+                int32 outputImageProfinet;
+
+                /**
+                 * @brief Index (and fresh flag) of the output image exchanged between the Profinet cycle and MARTe
                  */
-                FastPollingMutexSem inputSignalsSemaphore;
+                volatile int32 outputImageShared;
 
                 /**
-                 * @brief Protects access to the output signal copy phas
+                 * @brief Index of the output image owned by MARTe (read by SynchroniseInput)
                  */
-                FastPollingMutexSem outputSignalsSemaphore;
+                int32 outputImageMARTe;
 
                 /**
                  * @brief Timer helper reference, ticking at the Profinet scan cycle frequency in order for the protocol to evolve
@@ -1029,6 +1097,24 @@ namespace MARTe {
                  */
                 uint32 profinetReadySignalIndex;
 
+                /**
+                 * @brief Indicates whether at least one of the cycle statistics signals is enabled.
+                 */
+                bool cycleStatisticsSignalsEnabled;
+
+                /**
+                 * @brief The memory of the cycle statistics signals, refreshed from the helpers by SynchroniseInput.
+                 */
+                uint32 cycleStatistics[PNETDS_CYCLESTATISTICS_COUNT];
+
+                /**
+                 * @brief Gets the position of a cycle statistics signal in the cycleStatistics.
+                 * @param[in] signalName the name of the signal.
+                 * @param[out] statisticIndex the position of the signal in the cycleStatistics.
+                 * @return true if \a signalName is one of the cycle statistics signals.
+                 */
+                static bool GetCycleStatisticIndex(const char8 * const signalName, uint32 &statisticIndex);
+
     };
 
 }
@@ -24,6 +24,7 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <time.h>
 
 
 /*---------------------------------------------------------------------------*/
@@ -34,6 +35,18 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+    /**
+     * @brief Gets the CLOCK_MONOTONIC time.
+     * @return the CLOCK_MONOTONIC time in nanoseconds.
+     */
+    MARTe::uint64 GetMonotonicTimeNs() {
+        struct timespec now;
+        //lint -e{534} CLOCK_MONOTONIC is always supported
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (static_cast<MARTe::uint64>(now.tv_sec) * 1000000000u) + static_cast<MARTe::uint64>(now.tv_nsec);
+    }
+}
 
 
 /*---------------------------------------------------------------------------*/
@@ -44,6 +57,12 @@ namespace MARTe {
     ProfinetMainThreadHelper::ProfinetMainThreadHelper() :  Object(),
                                                             EmbeddedServiceMethodBinderT<ProfinetMainThreadHelper>(*this, &ProfinetMainThreadHelper::ThreadCallback),
                                                             service(*this) {
+        entryPoint = NULL_PTR(IMainThreadEntryPoint*);
+        sleepTimeSeconds = 0.0F;
+        eventFlag = 0u;
+        eventNotifiedNs = 0u;
+        lastLatencyUs = 0u;
+        maxLatencyUs = 0u;
         //flagMutex.Create(false);
         
         //eventSemaphore.Create();
@@ -88,6 +107,12 @@ namespace MARTe {
         if(info.GetStage() == ExecutionInfo::MainStage) {
             //Stand still, awaiting for an event to be raised
 	    if(eventSemaphore.Wait(timeout) == ErrorManagement::NoError) {
+                uint64 notifiedNs = eventNotifiedNs;
+                uint64 nowNs = GetMonotonicTimeNs();
+                lastLatencyUs = (nowNs > notifiedNs) ? static_cast<uint32>((nowNs - notifiedNs) / 1000u) : 0u;
+                if(lastLatencyUs > maxLatencyUs) {
+                    maxLatencyUs = lastLatencyUs;
+                }
                 uint16 localFlag = 0u;
                 uint16 workedFlags = 0u;
 
@@ -154,6 +179,10 @@ namespace MARTe {
 
     void ProfinetMainThreadHelper::NotifyEvent(const ProfinetDataSourceEventType eventType) {
         if(flagMutex.FastLock(timeout, sleepTimeSeconds) == ErrorManagement::NoError) {
+            //The latency is measured from the oldest pending event
+            if(eventFlag == 0u) {
+                eventNotifiedNs = GetMonotonicTimeNs();
+            }
 	    //lint -e{641,9114,9117,9119,9130} Event Type is an enum which is thought as a flag and its values are 2^n
             eventFlag |= eventType;
             if(!eventSemaphore.Post()) {
@@ -177,6 +206,14 @@ namespace MARTe {
         timeout.SetTimeoutSec(static_cast<float64>(seconds));
     }
 
+    uint32 ProfinetMainThreadHelper::GetLastLatency() const {
+        return lastLatencyUs;
+    }
+
+    uint32 ProfinetMainThreadHelper::GetMaxLatency() const {
+        return maxLatencyUs;
+    }
+
     CLASS_REGISTER(ProfinetMainThreadHelper, "1.0")
 }
 
@@ -54,6 +54,8 @@ namespace MARTe {
     /**
      * @brief Service to call at consistent intervals the MainThread entry point function
      * on the Profinet adapter.
+     * @details The latency between the notification of the oldest pending event (e.g. the Timer event raised by the
+     * ProfinetTimerHelper) and the start of its handling in the MainThread is measured on the CLOCK_MONOTONIC.
      */
     class ProfinetMainThreadHelper :
         public Object,
@@ -100,6 +102,21 @@ namespace MARTe {
              */
             uint16 eventFlag;
 
+            /**
+             * @brief The CLOCK_MONOTONIC time (in nanoseconds) when the oldest pending event was notified
+             */
+            volatile uint64 eventNotifiedNs;
+
+            /**
+             * @brief The latency of the last handled event in microseconds
+             */
+            volatile uint32 lastLatencyUs;
+
+            /**
+             * @brief The maximum latency of the handled events in microseconds
+             */
+            volatile uint32 maxLatencyUs;
+
         public:
             CLASS_REGISTER_DECLARATION()
 
@@ -149,6 +166,18 @@ namespace MARTe {
              * @param[in] seconds The service timeout expreseed in seconds
              */
             void SetTimeout(const float32 seconds);
+
+            /**
+             * @brief Gets the latency between the notification of the oldest pending event and the start of its handling.
+             * @return the latency of the last handled event in microseconds.
+             */
+            uint32 GetLastLatency() const;
+
+            /**
+             * @brief Gets the maximum latency between the notification of an event and the start of its handling.
+             * @return the maximum latency in microseconds.
+             */
+            uint32 GetMaxLatency() const;
     };
 
 }
@@ -24,6 +24,8 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <time.h>
 
 
 /*---------------------------------------------------------------------------*/
@@ -34,6 +36,23 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+    /**
+     * Number of nanoseconds in one second.
+     */
+    const MARTe::uint64 nanosecondsInSecond = 1000000000u;
+
+    /**
+     * @brief Gets the CLOCK_MONOTONIC time.
+     * @return the CLOCK_MONOTONIC time in nanoseconds.
+     */
+    MARTe::uint64 GetMonotonicTimeNs() {
+        struct timespec now;
+        //lint -e{534} CLOCK_MONOTONIC is always supported
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (static_cast<MARTe::uint64>(now.tv_sec) * nanosecondsInSecond) + static_cast<MARTe::uint64>(now.tv_nsec);
+    }
+}
 
 
 /*---------------------------------------------------------------------------*/
@@ -44,12 +63,37 @@ namespace MARTe {
     ProfinetTimerHelper::ProfinetTimerHelper() :    Object(),
                                                     EmbeddedServiceMethodBinderT<ProfinetTimerHelper>(*this, &ProfinetTimerHelper::ThreadCallback),
                                                     service(*this) {
+        entryPoint = NULL_PTR(ITimerEntryPoint*);
+        timerInterval = 0.0;
+        intervalNs = 0u;
+        nextDeadlineNs = 0u;
+        spinMarginNs = 0u;
+        adaptiveSpinMargin = false;
+        wakeUpLatencyNs = 0u;
+        lastLatenessUs = 0u;
+        maxLatenessUs = 0u;
+        missedCycles = 0u;
         REPORT_ERROR(ErrorManagement::Information, "Timer Helper created");                                                
     }
 
     bool ProfinetTimerHelper::Initialise(StructuredDataI &data) {
         bool returnValue = Object::Initialise(data);
 
+        if(returnValue) {
+            uint32 spinMarginUs = 0u;
+            if(!data.Read("SpinMargin", spinMarginUs)) {
+                spinMarginUs = 0u;
+            }
+            spinMarginNs = static_cast<uint64>(spinMarginUs) * 1000u;
+            wakeUpLatencyNs = spinMarginNs;
+            uint8 adaptive = 0u;
+            if(!data.Read("AdaptiveSpinMargin", adaptive)) {
+                adaptive = 0u;
+            }
+            adaptiveSpinMargin = (adaptive != 0u);
+            REPORT_ERROR(ErrorManagement::Information, "Absolute deadlines with a %s spin margin of %d us", adaptiveSpinMargin ? "self-tuned" : "fixed", spinMarginUs);
+        }
+
         if(returnValue) {
             returnValue = service.Initialise(data);
         }
@@ -63,20 +107,17 @@ namespace MARTe {
 
     //lint -e{830, 1764} Function prototype is derived from upper type
     ErrorManagement::ErrorType ProfinetTimerHelper::ThreadCallback(ExecutionInfo &info) {
-        if(timerInterval >= lastInterval) {
-            Sleep::Sec(static_cast<float32>(timerInterval - lastInterval));
-        }
-        uint64 elapsedStart = HighResolutionTimer::Counter();
-
         ErrorManagement::ErrorType returnValue = ErrorManagement::NoError;
 
         if(info.GetStage() == ExecutionInfo::MainStage) {
+            WaitNextDeadline();
             if(entryPoint != NULL_PTR(ITimerEntryPoint*)) {
                 entryPoint->TimerTick();
             }
         }
         else if(info.GetStage() == ExecutionInfo::StartupStage) {
-            
+            //The deadlines are counted from the start of the service
+            nextDeadlineNs = GetMonotonicTimeNs();
         }
         else if(info.GetStage() == ExecutionInfo::TerminationStage) {
             
@@ -91,11 +132,62 @@ namespace MARTe {
 	    REPORT_ERROR(ErrorManagement::ParametersError, "Unknown thread callback execution stage");
 	}
 
-        lastInterval = HighResolutionTimer::TicksToTime(HighResolutionTimer::Counter(), elapsedStart);
-
         return returnValue;
     }   
 
+    void ProfinetTimerHelper::WaitNextDeadline() {
+        uint64 now = GetMonotonicTimeNs();
+        if(nextDeadlineNs == 0u) {
+            nextDeadlineNs = now;
+        }
+        nextDeadlineNs += intervalNs;
+        if((now < nextDeadlineNs) && ((nextDeadlineNs - now) > spinMarginNs)) {
+            const uint64 wakeUpNs = nextDeadlineNs - spinMarginNs;
+            struct timespec wakeUpTime;
+            wakeUpTime.tv_sec = static_cast<time_t>(wakeUpNs / nanosecondsInSecond);
+            wakeUpTime.tv_nsec = static_cast<long>(wakeUpNs % nanosecondsInSecond);
+            int32 err;
+            do {
+                err = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeUpTime, NULL_PTR(struct timespec *));
+            }
+            while(err == EINTR);
+            if(adaptiveSpinMargin) {
+                now = GetMonotonicTimeNs();
+                uint64 latency = (now > wakeUpNs) ? (now - wakeUpNs) : 0u;
+                if(latency > wakeUpLatencyNs) {
+                    wakeUpLatencyNs = latency;
+                }
+                else {
+                    wakeUpLatencyNs -= ((wakeUpLatencyNs - latency) >> 6u);
+                }
+                spinMarginNs = wakeUpLatencyNs + (wakeUpLatencyNs >> 1u);
+            }
+        }
+        else if((now < nextDeadlineNs) && (adaptiveSpinMargin)) {
+            //No wake-up latency can be measured: let the estimate decay so that a single late wake-up does not disable the sleeping
+            wakeUpLatencyNs -= (wakeUpLatencyNs >> 6u);
+            spinMarginNs = wakeUpLatencyNs + (wakeUpLatencyNs >> 1u);
+        }
+        else {
+            //NOOP
+        }
+        now = GetMonotonicTimeNs();
+        while(now < nextDeadlineNs) {
+            now = GetMonotonicTimeNs();
+        }
+        uint64 latenessNs = now - nextDeadlineNs;
+        //The missed deadlines are skipped, the next tick is aligned on the schedule
+        if((intervalNs > 0u) && (latenessNs >= intervalNs)) {
+            uint64 missed = latenessNs / intervalNs;
+            missedCycles += static_cast<uint32>(missed);
+            nextDeadlineNs += (missed * intervalNs);
+        }
+        lastLatenessUs = static_cast<uint32>(latenessNs / 1000u);
+        if(lastLatenessUs > maxLatenessUs) {
+            maxLatenessUs = lastLatenessUs;
+        }
+    }
+
     //lint -e{830,952}
     bool ProfinetTimerHelper::SetEntryPoint(ITimerEntryPoint *entryPointParam) {
         bool returnValue = false;
@@ -120,6 +212,23 @@ namespace MARTe {
 
     void ProfinetTimerHelper::SetTimerInterval(const float64 intervalInSeconds) {
         timerInterval = intervalInSeconds;
+        intervalNs = static_cast<uint64>((timerInterval * static_cast<float64>(nanosecondsInSecond)) + 0.5);
+    }
+
+    uint32 ProfinetTimerHelper::GetLastLateness() const {
+        return lastLatenessUs;
+    }
+
+    uint32 ProfinetTimerHelper::GetMaxLateness() const {
+        return maxLatenessUs;
+    }
+
+    uint32 ProfinetTimerHelper::GetMissedCycles() const {
+        return missedCycles;
+    }
+
+    uint32 ProfinetTimerHelper::GetSpinMargin() const {
+        return static_cast<uint32>(spinMarginNs / 1000u);
     }
     
 
@@ -47,6 +47,24 @@ namespace MARTe {
      *          to trigger the "Timer" event, which is then caught by the MainThread loop.
      *          Profinet underlying layers will see the rise of the event and deal with the
      *          synchronisation logic (aka Cyclic data).
+     * @details The ticks are scheduled on absolute CLOCK_MONOTONIC deadlines (startup + n * interval), with
+     *          clock_nanosleep(TIMER_ABSTIME), so that neither the execution time of the tick nor the wake-up latency
+     *          accumulate as a drift. As in the Deadline SleepNature of the LinuxTimer HighResolutionTimeProvider, the
+     *          thread can wake up SpinMargin microseconds before the deadline and busy spin the remaining time, to absorb the
+     *          wake-up latency of the OS. If AdaptiveSpinMargin = 1 the SpinMargin is the initial value of a margin which is
+     *          self-tuned to 1.5 times the (decaying) maximum of the recent wake-up latencies.
+     *          The lateness of each tick with respect to its deadline is measured. If a deadline is missed by more than one
+     *          interval the missed ticks are counted and skipped (the schedule is not caught up with a burst of ticks).
+     *
+     * <pre>
+     * +TimerHelper = {
+     *     Class = ProfinetTimerHelper
+     *     Timeout = 1000
+     *     CPUMask = 0xFF
+     *     SpinMargin = 0 //Optional. In microseconds. Default = 0 (no busy spin).
+     *     AdaptiveSpinMargin = 0 //Optional. Default = 0.
+     * }
+     * </pre>
      */
     class ProfinetTimerHelper : public Object,
                                 public EmbeddedServiceMethodBinderT<ProfinetTimerHelper> {
@@ -73,10 +91,50 @@ namespace MARTe {
             float64 timerInterval;
 
             /**
-             * @brief Holds the last elapsed execution time, in order to be subtracted from the interval and
-             * implement a cycle-by-cycle interval duration correction.
+             * @brief Sleeps until the next absolute deadline (minus the spin margin) and busy spins until the deadline.
+             * @details Updates the lateness statistics and skips the missed deadlines.
              */
-            float64 lastInterval;
+            void WaitNextDeadline();
+
+            /**
+             * @brief The timer interval in CLOCK_MONOTONIC nanoseconds
+             */
+            uint64 intervalNs;
+
+            /**
+             * @brief The absolute CLOCK_MONOTONIC deadline (in nanoseconds) of the next tick (0 before the first tick)
+             */
+            uint64 nextDeadlineNs;
+
+            /**
+             * @brief The nanoseconds before the deadline where the sleep stops and the busy spin starts
+             */
+            uint64 spinMarginNs;
+
+            /**
+             * @brief True if the spin margin is self-tuned from the measured wake-up latencies
+             */
+            bool adaptiveSpinMargin;
+
+            /**
+             * @brief The (decaying) maximum of the recent wake-up latencies in nanoseconds
+             */
+            uint64 wakeUpLatencyNs;
+
+            /**
+             * @brief The lateness of the last tick in microseconds
+             */
+            volatile uint32 lastLatenessUs;
+
+            /**
+             * @brief The maximum lateness of the ticks in microseconds
+             */
+            volatile uint32 maxLatenessUs;
+
+            /**
+             * @brief The number of skipped ticks
+             */
+            volatile uint32 missedCycles;
 
         public:
             CLASS_REGISTER_DECLARATION()
@@ -93,6 +151,7 @@ namespace MARTe {
 
             /**
              * @brief Initializes the instance
+             * @details Reads the optional SpinMargin and AdaptiveSpinMargin parameters.
              */
             virtual bool Initialise(StructuredDataI &data);
 
@@ -116,6 +175,30 @@ namespace MARTe {
              * @brief Stops the service
              */
             void Stop();
+
+            /**
+             * @brief Gets the lateness of the last tick with respect to its deadline.
+             * @return the lateness in microseconds.
+             */
+            uint32 GetLastLateness() const;
+
+            /**
+             * @brief Gets the maximum lateness of the ticks with respect to their deadline.
+             * @return the maximum lateness in microseconds.
+             */
+            uint32 GetMaxLateness() const;
+
+            /**
+             * @brief Gets the number of ticks which were skipped because their deadline was missed by more than one interval.
+             * @return the number of skipped ticks.
+             */
+            uint32 GetMissedCycles() const;
+
+            /**
+             * @brief Gets the current spin margin.
+             * @return the current spin margin in microseconds.
+             */
+            uint32 GetSpinMargin() const;
     };
     
 }
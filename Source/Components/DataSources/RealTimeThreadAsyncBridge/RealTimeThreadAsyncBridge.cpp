@@ -24,6 +24,9 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -49,12 +52,10 @@
 namespace MARTe {
 RealTimeThreadAsyncBridge::RealTimeThreadAsyncBridge() :
         MemoryDataSourceI(),
-        MessageI(),
-        resetTimeout() {
-    spinlocksRead = NULL_PTR(volatile int32 *);
-    spinlocksWrite = NULL_PTR(FastPollingMutexSem *);
-    whatIsNewestCounter = NULL_PTR(uint32 *);
-    whatIsNewestGlobCounter = NULL_PTR(uint32 *);
+        MessageI() {
+    bufferControl = NULL_PTR(RealTimeThreadAsyncBridgeBufferControl *);
+    signalControl = NULL_PTR(RealTimeThreadAsyncBridgeSignalControl *);
+    numaNode = -1;
     ReferenceT < RegisteredMethodsMessageFilter > filter = ReferenceT < RegisteredMethodsMessageFilter > (GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -65,21 +66,13 @@ RealTimeThreadAsyncBridge::RealTimeThreadAsyncBridge() :
 }
 
 RealTimeThreadAsyncBridge::~RealTimeThreadAsyncBridge() {
-    if (spinlocksRead != NULL_PTR(volatile int32 *)) {
-        delete[] spinlocksRead;
-        spinlocksRead = NULL_PTR(volatile int32 *);
+    if (bufferControl != NULL_PTR(RealTimeThreadAsyncBridgeBufferControl *)) {
+        delete[] bufferControl;
+        bufferControl = NULL_PTR(RealTimeThreadAsyncBridgeBufferControl *);
     }
-    if (spinlocksWrite != NULL_PTR(FastPollingMutexSem *)) {
-        delete[] spinlocksWrite;
-        spinlocksWrite = NULL_PTR(FastPollingMutexSem *);
-    }
-    if (whatIsNewestCounter != NULL_PTR(uint32 *)) {
-        delete[] whatIsNewestCounter;
-        whatIsNewestCounter = NULL_PTR(uint32 *);
-    }
-    if (whatIsNewestGlobCounter != NULL_PTR(uint32 *)) {
-        delete[] whatIsNewestGlobCounter;
-        whatIsNewestGlobCounter = NULL_PTR(uint32 *);
+    if (signalControl != NULL_PTR(RealTimeThreadAsyncBridgeSignalControl *)) {
+        delete[] signalControl;
+        signalControl = NULL_PTR(RealTimeThreadAsyncBridgeSignalControl *);
     }
 }
 
@@ -103,14 +96,48 @@ bool RealTimeThreadAsyncBridge::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "NumberOfBuffers==1, use blocking mode");
         }
         uint32 resetTimeoutT;
-        if (!data.Read("ResetMSecTimeout", resetTimeoutT)) {
-            resetTimeout = TTInfiniteWait;
+        if (data.Read("ResetMSecTimeout", resetTimeoutT)) {
+            REPORT_ERROR(ErrorManagement::Information, "ResetMSecTimeout is no longer needed and will be ignored");
+        }
+    }
+    if (ret) {
+        if (!data.Read("NUMANode", numaNode)) {
+            numaNode = -1;
+        }
+        ret = (numaNode < static_cast<int32>(REAL_TIME_THREAD_ASYNC_BRIDGE_MAX_NUMA_NODES));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "NUMANode shall be < %d", REAL_TIME_THREAD_ASYNC_BRIDGE_MAX_NUMA_NODES);
         }
     }
 
     return ret;
 }
 
+bool RealTimeThreadAsyncBridge::AllocateMemory() {
+    bool ret = MemoryDataSourceI::AllocateMemory();
+    if ((ret) && (numaNode >= 0) && (totalMemorySize > 0u)) {
+        //Only the pages fully contained in the buffers can be moved without touching the neighbouring allocations.
+        uintp pageSize = static_cast<uintp>(sysconf(_SC_PAGESIZE));
+        /*lint -e{923} -e{9091} pointer to integer conversion required to compute the page boundaries.*/
+        uintp start = reinterpret_cast<uintp>(memory);
+        uintp alignedStart = ((start + pageSize) - 1u) & ~(pageSize - 1u);
+        uintp alignedEnd = (start + totalMemorySize) & ~(pageSize - 1u);
+        if (alignedEnd > alignedStart) {
+            unsigned long nodeMask = (1ul << static_cast<uint32>(numaNode));
+            /*lint -e{923} -e{9091} integer to pointer conversion required by mbind.*/
+            long err = syscall(SYS_mbind, reinterpret_cast<void *>(alignedStart), static_cast<unsigned long>(alignedEnd - alignedStart), MPOL_PREFERRED, &nodeMask,
+                               static_cast<unsigned long>(REAL_TIME_THREAD_ASYNC_BRIDGE_MAX_NUMA_NODES + 1u), MPOL_MF_MOVE);
+            if (err != 0) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not bind the buffers to the NUMA node %d", numaNode);
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::Warning, "The buffers are smaller than one page and will be placed by first touch");
+        }
+    }
+    return ret;
+}
+
 /*lint -e{715} symbols not referenced.*/
 /*lint -e{613} null pointer checked before.*/
 bool RealTimeThreadAsyncBridge::PrepareNextState(const char8 * const currentStateName,
@@ -164,41 +191,26 @@ bool RealTimeThreadAsyncBridge::SetConfiguredDatabase(StructuredDataI & data) {
     }
 
     if (ret) {
-        if (spinlocksRead == NULL_PTR(volatile int32 *)) {
+        if (bufferControl == NULL_PTR(RealTimeThreadAsyncBridgeBufferControl *)) {
             uint32 index = (numberOfSignals * numberOfBuffers);
-            spinlocksRead = new volatile int32[index];
-            ret = (spinlocksRead != NULL_PTR(volatile int32 *));
+            bufferControl = new RealTimeThreadAsyncBridgeBufferControl[index];
+            ret = (bufferControl != NULL_PTR(RealTimeThreadAsyncBridgeBufferControl *));
         }
         if (ret) {
-            if (spinlocksWrite == NULL) {
-                uint32 index = (numberOfSignals * numberOfBuffers);
-                spinlocksWrite = new FastPollingMutexSem[index];
-                ret = (spinlocksWrite != NULL_PTR(FastPollingMutexSem *));
-            }
-        }
-        if (ret) {
-
-            if (whatIsNewestCounter == NULL) {
-                uint32 index = (numberOfSignals * numberOfBuffers);
-                whatIsNewestCounter = new uint32[index];
-                ret = (whatIsNewestCounter != NULL_PTR(uint32 *));
-            }
-        }
-        if (ret) {
-
-            if (whatIsNewestGlobCounter == NULL) {
-                whatIsNewestGlobCounter = new uint32[numberOfSignals];
-                ret = (whatIsNewestGlobCounter != NULL_PTR(uint32 *));
+            if (signalControl == NULL_PTR(RealTimeThreadAsyncBridgeSignalControl *)) {
+                signalControl = new RealTimeThreadAsyncBridgeSignalControl[numberOfSignals];
+                ret = (signalControl != NULL_PTR(RealTimeThreadAsyncBridgeSignalControl *));
             }
         }
         if (ret) {
             uint32 numberOfElements = (numberOfSignals * numberOfBuffers);
             for (uint32 i = 0u; i < numberOfElements; i++) {
-                spinlocksRead[i] = 0;
-                spinlocksWrite[i].Create(false);
-                whatIsNewestCounter[i] = 0u;
+                bufferControl[i].readers = 0;
+                bufferControl[i].writeSem.Create(false);
+                bufferControl[i].writeLock = 0;
                 if (i < numberOfSignals) {
-                    whatIsNewestGlobCounter[i] = 0u;
+                    //The first write goes to the buffer 0
+                    signalControl[i].newest = static_cast<int32>(numberOfBuffers - 1u);
                 }
             }
         }
@@ -217,41 +229,18 @@ bool RealTimeThreadAsyncBridge::GetInputOffset(const uint32 signalIdx,
 
     bool ok = false;
     if (blockingMode != 0u) {
-        if (spinlocksWrite[signalIdx].FastLock() == ErrorManagement::NoError) {
-            Atomic::Increment(&spinlocksRead[signalIdx]);
-            spinlocksWrite[signalIdx].FastUnLock();
+        if (bufferControl[signalIdx].writeSem.FastLock() == ErrorManagement::NoError) {
+            Atomic::Increment(&bufferControl[signalIdx].readers);
+            bufferControl[signalIdx].writeSem.FastUnLock();
             offset = 0u;
             ok = true;
         }
     }
     else {
-        //possibly give a chance to all buffers
-        for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
-            //check the last written
-            uint32 bufferIdx = 0u;
-            uint32 max = 0u;
-            for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-                uint32 index = (signalIdx * numberOfBuffers) + h;
-                if (spinlocksWrite[index].FastTryLock()) {
-                    uint32 tempMax = whatIsNewestCounter[index];
-                    spinlocksWrite[index].FastUnLock();
-                    if (tempMax > max) {
-                        max = tempMax;
-                        bufferIdx = h;
-                    }
-                }
-            }
-
-            ok = false;
-            //try to lock the next buffer to write
-            uint32 index = (signalIdx * numberOfBuffers) + bufferIdx;
-
-            if (spinlocksWrite[index].FastTryLock()) {
-                Atomic::Increment(&spinlocksRead[index]);
-                spinlocksWrite[index].FastUnLock();
-                offset = (signalSize[signalIdx] * bufferIdx);
-                ok = true;
-            }
+        uint32 bufferIdx = 0u;
+        ok = AcquireNewest(signalIdx, bufferIdx);
+        if (ok) {
+            offset = (signalSize[signalIdx] * bufferIdx);
         }
     }
 
@@ -265,56 +254,52 @@ bool RealTimeThreadAsyncBridge::GetOutputOffset(const uint32 signalIdx,
                                                  uint32 &offset) {
     bool ok = false;
     if (blockingMode != 0u) {
-        if (spinlocksWrite[signalIdx].FastLock() == ErrorManagement::NoError) {
+        if (bufferControl[signalIdx].writeSem.FastLock() == ErrorManagement::NoError) {
             //wait for the reader to finish
-            while (spinlocksRead[signalIdx] > 0) {
+            while (bufferControl[signalIdx].readers > 0) {
             }
             ok = true;
             offset = 0u;
         }
     }
     else {
-
-        for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
-            //check the oldest written
-            uint32 min = 0xFFFFFFFFu;
-            uint32 max = 0u;
-            uint32 bufferIdx = 0u;
-            uint32 newestBuffer = 0u;
-            for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-                uint32 index = (signalIdx * numberOfBuffers) + h;
-                if (spinlocksWrite[index].FastTryLock()) {
-                    uint32 temp = whatIsNewestCounter[index];
-                    spinlocksWrite[index].FastUnLock();
-                    if (temp < min) {
-                        min = temp;
-                        bufferIdx = h;
-                    }
-                    if (temp > max) {
-                        max = temp;
-                        newestBuffer = h;
-                    }
-                }
-            }
-            ok = false;
-            //try to lock the next buffer to write
+        uint32 newest = static_cast<uint32>(signalControl[signalIdx].newest);
+        //Write on the oldest buffer first (the one after the newest), never on the newest if there is more than one buffer
+        uint32 numberOfCandidates = numberOfBuffers;
+        uint32 firstCandidate = 0u;
+        if (numberOfBuffers > 1u) {
+            numberOfCandidates = (numberOfBuffers - 1u);
+            firstCandidate = (newest + 1u);
+        }
+        uint32 bufferIdx = 0u;
+        for (uint32 k = 0u; (k < numberOfCandidates) && (!ok); k++) {
+            bufferIdx = ((firstCandidate + k) % numberOfBuffers);
             uint32 index = (signalIdx * numberOfBuffers) + bufferIdx;
-            if (spinlocksWrite[index].FastTryLock()) {
-                if (spinlocksRead[index] == 0) {
-                    offset = (signalSize[signalIdx] * bufferIdx);
-                    uint32 newestOffset = (signalSize[signalIdx] * newestBuffer);
-                    uint32 newestIndex = (signalIdx * numberOfBuffers) + newestBuffer;
-                    //needed in case of ranges
-                    if (spinlocksWrite[newestIndex].FastTryLock()) {
-                        uint32 destOffset = signalOffsets[signalIdx] + offset; 
-                        uint32 srcOffset = signalOffsets[signalIdx] + newestOffset; 
-                        (void) MemoryOperationsHelper::Copy(&memory[destOffset], &memory[srcOffset], signalSize[signalIdx]);
-                        spinlocksWrite[newestIndex].FastUnLock();
-                    }
-                    ok = true;
+            if (Atomic::TestAndSet(&bufferControl[index].writeLock)) {
+                //The readers increment their counter before checking writeLock, so that either they see the lock or the writer sees them.
+                //The newest buffer is checked first: once taken, a buffer can only become the newest when this writer publishes it.
+                ok = true;
+                if (numberOfBuffers > 1u) {
+                    ok = (static_cast<uint32>(signalControl[signalIdx].newest) != bufferIdx);
+                }
+                if (ok) {
+                    ok = (bufferControl[index].readers == 0);
                 }
-                else {
-                    spinlocksWrite[index].FastUnLock();
+                if (!ok) {
+                    bufferControl[index].writeLock = 0;
+                }
+            }
+        }
+        if (ok) {
+            offset = (signalSize[signalIdx] * bufferIdx);
+            //needed in case of ranges
+            uint32 sourceIdx = 0u;
+            if (numberOfBuffers > 1u) {
+                if (AcquireNewest(signalIdx, sourceIdx)) {
+                    uint32 destOffset = signalOffsets[signalIdx] + offset;
+                    uint32 srcOffset = signalOffsets[signalIdx] + (signalSize[signalIdx] * sourceIdx);
+                    (void) MemoryOperationsHelper::Copy(&memory[destOffset], &memory[srcOffset], signalSize[signalIdx]);
+                    Atomic::Decrement(&bufferControl[(signalIdx * numberOfBuffers) + sourceIdx].readers);
                 }
             }
         }
@@ -331,7 +316,7 @@ bool RealTimeThreadAsyncBridge::TerminateInputCopy(const uint32 signalIdx,
 
     uint32 buffNumber = (offset / signalSize[signalIdx]);
     uint32 index = (signalIdx * numberOfBuffers) + buffNumber;
-    Atomic::Decrement(&spinlocksRead[index]);
+    Atomic::Decrement(&bufferControl[index].readers);
     return true;
 }
 
@@ -343,41 +328,37 @@ bool RealTimeThreadAsyncBridge::TerminateOutputCopy(const uint32 signalIdx,
     uint32 buffNumber = (offset / signalSize[signalIdx]);
 
     uint32 index = (signalIdx * numberOfBuffers) + buffNumber;
-    whatIsNewestGlobCounter[signalIdx]++;
-    whatIsNewestCounter[index] = whatIsNewestGlobCounter[signalIdx];
-
-    //overflow... subtract the smaller one
-    if (whatIsNewestGlobCounter[signalIdx] == 0u) {
-
-        uint32 min = 0xFFFFFFFFu;
-        for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-            if (h != buffNumber) {
-                uint32 index1 = (signalIdx * numberOfBuffers) + h;
-                if (whatIsNewestCounter[index1] < min) {
-                    min = whatIsNewestCounter[index1];
-                }
-            }
+    if (blockingMode != 0u) {
+        bufferControl[index].writeSem.FastUnLock();
+    }
+    else {
+        //Publish the buffer before releasing it, so that no other writer can take it before it is the newest
+        (void) Atomic::Exchange(&signalControl[signalIdx].newest, static_cast<int32>(buffNumber));
+        bufferControl[index].writeLock = 0;
+    }
 
-        }
+    return true;
+}
 
-        for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-            uint32 index1 = (signalIdx * numberOfBuffers) + h;
-            if (h != buffNumber) {
-                bool blocked = spinlocksWrite[index1].FastLock(resetTimeout);
-                if (blocked) {
-                    whatIsNewestCounter[index1] -= min;
-                    spinlocksWrite[index1].FastUnLock();
-                }
-            }
+/*lint -e{613} null pointer checked before.*/
+bool RealTimeThreadAsyncBridge::AcquireNewest(const uint32 signalIdx,
+                                              uint32 &bufferIdx) {
+    bool ok = false;
+    //Bounded number of attempts: a retry only happens if the newest buffer changed while being acquired
+    for (uint32 k = 0u; (k <= numberOfBuffers) && (!ok); k++) {
+        bufferIdx = static_cast<uint32>(signalControl[signalIdx].newest);
+        uint32 index = (signalIdx * numberOfBuffers) + bufferIdx;
+        Atomic::Increment(&bufferControl[index].readers);
+        ok = (bufferControl[index].writeLock == 0);
+        if ((!ok) && (numberOfBuffers > 1u)) {
+            //Still the newest: either being published (complete) or taken by a writer which will release it without writing
+            ok = (static_cast<uint32>(signalControl[signalIdx].newest) == bufferIdx);
+        }
+        if (!ok) {
+            Atomic::Decrement(&bufferControl[index].readers);
         }
-
-        whatIsNewestGlobCounter[signalIdx] -= min;
-        whatIsNewestCounter[index] -= min;
-
     }
-    spinlocksWrite[index].FastUnLock();
-
-    return true;
+    return ok;
 }
 
 const char8 *RealTimeThreadAsyncBridge::GetBrokerName(StructuredDataI &data,
@@ -419,11 +400,7 @@ ErrorManagement::ErrorType RealTimeThreadAsyncBridge::ResetSignalValue() {
                 ret = MemoryOperationsHelper::Set(thisSignalMemory, '\0', (size * numberOfBuffers));
             }
         }
-        for(uint32 j=0u; j<numberOfBuffers; j++){
-            uint32 index= (numberOfBuffers * i) + j;
-            whatIsNewestCounter[index] = 0u;
-        }
-        whatIsNewestGlobCounter[i]=0u;
+        signalControl[i].newest = static_cast<int32>(numberOfBuffers - 1u);
     }
     err = !ret;
     return err;
@@ -41,15 +41,78 @@
 
 namespace MARTe {
 
+/**
+ * The size of the cache line on which the control words of each buffer and of each signal are placed.
+ */
+const uint32 REAL_TIME_THREAD_ASYNC_BRIDGE_CACHE_LINE_SIZE = 64u;
+
+/**
+ * The maximum number of NUMA nodes which can be configured with NUMANode.
+ */
+const uint32 REAL_TIME_THREAD_ASYNC_BRIDGE_MAX_NUMA_NODES = 64u;
+
+/**
+ * @brief The control words of one buffer of one signal, padded to a cache line so that the readers and the writers
+ * of different buffers and signals do not invalidate each other's lines.
+ */
+struct RealTimeThreadAsyncBridgeBufferControl {
+    /**
+     * Denotes the current number of readers of the buffer.
+     */
+    volatile int32 readers;
+
+    /**
+     * Set (with an atomic test-and-set) while the buffer is being written.
+     */
+    volatile int32 writeLock;
+
+    /**
+     * A semaphore to lock the buffer that is going to be written (BlockingMode).
+     */
+    FastPollingMutexSem writeSem;
+
+    /**
+     * Fills the rest of the cache line.
+     */
+    char8 padding[REAL_TIME_THREAD_ASYNC_BRIDGE_CACHE_LINE_SIZE - (((2u * sizeof(int32)) + sizeof(FastPollingMutexSem)) % REAL_TIME_THREAD_ASYNC_BRIDGE_CACHE_LINE_SIZE)];
+};
+
+/**
+ * @brief The control word of one signal, padded to a cache line.
+ */
+struct RealTimeThreadAsyncBridgeSignalControl {
+    /**
+     * The index of the newest written buffer of the signal.
+     */
+    volatile int32 newest;
+
+    /**
+     * Fills the rest of the cache line.
+     */
+    char8 padding[REAL_TIME_THREAD_ASYNC_BRIDGE_CACHE_LINE_SIZE - sizeof(int32)];
+};
+
 /**
  * @brief Allows to share asynchronously signals among two or more real time threads.
  *
  * @details For each signal, the writer GAM finds the oldest available buffer written to write on and after the write operation
- * it sets it as the newest. The reader GAMs attempt to read on the newest written available buffer. The mutual access between readers and
- * writer is guaranteed by spinlock semaphores, one for each buffer of each signal. If no buffer is available for the writer, the GetOutputOffset
- * function returns false. The same happens if there is no buffer available for the reader (impossible if more than one buffer has been declared),
+ * it sets it as the newest. The reader GAMs attempt to read on the newest written available buffer.
+ *
+ * The index of the newest buffer of each signal is a single atomic variable. A reader loads it, increments the number of readers of
+ * that buffer and checks that the buffer is not being written or is still the newest (otherwise it decrements the number of readers and
+ * retries, which only happens if the buffer was taken by a writer after being replaced as the newest). A writer takes a buffer other than the newest with
+ * an atomic test-and-set and checks that it has no readers. As both sides first announce themselves and then check the other, a buffer
+ * is never read and written at the same time; neither side spins nor blocks, and the cost does not depend on the number of buffers.
+ * When the write is terminated the buffer is published as the newest with an atomic exchange.
+ * If no buffer is available for the writer, the GetOutputOffset function returns false. The same happens if there is no buffer available
+ * for the reader (impossible if more than one buffer has been declared, unless the writer publishes faster than the reader can acquire),
  * in this case the GetInputOffset returns false.
  *
+ * The control words of each buffer and of each signal are padded to a cache line, so that the threads which share different
+ * signals or buffers do not invalidate each other's cache lines.
+ * If NUMANode is set, the signal buffers are moved to that NUMA node (typically the node of the writer thread); otherwise they are placed
+ * by the operating system on first touch. Pages which are only partially occupied by the buffers are not moved.
+ *
  * The RPC method ResetSignalValue allows to reset all the signal values.
  *
   * <pre>
@@ -58,11 +121,8 @@ namespace MARTe {
  *    NumberOfBuffers = 3 //Optional but < 64. Default = 1. Each buffer contains a copy of each signal.
  *    HeapName = "Default" //Optional. Default = GlobalObjectsDatabase::Instance()->GetStandardHeap();
  *    BlockingMode = 0 //Optional. Default = 0. NumberOfBuffers will be set to 1 and a spinlock mutex is used for synchronization on the shared signals
- *    ResetMSecTimeout = 1 //Optional. Default = TTInfiniteWait. The TerminateOutputCopy function can block when the counter used to newest written buffer overflows and needs to be reset.
- *                                                               If the reader should wait for this counter to be properly reset then the ResetMSecTimeout should
- *                                                               be increased to a large number. If instead the reader does not mind to get oldest buffer (instead of the newest) while this reset operation
- *                                                               is being performed, the ResetMSecTimeout should be set to 0.
- *                                                               This overflow will occur every 2**32-1 writes, which at e.g. 1 kHz frequency, will occur every ~49 days).
+ *    ResetMSecTimeout = 1 //Optional. Ignored (kept for compatibility: the newest buffer is no longer identified by a write counter which can overflow).
+ *    NUMANode = 1 //Optional but < 64. Default = -1 (first touch). NUMA node where the signal buffers are placed (Linux only).
  *    Signals = {
  *        +*NAME = {
  *            +Type = BasicType|StructuredType
@@ -92,14 +152,17 @@ RealTimeThreadAsyncBridge    ();
      * @see DataSourceI::Initialise
      * @details Checks that (NumberOfBuffers < 64) .
      *   NumberOfBuffers = N (<64)\n
-     *   ResetMSecTimeout = msec (the TerminateOutputCopy can block when the counter used to denote the oldest and newest written buffer
-     *   overflows and needs to be reset. If the read should wait for this counter to be properly reset then the ResetMSecTimeout should
-     *   be increased to a large number. If instead the reader does not mind to get oldest buffer (instead of the newest) while this reset operation
-     *    is being performed, the ResetMSecTimeout should be set to 0.
-     *   This overflow will occur every 2**32-1 writes, which at e.g. 1 kHz frequency, will occur every ~49 days).
+     *   ResetMSecTimeout = msec (ignored)\n
+     *   NUMANode = node (<64)
      */
     virtual bool Initialise(StructuredDataI &data);
 
+    /**
+     * @see MemoryDataSourceI::AllocateMemory
+     * @details If NUMANode was set, moves the pages of the signal buffers to that node (failures are only reported as warnings).
+     */
+    virtual bool AllocateMemory();
+
     /**
      * @brief Allocates the memory for the state variables.
      * @details Checks that the signals have not defined the "Samples" field, because this data source does not support samples.
@@ -126,17 +189,18 @@ RealTimeThreadAsyncBridge    ();
 
     /**
      * @see DataSourceI::GetInputOffset
-     * @details Checks the last written available buffer and returns its offset. The atomic variable \a spinlocksRead, denoting the number
+     * @details Checks the last written available buffer and returns its offset. The atomic variable \a readers, denoting the number
      * of readers on that buffer is incremented. The writer can not write on that buffer if this atomic variable is greater than zero.
-     * @return false if no buffer is available. This happens only if only one buffer is defined and the writer is writing on it.
+     * @return false if no buffer is available. This happens only if only one buffer is defined and the writer is writing on it
+     * (or if the newest buffer was replaced and taken by the writer at every attempt).
      */
     virtual bool GetInputOffset(const uint32 signalIdx,
             const uint32 numberOfSamples, uint32 &offset);
 
     /**
      * @see DataSourceI::GetOutputOffset
-     * @details Checks the oldest written available buffer and returns its offset. the semaphore \a spinlocksWrite, is locked
-     * on that buffer. The readers can not read on that buffer while the semaphore is locked.
+     * @details Checks the oldest written available buffer and returns its offset. The atomic variable \a writeLock is set
+     * on that buffer (\a writeSem in BlockingMode). The readers can not read on that buffer while it is set.
      * @return false if no buffer is available because the readers are using all of them.
      */
     virtual bool GetOutputOffset(const uint32 signalIdx,
@@ -144,16 +208,15 @@ RealTimeThreadAsyncBridge    ();
 
     /**
      * @see DataSourceI::TerminateInputCopy
-     * @details Decrements the atomic variable \a spinlocksRead for the buffer that has just been read.
+     * @details Decrements the atomic variable \a readers for the buffer that has just been read.
      */
     virtual bool TerminateInputCopy(const uint32 signalIdx, const uint32 offset,
             const uint32 numberOfSamples);
 
     /**
      * @see DataSourceI::TerminateOutputCopy
-     * @details If all the write operations for the signal \a signalIdx have been terminated, it increments the
-     * \a whatIsNewestCounter setting the buffer as the last written. The spinlocksWrite variable is unlocked for the
-     * buffer that have just been written.
+     * @details Sets the buffer that has just been written as the newest (\a newest) and then releases it (\a writeLock,
+     * or \a writeSem in BlockingMode).
      */
     virtual bool TerminateOutputCopy(const uint32 signalIdx,
             const uint32 offset, const uint32 numberOfSamples);
@@ -172,30 +235,28 @@ RealTimeThreadAsyncBridge    ();
 protected:
 
     /**
-     * Denoted the current number of readers for each buffer.
-     */
-    volatile int32 *spinlocksRead;
-
-    /**
-     * A semaphore to lock the buffer that is going to be written.
+     * @brief Increments the number of readers of the newest buffer of \a signalIdx, if it is not being written.
+     * @param[in] signalIdx the signal index.
+     * @param[out] bufferIdx the newest buffer.
+     * @return true if the buffer was acquired.
      */
-    FastPollingMutexSem *spinlocksWrite;
+    bool AcquireNewest(const uint32 signalIdx,
+                       uint32 &bufferIdx);
 
     /**
-     * Used to denote the oldest and newest written buffers
+     * The control words of each buffer of each signal (signal * numberOfBuffers + buffer).
      */
-    uint32 *whatIsNewestCounter;
+    RealTimeThreadAsyncBridgeBufferControl *bufferControl;
 
     /**
-     * The counter incremented for each signal at the end of the write operation
+     * The control word of each signal.
      */
-    uint32 *whatIsNewestGlobCounter;
+    RealTimeThreadAsyncBridgeSignalControl *signalControl;
 
     /**
-     * The timeout in millisecs to lock the other \a spinlocksWrite semaphores
-     * in case of overflow of \a whatIsNewestCounter (to avoid a priority inversion)
+     * The NUMA node of the signal buffers (-1 for first touch).
      */
-    TimeoutType resetTimeout;
+    int32 numaNode;
 
     /**
      * TODO
@@ -30,7 +30,9 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "CompilerTypes.h"
+#include "HighResolutionTimer.h"
 #include "RealTimeThreadSynchBroker.h"
+#include "RealTimeThreadSynchWait.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -54,11 +56,24 @@ RealTimeThreadSynchBroker::RealTimeThreadSynchBroker() :
     currentSample = 0u;
     dataSource = NULL_PTR(DataSourceI *);
     waitForNext = 0u;
-    mux.Create();
+    completedCycles = 0;
+    consumedCycles = 0;
+    generation = NULL_PTR(volatile int32 *);
+    sleepingConsumers = NULL_PTR(volatile int32 *);
+    spinTicks = 0u;
+    nonBlocking = false;
+    samplesCount = 0u;
+    ringMemory = NULL_PTR(char8 **);
+    ringCapacity = 0u;
+    writtenSamples = 0u;
+    writeSlot = 0u;
+    readSamples = 0u;
+    readSlot = 0u;
+    lostSamples = 0u;
 }
 
-/*lint -e{1551} -e{1740} must free the allocated memory in the destructor and close the semaphore. The dataSourceMemory,
- * the dataSourceMemoryOffsets are freed by the DataSourceI not by the broker. The dataSource is freed by the framework.*/
+/*lint -e{1551} -e{1740} must free the allocated memory in the destructor and close the semaphore. The dataSourceMemory, the dataSourceMemoryOffsets
+ * and the generation are freed by the DataSourceI not by the broker. The dataSource is freed by the framework.*/
 RealTimeThreadSynchBroker::~RealTimeThreadSynchBroker() {
     if (signalMemory != NULL_PTR(char8 **)) {
         uint32 s;
@@ -69,24 +84,48 @@ RealTimeThreadSynchBroker::~RealTimeThreadSynchBroker() {
         }
         delete[] signalMemory;
     }
+    if (ringMemory != NULL_PTR(char8 **)) {
+        uint32 s;
+        for (s = 0u; s < numberOfDataSourceSignals; s++) {
+            if (ringMemory[s] != NULL_PTR(char8 *)) {
+                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(ringMemory[s]));
+            }
+        }
+        delete[] ringMemory;
+    }
     if (signalSize != NULL_PTR(uint32 *)) {
         delete[] signalSize;
     }
-
-    (void) synchSem.Post();
     (void) synchSem.Close();
 }
 
-void RealTimeThreadSynchBroker::SetFunctionIndex(DataSourceI * const dataSourceIn, const uint32 functionIdxIn, const TimeoutType & timeoutIn, const uint8 waitForNextIn) {
+void RealTimeThreadSynchBroker::SetFunctionIndex(DataSourceI * const dataSourceIn, const uint32 functionIdxIn, const TimeoutType & timeoutIn, const uint8 waitForNextIn,
+                                                 volatile int32 * const generationIn, volatile int32 * const sleepingConsumersIn, const uint32 spinTimeUsecIn) {
     dataSource = dataSourceIn;
     functionIdx = functionIdxIn;
     timeout = timeoutIn;
     waitForNext = waitForNextIn;
+    generation = generationIn;
+    sleepingConsumers = sleepingConsumersIn;
+    spinTicks = (static_cast<uint64>(spinTimeUsecIn) * HighResolutionTimer::Frequency()) / 1000000u;
     if (dataSource != NULL_PTR(DataSourceI *)) {
         (void) dataSource->GetFunctionName(functionIdx, gamName);
     }
 }
 
+void RealTimeThreadSynchBroker::SetNonBlocking(const char8 * const countSignalIn) {
+    nonBlocking = true;
+    countSignalName = countSignalIn;
+}
+
+bool RealTimeThreadSynchBroker::IsNonBlocking() const {
+    return nonBlocking;
+}
+
+uint32 RealTimeThreadSynchBroker::GetNumberOfLostSamples() const {
+    return lostSamples;
+}
+
 bool RealTimeThreadSynchBroker::AllocateMemory(char8 * const dataSourceMemoryIn, uint32 * const dataSourceMemoryOffsetsIn) {
     bool ok = false;
     if (dataSource != NULL_PTR(DataSourceI *)) {
@@ -102,38 +141,82 @@ bool RealTimeThreadSynchBroker::AllocateMemory(char8 * const dataSourceMemoryIn,
         }
         ok = dataSource->GetFunctionNumberOfSignals(InputSignals, functionIdx, numberOfFunctionSignals);
         if (ok) {
+            bool countSignalFound = false;
             for (s = 0u; (s < numberOfFunctionSignals) && (ok); s++) {
-                uint32 numberOfSamplesRead;
-                ok = dataSource->GetFunctionSignalSamples(InputSignals, functionIdx, s, numberOfSamplesRead);
-                if (numberOfSamples == 0u) {
-                    numberOfSamples = numberOfSamplesRead;
+                StreamString functionSignalAlias;
+                ok = dataSource->GetFunctionSignalAlias(InputSignals, functionIdx, s, functionSignalAlias);
+                uint32 signalIdx = 0u;
+                if (ok) {
+                    ok = dataSource->GetSignalIndex(signalIdx, functionSignalAlias.Buffer());
                 }
+                uint32 numberOfSamplesRead = 0u;
                 if (ok) {
-                    ok = (numberOfSamples == numberOfSamplesRead);
+                    ok = dataSource->GetFunctionSignalSamples(InputSignals, functionIdx, s, numberOfSamplesRead);
+                }
+                bool isCountSignal = false;
+                if ((ok) && (nonBlocking) && (countSignalName.Size() > 0u)) {
+                    isCountSignal = (functionSignalAlias == countSignalName);
+                }
+                if (isCountSignal) {
+                    //Written by the broker and not by the producer
+                    ok = ((numberOfSamplesRead == 1u) && (dataSource->GetSignalType(signalIdx) == UnsignedInteger32Bit));
                     if (!ok) {
-                        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "The number of samples shall be the same for all signals (%d != %d)", numberOfSamples, numberOfSamplesRead);
+                        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "The count signal %s shall be one sample of one uint32", countSignalName.Buffer());
                     }
+                    countSignalFound = ok;
                 }
-                StreamString functionSignalAlias;
-                if (ok) {
-                    ok = dataSource->GetFunctionSignalAlias(InputSignals, functionIdx, s, functionSignalAlias);
+                else {
+                    if (numberOfSamples == 0u) {
+                        numberOfSamples = numberOfSamplesRead;
+                    }
+                    if (ok) {
+                        ok = (numberOfSamples == numberOfSamplesRead);
+                        if (!ok) {
+                            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "The number of samples shall be the same for all signals (%d != %d)", numberOfSamples, numberOfSamplesRead);
+                        }
+                    }
+                    if (ok) {
+                        uint32 signalSizeRead;
+                        ok = dataSource->GetSignalByteSize(signalIdx, signalSizeRead);
+                        signalSize[signalIdx] = signalSizeRead;
+                    }
+                    //The memory has to be reordered so that each signal can store the numberOfSamples required.
+                    if (ok) {
+                        signalMemory[signalIdx] = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(signalSize[signalIdx] * numberOfSamples));
+                    }
                 }
-                uint32 signalIdx = 0u;
-                if (ok) {
-                    ok = dataSource->GetSignalIndex(signalIdx, functionSignalAlias.Buffer());
+            }
+            if ((ok) && (nonBlocking)) {
+                if (countSignalName.Size() > 0u) {
+                    ok = countSignalFound;
+                    if (!ok) {
+                        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "The count signal %s is not read by %s", countSignalName.Buffer(), gamName.Buffer());
+                    }
                 }
-                if (ok) {
-                    uint32 signalSizeRead;
-                    ok = dataSource->GetSignalByteSize(s, signalSizeRead);
-                    signalSize[signalIdx] = signalSizeRead;
+            }
+            //The ring holds twice the maximum number of samples read so that a late consumer does not lose samples
+            if ((ok) && (nonBlocking)) {
+                ok = (numberOfSamples > 0u);
+                if (!ok) {
+                    REPORT_ERROR_STATIC(ErrorManagement::FatalError, "%s shall read at least one signal besides the count signal", gamName.Buffer());
                 }
-                //The memory has to be reordered so that each signal can store the numberOfSamples required.
-                if (ok) {
-                    signalMemory[signalIdx] = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(signalSize[signalIdx] * numberOfSamples));
+            }
+            if ((ok) && (nonBlocking)) {
+                ringCapacity = (2u * numberOfSamples);
+                ringMemory = new char8*[numberOfDataSourceSignals];
+                for (s = 0u; s < numberOfDataSourceSignals; s++) {
+                    ringMemory[s] = NULL_PTR(char8 *);
+                    if (signalMemory[s] != NULL_PTR(char8 *)) {
+                        ringMemory[s] = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(signalSize[s] * ringCapacity));
+                        ok = (ringMemory[s] != NULL_PTR(char8 *)) && (ok);
+                    }
                 }
             }
         }
     }
+    if (ok) {
+        ok = (generation != NULL_PTR(volatile int32 *)) && (sleepingConsumers != NULL_PTR(volatile int32 *));
+    }
     if (ok) {
         ok = synchSem.Create();
     }
@@ -147,7 +230,13 @@ bool RealTimeThreadSynchBroker::GetSignalMemoryBuffer(const uint32 signalIdx, vo
     bool ok = (signalMemory != NULL_PTR(char8 **));
     if (ok) {
         /*lint -e{613} signalMemory cannot be NULL as otherwise ok = false*/
-        signalAddress = reinterpret_cast<void *>(&signalMemory[signalIdx][0u]);
+        if (signalMemory[signalIdx] != NULL_PTR(char8 *)) {
+            signalAddress = reinterpret_cast<void *>(&signalMemory[signalIdx][0u]);
+        }
+        else {
+            //The count signal
+            signalAddress = reinterpret_cast<void *>(const_cast<uint32 *>(&samplesCount));
+        }
     }
     return ok;
 }
@@ -155,59 +244,186 @@ bool RealTimeThreadSynchBroker::GetSignalMemoryBuffer(const uint32 signalIdx, vo
 bool RealTimeThreadSynchBroker::AddSample() {
     bool ok = false;
     uint32 s;
-    for (s = 0u; s < numberOfDataSourceSignals; s++) {
-        /*lint -e{613} All the memory must have been successfully allocated. For performance reasons the memory allocation is not checked at every iteration.*/
-        if (signalMemory[s] != NULL_PTR(char8 *)) {
-            uint32 signalIdx = currentSample * signalSize[s];
-            void *destination = &signalMemory[s][signalIdx];
-            const void *source = &dataSourceMemory[dataSourceMemoryOffsets[s]];
-            ok = MemoryOperationsHelper::Copy(destination, source, signalSize[s]);
+    if (nonBlocking) {
+        for (s = 0u; s < numberOfDataSourceSignals; s++) {
+            /*lint -e{613} All the memory must have been successfully allocated. For performance reasons the memory allocation is not checked at every iteration.*/
+            if (ringMemory[s] != NULL_PTR(char8 *)) {
+                void *destination = &ringMemory[s][writeSlot * signalSize[s]];
+                const void *source = &dataSourceMemory[dataSourceMemoryOffsets[s]];
+                ok = MemoryOperationsHelper::Copy(destination, source, signalSize[s]);
+            }
+        }
+        writeSlot++;
+        if (writeSlot == ringCapacity) {
+            writeSlot = 0u;
         }
+        //The full barrier of the atomic add publishes the sample before the new count. Never waits for the consumer.
+        (void) RealTimeThreadSynchAtomicAdd(&writtenSamples, 1u);
     }
-    currentSample++;
-    if (currentSample == numberOfSamples) {
-        currentSample = 0u;
-        if(mux.FastLock() == ErrorManagement::NoError) {
+    else {
+        for (s = 0u; s < numberOfDataSourceSignals; s++) {
+            /*lint -e{613} All the memory must have been successfully allocated. For performance reasons the memory allocation is not checked at every iteration.*/
+            if (signalMemory[s] != NULL_PTR(char8 *)) {
+                uint32 signalIdx = currentSample * signalSize[s];
+                void *destination = &signalMemory[s][signalIdx];
+                const void *source = &dataSourceMemory[dataSourceMemoryOffsets[s]];
+                ok = MemoryOperationsHelper::Copy(destination, source, signalSize[s]);
+            }
+        }
+        currentSample++;
+        if (currentSample == numberOfSamples) {
+            currentSample = 0u;
+            //The full barrier of the atomic add publishes the samples before the new cycle
+            (void) RealTimeThreadSynchAtomicAdd(&completedCycles, 1);
+#ifndef REALTIMETHREADSYNCH_FUTEX
             ok = synchSem.Post();
+#endif
         }
-        mux.FastUnLock();
     }
     return ok;
 }
 
+bool RealTimeThreadSynchBroker::IsCycleCompleted() const {
+    //The non-blocking consumers never wait
+    return ((!nonBlocking) && (currentSample == 0u));
+}
+
 const char8 * const RealTimeThreadSynchBroker::GetGAMName() {
     return gamName.Buffer();
 }
 
-bool RealTimeThreadSynchBroker::Execute() {
+bool RealTimeThreadSynchBroker::WaitCycle() {
     bool ok = true;
-   
-    //First Reset 
-    if (waitForNext == 1u) {
-        if(mux.FastLock() == ErrorManagement::NoError) {
-            ok = synchSem.Reset();
+    uint64 startTicks = HighResolutionTimer::Counter();
+    uint64 elapsedTicks = 0u;
+    while ((completedCycles == consumedCycles) && (elapsedTicks < spinTicks)) {
+        elapsedTicks = HighResolutionTimer::Counter() - startTicks;
+    }
+    uint64 timeoutTicks = 0u;
+    if (timeout.IsFinite()) {
+        timeoutTicks = (static_cast<uint64>(timeout.GetTimeoutMSec()) * HighResolutionTimer::Frequency()) / 1000u;
+    }
+    while ((completedCycles == consumedCycles) && (ok)) {
+#ifdef REALTIMETHREADSYNCH_FUTEX
+        //The generation must be read before checking the cycle so that an AddSample in between makes the FUTEX_WAIT return immediately (EAGAIN)
+        /*lint -e{613} generation cannot be NULL as otherwise AllocateMemory would have failed.*/
+        int32 currentGeneration = *generation;
+        RealTimeThreadSynchMemoryBarrier();
+#else
+        //The semaphore must be reset before checking the cycle so that an AddSample in between leaves it posted
+        ok = synchSem.Reset();
+#endif
+        if ((completedCycles == consumedCycles) && (ok)) {
+            uint64 remainingTicks = 0u;
+            if (timeout.IsFinite()) {
+                elapsedTicks = HighResolutionTimer::Counter() - startTicks;
+                ok = (elapsedTicks < timeoutTicks);
+                if (ok) {
+                    remainingTicks = (timeoutTicks - elapsedTicks);
+                }
+            }
+            if (ok) {
+#ifdef REALTIMETHREADSYNCH_FUTEX
+                //The full barrier of the atomic add orders the announcement before the futex check of the generation (see RealTimeThreadSynchronisation::Synchronise)
+                /*lint -e{613} sleepingConsumers cannot be NULL as otherwise AllocateMemory would have failed.*/
+                (void) RealTimeThreadSynchAtomicAdd(sleepingConsumers, 1);
+                RealTimeThreadSynchFutexWait(generation, currentGeneration, remainingTicks);
+                /*lint -e{613} sleepingConsumers cannot be NULL as otherwise AllocateMemory would have failed.*/
+                (void) RealTimeThreadSynchAtomicAdd(sleepingConsumers, -1);
+#else
+                TimeoutType remaining = timeout;
+                if (timeout.IsFinite()) {
+                    remaining = TimeoutType(static_cast<uint32>(((remainingTicks * 1000u) / HighResolutionTimer::Frequency()) + 1u));
+                }
+                ok = (synchSem.Wait(remaining) == ErrorManagement::NoError);
+#endif
+            }
         }
-        mux.FastUnLock();
-        if (ok) {
-            ok = (synchSem.Wait(timeout) == ErrorManagement::NoError);
+    }
+    return ok;
+}
+
+bool RealTimeThreadSynchBroker::ExecuteNonBlocking() {
+    //The full barrier of the atomic read orders the count before the samples
+    const uint32 written = RealTimeThreadSynchAtomicAdd(&writtenSamples, 0u);
+    //The producer may be writing the slot of the sample written - ringCapacity
+    const uint32 maxAvailable = (ringCapacity - 1u);
+    uint32 available = (written - readSamples);
+    if (available > maxAvailable) {
+        lostSamples += (available - maxAvailable);
+        readSlot = ((readSlot + (available - maxAvailable)) % ringCapacity);
+        readSamples = (written - maxAvailable);
+        available = maxAvailable;
+    }
+    uint32 count = available;
+    if (count > numberOfSamples) {
+        count = numberOfSamples;
+    }
+    //At most two copies per signal (before and after the end of the ring)
+    uint32 firstCopy = (ringCapacity - readSlot);
+    if (firstCopy > count) {
+        firstCopy = count;
+    }
+    bool ok = true;
+    uint32 s;
+    for (s = 0u; (s < numberOfDataSourceSignals) && (ok); s++) {
+        /*lint -e{613} All the memory must have been successfully allocated. For performance reasons the memory allocation is not checked at every iteration.*/
+        if (ringMemory[s] != NULL_PTR(char8 *)) {
+            ok = MemoryOperationsHelper::Copy(&signalMemory[s][0u], &ringMemory[s][readSlot * signalSize[s]], firstCopy * signalSize[s]);
+            if ((ok) && (count > firstCopy)) {
+                ok = MemoryOperationsHelper::Copy(&signalMemory[s][firstCopy * signalSize[s]], &ringMemory[s][0u], (count - firstCopy) * signalSize[s]);
+            }
         }
     }
-    //First wait
-    else {
-        ok = (synchSem.Wait(timeout) == ErrorManagement::NoError);
-        if (ok) {
-            if(mux.FastLock() == ErrorManagement::NoError) {
-                ok = synchSem.Reset();
+    //Discard the samples which the producer overwrote during the copy
+    RealTimeThreadSynchMemoryBarrier();
+    const uint32 writtenAfter = writtenSamples;
+    uint32 overwritten = 0u;
+    if ((writtenAfter - readSamples) > maxAvailable) {
+        overwritten = ((writtenAfter - readSamples) - maxAvailable);
+        if (overwritten > count) {
+            overwritten = count;
+        }
+    }
+    if (overwritten > 0u) {
+        for (s = 0u; (s < numberOfDataSourceSignals) && (ok); s++) {
+            /*lint -e{613} All the memory must have been successfully allocated. For performance reasons the memory allocation is not checked at every iteration.*/
+            if (ringMemory[s] != NULL_PTR(char8 *)) {
+                ok = MemoryOperationsHelper::Move(&signalMemory[s][0u], &signalMemory[s][overwritten * signalSize[s]], (count - overwritten) * signalSize[s]);
             }
-            mux.FastUnLock();
         }
+        lostSamples += overwritten;
     }
+    readSamples += count;
+    readSlot = ((readSlot + count) % ringCapacity);
+    samplesCount = (count - overwritten);
     if (ok) {
         ok = MemoryMapInputBroker::Execute();
     }
     return ok;
 }
 
+bool RealTimeThreadSynchBroker::Execute() {
+    bool ok = true;
+    if (nonBlocking) {
+        ok = ExecuteNonBlocking();
+    }
+    else {
+        //First reset
+        if (waitForNext == 1u) {
+            consumedCycles = completedCycles;
+        }
+        //Then wait
+        ok = WaitCycle();
+        if (ok) {
+            RealTimeThreadSynchMemoryBarrier();
+            consumedCycles = completedCycles;
+            ok = MemoryMapInputBroker::Execute();
+        }
+    }
+    return ok;
+}
+
 CLASS_REGISTER(RealTimeThreadSynchBroker, "1.0")
 
 }
@@ -44,6 +44,19 @@ namespace MARTe {
  * @brief Input broker for the RealTimeThreadSynchronisation DataSourceI.
  * @details A MemoryMapInputBroker which will store in memory the required number of samples copies of the DataSourceI memory.
  * It will lock in Execute until the required number of samples are added by calling the AddSample method.
+ *
+ * The broker counts the completed sets of samples (\a completedCycles, written by the producer) and the sets already
+ *  consumed (\a consumedCycles). In Execute the consumer first busy spins on \a completedCycles for at most the configured spin time
+ *  and then sleeps on the futex word (generation counter) shared by all the brokers of the DataSourceI. The producer only enters the kernel
+ *  if there is at least one consumer sleeping, with a single FUTEX_WAKE for all of them (see RealTimeThreadSynchronisation::Synchronise).
+ *  The futex is only available on Linux (see RealTimeThreadSynchWait.h). On the other operating systems the consumer sleeps instead on an
+ *  EventSem of the broker, which the producer posts each time that the samples are completed.
+ *
+ * In the non-blocking mode (see SetNonBlocking) the producer writes each sample in a ring of 2 * N slots (where N is the number of samples
+ *  read by the consumer) and then increments \a writtenSamples, without ever waiting for the consumer. Execute never waits: it copies the
+ *  (at most N) oldest samples not yet read, writes their number in the count signal (if any) and leaves the others for the next cycle. If the
+ *  consumer is more than 2 * N - 1 samples late the oldest samples are lost (see GetNumberOfLostSamples), as well as the samples that the
+ *  producer overwrote while they were being copied.
  */
 class RealTimeThreadSynchBroker : public MemoryMapInputBroker {
 public:
@@ -64,15 +77,41 @@ public:
      * @param[in] functionIdxIn the index of the function in the DataSourceI.
      * @param[in] timeoutIn the maximum time to wait for the expected number of samples to be available.
      * @param[in] waitForNextIn if 1 first reset and then wait at the synchronisation point.
+     * @param[in] generationIn the futex word (generation counter) incremented by the DataSourceI when samples are completed.
+     * @param[in] sleepingConsumersIn the number of consumers sleeping on \a generationIn.
+     * @param[in] spinTimeUsecIn the maximum time (in microseconds) to busy spin before sleeping on \a generationIn.
+     */
+    void SetFunctionIndex(DataSourceI *dataSourceIn, uint32 functionIdxIn, const TimeoutType & timeoutIn, const uint8 waitForNextIn,
+                          volatile int32 *generationIn, volatile int32 *sleepingConsumersIn, const uint32 spinTimeUsecIn);
+
+    /**
+     * @brief Selects the non-blocking consume mode.
+     * @param[in] countSignalIn the alias of the (uint32, one sample) signal where the number of samples read is written (empty if none).
+     * @pre
+     *   AllocateMemory not yet called.
+     */
+    void SetNonBlocking(const char8 * const countSignalIn);
+
+    /**
+     * @brief Checks if the broker is in the non-blocking consume mode.
+     * @return true if SetNonBlocking was called.
      */
-    void SetFunctionIndex(DataSourceI *dataSourceIn, uint32 functionIdxIn, const TimeoutType & timeoutIn, const uint8 waitForNextIn);
+    bool IsNonBlocking() const;
+
+    /**
+     * @brief Gets the number of samples which were lost because the consumer was too late (non-blocking consume mode).
+     * @return the number of samples lost.
+     */
+    uint32 GetNumberOfLostSamples() const;
 
     /**
      * @brief Allocates memory to hold N copies of the dataSourceMemoryIn, where the N is the number of samples that are to be
      * stored by the signals allocated to this broker.
      * @param[in] dataSourceMemoryIn the RealTimeThreadSynchronisation DataSourceI memory holding the latest values.
      * @param[in] dataSourceMemoryOffsetsIn the signals offsets in the \a dataSourceMemoryIn.
-     * @return true if the number of samples is the same for all signals and if the memory could be successfully allocated.
+     * @details In the non-blocking consume mode also allocates the ring of 2 * N samples of each signal.
+     * @return true if the number of samples is the same for all signals (but the count signal, which shall be one uint32 sample)
+     * and if the memory could be successfully allocated.
      */
     bool AllocateMemory(char8 *dataSourceMemoryIn, uint32 *dataSourceMemoryOffsetsIn);
 
@@ -89,6 +128,12 @@ public:
      */
     bool AddSample();
 
+    /**
+     * @brief Checks if the last AddSample completed the number of samples expected by the consumer.
+     * @return true if the last AddSample completed the number of samples.
+     */
+    bool IsCycleCompleted() const;
+
     /**
      * @brief Gets the name of the GAM interacting with the DataSourceI that uses this broker instance.
      * @return the name of the GAM interacting with the DataSourceI that uses this broker instance.
@@ -98,11 +143,26 @@ public:
     /**
      * @brief Locks until the expected number of samples is written into this broker instance (see AddSample) and then copies the samples
      * using the MemoryMapInputBroker::Execute().
+     * @details Busy spins for at most the spin time and then sleeps on the futex word until the samples are completed or the timeout expires.
+     * In the non-blocking consume mode does not wait and copies the samples written since the previous call (see SetNonBlocking).
      * @return true if MemoryMapInputBroker::Execute().
      */
     virtual bool Execute();
 
 private:
+
+    /**
+     * @brief Waits (spin and then futex) until \a completedCycles differs from \a consumedCycles.
+     * @return false if the timeout expired.
+     */
+    bool WaitCycle();
+
+    /**
+     * @brief Copies the oldest samples not yet read from the ring (non-blocking consume mode).
+     * @return true if MemoryMapInputBroker::Execute().
+     */
+    bool ExecuteNonBlocking();
+
     /**
      * Number of signals in the DataSourceI (not all will necessarily be writing to this broker instance).
      */
@@ -144,10 +204,35 @@ private:
     uint32 currentSample;
 
     /**
-     * Semaphore which will lock until all the samples are written.
+     * Number of times that all the samples were written. Only written by the producer.
+     */
+    volatile int32 completedCycles;
+
+    /**
+     * Value of \a completedCycles when the samples were last consumed.
+     */
+    int32 consumedCycles;
+
+    /**
+     * The futex word shared by all the brokers of the DataSourceI.
+     */
+    volatile int32 *generation;
+
+    /**
+     * Number of consumers sleeping on \a generation.
+     */
+    volatile int32 *sleepingConsumers;
+
+    /**
+     * Posted when the samples are completed if the futex is not available.
      */
     EventSem synchSem;
 
+    /**
+     * Maximum time (in HighResolutionTimer ticks) to busy spin before sleeping.
+     */
+    uint64 spinTicks;
+
     /**
      * The name of the GAM interacting with the DataSourceI that uses this broker instance.
      */
@@ -164,9 +249,54 @@ private:
     uint8 waitForNext;
 
     /**
-     * Protect the event sem
+     * True in the non-blocking consume mode.
+     */
+    bool nonBlocking;
+
+    /**
+     * The alias of the count signal (non-blocking consume mode).
+     */
+    StreamString countSignalName;
+
+    /**
+     * The number of samples read in the last Execute (non-blocking consume mode).
+     */
+    uint32 samplesCount;
+
+    /**
+     * The ring of 2 * numberOfSamples samples of each signal (non-blocking consume mode).
+     */
+    char8 **ringMemory;
+
+    /**
+     * Number of samples in the ring.
+     */
+    uint32 ringCapacity;
+
+    /**
+     * Number of samples written in the ring. Only written by the producer.
+     */
+    volatile uint32 writtenSamples;
+
+    /**
+     * The slot of the ring where the next sample is written. Only used by the producer.
+     */
+    uint32 writeSlot;
+
+    /**
+     * Number of samples read from the ring (including the lost ones). Only used by the consumer.
+     */
+    uint32 readSamples;
+
+    /**
+     * The slot of the ring of the next sample to be read. Only used by the consumer.
+     */
+    uint32 readSlot;
+
+    /**
+     * See GetNumberOfLostSamples.
      */
-    FastPollingMutexSem mux;
+    uint32 lostSamples;
 };
 }
 
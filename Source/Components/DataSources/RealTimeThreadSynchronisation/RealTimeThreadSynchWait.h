@@ -0,0 +1,127 @@
+/**
+ * @file RealTimeThreadSynchWait.h
+ * @brief Header file for the RealTimeThreadSynchronisation wait and wake primitives
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the (inline) definition of the atomic operations and of the OS specific
+ * wait and wake primitives used by the RealTimeThreadSynchronisation and by the RealTimeThreadSynchBroker.
+ * On Linux the consumers sleep on a futex word and REALTIMETHREADSYNCH_FUTEX is defined. On the other operating
+ * systems REALTIMETHREADSYNCH_FUTEX is not defined and each broker falls back to an EventSem.
+ */
+
+#ifndef REALTIMETHREADSYNCHWAIT_H_
+#define REALTIMETHREADSYNCHWAIT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#if defined(__linux__)
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "HighResolutionTimer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+#if defined(__linux__)
+/**
+ * The consumers sleep on a futex word shared by all the brokers.
+ */
+#define REALTIMETHREADSYNCH_FUTEX
+#endif
+
+/*lint -estring(526,__sync_fetch_and_add) -estring(628,__sync_fetch_and_add) -estring(746,__sync_fetch_and_add) -estring(1055,__sync_fetch_and_add) The __sync_fetch_and_add function is a GCC built-in function, so it does not have declaration.*/
+/*lint -estring(526,__sync_synchronize) -estring(628,__sync_synchronize) -estring(746,__sync_synchronize) -estring(1055,__sync_synchronize) The __sync_synchronize function is a GCC built-in function, so it does not have declaration.*/
+
+namespace MARTe {
+
+/**
+ * @brief Atomically adds \a increment to \a value with a full memory barrier.
+ * @details In GCC (and in the compilers which are compatible with it) mapped to the __sync_fetch_and_add function.
+ * @param[in,out] value the value to increment.
+ * @param[in] increment the value to add.
+ * @return the value before the addition.
+ */
+inline int32 RealTimeThreadSynchAtomicAdd(volatile int32 * const value,
+                                          const int32 increment) {
+    return __sync_fetch_and_add(value, increment);
+}
+
+/**
+ * @see RealTimeThreadSynchAtomicAdd(volatile int32 * const, const int32)
+ */
+inline uint32 RealTimeThreadSynchAtomicAdd(volatile uint32 * const value,
+                                           const uint32 increment) {
+    return __sync_fetch_and_add(value, increment);
+}
+
+/**
+ * @brief Full memory barrier.
+ * @details In GCC (and in the compilers which are compatible with it) mapped to the __sync_synchronize function.
+ */
+inline void RealTimeThreadSynchMemoryBarrier() {
+    __sync_synchronize();
+}
+
+#ifdef REALTIMETHREADSYNCH_FUTEX
+/**
+ * @brief Sleeps on the futex \a word while it is equal to \a value.
+ * @details Returns immediately if \a word is no longer equal to \a value. May also return spuriously, so that the caller shall check its
+ * own condition again.
+ * @param[in] word the futex word.
+ * @param[in] value the value of \a word read (with a full barrier) before checking the condition.
+ * @param[in] timeoutTicks the maximum time to sleep in HighResolutionTimer ticks (0 to sleep with no timeout).
+ */
+inline void RealTimeThreadSynchFutexWait(volatile int32 * const word,
+                                         const int32 value,
+                                         const uint64 timeoutTicks) {
+    struct timespec remaining;
+    struct timespec *remainingPtr = NULL_PTR(struct timespec *);
+    if (timeoutTicks > 0u) {
+        float64 remainingSec = static_cast<float64>(timeoutTicks) * HighResolutionTimer::Period();
+        remaining.tv_sec = static_cast<time_t>(remainingSec);
+        remaining.tv_nsec = static_cast<long>((remainingSec - static_cast<float64>(remaining.tv_sec)) * 1e9);
+        remainingPtr = &remaining;
+    }
+    (void) syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, value, remainingPtr, NULL_PTR(void *), 0);
+}
+
+/**
+ * @brief Wakes all the threads sleeping on the futex \a word.
+ * @param[in] word the futex word.
+ */
+inline void RealTimeThreadSynchFutexWake(volatile int32 * const word) {
+    (void) syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, INT_MAX, NULL_PTR(void *), NULL_PTR(void *), 0);
+}
+#endif
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REALTIMETHREADSYNCHWAIT_H_ */
@@ -32,6 +32,7 @@
 #include "MemoryMapSynchronisedOutputBroker.h"
 #include "RealTimeThreadSynchBroker.h"
 #include "RealTimeThreadSynchronisation.h"
+#include "RealTimeThreadSynchWait.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -51,10 +52,17 @@ RealTimeThreadSynchronisation::RealTimeThreadSynchronisation() :
     synchInputBrokers = NULL_PTR(RealTimeThreadSynchBroker **);
     currentInitBrokerIndex = -1;
     waitForNext = 0u;
+    spinTime = 0u;
+    generation = 0;
+    sleepingConsumers = 0;
 }
 
 /*lint -e{1551} must free the allocated memory in the destructor. */
 RealTimeThreadSynchronisation::~RealTimeThreadSynchronisation() {
+    (void) RealTimeThreadSynchAtomicAdd(&generation, 1);
+#ifdef REALTIMETHREADSYNCH_FUTEX
+    RealTimeThreadSynchFutexWake(&generation);
+#endif
     if (synchInputBrokers != NULL_PTR(RealTimeThreadSynchBroker **)) {
         delete[] synchInputBrokers;
     }
@@ -170,6 +178,20 @@ bool RealTimeThreadSynchronisation::Initialise(StructuredDataI & data) {
     if (!data.Read("WaitForNext", waitForNext)) {
         waitForNext = 0u;
     }
+    if (!data.Read("SpinTime", spinTime)) {
+        spinTime = 0u;
+    }
+    if (ok) {
+        if (data.MoveRelative("Consumers")) {
+            ok = data.Copy(consumersConfig);
+            if (ok) {
+                ok = data.MoveToAncestor(1u);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Could not read the Consumers");
+            }
+        }
+    }
     return ok;
 }
 
@@ -185,6 +207,7 @@ bool RealTimeThreadSynchronisation::SetConfiguredDatabase(StructuredDataI & data
     else {
         numberOfSyncGAMs = 0u;
     }
+    uint32 numberOfConfiguredConsumers = 0u;
     uint32 n;
     if (ok) {
         if (numberOfSyncGAMs > 0u) {
@@ -206,7 +229,8 @@ bool RealTimeThreadSynchronisation::SetConfiguredDatabase(StructuredDataI & data
                         REPORT_ERROR_STATIC(ErrorManagement::Warning, "The GAM which writes to this RealTimeThreadSynchronisation does not produce all the signals.");
                     }
 
-                    memoryOffsets = new uint32[numberOfFunctionSignals];
+                    //The signals which are not written by the producer (e.g. the CountSignal) have an offset as well
+                    memoryOffsets = new uint32[GetNumberOfSignals()];
                     //Check that the number of samples is exactly one.
 
                     uint32 numberOfSamplesRead;
@@ -239,9 +263,31 @@ bool RealTimeThreadSynchronisation::SetConfiguredDatabase(StructuredDataI & data
                 }
             }
             else {
+                uint32 consumerSpinTime = spinTime;
+                uint8 nonBlocking = 0u;
+                StreamString countSignal;
+                StreamString functionName;
+                ok = GetFunctionName(n, functionName);
+                if (ok) {
+                    if (consumersConfig.MoveAbsolute(functionName.Buffer())) {
+                        if (!consumersConfig.Read("SpinTime", consumerSpinTime)) {
+                            consumerSpinTime = spinTime;
+                        }
+                        if (!consumersConfig.Read("NonBlocking", nonBlocking)) {
+                            nonBlocking = 0u;
+                        }
+                        if (!consumersConfig.Read("CountSignal", countSignal)) {
+                            countSignal = "";
+                        }
+                        numberOfConfiguredConsumers++;
+                    }
+                }
                 ReferenceT<RealTimeThreadSynchBroker> synchInputBroker(new RealTimeThreadSynchBroker());
                 (void) synchInputBrokersContainer.Insert(synchInputBroker);
-                synchInputBroker->SetFunctionIndex(this, n, timeout, waitForNext);
+                synchInputBroker->SetFunctionIndex(this, n, timeout, waitForNext, &generation, &sleepingConsumers, consumerSpinTime);
+                if (nonBlocking > 0u) {
+                    synchInputBroker->SetNonBlocking(countSignal.Buffer());
+                }
             }
         }
     }
@@ -253,6 +299,13 @@ bool RealTimeThreadSynchronisation::SetConfiguredDatabase(StructuredDataI & data
             }
         }
     }
+    if (ok) {
+        (void) consumersConfig.MoveToRoot();
+        ok = (numberOfConfiguredConsumers == consumersConfig.GetNumberOfChildren());
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "All the functions in Consumers shall read from this DataSourceI");
+        }
+    }
     //Create the synchInputBrokers
     if (synchInputBrokers != NULL_PTR(RealTimeThreadSynchBroker **)) {
         for (n = 0u; (n < numberOfSyncGAMs) && (ok); n++) {
@@ -270,11 +323,25 @@ TimeoutType RealTimeThreadSynchronisation::GetSynchroniseTimeout() const {
 
 bool RealTimeThreadSynchronisation::Synchronise() {
     bool ok = true;
+    bool cycleCompleted = false;
     uint32 u;
     if (synchInputBrokers != NULL_PTR(RealTimeThreadSynchBroker **)) {
         for (u = 0u; (u < numberOfSyncGAMs) && (ok); u++) {
             ok = synchInputBrokers[u]->AddSample();
+            if (synchInputBrokers[u]->IsCycleCompleted()) {
+                cycleCompleted = true;
+            }
+        }
+    }
+    if (cycleCompleted) {
+        //The full barrier of the atomic add orders the new generation before reading the number of sleeping consumers, so that a consumer
+        //which announced itself after this read will see the new generation in the FUTEX_WAIT.
+        (void) RealTimeThreadSynchAtomicAdd(&generation, 1);
+#ifdef REALTIMETHREADSYNCH_FUTEX
+        if (sleepingConsumers > 0) {
+            RealTimeThreadSynchFutexWake(&generation);
         }
+#endif
     }
 
     return ok;
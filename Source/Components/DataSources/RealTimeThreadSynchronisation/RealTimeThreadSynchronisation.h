@@ -31,8 +31,8 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
 #include "DataSourceI.h"
-#include "EventSem.h"
 #include "RealTimeThreadSynchBroker.h"
 
 /*---------------------------------------------------------------------------*/
@@ -56,6 +56,19 @@ namespace MARTe {
  * useful if cycles were lost and the thread should wait for the next synchronisation cycle. The default behaviour (WaitForNext=0) is to 
  * first wait and then reset the semaphore and, as a consequence, if the semaphore had already been posted, it will not wait.
  *
+ * All the consumers share a single futex word (a generation counter incremented by Synchronise when the samples of at least one consumer
+ * are completed). A consumer first busy spins for at most SpinTime microseconds (so that a consumer which is already spinning wakes
+ * without any system call) and then sleeps on the futex word. The producer only performs a system call (a single FUTEX_WAKE for all
+ * the consumers) if at least one consumer is sleeping. The SpinTime can be set for all the consumers and overridden for each consumer
+ * in the Consumers node. The futex is only available on Linux: on the other operating systems each consumer sleeps instead on an
+ * EventSem of its broker, which Synchronise posts when the samples of the consumer are completed.
+ *
+ * A consumer with NonBlocking = 1 in the Consumers node never waits: each cycle it reads all the samples written since its previous cycle,
+ * oldest first, up to its number of Samples (the others are read in the next cycles). The producer writes these samples in a ring of twice
+ * the number of Samples of the consumer, without waiting for it, so that a consumer whose cycles jitter does not lose samples as long as it
+ * is never more than 2 * Samples - 1 samples late (otherwise the oldest samples are lost). The number of samples read is written in the
+ * optional CountSignal (uint32, one sample, not written by the producer); the samples above this number are not updated.
+ *
  * The configuration syntax is (names are only given as an example):
  * <pre>
  * +Functions = {"
@@ -112,6 +125,10 @@ namespace MARTe {
  *         DataSource = RealTimeThreadSynch"
  *         Samples = 4 //Will run at a quarter of the frequency
  *       }
+ *       Signal3Count = { //Only for a NonBlocking consumer (see Consumers below). Not written by GAM1.
+ *         SignalType = uint32
+ *         DataSource = RealTimeThreadSynch"
+ *       }
  *     }
  *   }
  * }
@@ -142,6 +159,16 @@ namespace MARTe {
  *     Timeout = 1000 //Timeout in ms to wait for the thread to cycle.
  *                    //If this parameter is not set it will wait forever to be triggered and might lock a state change.
  *                    //Default is 1000
+ *     SpinTime = 0 //Optional. Time in microseconds that the consumers busy spin before sleeping. Default is 0.
+ *     Consumers = { //Optional. Per consumer settings.
+ *       GAM2 = {
+ *         SpinTime = 50 //Optional. Overrides the SpinTime of the DataSource for this consumer.
+ *       }
+ *       GAM3 = {
+ *         NonBlocking = 1 //Optional. Default is 0. If 1 reads (without waiting) the samples written since the previous cycle (at most Samples).
+ *         CountSignal = Signal3Count //Optional. Only with NonBlocking = 1. The uint32 signal (read by GAM3) where the number of samples read is written.
+ *       }
+ *     }
  *   }
  * }
  * </pre>
@@ -214,7 +241,7 @@ RealTimeThreadSynchronisation    ();
             const char8 * const nextStateName);
 
     /**
-     * @brief Calls DataSourceI::Initialise.
+     * @brief Calls DataSourceI::Initialise and reads the Timeout, WaitForNext, SpinTime and Consumers parameters.
      * @return see DataSourceI::Initialise.
      */
     virtual bool Initialise(StructuredDataI & data);
@@ -227,12 +254,16 @@ RealTimeThreadSynchronisation    ();
      * - The number of written samples is exactly one.
      * - The number of read samples is constant for all the signals of any given GAM (but may different between GAMs).
      * - If there is a GAM reading from this DataSourceI, then there must be a GAM writing into this DataSourceI.
+     * - All the functions in the Consumers node read from this DataSourceI.
+     * - The CountSignal of a NonBlocking consumer is one sample of one uint32 read by the consumer.
      * @return true if all the parameters are valid and the conditions above are met.
      */
     virtual bool SetConfiguredDatabase(StructuredDataI & data);
 
     /**
      * @brief Calls RealTimeThreadSynchBroker::AddSample on all the brokers.
+     * @details If the samples of at least one broker were completed, increments the futex word and, only if there are sleeping consumers,
+     * wakes all of them with a single FUTEX_WAKE (or, if the futex is not available, posts the EventSem of each broker whose samples were completed).
      * @return true if all the AddSample calls return true.
      */
     virtual bool Synchronise();
@@ -288,6 +319,26 @@ private:
      * If 1 => first reset and then wait at the synchronisation point.
      */
     uint8 waitForNext;
+
+    /**
+     * Default time (in microseconds) that the consumers busy spin before sleeping.
+     */
+    uint32 spinTime;
+
+    /**
+     * The per consumer settings.
+     */
+    ConfigurationDatabase consumersConfig;
+
+    /**
+     * The futex word (generation counter) shared by all the brokers.
+     */
+    volatile int32 generation;
+
+    /**
+     * Number of consumers sleeping on \a generation.
+     */
+    volatile int32 sleepingConsumers;
 };
 }
 
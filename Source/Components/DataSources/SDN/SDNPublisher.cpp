@@ -68,6 +68,18 @@ SDNPublisher::SDNPublisher() :
     payloadNumberOfElements = NULL_PTR(uint32 *);
     payloadAddresses = NULL_PTR(void **);
     sdnHeaderAsSignal = false;
+    onChange = false;
+    fullRefreshPeriod = 100u;
+    numberOfSuppressedMessages = 0u;
+    fragmentSize = 0u;
+    payloadMemory = NULL_PTR(char8 *);
+    payloadOffsets = NULL_PTR(uint32 *);
+    payloadTotalSize = 0u;
+    fragmentedMessageCounter = 0u;
+    fragmentCounterAttribute = NULL_PTR(uint32 *);
+    fragmentOffsetAttribute = NULL_PTR(uint32 *);
+    fragmentTotalSizeAttribute = NULL_PTR(uint32 *);
+    fragmentDataAttribute = NULL_PTR(char8 *);
 }
 
 /*lint -e{1551} the destructor must guarantee that all the SDN objects are destroyed.*/
@@ -92,6 +104,12 @@ SDNPublisher::~SDNPublisher() {
     if (payloadAddresses != NULL_PTR(void **)) {
         delete[] payloadAddresses;
     }
+    if (payloadOffsets != NULL_PTR(uint32 *)) {
+        delete[] payloadOffsets;
+    }
+    if (payloadMemory != NULL_PTR(char8 *)) {
+        delete[] payloadMemory;
+    }
 
 }
 
@@ -155,6 +173,20 @@ bool SDNPublisher::Initialise(StructuredDataI &data) {
     }
 
     networkByteOrder = (0u != byteOrder);
+
+    // Read optional change-driven publishing
+    uint32 onChangeIn = 0u;
+    if (data.Read("OnChange", onChangeIn)) {
+        onChange = (0u != onChangeIn);
+    }
+    if (!data.Read("FullRefreshPeriod", fullRefreshPeriod)) {
+        fullRefreshPeriod = 100u;
+    }
+
+    // Read optional payload fragmentation
+    if (data.Read("FragmentSize", fragmentSize)) {
+        REPORT_ERROR(ErrorManagement::Information, "Payload fragmented in messages of '%u' bytes", fragmentSize);
+    }
     return ok;
 }
 
@@ -255,7 +287,8 @@ bool SDNPublisher::AllocateMemory() {
             payloadNumberOfBits[signalIndex] = signalType.numberOfBits;
             payloadNumberOfElements[signalIndex] = signalNOfElements;
         }
-        if (ok) {
+        // With fragmentation the topic is the fragment and not the payload
+        if ((ok) && (fragmentSize == 0u)) {
             if (sdnHeaderAsSignal) {
                 ok = (topic->AddAttribute(signalIndex - 1u, signalName.Buffer(), signalTypeName.Buffer(),
                                           signalNOfElements) == STATUS_SUCCESS);
@@ -268,6 +301,42 @@ bool SDNPublisher::AllocateMemory() {
 
     }
 
+    if ((ok) && (fragmentSize > 0u)) {
+        // The payload is kept in the DataSource memory and published one fragment at a time
+        payloadOffsets = new uint32[nOfSignals];
+        payloadTotalSize = 0u;
+        signalIndex = 0u;
+        if (sdnHeaderAsSignal) {
+            payloadOffsets[0u] = 0u;
+            signalIndex = 1u;
+        }
+        for (; signalIndex < nOfSignals; signalIndex++) {
+            payloadOffsets[signalIndex] = payloadTotalSize;
+            payloadTotalSize += (static_cast<uint32>(payloadNumberOfBits[signalIndex]) / 8u) * payloadNumberOfElements[signalIndex];
+        }
+        payloadMemory = new (std::nothrow) char8[payloadTotalSize];
+        //lint -e{948} std::nothrow => payloadMemory may be NULL
+        ok = (payloadMemory != NULL_PTR(char8 *));
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(payloadMemory, '\0', payloadTotalSize);
+        }
+        if (ok) {
+            ok = (topic->AddAttribute(0u, "MessageCounter", "uint32") == STATUS_SUCCESS);
+        }
+        if (ok) {
+            ok = (topic->AddAttribute(1u, "Offset", "uint32") == STATUS_SUCCESS);
+        }
+        if (ok) {
+            ok = (topic->AddAttribute(2u, "TotalSize", "uint32") == STATUS_SUCCESS);
+        }
+        if (ok) {
+            ok = (topic->AddAttribute(3u, "Fragment", "uint8", fragmentSize) == STATUS_SUCCESS);
+        }
+        if (ok) {
+            REPORT_ERROR(ErrorManagement::Information, "Payload of '%u' bytes published in '%u' fragments", payloadTotalSize, GetNumberOfFragments());
+        }
+    }
+
     if (ok) {
         topic->SetUID(0u); // UID corresponds to the data type but it includes attributes name - Safer to clear with SDN core library 1.0.10
         ok = (topic->Configure() == STATUS_SUCCESS);
@@ -314,6 +383,18 @@ bool SDNPublisher::AllocateMemory() {
         ok = (publisher->Configure() == STATUS_SUCCESS);
     }
 
+    if ((ok) && (fragmentSize > 0u)) {
+        /*lint -e{613} topic cannot be NULL in this portion of the code as otherwise ok would be false.*/
+        sdn::base::AnyType *fragment = topic->GetTypeDefinition();
+        ok = (fragment != NULL_PTR(sdn::base::AnyType *));
+        if (ok) {
+            fragmentCounterAttribute = static_cast<uint32 *>(fragment->GetAttributeReference(0u));
+            fragmentOffsetAttribute = static_cast<uint32 *>(fragment->GetAttributeReference(1u));
+            fragmentTotalSizeAttribute = static_cast<uint32 *>(fragment->GetAttributeReference(2u));
+            fragmentDataAttribute = static_cast<char8 *>(fragment->GetAttributeReference(3u));
+        }
+    }
+
     if (ok) {
         for (signalIndex = 0u; (signalIndex < nOfSignals) && (ok); signalIndex++) {
             void *signalAddress;
@@ -339,6 +420,23 @@ bool SDNPublisher::AllocateMemory() {
             }
         }
     }
+    if ((ok) && (onChange)) {
+        // The header (stamped by the sdn::Publisher) is not a payload signal
+        uint32 firstSignal = 0u;
+        if (sdnHeaderAsSignal) {
+            firstSignal = 1u;
+        }
+        uint32 nOfPayloadSignals = nOfSignals - firstSignal;
+        uint32 *payloadSizes = new uint32[nOfPayloadSignals];
+        for (signalIndex = firstSignal; signalIndex < nOfSignals; signalIndex++) {
+            payloadSizes[signalIndex - firstSignal] = (static_cast<uint32>(payloadNumberOfBits[signalIndex]) / 8u) * payloadNumberOfElements[signalIndex];
+        }
+        ok = changeDetector.Configure(nOfPayloadSignals, &payloadAddresses[firstSignal], payloadSizes, fullRefreshPeriod);
+        delete[] payloadSizes;
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InternalSetupError, "Failed to configure the change detection of the payload");
+        }
+    }
     if (!ok) {
         REPORT_ERROR(ErrorManagement::InternalSetupError, "Failed to instantiate sdn::Publisher");
     }
@@ -366,13 +464,15 @@ bool SDNPublisher::GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bu
 
     if (ok) {
         /*lint -e{613} The reference can not be NULL in this portion of the code.*/
-        if (sdnHeaderAsSignal) {
-            if (signalIdx > 0u) {
-                signalAddress = topic->GetTypeDefinition()->GetAttributeReference(signalIdx - 1u);
-            }
-            else {
-                signalAddress = publisher->GetTopicHeader();
-            }
+        if ((sdnHeaderAsSignal) && (signalIdx == 0u)) {
+            signalAddress = publisher->GetTopicHeader();
+        }
+        else if (payloadMemory != NULL_PTR(char8 *)) {
+            /*lint -e{613} payloadOffsets cannot be NULL if payloadMemory is not NULL.*/
+            signalAddress = &payloadMemory[payloadOffsets[signalIdx]];
+        }
+        else if (sdnHeaderAsSignal) {
+            signalAddress = topic->GetTypeDefinition()->GetAttributeReference(signalIdx - 1u);
         }
         else {
             signalAddress = topic->GetTypeDefinition()->GetAttributeReference(signalIdx);
@@ -545,6 +645,10 @@ bool SDNPublisher::GetOutputBrokers(ReferenceContainer& outputBrokers, const cha
 
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: returns true irrespectively of the input parameters.*/
 bool SDNPublisher::PrepareNextState(const char8* const currentStateName, const char8* const nextStateName) {
+    if (onChange) {
+        // The subscribers get the whole payload when the state changes
+        changeDetector.Invalidate();
+    }
     return true;
 }
 
@@ -555,7 +659,15 @@ bool SDNPublisher::Synchronise() {
     if (!ok) {
         REPORT_ERROR(ErrorManagement::FatalError, "sdn::Publisher has not been initialised");
     }
-    if (ok) {
+    bool publish = ok;
+    if ((ok) && (onChange)) {
+        // Compare before the (in place) byte swap, i.e. in the host byte order written by the brokers
+        publish = (changeDetector.Update() > 0u);
+        if (!publish) {
+            numberOfSuppressedMessages++;
+        }
+    }
+    if (publish) {
         if (networkByteOrder) {
             // Convert payload to network byte order
             uint32 signalIndex = 0u;
@@ -585,13 +697,21 @@ bool SDNPublisher::Synchronise() {
             }
         }
     }
-    if (ok) {
-        /*lint -e{613} The reference can not be NULL in this portion of the code.*/
-        ok = (publisher->Publish() == STATUS_SUCCESS);
+    if (publish) {
+        if (fragmentSize > 0u) {
+            ok = PublishFragments();
+        }
+        else {
+            /*lint -e{613} The reference can not be NULL in this portion of the code.*/
+            ok = (publisher->Publish() == STATUS_SUCCESS);
+        }
     }
 
     if (!ok) {
         REPORT_ERROR(ErrorManagement::InternalSetupError, "Failed to publish");
+        if (onChange) {
+            changeDetector.Invalidate();
+        }
     }
 
 #ifdef FEATURE_10840
@@ -604,6 +724,62 @@ bool SDNPublisher::Synchronise() {
 
     return ok;
 }
+
+bool SDNPublisher::IsOnChangeEnabled() const {
+    return onChange;
+}
+
+uint32 SDNPublisher::GetFullRefreshPeriod() const {
+    return fullRefreshPeriod;
+}
+
+uint32 SDNPublisher::GetNumberOfSuppressedMessages() const {
+    return numberOfSuppressedMessages;
+}
+
+uint32 SDNPublisher::GetFragmentSize() const {
+    return fragmentSize;
+}
+
+uint32 SDNPublisher::GetNumberOfFragments() const {
+    uint32 numberOfFragments = 1u;
+    if (fragmentSize > 0u) {
+        numberOfFragments = ((payloadTotalSize + fragmentSize) - 1u) / fragmentSize;
+    }
+    return numberOfFragments;
+}
+
+bool SDNPublisher::PublishFragments() {
+    bool ok = true;
+    fragmentedMessageCounter++;
+    uint32 offset = 0u;
+    while ((ok) && (offset < payloadTotalSize)) {
+        uint32 length = (payloadTotalSize - offset);
+        if (length > fragmentSize) {
+            length = fragmentSize;
+        }
+        uint32 counter = fragmentedMessageCounter;
+        uint32 wireOffset = offset;
+        uint32 totalSize = payloadTotalSize;
+        if (networkByteOrder) {
+            Endianity::ToBigEndian(counter);
+            Endianity::ToBigEndian(wireOffset);
+            Endianity::ToBigEndian(totalSize);
+        }
+        /*lint -e{613} the fragment attributes and payloadMemory cannot be NULL if fragmentSize > 0.*/
+        *fragmentCounterAttribute = counter;
+        *fragmentOffsetAttribute = wireOffset;
+        *fragmentTotalSizeAttribute = totalSize;
+        ok = MemoryOperationsHelper::Copy(fragmentDataAttribute, &payloadMemory[offset], length);
+        if (ok) {
+            /*lint -e{613} The reference can not be NULL in this portion of the code.*/
+            ok = (publisher->Publish() == STATUS_SUCCESS);
+        }
+        offset += length;
+    }
+    return ok;
+}
+
 #ifdef FEATURE_10840
 CLASS_REGISTER(SDNPublisher, "1.2")
 // Or above
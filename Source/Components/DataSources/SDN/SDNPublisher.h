@@ -40,6 +40,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "DataSourceI.h"
+#include "SignalChangeDetector.h"
 
 #include "sdn-api.h" /* SDN core library - API definition (sdn::core) */
 /*Cannot include "sdn-header.h" otherwise lint gets lost in secondary includes.*/
@@ -101,6 +102,9 @@ namespace MARTe {
  *     SourcePort = port // Optional - Explicit source-side port to bind to
  *     NetworkByteOrder = 1 // Optional - Enforce On-the-wire network byte ordering
  * \b endif
+ *     OnChange = 1 // Optional (default 0) - Only publish if at least one payload signal changed since the last publication (see SignalChangeDetector)
+ *     FullRefreshPeriod = 100 // Optional (default 100) - With OnChange = 1, publish every FullRefreshPeriod cycles even if nothing changed (0 to disable)
+ *     FragmentSize = 1400 // Optional (default 0, i.e. one datagram) - Split the payload in fragments of (at most) FragmentSize bytes
  *     Signals = {
  *         Header = { //Optional. If present (i.e. if there is a signal named header) the sent packet header will be copied into this field (note that it can be later decomposed by GAMs using Ranges). It shall be the first signal.
  *             Type = uint8
@@ -131,6 +135,14 @@ namespace MARTe {
  * performs the necessary byte swaps before publication.
  * \b endif
  *
+ * With FragmentSize > 0 the payload (all the signals but the Header) is kept in the DataSource memory and each Synchronise
+ * publishes it as ceil(payload size / FragmentSize) messages of a topic which holds, in this order, the message counter (uint32,
+ * incremented at each Synchronise), the offset of the fragment in the payload (uint32), the size of the payload (uint32) and
+ * FragmentSize bytes of the payload (the last fragment is padded). This allows payloads larger than a datagram (64 kB) to be
+ * published; the SDNSubscriber with the same FragmentSize reassembles them. Each fragment shall fit in one frame of the interface:
+ * FragmentSize = MTU - 28 (IPv4 and UDP headers) - 48 (SDN header) - 12 (fragment header), e.g. 1412 for a 1500 bytes MTU and
+ * 8912 for 9000 bytes jumbo frames.
+ *
  * @warning The DataSource requires that one and only one signal be identified as synchronisation
  * point (i.e. only one signal must set Trigger = 1).
  *
@@ -251,6 +263,7 @@ SDNPublisher    ();
 
     /**
      * @brief See DataSourceI::PrepareNextState.
+     * @details With OnChange = 1 forces the publication of the next message.
      * @return true.
      */
     virtual bool PrepareNextState(const char8 * const currentStateName,
@@ -260,16 +273,57 @@ SDNPublisher    ();
      * @brief See DataSourceI::Synchronise.
      * @details The method calls sdn::Publisher::Publish and relies on the fact that SDN
      * message payload has been previously completely modified by the OutputBroker instances.
+     * The signals are not copied: the OutputBroker instances write directly into the sdn::Topic instance
+     * (and the header) which is sent by the sdn::Publisher, so that the only work per cycle is the optional
+     * byte swap, the header stamping and the send.
      * @warning It is for the application-specific configuration to ensure and organise ordering of the
      * GAMs so as to ensure proper payload update prior to publication, e.g. the synchronising
      * GAM is scheduled after all the non-synchronising GAMs contributing signals to the 
      * DataSource.
+     * With OnChange = 1 the message is only published if a payload signal changed (or a full refresh is due).
+     * With FragmentSize > 0 the payload is published in GetNumberOfFragments() messages.
      * @return true or false in case of error within the SDN core library.
      */
     virtual bool Synchronise();
 
+    /**
+     * @brief Checks if the messages are only published when a payload signal changes.
+     * @return true if OnChange = 1.
+     */
+    bool IsOnChangeEnabled() const;
+
+    /**
+     * @brief Gets the number of cycles between two publications of an unchanged payload.
+     * @return the number of cycles between two publications of an unchanged payload.
+     */
+    uint32 GetFullRefreshPeriod() const;
+
+    /**
+     * @brief Gets the number of messages which were not published because no payload signal changed.
+     * @return the number of messages which were not published because no payload signal changed.
+     */
+    uint32 GetNumberOfSuppressedMessages() const;
+
+    /**
+     * @brief Gets the maximum number of payload bytes of each published message.
+     * @return the FragmentSize (0 if the payload is not fragmented).
+     */
+    uint32 GetFragmentSize() const;
+
+    /**
+     * @brief Gets the number of messages published at each Synchronise.
+     * @return the number of fragments of the payload (1 if the payload is not fragmented).
+     */
+    uint32 GetNumberOfFragments() const;
+
 private:
 
+    /**
+     * @brief Publishes the payload in fragments of FragmentSize bytes.
+     * @return true if all the fragments were published.
+     */
+    bool PublishFragments();
+
     /**
      * Interface name configuration parameter
      */
@@ -334,6 +388,59 @@ private:
      * Read the SDN header as a signal?
     */
     bool sdnHeaderAsSignal;
+
+    /**
+     * Only publish when a payload signal changes?
+     */
+    bool onChange;
+
+    /**
+     * Number of cycles between two publications of an unchanged payload
+     */
+    uint32 fullRefreshPeriod;
+
+    /**
+     * Detects the payload signals which changed since the last publication
+     */
+    SignalChangeDetector changeDetector;
+
+    /**
+     * Number of messages not published because no payload signal changed
+     */
+    uint32 numberOfSuppressedMessages;
+
+    /**
+     * Maximum number of payload bytes of each message (0 if the payload is not fragmented)
+     */
+    uint32 fragmentSize;
+
+    /**
+     * The payload when it is fragmented (NULL otherwise)
+     */
+    char8 *payloadMemory;
+
+    /**
+     * Offset of each signal in payloadMemory
+     */
+    uint32 *payloadOffsets;
+
+    /**
+     * Size in bytes of payloadMemory
+     */
+    uint32 payloadTotalSize;
+
+    /**
+     * Counter of the fragmented messages
+     */
+    uint32 fragmentedMessageCounter;
+
+    /**
+     * The attributes of the fragment topic: message counter, offset, payload size and data
+     */
+    uint32 *fragmentCounterAttribute;
+    uint32 *fragmentOffsetAttribute;
+    uint32 *fragmentTotalSizeAttribute;
+    char8 *fragmentDataAttribute;
 };
 
 }
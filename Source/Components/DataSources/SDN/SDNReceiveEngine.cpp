@@ -0,0 +1,170 @@
+/**
+ * @file SDNReceiveEngine.cpp
+ * @brief Source file for class SDNReceiveEngine
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SDNReceiveEngine (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BitSet.h"
+#include "SDNReceiveEngine.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+SDNReceiveEngine *SDNReceiveEngine::Instance() {
+    static SDNReceiveEngine instance;
+    return &instance;
+}
+
+SDNReceiveEngine::SDNReceiveEngine() :
+        EmbeddedServiceMethodBinderI(),
+        executor(*this) {
+    topicsMux.Create();
+    numberOfTopics = 0u;
+    idleSleep = 0u;
+    uint32 i;
+    for (i = 0u; i < SDN_RECEIVE_ENGINE_MAX_TOPICS; i++) {
+        topics[i] = NULL_PTR(EmbeddedServiceMethodBinderI *);
+    }
+}
+
+/*lint -e{1551} the destructor must guarantee that the SingleThreadService is stopped.*/
+SDNReceiveEngine::~SDNReceiveEngine() {
+    if (executor.GetStatus() != EmbeddedThreadI::OffState) {
+        if (!executor.Stop()) {
+            if (!executor.Stop()) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not stop SingleThreadService");
+            }
+        }
+    }
+}
+
+bool SDNReceiveEngine::Register(EmbeddedServiceMethodBinderI &topic,
+                                const uint64 cpuMask,
+                                const uint32 idleSleepIn) {
+    bool ok = (topicsMux.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        uint32 i;
+        for (i = 0u; (i < numberOfTopics) && (ok); i++) {
+            ok = (topics[i] != &topic);
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The topic is already registered");
+        }
+    }
+    if (ok) {
+        ok = (numberOfTopics < SDN_RECEIVE_ENGINE_MAX_TOPICS);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "At most %u topics can share the receive thread", SDN_RECEIVE_ENGINE_MAX_TOPICS);
+        }
+    }
+    if (ok) {
+        topics[numberOfTopics] = &topic;
+        numberOfTopics++;
+    }
+    topicsMux.FastUnLock();
+    if (ok) {
+        if (executor.GetStatus() == EmbeddedThreadI::OffState) {
+            idleSleep = idleSleepIn;
+            if (cpuMask != 0ull) {
+                executor.SetCPUMask(BitSet(cpuMask));
+            }
+            executor.SetName("SDNReceiveEngine");
+            ok = (executor.Start() == ErrorManagement::NoError);
+            if (ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "Started the shared SDN receive thread");
+            }
+        }
+    }
+    return ok;
+}
+
+bool SDNReceiveEngine::Unregister(const EmbeddedServiceMethodBinderI &topic) {
+    bool found = false;
+    bool stop = false;
+    //The lock is held by the thread during a whole pass
+    if (topicsMux.FastLock() == ErrorManagement::NoError) {
+        uint32 i;
+        for (i = 0u; (i < numberOfTopics) && (!found); i++) {
+            found = (topics[i] == &topic);
+            if (found) {
+                numberOfTopics--;
+                topics[i] = topics[numberOfTopics];
+                topics[numberOfTopics] = NULL_PTR(EmbeddedServiceMethodBinderI *);
+            }
+        }
+        stop = (found) && (numberOfTopics == 0u);
+    }
+    topicsMux.FastUnLock();
+    if (stop) {
+        if (!executor.Stop()) {
+            if (!executor.Stop()) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not stop SingleThreadService");
+            }
+        }
+    }
+    return found;
+}
+
+uint32 SDNReceiveEngine::GetNumberOfTopics() {
+    uint32 n = 0u;
+    if (topicsMux.FastLock() == ErrorManagement::NoError) {
+        n = numberOfTopics;
+    }
+    topicsMux.FastUnLock();
+    return n;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the method operates regardless of the input parameter.*/
+ErrorManagement::ErrorType SDNReceiveEngine::Execute(ExecutionInfo &info) {
+    bool received = false;
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        if (topicsMux.FastLock() == ErrorManagement::NoError) {
+            uint32 i;
+            for (i = 0u; i < numberOfTopics; i++) {
+                /*lint -e{613} topics[i] cannot be NULL for i < numberOfTopics.*/
+                if (topics[i]->Execute(info).ErrorsCleared()) {
+                    received = true;
+                }
+            }
+        }
+        topicsMux.FastUnLock();
+    }
+    if ((!received) && (idleSleep > 0u)) {
+        Sleep::Sec(static_cast<float32>(idleSleep) * 1e-6F);
+    }
+    return ErrorManagement::NoError;
+}
+
+}
@@ -0,0 +1,142 @@
+/**
+ * @file SDNReceiveEngine.h
+ * @brief Header file for class SDNReceiveEngine
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ *
+ * @details This header file contains the declaration of the class SDNReceiveEngine
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SDNRECEIVEENGINE_H_
+#define SDNRECEIVEENGINE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderI.h"
+#include "FastPollingMutexSem.h"
+#include "SingleThreadService.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The maximum number of topics which can be registered in the SDNReceiveEngine.
+ */
+const uint32 SDN_RECEIVE_ENGINE_MAX_TOPICS = 64u;
+
+/**
+ * @brief One thread (shared by all the SDNSubscriber instances with ExecutionMode = SharedThread) which busy-polls many topics.
+ * @details In each pass the thread calls EmbeddedServiceMethodBinderI::Execute of every registered topic, which shall
+ * receive (without blocking) the latest message of the topic into its own buffer and post its own synchronisation semaphore,
+ * returning ErrorManagement::NoError only if a message was received. If no topic received a message in a pass the thread sleeps
+ * for IdleSleep microseconds (0 = pure busy-poll, in which case the thread should be pinned to a dedicated core).
+ *
+ * The thread is started when the first topic is registered, with the CPU mask and the IdleSleep of this topic, and stopped
+ * when the last topic is unregistered. Unregister waits for the current pass to complete, so that a topic is never executed
+ * after it was unregistered.
+ */
+class SDNReceiveEngine: public EmbeddedServiceMethodBinderI {
+public:
+    /**
+     * @brief Gets the process-wide instance.
+     * @return the process-wide instance.
+     */
+    static SDNReceiveEngine *Instance();
+
+    /**
+     * @brief Destructor. Stops the thread.
+     */
+    virtual ~SDNReceiveEngine();
+
+    /**
+     * @brief Adds a topic to the thread and starts the thread if it is the first topic.
+     * @param[in] topic the topic to poll.
+     * @param[in] cpuMask the affinity of the thread (0 for the default), only used if the thread is not running.
+     * @param[in] idleSleepIn the time to sleep (in microseconds) after a pass where no message was received, only used if the thread is not running.
+     * @return true if the topic is not yet registered, if less than SDN_RECEIVE_ENGINE_MAX_TOPICS are registered and if the thread could be started.
+     */
+    bool Register(EmbeddedServiceMethodBinderI &topic,
+                  const uint64 cpuMask,
+                  const uint32 idleSleepIn);
+
+    /**
+     * @brief Removes a topic from the thread and stops the thread if it was the last topic.
+     * @param[in] topic the topic to remove.
+     * @return true if the topic was registered.
+     */
+    bool Unregister(const EmbeddedServiceMethodBinderI &topic);
+
+    /**
+     * @brief Gets the number of registered topics.
+     * @return the number of registered topics.
+     */
+    uint32 GetNumberOfTopics();
+
+    /**
+     * @brief Callback of the SingleThreadService. Polls all the registered topics once.
+     * @param[in] info not used.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+private:
+    /**
+     * @brief Constructor. See Instance.
+     */
+    SDNReceiveEngine();
+
+    /**
+     * Protects the topics against concurrent Register/Unregister.
+     */
+    FastPollingMutexSem topicsMux;
+
+    /**
+     * The registered topics.
+     */
+    EmbeddedServiceMethodBinderI *topics[SDN_RECEIVE_ENGINE_MAX_TOPICS];
+
+    /**
+     * The number of registered topics.
+     */
+    uint32 numberOfTopics;
+
+    /**
+     * The time to sleep (in microseconds) after a pass where no message was received.
+     */
+    uint32 idleSleep;
+
+    /**
+     * The thread which polls the topics.
+     */
+    SingleThreadService executor;
+};
+
+}
+/* namespace MARTe */
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SDNRECEIVEENGINE_H_ */
@@ -33,13 +33,13 @@
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "BrokerI.h"
+#include "Endianity.h"
 #include "MemoryMapInputBroker.h"
 #include "MemoryMapSynchronisedInputBroker.h"
+#include "SDNReceiveEngine.h"
 #include "SDNSubscriber.h"
-#ifdef FEATURE_10840
-#include "Endianity.h"
-#endif
 #include "sdn-api.h" /* SDN core library - API definition (sdn::core) */
 /*lint -estring(843,"*crc.h*") ignore could be declared const warning from the crc.h header*/
 /*---------------------------------------------------------------------------*/
@@ -59,6 +59,26 @@ const uint8 SDN_SUB_EXEC_MODE_RTTHREAD = 1u;
  * Execute in the context of a spawned thread.
  */
 const uint8 SDN_SUB_EXEC_MODE_SPAWNED = 2u;
+/**
+ * Execute in the context of the thread shared by all the subscribers (SDNReceiveEngine).
+ */
+const uint8 SDN_SUB_EXEC_MODE_SHARED = 3u;
+/**
+ * Number of polls without messages after which the housekeeping is performed (SharedThread).
+ */
+const uint32 SDN_SUB_SHARED_HOUSEKEEPING_POLLS = 1000u;
+/**
+ * Flag set in the latest-value state when the middle slot holds a message which was not yet read.
+ */
+const int32 SDN_SUB_LATEST_FRESH = 4;
+/**
+ * Mask of the middle slot index in the latest-value state.
+ */
+const int32 SDN_SUB_LATEST_SLOT_MASK = 3;
+/**
+ * Number of statistics signals (see Statistics).
+ */
+const uint32 SDN_SUB_NUMBER_OF_STATISTICS = 5u;
 
 SDNSubscriber::SDNSubscriber() :
         DataSourceI(),
@@ -81,8 +101,46 @@ SDNSubscriber::SDNSubscriber() :
     payloadNumberOfBits = NULL_PTR(uint16 *);
     payloadNumberOfElements = NULL_PTR(uint32 *);
     payloadAddresses = NULL_PTR(void **);
+    payloadOffsets = NULL_PTR(uint32 *);
+    payloadByteSize = NULL_PTR(uint32 *);
+    payloadTotalSize = 0u;
+    latestMemory = NULL_PTR(char8 *);
+    writeSlot = 0;
+    latestState = 1;
+    readSlot = 2;
+    waiting = 0;
+    nOfPayloadSignals = 0u;
+    statistics = false;
+    latency = 0;
+    maxLatency = 0;
+    lostMessages = 0u;
+    lateMessages = 0u;
+    histogram = NULL_PTR(uint32 *);
+    histogramBins = 0u;
+    histogramBinWidth = 1000u;
+    histogramWindow = 0u;
+    histogramCount = 0u;
+    lateThreshold = 0u;
+    lastTopicCounter = 0u;
+    topicCounterValid = false;
     internalTimeout = 0u;
     ignoreTimeoutError = 0u;
+    idleSleep = 0u;
+    sharedRegistered = false;
+    idlePolls = 0u;
+    fragmentSize = 0u;
+    fragmentCounterAttribute = NULL_PTR(uint32 *);
+    fragmentOffsetAttribute = NULL_PTR(uint32 *);
+    fragmentTotalSizeAttribute = NULL_PTR(uint32 *);
+    fragmentDataAttribute = NULL_PTR(char8 *);
+    fragmentedOffset = 0u;
+    fragmentedSize = 0u;
+    numberOfFragments = 0u;
+    fragmentReceived = NULL_PTR(bool *);
+    receivedFragments = 0u;
+    reassemblyCounter = 0u;
+    incompleteMessages = 0u;
+    invalidFragments = 0u;
 }
 
 /*lint -e{1551} the destructor must guarantee that the SDNSubscriber SingleThreadService is stopped and that all the SDN objects are destroyed.*/
@@ -97,6 +155,12 @@ SDNSubscriber::~SDNSubscriber() {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService");
         }
     }
+    if (sharedRegistered) {
+        if (!SDNReceiveEngine::Instance()->Unregister(*this)) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not unregister from the SDNReceiveEngine");
+        }
+        sharedRegistered = false;
+    }
     if (subscriber != NULL_PTR(sdn::Subscriber *)) {
         delete subscriber;
         subscriber = NULL_PTR(sdn::Subscriber *);
@@ -118,6 +182,26 @@ SDNSubscriber::~SDNSubscriber() {
     if (payloadAddresses != NULL_PTR(void **)) {
         delete[] payloadAddresses;
     }
+
+    if (payloadOffsets != NULL_PTR(uint32 *)) {
+        delete[] payloadOffsets;
+    }
+
+    if (payloadByteSize != NULL_PTR(uint32 *)) {
+        delete[] payloadByteSize;
+    }
+
+    if (latestMemory != NULL_PTR(char8 *)) {
+        delete[] latestMemory;
+    }
+
+    if (histogram != NULL_PTR(uint32 *)) {
+        delete[] histogram;
+    }
+
+    if (fragmentReceived != NULL_PTR(bool *)) {
+        delete[] fragmentReceived;
+    }
 }
 
 bool SDNSubscriber::Initialise(StructuredDataI &data) {
@@ -194,16 +278,53 @@ bool SDNSubscriber::Initialise(StructuredDataI &data) {
     else if (executionModeStr == "RealTimeThread") {
         executionMode = SDN_SUB_EXEC_MODE_RTTHREAD;
     }
+    else if (executionModeStr == "SharedThread") {
+        executionMode = SDN_SUB_EXEC_MODE_SHARED;
+    }
     else {
         ok = false;
-        REPORT_ERROR(ErrorManagement::InitialisationError, "The Execution mode must be \"IndependentThread\" or \"RealTimeThread\"");
+        REPORT_ERROR(ErrorManagement::InitialisationError, "The Execution mode must be \"IndependentThread\", \"RealTimeThread\" or \"SharedThread\"");
     }
 
-    if (executionMode == SDN_SUB_EXEC_MODE_SPAWNED) {
+    if ((executionMode == SDN_SUB_EXEC_MODE_SPAWNED) || (executionMode == SDN_SUB_EXEC_MODE_SHARED)) {
         if (data.Read("CPUs", cpuMask)) {
             REPORT_ERROR(ErrorManagement::Information, "Explicit thread affinity '%u'", cpuMask);
         }
     }
+    if (executionMode == SDN_SUB_EXEC_MODE_SHARED) {
+        if (!data.Read("IdleSleep", idleSleep)) {
+            idleSleep = 0u;
+        }
+    }
+
+    uint8 statisticsU = 0u;
+    if (!data.Read("Statistics", statisticsU)) {
+        statisticsU = 0u;
+    }
+    statistics = (statisticsU > 0u);
+    if (statistics) {
+        if (!data.Read("LateThreshold", lateThreshold)) {
+            lateThreshold = 0u;
+        }
+        if (!data.Read("HistogramBinWidth", histogramBinWidth)) {
+            histogramBinWidth = 1000u;
+        }
+        if (!data.Read("HistogramWindow", histogramWindow)) {
+            histogramWindow = 0u;
+        }
+        if (histogramBinWidth == 0u) {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "HistogramBinWidth shall be > 0");
+        }
+    }
+
+    if (data.Read("FragmentSize", fragmentSize)) {
+        REPORT_ERROR(ErrorManagement::Information, "Payload received in fragments of '%u' bytes", fragmentSize);
+    }
+    if ((fragmentSize > 0u) && (executionMode == SDN_SUB_EXEC_MODE_RTTHREAD)) {
+        ok = false;
+        REPORT_ERROR(ErrorManagement::ParametersError, "FragmentSize is not supported with ExecutionMode = RealTimeThread");
+    }
 
     return ok;
 }
@@ -238,6 +359,53 @@ bool SDNSubscriber::SetConfiguredDatabase(StructuredDataI& data) {
         }
     }
 
+    nOfPayloadSignals = nOfSignals;
+    if ((ok) && (statistics)) {
+        uint32 minSignals = (SDN_SUB_NUMBER_OF_STATISTICS + 1u);
+        if (sdnHeaderAsSignal) {
+            minSignals++;
+        }
+        ok = (nOfSignals >= minSignals);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "With Statistics = 1 at least %u signals shall be defined", minSignals);
+        }
+        if (ok) {
+            nOfPayloadSignals = (nOfSignals - SDN_SUB_NUMBER_OF_STATISTICS);
+            ok = (GetSignalType(nOfPayloadSignals) == SignedInteger64Bit);
+            if (ok) {
+                ok = (GetSignalType(nOfPayloadSignals + 1u) == SignedInteger64Bit);
+            }
+            if (ok) {
+                ok = (GetSignalType(nOfPayloadSignals + 2u) == UnsignedInteger32Bit);
+            }
+            if (ok) {
+                ok = (GetSignalType(nOfPayloadSignals + 3u) == UnsignedInteger32Bit);
+            }
+            if (ok) {
+                ok = (GetSignalType(nOfPayloadSignals + 4u) == UnsignedInteger32Bit);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The statistics signals shall be int64, int64, uint32, uint32 and uint32");
+            }
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(nOfSignals - 1u, histogramBins);
+        }
+        if (ok) {
+            ok = (histogramBins > 0u);
+        }
+        if (ok) {
+            if (histogram != NULL_PTR(uint32 *)) {
+                delete[] histogram;
+            }
+            histogram = new uint32[histogramBins];
+            uint32 i;
+            for (i = 0u; i < histogramBins; i++) {
+                histogram[i] = 0u;
+            }
+        }
+    }
+
     //Check if someone is trying to read
 
     return ok;
@@ -298,7 +466,8 @@ bool SDNSubscriber::AllocateMemory() {
             payloadNumberOfElements[signalIndex] = signalNOfElements;
         }
 
-        if (ok) {
+        // With fragmentation the topic is the fragment and not the payload
+        if ((ok) && (signalIndex < nOfPayloadSignals) && (fragmentSize == 0u)) {
             if (sdnHeaderAsSignal) {
                 if (signalIndex > 0u) {
                     ok = (topic->AddAttribute(signalIndex - 1u, signalName.Buffer(), signalTypeName.Buffer(), signalNOfElements) == STATUS_SUCCESS);
@@ -310,6 +479,19 @@ bool SDNSubscriber::AllocateMemory() {
         }
     }
 
+    if ((ok) && (fragmentSize > 0u)) {
+        ok = (topic->AddAttribute(0u, "MessageCounter", "uint32") == STATUS_SUCCESS);
+        if (ok) {
+            ok = (topic->AddAttribute(1u, "Offset", "uint32") == STATUS_SUCCESS);
+        }
+        if (ok) {
+            ok = (topic->AddAttribute(2u, "TotalSize", "uint32") == STATUS_SUCCESS);
+        }
+        if (ok) {
+            ok = (topic->AddAttribute(3u, "Fragment", "uint8", fragmentSize) == STATUS_SUCCESS);
+        }
+    }
+
     if (ok) {
         topic->SetUID(0u); // UID corresponds to the data type but it includes attributes name - Safer to clear with SDN core library 1.0.10
         ok = (topic->Configure() == STATUS_SUCCESS);
@@ -358,8 +540,12 @@ bool SDNSubscriber::AllocateMemory() {
         }
 
         /*lint -e{613} payloadAddresses cannot be NULL in this portion of the code as otherwise ok would be false.*/
-        for (signalIndex = 0u; (signalIndex < nOfSignals) && (ok); signalIndex++) {
-            if (sdnHeaderAsSignal) {
+        for (signalIndex = 0u; (signalIndex < nOfPayloadSignals) && (ok); signalIndex++) {
+            if ((fragmentSize > 0u) && ((!sdnHeaderAsSignal) || (signalIndex > 0u))) {
+                // Reassembled in the slots
+                payloadAddresses[signalIndex] = NULL_PTR(void *);
+            }
+            else if (sdnHeaderAsSignal) {
                 if (signalIndex > 0u) {
                     payloadAddresses[signalIndex] = topic->GetTypeDefinition()->GetAttributeReference(signalIndex - 1u);
                 }
@@ -373,6 +559,71 @@ bool SDNSubscriber::AllocateMemory() {
         }
     }
 
+    if ((ok) && (statistics)) {
+        /*lint -e{613} payloadAddresses cannot be NULL in this portion of the code as otherwise ok would be false.*/
+        payloadAddresses[nOfPayloadSignals] = &latency;
+        payloadAddresses[nOfPayloadSignals + 1u] = &maxLatency;
+        payloadAddresses[nOfPayloadSignals + 2u] = &lostMessages;
+        payloadAddresses[nOfPayloadSignals + 3u] = &lateMessages;
+        payloadAddresses[nOfPayloadSignals + 4u] = histogram;
+    }
+
+    // The receiver thread publishes each message in one of three slots while the brokers read a private copy
+    if ((ok) && (executionMode != SDN_SUB_EXEC_MODE_RTTHREAD)) {
+        payloadOffsets = new uint32[nOfSignals];
+        payloadByteSize = new uint32[nOfSignals];
+        payloadTotalSize = 0u;
+        for (signalIndex = 0u; (signalIndex < nOfSignals) && (ok); signalIndex++) {
+            ok = GetSignalByteSize(signalIndex, payloadByteSize[signalIndex]);
+            if (ok) {
+                payloadOffsets[signalIndex] = payloadTotalSize;
+                payloadTotalSize += payloadByteSize[signalIndex];
+            }
+        }
+        if (ok) {
+            latestMemory = new (std::nothrow) char8[4u * payloadTotalSize];
+            //lint -e{948} std::nothrow => latestMemory may be NULL
+            ok = (latestMemory != NULL_PTR(char8 *));
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(latestMemory, '\0', 4u * payloadTotalSize);
+        }
+    }
+
+    // The fragments are copied at their offset in the slots, where the payload signals are contiguous
+    if ((ok) && (fragmentSize > 0u)) {
+        uint32 firstPayloadSignal = 0u;
+        if (sdnHeaderAsSignal) {
+            firstPayloadSignal = 1u;
+        }
+        ok = (firstPayloadSignal < nOfPayloadSignals);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "With FragmentSize > 0 at least one payload signal shall be defined");
+        }
+        if (ok) {
+            /*lint -e{613} payloadOffsets and payloadByteSize cannot be NULL in this portion of the code as otherwise ok would be false.*/
+            fragmentedOffset = payloadOffsets[firstPayloadSignal];
+            fragmentedSize = (payloadOffsets[nOfPayloadSignals - 1u] + payloadByteSize[nOfPayloadSignals - 1u]) - fragmentedOffset;
+            numberOfFragments = ((fragmentedSize + fragmentSize) - 1u) / fragmentSize;
+            fragmentReceived = new bool[numberOfFragments];
+            for (signalIndex = 0u; signalIndex < numberOfFragments; signalIndex++) {
+                fragmentReceived[signalIndex] = false;
+            }
+            /*lint -e{613} topic cannot be NULL in this portion of the code as otherwise ok would be false.*/
+            sdn::base::AnyType *fragment = topic->GetTypeDefinition();
+            ok = (fragment != NULL_PTR(sdn::base::AnyType *));
+            if (ok) {
+                fragmentCounterAttribute = static_cast<uint32 *>(fragment->GetAttributeReference(0u));
+                fragmentOffsetAttribute = static_cast<uint32 *>(fragment->GetAttributeReference(1u));
+                fragmentTotalSizeAttribute = static_cast<uint32 *>(fragment->GetAttributeReference(2u));
+                fragmentDataAttribute = static_cast<char8 *>(fragment->GetAttributeReference(3u));
+            }
+        }
+        if (ok) {
+            REPORT_ERROR(ErrorManagement::Information, "Payload of '%u' bytes received in '%u' fragments", fragmentedSize, numberOfFragments);
+        }
+    }
+
     if (!ok) {
         REPORT_ERROR(ErrorManagement::InternalSetupError, "Failed to instantiate sdn::Subscriber");
     }
@@ -401,8 +652,14 @@ bool SDNSubscriber::GetSignalMemoryBuffer(const uint32 signalIdx,
     }
 
     if (ok) {
-        /*lint -e{613} The reference can not be NULL in this portion of the code.*/
-        signalAddress = payloadAddresses[signalIdx];
+        if (latestMemory != NULL_PTR(char8 *)) {
+            /*lint -e{613} payloadOffsets cannot be NULL if latestMemory is not NULL.*/
+            signalAddress = &latestMemory[payloadOffsets[signalIdx]];
+        }
+        else {
+            /*lint -e{613} The reference can not be NULL in this portion of the code.*/
+            signalAddress = payloadAddresses[signalIdx];
+        }
     }
 
     return ok;
@@ -610,7 +867,18 @@ bool SDNSubscriber::PrepareNextState(const char8* const currentStateName,
                        ok = executor.Start();
                    }
                }
+               else if (executionMode == SDN_SUB_EXEC_MODE_SHARED) {
+                   if (!sharedRegistered) {
+                       ok = SDNReceiveEngine::Instance()->Register(*this, cpuMask, idleSleep);
+                       sharedRegistered = ok;
+                   }
+               }
+               else {
+                   //NOOP
+               }
            }
+           //Discard the message published before the state change
+           (void) TakeLatest();
            (void) synchronisingSem.Reset();
        }
     }
@@ -626,8 +894,23 @@ bool SDNSubscriber::Synchronise() {
     }
     else {
         // Get latest but don´t wait for next if arrived
-        err = synchronisingSem.Wait(TTTimeout);
-        (void) synchronisingSem.Reset();
+        bool fresh = TakeLatest();
+        if (!fresh) {
+            // Announce the wait and check again, so that a message published in the meantime is either seen here or posted
+            (void) synchronisingSem.Reset();
+            (void) Atomic::Exchange(&waiting, 1);
+            fresh = TakeLatest();
+            if (!fresh) {
+                err = synchronisingSem.Wait(TTTimeout);
+                if (err.ErrorsCleared()) {
+                    fresh = TakeLatest();
+                }
+            }
+            (void) Atomic::Exchange(&waiting, 0);
+        }
+        if ((!fresh) && (err.ErrorsCleared())) {
+            err.SetError(ErrorManagement::Timeout);
+        }
         if (ignoreTimeoutError > 0u) {
             err = ErrorManagement::NoError;
         }
@@ -635,6 +918,214 @@ bool SDNSubscriber::Synchronise() {
     return err.ErrorsCleared();
 }
 
+bool SDNSubscriber::TakeLatest() {
+    bool fresh = false;
+    if (latestMemory != NULL_PTR(char8 *)) {
+        fresh = ((latestState & SDN_SUB_LATEST_FRESH) != 0);
+        if (fresh) {
+            //Take the latest complete message and give back the slot which was read in the previous cycle
+            readSlot = (Atomic::Exchange(&latestState, readSlot) & SDN_SUB_LATEST_SLOT_MASK);
+            fresh = MemoryOperationsHelper::Copy(latestMemory, GetLatestSlot(readSlot), payloadTotalSize);
+        }
+    }
+    return fresh;
+}
+
+char8 *SDNSubscriber::GetLatestSlot(const int32 slot) const {
+    //Slot 0 is the memory read by the brokers
+    /*lint -e{613} latestMemory is checked by the callers.*/
+    return &latestMemory[static_cast<uint32>(slot + 1) * payloadTotalSize];
+}
+
+void SDNSubscriber::UpdateStatistics() {
+    /*lint -e{613} subscriber cannot be NULL when a message was received.*/
+    const sdn::Header_t *header = static_cast<sdn::Header_t *>(subscriber->GetTopicHeader());
+    if (header != NULL_PTR(const sdn::Header_t *)) {
+        uint64 sendTime = static_cast<uint64>(header->send_time);
+        uint64 topicCounter = static_cast<uint64>(header->topic_counter);
+        const uint64 recvTime = static_cast<uint64>(header->recv_time);
+#ifdef FEATURE_10840
+        //The header is converted in place only after the reception of the latest message
+        /*lint -e{613} subscriber cannot be NULL when a message was received.*/
+        if (!subscriber->IsPayloadOrdered()) {
+            Endianity::FromBigEndian(sendTime);
+            Endianity::FromBigEndian(topicCounter);
+        }
+#endif
+        latency = static_cast<int64>(recvTime - sendTime);
+        if (topicCounterValid) {
+            if (topicCounter > (lastTopicCounter + 1u)) {
+                lostMessages += static_cast<uint32>(topicCounter - lastTopicCounter - 1u);
+            }
+        }
+        lastTopicCounter = topicCounter;
+        topicCounterValid = true;
+        if (lateThreshold > 0u) {
+            if (latency > static_cast<int64>(lateThreshold)) {
+                lateMessages++;
+            }
+        }
+        if (histogramWindow > 0u) {
+            if (histogramCount >= histogramWindow) {
+                histogramCount = 0u;
+                maxLatency = 0;
+                uint32 i;
+                for (i = 0u; i < histogramBins; i++) {
+                    /*lint -e{613} histogram cannot be NULL if statistics is true.*/
+                    histogram[i] = 0u;
+                }
+            }
+        }
+        histogramCount++;
+        if (latency > maxLatency) {
+            maxLatency = latency;
+        }
+        uint64 bin = 0u;
+        if (latency > 0) {
+            bin = (static_cast<uint64>(latency) / histogramBinWidth);
+        }
+        if (bin >= histogramBins) {
+            bin = (histogramBins - 1u);
+        }
+        /*lint -e{613} histogram cannot be NULL if statistics is true.*/
+        histogram[bin]++;
+    }
+}
+
+void SDNSubscriber::PublishLatest() {
+    char8 *const slotMemory = GetLatestSlot(writeSlot);
+    uint32 signalIndex;
+    for (signalIndex = 0u; signalIndex < nOfSignals; signalIndex++) {
+        //The fragmented payload signals are already in the slot
+        bool reassembled = ((fragmentSize > 0u) && (signalIndex < nOfPayloadSignals));
+        if ((reassembled) && (sdnHeaderAsSignal)) {
+            reassembled = (signalIndex > 0u);
+        }
+        if (!reassembled) {
+            /*lint -e{613} the accelerators cannot be NULL if latestMemory is not NULL.*/
+            (void) MemoryOperationsHelper::Copy(&slotMemory[payloadOffsets[signalIndex]], payloadAddresses[signalIndex], payloadByteSize[signalIndex]);
+        }
+    }
+    //Publish the complete message and continue with the slot which was published before (or given back by Synchronise)
+    writeSlot = (Atomic::Exchange(&latestState, (writeSlot | SDN_SUB_LATEST_FRESH)) & SDN_SUB_LATEST_SLOT_MASK);
+}
+
+bool SDNSubscriber::ReceiveFragment() {
+    /*lint -e{613} the fragment attributes cannot be NULL if fragmentSize > 0.*/
+    uint32 counter = *fragmentCounterAttribute;
+    uint32 offset = *fragmentOffsetAttribute;
+    uint32 totalSize = *fragmentTotalSizeAttribute;
+#ifdef FEATURE_10840
+    /*lint -e{613} subscriber cannot be NULL when a message was received.*/
+    const bool swap = !subscriber->IsPayloadOrdered();
+    if (swap) {
+        Endianity::FromBigEndian(counter);
+        Endianity::FromBigEndian(offset);
+        Endianity::FromBigEndian(totalSize);
+    }
+#endif
+    bool valid = ((totalSize == fragmentedSize) && (offset < totalSize));
+    if (valid) {
+        valid = ((offset % fragmentSize) == 0u);
+    }
+    bool complete = false;
+    if (!valid) {
+        invalidFragments++;
+    }
+    else {
+        if ((receivedFragments == 0u) || (counter != reassemblyCounter)) {
+            if (receivedFragments > 0u) {
+                //A fragment of another message arrived before the previous message was complete
+                incompleteMessages++;
+            }
+            uint32 i;
+            for (i = 0u; i < numberOfFragments; i++) {
+                /*lint -e{613} fragmentReceived cannot be NULL if fragmentSize > 0.*/
+                fragmentReceived[i] = false;
+            }
+            receivedFragments = 0u;
+            reassemblyCounter = counter;
+        }
+        const uint32 index = (offset / fragmentSize);
+        /*lint -e{613} fragmentReceived cannot be NULL if fragmentSize > 0.*/
+        if (!fragmentReceived[index]) {
+            uint32 length = (totalSize - offset);
+            if (length > fragmentSize) {
+                length = fragmentSize;
+            }
+            //Straight into the slot which is published when the message is complete
+            (void) MemoryOperationsHelper::Copy(&(GetLatestSlot(writeSlot)[fragmentedOffset + offset]), fragmentDataAttribute, length);
+            fragmentReceived[index] = true;
+            receivedFragments++;
+        }
+        complete = (receivedFragments == numberOfFragments);
+    }
+    if (complete) {
+#ifdef FEATURE_10840
+        if (swap) {
+            FromNetworkByteOrder(GetLatestSlot(writeSlot));
+        }
+#endif
+        PublishLatest();
+        receivedFragments = 0u;
+    }
+    return complete;
+}
+
+void SDNSubscriber::FromNetworkByteOrder(char8 * const reassembled) {
+    uint32 signalIndex = 0u;
+    if (sdnHeaderAsSignal) {
+        /*lint -e{613} payloadAddresses cannot be NULL when a message was received.*/
+        sdn::Header_t *header = static_cast<sdn::Header_t *>(payloadAddresses[0u]);
+        Endianity::FromBigEndian(header->header_size);
+        // Receive time is written by SDN library in local machine, therefore it already has the right order
+        //Endianity::FromBigEndian(reinterpret_cast<uint64 &>(header->recv_time));
+        Endianity::FromBigEndian(reinterpret_cast<uint64 &>(header->send_time));
+        Endianity::FromBigEndian(reinterpret_cast<uint64 &>(header->topic_counter));
+        Endianity::FromBigEndian(header->topic_size);
+        Endianity::FromBigEndian(header->topic_uid);
+        Endianity::FromBigEndian(header->topic_version);
+        signalIndex = 1u;
+    }
+    for (; (signalIndex < nOfPayloadSignals); signalIndex++) {
+        /*lint -e{613} the accelerators cannot be NULL when a message was received.*/
+        void *address = payloadAddresses[signalIndex];
+        if (reassembled != NULL_PTR(char8 *)) {
+            address = &reassembled[payloadOffsets[signalIndex]];
+        }
+        if (payloadNumberOfBits[signalIndex] == 16u) {
+            uint32 elementIndex;
+            for (elementIndex = 0u; (elementIndex < payloadNumberOfElements[signalIndex]); elementIndex++) {
+                Endianity::FromBigEndian(reinterpret_cast<uint16 *>(address)[elementIndex]);
+            }
+        }
+        if (payloadNumberOfBits[signalIndex] == 32u) {
+            uint32 elementIndex;
+            for (elementIndex = 0u; (elementIndex < payloadNumberOfElements[signalIndex]); elementIndex++) {
+                Endianity::FromBigEndian(reinterpret_cast<uint32 *>(address)[elementIndex]);
+            }
+        }
+        if (payloadNumberOfBits[signalIndex] == 64u) {
+            uint32 elementIndex;
+            for (elementIndex = 0u; (elementIndex < payloadNumberOfElements[signalIndex]); elementIndex++) {
+                Endianity::FromBigEndian(reinterpret_cast<uint64 *>(address)[elementIndex]);
+            }
+        }
+    }
+}
+
+uint32 SDNSubscriber::GetFragmentSize() const {
+    return fragmentSize;
+}
+
+uint32 SDNSubscriber::GetNumberOfIncompleteMessages() const {
+    return incompleteMessages;
+}
+
+uint32 SDNSubscriber::GetNumberOfInvalidFragments() const {
+    return invalidFragments;
+}
+
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the method operates regardless of the input parameter.*/
 ErrorManagement::ErrorType SDNSubscriber::Execute(ExecutionInfo& info) {
 
@@ -648,9 +1139,11 @@ ErrorManagement::ErrorType SDNSubscriber::Execute(ExecutionInfo& info) {
         Sleep::MSec(100u);
     }
 
+    //With fragmentation a message is only complete when all its fragments were received
+    bool complete = false;
     if (ok) {
         bool needBlock = true;
-        if (executionMode == SDN_SUB_EXEC_MODE_RTTHREAD) {
+        if ((executionMode == SDN_SUB_EXEC_MODE_RTTHREAD) || (executionMode == SDN_SUB_EXEC_MODE_SHARED)) {
             //Get latest implementation, empty the stack
 
             bool empty = false;
@@ -659,13 +1152,33 @@ ErrorManagement::ErrorType SDNSubscriber::Execute(ExecutionInfo& info) {
                 empty = (subscriber->Receive(0ul) != STATUS_SUCCESS);
                 if (!empty) {
                     needBlock = false;
+                    if (statistics) {
+                        UpdateStatistics();
+                    }
+                    if (fragmentSize > 0u) {
+                        if (ReceiveFragment()) {
+                            complete = true;
+                        }
+                    }
                 }
             }
         }
 
         if (needBlock) {
-            /*lint -e{613} The reference can not be NULL in this portion of the code.*/
-            ok = (subscriber->Receive(static_cast<osulong>(internalTimeout)) == STATUS_SUCCESS);
+            if (executionMode == SDN_SUB_EXEC_MODE_SHARED) {
+                //Never block the thread shared with the other topics
+                ok = false;
+            }
+            else {
+                /*lint -e{613} The reference can not be NULL in this portion of the code.*/
+                ok = (subscriber->Receive(static_cast<osulong>(internalTimeout)) == STATUS_SUCCESS);
+                if ((ok) && (statistics)) {
+                    UpdateStatistics();
+                }
+                if ((ok) && (fragmentSize > 0u)) {
+                    complete = ReceiveFragment();
+                }
+            }
         }
 
         if (!ok) {
@@ -673,69 +1186,65 @@ ErrorManagement::ErrorType SDNSubscriber::Execute(ExecutionInfo& info) {
             err.SetError(ErrorManagement::Timeout);
         }
 #ifdef FEATURE_10840
-        else {
+        else if (fragmentSize == 0u) {
+            /*lint -e{613} The reference can not be NULL in this portion of the code.*/
             if (!subscriber->IsPayloadOrdered()) {
-                // Convert payload from network byte order
-                uint32 signalIndex = 0u;
-                if (sdnHeaderAsSignal) {
-                    sdn::Header_t *header = static_cast<sdn::Header_t *>(payloadAddresses[0u]);
-                    Endianity::FromBigEndian(header->header_size);
-                    // Receive time is written by SDN library in local machine, therefore it already has the right order
-                    //Endianity::FromBigEndian(reinterpret_cast<uint64 &>(header->recv_time));
-                    Endianity::FromBigEndian(reinterpret_cast<uint64 &>(header->send_time));
-                    Endianity::FromBigEndian(reinterpret_cast<uint64 &>(header->topic_counter));
-                    Endianity::FromBigEndian(header->topic_size);
-                    Endianity::FromBigEndian(header->topic_uid);
-                    Endianity::FromBigEndian(header->topic_version);
-                    signalIndex = 1u;
-                }
-                for (; (signalIndex < nOfSignals); signalIndex++) {
-                    if (payloadNumberOfBits[signalIndex] == 16u) {
-                        uint32 elementIndex;
-                        for (elementIndex = 0u; (elementIndex < payloadNumberOfElements[signalIndex]); elementIndex++) {
-                            Endianity::FromBigEndian(reinterpret_cast<uint16 *>(payloadAddresses[signalIndex])[elementIndex]);
-                        }
-                    }
-                    if (payloadNumberOfBits[signalIndex] == 32u) {
-                        uint32 elementIndex;
-                        for (elementIndex = 0u; (elementIndex < payloadNumberOfElements[signalIndex]); elementIndex++) {
-                            Endianity::FromBigEndian(reinterpret_cast<uint32 *>(payloadAddresses[signalIndex])[elementIndex]);
-                        }
-                    }
-                    if (payloadNumberOfBits[signalIndex] == 64u) {
-                        uint32 elementIndex;
-                        for (elementIndex = 0u; (elementIndex < payloadNumberOfElements[signalIndex]); elementIndex++) {
-                            Endianity::FromBigEndian(reinterpret_cast<uint64 *>(payloadAddresses[signalIndex])[elementIndex]);
-                        }
-                    }
-                }
+                FromNetworkByteOrder(NULL_PTR(char8 *));
             }
         }
+        else {
+            //NOOP (converted when the message is complete)
+        }
 #endif
-
+        if (fragmentSize == 0u) {
+            complete = ok;
+        }
     }
 
-    if (ok) {
-        ok = synchronisingSem.Post();
+    if ((complete) && (latestMemory != NULL_PTR(char8 *))) {
+        //The fragmented messages are published as soon as they are complete
+        if (fragmentSize == 0u) {
+            PublishLatest();
+        }
+        //Only enter the kernel if Synchronise is waiting
+        if (waiting != 0) {
+            ok = synchronisingSem.Post();
 
-        if (!ok) {
-            REPORT_ERROR(ErrorManagement::FatalError, "EventSem::Post failed");
-            err.SetError(ErrorManagement::FatalError);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "EventSem::Post failed");
+                err.SetError(ErrorManagement::FatalError);
+            }
         }
     }
 
-    //ignore the timeout if spawned
-    if ((executionMode == SDN_SUB_EXEC_MODE_SPAWNED) || (ignoreTimeoutError > 0u)) {
+    //ignore the timeout if spawned (the SDNReceiveEngine uses it to detect idle passes)
+    if ((executionMode == SDN_SUB_EXEC_MODE_SPAWNED) || ((ignoreTimeoutError > 0u) && (executionMode != SDN_SUB_EXEC_MODE_SHARED))) {
         if (err.Contains(ErrorManagement::Timeout)) {
             // Ignore Timeout error for now
             err.ClearError(ErrorManagement::Timeout);
         }
     }
+    bool housekeeping = true;
+    if (executionMode == SDN_SUB_EXEC_MODE_SHARED) {
+        //Avoid the housekeeping at every idle poll
+        if (ok) {
+            idlePolls = 0u;
+        }
+        else {
+            idlePolls++;
+            housekeeping = (idlePolls >= SDN_SUB_SHARED_HOUSEKEEPING_POLLS);
+            if (housekeeping) {
+                idlePolls = 0u;
+            }
+        }
+    }
 #ifdef FEATURE_10840
-    if (subscriber != NULL_PTR(sdn::Subscriber *)) {
+    if ((housekeeping) && (subscriber != NULL_PTR(sdn::Subscriber *))) {
        // Perform housekeeping activities .. irrespective of status
        (void)subscriber->DoBackgroundActivity();
     }
+#else
+    (void) housekeeping;
 #endif
     return err;
 }
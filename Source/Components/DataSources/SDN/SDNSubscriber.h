@@ -91,14 +91,20 @@ namespace MARTe {
  * <pre>
  * +Subscriber = {
  *     Class = SDNSubscriber
- *     ExecutionMode = IndependentThread // Optional, it can be IndependentThread (default) or RealTimeThread
+ *     ExecutionMode = IndependentThread // Optional, it can be IndependentThread (default), RealTimeThread or SharedThread
  *     Topic = "name" // The name is used to establish many-to-many communication channels
  *     Interface = "name" // The network interface name to be used
  *     Address = address:port // Optional - Explicit destination address
  *     Timeout = timeout_in_ms // Optional - Used for synchronising mode semaphore. It corresponds to the Synchronise() timeout if ExecutionMode==Independent
  *     InternalTimoeut = timeout_in_ns //Optional - The internal thread receive call timeout. It corresponds to the Synchronise() timeout if ExecutionMode==RealTimeThread (Default 1s)
- *     CPUs = cpumask // Optional - Explicit affinity for the thread
+ *     CPUs = cpumask // Optional - Explicit affinity for the thread (with SharedThread, the one of the first subscriber which starts the shared thread)
+ *     IdleSleep = 0 // Optional - Only with SharedThread. Microseconds slept by the shared thread when no topic was received in a pass (Default 0, i.e. busy-poll)
  *     IgnoreTimeoutError = 0 // Optional. If 1, Synchronise() returns true in case of timeout. (Default 0)
+ *     Statistics = 0 // Optional. If 1 the last five signals are the reception statistics (see below). (Default 0)
+ *     LateThreshold = 0 // Optional - Only with Statistics = 1. Latency in nanoseconds above which a message is counted as late (Default 0, i.e. disabled)
+ *     HistogramBinWidth = 1000 // Optional - Only with Statistics = 1. Width in nanoseconds of each bin of the latency histogram (Default 1000)
+ *     HistogramWindow = 0 // Optional - Only with Statistics = 1. Number of messages after which the histogram and the maximum latency are restarted (Default 0, i.e. never)
+ *     FragmentSize = 1400 // Optional - Not with RealTimeThread. The payload is published in fragments of FragmentSize bytes (see SDNPublisher) (Default 0, i.e. one datagram)
  *     Signals = {
  *         Header = { //Optional. If present (i.e. if there is a signal named header) the received packet header will be copied into this field (note that it can be later decomposed by GAMs using Ranges). It shall be the first signal.
  *             Type = uint8
@@ -120,6 +126,14 @@ namespace MARTe {
  * The DataSource relies on a MemoryMapInputBroker to interface to GAM signals. The DataSource
  * does not allocate memory, rather maps directly the signals to the SDN message payload directly.
  *
+ * If Statistics = 1 the last five signals are not part of the topic and shall be, in this order: the one-way latency of the
+ * last message in nanoseconds (int64), the maximum latency (int64), the number of lost messages (uint32), the number of late
+ * messages (uint32) and the latency histogram (uint32, with one element for each bin, the last bin also counting the latencies
+ * above the range and the first one the negative latencies). The latency is the difference between the receive time and the
+ * send time stamped in the SDN header by the library on each node, so that it is only meaningful if the clocks are synchronised
+ * (e.g. PTP). A message is lost if its topic counter skips one or more values. The statistics are updated for every message
+ * received, including the ones which are overwritten by a more recent message before being read.
+ *
  * The DataSource can be used in asynchronous (caching) mode whereby the RT threads are
  * synchronised with an alternative method and the SDNSubscriber holds whichever signal
  * samples were last received.
@@ -128,6 +142,24 @@ namespace MARTe {
  * application real-time threads are synchronised using an alternate source, in which case the
  * DataSource only provides the last received payload,
  *
+ * With ExecutionMode = SharedThread all the SDNSubscriber instances in the process are received by one thread (see SDNReceiveEngine),
+ * which polls (without blocking) every topic in turn, leaving the latest message of each topic in its own buffer and posting
+ * the synchronisation semaphore of the topic. This replaces one receiver thread per topic (and the related wakeups) when many
+ * topics are subscribed. Synchronise behaves as with IndependentThread.
+ *
+ * With ExecutionMode = IndependentThread or SharedThread the receiver thread copies each complete message into one of three
+ * slots and publishes it with an atomic exchange (latest-value triple buffer), while the brokers read a private copy of the
+ * signals. Synchronise returns the latest message received since the previous call to Synchronise: if one is available it is taken
+ * without any system call, otherwise Synchronise waits (up to Timeout) for the next one. Older messages are discarded and a
+ * message is never returned twice. The semaphore is only posted by the receiver thread when Synchronise is waiting.
+ *
+ * With FragmentSize > 0 the payload (all the signals but the Header and the statistics) is received in fragments published by a
+ * SDNPublisher with the same FragmentSize and signals. The receiver thread copies each fragment, at its offset, directly into the
+ * write slot of the triple buffer (no reassembly buffer) and the slot is only published when all the fragments of the message were
+ * received, in any order. A message which is not complete when a fragment of another message arrives is discarded and counted
+ * (see GetNumberOfIncompleteMessages()), as well as the fragments which do not match the configured payload
+ * (see GetNumberOfInvalidFragments()). The Header signal holds the header of the last fragment and the Statistics count the fragments.
+ *
  * @warning The DataSource does not support signal samples batching.
  *
  * @warning The data payload over the network is structured in the same way as the signal definition
@@ -162,7 +194,7 @@ SDNSubscriber    ();
      * <pre>
      * +Subscriber = {
      *     Class = SDNSubscriber
-     *     ExecutionMode = "mode" // Optonal - The execution mode can be IndependentThread (default) or RealTimeThread.
+     *     ExecutionMode = "mode" // Optonal - The execution mode can be IndependentThread (default), RealTimeThread or SharedThread.
      *     Topic = "name" // The name is used to establish many-to-many communication channels
      *     Interface = "name" // The network interface name to be used, e.g. eth0
      *     Address = address:port // Optional - Explicit destination address
@@ -185,7 +217,7 @@ SDNSubscriber    ();
      * synchronised to the SDN reception).
      * The execution mode can be \a IndepedentThread or \a RealTimeThread. When \a IndependentThread, an internal thread
      * unblocks the RTTs waiting on Synchronise() when a packet is received. If \a RealTimeThread, the RTT calls
-     * directly the sdn receive API using the \a InternalTimeout
+     * directly the sdn receive API using the \a InternalTimeout. If \a SharedThread, the topic is polled by the SDNReceiveEngine thread.
      * @warning The unicast behaviour is selected by means of specifying any destination address
      * within the IPv4 unicast address range. The socket is bound to the named interface and the
      * address is not used.
@@ -205,7 +237,8 @@ SDNSubscriber    ();
     /**
      * @brief See DataSourceI::AllocateMemory.
      * @details The method instantiate a sdn::Topic and sdn::Subscriber, and used the transport message
-     * buffer inside the sdn::Subscriber as memory for output signals.
+     * buffer inside the sdn::Subscriber as memory for output signals. With IndependentThread or SharedThread the
+     * signals are instead read from a private copy, which is refreshed by Synchronise from the latest-value triple buffer.
      * @return false in case or exception inside the SDN core library.
      */
     virtual bool AllocateMemory();
@@ -266,23 +299,76 @@ SDNSubscriber    ();
 
     /**
      * @brief See DataSourceI::Synchronise.
-     * @details The method waits for a synchronisation semaphore which is posted by the
-     * EmbeddedThread upon successful message reception.
-     * @return true or false in case of error within the SDN core library.
+     * @details With RealTimeThread the method calls Execute. Otherwise, the method takes the latest message published by the
+     * receiver thread since the previous call or, if there is none, waits for the synchronisation semaphore which is
+     * posted by the receiver thread upon the next message reception.
+     * @return true or false in case of timeout (unless IgnoreTimeoutError is set) or of error within the SDN core library.
      */
     virtual bool Synchronise();
 
     /**
      * @brief Callback function for an EmbeddedThread.
      * @details The method calls sdn::Subscriber::Receive and posts an EventSem to
-     * notify the Synchronise method.
+     * notify the Synchronise method. With ExecutionMode = SharedThread the method is called by the
+     * SDNReceiveEngine and it does not block.
      * @param[in] info not used.
-     * @return NoError if the EventSem can be successfully posted.
+     * @return NoError if the EventSem can be successfully posted (with SharedThread, Timeout if no message was available).
      */
     virtual ErrorManagement::ErrorType Execute(ExecutionInfo & info);
 
+    /**
+     * @brief Gets the maximum number of payload bytes of each received message.
+     * @return the FragmentSize (0 if the payload is not fragmented).
+     */
+    uint32 GetFragmentSize() const;
+
+    /**
+     * @brief Gets the number of fragmented messages which were discarded because some of their fragments were not received.
+     * @return the number of incomplete messages.
+     */
+    uint32 GetNumberOfIncompleteMessages() const;
+
+    /**
+     * @brief Gets the number of fragments discarded because their payload size or offset do not match the configured payload.
+     * @return the number of invalid fragments.
+     */
+    uint32 GetNumberOfInvalidFragments() const;
+
 private:
 
+    /**
+     * @brief Copies the fragment just received into the write slot at its offset.
+     * @return true if the message in the write slot is complete.
+     */
+    bool ReceiveFragment();
+
+    /**
+     * @brief Converts the header and the payload from network byte order.
+     * @param[in] reassembled the slot where the payload was reassembled (NULL if the payload is in the topic).
+     */
+    void FromNetworkByteOrder(char8 * const reassembled);
+
+    /**
+     * @brief Copies the latest published message (if not yet read) into the memory read by the brokers.
+     * @return true if a message not yet read was available.
+     */
+    bool TakeLatest();
+
+    /**
+     * @brief Copies the signals of the received message into the write slot and publishes it.
+     */
+    void PublishLatest();
+
+    /**
+     * @brief Gets the address of a slot of the latest-value triple buffer.
+     */
+    char8 *GetLatestSlot(const int32 slot) const;
+
+    /**
+     * @brief Updates the reception statistics with the header of the message just received (see Statistics).
+     */
+    void UpdateStatistics();
+
     /**
      * Interface name configuration parameter
      */
@@ -358,6 +444,46 @@ private:
      */
     void **payloadAddresses;
 
+    /**
+     * Offset of each signal in the memory read by the brokers (IndependentThread and SharedThread).
+     */
+    uint32 *payloadOffsets;
+
+    /**
+     * Size in bytes of each signal (IndependentThread and SharedThread).
+     */
+    uint32 *payloadByteSize;
+
+    /**
+     * Sum of payloadByteSize.
+     */
+    uint32 payloadTotalSize;
+
+    /**
+     * The memory read by the brokers followed by the three slots of the triple buffer (NULL with RealTimeThread).
+     */
+    char8 *latestMemory;
+
+    /**
+     * The slot being written by the receiver thread.
+     */
+    int32 writeSlot;
+
+    /**
+     * The slot exchanged between the receiver thread and Synchronise, with the FRESH flag set when it holds a message not yet read.
+     */
+    volatile int32 latestState;
+
+    /**
+     * The slot read by Synchronise.
+     */
+    int32 readSlot;
+
+    /**
+     * 1 while Synchronise waits on the synchronisingSem.
+     */
+    volatile int32 waiting;
+
     /**
      * Read the SDN header as a signal?
     */
@@ -377,6 +503,144 @@ private:
      * Ignore timeout flag
      */
     uint8 ignoreTimeoutError;
+
+    /**
+     * The IdleSleep of the shared thread (microseconds).
+     */
+    uint32 idleSleep;
+
+    /**
+     * True if registered in the SDNReceiveEngine.
+     */
+    bool sharedRegistered;
+
+    /**
+     * Number of polls without messages since the last housekeeping (SharedThread).
+     */
+    uint32 idlePolls;
+
+    /**
+     * Number of signals which are part of the topic (nOfSignals minus the statistics signals).
+     */
+    uint32 nOfPayloadSignals;
+
+    /**
+     * True if the last signals are the reception statistics.
+     */
+    bool statistics;
+
+    /**
+     * The one-way latency of the last message (ns).
+     */
+    int64 latency;
+
+    /**
+     * The maximum latency since the start of the histogram window (ns).
+     */
+    int64 maxLatency;
+
+    /**
+     * The number of lost messages.
+     */
+    uint32 lostMessages;
+
+    /**
+     * The number of messages with a latency above lateThreshold.
+     */
+    uint32 lateMessages;
+
+    /**
+     * The latency histogram.
+     */
+    uint32 *histogram;
+
+    /**
+     * The number of bins of the histogram.
+     */
+    uint32 histogramBins;
+
+    /**
+     * The width of each bin (ns).
+     */
+    uint64 histogramBinWidth;
+
+    /**
+     * The number of messages after which the histogram is restarted (0 for never).
+     */
+    uint32 histogramWindow;
+
+    /**
+     * The number of messages in the current histogram window.
+     */
+    uint32 histogramCount;
+
+    /**
+     * See LateThreshold.
+     */
+    uint64 lateThreshold;
+
+    /**
+     * The topic counter of the last message.
+     */
+    uint64 lastTopicCounter;
+
+    /**
+     * True after the first message was received.
+     */
+    bool topicCounterValid;
+
+    /**
+     * Maximum number of payload bytes of each message (0 if the payload is not fragmented).
+     */
+    uint32 fragmentSize;
+
+    /**
+     * The attributes of the fragment topic: message counter, offset, payload size and data.
+     */
+    uint32 *fragmentCounterAttribute;
+    uint32 *fragmentOffsetAttribute;
+    uint32 *fragmentTotalSizeAttribute;
+    char8 *fragmentDataAttribute;
+
+    /**
+     * Offset of the fragmented payload in a slot.
+     */
+    uint32 fragmentedOffset;
+
+    /**
+     * Size of the fragmented payload.
+     */
+    uint32 fragmentedSize;
+
+    /**
+     * Number of fragments of a message.
+     */
+    uint32 numberOfFragments;
+
+    /**
+     * The fragments of the message being reassembled which were already received.
+     */
+    bool *fragmentReceived;
+
+    /**
+     * Number of fragments of the message being reassembled which were already received.
+     */
+    uint32 receivedFragments;
+
+    /**
+     * The counter of the message being reassembled.
+     */
+    uint32 reassemblyCounter;
+
+    /**
+     * See GetNumberOfIncompleteMessages().
+     */
+    uint32 incompleteMessages;
+
+    /**
+     * See GetNumberOfInvalidFragments().
+     */
+    uint32 invalidFragments;
 };
 
 }
@@ -0,0 +1,82 @@
+/**
+ * @file TCPStreamFrame.h
+ * @brief Header file for the TCPStream frame header
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the frame header which is shared
+ * by the TCPStreamWriter and the TCPStreamReader.
+ */
+
+#ifndef TCPSTREAMFRAME_H_
+#define TCPSTREAMFRAME_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The header which precedes the payload (the signals) of each frame of the TCP stream (host byte order, as the payload).
+ */
+struct TCPStreamFrameHeader {
+    /**
+     * TCP_STREAM_FRAME_MAGIC.
+     */
+    uint32 magic;
+
+    /**
+     * The number of bytes of the payload which follows the header.
+     */
+    uint32 payloadSize;
+
+    /**
+     * The cycle of the TCPStreamWriter which produced the frame. Incremented by one in every cycle, also for the frames which were
+     * dropped, so that the gaps give the number of lost frames.
+     */
+    uint64 sequence;
+};
+
+/**
+ * The value of TCPStreamFrameHeader::magic.
+ */
+static const uint32 TCP_STREAM_FRAME_MAGIC = 0x4D535354u;
+
+/**
+ * The size of TCPStreamFrameHeader.
+ */
+static const uint32 TCP_STREAM_FRAME_HEADER_SIZE = 16u;
+
+/**
+ * The maximum time (in milliseconds) that the I/O threads block in a system call, so that they can always be stopped.
+ */
+static const int32 TCP_STREAM_IO_TIMEOUT_MSEC = 100;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TCPSTREAMFRAME_H_ */
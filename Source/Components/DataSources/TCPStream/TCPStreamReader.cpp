@@ -0,0 +1,409 @@
+/**
+ * @file TCPStreamReader.cpp
+ * @brief Source file for class TCPStreamReader
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class TCPStreamReader (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "MemoryOperationsHelper.h"
+#include "TCPStreamReader.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * Flag set in the triple buffer state when the middle slot holds a frame which was not yet read.
+ */
+static const MARTe::int32 TCP_STREAM_READER_TRIPLE_BUFFER_FRESH = 4;
+
+/**
+ * Mask of the middle slot index in the triple buffer state.
+ */
+static const MARTe::int32 TCP_STREAM_READER_TRIPLE_BUFFER_SLOT_MASK = 3;
+
+/**
+ * Number of signals holding the frame counters when Statistics = 1.
+ */
+static const MARTe::uint32 TCP_STREAM_READER_STATISTICS_SIGNALS = 2u;
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+TCPStreamReader::TCPStreamReader() :
+        MemoryDataSourceI(),
+        EmbeddedServiceMethodBinderI(),
+        executor(*this) {
+    cpuMask = 0xFFFFFFFFu;
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+    port = 0u;
+    receiveBufferSize = 0u;
+    statistics = false;
+    payloadOffset = 0u;
+    payloadSize = 0u;
+    listenFd = -1;
+    connectionFd = -1;
+    header.magic = 0u;
+    header.payloadSize = 0u;
+    header.sequence = 0u;
+    receivedBytes = 0u;
+    slots = NULL_PTR(char8 *);
+    writeSlot = 0;
+    tripleBufferState = 1;
+    readSlot = 2;
+    hasSequence = false;
+    expectedSequence = 0u;
+    numberOfFrames = 0u;
+    numberOfLostFrames = 0u;
+    numberOfInvalidFrames = 0u;
+    numberOfConnections = 0u;
+}
+
+/*lint -e{1551} the destructor must guarantee that the I/O thread is stopped before the slots are freed.*/
+TCPStreamReader::~TCPStreamReader() {
+    if (!executor.Stop()) {
+        if (!executor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    CloseConnection();
+    if (listenFd >= 0) {
+        (void) close(listenFd);
+    }
+    if (slots != NULL_PTR(char8 *)) {
+        void *slotsMemory = slots;
+        memoryHeap->Free(slotsMemory);
+    }
+}
+
+bool TCPStreamReader::Initialise(StructuredDataI &data) {
+    bool ok = MemoryDataSourceI::Initialise(data);
+    if (ok) {
+        ok = data.Read("Port", port);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Port shall be specified");
+        }
+    }
+    if (ok) {
+        if (!data.Read("ReceiveBufferSize", receiveBufferSize)) {
+            receiveBufferSize = 0u;
+        }
+        uint32 statisticsIn = 0u;
+        if (data.Read("Statistics", statisticsIn)) {
+            statistics = (statisticsIn == 1u);
+        }
+        if (!data.Read("CPUMask", cpuMask)) {
+            cpuMask = 0xFFFFFFFFu;
+        }
+        if (!data.Read("StackSize", stackSize)) {
+            stackSize = THREADS_DEFAULT_STACKSIZE;
+        }
+        ok = placement.Initialise(data);
+    }
+    return ok;
+}
+
+bool TCPStreamReader::SetConfiguredDatabase(StructuredDataI &data) {
+    bool ok = MemoryDataSourceI::SetConfiguredDatabase(data);
+    uint32 nOfSignals = GetNumberOfSignals();
+    uint32 firstPayloadSignal = 0u;
+    uint32 s;
+    if ((ok) && (statistics)) {
+        for (s = 0u; (s < TCP_STREAM_READER_STATISTICS_SIGNALS) && (ok); s++) {
+            uint32 nOfElements = 0u;
+            ok = (s < nOfSignals);
+            if (ok) {
+                ok = GetSignalNumberOfElements(s, nOfElements);
+            }
+            if (ok) {
+                ok = (GetSignalType(s) == UnsignedInteger32Bit) && (nOfElements == 1u);
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "With Statistics = 1 the first two signals (frames and lost frames) shall be uint32 scalars");
+        }
+        firstPayloadSignal = TCP_STREAM_READER_STATISTICS_SIGNALS;
+        payloadOffset = TCP_STREAM_READER_STATISTICS_SIGNALS * static_cast<uint32>(sizeof(uint32));
+    }
+    if (ok) {
+        ok = (nOfSignals > firstPayloadSignal);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "At least one signal shall be received");
+        }
+    }
+    payloadSize = 0u;
+    for (s = firstPayloadSignal; (s < nOfSignals) && (ok); s++) {
+        uint32 signalSize = 0u;
+        ok = GetSignalByteSize(s, signalSize);
+        payloadSize += signalSize;
+    }
+    if (ok) {
+        listenFd = socket(AF_INET, SOCK_STREAM, 0);
+        ok = (listenFd >= 0);
+        if (ok) {
+            int32 one = 1;
+            ok = (setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, static_cast<socklen_t>(sizeof(one))) == 0);
+        }
+        if ((ok) && (receiveBufferSize > 0u)) {
+            //Set on the listening socket so that it is inherited by the accepted connections (and used for the TCP window scaling)
+            int32 size = static_cast<int32>(receiveBufferSize);
+            if (setsockopt(listenFd, SOL_SOCKET, SO_RCVBUF, &size, static_cast<socklen_t>(sizeof(size))) != 0) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not set SO_RCVBUF to %d", receiveBufferSize);
+            }
+        }
+        if (ok) {
+            struct sockaddr_in local;
+            (void) memset(&local, 0, sizeof(local));
+            local.sin_family = AF_INET;
+            local.sin_port = htons(port);
+            local.sin_addr.s_addr = htonl(INADDR_ANY);
+            /*lint -e{740} -e{929} sockaddr_in is the IPv4 sockaddr*/
+            ok = (bind(listenFd, reinterpret_cast<struct sockaddr *>(&local), static_cast<socklen_t>(sizeof(local))) == 0);
+        }
+        if (ok) {
+            ok = (listen(listenFd, 1) == 0);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not listen on the port %d", port);
+        }
+    }
+    if (ok) {
+        executor.SetName(GetName());
+        executor.SetCPUMask(cpuMask);
+        placement.Apply(executor);
+        executor.SetStackSize(stackSize);
+    }
+    return ok;
+}
+
+bool TCPStreamReader::AllocateMemory() {
+    bool ok = MemoryDataSourceI::AllocateMemory();
+    if (ok) {
+        slots = reinterpret_cast<char8 *>(memoryHeap->Malloc(3u * payloadSize));
+        ok = (slots != NULL_PTR(char8 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate the frame slots");
+        }
+    }
+    if (ok) {
+        (void) placement.BindMemory(slots, 3u * static_cast<uint64>(payloadSize));
+        (void) placement.BindMemory(memory, totalMemorySize);
+        ok = (executor.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start the I/O thread");
+        }
+    }
+    return ok;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the data is independent of the broker name.*/
+const char8 *TCPStreamReader::GetBrokerName(StructuredDataI &data,
+                                            const SignalDirection direction) {
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == InputSignals) {
+        brokerName = "MemoryMapSynchronisedInputBroker";
+    }
+    return brokerName;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the state names are independent of the operation.*/
+bool TCPStreamReader::PrepareNextState(const char8 * const currentStateName,
+                                       const char8 * const nextStateName) {
+    return true;
+}
+
+bool TCPStreamReader::Synchronise() {
+    char8 * const signals = reinterpret_cast<char8 *>(memory);
+    if ((tripleBufferState & TCP_STREAM_READER_TRIPLE_BUFFER_FRESH) != 0) {
+        //Take the latest complete frame and give back the slot which was read in the previous cycle
+        readSlot = (Atomic::Exchange(&tripleBufferState, readSlot) & TCP_STREAM_READER_TRIPLE_BUFFER_SLOT_MASK);
+        (void) MemoryOperationsHelper::Copy(&signals[payloadOffset], GetTripleBufferSlot(readSlot), payloadSize);
+    }
+    if (statistics) {
+        uint32 counters[TCP_STREAM_READER_STATISTICS_SIGNALS] = { numberOfFrames, numberOfLostFrames };
+        (void) MemoryOperationsHelper::Copy(signals, &counters[0u], static_cast<uint32>(sizeof(counters)));
+    }
+    return true;
+}
+
+ErrorManagement::ErrorType TCPStreamReader::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        if (connectionFd < 0) {
+            AcceptConnection();
+        }
+        else {
+            ReceiveFrame();
+        }
+    }
+    else if (info.GetStage() != ExecutionInfo::StartupStage) {
+        CloseConnection();
+    }
+    else {
+        //NOOP
+    }
+    return ErrorManagement::NoError;
+}
+
+void TCPStreamReader::AcceptConnection() {
+    struct pollfd descriptor;
+    descriptor.fd = listenFd;
+    descriptor.events = POLLIN;
+    descriptor.revents = 0;
+    if (poll(&descriptor, 1u, TCP_STREAM_IO_TIMEOUT_MSEC) == 1) {
+        connectionFd = accept(listenFd, NULL_PTR(struct sockaddr *), NULL_PTR(socklen_t *));
+        if (connectionFd >= 0) {
+            receivedBytes = 0u;
+            numberOfConnections++;
+            REPORT_ERROR(ErrorManagement::Information, "Accepted a connection on the port %d", port);
+        }
+    }
+}
+
+void TCPStreamReader::ReceiveFrame() {
+    struct pollfd descriptor;
+    descriptor.fd = connectionFd;
+    descriptor.events = POLLIN;
+    descriptor.revents = 0;
+    if (poll(&descriptor, 1u, TCP_STREAM_IO_TIMEOUT_MSEC) == 1) {
+        //The header and the payload are read with one readv, the payload directly in the slot being written
+        char8 * const payload = GetTripleBufferSlot(writeSlot);
+        struct iovec vectors[2];
+        int32 nOfVectors = 1;
+        if (receivedBytes < TCP_STREAM_FRAME_HEADER_SIZE) {
+            vectors[0].iov_base = &(reinterpret_cast<char8 *>(&header)[receivedBytes]);
+            vectors[0].iov_len = static_cast<size_t>(TCP_STREAM_FRAME_HEADER_SIZE - receivedBytes);
+            vectors[1].iov_base = payload;
+            vectors[1].iov_len = static_cast<size_t>(payloadSize);
+            nOfVectors = 2;
+        }
+        else {
+            vectors[0].iov_base = &payload[receivedBytes - TCP_STREAM_FRAME_HEADER_SIZE];
+            vectors[0].iov_len = static_cast<size_t>((TCP_STREAM_FRAME_HEADER_SIZE + payloadSize) - receivedBytes);
+        }
+        ssize_t received = readv(connectionFd, &vectors[0], nOfVectors);
+        if (received > 0) {
+            bool headerComplete = (receivedBytes >= TCP_STREAM_FRAME_HEADER_SIZE);
+            receivedBytes += static_cast<uint32>(received);
+            if ((!headerComplete) && (receivedBytes >= TCP_STREAM_FRAME_HEADER_SIZE)) {
+                if ((header.magic != TCP_STREAM_FRAME_MAGIC) || (header.payloadSize != payloadSize)) {
+                    REPORT_ERROR(ErrorManagement::Warning, "Invalid frame (magic 0x%x, payload size %d instead of %d). Closing the connection",
+                                 header.magic, header.payloadSize, payloadSize);
+                    numberOfInvalidFrames++;
+                    CloseConnection();
+                }
+            }
+            if (receivedBytes == (TCP_STREAM_FRAME_HEADER_SIZE + payloadSize)) {
+                CompleteFrame();
+            }
+        }
+        else if ((received < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR))) {
+            //Retry
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::Information, "Connection on the port %d closed", port);
+            CloseConnection();
+        }
+    }
+}
+
+void TCPStreamReader::CompleteFrame() {
+    if ((hasSequence) && (header.sequence > expectedSequence)) {
+        numberOfLostFrames += static_cast<uint32>(header.sequence - expectedSequence);
+    }
+    //A sequence number lower than expected means that the writer was restarted
+    expectedSequence = header.sequence + 1u;
+    hasSequence = true;
+    numberOfFrames++;
+    //Publish the complete frame and continue with the slot which was published before (or given back by Synchronise)
+    writeSlot = (Atomic::Exchange(&tripleBufferState, (writeSlot | TCP_STREAM_READER_TRIPLE_BUFFER_FRESH)) & TCP_STREAM_READER_TRIPLE_BUFFER_SLOT_MASK);
+    receivedBytes = 0u;
+}
+
+void TCPStreamReader::CloseConnection() {
+    if (connectionFd >= 0) {
+        (void) close(connectionFd);
+        connectionFd = -1;
+    }
+    receivedBytes = 0u;
+}
+
+char8 *TCPStreamReader::GetTripleBufferSlot(const int32 slot) const {
+    return &slots[static_cast<uint32>(slot) * payloadSize];
+}
+
+uint16 TCPStreamReader::GetPort() const {
+    return port;
+}
+
+uint32 TCPStreamReader::GetReceiveBufferSize() const {
+    return receiveBufferSize;
+}
+
+uint32 TCPStreamReader::GetCPUMask() const {
+    return cpuMask;
+}
+
+uint32 TCPStreamReader::GetStackSize() const {
+    return stackSize;
+}
+
+bool TCPStreamReader::IsStatisticsEnabled() const {
+    return statistics;
+}
+
+bool TCPStreamReader::IsConnected() const {
+    return (connectionFd >= 0);
+}
+
+uint32 TCPStreamReader::GetNumberOfFrames() const {
+    return numberOfFrames;
+}
+
+uint32 TCPStreamReader::GetNumberOfLostFrames() const {
+    return numberOfLostFrames;
+}
+
+uint32 TCPStreamReader::GetNumberOfInvalidFrames() const {
+    return numberOfInvalidFrames;
+}
+
+uint32 TCPStreamReader::GetNumberOfConnections() const {
+    return numberOfConnections;
+}
+
+CLASS_REGISTER(TCPStreamReader, "1.0")
+
+}
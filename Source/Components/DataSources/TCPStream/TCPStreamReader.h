@@ -0,0 +1,351 @@
+/**
+ * @file TCPStreamReader.h
+ * @brief Header file for class TCPStreamReader
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class TCPStreamReader
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TCPSTREAMREADER_H_
+#define TCPSTREAMREADER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "MemoryDataSourceI.h"
+#include "SingleThreadService.h"
+#include "TCPStreamFrame.h"
+#include "ThreadPlacement.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief A DataSource which receives the frames streamed by a TCPStreamWriter.
+ * @details The DataSource listens on Port and accepts one connection at the time (a new connection is accepted when the previous one
+ * is closed, e.g. when the writer reconnects). The I/O thread reads each frame with a scatter-gather readv: the TCPStreamFrameHeader
+ * is read into a header and the payload directly into one of three slots. A complete frame is published with an atomic exchange
+ * (triple buffer, as in the UDPReceiver IndependentThread mode), so that Synchronise never blocks: it copies the latest complete
+ * frame (if a new one was received) in the signals.
+ *
+ * A frame whose header is not valid (wrong magic or payload size different from the size of the signals) means that the stream
+ * is not synchronised: the connection is closed and the frame counted as invalid. The gaps in the sequence numbers are counted
+ * as lost frames (the frames dropped by the writer and the ones discarded on a connection failure).
+ *
+ * The configuration syntax is (names are only given as an example):
+ *
+ * <pre>
+ * +TCPReader = {
+ *     Class = TCPStream::TCPStreamReader
+ *     Port = 24680 //Compulsory. The port where the connection of the TCPStreamWriter is accepted.
+ *     ReceiveBufferSize = 4194304 //Optional. Default: 0 (the kernel default). The SO_RCVBUF of the socket (capped by net.core.rmem_max).
+ *     CPUMask = 0x1 //Optional. Default: 0xFFFFFFFF. The affinity of the I/O thread.
+ *     StackSize = 1048576 //Optional. Default: THREADS_DEFAULT_STACKSIZE. The stack size of the I/O thread.
+ *     ThreadPlacement = { //Optional. See ThreadPlacement. Overrides the CPUMask above, sets the priority of the I/O thread and binds the slots to a NUMA node.
+ *         NearDevice = "eth0"
+ *     }
+ *     HeapName = "HugePageHeap" //Optional. Default: GlobalObjectsDatabase::Instance()->GetStandardHeap(). Heap where the signals and the slots are allocated.
+ *     Statistics = 1 //Optional. Default: 0. If 1 the first two signals hold the frame counters (see below).
+ *     Signals = {
+ *         FrameCount = { //Only if Statistics = 1.
+ *             Type = uint32
+ *         }
+ *         LostFrames = { //Only if Statistics = 1.
+ *             Type = uint32
+ *         }
+ *         Signal1 = { //Same signals (types and number of elements) as the TCPStreamWriter (without its QueueDepth signal).
+ *             Type = float32
+ *             NumberOfElements = 16
+ *         }
+ *         ...
+ *     }
+ * }
+ * </pre>
+ *
+ * If Statistics = 1 the first two signals shall be uint32 scalars, holding the total number of frames received and of frames lost.
+ * They are not part of the frame.
+ */
+class TCPStreamReader: public MemoryDataSourceI, public EmbeddedServiceMethodBinderI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default constructor.
+     * @details Initialises all the optional parameters as described in the class description.
+     */
+    TCPStreamReader();
+
+    /**
+     * @brief Destructor. Stops the I/O thread, closes the sockets and frees the slots.
+     */
+    virtual ~TCPStreamReader();
+
+    /**
+     * @brief Loads and verifies the configuration parameters detailed in the class description.
+     * @return true if all the mandatory parameters are correctly specified and if the specified optional parameters have valid values.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals and listens on Port.
+     * @return true if there is at least one signal in the frame, the statistics signals (if any) are uint32 scalars and the socket
+     * could listen on Port.
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI &data);
+
+    /**
+     * @brief Allocates the signals and the slots and starts the I/O thread.
+     * @return true if the memory was allocated and the thread started.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief See DataSourceI::GetBrokerName.
+     * @return MemoryMapSynchronisedInputBroker for the InputSignals, NULL otherwise.
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction);
+
+    /**
+     * @brief NOOP.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief Copies the latest complete frame (if a new one was received) and the statistics in the signals.
+     * @details Never blocks.
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief I/O thread callback. Accepts a connection or receives the frames.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Gets the listening port.
+     */
+    uint16 GetPort() const;
+
+    /**
+     * @brief Gets the configured SO_RCVBUF (0 for the kernel default).
+     */
+    uint32 GetReceiveBufferSize() const;
+
+    /**
+     * @brief Gets the affinity of the I/O thread.
+     */
+    uint32 GetCPUMask() const;
+
+    /**
+     * @brief Gets the stack size of the I/O thread.
+     */
+    uint32 GetStackSize() const;
+
+    /**
+     * @brief Checks if the first two signals hold the frame counters.
+     */
+    bool IsStatisticsEnabled() const;
+
+    /**
+     * @brief Checks if a writer is connected.
+     */
+    bool IsConnected() const;
+
+    /**
+     * @brief Gets the number of frames received.
+     */
+    uint32 GetNumberOfFrames() const;
+
+    /**
+     * @brief Gets the number of frames lost (gaps in the sequence numbers).
+     */
+    uint32 GetNumberOfLostFrames() const;
+
+    /**
+     * @brief Gets the number of invalid frames (each one closed the connection).
+     */
+    uint32 GetNumberOfInvalidFrames() const;
+
+    /**
+     * @brief Gets the number of connections accepted.
+     */
+    uint32 GetNumberOfConnections() const;
+
+private:
+
+    /**
+     * @brief Waits (at most TCP_STREAM_IO_TIMEOUT_MSEC) for a connection and accepts it.
+     */
+    void AcceptConnection();
+
+    /**
+     * @brief Waits (at most TCP_STREAM_IO_TIMEOUT_MSEC) for data and reads (the rest of) the current frame.
+     */
+    void ReceiveFrame();
+
+    /**
+     * @brief Checks the sequence number of the received frame and publishes it.
+     */
+    void CompleteFrame();
+
+    /**
+     * @brief Closes the connection (the next frame starts with the next connection).
+     */
+    void CloseConnection();
+
+    /**
+     * @brief Gets the address of a slot of the triple buffer.
+     */
+    char8 *GetTripleBufferSlot(const int32 slot) const;
+
+    /**
+     * The I/O thread.
+     */
+    SingleThreadService executor;
+
+    /**
+     * The CPU, priority and NUMA placement of the I/O thread and of the slots.
+     */
+    ThreadPlacement placement;
+
+    /**
+     * The affinity of the I/O thread.
+     */
+    uint32 cpuMask;
+
+    /**
+     * The stack size of the I/O thread.
+     */
+    uint32 stackSize;
+
+    /**
+     * The listening port.
+     */
+    uint16 port;
+
+    /**
+     * The SO_RCVBUF of the socket (0 for the kernel default).
+     */
+    uint32 receiveBufferSize;
+
+    /**
+     * True if the first two signals hold the frame counters.
+     */
+    bool statistics;
+
+    /**
+     * The offset of the frame payload in the signals memory.
+     */
+    uint32 payloadOffset;
+
+    /**
+     * The size of the frame payload.
+     */
+    uint32 payloadSize;
+
+    /**
+     * The listening socket.
+     */
+    int32 listenFd;
+
+    /**
+     * The accepted connection (-1 if none).
+     */
+    int32 connectionFd;
+
+    /**
+     * The header of the frame being received.
+     */
+    TCPStreamFrameHeader header;
+
+    /**
+     * The number of bytes of the current frame already received.
+     */
+    uint32 receivedBytes;
+
+    /**
+     * The three slots of payloadSize bytes.
+     */
+    char8 *slots;
+
+    /**
+     * The slot being written by the I/O thread.
+     */
+    int32 writeSlot;
+
+    /**
+     * The slot exchanged between the I/O thread and Synchronise, with the FRESH flag set when it holds a frame not yet read.
+     */
+    volatile int32 tripleBufferState;
+
+    /**
+     * The slot read by Synchronise.
+     */
+    int32 readSlot;
+
+    /**
+     * True after the first frame (the next sequence number is known).
+     */
+    bool hasSequence;
+
+    /**
+     * The expected sequence number of the next frame.
+     */
+    uint64 expectedSequence;
+
+    /**
+     * The number of frames received.
+     */
+    volatile uint32 numberOfFrames;
+
+    /**
+     * The number of frames lost.
+     */
+    volatile uint32 numberOfLostFrames;
+
+    /**
+     * The number of invalid frames.
+     */
+    volatile uint32 numberOfInvalidFrames;
+
+    /**
+     * The number of connections accepted.
+     */
+    volatile uint32 numberOfConnections;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TCPSTREAMREADER_H_ */
@@ -0,0 +1,552 @@
+/**
+ * @file TCPStreamWriter.cpp
+ * @brief Source file for class TCPStreamWriter
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class TCPStreamWriter (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
+#include "Sleep.h"
+#include "TCPStreamWriter.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+TCPStreamWriter::TCPStreamWriter() :
+        MemoryDataSourceI(),
+        EmbeddedServiceMethodBinderI(),
+        executor(*this) {
+    cpuMask = 0xFFFFFFFFu;
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+    address = "";
+    port = 0u;
+    queueSize = 16u;
+    noDelay = true;
+    sendBufferSize = 0u;
+    reconnectPeriodMSec = 1000u;
+    queueDepthEnabled = false;
+    queueDepthSignal = NULL_PTR(uint32 *);
+    payloadOffset = 0u;
+    payloadSize = 0u;
+    frameSize = 0u;
+    ring = NULL_PTR(char8 *);
+    fillIndex = 0u;
+    flushIndex = 0u;
+    sentOffset = 0u;
+    pending = 0;
+    sequence = 0u;
+    socketFd = -1;
+    connectingFd = -1;
+    connected = false;
+    lastConnectCounter = 0u;
+    connectFailed = false;
+    numberOfSentFrames = 0u;
+    numberOfDroppedFrames = 0u;
+    numberOfDiscardedFrames = 0u;
+    numberOfConnections = 0u;
+    if (!queuedSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem.");
+    }
+}
+
+/*lint -e{1551} the destructor must guarantee that the I/O thread is stopped before the ring is freed.*/
+TCPStreamWriter::~TCPStreamWriter() {
+    if (!executor.Stop()) {
+        if (!executor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    if (socketFd >= 0) {
+        (void) close(socketFd);
+    }
+    if (connectingFd >= 0) {
+        (void) close(connectingFd);
+    }
+    if (ring != NULL_PTR(char8 *)) {
+        void *ringMemory = ring;
+        memoryHeap->Free(ringMemory);
+    }
+    (void) queuedSem.Close();
+}
+
+bool TCPStreamWriter::Initialise(StructuredDataI &data) {
+    bool ok = MemoryDataSourceI::Initialise(data);
+    if (ok) {
+        ok = data.Read("Address", address);
+        if (ok) {
+            struct in_addr ignored;
+            ok = (inet_pton(AF_INET, address.Buffer(), &ignored) == 1);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Address shall be specified as an IPv4 address");
+        }
+    }
+    if (ok) {
+        ok = data.Read("Port", port);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Port shall be specified");
+        }
+    }
+    if (ok) {
+        if (!data.Read("QueueSize", queueSize)) {
+            queueSize = 16u;
+        }
+        ok = (queueSize > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "QueueSize shall be > 0");
+        }
+    }
+    if (ok) {
+        uint32 noDelayIn = 1u;
+        if (data.Read("NoDelay", noDelayIn)) {
+            noDelay = (noDelayIn == 1u);
+        }
+        if (!data.Read("SendBufferSize", sendBufferSize)) {
+            sendBufferSize = 0u;
+        }
+        float64 reconnectPeriod = 1.0;
+        if (!data.Read("ReconnectPeriod", reconnectPeriod)) {
+            reconnectPeriod = 1.0;
+        }
+        ok = (reconnectPeriod > 0.0);
+        if (ok) {
+            reconnectPeriodMSec = static_cast<uint32>(reconnectPeriod * 1000.0);
+            if (reconnectPeriodMSec == 0u) {
+                reconnectPeriodMSec = 1u;
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "ReconnectPeriod shall be > 0");
+        }
+    }
+    if (ok) {
+        uint32 queueDepthIn = 0u;
+        if (data.Read("QueueDepth", queueDepthIn)) {
+            queueDepthEnabled = (queueDepthIn == 1u);
+        }
+        if (!data.Read("CPUMask", cpuMask)) {
+            cpuMask = 0xFFFFFFFFu;
+        }
+        if (!data.Read("StackSize", stackSize)) {
+            stackSize = THREADS_DEFAULT_STACKSIZE;
+        }
+        ok = placement.Initialise(data);
+    }
+    return ok;
+}
+
+bool TCPStreamWriter::SetConfiguredDatabase(StructuredDataI &data) {
+    bool ok = MemoryDataSourceI::SetConfiguredDatabase(data);
+    uint32 nOfSignals = GetNumberOfSignals();
+    uint32 firstPayloadSignal = 0u;
+    if ((ok) && (queueDepthEnabled)) {
+        uint32 nOfElements = 0u;
+        ok = (nOfSignals > 0u);
+        if (ok) {
+            ok = GetSignalNumberOfElements(0u, nOfElements);
+        }
+        if (ok) {
+            ok = (GetSignalType(0u) == UnsignedInteger32Bit) && (nOfElements == 1u);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "With QueueDepth = 1 the first signal shall be a uint32 scalar");
+        }
+        firstPayloadSignal = 1u;
+        payloadOffset = static_cast<uint32>(sizeof(uint32));
+    }
+    if (ok) {
+        ok = (nOfSignals > firstPayloadSignal);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "At least one signal shall be streamed");
+        }
+    }
+    payloadSize = 0u;
+    uint32 s;
+    for (s = firstPayloadSignal; (s < nOfSignals) && (ok); s++) {
+        uint32 signalSize = 0u;
+        ok = GetSignalByteSize(s, signalSize);
+        payloadSize += signalSize;
+    }
+    if (ok) {
+        frameSize = TCP_STREAM_FRAME_HEADER_SIZE + payloadSize;
+        executor.SetName(GetName());
+        executor.SetCPUMask(cpuMask);
+        placement.Apply(executor);
+        executor.SetStackSize(stackSize);
+    }
+    return ok;
+}
+
+bool TCPStreamWriter::AllocateMemory() {
+    bool ok = MemoryDataSourceI::AllocateMemory();
+    if ((ok) && (queueDepthEnabled)) {
+        void *signalAddress = NULL_PTR(void *);
+        ok = GetSignalMemoryBuffer(0u, 0u, signalAddress);
+        if (ok) {
+            queueDepthSignal = reinterpret_cast<uint32 *>(signalAddress);
+        }
+    }
+    if (ok) {
+        ring = reinterpret_cast<char8 *>(memoryHeap->Malloc(queueSize * frameSize));
+        ok = (ring != NULL_PTR(char8 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate the ring of %d frames", queueSize);
+        }
+    }
+    if (ok) {
+        (void) placement.BindMemory(ring, static_cast<uint64>(queueSize) * frameSize);
+        ok = (executor.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start the I/O thread");
+        }
+    }
+    return ok;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the data is independent of the broker name.*/
+const char8 *TCPStreamWriter::GetBrokerName(StructuredDataI &data,
+                                            const SignalDirection direction) {
+    const char8 *brokerName = "MemoryMapSynchronisedOutputBroker";
+    if (direction == InputSignals) {
+        brokerName = "MemoryMapInputBroker";
+    }
+    return brokerName;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the state names are independent of the operation.*/
+bool TCPStreamWriter::PrepareNextState(const char8 * const currentStateName,
+                                       const char8 * const nextStateName) {
+    return true;
+}
+
+bool TCPStreamWriter::Synchronise() {
+    uint32 depth = static_cast<uint32>(pending);
+    if ((!connected) || (depth >= queueSize)) {
+        numberOfDroppedFrames++;
+    }
+    else {
+        /*lint -e{613} ring cannot be NULL after AllocateMemory*/
+        char8 * const slot = &ring[fillIndex * frameSize];
+        TCPStreamFrameHeader header;
+        header.magic = TCP_STREAM_FRAME_MAGIC;
+        header.payloadSize = payloadSize;
+        header.sequence = sequence;
+        (void) MemoryOperationsHelper::Copy(slot, &header, TCP_STREAM_FRAME_HEADER_SIZE);
+        (void) MemoryOperationsHelper::Copy(&slot[TCP_STREAM_FRAME_HEADER_SIZE], &(reinterpret_cast<char8 *>(memory)[payloadOffset]), payloadSize);
+        fillIndex++;
+        if (fillIndex == queueSize) {
+            fillIndex = 0u;
+        }
+        //Atomic::Increment is a full memory barrier: the I/O thread sees the frame before the new pending
+        Atomic::Increment(&pending);
+        (void) queuedSem.Post();
+        depth++;
+    }
+    sequence++;
+    if (queueDepthSignal != NULL_PTR(uint32 *)) {
+        *queueDepthSignal = depth;
+    }
+    return true;
+}
+
+ErrorManagement::ErrorType TCPStreamWriter::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        if (connected) {
+            (void) queuedSem.Reset();
+            if (pending == 0) {
+                (void) queuedSem.Wait(static_cast<uint32>(TCP_STREAM_IO_TIMEOUT_MSEC));
+            }
+            if (pending > 0) {
+                SendFrames();
+            }
+        }
+        else if (connectingFd >= 0) {
+            PollConnection();
+        }
+        else {
+            float64 elapsedMSec = static_cast<float64>(HighResolutionTimer::Counter() - lastConnectCounter) * HighResolutionTimer::Period() * 1e3;
+            if ((lastConnectCounter == 0u) || (elapsedMSec >= static_cast<float64>(reconnectPeriodMSec))) {
+                StartConnection();
+            }
+            else {
+                Sleep::MSec(static_cast<uint32>(TCP_STREAM_IO_TIMEOUT_MSEC));
+            }
+        }
+    }
+    else if (info.GetStage() != ExecutionInfo::StartupStage) {
+        Disconnect();
+    }
+    else {
+        //NOOP
+    }
+    return ErrorManagement::NoError;
+}
+
+void TCPStreamWriter::StartConnection() {
+    lastConnectCounter = HighResolutionTimer::Counter();
+    int32 fd = socket(AF_INET, SOCK_STREAM, 0);
+    bool ok = (fd >= 0);
+    struct sockaddr_in destination;
+    (void) memset(&destination, 0, sizeof(destination));
+    destination.sin_family = AF_INET;
+    destination.sin_port = htons(port);
+    if (ok) {
+        ok = (inet_pton(AF_INET, address.Buffer(), &destination.sin_addr) == 1);
+    }
+    if ((ok) && (noDelay)) {
+        int32 one = 1;
+        ok = (setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, static_cast<socklen_t>(sizeof(one))) == 0);
+    }
+    if ((ok) && (sendBufferSize > 0u)) {
+        int32 size = static_cast<int32>(sendBufferSize);
+        if (setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &size, static_cast<socklen_t>(sizeof(size))) != 0) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not set SO_SNDBUF to %d", sendBufferSize);
+        }
+    }
+    //Non-blocking connect, completed by PollConnection, so that the thread can always be stopped
+    if (ok) {
+        ok = (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK) == 0);
+    }
+    if (ok) {
+        connectingFd = fd;
+        /*lint -e{740} -e{929} sockaddr_in is the IPv4 sockaddr*/
+        if (connect(fd, reinterpret_cast<struct sockaddr *>(&destination), static_cast<socklen_t>(sizeof(destination))) == 0) {
+            EndConnection(true);
+        }
+        else if (errno != EINPROGRESS) {
+            EndConnection(false);
+        }
+        else {
+            //Completed by PollConnection
+        }
+    }
+    else if (fd >= 0) {
+        connectingFd = fd;
+        EndConnection(false);
+    }
+    else {
+        EndConnection(false);
+    }
+}
+
+void TCPStreamWriter::PollConnection() {
+    struct pollfd descriptor;
+    descriptor.fd = connectingFd;
+    descriptor.events = POLLOUT;
+    descriptor.revents = 0;
+    if (poll(&descriptor, 1u, TCP_STREAM_IO_TIMEOUT_MSEC) == 1) {
+        int32 error = 0;
+        socklen_t errorSize = static_cast<socklen_t>(sizeof(error));
+        bool ok = (getsockopt(connectingFd, SOL_SOCKET, SO_ERROR, &error, &errorSize) == 0);
+        EndConnection((ok) && (error == 0));
+    }
+    else {
+        float64 elapsedMSec = static_cast<float64>(HighResolutionTimer::Counter() - lastConnectCounter) * HighResolutionTimer::Period() * 1e3;
+        if (elapsedMSec >= static_cast<float64>(reconnectPeriodMSec)) {
+            EndConnection(false);
+        }
+    }
+}
+
+void TCPStreamWriter::EndConnection(const bool established) {
+    bool ok = established;
+    if (ok) {
+        //Blocking sends with a timeout: a slow receiver fills the ring and the frames are dropped by Synchronise
+        ok = (fcntl(connectingFd, F_SETFL, fcntl(connectingFd, F_GETFL, 0) & ~O_NONBLOCK) == 0);
+    }
+    if (ok) {
+        struct timeval sendTimeout;
+        sendTimeout.tv_sec = 0;
+        sendTimeout.tv_usec = TCP_STREAM_IO_TIMEOUT_MSEC * 1000;
+        ok = (setsockopt(connectingFd, SOL_SOCKET, SO_SNDTIMEO, &sendTimeout, static_cast<socklen_t>(sizeof(sendTimeout))) == 0);
+    }
+    if (ok) {
+        socketFd = connectingFd;
+        sentOffset = 0u;
+        numberOfConnections++;
+        connectFailed = false;
+        connected = true;
+        REPORT_ERROR(ErrorManagement::Information, "Connected to %s:%d", address.Buffer(), port);
+    }
+    else {
+        if (connectingFd >= 0) {
+            (void) close(connectingFd);
+        }
+        if (!connectFailed) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not connect to %s:%d. Retrying every %d ms", address.Buffer(), port, reconnectPeriodMSec);
+        }
+        connectFailed = true;
+    }
+    connectingFd = -1;
+}
+
+void TCPStreamWriter::Disconnect() {
+    if (socketFd >= 0) {
+        connected = false;
+        (void) close(socketFd);
+        socketFd = -1;
+    }
+    if (connectingFd >= 0) {
+        (void) close(connectingFd);
+        connectingFd = -1;
+    }
+    //Discard the queued frames (Synchronise may still queue one frame which was started before connected was cleared)
+    while (pending > 0) {
+        flushIndex++;
+        if (flushIndex == queueSize) {
+            flushIndex = 0u;
+        }
+        numberOfDiscardedFrames++;
+        Atomic::Decrement(&pending);
+    }
+    sentOffset = 0u;
+}
+
+void TCPStreamWriter::SendFrames() {
+    uint32 count = static_cast<uint32>(pending);
+    uint32 firstRun = queueSize - flushIndex;
+    if (firstRun > count) {
+        firstRun = count;
+    }
+    //The slots are contiguous: the frames before and after the end of the ring are sent with (at most) two vectors
+    struct iovec vectors[2];
+    /*lint -e{613} ring cannot be NULL while the I/O thread runs*/
+    vectors[0].iov_base = &ring[(flushIndex * frameSize) + sentOffset];
+    vectors[0].iov_len = static_cast<size_t>((firstRun * frameSize) - sentOffset);
+    size_t nOfVectors = 1u;
+    if (count > firstRun) {
+        vectors[1].iov_base = ring;
+        vectors[1].iov_len = static_cast<size_t>((count - firstRun) * frameSize);
+        nOfVectors = 2u;
+    }
+    struct msghdr message;
+    (void) memset(&message, 0, sizeof(message));
+    message.msg_iov = &vectors[0];
+    message.msg_iovlen = nOfVectors;
+    //sendmsg is the writev of sockets, with MSG_NOSIGNAL so that a closed connection is reported as EPIPE and not as a SIGPIPE
+    ssize_t sent = sendmsg(socketFd, &message, MSG_NOSIGNAL);
+    if (sent > 0) {
+        uint64 total = static_cast<uint64>(sentOffset) + static_cast<uint64>(sent);
+        uint32 nOfFrames = static_cast<uint32>(total / frameSize);
+        sentOffset = static_cast<uint32>(total % frameSize);
+        uint32 f;
+        for (f = 0u; f < nOfFrames; f++) {
+            flushIndex++;
+            if (flushIndex == queueSize) {
+                flushIndex = 0u;
+            }
+            numberOfSentFrames++;
+            Atomic::Decrement(&pending);
+        }
+    }
+    else if ((sent < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR))) {
+        //The socket buffer is full: the frames stay in the ring
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::Warning, "Connection to %s:%d lost. Reconnecting", address.Buffer(), port);
+        Disconnect();
+        lastConnectCounter = HighResolutionTimer::Counter();
+    }
+}
+
+StreamString TCPStreamWriter::GetAddress() const {
+    return address;
+}
+
+uint16 TCPStreamWriter::GetPort() const {
+    return port;
+}
+
+uint32 TCPStreamWriter::GetQueueSize() const {
+    return queueSize;
+}
+
+bool TCPStreamWriter::IsNoDelay() const {
+    return noDelay;
+}
+
+uint32 TCPStreamWriter::GetSendBufferSize() const {
+    return sendBufferSize;
+}
+
+uint32 TCPStreamWriter::GetReconnectPeriod() const {
+    return reconnectPeriodMSec;
+}
+
+uint32 TCPStreamWriter::GetCPUMask() const {
+    return cpuMask;
+}
+
+uint32 TCPStreamWriter::GetStackSize() const {
+    return stackSize;
+}
+
+bool TCPStreamWriter::IsQueueDepthEnabled() const {
+    return queueDepthEnabled;
+}
+
+bool TCPStreamWriter::IsConnected() const {
+    return connected;
+}
+
+uint32 TCPStreamWriter::GetQueueDepth() const {
+    return static_cast<uint32>(pending);
+}
+
+uint32 TCPStreamWriter::GetNumberOfSentFrames() const {
+    return numberOfSentFrames;
+}
+
+uint32 TCPStreamWriter::GetNumberOfDroppedFrames() const {
+    return numberOfDroppedFrames + numberOfDiscardedFrames;
+}
+
+uint32 TCPStreamWriter::GetNumberOfConnections() const {
+    return numberOfConnections;
+}
+
+CLASS_REGISTER(TCPStreamWriter, "1.0")
+
+}
@@ -0,0 +1,417 @@
+/**
+ * @file TCPStreamWriter.h
+ * @brief Header file for class TCPStreamWriter
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class TCPStreamWriter
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TCPSTREAMWRITER_H_
+#define TCPSTREAMWRITER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "MemoryDataSourceI.h"
+#include "SingleThreadService.h"
+#include "StreamString.h"
+#include "TCPStreamFrame.h"
+#include "ThreadPlacement.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief A DataSource which streams the signals, in every cycle, as one frame over a TCP connection (see TCPStreamReader).
+ * @details Each frame is a TCPStreamFrameHeader (magic, payload size and cycle sequence number) followed by the signals
+ * (the payload), so that the receiver can split the stream in frames and detect the lost ones.
+ *
+ * Synchronise (i.e. the real-time thread, through a MemoryMapSynchronisedOutputBroker) never performs any I/O: it copies the header
+ * and the signals in the next slot of a ring of QueueSize frames and wakes up the I/O thread. The I/O thread sends all the queued
+ * frames with a single scatter-gather sendmsg (at most two vectors, as the slots are contiguous in memory), directly from the ring.
+ * If the ring is full (the network, or the receiver, is slower than the real-time thread) or if the connection is down, the frame is
+ * dropped and counted.
+ *
+ * The I/O thread connects to the receiver (non-blocking connect, which fails after ReconnectPeriod) and reconnects every ReconnectPeriod
+ * after a failure. On a connection error the queued frames are discarded (a frame partially sent is never completed on a new
+ * connection). The sequence numbers continue across connections.
+ *
+ * The configuration syntax is (names are only given as an example):
+ *
+ * <pre>
+ * +TCPWriter = {
+ *     Class = TCPStream::TCPStreamWriter
+ *     Address = "10.0.0.1" //Compulsory. The IPv4 address of the TCPStreamReader.
+ *     Port = 24680 //Compulsory. The port of the TCPStreamReader.
+ *     QueueSize = 64 //Optional. Default: 16. The number of frames which can be queued while the I/O thread is sending.
+ *     NoDelay = 1 //Optional. Default: 1. If 1 TCP_NODELAY is set, so that each frame is sent as soon as it is queued.
+ *     SendBufferSize = 4194304 //Optional. Default: 0 (the kernel default). The SO_SNDBUF of the socket (capped by net.core.wmem_max).
+ *     ReconnectPeriod = 1.0 //Optional. Default: 1. The time (in seconds) between two connection attempts.
+ *     CPUMask = 0x1 //Optional. Default: 0xFFFFFFFF. The affinity of the I/O thread.
+ *     StackSize = 1048576 //Optional. Default: THREADS_DEFAULT_STACKSIZE. The stack size of the I/O thread.
+ *     ThreadPlacement = { //Optional. See ThreadPlacement. Overrides the CPUMask above, sets the priority of the I/O thread and binds the ring to a NUMA node.
+ *         NearDevice = "eth0"
+ *     }
+ *     HeapName = "HugePageHeap" //Optional. Default: GlobalObjectsDatabase::Instance()->GetStandardHeap(). Heap where the signals and the ring are allocated.
+ *     QueueDepth = 1 //Optional. Default: 0. If 1 the first signal holds the number of frames waiting in the ring (see below).
+ *     Signals = {
+ *         Depth = { //Only if QueueDepth = 1.
+ *             Type = uint32
+ *         }
+ *         Signal1 = {
+ *             Type = float32 //Any type.
+ *             NumberOfElements = 16
+ *         }
+ *         ...
+ *     }
+ * }
+ * </pre>
+ *
+ * If QueueDepth = 1 the first signal shall be a uint32 scalar. It is not part of the frame: it shall be read by a GAM (InputSignals)
+ * and holds the number of frames in the ring after the previous Synchronise. All the other signals shall be written by the GAMs.
+ */
+class TCPStreamWriter: public MemoryDataSourceI, public EmbeddedServiceMethodBinderI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default constructor.
+     * @details Initialises all the optional parameters as described in the class description.
+     */
+    TCPStreamWriter();
+
+    /**
+     * @brief Destructor. Stops the I/O thread, closes the connection and frees the ring.
+     */
+    virtual ~TCPStreamWriter();
+
+    /**
+     * @brief Loads and verifies the configuration parameters detailed in the class description.
+     * @return true if all the mandatory parameters are correctly specified and if the specified optional parameters have valid values.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals and computes the frame size.
+     * @return true if there is at least one signal in the frame and, if QueueDepth = 1, the first signal is a uint32 scalar.
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI &data);
+
+    /**
+     * @brief Allocates the signals and the ring and starts the I/O thread (which connects to the receiver).
+     * @return true if the memory was allocated and the thread started.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief See DataSourceI::GetBrokerName.
+     * @return MemoryMapSynchronisedOutputBroker for the OutputSignals and MemoryMapInputBroker for the InputSignals (QueueDepth).
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction);
+
+    /**
+     * @brief NOOP.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief Queues the frame (or drops it if the ring is full or the connection is down) and wakes up the I/O thread.
+     * @details Never blocks. Updates the QueueDepth signal.
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief I/O thread callback. Connects to the receiver or sends the queued frames.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Gets the address of the receiver.
+     */
+    StreamString GetAddress() const;
+
+    /**
+     * @brief Gets the port of the receiver.
+     */
+    uint16 GetPort() const;
+
+    /**
+     * @brief Gets the number of frames of the ring.
+     */
+    uint32 GetQueueSize() const;
+
+    /**
+     * @brief Checks if TCP_NODELAY is set.
+     */
+    bool IsNoDelay() const;
+
+    /**
+     * @brief Gets the configured SO_SNDBUF (0 for the kernel default).
+     */
+    uint32 GetSendBufferSize() const;
+
+    /**
+     * @brief Gets the time between two connection attempts in milliseconds.
+     */
+    uint32 GetReconnectPeriod() const;
+
+    /**
+     * @brief Gets the affinity of the I/O thread.
+     */
+    uint32 GetCPUMask() const;
+
+    /**
+     * @brief Gets the stack size of the I/O thread.
+     */
+    uint32 GetStackSize() const;
+
+    /**
+     * @brief Checks if the first signal holds the number of queued frames.
+     */
+    bool IsQueueDepthEnabled() const;
+
+    /**
+     * @brief Checks if the connection to the receiver is established.
+     */
+    bool IsConnected() const;
+
+    /**
+     * @brief Gets the number of frames waiting in the ring.
+     */
+    uint32 GetQueueDepth() const;
+
+    /**
+     * @brief Gets the number of frames completely sent.
+     */
+    uint32 GetNumberOfSentFrames() const;
+
+    /**
+     * @brief Gets the number of frames dropped because the ring was full, the connection was down or the connection failed before
+     * they were sent.
+     */
+    uint32 GetNumberOfDroppedFrames() const;
+
+    /**
+     * @brief Gets the number of connections established to the receiver.
+     */
+    uint32 GetNumberOfConnections() const;
+
+private:
+
+    /**
+     * @brief Creates the socket and starts a non-blocking connection to the receiver.
+     */
+    void StartConnection();
+
+    /**
+     * @brief Waits (at most TCP_STREAM_IO_TIMEOUT_MSEC) for the connection started by StartConnection, which fails after ReconnectPeriod.
+     */
+    void PollConnection();
+
+    /**
+     * @brief Configures the established connection or closes the socket of the failed one.
+     */
+    void EndConnection(const bool established);
+
+    /**
+     * @brief Closes the connection and discards the queued frames.
+     */
+    void Disconnect();
+
+    /**
+     * @brief Sends as many queued frames as the socket accepts with a single sendmsg.
+     */
+    void SendFrames();
+
+    /**
+     * The I/O thread.
+     */
+    SingleThreadService executor;
+
+    /**
+     * The CPU, priority and NUMA placement of the I/O thread and of the ring.
+     */
+    ThreadPlacement placement;
+
+    /**
+     * The affinity of the I/O thread.
+     */
+    uint32 cpuMask;
+
+    /**
+     * The stack size of the I/O thread.
+     */
+    uint32 stackSize;
+
+    /**
+     * The address of the receiver.
+     */
+    StreamString address;
+
+    /**
+     * The port of the receiver.
+     */
+    uint16 port;
+
+    /**
+     * The number of frames of the ring.
+     */
+    uint32 queueSize;
+
+    /**
+     * True if TCP_NODELAY is set.
+     */
+    bool noDelay;
+
+    /**
+     * The SO_SNDBUF of the socket (0 for the kernel default).
+     */
+    uint32 sendBufferSize;
+
+    /**
+     * The time between two connection attempts in milliseconds.
+     */
+    uint32 reconnectPeriodMSec;
+
+    /**
+     * True if the first signal holds the number of queued frames.
+     */
+    bool queueDepthEnabled;
+
+    /**
+     * The QueueDepth signal.
+     */
+    uint32 *queueDepthSignal;
+
+    /**
+     * The offset of the frame payload in the signals memory.
+     */
+    uint32 payloadOffset;
+
+    /**
+     * The size of the frame payload.
+     */
+    uint32 payloadSize;
+
+    /**
+     * The size of a frame (header and payload).
+     */
+    uint32 frameSize;
+
+    /**
+     * The ring of queueSize frames.
+     */
+    char8 *ring;
+
+    /**
+     * The slot where Synchronise writes the next frame.
+     */
+    uint32 fillIndex;
+
+    /**
+     * The slot of the next frame to be sent.
+     */
+    uint32 flushIndex;
+
+    /**
+     * The number of bytes of the head slot already sent.
+     */
+    uint32 sentOffset;
+
+    /**
+     * The number of frames in the ring.
+     */
+    volatile int32 pending;
+
+    /**
+     * Posted when a frame is queued.
+     */
+    EventSem queuedSem;
+
+    /**
+     * The sequence number of the next frame.
+     */
+    uint64 sequence;
+
+    /**
+     * The socket (-1 if not connected).
+     */
+    int32 socketFd;
+
+    /**
+     * The socket of the connection being established (-1 if none).
+     */
+    int32 connectingFd;
+
+    /**
+     * True while the connection is established (written by the I/O thread).
+     */
+    volatile bool connected;
+
+    /**
+     * The HighResolutionTimer counter of the last connection attempt.
+     */
+    uint64 lastConnectCounter;
+
+    /**
+     * True if the last connection attempt failed (to report a failure only once).
+     */
+    bool connectFailed;
+
+    /**
+     * The number of frames completely sent (written by the I/O thread).
+     */
+    volatile uint32 numberOfSentFrames;
+
+    /**
+     * The number of frames dropped by Synchronise.
+     */
+    volatile uint32 numberOfDroppedFrames;
+
+    /**
+     * The number of frames discarded by the I/O thread on a connection failure.
+     */
+    volatile uint32 numberOfDiscardedFrames;
+
+    /**
+     * The number of connections established.
+     */
+    volatile uint32 numberOfConnections;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TCPSTREAMWRITER_H_ */
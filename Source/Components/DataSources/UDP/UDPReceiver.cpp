@@ -23,17 +23,83 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <arpa/inet.h>
+#include <linux/filter.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "MemoryMapInputBroker.h"
 #include "UDPReceiver.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+/**
+ * Flag set in the triple buffer state when the middle slot holds a packet which was not yet read.
+ */
+static const MARTe::int32 UDP_RECEIVER_TRIPLE_BUFFER_FRESH = 4;
+
+/**
+ * Mask of the middle slot index in the triple buffer state.
+ */
+static const MARTe::int32 UDP_RECEIVER_TRIPLE_BUFFER_SLOT_MASK = 3;
+
+/**
+ * Number of signals holding the counters and the latency when SequenceHeader = 1.
+ */
+static const MARTe::uint32 UDP_RECEIVER_SEQUENCE_SIGNALS = 4u;
+
+/**
+ * Size of the counters (3 x uint32) and of the latency (int64) when SequenceHeader = 1.
+ */
+static const MARTe::uint32 UDP_RECEIVER_SEQUENCE_SIGNALS_SIZE = 20u;
+
+/**
+ * Maximum number of receive queues (one thread and one socket each).
+ */
+static const MARTe::uint32 UDP_RECEIVER_MAX_QUEUES = 64u;
+
+/**
+ * @brief Allows several sockets to be bound to the same port (the kernel distributes the datagrams over them).
+ */
+static bool UDPReceiverEnableReusePort(const MARTe::int32 handle) {
+    MARTe::int32 one = 1;
+    bool ok = (setsockopt(handle, SOL_SOCKET, SO_REUSEPORT, &one, static_cast<socklen_t>(sizeof(one))) == 0);
+    if (!ok) {
+        REPORT_ERROR_STATIC(MARTe::ErrorManagement::OSError, "Could not set SO_REUSEPORT");
+    }
+    return ok;
+}
+
+/**
+ * @brief Steers each datagram to the socket (CPU modulo numberOfQueues) of the reuseport group, where CPU is the core which processed it.
+ */
+static bool UDPReceiverAttachCPUSteering(const MARTe::int32 handle,
+                                         const MARTe::uint32 numberOfQueues) {
+    bool ok = false;
+#ifdef SO_ATTACH_REUSEPORT_CBPF
+    //A = CPU; A = A % numberOfQueues; return A (the index of the socket in the reuseport group, i.e. the queue)
+    /*lint -e{9130} -e{835} BPF_* are the kernel interface to the classic BPF instructions*/
+    struct sock_filter code[] = { { static_cast<MARTe::uint16>(BPF_LD | BPF_W | BPF_ABS), 0u, 0u, static_cast<MARTe::uint32>(SKF_AD_OFF + SKF_AD_CPU) },
+            { static_cast<MARTe::uint16>(BPF_ALU | BPF_MOD | BPF_K), 0u, 0u, numberOfQueues },
+            { static_cast<MARTe::uint16>(BPF_RET | BPF_A), 0u, 0u, 0u } };
+    struct sock_fprog program;
+    program.len = static_cast<MARTe::uint16>(sizeof(code) / sizeof(code[0]));
+    program.filter = &code[0];
+    ok = (setsockopt(handle, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, static_cast<socklen_t>(sizeof(program))) == 0);
+#endif
+    if (!ok) {
+        REPORT_ERROR_STATIC(MARTe::ErrorManagement::OSError, "Could not attach the CPU steering program (SO_ATTACH_REUSEPORT_CBPF)");
+    }
+    return ok;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -45,7 +111,8 @@ namespace MARTe {
 UDPReceiver::UDPReceiver() :
         MemoryDataSourceI(),
         EmbeddedServiceMethodBinderI(),
-        executor(*this) {
+        executor(*this),
+        queueService(*this) {
     address = "";
     port = 0u;
     timeout = TTInfiniteWait;
@@ -54,8 +121,30 @@ UDPReceiver::UDPReceiver() :
     executionMode = UDPReceiverExecutionModeRealTime;
     socket = NULL_PTR(UDPSocket*);
     muxIThread.Create();
-    copyInProgress = false;
     memoryIndependentThread = NULL_PTR(void *);
+    writeSlot = 0;
+    tripleBufferState = 1;
+    readSlot = 2;
+    transport = UDPTransportSocket;
+    queueId = 0u;
+    xdpActive = false;
+    timeoutMSec = -1;
+    numberOfPackets = 0u;
+    packetsMode = UDPReceiverPacketsModeSinceLastCycle;
+    packetCount = NULL_PTR(uint32 *);
+    droppedPackets = NULL_PTR(uint32 *);
+    packets = NULL_PTR(char8 *);
+    sequenceHeader = false;
+    sequenceBuffer = NULL_PTR(char8 *);
+    sequencePayloadSize = 0u;
+    multicastInterface = "";
+    numberOfQueues = 1u;
+    steering = UDPReceiverSteeringHash;
+    queueSockets = NULL_PTR(UDPSocket **);
+    queueBatches = NULL_PTR(UDPReceiverBatch *);
+    queueReceived = NULL_PTR(uint32 *);
+    queueStatistics = false;
+    queueStatisticsSignal = NULL_PTR(uint32 *);
 }
 
 /*lint -e{1551} the destructor must guarantee that the thread and servers are closed.*/
@@ -65,6 +154,11 @@ UDPReceiver::~UDPReceiver() {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
         }
     }
+    if (!queueService.Stop()) {
+        if (!queueService.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop MultiThreadService.");
+        }
+    }
     if (socket != NULL_PTR(UDPSocket*)) {
         if (!socket->Close()) {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the UDP receiver.");
@@ -73,28 +167,75 @@ UDPReceiver::~UDPReceiver() {
             delete socket;
         }
     }
+    if (queueSockets != NULL_PTR(UDPSocket **)) {
+        uint32 q;
+        for (q = 0u; q < (numberOfQueues - 1u); q++) {
+            if (queueSockets[q] != NULL_PTR(UDPSocket*)) {
+                (void) queueSockets[q]->Close();
+                delete queueSockets[q];
+            }
+        }
+        delete[] queueSockets;
+    }
     if (memoryIndependentThread != NULL_PTR(void *)) {
-        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(memoryIndependentThread);
+        memoryHeap->Free(memoryIndependentThread);
     }
+    delete[] sequenceBuffer;
+    delete[] queueBatches;
+    delete[] queueReceived;
 }
 
 bool UDPReceiver::AllocateMemory() {
     bool ok = MemoryDataSourceI::AllocateMemory();
+    if ((ok) && (numberOfPackets > 0u)) {
+        void *signalAddress = NULL_PTR(void *);
+        ok = GetSignalMemoryBuffer(0u, 0u, signalAddress);
+        if (ok) {
+            packetCount = reinterpret_cast<uint32 *>(signalAddress);
+            ok = GetSignalMemoryBuffer(1u, 0u, signalAddress);
+        }
+        uint32 packetsSignal = 2u;
+        if (ok) {
+            droppedPackets = reinterpret_cast<uint32 *>(signalAddress);
+            if (queueStatistics) {
+                ok = GetSignalMemoryBuffer(2u, 0u, signalAddress);
+                if (ok) {
+                    queueStatisticsSignal = reinterpret_cast<uint32 *>(signalAddress);
+                }
+                packetsSignal = 3u;
+            }
+        }
+        if (ok) {
+            ok = GetSignalMemoryBuffer(packetsSignal, 0u, signalAddress);
+        }
+        if (ok) {
+            packets = reinterpret_cast<char8 *>(signalAddress);
+        }
+    }
     if (executionMode == UDPReceiverExecutionModeIndependent) {
-        memoryIndependentThread = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(totalMemorySize);
+        if (numberOfPackets == 0u) {
+            memoryIndependentThread = memoryHeap->Malloc(3u * totalMemorySize);
+            ok = (memoryIndependentThread != NULL_PTR(void *));
+            if (ok) {
+                (void) placement.BindMemory(memoryIndependentThread, 3u * totalMemorySize);
+            }
+        }
         if (ok) {
-            executor.SetName(GetName());
-            ok = (executor.Start() == ErrorManagement::NoError);
+            (void) placement.BindMemory(memory, totalMemorySize);
+            if (numberOfQueues > 1u) {
+                queueService.SetName(GetName());
+                ok = (queueService.Start() == ErrorManagement::NoError);
+            }
+            else {
+                executor.SetName(GetName());
+                ok = (executor.Start() == ErrorManagement::NoError);
+            }
         }
     }
     return ok;
 }
 
 bool UDPReceiver::BrokerCopyTerminated() {
-    if (muxIThread.FastLock() == ErrorManagement::NoError) {
-        copyInProgress = false;
-    }
-    muxIThread.FastUnLock();
     return true;
 }
 
@@ -155,6 +296,120 @@ bool UDPReceiver::Initialise(StructuredDataI &data) {
         }
         else {
             timeout.SetTimeoutSec(timeoutVal);
+            timeoutMSec = static_cast<int32>(timeout.GetTimeoutMSec());
+        }
+    }
+    if (ok) {
+        StreamString transportStr;
+        if (!data.Read("Transport", transportStr)) {
+            transportStr = "Socket";
+        }
+        if (transportStr == "Socket") {
+            transport = UDPTransportSocket;
+        }
+        else if (transportStr == "XDP") {
+            transport = UDPTransportXDP;
+            ok = data.Read("Interface", interfaceName);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Interface shall be specified if Transport = XDP");
+            }
+            if (!data.Read("QueueId", queueId)) {
+                queueId = 0u;
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Transport shall be Socket or XDP");
+            ok = false;
+        }
+    }
+    if (ok) {
+        if (!data.Read("NumberOfPackets", numberOfPackets)) {
+            numberOfPackets = 0u;
+        }
+        if (numberOfPackets > 0u) {
+            StreamString packetsModeStr;
+            if (!data.Read("PacketsMode", packetsModeStr)) {
+                packetsModeStr = "SinceLastCycle";
+            }
+            if (packetsModeStr == "SinceLastCycle") {
+                packetsMode = UDPReceiverPacketsModeSinceLastCycle;
+            }
+            else if (packetsModeStr == "Last") {
+                packetsMode = UDPReceiverPacketsModeLast;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "PacketsMode shall be SinceLastCycle or Last");
+                ok = false;
+            }
+            if ((ok) && (transport == UDPTransportXDP)) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfPackets > 0 is only supported with Transport = Socket");
+                ok = false;
+            }
+        }
+    }
+    if (ok) {
+        uint32 sequenceHeaderIn = 0u;
+        if (data.Read("SequenceHeader", sequenceHeaderIn)) {
+            sequenceHeader = (sequenceHeaderIn == 1u);
+        }
+        if ((sequenceHeader) && (numberOfPackets > 0u)) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "SequenceHeader = 1 is not supported with NumberOfPackets > 0");
+            ok = false;
+        }
+    }
+    if (ok) {
+        if (!data.Read("MulticastInterface", multicastInterface)) {
+            multicastInterface = "";
+        }
+        if ((multicastInterface.Size() > 0LLU) && (address.Size() == 0LLU)) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "MulticastInterface shall only be set with a multicast Address");
+            ok = false;
+        }
+    }
+    if (ok) {
+        if (!data.Read("NumberOfQueues", numberOfQueues)) {
+            numberOfQueues = 1u;
+        }
+        ok = ((numberOfQueues > 0u) && (numberOfQueues <= UDP_RECEIVER_MAX_QUEUES));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfQueues shall be > 0 and <= %d", UDP_RECEIVER_MAX_QUEUES);
+        }
+    }
+    if ((ok) && (numberOfQueues > 1u)) {
+        ok = ((executionMode == UDPReceiverExecutionModeIndependent) && (numberOfPackets > 0u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfQueues > 1 is only supported with ExecutionMode = IndependentThread and NumberOfPackets > 0");
+        }
+        if ((ok) && (address.Size() > 0LLU)) {
+            //Multicast datagrams are delivered to all the sockets bound to the port
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfQueues > 1 is not supported with a multicast Address");
+            ok = false;
+        }
+    }
+    if (ok) {
+        StreamString steeringStr;
+        if (!data.Read("Steering", steeringStr)) {
+            steeringStr = "Hash";
+        }
+        if (steeringStr == "Hash") {
+            steering = UDPReceiverSteeringHash;
+        }
+        else if (steeringStr == "CPU") {
+            steering = UDPReceiverSteeringCPU;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Steering shall be Hash or CPU");
+            ok = false;
+        }
+    }
+    if (ok) {
+        uint32 queueStatisticsIn = 0u;
+        if (data.Read("QueueStatistics", queueStatisticsIn)) {
+            queueStatistics = (queueStatisticsIn == 1u);
+        }
+        if ((queueStatistics) && (numberOfPackets == 0u)) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "QueueStatistics = 1 is only supported with NumberOfPackets > 0");
+            ok = false;
         }
     }
     if (executionMode == UDPReceiverExecutionModeIndependent) {
@@ -165,6 +420,9 @@ bool UDPReceiver::Initialise(StructuredDataI &data) {
                 ok = true;
             }
         }
+        if (ok) {
+            ok = placement.Initialise(data);
+        }
         if (ok) {
             ok = data.Read("StackSize", stackSize);
             if (!ok) {
@@ -182,6 +440,9 @@ bool UDPReceiver::SetConfiguredDatabase(StructuredDataI &data) {
         socket = new UDPSocket;
 
         ok = socket->Open();
+        if ((ok) && (numberOfQueues > 1u)) {
+            ok = UDPReceiverEnableReusePort(static_cast<int32>(socket->GetReadHandle()));
+        }
     }
     if (ok) {
         if (address.Size() > 0LLU) {
@@ -195,9 +456,7 @@ bool UDPReceiver::SetConfiguredDatabase(StructuredDataI &data) {
                     int32 netValue = static_cast<int32>(strtol(networkBlock.Buffer(), NULL_PTR(char8**), 10));
                     if ((netValue >= 224) && (netValue <= 239)) {
                         /* The net address belongs to the multicast address range therefore it must be a multicast group */
-                        if (socket != NULL_PTR(UDPSocket*)) {
-                            ok = socket->Join(address.Buffer());
-                        }
+                        ok = JoinMulticastGroup();
                     }
                     else {
                         ok = false;
@@ -212,31 +471,297 @@ bool UDPReceiver::SetConfiguredDatabase(StructuredDataI &data) {
             ok = socket->Listen(port);
         }
     }
-    if (executionMode == UDPReceiverExecutionModeIndependent) {
+    if ((ok) && (numberOfQueues > 1u)) {
+        //The sockets are added to the reuseport group in the order of the queues (the index returned by the steering program)
+        queueSockets = new UDPSocket*[numberOfQueues - 1u];
+        uint32 q;
+        for (q = 0u; q < (numberOfQueues - 1u); q++) {
+            queueSockets[q] = NULL_PTR(UDPSocket*);
+        }
+        for (q = 0u; (q < (numberOfQueues - 1u)) && (ok); q++) {
+            queueSockets[q] = new UDPSocket;
+            ok = queueSockets[q]->Open();
+            if (ok) {
+                ok = UDPReceiverEnableReusePort(static_cast<int32>(queueSockets[q]->GetReadHandle()));
+            }
+            if (ok) {
+                ok = queueSockets[q]->Listen(port);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not open the socket of the queue %d", (q + 1u));
+            }
+        }
+        if ((ok) && (steering == UDPReceiverSteeringCPU)) {
+            ok = UDPReceiverAttachCPUSteering(static_cast<int32>(socket->GetReadHandle()), numberOfQueues);
+        }
+    }
+    if ((ok) && (transport == UDPTransportXDP)) {
+        uint32 packetSize = 0u;
+        uint32 nOfSignals = GetNumberOfSignals();
+        uint32 s;
+        for (s = 0u; (s < nOfSignals) && (ok); s++) {
+            uint32 signalSize = 0u;
+            ok = GetSignalByteSize(s, signalSize);
+            packetSize += signalSize;
+        }
+        if (sequenceHeader) {
+            packetSize += UDP_SEQUENCE_HEADER_SIZE;
+        }
+        if (ok) {
+            xdpActive = xdp.Open(interfaceName.Buffer(), queueId, packetSize);
+            if (xdpActive) {
+                REPORT_ERROR(ErrorManagement::Information, "Receiving from the AF_XDP socket on %s queue %d", interfaceName.Buffer(), queueId);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not open the AF_XDP socket on %s. Using the UDPSocket.", interfaceName.Buffer());
+            }
+        }
+    }
+    if ((ok) && (numberOfPackets > 0u)) {
+        uint32 nOfSignals = GetNumberOfSignals();
+        uint32 packetsSignal = (queueStatistics) ? (3u) : (2u);
+        ok = (nOfSignals > packetsSignal);
+        uint32 s;
+        for (s = 0u; (s < 2u) && (ok); s++) {
+            uint32 nOfElements = 0u;
+            ok = GetSignalNumberOfElements(s, nOfElements);
+            if (ok) {
+                ok = (GetSignalType(s) == UnsignedInteger32Bit) && (nOfElements == 1u);
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "With NumberOfPackets > 0 the first two signals (packet count and dropped packets) shall be uint32 scalars followed by the packets");
+        }
+        if ((ok) && (queueStatistics)) {
+            uint32 nOfElements = 0u;
+            ok = GetSignalNumberOfElements(2u, nOfElements);
+            if (ok) {
+                ok = (GetSignalType(2u) == UnsignedInteger32Bit) && (nOfElements == (2u * numberOfQueues));
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "With QueueStatistics = 1 the third signal shall be a uint32 array with 2 * NumberOfQueues (%d) elements", (2u * numberOfQueues));
+            }
+        }
+        uint32 packetsSize = 0u;
+        for (s = packetsSignal; (s < nOfSignals) && (ok); s++) {
+            uint32 signalSize = 0u;
+            ok = GetSignalByteSize(s, signalSize);
+            packetsSize += signalSize;
+        }
+        if (ok) {
+            ok = ((packetsSize % numberOfPackets) == 0u) && (packetsSize > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The size of the packets signals (%d) shall be a multiple of NumberOfPackets (%d)", packetsSize, numberOfPackets);
+            }
+        }
+        if (ok) {
+            ok = batch.Initialise(socket->GetReadHandle(), numberOfPackets, packetsSize / numberOfPackets);
+        }
+        if ((ok) && (numberOfQueues > 1u)) {
+            queueBatches = new UDPReceiverBatch[numberOfQueues - 1u];
+            uint32 q;
+            for (q = 0u; (q < (numberOfQueues - 1u)) && (ok); q++) {
+                ok = queueBatches[q].Initialise(queueSockets[q]->GetReadHandle(), numberOfPackets, packetsSize / numberOfPackets);
+            }
+        }
+        if (ok) {
+            queueReceived = new uint32[numberOfQueues];
+            uint32 q;
+            for (q = 0u; q < numberOfQueues; q++) {
+                queueReceived[q] = 0u;
+            }
+        }
+    }
+    if ((ok) && (sequenceHeader)) {
+        uint32 nOfSignals = GetNumberOfSignals();
+        ok = (nOfSignals > UDP_RECEIVER_SEQUENCE_SIGNALS);
+        uint32 s;
+        for (s = 0u; (s < UDP_RECEIVER_SEQUENCE_SIGNALS) && (ok); s++) {
+            uint32 nOfElements = 0u;
+            ok = GetSignalNumberOfElements(s, nOfElements);
+            if (ok) {
+                TypeDescriptor expectedType = UnsignedInteger32Bit;
+                if (s == (UDP_RECEIVER_SEQUENCE_SIGNALS - 1u)) {
+                    expectedType = SignedInteger64Bit;
+                }
+                ok = (GetSignalType(s) == expectedType) && (nOfElements == 1u);
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "With SequenceHeader = 1 the first four signals (lost, duplicated and reordered datagrams and latency) shall be uint32, uint32, uint32 and int64 scalars followed by the payload");
+        }
+        sequencePayloadSize = 0u;
+        for (s = UDP_RECEIVER_SEQUENCE_SIGNALS; (s < nOfSignals) && (ok); s++) {
+            uint32 signalSize = 0u;
+            ok = GetSignalByteSize(s, signalSize);
+            sequencePayloadSize += signalSize;
+        }
+        if (ok) {
+            delete[] sequenceBuffer;
+            sequenceBuffer = new char8[UDP_SEQUENCE_HEADER_SIZE + sequencePayloadSize];
+        }
+    }
+    if ((executionMode == UDPReceiverExecutionModeIndependent) && (numberOfQueues > 1u)) {
+        queueService.SetCPUMask(cpuMask);
+        placement.Apply(queueService);
+        queueService.SetStackSize(stackSize);
+        queueService.SetNumberOfPoolThreads(numberOfQueues);
+    }
+    else if (executionMode == UDPReceiverExecutionModeIndependent) {
         executor.SetCPUMask(cpuMask);
+        placement.Apply(executor);
         executor.SetStackSize(stackSize);
     }
+    else {
+        //NOOP
+    }
 
     return ok;
 }
 
 bool UDPReceiver::Synchronise() {
     bool ok = true;
-    if (executionMode == UDPReceiverExecutionModeIndependent) {
-        if (muxIThread.FastLock() == ErrorManagement::NoError) {
-            copyInProgress = true;
+    if (numberOfPackets > 0u) {
+        if (executionMode == UDPReceiverExecutionModeIndependent) {
+            if (muxIThread.FastLock() == ErrorManagement::NoError) {
+                PublishPackets();
+            }
+            muxIThread.FastUnLock();
+        }
+        else {
+            //Wait for the first datagram and then drain the socket so that the ring holds the most recent packets
+            uint32 received = 0u;
+            ok = batch.Receive(timeoutMSec, received).ErrorsCleared();
+            bool drain = ok;
+            while (drain) {
+                batch.Push();
+                queueReceived[0u] += received;
+                drain = (received == numberOfPackets);
+                if (drain) {
+                    drain = batch.Receive(0, received).ErrorsCleared();
+                }
+            }
+            PublishPackets();
+        }
+    }
+    else if (executionMode == UDPReceiverExecutionModeIndependent) {
+        if ((tripleBufferState & UDP_RECEIVER_TRIPLE_BUFFER_FRESH) != 0) {
+            //Take the latest complete packet and give back the slot which was read in the previous cycle
+            readSlot = (Atomic::Exchange(&tripleBufferState, readSlot) & UDP_RECEIVER_TRIPLE_BUFFER_SLOT_MASK);
+            ok = MemoryOperationsHelper::Copy(memory, GetTripleBufferSlot(readSlot), totalMemorySize);
         }
-        muxIThread.FastUnLock();
+    }
+    else if (sequenceHeader) {
+        ok = ReadSequencedPacket(reinterpret_cast<char8*>(memory));
     }
     else {
-        char8 *const dataBuffer = reinterpret_cast<char8*>(memory);
-        if (socket != NULL_PTR(UDPSocket*)) {
-            ok = socket->Read(dataBuffer, totalMemorySize, timeout);
+        uint32 readSize = totalMemorySize;
+        ok = ReadPacket(reinterpret_cast<char8*>(memory), readSize);
+    }
+    return ok;
+}
+
+bool UDPReceiver::ReadPacket(char8 * const buffer,
+                             uint32 &size) {
+    bool ok = true;
+    if (xdpActive) {
+        ok = xdp.Read(buffer, size, port, address, timeoutMSec);
+    }
+    else if (socket != NULL_PTR(UDPSocket*)) {
+        ok = socket->Read(buffer, size, timeout);
+    }
+    else {
+        //NOOP
+    }
+    return ok;
+}
+
+bool UDPReceiver::ReadSequencedPacket(char8 * const destination) {
+    const uint32 datagramSize = UDP_SEQUENCE_HEADER_SIZE + sequencePayloadSize;
+    bool ok = true;
+    bool fresh = false;
+    while ((ok) && (!fresh)) {
+        uint32 readSize = datagramSize;
+        ok = ReadPacket(sequenceBuffer, readSize);
+        if (ok) {
+            int64 latency = 0;
+            UDPSequenceStatus status = UDPSequenceInvalid;
+            if (readSize == datagramSize) {
+                status = sequence.Check(sequenceBuffer, latency);
+            }
+            fresh = (status == UDPSequenceNew);
+            if (fresh) {
+                (void) MemoryOperationsHelper::Copy(&destination[UDP_RECEIVER_SEQUENCE_SIGNALS_SIZE], &sequenceBuffer[UDP_SEQUENCE_HEADER_SIZE], sequencePayloadSize);
+                (void) MemoryOperationsHelper::Copy(&destination[3u * sizeof(uint32)], &latency, static_cast<uint32>(sizeof(int64)));
+            }
+            uint32 counters[3u] = { sequence.GetNumberOfLost(), sequence.GetNumberOfDuplicated(), sequence.GetNumberOfReordered() };
+            (void) MemoryOperationsHelper::Copy(destination, &counters[0u], static_cast<uint32>(sizeof(counters)));
         }
     }
     return ok;
 }
 
+char8 *UDPReceiver::GetTripleBufferSlot(const int32 slot) const {
+    return &(reinterpret_cast<char8 *>(memoryIndependentThread)[static_cast<uint32>(slot) * totalMemorySize]);
+}
+
+void UDPReceiver::PublishPackets() {
+    if (packets != NULL_PTR(char8 *)) {
+        *packetCount = batch.Publish(packets, (packetsMode == UDPReceiverPacketsModeLast));
+        uint32 dropped = batch.GetNumberOfDropped();
+        uint32 q;
+        for (q = 1u; q < numberOfQueues; q++) {
+            dropped += GetQueueBatch(q).GetNumberOfKernelDropped();
+        }
+        *droppedPackets = dropped;
+        if (queueStatisticsSignal != NULL_PTR(uint32 *)) {
+            ReadQueueStatistics(queueStatisticsSignal);
+        }
+    }
+}
+
+bool UDPReceiver::JoinMulticastGroup() {
+    bool ok = (socket != NULL_PTR(UDPSocket*));
+    if ((ok) && (multicastInterface.Size() > 0LLU)) {
+        struct ip_mreqn request;
+        (void) memset(&request, 0, sizeof(request));
+        request.imr_ifindex = static_cast<int32>(if_nametoindex(multicastInterface.Buffer()));
+        ok = (request.imr_ifindex != 0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "MulticastInterface %s does not exist", multicastInterface.Buffer());
+        }
+        if (ok) {
+            ok = (inet_pton(AF_INET, address.Buffer(), &request.imr_multiaddr) == 1);
+        }
+        if (ok) {
+            ok = (setsockopt(static_cast<int32>(socket->GetReadHandle()), IPPROTO_IP, IP_ADD_MEMBERSHIP, &request, static_cast<socklen_t>(sizeof(request))) == 0);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::OSError, "Could not join the multicast group %s on %s", address.Buffer(), multicastInterface.Buffer());
+            }
+        }
+    }
+    else if (ok) {
+        ok = socket->Join(address.Buffer());
+    }
+    else {
+        //NOOP
+    }
+    return ok;
+}
+
+UDPReceiverBatch &UDPReceiver::GetQueueBatch(const uint32 queue) {
+    /*lint -e{613} queue > 0 => numberOfQueues > 1 => queueBatches != NULL*/
+    return (queue == 0u) ? (batch) : (queueBatches[queue - 1u]);
+}
+
+void UDPReceiver::ReadQueueStatistics(uint32 * const destination) {
+    uint32 q;
+    for (q = 0u; q < numberOfQueues; q++) {
+        destination[2u * q] = queueReceived[q];
+        destination[(2u * q) + 1u] = GetQueueBatch(q).GetNumberOfKernelDropped();
+    }
+}
+
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the data is independent of the broker name.*/
 const char8* UDPReceiver::GetBrokerName(StructuredDataI &data,
                                         const SignalDirection direction) {
@@ -253,19 +778,47 @@ bool UDPReceiver::PrepareNextState(const char8 *const currentStateName,
 
 ErrorManagement::ErrorType UDPReceiver::Execute(ExecutionInfo &info) {
     ErrorManagement::ErrorType err = ErrorManagement::NoError;
-    if (info.GetStage() != ExecutionInfo::BadTerminationStage) {
-        char8 *const dataBuffer = reinterpret_cast<char8*>(memoryIndependentThread);
-        if (socket != NULL_PTR(UDPSocket*)) {
-            err.timeout = !socket->Read(dataBuffer, totalMemorySize, timeout);
+    if ((info.GetStage() != ExecutionInfo::BadTerminationStage) && (numberOfPackets > 0u)) {
+        uint32 queue = 0u;
+        if (numberOfQueues > 1u) {
+            queue = info.GetThreadNumber();
         }
-        bool canCopyMemory = false;
-        if (muxIThread.FastLock() == ErrorManagement::NoError) {
-            canCopyMemory = !copyInProgress;
+        if ((numberOfQueues > 1u) && (info.GetStage() == ExecutionInfo::StartupStage)) {
+            //Pin the queue thread on the (queue modulo number of CPUs)-th CPU of the mask
+            uint64 cpus = placement.HasCPUMask() ? placement.GetCPUBits() : static_cast<uint64>(cpuMask);
+            (void) ThreadPlacement::PinCallingThread(cpus, queue);
         }
-        muxIThread.FastUnLock();
-        if (canCopyMemory) {
-            err.fatalError = !MemoryOperationsHelper::Copy(memory, dataBuffer, totalMemorySize);
+        else if (queue < numberOfQueues) {
+            UDPReceiverBatch &queueBatch = GetQueueBatch(queue);
+            uint32 received = 0u;
+            err = queueBatch.Receive(timeoutMSec, received);
+            if (received > 0u) {
+                if (muxIThread.FastLock() == ErrorManagement::NoError) {
+                    queueBatch.PushInto(batch);
+                    queueReceived[queue] += received;
+                }
+                muxIThread.FastUnLock();
+            }
         }
+        else {
+            //NOOP
+        }
+    }
+    else if (info.GetStage() != ExecutionInfo::BadTerminationStage) {
+        if (sequenceHeader) {
+            err.timeout = !ReadSequencedPacket(GetTripleBufferSlot(writeSlot));
+        }
+        else {
+            uint32 readSize = totalMemorySize;
+            err.timeout = !ReadPacket(GetTripleBufferSlot(writeSlot), readSize);
+        }
+        if (err.ErrorsCleared()) {
+            //Publish the complete packet and continue with the slot which was published before (or given back by Synchronise)
+            writeSlot = (Atomic::Exchange(&tripleBufferState, (writeSlot | UDP_RECEIVER_TRIPLE_BUFFER_FRESH)) & UDP_RECEIVER_TRIPLE_BUFFER_SLOT_MASK);
+        }
+    }
+    else {
+        //NOOP
     }
     return err;
 }
@@ -290,6 +843,49 @@ const UDPReceiverExecutionMode UDPReceiver::GetExecutionMode() const {
     return executionMode;
 }
 
+UDPTransportType UDPReceiver::GetTransport() const {
+    return transport;
+}
+
+uint32 UDPReceiver::GetNumberOfPackets() const {
+    return numberOfPackets;
+}
+
+UDPReceiverPacketsMode UDPReceiver::GetPacketsMode() const {
+    return packetsMode;
+}
+
+bool UDPReceiver::IsSequenceHeaderEnabled() const {
+    return sequenceHeader;
+}
+
+StreamString UDPReceiver::GetMulticastInterface() const {
+    return multicastInterface;
+}
+
+uint32 UDPReceiver::GetNumberOfQueues() const {
+    return numberOfQueues;
+}
+
+UDPReceiverSteering UDPReceiver::GetSteering() const {
+    return steering;
+}
+
+bool UDPReceiver::GetQueueStatistics(const uint32 queue,
+                                     uint32 &received,
+                                     uint32 &dropped) {
+    bool ok = ((queue < numberOfQueues) && (queueReceived != NULL_PTR(uint32 *)));
+    if (ok) {
+        ok = (muxIThread.FastLock() == ErrorManagement::NoError);
+        if (ok) {
+            received = queueReceived[queue];
+            dropped = GetQueueBatch(queue).GetNumberOfKernelDropped();
+        }
+        muxIThread.FastUnLock();
+    }
+    return ok;
+}
+
 CLASS_REGISTER(UDPReceiver, "1.0")
 
 }
@@ -35,8 +35,13 @@
 #include "MemoryDataSourceI.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "EventSem.h"
+#include "MultiThreadService.h"
 #include "SingleThreadService.h"
+#include "ThreadPlacement.h"
+#include "UDPReceiverBatch.h"
+#include "UDPSequence.h"
 #include "UDPSocket.h"
+#include "UDPXDPTransport.h"
 
 
 /*---------------------------------------------------------------------------*/
@@ -49,6 +54,16 @@ typedef enum {
     UDPReceiverExecutionModeRealTime
 } UDPReceiverExecutionMode;
 
+typedef enum {
+    UDPReceiverPacketsModeSinceLastCycle,
+    UDPReceiverPacketsModeLast
+} UDPReceiverPacketsMode;
+
+typedef enum {
+    UDPReceiverSteeringHash,
+    UDPReceiverSteeringCPU
+} UDPReceiverSteering;
+
 
 /**
  * @brief A DataSource which receives given signals via UDP with Multicast support.
@@ -57,6 +72,7 @@ typedef enum {
  * +UDPReceiver = {
  *     Class = UDPDrv::UDPReceiver
  *     Address = "230.168.129.30" //Optional. Only for Multicast group
+ *     MulticastInterface = "eth1" //Optional (only with a multicast Address). The network interface where the group is joined. Default: chosen by the kernel routing table.
  *     Port = "44488" //Optional. Default: 44488
  *     Timeout = "5.0" //Optional (seconds) The time the receiver will wait while listening before timing out. Default: Infinite
  *     ExecutionMode = RealTimeThread//Optional (default RealTimeThread)
@@ -64,6 +80,29 @@ typedef enum {
  *       If ExecutionMode == RealTimeThread the DataSource socket read is blocking and handled in the context of the real-time thread.
  *     CPUMask = 0x1
  *     StackSize = 10000000
+ *     ThreadPlacement = { //Optional (only if ExecutionMode == IndependentThread). See ThreadPlacement. Overrides the CPUMask above, sets the priority
+ *                         //of the receiving thread and binds the signal memory to a NUMA node.
+ *         NearDevice = "eth0" //The thread runs on the CPUs local to the NIC and the memory is placed on its NUMA node.
+ *         PriorityClass = RealTimePriorityClass
+ *         PriorityLevel = 10
+ *     }
+ *     HeapName = "HugePageHeap" //Optional. Default: GlobalObjectsDatabase::Instance()->GetStandardHeap(). Heap (e.g. a HugePageHeap) where the signals and the IndependentThread buffers are allocated.
+ *     Transport = Socket //Optional. Default: Socket. If Transport == XDP the datagrams are received from an AF_XDP socket (kernel bypass, see UDPXDPTransport).
+ *       If the AF_XDP socket cannot be created (e.g. not compiled with LIBXDP_DIR or missing CAP_NET_ADMIN) the UDPSocket is used with a warning.
+ *     Interface = "eth0" //Compulsory if Transport == XDP. The network interface.
+ *     QueueId = 0 //Optional (only if Transport == XDP). Default: 0. The queue of the interface where the datagrams are steered to.
+ *     NumberOfPackets = 64 //Optional. Default: 0. If > 0 the datagrams are received in batches with recvmmsg and the last NumberOfPackets are buffered (see below).
+ *     PacketsMode = SinceLastCycle //Optional (only if NumberOfPackets > 0). Default: SinceLastCycle.
+ *       If PacketsMode == SinceLastCycle only the packets received since the previous cycle are copied (the remaining slots keep their previous value).
+ *       If PacketsMode == Last the last NumberOfPackets packets received are copied (oldest first), even if they were already copied in a previous cycle.
+ *     SequenceHeader = 1 //Optional. Default: 0. If 1 each datagram shall start with the UDPSequenceHeader stamped by the UDPSender (SequenceHeader = 1, see below).
+ *       Not supported with NumberOfPackets > 0.
+ *     NumberOfQueues = 4 //Optional. Default: 1. If > 1 the datagrams are received by NumberOfQueues threads, each one with its own SO_REUSEPORT socket (see below).
+ *       Only supported with ExecutionMode = IndependentThread, NumberOfPackets > 0, Transport = Socket and without Address.
+ *     Steering = Hash //Optional (only if NumberOfQueues > 1). Default: Hash.
+ *       If Steering == Hash the kernel distributes the flows over the queues with a hash of the source and destination addresses and ports.
+ *       If Steering == CPU each datagram is received by the queue (CPU modulo NumberOfQueues), where CPU is the core where the kernel processed the datagram.
+ *     QueueStatistics = 1 //Optional. Default: 0. If 1 (only if NumberOfPackets > 0) the third signal holds the per queue statistics (see below).
  *     Signals = {
  *          Signal2 = {
  *             Type = uint32 //Any MARTe2 type
@@ -73,6 +112,40 @@ typedef enum {
  * }
  *
  * The Signals section is in practice a description of the structure of the UDP Packet read.
+ *
+ * If NumberOfPackets > 0 the first two signals shall be uint32 scalars: the first holds the number of packets received since
+ * the previous cycle (clipped to NumberOfPackets) and the second the total number of packets dropped, either because they
+ * were overwritten before being copied or because the kernel socket buffer was full. The remaining signals hold the array
+ * of NumberOfPackets packets, so that their total size shall be a multiple of NumberOfPackets (e.g. a single uint8 signal with
+ * NumberOfElements = NumberOfPackets * packet size). In RealTimeThread mode Synchronise waits (up to Timeout) for at least one
+ * datagram and then drains the socket; in IndependentThread mode the thread receives the datagrams and Synchronise only copies
+ * them from the ring.
+ *
+ * If QueueStatistics = 1 the third signal shall be a uint32 array of 2 * NumberOfQueues elements, holding for each queue the total number
+ * of datagrams received and the number of datagrams dropped by the kernel on its socket, and the packets start at the fourth signal.
+ *
+ * If NumberOfQueues > 1 the datagrams are received by a pool of NumberOfQueues threads (a MultiThreadService). Each thread has its own socket
+ * bound to the same Port with SO_REUSEPORT, so that the kernel spreads the senders over the queues without any lock on the receive path.
+ * Each thread is pinned on its own CPU of the ThreadPlacement CPUs (or of the CPUMask): the queue q runs on the (q modulo number of CPUs)-th CPU.
+ * With Steering = CPU and the NIC RSS (or RPS) configured to process the flows of queue q on the CPU of the thread q, each datagram is
+ * received on the core where it arrived. All the queues push the received datagrams, under a lock, in the same ring, which is
+ * copied in the signals as with a single queue. The packets of different queues are merged in the order they were pushed.
+ *
+ * In IndependentThread mode (with NumberOfPackets = 0) the thread receives each datagram into one of three slots and publishes it
+ * with an atomic exchange (triple buffer). Synchronise takes the latest complete packet, without locking, and copies it into the
+ * DataSource memory, so that no packet is discarded while the broker is copying and the thread never waits for the real-time thread.
+ *
+ * If SequenceHeader = 1 the first four signals shall be: the number of lost datagrams (uint32), the number of duplicated datagrams (uint32),
+ * the number of datagrams received out of order (uint32) and the one-way latency of the last datagram in nanoseconds (int64), i.e. the
+ * difference between the receiver and the sender CLOCK_REALTIME, which is only meaningful if the clocks are synchronised (e.g. PTP).
+ * The remaining signals describe the datagram after the header. The sequence numbers are checked against a window of the last
+ * UDP_SEQUENCE_WINDOW_SIZE datagrams with a constant cost (see UDPSequence). Only the most recent datagram updates the signals: duplicated,
+ * reordered and invalid datagrams (wrong magic or too short) are discarded, only updating the counters, and the receiver
+ * waits (up to Timeout) for the next datagram.
+ *
+ * With Transport = XDP the packet layout and the signals are the same. The reading thread (the independent thread or,
+ * in RealTimeThread mode, the real-time thread) busy-polls the AF_XDP rings up to Timeout, so that it should be pinned
+ * to a dedicated core (CPUMask). NumberOfPackets > 0 is only supported with Transport = Socket.
  */
 class UDPReceiver : public MemoryDataSourceI, public EmbeddedServiceMethodBinderI {
 public:
@@ -135,7 +208,7 @@ public:
     virtual bool AllocateMemory();
 
     /**
-     * @brief Indicates that the broker has finished to copy the data from the data source memory.
+     * @brief NOOP. The independent thread never writes into the data source memory (see Synchronise).
      * @return true
      */
     virtual bool BrokerCopyTerminated();
@@ -176,13 +249,113 @@ public:
      */
     const UDPReceiverExecutionMode GetExecutionMode() const;
 
+    /**
+     * @brief Gets the configured transport.
+     * @return the configured transport.
+     */
+    UDPTransportType GetTransport() const;
+
+    /**
+     * @brief Gets the number of packets received per batch and buffered (0 if the packets are not received in batches).
+     * @return the number of packets received per batch and buffered.
+     */
+    uint32 GetNumberOfPackets() const;
+
+    /**
+     * @brief Gets which of the buffered packets are copied in every cycle.
+     * @return which of the buffered packets are copied in every cycle.
+     */
+    UDPReceiverPacketsMode GetPacketsMode() const;
+
+    /**
+     * @brief Checks if the datagrams start with a UDPSequenceHeader.
+     * @return true if SequenceHeader = 1.
+     */
+    bool IsSequenceHeaderEnabled() const;
+
+    /**
+     * @brief Gets the network interface where the multicast group is joined.
+     * @return the network interface where the multicast group is joined (empty if chosen by the kernel).
+     */
+    StreamString GetMulticastInterface() const;
+
+    /**
+     * @brief Gets the number of receive queues.
+     * @return the number of receive queues.
+     */
+    uint32 GetNumberOfQueues() const;
+
+    /**
+     * @brief Gets how the datagrams are distributed over the queues.
+     * @return how the datagrams are distributed over the queues.
+     */
+    UDPReceiverSteering GetSteering() const;
+
+    /**
+     * @brief Gets the statistics of a receive queue (only if NumberOfPackets > 0).
+     * @param[in] queue the index of the queue.
+     * @param[out] received the total number of datagrams received by the queue.
+     * @param[out] dropped the number of datagrams dropped by the kernel on the socket of the queue.
+     * @return true if \a queue < GetNumberOfQueues() and the sockets are open.
+     */
+    bool GetQueueStatistics(const uint32 queue,
+                            uint32 &received,
+                            uint32 &dropped);
+
 private:
 
+    /**
+     * @brief Reads one datagram from the AF_XDP transport (if active) or from the UDPSocket.
+     * @param[out] buffer where to copy the datagram.
+     * @param[in,out] size the size of \a buffer, updated with the number of bytes read.
+     * @return true if a datagram was read before the timeout.
+     */
+    bool ReadPacket(char8 * const buffer,
+                    uint32 &size);
+
+    /**
+     * @brief Reads datagrams until one which is more recent than all the previous ones is received (see SequenceHeader).
+     * @param[out] destination where to write the counters, the latency and the datagram payload (totalMemorySize bytes).
+     * The counters are always updated, while the latency and the payload are only updated if true is returned.
+     * @return true if a new datagram was read before the timeout.
+     */
+    bool ReadSequencedPacket(char8 * const destination);
+
+    /**
+     * @brief Gets the address of a slot of the triple buffer.
+     */
+    char8 *GetTripleBufferSlot(const int32 slot) const;
+
+    /**
+     * @brief Copies the buffered packets, the packet count and the dropped count into the signals (see NumberOfPackets).
+     */
+    void PublishPackets();
+
+    /**
+     * @brief Joins the multicast group Address on the socket (on the MulticastInterface if set).
+     */
+    bool JoinMulticastGroup();
+
+    /**
+     * @brief Gets the batch of the receive queue \a queue (< numberOfQueues).
+     */
+    UDPReceiverBatch &GetQueueBatch(const uint32 queue);
+
+    /**
+     * @brief Reads the statistics of all the queues (muxIThread shall be locked).
+     */
+    void ReadQueueStatistics(uint32 * const destination);
+
     /**
      * The EmbeddedThread where the Execute method waits for the period to elapse.
      */
     SingleThreadService executor;
 
+    /**
+     * The threads of the receive queues (if NumberOfQueues > 1).
+     */
+    MultiThreadService queueService;
+
     /**
      * The timeout for which the server will listen to the specified port
      */
@@ -208,6 +381,11 @@ private:
      */
     uint32 cpuMask;
 
+    /**
+     * The CPU, priority and NUMA placement of the executor thread and of the signal memory.
+     */
+    ThreadPlacement placement;
+
     /**
      * The stack size
      */
@@ -219,19 +397,149 @@ private:
     UDPReceiverExecutionMode executionMode;
 
     /**
-     * Mux for the IndependentThread implementation.
+     * Mux for the IndependentThread implementation with NumberOfPackets > 0.
      */
     FastPollingMutexSem muxIThread;
 
     /**
-     * Copy in progres flag for the IndependentThread implementation.
+     * Memory for the independent thread reading: three slots of totalMemorySize (triple buffer).
      */
-    bool copyInProgress;
+    void *memoryIndependentThread;
 
     /**
-     * Memory for the independent thread reading.
+     * The slot being written by the independent thread.
      */
-    void *memoryIndependentThread;
+    int32 writeSlot;
+
+    /**
+     * The slot exchanged between the independent thread and Synchronise, with the FRESH flag set when it holds a packet not yet read.
+     */
+    volatile int32 tripleBufferState;
+
+    /**
+     * The slot read by Synchronise.
+     */
+    int32 readSlot;
+
+    /**
+     * The configured transport.
+     */
+    UDPTransportType transport;
+
+    /**
+     * The network interface of the AF_XDP transport.
+     */
+    StreamString interfaceName;
+
+    /**
+     * The queue of the AF_XDP transport.
+     */
+    uint32 queueId;
+
+    /**
+     * The AF_XDP transport.
+     */
+    UDPXDPTransport xdp;
+
+    /**
+     * True if the AF_XDP transport is open.
+     */
+    bool xdpActive;
+
+    /**
+     * The timeout in milliseconds (-1 if infinite).
+     */
+    int32 timeoutMSec;
+
+    /**
+     * The number of packets received per batch and buffered.
+     */
+    uint32 numberOfPackets;
+
+    /**
+     * Which of the buffered packets are copied in every cycle.
+     */
+    UDPReceiverPacketsMode packetsMode;
+
+    /**
+     * Receives the datagrams in batches and buffers the last numberOfPackets.
+     */
+    UDPReceiverBatch batch;
+
+    /**
+     * The number of packets received since the previous cycle.
+     */
+    uint32 *packetCount;
+
+    /**
+     * The number of dropped packets.
+     */
+    uint32 *droppedPackets;
+
+    /**
+     * The array of packets.
+     */
+    char8 *packets;
+
+    /**
+     * True if the datagrams start with a UDPSequenceHeader.
+     */
+    bool sequenceHeader;
+
+    /**
+     * Checks the sequence numbers of the datagrams.
+     */
+    UDPSequence sequence;
+
+    /**
+     * The datagram (header and payload) being received.
+     */
+    char8 *sequenceBuffer;
+
+    /**
+     * The size of the datagram payload (after the header).
+     */
+    uint32 sequencePayloadSize;
+
+    /**
+     * The network interface where the multicast group is joined.
+     */
+    StreamString multicastInterface;
+
+    /**
+     * The number of receive queues.
+     */
+    uint32 numberOfQueues;
+
+    /**
+     * How the datagrams are distributed over the queues.
+     */
+    UDPReceiverSteering steering;
+
+    /**
+     * The sockets of the queues 1 to NumberOfQueues - 1 (the queue 0 uses socket).
+     */
+    UDPSocket **queueSockets;
+
+    /**
+     * The batches of the queues 1 to NumberOfQueues - 1 (the queue 0 uses batch, which also holds the ring of all the queues).
+     */
+    UDPReceiverBatch *queueBatches;
+
+    /**
+     * The total number of datagrams received by each queue.
+     */
+    uint32 *queueReceived;
+
+    /**
+     * True if the third signal holds the per queue statistics.
+     */
+    bool queueStatistics;
+
+    /**
+     * The per queue statistics signal.
+     */
+    uint32 *queueStatisticsSignal;
 };
 }
 #endif
@@ -0,0 +1,235 @@
+/**
+ * @file UDPReceiverBatch.cpp
+ * @brief Source file for class UDPReceiverBatch
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class UDPReceiverBatch (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "UDPReceiverBatch.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+UDPReceiverBatch::UDPReceiverBatch() {
+    socketHandle = -1;
+    numberOfPackets = 0u;
+    packetSize = 0u;
+    controlSize = 0u;
+    receiveBuffer = NULL_PTR(char8 *);
+    controlBuffer = NULL_PTR(char8 *);
+    headers = NULL_PTR(struct mmsghdr *);
+    vectors = NULL_PTR(struct iovec *);
+    ring = NULL_PTR(char8 *);
+    lastReceived = 0u;
+    numberOfPushed = 0u;
+    numberOfConsumed = 0u;
+    numberOfOverwritten = 0u;
+    numberOfKernelDropped = 0u;
+}
+
+UDPReceiverBatch::~UDPReceiverBatch() {
+    Free();
+}
+
+void UDPReceiverBatch::Free() {
+    delete[] receiveBuffer;
+    receiveBuffer = NULL_PTR(char8 *);
+    delete[] controlBuffer;
+    controlBuffer = NULL_PTR(char8 *);
+    delete[] headers;
+    headers = NULL_PTR(struct mmsghdr *);
+    delete[] vectors;
+    vectors = NULL_PTR(struct iovec *);
+    delete[] ring;
+    ring = NULL_PTR(char8 *);
+}
+
+bool UDPReceiverBatch::Initialise(const int32 socketHandleIn,
+                                  const uint32 numberOfPacketsIn,
+                                  const uint32 packetSizeIn) {
+    bool ok = (numberOfPacketsIn > 0u) && (packetSizeIn > 0u);
+    if (ok) {
+        Free();
+        socketHandle = socketHandleIn;
+        numberOfPackets = numberOfPacketsIn;
+        packetSize = packetSizeIn;
+        /*lint -e{9130} -e{9117} -e{1960} CMSG_SPACE is a system macro*/
+        controlSize = static_cast<uint32>(CMSG_SPACE(sizeof(uint32)));
+        receiveBuffer = new char8[numberOfPackets * packetSize];
+        controlBuffer = new char8[numberOfPackets * controlSize];
+        ring = new char8[numberOfPackets * packetSize];
+        headers = new struct mmsghdr[numberOfPackets];
+        vectors = new struct iovec[numberOfPackets];
+        (void) memset(ring, 0, static_cast<size_t>(numberOfPackets * packetSize));
+        (void) memset(headers, 0, sizeof(struct mmsghdr) * numberOfPackets);
+        uint32 n;
+        for (n = 0u; n < numberOfPackets; n++) {
+            vectors[n].iov_base = &receiveBuffer[n * packetSize];
+            vectors[n].iov_len = packetSize;
+            headers[n].msg_hdr.msg_iov = &vectors[n];
+            headers[n].msg_hdr.msg_iovlen = 1u;
+        }
+        lastReceived = 0u;
+        numberOfPushed = 0u;
+        numberOfConsumed = 0u;
+        numberOfOverwritten = 0u;
+        numberOfKernelDropped = 0u;
+#ifdef SO_RXQ_OVFL
+        int32 enable = 1;
+        if (setsockopt(socketHandle, SOL_SOCKET, SO_RXQ_OVFL, &enable, static_cast<socklen_t>(sizeof(enable))) != 0) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not enable SO_RXQ_OVFL. The datagrams dropped by the kernel will not be counted.");
+        }
+#endif
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType UDPReceiverBatch::Receive(const int32 timeoutMSec,
+                                                     uint32 &numberOfReceived) {
+    ErrorManagement::ErrorType err = ErrorManagement::NoError;
+    lastReceived = 0u;
+    struct pollfd pollSocket;
+    pollSocket.fd = socketHandle;
+    pollSocket.events = POLLIN;
+    pollSocket.revents = 0;
+    int32 ready = poll(&pollSocket, 1u, timeoutMSec);
+    if (ready == 0) {
+        err.timeout = true;
+    }
+    else if (ready < 0) {
+        err.timeout = (errno == EINTR);
+        err.OSError = !err.timeout;
+    }
+    else {
+        uint32 n;
+        for (n = 0u; n < numberOfPackets; n++) {
+            //The kernel overwrites the length of the control messages
+            headers[n].msg_hdr.msg_control = &controlBuffer[n * controlSize];
+            headers[n].msg_hdr.msg_controllen = controlSize;
+            headers[n].msg_hdr.msg_flags = 0;
+            headers[n].msg_len = 0u;
+        }
+        int32 received = recvmmsg(socketHandle, headers, numberOfPackets, MSG_DONTWAIT, NULL_PTR(struct timespec *));
+        if (received > 0) {
+            lastReceived = static_cast<uint32>(received);
+        }
+        else if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            err.timeout = true;
+        }
+        else {
+            err.OSError = true;
+        }
+        if (err.OSError) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "recvmmsg failed with errno %d", errno);
+        }
+    }
+    numberOfReceived = lastReceived;
+    return err;
+}
+
+void UDPReceiverBatch::Push() {
+    PushInto(*this);
+}
+
+void UDPReceiverBatch::PushInto(UDPReceiverBatch &target) {
+    uint32 n;
+    for (n = 0u; n < lastReceived; n++) {
+        char8 *slot = &target.ring[static_cast<uint32>(target.numberOfPushed % target.numberOfPackets) * packetSize];
+        uint32 size = headers[n].msg_len;
+        if (size > packetSize) {
+            size = packetSize;
+        }
+        (void) memcpy(slot, &receiveBuffer[n * packetSize], static_cast<size_t>(size));
+        if (size < packetSize) {
+            (void) memset(&slot[size], 0, static_cast<size_t>(packetSize - size));
+        }
+        /*lint -e{9130} -e{9117} -e{1960} -e{925} CMSG_FIRSTHDR, CMSG_NXTHDR and CMSG_DATA are system macros*/
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&headers[n].msg_hdr); cmsg != NULL_PTR(struct cmsghdr *); cmsg = CMSG_NXTHDR(&headers[n].msg_hdr, cmsg)) {
+#ifdef SO_RXQ_OVFL
+            if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SO_RXQ_OVFL)) {
+                (void) memcpy(&numberOfKernelDropped, CMSG_DATA(cmsg), sizeof(uint32));
+            }
+#endif
+        }
+        target.numberOfPushed++;
+    }
+    lastReceived = 0u;
+}
+
+uint32 UDPReceiverBatch::Publish(char8 * const destination,
+                                 const bool lastPackets) {
+    uint64 available = numberOfPushed - numberOfConsumed;
+    if (available > numberOfPackets) {
+        numberOfOverwritten += static_cast<uint32>(available - numberOfPackets);
+        available = numberOfPackets;
+    }
+    if (lastPackets) {
+        uint32 numberToCopy = numberOfPackets;
+        if (numberOfPushed < numberOfPackets) {
+            numberToCopy = static_cast<uint32>(numberOfPushed);
+        }
+        CopyFromRing(destination, numberOfPushed - numberToCopy, numberToCopy);
+    }
+    else {
+        CopyFromRing(destination, numberOfPushed - available, static_cast<uint32>(available));
+    }
+    numberOfConsumed = numberOfPushed;
+    return static_cast<uint32>(available);
+}
+
+void UDPReceiverBatch::CopyFromRing(char8 * const destination,
+                                    const uint64 firstPacket,
+                                    const uint32 numberToCopy) const {
+    uint32 firstSlot = static_cast<uint32>(firstPacket % numberOfPackets);
+    uint32 numberBeforeWrap = numberOfPackets - firstSlot;
+    if (numberBeforeWrap > numberToCopy) {
+        numberBeforeWrap = numberToCopy;
+    }
+    (void) memcpy(destination, &ring[firstSlot * packetSize], static_cast<size_t>(numberBeforeWrap * packetSize));
+    if (numberBeforeWrap < numberToCopy) {
+        (void) memcpy(&destination[numberBeforeWrap * packetSize], ring, static_cast<size_t>((numberToCopy - numberBeforeWrap) * packetSize));
+    }
+}
+
+uint32 UDPReceiverBatch::GetNumberOfDropped() const {
+    return numberOfOverwritten + numberOfKernelDropped;
+}
+
+uint32 UDPReceiverBatch::GetNumberOfKernelDropped() const {
+    return numberOfKernelDropped;
+}
+
+}
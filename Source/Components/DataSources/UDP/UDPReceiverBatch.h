@@ -0,0 +1,203 @@
+/**
+ * @file UDPReceiverBatch.h
+ * @brief Header file for class UDPReceiverBatch
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class UDPReceiverBatch
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef UDP_RECEIVER_BATCH_H_
+#define UDP_RECEIVER_BATCH_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ErrorType.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Receives many UDP datagrams per system call (recvmmsg) and keeps the last NumberOfPackets in a ring (see UDPReceiver NumberOfPackets).
+ * @details The datagrams are received into a preallocated area of NumberOfPackets slots of PacketSize bytes and then
+ * pushed into a ring with the same number of slots. Datagrams shorter than PacketSize are zero padded and longer datagrams
+ * are truncated. The packets which are overwritten in the ring before being published are counted as dropped, together
+ * with the datagrams dropped by the kernel because the socket receive buffer was full (SO_RXQ_OVFL, when available).
+ *
+ * Receive may be called by a thread different from the one calling Push, Publish and GetNumberOfDropped, which shall be
+ * called with an external lock.
+ */
+class UDPReceiverBatch {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    UDPReceiverBatch();
+
+    /**
+     * @brief Destructor. Frees the receive area and the ring.
+     */
+    ~UDPReceiverBatch();
+
+    /**
+     * @brief Allocates the receive area and the ring and enables the kernel drop counter of the socket.
+     * @param[in] socketHandleIn the handle of the (listening) UDP socket.
+     * @param[in] numberOfPacketsIn the maximum number of datagrams received per call and the number of packets kept in the ring.
+     * @param[in] packetSizeIn the size of each packet.
+     * @return true if numberOfPacketsIn and packetSizeIn are > 0.
+     */
+    bool Initialise(const int32 socketHandleIn,
+                    const uint32 numberOfPacketsIn,
+                    const uint32 packetSizeIn);
+
+    /**
+     * @brief Waits up to timeoutMSec for the socket to be readable and receives all the available datagrams (up to NumberOfPackets) with a single recvmmsg.
+     * @param[in] timeoutMSec the time to wait in milliseconds (-1 waits forever, 0 does not wait).
+     * @param[out] numberOfReceived the number of datagrams received.
+     * @return ErrorManagement::Timeout if no datagram was received in time or ErrorManagement::OSError if the socket could not be read.
+     */
+    ErrorManagement::ErrorType Receive(const int32 timeoutMSec,
+                                       uint32 &numberOfReceived);
+
+    /**
+     * @brief Pushes the datagrams received by the last Receive into the ring.
+     */
+    void Push();
+
+    /**
+     * @brief Pushes the datagrams received by the last Receive into the ring of another batch with the same PacketSize.
+     * @details Used to merge several receive queues into one ring. The datagrams dropped by the kernel are still counted by
+     * this batch.
+     * @param[in] target the batch which owns the ring (may be this batch).
+     */
+    void PushInto(UDPReceiverBatch &target);
+
+    /**
+     * @brief Copies the packets from the ring into \a destination (NumberOfPackets * PacketSize bytes).
+     * @param[out] destination where to copy the packets.
+     * @param[in] lastPackets if true the last NumberOfPackets packets (oldest first) are copied, otherwise only the packets
+     * pushed since the previous Publish.
+     * @return the number of packets pushed since the previous Publish (clipped to NumberOfPackets).
+     */
+    uint32 Publish(char8 * const destination,
+                   const bool lastPackets);
+
+    /**
+     * @brief Gets the number of packets dropped since Initialise.
+     * @return the number of packets overwritten in the ring before being published plus the number of datagrams dropped by the kernel.
+     */
+    uint32 GetNumberOfDropped() const;
+
+    /**
+     * @brief Gets the number of datagrams dropped by the kernel (SO_RXQ_OVFL) on the socket of this batch.
+     */
+    uint32 GetNumberOfKernelDropped() const;
+
+private:
+    /**
+     * @brief Copies \a numberToCopy packets, starting from the packet with index \a firstPacket, from the ring into \a destination.
+     */
+    void CopyFromRing(char8 * const destination,
+                      const uint64 firstPacket,
+                      const uint32 numberToCopy) const;
+
+    /**
+     * Frees the receive area and the ring.
+     */
+    void Free();
+
+    /**
+     * The handle of the socket.
+     */
+    int32 socketHandle;
+
+    /**
+     * The number of slots of the receive area and of the ring.
+     */
+    uint32 numberOfPackets;
+
+    /**
+     * The size of each slot.
+     */
+    uint32 packetSize;
+
+    /**
+     * The size of the control message buffer of each slot.
+     */
+    uint32 controlSize;
+
+    /**
+     * The receive area.
+     */
+    char8 *receiveBuffer;
+
+    /**
+     * The control messages of the receive area.
+     */
+    char8 *controlBuffer;
+
+    /**
+     * The recvmmsg headers (one per slot).
+     */
+    struct mmsghdr *headers;
+
+    /**
+     * The recvmmsg vectors (one per slot).
+     */
+    struct iovec *vectors;
+
+    /**
+     * The ring.
+     */
+    char8 *ring;
+
+    /**
+     * The number of datagrams received by the last Receive.
+     */
+    uint32 lastReceived;
+
+    /**
+     * The total number of packets pushed into the ring.
+     */
+    uint64 numberOfPushed;
+
+    /**
+     * The total number of packets published or dropped.
+     */
+    uint64 numberOfConsumed;
+
+    /**
+     * The number of packets overwritten in the ring before being published.
+     */
+    uint32 numberOfOverwritten;
+
+    /**
+     * The number of datagrams dropped by the kernel (as reported by the last SO_RXQ_OVFL control message).
+     */
+    uint32 numberOfKernelDropped;
+};
+}
+#endif
@@ -33,6 +33,7 @@
 #include "BrokerI.h"
 #include "MemoryMapAsyncTriggerOutputBroker.h"
 #include "MemoryMapSynchronisedOutputBroker.h"
+#include "MemoryOperationsHelper.h"
 #include "Shift.h"
 #include "UDPSender.h"
 
@@ -56,6 +57,18 @@ UDPSender::UDPSender() :
     cpuMask = 0xffffffffu;
     stackSize = 0u;
     executionMode = UDPSenderExecutionModeIndependent;
+    transport = UDPTransportSocket;
+    queueId = 0u;
+    sourcePort = 0u;
+    xdpActive = false;
+    batchSize = 0u;
+    segmentation = false;
+    postTriggersLeft = 0u;
+    sequenceHeader = false;
+    sequenceBuffer = NULL_PTR(char8 *);
+    onChange = false;
+    fullRefreshPeriod = 100u;
+    numberOfSuppressedDatagrams = 0u;
 }
 
 /*lint -e{1551} Justification: the destructor must guarantee that the client sending is closed.*/
@@ -68,6 +81,7 @@ UDPSender::~UDPSender() {
             delete client;
         }
     }
+    delete[] sequenceBuffer;
 }
 
 bool UDPSender::Initialise(StructuredDataI &data) {
@@ -181,6 +195,78 @@ bool UDPSender::Initialise(StructuredDataI &data) {
             }
         }
     }
+    if (ok) {
+        StreamString transportStr;
+        if (!data.Read("Transport", transportStr)) {
+            transportStr = "Socket";
+        }
+        if (transportStr == "Socket") {
+            transport = UDPTransportSocket;
+        }
+        else if (transportStr == "XDP") {
+            transport = UDPTransportXDP;
+            ok = data.Read("Interface", interfaceName);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Interface shall be specified if Transport = XDP");
+            }
+            if (ok) {
+                ok = data.Read("DestinationMAC", destinationMAC);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "DestinationMAC shall be specified if Transport = XDP");
+                }
+            }
+            if (!data.Read("QueueId", queueId)) {
+                queueId = 0u;
+            }
+            if (!data.Read("SourcePort", sourcePort)) {
+                sourcePort = port;
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Transport shall be Socket or XDP");
+            ok = false;
+        }
+    }
+    if (ok) {
+        if (!data.Read("BatchSize", batchSize)) {
+            batchSize = 0u;
+        }
+        if (batchSize > 0u) {
+            if (executionMode != UDPSenderExecutionModeIndependent) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "BatchSize > 0 is only supported with ExecutionMode = IndependentThread");
+                ok = false;
+            }
+            else if (transport != UDPTransportSocket) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "BatchSize > 0 is only supported with Transport = Socket");
+                ok = false;
+            }
+            else {
+                uint32 segmentationIn = 0u;
+                if (data.Read("Segmentation", segmentationIn)) {
+                    segmentation = (segmentationIn == 1u);
+                }
+            }
+        }
+    }
+    if (ok) {
+        uint32 sequenceHeaderIn = 0u;
+        if (data.Read("SequenceHeader", sequenceHeaderIn)) {
+            sequenceHeader = (sequenceHeaderIn == 1u);
+        }
+    }
+    if (ok) {
+        uint32 onChangeIn = 0u;
+        if (data.Read("OnChange", onChangeIn)) {
+            onChange = (onChangeIn == 1u);
+        }
+        if (!data.Read("FullRefreshPeriod", fullRefreshPeriod)) {
+            fullRefreshPeriod = 100u;
+        }
+        if ((onChange) && (batchSize > 0u)) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "OnChange = 1 is not supported with BatchSize > 0");
+            ok = false;
+        }
+    }
     //Do not allow to add signals in run-time
     if (ok) {
         ok = signalsDatabase.MoveRelative("Signals");
@@ -202,10 +288,62 @@ bool UDPSender::Initialise(StructuredDataI &data) {
 }
 
 bool UDPSender::Synchronise() {
-    const char8 *const dataBuffer = reinterpret_cast<char8*>(memory);
+    bool ok = true;
+    if (onChange) {
+        //Nothing changed since the last datagram (and no full refresh is due)
+        if (changeDetector.Update() == 0u) {
+            numberOfSuppressedDatagrams++;
+        }
+        else {
+            ok = Transmit();
+            if (!ok) {
+                changeDetector.Invalidate();
+            }
+        }
+    }
+    else {
+        ok = Transmit();
+    }
+    return ok;
+}
+
+bool UDPSender::Transmit() {
+    const char8 *dataBuffer = reinterpret_cast<char8*>(memory);
+    uint32 dataSize = totalMemorySize;
+    if (sequenceBuffer != NULL_PTR(char8 *)) {
+        sequence.Stamp(sequenceBuffer);
+        (void) MemoryOperationsHelper::Copy(&sequenceBuffer[UDP_SEQUENCE_HEADER_SIZE], memory, totalMemorySize);
+        dataBuffer = sequenceBuffer;
+        dataSize += UDP_SEQUENCE_HEADER_SIZE;
+    }
     bool ok = false;
-    if (client != NULL_PTR(BasicUDPSocket*)) {
-        ok = client->Write(dataBuffer, totalMemorySize);
+    if (xdpActive) {
+        ok = xdp.Write(dataBuffer, dataSize);
+    }
+    else if (batchSize > 0u) {
+        bool flush = batch.Push(dataBuffer);
+        //The Trigger is the first signal
+        if (*reinterpret_cast<uint8*>(memory) != 0u) {
+            postTriggersLeft = numberOfPostTriggers;
+            flush = true;
+        }
+        else if (postTriggersLeft > 0u) {
+            postTriggersLeft--;
+            flush = true;
+        }
+        else {
+            //Pre-trigger buffer, always followed by the triggering buffer
+        }
+        ok = true;
+        if (flush) {
+            ok = batch.Flush();
+        }
+    }
+    else if (client != NULL_PTR(BasicUDPSocket*)) {
+        ok = client->Write(dataBuffer, dataSize);
+    }
+    else {
+        //NOOP
     }
     return ok;
 }
@@ -221,6 +359,40 @@ bool UDPSender::SetConfiguredDatabase(StructuredDataI &data) {
         /*lint -e{613} Justification: the client cannot be a Null_PTR since it is allocated just before.*/
         ok = client->Connect(address.Buffer(), port);
     }
+    uint32 packetSize = 0u;
+    if (ok) {
+        uint32 nOfSignals = GetNumberOfSignals();
+        uint32 s;
+        for (s = 0u; (s < nOfSignals) && (ok); s++) {
+            uint32 signalSize = 0u;
+            ok = GetSignalByteSize(s, signalSize);
+            packetSize += signalSize;
+        }
+    }
+    if ((ok) && (sequenceHeader)) {
+        packetSize += UDP_SEQUENCE_HEADER_SIZE;
+        delete[] sequenceBuffer;
+        sequenceBuffer = new char8[packetSize];
+    }
+    if ((ok) && (batchSize > 0u)) {
+        /*lint -e{613} Justification: the client cannot be a Null_PTR since it is allocated just before.*/
+        ok = batch.Initialise(client->GetWriteHandle(), batchSize, packetSize, segmentation);
+    }
+    if ((ok) && (transport == UDPTransportXDP)) {
+        xdpActive = xdp.Open(interfaceName.Buffer(), queueId, packetSize);
+        if (xdpActive) {
+            xdpActive = xdp.SetDestination(address.Buffer(), destinationMAC.Buffer(), port, sourcePort);
+            if (!xdpActive) {
+                xdp.Close();
+            }
+        }
+        if (xdpActive) {
+            REPORT_ERROR(ErrorManagement::Information, "Transmitting from the AF_XDP socket on %s queue %d", interfaceName.Buffer(), queueId);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not open the AF_XDP socket on %s. Using the BasicUDPSocket.", interfaceName.Buffer());
+        }
+    }
     return ok;
 }
 
@@ -296,7 +468,33 @@ bool UDPSender::GetOutputBrokers(ReferenceContainer &outputBrokers,
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the current and next state name are indepentent of the operation.*/
 bool UDPSender::PrepareNextState(const char8 *const currentStateName,
                                  const char8 *const nextStateName) {
-    return true;
+    bool ok = true;
+    if (onChange) {
+        uint32 nOfSignals = GetNumberOfSignals();
+        if (changeDetector.GetNumberOfSignals() == 0u) {
+            void **signalAddresses = new void*[nOfSignals];
+            uint32 *signalSizes = new uint32[nOfSignals];
+            for (uint32 n = 0u; (n < nOfSignals) && (ok); n++) {
+                ok = GetSignalMemoryBuffer(n, 0u, signalAddresses[n]);
+                if (ok) {
+                    ok = GetSignalByteSize(n, signalSizes[n]);
+                }
+            }
+            if (ok) {
+                ok = changeDetector.Configure(nOfSignals, signalAddresses, signalSizes, fullRefreshPeriod);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not configure the change detection of the signals");
+            }
+            delete[] signalAddresses;
+            delete[] signalSizes;
+        }
+        else {
+            //The receivers get the whole datagram when the state changes
+            changeDetector.Invalidate();
+        }
+    }
+    return ok;
 }
 
 const ProcessorType& UDPSender::GetCPUMask() const {
@@ -323,6 +521,30 @@ StreamString UDPSender::GetAddress() const {
     return address;
 }
 
+UDPTransportType UDPSender::GetTransport() const {
+    return transport;
+}
+
+uint32 UDPSender::GetBatchSize() const {
+    return batchSize;
+}
+
+bool UDPSender::IsOnChangeEnabled() const {
+    return onChange;
+}
+
+uint32 UDPSender::GetFullRefreshPeriod() const {
+    return fullRefreshPeriod;
+}
+
+uint32 UDPSender::GetNumberOfSuppressedDatagrams() const {
+    return numberOfSuppressedDatagrams;
+}
+
+bool UDPSender::IsSequenceHeaderEnabled() const {
+    return sequenceHeader;
+}
+
 CLASS_REGISTER(UDPSender, "1.0")
 
 }
@@ -35,6 +35,10 @@
 #include "MemoryDataSourceI.h"
 #include "ProcessorType.h"
 #include "BasicUDPSocket.h"
+#include "SignalChangeDetector.h"
+#include "UDPSenderBatch.h"
+#include "UDPSequence.h"
+#include "UDPXDPTransport.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -60,6 +64,22 @@ namespace MARTe {
  *         Ignored with a warning when ExecutionMode is RealTimeThread.
  *     StackSize = 10000000 //Optional, (default MARTe2 THREADS_DEFAULT_STACKSIZE) Stack size of the independent thread spawned
  *         Ignored with a warning when ExecutionMode is RealTimeThread.
+ *     Transport = Socket //Optional (default Socket). If Transport == XDP the datagrams are built and transmitted from an AF_XDP socket (kernel bypass, see UDPXDPTransport).
+ *         If the AF_XDP socket cannot be created (e.g. not compiled with LIBXDP_DIR or missing CAP_NET_ADMIN) the BasicUDPSocket is used with a warning.
+ *     Interface = "eth0" //Compulsory if Transport == XDP. The network interface.
+ *     QueueId = 0 //Optional (only if Transport == XDP, default 0). The transmission queue of the interface.
+ *     DestinationMAC = "aa:bb:cc:dd:ee:ff" //Compulsory if Transport == XDP. The MAC address of the receiver (or of the next hop).
+ *     SourcePort = 44489 //Optional (only if Transport == XDP, default Port). The source UDP port of the datagrams.
+ *     BatchSize = 256 //Optional (default 0). If > 0 the datagrams flushed by the MemoryMapAsyncTriggerOutputBroker are queued and
+ *         transmitted in bursts of up to BatchSize datagrams with sendmmsg (see below). Only supported with ExecutionMode == IndependentThread and Transport == Socket.
+ *     Segmentation = 1 //Optional (only if BatchSize > 0, default 0). If 1 the bursts are transmitted with the UDP generic segmentation
+ *         offload (UDP_SEGMENT), i.e. with one system call for up to 64 datagrams. If the kernel does not support it, sendmmsg is used with a warning.
+ *     SequenceHeader = 1 //Optional (default 0). If 1 each datagram starts with a UDPSequenceHeader (magic, session, sequence number and
+ *         CLOCK_REALTIME timestamp) which allows the UDPReceiver (SequenceHeader = 1) to detect lost, duplicated and reordered datagrams.
+ *     OnChange = 1 //Optional (default 0). If 1 the datagram is only transmitted if at least one signal changed since the last transmitted
+ *         datagram (see SignalChangeDetector). Not supported with BatchSize > 0.
+ *     FullRefreshPeriod = 100 //Optional (only if OnChange = 1, default 100). The datagram is transmitted every FullRefreshPeriod cycles even if
+ *         no signal changed (0 to disable), so that a late joining receiver gets the values.
  *
  *     Signals = {
  *          Trigger = { //Mandatory iff ExecutionMode ==  IndependentThread. Must be in first position.
@@ -74,6 +94,12 @@ namespace MARTe {
  *          ...
  *     }
  * }
+ *
+ * With BatchSize > 0 the datagrams are queued as long as they are pre-trigger buffers (Trigger == 0 outside of the post-trigger
+ * window), given that the broker always flushes them immediately before the buffer which triggered them. The queue is transmitted
+ * when the triggering buffer (Trigger != 0) is received or when it is full, while the post-trigger buffers are transmitted as soon as
+ * they are received. As a consequence the datagrams are transmitted in the same order and with no added latency on the
+ * triggering and on the post-trigger buffers.
  */
 
 typedef enum {
@@ -128,8 +154,9 @@ public:CLASS_REGISTER_DECLARATION()
                                   void *const gamMemPtr);
 
     /**
-     * @brief Initialises the packet data and stores the time
-     * @return true
+     * @brief If OnChange = 1 configures the change detection of the signals (first call) or forces the transmission of the
+     * next datagram (following calls).
+     * @return true if the change detection could be configured.
      */
     virtual bool PrepareNextState(const char8 *const currentStateName,
                                   const char8 *const nextStateName);
@@ -183,8 +210,50 @@ public:CLASS_REGISTER_DECLARATION()
      */
     StreamString GetAddress() const;
 
+    /**
+     * @brief Gets the configured transport.
+     * @return the configured transport.
+     */
+    UDPTransportType GetTransport() const;
+
+    /**
+     * @brief Gets the maximum number of datagrams transmitted in a burst.
+     * @return the maximum number of datagrams transmitted in a burst.
+     */
+    uint32 GetBatchSize() const;
+
+    /**
+     * @brief Checks if the datagrams start with a UDPSequenceHeader.
+     * @return true if SequenceHeader = 1.
+     */
+    bool IsSequenceHeaderEnabled() const;
+
+    /**
+     * @brief Checks if the datagrams are only transmitted when a signal changes.
+     * @return true if OnChange = 1.
+     */
+    bool IsOnChangeEnabled() const;
+
+    /**
+     * @brief Gets the number of cycles between two transmissions of unchanged signals.
+     * @return the number of cycles between two transmissions of unchanged signals.
+     */
+    uint32 GetFullRefreshPeriod() const;
+
+    /**
+     * @brief Gets the number of datagrams which were not transmitted because no signal changed.
+     * @return the number of datagrams which were not transmitted because no signal changed.
+     */
+    uint32 GetNumberOfSuppressedDatagrams() const;
+
 private:
 
+    /**
+     * @brief Transmits the signals (with the sequence header if enabled).
+     * @return true if the datagram was transmitted (or queued).
+     */
+    bool Transmit();
+
     /**
      * The IP address to which the data will be transmitted to
      */
@@ -224,6 +293,96 @@ private:
      * Holds the current execution mode of the datasource.
      */
     UDPSenderExecutionMode executionMode;
+
+    /**
+     * The configured transport.
+     */
+    UDPTransportType transport;
+
+    /**
+     * The network interface of the AF_XDP transport.
+     */
+    StreamString interfaceName;
+
+    /**
+     * The queue of the AF_XDP transport.
+     */
+    uint32 queueId;
+
+    /**
+     * The MAC address of the receiver.
+     */
+    StreamString destinationMAC;
+
+    /**
+     * The source port of the AF_XDP datagrams.
+     */
+    uint16 sourcePort;
+
+    /**
+     * The AF_XDP transport.
+     */
+    UDPXDPTransport xdp;
+
+    /**
+     * True if the AF_XDP transport is open.
+     */
+    bool xdpActive;
+
+    /**
+     * The maximum number of datagrams transmitted in a burst.
+     */
+    uint32 batchSize;
+
+    /**
+     * True if the bursts are transmitted with UDP_SEGMENT.
+     */
+    bool segmentation;
+
+    /**
+     * The queue of datagrams.
+     */
+    UDPSenderBatch batch;
+
+    /**
+     * Number of post-trigger buffers still to be received since the last triggering buffer.
+     */
+    uint32 postTriggersLeft;
+
+    /**
+     * True if the datagrams start with a UDPSequenceHeader.
+     */
+    bool sequenceHeader;
+
+    /**
+     * Stamps the UDPSequenceHeader.
+     */
+    UDPSequence sequence;
+
+    /**
+     * The datagram (header and signals) being transmitted.
+     */
+    char8 *sequenceBuffer;
+
+    /**
+     * True if the datagrams are only transmitted when a signal changes.
+     */
+    bool onChange;
+
+    /**
+     * The number of cycles between two transmissions of unchanged signals.
+     */
+    uint32 fullRefreshPeriod;
+
+    /**
+     * Detects the signals which changed since the last transmission.
+     */
+    SignalChangeDetector changeDetector;
+
+    /**
+     * The number of datagrams which were not transmitted because no signal changed.
+     */
+    uint32 numberOfSuppressedDatagrams;
 };
 }
 #endif
@@ -0,0 +1,177 @@
+/**
+ * @file UDPSenderBatch.cpp
+ * @brief Source file for class UDPSenderBatch
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class UDPSenderBatch (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <string.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "UDPSenderBatch.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * The maximum number of segments of one UDP_SEGMENT send (UDP_MAX_SEGMENTS in the kernel).
+ */
+static const uint32 UDP_SENDER_BATCH_MAX_SEGMENTS = 64u;
+
+/**
+ * The maximum payload of one (IPv4) UDP send.
+ */
+static const uint32 UDP_SENDER_BATCH_MAX_PAYLOAD = 65507u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+UDPSenderBatch::UDPSenderBatch() {
+    socketHandle = -1;
+    batchSize = 0u;
+    packetSize = 0u;
+    segmentsPerSend = 1u;
+    segmentation = false;
+    sendBuffer = NULL_PTR(char8 *);
+    headers = NULL_PTR(struct mmsghdr *);
+    vectors = NULL_PTR(struct iovec *);
+    numberOfQueued = 0u;
+}
+
+UDPSenderBatch::~UDPSenderBatch() {
+    Free();
+}
+
+void UDPSenderBatch::Free() {
+    delete[] sendBuffer;
+    sendBuffer = NULL_PTR(char8 *);
+    delete[] headers;
+    headers = NULL_PTR(struct mmsghdr *);
+    delete[] vectors;
+    vectors = NULL_PTR(struct iovec *);
+}
+
+bool UDPSenderBatch::Initialise(const int32 socketHandleIn,
+                                const uint32 batchSizeIn,
+                                const uint32 packetSizeIn,
+                                const bool segmentationIn) {
+    bool ok = (batchSizeIn > 0u) && (packetSizeIn > 0u);
+    if (ok) {
+        Free();
+        socketHandle = socketHandleIn;
+        batchSize = batchSizeIn;
+        packetSize = packetSizeIn;
+        sendBuffer = new char8[batchSize * packetSize];
+        headers = new struct mmsghdr[batchSize];
+        vectors = new struct iovec[batchSize];
+        (void) memset(headers, 0, sizeof(struct mmsghdr) * batchSize);
+        uint32 n;
+        for (n = 0u; n < batchSize; n++) {
+            vectors[n].iov_base = &sendBuffer[n * packetSize];
+            vectors[n].iov_len = packetSize;
+            headers[n].msg_hdr.msg_iov = &vectors[n];
+            headers[n].msg_hdr.msg_iovlen = 1u;
+        }
+        numberOfQueued = 0u;
+        segmentation = false;
+        segmentsPerSend = 1u;
+        if (segmentationIn) {
+            segmentsPerSend = UDP_SENDER_BATCH_MAX_PAYLOAD / packetSize;
+            if (segmentsPerSend > UDP_SENDER_BATCH_MAX_SEGMENTS) {
+                segmentsPerSend = UDP_SENDER_BATCH_MAX_SEGMENTS;
+            }
+#ifdef UDP_SEGMENT
+            int32 segmentSize = static_cast<int32>(packetSize);
+            segmentation = (segmentsPerSend > 1u);
+            if (segmentation) {
+                segmentation = (setsockopt(socketHandle, IPPROTO_UDP, UDP_SEGMENT, &segmentSize, static_cast<socklen_t>(sizeof(segmentSize))) == 0);
+            }
+#endif
+            if (!segmentation) {
+                segmentsPerSend = 1u;
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not enable UDP_SEGMENT. The datagrams will be transmitted with sendmmsg.");
+            }
+        }
+    }
+    return ok;
+}
+
+bool UDPSenderBatch::Push(const char8 * const packet) {
+    if (numberOfQueued < batchSize) {
+        (void) memcpy(&sendBuffer[numberOfQueued * packetSize], packet, static_cast<size_t>(packetSize));
+        numberOfQueued++;
+    }
+    return (numberOfQueued == batchSize);
+}
+
+bool UDPSenderBatch::Flush() {
+    bool ok = true;
+    uint32 numberOfSent = 0u;
+    while ((ok) && (numberOfSent < numberOfQueued)) {
+        uint32 numberToSend = numberOfQueued - numberOfSent;
+        int32 sent;
+        if (segmentation) {
+            if (numberToSend > segmentsPerSend) {
+                numberToSend = segmentsPerSend;
+            }
+            sent = static_cast<int32>(send(socketHandle, &sendBuffer[numberOfSent * packetSize], static_cast<size_t>(numberToSend * packetSize), 0));
+            if (sent > 0) {
+                sent = static_cast<int32>(numberToSend);
+            }
+        }
+        else {
+            sent = sendmmsg(socketHandle, &headers[numberOfSent], numberToSend, 0);
+        }
+        if (sent > 0) {
+            numberOfSent += static_cast<uint32>(sent);
+        }
+        else if (errno != EINTR) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to transmit %d datagrams (errno %d)", (numberOfQueued - numberOfSent), errno);
+            ok = false;
+        }
+        else {
+            //NOOP
+        }
+    }
+    numberOfQueued = 0u;
+    return ok;
+}
+
+uint32 UDPSenderBatch::GetNumberOfQueued() const {
+    return numberOfQueued;
+}
+
+bool UDPSenderBatch::IsSegmentationEnabled() const {
+    return segmentation;
+}
+
+}
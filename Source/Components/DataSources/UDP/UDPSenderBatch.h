@@ -0,0 +1,152 @@
+/**
+ * @file UDPSenderBatch.h
+ * @brief Header file for class UDPSenderBatch
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class UDPSenderBatch
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef UDP_SENDER_BATCH_H_
+#define UDP_SENDER_BATCH_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Queues UDP datagrams of the same size and transmits them with a few system calls (see UDPSender BatchSize).
+ * @details The datagrams are copied into a preallocated area of BatchSize slots of PacketSize bytes. Flush transmits all the
+ * queued datagrams with sendmmsg or, if the generic segmentation offload is enabled (UDP_SEGMENT), with one send of up to
+ * UDP_SENDER_BATCH_MAX_SEGMENTS contiguous datagrams which the kernel (or the NIC) splits into datagrams of PacketSize bytes.
+ *
+ * All the methods shall be called by the same thread.
+ */
+class UDPSenderBatch {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    UDPSenderBatch();
+
+    /**
+     * @brief Destructor. Frees the transmission area.
+     */
+    ~UDPSenderBatch();
+
+    /**
+     * @brief Allocates the transmission area and, if requested, enables the segmentation offload on the socket.
+     * @param[in] socketHandleIn the handle of the (connected) UDP socket.
+     * @param[in] batchSizeIn the maximum number of queued datagrams.
+     * @param[in] packetSizeIn the size of each datagram.
+     * @param[in] segmentationIn if true UDP_SEGMENT is enabled. If the kernel does not support it, sendmmsg is used with a warning.
+     * @return true if batchSizeIn and packetSizeIn are > 0.
+     */
+    bool Initialise(const int32 socketHandleIn,
+                    const uint32 batchSizeIn,
+                    const uint32 packetSizeIn,
+                    const bool segmentationIn);
+
+    /**
+     * @brief Copies one datagram into the transmission area.
+     * @param[in] packet the datagram (PacketSize bytes).
+     * @return true if the transmission area is full and shall be flushed.
+     */
+    bool Push(const char8 * const packet);
+
+    /**
+     * @brief Transmits all the queued datagrams.
+     * @return true if all the datagrams were accepted by the kernel.
+     */
+    bool Flush();
+
+    /**
+     * @brief Gets the number of queued datagrams.
+     * @return the number of queued datagrams.
+     */
+    uint32 GetNumberOfQueued() const;
+
+    /**
+     * @brief Checks if the datagrams are transmitted with UDP_SEGMENT.
+     * @return true if the segmentation offload is enabled.
+     */
+    bool IsSegmentationEnabled() const;
+
+private:
+    /**
+     * Frees the transmission area.
+     */
+    void Free();
+
+    /**
+     * The handle of the socket.
+     */
+    int32 socketHandle;
+
+    /**
+     * The number of slots of the transmission area.
+     */
+    uint32 batchSize;
+
+    /**
+     * The size of each slot.
+     */
+    uint32 packetSize;
+
+    /**
+     * The maximum number of datagrams per send when the segmentation offload is enabled.
+     */
+    uint32 segmentsPerSend;
+
+    /**
+     * True if the segmentation offload is enabled.
+     */
+    bool segmentation;
+
+    /**
+     * The transmission area.
+     */
+    char8 *sendBuffer;
+
+    /**
+     * The sendmmsg headers (one per slot).
+     */
+    struct mmsghdr *headers;
+
+    /**
+     * The sendmmsg vectors (one per slot).
+     */
+    struct iovec *vectors;
+
+    /**
+     * The number of queued datagrams.
+     */
+    uint32 numberOfQueued;
+};
+}
+#endif
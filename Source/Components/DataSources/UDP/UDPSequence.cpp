@@ -0,0 +1,137 @@
+/**
+ * @file UDPSequence.cpp
+ * @brief Source file for class UDPSequence
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class UDPSequence (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <string.h>
+#include <time.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "UDPSequence.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+UDPSequence::UDPSequence() {
+    session = static_cast<uint16>(GetTimestamp() / 1000u);
+    sequence = 0u;
+    window = 0u;
+    synchronised = false;
+    numberOfLost = 0u;
+    numberOfDuplicated = 0u;
+    numberOfReordered = 0u;
+}
+
+UDPSequence::~UDPSequence() {
+}
+
+uint64 UDPSequence::GetTimestamp() {
+    struct timespec now;
+    (void) clock_gettime(CLOCK_REALTIME, &now);
+    return (static_cast<uint64>(now.tv_sec) * 1000000000u) + static_cast<uint64>(now.tv_nsec);
+}
+
+void UDPSequence::Stamp(char8 * const destination) {
+    UDPSequenceHeader header;
+    header.magic = UDP_SEQUENCE_MAGIC;
+    header.session = session;
+    sequence++;
+    header.sequence = sequence;
+    header.timestamp = GetTimestamp();
+    (void) memcpy(destination, &header, sizeof(UDPSequenceHeader));
+}
+
+UDPSequenceStatus UDPSequence::Check(const char8 * const source,
+                                     int64 &latency) {
+    UDPSequenceHeader header;
+    (void) memcpy(&header, source, sizeof(UDPSequenceHeader));
+    UDPSequenceStatus status = UDPSequenceInvalid;
+    if (header.magic == UDP_SEQUENCE_MAGIC) {
+        /*lint -e{9125} the serial number arithmetic relies on the two's complement conversion*/
+        int32 distance = static_cast<int32>(header.sequence - sequence);
+        if ((!synchronised) || (header.session != session)) {
+            synchronised = true;
+            session = header.session;
+            window = 1u;
+            status = UDPSequenceNew;
+        }
+        else if (distance > 0) {
+            if (static_cast<uint32>(distance) < UDP_SEQUENCE_WINDOW_SIZE) {
+                window = (window << static_cast<uint32>(distance)) | 1u;
+            }
+            else {
+                window = 1u;
+            }
+            numberOfLost += (static_cast<uint32>(distance) - 1u);
+            status = UDPSequenceNew;
+        }
+        else if (static_cast<uint32>(-distance) < UDP_SEQUENCE_WINDOW_SIZE) {
+            uint64 bit = (static_cast<uint64>(1u) << static_cast<uint32>(-distance));
+            if ((window & bit) != 0u) {
+                numberOfDuplicated++;
+                status = UDPSequenceDuplicate;
+            }
+            else {
+                window |= bit;
+                numberOfReordered++;
+                if (numberOfLost > 0u) {
+                    numberOfLost--;
+                }
+                status = UDPSequenceReordered;
+            }
+        }
+        else {
+            //Cannot be told apart from a duplicate, so that the lost count is not corrected
+            numberOfReordered++;
+            status = UDPSequenceLate;
+        }
+        if (status == UDPSequenceNew) {
+            sequence = header.sequence;
+            latency = static_cast<int64>(GetTimestamp() - header.timestamp);
+        }
+    }
+    return status;
+}
+
+uint32 UDPSequence::GetNumberOfLost() const {
+    return numberOfLost;
+}
+
+uint32 UDPSequence::GetNumberOfDuplicated() const {
+    return numberOfDuplicated;
+}
+
+uint32 UDPSequence::GetNumberOfReordered() const {
+    return numberOfReordered;
+}
+
+}
@@ -0,0 +1,189 @@
+/**
+ * @file UDPSequence.h
+ * @brief Header file for class UDPSequence
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class UDPSequence
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef UDP_SEQUENCE_H_
+#define UDP_SEQUENCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The header prepended by the UDPSender to each datagram when SequenceHeader = 1 (host byte order).
+ */
+struct UDPSequenceHeader {
+    /**
+     * UDP_SEQUENCE_MAGIC.
+     */
+    uint16 magic;
+
+    /**
+     * Identifies the sender instance, so that the receiver can detect that the sender was restarted.
+     */
+    uint16 session;
+
+    /**
+     * Incremented by one for each datagram (wraps around).
+     */
+    uint32 sequence;
+
+    /**
+     * The CLOCK_REALTIME time (in nanoseconds) at which the datagram was transmitted.
+     */
+    uint64 timestamp;
+};
+
+/**
+ * The value of UDPSequenceHeader::magic.
+ */
+static const uint16 UDP_SEQUENCE_MAGIC = 0x4D32u;
+
+/**
+ * The size of UDPSequenceHeader.
+ */
+static const uint32 UDP_SEQUENCE_HEADER_SIZE = 16u;
+
+/**
+ * The number of sequence numbers (ending at the highest received) whose reception is remembered.
+ */
+static const uint32 UDP_SEQUENCE_WINDOW_SIZE = 64u;
+
+/**
+ * The classification of a received datagram (see UDPSequence::Check).
+ */
+typedef enum {
+    UDPSequenceNew,
+    UDPSequenceDuplicate,
+    UDPSequenceReordered,
+    UDPSequenceLate,
+    UDPSequenceInvalid
+} UDPSequenceStatus;
+
+/**
+ * @brief Stamps (UDPSender) and checks (UDPReceiver) the UDPSequenceHeader of the datagrams.
+ * @details The receiver remembers which of the last UDP_SEQUENCE_WINDOW_SIZE sequence numbers were received in a bitmap,
+ * so that the cost of Check is constant. A jump forward of the sequence number counts the skipped datagrams as lost. If one of
+ * them arrives later, but inside the window, it is counted as reordered and the lost count is corrected. Older datagrams are
+ * counted as late (and as reordered) but, given that they cannot be told apart from duplicates, the lost count is not corrected. A change of the session resets the window without counting losses.
+ */
+class UDPSequence {
+public:
+    /**
+     * @brief Constructor. Sets the session from the current time.
+     */
+    UDPSequence();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~UDPSequence();
+
+    /**
+     * @brief Gets the current CLOCK_REALTIME time.
+     * @return the current time in nanoseconds.
+     */
+    static uint64 GetTimestamp();
+
+    /**
+     * @brief Writes the header of the next datagram.
+     * @param[out] destination where to write the header (UDP_SEQUENCE_HEADER_SIZE bytes, no alignment required).
+     */
+    void Stamp(char8 * const destination);
+
+    /**
+     * @brief Checks the header of a received datagram against the window.
+     * @param[in] source the header (no alignment required).
+     * @param[out] latency the one-way latency in nanoseconds (only valid if UDPSequenceNew is returned).
+     * @return UDPSequenceNew if the datagram is the most recent one, UDPSequenceDuplicate if it was already received,
+     * UDPSequenceReordered if it is older than the most recent one but inside the window, UDPSequenceLate if it is older than the window
+     * and UDPSequenceInvalid if the magic does not match.
+     */
+    UDPSequenceStatus Check(const char8 * const source,
+                            int64 &latency);
+
+    /**
+     * @brief Gets the number of lost datagrams.
+     * @return the number of lost datagrams.
+     */
+    uint32 GetNumberOfLost() const;
+
+    /**
+     * @brief Gets the number of duplicated datagrams.
+     * @return the number of duplicated datagrams.
+     */
+    uint32 GetNumberOfDuplicated() const;
+
+    /**
+     * @brief Gets the number of datagrams received out of order (reordered and late).
+     * @return the number of datagrams received out of order.
+     */
+    uint32 GetNumberOfReordered() const;
+
+private:
+    /**
+     * The session of the sender (or of the last received datagram).
+     */
+    uint16 session;
+
+    /**
+     * The sequence number of the last stamped (or of the most recent received) datagram.
+     */
+    uint32 sequence;
+
+    /**
+     * Bit n is set if the datagram sequence - n was received.
+     */
+    uint64 window;
+
+    /**
+     * True after the first valid datagram was received.
+     */
+    bool synchronised;
+
+    /**
+     * The number of lost datagrams.
+     */
+    uint32 numberOfLost;
+
+    /**
+     * The number of duplicated datagrams.
+     */
+    uint32 numberOfDuplicated;
+
+    /**
+     * The number of datagrams received out of order.
+     */
+    uint32 numberOfReordered;
+};
+}
+#endif
@@ -0,0 +1,444 @@
+/**
+ * @file UDPXDPTransport.cpp
+ * @brief Source file for class UDPXDPTransport
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class UDPXDPTransport (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#ifdef UDP_XDP
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <xdp/xsk.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "UDPXDPTransport.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+#ifdef UDP_XDP
+namespace MARTe {
+
+/**
+ * The size of each UMEM frame.
+ */
+static const uint32 UDP_XDP_FRAME_SIZE = XSK_UMEM__DEFAULT_FRAME_SIZE;
+
+/**
+ * The number of frames (and descriptors) of each ring (the UMEM holds twice as many frames: for reception and for transmission).
+ */
+static const uint32 UDP_XDP_RING_SIZE = 512u;
+
+/**
+ * The size of the Ethernet (14), IPv4 (20) and UDP (8) headers.
+ */
+static const uint32 UDP_XDP_HEADERS_SIZE = 42u;
+
+struct UDPXDPRings {
+    struct xsk_umem *umem;
+    struct xsk_socket *xsk;
+    struct xsk_ring_prod fill;
+    struct xsk_ring_cons completion;
+    struct xsk_ring_cons rx;
+    struct xsk_ring_prod tx;
+    void *umemArea;
+    uint64 freeFrames[UDP_XDP_RING_SIZE];
+    uint32 numberOfFreeFrames;
+};
+
+static uint16 UDPXDPChecksum(const uint8 * const header,
+                             const uint32 size) {
+    uint32 sum = 0u;
+    uint32 i;
+    for (i = 0u; (i + 1u) < size; i += 2u) {
+        sum += (static_cast<uint32>(header[i]) << 8u) | static_cast<uint32>(header[i + 1u]);
+    }
+    while ((sum >> 16u) != 0u) {
+        sum = (sum & 0xFFFFu) + (sum >> 16u);
+    }
+    return htons(static_cast<uint16>(~sum));
+}
+
+static bool UDPXDPParseMAC(const char8 * const mac,
+                           uint8 * const address) {
+    uint32 bytes[6];
+    bool ok = (sscanf(mac, "%x:%x:%x:%x:%x:%x", &bytes[0], &bytes[1], &bytes[2], &bytes[3], &bytes[4], &bytes[5]) == 6);
+    uint32 i;
+    for (i = 0u; (i < 6u) && (ok); i++) {
+        ok = (bytes[i] <= 0xFFu);
+        address[i] = static_cast<uint8>(bytes[i]);
+    }
+    return ok;
+}
+
+/**
+ * @brief Gives the consumed reception frames back to the fill ring and wakes up the driver if requested.
+ */
+static void UDPXDPRefill(UDPXDPRings * const rings,
+                         const uint64 * const frames,
+                         const uint32 numberOfFrames) {
+    uint32 idx = 0u;
+    if (xsk_ring_prod__reserve(&rings->fill, numberOfFrames, &idx) == numberOfFrames) {
+        uint32 i;
+        for (i = 0u; i < numberOfFrames; i++) {
+            *xsk_ring_prod__fill_addr(&rings->fill, idx + i) = frames[i];
+        }
+        xsk_ring_prod__submit(&rings->fill, numberOfFrames);
+    }
+    if (xsk_ring_prod__needs_wakeup(&rings->fill)) {
+        (void) recvfrom(xsk_socket__fd(rings->xsk), NULL_PTR(void *), 0u, MSG_DONTWAIT, NULL_PTR(struct sockaddr *), NULL_PTR(socklen_t *));
+    }
+}
+
+}
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+UDPXDPTransport::UDPXDPTransport() {
+    rings = NULL_PTR(UDPXDPRings *);
+    uint32 i;
+    for (i = 0u; i < 6u; i++) {
+        sourceMAC[i] = 0u;
+        destinationMAC[i] = 0u;
+    }
+    sourceAddress = 0u;
+    destinationAddress = 0u;
+    sourcePort = 0u;
+    destinationPort = 0u;
+    identification = 0u;
+}
+
+UDPXDPTransport::~UDPXDPTransport() {
+    Close();
+}
+
+bool UDPXDPTransport::IsAvailable() {
+#ifdef UDP_XDP
+    return true;
+#else
+    return false;
+#endif
+}
+
+#ifdef UDP_XDP
+bool UDPXDPTransport::Open(const char8 * const interfaceNameIn,
+                           const uint32 queueId,
+                           const uint32 maxPayloadSize) {
+    Close();
+    interfaceName = interfaceNameIn;
+    bool ok = ((maxPayloadSize + UDP_XDP_HEADERS_SIZE) <= UDP_XDP_FRAME_SIZE);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The payload (%d bytes) does not fit in a XDP frame", maxPayloadSize);
+    }
+    if (ok) {
+        rings = new UDPXDPRings;
+        (void) memset(rings, 0, sizeof(UDPXDPRings));
+        uint64 umemSize = static_cast<uint64>(2u * UDP_XDP_RING_SIZE) * UDP_XDP_FRAME_SIZE;
+        ok = (posix_memalign(&rings->umemArea, static_cast<size_t>(getpagesize()), static_cast<size_t>(umemSize)) == 0);
+        if (ok) {
+            struct xsk_umem_config umemConfig;
+            umemConfig.fill_size = UDP_XDP_RING_SIZE;
+            umemConfig.comp_size = UDP_XDP_RING_SIZE;
+            umemConfig.frame_size = UDP_XDP_FRAME_SIZE;
+            umemConfig.frame_headroom = 0u;
+            umemConfig.flags = 0u;
+            ok = (xsk_umem__create(&rings->umem, rings->umemArea, umemSize, &rings->fill, &rings->completion, &umemConfig) == 0);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::OSError, "Could not create the UMEM");
+            }
+        }
+        if (ok) {
+            struct xsk_socket_config socketConfig;
+            (void) memset(&socketConfig, 0, sizeof(socketConfig));
+            socketConfig.rx_size = UDP_XDP_RING_SIZE;
+            socketConfig.tx_size = UDP_XDP_RING_SIZE;
+            socketConfig.bind_flags = XDP_USE_NEED_WAKEUP;
+            ok = (xsk_socket__create(&rings->xsk, interfaceName.Buffer(), queueId, rings->umem, &rings->rx, &rings->tx, &socketConfig) == 0);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::OSError, "Could not create the AF_XDP socket on %s queue %d", interfaceName.Buffer(), queueId);
+            }
+        }
+        if (ok) {
+            //The first half of the frames is for the reception and the second half for the transmission
+            uint64 frames[UDP_XDP_RING_SIZE];
+            uint32 i;
+            for (i = 0u; i < UDP_XDP_RING_SIZE; i++) {
+                frames[i] = static_cast<uint64>(i) * UDP_XDP_FRAME_SIZE;
+                rings->freeFrames[i] = static_cast<uint64>(UDP_XDP_RING_SIZE + i) * UDP_XDP_FRAME_SIZE;
+            }
+            rings->numberOfFreeFrames = UDP_XDP_RING_SIZE;
+            UDPXDPRefill(rings, &frames[0], UDP_XDP_RING_SIZE);
+        }
+        if (!ok) {
+            Close();
+        }
+    }
+    return ok;
+}
+
+bool UDPXDPTransport::SetDestination(const char8 * const destinationAddressIn,
+                                     const char8 * const destinationMACIn,
+                                     const uint16 destinationPortIn,
+                                     const uint16 sourcePortIn) {
+    struct in_addr address;
+    bool ok = (inet_pton(AF_INET, destinationAddressIn, &address) == 1);
+    if (ok) {
+        destinationAddress = address.s_addr;
+        ok = UDPXDPParseMAC(destinationMACIn, &destinationMAC[0]);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Invalid DestinationMAC %s", destinationMACIn);
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Invalid IPv4 address %s", destinationAddressIn);
+    }
+    destinationPort = htons(destinationPortIn);
+    sourcePort = htons(sourcePortIn);
+    if (ok) {
+        int32 query = socket(AF_INET, SOCK_DGRAM, 0);
+        ok = (query >= 0);
+        struct ifreq request;
+        (void) memset(&request, 0, sizeof(request));
+        (void) strncpy(&request.ifr_name[0], interfaceName.Buffer(), static_cast<size_t>(IFNAMSIZ - 1));
+        if (ok) {
+            ok = (ioctl(query, SIOCGIFHWADDR, &request) == 0);
+        }
+        if (ok) {
+            (void) memcpy(&sourceMAC[0], &request.ifr_hwaddr.sa_data[0], 6u);
+            request.ifr_addr.sa_family = AF_INET;
+            ok = (ioctl(query, SIOCGIFADDR, &request) == 0);
+        }
+        if (ok) {
+            /*lint -e{740} -e{826} the ifr_addr of a SIOCGIFADDR request is a sockaddr_in*/
+            sourceAddress = reinterpret_cast<struct sockaddr_in *>(&request.ifr_addr)->sin_addr.s_addr;
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Could not read the MAC and IPv4 addresses of %s", interfaceName.Buffer());
+        }
+        if (query >= 0) {
+            (void) close(query);
+        }
+    }
+    return ok;
+}
+
+bool UDPXDPTransport::Read(char8 * const buffer,
+                           uint32 &size,
+                           const uint16 port,
+                           const StreamString &groupAddress,
+                           const int32 timeoutMSec) {
+    bool ok = (rings != NULL_PTR(UDPXDPRings *));
+    uint32 groupAddressValue = 0u;
+    if ((ok) && (groupAddress.Size() > 0u)) {
+        struct in_addr address;
+        if (inet_pton(AF_INET, groupAddress.Buffer(), &address) == 1) {
+            groupAddressValue = address.s_addr;
+        }
+    }
+    uint64 deadline = 0u;
+    if (timeoutMSec >= 0) {
+        deadline = HighResolutionTimer::Counter() + ((static_cast<uint64>(timeoutMSec) * HighResolutionTimer::Frequency()) / 1000u);
+    }
+    const uint16 portValue = htons(port);
+    const uint32 capacity = size;
+    bool received = false;
+    while ((ok) && (!received)) {
+        uint32 idx = 0u;
+        uint32 n = xsk_ring_cons__peek(&rings->rx, UDP_XDP_RING_SIZE, &idx);
+        uint64 frames[UDP_XDP_RING_SIZE];
+        uint32 i;
+        for (i = 0u; i < n; i++) {
+            const struct xdp_desc *desc = xsk_ring_cons__rx_desc(&rings->rx, idx + i);
+            const uint8 *frame = reinterpret_cast<const uint8 *>(xsk_umem__get_data(rings->umemArea, desc->addr));
+            frames[i] = xsk_umem__extract_addr(desc->addr);
+            //Keep the most recent datagram (the older ones in the same poll are superseded)
+            bool isUDP = (desc->len >= UDP_XDP_HEADERS_SIZE) && (frame[12] == 0x08u) && (frame[13] == 0x00u) && (frame[14] == 0x45u) && (frame[23] == 17u);
+            if (isUDP) {
+                uint16 framePort;
+                uint32 frameAddress;
+                (void) memcpy(&framePort, &frame[36], sizeof(uint16));
+                (void) memcpy(&frameAddress, &frame[30], sizeof(uint32));
+                isUDP = (framePort == portValue) && ((groupAddressValue == 0u) || (frameAddress == groupAddressValue));
+            }
+            if (isUDP) {
+                size = desc->len - UDP_XDP_HEADERS_SIZE;
+                if (size > capacity) {
+                    size = capacity;
+                }
+                (void) memcpy(buffer, &frame[UDP_XDP_HEADERS_SIZE], static_cast<size_t>(size));
+                received = true;
+            }
+        }
+        if (n > 0u) {
+            xsk_ring_cons__release(&rings->rx, n);
+            UDPXDPRefill(rings, &frames[0], n);
+        }
+        else if (xsk_ring_prod__needs_wakeup(&rings->fill)) {
+            UDPXDPRefill(rings, &frames[0], 0u);
+        }
+        else {
+            //NOOP
+        }
+        if ((!received) && (timeoutMSec >= 0)) {
+            ok = (HighResolutionTimer::Counter() < deadline);
+        }
+    }
+    return ok;
+}
+
+bool UDPXDPTransport::Write(const char8 * const buffer,
+                            const uint32 size) {
+    bool ok = (rings != NULL_PTR(UDPXDPRings *));
+    if (ok) {
+        ok = ((size + UDP_XDP_HEADERS_SIZE) <= UDP_XDP_FRAME_SIZE);
+    }
+    if (ok) {
+        //Reclaim the frames already transmitted
+        uint32 idx = 0u;
+        uint32 n = xsk_ring_cons__peek(&rings->completion, UDP_XDP_RING_SIZE, &idx);
+        uint32 i;
+        for (i = 0u; i < n; i++) {
+            rings->freeFrames[rings->numberOfFreeFrames] = *xsk_ring_cons__comp_addr(&rings->completion, idx + i);
+            rings->numberOfFreeFrames++;
+        }
+        if (n > 0u) {
+            xsk_ring_cons__release(&rings->completion, n);
+        }
+        ok = (rings->numberOfFreeFrames > 0u);
+    }
+    uint32 txIdx = 0u;
+    if (ok) {
+        ok = (xsk_ring_prod__reserve(&rings->tx, 1u, &txIdx) == 1u);
+    }
+    if (ok) {
+        rings->numberOfFreeFrames--;
+        uint64 addr = rings->freeFrames[rings->numberOfFreeFrames];
+        uint8 *frame = reinterpret_cast<uint8 *>(xsk_umem__get_data(rings->umemArea, addr));
+        //Ethernet
+        (void) memcpy(&frame[0], &destinationMAC[0], 6u);
+        (void) memcpy(&frame[6], &sourceMAC[0], 6u);
+        frame[12] = 0x08u;
+        frame[13] = 0x00u;
+        //IPv4 (no options, do not fragment)
+        uint16 value = htons(static_cast<uint16>(20u + 8u + size));
+        frame[14] = 0x45u;
+        frame[15] = 0u;
+        (void) memcpy(&frame[16], &value, sizeof(uint16));
+        value = htons(identification);
+        identification++;
+        (void) memcpy(&frame[18], &value, sizeof(uint16));
+        frame[20] = 0x40u;
+        frame[21] = 0u;
+        frame[22] = 64u;
+        frame[23] = 17u;
+        frame[24] = 0u;
+        frame[25] = 0u;
+        (void) memcpy(&frame[26], &sourceAddress, sizeof(uint32));
+        (void) memcpy(&frame[30], &destinationAddress, sizeof(uint32));
+        value = UDPXDPChecksum(&frame[14], 20u);
+        (void) memcpy(&frame[24], &value, sizeof(uint16));
+        //UDP (the checksum is optional in IPv4)
+        (void) memcpy(&frame[34], &sourcePort, sizeof(uint16));
+        (void) memcpy(&frame[36], &destinationPort, sizeof(uint16));
+        value = htons(static_cast<uint16>(8u + size));
+        (void) memcpy(&frame[38], &value, sizeof(uint16));
+        frame[40] = 0u;
+        frame[41] = 0u;
+        (void) memcpy(&frame[UDP_XDP_HEADERS_SIZE], buffer, static_cast<size_t>(size));
+        struct xdp_desc *desc = xsk_ring_prod__tx_desc(&rings->tx, txIdx);
+        desc->addr = addr;
+        desc->len = UDP_XDP_HEADERS_SIZE + size;
+        xsk_ring_prod__submit(&rings->tx, 1u);
+        if (xsk_ring_prod__needs_wakeup(&rings->tx)) {
+            (void) sendto(xsk_socket__fd(rings->xsk), NULL_PTR(const void *), 0u, MSG_DONTWAIT, NULL_PTR(const struct sockaddr *), 0u);
+        }
+    }
+    return ok;
+}
+
+void UDPXDPTransport::Close() {
+    if (rings != NULL_PTR(UDPXDPRings *)) {
+        if (rings->xsk != NULL_PTR(struct xsk_socket *)) {
+            xsk_socket__delete(rings->xsk);
+        }
+        if (rings->umem != NULL_PTR(struct xsk_umem *)) {
+            (void) xsk_umem__delete(rings->umem);
+        }
+        if (rings->umemArea != NULL_PTR(void *)) {
+            free(rings->umemArea);
+        }
+        delete rings;
+        rings = NULL_PTR(UDPXDPRings *);
+    }
+}
+#else
+/*lint -e{715} the AF_XDP transport is not compiled.*/
+bool UDPXDPTransport::Open(const char8 * const interfaceNameIn,
+                           const uint32 queueId,
+                           const uint32 maxPayloadSize) {
+    REPORT_ERROR_STATIC(ErrorManagement::UnsupportedFeature, "The AF_XDP transport is not available (compile with LIBXDP_DIR set)");
+    return false;
+}
+
+/*lint -e{715} the AF_XDP transport is not compiled.*/
+bool UDPXDPTransport::SetDestination(const char8 * const destinationAddressIn,
+                                     const char8 * const destinationMACIn,
+                                     const uint16 destinationPortIn,
+                                     const uint16 sourcePortIn) {
+    return false;
+}
+
+/*lint -e{715} the AF_XDP transport is not compiled.*/
+bool UDPXDPTransport::Read(char8 * const buffer,
+                           uint32 &size,
+                           const uint16 port,
+                           const StreamString &groupAddress,
+                           const int32 timeoutMSec) {
+    return false;
+}
+
+/*lint -e{715} the AF_XDP transport is not compiled.*/
+bool UDPXDPTransport::Write(const char8 * const buffer,
+                            const uint32 size) {
+    return false;
+}
+
+void UDPXDPTransport::Close() {
+}
+#endif
+
+}
@@ -0,0 +1,189 @@
+/**
+ * @file UDPXDPTransport.h
+ * @brief Header file for class UDPXDPTransport
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class UDPXDPTransport
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef UDP_XDP_TRANSPORT_H_
+#define UDP_XDP_TRANSPORT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The transport of the UDPReceiver and of the UDPSender (see Transport).
+ */
+typedef enum {
+    UDPTransportSocket,
+    UDPTransportXDP
+} UDPTransportType;
+
+/**
+ * The rings and the UMEM of the AF_XDP socket (only defined if the component is compiled with LIBXDP_DIR set).
+ */
+struct UDPXDPRings;
+
+/**
+ * @brief Kernel-bypass UDP/IPv4 transport over an AF_XDP socket (see the Transport parameter of the UDPReceiver and of the UDPSender).
+ * @details The socket is bound to one queue of a network interface and owns a UMEM of page aligned frames: half of the frames
+ * are given to the fill ring (reception) and half are used to build the transmitted frames. The Ethernet, IPv4 and UDP headers
+ * are parsed and built by this class (no fragmentation, IPv4 options nor VLAN tags), so that the payload is copied directly between the UMEM
+ * and the DataSource memory. The rings are busy-polled (the kernel is only woken up when the driver requests it), so that
+ * the caller thread should be pinned to a dedicated core.
+ *
+ * The XDP program redirects all the packets of the queue to the socket: the packets which are not UDP/IPv4 to the
+ * configured port are discarded, so that the traffic of the port should be steered to a dedicated queue (e.g. with ethtool ntuple).
+ *
+ * The transport is only available if the component was compiled with LIBXDP_DIR set (which defines UDP_XDP), otherwise Open fails.
+ *
+ * The transport is not thread safe: all the methods shall be called by the same thread.
+ */
+class UDPXDPTransport {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    UDPXDPTransport();
+
+    /**
+     * @brief Destructor. Calls Close.
+     */
+    ~UDPXDPTransport();
+
+    /**
+     * @brief Creates the UMEM and the AF_XDP socket on the queue \a queueId of the interface \a interfaceNameIn.
+     * @param[in] interfaceNameIn the name of the network interface.
+     * @param[in] queueId the queue of the interface.
+     * @param[in] maxPayloadSize the maximum size of the UDP payload.
+     * @return true if the socket could be created and bound (requires CAP_NET_ADMIN and CAP_NET_RAW) and if the frames can hold \a maxPayloadSize.
+     */
+    bool Open(const char8 * const interfaceNameIn,
+              const uint32 queueId,
+              const uint32 maxPayloadSize);
+
+    /**
+     * @brief Sets the destination of the transmitted datagrams.
+     * @param[in] destinationAddressIn the destination IPv4 address.
+     * @param[in] destinationMACIn the destination (next hop) MAC address (e.g. "aa:bb:cc:dd:ee:ff").
+     * @param[in] destinationPortIn the destination UDP port.
+     * @param[in] sourcePortIn the source UDP port.
+     * @return true if the addresses are valid and the source MAC and IPv4 addresses of the interface could be read.
+     */
+    bool SetDestination(const char8 * const destinationAddressIn,
+                        const char8 * const destinationMACIn,
+                        const uint16 destinationPortIn,
+                        const uint16 sourcePortIn);
+
+    /**
+     * @brief Busy-polls the reception ring until a UDP datagram to \a port (and, if \a groupAddress is not empty, to this address) is received.
+     * @param[out] buffer where to copy the payload.
+     * @param[in,out] size the size of \a buffer, updated with the number of bytes copied.
+     * @param[in] port the destination UDP port of the datagrams.
+     * @param[in] groupAddress the destination IPv4 address of the datagrams (empty for any).
+     * @param[in] timeoutMSec the maximum time to poll (-1 polls forever).
+     * @return true if a datagram was received before the timeout.
+     */
+    bool Read(char8 * const buffer,
+              uint32 &size,
+              const uint16 port,
+              const StreamString &groupAddress,
+              const int32 timeoutMSec);
+
+    /**
+     * @brief Builds one frame with \a size bytes of payload and submits it to the transmission ring.
+     * @param[in] buffer the payload.
+     * @param[in] size the size of the payload.
+     * @return true if a transmission frame was available.
+     */
+    bool Write(const char8 * const buffer,
+               const uint32 size);
+
+    /**
+     * @brief Destroys the socket and the UMEM.
+     */
+    void Close();
+
+    /**
+     * @brief Returns true if the component was compiled with the AF_XDP transport (LIBXDP_DIR set).
+     * @return true if the AF_XDP transport is available.
+     */
+    static bool IsAvailable();
+
+private:
+
+    /**
+     * The rings and the UMEM.
+     */
+    UDPXDPRings *rings;
+
+    /**
+     * The MAC address of the interface.
+     */
+    uint8 sourceMAC[6];
+
+    /**
+     * The destination MAC address.
+     */
+    uint8 destinationMAC[6];
+
+    /**
+     * The IPv4 address of the interface (network byte order).
+     */
+    uint32 sourceAddress;
+
+    /**
+     * The destination IPv4 address (network byte order).
+     */
+    uint32 destinationAddress;
+
+    /**
+     * The source UDP port (network byte order).
+     */
+    uint16 sourcePort;
+
+    /**
+     * The destination UDP port (network byte order).
+     */
+    uint16 destinationPort;
+
+    /**
+     * The identification of the next IPv4 datagram.
+     */
+    uint16 identification;
+
+    /**
+     * The name of the interface.
+     */
+    StreamString interfaceName;
+};
+}
+#endif
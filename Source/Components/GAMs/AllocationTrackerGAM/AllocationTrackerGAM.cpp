@@ -0,0 +1,348 @@
+/**
+ * @file AllocationTrackerGAM.cpp
+ * @brief Source file for class AllocationTrackerGAM
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class AllocationTrackerGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#ifdef ALLOCATION_TRACKER
+#include <dlfcn.h>
+#include <errno.h>
+#include <execinfo.h>
+#include <malloc.h>
+#include <stddef.h>
+#include <stdlib.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "AllocationTrackerGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+#ifdef ALLOCATION_TRACKER
+namespace {
+/**
+ * Maximum number of frames of the call stack of the first allocation of a cycle.
+ */
+const MARTe::uint32 allocationTrackerMaxFrames = 16u;
+
+/**
+ * Number of frames of the call stack which belong to the tracker (TrackAllocation and the allocator wrapper).
+ */
+const MARTe::uint32 allocationTrackerSkipFrames = 2u;
+
+/**
+ * @brief The tracking state of each thread.
+ */
+struct AllocationTrackerState {
+    /**
+     * True if the allocations of the thread are counted.
+     */
+    bool active;
+    /**
+     * True while an allocation is being recorded (backtrace may allocate the first time it is called).
+     */
+    bool recording;
+    /**
+     * The number of allocations counted.
+     */
+    MARTe::uint32 allocations;
+    /**
+     * The number of frames of the call stack of the first allocation.
+     */
+    MARTe::int32 numberOfFrames;
+    /**
+     * The call stack of the first allocation.
+     */
+    void *frames[allocationTrackerMaxFrames];
+};
+
+/**
+ * The state of each thread. The initial-exec model does not allocate memory on the first access (the library is preloaded).
+ */
+__thread AllocationTrackerState allocationTrackerState __attribute__((tls_model("initial-exec")));
+
+/**
+ * @brief Counts an allocation if the tracking is active on the calling thread.
+ */
+void TrackAllocation() {
+    AllocationTrackerState &state = allocationTrackerState;
+    if ((state.active) && (!state.recording)) {
+        state.recording = true;
+        if (state.allocations == 0u) {
+            state.numberOfFrames = backtrace(&state.frames[0], static_cast<MARTe::int32>(allocationTrackerMaxFrames));
+        }
+        state.allocations++;
+        state.recording = false;
+    }
+}
+}
+
+/*lint -save -e9141 -e586 -e1960 the allocator of the C library is replaced when the library is preloaded.
+ * The entry points of the allocator of the GNU C library (__libc_*) are called by the wrappers.*/
+extern "C" {
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t numberOfElements,
+                           size_t size);
+extern void *__libc_realloc(void *memory,
+                            size_t size);
+extern void *__libc_memalign(size_t alignment,
+                             size_t size);
+
+void *malloc(size_t size) __THROW {
+    TrackAllocation();
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t numberOfElements,
+             size_t size) __THROW {
+    TrackAllocation();
+    return __libc_calloc(numberOfElements, size);
+}
+
+void *realloc(void *memory,
+              size_t size) __THROW {
+    TrackAllocation();
+    return __libc_realloc(memory, size);
+}
+
+void *memalign(size_t alignment,
+               size_t size) __THROW {
+    TrackAllocation();
+    return __libc_memalign(alignment, size);
+}
+
+void *aligned_alloc(size_t alignment,
+                    size_t size) __THROW {
+    TrackAllocation();
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void **memory,
+                   size_t alignment,
+                   size_t size) __THROW {
+    int ret = EINVAL;
+    //The alignment shall be a power of two multiple of sizeof(void *)
+    if (((alignment % sizeof(void *)) == 0u) && ((alignment & (alignment - 1u)) == 0u) && (alignment != 0u)) {
+        TrackAllocation();
+        void *aligned = __libc_memalign(alignment, size);
+        ret = ENOMEM;
+        if (aligned != NULL) {
+            *memory = aligned;
+            ret = 0;
+        }
+    }
+    return ret;
+}
+}
+/*lint -restore*/
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+AllocationTrackerGAM::AllocationTrackerGAM() :
+        GAM() {
+    maxReports = 10u;
+    tracking = false;
+    numberOfAllocations = 0u;
+    cyclesWithAllocations = 0u;
+    allocationsOutput = NULL_PTR(uint32 *);
+    cyclesOutput = NULL_PTR(uint32 *);
+    skipPending = 1;
+}
+
+AllocationTrackerGAM::~AllocationTrackerGAM() {
+#ifdef ALLOCATION_TRACKER
+    //The thread which destroys the GAM may be the one which executed it
+    allocationTrackerState.active = false;
+#endif
+}
+
+bool AllocationTrackerGAM::Initialise(StructuredDataI &data) {
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        if (!data.Read("MaxReports", maxReports)) {
+            maxReports = 10u;
+        }
+    }
+#ifdef ALLOCATION_TRACKER
+    if (ok) {
+        AllocationTrackerState &state = allocationTrackerState;
+        //The first call of backtrace loads the unwinder: do it now and not in the first allocation of the real-time thread
+        void *frames[allocationTrackerMaxFrames];
+        (void) backtrace(&frames[0], static_cast<int32>(allocationTrackerMaxFrames));
+        //The wrappers only replace the allocator if the library is preloaded: allocate through the global malloc symbol and check it
+        void *(* volatile mallocFunction)(size_t) = &malloc;
+        state.allocations = 0u;
+        state.active = true;
+        void *memory = mallocFunction(1u);
+        state.active = false;
+        tracking = (state.allocations > 0u);
+        state.allocations = 0u;
+        free(memory);
+        if (!tracking) {
+            REPORT_ERROR(ErrorManagement::Warning, "The allocator is not replaced (the library shall be preloaded with LD_PRELOAD): no allocation will be flagged");
+        }
+    }
+#else
+    if (ok) {
+        REPORT_ERROR(ErrorManagement::Warning, "Compiled without ALLOCATION_TRACKER: no allocation will be flagged");
+    }
+#endif
+    return ok;
+}
+
+bool AllocationTrackerGAM::Setup() {
+    bool ok = (GetNumberOfInputSignals() == 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "No input signals shall be defined");
+    }
+    uint32 numberOfOutputSignals = GetNumberOfOutputSignals();
+    if (ok) {
+        ok = (numberOfOutputSignals <= 2u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "At most two output signals shall be defined");
+        }
+    }
+    for (uint32 i = 0u; (i < numberOfOutputSignals) && (ok); i++) {
+        ok = (GetSignalType(OutputSignals, i) == UnsignedInteger32Bit);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The type of the output signal %u shall be uint32", i);
+        }
+        uint32 nOfElements = 0u;
+        uint32 nOfSamples = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(OutputSignals, i, nOfElements);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(OutputSignals, i, nOfSamples);
+        }
+        if (ok) {
+            ok = ((nOfElements == 1u) && (nOfSamples == 1u));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The output signal %u shall have one element and one sample", i);
+            }
+        }
+    }
+    if ((ok) && (numberOfOutputSignals > 0u)) {
+        allocationsOutput = static_cast<uint32 *>(GetOutputSignalMemory(0u));
+    }
+    if ((ok) && (numberOfOutputSignals > 1u)) {
+        cyclesOutput = static_cast<uint32 *>(GetOutputSignalMemory(1u));
+    }
+    return ok;
+}
+
+bool AllocationTrackerGAM::Execute() {
+    uint32 allocations = 0u;
+#ifdef ALLOCATION_TRACKER
+    if (tracking) {
+        AllocationTrackerState &state = allocationTrackerState;
+        //Stop counting: the report itself allocates
+        state.active = false;
+        if (skipPending == 0) {
+            allocations = state.allocations;
+        }
+        if (allocations > 0u) {
+            numberOfAllocations += allocations;
+            cyclesWithAllocations++;
+            if (cyclesWithAllocations <= maxReports) {
+                uint32 numberOfFrames = (state.numberOfFrames > 0) ? static_cast<uint32>(state.numberOfFrames) : 0u;
+                Report(allocations, &state.frames[0], numberOfFrames);
+            }
+        }
+        skipPending = 0;
+        state.allocations = 0u;
+        state.numberOfFrames = 0;
+        state.active = true;
+    }
+#endif
+    if (allocationsOutput != NULL_PTR(uint32 *)) {
+        *allocationsOutput = allocations;
+    }
+    if (cyclesOutput != NULL_PTR(uint32 *)) {
+        *cyclesOutput = cyclesWithAllocations;
+    }
+    return true;
+}
+
+/*lint -e{715} the state names are not needed.*/
+bool AllocationTrackerGAM::PrepareNextState(const char8 * const currentStateName,
+                                            const char8 * const nextStateName) {
+    skipPending = 1;
+    return true;
+}
+
+/*lint -e{715} frames and numberOfFrames are only used with ALLOCATION_TRACKER.*/
+void AllocationTrackerGAM::Report(const uint32 allocations,
+                                  void * const * const frames,
+                                  const uint32 numberOfFrames) const {
+    StreamString gamName = GetName();
+    REPORT_ERROR(ErrorManagement::Warning, "%s: %u heap allocations in the last cycle of the real-time thread. The first one was made from:",
+                 gamName.Buffer(), allocations);
+#ifdef ALLOCATION_TRACKER
+    for (uint32 k = allocationTrackerSkipFrames; k < numberOfFrames; k++) {
+        Dl_info info;
+        uintp address = reinterpret_cast<uintp>(frames[k]);
+        if (dladdr(frames[k], &info) != 0) {
+            const char8 * const library = (info.dli_fname != NULL_PTR(const char8 *)) ? info.dli_fname : "?";
+            if (info.dli_sname != NULL_PTR(const char8 *)) {
+                uintp offset = address - reinterpret_cast<uintp>(info.dli_saddr);
+                REPORT_ERROR(ErrorManagement::Warning, "    %s+0x%x (%s)", info.dli_sname, offset, library);
+            }
+            else {
+                uintp offset = address - reinterpret_cast<uintp>(info.dli_fbase);
+                REPORT_ERROR(ErrorManagement::Warning, "    0x%x (%s)", offset, library);
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::Warning, "    0x%x", address);
+        }
+    }
+#endif
+}
+
+bool AllocationTrackerGAM::IsTracking() const {
+    return tracking;
+}
+
+uint64 AllocationTrackerGAM::GetNumberOfAllocations() const {
+    return numberOfAllocations;
+}
+
+uint32 AllocationTrackerGAM::GetNumberOfCyclesWithAllocations() const {
+    return cyclesWithAllocations;
+}
+
+CLASS_REGISTER(AllocationTrackerGAM, "1.0")
+
+}
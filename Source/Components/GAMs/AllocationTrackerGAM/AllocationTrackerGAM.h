@@ -0,0 +1,200 @@
+/**
+ * @file AllocationTrackerGAM.h
+ * @brief Header file for class AllocationTrackerGAM
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class AllocationTrackerGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef ALLOCATIONTRACKERGAM_H_
+#define ALLOCATIONTRACKERGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Debug GAM which flags the heap allocations made by the real-time thread where it is executed.
+ * @details The real-time paths (the Execute() of the GAMs and the Synchronise() of the DataSources, which is called by the brokers)
+ * should not allocate memory from the heap: the allocator takes locks which are shared with the other threads and its latency
+ * is unbounded. This GAM checks it while the application is running, so that the components which allocate can be identified
+ * and fixed (e.g. by allocating their buffers when they are configured).
+ *
+ * When the library is compiled with ALLOCATION_TRACKER defined (e.g. export ALLOCATION_TRACKER=1 before make) it replaces
+ * malloc, calloc, realloc, memalign, posix_memalign and aligned_alloc (and thus operator new and the MARTe heaps which use them)
+ * with wrappers which count the allocations made by the thread between two consecutive executions of the GAM, i.e. in a full cycle
+ * of the thread (all the GAMs, brokers and DataSources of the thread). For the wrappers to replace the allocator of the C library
+ * the library shall be preloaded, e.g. LD_PRELOAD=.../AllocationTrackerGAM.so MARTeApp.sh ...
+ *
+ * At each execution the GAM reports (REPORT_ERROR Warning) the number of allocations of the previous cycle, if any, and the call
+ * stack (symbol names, as resolved by dladdr) of the first one. Only the first MaxReports cycles with allocations are reported
+ * but all of them are counted. The first cycle after a state transition is not checked (the brokers and the DataSources may
+ * allocate memory when a new state starts).
+ *
+ * If the library was not compiled with ALLOCATION_TRACKER or it was not preloaded the GAM warns at initialisation and no allocation
+ * is flagged (IsTracking() is false). The GAM is meant for debug and test builds only.
+ *
+ * The GAM shall be the first GAM of the thread (it can be in any position, but the cycle which is checked then spans two periods
+ * of the thread). Its optional output signals are:
+ *  - the number of allocations of the previous cycle;
+ *  - the number of cycles where allocations were flagged.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +AllocationTracker = {
+ *     Class = AllocationTrackerGAM
+ *     MaxReports = 10 //Optional. Number of cycles with allocations which are reported. Default = 10.
+ *     OutputSignals = { //Optional. At most two uint32 signals with one element.
+ *         Allocations = {
+ *             DataSource = DDB1
+ *             Type = uint32
+ *         }
+ *         CyclesWithAllocations = {
+ *             DataSource = DDB1
+ *             Type = uint32
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class AllocationTrackerGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    AllocationTrackerGAM();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~AllocationTrackerGAM();
+
+    /**
+     * @brief Reads the parameters specified in the class description and checks if the allocations can be tracked.
+     * @param[in] data the GAM configuration.
+     * @return true if the parameters are valid (a missing tracker is only reported as a warning).
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals.
+     * @return true if there are no input signals and at most two uint32 output signals with one element.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Reports the allocations of the previous cycle, writes the output signals and starts tracking a new cycle.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Requests that the next cycle is not checked.
+     * @param[in] currentStateName the current state.
+     * @param[in] nextStateName the next state.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief Checks if the allocations are tracked.
+     * @return true if the library was compiled with ALLOCATION_TRACKER and preloaded.
+     */
+    bool IsTracking() const;
+
+    /**
+     * @brief Gets the number of allocations flagged since the GAM was initialised.
+     * @return the number of allocations flagged.
+     */
+    uint64 GetNumberOfAllocations() const;
+
+    /**
+     * @brief Gets the number of cycles where allocations were flagged.
+     * @return the number of cycles where allocations were flagged.
+     */
+    uint32 GetNumberOfCyclesWithAllocations() const;
+
+private:
+
+    /**
+     * @brief Reports the allocations of a cycle and the call stack of the first one.
+     * @param[in] allocations the number of allocations of the cycle.
+     * @param[in] frames the return addresses of the call stack of the first allocation.
+     * @param[in] numberOfFrames the number of frames.
+     */
+    void Report(const uint32 allocations,
+                void * const * const frames,
+                const uint32 numberOfFrames) const;
+
+    /**
+     * The number of cycles with allocations which are reported.
+     */
+    uint32 maxReports;
+
+    /**
+     * True if the allocations are tracked.
+     */
+    bool tracking;
+
+    /**
+     * The number of allocations flagged since the GAM was initialised.
+     */
+    uint64 numberOfAllocations;
+
+    /**
+     * The number of cycles where allocations were flagged.
+     */
+    uint32 cyclesWithAllocations;
+
+    /**
+     * The number of allocations of the previous cycle.
+     */
+    uint32 *allocationsOutput;
+
+    /**
+     * The number of cycles where allocations were flagged.
+     */
+    uint32 *cyclesOutput;
+
+    /**
+     * Set in PrepareNextState so that the next cycle is not checked.
+     */
+    volatile int32 skipPending;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* ALLOCATIONTRACKERGAM_H_ */
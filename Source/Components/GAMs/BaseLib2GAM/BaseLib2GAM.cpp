@@ -51,6 +51,14 @@ BaseLib2GAM::BaseLib2GAM() :
     inputToGAMByteSize = 0u;
     outputFromGAMByteSize = 0u;
     gamFunctionNumber = 0u;
+    numberOfInputBlocks = 0u;
+    inputBlockGAMAddresses = NULL_PTR(void **);
+    inputBlockAdapterAddresses = NULL_PTR(void **);
+    inputBlockSizes = NULL_PTR(uint32 *);
+    numberOfOutputBlocks = 0u;
+    outputBlockGAMAddresses = NULL_PTR(void **);
+    outputBlockAdapterAddresses = NULL_PTR(void **);
+    outputBlockSizes = NULL_PTR(uint32 *);
 }
 
 /*lint -e{1551} -e{1540} the destructor must guarantee that the GAMAdapter is removed from the GlobalObjectDatabase of BaseLib2.
@@ -60,6 +68,24 @@ BaseLib2GAM::~BaseLib2GAM() {
     if(!adapter->RemoveGAM(gamIdx)) {
         REPORT_ERROR(ErrorManagement::ParametersError, "Failed to remove GAM from adapter.");
     }
+    if (inputBlockGAMAddresses != NULL_PTR(void **)) {
+        delete[] inputBlockGAMAddresses;
+    }
+    if (inputBlockAdapterAddresses != NULL_PTR(void **)) {
+        delete[] inputBlockAdapterAddresses;
+    }
+    if (inputBlockSizes != NULL_PTR(uint32 *)) {
+        delete[] inputBlockSizes;
+    }
+    if (outputBlockGAMAddresses != NULL_PTR(void **)) {
+        delete[] outputBlockGAMAddresses;
+    }
+    if (outputBlockAdapterAddresses != NULL_PTR(void **)) {
+        delete[] outputBlockAdapterAddresses;
+    }
+    if (outputBlockSizes != NULL_PTR(uint32 *)) {
+        delete[] outputBlockSizes;
+    }
 }
 
 bool BaseLib2GAM::Initialise(StructuredDataI & data) {
@@ -179,22 +205,78 @@ bool BaseLib2GAM::Setup() {
     if (ok) {
         ok = adapter->FinaliseGAM(gamIdx, inputToGAM, outputFromGAM);
     }
+    if (ok) {
+        ok = ComputeCopyBlocks(InputSignals, inputToGAM, numberOfInputBlocks, inputBlockGAMAddresses, inputBlockAdapterAddresses, inputBlockSizes);
+    }
+    if (ok) {
+        ok = ComputeCopyBlocks(OutputSignals, outputFromGAM, numberOfOutputBlocks, outputBlockGAMAddresses, outputBlockAdapterAddresses, outputBlockSizes);
+    }
+    if (ok) {
+        REPORT_ERROR(ErrorManagement::Information, "%u input and %u output copy blocks", numberOfInputBlocks, numberOfOutputBlocks);
+    }
+    return ok;
+}
+
+bool BaseLib2GAM::ComputeCopyBlocks(const SignalDirection direction,
+                                    void * const adapterMemory,
+                                    uint32 &numberOfBlocks,
+                                    void **&gamAddresses,
+                                    void **&adapterAddresses,
+                                    uint32 *&blockSizes) {
+    uint32 numberOfSignals = (direction == InputSignals) ? (GetNumberOfInputSignals()) : (GetNumberOfOutputSignals());
+    bool ok = true;
+    numberOfBlocks = 0u;
+    if (numberOfSignals > 0u) {
+        gamAddresses = new void*[numberOfSignals];
+        adapterAddresses = new void*[numberOfSignals];
+        blockSizes = new uint32[numberOfSignals];
+    }
+    /*lint -e{613} adapterMemory cannot be NULL if there are signals (FinaliseGAM succeeded)*/
+    uint8 *adapterSignalMemory = static_cast<uint8 *>(adapterMemory);
+    uint32 i;
+    for (i = 0u; (i < numberOfSignals) && (ok); i++) {
+        uint32 byteSize = 0u;
+        ok = GetSignalByteSize(direction, i, byteSize);
+        if (ok) {
+            uint8 *gamSignalMemory = static_cast<uint8 *>((direction == InputSignals) ? (GetInputSignalMemory(i)) : (GetOutputSignalMemory(i)));
+            bool overlaid = (gamSignalMemory == adapterSignalMemory);
+            if ((!overlaid) && (byteSize > 0u)) {
+                bool extendBlock = (numberOfBlocks > 0u);
+                if (extendBlock) {
+                    uint8 *lastGAMEnd = &static_cast<uint8 *>(gamAddresses[numberOfBlocks - 1u])[blockSizes[numberOfBlocks - 1u]];
+                    uint8 *lastAdapterEnd = &static_cast<uint8 *>(adapterAddresses[numberOfBlocks - 1u])[blockSizes[numberOfBlocks - 1u]];
+                    extendBlock = ((lastGAMEnd == gamSignalMemory) && (lastAdapterEnd == adapterSignalMemory));
+                }
+                if (extendBlock) {
+                    blockSizes[numberOfBlocks - 1u] += byteSize;
+                }
+                else {
+                    gamAddresses[numberOfBlocks] = gamSignalMemory;
+                    adapterAddresses[numberOfBlocks] = adapterSignalMemory;
+                    blockSizes[numberOfBlocks] = byteSize;
+                    numberOfBlocks++;
+                }
+            }
+            adapterSignalMemory = &adapterSignalMemory[byteSize];
+        }
+    }
     return ok;
 }
 
 bool BaseLib2GAM::Execute() {
     BaseLib2::GAMAdapter *adapter = BaseLib2::GAMAdapter::Instance();
     bool ok = true;
-    if (inputToGAMByteSize > 0u) {
-        ok = MemoryOperationsHelper::Copy(inputToGAM, GetInputSignalsMemory(), inputToGAMByteSize);
+    uint32 i;
+    /*lint -e{613} the block arrays cannot be NULL if the number of blocks is greater than 0*/
+    for (i = 0u; (i < numberOfInputBlocks) && (ok); i++) {
+        ok = MemoryOperationsHelper::Copy(inputBlockAdapterAddresses[i], inputBlockGAMAddresses[i], inputBlockSizes[i]);
     }
     if (ok) {
         ok = adapter->ExecuteGAM(gamIdx, gamFunctionNumber);
     }
-    if (ok) {
-        if (outputFromGAMByteSize > 0u) {
-            ok = MemoryOperationsHelper::Copy(GetOutputSignalsMemory(), outputFromGAM, outputFromGAMByteSize);
-        }
+    /*lint -e{613} the block arrays cannot be NULL if the number of blocks is greater than 0*/
+    for (i = 0u; (i < numberOfOutputBlocks) && (ok); i++) {
+        ok = MemoryOperationsHelper::Copy(outputBlockGAMAddresses[i], outputBlockAdapterAddresses[i], outputBlockSizes[i]);
     }
     return ok;
 }
@@ -85,6 +85,10 @@ namespace MARTe {
  *     }
  * }
  *</pre>
+ *
+ * At Setup the memory of each MARTe2 signal is compared with the memory of the matching BaseLib2 signal (which has the same
+ * order and size). The signals which are already overlaid (i.e. share the same memory) are not copied and the remaining signals
+ * are grouped in the minimum number of contiguous block copies, which are the only copies performed in the Execute method.
  */
 class BaseLib2GAM: public GAM {
 public:
@@ -119,7 +123,8 @@ public:
     /**
      * @brief Calls the BaseLib2 GAM Execute with the GAMFunctionNumber defined in the Execute method.
      * @details The MARTe2 input signals are copied into the BaseLib2 GAM input, the BaseLib2 GAM is executed
-     * and finally the BaseLib2 GAM output signals are copied into the MARTe2 output signals.
+     * and finally the BaseLib2 GAM output signals are copied into the MARTe2 output signals. Only the copy blocks
+     * computed at Setup are copied (see class description).
      * @return the return value of the BaseLib2 GAM Execute method call.
      * @pre
      *     Setup
@@ -137,6 +142,23 @@ public:
 
 private:
 
+    /**
+     * @brief Computes the blocks to be copied between the MARTe2 signals and the BaseLib2 signals memory.
+     * @param[in] direction InputSignals or OutputSignals.
+     * @param[in] adapterMemory the BaseLib2 signals memory returned by the GAMAdapter.
+     * @param[out] numberOfBlocks the number of blocks to copy.
+     * @param[out] gamAddresses the MARTe2 memory address of each block.
+     * @param[out] adapterAddresses the BaseLib2 memory address of each block.
+     * @param[out] blockSizes the byte size of each block.
+     * @return true if the byte size of all the signals can be retrieved.
+     */
+    bool ComputeCopyBlocks(const SignalDirection direction,
+                           void * const adapterMemory,
+                           uint32 &numberOfBlocks,
+                           void **&gamAddresses,
+                           void **&adapterAddresses,
+                           uint32 *&blockSizes);
+
     /**
      * The GAM index returned by the GAMAdapter
      */
@@ -166,6 +188,22 @@ private:
      * The BaseLib2 Execute(GAM_FunctionNumbers).
      */
     uint32 gamFunctionNumber;
+
+    /**
+     * @brief Blocks copied from the MARTe2 input signals into the BaseLib2 GAM input.
+     */
+    uint32 numberOfInputBlocks;
+    void **inputBlockGAMAddresses;
+    void **inputBlockAdapterAddresses;
+    uint32 *inputBlockSizes;
+
+    /**
+     * @brief Blocks copied from the BaseLib2 GAM output into the MARTe2 output signals.
+     */
+    uint32 numberOfOutputBlocks;
+    void **outputBlockGAMAddresses;
+    void **outputBlockAdapterAddresses;
+    uint32 *outputBlockSizes;
 };
 }
 
@@ -0,0 +1,245 @@
+/**
+ * @file BitPackGAM.cpp
+ * @brief Source file for class BitPackGAM
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BitPackGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BitPackGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+BitPackGAM::BitPackGAM() :
+        GAM() {
+    signals = NULL_PTR(BitPackGAMSignal *);
+    numberOfSignals = 0u;
+}
+
+/*lint -e{1551} the destructor must guarantee that the bit maps are freed.*/
+BitPackGAM::~BitPackGAM() {
+    if (signals != NULL_PTR(BitPackGAMSignal *)) {
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            if (signals[i].wordIndex != NULL_PTR(uint32 *)) {
+                delete[] signals[i].wordIndex;
+            }
+            if (signals[i].bitIndex != NULL_PTR(uint32 *)) {
+                delete[] signals[i].bitIndex;
+            }
+        }
+        delete[] signals;
+    }
+}
+
+bool BitPackGAM::Setup() {
+    numberOfSignals = GetNumberOfInputSignals();
+    bool ok = (numberOfSignals > 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "At least one input signal shall be specified");
+    }
+    if (ok) {
+        ok = (GetNumberOfOutputSignals() == numberOfSignals);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The number of output signals shall be equal to the number of input signals (%u)", numberOfSignals);
+        }
+    }
+    if (ok) {
+        signals = new BitPackGAMSignal[numberOfSignals];
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            signals[i].input = NULL_PTR(const uint8 *);
+            signals[i].output = NULL_PTR(void *);
+            signals[i].wordSize = 0u;
+            signals[i].numberOfWords = 0u;
+            signals[i].numberOfBits = 0u;
+            signals[i].wordIndex = NULL_PTR(uint32 *);
+            signals[i].bitIndex = NULL_PTR(uint32 *);
+        }
+    }
+    for (uint32 i = 0u; (i < numberOfSignals) && (ok); i++) {
+        /*lint -e{613} signals cannot be NULL as otherwise ok would be false*/
+        BitPackGAMSignal &signal = signals[i];
+        ok = (GetSignalType(InputSignals, i) == UnsignedInteger8Bit);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The input signal %u shall be uint8", i);
+        }
+        TypeDescriptor outputType = GetSignalType(OutputSignals, i);
+        if (ok) {
+            ok = ((outputType == UnsignedInteger8Bit) || (outputType == UnsignedInteger16Bit) || (outputType == UnsignedInteger32Bit)
+                    || (outputType == UnsignedInteger64Bit));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The output signal %u shall be uint8, uint16, uint32 or uint64", i);
+            }
+        }
+        if (ok) {
+            signal.wordSize = (static_cast<uint32>(outputType.numberOfBits) / 8u);
+            ok = GetSignalNumberOfElements(OutputSignals, i, signal.numberOfWords);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(InputSignals, i, signal.numberOfBits);
+        }
+        if (ok) {
+            ok = signalsDatabase.MoveAbsolute("OutputSignals");
+        }
+        if (ok) {
+            ok = signalsDatabase.MoveToChild(i);
+        }
+        uint32 numberOfOutputBits = signal.numberOfWords * signal.wordSize * 8u;
+        if (ok) {
+            AnyType bitsDescription = signalsDatabase.GetType("Bits");
+            if (bitsDescription.IsVoid()) {
+                ok = (signal.numberOfBits == numberOfOutputBits);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The input signal %u shall have %u elements (one per bit of the output signal)", i,
+                                 numberOfOutputBits);
+                }
+            }
+            else {
+                ok = (bitsDescription.GetNumberOfElements(0u) == signal.numberOfBits);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The Bits of the output signal %u shall have %u elements (one per element of the input signal)",
+                                 i, signal.numberOfBits);
+                }
+                if (ok) {
+                    signal.wordIndex = new uint32[signal.numberOfBits];
+                    signal.bitIndex = new uint32[signal.numberOfBits];
+                    Vector<uint32> bitsVector(signal.bitIndex, signal.numberOfBits);
+                    ok = signalsDatabase.Read("Bits", bitsVector);
+                }
+                uint32 bitsPerWord = signal.wordSize * 8u;
+                for (uint32 k = 0u; (k < signal.numberOfBits) && (ok); k++) {
+                    ok = (signal.bitIndex[k] < numberOfOutputBits);
+                    if (ok) {
+                        signal.wordIndex[k] = (signal.bitIndex[k] / bitsPerWord);
+                        signal.bitIndex[k] = (signal.bitIndex[k] % bitsPerWord);
+                    }
+                    else {
+                        REPORT_ERROR(ErrorManagement::InitialisationError, "The bit %u of the output signal %u is not in the signal (%u bits)", k, i,
+                                     numberOfOutputBits);
+                    }
+                }
+            }
+        }
+        if (ok) {
+            signal.input = static_cast<const uint8 *>(GetInputSignalMemory(i));
+            signal.output = GetOutputSignalMemory(i);
+        }
+    }
+    return ok;
+}
+
+bool BitPackGAM::Execute() {
+    for (uint32 i = 0u; i < numberOfSignals; i++) {
+        /*lint -e{613} signals cannot be NULL as Execute is only called after a successful Setup*/
+        const BitPackGAMSignal &signal = signals[i];
+        bool map = (signal.wordIndex != NULL_PTR(uint32 *));
+        if (signal.wordSize == 1u) {
+            if (map) {
+                PackMap<uint8>(signal);
+            }
+            else {
+                Pack<uint8>(signal);
+            }
+        }
+        else if (signal.wordSize == 2u) {
+            if (map) {
+                PackMap<uint16>(signal);
+            }
+            else {
+                Pack<uint16>(signal);
+            }
+        }
+        else if (signal.wordSize == 4u) {
+            if (map) {
+                PackMap<uint32>(signal);
+            }
+            else {
+                Pack<uint32>(signal);
+            }
+        }
+        else {
+            if (map) {
+                PackMap<uint64>(signal);
+            }
+            else {
+                Pack<uint64>(signal);
+            }
+        }
+    }
+    return true;
+}
+
+bool BitPackGAM::HasBitsMap(const uint32 signalIdx) const {
+    bool ret = false;
+    if ((signals != NULL_PTR(BitPackGAMSignal *)) && (signalIdx < numberOfSignals)) {
+        ret = (signals[signalIdx].wordIndex != NULL_PTR(uint32 *));
+    }
+    return ret;
+}
+
+template<typename T>
+void BitPackGAM::Pack(const BitPackGAMSignal &signal) {
+    const uint8 *input = signal.input;
+    T *words = static_cast<T *>(signal.output);
+    for (uint32 w = 0u; w < signal.numberOfWords; w++) {
+        T word = 0u;
+        for (uint32 b = 0u; b < sizeof(T); b++) {
+            uint32 byte = static_cast<uint32>(input[0] != 0u);
+            byte |= (static_cast<uint32>(input[1] != 0u) << 1u);
+            byte |= (static_cast<uint32>(input[2] != 0u) << 2u);
+            byte |= (static_cast<uint32>(input[3] != 0u) << 3u);
+            byte |= (static_cast<uint32>(input[4] != 0u) << 4u);
+            byte |= (static_cast<uint32>(input[5] != 0u) << 5u);
+            byte |= (static_cast<uint32>(input[6] != 0u) << 6u);
+            byte |= (static_cast<uint32>(input[7] != 0u) << 7u);
+            word |= static_cast<T>(static_cast<T>(byte) << (8u * b));
+            input = &input[8];
+        }
+        words[w] = word;
+    }
+}
+
+template<typename T>
+void BitPackGAM::PackMap(const BitPackGAMSignal &signal) {
+    T *words = static_cast<T *>(signal.output);
+    for (uint32 w = 0u; w < signal.numberOfWords; w++) {
+        words[w] = 0u;
+    }
+    for (uint32 k = 0u; k < signal.numberOfBits; k++) {
+        T bit = static_cast<T>(signal.input[k] != 0u);
+        words[signal.wordIndex[k]] |= static_cast<T>(bit << signal.bitIndex[k]);
+    }
+}
+
+CLASS_REGISTER(BitPackGAM, "1.0")
+}
@@ -0,0 +1,190 @@
+/**
+ * @file BitPackGAM.h
+ * @brief Header file for class BitPackGAM
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BitPackGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BITPACKGAM_H_
+#define BITPACKGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief The packing of an input signal into an output signal.
+ */
+struct BitPackGAMSignal {
+    /**
+     * The memory of the input signal (one uint8 per bit).
+     */
+    const uint8 *input;
+
+    /**
+     * The memory of the output signal (the packed words).
+     */
+    void *output;
+
+    /**
+     * The number of bytes of each word (1, 2, 4 or 8).
+     */
+    uint32 wordSize;
+
+    /**
+     * The number of words of the output signal.
+     */
+    uint32 numberOfWords;
+
+    /**
+     * The number of elements of the input signal.
+     */
+    uint32 numberOfBits;
+
+    /**
+     * For each input element, the index of the word of its bit (NULL if all the bits are packed).
+     */
+    uint32 *wordIndex;
+
+    /**
+     * For each input element, the position of its bit in the word (NULL if all the bits are packed).
+     */
+    uint32 *bitIndex;
+};
+
+/**
+ * @brief GAM which packs uint8 values (one per bit, any value other than 0 is a 1) into digital words (e.g. the ports of a digital
+ * I/O board). It is the reverse of the BitUnpackGAM.
+ * @details Each output signal is computed from the input signal with the same index. The input signals are uint8 and the output signals
+ * are arrays of uint8, uint16, uint32 or uint64 words, where the bit n is the bit (n % bits per word) of the word (n / bits per word),
+ * i.e. the least significant bit of the first word is the bit 0 (regardless of the endianness of the machine).
+ *
+ * By default all the bits of the output are packed from the input, which shall have a number of elements equal to the number of bits
+ * of the output. Each byte of the output is packed from 8 input elements without branches.
+ *
+ * Alternatively the output signal can set a Bits map, with the bit of the output of each element of the input (in any order), in which
+ * case the input shall have as many elements as the Bits map. The bits of the output which are not in the map are 0.
+ *
+ * The configuration syntax is (names and signal quantities are only given as an example):
+ *
+ * <pre>
+ * +Pack = {
+ *     Class = BitPackGAM
+ *     InputSignals = {
+ *         Commands = {
+ *             DataSource = DDB1
+ *             Type = uint8
+ *             NumberOfElements = 64
+ *         }
+ *         Valves = {
+ *             DataSource = DDB1
+ *             Type = uint8
+ *             NumberOfElements = 3
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Port0 = { //All the 64 bits from Commands.
+ *             DataSource = DIO
+ *             Type = uint32
+ *             NumberOfElements = 2
+ *         }
+ *         Port1 = { //The bits 3, 4 and 15 from Valves.
+ *             DataSource = DIO
+ *             Type = uint16
+ *             Bits = {3 4 15}
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class BitPackGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    BitPackGAM();
+
+    /**
+     * @brief Frees the bit maps.
+     */
+    virtual ~BitPackGAM();
+
+    /**
+     * @brief Verifies the signals and reads the Bits maps.
+     * @return true if the number of input and output signals is the same, the input signals are uint8, the output signals are
+     * unsigned integers and either the input has one element per output bit or the output has a Bits map (with bits of the output)
+     * with one entry per element of the input.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Packs the input signals in the output signals.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Returns true if the output signal signalIdx has a Bits map (valid after Setup).
+     */
+    bool HasBitsMap(const uint32 signalIdx) const;
+
+private:
+
+    /**
+     * @brief Packs all the bits of a signal with words of type T.
+     */
+    template<typename T>
+    static void Pack(const BitPackGAMSignal &signal);
+
+    /**
+     * @brief Packs the mapped bits of a signal with words of type T.
+     */
+    template<typename T>
+    static void PackMap(const BitPackGAMSignal &signal);
+
+    /**
+     * The signals (one for each input signal).
+     */
+    BitPackGAMSignal *signals;
+
+    /**
+     * The number of signals.
+     */
+    uint32 numberOfSignals;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BITPACKGAM_H_ */
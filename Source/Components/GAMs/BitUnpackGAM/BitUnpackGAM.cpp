@@ -0,0 +1,246 @@
+/**
+ * @file BitUnpackGAM.cpp
+ * @brief Source file for class BitUnpackGAM
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BitUnpackGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BitUnpackGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+BitUnpackGAM::BitUnpackGAM() :
+        GAM() {
+    signals = NULL_PTR(BitUnpackGAMSignal *);
+    numberOfSignals = 0u;
+    for (uint32 b = 0u; b < 256u; b++) {
+        for (uint32 k = 0u; k < 8u; k++) {
+            table[b][k] = static_cast<uint8>((b >> k) & 1u);
+        }
+    }
+}
+
+/*lint -e{1551} the destructor must guarantee that the bit maps are freed.*/
+BitUnpackGAM::~BitUnpackGAM() {
+    if (signals != NULL_PTR(BitUnpackGAMSignal *)) {
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            if (signals[i].wordIndex != NULL_PTR(uint32 *)) {
+                delete[] signals[i].wordIndex;
+            }
+            if (signals[i].bitIndex != NULL_PTR(uint32 *)) {
+                delete[] signals[i].bitIndex;
+            }
+        }
+        delete[] signals;
+    }
+}
+
+bool BitUnpackGAM::Setup() {
+    numberOfSignals = GetNumberOfInputSignals();
+    bool ok = (numberOfSignals > 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "At least one input signal shall be specified");
+    }
+    if (ok) {
+        ok = (GetNumberOfOutputSignals() == numberOfSignals);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The number of output signals shall be equal to the number of input signals (%u)", numberOfSignals);
+        }
+    }
+    if (ok) {
+        signals = new BitUnpackGAMSignal[numberOfSignals];
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            signals[i].input = NULL_PTR(const void *);
+            signals[i].output = NULL_PTR(uint8 *);
+            signals[i].wordSize = 0u;
+            signals[i].numberOfWords = 0u;
+            signals[i].numberOfBits = 0u;
+            signals[i].wordIndex = NULL_PTR(uint32 *);
+            signals[i].bitIndex = NULL_PTR(uint32 *);
+        }
+    }
+    for (uint32 i = 0u; (i < numberOfSignals) && (ok); i++) {
+        /*lint -e{613} signals cannot be NULL as otherwise ok would be false*/
+        BitUnpackGAMSignal &signal = signals[i];
+        TypeDescriptor inputType = GetSignalType(InputSignals, i);
+        ok = ((inputType == UnsignedInteger8Bit) || (inputType == UnsignedInteger16Bit) || (inputType == UnsignedInteger32Bit)
+                || (inputType == UnsignedInteger64Bit));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The input signal %u shall be uint8, uint16, uint32 or uint64", i);
+        }
+        if (ok) {
+            ok = (GetSignalType(OutputSignals, i) == UnsignedInteger8Bit);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The output signal %u shall be uint8", i);
+            }
+        }
+        if (ok) {
+            signal.wordSize = (static_cast<uint32>(inputType.numberOfBits) / 8u);
+            ok = GetSignalNumberOfElements(InputSignals, i, signal.numberOfWords);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(OutputSignals, i, signal.numberOfBits);
+        }
+        if (ok) {
+            ok = signalsDatabase.MoveAbsolute("OutputSignals");
+        }
+        if (ok) {
+            ok = signalsDatabase.MoveToChild(i);
+        }
+        uint32 numberOfInputBits = signal.numberOfWords * signal.wordSize * 8u;
+        if (ok) {
+            AnyType bitsDescription = signalsDatabase.GetType("Bits");
+            if (bitsDescription.IsVoid()) {
+                ok = (signal.numberOfBits == numberOfInputBits);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The output signal %u shall have %u elements (one per bit of the input signal)", i,
+                                 numberOfInputBits);
+                }
+            }
+            else {
+                ok = (bitsDescription.GetNumberOfElements(0u) == signal.numberOfBits);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The Bits of the output signal %u shall have %u elements (one per element of the signal)",
+                                 i, signal.numberOfBits);
+                }
+                if (ok) {
+                    signal.wordIndex = new uint32[signal.numberOfBits];
+                    signal.bitIndex = new uint32[signal.numberOfBits];
+                    Vector<uint32> bitsVector(signal.bitIndex, signal.numberOfBits);
+                    ok = signalsDatabase.Read("Bits", bitsVector);
+                }
+                uint32 bitsPerWord = signal.wordSize * 8u;
+                for (uint32 k = 0u; (k < signal.numberOfBits) && (ok); k++) {
+                    ok = (signal.bitIndex[k] < numberOfInputBits);
+                    if (ok) {
+                        signal.wordIndex[k] = (signal.bitIndex[k] / bitsPerWord);
+                        signal.bitIndex[k] = (signal.bitIndex[k] % bitsPerWord);
+                    }
+                    else {
+                        REPORT_ERROR(ErrorManagement::InitialisationError, "The bit %u of the output signal %u is not in the input signal (%u bits)", k, i,
+                                     numberOfInputBits);
+                    }
+                }
+            }
+        }
+        if (ok) {
+            signal.input = GetInputSignalMemory(i);
+            signal.output = static_cast<uint8 *>(GetOutputSignalMemory(i));
+        }
+    }
+    return ok;
+}
+
+bool BitUnpackGAM::Execute() {
+    for (uint32 i = 0u; i < numberOfSignals; i++) {
+        /*lint -e{613} signals cannot be NULL as Execute is only called after a successful Setup*/
+        const BitUnpackGAMSignal &signal = signals[i];
+        bool map = (signal.wordIndex != NULL_PTR(uint32 *));
+        if (signal.wordSize == 1u) {
+            if (map) {
+                UnpackMap<uint8>(signal);
+            }
+            else {
+                Unpack<uint8>(signal);
+            }
+        }
+        else if (signal.wordSize == 2u) {
+            if (map) {
+                UnpackMap<uint16>(signal);
+            }
+            else {
+                Unpack<uint16>(signal);
+            }
+        }
+        else if (signal.wordSize == 4u) {
+            if (map) {
+                UnpackMap<uint32>(signal);
+            }
+            else {
+                Unpack<uint32>(signal);
+            }
+        }
+        else {
+            if (map) {
+                UnpackMap<uint64>(signal);
+            }
+            else {
+                Unpack<uint64>(signal);
+            }
+        }
+    }
+    return true;
+}
+
+bool BitUnpackGAM::HasBitsMap(const uint32 signalIdx) const {
+    bool ret = false;
+    if ((signals != NULL_PTR(BitUnpackGAMSignal *)) && (signalIdx < numberOfSignals)) {
+        ret = (signals[signalIdx].wordIndex != NULL_PTR(uint32 *));
+    }
+    return ret;
+}
+
+template<typename T>
+void BitUnpackGAM::Unpack(const BitUnpackGAMSignal &signal) const {
+    const T *words = static_cast<const T *>(signal.input);
+    uint8 *output = signal.output;
+    for (uint32 w = 0u; w < signal.numberOfWords; w++) {
+        T word = words[w];
+        for (uint32 b = 0u; b < sizeof(T); b++) {
+            //The 8 copies are adjacent and are merged by the compiler in a single 64 bit copy.
+            const uint8 * const bits = &table[static_cast<uint8>(word >> (8u * b))][0];
+            output[0] = bits[0];
+            output[1] = bits[1];
+            output[2] = bits[2];
+            output[3] = bits[3];
+            output[4] = bits[4];
+            output[5] = bits[5];
+            output[6] = bits[6];
+            output[7] = bits[7];
+            output = &output[8];
+        }
+    }
+}
+
+template<typename T>
+void BitUnpackGAM::UnpackMap(const BitUnpackGAMSignal &signal) {
+    const T *words = static_cast<const T *>(signal.input);
+    for (uint32 k = 0u; k < signal.numberOfBits; k++) {
+        signal.output[k] = static_cast<uint8>((words[signal.wordIndex[k]] >> signal.bitIndex[k]) & 1u);
+    }
+}
+
+CLASS_REGISTER(BitUnpackGAM, "1.0")
+}
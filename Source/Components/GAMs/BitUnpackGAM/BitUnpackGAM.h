@@ -0,0 +1,194 @@
+/**
+ * @file BitUnpackGAM.h
+ * @brief Header file for class BitUnpackGAM
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BitUnpackGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BITUNPACKGAM_H_
+#define BITUNPACKGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief The expansion of an input signal into an output signal.
+ */
+struct BitUnpackGAMSignal {
+    /**
+     * The memory of the input signal (the packed words).
+     */
+    const void *input;
+
+    /**
+     * The memory of the output signal (one uint8 per bit).
+     */
+    uint8 *output;
+
+    /**
+     * The number of bytes of each word (1, 2, 4 or 8).
+     */
+    uint32 wordSize;
+
+    /**
+     * The number of words of the input signal.
+     */
+    uint32 numberOfWords;
+
+    /**
+     * The number of elements of the output signal.
+     */
+    uint32 numberOfBits;
+
+    /**
+     * For each output element, the index of the word with its bit (NULL if all the bits are expanded).
+     */
+    uint32 *wordIndex;
+
+    /**
+     * For each output element, the position of its bit in the word (NULL if all the bits are expanded).
+     */
+    uint32 *bitIndex;
+};
+
+/**
+ * @brief GAM which expands packed digital words (e.g. the ports of a digital I/O board) into one uint8 (0 or 1) per bit.
+ * @details Each output signal is computed from the input signal with the same index. The input signals are arrays of uint8, uint16,
+ * uint32 or uint64 words and the bit n of the input is the bit (n % bits per word) of the word (n / bits per word), i.e. the
+ * least significant bit of the first word is the bit 0 (regardless of the endianness of the machine). The output signals are uint8.
+ *
+ * By default all the bits of the input are expanded, i.e. the output has a number of elements equal to the number of bits of the input.
+ * The words are expanded one byte at the time with a 256 entries table which holds the 8 output bytes of each byte value: expanding
+ * 1024 bits costs 128 table lookups and 8 byte copies each (which the compiler merges in a single 64 bit copy).
+ *
+ * Alternatively the output signal can set a Bits map, with the bit of the input of each of its elements (in any order and possibly
+ * repeated), in which case the output shall have as many elements as the Bits map.
+ *
+ * The configuration syntax is (names and signal quantities are only given as an example):
+ *
+ * <pre>
+ * +Unpack = {
+ *     Class = BitUnpackGAM
+ *     InputSignals = {
+ *         Port0 = {
+ *             DataSource = DIO
+ *             Type = uint32
+ *             NumberOfElements = 32
+ *         }
+ *         Port1 = {
+ *             DataSource = DIO
+ *             Type = uint16
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Interlocks = { //All the 1024 bits of Port0.
+ *             DataSource = DDB1
+ *             Type = uint8
+ *             NumberOfElements = 1024
+ *         }
+ *         Valves = { //The bits 3, 4 and 15 of Port1.
+ *             DataSource = DDB1
+ *             Type = uint8
+ *             NumberOfElements = 3
+ *             Bits = {3 4 15}
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class BitUnpackGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    BitUnpackGAM();
+
+    /**
+     * @brief Frees the bit maps.
+     */
+    virtual ~BitUnpackGAM();
+
+    /**
+     * @brief Verifies the signals and reads the Bits maps.
+     * @return true if the number of input and output signals is the same, the input signals are unsigned integers, the output signals
+     * are uint8 and either have one element per input bit or a Bits map (with bits of the input) with one entry per element.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Expands the input signals in the output signals.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Returns true if the output signal signalIdx has a Bits map (valid after Setup).
+     */
+    bool HasBitsMap(const uint32 signalIdx) const;
+
+private:
+
+    /**
+     * @brief Expands all the bits of a signal with words of type T.
+     */
+    template<typename T>
+    void Unpack(const BitUnpackGAMSignal &signal) const;
+
+    /**
+     * @brief Expands the mapped bits of a signal with words of type T.
+     */
+    template<typename T>
+    static void UnpackMap(const BitUnpackGAMSignal &signal);
+
+    /**
+     * The signals (one for each input signal).
+     */
+    BitUnpackGAMSignal *signals;
+
+    /**
+     * The number of signals.
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * The output bytes of each value of an input byte.
+     */
+    uint8 table[256u][8u];
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BITUNPACKGAM_H_ */
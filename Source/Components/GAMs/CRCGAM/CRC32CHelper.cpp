@@ -0,0 +1,153 @@
+/**
+ * @file CRC32CHelper.cpp
+ * @brief Source file for class CRC32CHelper
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CRC32CHelper (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#define CRC32C_HARDWARE
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "CRC32CHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+#ifdef CRC32C_HARDWARE
+namespace {
+
+/**
+ * @brief Computes the CRC-32C with the crc32 instruction (only compiled for SSE4.2, only called if the CPU supports it).
+ */
+__attribute__((target("sse4.2")))
+MARTe::uint32 CRC32CHardware(const MARTe::uint8 * const data,
+                             const MARTe::uint32 size,
+                             const MARTe::uint32 initCRC) {
+    MARTe::uint32 i = 0u;
+#ifdef __x86_64__
+    unsigned long long reg = initCRC;
+    const MARTe::uint32 nWords = (size / 8u);
+    for (MARTe::uint32 n = 0u; n < nWords; n++) {
+        unsigned long long word;
+        /* Unaligned load, the crc32 instruction consumes the bytes in memory order (little-endian) */
+        __builtin_memcpy(&word, &data[i], 8u);
+        reg = __builtin_ia32_crc32di(reg, word);
+        i += 8u;
+    }
+    unsigned int crc = static_cast<unsigned int>(reg);
+#else
+    unsigned int crc = initCRC;
+    const MARTe::uint32 nWords = (size / 4u);
+    for (MARTe::uint32 n = 0u; n < nWords; n++) {
+        unsigned int word;
+        __builtin_memcpy(&word, &data[i], 4u);
+        crc = __builtin_ia32_crc32si(crc, word);
+        i += 4u;
+    }
+#endif
+    for (; i < size; i++) {
+        crc = __builtin_ia32_crc32qi(crc, data[i]);
+    }
+    return static_cast<MARTe::uint32>(crc);
+}
+
+}
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+CRC32CHelper::CRC32CHelper() :
+        CRCHelper(),
+        fallback(true) {
+    hardware = IsSupported();
+    uint32 polynomial = crc32cPolynomial;
+    fallback.ComputeTable(&polynomial);
+}
+
+CRC32CHelper::~CRC32CHelper() {
+
+}
+
+bool CRC32CHelper::IsSupported() {
+    bool ret = false;
+#ifdef CRC32C_HARDWARE
+    unsigned int eax = 0u;
+    unsigned int ebx = 0u;
+    unsigned int ecx = 0u;
+    unsigned int edx = 0u;
+    if (__get_cpuid(1u, &eax, &ebx, &ecx, &edx) != 0) {
+        ret = ((ecx & bit_SSE4_2) != 0u);
+    }
+#endif
+    return ret;
+}
+
+/*lint -e{715} the polynomial of the instruction is fixed*/
+void CRC32CHelper::ComputeTable(void * const pol) {
+}
+
+void CRC32CHelper::Compute(const uint8 * const data,
+                           int32 const size,
+                           void * const initCRC,
+                           bool const inputInverted,
+                           void * const retVal) {
+#ifdef CRC32C_HARDWARE
+    if ((hardware) && (!inputInverted)) {
+        uint32 crcValue = *static_cast<uint32*>(initCRC);
+        if (size > 0) {
+            crcValue = CRC32CHardware(data, static_cast<uint32>(size), crcValue);
+        }
+        if (retVal != NULL_PTR(void *)) {
+            *static_cast<uint32*>(retVal) = crcValue;
+        }
+    }
+    else {
+        fallback.Compute(data, size, initCRC, inputInverted, retVal);
+    }
+#else
+    fallback.Compute(data, size, initCRC, inputInverted, retVal);
+#endif
+}
+
+
+void CRC32CHelper::ComputeZerosOperator(const uint32 numberOfBytes,
+                                        uint32 * const op) {
+    ComputeZerosOperatorT<uint32>(numberOfBytes, op);
+}
+
+void CRC32CHelper::Combine(const uint32 * const op,
+                           void * const crcValue,
+                           const void * const nextCRC,
+                           const void * const initCRC) {
+    CombineT<uint32>(op, crcValue, nextCRC, initCRC);
+}
+
+}
@@ -0,0 +1,122 @@
+/**
+ * @file CRC32CHelper.h
+ * @brief Header file for class CRC32CHelper
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CRC32CHelper
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_COMPONENTS_GAMS_CRCGAM_CRC32CHELPER_H_
+#define SOURCE_COMPONENTS_GAMS_CRCGAM_CRC32CHELPER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CRCSlicingHelperT.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The CRC-32C (Castagnoli) polynomial.
+ */
+static const uint32 crc32cPolynomial = 0x1EDC6F41u;
+
+/**
+ * @brief Helper class to compute the CRC-32C with the crc32 instruction of the x86 SSE4.2 extension.
+ * @details The crc32 instruction computes the reflected CRC with the CRC-32C polynomial, i.e. the same result of
+ * CRCSlicingHelperT<uint32> with the input reflected and the polynomial crc32cPolynomial (no final xor is applied,
+ * so that the standard CRC-32C is the bitwise complement of the result computed with an initial value of 0xFFFFFFFF).
+ *
+ * The instruction is only used if IsSupported() (i.e. if the component was compiled with GCC for x86 and the CPU
+ * supports SSE4.2). The bytes traversed in reverse order (inputInverted) and the CRCs on CPUs without SSE4.2 are
+ * computed with CRCSlicingHelperT<uint32>.
+ */
+class CRC32CHelper: public CRCHelper {
+public:
+    /**
+     * @brief Constructor.
+     */
+    CRC32CHelper();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~CRC32CHelper();
+
+    /**
+     * @brief Checks if the crc32 instruction is available.
+     * @return true if the component was compiled for x86 and the CPU supports SSE4.2.
+     */
+    static bool IsSupported();
+
+    /**
+     * @see CRCHelper::ComputeTable
+     * @details The polynomial is ignored (the polynomial of the instruction is crc32cPolynomial).
+     */
+    virtual void ComputeTable(void * const pol);
+
+    /**
+     * @see CRCHelper::Compute
+     * @details The CRC is always uint32.
+     */
+    virtual void Compute(const uint8 * const data,
+                         int32 const size,
+                         void * const initCRC,
+                         bool const inputInverted,
+                         void * const retVal);
+
+    /**
+     * @see CRCHelper::ComputeZerosOperator
+     */
+    virtual void ComputeZerosOperator(const uint32 numberOfBytes,
+                                      uint32 * const op);
+
+    /**
+     * @see CRCHelper::Combine
+     */
+    virtual void Combine(const uint32 * const op,
+                         void * const crcValue,
+                         const void * const nextCRC,
+                         const void * const initCRC);
+
+private:
+
+    /**
+     * True if the crc32 instruction is available.
+     */
+    bool hardware;
+
+    /**
+     * Table based CRC-32C, used when the instruction cannot be used.
+     */
+    CRCSlicingHelperT<uint32> fallback;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_COMPONENTS_GAMS_CRCGAM_CRC32CHELPER_H_ */
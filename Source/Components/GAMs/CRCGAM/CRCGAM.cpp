@@ -32,6 +32,9 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "CRCGAM.h"
+#include "MemoryOperationsHelper.h"
+#include "StreamString.h"
+#include "Vector.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -51,13 +54,45 @@ CRCGAM::CRCGAM() :
     polynomial = 0x0u;
     initialCRCValue = 0x0u;
     isReflected = 0u;
+    reflectedInput = 0u;
+    combineCRCs = 0u;
     inputSize = 0u;
+    inputSignalsData = NULL_PTR(uint8 **);
+    inputSignalsSize = NULL_PTR(uint32 *);
+    blockSizes = NULL_PTR(uint32 *);
+    numberOfBlockSizes = 0u;
+    zerosOperators = NULL_PTR(uint32 *);
+    verify = 0u;
+    stopOnError = 0u;
+    frameSize = 0u;
+    crcOffset = 0u;
+    numberOfFrames = 0u;
+    crcSize = 0u;
+    validMaskData = NULL_PTR(void *);
+    invalidFramesData = NULL_PTR(uint32 *);
 }
 
 CRCGAM::~CRCGAM() {
     inputData = NULL_PTR(uint8 *);
     outputData = NULL_PTR(void *);
+    validMaskData = NULL_PTR(void *);
+    invalidFramesData = NULL_PTR(uint32 *);
+    if (crcHelper != NULL_PTR(CRCHelper *)) {
+        delete crcHelper;
+    }
     crcHelper = NULL_PTR(CRCHelper *);
+    if (inputSignalsData != NULL_PTR(uint8 **)) {
+        delete[] inputSignalsData;
+    }
+    if (inputSignalsSize != NULL_PTR(uint32 *)) {
+        delete[] inputSignalsSize;
+    }
+    if (blockSizes != NULL_PTR(uint32 *)) {
+        delete[] blockSizes;
+    }
+    if (zerosOperators != NULL_PTR(uint32 *)) {
+        delete[] zerosOperators;
+    }
 }
 
 bool CRCGAM::Initialise(StructuredDataI &data) {
@@ -84,6 +119,100 @@ bool CRCGAM::Initialise(StructuredDataI &data) {
             ok = false;
         }
     }
+    if (ok) {
+        if (!data.Read("Reflected", reflectedInput)) {
+            reflectedInput = 0u;
+        }
+        if (reflectedInput > 1u) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Reflected option value must be 0 or 1. Now Reflected = %d", reflectedInput);
+            ok = false;
+        }
+    }
+    if (ok) {
+        if (!data.Read("CombineCRCs", combineCRCs)) {
+            combineCRCs = 0u;
+        }
+        if (combineCRCs > 1u) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "CombineCRCs option value must be 0 or 1. Now CombineCRCs = %d", combineCRCs);
+            ok = false;
+        }
+    }
+    if ((ok) && (combineCRCs == 1u)) {
+        ok = (isReflected == 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "CombineCRCs requires Inverted = 0");
+        }
+        if (ok) {
+            AnyType blockSizesType = data.GetType("BlockSizes");
+            ok = !blockSizesType.IsVoid();
+            if (ok) {
+                numberOfBlockSizes = blockSizesType.GetNumberOfElements(0u);
+                ok = (numberOfBlockSizes > 0u);
+            }
+            if (ok) {
+                blockSizes = new uint32[numberOfBlockSizes];
+                Vector<uint32> blockSizesVector(blockSizes, numberOfBlockSizes);
+                ok = data.Read("BlockSizes", blockSizesVector);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Cannot read BlockSizes from configuration.");
+            }
+        }
+    }
+    if (ok) {
+        if (!data.Read("Verify", verify)) {
+            verify = 0u;
+        }
+        if (verify > 1u) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Verify option value must be 0 or 1. Now Verify = %d", verify);
+            ok = false;
+        }
+    }
+    if ((ok) && (verify == 1u)) {
+        ok = (isReflected == 0u) && (combineCRCs == 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Verify requires Inverted = 0 and CombineCRCs = 0");
+        }
+        if (ok) {
+            StreamString crcTypeName;
+            ok = data.Read("CRCType", crcTypeName);
+            if (ok) {
+                outputSignalType = TypeDescriptor::GetTypeDescriptorFromTypeName(crcTypeName.Buffer());
+                ok = ((outputSignalType == UnsignedInteger8Bit) || (outputSignalType == UnsignedInteger16Bit) || (outputSignalType == UnsignedInteger32Bit));
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "CRCType shall be uint8, uint16 or uint32");
+            }
+        }
+        if (ok) {
+            crcSize = (static_cast<uint32>(outputSignalType.numberOfBits) / 8u);
+            ok = data.Read("FrameSize", frameSize);
+            if (ok) {
+                ok = (frameSize > crcSize);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "FrameSize shall be specified and be greater than the size of the CRC (%u)", crcSize);
+            }
+        }
+        if (ok) {
+            if (!data.Read("CRCOffset", crcOffset)) {
+                crcOffset = frameSize - crcSize;
+            }
+            ok = ((crcOffset + crcSize) <= frameSize);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The CRC field (CRCOffset = %u) shall be within the frame (FrameSize = %u)", crcOffset, frameSize);
+            }
+        }
+        if (ok) {
+            if (!data.Read("StopOnError", stopOnError)) {
+                stopOnError = 0u;
+            }
+            if (stopOnError > 1u) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "StopOnError option value must be 0 or 1. Now StopOnError = %d", stopOnError);
+                ok = false;
+            }
+        }
+    }
     if (!ok) {
         REPORT_ERROR(ErrorManagement::InitialisationError, "Error during Initialise.");
     }
@@ -99,17 +228,29 @@ bool CRCGAM::Setup() {
         REPORT_ERROR(ErrorManagement::InitialisationError, "CRCGAM must have at least 1 input signal.");
         ok = false;
     }
-    //The number of Output signals must be equal to 1.
+    //The number of Output signals must be equal to 1 (2 when verifying frames).
     if (ok) {
         uint32 nOutputSignals;
         nOutputSignals = GetNumberOfOutputSignals();
-        if (nOutputSignals != 1u) {
+        if (verify == 1u) {
+            if ((nInputSignals != 1u) || (nOutputSignals != 2u)) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Verify requires one input signal and two output signals. The current values are %u and %u",
+                             nInputSignals, nOutputSignals);
+                ok = false;
+            }
+        }
+        else if (nOutputSignals != 1u) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "nOutputSignals must be one. The current values is %u", nOutputSignals);
             ok = false;
         }
+        else {
+            //One output signal with the CRC.
+        }
     }
     //The inputSize must be taken from InputSignals
     if (ok) {
+        inputSignalsData = new uint8*[nInputSignals];
+        inputSignalsSize = new uint32[nInputSignals];
         uint32 n;
         for (n = 0u; (n < GetNumberOfInputSignals()) && (ok); n++) {
             uint32 inByteSize = 0u;
@@ -124,6 +265,8 @@ bool CRCGAM::Setup() {
             if (ok) {
                 inByteSize *= inSamples;
                 inputSize += inByteSize;
+                inputSignalsSize[n] = inByteSize;
+                inputSignalsData[n] = reinterpret_cast<uint8*>(GetInputSignalMemory(n));
             }
             else {
                 REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting Signal number of samples from InputSignals.");
@@ -131,37 +274,82 @@ bool CRCGAM::Setup() {
         }
     }
     //The output type must be a supported type.
-    if (ok) {
+    if ((ok) && (verify == 0u)) {
         outputSignalType = GetSignalType(OutputSignals, 0u);
-        if (outputSignalType == UnsignedInteger8Bit) {
-            crcHelper = new CRCHelperT<uint8>();
-            crcHelper->ComputeTable(&polynomial);
-            REPORT_ERROR(ErrorManagement::Information, "Table computed!");
-            outputData = reinterpret_cast<uint8*>(GetOutputSignalMemory(0u));
-        }
-        else if (outputSignalType == UnsignedInteger16Bit) {
-            crcHelper = new CRCHelperT<uint16>();
-            crcHelper->ComputeTable(&polynomial);
-            REPORT_ERROR(ErrorManagement::Information, "Table computed!");
-            outputData = reinterpret_cast<uint16*>(GetOutputSignalMemory(0u));
-        }
-        else if (outputSignalType == UnsignedInteger32Bit) {
-            crcHelper = new CRCHelperT<uint32>();
-            crcHelper->ComputeTable(&polynomial);
-            REPORT_ERROR(ErrorManagement::Information, "Table computed!");
-            outputData = reinterpret_cast<uint32*>(GetOutputSignalMemory(0u));
+        ok = CreateHelper(outputSignalType);
+        if (ok) {
+            outputData = GetOutputSignalMemory(0u);
         }
         else {
             const char8 * const outputSignalTypeStr = TypeDescriptor::GetTypeNameFromTypeDescriptor(outputSignalType);
             REPORT_ERROR(ErrorManagement::InitialisationError, "The output signal type is %s which is not a supported type. "
                          "It must be uint8, uint16, uint32.",
                          outputSignalTypeStr);
-            ok = false;
+        }
+    }
+    //The input signal must hold whole frames, with one bit of the bitmask for each frame.
+    if ((ok) && (verify == 1u)) {
+        ok = ((inputSize % frameSize) == 0u);
+        if (ok) {
+            numberOfFrames = (inputSize / frameSize);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The input signal size (%u) must be a multiple of FrameSize (%u)", inputSize, frameSize);
+        }
+        if (ok) {
+            validMaskType = GetSignalType(OutputSignals, 0u);
+            ok = ((validMaskType == UnsignedInteger8Bit) || (validMaskType == UnsignedInteger16Bit) || (validMaskType == UnsignedInteger32Bit)
+                    || (validMaskType == UnsignedInteger64Bit));
+            if (ok) {
+                ok = (numberOfFrames <= static_cast<uint32>(validMaskType.numberOfBits));
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The first output signal must be an unsigned integer with at least %u bits", numberOfFrames);
+            }
+        }
+        if (ok) {
+            ok = (GetSignalType(OutputSignals, 1u) == UnsignedInteger32Bit);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The second output signal must be uint32");
+            }
+        }
+        if (ok) {
+            ok = CreateHelper(outputSignalType);
+        }
+        if (ok) {
+            validMaskData = GetOutputSignalMemory(0u);
+            invalidFramesData = reinterpret_cast<uint32 *>(GetOutputSignalMemory(1u));
+            *invalidFramesData = 0u;
         }
     }
     if (ok) {
         inputData = reinterpret_cast<uint8*>(GetInputSignalsMemory());
     }
+    //Each input signal must be the CRC of a block
+    if ((ok) && (combineCRCs == 1u)) {
+        ok = (numberOfBlockSizes == nInputSignals);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The number of BlockSizes (%u) must be equal to the number of input signals (%u)", numberOfBlockSizes,
+                         nInputSignals);
+        }
+        uint32 n;
+        for (n = 0u; (n < nInputSignals) && (ok); n++) {
+            ok = (GetSignalType(InputSignals, n) == outputSignalType);
+            if (ok) {
+                ok = (inputSignalsSize[n] == (static_cast<uint32>(outputSignalType.numberOfBits) / 8u));
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The input signal %u must be one CRC with the type of the output signal", n);
+            }
+        }
+        if (ok) {
+            zerosOperators = new uint32[nInputSignals * crcOperatorSize];
+            for (n = 0u; n < nInputSignals; n++) {
+                /*lint -e{613} crcHelper cannot be NULL as otherwise ok would be false*/
+                crcHelper->ComputeZerosOperator(blockSizes[n], &zerosOperators[n * crcOperatorSize]);
+            }
+        }
+    }
     if (!ok) {
         REPORT_ERROR(ErrorManagement::InitialisationError, "Error during GAM Setup.");
     }
@@ -176,12 +364,99 @@ bool CRCGAM::Execute() {
     }
 
     if (crcHelper != NULL_PTR(CRCHelper *)) {
-        crcHelper->Compute(inputData, static_cast<int32>(inputSize), &initialCRCValue, inv, outputData);
+        uint32 nInputSignals = GetNumberOfInputSignals();
+        if (verify == 1u) {
+            VerifyFrames();
+        }
+        else if (combineCRCs == 1u) {
+            uint32 outputSize = (static_cast<uint32>(outputSignalType.numberOfBits) / 8u);
+            (void) MemoryOperationsHelper::Copy(outputData, inputSignalsData[0], outputSize);
+            for (uint32 n = 1u; n < nInputSignals; n++) {
+                crcHelper->Combine(&zerosOperators[n * crcOperatorSize], outputData, inputSignalsData[n], &initialCRCValue);
+            }
+        }
+        else if (inv) {
+            crcHelper->Compute(inputData, static_cast<int32>(inputSize), &initialCRCValue, inv, outputData);
+        }
+        else {
+            //Chain the CRC over the signals
+            crcHelper->Compute(inputSignalsData[0], static_cast<int32>(inputSignalsSize[0]), &initialCRCValue, false, outputData);
+            for (uint32 n = 1u; n < nInputSignals; n++) {
+                crcHelper->Compute(inputSignalsData[n], static_cast<int32>(inputSignalsSize[n]), outputData, false, outputData);
+            }
+        }
     }
 
     return true;
 }
 
+bool CRCGAM::CreateHelper(const TypeDescriptor &crcType) {
+    bool ok = true;
+    bool reflected = (reflectedInput == 1u);
+    if (crcType == UnsignedInteger8Bit) {
+        crcHelper = new CRCSlicingHelperT<uint8>(reflected);
+        crcHelper->ComputeTable(&polynomial);
+        REPORT_ERROR(ErrorManagement::Information, "Table computed!");
+    }
+    else if (crcType == UnsignedInteger16Bit) {
+        crcHelper = new CRCSlicingHelperT<uint16>(reflected);
+        crcHelper->ComputeTable(&polynomial);
+        REPORT_ERROR(ErrorManagement::Information, "Table computed!");
+    }
+    else if (crcType == UnsignedInteger32Bit) {
+        if ((reflected) && (polynomial == crc32cPolynomial) && (CRC32CHelper::IsSupported())) {
+            crcHelper = new CRC32CHelper();
+            REPORT_ERROR(ErrorManagement::Information, "Using the SSE4.2 crc32 instruction for the CRC-32C");
+        }
+        else {
+            crcHelper = new CRCSlicingHelperT<uint32>(reflected);
+            crcHelper->ComputeTable(&polynomial);
+            REPORT_ERROR(ErrorManagement::Information, "Table computed!");
+        }
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+
+void CRCGAM::VerifyFrames() {
+    uint64 validMask = 0u;
+    uint32 afterCRCOffset = (crcOffset + crcSize);
+    uint32 afterCRCSize = (frameSize - afterCRCOffset);
+    bool stop = false;
+    uint32 n;
+    for (n = 0u; (n < numberOfFrames) && (!stop); n++) {
+        const uint8 * const frame = &inputData[n * frameSize];
+        //Large enough for any CRC type and aligned for the CRCHelper.
+        uint32 crc = 0u;
+        /*lint -e{613} crcHelper cannot be NULL (checked by Execute)*/
+        crcHelper->Compute(frame, static_cast<int32>(crcOffset), &initialCRCValue, false, &crc);
+        if (afterCRCSize > 0u) {
+            crcHelper->Compute(&frame[afterCRCOffset], static_cast<int32>(afterCRCSize), &crc, false, &crc);
+        }
+        if (MemoryOperationsHelper::Compare(&crc, &frame[crcOffset], crcSize) == 0) {
+            validMask |= (static_cast<uint64>(1u) << n);
+        }
+        else {
+            (*invalidFramesData)++;
+            stop = (stopOnError == 1u);
+        }
+    }
+    if (validMaskType == UnsignedInteger8Bit) {
+        *reinterpret_cast<uint8 *>(validMaskData) = static_cast<uint8>(validMask);
+    }
+    else if (validMaskType == UnsignedInteger16Bit) {
+        *reinterpret_cast<uint16 *>(validMaskData) = static_cast<uint16>(validMask);
+    }
+    else if (validMaskType == UnsignedInteger32Bit) {
+        *reinterpret_cast<uint32 *>(validMaskData) = static_cast<uint32>(validMask);
+    }
+    else {
+        *reinterpret_cast<uint64 *>(validMaskData) = validMask;
+    }
+}
+
 CLASS_REGISTER(CRCGAM, "1.0")
 }
 
@@ -31,7 +31,8 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
-#include "CRCHelperT.h"
+#include "CRC32CHelper.h"
+#include "CRCSlicingHelperT.h"
 #include "GAM.h"
 
 /*---------------------------------------------------------------------------*/
@@ -46,13 +47,39 @@ namespace MARTe {
  * @details This GAM computes a CRC checksum on the InputSignals memory area and returns it on the output signal.
  * Output types supported are: uint8 - uint16 - uint32.
  *
+ * When there is more than one input signal the CRC is computed over all the input signals in the order
+ * of declaration, chaining the CRC of each signal as the initial value of the next one, i.e. the result
+ * is the CRC of the concatenation of the signals (e.g. the fields of a packet), without copying them in a
+ * single array.
+ *
+ * If CombineCRCs = 1 each input signal is instead the CRC (same type of the output signal) of a block of data,
+ * computed with the same Polynomial, InitialValue and Reflected options, and the output is the CRC of the
+ * concatenation of the blocks, computed without accessing the data (see CRCHelper::Combine()). The size of each
+ * block (in bytes) is given in BlockSizes, with one element per input signal. The Inverted option must be 0.
+ *
  * The configuration setup must include:
  * - The divisor Polynomial with (n+1) bits for the CRC-n type chosen.
  *   Common values for polynomial are: 0x7 (uint8), 0x1021 (uint16), 0x4C11DB7 (uint32).
  * - The initial CRC value.
  * - The Inverted option: 1 is you want the CRC checksum reflected, 0 otherwise.
+ * - Optionally the Reflected option: 1 if the bits of each byte are processed starting from the least significant one
+ *   (and the polynomial is bit-reversed), as in the CRC-32 of Ethernet/zlib (Polynomial = 0x4C11DB7) or in the
+ *   CRC-32C (Polynomial = 0x1EDC6F41). Default is 0, i.e. the most significant bit first. No final xor is applied.
+ *
+ * The CRC is computed eight bytes at a time with the slicing-by-8 algorithm (see CRCSlicingHelperT). If the CRC is the
+ * reflected uint32 CRC-32C and the CPU supports SSE4.2 the crc32 instruction is used instead (see CRC32CHelper).
+ * The implementation is chosen in Setup().
  *
- * The number of OutputSignals must be equal to 1.
+ * The number of OutputSignals must be equal to 1 (2 if Verify = 1).
+ *
+ * If Verify = 1 the GAM checks a batch of frames (e.g. the packets received in the cycle by a UDPReceiver with an array signal),
+ * instead of computing a CRC. The only input signal holds the frames one after the other, each one FrameSize bytes long and with its
+ * CRC (CRCType, in the byte order of the host) at the byte CRCOffset of the frame (default: the last bytes of the frame). The CRC of each
+ * frame is computed over all the bytes of the frame which are not the CRC field and is compared with the field, frame after frame, in the
+ * same pass. The first output signal is the bitmask of the valid frames (bit n set if the frame n is valid) and shall be an unsigned integer
+ * with at least one bit for each frame (i.e. at most 64 frames). The second output signal (uint32) counts the invalid frames since the start.
+ * If StopOnError = 1 the check stops at the first invalid frame: the following frames are not checked and are reported as not valid
+ * (but are not counted as errors). Verify = 1 requires Inverted = 0 and CombineCRCs = 0.
  *
  * The configuration syntax is (names and signal quantities are only given as an example):
  * <pre>
@@ -61,6 +88,14 @@ namespace MARTe {
  *     Polynomial = 0x1021
  *     InitialValue = 0x0
  *     Inverted = 0
+ *     Reflected = 0 //Optional
+ *     CombineCRCs = 0 //Optional. If 1 the input signals are the CRCs of blocks with BlockSizes bytes
+ *     BlockSizes = {1024 1024} //Compulsory if CombineCRCs = 1
+ *     Verify = 0 //Optional. If 1 the input signal holds frames with an embedded CRC, which are checked
+ *     CRCType = uint16 //Compulsory if Verify = 1. uint8, uint16 or uint32
+ *     FrameSize = 64 //Compulsory if Verify = 1. Size of each frame in bytes (the input signal size shall be a multiple)
+ *     CRCOffset = 62 //Optional, only if Verify = 1. Default = FrameSize - size of CRCType
+ *     StopOnError = 0 //Optional, only if Verify = 1. If 1 stop checking the frames at the first invalid one
  *     InputSignals = {
  *         InputArea = {
  *             DataSource = DDB1
@@ -74,6 +109,20 @@ namespace MARTe {
  *     }
  * }
  *</pre>
+ *
+ * With Verify = 1 the OutputSignals are:
+ * <pre>
+ *     OutputSignals = {
+ *         ValidFrames = {
+ *             DataSource = DDB1
+ *             Type = uint32 //At least one bit for each frame
+ *         }
+ *         InvalidFrames = {
+ *             DataSource = DDB1
+ *             Type = uint32
+ *         }
+ *     }
+ *</pre>
  */
 
 class CRCGAM: public GAM {
@@ -86,33 +135,52 @@ public:
 CRCGAM    ();
 
     /**
-     * @brief Default Destructor. NOOP.
+     * @brief Default Destructor. Deletes the CRCHelper.
      */
     virtual ~CRCGAM();
 
     /**
      * @brief see GAM::Initialise.
-     * @details Stores the GAM configuration in order to read Polynomial, InitialValue and Inverted option.
+     * @details Stores the GAM configuration in order to read Polynomial, InitialValue, Inverted, Reflected, CombineCRCs,
+     * BlockSizes, Verify, CRCType, FrameSize, CRCOffset and StopOnError options.
      */
     virtual bool Initialise(StructuredDataI &data);
 
     /**
      * @brief Verifies the correctness of the GAM configuration.
-     * @details Retrieves byte size of input signals, computes the table from the polynomial and checks that the rules below are met.
+     * @details Retrieves byte size of input signals, selects the CRC implementation, computes the tables from the polynomial
+     * and checks that the rules below are met.
      * @return true if all the preconditions are met.
      * @pre
      *     GetNumberOfOutputSignals() == 1 &&
-     *     GetSignalType(OutputSignals, 0u) == uint8 or uint16 or uint32
+     *     GetSignalType(OutputSignals, 0u) == uint8 or uint16 or uint32 &&
+     *     (Verify == 1 => (GetNumberOfInputSignals() == 1 && GetNumberOfOutputSignals() == 2 &&
+     *                     the input signal size is a multiple of FrameSize &&
+     *                     the bitmask output signal has at least one bit for each frame &&
+     *                     GetSignalType(OutputSignals, 1u) == uint32)) &&
+     *     CombineCRCs == 1 => (number of BlockSizes == GetNumberOfInputSignals() &&
+     *                          each input signal has the type of the output signal and one element)
      */
     virtual bool Setup();
 
     /**
-     * @brief Computes the CRC checksum from the stored data.
+     * @brief Computes the CRC checksum from the stored data (or checks the frames if Verify = 1).
      */
     virtual bool Execute();
 
 private:
 
+    /**
+     * @brief Creates the CRCHelper for the CRC type \a crcType.
+     * @return true if \a crcType is uint8, uint16 or uint32.
+     */
+    bool CreateHelper(const TypeDescriptor &crcType);
+
+    /**
+     * @brief Checks the frames against their embedded CRCs and updates the bitmask and the error counter.
+     */
+    void VerifyFrames();
+
     /**
      * Memory of the CRCGAM input signals.
      */
@@ -144,7 +212,7 @@ private:
     uint32 inputSize;
 
     /**
-     * TypeDescriptor for the out signal type.
+     * TypeDescriptor for the out signal type (the CRCType if verify == 1).
      */
     TypeDescriptor outputSignalType;
 
@@ -153,6 +221,87 @@ private:
      */
     uint8 isReflected;
 
+    /**
+     * Flag for the least significant bit first processing of the bytes.
+     */
+    uint8 reflectedInput;
+
+    /**
+     * Flag for the combination of the CRCs of the input signals.
+     */
+    uint8 combineCRCs;
+
+    /**
+     * Memory of each input signal.
+     */
+    uint8 ** inputSignalsData;
+
+    /**
+     * Byte size of each input signal.
+     */
+    uint32 * inputSignalsSize;
+
+    /**
+     * Size of the blocks whose CRCs are combined when combineCRCs == 1.
+     */
+    uint32 * blockSizes;
+
+    /**
+     * Number of elements of blockSizes.
+     */
+    uint32 numberOfBlockSizes;
+
+    /**
+     * Operators (crcOperatorSize elements for each input signal) that feed the size of each block of zero bytes
+     * into the CRC register, used when combineCRCs == 1.
+     */
+    uint32 * zerosOperators;
+
+    /**
+     * Flag for the verification of the frames with an embedded CRC.
+     */
+    uint8 verify;
+
+    /**
+     * Flag to stop the verification at the first invalid frame.
+     */
+    uint8 stopOnError;
+
+    /**
+     * Size of each frame, when verify == 1.
+     */
+    uint32 frameSize;
+
+    /**
+     * Offset of the CRC field in each frame, when verify == 1.
+     */
+    uint32 crcOffset;
+
+    /**
+     * Number of frames in the input signal, when verify == 1.
+     */
+    uint32 numberOfFrames;
+
+    /**
+     * Size of the CRC in bytes.
+     */
+    uint32 crcSize;
+
+    /**
+     * Memory of the bitmask of the valid frames, when verify == 1.
+     */
+    void * validMaskData;
+
+    /**
+     * Type of the bitmask of the valid frames.
+     */
+    TypeDescriptor validMaskType;
+
+    /**
+     * Memory of the counter of the invalid frames, when verify == 1.
+     */
+    uint32 * invalidFramesData;
+
 };
 
 }
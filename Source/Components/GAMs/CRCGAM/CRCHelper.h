@@ -38,8 +38,16 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * Number of columns of the operators of CRCHelper::ComputeZerosOperator (one for each bit of a CRC up to 32 bits).
+ */
+static const uint32 crcOperatorSize = 32u;
+
 /**
  * @brief Helper class to compute the CRC.
+ * @details The CRC of the concatenation of two blocks can be computed from the CRCs of the blocks (see Combine()):
+ * the CRC is linear in the initial value, so that crc(init, A + B) = Z(crc(init, A) xor init) xor crc(init, B),
+ * where Z is the (linear) operator that feeds as many zero bytes as the size of B into the CRC register.
  */
 class CRCHelper {
 public:
@@ -68,6 +76,49 @@ public:
      */
     virtual void Compute(const uint8 * const data, int32 const size, void * const initCRC, bool const inputInverted, void * const retVal) = 0;
 
+    /**
+     * @brief To be specialised by CRCHelperT for all the supported types.
+     * @details Computes the operator that feeds \a numberOfBytes zero bytes into the CRC register.
+     * @param[in] numberOfBytes the number of zero bytes.
+     * @param[out] op the operator (crcOperatorSize elements), where op[j] is the CRC register obtained from the register with only the bit j set.
+     * @pre
+     *   ComputeTable()
+     */
+    virtual void ComputeZerosOperator(const uint32 numberOfBytes, uint32 * const op) = 0;
+
+    /**
+     * @brief To be specialised by CRCHelperT for all the supported types.
+     * @details Computes the CRC of the concatenation of two blocks from their CRCs.
+     * @param[in] op the operator computed with ComputeZerosOperator() for the size of the second block.
+     * @param[in,out] crcValue the CRC of the first block, replaced by the CRC of the concatenation.
+     * @param[in] nextCRC the CRC of the second block.
+     * @param[in] initCRC the initial CRC value used to compute both CRCs.
+     */
+    virtual void Combine(const uint32 * const op, void * const crcValue, const void * const nextCRC, const void * const initCRC) = 0;
+
+protected:
+
+    /**
+     * @brief Implementation of ComputeZerosOperator() for the CRC type T, based on Compute().
+     * @details The operator of one zero byte is squared log2(numberOfBytes) times.
+     */
+    template<typename T>
+    void ComputeZerosOperatorT(const uint32 numberOfBytes, uint32 * const op);
+
+    /**
+     * @brief Implementation of Combine() for the CRC type T.
+     */
+    template<typename T>
+    static void CombineT(const uint32 * const op, void * const crcValue, const void * const nextCRC, const void * const initCRC);
+
+    /**
+     * @brief Applies an operator computed with ComputeZerosOperator() to a CRC register.
+     * @param[in] op the operator.
+     * @param[in] value the CRC register.
+     * @return the transformed CRC register.
+     */
+    static inline uint32 ApplyOperator(const uint32 * const op, const uint32 value);
+
 };
 }
 
@@ -76,6 +127,65 @@ public:
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+uint32 CRCHelper::ApplyOperator(const uint32 * const op, const uint32 value) {
+    uint32 ret = 0u;
+    for (uint32 j = 0u; j < crcOperatorSize; j++) {
+        if (((value >> j) & 1u) != 0u) {
+            ret ^= op[j];
+        }
+    }
+    return ret;
+}
+
+/*lint -esym(9107, MARTe::CRCHelper::*T*) [MISRA C++ Rule 3-1-1] required for template implementation*/
+template<typename T>
+void CRCHelper::ComputeZerosOperatorT(const uint32 numberOfBytes, uint32 * const op) {
+    const uint32 width = static_cast<uint32>(sizeof(T) * 8u);
+    uint32 power[crcOperatorSize];
+    uint32 square[crcOperatorSize];
+    const uint8 zero = 0u;
+    uint32 j;
+    for (j = 0u; j < crcOperatorSize; j++) {
+        power[j] = 0u;
+        op[j] = 0u;
+        if (j < width) {
+            T bit = static_cast<T>(static_cast<T>(1u) << j);
+            T ret = 0u;
+            Compute(&zero, 1, &bit, false, &ret);
+            power[j] = static_cast<uint32>(ret);
+            op[j] = (1u << j);
+        }
+    }
+    /* op = power^numberOfBytes, with power = (one zero byte)^(2^k) */
+    uint32 n = numberOfBytes;
+    while (n > 0u) {
+        if ((n & 1u) != 0u) {
+            for (j = 0u; j < crcOperatorSize; j++) {
+                op[j] = ApplyOperator(&power[0], op[j]);
+            }
+        }
+        n >>= 1u;
+        if (n > 0u) {
+            for (j = 0u; j < crcOperatorSize; j++) {
+                square[j] = ApplyOperator(&power[0], power[j]);
+            }
+            for (j = 0u; j < crcOperatorSize; j++) {
+                power[j] = square[j];
+            }
+        }
+    }
+}
+
+template<typename T>
+void CRCHelper::CombineT(const uint32 * const op, void * const crcValue, const void * const nextCRC, const void * const initCRC) {
+    uint32 value = static_cast<uint32>(*static_cast<T*>(crcValue)) ^ static_cast<uint32>(*static_cast<const T*>(initCRC));
+    value = ApplyOperator(op, value) ^ static_cast<uint32>(*static_cast<const T*>(nextCRC));
+    *static_cast<T*>(crcValue) = static_cast<T>(value);
+}
+
+}
 
 #endif /* SOURCE_COMPONENTS_GAMS_CRCGAM_CRCHELPER_H_ */
 	
@@ -64,6 +64,20 @@ public:
      */
     virtual void Compute(const uint8 * const data, int32 const size, void * const initCRC, bool const inputInverted, void * const retVal);
 
+    /**
+     * @see CRCHelper::ComputeZerosOperator
+     */
+    virtual void ComputeZerosOperator(const uint32 numberOfBytes,
+                                      uint32 * const op);
+
+    /**
+     * @see CRCHelper::Combine
+     */
+    virtual void Combine(const uint32 * const op,
+                         void * const crcValue,
+                         const void * const nextCRC,
+                         const void * const initCRC);
+
 private:
 
     /**
@@ -92,6 +106,21 @@ void CRCHelperT<T>::Compute(const uint8 * const data, int32 const size, void * c
     }
 }
 
+
+template<typename T>
+void CRCHelperT<T>::ComputeZerosOperator(const uint32 numberOfBytes,
+                                         uint32 * const op) {
+    ComputeZerosOperatorT<T>(numberOfBytes, op);
+}
+
+template<typename T>
+void CRCHelperT<T>::Combine(const uint32 * const op,
+                            void * const crcValue,
+                            const void * const nextCRC,
+                            const void * const initCRC) {
+    CombineT<T>(op, crcValue, nextCRC, initCRC);
+}
+
 }
 
 #endif /* SOURCE_COMPONENTS_GAMS_CRCGAM_CRCHELPERT_H_ */
@@ -0,0 +1,327 @@
+/**
+ * @file CRCSlicingHelperT.h
+ * @brief Header file for class CRCSlicingHelperT
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CRCSlicingHelperT
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_COMPONENTS_GAMS_CRCGAM_CRCSLICINGHELPERT_H_
+#define SOURCE_COMPONENTS_GAMS_CRCGAM_CRCSLICINGHELPERT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CRC.h"
+/*lint -efile(766,CRCSlicingHelperT.h) CRCHelper.h are used in this file*/
+#include "CRCHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Number of lookup tables (i.e. of bytes processed per step) of the slicing algorithm.
+ */
+static const uint32 crcSlicingNumberOfTables = 8u;
+
+/**
+ * @brief Helper class to compute the CRC eight bytes at a time (slicing-by-8).
+ * @details Eight lookup tables of 256 entries are computed from the polynomial, where the table k holds the
+ * CRC of a byte followed by k zero bytes, so that the CRC of eight bytes is the xor of eight table lookups instead
+ * of eight dependent byte steps.
+ *
+ * The CRC is computed in a 32-bit register for all the output types T (the register of the uint8 and uint16 CRCs
+ * is aligned to the most significant bits when the input is not reflected and to the least significant bits
+ * otherwise), so that the same kernel serves all the CRC widths.
+ *
+ * If the input is not reflected the result is the same of CRC<T> (i.e. of CRCHelperT), the most significant bit of
+ * each byte being processed first. If the input is reflected the least significant bit of each byte is processed first
+ * and the polynomial is bit-reversed (e.g. as in the CRC-32 of Ethernet/zlib or in the CRC-32C of iSCSI/SCTP).
+ *
+ * The bytes traversed in reverse order (inputInverted) are processed one at a time.
+ */
+template<typename T>
+class CRCSlicingHelperT: public CRCHelper {
+public:
+    /**
+     * @brief Constructor.
+     * @param[in] reflectedIn true if the input (and the result) are reflected.
+     */
+    CRCSlicingHelperT(const bool reflectedIn = false);
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~CRCSlicingHelperT();
+
+    /**
+     * @see CRCHelper::ComputeTable
+     * @details A cast to the declared output type is performed. Computes the crcSlicingNumberOfTables tables.
+     */
+    virtual void ComputeTable(void * const pol);
+
+    /**
+     * @see CRCHelper::Compute
+     * @details A cast to the declared output type is performed.
+     */
+    virtual void Compute(const uint8 * const data,
+                         int32 const size,
+                         void * const initCRC,
+                         bool const inputInverted,
+                         void * const retVal);
+
+    /**
+     * @see CRCHelper::ComputeZerosOperator
+     */
+    virtual void ComputeZerosOperator(const uint32 numberOfBytes,
+                                      uint32 * const op);
+
+    /**
+     * @see CRCHelper::Combine
+     */
+    virtual void Combine(const uint32 * const op,
+                         void * const crcValue,
+                         const void * const nextCRC,
+                         const void * const initCRC);
+
+    /**
+     * @brief Checks if the input is reflected.
+     * @return true if the input is reflected.
+     */
+    bool IsReflected() const;
+
+private:
+
+    /**
+     * @brief Computes the CRC with the most significant bit first.
+     * @param[in] data the bytes.
+     * @param[in] size the number of bytes.
+     * @param[in] reg the initial value of the register (aligned to the most significant bits).
+     * @return the register (aligned to the most significant bits).
+     */
+    uint32 ComputeNormal(const uint8 * const data,
+                         const uint32 size,
+                         uint32 reg) const;
+
+    /**
+     * @brief Computes the CRC with the least significant bit first.
+     * @param[in] data the bytes.
+     * @param[in] size the number of bytes.
+     * @param[in] reg the initial value of the register.
+     * @return the register.
+     */
+    uint32 ComputeReflected(const uint8 * const data,
+                            const uint32 size,
+                            uint32 reg) const;
+
+    /**
+     * True if the input is reflected.
+     */
+    bool reflected;
+
+    /**
+     * The number of bits to align the register of the CRC to the most significant bits (32 - CRC width).
+     */
+    uint32 alignShift;
+
+    /**
+     * The lookup tables.
+     */
+    uint32 tables[crcSlicingNumberOfTables][256u];
+
+    /**
+     * Byte at a time CRC, used for the bytes traversed in reverse order without reflection.
+     */
+    CRC<T> crc;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/*lint -esym(9107, MARTe::CRCSlicingHelperT*) [MISRA C++ Rule 3-1-1] required for template implementation*/
+template<typename T>
+CRCSlicingHelperT<T>::CRCSlicingHelperT(const bool reflectedIn) :
+        CRCHelper() {
+    reflected = reflectedIn;
+    alignShift = (32u - static_cast<uint32>(sizeof(T) * 8u));
+    for (uint32 k = 0u; k < crcSlicingNumberOfTables; k++) {
+        for (uint32 b = 0u; b < 256u; b++) {
+            tables[k][b] = 0u;
+        }
+    }
+}
+
+template<typename T>
+CRCSlicingHelperT<T>::~CRCSlicingHelperT() {
+
+}
+
+template<typename T>
+bool CRCSlicingHelperT<T>::IsReflected() const {
+    return reflected;
+}
+
+template<typename T>
+void CRCSlicingHelperT<T>::ComputeTable(void * const pol) {
+    T polynomial = *static_cast<T*>(pol);
+    crc.ComputeTable(polynomial);
+    const uint32 width = static_cast<uint32>(sizeof(T) * 8u);
+    uint32 b;
+    if (reflected) {
+        uint32 reversed = 0u;
+        for (b = 0u; b < width; b++) {
+            if (((static_cast<uint32>(polynomial) >> b) & 1u) != 0u) {
+                reversed |= (1u << ((width - 1u) - b));
+            }
+        }
+        for (b = 0u; b < 256u; b++) {
+            uint32 reg = b;
+            for (uint32 bit = 0u; bit < 8u; bit++) {
+                reg = ((reg & 1u) != 0u) ? ((reg >> 1u) ^ reversed) : (reg >> 1u);
+            }
+            tables[0u][b] = reg;
+        }
+        for (uint32 k = 1u; k < crcSlicingNumberOfTables; k++) {
+            for (b = 0u; b < 256u; b++) {
+                uint32 previous = tables[k - 1u][b];
+                tables[k][b] = (previous >> 8u) ^ tables[0u][previous & 0xFFu];
+            }
+        }
+    }
+    else {
+        uint32 alignedPolynomial = (static_cast<uint32>(polynomial) << alignShift);
+        for (b = 0u; b < 256u; b++) {
+            uint32 reg = (b << 24u);
+            for (uint32 bit = 0u; bit < 8u; bit++) {
+                reg = ((reg & 0x80000000u) != 0u) ? ((reg << 1u) ^ alignedPolynomial) : (reg << 1u);
+            }
+            tables[0u][b] = reg;
+        }
+        for (uint32 k = 1u; k < crcSlicingNumberOfTables; k++) {
+            for (b = 0u; b < 256u; b++) {
+                uint32 previous = tables[k - 1u][b];
+                tables[k][b] = (previous << 8u) ^ tables[0u][previous >> 24u];
+            }
+        }
+    }
+}
+
+template<typename T>
+uint32 CRCSlicingHelperT<T>::ComputeNormal(const uint8 * const data,
+                                           const uint32 size,
+                                           uint32 reg) const {
+    uint32 i = 0u;
+    const uint32 nBlocks = (size / 8u);
+    for (uint32 n = 0u; n < nBlocks; n++) {
+        /* The bytes are assembled explicitly so that the result does not depend on the endianness or alignment */
+        uint32 high = reg ^ ((static_cast<uint32>(data[i]) << 24u) | (static_cast<uint32>(data[i + 1u]) << 16u) | (static_cast<uint32>(data[i + 2u]) << 8u)
+                | static_cast<uint32>(data[i + 3u]));
+        reg = tables[7u][high >> 24u] ^ tables[6u][(high >> 16u) & 0xFFu] ^ tables[5u][(high >> 8u) & 0xFFu] ^ tables[4u][high & 0xFFu]
+                ^ tables[3u][data[i + 4u]] ^ tables[2u][data[i + 5u]] ^ tables[1u][data[i + 6u]] ^ tables[0u][data[i + 7u]];
+        i += 8u;
+    }
+    for (; i < size; i++) {
+        reg = (reg << 8u) ^ tables[0u][(reg >> 24u) ^ static_cast<uint32>(data[i])];
+    }
+    return reg;
+}
+
+template<typename T>
+uint32 CRCSlicingHelperT<T>::ComputeReflected(const uint8 * const data,
+                                              const uint32 size,
+                                              uint32 reg) const {
+    uint32 i = 0u;
+    const uint32 nBlocks = (size / 8u);
+    for (uint32 n = 0u; n < nBlocks; n++) {
+        uint32 low = reg ^ (static_cast<uint32>(data[i]) | (static_cast<uint32>(data[i + 1u]) << 8u) | (static_cast<uint32>(data[i + 2u]) << 16u)
+                | (static_cast<uint32>(data[i + 3u]) << 24u));
+        reg = tables[7u][low & 0xFFu] ^ tables[6u][(low >> 8u) & 0xFFu] ^ tables[5u][(low >> 16u) & 0xFFu] ^ tables[4u][low >> 24u]
+                ^ tables[3u][data[i + 4u]] ^ tables[2u][data[i + 5u]] ^ tables[1u][data[i + 6u]] ^ tables[0u][data[i + 7u]];
+        i += 8u;
+    }
+    for (; i < size; i++) {
+        reg = (reg >> 8u) ^ tables[0u][(reg ^ static_cast<uint32>(data[i])) & 0xFFu];
+    }
+    return reg;
+}
+
+template<typename T>
+void CRCSlicingHelperT<T>::Compute(const uint8 * const data,
+                                   int32 const size,
+                                   void * const initCRC,
+                                   bool const inputInverted,
+                                   void * const retVal) {
+    T crcValue = *static_cast<T*>(initCRC);
+    if (size > 0) {
+        if (!reflected) {
+            if (inputInverted) {
+                crcValue = crc.Compute(data, size, crcValue, inputInverted);
+            }
+            else {
+                uint32 reg = ComputeNormal(data, static_cast<uint32>(size), (static_cast<uint32>(crcValue) << alignShift));
+                crcValue = static_cast<T>(reg >> alignShift);
+            }
+        }
+        else {
+            uint32 reg = static_cast<uint32>(crcValue);
+            if (inputInverted) {
+                /*lint -e{9016} the bytes are traversed in reverse order as documented in CRCHelper::Compute*/
+                const uint8 *ptr = data;
+                for (int32 i = 0; i < size; i++) {
+                    reg = (reg >> 8u) ^ tables[0u][(reg ^ static_cast<uint32>(*ptr)) & 0xFFu];
+                    ptr--;
+                }
+            }
+            else {
+                reg = ComputeReflected(data, static_cast<uint32>(size), reg);
+            }
+            crcValue = static_cast<T>(reg);
+        }
+    }
+    if (retVal != NULL_PTR(void *)) {
+        *static_cast<T*>(retVal) = crcValue;
+    }
+}
+
+
+template<typename T>
+void CRCSlicingHelperT<T>::ComputeZerosOperator(const uint32 numberOfBytes,
+                                                uint32 * const op) {
+    ComputeZerosOperatorT<T>(numberOfBytes, op);
+}
+
+template<typename T>
+void CRCSlicingHelperT<T>::Combine(const uint32 * const op,
+                                   void * const crcValue,
+                                   const void * const nextCRC,
+                                   const void * const initCRC) {
+    CombineT<T>(op, crcValue, nextCRC, initCRC);
+}
+
+}
+
+#endif /* SOURCE_COMPONENTS_GAMS_CRCGAM_CRCSLICINGHELPERT_H_ */
@@ -32,6 +32,7 @@
 #include "AdvancedErrorManagement.h"
 #include "CLASSMETHODREGISTER.h"
 #include "ConstantGAM.h"
+#include "MemoryOperationsHelper.h"
 #include "RegisteredMethodsMessageFilter.h"
 
 /*---------------------------------------------------------------------------*/
@@ -45,12 +46,43 @@
 namespace MARTe {
 
 ConstantGAM::ConstantGAM() :
-        GAM(), MessageI() {
-
+        GAM(), MessageI(), StatefulI() {
+    writeOnce = false;
+    stagedMemory = NULL_PTR(uint8 *);
+    signalOffset = NULL_PTR(uint32 *);
+    signalSize = NULL_PTR(uint32 *);
+    signalChanged = NULL_PTR(bool *);
+    updatePending = 0;
 }
 
 ConstantGAM::~ConstantGAM() {
+    if (stagedMemory != NULL_PTR(uint8 *)) {
+        delete[] stagedMemory;
+    }
+    if (signalOffset != NULL_PTR(uint32 *)) {
+        delete[] signalOffset;
+    }
+    if (signalSize != NULL_PTR(uint32 *)) {
+        delete[] signalSize;
+    }
+    if (signalChanged != NULL_PTR(bool *)) {
+        delete[] signalChanged;
+    }
+}
 
+bool ConstantGAM::Initialise(StructuredDataI &data) {
+    bool ret = GAM::Initialise(data);
+    if (ret) {
+        uint32 writeOnceValue = 0u;
+        if (data.Read("WriteOnce", writeOnceValue)) {
+            ret = (writeOnceValue <= 1u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "WriteOnce shall be 0 or 1");
+            }
+        }
+        writeOnce = (writeOnceValue == 1u);
+    }
+    return ret;
 }
 
 bool ConstantGAM::Setup() {
@@ -63,6 +95,24 @@ bool ConstantGAM::Setup() {
 
     uint32 signalIndex;
 
+    if ((ret) && (writeOnce)) {
+        uint32 numberOfOutputSignals = GetNumberOfOutputSignals();
+        signalOffset = new uint32[numberOfOutputSignals];
+        signalSize = new uint32[numberOfOutputSignals];
+        signalChanged = new bool[numberOfOutputSignals];
+        uint32 totalSize = 0u;
+        for (signalIndex = 0u; (signalIndex < numberOfOutputSignals) && (ret); signalIndex++) {
+            signalOffset[signalIndex] = totalSize;
+            signalSize[signalIndex] = 0u;
+            signalChanged[signalIndex] = false;
+            ret = GetSignalByteSize(OutputSignals, signalIndex, signalSize[signalIndex]);
+            totalSize += signalSize[signalIndex];
+        }
+        if ((ret) && (totalSize > 0u)) {
+            stagedMemory = new uint8[totalSize];
+        }
+    }
+
     for (signalIndex = 0u; (signalIndex < GetNumberOfOutputSignals()) && (ret); signalIndex++) {
 
         StreamString signalName;
@@ -93,7 +143,7 @@ bool ConstantGAM::Setup() {
         }
 
         AnyType signalDefType = configuredDatabase.GetType("Default");
-        AnyType signalDefValue(signalType, 0u, GetOutputSignalMemory(signalIndex));
+        AnyType signalDefValue(signalType, 0u, GetWriteMemory(signalIndex));
 
         uint32 signalNumberOfDimensions = 0u;
         if (ret) {
@@ -146,6 +196,12 @@ bool ConstantGAM::Setup() {
 
     }
 
+    if ((ret) && (writeOnce)) {
+        for (signalIndex = 0u; (signalIndex < GetNumberOfOutputSignals()) && (ret); signalIndex++) {
+            ret = MemoryOperationsHelper::Copy(GetOutputSignalMemory(signalIndex), GetWriteMemory(signalIndex), signalSize[signalIndex]);
+        }
+    }
+
     // Install message filter
     ReferenceT<RegisteredMethodsMessageFilter> registeredMethodsMessageFilter("RegisteredMethodsMessageFilter");
 
@@ -162,9 +218,56 @@ bool ConstantGAM::Setup() {
 }
 
 bool ConstantGAM::Execute() {
+    if (updatePending != 0) {
+        /* If SetOutput is writing the staged copy the update is applied in the next cycle */
+        if (stagedMemoryMux.FastTryLock()) {
+            uint32 signalIndex;
+            /*lint -e{613} signalChanged and signalSize cannot be NULL as updatePending is only set if WriteOnce = 1*/
+            for (signalIndex = 0u; signalIndex < GetNumberOfOutputSignals(); signalIndex++) {
+                if (signalChanged[signalIndex]) {
+                    (void) MemoryOperationsHelper::Copy(GetOutputSignalMemory(signalIndex), GetWriteMemory(signalIndex), signalSize[signalIndex]);
+                    signalChanged[signalIndex] = false;
+                }
+            }
+            updatePending = 0;
+            stagedMemoryMux.FastUnLock();
+        }
+    }
+    return true;
+}
+
+bool ConstantGAM::PrepareNextState(const char8 * const currentStateName,
+                                   const char8 * const nextStateName) {
+    if (writeOnce) {
+        if (stagedMemoryMux.FastLock() == ErrorManagement::NoError) {
+            uint32 signalIndex;
+            /*lint -e{613} signalChanged cannot be NULL if WriteOnce = 1*/
+            for (signalIndex = 0u; signalIndex < GetNumberOfOutputSignals(); signalIndex++) {
+                signalChanged[signalIndex] = true;
+            }
+            updatePending = 1;
+            stagedMemoryMux.FastUnLock();
+        }
+    }
     return true;
 }
 
+bool ConstantGAM::IsWriteOnce() const {
+    return writeOnce;
+}
+
+void *ConstantGAM::GetWriteMemory(const uint32 signalIndex) {
+    void *memory = NULL_PTR(void *);
+    if (writeOnce) {
+        /*lint -e{613} stagedMemory and signalOffset cannot be NULL if WriteOnce = 1 and Setup succeeded*/
+        memory = &stagedMemory[signalOffset[signalIndex]];
+    }
+    else {
+        memory = GetOutputSignalMemory(signalIndex);
+    }
+    return memory;
+}
+
 ErrorManagement::ErrorType ConstantGAM::SetOutput(ReferenceContainer& message) {
 
     ErrorManagement::ErrorType ret = ErrorManagement::NoError;
@@ -219,7 +322,7 @@ ErrorManagement::ErrorType ConstantGAM::SetOutput(ReferenceContainer& message) {
         /*lint -e{534}  [MISRA C++ Rule 0-1-7], [MISRA C++ Rule 0-3-2]. Justification: SignalIndex is tested valid prio to this part of the code.*/
         MoveToSignalIndex(OutputSignals, signalIndex);
         AnyType signalDefType = configuredDatabase.GetType("Default");
-        AnyType signalNewValue(signalType, 0u, GetOutputSignalMemory(signalIndex));
+        AnyType signalNewValue(signalType, 0u, GetWriteMemory(signalIndex));
 
         uint8 signalNumberOfDimensions = signalDefType.GetNumberOfDimensions();
         signalNewValue.SetNumberOfDimensions(signalNumberOfDimensions);
@@ -231,7 +334,21 @@ ErrorManagement::ErrorType ConstantGAM::SetOutput(ReferenceContainer& message) {
             signalNewValue.SetNumberOfElements(static_cast<uint32>(dimensionIndex), dimensionNumberOfElements);
         }
 
-        if (data->Read("SignalValue", signalNewValue)) {
+        if (writeOnce) {
+            ok = (stagedMemoryMux.FastLock() == ErrorManagement::NoError);
+        }
+        if (ok) {
+            ok = data->Read("SignalValue", signalNewValue);
+            if ((ok) && (writeOnce)) {
+                /*lint -e{613} signalChanged cannot be NULL if WriteOnce = 1*/
+                signalChanged[signalIndex] = true;
+                updatePending = 1;
+            }
+            if (writeOnce) {
+                stagedMemoryMux.FastUnLock();
+            }
+        }
+        if (ok) {
             REPORT_ERROR(ErrorManagement::Information, "Signal '%!' new value '%!'", signalName.Buffer(), signalNewValue);
         }
         else {
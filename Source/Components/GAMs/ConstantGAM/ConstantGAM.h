@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "FastPollingMutexSem.h"
 #include "GAM.h"
 #include "MessageI.h"
 
@@ -88,8 +89,26 @@ namespace MARTe {
  *     }
  * }
  * </pre>
+ *
+ * By default SetOutput writes directly in the output signal memory, i.e. asynchronously with respect to the
+ * real-time thread. If the optional parameter WriteOnce = 1 is set, the new values are instead staged in a private
+ * copy of the output signals and the output signal memory is only written by the first Execute() after a SetOutput
+ * (only the modified signals are copied) or after a state transition (PrepareNextState(), all the signals are copied).
+ * In all the other cycles Execute() returns without touching any memory, which is meant for applications with many
+ * (large) constant tables. The signals are written by Execute() in a consistent way and a SetOutput which is being
+ * processed while Execute() is called is applied in the next cycle.
+ *
+ * <pre>
+ * +Constants = {
+ *     Class = ConstantGAM
+ *     WriteOnce = 1 //Optional. Default = 0.
+ *     OutputSignals = {
+ *         ...
+ *     }
+ * }
+ * </pre>
  */
-class ConstantGAM: public GAM, public MessageI {
+class ConstantGAM: public GAM, public MessageI, public StatefulI {
 public:
     CLASS_REGISTER_DECLARATION()
 
@@ -99,10 +118,17 @@ public:
     ConstantGAM();
 
     /**
-     * @brief Destructor. NOOP.
+     * @brief Destructor. Frees the staged copy of the output signals.
      */
     virtual ~ConstantGAM();
 
+    /**
+     * @brief Reads the optional WriteOnce parameter.
+     * @param[in] data the GAM configuration.
+     * @return true if GAM::Initialise succeeds and WriteOnce (if set) is 0 or 1.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
     /**
      * @brief Initialises the output signal memory with default values provided through configuration.
      * @return true if the pre-conditions are met.
@@ -113,11 +139,22 @@ public:
     virtual bool Setup();
 
     /**
-     * @brief Execute method. NOOP.
+     * @brief Execute method.
+     * @details NOOP unless WriteOnce = 1 and a SetOutput or a PrepareNextState is pending, in which case
+     * the modified signals are copied from the staged copy into the output signal memory.
      * @return true.
      */
     virtual bool Execute();
 
+    /**
+     * @brief If WriteOnce = 1 requests the copy of all the signals in the next Execute().
+     * @param[in] currentStateName the current state.
+     * @param[in] nextStateName the next state.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
     /**
      * @brief SetOutput method.
      * @details The method is registered as a messageable function. It assumes the ReferenceContainer
@@ -131,6 +168,52 @@ public:
      *   The 'SignalValue' provided corresponds to the expected type and dimensionality.
      */
     ErrorManagement::ErrorType SetOutput(ReferenceContainer& message);
+
+    /**
+     * @brief Gets the value of the WriteOnce parameter.
+     * @return true if WriteOnce = 1.
+     */
+    bool IsWriteOnce() const;
+
+private:
+
+    /**
+     * @brief Gets the memory where the value of a signal is written by Setup and SetOutput.
+     * @param[in] signalIndex the index of the output signal.
+     * @return the staged copy of the signal if WriteOnce = 1, GetOutputSignalMemory(signalIndex) otherwise.
+     */
+    void *GetWriteMemory(const uint32 signalIndex);
+
+    /**
+     * True if WriteOnce = 1.
+     */
+    bool writeOnce;
+
+    /**
+     * The staged copy of the output signals (same layout as the output signals memory). Only allocated if WriteOnce = 1.
+     */
+    uint8 *stagedMemory;
+
+    /**
+     * The byte offset and byte size of each output signal in the output signals memory.
+     */
+    uint32 *signalOffset;
+    uint32 *signalSize;
+
+    /**
+     * True for the signals which have to be copied in the next Execute().
+     */
+    bool *signalChanged;
+
+    /**
+     * Different from zero if any signalChanged is true. Allows Execute() to return without locking.
+     */
+    volatile int32 updatePending;
+
+    /**
+     * Protects stagedMemory and signalChanged.
+     */
+    FastPollingMutexSem stagedMemoryMux;
 };
 
 }
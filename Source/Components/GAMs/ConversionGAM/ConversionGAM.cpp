@@ -46,6 +46,10 @@ ConversionGAM::ConversionGAM() :
         GAM() {
     numberOfSignals = 0u;
     conversionHelpers = NULL_PTR(ConversionHelper **);
+    conversionPlans = NULL_PTR(ConversionPlan **);
+    numberOfConversionPlans = 0u;
+    unplannedHelpers = NULL_PTR(ConversionHelper **);
+    numberOfUnplannedHelpers = 0u;
 }
 
 /*lint -e{1551} the destructor must guarantee that the conversionHelpers memory is freed.*/
@@ -59,6 +63,15 @@ ConversionGAM::~ConversionGAM() {
         }
         delete[] conversionHelpers;
     }
+    if (conversionPlans != NULL_PTR(ConversionPlan **)) {
+        for (i = 0u; i < numberOfConversionPlans; i++) {
+            delete conversionPlans[i];
+        }
+        delete[] conversionPlans;
+    }
+    if (unplannedHelpers != NULL_PTR(ConversionHelper **)) {
+        delete[] unplannedHelpers;
+    }
 }
 
 bool ConversionGAM::Initialise(StructuredDataI & data) {
@@ -500,26 +513,113 @@ bool ConversionGAM::Setup() {
                         if (conversionHelpers[idx]->LoadGain(cdb)) {
                             REPORT_ERROR(ErrorManagement::ParametersError, "Gain set for conversion %d", idx);
                         }
+                        if (conversionHelpers[idx]->LoadOffset(cdb)) {
+                            REPORT_ERROR(ErrorManagement::Information, "Offset set for conversion %d", idx);
+                        }
+                        uint8 saturate = 0u;
+                        if (cdb.Read("Saturate", saturate)) {
+                            ret = (saturate <= 1u);
+                            if (!ret) {
+                                REPORT_ERROR(ErrorManagement::ParametersError, "Saturate shall be 0 or 1 for conversion %d", idx);
+                            }
+                        }
+                        conversionHelpers[idx]->SetSaturated(saturate == 1u);
+                    }
+                    if (ret) {
+                        ret = conversionHelpers[idx]->LoadCalibration(cdb);
+                        if (!ret) {
+                            REPORT_ERROR(ErrorManagement::ParametersError, "Invalid calibration for conversion %d", idx);
+                        }
+                    }
+                    if (ret) {
                         ret = cdb.MoveToAncestor(1u);
                     }
                 }
             }
         }
     }
+    if (ret) {
+        CreateConversionPlans();
+    }
 
     return ret;
 }
 
+/*lint -e{613} conversionHelpers is not NULL as Setup succeeded.*/
+void ConversionGAM::CreateConversionPlans() {
+    conversionPlans = new ConversionPlan*[numberOfSignals];
+    unplannedHelpers = new ConversionHelper*[numberOfSignals];
+    //The first signal of each plan, to compare the types and the scaling
+    uint32 *planSignals = new uint32[numberOfSignals];
+    const void * const inputBase = GetInputSignalsMemory();
+    void * const outputBase = GetOutputSignalsMemory();
+    uint32 n;
+    for (n = 0u; n < numberOfSignals; n++) {
+        ConversionHelper *helper = conversionHelpers[n];
+        uint32 numberOfValues = helper->GetNumberOfElements() * helper->GetNumberOfSamples();
+        bool planned = false;
+        if ((!helper->IsSaturated()) && (!helper->IsCalibrated()) && (numberOfValues <= conversionPlanMaxNumberOfValues)) {
+            TypeDescriptor inputType = GetSignalType(InputSignals, n);
+            TypeDescriptor outputType = GetSignalType(OutputSignals, n);
+            uint32 p;
+            bool found = false;
+            for (p = 0u; (p < numberOfConversionPlans) && (!found); p++) {
+                uint32 first = planSignals[p];
+                found = (GetSignalType(InputSignals, first) == inputType);
+                if (found) {
+                    found = (GetSignalType(OutputSignals, first) == outputType);
+                }
+                if (found) {
+                    found = helper->HasSameScaling(*conversionHelpers[first]);
+                }
+                if (found) {
+                    planned = conversionPlans[p]->AddSignal(GetInputSignalMemory(n), GetOutputSignalMemory(n), numberOfValues);
+                }
+            }
+            if (!found) {
+                ConversionPlan *plan = helper->CreatePlan(inputBase, outputBase, numberOfSignals);
+                planned = plan->AddSignal(GetInputSignalMemory(n), GetOutputSignalMemory(n), numberOfValues);
+                if (planned) {
+                    conversionPlans[numberOfConversionPlans] = plan;
+                    planSignals[numberOfConversionPlans] = n;
+                    numberOfConversionPlans++;
+                }
+                else {
+                    delete plan;
+                }
+            }
+        }
+        if (!planned) {
+            unplannedHelpers[numberOfUnplannedHelpers] = helper;
+            numberOfUnplannedHelpers++;
+        }
+    }
+    delete[] planSignals;
+}
+
 bool ConversionGAM::Execute() {
     uint32 i;
-    if (conversionHelpers != NULL_PTR(ConversionHelper **)) {
-        for (i = 0u; i < numberOfSignals; i++) {
-            conversionHelpers[i]->Convert();
+    if (conversionPlans != NULL_PTR(ConversionPlan **)) {
+        for (i = 0u; i < numberOfConversionPlans; i++) {
+            conversionPlans[i]->Convert();
+        }
+    }
+    if (unplannedHelpers != NULL_PTR(ConversionHelper **)) {
+        for (i = 0u; i < numberOfUnplannedHelpers; i++) {
+            unplannedHelpers[i]->Convert();
         }
     }
 
     return true;
 }
+
+uint32 ConversionGAM::GetNumberOfConversionPlans() const {
+    return numberOfConversionPlans;
+}
+
+uint32 ConversionGAM::GetNumberOfUnplannedSignals() const {
+    return numberOfUnplannedHelpers;
+}
 CLASS_REGISTER(ConversionGAM, "1.0")
 }
 
@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "ConversionHelper.h"
+#include "ConversionPlan.h"
 #include "GAM.h"
 
 /*---------------------------------------------------------------------------*/
@@ -41,10 +42,22 @@ namespace MARTe {
 /**
  * @brief GAM which allows to convert between different signal types.
  *
- * @details This GAM converts and copies the input signals to the output signals. A gain can
- * also be specified so that outputSignal[i] = gain[i] * inputSignal[i], where i is the input signal index (see GetNumberOfInputSignals()).
+ * @details This GAM converts and copies the input signals to the output signals. A gain and an offset can
+ * also be specified so that outputSignal[i] = gain[i] * inputSignal[i] + offset[i], where i is the input signal index (see GetNumberOfInputSignals()).
  * If the signal is an array (or has more than one sample), this operation is applied to each element/sample.
  *
+ * By default the values that do not fit in the output type are cast (e.g. integers wrap). If Saturate = 1 is set
+ * in the output signal, gain[i] * inputSignal[i] + offset[i] is computed in float64 and clamped to the range of the output type.
+ *
+ * The input values can also be calibrated before the gain and offset are applied, either with a polynomial
+ * (Polynomial = {c0 c1 ... cn}, evaluated with the Horner's scheme) or with a piecewise-linear lookup table
+ * (TableInput and TableOutput, where the TableInput values are strictly increasing and the values outside of the
+ * table take the first or the last TableOutput value). The calibration is computed in float64 (see ConversionHelper::LoadCalibration).
+ *
+ * The short signals (up to conversionPlanMaxNumberOfValues values) with the same input type, output type, Gain and Offset,
+ * and without saturation nor calibration, are grouped at Setup in a ConversionPlan, which converts all of them in a single loop.
+ * The other signals are converted one by one by their ConversionHelper.
+ *
  * The number of input and output signals shall be the same, i.e. GetNumberOfInputSignals() == GetNumberOfOutputSignals().
  *
  * For each input signal, the number of elements multiplied by the number of samples shall be the
@@ -73,10 +86,13 @@ namespace MARTe {
  *             Type = float32
  *             Elements = 200
  *             Gain = 3
+ *             Offset = -1 //Optional
  *         }
  *         Signal2 = {
  *             DataSource = "LCD"
  *             Type = int32
+ *             Saturate = 1 //Optional
+ *             Polynomial = {-0.1 0.025 -1.2e-6} //Optional
  *         }
  *     }
  * }
@@ -111,22 +127,61 @@ ConversionGAM    ();
 
     /**
      * @brief see GAM::Initialise.
-     * @details Stores the GAM configuration in order to read the Gain of each OutputSignal
+     * @details Stores the GAM configuration in order to read the Gain, Offset, Saturate and calibration of each OutputSignal
      */
     virtual bool Initialise(StructuredDataI & data);
 
     /**
-     * @brief Convert the input signals memory to the output signal memory, eventually multiplying by a gain factor.
+     * @brief Convert the input signals memory to the output signal memory, eventually multiplying by a gain factor and adding an offset.
      * @return true if all the signals memory can be successfully copied.
      */
     virtual bool Execute();
 
+    /**
+     * @brief Gets the number of ConversionPlan groups created at Setup.
+     * @return the number of ConversionPlan groups.
+     */
+    uint32 GetNumberOfConversionPlans() const;
+
+    /**
+     * @brief Gets the number of signals which are not part of a ConversionPlan and are converted one by one.
+     * @return the number of signals converted by their ConversionHelper.
+     */
+    uint32 GetNumberOfUnplannedSignals() const;
+
 private:
+    /**
+     * @brief Groups the signals in ConversionPlan groups.
+     * @details A signal joins the first plan with the same input and output types and the same Gain and Offset.
+     * The signals which cannot join a plan are added to the unplannedHelpers.
+     */
+    void CreateConversionPlans();
+
     /**
      * One ConversionHelperT for each signal.
      */
     ConversionHelper **conversionHelpers;
 
+    /**
+     * The groups of signals converted in a single loop.
+     */
+    ConversionPlan **conversionPlans;
+
+    /**
+     * Number of conversionPlans.
+     */
+    uint32 numberOfConversionPlans;
+
+    /**
+     * The ConversionHelperT of the signals which are not part of a plan.
+     */
+    ConversionHelper **unplannedHelpers;
+
+    /**
+     * Number of unplannedHelpers.
+     */
+    uint32 numberOfUnplannedHelpers;
+
     /**
      * Number of signals to copy.
      */
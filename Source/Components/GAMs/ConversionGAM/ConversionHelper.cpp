@@ -28,7 +28,9 @@
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
 #include "ConversionHelper.h"
+#include "Vector.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -43,11 +45,23 @@ ConversionHelper::ConversionHelper(const void *  const inputMemoryIn, void * con
     outputMemory = outputMemoryIn;
     numberOfElements = 0u;
     numberOfSamples = 0u;
+    saturated = false;
+    calibrationMode = NoCalibration;
+    calibrationInput = NULL_PTR(float64 *);
+    calibrationOutput = NULL_PTR(float64 *);
+    calibrationSize = 0u;
+    uniformTable = false;
+    tableInverseStep = 0.0;
 }
 
 /*lint -e{1540} inputMemoryIn and outputMemoryIn freed by the ConversionGAM */
 ConversionHelper::~ConversionHelper() {
-
+    if (calibrationInput != NULL_PTR(float64 *)) {
+        delete[] calibrationInput;
+    }
+    if (calibrationOutput != NULL_PTR(float64 *)) {
+        delete[] calibrationOutput;
+    }
 }
 
 const void* ConversionHelper::GetInputMemory() const {
@@ -73,4 +87,160 @@ void ConversionHelper::SetNumberOfSamples(const uint32 numberOfSamplesIn) {
 void* ConversionHelper::GetOutputMemory() {
     return outputMemory;
 }
+
+bool ConversionHelper::IsSaturated() const {
+    return saturated;
+}
+
+void ConversionHelper::SetSaturated(const bool saturatedIn) {
+    saturated = saturatedIn;
+}
+
+uint32 ConversionHelper::ReadArray(StructuredDataI &data,
+                                   const char8 * const name,
+                                   float64 *&values) {
+    uint32 numberOfValues = 0u;
+    AnyType arrayType = data.GetType(name);
+    if (!arrayType.IsVoid()) {
+        numberOfValues = arrayType.GetNumberOfElements(0u);
+    }
+    if (numberOfValues > 0u) {
+        values = new float64[numberOfValues];
+        Vector<float64> valuesVector(values, numberOfValues);
+        if (!data.Read(name, valuesVector)) {
+            numberOfValues = 0u;
+        }
+    }
+    return numberOfValues;
+}
+
+bool ConversionHelper::LoadCalibration(StructuredDataI &data) {
+    bool hasPolynomial = !data.GetType("Polynomial").IsVoid();
+    bool hasTable = (!data.GetType("TableInput").IsVoid()) || (!data.GetType("TableOutput").IsVoid());
+    bool ok = !(hasPolynomial && hasTable);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Only one of Polynomial or TableInput/TableOutput can be specified");
+    }
+    if ((ok) && (hasPolynomial)) {
+        calibrationSize = ReadArray(data, "Polynomial", calibrationInput);
+        ok = (calibrationSize > 0u);
+        if (ok) {
+            calibrationMode = PolynomialCalibration;
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not read the Polynomial coefficients");
+        }
+    }
+    if ((ok) && (hasTable)) {
+        calibrationSize = ReadArray(data, "TableInput", calibrationInput);
+        uint32 numberOfOutputs = ReadArray(data, "TableOutput", calibrationOutput);
+        ok = (calibrationSize > 1u) && (calibrationSize == numberOfOutputs);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "TableInput and TableOutput shall have the same number (> 1) of values");
+        }
+        uint32 k;
+        for (k = 1u; (k < calibrationSize) && (ok); k++) {
+            ok = (calibrationInput[k] > calibrationInput[k - 1u]);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "TableInput values shall be strictly increasing");
+            }
+        }
+        if (ok) {
+            calibrationMode = TableCalibration;
+            //Equally spaced inputs (to a relative tolerance) allow to compute the segment directly
+            float64 step = (calibrationInput[calibrationSize - 1u] - calibrationInput[0u]) / static_cast<float64>(calibrationSize - 1u);
+            uniformTable = true;
+            for (k = 1u; (k < calibrationSize) && (uniformTable); k++) {
+                float64 error = (calibrationInput[k] - calibrationInput[0u]) - (static_cast<float64>(k) * step);
+                uniformTable = ((error < (step * 1e-9)) && (error > -(step * 1e-9)));
+            }
+            tableInverseStep = 1.0 / step;
+        }
+    }
+    return ok;
+}
+
+bool ConversionHelper::IsCalibrated() const {
+    return (calibrationMode != NoCalibration);
+}
+
+uint32 ConversionHelper::FindSegment(const float64 value) const {
+    uint32 low = 0u;
+    uint32 high = calibrationSize - 1u;
+    while ((high - low) > 1u) {
+        uint32 middle = (low + high) / 2u;
+        if (calibrationInput[middle] <= value) {
+            low = middle;
+        }
+        else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+/*lint -e{613} calibrationInput and calibrationOutput are not NULL as IsCalibrated().*/
+void ConversionHelper::Calibrate(const float64 * const input,
+                                 float64 * const output,
+                                 const uint32 numberOfValues) const {
+    uint32 j;
+    if (calibrationMode == PolynomialCalibration) {
+        //Horner's scheme, with the values as the inner loop
+        uint32 k = calibrationSize - 1u;
+        for (j = 0u; j < numberOfValues; j++) {
+            output[j] = calibrationInput[k];
+        }
+        while (k > 0u) {
+            k--;
+            float64 coefficient = calibrationInput[k];
+            for (j = 0u; j < numberOfValues; j++) {
+                output[j] = (output[j] * input[j]) + coefficient;
+            }
+        }
+    }
+    else if (calibrationMode == TableCalibration) {
+        uint32 last = calibrationSize - 1u;
+        for (j = 0u; j < numberOfValues; j++) {
+            float64 x = input[j];
+            if (x <= calibrationInput[0u]) {
+                output[j] = calibrationOutput[0u];
+            }
+            else if (x >= calibrationInput[last]) {
+                output[j] = calibrationOutput[last];
+            }
+            /*lint -e{777} testing for NaN.*/
+            else if (x == x) {
+                uint32 k;
+                if (uniformTable) {
+                    k = static_cast<uint32>((x - calibrationInput[0u]) * tableInverseStep);
+                    //Correct the rounding of the computed segment
+                    if (k >= last) {
+                        k = last - 1u;
+                    }
+                    if ((k > 0u) && (x < calibrationInput[k])) {
+                        k--;
+                    }
+                    else if (x >= calibrationInput[k + 1u]) {
+                        k++;
+                    }
+                    else {
+                    }
+                }
+                else {
+                    k = FindSegment(x);
+                }
+                float64 fraction = (x - calibrationInput[k]) / (calibrationInput[k + 1u] - calibrationInput[k]);
+                output[j] = calibrationOutput[k] + (fraction * (calibrationOutput[k + 1u] - calibrationOutput[k]));
+            }
+            else {
+                output[j] = x;
+            }
+        }
+    }
+    else {
+        for (j = 0u; j < numberOfValues; j++) {
+            output[j] = input[j];
+        }
+    }
+}
 }
@@ -31,16 +31,25 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "ConversionPlan.h"
 #include "StructuredDataI.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * Number of values that are calibrated at a time.
+ */
+static const uint32 conversionHelperBlockSize = 64u;
+
 /**
  * @brief Support class for the ConversionGAM. One instance for each input signal is to be allocated.
  * @details This class is responsible for converting all the input signal elements/samples to the corresponding
  * output signal elements/samples.
+ *
+ * The calibration of the input values (polynomial or piecewise-linear lookup table) does not depend on the
+ * signal types and is implemented in this class, in float64, over blocks of conversionHelperBlockSize values.
  */
 class ConversionHelper {
 public:
@@ -69,6 +78,65 @@ public:
      */
     virtual bool LoadGain(StructuredDataI &data) = 0;
 
+    /**
+     * @brief Reads the Offset parameter which is added to the scaled input.
+     * @param data where to read the Offset parameter.
+     * @return true if the Offset was specified.
+     */
+    virtual bool LoadOffset(StructuredDataI &data) = 0;
+
+    /**
+     * @brief To be specialised by ConversionHelperT, for all the supported data types.
+     * @details Creates an empty ConversionPlanT with the types, the Gain and the Offset of this signal.
+     * @param[in] inputBase the address of the input signals memory of the GAM.
+     * @param[in] outputBase the address of the output signals memory of the GAM.
+     * @param[in] maxNumberOfSignals the maximum number of signals of the plan.
+     * @return the plan, to be destroyed by the caller.
+     */
+    virtual ConversionPlan *CreatePlan(const void * const inputBase,
+                                       void * const outputBase,
+                                       const uint32 maxNumberOfSignals) const = 0;
+
+    /**
+     * @brief To be specialised by ConversionHelperT, for all the supported data types.
+     * @details Checks if another signal is scaled with the same Gain and Offset, i.e. if it can be converted by the same ConversionPlan.
+     * @param[in] other the ConversionHelper of the other signal.
+     * @return true if both signals have the same Gain and Offset (or none).
+     * @pre
+     *   other has the same input and output types of this signal.
+     */
+    virtual bool HasSameScaling(const ConversionHelper &other) const = 0;
+
+    /**
+     * @brief Gets the saturation mode.
+     * @return true if the converted values are clamped to the range of the output type.
+     */
+    bool IsSaturated() const;
+
+    /**
+     * @brief Sets the saturation mode.
+     * @param[in] saturatedIn if true the converted values are clamped to the range of the output type, otherwise
+     * the values outside of the range are cast (and may wrap).
+     */
+    void SetSaturated(const bool saturatedIn);
+
+    /**
+     * @brief Reads the calibration of the input values.
+     * @details Reads either the Polynomial coefficients {c0 c1 ... cn} (so that the calibrated value is
+     * c0 + c1 * x + ... + cn * x^n), or the TableInput and TableOutput arrays of a piecewise-linear lookup table.
+     * The TableInput values shall be strictly increasing and the input values outside of the table take the first or
+     * the last TableOutput value. If none of the parameters is defined the input values are not calibrated.
+     * @param data where to read the calibration parameters.
+     * @return true if no calibration is defined or if the calibration parameters are valid.
+     */
+    bool LoadCalibration(StructuredDataI &data);
+
+    /**
+     * @brief Checks if the input values are calibrated.
+     * @return true if a Polynomial or a lookup table was loaded.
+     */
+    bool IsCalibrated() const;
+
     /**
      * @brief Gets a pointer to input signal memory.
      * @return a pointer to input signal memory.
@@ -106,6 +174,18 @@ public:
     void* GetOutputMemory();
 
 protected:
+    /**
+     * @brief Calibrates the input values.
+     * @param[in] input the input values.
+     * @param[out] output the calibrated values.
+     * @param[in] numberOfValues the number of values (<= conversionHelperBlockSize).
+     * @pre
+     *   IsCalibrated()
+     */
+    void Calibrate(const float64 * const input,
+                   float64 * const output,
+                   const uint32 numberOfValues) const;
+
     /**
      * The number of samples to be converted.
      */
@@ -126,6 +206,67 @@ protected:
      */
     void * outputMemory;
 
+    /**
+     * True if the converted values are clamped to the range of the output type.
+     */
+    bool saturated;
+
+private:
+    /**
+     * @brief Reads a float64 array from the configuration.
+     * @return the number of elements read or zero if the array cannot be read.
+     */
+    static uint32 ReadArray(StructuredDataI &data,
+                            const char8 * const name,
+                            float64 *&values);
+
+    /**
+     * @brief Finds the segment of the lookup table of a value.
+     * @return the index k so that tableInput[k] <= value < tableInput[k + 1].
+     * @pre
+     *   tableInput[0] < value < tableInput[calibrationSize - 1]
+     */
+    uint32 FindSegment(const float64 value) const;
+
+    /**
+     * The calibration modes.
+     */
+    enum CalibrationMode {
+        NoCalibration,
+        PolynomialCalibration,
+        TableCalibration
+    };
+
+    /**
+     * The calibration mode.
+     */
+    CalibrationMode calibrationMode;
+
+    /**
+     * The polynomial coefficients or the TableInput values.
+     */
+    float64 *calibrationInput;
+
+    /**
+     * The TableOutput values.
+     */
+    float64 *calibrationOutput;
+
+    /**
+     * The number of polynomial coefficients or of lookup table points.
+     */
+    uint32 calibrationSize;
+
+    /**
+     * True if the TableInput values are equally spaced.
+     */
+    bool uniformTable;
+
+    /**
+     * The inverse of the distance between the TableInput values (if uniformTable).
+     */
+    float64 tableInverseStep;
+
     /*lint -e{1712} This class does not have a default constructor because
      * the inputMemory and the outputMemory must be defined on construction and both remain constant
      * during the object's lifetime*/
@@ -27,12 +27,16 @@
 /*---------------------------------------------------------------------------*/
 /*                        Standard header includes                           */
 /*---------------------------------------------------------------------------*/
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "StructuredDataI.h"
 #include "ConversionHelper.h"
+#include "ConversionPlanT.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -40,6 +44,11 @@
 namespace MARTe {
 /**
  * @brief Support class for the ConversionGAM. One instance for each input signal is to be allocated.
+ * @details The conversion of all the elements and samples of the signal is performed in a single loop,
+ * selected once per call depending on the Gain, Offset and saturation settings. On SSE2 targets the most
+ * common pairs of types are converted with SSE2 instructions, that give the same results of the scalar loop:
+ * int16 and int32 to float32, float32 to float64 and float64 to float32 (without saturation) and
+ * float32 to int16 and float64 to float32 (with saturation).
  */
 /*lint -esym(9107, MARTe::ConversionHelperT*) [MISRA C++ Rule 3-1-1]. Justification: Required for template implementation.
  * No code is actually being generated and the header files can be included in multiple unit files.*/
@@ -59,6 +68,11 @@ public:
     /**
      * @see ConversionHelper::Convert.
      * @details Converts for the declared type names. A cast to the declared inputType and outputType is performed and the signals are copied.
+     * If the Gain or the Offset are defined output = (Gain * outputType(input)) + Offset.
+     * If IsSaturated() the output = (Gain * input) + Offset is computed in float64 and clamped to the range of the outputType
+     * (NaN is converted to 0).
+     * If IsCalibrated() the input is first calibrated and output = (Gain * calibrated) + Offset is computed in float64
+     * (and clamped if IsSaturated()).
      */
     virtual void Convert();
 
@@ -67,7 +81,53 @@ public:
      */
     virtual bool LoadGain(StructuredDataI &data);
 
+    /**
+     * @see ConversionHelper::LoadOffset.
+     */
+    virtual bool LoadOffset(StructuredDataI &data);
+
+    /**
+     * @see ConversionHelper::CreatePlan.
+     */
+    virtual ConversionPlan *CreatePlan(const void * const inputBase,
+                                       void * const outputBase,
+                                       const uint32 maxNumberOfSignals) const;
+
+    /**
+     * @see ConversionHelper::HasSameScaling.
+     */
+    virtual bool HasSameScaling(const ConversionHelper &other) const;
+
 private:
+    /**
+     * @brief Converts the values of the signal calibrating the input values.
+     * @param[in] src the input values.
+     * @param[out] dest the output values.
+     * @param[in] numberOfValues the number of values to convert.
+     */
+    void ConvertCalibrated(const inputType * const src,
+                           outputType * const dest,
+                           const uint32 numberOfValues) const;
+
+    /**
+     * @brief Converts the first values of the signal with SIMD instructions.
+     * @details Specialised for the supported pairs of types. The generic version does not convert any value.
+     * @param[in] src the input values.
+     * @param[out] dest the output values.
+     * @param[in] numberOfValues the number of values to convert.
+     * @return the number of values that were converted.
+     */
+    uint32 ConvertVector(const inputType * const src,
+                         outputType * const dest,
+                         const uint32 numberOfValues) const;
+
+    /**
+     * @brief Clamps a value to the range of the outputType.
+     * @param[in] value the value to clamp.
+     * @return the clamped value converted to the outputType.
+     */
+    outputType Saturate(const float64 value) const;
+
     /**
      * True if the Gain parameter was defined.
      */
@@ -77,6 +137,36 @@ private:
      * The gain that is used to scale the input signal.
      */
     outputType gain;
+
+    /**
+     * True if the Offset parameter was defined.
+     */
+    bool offsetDefined;
+
+    /**
+     * The offset that is added to the scaled input signal.
+     */
+    outputType offset;
+
+    /**
+     * The values greater or equal than this limit are saturated to maxValue.
+     */
+    float64 upperLimit;
+
+    /**
+     * The values lower or equal than this limit are saturated to minValue.
+     */
+    float64 lowerLimit;
+
+    /**
+     * The maximum value of the outputType.
+     */
+    outputType maxValue;
+
+    /**
+     * The minimum value of the outputType.
+     */
+    outputType minValue;
     /*lint -e{1712} This class does not have a default constructor because
      * the inputMemory and the outputMemory must be defined on construction and both remain constant
      * during the object's lifetime*/
@@ -92,8 +182,42 @@ ConversionHelperT<inputType, outputType>::ConversionHelperT(
         const void * const inputMemoryIn, void * const outputMemoryIn) :
         ConversionHelper(inputMemoryIn, outputMemoryIn) {
     gainDefined = false;
+    offsetDefined = false;
     /*lint -e{9117} [MISRA C++ Rule 5-0-4]. Justification: the type of the gain will depend on the outputType.*/
-    gain = static_cast<outputType>(0);
+    gain = static_cast<outputType>(1);
+    /*lint -e{9117} [MISRA C++ Rule 5-0-4]. Justification: the type of the offset will depend on the outputType.*/
+    offset = static_cast<outputType>(0);
+    /*lint -e{506} -e{774} the type characteristics are constant for each template instance.*/
+    bool isFloat = (static_cast<outputType>(0.5) > static_cast<outputType>(0));
+    if (isFloat) {
+        upperLimit = (sizeof(outputType) == sizeof(float32)) ? 3.4028234663852886e+38 : 1.7976931348623157e+308;
+        lowerLimit = -upperLimit;
+        maxValue = static_cast<outputType>(upperLimit);
+        minValue = static_cast<outputType>(lowerLimit);
+    }
+    else {
+        uint32 numberOfBits = static_cast<uint32>(sizeof(outputType)) * 8u;
+        /*lint -e{506} -e{774} the type characteristics are constant for each template instance.*/
+        bool isSigned = (static_cast<outputType>(-1) < static_cast<outputType>(0));
+        if (isSigned) {
+            numberOfBits--;
+        }
+        upperLimit = 1.0;
+        uint32 b;
+        for (b = 0u; b < numberOfBits; b++) {
+            upperLimit *= 2.0;
+        }
+        /*lint -e{9117} [MISRA C++ Rule 5-0-4]. Justification: the maximum value is representable in the outputType.*/
+        maxValue = static_cast<outputType>((~static_cast<uint64>(0u)) >> (64u - numberOfBits));
+        if (isSigned) {
+            lowerLimit = -upperLimit;
+            minValue = static_cast<outputType>(-maxValue - static_cast<outputType>(1));
+        }
+        else {
+            lowerLimit = 0.0;
+            minValue = static_cast<outputType>(0);
+        }
+    }
 }
 
 template<typename inputType, typename outputType>
@@ -104,33 +228,268 @@ ConversionHelperT<inputType, outputType>::~ConversionHelperT() {
 template<typename inputType, typename outputType>
 bool ConversionHelperT<inputType, outputType>::LoadGain(StructuredDataI &data) {
     gainDefined = data.Read("Gain", gain);
+    if (!gainDefined) {
+        gain = static_cast<outputType>(1);
+    }
     return gainDefined;
 }
 
+template<typename inputType, typename outputType>
+bool ConversionHelperT<inputType, outputType>::LoadOffset(StructuredDataI &data) {
+    offsetDefined = data.Read("Offset", offset);
+    if (!offsetDefined) {
+        offset = static_cast<outputType>(0);
+    }
+    return offsetDefined;
+}
+
+template<typename inputType, typename outputType>
+ConversionPlan *ConversionHelperT<inputType, outputType>::CreatePlan(const void * const inputBase,
+                                                                    void * const outputBase,
+                                                                    const uint32 maxNumberOfSignals) const {
+    return new ConversionPlanT<inputType, outputType>(inputBase, outputBase, maxNumberOfSignals, gain, offset, (gainDefined || offsetDefined));
+}
+
+/*lint -e{1774} -e{777} the other helper has the same types (see pre-condition) and the Gain and Offset are compared exactly.*/
+template<typename inputType, typename outputType>
+bool ConversionHelperT<inputType, outputType>::HasSameScaling(const ConversionHelper &other) const {
+    const ConversionHelperT<inputType, outputType> &otherT = static_cast<const ConversionHelperT<inputType, outputType> &>(other);
+    bool scaled = (gainDefined || offsetDefined);
+    bool otherScaled = (otherT.gainDefined || otherT.offsetDefined);
+    bool ret = (scaled == otherScaled);
+    if ((ret) && (scaled)) {
+        ret = ((gain == otherT.gain) && (offset == otherT.offset));
+    }
+    return ret;
+}
+
+template<typename inputType, typename outputType>
+outputType ConversionHelperT<inputType, outputType>::Saturate(const float64 value) const {
+    outputType ret;
+    if (value >= upperLimit) {
+        ret = maxValue;
+    }
+    else if (value <= lowerLimit) {
+        ret = minValue;
+    }
+    /*lint -e{777} testing for NaN.*/
+    else if (value == value) {
+        /*lint -e{734} -e{571} -e{9117} the value is within the range of the outputType.*/
+        ret = static_cast<outputType>(value);
+    }
+    else {
+        ret = static_cast<outputType>(0);
+    }
+    return ret;
+}
+
+template<typename inputType, typename outputType>
+uint32 ConversionHelperT<inputType, outputType>::ConvertVector(const inputType * const src,
+                                                               outputType * const dest,
+                                                               const uint32 numberOfValues) const {
+    return 0u;
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::ConvertCalibrated(const inputType * const src,
+                                                                 outputType * const dest,
+                                                                 const uint32 numberOfValues) const {
+    float64 input[conversionHelperBlockSize];
+    float64 output[conversionHelperBlockSize];
+    float64 gainValue = static_cast<float64>(gain);
+    float64 offsetValue = static_cast<float64>(offset);
+    uint32 i;
+    for (i = 0u; i < numberOfValues; i += conversionHelperBlockSize) {
+        uint32 blockSize = numberOfValues - i;
+        if (blockSize > conversionHelperBlockSize) {
+            blockSize = conversionHelperBlockSize;
+        }
+        uint32 j;
+        for (j = 0u; j < blockSize; j++) {
+            input[j] = static_cast<float64>(src[i + j]);
+        }
+        Calibrate(&input[0], &output[0], blockSize);
+        if (saturated) {
+            for (j = 0u; j < blockSize; j++) {
+                dest[i + j] = Saturate((gainValue * output[j]) + offsetValue);
+            }
+        }
+        else {
+            for (j = 0u; j < blockSize; j++) {
+                /*lint -e{734} -e{571} -e{9117} Loss of precision is responsibility of the conversion requested by the user.*/
+                dest[i + j] = static_cast<outputType>((gainValue * output[j]) + offsetValue);
+            }
+        }
+    }
+}
+
 template<typename inputType, typename outputType>
 void ConversionHelperT<inputType, outputType>::Convert() {
-    uint32 s;
-    uint32 n;
-    uint32 idx;
     outputType *dest = reinterpret_cast<outputType *>(outputMemory);
     const inputType *src = reinterpret_cast<const inputType *>(inputMemory);
     if ((dest != NULL) && (src != NULL)) {
-        for (s = 0u; s < numberOfSamples; s++) {
-            for (n = 0u; n < numberOfElements; n++) {
-                idx = s * numberOfElements;
-                idx += n;
-                if (gainDefined) {
-                    /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
-                    dest[idx] = gain * static_cast<outputType>(src[idx]);
-                }
-                else {
-                    /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
-                    dest[idx] = static_cast<outputType>(src[idx]);
-                }
+        uint32 numberOfValues = numberOfSamples * numberOfElements;
+        uint32 i = 0u;
+        if (IsCalibrated()) {
+            ConvertCalibrated(src, dest, numberOfValues);
+            i = numberOfValues;
+        }
+        else {
+            i = ConvertVector(src, dest, numberOfValues);
+        }
+        if (saturated) {
+            float64 gainValue = static_cast<float64>(gain);
+            float64 offsetValue = static_cast<float64>(offset);
+            for (; i < numberOfValues; i++) {
+                dest[i] = Saturate((gainValue * static_cast<float64>(src[i])) + offsetValue);
+            }
+        }
+        else if (gainDefined || offsetDefined) {
+            for (; i < numberOfValues; i++) {
+                /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+                dest[i] = (gain * static_cast<outputType>(src[i])) + offset;
+            }
+        }
+        else {
+            for (; i < numberOfValues; i++) {
+                /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+                dest[i] = static_cast<outputType>(src[i]);
+            }
+        }
+    }
+}
+
+#if defined(__SSE2__)
+/*lint -save -e586 -e9016 -e923 SSE2 intrinsics on unaligned signal memory.*/
+template<>
+inline uint32 ConversionHelperT<int16, float32>::ConvertVector(const int16 * const src,
+                                                               float32 * const dest,
+                                                               const uint32 numberOfValues) const {
+    uint32 i = 0u;
+    if (!saturated) {
+        //gain is one and offset is zero if not defined, which does not change the integer values
+        const __m128 g = _mm_set1_ps(gain);
+        const __m128 o = _mm_set1_ps(offset);
+        for (; (i + 8u) <= numberOfValues; i += 8u) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[i]));
+            __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16));
+            __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16));
+            _mm_storeu_ps(&dest[i], _mm_add_ps(_mm_mul_ps(lo, g), o));
+            _mm_storeu_ps(&dest[i + 4u], _mm_add_ps(_mm_mul_ps(hi, g), o));
+        }
+    }
+    return i;
+}
+
+template<>
+inline uint32 ConversionHelperT<int32, float32>::ConvertVector(const int32 * const src,
+                                                               float32 * const dest,
+                                                               const uint32 numberOfValues) const {
+    uint32 i = 0u;
+    if (!saturated) {
+        const __m128 g = _mm_set1_ps(gain);
+        const __m128 o = _mm_set1_ps(offset);
+        for (; (i + 4u) <= numberOfValues; i += 4u) {
+            __m128 x = _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[i])));
+            _mm_storeu_ps(&dest[i], _mm_add_ps(_mm_mul_ps(x, g), o));
+        }
+    }
+    return i;
+}
+
+template<>
+inline uint32 ConversionHelperT<float32, int16>::ConvertVector(const float32 * const src,
+                                                               int16 * const dest,
+                                                               const uint32 numberOfValues) const {
+    uint32 i = 0u;
+    if (saturated) {
+        const __m128d g = _mm_set1_pd(static_cast<float64>(gain));
+        const __m128d o = _mm_set1_pd(static_cast<float64>(offset));
+        const __m128d hi = _mm_set1_pd(static_cast<float64>(maxValue));
+        const __m128d lo = _mm_set1_pd(static_cast<float64>(minValue));
+        __m128d v[4];
+        __m128i w[4];
+        for (; (i + 8u) <= numberOfValues; i += 8u) {
+            __m128 a = _mm_loadu_ps(&src[i]);
+            __m128 b = _mm_loadu_ps(&src[i + 4u]);
+            v[0] = _mm_cvtps_pd(a);
+            v[1] = _mm_cvtps_pd(_mm_movehl_ps(a, a));
+            v[2] = _mm_cvtps_pd(b);
+            v[3] = _mm_cvtps_pd(_mm_movehl_ps(b, b));
+            uint32 k;
+            for (k = 0u; k < 4u; k++) {
+                __m128d y = _mm_add_pd(_mm_mul_pd(v[k], g), o);
+                //NaN to zero and clamp
+                y = _mm_and_pd(y, _mm_cmpord_pd(y, y));
+                y = _mm_min_pd(_mm_max_pd(y, lo), hi);
+                w[k] = _mm_cvttpd_epi32(y);
+            }
+            __m128i x0 = _mm_unpacklo_epi64(w[0], w[1]);
+            __m128i x1 = _mm_unpacklo_epi64(w[2], w[3]);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), _mm_packs_epi32(x0, x1));
+        }
+    }
+    return i;
+}
+
+template<>
+inline uint32 ConversionHelperT<float32, float64>::ConvertVector(const float32 * const src,
+                                                                 float64 * const dest,
+                                                                 const uint32 numberOfValues) const {
+    uint32 i = 0u;
+    if (!saturated) {
+        bool scaled = (gainDefined || offsetDefined);
+        const __m128d g = _mm_set1_pd(gain);
+        const __m128d o = _mm_set1_pd(offset);
+        for (; (i + 4u) <= numberOfValues; i += 4u) {
+            __m128 x = _mm_loadu_ps(&src[i]);
+            __m128d lo = _mm_cvtps_pd(x);
+            __m128d hi = _mm_cvtps_pd(_mm_movehl_ps(x, x));
+            if (scaled) {
+                lo = _mm_add_pd(_mm_mul_pd(lo, g), o);
+                hi = _mm_add_pd(_mm_mul_pd(hi, g), o);
+            }
+            _mm_storeu_pd(&dest[i], lo);
+            _mm_storeu_pd(&dest[i + 2u], hi);
+        }
+    }
+    return i;
+}
+
+template<>
+inline uint32 ConversionHelperT<float64, float32>::ConvertVector(const float64 * const src,
+                                                                 float32 * const dest,
+                                                                 const uint32 numberOfValues) const {
+    uint32 i = 0u;
+    if (saturated) {
+        const __m128d g = _mm_set1_pd(static_cast<float64>(gain));
+        const __m128d o = _mm_set1_pd(static_cast<float64>(offset));
+        const __m128d hi = _mm_set1_pd(upperLimit);
+        const __m128d lo = _mm_set1_pd(lowerLimit);
+        for (; (i + 4u) <= numberOfValues; i += 4u) {
+            __m128d a = _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(&src[i]), g), o);
+            __m128d b = _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(&src[i + 2u]), g), o);
+            a = _mm_min_pd(_mm_max_pd(_mm_and_pd(a, _mm_cmpord_pd(a, a)), lo), hi);
+            b = _mm_min_pd(_mm_max_pd(_mm_and_pd(b, _mm_cmpord_pd(b, b)), lo), hi);
+            _mm_storeu_ps(&dest[i], _mm_movelh_ps(_mm_cvtpd_ps(a), _mm_cvtpd_ps(b)));
+        }
+    }
+    else {
+        bool scaled = (gainDefined || offsetDefined);
+        const __m128 g = _mm_set1_ps(gain);
+        const __m128 o = _mm_set1_ps(offset);
+        for (; (i + 4u) <= numberOfValues; i += 4u) {
+            __m128 x = _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(&src[i])), _mm_cvtpd_ps(_mm_loadu_pd(&src[i + 2u])));
+            if (scaled) {
+                x = _mm_add_ps(_mm_mul_ps(x, g), o);
             }
+            _mm_storeu_ps(&dest[i], x);
         }
     }
+    return i;
 }
+/*lint -restore*/
+#endif
 
 }
 #endif /* CONVERSIONHELPERT_H_ */
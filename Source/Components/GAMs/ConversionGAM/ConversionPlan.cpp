@@ -0,0 +1,96 @@
+/**
+ * @file ConversionPlan.cpp
+ * @brief Source file for class ConversionPlan
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ConversionPlan (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConversionPlan.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+ConversionPlan::ConversionPlan(const void * const inputBaseIn,
+                               void * const outputBaseIn,
+                               const uint32 maxNumberOfSignalsIn) {
+    inputBase = static_cast<const uint8 *>(inputBaseIn);
+    outputBase = static_cast<uint8 *>(outputBaseIn);
+    maxNumberOfSignals = maxNumberOfSignalsIn;
+    numberOfSignals = 0u;
+    scalar = true;
+    inputOffsets = new uint32[maxNumberOfSignals];
+    outputOffsets = new uint32[maxNumberOfSignals];
+    numberOfValues = new uint32[maxNumberOfSignals];
+}
+
+/*lint -e{1540} inputBase and outputBase freed by the GAM */
+ConversionPlan::~ConversionPlan() {
+    delete[] inputOffsets;
+    delete[] outputOffsets;
+    delete[] numberOfValues;
+}
+
+/*lint -e{946} -e{947} the signals memory is compared with the signals memory of the GAM, where it is allocated.*/
+bool ConversionPlan::AddSignal(const void * const inputMemory,
+                               void * const outputMemory,
+                               const uint32 numberOfValuesIn) {
+    const uint8 * const input = static_cast<const uint8 *>(inputMemory);
+    const uint8 * const output = static_cast<uint8 *>(outputMemory);
+    bool ok = (numberOfSignals < maxNumberOfSignals);
+    if (ok) {
+        ok = ((numberOfValuesIn > 0u) && (numberOfValuesIn <= conversionPlanMaxNumberOfValues));
+    }
+    if (ok) {
+        ok = ((inputBase != NULL_PTR(const uint8 *)) && (outputBase != NULL_PTR(uint8 *)));
+    }
+    if (ok) {
+        ok = ((input != NULL_PTR(const uint8 *)) && (output != NULL_PTR(const uint8 *)));
+    }
+    if (ok) {
+        ok = ((input >= inputBase) && (output >= outputBase));
+    }
+    if (ok) {
+        inputOffsets[numberOfSignals] = static_cast<uint32>(input - inputBase);
+        outputOffsets[numberOfSignals] = static_cast<uint32>(output - outputBase);
+        numberOfValues[numberOfSignals] = numberOfValuesIn;
+        if (numberOfValuesIn > 1u) {
+            scalar = false;
+        }
+        numberOfSignals++;
+    }
+    return ok;
+}
+
+uint32 ConversionPlan::GetNumberOfSignals() const {
+    return numberOfSignals;
+}
+
+}
@@ -0,0 +1,145 @@
+/**
+ * @file ConversionPlan.h
+ * @brief Header file for class ConversionPlan
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ConversionPlan
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CONVERSIONPLAN_H_
+#define CONVERSIONPLAN_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * The signals with up to this number of values (elements * samples) can be converted by a ConversionPlan.
+ * The longer signals are converted by their ConversionHelper, which uses SIMD instructions for the most common pairs of types.
+ */
+static const uint32 conversionPlanMaxNumberOfValues = 4u;
+
+/**
+ * @brief Support class for the ConversionGAM. Converts, in a single loop, a group of signals with the same input type,
+ * output type, Gain and Offset (and without saturation nor calibration).
+ * @details The signals are stored as a structure of arrays: the offsets of the signals in the input and output memory
+ * of the GAM and the number of values of each signal. This avoids a virtual call (and the reload of the settings)
+ * for each signal when the GAM has many scalar signals.
+ */
+class ConversionPlan {
+public:
+    /**
+     * @brief Constructor.
+     * @param[in] inputBaseIn the address of the input signals memory of the GAM.
+     * @param[in] outputBaseIn the address of the output signals memory of the GAM.
+     * @param[in] maxNumberOfSignalsIn the maximum number of signals that can be added to the plan.
+     */
+    ConversionPlan(const void * const inputBaseIn,
+                   void * const outputBaseIn,
+                   const uint32 maxNumberOfSignalsIn);
+
+    /**
+     * @brief Destructor. Frees the plan arrays.
+     */
+    virtual ~ConversionPlan();
+
+    /**
+     * @brief To be specialised by ConversionPlanT, for all the supported data types.
+     * @details Converts all the values of all the signals of the plan.
+     */
+    virtual void Convert() = 0;
+
+    /**
+     * @brief Adds a signal to the plan.
+     * @param[in] inputMemory the memory address where the signal is to be read from.
+     * @param[in] outputMemory the memory address where the signal is to be written to.
+     * @param[in] numberOfValuesIn the number of values (elements * samples) of the signal.
+     * @return true if the signal was added, i.e. if the plan is not full, if the signal memory is within the signals memory
+     * of the GAM and if 0 < numberOfValuesIn <= conversionPlanMaxNumberOfValues.
+     */
+    bool AddSignal(const void * const inputMemory,
+                   void * const outputMemory,
+                   const uint32 numberOfValuesIn);
+
+    /**
+     * @brief Gets the number of signals of the plan.
+     * @return the number of signals of the plan.
+     */
+    uint32 GetNumberOfSignals() const;
+
+protected:
+    /**
+     * The input signals memory of the GAM.
+     */
+    const uint8 *inputBase;
+
+    /**
+     * The output signals memory of the GAM.
+     */
+    uint8 *outputBase;
+
+    /**
+     * The offset of each signal in the input signals memory.
+     */
+    uint32 *inputOffsets;
+
+    /**
+     * The offset of each signal in the output signals memory.
+     */
+    uint32 *outputOffsets;
+
+    /**
+     * The number of values of each signal.
+     */
+    uint32 *numberOfValues;
+
+    /**
+     * The number of signals of the plan.
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * True if all the signals of the plan have a single value.
+     */
+    bool scalar;
+
+private:
+    /**
+     * The maximum number of signals of the plan.
+     */
+    uint32 maxNumberOfSignals;
+
+    /*lint -e{1712} This class does not have a default constructor because
+     * the signals memory must be defined on construction and remains constant during the object's lifetime*/
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* CONVERSIONPLAN_H_ */
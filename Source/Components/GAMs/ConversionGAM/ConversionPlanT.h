@@ -0,0 +1,162 @@
+/**
+ * @file ConversionPlanT.h
+ * @brief Header file for class ConversionPlanT
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ConversionPlanT
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CONVERSIONPLANT_H_
+#define CONVERSIONPLANT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ConversionPlan.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Support class for the ConversionGAM. One instance for each group of signals with the same types, Gain and Offset.
+ * @details The conversion gives the same results of ConversionHelperT::Convert without saturation nor calibration.
+ * The plans are created by ConversionHelperT::CreatePlan.
+ */
+/*lint -esym(9107, MARTe::ConversionPlanT*) [MISRA C++ Rule 3-1-1]. Justification: Required for template implementation.
+ * No code is actually being generated and the header files can be included in multiple unit files.*/
+template<typename inputType, typename outputType>
+class ConversionPlanT: public ConversionPlan {
+public:
+    /**
+     * @see ConversionPlan::ConversionPlan
+     * @param[in] gainIn the Gain of all the signals of the plan.
+     * @param[in] offsetIn the Offset of all the signals of the plan.
+     * @param[in] scaledIn true if the Gain or the Offset are defined.
+     */
+    ConversionPlanT(const void * const inputBaseIn,
+                    void * const outputBaseIn,
+                    const uint32 maxNumberOfSignalsIn,
+                    const outputType gainIn,
+                    const outputType offsetIn,
+                    const bool scaledIn);
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~ConversionPlanT();
+
+    /**
+     * @see ConversionPlan::Convert.
+     * @details If the Gain or the Offset are defined output = (Gain * outputType(input)) + Offset, otherwise output = outputType(input).
+     * The plans of scalar signals are converted without the inner loop on the values.
+     */
+    virtual void Convert();
+
+private:
+    /**
+     * The gain of all the signals.
+     */
+    outputType gain;
+
+    /**
+     * The offset of all the signals.
+     */
+    outputType offset;
+
+    /**
+     * True if the Gain or the Offset are defined.
+     */
+    bool scaled;
+
+    /*lint -e{1712} This class does not have a default constructor because
+     * the signals memory must be defined on construction and remains constant during the object's lifetime*/
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+template<typename inputType, typename outputType>
+ConversionPlanT<inputType, outputType>::ConversionPlanT(const void * const inputBaseIn,
+                                                        void * const outputBaseIn,
+                                                        const uint32 maxNumberOfSignalsIn,
+                                                        const outputType gainIn,
+                                                        const outputType offsetIn,
+                                                        const bool scaledIn) :
+        ConversionPlan(inputBaseIn, outputBaseIn, maxNumberOfSignalsIn) {
+    gain = gainIn;
+    offset = offsetIn;
+    scaled = scaledIn;
+}
+
+template<typename inputType, typename outputType>
+ConversionPlanT<inputType, outputType>::~ConversionPlanT() {
+
+}
+
+/*lint -e{927} -e{826} the signals memory is accessed with the types of the signals.*/
+template<typename inputType, typename outputType>
+void ConversionPlanT<inputType, outputType>::Convert() {
+    uint32 s;
+    if (scalar) {
+        if (scaled) {
+            for (s = 0u; s < numberOfSignals; s++) {
+                const inputType *src = reinterpret_cast<const inputType *>(&inputBase[inputOffsets[s]]);
+                outputType *dest = reinterpret_cast<outputType *>(&outputBase[outputOffsets[s]]);
+                /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+                *dest = (gain * static_cast<outputType>(*src)) + offset;
+            }
+        }
+        else {
+            for (s = 0u; s < numberOfSignals; s++) {
+                const inputType *src = reinterpret_cast<const inputType *>(&inputBase[inputOffsets[s]]);
+                outputType *dest = reinterpret_cast<outputType *>(&outputBase[outputOffsets[s]]);
+                /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+                *dest = static_cast<outputType>(*src);
+            }
+        }
+    }
+    else {
+        for (s = 0u; s < numberOfSignals; s++) {
+            const inputType *src = reinterpret_cast<const inputType *>(&inputBase[inputOffsets[s]]);
+            outputType *dest = reinterpret_cast<outputType *>(&outputBase[outputOffsets[s]]);
+            uint32 i;
+            if (scaled) {
+                for (i = 0u; i < numberOfValues[s]; i++) {
+                    /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+                    dest[i] = (gain * static_cast<outputType>(src[i])) + offset;
+                }
+            }
+            else {
+                for (i = 0u; i < numberOfValues[s]; i++) {
+                    /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+                    dest[i] = static_cast<outputType>(src[i]);
+                }
+            }
+        }
+    }
+}
+
+}
+#endif /* CONVERSIONPLANT_H_ */
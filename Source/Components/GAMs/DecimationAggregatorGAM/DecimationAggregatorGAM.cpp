@@ -0,0 +1,412 @@
+/**
+ * @file DecimationAggregatorGAM.cpp
+ * @brief Source file for class DecimationAggregatorGAM
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DecimationAggregatorGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "DecimationAggregatorGAM.h"
+#include "StreamString.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+/**
+ * @brief Checks if the type of an input signal is supported.
+ */
+bool IsSupportedInputType(const MARTe::TypeDescriptor &type) {
+    using namespace MARTe;
+    return ((type == UnsignedInteger8Bit) || (type == SignedInteger8Bit) || (type == UnsignedInteger16Bit) || (type == SignedInteger16Bit)
+            || (type == UnsignedInteger32Bit) || (type == SignedInteger32Bit) || (type == Float32Bit) || (type == Float64Bit));
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+DecimationAggregatorGAM::DecimationAggregatorGAM() :
+        GAM() {
+    decimation = 0u;
+    cycle = 0u;
+    numberOfWindows = 0u;
+    statistics = NULL_PTR(DecimationAggregatorStatistic *);
+    numberOfStatistics = 0u;
+    numberOfChannels = 0u;
+    minimum = NULL_PTR(float64 *);
+    maximum = NULL_PTR(float64 *);
+    sum = NULL_PTR(float64 *);
+    last = NULL_PTR(float64 *);
+    inverseNumberOfPoints = NULL_PTR(float64 *);
+    inputTypes = NULL_PTR(TypeDescriptor *);
+    inputSignals = NULL_PTR(void **);
+    firstChannels = NULL_PTR(uint32 *);
+    inputElements = NULL_PTR(uint32 *);
+    inputSamples = NULL_PTR(uint32 *);
+    outputSignals = NULL_PTR(void **);
+    float32Outputs = NULL_PTR(bool *);
+}
+
+DecimationAggregatorGAM::~DecimationAggregatorGAM() {
+    if (statistics != NULL_PTR(DecimationAggregatorStatistic *)) {
+        delete[] statistics;
+    }
+    if (minimum != NULL_PTR(float64 *)) {
+        delete[] minimum;
+    }
+    if (maximum != NULL_PTR(float64 *)) {
+        delete[] maximum;
+    }
+    if (sum != NULL_PTR(float64 *)) {
+        delete[] sum;
+    }
+    if (last != NULL_PTR(float64 *)) {
+        delete[] last;
+    }
+    if (inverseNumberOfPoints != NULL_PTR(float64 *)) {
+        delete[] inverseNumberOfPoints;
+    }
+    if (inputTypes != NULL_PTR(TypeDescriptor *)) {
+        delete[] inputTypes;
+    }
+    if (inputSignals != NULL_PTR(void **)) {
+        delete[] inputSignals;
+    }
+    if (firstChannels != NULL_PTR(uint32 *)) {
+        delete[] firstChannels;
+    }
+    if (inputElements != NULL_PTR(uint32 *)) {
+        delete[] inputElements;
+    }
+    if (inputSamples != NULL_PTR(uint32 *)) {
+        delete[] inputSamples;
+    }
+    if (outputSignals != NULL_PTR(void **)) {
+        delete[] outputSignals;
+    }
+    if (float32Outputs != NULL_PTR(bool *)) {
+        delete[] float32Outputs;
+    }
+}
+
+bool DecimationAggregatorGAM::Initialise(StructuredDataI &data) {
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        ok = data.Read("Decimation", decimation);
+        if (ok) {
+            ok = (decimation > 0u);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Decimation shall be specified and > 0");
+        }
+    }
+    if (ok) {
+        AnyType statisticsType = data.GetType("Statistics");
+        ok = !statisticsType.IsVoid();
+        if (ok) {
+            numberOfStatistics = statisticsType.GetNumberOfElements(0u);
+            ok = (numberOfStatistics > 0u);
+        }
+        StreamString *statisticNames = NULL_PTR(StreamString *);
+        if (ok) {
+            statisticNames = new StreamString[numberOfStatistics];
+            Vector<StreamString> statisticNamesVector(statisticNames, numberOfStatistics);
+            ok = data.Read("Statistics", statisticNamesVector);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Statistics shall be specified");
+        }
+        if (ok) {
+            statistics = new DecimationAggregatorStatistic[numberOfStatistics];
+        }
+        for (uint32 i = 0u; (i < numberOfStatistics) && (ok); i++) {
+            /*lint -e{613} statisticNames and statistics cannot be NULL as otherwise ok would be false*/
+            if (statisticNames[i] == "Min") {
+                statistics[i] = DecimationAggregatorMin;
+            }
+            else if (statisticNames[i] == "Max") {
+                statistics[i] = DecimationAggregatorMax;
+            }
+            else if (statisticNames[i] == "Mean") {
+                statistics[i] = DecimationAggregatorMean;
+            }
+            else if (statisticNames[i] == "Last") {
+                statistics[i] = DecimationAggregatorLast;
+            }
+            else if (statisticNames[i] == "Trigger") {
+                statistics[i] = DecimationAggregatorTrigger;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Unsupported statistic %s (expected Min, Max, Mean, Last or Trigger)",
+                             statisticNames[i].Buffer());
+                ok = false;
+            }
+        }
+        if (statisticNames != NULL_PTR(StreamString *)) {
+            delete[] statisticNames;
+        }
+    }
+    return ok;
+}
+
+bool DecimationAggregatorGAM::Setup() {
+    uint32 numberOfInputs = GetNumberOfInputSignals();
+    bool ok = (numberOfInputs > 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "At least one input signal shall be specified");
+    }
+    if (ok) {
+        ok = (GetNumberOfOutputSignals() == numberOfStatistics);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The number of output signals shall be the number of Statistics (%u)", numberOfStatistics);
+        }
+    }
+    if (ok) {
+        inputTypes = new TypeDescriptor[numberOfInputs];
+        inputSignals = new void*[numberOfInputs];
+        firstChannels = new uint32[numberOfInputs];
+        inputElements = new uint32[numberOfInputs];
+        inputSamples = new uint32[numberOfInputs];
+    }
+    for (uint32 i = 0u; (i < numberOfInputs) && (ok); i++) {
+        inputTypes[i] = GetSignalType(InputSignals, i);
+        ok = IsSupportedInputType(inputTypes[i]);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The type of the input signal %u shall be uint8, int8, uint16, int16, uint32, int32, float32 or float64", i);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(InputSignals, i, inputElements[i]);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(InputSignals, i, inputSamples[i]);
+        }
+        if (ok) {
+            firstChannels[i] = numberOfChannels;
+            numberOfChannels += inputElements[i];
+            inputSignals[i] = GetInputSignalMemory(i);
+        }
+    }
+    if (ok) {
+        minimum = new float64[numberOfChannels];
+        maximum = new float64[numberOfChannels];
+        sum = new float64[numberOfChannels];
+        last = new float64[numberOfChannels];
+        inverseNumberOfPoints = new float64[numberOfChannels];
+        for (uint32 i = 0u; i < numberOfInputs; i++) {
+            float64 inverse = 1.0 / (static_cast<float64>(decimation) * static_cast<float64>(inputSamples[i]));
+            for (uint32 e = 0u; e < inputElements[i]; e++) {
+                inverseNumberOfPoints[firstChannels[i] + e] = inverse;
+                last[firstChannels[i] + e] = 0.0;
+            }
+        }
+        Reset();
+        outputSignals = new void*[numberOfStatistics];
+        float32Outputs = new bool[numberOfStatistics];
+    }
+    for (uint32 i = 0u; (i < numberOfStatistics) && (ok); i++) {
+        TypeDescriptor outputType = GetSignalType(OutputSignals, i);
+        uint32 numberOfElements = 0u;
+        uint32 numberOfSamples = 0u;
+        ok = GetSignalNumberOfElements(OutputSignals, i, numberOfElements);
+        if (ok) {
+            ok = GetSignalNumberOfSamples(OutputSignals, i, numberOfSamples);
+            numberOfElements *= numberOfSamples;
+        }
+        /*lint -e{613} statistics cannot be NULL as otherwise numberOfStatistics would be 0*/
+        if ((ok) && (statistics[i] == DecimationAggregatorTrigger)) {
+            ok = ((outputType == UnsignedInteger8Bit) && (numberOfElements == 1u));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The Trigger output signal (%u) shall be a uint8 with one element", i);
+            }
+        }
+        else if (ok) {
+            ok = (((outputType == Float32Bit) || (outputType == Float64Bit)) && (numberOfElements == numberOfChannels));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The output signal %u shall be float32 or float64 with %u elements", i, numberOfChannels);
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Could not read the number of elements of the output signal %u", i);
+        }
+        if (ok) {
+            outputSignals[i] = GetOutputSignalMemory(i);
+            float32Outputs[i] = (outputType == Float32Bit);
+            if (statistics[i] == DecimationAggregatorTrigger) {
+                *static_cast<uint8 *>(outputSignals[i]) = 0u;
+            }
+        }
+    }
+    return ok;
+}
+
+bool DecimationAggregatorGAM::Execute() {
+    uint32 numberOfInputs = GetNumberOfInputSignals();
+    /*lint -e{613} the buffers cannot be NULL as Execute is only called after a successful Setup*/
+    for (uint32 i = 0u; i < numberOfInputs; i++) {
+        if (inputTypes[i] == UnsignedInteger8Bit) {
+            Accumulate<uint8>(i, static_cast<uint8 *>(inputSignals[i]));
+        }
+        else if (inputTypes[i] == SignedInteger8Bit) {
+            Accumulate<int8>(i, static_cast<int8 *>(inputSignals[i]));
+        }
+        else if (inputTypes[i] == UnsignedInteger16Bit) {
+            Accumulate<uint16>(i, static_cast<uint16 *>(inputSignals[i]));
+        }
+        else if (inputTypes[i] == SignedInteger16Bit) {
+            Accumulate<int16>(i, static_cast<int16 *>(inputSignals[i]));
+        }
+        else if (inputTypes[i] == UnsignedInteger32Bit) {
+            Accumulate<uint32>(i, static_cast<uint32 *>(inputSignals[i]));
+        }
+        else if (inputTypes[i] == SignedInteger32Bit) {
+            Accumulate<int32>(i, static_cast<int32 *>(inputSignals[i]));
+        }
+        else if (inputTypes[i] == Float32Bit) {
+            Accumulate<float32>(i, static_cast<float32 *>(inputSignals[i]));
+        }
+        else {
+            Accumulate<float64>(i, static_cast<float64 *>(inputSignals[i]));
+        }
+    }
+    cycle++;
+    bool windowCompleted = (cycle == decimation);
+    if (windowCompleted) {
+        WriteOutputs();
+        numberOfWindows++;
+        cycle = 0u;
+        Reset();
+    }
+    for (uint32 i = 0u; i < numberOfStatistics; i++) {
+        if (statistics[i] == DecimationAggregatorTrigger) {
+            *static_cast<uint8 *>(outputSignals[i]) = static_cast<uint8>(windowCompleted ? 1u : 0u);
+        }
+    }
+    return true;
+}
+
+uint32 DecimationAggregatorGAM::GetDecimation() const {
+    return decimation;
+}
+
+uint32 DecimationAggregatorGAM::GetNumberOfChannels() const {
+    return numberOfChannels;
+}
+
+uint32 DecimationAggregatorGAM::GetNumberOfWindows() const {
+    return numberOfWindows;
+}
+
+template<typename T>
+void DecimationAggregatorGAM::Accumulate(const uint32 signalIdx,
+                                         const T * const input) {
+    /*lint -e{613} the buffers cannot be NULL as Accumulate is only called after a successful Setup*/
+    uint32 numberOfElements = inputElements[signalIdx];
+    uint32 numberOfSamples = inputSamples[signalIdx];
+    float64 * const channelMinimum = &minimum[firstChannels[signalIdx]];
+    float64 * const channelMaximum = &maximum[firstChannels[signalIdx]];
+    float64 * const channelSum = &sum[firstChannels[signalIdx]];
+    float64 * const channelLast = &last[firstChannels[signalIdx]];
+    const T *sample = input;
+    for (uint32 s = 0u; s < numberOfSamples; s++) {
+        //Branch-free update of independent arrays, which the compiler can vectorise.
+        for (uint32 e = 0u; e < numberOfElements; e++) {
+            float64 value = static_cast<float64>(sample[e]);
+            channelMinimum[e] = (value < channelMinimum[e]) ? (value) : (channelMinimum[e]);
+            channelMaximum[e] = (value > channelMaximum[e]) ? (value) : (channelMaximum[e]);
+            channelSum[e] += value;
+            channelLast[e] = value;
+        }
+        sample = &sample[numberOfElements];
+    }
+}
+
+void DecimationAggregatorGAM::WriteOutputs() {
+    /*lint -e{613} the buffers cannot be NULL as WriteOutputs is only called after a successful Setup*/
+    for (uint32 i = 0u; i < numberOfStatistics; i++) {
+        const float64 *values = NULL_PTR(const float64 *);
+        const float64 *scale = NULL_PTR(const float64 *);
+        if (statistics[i] == DecimationAggregatorMin) {
+            values = minimum;
+        }
+        else if (statistics[i] == DecimationAggregatorMax) {
+            values = maximum;
+        }
+        else if (statistics[i] == DecimationAggregatorMean) {
+            values = sum;
+            scale = inverseNumberOfPoints;
+        }
+        else if (statistics[i] == DecimationAggregatorLast) {
+            values = last;
+        }
+        else {
+            //Trigger, written by Execute.
+        }
+        if (values != NULL_PTR(const float64 *)) {
+            if (float32Outputs[i]) {
+                WriteOutput<float32>(i, values, scale);
+            }
+            else {
+                WriteOutput<float64>(i, values, scale);
+            }
+        }
+    }
+}
+
+template<typename T>
+void DecimationAggregatorGAM::WriteOutput(const uint32 signalIdx,
+                                          const float64 * const values,
+                                          const float64 * const scale) {
+    /*lint -e{613} the buffers cannot be NULL as WriteOutput is only called after a successful Setup*/
+    T * const output = static_cast<T *>(outputSignals[signalIdx]);
+    if (scale != NULL_PTR(const float64 *)) {
+        for (uint32 c = 0u; c < numberOfChannels; c++) {
+            output[c] = static_cast<T>(values[c] * scale[c]);
+        }
+    }
+    else {
+        for (uint32 c = 0u; c < numberOfChannels; c++) {
+            output[c] = static_cast<T>(values[c]);
+        }
+    }
+}
+
+void DecimationAggregatorGAM::Reset() {
+    /*lint -e{613} the buffers cannot be NULL as Reset is only called after a successful Setup*/
+    for (uint32 c = 0u; c < numberOfChannels; c++) {
+        minimum[c] = MAX_FLOAT64;
+        maximum[c] = -MAX_FLOAT64;
+        sum[c] = 0.0;
+    }
+}
+
+CLASS_REGISTER(DecimationAggregatorGAM, "1.0")
+}
@@ -0,0 +1,267 @@
+/**
+ * @file DecimationAggregatorGAM.h
+ * @brief Header file for class DecimationAggregatorGAM
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class DecimationAggregatorGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef DECIMATIONAGGREGATORGAM_H_
+#define DECIMATIONAGGREGATORGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief The statistics which can be written by the DecimationAggregatorGAM.
+ */
+enum DecimationAggregatorStatistic {
+    DecimationAggregatorMin = 0,
+    DecimationAggregatorMax = 1,
+    DecimationAggregatorMean = 2,
+    DecimationAggregatorLast = 3,
+    DecimationAggregatorTrigger = 4
+};
+
+/**
+ * @brief GAM which reduces fast signals to the min, max, mean and last value of each window of Decimation cycles (e.g. to publish
+ * 10 kHz signals to EPICS, OPC UA or slow MDSplus nodes at 10 Hz, or to plot their envelope).
+ * @details Each element of each input signal is a channel; the channels of all the input signals are numbered one after the other in the
+ * order of declaration of the signals (e.g. with two input signals of 3 and 2 elements the channels 0 to 2 are the first signal and 3 to 4 the
+ * second). If an input signal has more than one sample, all the samples of each element are aggregated in the channel.
+ *
+ * The statistics of all the channels are accumulated in a structure of arrays (one array of min, max, sum and last value, each with one
+ * element per channel), updated in a single pass over each input signal which is specialised for its type and reads the signal memory
+ * sequentially. Every Decimation cycles the statistics of the window are written to the output signals and the accumulators are reset.
+ * The output signals hold their values between two windows.
+ *
+ * Each output signal holds one statistic of all the channels, as listed in Statistics (one entry per output signal, in the order of
+ * declaration): Min, Max, Mean and Last shall be float32 or float64 arrays with one element per channel. Trigger shall be a uint8 and is 1
+ * in the cycles where a window is completed (and the other statistics are updated) and 0 otherwise (e.g. to trigger a slow writer).
+ *
+ * The input signals can be uint8, int8, uint16, int16, uint32, int32, float32 or float64.
+ *
+ * The configuration syntax is (names and signal quantities are only given as an example):
+ *
+ * <pre>
+ * +Aggregator = {
+ *     Class = DecimationAggregatorGAM
+ *     Decimation = 1000 //Compulsory. Number of cycles of each window.
+ *     Statistics = {Min Max Mean Last Trigger} //Compulsory. The statistic of each output signal.
+ *     InputSignals = {
+ *         Currents = {
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 3
+ *         }
+ *         Voltage = {
+ *             DataSource = DDB1
+ *             Type = int16
+ *             NumberOfSamples = 10
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Min = {
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 4
+ *         }
+ *         Max = {
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 4
+ *         }
+ *         Mean = {
+ *             DataSource = DDB1
+ *             Type = float64
+ *             NumberOfElements = 4
+ *         }
+ *         Last = {
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 4
+ *         }
+ *         Trigger = {
+ *             DataSource = DDB1
+ *             Type = uint8
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class DecimationAggregatorGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     * @post
+     *   GetDecimation() == 0u
+     *   GetNumberOfChannels() == 0u
+     *   GetNumberOfWindows() == 0u
+     */
+    DecimationAggregatorGAM();
+
+    /**
+     * @brief Frees the accumulators.
+     */
+    virtual ~DecimationAggregatorGAM();
+
+    /**
+     * @brief Reads the Decimation and the Statistics.
+     * @return true if GAM::Initialise succeeds, Decimation > 0 and all the Statistics are Min, Max, Mean, Last or Trigger.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals and allocates the accumulators.
+     * @return true if the input signals have a supported type, the number of output signals is the number of Statistics and each output
+     * signal has the type and the number of elements of its statistic.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Accumulates the input signals and, at the end of each window, writes the output signals.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Gets the number of cycles of each window.
+     */
+    uint32 GetDecimation() const;
+
+    /**
+     * @brief Gets the number of channels (valid after Setup).
+     */
+    uint32 GetNumberOfChannels() const;
+
+    /**
+     * @brief Gets the number of windows completed.
+     */
+    uint32 GetNumberOfWindows() const;
+
+private:
+
+    /**
+     * @brief Accumulates an input signal in its channels.
+     * @param[in] signalIdx the index of the input signal.
+     * @param[in] input the memory of the input signal.
+     */
+    template<typename T>
+    void Accumulate(const uint32 signalIdx,
+                    const T * const input);
+
+    /**
+     * @brief Writes the statistics of the window in the output signals.
+     */
+    void WriteOutputs();
+
+    /**
+     * @brief Writes a statistic in an output signal.
+     * @param[in] signalIdx the index of the output signal.
+     * @param[in] values the values of the statistic of each channel.
+     * @param[in] scale the factor which multiplies each value (or NULL).
+     */
+    template<typename T>
+    void WriteOutput(const uint32 signalIdx,
+                     const float64 * const values,
+                     const float64 * const scale);
+
+    /**
+     * @brief Resets the accumulators.
+     */
+    void Reset();
+
+    /**
+     * The number of cycles of each window.
+     */
+    uint32 decimation;
+
+    /**
+     * The number of cycles accumulated in the current window.
+     */
+    uint32 cycle;
+
+    /**
+     * The number of windows completed.
+     */
+    uint32 numberOfWindows;
+
+    /**
+     * The statistic of each output signal.
+     */
+    DecimationAggregatorStatistic *statistics;
+
+    /**
+     * The number of statistics.
+     */
+    uint32 numberOfStatistics;
+
+    /**
+     * The number of channels.
+     */
+    uint32 numberOfChannels;
+
+    /**
+     * The accumulators of each channel (structure of arrays).
+     */
+    float64 *minimum;
+    float64 *maximum;
+    float64 *sum;
+    float64 *last;
+
+    /**
+     * The inverse of the number of points of each channel in a window.
+     */
+    float64 *inverseNumberOfPoints;
+
+    /**
+     * The type, the memory, the first channel, the number of elements and the number of samples of each input signal.
+     */
+    TypeDescriptor *inputTypes;
+    void **inputSignals;
+    uint32 *firstChannels;
+    uint32 *inputElements;
+    uint32 *inputSamples;
+
+    /**
+     * The memory of each output signal and true if the output signal is float32 (float64 otherwise).
+     */
+    void **outputSignals;
+    bool *float32Outputs;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DECIMATIONAGGREGATORGAM_H_ */
@@ -0,0 +1,429 @@
+/**
+ * @file DecimatorGAM.cpp
+ * @brief Source file for class DecimatorGAM
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DecimatorGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "DecimatorGAM.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+DecimatorGAM::DecimatorGAM() :
+        GAM(),
+        StatefulI() {
+    num = NULL_PTR(float32 *);
+    polyphase = NULL_PTR(float32 *);
+    numberOfNumCoeff = 0u;
+    phaseLength = 0u;
+    factor = 0u;
+    interpolate = false;
+    history = NULL_PTR(float32 **);
+    numberOfLastInputs = 0u;
+    input = NULL_PTR(void **);
+    output = NULL_PTR(void **);
+    inputType = Float32Bit;
+    outputType = Float32Bit;
+    numberOfSignals = 0u;
+    numberOfInputSamples = 0u;
+    numberOfOutputSamples = 0u;
+    resetInEachState = true;
+}
+
+DecimatorGAM::~DecimatorGAM() {
+    if (num != NULL_PTR(float32 *)) {
+        delete[] num;
+    }
+    if (polyphase != NULL_PTR(float32 *)) {
+        delete[] polyphase;
+    }
+    if (history != NULL_PTR(float32 **)) {
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            if (history[i] != NULL_PTR(float32 *)) {
+                delete[] history[i];
+            }
+        }
+        delete[] history;
+    }
+    if (input != NULL_PTR(void **)) {
+        delete[] input;
+    }
+    if (output != NULL_PTR(void **)) {
+        delete[] output;
+    }
+}
+
+bool DecimatorGAM::Initialise(StructuredDataI& data) {
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        AnyType functionsArray = data.GetType("Num");
+        ok = (functionsArray.GetDataPointer() != NULL);
+        if (ok) {
+            numberOfNumCoeff = functionsArray.GetNumberOfElements(0u);
+            ok = (numberOfNumCoeff > 0u);
+        }
+        if (ok) {
+            num = new float32[numberOfNumCoeff];
+            Vector<float32> numVector(num, numberOfNumCoeff);
+            ok = data.Read("Num", numVector);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading the numerator (Num)");
+        }
+    }
+    if (ok) {
+        ok = data.Read("Factor", factor);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Factor not specified");
+        }
+    }
+    if (ok) {
+        ok = (factor > 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Factor must be > 1");
+        }
+    }
+    if (ok) {
+        StreamString mode;
+        if (data.Read("Mode", mode)) {
+            if (mode == "Interpolate") {
+                interpolate = true;
+            }
+            else {
+                ok = (mode == "Decimate");
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for Mode (expected values Decimate or Interpolate)");
+                }
+            }
+        }
+    }
+    if (ok) {
+        uint32 aux;
+        if (!data.Read("ResetInEachState", aux)) {
+            REPORT_ERROR(ErrorManagement::Warning, "ResetInEachState not specified. resetInEachState = true by default ");
+        }
+        else if (aux == 1u) {
+            resetInEachState = true;
+        }
+        else if (aux == 0u) {
+            resetInEachState = false;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for ResetInEachState (expected values 0 or 1)");
+            ok = false;
+        }
+    }
+    //Polyphase decomposition. The sub-filter k holds num[k], num[L+k], num[2L+k]...
+    if ((ok) && (interpolate)) {
+        phaseLength = (numberOfNumCoeff + (factor - 1u)) / factor;
+        polyphase = new float32[phaseLength * factor];
+        for (uint32 k = 0u; k < factor; k++) {
+            for (uint32 j = 0u; j < phaseLength; j++) {
+                uint32 idx = (j * factor) + k;
+                polyphase[(k * phaseLength) + j] = (idx < numberOfNumCoeff) ? num[idx] : 0.0F;
+            }
+        }
+    }
+    return ok;
+}
+
+bool DecimatorGAM::Setup() {
+    numberOfSignals = GetNumberOfInputSignals();
+    bool ok = (numberOfSignals > 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "numberOfSignals must be positive");
+    }
+    if (ok) {
+        uint32 numberOfOutputSignals = GetNumberOfOutputSignals();
+        ok = (numberOfOutputSignals == numberOfSignals);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "numberOfOutputSignals = %u != %u = numberOfInputSignals", numberOfOutputSignals, numberOfSignals);
+        }
+    }
+    if (ok) {
+        inputType = GetSignalType(InputSignals, 0u);
+        outputType = GetSignalType(OutputSignals, 0u);
+        ok = GetSignalNumberOfElements(InputSignals, 0u, numberOfInputSamples);
+    }
+    for (uint32 i = 0u; (i < numberOfSignals) && (ok); i++) {
+        uint32 auxIndex = i;
+        uint32 numberOfSamples;
+        uint32 numberOfElements;
+        ok = GetSignalNumberOfSamples(InputSignals, i, numberOfSamples);
+        if (ok) {
+            ok = (numberOfSamples == 1u);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(OutputSignals, i, numberOfSamples);
+        }
+        if (ok) {
+            ok = (numberOfSamples == 1u);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The number of samples of the signal %u must be 1", auxIndex);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(InputSignals, i, numberOfElements);
+        }
+        if (ok) {
+            ok = ((numberOfElements == numberOfInputSamples) && (numberOfElements > 0u));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "All the input signals must have the same (non zero) number of elements");
+            }
+        }
+        if (ok) {
+            TypeDescriptor signalType = GetSignalType(InputSignals, i);
+            ok = ((signalType == SignedInteger16Bit) || (signalType == SignedInteger32Bit) || (signalType == Float32Bit) || (signalType == Float64Bit));
+            if (ok) {
+                ok = (signalType == inputType);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The input signal %u must be int16, int32, float32 or float64 (the same for all the signals)", auxIndex);
+            }
+        }
+        if (ok) {
+            TypeDescriptor signalType = GetSignalType(OutputSignals, i);
+            ok = ((signalType == Float32Bit) || (signalType == Float64Bit));
+            if (ok) {
+                ok = (signalType == outputType);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The output signal %u must be float32 or float64 (the same for all the signals)", auxIndex);
+            }
+        }
+    }
+    if ((ok) && (!interpolate)) {
+        ok = ((numberOfInputSamples % factor) == 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The number of input elements (%u) must be a multiple of Factor (%u)", numberOfInputSamples, factor);
+        }
+    }
+    if (ok) {
+        numberOfOutputSamples = interpolate ? (numberOfInputSamples * factor) : (numberOfInputSamples / factor);
+        numberOfLastInputs = interpolate ? (phaseLength - 1u) : (numberOfNumCoeff - 1u);
+    }
+    for (uint32 i = 0u; (i < numberOfSignals) && (ok); i++) {
+        uint32 numberOfElements;
+        ok = GetSignalNumberOfElements(OutputSignals, i, numberOfElements);
+        if (ok) {
+            ok = (numberOfElements == numberOfOutputSamples);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The output signals must have %u elements", numberOfOutputSamples);
+        }
+    }
+    if (ok) {
+        input = new void *[numberOfSignals];
+        output = new void *[numberOfSignals];
+        history = new float32 *[numberOfSignals];
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            input[i] = GetInputSignalMemory(i);
+            output[i] = GetOutputSignalMemory(i);
+            history[i] = new float32[numberOfLastInputs + numberOfInputSamples];
+        }
+        ResetHistory();
+    }
+    return ok;
+}
+
+bool DecimatorGAM::Execute() {
+    if (inputType == SignedInteger16Bit) {
+        ExecuteOutputType<int16>();
+    }
+    else if (inputType == SignedInteger32Bit) {
+        ExecuteOutputType<int32>();
+    }
+    else if (inputType == Float64Bit) {
+        ExecuteOutputType<float64>();
+    }
+    else {
+        ExecuteOutputType<float32>();
+    }
+    return true;
+}
+
+template<typename InputType>
+void DecimatorGAM::ExecuteOutputType() {
+    if (outputType == Float64Bit) {
+        if (interpolate) {
+            ExecuteInterpolate<InputType, float64>();
+        }
+        else {
+            ExecuteDecimate<InputType, float64>();
+        }
+    }
+    else {
+        if (interpolate) {
+            ExecuteInterpolate<InputType, float32>();
+        }
+        else {
+            ExecuteDecimate<InputType, float32>();
+        }
+    }
+}
+
+template<typename InputType>
+float32 *DecimatorGAM::LoadHistory(const uint32 signalIdx) {
+    float32 * const signalHistory = history[signalIdx];
+    const InputType * const x = static_cast<const InputType *>(input[signalIdx]);
+    float32 * const current = &signalHistory[numberOfLastInputs];
+    for (uint32 n = 0u; n < numberOfInputSamples; n++) {
+        current[n] = static_cast<float32>(x[n]);
+    }
+    return signalHistory;
+}
+
+void DecimatorGAM::ShiftHistory(float32 * const signalHistory) const {
+    if (numberOfLastInputs > 0u) {
+        (void) MemoryOperationsHelper::Move(signalHistory, &signalHistory[numberOfInputSamples], numberOfLastInputs * static_cast<uint32>(sizeof(float32)));
+    }
+}
+
+template<typename InputType, typename OutputType>
+void DecimatorGAM::ExecuteDecimate() {
+    //if due to MISRA rules...
+    if ((input != NULL_PTR(void **)) && (output != NULL_PTR(void **)) && (history != NULL_PTR(float32 **)) && (num != NULL_PTR(float32 *))) {
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            const float32 * const x = LoadHistory<InputType>(i);
+            OutputType * const y = static_cast<OutputType *>(output[i]);
+            //only the kept outputs (the input sample m * factor) are computed
+            for (uint32 m = 0u; m < numberOfOutputSamples; m++) {
+                const float32 * const xNow = &x[numberOfLastInputs + (m * factor)];
+                float32 accumulator = 0.0F;
+                for (uint32 k = 0u; k < numberOfNumCoeff; k++) {
+                    accumulator += *(xNow - k) * num[k];
+                }
+                y[m] = static_cast<OutputType>(accumulator);
+            }
+            ShiftHistory(history[i]);
+        }
+    }
+}
+
+template<typename InputType, typename OutputType>
+void DecimatorGAM::ExecuteInterpolate() {
+    //if due to MISRA rules...
+    if ((input != NULL_PTR(void **)) && (output != NULL_PTR(void **)) && (history != NULL_PTR(float32 **)) && (polyphase != NULL_PTR(float32 *))) {
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            const float32 * const x = LoadHistory<InputType>(i);
+            OutputType * const y = static_cast<OutputType *>(output[i]);
+            for (uint32 m = 0u; m < numberOfInputSamples; m++) {
+                const float32 * const xNow = &x[numberOfLastInputs + m];
+                //each output phase is computed with its sub-filter (the inserted zeros are never multiplied)
+                for (uint32 k = 0u; k < factor; k++) {
+                    const float32 * const subFilter = &polyphase[k * phaseLength];
+                    float32 accumulator = 0.0F;
+                    for (uint32 j = 0u; j < phaseLength; j++) {
+                        accumulator += *(xNow - j) * subFilter[j];
+                    }
+                    y[(m * factor) + k] = static_cast<OutputType>(accumulator);
+                }
+            }
+            ShiftHistory(history[i]);
+        }
+    }
+}
+
+void DecimatorGAM::ResetHistory() {
+    if (history != NULL_PTR(float32 **)) {
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            if (history[i] != NULL_PTR(float32 *)) {
+                for (uint32 n = 0u; n < (numberOfLastInputs + numberOfInputSamples); n++) {
+                    history[i][n] = 0.0F;
+                }
+            }
+        }
+    }
+}
+
+bool DecimatorGAM::PrepareNextState(const char8 * const currentStateName,
+                                    const char8 * const nextStateName) {
+    bool ret = (history != NULL_PTR(float32 **));
+    if (!ret) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "The states of the decimator are not allocated");
+    }
+    else if (resetInEachState) {
+        ResetHistory();
+    }
+    else {
+        //If the currentStateName and lastStateExecuted are different-> rest values
+        if (lastStateExecuted != currentStateName) {
+            ResetHistory();
+        }
+        lastStateExecuted = nextStateName;
+    }
+    return ret;
+}
+
+bool DecimatorGAM::GetResetInEachState() const {
+    return resetInEachState;
+}
+
+uint32 DecimatorGAM::GetFactor() const {
+    return factor;
+}
+
+bool DecimatorGAM::IsInterpolator() const {
+    return interpolate;
+}
+
+uint32 DecimatorGAM::GetNumberOfNumCoeff() const {
+    return numberOfNumCoeff;
+}
+
+bool DecimatorGAM::GetNumCoeff(float32 * const coeff) const {
+    bool ret = (num != NULL_PTR(float32 *));
+    if (ret) {
+        for (uint32 k = 0u; k < numberOfNumCoeff; k++) {
+            coeff[k] = num[k];
+        }
+    }
+    return ret;
+}
+
+uint32 DecimatorGAM::GetNumberOfSignals() const {
+    return numberOfSignals;
+}
+
+uint32 DecimatorGAM::GetNumberOfInputSamples() const {
+    return numberOfInputSamples;
+}
+
+uint32 DecimatorGAM::GetNumberOfOutputSamples() const {
+    return numberOfOutputSamples;
+}
+
+CLASS_REGISTER(DecimatorGAM, "1.0")
+}
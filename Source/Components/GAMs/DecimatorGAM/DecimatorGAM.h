@@ -0,0 +1,337 @@
+/**
+ * @file DecimatorGAM.h
+ * @brief Header file for class DecimatorGAM
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class DecimatorGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef DECIMATORGAM_H_
+#define DECIMATORGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GAM.h"
+#include "StatefulI.h"
+#include "StreamString.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+/**
+ * @brief GAM which implements a polyphase FIR decimator (or interpolator).
+ * @details The GAM filters each input signal with the FIR filter of coefficients Num (with the same semantics of the FilterGAM with Den = {1})
+ * and changes the sample rate by the integer Factor (L). Only the outputs which are kept are computed.
+ *
+ * With Mode = Decimate (default), the output has NumberOfSamples / L samples (NumberOfSamples must be a multiple of L):
+ *
+ * \f$
+ * y[m] = \sum_{k=0}^{M-1}num[k]*x[m*L-k]
+ * \f$
+ *
+ * where M is the number of numerator coefficients. The cost is M multiply-accumulates per output sample, i.e. M / L per input sample,
+ * which is the cost of the polyphase decomposition of the filter.
+ *
+ * With Mode = Interpolate, the output has NumberOfSamples * L samples. The input is (conceptually) upsampled inserting L - 1 zeros between
+ * samples and filtered. The zeros are never multiplied: the filter is decomposed in L polyphase sub-filters of ceil(M / L) coefficients,
+ * p[k] = num[j*L+k] (zero padded), and each output phase is computed with its sub-filter:
+ *
+ * \f$
+ * y[m*L+k] = \sum_{j=0}^{ceil(M/L)-1}num[j*L+k]*x[m-j]
+ * \f$
+ *
+ * Note that the interpolated signal has the gain of the filter divided by L (i.e. the coefficients should be scaled by L to preserve the amplitude).
+ *
+ * The last input samples required by the filter are kept, for each signal, just before the samples of the current cycle, so that the
+ * inner loops have no branches. The states are reset as in the FilterGAM (see ResetInEachState and PrepareNextState()).
+ *
+ * All the input signals must have the same number of elements and the same type (int16, int32, float32 or float64).
+ * All the output signals must have the same type (float32 or float64). The arithmetic is performed in float32.
+ *
+ * The configuration syntax is (names and signal quantity are only given as an example):
+ *
+ * <pre>
+ * +Decimator1 = {
+ *     Class = DecimatorGAM
+ *     Num = {0.25 0.25 0.25 0.25} //Compulsory. Filter numerator coefficients.
+ *     Factor = 4 //Compulsory. Decimation (or interpolation) factor. Must be > 1.
+ *     Mode = Decimate //Optional. Decimate (default) or Interpolate.
+ *     ResetInEachState = 1 //Optional. If 1 (default) the states will be reset on each state change. Otherwise they will be reset only if the GAM was not used in the previous state.
+ *     InputSignals = {
+ *         InputSignal1 = {
+ *             DataSource = "DDB1"
+ *             Type = int16 //int16, int32, float32 or float64
+ *             NumberOfElements = 2000
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         OutputSignal1 = {
+ *             DataSource = "DDB1"
+ *             Type = float32 //float32 or float64
+ *             NumberOfElements = 500 //2000 / Factor if Mode = Decimate or 2000 * Factor if Mode = Interpolate.
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class DecimatorGAM: public GAM, public StatefulI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default constructor.
+     * @post
+     *   GetNumberOfNumCoeff() = 0 &&
+     *   GetFactor() = 0 &&
+     *   IsInterpolator() = false &&
+     *   GetNumberOfSignals() = 0 &&
+     *   GetNumberOfInputSamples() = 0 &&
+     *   GetNumberOfOutputSamples() = 0 &&
+     *   GetResetInEachState() = true
+     */
+    DecimatorGAM();
+
+    /**
+     * @brief Frees the allocated memory.
+     */
+    virtual ~DecimatorGAM();
+
+    /**
+     * @brief Reads the coefficients, the Factor, the Mode and the ResetInEachState.
+     * @details In interpolation mode the coefficients are reordered in Factor polyphase sub-filters.
+     * @param[in] data the GAM configuration.
+     * @return true if the parameters are valid (see class description).
+     */
+    virtual bool Initialise(StructuredDataI & data);
+
+    /**
+     * @brief Verifies the signals and allocates the states.
+     * @details Checks that the number of input and output signals is the same and non zero, that all the input signals have the same
+     * number of elements and type, that the number of input elements is a multiple of Factor (Mode = Decimate) and that the number of output
+     * elements is the number of input elements / Factor (Mode = Decimate) or * Factor (Mode = Interpolate).
+     * @return true if the signals are valid.
+     * @pre
+     *   Initialise()
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Decimates (or interpolates) all the signals.
+     * @return true
+     * @pre
+     *   Setup()
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Resets the states if necessary (see FilterGAM::PrepareNextState()).
+     * @return true if the states are allocated.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief Queries the value of resetInEachState
+     * @return resetInEachState
+     */
+    bool GetResetInEachState() const;
+
+    /**
+     * @brief Gets the decimation (or interpolation) factor.
+     * @return the Factor.
+     */
+    uint32 GetFactor() const;
+
+    /**
+     * @brief Queries if the GAM interpolates (Mode = Interpolate).
+     * @return true if Mode = Interpolate.
+     */
+    bool IsInterpolator() const;
+
+    /**
+     * @brief Gets the number of numerator coefficients.
+     * @return the number of numerator coefficients.
+     */
+    uint32 GetNumberOfNumCoeff() const;
+
+    /**
+     * @brief Gets the numerator coefficients (in the configured order).
+     * @param[in] coeff pointer to where the coefficients will be copied to.
+     * @return true if the coefficients were loaded.
+     */
+    bool GetNumCoeff(float32 * const coeff) const;
+
+    /**
+     * @brief Gets the number of signals.
+     * @return the number of signals.
+     */
+    uint32 GetNumberOfSignals() const;
+
+    /**
+     * @brief Gets the number of samples of each input signal.
+     * @return the number of input samples.
+     */
+    uint32 GetNumberOfInputSamples() const;
+
+    /**
+     * @brief Gets the number of samples of each output signal.
+     * @return the number of output samples.
+     */
+    uint32 GetNumberOfOutputSamples() const;
+
+private:
+
+    /**
+     * @brief Decimates all the signals.
+     */
+    template<typename InputType, typename OutputType>
+    void ExecuteDecimate();
+
+    /**
+     * @brief Interpolates all the signals.
+     */
+    template<typename InputType, typename OutputType>
+    void ExecuteInterpolate();
+
+    /**
+     * @brief Calls ExecuteDecimate() or ExecuteInterpolate() for the type of the output signals.
+     */
+    template<typename InputType>
+    void ExecuteOutputType();
+
+    /**
+     * @brief Copies the input of the signal after its last samples.
+     * @param[in] signalIdx the signal index.
+     * @return the history of the signal.
+     */
+    template<typename InputType>
+    float32 *LoadHistory(const uint32 signalIdx);
+
+    /**
+     * @brief Keeps the most recent samples of the history for the next cycle.
+     * @param[in,out] signalHistory the history of the signal.
+     */
+    void ShiftHistory(float32 * const signalHistory) const;
+
+    /**
+     * @brief Sets all the states to zero.
+     */
+    void ResetHistory();
+
+    /**
+     * The numerator coefficients
+     */
+    float32 *num;
+
+    /**
+     * The polyphase sub-filters (interpolation): factor rows of phaseLength coefficients
+     */
+    float32 *polyphase;
+
+    /**
+     * Number of numerator coefficients
+     */
+    uint32 numberOfNumCoeff;
+
+    /**
+     * Number of coefficients of each polyphase sub-filter
+     */
+    uint32 phaseLength;
+
+    /**
+     * Decimation (or interpolation) factor
+     */
+    uint32 factor;
+
+    /**
+     * True if Mode = Interpolate
+     */
+    bool interpolate;
+
+    /**
+     * For each signal, the last numberOfLastInputs samples followed by the numberOfInputSamples of the current cycle (oldest first)
+     */
+    float32 **history;
+
+    /**
+     * Number of last input samples kept between cycles
+     */
+    uint32 numberOfLastInputs;
+
+    /**
+     * Array of pointers to the input buffers
+     */
+    void **input;
+
+    /**
+     * Array of pointers to the output buffers
+     */
+    void **output;
+
+    /**
+     * Type of the input signals
+     */
+    TypeDescriptor inputType;
+
+    /**
+     * Type of the output signals
+     */
+    TypeDescriptor outputType;
+
+    /**
+     * Number of signals
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * Number of samples of each input signal
+     */
+    uint32 numberOfInputSamples;
+
+    /**
+     * Number of samples of each output signal
+     */
+    uint32 numberOfOutputSamples;
+
+    /**
+     * Indicates if the states must be reset in each state change
+     */
+    bool resetInEachState;
+
+    /**
+     * Name of the last state where the GAM was executed
+     */
+    StreamString lastStateExecuted;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DECIMATORGAM_H_ */
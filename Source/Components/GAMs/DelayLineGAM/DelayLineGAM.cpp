@@ -0,0 +1,186 @@
+/**
+ * @file DelayLineGAM.cpp
+ * @brief Source file for class DelayLineGAM
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DelayLineGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "DelayLineGAM.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+DelayLineGAM::DelayLineGAM() :
+        GAM() {
+    rings = NULL_PTR(DelayLineGAMRing *);
+    numberOfRings = 0u;
+}
+
+/*lint -e{1551} the destructor must guarantee that the rings are freed.*/
+DelayLineGAM::~DelayLineGAM() {
+    if (rings != NULL_PTR(DelayLineGAMRing *)) {
+        for (uint32 i = 0u; i < numberOfRings; i++) {
+            if (rings[i].memory != NULL_PTR(uint8 *)) {
+                delete[] rings[i].memory;
+            }
+        }
+        delete[] rings;
+    }
+}
+
+bool DelayLineGAM::Setup() {
+    numberOfRings = GetNumberOfInputSignals();
+    bool ok = (numberOfRings > 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "At least one input signal shall be specified");
+    }
+    if (ok) {
+        ok = (GetNumberOfOutputSignals() == numberOfRings);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The number of output signals shall be equal to the number of input signals (%u)", numberOfRings);
+        }
+    }
+    if (ok) {
+        rings = new DelayLineGAMRing[numberOfRings];
+        for (uint32 i = 0u; i < numberOfRings; i++) {
+            rings[i].memory = NULL_PTR(uint8 *);
+            rings[i].slotSize = 0u;
+            rings[i].numberOfSlots = 0u;
+            rings[i].head = 0u;
+            rings[i].delay = 0u;
+            rings[i].window = 0u;
+            rings[i].input = NULL_PTR(const uint8 *);
+            rings[i].output = NULL_PTR(uint8 *);
+        }
+    }
+    for (uint32 i = 0u; (i < numberOfRings) && (ok); i++) {
+        /*lint -e{613} rings cannot be NULL as otherwise ok would be false*/
+        DelayLineGAMRing &ring = rings[i];
+        ok = (GetSignalType(InputSignals, i) == GetSignalType(OutputSignals, i));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The output signal %u shall have the type of the input signal %u", i, i);
+        }
+        uint32 inputSize = 0u;
+        uint32 outputSize = 0u;
+        uint32 samples = 1u;
+        if (ok) {
+            ok = GetSignalByteSize(InputSignals, i, inputSize);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(InputSignals, i, samples);
+            inputSize *= samples;
+        }
+        if (ok) {
+            ok = GetSignalByteSize(OutputSignals, i, outputSize);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(OutputSignals, i, samples);
+            outputSize *= samples;
+        }
+        if (ok) {
+            ok = signalsDatabase.MoveAbsolute("OutputSignals");
+        }
+        if (ok) {
+            ok = signalsDatabase.MoveToChild(i);
+        }
+        if (ok) {
+            bool hasDelay = signalsDatabase.Read("Delay", ring.delay);
+            bool hasWindow = signalsDatabase.Read("Window", ring.window);
+            ok = (hasDelay != hasWindow);
+            if (ok) {
+                if (hasDelay) {
+                    ok = ((ring.delay > 0u) && (outputSize == inputSize));
+                }
+                else {
+                    ok = ((ring.window > 0u) && (outputSize == (ring.window * inputSize)));
+                }
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The output signal %u shall have either a Delay (> 0) and the size of the input signal "
+                             "or a Window (> 0) and Window times the size of the input signal", i);
+            }
+        }
+        if (ok) {
+            ring.slotSize = inputSize;
+            uint32 history = (ring.delay > 0u) ? (ring.delay + 1u) : (ring.window);
+            ring.numberOfSlots = 1u;
+            while (ring.numberOfSlots < history) {
+                ring.numberOfSlots <<= 1u;
+            }
+            ring.head = ring.numberOfSlots - 1u;
+            uint32 memorySize = 2u * ring.numberOfSlots * ring.slotSize;
+            ring.memory = new uint8[memorySize];
+            ok = MemoryOperationsHelper::Set(ring.memory, '\0', memorySize);
+        }
+        if (ok) {
+            ring.input = static_cast<const uint8 *>(GetInputSignalMemory(i));
+            ring.output = static_cast<uint8 *>(GetOutputSignalMemory(i));
+        }
+    }
+    return ok;
+}
+
+bool DelayLineGAM::Execute() {
+    for (uint32 i = 0u; i < numberOfRings; i++) {
+        /*lint -e{613} rings cannot be NULL as Execute is only called after a successful Setup*/
+        DelayLineGAMRing &ring = rings[i];
+        uint32 mask = (ring.numberOfSlots - 1u);
+        ring.head = ((ring.head + 1u) & mask);
+        uint8 *slot = &ring.memory[ring.head * ring.slotSize];
+        (void) MemoryOperationsHelper::Copy(slot, ring.input, ring.slotSize);
+        (void) MemoryOperationsHelper::Copy(&slot[ring.numberOfSlots * ring.slotSize], ring.input, ring.slotSize);
+        if (ring.delay > 0u) {
+            uint32 delayed = ((ring.head - ring.delay) & mask);
+            (void) MemoryOperationsHelper::Copy(ring.output, &ring.memory[delayed * ring.slotSize], ring.slotSize);
+        }
+        else {
+            //The window starts in the first copy of the ring and, if it wraps around, continues in the mirror.
+            uint32 first = ((((ring.head + ring.numberOfSlots) - ring.window) + 1u) & mask);
+            (void) MemoryOperationsHelper::Copy(ring.output, &ring.memory[first * ring.slotSize], ring.window * ring.slotSize);
+        }
+    }
+    return true;
+}
+
+uint32 DelayLineGAM::GetNumberOfSlots(const uint32 signalIdx) const {
+    uint32 ret = 0u;
+    if ((rings != NULL_PTR(DelayLineGAMRing *)) && (signalIdx < numberOfRings)) {
+        ret = rings[signalIdx].numberOfSlots;
+    }
+    return ret;
+}
+
+CLASS_REGISTER(DelayLineGAM, "1.0")
+}
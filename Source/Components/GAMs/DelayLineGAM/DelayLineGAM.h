@@ -0,0 +1,184 @@
+/**
+ * @file DelayLineGAM.h
+ * @brief Header file for class DelayLineGAM
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class DelayLineGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef DELAYLINEGAM_H_
+#define DELAYLINEGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief The history of an input signal.
+ */
+struct DelayLineGAMRing {
+    /**
+     * The slots of the ring (2 * numberOfSlots slots of slotSize bytes, see DelayLineGAM).
+     */
+    uint8 *memory;
+
+    /**
+     * The size of each slot, i.e. the byte size of the input signal.
+     */
+    uint32 slotSize;
+
+    /**
+     * The number of slots of the ring (a power of two).
+     */
+    uint32 numberOfSlots;
+
+    /**
+     * The index of the slot of the current cycle.
+     */
+    uint32 head;
+
+    /**
+     * The number of cycles of delay (0 for a window).
+     */
+    uint32 delay;
+
+    /**
+     * The number of cycles of the window (0 for a delay).
+     */
+    uint32 window;
+
+    /**
+     * The memory of the input signal.
+     */
+    const uint8 *input;
+
+    /**
+     * The memory of the output signal.
+     */
+    uint8 *output;
+};
+
+/**
+ * @brief GAM which outputs the input signals delayed by N cycles or the window of their last W cycles.
+ * @details Each output signal is computed from the input signal with the same index and shall have the same type. The output signal shall
+ * either define a Delay (in cycles), in which case it shall have the same number of elements (* samples) of the input and it is equal to
+ * the value of the input Delay cycles before, or a Window (in cycles), in which case it shall have Window times the number of elements
+ * (* samples) of the input and holds the values of the input in the last Window cycles (including the current one), the oldest first. The
+ * signals can have any type and number of elements. Until enough cycles have been executed the missing history is zero.
+ *
+ * The history of each input signal is stored in a ring with a power of two number of slots (at least Delay + 1 or Window), where the slot
+ * of the current cycle is found by masking a counter. The ring is mirrored: each cycle the input is written in its slot and in the same slot
+ * of a second copy of the ring which follows the first one in memory. Any Window of consecutive slots is thus contiguous in memory
+ * (starting in the first copy) and is written to the output with a single copy, i.e. the cost of each cycle does not depend on the
+ * length of the history.
+ *
+ * The configuration syntax is (names and signal quantities are only given as an example):
+ *
+ * <pre>
+ * +Delay = {
+ *     Class = DelayLineGAM
+ *     InputSignals = {
+ *         Current = {
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 2
+ *         }
+ *         Position = {
+ *             DataSource = DDB1
+ *             Type = int32
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         CurrentDelayed = {
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 2
+ *             Delay = 3 //Current 3 cycles before.
+ *         }
+ *         PositionHistory = {
+ *             DataSource = DDB1
+ *             Type = int32
+ *             NumberOfElements = 10
+ *             Window = 10 //Position in the last 10 cycles, the oldest first.
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class DelayLineGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    DelayLineGAM();
+
+    /**
+     * @brief Frees the rings.
+     */
+    virtual ~DelayLineGAM();
+
+    /**
+     * @brief Verifies the signals, reads the Delay or the Window of each output signal and allocates the rings.
+     * @return true if the number of input and output signals is the same, each output signal has the type of its input signal and
+     * either a Delay (> 0, same size of the input) or a Window (> 0, Window times the size of the input).
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Writes the inputs in the rings and the delayed values or the windows in the outputs.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Gets the number of slots of the ring of an input signal (0 if signalIdx is not valid or before Setup).
+     */
+    uint32 GetNumberOfSlots(const uint32 signalIdx) const;
+
+private:
+
+    /**
+     * The rings (one for each input signal).
+     */
+    DelayLineGAMRing *rings;
+
+    /**
+     * The number of rings.
+     */
+    uint32 numberOfRings;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DELAYLINEGAM_H_ */
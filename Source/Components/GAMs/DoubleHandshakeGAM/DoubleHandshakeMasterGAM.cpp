@@ -58,6 +58,15 @@ DoubleHandshakeMasterGAM::DoubleHandshakeMasterGAM() :
     previousValue = NULL_PTR(uint8*);
     startSMCycleTime = NULL_PTR(uint64*);
     timeout = 0xFFFFFFFFFFFFFFFFu;
+    packedArrays = false;
+    commandIn = NULL_PTR(uint32*);
+    ackIn = NULL_PTR(uint32*);
+    clearIn = NULL_PTR(uint32*);
+    commandOut = NULL_PTR(uint32*);
+    previousCommand = NULL_PTR(uint32*);
+    previousAck = NULL_PTR(uint32*);
+    activeMask = NULL_PTR(uint32*);
+    numberOfMaskWords = 0u;
 }
 
 DoubleHandshakeMasterGAM::~DoubleHandshakeMasterGAM() {
@@ -85,6 +94,19 @@ DoubleHandshakeMasterGAM::~DoubleHandshakeMasterGAM() {
     if (startSMCycleTime != NULL_PTR(uint64*)) {
         delete[] startSMCycleTime;
     }
+    if (previousCommand != NULL_PTR(uint32*)) {
+        delete[] previousCommand;
+    }
+    if (previousAck != NULL_PTR(uint32*)) {
+        delete[] previousAck;
+    }
+    if (activeMask != NULL_PTR(uint32*)) {
+        delete[] activeMask;
+    }
+    commandIn = NULL_PTR(uint32*);
+    ackIn = NULL_PTR(uint32*);
+    clearIn = NULL_PTR(uint32*);
+    commandOut = NULL_PTR(uint32*);
 }
 
 bool DoubleHandshakeMasterGAM::Initialise(StructuredDataI & data) {
@@ -98,6 +120,10 @@ bool DoubleHandshakeMasterGAM::Initialise(StructuredDataI & data) {
             float64 timeoutF=(timeoutSecs * freq);
             timeout = static_cast<uint64>(timeoutF);
         }
+        uint8 packedArraysIn;
+        if (data.Read("PackedArrays", packedArraysIn)) {
+            packedArrays = (packedArraysIn != 0u);
+        }
     }
     return ret;
 }
@@ -356,155 +382,345 @@ bool DoubleHandshakeMasterGAM::Setup() {
         outputs = reinterpret_cast<uint8*>(GetOutputSignalsMemory());
         state = reinterpret_cast<uint8*>(GetOutputSignalMemory(stateSignalIndex));
     }
+
+    if ((ret) && (packedArrays)) {
+        uint32 commandInIdx = 0u;
+        uint32 ackInIdx = 0u;
+        uint32 clearInIdx = 0u;
+        uint32 commandOutIdx = 0u;
+        uint32 stateIdx = 0u;
+        ret = GetPackedSignal(InputSignals, commandInId, commandInIdx);
+        if (ret) {
+            ret = GetPackedSignal(InputSignals, ackInId, ackInIdx);
+        }
+        if (ret) {
+            ret = GetPackedSignal(InputSignals, clearTrigInId, clearInIdx);
+        }
+        if (ret) {
+            ret = GetPackedSignal(OutputSignals, commandOutId, commandOutIdx);
+        }
+        if (ret) {
+            ret = GetPackedSignal(OutputSignals, stateOutId, stateIdx);
+        }
+        if (ret) {
+            ret = (GetSignalType(InputSignals, commandInIdx) == UnsignedInteger32Bit);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::FatalError, "With PackedArrays = 1 the type of the commands must be uint32");
+            }
+        }
+        if (ret) {
+            commandIn = reinterpret_cast<uint32*>(GetInputSignalMemory(commandInIdx));
+            ackIn = reinterpret_cast<uint32*>(GetInputSignalMemory(ackInIdx));
+            clearIn = reinterpret_cast<uint32*>(GetInputSignalMemory(clearInIdx));
+            commandOut = reinterpret_cast<uint32*>(GetOutputSignalMemory(commandOutIdx));
+            previousCommand = new uint32[numberOfInputCommands];
+            previousAck = new uint32[numberOfInputCommands];
+            numberOfMaskWords = (numberOfInputCommands + 31u) / 32u;
+            activeMask = new uint32[numberOfMaskWords];
+            for (uint32 i = 0u; i < numberOfInputCommands; i++) {
+                previousCommand[i] = 0u;
+                previousAck[i] = 0u;
+            }
+            for (uint32 w = 0u; w < numberOfMaskWords; w++) {
+                activeMask[w] = 0u;
+            }
+        }
+    }
+    return ret;
+}
+
+bool DoubleHandshakeMasterGAM::GetPackedSignal(const SignalDirection direction,
+                                               const char8 * const prefix,
+                                               uint32 &signalIdx) {
+    uint32 numberOfSignals = (direction == InputSignals) ? numberOfInputSignals : numberOfOutputSignals;
+    uint32 prefixLen = StringHelper::Length(prefix);
+    uint32 found = 0u;
+    bool ret = true;
+    for (uint32 i = 0u; (i < numberOfSignals) && (ret); i++) {
+        StreamString signalName;
+        ret = GetSignalName(direction, i, signalName);
+        if (ret) {
+            if (StringHelper::CompareN(signalName.Buffer(), prefix, prefixLen) == 0) {
+                signalIdx = i;
+                found++;
+            }
+        }
+    }
+    if (ret) {
+        ret = (found == 1u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "With PackedArrays = 1 exactly one %s signal must be defined", prefix);
+        }
+    }
+    if (ret) {
+        uint32 numberOfElements = 0u;
+        ret = GetSignalNumberOfElements(direction, signalIdx, numberOfElements);
+        if (ret) {
+            ret = (numberOfElements == numberOfInputCommands);
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "With PackedArrays = 1 the %s signal must have %d elements", prefix, numberOfInputCommands);
+        }
+    }
     return ret;
 }
 
 bool DoubleHandshakeMasterGAM::Execute() {
 
-    /*lint -e{850} the loop variable is not modified within the loop*/
-    for (uint32 i = 0u; i < numberOfInputCommands; i++) {
-        /*lint -e{613} NULL pointer checked.*/
-        uint64 elapsed = (HighResolutionTimer::Counter() - startSMCycleTime[i]);
-
-        /*lint -e{613} NULL pointer checked.*/
-        uint32 inCommandOffset = inputCommandOffset[i];
-        /*lint -e{613} NULL pointer checked.*/
-        uint32 outCommandOffset = outputCommandOffset[i];
-        /*lint -e{613} NULL pointer checked.*/
-        uint32 commandSize = inputCommandSize[i];
-        /*lint -e{613} NULL pointer checked.*/
-        uint32 ackOffset = inputAckOffset[i];
-
-        /*lint -e{613} NULL pointer checked.*/
-        if (state[i] == ERROR) {
-            //if reset from PLC return to wait initial state
-            if (IsChanged(i) == -1) {
-                /*lint -e{613} NULL pointer checked.*/
-                state[i] = READY;
-                REPORT_ERROR(ErrorManagement::Information, "GOTO READY[%d]", i);
-            }
+    if (packedArrays) {
+        ExecutePacked();
+    }
+    else {
+        /*lint -e{850} the loop variable is not modified within the loop*/
+        for (uint32 i = 0u; i < numberOfInputCommands; i++) {
             /*lint -e{613} NULL pointer checked.*/
-            (void) MemoryOperationsHelper::Copy(&previousValue[inCommandOffset], &inputs[inCommandOffset], commandSize);
-            //REPORT_ERROR(ErrorManagement::Information, "ERROR[%d]", i);
-        }
+            uint64 elapsed = (HighResolutionTimer::Counter() - startSMCycleTime[i]);
 
-        //communication channel state machine
-        /*lint -e{613} NULL pointer checked.*/
-        else if (state[i] == READY) {
-            //if the ack is different than zero and ack then go to error
-            for (uint32 k = 0u; k < commandSize; k++) {
-                uint32 ackIndex = (ackOffset + k);
-                /*lint -e{613} NULL pointer checked.*/
-                if (inputs[ackIndex] != 0u) {
-                    REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
+            /*lint -e{613} NULL pointer checked.*/
+            uint32 inCommandOffset = inputCommandOffset[i];
+            /*lint -e{613} NULL pointer checked.*/
+            uint32 outCommandOffset = outputCommandOffset[i];
+            /*lint -e{613} NULL pointer checked.*/
+            uint32 commandSize = inputCommandSize[i];
+            /*lint -e{613} NULL pointer checked.*/
+            uint32 ackOffset = inputAckOffset[i];
+
+            /*lint -e{613} NULL pointer checked.*/
+            if (state[i] == ERROR) {
+                //if reset from PLC return to wait initial state
+                if (IsChanged(i) == -1) {
                     /*lint -e{613} NULL pointer checked.*/
-                    state[i] = ERROR;
-                    break;
+                    state[i] = READY;
+                    REPORT_ERROR(ErrorManagement::Information, "GOTO READY[%d]", i);
                 }
+                /*lint -e{613} NULL pointer checked.*/
+                (void) MemoryOperationsHelper::Copy(&previousValue[inCommandOffset], &inputs[inCommandOffset], commandSize);
+                //REPORT_ERROR(ErrorManagement::Information, "ERROR[%d]", i);
             }
-            if (state[i] == READY) {
-                //check a difference with the previous
-                // internal command changed... send to PLC the command
-                bool rising = (IsChanged(i) == 1);
-                bool onlyChanged = (IsChanged(i) == -2);
-                //the signal is not falling to zero
-                if (rising || onlyChanged) {
-                    (void) MemoryOperationsHelper::Copy(&outputs[outCommandOffset], &inputs[inCommandOffset], commandSize);
-                    REPORT_ERROR(ErrorManagement::Information, "GOTO SENDING[%d]", i);
+
+            //communication channel state machine
+            /*lint -e{613} NULL pointer checked.*/
+            else if (state[i] == READY) {
+                //if the ack is different than zero and ack then go to error
+                for (uint32 k = 0u; k < commandSize; k++) {
+                    uint32 ackIndex = (ackOffset + k);
                     /*lint -e{613} NULL pointer checked.*/
-                    state[i] = SENDING;
-                    startSMCycleTime[i] = HighResolutionTimer::Counter();
+                    if (inputs[ackIndex] != 0u) {
+                        REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
+                        /*lint -e{613} NULL pointer checked.*/
+                        state[i] = ERROR;
+                        break;
+                    }
+                }
+                if (state[i] == READY) {
+                    //check a difference with the previous
+                    // internal command changed... send to PLC the command
+                    bool rising = (IsChanged(i) == 1);
+                    bool onlyChanged = (IsChanged(i) == -2);
+                    //the signal is not falling to zero
+                    if (rising || onlyChanged) {
+                        (void) MemoryOperationsHelper::Copy(&outputs[outCommandOffset], &inputs[inCommandOffset], commandSize);
+                        REPORT_ERROR(ErrorManagement::Information, "GOTO SENDING[%d]", i);
+                        /*lint -e{613} NULL pointer checked.*/
+                        state[i] = SENDING;
+                        startSMCycleTime[i] = HighResolutionTimer::Counter();
+                    }
+                    (void) MemoryOperationsHelper::Copy(&previousValue[inCommandOffset], &inputs[inCommandOffset], commandSize);
                 }
-                (void) MemoryOperationsHelper::Copy(&previousValue[inCommandOffset], &inputs[inCommandOffset], commandSize);
-            }
-        }
-        /*lint -e{613} NULL pointer checked.*/
-        else if (state[i] == SENDING) {
-            if (elapsed > timeout) {
-                REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
-                state[i] = ERROR;
             }
-            else {
-                //wait for the PLC acking the command
-                //command acked... set status to trigger internal MARTe changes and go to clear
-                if (MemoryOperationsHelper::Compare(&previousValue[inCommandOffset], &inputs[ackOffset], commandSize) == 0) {
-                    REPORT_ERROR(ErrorManagement::Information, "GOTO CLEAR[%d]", i);
-                    /*lint -e{613} NULL pointer checked.*/
-                    state[i] = CLEAR;
+            /*lint -e{613} NULL pointer checked.*/
+            else if (state[i] == SENDING) {
+                if (elapsed > timeout) {
+                    REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
+                    state[i] = ERROR;
                 }
                 else {
-                    //if the ack is different than zero and ack then go to error
-                    for (uint32 k = 0u; k < commandSize; k++) {
-                        uint32 ackIndex = (ackOffset + k);
-                        if (inputs[ackIndex] != 0u) {
-                            REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
-                            /*lint -e{613} NULL pointer checked.*/
-                            state[i] = ERROR;
-                            break;
+                    //wait for the PLC acking the command
+                    //command acked... set status to trigger internal MARTe changes and go to clear
+                    if (MemoryOperationsHelper::Compare(&previousValue[inCommandOffset], &inputs[ackOffset], commandSize) == 0) {
+                        REPORT_ERROR(ErrorManagement::Information, "GOTO CLEAR[%d]", i);
+                        /*lint -e{613} NULL pointer checked.*/
+                        state[i] = CLEAR;
+                    }
+                    else {
+                        //if the ack is different than zero and ack then go to error
+                        for (uint32 k = 0u; k < commandSize; k++) {
+                            uint32 ackIndex = (ackOffset + k);
+                            if (inputs[ackIndex] != 0u) {
+                                REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
+                                /*lint -e{613} NULL pointer checked.*/
+                                state[i] = ERROR;
+                                break;
+                            }
                         }
                     }
                 }
             }
-        }
-        /*lint -e{613} NULL pointer checked.*/
-        else if (state[i] == CLEAR) {
-            if (elapsed > timeout) {
-                REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
-                /*lint -e{613} NULL pointer checked.*/
-                state[i] = ERROR;
-            }
-            else {
-                //wait for internal state change and clear ack
-                /*lint -e{927} -e{826} needed pointer to pointer conversion*/
-                uint32 clearAck = *reinterpret_cast<uint32*>(&inputs[inputClearTrigOffset[i]]);
-                //if the PLC change the ack go to error
-                if (MemoryOperationsHelper::Compare(&previousValue[inCommandOffset], &inputs[ackOffset], commandSize) != 0) {
+            /*lint -e{613} NULL pointer checked.*/
+            else if (state[i] == CLEAR) {
+                if (elapsed > timeout) {
                     REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
                     /*lint -e{613} NULL pointer checked.*/
                     state[i] = ERROR;
                 }
                 else {
-                    if (clearAck == 0u) {
-                        //clear the ack
-                        (void) MemoryOperationsHelper::Set(&outputs[outCommandOffset], '\0', inputCommandSize[i]);
-                        REPORT_ERROR(ErrorManagement::Information, "GOTO DONE[%d]", i);
+                    //wait for internal state change and clear ack
+                    /*lint -e{927} -e{826} needed pointer to pointer conversion*/
+                    uint32 clearAck = *reinterpret_cast<uint32*>(&inputs[inputClearTrigOffset[i]]);
+                    //if the PLC change the ack go to error
+                    if (MemoryOperationsHelper::Compare(&previousValue[inCommandOffset], &inputs[ackOffset], commandSize) != 0) {
+                        REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
                         /*lint -e{613} NULL pointer checked.*/
-                        state[i] = DONE;
+                        state[i] = ERROR;
+                    }
+                    else {
+                        if (clearAck == 0u) {
+                            //clear the ack
+                            (void) MemoryOperationsHelper::Set(&outputs[outCommandOffset], '\0', inputCommandSize[i]);
+                            REPORT_ERROR(ErrorManagement::Information, "GOTO DONE[%d]", i);
+                            /*lint -e{613} NULL pointer checked.*/
+                            state[i] = DONE;
+                        }
                     }
                 }
             }
-        }
-        else if (state[i] == DONE) {
-            if (elapsed > timeout) {
-                REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
-                /*lint -e{613} NULL pointer checked.*/
-                state[i] = ERROR;
-            }
-            else {
-                //wait for the PLC clear ack
-                if (MemoryOperationsHelper::Compare(&inputs[ackOffset], &outputs[outCommandOffset], commandSize) == 0) {
-                    REPORT_ERROR(ErrorManagement::Information, "GOTO READY[%d]", i);
+            else if (state[i] == DONE) {
+                if (elapsed > timeout) {
+                    REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
                     /*lint -e{613} NULL pointer checked.*/
-                    state[i] = READY;
+                    state[i] = ERROR;
                 }
                 else {
-                    //if the PLC change the ack go to error
-                    if (MemoryOperationsHelper::Compare(&previousValue[inCommandOffset], &inputs[ackOffset], commandSize) != 0) {
+                    //wait for the PLC clear ack
+                    if (MemoryOperationsHelper::Compare(&inputs[ackOffset], &outputs[outCommandOffset], commandSize) == 0) {
+                        REPORT_ERROR(ErrorManagement::Information, "GOTO READY[%d]", i);
                         /*lint -e{613} NULL pointer checked.*/
-                        state[i] = ERROR;
-                        REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
+                        state[i] = READY;
+                    }
+                    else {
+                        //if the PLC change the ack go to error
+                        if (MemoryOperationsHelper::Compare(&previousValue[inCommandOffset], &inputs[ackOffset], commandSize) != 0) {
+                            /*lint -e{613} NULL pointer checked.*/
+                            state[i] = ERROR;
+                            REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
+                        }
                     }
                 }
             }
-        }
-        else{
+            else{
 
+            }
         }
     }
 
     return true;
 }
 
+/*lint -e{613} NULL pointers checked in Setup.*/
+void DoubleHandshakeMasterGAM::ExecutePacked() {
+    uint64 now = HighResolutionTimer::Counter();
+    for (uint32 w = 0u; w < numberOfMaskWords; w++) {
+        uint32 first = (w * 32u);
+        uint32 last = (first + 32u);
+        if (last > numberOfInputCommands) {
+            last = numberOfInputCommands;
+        }
+        //the channels whose command or ack changed
+        uint32 dirty = activeMask[w];
+        for (uint32 i = first; i < last; i++) {
+            uint32 changed = static_cast<uint32>((commandIn[i] != previousCommand[i]) || (ackIn[i] != previousAck[i]));
+            dirty |= (changed << (i - first));
+            previousAck[i] = ackIn[i];
+        }
+        uint32 nextActive = 0u;
+        uint32 channel = first;
+        while (dirty != 0u) {
+            if ((dirty & 1u) != 0u) {
+                uint8 previousState = state[channel];
+                ExecutePackedChannel(channel, now);
+                if ((state[channel] != previousState) || ((state[channel] != READY) && (state[channel] != ERROR))) {
+                    nextActive |= (1u << (channel - first));
+                }
+            }
+            dirty >>= 1u;
+            channel++;
+        }
+        activeMask[w] = nextActive;
+    }
+}
+
+/*lint -e{613} NULL pointers checked in Setup.*/
+void DoubleHandshakeMasterGAM::ExecutePackedChannel(const uint32 i,
+                                                    const uint64 now) {
+    uint32 command = commandIn[i];
+    uint32 ack = ackIn[i];
+    uint32 previous = previousCommand[i];
+    bool expired = ((now - startSMCycleTime[i]) > timeout);
+    if (state[i] == ERROR) {
+        //if reset from PLC return to wait initial state
+        if ((command == 0u) && (previous != 0u)) {
+            state[i] = READY;
+        }
+        previousCommand[i] = command;
+    }
+    else if (state[i] == READY) {
+        if (ack != 0u) {
+            state[i] = ERROR;
+        }
+        else {
+            //the signal is not falling to zero
+            if ((command != previous) && (command != 0u)) {
+                commandOut[i] = command;
+                state[i] = SENDING;
+                startSMCycleTime[i] = now;
+            }
+            previousCommand[i] = command;
+        }
+    }
+    else if (state[i] == SENDING) {
+        if (expired) {
+            state[i] = ERROR;
+        }
+        else if (ack == previous) {
+            state[i] = CLEAR;
+        }
+        else if (ack != 0u) {
+            state[i] = ERROR;
+        }
+        else {
+        }
+    }
+    else if (state[i] == CLEAR) {
+        if (expired) {
+            state[i] = ERROR;
+        }
+        else if (ack != previous) {
+            state[i] = ERROR;
+        }
+        else if (clearIn[i] == 0u) {
+            commandOut[i] = 0u;
+            state[i] = DONE;
+        }
+        else {
+        }
+    }
+    else if (state[i] == DONE) {
+        if (expired) {
+            state[i] = ERROR;
+        }
+        else if (ack == commandOut[i]) {
+            state[i] = READY;
+        }
+        else if (ack != previous) {
+            state[i] = ERROR;
+        }
+        else {
+        }
+    }
+    else {
+    }
+}
+
 int32 DoubleHandshakeMasterGAM::IsChanged(const uint32 cIdx) const {
 //check if the command i had a rising event
     /*lint -e{613} NULL pointer checked.*/
@@ -55,6 +55,14 @@ DoubleHandshakeSlaveGAM::DoubleHandshakeSlaveGAM() :
     state = NULL_PTR(uint8*);
     startSMCycleTime = NULL_PTR(uint64*);
     timeout = 0xFFFFFFFFFFFFFFFFu;
+    packedArrays = false;
+    commandIn = NULL_PTR(uint32*);
+    clearIn = NULL_PTR(uint32*);
+    ackOut = NULL_PTR(uint32*);
+    previousCommand = NULL_PTR(uint32*);
+    lastCommand = NULL_PTR(uint32*);
+    activeMask = NULL_PTR(uint32*);
+    numberOfMaskWords = 0u;
 }
 
 DoubleHandshakeSlaveGAM::~DoubleHandshakeSlaveGAM() {
@@ -79,6 +87,18 @@ DoubleHandshakeSlaveGAM::~DoubleHandshakeSlaveGAM() {
     if (startSMCycleTime != NULL_PTR(uint64*)) {
         delete[] startSMCycleTime;
     }
+    if (previousCommand != NULL_PTR(uint32*)) {
+        delete[] previousCommand;
+    }
+    if (lastCommand != NULL_PTR(uint32*)) {
+        delete[] lastCommand;
+    }
+    if (activeMask != NULL_PTR(uint32*)) {
+        delete[] activeMask;
+    }
+    commandIn = NULL_PTR(uint32*);
+    clearIn = NULL_PTR(uint32*);
+    ackOut = NULL_PTR(uint32*);
 }
 
 bool DoubleHandshakeSlaveGAM::Initialise(StructuredDataI & data) {
@@ -92,6 +112,10 @@ bool DoubleHandshakeSlaveGAM::Initialise(StructuredDataI & data) {
             float64 timeoutF = (timeoutSecs * freq);
             timeout = static_cast<uint64>(timeoutF);
         }
+        uint8 packedArraysIn;
+        if (data.Read("PackedArrays", packedArraysIn)) {
+            packedArrays = (packedArraysIn != 0u);
+        }
     }
     return ret;
 }
@@ -322,112 +346,281 @@ bool DoubleHandshakeSlaveGAM::Setup() {
         outputs = reinterpret_cast<uint8*>(GetOutputSignalsMemory());
         state = reinterpret_cast<uint8*>(GetOutputSignalMemory(stateSignalIndex));
     }
+
+    if ((ret) && (packedArrays)) {
+        uint32 commandInIdx = 0u;
+        uint32 clearInIdx = 0u;
+        uint32 ackOutIdx = 0u;
+        uint32 stateIdx = 0u;
+        ret = GetPackedSignal(InputSignals, commandInId, commandInIdx);
+        if (ret) {
+            ret = GetPackedSignal(InputSignals, clearTrigInId, clearInIdx);
+        }
+        if (ret) {
+            ret = GetPackedSignal(OutputSignals, ackOutId, ackOutIdx);
+        }
+        if (ret) {
+            ret = GetPackedSignal(OutputSignals, stateOutId, stateIdx);
+        }
+        if (ret) {
+            ret = (GetSignalType(InputSignals, commandInIdx) == UnsignedInteger32Bit);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::FatalError, "With PackedArrays = 1 the type of the commands must be uint32");
+            }
+        }
+        if (ret) {
+            commandIn = reinterpret_cast<uint32*>(GetInputSignalMemory(commandInIdx));
+            clearIn = reinterpret_cast<uint32*>(GetInputSignalMemory(clearInIdx));
+            ackOut = reinterpret_cast<uint32*>(GetOutputSignalMemory(ackOutIdx));
+            previousCommand = new uint32[numberOfInputCommands];
+            lastCommand = new uint32[numberOfInputCommands];
+            numberOfMaskWords = (numberOfInputCommands + 31u) / 32u;
+            activeMask = new uint32[numberOfMaskWords];
+            for (uint32 i = 0u; i < numberOfInputCommands; i++) {
+                previousCommand[i] = 0u;
+                lastCommand[i] = 0u;
+            }
+            for (uint32 w = 0u; w < numberOfMaskWords; w++) {
+                activeMask[w] = 0u;
+            }
+        }
+    }
     return ret;
 }
 
-bool DoubleHandshakeSlaveGAM::Execute() {
+bool DoubleHandshakeSlaveGAM::GetPackedSignal(const SignalDirection direction,
+                                              const char8 * const prefix,
+                                              uint32 &signalIdx) {
+    uint32 numberOfSignals = (direction == InputSignals) ? numberOfInputSignals : numberOfOutputSignals;
+    uint32 prefixLen = StringHelper::Length(prefix);
+    uint32 found = 0u;
+    bool ret = true;
+    for (uint32 i = 0u; (i < numberOfSignals) && (ret); i++) {
+        StreamString signalName;
+        ret = GetSignalName(direction, i, signalName);
+        if (ret) {
+            if (StringHelper::CompareN(signalName.Buffer(), prefix, prefixLen) == 0) {
+                signalIdx = i;
+                found++;
+            }
+        }
+    }
+    if (ret) {
+        ret = (found == 1u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "With PackedArrays = 1 exactly one %s signal must be defined", prefix);
+        }
+    }
+    if (ret) {
+        uint32 numberOfElements = 0u;
+        ret = GetSignalNumberOfElements(direction, signalIdx, numberOfElements);
+        if (ret) {
+            ret = (numberOfElements == numberOfInputCommands);
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "With PackedArrays = 1 the %s signal must have %d elements", prefix, numberOfInputCommands);
+        }
+    }
+    return ret;
+}
 
-    /*lint -e{850} the loop variable is not modified within the loop*/
-    for (uint32 i = 0u; i < numberOfInputCommands; i++) {
-        /*lint -e{613} NULL pointer checked.*/
-        uint64 elapsed = (HighResolutionTimer::Counter() - startSMCycleTime[i]);
-        /*lint -e{613} NULL pointer checked.*/
-        uint32 inCommandOffset = inputCommandOffset[i];
-        /*lint -e{613} NULL pointer checked.*/
-        uint32 commandSize = inputCommandSize[i];
-        /*lint -e{613} NULL pointer checked.*/
-        uint32 ackOffset = outputAckOffset[i];
-
-        /*lint -e{613} NULL pointer checked.*/
-        if (state[i] == ERROR) {
-            //if reset from PLC return to wait initial state
-            if (IsChanged(i) == -1) {
-                /*lint -e{613} NULL pointer checked.*/
-                state[i] = READY;
-                (void) MemoryOperationsHelper::Set(&outputs[ackOffset], '\0', inputCommandSize[i]);
-                (void) MemoryOperationsHelper::Set(&previousValue[inCommandOffset], '\0', inputCommandSize[i]);
+bool DoubleHandshakeSlaveGAM::Execute() {
 
-                REPORT_ERROR(ErrorManagement::Information, "GOTO READY[%d]", i);
-            }
+    if (packedArrays) {
+        ExecutePacked();
+    }
+    else {
+        /*lint -e{850} the loop variable is not modified within the loop*/
+        for (uint32 i = 0u; i < numberOfInputCommands; i++) {
             /*lint -e{613} NULL pointer checked.*/
-            //REPORT_ERROR(ErrorManagement::Information, "ERROR[%d]", i);
-        }
+            uint64 elapsed = (HighResolutionTimer::Counter() - startSMCycleTime[i]);
+            /*lint -e{613} NULL pointer checked.*/
+            uint32 inCommandOffset = inputCommandOffset[i];
+            /*lint -e{613} NULL pointer checked.*/
+            uint32 commandSize = inputCommandSize[i];
+            /*lint -e{613} NULL pointer checked.*/
+            uint32 ackOffset = outputAckOffset[i];
 
-        //communication channel state machine
-        /*lint -e{613} NULL pointer checked.*/
-        else if (state[i] == READY) {
+            /*lint -e{613} NULL pointer checked.*/
+            if (state[i] == ERROR) {
+                //if reset from PLC return to wait initial state
+                if (IsChanged(i) == -1) {
+                    /*lint -e{613} NULL pointer checked.*/
+                    state[i] = READY;
+                    (void) MemoryOperationsHelper::Set(&outputs[ackOffset], '\0', inputCommandSize[i]);
+                    (void) MemoryOperationsHelper::Set(&previousValue[inCommandOffset], '\0', inputCommandSize[i]);
 
-            // check if PLC sent command
-            if (IsChanged(i) == 1) {
-                (void) MemoryOperationsHelper::Copy(&previousValue[inCommandOffset], &inputs[inCommandOffset], commandSize);
-                REPORT_ERROR(ErrorManagement::Information, "GOTO SENDING[%d]", i);
-                /*lint -e{613} NULL pointer checked.*/
-                startSMCycleTime[i] = HighResolutionTimer::Counter();
+                    REPORT_ERROR(ErrorManagement::Information, "GOTO READY[%d]", i);
+                }
                 /*lint -e{613} NULL pointer checked.*/
-                state[i] = SENDING;
+                //REPORT_ERROR(ErrorManagement::Information, "ERROR[%d]", i);
             }
-        }
-        /*lint -e{613} NULL pointer checked.*/
-        else if (state[i] == SENDING) {
-            if (elapsed > timeout) {
-                REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
-                /*lint -e{613} NULL pointer checked.*/
-                state[i] = ERROR;
+
+            //communication channel state machine
+            /*lint -e{613} NULL pointer checked.*/
+            else if (state[i] == READY) {
+
+                // check if PLC sent command
+                if (IsChanged(i) == 1) {
+                    (void) MemoryOperationsHelper::Copy(&previousValue[inCommandOffset], &inputs[inCommandOffset], commandSize);
+                    REPORT_ERROR(ErrorManagement::Information, "GOTO SENDING[%d]", i);
+                    /*lint -e{613} NULL pointer checked.*/
+                    startSMCycleTime[i] = HighResolutionTimer::Counter();
+                    /*lint -e{613} NULL pointer checked.*/
+                    state[i] = SENDING;
+                }
             }
-            else {
-                //wait for the internal processing
-                //go to error if plc change the command or reset
-                if (MemoryOperationsHelper::Compare(&inputs[inCommandOffset], &previousValue[inCommandOffset], commandSize) != 0) {
+            /*lint -e{613} NULL pointer checked.*/
+            else if (state[i] == SENDING) {
+                if (elapsed > timeout) {
                     REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
                     /*lint -e{613} NULL pointer checked.*/
                     state[i] = ERROR;
                 }
                 else {
-                    /*lint -e{927} -e{826} needed pointer to pointer conversion*/
-                    uint32 clearTrig = *reinterpret_cast<uint32*>(&inputs[inputClearTrigOffset[i]]);
-                    if (clearTrig == 0u) {
-                        //send the ack
-                        (void) MemoryOperationsHelper::Copy(&outputs[ackOffset], &inputs[inCommandOffset], inputCommandSize[i]);
-                        REPORT_ERROR(ErrorManagement::Information, "GOTO DONE[%d]", i);
+                    //wait for the internal processing
+                    //go to error if plc change the command or reset
+                    if (MemoryOperationsHelper::Compare(&inputs[inCommandOffset], &previousValue[inCommandOffset], commandSize) != 0) {
+                        REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
                         /*lint -e{613} NULL pointer checked.*/
-                        state[i] = DONE;
+                        state[i] = ERROR;
+                    }
+                    else {
+                        /*lint -e{927} -e{826} needed pointer to pointer conversion*/
+                        uint32 clearTrig = *reinterpret_cast<uint32*>(&inputs[inputClearTrigOffset[i]]);
+                        if (clearTrig == 0u) {
+                            //send the ack
+                            (void) MemoryOperationsHelper::Copy(&outputs[ackOffset], &inputs[inCommandOffset], inputCommandSize[i]);
+                            REPORT_ERROR(ErrorManagement::Information, "GOTO DONE[%d]", i);
+                            /*lint -e{613} NULL pointer checked.*/
+                            state[i] = DONE;
+                        }
                     }
                 }
             }
-        }
-        /*lint -e{613} NULL pointer checked.*/
-        else if (state[i] == DONE) {
-            if (elapsed > timeout) {
-                REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
-                /*lint -e{613} NULL pointer checked.*/
-                state[i] = ERROR;
-            }
-            else {
-                //wait for clear
-                if (IsChanged(i) == -1) {
-                    (void) MemoryOperationsHelper::Set(&outputs[ackOffset], '\0', inputCommandSize[i]);
-                    (void) MemoryOperationsHelper::Set(&previousValue[inCommandOffset], '\0', inputCommandSize[i]);
-                    REPORT_ERROR(ErrorManagement::Information, "GOTO READY[%d]", i);
+            /*lint -e{613} NULL pointer checked.*/
+            else if (state[i] == DONE) {
+                if (elapsed > timeout) {
+                    REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
                     /*lint -e{613} NULL pointer checked.*/
-                    state[i] = READY;
+                    state[i] = ERROR;
                 }
                 else {
-                    //if not for clear but changed... go to error
-                    if (MemoryOperationsHelper::Compare(&inputs[inCommandOffset], &previousValue[inCommandOffset], commandSize) != 0) {
-                        REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
+                    //wait for clear
+                    if (IsChanged(i) == -1) {
+                        (void) MemoryOperationsHelper::Set(&outputs[ackOffset], '\0', inputCommandSize[i]);
+                        (void) MemoryOperationsHelper::Set(&previousValue[inCommandOffset], '\0', inputCommandSize[i]);
+                        REPORT_ERROR(ErrorManagement::Information, "GOTO READY[%d]", i);
                         /*lint -e{613} NULL pointer checked.*/
-                        state[i] = ERROR;
+                        state[i] = READY;
+                    }
+                    else {
+                        //if not for clear but changed... go to error
+                        if (MemoryOperationsHelper::Compare(&inputs[inCommandOffset], &previousValue[inCommandOffset], commandSize) != 0) {
+                            REPORT_ERROR(ErrorManagement::Information, "GOTO ERROR[%d]", i);
+                            /*lint -e{613} NULL pointer checked.*/
+                            state[i] = ERROR;
+                        }
                     }
                 }
             }
-        }
-        else{
+            else{
 
+            }
         }
     }
     return true;
 }
 
+/*lint -e{613} NULL pointers checked in Setup.*/
+void DoubleHandshakeSlaveGAM::ExecutePacked() {
+    uint64 now = HighResolutionTimer::Counter();
+    for (uint32 w = 0u; w < numberOfMaskWords; w++) {
+        uint32 first = (w * 32u);
+        uint32 last = (first + 32u);
+        if (last > numberOfInputCommands) {
+            last = numberOfInputCommands;
+        }
+        //the channels whose command changed
+        uint32 dirty = activeMask[w];
+        for (uint32 i = first; i < last; i++) {
+            uint32 changed = static_cast<uint32>(commandIn[i] != lastCommand[i]);
+            dirty |= (changed << (i - first));
+            lastCommand[i] = commandIn[i];
+        }
+        uint32 nextActive = 0u;
+        uint32 channel = first;
+        while (dirty != 0u) {
+            if ((dirty & 1u) != 0u) {
+                uint8 previousState = state[channel];
+                ExecutePackedChannel(channel, now);
+                if ((state[channel] != previousState) || ((state[channel] != READY) && (state[channel] != ERROR))) {
+                    nextActive |= (1u << (channel - first));
+                }
+            }
+            dirty >>= 1u;
+            channel++;
+        }
+        activeMask[w] = nextActive;
+    }
+}
+
+/*lint -e{613} NULL pointers checked in Setup.*/
+void DoubleHandshakeSlaveGAM::ExecutePackedChannel(const uint32 i,
+                                                   const uint64 now) {
+    uint32 command = commandIn[i];
+    uint32 previous = previousCommand[i];
+    bool expired = ((now - startSMCycleTime[i]) > timeout);
+    if (state[i] == ERROR) {
+        //if reset from PLC return to wait initial state
+        if ((command == 0u) && (previous != 0u)) {
+            state[i] = READY;
+            ackOut[i] = 0u;
+            previousCommand[i] = 0u;
+        }
+    }
+    else if (state[i] == READY) {
+        // check if PLC sent command
+        if ((command != 0u) && (previous == 0u)) {
+            previousCommand[i] = command;
+            startSMCycleTime[i] = now;
+            state[i] = SENDING;
+        }
+    }
+    else if (state[i] == SENDING) {
+        if (expired) {
+            state[i] = ERROR;
+        }
+        else if (command != previous) {
+            state[i] = ERROR;
+        }
+        else if (clearIn[i] == 0u) {
+            //send the ack
+            ackOut[i] = command;
+            state[i] = DONE;
+        }
+        else {
+        }
+    }
+    else if (state[i] == DONE) {
+        if (expired) {
+            state[i] = ERROR;
+        }
+        else if ((command == 0u) && (previous != 0u)) {
+            ackOut[i] = 0u;
+            previousCommand[i] = 0u;
+            state[i] = READY;
+        }
+        else if (command != previous) {
+            state[i] = ERROR;
+        }
+        else {
+        }
+    }
+    else {
+    }
+}
+
 int32 DoubleHandshakeSlaveGAM::IsChanged(const uint32 cIdx) const {
     //check if the command i had a rising event
     /*lint -e{613} NULL pointer checked.*/
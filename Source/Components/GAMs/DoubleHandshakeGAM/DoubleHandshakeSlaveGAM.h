@@ -75,6 +75,12 @@ namespace MARTe {
  *   - From DONE if the command signal changes to something different than zero.\n
  *   - From SENDING or DONE if the specified timeout expires.
  *
+ * @details If PackedArrays = 1 all the channels are given as arrays: one uint32 CommandIn and ClearIn input signal
+ * and one uint32 AckOut and uint8 InternalState output signal, all with NumberOfElements equal to the number of channels.
+ * In this mode the Execute scans the commands of all the channels in a branch-free loop which builds, for each block of 32 channels,
+ * a bitmask of the channels whose command changed. Only the channels with a bit set in this mask, or which are in the SENDING or DONE
+ * states (or changed state in the previous cycle), are evaluated by the state machine, and the state transitions are not logged.
+ *
  * @details Follows an example of configuration.
  * <pre>
  * +DoubleHandshakeSlaveGAM = {
@@ -134,12 +140,14 @@ public:
      * @details The user can specify the parameter:\n
      *    - Timeout: the timeout in milliseconds of the handshake procedure. If the timeout expires in SENDING or
      *    DONE states, the state machine goes in ERROR state.
+     *    - PackedArrays: if 1 the channels are given as arrays (see class description). Default 0.
      */
     virtual bool Initialise(StructuredDataI & data);
 
     /**
      * @brief Setup the GAM.
      * @details Checks the constraints and initialises the internal variables to execute the double handshake state machine.
+     * If PackedArrays = 1 also checks that each kind of signal is a single uint32 array (uint8 for the InternalState) with one element for each channel.
      */
     virtual bool Setup();
 
@@ -158,6 +166,30 @@ protected:
      */
     int32 IsChanged(const uint32 cIdx) const;
 
+    /**
+     * @brief Executes the state machine of the channels which changed (PackedArrays = 1).
+     */
+    void ExecutePacked();
+
+    /**
+     * @brief Executes the state machine of a channel (PackedArrays = 1).
+     * @param[in] i the channel index.
+     * @param[in] now the current HighResolutionTimer counter.
+     */
+    void ExecutePackedChannel(const uint32 i,
+                              const uint64 now);
+
+    /**
+     * @brief Gets the index of the unique signal whose name begins with \a prefix and checks that it has one element for each channel.
+     * @param[in] direction the signal direction.
+     * @param[in] prefix the signal name prefix.
+     * @param[out] signalIdx the signal index.
+     * @return true if there is exactly one signal with the given prefix and it has numberOfInputCommands elements.
+     */
+    bool GetPackedSignal(const SignalDirection direction,
+                         const char8 * const prefix,
+                         uint32 &signalIdx);
+
     /**
      * READY state
      */
@@ -232,6 +264,46 @@ protected:
      * The double handshake procedure timeout
      */
     uint64 timeout;
+
+    /**
+     * True if PackedArrays = 1
+     */
+    bool packedArrays;
+
+    /**
+     * The input commands (PackedArrays = 1)
+     */
+    uint32 *commandIn;
+
+    /**
+     * The input clear triggers (PackedArrays = 1)
+     */
+    uint32 *clearIn;
+
+    /**
+     * The output acks (PackedArrays = 1)
+     */
+    uint32 *ackOut;
+
+    /**
+     * The command latched by the state machine (PackedArrays = 1)
+     */
+    uint32 *previousCommand;
+
+    /**
+     * The commands of the previous cycle (PackedArrays = 1)
+     */
+    uint32 *lastCommand;
+
+    /**
+     * One bit for each channel which must be evaluated in the next cycle independently of its inputs (PackedArrays = 1)
+     */
+    uint32 *activeMask;
+
+    /**
+     * The number of words of activeMask
+     */
+    uint32 numberOfMaskWords;
 };
 
 }
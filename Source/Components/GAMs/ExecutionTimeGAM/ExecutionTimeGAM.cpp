@@ -0,0 +1,486 @@
+/**
+ * @file ExecutionTimeGAM.cpp
+ * @brief Source file for class ExecutionTimeGAM
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutionTimeGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CLASSMETHODREGISTER.h"
+#include "ExecutionTimeGAM.h"
+#include "RegisteredMethodsMessageFilter.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+/**
+ * Number of statistics written at the beginning of each output signal.
+ */
+const MARTe::uint32 executionTimeNumberOfStatistics = 7u;
+
+/**
+ * Maximum value of the SignificantBits parameter.
+ */
+const MARTe::uint32 executionTimeMaxSignificantBits = 10u;
+
+/**
+ * Suffix of the names of the input signals which are durations.
+ */
+const MARTe::char8 * const executionTimeCycleTimeSuffix = "CycleTime";
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ExecutionTimeGAM::ExecutionTimeGAM() :
+        GAM(),
+        MessageI() {
+    significantBits = 4u;
+    numberOfBins = 0u;
+    refreshPeriod = 1u;
+    refreshCounter = 0u;
+    numberOfSignals = 0u;
+    inputs = NULL_PTR(uint32 **);
+    outputs = NULL_PTR(uint32 **);
+    isDuration = NULL_PTR(bool *);
+    writeHistogram = NULL_PTR(bool *);
+    counts = NULL_PTR(uint64 *);
+    sums = NULL_PTR(uint64 *);
+    minimums = NULL_PTR(uint32 *);
+    maximums = NULL_PTR(uint32 *);
+    histograms = NULL_PTR(uint64 *);
+    resetPending = 0;
+}
+
+ExecutionTimeGAM::~ExecutionTimeGAM() {
+    if (inputs != NULL_PTR(uint32 **)) {
+        delete[] inputs;
+    }
+    if (outputs != NULL_PTR(uint32 **)) {
+        delete[] outputs;
+    }
+    if (isDuration != NULL_PTR(bool *)) {
+        delete[] isDuration;
+    }
+    if (writeHistogram != NULL_PTR(bool *)) {
+        delete[] writeHistogram;
+    }
+    if (counts != NULL_PTR(uint64 *)) {
+        delete[] counts;
+    }
+    if (sums != NULL_PTR(uint64 *)) {
+        delete[] sums;
+    }
+    if (minimums != NULL_PTR(uint32 *)) {
+        delete[] minimums;
+    }
+    if (maximums != NULL_PTR(uint32 *)) {
+        delete[] maximums;
+    }
+    if (histograms != NULL_PTR(uint64 *)) {
+        delete[] histograms;
+    }
+}
+
+bool ExecutionTimeGAM::Initialise(StructuredDataI &data) {
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        if (!data.Read("SignificantBits", significantBits)) {
+            significantBits = 4u;
+        }
+        ok = ((significantBits > 0u) && (significantBits <= executionTimeMaxSignificantBits));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "SignificantBits shall be between 1 and %u", executionTimeMaxSignificantBits);
+        }
+    }
+    if (ok) {
+        if (!data.Read("RefreshPeriod", refreshPeriod)) {
+            refreshPeriod = 1u;
+        }
+        ok = (refreshPeriod > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "RefreshPeriod shall be > 0");
+        }
+    }
+    if (ok) {
+        numberOfBins = (33u - significantBits) * (1u << significantBits);
+    }
+    return ok;
+}
+
+bool ExecutionTimeGAM::Setup() {
+    numberOfSignals = GetNumberOfInputSignals();
+    bool ok = (numberOfSignals > 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "At least one input signal shall be defined");
+    }
+    if (ok) {
+        ok = (GetNumberOfOutputSignals() == numberOfSignals);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The number of output signals shall be equal to the number of input signals");
+        }
+    }
+    if (ok) {
+        inputs = new uint32*[numberOfSignals];
+        outputs = new uint32*[numberOfSignals];
+        isDuration = new bool[numberOfSignals];
+        writeHistogram = new bool[numberOfSignals];
+        counts = new uint64[numberOfSignals];
+        sums = new uint64[numberOfSignals];
+        minimums = new uint32[numberOfSignals];
+        maximums = new uint32[numberOfSignals];
+        histograms = new uint64[numberOfSignals * numberOfBins];
+    }
+    const uint32 suffixSize = StringHelper::Length(executionTimeCycleTimeSuffix);
+    for (uint32 i = 0u; (i < numberOfSignals) && (ok); i++) {
+        StreamString signalName;
+        ok = GetSignalName(InputSignals, i, signalName);
+        if (ok) {
+            ok = (GetSignalType(InputSignals, i) == UnsignedInteger32Bit);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The type of the input signal %s shall be uint32", signalName.Buffer());
+            }
+        }
+        uint32 nOfElements = 0u;
+        uint32 nOfSamples = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(InputSignals, i, nOfElements);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(InputSignals, i, nOfSamples);
+        }
+        if (ok) {
+            ok = ((nOfElements == 1u) && (nOfSamples == 1u));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The input signal %s shall have one element and one sample", signalName.Buffer());
+            }
+        }
+        if (ok) {
+            /*lint -e{613} isDuration cannot be NULL as otherwise ok would be false*/
+            isDuration[i] = false;
+            uint32 nameSize = static_cast<uint32>(signalName.Size());
+            if (nameSize >= suffixSize) {
+                /*lint -e{613} isDuration cannot be NULL as otherwise ok would be false*/
+                isDuration[i] = (StringHelper::Compare(&(signalName.Buffer()[nameSize - suffixSize]), executionTimeCycleTimeSuffix) == 0);
+            }
+        }
+        if (ok) {
+            ok = (GetSignalType(OutputSignals, i) == UnsignedInteger32Bit);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The type of the output signal %u shall be uint32", i);
+            }
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(OutputSignals, i, nOfElements);
+        }
+        if (ok) {
+            ok = ((nOfElements == executionTimeNumberOfStatistics) || (nOfElements == (executionTimeNumberOfStatistics + numberOfBins)));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The NumberOfElements of the output signal %u shall be %u or %u", i,
+                             executionTimeNumberOfStatistics, (executionTimeNumberOfStatistics + numberOfBins));
+            }
+        }
+        if (ok) {
+            /*lint -e{613} the arrays cannot be NULL as otherwise ok would be false*/
+            writeHistogram[i] = (nOfElements > executionTimeNumberOfStatistics);
+            /*lint -e{613} the arrays cannot be NULL as otherwise ok would be false*/
+            inputs[i] = static_cast<uint32 *>(GetInputSignalMemory(i));
+            /*lint -e{613} the arrays cannot be NULL as otherwise ok would be false*/
+            outputs[i] = static_cast<uint32 *>(GetOutputSignalMemory(i));
+        }
+    }
+    if (ok) {
+        Reset();
+        ReferenceT<RegisteredMethodsMessageFilter> registeredMethodsMessageFilter("RegisteredMethodsMessageFilter");
+        ok = registeredMethodsMessageFilter.IsValid();
+        if (ok) {
+            registeredMethodsMessageFilter->SetDestination(this);
+            ok = InstallMessageFilter(registeredMethodsMessageFilter);
+        }
+    }
+    return ok;
+}
+
+bool ExecutionTimeGAM::Execute() {
+    if (resetPending != 0) {
+        Reset();
+        resetPending = 0;
+    }
+    bool refresh = false;
+    refreshCounter++;
+    if (refreshCounter >= refreshPeriod) {
+        refreshCounter = 0u;
+        refresh = true;
+    }
+    uint32 previous = 0u;
+    /*lint -e{613} the arrays cannot be NULL as Execute is only called after a successful Setup*/
+    for (uint32 i = 0u; i < numberOfSignals; i++) {
+        uint32 value = *inputs[i];
+        if (!isDuration[i]) {
+            uint32 instant = value;
+            value = (instant > previous) ? (instant - previous) : 0u;
+            previous = instant;
+        }
+        counts[i]++;
+        sums[i] += value;
+        if (value < minimums[i]) {
+            minimums[i] = value;
+        }
+        if (value > maximums[i]) {
+            maximums[i] = value;
+        }
+        histograms[(i * numberOfBins) + GetBinIndex(value)]++;
+
+        uint32 *output = outputs[i];
+        output[0u] = value;
+        output[1u] = minimums[i];
+        output[2u] = maximums[i];
+        output[3u] = static_cast<uint32>(sums[i] / counts[i]);
+        if (refresh) {
+            Refresh(i);
+        }
+    }
+    return true;
+}
+
+bool ExecutionTimeGAM::PrepareNextState(const char8 * const currentStateName,
+                                        const char8 * const nextStateName) {
+    resetPending = 1;
+    return true;
+}
+
+ErrorManagement::ErrorType ExecutionTimeGAM::PrintStatistics() {
+    for (uint32 i = 0u; i < numberOfSignals; i++) {
+        StreamString signalName;
+        if (GetSignalName(InputSignals, i, signalName)) {
+            REPORT_ERROR(ErrorManagement::Information, "%s: %llu values, min = %u, max = %u, mean = %u, q50 = %u, q99 = %u, q99.9 = %u", signalName.Buffer(),
+                         GetNumberOfValues(i), GetMinimum(i), GetMaximum(i), GetMean(i), GetQuantile(i, 0.5), GetQuantile(i, 0.99),
+                         GetQuantile(i, 0.999));
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+ErrorManagement::ErrorType ExecutionTimeGAM::GetStatistics(ReferenceContainer &message) {
+    ErrorManagement::ErrorType ret = ErrorManagement::NoError;
+    bool ok = (message.Size() == 1u);
+    ReferenceT<StructuredDataI> data = message.Get(0u);
+    if (ok) {
+        ok = data.IsValid();
+    }
+    if (!ok) {
+        ret = ErrorManagement::ParametersError;
+        REPORT_ERROR(ret, "Message does not contain a ReferenceT<StructuredDataI>");
+    }
+    for (uint32 i = 0u; (i < numberOfSignals) && (ok); i++) {
+        StreamString signalName;
+        ok = GetSignalName(InputSignals, i, signalName);
+        if (ok) {
+            ok = data->CreateRelative(signalName.Buffer());
+        }
+        if (ok) {
+            ok = data->Write("NumberOfValues", GetNumberOfValues(i));
+        }
+        if (ok) {
+            ok = data->Write("Minimum", GetMinimum(i));
+        }
+        if (ok) {
+            ok = data->Write("Maximum", GetMaximum(i));
+        }
+        if (ok) {
+            ok = data->Write("Mean", GetMean(i));
+        }
+        if (ok) {
+            ok = data->Write("Quantile50", GetQuantile(i, 0.5));
+        }
+        if (ok) {
+            ok = data->Write("Quantile99", GetQuantile(i, 0.99));
+        }
+        if (ok) {
+            ok = data->Write("Quantile999", GetQuantile(i, 0.999));
+        }
+        if (ok) {
+            ok = data->MoveToAncestor(1u);
+        }
+        if (!ok) {
+            ret = ErrorManagement::ParametersError;
+            REPORT_ERROR(ret, "Could not write the statistics of %s", signalName.Buffer());
+        }
+    }
+    return ret;
+}
+
+ErrorManagement::ErrorType ExecutionTimeGAM::ResetStatistics() {
+    resetPending = 1;
+    return ErrorManagement::NoError;
+}
+
+uint32 ExecutionTimeGAM::GetNumberOfBins() const {
+    return numberOfBins;
+}
+
+uint64 ExecutionTimeGAM::GetNumberOfValues(const uint32 signalIdx) const {
+    uint64 ret = 0u;
+    if (signalIdx < numberOfSignals) {
+        /*lint -e{613} counts cannot be NULL if numberOfSignals > 0*/
+        ret = counts[signalIdx];
+    }
+    return ret;
+}
+
+uint32 ExecutionTimeGAM::GetMinimum(const uint32 signalIdx) const {
+    uint32 ret = 0u;
+    if (GetNumberOfValues(signalIdx) > 0u) {
+        /*lint -e{613} minimums cannot be NULL if numberOfSignals > 0*/
+        ret = minimums[signalIdx];
+    }
+    return ret;
+}
+
+uint32 ExecutionTimeGAM::GetMaximum(const uint32 signalIdx) const {
+    uint32 ret = 0u;
+    if (signalIdx < numberOfSignals) {
+        /*lint -e{613} maximums cannot be NULL if numberOfSignals > 0*/
+        ret = maximums[signalIdx];
+    }
+    return ret;
+}
+
+uint32 ExecutionTimeGAM::GetMean(const uint32 signalIdx) const {
+    uint32 ret = 0u;
+    uint64 nOfValues = GetNumberOfValues(signalIdx);
+    if (nOfValues > 0u) {
+        /*lint -e{613} sums cannot be NULL if numberOfSignals > 0*/
+        ret = static_cast<uint32>(sums[signalIdx] / nOfValues);
+    }
+    return ret;
+}
+
+uint32 ExecutionTimeGAM::GetQuantile(const uint32 signalIdx,
+                                     const float64 quantile) const {
+    uint32 ret = 0u;
+    uint64 nOfValues = GetNumberOfValues(signalIdx);
+    if (nOfValues > 0u) {
+        float64 rank = quantile * static_cast<float64>(nOfValues);
+        uint64 threshold = static_cast<uint64>(rank);
+        if (static_cast<float64>(threshold) < rank) {
+            threshold++;
+        }
+        if (threshold == 0u) {
+            threshold = 1u;
+        }
+        uint64 accumulated = 0u;
+        bool found = false;
+        for (uint32 b = 0u; (b < numberOfBins) && (!found); b++) {
+            /*lint -e{613} histograms cannot be NULL if numberOfSignals > 0*/
+            accumulated += histograms[(signalIdx * numberOfBins) + b];
+            if (accumulated >= threshold) {
+                ret = GetBinUpperBound(b);
+                found = true;
+            }
+        }
+        uint32 maximum = GetMaximum(signalIdx);
+        if ((!found) || (ret > maximum)) {
+            ret = maximum;
+        }
+    }
+    return ret;
+}
+
+uint64 ExecutionTimeGAM::GetBinCount(const uint32 signalIdx,
+                                     const uint32 binIdx) const {
+    uint64 ret = 0u;
+    if ((signalIdx < numberOfSignals) && (binIdx < numberOfBins)) {
+        /*lint -e{613} histograms cannot be NULL if numberOfSignals > 0*/
+        ret = histograms[(signalIdx * numberOfBins) + binIdx];
+    }
+    return ret;
+}
+
+uint32 ExecutionTimeGAM::GetBinIndex(const uint32 value) const {
+    const uint32 subBins = (1u << significantBits);
+    uint32 mantissa = value;
+    uint32 shift = 0u;
+    while (mantissa >= (subBins << 1u)) {
+        mantissa >>= 1u;
+        shift++;
+    }
+    return (shift * subBins) + mantissa;
+}
+
+uint32 ExecutionTimeGAM::GetBinUpperBound(const uint32 binIdx) const {
+    const uint32 subBins = (1u << significantBits);
+    uint32 ret = binIdx;
+    if (binIdx >= (subBins << 1u)) {
+        uint32 shift = (binIdx / subBins) - 1u;
+        uint64 mantissa = static_cast<uint64>(binIdx - (shift * subBins));
+        ret = static_cast<uint32>(((mantissa + 1u) << shift) - 1u);
+    }
+    return ret;
+}
+
+void ExecutionTimeGAM::Reset() {
+    refreshCounter = 0u;
+    /*lint -e{613} the arrays cannot be NULL as Reset is only called after their allocation*/
+    for (uint32 i = 0u; i < numberOfSignals; i++) {
+        counts[i] = 0u;
+        sums[i] = 0u;
+        minimums[i] = 0xFFFFFFFFu;
+        maximums[i] = 0u;
+        for (uint32 b = 0u; b < numberOfBins; b++) {
+            histograms[(i * numberOfBins) + b] = 0u;
+        }
+    }
+}
+
+void ExecutionTimeGAM::Refresh(const uint32 signalIdx) {
+    /*lint -e{613} outputs and writeHistogram cannot be NULL as Refresh is only called by Execute*/
+    uint32 *output = outputs[signalIdx];
+    output[4u] = GetQuantile(signalIdx, 0.5);
+    output[5u] = GetQuantile(signalIdx, 0.99);
+    output[6u] = GetQuantile(signalIdx, 0.999);
+    /*lint -e{613} writeHistogram cannot be NULL as Refresh is only called by Execute*/
+    if (writeHistogram[signalIdx]) {
+        for (uint32 b = 0u; b < numberOfBins; b++) {
+            uint64 binCount = GetBinCount(signalIdx, b);
+            output[executionTimeNumberOfStatistics + b] = (binCount > 0xFFFFFFFFu) ? 0xFFFFFFFFu : static_cast<uint32>(binCount);
+        }
+    }
+}
+
+CLASS_REGISTER(ExecutionTimeGAM, "1.0")
+CLASS_METHOD_REGISTER(ExecutionTimeGAM, PrintStatistics)
+CLASS_METHOD_REGISTER(ExecutionTimeGAM, GetStatistics)
+CLASS_METHOD_REGISTER(ExecutionTimeGAM, ResetStatistics)
+
+}
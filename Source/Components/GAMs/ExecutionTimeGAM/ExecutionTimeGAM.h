@@ -0,0 +1,337 @@
+/**
+ * @file ExecutionTimeGAM.h
+ * @brief Header file for class ExecutionTimeGAM
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ExecutionTimeGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef EXECUTIONTIMEGAM_H_
+#define EXECUTIONTIMEGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+#include "MessageI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief GAM which accumulates the execution time statistics of the GAMs and of the threads of a RealTimeApplication.
+ * @details The GAMScheduler timestamps, with the HighResolutionTimer, the end of the input brokers, of the Execute() and of
+ * the output brokers of every GAM (the GAMName_ReadTime, GAMName_ExecTime and GAMName_WriteTime signals of the TimingDataSource,
+ * in microseconds from the beginning of the cycle) and the cycle time of every thread (StateName.ThreadName_CycleTime).
+ * This GAM reads any of these signals and, for each input signal, accumulates the minimum, the maximum, the mean and an
+ * HDR (log-linear) histogram of:
+ *  - the value of the signal, if the name of the input signal ends with CycleTime;
+ *  - the difference between the value of the signal and the value of the previous input signal which does not end with CycleTime
+ *    (0 for the first one), otherwise.
+ *
+ * Listing the timing signals of a thread in execution order thus gives the duration of each input broker, Execute() and output
+ * broker (e.g. GAMA_ExecTime - GAMA_ReadTime is the duration of GAMA::Execute()). The GAM does not add any measurement to the
+ * real-time thread and should be the last GAM of the thread (the timing signals of the GAMs which are executed after it are
+ * accumulated in the next cycle).
+ *
+ * The histogram has 2^(SignificantBits + 1) bins of width 1 for the values below 2^(SignificantBits + 1) and then 2^SignificantBits
+ * bins for each power of two, i.e. the relative error of the quantiles is less than 2^-SignificantBits for all the values of a uint32.
+ *
+ * Each input signal shall have a corresponding output signal (in the same order) which is written in every cycle with
+ * {last, minimum, maximum, mean, 50% quantile, 99% quantile, 99.9% quantile} and, if its NumberOfElements is 7 + GetNumberOfBins(),
+ * with the number of values accumulated in each bin of the histogram. The quantiles and the histogram are only updated every
+ * RefreshPeriod cycles. The output signals can be stored (e.g. FileWriter) or published (e.g. SDNPublisher) as any other signal.
+ *
+ * The statistics are reset in every state transition and can be queried and reset with the following registered methods:
+ *  - PrintStatistics: prints (REPORT_ERROR Information) the statistics of all the input signals.
+ *  - GetStatistics: writes SignalName = {NumberOfValues Minimum Maximum Mean Quantile50 Quantile99 Quantile999} for every input signal
+ *    in the ConfigurationDatabase which is the first (and only) element of the message.
+ *  - ResetStatistics: the statistics are reset by the next Execute().
+ *
+ * The registered methods read the statistics while they are being updated by the real-time thread, so that the values of different
+ * signals may belong to different cycles.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +ExecutionTime = {
+ *     Class = ExecutionTimeGAM
+ *     SignificantBits = 4 //Optional. Between 1 and 10. Default = 4.
+ *     RefreshPeriod = 100 //Optional. Number of cycles between updates of the quantiles and of the histograms. Default = 1.
+ *     InputSignals = {
+ *         Thread1_CycleTime = {
+ *             DataSource = Timings
+ *             Alias = "State1.Thread1_CycleTime"
+ *             Type = uint32 //All the input signals shall be uint32 with one element.
+ *         }
+ *         GAMA_ReadTime = {
+ *             DataSource = Timings
+ *             Type = uint32
+ *         }
+ *         GAMA_ExecTime = {
+ *             DataSource = Timings
+ *             Type = uint32
+ *         }
+ *         GAMA_WriteTime = {
+ *             DataSource = Timings
+ *             Type = uint32
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Thread1Cycle = {
+ *             DataSource = DDB1
+ *             Type = uint32 //All the output signals shall be uint32.
+ *             NumberOfElements = 7
+ *         }
+ *         GAMAInput = {
+ *             DataSource = DDB1
+ *             Type = uint32
+ *             NumberOfElements = 7
+ *         }
+ *         GAMAExecute = {
+ *             DataSource = DDB1
+ *             Type = uint32
+ *             NumberOfElements = 471 //7 + GetNumberOfBins() (with SignificantBits = 4) to also output the histogram.
+ *         }
+ *         GAMAOutput = {
+ *             DataSource = DDB1
+ *             Type = uint32
+ *             NumberOfElements = 7
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class ExecutionTimeGAM: public GAM, public MessageI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    ExecutionTimeGAM();
+
+    /**
+     * @brief Destructor. Frees the statistics.
+     */
+    virtual ~ExecutionTimeGAM();
+
+    /**
+     * @brief Reads the parameters specified in the class description.
+     * @param[in] data the GAM configuration.
+     * @return true if all the parameters are valid.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals, allocates the statistics and installs the message filter.
+     * @return true if the signals are those specified in the class description.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Accumulates the values of the input signals and writes the output signals.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Requests the reset of the statistics in the next Execute().
+     * @param[in] currentStateName the current state.
+     * @param[in] nextStateName the next state.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief Prints the statistics of all the input signals.
+     * @return ErrorManagement::NoError.
+     */
+    ErrorManagement::ErrorType PrintStatistics();
+
+    /**
+     * @brief Writes the statistics of all the input signals in the ConfigurationDatabase contained in the message.
+     * @param[in] message the message with a ReferenceT<StructuredDataI> (see the class description).
+     * @return ErrorManagement::NoError if the message contains a StructuredDataI where the statistics could be written,
+     * ErrorManagement::ParametersError otherwise.
+     */
+    ErrorManagement::ErrorType GetStatistics(ReferenceContainer &message);
+
+    /**
+     * @brief Requests the reset of the statistics in the next Execute().
+     * @return ErrorManagement::NoError.
+     */
+    ErrorManagement::ErrorType ResetStatistics();
+
+    /**
+     * @brief Gets the number of bins of each histogram.
+     * @return (33 - SignificantBits) * 2^SignificantBits.
+     */
+    uint32 GetNumberOfBins() const;
+
+    /**
+     * @brief Gets the number of values accumulated for an input signal.
+     * @param[in] signalIdx the index of the input signal.
+     * @return the number of values accumulated since the last reset.
+     */
+    uint64 GetNumberOfValues(const uint32 signalIdx) const;
+
+    /**
+     * @brief Gets the minimum value accumulated for an input signal.
+     * @param[in] signalIdx the index of the input signal.
+     * @return the minimum value (0 if no value was accumulated).
+     */
+    uint32 GetMinimum(const uint32 signalIdx) const;
+
+    /**
+     * @brief Gets the maximum value accumulated for an input signal.
+     * @param[in] signalIdx the index of the input signal.
+     * @return the maximum value.
+     */
+    uint32 GetMaximum(const uint32 signalIdx) const;
+
+    /**
+     * @brief Gets the mean of the values accumulated for an input signal.
+     * @param[in] signalIdx the index of the input signal.
+     * @return the (truncated) mean (0 if no value was accumulated).
+     */
+    uint32 GetMean(const uint32 signalIdx) const;
+
+    /**
+     * @brief Gets a quantile of the values accumulated for an input signal.
+     * @param[in] signalIdx the index of the input signal.
+     * @param[in] quantile the quantile (between 0 and 1).
+     * @return the upper bound of the bin where the quantile lies (limited to the maximum).
+     */
+    uint32 GetQuantile(const uint32 signalIdx,
+                       const float64 quantile) const;
+
+    /**
+     * @brief Gets the number of values accumulated in a bin of the histogram of an input signal.
+     * @param[in] signalIdx the index of the input signal.
+     * @param[in] binIdx the index of the bin.
+     * @return the number of values accumulated in the bin.
+     */
+    uint64 GetBinCount(const uint32 signalIdx,
+                       const uint32 binIdx) const;
+
+    /**
+     * @brief Gets the index of the histogram bin of a value.
+     * @param[in] value the value.
+     * @return the index of the bin.
+     */
+    uint32 GetBinIndex(const uint32 value) const;
+
+    /**
+     * @brief Gets the highest value of a histogram bin.
+     * @param[in] binIdx the index of the bin.
+     * @return the highest value which is accumulated in the bin.
+     */
+    uint32 GetBinUpperBound(const uint32 binIdx) const;
+
+private:
+
+    /**
+     * @brief Resets the statistics of all the input signals.
+     */
+    void Reset();
+
+    /**
+     * @brief Writes the quantiles and (if requested) the histogram of an input signal in its output signal.
+     * @param[in] signalIdx the index of the input signal.
+     */
+    void Refresh(const uint32 signalIdx);
+
+    /**
+     * The number of significant bits of the histogram bins.
+     */
+    uint32 significantBits;
+
+    /**
+     * The number of bins of each histogram.
+     */
+    uint32 numberOfBins;
+
+    /**
+     * The number of cycles between updates of the quantiles and of the histograms.
+     */
+    uint32 refreshPeriod;
+
+    /**
+     * The number of cycles since the last update of the quantiles and of the histograms.
+     */
+    uint32 refreshCounter;
+
+    /**
+     * Number of input (and output) signals.
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * The input signals.
+     */
+    uint32 **inputs;
+
+    /**
+     * The output signals.
+     */
+    uint32 **outputs;
+
+    /**
+     * True if the corresponding input signal is a duration (its name ends with CycleTime).
+     */
+    bool *isDuration;
+
+    /**
+     * True if the corresponding output signal also contains the histogram.
+     */
+    bool *writeHistogram;
+
+    /**
+     * The number of values, the sum of the values, the minimum and the maximum of each input signal.
+     */
+    uint64 *counts;
+    uint64 *sums;
+    uint32 *minimums;
+    uint32 *maximums;
+
+    /**
+     * The histograms of all the input signals (numberOfBins per signal).
+     */
+    uint64 *histograms;
+
+    /**
+     * Set (e.g. by ResetStatistics) to request the reset of the statistics in the next Execute().
+     */
+    volatile int32 resetPending;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EXECUTIONTIMEGAM_H_ */
@@ -0,0 +1,168 @@
+/**
+ * @file FastFourierTransform.cpp
+ * @brief Source file for class FastFourierTransform
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FastFourierTransform (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "FastFourierTransform.h"
+#include "FastMath.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+FastFourierTransform::FastFourierTransform() {
+    size = 0u;
+    bitReversed = NULL_PTR(uint32 *);
+    cosTable = NULL_PTR(float64 *);
+    sinTable = NULL_PTR(float64 *);
+}
+
+FastFourierTransform::~FastFourierTransform() {
+    if (bitReversed != NULL_PTR(uint32 *)) {
+        delete[] bitReversed;
+    }
+    if (cosTable != NULL_PTR(float64 *)) {
+        delete[] cosTable;
+    }
+    if (sinTable != NULL_PTR(float64 *)) {
+        delete[] sinTable;
+    }
+}
+
+bool FastFourierTransform::SetSize(const uint32 sizeIn) {
+    bool ok = (sizeIn > 1u);
+    if (ok) {
+        ok = ((sizeIn & (sizeIn - 1u)) == 0u);
+    }
+    if (ok) {
+        if (bitReversed != NULL_PTR(uint32 *)) {
+            delete[] bitReversed;
+        }
+        if (cosTable != NULL_PTR(float64 *)) {
+            delete[] cosTable;
+        }
+        if (sinTable != NULL_PTR(float64 *)) {
+            delete[] sinTable;
+        }
+        size = sizeIn;
+        bitReversed = new uint32[size];
+        cosTable = new float64[size / 2u];
+        sinTable = new float64[size / 2u];
+        uint32 numberOfBits = 0u;
+        while ((1u << numberOfBits) < size) {
+            numberOfBits++;
+        }
+        for (uint32 i = 0u; i < size; i++) {
+            uint32 reversed = 0u;
+            for (uint32 b = 0u; b < numberOfBits; b++) {
+                if ((i & (1u << b)) != 0u) {
+                    reversed |= (1u << ((numberOfBits - 1u) - b));
+                }
+            }
+            bitReversed[i] = reversed;
+        }
+        for (uint32 k = 0u; k < (size / 2u); k++) {
+            float64 angle = (2.0 * FastMath::PI * static_cast<float64>(k)) / static_cast<float64>(size);
+            cosTable[k] = cos(angle);
+            sinTable[k] = sin(angle);
+        }
+    }
+    return ok;
+}
+
+uint32 FastFourierTransform::GetSize() const {
+    return size;
+}
+
+void FastFourierTransform::Forward(float64 * const re, float64 * const im) const {
+    Transform(re, im, -1.0);
+}
+
+void FastFourierTransform::Inverse(float64 * const re, float64 * const im) const {
+    Transform(re, im, 1.0);
+    if (size > 0u) {
+        float64 scale = 1.0 / static_cast<float64>(size);
+        for (uint32 i = 0u; i < size; i++) {
+            re[i] *= scale;
+            im[i] *= scale;
+        }
+    }
+}
+
+uint32 FastFourierTransform::NextPowerOf2(const uint32 value) {
+    uint32 ret = 1u;
+    while ((ret < value) && (ret != 0u)) {
+        ret <<= 1u;
+    }
+    return ret;
+}
+
+void FastFourierTransform::Transform(float64 * const re, float64 * const im, const float64 sign) const {
+    if ((bitReversed != NULL_PTR(uint32 *)) && (cosTable != NULL_PTR(float64 *)) && (sinTable != NULL_PTR(float64 *))) {
+        for (uint32 i = 0u; i < size; i++) {
+            uint32 j = bitReversed[i];
+            if (j > i) {
+                float64 aux = re[i];
+                re[i] = re[j];
+                re[j] = aux;
+                aux = im[i];
+                im[i] = im[j];
+                im[j] = aux;
+            }
+        }
+        for (uint32 length = 2u; length <= size; length <<= 1u) {
+            uint32 half = length / 2u;
+            uint32 tableStep = size / length;
+            for (uint32 start = 0u; start < size; start += length) {
+                for (uint32 k = 0u; k < half; k++) {
+                    float64 wRe = cosTable[k * tableStep];
+                    float64 wIm = sign * sinTable[k * tableStep];
+                    uint32 top = start + k;
+                    uint32 bottom = top + half;
+                    float64 tRe = (re[bottom] * wRe) - (im[bottom] * wIm);
+                    float64 tIm = (re[bottom] * wIm) + (im[bottom] * wRe);
+                    re[bottom] = re[top] - tRe;
+                    im[bottom] = im[top] - tIm;
+                    re[top] += tRe;
+                    im[top] += tIm;
+                }
+            }
+        }
+    }
+}
+
+}
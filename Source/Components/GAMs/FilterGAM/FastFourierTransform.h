@@ -0,0 +1,147 @@
+/**
+ * @file FastFourierTransform.h
+ * @brief Header file for class FastFourierTransform
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FastFourierTransform
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FASTFOURIERTRANSFORM_H_
+#define FASTFOURIERTRANSFORM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief In-place radix-2 complex fast Fourier transform with float64 precision.
+ * @details The bit-reversal permutation and the twiddle factors are computed once in SetSize(), so that
+ * Forward() and Inverse() do not allocate memory nor compute trigonometric functions and can be used in real-time.
+ * The real and the imaginary parts are stored in two separate arrays of GetSize() elements.
+ * Inverse() is scaled by 1/GetSize(), so that Inverse(Forward(x)) = x.
+ */
+class FastFourierTransform {
+public:
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetSize() = 0
+     */
+    FastFourierTransform();
+
+    /**
+     * @brief Frees the permutation and the twiddle tables.
+     */
+    virtual ~FastFourierTransform();
+
+    /**
+     * @brief Computes the tables for a transform of \a sizeIn points.
+     * @param[in] sizeIn the number of points. Must be a power of 2 greater than 1.
+     * @return true if \a sizeIn is a power of 2 greater than 1.
+     * @post
+     *   GetSize() = sizeIn
+     */
+    bool SetSize(const uint32 sizeIn);
+
+    /**
+     * @brief Gets the number of points of the transform.
+     * @return the number of points of the transform.
+     */
+    uint32 GetSize() const;
+
+    /**
+     * @brief Computes the forward transform X[k] = sum(x[n] * exp(-2*pi*i*k*n/N)).
+     * @param[in,out] re the real part (GetSize() elements).
+     * @param[in,out] im the imaginary part (GetSize() elements).
+     * @pre
+     *   GetSize() > 0
+     */
+    void Forward(float64 * const re, float64 * const im) const;
+
+    /**
+     * @brief Computes the inverse transform x[n] = 1/N * sum(X[k] * exp(2*pi*i*k*n/N)).
+     * @param[in,out] re the real part (GetSize() elements).
+     * @param[in,out] im the imaginary part (GetSize() elements).
+     * @pre
+     *   GetSize() > 0
+     */
+    void Inverse(float64 * const re, float64 * const im) const;
+
+    /**
+     * @brief Gets the smallest power of 2 which is greater or equal than \a value.
+     * @param[in] value the value to round.
+     * @return the smallest power of 2 >= \a value (0 if it does not fit in an uint32).
+     */
+    static uint32 NextPowerOf2(const uint32 value);
+
+private:
+    /**
+     * @brief Computes the butterflies.
+     * @param[in,out] re the real part.
+     * @param[in,out] im the imaginary part.
+     * @param[in] sign -1 for the forward transform and +1 for the inverse transform.
+     */
+    void Transform(float64 * const re, float64 * const im, const float64 sign) const;
+
+    /**
+     * Number of points
+     */
+    uint32 size;
+
+    /**
+     * Bit reversed index of each point
+     */
+    uint32 *bitReversed;
+
+    /**
+     * cos(2*pi*k/N) for k < N/2
+     */
+    float64 *cosTable;
+
+    /**
+     * sin(2*pi*k/N) for k < N/2
+     */
+    float64 *sinTable;
+
+    /*lint -e{1712} no copy constructor and assignment operator: this class owns the tables*/
+    /**
+     * @brief Disallow copy.
+     */
+    FastFourierTransform(const FastFourierTransform &);
+
+    /**
+     * @brief Disallow copy.
+     */
+    FastFourierTransform &operator=(const FastFourierTransform &);
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FASTFOURIERTRANSFORM_H_ */
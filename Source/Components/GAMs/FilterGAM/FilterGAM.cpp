@@ -31,7 +31,11 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "CLASSMETHODREGISTER.h"
 #include "FilterGAM.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -43,7 +47,10 @@
 
 namespace MARTe {
 FilterGAM::FilterGAM() :
-        GAM() {
+        GAM(),
+        StatefulI(),
+        ForkJoinTaskI(),
+        MessageI() {
     num = NULL_PTR(float32 *);
     den = NULL_PTR(float32 *);
     numberOfNumCoeff = 0u;
@@ -52,11 +59,50 @@ FilterGAM::FilterGAM() :
     numberOfSamples = 0u;
     lastInputs = NULL_PTR(float32 **);
     lastOutputs = NULL_PTR(float32 **);
-    output = NULL_PTR(float32 **);
-    input = NULL_PTR(float32 **);
+    output = NULL_PTR(void **);
+    input = NULL_PTR(void **);
+    inputType = Float32Bit;
+    outputType = Float32Bit;
     numberOfSignals = 0u;
     gainInfinite = false;
     resetInEachState = true;
+    laneExecution = false;
+    numberOfLaneGroups = 0u;
+    laneInputs = NULL_PTR(float32 *);
+    laneOutputs = NULL_PTR(float32 *);
+    secondOrderSections = false;
+    sos = NULL_PTR(float64 *);
+    numberOfSections = 0u;
+    sosGain = 1.0;
+    sosStates = NULL_PTR(float64 **);
+    firEngine = FilterGAMFIREngineDirect;
+    overlapSave = false;
+    overlapSaveCrossoverConfigured = false;
+    overlapSaveMinimumTaps = 0u;
+    overlapSaveMinimumSamples = 0u;
+    filterSpectrumRe = NULL_PTR(float64 *);
+    filterSpectrumIm = NULL_PTR(float64 *);
+    overlapSaveRe = NULL_PTR(float64 *);
+    overlapSaveIm = NULL_PTR(float64 *);
+    partitionFirst = NULL_PTR(uint32 *);
+    partitionEnd = NULL_PTR(uint32 *);
+    stagedNum = NULL_PTR(float32 *);
+    stagedDen = NULL_PTR(float32 *);
+    stagedSos = NULL_PTR(float64 *);
+    stagedSosGain = 1.0;
+    stagedSpectrumRe = NULL_PTR(float64 *);
+    stagedSpectrumIm = NULL_PTR(float64 *);
+    stagedStaticGain = 0.0;
+    stagedGainInfinite = false;
+    stagedTransfer = false;
+    stagedCoefficientsReady = 0;
+    stagingLock = 0;
+    filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
+    if (!ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
+    }
 }
 
 FilterGAM::~FilterGAM() {
@@ -82,34 +128,81 @@ FilterGAM::~FilterGAM() {
         }
         delete[] lastOutputs;
     }
-    if (input != NULL_PTR(float32 **)) {
+    if (input != NULL_PTR(void **)) {
         for (uint32 i = 0u; i < numberOfSignals; i++) {
-            if (input[i] != NULL_PTR(float32 *)) {
-                input[i] = NULL_PTR(float32 *);
+            if (input[i] != NULL_PTR(void *)) {
+                input[i] = NULL_PTR(void *);
             }
         }
         delete [] input;
     }
-    if (output != NULL_PTR(float32 **)) {
+    if (output != NULL_PTR(void **)) {
         for (uint32 i = 0u; i < numberOfSignals; i++) {
-            if (output[i] != NULL_PTR(float32 *)) {
-                output[i] = NULL_PTR(float32 *);
+            if (output[i] != NULL_PTR(void *)) {
+                output[i] = NULL_PTR(void *);
             }
         }
         delete [] output;
     }
+    if (laneInputs != NULL_PTR(float32 *)) {
+        delete[] laneInputs;
+    }
+    if (laneOutputs != NULL_PTR(float32 *)) {
+        delete[] laneOutputs;
+    }
+    if (sos != NULL_PTR(float64 *)) {
+        delete[] sos;
+    }
+    if (sosStates != NULL_PTR(float64 **)) {
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            if (sosStates[i] != NULL_PTR(float64 *)) {
+                delete[] sosStates[i];
+            }
+        }
+        delete[] sosStates;
+    }
+    if (filterSpectrumRe != NULL_PTR(float64 *)) {
+        delete[] filterSpectrumRe;
+    }
+    if (filterSpectrumIm != NULL_PTR(float64 *)) {
+        delete[] filterSpectrumIm;
+    }
+    if (overlapSaveRe != NULL_PTR(float64 *)) {
+        delete[] overlapSaveRe;
+    }
+    if (overlapSaveIm != NULL_PTR(float64 *)) {
+        delete[] overlapSaveIm;
+    }
+    if (partitionFirst != NULL_PTR(uint32 *)) {
+        delete[] partitionFirst;
+    }
+    if (partitionEnd != NULL_PTR(uint32 *)) {
+        delete[] partitionEnd;
+    }
+    if (stagedNum != NULL_PTR(float32 *)) {
+        delete[] stagedNum;
+    }
+    if (stagedDen != NULL_PTR(float32 *)) {
+        delete[] stagedDen;
+    }
+    if (stagedSos != NULL_PTR(float64 *)) {
+        delete[] stagedSos;
+    }
+    if (stagedSpectrumRe != NULL_PTR(float64 *)) {
+        delete[] stagedSpectrumRe;
+    }
+    if (stagedSpectrumIm != NULL_PTR(float64 *)) {
+        delete[] stagedSpectrumIm;
+    }
 }
 
-bool FilterGAM::Initialise(StructuredDataI& data) {
+bool FilterGAM::LoadDirectFormCoefficients(StructuredDataI& data) {
     AnyType functionsArray = data.GetType("Num");
     bool errorDetected = false;
-    bool ok = GAM::Initialise(data);
-    if (ok) {
-        ok = (functionsArray.GetDataPointer() != NULL);
-        if (!ok) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting pointer to the numerator");
-            errorDetected = true;
-        }
+    bool ok = (functionsArray.GetDataPointer() != NULL);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting pointer to the numerator");
+        errorDetected = true;
     }
     if (ok) {
         numberOfNumCoeff = functionsArray.GetNumberOfElements(0u);
@@ -163,28 +256,122 @@ bool FilterGAM::Initialise(StructuredDataI& data) {
         }
     }
     if (ok) {
-        float32 sumNumerator = 0.0F;
-        for (uint32 i = 0u; i < numberOfNumCoeff; i++) {
-            //if due to MISRA rules however it is not necessary. At his line the initialization of num is guaranteed b the ok = true...
-            if (num != NULL_PTR(float32 *)) {
-                sumNumerator += num[i];
-            }
+        float64 gain = 0.0;
+        gainInfinite = !DirectFormStaticGain(num, numberOfNumCoeff, den, numberOfDenCoeff, gain);
+        if (!gainInfinite) {
+            staticGain = static_cast<float32>(gain);
         }
-        float32 sumDenominator = 0.0F;
-        for (uint32 i = 0u; i < numberOfDenCoeff; i++) {
-            //if due to MISRA rules however it is not necessary. At his line the initialization of den is guaranteed b the ok = true...
-            if (den != NULL_PTR(float32 *)) {
-                sumDenominator += den[i];
+    }
+    return !errorDetected;
+}
+
+bool FilterGAM::DirectFormStaticGain(const float32 * const numIn, const uint32 numberOfNum, const float32 * const denIn, const uint32 numberOfDen,
+                                     float64 &gain) {
+    float32 sumNumerator = 0.0F;
+    for (uint32 i = 0u; i < numberOfNum; i++) {
+        sumNumerator += numIn[i];
+    }
+    float32 sumDenominator = 0.0F;
+    for (uint32 i = 0u; i < numberOfDen; i++) {
+        sumDenominator += denIn[i];
+    }
+    bool finite = !IsEqual(sumDenominator, 0.0F);
+    if (finite) {
+        //lint -e{414} sumDenominator cannot be 0.
+        gain = static_cast<float64>(sumNumerator / sumDenominator);
+    }
+    return finite;
+}
+
+bool FilterGAM::SecondOrderSectionsStaticGain(const float64 * const sosIn, const uint32 numberOfSectionsIn, const float64 gainIn, float64 &gain) {
+    bool finite = true;
+    gain = gainIn;
+    for (uint32 s = 0u; (s < numberOfSectionsIn) && (finite); s++) {
+        const float64 * const coeff = &sosIn[s * 6u];
+        float64 sumNumerator = (coeff[0] + coeff[1]) + coeff[2];
+        float64 sumDenominator = (coeff[3] + coeff[4]) + coeff[5];
+        finite = !IsEqual(sumDenominator, 0.0);
+        if (finite) {
+            gain *= (sumNumerator / sumDenominator);
+        }
+    }
+    return finite;
+}
+
+bool FilterGAM::LoadSecondOrderSections(StructuredDataI& data) {
+    AnyType functionsMatrix = data.GetType("SOS");
+    bool ok = (functionsMatrix.GetDataPointer() != NULL);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting pointer to the SOS matrix");
+    }
+    uint32 numberOfColumns = 0u;
+    if (ok) {
+        numberOfColumns = functionsMatrix.GetNumberOfElements(0u);
+        numberOfSections = functionsMatrix.GetNumberOfElements(1u);
+        ok = (numberOfColumns == 6u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Each section of the SOS matrix must have 6 coefficients {b0 b1 b2 a0 a1 a2}");
+        }
+    }
+    if (ok) {
+        ok = (numberOfSections > 0u) && (functionsMatrix.GetNumberOfDimensions() == 2u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "SOS must be a matrix with at least one section");
+        }
+    }
+    if (ok) {
+        sos = new float64[numberOfSections * numberOfColumns];
+        Matrix<float64> sosMatrix(sos, numberOfSections, numberOfColumns);
+        ok = data.Read("SOS", sosMatrix);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading SOS");
+        }
+    }
+    if (ok) {
+        ok = CheckNormalisation();
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The coefficients of the filter must be normalised before being introduced into the GAM (a0 = 1 in all the sections)");
+        }
+    }
+    if (ok) {
+        if (!data.Read("Gain", sosGain)) {
+            sosGain = 1.0;
+        }
+        float64 gain = 0.0;
+        gainInfinite = !SecondOrderSectionsStaticGain(sos, numberOfSections, sosGain, gain);
+        if (!gainInfinite) {
+            staticGain = static_cast<float32>(gain);
+        }
+    }
+    return ok;
+}
+
+bool FilterGAM::Initialise(StructuredDataI& data) {
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        StreamString structure;
+        if (data.Read("Structure", structure)) {
+            if (structure == "SOS") {
+                secondOrderSections = true;
+            }
+            else if (structure == "Direct") {
+                secondOrderSections = false;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for Structure (expected values Direct or SOS)");
+                ok = false;
             }
         }
-        if (!IsEqual(sumDenominator, 0.0F)) {
-            //lint -e{414} sumDenominator cannot be 0.
-            staticGain = sumNumerator / sumDenominator;
+    }
+    if (ok) {
+        if (secondOrderSections) {
+            ok = LoadSecondOrderSections(data);
         }
         else {
-            gainInfinite = true;
+            ok = LoadDirectFormCoefficients(data);
         }
     }
+    bool errorDetected = !ok;
     if (ok) {
         uint32 aux;
         ok = data.Read("ResetInEachState", aux);
@@ -206,6 +393,61 @@ bool FilterGAM::Initialise(StructuredDataI& data) {
             }
         }
     }
+    if (!errorDetected) {
+        StreamString executionMode;
+        if (data.Read("ExecutionMode", executionMode)) {
+            if (executionMode == "Lanes") {
+                laneExecution = true;
+            }
+            else if (executionMode == "Scalar") {
+                laneExecution = false;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for ExecutionMode (expected values Scalar or Lanes)");
+                errorDetected = true;
+            }
+        }
+    }
+    if ((!errorDetected) && (laneExecution) && (secondOrderSections)) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "ExecutionMode = Lanes is only supported with Structure = Direct");
+        errorDetected = true;
+    }
+    if (!errorDetected) {
+        StreamString firEngineName;
+        if (data.Read("FIREngine", firEngineName)) {
+            if (firEngineName == "Direct") {
+                firEngine = FilterGAMFIREngineDirect;
+            }
+            else if (firEngineName == "OverlapSave") {
+                firEngine = FilterGAMFIREngineOverlapSave;
+            }
+            else if (firEngineName == "Auto") {
+                firEngine = FilterGAMFIREngineAuto;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for FIREngine (expected values Direct, OverlapSave or Auto)");
+                errorDetected = true;
+            }
+        }
+    }
+    if ((!errorDetected) && (firEngine == FilterGAMFIREngineOverlapSave)) {
+        errorDetected = (secondOrderSections || (numberOfDenCoeff != 1u) || (laneExecution));
+        if (errorDetected) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "FIREngine = OverlapSave is only supported with Structure = Direct, ExecutionMode = Scalar and Den = {1}");
+        }
+    }
+    if ((!errorDetected) && (firEngine == FilterGAMFIREngineAuto)) {
+        //The overlap-save only applies to FIR filters
+        if ((secondOrderSections) || (numberOfDenCoeff != 1u)) {
+            firEngine = FilterGAMFIREngineDirect;
+        }
+        bool minimumTapsConfigured = data.Read("OverlapSaveMinimumTaps", overlapSaveMinimumTaps);
+        bool minimumSamplesConfigured = data.Read("OverlapSaveMinimumSamples", overlapSaveMinimumSamples);
+        overlapSaveCrossoverConfigured = (minimumTapsConfigured || minimumSamplesConfigured);
+    }
+    if (!errorDetected) {
+        errorDetected = !pool.Initialise(data);
+    }
     return !errorDetected;
 }
 
@@ -226,8 +468,18 @@ bool FilterGAM::Setup() {
             errorDetected = true;
         }
     }
+    //initialise the states of the cascade
+    if ((!errorDetected) && (secondOrderSections)) {
+        sosStates = new float64 *[numberOfSignals];
+        for (uint32 m = 0u; m < numberOfSignals; m++) {
+            sosStates[m] = new float64[2u * numberOfSections];
+            for (uint32 i = 0u; i < (2u * numberOfSections); i++) {
+                sosStates[m][i] = 0.0;
+            }
+        }
+    }
     //initialise lastInputs & lastOutputs
-    if (!errorDetected) {
+    if ((!errorDetected) && (!secondOrderSections)) {
         lastInputs = new float32 *[numberOfSignals];
         lastOutputs = new float32*[numberOfSignals];
         //if due to MISRA rules
@@ -291,14 +543,32 @@ bool FilterGAM::Setup() {
                     REPORT_ERROR(ErrorManagement::ParametersError, "numberOfSamplesOutput must be 1 ");
                     errorDetected = true;
                 }
-                ok = (GetSignalType(InputSignals, i) == Float32Bit);
+                TypeDescriptor signalType = GetSignalType(InputSignals, i);
+                if (i == 0u) {
+                    inputType = signalType;
+                }
+                ok = ((signalType == SignedInteger16Bit) || (signalType == SignedInteger32Bit) || (signalType == Float32Bit) || (signalType == Float64Bit));
                 if ((!ok) && (!errorDetected)) {
-                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the input signal %u failed (not float32 as it should be) ", auxIndex);
+                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the input signal %u failed (int16, int32, float32 or float64 expected) ", auxIndex);
                     errorDetected = true;
                 }
-                ok = (GetSignalType(OutputSignals, i) == Float32Bit);
+                ok = (signalType == inputType);
                 if ((!ok) && (!errorDetected)) {
-                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the input signal %u failed (not float32 as it should be)", auxIndex);
+                    REPORT_ERROR(ErrorManagement::ParametersError, "The input signal %u does not have the same type of the first input signal", auxIndex);
+                    errorDetected = true;
+                }
+                signalType = GetSignalType(OutputSignals, i);
+                if (i == 0u) {
+                    outputType = signalType;
+                }
+                ok = ((signalType == Float32Bit) || (signalType == Float64Bit));
+                if ((!ok) && (!errorDetected)) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the output signal %u failed (float32 or float64 expected)", auxIndex);
+                    errorDetected = true;
+                }
+                ok = (signalType == outputType);
+                if ((!ok) && (!errorDetected)) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "The output signal %u does not have the same type of the first output signal", auxIndex);
                     errorDetected = true;
                 }
             }
@@ -411,15 +681,62 @@ bool FilterGAM::Setup() {
         }
     }
     if (!errorDetected) {
-        input = new float32 *[numberOfSignals];
-        output = new float32 *[numberOfSignals];
-        if ((input != NULL_PTR(float32 **)) && (output != NULL_PTR(float32 **))) {
+        input = new void *[numberOfSignals];
+        output = new void *[numberOfSignals];
+        if ((input != NULL_PTR(void **)) && (output != NULL_PTR(void **))) {
             for (uint32 i = 0u; i < numberOfSignals; i++) {
-                input[i] = static_cast<float32 *>(GetInputSignalMemory(i));
-                output[i] = static_cast<float32 *>(GetOutputSignalMemory(i));
+                input[i] = GetInputSignalMemory(i);
+                output[i] = GetOutputSignalMemory(i);
+            }
+        }
+    }
+    if ((!errorDetected) && (laneExecution)) {
+        numberOfLaneGroups = (numberOfSignals + (filterLaneWidth - 1u)) / filterLaneWidth;
+        uint32 laneInputsSize = numberOfLaneGroups * ((numberOfNumCoeff - 1u) + numberOfSamples) * filterLaneWidth;
+        uint32 laneOutputsSize = numberOfLaneGroups * ((numberOfDenCoeff - 1u) + numberOfSamples) * filterLaneWidth;
+        laneInputs = new float32[laneInputsSize];
+        laneOutputs = new float32[laneOutputsSize];
+        //The unused lanes of the last group are kept at zero.
+        for (uint32 i = 0u; i < laneInputsSize; i++) {
+            laneInputs[i] = 0.0F;
+        }
+        for (uint32 i = 0u; i < laneOutputsSize; i++) {
+            laneOutputs[i] = 0.0F;
+        }
+    }
+    if (!errorDetected) {
+        SetupPartitions();
+        //Started before the FIR engine benchmark, so that the engines are timed as they will be executed
+        errorDetected = !pool.Start(*this, GetName());
+    }
+    if ((!errorDetected) && (firEngine != FilterGAMFIREngineDirect)) {
+        bool candidate = true;
+        if ((firEngine == FilterGAMFIREngineAuto) && (overlapSaveCrossoverConfigured)) {
+            candidate = ((numberOfNumCoeff >= overlapSaveMinimumTaps) && (numberOfSamples >= overlapSaveMinimumSamples));
+        }
+        if (candidate) {
+            errorDetected = !SetupOverlapSave();
+        }
+        if ((!errorDetected) && (candidate)) {
+            if ((firEngine == FilterGAMFIREngineAuto) && (!overlapSaveCrossoverConfigured)) {
+                overlapSave = IsOverlapSaveFaster();
+                REPORT_ERROR(ErrorManagement::Information, "Selected the %s FIR engine after benchmarking", overlapSave ? "OverlapSave" : "Direct");
+            }
+            else {
+                overlapSave = true;
             }
         }
     }
+    //staging buffers of LoadCoefficients
+    if (!errorDetected) {
+        if (secondOrderSections) {
+            stagedSos = new float64[numberOfSections * 6u];
+        }
+        else {
+            stagedNum = new float32[numberOfNumCoeff];
+            stagedDen = new float32[numberOfDenCoeff];
+        }
+    }
     //Free pointers MISRA rules
     if (numberOfSamplesInput != NULL_PTR(uint32 *)) {
         delete[] numberOfSamplesInput;
@@ -437,96 +754,440 @@ bool FilterGAM::Setup() {
 }
 
 bool FilterGAM::Execute() {
-    uint32 n = 0u;
+    //The staged coefficients are applied at the cycle boundary, before the workers are released
+    if (stagedCoefficientsReady != 0) {
+        ApplyStagedCoefficients();
+    }
+    return pool.Run();
+}
+
+bool FilterGAM::ExecuteTask(const uint32 executor) {
+    if ((partitionFirst != NULL_PTR(uint32 *)) && (partitionEnd != NULL_PTR(uint32 *)) && (executor <= pool.GetNumberOfWorkers())) {
+        if (inputType == SignedInteger16Bit) {
+            ExecuteOutputType<int16>(executor);
+        }
+        else if (inputType == SignedInteger32Bit) {
+            ExecuteOutputType<int32>(executor);
+        }
+        else if (inputType == Float64Bit) {
+            ExecuteOutputType<float64>(executor);
+        }
+        else {
+            ExecuteOutputType<float32>(executor);
+        }
+    }
+    return true;
+}
+
+template<typename InputType>
+void FilterGAM::ExecuteOutputType(const uint32 executor) {
+    if (outputType == Float64Bit) {
+        ExecuteEngine<InputType, float64>(executor);
+    }
+    else {
+        ExecuteEngine<InputType, float32>(executor);
+    }
+}
+
+template<typename InputType, typename OutputType>
+void FilterGAM::ExecuteEngine(const uint32 executor) {
+    uint32 firstSignal = partitionFirst[executor];
+    uint32 endSignal = partitionEnd[executor];
+    if (secondOrderSections) {
+        ExecuteSecondOrderSections<InputType, OutputType>(firstSignal, endSignal);
+    }
+    else if (overlapSave) {
+        uint32 fftSize = fft.GetSize();
+        ExecuteOverlapSave<InputType, OutputType>(firstSignal, endSignal, &overlapSaveRe[executor * fftSize], &overlapSaveIm[executor * fftSize]);
+    }
+    else if (laneExecution) {
+        ExecuteLanes<InputType, OutputType>(firstSignal, endSignal);
+    }
+    else {
+        ExecuteScalar<InputType, OutputType>(firstSignal, endSignal);
+    }
+}
+
+void FilterGAM::SetupPartitions() {
+    uint32 numberOfPartitions = pool.GetNumberOfWorkers() + 1u;
+    //The partitions hold whole lane groups (Lanes) or whole pairs of signals (overlap-save)
+    uint32 granularity = 1u;
+    if (laneExecution) {
+        granularity = filterLaneWidth;
+    }
+    else if (firEngine != FilterGAMFIREngineDirect) {
+        granularity = 2u;
+    }
+    else {
+        //NOOP
+    }
+    uint32 numberOfUnits = (numberOfSignals + (granularity - 1u)) / granularity;
+    partitionFirst = new uint32[numberOfPartitions];
+    partitionEnd = new uint32[numberOfPartitions];
+    for (uint32 p = 0u; p < numberOfPartitions; p++) {
+        partitionFirst[p] = ((p * numberOfUnits) / numberOfPartitions) * granularity;
+        partitionEnd[p] = (((p + 1u) * numberOfUnits) / numberOfPartitions) * granularity;
+        if (partitionFirst[p] > numberOfSignals) {
+            partitionFirst[p] = numberOfSignals;
+        }
+        if (partitionEnd[p] > numberOfSignals) {
+            partitionEnd[p] = numberOfSignals;
+        }
+    }
+}
+
+template<typename InputType, typename OutputType>
+void FilterGAM::ExecuteScalar(const uint32 firstSignal, const uint32 endSignal) {
     float32 accumulator;
+    uint32 numberOfLastInputs = numberOfNumCoeff - 1u;
+    uint32 numberOfLastOutputs = numberOfDenCoeff - 1u;
+    //Samples which depend on the last states.
+    uint32 warmUpSamples = (numberOfLastInputs > numberOfLastOutputs) ? numberOfLastInputs : numberOfLastOutputs;
+    if (warmUpSamples > numberOfSamples) {
+        warmUpSamples = numberOfSamples;
+    }
     //if due to MISRA rules...
-    if ((input != NULL_PTR(float32 **)) && (output != NULL_PTR(float32 **)) && (lastInputs != NULL_PTR(float32 **)) && (lastOutputs != NULL_PTR(float32 **)) && (num != NULL_PTR(float32 *))
+    if ((input != NULL_PTR(void **)) && (output != NULL_PTR(void **)) && (lastInputs != NULL_PTR(float32 **)) && (lastOutputs != NULL_PTR(float32 **)) && (num != NULL_PTR(float32 *))
             && (den != NULL_PTR(float32 *))) {
-        for (uint32 i = 0u; i < numberOfSignals; i++) {
+        for (uint32 i = firstSignal; i < endSignal; i++) {
             //if de to MISRA rules
-            if ((input[i] != NULL_PTR(float32 *)) && (output[i] != NULL_PTR(float32 *)) && (lastInputs[i] != NULL_PTR(float32 *)) && (lastOutputs[i] != NULL_PTR(float32 *))) {
-                n = 0u;
+            if ((input[i] != NULL_PTR(void *)) && (output[i] != NULL_PTR(void *)) && (lastInputs[i] != NULL_PTR(float32 *)) && (lastOutputs[i] != NULL_PTR(float32 *))) {
+                const InputType * const x = static_cast<const InputType *>(input[i]);
+                OutputType * const y = static_cast<OutputType *>(output[i]);
+                uint32 n = 0u;
+                //warm-up. The taps are visited in the same order as in the steady state (k = 0, 1, ...)
+                while (n < warmUpSamples) {
+                    accumulator = 0.0F;
+                    uint32 lastK = (n < numberOfLastInputs) ? n : numberOfLastInputs;
+                    uint32 k;
+                    for (k = 0u; k <= lastK; k++) {
+                        accumulator += static_cast<float32>(x[n - k]) * num[k];
+                    }
+                    for (; k < numberOfNumCoeff; k++) {
+                        accumulator += (lastInputs[i][(k - n) - 1u]) * num[k];
+                    }
+                    lastK = (n < numberOfLastOutputs) ? n : numberOfLastOutputs;
+                    for (k = 1u; k <= lastK; k++) {
+                        accumulator -= static_cast<float32>(y[n - k]) * den[k];
+                    }
+                    for (; k < numberOfDenCoeff; k++) {
+                        accumulator -= lastOutputs[i][(k - n) - 1u] * den[k];
+                    }
+                    y[n] = static_cast<OutputType>(accumulator);
+                    n++;
+                }
+                //steady state
                 while (n < numberOfSamples) {
                     accumulator = 0.0F;
-                    //sum inputs
                     for (uint32 k = 0u; k < numberOfNumCoeff; k++) {
-                        if (n >= k) {
-                            accumulator += input[i][n - k] * num[k];
-                        }
-                        else {
-                            accumulator += (lastInputs[i][(k - n) - 1u]) * num[k];
-                        }
+                        accumulator += static_cast<float32>(x[n - k]) * num[k];
                     }
-                    //Sum outputs
                     for (uint32 k = 1u; k < numberOfDenCoeff; k++) {
-                        if (n >= k) {
-                            accumulator -= output[i][n - k] * den[k];
-                        }
-                        else {
-                            accumulator -= lastOutputs[i][(k - n) - 1u] * den[k];
-                        }
+                        accumulator -= static_cast<float32>(y[n - k]) * den[k];
                     }
-                    output[i][n] = accumulator;
+                    y[n] = static_cast<OutputType>(accumulator);
                     n++;
                 }
 
                 //update the last values
-                for (uint32 k = 0u; k < (numberOfNumCoeff - 1u); k++) {
-                    lastInputs[i][k] = input[i][(numberOfSamples - k) - 1u];
+                StoreLastStates(lastInputs[i], numberOfLastInputs, x);
+                StoreLastStates(lastOutputs[i], numberOfLastOutputs, y);
+            }
+        }
+    }
+}
+
+template<typename T>
+void FilterGAM::StoreLastStates(float32 * const lastStates, const uint32 numberOfLastStates, const T * const values) const {
+    //lastStates[0] is the most recent value
+    for (uint32 k = numberOfLastStates; k > numberOfSamples; k--) {
+        lastStates[k - 1u] = lastStates[(k - numberOfSamples) - 1u];
+    }
+    for (uint32 k = 0u; (k < numberOfLastStates) && (k < numberOfSamples); k++) {
+        lastStates[k] = static_cast<float32>(values[(numberOfSamples - k) - 1u]);
+    }
+}
+
+template<typename InputType, typename OutputType>
+void FilterGAM::ExecuteOverlapSave(const uint32 firstSignal, const uint32 endSignal, float64 * const workRe, float64 * const workIm) {
+    uint32 numberOfLastInputs = numberOfNumCoeff - 1u;
+    uint32 fftSize = fft.GetSize();
+    //if due to MISRA rules...
+    if ((input != NULL_PTR(void **)) && (output != NULL_PTR(void **)) && (lastInputs != NULL_PTR(float32 **)) && (workRe != NULL_PTR(float64 *))
+            && (workIm != NULL_PTR(float64 *)) && (filterSpectrumRe != NULL_PTR(float64 *)) && (filterSpectrumIm != NULL_PTR(float64 *))) {
+        //The coefficients are real: two signals are filtered with one complex transform (one in the real and the other in the imaginary part).
+        for (uint32 i = firstSignal; i < endSignal; i += 2u) {
+            bool pair = ((i + 1u) < endSignal);
+            const InputType * const x = static_cast<const InputType *>(input[i]);
+            const InputType * const xPair = pair ? static_cast<const InputType *>(input[i + 1u]) : x;
+            //overlap (oldest first), current block and zero padding
+            for (uint32 k = 0u; k < numberOfLastInputs; k++) {
+                workRe[k] = static_cast<float64>(lastInputs[i][(numberOfLastInputs - k) - 1u]);
+                workIm[k] = pair ? static_cast<float64>(lastInputs[i + 1u][(numberOfLastInputs - k) - 1u]) : 0.0;
+            }
+            for (uint32 n = 0u; n < numberOfSamples; n++) {
+                workRe[numberOfLastInputs + n] = static_cast<float64>(x[n]);
+                workIm[numberOfLastInputs + n] = pair ? static_cast<float64>(xPair[n]) : 0.0;
+            }
+            for (uint32 n = (numberOfLastInputs + numberOfSamples); n < fftSize; n++) {
+                workRe[n] = 0.0;
+                workIm[n] = 0.0;
+            }
+            fft.Forward(workRe, workIm);
+            for (uint32 k = 0u; k < fftSize; k++) {
+                float64 re = (workRe[k] * filterSpectrumRe[k]) - (workIm[k] * filterSpectrumIm[k]);
+                float64 im = (workRe[k] * filterSpectrumIm[k]) + (workIm[k] * filterSpectrumRe[k]);
+                workRe[k] = re;
+                workIm[k] = im;
+            }
+            fft.Inverse(workRe, workIm);
+            //the first numberOfLastInputs points are corrupted by the circular convolution and are discarded
+            OutputType * const y = static_cast<OutputType *>(output[i]);
+            for (uint32 n = 0u; n < numberOfSamples; n++) {
+                y[n] = static_cast<OutputType>(workRe[numberOfLastInputs + n]);
+            }
+            StoreLastStates(lastInputs[i], numberOfLastInputs, x);
+            if (pair) {
+                OutputType * const yPair = static_cast<OutputType *>(output[i + 1u]);
+                for (uint32 n = 0u; n < numberOfSamples; n++) {
+                    yPair[n] = static_cast<OutputType>(workIm[numberOfLastInputs + n]);
                 }
-                for (uint32 k = 0u; k < (numberOfDenCoeff - 1u); k++) {
-                    lastOutputs[i][k] = output[i][(numberOfSamples - k) - 1u];
+                StoreLastStates(lastInputs[i + 1u], numberOfLastInputs, xPair);
+            }
+        }
+    }
+}
+
+bool FilterGAM::SetupOverlapSave() {
+    uint32 numberOfLastInputs = numberOfNumCoeff - 1u;
+    bool ok = fft.SetSize(FastFourierTransform::NextPowerOf2(numberOfLastInputs + numberOfSamples));
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Could not compute the FFT tables for %u points", (numberOfLastInputs + numberOfSamples));
+    }
+    if (ok) {
+        uint32 fftSize = fft.GetSize();
+        filterSpectrumRe = new float64[fftSize];
+        filterSpectrumIm = new float64[fftSize];
+        //One working buffer per executor
+        uint32 numberOfPartitions = pool.GetNumberOfWorkers() + 1u;
+        overlapSaveRe = new float64[fftSize * numberOfPartitions];
+        overlapSaveIm = new float64[fftSize * numberOfPartitions];
+        stagedSpectrumRe = new float64[fftSize];
+        stagedSpectrumIm = new float64[fftSize];
+        for (uint32 k = 0u; k < fftSize; k++) {
+            filterSpectrumRe[k] = (k < numberOfNumCoeff) ? static_cast<float64>(num[k]) : 0.0;
+            filterSpectrumIm[k] = 0.0;
+        }
+        fft.Forward(filterSpectrumRe, filterSpectrumIm);
+    }
+    return ok;
+}
+
+bool FilterGAM::IsOverlapSaveFaster() {
+    const uint32 numberOfRuns = 3u;
+    uint64 directTicks = 0u;
+    uint64 overlapSaveTicks = 0u;
+    for (uint32 r = 0u; r < numberOfRuns; r++) {
+        overlapSave = false;
+        uint64 start = HighResolutionTimer::Counter();
+        (void) Execute();
+        uint64 elapsed = HighResolutionTimer::Counter() - start;
+        if ((r == 0u) || (elapsed < directTicks)) {
+            directTicks = elapsed;
+        }
+        overlapSave = true;
+        start = HighResolutionTimer::Counter();
+        (void) Execute();
+        elapsed = HighResolutionTimer::Counter() - start;
+        if ((r == 0u) || (elapsed < overlapSaveTicks)) {
+            overlapSaveTicks = elapsed;
+        }
+    }
+    ResetLastStates();
+    return (overlapSaveTicks < directTicks);
+}
+
+template<typename InputType, typename OutputType>
+void FilterGAM::ExecuteLanes(const uint32 firstSignal, const uint32 endSignal) {
+    uint32 numberOfLastInputs = numberOfNumCoeff - 1u;
+    uint32 numberOfLastOutputs = numberOfDenCoeff - 1u;
+    uint32 inputRows = numberOfLastInputs + numberOfSamples;
+    uint32 outputRows = numberOfLastOutputs + numberOfSamples;
+    //if due to MISRA rules...
+    if ((input != NULL_PTR(void **)) && (output != NULL_PTR(void **)) && (laneInputs != NULL_PTR(float32 *)) && (laneOutputs != NULL_PTR(float32 *)) && (num != NULL_PTR(float32 *))
+            && (den != NULL_PTR(float32 *))) {
+        //the partitions start on a group boundary
+        uint32 endGroup = (endSignal + (filterLaneWidth - 1u)) / filterLaneWidth;
+        for (uint32 g = firstSignal / filterLaneWidth; g < endGroup; g++) {
+            float32 * const xLanes = &laneInputs[g * inputRows * filterLaneWidth];
+            float32 * const yLanes = &laneOutputs[g * outputRows * filterLaneWidth];
+            uint32 firstLaneSignal = g * filterLaneWidth;
+            uint32 usedLanes = numberOfSignals - firstLaneSignal;
+            if (usedLanes > filterLaneWidth) {
+                usedLanes = filterLaneWidth;
+            }
+            //interleave the inputs of the group after the last inputs
+            for (uint32 l = 0u; l < usedLanes; l++) {
+                const InputType * const x = static_cast<const InputType *>(input[firstLaneSignal + l]);
+                float32 *xRow = &xLanes[(numberOfLastInputs * filterLaneWidth) + l];
+                for (uint32 n = 0u; n < numberOfSamples; n++) {
+                    *xRow = static_cast<float32>(x[n]);
+                    xRow = &xRow[filterLaneWidth];
+                }
+            }
+            //no branches: the last states are stored just before the current samples
+            for (uint32 n = 0u; n < numberOfSamples; n++) {
+                float32 accumulator[filterLaneWidth];
+                for (uint32 l = 0u; l < filterLaneWidth; l++) {
+                    accumulator[l] = 0.0F;
+                }
+                const float32 * const xRow = &xLanes[(numberOfLastInputs + n) * filterLaneWidth];
+                for (uint32 k = 0u; k < numberOfNumCoeff; k++) {
+                    const float32 * const xTap = xRow - (k * filterLaneWidth);
+                    const float32 coeff = num[k];
+                    for (uint32 l = 0u; l < filterLaneWidth; l++) {
+                        accumulator[l] += xTap[l] * coeff;
+                    }
+                }
+                float32 * const yRow = &yLanes[(numberOfLastOutputs + n) * filterLaneWidth];
+                for (uint32 k = 1u; k < numberOfDenCoeff; k++) {
+                    const float32 * const yTap = yRow - (k * filterLaneWidth);
+                    const float32 coeff = den[k];
+                    for (uint32 l = 0u; l < filterLaneWidth; l++) {
+                        accumulator[l] -= yTap[l] * coeff;
+                    }
+                }
+                for (uint32 l = 0u; l < filterLaneWidth; l++) {
+                    yRow[l] = accumulator[l];
+                }
+            }
+            //de-interleave the outputs of the group
+            for (uint32 l = 0u; l < usedLanes; l++) {
+                OutputType * const y = static_cast<OutputType *>(output[firstLaneSignal + l]);
+                const float32 *yRow = &yLanes[(numberOfLastOutputs * filterLaneWidth) + l];
+                for (uint32 n = 0u; n < numberOfSamples; n++) {
+                    y[n] = static_cast<OutputType>(*yRow);
+                    yRow = &yRow[filterLaneWidth];
+                }
+            }
+            //the most recent rows become the last states of the next cycle
+            if (numberOfLastInputs > 0u) {
+                (void) MemoryOperationsHelper::Move(xLanes, &xLanes[numberOfSamples * filterLaneWidth], numberOfLastInputs * filterLaneWidth * static_cast<uint32>(sizeof(float32)));
+            }
+            if (numberOfLastOutputs > 0u) {
+                (void) MemoryOperationsHelper::Move(yLanes, &yLanes[numberOfSamples * filterLaneWidth], numberOfLastOutputs * filterLaneWidth * static_cast<uint32>(sizeof(float32)));
+            }
+        }
+    }
+}
+
+template<typename InputType, typename OutputType>
+void FilterGAM::ExecuteSecondOrderSections(const uint32 firstSignal, const uint32 endSignal) {
+    //if due to MISRA rules...
+    if ((input != NULL_PTR(void **)) && (output != NULL_PTR(void **)) && (sosStates != NULL_PTR(float64 **)) && (sos != NULL_PTR(float64 *))) {
+        for (uint32 i = firstSignal; i < endSignal; i++) {
+            //if due to MISRA rules
+            if ((input[i] != NULL_PTR(void *)) && (output[i] != NULL_PTR(void *)) && (sosStates[i] != NULL_PTR(float64 *))) {
+                const InputType * const x = static_cast<const InputType *>(input[i]);
+                OutputType * const y = static_cast<OutputType *>(output[i]);
+                float64 * const w = sosStates[i];
+                for (uint32 n = 0u; n < numberOfSamples; n++) {
+                    float64 value = static_cast<float64>(x[n]) * sosGain;
+                    //transposed direct-form II: w[2s] and w[2s + 1] are the two delays of the section s
+                    for (uint32 s = 0u; s < numberOfSections; s++) {
+                        const float64 * const coeff = &sos[s * 6u];
+                        float64 * const state = &w[s * 2u];
+                        float64 sectionOutput = (coeff[0] * value) + state[0];
+                        state[0] = ((coeff[1] * value) - (coeff[4] * sectionOutput)) + state[1];
+                        state[1] = (coeff[2] * value) - (coeff[5] * sectionOutput);
+                        value = sectionOutput;
+                    }
+                    y[n] = static_cast<OutputType>(value);
                 }
             }
         }
     }
-    return true;
 }
 
 bool FilterGAM::GetResetInEachState() const {
     return resetInEachState;
 }
-bool FilterGAM::PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName) {
-    bool ret = true;
-    if (resetInEachState) {
-        if ((lastInputs != NULL_PTR(float32 **)) && (lastOutputs != NULL_PTR(float32 **))) {
-            for (uint32 i = 0u; i < numberOfSignals; i++) {
-                if (lastInputs[i] != NULL_PTR(float32 *)) {
-                    for (uint32 n = 0u; n < (numberOfNumCoeff - 1u); n++) {
-                        lastInputs[i][n] = 0.0F;
-                    }
+bool FilterGAM::IsLaneExecution() const {
+    return laneExecution;
+}
+
+uint32 FilterGAM::GetNumberOfWorkers() const {
+    return pool.GetNumberOfWorkers();
+}
+
+bool FilterGAM::AreLastStatesAllocated() const {
+    bool ret;
+    if (secondOrderSections) {
+        ret = (sosStates != NULL_PTR(float64 **));
+    }
+    else {
+        ret = ((lastInputs != NULL_PTR(float32 **)) && (lastOutputs != NULL_PTR(float32 **)));
+    }
+    return ret;
+}
+
+void FilterGAM::ResetLastStates() {
+    if (sosStates != NULL_PTR(float64 **)) {
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            if (sosStates[i] != NULL_PTR(float64 *)) {
+                for (uint32 n = 0u; n < (2u * numberOfSections); n++) {
+                    sosStates[i][n] = 0.0;
                 }
-                if (lastOutputs[i] != NULL_PTR(float32 *)) {
-                    for (uint32 n = 0u; n < (numberOfDenCoeff - 1u); n++) {
-                        lastOutputs[i][n] = 0.0F;
-                    }
+            }
+        }
+    }
+    if ((lastInputs != NULL_PTR(float32 **)) && (lastOutputs != NULL_PTR(float32 **))) {
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            if (lastInputs[i] != NULL_PTR(float32 *)) {
+                for (uint32 n = 0u; n < (numberOfNumCoeff - 1u); n++) {
+                    lastInputs[i][n] = 0.0F;
                 }
             }
+            if (lastOutputs[i] != NULL_PTR(float32 *)) {
+                for (uint32 n = 0u; n < (numberOfDenCoeff - 1u); n++) {
+                    lastOutputs[i][n] = 0.0F;
+                }
+            }
+        }
+    }
+    if ((laneInputs != NULL_PTR(float32 *)) && (laneOutputs != NULL_PTR(float32 *))) {
+        uint32 inputRows = (numberOfNumCoeff - 1u) + numberOfSamples;
+        uint32 outputRows = (numberOfDenCoeff - 1u) + numberOfSamples;
+        for (uint32 g = 0u; g < numberOfLaneGroups; g++) {
+            for (uint32 n = 0u; n < ((numberOfNumCoeff - 1u) * filterLaneWidth); n++) {
+                laneInputs[(g * inputRows * filterLaneWidth) + n] = 0.0F;
+            }
+            for (uint32 n = 0u; n < ((numberOfDenCoeff - 1u) * filterLaneWidth); n++) {
+                laneOutputs[(g * outputRows * filterLaneWidth) + n] = 0.0F;
+            }
+        }
+    }
+}
+
+bool FilterGAM::PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName) {
+    bool ret = true;
+    if (resetInEachState) {
+        if (AreLastStatesAllocated()) {
+            ResetLastStates();
         }
         else {
-            REPORT_ERROR(ErrorManagement::ParametersError, "lastInputs or lastOutputs = NULL ");
+            REPORT_ERROR(ErrorManagement::ParametersError, "The last states of the filter are not allocated");
             ret = false;
         }
     }
     else {
         //If the currentStateName and lastStateExecuted are different-> rest values
         if (lastStateExecuted != currentStateName) {
-            if ((lastInputs != NULL_PTR(float32 **)) && (lastOutputs != NULL_PTR(float32 **))) {
-                for (uint32 i = 0u; i < numberOfSignals; i++) {
-                    if (lastInputs[i] != NULL_PTR(float32 *)) {
-                        for (uint32 n = 0u; n < (numberOfNumCoeff - 1u); n++) {
-                            lastInputs[i][n] = 0.0F;
-                        }
-                    }
-                    if (lastOutputs[i] != NULL_PTR(float32 *)) {
-                        for (uint32 n = 0u; n < (numberOfDenCoeff - 1u); n++) {
-                            lastOutputs[i][n] = 0.0F;
-                        }
-                    }
-                }
+            if (AreLastStatesAllocated()) {
+                ResetLastStates();
             }
             else {
-                REPORT_ERROR(ErrorManagement::ParametersError, "lastInputs or lastOutputs = NULL ");
+                REPORT_ERROR(ErrorManagement::ParametersError, "The last states of the filter are not allocated");
                 ret = false;
             }
         }
@@ -535,6 +1196,226 @@ bool FilterGAM::PrepareNextState(const char8 * const currentStateName, const cha
     return ret;
 }
 
+ErrorManagement::ErrorType FilterGAM::LoadCoefficients(ReferenceContainer &message) {
+    ReferenceT<StructuredDataI> data = message.Get(0u);
+    bool ok = data.IsValid();
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "The first element of the message must be a StructuredDataI with the new coefficients");
+    }
+    if (ok) {
+        ok = (secondOrderSections) ? (stagedSos != NULL_PTR(float64 *)) : ((stagedNum != NULL_PTR(float32 *)) && (stagedDen != NULL_PTR(float32 *)));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::IllegalOperation, "The coefficients can only be loaded after the Setup()");
+        }
+    }
+    bool locked = false;
+    if (ok) {
+        locked = Atomic::TestAndSet(&stagingLock);
+        ok = locked;
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "Another set of coefficients is being staged");
+        }
+    }
+    //The staging buffers belong to the real-time thread until the staged set is applied
+    if (ok) {
+        ok = (stagedCoefficientsReady == 0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "The previous set of coefficients has not been applied yet");
+        }
+    }
+    if (ok) {
+        ok = StageCoefficients(*data.operator->());
+    }
+    if (ok) {
+        //Atomic::Increment is a full memory barrier: the real-time thread sees the staged coefficients before the new stagedCoefficientsReady
+        Atomic::Increment(&stagedCoefficientsReady);
+        REPORT_ERROR(ErrorManagement::Information, "New coefficients staged, they will be used from the next cycle");
+    }
+    if (locked) {
+        stagingLock = 0;
+    }
+    ErrorManagement::ErrorType ret(ok);
+    return ret;
+}
+
+bool FilterGAM::IsCoefficientsUpdatePending() const {
+    return (stagedCoefficientsReady != 0);
+}
+
+bool FilterGAM::StageCoefficients(StructuredDataI &data) {
+    bool ok;
+    if (secondOrderSections) {
+        AnyType sosType = data.GetType("SOS");
+        ok = ((sosType.GetNumberOfElements(0u) == 6u) && (sosType.GetNumberOfElements(1u) == numberOfSections));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The new SOS matrix must have %u sections with 6 coefficients", numberOfSections);
+        }
+        if (ok) {
+            Matrix<float64> sosMatrix(stagedSos, numberOfSections, 6u);
+            ok = data.Read("SOS", sosMatrix);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Error reading the new SOS");
+            }
+        }
+        for (uint32 s = 0u; (s < numberOfSections) && (ok); s++) {
+            ok = IsEqual(stagedSos[(s * 6u) + 3u], 1.0);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The new coefficients must be normalised (a0 = 1 in all the sections)");
+            }
+        }
+        if (ok) {
+            if (!data.Read("Gain", stagedSosGain)) {
+                stagedSosGain = 1.0;
+            }
+            stagedGainInfinite = !SecondOrderSectionsStaticGain(stagedSos, numberOfSections, stagedSosGain, stagedStaticGain);
+        }
+    }
+    else {
+        ok = ((data.GetType("Num").GetNumberOfElements(0u) == numberOfNumCoeff) && (data.GetType("Den").GetNumberOfElements(0u) == numberOfDenCoeff));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The new Num and Den must have %u and %u coefficients", numberOfNumCoeff, numberOfDenCoeff);
+        }
+        if (ok) {
+            Vector<float32> numVector(stagedNum, numberOfNumCoeff);
+            Vector<float32> denVector(stagedDen, numberOfDenCoeff);
+            ok = (data.Read("Num", numVector) && data.Read("Den", denVector));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Error reading the new Num and Den");
+            }
+        }
+        if (ok) {
+            ok = IsEqual(stagedDen[0], 1.0F);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The new coefficients must be normalised (Den[0] = 1)");
+            }
+        }
+        if (ok) {
+            stagedGainInfinite = !DirectFormStaticGain(stagedNum, numberOfNumCoeff, stagedDen, numberOfDenCoeff, stagedStaticGain);
+        }
+    }
+    if (ok) {
+        uint32 transfer = 0u;
+        if (!data.Read("Transfer", transfer)) {
+            transfer = 0u;
+        }
+        ok = (transfer <= 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Wrong value for Transfer (expected values 0 or 1)");
+        }
+        stagedTransfer = (transfer == 1u);
+    }
+    if ((ok) && (stagedTransfer)) {
+        ok = ((!stagedGainInfinite) && (!IsEqual(stagedStaticGain, 0.0)));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Transfer = 1 requires a finite and non-zero static gain");
+        }
+    }
+    //The spectrum of the new coefficients is computed here, so that the real-time thread only swaps the buffers
+    if ((ok) && (overlapSave) && (stagedSpectrumRe != NULL_PTR(float64 *)) && (stagedSpectrumIm != NULL_PTR(float64 *))) {
+        uint32 fftSize = fft.GetSize();
+        for (uint32 k = 0u; k < fftSize; k++) {
+            stagedSpectrumRe[k] = (k < numberOfNumCoeff) ? static_cast<float64>(stagedNum[k]) : 0.0;
+            stagedSpectrumIm[k] = 0.0;
+        }
+        fft.Forward(stagedSpectrumRe, stagedSpectrumIm);
+    }
+    return ok;
+}
+
+void FilterGAM::ApplyStagedCoefficients() {
+    if (secondOrderSections) {
+        float64 * const auxSos = sos;
+        sos = stagedSos;
+        stagedSos = auxSos;
+        float64 auxGain = sosGain;
+        sosGain = stagedSosGain;
+        stagedSosGain = auxGain;
+    }
+    else {
+        float32 * const auxNum = num;
+        num = stagedNum;
+        stagedNum = auxNum;
+        float32 * const auxDen = den;
+        den = stagedDen;
+        stagedDen = auxDen;
+        if (overlapSave) {
+            float64 * const auxRe = filterSpectrumRe;
+            filterSpectrumRe = stagedSpectrumRe;
+            stagedSpectrumRe = auxRe;
+            float64 * const auxIm = filterSpectrumIm;
+            filterSpectrumIm = stagedSpectrumIm;
+            stagedSpectrumIm = auxIm;
+        }
+    }
+    gainInfinite = stagedGainInfinite;
+    staticGain = (gainInfinite) ? (0.0F) : (static_cast<float32>(stagedStaticGain));
+    if (stagedTransfer) {
+        TransferLastStates(stagedStaticGain);
+    }
+    Atomic::Decrement(&stagedCoefficientsReady);
+}
+
+void FilterGAM::TransferLastStates(const float64 gain) {
+    uint32 numberOfLastInputs = numberOfNumCoeff - 1u;
+    uint32 numberOfLastOutputs = numberOfDenCoeff - 1u;
+    for (uint32 i = 0u; i < numberOfSignals; i++) {
+        //The constant input which produces the last output in steady state
+        float64 y = GetLastOutput(i);
+        float64 x = y / gain;
+        if (secondOrderSections) {
+            if ((sosStates != NULL_PTR(float64 **)) && (sos != NULL_PTR(float64 *))) {
+                float64 value = x * sosGain;
+                for (uint32 s = 0u; s < numberOfSections; s++) {
+                    const float64 * const coeff = &sos[s * 6u];
+                    float64 * const state = &sosStates[i][s * 2u];
+                    //The static gains of the sections are finite since the static gain of the cascade is finite
+                    float64 sectionOutput = value * (((coeff[0] + coeff[1]) + coeff[2]) / ((coeff[3] + coeff[4]) + coeff[5]));
+                    state[1] = (coeff[2] * value) - (coeff[5] * sectionOutput);
+                    state[0] = ((coeff[1] * value) - (coeff[4] * sectionOutput)) + state[1];
+                    value = sectionOutput;
+                }
+            }
+        }
+        else if (laneExecution) {
+            if ((laneInputs != NULL_PTR(float32 *)) && (laneOutputs != NULL_PTR(float32 *))) {
+                uint32 group = i / filterLaneWidth;
+                uint32 lane = i % filterLaneWidth;
+                float32 * const xLanes = &laneInputs[group * (numberOfLastInputs + numberOfSamples) * filterLaneWidth];
+                float32 * const yLanes = &laneOutputs[group * (numberOfLastOutputs + numberOfSamples) * filterLaneWidth];
+                for (uint32 k = 0u; k < numberOfLastInputs; k++) {
+                    xLanes[(k * filterLaneWidth) + lane] = static_cast<float32>(x);
+                }
+                for (uint32 k = 0u; k < numberOfLastOutputs; k++) {
+                    yLanes[(k * filterLaneWidth) + lane] = static_cast<float32>(y);
+                }
+            }
+        }
+        else {
+            if ((lastInputs != NULL_PTR(float32 **)) && (lastOutputs != NULL_PTR(float32 **))) {
+                for (uint32 k = 0u; k < numberOfLastInputs; k++) {
+                    lastInputs[i][k] = static_cast<float32>(x);
+                }
+                for (uint32 k = 0u; k < numberOfLastOutputs; k++) {
+                    lastOutputs[i][k] = static_cast<float32>(y);
+                }
+            }
+        }
+    }
+}
+
+float64 FilterGAM::GetLastOutput(const uint32 signal) const {
+    float64 value = 0.0;
+    if ((output != NULL_PTR(void **)) && (numberOfSamples > 0u)) {
+        if (outputType == Float64Bit) {
+            value = static_cast<const float64 *>(output[signal])[numberOfSamples - 1u];
+        }
+        else {
+            value = static_cast<float64>(static_cast<const float32 *>(output[signal])[numberOfSamples - 1u]);
+        }
+    }
+    return value;
+}
+
 uint32 FilterGAM::GetNumberOfNumCoeff() const {
     return numberOfNumCoeff;
 }
@@ -567,12 +1448,43 @@ bool FilterGAM::GetDenCoeff(float32 * const coeff) const {
 
 bool FilterGAM::CheckNormalisation() const {
     bool ret = false;
-    if (den != NULL_PTR(float32 *)) {
+    if (secondOrderSections) {
+        if (sos != NULL_PTR(float64 *)) {
+            ret = true;
+            for (uint32 s = 0u; (s < numberOfSections) && (ret); s++) {
+                ret = (IsEqual(1.0, sos[(s * 6u) + 3u]));
+            }
+        }
+    }
+    else if (den != NULL_PTR(float32 *)) {
         ret = (IsEqual(static_cast<float32>(1.0), den[0]));
     }
     return ret;
 }
 
+bool FilterGAM::IsOverlapSave() const {
+    return overlapSave;
+}
+
+bool FilterGAM::IsSecondOrderSections() const {
+    return secondOrderSections;
+}
+
+uint32 FilterGAM::GetNumberOfSections() const {
+    return numberOfSections;
+}
+
+bool FilterGAM::GetSOSCoeff(float64 * const coeff) const {
+    bool ret = false;
+    if (sos != NULL_PTR(float64 *)) {
+        for (uint32 i = 0u; i < (numberOfSections * 6u); i++) {
+            coeff[i] = sos[i];
+        }
+        ret = true;
+    }
+    return ret;
+}
+
 float32 FilterGAM::GetStaticGain(bool & isInfinite) const {
     isInfinite = gainInfinite;
     return staticGain;
@@ -585,5 +1497,6 @@ uint32 FilterGAM::GetNumberOfSamples() const {
     return numberOfSamples;
 }
 CLASS_REGISTER(FilterGAM, "1.0")
+CLASS_METHOD_REGISTER(FilterGAM, LoadCoefficients)
 }
 
@@ -32,7 +32,11 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "FastFourierTransform.h"
+#include "ForkJoinPool.h"
 #include "GAM.h"
+#include "MessageI.h"
+#include "RegisteredMethodsMessageFilter.h"
 #include "StructuredDataI.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -40,7 +44,21 @@
 
 namespace MARTe {
 /**
- * @brief GAM which allows to implement FIR & IIR filter with float32 type.
+ * Number of signals filtered together when FilterGAM executes in Lanes mode.
+ */
+static const uint32 filterLaneWidth = 8u;
+
+/**
+ * Algorithm used to compute the FIR filters.
+ */
+enum FilterGAMFIREngine {
+    FilterGAMFIREngineDirect,
+    FilterGAMFIREngineOverlapSave,
+    FilterGAMFIREngineAuto
+};
+
+/**
+ * @brief GAM which allows to implement FIR & IIR filters.
  * @details The GAM configured coefficients of the filter must have
  * the numerator (num) and denominator (den) defined and normalised. If a FIR filter is implemented the Den = 1;
  *
@@ -61,8 +79,25 @@ namespace MARTe {
  * H(z)=\frac{\sum_{k=0}^{M-1} num[k]*z^{(-k)}}{1+\sum_{k=1}^{N-1} den[k]*z^{-k}}
  * \f$
  *
+ * Long FIR filters (Den = {1}) can be computed with an FFT based overlap-save block convolution, which costs O(L*log(L)) per cycle,
+ * with L the power of 2 >= NumberOfSamples + M - 1, instead of the O(NumberOfSamples * M) of the direct form.
+ * The last M - 1 inputs (lastInputs) are used as the overlap of the block. Since the coefficients are real, signals are transformed in pairs
+ * (one in the real and the other in the imaginary part of the same complex transform). The transforms are computed in float64.
+ * The FIREngine parameter selects the algorithm:
+ *  - Direct (default): the difference equation above (see also ExecutionMode);
+ *  - OverlapSave: the overlap-save block convolution;
+ *  - Auto: the overlap-save is used if M >= OverlapSaveMinimumTaps and NumberOfSamples >= OverlapSaveMinimumSamples. If none of these two parameters
+ *  is set, both algorithms are timed in Setup() and the fastest is selected. IIR filters always use the Direct engine.
+ * Note that the overlap-save results are not bit-for-bit identical to the direct form (the difference is within the float32 precision).
+ *
  * The GAM supports multiple input signals (and output signal) only if the characteristics of the input arrays are the same
- * (i.e. The input signals have the same number of elements, the same number of samples and the same type). Currently, the only type supported is float32.
+ * (i.e. The input signals have the same number of elements, the same number of samples and the same type).
+ *
+ * The input signals can be int16, int32, float32 or float64 and the output signals float32 or float64 (all the input signals must have the same type
+ * and all the output signals must have the same type). The conversion is performed inside the filter loops, so that no intermediate ConversionGAM is needed
+ * (e.g. to filter the int16 samples of an ADC). The arithmetic of each structure does not depend on the signal types: the Direct structure computes in float32
+ * (as the coefficients and the last states) and the SOS structure and the overlap-save in float64. Note that int32 inputs above 2^24 lose precision
+ * when converted to float32.
  *
  * The inputs and outputs must be arrays (could be arrays of 1 elements).
  *
@@ -70,7 +105,54 @@ namespace MARTe {
  *
  * Moreover the function offers the method StaticGain() in order to make available the real gain of the filter (after converting into float32).
  *
- * @pre The filter must be normalised (den[0] = 1).
+ * Two filter structures are available:
+ *  - Direct (default): the difference equation above, with float32 coefficients and states, configured with Num and Den.
+ *  - SOS: a cascade of second-order sections (biquads), each one computed in the transposed direct-form II with float64 coefficients,
+ *  states and accumulators. The sections are configured with the SOS matrix, one row {b0 b1 b2 a0 a1 a2} per section (a0 must be 1),
+ *  and the optional Gain (default 1) which is applied to the input of the first section. Each section computes:
+ *
+ * \f$
+ * y[n] = b0*x[n]+w1[n-1], w1[n] = b1*x[n]-a1*y[n]+w2[n-1], w2[n] = b2*x[n]-a2*y[n]
+ * \f$
+ *
+ *  High order IIR filters should be implemented with this structure since it is numerically much more robust than the direct form.
+ *
+ * Two execution modes are available for the Direct structure:
+ *  - Scalar (default): each signal is filtered independently, one sample at a time.
+ *  - Lanes: the signals are grouped in lanes of filterLaneWidth signals which are filtered together. The last states of each group are stored
+ *  in a struct-of-arrays layout (one row per delay, one column per signal) followed by the samples of the current cycle, so that the inner loops
+ *  have no branches and can be vectorised by the compiler over the signals of the lane. This mode is advantageous for banks of many signals sharing
+ *  the same filter and produces exactly the same results as the Scalar mode (the operations of each signal are performed in the same order).
+ *
+ * Wide filter banks (e.g. hundreds of channels) can be split across NumberOfWorkers helper threads (see ForkJoinPool): the signals are
+ * partitioned in NumberOfWorkers + 1 contiguous ranges (of whole lane groups in Lanes mode and of whole pairs of signals with the overlap-save)
+ * and the real-time thread filters the first range while each worker filters one of the others. Execute() returns only after all the ranges
+ * were filtered. The threads are created in Setup() and busy-wait between cycles, so that they should be placed on isolated cores with
+ * the ThreadPlacement block. Since each signal is always filtered by the same sequence of operations, the outputs are bit-for-bit identical
+ * to the ones computed without workers.
+ *
+ * The coefficients can be replaced while the application is running with the LoadCoefficients RPC (registered with CLASS_METHOD_REGISTER).
+ * The first element of the message shall be a StructuredDataI with the new Num and Den (Structure = Direct) or the new SOS and Gain (Structure = SOS)
+ * and the optional Transfer (0 or 1). The new coefficients are validated and staged (double buffered) by the calling thread and the real-time
+ * thread swaps them at the beginning of the next Execute(), before the workers are released, so that all the signals and all the samples of a cycle
+ * are filtered with the same coefficients. The number of coefficients (or of sections) cannot change. If a set is staged while the previous one was
+ * not yet applied the RPC fails. If Transfer = 1 the last states of each signal are set, at the swap, to the steady state of the new filter which
+ * produces the last output of the signal (i.e. the states of a constant input equal to the last output divided by the new static gain), so that the
+ * output does not jump (bumpless transfer) and then evolves with the dynamics of the new filter. Otherwise the last states are kept.
+ * Transfer = 1 requires a finite and non-zero static gain.
+ *
+ * <pre>
+ * ReferenceT<ConfigurationDatabase> coefficients(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+ * coefficients->Write("Num", newNum);
+ * coefficients->Write("Den", newDen);
+ * coefficients->Write("Transfer", 1u);
+ * ReferenceT<Message> message(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+ * ... //Destination = the path of the FilterGAM, Function = LoadCoefficients
+ * message->Insert(coefficients);
+ * MessageI::SendMessage(message, NULL);
+ * </pre>
+ *
+ * @pre The filter must be normalised (den[0] = 1 or a0 = 1 for all the sections).
  * @pre The size of the numerator and the denominator must be at least 1;
  * @post The output is the input filtered.
  *
@@ -79,23 +161,36 @@ namespace MARTe {
  * <pre>
  * +Filter1 = {
  *     Class = FilterGAM
- *     Num = {0.5 0.5} //Compulsory. Filter numerator coefficient.
- *     Den = {1} //Compulsory. Filter denominator coefficient.
+ *     Structure = Direct //Optional. Direct (default) or SOS. See above.
+ *     Num = {0.5 0.5} //Compulsory if Structure = Direct. Filter numerator coefficient.
+ *     Den = {1} //Compulsory if Structure = Direct. Filter denominator coefficient.
+ *     //SOS = {{0.0675 0.1349 0.0675 1 -1.1430 0.4128} {1 2 1 1 -1.5 0.8}} //Compulsory if Structure = SOS. One row per section.
+ *     //Gain = 1.0 //Optional if Structure = SOS.
  *     ResetInEachState //Optional. If true the filter will be reset on each state change. Otherwise it will be reset only if the filter was not used in the previous state.
+ *     ExecutionMode = Lanes //Optional. Scalar (default) or Lanes. See above.
+ *     FIREngine = Auto //Optional. Direct (default), OverlapSave or Auto. See above.
+ *     OverlapSaveMinimumTaps = 64 //Optional. Only meaningful if FIREngine = Auto.
+ *     OverlapSaveMinimumSamples = 256 //Optional. Only meaningful if FIREngine = Auto.
+ *     NumberOfWorkers = 3 //Optional. Number of helper threads which filter part of the signals. Default = the number of CPUs in ThreadPlacement (or 0).
+ *     ThreadPlacement = { //Optional. The CPUs and the priority of the helper threads. See ForkJoinPool and ThreadPlacement.
+ *         CPUs = 0xE
+ *         PriorityClass = RealTimePriorityClass
+ *         PriorityLevel = 20
+ *     }
  *     InputSignals = {
  *         InputSignal1 = { //Filter will be applied to each signal. The number of input and output signals must be the same.
  *             DataSource = "DDB1"
- *             Type = float32 //Only supported type.
+ *             Type = int16 //int16, int32, float32 or float64. The same for all the input signals.
  *         }
  *         InputSignal2 = {
  *             DataSource = "DDB1"
- *             Type = float32
+ *             Type = int16
  *         }
  *     }
  *     OutputSignals = {
  *         OutputSignal1 = {
  *             DataSource = "LCD"
- *             Type = float32
+ *             Type = float32 //float32 or float64. The same for all the output signals.
  *         }
  *         OutputSignal2 = {
  *             DataSource = "LCD"
@@ -105,7 +200,7 @@ namespace MARTe {
  * }
  * </pre>
  */
-class FilterGAM: public GAM, public StatefulI {
+class FilterGAM: public GAM, public StatefulI, public ForkJoinTaskI, public MessageI {
 public:
     CLASS_REGISTER_DECLARATION()
     /**
@@ -120,7 +215,9 @@ public:
      *   GetStaticGain() = 0 &&
      *   GetNumberOfSamples() = 0 &&
      *   GetNumberOfSignals() = 0 &&
-     *   GetResetInEachState() = true
+     *   GetResetInEachState() = true &&
+     *   IsLaneExecution() = false &&
+     *   GetNumberOfWorkers() = 0
      */
     FilterGAM();
 
@@ -136,6 +233,7 @@ public:
      * @details Allocates memory for the numerator and denominator coefficients and load their values.
      * Allocates memory for the last input and output values (final state)
      * Checks that the coefficients are normalised.
+     * Reads the optional ExecutionMode (Scalar or Lanes).
      * @param[in] data the GAM configuration.
      * @return true on succeed
      * @pre
@@ -174,13 +272,16 @@ public:
      *   input != NULL &&
      *   output != NULL &&
      *   lastInputs != NULL &&
-     *   lastOutputs != NULL
+     *   lastOutputs != NULL &&
+     *   (IsLaneExecution() => laneInputs != NULL && laneOutputs != NULL)
+     * The NumberOfWorkers helper threads are started.
      */
     virtual bool Setup();
 
     /**
      * @brief Perform the filtering.
-     * @details Computes the following operations for each signal:
+     * @details If a set of coefficients was staged with LoadCoefficients, it is applied first (see the class description).
+     * Computes the following operations for each signal:
      *
      * \f$
      * y[n] = \sum_{k=0}^{M-1}num[k]*x[n-k]-\sum_{k=1}^{N-1}den[k]*y[n-k]
@@ -190,6 +291,10 @@ public:
      * coefficients, X is the input vector of the filter and Y is the output vector of the
      * filter
      *
+     * The first max(M, N) - 1 samples (warm-up) are computed using the last states, the remaining samples only
+     * use the input and output arrays of the current cycle. If IsLaneExecution() the signals are filtered in groups of filterLaneWidth.
+     * With NumberOfWorkers > 0 the signals are filtered in parallel by the real-time thread and by the workers.
+     *
      * @return true
      * @pre
      *   Initialise() &&
@@ -197,12 +302,37 @@ public:
      */
     virtual bool Execute();
 
+    /**
+     * @brief ForkJoinPool callback. Filters the range of signals assigned to \a executor.
+     * @param[in] executor 0 for the real-time thread, n for the worker n - 1.
+     * @return true
+     */
+    virtual bool ExecuteTask(const uint32 executor);
+
+    /**
+     * @brief Gets the number of helper threads (NumberOfWorkers).
+     * @return the number of helper threads.
+     */
+    uint32 GetNumberOfWorkers() const;
+
     /**
      * @brief Queries the value of resetInEachState
      * @return resetInEachState
      */
     bool GetResetInEachState () const;
 
+    /**
+     * @brief Queries if the signals are filtered in lanes (ExecutionMode = Lanes).
+     * @return true if ExecutionMode = Lanes.
+     */
+    bool IsLaneExecution() const;
+
+    /**
+     * @brief Queries if the FIR filter is computed with the overlap-save block convolution.
+     * @return true if the overlap-save engine was selected in Setup().
+     */
+    bool IsOverlapSave() const;
+
     /**
      * @brief Resets the lastInputs and lastOutputs if necessary.
      * @details The behaviour of this function can be configured in order to reset the filter every time
@@ -252,7 +382,7 @@ public:
 
     /**
      * @brief Checks that the coefficients are normalised.
-     * @details Checks that den[0] = 1.
+     * @details Checks that den[0] = 1 (Structure = Direct) or that a0 = 1 in all the sections (Structure = SOS).
      * @return true if the coefficients are normalised.
      * @pre
      *   Initialise()
@@ -261,7 +391,7 @@ public:
 
     /**
      * @brief Gets the filter static gain value.
-     * @details staticGain= SUM(num)/SUM(den). If the gain is infinite the static gain is 0 and the variable isInfinite is set true
+     * @details staticGain= SUM(num)/SUM(den) (or Gain * the product of the static gains of all the sections). If the gain is infinite the static gain is 0 and the variable isInfinite is set true
      * @param[in] isInfinite indicates if the gain is infinite.
      * @return the staticGain.
      */
@@ -281,7 +411,178 @@ public:
      */
     uint32 GetNumberOfSignals() const;
 
+    /**
+     * @brief Queries if the filter is a cascade of second-order sections (Structure = SOS).
+     * @return true if Structure = SOS.
+     */
+    bool IsSecondOrderSections() const;
+
+    /**
+     * @brief Gets the number of second-order sections.
+     * @return the number of second-order sections (0 if Structure = Direct).
+     */
+    uint32 GetNumberOfSections() const;
+
+    /**
+     * @brief Gets the coefficients of the second-order sections.
+     * @param[in] coeff pointer to where the GetNumberOfSections() * 6 coefficients will be copied to.
+     * @return true if Structure = SOS and the coefficients were loaded.
+     */
+    bool GetSOSCoeff(float64 * const coeff) const;
+
+    /**
+     * @brief Stages a new set of coefficients, to be applied by the real-time thread at the beginning of the next Execute().
+     * @details Registered as an RPC. See the class description.
+     * @param[in] message the first element is a StructuredDataI with Num and Den (Structure = Direct) or SOS and Gain (Structure = SOS)
+     * and the optional Transfer.
+     * @return ErrorManagement::NoError if the coefficients are valid (same number of coefficients, normalised and, with Transfer = 1, a finite
+     * and non-zero static gain) and were staged.
+     * @pre
+     *   Setup()
+     */
+    ErrorManagement::ErrorType LoadCoefficients(ReferenceContainer &message);
+
+    /**
+     * @brief Queries if a set of coefficients is staged and was not applied yet.
+     * @return true if a set of coefficients is waiting for the next Execute().
+     */
+    bool IsCoefficientsUpdatePending() const;
+
 private:
+    /**
+     * @brief Loads the Num and Den coefficients and computes the static gain.
+     * @param[in] data the GAM configuration.
+     * @return true if the coefficients are valid and normalised.
+     */
+    bool LoadDirectFormCoefficients(StructuredDataI & data);
+
+    /**
+     * @brief Loads the SOS matrix and the Gain and computes the static gain.
+     * @param[in] data the GAM configuration.
+     * @return true if the sections are valid and normalised.
+     */
+    bool LoadSecondOrderSections(StructuredDataI & data);
+
+    /**
+     * @brief Filters the signals [firstSignal, endSignal[ with the cascade of second-order sections.
+     */
+    template<typename InputType, typename OutputType>
+    void ExecuteSecondOrderSections(const uint32 firstSignal, const uint32 endSignal);
+
+    /**
+     * @brief Checks that the memory for the last states was allocated (i.e. Setup() was called).
+     * @return true if the last states are allocated.
+     */
+    bool AreLastStatesAllocated() const;
+
+    /**
+     * @brief Filters the signals [firstSignal, endSignal[ one at a time.
+     */
+    template<typename InputType, typename OutputType>
+    void ExecuteScalar(const uint32 firstSignal, const uint32 endSignal);
+
+    /**
+     * @brief Filters the signals [firstSignal, endSignal[ in groups of filterLaneWidth (firstSignal shall be a multiple of filterLaneWidth).
+     */
+    template<typename InputType, typename OutputType>
+    void ExecuteLanes(const uint32 firstSignal, const uint32 endSignal);
+
+    /**
+     * @brief Filters the signals [firstSignal, endSignal[ (in pairs) with the overlap-save block convolution, using the working buffers workRe and workIm.
+     */
+    template<typename InputType, typename OutputType>
+    void ExecuteOverlapSave(const uint32 firstSignal, const uint32 endSignal, float64 * const workRe, float64 * const workIm);
+
+    /**
+     * @brief Calls the engine selected in Setup() for the given signal types, on the signals of \a executor.
+     */
+    template<typename InputType, typename OutputType>
+    void ExecuteEngine(const uint32 executor);
+
+    /**
+     * @brief Calls ExecuteEngine() for the type of the output signals.
+     */
+    template<typename InputType>
+    void ExecuteOutputType(const uint32 executor);
+
+    /**
+     * @brief Splits the signals in one contiguous range per executor.
+     */
+    void SetupPartitions();
+
+    /**
+     * @brief Computes the FFT tables and the spectrum of the filter and allocates the overlap-save buffers.
+     * @return true if the FFT could be configured.
+     */
+    bool SetupOverlapSave();
+
+    /**
+     * @brief Times the direct and the overlap-save engines and resets the last states.
+     * @return true if the overlap-save is faster.
+     */
+    bool IsOverlapSaveFaster();
+
+    /**
+     * @brief Updates the last states with the values of the current cycle.
+     * @param[in,out] lastStates the last states (lastStates[0] is the most recent).
+     * @param[in] numberOfLastStates the number of last states.
+     * @param[in] values the numberOfSamples values of the current cycle.
+     */
+    template<typename T>
+    void StoreLastStates(float32 * const lastStates, const uint32 numberOfLastStates, const T * const values) const;
+
+    /**
+     * @brief Sets all the last states to zero.
+     */
+    void ResetLastStates();
+
+    /**
+     * @brief Computes the static gain of direct form coefficients.
+     * @param[in] numIn the numerator coefficients.
+     * @param[in] numberOfNum the number of numerator coefficients.
+     * @param[in] denIn the denominator coefficients.
+     * @param[in] numberOfDen the number of denominator coefficients.
+     * @param[out] gain SUM(num)/SUM(den).
+     * @return false if the gain is infinite.
+     */
+    static bool DirectFormStaticGain(const float32 * const numIn, const uint32 numberOfNum, const float32 * const denIn, const uint32 numberOfDen,
+                                     float64 &gain);
+
+    /**
+     * @brief Computes the static gain of a cascade of second-order sections.
+     * @param[in] sosIn the coefficients of the sections.
+     * @param[in] numberOfSectionsIn the number of sections.
+     * @param[in] gainIn the gain applied to the input of the first section.
+     * @param[out] gain gainIn * the product of the static gains of all the sections.
+     * @return false if the gain is infinite.
+     */
+    static bool SecondOrderSectionsStaticGain(const float64 * const sosIn, const uint32 numberOfSectionsIn, const float64 gainIn, float64 &gain);
+
+    /**
+     * @brief Reads and validates the coefficients of LoadCoefficients into the staging buffers.
+     * @param[in] data the new coefficients.
+     * @return true if the coefficients are valid.
+     */
+    bool StageCoefficients(StructuredDataI &data);
+
+    /**
+     * @brief Swaps the staged and the current coefficients and transfers the last states (if requested). Called by the real-time thread.
+     */
+    void ApplyStagedCoefficients();
+
+    /**
+     * @brief Sets the last states of all the signals to the steady state of the current coefficients which produces the last output.
+     * @param[in] gain the static gain of the current coefficients (finite and non-zero).
+     */
+    void TransferLastStates(const float64 gain);
+
+    /**
+     * @brief Gets the last output sample of a signal.
+     * @param[in] signal the signal index.
+     * @return the last sample of the output of the signal.
+     */
+    float64 GetLastOutput(const uint32 signal) const;
+
     /**
      * Pointer to the numerator coefficients.
      */
@@ -320,12 +621,22 @@ private:
     /**
      * Array of pointers to the input buffers
      */
-    float32 **input;
+    void **input;
 
     /**
      * Array of pointers to the output buffers
      */
-    float32 **output;
+    void **output;
+
+    /**
+     * Type of the input signals
+     */
+    TypeDescriptor inputType;
+
+    /**
+     * Type of the output signals
+     */
+    TypeDescriptor outputType;
 
     /**
      * Number of values of each array. All arrays have the same numberOfSamples
@@ -347,6 +658,162 @@ private:
 
     /*allows to choose between reset the filter every time the state changes or only when in the previous state the filter was not executed. */
     bool resetInEachState;
+
+    /**
+     * True if ExecutionMode = Lanes
+     */
+    bool laneExecution;
+
+    /**
+     * Number of groups of filterLaneWidth signals (the last group may be partially used)
+     */
+    uint32 numberOfLaneGroups;
+
+    /**
+     * For each group, (numberOfNumCoeff - 1) rows of last inputs followed by numberOfSamples rows of current inputs.
+     * Each row holds filterLaneWidth values (one per signal of the group).
+     */
+    float32 *laneInputs;
+
+    /**
+     * For each group, (numberOfDenCoeff - 1) rows of last outputs followed by numberOfSamples rows of current outputs.
+     * Each row holds filterLaneWidth values (one per signal of the group).
+     */
+    float32 *laneOutputs;
+
+    /**
+     * True if Structure = SOS
+     */
+    bool secondOrderSections;
+
+    /**
+     * The coefficients of the sections. 6 coefficients {b0 b1 b2 a0 a1 a2} per section
+     */
+    float64 *sos;
+
+    /**
+     * Number of second-order sections
+     */
+    uint32 numberOfSections;
+
+    /**
+     * Gain applied to the input of the first section
+     */
+    float64 sosGain;
+
+    /**
+     * For each signal the two delays of each section
+     */
+    float64 **sosStates;
+
+    /**
+     * The configured FIR engine
+     */
+    FilterGAMFIREngine firEngine;
+
+    /**
+     * True if the overlap-save engine was selected in Setup()
+     */
+    bool overlapSave;
+
+    /**
+     * True if OverlapSaveMinimumTaps or OverlapSaveMinimumSamples were configured
+     */
+    bool overlapSaveCrossoverConfigured;
+
+    /**
+     * Minimum number of taps to select the overlap-save when FIREngine = Auto
+     */
+    uint32 overlapSaveMinimumTaps;
+
+    /**
+     * Minimum number of samples to select the overlap-save when FIREngine = Auto
+     */
+    uint32 overlapSaveMinimumSamples;
+
+    /**
+     * The FFT used by the overlap-save
+     */
+    FastFourierTransform fft;
+
+    /**
+     * Real part of the spectrum of the filter coefficients
+     */
+    float64 *filterSpectrumRe;
+
+    /**
+     * Imaginary part of the spectrum of the filter coefficients
+     */
+    float64 *filterSpectrumIm;
+
+    /**
+     * Real part of the overlap-save working buffers (one per executor)
+     */
+    float64 *overlapSaveRe;
+
+    /**
+     * Imaginary part of the overlap-save working buffers (one per executor)
+     */
+    float64 *overlapSaveIm;
+
+    /**
+     * The helper threads
+     */
+    ForkJoinPool pool;
+
+    /**
+     * First signal of each executor
+     */
+    uint32 *partitionFirst;
+
+    /**
+     * One past the last signal of each executor
+     */
+    uint32 *partitionEnd;
+
+    /**
+     * Filter to receive the RPC which stages new coefficients.
+     */
+    ReferenceT<RegisteredMethodsMessageFilter> filter;
+
+    /**
+     * Staged numerator and denominator coefficients (swapped with num and den when applied)
+     */
+    float32 *stagedNum;
+    float32 *stagedDen;
+
+    /**
+     * Staged second-order sections and gain (swapped with sos and sosGain when applied)
+     */
+    float64 *stagedSos;
+    float64 stagedSosGain;
+
+    /**
+     * Spectrum of the staged coefficients (swapped with filterSpectrumRe and filterSpectrumIm when applied)
+     */
+    float64 *stagedSpectrumRe;
+    float64 *stagedSpectrumIm;
+
+    /**
+     * Static gain of the staged coefficients and true if it is infinite
+     */
+    float64 stagedStaticGain;
+    bool stagedGainInfinite;
+
+    /**
+     * True if the last states shall be transferred when the staged coefficients are applied
+     */
+    bool stagedTransfer;
+
+    /**
+     * 1 if the staging buffers hold a new set to be applied by the real-time thread.
+     */
+    volatile int32 stagedCoefficientsReady;
+
+    /**
+     * Prevents concurrent LoadCoefficients() calls.
+     */
+    volatile int32 stagingLock;
 };
 
 }
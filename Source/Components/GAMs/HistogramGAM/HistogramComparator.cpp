@@ -47,4 +47,27 @@ HistogramComparator::HistogramComparator() {
 HistogramComparator::~HistogramComparator() {
 }
 
+uint32 HistogramComparator::LogLinearSubBucketBits(const uint32 significantDigits) {
+    uint64 resolution = 1u;
+    for (uint32 i = 0u; i < significantDigits; i++) {
+        resolution *= 10u;
+    }
+    uint32 bits = 0u;
+    while ((1ull << bits) < resolution) {
+        bits++;
+    }
+    return (bits + 1u);
+}
+
+uint64 HistogramComparator::LogLinearLowerOffset(const uint32 bin,
+                                                 const uint32 subBucketBits) {
+    uint32 halfCount = (1u << (subBucketBits - 1u));
+    uint64 offset = bin;
+    if (bin >= (halfCount * 2u)) {
+        uint32 shift = (bin / halfCount) - 1u;
+        offset = static_cast<uint64>(bin - (shift * halfCount)) << shift;
+    }
+    return offset;
+}
+
 }
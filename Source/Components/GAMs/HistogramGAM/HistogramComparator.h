@@ -37,9 +37,24 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * The maximum number of significant digits of the log-linear bins.
+ */
+static const uint32 histogramComparatorMaxSignificantDigits = 5u;
+
 /**
  * @brief An interface to be used in HistogramGAM to compute
  * to which bin of the histogram belongs a given occurrence.
+ * @details The bin 0 counts the occurrences below the lower bound, the bin GetNumberOfBins() - 1 the occurrences
+ * above or equal to the upper bound and the inner bins divide the range between the two bounds.
+ *
+ * The inner bins are either linear (all with the same size) or log-linear (as in the HDR histograms): the distance
+ * from the lower bound is converted to an integer (i.e. the values are expected to be given in the finest unit
+ * of interest, e.g. microseconds) and, for a given number of significant digits d, the first 2^s distances
+ * (with 2^(s-1) >= 10^d) have one bin each, while each following power of two is divided in 2^(s-1) bins of
+ * the same size. The relative size of the bins is thus never larger than 10^-d and the number of bins grows with
+ * the logarithm of the range. The bin of a value is computed in constant time from the position of its most
+ * significant bit.
  */
 class HistogramComparator {
 public:
@@ -72,6 +87,35 @@ public:
      */
     virtual void SetNumberOfBins(const uint32 nBinsIn)=0;
 
+    /**
+     * @brief Selects the log-linear bins.
+     * @param[in] significantDigits the number of significant digits of the bins.
+     * @return true if 0 < significantDigits <= histogramComparatorMaxSignificantDigits.
+     * @pre
+     *   SetMin() and SetMax() were called.
+     */
+    virtual bool SetLogLinear(const uint32 significantDigits)=0;
+
+    /**
+     * @brief Gets the number of significant digits of the log-linear bins.
+     * @return the number of significant digits or 0 if the bins are linear.
+     */
+    virtual uint32 GetSignificantDigits()=0;
+
+    /**
+     * @brief Gets the number of bins required to cover the range between the bounds with the log-linear bins.
+     * @return the number of bins (including the underflow and overflow bins) or 3 if the bins are linear.
+     */
+    virtual uint32 GetRequiredNumberOfBins()=0;
+
+    /**
+     * @brief Gets the lower edge of a bin.
+     * @param[in] bin the bin (1 <= bin < GetNumberOfBins()).
+     * @return the smallest value that belongs to \a bin, i.e. the lower bound for the bin 1 and the
+     * upper bound for the bin GetNumberOfBins() - 1.
+     */
+    virtual float64 GetBinLowerEdge(const uint32 bin)=0;
+
     /**
      * @brief Gets the number of bins in the histogram.
      * @return the number of bins.
@@ -84,6 +128,45 @@ public:
      */
     virtual uint32 InRange(const void * const mem)=0;
 
+    /**
+     * @brief Increments the bins of the histogram at which belong the values hold in \a mem.
+     * @param[in] mem holds the occurrence values.
+     * @param[in] numberOfValues the number of values hold in \a mem.
+     * @param[in,out] histogram the bins of the histogram (GetNumberOfBins() elements).
+     */
+    virtual void Accumulate(const void * const mem,
+                            const uint32 numberOfValues,
+                            uint32 * const histogram)=0;
+
+protected:
+
+    /**
+     * @brief Computes the number of bits of the log-linear sub-buckets for a number of significant digits.
+     * @param[in] significantDigits the number of significant digits.
+     * @return the smallest s such that 2^(s-1) >= 10^significantDigits.
+     */
+    static uint32 LogLinearSubBucketBits(const uint32 significantDigits);
+
+    /**
+     * @brief Computes the log-linear inner bin (starting from 0) of a distance from the lower bound.
+     * @details Constant time and branch-free: the number of bits to discard is derived from the position of the
+     * most significant bit of \a offset.
+     * @param[in] offset the distance from the lower bound.
+     * @param[in] subBucketBits the number of bits of the sub-buckets (see LogLinearSubBucketBits()).
+     * @return the inner bin.
+     */
+    static inline uint32 LogLinearBin(const uint64 offset,
+                                      const uint32 subBucketBits);
+
+    /**
+     * @brief Computes the smallest distance from the lower bound that belongs to a log-linear inner bin.
+     * @param[in] bin the inner bin (starting from 0).
+     * @param[in] subBucketBits the number of bits of the sub-buckets (see LogLinearSubBucketBits()).
+     * @return the smallest distance such that LogLinearBin(distance, subBucketBits) == bin.
+     */
+    static uint64 LogLinearLowerOffset(const uint32 bin,
+                                       const uint32 subBucketBits);
+
 };
 
 }
@@ -92,5 +175,37 @@ public:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+uint32 HistogramComparator::LogLinearBin(const uint64 offset,
+                                         const uint32 subBucketBits) {
+    /* Position of the most significant bit with a fixed number of steps */
+    uint64 x = offset;
+    uint32 msb = 0u;
+    uint32 step = (x > 0xFFFFFFFFull) ? 32u : 0u;
+    x >>= step;
+    msb += step;
+    step = (x > 0xFFFFull) ? 16u : 0u;
+    x >>= step;
+    msb += step;
+    step = (x > 0xFFull) ? 8u : 0u;
+    x >>= step;
+    msb += step;
+    step = (x > 0xFull) ? 4u : 0u;
+    x >>= step;
+    msb += step;
+    step = (x > 0x3ull) ? 2u : 0u;
+    x >>= step;
+    msb += step;
+    step = (x > 0x1ull) ? 1u : 0u;
+    msb += step;
+    /* The first 2^s offsets have one bin each, then 2^(s-1) bins for each power of two */
+    uint32 shift = (msb >= subBucketBits) ? ((msb - subBucketBits) + 1u) : 0u;
+    uint32 halfCount = (1u << (subBucketBits - 1u));
+    return static_cast<uint32>(offset >> shift) + (shift * halfCount);
+}
+
+}
+
 #endif /* HISTOGRAM_COMPARATOR_H_ */
 
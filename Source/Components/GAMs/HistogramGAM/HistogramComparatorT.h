@@ -38,8 +38,19 @@
 namespace MARTe {
 /*lint -esym(9107, MARTe::HistogramComparator*) the definition must be in the header because it is a template*/
 
+/**
+ * The number of values whose bins are computed before incrementing the histogram in HistogramComparatorT::Accumulate.
+ */
+static const uint32 histogramComparatorBlockSize = 64u;
+
 /**
  * @brief Template version of Comparator
+ * @details The bin of a value is computed arithmetically, i.e. (value - minLim) / delta for integer types
+ * and (value - minLim) * (1 / delta) for floating point types, clamped to the inner bins, with no comparison
+ * against the bin ranges. The bins of a block of values are computed in two branch-free passes (inner bins,
+ * then selection of the underflow and overflow bins) so that the compiler can vectorise them (see Accumulate()).
+ * With the log-linear bins the inner bin is HistogramComparator::LogLinearBin() of the distance from minLim
+ * (truncated to an integer).
  */
 template<typename T>
 class HistogramComparatorT: public HistogramComparator {
@@ -75,13 +86,68 @@ public:
      */
     virtual uint32 GetNumberOfBins();
 
+    /**
+     * @see HistogramComparator::SetLogLinear()
+     */
+    virtual bool SetLogLinear(const uint32 significantDigitsIn);
+
+    /**
+     * @see HistogramComparator::GetSignificantDigits()
+     */
+    virtual uint32 GetSignificantDigits();
+
+    /**
+     * @see HistogramComparator::GetRequiredNumberOfBins()
+     */
+    virtual uint32 GetRequiredNumberOfBins();
+
+    /**
+     * @see HistogramComparator::GetBinLowerEdge()
+     */
+    virtual float64 GetBinLowerEdge(const uint32 bin);
+
     /**
      * @see HistogramComparator::InRange()
      */
     virtual uint32 InRange(const void * const mem);
 
+    /**
+     * @see HistogramComparator::Accumulate()
+     * @details The bins of blocks of histogramComparatorBlockSize values are first computed (without branches)
+     * and then the histogram is incremented.
+     */
+    virtual void Accumulate(const void * const mem,
+                            const uint32 numberOfValues,
+                            uint32 * const histogram);
+
 private:
 
+    /**
+     * @brief Computes the bins at which belong \a values.
+     * @details The inner bins are computed first for all the values (out of range values are replaced by minLim)
+     * and the underflow/overflow bins are selected in a second pass, so that each pass is branch-free.
+     * @param[in] values the occurrence values.
+     * @param[in] numberOfValues the number of values.
+     * @param[out] bins the bins, i.e. 0 if value < minLim (or not a number), nBins - 1 if value >= maxLim.
+     */
+    inline void ComputeBins(const T * const values,
+                            const uint32 numberOfValues,
+                            uint32 * const bins) const;
+
+    /**
+     * @brief Computes the inner bin (starting from 0) of an offset from minLim.
+     * @param[in] offset the distance of the occurrence value from minLim, i.e. 0 <= offset < (maxLim - minLim).
+     * @return the inner bin (not clamped).
+     */
+    inline uint32 InnerBin(const T offset) const;
+
+    /**
+     * @brief Computes the distance of a value from minLim as an integer.
+     * @param[in] value the occurrence value (value >= minLim).
+     * @return the distance (truncated for floating point types).
+     */
+    inline uint64 LogLinearOffset(const T value) const;
+
     /**
      * The upper bound
      */
@@ -97,10 +163,25 @@ private:
      */
     T delta;
 
+    /**
+     * 1 / delta (only used by the floating point types)
+     */
+    T invDelta;
+
     /**
      * The number of bins
      */
     uint32 nBins;
+
+    /**
+     * The number of significant digits of the log-linear bins (0 for the linear bins)
+     */
+    uint32 significantDigits;
+
+    /**
+     * The number of bits of the log-linear sub-buckets
+     */
+    uint32 subBucketBits;
 };
 }
 
@@ -117,6 +198,9 @@ HistogramComparatorT<T>::HistogramComparatorT() :
     minLim = static_cast<T>(0);
     nBins = 3u;
     delta = static_cast<T>(0);
+    invDelta = static_cast<T>(0);
+    significantDigits = 0u;
+    subBucketBits = 0u;
 
 }
 
@@ -143,6 +227,11 @@ void HistogramComparatorT<T>::SetNumberOfBins(const uint32 nBinsIn) {
         uint32 nBinsTemp = (nBins - 2u);
         /*lint -e{737} -e{9117} -e{9125} -e{573} -e{9115} Loss of precision is responsibility of the conversion requested by the user.*/
         delta = static_cast<T>(range / nBinsTemp);
+        if (delta <= static_cast<T>(0)) {
+            /* Integer range smaller than the number of inner bins (or empty range): one value per bin */
+            delta = static_cast<T>(1);
+        }
+        invDelta = static_cast<T>(static_cast<T>(1) / delta);
     }
 }
 
@@ -151,37 +240,157 @@ uint32 HistogramComparatorT<T>::GetNumberOfBins() {
     return nBins;
 }
 
+template<typename T>
+bool HistogramComparatorT<T>::SetLogLinear(const uint32 significantDigitsIn) {
+    bool ret = (significantDigitsIn > 0u) && (significantDigitsIn <= histogramComparatorMaxSignificantDigits);
+    if (ret) {
+        significantDigits = significantDigitsIn;
+        subBucketBits = LogLinearSubBucketBits(significantDigits);
+    }
+    return ret;
+}
 
 template<typename T>
-uint32 HistogramComparatorT<T>::InRange(const void* const mem) {
+uint32 HistogramComparatorT<T>::GetSignificantDigits() {
+    return significantDigits;
+}
 
-    const T* toCompare = reinterpret_cast<T*>(const_cast<void *>(mem));
+template<typename T>
+uint32 HistogramComparatorT<T>::GetRequiredNumberOfBins() {
+    uint32 ret = 3u;
+    if (significantDigits > 0u) {
+        uint64 range = 0u;
+        if (maxLim > minLim) {
+            range = LogLinearOffset(maxLim);
+        }
+        ret = LogLinearBin(range, subBucketBits) + 3u;
+    }
+    return ret;
+}
 
-    uint32 ret = 0u;
-    if (*toCompare < minLim) {
-        ret = 0u;
+template<typename T>
+float64 HistogramComparatorT<T>::GetBinLowerEdge(const uint32 bin) {
+    /*lint -e{9117} -e{9125} -e{737} -e{747} Loss of precision is responsibility of the conversion requested by the user.*/
+    float64 ret = static_cast<float64>(maxLim);
+    if ((bin > 0u) && (bin < (nBins - 1u))) {
+        uint32 innerBin = (bin - 1u);
+        if (significantDigits > 0u) {
+            ret = static_cast<float64>(minLim) + static_cast<float64>(LogLinearLowerOffset(innerBin, subBucketBits));
+        }
+        else {
+            ret = static_cast<float64>(minLim) + (static_cast<float64>(innerBin) * static_cast<float64>(delta));
+        }
     }
-    else if (*toCompare >= maxLim) {
-        ret = (nBins - 1u);
+    return ret;
+}
+
+
+template<typename T>
+uint32 HistogramComparatorT<T>::InnerBin(const T offset) const {
+    /*lint -e{9117} -e{9125} -e{737} Loss of precision is responsibility of the conversion requested by the user.*/
+    return static_cast<uint32>(offset / delta);
+}
+
+/**
+ * @brief float32 implementation of HistogramComparatorT<>::InnerBin()
+ */
+template<>
+inline uint32 HistogramComparatorT<float32>::InnerBin(const float32 offset) const {
+    return static_cast<uint32>(offset * invDelta);
+}
+
+/**
+ * @brief float64 implementation of HistogramComparatorT<>::InnerBin()
+ */
+template<>
+inline uint32 HistogramComparatorT<float64>::InnerBin(const float64 offset) const {
+    return static_cast<uint32>(offset * invDelta);
+}
+
+template<typename T>
+uint64 HistogramComparatorT<T>::LogLinearOffset(const T value) const {
+    /* Modular arithmetic gives the exact distance also for the signed types */
+    /*lint -e{9117} -e{9125} -e{737} -e{571} the conversion to the unsigned type is wanted.*/
+    return static_cast<uint64>(value) - static_cast<uint64>(minLim);
+}
+
+/**
+ * @brief float32 implementation of HistogramComparatorT<>::LogLinearOffset()
+ */
+template<>
+inline uint64 HistogramComparatorT<float32>::LogLinearOffset(const float32 value) const {
+    return static_cast<uint64>(value - minLim);
+}
+
+/**
+ * @brief float64 implementation of HistogramComparatorT<>::LogLinearOffset()
+ */
+template<>
+inline uint64 HistogramComparatorT<float64>::LogLinearOffset(const float64 value) const {
+    return static_cast<uint64>(value - minLim);
+}
+
+template<typename T>
+void HistogramComparatorT<T>::ComputeBins(const T * const values,
+                                          const uint32 numberOfValues,
+                                          uint32 * const bins) const {
+    const uint32 lastInnerBin = (nBins - 2u);
+    if (significantDigits == 0u) {
+        for (uint32 i = 0u; i < numberOfValues; i++) {
+            /* Values out of range are replaced by minLim so that the offset never over/underflows */
+            T clamped = (values[i] < maxLim) ? values[i] : minLim;
+            clamped = (clamped >= minLim) ? clamped : minLim;
+            uint32 bin = InnerBin(static_cast<T>(clamped - minLim)) + 1u;
+            bins[i] = (bin > lastInnerBin) ? lastInnerBin : bin;
+        }
     }
     else {
-        //do the division with a
-        for (uint32 i = 0u; (i < (nBins - 2u)); i++) {
-            /*lint -e{737} -e{9117} -e{9125} -e{9119} -e{9114} -e{9115} -e{776} Loss of precision is responsibility of the conversion requested by the user.*/
-            T minRange = (minLim + static_cast<T>(i * delta));
-            /*lint -e{737} -e{9117} -e{9125} -e{9119} -e{9114} -e{9115} -e{776} Loss of precision is responsibility of the conversion requested by the user.*/
-            T maxRange = (minLim + static_cast<T>((i + 1u) * delta));
-            /*lint -e{737} -e{9117} -e{9125} Loss of precision is responsibility of the conversion requested by the user.*/
-            if (((*toCompare) >= (minRange)) && ((*toCompare) < maxRange)) {
-                ret = (i + 1u);
-                break;
-            }
+        for (uint32 i = 0u; i < numberOfValues; i++) {
+            T clamped = (values[i] < maxLim) ? values[i] : minLim;
+            clamped = (clamped >= minLim) ? clamped : minLim;
+            uint32 bin = LogLinearBin(LogLinearOffset(clamped), subBucketBits) + 1u;
+            bins[i] = (bin > lastInnerBin) ? lastInnerBin : bin;
         }
     }
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        uint32 bin = (values[i] >= maxLim) ? (nBins - 1u) : bins[i];
+        bins[i] = (values[i] >= minLim) ? bin : 0u;
+    }
+}
+
+template<typename T>
+uint32 HistogramComparatorT<T>::InRange(const void* const mem) {
+
+    const T* toCompare = reinterpret_cast<T*>(const_cast<void *>(mem));
+
+    uint32 ret = 0u;
+    ComputeBins(toCompare, 1u, &ret);
 
     return ret;
 }
 
+template<typename T>
+void HistogramComparatorT<T>::Accumulate(const void * const mem,
+                                         const uint32 numberOfValues,
+                                         uint32 * const histogram) {
+
+    const T* values = reinterpret_cast<T*>(const_cast<void *>(mem));
+    uint32 bins[histogramComparatorBlockSize];
+    uint32 first = 0u;
+
+    while (first < numberOfValues) {
+        uint32 blockSize = (numberOfValues - first);
+        if (blockSize > histogramComparatorBlockSize) {
+            blockSize = histogramComparatorBlockSize;
+        }
+        ComputeBins(&values[first], blockSize, &bins[0]);
+        for (uint32 i = 0u; i < blockSize; i++) {
+            histogram[bins[i]]++;
+        }
+        first += blockSize;
+    }
+}
+
 }
 #endif /* COMPARATORT_H_ */
 
@@ -31,7 +31,10 @@
 
 #include "AdvancedErrorManagement.h"
 #include "AnyType.h"
+#include "Atomic.h"
 #include "HistogramGAM.h"
+#include "ObjectRegistryDatabase.h"
+#include "Vector.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -186,13 +189,19 @@ namespace MARTe {
 HistogramGAM::HistogramGAM() :
         GAM() {
     comps = NULL_PTR(HistogramComparator **);
+    numberOfInputElements = NULL_PTR(uint32 *);
 
     beginCycle = 0u;
     cycleCounter = 0u;
+    resetGeneration = 0;
 }
 
 /*lint -e{1551} destructor does not throw any exception */
 HistogramGAM::~HistogramGAM() {
+    //The output signals (i.e. the shards) are freed by the GAM destructor
+    if (registry.IsValid()) {
+        registry->Unregister(this);
+    }
     if (comps != NULL_PTR(HistogramComparator **)) {
         for (uint32 i = 0u; i < numberOfInputSignals; i++) {
             if (comps[i] != NULL_PTR(HistogramComparator *)) {
@@ -203,6 +212,10 @@ HistogramGAM::~HistogramGAM() {
         delete[] comps;
         comps = NULL_PTR(HistogramComparator **);
     }
+    if (numberOfInputElements != NULL_PTR(uint32 *)) {
+        delete[] numberOfInputElements;
+        numberOfInputElements = NULL_PTR(uint32 *);
+    }
 }
 
 bool HistogramGAM::Initialise(StructuredDataI &data) {
@@ -219,6 +232,16 @@ bool HistogramGAM::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::Information, "Going to reset when the next state name is: %s", stateChangeResetName.Buffer());
         }
     }
+    if (ret) {
+        StreamString registryPath;
+        if (data.Read("Registry", registryPath)) {
+            registry = ObjectRegistryDatabase::Instance()->Find(registryPath.Buffer());
+            ret = registry.IsValid();
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The Registry %s is not a valid HistogramRegistry", registryPath.Buffer());
+            }
+        }
+    }
     return ret;
 }
 
@@ -228,20 +251,25 @@ bool HistogramGAM::Setup() {
 
     if (ret) {
         comps = new HistogramComparator *[numberOfInputSignals];
+        numberOfInputElements = new uint32[numberOfInputSignals];
 
         for (uint32 i = 0u; (i < numberOfInputSignals); i++) {
             /*lint -e{613} the NULL pointer is checked before*/
             comps[i] = NULL_PTR(HistogramComparator *);
+            numberOfInputElements[i] = 0u;
         }
-        //check that the number of dimensions of the input signals is one
+        //all the elements of the input signals are counted
         /*lint -e{850} the variable i does not change in the loop */
         for (uint32 i = 0u; (i < numberOfInputSignals) && (ret); i++) {
             uint32 numberOfElements;
             ret = GetSignalNumberOfElements(InputSignals, i, numberOfElements);
             if (ret) {
-                ret = (numberOfElements == 1u);
+                ret = (numberOfElements > 0u);
                 if (!ret) {
-                    REPORT_ERROR(ErrorManagement::FatalError, "The input signal %d must have NumberOfElements=1", i);
+                    REPORT_ERROR(ErrorManagement::FatalError, "The input signal %d must have NumberOfElements>0", i);
+                }
+                else {
+                    numberOfInputElements[i] = numberOfElements;
                 }
             }
             if (ret) {
@@ -295,6 +323,28 @@ bool HistogramGAM::Setup() {
                         }
                         delete[] ptr;
                     }
+                    if (ret) {
+                        StreamString binMode = "Linear";
+                        (void) signalsDatabase.Read("BinMode", binMode);
+                        if (binMode == "LogLinear") {
+                            uint32 significantDigits = 2u;
+                            (void) signalsDatabase.Read("SignificantDigits", significantDigits);
+                            /*lint -e{613} the NULL pointer is checked before*/
+                            ret = comps[i]->SetLogLinear(significantDigits);
+                            if (!ret) {
+                                REPORT_ERROR(ErrorManagement::InitialisationError, "The SignificantDigits of the input signal %d must be between 1 and %d", i,
+                                             histogramComparatorMaxSignificantDigits);
+                            }
+                        }
+                        else if (binMode != "Linear") {
+                            ret = false;
+                            REPORT_ERROR(ErrorManagement::InitialisationError, "Invalid BinMode %s in input signal %d. Possible values: Linear, LogLinear",
+                                         binMode.Buffer(), i);
+                        }
+                        else {
+                            //Linear bins
+                        }
+                    }
 
                 }
             }
@@ -306,6 +356,16 @@ bool HistogramGAM::Setup() {
         for (uint32 i = 0u; (i < numberOfOutputSignals) && (ret); i++) {
             uint32 numberOfElements;
             ret = GetSignalNumberOfElements(OutputSignals, i, numberOfElements);
+            /*lint -e{613} the NULL pointer is checked before*/
+            if ((ret) && (comps[i]->GetSignificantDigits() > 0u)) {
+                /*lint -e{613} the NULL pointer is checked before*/
+                uint32 requiredNumberOfElements = comps[i]->GetRequiredNumberOfBins();
+                ret = (numberOfElements == requiredNumberOfElements);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "The output signal %d must have NumberOfElements=%d to cover the range with log-linear bins", i,
+                                 requiredNumberOfElements);
+                }
+            }
             if (ret) {
                 ret = (numberOfElements >= 3u);
                 if (!ret) {
@@ -324,6 +384,9 @@ bool HistogramGAM::Setup() {
                 }
             }
         }
+        if ((ret) && (registry.IsValid())) {
+            ret = RegisterHistograms();
+        }
 
     }
     else {
@@ -350,17 +413,154 @@ bool HistogramGAM::PrepareNextState(const char8 * const currentStateName, const
                 outputSignal[j] = 0u;
             }
         }
+        //Full memory barrier: the HistogramRegistry sees the new generation after the cleared counters
+        Atomic::Increment(&resetGeneration);
     }
     return true;
 }
 
+bool HistogramGAM::RegisterHistograms() {
+    bool ret = true;
+    /*lint -e{850} the variable i does not change in the loop */
+    for (uint32 i = 0u; (i < numberOfInputSignals) && (ret); i++) {
+        StreamString registryName;
+        ret = signalsDatabase.MoveAbsolute("InputSignals");
+        if (ret) {
+            ret = signalsDatabase.MoveToChild(i);
+        }
+        if (ret) {
+            if (!signalsDatabase.Read("RegistryName", registryName)) {
+                ret = GetSignalName(InputSignals, i, registryName);
+            }
+        }
+        if (ret) {
+            /*lint -e{613} the NULL pointer is checked before*/
+            HistogramComparator *comp = comps[i];
+            uint32 nBins = comp->GetNumberOfBins();
+            float64 *edges = new float64[nBins - 1u];
+            for (uint32 j = 1u; j < nBins; j++) {
+                edges[j - 1u] = comp->GetBinLowerEdge(j);
+            }
+            const uint32 *outputSignal = reinterpret_cast<const uint32 *>(GetOutputSignalMemory(i));
+            ret = registry->Register(registryName.Buffer(), comp->GetSignificantDigits(), edges, nBins, outputSignal, &resetGeneration, this);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Could not register the histogram of the input signal %d as %s", i, registryName.Buffer());
+            }
+            delete[] edges;
+        }
+    }
+    (void) signalsDatabase.MoveToRoot();
+    return ret;
+}
+
+bool HistogramGAM::ExportHistogram(const uint32 signalIdx,
+                                   StructuredDataI &data) {
+    bool ret = (comps != NULL_PTR(HistogramComparator **));
+    if (ret) {
+        ret = (signalIdx < numberOfInputSignals);
+    }
+    if (ret) {
+        HistogramComparator *comp = comps[signalIdx];
+        uint32 nBins = comp->GetNumberOfBins();
+        uint32 significantDigits = comp->GetSignificantDigits();
+        if (significantDigits > 0u) {
+            ret = data.Write("BinMode", "LogLinear");
+            if (ret) {
+                ret = data.Write("SignificantDigits", significantDigits);
+            }
+        }
+        else {
+            ret = data.Write("BinMode", "Linear");
+        }
+        const uint32 *outputSignal = reinterpret_cast<const uint32 *>(GetOutputSignalMemory(signalIdx));
+        float64 *edges = new float64[nBins - 1u];
+        uint64 *counts = new uint64[nBins];
+        for (uint32 j = 0u; j < nBins; j++) {
+            if (j > 0u) {
+                edges[j - 1u] = comp->GetBinLowerEdge(j);
+            }
+            counts[j] = outputSignal[j];
+        }
+        if (ret) {
+            Vector<float64> edgesVector(edges, nBins - 1u);
+            ret = data.Write("Edges", edgesVector);
+        }
+        if (ret) {
+            Vector<uint64> countsVector(counts, nBins);
+            ret = data.Write("Counts", countsVector);
+        }
+        delete[] edges;
+        delete[] counts;
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Invalid signal index %d", signalIdx);
+    }
+    return ret;
+}
+
+bool HistogramGAM::MergeHistograms(StructuredDataI &merged,
+                                   StructuredDataI &histogram) {
+    AnyType mergedEdgesType = merged.GetType("Edges");
+    AnyType edgesType = histogram.GetType("Edges");
+    AnyType mergedCountsType = merged.GetType("Counts");
+    AnyType countsType = histogram.GetType("Counts");
+    bool ret = (!mergedEdgesType.IsVoid()) && (!edgesType.IsVoid());
+    ret = (ret) && (!mergedCountsType.IsVoid()) && (!countsType.IsVoid());
+    uint32 nEdges = 0u;
+    uint32 nBins = 0u;
+    if (ret) {
+        nEdges = mergedEdgesType.GetNumberOfElements(0u);
+        nBins = mergedCountsType.GetNumberOfElements(0u);
+        ret = (edgesType.GetNumberOfElements(0u) == nEdges) && (countsType.GetNumberOfElements(0u) == nBins) && ((nEdges + 1u) == nBins);
+    }
+    if (ret) {
+        float64 *mergedEdges = new float64[nEdges];
+        float64 *edges = new float64[nEdges];
+        uint64 *mergedCounts = new uint64[nBins];
+        uint64 *counts = new uint64[nBins];
+        Vector<float64> mergedEdgesVector(mergedEdges, nEdges);
+        Vector<float64> edgesVector(edges, nEdges);
+        Vector<uint64> mergedCountsVector(mergedCounts, nBins);
+        Vector<uint64> countsVector(counts, nBins);
+        ret = merged.Read("Edges", mergedEdgesVector);
+        if (ret) {
+            ret = histogram.Read("Edges", edgesVector);
+        }
+        if (ret) {
+            ret = merged.Read("Counts", mergedCountsVector);
+        }
+        if (ret) {
+            ret = histogram.Read("Counts", countsVector);
+        }
+        for (uint32 j = 0u; (j < nEdges) && (ret); j++) {
+            ret = (mergedEdges[j] == edges[j]);
+        }
+        if (ret) {
+            for (uint32 j = 0u; j < nBins; j++) {
+                mergedCounts[j] += counts[j];
+            }
+            ret = merged.Delete("Counts");
+            if (ret) {
+                ret = merged.Write("Counts", mergedCountsVector);
+            }
+        }
+        delete[] mergedEdges;
+        delete[] edges;
+        delete[] mergedCounts;
+        delete[] counts;
+    }
+    if (!ret) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "The histograms cannot be merged (different bins)");
+    }
+    return ret;
+}
+
 bool HistogramGAM::Execute() {
     if (cycleCounter >= beginCycle) {
         for (uint32 i = 0u; i < numberOfInputSignals; i++) {
             uint32 *outputSignal = reinterpret_cast<uint32 *>(GetOutputSignalMemory(i));
             /*lint -e{613} the NULL pointer is checked before*/
-            uint32 index = comps[i]->InRange(GetInputSignalMemory(i));
-            outputSignal[index]++;
+            comps[i]->Accumulate(GetInputSignalMemory(i), numberOfInputElements[i], outputSignal);
         }
     }
     else {
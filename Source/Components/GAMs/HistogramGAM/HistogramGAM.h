@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 #include "GAM.h"
 #include "HistogramComparatorT.h"
+#include "HistogramRegistry.h"
 #include "TypeDescriptor.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -46,7 +47,8 @@ namespace MARTe {
  * @details For each input signal the following parameters can be defined:\n
  *   MinLim = [the minimum value of the signal]\n
  *   MaxLim = [the maximum value of the signal]\n
- * All the signals in input must be scalar and the number of samples per cycle must be one.\n
+ * The input signals can be scalars or arrays (e.g. a block of ADC samples) and the number of samples per cycle must be one.
+ * All the elements of an array input signal are counted in the same histogram in each cycle.\n
  * Each output signal represents the histogram of the relative input signal, so the number of input and output
  * signals must coincide. The output signal must be an array of at least three elements and the number of elements
  * is the desired number of bins of the histogram. The algorithm divides the signal range (maxLim - minLim)
@@ -77,6 +79,28 @@ namespace MARTe {
  *   bin 9: (90 <= x < 100)\n
  *   bin 10: (x >= 100)\n
  *
+ * The inner bins can be log-linear (HDR histogram style) instead, which is better suited for long-tailed
+ * distributions such as the cycle times: setting in the input signal\n
+ * <pre>
+ *   BinMode = LogLinear
+ *   SignificantDigits = 2
+ * </pre>
+ * the distance of each occurrence from \a minLim (truncated to an integer, so that the signal should be given
+ * in the finest unit of interest, e.g. microseconds) is counted with a relative resolution of 10^-SignificantDigits:
+ * the first 2^s distances (with 2^(s-1) >= 10^SignificantDigits) have one bin each and every following power of two
+ * is divided in 2^(s-1) bins. The bin is computed in constant time (see HistogramComparator). SignificantDigits
+ * (default 2) must be between 1 and 5 and the number of elements of the output signal must be equal to the number of bins
+ * required to cover the range (the error reported by Setup() specifies it), e.g. 1783 bins for MinLim = 0,
+ * MaxLim = 1000000 and two significant digits. The default BinMode is Linear.
+ *
+ * ExportHistogram() writes a histogram together with the lower edges of its bins, so that the histograms of the
+ * same signal computed in several real-time threads (or applications) can be merged off-line with MergeHistograms().
+ *
+ * The histograms of the same quantity computed in several real-time threads can also be merged on-line by a HistogramRegistry:
+ * if Registry is set, the output signal of each input signal is registered, in Setup(), as a shard of the histogram with the
+ * name RegistryName (by default the name of the input signal). The real-time thread keeps only incrementing its own counters
+ * (no lock, no copy) and the HistogramRegistry periodically merges the increments of all the shards (see HistogramRegistry).
+ *
  * The output signals type must be uint32.\n
  * The user can also define the GAM parameter \a BeginCycleNumber that enables the histogram
  * to start counting only after the specified number of MARTe cycles has passed. Default for this parameter is zero.
@@ -88,6 +112,7 @@ namespace MARTe {
  *     Class = HistogramGAM
  *     BeginCycleNumber = 0 //Optional. Start to compute histogram only after BeginCycleNumber cycles
  *     StateChangeResetName = All //Optional. If set it will reset when the PrepareNextState, nextStaName == StateChangeResetName. If the StateChangeResetName is set to "All", it will always reset.
+ *     Registry = "Histograms" //Optional. The path of a HistogramRegistry where the histograms are merged.
  *     InputSignals = {
  *         BeginCycleNumber = 10
  *         Signal1 = {
@@ -104,6 +129,23 @@ namespace MARTe {
  *             MinLim = 10.5
  *             MaxLim = 20.5
  *         }
+ *         ADCBlock = {
+ *             DataSource = "Drv1"
+ *             Type = int16
+ *             NumberOfDimensions = 1
+ *             NumberOfElements = 2000
+ *             MinLim = -32768
+ *             MaxLim = 32767
+ *         }
+ *         CycleTime = {
+ *             DataSource = "Timings"
+ *             Type = uint32
+ *             MinLim = 0
+ *             MaxLim = 1000000
+ *             BinMode = LogLinear //Optional. Linear (default) or LogLinear
+ *             SignificantDigits = 2 //Optional. Only for the LogLinear bins (default 2)
+ *             RegistryName = CycleTime //Optional. Only with Registry. The name of the merged histogram (default the name of the signal)
+ *         }
  *     }
  *     OutputSignals = {
  *         Histogram1 = {
@@ -116,6 +158,16 @@ namespace MARTe {
  *             Type = uint32
  *             NumberOfElements = 120
  *         }
+ *         ADCHistogram = {
+ *             DataSource = "DDB"
+ *             Type = uint32
+ *             NumberOfElements = 66
+ *         }
+ *         CycleTimeHistogram = {
+ *             DataSource = "DDB"
+ *             Type = uint32
+ *             NumberOfElements = 1783
+ *         }
  *     }
  * }
  * </pre>
@@ -137,7 +189,9 @@ public:
     /**
      * @see GAM::Initialise()
      * @details The following parameter can be defined in the configuration:\n
-     *   BeginCycleNumber: how many cycles to wait before starting to compute the histogram.
+     *   BeginCycleNumber: how many cycles to wait before starting to compute the histogram.\n
+     *   Registry: the path of a HistogramRegistry.
+     * @return true if the Registry (if set) is a valid HistogramRegistry.
      */
     virtual bool Initialise(StructuredDataI &data);
 
@@ -145,18 +199,21 @@ public:
      * @see GAM::Setup()
      * @details Checks that:\n
      *   (NumberOfInputSignals==NumberOfOutputSignals)\n
-     *   (NumberOfElements == 1) for each input signal\n
+     *   (NumberOfElements >= 1) for each input signal\n
      *   (NumberOfSamples == 1) for each input signal\n
-     *   (NumberOfElements >= 3) for each output signal\n
+     *   (BinMode == Linear || BinMode == LogLinear) and (0 < SignificantDigits <= 5) for each input signal\n
+     *   (NumberOfElements >= 3) for each output signal with linear bins\n
+     *   (NumberOfElements == the number of required bins) for each output signal with log-linear bins\n
      *   (Type == uint32) for each output signal\n
-     *  @return true if the conditions above are met.
+     * and registers the histograms in the Registry (if set).
+     *  @return true if the conditions above are met and if the histograms could be registered.
      */
     virtual bool Setup();
 
     /**
      * @see GAM::Excute()
      * @details Executes the histogram algorithm counting and dividing the occurrences of the signals
-     * among the defined number of bins.
+     * (all the elements of each input signal) among the defined number of bins.
      * @return true
      */
     virtual bool Execute();
@@ -168,8 +225,39 @@ public:
     virtual bool PrepareNextState(const char8 * const currentStateName,
                                   const char8 * const nextStateName);
 
+    /**
+     * @brief Exports the histogram of an input signal in a mergeable format.
+     * @details Writes in \a data:\n
+     *   BinMode = Linear or LogLinear\n
+     *   SignificantDigits = the number of significant digits (only for the LogLinear bins)\n
+     *   Edges = the lower edges of the bins 1 to N-1 (float64, N-1 elements), i.e. Edges[0] = MinLim and Edges[N-2] = MaxLim\n
+     *   Counts = the occurrences counted in each bin (uint64, N elements)\n
+     * @param[in] signalIdx the index of the input signal.
+     * @param[out] data where to write the histogram.
+     * @return true if the signalIdx is valid and the histogram is written.
+     * @pre
+     *   Setup()
+     */
+    bool ExportHistogram(const uint32 signalIdx,
+                         StructuredDataI &data);
+
+    /**
+     * @brief Merges a histogram exported with ExportHistogram() in another one.
+     * @param[in,out] merged a histogram exported with ExportHistogram(), whose Counts are incremented by the Counts of \a histogram.
+     * @param[in] histogram a histogram exported with ExportHistogram().
+     * @return true if the two histograms have the same bins (Edges).
+     */
+    static bool MergeHistograms(StructuredDataI &merged,
+                                StructuredDataI &histogram);
+
 protected:
 
+    /**
+     * @brief Registers the output signals as shards of the Registry.
+     * @return true if all the histograms could be registered.
+     */
+    bool RegisterHistograms();
+
     /**
      * A list of Comparator objects
      * (one for each signal) to
@@ -177,6 +265,11 @@ protected:
      */
     HistogramComparator **comps;
 
+    /**
+     * The number of elements of each input signal.
+     */
+    uint32 *numberOfInputElements;
+
     /**
      * Holds how many cycles to skip before starting
      * the histogram algorithm
@@ -192,6 +285,16 @@ protected:
      * The name of the state to reset the histogram counters.
      */
     StreamString stateChangeResetName;
+
+    /**
+     * The HistogramRegistry where the histograms are merged (invalid if not set).
+     */
+    ReferenceT<HistogramRegistry> registry;
+
+    /**
+     * Incremented after each reset of the histograms (read by the HistogramRegistry).
+     */
+    volatile int32 resetGeneration;
 };
 
 }
@@ -0,0 +1,435 @@
+/**
+ * @file HistogramRegistry.cpp
+ * @brief Source file for class HistogramRegistry
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HistogramRegistry (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BasicFile.h"
+#include "CLASSMETHODREGISTER.h"
+#include "ConfigurationDatabase.h"
+#include "HighResolutionTimer.h"
+#include "HistogramRegistry.h"
+#include "Sleep.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * The maximum sleep (in milliseconds) of the merging thread.
+ */
+const MARTe::uint32 HISTOGRAM_REGISTRY_SLEEP_PERIOD = 10u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+HistogramRegistry::HistogramRegistry() :
+        Object(),
+        EmbeddedServiceMethodBinderI(),
+        MessageI(),
+        executor(*this) {
+    mergePeriod = 1000u;
+    cpuMask = 0u;
+    lastMergeCounter = 0u;
+    numberOfHistograms = 0u;
+    numberOfShards = 0u;
+    copyCounts = NULL_PTR(uint32 *);
+    copySize = 0u;
+    for (uint32 h = 0u; h < HISTOGRAM_REGISTRY_MAX_HISTOGRAMS; h++) {
+        histograms[h].numberOfBins = 0u;
+        histograms[h].significantDigits = 0u;
+        histograms[h].edges = NULL_PTR(float64 *);
+        histograms[h].counts = NULL_PTR(uint64 *);
+    }
+    for (uint32 s = 0u; s < HISTOGRAM_REGISTRY_MAX_SHARDS; s++) {
+        shards[s].histogram = 0u;
+        shards[s].counts = NULL_PTR(const uint32 *);
+        shards[s].generation = NULL_PTR(volatile int32 *);
+        shards[s].lastGeneration = 0;
+        shards[s].lastCounts = NULL_PTR(uint32 *);
+        shards[s].owner = NULL_PTR(const void *);
+    }
+    mutex.Create();
+    filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
+    if (!ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
+    }
+}
+
+/*lint -e{1551} the destructor must guarantee that the thread is stopped before the memory is freed.*/
+HistogramRegistry::~HistogramRegistry() {
+    if (!executor.Stop()) {
+        if (!executor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    for (uint32 s = 0u; s < numberOfShards; s++) {
+        delete[] shards[s].lastCounts;
+    }
+    for (uint32 h = 0u; h < numberOfHistograms; h++) {
+        delete[] histograms[h].edges;
+        delete[] histograms[h].counts;
+    }
+    if (copyCounts != NULL_PTR(uint32 *)) {
+        delete[] copyCounts;
+    }
+}
+
+bool HistogramRegistry::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    if (ok) {
+        if (!data.Read("MergePeriod", mergePeriod)) {
+            mergePeriod = 1000u;
+        }
+        ok = (mergePeriod > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "MergePeriod shall be > 0");
+        }
+    }
+    if (ok) {
+        if (!data.Read("Filename", filename)) {
+            filename = "";
+        }
+        if (data.Read("CPUMask", cpuMask)) {
+            executor.SetCPUMask(cpuMask);
+        }
+        executor.SetName(GetName());
+        ok = (executor.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start the merging thread");
+        }
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType HistogramRegistry::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::StartupStage) {
+        lastMergeCounter = HighResolutionTimer::Counter();
+    }
+    else if (info.GetStage() == ExecutionInfo::MainStage) {
+        //Short sleeps, so that the thread can be stopped without waiting for the MergePeriod
+        Sleep::MSec((mergePeriod < HISTOGRAM_REGISTRY_SLEEP_PERIOD) ? (mergePeriod) : (HISTOGRAM_REGISTRY_SLEEP_PERIOD));
+        uint64 now = HighResolutionTimer::Counter();
+        float64 elapsed = static_cast<float64>(now - lastMergeCounter) * HighResolutionTimer::Period();
+        if ((elapsed * 1000.) >= static_cast<float64>(mergePeriod)) {
+            lastMergeCounter = now;
+            Merge();
+            if (!WriteFile()) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not write the histograms on %s", filename.Buffer());
+            }
+        }
+    }
+    else {
+        //Nothing to do in the other stages
+    }
+    return ErrorManagement::NoError;
+}
+
+bool HistogramRegistry::Register(const char8 * const name,
+                                 const uint32 significantDigits,
+                                 const float64 * const edges,
+                                 const uint32 numberOfBins,
+                                 const uint32 * const counts,
+                                 volatile int32 * const generation,
+                                 const void * const owner) {
+    bool ok = (mutex.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        ok = (numberOfShards < HISTOGRAM_REGISTRY_MAX_SHARDS);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The maximum number of shards (%u) was exceeded", HISTOGRAM_REGISTRY_MAX_SHARDS);
+        }
+        uint32 h = 0u;
+        bool found = false;
+        while ((h < numberOfHistograms) && (!found) && (ok)) {
+            found = (histograms[h].name == name);
+            if (!found) {
+                h++;
+            }
+        }
+        if ((found) && (ok)) {
+            ok = ((histograms[h].numberOfBins == numberOfBins) && (histograms[h].significantDigits == significantDigits));
+            for (uint32 j = 0u; (j < (numberOfBins - 1u)) && (ok); j++) {
+                ok = (histograms[h].edges[j] == edges[j]);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The bins of %s differ from the ones already registered", name);
+            }
+        }
+        else if (ok) {
+            ok = (numberOfHistograms < HISTOGRAM_REGISTRY_MAX_HISTOGRAMS);
+            if (ok) {
+                histograms[h].name = name;
+                histograms[h].numberOfBins = numberOfBins;
+                histograms[h].significantDigits = significantDigits;
+                histograms[h].edges = new float64[numberOfBins - 1u];
+                histograms[h].counts = new uint64[numberOfBins];
+                for (uint32 j = 0u; j < numberOfBins; j++) {
+                    if (j > 0u) {
+                        histograms[h].edges[j - 1u] = edges[j - 1u];
+                    }
+                    histograms[h].counts[j] = 0u;
+                }
+                numberOfHistograms++;
+                if (numberOfBins > copySize) {
+                    if (copyCounts != NULL_PTR(uint32 *)) {
+                        delete[] copyCounts;
+                    }
+                    copyCounts = new uint32[numberOfBins];
+                    copySize = numberOfBins;
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The maximum number of histograms (%u) was exceeded", HISTOGRAM_REGISTRY_MAX_HISTOGRAMS);
+            }
+        }
+        else {
+            //The maximum number of shards was exceeded
+        }
+        if (ok) {
+            HistogramRegistryShard &shard = shards[numberOfShards];
+            shard.histogram = h;
+            shard.counts = counts;
+            shard.generation = generation;
+            shard.lastGeneration = *generation;
+            shard.lastCounts = new uint32[numberOfBins];
+            shard.owner = owner;
+            //The counts before the registration are also merged
+            for (uint32 j = 0u; j < numberOfBins; j++) {
+                shard.lastCounts[j] = 0u;
+            }
+            numberOfShards++;
+        }
+        mutex.FastUnLock();
+    }
+    return ok;
+}
+
+void HistogramRegistry::Unregister(const void * const owner) {
+    if (mutex.FastLock() == ErrorManagement::NoError) {
+        uint32 s = 0u;
+        while (s < numberOfShards) {
+            if (shards[s].owner == owner) {
+                MergeShard(shards[s]);
+                delete[] shards[s].lastCounts;
+                numberOfShards--;
+                //Keeps the order of the remaining shards
+                for (uint32 t = s; t < numberOfShards; t++) {
+                    shards[t] = shards[t + 1u];
+                }
+                shards[numberOfShards].lastCounts = NULL_PTR(uint32 *);
+            }
+            else {
+                s++;
+            }
+        }
+        mutex.FastUnLock();
+    }
+}
+
+void HistogramRegistry::Merge() {
+    if (mutex.FastLock() == ErrorManagement::NoError) {
+        for (uint32 s = 0u; s < numberOfShards; s++) {
+            MergeShard(shards[s]);
+        }
+        mutex.FastUnLock();
+    }
+}
+
+void HistogramRegistry::MergeShard(HistogramRegistryShard &shard) {
+    HistogramRegistryHistogram &histogram = histograms[shard.histogram];
+    uint32 nBins = histogram.numberOfBins;
+    int32 generationBefore = *shard.generation;
+    //Each counter is an aligned uint32 which is read in one access
+    for (uint32 j = 0u; j < nBins; j++) {
+        copyCounts[j] = shard.counts[j];
+    }
+    int32 generationAfter = *shard.generation;
+    //If the HistogramGAM was resetting while copying, the counters are merged in the next period
+    if (generationBefore == generationAfter) {
+        bool reset = (generationBefore != shard.lastGeneration);
+        for (uint32 j = 0u; j < nBins; j++) {
+            uint32 increment = copyCounts[j];
+            if (!reset) {
+                //A counter which is being cleared (the generation is incremented after) is only merged after the reset
+                increment = (copyCounts[j] > shard.lastCounts[j]) ? (copyCounts[j] - shard.lastCounts[j]) : (0u);
+            }
+            histogram.counts[j] += increment;
+            shard.lastCounts[j] = copyCounts[j];
+        }
+        shard.lastGeneration = generationBefore;
+    }
+}
+
+uint32 HistogramRegistry::GetNumberOfHistograms() {
+    uint32 n = 0u;
+    if (mutex.FastLock() == ErrorManagement::NoError) {
+        n = numberOfHistograms;
+        mutex.FastUnLock();
+    }
+    return n;
+}
+
+uint32 HistogramRegistry::GetNumberOfShards() {
+    uint32 n = 0u;
+    if (mutex.FastLock() == ErrorManagement::NoError) {
+        n = numberOfShards;
+        mutex.FastUnLock();
+    }
+    return n;
+}
+
+bool HistogramRegistry::ExportHistogram(const char8 * const name,
+                                        StructuredDataI &data) {
+    bool ok = (mutex.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        bool found = false;
+        for (uint32 h = 0u; (h < numberOfHistograms) && (!found); h++) {
+            found = (histograms[h].name == name);
+            if (found) {
+                ok = ExportHistogram(histograms[h], data);
+            }
+        }
+        mutex.FastUnLock();
+        if (!found) {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "The histogram %s does not exist", name);
+        }
+    }
+    return ok;
+}
+
+bool HistogramRegistry::ExportHistogram(const HistogramRegistryHistogram &histogram,
+                                        StructuredDataI &data) const {
+    bool ok = true;
+    if (histogram.significantDigits > 0u) {
+        ok = data.Write("BinMode", "LogLinear");
+        if (ok) {
+            ok = data.Write("SignificantDigits", histogram.significantDigits);
+        }
+    }
+    else {
+        ok = data.Write("BinMode", "Linear");
+    }
+    if (ok) {
+        Vector<float64> edgesVector(histogram.edges, histogram.numberOfBins - 1u);
+        ok = data.Write("Edges", edgesVector);
+    }
+    if (ok) {
+        Vector<uint64> countsVector(histogram.counts, histogram.numberOfBins);
+        ok = data.Write("Counts", countsVector);
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType HistogramRegistry::ExportHistograms(ReferenceContainer &message) {
+    ErrorManagement::ErrorType err;
+    ReferenceT<StructuredDataI> data = message.Get(0u);
+    err.parametersError = !data.IsValid();
+    if (err.ErrorsCleared()) {
+        Merge();
+        err.fatalError = (mutex.FastLock() != ErrorManagement::NoError);
+    }
+    if (err.ErrorsCleared()) {
+        for (uint32 h = 0u; (h < numberOfHistograms) && (err.ErrorsCleared()); h++) {
+            bool ok = data->CreateRelative(histograms[h].name.Buffer());
+            if (ok) {
+                ok = ExportHistogram(histograms[h], *data.operator->());
+            }
+            if (ok) {
+                ok = data->MoveToAncestor(1u);
+            }
+            err.parametersError = !ok;
+        }
+        mutex.FastUnLock();
+    }
+    return err;
+}
+
+bool HistogramRegistry::WriteFile() {
+    bool ok = true;
+    if (filename.Size() > 0u) {
+        StreamString temporaryFilename;
+        ok = temporaryFilename.Printf("%s.tmp", filename.Buffer());
+        BasicFile file;
+        if (ok) {
+            ok = file.Open(temporaryFilename.Buffer(), (BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT | BasicFile::FLAG_TRUNC));
+        }
+        if (ok) {
+            bool locked = (mutex.FastLock() == ErrorManagement::NoError);
+            ok = locked;
+            for (uint32 h = 0u; (h < numberOfHistograms) && (ok); h++) {
+                const HistogramRegistryHistogram &histogram = histograms[h];
+                StreamString text;
+                ok = text.Printf("%s = {\n    BinMode = %s\n", histogram.name.Buffer(), (histogram.significantDigits > 0u) ? "LogLinear" : "Linear");
+                if ((ok) && (histogram.significantDigits > 0u)) {
+                    ok = text.Printf("    SignificantDigits = %u\n", histogram.significantDigits);
+                }
+                if (ok) {
+                    ok = text.Printf("%s", "    Edges = {");
+                }
+                for (uint32 j = 0u; (j < (histogram.numberOfBins - 1u)) && (ok); j++) {
+                    ok = text.Printf(" %.17g", histogram.edges[j]);
+                }
+                if (ok) {
+                    ok = text.Printf("%s", " }\n    Counts = {");
+                }
+                for (uint32 j = 0u; (j < histogram.numberOfBins) && (ok); j++) {
+                    ok = text.Printf(" %!", histogram.counts[j]);
+                }
+                if (ok) {
+                    ok = text.Printf("%s", " }\n}\n");
+                }
+                if (ok) {
+                    uint32 size = static_cast<uint32>(text.Size());
+                    ok = file.Write(text.Buffer(), size);
+                }
+            }
+            if (locked) {
+                mutex.FastUnLock();
+            }
+            ok = (file.Close()) && (ok);
+        }
+        if (ok) {
+            //The readers of the file never see a partial snapshot
+            ok = (rename(temporaryFilename.Buffer(), filename.Buffer()) == 0);
+        }
+    }
+    return ok;
+}
+
+CLASS_REGISTER(HistogramRegistry, "1.0")
+CLASS_METHOD_REGISTER(HistogramRegistry, ExportHistograms)
+
+}
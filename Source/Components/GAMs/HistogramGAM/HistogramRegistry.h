@@ -0,0 +1,336 @@
+/**
+ * @file HistogramRegistry.h
+ * @brief Header file for class HistogramRegistry
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HistogramRegistry
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef HISTOGRAMREGISTRY_H_
+#define HISTOGRAMREGISTRY_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderI.h"
+#include "FastPollingMutexSem.h"
+#include "MessageI.h"
+#include "Object.h"
+#include "RegisteredMethodsMessageFilter.h"
+#include "SingleThreadService.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The maximum number of (merged) histograms of a HistogramRegistry.
+ */
+const uint32 HISTOGRAM_REGISTRY_MAX_HISTOGRAMS = 64u;
+
+/**
+ * The maximum number of shards (i.e. of HistogramGAM signals) registered in a HistogramRegistry.
+ */
+const uint32 HISTOGRAM_REGISTRY_MAX_SHARDS = 256u;
+
+/**
+ * @brief Process-wide registry which merges the histograms computed by HistogramGAM instances in any number of real-time threads.
+ * @details Each HistogramGAM with Registry set registers the counters of each of its output signals as a shard of the histogram
+ * with the same name (the RegistryName of the input signal, by default the name of the input signal). The shards of the same
+ * histogram must have the same bins (the same Edges, see HistogramGAM::ExportHistogram()).
+ *
+ * The real-time threads keep writing only their own counters (the output signals of the HistogramGAM): they never lock nor wait for
+ * the registry. Every MergePeriod milliseconds a SingleThreadService copies the counters of each shard and adds to the merged histogram
+ * the increments since the previous copy, so that the merged counts only grow and are not affected by the reset of the HistogramGAM
+ * (StateChangeResetName). A reset is detected with a generation counter which the HistogramGAM increments (atomically) after clearing the
+ * counters: the counts of a shard between the last merge and its reset are lost (at most one MergePeriod). A merge may include part of the
+ * occurrences of a cycle which is being executed, the rest is counted in the next merge.
+ *
+ * The merged histograms are a snapshot which is replaced, under a lock which is only taken by the merging thread, by Register()/Unregister()
+ * (in the non real-time phases) and by the export functions, in one step. They can be exported:\n
+ *  - with the ExportHistograms RPC (see ExportHistograms());\n
+ *  - on the file Filename, which is rewritten (on a temporary file which is then renamed, so that a reader never sees a partial file)
+ *  after every merge.
+ *
+ * Each histogram is exported in the format of HistogramGAM::ExportHistogram() (so that it can be merged with HistogramGAM::MergeHistograms()
+ * with the histograms of other applications) under a node with its name.
+ *
+ * <pre>
+ * +Histograms = {
+ *     Class = HistogramRegistry
+ *     MergePeriod = 1000 //Optional. Default = 1000. The period of the merge (in milliseconds).
+ *     Filename = "/tmp/histograms.cfg" //Optional. If set the merged histograms are written on this file after every merge.
+ *     CPUMask = 0x1 //Optional. The affinity of the merging thread.
+ * }
+ * +App = {
+ *     Class = RealTimeApplication
+ *     +Functions = {
+ *         Class = ReferenceContainer
+ *         +HistogramGAM1 = {
+ *             Class = HistogramGAM
+ *             Registry = "Histograms"
+ *             InputSignals = {
+ *                 CycleTime1 = {
+ *                     ...
+ *                     RegistryName = CycleTime //Merged with the CycleTime2 of the HistogramGAM2 (in another thread).
+ *                 }
+ *             ...
+ * </pre>
+ */
+class HistogramRegistry: public Object, public EmbeddedServiceMethodBinderI, public MessageI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. Installs the message filter of the RPCs.
+     */
+    HistogramRegistry();
+
+    /**
+     * @brief Destructor. Stops the merging thread and frees the histograms.
+     */
+    virtual ~HistogramRegistry();
+
+    /**
+     * @brief Reads the parameters and starts the merging thread.
+     * @return true if MergePeriod > 0 and if the thread could be started.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Merges the shards every MergePeriod and writes the Filename (if set).
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Registers the counters of a HistogramGAM signal as a shard of the histogram \a name.
+     * @details The histogram is created by the first shard. Shall not be called by a real-time thread.
+     * @param[in] name the name of the merged histogram.
+     * @param[in] significantDigits the significant digits of the log-linear bins (0 for the linear bins).
+     * @param[in] edges the lower edges of the bins 1 to numberOfBins - 1.
+     * @param[in] numberOfBins the number of bins.
+     * @param[in] counts the counters written by the HistogramGAM (numberOfBins elements). Shall remain valid until Unregister().
+     * @param[in] generation incremented by the HistogramGAM after each reset of the \a counts.
+     * @param[in] owner identifies the shards to be removed by Unregister().
+     * @return true if the histogram \a name has the same bins (or is created) and if the maximum number of histograms and shards is not exceeded.
+     */
+    bool Register(const char8 * const name,
+                  const uint32 significantDigits,
+                  const float64 * const edges,
+                  const uint32 numberOfBins,
+                  const uint32 * const counts,
+                  volatile int32 * const generation,
+                  const void * const owner);
+
+    /**
+     * @brief Merges the last increments of the shards of \a owner and removes them.
+     * @details The merged histograms are kept. Shall not be called by a real-time thread.
+     * @param[in] owner the owner given in Register().
+     */
+    void Unregister(const void * const owner);
+
+    /**
+     * @brief Adds the increments of all the shards to the merged histograms.
+     * @details Called by the merging thread. Never blocks the HistogramGAM instances.
+     */
+    void Merge();
+
+    /**
+     * @brief Gets the number of merged histograms.
+     * @return the number of merged histograms.
+     */
+    uint32 GetNumberOfHistograms();
+
+    /**
+     * @brief Gets the number of registered shards.
+     * @return the number of registered shards.
+     */
+    uint32 GetNumberOfShards();
+
+    /**
+     * @brief Exports a merged histogram in the format of HistogramGAM::ExportHistogram().
+     * @param[in] name the name of the histogram.
+     * @param[out] data where to write the histogram.
+     * @return true if the histogram exists and is written.
+     */
+    bool ExportHistogram(const char8 * const name,
+                         StructuredDataI &data);
+
+    /**
+     * @brief RPC which merges the shards and exports all the histograms.
+     * @details Each histogram is written (see ExportHistogram()) in a node with its name of the StructuredDataI in the first
+     * position of the \a message.
+     * @param[in] message holds the StructuredDataI where to write the histograms.
+     * @return ErrorManagement::NoError if the StructuredDataI is valid and all the histograms are written.
+     */
+    ErrorManagement::ErrorType ExportHistograms(ReferenceContainer &message);
+
+    /**
+     * @brief Writes all the merged histograms on Filename.
+     * @return true if Filename is not set or if the file is written.
+     */
+    bool WriteFile();
+
+private:
+
+    /**
+     * @brief A merged histogram.
+     */
+    struct HistogramRegistryHistogram {
+        /**
+         * The name of the histogram.
+         */
+        StreamString name;
+
+        /**
+         * The number of bins.
+         */
+        uint32 numberOfBins;
+
+        /**
+         * The significant digits (0 for the linear bins).
+         */
+        uint32 significantDigits;
+
+        /**
+         * The lower edges of the bins 1 to numberOfBins - 1.
+         */
+        float64 *edges;
+
+        /**
+         * The merged counts.
+         */
+        uint64 *counts;
+    };
+
+    /**
+     * @brief The counters of a HistogramGAM signal.
+     */
+    struct HistogramRegistryShard {
+        /**
+         * The index of the merged histogram.
+         */
+        uint32 histogram;
+
+        /**
+         * The counters written by the HistogramGAM.
+         */
+        const uint32 *counts;
+
+        /**
+         * The reset generation written by the HistogramGAM.
+         */
+        volatile int32 *generation;
+
+        /**
+         * The generation at the last merge.
+         */
+        int32 lastGeneration;
+
+        /**
+         * The copy of the counters at the last merge.
+         */
+        uint32 *lastCounts;
+
+        /**
+         * The owner of the shard.
+         */
+        const void *owner;
+    };
+
+    /**
+     * @brief Adds the increments of a shard to its histogram.
+     * @pre the mutex is locked.
+     */
+    void MergeShard(HistogramRegistryShard &shard);
+
+    /**
+     * @brief Exports a merged histogram.
+     * @pre the mutex is locked.
+     */
+    bool ExportHistogram(const HistogramRegistryHistogram &histogram,
+                         StructuredDataI &data) const;
+
+    /**
+     * The merging thread.
+     */
+    SingleThreadService executor;
+
+    /**
+     * Protects the histograms and the shards (never taken by the real-time threads).
+     */
+    FastPollingMutexSem mutex;
+
+    /**
+     * The period of the merge in milliseconds.
+     */
+    uint32 mergePeriod;
+
+    /**
+     * The HighResolutionTimer::Counter of the last merge.
+     */
+    uint64 lastMergeCounter;
+
+    /**
+     * The affinity of the merging thread (0 if not set).
+     */
+    uint32 cpuMask;
+
+    /**
+     * The file where the histograms are written (empty if not set).
+     */
+    StreamString filename;
+
+    /**
+     * The merged histograms.
+     */
+    HistogramRegistryHistogram histograms[HISTOGRAM_REGISTRY_MAX_HISTOGRAMS];
+    uint32 numberOfHistograms;
+
+    /**
+     * The registered shards.
+     */
+    HistogramRegistryShard shards[HISTOGRAM_REGISTRY_MAX_SHARDS];
+    uint32 numberOfShards;
+
+    /**
+     * The copy of the counters of a shard (of the largest histogram).
+     */
+    uint32 *copyCounts;
+    uint32 copySize;
+
+    /**
+     * The message filter for the RPCs.
+     */
+    ReferenceT<RegisteredMethodsMessageFilter> filter;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* HISTOGRAMREGISTRY_H_ */
@@ -0,0 +1,134 @@
+/**
+ * @file FixedSizeCopy.h
+ * @brief Header file for the FixedSizeCopy kernels
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration and the (inline) definition of the
+ * copy kernels specialised at compile time for fixed chunk sizes and counts.
+ * It is header only, so that it can be shared by the GAMs (IOGAM, Interleaved2FlatGAM) without a link dependency.
+ */
+
+#ifndef FIXEDSIZECOPY_H_
+#define FIXEDSIZECOPY_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <string.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Copies a fixed number of chunks of a fixed size (known at compile time).
+ * @details The chunk k is copied from source + k * sourceStride to destination + k * destinationStride
+ * (the strides are ignored if there is only one chunk).
+ */
+typedef void (*FixedSizeCopyFunction)(uint8 * const destination,
+                                      const uint8 * const source,
+                                      const uint32 destinationStride,
+                                      const uint32 sourceStride);
+
+/**
+ * @brief Copies count chunks of size bytes.
+ * @details The memcpy of a size known at compile time is inlined by the compiler in a sequence of (vector, if available) unaligned
+ * loads and stores, avoiding the call of a generic copy for a small size. The loop on a count known at compile time is unrolled by the compiler.
+ * @see FixedSizeCopyFunction
+ */
+template<uint32 size, uint32 count>
+void FixedSizeCopy(uint8 * const destination,
+                   const uint8 * const source,
+                   const uint32 destinationStride,
+                   const uint32 sourceStride) {
+    uint32 k;
+    for (k = 0u; k < count; k++) {
+        (void) memcpy(&destination[k * destinationStride], &source[k * sourceStride], size);
+    }
+}
+
+/**
+ * @brief An entry of the table of the FixedSizeCopy kernels.
+ */
+struct FixedSizeCopyKernel {
+    /**
+     * The size of each chunk.
+     */
+    uint32 size;
+    /**
+     * The number of chunks.
+     */
+    uint32 count;
+    /**
+     * The kernel.
+     */
+    FixedSizeCopyFunction function;
+};
+
+/**
+ * @brief Gets the FixedSizeCopy kernel which copies \a count chunks of \a size bytes.
+ * @details The table holds the single copies of up to 64 bytes which are frequent in the signals (e.g. 3 x float32)
+ * and the strided copies of 2 to 16 chunks of up to 16 bytes (e.g. the members of 8 packets).
+ * To be called when the GAM is configured (the search is linear).
+ * @param[in] size the size of each chunk.
+ * @param[in] count the number of chunks.
+ * @return the kernel or NULL if there is no kernel for this \a size and \a count (the caller shall then use the generic copy).
+ */
+inline FixedSizeCopyFunction GetFixedSizeCopy(const uint32 size,
+                                              const uint32 count) {
+    static const FixedSizeCopyKernel kernels[] = {
+            { 1u, 1u, &FixedSizeCopy<1u, 1u> }, { 2u, 1u, &FixedSizeCopy<2u, 1u> }, { 3u, 1u, &FixedSizeCopy<3u, 1u> },
+            { 4u, 1u, &FixedSizeCopy<4u, 1u> }, { 6u, 1u, &FixedSizeCopy<6u, 1u> }, { 8u, 1u, &FixedSizeCopy<8u, 1u> },
+            { 12u, 1u, &FixedSizeCopy<12u, 1u> }, { 16u, 1u, &FixedSizeCopy<16u, 1u> }, { 20u, 1u, &FixedSizeCopy<20u, 1u> },
+            { 24u, 1u, &FixedSizeCopy<24u, 1u> }, { 32u, 1u, &FixedSizeCopy<32u, 1u> }, { 40u, 1u, &FixedSizeCopy<40u, 1u> },
+            { 48u, 1u, &FixedSizeCopy<48u, 1u> }, { 64u, 1u, &FixedSizeCopy<64u, 1u> },
+            { 1u, 2u, &FixedSizeCopy<1u, 2u> }, { 1u, 3u, &FixedSizeCopy<1u, 3u> }, { 1u, 4u, &FixedSizeCopy<1u, 4u> },
+            { 1u, 8u, &FixedSizeCopy<1u, 8u> }, { 1u, 16u, &FixedSizeCopy<1u, 16u> },
+            { 2u, 2u, &FixedSizeCopy<2u, 2u> }, { 2u, 3u, &FixedSizeCopy<2u, 3u> }, { 2u, 4u, &FixedSizeCopy<2u, 4u> },
+            { 2u, 8u, &FixedSizeCopy<2u, 8u> }, { 2u, 16u, &FixedSizeCopy<2u, 16u> },
+            { 4u, 2u, &FixedSizeCopy<4u, 2u> }, { 4u, 3u, &FixedSizeCopy<4u, 3u> }, { 4u, 4u, &FixedSizeCopy<4u, 4u> },
+            { 4u, 8u, &FixedSizeCopy<4u, 8u> }, { 4u, 16u, &FixedSizeCopy<4u, 16u> },
+            { 8u, 2u, &FixedSizeCopy<8u, 2u> }, { 8u, 3u, &FixedSizeCopy<8u, 3u> }, { 8u, 4u, &FixedSizeCopy<8u, 4u> },
+            { 8u, 8u, &FixedSizeCopy<8u, 8u> }, { 8u, 16u, &FixedSizeCopy<8u, 16u> },
+            { 12u, 2u, &FixedSizeCopy<12u, 2u> }, { 12u, 3u, &FixedSizeCopy<12u, 3u> }, { 12u, 4u, &FixedSizeCopy<12u, 4u> },
+            { 12u, 8u, &FixedSizeCopy<12u, 8u> }, { 12u, 16u, &FixedSizeCopy<12u, 16u> },
+            { 16u, 2u, &FixedSizeCopy<16u, 2u> }, { 16u, 3u, &FixedSizeCopy<16u, 3u> }, { 16u, 4u, &FixedSizeCopy<16u, 4u> },
+            { 16u, 8u, &FixedSizeCopy<16u, 8u> }, { 16u, 16u, &FixedSizeCopy<16u, 16u> } };
+    const uint32 numberOfKernels = static_cast<uint32>(sizeof(kernels) / sizeof(FixedSizeCopyKernel));
+    FixedSizeCopyFunction function = NULL_PTR(FixedSizeCopyFunction);
+    uint32 i;
+    for (i = 0u; (i < numberOfKernels) && (function == NULL_PTR(FixedSizeCopyFunction)); i++) {
+        if ((kernels[i].size == size) && (kernels[i].count == count)) {
+            function = kernels[i].function;
+        }
+    }
+    return function;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FIXEDSIZECOPY_H_ */
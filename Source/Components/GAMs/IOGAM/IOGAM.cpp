@@ -42,6 +42,7 @@ namespace MARTe {
 IOGAM::IOGAM() :
         GAM() {
     totalSignalsByteSize = 0u;
+    fixedSizeCopy = NULL_PTR(FixedSizeCopyFunction);
 }
 
 IOGAM::~IOGAM() {
@@ -87,13 +88,25 @@ bool IOGAM::Setup() {
     }
     if (ret) {
         totalSignalsByteSize = outTotalSignalsByteSize;
+        fixedSizeCopy = GetFixedSizeCopy(totalSignalsByteSize, 1u);
     }
 
     return ret;
 }
 
 bool IOGAM::Execute() {
-    return MemoryOperationsHelper::Copy(GetOutputSignalsMemory(), GetInputSignalsMemory(), totalSignalsByteSize);
+    bool ret = true;
+    if (fixedSizeCopy != NULL_PTR(FixedSizeCopyFunction)) {
+        fixedSizeCopy(static_cast<uint8 *>(GetOutputSignalsMemory()), static_cast<const uint8 *>(GetInputSignalsMemory()), 0u, 0u);
+    }
+    else {
+        ret = MemoryOperationsHelper::Copy(GetOutputSignalsMemory(), GetInputSignalsMemory(), totalSignalsByteSize);
+    }
+    return ret;
+}
+
+bool IOGAM::IsFixedSizeCopy() const {
+    return (fixedSizeCopy != NULL_PTR(FixedSizeCopyFunction));
 }
 CLASS_REGISTER(IOGAM, "1.0")
 }
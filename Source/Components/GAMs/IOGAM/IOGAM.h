@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "FixedSizeCopy.h"
 #include "GAM.h"
 
 /*---------------------------------------------------------------------------*/
@@ -44,6 +45,9 @@ namespace MARTe {
  *  Given that the DataSources cannot interchange data directly between them the main scope of the IOGAM is to
  *  serve as a (direct) connector between DataSources.
  *
+ * If the total size to copy is small and matches one of the FixedSizeCopy kernels (e.g. 3 x float32 = 12 bytes), the
+ * kernel, whose copy is unrolled at compile time for that size, is selected in the Setup and used instead of the generic copy.
+ *
  * The configuration syntax is (names and signal quantity are only given as an example):
  * <pre>
  * +Buffer = {
@@ -95,15 +99,27 @@ public:
 
     /**
      * @brief Copies the input signals memory to the output signal memory.
+     * @details Uses the FixedSizeCopy kernel selected in the Setup if any (see IsFixedSizeCopy).
      * @return true if all the signals memory can be successfully copied.
      */
     virtual bool Execute();
 
+    /**
+     * @brief Checks if a FixedSizeCopy kernel was selected for the total size to copy.
+     * @return true if the Execute uses a FixedSizeCopy kernel instead of the generic copy.
+     */
+    bool IsFixedSizeCopy() const;
+
 private:
     /**
      * Total number of bytes to copy.
      */
     uint32 totalSignalsByteSize;
+
+    /**
+     * The FixedSizeCopy kernel for totalSignalsByteSize or NULL if there is none.
+     */
+    FixedSizeCopyFunction fixedSizeCopy;
 };
 }
 
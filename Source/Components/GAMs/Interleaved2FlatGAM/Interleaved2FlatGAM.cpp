@@ -28,11 +28,150 @@
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "AdvancedErrorManagement.h"
 #include "Interleaved2FlatGAM.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * @brief Strided copy of elements with the size of T.
+ */
+/*lint -e{927} -e{826} the memory is accessed with the type of the elements.*/
+template<typename T>
+void StridedCopyT(MARTe::uint8 * const destination,
+                  const MARTe::uint8 * const source,
+                  const MARTe::uint32 destinationStride,
+                  const MARTe::uint32 sourceStride,
+                  const MARTe::uint32 count) {
+    using namespace MARTe;
+    uint32 k;
+    for (k = 0u; k < count; k++) {
+        *reinterpret_cast<T *>(&destination[k * destinationStride]) = *reinterpret_cast<const T *>(&source[k * sourceStride]);
+    }
+}
+
+/**
+ * @brief Transposes the block [rowStart, rowEnd[ x [columnStart, columnEnd[ of a rows x columns matrix of elements with the size of T.
+ */
+/*lint -e{927} -e{826} the memory is accessed with the type of the elements.*/
+template<typename T>
+void TransposeBlockT(MARTe::uint8 * const destination,
+                     const MARTe::uint8 * const source,
+                     const MARTe::uint32 rows,
+                     const MARTe::uint32 columns,
+                     const MARTe::uint32 rowStart,
+                     const MARTe::uint32 rowEnd,
+                     const MARTe::uint32 columnStart,
+                     const MARTe::uint32 columnEnd) {
+    using namespace MARTe;
+    T *dest = reinterpret_cast<T *>(destination);
+    const T *src = reinterpret_cast<const T *>(source);
+    uint32 r;
+    for (r = rowStart; r < rowEnd; r++) {
+        uint32 c;
+        for (c = columnStart; c < columnEnd; c++) {
+            dest[(c * rows) + r] = src[(r * columns) + c];
+        }
+    }
+}
+
+/**
+ * @brief Transposes a rows x columns matrix of 16 bit elements, in blocks of 8 x 8 elements.
+ */
+void Transpose16(MARTe::uint8 * const destination,
+                 const MARTe::uint8 * const source,
+                 const MARTe::uint32 rows,
+                 const MARTe::uint32 columns) {
+    using namespace MARTe;
+    uint32 r = 0u;
+#if defined(__SSE2__)
+    /*lint -save -e586 -e9016 -e923 -e826 SSE2 intrinsics on unaligned signal memory.*/
+    const uint16 *src = reinterpret_cast<const uint16 *>(source);
+    uint16 *dest = reinterpret_cast<uint16 *>(destination);
+    for (; (r + 8u) <= rows; r += 8u) {
+        uint32 c = 0u;
+        for (; (c + 8u) <= columns; c += 8u) {
+            __m128i a[8];
+            uint32 i;
+            for (i = 0u; i < 8u; i++) {
+                a[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[((r + i) * columns) + c]));
+            }
+            __m128i t0 = _mm_unpacklo_epi16(a[0], a[1]);
+            __m128i t1 = _mm_unpackhi_epi16(a[0], a[1]);
+            __m128i t2 = _mm_unpacklo_epi16(a[2], a[3]);
+            __m128i t3 = _mm_unpackhi_epi16(a[2], a[3]);
+            __m128i t4 = _mm_unpacklo_epi16(a[4], a[5]);
+            __m128i t5 = _mm_unpackhi_epi16(a[4], a[5]);
+            __m128i t6 = _mm_unpacklo_epi16(a[6], a[7]);
+            __m128i t7 = _mm_unpackhi_epi16(a[6], a[7]);
+            __m128i u0 = _mm_unpacklo_epi32(t0, t2);
+            __m128i u1 = _mm_unpackhi_epi32(t0, t2);
+            __m128i u2 = _mm_unpacklo_epi32(t1, t3);
+            __m128i u3 = _mm_unpackhi_epi32(t1, t3);
+            __m128i u4 = _mm_unpacklo_epi32(t4, t6);
+            __m128i u5 = _mm_unpackhi_epi32(t4, t6);
+            __m128i u6 = _mm_unpacklo_epi32(t5, t7);
+            __m128i u7 = _mm_unpackhi_epi32(t5, t7);
+            a[0] = _mm_unpacklo_epi64(u0, u4);
+            a[1] = _mm_unpackhi_epi64(u0, u4);
+            a[2] = _mm_unpacklo_epi64(u1, u5);
+            a[3] = _mm_unpackhi_epi64(u1, u5);
+            a[4] = _mm_unpacklo_epi64(u2, u6);
+            a[5] = _mm_unpackhi_epi64(u2, u6);
+            a[6] = _mm_unpacklo_epi64(u3, u7);
+            a[7] = _mm_unpackhi_epi64(u3, u7);
+            for (i = 0u; i < 8u; i++) {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[((c + i) * rows) + r]), a[i]);
+            }
+        }
+        TransposeBlockT<uint16>(destination, source, rows, columns, r, r + 8u, c, columns);
+    }
+    /*lint -restore*/
+#endif
+    TransposeBlockT<uint16>(destination, source, rows, columns, r, rows, 0u, columns);
+}
+
+/**
+ * @brief Transposes a rows x columns matrix of 32 bit elements, in blocks of 4 x 4 elements.
+ */
+void Transpose32(MARTe::uint8 * const destination,
+                 const MARTe::uint8 * const source,
+                 const MARTe::uint32 rows,
+                 const MARTe::uint32 columns) {
+    using namespace MARTe;
+    uint32 r = 0u;
+#if defined(__SSE2__)
+    /*lint -save -e586 -e9016 -e923 -e826 SSE2 intrinsics on unaligned signal memory.*/
+    const uint32 *src = reinterpret_cast<const uint32 *>(source);
+    uint32 *dest = reinterpret_cast<uint32 *>(destination);
+    for (; (r + 4u) <= rows; r += 4u) {
+        uint32 c = 0u;
+        for (; (c + 4u) <= columns; c += 4u) {
+            __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[(r * columns) + c]));
+            __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[((r + 1u) * columns) + c]));
+            __m128i a2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[((r + 2u) * columns) + c]));
+            __m128i a3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[((r + 3u) * columns) + c]));
+            __m128i t0 = _mm_unpacklo_epi32(a0, a1);
+            __m128i t1 = _mm_unpackhi_epi32(a0, a1);
+            __m128i t2 = _mm_unpacklo_epi32(a2, a3);
+            __m128i t3 = _mm_unpackhi_epi32(a2, a3);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[(c * rows) + r]), _mm_unpacklo_epi64(t0, t2));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[((c + 1u) * rows) + r]), _mm_unpackhi_epi64(t0, t2));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[((c + 2u) * rows) + r]), _mm_unpacklo_epi64(t1, t3));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[((c + 3u) * rows) + r]), _mm_unpackhi_epi64(t1, t3));
+        }
+        TransposeBlockT<uint32>(destination, source, rows, columns, r, r + 4u, c, columns);
+    }
+    /*lint -restore*/
+#endif
+    TransposeBlockT<uint32>(destination, source, rows, columns, r, rows, 0u, columns);
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -51,6 +190,11 @@ Interleaved2FlatGAM::Interleaved2FlatGAM() :
     numberOfOutputPacketChunks = NULL_PTR(uint32 *);
     packetOutputChunkSize = NULL_PTR(uint32 *);
     totalSignalsByteSize = 0u;
+
+    copies = NULL_PTR(Interleaved2FlatGAMCopy *);
+    numberOfCopies = 0u;
+    transpositions = NULL_PTR(Interleaved2FlatGAMTranspose *);
+    numberOfTranspositions = 0u;
 }
 
 Interleaved2FlatGAM::~Interleaved2FlatGAM() {
@@ -86,6 +230,13 @@ Interleaved2FlatGAM::~Interleaved2FlatGAM() {
         delete[] packetOutputChunkSize;
     }
 
+    if (copies != NULL_PTR(Interleaved2FlatGAMCopy *)) {
+        delete[] copies;
+    }
+
+    if (transpositions != NULL_PTR(Interleaved2FlatGAMTranspose *)) {
+        delete[] transpositions;
+    }
 }
 
 /*lint -e{613} null pointer checked.*/
@@ -329,94 +480,161 @@ bool Interleaved2FlatGAM::Setup() {
 
     }
 
+    //build the copy plan
+    if (ret) {
+        copies = new Interleaved2FlatGAMCopy[totalNumberOfInputChunkSizes + totalNumberOfOutputChunkSizes + numberOfInputSignals + numberOfOutputSignals
+                + 1u];
+        transpositions = new Interleaved2FlatGAMTranspose[numberOfInputSignals + numberOfOutputSignals];
+        bool *covered = new bool[totalSignalsByteSize];
+        uint32 b;
+        for (b = 0u; b < totalSignalsByteSize; b++) {
+            covered[b] = false;
+        }
+        AddPacketsToPlan(numberOfInputSignals, numberOfInputSamples, inputByteSize, numberOfInputPacketChunks, packetInputChunkSize, true, covered);
+        AddPacketsToPlan(numberOfOutputSignals, numberOfOutputSamples, outputByteSize, numberOfOutputPacketChunks, packetOutputChunkSize, false, covered);
+        //the memory that is not written by the packets is copied as is
+        b = 0u;
+        while (b < totalSignalsByteSize) {
+            if (covered[b]) {
+                b++;
+            }
+            else {
+                uint32 start = b;
+                while ((b < totalSignalsByteSize) && (!covered[b])) {
+                    b++;
+                }
+                copies[numberOfCopies].sourceOffset = start;
+                copies[numberOfCopies].sourceStride = 0u;
+                copies[numberOfCopies].destinationOffset = start;
+                copies[numberOfCopies].destinationStride = 0u;
+                copies[numberOfCopies].size = (b - start);
+                copies[numberOfCopies].count = 1u;
+                copies[numberOfCopies].function = GetFixedSizeCopy(copies[numberOfCopies].size, 1u);
+                numberOfCopies++;
+            }
+        }
+        delete[] covered;
+    }
+
     return ret;
 }
 
-/*lint -e{613} null pointer checked.*/
-bool Interleaved2FlatGAM::Execute() {
-    bool ret = MemoryOperationsHelper::Copy(GetOutputSignalsMemory(), GetInputSignalsMemory(), totalSignalsByteSize);
-    uint32 cnt = 0u;
+/*lint -e{613} null pointers checked in the Setup.*/
+void Interleaved2FlatGAM::AddPacketsToPlan(const uint32 numberOfSignals,
+                                           const uint32 * const numberOfSamples,
+                                           const uint32 * const byteSize,
+                                           const uint32 * const numberOfChunks,
+                                           const uint32 * const chunkSize,
+                                           const bool interleavedInput,
+                                           bool * const covered) {
     uint32 offset = 0u;
-    for (uint32 n = 0u; (n < numberOfInputSignals); n++) {
-        //do the split of the signals
-        uint8 *originSource = reinterpret_cast<uint8 *>(GetInputSignalMemory(n));
-
-        uint8 *originDest = &(reinterpret_cast<uint8 *>(GetOutputSignalsMemory()))[offset];
-
-        //this should be the number of samples
-        /*lint -e{613} null pointer checked before.*/
-        for (uint32 k = 0u; k < numberOfInputSamples[n]; k++) {
-            //return to the gam pointet
-            uint8 *dest = originDest;
-            //go to the k-th packet in the data source
-            /*lint -e{613} null pointer checked before.*/
-            uint32 index = (k * inputByteSize[n]);
-            /*lint -e{613} null pointer checked before.*/
-            uint8 *source = &originSource[index];
-            /*lint -e{613} null pointer checked before.*/
-            for (uint32 i = 0u; i < numberOfInputPacketChunks[n]; i++) {
-                //get the chunk size
-                index = (cnt + i);
-                /*lint -e{613} null pointer checked before.*/
-                uint32 chunkSize = packetInputChunkSize[index];
-                //put the k-th element
-                index = (k * chunkSize);
-                dest = &dest[index];
-                (void) MemoryOperationsHelper::Copy(dest, source, chunkSize);
-                //skip the N-k other samples to go to the next chunk mem
-                index = ((numberOfInputSamples[n] - k) * chunkSize);
-                dest = &dest[index];
-                //get the next chunk in source
-                source = &source[chunkSize];
+    uint32 cnt = 0u;
+    for (uint32 n = 0u; n < numberOfSignals; n++) {
+        uint32 signalSize = (byteSize[n] * numberOfSamples[n]);
+        if (numberOfChunks[n] > 0u) {
+            uint32 b;
+            for (b = offset; b < (offset + signalSize); b++) {
+                covered[b] = true;
+            }
+            //all the members with the same size can be transposed at once
+            uint32 elementSize = chunkSize[cnt];
+            bool uniform = ((elementSize == 2u) || (elementSize == 4u));
+            for (uint32 i = 1u; (i < numberOfChunks[n]) && (uniform); i++) {
+                uniform = (chunkSize[cnt + i] == elementSize);
+            }
+            if (uniform) {
+                transpositions[numberOfTranspositions].sourceOffset = offset;
+                transpositions[numberOfTranspositions].destinationOffset = offset;
+                transpositions[numberOfTranspositions].rows = interleavedInput ? numberOfSamples[n] : numberOfChunks[n];
+                transpositions[numberOfTranspositions].columns = interleavedInput ? numberOfChunks[n] : numberOfSamples[n];
+                transpositions[numberOfTranspositions].elementSize = elementSize;
+                numberOfTranspositions++;
+            }
+            else {
+                uint32 memberOffset = 0u;
+                for (uint32 i = 0u; i < numberOfChunks[n]; i++) {
+                    uint32 size = chunkSize[cnt + i];
+                    //the members are contiguous in the flat memory, one after the other
+                    uint32 flatOffset = (offset + (numberOfSamples[n] * memberOffset));
+                    uint32 packetOffset = (offset + memberOffset);
+                    copies[numberOfCopies].sourceOffset = interleavedInput ? packetOffset : flatOffset;
+                    copies[numberOfCopies].sourceStride = interleavedInput ? byteSize[n] : size;
+                    copies[numberOfCopies].destinationOffset = interleavedInput ? flatOffset : packetOffset;
+                    copies[numberOfCopies].destinationStride = interleavedInput ? size : byteSize[n];
+                    copies[numberOfCopies].size = size;
+                    copies[numberOfCopies].count = numberOfSamples[n];
+                    copies[numberOfCopies].function = GetFixedSizeCopy(size, numberOfSamples[n]);
+                    numberOfCopies++;
+                    memberOffset += size;
+                }
             }
         }
-        offset += (inputByteSize[n] * numberOfInputSamples[n]);
-        cnt += numberOfInputPacketChunks[n];
+        offset += signalSize;
+        cnt += numberOfChunks[n];
+    }
+}
 
+void Interleaved2FlatGAM::StridedCopy(uint8 * const destination,
+                                      const uint8 * const source,
+                                      const Interleaved2FlatGAMCopy &copy) {
+    if (copy.size == 1u) {
+        StridedCopyT<uint8>(destination, source, copy.destinationStride, copy.sourceStride, copy.count);
+    }
+    else if (copy.size == 2u) {
+        StridedCopyT<uint16>(destination, source, copy.destinationStride, copy.sourceStride, copy.count);
     }
+    else if (copy.size == 4u) {
+        StridedCopyT<uint32>(destination, source, copy.destinationStride, copy.sourceStride, copy.count);
+    }
+    else {
+        for (uint32 k = 0u; k < copy.count; k++) {
+            (void) MemoryOperationsHelper::Copy(&destination[k * copy.destinationStride], &source[k * copy.sourceStride], copy.size);
+        }
+    }
+}
 
-    cnt = 0u;
-    offset = 0u;
-    for (uint32 n = 0u; (n < numberOfOutputSignals); n++) {
-        //do the split of the signals
-        uint8 *originSource = &(reinterpret_cast<uint8 *>(GetInputSignalsMemory()))[offset];
-
-        uint8 *originDest = reinterpret_cast<uint8 *>(GetOutputSignalMemory(n));
-
-        //this should be the number of samples
-        /*lint -e{613} null pointer checked before.*/
-        for (uint32 k = 0u; k < numberOfOutputSamples[n]; k++) {
-            //return to the gam pointet
-            uint8 *source = originSource;
-            //go to the k-th packet in the data source
-            /*lint -e{613} null pointer checked before.*/
-            uint32 index = (k * outputByteSize[n]);
-            /*lint -e{613} null pointer checked before.*/
-            uint8 *dest = &originDest[index];
-            /*lint -e{613} null pointer checked before.*/
-            for (uint32 i = 0u; i < numberOfOutputPacketChunks[n]; i++) {
-                //get the chunk size
-                index = (cnt + i);
-                /*lint -e{613} null pointer checked before.*/
-                uint32 chunkSize = packetOutputChunkSize[index];
-                //put the k-th element
-                index = (k * chunkSize);
-                source = &source[index];
-                (void) MemoryOperationsHelper::Copy(dest, source, chunkSize);
-                //skip the N-k other samples to go to the next chunk mem
-                index = ((numberOfOutputSamples[n] - k) * chunkSize);
-                source = &source[index];
-                //get the next chunk in source
-                dest = &dest[chunkSize];
+void Interleaved2FlatGAM::Transpose(uint8 * const destination,
+                                    const uint8 * const source,
+                                    const Interleaved2FlatGAMTranspose &transpose) {
+    if (transpose.elementSize == 2u) {
+        Transpose16(destination, source, transpose.rows, transpose.columns);
+    }
+    else if (transpose.elementSize == 4u) {
+        Transpose32(destination, source, transpose.rows, transpose.columns);
+    }
+    else {
+        for (uint32 r = 0u; r < transpose.rows; r++) {
+            for (uint32 c = 0u; c < transpose.columns; c++) {
+                (void) MemoryOperationsHelper::Copy(&destination[((c * transpose.rows) + r) * transpose.elementSize],
+                                                    &source[((r * transpose.columns) + c) * transpose.elementSize], transpose.elementSize);
             }
         }
-        offset += (outputByteSize[n] * numberOfOutputSamples[n]);
-        cnt += numberOfOutputPacketChunks[n];
-
     }
+}
 
+/*lint -e{613} null pointers checked in the Setup.*/
+bool Interleaved2FlatGAM::Execute() {
+    bool ret = true;
+    uint8 *input = reinterpret_cast<uint8 *>(GetInputSignalsMemory());
+    uint8 *output = reinterpret_cast<uint8 *>(GetOutputSignalsMemory());
+    uint32 n;
+    for (n = 0u; n < numberOfCopies; n++) {
+        const Interleaved2FlatGAMCopy &copy = copies[n];
+        if (copy.function != NULL_PTR(FixedSizeCopyFunction)) {
+            copy.function(&output[copy.destinationOffset], &input[copy.sourceOffset], copy.destinationStride, copy.sourceStride);
+        }
+        else if (copy.count == 1u) {
+            ret = MemoryOperationsHelper::Copy(&output[copy.destinationOffset], &input[copy.sourceOffset], copy.size);
+        }
+        else {
+            StridedCopy(&output[copy.destinationOffset], &input[copy.sourceOffset], copy);
+        }
+    }
+    for (n = 0u; n < numberOfTranspositions; n++) {
+        const Interleaved2FlatGAMTranspose &transpose = transpositions[n];
+        Transpose(&output[transpose.destinationOffset], &input[transpose.sourceOffset], transpose);
+    }
     return ret;
-
 }
 CLASS_REGISTER(Interleaved2FlatGAM, "1.0")
 }
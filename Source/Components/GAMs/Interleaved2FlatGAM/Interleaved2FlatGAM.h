@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "FixedSizeCopy.h"
 #include "GAM.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -38,6 +39,68 @@
 
 namespace MARTe {
 
+/**
+ * @brief Copy of count blocks of size bytes from the input signals memory to the output signals memory.
+ * @details The block k is copied from sourceOffset + k * sourceStride to destinationOffset + k * destinationStride.
+ */
+struct Interleaved2FlatGAMCopy {
+    /**
+     * Offset of the first block in the input signals memory.
+     */
+    uint32 sourceOffset;
+    /**
+     * Distance between the blocks in the input signals memory.
+     */
+    uint32 sourceStride;
+    /**
+     * Offset of the first block in the output signals memory.
+     */
+    uint32 destinationOffset;
+    /**
+     * Distance between the blocks in the output signals memory.
+     */
+    uint32 destinationStride;
+    /**
+     * Size of each block.
+     */
+    uint32 size;
+    /**
+     * Number of blocks.
+     */
+    uint32 count;
+    /**
+     * The FixedSizeCopy kernel for size and count or NULL if there is none (the generic copy is used).
+     */
+    FixedSizeCopyFunction function;
+};
+
+/**
+ * @brief Transposition of a matrix of rows x columns elements (all with the same size) from the input signals memory
+ * to the output signals memory.
+ */
+struct Interleaved2FlatGAMTranspose {
+    /**
+     * Offset of the matrix in the input signals memory.
+     */
+    uint32 sourceOffset;
+    /**
+     * Offset of the transposed matrix in the output signals memory.
+     */
+    uint32 destinationOffset;
+    /**
+     * Number of rows of the source matrix.
+     */
+    uint32 rows;
+    /**
+     * Number of columns of the source matrix.
+     */
+    uint32 columns;
+    /**
+     * Size of each element.
+     */
+    uint32 elementSize;
+};
+
 /**
  * @brief GAM which allows to translate an interleaved memory region into a flat memory area (and vice-versa).
  * @details Some data-sources are expected to produce signals which are interleaved, i.e. which are in the form:
@@ -57,6 +120,13 @@ namespace MARTe {
  *
  * The size of the input signals shall match the size of the output signals and the sum of the PacketMemberSizes shall be a sub-multiple of the signal size.
  *
+ * The Setup translates the configuration into a plan of copies, which is executed in each Execute without
+ * copying twice any byte: the signals without PacketMemberSizes are copied with one copy for each contiguous memory area, each
+ * member of the signals with PacketMemberSizes is copied with one strided copy and, when all the members of a signal
+ * have the same size of 2 or 4 bytes (e.g. N ADC channels of int16), the whole signal is transposed at once (with SSE2 instructions if available).
+ * The copies whose size and count match one of the FixedSizeCopy kernels (e.g. 8 blocks of 16 bytes), are executed with the kernel,
+ * which is unrolled at compile time for that size and count, instead of the generic copy.
+ *
  * The configuration syntax is (names and signal quantity are only given as an example):
  *
  * <pre>
@@ -272,6 +342,26 @@ Interleaved2FlatGAM    ();
     virtual bool Execute();
 
 protected:
+    /**
+     * @brief Copies count blocks of size bytes between two strided memory areas.
+     * @param[out] destination the destination memory.
+     * @param[in] source the source memory.
+     * @param[in] copy the definition of the copy (the offsets are not used).
+     */
+    static void StridedCopy(uint8 * const destination,
+                            const uint8 * const source,
+                            const Interleaved2FlatGAMCopy &copy);
+
+    /**
+     * @brief Transposes a matrix of rows x columns elements, stored row by row.
+     * @param[out] destination the transposed matrix (columns x rows).
+     * @param[in] source the source matrix (rows x columns).
+     * @param[in] transpose the definition of the transposition (the offsets are not used).
+     */
+    static void Transpose(uint8 * const destination,
+                          const uint8 * const source,
+                          const Interleaved2FlatGAMTranspose &transpose);
+
     /**
      * Number of input samples for each signal.
      */
@@ -316,6 +406,45 @@ protected:
      */
     uint32 totalSignalsByteSize;
 
+    /**
+     * The copies to be performed in every Execute.
+     */
+    Interleaved2FlatGAMCopy *copies;
+
+    /**
+     * Number of elements of copies.
+     */
+    uint32 numberOfCopies;
+
+    /**
+     * The transpositions to be performed in every Execute.
+     */
+    Interleaved2FlatGAMTranspose *transpositions;
+
+    /**
+     * Number of elements of transpositions.
+     */
+    uint32 numberOfTranspositions;
+
+private:
+    /**
+     * @brief Builds the copies and transpositions for the signals with PacketMemberSizes.
+     * @param[in] numberOfSignals the number of signals in the direction with the packets.
+     * @param[in] numberOfSamples the number of packets of each signal.
+     * @param[in] byteSize the packet size of each signal.
+     * @param[in] numberOfChunks the number of members of each signal.
+     * @param[in] chunkSize the members sizes of all the signals.
+     * @param[in] interleavedInput true if the packets are in the input signals.
+     * @param[out] covered set to true for the bytes that are written.
+     */
+    void AddPacketsToPlan(const uint32 numberOfSignals,
+                          const uint32 * const numberOfSamples,
+                          const uint32 * const byteSize,
+                          const uint32 * const numberOfChunks,
+                          const uint32 * const chunkSize,
+                          const bool interleavedInput,
+                          bool * const covered);
+
 };
 
 }
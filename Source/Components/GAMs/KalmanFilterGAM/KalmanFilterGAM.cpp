@@ -0,0 +1,353 @@
+/**
+ * @file KalmanFilterGAM.cpp
+ * @brief Source file for class KalmanFilterGAM
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class KalmanFilterGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "KalmanFilterGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Gets the step specialised on n states and m measurements.
+ * @return the step or NULL if there is no step for these dimensions.
+ */
+static KalmanFilterStepFunction GetFixedSizeStep(const uint32 n,
+                                                 const uint32 m) {
+    KalmanFilterStepFunction ret = NULL_PTR(KalmanFilterStepFunction);
+    if ((n == 1u) && (m == 1u)) {
+        ret = &KalmanFilterFixedStep<1u, 1u>;
+    }
+    else if ((n == 2u) && (m == 1u)) {
+        ret = &KalmanFilterFixedStep<2u, 1u>;
+    }
+    else if ((n == 2u) && (m == 2u)) {
+        ret = &KalmanFilterFixedStep<2u, 2u>;
+    }
+    else if ((n == 3u) && (m == 1u)) {
+        ret = &KalmanFilterFixedStep<3u, 1u>;
+    }
+    else if ((n == 4u) && (m == 2u)) {
+        ret = &KalmanFilterFixedStep<4u, 2u>;
+    }
+    else if ((n == 6u) && (m == 3u)) {
+        ret = &KalmanFilterFixedStep<6u, 3u>;
+    }
+    else {
+        //No specialisation.
+    }
+    return ret;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+KalmanFilterGAM::KalmanFilterGAM() :
+        GAM(),
+        StatefulI() {
+    model.numberOfStates = 0u;
+    model.numberOfMeasurements = 0u;
+    model.numberOfInputs = 0u;
+    model.stateMatrix = NULL_PTR(float64 *);
+    model.inputMatrix = NULL_PTR(float64 *);
+    model.measurementMatrix = NULL_PTR(float64 *);
+    model.processNoise = NULL_PTR(float64 *);
+    model.measurementNoise = NULL_PTR(float64 *);
+    model.state = NULL_PTR(float64 *);
+    model.covariance = NULL_PTR(float64 *);
+    initialState = NULL_PTR(float64 *);
+    initialCovariance = NULL_PTR(float64 *);
+    work = NULL_PTR(float64 *);
+    step = NULL_PTR(KalmanFilterStepFunction);
+    fixedSize = false;
+    resetInEachState = false;
+    measurement = NULL_PTR(const float64 *);
+    input = NULL_PTR(const float64 *);
+    stateOutput = NULL_PTR(float64 *);
+    varianceOutput = NULL_PTR(float64 *);
+}
+
+/*lint -e{1551} the destructor must guarantee that the model and the work memory are freed.*/
+KalmanFilterGAM::~KalmanFilterGAM() {
+    float64 *matrices[] = { model.stateMatrix, model.inputMatrix, model.measurementMatrix, model.processNoise, model.measurementNoise,
+            model.state, model.covariance, initialState, initialCovariance, work };
+    for (uint32 i = 0u; i < (sizeof(matrices) / sizeof(matrices[0])); i++) {
+        if (matrices[i] != NULL_PTR(float64 *)) {
+            delete[] matrices[i];
+        }
+    }
+}
+
+bool KalmanFilterGAM::Initialise(StructuredDataI &data) {
+    bool ok = GAM::Initialise(data);
+    uint32 n = 0u;
+    uint32 m = 0u;
+    if (ok) {
+        ok = ReadMatrix(data, "StateMatrix", n, n, model.stateMatrix);
+    }
+    if (ok) {
+        ok = ReadMatrix(data, "MeasurementMatrix", m, n, model.measurementMatrix);
+    }
+    if (ok) {
+        ok = ReadMatrix(data, "ProcessNoise", n, n, model.processNoise);
+    }
+    if (ok) {
+        ok = ReadMatrix(data, "MeasurementNoise", m, m, model.measurementNoise);
+    }
+    if (ok) {
+        model.numberOfStates = n;
+        model.numberOfMeasurements = m;
+        if (!data.GetType("InputMatrix").IsVoid()) {
+            ok = ReadMatrix(data, "InputMatrix", n, model.numberOfInputs, model.inputMatrix);
+        }
+    }
+    if (ok) {
+        initialState = new float64[n];
+        model.state = new float64[n];
+        for (uint32 i = 0u; i < n; i++) {
+            initialState[i] = 0.0;
+        }
+        if (!data.GetType("InitialState").IsVoid()) {
+            AnyType arrayDescription = data.GetType("InitialState");
+            ok = (arrayDescription.GetNumberOfElements(0u) == n);
+            if (ok) {
+                Vector<float64> initialStateVector(initialState, n);
+                ok = data.Read("InitialState", initialStateVector);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "InitialState shall have %u elements", n);
+            }
+        }
+    }
+    if (ok) {
+        model.covariance = new float64[n * n];
+        if (!data.GetType("InitialCovariance").IsVoid()) {
+            ok = ReadMatrix(data, "InitialCovariance", n, n, initialCovariance);
+        }
+        else {
+            initialCovariance = new float64[n * n];
+            for (uint32 i = 0u; i < n; i++) {
+                for (uint32 j = 0u; j < n; j++) {
+                    initialCovariance[(i * n) + j] = (i == j) ? (1.0) : (0.0);
+                }
+            }
+        }
+    }
+    if (ok) {
+        uint32 auxResetInEachState = 0u;
+        if (data.Read("ResetInEachState", auxResetInEachState)) {
+            ok = (auxResetInEachState <= 1u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for ResetInEachState. Possible values 0 (false) or 1 (true)");
+            }
+            resetInEachState = (auxResetInEachState == 1u);
+        }
+    }
+    if (ok) {
+        StreamString kernelName = "Auto";
+        (void) data.Read("Kernel", kernelName);
+        if (kernelName == "Auto") {
+            step = GetFixedSizeStep(n, m);
+        }
+        else if (kernelName == "Dynamic") {
+            step = NULL_PTR(KalmanFilterStepFunction);
+        }
+        else {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for Kernel. Possible values Auto or Dynamic");
+        }
+    }
+    if (ok) {
+        fixedSize = (step != NULL_PTR(KalmanFilterStepFunction));
+        if (!fixedSize) {
+            step = &KalmanFilterDynamicStep;
+        }
+        ResetEstimate();
+    }
+    return ok;
+}
+
+bool KalmanFilterGAM::Setup() {
+    uint32 numberOfInputs = (model.numberOfInputs > 0u) ? (2u) : (1u);
+    bool ok = (GetNumberOfInputSignals() == numberOfInputs);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "The number of input signals shall be %u (measurements%s)", numberOfInputs,
+                     (model.numberOfInputs > 0u) ? (" and control inputs") : (""));
+    }
+    if (ok) {
+        uint32 numberOfOutputs = GetNumberOfOutputSignals();
+        ok = ((numberOfOutputs == 1u) || (numberOfOutputs == 2u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The number of output signals shall be 1 (state) or 2 (state and variance)");
+        }
+    }
+    if (ok) {
+        ok = CheckSignal(InputSignals, 0u, model.numberOfMeasurements);
+    }
+    if ((ok) && (model.numberOfInputs > 0u)) {
+        ok = CheckSignal(InputSignals, 1u, model.numberOfInputs);
+    }
+    if (ok) {
+        ok = CheckSignal(OutputSignals, 0u, model.numberOfStates);
+    }
+    if ((ok) && (GetNumberOfOutputSignals() == 2u)) {
+        ok = CheckSignal(OutputSignals, 1u, model.numberOfStates);
+    }
+    if (ok) {
+        measurement = static_cast<const float64 *>(GetInputSignalMemory(0u));
+        if (model.numberOfInputs > 0u) {
+            input = static_cast<const float64 *>(GetInputSignalMemory(1u));
+        }
+        stateOutput = static_cast<float64 *>(GetOutputSignalMemory(0u));
+        if (GetNumberOfOutputSignals() == 2u) {
+            varianceOutput = static_cast<float64 *>(GetOutputSignalMemory(1u));
+        }
+        if ((!fixedSize) && (work == NULL_PTR(float64 *))) {
+            work = new float64[KalmanFilterGetWorkSize(model.numberOfStates, model.numberOfMeasurements)];
+        }
+    }
+    return ok;
+}
+
+bool KalmanFilterGAM::Execute() {
+    /*lint -e{613} step is not NULL as Execute is only called after a successful Initialise*/
+    bool ok = step(model, measurement, input, work);
+    const uint32 n = model.numberOfStates;
+    for (uint32 i = 0u; i < n; i++) {
+        stateOutput[i] = model.state[i];
+    }
+    if (varianceOutput != NULL_PTR(float64 *)) {
+        for (uint32 i = 0u; i < n; i++) {
+            varianceOutput[i] = model.covariance[(i * n) + i];
+        }
+    }
+    return ok;
+}
+
+/*lint -e{715} the estimate is reset regardless of the states.*/
+bool KalmanFilterGAM::PrepareNextState(const char8 * const currentStateName,
+                                       const char8 * const nextStateName) {
+    if (resetInEachState) {
+        ResetEstimate();
+    }
+    return true;
+}
+
+uint32 KalmanFilterGAM::GetNumberOfStates() const {
+    return model.numberOfStates;
+}
+
+uint32 KalmanFilterGAM::GetNumberOfMeasurements() const {
+    return model.numberOfMeasurements;
+}
+
+bool KalmanFilterGAM::IsFixedSize() const {
+    return fixedSize;
+}
+
+bool KalmanFilterGAM::ReadMatrix(StructuredDataI &data,
+                                 const char8 * const name,
+                                 uint32 &rows,
+                                 uint32 &columns,
+                                 float64 *&matrix) {
+    AnyType matrixDescription = data.GetType(name);
+    bool ok = !matrixDescription.IsVoid();
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "%s shall be specified", name);
+    }
+    if (ok) {
+        //0u are columns, 1u are rows
+        uint32 matrixColumns = matrixDescription.GetNumberOfElements(0u);
+        uint32 matrixRows = matrixDescription.GetNumberOfElements(1u);
+        ok = ((matrixRows > 0u) && (matrixColumns > 0u));
+        if (ok) {
+            ok = ((rows == 0u) || (rows == matrixRows));
+        }
+        if (ok) {
+            ok = ((columns == 0u) || (columns == matrixColumns));
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "%s has wrong dimensions (%u x %u)", name, matrixRows, matrixColumns);
+        }
+        if (ok) {
+            rows = matrixRows;
+            columns = matrixColumns;
+        }
+    }
+    if (ok) {
+        matrix = new float64[rows * columns];
+        Matrix<float64> configMatrix(matrix, rows, columns);
+        ok = data.Read(name, configMatrix);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading %s", name);
+        }
+    }
+    return ok;
+}
+
+bool KalmanFilterGAM::CheckSignal(const SignalDirection direction,
+                                  const uint32 signalIdx,
+                                  const uint32 numberOfElements) {
+    bool ok = (GetSignalType(direction, signalIdx) == Float64Bit);
+    uint32 elements = 0u;
+    if (ok) {
+        ok = GetSignalNumberOfElements(direction, signalIdx, elements);
+    }
+    if (ok) {
+        ok = (elements == numberOfElements);
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "The %s signal %u shall be float64 with %u elements",
+                     (direction == InputSignals) ? ("input") : ("output"), signalIdx, numberOfElements);
+    }
+    return ok;
+}
+
+void KalmanFilterGAM::ResetEstimate() {
+    const uint32 n = model.numberOfStates;
+    if ((model.state != NULL_PTR(float64 *)) && (model.covariance != NULL_PTR(float64 *))) {
+        for (uint32 i = 0u; i < n; i++) {
+            model.state[i] = initialState[i];
+        }
+        for (uint32 i = 0u; i < (n * n); i++) {
+            model.covariance[i] = initialCovariance[i];
+        }
+    }
+}
+
+CLASS_REGISTER(KalmanFilterGAM, "1.0")
+}
@@ -0,0 +1,253 @@
+/**
+ * @file KalmanFilterGAM.h
+ * @brief Header file for class KalmanFilterGAM
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class KalmanFilterGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef KALMANFILTERGAM_H_
+#define KALMANFILTERGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+#include "KalmanFilterKernel.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief GAM which estimates the state of a linear system with a Kalman filter.
+ * @details The model of the system is
+ *
+ *   x[k+1] = A x[k] + B u[k] + w[k]
+ *   z[k] = H x[k] + v[k]
+ *
+ * where x are the n states, u the p control inputs, z the m measurements and w and v are white noises with covariances Q and R.
+ * Each cycle the GAM predicts the state estimate and its covariance P with the model and updates them with the measurements (see
+ * KalmanFilterStep). The covariance is updated in the Joseph form, which keeps it symmetric and positive definite, and the gain is
+ * computed with the Cholesky factor of the innovation covariance (i.e. without inverting it).
+ *
+ * For the common sizes (n, m) = (1, 1), (2, 1), (2, 2), (3, 1), (4, 2) and (6, 3) the step is a template specialised on the dimensions,
+ * which the compiler unrolls, and its work matrices are on the stack. Any other size uses the same step with the dimensions read at
+ * run-time and work matrices allocated in Setup. Execute never allocates memory.
+ *
+ * The GAM has the following input signals (float64):
+ *  - the m measurements z;
+ *  - the p control inputs u (only if the InputMatrix is set).
+ *
+ * and the following output signals (float64):
+ *  - the n states estimate x;
+ *  - the n diagonal elements of P, i.e. the variance of each state estimate (optional).
+ *
+ * If the innovation covariance is not positive definite (e.g. wrong noise covariances) the estimate is only predicted and Execute
+ * returns false.
+ *
+ * The configuration syntax is (names and signal quantities are only given as an example):
+ *
+ * <pre>
+ * +Kalman = {
+ *     Class = KalmanFilterGAM
+ *     StateMatrix = {{1.0 0.001} {0.0 1.0}} //Compulsory. A (n x n).
+ *     InputMatrix = {{0.0} {0.001}} //Optional. B (n x p).
+ *     MeasurementMatrix = {{1.0 0.0}} //Compulsory. H (m x n).
+ *     ProcessNoise = {{1e-8 0.0} {0.0 1e-4}} //Compulsory. Q (n x n).
+ *     MeasurementNoise = {{1e-2}} //Compulsory. R (m x m).
+ *     InitialState = {0.0 0.0} //Optional. Default = 0.
+ *     InitialCovariance = {{1.0 0.0} {0.0 1.0}} //Optional. Default = identity.
+ *     ResetInEachState = 1 //Optional. If 1 the estimate is reset to the initial one in each state change. Default = 0.
+ *     Kernel = Auto //Optional. Auto (the specialised step if there is one for the size of the model) or Dynamic. Default = Auto.
+ *     InputSignals = {
+ *         Position = {
+ *             DataSource = DDB1
+ *             Type = float64
+ *         }
+ *         Acceleration = {
+ *             DataSource = DDB1
+ *             Type = float64
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         State = {
+ *             DataSource = DDB1
+ *             Type = float64
+ *             NumberOfElements = 2
+ *         }
+ *         Variance = {
+ *             DataSource = DDB1
+ *             Type = float64
+ *             NumberOfElements = 2
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class KalmanFilterGAM: public GAM, public StatefulI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    KalmanFilterGAM();
+
+    /**
+     * @brief Frees the model and the work memory.
+     */
+    virtual ~KalmanFilterGAM();
+
+    /**
+     * @brief Reads the model and the initial estimate and selects the step.
+     * @return true if GAM::Initialise succeeds and all the matrices are set and have consistent dimensions.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals and allocates the work memory of the dynamic step.
+     * @return true if the signals are as described in the class description.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Predicts and updates the estimate and writes the outputs.
+     * @return true if the innovation covariance is positive definite.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Resets the estimate to the initial one if ResetInEachState = 1.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief Gets the number of states (n).
+     */
+    uint32 GetNumberOfStates() const;
+
+    /**
+     * @brief Gets the number of measurements (m).
+     */
+    uint32 GetNumberOfMeasurements() const;
+
+    /**
+     * @brief Returns true if the step is specialised on the dimensions of the model (valid after Initialise).
+     */
+    bool IsFixedSize() const;
+
+private:
+
+    /**
+     * @brief Reads a matrix.
+     * @param[in] data the configuration.
+     * @param[in] name the name of the matrix.
+     * @param[in,out] rows the expected number of rows or 0 to accept any (updated with the number of rows).
+     * @param[in,out] columns the expected number of columns or 0 to accept any (updated with the number of columns).
+     * @param[out] matrix the matrix coefficients (allocated).
+     * @return true if the matrix exists and has the expected dimensions.
+     */
+    bool ReadMatrix(StructuredDataI &data,
+                    const char8 * const name,
+                    uint32 &rows,
+                    uint32 &columns,
+                    float64 *&matrix);
+
+    /**
+     * @brief Verifies that a signal is float64 with the expected number of elements.
+     */
+    bool CheckSignal(const SignalDirection direction,
+                     const uint32 signalIdx,
+                     const uint32 numberOfElements);
+
+    /**
+     * @brief Copies the initial state and covariance to the estimate.
+     */
+    void ResetEstimate();
+
+    /**
+     * The model and the estimate.
+     */
+    KalmanFilterModel model;
+
+    /**
+     * The initial state.
+     */
+    float64 *initialState;
+
+    /**
+     * The initial covariance.
+     */
+    float64 *initialCovariance;
+
+    /**
+     * The work memory of the dynamic step (NULL for the fixed size steps).
+     */
+    float64 *work;
+
+    /**
+     * The step.
+     */
+    KalmanFilterStepFunction step;
+
+    /**
+     * True if the step is specialised on the dimensions of the model.
+     */
+    bool fixedSize;
+
+    /**
+     * True if the estimate is reset in each state change.
+     */
+    bool resetInEachState;
+
+    /**
+     * The measurements input signal.
+     */
+    const float64 *measurement;
+
+    /**
+     * The control inputs input signal (NULL if there is no InputMatrix).
+     */
+    const float64 *input;
+
+    /**
+     * The state estimate output signal.
+     */
+    float64 *stateOutput;
+
+    /**
+     * The variance output signal (NULL if not set).
+     */
+    float64 *varianceOutput;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* KALMANFILTERGAM_H_ */
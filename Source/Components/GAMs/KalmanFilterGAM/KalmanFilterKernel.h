@@ -0,0 +1,360 @@
+/**
+ * @file KalmanFilterKernel.h
+ * @brief Header file for the KalmanFilterGAM kernels
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the model and of the
+ * predict/update kernels of the KalmanFilterGAM. The kernels are templates and
+ * are thus defined on the header file.
+ */
+
+#ifndef KALMANFILTERKERNEL_H_
+#define KALMANFILTERKERNEL_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief The model and the estimate of a KalmanFilterGAM. All the matrices are stored by rows.
+ */
+struct KalmanFilterModel {
+    /**
+     * The number of states (n).
+     */
+    uint32 numberOfStates;
+
+    /**
+     * The number of measurements (m).
+     */
+    uint32 numberOfMeasurements;
+
+    /**
+     * The number of control inputs (p, 0 if there is no InputMatrix).
+     */
+    uint32 numberOfInputs;
+
+    /**
+     * The state matrix A (n x n).
+     */
+    float64 *stateMatrix;
+
+    /**
+     * The input matrix B (n x p).
+     */
+    float64 *inputMatrix;
+
+    /**
+     * The measurement matrix H (m x n).
+     */
+    float64 *measurementMatrix;
+
+    /**
+     * The process noise covariance Q (n x n).
+     */
+    float64 *processNoise;
+
+    /**
+     * The measurement noise covariance R (m x m).
+     */
+    float64 *measurementNoise;
+
+    /**
+     * The state estimate x (n).
+     */
+    float64 *state;
+
+    /**
+     * The covariance of the state estimate P (n x n).
+     */
+    float64 *covariance;
+};
+
+/**
+ * @brief Computes the number of float64 of the work memory of KalmanFilterStep (at compile time).
+ */
+template<uint32 N, uint32 M>
+struct KalmanFilterWorkSize {
+    static const uint32 value = (N + (4u * N * N)) + (M + (2u * N * M)) + (M * M);
+};
+
+/**
+ * @brief Computes the number of float64 of the work memory of KalmanFilterStep.
+ */
+inline uint32 KalmanFilterGetWorkSize(const uint32 n,
+                                      const uint32 m) {
+    return ((n + (4u * n * n)) + (m + (2u * n * m))) + (m * m);
+}
+
+/**
+ * @brief Predicts and updates the estimate of a Kalman filter.
+ * @details The prediction is x = A x + B u and P = A P A' + Q. The update computes the innovation covariance S = H P H' + R,
+ * its Cholesky factor (S is symmetric and positive definite) and the gain K = P H' inv(S), solving S K' = H P instead of inverting S.
+ * The covariance is updated in the Joseph form P = (I - K H) P (I - K H)' + K R K', which (unlike P = (I - K H) P) keeps P symmetric
+ * and positive definite with any gain and rounding, and is finally symmetrised.
+ *
+ * When N and M are not zero the dimensions of the model are the compile-time constants N and M: all the loop bounds are constant and
+ * the compiler unrolls and vectorises them. When they are zero the dimensions are read from the \a model.
+ * @param[in,out] model the model, the estimate is updated.
+ * @param[in] measurement the measurements z (m).
+ * @param[in] input the control inputs u (p, not used if numberOfInputs is zero).
+ * @param[in] work memory with KalmanFilterGetWorkSize(n, m) float64.
+ * @return false if S is not positive definite, in which case the estimate is only predicted.
+ */
+template<uint32 N, uint32 M>
+inline bool KalmanFilterStep(KalmanFilterModel &model,
+                             const float64 * const measurement,
+                             const float64 * const input,
+                             float64 * const work) {
+    const uint32 n = (N > 0u) ? (N) : (model.numberOfStates);
+    const uint32 m = (M > 0u) ? (M) : (model.numberOfMeasurements);
+    const uint32 p = model.numberOfInputs;
+    const float64 * const a = model.stateMatrix;
+    const float64 * const b = model.inputMatrix;
+    const float64 * const h = model.measurementMatrix;
+    const float64 * const q = model.processNoise;
+    const float64 * const r = model.measurementNoise;
+    float64 * const x = model.state;
+    float64 * const cov = model.covariance;
+
+    float64 * const xp = &work[0u];
+    float64 * const ap = &xp[n];
+    float64 * const pp = &ap[n * n];
+    float64 * const ikh = &pp[n * n];
+    float64 * const t = &ikh[n * n];
+    float64 * const y = &t[n * n];
+    //H P, overwritten with K' by the solution of S K' = H P.
+    float64 * const kt = &y[m];
+    //S, overwritten with its Cholesky factor.
+    float64 * const s = &kt[m * n];
+    float64 * const kr = &s[m * m];
+    uint32 i;
+    uint32 j;
+    uint32 k;
+
+    //Predict
+    for (i = 0u; i < n; i++) {
+        float64 acc = 0.0;
+        for (j = 0u; j < n; j++) {
+            acc += a[(i * n) + j] * x[j];
+        }
+        for (j = 0u; j < p; j++) {
+            acc += b[(i * p) + j] * input[j];
+        }
+        xp[i] = acc;
+    }
+    for (i = 0u; i < n; i++) {
+        for (j = 0u; j < n; j++) {
+            float64 acc = 0.0;
+            for (k = 0u; k < n; k++) {
+                acc += a[(i * n) + k] * cov[(k * n) + j];
+            }
+            ap[(i * n) + j] = acc;
+        }
+    }
+    for (i = 0u; i < n; i++) {
+        for (j = 0u; j < n; j++) {
+            float64 acc = q[(i * n) + j];
+            for (k = 0u; k < n; k++) {
+                acc += ap[(i * n) + k] * a[(j * n) + k];
+            }
+            pp[(i * n) + j] = acc;
+        }
+    }
+
+    //Innovation and its covariance
+    for (i = 0u; i < m; i++) {
+        float64 acc = measurement[i];
+        for (j = 0u; j < n; j++) {
+            acc -= h[(i * n) + j] * xp[j];
+        }
+        y[i] = acc;
+    }
+    for (i = 0u; i < m; i++) {
+        for (j = 0u; j < n; j++) {
+            float64 acc = 0.0;
+            for (k = 0u; k < n; k++) {
+                acc += h[(i * n) + k] * pp[(k * n) + j];
+            }
+            kt[(i * n) + j] = acc;
+        }
+    }
+    for (i = 0u; i < m; i++) {
+        for (j = 0u; j < m; j++) {
+            float64 acc = r[(i * m) + j];
+            for (k = 0u; k < n; k++) {
+                acc += kt[(i * n) + k] * h[(j * n) + k];
+            }
+            s[(i * m) + j] = acc;
+        }
+    }
+
+    //Cholesky factor S = L L' (L in the lower triangle of s)
+    bool ok = true;
+    for (j = 0u; (j < m) && (ok); j++) {
+        float64 diagonal = s[(j * m) + j];
+        for (k = 0u; k < j; k++) {
+            diagonal -= s[(j * m) + k] * s[(j * m) + k];
+        }
+        ok = (diagonal > 0.0);
+        if (ok) {
+            diagonal = sqrt(diagonal);
+            s[(j * m) + j] = diagonal;
+            for (i = j + 1u; i < m; i++) {
+                float64 acc = s[(i * m) + j];
+                for (k = 0u; k < j; k++) {
+                    acc -= s[(i * m) + k] * s[(j * m) + k];
+                }
+                s[(i * m) + j] = acc / diagonal;
+            }
+        }
+    }
+
+    if (ok) {
+        //Solve L L' K' = H P, column by column
+        for (j = 0u; j < n; j++) {
+            for (i = 0u; i < m; i++) {
+                float64 acc = kt[(i * n) + j];
+                for (k = 0u; k < i; k++) {
+                    acc -= s[(i * m) + k] * kt[(k * n) + j];
+                }
+                kt[(i * n) + j] = acc / s[(i * m) + i];
+            }
+            for (i = m; i > 0u; i--) {
+                uint32 row = i - 1u;
+                float64 acc = kt[(row * n) + j];
+                for (k = i; k < m; k++) {
+                    acc -= s[(k * m) + row] * kt[(k * n) + j];
+                }
+                kt[(row * n) + j] = acc / s[(row * m) + row];
+            }
+        }
+
+        //Update
+        for (i = 0u; i < n; i++) {
+            float64 acc = xp[i];
+            for (k = 0u; k < m; k++) {
+                acc += kt[(k * n) + i] * y[k];
+            }
+            x[i] = acc;
+        }
+        for (i = 0u; i < n; i++) {
+            for (j = 0u; j < n; j++) {
+                float64 acc = (i == j) ? (1.0) : (0.0);
+                for (k = 0u; k < m; k++) {
+                    acc -= kt[(k * n) + i] * h[(k * n) + j];
+                }
+                ikh[(i * n) + j] = acc;
+            }
+        }
+        for (i = 0u; i < n; i++) {
+            for (j = 0u; j < n; j++) {
+                float64 acc = 0.0;
+                for (k = 0u; k < n; k++) {
+                    acc += ikh[(i * n) + k] * pp[(k * n) + j];
+                }
+                t[(i * n) + j] = acc;
+            }
+        }
+        for (i = 0u; i < n; i++) {
+            for (j = 0u; j < m; j++) {
+                float64 acc = 0.0;
+                for (k = 0u; k < m; k++) {
+                    acc += kt[(k * n) + i] * r[(k * m) + j];
+                }
+                kr[(i * m) + j] = acc;
+            }
+        }
+        for (i = 0u; i < n; i++) {
+            for (j = 0u; j < n; j++) {
+                float64 acc = 0.0;
+                for (k = 0u; k < n; k++) {
+                    acc += t[(i * n) + k] * ikh[(j * n) + k];
+                }
+                for (k = 0u; k < m; k++) {
+                    acc += kr[(i * m) + k] * kt[(k * n) + j];
+                }
+                cov[(i * n) + j] = acc;
+            }
+        }
+        for (i = 0u; i < n; i++) {
+            for (j = i + 1u; j < n; j++) {
+                float64 mean = 0.5 * (cov[(i * n) + j] + cov[(j * n) + i]);
+                cov[(i * n) + j] = mean;
+                cov[(j * n) + i] = mean;
+            }
+        }
+    }
+    else {
+        for (i = 0u; i < n; i++) {
+            x[i] = xp[i];
+        }
+        for (i = 0u; i < (n * n); i++) {
+            cov[i] = pp[i];
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief A predict/update step of a Kalman filter (see KalmanFilterStep).
+ */
+typedef bool (*KalmanFilterStepFunction)(KalmanFilterModel &model,
+                                         const float64 * const measurement,
+                                         const float64 * const input,
+                                         float64 * const work);
+
+/**
+ * @brief The step of a model with N states and M measurements, with the work memory on the stack (i.e. \a work is not used).
+ */
+/*lint -e{715} work is not referenced as the work memory is on the stack.*/
+template<uint32 N, uint32 M>
+bool KalmanFilterFixedStep(KalmanFilterModel &model,
+                           const float64 * const measurement,
+                           const float64 * const input,
+                           float64 * const work) {
+    float64 stackWork[KalmanFilterWorkSize<N, M>::value];
+    return KalmanFilterStep<N, M>(model, measurement, input, &stackWork[0]);
+}
+
+/**
+ * @brief The step of a model with any number of states and measurements, with the work memory in \a work.
+ */
+inline bool KalmanFilterDynamicStep(KalmanFilterModel &model,
+                                    const float64 * const measurement,
+                                    const float64 * const input,
+                                    float64 * const work) {
+    return KalmanFilterStep<0u, 0u>(model, measurement, input, work);
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* KALMANFILTERKERNEL_H_ */
@@ -0,0 +1,373 @@
+/**
+ * @file LockInGAM.cpp
+ * @brief Source file for class LockInGAM
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LockInGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "FastMath.h"
+#include "LockInGAM.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+/**
+ * Maximum number of cascaded single pole filters.
+ */
+const MARTe::uint32 lockInMaxFilterOrder = 8u;
+
+/**
+ * @brief Checks if the type of an input signal is supported.
+ */
+bool IsSupportedInputType(const MARTe::TypeDescriptor &type) {
+    using namespace MARTe;
+    return ((type == SignedInteger16Bit) || (type == UnsignedInteger16Bit) || (type == SignedInteger32Bit) || (type == UnsignedInteger32Bit)
+            || (type == Float32Bit) || (type == Float64Bit));
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+LockInGAM::LockInGAM() :
+        GAM() {
+    phaseIncrement = 0.;
+    initialPhase = 0.;
+    phase = 0.;
+    filterGain = 0.;
+    filterOrder = 1u;
+    decimation = 0u;
+    inPhaseQuadrature = false;
+    numberOfChannels = 0u;
+    numberOfSamples = 0u;
+    referenceCos = NULL_PTR(float64 *);
+    referenceSin = NULL_PTR(float64 *);
+    filterStates = NULL_PTR(float64 *);
+    inputTypes = NULL_PTR(TypeDescriptor *);
+    inputSignals = NULL_PTR(void **);
+    float32Output = false;
+    outputSignals = NULL_PTR(void **);
+}
+
+LockInGAM::~LockInGAM() {
+    if (referenceCos != NULL_PTR(float64 *)) {
+        delete[] referenceCos;
+    }
+    if (referenceSin != NULL_PTR(float64 *)) {
+        delete[] referenceSin;
+    }
+    if (filterStates != NULL_PTR(float64 *)) {
+        delete[] filterStates;
+    }
+    if (inputTypes != NULL_PTR(TypeDescriptor *)) {
+        delete[] inputTypes;
+    }
+    if (inputSignals != NULL_PTR(void **)) {
+        delete[] inputSignals;
+    }
+    if (outputSignals != NULL_PTR(void **)) {
+        delete[] outputSignals;
+    }
+}
+
+bool LockInGAM::Initialise(StructuredDataI &data) {
+    bool ok = GAM::Initialise(data);
+    float64 samplingFrequency = 0.;
+    float64 frequency = 0.;
+    float64 cutOffFrequency = 0.;
+    if (ok) {
+        ok = data.Read("SamplingFrequency", samplingFrequency);
+        if (ok) {
+            ok = (samplingFrequency > 0.);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "SamplingFrequency shall be specified and > 0");
+        }
+    }
+    if (ok) {
+        ok = data.Read("Frequency", frequency);
+        if (ok) {
+            ok = ((frequency > 0.) && (frequency < (samplingFrequency / 2.0)));
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Frequency shall be specified, > 0 and < SamplingFrequency / 2");
+        }
+    }
+    if (ok) {
+        ok = data.Read("CutOffFrequency", cutOffFrequency);
+        if (ok) {
+            ok = ((cutOffFrequency > 0.) && (cutOffFrequency < (samplingFrequency / 2.0)));
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "CutOffFrequency shall be specified, > 0 and < SamplingFrequency / 2");
+        }
+    }
+    if (ok) {
+        if (!data.Read("Phase", initialPhase)) {
+            initialPhase = 0.;
+        }
+        if (!data.Read("FilterOrder", filterOrder)) {
+            filterOrder = 1u;
+        }
+        ok = ((filterOrder > 0u) && (filterOrder <= lockInMaxFilterOrder));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "FilterOrder shall be between 1 and %u", lockInMaxFilterOrder);
+        }
+    }
+    if (ok) {
+        if (!data.Read("Decimation", decimation)) {
+            decimation = 0u;
+        }
+        StreamString outputName;
+        if (data.Read("Output", outputName)) {
+            if (outputName == "InPhaseQuadrature") {
+                inPhaseQuadrature = true;
+            }
+            else if (outputName == "AmplitudePhase") {
+                inPhaseQuadrature = false;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for Output (expected values AmplitudePhase or InPhaseQuadrature)");
+                ok = false;
+            }
+        }
+    }
+    if (ok) {
+        AnyType methodType = data.GetType("Method");
+        if (methodType.GetDataPointer() != NULL) {
+            ok = oscillator.Initialise(data);
+        }
+        else {
+            ConfigurationDatabase oscillatorConfig;
+            ok = oscillatorConfig.Write("Method", "Recurrence");
+            if (ok) {
+                ok = oscillator.Initialise(oscillatorConfig);
+            }
+        }
+    }
+    if (ok) {
+        phaseIncrement = (2.0 * FastMath::PI * frequency) / samplingFrequency;
+        filterGain = 1.0 - exp((-2.0 * FastMath::PI * cutOffFrequency) / samplingFrequency);
+    }
+    return ok;
+}
+
+bool LockInGAM::Setup() {
+    numberOfChannels = GetNumberOfInputSignals();
+    bool ok = (numberOfChannels > 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "At least one input signal shall be specified");
+    }
+    if (ok) {
+        ok = (GetNumberOfOutputSignals() == (2u * numberOfChannels));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The number of output signals shall be %u", (2u * numberOfChannels));
+        }
+    }
+    if (ok) {
+        inputTypes = new TypeDescriptor[numberOfChannels];
+        inputSignals = new void*[numberOfChannels];
+    }
+    for (uint32 i = 0u; (i < numberOfChannels) && (ok); i++) {
+        inputTypes[i] = GetSignalType(InputSignals, i);
+        ok = IsSupportedInputType(inputTypes[i]);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The type of the input signal %u shall be int16, uint16, int32, uint32, float32 or float64", i);
+        }
+        uint32 numberOfElements = 0u;
+        uint32 numberOfSignalSamples = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(InputSignals, i, numberOfElements);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(InputSignals, i, numberOfSignalSamples);
+        }
+        if (ok) {
+            uint32 channelSamples = numberOfElements * numberOfSignalSamples;
+            if (i == 0u) {
+                numberOfSamples = channelSamples;
+            }
+            ok = ((channelSamples > 0u) && (channelSamples == numberOfSamples));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "All the input signals shall have the same (> 0) NumberOfElements * NumberOfSamples");
+            }
+        }
+        if (ok) {
+            inputSignals[i] = GetInputSignalMemory(i);
+        }
+    }
+    if (ok) {
+        if (decimation == 0u) {
+            decimation = numberOfSamples;
+        }
+        ok = ((numberOfSamples % decimation) == 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Decimation (%u) shall divide the number of samples per cycle (%u)", decimation, numberOfSamples);
+        }
+    }
+    if (ok) {
+        outputSignals = new void*[2u * numberOfChannels];
+    }
+    uint32 numberOfOutputElements = (decimation > 0u) ? (numberOfSamples / decimation) : (0u);
+    for (uint32 i = 0u; (i < (2u * numberOfChannels)) && (ok); i++) {
+        TypeDescriptor outputType = GetSignalType(OutputSignals, i);
+        ok = ((outputType == Float32Bit) || (outputType == Float64Bit));
+        if (ok) {
+            if (i == 0u) {
+                float32Output = (outputType == Float32Bit);
+            }
+            ok = ((outputType == Float32Bit) == float32Output);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "All the output signals shall be float32 or float64");
+        }
+        uint32 numberOfElements = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(OutputSignals, i, numberOfElements);
+        }
+        if (ok) {
+            ok = (numberOfElements == numberOfOutputElements);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The output signal %u shall have %u elements", i, numberOfOutputElements);
+            }
+        }
+        if (ok) {
+            outputSignals[i] = GetOutputSignalMemory(i);
+        }
+    }
+    if (ok) {
+        referenceCos = new float64[numberOfSamples];
+        referenceSin = new float64[numberOfSamples];
+        filterStates = new float64[2u * filterOrder * numberOfChannels];
+        for (uint32 n = 0u; n < (2u * filterOrder * numberOfChannels); n++) {
+            filterStates[n] = 0.;
+        }
+        phase = initialPhase - ((2.0 * FastMath::PI) * floor(initialPhase / (2.0 * FastMath::PI)));
+    }
+    return ok;
+}
+
+bool LockInGAM::Execute() {
+    /*lint -e{613} the buffers cannot be NULL as Execute is only called after a successful Setup*/
+    if (oscillator.GetMethod() == WaveformOscillatorMethodDirect) {
+        for (uint32 n = 0u; n < numberOfSamples; n++) {
+            float64 samplePhase = phase + (static_cast<float64>(n) * phaseIncrement);
+            referenceCos[n] = cos(samplePhase);
+            referenceSin[n] = sin(samplePhase);
+        }
+    }
+    else {
+        oscillator.Generate(referenceSin, numberOfSamples, phase, phaseIncrement, 0., 1., 0.);
+        oscillator.Generate(referenceCos, numberOfSamples, phase + (FastMath::PI / 2.0), phaseIncrement, 0., 1., 0.);
+    }
+    phase += static_cast<float64>(numberOfSamples) * phaseIncrement;
+    phase -= (2.0 * FastMath::PI) * floor(phase / (2.0 * FastMath::PI));
+
+    /*lint -e{613} the buffers cannot be NULL as Execute is only called after a successful Setup*/
+    for (uint32 c = 0u; c < numberOfChannels; c++) {
+        if (inputTypes[c] == SignedInteger16Bit) {
+            Demodulate<int16>(c, static_cast<int16 *>(inputSignals[c]));
+        }
+        else if (inputTypes[c] == UnsignedInteger16Bit) {
+            Demodulate<uint16>(c, static_cast<uint16 *>(inputSignals[c]));
+        }
+        else if (inputTypes[c] == SignedInteger32Bit) {
+            Demodulate<int32>(c, static_cast<int32 *>(inputSignals[c]));
+        }
+        else if (inputTypes[c] == UnsignedInteger32Bit) {
+            Demodulate<uint32>(c, static_cast<uint32 *>(inputSignals[c]));
+        }
+        else if (inputTypes[c] == Float32Bit) {
+            Demodulate<float32>(c, static_cast<float32 *>(inputSignals[c]));
+        }
+        else {
+            Demodulate<float64>(c, static_cast<float64 *>(inputSignals[c]));
+        }
+    }
+    return true;
+}
+
+template<typename T>
+void LockInGAM::Demodulate(const uint32 channel,
+                           const T * const input) {
+    /*lint -e{613} the buffers cannot be NULL as Demodulate is only called after a successful Setup*/
+    float64 *inPhaseStates = &filterStates[2u * filterOrder * channel];
+    float64 *quadratureStates = &inPhaseStates[filterOrder];
+    uint32 outputIdx = 0u;
+    uint32 decimationCounter = 0u;
+    for (uint32 n = 0u; n < numberOfSamples; n++) {
+        float64 x = static_cast<float64>(input[n]);
+        float64 inPhase = x * referenceCos[n];
+        float64 quadrature = x * referenceSin[n];
+        for (uint32 o = 0u; o < filterOrder; o++) {
+            inPhaseStates[o] += filterGain * (inPhase - inPhaseStates[o]);
+            quadratureStates[o] += filterGain * (quadrature - quadratureStates[o]);
+            inPhase = inPhaseStates[o];
+            quadrature = quadratureStates[o];
+        }
+        decimationCounter++;
+        if (decimationCounter == decimation) {
+            decimationCounter = 0u;
+            /* x * cos = A / 2 * cos(phi) and x * sin = -A / 2 * sin(phi) after the low-pass filter */
+            float64 valueX = 2.0 * inPhase;
+            float64 valueY = -2.0 * quadrature;
+            if (inPhaseQuadrature) {
+                WriteOutput(2u * channel, outputIdx, valueX);
+                WriteOutput((2u * channel) + 1u, outputIdx, valueY);
+            }
+            else {
+                WriteOutput(2u * channel, outputIdx, sqrt((valueX * valueX) + (valueY * valueY)));
+                WriteOutput((2u * channel) + 1u, outputIdx, atan2(valueY, valueX));
+            }
+            outputIdx++;
+        }
+    }
+}
+
+float64 LockInGAM::GetFilterGain() const {
+    return filterGain;
+}
+
+uint32 LockInGAM::GetFilterOrder() const {
+    return filterOrder;
+}
+
+uint32 LockInGAM::GetDecimation() const {
+    return decimation;
+}
+
+CLASS_REGISTER(LockInGAM, "1.0")
+
+}
@@ -0,0 +1,271 @@
+/**
+ * @file LockInGAM.h
+ * @brief Header file for class LockInGAM
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class LockInGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LOCKINGAM_H_
+#define LOCKINGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+#include "WaveformOscillator.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief GAM which demodulates N channels against an internally generated reference (lock-in amplifier).
+ * @details Each input signal is a channel sampled at SamplingFrequency and each cycle provides NumberOfElements * NumberOfSamples
+ * new samples (the same for all the channels). For each sample n the GAM computes the quadrature reference
+ *
+ * \f$
+ * c[n] = cos(2 * pi * Frequency * n / SamplingFrequency + Phase), s[n] = sin(2 * pi * Frequency * n / SamplingFrequency + Phase)
+ * \f$
+ *
+ * (continuous across cycles), mixes each channel with c[n] and s[n] and low-pass filters the two products with FilterOrder cascaded
+ * single pole filters with cut-off frequency CutOffFrequency. For x[n] = A * cos(2 * pi * Frequency * n / SamplingFrequency + Phase + phi)
+ * the filtered in-phase and quadrature components converge to X = A * cos(phi) and Y = A * sin(phi).
+ *
+ * The reference of each cycle is computed once for all the channels with the WaveformOscillator (see the Method parameter, the
+ * default being Recurrence) and then the mixing, the filtering and the decimation of each channel are performed in a single loop,
+ * without intermediate signals.
+ *
+ * The outputs are written every Decimation samples, i.e. each output signal has (NumberOfElements * NumberOfSamples) / Decimation elements.
+ * Each channel has two output signals (in this order): the amplitude sqrt(X^2 + Y^2) and the phase atan2(Y, X) (in radians) with
+ * Output = AmplitudePhase, or X and Y with Output = InPhaseQuadrature.
+ *
+ * The filters and the reference phase are reset when the GAM is setup.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +LockIn = {
+ *     Class = LockInGAM
+ *     SamplingFrequency = 1e6 //Compulsory. In Hz.
+ *     Frequency = 10e3 //Compulsory. Frequency of the reference in Hz (> 0 and < SamplingFrequency / 2).
+ *     Phase = 0 //Optional. Phase of the reference in radians. Default = 0.
+ *     CutOffFrequency = 100 //Compulsory. Cut-off frequency of each low-pass filter in Hz (> 0 and < SamplingFrequency / 2).
+ *     FilterOrder = 2 //Optional. Number of cascaded single pole filters (1 to 8). Default = 1.
+ *     Decimation = 100 //Optional. Number of input samples per output sample. Shall divide the number of samples per cycle.
+ *                      //Default = number of samples per cycle.
+ *     Output = AmplitudePhase //Optional. AmplitudePhase (default) or InPhaseQuadrature.
+ *     Method = Recurrence //Optional. Direct, Table or Recurrence (default). See WaveformOscillator.
+ *     InputSignals = {
+ *         Probe0 = {
+ *             DataSource = "ADCs"
+ *             Type = float32 //Supported types: int16, uint16, int32, uint32, float32 and float64.
+ *             NumberOfElements = 1000 //The same for all the channels.
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Probe0Amplitude = {
+ *             DataSource = "DDB1"
+ *             Type = float32 //float32 or float64 (the same for all the output signals).
+ *             NumberOfElements = 10 //1000 / Decimation
+ *         }
+ *         Probe0Phase = {
+ *             DataSource = "DDB1"
+ *             Type = float32
+ *             NumberOfElements = 10
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class LockInGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    LockInGAM();
+
+    /**
+     * @brief Destructor. Frees the reference and the filter states.
+     */
+    virtual ~LockInGAM();
+
+    /**
+     * @brief Reads the parameters specified in the class description.
+     * @param[in] data the GAM configuration.
+     * @return true if all the parameters are valid.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals and allocates the reference and the filter states.
+     * @return true if the signals are those specified in the class description and Decimation is valid.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Computes the reference of the cycle and demodulates all the channels.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Gets the gain of each single pole filter.
+     * @return 1 - exp(-2 * pi * CutOffFrequency / SamplingFrequency).
+     */
+    float64 GetFilterGain() const;
+
+    /**
+     * @brief Gets the number of cascaded single pole filters.
+     * @return the number of cascaded single pole filters.
+     */
+    uint32 GetFilterOrder() const;
+
+    /**
+     * @brief Gets the number of input samples per output sample.
+     * @return the number of input samples per output sample.
+     */
+    uint32 GetDecimation() const;
+
+private:
+
+    /**
+     * @brief Mixes, filters and decimates a channel.
+     * @param[in] channel the channel.
+     * @param[in] input the samples of the channel.
+     */
+    template<typename T>
+    void Demodulate(const uint32 channel,
+                    const T * const input);
+
+    /**
+     * @brief Writes a value in an output signal.
+     * @param[in] signalIdx the index of the output signal.
+     * @param[in] index the index of the element.
+     * @param[in] value the value to write.
+     */
+    inline void WriteOutput(const uint32 signalIdx,
+                            const uint32 index,
+                            const float64 value);
+
+    /**
+     * The generator of the reference.
+     */
+    WaveformOscillator oscillator;
+
+    /**
+     * The phase increment of the reference between two samples (radians).
+     */
+    float64 phaseIncrement;
+
+    /**
+     * The initial phase of the reference (radians).
+     */
+    float64 initialPhase;
+
+    /**
+     * The phase of the reference for the first sample of the next cycle, in [0, 2 * pi[.
+     */
+    float64 phase;
+
+    /**
+     * The gain of each single pole filter.
+     */
+    float64 filterGain;
+
+    /**
+     * The number of cascaded single pole filters.
+     */
+    uint32 filterOrder;
+
+    /**
+     * The number of input samples per output sample (0 until Setup if not configured).
+     */
+    uint32 decimation;
+
+    /**
+     * True if Output = InPhaseQuadrature.
+     */
+    bool inPhaseQuadrature;
+
+    /**
+     * The number of channels (input signals).
+     */
+    uint32 numberOfChannels;
+
+    /**
+     * The number of new samples per cycle of each channel.
+     */
+    uint32 numberOfSamples;
+
+    /**
+     * The cos and sin of the reference for each sample of the cycle.
+     */
+    float64 *referenceCos;
+    float64 *referenceSin;
+
+    /**
+     * The state of the filters (for each channel, filterOrder in-phase states followed by filterOrder quadrature states).
+     */
+    float64 *filterStates;
+
+    /**
+     * The type and the memory of each input signal.
+     */
+    TypeDescriptor *inputTypes;
+    void **inputSignals;
+
+    /**
+     * True if the output signals are float32 (float64 otherwise).
+     */
+    bool float32Output;
+
+    /**
+     * The memory of each output signal.
+     */
+    void **outputSignals;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+void LockInGAM::WriteOutput(const uint32 signalIdx,
+                            const uint32 index,
+                            const float64 value) {
+    if (float32Output) {
+        static_cast<float32 *>(outputSignals[signalIdx])[index] = static_cast<float32>(value);
+    }
+    else {
+        static_cast<float64 *>(outputSignals[signalIdx])[index] = value;
+    }
+}
+
+}
+
+#endif /* LOCKINGAM_H_ */
@@ -0,0 +1,491 @@
+/**
+ * @file LookupTableGAM.cpp
+ * @brief Source file for class LookupTableGAM
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LookupTableGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BasicFile.h"
+#include "LookupTableGAM.h"
+#include "MemoryOperationsHelper.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+/**
+ * Size of the signal names in the header of the FileReader binary files.
+ */
+const MARTe::uint32 lookupTableSignalNameSize = 32u;
+
+/**
+ * @brief Reads the next signal of a FileReader binary file in a float64 array.
+ */
+bool ReadFileSignal(MARTe::BasicFile &file,
+                    const MARTe::TypeDescriptor &type,
+                    MARTe::float64 * const values,
+                    const MARTe::uint32 numberOfValues) {
+    using namespace MARTe;
+    bool ok = true;
+    for (uint32 i = 0u; (i < numberOfValues) && (ok); i++) {
+        if (type == Float32Bit) {
+            float32 value = 0.F;
+            uint32 readSize = static_cast<uint32>(sizeof(float32));
+            /*lint -e{928} [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+            ok = file.Read(reinterpret_cast<char8 *>(&value), readSize);
+            if (ok) {
+                ok = (readSize == static_cast<uint32>(sizeof(float32)));
+            }
+            values[i] = static_cast<float64>(value);
+        }
+        else {
+            uint32 readSize = static_cast<uint32>(sizeof(float64));
+            /*lint -e{928} [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+            ok = file.Read(reinterpret_cast<char8 *>(&values[i]), readSize);
+            if (ok) {
+                ok = (readSize == static_cast<uint32>(sizeof(float64)));
+            }
+        }
+    }
+    return ok;
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+LookupTableGAM::LookupTableGAM() :
+        GAM() {
+    numberOfDimensions = 0u;
+    breakpoints1 = NULL_PTR(float64 *);
+    inverseSpacings1 = NULL_PTR(float64 *);
+    numberOfBreakpoints1 = 0u;
+    breakpoints2 = NULL_PTR(float64 *);
+    inverseSpacings2 = NULL_PTR(float64 *);
+    numberOfBreakpoints2 = 0u;
+    table = NULL_PTR(float64 *);
+    linearExtrapolation = false;
+    numberOfElements = 0u;
+    inputType = Float64Bit;
+    float32Output = false;
+    inputX = NULL_PTR(void *);
+    inputY = NULL_PTR(void *);
+    output = NULL_PTR(void *);
+    cells1 = NULL_PTR(uint32 *);
+    cells2 = NULL_PTR(uint32 *);
+    numberOfSearches = 0u;
+}
+
+/*lint -e{1551} the destructor must guarantee that the memory is freed.*/
+LookupTableGAM::~LookupTableGAM() {
+    if (breakpoints1 != NULL_PTR(float64 *)) {
+        delete[] breakpoints1;
+    }
+    if (inverseSpacings1 != NULL_PTR(float64 *)) {
+        delete[] inverseSpacings1;
+    }
+    if (breakpoints2 != NULL_PTR(float64 *)) {
+        delete[] breakpoints2;
+    }
+    if (inverseSpacings2 != NULL_PTR(float64 *)) {
+        delete[] inverseSpacings2;
+    }
+    if (table != NULL_PTR(float64 *)) {
+        delete[] table;
+    }
+    if (cells1 != NULL_PTR(uint32 *)) {
+        delete[] cells1;
+    }
+    if (cells2 != NULL_PTR(uint32 *)) {
+        delete[] cells2;
+    }
+    inputX = NULL_PTR(void *);
+    inputY = NULL_PTR(void *);
+    output = NULL_PTR(void *);
+}
+
+bool LookupTableGAM::Initialise(StructuredDataI &data) {
+    bool ok = GAM::Initialise(data);
+    StreamString filename;
+    if (ok) {
+        if (data.Read("Filename", filename)) {
+            ok = ReadFile(filename.Buffer());
+        }
+        else {
+            uint32 numberOfValues = 0u;
+            ok = ReadArray(data, "Breakpoints1", breakpoints1, numberOfBreakpoints1);
+            if ((ok) && (!data.GetType("Breakpoints2").IsVoid())) {
+                ok = ReadArray(data, "Breakpoints2", breakpoints2, numberOfBreakpoints2);
+            }
+            if (ok) {
+                ok = ReadArray(data, "Table", table, numberOfValues);
+            }
+            if (ok) {
+                uint32 expectedValues = (numberOfBreakpoints2 > 0u) ? (numberOfBreakpoints1 * numberOfBreakpoints2) : (numberOfBreakpoints1);
+                ok = (numberOfValues == expectedValues);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The Table shall have %u values and has %u", expectedValues, numberOfValues);
+                }
+            }
+        }
+    }
+    if (ok) {
+        numberOfDimensions = (numberOfBreakpoints2 > 0u) ? (2u) : (1u);
+        ok = PrepareBreakpoints("Breakpoints1", breakpoints1, numberOfBreakpoints1, inverseSpacings1);
+    }
+    if ((ok) && (numberOfDimensions == 2u)) {
+        ok = PrepareBreakpoints("Breakpoints2", breakpoints2, numberOfBreakpoints2, inverseSpacings2);
+    }
+    if (ok) {
+        StreamString extrapolation;
+        if (data.Read("Extrapolation", extrapolation)) {
+            if (extrapolation == "Linear") {
+                linearExtrapolation = true;
+            }
+            else if (extrapolation == "Clip") {
+                linearExtrapolation = false;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Extrapolation shall be Clip or Linear");
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+bool LookupTableGAM::Setup() {
+    bool ok = (GetNumberOfInputSignals() == numberOfDimensions);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "The number of input signals shall be equal to the number of dimensions of the table (%u)",
+                     numberOfDimensions);
+    }
+    if (ok) {
+        ok = (GetNumberOfOutputSignals() == 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "One output signal shall be specified");
+        }
+    }
+    if (ok) {
+        inputType = GetSignalType(InputSignals, 0u);
+        ok = ((inputType == Float32Bit) || (inputType == Float64Bit));
+        if ((ok) && (numberOfDimensions == 2u)) {
+            ok = (GetSignalType(InputSignals, 1u) == inputType);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The input signals shall be float32 or float64 and have the same type");
+        }
+    }
+    if (ok) {
+        TypeDescriptor outputType = GetSignalType(OutputSignals, 0u);
+        ok = ((outputType == Float32Bit) || (outputType == Float64Bit));
+        float32Output = (outputType == Float32Bit);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The output signal shall be float32 or float64");
+        }
+    }
+    for (uint32 i = 0u; (i <= numberOfDimensions) && (ok); i++) {
+        SignalDirection direction = (i < numberOfDimensions) ? (InputSignals) : (OutputSignals);
+        uint32 signalIdx = (i < numberOfDimensions) ? (i) : (0u);
+        uint32 signalElements = 0u;
+        uint32 signalSamples = 0u;
+        ok = GetSignalNumberOfElements(direction, signalIdx, signalElements);
+        if (ok) {
+            ok = GetSignalNumberOfSamples(direction, signalIdx, signalSamples);
+        }
+        if (ok) {
+            if (i == 0u) {
+                numberOfElements = (signalElements * signalSamples);
+            }
+            ok = ((numberOfElements > 0u) && ((signalElements * signalSamples) == numberOfElements));
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "All the signals shall have the same (> 0) NumberOfElements * NumberOfSamples");
+        }
+    }
+    if (ok) {
+        inputX = GetInputSignalMemory(0u);
+        if (numberOfDimensions == 2u) {
+            inputY = GetInputSignalMemory(1u);
+            cells2 = new uint32[numberOfElements];
+        }
+        output = GetOutputSignalMemory(0u);
+        cells1 = new uint32[numberOfElements];
+        for (uint32 i = 0u; i < numberOfElements; i++) {
+            cells1[i] = 0u;
+            if (cells2 != NULL_PTR(uint32 *)) {
+                cells2[i] = 0u;
+            }
+        }
+    }
+    return ok;
+}
+
+bool LookupTableGAM::Execute() {
+    if (inputType == Float32Bit) {
+        Interpolate<float32>();
+    }
+    else {
+        Interpolate<float64>();
+    }
+    return true;
+}
+
+uint32 LookupTableGAM::GetNumberOfDimensions() const {
+    return numberOfDimensions;
+}
+
+uint32 LookupTableGAM::GetNumberOfSearches() const {
+    return numberOfSearches;
+}
+
+bool LookupTableGAM::ReadArray(StructuredDataI &data,
+                               const char8 * const name,
+                               float64 *&values,
+                               uint32 &numberOfValues) {
+    AnyType arrayDescription = data.GetType(name);
+    bool ok = !arrayDescription.IsVoid();
+    if (ok) {
+        numberOfValues = arrayDescription.GetNumberOfElements(0u);
+        ok = (numberOfValues > 0u);
+    }
+    if (ok) {
+        values = new float64[numberOfValues];
+        Vector<float64> valuesVector(values, numberOfValues);
+        ok = data.Read(name, valuesVector);
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not read %s", name);
+    }
+    return ok;
+}
+
+bool LookupTableGAM::ReadFile(const char8 * const filename) {
+    BasicFile file;
+    bool ok = file.Open(filename, BasicFile::ACCESS_MODE_R);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Could not open the file %s", filename);
+    }
+    uint32 numberOfSignals = 0u;
+    if (ok) {
+        uint32 readSize = static_cast<uint32>(sizeof(uint32));
+        /*lint -e{928} [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+        ok = file.Read(reinterpret_cast<char8 *>(&numberOfSignals), readSize);
+        if (ok) {
+            ok = (numberOfSignals > 0u);
+        }
+    }
+    TypeDescriptor *types = NULL_PTR(TypeDescriptor *);
+    uint32 *sizes = NULL_PTR(uint32 *);
+    //0 => Breakpoints1, 1 => Breakpoints2, 2 => Table, 3 => other
+    uint32 *roles = NULL_PTR(uint32 *);
+    if (ok) {
+        types = new TypeDescriptor[numberOfSignals];
+        sizes = new uint32[numberOfSignals];
+        roles = new uint32[numberOfSignals];
+    }
+    //Header
+    for (uint32 n = 0u; (n < numberOfSignals) && (ok); n++) {
+        uint32 readSize = static_cast<uint32>(sizeof(uint16));
+        /*lint -e{928} [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+        ok = file.Read(reinterpret_cast<char8 *>(&types[n].all), readSize);
+        char8 signalName[lookupTableSignalNameSize + 1u];
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(&signalName[0], '\0', lookupTableSignalNameSize + 1u);
+        }
+        if (ok) {
+            readSize = lookupTableSignalNameSize;
+            ok = file.Read(&signalName[0], readSize);
+        }
+        if (ok) {
+            readSize = static_cast<uint32>(sizeof(uint32));
+            /*lint -e{928} [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+            ok = file.Read(reinterpret_cast<char8 *>(&sizes[n]), readSize);
+        }
+        if (ok) {
+            roles[n] = 3u;
+            if (StringHelper::Compare(&signalName[0], "Breakpoints1") == 0) {
+                roles[n] = 0u;
+                numberOfBreakpoints1 = sizes[n];
+            }
+            else if (StringHelper::Compare(&signalName[0], "Breakpoints2") == 0) {
+                roles[n] = 1u;
+                numberOfBreakpoints2 = sizes[n];
+            }
+            else if (StringHelper::Compare(&signalName[0], "Table") == 0) {
+                roles[n] = 2u;
+            }
+            else {
+                //Ignored signal.
+            }
+            if (roles[n] != 3u) {
+                ok = ((types[n] == Float32Bit) || (types[n] == Float64Bit));
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The signal %s of the file %s shall be float32 or float64", &signalName[0], filename);
+                }
+            }
+        }
+    }
+    uint32 expectedValues = (numberOfBreakpoints2 > 0u) ? (numberOfBreakpoints1 * numberOfBreakpoints2) : (numberOfBreakpoints1);
+    if (ok) {
+        ok = (numberOfBreakpoints1 > 0u);
+        for (uint32 n = 0u; (n < numberOfSignals) && (ok); n++) {
+            if (roles[n] == 2u) {
+                ok = (sizes[n] == expectedValues);
+                expectedValues = 0u;
+            }
+        }
+        if (ok) {
+            ok = (expectedValues == 0u);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The file %s shall have the signals Breakpoints1 and Table (and optionally Breakpoints2), "
+                         "with one value of the Table for each point of the grid", filename);
+        }
+    }
+    //First cycle
+    for (uint32 n = 0u; (n < numberOfSignals) && (ok); n++) {
+        float64 *values = new float64[sizes[n]];
+        ok = ReadFileSignal(file, types[n], values, sizes[n]);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Could not read the data of the file %s", filename);
+        }
+        if ((ok) && (roles[n] == 0u)) {
+            breakpoints1 = values;
+        }
+        else if ((ok) && (roles[n] == 1u)) {
+            breakpoints2 = values;
+        }
+        else if ((ok) && (roles[n] == 2u)) {
+            table = values;
+        }
+        else {
+            delete[] values;
+        }
+    }
+    if (types != NULL_PTR(TypeDescriptor *)) {
+        delete[] types;
+    }
+    if (sizes != NULL_PTR(uint32 *)) {
+        delete[] sizes;
+    }
+    if (roles != NULL_PTR(uint32 *)) {
+        delete[] roles;
+    }
+    if (file.IsOpen()) {
+        (void) file.Close();
+    }
+    return ok;
+}
+
+bool LookupTableGAM::PrepareBreakpoints(const char8 * const name,
+                                        const float64 * const breakpoints,
+                                        const uint32 numberOfBreakpoints,
+                                        float64 *&inverseSpacings) {
+    bool ok = (numberOfBreakpoints > 1u);
+    if (ok) {
+        inverseSpacings = new float64[numberOfBreakpoints - 1u];
+    }
+    for (uint32 i = 0u; (i < (numberOfBreakpoints - 1u)) && (ok); i++) {
+        ok = (breakpoints[i + 1u] > breakpoints[i]);
+        if (ok) {
+            inverseSpacings[i] = 1.0 / (breakpoints[i + 1u] - breakpoints[i]);
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "%s shall have at least two strictly increasing values", name);
+    }
+    return ok;
+}
+
+template<typename InputType, typename OutputType>
+void LookupTableGAM::Interpolate1D(const InputType * const x,
+                                   OutputType * const result) {
+    /*lint -e{613} the buffers cannot be NULL as Execute is only called after a successful Setup*/
+    for (uint32 i = 0u; i < numberOfElements; i++) {
+        float64 xi = static_cast<float64>(x[i]);
+        uint32 cell = FindCell(breakpoints1, numberOfBreakpoints1, xi, cells1[i]);
+        cells1[i] = cell;
+        float64 fraction = CellFraction(breakpoints1, inverseSpacings1, xi, cell);
+        float64 value = table[cell] + (fraction * (table[cell + 1u] - table[cell]));
+        result[i] = static_cast<OutputType>(value);
+    }
+}
+
+template<typename InputType, typename OutputType>
+void LookupTableGAM::Interpolate2D(const InputType * const x,
+                                   const InputType * const y,
+                                   OutputType * const result) {
+    /*lint -e{613} the buffers cannot be NULL as Execute is only called after a successful Setup*/
+    for (uint32 i = 0u; i < numberOfElements; i++) {
+        float64 xi = static_cast<float64>(x[i]);
+        float64 yi = static_cast<float64>(y[i]);
+        uint32 cell1 = FindCell(breakpoints1, numberOfBreakpoints1, xi, cells1[i]);
+        uint32 cell2 = FindCell(breakpoints2, numberOfBreakpoints2, yi, cells2[i]);
+        cells1[i] = cell1;
+        cells2[i] = cell2;
+        float64 fraction1 = CellFraction(breakpoints1, inverseSpacings1, xi, cell1);
+        float64 fraction2 = CellFraction(breakpoints2, inverseSpacings2, yi, cell2);
+        const float64 * const lower = &table[(cell1 * numberOfBreakpoints2) + cell2];
+        const float64 * const upper = &lower[numberOfBreakpoints2];
+        float64 lowerValue = lower[0] + (fraction2 * (lower[1] - lower[0]));
+        float64 upperValue = upper[0] + (fraction2 * (upper[1] - upper[0]));
+        result[i] = static_cast<OutputType>(lowerValue + (fraction1 * (upperValue - lowerValue)));
+    }
+}
+
+template<typename InputType>
+void LookupTableGAM::Interpolate() {
+    const InputType * const x = static_cast<const InputType *>(inputX);
+    if (numberOfDimensions == 1u) {
+        if (float32Output) {
+            Interpolate1D(x, static_cast<float32 *>(output));
+        }
+        else {
+            Interpolate1D(x, static_cast<float64 *>(output));
+        }
+    }
+    else {
+        const InputType * const y = static_cast<const InputType *>(inputY);
+        if (float32Output) {
+            Interpolate2D(x, y, static_cast<float32 *>(output));
+        }
+        else {
+            Interpolate2D(x, y, static_cast<float64 *>(output));
+        }
+    }
+}
+
+CLASS_REGISTER(LookupTableGAM, "1.0")
+}
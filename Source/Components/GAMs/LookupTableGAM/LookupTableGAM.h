@@ -0,0 +1,369 @@
+/**
+ * @file LookupTableGAM.h
+ * @brief Header file for class LookupTableGAM
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class LookupTableGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LOOKUPTABLEGAM_H_
+#define LOOKUPTABLEGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief GAM which interpolates a 1D or a 2D lookup table (e.g. calibration and equilibrium maps).
+ * @details The table is defined on a grid of strictly increasing breakpoints (Breakpoints1 and, for a 2D table, Breakpoints2). The output is
+ * linearly (1D) or bilinearly (2D) interpolated from the values of the table at the corners of the cell which contains the input.
+ * A 1D table has one value for each element of Breakpoints1. A 2D table has one value for each pair of breakpoints, with the
+ * Breakpoints2 index varying fastest, i.e. Table[i * number of Breakpoints2 + j] is the value at (Breakpoints1[i], Breakpoints2[j]).
+ *
+ * The input signals can be arrays (and/or have more than one sample): each element is interpolated independently, in a single pass over
+ * the arrays with the loop specialised for the types of the signals. The cell of each element is remembered from one cycle to the next and
+ * is first searched in the cell of the previous cycle and in its two neighbours (as the inputs rarely move by more than one cell per cycle),
+ * falling back to a binary search on the breakpoints only for larger moves (see GetNumberOfSearches()). The breakpoint spacings are inverted
+ * at Initialise so that no division is performed at Execute.
+ *
+ * Outside of the breakpoints the output is either the value at the nearest edge of the table (Extrapolation = Clip) or the linear
+ * extrapolation of the edge cell (Extrapolation = Linear).
+ *
+ * The breakpoints and the table can be read from the configuration or from a binary file in the FileReader format (see FileReader), with
+ * the signals Breakpoints1, Table and (for a 2D table) Breakpoints2, of type float32 or float64, where only the first cycle is read.
+ *
+ * The GAM has one input signal (the x of a 1D table) or two (the x and the y of a 2D table) and one output signal. All the signals shall
+ * be float32 or float64 and have the same number of elements * samples. The input signals shall have the same type.
+ *
+ * The configuration syntax is (names and signal quantities are only given as an example):
+ *
+ * <pre>
+ * +LUT = {
+ *     Class = LookupTableGAM
+ *     Breakpoints1 = {0.0 1.0 2.0} //Compulsory (unless Filename is set). At least two strictly increasing values.
+ *     Breakpoints2 = {0.0 10.0} //Optional. If set the table is 2D.
+ *     Table = {0.0 1.0 2.0 3.0 4.0 5.0} //Compulsory (unless Filename is set). Number of Breakpoints1 (* number of Breakpoints2) values.
+ *     Filename = "map.bin" //Optional. If set the Breakpoints1, Breakpoints2 and Table are read from this binary file (FileReader format).
+ *     Extrapolation = Clip //Optional. Clip (default) or Linear.
+ *     InputSignals = {
+ *         Current = { //x
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 8
+ *         }
+ *         Position = { //y (only for a 2D table)
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 8
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Flux = {
+ *             DataSource = DDB1
+ *             Type = float64
+ *             NumberOfElements = 8
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class LookupTableGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     * @post
+     *   GetNumberOfDimensions() == 0u
+     *   GetNumberOfSearches() == 0u
+     */
+    LookupTableGAM();
+
+    /**
+     * @brief Frees the table.
+     */
+    virtual ~LookupTableGAM();
+
+    /**
+     * @brief Reads the breakpoints and the table (from the configuration or from the Filename) and the Extrapolation.
+     * @return true if GAM::Initialise succeeds, the breakpoints are strictly increasing (at least two) and the table has one value for
+     * each point of the grid.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals (see class description) and allocates the cells of the elements.
+     * @return true if the number, the types and the number of elements of the signals are valid.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Interpolates the table for each element of the input signals.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Gets the number of dimensions of the table (1 or 2, 0 before Initialise).
+     */
+    uint32 GetNumberOfDimensions() const;
+
+    /**
+     * @brief Gets the number of binary searches performed (i.e. the number of times an input moved by more than one cell in a cycle).
+     */
+    uint32 GetNumberOfSearches() const;
+
+private:
+
+    /**
+     * @brief Reads an array of breakpoints or the table from the configuration.
+     */
+    static bool ReadArray(StructuredDataI &data,
+                          const char8 * const name,
+                          float64 *&values,
+                          uint32 &numberOfValues);
+
+    /**
+     * @brief Reads the breakpoints and the table from a binary file with the FileReader format.
+     */
+    bool ReadFile(const char8 * const filename);
+
+    /**
+     * @brief Verifies that the breakpoints are strictly increasing and computes the inverse of their spacings.
+     */
+    static bool PrepareBreakpoints(const char8 * const name,
+                                   const float64 * const breakpoints,
+                                   const uint32 numberOfBreakpoints,
+                                   float64 *&inverseSpacings);
+
+    /**
+     * @brief Finds the cell which contains x, starting from the cell of the previous cycle.
+     * @param[in] breakpoints the breakpoints.
+     * @param[in] numberOfBreakpoints the number of breakpoints.
+     * @param[in] x the input.
+     * @param[in] cell the cell of the previous cycle.
+     * @return the index of the cell (i.e. of its lower breakpoint), between 0 and numberOfBreakpoints - 2.
+     */
+    inline uint32 FindCell(const float64 * const breakpoints,
+                           const uint32 numberOfBreakpoints,
+                           const float64 x,
+                           const uint32 cell);
+
+    /**
+     * @brief Computes the position of x in a cell (0 at the lower breakpoint, 1 at the upper one), clipped to [0, 1] if Extrapolation = Clip.
+     */
+    inline float64 CellFraction(const float64 * const breakpoints,
+                                const float64 * const inverseSpacings,
+                                const float64 x,
+                                const uint32 cell) const;
+
+    /**
+     * @brief Interpolates a 1D table for all the elements.
+     */
+    template<typename InputType, typename OutputType>
+    void Interpolate1D(const InputType * const x,
+                       OutputType * const result);
+
+    /**
+     * @brief Interpolates a 2D table for all the elements.
+     */
+    template<typename InputType, typename OutputType>
+    void Interpolate2D(const InputType * const x,
+                       const InputType * const y,
+                       OutputType * const result);
+
+    /**
+     * @brief Calls Interpolate1D or Interpolate2D for the type of the output signal.
+     */
+    template<typename InputType>
+    void Interpolate();
+
+    /**
+     * The number of dimensions of the table.
+     */
+    uint32 numberOfDimensions;
+
+    /**
+     * The breakpoints of the first dimension and the inverse of their spacings.
+     */
+    float64 *breakpoints1;
+    float64 *inverseSpacings1;
+
+    /**
+     * The number of breakpoints of the first dimension.
+     */
+    uint32 numberOfBreakpoints1;
+
+    /**
+     * The breakpoints of the second dimension and the inverse of their spacings.
+     */
+    float64 *breakpoints2;
+    float64 *inverseSpacings2;
+
+    /**
+     * The number of breakpoints of the second dimension (0 for a 1D table).
+     */
+    uint32 numberOfBreakpoints2;
+
+    /**
+     * The table.
+     */
+    float64 *table;
+
+    /**
+     * True if Extrapolation = Linear.
+     */
+    bool linearExtrapolation;
+
+    /**
+     * The number of elements (* samples) of the signals.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * The type of the input signals.
+     */
+    TypeDescriptor inputType;
+
+    /**
+     * True if the output signal is float32 (float64 otherwise).
+     */
+    bool float32Output;
+
+    /**
+     * The memory of the signals.
+     */
+    void *inputX;
+    void *inputY;
+    void *output;
+
+    /**
+     * The cell of each element in the previous cycle (first and second dimension).
+     */
+    uint32 *cells1;
+    uint32 *cells2;
+
+    /**
+     * The number of binary searches.
+     */
+    uint32 numberOfSearches;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+uint32 LookupTableGAM::FindCell(const float64 * const breakpoints,
+                                const uint32 numberOfBreakpoints,
+                                const float64 x,
+                                const uint32 cell) {
+    uint32 lastCell = (numberOfBreakpoints - 2u);
+    uint32 found = cell;
+    if (x < breakpoints[cell]) {
+        if (cell == 0u) {
+            //Below the table.
+        }
+        else if (x >= breakpoints[cell - 1u]) {
+            found = (cell - 1u);
+        }
+        else {
+            numberOfSearches++;
+            uint32 low = 0u;
+            uint32 high = cell;
+            //breakpoints[low] <= x < breakpoints[high], unless x is below the table (found = 0)
+            while ((high - low) > 1u) {
+                uint32 middle = low + ((high - low) / 2u);
+                if (breakpoints[middle] <= x) {
+                    low = middle;
+                }
+                else {
+                    high = middle;
+                }
+            }
+            found = low;
+        }
+    }
+    else if (x >= breakpoints[cell + 1u]) {
+        if (cell == lastCell) {
+            //Above the table.
+        }
+        else if (x < breakpoints[cell + 2u]) {
+            found = (cell + 1u);
+        }
+        else {
+            numberOfSearches++;
+            uint32 low = cell + 1u;
+            uint32 high = (numberOfBreakpoints - 1u);
+            if (x >= breakpoints[high]) {
+                low = lastCell;
+            }
+            //breakpoints[low] <= x < breakpoints[high]
+            while ((high - low) > 1u) {
+                uint32 middle = low + ((high - low) / 2u);
+                if (breakpoints[middle] <= x) {
+                    low = middle;
+                }
+                else {
+                    high = middle;
+                }
+            }
+            found = low;
+        }
+    }
+    else {
+        //Same cell (or x is NaN).
+    }
+    return found;
+}
+
+float64 LookupTableGAM::CellFraction(const float64 * const breakpoints,
+                                     const float64 * const inverseSpacings,
+                                     const float64 x,
+                                     const uint32 cell) const {
+    float64 fraction = (x - breakpoints[cell]) * inverseSpacings[cell];
+    if (!linearExtrapolation) {
+        if (fraction < 0.0) {
+            fraction = 0.0;
+        }
+        else if (fraction > 1.0) {
+            fraction = 1.0;
+        }
+        else {
+            //Inside the cell.
+        }
+    }
+    return fraction;
+}
+
+}
+
+#endif /* LOOKUPTABLEGAM_H_ */
@@ -0,0 +1,219 @@
+/**
+ * @file MathExpressionCache.cpp
+ * @brief Source file for class MathExpressionCache
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionCache (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "MathExpressionCache.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+bool IsWhitespace(const MARTe::char8 c) {
+    return ((c == ' ') || (c == '\t') || (c == '\n') || (c == '\r'));
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MathExpressionCache::MathExpressionCache() {
+    entries = NULL_PTR(CacheEntry *);
+    numberOfEntries = 0u;
+    capacity = 0u;
+    hits = 0u;
+    (void) mutex.Create();
+}
+
+/*lint -e{1551} the destructor must guarantee that the entries are freed.*/
+MathExpressionCache::~MathExpressionCache() {
+    if (entries != NULL_PTR(CacheEntry *)) {
+        delete[] entries;
+    }
+    (void) mutex.Close();
+}
+
+MathExpressionCache &MathExpressionCache::Instance() {
+    static MathExpressionCache instance;
+    return instance;
+}
+
+bool MathExpressionCache::Find(const char8 * const key,
+                               StreamString &program) {
+    bool found = false;
+    uint32 hash = Hash(key);
+    if ((key != NULL_PTR(const char8 *)) && (mutex.FastLock() == ErrorManagement::NoError)) {
+        uint32 idx = FindEntry(key, hash);
+        found = (idx < numberOfEntries);
+        if (found) {
+            /*lint -e{613} found => entries != NULL*/
+            program = entries[idx].program;
+            hits++;
+        }
+        mutex.FastUnLock();
+    }
+    return found;
+}
+
+bool MathExpressionCache::Add(const char8 * const key,
+                              const char8 * const program) {
+    bool ok = false;
+    uint32 hash = Hash(key);
+    if ((key != NULL_PTR(const char8 *)) && (program != NULL_PTR(const char8 *)) && (mutex.FastLock() == ErrorManagement::NoError)) {
+        ok = (FindEntry(key, hash) == numberOfEntries);
+        if (ok && (numberOfEntries == capacity)) {
+            uint32 newCapacity = (capacity == 0u) ? (16u) : (2u * capacity);
+            CacheEntry *newEntries = new CacheEntry[newCapacity];
+            for (uint32 i = 0u; i < numberOfEntries; i++) {
+                /*lint -e{613} numberOfEntries > 0 => entries != NULL*/
+                newEntries[i] = entries[i];
+            }
+            if (entries != NULL_PTR(CacheEntry *)) {
+                delete[] entries;
+            }
+            entries = newEntries;
+            capacity = newCapacity;
+        }
+        if (ok) {
+            /*lint -e{613} entries != NULL (allocated above)*/
+            entries[numberOfEntries].key = key;
+            entries[numberOfEntries].program = program;
+            entries[numberOfEntries].hash = hash;
+            numberOfEntries++;
+        }
+        mutex.FastUnLock();
+    }
+    return ok;
+}
+
+uint32 MathExpressionCache::GetNumberOfEntries() {
+    uint32 ret = 0u;
+    if (mutex.FastLock() == ErrorManagement::NoError) {
+        ret = numberOfEntries;
+        mutex.FastUnLock();
+    }
+    return ret;
+}
+
+uint32 MathExpressionCache::GetNumberOfHits() {
+    uint32 ret = 0u;
+    if (mutex.FastLock() == ErrorManagement::NoError) {
+        ret = hits;
+        mutex.FastUnLock();
+    }
+    return ret;
+}
+
+void MathExpressionCache::Reset() {
+    if (mutex.FastLock() == ErrorManagement::NoError) {
+        if (entries != NULL_PTR(CacheEntry *)) {
+            delete[] entries;
+        }
+        entries = NULL_PTR(CacheEntry *);
+        numberOfEntries = 0u;
+        capacity = 0u;
+        hits = 0u;
+        mutex.FastUnLock();
+    }
+}
+
+void MathExpressionCache::NormaliseExpression(const char8 * const expression,
+                                              StreamString &normalised) {
+    if (expression != NULL_PTR(const char8 *)) {
+        uint32 i = 0u;
+        bool pendingSpace = false;
+        bool pendingNewline = false;
+        bool started = false;
+        while (expression[i] != '\0') {
+            char8 c = expression[i];
+            if (IsWhitespace(c)) {
+                if (c == '\n') {
+                    pendingNewline = true;
+                }
+                else {
+                    pendingSpace = true;
+                }
+            }
+            else {
+                if (started) {
+                    if (pendingNewline) {
+                        normalised += '\n';
+                    }
+                    else if (pendingSpace) {
+                        normalised += ' ';
+                    }
+                    else {
+                        //No whitespace before this character.
+                    }
+                }
+                normalised += c;
+                started = true;
+                pendingSpace = false;
+                pendingNewline = false;
+            }
+            i++;
+        }
+    }
+}
+
+uint32 MathExpressionCache::Hash(const char8 * const key) {
+    uint32 hash = 2166136261u;
+    if (key != NULL_PTR(const char8 *)) {
+        uint32 i = 0u;
+        while (key[i] != '\0') {
+            hash ^= static_cast<uint32>(static_cast<uint8>(key[i]));
+            hash *= 16777619u;
+            i++;
+        }
+    }
+    return hash;
+}
+
+uint32 MathExpressionCache::FindEntry(const char8 * const key,
+                                      const uint32 hash) const {
+    uint32 idx = numberOfEntries;
+    for (uint32 i = 0u; (i < numberOfEntries) && (idx == numberOfEntries); i++) {
+        /*lint -e{613} numberOfEntries > 0 => entries != NULL*/
+        if (entries[i].hash == hash) {
+            if (StringHelper::Compare(entries[i].key.Buffer(), key) == 0) {
+                idx = i;
+            }
+        }
+    }
+    return idx;
+}
+
+}
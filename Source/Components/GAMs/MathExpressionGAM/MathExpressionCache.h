@@ -0,0 +1,176 @@
+/**
+ * @file MathExpressionCache.h
+ * @brief Header file for class MathExpressionCache
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MathExpressionCache
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MATHEXPRESSIONCACHE_H_
+#define MATHEXPRESSIONCACHE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "CompilerTypes.h"
+#include "FastPollingMutexSem.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A table of stack machine programs, shared by all the MathExpressionGAM instances of the process.
+ * @details Parsing an infix expression (MathExpressionParser) and optimising its stack machine program (MathExpressionOptimiser)
+ * only depends on the text of the expression and on the names and types of the signals. Configurations with many instances of the
+ * same expression thus only parse and optimise it once: the first instance adds the resulting program to the cache (Add()) and
+ * all the other instances read it (Find()). The programs are immutable once added. Each instance still builds its own
+ * RuntimeEvaluator (or MathExpressionCompiler) from the program, to bind the addresses of its own signals.
+ *
+ * The keys are built by the caller (see NormaliseExpression()). All the methods are thread-safe.
+ */
+class MathExpressionCache {
+public:
+
+    /**
+     * @brief Default constructor.
+     * @post
+     *   GetNumberOfEntries() == 0u
+     *   GetNumberOfHits() == 0u
+     */
+    MathExpressionCache();
+
+    /**
+     * @brief Frees the entries.
+     */
+    ~MathExpressionCache();
+
+    /**
+     * @brief Gets the cache shared by the whole process.
+     * @details The cache is created the first time this method is called (i.e. when the first MathExpressionGAM is initialised).
+     * @return the process-wide cache.
+     */
+    static MathExpressionCache &Instance();
+
+    /**
+     * @brief Searches a program.
+     * @param[in] key the key of the program.
+     * @param[out] program the program added with the \a key.
+     * @return true if a program was added with the \a key.
+     */
+    bool Find(const char8 * const key,
+              StreamString &program);
+
+    /**
+     * @brief Adds a program.
+     * @param[in] key the key of the program.
+     * @param[in] program the program (possibly empty, e.g. to record that an expression cannot be optimised).
+     * @return true if there was no program with the same \a key (otherwise the first one is kept).
+     */
+    bool Add(const char8 * const key,
+             const char8 * const program);
+
+    /**
+     * @brief Gets the number of programs in the cache.
+     */
+    uint32 GetNumberOfEntries();
+
+    /**
+     * @brief Gets the number of successful Find() calls.
+     */
+    uint32 GetNumberOfHits();
+
+    /**
+     * @brief Removes all the programs and resets the number of hits.
+     */
+    void Reset();
+
+    /**
+     * @brief Writes an expression without the formatting whitespaces.
+     * @details Leading and trailing whitespaces are removed and any other sequence of whitespaces is replaced by one newline (if
+     * the sequence has a newline, which terminates the assignments) or by one space. The tokens of the expression are thus not changed.
+     * @param[in] expression the expression.
+     * @param[out] normalised the \a expression without the formatting whitespaces (appended).
+     */
+    static void NormaliseExpression(const char8 * const expression,
+                                    StreamString &normalised);
+
+private:
+
+    /**
+     * @brief A program and its key.
+     */
+    struct CacheEntry {
+        StreamString key;
+        StreamString program;
+        uint32 hash;
+    };
+
+    /**
+     * @brief Computes the hash of a key (FNV-1a).
+     */
+    static uint32 Hash(const char8 * const key);
+
+    /**
+     * @brief Searches a key (the mutex shall be locked).
+     * @return the index of the entry or numberOfEntries if it does not exist.
+     */
+    uint32 FindEntry(const char8 * const key,
+                     const uint32 hash) const;
+
+    /**
+     * Protects the entries.
+     */
+    FastPollingMutexSem mutex;
+
+    /**
+     * The entries.
+     */
+    CacheEntry *entries;
+
+    /**
+     * The number of entries.
+     */
+    uint32 numberOfEntries;
+
+    /**
+     * The size of the entries array.
+     */
+    uint32 capacity;
+
+    /**
+     * The number of successful Find() calls.
+     */
+    uint32 hits;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MATHEXPRESSIONCACHE_H_ */
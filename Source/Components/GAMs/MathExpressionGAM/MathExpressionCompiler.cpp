@@ -0,0 +1,711 @@
+/**
+ * @file MathExpressionCompiler.cpp
+ * @brief Source file for class MathExpressionCompiler
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionCompiler (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "AnyType.h"
+#include "MathExpressionCompiler.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+bool IsSeparator(const MARTe::char8 c) {
+    return ((c == ' ') || (c == '\t') || (c == '\n') || (c == '\r'));
+}
+
+/**
+ * The element operations
+ */
+template<typename T>
+struct AddOperation {
+    static inline T Apply(const T x1,
+                          const T x2) {
+        return x1 + x2;
+    }
+};
+
+template<typename T>
+struct SubOperation {
+    static inline T Apply(const T x1,
+                          const T x2) {
+        return x1 - x2;
+    }
+};
+
+template<typename T>
+struct MulOperation {
+    static inline T Apply(const T x1,
+                          const T x2) {
+        return x1 * x2;
+    }
+};
+
+template<typename T>
+struct DivOperation {
+    static inline T Apply(const T x1,
+                          const T x2) {
+        return x1 / x2;
+    }
+};
+
+template<typename T>
+struct PowOperation {
+    static inline T Apply(const T x1,
+                          const T x2) {
+        return static_cast<T>(pow(x1, x2));
+    }
+};
+
+template<typename T>
+struct SinOperation {
+    static inline T Apply(const T x) {
+        return static_cast<T>(sin(x));
+    }
+};
+
+template<typename T>
+struct CosOperation {
+    static inline T Apply(const T x) {
+        return static_cast<T>(cos(x));
+    }
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MathExpressionCompiler::MathExpressionCompiler() {
+    programPosition = 0u;
+    maximumNumberOfTokens = 0u;
+    instructions = NULL_PTR(CompiledInstruction *);
+    numberOfInstructions = 0u;
+    variables = NULL_PTR(CompiledVariable *);
+    numberOfVariables = 0u;
+    maximumNumberOfVariables = 0u;
+    stack = NULL_PTR(CompiledOperand *);
+    stackDepth = 0u;
+    numberOfElements = 1u;
+    float32Registers = NULL_PTR(float32 *);
+    float64Registers = NULL_PTR(float64 *);
+    constants = NULL_PTR(CompiledValue *);
+    numberOfConstants = 0u;
+    float32InternalVariables = NULL_PTR(float32 *);
+    float64InternalVariables = NULL_PTR(float64 *);
+    numberOfInternalVariables = 0u;
+}
+
+/*lint -e{1551} the destructor must guarantee that the memory is freed*/
+MathExpressionCompiler::~MathExpressionCompiler() {
+    if (instructions != NULL_PTR(CompiledInstruction *)) {
+        delete[] instructions;
+    }
+    if (variables != NULL_PTR(CompiledVariable *)) {
+        delete[] variables;
+    }
+    if (stack != NULL_PTR(CompiledOperand *)) {
+        delete[] stack;
+    }
+    if (float32Registers != NULL_PTR(float32 *)) {
+        delete[] float32Registers;
+    }
+    if (float64Registers != NULL_PTR(float64 *)) {
+        delete[] float64Registers;
+    }
+    if (constants != NULL_PTR(CompiledValue *)) {
+        delete[] constants;
+    }
+    if (float32InternalVariables != NULL_PTR(float32 *)) {
+        delete[] float32InternalVariables;
+    }
+    if (float64InternalVariables != NULL_PTR(float64 *)) {
+        delete[] float64InternalVariables;
+    }
+}
+
+bool MathExpressionCompiler::Initialise(const char8 * const stackMachineExpression,
+                                        const uint32 numberOfExternalVariables) {
+    bool ok = (instructions == NULL_PTR(CompiledInstruction *));
+    if (ok) {
+        ok = (stackMachineExpression != NULL_PTR(const char8 *));
+    }
+    if (ok) {
+        program = stackMachineExpression;
+        //Each instruction, stack position, constant and internal variable requires at least one token.
+        maximumNumberOfTokens = 1u;
+        bool previousSeparator = true;
+        uint32 i;
+        for (i = 0u; stackMachineExpression[i] != '\0'; i++) {
+            bool separator = IsSeparator(stackMachineExpression[i]);
+            if ((!separator) && (previousSeparator)) {
+                maximumNumberOfTokens++;
+            }
+            previousSeparator = separator;
+        }
+        maximumNumberOfVariables = numberOfExternalVariables + maximumNumberOfTokens;
+        instructions = new CompiledInstruction[maximumNumberOfTokens];
+        variables = new CompiledVariable[maximumNumberOfVariables];
+        stack = new CompiledOperand[maximumNumberOfTokens];
+        constants = new CompiledValue[maximumNumberOfTokens];
+        for (i = 0u; i < maximumNumberOfTokens; i++) {
+            constants[i].float64Value = 0.0;
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionCompiler::AddVariable(const char8 * const name,
+                                         const TypeDescriptor &type,
+                                         void * const location,
+                                         const uint32 numberOfElementsIn) {
+    bool ok = (variables != NULL_PTR(CompiledVariable *));
+    StreamString variableName = name;
+    if (ok) {
+        ok = (numberOfElementsIn > 0u);
+    }
+    if (ok) {
+        ok = (FindVariable(variableName) == numberOfVariables);
+    }
+    if (ok) {
+        ok = ((numberOfVariables + maximumNumberOfTokens) < maximumNumberOfVariables);
+    }
+    if (ok) {
+        variables[numberOfVariables].name = variableName;
+        variables[numberOfVariables].type = type;
+        variables[numberOfVariables].location = location;
+        variables[numberOfVariables].numberOfElements = numberOfElementsIn;
+        numberOfVariables++;
+    }
+    return ok;
+}
+
+bool MathExpressionCompiler::Compile() {
+    bool ok = (instructions != NULL_PTR(CompiledInstruction *));
+    if (ok) {
+        ok = (float32Registers == NULL_PTR(float32 *));
+    }
+    uint32 i;
+    //All the array variables must have the same number of elements.
+    for (i = 0u; (i < numberOfVariables) && (ok); i++) {
+        if (variables[i].numberOfElements > 1u) {
+            if (numberOfElements == 1u) {
+                numberOfElements = variables[i].numberOfElements;
+            }
+            ok = (variables[i].numberOfElements == numberOfElements);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::UnsupportedFeature, "The variable %s has %u elements while other variables have %u elements",
+                                    variables[i].name.Buffer(), variables[i].numberOfElements, numberOfElements);
+            }
+        }
+    }
+    if (ok) {
+        uint32 numberOfValues = maximumNumberOfTokens * numberOfElements;
+        float32Registers = new float32[numberOfValues];
+        float64Registers = new float64[numberOfValues];
+        float32InternalVariables = new float32[numberOfValues];
+        float64InternalVariables = new float64[numberOfValues];
+        for (i = 0u; i < numberOfValues; i++) {
+            float32Registers[i] = 0.0F;
+            float64Registers[i] = 0.0;
+            float32InternalVariables[i] = 0.0F;
+            float64InternalVariables[i] = 0.0;
+        }
+    }
+    programPosition = 0u;
+    StreamString operation;
+    while ((ok) && (GetNextToken(operation))) {
+        ok = CompileOperation(operation);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::UnsupportedFeature, "Cannot compile the operation %s", operation.Buffer());
+        }
+        operation = "";
+    }
+    if (ok) {
+        ok = (stackDepth == 0u);
+    }
+    if (!ok) {
+        numberOfInstructions = 0u;
+    }
+    return ok;
+}
+
+void MathExpressionCompiler::Execute() const {
+    for (uint32 i = 0u; i < numberOfInstructions; i++) {
+        instructions[i].function(instructions[i]);
+    }
+}
+
+uint32 MathExpressionCompiler::GetNumberOfInstructions() const {
+    return numberOfInstructions;
+}
+
+uint32 MathExpressionCompiler::GetNumberOfElements() const {
+    return numberOfElements;
+}
+
+bool MathExpressionCompiler::GetNextToken(StreamString &token) {
+    const char8 * const buffer = program.Buffer();
+    while ((buffer[programPosition] != '\0') && (IsSeparator(buffer[programPosition]))) {
+        programPosition++;
+    }
+    bool ok = (buffer[programPosition] != '\0');
+    while ((buffer[programPosition] != '\0') && (!IsSeparator(buffer[programPosition]))) {
+        token += buffer[programPosition];
+        programPosition++;
+    }
+    return ok;
+}
+
+bool MathExpressionCompiler::CompileOperation(const StreamString &operation) {
+    bool ok;
+    if (operation == "READ") {
+        ok = CompileRead();
+    }
+    else if (operation == "WRITE") {
+        ok = CompileWrite();
+    }
+    else if (operation == "CONST") {
+        ok = CompileConstant();
+    }
+    else if (operation == "CAST") {
+        ok = CompileCast();
+    }
+    else if ((operation == "SIN") || (operation == "COS")) {
+        ok = CompileUnary(operation);
+    }
+    else if ((operation == "ADD") || (operation == "SUB") || (operation == "MUL") || (operation == "DIV") || (operation == "POW")) {
+        ok = CompileBinary(operation);
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+
+bool MathExpressionCompiler::CompileRead() {
+    StreamString name;
+    bool ok = GetNextToken(name);
+    uint32 idx = numberOfVariables;
+    if (ok) {
+        idx = FindVariable(name);
+        ok = (idx < numberOfVariables);
+    }
+    if (ok) {
+        ok = (stackDepth < maximumNumberOfTokens);
+    }
+    if (ok) {
+        stack[stackDepth].type = variables[idx].type;
+        stack[stackDepth].location = variables[idx].location;
+        stack[stackDepth].numberOfElements = variables[idx].numberOfElements;
+        stack[stackDepth].lastResult = false;
+        stackDepth++;
+    }
+    return ok;
+}
+
+bool MathExpressionCompiler::CompileWrite() {
+    StreamString name;
+    bool ok = GetNextToken(name);
+    //Only complete assignments are supported, so that no pending operand can refer to the written variable.
+    if (ok) {
+        ok = (stackDepth == 1u);
+    }
+    if (ok) {
+        ok = IsFloatType(stack[0u].type);
+    }
+    uint32 idx = numberOfVariables;
+    if (ok) {
+        const CompiledOperand &top = stack[0u];
+        idx = FindVariable(name);
+        if (idx == numberOfVariables) {
+            ok = (numberOfInternalVariables < maximumNumberOfTokens);
+            if (ok) {
+                variables[idx].name = name;
+                variables[idx].type = top.type;
+                variables[idx].location = GetArrayLocation(float32InternalVariables, float64InternalVariables, numberOfInternalVariables, top.type);
+                variables[idx].numberOfElements = top.numberOfElements;
+                numberOfInternalVariables++;
+                numberOfVariables++;
+            }
+        }
+        else {
+            ok = (variables[idx].type == top.type);
+            if (ok) {
+                //A scalar can be broadcast to an array but an array cannot be written to a scalar.
+                ok = ((variables[idx].numberOfElements == top.numberOfElements) || (top.numberOfElements == 1u));
+            }
+        }
+    }
+    if (ok) {
+        const CompiledOperand &top = stack[0u];
+        bool isFloat32 = (top.type == Float32Bit);
+        uint32 resultNumberOfElements = variables[idx].numberOfElements;
+        if ((top.lastResult) && (top.numberOfElements == resultNumberOfElements)) {
+            instructions[numberOfInstructions - 1u].result = variables[idx].location;
+        }
+        else {
+            stackDepth = 0u;
+            CompiledFunction function;
+            if (top.numberOfElements == resultNumberOfElements) {
+                function = isFloat32 ? &Copy<float32> : &Copy<float64>;
+            }
+            else {
+                function = isFloat32 ? &Broadcast<float32> : &Broadcast<float64>;
+            }
+            ok = AddInstruction(function, top.location, NULL_PTR(const void *), top.type, resultNumberOfElements);
+            if (ok) {
+                instructions[numberOfInstructions - 1u].result = variables[idx].location;
+            }
+        }
+        stackDepth = 0u;
+    }
+    return ok;
+}
+
+bool MathExpressionCompiler::CompileConstant() {
+    StreamString typeName;
+    StreamString value;
+    bool ok = GetNextToken(typeName);
+    if (ok) {
+        ok = GetNextToken(value);
+    }
+    TypeDescriptor type;
+    if (ok) {
+        type = TypeDescriptor::GetTypeDescriptorFromTypeName(typeName.Buffer());
+        ok = IsFloatType(type);
+    }
+    if (ok) {
+        ok = (numberOfConstants < maximumNumberOfTokens);
+    }
+    if (ok) {
+        ok = (stackDepth < maximumNumberOfTokens);
+    }
+    if (ok) {
+        void *location = GetValueLocation(constants[numberOfConstants], type);
+        numberOfConstants++;
+        ok = TypeConvert(AnyType(type, 0u, location), AnyType(value.Buffer()));
+        if (ok) {
+            stack[stackDepth].type = type;
+            stack[stackDepth].location = location;
+            stack[stackDepth].numberOfElements = 1u;
+            stack[stackDepth].lastResult = false;
+            stackDepth++;
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionCompiler::CompileCast() {
+    StreamString typeName;
+    bool ok = GetNextToken(typeName);
+    TypeDescriptor type;
+    if (ok) {
+        type = TypeDescriptor::GetTypeDescriptorFromTypeName(typeName.Buffer());
+        ok = IsFloatType(type);
+    }
+    if (ok) {
+        ok = (stackDepth > 0u);
+    }
+    if (ok) {
+        const CompiledOperand &top = stack[stackDepth - 1u];
+        if (top.type != type) {
+            CompiledFunction function;
+            if (type == Float32Bit) {
+                function = GetCastFunction<float32>(top.type);
+            }
+            else {
+                function = GetCastFunction<float64>(top.type);
+            }
+            ok = (function != NULL);
+            if (ok) {
+                stackDepth--;
+                ok = AddInstruction(function, stack[stackDepth].location, NULL_PTR(const void *), type, stack[stackDepth].numberOfElements);
+            }
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionCompiler::CompileUnary(const StreamString &operation) {
+    bool ok = (stackDepth > 0u);
+    if (ok) {
+        ok = IsFloatType(stack[stackDepth - 1u].type);
+    }
+    if (ok) {
+        stackDepth--;
+        const CompiledOperand &x = stack[stackDepth];
+        bool isFloat32 = (x.type == Float32Bit);
+        CompiledFunction function;
+        if (operation == "SIN") {
+            function = isFloat32 ? &Unary<SinOperation, float32> : &Unary<SinOperation, float64>;
+        }
+        else {
+            function = isFloat32 ? &Unary<CosOperation, float32> : &Unary<CosOperation, float64>;
+        }
+        ok = AddInstruction(function, x.location, NULL_PTR(const void *), x.type, x.numberOfElements);
+    }
+    return ok;
+}
+
+bool MathExpressionCompiler::CompileBinary(const StreamString &operation) {
+    bool ok = (stackDepth > 1u);
+    if (ok) {
+        ok = IsFloatType(stack[stackDepth - 1u].type);
+    }
+    if (ok) {
+        ok = (stack[stackDepth - 1u].type == stack[stackDepth - 2u].type);
+    }
+    if (ok) {
+        stackDepth -= 2u;
+        const CompiledOperand &x1 = stack[stackDepth];
+        const CompiledOperand &x2 = stack[stackDepth + 1u];
+        CompiledFunction function;
+        if (operation == "ADD") {
+            function = GetBinaryFunction<AddOperation>(x1.type, x1.numberOfElements, x2.numberOfElements);
+        }
+        else if (operation == "SUB") {
+            function = GetBinaryFunction<SubOperation>(x1.type, x1.numberOfElements, x2.numberOfElements);
+        }
+        else if (operation == "MUL") {
+            function = GetBinaryFunction<MulOperation>(x1.type, x1.numberOfElements, x2.numberOfElements);
+        }
+        else if (operation == "DIV") {
+            function = GetBinaryFunction<DivOperation>(x1.type, x1.numberOfElements, x2.numberOfElements);
+        }
+        else {
+            function = GetBinaryFunction<PowOperation>(x1.type, x1.numberOfElements, x2.numberOfElements);
+        }
+        uint32 resultNumberOfElements = (x1.numberOfElements > x2.numberOfElements) ? (x1.numberOfElements) : (x2.numberOfElements);
+        ok = AddInstruction(function, x1.location, x2.location, x1.type, resultNumberOfElements);
+    }
+    return ok;
+}
+
+bool MathExpressionCompiler::AddInstruction(const CompiledFunction function,
+                                            const void * const operand1,
+                                            const void * const operand2,
+                                            const TypeDescriptor &resultType,
+                                            const uint32 resultNumberOfElements) {
+    bool ok = (numberOfInstructions < maximumNumberOfTokens);
+    if (ok) {
+        ok = (stackDepth < maximumNumberOfTokens);
+    }
+    if (ok) {
+        //The result of the previous instruction can no longer be redirected.
+        for (uint32 i = 0u; i < stackDepth; i++) {
+            stack[i].lastResult = false;
+        }
+        void *result = GetArrayLocation(float32Registers, float64Registers, stackDepth, resultType);
+        instructions[numberOfInstructions].function = function;
+        instructions[numberOfInstructions].operand1 = operand1;
+        instructions[numberOfInstructions].operand2 = operand2;
+        instructions[numberOfInstructions].result = result;
+        instructions[numberOfInstructions].numberOfElements = resultNumberOfElements;
+        numberOfInstructions++;
+        stack[stackDepth].type = resultType;
+        stack[stackDepth].location = result;
+        stack[stackDepth].numberOfElements = resultNumberOfElements;
+        stack[stackDepth].lastResult = true;
+        stackDepth++;
+    }
+    return ok;
+}
+
+uint32 MathExpressionCompiler::FindVariable(const StreamString &name) const {
+    uint32 idx = numberOfVariables;
+    for (uint32 i = 0u; (i < numberOfVariables) && (idx == numberOfVariables); i++) {
+        if (variables[i].name == name) {
+            idx = i;
+        }
+    }
+    return idx;
+}
+
+void *MathExpressionCompiler::GetValueLocation(CompiledValue &value,
+                                               const TypeDescriptor &type) {
+    void *location;
+    if (type == Float32Bit) {
+        location = &value.float32Value;
+    }
+    else {
+        location = &value.float64Value;
+    }
+    return location;
+}
+
+void *MathExpressionCompiler::GetArrayLocation(float32 * const float32Arrays,
+                                               float64 * const float64Arrays,
+                                               const uint32 idx,
+                                               const TypeDescriptor &type) const {
+    void *location;
+    if (type == Float32Bit) {
+        location = &float32Arrays[idx * numberOfElements];
+    }
+    else {
+        location = &float64Arrays[idx * numberOfElements];
+    }
+    return location;
+}
+
+bool MathExpressionCompiler::IsFloatType(const TypeDescriptor &type) {
+    return ((type == Float32Bit) || (type == Float64Bit));
+}
+
+template<typename OutputType>
+MathExpressionCompiler::CompiledFunction MathExpressionCompiler::GetCastFunction(const TypeDescriptor &inputType) {
+    CompiledFunction function = NULL;
+    if (inputType == SignedInteger8Bit) {
+        function = &Cast<int8, OutputType>;
+    }
+    else if (inputType == UnsignedInteger8Bit) {
+        function = &Cast<uint8, OutputType>;
+    }
+    else if (inputType == SignedInteger16Bit) {
+        function = &Cast<int16, OutputType>;
+    }
+    else if (inputType == UnsignedInteger16Bit) {
+        function = &Cast<uint16, OutputType>;
+    }
+    else if (inputType == SignedInteger32Bit) {
+        function = &Cast<int32, OutputType>;
+    }
+    else if (inputType == UnsignedInteger32Bit) {
+        function = &Cast<uint32, OutputType>;
+    }
+    else if (inputType == SignedInteger64Bit) {
+        function = &Cast<int64, OutputType>;
+    }
+    else if (inputType == UnsignedInteger64Bit) {
+        function = &Cast<uint64, OutputType>;
+    }
+    else if (inputType == Float32Bit) {
+        function = &Cast<float32, OutputType>;
+    }
+    else if (inputType == Float64Bit) {
+        function = &Cast<float64, OutputType>;
+    }
+    else {
+        function = NULL;
+    }
+    return function;
+}
+
+template<template<typename > class Operation>
+MathExpressionCompiler::CompiledFunction MathExpressionCompiler::GetBinaryFunction(const TypeDescriptor &type,
+                                                                                   const uint32 numberOfElements1,
+                                                                                   const uint32 numberOfElements2) {
+    CompiledFunction function = NULL;
+    bool isFloat32 = (type == Float32Bit);
+    if (numberOfElements1 == numberOfElements2) {
+        function = isFloat32 ? &BinaryArrayArray<Operation, float32> : &BinaryArrayArray<Operation, float64>;
+    }
+    else if (numberOfElements2 == 1u) {
+        function = isFloat32 ? &BinaryArrayScalar<Operation, float32> : &BinaryArrayScalar<Operation, float64>;
+    }
+    else {
+        function = isFloat32 ? &BinaryScalarArray<Operation, float32> : &BinaryScalarArray<Operation, float64>;
+    }
+    return function;
+}
+
+template<typename InputType, typename OutputType>
+void MathExpressionCompiler::Cast(const CompiledInstruction &instruction) {
+    const InputType *x = static_cast<const InputType *>(instruction.operand1);
+    OutputType *y = static_cast<OutputType *>(instruction.result);
+    for (uint32 i = 0u; i < instruction.numberOfElements; i++) {
+        y[i] = static_cast<OutputType>(x[i]);
+    }
+}
+
+template<typename T>
+void MathExpressionCompiler::Copy(const CompiledInstruction &instruction) {
+    const T *x = static_cast<const T *>(instruction.operand1);
+    T *y = static_cast<T *>(instruction.result);
+    for (uint32 i = 0u; i < instruction.numberOfElements; i++) {
+        y[i] = x[i];
+    }
+}
+
+template<typename T>
+void MathExpressionCompiler::Broadcast(const CompiledInstruction &instruction) {
+    const T x = *static_cast<const T *>(instruction.operand1);
+    T *y = static_cast<T *>(instruction.result);
+    for (uint32 i = 0u; i < instruction.numberOfElements; i++) {
+        y[i] = x;
+    }
+}
+
+template<template<typename > class Operation, typename T>
+void MathExpressionCompiler::Unary(const CompiledInstruction &instruction) {
+    const T *x = static_cast<const T *>(instruction.operand1);
+    T *y = static_cast<T *>(instruction.result);
+    for (uint32 i = 0u; i < instruction.numberOfElements; i++) {
+        y[i] = Operation<T>::Apply(x[i]);
+    }
+}
+
+template<template<typename > class Operation, typename T>
+void MathExpressionCompiler::BinaryArrayArray(const CompiledInstruction &instruction) {
+    const T *x1 = static_cast<const T *>(instruction.operand1);
+    const T *x2 = static_cast<const T *>(instruction.operand2);
+    T *y = static_cast<T *>(instruction.result);
+    for (uint32 i = 0u; i < instruction.numberOfElements; i++) {
+        y[i] = Operation<T>::Apply(x1[i], x2[i]);
+    }
+}
+
+template<template<typename > class Operation, typename T>
+void MathExpressionCompiler::BinaryArrayScalar(const CompiledInstruction &instruction) {
+    const T *x1 = static_cast<const T *>(instruction.operand1);
+    const T x2 = *static_cast<const T *>(instruction.operand2);
+    T *y = static_cast<T *>(instruction.result);
+    for (uint32 i = 0u; i < instruction.numberOfElements; i++) {
+        y[i] = Operation<T>::Apply(x1[i], x2);
+    }
+}
+
+template<template<typename > class Operation, typename T>
+void MathExpressionCompiler::BinaryScalarArray(const CompiledInstruction &instruction) {
+    const T x1 = *static_cast<const T *>(instruction.operand1);
+    const T *x2 = static_cast<const T *>(instruction.operand2);
+    T *y = static_cast<T *>(instruction.result);
+    for (uint32 i = 0u; i < instruction.numberOfElements; i++) {
+        y[i] = Operation<T>::Apply(x1, x2[i]);
+    }
+}
+
+}
@@ -0,0 +1,420 @@
+/**
+ * @file MathExpressionCompiler.h
+ * @brief Header file for class MathExpressionCompiler
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MathExpressionCompiler
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MATHEXPRESSIONCOMPILER_H_
+#define MATHEXPRESSIONCOMPILER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "CompilerTypes.h"
+#include "StreamString.h"
+#include "TypeDescriptor.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Translates the stack machine program of a MathExpressionParser into a list of pre-decoded instructions.
+ * @details The program (e.g. "READ A READ B ADD WRITE C") is translated once, before the real-time phase.
+ * The stack is resolved at compile time: each READ and CONST is replaced by the address of the variable (or constant),
+ * each intermediate result is assigned to a fixed register and the result of the last operation of each assignment is
+ * written directly to the memory of the assigned variable. Thus Execute() only calls, once per operation, a function which
+ * reads its operands from and writes its result to fixed addresses (no push, no pop and no type resolution).
+ *
+ * Variables can be arrays, in which case the program is evaluated element by element: each instruction loops over all the
+ * elements (i.e. there is one function call per operation, not per element, and the loops can be vectorised by the compiler).
+ * All the array variables must have the same number of elements. Scalar variables and constants are broadcast to all the elements.
+ *
+ * The supported subset is:
+ *  - READ, WRITE and CONST of float32 and float64 variables;
+ *  - ADD, SUB, MUL, DIV, POW, SIN and COS of float32 and float64 operands of the same type;
+ *  - CAST to float32 and float64 from any integer or float type.
+ *
+ * Compile() fails for any other operation or type combination, so that the caller can fall back to the RuntimeEvaluator.
+ */
+class MathExpressionCompiler {
+public:
+
+    /**
+     * @brief Default constructor.
+     * @post
+     *   GetNumberOfInstructions() == 0u
+     */
+    MathExpressionCompiler();
+
+    /**
+     * @brief Frees the allocated memory.
+     */
+    ~MathExpressionCompiler();
+
+    /**
+     * @brief Allocates the memory required to compile the program.
+     * @param[in] stackMachineExpression the program to be compiled (see MathExpressionParser::GetStackMachineExpression()).
+     * @param[in] numberOfExternalVariables maximum number of variables which will be added with AddVariable().
+     * @return true if the memory was allocated and the method was not already called.
+     */
+    bool Initialise(const char8 * const stackMachineExpression,
+                    const uint32 numberOfExternalVariables);
+
+    /**
+     * @brief Associates a variable of the program to a memory location (e.g. a signal).
+     * @param[in] name the name of the variable.
+     * @param[in] type the type of the variable.
+     * @param[in] location the memory location of the variable.
+     * @param[in] numberOfElements the number of elements of the variable.
+     * @return true if the variable was not already added, numberOfElements > 0 and less than numberOfExternalVariables were added.
+     * @pre
+     *   Initialise()
+     */
+    bool AddVariable(const char8 * const name,
+                     const TypeDescriptor &type,
+                     void * const location,
+                     const uint32 numberOfElements);
+
+    /**
+     * @brief Translates the program.
+     * @details Variables which are written by the program and were not added with AddVariable() are allocated internally.
+     * @return true if all the operations of the program are supported (see class description) and all the array variables have the same
+     * number of elements.
+     * @pre
+     *   Initialise()
+     */
+    bool Compile();
+
+    /**
+     * @brief Executes the compiled program.
+     * @pre
+     *   Compile()
+     */
+    void Execute() const;
+
+    /**
+     * @brief Gets the number of compiled instructions.
+     * @return the number of instructions called in each Execute().
+     */
+    uint32 GetNumberOfInstructions() const;
+
+    /**
+     * @brief Gets the number of elements of the array variables.
+     * @return the number of elements of the array variables (1 if all the variables are scalars).
+     * @pre
+     *   Compile()
+     */
+    uint32 GetNumberOfElements() const;
+
+private:
+
+    struct CompiledInstruction;
+
+    /**
+     * @brief A function which performs a compiled operation.
+     */
+    typedef void (*CompiledFunction)(const CompiledInstruction &instruction);
+
+    /**
+     * @brief A compiled operation.
+     */
+    struct CompiledInstruction {
+        /**
+         * The function which performs the operation
+         */
+        CompiledFunction function;
+        /**
+         * Address of the first operand
+         */
+        const void *operand1;
+        /**
+         * Address of the second operand (binary operations only)
+         */
+        const void *operand2;
+        /**
+         * Address of the result
+         */
+        void *result;
+        /**
+         * Number of elements of the result
+         */
+        uint32 numberOfElements;
+    };
+
+    /**
+     * @brief Memory of a constant.
+     */
+    union CompiledValue {
+        float32 float32Value;
+        float64 float64Value;
+    };
+
+    /**
+     * @brief A variable of the program.
+     */
+    struct CompiledVariable {
+        StreamString name;
+        TypeDescriptor type;
+        void *location;
+        uint32 numberOfElements;
+    };
+
+    /**
+     * @brief An operand in the compile time stack.
+     */
+    struct CompiledOperand {
+        /**
+         * The type of the operand
+         */
+        TypeDescriptor type;
+        /**
+         * The address of the operand
+         */
+        void *location;
+        /**
+         * The number of elements of the operand
+         */
+        uint32 numberOfElements;
+        /**
+         * True if the operand is the result of the last instruction
+         */
+        bool lastResult;
+    };
+
+    /**
+     * @brief Reads the next token of the program.
+     * @param[out] token the token.
+     * @return false if there are no more tokens.
+     */
+    bool GetNextToken(StreamString &token);
+
+    /**
+     * @brief Translates an operation and updates the compile time stack.
+     * @param[in] operation the operation code.
+     * @return true if the operation is supported.
+     */
+    bool CompileOperation(const StreamString &operation);
+
+    /**
+     * @brief Translates READ.
+     */
+    bool CompileRead();
+
+    /**
+     * @brief Translates WRITE.
+     */
+    bool CompileWrite();
+
+    /**
+     * @brief Translates CONST.
+     */
+    bool CompileConstant();
+
+    /**
+     * @brief Translates CAST.
+     */
+    bool CompileCast();
+
+    /**
+     * @brief Translates the unary operations.
+     */
+    bool CompileUnary(const StreamString &operation);
+
+    /**
+     * @brief Translates the binary operations.
+     */
+    bool CompileBinary(const StreamString &operation);
+
+    /**
+     * @brief Adds an instruction whose result is stored in the register of the current top of the stack.
+     * @return true if the maximum number of instructions is not exceeded.
+     */
+    bool AddInstruction(const CompiledFunction function,
+                        const void * const operand1,
+                        const void * const operand2,
+                        const TypeDescriptor &resultType,
+                        const uint32 resultNumberOfElements);
+
+    /**
+     * @brief Searches a variable by name.
+     * @return the index of the variable or numberOfVariables if it does not exist.
+     */
+    uint32 FindVariable(const StreamString &name) const;
+
+    /**
+     * @brief Gets the address of the memory of the requested type.
+     * @return the address of the float32 or of the float64 value.
+     */
+    static void *GetValueLocation(CompiledValue &value,
+                                  const TypeDescriptor &type);
+
+    /**
+     * @brief Gets the address of the idx-th array (of numberOfElements) of the requested type.
+     * @return the address of the float32 or of the float64 array.
+     */
+    void *GetArrayLocation(float32 * const float32Arrays,
+                           float64 * const float64Arrays,
+                           const uint32 idx,
+                           const TypeDescriptor &type) const;
+
+    /**
+     * @brief Queries if the type is float32 or float64.
+     */
+    static bool IsFloatType(const TypeDescriptor &type);
+
+    /**
+     * @brief Gets the function which casts from the type to OutputType.
+     * @return the function or NULL if the type is not supported.
+     */
+    template<typename OutputType>
+    static CompiledFunction GetCastFunction(const TypeDescriptor &inputType);
+
+    /**
+     * @brief Gets the function which performs the binary Operation for the type and the number of elements of the operands.
+     * @return the function which operates on two arrays, on an array and a scalar or on a scalar and an array.
+     */
+    template<template<typename > class Operation>
+    static CompiledFunction GetBinaryFunction(const TypeDescriptor &type,
+                                              const uint32 numberOfElements1,
+                                              const uint32 numberOfElements2);
+
+    /**
+     * @brief The operations.
+     */
+    /*lint -e{1511} these template functions are only accessed by the function pointers*/
+    //@{
+    template<typename InputType, typename OutputType>
+    static void Cast(const CompiledInstruction &instruction);
+    template<typename T>
+    static void Copy(const CompiledInstruction &instruction);
+    template<typename T>
+    static void Broadcast(const CompiledInstruction &instruction);
+    template<template<typename > class Operation, typename T>
+    static void Unary(const CompiledInstruction &instruction);
+    template<template<typename > class Operation, typename T>
+    static void BinaryArrayArray(const CompiledInstruction &instruction);
+    template<template<typename > class Operation, typename T>
+    static void BinaryArrayScalar(const CompiledInstruction &instruction);
+    template<template<typename > class Operation, typename T>
+    static void BinaryScalarArray(const CompiledInstruction &instruction);
+    //@}
+
+    /**
+     * The program to be compiled
+     */
+    StreamString program;
+
+    /**
+     * Position of the next token in the program
+     */
+    uint32 programPosition;
+
+    /**
+     * Maximum number of tokens (upper bound of the number of instructions, of the stack depth, of the constants and of the internal variables)
+     */
+    uint32 maximumNumberOfTokens;
+
+    /**
+     * The compiled instructions
+     */
+    CompiledInstruction *instructions;
+
+    /**
+     * Number of compiled instructions
+     */
+    uint32 numberOfInstructions;
+
+    /**
+     * The external and internal variables
+     */
+    CompiledVariable *variables;
+
+    /**
+     * Number of variables
+     */
+    uint32 numberOfVariables;
+
+    /**
+     * Maximum number of variables
+     */
+    uint32 maximumNumberOfVariables;
+
+    /**
+     * The compile time stack
+     */
+    CompiledOperand *stack;
+
+    /**
+     * Number of operands in the compile time stack
+     */
+    uint32 stackDepth;
+
+    /**
+     * Number of elements of the array variables
+     */
+    uint32 numberOfElements;
+
+    /**
+     * One register (of numberOfElements) for each stack position
+     */
+    //@{
+    float32 *float32Registers;
+    float64 *float64Registers;
+    //@}
+
+    /**
+     * The constants
+     */
+    CompiledValue *constants;
+
+    /**
+     * Number of constants
+     */
+    uint32 numberOfConstants;
+
+    /**
+     * The internal variables (numberOfElements each)
+     */
+    //@{
+    float32 *float32InternalVariables;
+    float64 *float64InternalVariables;
+    //@}
+
+    /**
+     * Number of internal variables
+     */
+    uint32 numberOfInternalVariables;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MATHEXPRESSIONCOMPILER_H_ */
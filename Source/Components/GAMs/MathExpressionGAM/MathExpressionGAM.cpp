@@ -47,8 +47,11 @@ MathExpressionGAM::MathExpressionGAM() :
     
     mathParser    = NULL_PTR(MathExpressionParser*);
     evaluator     = NULL_PTR(RuntimeEvaluator*);
+    compiler      = NULL_PTR(MathExpressionCompiler*);
     inputSignals  = NULL_PTR(SignalStruct*);
     outputSignals = NULL_PTR(SignalStruct*);
+    compiledBackend = false;
+    optimise = false;
 }
 
 /*lint -e{1551} destructor needs to delete the allocated components*/
@@ -60,6 +63,9 @@ MathExpressionGAM::~MathExpressionGAM() {
     if (evaluator != NULL) {
         delete evaluator;
     }
+    if (compiler != NULL) {
+        delete compiler;
+    }
     if (inputSignals != NULL) {
         delete[] inputSignals;
     }
@@ -81,21 +87,57 @@ bool MathExpressionGAM::Initialise(StructuredDataI &data) {
         }
     }
     
-    // Parser initialization
+    // Evaluation backend
     if (ok) {
-        (void) expr.Seek(0LLU);
-        mathParser = new MathExpressionParser(expr);
-        ok = mathParser->Parse();
-        if (!ok) {
-            REPORT_ERROR(ErrorManagement::InitialisationError,
-                "Failed to parse input Expression.");
+        StreamString backend;
+        if (data.Read("Backend", backend)) {
+            if (backend == "Compiled") {
+                compiledBackend = true;
+            }
+            else if (backend != "Interpreter") {
+                ok = false;
+                REPORT_ERROR(ErrorManagement::ParametersError,
+                    "Backend shall be Interpreter or Compiled.");
+            }
+            else {
+                compiledBackend = false;
+            }
+        }
+    }
+    
+    // Optimisation of the expression
+    if (ok) {
+        uint32 optimiseValue = 0u;
+        if (data.Read("Optimise", optimiseValue)) {
+            optimise = (optimiseValue != 0u);
+        }
+    }
+    
+    // Parser initialization (only if no other instance has already parsed the same expression)
+    if (ok) {
+        StreamString parseKey = "Parse:";
+        MathExpressionCache::NormaliseExpression(expr.Buffer(), parseKey);
+        if (!MathExpressionCache::Instance().Find(parseKey.Buffer(), stackMachineExpression)) {
+            (void) expr.Seek(0LLU);
+            mathParser = new MathExpressionParser(expr);
+            ok = mathParser->Parse();
+            if (ok) {
+                stackMachineExpression = mathParser->GetStackMachineExpression();
+                (void) MathExpressionCache::Instance().Add(parseKey.Buffer(), stackMachineExpression.Buffer());
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError,
+                    "Failed to parse input Expression.");
+            }
+            // only the stack machine program is needed after this point
+            delete mathParser;
+            mathParser = NULL_PTR(MathExpressionParser*);
         }
     }
     
     // Evaluator initialization
     if (ok) {
-        /*lint -e{613} ok = True => mathParser != NULL*/
-        evaluator = new RuntimeEvaluator(mathParser->GetStackMachineExpression());
+        evaluator = new RuntimeEvaluator(stackMachineExpression.Buffer());
     }
 
     return ok;
@@ -128,33 +170,156 @@ bool MathExpressionGAM::Setup() {
         }
     }
     
-    // 1. Checks
+    // 1. Checks (array signals are only supported by the MathExpressionCompiler)
+    bool arraySignals = false;
     for (uint32 signalIdx = 0u; (signalIdx < numberOfInputSignals) && ok; signalIdx++) {
-        ok = (inputSignals[signalIdx].numberOfElements == 1u);
-        if (!ok) {
-            REPORT_ERROR(ErrorManagement::UnsupportedFeature,
-                "Input signal %s has %u elements (> 1). Only scalar signals are supported.",
-                (inputSignals[signalIdx].name).Buffer(), inputSignals[signalIdx].numberOfElements);
-        } 
+        if (inputSignals[signalIdx].numberOfElements > 1u) {
+            arraySignals = true;
+            ok = compiledBackend;
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::UnsupportedFeature,
+                    "Input signal %s has %u elements (> 1). Only scalar signals are supported (unless Backend = Compiled).",
+                    (inputSignals[signalIdx].name).Buffer(), inputSignals[signalIdx].numberOfElements);
+            }
+        }
     }
     
     for (uint32 signalIdx = 0u; (signalIdx < numberOfOutputSignals) && ok; signalIdx++) {
-        ok = (outputSignals[signalIdx].numberOfElements == 1u);
-        if (!ok) {
-            REPORT_ERROR(ErrorManagement::UnsupportedFeature,
-                "Output signal %s has %u elements (> 1). Only scalar signals are supported.",
-                (outputSignals[signalIdx].name).Buffer(), outputSignals[signalIdx].numberOfElements);
-        } 
+        if (outputSignals[signalIdx].numberOfElements > 1u) {
+            arraySignals = true;
+            ok = compiledBackend;
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::UnsupportedFeature,
+                    "Output signal %s has %u elements (> 1). Only scalar signals are supported (unless Backend = Compiled).",
+                    (outputSignals[signalIdx].name).Buffer(), outputSignals[signalIdx].numberOfElements);
+            }
+        }
     }
     
-    // 2. Evaluator initialization
-    if (ok) {
-        /*lint -e{613} ok = True => evaluator != NULL*/
-        ok = evaluator->ExtractVariables();
-        if (!ok) {
-            REPORT_ERROR(ErrorManagement::InitialisationError,
-                "Failed RuntimeEvaluator::ExtractVariables().");
+    // 2. Optimisation of the stack machine program (optional)
+    // The optimised program only depends on the program and on the names and types of the signals:
+    // it is shared with the other instances with the same key (an empty program if not optimisable).
+    bool evaluatorReady = false;
+    if (ok && optimise) {
+        StreamString optimisedExpression;
+        StreamString optimiseKey = "Optimise:";
+        optimiseKey += stackMachineExpression.Buffer();
+        for (uint32 signalIdx = 0u; signalIdx < numberOfInputSignals; signalIdx++) {
+            optimiseKey += "\nIn:";
+            optimiseKey += inputSignals[signalIdx].name.Buffer();
+            optimiseKey += ":";
+            optimiseKey += TypeDescriptor::GetTypeNameFromTypeDescriptor(inputSignals[signalIdx].type);
+        }
+        for (uint32 signalIdx = 0u; signalIdx < numberOfOutputSignals; signalIdx++) {
+            optimiseKey += "\nOut:";
+            optimiseKey += outputSignals[signalIdx].name.Buffer();
+            optimiseKey += ":";
+            optimiseKey += TypeDescriptor::GetTypeNameFromTypeDescriptor(outputSignals[signalIdx].type);
+        }
+        bool optimised = MathExpressionCache::Instance().Find(optimiseKey.Buffer(), optimisedExpression);
+        if (optimised) {
+            optimised = (optimisedExpression.Size() > 0u);
         }
+        else {
+            MathExpressionOptimiser optimiser;
+            optimised = optimiser.Initialise(stackMachineExpression.Buffer(), numberOfInputSignals + numberOfOutputSignals);
+            for (uint32 signalIdx = 0u; (signalIdx < numberOfInputSignals) && (optimised); signalIdx++) {
+                optimised = optimiser.AddVariable(inputSignals[signalIdx].name.Buffer(), inputSignals[signalIdx].type);
+            }
+            for (uint32 signalIdx = 0u; (signalIdx < numberOfOutputSignals) && (optimised); signalIdx++) {
+                optimised = optimiser.AddVariable(outputSignals[signalIdx].name.Buffer(), outputSignals[signalIdx].type);
+            }
+            if (optimised) {
+                optimised = optimiser.Optimise(optimisedExpression);
+            }
+            if (optimised) {
+                REPORT_ERROR(ErrorManagement::Information,
+                    "Expression optimised from %u to %u instructions.",
+                    optimiser.GetNumberOfInstructions(), optimiser.GetNumberOfOptimisedInstructions());
+            }
+            (void) MathExpressionCache::Instance().Add(optimiseKey.Buffer(), optimised ? optimisedExpression.Buffer() : "");
+        }
+        if (optimised) {
+            delete evaluator;
+            evaluator = new RuntimeEvaluator(optimisedExpression.Buffer());
+            optimised = SetupEvaluator();
+            if (optimised) {
+                stackMachineExpression = optimisedExpression;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::Warning,
+                    "Optimised expression not supported by the RuntimeEvaluator. The original expression will be evaluated.");
+                delete evaluator;
+                evaluator = new RuntimeEvaluator(stackMachineExpression.Buffer());
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::Warning,
+                "Expression not supported by the MathExpressionOptimiser. The original expression will be evaluated.");
+        }
+        evaluatorReady = optimised;
+    }
+    
+    // 3. Evaluator initialization and compilation
+    if (ok && (!evaluatorReady)) {
+        ok = SetupEvaluator();
+    }
+    
+    // 4. Compilation of the expression with the MathExpressionCompiler (optional)
+    if (ok && compiledBackend) {
+        compiler = new MathExpressionCompiler();
+        bool compiled = compiler->Initialise(stackMachineExpression.Buffer(), numberOfInputSignals + numberOfOutputSignals);
+        for (uint32 signalIdx = 0u; (signalIdx < numberOfInputSignals) && (compiled); signalIdx++) {
+            compiled = compiler->AddVariable(inputSignals[signalIdx].name.Buffer(), inputSignals[signalIdx].type, GetInputSignalMemory(signalIdx),
+                                             inputSignals[signalIdx].numberOfElements);
+        }
+        for (uint32 signalIdx = 0u; (signalIdx < numberOfOutputSignals) && (compiled); signalIdx++) {
+            compiled = compiler->AddVariable(outputSignals[signalIdx].name.Buffer(), outputSignals[signalIdx].type, GetOutputSignalMemory(signalIdx),
+                                             outputSignals[signalIdx].numberOfElements);
+        }
+        if (compiled) {
+            compiled = compiler->Compile();
+        }
+        if (!compiled) {
+            delete compiler;
+            compiler = NULL_PTR(MathExpressionCompiler*);
+            // the RuntimeEvaluator can only evaluate scalars
+            ok = !arraySignals;
+            if (ok) {
+                REPORT_ERROR(ErrorManagement::Warning,
+                    "Expression not supported by the MathExpressionCompiler. It will be evaluated by the RuntimeEvaluator.");
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError,
+                    "Expression with array signals not supported by the MathExpressionCompiler.");
+            }
+        }
+    }
+    
+    return ok;
+}
+
+bool MathExpressionGAM::Execute() {
+    bool ok = true;
+    if (compiler != NULL) {
+        compiler->Execute();
+    }
+    else {
+        /*lint -e{613} ok = True => evaluator != NULL*/
+        ok = evaluator->Execute();
+    }
+    return ok;
+    
+}
+
+bool MathExpressionGAM::SetupEvaluator() {
+    
+    // Evaluator initialization
+    /*lint -e{613} Initialise() = True => evaluator != NULL*/
+    bool ok = evaluator->ExtractVariables();
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError,
+            "Failed RuntimeEvaluator::ExtractVariables().");
     }
     
     // look for input variable among input signals
@@ -192,7 +357,7 @@ bool MathExpressionGAM::Setup() {
         
     }
     
-    // 4. Check that all variables have been assigned to a signal or parameter.
+    // Check that all variables have been assigned to a signal or parameter.
     uint32 index;
     VariableInformation* var;
     
@@ -217,7 +382,8 @@ bool MathExpressionGAM::Setup() {
     /*lint -e{613} Initialise() = True => evaluator != NULL*/
     while(evaluator->BrowseOutputVariable(index, var) && ok) {
         
-        if (var->externalLocation == NULL) {
+        // temporary variables of the MathExpressionOptimiser are internal by construction
+        if ((var->externalLocation == NULL) && (!MathExpressionOptimiser::IsTemporaryVariable((var->name).Buffer()))) {
             REPORT_ERROR(ErrorManagement::Warning,
                         "Can't associate output variable '%s': no output signal of the same name. By default it is considered internal.",
                         (var->name).Buffer());
@@ -225,7 +391,7 @@ bool MathExpressionGAM::Setup() {
         index++;
     }
     
-    // 5. Compilation
+    // Compilation
     if (ok) {
         /*lint -e{613} ok = True => evaluator != NULL*/
         ok = evaluator->Compile();
@@ -239,10 +405,8 @@ bool MathExpressionGAM::Setup() {
     return ok;
 }
 
-bool MathExpressionGAM::Execute() {
-    /*lint -e{613} ok = True => evaluator != NULL*/
-    return evaluator->Execute();
-    
+bool MathExpressionGAM::IsCompiled() const {
+    return (compiler != NULL);
 }
 
 CLASS_REGISTER(MathExpressionGAM, "1.0")
@@ -33,6 +33,9 @@
 /*---------------------------------------------------------------------------*/
 
 #include "GAM.h"
+#include "MathExpressionCache.h"
+#include "MathExpressionCompiler.h"
+#include "MathExpressionOptimiser.h"
 #include "MathExpressionParser.h"
 #include "RuntimeEvaluator.h"
 
@@ -109,7 +112,7 @@ namespace MARTe {
  * 
  * The GAM supports:
  *  - signals of any numeric type
- *  - scalar signals only
+ *  - scalar signals only (with `Backend = Interpreter`)
  * 
  * During initialisation, each variable in the expression is automatically
  * associated to the signal with the same name:
@@ -158,6 +161,47 @@ namespace MARTe {
  * F = (float64) G*((float64) m1 + (float64) m2)/pow((float64) r, (float64) 2);
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * 
+ * By default the expression is evaluated by the RuntimeEvaluator,
+ * which interprets the stack machine program in each cycle.
+ * With `Backend = Compiled` the program is translated in Setup()
+ * by the MathExpressionCompiler in a list of pre-decoded
+ * instructions which read and write directly the signal memory
+ * (no stack operations and no type resolution in Execute()).
+ * Expressions which use operations or types not supported by the
+ * MathExpressionCompiler (see its documentation) are evaluated by
+ * the RuntimeEvaluator (a warning is issued).
+ * 
+ * With `Backend = Compiled` the signals can also be arrays, in which
+ * case the expression is evaluated element by element: each operation
+ * is called once per cycle and loops over all the elements. All the
+ * array signals must have the same number of elements, scalar signals
+ * and constants are broadcast to all the elements (e.g.
+ * `Out = Gain * In + Offset;` with `In` and `Out` arrays of 256
+ * elements and `Gain` and `Offset` scalars). Expressions with array
+ * signals which are not supported by the MathExpressionCompiler
+ * fail the Setup().
+ * 
+ * With `Optimise = 1` the stack machine program is optimised in Setup()
+ * by the MathExpressionOptimiser before being compiled by either backend:
+ * constant operations are folded (e.g. `Out = In * (2 * pi);` performs
+ * one multiplication per cycle), trivial identities (e.g. `x * 1`) are
+ * removed and common subexpressions are computed only once (e.g. the
+ * two `sin(In1)` in `Out1 = sin(In1) * In2; Out2 = sin(In1) + In3;`),
+ * storing them in internal variables named `CSE@N` if required.
+ * If the program can not be optimised, or if the RuntimeEvaluator does
+ * not accept the optimised program, the original program is used
+ * (a warning is issued).
+ * 
+ * The stack machine programs are shared by all the instances of the
+ * process (see MathExpressionCache): an expression is only parsed by
+ * the first instance with the same text (ignoring the formatting
+ * whitespaces) and is only optimised by the first instance with the
+ * same program and the same signal names and types. The other instances
+ * reuse the program and only build their own RuntimeEvaluator (or
+ * MathExpressionCompiler), which binds the memory of their signals.
+ * Configurations with many instances of the same expression are thus
+ * initialised much faster.
+ * 
  * The configuration syntax is (signal names are only given as
  * an example and can be changed):
  * 
@@ -169,6 +213,8 @@ namespace MARTe {
  *                   Out1 = ( In1 + (float32) In2 ) * ((float32) 10);
  *                   Out2 = (float64) Out1 + pi + 10;
  *                  "
+ *     Backend = Interpreter          // Optional. Interpreter (default) or Compiled.
+ *     Optimise = 0                   // Optional. 1 to optimise the expression (default 0).
  *     InputSignals = {               // As many as required.
  *         In1 = {
  *             Type = float32
@@ -211,7 +257,9 @@ public:
      *            configuration file. 
      * @details   During the initialization phase, number of inputs
      *            and outputs are read from the configuration file
-     *            and the `Expression` is stored.
+     *            and the `Expression`, the `Backend` and the `Optimise`
+     *            flag are stored. The expression is parsed, unless
+     *            another instance has already parsed it.
      * @param[in] data the GAM configuration specified in the
      *                 configuration file.
      * @return    `true` on succeed.
@@ -223,13 +271,20 @@ public:
      * @details This method:
      *          1. checks if signal dimensions retrieved from
      *             the configuration file are compatible with the GAM
-     *          2. set the types of each variable according
+     *             (arrays require `Backend = Compiled`)
+     *          2. if `Optimise = 1`, optimises the expression with
+     *             the MathExpressionOptimiser (falling back to the
+     *             original expression if not supported)
+     *          3. set the types of each variable according
      *             to signal types
-     *          3. set the memory location of each variable to be
+     *          4. set the memory location of each variable to be
      *             the same of the corresponding signal memory,
      *             so that no memcopy is required during execution
-     *          4. compiles the expression (the expression does not
-     *             need to be recompiled each time it is evaluated).
+     *          5. compiles the expression (the expression does not
+     *             need to be recompiled each time it is evaluated)
+     *          6. if `Backend = Compiled`, translates the expression
+     *             with the MathExpressionCompiler (falling back to
+     *             the RuntimeEvaluator if not supported).
      * 
      * @return  `true` on succeed.
      * @pre     
@@ -248,11 +303,20 @@ public:
      */
     virtual bool Execute();
 
+    /**
+     * @brief  Queries if the expression is evaluated by the MathExpressionCompiler.
+     * @return `true` if `Backend = Compiled` and the expression
+     *         was compiled in Setup().
+     */
+    bool IsCompiled() const;
+
 protected:
 
     /**
      * @brief Pointer to the instance of the MathExpressionParser
-     *        that will parse the input expression.
+     *        that will parse the input expression (only during
+     *        Initialise() and only if the expression is not already
+     *        in the MathExpressionCache, NULL otherwise).
      */
     MathExpressionParser* mathParser;
     
@@ -262,8 +326,23 @@ protected:
      */
     RuntimeEvaluator*     evaluator;
 
+    /**
+     * @brief Pointer to the instance of the MathExpressionCompiler
+     *        that will evaluate the input expression if
+     *        `Backend = Compiled` (NULL otherwise).
+     */
+    MathExpressionCompiler* compiler;
+
 private:
     
+    /**
+     * @brief Associates the variables of the evaluator to the signals
+     *        and compiles the expression (steps 3. to 5. of Setup()).
+     * @return `true` if all the input variables are associated to
+     *         a signal and the expression is compiled.
+     */
+    bool SetupEvaluator();
+    
     /**
      * @brief Structure to hold information about signals.
      */
@@ -288,6 +367,22 @@ private:
      */
     StreamString expr;
     
+    /**
+     * @brief The stack machine program which is evaluated
+     *        (optimised if `Optimise = 1`).
+     */
+    StreamString stackMachineExpression;
+    
+    /**
+     * @brief `true` if `Backend = Compiled`.
+     */
+    bool compiledBackend;
+    
+    /**
+     * @brief `true` if `Optimise = 1`.
+     */
+    bool optimise;
+    
 };
 
 } /* MARTe */
@@ -0,0 +1,654 @@
+/**
+ * @file MathExpressionOptimiser.cpp
+ * @brief Source file for class MathExpressionOptimiser
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionOptimiser (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "AnyType.h"
+#include "MathExpressionOptimiser.h"
+#include "StringHelper.h"
+#include "TypeConversion.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+const MARTe::char8 * const temporaryPrefix = "CSE@";
+
+bool IsSeparator(const MARTe::char8 c) {
+    return ((c == ' ') || (c == '\t') || (c == '\n') || (c == '\r'));
+}
+
+/**
+ * @brief Computes the operation in the precision of T.
+ * @return false if the operation is not foldable or the result is not finite.
+ */
+template<typename T>
+bool Fold(const MARTe::StreamString &operation,
+          const T x1,
+          const T x2,
+          MARTe::float64 &result) {
+    bool ok = true;
+    T y = static_cast<T>(0.0);
+    if (operation == "ADD") {
+        y = x1 + x2;
+    }
+    else if (operation == "SUB") {
+        y = x1 - x2;
+    }
+    else if (operation == "MUL") {
+        y = x1 * x2;
+    }
+    else if (operation == "DIV") {
+        y = x1 / x2;
+    }
+    else if (operation == "POW") {
+        y = static_cast<T>(pow(x1, x2));
+    }
+    else if (operation == "SIN") {
+        y = static_cast<T>(sin(x1));
+    }
+    else if (operation == "COS") {
+        y = static_cast<T>(cos(x1));
+    }
+    else {
+        ok = false;
+    }
+    if (ok) {
+        //Not a number and infinite values are not folded.
+        T difference = y - y;
+        ok = (difference == static_cast<T>(0.0));
+    }
+    if (ok) {
+        result = static_cast<MARTe::float64>(y);
+    }
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MathExpressionOptimiser::MathExpressionOptimiser() {
+    programPosition = 0u;
+    maximumNumberOfTokens = 0u;
+    nodes = NULL_PTR(OptimiserNode *);
+    numberOfNodes = 0u;
+    statements = NULL_PTR(OptimiserStatement *);
+    numberOfStatements = 0u;
+    variables = NULL_PTR(OptimiserVariable *);
+    numberOfVariables = 0u;
+    maximumNumberOfVariables = 0u;
+    numberOfTemporaries = 0u;
+    numberOfInstructions = 0u;
+    numberOfOptimisedInstructions = 0u;
+}
+
+/*lint -e{1551} the destructor must guarantee that the memory is freed*/
+MathExpressionOptimiser::~MathExpressionOptimiser() {
+    if (nodes != NULL_PTR(OptimiserNode *)) {
+        delete[] nodes;
+    }
+    if (statements != NULL_PTR(OptimiserStatement *)) {
+        delete[] statements;
+    }
+    if (variables != NULL_PTR(OptimiserVariable *)) {
+        delete[] variables;
+    }
+}
+
+bool MathExpressionOptimiser::Initialise(const char8 * const stackMachineExpression,
+                                         const uint32 numberOfExternalVariables) {
+    bool ok = (nodes == NULL_PTR(OptimiserNode *));
+    if (ok) {
+        ok = (stackMachineExpression != NULL_PTR(const char8 *));
+    }
+    if (ok) {
+        program = stackMachineExpression;
+        //Each node, stack position, assignment, internal and temporary variable requires at least one token.
+        maximumNumberOfTokens = 1u;
+        bool previousSeparator = true;
+        for (uint32 i = 0u; stackMachineExpression[i] != '\0'; i++) {
+            bool separator = IsSeparator(stackMachineExpression[i]);
+            if ((!separator) && (previousSeparator)) {
+                maximumNumberOfTokens++;
+            }
+            previousSeparator = separator;
+        }
+        maximumNumberOfVariables = numberOfExternalVariables + (2u * maximumNumberOfTokens);
+        nodes = new OptimiserNode[maximumNumberOfTokens];
+        statements = new OptimiserStatement[maximumNumberOfTokens];
+        variables = new OptimiserVariable[maximumNumberOfVariables];
+    }
+    return ok;
+}
+
+bool MathExpressionOptimiser::AddVariable(const char8 * const name,
+                                          const TypeDescriptor &type) {
+    bool ok = (variables != NULL_PTR(OptimiserVariable *));
+    StreamString variableName = name;
+    if (ok) {
+        ok = (FindVariable(variableName) == numberOfVariables);
+    }
+    if (ok) {
+        ok = ((numberOfVariables + (2u * maximumNumberOfTokens)) < maximumNumberOfVariables);
+    }
+    if (ok) {
+        variables[numberOfVariables].name = variableName;
+        variables[numberOfVariables].type = type;
+        variables[numberOfVariables].version = 0u;
+        variables[numberOfVariables].value = maximumNumberOfTokens;
+        numberOfVariables++;
+    }
+    return ok;
+}
+
+bool MathExpressionOptimiser::Optimise(StreamString &optimisedExpression) {
+    bool ok = (nodes != NULL_PTR(OptimiserNode *));
+    if (ok) {
+        ok = (numberOfNodes == 0u);
+    }
+    if (ok) {
+        ok = BuildTrees();
+    }
+    if (ok) {
+        uint32 i;
+        for (i = 0u; i < numberOfStatements; i++) {
+            CountReferences(statements[i].root);
+        }
+        //The versions of the variables are replayed while writing the program.
+        for (i = 0u; i < numberOfVariables; i++) {
+            variables[i].version = 0u;
+        }
+        optimisedExpression = "";
+        for (i = 0u; i < numberOfStatements; i++) {
+            uint32 root = statements[i].root;
+            uint32 variable = statements[i].variable;
+            WriteTemporaries(root, true, optimisedExpression);
+            WriteNode(root, optimisedExpression);
+            WriteInstruction("WRITE", variables[variable].name.Buffer(), NULL_PTR(const char8 *), optimisedExpression);
+            variables[variable].version++;
+            nodes[root].availableVariable = variable;
+            nodes[root].availableVersion = variables[variable].version;
+        }
+    }
+    return ok;
+}
+
+uint32 MathExpressionOptimiser::GetNumberOfInstructions() const {
+    return numberOfInstructions;
+}
+
+uint32 MathExpressionOptimiser::GetNumberOfOptimisedInstructions() const {
+    return numberOfOptimisedInstructions;
+}
+
+bool MathExpressionOptimiser::IsTemporaryVariable(const char8 * const name) {
+    return (StringHelper::CompareN(name, temporaryPrefix, StringHelper::Length(temporaryPrefix)) == 0);
+}
+
+bool MathExpressionOptimiser::GetNextToken(StreamString &token) {
+    const char8 * const buffer = program.Buffer();
+    while ((buffer[programPosition] != '\0') && (IsSeparator(buffer[programPosition]))) {
+        programPosition++;
+    }
+    bool ok = (buffer[programPosition] != '\0');
+    while ((buffer[programPosition] != '\0') && (!IsSeparator(buffer[programPosition]))) {
+        token += buffer[programPosition];
+        programPosition++;
+    }
+    return ok;
+}
+
+bool MathExpressionOptimiser::BuildTrees() {
+    uint32 *stack = new uint32[maximumNumberOfTokens];
+    uint32 stackDepth = 0u;
+    bool ok = true;
+    StreamString operation;
+    programPosition = 0u;
+    while ((ok) && (GetNextToken(operation))) {
+        numberOfInstructions++;
+        StreamString parameter;
+        StreamString value;
+        uint32 numberOfOperands = GetNumberOfOperands(operation);
+        if (operation == "WRITE") {
+            ok = GetNextToken(parameter);
+            //Only complete assignments are supported.
+            if (ok) {
+                ok = (stackDepth == 1u);
+            }
+            if (ok) {
+                stackDepth--;
+                uint32 idx = FindVariable(parameter);
+                if (idx == numberOfVariables) {
+                    ok = (numberOfVariables < maximumNumberOfVariables);
+                    if (ok) {
+                        variables[idx].name = parameter;
+                        variables[idx].type = nodes[stack[0u]].type;
+                        variables[idx].version = 0u;
+                        numberOfVariables++;
+                    }
+                }
+                if (ok) {
+                    statements[numberOfStatements].root = stack[0u];
+                    statements[numberOfStatements].variable = idx;
+                    numberOfStatements++;
+                    variables[idx].version++;
+                    //The variable can be replaced by the assigned node only if no type conversion is involved.
+                    if (variables[idx].type == nodes[stack[0u]].type) {
+                        variables[idx].value = stack[0u];
+                    }
+                    else {
+                        variables[idx].value = maximumNumberOfTokens;
+                    }
+                }
+            }
+        }
+        else if (numberOfOperands <= 2u) {
+            uint32 version = 0u;
+            uint32 knownValue = maximumNumberOfTokens;
+            if (operation == "READ") {
+                ok = GetNextToken(parameter);
+                if (ok) {
+                    uint32 idx = FindVariable(parameter);
+                    if (idx == numberOfVariables) {
+                        ok = (numberOfVariables < maximumNumberOfVariables);
+                        if (ok) {
+                            variables[idx].name = parameter;
+                            variables[idx].type = InvalidType;
+                            variables[idx].version = 0u;
+                            variables[idx].value = maximumNumberOfTokens;
+                            numberOfVariables++;
+                        }
+                    }
+                    if (ok) {
+                        version = variables[idx].version;
+                        knownValue = variables[idx].value;
+                    }
+                }
+            }
+            else if (operation == "CONST") {
+                ok = GetNextToken(parameter);
+                if (ok) {
+                    ok = GetNextToken(value);
+                }
+            }
+            else if (operation == "CAST") {
+                ok = GetNextToken(parameter);
+            }
+            else {
+                //No parameters
+            }
+            if (ok) {
+                ok = (stackDepth >= numberOfOperands);
+            }
+            if (ok) {
+                stackDepth -= numberOfOperands;
+                uint32 node = knownValue;
+                if (node == maximumNumberOfTokens) {
+                    node = GetNode(operation, parameter, value, &stack[stackDepth], numberOfOperands, version);
+                }
+                ok = (node < maximumNumberOfTokens);
+                if (ok) {
+                    stack[stackDepth] = node;
+                    stackDepth++;
+                }
+            }
+        }
+        else {
+            ok = false;
+        }
+        operation = "";
+    }
+    if (ok) {
+        ok = (stackDepth == 0u);
+    }
+    delete[] stack;
+    return ok;
+}
+
+uint32 MathExpressionOptimiser::GetNode(const StreamString &operation,
+                                        const StreamString &parameter,
+                                        const StreamString &value,
+                                        const uint32 * const operands,
+                                        const uint32 numberOfOperands,
+                                        const uint32 version) {
+    uint32 node = maximumNumberOfTokens;
+    if (!Simplify(operation, parameter, operands, numberOfOperands, node)) {
+        uint32 i;
+        //Value numbering.
+        for (i = 0u; (i < numberOfNodes) && (node == maximumNumberOfTokens); i++) {
+            bool equal = ((nodes[i].operation == operation) && (nodes[i].parameter == parameter) && (nodes[i].value == value));
+            equal = (equal && (nodes[i].numberOfOperands == numberOfOperands) && (nodes[i].version == version));
+            for (uint32 j = 0u; (j < numberOfOperands) && (equal); j++) {
+                equal = (nodes[i].operands[j] == operands[j]);
+            }
+            if (equal) {
+                node = i;
+            }
+        }
+        if ((node == maximumNumberOfTokens) && (numberOfNodes < maximumNumberOfTokens)) {
+            node = numberOfNodes;
+            numberOfNodes++;
+            OptimiserNode &newNode = nodes[node];
+            newNode.operation = operation;
+            newNode.parameter = parameter;
+            newNode.value = value;
+            newNode.numberOfOperands = numberOfOperands;
+            newNode.version = version;
+            newNode.type = InvalidType;
+            newNode.constantValue = 0.0;
+            newNode.isFloatConstant = false;
+            newNode.references = 0u;
+            newNode.availableVariable = maximumNumberOfVariables;
+            newNode.availableVersion = 0u;
+            for (i = 0u; i < numberOfOperands; i++) {
+                newNode.operands[i] = operands[i];
+            }
+            if (operation == "READ") {
+                newNode.type = variables[FindVariable(parameter)].type;
+            }
+            else if (operation == "CONST") {
+                newNode.type = TypeDescriptor::GetTypeDescriptorFromTypeName(parameter.Buffer());
+                if (newNode.type == Float32Bit) {
+                    float32 constantValue32 = 0.0F;
+                    newNode.isFloatConstant = TypeConvert(constantValue32, value.Buffer());
+                    newNode.constantValue = static_cast<float64>(constantValue32);
+                }
+                else if (newNode.type == Float64Bit) {
+                    newNode.isFloatConstant = TypeConvert(newNode.constantValue, value.Buffer());
+                }
+                else {
+                    //Not a float constant
+                }
+            }
+            else if (operation == "CAST") {
+                newNode.type = TypeDescriptor::GetTypeDescriptorFromTypeName(parameter.Buffer());
+            }
+            else if ((operation == "SIN") || (operation == "COS")) {
+                if (IsFloatType(nodes[operands[0u]].type)) {
+                    newNode.type = nodes[operands[0u]].type;
+                }
+            }
+            else if ((operation == "ADD") || (operation == "SUB") || (operation == "MUL") || (operation == "DIV") || (operation == "POW")) {
+                if ((IsFloatType(nodes[operands[0u]].type)) && (nodes[operands[0u]].type == nodes[operands[1u]].type)) {
+                    newNode.type = nodes[operands[0u]].type;
+                }
+            }
+            else {
+                //The type of the other operations is not known.
+            }
+        }
+    }
+    return node;
+}
+
+bool MathExpressionOptimiser::Simplify(const StreamString &operation,
+                                       const StreamString &parameter,
+                                       const uint32 * const operands,
+                                       const uint32 numberOfOperands,
+                                       uint32 &node) {
+    bool simplified = false;
+    bool folded = false;
+    TypeDescriptor type = InvalidType;
+    float64 result = 0.0;
+    if ((operation == "CAST") && (numberOfOperands == 1u)) {
+        const OptimiserNode &x = nodes[operands[0u]];
+        type = TypeDescriptor::GetTypeDescriptorFromTypeName(parameter.Buffer());
+        if (IsFloatType(type)) {
+            if (x.type == type) {
+                node = operands[0u];
+                simplified = true;
+            }
+            else if (x.isFloatConstant) {
+                result = (type == Float32Bit) ? static_cast<float64>(static_cast<float32>(x.constantValue)) : x.constantValue;
+                folded = true;
+            }
+            else {
+                //Not simplified
+            }
+        }
+    }
+    else if (numberOfOperands == 1u) {
+        const OptimiserNode &x = nodes[operands[0u]];
+        if (x.isFloatConstant) {
+            type = x.type;
+            if (type == Float32Bit) {
+                folded = Fold<float32>(operation, static_cast<float32>(x.constantValue), 0.0F, result);
+            }
+            else {
+                folded = Fold<float64>(operation, x.constantValue, 0.0, result);
+            }
+        }
+    }
+    else if (numberOfOperands == 2u) {
+        uint32 x1 = operands[0u];
+        uint32 x2 = operands[1u];
+        type = nodes[x1].type;
+        if ((IsFloatType(type)) && (nodes[x2].type == type)) {
+            if ((nodes[x1].isFloatConstant) && (nodes[x2].isFloatConstant)) {
+                if (type == Float32Bit) {
+                    folded = Fold<float32>(operation, static_cast<float32>(nodes[x1].constantValue), static_cast<float32>(nodes[x2].constantValue), result);
+                }
+                else {
+                    folded = Fold<float64>(operation, nodes[x1].constantValue, nodes[x2].constantValue, result);
+                }
+            }
+            //Identities
+            if (!folded) {
+                if ((operation == "MUL") && (IsConstant(x2, type, 1.0))) {
+                    node = x1;
+                    simplified = true;
+                }
+                else if ((operation == "MUL") && (IsConstant(x1, type, 1.0))) {
+                    node = x2;
+                    simplified = true;
+                }
+                else if ((operation == "ADD") && (IsConstant(x2, type, 0.0))) {
+                    node = x1;
+                    simplified = true;
+                }
+                else if ((operation == "ADD") && (IsConstant(x1, type, 0.0))) {
+                    node = x2;
+                    simplified = true;
+                }
+                else if ((operation == "SUB") && (IsConstant(x2, type, 0.0))) {
+                    node = x1;
+                    simplified = true;
+                }
+                else if (((operation == "DIV") || (operation == "POW")) && (IsConstant(x2, type, 1.0))) {
+                    node = x1;
+                    simplified = true;
+                }
+                else {
+                    //Not simplified
+                }
+            }
+        }
+    }
+    else {
+        //Leaves are not simplified
+    }
+    if (folded) {
+        StreamString constantValue;
+        bool printed;
+        if (type == Float32Bit) {
+            printed = constantValue.Printf("%.9e", static_cast<float32>(result));
+        }
+        else {
+            printed = constantValue.Printf("%.17e", result);
+        }
+        if (printed) {
+            StreamString typeName = TypeDescriptor::GetTypeNameFromTypeDescriptor(type);
+            node = GetNode("CONST", typeName, constantValue, NULL_PTR(const uint32 *), 0u, 0u);
+            simplified = (node < maximumNumberOfTokens);
+        }
+    }
+    return simplified;
+}
+
+bool MathExpressionOptimiser::IsConstant(const uint32 node,
+                                         const TypeDescriptor &type,
+                                         const float64 value) const {
+    bool ok = (nodes[node].isFloatConstant);
+    if (ok) {
+        ok = (nodes[node].type == type);
+    }
+    if (ok) {
+        ok = (nodes[node].constantValue == value);
+    }
+    return ok;
+}
+
+void MathExpressionOptimiser::CountReferences(const uint32 node) {
+    nodes[node].references++;
+    if (nodes[node].references == 1u) {
+        for (uint32 i = 0u; i < nodes[node].numberOfOperands; i++) {
+            CountReferences(nodes[node].operands[i]);
+        }
+    }
+}
+
+void MathExpressionOptimiser::WriteTemporaries(const uint32 node,
+                                               const bool isRoot,
+                                               StreamString &output) {
+    if ((!IsAvailable(node)) && (nodes[node].numberOfOperands > 0u)) {
+        for (uint32 i = 0u; i < nodes[node].numberOfOperands; i++) {
+            WriteTemporaries(nodes[node].operands[i], false, output);
+        }
+        if ((!isRoot) && (nodes[node].references > 1u) && (numberOfVariables < maximumNumberOfVariables)) {
+            uint32 idx = numberOfVariables;
+            numberOfVariables++;
+            StreamString temporaryNumber;
+            (void) temporaryNumber.Printf("%u", numberOfTemporaries);
+            variables[idx].name = temporaryPrefix;
+            variables[idx].name += temporaryNumber;
+            variables[idx].type = nodes[node].type;
+            variables[idx].version = 1u;
+            variables[idx].value = node;
+            numberOfTemporaries++;
+            WriteNode(node, output);
+            WriteInstruction("WRITE", variables[idx].name.Buffer(), NULL_PTR(const char8 *), output);
+            nodes[node].availableVariable = idx;
+            nodes[node].availableVersion = 1u;
+        }
+    }
+}
+
+void MathExpressionOptimiser::WriteNode(const uint32 node,
+                                        StreamString &output) {
+    const OptimiserNode &x = nodes[node];
+    if (IsAvailable(node)) {
+        WriteInstruction("READ", variables[x.availableVariable].name.Buffer(), NULL_PTR(const char8 *), output);
+    }
+    else if (x.operation == "READ") {
+        WriteInstruction("READ", x.parameter.Buffer(), NULL_PTR(const char8 *), output);
+    }
+    else if (x.operation == "CONST") {
+        WriteInstruction("CONST", x.parameter.Buffer(), x.value.Buffer(), output);
+    }
+    else {
+        for (uint32 i = 0u; i < x.numberOfOperands; i++) {
+            WriteNode(x.operands[i], output);
+        }
+        const char8 * const parameter = (x.parameter.Size() > 0u) ? (x.parameter.Buffer()) : (NULL_PTR(const char8 *));
+        WriteInstruction(x.operation.Buffer(), parameter, NULL_PTR(const char8 *), output);
+    }
+}
+
+void MathExpressionOptimiser::WriteInstruction(const char8 * const operation,
+                                               const char8 * const parameter,
+                                               const char8 * const value,
+                                               StreamString &output) {
+    output += operation;
+    if (parameter != NULL_PTR(const char8 *)) {
+        output += " ";
+        output += parameter;
+    }
+    if (value != NULL_PTR(const char8 *)) {
+        output += " ";
+        output += value;
+    }
+    output += "\n";
+    numberOfOptimisedInstructions++;
+}
+
+bool MathExpressionOptimiser::IsAvailable(const uint32 node) const {
+    bool available = (nodes[node].availableVariable < numberOfVariables);
+    if (available) {
+        available = (variables[nodes[node].availableVariable].version == nodes[node].availableVersion);
+    }
+    return available;
+}
+
+uint32 MathExpressionOptimiser::FindVariable(const StreamString &name) const {
+    uint32 idx = numberOfVariables;
+    for (uint32 i = 0u; (i < numberOfVariables) && (idx == numberOfVariables); i++) {
+        if (variables[i].name == name) {
+            idx = i;
+        }
+    }
+    return idx;
+}
+
+uint32 MathExpressionOptimiser::GetNumberOfOperands(const StreamString &operation) {
+    uint32 numberOfOperands = 3u;
+    if ((operation == "READ") || (operation == "CONST")) {
+        numberOfOperands = 0u;
+    }
+    else if ((operation == "CAST") || (operation == "SIN") || (operation == "COS") || (operation == "NOT")) {
+        numberOfOperands = 1u;
+    }
+    else if ((operation == "ADD") || (operation == "SUB") || (operation == "MUL") || (operation == "DIV") || (operation == "POW")) {
+        numberOfOperands = 2u;
+    }
+    else if ((operation == "AND") || (operation == "OR") || (operation == "XOR")) {
+        numberOfOperands = 2u;
+    }
+    else if ((operation == "LT") || (operation == "GT") || (operation == "LTE") || (operation == "GTE") || (operation == "EQ") || (operation == "NEQ")) {
+        numberOfOperands = 2u;
+    }
+    else {
+        //Not known
+    }
+    return numberOfOperands;
+}
+
+bool MathExpressionOptimiser::IsFloatType(const TypeDescriptor &type) {
+    return ((type == Float32Bit) || (type == Float64Bit));
+}
+
+}
@@ -0,0 +1,365 @@
+/**
+ * @file MathExpressionOptimiser.h
+ * @brief Header file for class MathExpressionOptimiser
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MathExpressionOptimiser
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MATHEXPRESSIONOPTIMISER_H_
+#define MATHEXPRESSIONOPTIMISER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "CompilerTypes.h"
+#include "StreamString.h"
+#include "TypeDescriptor.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Optimises the stack machine program of a MathExpressionParser before it is compiled by the RuntimeEvaluator.
+ * @details The program is translated in one expression tree for each assignment (WRITE). The nodes are numbered by value
+ * (same operation on the same operands, where reading a variable gives the node last assigned to it or, if not known, a new value
+ * after each assignment), so that:
+ *  - constant sub-trees of float32 or float64 operations (ADD, SUB, MUL, DIV, POW, SIN, COS and CAST to float) are folded in a CONST;
+ *  - the identities x * 1, 1 * x, x + 0, 0 + x, x - 0, x / 1, pow(x, 1) and the CAST of x to its own type are simplified to x
+ *    (only if the type of x is known and equal to the type of the constant);
+ *  - the common subexpressions are computed only once. The result is read from the variable where it was assigned (if not
+ *    overwritten in the meanwhile) or is assigned, before the first assignment that requires it, to a temporary variable
+ *    (named CSE\@N, see IsTemporaryVariable()).
+ *
+ * The type of a variable is known if it was added with AddVariable() or if it is assigned with the result of an operation of known type.
+ *
+ * Optimise() fails (and the original program should be used) if the program contains an operation which is not known
+ * by the optimiser or if an assignment is done with other values pending in the stack.
+ */
+class MathExpressionOptimiser {
+public:
+
+    /**
+     * @brief Default constructor.
+     * @post
+     *   GetNumberOfInstructions() == 0u &&
+     *   GetNumberOfOptimisedInstructions() == 0u
+     */
+    MathExpressionOptimiser();
+
+    /**
+     * @brief Frees the allocated memory.
+     */
+    ~MathExpressionOptimiser();
+
+    /**
+     * @brief Allocates the memory required to optimise the program.
+     * @param[in] stackMachineExpression the program to be optimised (see MathExpressionParser::GetStackMachineExpression()).
+     * @param[in] numberOfExternalVariables maximum number of variables which will be added with AddVariable().
+     * @return true if the memory was allocated and the method was not already called.
+     */
+    bool Initialise(const char8 * const stackMachineExpression,
+                    const uint32 numberOfExternalVariables);
+
+    /**
+     * @brief Declares the type of a variable of the program (e.g. a signal).
+     * @param[in] name the name of the variable.
+     * @param[in] type the type of the variable.
+     * @return true if the variable was not already added and less than numberOfExternalVariables were added.
+     * @pre
+     *   Initialise()
+     */
+    bool AddVariable(const char8 * const name,
+                     const TypeDescriptor &type);
+
+    /**
+     * @brief Optimises the program.
+     * @param[out] optimisedExpression the optimised program.
+     * @return true if the program could be optimised (see class description).
+     * @pre
+     *   Initialise()
+     */
+    bool Optimise(StreamString &optimisedExpression);
+
+    /**
+     * @brief Gets the number of instructions of the original program.
+     * @return the number of instructions of the original program.
+     */
+    uint32 GetNumberOfInstructions() const;
+
+    /**
+     * @brief Gets the number of instructions of the optimised program.
+     * @return the number of instructions of the optimised program.
+     */
+    uint32 GetNumberOfOptimisedInstructions() const;
+
+    /**
+     * @brief Queries if the variable is a temporary variable created by the optimiser.
+     * @param[in] name the name of the variable.
+     * @return true if the name starts with CSE\@.
+     */
+    static bool IsTemporaryVariable(const char8 * const name);
+
+private:
+
+    /**
+     * @brief A node of the expression trees.
+     */
+    struct OptimiserNode {
+        /**
+         * The operation (READ and CONST are the leaves)
+         */
+        StreamString operation;
+        /**
+         * The variable name (READ) or the type name (CONST and CAST)
+         */
+        StreamString parameter;
+        /**
+         * The value of the constant (CONST)
+         */
+        StreamString value;
+        /**
+         * The operands
+         */
+        uint32 operands[2];
+        /**
+         * The number of operands
+         */
+        uint32 numberOfOperands;
+        /**
+         * The version of the variable (READ)
+         */
+        uint32 version;
+        /**
+         * The type of the result (InvalidType if not known)
+         */
+        TypeDescriptor type;
+        /**
+         * The value of the constant, if CONST of float32 or float64
+         */
+        float64 constantValue;
+        /**
+         * True if constantValue is valid
+         */
+        bool isFloatConstant;
+        /**
+         * Number of references from other nodes and assignments
+         */
+        uint32 references;
+        /**
+         * Index of the variable where the result is available (numberOfVariables if not available)
+         */
+        uint32 availableVariable;
+        /**
+         * Version of the variable where the result is available
+         */
+        uint32 availableVersion;
+    };
+
+    /**
+     * @brief A variable of the program.
+     */
+    struct OptimiserVariable {
+        StreamString name;
+        TypeDescriptor type;
+        uint32 version;
+        /**
+         * The node last assigned to the variable (maximumNumberOfTokens if not known)
+         */
+        uint32 value;
+    };
+
+    /**
+     * @brief An assignment of the program.
+     */
+    struct OptimiserStatement {
+        uint32 root;
+        uint32 variable;
+    };
+
+    /**
+     * @brief Reads the next token of the program.
+     * @param[out] token the token.
+     * @return false if there are no more tokens.
+     */
+    bool GetNextToken(StreamString &token);
+
+    /**
+     * @brief Translates the program in expression trees.
+     * @return true if all the operations are known.
+     */
+    bool BuildTrees();
+
+    /**
+     * @brief Returns the existing node with the same value or creates a new one (after folding and simplification).
+     * @return the index of the node or maximumNumberOfTokens if there is no memory available.
+     */
+    uint32 GetNode(const StreamString &operation,
+                   const StreamString &parameter,
+                   const StreamString &value,
+                   const uint32 * const operands,
+                   const uint32 numberOfOperands,
+                   const uint32 version);
+
+    /**
+     * @brief Tries to fold the constant operation or to simplify the identity.
+     * @param[out] node the index of the equivalent node.
+     * @return true if the operation was folded or simplified.
+     */
+    bool Simplify(const StreamString &operation,
+                  const StreamString &parameter,
+                  const uint32 * const operands,
+                  const uint32 numberOfOperands,
+                  uint32 &node);
+
+    /**
+     * @brief Queries if the node is a float constant of the type equal to value.
+     */
+    bool IsConstant(const uint32 node,
+                    const TypeDescriptor &type,
+                    const float64 value) const;
+
+    /**
+     * @brief Counts the references of the nodes which are reachable from the assignments.
+     */
+    void CountReferences(const uint32 node);
+
+    /**
+     * @brief Assigns to temporary variables the common subexpressions of the tree which are not available.
+     */
+    void WriteTemporaries(const uint32 node,
+                          const bool isRoot,
+                          StreamString &output);
+
+    /**
+     * @brief Writes the program which computes the node.
+     */
+    void WriteNode(const uint32 node,
+                   StreamString &output);
+
+    /**
+     * @brief Writes one instruction.
+     */
+    void WriteInstruction(const char8 * const operation,
+                          const char8 * const parameter,
+                          const char8 * const value,
+                          StreamString &output);
+
+    /**
+     * @brief Queries if the result of the node is available in a variable.
+     */
+    bool IsAvailable(const uint32 node) const;
+
+    /**
+     * @brief Searches a variable by name.
+     * @return the index of the variable or numberOfVariables if it does not exist.
+     */
+    uint32 FindVariable(const StreamString &name) const;
+
+    /**
+     * @brief Gets the number of operands of the operation.
+     * @return the number of operands or 3 if the operation is not known.
+     */
+    static uint32 GetNumberOfOperands(const StreamString &operation);
+
+    /**
+     * @brief Queries if the type is float32 or float64.
+     */
+    static bool IsFloatType(const TypeDescriptor &type);
+
+    /**
+     * The program to be optimised
+     */
+    StreamString program;
+
+    /**
+     * Position of the next token in the program
+     */
+    uint32 programPosition;
+
+    /**
+     * Maximum number of tokens (upper bound of the number of nodes, of the stack depth and of the assignments)
+     */
+    uint32 maximumNumberOfTokens;
+
+    /**
+     * The nodes
+     */
+    OptimiserNode *nodes;
+
+    /**
+     * Number of nodes
+     */
+    uint32 numberOfNodes;
+
+    /**
+     * The assignments
+     */
+    OptimiserStatement *statements;
+
+    /**
+     * Number of assignments
+     */
+    uint32 numberOfStatements;
+
+    /**
+     * The variables (external, internal and temporary)
+     */
+    OptimiserVariable *variables;
+
+    /**
+     * Number of variables
+     */
+    uint32 numberOfVariables;
+
+    /**
+     * Maximum number of variables
+     */
+    uint32 maximumNumberOfVariables;
+
+    /**
+     * Number of temporary variables
+     */
+    uint32 numberOfTemporaries;
+
+    /**
+     * Number of instructions of the original program
+     */
+    uint32 numberOfInstructions;
+
+    /**
+     * Number of instructions of the optimised program
+     */
+    uint32 numberOfOptimisedInstructions;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MATHEXPRESSIONOPTIMISER_H_ */
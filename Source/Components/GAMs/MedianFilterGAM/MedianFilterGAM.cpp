@@ -0,0 +1,282 @@
+/**
+ * @file MedianFilterGAM.cpp
+ * @brief Source file for class MedianFilterGAM
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MedianFilterGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MedianFilterGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MedianFilterGAM::MedianFilterGAM() :
+        GAM() {
+    signals = NULL_PTR(MedianFilterGAMSignal *);
+    numberOfSignals = 0u;
+    windowSize = 0u;
+    mode = MedianFilterGAMChannels;
+    resetInEachState = true;
+}
+
+/*lint -e{1551} the destructor must guarantee that the windows are freed.*/
+MedianFilterGAM::~MedianFilterGAM() {
+    if (signals != NULL_PTR(MedianFilterGAMSignal *)) {
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            if (signals[i].windows != NULL_PTR(uint8 *)) {
+                delete[] signals[i].windows;
+            }
+            if (signals[i].sorted != NULL_PTR(uint8 *)) {
+                delete[] signals[i].sorted;
+            }
+        }
+        delete[] signals;
+    }
+}
+
+bool MedianFilterGAM::Initialise(StructuredDataI &data) {
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        ok = data.Read("WindowSize", windowSize);
+        if (ok) {
+            ok = (windowSize > 0u);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "WindowSize shall be specified and be > 0");
+        }
+    }
+    if (ok) {
+        StreamString modeName = "Channels";
+        (void) data.Read("Mode", modeName);
+        if (modeName == "Channels") {
+            mode = MedianFilterGAMChannels;
+        }
+        else if (modeName == "Samples") {
+            mode = MedianFilterGAMSamples;
+        }
+        else {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Mode shall be Channels or Samples");
+        }
+    }
+    if (ok) {
+        uint32 reset = 1u;
+        (void) data.Read("ResetInEachState", reset);
+        ok = (reset <= 1u);
+        if (ok) {
+            resetInEachState = (reset == 1u);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "ResetInEachState shall be 0 or 1");
+        }
+    }
+    return ok;
+}
+
+bool MedianFilterGAM::Setup() {
+    numberOfSignals = GetNumberOfInputSignals();
+    bool ok = (numberOfSignals > 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "At least one input signal shall be specified");
+    }
+    if (ok) {
+        ok = (GetNumberOfOutputSignals() == numberOfSignals);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The number of output signals shall be equal to the number of input signals (%u)", numberOfSignals);
+        }
+    }
+    if (ok) {
+        signals = new MedianFilterGAMSignal[numberOfSignals];
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            signals[i].input = NULL_PTR(const void *);
+            signals[i].output = NULL_PTR(void *);
+            signals[i].type = InvalidType;
+            signals[i].numberOfChannels = 0u;
+            signals[i].numberOfValues = 0u;
+            signals[i].windows = NULL_PTR(uint8 *);
+            signals[i].sorted = NULL_PTR(uint8 *);
+            signals[i].head = 0u;
+            signals[i].primed = false;
+        }
+    }
+    for (uint32 i = 0u; (i < numberOfSignals) && (ok); i++) {
+        /*lint -e{613} signals cannot be NULL as otherwise ok would be false*/
+        MedianFilterGAMSignal &signal = signals[i];
+        signal.type = GetSignalType(InputSignals, i);
+        ok = (signal.type == GetSignalType(OutputSignals, i));
+        if (ok) {
+            ok = ((signal.type == SignedInteger8Bit) || (signal.type == UnsignedInteger8Bit) || (signal.type == SignedInteger16Bit)
+                    || (signal.type == UnsignedInteger16Bit) || (signal.type == SignedInteger32Bit) || (signal.type == UnsignedInteger32Bit)
+                    || (signal.type == Float32Bit) || (signal.type == Float64Bit));
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The output signal %u shall have the type of the input signal %u "
+                         "(int8, uint8, int16, uint16, int32, uint32, float32 or float64)", i, i);
+        }
+        uint32 inputElements = 0u;
+        uint32 inputSamples = 0u;
+        uint32 outputElements = 0u;
+        uint32 outputSamples = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(InputSignals, i, inputElements);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(InputSignals, i, inputSamples);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(OutputSignals, i, outputElements);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(OutputSignals, i, outputSamples);
+        }
+        if (ok) {
+            ok = ((inputElements == outputElements) && (inputSamples == outputSamples));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The output signal %u shall have the number of elements and samples of the input signal %u",
+                             i, i);
+            }
+        }
+        if (ok) {
+            if (mode == MedianFilterGAMChannels) {
+                signal.numberOfChannels = inputElements;
+                signal.numberOfValues = inputSamples;
+            }
+            else {
+                signal.numberOfChannels = 1u;
+                signal.numberOfValues = inputElements * inputSamples;
+            }
+            uint32 windowsSize = signal.numberOfChannels * windowSize * (static_cast<uint32>(signal.type.numberOfBits) / 8u);
+            signal.windows = new uint8[windowsSize];
+            signal.sorted = new uint8[windowsSize];
+            signal.input = GetInputSignalMemory(i);
+            signal.output = GetOutputSignalMemory(i);
+        }
+    }
+    return ok;
+}
+
+bool MedianFilterGAM::Execute() {
+    for (uint32 i = 0u; i < numberOfSignals; i++) {
+        /*lint -e{613} signals cannot be NULL as Execute is only called after a successful Setup*/
+        MedianFilterGAMSignal &signal = signals[i];
+        if (signal.type == Float32Bit) {
+            Filter<float32>(signal);
+        }
+        else if (signal.type == Float64Bit) {
+            Filter<float64>(signal);
+        }
+        else if (signal.type == SignedInteger8Bit) {
+            Filter<int8>(signal);
+        }
+        else if (signal.type == UnsignedInteger8Bit) {
+            Filter<uint8>(signal);
+        }
+        else if (signal.type == SignedInteger16Bit) {
+            Filter<int16>(signal);
+        }
+        else if (signal.type == UnsignedInteger16Bit) {
+            Filter<uint16>(signal);
+        }
+        else if (signal.type == SignedInteger32Bit) {
+            Filter<int32>(signal);
+        }
+        else {
+            Filter<uint32>(signal);
+        }
+    }
+    return true;
+}
+
+bool MedianFilterGAM::PrepareNextState(const char8 * const currentStateName,
+                                       const char8 * const nextStateName) {
+    bool reset = resetInEachState;
+    if (!reset) {
+        reset = (lastStateExecuted != currentStateName);
+        lastStateExecuted = nextStateName;
+    }
+    if ((reset) && (signals != NULL_PTR(MedianFilterGAMSignal *))) {
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            signals[i].head = 0u;
+            signals[i].primed = false;
+        }
+    }
+    return true;
+}
+
+uint32 MedianFilterGAM::GetWindowSize() const {
+    return windowSize;
+}
+
+MedianFilterGAMMode MedianFilterGAM::GetMode() const {
+    return mode;
+}
+
+bool MedianFilterGAM::GetResetInEachState() const {
+    return resetInEachState;
+}
+
+template<typename T>
+void MedianFilterGAM::Filter(MedianFilterGAMSignal &signal) const {
+    const T *input = static_cast<const T *>(signal.input);
+    T *output = static_cast<T *>(signal.output);
+    /*lint -e{927} -e{826} the windows are allocated in Setup with numberOfChannels * windowSize values of type T.*/
+    T *windows = reinterpret_cast<T *>(signal.windows);
+    /*lint -e{927} -e{826} the windows are allocated in Setup with numberOfChannels * windowSize values of type T.*/
+    T *sorted = reinterpret_cast<T *>(signal.sorted);
+    const uint32 numberOfChannels = signal.numberOfChannels;
+    if (!signal.primed) {
+        for (uint32 c = 0u; c < numberOfChannels; c++) {
+            for (uint32 w = 0u; w < windowSize; w++) {
+                windows[(c * windowSize) + w] = input[c];
+                sorted[(c * windowSize) + w] = input[c];
+            }
+        }
+        signal.primed = true;
+    }
+    uint32 head = signal.head;
+    for (uint32 v = 0u; v < signal.numberOfValues; v++) {
+        for (uint32 c = 0u; c < numberOfChannels; c++) {
+            uint32 idx = (v * numberOfChannels) + c;
+            output[idx] = Replace<T>(&windows[c * windowSize], &sorted[c * windowSize], head, input[idx]);
+        }
+        head++;
+        if (head == windowSize) {
+            head = 0u;
+        }
+    }
+    signal.head = head;
+}
+
+CLASS_REGISTER(MedianFilterGAM, "1.0")
+}
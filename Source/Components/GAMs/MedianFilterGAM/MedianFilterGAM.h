@@ -0,0 +1,305 @@
+/**
+ * @file MedianFilterGAM.h
+ * @brief Header file for class MedianFilterGAM
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MedianFilterGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MEDIANFILTERGAM_H_
+#define MEDIANFILTERGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief How the elements of the signals are filtered.
+ */
+enum MedianFilterGAMMode {
+    MedianFilterGAMChannels = 0,
+    MedianFilterGAMSamples = 1
+};
+
+/**
+ * @brief The windows of the channels of a signal.
+ */
+struct MedianFilterGAMSignal {
+    /**
+     * The memory of the input signal.
+     */
+    const void *input;
+
+    /**
+     * The memory of the output signal.
+     */
+    void *output;
+
+    /**
+     * The type of the signal.
+     */
+    TypeDescriptor type;
+
+    /**
+     * The number of channels of the signal.
+     */
+    uint32 numberOfChannels;
+
+    /**
+     * The number of values of each channel in each cycle.
+     */
+    uint32 numberOfValues;
+
+    /**
+     * The last WindowSize values of each channel, in order of arrival (a ring for each channel).
+     */
+    uint8 *windows;
+
+    /**
+     * The last WindowSize values of each channel, sorted.
+     */
+    uint8 *sorted;
+
+    /**
+     * The position of the oldest value in the rings.
+     */
+    uint32 head;
+
+    /**
+     * True once the windows have been filled with the first values.
+     */
+    bool primed;
+};
+
+/**
+ * @brief GAM which filters signals with a running median (e.g. to reject spikes in diagnostic channels).
+ * @details Each output signal is the running median of the input signal with the same index and shall have the same type and number of
+ * elements and samples. The median of each channel is computed over its last WindowSize values; for an even WindowSize it is the upper
+ * of the two middle values. The signals can be int8, uint8, int16, uint16, int32, uint32, float32 or float64 (and shall not be NaN).
+ *
+ * With Mode = Channels each element of a signal is an independent channel, which has a new value in each cycle (or NumberOfSamples new
+ * values) and the output element is the median of the last WindowSize cycles. With Mode = Samples each signal is a single channel whose
+ * elements are consecutive samples (e.g. a block acquired by an ADC in each cycle): each output element is the median of the WindowSize
+ * samples which end in the same input element, the window continuing from the samples of the previous cycle.
+ *
+ * Each channel keeps its window both in order of arrival (a ring) and sorted. Each new value replaces the oldest one in the sorted window
+ * by moving only the values between the two positions (the oldest value is found with a binary search), so the median is read directly
+ * and a new value costs O(log(WindowSize)) comparisons plus as many moves as the values between the oldest and the new value
+ * (O(WindowSize) in the worst case). A pair of heaps or a skiplist would bound this to O(log(WindowSize)), but they have to find and
+ * remove the oldest value through an index, which costs more branches and scattered accesses per value than moving a few contiguous
+ * values. The sorted insert is thus faster for the windows used to reject spikes (up to a few tens of values), where the moves of
+ * the worst case stay within a few cache lines, and for slowly varying signals, where only a few values move.
+ *
+ * In the first cycle the windows are filled with the first value of each channel, so the output starts from the input and not from zero.
+ * The windows are filled again in the first cycle after a state change (see PrepareNextState).
+ *
+ * The configuration syntax is (names and signal quantities are only given as an example):
+ *
+ * <pre>
+ * +Median = {
+ *     Class = MedianFilterGAM
+ *     WindowSize = 5 //Compulsory. > 0.
+ *     Mode = Channels //Optional. Channels or Samples. Default = Channels.
+ *     ResetInEachState = 1 //Optional. 0 or 1. If 1 the windows are reset on each state change. Otherwise they are reset only if the GAM was not executed in the previous state. Default = 1.
+ *     InputSignals = {
+ *         Diagnostics = {
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 16
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         DiagnosticsFiltered = {
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 16
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class MedianFilterGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    MedianFilterGAM();
+
+    /**
+     * @brief Frees the windows.
+     */
+    virtual ~MedianFilterGAM();
+
+    /**
+     * @brief Reads the WindowSize, the Mode and the ResetInEachState.
+     * @return true if GAM::Initialise succeeds, WindowSize > 0, Mode is Channels or Samples and ResetInEachState (if set) is 0 or 1.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals and allocates the windows.
+     * @return true if the number of input and output signals is the same and each output signal has the type, the number of elements
+     * and samples of its input signal (and the type is supported).
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Pushes the inputs in the windows and writes their medians in the outputs.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Resets the windows, so that they are filled again with the first values of the next Execute.
+     * @details If ResetInEachState is 0 the windows are only reset if the GAM was not executed in the previous state
+     * (i.e. if \a currentStateName is not the last state for which this method was called).
+     * @param[in] currentStateName the current state.
+     * @param[in] nextStateName the next state.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief Gets the WindowSize.
+     */
+    uint32 GetWindowSize() const;
+
+    /**
+     * @brief Gets the Mode.
+     */
+    MedianFilterGAMMode GetMode() const;
+
+    /**
+     * @brief Gets the ResetInEachState.
+     */
+    bool GetResetInEachState() const;
+
+private:
+
+    /**
+     * @brief Filters a signal of type T.
+     */
+    template<typename T>
+    void Filter(MedianFilterGAMSignal &signal) const;
+
+    /**
+     * @brief Replaces the oldest value of a window with a new one and returns the median.
+     * @param[in,out] ring the window in order of arrival.
+     * @param[in,out] sorted the sorted window.
+     * @param[in] head the position of the oldest value in the ring.
+     * @param[in] value the new value.
+     * @return the median of the window.
+     */
+    template<typename T>
+    inline T Replace(T * const ring,
+                     T * const sorted,
+                     const uint32 head,
+                     const T value) const;
+
+    /**
+     * The signals.
+     */
+    MedianFilterGAMSignal *signals;
+
+    /**
+     * The number of signals.
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * The number of values of each window.
+     */
+    uint32 windowSize;
+
+    /**
+     * How the elements of the signals are filtered.
+     */
+    MedianFilterGAMMode mode;
+
+    /**
+     * If true the windows are reset on each state change.
+     */
+    bool resetInEachState;
+
+    /**
+     * The last state in which the GAM was executed (only used if resetInEachState is false).
+     */
+    StreamString lastStateExecuted;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+template<typename T>
+inline T MedianFilterGAM::Replace(T * const ring,
+                                  T * const sorted,
+                                  const uint32 head,
+                                  const T value) const {
+    T oldest = ring[head];
+    ring[head] = value;
+    uint32 low = 0u;
+    uint32 high = windowSize;
+    while (low < high) {
+        uint32 middle = (low + high) / 2u;
+        if (sorted[middle] < oldest) {
+            low = middle + 1u;
+        }
+        else {
+            high = middle;
+        }
+    }
+    //sorted[low] is the oldest value: move the values between it and the position of the new value.
+    uint32 position = low;
+    if (oldest < value) {
+        while (((position + 1u) < windowSize) && (sorted[position + 1u] < value)) {
+            sorted[position] = sorted[position + 1u];
+            position++;
+        }
+    }
+    else {
+        while ((position > 0u) && (value < sorted[position - 1u])) {
+            sorted[position] = sorted[position - 1u];
+            position--;
+        }
+    }
+    sorted[position] = value;
+    return sorted[windowSize / 2u];
+}
+
+}
+
+#endif /* MEDIANFILTERGAM_H_ */
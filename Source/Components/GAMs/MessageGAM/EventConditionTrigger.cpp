@@ -29,6 +29,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "EventConditionTrigger.h"
 #include "EventSem.h"
 #include "QueuedReplyMessageCatcherFilter.h"
@@ -65,6 +66,11 @@ EventConditionTrigger::EventConditionTrigger() :
     eventConditions = NULL_PTR(EventConditionField *);
     numberOfConditions = 0u;
     replied = 0u;
+    messageQueue = NULL_PTR(uint32 *);
+    queueSize = 0u;
+    queueHead = 0;
+    queueTail = 0;
+    overflows = 0u;
     if (!eventSem.Create()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem.");
     }
@@ -79,6 +85,9 @@ EventConditionTrigger::~EventConditionTrigger() {
     if (eventConditions != NULL_PTR(EventConditionField *)) {
         delete[] eventConditions;
     }
+    if (messageQueue != NULL_PTR(uint32 *)) {
+        delete[] messageQueue;
+    }
 }
 
 bool EventConditionTrigger::Initialise(StructuredDataI &data) {
@@ -114,6 +123,21 @@ bool EventConditionTrigger::Initialise(StructuredDataI &data) {
             }
         }
     }
+    if (ret) {
+        uint32 queueSizeIn;
+        if (!data.Read("QueueSize", queueSizeIn)) {
+            queueSizeIn = 4u * Size();
+        }
+        if (queueSizeIn < Size()) {
+            queueSizeIn = Size();
+            REPORT_ERROR(ErrorManagement::Warning, "QueueSize smaller than the number of Messages, using %d", queueSizeIn);
+        }
+        queueSize = 1u;
+        while (queueSize < queueSizeIn) {
+            queueSize <<= 1u;
+        }
+        messageQueue = new uint32[queueSize];
+    }
     if (ret) {
         executor.SetCPUMask(cpuMask);
     }
@@ -199,19 +223,23 @@ bool EventConditionTrigger::Check(const uint8 * const memoryArea,
 
         if (trigger) {
             uint32 numberOfChildren = Size();
-            for (uint32 i = 0u; i < numberOfChildren; i++) {
-                ReferenceT < Message > message = Get(i);
-                if (message.IsValid()) {
-                    if (static_cast<bool>(spinLock.FastLock())) {
-                        REPORT_ERROR(ErrorManagement::Information, "Inserted message");
-                        if (!messageQueue.Insert(message)) {
-                            REPORT_ERROR(ErrorManagement::Warning, "Failed Insert of the message in the queue");
-                        }
-                        spinLock.FastUnLock();
-                    }
+            uint32 head = static_cast<uint32>(queueHead);
+            uint32 used = head - static_cast<uint32>(queueTail);
+            trigger = ((queueSize - used) >= numberOfChildren);
+            if (trigger) {
+                for (uint32 i = 0u; i < numberOfChildren; i++) {
+                    /*lint -e{613} messageQueue is allocated in Initialise.*/
+                    messageQueue[(head + i) & (queueSize - 1u)] = i;
                 }
+                //Publish the messages to the internal thread
+                for (uint32 i = 0u; i < numberOfChildren; i++) {
+                    Atomic::Increment(&queueHead);
+                }
+                (void) eventSem.Post();
+            }
+            else {
+                overflows++;
             }
-            (void) eventSem.Post();
         }
     }
 
@@ -219,6 +247,29 @@ bool EventConditionTrigger::Check(const uint8 * const memoryArea,
 
 }
 
+bool EventConditionTrigger::GetCommandKey(const SignalMetadata * const metadataIn,
+                                          uint64 &key) const {
+    bool found = false;
+    for (uint32 i = 0u; (i < numberOfConditions) && (!found); i++) {
+        /*lint -e{613} NULL pointer checked.*/
+        found = (metadataIn == eventConditions[i].signalMetadata);
+        if (found) {
+            uint32 byteSize = static_cast<uint32>(metadataIn->type.numberOfBits) / 8u;
+            /*lint -e{613} NULL pointer checked.*/
+            key = GetKey(static_cast<const uint8 *>(eventConditions[i].at.GetDataPointer()), byteSize);
+        }
+    }
+    return found;
+}
+
+uint64 EventConditionTrigger::GetKey(const uint8 * const value,
+                                     const uint32 byteSize) {
+    uint64 key = 0u;
+    uint32 keySize = (byteSize < static_cast<uint32>(sizeof(uint64))) ? (byteSize) : (static_cast<uint32>(sizeof(uint64)));
+    (void) MemoryOperationsHelper::Copy(&key, value, keySize);
+    return key;
+}
+
 ErrorManagement::ErrorType EventConditionTrigger::Execute(ExecutionInfo & info) {
 
     ErrorManagement::ErrorType err = ErrorManagement::NoError;
@@ -228,11 +279,8 @@ ErrorManagement::ErrorType EventConditionTrigger::Execute(ExecutionInfo & info)
     }
     else if (info.GetStage() != ExecutionInfo::BadTerminationStage) {
         //pull from the queue
-        uint32 nMessages = 0u;
-        if (static_cast<bool>(spinLock.FastLock())) {
-            nMessages = messageQueue.Size();
-            spinLock.FastUnLock();
-        }
+        uint32 tail = static_cast<uint32>(queueTail);
+        uint32 nMessages = static_cast<uint32>(queueHead) - tail;
 
         if (nMessages > 0u) {
 
@@ -248,11 +296,8 @@ ErrorManagement::ErrorType EventConditionTrigger::Execute(ExecutionInfo & info)
 
             //Only accept indirect replies
             for (uint32 i = 0u; i < nMessages; i++) {
-                ReferenceT < Message > eventMsg;
-                if (static_cast<bool>(spinLock.FastLock())) {
-                    eventMsg = messageQueue.Get(i);
-                    spinLock.FastUnLock();
-                }
+                /*lint -e{613} messageQueue is allocated in Initialise.*/
+                ReferenceT < Message > eventMsg = Get(messageQueue[(tail + i) & (queueSize - 1u)]);
                 if (eventMsg.IsValid()) {
                     if (eventMsg->ExpectsIndirectReply()) {
                         err = !eventReplyContainer.Insert(eventMsg);
@@ -283,12 +328,10 @@ ErrorManagement::ErrorType EventConditionTrigger::Execute(ExecutionInfo & info)
             ok = err.ErrorsCleared();
             /*lint -e{850} the loop variable i is not modified within the loop*/
             for (uint32 i = 0u; (i < nMessages) && (ok); i++) {
-                ReferenceT < Message > eventMsg;
-                if (static_cast<bool>(spinLock.FastLock())) {
-                    eventMsg = messageQueue.Get(0u);
-                    ok = messageQueue.Delete(eventMsg);
-                    spinLock.FastUnLock();
-                }
+                /*lint -e{613} messageQueue is allocated in Initialise.*/
+                ReferenceT < Message > eventMsg = Get(messageQueue[(tail + i) & (queueSize - 1u)]);
+                //Release the slot to Check()
+                Atomic::Increment(&queueTail);
                 if (ok) {
                     REPORT_ERROR(ErrorManagement::Information, "Message %s [%d] extracted", eventMsg->GetName(), i);
 
@@ -335,13 +378,9 @@ ErrorManagement::ErrorType EventConditionTrigger::Execute(ExecutionInfo & info)
             }
         }
         else {
-            if (static_cast<bool>(spinLock.FastLock())) {
-                if (messageQueue.Size() == 0u) {
-                    err = !eventSem.Reset();
-                }
-                spinLock.FastUnLock();
-            }
-            if (err.ErrorsCleared()) {
+            //Reset before checking the queue so that a Post() after the check is not lost
+            err = !eventSem.Reset();
+            if (err.ErrorsCleared() && (queueHead == queueTail)) {
                 err = eventSem.Wait(500u);
                 
                 if(!err.ErrorsCleared()) {
@@ -411,7 +450,6 @@ void EventConditionTrigger::Purge(ReferenceContainer &purgeList) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not close the EventSem.");
     }
 
-    messageQueue.Purge();
     ReferenceContainer::Purge(purgeList);
 
 }
@@ -420,6 +458,10 @@ const ProcessorType& EventConditionTrigger::GetCPUMask() const {
     return cpuMask;
 }
 
+uint32 EventConditionTrigger::GetOverflows() const {
+    return overflows;
+}
+
 CLASS_REGISTER(EventConditionTrigger, "1.0")
 
 }
@@ -80,12 +80,16 @@ struct SignalMetadata {
  * Moreover this object is a container of Message objects that will be sent if the memory in input to the Check() function matches the values specified in the "EventTrigger" block.
  *
  * @details If the event is triggered, the Check() function will insert the Messages to be sent in a queue that will be consumed by a separated thread.
+ * The queue is a bounded lock-free single producer (the thread calling Check()) single consumer (the internal thread) ring buffer
+ * of indexes of the contained Message objects, so that triggering an event neither allocates memory nor locks. If the queue cannot
+ * hold all the Messages of the event, the event is not triggered and the overflow is counted (see GetOverflows()).
  * The function Replied() returns the number of replied messages because the reply can be immediate or not (if the Message is declared with IsIndirectReply=true).
  *
  * @details Follows a configuration example:
  * <pre>
  *       +Events = {
  *           CPUMask = 0x1 //Default = 0xff. The affinity of thread that is going to send the messages.
+ *           QueueSize = 16 //Optional. Maximum number of Messages waiting to be sent, rounded up to a power of 2. Default = 4 times the number of Messages.
  *           Class = ReferenceContainer
  *           +Event1 = {
  *               Class = EventConditionTrigger
@@ -162,15 +166,37 @@ public:
      * @brief Checks if the variable values declared in the "EventTrigger" block configuration
      * match within the \a memory area in input.
      * @details If the variables match, the Message objects contained will be added to a queue that
-     * will be consumed within the Execute() function.
+     * will be consumed within the Execute() function. Shall always be called by the same thread.
      * @param[in] memoryArea is the memory area to be checked.
      * @param[in] metadataIn is the metadata associated to the command that trigger this event.
      * It must be one of the variables declared in "EventTrigger" block.
-     * @return true if the variables match within the \a memory area.
+     * @return true if the variables match within the \a memory area and all the Messages could be queued.
      */
     bool Check(const uint8 * const memoryArea,
                const SignalMetadata * const metadataIn);
 
+    /**
+     * @brief Gets the index key of the value expected by the "EventTrigger" block for a command.
+     * @param[in] metadataIn the metadata of the command.
+     * @param[out] key the expected value of the command (see GetKey()).
+     * @return true if the "EventTrigger" block has a condition on the command.
+     * @pre
+     *   SetMetadataConfig()
+     */
+    bool GetCommandKey(const SignalMetadata * const metadataIn,
+                       uint64 &key) const;
+
+    /**
+     * @brief Computes the key used to index the events by the value of a command.
+     * @details The (first 8) bytes of the value are copied in a zeroed uint64, so that equal values have equal keys. Different values
+     * may only have the same key if the type is larger than 8 bytes.
+     * @param[in] value the value of the command.
+     * @param[in] byteSize the size of the type of the command.
+     * @return the key.
+     */
+    static uint64 GetKey(const uint8 * const value,
+                         const uint32 byteSize);
+
     /**
      * @brief Returns the number of replies and reset the counter.
      * @return the number of replies to the sent messages.
@@ -195,6 +221,12 @@ public:
      */
     const ProcessorType& GetCPUMask() const;
 
+    /**
+     * @brief Gets the number of times the event was not triggered because the queue was full.
+     * @return the number of queue overflows.
+     */
+    uint32 GetOverflows() const;
+
     /**
      * @brief Holds one of the variables values declared within the "EventTrigger"
      * block of the EventConditionTrigger object configuration.
@@ -240,12 +272,32 @@ protected:
     uint32 numberOfConditions;
 
     /**
-     * A queue that contains the messages to be sent.
+     * A ring buffer with the indexes of the messages to be sent.
+     */
+    uint32 *messageQueue;
+
+    /**
+     * The size of messageQueue (power of 2).
+     */
+    uint32 queueSize;
+
+    /**
+     * Number of messages ever inserted in the messageQueue (only written by Check()).
+     */
+    volatile int32 queueHead;
+
+    /**
+     * Number of messages ever extracted from the messageQueue (only written by Execute()).
+     */
+    volatile int32 queueTail;
+
+    /**
+     * Number of queue overflows.
      */
-    ReferenceContainer messageQueue;
+    uint32 overflows;
 
     /**
-     * A spinlock mutex semaphore to synchronise with
+     * A spinlock mutex semaphore to synchronise the replied counter with
      * the internal thread that sends the messages.
      */
     FastPollingMutexSem spinLock;
@@ -50,9 +50,13 @@ MessageGAM::MessageGAM() :
     numberOfCommands = 0u;
     numberOfEvents = 0u;
     cntTrigger = NULL_PTR(uint32*);
+    queueOverflows = NULL_PTR(uint32*);
     currentValue = NULL_PTR(uint8*);
     previousValue = NULL_PTR(uint8*);
     commandIndex = NULL_PTR(uint32*);
+    eventTriggers = NULL_PTR(EventConditionTrigger**);
+    eventIndex = NULL_PTR(MessageGAMEventIndexEntry*);
+    eventIndexStart = NULL_PTR(uint32*);
     trigOnChange = true;
     firstTimeAfterStateChange = true;
     firstTime = true;
@@ -68,7 +72,17 @@ MessageGAM::~MessageGAM() {
     if (commandIndex != NULL_PTR(uint32*)) {
         delete[] commandIndex;
     }
+    if (eventTriggers != NULL_PTR(EventConditionTrigger**)) {
+        delete[] eventTriggers;
+    }
+    if (eventIndex != NULL_PTR(MessageGAMEventIndexEntry*)) {
+        delete[] eventIndex;
+    }
+    if (eventIndexStart != NULL_PTR(uint32*)) {
+        delete[] eventIndexStart;
+    }
     cntTrigger = NULL_PTR(uint32*);
+    queueOverflows = NULL_PTR(uint32*);
     currentValue = NULL_PTR(uint8*);
 }
 
@@ -202,13 +216,44 @@ bool MessageGAM::Setup() {
                 }
             }
         }
+        if (ret) {
+            ret = BuildEventIndex();
+        }
 
     }
 
     if (ret) {
 //check that the state signal has siz #elements
         uint32 totalNumberOfOutputs = 0u;
-        for (uint32 i = 0u; (i < numberOfOutputSignals) && (ret); i++) {
+        uint32 numberOfPendingSignals = numberOfOutputSignals;
+        if (numberOfOutputSignals > 0u) {
+            StreamString lastSignalName;
+            ret = GetSignalName(OutputSignals, numberOfOutputSignals - 1u, lastSignalName);
+            if (ret) {
+                if (lastSignalName == "QueueOverflows") {
+                    numberOfPendingSignals--;
+                    uint32 numberOfElements = 0u;
+                    ret = GetSignalNumberOfElements(OutputSignals, numberOfPendingSignals, numberOfElements);
+                    if (ret) {
+                        ret = (GetSignalType(OutputSignals, numberOfPendingSignals) == UnsignedInteger32Bit);
+                        if (!ret) {
+                            REPORT_ERROR(ErrorManagement::InitialisationError, "The type of the QueueOverflows signal must be uint32");
+                        }
+                    }
+                    if (ret) {
+                        ret = (numberOfElements == numberOfEvents);
+                        if (!ret) {
+                            REPORT_ERROR(ErrorManagement::InitialisationError, "The number of elements of QueueOverflows %d must match the number of events %d",
+                                         numberOfElements, numberOfEvents);
+                        }
+                    }
+                    if (ret) {
+                        queueOverflows = reinterpret_cast<uint32*>(GetOutputSignalMemory(numberOfPendingSignals));
+                    }
+                }
+            }
+        }
+        for (uint32 i = 0u; (i < numberOfPendingSignals) && (ret); i++) {
             TypeDescriptor td = GetSignalType(OutputSignals, i);
             ret = (td == UnsignedInteger32Bit);
             if (!ret) {
@@ -238,6 +283,53 @@ bool MessageGAM::Setup() {
     return ret;
 }
 
+bool MessageGAM::BuildEventIndex() {
+    eventTriggers = new EventConditionTrigger*[numberOfEvents];
+    bool ret = true;
+    for (uint32 j = 0u; (j < numberOfEvents) && (ret); j++) {
+        ReferenceT<EventConditionTrigger> eventCondition = events->Get(j);
+        ret = eventCondition.IsValid();
+        if (ret) {
+            eventTriggers[j] = eventCondition.operator->();
+        }
+    }
+    uint32 numberOfEntries = 0u;
+    if (ret) {
+        for (uint32 i = 0u; i < numberOfCommands; i++) {
+            for (uint32 j = 0u; j < numberOfEvents; j++) {
+                uint64 key = 0u;
+                /*lint -e{613} NULL pointer checked.*/
+                if (eventTriggers[j]->GetCommandKey(&signalMetadata[commandIndex[i]], key)) {
+                    numberOfEntries++;
+                }
+            }
+        }
+        eventIndexStart = new uint32[numberOfCommands + 1u];
+        eventIndex = new MessageGAMEventIndexEntry[(numberOfEntries > 0u) ? (numberOfEntries) : (1u)];
+        uint32 n = 0u;
+        for (uint32 i = 0u; i < numberOfCommands; i++) {
+            eventIndexStart[i] = n;
+            for (uint32 j = 0u; j < numberOfEvents; j++) {
+                uint64 key = 0u;
+                /*lint -e{613} NULL pointer checked.*/
+                if (eventTriggers[j]->GetCommandKey(&signalMetadata[commandIndex[i]], key)) {
+                    //Insertion sort by key. The events with the same key remain in the configuration order.
+                    uint32 k = n;
+                    while ((k > eventIndexStart[i]) && (eventIndex[k - 1u].key > key)) {
+                        eventIndex[k] = eventIndex[k - 1u];
+                        k--;
+                    }
+                    eventIndex[k].key = key;
+                    eventIndex[k].event = j;
+                    n++;
+                }
+            }
+        }
+        eventIndexStart[numberOfCommands] = n;
+    }
+    return ret;
+}
+
 /*lint -e{715} PrepareNextState function is independent from current and next state name. State change only triggers a flag */
 bool MessageGAM::PrepareNextState(const char8 * const currentStateName,
                                   const char8 * const nextStateName) {
@@ -272,16 +364,21 @@ bool MessageGAM::Execute() {
     else {
         for (uint32 i = 0u; i < numberOfCommands; i++) {
 
+            /*lint -e{613} NULL pointer checked.*/
+            const SignalMetadata *command = &signalMetadata[commandIndex[i]];
+            /*lint -e{613} NULL pointer checked.*/
+            uint32 firstEntry = eventIndexStart[i];
+            /*lint -e{613} NULL pointer checked.*/
+            uint32 lastEntry = eventIndexStart[i + 1u];
             /*lint -e{613} NULL pointer checked.*/
             if (cntTrigger[i] > 0u) {
-                for (uint32 j = 0u; j < numberOfEvents; j++) {
-                    ReferenceT<EventConditionTrigger> eventCondition = events->Get(j);
-                    if (eventCondition.IsValid()) {
-                        uint32 nReplies = eventCondition->Replied(&signalMetadata[commandIndex[i]], cntTrigger[i]);
-                        //TODO: Verify if nReplies can become greater than cntTrigger[i] and have it over-decrement
-                        /*lint -e{613} NULL pointer checked.*/
-                        cntTrigger[i] -= nReplies;
-                    }
+                //Only the events with a condition on the command can have replies for it
+                for (uint32 e = firstEntry; e < lastEntry; e++) {
+                    /*lint -e{613} NULL pointer checked.*/
+                    uint32 nReplies = eventTriggers[eventIndex[e].event]->Replied(command, cntTrigger[i]);
+                    //TODO: Verify if nReplies can become greater than cntTrigger[i] and have it over-decrement
+                    /*lint -e{613} NULL pointer checked.*/
+                    cntTrigger[i] -= nReplies;
                 }
             }
 
@@ -301,25 +398,46 @@ bool MessageGAM::Execute() {
             }
 
             if (trigEvent) {
+                uint32 commandSize = static_cast<uint32>(command->type.numberOfBits) / 8u;
+                /*lint -e{613} NULL pointer checked.*/
+                uint64 key = EventConditionTrigger::GetKey(&currentValue[command->offset], commandSize);
+                //Binary search of the first event which expects the current value of the command
+                uint32 low = firstEntry;
+                uint32 high = lastEntry;
+                while (low < high) {
+                    uint32 middle = low + ((high - low) / 2u);
+                    /*lint -e{613} NULL pointer checked.*/
+                    if (eventIndex[middle].key < key) {
+                        low = middle + 1u;
+                    }
+                    else {
+                        high = middle;
+                    }
+                }
                 //rising edge, send the message associated to the code
-                for (uint32 j = 0u; j < numberOfEvents; j++) {
-                    ReferenceT<EventConditionTrigger> eventCondition = events->Get(j);
-                    if (eventCondition.IsValid()) {
+                /*lint -e{613} NULL pointer checked.*/
+                for (uint32 e = low; (e < lastEntry) && (eventIndex[e].key == key); e++) {
+                    /*lint -e{613} NULL pointer checked.*/
+                    EventConditionTrigger *eventCondition = eventTriggers[eventIndex[e].event];
+                    //The other conditions of the event are still checked
+                    if (eventCondition->Check(currentValue, command)) {
+                        uint32 nMessages = eventCondition->Size();
+                        //trigger all the messages of that event
                         /*lint -e{613} NULL pointer checked.*/
-                        if (eventCondition->Check(currentValue, &signalMetadata[commandIndex[i]])) {
-                            uint32 nMessages = eventCondition->Size();
-                            //trigger all the messages of that event
-                            /*lint -e{613} NULL pointer checked.*/
-                            cntTrigger[i] += nMessages;
-                        }
+                        cntTrigger[i] += nMessages;
                     }
                 }
                 /*lint -e{613} NULL pointer checked.*/
-                (void) MemoryOperationsHelper::Copy(&previousValue[signalMetadata[commandIndex[i]].offset], &currentValue[signalMetadata[commandIndex[i]].offset],
-                                                    (static_cast<uint32>(signalMetadata[commandIndex[i]].type.numberOfBits) / 8u));
+                (void) MemoryOperationsHelper::Copy(&previousValue[command->offset], &currentValue[command->offset], commandSize);
             }
         }
     }
+    if (queueOverflows != NULL_PTR(uint32*)) {
+        for (uint32 j = 0u; j < numberOfEvents; j++) {
+            /*lint -e{613} NULL pointer checked.*/
+            queueOverflows[j] = eventTriggers[j]->GetOverflows();
+        }
+    }
     return true;
 }
 
@@ -42,6 +42,22 @@
 
 namespace MARTe{
 
+/**
+ * @brief An entry of the index of the events by the value of a command (see MessageGAM).
+ */
+struct MessageGAMEventIndexEntry {
+
+    /**
+     * @brief The value of the command expected by the event (see EventConditionTrigger::GetKey()).
+     */
+    uint64 key;
+
+    /**
+     * @brief The index of the event.
+     */
+    uint32 event;
+};
+
 /**
  * @brief Triggers MARTe::Message events on the basis of commands received in the input signals.
  *
@@ -56,11 +72,17 @@ namespace MARTe{
  *                            that every state change (e.g. PrepareNextState) the GAM stores the current value to wait for a change happening in the future, by comparing
  *                            past value with current, during that specific state context. In other words, the GAM has to see and "edge" in the command value to trigger a message.
  * - TriggerOnChange disabled: the GAM does not need to see an edge in command value to trigger the message, even across state changes.
+ * The events are indexed in Setup() by command and by the value that each event expects for the command (sorted, for a binary search), so that when
+ * a command is evaluated only the events which have a condition on the command with its current value are checked, whatever the number of events.
+ * The events without a condition on a command are never checked (nor queried for replies) for that command.
  * As the GAM keeps track of sent messages and received replies, if the message sent as a consequence of a triggering event is still awaiting for a reply, no further message will
  * be sent until the reply acknowledgement.
+ * The messages are queued by the EventConditionTrigger for its internal thread without locks. If the queue of an event is full
+ * the event is not triggered: the optional last output signal QueueOverflows, with one element for each event, counts these overflows.
  * Constraints:\n
- *   [number of commands] == [number of output signals]
+ *   [number of commands] == [number of output signals] (not counting QueueOverflows)
  *   [output signals type] == uint32
+ *   [QueueOverflows number of elements] == [number of events]
  *
  * @details Follows an example of configuration:
  * <pre>
@@ -131,6 +153,11 @@ namespace MARTe{
  *               DataSource = DDB1
  *               Type = uint32
  *            }
+ *           QueueOverflows = { //Optional. Must be the last output signal.
+ *               DataSource = DDB1
+ *               Type = uint32
+ *               NumberOfElements = 3 //Number of events
+ *            }
  *       }
  *   }
  * </pre>
@@ -201,6 +228,12 @@ protected:
      */
     virtual bool IsChanged(const uint32 cIdx) const;
 
+    /**
+     * @brief Builds the index of the events by command value.
+     * @return true if the index could be built.
+     */
+    bool BuildEventIndex();
+
     /**
      * The total number of variables
      */
@@ -226,11 +259,31 @@ protected:
      */
     uint32 numberOfEvents;
 
+    /**
+     * The EventConditionTrigger objects (held by the events container).
+     */
+    EventConditionTrigger **eventTriggers;
+
+    /**
+     * The index of the events for each command, sorted by key and then by event.
+     */
+    MessageGAMEventIndexEntry *eventIndex;
+
+    /**
+     * The first entry of eventIndex of each command (numberOfCommands + 1 elements).
+     */
+    uint32 *eventIndexStart;
+
     /**
      * The number of pending messages
      */
     uint32 *cntTrigger;
 
+    /**
+     * The number of queue overflows of each event (NULL if the QueueOverflows signal is not defined).
+     */
+    uint32 *queueOverflows;
+
     /**
      * The current signal value
      */
@@ -39,6 +39,67 @@
 
 namespace {
 
+/**
+ * Maximum number of input signals for which the element-wise selection is computed by masking all the inputs.
+ */
+const MARTe::uint32 muxGAMMaxBlendInputs = 4u;
+
+/**
+ * @brief Selects each output element by masking all the input signals (no branches and no indexed loads).
+ */
+template<typename T>
+void BlendElements(T * const output,
+                   void * const * const inputs,
+                   const MARTe::uint32 * const selector,
+                   const MARTe::uint32 numberOfInputs,
+                   const MARTe::uint32 numberOfElements) {
+    const T * const input0 = static_cast<const T *>(inputs[0u]);
+    MARTe::uint32 e;
+    for (e = 0u; e < numberOfElements; e++) {
+        output[e] = input0[e];
+    }
+    MARTe::uint32 k;
+    for (k = 1u; k < numberOfInputs; k++) {
+        const T * const input = static_cast<const T *>(inputs[k]);
+        for (e = 0u; e < numberOfElements; e++) {
+            T mask = static_cast<T>(static_cast<T>(0u) - static_cast<T>(selector[e] == k));
+            output[e] = static_cast<T>((output[e] & static_cast<T>(~mask)) | (input[e] & mask));
+        }
+    }
+}
+
+/**
+ * @brief Loads each output element from the selected input signal.
+ */
+template<typename T>
+void GatherElements(T * const output,
+                    void * const * const inputs,
+                    const MARTe::uint32 * const selector,
+                    const MARTe::uint32 numberOfElements) {
+    MARTe::uint32 e;
+    for (e = 0u; e < numberOfElements; e++) {
+        output[e] = static_cast<const T *>(inputs[selector[e]])[e];
+    }
+}
+
+/**
+ * @brief Selects each output element from the input signals. The selectors must have been validated.
+ * @details The elements are moved as unsigned integers of the same size, i.e. the float types are copied bit by bit.
+ */
+template<typename T>
+void SelectElements(void * const output,
+                    void * const * const inputs,
+                    const MARTe::uint32 * const selector,
+                    const MARTe::uint32 numberOfInputs,
+                    const MARTe::uint32 numberOfElements) {
+    if (numberOfInputs <= muxGAMMaxBlendInputs) {
+        BlendElements<T>(static_cast<T *>(output), inputs, selector, numberOfInputs, numberOfElements);
+    }
+    else {
+        GatherElements<T>(static_cast<T *>(output), inputs, selector, numberOfElements);
+    }
+}
+
 }
 
 /*---------------------------------------------------------------------------*/
@@ -56,7 +117,6 @@ MuxGAM::MuxGAM() :
     numberOfInputs = 0u;
     numberOfInputSignalsG = 0u;
     numberOfElements = 0u;
-    elementIndex = 0u;
     numberOfDimensions = 0u;
     numberOfSamples = 0u;
     outputSignals = NULL_PTR(void **);
@@ -64,6 +124,11 @@ MuxGAM::MuxGAM() :
     maxSelectorValue = 0u;
     numberOfElements = 0u;
     sizeToCopy = 0u;
+    elementSize = 0u;
+    staticInputNames = NULL_PTR(StreamString *);
+    numberOfStaticInputs = 0u;
+    staticInputs = NULL_PTR(bool *);
+    lastSelectors = NULL_PTR(uint32 *);
 }
 
 MuxGAM::~MuxGAM() {
@@ -85,9 +150,34 @@ MuxGAM::~MuxGAM() {
         }
         delete[] outputSignals;
     }
+    if (staticInputNames != NULL_PTR(StreamString *)) {
+        delete[] staticInputNames;
+    }
+    if (staticInputs != NULL_PTR(bool *)) {
+        delete[] staticInputs;
+    }
+    if (lastSelectors != NULL_PTR(uint32 *)) {
+        delete[] lastSelectors;
+    }
 }
 bool MuxGAM::Initialise(StructuredDataI &data) {
-    return GAM::Initialise(data);
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        AnyType staticInputsType = data.GetType("StaticInputs");
+        if (!staticInputsType.IsVoid()) {
+            numberOfStaticInputs = staticInputsType.GetNumberOfElements(0u);
+            ok = (numberOfStaticInputs > 0u);
+            if (ok) {
+                staticInputNames = new StreamString[numberOfStaticInputs];
+                Vector<StreamString> staticInputsVector(staticInputNames, numberOfStaticInputs);
+                ok = data.Read("StaticInputs", staticInputsVector);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading StaticInputs");
+            }
+        }
+    }
+    return ok;
 }
 
 bool MuxGAM::Setup() {
@@ -188,7 +278,8 @@ bool MuxGAM::Setup() {
         }
     }
     if (ok) { //compute sizeToCopy
-        sizeToCopy = (typeSignals.numberOfBits * numberOfElements) / 8u;
+        elementSize = static_cast<uint32>(typeSignals.numberOfBits) / 8u;
+        sizeToCopy = elementSize * numberOfElements;
     }
     if (ok) { //input elements
         uint32 auxElements = 0u;
@@ -327,6 +418,32 @@ bool MuxGAM::Setup() {
             outputSignals[i] = GetOutputSignalMemory(i);
         }
     }
+    if (ok) { //static inputs
+        staticInputs = new bool[numberOfInputSignalsG];
+        for (uint32 i = 0u; i < numberOfInputSignalsG; i++) {
+            staticInputs[i] = false;
+        }
+        for (uint32 i = 0u; (i < numberOfStaticInputs) && ok; i++) {
+            uint32 signalIdx = 0u;
+            ok = GetSignalIndex(InputSignals, signalIdx, staticInputNames[i].Buffer());
+            if (ok) {
+                ok = (signalIdx >= numberOfOutputs);
+            }
+            if (ok) {
+                staticInputs[signalIdx - numberOfOutputs] = true;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The static input %s is not an input signal", staticInputNames[i].Buffer());
+            }
+        }
+    }
+    if (ok) { //no selection yet
+        uint32 numberOfLastSelectors = numberOfOutputs * numberOfSelectorElements;
+        lastSelectors = new uint32[numberOfLastSelectors];
+        for (uint32 i = 0u; i < numberOfLastSelectors; i++) {
+            lastSelectors[i] = maxSelectorValue;
+        }
+    }
     return ok;
 }
 
@@ -334,24 +451,42 @@ bool MuxGAM::Setup() {
 //MuxGAM::Execute() only is called if the Setup() succeeds and the pointers are initialized.
 bool MuxGAM::Execute() {
     bool ok = true;
-    if (numberOfSelectorElements == 1u) {
-        for (selectorIndex = 0u; (selectorIndex < numberOfOutputs) && ok; selectorIndex++) { //goes throughout each selector signal
-            if (IsValidSelector(selectors[selectorIndex][0])) {
-                ok = MemoryOperationsHelper::Copy(outputSignals[selectorIndex], inputSignals[selectors[selectorIndex][0]], sizeToCopy);
-                if (!ok) {
-                    REPORT_ERROR(ErrorManagement::FatalError, "MemoryOperationsHelper::Copy failed");
-                }
-            }
-            else {
-                REPORT_ERROR(ErrorManagement::FatalError,"Invalid selector value. selector value must be lower than %u", maxSelectorValue);
-                ok = false;
-            }
+    for (selectorIndex = 0u; (selectorIndex < numberOfOutputs) && ok; selectorIndex++) { //goes throughout each selector signal
+        const uint32 * const selector = selectors[selectorIndex];
+        uint32 maxValue = 0u;
+        for (uint32 i = 0u; i < numberOfSelectorElements; i++) {
+            maxValue = (selector[i] > maxValue) ? (selector[i]) : (maxValue);
         }
-    }
-    else {
-        for (selectorIndex = 0u; (selectorIndex < numberOfOutputs) && ok; selectorIndex++) { //goes throughout each selector signal
-            for (elementIndex = 0u; (elementIndex < numberOfElements) && ok; elementIndex++) {
-                ok = Copy();
+        ok = IsValidSelector(maxValue);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Invalid selector value. selector value ( = %u) must be lower than %u", maxValue, maxSelectorValue);
+        }
+        if (ok) {
+            if (!IsUnchanged()) {
+                if (numberOfSelectorElements == 1u) {
+                    ok = MemoryOperationsHelper::Copy(outputSignals[selectorIndex], inputSignals[selector[0]], sizeToCopy);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "MemoryOperationsHelper::Copy failed");
+                    }
+                }
+                else if (elementSize == 1u) {
+                    SelectElements<uint8>(outputSignals[selectorIndex], inputSignals, selector, numberOfInputSignalsG, numberOfElements);
+                }
+                else if (elementSize == 2u) {
+                    SelectElements<uint16>(outputSignals[selectorIndex], inputSignals, selector, numberOfInputSignalsG, numberOfElements);
+                }
+                else if (elementSize == 4u) {
+                    SelectElements<uint32>(outputSignals[selectorIndex], inputSignals, selector, numberOfInputSignalsG, numberOfElements);
+                }
+                else {
+                    SelectElements<uint64>(outputSignals[selectorIndex], inputSignals, selector, numberOfInputSignalsG, numberOfElements);
+                }
+                if (ok) {
+                    uint32 *lastSelector = &lastSelectors[selectorIndex * numberOfSelectorElements];
+                    for (uint32 i = 0u; i < numberOfSelectorElements; i++) {
+                        lastSelector[i] = selector[i];
+                    }
+                }
             }
         }
     }
@@ -376,51 +511,19 @@ bool MuxGAM::IsValidType(TypeDescriptor const &typeRef) const {
     delete[] auxBool;
     return retVal;
 }
-//lint -e{613} Possible use of null pointer 'MARTe::MuxGAM::selectors' in left argument to operator '[. Copy() only is used in
+//lint -e{613} Possible use of null pointer 'MARTe::MuxGAM::selectors' in left argument to operator '[. IsUnchanged() only is used in
 //MuxGAM::Execute() and this function only is called if the Setup() succeeds and the pointers are initialized
-inline bool MuxGAM::Copy() const {
-    bool ret;
-    uint32 selectorValue = selectors[selectorIndex][elementIndex];
-    ret = IsValidSelector(selectorValue);
-    if (!ret) {
-        REPORT_ERROR(ErrorManagement::FatalError, "Invalid selector value. selector value ( = %u) must be lower than %u", selectorValue, maxSelectorValue);
-    }
-    if (ret) {
-        if (typeSignals == Float32Bit) {
-            static_cast<float32 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<float32 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == Float64Bit) {
-            static_cast<float64 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<float64 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == SignedInteger8Bit) {
-            static_cast<int8 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<int8 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == UnsignedInteger8Bit) {
-            static_cast<uint8 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<uint8 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == SignedInteger16Bit) {
-            static_cast<int16 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<int16 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == UnsignedInteger16Bit) {
-            static_cast<uint16 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<uint16 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == SignedInteger32Bit) {
-            static_cast<int32 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<int32 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == UnsignedInteger32Bit) {
-            static_cast<uint32 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<uint32 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == SignedInteger64Bit) {
-            static_cast<int64 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<int64 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == UnsignedInteger64Bit) {
-            static_cast<uint64 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<uint64 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else {
-            ret = false;
+inline bool MuxGAM::IsUnchanged() const {
+    bool unchanged = (numberOfStaticInputs > 0u);
+    const uint32 * const selector = selectors[selectorIndex];
+    const uint32 * const lastSelector = &lastSelectors[selectorIndex * numberOfSelectorElements];
+    for (uint32 i = 0u; (i < numberOfSelectorElements) && (unchanged); i++) {
+        unchanged = (selector[i] == lastSelector[i]);
+        if (unchanged) {
+            unchanged = staticInputs[selector[i]];
         }
     }
-    return ret;
+    return unchanged;
 }
 
 inline bool MuxGAM::IsValidSelector(const uint32 value) const {
@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "GAM.h"
+#include "StreamString.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
@@ -100,6 +101,14 @@ namespace MARTe {
  * As can be observed the same input can be connected to several outputs.
  *
  * If an invalid selector is sent the GAM::Execute() returns an error
+ *
+ * Input signals which do not change during the real-time execution (e.g. calibration tables or waveforms loaded
+ * at the beginning of the state) can be listed in the optional StaticInputs parameter. An output whose selector
+ * value(s) did not change since the previous Execute() and which only routes static input signals is not copied again.
+ *
+ * When the selectors are arrays, the selectors are validated before the copy and each output element is selected
+ * without branches: with up to four input signals the output is built by masking the input signals, otherwise each
+ * element is loaded from the selected input signal.
  * *The configuration syntax is (names and signal quantity are only given as an example):
  *<pre>
  * +MuxGAM1 = {
@@ -150,6 +159,7 @@ namespace MARTe {
  *             Samples = 1
  *         }
  *     }
+ *     StaticInputs = { InputSignal1 } //Optional. Input signals which do not change during the execution.
  * }
  * </pre>
  * Notice that the selectors are defined first.
@@ -169,7 +179,6 @@ public:
      * numberOfInputs = 0u\n
      * numberOfInputSignalsG = 0u\n
      * numberOfElements = 0u\n
-     * elementIndex = 0u\n
      * numberOfDimensions = 0u\n
      * numberOfSamples = 0u\n
      * outputSignals = NULL_PTR(void **)\n
@@ -177,6 +186,11 @@ public:
      * maxSelectorValue = 0u\n
      * numberOfElements = 0u\n
      * sizeToCopy = 0u\n
+     * elementSize = 0u\n
+     * staticInputNames = NULL_PTR(StreamString *)\n
+     * numberOfStaticInputs = 0u\n
+     * staticInputs = NULL_PTR(bool *)\n
+     * lastSelectors = NULL_PTR(uint32 *)\n
      */
     MuxGAM();
 
@@ -188,15 +202,16 @@ public:
     virtual ~MuxGAM();
 
     /**
-     * @brief Calls GAM:Initialise(StructuredDataI &data)
+     * @brief Calls GAM:Initialise(StructuredDataI &data) and reads the optional StaticInputs.
      * @param[in] data configuration of the GAM
+     * @return true if GAM::Initialise succeeds and, if defined, StaticInputs can be read.
      */
     virtual bool Initialise(StructuredDataI &data);
 
     /**
      * @brief Initialises the inputs and the outputs
      * @details Allocates memory, initialises internal variables and checks consistencies
-     * @return true if the verifications are correct
+     * @return true if the verifications are correct and all the StaticInputs are input signals (not selectors).
      */
     virtual bool Setup();
 
@@ -204,7 +219,8 @@ public:
      * @brief Copies the selected input signals to the output signals.
      * @details if selector is an array the input signals are copied element by element.
      * If the selector has one element the input signals are copied as a block.
-     * @return true if the copy is successfully done
+     * The copy of an output is skipped if its selector did not change and all the selected input signals are static.
+     * @return true if all the selectors are valid
      */
     virtual bool Execute();
 private:
@@ -252,11 +268,6 @@ private:
      */
     uint32 numberOfElements;
 
-    /**
-     * index to go through the elements array
-     */
-    uint32 elementIndex;
-
     /**
      * All inputs/outputs and selectors (which are inputs) must have the same dimension. numberOfDimensions= 1.
      */
@@ -287,6 +298,32 @@ private:
      */
     uint32 sizeToCopy;
 
+    /**
+     * Size in bytes of each element of the input and output signals.
+     */
+    uint32 elementSize;
+
+    /**
+     * Names of the input signals declared in StaticInputs.
+     */
+    StreamString *staticInputNames;
+
+    /**
+     * Number of input signals declared in StaticInputs.
+     */
+    uint32 numberOfStaticInputs;
+
+    /**
+     * For each input signal (excluding selectors), true if the signal is static.
+     */
+    bool *staticInputs;
+
+    /**
+     * Selector values of the last copy of each output (numberOfOutputs x numberOfSelectorElements).
+     * Initialised with maxSelectorValue so that the first Execute() always copies.
+     */
+    uint32 *lastSelectors;
+
     /**
      * @brief Checks that a give type is a supported type.
      * @details valid types:
@@ -306,11 +343,10 @@ private:
     bool IsValidType(TypeDescriptor const &typeRef) const;
 
     /**
-     * @brief Copies a preselected input to the output
-     * @details The copy is performed element by element as a function of the selector value
-     * @return true if the copy succeed
+     * @brief Checks if the copy of the output selectorIndex can be skipped.
+     * @return true if the selector did not change since the last copy and all the selected input signals are static.
      */
-    inline bool Copy()const;
+    inline bool IsUnchanged() const;
 
     /**
      * @brief Checks that a given selector is valid.
@@ -32,6 +32,7 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "PIDGAM.h"
+#include "PIDHelperT.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -49,25 +50,18 @@ namespace MARTe {
 
 PIDGAM::PIDGAM() :
         GAM() {
-    kp = 0.0;
-    proportional = 0.0;
-    ki = 0.0;
-    kid = 0.0;
-    integral = 0.0;
-    kd = 0.0;
-    kdd = 0.0;
-    derivative = 0.0;
+    numberOfParameterValues = 0u;
+    kp = NULL_PTR(float64 *);
+    kid = NULL_PTR(float64 *);
+    kdd = NULL_PTR(float64 *);
     sampleTime = 0.0;
-    maxOutput = MAX_FLOAT64;
-    minOutput = -MAX_FLOAT64;
-    enableIntegral = true;
-    lastInput = 0.0;
-    lastIntegral = 0.0;
+    maxOutput = NULL_PTR(float64 *);
+    minOutput = NULL_PTR(float64 *);
+    numberOfChannels = 0u;
+    fractionalBits = 0u;
+    helper = NULL_PTR(PIDHelper *);
     enableSubstraction = false;
-    reference = NULL_PTR(float64 *);
     sizeInputOutput = 0u;
-    measurement = NULL_PTR(float64 *);
-    output = NULL_PTR(float64 *);
     nOfInputSignals = 0u;
     nOfOutputSignals = 0u;
     numberOfInputElementsReference = 0u;
@@ -79,33 +73,106 @@ PIDGAM::PIDGAM() :
     inputReferenceDimension = 0u;
     inputMeasurementDimension = 0u;
     outputDimension = 0u;
-
+    numberOfBreakpoints = 0u;
+    scheduleBreakpoints = NULL_PTR(float64 *);
+    scheduleCell = 0u;
+    lastSchedulingValue = 0.0;
+    schedulingVariable = NULL_PTR(const float64 *);
 }
 
 PIDGAM::~PIDGAM() {
-    reference = NULL_PTR(float64 *);
-    measurement = NULL_PTR(float64 *);
-    output = NULL_PTR(float64 *);
+    if (kp != NULL_PTR(float64 *)) {
+        delete[] kp;
+    }
+    if (kid != NULL_PTR(float64 *)) {
+        delete[] kid;
+    }
+    if (kdd != NULL_PTR(float64 *)) {
+        delete[] kdd;
+    }
+    if (maxOutput != NULL_PTR(float64 *)) {
+        delete[] maxOutput;
+    }
+    if (minOutput != NULL_PTR(float64 *)) {
+        delete[] minOutput;
+    }
+    if (scheduleBreakpoints != NULL_PTR(float64 *)) {
+        delete[] scheduleBreakpoints;
+    }
+    if (helper != NULL_PTR(PIDHelper *)) {
+        delete helper;
+    }
+    schedulingVariable = NULL_PTR(const float64 *);
 }
 
 bool PIDGAM::Initialise(StructuredDataI &data) {
     bool ok = GAM::Initialise(data);
+    uint32 numberOfKp = 0u;
+    uint32 numberOfKi = 0u;
+    uint32 numberOfKd = 0u;
+    uint32 numberOfMaxOutput = 0u;
+    uint32 numberOfMinOutput = 0u;
+    float64 *kpValues = NULL_PTR(float64 *);
+    float64 *kiValues = NULL_PTR(float64 *);
+    float64 *kdValues = NULL_PTR(float64 *);
+    float64 *maxOutputValues = NULL_PTR(float64 *);
+    float64 *minOutputValues = NULL_PTR(float64 *);
+    bool scheduled = false;
     if (ok) {
-        ok = data.Read("Kp", kp);
-        bool aux;
-        aux = data.Read("Ki", ki);
-        ok = (ok || aux);
-        aux = data.Read("Kd", kd);
-        ok = (ok || aux);
+        //With a Schedule the gains and the limits are read from the Schedule node
+        scheduled = data.MoveRelative("Schedule");
+        if (scheduled) {
+            scheduleBreakpoints = ReadParameter(data, "Breakpoints", numberOfBreakpoints);
+            ok = (numberOfBreakpoints > 1u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The Schedule Breakpoints must have at least two values");
+            }
+            for (uint32 i = 1u; (i < numberOfBreakpoints) && (ok); i++) {
+                ok = (scheduleBreakpoints[i] > scheduleBreakpoints[i - 1u]);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The Schedule Breakpoints must be strictly increasing");
+                }
+            }
+        }
+    }
+    if (ok) {
+        kpValues = ReadParameter(data, "Kp", numberOfKp);
+        kiValues = ReadParameter(data, "Ki", numberOfKi);
+        kdValues = ReadParameter(data, "Kd", numberOfKd);
+        ok = ((numberOfKp > 0u) || (numberOfKi > 0u) || (numberOfKd > 0u));
         if (!ok) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "kp, ki and kd missing. At least one parameter must be initialised");
         }
-        //lint -e{9007} No side effect on the function IsEqual.
-        if (IsEqual(kp, 0.0) && IsEqual(ki, 0.0) && IsEqual(kd, 0.0)) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "kp = ki = kd = 0.");
-            ok = false;
+    }
+    if (ok) {
+        maxOutputValues = ReadParameter(data, "MaxOutput", numberOfMaxOutput);
+        minOutputValues = ReadParameter(data, "MinOutput", numberOfMinOutput);
+        const uint32 numberOfValues[] = { numberOfKp, numberOfKi, numberOfKd, numberOfMaxOutput, numberOfMinOutput };
+        numberOfParameterValues = 1u;
+        for (uint32 i = 0u; (i < 5u) && (ok); i++) {
+            if (numberOfValues[i] > 1u) {
+                if (numberOfParameterValues == 1u) {
+                    numberOfParameterValues = numberOfValues[i];
+                }
+                else {
+                    ok = (numberOfValues[i] == numberOfParameterValues);
+                }
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "All the parameter arrays must have the same number of elements");
+        }
+        if ((ok) && (scheduled)) {
+            ok = ((numberOfParameterValues == 1u) || (numberOfParameterValues == numberOfBreakpoints));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The Schedule parameter arrays must have one element for each breakpoint");
+            }
+            numberOfParameterValues = numberOfBreakpoints;
         }
     }
+    if (scheduled) {
+        ok = (data.MoveToAncestor(1u) && ok);
+    }
     if (ok) {
         ok = data.Read("SampleTime", sampleTime);
         if (!ok) {
@@ -119,45 +186,75 @@ bool PIDGAM::Initialise(StructuredDataI &data) {
         }
     }
     if (ok) {
-        kid = ki * sampleTime;
-        kdd = kd / sampleTime;
+        if (data.Read("FractionalBits", fractionalBits)) {
+            ok = (fractionalBits < 31u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "FractionalBits must be lower than 31");
+            }
+        }
     }
     if (ok) {
-        ok = data.Read("MaxOutput", maxOutput);
-        if (!ok) {
-            maxOutput = MAX_FLOAT64;
-        }
-        ok = data.Read("MinOutput", minOutput);
-        if (!ok) {
-            minOutput = -MAX_FLOAT64;
-        }
-        ok = true;
-        if (maxOutput < minOutput) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "maxOutput < minOutput. maxOutput must be larger than minOutput");
-            ok = false;
-        }
-        if (IsEqual(maxOutput, minOutput)) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "maxOutput = minOutput. maxOutput must be larger than minOutput");
-            ok = false;
+        kp = ExpandParameter(kpValues, numberOfKp, 0.0);
+        kid = ExpandParameter(kiValues, numberOfKi, 0.0);
+        kdd = ExpandParameter(kdValues, numberOfKd, 0.0);
+        maxOutput = ExpandParameter(maxOutputValues, numberOfMaxOutput, MAX_FLOAT64);
+        minOutput = ExpandParameter(minOutputValues, numberOfMinOutput, -MAX_FLOAT64);
+        for (uint32 i = 0u; (i < numberOfParameterValues) && (ok); i++) {
+            //lint -e{9007} No side effect on the function IsEqual.
+            if (IsEqual(kp[i], 0.0) && IsEqual(kid[i], 0.0) && IsEqual(kdd[i], 0.0)) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "kp = ki = kd = 0.");
+                ok = false;
+            }
+            else if (maxOutput[i] < minOutput[i]) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "maxOutput < minOutput. maxOutput must be larger than minOutput");
+                ok = false;
+            }
+            else if (IsEqual(maxOutput[i], minOutput[i])) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "maxOutput = minOutput. maxOutput must be larger than minOutput");
+                ok = false;
+            }
+            else {
+                kid[i] = kid[i] * sampleTime;
+                kdd[i] = kdd[i] / sampleTime;
+            }
         }
     }
+    if (kpValues != NULL_PTR(float64 *)) {
+        delete[] kpValues;
+    }
+    if (kiValues != NULL_PTR(float64 *)) {
+        delete[] kiValues;
+    }
+    if (kdValues != NULL_PTR(float64 *)) {
+        delete[] kdValues;
+    }
+    if (maxOutputValues != NULL_PTR(float64 *)) {
+        delete[] maxOutputValues;
+    }
+    if (minOutputValues != NULL_PTR(float64 *)) {
+        delete[] minOutputValues;
+    }
     return ok;
 }
 bool PIDGAM::Setup() {
     bool ok = true;
     nOfInputSignals = GetNumberOfInputSignals();
-    if (nOfInputSignals == 0u) {
-        REPORT_ERROR(ErrorManagement::ParametersError, "nOfInputSignals must be positive. The current value is %u", nOfInputSignals);
+    //With a Schedule the last input signal is the scheduling variable
+    const uint32 nOfSchedulingSignals = (numberOfBreakpoints > 0u) ? (1u) : (0u);
+    if (nOfInputSignals <= nOfSchedulingSignals) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "nOfInputSignals must be larger than %u. The current value is %u", nOfSchedulingSignals,
+                     nOfInputSignals);
         ok = false;
     }
-    else if (nOfInputSignals == 1u) {
+    else if (nOfInputSignals == (1u + nOfSchedulingSignals)) {
         enableSubstraction = false;
     }
-    else if (nOfInputSignals == 2u) {
+    else if (nOfInputSignals == (2u + nOfSchedulingSignals)) {
         enableSubstraction = true;
     }
     else {
-        REPORT_ERROR(ErrorManagement::ParametersError, "Maximum value nOfInputSignals = 2. nOfInputSignals = %u", nOfInputSignals);
+        REPORT_ERROR(ErrorManagement::ParametersError, "Maximum value nOfInputSignals = %u. nOfInputSignals = %u", (2u + nOfSchedulingSignals),
+                     nOfInputSignals);
         ok = false;
     }
     if (ok) {
@@ -173,9 +270,16 @@ bool PIDGAM::Setup() {
             REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements returned an error for numberOfInputElementsReference");
         }
         if (ok) {
-            if (numberOfInputElementsReference != 1u) {
-                REPORT_ERROR(ErrorManagement::InitialisationError, "The numberOfInputElementsReference value must be one. The crrent value is %u",
-                             numberOfInputElementsReference);
+            if (numberOfInputElementsReference == 0u) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The numberOfInputElementsReference value must be positive");
+                ok = false;
+            }
+        }
+        if (ok) {
+            //With a Schedule the parameter arrays have one element for each breakpoint
+            if ((numberOfBreakpoints == 0u) && (numberOfParameterValues != 1u) && (numberOfParameterValues != numberOfInputElementsReference)) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The parameter arrays have %u elements and numberOfInputElementsReference is %u",
+                             numberOfParameterValues, numberOfInputElementsReference);
                 ok = false;
             }
         }
@@ -287,87 +391,163 @@ bool PIDGAM::Setup() {
             }
         }
     }
+    TypeDescriptor signalType = GetSignalType(InputSignals, 0u);
     if (ok) {
-        ok = (GetSignalType(InputSignals, 0u) == Float64Bit);
+        ok = ((signalType == Float64Bit) || (signalType == Float32Bit) || (signalType == SignedInteger32Bit));
         if (!ok) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "The reference data type must be float64.");
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The reference data type must be float64, float32 or int32.");
         }
         if (ok) {
             if (enableSubstraction) {
-                ok = (GetSignalType(InputSignals, 1u) == Float64Bit);
+                ok = (GetSignalType(InputSignals, 1u) == signalType);
             }
             if (!ok) {
-                REPORT_ERROR(ErrorManagement::InitialisationError, "The measurement data type must be float64.");
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The measurement data type must be the reference data type.");
             }
         }
     }
     if (ok) {
-        ok = (GetSignalType(OutputSignals, 0u) == Float64Bit);
+        ok = (GetSignalType(OutputSignals, 0u) == signalType);
         if (!ok) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "The data type must be float64.");
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The output data type must be the reference data type.");
         }
     }
 
+    if ((ok) && (numberOfBreakpoints > 0u)) {
+        const uint32 schedulingIdx = (nOfInputSignals - 1u);
+        uint32 schedulingElements = 0u;
+        uint32 schedulingSamples = 0u;
+        ok = (GetSignalType(InputSignals, schedulingIdx) == Float64Bit);
+        if (ok) {
+            ok = GetSignalNumberOfElements(InputSignals, schedulingIdx, schedulingElements);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(InputSignals, schedulingIdx, schedulingSamples);
+        }
+        if (ok) {
+            ok = ((schedulingElements == 1u) && (schedulingSamples == 1u));
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The scheduling variable (last input signal) must be a float64 with one element and one sample");
+        }
+        if (ok) {
+            schedulingVariable = static_cast<const float64 *>(GetInputSignalMemory(schedulingIdx));
+        }
+    }
     if (ok) {
-        reference = static_cast<float64 *>(GetInputSignalMemory(0u));
-        if (enableSubstraction) {
-            measurement = static_cast<float64 *>(GetInputSignalMemory(1u));
+        numberOfChannels = numberOfInputElementsReference;
+        const void * const reference = GetInputSignalMemory(0u);
+        const void * const measurement = enableSubstraction ? (GetInputSignalMemory(1u)) : (NULL_PTR(const void *));
+        void * const output = GetOutputSignalMemory(0u);
+        if (signalType == Float64Bit) {
+            helper = new PIDHelperT<float64>(reference, measurement, output, numberOfChannels);
+        }
+        else if (signalType == Float32Bit) {
+            helper = new PIDHelperT<float32>(reference, measurement, output, numberOfChannels);
+        }
+        else {
+            helper = new PIDHelperT<int32>(reference, measurement, output, numberOfChannels, fractionalBits);
+        }
+        if (numberOfBreakpoints > 0u) {
+            //All the breakpoints are verified. The interpolated gains are between the gains of the breakpoints.
+            for (uint32 i = numberOfBreakpoints; (i > 0u) && (ok); i--) {
+                ok = helper->SetParameters(&kp[i - 1u], &kid[i - 1u], &kdd[i - 1u], &maxOutput[i - 1u], &minOutput[i - 1u], 1u);
+            }
+            scheduleCell = 0u;
+            lastSchedulingValue = scheduleBreakpoints[0u];
+        }
+        else {
+            ok = helper->SetParameters(kp, kid, kdd, maxOutput, minOutput, numberOfParameterValues);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The gains cannot be represented in the signal type");
         }
-        output = static_cast<float64 *>(GetOutputSignalMemory(0u));
     }
 
     return ok;
 }
+
+//lint -e{613} The Setup() function guarantee that the helper is not NULL.
 bool PIDGAM::Execute() {
-    GetValue();
-    Saturation();
+    if (numberOfBreakpoints > 0u) {
+        Schedule();
+    }
+    helper->Execute();
     return true;
 }
 
-//lint -e{613} The Setup() function guarantee that the pointers are not NULL.
-void PIDGAM::GetValue() {
-    if (enableSubstraction) {
-        float64 error;
-        error = *reference - *measurement;
-        proportional = kp * error;
-        if (enableIntegral) {
-            integral = (error * kid) + lastIntegral;
+//lint -e{613} The Setup() function guarantee that the helper and the scheduling variable are not NULL.
+void PIDGAM::Schedule() {
+    float64 value = *schedulingVariable;
+    //lint -e{777} Only an exact change of the scheduling variable changes the gains.
+    if (value != lastSchedulingValue) {
+        lastSchedulingValue = value;
+        //The cell is searched from the last one, i.e. in constant time if the scheduling variable changes slowly
+        while ((scheduleCell > 0u) && (value < scheduleBreakpoints[scheduleCell])) {
+            scheduleCell--;
+        }
+        while ((scheduleCell < (numberOfBreakpoints - 2u)) && (value >= scheduleBreakpoints[scheduleCell + 1u])) {
+            scheduleCell++;
+        }
+        const uint32 next = scheduleCell + 1u;
+        float64 fraction = (value - scheduleBreakpoints[scheduleCell]) / (scheduleBreakpoints[next] - scheduleBreakpoints[scheduleCell]);
+        //Constant outside of the breakpoints (and at the first breakpoint if the value is NaN)
+        fraction = (fraction > 0.0) ? (fraction) : (0.0);
+        fraction = (fraction < 1.0) ? (fraction) : (1.0);
+        helper->UpdateParameters(kp[scheduleCell] + (fraction * (kp[next] - kp[scheduleCell])),
+                                 kid[scheduleCell] + (fraction * (kid[next] - kid[scheduleCell])),
+                                 kdd[scheduleCell] + (fraction * (kdd[next] - kdd[scheduleCell])),
+                                 maxOutput[scheduleCell] + (fraction * (maxOutput[next] - maxOutput[scheduleCell])),
+                                 minOutput[scheduleCell] + (fraction * (minOutput[next] - minOutput[scheduleCell])));
+    }
+}
+
+float64 *PIDGAM::ReadParameter(StructuredDataI &data,
+                               const char8 * const name,
+                               uint32 &numberOfValues) {
+    float64 *values = NULL_PTR(float64 *);
+    numberOfValues = 0u;
+    AnyType parameterType = data.GetType(name);
+    if (!parameterType.IsVoid()) {
+        uint32 numberOfElements = parameterType.GetNumberOfElements(0u);
+        numberOfElements = (numberOfElements > 1u) ? (numberOfElements) : (1u);
+        values = new float64[numberOfElements];
+        bool ok;
+        if (numberOfElements == 1u) {
+            ok = data.Read(name, values[0u]);
         }
         else {
-            integral = error * kid;
+            Vector<float64> valuesVector(values, numberOfElements);
+            ok = data.Read(name, valuesVector);
         }
-        derivative = (error - lastInput) * kdd;
-        lastInput = error;
-    }
-    else {
-        proportional = kp * *reference;
-        if (enableIntegral) {
-            integral = ((*reference * kid) + lastIntegral);
+        if (ok) {
+            numberOfValues = numberOfElements;
         }
         else {
-            integral = *reference * kid;
+            delete[] values;
+            values = NULL_PTR(float64 *);
         }
-        derivative = (*reference - lastInput) * kdd;
-        lastInput = *reference;
     }
-    output[0] = proportional + integral + derivative;
-    lastIntegral = integral;
+    return values;
 }
 
-//lint -e{613} The Setup() function guarantee that the pointers are not NULL.
-void PIDGAM::Saturation() {
-    if (output[0] > maxOutput) {
-        output[0] = maxOutput;
-        enableIntegral = false;
-    }
-    else if (output[0] < minOutput) {
-        output[0] = minOutput;
-        enableIntegral = false;
-    }
-    else {
-        enableIntegral = true;
+float64 *PIDGAM::ExpandParameter(const float64 * const values,
+                                 const uint32 numberOfValues,
+                                 const float64 defaultValue) const {
+    float64 *expanded = new float64[numberOfParameterValues];
+    for (uint32 i = 0u; i < numberOfParameterValues; i++) {
+        if (numberOfValues == 0u) {
+            expanded[i] = defaultValue;
+        }
+        else if (numberOfValues == 1u) {
+            expanded[i] = values[0u];
+        }
+        else {
+            expanded[i] = values[i];
+        }
     }
+    return expanded;
 }
+
 CLASS_REGISTER(PIDGAM, "1.0")
 }
-
@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "GAM.h"
+#include "PIDHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -71,6 +72,27 @@ namespace MARTe {
  * \f$ \n
  * Notice that the lastIntegral is not added to the output.\n
  *
+ * The GAM can control several independent loops (channels) at once: the reference, measurement and output
+ * signals are then arrays with one element per channel. Each of Kp, Ki, Kd, MaxOutput and MinOutput can be
+ * a scalar, applied to all the channels, or an array with one value per channel. The state of the channels
+ * is stored as a structure of arrays and all the channels are updated in a single loop without branches:
+ * when SSE2 is available two (float64) or four (float32) channels are computed at once and the saturation and the
+ * anti-windup are folded into vector min/max operations and comparison masks.
+ *
+ * The numeric type of the controller is the Type of the signals (all the signals must have the same type):
+ * float64, float32 or int32. The int32 signals are fixed-point values in the Q format with FractionalBits
+ * fractional bits (e.g. with FractionalBits = 16 the value 65536 is 1.0) and the PID is bit exact
+ * (see PIDHelperT for the fixed-point arithmetic). The gains and limits are always configured as real values.
+ *
+ * The gains and the limits can be scheduled with an operating point: when a Schedule is defined, the gains and the limits
+ * are read from the Schedule (and not from the root of the GAM configuration) and are given for each of the Breakpoints
+ * (strictly increasing values of the scheduling variable) and the last input signal is the scheduling variable (a float64 scalar).
+ * In each Execute() the gains and limits, common to all the channels, are linearly interpolated between the breakpoints of the
+ * cell where the scheduling variable is (the cell is cached, so that it is found in constant time when the scheduling variable
+ * changes slowly) and are constant outside of the breakpoints. The transfer is bumpless (see PIDHelper::UpdateParameters):
+ * a gain change does not produce a step in the output if the error does not change. The gains are only updated when the
+ * scheduling variable changes.
+ *
  *
  *The configuration syntax is (names and signal quantity are only given as an example):
  *
@@ -83,6 +105,14 @@ namespace MARTe {
  *     sampleFrequency = 0.001
  *     maxOutput = 500.0 //optional
  *     minOutput = -500.0 //optional
+ *     //For N channels, e.g. kp = {10.0 12.0 ...} with N values. The signals must have N elements.
+ *     FractionalBits = 16 //optional (default 0). Only for int32 signals. Must be lower than 31.
+ *     //Schedule = { //optional. If defined, Kp, Ki, Kd, MaxOutput and MinOutput are read from the Schedule.
+ *     //    Breakpoints = {0.0 0.5 1.0} //Strictly increasing values of the scheduling variable (at least two).
+ *     //    Kp = {10.0 12.0 20.0} //A scalar or a value for each breakpoint.
+ *     //    Ki = 1.0
+ *     //    MaxOutput = {500.0 400.0 300.0}
+ *     //}
  *     InputSignals = {
  *         Reference = {
  *             DataSource = "DDB1"
@@ -98,6 +128,10 @@ namespace MARTe {
  *             samples = 1
  *             dimension = 1
  *         }
+ *         //OperatingPoint = { //Only with a Schedule. Notice that the scheduling variable is the last signal.
+ *         //    DataSource = "DDB1"
+ *         //    Type = float64
+ *         //}
  *     }
  *     OutputSignals = {
  *         OutputSignal1 = {
@@ -118,25 +152,18 @@ public:
     /**
      * @brief Default constructor
      * @post
-     * kp = 0.0\n
-     * proportional = 0.0\n
-     * ki = 0.0\n
-     * kid = 0.0\n
-     * integral = 0.0\n
-     * kd = 0.0\n
-     * kdd = 0.0\n
-     * derivative = 0.0\n
+     * numberOfParameterValues = 0u\n
+     * kp = NULL_PTR(float64 *)\n
+     * kid = NULL_PTR(float64 *)\n
+     * kdd = NULL_PTR(float64 *)\n
      * sampleTime = 0.0\n
-     * maxOutput = MAX_FLOAT64\n
-     * minOutput = -MAX_FLOAT64\n
-     * enableIntegral = true\n
-     * lastInput = 0.0\n
-     * lastIntegral = 0.0
+     * maxOutput = NULL_PTR(float64 *)\n
+     * minOutput = NULL_PTR(float64 *)\n
+     * numberOfChannels = 0u\n
+     * fractionalBits = 0u\n
+     * helper = NULL_PTR(PIDHelper *)\n
      * enableSubstraction = false\n
-     * reference = NULL_PTR(float64 *)\n
      * sizeInputOutput = 0u\n
-     * measurement = NULL_PTR(float64 *)\n
-     * output = NULL_PTR(float64 *)\n
      * nOfInputSignals = 0u\n
      * nOfOutputSignals = 0u\n
      * numberOfInputElementsReference = 0u\n
@@ -147,16 +174,18 @@ public:
      * numberOfOuputSamples = 0u\n
      * inputReferenceDimension = 0u\n
      * inputMeasurementDimension = 0u\n
-     * outputDimension = 0u
+     * outputDimension = 0u\n
+     * numberOfBreakpoints = 0u\n
+     * scheduleBreakpoints = NULL_PTR(float64 *)\n
+     * scheduleCell = 0u\n
+     * lastSchedulingValue = 0.0\n
+     * schedulingVariable = NULL_PTR(const float64 *)
      */
 PIDGAM    ();
 
     /**
      * @brief Default constructor.
-     * @post
-     * reference = NULL_PTR(float64 *)\n
-     * measurement = NULL_PTR(float64 *)\n
-     * output = NULL_PTR(float64 *)\n
+     * @details Frees the parameter arrays, the breakpoints and the helper.
      */
     virtual ~PIDGAM();
 
@@ -170,10 +199,16 @@ PIDGAM    ();
      * sampleTime\n
      * maxOutput (optional)\n
      * minOutput (optional)\n
+     * FractionalBits (optional)\n
+     * Schedule (optional)\n
+     * Each parameter (except sampleTime) is a scalar or an array. All the arrays must have the same number of elements.
+     * With a Schedule, the gains and the limits are read from the Schedule and the arrays have one element for each breakpoint.
      * @post
-     * kp != 0.0 || ki != 0.0 || kd != 0.0\n
+     * For each channel: kp != 0.0 || ki != 0.0 || kd != 0.0\n
      * sampleTime > 0.0\n
-     * maxOutpt > minOutput\n
+     * For each channel: maxOutpt > minOutput\n
+     * fractionalBits < 31\n
+     * the Schedule Breakpoints (if any) are at least two and strictly increasing\n
      * @return true if all postconditions are met
      */
     virtual bool Initialise(StructuredDataI &data);
@@ -183,72 +218,55 @@ PIDGAM    ();
      * @details Initialise the input and output pointers and verify the number of elements, number
      * of samples and dimension. Moreover, a flag is set to 1 if the error must be calculated internally.
      * @post
-     * nOfInputSignals = 1 || nOfInputSignals = 2\n
+     * nOfInputSignals = 1 || nOfInputSignals = 2 (plus the scheduling variable with a Schedule)\n
      * nOfOutputSignals = 1\n
-     * numberOfInputElementsReference = 1\n
-     * numberOfInputElementsMeasurement = 1\n
-     * numberOfOutputElements = 1\n
+     * numberOfInputElementsReference > 0\n
+     * numberOfInputElementsMeasurement = numberOfInputElementsReference\n
+     * numberOfOutputElements = numberOfInputElementsReference\n
+     * the parameter arrays have one or numberOfInputElementsReference elements\n
      * numberOfInputSamplesReference = 1\n
      * numberOfInputSamplesMeasurement = 1\n
      * numberOfOuputSamples = 1\n
      * inputReferenceDimension = 1\n
      * inputMeasurementDimension = 1\n
      * outputDimension = 1\n
-     * reference != NULL\n
-     * if enableSubstraction = true --> measurement != NULL\n
-     * output != NULL\n
+     * all the signals are float64, float32 or int32 (with the same type)\n
+     * the scheduling variable (if any) is a float64 with one element and one sample\n
+     * the gains can be represented in the signal type\n
+     * helper != NULL\n
      * @return true if all postconditions are met.
      */
     virtual bool Setup();
 
     /**
      * @brief Implements the PID.
-     * @details First computes the PID, then saturates the output if needed. If the output
-     * is saturated a flag prevents the integral term to continuing growing.
+     * @details With a Schedule, first interpolates the gains and the limits at the scheduling variable.
+     * Then computes the PID, then saturates the output if needed. If the output
+     * is saturated a flag prevents the integral term to continuing growing. All the channels are updated in the same loop.
      * @return true.
      */
     virtual bool Execute();
 private:
 
     /**
-     * proportional coefficient in the time domain in the time domain
-     */
-    float64 kp;
-
-    /**
-     * contribution of the proportional term
-     */
-    float64 proportional;
-
-    /**
-     * integral coefficient in the time domain
-     */
-    float64 ki;
-
-    /**
-     * Integral coefficient in the discrete domain. kid = kid * sampleTime. It is used to speed up the operations
-     */
-    float64 kid;
-
-    /**
-     * contribution of the integral term
+     * Number of elements of the parameter arrays (1 if all the parameters are scalars or numberOfBreakpoints with a Schedule).
      */
-    float64 integral;
+    uint32 numberOfParameterValues;
 
     /**
-     * Derivative coefficient in the time domain
+     * proportional coefficient in the time domain for each channel (or for each breakpoint with a Schedule)
      */
-    float64 kd;
+    float64 *kp;
 
     /**
-     * Derivative coefficient in the discrete domain. kdd= kd/sampleTime. It is used to speed up the operations
+     * Integral coefficient in the discrete domain for each channel. kid = ki * sampleTime (or for each breakpoint with a Schedule). It is used to speed up the operations
      */
-    float64 kdd;
+    float64 *kid;
 
     /**
-     * Contribution of the derivative term.
+     * Derivative coefficient in the discrete domain for each channel. kdd= kd/sampleTime (or for each breakpoint with a Schedule). It is used to speed up the operations
      */
-    float64 derivative;
+    float64 *kdd;
 
     /**
      * Indicates the time between samples.
@@ -256,29 +274,29 @@ private:
     float64 sampleTime;
 
     /**
-     * upper limit saturation
+     * upper limit saturation for each channel (or for each breakpoint with a Schedule)
      */
-    float64 maxOutput;
+    float64 *maxOutput;
 
     /**
-     * lower limit saturation
+     * lower limit saturation for each channel (or for each breakpoint with a Schedule)
      */
-    float64 minOutput;
+    float64 *minOutput;
 
     /**
-     * Enables/disable the integral term when saturation is acting (anti-windup function)
+     * Number of controlled loops, i.e. number of elements of the input and output signals.
      */
-    bool enableIntegral;
+    uint32 numberOfChannels;
 
     /**
-     * Save the last input value
+     * Number of fractional bits of the int32 (Q format) signals.
      */
-    float64 lastInput;
+    uint32 fractionalBits;
 
     /**
-     * Save the last integrated term
+     * Implements the PID in the numeric type of the signals.
      */
-    float64 lastIntegral;
+    PIDHelper *helper;
 
     /**
      * When enableSubstraction is 1 the GAM expects two inputs: reference value and the feedback value (the actual measurement).
@@ -286,26 +304,11 @@ private:
      */
     bool enableSubstraction;
 
-    /**
-     * Points to the input reference array of the GAM
-     */
-    float64 *reference;
-
     /**
      * Size of the input or output of the GAM. The arrays of reference, measurement and output must have the same size.
      */
     uint32 sizeInputOutput;
 
-    /**
-     * Points to the input measurement array of the GAM
-     */
-    float64 *measurement;
-
-    /**
-     * Points to the output array of the GAM (which is the output of the PID controller)
-     */
-    float64 *output;
-
     /**
      * Number of input signal.
      */
@@ -362,14 +365,57 @@ private:
     uint32 outputDimension;
 
     /**
-     * @brief Implements the PID
+     * Number of breakpoints of the Schedule (0 if the gains are not scheduled).
+     */
+    uint32 numberOfBreakpoints;
+
+    /**
+     * Values of the scheduling variable at the breakpoints (strictly increasing).
+     */
+    float64 *scheduleBreakpoints;
+
+    /**
+     * Cell of the Schedule (between scheduleBreakpoints[scheduleCell] and scheduleBreakpoints[scheduleCell + 1]) of the last
+     * scheduling value.
+     */
+    uint32 scheduleCell;
+
+    /**
+     * The scheduling value of the gains and limits of the helper.
+     */
+    float64 lastSchedulingValue;
+
+    /**
+     * The scheduling variable signal memory.
+     */
+    const float64 *schedulingVariable;
+
+    /**
+     * @brief Interpolates the gains and the limits at the scheduling variable and updates the helper (if the scheduling variable changed).
+     */
+    void Schedule();
+
+    /**
+     * @brief Reads a parameter which can be a scalar or an array.
+     * @param[in] data the GAM configuration.
+     * @param[in] name the name of the parameter.
+     * @param[out] numberOfValues the number of elements of the parameter (0 if not defined).
+     * @return the values of the parameter (allocated with new[]) or NULL if the parameter is not defined or cannot be read.
      */
-    inline void GetValue();
+    static float64 *ReadParameter(StructuredDataI &data,
+                                  const char8 * const name,
+                                  uint32 &numberOfValues);
 
     /**
-     * Saturates the output of the PID if needed.
+     * @brief Copies the value of a parameter for each of the numberOfParameterValues elements.
+     * @param[in] values the values read with ReadParameter.
+     * @param[in] numberOfValues the number of values (0, 1 or numberOfParameterValues).
+     * @param[in] defaultValue the value used when the parameter is not defined.
+     * @return an array with numberOfParameterValues elements (allocated with new[]).
      */
-    inline void Saturation();
+    float64 *ExpandParameter(const float64 * const values,
+                             const uint32 numberOfValues,
+                             const float64 defaultValue) const;
 
 };
 
@@ -0,0 +1,137 @@
+/**
+ * @file PIDHelper.h
+ * @brief Header file for class PIDHelper
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class PIDHelper
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PIDHELPER_H_
+#define PIDHELPER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Support class for the PIDGAM. Implements the PID of all the channels for a given numeric type.
+ * @details The PIDGAM configuration (gains already discretised and saturation limits) is always given in float64
+ * and converted by the PIDHelperT to the type of the signals.
+ */
+class PIDHelper {
+public:
+    /**
+     * @brief Sets the memory of the signals.
+     * @param[in] referenceIn the reference (or the error if measurementIn is NULL) of each channel.
+     * @param[in] measurementIn the measurement of each channel. If NULL the PID input is referenceIn.
+     * @param[in] outputIn the output of each channel.
+     * @param[in] numberOfChannelsIn the number of channels (number of elements of the signals).
+     */
+    PIDHelper(const void * const referenceIn,
+              const void * const measurementIn,
+              void * const outputIn,
+              const uint32 numberOfChannelsIn);
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~PIDHelper();
+
+    /**
+     * @brief Sets the parameters of all the channels.
+     * @details Each parameter array has either one value, used for all the channels, or numberOfChannels values.
+     * @param[in] kpIn the proportional gains.
+     * @param[in] kidIn the integral gains multiplied by the sample time.
+     * @param[in] kddIn the derivative gains divided by the sample time.
+     * @param[in] maxOutputIn the upper saturation limits.
+     * @param[in] minOutputIn the lower saturation limits.
+     * @param[in] numberOfValues the number of values of each parameter array (1 or numberOfChannels).
+     * @return true if all the gains can be represented in the numeric type of the helper.
+     */
+    virtual bool SetParameters(const float64 * const kpIn,
+                               const float64 * const kidIn,
+                               const float64 * const kddIn,
+                               const float64 * const maxOutputIn,
+                               const float64 * const minOutputIn,
+                               const uint32 numberOfValues) = 0;
+
+    /**
+     * @brief Sets the same parameters to all the channels in real-time (e.g. from a gain-scheduling table).
+     * @details The transfer is bumpless: the last integral of each channel is corrected by (kp - kpIn) * lastError,
+     * so that the output does not jump if the error does not change. No memory is allocated.
+     * @param[in] kpIn the proportional gain.
+     * @param[in] kidIn the integral gain multiplied by the sample time.
+     * @param[in] kddIn the derivative gain divided by the sample time.
+     * @param[in] maxOutputIn the upper saturation limit.
+     * @param[in] minOutputIn the lower saturation limit.
+     * @pre the gains can be represented in the numeric type of the helper (see SetParameters).
+     */
+    virtual void UpdateParameters(const float64 kpIn,
+                                  const float64 kidIn,
+                                  const float64 kddIn,
+                                  const float64 maxOutputIn,
+                                  const float64 minOutputIn) = 0;
+
+    /**
+     * @brief Updates the output of all the channels.
+     */
+    virtual void Execute() = 0;
+
+    /**
+     * @brief Gets the number of channels.
+     * @return the number of channels.
+     */
+    uint32 GetNumberOfChannels() const;
+
+protected:
+    /**
+     * The reference (or error) signal memory.
+     */
+    const void * referenceMemory;
+
+    /**
+     * The measurement signal memory (NULL for a single input).
+     */
+    const void * measurementMemory;
+
+    /**
+     * The output signal memory.
+     */
+    void * outputMemory;
+
+    /**
+     * The number of channels.
+     */
+    uint32 numberOfChannels;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PIDHELPER_H_ */
@@ -0,0 +1,472 @@
+/**
+ * @file PIDHelperT.h
+ * @brief Header file for class PIDHelperT
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class PIDHelperT
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PIDHELPERT_H_
+#define PIDHELPERT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "PIDHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Support class for the PIDGAM. Implements the PID of all the channels in the numeric type T.
+ * @details The supported types are float64, float32 and int32. The state of the channels is stored as a structure
+ * of arrays and all the channels are updated in a single loop without branches. On SSE2 targets the float64
+ * (two channels at a time) and float32 (four channels at a time) loops use SSE2 instructions, which give
+ * the same results of the scalar loop.
+ *
+ * The int32 signals are fixed-point values in the Q format with fractionalBits fractional bits (i.e. the real value
+ * is signal / 2^fractionalBits). The gains are rounded to the nearest Q value and the saturation limits are
+ * clamped to the int32 range. The computation is bit exact and mirrors a typical FPGA implementation:
+ * the error, the error difference, each of the three terms and the integral are saturated to the int32 range and
+ * the products are computed in 64 bits and shifted right by fractionalBits (i.e. rounded towards minus infinity).
+ */
+/*lint -esym(9107, MARTe::PIDHelperT*) [MISRA C++ Rule 3-1-1]. Justification: Required for template implementation.
+ * No code is actually being generated and the header files can be included in multiple unit files.*/
+template<typename T>
+class PIDHelperT: public PIDHelper {
+public:
+    /**
+     * @see PIDHelper::PIDHelper
+     * @param[in] fractionalBitsIn the number of fractional bits of the int32 Q format (ignored for the float types).
+     */
+    PIDHelperT(const void * const referenceIn,
+               const void * const measurementIn,
+               void * const outputIn,
+               const uint32 numberOfChannelsIn,
+               const uint32 fractionalBitsIn = 0u);
+
+    /**
+     * @brief Destructor. Frees the parameter and state arrays.
+     */
+    virtual ~PIDHelperT();
+
+    /**
+     * @see PIDHelper::SetParameters
+     */
+    virtual bool SetParameters(const float64 * const kpIn,
+                               const float64 * const kidIn,
+                               const float64 * const kddIn,
+                               const float64 * const maxOutputIn,
+                               const float64 * const minOutputIn,
+                               const uint32 numberOfValues);
+
+    /**
+     * @see PIDHelper::UpdateParameters
+     */
+    virtual void UpdateParameters(const float64 kpIn,
+                                  const float64 kidIn,
+                                  const float64 kddIn,
+                                  const float64 maxOutputIn,
+                                  const float64 minOutputIn);
+
+    /**
+     * @see PIDHelper::Execute
+     */
+    virtual void Execute();
+
+private:
+
+    /**
+     * @brief Computes the last integral of a channel which keeps its output continuous when the proportional gain changes.
+     * @param[in] i the channel.
+     * @param[in] kpNew the new proportional gain.
+     * @return lastIntegral[i] + (kp[i] * lastInput[i]) - (kpNew * lastInput[i]).
+     */
+    T BumplessIntegral(const uint32 i,
+                       const T kpNew) const;
+
+    /**
+     * @brief Converts a value to the numeric type T.
+     * @param[in] value the value to convert.
+     * @param[out] converted the converted value (saturated if out of the range of T).
+     * @return true if the value is in the range of T.
+     */
+    bool Convert(const float64 value,
+                 T &converted) const;
+
+    /**
+     * @brief Implements the PID of the channels from first to numberOfChannels - 1.
+     * @param[in] first the first channel to update.
+     */
+    void ExecuteChannels(const uint32 first);
+
+    /**
+     * The number of fractional bits of the int32 Q format.
+     */
+    uint32 fractionalBits;
+
+    /**
+     * The reference (or error) of each channel.
+     */
+    const T *reference;
+
+    /**
+     * The measurement of each channel (noMeasurement for a single input).
+     */
+    const T *measurement;
+
+    /**
+     * The output of each channel.
+     */
+    T *output;
+
+    /**
+     * proportional coefficient of each channel
+     */
+    T *kp;
+
+    /**
+     * discrete integral coefficient of each channel
+     */
+    T *kid;
+
+    /**
+     * discrete derivative coefficient of each channel
+     */
+    T *kdd;
+
+    /**
+     * upper limit saturation of each channel
+     */
+    T *maxOutput;
+
+    /**
+     * lower limit saturation of each channel
+     */
+    T *minOutput;
+
+    /**
+     * For each channel, 1 if the integral term is accumulated and 0 when saturation is acting (anti-windup function)
+     */
+    T *enableIntegral;
+
+    /**
+     * The last input value of each channel
+     */
+    T *lastInput;
+
+    /**
+     * The last integrated term of each channel
+     */
+    T *lastIntegral;
+
+    /**
+     * Zeros used as measurement for a single input.
+     */
+    T *noMeasurement;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+template<typename T>
+PIDHelperT<T>::PIDHelperT(const void * const referenceIn,
+                          const void * const measurementIn,
+                          void * const outputIn,
+                          const uint32 numberOfChannelsIn,
+                          const uint32 fractionalBitsIn) :
+        PIDHelper(referenceIn, measurementIn, outputIn, numberOfChannelsIn) {
+    fractionalBits = fractionalBitsIn;
+    kp = new T[numberOfChannels];
+    kid = new T[numberOfChannels];
+    kdd = new T[numberOfChannels];
+    maxOutput = new T[numberOfChannels];
+    minOutput = new T[numberOfChannels];
+    enableIntegral = new T[numberOfChannels];
+    lastInput = new T[numberOfChannels];
+    lastIntegral = new T[numberOfChannels];
+    noMeasurement = NULL_PTR(T *);
+    uint32 i;
+    for (i = 0u; i < numberOfChannels; i++) {
+        kp[i] = static_cast<T>(0);
+        kid[i] = static_cast<T>(0);
+        kdd[i] = static_cast<T>(0);
+        maxOutput[i] = static_cast<T>(0);
+        minOutput[i] = static_cast<T>(0);
+        enableIntegral[i] = static_cast<T>(1);
+        lastInput[i] = static_cast<T>(0);
+        lastIntegral[i] = static_cast<T>(0);
+    }
+    reference = static_cast<const T *>(referenceMemory);
+    output = static_cast<T *>(outputMemory);
+    if (measurementMemory != NULL_PTR(const void *)) {
+        measurement = static_cast<const T *>(measurementMemory);
+    }
+    else {
+        noMeasurement = new T[numberOfChannels];
+        for (i = 0u; i < numberOfChannels; i++) {
+            noMeasurement[i] = static_cast<T>(0);
+        }
+        measurement = noMeasurement;
+    }
+}
+
+template<typename T>
+PIDHelperT<T>::~PIDHelperT() {
+    delete[] kp;
+    delete[] kid;
+    delete[] kdd;
+    delete[] maxOutput;
+    delete[] minOutput;
+    delete[] enableIntegral;
+    delete[] lastInput;
+    delete[] lastIntegral;
+    if (noMeasurement != NULL_PTR(T *)) {
+        delete[] noMeasurement;
+    }
+    reference = NULL_PTR(const T *);
+    measurement = NULL_PTR(const T *);
+    output = NULL_PTR(T *);
+}
+
+template<typename T>
+bool PIDHelperT<T>::SetParameters(const float64 * const kpIn,
+                                  const float64 * const kidIn,
+                                  const float64 * const kddIn,
+                                  const float64 * const maxOutputIn,
+                                  const float64 * const minOutputIn,
+                                  const uint32 numberOfValues) {
+    bool ok = true;
+    for (uint32 i = 0u; i < numberOfChannels; i++) {
+        uint32 j = (numberOfValues == 1u) ? (0u) : (i);
+        ok = (Convert(kpIn[j], kp[i]) && ok);
+        ok = (Convert(kidIn[j], kid[i]) && ok);
+        ok = (Convert(kddIn[j], kdd[i]) && ok);
+        /* The limits are saturated to the range of T */
+        (void) Convert(maxOutputIn[j], maxOutput[i]);
+        (void) Convert(minOutputIn[j], minOutput[i]);
+    }
+    return ok;
+}
+
+template<typename T>
+void PIDHelperT<T>::UpdateParameters(const float64 kpIn,
+                                     const float64 kidIn,
+                                     const float64 kddIn,
+                                     const float64 maxOutputIn,
+                                     const float64 minOutputIn) {
+    T kpNew;
+    T kidNew;
+    T kddNew;
+    T maxOutputNew;
+    T minOutputNew;
+    (void) Convert(kpIn, kpNew);
+    (void) Convert(kidIn, kidNew);
+    (void) Convert(kddIn, kddNew);
+    (void) Convert(maxOutputIn, maxOutputNew);
+    (void) Convert(minOutputIn, minOutputNew);
+    for (uint32 i = 0u; i < numberOfChannels; i++) {
+        lastIntegral[i] = BumplessIntegral(i, kpNew);
+        kp[i] = kpNew;
+        kid[i] = kidNew;
+        kdd[i] = kddNew;
+        maxOutput[i] = maxOutputNew;
+        minOutput[i] = minOutputNew;
+    }
+}
+
+template<typename T>
+T PIDHelperT<T>::BumplessIntegral(const uint32 i,
+                                  const T kpNew) const {
+    return lastIntegral[i] + ((kp[i] * lastInput[i]) - (kpNew * lastInput[i]));
+}
+
+template<typename T>
+bool PIDHelperT<T>::Convert(const float64 value,
+                            T &converted) const {
+    converted = static_cast<T>(value);
+    return true;
+}
+
+template<typename T>
+void PIDHelperT<T>::Execute() {
+    ExecuteChannels(0u);
+}
+
+template<typename T>
+void PIDHelperT<T>::ExecuteChannels(const uint32 first) {
+    const T zero = static_cast<T>(0);
+    const T one = static_cast<T>(1);
+    for (uint32 i = first; i < numberOfChannels; i++) {
+        T error = reference[i] - measurement[i];
+        T previousIntegral = lastIntegral[i];
+        T maxValue = maxOutput[i];
+        T minValue = minOutput[i];
+        T integral = (error * kid[i]) + ((enableIntegral[i] > zero) ? (previousIntegral) : (zero));
+        T derivative = (error - lastInput[i]) * kdd[i];
+        T value = ((kp[i] * error) + integral) + derivative;
+        /* maxValue > minValue, hence at most one of the limits is applied */
+        T limited = (value > maxValue) ? (maxValue) : (value);
+        limited = (limited < minValue) ? (minValue) : (limited);
+        output[i] = limited;
+        enableIntegral[i] = ((value > maxValue) || (value < minValue)) ? (zero) : (one);
+        lastInput[i] = error;
+        lastIntegral[i] = integral;
+    }
+}
+
+/**
+ * @brief Saturates a 64 bit value to the int32 range.
+ */
+inline int64 PIDHelperSaturate32(const int64 value) {
+    const int64 maxValue = 2147483647;
+    const int64 minValue = -maxValue - 1;
+    int64 saturated = (value > maxValue) ? (maxValue) : (value);
+    return (saturated < minValue) ? (minValue) : (saturated);
+}
+
+template<>
+inline bool PIDHelperT<float32>::Convert(const float64 value,
+                                         float32 &converted) const {
+    const float64 maxValue = 3.402823466e+38;
+    bool ok = (value <= maxValue) && (value >= -maxValue);
+    if (ok) {
+        converted = static_cast<float32>(value);
+    }
+    else {
+        converted = (value > 0.0) ? (static_cast<float32>(maxValue)) : (static_cast<float32>(-maxValue));
+    }
+    return ok;
+}
+
+template<>
+inline bool PIDHelperT<int32>::Convert(const float64 value,
+                                       int32 &converted) const {
+    float64 scaled = value * static_cast<float64>(static_cast<uint64>(1u) << fractionalBits);
+    bool ok = (scaled < 2147483647.5) && (scaled >= -2147483648.5);
+    if (ok) {
+        int64 rounded = (scaled >= 0.0) ? (static_cast<int64>(scaled + 0.5)) : (-static_cast<int64>(0.5 - scaled));
+        converted = static_cast<int32>(PIDHelperSaturate32(rounded));
+    }
+    else {
+        converted = (scaled > 0.0) ? (static_cast<int32>(2147483647)) : (static_cast<int32>(-2147483647 - 1));
+    }
+    return ok;
+}
+
+/*lint -save -e704 Shift right of a signed quantity. The (arithmetic) shift of the Q format products is intended.*/
+template<>
+inline void PIDHelperT<int32>::ExecuteChannels(const uint32 first) {
+    for (uint32 i = first; i < numberOfChannels; i++) {
+        int64 error = PIDHelperSaturate32(static_cast<int64>(reference[i]) - static_cast<int64>(measurement[i]));
+        int64 previousIntegral = (enableIntegral[i] > 0) ? (static_cast<int64>(lastIntegral[i])) : (0);
+        int64 integral = PIDHelperSaturate32((error * static_cast<int64>(kid[i])) >> fractionalBits);
+        integral = PIDHelperSaturate32(integral + previousIntegral);
+        int64 difference = PIDHelperSaturate32(error - static_cast<int64>(lastInput[i]));
+        int64 derivative = PIDHelperSaturate32((difference * static_cast<int64>(kdd[i])) >> fractionalBits);
+        int64 proportional = PIDHelperSaturate32((error * static_cast<int64>(kp[i])) >> fractionalBits);
+        int64 value = (proportional + integral) + derivative;
+        int64 maxValue = static_cast<int64>(maxOutput[i]);
+        int64 minValue = static_cast<int64>(minOutput[i]);
+        int64 limited = (value > maxValue) ? (maxValue) : (value);
+        limited = (limited < minValue) ? (minValue) : (limited);
+        output[i] = static_cast<int32>(limited);
+        enableIntegral[i] = ((value > maxValue) || (value < minValue)) ? (0) : (1);
+        lastInput[i] = static_cast<int32>(error);
+        lastIntegral[i] = static_cast<int32>(integral);
+    }
+}
+
+template<>
+inline int32 PIDHelperT<int32>::BumplessIntegral(const uint32 i,
+                                                 const int32 kpNew) const {
+    /* The proportional terms are computed as in ExecuteChannels, so that the correction is bit exact */
+    int64 error = static_cast<int64>(lastInput[i]);
+    int64 proportional = PIDHelperSaturate32((error * static_cast<int64>(kp[i])) >> fractionalBits);
+    int64 proportionalNew = PIDHelperSaturate32((error * static_cast<int64>(kpNew)) >> fractionalBits);
+    return static_cast<int32>(PIDHelperSaturate32((static_cast<int64>(lastIntegral[i]) + proportional) - proportionalNew));
+}
+/*lint -restore*/
+
+#if defined(__SSE2__)
+/*lint -save -e586 -e9016 -e923 SSE2 intrinsics on unaligned signal memory.*/
+template<>
+inline void PIDHelperT<float64>::Execute() {
+    /* Two channels for each iteration. The operations are the same (and in the same order) as in ExecuteChannels */
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d one = _mm_set1_pd(1.0);
+    uint32 i = 0u;
+    for (; (i + 2u) <= numberOfChannels; i += 2u) {
+        __m128d error = _mm_sub_pd(_mm_loadu_pd(&reference[i]), _mm_loadu_pd(&measurement[i]));
+        __m128d previousIntegral = _mm_and_pd(_mm_cmpgt_pd(_mm_loadu_pd(&enableIntegral[i]), zero), _mm_loadu_pd(&lastIntegral[i]));
+        __m128d integral = _mm_add_pd(_mm_mul_pd(error, _mm_loadu_pd(&kid[i])), previousIntegral);
+        __m128d derivative = _mm_mul_pd(_mm_sub_pd(error, _mm_loadu_pd(&lastInput[i])), _mm_loadu_pd(&kdd[i]));
+        __m128d value = _mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_loadu_pd(&kp[i]), error), integral), derivative);
+        __m128d maxValue = _mm_loadu_pd(&maxOutput[i]);
+        __m128d minValue = _mm_loadu_pd(&minOutput[i]);
+        /* _mm_min_pd(maxValue, value) is (maxValue < value) ? maxValue : value, as in the scalar loop */
+        __m128d limited = _mm_max_pd(minValue, _mm_min_pd(maxValue, value));
+        __m128d saturated = _mm_or_pd(_mm_cmpgt_pd(value, maxValue), _mm_cmplt_pd(value, minValue));
+        _mm_storeu_pd(&output[i], limited);
+        _mm_storeu_pd(&enableIntegral[i], _mm_andnot_pd(saturated, one));
+        _mm_storeu_pd(&lastInput[i], error);
+        _mm_storeu_pd(&lastIntegral[i], integral);
+    }
+    ExecuteChannels(i);
+}
+
+template<>
+inline void PIDHelperT<float32>::Execute() {
+    /* Four channels for each iteration. The operations are the same (and in the same order) as in ExecuteChannels */
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0F);
+    uint32 i = 0u;
+    for (; (i + 4u) <= numberOfChannels; i += 4u) {
+        __m128 error = _mm_sub_ps(_mm_loadu_ps(&reference[i]), _mm_loadu_ps(&measurement[i]));
+        __m128 previousIntegral = _mm_and_ps(_mm_cmpgt_ps(_mm_loadu_ps(&enableIntegral[i]), zero), _mm_loadu_ps(&lastIntegral[i]));
+        __m128 integral = _mm_add_ps(_mm_mul_ps(error, _mm_loadu_ps(&kid[i])), previousIntegral);
+        __m128 derivative = _mm_mul_ps(_mm_sub_ps(error, _mm_loadu_ps(&lastInput[i])), _mm_loadu_ps(&kdd[i]));
+        __m128 value = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&kp[i]), error), integral), derivative);
+        __m128 maxValue = _mm_loadu_ps(&maxOutput[i]);
+        __m128 minValue = _mm_loadu_ps(&minOutput[i]);
+        __m128 limited = _mm_max_ps(minValue, _mm_min_ps(maxValue, value));
+        __m128 saturated = _mm_or_ps(_mm_cmpgt_ps(value, maxValue), _mm_cmplt_ps(value, minValue));
+        _mm_storeu_ps(&output[i], limited);
+        _mm_storeu_ps(&enableIntegral[i], _mm_andnot_ps(saturated, one));
+        _mm_storeu_ps(&lastInput[i], error);
+        _mm_storeu_ps(&lastIntegral[i], integral);
+    }
+    ExecuteChannels(i);
+}
+/*lint -restore*/
+#endif
+
+}
+
+#endif /* PIDHELPERT_H_ */
@@ -0,0 +1,690 @@
+/**
+ * @file ParallelGAMGroup.cpp
+ * @brief Source file for class ParallelGAMGroup
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ParallelGAMGroup (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MemoryOperationsHelper.h"
+#include "ParallelGAMGroup.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+
+/**
+ * @brief Calls a signal memory accessor of GAM on a child GAM.
+ * @details The signal memory accessors are protected, i.e. only available to the GAM itself. The group (also a GAM) forms a pointer to
+ * the accessor it inherits and calls it on the child, whose memory it manages.
+ */
+template<typename AccessorType>
+void *GetChildMemory(MARTe::GAM &child,
+                     AccessorType accessor) {
+    return (child.*accessor)();
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+ParallelGAMGroup::ParallelGAMGroup() :
+        GAM(),
+        ForkJoinTaskI() {
+    children = NULL_PTR(ParallelGAMGroupChild *);
+    numberOfChildren = 0u;
+    numberOfStages = 0u;
+    currentStage = 0u;
+}
+
+ParallelGAMGroup::~ParallelGAMGroup() {
+    if (children != NULL_PTR(ParallelGAMGroupChild *)) {
+        for (uint32 c = 0u; c < numberOfChildren; c++) {
+            if (children[c].inputs != NULL_PTR(ParallelGAMGroupSignal *)) {
+                delete[] children[c].inputs;
+            }
+            if (children[c].outputs != NULL_PTR(ParallelGAMGroupSignal *)) {
+                delete[] children[c].outputs;
+            }
+            if (children[c].inputCopies != NULL_PTR(ParallelGAMGroupCopy *)) {
+                delete[] children[c].inputCopies;
+            }
+            if (children[c].outputCopies != NULL_PTR(ParallelGAMGroupCopy *)) {
+                delete[] children[c].outputCopies;
+            }
+        }
+        delete[] children;
+    }
+}
+
+bool ParallelGAMGroup::Initialise(StructuredDataI &data) {
+    bool ok = pool.Initialise(data);
+    if (ok) {
+        bool hasSignals = data.MoveRelative("InputSignals");
+        if (hasSignals) {
+            (void) data.MoveToAncestor(1u);
+        }
+        else {
+            hasSignals = data.MoveRelative("OutputSignals");
+            if (hasSignals) {
+                (void) data.MoveToAncestor(1u);
+            }
+        }
+        ok = !hasSignals;
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The signals of the group are derived from the children and shall not be declared");
+        }
+    }
+    //The children are the GAMs (i.e. the + nodes with signals)
+    uint32 nOfNodes = data.GetNumberOfChildren();
+    bool *isChild = NULL_PTR(bool *);
+    if (ok) {
+        isChild = new bool[nOfNodes];
+        for (uint32 n = 0u; n < nOfNodes; n++) {
+            const char8 * const nodeName = data.GetChildName(n);
+            isChild[n] = false;
+            if (nodeName[0] == '+') {
+                if (data.MoveRelative(nodeName)) {
+                    isChild[n] = data.MoveRelative("InputSignals");
+                    if (isChild[n]) {
+                        (void) data.MoveToAncestor(1u);
+                    }
+                    else {
+                        isChild[n] = data.MoveRelative("OutputSignals");
+                        if (isChild[n]) {
+                            (void) data.MoveToAncestor(1u);
+                        }
+                    }
+                    (void) data.MoveToAncestor(1u);
+                }
+            }
+            if (isChild[n]) {
+                numberOfChildren++;
+            }
+        }
+        ok = (numberOfChildren > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "At least one child GAM shall be declared");
+        }
+    }
+    if (ok) {
+        children = new ParallelGAMGroupChild[numberOfChildren];
+        uint32 c = 0u;
+        for (uint32 n = 0u; (n < nOfNodes) && (ok); n++) {
+            /*lint -e{613} isChild cannot be NULL if ok*/
+            if (isChild[n]) {
+                const char8 * const nodeName = data.GetChildName(n);
+                children[c].name = &nodeName[1];
+                children[c].numberOfInputs = 0u;
+                children[c].inputs = NULL_PTR(ParallelGAMGroupSignal *);
+                children[c].numberOfOutputs = 0u;
+                children[c].outputs = NULL_PTR(ParallelGAMGroupSignal *);
+                children[c].stage = 0u;
+                children[c].executor = 0u;
+                children[c].inputCopies = NULL_PTR(ParallelGAMGroupCopy *);
+                children[c].numberOfInputCopies = 0u;
+                children[c].outputCopies = NULL_PTR(ParallelGAMGroupCopy *);
+                children[c].numberOfOutputCopies = 0u;
+                ok = data.MoveRelative(nodeName);
+                if (ok) {
+                    ok = ReadChildSignals(data, c, InputSignals);
+                }
+                if (ok) {
+                    ok = ReadChildSignals(data, c, OutputSignals);
+                }
+                if (ok) {
+                    ok = data.MoveToAncestor(1u);
+                }
+                c++;
+            }
+        }
+    }
+    if (isChild != NULL_PTR(bool *)) {
+        delete[] isChild;
+    }
+    //An input which is the output of another child is internal to the group
+    uint32 nOfGroupInputs = 0u;
+    uint32 nOfGroupOutputs = 0u;
+    if (ok) {
+        for (uint32 c = 0u; c < numberOfChildren; c++) {
+            for (uint32 s = 0u; s < children[c].numberOfInputs; s++) {
+                ParallelGAMGroupSignal &input = children[c].inputs[s];
+                for (uint32 p = 0u; (p < numberOfChildren) && (!input.internal); p++) {
+                    if (p != c) {
+                        for (uint32 o = 0u; (o < children[p].numberOfOutputs) && (!input.internal); o++) {
+                            if (children[p].outputs[o].key == input.key) {
+                                input.internal = true;
+                                input.producer = p;
+                                input.producerIndex = o;
+                            }
+                        }
+                    }
+                }
+                if (!input.internal) {
+                    nOfGroupInputs++;
+                }
+            }
+            nOfGroupOutputs += children[c].numberOfOutputs;
+        }
+    }
+    ConfigurationDatabase groupData;
+    if (ok) {
+        ok = data.Copy(groupData);
+    }
+    if ((ok) && (nOfGroupInputs > 0u)) {
+        ok = groupData.MoveToRoot();
+        if (ok) {
+            ok = groupData.CreateRelative("InputSignals");
+        }
+        uint32 groupIndex = 0u;
+        for (uint32 c = 0u; (c < numberOfChildren) && (ok); c++) {
+            StreamString nodeName;
+            (void) nodeName.Printf("+%s", children[c].name.Buffer());
+            ok = data.MoveRelative(nodeName.Buffer());
+            if (ok) {
+                ok = WriteGroupSignals(data, groupData, c, InputSignals, groupIndex);
+            }
+            if (ok) {
+                ok = data.MoveToAncestor(1u);
+            }
+        }
+    }
+    if ((ok) && (nOfGroupOutputs > 0u)) {
+        ok = groupData.MoveToRoot();
+        if (ok) {
+            ok = groupData.CreateRelative("OutputSignals");
+        }
+        uint32 groupIndex = 0u;
+        for (uint32 c = 0u; (c < numberOfChildren) && (ok); c++) {
+            StreamString nodeName;
+            (void) nodeName.Printf("+%s", children[c].name.Buffer());
+            ok = data.MoveRelative(nodeName.Buffer());
+            if (ok) {
+                ok = WriteGroupSignals(data, groupData, c, OutputSignals, groupIndex);
+            }
+            if (ok) {
+                ok = data.MoveToAncestor(1u);
+            }
+        }
+    }
+    if (ok) {
+        ok = groupData.MoveToRoot();
+    }
+    if (ok) {
+        ok = GAM::Initialise(groupData);
+    }
+    return ok;
+}
+
+bool ParallelGAMGroup::ReadChildSignals(StructuredDataI &data,
+                                        const uint32 childIdx,
+                                        const SignalDirection direction) {
+    bool ok = true;
+    const char8 * const nodeName = (direction == InputSignals) ? ("InputSignals") : ("OutputSignals");
+    if (data.MoveRelative(nodeName)) {
+        uint32 nOfSignals = data.GetNumberOfChildren();
+        ParallelGAMGroupSignal *signals = new ParallelGAMGroupSignal[nOfSignals];
+        for (uint32 s = 0u; (s < nOfSignals) && (ok); s++) {
+            signals[s].name = data.GetChildName(s);
+            signals[s].groupIndex = 0u;
+            signals[s].internal = false;
+            signals[s].producer = 0u;
+            signals[s].producerIndex = 0u;
+            ok = data.MoveRelative(signals[s].name.Buffer());
+            if (ok) {
+                StreamString dataSourceName;
+                StreamString alias;
+                if (!data.Read("DataSource", dataSourceName)) {
+                    dataSourceName = "";
+                }
+                if (!data.Read("Alias", alias)) {
+                    alias = signals[s].name;
+                }
+                if (!data.Read("Type", signals[s].type)) {
+                    signals[s].type = "";
+                }
+                (void) signals[s].key.Printf("%s/%s", dataSourceName.Buffer(), alias.Buffer());
+                ok = data.MoveToAncestor(1u);
+            }
+        }
+        if (direction == InputSignals) {
+            children[childIdx].numberOfInputs = nOfSignals;
+            children[childIdx].inputs = signals;
+        }
+        else {
+            children[childIdx].numberOfOutputs = nOfSignals;
+            children[childIdx].outputs = signals;
+        }
+        if (ok) {
+            ok = data.MoveToAncestor(1u);
+        }
+    }
+    return ok;
+}
+
+bool ParallelGAMGroup::WriteGroupSignals(StructuredDataI &data,
+                                         ConfigurationDatabase &groupData,
+                                         const uint32 childIdx,
+                                         const SignalDirection direction,
+                                         uint32 &groupIndex) {
+    bool ok = true;
+    const char8 * const nodeName = (direction == InputSignals) ? ("InputSignals") : ("OutputSignals");
+    uint32 nOfSignals = (direction == InputSignals) ? (children[childIdx].numberOfInputs) : (children[childIdx].numberOfOutputs);
+    ParallelGAMGroupSignal *signals = (direction == InputSignals) ? (children[childIdx].inputs) : (children[childIdx].outputs);
+    for (uint32 s = 0u; (s < nOfSignals) && (ok); s++) {
+        if (!signals[s].internal) {
+            StreamString groupName;
+            (void) groupName.Printf("%s_%s", children[childIdx].name.Buffer(), signals[s].name.Buffer());
+            StreamString signalPath;
+            (void) signalPath.Printf("%s.%s", nodeName, signals[s].name.Buffer());
+            ok = groupData.CreateRelative(groupName.Buffer());
+            if (ok) {
+                ok = data.MoveRelative(signalPath.Buffer());
+            }
+            if (ok) {
+                ok = data.Copy(groupData);
+                if (!data.MoveToAncestor(2u)) {
+                    ok = false;
+                }
+            }
+            if (ok) {
+                StreamString alias;
+                if (!groupData.Read("Alias", alias)) {
+                    ok = groupData.Write("Alias", signals[s].name.Buffer());
+                }
+            }
+            if (ok) {
+                ok = groupData.MoveToAncestor(1u);
+            }
+            signals[s].groupIndex = groupIndex;
+            groupIndex++;
+        }
+    }
+    return ok;
+}
+
+bool ParallelGAMGroup::Setup() {
+    bool ok = true;
+    for (uint32 c = 0u; (c < numberOfChildren) && (ok); c++) {
+        for (uint32 i = 0u; (i < Size()) && (!children[c].gam.IsValid()); i++) {
+            ReferenceT<GAM> gam = Get(i);
+            if (gam.IsValid()) {
+                if (children[c].name == gam->GetName()) {
+                    children[c].gam = gam;
+                }
+            }
+        }
+        ok = children[c].gam.IsValid();
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The child %s is not a GAM", children[c].name.Buffer());
+        }
+    }
+    if (ok) {
+        ok = ComputeStages();
+    }
+    //All the children memory must be allocated before the copies between children are computed
+    for (uint32 c = 0u; (c < numberOfChildren) && (ok); c++) {
+        ok = ConfigureChild(c);
+    }
+    for (uint32 c = 0u; (c < numberOfChildren) && (ok); c++) {
+        ok = children[c].gam->Setup();
+        if (ok) {
+            ok = ComputeCopies(c);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Failed to Setup the child %s", children[c].name.Buffer());
+        }
+    }
+    if (ok) {
+        ok = pool.Start(*this, GetName());
+    }
+    return ok;
+}
+
+bool ParallelGAMGroup::ComputeStages() {
+    bool ok = true;
+    //Each iteration settles (at least) one more level of the dependency graph
+    bool changed = true;
+    uint32 iteration;
+    for (iteration = 0u; (iteration <= numberOfChildren) && (changed); iteration++) {
+        changed = false;
+        for (uint32 c = 0u; c < numberOfChildren; c++) {
+            for (uint32 s = 0u; s < children[c].numberOfInputs; s++) {
+                if (children[c].inputs[s].internal) {
+                    uint32 stage = children[children[c].inputs[s].producer].stage + 1u;
+                    if (stage > children[c].stage) {
+                        children[c].stage = stage;
+                        changed = true;
+                    }
+                }
+            }
+        }
+    }
+    ok = !changed;
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "The children have circular dependencies");
+    }
+    if (ok) {
+        numberOfStages = 0u;
+        for (uint32 c = 0u; c < numberOfChildren; c++) {
+            if ((children[c].stage + 1u) > numberOfStages) {
+                numberOfStages = children[c].stage + 1u;
+            }
+        }
+        //The children of each stage are distributed round-robin, starting with the real-time thread
+        for (uint32 stage = 0u; stage < numberOfStages; stage++) {
+            uint32 q = 0u;
+            for (uint32 c = 0u; c < numberOfChildren; c++) {
+                if (children[c].stage == stage) {
+                    children[c].executor = q % (pool.GetNumberOfWorkers() + 1u);
+                    q++;
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+bool ParallelGAMGroup::ConfigureChild(const uint32 childIdx) {
+    bool ok = true;
+    ConfigurationDatabase childData;
+    for (uint32 d = 0u; (d < 2u) && (ok); d++) {
+        SignalDirection direction = (d == 0u) ? (InputSignals) : (OutputSignals);
+        const char8 * const nodeName = (d == 0u) ? ("InputSignals") : ("OutputSignals");
+        uint32 nOfSignals = (d == 0u) ? (children[childIdx].numberOfInputs) : (children[childIdx].numberOfOutputs);
+        const ParallelGAMGroupSignal * const signals = (d == 0u) ? (children[childIdx].inputs) : (children[childIdx].outputs);
+        uint32 totalByteSize = 0u;
+        for (uint32 s = 0u; (s < nOfSignals) && (ok); s++) {
+            //An internal input has the properties of the output of the producer
+            SignalDirection groupDirection = direction;
+            uint32 groupIdx = signals[s].groupIndex;
+            if (signals[s].internal) {
+                groupDirection = OutputSignals;
+                groupIdx = children[signals[s].producer].outputs[signals[s].producerIndex].groupIndex;
+            }
+            TypeDescriptor type = GetSignalType(groupDirection, groupIdx);
+            StreamString dataSourceName;
+            uint32 nOfElements = 0u;
+            uint32 nOfDimensions = 0u;
+            uint32 byteSize = 0u;
+            uint32 nOfSamples = 0u;
+            ok = GetSignalDataSourceName(groupDirection, groupIdx, dataSourceName);
+            if (ok) {
+                ok = GetSignalNumberOfElements(groupDirection, groupIdx, nOfElements);
+            }
+            if (ok) {
+                ok = GetSignalNumberOfDimensions(groupDirection, groupIdx, nOfDimensions);
+            }
+            if (ok) {
+                ok = GetSignalByteSize(groupDirection, groupIdx, byteSize);
+            }
+            if (ok) {
+                ok = GetSignalNumberOfSamples(groupDirection, groupIdx, nOfSamples);
+            }
+            if ((ok) && (signals[s].internal)) {
+                ok = (nOfSamples == 1u);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The signal %s exchanged with the child %s shall have one sample",
+                                 signals[s].name.Buffer(), children[childIdx].name.Buffer());
+                }
+                if ((ok) && (signals[s].type.Size() > 0u)) {
+                    ok = (TypeDescriptor::GetTypeDescriptorFromTypeName(signals[s].type.Buffer()) == type);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::InitialisationError, "The type of the signal %s of the child %s differs from the producer's",
+                                     signals[s].name.Buffer(), children[childIdx].name.Buffer());
+                    }
+                }
+            }
+            StreamString signalPath;
+            (void) signalPath.Printf("Signals.%s.%u", nodeName, s);
+            if (ok) {
+                ok = childData.CreateAbsolute(signalPath.Buffer());
+            }
+            if (ok) {
+                ok = childData.Write("QualifiedName", signals[s].name.Buffer());
+            }
+            if (ok) {
+                ok = childData.Write("DataSource", dataSourceName.Buffer());
+            }
+            if (ok) {
+                ok = childData.Write("Type", TypeDescriptor::GetTypeNameFromTypeDescriptor(type));
+            }
+            if (ok) {
+                ok = childData.Write("NumberOfElements", nOfElements);
+            }
+            if (ok) {
+                ok = childData.Write("NumberOfDimensions", nOfDimensions);
+            }
+            if (ok) {
+                ok = childData.Write("ByteSize", byteSize);
+            }
+            StreamString memoryPath;
+            (void) memoryPath.Printf("Memory.%s.%u", nodeName, s);
+            if (ok) {
+                ok = childData.CreateAbsolute(memoryPath.Buffer());
+            }
+            if (ok) {
+                ok = childData.Write("DataSource", dataSourceName.Buffer());
+            }
+            StreamString samplesPath;
+            (void) samplesPath.Printf("Signals.%u", s);
+            if (ok) {
+                ok = childData.CreateRelative(samplesPath.Buffer());
+            }
+            if (ok) {
+                ok = childData.Write("Samples", nOfSamples);
+            }
+            totalByteSize += (byteSize * nOfSamples);
+        }
+        if ((ok) && (nOfSignals > 0u)) {
+            StreamString directionPath;
+            (void) directionPath.Printf("Signals.%s", nodeName);
+            ok = childData.MoveAbsolute(directionPath.Buffer());
+            if (ok) {
+                ok = childData.Write("ByteSize", totalByteSize);
+            }
+        }
+    }
+    if (ok) {
+        ok = childData.MoveToRoot();
+    }
+    if (ok) {
+        ok = children[childIdx].gam->SetConfiguredDatabase(childData);
+    }
+    if (ok) {
+        ok = children[childIdx].gam->AllocateInputSignalsMemory();
+    }
+    if (ok) {
+        ok = children[childIdx].gam->AllocateOutputSignalsMemory();
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Failed to configure the signals of the child %s", children[childIdx].name.Buffer());
+    }
+    return ok;
+}
+
+bool ParallelGAMGroup::ComputeCopies(const uint32 childIdx) {
+    bool ok = true;
+    ParallelGAMGroupChild &child = children[childIdx];
+    /*lint -e{613} the gam of all the children is valid after ConfigureChild*/
+    uint8 *childInputMemory = static_cast<uint8 *>(GetChildMemory(*child.gam.operator->(), &ParallelGAMGroup::GetInputSignalsMemory));
+    uint8 *childOutputMemory = static_cast<uint8 *>(GetChildMemory(*child.gam.operator->(), &ParallelGAMGroup::GetOutputSignalsMemory));
+    child.inputCopies = new ParallelGAMGroupCopy[child.numberOfInputs + 1u];
+    child.outputCopies = new ParallelGAMGroupCopy[child.numberOfOutputs + 1u];
+    //The signals of a GAM are contiguous, in the order of the configuration
+    uint32 offset = 0u;
+    for (uint32 s = 0u; (s < child.numberOfInputs) && (ok); s++) {
+        const ParallelGAMGroupSignal &input = child.inputs[s];
+        uint32 groupIdx = input.groupIndex;
+        SignalDirection groupDirection = InputSignals;
+        const uint8 *source = NULL_PTR(const uint8 *);
+        if (input.internal) {
+            //Read directly from the memory of the producer
+            const ParallelGAMGroupChild &producer = children[input.producer];
+            uint8 *producerMemory = static_cast<uint8 *>(GetChildMemory(*producer.gam.operator->(), &ParallelGAMGroup::GetOutputSignalsMemory));
+            uint32 producerOffset = 0u;
+            for (uint32 o = 0u; (o < input.producerIndex) && (ok); o++) {
+                uint32 size = 0u;
+                uint32 samples = 0u;
+                ok = GetSignalByteSize(OutputSignals, producer.outputs[o].groupIndex, size);
+                if (ok) {
+                    ok = GetSignalNumberOfSamples(OutputSignals, producer.outputs[o].groupIndex, samples);
+                }
+                producerOffset += (size * samples);
+            }
+            source = &producerMemory[producerOffset];
+            groupIdx = producer.outputs[input.producerIndex].groupIndex;
+            groupDirection = OutputSignals;
+        }
+        else {
+            source = static_cast<const uint8 *>(GetInputSignalMemory(groupIdx));
+        }
+        uint32 size = 0u;
+        uint32 samples = 0u;
+        if (ok) {
+            ok = GetSignalByteSize(groupDirection, groupIdx, size);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(groupDirection, groupIdx, samples);
+        }
+        size *= samples;
+        if (ok) {
+            uint8 *destination = &childInputMemory[offset];
+            bool merged = false;
+            if (child.numberOfInputCopies > 0u) {
+                ParallelGAMGroupCopy &last = child.inputCopies[child.numberOfInputCopies - 1u];
+                merged = ((&static_cast<uint8 *>(last.destination)[last.size] == destination)
+                        && (&static_cast<const uint8 *>(last.source)[last.size] == source));
+                if (merged) {
+                    last.size += size;
+                }
+            }
+            if (!merged) {
+                child.inputCopies[child.numberOfInputCopies].destination = destination;
+                child.inputCopies[child.numberOfInputCopies].source = source;
+                child.inputCopies[child.numberOfInputCopies].size = size;
+                child.numberOfInputCopies++;
+            }
+        }
+        offset += size;
+    }
+    offset = 0u;
+    for (uint32 s = 0u; (s < child.numberOfOutputs) && (ok); s++) {
+        uint32 groupIdx = child.outputs[s].groupIndex;
+        uint32 size = 0u;
+        uint32 samples = 0u;
+        ok = GetSignalByteSize(OutputSignals, groupIdx, size);
+        if (ok) {
+            ok = GetSignalNumberOfSamples(OutputSignals, groupIdx, samples);
+        }
+        size *= samples;
+        if (ok) {
+            const uint8 *source = &childOutputMemory[offset];
+            uint8 *destination = static_cast<uint8 *>(GetOutputSignalMemory(groupIdx));
+            bool merged = false;
+            if (child.numberOfOutputCopies > 0u) {
+                ParallelGAMGroupCopy &last = child.outputCopies[child.numberOfOutputCopies - 1u];
+                merged = ((&static_cast<uint8 *>(last.destination)[last.size] == destination)
+                        && (&static_cast<const uint8 *>(last.source)[last.size] == source));
+                if (merged) {
+                    last.size += size;
+                }
+            }
+            if (!merged) {
+                child.outputCopies[child.numberOfOutputCopies].destination = destination;
+                child.outputCopies[child.numberOfOutputCopies].source = source;
+                child.outputCopies[child.numberOfOutputCopies].size = size;
+                child.numberOfOutputCopies++;
+            }
+        }
+        offset += size;
+    }
+    return ok;
+}
+
+bool ParallelGAMGroup::Execute() {
+    bool ok = true;
+    for (uint32 stage = 0u; stage < numberOfStages; stage++) {
+        currentStage = stage;
+        if (!pool.Run()) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+bool ParallelGAMGroup::ExecuteStage(const uint32 executor,
+                                    const uint32 stage) {
+    bool ok = true;
+    for (uint32 c = 0u; c < numberOfChildren; c++) {
+        const ParallelGAMGroupChild &child = children[c];
+        if ((child.stage == stage) && (child.executor == executor)) {
+            uint32 n;
+            for (n = 0u; n < child.numberOfInputCopies; n++) {
+                (void) MemoryOperationsHelper::Copy(child.inputCopies[n].destination, child.inputCopies[n].source, child.inputCopies[n].size);
+            }
+            if (!child.gam->Execute()) {
+                ok = false;
+            }
+            for (n = 0u; n < child.numberOfOutputCopies; n++) {
+                (void) MemoryOperationsHelper::Copy(child.outputCopies[n].destination, child.outputCopies[n].source, child.outputCopies[n].size);
+            }
+        }
+    }
+    return ok;
+}
+
+bool ParallelGAMGroup::ExecuteTask(const uint32 executor) {
+    return ExecuteStage(executor, currentStage);
+}
+
+uint32 ParallelGAMGroup::GetNumberOfChildren() const {
+    return numberOfChildren;
+}
+
+uint32 ParallelGAMGroup::GetNumberOfStages() const {
+    return numberOfStages;
+}
+
+uint32 ParallelGAMGroup::GetChildStage(const uint32 childIdx) const {
+    uint32 stage = 0xFFFFFFFFu;
+    if (childIdx < numberOfChildren) {
+        stage = children[childIdx].stage;
+    }
+    return stage;
+}
+
+uint32 ParallelGAMGroup::GetNumberOfWorkers() const {
+    return pool.GetNumberOfWorkers();
+}
+
+CLASS_REGISTER(ParallelGAMGroup, "1.0")
+
+}
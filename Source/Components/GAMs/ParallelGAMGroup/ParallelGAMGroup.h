@@ -0,0 +1,373 @@
+/**
+ * @file ParallelGAMGroup.h
+ * @brief Header file for class ParallelGAMGroup
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ParallelGAMGroup
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PARALLELGAMGROUP_H_
+#define PARALLELGAMGROUP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "ForkJoinPool.h"
+#include "GAM.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief A memory copy between the group and a child (merged for signals which are contiguous in both memories).
+ */
+struct ParallelGAMGroupCopy {
+    /**
+     * The destination of the copy.
+     */
+    void *destination;
+
+    /**
+     * The source of the copy.
+     */
+    const void *source;
+
+    /**
+     * The number of bytes to copy.
+     */
+    uint32 size;
+};
+
+/**
+ * @brief A signal of a child GAM.
+ */
+struct ParallelGAMGroupSignal {
+    /**
+     * The name of the signal in the child.
+     */
+    StreamString name;
+
+    /**
+     * The DataSource and Alias (or name) of the signal, which identify the signal across the children.
+     */
+    StreamString key;
+
+    /**
+     * The Type of the signal, as declared by the child.
+     */
+    StreamString type;
+
+    /**
+     * The index of the signal in the group (only for signals exchanged with the DataSources).
+     */
+    uint32 groupIndex;
+
+    /**
+     * True if the (input) signal is produced by another child of the group.
+     */
+    bool internal;
+
+    /**
+     * The child which produces the (internal) input signal.
+     */
+    uint32 producer;
+
+    /**
+     * The index of the output signal in the producer.
+     */
+    uint32 producerIndex;
+};
+
+/**
+ * @brief A child GAM of the group.
+ */
+struct ParallelGAMGroupChild {
+    /**
+     * The name of the child.
+     */
+    StreamString name;
+
+    /**
+     * The child GAM.
+     */
+    ReferenceT<GAM> gam;
+
+    /**
+     * The number of input signals of the child.
+     */
+    uint32 numberOfInputs;
+
+    /**
+     * The input signals of the child.
+     */
+    ParallelGAMGroupSignal *inputs;
+
+    /**
+     * The number of output signals of the child.
+     */
+    uint32 numberOfOutputs;
+
+    /**
+     * The output signals of the child.
+     */
+    ParallelGAMGroupSignal *outputs;
+
+    /**
+     * The stage where the child is executed (one more than the latest stage of the children it depends on).
+     */
+    uint32 stage;
+
+    /**
+     * The thread which executes the child (0 for the real-time thread, n for the worker n - 1).
+     */
+    uint32 executor;
+
+    /**
+     * The copies to the child input memory, before its Execute.
+     */
+    ParallelGAMGroupCopy *inputCopies;
+
+    /**
+     * The number of inputCopies.
+     */
+    uint32 numberOfInputCopies;
+
+    /**
+     * The copies from the child output memory, after its Execute.
+     */
+    ParallelGAMGroupCopy *outputCopies;
+
+    /**
+     * The number of outputCopies.
+     */
+    uint32 numberOfOutputCopies;
+};
+
+/**
+ * @brief A GAM which executes a group of child GAMs in parallel on a pool of worker threads.
+ * @details The GAMs of a RealTimeThread are executed one after the other. A thread whose GAMs are independent (e.g. several FilterGAM
+ * banks and StatisticsGAMs) can instead declare them as children of a ParallelGAMGroup, which is then listed in the thread Functions
+ * as any other GAM. The latency of the cycle then drops (roughly) with the number of cores, without splitting the GAMs in several threads
+ * synchronised with a RealTimeThreadSynchronisation.
+ *
+ * The signals of the group are not declared: at Initialise the group exposes all the signals of its children as its own signals, named
+ * ChildName_SignalName (with the original signal name as the Alias, unless the child sets one). The brokers thus read (write) the
+ * signals of all the children at once, and the group copies them to (from) the memory of each child.
+ *
+ * An input signal of a child which is an output signal of another child (same DataSource and Alias/name) is not read from the DataSource
+ * but copied directly from the memory of the child that produces it: the consumer depends on the producer. At Setup the children are
+ * sorted in stages: a child with no dependency is in stage 0 and any other child is in the stage after the latest stage of the children
+ * it depends on (circular dependencies are an error). In every cycle the stages are executed one after the other and the children of
+ * a stage are executed in parallel, distributed round-robin (in the order of the configuration) over the real-time thread and the
+ * NumberOfWorkers worker threads. The real-time thread waits for the workers to complete a stage before starting the next one.
+ *
+ * The stages are executed with a ForkJoinPool: the worker threads busy-wait on the start of the next stage and should thus run on
+ * isolated cores (see ForkJoinPool). The worker threads keep spinning while the group is not executed (e.g. in a state where the group
+ * is not scheduled).
+ *
+ * The children signals which are exchanged between children shall have one sample and no Ranges. The children are driven by the group:
+ * they are not registered in the RealTimeApplication (i.e. they cannot be listed in a thread and do not have timing signals).
+ *
+ * The configuration syntax is (names are only given as an example):
+ *
+ * <pre>
+ * +Parallel = {
+ *     Class = ParallelGAMGroup
+ *     NumberOfWorkers = 3 //Optional. Default = the number of CPUs in the ThreadPlacement CPUs (or 0, i.e. all the children are executed
+ *                         //by the real-time thread). At most 64.
+ *     ThreadPlacement = { //Optional. See ForkJoinPool and ThreadPlacement.
+ *         CPUs = 0xE //Worker 0 on CPU 1, worker 1 on CPU 2 and worker 2 on CPU 3.
+ *         PriorityClass = RealTimePriorityClass
+ *         PriorityLevel = 20
+ *     }
+ *     +Filter1 = {
+ *         Class = FilterGAM
+ *         ...
+ *         InputSignals = {
+ *             Current = {
+ *                 DataSource = ADC
+ *                 Type = float32
+ *             }
+ *         }
+ *         OutputSignals = {
+ *             CurrentFiltered = {
+ *                 DataSource = DDB1
+ *                 Type = float32
+ *             }
+ *         }
+ *     }
+ *     +Filter2 = {
+ *         Class = FilterGAM
+ *         ...
+ *     }
+ *     +Statistics = {
+ *         Class = StatisticsGAM
+ *         InputSignals = {
+ *             CurrentFiltered = { //Produced by Filter1: Statistics is executed after Filter1.
+ *                 DataSource = DDB1
+ *                 Type = float32
+ *             }
+ *         }
+ *         ...
+ *     }
+ * }
+ * </pre>
+ *
+ * The group shall not declare InputSignals nor OutputSignals.
+ */
+class ParallelGAMGroup: public GAM, public ForkJoinTaskI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    ParallelGAMGroup();
+
+    /**
+     * @brief Frees the children descriptions.
+     */
+    virtual ~ParallelGAMGroup();
+
+    /**
+     * @brief Reads the parameters, creates the children and exposes their signals as the group signals (see class description).
+     * @return true if GAM::Initialise succeeds, all the parameters are valid and the group does not declare signals.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Configures the signals of the children, calls their Setup, sorts them in stages and starts the worker threads.
+     * @return true if all the children could be configured, there are no circular dependencies and the worker threads were started.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Executes the stages one after the other, each one in parallel on the real-time thread and on the worker threads.
+     * @return true if the Execute of all the children returned true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief ForkJoinPool callback. Executes the children of the current stage assigned to \a executor.
+     * @return true if the Execute of all these children returned true.
+     */
+    virtual bool ExecuteTask(const uint32 executor);
+
+    /**
+     * @brief Gets the number of child GAMs.
+     */
+    uint32 GetNumberOfChildren() const;
+
+    /**
+     * @brief Gets the number of stages (valid after Setup).
+     */
+    uint32 GetNumberOfStages() const;
+
+    /**
+     * @brief Gets the stage of a child (valid after Setup).
+     * @param[in] childIdx the index of the child (in the order of the configuration).
+     * @return the stage of the child or 0xFFFFFFFF if childIdx is not valid.
+     */
+    uint32 GetChildStage(const uint32 childIdx) const;
+
+    /**
+     * @brief Gets the number of worker threads.
+     */
+    uint32 GetNumberOfWorkers() const;
+
+private:
+
+    /**
+     * @brief Reads the signals (InputSignals or OutputSignals) declared by the child \a childIdx (data shall be on the child node).
+     */
+    bool ReadChildSignals(StructuredDataI &data,
+                          const uint32 childIdx,
+                          const SignalDirection direction);
+
+    /**
+     * @brief Writes the signals of the child \a childIdx in the group signals (data shall be on the child node, groupData on the
+     * InputSignals or OutputSignals node).
+     */
+    bool WriteGroupSignals(StructuredDataI &data,
+                           ConfigurationDatabase &groupData,
+                           const uint32 childIdx,
+                           const SignalDirection direction,
+                           uint32 &groupIndex);
+
+    /**
+     * @brief Writes the configured database of the child \a childIdx from the configured group signals.
+     */
+    bool ConfigureChild(const uint32 childIdx);
+
+    /**
+     * @brief Computes the memory copies of the child \a childIdx (all the children memory shall be allocated).
+     */
+    bool ComputeCopies(const uint32 childIdx);
+
+    /**
+     * @brief Sorts the children in stages.
+     */
+    bool ComputeStages();
+
+    /**
+     * @brief Executes the children of the stage \a stage assigned to the executor \a executor.
+     */
+    bool ExecuteStage(const uint32 executor,
+                      const uint32 stage);
+
+    /**
+     * The children.
+     */
+    ParallelGAMGroupChild *children;
+
+    /**
+     * The number of children.
+     */
+    uint32 numberOfChildren;
+
+    /**
+     * The number of stages.
+     */
+    uint32 numberOfStages;
+
+    /**
+     * The worker threads.
+     */
+    ForkJoinPool pool;
+
+    /**
+     * The stage being executed.
+     */
+    volatile uint32 currentStage;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PARALLELGAMGROUP_H_ */
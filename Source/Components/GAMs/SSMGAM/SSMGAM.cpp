@@ -50,8 +50,6 @@ namespace MARTe {
 SSMGAM::SSMGAM() :
         GAM() {
     stateMatrixPointer = NULL_PTR(float64 **);
-    intermediateState1Pointer = NULL_PTR(float64 **);
-    intermediateState2Pointer = NULL_PTR(float64 **);
     stateMatrixNumberOfRows = 0u;
     stateMatrixNumberOfColumns = 0u;
 
@@ -85,10 +83,22 @@ SSMGAM::SSMGAM() :
 
     inputVectorPointer = NULL_PTR(float64 **);
     outputVectorPointer = NULL_PTR(float64 **);
-    intermediateOutput1Pointer = NULL_PTR(float64 **);
-    intermediateOutput2Pointer = NULL_PTR(float64 **);
     stateVectorPointer = NULL_PTR(float64 **);
-    derivativeStateVectorPointer = NULL_PTR(float64 **);
+    stateCoefficients = NULL_PTR(float64 *);
+    inputCoefficients = NULL_PTR(float64 *);
+    outputCoefficients = NULL_PTR(float64 *);
+    feedthroughCoefficients = NULL_PTR(float64 *);
+    stateInputVector = NULL_PTR(float64 *);
+    inputVector = NULL_PTR(float64 *);
+    stateVector = NULL_PTR(float64 *);
+    derivativeStateVector = NULL_PTR(float64 *);
+    sparseRowStart = NULL_PTR(uint32 *);
+    sparseColumns = NULL_PTR(uint32 *);
+    sparseValues = NULL_PTR(float64 *);
+    blockStart = NULL_PTR(uint32 *);
+    numberOfBlocks = 0u;
+    matrixFormat = SSMGAMMatrixFormatAuto;
+    updateFunction = NULL;
     sampleFrequency = 0.0;
 
     enableFeedthroughMatrix = false;
@@ -164,54 +174,47 @@ SSMGAM::~SSMGAM() {
         delete[] stateVectorPointer;
         stateVectorPointer = NULL_PTR(float64 **);
     }
-    if (derivativeStateVectorPointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < sizeDerivativeStateVector; row++) {
-            if (derivativeStateVectorPointer[row] != NULL_PTR(float64 *)) {
-                delete[] derivativeStateVectorPointer[row];
-            }
-        }
-        delete[] derivativeStateVectorPointer;
-        derivativeStateVectorPointer = NULL_PTR(float64 **);
+    if (stateCoefficients != NULL_PTR(float64 *)) {
+        delete[] stateCoefficients;
+        stateCoefficients = NULL_PTR(float64 *);
     }
-    if (intermediateOutput1Pointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < sizeOutputVector; row++) {
-            if (intermediateOutput1Pointer[row] != NULL_PTR(float64 *)) {
-                delete[] intermediateOutput1Pointer[row];
-                intermediateOutput1Pointer[row] = NULL_PTR(float64 *);
-            }
-        }
-        delete[] intermediateOutput1Pointer;
-        intermediateOutput1Pointer = NULL_PTR(float64 **);
+    if (inputCoefficients != NULL_PTR(float64 *)) {
+        delete[] inputCoefficients;
+        inputCoefficients = NULL_PTR(float64 *);
     }
-    if (intermediateOutput2Pointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < sizeOutputVector; row++) {
-            if (intermediateOutput2Pointer[row] != NULL_PTR(float64 *)) {
-                delete[] intermediateOutput2Pointer[row];
-                intermediateOutput2Pointer[row] = NULL_PTR(float64 *);
-            }
-        }
-        delete[] intermediateOutput2Pointer;
-        intermediateOutput2Pointer = NULL_PTR(float64 **);
+    if (outputCoefficients != NULL_PTR(float64 *)) {
+        delete[] outputCoefficients;
+        outputCoefficients = NULL_PTR(float64 *);
     }
-    if (intermediateState1Pointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < stateMatrixNumberOfRows; row++) {
-            if (intermediateState1Pointer[row] != NULL_PTR(float64 *)) {
-                delete[] intermediateState1Pointer[row];
-                intermediateState1Pointer[row] = NULL_PTR(float64 *);
-            }
-        }
-        delete[] intermediateState1Pointer;
-        intermediateState1Pointer = NULL_PTR(float64 **);
+    if (feedthroughCoefficients != NULL_PTR(float64 *)) {
+        delete[] feedthroughCoefficients;
+        feedthroughCoefficients = NULL_PTR(float64 *);
     }
-    if (intermediateState2Pointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < stateMatrixNumberOfRows; row++) {
-            if (intermediateState2Pointer[row] != NULL_PTR(float64 *)) {
-                delete[] intermediateState2Pointer[row];
-                intermediateState2Pointer[row] = NULL_PTR(float64 *);
-            }
-        }
-        delete[] intermediateState2Pointer;
-        intermediateState2Pointer = NULL_PTR(float64 **);
+    if (stateInputVector != NULL_PTR(float64 *)) {
+        delete[] stateInputVector;
+        stateInputVector = NULL_PTR(float64 *);
+    }
+    inputVector = NULL_PTR(float64 *);
+    stateVector = NULL_PTR(float64 *);
+    if (sparseRowStart != NULL_PTR(uint32 *)) {
+        delete[] sparseRowStart;
+        sparseRowStart = NULL_PTR(uint32 *);
+    }
+    if (sparseColumns != NULL_PTR(uint32 *)) {
+        delete[] sparseColumns;
+        sparseColumns = NULL_PTR(uint32 *);
+    }
+    if (sparseValues != NULL_PTR(float64 *)) {
+        delete[] sparseValues;
+        sparseValues = NULL_PTR(float64 *);
+    }
+    if (blockStart != NULL_PTR(uint32 *)) {
+        delete[] blockStart;
+        blockStart = NULL_PTR(uint32 *);
+    }
+    if (derivativeStateVector != NULL_PTR(float64 *)) {
+        delete[] derivativeStateVector;
+        derivativeStateVector = NULL_PTR(float64 *);
     }
 }
 
@@ -244,13 +247,9 @@ bool SSMGAM::Initialise(StructuredDataI &data) {
 
         if (ok) { // allocate state matrix memory and read matrix coefficients
             stateMatrixPointer = new float64 *[stateMatrixNumberOfRows];
-            intermediateState1Pointer = new float64 *[stateMatrixNumberOfRows];
-            intermediateState2Pointer = new float64 *[stateMatrixNumberOfRows];
             //lint -e{613} Possible use of null pointer--> If new fails the program crashes.
             for (uint32 i = 0u; (i < stateMatrixNumberOfRows) && ok; i++) {
                 stateMatrixPointer[i] = new float64[stateMatrixNumberOfColumns];
-                intermediateState1Pointer[i] = new float64[1u];
-                intermediateState2Pointer[i] = new float64[1u];
             }
             if (ok) {
                 Matrix<float64> matrix(stateMatrixPointer, stateMatrixNumberOfRows, stateMatrixNumberOfColumns);
@@ -407,6 +406,27 @@ bool SSMGAM::Initialise(StructuredDataI &data) {
             }
         }
     }
+    if (ok) {
+        StreamString matrixFormatName;
+        if (data.Read("MatrixFormat", matrixFormatName)) {
+            if (matrixFormatName == "Dense") {
+                matrixFormat = SSMGAMMatrixFormatDense;
+            }
+            else if (matrixFormatName == "Sparse") {
+                matrixFormat = SSMGAMMatrixFormatSparse;
+            }
+            else if (matrixFormatName == "BlockDiagonal") {
+                matrixFormat = SSMGAMMatrixFormatBlockDiagonal;
+            }
+            else if (matrixFormatName == "Auto") {
+                matrixFormat = SSMGAMMatrixFormatAuto;
+            }
+            else {
+                ok = false;
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for MatrixFormat. Possible values Auto, Dense, Sparse or BlockDiagonal");
+            }
+        }
+    }
     return ok;
 }
 
@@ -586,8 +606,6 @@ bool SSMGAM::Setup() {
 
         }
         outputVectorPointer = new float64 *[sizeOutputVector];
-        intermediateOutput1Pointer = new float64 *[sizeOutputVector];
-        intermediateOutput2Pointer = new float64 *[sizeOutputVector];
         //lint -e{613} Possible use of null pointer--> If new fails the program crashes.
         for (uint32 i = 0u; (i < sizeOutputVector); i++) {
             outputVectorPointer[i] = static_cast<float64 *>(GetOutputSignalMemory(i));
@@ -596,8 +614,6 @@ bool SSMGAM::Setup() {
                 uint32 auxIdx = i;
                 REPORT_ERROR(ErrorManagement::ParametersError, "GetOutputSignalMemory(%u) returned a null pointer", auxIdx);
             }
-            intermediateOutput1Pointer[i] = new float64[1u];
-            intermediateOutput2Pointer[i] = new float64[1u];
         }
         stateVectorPointer = new float64 *[sizeStateVector];
         uint32 auxIdx = 0u;
@@ -610,74 +626,311 @@ bool SSMGAM::Setup() {
             }
             auxIdx++;
         }
-        derivativeStateVectorPointer = new float64 *[sizeDerivativeStateVector];
-        for (uint32 i = 0u; (i < sizeDerivativeStateVector); i++) {
-            derivativeStateVectorPointer[i] = new float64 [1u];
-        }
         if (ok) {
-            stateMatrix = Matrix<float64>(stateMatrixPointer, stateMatrixNumberOfRows, stateMatrixNumberOfColumns);
-            intermediateState1 = Matrix<float64>(intermediateState1Pointer, stateMatrixNumberOfRows, 1u);
-            intermediateState2 = Matrix<float64>(intermediateState2Pointer, stateMatrixNumberOfRows, 1u);
-            outputMatrix = Matrix<float64>(outputMatrixPointer, outputMatrixNumberOfRows, outputMatrixNumberOfColumns);
+            stateCoefficients = CopyCoefficients(stateMatrixPointer, stateMatrixNumberOfRows, stateMatrixNumberOfColumns);
+            inputCoefficients = CopyCoefficients(inputMatrixPointer, inputMatrixNumberOfRows, inputMatrixNumberOfColumns);
+            outputCoefficients = CopyCoefficients(outputMatrixPointer, outputMatrixNumberOfRows, outputMatrixNumberOfColumns);
             if (feedthroughMatrixPointer != NULL_PTR(float64 **)) {
-                feedthroughMatrix = Matrix<float64>(feedthroughMatrixPointer, feedthroughMatrixNumberOfRows, feedthroughMatrixNumberOfColumns);
+                feedthroughCoefficients = CopyCoefficients(feedthroughMatrixPointer, feedthroughMatrixNumberOfRows, feedthroughMatrixNumberOfColumns);
                 enableFeedthroughMatrix = true;
             }
             else {
                 enableFeedthroughMatrix = false;
             }
-
-            stateVector = Matrix<float64>(stateVectorPointer, sizeStateVector, 1u);
-            outputVector = Matrix<float64>(outputVectorPointer, outputMatrixNumberOfRows, 1u);
-            inputMatrix = Matrix<float64>(inputMatrixPointer, inputMatrixNumberOfRows, inputMatrixNumberOfColumns);
-            inputVector = Matrix<float64>(inputVectorPointer, inputMatrixNumberOfColumns, 1u);
-            intermediateOutput1 = Matrix<float64>(intermediateOutput1Pointer, outputMatrixNumberOfRows, 1u);
-            intermediateOutput2 = Matrix<float64>(intermediateOutput2Pointer, outputMatrixNumberOfRows, 1u);
-            derivativeStateVector = Matrix<float64>(derivativeStateVectorPointer, sizeDerivativeStateVector, 1u);
+            stateInputVector = new float64[sizeStateVector + inputMatrixNumberOfColumns];
+            stateVector = &stateInputVector[0];
+            inputVector = &stateInputVector[sizeStateVector];
+            derivativeStateVector = new float64[sizeDerivativeStateVector];
+            for (uint32 i = 0u; i < sizeStateVector; i++) {
+                stateVector[i] = 0.0;
+                derivativeStateVector[i] = 0.0;
+            }
+            SelectMatrixFormat();
         }
     }
     return ok;
 }
 
-bool SSMGAM::Execute() {
-    bool ok = stateVector.Copy(derivativeStateVector);
-    if (ok) {
-        ok = outputMatrix.Product(stateVector, intermediateOutput1);
+void SSMGAM::SelectMatrixFormat() {
+    const uint32 n = sizeStateVector;
+    const uint32 p = inputMatrixNumberOfColumns;
+    uint32 i;
+    uint32 j;
+    //Non-zero coefficients of A and B.
+    uint32 numberOfStateCoefficients = 0u;
+    uint32 numberOfInputCoefficients = 0u;
+    for (i = 0u; i < (n * n); i++) {
+        if (stateCoefficients[i] != 0.0) {
+            numberOfStateCoefficients++;
+        }
     }
-    if (ok && enableFeedthroughMatrix) {
-        ok = feedthroughMatrix.Product(inputVector, intermediateOutput2);
+    for (i = 0u; i < (n * p); i++) {
+        if (inputCoefficients[i] != 0.0) {
+            numberOfInputCoefficients++;
+        }
     }
-    if (ok) {
-        if (enableFeedthroughMatrix) {
-            ok = intermediateOutput1.Sum(intermediateOutput2, outputVector);
+    //A block ends in the state i when no coefficient in the rows and columns of the states up to i reaches a later state.
+    blockStart = new uint32[n + 1u];
+    blockStart[0] = 0u;
+    numberOfBlocks = 0u;
+    uint32 blockEnd = 0u;
+    uint32 blockCoefficients = 0u;
+    for (i = 0u; i < n; i++) {
+        if (blockEnd < (i + 1u)) {
+            blockEnd = i + 1u;
+        }
+        for (j = blockEnd; j < n; j++) {
+            bool nonZero = (stateCoefficients[(i * n) + j] != 0.0);
+            if (!nonZero) {
+                nonZero = (stateCoefficients[(j * n) + i] != 0.0);
+            }
+            if (nonZero) {
+                blockEnd = j + 1u;
+            }
+        }
+        if (blockEnd == (i + 1u)) {
+            const uint32 blockSize = blockEnd - blockStart[numberOfBlocks];
+            blockCoefficients += blockSize * blockSize;
+            numberOfBlocks++;
+            blockStart[numberOfBlocks] = blockEnd;
+        }
+    }
+    if (matrixFormat == SSMGAMMatrixFormatAuto) {
+        const bool isBlockDiagonal = (numberOfBlocks > 1u);
+        if (n <= 16u) {
+            matrixFormat = SSMGAMMatrixFormatDense;
+        }
+        else if (isBlockDiagonal && ((2u * numberOfStateCoefficients) >= blockCoefficients)) {
+            matrixFormat = SSMGAMMatrixFormatBlockDiagonal;
+        }
+        else if ((4u * (numberOfStateCoefficients + numberOfInputCoefficients)) <= (n * (n + p))) {
+            matrixFormat = SSMGAMMatrixFormatSparse;
+        }
+        else if (isBlockDiagonal) {
+            matrixFormat = SSMGAMMatrixFormatBlockDiagonal;
         }
         else {
-            ok = outputVector.Copy(intermediateOutput1);
+            matrixFormat = SSMGAMMatrixFormatDense;
+        }
+    }
+    if (matrixFormat == SSMGAMMatrixFormatSparse) {
+        //Compressed sparse rows of [A B]. The columns index stateInputVector = [x u].
+        const uint32 numberOfCoefficients = numberOfStateCoefficients + numberOfInputCoefficients;
+        sparseRowStart = new uint32[n + 1u];
+        sparseColumns = new uint32[(numberOfCoefficients > 0u) ? numberOfCoefficients : 1u];
+        sparseValues = new float64[(numberOfCoefficients > 0u) ? numberOfCoefficients : 1u];
+        uint32 k = 0u;
+        for (i = 0u; i < n; i++) {
+            sparseRowStart[i] = k;
+            for (j = 0u; j < n; j++) {
+                if (stateCoefficients[(i * n) + j] != 0.0) {
+                    sparseColumns[k] = j;
+                    sparseValues[k] = stateCoefficients[(i * n) + j];
+                    k++;
+                }
+            }
+            for (j = 0u; j < p; j++) {
+                if (inputCoefficients[(i * p) + j] != 0.0) {
+                    sparseColumns[k] = n + j;
+                    sparseValues[k] = inputCoefficients[(i * p) + j];
+                    k++;
+                }
+            }
         }
+        sparseRowStart[n] = k;
+        updateFunction = &SSMGAM::UpdateSparse;
+        REPORT_ERROR(ErrorManagement::Information, "Sparse MatrixFormat with %u non-zero coefficients", numberOfCoefficients);
     }
-    if (ok) {
-        ok = stateMatrix.Product(stateVector, intermediateState1);
+    else if (matrixFormat == SSMGAMMatrixFormatBlockDiagonal) {
+        updateFunction = &SSMGAM::UpdateBlockDiagonal;
+        REPORT_ERROR(ErrorManagement::Information, "BlockDiagonal MatrixFormat with %u blocks", numberOfBlocks);
     }
-    if (ok) {
-        ok = inputMatrix.Product(inputVector, intermediateState2);
+    else {
+        matrixFormat = SSMGAMMatrixFormatDense;
+        //The loops over the states of the small systems are unrolled at compile time.
+        switch (n) {
+        case 2u:
+            updateFunction = &SSMGAM::Update<2u>;
+            break;
+        case 3u:
+            updateFunction = &SSMGAM::Update<3u>;
+            break;
+        case 4u:
+            updateFunction = &SSMGAM::Update<4u>;
+            break;
+        case 5u:
+            updateFunction = &SSMGAM::Update<5u>;
+            break;
+        case 6u:
+            updateFunction = &SSMGAM::Update<6u>;
+            break;
+        case 7u:
+            updateFunction = &SSMGAM::Update<7u>;
+            break;
+        case 8u:
+            updateFunction = &SSMGAM::Update<8u>;
+            break;
+        case 9u:
+            updateFunction = &SSMGAM::Update<9u>;
+            break;
+        case 10u:
+            updateFunction = &SSMGAM::Update<10u>;
+            break;
+        case 11u:
+            updateFunction = &SSMGAM::Update<11u>;
+            break;
+        case 12u:
+            updateFunction = &SSMGAM::Update<12u>;
+            break;
+        case 13u:
+            updateFunction = &SSMGAM::Update<13u>;
+            break;
+        case 14u:
+            updateFunction = &SSMGAM::Update<14u>;
+            break;
+        case 15u:
+            updateFunction = &SSMGAM::Update<15u>;
+            break;
+        case 16u:
+            updateFunction = &SSMGAM::Update<16u>;
+            break;
+        default:
+            updateFunction = &SSMGAM::Update<0u>;
+            break;
+        }
     }
+}
+
+bool SSMGAM::Execute() {
+    bool ok = (updateFunction != NULL);
     if (ok) {
-        ok = intermediateState1.Sum(intermediateState2, derivativeStateVector);
+        (this->*updateFunction)();
     }
     return ok;
 }
 
+template<uint32 numberOfStates>
+void SSMGAM::UpdateOutput() {
+    const uint32 n = (numberOfStates > 0u) ? numberOfStates : sizeStateVector;
+    const uint32 p = inputMatrixNumberOfColumns;
+    const uint32 q = sizeOutputVector;
+    uint32 i;
+    uint32 j;
+    for (j = 0u; j < p; j++) {
+        inputVector[j] = *inputVectorPointer[j];
+    }
+    //x[k] = x[k+1] of the previous cycle
+    for (i = 0u; i < n; i++) {
+        stateVector[i] = derivativeStateVector[i];
+        *stateVectorPointer[i] = stateVector[i];
+    }
+    //y[k] = Cx[k]+Du[k]
+    const float64 *c = outputCoefficients;
+    const float64 *d = feedthroughCoefficients;
+    for (i = 0u; i < q; i++) {
+        float64 cx = 0.0;
+        for (j = 0u; j < n; j++) {
+            cx += c[j] * stateVector[j];
+        }
+        c = &c[n];
+        if (enableFeedthroughMatrix) {
+            float64 du = 0.0;
+            for (j = 0u; j < p; j++) {
+                du += d[j] * inputVector[j];
+            }
+            d = &d[p];
+            cx += du;
+        }
+        *outputVectorPointer[i] = cx;
+    }
+}
+
+template<uint32 numberOfStates>
+void SSMGAM::Update() {
+    UpdateOutput<numberOfStates>();
+    const uint32 n = (numberOfStates > 0u) ? numberOfStates : sizeStateVector;
+    const uint32 p = inputMatrixNumberOfColumns;
+    uint32 i;
+    uint32 j;
+    //x[k+1] = Ax[k]+Bu[k]
+    const float64 *a = stateCoefficients;
+    const float64 *b = inputCoefficients;
+    for (i = 0u; i < n; i++) {
+        float64 ax = 0.0;
+        for (j = 0u; j < n; j++) {
+            ax += a[j] * stateVector[j];
+        }
+        a = &a[n];
+        float64 bu = 0.0;
+        for (j = 0u; j < p; j++) {
+            bu += b[j] * inputVector[j];
+        }
+        b = &b[p];
+        derivativeStateVector[i] = ax + bu;
+    }
+}
+
+void SSMGAM::UpdateSparse() {
+    UpdateOutput<0u>();
+    //x[k+1] = [A B][x[k] u[k]]
+    for (uint32 i = 0u; i < sizeStateVector; i++) {
+        float64 axbu = 0.0;
+        const uint32 end = sparseRowStart[i + 1u];
+        for (uint32 k = sparseRowStart[i]; k < end; k++) {
+            axbu += sparseValues[k] * stateInputVector[sparseColumns[k]];
+        }
+        derivativeStateVector[i] = axbu;
+    }
+}
+
+void SSMGAM::UpdateBlockDiagonal() {
+    UpdateOutput<0u>();
+    const uint32 n = sizeStateVector;
+    const uint32 p = inputMatrixNumberOfColumns;
+    //x[k+1] = Ax[k]+Bu[k], where only the coefficients of the block of the state are used from each row of A.
+    for (uint32 block = 0u; block < numberOfBlocks; block++) {
+        const uint32 start = blockStart[block];
+        const uint32 end = blockStart[block + 1u];
+        for (uint32 i = start; i < end; i++) {
+            const float64 *a = &stateCoefficients[i * n];
+            const float64 *b = &inputCoefficients[i * p];
+            float64 ax = 0.0;
+            uint32 j;
+            for (j = start; j < end; j++) {
+                ax += a[j] * stateVector[j];
+            }
+            float64 bu = 0.0;
+            for (j = 0u; j < p; j++) {
+                bu += b[j] * inputVector[j];
+            }
+            derivativeStateVector[i] = ax + bu;
+        }
+    }
+}
+
+float64 *SSMGAM::CopyCoefficients(float64 ** const matrixPointer,
+                                  const uint32 numberOfRows,
+                                  const uint32 numberOfColumns) {
+    float64 *coefficients = new float64[numberOfRows * numberOfColumns];
+    for (uint32 row = 0u; row < numberOfRows; row++) {
+        for (uint32 column = 0u; column < numberOfColumns; column++) {
+            coefficients[(row * numberOfColumns) + column] = matrixPointer[row][column];
+        }
+    }
+    return coefficients;
+}
+
 bool SSMGAM::PrepareNextState(const char8 * const currentStateName,
                               const char8 * const nextStateName) {
     bool ret = true;
 
     if (resetInEachState) {
-        bool cond1 = (stateVector.GetDataPointer() != NULL_PTR(float64 **));
-        bool cond2 = (derivativeStateVector.GetDataPointer() != NULL_PTR(float64 **));
+        bool cond1 = (stateVectorPointer != NULL_PTR(float64 **));
+        bool cond2 = (derivativeStateVector != NULL_PTR(float64 *));
         if (cond1 && cond2) {
             for (uint32 i = 0u; i < sizeStateVector; i++) {
-                stateVector(i, 0u) = 0.0;
-                derivativeStateVector(i, 0u) = 0.0;
+                *stateVectorPointer[i] = 0.0;
+                derivativeStateVector[i] = 0.0;
             }
         }
         else {
@@ -689,12 +942,12 @@ bool SSMGAM::PrepareNextState(const char8 * const currentStateName,
     else {
         //If the currentStateName and lastStateExecuted are different-> rest values
         if (lastStateExecuted != currentStateName) {
-            bool cond1 = (stateVector.GetDataPointer() != NULL_PTR(float64 **));
-            bool cond2 = (derivativeStateVector.GetDataPointer() != NULL_PTR(float64 **));
+            bool cond1 = (stateVectorPointer != NULL_PTR(float64 **));
+            bool cond2 = (derivativeStateVector != NULL_PTR(float64 *));
             if (cond1 && cond2) {
                 for (uint32 i = 0u; i < sizeStateVector; i++) {
-                    stateVector(i, 0u) = 0.0;
-                    derivativeStateVector(i, 0u) = 0.0;
+                    *stateVectorPointer[i] = 0.0;
+                    derivativeStateVector[i] = 0.0;
                 }
             }
             else {
@@ -707,6 +960,10 @@ bool SSMGAM::PrepareNextState(const char8 * const currentStateName,
 
     return ret;
 }
+SSMGAMMatrixFormat SSMGAM::GetMatrixFormat() const {
+    return matrixFormat;
+}
+
 CLASS_REGISTER(SSMGAM, "1.0")
 }
 
@@ -39,6 +39,16 @@
 
 namespace MARTe {
 
+/**
+ * Storage of the state and input matrices used to compute x[k+1] = Ax[k]+Bu[k].
+ */
+enum SSMGAMMatrixFormat {
+    SSMGAMMatrixFormatDense,
+    SSMGAMMatrixFormatSparse,
+    SSMGAMMatrixFormatBlockDiagonal,
+    SSMGAMMatrixFormatAuto
+};
+
 /**
  * @brief GAM which implements a generic State Space model with constant matrices and float64.
  * @details The GAM implements the following equations:\n
@@ -87,6 +97,18 @@ namespace MARTe {
  * </li>
  * </ul>
  *
+ * The next state x[k+1] = Ax[k]+Bu[k] can be computed with the following MatrixFormat:
+ * <ul>
+ * <li>Dense: all the coefficients of A and B are used.</li>
+ * <li>Sparse: only the non-zero coefficients of [A B] are used (compressed sparse rows).</li>
+ * <li>BlockDiagonal: A is partitioned in the largest number of independent diagonal blocks (i.e. A[i][j] = 0 if i and j
+ * belong to different blocks) and each block is computed separately with the dense B rows.</li>
+ * <li>Auto (default): Dense if the state vector has 16 elements or less. Otherwise BlockDiagonal if A has more than one block
+ * and at least half of the coefficients of the blocks are non-zero, Sparse if at most one fourth of the coefficients of [A B]
+ * are non-zero, BlockDiagonal if A has more than one block and Dense otherwise.</li>
+ * </ul>
+ * The non-zero coefficients and the blocks are detected in Setup(). The output equation y[k] = Cx[k]+Du[k] is always dense.
+ *
  * The configuration syntax is (names and signal quantity are only given as an example):
  *
  * <pre>
@@ -97,6 +119,7 @@ namespace MARTe {
  *     OutputMatrix = {{1 0}} //Compulsory
  *     FeedthroughMatrix = {{0 1}} //Optional
  *     ResetInEachState = 0//Compulsory. 1--> reset in each state, 0--> reset if the previous state is different from the next state
+ *     MatrixFormat = Auto //Optional. Auto (default), Dense, Sparse or BlockDiagonal.
  *     SampleFrequency = 0.0001 // Currently optional and not used.
  *     InputSignals = {
  *         InputSignal1 = { //input of the SS
@@ -144,8 +167,6 @@ public:
     /** @brief Default constructor
      * @post
      * stateMatrixPointer = NULL_PTR(float64 **)\n
-     * intermediateState1Pointer = NULL_PTR(float64 **)\n
-     * intermediateState2Pointer = NULL_PTR(float64 **)\n
      * stateMatrixNumberOfRows = 0u\n
      * stateMatrixNumberOfColumns = 0u\n
      * stateMatrixNumberOfRows = 0u\n
@@ -172,10 +193,22 @@ public:
      * numberOfOutputSamples = 0u\n
      * inputVectorPointer = NULL_PTR(float64 **)\n
      * outputVectorPointer = NULL_PTR(float64 **)\n
-     * intermediateOutput1Pointer = NULL_PTR(float64 **)\n
-     * intermediateOutput2Pointer = NULL_PTR(float64 **)\n
      * stateVectorPointer = NULL_PTR(float64 **)\n
-     * derivativeStateVectorPointer = NULL_PTR(float64 **)\n
+     * stateCoefficients = NULL_PTR(float64 *)\n
+     * inputCoefficients = NULL_PTR(float64 *)\n
+     * outputCoefficients = NULL_PTR(float64 *)\n
+     * feedthroughCoefficients = NULL_PTR(float64 *)\n
+     * inputVector = NULL_PTR(float64 *)\n
+     * stateVector = NULL_PTR(float64 *)\n
+     * derivativeStateVector = NULL_PTR(float64 *)\n
+     * stateInputVector = NULL_PTR(float64 *)\n
+     * sparseRowStart = NULL_PTR(uint32 *)\n
+     * sparseColumns = NULL_PTR(uint32 *)\n
+     * sparseValues = NULL_PTR(float64 *)\n
+     * blockStart = NULL_PTR(uint32 *)\n
+     * numberOfBlocks = 0u\n
+     * matrixFormat = SSMGAMMatrixFormatAuto\n
+     * updateFunction = NULL\n
      * sampleFrequency = 0.0\n
      * enableFeedthroughMatrix = false\n
      * resetInEachState = false\n
@@ -187,23 +220,18 @@ public:
      * @details Frees the memory allocated by the GAM if necessary
      * @post
      * stateMatrixPointer = NULL_PTR(float64 **)\n
-     * intermediateState1Pointer = NULL_PTR(float64 **)\n
-     * intermediateState2Pointer = NULL_PTR(float64 **)\n
      * inputMatrixPointer = NULL_PTR(float64 **)\n
      * outputMatrixPointer = NULL_PTR(float64 **)\n
      * feedthroughMatrixPointer = NULL_PTR(float64 **)\n
      * inputVectorPointer = NULL_PTR(float64 **)\n
      * outputVectorPointer = NULL_PTR(float64 **)\n
-     * intermediateOutput1Pointer = NULL_PTR(float64 **)\n
-     * intermediateOutput2Pointer = NULL_PTR(float64 **)\n
      * stateVectorPointer = NULL_PTR(float64 **)\n
-     * derivativeStateVectorPointer = NULL_PTR(float64 **)\n
      */
     virtual ~SSMGAM();
 
     /**
      * @brief Initialise the parameters from a configuration file.
-     * @details Initialise the SS matrices, the resetInEachState and cross-check consistencies.
+     * @details Initialise the SS matrices, the resetInEachState, the MatrixFormat and cross-check consistencies.
      * @param[in] data is the configuration file previously defined.
      * @return true if the initialisation succeeds.
      */
@@ -211,8 +239,9 @@ public:
 
     /**
      * @brief Initialise the inputs and the output of the GAM.
-     * @details Allocate memory for the inputs and outputs, get the input and output pointers
-     * and initialise the class Matrix for use their operations.
+     * @details Allocate memory for the inputs and outputs, get the input and output pointers,
+     * copy the matrices in contiguous row-major arrays, detect the non-zero coefficients and the blocks of the state matrix and
+     * select the update function for the MatrixFormat and the size of the state vector.
      * @return true if the dimension matrices are consistent.
      */
     virtual bool Setup();
@@ -228,7 +257,11 @@ public:
      * y[k] = Cx[k]+Du[k]
      * \f$\n
      *
-     * @return true if the operation can be performed.
+     * Both equations are computed in one pass, reading the coefficients and the vectors directly (no intermediate matrices).
+     * For state vectors of 2 to 16 elements the loops over the states have a fixed size and can be fully unrolled by the compiler.
+     * With the Sparse and BlockDiagonal formats only the non-zero coefficients, or the coefficients of the blocks, of A are used.
+     *
+     * @return true if Setup() succeeded.
      */
     virtual bool Execute();
 
@@ -250,36 +283,60 @@ public:
     virtual bool PrepareNextState(const char8 * const currentStateName,
                                   const char8 * const nextStateName);
 
+    /**
+     * @brief Gets the MatrixFormat.
+     * @return the configured MatrixFormat or, after Setup(), the format used by Execute() (never SSMGAMMatrixFormatAuto).
+     */
+    SSMGAMMatrixFormat GetMatrixFormat() const;
+
 private:
     /**
-     * state matrix pointer. In standard naming convention, it corresponds to A matrix.
+     * @brief Computes y[k] = Cx[k]+Du[k] and x[k+1] = Ax[k]+Bu[k].
+     * @details numberOfStates is the size of the state vector known at compile time (0 if it is only known at run-time).
      */
-    float64 **stateMatrixPointer;
+    template<uint32 numberOfStates>
+    void Update();
+
+    /**
+     * @brief Gathers u[k], publishes x[k] and computes y[k] = Cx[k]+Du[k].
+     * @details numberOfStates is the size of the state vector known at compile time (0 if it is only known at run-time).
+     */
+    template<uint32 numberOfStates>
+    void UpdateOutput();
 
     /**
-     * State matrix initialised using stateMatrixPointer.
+     * @brief Computes y[k] = Cx[k]+Du[k] and x[k+1] = Ax[k]+Bu[k] with the non-zero coefficients of [A B].
      */
-    Matrix<float64> stateMatrix;
+    void UpdateSparse();
 
     /**
-     * Holds an intermediate result.
+     * @brief Computes y[k] = Cx[k]+Du[k] and x[k+1] = Ax[k]+Bu[k] for each diagonal block of A.
      */
-    float64 **intermediateState1Pointer;
+    void UpdateBlockDiagonal();
 
     /**
-     * Holds an intermediate result. It is initialised with the intermediateState1Pointer
+     * @brief Detects the non-zero coefficients and the blocks of the state matrix, resolves the Auto MatrixFormat and
+     * selects the update function.
      */
-    Matrix<float64> intermediateState1;
+    void SelectMatrixFormat();
 
     /**
-     * Holds an intermediate result.
+     * @brief Pointer to the Update() specialisation for the size of the state vector.
      */
-    float64 **intermediateState2Pointer;
+    typedef void (SSMGAM::*UpdateFunction)();
 
     /**
-     * Holds an intermediate result. It is initialised with the intermediateState2Pointer
+     * @brief Copies the matrix in a contiguous row-major array.
+     * @return the allocated array.
      */
-    Matrix<float64> intermediateState2;
+    static float64 *CopyCoefficients(float64 ** const matrixPointer,
+                                     const uint32 numberOfRows,
+                                     const uint32 numberOfColumns);
+
+    /**
+     * state matrix pointer. In standard naming convention, it corresponds to A matrix.
+     */
+    float64 **stateMatrixPointer;
 
     /**
      * number of rows of the state matrix.
@@ -306,11 +363,6 @@ private:
      */
     float64 **inputMatrixPointer;
 
-    /**
-     * Input matrix. It is initialised with inputMatrixPointer
-     */
-    Matrix<float64> inputMatrix;
-
     /**
      * number of rows of the input matrix.
      */
@@ -326,11 +378,6 @@ private:
      */
     float64 **outputMatrixPointer;
 
-    /**
-     * Output matrix. It is initialised with outputMatrixPointer
-     */
-    Matrix<float64> outputMatrix;
-
     /**
      * Number of rows of the output matrix
      */
@@ -346,11 +393,6 @@ private:
      */
     float64 **feedthroughMatrixPointer;
 
-    /**
-     * Feedthrough matrix. It is initialised with feedthroughMatrixPointer
-     */
-    Matrix<float64> feedthroughMatrix;
-
     /**
      * Number of rows of the feedthrough matrix
      */
@@ -412,59 +454,89 @@ private:
     float64 **inputVectorPointer;
 
     /**
-     * Input vector. It is initialised with inputVectorPointer
+     * Output of the system (usually this vector is represented by a Y).
      */
-    Matrix<float64> inputVector;
+    float64 **outputVectorPointer;
 
     /**
-     * Output of the system (usually this vector is represented by a Y).
+     * State vector pointer(usually it is represented by a X). This vector is an output of the GAM.
      */
-    float64 **outputVectorPointer;
+    float64 **stateVectorPointer;
 
     /**
-     * Output vector. It is initialised with outputVectorPointer
+     * State matrix coefficients (row-major).
      */
-    Matrix<float64> outputVector;
+    float64 *stateCoefficients;
 
     /**
-     * Holds an intermediate value.
+     * Input matrix coefficients (row-major).
      */
-    float64 **intermediateOutput1Pointer;
+    float64 *inputCoefficients;
 
     /**
-     * Holds an intermediate value. It is initialised with intermediateOutput1Pointer
+     * Output matrix coefficients (row-major).
      */
-    Matrix<float64> intermediateOutput1;
+    float64 *outputCoefficients;
 
     /**
-     * Holds an intermediate value.
+     * Feedthrough matrix coefficients (row-major). NULL if the feedthrough matrix is not defined.
      */
-    float64 **intermediateOutput2Pointer;
+    float64 *feedthroughCoefficients;
 
     /**
-     * Holds an intermediate value. It is initialised with intermediateOutput2Pointer
+     * Contiguous copy of the state vector x[k] followed by the input signals u[k].
      */
-    Matrix<float64> intermediateOutput2;
+    float64 *stateInputVector;
 
     /**
-     * State vector pointer(usually it is represented by a X). This vector is an output of the GAM.
+     * Contiguous copy of the input signals (points inside stateInputVector).
      */
-    float64 **stateVectorPointer;
+    float64 *inputVector;
+
+    /**
+     * Contiguous copy of the state vector x[k] (points inside stateInputVector).
+     */
+    float64 *stateVector;
+
+    /**
+     * Index in sparseColumns and sparseValues of the first non-zero coefficient of each row of [A B] (sizeStateVector + 1 elements).
+     */
+    uint32 *sparseRowStart;
+
+    /**
+     * Index in stateInputVector of each non-zero coefficient of [A B].
+     */
+    uint32 *sparseColumns;
+
+    /**
+     * Non-zero coefficients of [A B].
+     */
+    float64 *sparseValues;
+
+    /**
+     * Index of the first state of each diagonal block of A (numberOfBlocks + 1 elements).
+     */
+    uint32 *blockStart;
+
+    /**
+     * Number of diagonal blocks of A.
+     */
+    uint32 numberOfBlocks;
 
     /**
-     * State vector. It is initialised with stateVectorPointer
+     * The MatrixFormat.
      */
-    Matrix<float64> stateVector;
+    SSMGAMMatrixFormat matrixFormat;
 
     /**
-     * It is the derivative of the state vector. This vector is also an ouput of the GAM.
+     * It is the next state vector x[k+1], which is copied to the state vector in the next Execute().
      */
-    float64 **derivativeStateVectorPointer;
+    float64 *derivativeStateVector;
 
     /**
-     * It is the derivative of the state vector. It is initialised with stateVectorPointer
+     * The Update() specialisation selected in Setup().
      */
-    Matrix<float64> derivativeStateVector;
+    UpdateFunction updateFunction;
 
     /**
      * sample frequency in which the matrix parameters are given. It will be used for verification
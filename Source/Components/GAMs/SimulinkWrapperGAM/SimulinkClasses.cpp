@@ -107,6 +107,11 @@ void SimulinkDataI::PrintData(const uint64 maxNameLength /* = 0u */, StreamStrin
 
 bool SimulinkParameter::Actualise(const AnyType& sourceParameter) {
     
+    return Actualise(sourceParameter, address);
+}
+
+bool SimulinkParameter::Actualise(const AnyType& sourceParameter, void* const destination) {
+    
     bool ok;
     
     // Type coherence check
@@ -246,23 +251,23 @@ bool SimulinkParameter::Actualise(const AnyType& sourceParameter) {
         if (numberOfDimensions <= 1u) {
             
             // Scalars and vectors have no orientation and can be copied as they are.
-            ok = MemoryOperationsHelper::Copy(address, sourceParameter.GetDataPointer(), sourceParameter.GetDataSize());
+            ok = MemoryOperationsHelper::Copy(destination, sourceParameter.GetDataPointer(), sourceParameter.GetDataSize());
             
         }
         else if (numberOfDimensions == 2u) {
             
             // For 2D matrices we handle the case in which model has column-major parameters.
             if (orientation == rtwCAPI_MATRIX_ROW_MAJOR) {
-                ok = MemoryOperationsHelper::Copy(address, sourceParameter.GetDataPointer(), sourceParameter.GetDataSize());
+                ok = MemoryOperationsHelper::Copy(destination, sourceParameter.GetDataPointer(), sourceParameter.GetDataSize());
             }
             else {
-                ok = TransposeAndCopy(address, sourceParameter.GetDataPointer());
+                ok = TransposeAndCopy(destination, sourceParameter.GetDataPointer());
             }
         }
         else {
             
             // Also 3D matrices are memcopied, since handling all possible combinations of cases is not feasible
-            ok = MemoryOperationsHelper::Copy(address, sourceParameter.GetDataPointer(), sourceParameter.GetDataSize());
+            ok = MemoryOperationsHelper::Copy(destination, sourceParameter.GetDataPointer(), sourceParameter.GetDataSize());
             REPORT_ERROR_STATIC(ErrorManagement::Warning, "3D matrix used. The GAM does not check data orientation of 3D matrices, carefully check results.");
         }
         
@@ -330,13 +335,20 @@ bool SimulinkDataI::TransposeAndCopyT(void *const destination, const void *const
     uint32 numberOfRows    = numberOfElements[0u];
     uint32 numberOfColumns = numberOfElements[1u];
     
+    // The destination is written sequentially, the source is read with a stride of one column
+    T*       destinationElement = (T*) destination;
+    const T* sourceRow          = (const T*) source;
+    
     for (uint32 rowIdx = 0u; rowIdx < numberOfRows; rowIdx++) {
         
+        const T* sourceElement = sourceRow;
         for (uint32 colIdx = 0u; colIdx < numberOfColumns; colIdx++) {
             
-            *( (T*) destination + colIdx + numberOfColumns*rowIdx ) = *( (T*) source + rowIdx + numberOfRows*colIdx );
-            
+            *destinationElement = *sourceElement;
+            destinationElement++;
+            sourceElement += numberOfRows;
         }
+        sourceRow++;
     }
     
     return true;
@@ -540,5 +552,156 @@ bool SimulinkOutputPort::CopyData(const SimulinkNonVirtualBusMode copyMode) {
     return ok;
 }
 
+/*---------------------------------------------------------------------------*/
+/*                            SimulinkNameIndex                              */
+/*---------------------------------------------------------------------------*/
+
+SimulinkNameIndex::SimulinkNameIndex() {
+    
+    names    = NULL_PTR(StreamString*);
+    values   = NULL_PTR(uint32*);
+    hashes   = NULL_PTR(uint32*);
+    used     = NULL_PTR(bool*);
+    capacity = 0u;
+    size     = 0u;
+}
+
+SimulinkNameIndex::~SimulinkNameIndex() {
+    
+    Reset();
+}
+
+void SimulinkNameIndex::Reset() {
+    
+    if (names != NULL) {
+        delete[] names;
+        names = NULL_PTR(StreamString*);
+    }
+    if (values != NULL) {
+        delete[] values;
+        values = NULL_PTR(uint32*);
+    }
+    if (hashes != NULL) {
+        delete[] hashes;
+        hashes = NULL_PTR(uint32*);
+    }
+    if (used != NULL) {
+        delete[] used;
+        used = NULL_PTR(bool*);
+    }
+    capacity = 0u;
+    size     = 0u;
+}
+
+uint32 SimulinkNameIndex::Hash(const char8 * const name) {
+    
+    uint32 hash = 2166136261u;
+    for (uint32 charIdx = 0u; name[charIdx] != '\0'; charIdx++) {
+        hash ^= static_cast<uint32>(static_cast<uint8>(name[charIdx]));
+        hash *= 16777619u;
+    }
+    
+    return hash;
+}
+
+uint32 SimulinkNameIndex::Probe(const char8 * const name, const uint32 hash) const {
+    
+    uint32 mask = capacity - 1u;
+    uint32 slot = hash & mask;
+    bool   done = false;
+    
+    while (!done) {
+        if (!used[slot]) {
+            done = true;
+        }
+        else if ( (hashes[slot] == hash) && (names[slot] == name) ) {
+            done = true;
+        }
+        else {
+            slot = (slot + 1u) & mask;
+        }
+    }
+    
+    return slot;
+}
+
+void SimulinkNameIndex::Grow() {
+    
+    uint32        oldCapacity = capacity;
+    StreamString *oldNames    = names;
+    uint32       *oldValues   = values;
+    uint32       *oldHashes   = hashes;
+    bool         *oldUsed     = used;
+    
+    capacity = (oldCapacity == 0u) ? 64u : (oldCapacity * 2u);
+    names    = new StreamString[capacity];
+    values   = new uint32[capacity];
+    hashes   = new uint32[capacity];
+    used     = new bool[capacity];
+    for (uint32 slot = 0u; slot < capacity; slot++) {
+        used[slot] = false;
+    }
+    
+    for (uint32 oldSlot = 0u; oldSlot < oldCapacity; oldSlot++) {
+        if (oldUsed[oldSlot]) {
+            uint32 slot = Probe(oldNames[oldSlot].Buffer(), oldHashes[oldSlot]);
+            names[slot]  = oldNames[oldSlot];
+            values[slot] = oldValues[oldSlot];
+            hashes[slot] = oldHashes[oldSlot];
+            used[slot]   = true;
+        }
+    }
+    
+    if (oldNames != NULL) {
+        delete[] oldNames;
+        delete[] oldValues;
+        delete[] oldHashes;
+        delete[] oldUsed;
+    }
+}
+
+bool SimulinkNameIndex::Set(const char8 * const name, const uint32 value) {
+    
+    bool ok = (name != NULL);
+    
+    if (ok) {
+        // At most half full, so that the probe sequences stay short
+        if ( (2u * (size + 1u)) > capacity ) {
+            Grow();
+        }
+        
+        uint32 hash = Hash(name);
+        uint32 slot = Probe(name, hash);
+        if (!used[slot]) {
+            names[slot]  = name;
+            hashes[slot] = hash;
+            used[slot]   = true;
+            size++;
+        }
+        values[slot] = value;
+    }
+    
+    return ok;
+}
+
+bool SimulinkNameIndex::Find(const char8 * const name, uint32 &value) const {
+    
+    bool found = (name != NULL) && (size > 0u);
+    
+    if (found) {
+        uint32 slot = Probe(name, Hash(name));
+        found = used[slot];
+        if (found) {
+            value = values[slot];
+        }
+    }
+    
+    return found;
+}
+
+uint32 SimulinkNameIndex::GetSize() const {
+    
+    return size;
+}
 
 } /* namespace MARTe */
@@ -193,6 +193,19 @@ public:
      * 
      */
     bool Actualise(const AnyType& sourceParameter);
+    
+    /**
+     * @brief   Same as Actualise(const AnyType&) but writes the parameter
+     *          value at the given destination instead of the model memory.
+     * @details Used to stage a new parameter value in a buffer with the same
+     *          layout of the parameter in the model memory.
+     * @return  `true` if parameter is correctly actualized, `false` otherwise.
+     * @param[in] sourceParameter a reference to the AnyType pointing to the
+     *                            parameter value.
+     * @param[in] destination     the memory where the parameter value is written
+     *                            (at least #byteSize bytes).
+     */
+    bool Actualise(const AnyType& sourceParameter, void* const destination);
 
 };
 
@@ -377,6 +390,84 @@ public:
 };
 
 
+/*---------------------------------------------------------------------------*/
+/*                            SimulinkNameIndex                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief   Hash index from the names of Simulink(R) objects (or of their
+ *          sources) to their index in a list.
+ * @details Used by the GAM to match the model parameters and ports with the
+ *          configuration in constant time, instead of comparing all the names
+ *          (models with tens of thousands of parameters). Open addressing
+ *          (linear probing) on a power of two table, which is doubled when it
+ *          is half full. The names are copied.
+ */
+class SimulinkNameIndex {
+public:
+    
+    /**
+     * @brief Default constructor. The index is empty.
+     */
+    SimulinkNameIndex();
+    
+    /**
+     * @brief Destructor. Frees the table.
+     */
+    ~SimulinkNameIndex();
+    
+    /**
+     * @brief     Adds a name to the index (or updates its value if the name
+     *            is already in the index, i.e. the last value wins).
+     * @param[in] name  the name.
+     * @param[in] value the value associated to the name.
+     * @returns   `true` if the name was added.
+     */
+    bool Set(const char8 * const name, const uint32 value);
+    
+    /**
+     * @brief      Finds a name in the index.
+     * @param[in]  name  the name.
+     * @param[out] value the value associated to the name (if found).
+     * @returns    `true` if the name is in the index.
+     */
+    bool Find(const char8 * const name, uint32 &value) const;
+    
+    /**
+     * @brief   Gets the number of names in the index.
+     * @returns the number of names.
+     */
+    uint32 GetSize() const;
+    
+    /**
+     * @brief   Removes all the names.
+     */
+    void Reset();
+    
+private:
+    
+    /**
+     * @brief   Computes the (FNV-1a) hash of a name.
+     */
+    static uint32 Hash(const char8 * const name);
+    
+    /**
+     * @brief   Returns the slot of \a name, or the empty slot where it shall be added.
+     */
+    uint32 Probe(const char8 * const name, const uint32 hash) const;
+    
+    /**
+     * @brief   Doubles the table and rehashes the names.
+     */
+    void Grow();
+    
+    StreamString *names;     //!< Names in each slot.
+    uint32       *values;    //!< Values in each slot.
+    uint32       *hashes;    //!< Hashes in each slot.
+    bool         *used;      //!< Whether each slot is used.
+    uint32       capacity;   //!< Number of slots (power of two).
+    uint32       size;       //!< Number of used slots.
+};
 
 } /* namespace MARTe */
 
@@ -32,7 +32,11 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "CLASSMETHODREGISTER.h"
+#include "HighResolutionTimer.h"
 #include "LoadableLibrary.h"
+#include "MemoryOperationsHelper.h"
 #include "StructuredDataI.h"
 #include "SimulinkWrapperGAM.h"
 #include "TypeDescriptor.h"
@@ -41,6 +45,16 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+/**
+ * @brief Returns the time elapsed since \a phaseStart (in ms) and moves \a phaseStart to now.
+ */
+static MARTe::float64 GetPhaseTime(MARTe::uint64 &phaseStart) {
+    MARTe::uint64 now = MARTe::HighResolutionTimer::Counter();
+    MARTe::float64 elapsed = static_cast<MARTe::float64>(now - phaseStart) * MARTe::HighResolutionTimer::Period() * 1e3;
+    phaseStart = now;
+    return elapsed;
+}
+
 /*lint -e{788} lint is confused with the enum types*/
 static MARTe::StreamString GetOrientationName(const rtwCAPI_Orientation  &ELEorientation)
 {
@@ -240,7 +254,9 @@ static inline StreamString GetMARTeTypeNameFromEnumeratedTypes(const uint8 slEnu
 
 SimulinkWrapperGAM::SimulinkWrapperGAM()
         : GAM()
-        , MessageI() {
+        , MessageI()
+        , EmbeddedServiceMethodBinderI()
+        , executor(*this) {
 
     libraryHandle = NULL_PTR(LoadableLibrary*);
     
@@ -251,6 +267,7 @@ SimulinkWrapperGAM::SimulinkWrapperGAM()
     
     getMmiFunction = static_cast<void*(*)(void*)>(NULL);
     getAlgoInfoFunction  = static_cast<void(*)(void*)>(NULL);
+    setRootIOFunction    = static_cast<void(*)(void*, void*, void*)>(NULL);
     
     modelParams = NULL_PTR(rtwCAPI_ModelParameters*);
     rootInputs  = NULL_PTR(rtwCAPI_Signals*);
@@ -281,11 +298,59 @@ SimulinkWrapperGAM::SimulinkWrapperGAM()
 
     nonVirtualBusMode             = ByteArrayBusMode;
     enforceModelSignalCoverage    = false;
+    zeroCopyRootIO                = false;
+    numberOfInstances             = 1u;
+    instanceStates                = NULL_PTR(void**);
+    cfgParameters                 = NULL_PTR(ReferenceT<AnyObject>*);
+    externalParameters            = NULL_PTR(ReferenceT<AnyObject>*);
+    inputsBound                   = false;
+    outputsBound                  = false;
+    
+    stagedParameters       = NULL_PTR(uint8*);
+    stagedParameterOffsets = NULL_PTR(uint32*);
+    numberOfParameterRuns  = 0u;
+    parameterRunAddresses  = NULL_PTR(void**);
+    parameterRunOffsets    = NULL_PTR(uint32*);
+    parameterRunSizes      = NULL_PTR(uint32*);
+    stagedParametersReady  = 0;
+    stagingLock            = 0;
+    
+    numberOfSubRates    = 0u;
+    for (uint32 rateIdx = 0u; rateIdx < maxNumberOfSubRates; rateIdx++) {
+        subRateStepFunctions[rateIdx] = static_cast<void(*)(void*)>(NULL);
+        subRateDividers[rateIdx]      = 1u;
+        subRateCounters[rateIdx]      = 0u;
+    }
+    subRatesThread      = false;
+    subRatesCPUMask     = 0u;
+    subRatesStackSize   = THREADS_DEFAULT_STACKSIZE;
+    subRatesBusy        = 0;
+    subRatesPendingMask = 0u;
+    subRatesOverruns    = 0u;
+    if (!subRatesEvent.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to create the sub-rates EventSem");
+    }
+    
+    filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
+    if (!ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
+    }
 }
 
 /*lint -e{1551} memory must be freed and functions called in the destructor are expected not to throw exceptions */
 SimulinkWrapperGAM::~SimulinkWrapperGAM() {
 
+    if (subRatesThread) {
+        if (executor.Stop() != ErrorManagement::NoError) {
+            if (executor.Stop() != ErrorManagement::NoError) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+            }
+        }
+    }
+    (void) subRatesEvent.Close();
+
     if (libraryHandle != NULL) {
         libraryHandle->Close();
         delete libraryHandle;
@@ -299,6 +364,7 @@ SimulinkWrapperGAM::~SimulinkWrapperGAM() {
     
     getMmiFunction       = static_cast<void*(*)(void*)>(NULL);
     getAlgoInfoFunction  = static_cast<void(*)(void*)>(NULL);
+    setRootIOFunction    = static_cast<void(*)(void*, void*, void*)>(NULL);
     
     modelParams = NULL_PTR(rtwCAPI_ModelParameters*);
     rootInputs  = NULL_PTR(rtwCAPI_Signals*);
@@ -317,6 +383,39 @@ SimulinkWrapperGAM::~SimulinkWrapperGAM() {
     
     currentPort = NULL_PTR(SimulinkPort*);
     
+    if (instanceStates != NULL) {
+        delete[] instanceStates;
+        instanceStates = NULL_PTR(void**);
+    }
+    if (cfgParameters != NULL) {
+        delete[] cfgParameters;
+        cfgParameters = NULL_PTR(ReferenceT<AnyObject>*);
+    }
+    if (externalParameters != NULL) {
+        delete[] externalParameters;
+        externalParameters = NULL_PTR(ReferenceT<AnyObject>*);
+    }
+    if (stagedParameters != NULL) {
+        delete[] stagedParameters;
+        stagedParameters = NULL_PTR(uint8*);
+    }
+    if (stagedParameterOffsets != NULL) {
+        delete[] stagedParameterOffsets;
+        stagedParameterOffsets = NULL_PTR(uint32*);
+    }
+    if (parameterRunAddresses != NULL) {
+        delete[] parameterRunAddresses;
+        parameterRunAddresses = NULL_PTR(void**);
+    }
+    if (parameterRunOffsets != NULL) {
+        delete[] parameterRunOffsets;
+        parameterRunOffsets = NULL_PTR(uint32*);
+    }
+    if (parameterRunSizes != NULL) {
+        delete[] parameterRunSizes;
+        parameterRunSizes = NULL_PTR(uint32*);
+    }
+    
     // Deallocate all SimulinkClasses objects
     uint32 parameterSize = modelParameters.GetSize();
     for (uint32 paramIdx = 0U; paramIdx < parameterSize; paramIdx++) {
@@ -441,6 +540,46 @@ bool SimulinkWrapperGAM::Initialise(StructuredDataI &data) {
                      enforceModelSignalCoverage?"must":"has not to");
     }
 
+    //Check if the model root I/O shall be bound to the GAM signal memory
+    if(status) {
+        uint32 tempZeroCopy = 0u;
+        if(data.Read("ZeroCopyRootIO", tempZeroCopy)) {
+            zeroCopyRootIO = (tempZeroCopy > 0u);
+        }
+        else {
+            zeroCopyRootIO = false;
+        }
+
+        REPORT_ERROR(ErrorManagement::Information, "ZeroCopyRootIO set to %d.", zeroCopyRootIO?1:0);
+    }
+
+    //Number of instances of the model stepped by the GAM
+    if(status) {
+        if(!data.Read("NumberOfInstances", numberOfInstances)) {
+            numberOfInstances = 1u;
+        }
+        status = (numberOfInstances > 0u);
+        if (!status) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "NumberOfInstances shall be > 0.");
+        }
+        if (status && (numberOfInstances > 1u)) {
+            status = !zeroCopyRootIO;
+            if (!status) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "ZeroCopyRootIO is not supported with NumberOfInstances > 1.");
+            }
+        }
+        if (status) {
+            status = pool.Initialise(data);
+        }
+        if (status) {
+            instanceStates = new void*[numberOfInstances];
+            for (uint32 instanceIdx = 0u; instanceIdx < numberOfInstances; instanceIdx++) {
+                instanceStates[instanceIdx] = NULL_PTR(void*);
+            }
+            REPORT_ERROR(ErrorManagement::Information, "NumberOfInstances set to %u (%u worker threads).", numberOfInstances, pool.GetNumberOfWorkers());
+        }
+    }
+
     /// 2. Opening of model code shared object library.
     
     if (status) {
@@ -520,6 +659,34 @@ bool SimulinkWrapperGAM::Initialise(StructuredDataI &data) {
 
         if (status) { // Find symbol
             stepFunction = reinterpret_cast<void(*)(void*)>(libraryHandle->Function(&symbol[0u]));
+        }
+        
+        // Multi-rate models generated for multitasking expose one step function per rate
+        // (_step0 for the base rate, _step1, _step2, ... for the sub-rates)
+        if (status && (static_cast<void(*)(void*)>(NULL) == stepFunction)) {
+            StreamString stepSymbol;
+            status = stepSymbol.Printf("%s_step0", symbolPrefix.Buffer());
+            if (status) {
+                stepFunction = reinterpret_cast<void(*)(void*)>(libraryHandle->Function(stepSymbol.Buffer()));
+            }
+            bool found = (static_cast<void(*)(void*)>(NULL) != stepFunction);
+            while (status && found && (numberOfSubRates < maxNumberOfSubRates)) {
+                stepSymbol = "";
+                status = stepSymbol.Printf("%s_step%u", symbolPrefix.Buffer(), (numberOfSubRates + 1u));
+                if (status) {
+                    subRateStepFunctions[numberOfSubRates] = reinterpret_cast<void(*)(void*)>(libraryHandle->Function(stepSymbol.Buffer()));
+                    found = (static_cast<void(*)(void*)>(NULL) != subRateStepFunctions[numberOfSubRates]);
+                }
+                if (found) {
+                    numberOfSubRates++;
+                }
+            }
+            if (numberOfSubRates > 0u) {
+                REPORT_ERROR(ErrorManagement::Information, "Multi-rate model with %u sub-rates.", numberOfSubRates);
+            }
+        }
+        
+        if (status) {
             status = (static_cast<void(*)(void*)>(NULL) != stepFunction);
             if (!status) {
                 REPORT_ERROR(ErrorManagement::Warning, "Couldn't find %s symbol in model library (%s == NULL).", symbol, symbol);
@@ -542,6 +709,63 @@ bool SimulinkWrapperGAM::Initialise(StructuredDataI &data) {
                 status = true;
             }
         }
+
+        // setRootIOFunction
+        if (status && zeroCopyRootIO) { // Compose symbol
+            status = StringHelper::CopyN(&symbol[0u], symbolPrefix.Buffer(), 64u);
+            if (status) {
+                status = StringHelper::ConcatenateN(&symbol[0u], "_SetRootIO", 64u);
+            }
+
+            if (status) { // Find symbol
+                setRootIOFunction = reinterpret_cast<void(*)(void*, void*, void*)>(libraryHandle->Function(&symbol[0u]));
+                status = (static_cast<void(*)(void*, void*, void*)>(NULL) != setRootIOFunction);
+                if (!status) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Couldn't find %s symbol in model library, required by ZeroCopyRootIO.", symbol);
+                }
+            }
+        }
+    }
+    
+    /// 3.1 Sub-rate configuration for multi-rate models.
+    
+    if (status && (numberOfSubRates > 0u) && (numberOfInstances > 1u)) {
+        status = false;
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Multi-rate models are not supported with NumberOfInstances > 1.");
+    }
+    
+    if (status && (numberOfSubRates > 0u)) {
+        AnyType dividersType = data.GetType("SubRateDividers");
+        status = (!dividersType.GetTypeDescriptor().isStructuredData) && (dividersType.GetDataPointer() != NULL);
+        if (status) {
+            status = (dividersType.GetNumberOfElements(0u) == numberOfSubRates);
+        }
+        if (status) {
+            Vector<uint32> dividersVector(&subRateDividers[0u], numberOfSubRates);
+            status = data.Read("SubRateDividers", dividersVector);
+        }
+        for (uint32 rateIdx = 0u; (rateIdx < numberOfSubRates) && status; rateIdx++) {
+            status = (subRateDividers[rateIdx] > 0u);
+        }
+        if (!status) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "SubRateDividers must have %u values greater than 0 (one for each sub-rate step function).", numberOfSubRates);
+        }
+        
+        if (status) {
+            uint32 tempSubRatesThread = 0u;
+            if (data.Read("SubRatesThread", tempSubRatesThread)) {
+                subRatesThread = (tempSubRatesThread > 0u);
+            }
+            if (subRatesThread) {
+                if (!data.Read("SubRatesCPUMask", subRatesCPUMask)) {
+                    REPORT_ERROR(ErrorManagement::Information, "No SubRatesCPUMask defined. Using default 0x0u.");
+                }
+                if (!data.Read("SubRatesStackSize", subRatesStackSize)) {
+                    REPORT_ERROR(ErrorManagement::Information, "No SubRatesStackSize defined. Using default thread stack size.");
+                }
+            }
+            REPORT_ERROR(ErrorManagement::Information, "Sub-rate step functions run in %s.", subRatesThread ? "a separate thread" : "the GAM thread");
+        }
     }
     
     /// 4. Build a reference container containing parameter values
@@ -561,9 +785,12 @@ bool SimulinkWrapperGAM::Initialise(StructuredDataI &data) {
             status = ObjectRegistryDatabase::Instance()->Insert(cfgParameterContainer);
         }
         
-        StreamString absolutePath;
+        uint32 numberOfCfgParameters = data.GetNumberOfChildren();
+        if (status && (numberOfCfgParameters > 0u)) {
+            cfgParameters = new ReferenceT<AnyObject>[numberOfCfgParameters];
+        }
         
-        for (uint32 paramIdx = 0u; (paramIdx < data.GetNumberOfChildren()) && status; paramIdx++) {
+        for (uint32 paramIdx = 0u; (paramIdx < numberOfCfgParameters) && status; paramIdx++) {
             
             // AnyType does not manage its own memory, so a reference to AnyObject is required.
             ReferenceT<AnyObject> cfgParameterReference("AnyObject", GlobalObjectsDatabase::Instance()->GetStandardHeap());
@@ -576,13 +803,10 @@ bool SimulinkWrapperGAM::Initialise(StructuredDataI &data) {
             if (status) {
                 status = cfgParameterContainer->Insert(cfgParameterReference);
                 
-                absolutePath  = cfgParameterContainer->GetName();
-                absolutePath += ".";
-                absolutePath += cfgParameterReference->GetName();
-                
-                // Now write the name-path pair in a database.
+                // Now index the parameter by name.
                 if (status) {
-                    status = cfgParameterDatabase.Write(cfgParameterReference->GetName(), absolutePath);
+                    cfgParameters[paramIdx] = cfgParameterReference;
+                    status = cfgParameterIndex.Set(cfgParameterReference->GetName(), paramIdx);
                 }
             }
         }
@@ -601,6 +825,8 @@ bool SimulinkWrapperGAM::Initialise(StructuredDataI &data) {
 
 bool SimulinkWrapperGAM::Setup() {
     
+    uint64 setupStart = HighResolutionTimer::Counter();
+    
     bool ok = SetupSimulink();
     
     // Call init method
@@ -649,7 +875,58 @@ bool SimulinkWrapperGAM::Setup() {
 
     // Simulink initFunction call, init of the Simulink model
     if (ok) {
+        uint64 initStart = HighResolutionTimer::Counter();
         (*initFunction)(states);
+        for (uint32 instanceIdx = 1u; instanceIdx < numberOfInstances; instanceIdx++) {
+            (*initFunction)(instanceStates[instanceIdx]);
+        }
+        REPORT_ERROR(ErrorManagement::Information, "Setup timing: model initialisation %.3f ms.", GetPhaseTime(initStart));
+    }
+    
+    // Rebind the model root I/O to the GAM signal memory
+    if (ok && zeroCopyRootIO) {
+        void* inputsAddress  = GetRootIOBinding(InputSignals);
+        void* outputsAddress = GetRootIOBinding(OutputSignals);
+        
+        if (inputsAddress == NULL) {
+            REPORT_ERROR(ErrorManagement::Warning, "Model inputs layout does not match the GAM input signals, inputs will be copied.");
+        }
+        if (outputsAddress == NULL) {
+            REPORT_ERROR(ErrorManagement::Warning, "Model outputs layout does not match the GAM output signals, outputs will be copied.");
+        }
+        
+        // The initial values of the outputs are in the current model structure
+        for (uint32 portIdx = modelNumOfInputs; (portIdx < (modelNumOfInputs + modelNumOfOutputs)) && ok && (outputsAddress != NULL); portIdx++) {
+            ok = modelPorts[portIdx]->CopyData(nonVirtualBusMode);
+        }
+        
+        if (ok && ((inputsAddress != NULL) || (outputsAddress != NULL))) {
+            (*setRootIOFunction)(states, inputsAddress, outputsAddress);
+            inputsBound  = (inputsAddress != NULL);
+            outputsBound = (outputsAddress != NULL);
+            REPORT_ERROR(ErrorManagement::Information, "Model root I/O bound to the GAM signals (inputs: %d, outputs: %d)", inputsBound?1:0, outputsBound?1:0);
+        }
+    }
+    
+    // Staging copy of the parameters for StageParameters()
+    if (ok) {
+        ok = AllocateStagedParameters();
+    }
+    
+    // Thread for the sub-rate step functions
+    if (ok && subRatesThread) {
+        executor.SetName(GetName());
+        executor.SetCPUMask(subRatesCPUMask);
+        executor.SetStackSize(subRatesStackSize);
+        ok = (executor.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Failed to start the sub-rates thread.");
+        }
+    }
+    
+    // Threads for the instances
+    if (ok && (numberOfInstances > 1u)) {
+        ok = pool.Start(*this, GetName());
     }
     
     // Send simulink ready message
@@ -663,6 +940,10 @@ bool SimulinkWrapperGAM::Setup() {
         }
     }
     
+    if (ok) {
+        REPORT_ERROR(ErrorManagement::Information, "Setup timing: total %.3f ms.", GetPhaseTime(setupStart));
+    }
+    
     return ok;
 }
 
@@ -671,6 +952,13 @@ bool SimulinkWrapperGAM::SetupSimulink() {
     
     bool status;
     
+    // Duration of each phase, for the startup timing breakdown
+    uint64  phaseStart         = HighResolutionTimer::Counter();
+    float64 scanParametersTime = 0.0;
+    float64 scanPortsTime      = 0.0;
+    float64 mapPortsTime       = 0.0;
+    float64 actualiseTime      = 0.0;
+    
     REPORT_ERROR(ErrorManagement::Information, "Allocating Simulink model dynamic memory...");
 
     // Simulink instFunction call, dynamic allocation of model data structures
@@ -716,20 +1004,20 @@ bool SimulinkWrapperGAM::SetupSimulink() {
             // Check number of declared main ports
 
             if (status) {
-                status = (numberOfGAMInputSignals == modelNumOfInputs);
+                status = (numberOfGAMInputSignals == (modelNumOfInputs * numberOfInstances));
                 if (!status) {
                     REPORT_ERROR(ErrorManagement::ParametersError,
-                        "Number of input signals mismatch (GAM: %u, model %u)",
-                        numberOfGAMInputSignals,  modelNumOfInputs);
+                        "Number of input signals mismatch (GAM: %u, model %u, instances %u)",
+                        numberOfGAMInputSignals,  modelNumOfInputs, numberOfInstances);
                 }
             }
 
             if (status) {
-                status = (numberOfGAMOutputSignals == modelNumOfOutputs);
+                status = (numberOfGAMOutputSignals == (modelNumOfOutputs * numberOfInstances));
                 if (!status) {
                     REPORT_ERROR(ErrorManagement::ParametersError,
-                        "Number of output signals mismatch (GAM: %u, model %u)",
-                        numberOfGAMOutputSignals,  modelNumOfOutputs);
+                        "Number of output signals mismatch (GAM: %u, model %u, instances %u)",
+                        numberOfGAMOutputSignals,  modelNumOfOutputs, numberOfInstances);
                 }
             }
         }
@@ -784,6 +1072,8 @@ bool SimulinkWrapperGAM::SetupSimulink() {
         }
     }
     
+    scanParametersTime = GetPhaseTime(phaseStart);
+    
     ///-------------------------------------------------------------------------
     /// 2. Populate modelPorts/modelSignals and print information
     ///-------------------------------------------------------------------------
@@ -808,6 +1098,11 @@ bool SimulinkWrapperGAM::SetupSimulink() {
         }
     }
     
+    // Parameters and ports of the other instances follow those of the first one
+    if (status && (numberOfInstances > 1u)) {
+        status = SetupInstances();
+    }
+    
     if (status) {
         maxNameLength = 0u;
         for (uint32 portIdx = 0u; portIdx < modelPorts.GetSize(); portIdx++) {
@@ -827,6 +1122,8 @@ bool SimulinkWrapperGAM::SetupSimulink() {
         }
     }
     
+    scanPortsTime = GetPhaseTime(phaseStart);
+    
     ///-------------------------------------------------------------------------
     /// 3. Check general coherence between GAM and model
     ///-------------------------------------------------------------------------
@@ -856,25 +1153,43 @@ bool SimulinkWrapperGAM::SetupSimulink() {
     ///    and set copy address
     ///-------------------------------------------------------------------------
     
-    if (status) {
-        status = MapPorts(InputSignals);
+    uint32 mappedSignals = 0u;
+    for (uint32 instanceIdx = 0u; (instanceIdx < numberOfInstances) && status; instanceIdx++) {
+        status = MapPorts(InputSignals, instanceIdx, mappedSignals);
         if (!status) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Failed MapPorts() for input signals.");
         }
     }
     
+    if (status) {
+        status = (mappedSignals == GetNumberOfInputSignals());
+        if (!status) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "GAM input signals not belonging to any instance (the names shall start with Instance<k>_).");
+        }
+    }
+    
     ///-------------------------------------------------------------------------
     /// 5. Check output port/signal coherence between GAM and model
     ///    and set copy address
     ///-------------------------------------------------------------------------
     
-    if (status) {
-        status = MapPorts(OutputSignals);
+    mappedSignals = 0u;
+    for (uint32 instanceIdx = 0u; (instanceIdx < numberOfInstances) && status; instanceIdx++) {
+        status = MapPorts(OutputSignals, instanceIdx, mappedSignals);
         if (!status) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Failed MapPorts() for output signals.");
         }
     }
     
+    if (status) {
+        status = (mappedSignals == GetNumberOfOutputSignals());
+        if (!status) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "GAM output signals not belonging to any instance (the names shall start with Instance<k>_).");
+        }
+    }
+    
+    mapPortsTime = GetPhaseTime(phaseStart);
+    
     ///-------------------------------------------------------------------------
     /// 6. Verify that the external parameter source (if any)
     ///    is compatible with the GAM
@@ -893,8 +1208,18 @@ bool SimulinkWrapperGAM::SetupSimulink() {
             }
             else {
                     
+                uint32 numberOfObjects = mdsPar->Size();
+                if (externalParameters != NULL) {
+                    delete[] externalParameters;
+                    externalParameters = NULL_PTR(ReferenceT<AnyObject>*);
+                }
+                externalParameterIndex.Reset();
+                if (numberOfObjects > 0u) {
+                    externalParameters = new ReferenceT<AnyObject>[numberOfObjects];
+                }
+                
                 // Loop over all references in the MDSObjLoader container
-                for (uint32 objectIdx = 0u; (objectIdx < mdsPar->Size()) && status; objectIdx++) {
+                for (uint32 objectIdx = 0u; (objectIdx < numberOfObjects) && status; objectIdx++) {
                     
                     ReferenceT<AnyObject> paramObject = mdsPar->Get(objectIdx);
                     bool isAnyObject = paramObject.IsValid();
@@ -902,17 +1227,12 @@ bool SimulinkWrapperGAM::SetupSimulink() {
                     // Ignore references that do not point to AnyObject
                     if (isAnyObject) {
                         
-                        // Compose absolute path:
-                        StreamString parameterAbsolutePath = "";
-                        parameterAbsolutePath += mdsPar->GetName();
-                        parameterAbsolutePath += ".";
-                        parameterAbsolutePath += paramObject->GetName();
-                        
-                        // the string is used to make a name-path cdb
-                        status = externalParameterDatabase.Write(paramObject->GetName(), parameterAbsolutePath.Buffer());
+                        // the parameter is indexed by name
+                        externalParameters[objectIdx] = paramObject;
+                        status = externalParameterIndex.Set(paramObject->GetName(), objectIdx);
                         if (!status) {
                             REPORT_ERROR(ErrorManagement::InitialisationError,
-                                "Failed Write() on database.");
+                                "Failed to index parameter %u of %s.", objectIdx, tunableParamExternalSource.Buffer());
                         }
                     }
                     
@@ -945,52 +1265,21 @@ bool SimulinkWrapperGAM::SetupSimulink() {
         isUnlinked   = false;
         
         // Retrieve the ReferenceT<AnyType> of the source parameter from which to actualise
-        StreamString parameterPathInObjDatabase;
+        // (if not found and skipInvalidTunableParams, then use compile-time value)
+        ReferenceT<AnyObject> sourceParameterPtr;
         const char8* currentParamName = (modelParameters[paramIdx]->fullName).Buffer();
         
-        // 1. Parameters from configuration file (highest priority).
-        if (cfgParameterDatabase.Read(currentParamName, parameterPathInObjDatabase)) {
-            
-            parameterSourceName = "configuration file";
-            isLoaded = true;
-        }
-        
-        // 2. Parameters from loader class (2nd-highest priority)
-        else if (externalParameterDatabase.Read(currentParamName, parameterPathInObjDatabase)) {
-            
-            parameterSourceName = "loader class";
-            isLoaded = true;
-        }
-        
-        // 3. Parameter not found (if skipInvalidTunableParams, then use compile-time value)
-        else {
-            isLoaded = false;
-        }
+        isLoaded = FindParameterSource(currentParamName, sourceParameterPtr, parameterSourceName);
         
         // Data is copied from the source parameter to the model
         if (isLoaded) {
+            sourceParameter = sourceParameterPtr->GetType();
             
-            ReferenceT<AnyObject> sourceParameterPtr;
-            sourceParameterPtr = ObjectRegistryDatabase::Instance()->Find(parameterPathInObjDatabase.Buffer());
-            
-            isLoaded = sourceParameterPtr.IsValid();
-            if (!isLoaded) {
-                REPORT_ERROR(ErrorManagement::CommunicationError,
-                    "Parameter %s: invalid reference from %s.",
-                    currentParamName,
-                    parameterSourceName
-                );
+            if (sourceParameter.IsStaticDeclared()) {
+                isActualised = modelParameters[paramIdx]->Actualise(sourceParameter);
             }
-            
-            if (isLoaded) {
-                sourceParameter = sourceParameterPtr->GetType();
-                
-                if (sourceParameter.IsStaticDeclared()) {
-                    isActualised = modelParameters[paramIdx]->Actualise(sourceParameter);
-                }
-                else {
-                    isUnlinked = true;
-                }
+            else {
+                isUnlinked = true;
             }
         }
         
@@ -1040,6 +1329,12 @@ bool SimulinkWrapperGAM::SetupSimulink() {
         
     }
     
+    actualiseTime = GetPhaseTime(phaseStart);
+    
+    REPORT_ERROR(ErrorManagement::Information,
+        "Setup timing: allocation and parameter scan %.3f ms, port scan %.3f ms, port mapping %.3f ms, parameter actualisation %.3f ms (%u parameters, %u ports).",
+        scanParametersTime, scanPortsTime, mapPortsTime, actualiseTime, modelParameters.GetSize(), modelPorts.GetSize());
+    
     ///-------------------------------------------------------------------------
     /// 8. Print port/signal details
     ///-------------------------------------------------------------------------
@@ -1086,19 +1381,66 @@ bool SimulinkWrapperGAM::Execute() {
 
     bool status = (states != NULL);
 
-    // Inputs update
-    for (portIdx = 0u; (portIdx < modelNumOfInputs) && status; portIdx++) {
-        status = modelPorts[portIdx]->CopyData(nonVirtualBusMode);
+    // Switch to the parameter set published by StageParameters() (not while a sub-rate step is running)
+    if ((stagedParametersReady != 0) && (subRatesBusy == 0)) {
+        for (uint32 runIdx = 0u; (runIdx < numberOfParameterRuns) && status; runIdx++) {
+            status = MemoryOperationsHelper::Copy(parameterRunAddresses[runIdx], &stagedParameters[parameterRunOffsets[runIdx]], parameterRunSizes[runIdx]);
+        }
+        Atomic::Decrement(&stagedParametersReady);
     }
-    
-    // Model step
-    if ( (stepFunction != NULL) && status) {
-        (*stepFunction)(states);
+
+    // The instances are stepped in parallel, each one with its own copies
+    if (numberOfInstances > 1u) {
+        if (status) {
+            status = pool.Run();
+        }
     }
+    else {
+        // Inputs update
+        for (portIdx = 0u; (portIdx < modelNumOfInputs) && status && (!inputsBound); portIdx++) {
+            status = modelPorts[portIdx]->CopyData(nonVirtualBusMode);
+        }
+    
+        // Model step
+        if ( (stepFunction != NULL) && status) {
+        
+            // Sub-rates due in this cycle (the count starts with all the rates due at the first cycle)
+            uint32 dueSubRates = 0u;
+            for (uint32 rateIdx = 0u; rateIdx < numberOfSubRates; rateIdx++) {
+                if (subRateCounters[rateIdx] == 0u) {
+                    dueSubRates |= (1u << rateIdx);
+                    subRateCounters[rateIdx] = subRateDividers[rateIdx] - 1u;
+                }
+                else {
+                    subRateCounters[rateIdx]--;
+                }
+            }
+        
+            (*stepFunction)(states);
+        
+            if (dueSubRates != 0u) {
+                if (!subRatesThread) {
+                    ExecuteSubRates(dueSubRates);
+                }
+                else if (subRatesBusy == 0) {
+                    subRatesPendingMask = dueSubRates;
+                    Atomic::Increment(&subRatesBusy);
+                    status = subRatesEvent.Post();
+                }
+                else {
+                    // The previous sub-rate steps are still running, these are skipped
+                    if (subRatesOverruns == 0u) {
+                        REPORT_ERROR(ErrorManagement::Warning, "Sub-rate steps overrun, skipping them.");
+                    }
+                    subRatesOverruns++;
+                }
+            }
+        }
 
-    // Ouputs update
-    for (portIdx = modelNumOfInputs; ( portIdx < (modelNumOfInputs + modelNumOfOutputs) ) && status; portIdx++) {
-        status = modelPorts[portIdx]->CopyData(nonVirtualBusMode);
+        // Ouputs update
+        for (portIdx = modelNumOfInputs; ( portIdx < (modelNumOfInputs + modelNumOfOutputs) ) && status && (!outputsBound); portIdx++) {
+            status = modelPorts[portIdx]->CopyData(nonVirtualBusMode);
+        }
     }
     
     return status;
@@ -2142,7 +2484,112 @@ void SimulinkWrapperGAM::PrintAlgoInfo() const {
     }
 }
 
-bool SimulinkWrapperGAM::MapPorts(const SignalDirection direction) {
+bool SimulinkWrapperGAM::FindParameterSource(const char8 * const parameterName, ReferenceT<AnyObject> &source, StreamString &sourceName) const {
+    
+    uint32 sourceIdx = 0u;
+    
+    // 1. Parameters from configuration file (highest priority).
+    bool found = cfgParameterIndex.Find(parameterName, sourceIdx);
+    if (found) {
+        source     = cfgParameters[sourceIdx];
+        sourceName = "configuration file";
+    }
+    
+    // 2. Parameters from loader class (2nd-highest priority)
+    if (!found) {
+        found = externalParameterIndex.Find(parameterName, sourceIdx);
+        if (found) {
+            source     = externalParameters[sourceIdx];
+            sourceName = "loader class";
+        }
+    }
+    
+    if (found) {
+        found = source.IsValid();
+    }
+    
+    return found;
+}
+
+/*lint -e{613} NULL pointers are checked beforehand.*/
+bool SimulinkWrapperGAM::SetupInstances() {
+    
+    bool status = (instanceStates != NULL);
+    
+    uint32 portsPerInstance      = modelPorts.GetSize();
+    uint32 parametersPerInstance = modelParameters.GetSize();
+    bool   sharedParameters      = false;
+    
+    if (status) {
+        instanceStates[0u] = states;
+    }
+    
+    for (uint32 instanceIdx = 1u; (instanceIdx < numberOfInstances) && status; instanceIdx++) {
+        
+        instanceStates[instanceIdx] = (*instFunction)();
+        status = (instanceStates[instanceIdx] != NULL);
+        if (!status) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Simulink model allocation function returned a NULL data pointer for instance %u", instanceIdx);
+        }
+        
+        rtwCAPI_ModelMappingInfo* mmi = NULL_PTR(rtwCAPI_ModelMappingInfo*);
+        if (status) {
+            void *mmiTemp = ((*getMmiFunction)(instanceStates[instanceIdx]));
+            mmi = reinterpret_cast<rtwCAPI_ModelMappingInfo*>(mmiTemp);
+            status = (mmi != NULL);
+            if (!status) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "GetMmiPtr function returned a NULL data pointer for instance %u", instanceIdx);
+            }
+        }
+        
+        if (status) {
+            status = ScanTunableParameters(mmi);
+            if (!status) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Failed ScanTunableParameters() for instance %u.", instanceIdx);
+            }
+        }
+        
+        // Parameters in the global memory of the library have the same address in all the instances
+        if (status && (parametersPerInstance > 0u)) {
+            uint32 firstParamIdx = modelParameters.GetSize() - parametersPerInstance;
+            sharedParameters = (modelParameters[firstParamIdx]->address == modelParameters[0u]->address);
+            while (sharedParameters && status && (modelParameters.GetSize() > parametersPerInstance)) {
+                SimulinkParameter* toDelete;
+                status = modelParameters.Extract(modelParameters.GetSize() - 1u, toDelete);
+                if (status) {
+                    delete toDelete;
+                }
+            }
+        }
+        
+        if (status) {
+            status = ScanRootIO(mmi, InputSignals);
+        }
+        if (status) {
+            status = ScanRootIO(mmi, OutputSignals);
+        }
+        if (!status) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Failed ScanRootIO() for instance %u.", instanceIdx);
+        }
+        
+        if (status && (portsPerInstance > 0u)) {
+            status = (modelPorts[instanceIdx * portsPerInstance]->address != modelPorts[0u]->address);
+            if (!status) {
+                REPORT_ERROR(ErrorManagement::InitialisationError,
+                    "The model root I/O is shared by the instances (the model shall be generated with CodeInterfacePackaging = Reusable function).");
+            }
+        }
+    }
+    
+    if (status) {
+        REPORT_ERROR(ErrorManagement::Information, "%u instances of the model allocated, tunable parameters %s.",
+                     numberOfInstances, sharedParameters ? "shared" : "per instance");
+    }
+    
+    return status;
+}
+
+bool SimulinkWrapperGAM::MapPorts(const SignalDirection direction, const uint32 instanceIdx, uint32 &mappedSignals) {
     
     bool ok    = false;
     bool found = false;
@@ -2179,6 +2626,62 @@ bool SimulinkWrapperGAM::MapPorts(const SignalDirection direction) {
         ok = false;
     }
     
+    // The ports of the instance follow those of the previous instances
+    startIdx += instanceIdx * (modelNumOfInputs + modelNumOfOutputs);
+    endIdx   += instanceIdx * (modelNumOfInputs + modelNumOfOutputs);
+    
+    StreamString instancePrefix = "";
+    if (ok && (numberOfInstances > 1u)) {
+        ok = instancePrefix.Printf("Instance%u_", instanceIdx);
+    }
+    
+    // Index of the names of the ports (or of their carried signals in StructuredBusMode),
+    // so that each GAM signal is found without comparing it with all the model names
+    SimulinkNameIndex portNameIndex;
+    uint32  numberOfEntries = 0u;
+    uint32* entryPorts      = NULL_PTR(uint32*);
+    uint32* entrySignals    = NULL_PTR(uint32*);
+    
+    for (portIdx = startIdx; (portIdx < endIdx) && ok; portIdx++) {
+        if (modelPorts[portIdx]->isStructured && (nonVirtualBusMode == StructuredBusMode)) {
+            numberOfEntries += modelPorts[portIdx]->carriedSignals.GetSize();
+        }
+        else {
+            numberOfEntries++;
+        }
+    }
+    
+    if (ok && (numberOfEntries > 0u)) {
+        entryPorts   = new uint32[numberOfEntries];
+        entrySignals = new uint32[numberOfEntries];
+        
+        uint32 entryIdx = 0u;
+        uint32 existingEntryIdx = 0u;
+        for (portIdx = startIdx; (portIdx < endIdx) && ok; portIdx++) {
+            if (modelPorts[portIdx]->isStructured && (nonVirtualBusMode == StructuredBusMode)) {
+                for (signalInPortIdx = 0u; (signalInPortIdx < modelPorts[portIdx]->carriedSignals.GetSize()) && ok; signalInPortIdx++) {
+                    entryPorts[entryIdx]   = portIdx;
+                    entrySignals[entryIdx] = signalInPortIdx;
+                    // The first port carrying a name wins, as in a sequential search
+                    const char8* entryName = (modelPorts[portIdx]->carriedSignals[signalInPortIdx]->fullName).Buffer();
+                    if (!portNameIndex.Find(entryName, existingEntryIdx)) {
+                        ok = portNameIndex.Set(entryName, entryIdx);
+                    }
+                    entryIdx++;
+                }
+            }
+            else {
+                entryPorts[entryIdx]   = portIdx;
+                entrySignals[entryIdx] = 0u;
+                const char8* entryName = (modelPorts[portIdx]->fullName).Buffer();
+                if (!portNameIndex.Find(entryName, existingEntryIdx)) {
+                    ok = portNameIndex.Set(entryName, entryIdx);
+                }
+                entryIdx++;
+            }
+        }
+    }
+    
     // Check and map input/output ports
     for(uint32 signalIdxLoop = 0u; (signalIdxLoop < numberOfSignals) && ok ; signalIdxLoop++) {
     uint32 signalIdx = signalIdxLoop;
@@ -2187,45 +2690,36 @@ bool SimulinkWrapperGAM::MapPorts(const SignalDirection direction) {
         
         GAMSignalName = "";
         ok = GetSignalName(direction, signalIdx, GAMSignalName);
-
-        //Signal mapping, either 1:1 or port (byte array) based
-        portIdx = startIdx;
-        while((!found) && (portIdx < endIdx)) {
-            uint32 portCarriedSignalsCount = modelPorts[portIdx]->carriedSignals.GetSize();
-
-            if(modelPorts[portIdx]->isStructured && (nonVirtualBusMode == StructuredBusMode)) {
-
-                signalInPortIdx = 0u;
-                while((!found) && (signalInPortIdx < portCarriedSignalsCount)) {
-                    if (GAMSignalName == (modelPorts[portIdx]->carriedSignals[signalInPortIdx]->fullName)) {
-
-                       found = true;
-                    }
-                    else {
-                        signalInPortIdx++;
-                    }
-                }
+        
+        // With multiple instances only the signals of this instance are mapped (without the prefix)
+        bool inInstance = true;
+        if (ok && (instancePrefix.Size() > 0u)) {
+            inInstance = (StringHelper::CompareN(GAMSignalName.Buffer(), instancePrefix.Buffer(), static_cast<uint32>(instancePrefix.Size())) == 0);
+            if (inInstance) {
+                StreamString modelSignalName = &(GAMSignalName.Buffer()[instancePrefix.Size()]);
+                GAMSignalName = modelSignalName;
             }
-            else {
-                if (GAMSignalName == (modelPorts[portIdx]->fullName)) {
+        }
 
-                    found = true;
-                }
-            }
-            if(!found) {
-                portIdx++;
-            }
+        //Signal mapping, either 1:1 or port (byte array) based
+        uint32 entryIdx = 0u;
+        if (ok && inInstance) {
+            found = portNameIndex.Find(GAMSignalName.Buffer(), entryIdx);
+        }
+        if (found) {
+            portIdx         = entryPorts[entryIdx];
+            signalInPortIdx = entrySignals[entryIdx];
         }
         
 
-        if (!found) {
+        if (inInstance && (!found)) {
             REPORT_ERROR(ErrorManagement::ParametersError,
                 "GAM %s signal %s not found in Simulink model",
                 directionName.Buffer(), GAMSignalName.Buffer());
             ok = false;
         }
         
-        if (ok) {
+        if (ok && inInstance) {
             
             // Array signal or structured signal in StructuredBusMode. In this case we check datatype, number of dimensions and number of elements.
             if(modelPorts[portIdx]->hasHomogeneousType || (nonVirtualBusMode == StructuredBusMode)) {
@@ -2338,7 +2832,8 @@ bool SimulinkWrapperGAM::MapPorts(const SignalDirection direction) {
         }
         
         // Ok, here we can map memory inputs
-        if (ok) {
+        if (ok && inInstance) {
+            mappedSignals++;
 
             if(modelPorts[portIdx]->isStructured && (nonVirtualBusMode == StructuredBusMode)) {
 
@@ -2370,11 +2865,257 @@ bool SimulinkWrapperGAM::MapPorts(const SignalDirection direction) {
             }
         }
     }
+    
+    if (entryPorts != NULL) {
+        delete[] entryPorts;
+    }
+    if (entrySignals != NULL) {
+        delete[] entrySignals;
+    }
 
     return ok;
 }
 
+/*lint -e{613} NULL pointers are checked beforehand.*/
+void* SimulinkWrapperGAM::GetRootIOBinding(const SignalDirection direction) {
+    /*lint --e{923, 9091} the model and GAM addresses are compared as integers to check the layout */
+    
+    uint32 startPortIdx = (direction == InputSignals) ? 0u : modelNumOfInputs;
+    uint32 endPortIdx   = (direction == InputSignals) ? modelNumOfInputs : (modelNumOfInputs + modelNumOfOutputs);
+    
+    bool ok = (startPortIdx < endPortIdx);
+    
+    // Every copied item must have the same displacement between the GAM and the model memory,
+    // the root I/O structure starts at the lowest model address (its first port)
+    uint64 displacement = 0u;
+    uint64 modelBaseAddress = 0u;
+    bool  first = true;
+    
+    for (uint32 portIdx = startPortIdx; (portIdx < endPortIdx) && ok; portIdx++) {
+        
+        SimulinkPort* port = modelPorts[portIdx];
+        ok = (!port->requiresTransposition);
+        
+        if(ok && port->isStructured && (nonVirtualBusMode == StructuredBusMode)) {
+            // Padding between the carried signals is not backed by GAM signals
+            ok = port->isContiguous;
+            for(uint32 carriedSignalIdx = 0u; (carriedSignalIdx < port->carriedSignals.GetSize()) && ok; carriedSignalIdx++) {
+                SimulinkSignal* signal = port->carriedSignals[carriedSignalIdx];
+                ok = (signal->MARTeAddress != NULL);
+                if (ok) {
+                    uint64 modelAddress = reinterpret_cast<uint64>(signal->address);
+                    uint64 itemDisplacement = reinterpret_cast<uint64>(signal->MARTeAddress) - modelAddress;
+                    ok = first || (itemDisplacement == displacement);
+                    if (first || (modelAddress < modelBaseAddress)) {
+                        modelBaseAddress = modelAddress;
+                    }
+                    displacement = itemDisplacement;
+                    first = false;
+                }
+            }
+        }
+        else if (ok) {
+            ok = (port->MARTeAddress != NULL);
+            if (ok) {
+                uint64 modelAddress = reinterpret_cast<uint64>(port->address);
+                uint64 itemDisplacement = reinterpret_cast<uint64>(port->MARTeAddress) - modelAddress;
+                ok = first || (itemDisplacement == displacement);
+                if (first || (modelAddress < modelBaseAddress)) {
+                    modelBaseAddress = modelAddress;
+                }
+                displacement = itemDisplacement;
+                first = false;
+            }
+        }
+        else {
+            // Port requires transposition
+        }
+    }
+    
+    uint64 bindingAddress = modelBaseAddress + displacement;
+    if (ok) {
+        ok = ((bindingAddress % 8u) == 0u);
+    }
+    
+    return ok ? reinterpret_cast<void*>(bindingAddress) : NULL_PTR(void*);
+}
+
+bool SimulinkWrapperGAM::AllocateStagedParameters() {
+    /*lint --e{923, 9091} the model addresses are compared as integers to find contiguous parameters */
+    
+    bool ok = true;
+    uint32 numberOfParameters = modelParameters.GetSize();
+    
+    if (numberOfParameters > 0u) {
+        uint32 totalSize = 0u;
+        uint64 runEnd = 0u;
+        
+        stagedParameterOffsets = new uint32[numberOfParameters];
+        parameterRunAddresses  = new void*[numberOfParameters];
+        parameterRunOffsets    = new uint32[numberOfParameters];
+        parameterRunSizes      = new uint32[numberOfParameters];
+        numberOfParameterRuns  = 0u;
+        
+        for (uint32 paramIdx = 0u; paramIdx < numberOfParameters; paramIdx++) {
+            SimulinkParameter* parameter = modelParameters[paramIdx];
+            uint64 paramStart = reinterpret_cast<uint64>(parameter->address);
+            stagedParameterOffsets[paramIdx] = totalSize;
+            
+            if ((numberOfParameterRuns > 0u) && (paramStart == runEnd)) {
+                parameterRunSizes[numberOfParameterRuns - 1u] += parameter->byteSize;
+            }
+            else {
+                parameterRunAddresses[numberOfParameterRuns] = parameter->address;
+                parameterRunOffsets[numberOfParameterRuns]   = totalSize;
+                parameterRunSizes[numberOfParameterRuns]     = parameter->byteSize;
+                numberOfParameterRuns++;
+            }
+            runEnd = paramStart + parameter->byteSize;
+            totalSize += parameter->byteSize;
+        }
+        
+        stagedParameters = new uint8[totalSize];
+        
+        for (uint32 runIdx = 0u; (runIdx < numberOfParameterRuns) && ok; runIdx++) {
+            ok = MemoryOperationsHelper::Copy(&stagedParameters[parameterRunOffsets[runIdx]], parameterRunAddresses[runIdx], parameterRunSizes[runIdx]);
+        }
+        
+        if (verbosityLevel > 1u) {
+            REPORT_ERROR(ErrorManagement::Information, "Staging buffer of %u bytes for %u parameters (%u contiguous runs).",
+                         totalSize, numberOfParameters, numberOfParameterRuns);
+        }
+    }
+    
+    return ok;
+}
+
+ErrorManagement::ErrorType SimulinkWrapperGAM::StageParameters() {
+    
+    bool ok = (stagedParameters != NULL);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::IllegalOperation, "No tunable parameters to be staged.");
+    }
+    
+    bool locked = false;
+    if (ok) {
+        locked = Atomic::TestAndSet(&stagingLock);
+        ok = locked;
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "Another parameter set is being staged.");
+        }
+    }
+    
+    // The staging buffer belongs to the real-time thread until the published set is applied
+    if (ok) {
+        ok = (stagedParametersReady == 0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "The previous parameter set has not been applied yet.");
+        }
+    }
+    bool staging = ok;
+    
+    for (uint32 paramIdx = 0u; (paramIdx < modelParameters.GetSize()) && ok; paramIdx++) {
+        
+        ReferenceT<AnyObject> sourceParameterPtr;
+        StreamString parameterSourceName;
+        const char8* currentParamName = (modelParameters[paramIdx]->fullName).Buffer();
+        
+        // Parameters without a source keep their current value
+        if (FindParameterSource(currentParamName, sourceParameterPtr, parameterSourceName)) {
+            AnyType sourceParameter = sourceParameterPtr->GetType();
+            if (sourceParameter.IsStaticDeclared()) {
+                ok = modelParameters[paramIdx]->Actualise(sourceParameter, &stagedParameters[stagedParameterOffsets[paramIdx]]);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Parameter %s cannot be actualized, parameter set discarded.", currentParamName);
+                }
+            }
+        }
+    }
+    
+    if (staging) {
+        if (ok) {
+            Atomic::Increment(&stagedParametersReady);
+            REPORT_ERROR(ErrorManagement::Information, "New parameter set staged, it will be used from the next step.");
+        }
+        else {
+            // The model parameters are only read by the model and written by Execute() when a set is published
+            for (uint32 runIdx = 0u; runIdx < numberOfParameterRuns; runIdx++) {
+                (void) MemoryOperationsHelper::Copy(&stagedParameters[parameterRunOffsets[runIdx]], parameterRunAddresses[runIdx], parameterRunSizes[runIdx]);
+            }
+        }
+    }
+    
+    if (locked) {
+        stagingLock = 0;
+    }
+    
+    ErrorManagement::ErrorType err(ok);
+    return err;
+}
+
+void SimulinkWrapperGAM::ExecuteSubRates(const uint32 dueSubRates) {
+    
+    for (uint32 rateIdx = 0u; rateIdx < numberOfSubRates; rateIdx++) {
+        if ((dueSubRates & (1u << rateIdx)) != 0u) {
+            (*subRateStepFunctions[rateIdx])(states);
+        }
+    }
+}
+
+ErrorManagement::ErrorType SimulinkWrapperGAM::Execute(ExecutionInfo& info) {
+    
+    ErrorManagement::ErrorType err = ErrorManagement::NoError;
+    
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        // Timeout to allow the thread to be stopped
+        if (subRatesEvent.Wait(TimeoutType(100u)) == ErrorManagement::NoError) {
+            // The RT thread posts again only after subRatesBusy is cleared
+            err.fatalError = !subRatesEvent.Reset();
+            if (subRatesBusy != 0) {
+                ExecuteSubRates(subRatesPendingMask);
+                Atomic::Decrement(&subRatesBusy);
+            }
+        }
+    }
+    
+    return err;
+}
+
+uint32 SimulinkWrapperGAM::GetSubRatesOverruns() const {
+    return subRatesOverruns;
+}
+
+bool SimulinkWrapperGAM::ExecuteTask(const uint32 executor) {
+    
+    bool status = true;
+    uint32 portsPerInstance  = modelNumOfInputs + modelNumOfOutputs;
+    uint32 numberOfExecutors = pool.GetNumberOfWorkers() + 1u;
+    
+    for (uint32 instanceIdx = executor; (instanceIdx < numberOfInstances) && status; instanceIdx += numberOfExecutors) {
+        uint32 firstPortIdx = instanceIdx * portsPerInstance;
+        
+        for (uint32 portIdx = firstPortIdx; (portIdx < (firstPortIdx + modelNumOfInputs)) && status; portIdx++) {
+            status = modelPorts[portIdx]->CopyData(nonVirtualBusMode);
+        }
+        
+        if (status) {
+            (*stepFunction)(instanceStates[instanceIdx]);
+        }
+        
+        for (uint32 portIdx = firstPortIdx + modelNumOfInputs; (portIdx < (firstPortIdx + portsPerInstance)) && status; portIdx++) {
+            status = modelPorts[portIdx]->CopyData(nonVirtualBusMode);
+        }
+    }
+    
+    return status;
+}
+
+uint32 SimulinkWrapperGAM::GetNumberOfInstances() const {
+    return numberOfInstances;
+}
+
 CLASS_REGISTER(SimulinkWrapperGAM, "1.0")
+CLASS_METHOD_REGISTER(SimulinkWrapperGAM, StageParameters)
 
 } /* namespace MARTe */
 
@@ -34,12 +34,18 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "AnyObject.h"
 #include "ConfigurationDatabase.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "ForkJoinPool.h"
 #include "GAM.h"
 #include "LoadableLibrary.h"
 #include "MessageI.h"
 #include "ReferenceT.h"
+#include "RegisteredMethodsMessageFilter.h"
 #include "SimulinkClasses.h"
+#include "SingleThreadService.h"
 #include "StreamString.h"
 
 /*---------------------------------------------------------------------------*/
@@ -113,6 +119,14 @@ namespace MARTe {
  *     EnforceModelSignalCoverage  = ( 0 | 1 )                      // Optional. Default: 1
  *     TunableParamExternalSource  = "ExternalSourceName"           // Optional.
  *     NonVirtualBusMode           = ( "ByteArray" | "Structured" ) // Optional. Default: "ByteArray"
+ *     ZeroCopyRootIO              = ( 0 | 1 )                      // Optional. Default: 0
+ *     SubRateDividers             = { 10 100 }                     // Compulsory for multi-rate models only.
+ *     SubRatesThread              = ( 0 | 1 )                      // Optional. Default: 0
+ *     SubRatesCPUMask             = 0x2                            // Optional. Only with SubRatesThread = 1
+ *     SubRatesStackSize           = 1048576                        // Optional. Only with SubRatesThread = 1
+ *     NumberOfInstances           = 4                              // Optional. Default: 1
+ *     NumberOfWorkers             = 3                              // Optional. Only with NumberOfInstances > 1. See ForkJoinPool
+ *     ThreadPlacement             = { CPUs = 0xE }                 // Optional. Only with NumberOfInstances > 1. See ForkJoinPool
  * 
  *     InputSignals  = {                                // As appropriate based on the Simulink(r) generated structure
  *         InSignal1 = {
@@ -194,6 +208,17 @@ namespace MARTe {
  *      can be omitted in the configuration file and their value will not be stored.
  *      Valid only when `NonVirtualBusMode == "Structured"`.
  *      Default value: `1`.
+ *    - *ZeroCopyRootIO*: when set to 1 the root inputs and/or outputs of the
+ *      model are rebound to the GAM signal memory, so that Execute() does
+ *      not copy them. See [Zero-copy root I/O](#zero-copy-root-io) section
+ *      for details. Default value: `0`.
+ *    - *SubRateDividers*, *SubRatesThread*, *SubRatesCPUMask* and
+ *      *SubRatesStackSize*: configuration of the sub-rates of multi-rate
+ *      models. See [Multi-rate models](#multi-rate-models) section for details.
+ *    - *NumberOfInstances*, *NumberOfWorkers* and *ThreadPlacement*: number
+ *      of instances of the model stepped by the GAM and worker threads
+ *      stepping them. See [Multiple instances](#multiple-instances) section
+ *      for details.
  *    - *Parameters*: local list of parameters. See
  *      [Model parameters](#model-parameters) section for details.
  * 
@@ -259,6 +284,20 @@ namespace MARTe {
  * source, so if an appropriate new value for a parameter is present
  * in both of them, the one in the `Parameters` node will be used. 
  * 
+ * ### Update parameters while the model is running ###
+ * 
+ * The GAM registers the `StageParameters` RPC (see MessageI), which repeats
+ * the actualisation of all the tunable parameters, from the same sources,
+ * while the model is running. The new values are written in a staging copy
+ * of the parameters (the actualisation is done in the thread of the caller)
+ * and published once all of them have been actualised. At the beginning of
+ * the next Execute() the real-time thread copies the staged parameters
+ * to the model, so that a model step always uses either the previous
+ * or the new parameter set, never a mix of them. The real-time thread never
+ * waits for the caller: if a new set is staged while the previous one
+ * has not yet been applied, the call fails and the caller can retry.
+ * If any parameter cannot be actualised, none of them is updated.
+ * 
  * ### Actualise a parameter using the GAM configuration ###
  * 
  * Suppose the model has a tunable parameter `tunVector` which is
@@ -723,6 +762,91 @@ namespace MARTe {
  * Once set for a model, the configuration settings can then be exported
  * from the Model Explorer and imported to other models.
  * 
+ * Multi-rate models
+ * ----------------------------------------------------------------------------
+ * 
+ * Models with more than one sample time generated for multitasking
+ * (`set_param(model_name, 'EnableMultiTasking', 'on')`) expose one step
+ * function per rate, `<modelname>_step0()` for the base rate and
+ * `<modelname>_step1()`, `<modelname>_step2()` ... for the slower rates
+ * (up to 15 sub-rates). The GAM uses them when `<modelname>_step()` is not
+ * found. `_step0()` is called by every Execute(), while `_stepN()` is
+ * called once every `SubRateDividers[N - 1]` cycles, starting from the
+ * first cycle, i.e. `SubRateDividers` holds the ratios between each sample
+ * time and the base sample time (which shall be the GAM cycle time).
+ * 
+ * By default the sub-rate steps are called by Execute() right after
+ * `_step0()`. With `SubRatesThread = 1` they are called by a separate
+ * thread (with affinity `SubRatesCPUMask` and stack size `SubRatesStackSize`),
+ * woken up by Execute() after `_step0()`, so that they do not increase the
+ * execution time of the GAM. If the sub-rate steps of the previous
+ * activation have not finished yet, the due sub-rate steps are skipped
+ * (see GetSubRatesOverruns()). In this mode the model shall be generated
+ * with the rate transitions configured for data integrity and
+ * the root inputs and outputs shall belong to the base rate, as the
+ * sub-rate steps run concurrently with the copies done by Execute().
+ * The sub-rate thread has normal priority, so that it is preempted by
+ * the real-time threads running on the same CPUs.
+ * 
+ * Zero-copy root I/O
+ * ----------------------------------------------------------------------------
+ * 
+ * By default Execute() copies each input port from the GAM signal memory to
+ * the model before the step and each output port from the model to the GAM
+ * signal memory after the step. With `ZeroCopyRootIO = 1` the GAM instead
+ * points the root I/O structures of the model (`RootIOFormat` set to
+ * `Part of model data structure`) to the GAM signal memory, 
+ * so that the model step reads and writes the GAM signals directly.
+ * This requires the following custom function in the model code:
+ * 
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *     '#define SET_ROOT_IO_FUNC CONCAT(MODEL     , _SetRootIO  ,    )'        newline, ...
+ *                                                                             newline, ...
+ *     'void SET_ROOT_IO_FUNC(void* voidPtrToRealTimeStructure, void* inputs, void* outputs)' newline, ...
+ *     '{'                                                                     newline, ...
+ *     '   RT_MODEL_STRUCT* rtm = ( RT_MODEL_STRUCT * )(voidPtrToRealTimeStructure);' newline, ...
+ *     '   if (inputs != NULL) { rtmSetU(rtm, inputs); }'                      newline, ...
+ *     '   if (outputs != NULL) { rtmSetY(rtm, outputs); }'                    newline, ...
+ *     '}' ...
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * 
+ * (the `rtmSetU` or `rtmSetY` line shall be removed for models without
+ * root inputs or outputs respectively).
+ * 
+ * The inputs (outputs) are rebound only if, for every input (output) port,
+ * the offset of each copied signal from the first port in the model is the
+ * same as the offset of the corresponding GAM signal, no signal requires
+ * transposition, every signal is mapped to a GAM signal, structured ports
+ * have no padding and the resulting address is aligned to 8 bytes.
+ * If not, the GAM reports a warning and copies the signals of that direction 
+ * as usual. The model initialisation function is called before rebinding,
+ * and the initial values of the outputs are copied once to the GAM signals.
+ * 
+ * Multiple instances                                     {#multiple-instances}
+ * ----------------------------------------------------------------------------
+ * 
+ * With `NumberOfInstances = N` the GAM allocates N instances of the model
+ * (N calls to the allocation function of the library, which is loaded once)
+ * and steps all of them in every Execute(). The model shall be generated
+ * with `CodeInterfacePackaging` set to `Reusable function`, so that each
+ * instance has its own states and root I/O (Setup() fails otherwise).
+ * The GAM signals of the instance k (from 0 to N - 1) are the model signals
+ * prefixed by `Instance<k>_`, e.g. `Instance0_In1` and `Instance1_In1`.
+ * In `ByteArray` mode the GAM shall thus declare N times the model ports.
+ * 
+ * The tunable parameters are actualised (and staged) with the same values
+ * in all the instances. Parameters stored in the global memory of the library
+ * (instead of the instance memory) are shared by all the instances.
+ * 
+ * The instances are stepped in parallel by the real-time thread and by
+ * `NumberOfWorkers` worker threads (instance k by the thread
+ * k % (NumberOfWorkers + 1), the real-time thread being the thread 0),
+ * placed with the `ThreadPlacement` block (see ForkJoinPool). The worker
+ * threads busy-wait for the next Execute() and should thus run on isolated
+ * cores. Each thread copies the inputs, steps the model and copies the
+ * outputs of its instances. Multiple instances are not supported with
+ * multi-rate models nor with `ZeroCopyRootIO = 1`.
+ * 
  * 
  * @todo This class relies on pointer arithmetic for offset calculation.
  *       While it looks safe, it should probably be refactored to
@@ -743,7 +867,7 @@ namespace MARTe {
  *       matrix signals. 
  * 
  */
-class SimulinkWrapperGAM: public GAM, public MessageI {
+class SimulinkWrapperGAM: public GAM, public MessageI, public EmbeddedServiceMethodBinderI, public ForkJoinTaskI {
 
 public:
     CLASS_REGISTER_DECLARATION()
@@ -790,8 +914,10 @@ public:
     virtual bool Setup();
 
     /**
-     * @brief  Copies memory to and from the model
-     *         and calls the model code step function.
+     * @brief  Copies memory to and from the model (unless the root I/O
+     *         is bound to the GAM signals, see ZeroCopyRootIO)
+     *         and calls the model code step function (for each instance,
+     *         in parallel, see NumberOfInstances).
      * @return `true` on succeed.
      * @pre    
      *         1. Initialise() == `true`
@@ -800,6 +926,48 @@ public:
      */
     virtual bool Execute();
 
+    /**
+     * @brief   Actualises all the tunable parameters in the staging buffer
+     *          and publishes them to the real-time thread.
+     * @details Registered as an RPC. The parameters are actualised from the
+     *          same sources used by Setup() and copied to the model at the
+     *          beginning of the next Execute().
+     * @return  ErrorManagement::NoError if all the found parameters were actualised
+     *          and no other parameter set is pending.
+     * @pre
+     *         1. Setup() == `true`
+     */
+    ErrorManagement::ErrorType StageParameters();
+
+    /**
+     * @brief   Callback of the sub-rates thread (SubRatesThread = 1).
+     * @details Waits for Execute() to signal the sub-rates due in the cycle and calls their step functions.
+     * @param[in] info information about the thread stage.
+     * @return  ErrorManagement::NoError if the EventSem could be reset.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo& info);
+
+    /**
+     * @brief  Gets the number of times the sub-rate steps were skipped because
+     *         those of the previous activation were still running (SubRatesThread = 1).
+     * @return the number of sub-rate overruns.
+     */
+    uint32 GetSubRatesOverruns() const;
+
+    /**
+     * @brief  ForkJoinPool callback. Copies the inputs, steps the model and
+     *         copies the outputs of the instances assigned to \a executor.
+     * @param[in] executor 0 for the real-time thread, n for the worker n - 1.
+     * @return `true` if all the copies succeeded.
+     */
+    virtual bool ExecuteTask(const uint32 executor);
+
+    /**
+     * @brief  Gets the number of instances of the model (see NumberOfInstances).
+     * @return the number of instances.
+     */
+    uint32 GetNumberOfInstances() const;
+
 protected:
     
     // those members are protected for testing purpose
@@ -846,6 +1014,8 @@ private:
     StreamString tunableParamExternalSource;        //!< Name of the ReferenceContainer containing References to AnyObjects that hold value for parameter actualisation.
     bool         skipInvalidTunableParams;          //!< If `true`, when a parameter actualisation fails the compile time value is used.
     uint8        verbosityLevel;                    //!< How verbose should the output be. Min: 0, max: 2, default: 0.
+    bool         zeroCopyRootIO;                    //!< If `true`, the model root I/O is rebound to the GAM signal memory when the layouts match.
+    uint32       numberOfInstances;                 //!< Number of instances of the model stepped by the GAM.
     //@}
     
     /**
@@ -864,6 +1034,7 @@ private:
     void  (*termFunction)         (void*);          //!< Pointer to the model function responsible for terminating the model execution (currently unused).
     void* (*getMmiFunction)       (void*);          //!< Pointer to the custom function returning the model mapping info (MMI) structure, which holds model data.
     void  (*getAlgoInfoFunction)  (void*);          //!< Pointer to the custom function returning information about model versioning.
+    void  (*setRootIOFunction)    (void*, void*, void*); //!< Pointer to the custom function setting the model root I/O structures (only with ZeroCopyRootIO).
     //@}
     
     /**
@@ -871,6 +1042,17 @@ private:
      */
     void* states;
     
+    /**
+     * @name    Multiple instances
+     * @brief   Instances of the model (NumberOfInstances > 1).
+     * @details The ports of the instance k are the modelPorts from
+     *          k * (modelNumOfInputs + modelNumOfOutputs).
+     */
+    //@{
+    void**       instanceStates;                    //!< States of each instance (the first one is #states).
+    ForkJoinPool pool;                              //!< Threads stepping the instances.
+    //@}
+    
     /**
      * @name    Simulink C API data structures
      * @brief   Pointers to Simulink C API data structures.
@@ -1000,12 +1182,47 @@ private:
      */
     bool ScanSignal(const uint16 sigIdx, const uint32 depth, const SignalMode mode, void* const startAddress, StreamString baseName, const uint64 baseOffset, StreamString spacer);
     
+    /**
+     * @brief     Allocates the instances of the model after the first one
+     *            and scans their parameters and ports (NumberOfInstances > 1).
+     * @returns   `true` if all the instances were allocated and have their own root I/O.
+     */
+    bool SetupInstances();
+    
+    /**
+     * @brief      Finds the source of a tunable parameter, i.e. the configuration
+     *             file (highest priority) or the external loader class.
+     * @param[in]  parameterName the full name of the parameter in the model.
+     * @param[out] source the source parameter.
+     * @param[out] sourceName the description of the source (for the logs).
+     * @returns    `true` if the parameter has a source.
+     */
+    bool FindParameterSource(const char8 * const parameterName, ReferenceT<AnyObject> &source, StreamString &sourceName) const;
+    
     /**
      * @brief     Check coherence between model ports and GAM signals and map them.
      * @param[in] direction specifies if the method will map input or outpus
      *                      signals
+     * @param[in] instanceIdx the instance whose ports are mapped (only the GAM
+     *                      signals prefixed by `Instance<instanceIdx>_` are
+     *                      considered when NumberOfInstances > 1)
+     * @param[out] mappedSignals incremented by the number of mapped GAM signals
      */
-    bool MapPorts(const SignalDirection direction);
+    bool MapPorts(const SignalDirection direction, const uint32 instanceIdx, uint32 &mappedSignals);
+    
+    /**
+     * @brief     Computes the address of the model root I/O structure that
+     *            overlaps the model ports with the GAM signals.
+     * @details   The model memory of each port (or of each carried signal for
+     *            structured ports in `Structured` mode) must be at the same
+     *            offset from the beginning of the root I/O structure as the
+     *            mapped GAM signal from the returned address.
+     * @param[in] direction specifies if the method will check input or output
+     *                      ports
+     * @returns   the address to be set as root I/O structure, or `NULL` if
+     *            the ports cannot be rebound.
+     */
+    void* GetRootIOBinding(const SignalDirection direction);
     
     /**
      * @brief Prepare model for execution.
@@ -1056,14 +1273,24 @@ private:
     ReferenceT<ReferenceContainer> cfgParameterContainer;
     
     /**
-     * @brief A database storing absolute paths of parameters found in configuration file.
+     * @brief The parameters found in the configuration file (in the order of the configuration).
      */
-    ConfigurationDatabase cfgParameterDatabase;
+    ReferenceT<AnyObject>* cfgParameters;
     
     /**
-     * @brief A database storing absolute paths of parameters found in an external loader class.
+     * @brief Index from the names of the parameters found in the configuration file to #cfgParameters.
      */
-    ConfigurationDatabase externalParameterDatabase;
+    SimulinkNameIndex cfgParameterIndex;
+    
+    /**
+     * @brief The parameters found in an external loader class (in the order of the loader).
+     */
+    ReferenceT<AnyObject>* externalParameters;
+    
+    /**
+     * @brief Index from the names of the parameters found in an external loader class to #externalParameters.
+     */
+    SimulinkNameIndex externalParameterIndex;
     
     /**
      * @brief Structure that holds data about the current version of the model.
@@ -1079,6 +1306,73 @@ private:
      */
     bool enforceModelSignalCoverage;
 
+    /**
+     * @name Zero-copy root I/O
+     * @brief `true` if the model inputs (outputs) have been rebound to the GAM signal memory and are no longer copied.
+     */
+    //@{
+    bool inputsBound;
+    bool outputsBound;
+    //@}
+
+    /**
+     * @name Parameter staging
+     * @brief Staging copy of the tunable parameters (see StageParameters()).
+     * @details The parameters are stored one after the other in the staging buffer,
+     *          parameters contiguous in the model memory are copied as a single run.
+     */
+    //@{
+    uint8*  stagedParameters;                   //!< Staging buffer.
+    uint32* stagedParameterOffsets;             //!< Offset of each parameter in the staging buffer.
+    uint32  numberOfParameterRuns;              //!< Number of contiguous runs of parameters.
+    void**  parameterRunAddresses;              //!< Model address of each run.
+    uint32* parameterRunOffsets;                //!< Offset of each run in the staging buffer.
+    uint32* parameterRunSizes;                  //!< Size in bytes of each run.
+    volatile int32 stagedParametersReady;       //!< 1 if the staging buffer holds a new set to be applied by the real-time thread.
+    volatile int32 stagingLock;                 //!< Prevents concurrent StageParameters() calls.
+    //@}
+
+    /**
+     * @brief Allocates the staging buffer and copies the current parameter values into it.
+     * @return `true` on succeed.
+     */
+    bool AllocateStagedParameters();
+
+    /**
+     * @brief Filter to receive the StageParameters RPC.
+     */
+    ReferenceT<RegisteredMethodsMessageFilter> filter;
+
+    /**
+     * @brief Maximum number of sub-rate step functions of a multi-rate model.
+     */
+    static const uint32 maxNumberOfSubRates = 15u;
+
+    /**
+     * @name Multi-rate models
+     * @brief Step functions of the sub-rates and their scheduling (see [Multi-rate models](#multi-rate-models)).
+     */
+    //@{
+    void  (*subRateStepFunctions[maxNumberOfSubRates]) (void*); //!< Step functions of the sub-rates (_step1, _step2, ...).
+    uint32 numberOfSubRates;                            //!< Number of sub-rates (0 for single rate models).
+    uint32 subRateDividers[maxNumberOfSubRates];        //!< Number of GAM cycles between two steps of each sub-rate.
+    uint32 subRateCounters[maxNumberOfSubRates];        //!< Cycles to the next step of each sub-rate.
+    bool   subRatesThread;                              //!< If `true`, the sub-rate steps run in #executor.
+    uint32 subRatesCPUMask;                             //!< Affinity of the sub-rates thread.
+    uint32 subRatesStackSize;                           //!< Stack size of the sub-rates thread.
+    SingleThreadService executor;                       //!< The sub-rates thread.
+    EventSem subRatesEvent;                             //!< Wakes up the sub-rates thread.
+    volatile int32 subRatesBusy;                        //!< 1 while the sub-rates thread owns #subRatesPendingMask.
+    uint32 subRatesPendingMask;                         //!< Bit mask of the sub-rates to be stepped by the sub-rates thread.
+    uint32 subRatesOverruns;                            //!< Number of skipped sub-rate activations.
+    //@}
+
+    /**
+     * @brief Calls the step functions of the sub-rates in the mask (fastest first).
+     * @param[in] dueSubRates bit mask of the sub-rates to be stepped.
+     */
+    void ExecuteSubRates(const uint32 dueSubRates);
+
 };
 
 
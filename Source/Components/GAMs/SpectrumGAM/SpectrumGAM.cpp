@@ -0,0 +1,469 @@
+/**
+ * @file SpectrumGAM.cpp
+ * @brief Source file for class SpectrumGAM
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SpectrumGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "FastMath.h"
+#include "SpectrumGAM.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+/**
+ * @brief Converts a block of samples to float64.
+ */
+template<typename T>
+void ConvertSamples(const void * const source,
+                    MARTe::float64 * const destination,
+                    const MARTe::uint32 numberOfSamples) {
+    const T *typedSource = static_cast<const T *>(source);
+    for (MARTe::uint32 i = 0u; i < numberOfSamples; i++) {
+        destination[i] = static_cast<MARTe::float64>(typedSource[i]);
+    }
+}
+
+/**
+ * @brief Checks if the type of an input signal is supported.
+ */
+bool IsSupportedInputType(const MARTe::TypeDescriptor &type) {
+    using namespace MARTe;
+    return ((type == SignedInteger16Bit) || (type == UnsignedInteger16Bit) || (type == SignedInteger32Bit) || (type == UnsignedInteger32Bit)
+            || (type == Float32Bit) || (type == Float64Bit));
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+SpectrumGAM::SpectrumGAM() :
+        GAM() {
+    fftSize = 0u;
+    hopSize = 0u;
+    numberOfChannels = 0u;
+    numberOfSamples = 0u;
+    numberOfSpectra = 0u;
+    output = SpectrumGAMOutputMagnitude;
+    window = NULL_PTR(float64 *);
+    magnitudeGain = 0.;
+    numberOfBands = 0u;
+    bandFirstBin = NULL_PTR(uint32 *);
+    bandLastBin = NULL_PTR(uint32 *);
+    history = NULL_PTR(float64 *);
+    historyIndex = 0u;
+    samples = NULL_PTR(float64 *);
+    workRe = NULL_PTR(float64 *);
+    workIm = NULL_PTR(float64 *);
+    binPower = NULL_PTR(float64 *);
+    inputTypes = NULL_PTR(TypeDescriptor *);
+    inputSignals = NULL_PTR(void **);
+    float32Output = false;
+    outputSignals = NULL_PTR(void **);
+}
+
+SpectrumGAM::~SpectrumGAM() {
+    if (window != NULL_PTR(float64 *)) {
+        delete[] window;
+    }
+    if (bandFirstBin != NULL_PTR(uint32 *)) {
+        delete[] bandFirstBin;
+    }
+    if (bandLastBin != NULL_PTR(uint32 *)) {
+        delete[] bandLastBin;
+    }
+    if (history != NULL_PTR(float64 *)) {
+        delete[] history;
+    }
+    if (samples != NULL_PTR(float64 *)) {
+        delete[] samples;
+    }
+    if (workRe != NULL_PTR(float64 *)) {
+        delete[] workRe;
+    }
+    if (workIm != NULL_PTR(float64 *)) {
+        delete[] workIm;
+    }
+    if (binPower != NULL_PTR(float64 *)) {
+        delete[] binPower;
+    }
+    if (inputTypes != NULL_PTR(TypeDescriptor *)) {
+        delete[] inputTypes;
+    }
+    if (inputSignals != NULL_PTR(void **)) {
+        delete[] inputSignals;
+    }
+    if (outputSignals != NULL_PTR(void **)) {
+        delete[] outputSignals;
+    }
+}
+
+bool SpectrumGAM::Initialise(StructuredDataI &data) {
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        ok = data.Read("FFTSize", fftSize);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "FFTSize shall be specified");
+        }
+    }
+    if (ok) {
+        ok = (fftSize >= 4u);
+        if (ok) {
+            ok = fft.SetSize(fftSize);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "FFTSize shall be a power of 2 >= 4");
+        }
+    }
+    if (ok) {
+        if (!data.Read("HopSize", hopSize)) {
+            hopSize = 0u;
+        }
+    }
+    StreamString windowName = "Hann";
+    if (ok) {
+        if (!data.Read("Window", windowName)) {
+            windowName = "Hann";
+        }
+        ok = ((windowName == "Rectangular") || (windowName == "Hann") || (windowName == "Hamming") || (windowName == "Blackman"));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for Window (expected values Rectangular, Hann, Hamming or Blackman)");
+        }
+    }
+    if (ok) {
+        window = new float64[fftSize];
+        float64 windowSum = 0.;
+        for (uint32 n = 0u; n < fftSize; n++) {
+            /* Periodic windows, i.e. the first sample of the next period is not included */
+            float64 phase = (2.0 * FastMath::PI * static_cast<float64>(n)) / static_cast<float64>(fftSize);
+            if (windowName == "Hann") {
+                window[n] = 0.5 - (0.5 * cos(phase));
+            }
+            else if (windowName == "Hamming") {
+                window[n] = 0.54 - (0.46 * cos(phase));
+            }
+            else if (windowName == "Blackman") {
+                window[n] = (0.42 - (0.5 * cos(phase))) + (0.08 * cos(2.0 * phase));
+            }
+            else {
+                window[n] = 1.0;
+            }
+            windowSum += window[n];
+        }
+        magnitudeGain = 2.0 / windowSum;
+    }
+    StreamString outputName = "Magnitude";
+    if (ok) {
+        if (!data.Read("Output", outputName)) {
+            outputName = "Magnitude";
+        }
+        if (outputName == "Magnitude") {
+            output = SpectrumGAMOutputMagnitude;
+        }
+        else if (outputName == "MagnitudePhase") {
+            output = SpectrumGAMOutputMagnitudePhase;
+        }
+        else if (outputName == "BandPower") {
+            output = SpectrumGAMOutputBandPower;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for Output (expected values Magnitude, MagnitudePhase or BandPower)");
+            ok = false;
+        }
+    }
+    if ((ok) && (output == SpectrumGAMOutputBandPower)) {
+        AnyType firstBinArray = data.GetType("BandFirstBin");
+        AnyType lastBinArray = data.GetType("BandLastBin");
+        ok = ((firstBinArray.GetDataPointer() != NULL) && (lastBinArray.GetDataPointer() != NULL));
+        if (ok) {
+            numberOfBands = firstBinArray.GetNumberOfElements(0u);
+            ok = ((numberOfBands > 0u) && (lastBinArray.GetNumberOfElements(0u) == numberOfBands));
+        }
+        if (ok) {
+            bandFirstBin = new uint32[numberOfBands];
+            bandLastBin = new uint32[numberOfBands];
+            Vector<uint32> firstBinVector(bandFirstBin, numberOfBands);
+            Vector<uint32> lastBinVector(bandLastBin, numberOfBands);
+            ok = data.Read("BandFirstBin", firstBinVector);
+            if (ok) {
+                ok = data.Read("BandLastBin", lastBinVector);
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "BandFirstBin and BandLastBin shall be specified with the same number of elements");
+        }
+        for (uint32 b = 0u; (b < numberOfBands) && (ok); b++) {
+            ok = ((bandFirstBin[b] <= bandLastBin[b]) && (bandLastBin[b] <= (fftSize / 2u)));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Band %u shall have BandFirstBin <= BandLastBin <= FFTSize / 2", b);
+            }
+        }
+    }
+    return ok;
+}
+
+bool SpectrumGAM::Setup() {
+    numberOfChannels = GetNumberOfInputSignals();
+    bool ok = (numberOfChannels > 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "At least one input signal shall be specified");
+    }
+    uint32 numberOfOutputSignals = (output == SpectrumGAMOutputMagnitudePhase) ? (2u * numberOfChannels) : (numberOfChannels);
+    if (ok) {
+        ok = (GetNumberOfOutputSignals() == numberOfOutputSignals);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The number of output signals shall be %u", numberOfOutputSignals);
+        }
+    }
+    if (ok) {
+        inputTypes = new TypeDescriptor[numberOfChannels];
+        inputSignals = new void*[numberOfChannels];
+    }
+    for (uint32 i = 0u; (i < numberOfChannels) && (ok); i++) {
+        inputTypes[i] = GetSignalType(InputSignals, i);
+        ok = IsSupportedInputType(inputTypes[i]);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The type of the input signal %u shall be int16, uint16, int32, uint32, float32 or float64", i);
+        }
+        uint32 numberOfElements = 0u;
+        uint32 numberOfSignalSamples = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(InputSignals, i, numberOfElements);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(InputSignals, i, numberOfSignalSamples);
+        }
+        if (ok) {
+            uint32 channelSamples = numberOfElements * numberOfSignalSamples;
+            if (i == 0u) {
+                numberOfSamples = channelSamples;
+            }
+            ok = ((channelSamples > 0u) && (channelSamples == numberOfSamples));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "All the input signals shall have the same (> 0) NumberOfElements * NumberOfSamples");
+            }
+        }
+        if (ok) {
+            inputSignals[i] = GetInputSignalMemory(i);
+        }
+    }
+    if (ok) {
+        if (hopSize == 0u) {
+            hopSize = numberOfSamples;
+        }
+        ok = ((hopSize <= fftSize) && ((numberOfSamples % hopSize) == 0u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "HopSize (%u) shall be <= FFTSize and divide the number of samples per cycle (%u)", hopSize,
+                         numberOfSamples);
+        }
+    }
+    if (ok) {
+        numberOfSpectra = numberOfSamples / hopSize;
+        outputSignals = new void*[numberOfOutputSignals];
+    }
+    uint32 numberOfOutputElements = GetNumberOfSpectra() * GetNumberOfBins();
+    for (uint32 i = 0u; (i < numberOfOutputSignals) && (ok); i++) {
+        TypeDescriptor outputType = GetSignalType(OutputSignals, i);
+        ok = ((outputType == Float32Bit) || (outputType == Float64Bit));
+        if (ok) {
+            if (i == 0u) {
+                float32Output = (outputType == Float32Bit);
+            }
+            ok = ((outputType == Float32Bit) == float32Output);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "All the output signals shall be float32 or float64");
+        }
+        uint32 numberOfElements = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(OutputSignals, i, numberOfElements);
+        }
+        if (ok) {
+            ok = (numberOfElements == numberOfOutputElements);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The output signal %u shall have %u elements (%u spectra * %u bins)", i, numberOfOutputElements,
+                             numberOfSpectra, GetNumberOfBins());
+            }
+        }
+        if (ok) {
+            outputSignals[i] = GetOutputSignalMemory(i);
+        }
+    }
+    if (ok) {
+        history = new float64[numberOfChannels * fftSize];
+        for (uint32 n = 0u; n < (numberOfChannels * fftSize); n++) {
+            history[n] = 0.;
+        }
+        historyIndex = 0u;
+        samples = new float64[numberOfChannels * numberOfSamples];
+        workRe = new float64[fftSize];
+        workIm = new float64[fftSize];
+        if (output == SpectrumGAMOutputBandPower) {
+            binPower = new float64[(fftSize / 2u) + 1u];
+        }
+    }
+    return ok;
+}
+
+bool SpectrumGAM::Execute() {
+    const uint32 mask = fftSize - 1u;
+    /*lint -e{613} the buffers cannot be NULL as Execute is only called after a successful Setup*/
+    for (uint32 c = 0u; c < numberOfChannels; c++) {
+        float64 *channelSamples = &samples[c * numberOfSamples];
+        if (inputTypes[c] == SignedInteger16Bit) {
+            ConvertSamples<int16>(inputSignals[c], channelSamples, numberOfSamples);
+        }
+        else if (inputTypes[c] == UnsignedInteger16Bit) {
+            ConvertSamples<uint16>(inputSignals[c], channelSamples, numberOfSamples);
+        }
+        else if (inputTypes[c] == SignedInteger32Bit) {
+            ConvertSamples<int32>(inputSignals[c], channelSamples, numberOfSamples);
+        }
+        else if (inputTypes[c] == UnsignedInteger32Bit) {
+            ConvertSamples<uint32>(inputSignals[c], channelSamples, numberOfSamples);
+        }
+        else if (inputTypes[c] == Float32Bit) {
+            ConvertSamples<float32>(inputSignals[c], channelSamples, numberOfSamples);
+        }
+        else {
+            ConvertSamples<float64>(inputSignals[c], channelSamples, numberOfSamples);
+        }
+    }
+    /*lint -e{613} the buffers cannot be NULL as Execute is only called after a successful Setup*/
+    for (uint32 s = 0u; s < numberOfSpectra; s++) {
+        for (uint32 c = 0u; c < numberOfChannels; c++) {
+            float64 *channelHistory = &history[c * fftSize];
+            const float64 *newSamples = &samples[(c * numberOfSamples) + (s * hopSize)];
+            for (uint32 j = 0u; j < hopSize; j++) {
+                channelHistory[(historyIndex + j) & mask] = newSamples[j];
+            }
+        }
+        historyIndex = (historyIndex + hopSize) & mask;
+        for (uint32 c = 0u; c < numberOfChannels; c += 2u) {
+            const float64 *channelHistory = &history[c * fftSize];
+            for (uint32 n = 0u; n < fftSize; n++) {
+                workRe[n] = window[n] * channelHistory[(historyIndex + n) & mask];
+            }
+            bool pair = ((c + 1u) < numberOfChannels);
+            if (pair) {
+                const float64 *pairHistory = &history[(c + 1u) * fftSize];
+                for (uint32 n = 0u; n < fftSize; n++) {
+                    workIm[n] = window[n] * pairHistory[(historyIndex + n) & mask];
+                }
+            }
+            else {
+                for (uint32 n = 0u; n < fftSize; n++) {
+                    workIm[n] = 0.;
+                }
+            }
+            fft.Forward(workRe, workIm);
+            WriteSpectrum(c, s, false);
+            if (pair) {
+                WriteSpectrum(c + 1u, s, true);
+            }
+        }
+    }
+    return true;
+}
+
+void SpectrumGAM::WriteSpectrum(const uint32 channel,
+                                const uint32 spectrum,
+                                const bool secondOfPair) {
+    const uint32 mask = fftSize - 1u;
+    const uint32 halfSize = fftSize / 2u;
+    const uint32 numberOfBins = halfSize + 1u;
+    /*lint -e{613} the buffers cannot be NULL as WriteSpectrum is only called after a successful Setup*/
+    for (uint32 k = 0u; k <= halfSize; k++) {
+        /* Z[k] = A[k] + j * B[k] with A[N - k] = conj(A[k]) and B[N - k] = conj(B[k]) as a and b are real */
+        uint32 nk = (fftSize - k) & mask;
+        float64 re;
+        float64 im;
+        if (secondOfPair) {
+            re = 0.5 * (workIm[k] + workIm[nk]);
+            im = 0.5 * (workRe[nk] - workRe[k]);
+        }
+        else {
+            re = 0.5 * (workRe[k] + workRe[nk]);
+            im = 0.5 * (workIm[k] - workIm[nk]);
+        }
+        bool edgeBin = ((k == 0u) || (k == halfSize));
+        float64 magnitude = magnitudeGain * sqrt((re * re) + (im * im));
+        if (edgeBin) {
+            magnitude *= 0.5;
+        }
+        if (output == SpectrumGAMOutputBandPower) {
+            binPower[k] = (edgeBin) ? (magnitude * magnitude) : (0.5 * magnitude * magnitude);
+        }
+        else if (output == SpectrumGAMOutputMagnitudePhase) {
+            WriteOutput(2u * channel, (spectrum * numberOfBins) + k, magnitude);
+            WriteOutput((2u * channel) + 1u, (spectrum * numberOfBins) + k, atan2(im, re));
+        }
+        else {
+            WriteOutput(channel, (spectrum * numberOfBins) + k, magnitude);
+        }
+    }
+    if (output == SpectrumGAMOutputBandPower) {
+        for (uint32 b = 0u; b < numberOfBands; b++) {
+            float64 power = 0.;
+            for (uint32 k = bandFirstBin[b]; k <= bandLastBin[b]; k++) {
+                power += binPower[k];
+            }
+            WriteOutput(channel, (spectrum * numberOfBands) + b, power);
+        }
+    }
+}
+
+uint32 SpectrumGAM::GetFFTSize() const {
+    return fftSize;
+}
+
+uint32 SpectrumGAM::GetHopSize() const {
+    return hopSize;
+}
+
+uint32 SpectrumGAM::GetNumberOfSpectra() const {
+    return numberOfSpectra;
+}
+
+uint32 SpectrumGAM::GetNumberOfBins() const {
+    return (output == SpectrumGAMOutputBandPower) ? (numberOfBands) : ((fftSize / 2u) + 1u);
+}
+
+const float64 *SpectrumGAM::GetWindow() const {
+    return window;
+}
+
+CLASS_REGISTER(SpectrumGAM, "1.0")
+
+}
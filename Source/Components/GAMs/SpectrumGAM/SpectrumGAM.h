@@ -0,0 +1,318 @@
+/**
+ * @file SpectrumGAM.h
+ * @brief Header file for class SpectrumGAM
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SpectrumGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SPECTRUMGAM_H_
+#define SPECTRUMGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "FastFourierTransform.h"
+#include "GAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Quantity written in the output signals.
+ */
+enum SpectrumGAMOutput {
+    SpectrumGAMOutputMagnitude,
+    SpectrumGAMOutputMagnitudePhase,
+    SpectrumGAMOutputBandPower
+};
+
+/**
+ * @brief GAM which computes the windowed spectrum of N channels.
+ * @details Each input signal is a channel and each cycle provides a block of NumberOfElements * NumberOfSamples new samples
+ * (the same for all the channels). The GAM keeps the last FFTSize samples of each channel and, every HopSize new samples,
+ * computes the FFT of these samples multiplied by the window. The number of spectra computed per cycle is thus
+ * (NumberOfElements * NumberOfSamples) / HopSize and consecutive spectra overlap by FFTSize - HopSize samples, also across cycles.
+ * When the GAM starts the history is zero.
+ *
+ * The FFT plan (bit reversal and twiddle factors), the window and all the buffers are allocated at Setup.
+ * The channels are transformed in pairs, the first channel of the pair being the real part and the second the imaginary part of
+ * a single complex FFT, from which the two real spectra are separated. Each channel pair thus goes through the FFT plan
+ * in a single pass.
+ *
+ * For each spectrum the bins k = 0 ... FFTSize / 2 are computed, where bin k has the frequency k * Fs / FFTSize.
+ * - Output = Magnitude: the output signal of each channel has the single sided amplitude spectrum, i.e. 2 * |X[k]| / sum(window)
+ * (|X[k]| / sum(window) for k = 0 and k = FFTSize / 2), so that a sinusoid of amplitude A in the centre of a bin has magnitude A;
+ * - Output = MagnitudePhase: as Magnitude, but each channel has two output signals, the magnitude and the phase (atan2 of X[k], in radians);
+ * - Output = BandPower: the output signal of each channel has the power (magnitude^2 / 2, magnitude^2 for k = 0 and k = FFTSize / 2)
+ * summed between the bins BandFirstBin[b] and BandLastBin[b] (both included) of each band b.
+ *
+ * The spectra are written one after the other, i.e. each output signal has (NumberOfElements * NumberOfSamples) / HopSize spectra of
+ * FFTSize / 2 + 1 bins (or of the number of bands), the oldest first.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Spectrum = {
+ *     Class = SpectrumGAM
+ *     FFTSize = 256 //Compulsory. Power of 2 >= 4.
+ *     HopSize = 64 //Optional. Number of new samples between spectra. Shall be <= FFTSize and divide the number of samples per cycle.
+ *                  //Default = number of samples per cycle (which in this case shall be <= FFTSize).
+ *     Window = Hann //Optional. Rectangular, Hann (default), Hamming or Blackman.
+ *     Output = BandPower //Optional. Magnitude (default), MagnitudePhase or BandPower.
+ *     BandFirstBin = {1 10} //Compulsory if Output = BandPower. First bin of each band.
+ *     BandLastBin = {9 40} //Compulsory if Output = BandPower. Last bin of each band (>= BandFirstBin and <= FFTSize / 2).
+ *     InputSignals = {
+ *         ADC0 = {
+ *             DataSource = "ADCs"
+ *             Type = int16 //Supported types: int16, uint16, int32, uint32, float32 and float64.
+ *             NumberOfElements = 128 //The same for all the channels.
+ *         }
+ *         ADC1 = {
+ *             DataSource = "ADCs"
+ *             Type = int16
+ *             NumberOfElements = 128
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         ADC0Bands = {
+ *             DataSource = "DDB1"
+ *             Type = float32 //float32 or float64
+ *             NumberOfElements = 4 //Number of spectra per cycle (128 / 64) * number of bands (2)
+ *         }
+ *         ADC1Bands = {
+ *             DataSource = "DDB1"
+ *             Type = float32
+ *             NumberOfElements = 4
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class SpectrumGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    SpectrumGAM();
+
+    /**
+     * @brief Destructor. Frees the window and the buffers.
+     */
+    virtual ~SpectrumGAM();
+
+    /**
+     * @brief Reads the parameters, computes the FFT plan and the window.
+     * @param[in] data the GAM configuration specified in the class description.
+     * @return true if FFTSize is a power of 2 >= 4, the Window and the Output are valid and,
+     * for Output = BandPower, BandFirstBin and BandLastBin are valid.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals and allocates the history and the work buffers.
+     * @return true if the signals are those specified in the class description and HopSize is valid.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Appends the new samples to the history of each channel and computes the spectra.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Gets the number of points of the FFT.
+     * @return the number of points of the FFT.
+     */
+    uint32 GetFFTSize() const;
+
+    /**
+     * @brief Gets the number of new samples between two consecutive spectra.
+     * @return the number of new samples between two consecutive spectra.
+     */
+    uint32 GetHopSize() const;
+
+    /**
+     * @brief Gets the number of spectra per cycle.
+     * @return the number of spectra per cycle.
+     */
+    uint32 GetNumberOfSpectra() const;
+
+    /**
+     * @brief Gets the number of values per spectrum written in each output signal.
+     * @return FFTSize / 2 + 1 or the number of bands.
+     */
+    uint32 GetNumberOfBins() const;
+
+    /**
+     * @brief Gets the window.
+     * @return the FFTSize coefficients of the window.
+     */
+    const float64 *GetWindow() const;
+
+private:
+
+    /**
+     * @brief Computes and writes a spectrum of a channel.
+     * @param[in] channel the channel.
+     * @param[in] spectrum the index of the spectrum in the cycle.
+     * @param[in] secondOfPair true if the channel is the imaginary part of the transformed pair.
+     */
+    void WriteSpectrum(const uint32 channel,
+                       const uint32 spectrum,
+                       const bool secondOfPair);
+
+    /**
+     * @brief Writes a value in an output signal.
+     * @param[in] signalIdx the index of the output signal.
+     * @param[in] index the index of the element.
+     * @param[in] value the value to write.
+     */
+    inline void WriteOutput(const uint32 signalIdx,
+                            const uint32 index,
+                            const float64 value);
+
+    /**
+     * The FFT plan.
+     */
+    FastFourierTransform fft;
+
+    /**
+     * The number of points of the FFT.
+     */
+    uint32 fftSize;
+
+    /**
+     * The number of new samples between two consecutive spectra.
+     */
+    uint32 hopSize;
+
+    /**
+     * The number of channels (input signals).
+     */
+    uint32 numberOfChannels;
+
+    /**
+     * The number of new samples per cycle of each channel.
+     */
+    uint32 numberOfSamples;
+
+    /**
+     * The number of spectra per cycle.
+     */
+    uint32 numberOfSpectra;
+
+    /**
+     * The quantity written in the output signals.
+     */
+    SpectrumGAMOutput output;
+
+    /**
+     * The window coefficients.
+     */
+    float64 *window;
+
+    /**
+     * The gain which converts |X[k]| to the amplitude of the sinusoid (2 / sum(window)).
+     */
+    float64 magnitudeGain;
+
+    /**
+     * The number of bands (Output = BandPower).
+     */
+    uint32 numberOfBands;
+
+    /**
+     * The first and the last bin of each band.
+     */
+    uint32 *bandFirstBin;
+    uint32 *bandLastBin;
+
+    /**
+     * The last FFTSize samples of each channel (circular buffer of FFTSize samples per channel).
+     */
+    float64 *history;
+
+    /**
+     * The position in history of the oldest sample.
+     */
+    uint32 historyIndex;
+
+    /**
+     * The new samples of each channel (numberOfSamples per channel) converted to float64.
+     */
+    float64 *samples;
+
+    /**
+     * The real and the imaginary part of the FFT of the channel pair.
+     */
+    float64 *workRe;
+    float64 *workIm;
+
+    /**
+     * The power of each bin (Output = BandPower).
+     */
+    float64 *binPower;
+
+    /**
+     * The type and the memory of each input signal.
+     */
+    TypeDescriptor *inputTypes;
+    void **inputSignals;
+
+    /**
+     * True if the output signals are float32 (float64 otherwise).
+     */
+    bool float32Output;
+
+    /**
+     * The memory of each output signal.
+     */
+    void **outputSignals;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+void SpectrumGAM::WriteOutput(const uint32 signalIdx,
+                              const uint32 index,
+                              const float64 value) {
+    if (float32Output) {
+        static_cast<float32 *>(outputSignals[signalIdx])[index] = static_cast<float32>(value);
+    }
+    else {
+        static_cast<float64 *>(outputSignals[signalIdx])[index] = value;
+    }
+}
+
+}
+
+#endif /* SPECTRUMGAM_H_ */
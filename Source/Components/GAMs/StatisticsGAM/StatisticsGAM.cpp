@@ -31,6 +31,7 @@
 
 #include "AdvancedErrorManagement.h"
 #include "StatisticsHelperT.h"
+#include "StatisticsWindowsT.h"
 #include "StatisticsGAM.h"
 
 /*---------------------------------------------------------------------------*/
@@ -52,71 +53,187 @@ StatisticsGAM::StatisticsGAM() :
     startCycleNumber = 0u;
     cycleCounter = 0u;
     infiniteMaxMin = false;
+    numberOfChannels = 0u;
+    numberOfInputElements = NULL_PTR(uint32 *);
+    compensated = false;
+    quantiles = NULL_PTR(float64 *);
+    numberOfQuantiles = 0u;
+    quantileEstimators = NULL_PTR(StatisticsQuantile *);
+    decimationRate = 1u;
+    decimationCounter = 0u;
+    windowSizes = NULL_PTR(uint32 *);
+    numberOfWindows = 0u;
+    numberOfStatistics = 0u;
 }
 
-/*lint -e{1551} no exception thrown deleting the StatisticsHelperT<> instance*/
+template<typename Type> bool StatisticsGAM::CreateT() {
+
+    uint32 channel;
+
+    /*lint -e{665} [MISRA C++ Rule 16-0-6] templated type passed as argument to MACRO*/
+    if (numberOfWindows > 0u) {
+        StatisticsWindowsT<Type> ** windowsRef = new StatisticsWindowsT<Type> *[numberOfChannels];
+
+        for (channel = 0u; channel < numberOfChannels; channel++) {
+            windowsRef[channel] = new StatisticsWindowsT<Type>(decimationRate, windowSizes, numberOfWindows);
+        }
+
+        stats = static_cast<void *>(windowsRef);
+    }
+    else {
+        StatisticsHelperT<Type> ** ref = new StatisticsHelperT<Type> *[numberOfChannels];
+
+        for (channel = 0u; channel < numberOfChannels; channel++) {
+            ref[channel] = new StatisticsHelperT<Type>(windowSize, compensated);
+        }
+
+        stats = static_cast<void *>(ref);
+    }
+
+    /* The quantiles are estimated over windows of the actual (i.e. power of 2 for integer types) window size */
+    bool ret = true;
+    if (numberOfQuantiles > 0u) {
+        StatisticsHelperT<Type> ** ref = static_cast<StatisticsHelperT<Type> **>(stats);
+        quantileEstimators = new StatisticsQuantile[numberOfChannels * numberOfQuantiles];
+        uint32 q;
+        for (channel = 0u; (channel < numberOfChannels) && (ret); channel++) {
+            for (q = 0u; (q < numberOfQuantiles) && (ret); q++) {
+                ret = quantileEstimators[(channel * numberOfQuantiles) + q].Initialise(quantiles[q], ref[channel]->GetSize());
+            }
+        }
+    }
+
+    return ret;
+}
+
+/*lint -e{1551} no exception thrown deleting the StatisticsHelperT<> instances*/
+template<typename Type> void StatisticsGAM::DeleteT() {
+
+    uint32 channel;
+
+    if (numberOfWindows > 0u) {
+        StatisticsWindowsT<Type> ** windowsRef = static_cast<StatisticsWindowsT<Type> **>(stats);
+
+        for (channel = 0u; channel < numberOfChannels; channel++) {
+            delete windowsRef[channel];
+        }
+
+        delete[] windowsRef;
+    }
+    else {
+        StatisticsHelperT<Type> ** ref = static_cast<StatisticsHelperT<Type> **>(stats);
+
+        for (channel = 0u; channel < numberOfChannels; channel++) {
+            delete ref[channel];
+        }
+
+        delete[] ref;
+    }
+}
+
+template<typename Type> bool StatisticsGAM::ResetT() {
+
+    bool ret = true;
+    uint32 channel;
+
+    if (numberOfWindows > 0u) {
+        StatisticsWindowsT<Type> ** windowsRef = static_cast<StatisticsWindowsT<Type> **>(stats);
+
+        for (channel = 0u; channel < numberOfChannels; channel++) {
+            windowsRef[channel]->Reset();
+        }
+    }
+    else {
+        StatisticsHelperT<Type> ** ref = static_cast<StatisticsHelperT<Type> **>(stats);
+
+        for (channel = 0u; (channel < numberOfChannels) && (ret); channel++) {
+            ret = ref[channel]->Reset();
+        }
+    }
+
+    if (quantileEstimators != NULL_PTR(StatisticsQuantile *)) {
+        uint32 i;
+        for (i = 0u; i < (numberOfChannels * numberOfQuantiles); i++) {
+            quantileEstimators[i].Reset();
+        }
+    }
+
+    return ret;
+}
+
+/*lint -e{1551} no exception thrown deleting the StatisticsHelperT<> instances*/
 StatisticsGAM::~StatisticsGAM() {
 
     bool ok = (stats != NULL_PTR(void *));
 
-    /* Delete StatisticsHelperT class */
+    /* Delete StatisticsHelperT classes */
 
     if (ok) {
 
         if (signalType == SignedInteger8Bit) {
-            StatisticsHelperT<int8> * ref = static_cast<StatisticsHelperT<int8> *>(stats);
-            delete ref;
+            DeleteT<int8>();
         }
 
         if (signalType == SignedInteger16Bit) {
-            StatisticsHelperT<int16> * ref = static_cast<StatisticsHelperT<int16> *>(stats);
-            delete ref;
+            DeleteT<int16>();
         }
 
         if (signalType == SignedInteger32Bit) {
-            StatisticsHelperT<int32> * ref = static_cast<StatisticsHelperT<int32> *>(stats);
-            delete ref;
+            DeleteT<int32>();
         }
 
         if (signalType == SignedInteger64Bit) {
-            StatisticsHelperT<int64> * ref = static_cast<StatisticsHelperT<int64> *>(stats);
-            delete ref;
+            DeleteT<int64>();
         }
 
         if (signalType == UnsignedInteger8Bit) {
-            StatisticsHelperT<uint8> * ref = static_cast<StatisticsHelperT<uint8> *>(stats);
-            delete ref;
+            DeleteT<uint8>();
         }
 
         if (signalType == UnsignedInteger16Bit) {
-            StatisticsHelperT<uint16> * ref = static_cast<StatisticsHelperT<uint16> *>(stats);
-            delete ref;
+            DeleteT<uint16>();
         }
 
         if (signalType == UnsignedInteger32Bit) {
-            StatisticsHelperT<uint32> * ref = static_cast<StatisticsHelperT<uint32> *>(stats);
-            delete ref;
+            DeleteT<uint32>();
         }
 
         if (signalType == UnsignedInteger64Bit) {
-            StatisticsHelperT<uint64> * ref = static_cast<StatisticsHelperT<uint64> *>(stats);
-            delete ref;
+            DeleteT<uint64>();
         }
 
         if (signalType == Float32Bit) {
-            StatisticsHelperT<float32> * ref = static_cast<StatisticsHelperT<float32> *>(stats);
-            delete ref;
+            DeleteT<float32>();
         }
 
         if (signalType == Float64Bit) {
-            StatisticsHelperT<float64> * ref = static_cast<StatisticsHelperT<float64> *>(stats);
-            delete ref;
+            DeleteT<float64>();
         }
 
     }
 
     stats = NULL_PTR(void *);
 
+    if (numberOfInputElements != NULL_PTR(uint32 *)) {
+        delete[] numberOfInputElements;
+        numberOfInputElements = NULL_PTR(uint32 *);
+    }
+
+    if (quantiles != NULL_PTR(float64 *)) {
+        delete[] quantiles;
+        quantiles = NULL_PTR(float64 *);
+    }
+
+    if (quantileEstimators != NULL_PTR(StatisticsQuantile *)) {
+        delete[] quantileEstimators;
+        quantileEstimators = NULL_PTR(StatisticsQuantile *);
+    }
+
+    if (windowSizes != NULL_PTR(uint32 *)) {
+        delete[] windowSizes;
+        windowSizes = NULL_PTR(uint32 *);
+    }
+
 }
 
 bool StatisticsGAM::Initialise(StructuredDataI & data) {
@@ -145,6 +262,91 @@ bool StatisticsGAM::Initialise(StructuredDataI & data) {
         }
         infiniteMaxMin = (infiniteMaxMinTemp > 0u);
         REPORT_ERROR_PARAMETERS(ErrorManagement::Information, "Max and Min are %s", infiniteMaxMin?"absolute":"windowed");
+
+        StreamString accumulatorName;
+        if (data.Read("Accumulator", accumulatorName)) {
+            if (accumulatorName == "Standard") {
+                compensated = false;
+            }
+            else if (accumulatorName == "Compensated") {
+                compensated = true;
+            }
+            else {
+                ret = false;
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for Accumulator. Possible values Standard or Compensated");
+            }
+        }
+        if (ret) {
+            REPORT_ERROR_PARAMETERS(ErrorManagement::Information, "Accumulator is %s", compensated?"compensated":"standard");
+        }
+    }
+
+    if (ret) {
+        AnyType quantilesArray = data.GetType("Quantiles");
+        if (quantilesArray.GetDataPointer() != NULL) {
+            numberOfQuantiles = quantilesArray.GetNumberOfElements(0u);
+            ret = (numberOfQuantiles > 0u);
+            if (ret) {
+                quantiles = new float64[numberOfQuantiles];
+                Vector<float64> quantilesVector(quantiles, numberOfQuantiles);
+                ret = data.Read("Quantiles", quantilesVector);
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Unable to read Quantiles");
+            }
+            uint32 q;
+            for (q = 0u; (q < numberOfQuantiles) && (ret); q++) {
+                ret = ((quantiles[q] > 0.0) && (quantiles[q] < 1.0));
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Quantiles[%u] shall be > 0 and < 1", q);
+                }
+            }
+        }
+    }
+
+    if (ret) {
+        if (!data.Read("DecimationRate", decimationRate)) {
+            decimationRate = 1u;
+        }
+        ret = (decimationRate > 0u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "DecimationRate shall be > 0");
+        }
+    }
+
+    if (ret) {
+        AnyType windowsArray = data.GetType("Windows");
+        if (windowsArray.GetDataPointer() != NULL) {
+            numberOfWindows = windowsArray.GetNumberOfElements(0u);
+            ret = (numberOfWindows > 0u);
+            if (ret) {
+                windowSizes = new uint32[numberOfWindows];
+                Vector<uint32> windowsVector(windowSizes, numberOfWindows);
+                ret = data.Read("Windows", windowsVector);
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Unable to read Windows");
+            }
+            uint32 w;
+            for (w = 0u; (w < numberOfWindows) && (ret); w++) {
+                ret = ((windowSizes[w] > 0u) && ((windowSizes[w] % decimationRate) == 0u));
+                if (ret) {
+                    ret = ((w == 0u) || (windowSizes[w] > windowSizes[w - 1u]));
+                }
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Windows[%u] shall be a multiple of DecimationRate (%u) and larger than the previous window", w, decimationRate);
+                }
+            }
+            if (ret) {
+                ret = (numberOfQuantiles == 0u);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Quantiles are not supported with Windows");
+                }
+            }
+            if (ret) {
+                REPORT_ERROR_PARAMETERS(ErrorManagement::Information, "Statistics over %u windows updated every %u cycles", numberOfWindows, decimationRate);
+            }
+        }
     }
 
     return ret;
@@ -173,34 +375,58 @@ bool StatisticsGAM::Setup() {
     }
 
     uint32 signalNumberOfDimensions = 0u;
+    uint32 signalNumberOfElements = 0u;
+    uint32 signalIndex;
 
+    /* Each element of each input signal is a channel */
     if (ret) {
-        ret = GetSignalNumberOfDimensions(InputSignals, 0u, signalNumberOfDimensions);
+        ret = (numberOfInputElements == NULL_PTR(uint32 *));
     }
 
     if (ret) {
-        ret = (signalNumberOfDimensions == 0u);
+        numberOfInputElements = new uint32[GetNumberOfInputSignals()];
+        numberOfChannels = 0u;
     }
 
-    if (!ret) {
-        REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfDimensions(InputSignals, 0u) != 0u");
-    }
+    /*lint -e{850} no modification of the loop index inside the body of the loop (constness issue with the variadic macro ?)*/
+    for (signalIndex = 0u; (signalIndex < GetNumberOfInputSignals()) && (ret); signalIndex++) {
 
-    uint32 signalNumberOfElements = 0u;
+        ret = (signalType == GetSignalType(InputSignals, signalIndex));
 
-    if (ret) {
-        ret = GetSignalNumberOfElements(InputSignals, 0u, signalNumberOfElements);
-    }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalType(InputSignals, %u) != signalType", signalIndex);
+        }
 
-    if (ret) {
-        ret = (signalNumberOfElements == 1u);
-    }
+        if (ret) {
+            ret = GetSignalNumberOfDimensions(InputSignals, signalIndex, signalNumberOfDimensions);
+        }
 
-    if (!ret) {
-        REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements(InputSignals, 0u) != 1u");
-    }
+        if (ret) {
+            ret = (signalNumberOfDimensions <= 1u);
+        }
 
-    uint32 signalIndex;
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfDimensions(InputSignals, %u) > 1u", signalIndex);
+        }
+
+        if (ret) {
+            ret = GetSignalNumberOfElements(InputSignals, signalIndex, signalNumberOfElements);
+        }
+
+        if (ret) {
+            ret = (signalNumberOfElements > 0u);
+        }
+
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements(InputSignals, %u) == 0u", signalIndex);
+        }
+
+        if (ret) {
+            numberOfInputElements[signalIndex] = signalNumberOfElements;
+            numberOfChannels += signalNumberOfElements;
+        }
+
+    }
 
     /*lint -e{850} no modification of the loop index inside the body of the loop (constness issue with the variadic macro ?)*/
     for (signalIndex = 0u; (signalIndex < GetNumberOfOutputSignals()) && (ret); signalIndex++) {
@@ -216,11 +442,11 @@ bool StatisticsGAM::Setup() {
         }
 
         if (ret) {
-            ret = (signalNumberOfDimensions == 0u);
+            ret = (signalNumberOfDimensions <= 1u);
         }
 
         if (!ret) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfDimensions(OutputSignals, %u) != 0u", signalIndex);
+            REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfDimensions(OutputSignals, %u) > 1u", signalIndex);
         }
 
         if (ret) {
@@ -228,13 +454,36 @@ bool StatisticsGAM::Setup() {
         }
 
         if (ret) {
-            ret = (signalNumberOfElements == 1u);
+            ret = (signalNumberOfElements == numberOfChannels);
+        }
+
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements(OutputSignals, %u) != %u (total number of input elements)", signalIndex, numberOfChannels);
         }
 
+    }
+
+    /* Each quantile requires an output signal after the avg, std, min and max output signals */
+    if ((ret) && (numberOfQuantiles > 0u)) {
+        ret = (GetNumberOfOutputSignals() == (4u + numberOfQuantiles));
+
         if (!ret) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements(OutputSignals, %u) != 1u", signalIndex);
+            REPORT_ERROR(ErrorManagement::InitialisationError, "GetNumberOfOutputSignals() != %u (avg, std, min, max and one for each quantile)", (4u + numberOfQuantiles));
+        }
+    }
+
+    /* The output signals are grouped by window, with the same number of statistics for each window */
+    if ((ret) && (numberOfWindows > 0u)) {
+        numberOfStatistics = GetNumberOfOutputSignals() / numberOfWindows;
+        ret = ((GetNumberOfOutputSignals() % numberOfWindows) == 0u);
+
+        if (ret) {
+            ret = (numberOfStatistics <= 4u);
         }
 
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "GetNumberOfOutputSignals() shall be 1 to 4 (avg, std, min, max) times the %u windows", numberOfWindows);
+        }
     }
 
     /* Instantiate Statistics class */
@@ -246,44 +495,50 @@ bool StatisticsGAM::Setup() {
     /*lint -e{423} no leak as assignment of stats is exclusively done*/
     if (ret) {
         if (signalType == SignedInteger8Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<int8>(windowSize));
+            ret = CreateT<int8>();
         }
         else if (signalType == SignedInteger16Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<int16>(windowSize));
+            ret = CreateT<int16>();
         }
         else if (signalType == SignedInteger32Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<int32>(windowSize));
+            ret = CreateT<int32>();
         }
         else if (signalType == SignedInteger64Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<int64>(windowSize));
+            ret = CreateT<int64>();
         }
         else if (signalType == UnsignedInteger8Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<uint8>(windowSize));
+            ret = CreateT<uint8>();
         }
         else if (signalType == UnsignedInteger16Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<uint16>(windowSize));
+            ret = CreateT<uint16>();
         }
         else if (signalType == UnsignedInteger32Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<uint32>(windowSize));
+            ret = CreateT<uint32>();
         }
         else if (signalType == UnsignedInteger64Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<uint64>(windowSize));
+            ret = CreateT<uint64>();
         }
         else if (signalType == Float32Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<float32>(windowSize));
+            ret = CreateT<float32>();
         }
         else if (signalType == Float64Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<float64>(windowSize));
+            ret = CreateT<float64>();
         }
         else { //NOOP
         }
-        ret = (stats != NULL_PTR(void *));
 
         if (!ret) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "Unsupported type");
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Unable to initialise the quantile estimators");
         }
         else {
-            REPORT_ERROR(ErrorManagement::Information, "Instantiate StatisticsHelperT<> class");
+            ret = (stats != NULL_PTR(void *));
+
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Unsupported type");
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::Information, "Instantiate StatisticsHelperT<> class for %u channels", numberOfChannels);
+            }
         }
 
     }
@@ -341,43 +596,117 @@ bool StatisticsGAM::Execute() {
 template<class Type> bool StatisticsGAM::ExecuteT() {
 
     /*lint -e{665} [MISRA C++ Rule 16-0-6] templated type passed as argument to MACRO*/
-    StatisticsHelperT<Type> * ref = NULL_PTR(StatisticsHelperT<Type> *);
-    Type input = (Type) 0;
-    Type output = (Type) 0;
-
-    bool ret = MemoryOperationsHelper::Copy(&input, GetInputSignalMemory(0u), sizeof(Type));
+    bool ret = (stats != NULL_PTR(void *));
 
-    if (ret) {
-        ret = (stats != NULL_PTR(void *));
+    if ((ret) && (numberOfWindows > 0u)) {
+        ret = ExecuteWindowsT<Type>();
     }
-
-    if (ret) {
-        ref = static_cast<StatisticsHelperT<Type> *>(stats);
-        ret = ref->PushSample(input, infiniteMaxMin);
+    else if (ret) {
+        /* The output signals are only written once every decimationRate cycles */
+        const bool update = (decimationCounter == 0u);
+        decimationCounter++;
+        if (decimationCounter == decimationRate) {
+            decimationCounter = 0u;
+        }
+        StatisticsHelperT<Type> ** ref = static_cast<StatisticsHelperT<Type> **>(stats);
+        const uint32 numberOfOutputSignals = GetNumberOfOutputSignals();
+        Type * const avg = static_cast<Type *>(GetOutputSignalMemory(0u));
+        Type * const std = (numberOfOutputSignals > 1u) ? static_cast<Type *>(GetOutputSignalMemory(1u)) : NULL_PTR(Type *);
+        Type * const min = (numberOfOutputSignals > 2u) ? static_cast<Type *>(GetOutputSignalMemory(2u)) : NULL_PTR(Type *);
+        Type * const max = (numberOfOutputSignals > 3u) ? static_cast<Type *>(GetOutputSignalMemory(3u)) : NULL_PTR(Type *);
+        uint32 channel = 0u;
+        uint32 signalIndex;
+
+        /* All the channels are updated in one pass, channel c of each statistic is at the index c of the respective output */
+        for (signalIndex = 0u; (signalIndex < GetNumberOfInputSignals()) && (ret); signalIndex++) {
+
+            const Type * const input = static_cast<Type *>(GetInputSignalMemory(signalIndex));
+            uint32 elementIndex;
+
+            for (elementIndex = 0u; (elementIndex < numberOfInputElements[signalIndex]) && (ret); elementIndex++) {
+
+                ret = ref[channel]->PushSample(input[elementIndex], infiniteMaxMin);
+
+                if ((ret) && (update)) {
+                    avg[channel] = ref[channel]->GetAvg();
+
+                    if (std != NULL_PTR(Type *)) {
+                        std[channel] = ref[channel]->GetStd();
+                    }
+
+                    if (min != NULL_PTR(Type *)) {
+                        min[channel] = ref[channel]->GetMin();
+                    }
+
+                    if (max != NULL_PTR(Type *)) {
+                        max[channel] = ref[channel]->GetMax();
+                    }
+                }
+
+                if (ret) {
+                    uint32 q;
+                    for (q = 0u; q < numberOfQuantiles; q++) {
+                        StatisticsQuantile &estimator = quantileEstimators[(channel * numberOfQuantiles) + q];
+                        estimator.PushSample(static_cast<float64>(input[elementIndex]));
+                        if (update) {
+                            Type * const quantile = static_cast<Type *>(GetOutputSignalMemory(4u + q));
+                            quantile[channel] = static_cast<Type>(estimator.GetQuantile());
+                        }
+                    }
+                }
+
+                channel++;
+            }
+        }
     }
 
-    if (ret) {
-        output = ref->GetAvg();
-        ret = MemoryOperationsHelper::Copy(GetOutputSignalMemory(0u), &output, sizeof(Type));
-    }
+    return ret;
 
-    if ((ret) && (GetNumberOfOutputSignals() > 1u)) {
-        output = ref->GetStd();
-        ret = MemoryOperationsHelper::Copy(GetOutputSignalMemory(1u), &output, sizeof(Type));
-    }
+}
 
-    if ((ret) && (GetNumberOfOutputSignals() > 2u)) {
-        output = ref->GetMin();
-        ret = MemoryOperationsHelper::Copy(GetOutputSignalMemory(2u), &output, sizeof(Type));
-    }
+template<class Type> bool StatisticsGAM::ExecuteWindowsT() {
 
-    if ((ret) && (GetNumberOfOutputSignals() > 3u)) {
-        output = ref->GetMax();
-        ret = MemoryOperationsHelper::Copy(GetOutputSignalMemory(3u), &output, sizeof(Type));
-    }
+    StatisticsWindowsT<Type> ** windowsRef = static_cast<StatisticsWindowsT<Type> **>(stats);
+    uint32 channel = 0u;
+    uint32 signalIndex;
 
-    return ret;
+    for (signalIndex = 0u; signalIndex < GetNumberOfInputSignals(); signalIndex++) {
+
+        const Type * const input = static_cast<Type *>(GetInputSignalMemory(signalIndex));
+        uint32 elementIndex;
+
+        for (elementIndex = 0u; elementIndex < numberOfInputElements[signalIndex]; elementIndex++) {
+
+            /* The output signals are only written when the block (of decimationRate samples) is completed */
+            if (windowsRef[channel]->PushSample(input[elementIndex])) {
+                uint32 w;
+                for (w = 0u; w < numberOfWindows; w++) {
+                    const uint32 firstSignal = w * numberOfStatistics;
+                    Type * const avg = static_cast<Type *>(GetOutputSignalMemory(firstSignal));
+                    avg[channel] = windowsRef[channel]->GetAvg(w);
+
+                    if (numberOfStatistics > 1u) {
+                        Type * const std = static_cast<Type *>(GetOutputSignalMemory(firstSignal + 1u));
+                        std[channel] = windowsRef[channel]->GetStd(w);
+                    }
+
+                    if (numberOfStatistics > 2u) {
+                        Type * const min = static_cast<Type *>(GetOutputSignalMemory(firstSignal + 2u));
+                        min[channel] = windowsRef[channel]->GetMin(w);
+                    }
+
+                    if (numberOfStatistics > 3u) {
+                        Type * const max = static_cast<Type *>(GetOutputSignalMemory(firstSignal + 3u));
+                        max[channel] = windowsRef[channel]->GetMax(w);
+                    }
+                }
+            }
+
+            channel++;
+        }
+    }
 
+    return true;
 }
 
 /*lint -e{613} Reset() method called only when stats is not NULL*/
@@ -391,59 +720,50 @@ bool StatisticsGAM::PrepareNextState(const char8 * const currentStateName,
     if (ret) {
 
         if (signalType == SignedInteger8Bit) {
-            StatisticsHelperT<int8> * ref = static_cast<StatisticsHelperT<int8> *>(stats);
-            ret = ref->Reset();
+            ret = ResetT<int8>();
         }
 
         if (signalType == SignedInteger16Bit) {
-            StatisticsHelperT<int16> * ref = static_cast<StatisticsHelperT<int16> *>(stats);
-            ret = ref->Reset();
+            ret = ResetT<int16>();
         }
 
         if (signalType == SignedInteger32Bit) {
-            StatisticsHelperT<int32> * ref = static_cast<StatisticsHelperT<int32> *>(stats);
-            ret = ref->Reset();
+            ret = ResetT<int32>();
         }
 
         if (signalType == SignedInteger64Bit) {
-            StatisticsHelperT<int64> * ref = static_cast<StatisticsHelperT<int64> *>(stats);
-            ret = ref->Reset();
+            ret = ResetT<int64>();
         }
 
         if (signalType == UnsignedInteger8Bit) {
-            StatisticsHelperT<uint8> * ref = static_cast<StatisticsHelperT<uint8> *>(stats);
-            ret = ref->Reset();
+            ret = ResetT<uint8>();
         }
 
         if (signalType == UnsignedInteger16Bit) {
-            StatisticsHelperT<uint16> * ref = static_cast<StatisticsHelperT<uint16> *>(stats);
-            ret = ref->Reset();
+            ret = ResetT<uint16>();
         }
 
         if (signalType == UnsignedInteger32Bit) {
-            StatisticsHelperT<uint32> * ref = static_cast<StatisticsHelperT<uint32> *>(stats);
-            ret = ref->Reset();
+            ret = ResetT<uint32>();
         }
 
         if (signalType == UnsignedInteger64Bit) {
-            StatisticsHelperT<uint64> * ref = static_cast<StatisticsHelperT<uint64> *>(stats);
-            ret = ref->Reset();
+            ret = ResetT<uint64>();
         }
 
         if (signalType == Float32Bit) {
-            StatisticsHelperT<float32> * ref = static_cast<StatisticsHelperT<float32> *>(stats);
-            ret = ref->Reset();
+            ret = ResetT<float32>();
         }
 
         if (signalType == Float64Bit) {
-            StatisticsHelperT<float64> * ref = static_cast<StatisticsHelperT<float64> *>(stats);
-            ret = ref->Reset();
+            ret = ResetT<float64>();
         }
 
+        decimationCounter = 0u;
     }
 
     if (ret) {
-        REPORT_ERROR(ErrorManagement::Information, "Reset StatisticsHelperT<> instance");
+        REPORT_ERROR(ErrorManagement::Information, "Reset StatisticsHelperT<> instances");
     }
 
     return ret;
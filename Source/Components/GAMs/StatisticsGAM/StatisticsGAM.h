@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "GAM.h"
+#include "StatisticsQuantile.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -42,13 +43,20 @@ namespace MARTe {
 
 /**
  * @brief GAM which provides average, standard deviation, minimum and maximum of
- * its input signal over a moving time window.
+ * its input signals over a moving time window.
  * @details This GAM provides the average, standard deviation, minimum and maximum
- * of its input signal over a moving time window. 
- * The GAM accepts any type of scalar
- * input signal, i.e. (u)int8, (u)int16, (uint32), (u)int64, float32 and float64, and
+ * of its input signals over a moving time window. 
+ * The GAM accepts any type of scalar or
+ * array input signals, i.e. (u)int8, (u)int16, (uint32), (u)int64, float32 and float64, and
  * produces the statistics computation in the same native type. As such, the output
- * signals are required to conform to the type of the input signal.
+ * signals are required to conform to the type of the input signals.
+ *
+ * Each element of each input signal is an independent channel, with its own moving
+ * window. The channels are numbered in the order of the input signals and of their
+ * elements, and each output signal (i.e. each statistic) is an array with one element
+ * per channel. All the channels are updated in one Execute(), so that supervising many
+ * signals requires only one instance of the GAM. With one scalar input signal, the
+ * output signals are scalar.
  *
  * The configuration syntax is (names and signal quantity are only given as an example):
  * <pre>
@@ -60,6 +68,17 @@ namespace MARTe {
  *     StartCycleNumber = 0u // Optional - Defaults to 0. GAM cycles to skip before starting the accumulation.
  *     InfiniteMaxMin = 0u // Optional - Defaults to 0 (false). If true, Max and Min are referred to the GAM lifecycle (until reset).
  *                            If false, Max and Min are referred only to the Sliding Window.
+ *     Accumulator = Compensated // Optional - Defaults to Standard. Standard keeps the sums of the samples and of the
+ *                                  squared samples in the signal type. Compensated keeps the average and the sum of squared
+ *                                  deviations in float64 (Welford update with Kahan summation), which does not lose precision
+ *                                  for float32 signals over long windows nor overflow for narrow integer types.
+ *     Quantiles = { 0.5 0.99 } // Optional - Quantiles (0 < q < 1) to be estimated over consecutive (non-overlapping) windows
+ *                                 of WindowSize samples with the P-square algorithm, i.e. without storing nor sorting the
+ *                                 samples. Each quantile requires an output signal after the _max signal, in the same order.
+ *     DecimationRate = 10 // Optional - Defaults to 1. The output signals are updated only once every DecimationRate cycles
+ *                            (the statistics are still computed with all the samples).
+ *     Windows = { 10 100 1000 } // Optional - Computes the statistics over each of these moving windows (in samples, multiples of
+ *                                  DecimationRate and in increasing order) instead of WindowSize, see below.
  *     InputSignals = {
  *         ExecutionTime = {
  *             DataSource = "DDB"
@@ -84,10 +103,64 @@ namespace MARTe {
  *             DataSource = "DDB"
  *             Type = uint64
  *         }
+ *         ExecutionTime_p50 = {  // Only if Quantiles is set, constrained to having added the _max signal before.
+ *             DataSource = "DDB" // The quantile of the last complete window (or of the samples of the current
+ *             Type = uint64      // window until the first window is complete).
+ *         }
+ *         ExecutionTime_p99 = {
+ *             DataSource = "DDB"
+ *             Type = uint64
+ *         }
  *     }
  * }
  * </pre>
  *
+ * Example with 4 channels (the output signals have 4 elements):
+ * <pre>
+ *     InputSignals = {
+ *         Current = {
+ *             DataSource = "DDB"
+ *             Type = float32
+ *         }
+ *         Voltages = {
+ *             DataSource = "DDB"
+ *             Type = float32
+ *             NumberOfDimensions = 1
+ *             NumberOfElements = 3
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Channels_avg = {
+ *             DataSource = "DDB"
+ *             Type = float32
+ *             NumberOfDimensions = 1
+ *             NumberOfElements = 4 // {Current Voltages[0] Voltages[1] Voltages[2]}
+ *         }
+ *     }
+ * </pre>
+ *
+ * If Windows is set the samples are not stored: each block of DecimationRate samples of a channel is reduced to a summary
+ * (average, sum of squared deviations, minimum and maximum) and the statistics of all the windows are rebuilt from the
+ * summaries of the last blocks, the longer windows combining the shorter ones, when the block is completed
+ * (see StatisticsWindowsT). The output signals are then updated at the end of each block and are grouped by window,
+ * i.e. {W1_avg W1_std ... W2_avg W2_std ...}, with the same number (1 to 4) of statistics for each window.
+ * The statistics are computed in float64, WindowSize, Accumulator and InfiniteMaxMin are not used and Quantiles is not supported.
+ * <pre>
+ *     DecimationRate = 10
+ *     Windows = { 10 100 1000 }
+ *     OutputSignals = {
+ *         ExecutionTime_avg10 = {
+ *             DataSource = "DDB"
+ *             Type = uint64
+ *         }
+ *         ExecutionTime_max10 = { // Each window has (avg, std, min, max) or a prefix of it
+ *             ...
+ *         }
+ *         ExecutionTime_avg100 = {
+ *             ...
+ *     }
+ * </pre>
+ *
  * \b TODO Receive inputs signal depth in lieu of storing history internally.
  *
  * \b TODO Since the RMS is the native computed value being the STD, it can be promoted
@@ -107,6 +180,10 @@ public:
      *   signalType = InvalidType
      *   stats = NULL_PTR(void *)
      *   windowSize = 1024
+     *   numberOfChannels = 0
+     *   numberOfQuantiles = 0
+     *   decimationRate = 1
+     *   numberOfWindows = 0
      */
     StatisticsGAM();
 
@@ -123,27 +200,34 @@ public:
     virtual bool Initialise(StructuredDataI & data);
 
     /**
-     * @brief Verifies all signals have the same scalar type.
+     * @brief Verifies all signals have the same type and the output signals one element per channel.
      * @return if the pre-conditions are met.
      * @pre
      *   SetConfiguredDatabase() && GetNumberOfInputSignals() > 0 &&
      *   GetNumberOfOutputSignals() > 0 &&
-     *   All signals are scalar and share the same type.
+     *   numberOfQuantiles == 0 || GetNumberOfOutputSignals() == 4 + numberOfQuantiles &&
+     *   numberOfWindows == 0 || (GetNumberOfOutputSignals() % numberOfWindows == 0 && GetNumberOfOutputSignals() <= 4 * numberOfWindows) &&
+     *   All signals are scalar or one dimensional arrays and share the same type &&
+     *   The number of elements of each output signal is the total number of elements of the input signals.
      * @post 
-     *   stats = (void*) new StatisticsHelperT<signalType> (windowSize);
+     *   stats = (void*) new StatisticsHelperT<signalType> *[numberOfChannels] and one
+     *   new StatisticsHelperT<signalType> (windowSize, compensated) for each channel
+     *   (or new StatisticsWindowsT<signalType> (decimationRate, windowSizes, numberOfWindows) if numberOfWindows > 0);
+     *   quantileEstimators = new StatisticsQuantile[numberOfChannels * numberOfQuantiles];
      */
     virtual bool Setup();
 
     /**
-     * @brief Execute method. Statistical computation of the input signal.
+     * @brief Execute method. Statistical computation of the input signals.
      * @details Delegates execution of the statistical computation and update
-     * of the output signals to the Execute<signaType> method.
+     * of the output signals of all the channels to the Execute<signaType> method.
+     * The output signals are written only once every DecimationRate cycles.
      * @return true.
      */
     virtual bool Execute();
 
     /**
-     * @brief Resets the sample history buffer.
+     * @brief Resets the sample history buffers (or the block summaries), the quantile estimators of all the channels and the decimation.
      * @return true.
      */
     virtual bool PrepareNextState(const char8 * const currentStateName,
@@ -151,13 +235,24 @@ public:
 
   private:
     /**
-     * @brief The reference to the statistics computation templated class.
-     * @details The void * stores the reference to the StatisticsHelperT<>
-     * instance which is created with the Setup() method. This attribute
-     * requires a static_cast<StatisticsHelperT<signalType> *> before use.
+     * @brief The references to the statistics computation templated class.
+     * @details The void * stores the array of references to the StatisticsHelperT<>
+     * instances (one for each channel) which are created with the Setup() method. This attribute
+     * requires a static_cast<StatisticsHelperT<signalType> **> before use, or a static_cast<StatisticsWindowsT<signalType> **>
+     * if numberOfWindows > 0.
      */
     void * stats;
 
+    /**
+     * @brief The total number of elements of the input signals.
+     */
+    uint32 numberOfChannels;
+
+    /**
+     * @brief The number of elements of each input signal.
+     */
+    uint32 * numberOfInputElements;
+
     /**
      * @brief The common signal type attribute.
      */
@@ -169,11 +264,79 @@ public:
     uint32 windowSize;
 
     /**
-     * @brief Templated Execute method. Statistical computation of the input signal.
+     * @brief True if the compensated accumulators are used.
+     */
+    bool compensated;
+
+    /**
+     * @brief The quantiles to be estimated.
+     */
+    float64 * quantiles;
+
+    /**
+     * @brief The number of quantiles to be estimated.
+     */
+    uint32 numberOfQuantiles;
+
+    /**
+     * @brief The quantile estimators, numberOfQuantiles for each channel.
+     */
+    StatisticsQuantile * quantileEstimators;
+
+    /**
+     * @brief The output signals are updated once every decimationRate cycles (and the block size of the windows).
+     */
+    uint32 decimationRate;
+
+    /**
+     * @brief The number of cycles since the last update of the output signals.
+     */
+    uint32 decimationCounter;
+
+    /**
+     * @brief The sizes of the windows (if Windows is set).
+     */
+    uint32 * windowSizes;
+
+    /**
+     * @brief The number of windows (0 if Windows is not set).
+     */
+    uint32 numberOfWindows;
+
+    /**
+     * @brief The number of statistics (avg, std, min, max) of each window.
+     */
+    uint32 numberOfStatistics;
+
+    /**
+     * @brief Templated Execute method. Statistical computation of all the channels.
      * @return true.
      */
     template <typename Type> bool ExecuteT();
 
+    /**
+     * @brief Templated Execute method with Windows. Statistical computation of all the channels over all the windows.
+     * @return true.
+     */
+    template <typename Type> bool ExecuteWindowsT();
+
+    /**
+     * @brief Creates the StatisticsHelperT<> (or StatisticsWindowsT<>) instances and the quantile estimators of all the channels.
+     * @return true if the quantile estimators were initialised.
+     */
+    template <typename Type> bool CreateT();
+
+    /**
+     * @brief Deletes the StatisticsHelperT<> (or StatisticsWindowsT<>) instances of all the channels.
+     */
+    template <typename Type> void DeleteT();
+
+    /**
+     * @brief Resets the StatisticsHelperT<> (or StatisticsWindowsT<>) instances of all the channels.
+     * @return true if all the instances were reset.
+     */
+    template <typename Type> bool ResetT();
+
     /**
      * Start computing the statistics only after startCycleNumber cycles.
      */
@@ -49,10 +49,12 @@ namespace MARTe {
  * @details The class allocates circular buffers to store values of samples and
  * computes average, standard deviation, minimum and maximum over a moving time
  * window. As such, the sum of samples and sum of squares is computed upon calling
- * the PushSample() method in a way to minimise operations. The minimum or maximum
- * over the historical buffer are re-computed only when needed, i.e. in case the
- * oldest sample being pushed out of the moving time window is equal to the stored
- * minimum or maximum.
+ * the PushSample() method in a way to minimise operations. The minimum and maximum
+ * over the moving time window are maintained with two monotonic queues of candidates
+ * (i.e. the samples which are not older and smaller, respectively larger, than another
+ * sample of the window), so that each PushSample() is amortised O(1): every sample is
+ * inserted and removed at most once from each queue and the historical buffer is never
+ * parsed.
  * The implementation does not perform division, rather uses bit shift operation
  * for integer types, and pre-computes 1.0 / size for floating point types. As such,
  * the computation of average and standard deviation is only exact after the window
@@ -61,6 +63,12 @@ namespace MARTe {
  * of 2, e.g. 64, 1024, etc. In case a different window size is specified, the
  * highest power of 2 smaller than the specified size is being considered. No
  * limitation for floating point types.
+ * The sums of samples and of squared samples lose precision for float32 samples over long
+ * windows and overflow for narrow integer types. If the instance is constructed with
+ * compensated = true the average and the sum of squared deviations from the average are
+ * instead maintained as float64 with a sliding window Welford update, Kahan-compensated,
+ * and the accessors derive the average, standard deviation, rms and sum from these
+ * accumulators (converted to Type). The minimum and maximum are not affected.
  */
 
 /*lint -e{1712} the implementation does not provide default constructor*/
@@ -74,8 +82,11 @@ public:
      * @details Allocates memory buffers to store samples, and squares of, in a moving
      * time window. In case of integer types, the actual window size will be the highest
      * power of 2 smaller or equal to the specified size.
+     * @param[in] windowSize the size of the moving time window.
+     * @param[in] compensatedAccumulator true to use the compensated (Welford/Kahan) accumulators.
      */
-    StatisticsHelperT(const uint32 windowSize);
+    StatisticsHelperT(const uint32 windowSize,
+                      const bool compensatedAccumulator = false);
 
     /**
      * @brief Destructor. Frees allocated memory buffers.
@@ -93,14 +104,18 @@ public:
      * @details The method inserts the sample in the historical buffer and re-computes the
      * sum of samples over the time window with two operations, i.e. to remove the oldest
      * sample leaving the buffer from the cumulative sum before adding the new one.
-     * The minimum and maximum sample attributes are changed if the newly inserted sample
-     * is respectively smaller or higher than the currently stored minimum or maximum. The
-     * historical buffer is fully parsed in case the oldest sample leaving the buffer is
-     * equal to the recorded minimum or maximum.
+     * The candidates to the maximum (minimum) which are smaller (larger) than or equal to
+     * the newly inserted sample are removed from the back of the respective queue, the
+     * candidate leaving the time window is removed from the front and the sample is appended.
+     * The minimum and maximum are then the front of the queues. If infiniteMaxMin is true
+     * the minimum and maximum are instead changed only if the newly inserted sample is
+     * respectively smaller or higher than the currently stored minimum or maximum.
      * The new sample is also squared and inserted into a second buffer, with similar sum
      * management.
      * The average, root mean square, and standard deviation are only computed when the
      * corresponding accessors are being called.
+     * With the compensated accumulators the sums are not updated, rather the float64 average
+     * and the sum of squared deviations are updated replacing the oldest sample with the new one.
      * @return true if buffer was properly allocated.
      */
     bool PushSample(Type sample,
@@ -180,6 +195,12 @@ public:
      */
     Type GetSum(void) const;
 
+    /**
+     * @brief Accessor. Returns true if the compensated accumulators are used.
+     * @return true if the compensated accumulators are used.
+     */
+    bool IsCompensated(void) const;
+
 private:
 
     /**
@@ -237,6 +258,81 @@ private:
      */
     CircularStaticList<Type> * Xsq;
 
+    /**
+     * Sequence number of the next sample (modulo 2^32)
+     */
+    uint32 sequence;
+
+    /**
+     * Values of the candidates to the maximum (decreasing from the front)
+     */
+    Type *maxValues;
+
+    /**
+     * Sequence numbers of the candidates to the maximum
+     */
+    uint32 *maxIndexes;
+
+    /**
+     * Position of the front candidate to the maximum
+     */
+    uint32 maxFirst;
+
+    /**
+     * Number of candidates to the maximum
+     */
+    uint32 maxCount;
+
+    /**
+     * Values of the candidates to the minimum (increasing from the front)
+     */
+    Type *minValues;
+
+    /**
+     * Sequence numbers of the candidates to the minimum
+     */
+    uint32 *minIndexes;
+
+    /**
+     * Position of the front candidate to the minimum
+     */
+    uint32 minFirst;
+
+    /**
+     * Number of candidates to the minimum
+     */
+    uint32 minCount;
+
+    /**
+     * True if the compensated accumulators are used
+     */
+    bool compensated;
+
+    /**
+     * Pre-computed 1.0 / size for the compensated accumulators
+     */
+    float64 Wdiv;
+
+    /**
+     * Compensated average over the time window
+     */
+    float64 Wmean;
+
+    /**
+     * Kahan compensation of Wmean
+     */
+    float64 WmeanC;
+
+    /**
+     * Compensated sum of squared deviations from the average over the time window
+     */
+    float64 Wm2;
+
+    /**
+     * Kahan compensation of Wm2
+     */
+    float64 Wm2C;
+
     /**
      * @brief Average of squared samples over the moving window.
      * @return average of sample squares.
@@ -244,27 +340,88 @@ private:
     Type GetRmsSq(void) const;
 
     /**
-     * @brief Finds the maximum of samples in the sample buffer.
-     * @return maximum.
+     * @brief Inserts the sample in a queue of candidates to the maximum or to the minimum.
+     * @details Removes from the back the candidates which are dominated by the sample (i.e. smaller than or equal
+     * to the sample if isMax, larger than or equal otherwise), removes from the front the candidate which left the
+     * time window and appends the sample.
+     * @param[in,out] values the values of the candidates (ring buffer of size elements).
+     * @param[in,out] indexes the sequence number of the candidates (ring buffer of size elements).
+     * @param[in,out] first the position of the front candidate in the ring buffers.
+     * @param[in,out] count the number of candidates.
+     * @param[in] sample the sample to be inserted.
+     * @param[in] isMax true for the queue of the maximum, false for the queue of the minimum.
+     * @return the front candidate, i.e. the maximum or minimum over the time window.
      */
-    Type FindMax(void) const;
+    Type PushCandidate(Type * const values,
+                       uint32 * const indexes,
+                       uint32 &first,
+                       uint32 &count,
+                       const Type sample,
+                       const bool isMax) const;
 
     /**
-     * @brief Finds the minimum of samples in the sample buffer.
-     * @return maximum.
+     * @brief Empties the queues of candidates to the maximum and to the minimum.
+     */
+    void ResetCandidates(void);
+
+    /**
+     * @brief Clears the compensated accumulators.
      */
-    Type FindMin(void) const;
+    void ResetCompensated(void);
+
+    /**
+     * @brief Kahan summation of value into sum.
+     * @param[in,out] sum the accumulator.
+     * @param[in,out] compensation the running compensation of the accumulator.
+     * @param[in] value the value to be added.
+     */
+    static void KahanAdd(float64 &sum,
+                         float64 &compensation,
+                         const float64 value);
+
+    /**
+     * @brief Compensated variance over the time window.
+     * @return the variance, never negative.
+     */
+    float64 GetCompensatedVariance(void) const;
 };
 
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+template<typename Type> void StatisticsHelperT<Type>::ResetCandidates() {
+    sequence = 0u;
+    maxFirst = 0u;
+    maxCount = 0u;
+    minFirst = 0u;
+    minCount = 0u;
+}
+
+template<typename Type> void StatisticsHelperT<Type>::ResetCompensated() {
+    Wdiv = 1.0 / static_cast<float64>(size);
+    Wmean = 0.0;
+    WmeanC = 0.0;
+    Wm2 = 0.0;
+    Wm2C = 0.0;
+}
+
+template<typename Type> void StatisticsHelperT<Type>::KahanAdd(float64 &sum,
+                                                               float64 &compensation,
+                                                               const float64 value) {
+    float64 y = value - compensation;
+    float64 t = sum + y;
+    compensation = (t - sum) - y;
+    sum = t;
+}
+
 /*lint -e{9117} [MISRA C++ Rule 5-0-4] signedness of 0 ignored in template method to avoid specializing for all integer types*/
 template<typename Type> bool StatisticsHelperT<Type>::Reset() {
 
     /* Reset attributes */
     counter = 0u;
+    ResetCandidates();
+    ResetCompensated();
 
     Xspl = 0;
     Xavg = 0;
@@ -295,6 +452,8 @@ template<> inline bool StatisticsHelperT<float32>::Reset() { // Must be declared
 
     /* Reset attributes */
     counter = 0u;
+    ResetCandidates();
+    ResetCompensated();
 
     Xspl = 0.0F;
     Xavg = 0.0F;
@@ -324,6 +483,8 @@ template<> inline bool StatisticsHelperT<float64>::Reset() { // Must be declared
 
     /* Reset attributes */
     counter = 0u;
+    ResetCandidates();
+    ResetCompensated();
 
     Xspl = 0.0;
     Xavg = 0.0;
@@ -350,8 +511,10 @@ template<> inline bool StatisticsHelperT<float64>::Reset() { // Must be declared
 /*lint -e{9117} [MISRA C++ Rule 5-0-4] signedness of 0 and 1 ignored in template method to avoid specialising for all integer types*/
 /*lint -e{1732} no assignment ever used */
 /*lint -e{1733} no assignment ever used */
-template<typename Type> StatisticsHelperT<Type>::StatisticsHelperT(const uint32 windowSize) {
+template<typename Type> StatisticsHelperT<Type>::StatisticsHelperT(const uint32 windowSize,
+                                                                   const bool compensatedAccumulator) {
 
+    compensated = compensatedAccumulator;
     size = 1u;
     Xdiv = 0;
 
@@ -366,6 +529,10 @@ template<typename Type> StatisticsHelperT<Type>::StatisticsHelperT(const uint32
     /* Instantiate sample buffers */
     Xwin = new CircularStaticList<Type>(size);
     Xsq = new CircularStaticList<Type>(size);
+    maxValues = new Type[size];
+    maxIndexes = new uint32[size];
+    minValues = new Type[size];
+    minIndexes = new uint32[size];
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -396,14 +563,20 @@ template<typename Type> StatisticsHelperT<Type>::StatisticsHelperT(const uint32
 /*lint -e{1566} initialisation of the attributes in the Reset() method*/
 /*lint -e{1732} no assignment ever used */
 /*lint -e{1733} no assignment ever used */
-template<> inline StatisticsHelperT<float32>::StatisticsHelperT(const uint32 windowSize) {
+template<> inline StatisticsHelperT<float32>::StatisticsHelperT(const uint32 windowSize,
+                                                          const bool compensatedAccumulator) {
 
+    compensated = compensatedAccumulator;
     size = windowSize;
     Xdiv = 1.0F / static_cast<float32>(size);
 
     /* Instantiate sample buffers */
     Xwin = new CircularStaticList<float32>(size);
     Xsq = new CircularStaticList<float32>(size);
+    maxValues = new float32[size];
+    maxIndexes = new uint32[size];
+    minValues = new float32[size];
+    minIndexes = new uint32[size];
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -417,14 +590,20 @@ template<> inline StatisticsHelperT<float32>::StatisticsHelperT(const uint32 win
 /*lint -e{1566} initialisation of the attributes in the Reset() method*/
 /*lint -e{1732} no assignment ever used */
 /*lint -e{1733} no assignment ever used */
-template<> inline StatisticsHelperT<float64>::StatisticsHelperT(const uint32 windowSize) {
+template<> inline StatisticsHelperT<float64>::StatisticsHelperT(const uint32 windowSize,
+                                                          const bool compensatedAccumulator) {
 
+    compensated = compensatedAccumulator;
     size = windowSize;
     Xdiv = 1.0 / static_cast<float64>(size);
 
     /* Instantiate sample buffers */
     Xwin = new CircularStaticList<float64>(size);
     Xsq = new CircularStaticList<float64>(size);
+    maxValues = new float64[size];
+    maxIndexes = new uint32[size];
+    minValues = new float64[size];
+    minIndexes = new uint32[size];
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -446,89 +625,70 @@ template<typename Type> StatisticsHelperT<Type>::~StatisticsHelperT() {
         Xsq = NULL_PTR(CircularStaticList<Type> *);
     }
 
-}
-
-/*lint -e{534} ignore return value of GetData since initialisation error would have been caught earlier*/
-template<typename Type> Type StatisticsHelperT<Type>::FindMax() const {
-
-    Type max = std::numeric_limits<Type>::min();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
+    if (maxValues != NULL_PTR(Type *)) {
+        delete[] maxValues;
+        maxValues = NULL_PTR(Type *);
+    }
 
-        Type sample;
+    if (maxIndexes != NULL_PTR(uint32 *)) {
+        delete[] maxIndexes;
+        maxIndexes = NULL_PTR(uint32 *);
+    }
 
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
+    if (minValues != NULL_PTR(Type *)) {
+        delete[] minValues;
+        minValues = NULL_PTR(Type *);
+    }
 
-        if (sample > max) {
-            max = sample;
-        }
+    if (minIndexes != NULL_PTR(uint32 *)) {
+        delete[] minIndexes;
+        minIndexes = NULL_PTR(uint32 *);
     }
 
-    return max;
 }
 
-template<> inline float32 StatisticsHelperT<float32>::FindMax() const { // Must be declared/defined before use
-
-    float32 max = -1.0F * std::numeric_limits<float32>::max();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
-
-        float32 sample;
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
-
-        if (sample > max) {
-            max = sample;
+template<typename Type> Type StatisticsHelperT<Type>::PushCandidate(Type * const values,
+                                                                    uint32 * const indexes,
+                                                                    uint32 &first,
+                                                                    uint32 &count,
+                                                                    const Type sample,
+                                                                    const bool isMax) const {
+
+    /* Remove the candidates dominated by the new sample */
+    bool dominated = (count > 0u);
+    while (dominated) {
+        uint32 last = first + count - 1u;
+        if (last >= size) {
+            last -= size;
+        }
+        dominated = isMax ? (values[last] <= sample) : (values[last] >= sample);
+        if (dominated) {
+            count--;
+            dominated = (count > 0u);
         }
     }
 
-    return max;
-}
-
-template<> inline float64 StatisticsHelperT<float64>::FindMax() const { // Must be declared/defined before use
-
-    float64 max = -1.0 * std::numeric_limits<float64>::max();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
-
-        float64 sample;
-
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
-
-        if (sample > max) {
-            max = sample;
+    /* Remove the candidate which left the time window (at most one per sample) */
+    if (count > 0u) {
+        if ((sequence - indexes[first]) >= size) {
+            first++;
+            if (first == size) {
+                first = 0u;
+            }
+            count--;
         }
     }
 
-    return max;
-}
-
-template<typename Type> Type StatisticsHelperT<Type>::FindMin() const {
-
-    Type min = std::numeric_limits<Type>::max();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
-
-        Type sample;
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
-
-        if (sample < min) {
-            min = sample;
-        }
+    /* Append the new sample */
+    uint32 next = first + count;
+    if (next >= size) {
+        next -= size;
     }
+    values[next] = sample;
+    indexes[next] = sequence;
+    count++;
 
-    return min;
+    return values[first];
 }
 
 template<typename Type> bool StatisticsHelperT<Type>::PushSample(Type sample,
@@ -550,37 +710,48 @@ template<typename Type> bool StatisticsHelperT<Type>::PushSample(Type sample,
     }
 
     if (ok) {
-        /* Compute average */
-        Xavg -= oldest; /* Remove oldest sample from the accumulator */
-        Xavg += Xspl; /* Sum of all sample in time window */
-
-        /* Update max/min, if necessary */
-        if (Xspl > Xmax) {
-            Xmax = Xspl;
+        if (compensated) {
+            /* Sliding window Welford update replacing the oldest sample with the new one */
+            float64 xn = static_cast<float64>(Xspl);
+            float64 xo = static_cast<float64>(oldest);
+            float64 oldMean = Wmean;
+            KahanAdd(Wmean, WmeanC, (xn - xo) * Wdiv);
+            KahanAdd(Wm2, Wm2C, (xn - xo) * ((xn - Wmean) + (xo - oldMean)));
         }
-
-        if (Xspl < Xmin) {
-            Xmin = Xspl;
+        else {
+            /* Compute average */
+            Xavg -= oldest; /* Remove oldest sample from the accumulator */
+            Xavg += Xspl; /* Sum of all sample in time window */
         }
 
-        if(!infiniteMaxMin) {
-            if (oldest == Xmax) { /* The removed sample was the max over the time window */
-                Xmax = FindMax();
+        /* Update max/min over the time window */
+        Type windowMax = PushCandidate(maxValues, maxIndexes, maxFirst, maxCount, Xspl, true);
+        Type windowMin = PushCandidate(minValues, minIndexes, minFirst, minCount, Xspl, false);
+        sequence++;
+
+        if (infiniteMaxMin) {
+            if (Xspl > Xmax) {
+                Xmax = Xspl;
             }
-            if (oldest == Xmin) { /* The removed sample was the min over the time window */
-                Xmin = FindMin();
+
+            if (Xspl < Xmin) {
+                Xmin = Xspl;
             }
         }
+        else {
+            Xmax = windowMax;
+            Xmin = windowMin;
+        }
     }
 
     Type Xspl_sq = Xspl * Xspl; /* Square of the sample */
 
     /* Update sample buffer */
-    if (ok) {
+    if ((ok) && (!compensated)) {
         ok = Xsq->PushData(Xspl_sq, oldest);
     }
 
-    if (ok) {
+    if ((ok) && (!compensated)) {
         /* Compute root mean square */
         Xrms -= oldest; /* Remove oldest sample from the accumulator */
         Xrms += Xspl_sq; /* Sum of squares of all samples in time window */
@@ -615,7 +786,7 @@ template<typename Type> uint32 StatisticsHelperT<Type>::GetCounter() const {
 
 template<typename Type> Type StatisticsHelperT<Type>::GetAvg() const {
 
-    Type avg = Xavg >> Xdiv;
+    Type avg = compensated ? static_cast<Type>(Wmean) : (Xavg >> Xdiv);
 
     return avg;
 }
@@ -625,7 +796,7 @@ template<typename Type> Type StatisticsHelperT<Type>::GetAvg() const {
  */
 template<> inline float32 StatisticsHelperT<float32>::GetAvg() const {
 
-    float32 avg = Xavg * Xdiv;
+    float32 avg = compensated ? static_cast<float32>(Wmean) : (Xavg * Xdiv);
 
     return avg;
 }
@@ -635,7 +806,7 @@ template<> inline float32 StatisticsHelperT<float32>::GetAvg() const {
  */
 template<> inline float64 StatisticsHelperT<float64>::GetAvg() const {
 
-    float64 avg = Xavg * Xdiv;
+    float64 avg = compensated ? Wmean : (Xavg * Xdiv);
 
     return avg;
 }
@@ -661,11 +832,25 @@ template<> inline float64 StatisticsHelperT<float64>::GetRmsSq() const {
     return rms_sq;
 }
 
+template<typename Type> float64 StatisticsHelperT<Type>::GetCompensatedVariance() const {
+
+    float64 variance = Wm2 * Wdiv;
+
+    return (variance > 0.0) ? variance : 0.0;
+}
+
 template<typename Type> Type StatisticsHelperT<Type>::GetRms() const {
 
-    Type rms_sq = GetRmsSq();
+    Type rms;
 
-    Type rms = (rms_sq>0)?(FastMath::SquareRoot<Type>(rms_sq)):(0);
+    if (compensated) {
+        float64 rms_sq = (Wmean * Wmean) + GetCompensatedVariance();
+        rms = static_cast<Type>(FastMath::SquareRoot<float64>(rms_sq));
+    }
+    else {
+        Type rms_sq = GetRmsSq();
+        rms = (rms_sq>0)?(FastMath::SquareRoot<Type>(rms_sq)):(0);
+    }
 
     return rms;
 
@@ -673,17 +858,28 @@ template<typename Type> Type StatisticsHelperT<Type>::GetRms() const {
 
 template<typename Type> Type StatisticsHelperT<Type>::GetStd() const {
 
-    Type avg = GetAvg();
-    Type avg_sq = avg * avg;
-    Type rms_sq = GetRmsSq();
-    Type std = ((rms_sq - avg_sq)>0)?(FastMath::SquareRoot<Type>(rms_sq - avg_sq)):(0);
+    Type std;
+
+    if (compensated) {
+        std = static_cast<Type>(FastMath::SquareRoot<float64>(GetCompensatedVariance()));
+    }
+    else {
+        Type avg = GetAvg();
+        Type avg_sq = avg * avg;
+        Type rms_sq = GetRmsSq();
+        std = ((rms_sq - avg_sq)>0)?(FastMath::SquareRoot<Type>(rms_sq - avg_sq)):(0);
+    }
 
     return std;
 
 }
 
 template<typename Type> Type StatisticsHelperT<Type>::GetSum() const {
-    return Xavg;
+    return compensated ? static_cast<Type>(Wmean * static_cast<float64>(size)) : Xavg;
+}
+
+template<typename Type> bool StatisticsHelperT<Type>::IsCompensated() const {
+    return compensated;
 }
 
 template<typename Type> Type StatisticsHelperT<Type>::GetMax() const {
@@ -0,0 +1,200 @@
+/**
+ * @file StatisticsQuantile.cpp
+ * @brief Source file for class StatisticsQuantile
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class StatisticsQuantile (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "StatisticsQuantile.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+StatisticsQuantile::StatisticsQuantile() {
+    p = 0.5;
+    size = 1u;
+    Reset();
+}
+
+StatisticsQuantile::~StatisticsQuantile() {
+
+}
+
+bool StatisticsQuantile::Initialise(const float64 probability,
+                                    const uint32 windowSize) {
+    bool ok = (probability > 0.0) && (probability < 1.0) && (windowSize > 0u);
+    if (ok) {
+        p = probability;
+        size = windowSize;
+        Reset();
+    }
+    return ok;
+}
+
+void StatisticsQuantile::Reset() {
+    counter = 0u;
+    lastQuantile = 0.0;
+    lastQuantileValid = false;
+    uint32 i;
+    for (i = 0u; i < statisticsQuantileMarkers; i++) {
+        heights[i] = 0.0;
+        positions[i] = 0.0;
+        desiredPositions[i] = 0.0;
+    }
+    increments[0u] = 0.0;
+    increments[1u] = p / 2.0;
+    increments[2u] = p;
+    increments[3u] = (1.0 + p) / 2.0;
+    increments[4u] = 1.0;
+}
+
+float64 StatisticsQuantile::Parabolic(const uint32 i,
+                                      const float64 d) const {
+    float64 left = (positions[i] - positions[i - 1u]) + d;
+    float64 right = (positions[i + 1u] - positions[i]) - d;
+    float64 slopeRight = (heights[i + 1u] - heights[i]) / (positions[i + 1u] - positions[i]);
+    float64 slopeLeft = (heights[i] - heights[i - 1u]) / (positions[i] - positions[i - 1u]);
+    return heights[i] + ((d / (positions[i + 1u] - positions[i - 1u])) * ((left * slopeRight) + (right * slopeLeft)));
+}
+
+float64 StatisticsQuantile::Linear(const uint32 i,
+                                   const float64 d) const {
+    uint32 j = (d > 0.0) ? (i + 1u) : (i - 1u);
+    return heights[i] + ((d * (heights[j] - heights[i])) / (positions[j] - positions[i]));
+}
+
+void StatisticsQuantile::PushSample(const float64 sample) {
+    if (counter < statisticsQuantileMarkers) {
+        /* Keep the first samples sorted in the markers (insertion sort) */
+        uint32 i = counter;
+        while ((i > 0u) && (heights[i - 1u] > sample)) {
+            heights[i] = heights[i - 1u];
+            i--;
+        }
+        heights[i] = sample;
+        counter++;
+        if (counter == statisticsQuantileMarkers) {
+            /* Initialise the positions of the markers */
+            uint32 j;
+            for (j = 0u; j < statisticsQuantileMarkers; j++) {
+                positions[j] = static_cast<float64>(j + 1u);
+            }
+            desiredPositions[0u] = 1.0;
+            desiredPositions[1u] = 1.0 + (2.0 * p);
+            desiredPositions[2u] = 1.0 + (4.0 * p);
+            desiredPositions[3u] = 3.0 + (2.0 * p);
+            desiredPositions[4u] = 5.0;
+        }
+    }
+    else {
+        /* Find the cell of the sample and update the extreme markers */
+        uint32 k;
+        if (sample < heights[0u]) {
+            heights[0u] = sample;
+            k = 0u;
+        }
+        else if (sample >= heights[statisticsQuantileMarkers - 1u]) {
+            heights[statisticsQuantileMarkers - 1u] = sample;
+            k = statisticsQuantileMarkers - 2u;
+        }
+        else {
+            k = 0u;
+            while (sample >= heights[k + 1u]) {
+                k++;
+            }
+        }
+        uint32 i;
+        for (i = k + 1u; i < statisticsQuantileMarkers; i++) {
+            positions[i] += 1.0;
+        }
+        for (i = 0u; i < statisticsQuantileMarkers; i++) {
+            desiredPositions[i] += increments[i];
+        }
+        /* Adjust the heights of the inner markers */
+        for (i = 1u; i < (statisticsQuantileMarkers - 1u); i++) {
+            float64 d = desiredPositions[i] - positions[i];
+            bool moveRight = (d >= 1.0) && ((positions[i + 1u] - positions[i]) > 1.0);
+            bool moveLeft = (d <= -1.0) && ((positions[i - 1u] - positions[i]) < -1.0);
+            if (moveRight || moveLeft) {
+                d = moveRight ? 1.0 : -1.0;
+                float64 height = Parabolic(i, d);
+                if ((heights[i - 1u] < height) && (height < heights[i + 1u])) {
+                    heights[i] = height;
+                }
+                else {
+                    heights[i] = Linear(i, d);
+                }
+                positions[i] += d;
+            }
+        }
+        counter++;
+    }
+
+    /* Latch the estimate and restart at the end of the window */
+    if (counter >= size) {
+        lastQuantile = Estimate();
+        lastQuantileValid = true;
+        counter = 0u;
+    }
+}
+
+float64 StatisticsQuantile::Estimate() const {
+    float64 estimate = 0.0;
+    if (counter >= statisticsQuantileMarkers) {
+        estimate = heights[2u];
+    }
+    else if (counter > 0u) {
+        /* Nearest rank of the (sorted) samples */
+        float64 rank = p * static_cast<float64>(counter);
+        uint32 index = static_cast<uint32>(rank);
+        if ((static_cast<float64>(index) < rank) || (index == 0u)) {
+            index++;
+        }
+        estimate = heights[index - 1u];
+    }
+    else {
+        estimate = 0.0;
+    }
+    return estimate;
+}
+
+float64 StatisticsQuantile::GetQuantile() const {
+    return lastQuantileValid ? lastQuantile : Estimate();
+}
+
+uint32 StatisticsQuantile::GetCounter() const {
+    return counter;
+}
+
+}
@@ -0,0 +1,182 @@
+/**
+ * @file StatisticsQuantile.h
+ * @brief Header file for class StatisticsQuantile
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class StatisticsQuantile
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef STATISTICSQUANTILE_H_
+#define STATISTICSQUANTILE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Number of markers of the P-square algorithm.
+ */
+static const uint32 statisticsQuantileMarkers = 5u;
+
+/**
+ * @brief Streaming estimator of a quantile over consecutive windows of samples.
+ * @details The quantile is estimated with the P-square algorithm (R. Jain and I. Chlamtac, 1985),
+ * which keeps five markers (the minimum, the p/2, p and (1+p)/2 quantiles and the maximum) and
+ * adjusts their heights with a piecewise-parabolic interpolation when a sample is pushed. No sample
+ * is stored or sorted, so that PushSample() has a constant cost and the memory does not depend on the
+ * window size.
+ *
+ * The estimation restarts every windowSize samples (i.e. the windows do not overlap) and GetQuantile()
+ * returns the estimate of the last complete window or, until the first window is complete, the estimate
+ * of the samples pushed so far. With less than five samples in the window the quantile is the nearest
+ * rank of the sorted samples.
+ */
+class StatisticsQuantile {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetQuantile() == 0.0 &&
+     *   GetCounter() == 0u
+     */
+    StatisticsQuantile();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~StatisticsQuantile();
+
+    /**
+     * @brief Sets the quantile to be estimated and the window size.
+     * @param[in] probability the quantile to be estimated, e.g. 0.5 for the median or 0.99.
+     * @param[in] windowSize the number of samples of each window.
+     * @return true if 0 < probability < 1 and windowSize > 0.
+     * @post
+     *   Reset()
+     */
+    bool Initialise(const float64 probability,
+                    const uint32 windowSize);
+
+    /**
+     * @brief Restarts the estimation and forgets the last complete window.
+     */
+    void Reset();
+
+    /**
+     * @brief Updates the estimate with a new sample.
+     * @param[in] sample the new sample.
+     */
+    void PushSample(const float64 sample);
+
+    /**
+     * @brief Gets the estimated quantile.
+     * @return the quantile of the last complete window or, if no window is complete, of the samples pushed so far.
+     */
+    float64 GetQuantile() const;
+
+    /**
+     * @brief Gets the number of samples pushed in the current window.
+     * @return the number of samples pushed in the current window.
+     */
+    uint32 GetCounter() const;
+
+private:
+
+    /**
+     * @brief Estimates the quantile of the current window.
+     */
+    float64 Estimate() const;
+
+    /**
+     * @brief Piecewise-parabolic prediction of the height of the marker i moved by d (+1 or -1) positions.
+     */
+    float64 Parabolic(const uint32 i,
+                      const float64 d) const;
+
+    /**
+     * @brief Linear prediction of the height of the marker i moved by d (+1 or -1) positions.
+     */
+    float64 Linear(const uint32 i,
+                   const float64 d) const;
+
+    /**
+     * The quantile to be estimated
+     */
+    float64 p;
+
+    /**
+     * The number of samples of each window
+     */
+    uint32 size;
+
+    /**
+     * The number of samples pushed in the current window
+     */
+    uint32 counter;
+
+    /**
+     * The heights of the markers
+     */
+    float64 heights[statisticsQuantileMarkers];
+
+    /**
+     * The actual positions of the markers
+     */
+    float64 positions[statisticsQuantileMarkers];
+
+    /**
+     * The desired positions of the markers
+     */
+    float64 desiredPositions[statisticsQuantileMarkers];
+
+    /**
+     * The increments of the desired positions for each sample
+     */
+    float64 increments[statisticsQuantileMarkers];
+
+    /**
+     * The quantile of the last complete window
+     */
+    float64 lastQuantile;
+
+    /**
+     * True if at least one window is complete
+     */
+    bool lastQuantileValid;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* STATISTICSQUANTILE_H_ */
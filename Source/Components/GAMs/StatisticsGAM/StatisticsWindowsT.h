@@ -0,0 +1,422 @@
+/**
+ * @file StatisticsWindowsT.h
+ * @brief Header file for class StatisticsWindowsT
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class StatisticsWindowsT
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef STATISTICSWINDOWST_H_
+#define STATISTICSWINDOWST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "FastMath.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief The class provides templated statistics computation over several moving windows of one sample stream.
+ * @details The samples are not stored. Each block of blockSize consecutive samples is reduced to a summary
+ * (average and sum of squared deviations from the average, as float64, minimum and maximum), which is stored in a ring
+ * of as many blocks as the longest window. When a block is completed the summaries of the windows are rebuilt from the
+ * newest to the oldest block, so that each window is the previous (shorter) window combined with the older blocks
+ * (parallel variance update), and the cost is one combination per block of the longest window, irrespectively of the
+ * number of windows.
+ * The windows shall be multiples of blockSize and in increasing order. The statistics of a window are exact over the last
+ * (window size) samples at the end of each block. Until a window has been fully populated once, its statistics are computed
+ * over the samples of the completed blocks.
+ * The standard deviation is the population one, i.e. the square root of the sum of squared deviations divided by the number of samples.
+ */
+/*lint -e{1712} the implementation does not provide default constructor*/
+/*lint -e{1733} the implementation does not provide a copy constructor*/
+/*lint -esym(9107, MARTe::StatisticsWindowsT*) [MISRA C++ Rule 3-1-1] required for template implementation*/
+template<typename Type> class StatisticsWindowsT {
+public:
+
+    /**
+     * @brief Constructor.
+     * @details Allocates the ring of block summaries (windowSizes[windows - 1] / samplesPerBlock blocks) and the window summaries.
+     * @param[in] samplesPerBlock the number of samples of each block, i.e. the number of PushSample() between two updates of the windows.
+     * @param[in] windowSizes the size of each window (in samples).
+     * @param[in] windows the number of windows.
+     * @pre
+     *   samplesPerBlock > 0 && windows > 0 &&
+     *   for each window w: windowSizes[w] % samplesPerBlock == 0 && windowSizes[w] > 0 && (w == 0 || windowSizes[w] > windowSizes[w - 1])
+     */
+    StatisticsWindowsT(const uint32 samplesPerBlock,
+                       const uint32 * const windowSizes,
+                       const uint32 windows);
+
+    /**
+     * @brief Destructor. Frees allocated memory buffers.
+     */
+    virtual ~StatisticsWindowsT();
+
+    /**
+     * @brief Clears out the block and window summaries.
+     */
+    void Reset();
+
+    /**
+     * @brief Inserts a new sample in the current block.
+     * @details Updates the average, the sum of squared deviations (Welford update), the minimum and the maximum of the current
+     * block. When the block is completed it is stored in the ring (replacing the oldest block) and the windows are rebuilt.
+     * @param[in] sample the sample.
+     * @return true if the block was completed and the windows were rebuilt.
+     */
+    bool PushSample(const Type sample);
+
+    /**
+     * @brief Accessor. Returns the number of samples of each block.
+     * @return the number of samples of each block.
+     */
+    uint32 GetBlockSize() const;
+
+    /**
+     * @brief Accessor. Returns the number of windows.
+     * @return the number of windows.
+     */
+    uint32 GetNumberOfWindows() const;
+
+    /**
+     * @brief Accessor. Returns the number of samples over which the statistics of the window were computed.
+     * @param[in] window the window index.
+     * @return the number of samples (<= size of the window).
+     */
+    uint32 GetCounter(const uint32 window) const;
+
+    /**
+     * @brief Average over the window.
+     * @param[in] window the window index.
+     * @return the average converted to Type.
+     */
+    Type GetAvg(const uint32 window) const;
+
+    /**
+     * @brief Standard deviation over the window.
+     * @param[in] window the window index.
+     * @return the standard deviation converted to Type.
+     */
+    Type GetStd(const uint32 window) const;
+
+    /**
+     * @brief Minimum over the window.
+     * @param[in] window the window index.
+     * @return the minimum.
+     */
+    Type GetMin(const uint32 window) const;
+
+    /**
+     * @brief Maximum over the window.
+     * @param[in] window the window index.
+     * @return the maximum.
+     */
+    Type GetMax(const uint32 window) const;
+
+private:
+
+    /**
+     * Number of samples of each block
+     */
+    uint32 blockSize;
+
+    /**
+     * Number of windows
+     */
+    uint32 numberOfWindows;
+
+    /**
+     * Size of each window in blocks
+     */
+    uint32 *windowBlocks;
+
+    /**
+     * Number of blocks in the ring (the size of the longest window in blocks)
+     */
+    uint32 numberOfBlocks;
+
+    /**
+     * Number of blocks stored in the ring (<= numberOfBlocks)
+     */
+    uint32 numberOfStoredBlocks;
+
+    /**
+     * Position of the newest block in the ring
+     */
+    uint32 newestBlock;
+
+    /**
+     * Number of samples in the current block
+     */
+    uint32 counter;
+
+    /**
+     * Average of the current block
+     */
+    float64 mean;
+
+    /**
+     * Sum of squared deviations of the current block
+     */
+    float64 m2;
+
+    /**
+     * Minimum of the current block
+     */
+    Type min;
+
+    /**
+     * Maximum of the current block
+     */
+    Type max;
+
+    /**
+     * Average of each block in the ring
+     */
+    float64 *blocksMean;
+
+    /**
+     * Sum of squared deviations of each block in the ring
+     */
+    float64 *blocksM2;
+
+    /**
+     * Minimum of each block in the ring
+     */
+    Type *blocksMin;
+
+    /**
+     * Maximum of each block in the ring
+     */
+    Type *blocksMax;
+
+    /**
+     * Number of samples of each window
+     */
+    uint32 *windowsCounter;
+
+    /**
+     * Average of each window
+     */
+    float64 *windowsMean;
+
+    /**
+     * Sum of squared deviations of each window
+     */
+    float64 *windowsM2;
+
+    /**
+     * Minimum of each window
+     */
+    Type *windowsMin;
+
+    /**
+     * Maximum of each window
+     */
+    Type *windowsMax;
+
+    /**
+     * @brief Rebuilds the window summaries combining the blocks from the newest to the oldest.
+     */
+    void UpdateWindows();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+/*lint -e{1566} initialisation of the attributes in the Reset() method*/
+/*lint -e{1732} no assignment ever used */
+/*lint -e{1733} no assignment ever used */
+template<typename Type> StatisticsWindowsT<Type>::StatisticsWindowsT(const uint32 samplesPerBlock,
+                                                                     const uint32 * const windowSizes,
+                                                                     const uint32 windows) {
+    blockSize = (samplesPerBlock > 0u) ? samplesPerBlock : 1u;
+    numberOfWindows = windows;
+    windowBlocks = new uint32[numberOfWindows];
+    numberOfBlocks = 1u;
+    uint32 w;
+    for (w = 0u; w < numberOfWindows; w++) {
+        windowBlocks[w] = windowSizes[w] / blockSize;
+        if (windowBlocks[w] > numberOfBlocks) {
+            numberOfBlocks = windowBlocks[w];
+        }
+    }
+    blocksMean = new float64[numberOfBlocks];
+    blocksM2 = new float64[numberOfBlocks];
+    blocksMin = new Type[numberOfBlocks];
+    blocksMax = new Type[numberOfBlocks];
+    windowsCounter = new uint32[numberOfWindows];
+    windowsMean = new float64[numberOfWindows];
+    windowsM2 = new float64[numberOfWindows];
+    windowsMin = new Type[numberOfWindows];
+    windowsMax = new Type[numberOfWindows];
+    Reset();
+}
+
+/*lint -e{1551} no exception thrown deleting the buffers*/
+template<typename Type> StatisticsWindowsT<Type>::~StatisticsWindowsT() {
+    delete[] windowBlocks;
+    delete[] blocksMean;
+    delete[] blocksM2;
+    delete[] blocksMin;
+    delete[] blocksMax;
+    delete[] windowsCounter;
+    delete[] windowsMean;
+    delete[] windowsM2;
+    delete[] windowsMin;
+    delete[] windowsMax;
+}
+
+/*lint -e{9117} [MISRA C++ Rule 5-0-4] signedness of 0 ignored in template method to avoid specializing for all types*/
+template<typename Type> void StatisticsWindowsT<Type>::Reset() {
+    numberOfStoredBlocks = 0u;
+    newestBlock = numberOfBlocks - 1u;
+    counter = 0u;
+    mean = 0.0;
+    m2 = 0.0;
+    min = static_cast<Type>(0);
+    max = static_cast<Type>(0);
+    uint32 w;
+    for (w = 0u; w < numberOfWindows; w++) {
+        windowsCounter[w] = 0u;
+        windowsMean[w] = 0.0;
+        windowsM2[w] = 0.0;
+        windowsMin[w] = static_cast<Type>(0);
+        windowsMax[w] = static_cast<Type>(0);
+    }
+}
+
+template<typename Type> bool StatisticsWindowsT<Type>::PushSample(const Type sample) {
+    float64 x = static_cast<float64>(sample);
+    counter++;
+    float64 delta = x - mean;
+    mean += delta / static_cast<float64>(counter);
+    m2 += delta * (x - mean);
+    if ((counter == 1u) || (sample < min)) {
+        min = sample;
+    }
+    if ((counter == 1u) || (sample > max)) {
+        max = sample;
+    }
+
+    bool completed = (counter == blockSize);
+    if (completed) {
+        newestBlock++;
+        if (newestBlock == numberOfBlocks) {
+            newestBlock = 0u;
+        }
+        blocksMean[newestBlock] = mean;
+        blocksM2[newestBlock] = m2;
+        blocksMin[newestBlock] = min;
+        blocksMax[newestBlock] = max;
+        if (numberOfStoredBlocks < numberOfBlocks) {
+            numberOfStoredBlocks++;
+        }
+        counter = 0u;
+        mean = 0.0;
+        m2 = 0.0;
+        UpdateWindows();
+    }
+    return completed;
+}
+
+template<typename Type> void StatisticsWindowsT<Type>::UpdateWindows() {
+    const float64 nb = static_cast<float64>(blockSize);
+    uint32 n = 0u;
+    float64 windowMean = 0.0;
+    float64 windowM2 = 0.0;
+    Type windowMin = blocksMin[newestBlock];
+    Type windowMax = blocksMax[newestBlock];
+    uint32 block = newestBlock;
+    uint32 k = 0u;
+    uint32 w;
+    for (w = 0u; w < numberOfWindows; w++) {
+        /* The window w is the window w - 1 combined with its older blocks */
+        while ((k < windowBlocks[w]) && (k < numberOfStoredBlocks)) {
+            float64 na = static_cast<float64>(n);
+            float64 total = na + nb;
+            float64 delta = blocksMean[block] - windowMean;
+            windowMean += (delta * nb) / total;
+            windowM2 += blocksM2[block] + (((delta * delta) * na) * nb) / total;
+            if (blocksMin[block] < windowMin) {
+                windowMin = blocksMin[block];
+            }
+            if (blocksMax[block] > windowMax) {
+                windowMax = blocksMax[block];
+            }
+            n += blockSize;
+            block = (block == 0u) ? (numberOfBlocks - 1u) : (block - 1u);
+            k++;
+        }
+        windowsCounter[w] = n;
+        windowsMean[w] = windowMean;
+        windowsM2[w] = windowM2;
+        windowsMin[w] = windowMin;
+        windowsMax[w] = windowMax;
+    }
+}
+
+template<typename Type> uint32 StatisticsWindowsT<Type>::GetBlockSize() const {
+    return blockSize;
+}
+
+template<typename Type> uint32 StatisticsWindowsT<Type>::GetNumberOfWindows() const {
+    return numberOfWindows;
+}
+
+template<typename Type> uint32 StatisticsWindowsT<Type>::GetCounter(const uint32 window) const {
+    return (window < numberOfWindows) ? windowsCounter[window] : 0u;
+}
+
+template<typename Type> Type StatisticsWindowsT<Type>::GetAvg(const uint32 window) const {
+    return (window < numberOfWindows) ? static_cast<Type>(windowsMean[window]) : static_cast<Type>(0);
+}
+
+template<typename Type> Type StatisticsWindowsT<Type>::GetStd(const uint32 window) const {
+    float64 variance = 0.0;
+    if (window < numberOfWindows) {
+        if (windowsCounter[window] > 0u) {
+            variance = windowsM2[window] / static_cast<float64>(windowsCounter[window]);
+        }
+    }
+    return (variance > 0.0) ? static_cast<Type>(FastMath::SquareRoot<float64>(variance)) : static_cast<Type>(0);
+}
+
+template<typename Type> Type StatisticsWindowsT<Type>::GetMin(const uint32 window) const {
+    return (window < numberOfWindows) ? windowsMin[window] : static_cast<Type>(0);
+}
+
+template<typename Type> Type StatisticsWindowsT<Type>::GetMax(const uint32 window) const {
+    return (window < numberOfWindows) ? windowsMax[window] : static_cast<Type>(0);
+}
+
+} /* namespace MARTe */
+
+#endif /* STATISTICSWINDOWST_H_ */
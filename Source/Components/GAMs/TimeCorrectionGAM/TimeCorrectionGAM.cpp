@@ -30,6 +30,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
+#include "StreamString.h"
 #include "TimeCorrectionGAM.h"
 
 /*---------------------------------------------------------------------------*/
@@ -44,25 +45,61 @@ namespace MARTe {
 
 TimeCorrectionGAM::TimeCorrectionGAM() :
         GAM() {
+    numberOfStreams = 0u;
+    pllMode = false;
+    phaseGain = 0.;
+    frequencyGain = 0.;
+    numberOfSamples = 1u;
     expectedDelta = 0ull;
     deltaTolerance = 0ull;
     filterGain = 0.F;
-    estimatedDelta = 0.;
-    inputTime = NULL_PTR(uint64 *);
-    correctedTime = NULL_PTR(uint64 *);
-    corrected = NULL_PTR(uint8 *);
-    lastValidTime = 0ull;
+    estimatedDelta = NULL_PTR(float64 *);
+    timeFraction = NULL_PTR(float64 *);
+    inputTime = NULL_PTR(uint64 **);
+    correctedTime = NULL_PTR(uint64 **);
+    corrected = NULL_PTR(uint8 **);
+    lastValidTime = NULL_PTR(uint64 *);
     iterationCounter = 0u;
 }
 
 TimeCorrectionGAM::~TimeCorrectionGAM() {
-    inputTime = NULL_PTR(uint64 *);
-    correctedTime = NULL_PTR(uint64 *);
-    corrected = NULL_PTR(uint8 *);
+    if (estimatedDelta != NULL_PTR(float64 *)) {
+        delete[] estimatedDelta;
+    }
+    if (timeFraction != NULL_PTR(float64 *)) {
+        delete[] timeFraction;
+    }
+    if (inputTime != NULL_PTR(uint64 **)) {
+        delete[] inputTime;
+    }
+    if (correctedTime != NULL_PTR(uint64 **)) {
+        delete[] correctedTime;
+    }
+    if (corrected != NULL_PTR(uint8 **)) {
+        delete[] corrected;
+    }
+    if (lastValidTime != NULL_PTR(uint64 *)) {
+        delete[] lastValidTime;
+    }
 }
 
 bool TimeCorrectionGAM::Initialise(StructuredDataI & data) {
     bool ret = GAM::Initialise(data);
+    if (ret) {
+        StreamString mode;
+        if (data.Read("Mode", mode)) {
+            if (mode == "PLL") {
+                pllMode = true;
+            }
+            else if (mode != "Filter") {
+                ret = false;
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Mode must be Filter or PLL");
+            }
+            else {
+                pllMode = false;
+            }
+        }
+    }
     if (ret) {
         ret = data.Read("ExpectedDelta", expectedDelta);
         if (!ret) {
@@ -78,14 +115,37 @@ bool TimeCorrectionGAM::Initialise(StructuredDataI & data) {
     }
 
     if (ret) {
-        ret = data.Read("FilterGain", filterGain);
-        if (!ret) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "FilterGain shall be defined");
+        if (pllMode) {
+            ret = data.Read("PhaseGain", phaseGain);
+            if (ret) {
+                ret = data.Read("FrequencyGain", frequencyGain);
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "PhaseGain and FrequencyGain shall be defined with Mode = PLL");
+            }
+            if (ret) {
+                ret = ((phaseGain > 0.) && (phaseGain <= 1.));
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "PhaseGain must be in (0, 1]");
+                }
+            }
+            if (ret) {
+                ret = ((frequencyGain > 0.) && (frequencyGain < (4. - (2. * phaseGain))));
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "FrequencyGain must be in (0, 4 - 2 * PhaseGain)");
+                }
+            }
         }
-        if (ret) {
-            ret = ((filterGain > 0.) && (filterGain < 1.));
+        else {
+            ret = data.Read("FilterGain", filterGain);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "FilterGain shall be defined");
+            }
             if (ret) {
-                REPORT_ERROR(ErrorManagement::InitialisationError, "FilterGain must be in [0, 1]");
+                ret = ((filterGain > 0.) && (filterGain < 1.));
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "FilterGain must be in [0, 1]");
+                }
             }
         }
     }
@@ -93,128 +153,200 @@ bool TimeCorrectionGAM::Initialise(StructuredDataI & data) {
 }
 
 bool TimeCorrectionGAM::Setup() {
-    bool ret = (GetNumberOfInputSignals() == 1u);
+    numberOfStreams = GetNumberOfInputSignals();
+    bool ret = (numberOfStreams > 0u);
+    bool hasFlags = false;
 
     if (ret) {
-        uint32 nOfInputSignals = GetNumberOfOutputSignals();
         uint32 nOfOutputSignals = GetNumberOfOutputSignals();
-        ret = ((nOfInputSignals > 0u) && (nOfOutputSignals <= 2u));
-        if (ret) {
-            REPORT_ERROR(ErrorManagement::FatalError, "This Function allows only one or two output signals");
+        hasFlags = (nOfOutputSignals == (2u * numberOfStreams));
+        ret = ((nOfOutputSignals == numberOfStreams) || (hasFlags));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "This Function allows only one or two output signals for each input signal");
         }
 
     }
     else {
-        REPORT_ERROR(ErrorManagement::FatalError, "This Function allows only one input signal");
+        REPORT_ERROR(ErrorManagement::FatalError, "This Function requires at least one input signal");
     }
 
-    //check the signals are uint64 type
-    if (ret) {
-        TypeDescriptor td = GetSignalType(InputSignals, 0u);
+    uint32 timeSignalStep = hasFlags ? 2u : 1u;
+    //check the signals are uint64 type and that the number of elements is 1
+    for (uint32 i = 0u; (i < numberOfStreams) && (ret); i++) {
+        TypeDescriptor td = GetSignalType(InputSignals, i);
         ret = (td == UnsignedInteger64Bit);
-        if (ret) {
-            REPORT_ERROR(ErrorManagement::FatalError, "The input time signal type must be uint64");
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "The input time signal (%d) type must be uint64", i);
         }
-    }
-    if (ret) {
-        TypeDescriptor td = GetSignalType(OutputSignals, 0u);
-        ret = (td == UnsignedInteger64Bit);
         if (ret) {
-            REPORT_ERROR(ErrorManagement::FatalError, "The corrected time signal (0) type must be uint64");
-        }
-    }
-
-    if (ret) {
-        if (GetNumberOfOutputSignals() > 1u) {
-            TypeDescriptor td = GetSignalType(OutputSignals, 1u);
-            ret = (td == UnsignedInteger8Bit);
+            uint32 numberOfElements = 0u;
+            ret = GetSignalNumberOfElements(InputSignals, i, numberOfElements);
             if (ret) {
-                REPORT_ERROR(ErrorManagement::FatalError, "The corrected flag signal (1) type must be uint8");
+                ret = (numberOfElements == 1u);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "The input signal (%d) must be scalar", i);
+                }
             }
         }
-    }
-
-    //check that the number of elements is 1
-    if (ret) {
-        uint32 numberOfElements = 0u;
-        ret = GetSignalNumberOfElements(InputSignals, 0u, numberOfElements);
+        uint32 timeIdx = i * timeSignalStep;
         if (ret) {
-            ret = (numberOfElements == 1u);
-            if (ret) {
-                REPORT_ERROR(ErrorManagement::FatalError, "The input signal type must be scalar");
+            td = GetSignalType(OutputSignals, timeIdx);
+            ret = (td == UnsignedInteger64Bit);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::FatalError, "The corrected time signal (%d) type must be uint64", timeIdx);
             }
         }
-    }
-    if (ret) {
-
-        uint32 numberOfElements = 0u;
-        ret = GetSignalNumberOfElements(OutputSignals, 0u, numberOfElements);
         if (ret) {
-            ret = (numberOfElements == 1u);
+            uint32 numberOfElements = 0u;
+            ret = GetSignalNumberOfElements(OutputSignals, timeIdx, numberOfElements);
             if (ret) {
-                REPORT_ERROR(ErrorManagement::FatalError, "The corrected time signal (0) must be scalar");
+                if (i == 0u) {
+                    numberOfSamples = numberOfElements;
+                }
+                if (pllMode) {
+                    ret = (numberOfElements == numberOfSamples);
+                    if (!ret) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "All the corrected time signals must have the same number of elements");
+                    }
+                }
+                else {
+                    ret = (numberOfElements == 1u);
+                    if (!ret) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "The corrected time signal (%d) must be scalar", timeIdx);
+                    }
+                }
             }
         }
-    }
-    if (ret) {
-        if (GetNumberOfOutputSignals() > 1u) {
-
-            uint32 numberOfElements = 0u;
-            ret = GetSignalNumberOfElements(OutputSignals, 1u, numberOfElements);
+        if ((ret) && (hasFlags)) {
+            td = GetSignalType(OutputSignals, timeIdx + 1u);
+            ret = (td == UnsignedInteger8Bit);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::FatalError, "The corrected flag signal (%d) type must be uint8", timeIdx + 1u);
+            }
             if (ret) {
-                ret = (numberOfElements == 1u);
+                uint32 numberOfElements = 0u;
+                ret = GetSignalNumberOfElements(OutputSignals, timeIdx + 1u, numberOfElements);
                 if (ret) {
-                    REPORT_ERROR(ErrorManagement::FatalError, "The corrected flag signal (1) must be scalar");
+                    ret = (numberOfElements == 1u);
+                    if (!ret) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "The corrected flag signal (%d) must be scalar", timeIdx + 1u);
+                    }
                 }
             }
         }
     }
     if (ret) {
-        inputTime = reinterpret_cast<uint64 *>(GetInputSignalMemory(0u));
-        correctedTime = reinterpret_cast<uint64 *>(GetOutputSignalMemory(0u));
-        if (GetNumberOfOutputSignals() > 1u) {
-            corrected = reinterpret_cast<uint8 *>(GetOutputSignalMemory(1u));
+        inputTime = new uint64*[numberOfStreams];
+        correctedTime = new uint64*[numberOfStreams];
+        if (hasFlags) {
+            corrected = new uint8*[numberOfStreams];
+        }
+        estimatedDelta = new float64[numberOfStreams];
+        timeFraction = new float64[numberOfStreams];
+        lastValidTime = new uint64[numberOfStreams];
+        for (uint32 i = 0u; i < numberOfStreams; i++) {
+            inputTime[i] = reinterpret_cast<uint64 *>(GetInputSignalMemory(i));
+            correctedTime[i] = reinterpret_cast<uint64 *>(GetOutputSignalMemory(i * timeSignalStep));
+            if (hasFlags) {
+                corrected[i] = reinterpret_cast<uint8 *>(GetOutputSignalMemory((i * timeSignalStep) + 1u));
+            }
+            estimatedDelta[i] = static_cast<float64>(expectedDelta);
+            timeFraction[i] = 0.;
+            lastValidTime[i] = 0ull;
         }
-        estimatedDelta = static_cast<float64>(expectedDelta);
     }
     return ret;
 }
 
 /*lint -e{613} pointer checked before during the Setup*/
 bool TimeCorrectionGAM::Execute() {
-    //a good value
     if (iterationCounter > 0u) {
-        uint64 delta = (*inputTime) - lastValidTime;
-        if (((delta - expectedDelta) < deltaTolerance) || ((expectedDelta - delta) < deltaTolerance)) {
-            estimatedDelta = static_cast<float64>(((1.0 - static_cast<float64>(filterGain)) * estimatedDelta) + (static_cast<float64>(filterGain) * static_cast<float64>(delta)));
-            (*correctedTime) = (*inputTime);
-            if (corrected != NULL_PTR(uint8*)) {
-                (*corrected = 0u);
+        for (uint32 i = 0u; i < numberOfStreams; i++) {
+            bool isCorrected;
+            if (pllMode) {
+                isCorrected = CorrectPLL(i);
             }
-        }
-        //something wrong... correct the value
-        else {
-            float64 lastValidTimeF = static_cast<float64>(lastValidTime) + estimatedDelta;
-            (*correctedTime) = static_cast<uint64>(lastValidTimeF);
-            if ((estimatedDelta - static_cast<float64>(static_cast<uint64>(estimatedDelta))) > 0.5) {
-                (*correctedTime)++;
+            else {
+                isCorrected = CorrectFilter(i);
             }
-
-            if (corrected != NULL_PTR(uint8*)) {
-                (*corrected = 1u);
+            if (corrected != NULL_PTR(uint8 **)) {
+                *(corrected[i]) = isCorrected ? 1u : 0u;
             }
         }
-        lastValidTime = (*correctedTime);
     }
     else {
-        (*correctedTime) = (*inputTime);
-        lastValidTime = (*inputTime);
+        for (uint32 i = 0u; i < numberOfStreams; i++) {
+            lastValidTime[i] = *(inputTime[i]);
+            WriteCorrectedTime(i);
+            if (corrected != NULL_PTR(uint8 **)) {
+                *(corrected[i]) = 0u;
+            }
+        }
         iterationCounter++;
     }
     //REPORT_ERROR(ErrorManagement::FatalError, "estimated delta = %f", estimatedDelta);
 
     return true;
 }
-CLASS_REGISTER(TimeCorrectionGAM, "1.0")
+
+/*lint -e{613} pointer checked before during the Setup*/
+bool TimeCorrectionGAM::CorrectFilter(const uint32 i) {
+    bool isCorrected = false;
+    //a good value
+    uint64 delta = *(inputTime[i]) - lastValidTime[i];
+    if (((delta - expectedDelta) < deltaTolerance) || ((expectedDelta - delta) < deltaTolerance)) {
+        estimatedDelta[i] = static_cast<float64>(((1.0 - static_cast<float64>(filterGain)) * estimatedDelta[i]) + (static_cast<float64>(filterGain) * static_cast<float64>(delta)));
+        *(correctedTime[i]) = *(inputTime[i]);
+    }
+    //something wrong... correct the value
+    else {
+        float64 lastValidTimeF = static_cast<float64>(lastValidTime[i]) + estimatedDelta[i];
+        *(correctedTime[i]) = static_cast<uint64>(lastValidTimeF);
+        if ((estimatedDelta[i] - static_cast<float64>(static_cast<uint64>(estimatedDelta[i]))) > 0.5) {
+            (*(correctedTime[i]))++;
+        }
+        isCorrected = true;
+    }
+    lastValidTime[i] = *(correctedTime[i]);
+    return isCorrected;
+}
+
+/*lint -e{613} pointer checked before during the Setup*/
+bool TimeCorrectionGAM::CorrectPLL(const uint32 i) {
+    //the local clock is lastValidTime[i] + timeFraction[i]
+    float64 error = (static_cast<float64>(static_cast<int64>(*(inputTime[i]) - lastValidTime[i])) - timeFraction[i]) - estimatedDelta[i];
+    float64 tolerance = static_cast<float64>(deltaTolerance);
+    bool isCorrected = ((error > tolerance) || (error < -tolerance));
+    //outlier: the clock runs free with the estimated delta
+    if (isCorrected) {
+        error = 0.;
+    }
+    float64 step = timeFraction[i] + estimatedDelta[i] + (phaseGain * error);
+    //keep the corrected time strictly increasing
+    if (step < 1.) {
+        step = 1.;
+    }
+    uint64 integerStep = static_cast<uint64>(step);
+    timeFraction[i] = step - static_cast<float64>(integerStep);
+    lastValidTime[i] += integerStep;
+    estimatedDelta[i] += (frequencyGain * error);
+    WriteCorrectedTime(i);
+    return isCorrected;
 }
 
+/*lint -e{613} pointer checked before during the Setup*/
+void TimeCorrectionGAM::WriteCorrectedTime(const uint32 i) {
+    uint64 *output = correctedTime[i];
+    output[0u] = lastValidTime[i];
+    if (numberOfSamples > 1u) {
+        float64 sampleDelta = estimatedDelta[i] / static_cast<float64>(numberOfSamples);
+        float64 offset = timeFraction[i];
+        for (uint32 k = 1u; k < numberOfSamples; k++) {
+            offset += sampleDelta;
+            output[k] = lastValidTime[i] + static_cast<uint64>(offset);
+        }
+    }
+}
+
+CLASS_REGISTER(TimeCorrectionGAM, "1.0")
+}
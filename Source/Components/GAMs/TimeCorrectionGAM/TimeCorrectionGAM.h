@@ -57,9 +57,21 @@ namespace MARTe{
  * If the input time-stamp is valid (namely it belongs to the range defined by the user in the configuration), the time-stamp is exactly copied to
  * the output and the delta difference with the previous time-stamp is used to compute the estimation of the delta.
  *
- * @details This GAM accepts only one uint64 as the input signal, containing the acquired time-stamp. In the output, the first uint64 signal must be
- * the corrected time-stamp and, optionally, a uint8 signal can be used to check if the GAM has corrected (=1) or not (=0) the time_stamp
- * in the current cycle.
+ * @details If Mode = PLL the GAM disciplines a local clock to the acquired time-stamps with a second order phase-locked loop (equivalent to
+ *  the steady state Kalman filter of a constant rate clock), which tracks both the phase offset and the frequency drift (the delta) of the acquisition clock:\n
+ *   error=timestamp_in-(timestamp_out+delta_estimated)\n
+ *   timestamp_out=timestamp_out+delta_estimated+phase_gain*error\n
+ *   delta_estimated=delta_estimated+frequency_gain*error\n
+ * The loop is stable for 0 < phase_gain <= 1 and 0 < frequency_gain < 4 - 2 * phase_gain (phase_gain = 0.1 and frequency_gain = 0.0026 give a critically
+ *  damped loop with a time constant of about 20 cycles). A time-stamp whose error is larger than DeltaTolerance is not used (the clock keeps running with
+ *  delta_estimated) and the time-stamp is flagged as corrected. The corrected time-stamps of consecutive cycles are strictly increasing.
+ * In this mode the corrected time-stamp signal can have N elements, which are filled with the estimated time of the N samples acquired in the cycle:\n
+ *   timestamp_out[k]=timestamp_out+k*delta_estimated/N\n
+ *
+ * @details The GAM corrects one or more independent time streams. Each input signal is a scalar uint64, containing the acquired time-stamp of a stream.
+ * In the output, if the number of output signals is equal to the number of input signals, the signal i is the corrected time-stamp of the stream i (uint64).
+ * If there are twice as many output signals, the signal 2*i is the the corrected time-stamp of the stream i and the signal 2*i+1 is a uint8 which
+ * is set to 1 if the GAM has corrected the time-stamp in the current cycle (0 otherwise).
  *
  * @details The configuration syntax is (names and signal quantity are only given as an example):
  * <pre>
@@ -68,6 +80,9 @@ namespace MARTe{
  *     ExpectedDelta=1000000 //Between two cycle the InputTime difference shall be 1000000
  *     DeltaTolerance=20 //With a maximum absolute error of 20
  *     FilterGain=0.1 //The following gain will be used to compute the delta to be used when the difference between two time-stamps is greater than 20
+ *     Mode=Filter //Optional. Filter (default) or PLL.
+ *     PhaseGain=0.1 //Only with Mode=PLL (and compulsory). FilterGain is not used with Mode=PLL.
+ *     FrequencyGain=0.0026 //Only with Mode=PLL (and compulsory).
  *     InputSignals = {
  *         InputTime = {
  *             DataSource = Drv1
@@ -111,23 +126,26 @@ public:
      *   DeltaTolerance (uint64): defines the range in which an acquired time-stamp is considered valid and, hence,
      *     it will not be corrected. The range is [ExpectedDelta-DeltaTolerance, ExpectedDelta+DeltaTolerance].\n
      *   FilterGain (float32): is the gain used in the first-order filter to compute the delta estimation that is used
-     *     to correct the wrong time-stamps\n
+     *     to correct the wrong time-stamps (only with Mode = Filter)\n
+     *   Mode (optional): Filter (default) or PLL.\n
+     *   PhaseGain (float64) and FrequencyGain (float64): the gains of the PLL (only with Mode = PLL).\n
      * @param[in] data @see GAM::Initialise
-     * @return true if all the parameters above are specified.
+     * @return true if all the parameters above are specified and the gains are in the (stable) admissible range.
      */
     virtual bool Initialise(StructuredDataI & data);
 
     /**
      * @see GAM::Setup
-     * @brief Checks if the input signal (acquired time-stamp) is unique, scalar and if it is uint64 type. Checks that the first output signal
-     * (corrected time-stamp) is scalar and uint64 type and that the second signal (is corrected flag) is scalar and uint8 type.
+     * @brief Checks that the input signals (acquired time-stamps) are scalar and uint64 type. Checks that there is one output signal (corrected time-stamp)
+     * or two output signals (corrected time-stamp and is corrected flag) for each input signal, that the corrected time-stamps are uint64 type and that the
+     * flags are scalar and uint8 type. The corrected time-stamps must be scalar unless Mode = PLL.
      * @return true if all the checks succeeds, false otherwise.
      */
     virtual bool Setup();
 
     /**
-     * @brief If necessary, corrects the input time-stamp.
-     * @details If the input time-stamp is valid (namely it belongs to the range defined by the user in the configuration), the time-stamp is exactly copied to
+     * @brief If necessary, corrects the input time-stamps.
+     * @details With Mode = PLL, updates the clock of each stream (see class description). Otherwise, if the input time-stamp is valid (namely it belongs to the range defined by the user in the configuration), the time-stamp is exactly copied to
      * the output and the delta difference with the previous time-stamp is used to compute the estimation of the delta. If the time-stamp is wrong,
      * the corrected time-stamp is computed as the last time-stamp output plus the estimated delta.
      * @return true.
@@ -136,6 +154,51 @@ public:
 
 protected:
 
+    /**
+     * @brief Corrects the time-stamp of a stream with the first order filter (Mode = Filter).
+     * @param[in] i the index of the stream.
+     * @return true if the time-stamp was corrected.
+     */
+    bool CorrectFilter(const uint32 i);
+
+    /**
+     * @brief Updates the PLL clock of a stream (Mode = PLL) and writes the corrected time-stamps.
+     * @param[in] i the index of the stream.
+     * @return true if the time-stamp error was larger than DeltaTolerance.
+     */
+    bool CorrectPLL(const uint32 i);
+
+    /**
+     * @brief Writes the clock of a stream (and, if the signal has more than one element, the interpolated sample times) to the corrected time signal.
+     * @param[in] i the index of the stream.
+     */
+    void WriteCorrectedTime(const uint32 i);
+
+    /**
+     * The number of corrected time streams.
+     */
+    uint32 numberOfStreams;
+
+    /**
+     * True if Mode = PLL.
+     */
+    bool pllMode;
+
+    /**
+     * The gain of the PLL phase correction.
+     */
+    float64 phaseGain;
+
+    /**
+     * The gain of the PLL frequency correction.
+     */
+    float64 frequencyGain;
+
+    /**
+     * The number of elements of the corrected time-stamp signals.
+     */
+    uint32 numberOfSamples;
+
     /**
      * The expected delta difference between two consecutive
      * time-stamps in input
@@ -154,30 +217,36 @@ protected:
     float32 filterGain;
 
     /**
-     * The estimation of delta
+     * The estimation of delta (for each stream)
+     */
+    float64 *estimatedDelta;
+
+    /**
+     * The fractional part of the PLL clock (for each stream)
      */
-    float64 estimatedDelta;
+    float64 *timeFraction;
 
     /**
-     * Accelerator to the memory of the input time-stamp signal
+     * Accelerators to the memory of the input time-stamp signals
      */
-    uint64 *inputTime;
+    uint64 **inputTime;
 
     /**
-     * Accelerator to the memory of the output time-stamo
-     * corrected signal
+     * Accelerators to the memory of the output time-stamp
+     * corrected signals
      */
-    uint64 *correctedTime;
+    uint64 **correctedTime;
 
     /**
-     * Accelerator to the memory of the output "is corrected" flag
+     * Accelerators to the memory of the output "is corrected" flags
+     * (NULL if the flags are not defined)
      */
-    uint8* corrected;
+    uint8 **corrected;
 
     /**
-     * Used to store the last time-stamp output
+     * Used to store the last time-stamp output (for each stream)
      */
-    uint64 lastValidTime;
+    uint64 *lastValidTime;
 
     /**
      * Used to store the first time-stamp
@@ -483,6 +483,16 @@ void Waveform::TriggerMechanism() {
     return;
 }
 
+void Waveform::ApplyTriggerMechanism() {
+    for (uint32 i = 0u; i < numberOfOutputElements; i++) {
+        TriggerMechanism();
+        if (!(signalOn && triggersOn)) {
+            outputFloat64[i] = 0.0;
+        }
+        currentTime += timeIncrement;
+    }
+}
+
 bool Waveform::ValidateTimeTriggers() const {
     bool ret = true;
     if (numberOfStopTriggers > 0u) {
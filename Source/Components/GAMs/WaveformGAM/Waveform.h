@@ -260,6 +260,13 @@ protected:
      * @details This function decides if the triggersON is enabled allowing to output the waveform generated.
      */
     void TriggerMechanism();
+
+    /**
+     * @brief Applies the trigger mechanism to the samples already computed in outputFloat64.
+     * @details For each sample calls TriggerMechanism(), sets the sample to 0 if the signal or the triggers are off and increments currentTime
+     * by timeIncrement, i.e. the same sequence as computing the samples one by one.
+     */
+    void ApplyTriggerMechanism();
 private:
 
     /**
@@ -127,22 +127,37 @@ bool WaveformChirp::Initialise(StructuredDataI &data) {
     if (ok) {
         cD2 = chirpDuration * 2.0;
     }
+    if (ok) {
+        ok = oscillator.Initialise(data);
+    }
 
     return ok;
 }
 
 bool WaveformChirp::PrecomputeValues() {
-    for (uint32 i = 0u; i < numberOfOutputElements; i++) {
-        TriggerMechanism();
-        if (signalOn && triggersOn) {
-            float64 aux = ((w1 * currentTime) + ((w12 * currentTime * currentTime) / cD2)) + phase;
-            float64 aux2 = sin(aux);
-            outputFloat64[i] = (amplitude * aux2) + offset;
+    if (oscillator.GetMethod() != WaveformOscillatorMethodDirect) {
+        if (signalOn) {
+            //phase(t0 + i * dt) = phase(t0) + i * delta0 + i * (i - 1) / 2 * delta2
+            float64 phase0 = ((w1 * currentTime) + ((w12 * currentTime * currentTime) / cD2)) + phase;
+            float64 delta0 = (w1 * timeIncrement) + ((w12 * (((2.0 * currentTime) + timeIncrement) * timeIncrement)) / cD2);
+            float64 delta2 = (2.0 * w12 * timeIncrement * timeIncrement) / cD2;
+            oscillator.Generate(outputFloat64, numberOfOutputElements, phase0, delta0, delta2, amplitude, offset);
         }
-        else {
-            outputFloat64[i] = 0.0;
+        ApplyTriggerMechanism();
+    }
+    else {
+        for (uint32 i = 0u; i < numberOfOutputElements; i++) {
+            TriggerMechanism();
+            if (signalOn && triggersOn) {
+                float64 aux = ((w1 * currentTime) + ((w12 * currentTime * currentTime) / cD2)) + phase;
+                float64 aux2 = sin(aux);
+                outputFloat64[i] = (amplitude * aux2) + offset;
+            }
+            else {
+                outputFloat64[i] = 0.0;
+            }
+            currentTime += timeIncrement;
         }
-        currentTime += timeIncrement;
     }
     return true;
 }
@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "Waveform.h"
+#include "WaveformOscillator.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
@@ -63,6 +64,7 @@ namespace MARTe {
  *     Frequency2 = 3.0
  *     Phase = 0.0
  *     Offset = 1.1
+ *     Method = Recurrence //Optional. Direct (default), Table or Recurrence
  *     StartTriggerTime = {0.1 0.3 0.5 1.8}
  *     StopTriggerTime = {0.2 0.4 0.6} //the StopTriggerTime has one time less, it means that after the sequence of output on and off, the GAM will remain on forever
  *     Time = {
@@ -85,6 +87,10 @@ namespace MARTe {
  * </pre>
  *
  * Note that when Frequency1 = Frequency2 the resultant chirp is a sinusoidal waveform with a constant frequency.
+ *
+ * By default sin() is called for each output sample. With the optional parameter Method = Table or Method = Recurrence the samples of each
+ * execution are computed, respectively, with a lookup table and a phase accumulator or with the rotation of the phasor of the first sample of the
+ * execution (see WaveformOscillator). The optional TableSize parameter is only valid with Method = Table.
  */
 class WaveformChirp: public Waveform {
 public:
@@ -281,6 +287,11 @@ private:
      * 2*chirpDuration
      */
     float64 cD2;
+
+    /**
+     * Computes the samples when the Method is not Direct.
+     */
+    WaveformOscillator oscillator;
 };
 
 }
@@ -0,0 +1,286 @@
+/**
+ * @file WaveformOscillator.cpp
+ * @brief Source file for class WaveformOscillator
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class WaveformOscillator (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "FastMath.h"
+#include "StreamString.h"
+#include "WaveformOscillator.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+/**
+ * One cycle in the phase accumulator of the Table method.
+ */
+const MARTe::float64 waveformOscillatorCycle = 18446744073709551616.0;
+
+/**
+ * Weight of the least significant bit of the 53 bit interpolation fraction.
+ */
+const MARTe::float64 waveformOscillatorFractionLsb = 1.1102230246251565404e-16;
+
+/**
+ * Number of samples between renormalisations of the phasors of the Recurrence method.
+ */
+const MARTe::uint32 waveformOscillatorRenormalisationPeriod = 256u;
+
+/**
+ * Default and limits of the TableSize parameter (as log2).
+ */
+const MARTe::uint32 waveformOscillatorDefaultTableBits = 12u;
+const MARTe::uint32 waveformOscillatorMinTableBits = 2u;
+const MARTe::uint32 waveformOscillatorMaxTableBits = 20u;
+
+/**
+ * @brief Converts a phase (in radians) to the phase accumulator format, where 2^64 is one cycle.
+ * @details Negative phases are converted to their (modulo one cycle) positive equivalent, so that
+ * the two's complement additions of the accumulator also implement decreasing phases.
+ */
+MARTe::uint64 PhaseToAccumulator(const MARTe::float64 phase) {
+    MARTe::float64 cycles = phase / (2.0 * MARTe::FastMath::PI);
+    cycles -= floor(cycles);
+    MARTe::float64 scaled = cycles * waveformOscillatorCycle;
+    MARTe::uint64 ret = 0u;
+    /* cycles may be rounded to 1.0 */
+    if (scaled < waveformOscillatorCycle) {
+        ret = static_cast<MARTe::uint64>(scaled);
+    }
+    return ret;
+}
+
+#if !defined(__SSE2__)
+/**
+ * @brief Rescales a phasor to unit modulus (first order Newton step, as the modulus is always close to 1).
+ */
+void Renormalise(MARTe::float64 &re,
+                 MARTe::float64 &im) {
+    MARTe::float64 gain = (3.0 - ((re * re) + (im * im))) * 0.5;
+    re *= gain;
+    im *= gain;
+}
+#endif
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+WaveformOscillator::WaveformOscillator() {
+    method = WaveformOscillatorMethodDirect;
+    table = NULL_PTR(float64 *);
+    tableBits = 0u;
+}
+
+WaveformOscillator::~WaveformOscillator() {
+    if (table != NULL_PTR(float64 *)) {
+        delete[] table;
+        table = NULL_PTR(float64 *);
+    }
+}
+
+bool WaveformOscillator::Initialise(StructuredDataI &data) {
+    bool ok = true;
+    StreamString methodName;
+    if (data.Read("Method", methodName)) {
+        if (methodName == "Direct") {
+            method = WaveformOscillatorMethodDirect;
+        }
+        else if (methodName == "Table") {
+            method = WaveformOscillatorMethodTable;
+        }
+        else if (methodName == "Recurrence") {
+            method = WaveformOscillatorMethodRecurrence;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for Method (expected values Direct, Table or Recurrence)");
+            ok = false;
+        }
+    }
+    uint32 tableSize = (1u << waveformOscillatorDefaultTableBits);
+    bool tableSizeRead = data.Read("TableSize", tableSize);
+    if (ok && tableSizeRead) {
+        ok = (method == WaveformOscillatorMethodTable);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "TableSize is only valid with Method = Table");
+        }
+    }
+    if (ok && (method == WaveformOscillatorMethodTable)) {
+        tableBits = waveformOscillatorMinTableBits;
+        while ((tableBits < waveformOscillatorMaxTableBits) && ((1u << tableBits) < tableSize)) {
+            tableBits++;
+        }
+        ok = ((1u << tableBits) == tableSize);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "TableSize must be a power of 2 between %u and %u", (1u << waveformOscillatorMinTableBits),
+                         (1u << waveformOscillatorMaxTableBits));
+        }
+    }
+    if (ok && (method == WaveformOscillatorMethodTable)) {
+        if (table != NULL_PTR(float64 *)) {
+            delete[] table;
+        }
+        table = new float64[tableSize + 1u];
+        for (uint32 i = 0u; i <= tableSize; i++) {
+            table[i] = sin((2.0 * FastMath::PI * static_cast<float64>(i)) / static_cast<float64>(tableSize));
+        }
+    }
+    return ok;
+}
+
+WaveformOscillatorMethod WaveformOscillator::GetMethod() const {
+    return method;
+}
+
+void WaveformOscillator::Generate(float64 * const output,
+                                  const uint32 numberOfSamples,
+                                  const float64 phase0,
+                                  const float64 delta0,
+                                  const float64 delta2,
+                                  const float64 amplitude,
+                                  const float64 offset) const {
+    if (method == WaveformOscillatorMethodTable) {
+        GenerateTable(output, numberOfSamples, phase0, delta0, delta2, amplitude, offset);
+    }
+    else if (method == WaveformOscillatorMethodRecurrence) {
+        GenerateRecurrence(output, numberOfSamples, phase0, delta0, delta2, amplitude, offset);
+    }
+    else {
+    }
+}
+
+void WaveformOscillator::GenerateTable(float64 * const output,
+                                       const uint32 numberOfSamples,
+                                       const float64 phase0,
+                                       const float64 delta0,
+                                       const float64 delta2,
+                                       const float64 amplitude,
+                                       const float64 offset) const {
+    /* The additions wrap modulo 2^64, i.e. modulo one cycle */
+    uint64 accumulator = PhaseToAccumulator(phase0);
+    uint64 increment = PhaseToAccumulator(delta0);
+    const uint64 increment2 = PhaseToAccumulator(delta2);
+    const uint32 indexShift = 64u - tableBits;
+    /*lint -e{613} table cannot be NULL as the Table method is only set if the table is allocated*/
+    for (uint32 i = 0u; i < numberOfSamples; i++) {
+        uint64 index = accumulator >> indexShift;
+        float64 fraction = static_cast<float64>((accumulator << tableBits) >> 11u) * waveformOscillatorFractionLsb;
+        float64 sample = table[index];
+        sample += fraction * (table[index + 1u] - sample);
+        output[i] = (amplitude * sample) + offset;
+        accumulator += increment;
+        increment += increment2;
+    }
+}
+
+void WaveformOscillator::GenerateRecurrence(float64 * const output,
+                                            const uint32 numberOfSamples,
+                                            const float64 phase0,
+                                            const float64 delta0,
+                                            const float64 delta2,
+                                            const float64 amplitude,
+                                            const float64 offset) const {
+    uint32 i = 0u;
+#if defined(__SSE2__)
+    /*lint -save -e586 -e9016 -e923 SSE2 intrinsics on unaligned signal memory.*/
+    /* Lane k computes the samples k, k + 2, k + 4, ... The rotation of lane k is exp(j * (phase[k + 2] - phase[k])) which changes,
+     * for both lanes, by exp(j * 4 * delta2) after each step*/
+    __m128d zRe = _mm_set_pd(cos(phase0 + delta0), cos(phase0));
+    __m128d zIm = _mm_set_pd(sin(phase0 + delta0), sin(phase0));
+    const float64 rotation0 = (2.0 * delta0) + delta2;
+    const float64 rotation1 = (2.0 * delta0) + (3.0 * delta2);
+    __m128d rRe = _mm_set_pd(cos(rotation1), cos(rotation0));
+    __m128d rIm = _mm_set_pd(sin(rotation1), sin(rotation0));
+    const __m128d qRe = _mm_set1_pd(cos(4.0 * delta2));
+    const __m128d qIm = _mm_set1_pd(sin(4.0 * delta2));
+    const __m128d amplitudes = _mm_set1_pd(amplitude);
+    const __m128d offsets = _mm_set1_pd(offset);
+    const __m128d three = _mm_set1_pd(3.0);
+    const __m128d half = _mm_set1_pd(0.5);
+    uint32 steps = 0u;
+    while ((i + 1u) < numberOfSamples) {
+        _mm_storeu_pd(&output[i], _mm_add_pd(_mm_mul_pd(amplitudes, zIm), offsets));
+        __m128d re = _mm_sub_pd(_mm_mul_pd(zRe, rRe), _mm_mul_pd(zIm, rIm));
+        zIm = _mm_add_pd(_mm_mul_pd(zIm, rRe), _mm_mul_pd(zRe, rIm));
+        zRe = re;
+        re = _mm_sub_pd(_mm_mul_pd(rRe, qRe), _mm_mul_pd(rIm, qIm));
+        rIm = _mm_add_pd(_mm_mul_pd(rIm, qRe), _mm_mul_pd(rRe, qIm));
+        rRe = re;
+        steps += 2u;
+        if (steps >= waveformOscillatorRenormalisationPeriod) {
+            steps = 0u;
+            __m128d gain = _mm_mul_pd(_mm_sub_pd(three, _mm_add_pd(_mm_mul_pd(zRe, zRe), _mm_mul_pd(zIm, zIm))), half);
+            zRe = _mm_mul_pd(zRe, gain);
+            zIm = _mm_mul_pd(zIm, gain);
+            gain = _mm_mul_pd(_mm_sub_pd(three, _mm_add_pd(_mm_mul_pd(rRe, rRe), _mm_mul_pd(rIm, rIm))), half);
+            rRe = _mm_mul_pd(rRe, gain);
+            rIm = _mm_mul_pd(rIm, gain);
+        }
+        i += 2u;
+    }
+    if (i < numberOfSamples) {
+        /* The last (odd) sample is in the first lane */
+        _mm_store_sd(&output[i], _mm_add_pd(_mm_mul_pd(amplitudes, zIm), offsets));
+    }
+    /*lint -restore*/
+#else
+    float64 zRe = cos(phase0);
+    float64 zIm = sin(phase0);
+    float64 rRe = cos(delta0);
+    float64 rIm = sin(delta0);
+    const float64 qRe = cos(delta2);
+    const float64 qIm = sin(delta2);
+    uint32 steps = 0u;
+    for (i = 0u; i < numberOfSamples; i++) {
+        output[i] = (amplitude * zIm) + offset;
+        float64 re = (zRe * rRe) - (zIm * rIm);
+        zIm = (zIm * rRe) + (zRe * rIm);
+        zRe = re;
+        re = (rRe * qRe) - (rIm * qIm);
+        rIm = (rIm * qRe) + (rRe * qIm);
+        rRe = re;
+        steps++;
+        if (steps >= waveformOscillatorRenormalisationPeriod) {
+            steps = 0u;
+            Renormalise(zRe, zIm);
+            Renormalise(rRe, rIm);
+        }
+    }
+#endif
+}
+
+}
@@ -0,0 +1,171 @@
+/**
+ * @file WaveformOscillator.h
+ * @brief Header file for class WaveformOscillator
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class WaveformOscillator
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef WAVEFORMOSCILLATOR_H_
+#define WAVEFORMOSCILLATOR_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Algorithm used to compute the sin of the output samples.
+ */
+enum WaveformOscillatorMethod {
+    WaveformOscillatorMethodDirect,
+    WaveformOscillatorMethodTable,
+    WaveformOscillatorMethodRecurrence
+};
+
+/**
+ * @brief Computes blocks of samples of a sinusoid with a linearly changing frequency without calling sin() for each sample.
+ * @details The phase of the sample i of a block is
+ *
+ * \f$
+ * phase[i] = phase0 + i * delta0 + i * (i - 1) / 2 * delta2
+ * \f$
+ *
+ * i.e. delta0 is the phase increment between the first two samples and delta2 is the (constant) change of the phase increment between
+ * consecutive samples (0 for a constant frequency). The following methods are supported:
+ *  - Direct: the Generate() method is not used and the owner of the oscillator calls sin() for each sample;
+ *  - Table: a 64 bit phase accumulator (where 2^64 is one cycle) indexes a table with TableSize samples of a sin cycle and the value is
+ *  linearly interpolated between two consecutive samples of the table. The maximum error is (PI / TableSize)^2 / 2 (~3e-7 with the default
+ *  TableSize of 4096);
+ *  - Recurrence: the phasor of the first sample is rotated by the complex phase increment of each sample (two complex multiplications per
+ *  sample when delta2 != 0). The phasors are renormalised every 256 samples and recomputed with sin() and cos() at the beginning of each block.
+ *  When SSE2 is available two consecutive samples are computed in parallel.
+ *
+ * The configuration syntax is (to be added to the configuration of the Waveform GAM which uses the oscillator):
+ * <pre>
+ *     Method = Table //Optional. Direct (default), Table or Recurrence.
+ *     TableSize = 4096 //Optional and only valid with Method = Table. Power of 2 between 4 and 1048576 (default 4096).
+ * </pre>
+ */
+class WaveformOscillator {
+public:
+    /**
+     * @brief Default constructor.
+     * @post
+     *   GetMethod() == WaveformOscillatorMethodDirect
+     */
+    WaveformOscillator();
+
+    /**
+     * @brief Destructor. Frees the table.
+     */
+    ~WaveformOscillator();
+
+    /**
+     * @brief Reads the Method and the TableSize parameters and, for the Table method, computes the table.
+     * @param[in] data the configuration of the Waveform GAM.
+     * @return true if Method is Direct, Table or Recurrence and TableSize is a valid power of 2 (only accepted with Method = Table).
+     */
+    bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Gets the configured method.
+     * @return the configured method.
+     */
+    WaveformOscillatorMethod GetMethod() const;
+
+    /**
+     * @brief Computes output[i] = amplitude * sin(phase[i]) + offset for a block of samples.
+     * @param[out] output the memory where to write the samples.
+     * @param[in] numberOfSamples the number of samples to compute.
+     * @param[in] phase0 the phase of the first sample (in radians).
+     * @param[in] delta0 the phase increment between the first and the second sample (in radians).
+     * @param[in] delta2 the change of the phase increment between consecutive samples (in radians).
+     * @param[in] amplitude the amplitude of the sinusoid.
+     * @param[in] offset the offset of the sinusoid.
+     * @pre
+     *   GetMethod() != WaveformOscillatorMethodDirect
+     */
+    void Generate(float64 * const output,
+                  const uint32 numberOfSamples,
+                  const float64 phase0,
+                  const float64 delta0,
+                  const float64 delta2,
+                  const float64 amplitude,
+                  const float64 offset) const;
+
+private:
+
+    /**
+     * @brief Implementation of Generate() for the Table method.
+     * @see Generate
+     */
+    void GenerateTable(float64 * const output,
+                       const uint32 numberOfSamples,
+                       const float64 phase0,
+                       const float64 delta0,
+                       const float64 delta2,
+                       const float64 amplitude,
+                       const float64 offset) const;
+
+    /**
+     * @brief Implementation of Generate() for the Recurrence method.
+     * @see Generate
+     */
+    void GenerateRecurrence(float64 * const output,
+                            const uint32 numberOfSamples,
+                            const float64 phase0,
+                            const float64 delta0,
+                            const float64 delta2,
+                            const float64 amplitude,
+                            const float64 offset) const;
+
+    /**
+     * The configured method.
+     */
+    WaveformOscillatorMethod method;
+
+    /**
+     * TableSize + 1 samples of a sin cycle (the last sample avoids wrapping the index while interpolating).
+     */
+    float64 *table;
+
+    /**
+     * log2(TableSize).
+     */
+    uint32 tableBits;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* WAVEFORMOSCILLATOR_H_ */
@@ -26,6 +26,7 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <math.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -51,10 +52,12 @@ WaveformPointsDef::WaveformPointsDef() :
         Waveform() {
     points = NULL_PTR(float64 *);
     times = NULL_PTR(float64 *);
+    slopes = NULL_PTR(float64 *);
     numberOfPointsElements = 0u;
     numberOfTimesElements = 0u;
     lastOutputValue = 0.0;
     indexSlopes = 0u;
+    periodStart = 0.0;
     beginningSequence = true;
     lastTimeValue = 0.0;
     pointRef1 = 0.0;
@@ -75,6 +78,10 @@ WaveformPointsDef::~WaveformPointsDef() {
         delete[] times;
         times = NULL_PTR(float64 *);
     }
+    if (slopes != NULL_PTR(float64 *)) {
+        delete[] slopes;
+        slopes = NULL_PTR(float64 *);
+    }
 }
 bool WaveformPointsDef::Initialise(StructuredDataI &data) {
     bool ok = Waveform::Initialise(data);
@@ -144,6 +151,15 @@ bool WaveformPointsDef::Initialise(StructuredDataI &data) {
             // numberOfSlopeElements = numberOfTimesElements - 1u;
         }
     }
+    if (ok) {
+        /*lint -e{613} points and times cannot be NULL as otherwise ok would be false*/
+        slopes = new float64[numberOfTimesElements - 1u];
+        for (uint32 i = 0u; i < (numberOfTimesElements - 1u); i++) {
+            uint32 aux = i + 1u;
+            slopes[i] = (points[aux] - points[i]) / (times[aux] - times[i]);
+        }
+        indexSlopes = numberOfTimesElements;
+    }
     return ok;
 }
 
@@ -151,11 +167,10 @@ bool WaveformPointsDef::PrecomputeValues() {
     for (uint32 i = 0u; (i < numberOfOutputElements); i++) {
         TriggerMechanism();
         FindNearestPoints();
-        Slope();
         if (signalOn && triggersOn) {
             if (outputFloat64 != NULL_PTR(float64 *)) {
                 //outputFloat64[i] = refVal + ((currentTime - timeRefVal) * slopes[indexSlopes]);
-                outputFloat64[i] = pointRef1 + ((currentTime - timeRef1) * slope);
+                outputFloat64[i] = pointRef1 + (((currentTime - periodStart) - timeRef1) * slope);
             }
         }
         else {
@@ -251,57 +266,68 @@ bool WaveformPointsDef::SearchIndex(const float64 preq, const float64 * const p,
 
 //lint -e{613} Possible use of a null pointer. It is not possible due to this function only is called inside Execute() and Execute() only is called if Setup() and initialise() succeed.
 void WaveformPointsDef::FindNearestPoints() {
-    bool found;
-    uint32 i = 0u;
-    found = SearchIndex(currentTime, times, numberOfTimesElements, i);
-    if (found) {
-        if (i > 0u) {
-            uint32 auxIndex = i - 1u;
-            pointRef1 = points[auxIndex];
-            pointRef2 = points[i];
-            timeRef1 = times[auxIndex];
-            timeRef2 = times[i];
+    float64 relativeTime = currentTime - periodStart;
+    bool inSegment = (indexSlopes < numberOfTimesElements);
+    if (inSegment) {
+        inSegment = (relativeTime < times[indexSlopes]);
+        if (inSegment && (indexSlopes > 0u)) {
+            uint32 auxIndex = indexSlopes - 1u;
+            inSegment = (times[auxIndex] <= relativeTime);
+        }
+    }
+    if (!inSegment) {
+        bool found = false;
+        uint32 next = indexSlopes + 1u;
+        if (next < numberOfTimesElements) {
+            //lint -e{661} next < numberOfTimesElements, hence indexSlopes is also in the bounds
+            found = ((times[indexSlopes] <= relativeTime) && (relativeTime < times[next]));
+        }
+        if (found) {
+            indexSlopes = next;
         }
         else {
-            uint32 auxIdx = numberOfPointsElements - 1u;
-            pointRef1 = points[auxIdx];
-            pointRef2 = points[i];
-            timeRef1 = remindTime;
-            timeRef2 = times[i];
+            found = SearchIndex(relativeTime, times, numberOfTimesElements, indexSlopes);
         }
-    }
-    else {
-        uint32 auxIdx2 = numberOfTimesElements - 1u;
-        remindTime = times[auxIdx2];
-        for (uint32 m = 0u; m < numberOfTimesElements; m++) { //update times
-            if (times != NULL_PTR(float64 *)) {
-                times[m] = times[m] + lastTimeValue + timeIncrement;
+        if (!found) {
+            //the sequence is repeated (skipping the whole repetitions if the time jumped more than one)
+            uint32 auxIdx2 = numberOfTimesElements - 1u;
+            float64 period = lastTimeValue + timeIncrement;
+            float64 repetitions = floor((relativeTime - lastTimeValue) / period);
+            if (repetitions > 0.0) {
+                periodStart += (repetitions * period);
             }
+            periodStart += period;
+            remindTime = times[auxIdx2] - period;
+            relativeTime = currentTime - periodStart;
+            found = SearchIndex(relativeTime, times, numberOfTimesElements, indexSlopes);
         }
-        i = 0u;
-        found = SearchIndex(currentTime, times, numberOfTimesElements, i);
         if (found) {
-            if (i == 0u) {
+            if (indexSlopes > 0u) {
+                uint32 auxIndex = indexSlopes - 1u;
+                pointRef1 = points[auxIndex];
+                timeRef1 = times[auxIndex];
+            }
+            else {
                 uint32 auxIdx = numberOfPointsElements - 1u;
                 pointRef1 = points[auxIdx];
-                pointRef2 = points[i];
                 timeRef1 = remindTime;
-                timeRef2 = times[i];
-            }
-            else {
-                uint32 auxIndex = i - 1u;
-                pointRef1 = points[auxIndex];
-                pointRef2 = points[i];
-                timeRef1 = times[auxIndex];
-                timeRef2 = times[i];
             }
+            pointRef2 = points[indexSlopes];
+            timeRef2 = times[indexSlopes];
+            Slope();
         }
     }
     return;
 }
 
+//lint -e{613} slopes cannot be NULL as this function is only called after a successful Initialise.
 void WaveformPointsDef::Slope() {
-    slope = (pointRef2 - pointRef1) / (timeRef2 - timeRef1);
+    if (indexSlopes > 0u) {
+        slope = slopes[indexSlopes - 1u];
+    }
+    else {
+        slope = (pointRef2 - pointRef1) / (timeRef2 - timeRef1);
+    }
     return;
 }
 
@@ -72,6 +72,9 @@ namespace MARTe {
  * </pre>
  *
  * The minimum number of points must be two, otherwise it is impossible to interpolated and the GAM exits with an initialisation error
+ *
+ * The slopes of the segments are computed in Initialise() and the current segment is cached, so that while the time advances the cost per
+ * output sample is constant. When the time jumps (e.g. after a trigger or a late cycle) the segment is found with a binary search.
  */
 class WaveformPointsDef: public Waveform {
 public:CLASS_REGISTER_DECLARATION()
@@ -229,10 +232,20 @@ private:
     float64 *times;
 
     /**
-     * Indicates the current applied slope
+     * slopes[i] is the slope of the segment between the points i and i + 1.
+     */
+    float64 *slopes;
+
+    /**
+     * Index of the point which ends the current segment (numberOfTimesElements if no segment is selected).
      */
     uint32 indexSlopes;
 
+    /**
+     * Time at which the current repetition of the sequence started (times are relative to it).
+     */
+    float64 periodStart;
+
     /**
      * number of points elements. The minimum number must be 2
      */
@@ -283,7 +296,7 @@ private:
      */
     float64 slope;
 
-    /*remind the last cycle time*/
+    /*remind the last cycle time (relative to periodStart)*/
     float64 remindTime;
 
     /**
@@ -295,14 +308,16 @@ private:
 
     /**
      * @brief Using the time decides between which points the interpolation must be done.
-     * @details given the times array looks the nearest points to currentTime. If currentTime is beyond
-     * the array the function updates times for the next interval and tries to find again.
+     * @details If currentTime is not in the current segment nor in the next one, looks the nearest points to currentTime
+     * with a binary search on the times array. If currentTime is beyond the array the function moves periodStart to the next
+     * repetition of the sequence and tries to find again. Calls Slope() when the segment changes.
      */
     void FindNearestPoints();
 
     /**
      * @brief computes the slope to be applied.
-     * @details slope = (pointRef2 - pointRef1)/(timeRef2 - timeRef1);
+     * @details slope = (pointRef2 - pointRef1)/(timeRef2 - timeRef1), taken from slopes except for the segment between the last
+     * point and the first point of the next repetition.
      */
     void Slope();
 
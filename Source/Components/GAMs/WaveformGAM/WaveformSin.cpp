@@ -101,21 +101,32 @@ bool WaveformSin::Initialise(StructuredDataI& data) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading offset");
         }
     }
+    if (ok) {
+        ok = oscillator.Initialise(data);
+    }
     return ok;
 }
 
 bool WaveformSin::PrecomputeValues() {
-    for (uint32 i = 0u; i < numberOfOutputElements; i++) {
-        TriggerMechanism();
-        if (signalOn && triggersOn) {
-            float64 aux = (w * currentTime) + phase;
-            float64 aux2 = sin(aux);
-            outputFloat64[i] = ((amplitude * aux2) + offset);
+    if (oscillator.GetMethod() != WaveformOscillatorMethodDirect) {
+        if (signalOn) {
+            oscillator.Generate(outputFloat64, numberOfOutputElements, (w * currentTime) + phase, w * timeIncrement, 0.0, amplitude, offset);
         }
-        else {
-            outputFloat64[i] = 0.0;
+        ApplyTriggerMechanism();
+    }
+    else {
+        for (uint32 i = 0u; i < numberOfOutputElements; i++) {
+            TriggerMechanism();
+            if (signalOn && triggersOn) {
+                float64 aux = (w * currentTime) + phase;
+                float64 aux2 = sin(aux);
+                outputFloat64[i] = ((amplitude * aux2) + offset);
+            }
+            else {
+                outputFloat64[i] = 0.0;
+            }
+            currentTime += timeIncrement;
         }
-        currentTime += timeIncrement;
     }
     return true;
 }
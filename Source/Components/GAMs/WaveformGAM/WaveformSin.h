@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "Waveform.h"
+#include "WaveformOscillator.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -49,6 +50,10 @@ namespace MARTe {
  *
  * where the phase must be in \b radian and the frequency in \b Hz.
  *
+ * By default sin() is called for each output sample. With the optional parameter Method = Table or Method = Recurrence the samples of each
+ * execution are computed, respectively, with a lookup table and a phase accumulator or with the rotation of the phasor of the first sample of the
+ * execution (see WaveformOscillator).
+ *
  * The input is a single value indicating the current time. The output can be a single array of N elements or multiple equal outputs of N
  * elements with different types (i.e example type output1 = uint8 and type output2 = float64.
  * Note that in the first iteration the output is always 0 due to the fact that a second time is needed to compute the time step (or time increment) for each output sample.
@@ -79,6 +84,8 @@ namespace MARTe {
  *     Frequency = 1.0
  *     Phase = 0.0
  *     Offset = 1.1
+ *     Method = Table //Optional. Direct (default), Table or Recurrence
+ *     TableSize = 4096 //Optional. Only valid with Method = Table
  *     StartTriggerTime = {0.1 0.3 0.5 1.8}
  *     StopTriggerTime = {0.2 0.4 0.6} //the StopTriggerTime has one time value less. It means that after the sequence of output on and off, the GAM will remain on forever
  *     InputSignals = {
@@ -247,6 +254,11 @@ private:
      */
     float64 offset;
 
+    /**
+     * Computes the samples when the Method is not Direct.
+     */
+    WaveformOscillator oscillator;
+
 };
 
 }
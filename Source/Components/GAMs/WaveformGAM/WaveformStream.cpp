@@ -0,0 +1,648 @@
+/**
+ * @file WaveformStream.cpp
+ * @brief Source file for class WaveformStream
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class WaveformStream (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "WaveformStream.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Maximum time that the prefetch thread waits for a free buffer before checking if it has to stop.
+ */
+static const uint32 WAVEFORM_STREAM_WAIT_TIMEOUT_MSEC = 200u;
+
+/**
+ * Size of the signal names in the header of the binary files.
+ */
+static const uint32 WAVEFORM_STREAM_SIGNAL_NAME_MAX_SIZE = 32u;
+
+/**
+ * @brief Reads a (possibly unaligned) value of type T from a row.
+ */
+template<typename T>
+static float64 WaveformStreamRead(const char8 * const value) {
+    T converted;
+    (void) MemoryOperationsHelper::Copy(&converted, value, static_cast<uint32>(sizeof(T)));
+    return static_cast<float64>(converted);
+}
+
+/**
+ * @brief Converts the value of a row to float64.
+ * @param[in] type the type of the value (see WaveformStreamIsNumeric).
+ * @param[in] value pointer to the value.
+ * @return the converted value (0 if the type is not supported).
+ */
+static float64 WaveformStreamToFloat64(const TypeDescriptor &type,
+                                       const char8 * const value) {
+    float64 converted = 0.0;
+    if (type == UnsignedInteger8Bit) {
+        converted = WaveformStreamRead<uint8>(value);
+    }
+    else if (type == SignedInteger8Bit) {
+        converted = WaveformStreamRead<int8>(value);
+    }
+    else if (type == UnsignedInteger16Bit) {
+        converted = WaveformStreamRead<uint16>(value);
+    }
+    else if (type == SignedInteger16Bit) {
+        converted = WaveformStreamRead<int16>(value);
+    }
+    else if (type == UnsignedInteger32Bit) {
+        converted = WaveformStreamRead<uint32>(value);
+    }
+    else if (type == SignedInteger32Bit) {
+        converted = WaveformStreamRead<int32>(value);
+    }
+    else if (type == UnsignedInteger64Bit) {
+        converted = WaveformStreamRead<uint64>(value);
+    }
+    else if (type == SignedInteger64Bit) {
+        converted = WaveformStreamRead<int64>(value);
+    }
+    else if (type == Float32Bit) {
+        converted = WaveformStreamRead<float32>(value);
+    }
+    else if (type == Float64Bit) {
+        converted = WaveformStreamRead<float64>(value);
+    }
+    else {
+        //NOOP
+    }
+    return converted;
+}
+
+/**
+ * @brief Returns true if the type is supported by WaveformStreamToFloat64.
+ */
+static bool WaveformStreamIsNumeric(const TypeDescriptor &type) {
+    bool isInteger = ((type == UnsignedInteger8Bit) || (type == SignedInteger8Bit) || (type == UnsignedInteger16Bit) || (type == SignedInteger16Bit));
+    isInteger = (isInteger) || ((type == UnsignedInteger32Bit) || (type == SignedInteger32Bit));
+    isInteger = (isInteger) || ((type == UnsignedInteger64Bit) || (type == SignedInteger64Bit));
+    return ((isInteger) || (type == Float32Bit) || (type == Float64Bit));
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+WaveformStream::WaveformStream() :
+        Waveform(),
+        EmbeddedServiceMethodBinderI(),
+        executor(*this) {
+    dataStart = 0u;
+    rowSize = 0u;
+    numberOfSamples = 0u;
+    valueElement = 0u;
+    valueOffset = 0u;
+    valueType = InvalidType;
+    timeScale = 1e-6;
+    timeOffset = 0u;
+    timeType = InvalidType;
+    samplingPeriod = 0.0;
+    holdLast = true;
+    bufferSize = 65536u;
+    numberOfBuffers = 4u;
+    cpuMask = ProcessorType(0xFFu);
+    bufferTimes = NULL_PTR(float64 **);
+    bufferValues = NULL_PTR(float64 **);
+    bufferSamples = NULL_PTR(uint32 *);
+    rows = NULL_PTR(char8 *);
+    prefetchReady = 0;
+    prefetchEnd = false;
+    fillIndex = 0u;
+    fileSampleIndex = 0u;
+    firstFileTime = 0.0;
+    lastFileTime = 0.0;
+    readIndex = 0u;
+    readOffset = 0u;
+    previousTime = 0.0;
+    previousValue = 0.0;
+    nextTime = 0.0;
+    nextValue = 0.0;
+    primed = false;
+    started = false;
+    streamStart = 0.0;
+    endOfStream = false;
+    numberOfUnderruns = 0u;
+    if (!prefetchFreeSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create the EventSem");
+    }
+}
+
+/*lint -e{1551} the destructor must guarantee that the prefetch thread is stopped before the ring is freed.*/
+WaveformStream::~WaveformStream() {
+    if (executor.GetStatus() != EmbeddedThreadI::OffState) {
+        if (!executor.Stop()) {
+            if (!executor.Stop()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the prefetch thread");
+            }
+        }
+    }
+    if (bufferTimes != NULL_PTR(float64 **)) {
+        for (uint32 i = 0u; i < numberOfBuffers; i++) {
+            delete[] bufferTimes[i];
+        }
+        delete[] bufferTimes;
+    }
+    if (bufferValues != NULL_PTR(float64 **)) {
+        for (uint32 i = 0u; i < numberOfBuffers; i++) {
+            delete[] bufferValues[i];
+        }
+        delete[] bufferValues;
+    }
+    if (bufferSamples != NULL_PTR(uint32 *)) {
+        delete[] bufferSamples;
+    }
+    if (rows != NULL_PTR(char8 *)) {
+        delete[] rows;
+    }
+    if (inputFile.IsOpen()) {
+        (void) inputFile.Close();
+    }
+    (void) prefetchFreeSem.Close();
+}
+
+bool WaveformStream::Initialise(StructuredDataI &data) {
+    bool ok = Waveform::Initialise(data);
+    if (!ok) { //Waveform::Initialise only fails if GAM::Initialise fails.
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Error. Waveform::Initialise");
+    }
+    if (ok) {
+        ok = data.Read("Filename", filename);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Filename shall be specified");
+        }
+    }
+    if (ok) {
+        if (!data.Read("Signal", valueSignal)) {
+            valueSignal = "";
+        }
+        if (!data.Read("Element", valueElement)) {
+            valueElement = 0u;
+        }
+        if (data.Read("TimeSignal", timeSignal)) {
+            if (!data.Read("TimeScale", timeScale)) {
+                timeScale = 1e-6;
+            }
+            ok = (timeScale > 0.0);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "TimeScale shall be positive");
+            }
+        }
+        else {
+            timeSignal = "";
+            ok = data.Read("SamplingPeriod", samplingPeriod);
+            if (ok) {
+                ok = (samplingPeriod > 0.0);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "A positive SamplingPeriod shall be specified if the TimeSignal is not set");
+            }
+        }
+    }
+    if (ok) {
+        if (!data.Read("BufferSize", bufferSize)) {
+            bufferSize = 65536u;
+        }
+        ok = (bufferSize > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "BufferSize shall be positive");
+        }
+    }
+    if (ok) {
+        if (!data.Read("NumberOfBuffers", numberOfBuffers)) {
+            numberOfBuffers = 4u;
+        }
+        ok = (numberOfBuffers > 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "NumberOfBuffers shall be at least 2");
+        }
+    }
+    if (ok) {
+        StreamString eof;
+        if (data.Read("EOF", eof)) {
+            if (eof == "Last") {
+                holdLast = true;
+            }
+            else if (eof == "Zero") {
+                holdLast = false;
+            }
+            else {
+                ok = false;
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Invalid EOF %s. Valid values are Last and Zero", eof.Buffer());
+            }
+        }
+        uint32 cpuMaskIn;
+        if (data.Read("CPUMask", cpuMaskIn)) {
+            cpuMask = ProcessorType(cpuMaskIn);
+        }
+    }
+    if (ok) {
+        ok = inputFile.Open(filename.Buffer(), BasicFile::ACCESS_MODE_R);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Could not open the file %s", filename.Buffer());
+        }
+    }
+    if (ok) {
+        ok = ReadHeader();
+    }
+    if (ok) {
+        uint64 rowsSize = static_cast<uint64>(bufferSize) * rowSize;
+        ok = (rowsSize < 0xFFFFFFFFu);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The buffers (BufferSize * %u bytes) shall be smaller than 4 GB", rowSize);
+        }
+    }
+    if (ok) {
+        bufferTimes = new float64*[numberOfBuffers];
+        bufferValues = new float64*[numberOfBuffers];
+        bufferSamples = new uint32[numberOfBuffers];
+        for (uint32 i = 0u; i < numberOfBuffers; i++) {
+            bufferTimes[i] = new float64[bufferSize];
+            bufferValues[i] = new float64[bufferSize];
+            bufferSamples[i] = 0u;
+        }
+        rows = new char8[bufferSize * rowSize];
+        //Fill the ring and read the first two samples (the file has at least two samples and the ring at least two buffers)
+        Prefetch();
+        ok = NextSample(previousTime, previousValue);
+        if (ok) {
+            ok = NextSample(nextTime, nextValue);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Could not read the first samples of the file %s", filename.Buffer());
+        }
+    }
+    if (ok) {
+        primed = true;
+        //Refill the buffer(s) read above
+        Prefetch();
+        //If the whole file is already in the ring there is nothing else to prefetch
+        if (!prefetchEnd) {
+            executor.SetName(GetName());
+            executor.SetCPUMask(cpuMask);
+            ok = (executor.Start() == ErrorManagement::NoError);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the prefetch thread");
+            }
+        }
+    }
+    return ok;
+}
+
+bool WaveformStream::Execute() {
+    return Waveform::Execute();
+}
+
+ErrorManagement::ErrorType WaveformStream::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        (void) prefetchFreeSem.Reset();
+        if ((static_cast<uint32>(prefetchReady) == numberOfBuffers) || (prefetchEnd)) {
+            (void) prefetchFreeSem.Wait(WAVEFORM_STREAM_WAIT_TIMEOUT_MSEC);
+        }
+        Prefetch();
+    }
+    return ErrorManagement::NoError;
+}
+
+bool WaveformStream::ReadHeader() {
+    uint32 nOfSignals = 0u;
+    uint32 readSize = static_cast<uint32>(sizeof(uint32));
+    /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+    bool ok = inputFile.Read(reinterpret_cast<char8*>(&nOfSignals), readSize);
+    if (ok) {
+        ok = (readSize == static_cast<uint32>(sizeof(uint32)));
+    }
+    bool foundValue = false;
+    bool foundTime = (timeSignal.Size() == 0u);
+    uint32 offset = 0u;
+    for (uint32 n = 0u; (n < nOfSignals) && (ok); n++) {
+        TypeDescriptor signalType;
+        readSize = static_cast<uint32>(sizeof(uint16));
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+        ok = inputFile.Read(reinterpret_cast<char8*>(&signalType.all), readSize);
+        char8 signalNameMemory[WAVEFORM_STREAM_SIGNAL_NAME_MAX_SIZE + 1u];
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(&signalNameMemory[0], '\0', WAVEFORM_STREAM_SIGNAL_NAME_MAX_SIZE + 1u);
+        }
+        if (ok) {
+            readSize = WAVEFORM_STREAM_SIGNAL_NAME_MAX_SIZE;
+            ok = inputFile.Read(&signalNameMemory[0], readSize);
+        }
+        uint32 nOfElements = 0u;
+        if (ok) {
+            readSize = static_cast<uint32>(sizeof(uint32));
+            /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Read function.*/
+            ok = inputFile.Read(reinterpret_cast<char8*>(&nOfElements), readSize);
+        }
+        if (ok) {
+            ok = (readSize == static_cast<uint32>(sizeof(uint32)));
+        }
+        if (ok) {
+            StreamString signalName = &signalNameMemory[0];
+            uint32 elementSize = static_cast<uint32>(signalType.numberOfBits) / 8u;
+            if ((!foundTime) && (timeSignal == signalName.Buffer())) {
+                foundTime = true;
+                timeOffset = offset;
+                timeType = signalType;
+                ok = (WaveformStreamIsNumeric(signalType)) && (nOfElements == 1u);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The TimeSignal %s shall be a numeric scalar", timeSignal.Buffer());
+                }
+            }
+            else if ((!foundValue) && ((valueSignal.Size() == 0u) || (valueSignal == signalName.Buffer()))) {
+                foundValue = true;
+                valueSignal = signalName;
+                valueOffset = offset + (valueElement * elementSize);
+                valueType = signalType;
+                ok = (WaveformStreamIsNumeric(signalType)) && (valueElement < nOfElements);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The Signal %s shall be numeric and have more than %u elements", valueSignal.Buffer(),
+                                 valueElement);
+                }
+            }
+            else {
+                //NOOP
+            }
+            offset += elementSize * nOfElements;
+        }
+    }
+    if (ok) {
+        ok = (foundValue) && (foundTime);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The Signal and the TimeSignal shall be signals of the file %s", filename.Buffer());
+        }
+    }
+    if (ok) {
+        rowSize = offset;
+        dataStart = inputFile.Position();
+        uint64 dataSize = inputFile.Size() - dataStart;
+        ok = (rowSize > 0u);
+        if (ok) {
+            ok = ((dataSize % rowSize) == 0u);
+        }
+        if (ok) {
+            numberOfSamples = dataSize / rowSize;
+            ok = (numberOfSamples > 1u);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError,
+                         "The data of the file %s (%! bytes) shall be a multiple of the size of a row (%u bytes) with at least two rows", filename.Buffer(),
+                         dataSize, rowSize);
+        }
+    }
+    return ok;
+}
+
+void WaveformStream::Prefetch() {
+    while ((static_cast<uint32>(prefetchReady) < numberOfBuffers) && (!prefetchEnd)) {
+        bool endOfFile = false;
+        bool ok = FillBuffer(fillIndex, endOfFile);
+        /*lint -e{613} bufferSamples cannot be NULL if the ring is being filled*/
+        if ((ok) && (bufferSamples[fillIndex] > 0u)) {
+            fillIndex++;
+            if (fillIndex == numberOfBuffers) {
+                fillIndex = 0u;
+            }
+            //Atomic::Increment is a full memory barrier: the real-time thread sees the buffer before the new prefetchReady
+            Atomic::Increment(&prefetchReady);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to prefetch from the file %s", filename.Buffer());
+        }
+        //Set after the last buffer was queued
+        prefetchEnd = ((!ok) || (endOfFile));
+    }
+}
+
+/*lint -e{613} rows, bufferTimes, bufferValues and bufferSamples cannot be NULL if the ring is being filled*/
+bool WaveformStream::FillBuffer(const uint32 idx,
+                                bool &endOfFile) {
+    uint64 remaining = numberOfSamples - fileSampleIndex;
+    uint32 samplesToRead = bufferSize;
+    if (remaining < samplesToRead) {
+        samplesToRead = static_cast<uint32>(remaining);
+    }
+    bool ok = true;
+    uint32 readSize = samplesToRead * rowSize;
+    if (readSize > 0u) {
+        ok = inputFile.Read(rows, readSize);
+        if (ok) {
+            ok = (readSize == (samplesToRead * rowSize));
+        }
+    }
+    bool hasTimeSignal = (timeSignal.Size() > 0u);
+    uint32 validSamples = 0u;
+    for (uint32 s = 0u; (s < samplesToRead) && (ok); s++) {
+        const char8 * const row = &rows[s * rowSize];
+        float64 time;
+        if (hasTimeSignal) {
+            time = WaveformStreamToFloat64(timeType, &row[timeOffset]) * timeScale;
+            if (fileSampleIndex == 0u) {
+                firstFileTime = time;
+            }
+            else {
+                ok = (time > lastFileTime);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "The TimeSignal of the file %s is not increasing at the sample %!", filename.Buffer(),
+                                 fileSampleIndex);
+                }
+            }
+            lastFileTime = time;
+            time -= firstFileTime;
+        }
+        else {
+            time = static_cast<float64>(fileSampleIndex) * samplingPeriod;
+        }
+        if (ok) {
+            bufferTimes[idx][s] = time;
+            bufferValues[idx][s] = WaveformStreamToFloat64(valueType, &row[valueOffset]);
+            validSamples++;
+            fileSampleIndex++;
+        }
+    }
+    bufferSamples[idx] = validSamples;
+    endOfFile = (fileSampleIndex == numberOfSamples);
+    if ((!ok) && (validSamples > 0u)) {
+        //On a time error only the samples before the error are streamed (prefetchEnd is set by the caller)
+        ok = true;
+        endOfFile = true;
+    }
+    return ok;
+}
+
+/*lint -e{613} bufferTimes, bufferValues and bufferSamples cannot be NULL after a successful Initialise*/
+bool WaveformStream::NextSample(float64 &time,
+                                float64 &value) {
+    //Read prefetchEnd before prefetchReady: the last buffer is queued before prefetchEnd is set
+    bool ended = prefetchEnd;
+    bool ok = (prefetchReady > 0);
+    if (ok) {
+        time = bufferTimes[readIndex][readOffset];
+        value = bufferValues[readIndex][readOffset];
+        readOffset++;
+        if (readOffset >= bufferSamples[readIndex]) {
+            readOffset = 0u;
+            readIndex++;
+            if (readIndex == numberOfBuffers) {
+                readIndex = 0u;
+            }
+            Atomic::Decrement(&prefetchReady);
+            (void) prefetchFreeSem.Post();
+        }
+    }
+    else {
+        endOfStream = ended;
+    }
+    return ok;
+}
+
+float64 WaveformStream::Interpolate(const float64 time,
+                                    bool &underrun) {
+    underrun = false;
+    bool available = true;
+    while ((time >= nextTime) && (available) && (!endOfStream)) {
+        float64 sampleTime = 0.0;
+        float64 sampleValue = 0.0;
+        available = NextSample(sampleTime, sampleValue);
+        if (available) {
+            previousTime = nextTime;
+            previousValue = nextValue;
+            nextTime = sampleTime;
+            nextValue = sampleValue;
+        }
+    }
+    float64 value;
+    if (time < nextTime) {
+        value = previousValue + (((time - previousTime) * (nextValue - previousValue)) / (nextTime - previousTime));
+    }
+    else if (endOfStream) {
+        value = (holdLast) ? (nextValue) : (0.0);
+    }
+    else {
+        underrun = true;
+        value = nextValue;
+    }
+    return value;
+}
+
+/*lint -e{613} outputFloat64 cannot be NULL as otherwise Execute will not be called*/
+bool WaveformStream::PrecomputeValues() {
+    bool underrun = false;
+    for (uint32 i = 0u; (i < numberOfOutputElements); i++) {
+        TriggerMechanism();
+        bool on = (signalOn && triggersOn);
+        if ((on) && (!started)) {
+            started = true;
+            streamStart = currentTime;
+        }
+        float64 value = 0.0;
+        //Once started the stream advances also while the output is off, so that the ring keeps being consumed
+        if ((started) && (primed)) {
+            bool sampleUnderrun = false;
+            value = Interpolate(currentTime - streamStart, sampleUnderrun);
+            underrun = ((underrun) || (sampleUnderrun));
+        }
+        outputFloat64[i] = (on) ? (value) : (0.0);
+        currentTime += timeIncrement;
+    }
+    if (underrun) {
+        numberOfUnderruns++;
+    }
+    return true;
+}
+
+bool WaveformStream::TimeIncrementValidation() {
+    return true;
+}
+
+uint64 WaveformStream::GetNumberOfUnderruns() const {
+    return numberOfUnderruns;
+}
+
+uint64 WaveformStream::GetNumberOfSamples() const {
+    return numberOfSamples;
+}
+
+bool WaveformStream::IsEndOfStream() const {
+    return endOfStream;
+}
+
+bool WaveformStream::GetInt8Value() {
+    return WaveformStream::GetValue<int8>();
+}
+
+bool WaveformStream::GetUInt8Value() {
+    return WaveformStream::GetValue<uint8>();
+}
+
+bool WaveformStream::GetInt16Value() {
+    return WaveformStream::GetValue<int16>();
+}
+
+bool WaveformStream::GetUInt16Value() {
+    return WaveformStream::GetValue<uint16>();
+}
+
+bool WaveformStream::GetInt32Value() {
+    return WaveformStream::GetValue<int32>();
+}
+
+bool WaveformStream::GetUInt32Value() {
+    return WaveformStream::GetValue<uint32>();
+}
+
+bool WaveformStream::GetInt64Value() {
+    return WaveformStream::GetValue<int64>();
+}
+
+bool WaveformStream::GetUInt64Value() {
+    return WaveformStream::GetValue<uint64>();
+}
+
+bool WaveformStream::GetFloat32Value() {
+    return WaveformStream::GetValue<float32>();
+}
+
+bool WaveformStream::GetFloat64Value() {
+    return WaveformStream::GetValue<float64>();
+}
+
+CLASS_REGISTER(WaveformStream, "1.0")
+
+}
@@ -0,0 +1,408 @@
+/**
+ * @file WaveformStream.h
+ * @brief Header file for class WaveformStream
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class WaveformStream
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef WAVEFORMSTREAM_H_
+#define WAVEFORMSTREAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "File.h"
+#include "SingleThreadService.h"
+#include "Waveform.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief GAM which generates an arbitrary waveform streamed from a binary file written by the FileWriter.
+ * @details Unlike WaveformPointsDef, the points are not loaded from the configuration: they are read from a binary (uncompressed and with the
+ * row layout) FileWriter file by a prefetch thread, BufferSize samples at a time, into a ring of NumberOfBuffers buffers. The real-time thread
+ * only reads the buffers of the ring and interpolates linearly the samples to the time of each output element: it never reads the file nor waits
+ * for the prefetch thread. If the next sample is not prefetched yet the last sample is held (an underrun, see GetNumberOfUnderruns()) and the
+ * stream catches up in the next cycles. The first buffers are filled in Initialise().
+ *
+ * The value of each sample is the element Element of the signal Signal of the file. The time of each sample is either the signal TimeSignal of the
+ * file (multiplied by TimeScale, it shall be strictly increasing) or, if TimeSignal is not set, the index of the sample multiplied by
+ * SamplingPeriod. The time of the first sample is the start of the stream.
+ *
+ * The stream starts at the first output element where the output is on (see the trigger mechanism of Waveform), i.e. the first sample of the
+ * file is aligned with the first StartTriggerTime (or with the first cycle after the first one, if the trigger mechanism is not set). From then
+ * on the stream advances with the input time: the stop triggers only set the output to 0. When all the samples are streamed the output is the
+ * last sample (EOF = "Last") or 0 (EOF = "Zero").
+ *
+ * The configuration syntax is (names and signal quantity are only given as an example):
+ *<pre>
+ * +waveformStream1 = {
+ *     Class = WaveformStream
+ *     Filename = "/data/scenario.bin" //Compulsory. Binary file written by a FileWriter (FileFormat = binary, without compression).
+ *     Signal = CoilCurrent //Optional. The signal of the file with the values. Default = the first signal which is not the TimeSignal.
+ *     Element = 0 //Optional. The element of Signal with the values. Default = 0.
+ *     TimeSignal = Time //Optional. The signal of the file with the time of each sample. If not set SamplingPeriod is compulsory.
+ *     TimeScale = 1e-6 //Optional. Only meaningful if TimeSignal is set. Factor which converts the TimeSignal into seconds. Default = 1e-6.
+ *     SamplingPeriod = 1e-3 //Only if TimeSignal is not set. The time between two samples of the file in seconds.
+ *     BufferSize = 65536 //Optional. Number of samples read at a time by the prefetch thread. Default = 65536.
+ *     NumberOfBuffers = 4 //Optional. Number of buffers in the ring (at least 2). Default = 4.
+ *     EOF = "Last" //Optional. "Last" (hold the last sample) or "Zero". Default = "Last".
+ *     CPUMask = 0x2 //Optional. Affinity of the prefetch thread. Default = 0xFF.
+ *     StartTriggerTime = {0.1} //Optional. See Waveform.
+ *     StopTriggerTime = {} //Optional. See Waveform.
+ *     InputSignals = {
+ *         Time = {
+ *             DataSource = "DDB1"
+ *             Type = uint32 //Supported type uint32 (int32 | int64 | uint64 are also valid types)
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         OutputSignal1 = {
+ *             DataSource = "DDB1"
+ *             Type = float32
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class WaveformStream: public Waveform, public EmbeddedServiceMethodBinderI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default constructor. NOOP.
+     */
+    WaveformStream();
+
+    /**
+     * @brief Destructor. Stops the prefetch thread and frees the ring.
+     */
+    virtual ~WaveformStream();
+
+    /**
+     * @brief Initialise the GAM from a configuration file.
+     * @details Reads the parameters, opens the file, checks that the selected signals exist and that the file has at least two samples,
+     * fills the ring and starts the prefetch thread.
+     * @return true if all parameters are valid and the file could be read.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief See Waveform::Execute().
+     * @return see Waveform::Execute().
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Fills the free buffers of the ring (called by the prefetch thread).
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Copies the waveform to the output signal in uint8.
+     * @return true always
+     */
+    virtual bool GetUInt8Value();
+
+    /**
+     * @brief Copies the waveform to the output signal in int8.
+     * @return true always
+     */
+    virtual bool GetInt8Value();
+
+    /**
+     * @brief Copies the waveform to the output signal in uint16.
+     * @return true always
+     */
+    virtual bool GetUInt16Value();
+
+    /**
+     * @brief Copies the waveform to the output signal in int16.
+     * @return true always
+     */
+    virtual bool GetInt16Value();
+
+    /**
+     * @brief Copies the waveform to the output signal in uint32.
+     * @return true always
+     */
+    virtual bool GetUInt32Value();
+
+    /**
+     * @brief Copies the waveform to the output signal in int32.
+     * @return true always
+     */
+    virtual bool GetInt32Value();
+
+    /**
+     * @brief Copies the waveform to the output signal in uint64.
+     * @return true always
+     */
+    virtual bool GetUInt64Value();
+
+    /**
+     * @brief Copies the waveform to the output signal in int64.
+     * @return true always
+     */
+    virtual bool GetInt64Value();
+
+    /**
+     * @brief Copies the waveform to the output signal in float32.
+     * @return true always
+     */
+    virtual bool GetFloat32Value();
+
+    /**
+     * @brief Copies the waveform to the output signal in float64.
+     * @return true always
+     */
+    virtual bool GetFloat64Value();
+
+    /**
+     * @brief Gets the number of cycles where at least one output element held the last sample because the next one was not prefetched yet.
+     * @return the number of underruns.
+     */
+    uint64 GetNumberOfUnderruns() const;
+
+    /**
+     * @brief Gets the number of samples of the file.
+     * @return the number of samples of the file.
+     */
+    uint64 GetNumberOfSamples() const;
+
+    /**
+     * @brief Returns true when all the samples of the file were streamed.
+     * @return true when all the samples of the file were streamed.
+     */
+    bool IsEndOfStream() const;
+
+protected:
+
+    /**
+     * @brief Interpolates the stream at the time of each output element and applies the trigger mechanism.
+     * @return true always.
+     */
+    virtual bool PrecomputeValues();
+
+    /**
+     * @brief Any time increment is valid: the samples between two output elements are skipped.
+     * @return true always.
+     */
+    virtual bool TimeIncrementValidation();
+
+private:
+
+    /**
+     * @brief Casts the waveform computed by PrecomputeValues() to the specified type.
+     * @return true always
+     */
+    template<typename T>
+    bool GetValue();
+
+    /**
+     * @brief Reads the header of the file and finds the time and value signals.
+     * @return true if the header is valid and the signals exist.
+     */
+    bool ReadHeader();
+
+    /**
+     * @brief Fills the free buffers of the ring with the next samples of the file.
+     * @details Called by Initialise() (before the thread is started) and by the prefetch thread.
+     */
+    void Prefetch();
+
+    /**
+     * @brief Reads the next BufferSize samples of the file into the buffer \a idx of the ring.
+     * @param[in] idx the buffer to fill.
+     * @param[out] endOfFile true if the end of the file was reached.
+     * @return true if the samples could be read and if the time is strictly increasing.
+     */
+    bool FillBuffer(const uint32 idx,
+                    bool &endOfFile);
+
+    /**
+     * @brief Reads the next prefetched sample (real-time thread).
+     * @details Hands the buffer back to the prefetch thread when its last sample is read.
+     * @param[out] time the time of the sample.
+     * @param[out] value the value of the sample.
+     * @return true if a prefetched sample was available. If not, endOfStream is set if the prefetch thread reached the end of the file.
+     */
+    bool NextSample(float64 &time,
+                    float64 &value);
+
+    /**
+     * @brief Interpolates the stream at \a time (relative to the start of the stream).
+     * @param[in] time the time relative to the start of the stream.
+     * @param[out] underrun true if the value was held because the next sample was not prefetched yet.
+     * @return the value of the waveform.
+     */
+    float64 Interpolate(const float64 time,
+                        bool &underrun);
+
+    /**
+     * The file and its name.
+     */
+    File inputFile;
+    StreamString filename;
+
+    /**
+     * Offset (in the file) of the first sample, size of a sample and number of samples.
+     */
+    uint64 dataStart;
+    uint32 rowSize;
+    uint64 numberOfSamples;
+
+    /**
+     * The Signal, Element, TimeSignal and TimeScale parameters and the offset and the type of the value and of the time in a row.
+     */
+    StreamString valueSignal;
+    uint32 valueElement;
+    uint32 valueOffset;
+    TypeDescriptor valueType;
+    StreamString timeSignal;
+    float64 timeScale;
+    uint32 timeOffset;
+    TypeDescriptor timeType;
+
+    /**
+     * The SamplingPeriod parameter (only used if there is no TimeSignal).
+     */
+    float64 samplingPeriod;
+
+    /**
+     * True if EOF = "Last".
+     */
+    bool holdLast;
+
+    /**
+     * The BufferSize, NumberOfBuffers and CPUMask parameters.
+     */
+    uint32 bufferSize;
+    uint32 numberOfBuffers;
+    ProcessorType cpuMask;
+
+    /**
+     * The ring of prefetched samples (times relative to the first sample of the file) and the number of samples in each buffer.
+     */
+    float64 **bufferTimes;
+    float64 **bufferValues;
+    uint32 *bufferSamples;
+
+    /**
+     * The rows read from the file (BufferSize rows, only used by the prefetch thread).
+     */
+    char8 *rows;
+
+    /**
+     * Number of filled buffers (written by both threads).
+     */
+    volatile int32 prefetchReady;
+
+    /**
+     * Set by the prefetch thread after queueing the last buffer or on a read error.
+     */
+    volatile bool prefetchEnd;
+
+    /**
+     * The next buffer to be filled and the index of the next sample of the file (prefetch thread).
+     */
+    uint32 fillIndex;
+    uint64 fileSampleIndex;
+
+    /**
+     * The time of the first sample and of the last sample read (prefetch thread).
+     */
+    float64 firstFileTime;
+    float64 lastFileTime;
+
+    /**
+     * The next buffer to be read and the index of the next sample in it (real-time thread).
+     */
+    uint32 readIndex;
+    uint32 readOffset;
+
+    /**
+     * The samples before and after the current time of the stream.
+     */
+    float64 previousTime;
+    float64 previousValue;
+    float64 nextTime;
+    float64 nextValue;
+
+    /**
+     * True when the first two samples were read.
+     */
+    bool primed;
+
+    /**
+     * True when the stream started and the time (of the input) at which it started.
+     */
+    bool started;
+    float64 streamStart;
+
+    /**
+     * True when all the samples were streamed.
+     */
+    bool endOfStream;
+
+    /**
+     * Number of cycles with an underrun.
+     */
+    uint64 numberOfUnderruns;
+
+    /**
+     * Posted when a buffer is handed back to the prefetch thread.
+     */
+    EventSem prefetchFreeSem;
+
+    /**
+     * The prefetch thread.
+     */
+    SingleThreadService executor;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+template<typename T>
+bool WaveformStream::GetValue() {
+    for (uint32 i = 0u; (i < numberOfOutputElements); i++) {
+        static_cast<T*>(outputValue[indexOutputSignal])[i] = static_cast<T>(outputFloat64[i]);
+    }
+    return true;
+}
+
+}
+
+#endif /* WAVEFORMSTREAM_H_ */
@@ -0,0 +1,253 @@
+/**
+ * @file AsyncStartup.h
+ * @brief Header file for class AsyncStartup
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class AsyncStartup
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef ASYNCSTARTUP_H_
+#define ASYNCSTARTUP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "SingleThreadService.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief The startup work (e.g. connecting to a server) which is executed by an AsyncStartup.
+ */
+class AsyncStartupTaskI {
+public:
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~AsyncStartupTaskI() {
+    }
+
+    /**
+     * @brief Executes the startup work. Called once, in the context of the AsyncStartup thread.
+     * @return false if the startup failed.
+     */
+    virtual bool ExecuteStartup() = 0;
+};
+
+/**
+ * @brief Executes the startup work of a DataSource in a separate thread, so that the startup of several DataSources overlaps.
+ * @details The RealTimeApplication calls the SetConfiguredDatabase of all the DataSources, then the AllocateMemory of all the
+ * DataSources and then the PrepareNextState of all the DataSources, one DataSource at the time. A DataSource which connects (e.g. to
+ * an EPICS or OPC UA server, or to an MDSplus tree) in one of these methods thus delays the startup of all the other DataSources.
+ * With an AsyncStartup the DataSource Start()s the connection (typically at the end of SetConfiguredDatabase) and only Wait()s for
+ * its completion where the connection is first needed (typically in AllocateMemory or in the first PrepareNextState): the connections
+ * of all the DataSources are then performed in parallel and the startup time is bounded by the slowest connection (and not by their sum).
+ *
+ * The task shall not be accessed by the DataSource until Wait() returns. The thread is stopped by Wait().
+ */
+class AsyncStartup: public EmbeddedServiceMethodBinderI {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     * @post
+     *   IsStarted() == false
+     */
+    AsyncStartup();
+
+    /**
+     * @brief Waits for the completion of the startup work (if started) and stops the thread.
+     */
+    virtual ~AsyncStartup();
+
+    /**
+     * @brief Starts the thread which executes task.ExecuteStartup().
+     * @param[in] taskIn the startup work.
+     * @param[in] name the name of the thread.
+     * @return true if the thread was started and Start() was not already called.
+     */
+    bool Start(AsyncStartupTaskI &taskIn,
+               const char8 * const name);
+
+    /**
+     * @brief Waits for the completion of the startup work and stops the thread.
+     * @param[in] timeout the maximum time to wait.
+     * @return the value returned by ExecuteStartup() or false if the startup was not started or did not complete within the timeout.
+     * Once the startup is completed, further calls return the same value without waiting.
+     */
+    bool Wait(const TimeoutType &timeout = TTInfiniteWait);
+
+    /**
+     * @brief Queries if Start() was successfully called.
+     */
+    bool IsStarted() const;
+
+    /**
+     * @brief Queries if the startup work has been completed.
+     */
+    bool IsCompleted() const;
+
+    /**
+     * @brief SingleThreadService callback. Executes the startup work once and then idles until Wait() stops the thread.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+private:
+    /**
+     * The thread which executes the startup work.
+     */
+    SingleThreadService service;
+
+    /**
+     * Posted when the startup work is completed.
+     */
+    EventSem completedSem;
+
+    /**
+     * The startup work.
+     */
+    AsyncStartupTaskI *task;
+
+    /**
+     * The value returned by ExecuteStartup().
+     */
+    bool result;
+
+    /**
+     * True if Start() was successfully called.
+     */
+    bool started;
+
+    /**
+     * True when the startup work has been completed.
+     */
+    volatile bool completed;
+
+    /**
+     * True when the thread has been stopped.
+     */
+    bool stopped;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+inline AsyncStartup::AsyncStartup() :
+        EmbeddedServiceMethodBinderI(),
+        service(*this) {
+    task = NULL_PTR(AsyncStartupTaskI *);
+    result = false;
+    started = false;
+    completed = false;
+    stopped = false;
+    if (!completedSem.Create()) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not create EventSem.");
+    }
+    if (!completedSem.Reset()) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not reset EventSem.");
+    }
+}
+
+/*lint -e{1551} the destructor must guarantee that the thread is stopped before the task is released.*/
+inline AsyncStartup::~AsyncStartup() {
+    if (started) {
+        (void) Wait();
+    }
+    (void) completedSem.Close();
+    task = NULL_PTR(AsyncStartupTaskI *);
+}
+
+inline bool AsyncStartup::Start(AsyncStartupTaskI &taskIn,
+                                const char8 * const name) {
+    bool ok = !started;
+    if (ok) {
+        task = &taskIn;
+        service.SetName(name);
+        ok = (service.Start() == ErrorManagement::NoError);
+        started = ok;
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not start the startup thread of %s", name);
+        }
+    }
+    return ok;
+}
+
+inline bool AsyncStartup::Wait(const TimeoutType &timeout) {
+    bool ok = started;
+    if ((ok) && (!stopped)) {
+        ok = (completedSem.Wait(timeout) == ErrorManagement::NoError);
+        if (ok) {
+            if (!service.Stop()) {
+                if (!service.Stop()) {
+                    REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+                }
+            }
+            stopped = true;
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::Timeout, "The startup was not completed within the timeout.");
+        }
+    }
+    if (ok) {
+        ok = result;
+    }
+    return ok;
+}
+
+inline bool AsyncStartup::IsStarted() const {
+    return started;
+}
+
+inline bool AsyncStartup::IsCompleted() const {
+    return completed;
+}
+
+inline ErrorManagement::ErrorType AsyncStartup::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        if (!completed) {
+            if (task != NULL_PTR(AsyncStartupTaskI *)) {
+                result = task->ExecuteStartup();
+            }
+            completed = true;
+            (void) completedSem.Post();
+        }
+        else {
+            Sleep::MSec(10u);
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+}
+
+#endif /* ASYNCSTARTUP_H_ */
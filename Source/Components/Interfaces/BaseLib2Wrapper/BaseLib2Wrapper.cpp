@@ -34,7 +34,6 @@
 #include "AdvancedErrorManagement.h"
 #include "BaseLib2Wrapper.h"
 #include "BaseLib2WrapperMessageFilter.h"
-#include "ConfigurationDatabase.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -49,6 +48,10 @@ namespace MARTe {
 BaseLib2Wrapper::BaseLib2Wrapper() :
         Object(),
         QueuedMessageI() {
+    messagePool = NULL_PTR(ReferenceT<Message> *);
+    messagePoolSize = 16u;
+    reusedMessages = 0u;
+    (void) messagePoolMux.Create();
     BaseLib2::Adapter::Instance()->SetAdapterMessageListener(this);
 }
 
@@ -63,6 +66,10 @@ BaseLib2Wrapper::~BaseLib2Wrapper() {
         }
     }
     BaseLib2::Adapter::Instance()->UnloadObjects();
+    if (messagePool != NULL_PTR(ReferenceT<Message> *)) {
+        delete[] messagePool;
+    }
+    (void) messagePoolMux.Close();
 }
 
 bool BaseLib2Wrapper::Initialise(StructuredDataI & data) {
@@ -78,6 +85,12 @@ bool BaseLib2Wrapper::Initialise(StructuredDataI & data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "The BaseLib2Config parameter shall be specified.");
         }
     }
+    if (ok) {
+        (void) data.Read("MessagePoolSize", messagePoolSize);
+        if (messagePoolSize > 0u) {
+            messagePool = new ReferenceT<Message> [messagePoolSize];
+        }
+    }
     if (ok) {
         ok = baseLib2Config.Seek(0LLU);
     }
@@ -93,18 +106,47 @@ bool BaseLib2Wrapper::Initialise(StructuredDataI & data) {
     return ok;
 }
 
+ReferenceT<Message> BaseLib2Wrapper::GetPooledMessage() {
+    ReferenceT<Message> msg;
+    uint32 i;
+    for (i = 0u; (i < messagePoolSize) && (!msg.IsValid()); i++) {
+        /*lint -e{613} messagePoolSize > 0 => messagePool != NULL*/
+        if (!messagePool[i].IsValid()) {
+            messagePool[i] = ReferenceT<Message>(new Message());
+            msg = messagePool[i];
+        }
+        else if (messagePool[i].NumberOfReferences() == 1u) {
+            //Only referenced by the pool: the previous destination has released it.
+            msg = messagePool[i];
+            reusedMessages++;
+        }
+        else {
+            //In use.
+        }
+    }
+    if (!msg.IsValid()) {
+        msg = ReferenceT<Message>(new Message());
+    }
+    return msg;
+}
+
 bool BaseLib2Wrapper::HandleBaseLib2Message(const char8 * const destination,
                                             const char8 * const content,
                                             uint32 code) {
-    REPORT_ERROR(ErrorManagement::Information, "Received message to %s with content %s and code %d\n", destination, content, code);
-    ReferenceT<Message> msg(new Message());
-    ConfigurationDatabase cdb;
-    bool ok = cdb.Write("Destination", destination);
-    if (ok) {
-        ok = cdb.Write("Function", content);
-    }
+    REPORT_ERROR(ErrorManagement::Debug, "Received message to %s with content %s and code %d\n", destination, content, code);
+    ReferenceT<Message> msg;
+    bool ok = (messagePoolMux.FastLock() == ErrorManagement::NoError);
     if (ok) {
-        ok = msg->Initialise(cdb);
+        msg = GetPooledMessage();
+        //The leafs are replaced, so that the translation database does not grow.
+        ok = translation.Write("Destination", destination);
+        if (ok) {
+            ok = translation.Write("Function", content);
+        }
+        if (ok) {
+            ok = msg->Initialise(translation);
+        }
+        messagePoolMux.FastUnLock();
     }
     if (ok) {
         ok = (MessageI::SendMessage(msg, this) == ErrorManagement::NoError);
@@ -112,5 +154,13 @@ bool BaseLib2Wrapper::HandleBaseLib2Message(const char8 * const destination,
     return ok;
 }
 
+uint32 BaseLib2Wrapper::GetMessagePoolSize() const {
+    return messagePoolSize;
+}
+
+uint32 BaseLib2Wrapper::GetNumberOfReusedMessages() const {
+    return reusedMessages;
+}
+
 CLASS_REGISTER(BaseLib2Wrapper, "1.0")
 }
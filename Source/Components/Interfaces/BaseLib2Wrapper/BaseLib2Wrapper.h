@@ -32,6 +32,9 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "FastPollingMutexSem.h"
+#include "Message.h"
 #include "QueuedMessageI.h"
 
 /*---------------------------------------------------------------------------*/
@@ -57,8 +60,12 @@ namespace MARTe {
  *             ...
  *         }
  *     }"
+ *     MessagePoolSize = 16 //Optional. Default = 16. Number of Message objects reused to propagate the BaseLib2 messages (0 to allocate one per message).
  * }
  * </pre>
+ *
+ * The messages received from BaseLib2 are propagated with Message objects taken from a pool: a Message is reused as soon as
+ * its previous destination has released it. If all the pooled messages are still in use a new Message is allocated.
  */
 class BaseLib2Wrapper : public Object, public QueuedMessageI, public BaseLib2::AdapterMessageListener {
 public:
@@ -90,6 +97,51 @@ public:
      * @return true if MessageI::SendMessage returns ErrorManagement::NoError.
      */
     virtual bool HandleBaseLib2Message(const char8 *destination, const char8 *content, uint32 code);
+
+    /**
+     * @brief Gets the number of Message objects in the pool.
+     * @return the number of Message objects in the pool.
+     */
+    uint32 GetMessagePoolSize() const;
+
+    /**
+     * @brief Gets the number of messages which were propagated with a reused Message.
+     * @return the number of messages which were propagated with a reused Message.
+     */
+    uint32 GetNumberOfReusedMessages() const;
+
+private:
+
+    /**
+     * @brief Gets a Message which is not referenced outside the pool (or a new one if all are in use).
+     * @return a Message ready to be initialised.
+     */
+    ReferenceT<Message> GetPooledMessage();
+
+    /**
+     * The pooled messages.
+     */
+    ReferenceT<Message> *messagePool;
+
+    /**
+     * The number of pooled messages.
+     */
+    uint32 messagePoolSize;
+
+    /**
+     * The number of messages which were propagated with a reused Message.
+     */
+    uint32 reusedMessages;
+
+    /**
+     * Holds the Destination and Function of the message being translated (reused).
+     */
+    ConfigurationDatabase translation;
+
+    /**
+     * Protects the pool and the translation.
+     */
+    FastPollingMutexSem messagePoolMux;
 };
 
 }
@@ -45,29 +45,114 @@ namespace MARTe {
 BaseLib2WrapperMessageFilter::BaseLib2WrapperMessageFilter() :
         MessageFilter(true),
         Object() {
-
+    uint32 i;
+    for (i = 0u; i < POOL_SIZE; i++) {
+        buffers[i] = NULL_PTR(char8 *);
+        bufferSizes[i] = 0u;
+        buffersInUse[i] = false;
+    }
+    (void) poolMux.Create();
 }
 
+/*lint -e{1551} the destructor must guarantee that the pooled buffers are freed.*/
 BaseLib2WrapperMessageFilter::~BaseLib2WrapperMessageFilter() {
+    uint32 i;
+    for (i = 0u; i < POOL_SIZE; i++) {
+        if (buffers[i] != NULL_PTR(char8 *)) {
+            delete[] buffers[i];
+        }
+    }
+    (void) poolMux.Close();
+}
 
+char8 *BaseLib2WrapperMessageFilter::GetBuffer(const uint32 size,
+                                                uint32 &slot) {
+    char8 *buffer = NULL_PTR(char8 *);
+    slot = POOL_SIZE;
+    if (poolMux.FastLock() == ErrorManagement::NoError) {
+        uint32 i;
+        for (i = 0u; (i < POOL_SIZE) && (slot == POOL_SIZE); i++) {
+            if (!buffersInUse[i]) {
+                slot = i;
+                buffersInUse[i] = true;
+            }
+        }
+        poolMux.FastUnLock();
+    }
+    if (slot < POOL_SIZE) {
+        if (bufferSizes[slot] < size) {
+            if (buffers[slot] != NULL_PTR(char8 *)) {
+                delete[] buffers[slot];
+            }
+            buffers[slot] = new char8[size];
+            bufferSizes[slot] = size;
+        }
+        buffer = buffers[slot];
+    }
+    else {
+        buffer = new char8[size];
+    }
+    return buffer;
+}
+
+void BaseLib2WrapperMessageFilter::ReleaseBuffer(char8 * const buffer,
+                                                 const uint32 slot) {
+    if (slot < POOL_SIZE) {
+        if (poolMux.FastLock() == ErrorManagement::NoError) {
+            buffersInUse[slot] = false;
+            poolMux.FastUnLock();
+        }
+    }
+    else {
+        delete[] buffer;
+    }
 }
 
 ErrorManagement::ErrorType BaseLib2WrapperMessageFilter::ConsumeMessage(ReferenceT<Message> &messageToTest) {
     ErrorManagement::ErrorType err;
     BaseLib2::Adapter *adapter = BaseLib2::Adapter::Instance();
-    StreamString function = messageToTest->GetFunction();
-    StreamString destination;
-    StreamString content;
-    char8 terminator;
-    bool ok = function.Seek(0ULL);
-    if (ok) {
-        ok = function.GetToken(destination, "::", terminator);
-    }
+    CCString function = messageToTest->GetFunction();
+    const char8 * const functionStr = function.GetList();
+    bool ok = (functionStr != NULL_PTR(const char8 *));
+    //DESTINATION::CONTENT. The ':' are token terminators (as in StreamString::GetToken).
+    uint32 destinationSize = 0u;
+    uint32 contentStart = 0u;
+    uint32 contentSize = 0u;
     if (ok) {
-        ok = function.GetToken(content, "::", terminator);
+        while ((functionStr[destinationSize] != '\0') && (functionStr[destinationSize] != ':')) {
+            destinationSize++;
+        }
+        contentStart = destinationSize;
+        while (functionStr[contentStart] == ':') {
+            contentStart++;
+        }
+        while ((functionStr[contentStart + contentSize] != '\0') && (functionStr[contentStart + contentSize] != ':')) {
+            contentSize++;
+        }
+        ok = ((destinationSize > 0u) && (contentSize > 0u));
     }
     if (ok) {
-        ok = adapter->SendMessageToBaseLib2(destination.Buffer(), content.Buffer(), 0u);
+        //The content is forwarded in place if it is the last token, otherwise it is copied after the destination.
+        bool contentInPlace = (functionStr[contentStart + contentSize] == '\0');
+        uint32 size = destinationSize + 1u;
+        if (!contentInPlace) {
+            size += (contentSize + 1u);
+        }
+        uint32 slot = POOL_SIZE;
+        char8 *buffer = GetBuffer(size, slot);
+        ok = MemoryOperationsHelper::Copy(buffer, functionStr, destinationSize);
+        buffer[destinationSize] = '\0';
+        const char8 *content = &functionStr[contentStart];
+        if ((ok) && (!contentInPlace)) {
+            char8 *contentCopy = &buffer[destinationSize + 1u];
+            ok = MemoryOperationsHelper::Copy(contentCopy, content, contentSize);
+            contentCopy[contentSize] = '\0';
+            content = contentCopy;
+        }
+        if (ok) {
+            ok = adapter->SendMessageToBaseLib2(buffer, content, 0u);
+        }
+        ReleaseBuffer(buffer, slot);
     }
     err = !ok;
     return err;
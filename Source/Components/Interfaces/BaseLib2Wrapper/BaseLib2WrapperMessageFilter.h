@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "BaseLib2Wrapper.h"
+#include "FastPollingMutexSem.h"
 #include "MessageFilter.h"
 #include "Object.h"
 
@@ -41,6 +42,9 @@
 namespace MARTe {
 /**
  * @brief Forwards received messages into BaseLib2 objects
+ * @details The Function of the messages is split in place: the CONTENT is forwarded without being copied and the DESTINATION is
+ * copied into a pooled buffer, which is reused by the next messages (i.e. no memory is allocated per message once the buffers are
+ * large enough). The filter may be called concurrently: each call takes a free buffer from the pool.
  */
 class BaseLib2WrapperMessageFilter : public MessageFilter, public Object {
 public:
@@ -66,6 +70,48 @@ public:
      * @return ErrorManagement::NoError if the message can be successfully sent with BaseLib2::Adapter::SendMessageToBaseLib2.
      */
     virtual ErrorManagement::ErrorType ConsumeMessage(ReferenceT<Message> &messageToTest);
+
+    /**
+     * @brief The number of translation buffers in the pool.
+     */
+    static const uint32 POOL_SIZE = 8u;
+
+private:
+
+    /**
+     * @brief Takes a free buffer from the pool.
+     * @param[in] size the minimum size of the buffer.
+     * @param[out] slot the index of the buffer (POOL_SIZE if the pool was exhausted and the buffer was allocated on the heap).
+     * @return the buffer.
+     */
+    char8 *GetBuffer(const uint32 size,
+                     uint32 &slot);
+
+    /**
+     * @brief Returns a buffer taken with GetBuffer.
+     */
+    void ReleaseBuffer(char8 * const buffer,
+                       const uint32 slot);
+
+    /**
+     * The pooled buffers.
+     */
+    char8 *buffers[POOL_SIZE];
+
+    /**
+     * The size of each pooled buffer.
+     */
+    uint32 bufferSizes[POOL_SIZE];
+
+    /**
+     * True if the buffer is being used.
+     */
+    bool buffersInUse[POOL_SIZE];
+
+    /**
+     * Protects the pool.
+     */
+    FastPollingMutexSem poolMux;
 };
 
 }
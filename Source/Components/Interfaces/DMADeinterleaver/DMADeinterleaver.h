@@ -0,0 +1,373 @@
+/**
+ * @file DMADeinterleaver.h
+ * @brief Header file for class DMADeinterleaver
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class DMADeinterleaver
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef DMADEINTERLEAVER_H_
+#define DMADEINTERLEAVER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Copies whole frames from an interleaved DMA memory into per-channel buffers.
+ * @details The stride between two samples of the same channel is a compile time constant, so that the
+ * compiler is free to vectorise the gather of each channel.
+ * @param[in] source the first sample of the first frame to copy.
+ * @param[in] destinations the per-channel destination buffers.
+ * @param[in] destinationOffset the index in each destination buffer where the first frame is to be written.
+ * @param[in] numberOfFrames the number of frames to copy.
+ */
+template<typename SampleType, uint32 numberOfChannels>
+void DMADeinterleaveFrames(const SampleType * const source,
+                           SampleType * const * const destinations,
+                           const size_t destinationOffset,
+                           const size_t numberOfFrames);
+
+/**
+ * @brief As DMADeinterleaveFrames above, for a number of channels only known at run time.
+ * @param[in] numberOfChannels the number of samples in each frame.
+ */
+template<typename SampleType>
+void DMADeinterleaveFrames(const SampleType * const source,
+                           SampleType * const * const destinations,
+                           const size_t destinationOffset,
+                           const size_t numberOfFrames,
+                           const uint32 numberOfChannels);
+
+/**
+ * @brief De-interleaves the samples of a DMA ring memory into per-channel blocks.
+ * @details The DMA ring holds frames with one sample for each of the numberOfChannels enabled channels.
+ * Each call to Copy consumes samples from a given position of the ring (rolling to its beginning if needed)
+ * and writes them in the per-channel buffers of the block being filled. The channel and the offset in the block
+ * are kept across calls, so that a frame split by the wrap-around, or between two DMA reads, is resumed where it stopped.
+ *
+ * Copy stops when the block is full, so that the caller can switch to the next set of buffers
+ * (see IsBlockComplete and NextBlock). Whole frames which are contiguous in the ring are copied one channel at a time
+ * (each destination buffer is written sequentially) by a kernel specialised for 1, 2, 4, 8, 16 and 32 channels.
+ *
+ * This class is shared by the NI6259ADC and the NI6368ADC and is not thread safe: the caller
+ * is expected to guard it with the same lock that protects the destination buffers.
+ */
+template<typename SampleType>
+class DMADeinterleaver {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     * @post
+     *   GetNumberOfChannels() == 0u &&
+     *   GetSamplesPerBlock() == 0u &&
+     *   GetChannel() == 0u &&
+     *   GetBlockOffset() == 0u
+     */
+    DMADeinterleaver();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~DMADeinterleaver();
+
+    /**
+     * @brief Sets the frame and block geometry and restarts from the first channel of an empty block.
+     * @param[in] numberOfChannelsIn the number of samples in each DMA frame.
+     * @param[in] samplesPerBlockIn the number of samples of each channel in a block.
+     * @post
+     *   GetNumberOfChannels() == numberOfChannelsIn &&
+     *   GetSamplesPerBlock() == samplesPerBlockIn &&
+     *   GetChannel() == 0u &&
+     *   GetBlockOffset() == 0u
+     */
+    void Reset(const uint32 numberOfChannelsIn,
+               const uint32 samplesPerBlockIn);
+
+    /**
+     * @brief Consumes samples from the DMA ring into the current block.
+     * @param[in] ring the DMA ring memory.
+     * @param[in] ringSize the number of samples in the DMA ring.
+     * @param[in] ringIndex the index in the ring of the first sample to consume.
+     * @param[in] numberOfSamplesAvailable the number of samples available from ringIndex.
+     * @param[in] destinations the per-channel buffers of the current block.
+     * @return the number of samples consumed. It is lower than numberOfSamplesAvailable only if the block became complete.
+     */
+    size_t Copy(const SampleType * const ring,
+                const size_t ringSize,
+                const size_t ringIndex,
+                const size_t numberOfSamplesAvailable,
+                SampleType * const * const destinations);
+
+    /**
+     * @brief Checks if all the samples of the current block were written.
+     * @return true if the current block is full.
+     */
+    inline bool IsBlockComplete() const;
+
+    /**
+     * @brief Starts filling a new block.
+     * @post
+     *   GetBlockOffset() == 0u
+     */
+    inline void NextBlock();
+
+    /**
+     * @brief Sets the channel of the next sample to consume (e.g. after discarding samples from the DMA).
+     * @param[in] channelIn the channel of the next sample.
+     * @pre
+     *   channelIn < GetNumberOfChannels()
+     */
+    inline void SetChannel(const uint32 channelIn);
+
+    /**
+     * @brief Gets the channel of the next sample to consume.
+     * @return the channel of the next sample to consume.
+     */
+    inline uint32 GetChannel() const;
+
+    /**
+     * @brief Gets the number of samples of each channel already written in the current block.
+     * @return the number of samples of each channel already written in the current block.
+     */
+    inline uint32 GetBlockOffset() const;
+
+    /**
+     * @brief Gets the number of channels in each frame.
+     * @return the number of channels in each frame.
+     */
+    inline uint32 GetNumberOfChannels() const;
+
+    /**
+     * @brief Gets the number of samples of each channel in a block.
+     * @return the number of samples of each channel in a block.
+     */
+    inline uint32 GetSamplesPerBlock() const;
+
+private:
+
+    /**
+     * @brief Selects the DMADeinterleaveFrames kernel for numberOfChannels.
+     */
+    void CopyFrames(const SampleType * const source,
+                    SampleType * const * const destinations,
+                    const size_t numberOfFrames) const;
+
+    /**
+     * The number of samples in each frame.
+     */
+    uint32 numberOfChannels;
+
+    /**
+     * The number of samples of each channel in a block.
+     */
+    uint32 samplesPerBlock;
+
+    /**
+     * The channel of the next sample to consume.
+     */
+    uint32 channel;
+
+    /**
+     * The number of samples of each channel already written in the current block.
+     */
+    uint32 blockOffset;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+template<typename SampleType, uint32 numberOfChannels>
+void DMADeinterleaveFrames(const SampleType * const source,
+                           SampleType * const * const destinations,
+                           const size_t destinationOffset,
+                           const size_t numberOfFrames) {
+    for (uint32 c = 0u; c < numberOfChannels; c++) {
+        SampleType * const channelDestination = &destinations[c][destinationOffset];
+        const SampleType * const channelSource = &source[c];
+        for (size_t f = 0u; f < numberOfFrames; f++) {
+            channelDestination[f] = channelSource[f * numberOfChannels];
+        }
+    }
+}
+
+template<typename SampleType>
+void DMADeinterleaveFrames(const SampleType * const source,
+                           SampleType * const * const destinations,
+                           const size_t destinationOffset,
+                           const size_t numberOfFrames,
+                           const uint32 numberOfChannels) {
+    for (uint32 c = 0u; c < numberOfChannels; c++) {
+        SampleType * const channelDestination = &destinations[c][destinationOffset];
+        const SampleType * const channelSource = &source[c];
+        for (size_t f = 0u; f < numberOfFrames; f++) {
+            channelDestination[f] = channelSource[f * numberOfChannels];
+        }
+    }
+}
+
+template<typename SampleType>
+DMADeinterleaver<SampleType>::DMADeinterleaver() {
+    numberOfChannels = 0u;
+    samplesPerBlock = 0u;
+    channel = 0u;
+    blockOffset = 0u;
+}
+
+template<typename SampleType>
+DMADeinterleaver<SampleType>::~DMADeinterleaver() {
+}
+
+template<typename SampleType>
+void DMADeinterleaver<SampleType>::Reset(const uint32 numberOfChannelsIn,
+                                         const uint32 samplesPerBlockIn) {
+    numberOfChannels = numberOfChannelsIn;
+    samplesPerBlock = samplesPerBlockIn;
+    channel = 0u;
+    blockOffset = 0u;
+}
+
+template<typename SampleType>
+size_t DMADeinterleaver<SampleType>::Copy(const SampleType * const ring,
+                                          const size_t ringSize,
+                                          const size_t ringIndex,
+                                          const size_t numberOfSamplesAvailable,
+                                          SampleType * const * const destinations) {
+    size_t s = 0u;
+    size_t idx = ringIndex;
+    if ((numberOfChannels > 0u) && (samplesPerBlock > 0u) && (ringSize > 0u)) {
+        while ((s < numberOfSamplesAvailable) && (!IsBlockComplete())) {
+            size_t framesToCopy = 0u;
+            if (channel == 0u) {
+                //Whole frames which are contiguous in the ring (i.e. before the wrap-around) and still fit in the block
+                size_t contiguousSamples = (ringSize - idx);
+                if (contiguousSamples > (numberOfSamplesAvailable - s)) {
+                    contiguousSamples = (numberOfSamplesAvailable - s);
+                }
+                framesToCopy = (contiguousSamples / numberOfChannels);
+                size_t framesToBlockEnd = static_cast<size_t>(samplesPerBlock - blockOffset);
+                if (framesToCopy > framesToBlockEnd) {
+                    framesToCopy = framesToBlockEnd;
+                }
+            }
+            if (framesToCopy > 0u) {
+                CopyFrames(&ring[idx], destinations, framesToCopy);
+                s += (framesToCopy * numberOfChannels);
+                idx += (framesToCopy * numberOfChannels);
+                blockOffset += static_cast<uint32>(framesToCopy);
+            }
+            else {
+                //Frames split by the wrap-around or only partially available: copy sample by sample
+                destinations[channel][blockOffset] = ring[idx];
+                s++;
+                idx++;
+                channel++;
+                if (channel == numberOfChannels) {
+                    channel = 0u;
+                    blockOffset++;
+                }
+            }
+            if (idx == ringSize) {
+                idx = 0u;
+            }
+        }
+    }
+    return s;
+}
+
+template<typename SampleType>
+void DMADeinterleaver<SampleType>::CopyFrames(const SampleType * const source,
+                                              SampleType * const * const destinations,
+                                              const size_t numberOfFrames) const {
+    switch (numberOfChannels) {
+    case 1u:
+        DMADeinterleaveFrames<SampleType, 1u>(source, destinations, blockOffset, numberOfFrames);
+        break;
+    case 2u:
+        DMADeinterleaveFrames<SampleType, 2u>(source, destinations, blockOffset, numberOfFrames);
+        break;
+    case 4u:
+        DMADeinterleaveFrames<SampleType, 4u>(source, destinations, blockOffset, numberOfFrames);
+        break;
+    case 8u:
+        DMADeinterleaveFrames<SampleType, 8u>(source, destinations, blockOffset, numberOfFrames);
+        break;
+    case 16u:
+        DMADeinterleaveFrames<SampleType, 16u>(source, destinations, blockOffset, numberOfFrames);
+        break;
+    case 32u:
+        DMADeinterleaveFrames<SampleType, 32u>(source, destinations, blockOffset, numberOfFrames);
+        break;
+    default:
+        DMADeinterleaveFrames<SampleType>(source, destinations, blockOffset, numberOfFrames, numberOfChannels);
+        break;
+    }
+}
+
+template<typename SampleType>
+bool DMADeinterleaver<SampleType>::IsBlockComplete() const {
+    return ((channel == 0u) && (blockOffset == samplesPerBlock));
+}
+
+template<typename SampleType>
+void DMADeinterleaver<SampleType>::NextBlock() {
+    blockOffset = 0u;
+}
+
+template<typename SampleType>
+void DMADeinterleaver<SampleType>::SetChannel(const uint32 channelIn) {
+    channel = channelIn;
+}
+
+template<typename SampleType>
+uint32 DMADeinterleaver<SampleType>::GetChannel() const {
+    return channel;
+}
+
+template<typename SampleType>
+uint32 DMADeinterleaver<SampleType>::GetBlockOffset() const {
+    return blockOffset;
+}
+
+template<typename SampleType>
+uint32 DMADeinterleaver<SampleType>::GetNumberOfChannels() const {
+    return numberOfChannels;
+}
+
+template<typename SampleType>
+uint32 DMADeinterleaver<SampleType>::GetSamplesPerBlock() const {
+    return samplesPerBlock;
+}
+
+}
+
+#endif /* DMADEINTERLEAVER_H_ */
@@ -74,6 +74,14 @@ EPICSCAClient::EPICSCAClient() :
         ReferenceContainer(), EmbeddedServiceMethodBinderI(), MessageI(), executor(*this){
     stackSize = THREADS_DEFAULT_STACKSIZE * 4u;
     cpuMask = 0xffu;
+    putQueueEnabled = false;
+    putQueue = NULL_PTR(EPICSPV **);
+    putBatch = NULL_PTR(EPICSPV **);
+    putQueueSize = 0u;
+    putQueueCapacity = 0u;
+    eventFlushPeriod = 0u;
+    (void) putQueueMux.Create();
+    (void) putQueueSem.Create();
     eventCallbackFastMux.Create();
     ReferenceT<RegisteredMethodsMessageFilter> filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
@@ -83,8 +91,15 @@ EPICSCAClient::EPICSCAClient() :
     }
 }
 
+/*lint -e{1551} -e{1579} the destructor must guarantee that the put queue memory is freed.*/
 EPICSCAClient::~EPICSCAClient() {
-
+    if (putQueue != NULL_PTR(EPICSPV **)) {
+        delete[] putQueue;
+    }
+    if (putBatch != NULL_PTR(EPICSPV **)) {
+        delete[] putBatch;
+    }
+    (void) putQueueSem.Close();
 }
 
 void EPICSCAClient::Purge(ReferenceContainer &purgeList) {
@@ -107,6 +122,16 @@ bool EPICSCAClient::Initialise(StructuredDataI & data) {
         }
         executor.SetStackSize(stackSize);
         executor.SetCPUMask(cpuMask);
+        uint32 putQueueEnabledU = 0u;
+        (void) (data.Read("PutQueue", putQueueEnabledU));
+        putQueueEnabled = (putQueueEnabledU == 1u);
+        if (putQueueEnabled) {
+            putQueueCapacity = Size();
+            if (putQueueCapacity > 0u) {
+                putQueue = new EPICSPV*[putQueueCapacity];
+                putBatch = new EPICSPV*[putQueueCapacity];
+            }
+        }
         uint32 autoStart = 1u;
         (void) (data.Read("AutoStart", autoStart));
         if (autoStart == 1u) {
@@ -150,6 +175,22 @@ ErrorManagement::ErrorType EPICSCAClient::Execute(ExecutionInfo& info) {
                 }
                 if (err.ErrorsCleared()) {
                     child->SetContext(ca_current_context());
+                    if (putQueueEnabled) {
+                        child->SetPutQueue(this);
+                    }
+                    float64 minimumInterval = child->GetMinimumInterval();
+                    if (minimumInterval > 0.0) {
+                        uint32 period = static_cast<uint32>(minimumInterval * 1000.0);
+                        if (period < 1u) {
+                            period = 1u;
+                        }
+                        if (period > 100u) {
+                            period = 100u;
+                        }
+                        if ((eventFlushPeriod == 0u) || (period < eventFlushPeriod)) {
+                            eventFlushPeriod = period;
+                        }
+                    }
                 }
                 if (err.ErrorsCleared()) {
 
@@ -170,7 +211,20 @@ ErrorManagement::ErrorType EPICSCAClient::Execute(ExecutionInfo& info) {
         eventCallbackFastMux.FastUnLock();
     }
     else if (info.GetStage() != ExecutionInfo::BadTerminationStage) {
-        Sleep::Sec(1.0F);
+        if ((putQueueEnabled) || (eventFlushPeriod > 0u)) {
+            uint32 period = (eventFlushPeriod > 0u) ? (eventFlushPeriod) : (100u);
+            //The putQueueSem is only posted if putQueueEnabled, otherwise this is a sleep.
+            (void) putQueueSem.Wait(TimeoutType(period));
+            if (putQueueEnabled) {
+                FlushPutQueue();
+            }
+            if (eventFlushPeriod > 0u) {
+                FlushPendingEvents();
+            }
+        }
+        else {
+            Sleep::Sec(1.0F);
+        }
     }
     else {
         (void) eventCallbackFastMux.FastLock();
@@ -191,6 +245,66 @@ ErrorManagement::ErrorType EPICSCAClient::Execute(ExecutionInfo& info) {
     return err;
 }
 
+bool EPICSCAClient::EnqueuePut(EPICSPV * const pv) {
+    bool ok = (putQueueEnabled);
+    if (ok) {
+        ok = (putQueueMux.FastLock() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        //Each PV is queued at most once (see EPICSPV::CAPutRaw), thus the queue cannot have more elements than children.
+        ok = (putQueueSize < putQueueCapacity);
+        if (ok) {
+            /*lint -e{613} putQueueCapacity > 0 => putQueue != NULL*/
+            putQueue[putQueueSize] = pv;
+            putQueueSize++;
+            (void) putQueueSem.Post();
+        }
+        putQueueMux.FastUnLock();
+    }
+    return ok;
+}
+
+bool EPICSCAClient::IsPutQueueEnabled() const {
+    return putQueueEnabled;
+}
+
+void EPICSCAClient::FlushPutQueue() {
+    uint32 batchSize = 0u;
+    if (putQueueMux.FastLock() == ErrorManagement::NoError) {
+        EPICSPV **swap = putBatch;
+        putBatch = putQueue;
+        putQueue = swap;
+        batchSize = putQueueSize;
+        putQueueSize = 0u;
+        (void) putQueueSem.Reset();
+        putQueueMux.FastUnLock();
+    }
+    if (batchSize > 0u) {
+        uint32 i;
+        for (i = 0u; i < batchSize; i++) {
+            /*lint -e{613} batchSize > 0 => putBatch != NULL*/
+            (void) putBatch[i]->IssuePut();
+        }
+        /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+        int32 caRet = ca_flush_io();
+        if (caRet != ECA_NORMAL) {
+            REPORT_ERROR(ErrorManagement::FatalError, "ca_flush_io failed. Error: %s", ca_message(caRet));
+        }
+    }
+}
+
+void EPICSCAClient::FlushPendingEvents() {
+    (void) eventCallbackFastMux.FastLock();
+    uint32 j;
+    for (j = 0u; j < Size(); j++) {
+        ReferenceT<EPICSPV> pv = Get(j);
+        if (pv.IsValid()) {
+            (void) pv->FlushPendingEvent();
+        }
+    }
+    eventCallbackFastMux.FastUnLock();
+}
+
 uint32 EPICSCAClient::GetStackSize() const {
     return stackSize;
 }
@@ -46,6 +46,8 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+class EPICSPV;
+
 /**
  * @brief A container of EPICSPV variables. Provides the threading context for the EPICS CA interface.
  * @details The configuration syntax is (names are only given as an example):
@@ -56,6 +58,7 @@ namespace MARTe {
  *   StackSize = 1048576 //Optional the EmbeddedThread stack size. Default value is THREADS_DEFAULT_STACKSIZE * 4u
  *   CPUs = 0xff //Optional the affinity of the EmbeddedThread (where the EPICS context is attached).
  *   AutoStart = 0 //Optional. Default = 1. If false the service will only be started after receiving a Start message (see Start method).
+ *   PutQueue = 1 //Optional. Default = 0. If true the EPICSPV puts are queued and written by the client thread (see below).
  *   +PV_1 = {
  *      Class = EPICSPV //See class documentation of EPICSPV
  *      ...
@@ -66,6 +69,15 @@ namespace MARTe {
  *   }
  * }
  * </pre>
+ *
+ * Without PutQueue each EPICSPV::CAPut is a ca_array_put followed by a ca_pend_io, which blocks the caller for a network round trip
+ * (or for the PV Timeout). With PutQueue the EPICSPV instances copy the value and queue themselves in the client (see EnqueuePut),
+ * which wakes the client thread. The client thread writes all the queued PVs with ca_array_put_callback and a single ca_flush_io.
+ * A PV which is written again while queued is only sent once, with the latest value. The completion of the puts is asynchronous
+ * (see EPICSPV::GetNumberOfCompletedPuts).
+ *
+ * If any EPICSPV has an Event MinimumInterval, the client thread periodically sends the value changes which were held by the
+ * EPICSPV (see EPICSPV::FlushPendingEvent). The period is the smallest MinimumInterval, limited between 1 ms and 100 ms.
  */
 class EPICSCAClient: public ReferenceContainer, public EmbeddedServiceMethodBinderI, public MessageI {
 public:
@@ -133,8 +145,31 @@ public:
      */
     ErrorManagement::ErrorType Start();
 
+    /**
+     * @brief Queues a put of an EPICSPV, to be written by the client thread.
+     * @param[in] pv the PV with a pending put (queued at most once until its put is issued).
+     * @return true if the client has a put queue and the PV is one of its children.
+     */
+    bool EnqueuePut(EPICSPV * const pv);
+
+    /**
+     * @brief Returns true if the puts are queued (see PutQueue).
+     * @return true if the puts are queued.
+     */
+    bool IsPutQueueEnabled() const;
+
 private:
 
+    /**
+     * @brief Issues the put of all the queued EPICSPV and flushes the CA send buffer (called by the client thread).
+     */
+    void FlushPutQueue();
+
+    /**
+     * @brief Sends the Messages of the value changes held by the EPICSPV children (called by the client thread).
+     */
+    void FlushPendingEvents();
+
     /**
      * The EmbeddedThread where the ca_pend_event is executed.
      */
@@ -150,6 +185,46 @@ private:
      */
     uint32 stackSize;
 
+    /**
+     * True if the puts are queued.
+     */
+    bool putQueueEnabled;
+
+    /**
+     * The PVs with a pending put.
+     */
+    EPICSPV **putQueue;
+
+    /**
+     * The PVs being written by the client thread (swapped with putQueue).
+     */
+    EPICSPV **putBatch;
+
+    /**
+     * The number of PVs in the putQueue.
+     */
+    uint32 putQueueSize;
+
+    /**
+     * The capacity of putQueue and putBatch (the number of EPICSPV children).
+     */
+    uint32 putQueueCapacity;
+
+    /**
+     * Protects the putQueue.
+     */
+    FastPollingMutexSem putQueueMux;
+
+    /**
+     * Posted when a put is queued.
+     */
+    EventSem putQueueSem;
+
+    /**
+     * The period (in ms) at which the held value changes are flushed (0 if no EPICSPV has a MinimumInterval).
+     */
+    uint32 eventFlushPeriod;
+
 };
 
 }
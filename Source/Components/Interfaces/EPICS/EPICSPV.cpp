@@ -31,12 +31,27 @@
 /*---------------------------------------------------------------------------*/
 #include "CLASSMETHODREGISTER.h"
 #include "ConfigurationDatabase.h"
+#include "EPICSCAClient.h"
 #include "EPICSPV.h"
+#include "HighResolutionTimer.h"
 #include "RegisteredMethodsMessageFilter.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Callback function for the ca_array_put_callback. Delegates the completion to the EPICSPV instance.
+ */
+/*lint -e{1746} function must match required prototype and thus cannot be changed to constant reference.*/
+static void EPICSPVPutCallback(struct event_handler_args const args) {
+    EPICSPV *pv = static_cast<EPICSPV *>(args.usr);
+    if (pv != NULL_PTR(EPICSPV *)) {
+        pv->HandlePutCompletion(args);
+    }
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -62,6 +77,19 @@ EPICSPV::EPICSPV() :
     typeSize = 0u;
     changedPvVal = 0u;
     handlePVEventNthTime = 0u;
+    putQueue = NULL_PTR(EPICSCAClient *);
+    putBuffer = NULL_PTR(char8 *);
+    putPending = false;
+    completedPuts = 0u;
+    failedPuts = 0u;
+    minimumInterval = 0.0;
+    deadband = 0.0;
+    lastEventValue = 0.0;
+    lastEventCounter = 0u;
+    eventPending = false;
+    droppedEvents = 0u;
+    coalescedEvents = 0u;
+    (void) putMux.Create();
 
     ReferenceT<RegisteredMethodsMessageFilter> filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
@@ -79,6 +107,9 @@ EPICSPV::~EPICSPV() {
     if (functionMap[1u] != NULL_PTR(StreamString *)) {
         delete[] functionMap[1u];
     }
+    if (putBuffer != NULL_PTR(char8 *)) {
+        delete[] putBuffer;
+    }
     if (pvMemory != NULL_PTR(void *)) {
         if (pvAnyType.GetTypeDescriptor().type == SString) {
             if (numberOfElements > 1u) {
@@ -259,6 +290,26 @@ bool EPICSPV::Initialise(StructuredDataI & data) {
                 }
             }
         }
+        if (ok) {
+            (void) data.Read("MinimumInterval", minimumInterval);
+            ok = (minimumInterval >= 0.0);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "MinimumInterval shall be >= 0");
+            }
+        }
+        if (ok) {
+            (void) data.Read("Deadband", deadband);
+            ok = (deadband >= 0.0);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Deadband shall be >= 0");
+            }
+        }
+        if ((ok) && (deadband > 0.0)) {
+            ok = ((pvType != DBR_STRING) && (numberOfElements == 1u));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Deadband is only supported for scalar numeric PVs");
+            }
+        }
         if (ok) {
             //In these cases the Function parameter shall be specified
             bool isIgnore = eventMode.ignore.operator bool();
@@ -307,10 +358,67 @@ ErrorManagement::ErrorType EPICSPV::CAPut(StructuredDataI & data) {
     return err;
 }
 
+uint32 EPICSPV::GetPutBufferSize() const {
+    uint32 size = memorySize;
+    if (pvAnyType.GetTypeDescriptor().type == SString) {
+        size = static_cast<uint32>(MAX_STRING_SIZE) * numberOfElements;
+    }
+    return size;
+}
+
+bool EPICSPV::EncodePut(char8 * const dest) {
+    bool ok = true;
+    //StreamString has to be treated differently
+    if (pvAnyType.GetTypeDescriptor().type == SString) {
+        //Arrays of strings are encoded as a single buffer of length 40 chars x numberOfDimensions
+        StreamString *str = static_cast<StreamString *>(pvAnyType.GetDataPointer());
+        ok = MemoryOperationsHelper::Set(dest, '\0', GetPutBufferSize());
+        uint32 n;
+        for (n = 0u; (n < numberOfElements) && (ok); n++) {
+            uint32 copySize = static_cast<uint32>(str[n].Size());
+            if (copySize > (static_cast<uint32>(MAX_STRING_SIZE) - 1u)) {
+                copySize = (static_cast<uint32>(MAX_STRING_SIZE) - 1u);
+            }
+            uint32 idx = n * static_cast<uint32>(MAX_STRING_SIZE);
+            ok = MemoryOperationsHelper::Copy(&dest[idx], str[n].Buffer(), copySize);
+        }
+    }
+    else {
+        ok = MemoryOperationsHelper::Copy(dest, pvMemory, memorySize);
+    }
+    return ok;
+}
+
 /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
 ErrorManagement::ErrorType EPICSPV::CAPutRaw() {
     ErrorManagement::ErrorType err = (context != NULL_PTR(struct ca_client_context *));
-    if (err.ErrorsCleared()) {
+    if ((err.ErrorsCleared()) && (putQueue != NULL_PTR(EPICSCAClient *))) {
+        //Queued put: only the latest value is kept until the client thread writes it
+        bool enqueue = false;
+        err = !(putMux.FastLock() == ErrorManagement::NoError);
+        if (err.ErrorsCleared()) {
+            if (putBuffer == NULL_PTR(char8 *)) {
+                putBuffer = new char8[GetPutBufferSize()];
+            }
+            err = !EncodePut(putBuffer);
+            if (err.ErrorsCleared()) {
+                enqueue = !putPending;
+                putPending = true;
+            }
+            putMux.FastUnLock();
+        }
+        if (enqueue) {
+            err = !putQueue->EnqueuePut(this);
+            if (!err.ErrorsCleared()) {
+                if (putMux.FastLock() == ErrorManagement::NoError) {
+                    putPending = false;
+                    putMux.FastUnLock();
+                }
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to queue the put for PV: %s", pvName.Buffer());
+            }
+        }
+    }
+    else if (err.ErrorsCleared()) {
         int32 caRet = ca_attach_context(context);
         err = !(caRet == ECA_NORMAL);
         if (!err.ErrorsCleared()) {
@@ -319,53 +427,78 @@ ErrorManagement::ErrorType EPICSPV::CAPutRaw() {
         if (!err.ErrorsCleared()) {
             REPORT_ERROR(ErrorManagement::FatalError, "Failed to ca_attach_context, error: %s", ca_message(caRet)); 
         }
-    }
-    if (err.ErrorsCleared()) {
-        //Arrays of strings are encoded with space separated tokens!
-        char8 *strArrayTemp = NULL_PTR(char8 *);
-        void *mem = pvMemory;
-        //StreamString has to be treated differently
-        if (pvAnyType.GetTypeDescriptor().type == SString) {
-            StreamString *str = static_cast<StreamString *>(pvAnyType.GetDataPointer());
-            if (numberOfElements > 1u) {
-                uint32 idx = static_cast<uint32>(MAX_STRING_SIZE) * numberOfElements;
-                strArrayTemp = new char8[idx];
-                //Arrays of strings are encoded as a single buffer of length 40 chars x numberOfDimensions
-                uint32 n;
-                bool ok = true;
-                for (n = 0u; (n < numberOfElements) && (ok); n++) {
-                    uint32 copySize = static_cast<uint32>(str[n].Size());
-                    if (copySize > static_cast<uint32>(MAX_STRING_SIZE)) {
-                        copySize = static_cast<uint32>(MAX_STRING_SIZE);
-                    }
-                    idx = n * static_cast<uint32>(MAX_STRING_SIZE);
-                    void *dest = &strArrayTemp[idx];
-                    ok = MemoryOperationsHelper::Copy(dest, str[n].Buffer(), copySize);
+        if (err.ErrorsCleared()) {
+            //Arrays of strings are encoded with space separated tokens!
+            char8 *strArrayTemp = NULL_PTR(char8 *);
+            void *mem = pvMemory;
+            //StreamString has to be treated differently
+            if (pvAnyType.GetTypeDescriptor().type == SString) {
+                StreamString *str = static_cast<StreamString *>(pvAnyType.GetDataPointer());
+                if (numberOfElements > 1u) {
+                    strArrayTemp = new char8[GetPutBufferSize()];
+                    err = !EncodePut(strArrayTemp);
+                    mem = static_cast<void *>(&strArrayTemp[0u]);
+                }
+                else {
+                    mem = const_cast<void *>(static_cast<const void *>(str->Buffer()));
                 }
-                err = !ok;
-                mem = static_cast<void *>(&strArrayTemp[0u]);
             }
-            else {
-                mem = const_cast<void *>(static_cast<const void *>(str->Buffer()));
+            /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+            if (ca_array_put(pvType, numberOfElements, pvChid, mem) != ECA_NORMAL) {
+                err = ErrorManagement::FatalError;
+                REPORT_ERROR(err, "ca_put failed for PV: %s", pvName.Buffer());
             }
+            /*lint -e{9130} -e{835} -e{845} Several false positives. lint is getting confused here for some reason.*/
+            caRet = ca_pend_io(timeout);
+            if (caRet != ECA_NORMAL) {
+                err = ErrorManagement::FatalError;
+                REPORT_ERROR(err, "ca_pend_io failed for PV: %s . Error: %s", pvName.Buffer(), ca_message(caRet));
+            }
+            if (strArrayTemp != NULL_PTR(char8 *)) {
+                delete[] strArrayTemp;
+            }
+            ca_detach_context();
         }
-        /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
-        if (ca_array_put(pvType, numberOfElements, pvChid, mem) != ECA_NORMAL) {
-            err = ErrorManagement::FatalError;
-            REPORT_ERROR(err, "ca_put failed for PV: %s", pvName.Buffer());
+    }
+    else {
+        //No context.
+    }
+    return err;
+}
+
+bool EPICSPV::IssuePut() {
+    bool ok = (putMux.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        ok = putPending;
+        if (ok) {
+            putPending = false;
+            //ca_array_put_callback copies the value to the CA send buffer
+            /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+            int32 caRet = ca_array_put_callback(pvType, numberOfElements, pvChid, putBuffer, &EPICSPVPutCallback, this);
+            ok = (caRet == ECA_NORMAL);
+            if (!ok) {
+                failedPuts++;
+                REPORT_ERROR(ErrorManagement::FatalError, "ca_array_put_callback failed for PV: %s . Error: %s", pvName.Buffer(), ca_message(caRet));
+            }
         }
-        /*lint -e{9130} -e{835} -e{845} Several false positives. lint is getting confused here for some reason.*/
-        int32 caRet = ca_pend_io(timeout);
-        if (caRet != ECA_NORMAL) {
-            err = ErrorManagement::FatalError;
-            REPORT_ERROR(err, "ca_pend_io failed for PV: %s . Error: %s", pvName.Buffer(), ca_message(caRet));
+        putMux.FastUnLock();
+    }
+    return ok;
+}
+
+void EPICSPV::HandlePutCompletion(struct event_handler_args const & args) {
+    if (putMux.FastLock() == ErrorManagement::NoError) {
+        if (args.status == ECA_NORMAL) {
+            completedPuts++;
         }
-        if (strArrayTemp != NULL_PTR(char8 *)) {
-            delete[] strArrayTemp;
+        else {
+            failedPuts++;
         }
-        ca_detach_context();
+        putMux.FastUnLock();
+    }
+    if (args.status != ECA_NORMAL) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Put failed for PV: %s . Error: %s", pvName.Buffer(), ca_message(args.status));
     }
-    return err;
 }
 
 void EPICSPV::HandlePVEvent(struct event_handler_args const & args) {
@@ -392,12 +525,72 @@ void EPICSPV::HandlePVEvent(struct event_handler_args const & args) {
                 (void) MemoryOperationsHelper::Copy(pvMemory, dbr, copySize);
             }
             if (!(eventMode.notSet.operator bool())) {
-                TriggerEventMessage();
+                DispatchEvent();
             }
         }
     }
 }
 
+void EPICSPV::DispatchEvent() {
+    bool send = true;
+    //The first value is the initial value of the PV (see TriggerEventMessage).
+    bool isFirst = (handlePVEventNthTime == 0u);
+    if (deadband > 0.0) {
+        float64 value = 0.0;
+        AnyType valueAT(value);
+        if (TypeConvert(valueAT, pvAnyType)) {
+            if (!isFirst) {
+                float64 change = value - lastEventValue;
+                if (change < 0.0) {
+                    change = -change;
+                }
+                send = (change >= deadband);
+                if (!send) {
+                    droppedEvents++;
+                }
+            }
+            if (send) {
+                lastEventValue = value;
+            }
+        }
+    }
+    uint64 now = HighResolutionTimer::Counter();
+    if ((send) && (!isFirst) && (minimumInterval > 0.0)) {
+        float64 elapsed = static_cast<float64>(now - lastEventCounter) * HighResolutionTimer::Period();
+        if (elapsed < minimumInterval) {
+            //Hold the value (which is in pvMemory) until the interval elapses.
+            if (eventPending) {
+                coalescedEvents++;
+            }
+            eventPending = true;
+            send = false;
+        }
+    }
+    if (send) {
+        if (eventPending) {
+            coalescedEvents++;
+        }
+        eventPending = false;
+        lastEventCounter = now;
+        TriggerEventMessage();
+    }
+}
+
+bool EPICSPV::FlushPendingEvent() {
+    bool flushed = eventPending;
+    if (flushed) {
+        uint64 now = HighResolutionTimer::Counter();
+        float64 elapsed = static_cast<float64>(now - lastEventCounter) * HighResolutionTimer::Period();
+        flushed = (elapsed >= minimumInterval);
+        if (flushed) {
+            eventPending = false;
+            lastEventCounter = now;
+            TriggerEventMessage();
+        }
+    }
+    return flushed;
+}
+
 void EPICSPV::TriggerEventMessage() {
     ConfigurationDatabase cdb;
     //if (handlePVEventNthTime == 0u) do not trigger an event so that we only react on value transitions.
@@ -633,6 +826,34 @@ uint32 EPICSPV::GetMemorySize() const {
     return memorySize;
 }
 
+void EPICSPV::SetPutQueue(EPICSCAClient * const putQueueIn) {
+    putQueue = putQueueIn;
+}
+
+uint32 EPICSPV::GetNumberOfCompletedPuts() const {
+    return completedPuts;
+}
+
+uint32 EPICSPV::GetNumberOfFailedPuts() const {
+    return failedPuts;
+}
+
+float64 EPICSPV::GetMinimumInterval() const {
+    return minimumInterval;
+}
+
+float64 EPICSPV::GetDeadband() const {
+    return deadband;
+}
+
+uint32 EPICSPV::GetNumberOfDroppedEvents() const {
+    return droppedEvents;
+}
+
+uint32 EPICSPV::GetNumberOfCoalescedEvents() const {
+    return coalescedEvents;
+}
+
 CLASS_REGISTER(EPICSPV, "1.0")
 /*lint -e{1023} There is no ambiguity on the function to be called as the compiler can distinguish between both template definitions.*/
 CLASS_METHOD_REGISTER(EPICSPV, CAPut)
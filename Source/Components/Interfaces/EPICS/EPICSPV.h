@@ -34,6 +34,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "FastPollingMutexSem.h"
 #include "MessageI.h"
 #include "Object.h"
 #include "StreamString.h"
@@ -43,6 +44,8 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+class EPICSCAClient;
+
 /**
  * @brief Describes an EPICS PV.
  * @details This class wraps an EPICS PV, allowing to caput and caget values from it.
@@ -74,6 +77,8 @@ namespace MARTe {
  *                        //If Ignore, the PV value will not be used and the Function will always be called.
  *      Function = STOP //Compulsory if PVValue=Parameter, PVValue=ParameterName or PVValue=Ignore. Shall not be set if FunctionMap is defined or if PVValue=Function.
  *      FunctionMap = {{"1", "RUN"}, {"0", "STOP"}} //Optional Nx2 matrix. Only allowed if PVValue == Function. If defined then the PV value (first column of the matrix) will be used to map the Function name (second column of the matrix).
+ *      MinimumInterval = 0.1 //Optional. Default = 0 (disabled). Minimum time in seconds between two Messages (see below).
+ *      Deadband = 0.5 //Optional. Default = 0 (disabled). Only for scalar numeric PVs. Changes smaller than the Deadband do not trigger a Message (see below).
  *   }
  *   AMessage = {  //Only if the PVValue = Message
  *      Class = Message
@@ -93,6 +98,17 @@ namespace MARTe {
  * The CAPut and CAGet class methods are registered as call-backs. The parameter to put/get shall be encoded as "param1" in a StructuredDataI attached to the message.
  *
  * If the Event section is defined the Messages triggered will have the Function defined as above and the parameter (if set) will be written with the key "param1".
+ *
+ * A noisy PV may trigger more Messages than the destination can handle. If the Deadband is set, the value changes (with respect to the
+ * value of the last Message) smaller than the Deadband are dropped. If the MinimumInterval is set, a value change which arrives less
+ * than MinimumInterval seconds after the previous Message is held and only the latest held value is sent, by the EPICSCAClient thread,
+ * when the interval has elapsed (see FlushPendingEvent). The number of dropped and coalesced value changes is available for diagnostics
+ * (see GetNumberOfDroppedEvents and GetNumberOfCoalescedEvents).
+ *
+ * If the EPICSCAClient which contains the PV has a put queue (see EPICSCAClient PutQueue), CAPut and CAPutRaw do not block: the value is
+ * copied to a put buffer and the PV is queued in the EPICSCAClient, whose thread writes all the queued PVs with one ca_flush_io.
+ * A value which is written again before the previous one was sent replaces it (i.e. only the latest value is sent). The completion of
+ * the puts is reported asynchronously (see GetNumberOfCompletedPuts and GetNumberOfFailedPuts).
  */
 class EPICSPV: public ReferenceContainer, public MessageI {
 public:
@@ -286,8 +302,87 @@ public:
      */
     uint32 GetMemorySize() const;
 
+    /**
+     * @brief Sets the EPICSCAClient where the puts are queued.
+     * @details Called by the EPICSCAClient thread, after the channel is created, if the client has a put queue.
+     * @param[in] putQueueIn the client where the puts are queued.
+     */
+    void SetPutQueue(EPICSCAClient * const putQueueIn);
+
+    /**
+     * @brief Writes the latest queued value with ca_array_put_callback (shall be called by the EPICSCAClient thread, which calls ca_flush_io).
+     * @return true if there was a queued value and the ca_array_put_callback succeeded.
+     */
+    bool IssuePut();
+
+    /**
+     * @brief Called by the ca_array_put_callback callback when a queued put completes.
+     * @param[in] args the put status.
+     */
+    void HandlePutCompletion(struct event_handler_args const & args);
+
+    /**
+     * @brief Gets the number of queued puts which completed successfully.
+     * @return the number of queued puts which completed successfully.
+     */
+    uint32 GetNumberOfCompletedPuts() const;
+
+    /**
+     * @brief Gets the number of queued puts which failed.
+     * @return the number of queued puts which failed.
+     */
+    uint32 GetNumberOfFailedPuts() const;
+
+    /**
+     * @brief Sends the Message of a value change held because of the MinimumInterval, if the interval has elapsed.
+     * @details Called periodically by the EPICSCAClient thread (with the same lock as HandlePVEvent).
+     * @return true if a Message was triggered.
+     */
+    bool FlushPendingEvent();
+
+    /**
+     * @brief Gets the minimum time between two Messages.
+     * @return the minimum time between two Messages (in seconds).
+     */
+    float64 GetMinimumInterval() const;
+
+    /**
+     * @brief Gets the deadband of the value changes.
+     * @return the deadband of the value changes.
+     */
+    float64 GetDeadband() const;
+
+    /**
+     * @brief Gets the number of value changes that were dropped because they were within the Deadband.
+     * @return the number of value changes that were dropped.
+     */
+    uint32 GetNumberOfDroppedEvents() const;
+
+    /**
+     * @brief Gets the number of held value changes that were replaced by a more recent one (and thus did not trigger a Message).
+     * @return the number of value changes that were coalesced.
+     */
+    uint32 GetNumberOfCoalescedEvents() const;
+
 private:
 
+    /**
+     * @brief Applies the Deadband and the MinimumInterval to a value change and calls TriggerEventMessage if the Message is to be sent.
+     */
+    void DispatchEvent();
+
+    /**
+     * @brief Encodes the value held in the memory of GetAnyType in the format expected by ca_array_put.
+     * @param[out] dest where to write the value (GetPutBufferSize() bytes).
+     * @return true if the value could be encoded.
+     */
+    bool EncodePut(char8 * const dest);
+
+    /**
+     * @brief Gets the number of bytes needed to encode the value for ca_array_put.
+     */
+    uint32 GetPutBufferSize() const;
+
     /**
      * @brief Triggers the sending of a Message with the rules defined in the class description.
      * @param[in] newValue the value to be sent (either as the Function name or the Function parameter).
@@ -384,6 +479,71 @@ private:
      */
     uint8 handlePVEventNthTime;
 
+    /**
+     * The client where the puts are queued (NULL if the puts are synchronous).
+     */
+    EPICSCAClient *putQueue;
+
+    /**
+     * The latest value to be written by the client thread.
+     */
+    char8 *putBuffer;
+
+    /**
+     * True if putBuffer holds a value which was not yet written.
+     */
+    bool putPending;
+
+    /**
+     * Protects putBuffer and putPending.
+     */
+    FastPollingMutexSem putMux;
+
+    /**
+     * The number of queued puts which completed successfully.
+     */
+    uint32 completedPuts;
+
+    /**
+     * The number of queued puts which failed.
+     */
+    uint32 failedPuts;
+
+    /**
+     * The minimum time between two Messages (in seconds).
+     */
+    float64 minimumInterval;
+
+    /**
+     * The deadband of the value changes.
+     */
+    float64 deadband;
+
+    /**
+     * The value of the last Message (for the Deadband).
+     */
+    float64 lastEventValue;
+
+    /**
+     * The HighResolutionTimer counter of the last Message.
+     */
+    uint64 lastEventCounter;
+
+    /**
+     * True if a value change is held because of the MinimumInterval.
+     */
+    bool eventPending;
+
+    /**
+     * The number of value changes within the Deadband.
+     */
+    uint32 droppedEvents;
+
+    /**
+     * The number of held value changes replaced by a more recent one.
+     */
+    uint32 coalescedEvents;
+
 };
 
 }
@@ -44,10 +44,13 @@ namespace MARTe {
 
 EPICSObjectRegistryDatabaseService::EPICSObjectRegistryDatabaseService() :
         EPICSRPCService(), Object() {
-
+    generation = 0u;
+    walkCounter = 0u;
+    (void) snapshotMux.Create();
 }
 
 EPICSObjectRegistryDatabaseService::~EPICSObjectRegistryDatabaseService() {
+    (void) snapshotMux.Close();
 }
 
 void EPICSObjectRegistryDatabaseService::GetEPICSStructure(epics::pvData::FieldBuilderPtr &fieldBuilder, ReferenceContainer &rc) {
@@ -92,13 +95,172 @@ void EPICSObjectRegistryDatabaseService::FillEPICSStructure(epics::pvData::PVStr
     }
 }
 
-epics::pvData::PVStructurePtr EPICSObjectRegistryDatabaseService::request(epics::pvData::PVStructure::shared_pointer const & args) {
-    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+void EPICSObjectRegistryDatabaseService::Walk(ReferenceContainer &rc,
+                                              const std::string &fullName,
+                                              const uint32 level,
+                                              const uint64 newGeneration,
+                                              PageRequest &page,
+                                              bool &changed) {
+    uint32 i;
+    uint32 nOfChildren = rc.Size();
+    for (i = 0u; i < nOfChildren; i++) {
+        ReferenceT < Object > child = rc.Get(i);
+        if (child.IsValid()) {
+            std::string id = fullName;
+            if (id.size() > 0u) {
+                id += ".";
+            }
+            id += child->GetName();
+            const char8 * const className = child->GetClassProperties()->GetName();
+            SnapshotEntry &entry = snapshot[id];
+            if ((entry.lastSeen == 0u) || (entry.className != className)) {
+                if (entry.lastSeen == 0u) {
+                    (void) removed.erase(id);
+                }
+                entry.className = className;
+                entry.generation = newGeneration;
+                changed = true;
+            }
+            entry.lastSeen = walkCounter;
+
+            //Is the object below the requested path?
+            uint32 childLevel = 0u;
+            if (level > 0u) {
+                childLevel = level + 1u;
+            }
+            else if (page.path.size() == 0u) {
+                childLevel = 1u;
+            }
+            else if ((id.size() > page.path.size()) && (id.compare(0u, page.path.size(), page.path) == 0) && (id[page.path.size()] == '.')) {
+                childLevel = 1u;
+            }
+            else {
+                //Not below the path.
+            }
+            bool inDepth = ((page.depth == 0u) || (childLevel <= page.depth));
+            if ((childLevel > 0u) && (inDepth) && (entry.generation > page.sinceGeneration)) {
+                bool inPage = (page.numberOfMatches >= page.pageToken);
+                if ((inPage) && (page.pageSize > 0u)) {
+                    inPage = ((page.numberOfMatches - page.pageToken) < page.pageSize);
+                }
+                if (inPage) {
+                    page.paths.push_back(id);
+                    page.classes.push_back(entry.className);
+                }
+                page.numberOfMatches++;
+            }
+            ReferenceT < ReferenceContainer > childRC = child;
+            if (childRC.IsValid()) {
+                Walk(*childRC.operator ->(), id, childLevel, newGeneration, page, changed);
+            }
+        }
+    }
+}
+
+epics::pvData::PVStructurePtr EPICSObjectRegistryDatabaseService::PagedRequest(epics::pvData::PVStructure::shared_pointer const & args) {
+    PageRequest page;
+    page.depth = 0u;
+    page.pageSize = 0u;
+    page.pageToken = 0u;
+    page.sinceGeneration = 0u;
+    page.numberOfMatches = 0u;
+    epics::pvData::PVStringPtr pvPath = args->getSubField < epics::pvData::PVString > ("path");
+    if (pvPath) {
+        page.path = pvPath->get();
+    }
+    epics::pvData::PVScalarPtr pvScalar = args->getSubField < epics::pvData::PVScalar > ("depth");
+    if (pvScalar) {
+        page.depth = pvScalar->getAs<uint32>();
+    }
+    pvScalar = args->getSubField < epics::pvData::PVScalar > ("pageSize");
+    if (pvScalar) {
+        page.pageSize = pvScalar->getAs<uint32>();
+    }
+    pvScalar = args->getSubField < epics::pvData::PVScalar > ("pageToken");
+    if (pvScalar) {
+        page.pageToken = pvScalar->getAs<uint32>();
+    }
+    pvScalar = args->getSubField < epics::pvData::PVScalar > ("sinceGeneration");
+    if (pvScalar) {
+        page.sinceGeneration = pvScalar->getAs<uint64>();
+    }
+
+    epics::pvData::shared_vector<std::string> removedPaths;
+    uint64 replyGeneration = 0u;
+    if (snapshotMux.FastLock() == ErrorManagement::NoError) {
+        walkCounter++;
+        uint64 newGeneration = generation + 1u;
+        bool changed = false;
+        Walk(*ObjectRegistryDatabase::Instance(), "", 0u, newGeneration, page, changed);
+        std::map<std::string, SnapshotEntry>::iterator it = snapshot.begin();
+        while (it != snapshot.end()) {
+            if (it->second.lastSeen != walkCounter) {
+                removed[it->first] = newGeneration;
+                snapshot.erase(it++);
+                changed = true;
+            }
+            else {
+                ++it;
+            }
+        }
+        if (changed) {
+            generation = newGeneration;
+        }
+        replyGeneration = generation;
+        if (page.pageToken == 0u) {
+            std::map<std::string, uint64>::const_iterator rit;
+            for (rit = removed.begin(); rit != removed.end(); ++rit) {
+                bool inPath = (page.path.size() == 0u);
+                if (!inPath) {
+                    inPath = ((rit->first.size() > page.path.size()) && (rit->first.compare(0u, page.path.size(), page.path) == 0) && (rit->first[page.path.size()] == '.'));
+                }
+                if ((inPath) && (rit->second > page.sinceGeneration)) {
+                    removedPaths.push_back(rit->first);
+                }
+            }
+        }
+        snapshotMux.FastUnLock();
+    }
+    uint32 nextPageToken = 0u;
+    if (page.pageSize > 0u) {
+        if ((page.pageToken + page.pageSize) < page.numberOfMatches) {
+            nextPageToken = page.pageToken + page.pageSize;
+        }
+    }
+
     epics::pvData::FieldBuilderPtr fieldBuilder = epics::pvData::getFieldCreate()->createFieldBuilder();
-    GetEPICSStructure(fieldBuilder, *ord);
-    epics::pvData::StructureConstPtr topStructure = fieldBuilder->createStructure();
-    epics::pvData::PVStructurePtr result(epics::pvData::getPVDataCreate()->createPVStructure(topStructure));
-    FillEPICSStructure(result, *ord, "");
+    fieldBuilder = fieldBuilder->add("generation", epics::pvData::pvULong);
+    fieldBuilder = fieldBuilder->add("nextPageToken", epics::pvData::pvUInt);
+    fieldBuilder = fieldBuilder->addArray("path", epics::pvData::pvString);
+    fieldBuilder = fieldBuilder->addArray("class", epics::pvData::pvString);
+    fieldBuilder = fieldBuilder->addArray("removed", epics::pvData::pvString);
+    epics::pvData::PVStructurePtr result(epics::pvData::getPVDataCreate()->createPVStructure(fieldBuilder->createStructure()));
+    result->getSubField < epics::pvData::PVULong > ("generation")->put(replyGeneration);
+    result->getSubField < epics::pvData::PVUInt > ("nextPageToken")->put(nextPageToken);
+    result->getSubField < epics::pvData::PVStringArray > ("path")->replace(freeze(page.paths));
+    result->getSubField < epics::pvData::PVStringArray > ("class")->replace(freeze(page.classes));
+    result->getSubField < epics::pvData::PVStringArray > ("removed")->replace(freeze(removedPaths));
+    return result;
+}
+
+epics::pvData::PVStructurePtr EPICSObjectRegistryDatabaseService::request(epics::pvData::PVStructure::shared_pointer const & args) {
+    bool paged = false;
+    if (args) {
+        paged = (args->getSubField("path") || args->getSubField("depth") || args->getSubField("pageSize") || args->getSubField("pageToken")
+                || args->getSubField("sinceGeneration"));
+    }
+    epics::pvData::PVStructurePtr result;
+    if (paged) {
+        result = PagedRequest(args);
+    }
+    else {
+        ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+        epics::pvData::FieldBuilderPtr fieldBuilder = epics::pvData::getFieldCreate()->createFieldBuilder();
+        GetEPICSStructure(fieldBuilder, *ord);
+        epics::pvData::StructureConstPtr topStructure = fieldBuilder->createStructure();
+        result = epics::pvData::getPVDataCreate()->createPVStructure(topStructure);
+        FillEPICSStructure(result, *ord, "");
+    }
     return result;
 }
 
@@ -27,12 +27,15 @@
 /*---------------------------------------------------------------------------*/
 /*                        Standard header includes                           */
 /*---------------------------------------------------------------------------*/
+#include <map>
+#include <string>
 #include "pv/rpcService.h"
 
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "EPICSRPCService.h"
+#include "FastPollingMutexSem.h"
 #include "Object.h"
 #include "ReferenceT.h"
 #include "StreamString.h"
@@ -58,6 +61,29 @@ namespace MARTe {
  *   }
  * }
  * </pre>
+ *
+ * If the request has no arguments, the reply is the full ObjectRegistryDatabase tree, where each object is a nested structure with
+ * the object name and a class field.
+ *
+ * Large applications should instead request the tree in pages, by setting any of the following (optional) arguments:
+ * <pre>
+ * path = "App.Functions" //Default = "" (the root). Only export the objects below this path.
+ * depth = 1 //Default = 0 (no limit). Only export the objects up to this number of levels below the path.
+ * pageSize = 1000 //Default = 0 (no limit). The maximum number of objects in the reply.
+ * pageToken = 0 //Default = 0. The nextPageToken of the previous reply (0 to request the first page).
+ * sinceGeneration = 42 //Default = 0. Only export the objects which were added (or changed class) after this generation.
+ * </pre>
+ * The objects are then exported as a flat list, in depth-first order:
+ * <pre>
+ * generation //uint64. The generation of the ObjectRegistryDatabase when the reply was computed.
+ * nextPageToken //uint32. The pageToken of the next page, 0 if this is the last page.
+ * path //string[]. The full path (dot separated) of each object.
+ * class //string[]. The class name of each object.
+ * removed //string[]. The paths of the objects removed after sinceGeneration (only in the first page).
+ * </pre>
+ * The generation is a counter which is incremented whenever a request finds that objects were added, removed or changed class
+ * since the previous request. A client keeps the generation of its last snapshot and requests sinceGeneration = generation to only
+ * get what changed (the page tokens of a request are only meaningful while the generation does not change).
  */
 class  EPICSObjectRegistryDatabaseService: public EPICSRPCService, public Object {
 public:
@@ -95,6 +121,74 @@ private:
      */
     void FillEPICSStructure(epics::pvData::PVStructurePtr & pvStructure, ReferenceContainer &rc, StreamString fullName);
 
+    /**
+     * @brief The state of an object when it was last seen.
+     */
+    struct SnapshotEntry {
+        std::string className;
+        uint64 generation;
+        uint64 lastSeen;
+    };
+
+    /**
+     * @brief The arguments and the reply of a paged request.
+     */
+    struct PageRequest {
+        std::string path;
+        uint32 depth;
+        uint32 pageSize;
+        uint32 pageToken;
+        uint64 sinceGeneration;
+        uint32 numberOfMatches;
+        epics::pvData::shared_vector<std::string> paths;
+        epics::pvData::shared_vector<std::string> classes;
+    };
+
+    /**
+     * @brief Replies to a request with paging arguments (see class description).
+     */
+    epics::pvData::PVStructurePtr PagedRequest(epics::pvData::PVStructure::shared_pointer const & args);
+
+    /**
+     * @brief Helper method which recursively updates the snapshot and collects the objects of the page.
+     * @param[in] rc the node being currently visited.
+     * @param[in] fullName the full path of \a rc.
+     * @param[in] level the number of levels of \a rc below the requested path (0 if \a rc is not below the requested path).
+     * @param[in] newGeneration the generation assigned to the objects which changed.
+     * @param[in,out] page the request.
+     * @param[out] changed set to true if an object was added or changed class.
+     */
+    void Walk(ReferenceContainer &rc,
+              const std::string &fullName,
+              const uint32 level,
+              const uint64 newGeneration,
+              PageRequest &page,
+              bool &changed);
+
+    /**
+     * The objects seen in the last paged request, indexed by path.
+     */
+    std::map<std::string, SnapshotEntry> snapshot;
+
+    /**
+     * The objects removed, indexed by path, with the generation of their removal.
+     */
+    std::map<std::string, uint64> removed;
+
+    /**
+     * The current generation.
+     */
+    uint64 generation;
+
+    /**
+     * Incremented on every paged request.
+     */
+    uint64 walkCounter;
+
+    /**
+     * Protects the snapshot (the requests may be executed by concurrent workers of the EPICSRPCServer).
+     */
+    FastPollingMutexSem snapshotMux;
 };
 }
 /*---------------------------------------------------------------------------*/
@@ -34,6 +34,7 @@
 #include "EPICSPVAHelper.h"
 #include "EPICSPVARecord.h"
 #include "EPICSPVAStructureDataI.h"
+#include "HighResolutionTimer.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -72,7 +73,14 @@ namespace MARTe {
 
 EPICSPVARecord::EPICSPVARecord() :
         Object() {
-
+    maxUpdateRate = 0.0;
+    minUpdateCounts = 0u;
+    lastUpdateCounter = 0u;
+    numberOfUpdates = 0u;
+    numberOfCoalescedUpdates = 0u;
+    if (!pendingMux.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to create pendingMux");
+    }
 }
 
 EPICSPVARecord::~EPICSPVARecord() {
@@ -309,6 +317,20 @@ bool EPICSPVARecord::Initialise(StructuredDataI &data) {
             recordName = GetName();
         }
         REPORT_ERROR(ErrorManagement::Information, "Going to use the following record name: [%s]", recordName.Buffer());
+        if (cdb.Read("MaxUpdateRate", maxUpdateRate)) {
+            ok = (maxUpdateRate >= 0.0);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "MaxUpdateRate shall be >= 0");
+            }
+            else if (maxUpdateRate > 0.0) {
+                minUpdateCounts = static_cast<uint64>(static_cast<float64>(HighResolutionTimer::Frequency()) / maxUpdateRate);
+            }
+            else {
+                minUpdateCounts = 0u;
+            }
+        }
+    }
+    if (ok) {
         ok = cdb.MoveRelative("Structure");
         if (!ok) {
             REPORT_ERROR(ErrorManagement::ParametersError, "No Structure defined");
@@ -334,6 +356,10 @@ epics::pvDatabase::PVRecordPtr EPICSPVARecord::CreatePVRecord() {
     if (ok) {
         pvRecordWrapper = std::shared_ptr < MARTe2PVARecord > (new MARTe2PVARecord(recordName.Buffer(), pvStructure));
         pvRecordWrapper->initPvt();
+        pvRecord = pvRecordWrapper;
+        pendingStructure = epics::pvData::getPVDataCreate()->createPVStructure(pvStructure);
+        pendingData.SetStructure(pendingStructure);
+        pendingFields.clear();
     }
     return pvRecordWrapper;
 
@@ -343,5 +369,120 @@ void EPICSPVARecord::GetRecordName(StreamString &recName) {
     recName = recordName;
 }
 
+bool EPICSPVARecord::WritePendingFields(StructuredDataI &values, const StreamString &path) {
+    uint32 i;
+    uint32 nOfChildren = values.GetNumberOfChildren();
+    bool ok = true;
+    for (i = 0u; (i < nOfChildren) && (ok); i++) {
+        const char8 * const childName = values.GetChildName(i);
+        StreamString childPath = path;
+        if (childPath.Size() > 0u) {
+            childPath += ".";
+        }
+        childPath += childName;
+        if (values.MoveRelative(childName)) {
+            ok = pendingData.MoveRelative(childName);
+            if (ok) {
+                ok = WritePendingFields(values, childPath);
+            }
+            if (ok) {
+                ok = pendingData.MoveToAncestor(1u);
+            }
+            if (ok) {
+                ok = values.MoveToAncestor(1u);
+            }
+        }
+        else {
+            ok = pendingData.Write(childName, values.GetType(childName));
+            if (ok) {
+                epics::pvData::PVFieldPtr pvField = pendingStructure->getSubField(childPath.Buffer());
+                if (pvField) {
+                    (void) pendingFields.set(static_cast<uint32>(pvField->getFieldOffset()));
+                }
+                else {
+                    //e.g. inside an array of structures. Publish the whole structure.
+                    (void) pendingFields.set(0u);
+                }
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to update field %s of record %s", childPath.Buffer(), recordName.Buffer());
+        }
+    }
+    return ok;
+}
+
+void EPICSPVARecord::PublishPendingFields() {
+    if (!pendingFields.isEmpty()) {
+        epics::pvData::PVStructurePtr recordStructure = pvRecord->getPVStructure();
+        //The monitors are only notified at endGroupPut, i.e. once per batch of fields
+        pvRecord->lock();
+        try {
+            pvRecord->beginGroupPut();
+            recordStructure->copyUnchecked(*pendingStructure, pendingFields);
+            pvRecord->endGroupPut();
+        }
+        catch (epics::pvData::detail::ExceptionMixed<epics::pvData::BaseException> &ignored) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to update record %s [%s]", recordName.Buffer(), ignored.what());
+        }
+        pvRecord->unlock();
+        pendingFields.clear();
+        lastUpdateCounter = HighResolutionTimer::Counter();
+        numberOfUpdates++;
+    }
+}
+
+bool EPICSPVARecord::UpdateFields(StructuredDataI &values) {
+    bool ok = (pvRecord ? true : false);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::IllegalOperation, "CreatePVRecord was not called for record %s", recordName.Buffer());
+    }
+    if (ok) {
+        ok = (pendingMux.FastLock() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = pendingData.MoveToRoot();
+        if (ok) {
+            ok = WritePendingFields(values, "");
+        }
+        bool publish = (minUpdateCounts == 0u);
+        if (!publish) {
+            publish = ((HighResolutionTimer::Counter() - lastUpdateCounter) >= minUpdateCounts);
+        }
+        if (publish) {
+            PublishPendingFields();
+        }
+        else {
+            numberOfCoalescedUpdates++;
+        }
+        pendingMux.FastUnLock();
+    }
+    return ok;
+}
+
+bool EPICSPVARecord::FlushUpdates() {
+    bool ok = (pvRecord ? true : false);
+    if (ok) {
+        ok = (pendingMux.FastLock() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        PublishPendingFields();
+        pendingMux.FastUnLock();
+    }
+    return ok;
+}
+
+uint64 EPICSPVARecord::GetNumberOfUpdates() const {
+    return numberOfUpdates;
+}
+
+uint64 EPICSPVARecord::GetNumberOfCoalescedUpdates() const {
+    return numberOfCoalescedUpdates;
+}
+
+float64 EPICSPVARecord::GetMaxUpdateRate() const {
+    return maxUpdateRate;
+}
+
 CLASS_REGISTER(EPICSPVARecord, "1.0")
 }
@@ -27,12 +27,15 @@
 /*---------------------------------------------------------------------------*/
 /*                        Standard header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "pv/bitSet.h"
 #include "pv/pvDatabase.h"
 
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "ConfigurationDatabase.h"
+#include "EPICSPVAStructureDataI.h"
+#include "FastPollingMutexSem.h"
 #include "Object.h"
 #include "ReferenceT.h"
 #include "StreamString.h"
@@ -51,6 +54,7 @@ namespace MARTe {
  * +Record1 = { //If the Alias field is not set, the Object name is the record name
  *   Class = EPICSPVA::EPICSPVARecord
  *   Alias = "f4e::falcon::Fast::Record1" //Optional. If set this will be the record name.
+ *   MaxUpdateRate = 100 //Optional. Default = 0 (no limit). Maximum number of UpdateFields per second which are notified to the monitors.
  *     Structure = {//Use structured types for nested structures.
  *     A = {
  *       Type = uint32
@@ -61,6 +65,10 @@ namespace MARTe {
  *   }
  * }
  * </pre>
+ *
+ * MARTe components can update the record with UpdateFields, which writes any number of fields taking the record lock only once and notifies the
+ * monitors once after all the fields were written. If MaxUpdateRate is set, the updates which arrive faster than this rate are coalesced
+ * and published (latest value wins) by the next UpdateFields (or FlushUpdates) which is allowed by the rate.
  */
 class EPICSPVARecord: public Object {
 public:
@@ -93,7 +101,55 @@ EPICSPVARecord    ();
      */
     void GetRecordName(StreamString &recName);
 
+    /**
+     * @brief Writes the values of \a values into the record.
+     * @details \a values may contain any subset of the record Structure (with the same names and hierarchy). The values are first written
+     * into a copy of the record structure and then, if the MaxUpdateRate allows, published with a single record lock and a single monitor
+     * notification (see FlushUpdates). Otherwise they are coalesced with the next update.
+     * @param[in] values the values to write.
+     * @return true if CreatePVRecord was called and all the values were successfully written.
+     */
+    bool UpdateFields(StructuredDataI &values);
+
+    /**
+     * @brief Publishes the fields changed by UpdateFields which were not yet published (independently of the MaxUpdateRate).
+     * @details Locks the record once, writes all the changed fields inside a group put (so that the monitors are notified once) and unlocks the record.
+     * @return true if CreatePVRecord was called.
+     */
+    bool FlushUpdates();
+
+    /**
+     * @brief Gets the number of times that the record was updated (i.e. the monitors were notified).
+     * @return the number of times that the record was updated.
+     */
+    uint64 GetNumberOfUpdates() const;
+
+    /**
+     * @brief Gets the number of UpdateFields which were coalesced into a later update because of the MaxUpdateRate.
+     * @return the number of UpdateFields which were coalesced into a later update.
+     */
+    uint64 GetNumberOfCoalescedUpdates() const;
+
+    /**
+     * @brief Gets the maximum number of updates per second (0 if there is no limit).
+     * @return the maximum number of updates per second.
+     */
+    float64 GetMaxUpdateRate() const;
+
 private:
+    /**
+     * @brief Recursively writes the leafs of \a values into the pendingData and flags the changed fields in pendingFields.
+     * @param[in] values the values to write.
+     * @param[in] path the path of the current node of \a values (with . as separator).
+     * @return true if all the leafs were successfully written.
+     */
+    bool WritePendingFields(StructuredDataI &values, const StreamString &path);
+
+    /**
+     * @brief Publishes the pendingFields (with the record lock). Shall be called with the pendingMux locked.
+     */
+    void PublishPendingFields();
+
     /**
      * @brief Recursively initialises the \a pvStructure (in particular the arrays and the structure arrays) .
      * @param[in] pvStructure the structure to initialise.
@@ -127,6 +183,56 @@ private:
      * The record name.
      */
     StreamString recordName;
+
+    /**
+     * The record created by CreatePVRecord.
+     */
+    epics::pvDatabase::PVRecordPtr pvRecord;
+
+    /**
+     * Copy of the record structure where the UpdateFields are written before being published.
+     */
+    epics::pvData::PVStructurePtr pendingStructure;
+
+    /**
+     * Wraps the pendingStructure as a StructuredDataI.
+     */
+    EPICSPVAStructureDataI pendingData;
+
+    /**
+     * The fields of the pendingStructure which were not yet published.
+     */
+    epics::pvData::BitSet pendingFields;
+
+    /**
+     * Protects the pendingStructure and the pendingFields.
+     */
+    FastPollingMutexSem pendingMux;
+
+    /**
+     * The maximum number of updates per second (0 if there is no limit).
+     */
+    float64 maxUpdateRate;
+
+    /**
+     * The minimum number of HighResolutionTimer counts between two updates.
+     */
+    uint64 minUpdateCounts;
+
+    /**
+     * The HighResolutionTimer counter of the last update.
+     */
+    uint64 lastUpdateCounter;
+
+    /**
+     * The number of updates.
+     */
+    uint64 numberOfUpdates;
+
+    /**
+     * The number of UpdateFields which were coalesced into a later update.
+     */
+    uint64 numberOfCoalescedUpdates;
 };
 }
 /*---------------------------------------------------------------------------*/
@@ -31,10 +31,28 @@
 #include "AdvancedErrorManagement.h"
 #include "EPICSPVAHelper.h"
 #include "EPICSPVAStructureDataI.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief FNV-1a hash of a field name.
+ * @param[in] name the name to hash.
+ * @return the hash of \a name.
+ */
+static uint32 EPICSPVAStructureDataIHashName(const char8 * const name) {
+    uint32 hash = 2166136261u;
+    uint32 i = 0u;
+    while (name[i] != '\0') {
+        hash ^= static_cast<uint32>(static_cast<uint8>(name[i]));
+        hash *= 16777619u;
+        i++;
+    }
+    return hash;
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -46,6 +64,7 @@ EPICSPVAStructureDataI::EPICSPVAStructureDataI() :
     structureFinalised = true;
     currentStructPtr.resize(0);
     currentStructPtr.reserve(16u);
+    lastLookupHash = 0u;
 }
 
 EPICSPVAStructureDataI::~EPICSPVAStructureDataI() {
@@ -68,13 +87,20 @@ bool EPICSPVAStructureDataI::Read(const char8 * const name, const AnyType &value
         ok = (currentStructPtr.size() > 0u);
     }
     if (ok) {
-        epics::pvData::PVStructurePtr structPtr = currentStructPtr[currentStructPtr.size() - 1u];
-        scalarFieldPtr = structPtr->getSubField<epics::pvData::PVScalar>(name);
-        ok = (scalarFieldPtr ? true : false);
-        if (!ok) {
-            isScalar = false;
-            scalarArrayPtr = structPtr->getSubField<epics::pvData::PVScalarArray>(name);
-            ok = (scalarArrayPtr ? true : false);
+        //Already found (and cached) by the GetType above
+        const epics::pvData::PVFieldPtr &fieldPtr = FindField(name);
+        ok = (fieldPtr ? true : false);
+        if (ok) {
+            isScalar = (fieldPtr->getField()->getType() == epics::pvData::scalar);
+            if (isScalar) {
+                scalarFieldPtr = std::static_pointer_cast<epics::pvData::PVScalar>(fieldPtr);
+            }
+            else {
+                ok = (fieldPtr->getField()->getType() == epics::pvData::scalarArray);
+                if (ok) {
+                    scalarArrayPtr = std::static_pointer_cast<epics::pvData::PVScalarArray>(fieldPtr);
+                }
+            }
         }
     }
     if (ok) {
@@ -192,17 +218,12 @@ bool EPICSPVAStructureDataI::Read(const char8 * const name, const AnyType &value
 
 AnyType EPICSPVAStructureDataI::GetType(const char8 * const name) {
     AnyType at = voidAnyType;
-    epics::pvData::PVFieldPtr fieldPtr;
     bool ok = structureFinalised;
-    epics::pvData::PVStructurePtr structPtr;
     if (ok) {
         ok = (currentStructPtr.size() > 0u);
     }
+    const epics::pvData::PVFieldPtr &fieldPtr = FindField(name);
     if (ok) {
-        structPtr = currentStructPtr[currentStructPtr.size() - 1u];
-    }
-    if (ok) {
-        fieldPtr = structPtr->getSubField(name);
         ok = (fieldPtr ? true : false);
     }
     else {
@@ -214,19 +235,13 @@ AnyType EPICSPVAStructureDataI::GetType(const char8 * const name) {
         TypeDescriptor marte2Type;
         uint32 numberOfElements = 1u;
         if (epicsType == epics::pvData::scalar) {
-            epics::pvData::PVScalarPtr scalarFieldPtr = structPtr->getSubField<epics::pvData::PVScalar>(name);
-            ok = (scalarFieldPtr ? true : false);
-            if (ok) {
-                epicsScalarType = scalarFieldPtr->getScalar()->getScalarType();
-            }
+            const epics::pvData::PVScalar *scalarFieldPtr = static_cast<const epics::pvData::PVScalar *>(fieldPtr.get());
+            epicsScalarType = scalarFieldPtr->getScalar()->getScalarType();
         }
         else if (epicsType == epics::pvData::scalarArray) {
-            epics::pvData::PVScalarArrayPtr scalarArrayPtr = structPtr->getSubField<epics::pvData::PVScalarArray>(name);
-            ok = (scalarArrayPtr ? true : false);
-            if (ok) {
-                epicsScalarType = scalarArrayPtr->getScalarArray()->getElementType();
-                numberOfElements = scalarArrayPtr->getLength();
-            }
+            const epics::pvData::PVScalarArray *scalarArrayPtr = static_cast<const epics::pvData::PVScalarArray *>(fieldPtr.get());
+            epicsScalarType = scalarArrayPtr->getScalarArray()->getElementType();
+            numberOfElements = static_cast<uint32>(scalarArrayPtr->getLength());
         }
         else {
             ok = false;
@@ -304,23 +319,21 @@ bool EPICSPVAStructureDataI::WriteStoredType(const char8 * const name, AnyType &
     }
 
     bool ok = (isScalar == storedTypeIsScalar);
-    epics::pvData::PVStructurePtr structPtr;
     if (ok) {
         ok = (currentStructPtr.size() > 0u);
     }
     if (ok) {
-        structPtr = currentStructPtr[currentStructPtr.size() - 1u];
-    }
-    if (ok) {
+        //Already found (and cached) by the GetType of the caller
+        const epics::pvData::PVFieldPtr &fieldPtr = FindField(name);
         if (storedTypeIsScalar) {
-            scalarFieldPtr = std::dynamic_pointer_cast < epics::pvData::PVScalar > (structPtr->getSubField(name));
+            scalarFieldPtr = std::dynamic_pointer_cast < epics::pvData::PVScalar > (fieldPtr);
             ok = (scalarFieldPtr ? true : false);
             if (!ok) {
                 REPORT_ERROR(ErrorManagement::ParametersError, "%s should be a scalar but the conversion to PVScalar failed", name);
             }
         }
         else {
-            scalarArrayPtr = std::dynamic_pointer_cast < epics::pvData::PVScalarArray > (structPtr->getSubField(name));
+            scalarArrayPtr = std::dynamic_pointer_cast < epics::pvData::PVScalarArray > (fieldPtr);
             ok = (scalarArrayPtr ? true : false);
             if (!ok) {
                 REPORT_ERROR(ErrorManagement::ParametersError, "%s should be an array but the conversion to PVScalarArray failed", name);
@@ -636,14 +649,18 @@ bool EPICSPVAStructureDataI::Move(const char8 * const path) {
             if (pvType == epics::pvData::structure) {
                 ok = (idx == -1);
                 if (ok) {
-                    movePtr = std::dynamic_pointer_cast < epics::pvData::PVStructure > (field->shared_from_this());
+                    movePtr = std::static_pointer_cast<epics::pvData::PVStructure>(field);
                 }
             }
             else if (pvType == epics::pvData::structureArray) {
                 ok = (idx != -1);
                 if (ok) {
-                    epics::pvData::PVStructureArrayPtr arrPtr = std::dynamic_pointer_cast < epics::pvData::PVStructureArray > (field->shared_from_this());
-                    movePtr = arrPtr->view()[idx];
+                    const epics::pvData::PVStructureArray *arrPtr = static_cast<const epics::pvData::PVStructureArray *>(field.get());
+                    const epics::pvData::PVStructureArray::const_svector &elements = arrPtr->view();
+                    ok = (static_cast<uint32>(idx) < static_cast<uint32>(elements.size()));
+                    if (ok) {
+                        movePtr = elements[static_cast<uint32>(idx)];
+                    }
                 }
             }
             else {
@@ -702,9 +719,10 @@ bool EPICSPVAStructureDataI::MoveToChild(const uint32 childIdx) {
             epics::pvData::PVStructurePtr movePtr;
             ok = (childIdx < fields.size());
             if (ok) {
-                epics::pvData::PVFieldPtr field = fields[childIdx];
-                movePtr = std::dynamic_pointer_cast < epics::pvData::PVStructure > (field->shared_from_this());
-                ok = (movePtr ? true : false);
+                ok = (fields[childIdx]->getField()->getType() == epics::pvData::structure);
+            }
+            if (ok) {
+                movePtr = std::static_pointer_cast<epics::pvData::PVStructure>(fields[childIdx]);
             }
             if (ok) {
                 currentStructPtr.push_back(movePtr);
@@ -753,15 +771,8 @@ const char8 *EPICSPVAStructureDataI::GetChildName(const uint32 index) {
     const char8 * ret = "";
     if (currentStructPtr.size() > 0) {
         const epics::pvData::PVFieldPtrArray & fields = currentStructPtr[currentStructPtr.size() - 1u]->getPVFields();
-        epics::pvData::PVFieldPtr movePtr;
-        bool ok = (index < fields.size());
-        if (ok) {
-            epics::pvData::PVFieldPtr field = fields[index];
-            movePtr = std::dynamic_pointer_cast < epics::pvData::PVField > (field->shared_from_this());
-            ok = (movePtr ? true : false);
-        }
-        if (ok) {
-            ret = movePtr->getFieldName().c_str();
+        if (index < fields.size()) {
+            ret = fields[index]->getFieldName().c_str();
         }
     }
     return ret;
@@ -771,10 +782,8 @@ const char8 *EPICSPVAStructureDataI::GetChildId(const uint32 index) {
     const char8 * ret = "";
     if (currentStructPtr.size() > 0) {
         const epics::pvData::PVFieldPtrArray & fields = currentStructPtr[currentStructPtr.size() - 1u]->getPVFields();
-        bool ok = (index < fields.size());
-        if (ok) {
-            epics::pvData::PVFieldPtr field = fields[index];
-            ret = field->getField()->getID().c_str();
+        if (index < fields.size()) {
+            ret = fields[index]->getField()->getID().c_str();
         }
     }
     return ret;
@@ -790,6 +799,7 @@ uint32 EPICSPVAStructureDataI::GetNumberOfChildren() {
 
 void EPICSPVAStructureDataI::SetStructure(epics::pvData::PVStructurePtr const & structPtrToSet) {
     structureFinalised = true;
+    ResetFieldCache();
     rootStructPtr = structPtrToSet;
     currentStructPtr.resize(0u);
     currentStructPtr.push_back(rootStructPtr);
@@ -807,6 +817,7 @@ bool EPICSPVAStructureDataI::FinaliseStructure() {
         ok = (topStructure ? true : false);
     }
     if (ok) {
+        ResetFieldCache();
         rootStructPtr = epics::pvData::getPVDataCreate()->createPVStructure(topStructure);
     }
     if (ok) {
@@ -830,6 +841,37 @@ bool EPICSPVAStructureDataI::FinaliseStructure() {
     return ok;
 }
 
+const epics::pvData::PVFieldPtr &EPICSPVAStructureDataI::FindField(const char8 * const name) {
+    if (currentStructPtr.size() > 0u) {
+        const epics::pvData::PVStructurePtr &structPtr = currentStructPtr[currentStructPtr.size() - 1u];
+        uint32 hash = EPICSPVAStructureDataIHashName(name);
+        bool hit = (lastLookupStruct.get() == structPtr.get());
+        if (hit) {
+            hit = (lastLookupHash == hash);
+        }
+        if (hit) {
+            hit = (StringHelper::Compare(lastLookupName.Buffer(), name) == 0);
+        }
+        if (!hit) {
+            lastLookupStruct = structPtr;
+            lastLookupName = name;
+            lastLookupHash = hash;
+            lastLookupField = structPtr->getSubField(name);
+        }
+    }
+    else {
+        ResetFieldCache();
+    }
+    return lastLookupField;
+}
+
+void EPICSPVAStructureDataI::ResetFieldCache() {
+    lastLookupStruct = epics::pvData::PVStructurePtr();
+    lastLookupField = epics::pvData::PVFieldPtr();
+    lastLookupName = "";
+    lastLookupHash = 0u;
+}
+
 epics::pvData::PVStructurePtr EPICSPVAStructureDataI::GetRootStruct() {
     return rootStructPtr;
 }
@@ -56,6 +56,9 @@ namespace MARTe {
  * The Read method cannot be called until the structure has been finalised.
  *
  * It is also possible to directly access to the underlying PVStructure with the GetRootStruct method.
+ *
+ * The last field looked up by name (e.g. by GetType followed by Read or Write) is cached, together with the hash of its name, so that the
+ *  consecutive accesses to the same field do not search the structure again.
  */
 class EPICSPVAStructureDataI: public StructuredDataI, public Object {
 public:
@@ -237,6 +240,19 @@ private:
      */
     virtual const char8 *GetChildId(const uint32 index);
 
+    /**
+     * @brief Finds the field with name \a name in the current node.
+     * @details Returns the cached field if the current node and the name (compared by hash first) match the last lookup.
+     * @param[in] name the name of the field.
+     * @return the field (which is not valid if the field does not exist).
+     */
+    const epics::pvData::PVFieldPtr &FindField(const char8 * const name);
+
+    /**
+     * @brief Invalidates the FindField cache.
+     */
+    void ResetFieldCache();
+
     /**
      * @brief Helper method to read a value from an epics::pvData::PVScalarPtr into an AnyType. Required to handle the special boolean type.
      * @param[in] scalarFieldPtr the scalar where to read the data from.
@@ -244,7 +260,7 @@ private:
      * @return true if the value can be successfully read.
      */
     template<typename T>
-    bool ReadValue(epics::pvData::PVScalarPtr scalarFieldPtr, const AnyType &value);
+    bool ReadValue(const epics::pvData::PVScalarPtr &scalarFieldPtr, const AnyType &value);
 
     /**
      * @brief Helper method to read an array from an epics::pvData::PVScalarArray into an AnyType. Should allow to convert from any numeric type to any numeric type.
@@ -254,7 +270,7 @@ private:
      * @return true if the array can be successfully read.
      */
     template<typename T>
-    bool ReadArray(epics::pvData::PVScalarArrayPtr scalarArrayPtr, AnyType &storedType, const AnyType &value);
+    bool ReadArray(const epics::pvData::PVScalarArrayPtr &scalarArrayPtr, AnyType &storedType, const AnyType &value);
 
     /**
      * @brief Helper method to write an array from an AnyType into an epics::pvData::PVScalarArray.
@@ -265,7 +281,7 @@ private:
      * @return true if the array can be successfully written.
      */
     template<typename T>
-    bool WriteArray(epics::pvData::PVScalarArrayPtr scalarArrayPtr, AnyType &storedType, const AnyType &value, const uint32 &size);
+    bool WriteArray(const epics::pvData::PVScalarArrayPtr &scalarArrayPtr, AnyType &storedType, const AnyType &value, const uint32 &size);
 
     /**
      * @brief Helper method that writes the value into the backend PVScalarPtr or PVScalarArrayPtr.
@@ -295,6 +311,26 @@ private:
      * The cached ConfigurationDatabase that is used until the FinaliseStructure is called.
      */
     ConfigurationDatabase cachedCDB;
+
+    /**
+     * The node of the last FindField.
+     */
+    epics::pvData::PVStructurePtr lastLookupStruct;
+
+    /**
+     * The name of the last FindField.
+     */
+    StreamString lastLookupName;
+
+    /**
+     * The hash of lastLookupName.
+     */
+    uint32 lastLookupHash;
+
+    /**
+     * The result of the last FindField.
+     */
+    epics::pvData::PVFieldPtr lastLookupField;
 };
 
 }
@@ -305,13 +341,13 @@ private:
 namespace MARTe {
 
 template<typename T>
-bool EPICSPVAStructureDataI::ReadValue(epics::pvData::PVScalarPtr scalarFieldPtr, const AnyType &value) {
+bool EPICSPVAStructureDataI::ReadValue(const epics::pvData::PVScalarPtr &scalarFieldPtr, const AnyType &value) {
     *reinterpret_cast<T *>(value.GetDataPointer()) = scalarFieldPtr->getAs<T>();
     return true;
 }
 
 template<>
-inline bool EPICSPVAStructureDataI::ReadValue<bool>(epics::pvData::PVScalarPtr scalarFieldPtr, const AnyType &value) {
+inline bool EPICSPVAStructureDataI::ReadValue<bool>(const epics::pvData::PVScalarPtr &scalarFieldPtr, const AnyType &value) {
     bool readVal = scalarFieldPtr->getAs<epics::pvData::boolean>();
     bool ok = true;
     if ((value.GetTypeDescriptor() == UnsignedInteger8Bit) || (value.GetTypeDescriptor() == SignedInteger8Bit)) {
@@ -334,24 +370,24 @@ inline bool EPICSPVAStructureDataI::ReadValue<bool>(epics::pvData::PVScalarPtr s
 }
 
 template<typename T>
-bool EPICSPVAStructureDataI::ReadArray(epics::pvData::PVScalarArrayPtr scalarArrayPtr, AnyType &storedType, const AnyType &value) {
+bool EPICSPVAStructureDataI::ReadArray(const epics::pvData::PVScalarArrayPtr &scalarArrayPtr, AnyType &storedType, const AnyType &value) {
     bool ok = true;
     epics::pvData::shared_vector<const T> out;
+    //Converts (if needed) from the stored type to the T of the value. If no conversion is needed the array is shared (no copy).
     scalarArrayPtr->getAs<T>(out);
     uint32 numberOfElements = storedType.GetNumberOfElements(0u);
-    uint32 i;
-    //Should allow to convert from numeric anytype to anytype. Note that this is called with the T of the value.
-    Vector<T> readVec(reinterpret_cast<T *>(value.GetDataPointer()), numberOfElements);
-    Vector<T> srcVec(const_cast<T *>(reinterpret_cast<const T *>(out.data())), numberOfElements);
-    for (i = 0u; i < numberOfElements; i++) {
-        readVec[i] = srcVec[i];
+    if (static_cast<uint32>(out.size()) < numberOfElements) {
+        numberOfElements = static_cast<uint32>(out.size());
+    }
+    if (numberOfElements > 0u) {
+        ok = MemoryOperationsHelper::Copy(value.GetDataPointer(), reinterpret_cast<const void *>(out.data()), static_cast<uint32>(numberOfElements * sizeof(T)));
     }
 
     return ok;
 }
 
 template<>
-inline bool EPICSPVAStructureDataI::ReadArray<std::string>(epics::pvData::PVScalarArrayPtr scalarArrayPtr, AnyType &storedType, const AnyType &value) {
+inline bool EPICSPVAStructureDataI::ReadArray<std::string>(const epics::pvData::PVScalarArrayPtr &scalarArrayPtr, AnyType &storedType, const AnyType &value) {
     epics::pvData::shared_vector<const std::string> srcStr;
     scalarArrayPtr->getAs<std::string>(srcStr);
     uint32 numberOfElements = storedType.GetNumberOfElements(0u);
@@ -364,7 +400,7 @@ inline bool EPICSPVAStructureDataI::ReadArray<std::string>(epics::pvData::PVScal
 }
 
 template<>
-inline bool EPICSPVAStructureDataI::ReadArray<bool>(epics::pvData::PVScalarArrayPtr scalarArrayPtr, AnyType &storedType, const AnyType &value) {
+inline bool EPICSPVAStructureDataI::ReadArray<bool>(const epics::pvData::PVScalarArrayPtr &scalarArrayPtr, AnyType &storedType, const AnyType &value) {
     bool ok = true;
     uint32 numberOfElements = storedType.GetNumberOfElements(0u);
     epics::pvData::shared_vector<const epics::pvData::boolean> out;
@@ -404,7 +440,7 @@ inline bool EPICSPVAStructureDataI::ReadArray<bool>(epics::pvData::PVScalarArray
 }
 
 template<typename T>
-bool EPICSPVAStructureDataI::WriteArray(epics::pvData::PVScalarArrayPtr scalarArrayPtr, AnyType &storedType, const AnyType &value, const uint32 &size) {
+bool EPICSPVAStructureDataI::WriteArray(const epics::pvData::PVScalarArrayPtr &scalarArrayPtr, AnyType &storedType, const AnyType &value, const uint32 &size) {
     epics::pvData::shared_vector<T> out;
     out.resize(storedType.GetNumberOfElements(0u));
     bool ok = MemoryOperationsHelper::Copy(reinterpret_cast<void *>(out.data()), value.GetDataPointer(), size);
@@ -414,7 +450,7 @@ bool EPICSPVAStructureDataI::WriteArray(epics::pvData::PVScalarArrayPtr scalarAr
 }
 
 template<>
-inline bool EPICSPVAStructureDataI::WriteArray<std::string>(epics::pvData::PVScalarArrayPtr scalarArrayPtr, AnyType &storedType, const AnyType &value, const uint32 &size) {
+inline bool EPICSPVAStructureDataI::WriteArray<std::string>(const epics::pvData::PVScalarArrayPtr &scalarArrayPtr, AnyType &storedType, const AnyType &value, const uint32 &size) {
     epics::pvData::shared_vector<const std::string> out;
     uint32 numberOfElements = storedType.GetNumberOfElements(0u);
     out.resize(numberOfElements);
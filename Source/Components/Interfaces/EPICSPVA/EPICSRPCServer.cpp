@@ -53,6 +53,8 @@ EPICSRPCServer::EPICSRPCServer() :
         ReferenceContainer(), MessageI(), executor(*this) {
     stackSize = THREADS_DEFAULT_STACKSIZE * 4u;
     cpuMask = 0xffu;
+    numberOfWorkers = 0u;
+    workersCPUMask = 0xffu;
     ReferenceT<RegisteredMethodsMessageFilter> filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -78,6 +80,7 @@ void EPICSRPCServer::Purge(ReferenceContainer &purgeList) {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
         }
     }
+    (void) pool.Stop();
     ReferenceContainer::Purge(purgeList);
 }
 
@@ -92,6 +95,35 @@ bool EPICSRPCServer::Initialise(StructuredDataI & data) {
         }
         executor.SetStackSize(stackSize);
         executor.SetCPUMask(cpuMask);
+        (void) data.Read("NumberOfWorkers", numberOfWorkers);
+        workersCPUMask = cpuMask;
+        (void) data.Read("WorkersCPUs", workersCPUMask);
+    }
+    if ((ok) && (numberOfWorkers > 0u)) {
+        uint32 nOfServices = Size();
+        ok = pool.SetNumberOfServices(nOfServices);
+        for (uint32 i = 0u; (i < nOfServices) && (ok); i++) {
+            ReferenceT<EPICSRPCService> service = Get(i);
+            ReferenceT<Object> serviceObj = Get(i);
+            ok = (service.IsValid() && serviceObj.IsValid());
+            if (ok) {
+                uint32 maxConcurrentRequests = 0u;
+                StreamString nodeName = "+";
+                nodeName += serviceObj->GetName();
+                if (data.MoveRelative(nodeName.Buffer())) {
+                    (void) data.Read("MaxConcurrentRequests", maxConcurrentRequests);
+                    ok = data.MoveToAncestor(1u);
+                }
+                if (ok) {
+                    ok = pool.SetService(i, service, maxConcurrentRequests);
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Service %d is not an EPICSRPCService", i);
+            }
+        }
+    }
+    if (ok) {
         uint32 autoStart = 1u;
         (void) (data.Read("AutoStart", autoStart));
         if (autoStart == 1u) {
@@ -102,8 +134,17 @@ bool EPICSRPCServer::Initialise(StructuredDataI & data) {
 }
 
 ErrorManagement::ErrorType EPICSRPCServer::Start() {
-    executor.SetName(GetName());
-    ErrorManagement::ErrorType err = executor.Start();
+    ErrorManagement::ErrorType err = ErrorManagement::NoError;
+    if (numberOfWorkers > 0u) {
+        StreamString workersName = GetName();
+        workersName += "Workers";
+        //The workers shall accept requests before the services are registered
+        err = !pool.Start(numberOfWorkers, workersCPUMask, stackSize, workersName.Buffer());
+    }
+    if (err.ErrorsCleared()) {
+        executor.SetName(GetName());
+        err = executor.Start();
+    }
     return err;
 }
 
@@ -122,12 +163,22 @@ ErrorManagement::ErrorType EPICSRPCServer::Execute(ExecutionInfo& info) {
             }
             if (ok) {
                 const char8 * const serviceName = serviceObj->GetName();
-                std::shared_ptr<EPICSRPCServiceAdapter> rpcService(new EPICSRPCServiceAdapter());
-                ok = (rpcService ? true : false);
-                if (ok) {
-                    rpcService->SetHandler(service);
-                    REPORT_ERROR(ErrorManagement::Information, "Registered service with name %s", serviceName);
-                    rpcServer->registerService(serviceName, rpcService);
+                if (numberOfWorkers > 0u) {
+                    std::shared_ptr<EPICSRPCServiceAsyncAdapter> rpcService(new EPICSRPCServiceAsyncAdapter(pool, i));
+                    ok = (rpcService ? true : false);
+                    if (ok) {
+                        REPORT_ERROR(ErrorManagement::Information, "Registered service with name %s (executed by the workers)", serviceName);
+                        rpcServer->registerService(serviceName, rpcService);
+                    }
+                }
+                else {
+                    std::shared_ptr<EPICSRPCServiceAdapter> rpcService(new EPICSRPCServiceAdapter());
+                    ok = (rpcService ? true : false);
+                    if (ok) {
+                        rpcService->SetHandler(service);
+                        REPORT_ERROR(ErrorManagement::Information, "Registered service with name %s", serviceName);
+                        rpcServer->registerService(serviceName, rpcService);
+                    }
                 }
                 else {
                     REPORT_ERROR(ErrorManagement::FatalError, "Service %s is not an epics::pvAccess::RPCService", serviceName);
@@ -169,6 +220,10 @@ uint32 EPICSRPCServer::GetCPUMask() const {
     return cpuMask;
 }
 
+uint32 EPICSRPCServer::GetNumberOfWorkers() const {
+    return numberOfWorkers;
+}
+
 CLASS_REGISTER(EPICSRPCServer, "")
 CLASS_METHOD_REGISTER(EPICSRPCServer, Start)
 
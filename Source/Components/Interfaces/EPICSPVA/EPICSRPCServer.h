@@ -33,6 +33,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "EmbeddedServiceMethodBinderI.h"
+#include "EPICSRPCWorkerPool.h"
 #include "MessageI.h"
 #include "ReferenceContainer.h"
 #include "SingleThreadService.h"
@@ -53,8 +54,11 @@ namespace MARTe {
  *   StackSize = 1048576 //Optional the EmbeddedThread stack size. Default value is THREADS_DEFAULT_STACKSIZE * 4u
  *   CPUs = 0xff //Optional the affinity of the EmbeddedThread (where the EPICS context is attached).
  *   AutoStart = 0 //Optional. Default = 1. If false the service will only be started after receiving a Start message (see Start method).
+ *   NumberOfWorkers = 4 //Optional. Default = 0. Number of threads executing the requests (see below).
+ *   WorkersCPUs = 0xff //Optional. Default = CPUs. The affinity of the worker threads.
  *   +Service1 = {
  *      Class = EPICSPVA::EPICSObjectRegistryDatabaseService
+ *      MaxConcurrentRequests = 1 //Optional. Default = 0 (no limit). Only meaningful if NumberOfWorkers > 0 (see below).
  *      ...
  *   }
  *   +PV_2 = {
@@ -63,6 +67,12 @@ namespace MARTe {
  *   }
  * }
  * </pre>
+ *
+ * If NumberOfWorkers is 0, the requests of all the services are executed one after the other by the thread of the pvAccess server.
+ * Otherwise the requests are queued and executed by a pool of NumberOfWorkers threads (see EPICSRPCWorkerPool), so that a long-running
+ * request does not block the other ones. The requests of a service are executed, at most, MaxConcurrentRequests at the same time
+ * (e.g. MaxConcurrentRequests = 1 serialises the requests of a service which is not thread-safe); the requests of the other services
+ * are executed meanwhile by the free workers.
  */
 class EPICSRPCServer: public ReferenceContainer, public EmbeddedServiceMethodBinderI, public MessageI {
 public:
@@ -119,6 +129,12 @@ public:
      */
     uint32 GetCPUMask() const;
 
+    /**
+     * @brief Gets the number of worker threads.
+     * @return the number of worker threads (0 if the requests are executed by the pvAccess server thread).
+     */
+    uint32 GetNumberOfWorkers() const;
+
     /**
      * @brief Gets the embedded thread state.
      * @return the embedded thread state.
@@ -142,6 +158,21 @@ private:
      */
     uint32 stackSize;
 
+    /**
+     * The number of worker threads.
+     */
+    uint32 numberOfWorkers;
+
+    /**
+     * The CPU mask of the worker threads.
+     */
+    uint32 workersCPUMask;
+
+    /**
+     * Executes the requests if numberOfWorkers > 0.
+     */
+    EPICSRPCWorkerPool pool;
+
     /**
      * The EPICS server context
      */
@@ -54,5 +54,23 @@ epics::pvData::PVStructurePtr EPICSRPCServiceAdapter::request(epics::pvData::PVS
     return handler->request(args);
 }
 
+EPICSRPCServiceAsyncAdapter::EPICSRPCServiceAsyncAdapter(EPICSRPCWorkerPool &poolIn,
+                                                         const uint32 serviceIdxIn) :
+        epics::pvAccess::RPCServiceAsync(),
+        pool(poolIn) {
+    serviceIdx = serviceIdxIn;
+}
+
+EPICSRPCServiceAsyncAdapter::~EPICSRPCServiceAsyncAdapter() {
+}
+
+void EPICSRPCServiceAsyncAdapter::request(epics::pvData::PVStructure::shared_pointer const & args,
+                                          epics::pvAccess::RPCResponseCallback::shared_pointer const & callback) {
+    if (!pool.Enqueue(serviceIdx, args, callback)) {
+        epics::pvData::Status status(epics::pvData::Status::STATUSTYPE_ERROR, "Could not queue the RPC request");
+        callback->requestDone(status, epics::pvData::PVStructurePtr());
+    }
+}
+
 
 }
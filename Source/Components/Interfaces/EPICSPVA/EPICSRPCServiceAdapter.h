@@ -33,6 +33,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "EPICSRPCService.h"
+#include "EPICSRPCWorkerPool.h"
 #include "ReferenceT.h"
 
 /*---------------------------------------------------------------------------*/
@@ -75,6 +76,44 @@ private:
      */
     ReferenceT<EPICSRPCService> handler;
 };
+
+/**
+ * @brief As EPICSRPCServiceAdapter, but the requests are queued in an EPICSRPCWorkerPool and replied asynchronously by its workers,
+ * so that the pvAccess server thread is not blocked while a request is being executed.
+ */
+class EPICSRPCServiceAsyncAdapter : public epics::pvAccess::RPCServiceAsync {
+public:
+    /**
+     * @brief Constructor.
+     * @param[in] poolIn the pool where the requests are queued.
+     * @param[in] serviceIdxIn the index of the service in \a poolIn.
+     */
+    EPICSRPCServiceAsyncAdapter(EPICSRPCWorkerPool &poolIn,
+                                const uint32 serviceIdxIn);
+
+    /**
+     * @brief NOOP.
+     */
+    virtual ~EPICSRPCServiceAsyncAdapter();
+
+    /**
+     * @brief Queues the request in the pool. If the request cannot be queued it is immediately replied with an error.
+     * @see the epics::pvAccess::RPCServiceAsync::request.
+     */
+    virtual void request(epics::pvData::PVStructure::shared_pointer const & args,
+                         epics::pvAccess::RPCResponseCallback::shared_pointer const & callback);
+
+private:
+    /**
+     * The pool where the requests are queued.
+     */
+    EPICSRPCWorkerPool &pool;
+
+    /**
+     * The index of the service in the pool.
+     */
+    uint32 serviceIdx;
+};
 }
 
 
@@ -0,0 +1,275 @@
+/**
+ * @file EPICSRPCWorkerPool.cpp
+ * @brief Source file for class EPICSRPCWorkerPool
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class EPICSRPCWorkerPool (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "EPICSRPCWorkerPool.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+EPICSRPCWorkerPool::EPICSRPCWorkerPool() :
+        EmbeddedServiceMethodBinderI(),
+        workers(*this) {
+    head = NULL_PTR(Request *);
+    tail = NULL_PTR(Request *);
+    numberOfPendingRequests = 0u;
+    handlers = NULL_PTR(ReferenceT<EPICSRPCService> *);
+    maxConcurrentRequests = NULL_PTR(uint32 *);
+    activeRequests = NULL_PTR(uint32 *);
+    numberOfServices = 0u;
+    running = false;
+    (void) mux.Create();
+    if (!requestSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem.");
+    }
+}
+
+/*lint -e{1551} the destructor must guarantee that the worker threads are stopped and the memory freed.*/
+EPICSRPCWorkerPool::~EPICSRPCWorkerPool() {
+    (void) Stop();
+    if (handlers != NULL_PTR(ReferenceT<EPICSRPCService> *)) {
+        delete[] handlers;
+    }
+    if (maxConcurrentRequests != NULL_PTR(uint32 *)) {
+        delete[] maxConcurrentRequests;
+    }
+    if (activeRequests != NULL_PTR(uint32 *)) {
+        delete[] activeRequests;
+    }
+    (void) requestSem.Close();
+}
+
+bool EPICSRPCWorkerPool::SetNumberOfServices(const uint32 numberOfServicesIn) {
+    bool ok = (handlers == NULL_PTR(ReferenceT<EPICSRPCService> *));
+    if (ok) {
+        numberOfServices = numberOfServicesIn;
+        handlers = new ReferenceT<EPICSRPCService> [numberOfServices];
+        maxConcurrentRequests = new uint32[numberOfServices];
+        activeRequests = new uint32[numberOfServices];
+        for (uint32 s = 0u; s < numberOfServices; s++) {
+            maxConcurrentRequests[s] = 0u;
+            activeRequests[s] = 0u;
+        }
+    }
+    return ok;
+}
+
+bool EPICSRPCWorkerPool::SetService(const uint32 serviceIdx,
+                                    ReferenceT<EPICSRPCService> handler,
+                                    const uint32 maxConcurrentRequestsIn) {
+    bool ok = (serviceIdx < numberOfServices);
+    if (ok) {
+        ok = handler.IsValid();
+    }
+    if (ok) {
+        /*lint -e{613} serviceIdx < numberOfServices => handlers != NULL*/
+        handlers[serviceIdx] = handler;
+        maxConcurrentRequests[serviceIdx] = maxConcurrentRequestsIn;
+    }
+    return ok;
+}
+
+bool EPICSRPCWorkerPool::Start(const uint32 numberOfWorkers,
+                               const uint32 cpuMask,
+                               const uint32 stackSize,
+                               const char8 * const name) {
+    bool ok = (numberOfWorkers > 0u) && (!running);
+    if (ok) {
+        workers.SetNumberOfPoolThreads(numberOfWorkers);
+        workers.SetCPUMask(cpuMask);
+        workers.SetStackSize(stackSize);
+        workers.SetName(name);
+        running = true;
+        ok = (workers.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            running = false;
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start the RPC worker threads");
+        }
+    }
+    return ok;
+}
+
+bool EPICSRPCWorkerPool::Stop() {
+    bool ok = true;
+    if (mux.FastLock() == ErrorManagement::NoError) {
+        running = false;
+        (void) requestSem.Post();
+        mux.FastUnLock();
+    }
+    if (!workers.Stop()) {
+        ok = workers.Stop();
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the RPC worker threads.");
+        }
+    }
+    //Reply to the requests which were not executed
+    Request *pending = NULL_PTR(Request *);
+    if (mux.FastLock() == ErrorManagement::NoError) {
+        pending = head;
+        head = NULL_PTR(Request *);
+        tail = NULL_PTR(Request *);
+        numberOfPendingRequests = 0u;
+        mux.FastUnLock();
+    }
+    while (pending != NULL_PTR(Request *)) {
+        Request *next = pending->next;
+        if (pending->callback) {
+            epics::pvData::Status status(epics::pvData::Status::STATUSTYPE_ERROR, "The RPC server is stopping");
+            pending->callback->requestDone(status, epics::pvData::PVStructurePtr());
+        }
+        delete pending;
+        pending = next;
+    }
+    return ok;
+}
+
+bool EPICSRPCWorkerPool::Enqueue(const uint32 serviceIdx,
+                                 epics::pvData::PVStructure::shared_pointer const & args,
+                                 epics::pvAccess::RPCResponseCallback::shared_pointer const & callback) {
+    bool ok = (serviceIdx < numberOfServices);
+    if (ok) {
+        Request *request = new Request;
+        request->serviceIdx = serviceIdx;
+        request->args = args;
+        request->callback = callback;
+        request->next = NULL_PTR(Request *);
+        ok = (mux.FastLock() == ErrorManagement::NoError);
+        if (ok) {
+            ok = running;
+            if (ok) {
+                if (tail == NULL_PTR(Request *)) {
+                    head = request;
+                }
+                else {
+                    tail->next = request;
+                }
+                tail = request;
+                numberOfPendingRequests++;
+                (void) requestSem.Post();
+            }
+            mux.FastUnLock();
+        }
+        if (!ok) {
+            delete request;
+        }
+    }
+    return ok;
+}
+
+uint32 EPICSRPCWorkerPool::GetNumberOfServices() const {
+    return numberOfServices;
+}
+
+uint32 EPICSRPCWorkerPool::GetNumberOfPendingRequests() {
+    uint32 ret = 0u;
+    if (mux.FastLock() == ErrorManagement::NoError) {
+        ret = numberOfPendingRequests;
+        mux.FastUnLock();
+    }
+    return ret;
+}
+
+ErrorManagement::ErrorType EPICSRPCWorkerPool::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        Request *request = NULL_PTR(Request *);
+        if (mux.FastLock() == ErrorManagement::NoError) {
+            Request *previous = NULL_PTR(Request *);
+            Request *candidate = head;
+            while ((running) && (candidate != NULL_PTR(Request *)) && (request == NULL_PTR(Request *))) {
+                uint32 s = candidate->serviceIdx;
+                /*lint -e{613} the requests are only queued with serviceIdx < numberOfServices*/
+                if ((maxConcurrentRequests[s] == 0u) || (activeRequests[s] < maxConcurrentRequests[s])) {
+                    request = candidate;
+                    if (previous == NULL_PTR(Request *)) {
+                        head = candidate->next;
+                    }
+                    else {
+                        previous->next = candidate->next;
+                    }
+                    if (tail == candidate) {
+                        tail = previous;
+                    }
+                    numberOfPendingRequests--;
+                    activeRequests[s]++;
+                }
+                else {
+                    previous = candidate;
+                    candidate = candidate->next;
+                }
+            }
+            if ((request == NULL_PTR(Request *)) && (running)) {
+                //Posted under the same lock by Enqueue and when a request completes
+                (void) requestSem.Reset();
+            }
+            mux.FastUnLock();
+        }
+        if (request != NULL_PTR(Request *)) {
+            Process(*request);
+            if (mux.FastLock() == ErrorManagement::NoError) {
+                /*lint -e{613} the requests are only queued with serviceIdx < numberOfServices*/
+                activeRequests[request->serviceIdx]--;
+                //Requests of this service may now be executed
+                (void) requestSem.Post();
+                mux.FastUnLock();
+            }
+            delete request;
+        }
+        else {
+            (void) requestSem.Wait(TimeoutType(100u));
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+void EPICSRPCWorkerPool::Process(const Request &request) {
+    epics::pvData::PVStructurePtr result;
+    epics::pvData::Status status = epics::pvData::Status::Ok;
+    try {
+        /*lint -e{613} the requests are only queued with serviceIdx < numberOfServices*/
+        result = handlers[request.serviceIdx]->request(request.args);
+    }
+    catch (epics::pvAccess::RPCRequestException &e) {
+        status = epics::pvData::Status(e.getStatus(), e.what());
+    }
+    catch (std::exception &e) {
+        status = epics::pvData::Status(epics::pvData::Status::STATUSTYPE_FATAL, e.what());
+    }
+    if (request.callback) {
+        request.callback->requestDone(status, result);
+    }
+}
+
+}
@@ -0,0 +1,214 @@
+/**
+ * @file EPICSRPCWorkerPool.h
+ * @brief Header file for class EPICSRPCWorkerPool
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class EPICSRPCWorkerPool
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EPICSPVA_EPICSRPCWORKERPOOL_H_
+#define EPICSPVA_EPICSRPCWORKERPOOL_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "pv/rpcService.h"
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EPICSRPCService.h"
+#include "EventSem.h"
+#include "FastPollingMutexSem.h"
+#include "MultiThreadService.h"
+#include "ReferenceT.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief A pool of threads which executes the requests of a set of EPICSRPCService.
+ * @details The requests are queued (see Enqueue) and executed, in the order of arrival, by the first free worker thread.
+ * Each service has a maximum number of requests executed at the same time: the requests of a service which has reached its limit
+ * remain queued while the requests of the other services are executed. Thus, a long request (e.g. dumping a large subtree of the
+ * ObjectRegistryDatabase) does not delay the requests of the other services and cannot take all the workers.
+ *
+ * The reply of each request is sent with the epics::pvAccess::RPCResponseCallback of the request. Requests which are still queued
+ * when the pool is stopped are replied with an error.
+ */
+class EPICSRPCWorkerPool: public EmbeddedServiceMethodBinderI {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     * @post
+     *   GetNumberOfServices() == 0
+     *   GetNumberOfPendingRequests() == 0
+     */
+    EPICSRPCWorkerPool();
+
+    /**
+     * @brief Stops the worker threads (see Stop).
+     */
+    virtual ~EPICSRPCWorkerPool();
+
+    /**
+     * @brief Allocates the services.
+     * @param[in] numberOfServicesIn the number of services.
+     * @return true if the services were not yet allocated.
+     */
+    bool SetNumberOfServices(const uint32 numberOfServicesIn);
+
+    /**
+     * @brief Sets a service.
+     * @param[in] serviceIdx the index of the service.
+     * @param[in] handler the service implementation.
+     * @param[in] maxConcurrentRequestsIn the maximum number of requests of the service executed at the same time (0 for no limit).
+     * @return true if serviceIdx < GetNumberOfServices() and the handler is valid.
+     */
+    bool SetService(const uint32 serviceIdx,
+                    ReferenceT<EPICSRPCService> handler,
+                    const uint32 maxConcurrentRequestsIn);
+
+    /**
+     * @brief Starts the worker threads.
+     * @param[in] numberOfWorkers the number of threads (> 0).
+     * @param[in] cpuMask the affinity of the threads.
+     * @param[in] stackSize the stack size of the threads.
+     * @param[in] name the name of the threads.
+     * @return true if the threads were started.
+     */
+    bool Start(const uint32 numberOfWorkers,
+               const uint32 cpuMask,
+               const uint32 stackSize,
+               const char8 * const name);
+
+    /**
+     * @brief Stops the worker threads and replies to the queued requests with an error.
+     * @return true if the threads were stopped.
+     */
+    bool Stop();
+
+    /**
+     * @brief Queues a request.
+     * @param[in] serviceIdx the index of the service.
+     * @param[in] args the arguments of the request.
+     * @param[in] callback where the reply is sent.
+     * @return true if the request was queued (otherwise the caller shall reply).
+     */
+    bool Enqueue(const uint32 serviceIdx,
+                 epics::pvData::PVStructure::shared_pointer const & args,
+                 epics::pvAccess::RPCResponseCallback::shared_pointer const & callback);
+
+    /**
+     * @brief Gets the number of services.
+     */
+    uint32 GetNumberOfServices() const;
+
+    /**
+     * @brief Gets the number of requests which are queued.
+     */
+    uint32 GetNumberOfPendingRequests();
+
+    /**
+     * @brief Worker threads callback. Executes the first queued request whose service has not reached its limit.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+private:
+
+    /**
+     * @brief A queued request.
+     */
+    struct Request {
+        uint32 serviceIdx;
+        epics::pvData::PVStructure::shared_pointer args;
+        epics::pvAccess::RPCResponseCallback::shared_pointer callback;
+        Request *next;
+    };
+
+    /**
+     * @brief Executes a request and sends the reply.
+     */
+    void Process(const Request &request);
+
+    /**
+     * The worker threads.
+     */
+    MultiThreadService workers;
+
+    /**
+     * Protects the queue and the number of active requests.
+     */
+    FastPollingMutexSem mux;
+
+    /**
+     * Posted when a request may be executed.
+     */
+    EventSem requestSem;
+
+    /**
+     * The first queued request.
+     */
+    Request *head;
+
+    /**
+     * The last queued request.
+     */
+    Request *tail;
+
+    /**
+     * The number of queued requests.
+     */
+    uint32 numberOfPendingRequests;
+
+    /**
+     * The services.
+     */
+    ReferenceT<EPICSRPCService> *handlers;
+
+    /**
+     * The maximum number of requests of each service executed at the same time.
+     */
+    uint32 *maxConcurrentRequests;
+
+    /**
+     * The number of requests of each service being executed.
+     */
+    uint32 *activeRequests;
+
+    /**
+     * The number of services.
+     */
+    uint32 numberOfServices;
+
+    /**
+     * True while the worker threads accept requests.
+     */
+    bool running;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EPICSPVA_EPICSRPCWORKERPOOL_H_ */
@@ -0,0 +1,361 @@
+/**
+ * @file ForkJoinPool.h
+ * @brief Header file for class ForkJoinPool
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ForkJoinPool
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FORKJOINPOOL_H_
+#define FORKJOINPOOL_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "HighResolutionTimer.h"
+#include "MultiThreadService.h"
+#include "StructuredDataI.h"
+#include "ThreadPlacement.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The maximum number of worker threads of a ForkJoinPool.
+ */
+const uint32 FORK_JOIN_POOL_MAX_WORKERS = 64u;
+
+/**
+ * @brief The work which is split by a ForkJoinPool.
+ */
+class ForkJoinTaskI {
+public:
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~ForkJoinTaskI() {
+    }
+
+    /**
+     * @brief Executes the share of the work assigned to \a executor.
+     * @param[in] executor 0 for the thread which called ForkJoinPool::Run, n for the worker n - 1.
+     * @return false if the work failed.
+     */
+    virtual bool ExecuteTask(const uint32 executor) = 0;
+};
+
+/**
+ * @brief A pool of worker threads which execute a ForkJoinTaskI together with the calling (real-time) thread.
+ * @details Run() releases the workers, executes the share of the calling thread (executor 0) and returns only when all the
+ * workers completed their share (executors 1 to GetNumberOfWorkers()), i.e. Run() is a deterministic fork/join barrier. The threads
+ * are created once by Start(): the workers busy-wait on the next Run() (they never sleep, so that they are released in a few hundred
+ * nanoseconds) and should thus run on isolated cores. With a ThreadPlacement block the worker n is pinned to the n-th CPU of the mask
+ * (modulo the number of CPUs) and runs with the configured priority. The workers return to the MultiThreadService every millisecond
+ * while idle, so that the pool can be stopped.
+ *
+ * If the pool has no workers or was not started, Run() executes the share of all the executors in the calling thread.
+ *
+ * The configuration syntax (read from the configuration of the component) is:
+ *
+ * <pre>
+ *     NumberOfWorkers = 3 //Optional. Default = the number of CPUs in the ThreadPlacement CPUs (or 0). At most 64.
+ *     ThreadPlacement = { //Optional. See ThreadPlacement.
+ *         CPUs = 0xE //Worker 0 on CPU 1, worker 1 on CPU 2 and worker 2 on CPU 3.
+ *         PriorityClass = RealTimePriorityClass
+ *         PriorityLevel = 20
+ *     }
+ * </pre>
+ *
+ * Run() shall be called by one thread at a time.
+ */
+class ForkJoinPool: public EmbeddedServiceMethodBinderI {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetNumberOfWorkers() == 0 &&
+     *   !IsRunning()
+     */
+    inline ForkJoinPool();
+
+    /**
+     * @brief Stops the worker threads.
+     */
+    inline virtual ~ForkJoinPool();
+
+    /**
+     * @brief Reads the NumberOfWorkers and the ThreadPlacement block (see the class description).
+     * @param[in] data the configuration of the component.
+     * @return true if the parameters are valid.
+     */
+    inline bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Starts the worker threads (if any).
+     * @param[in] taskIn the work to split. It shall exist for the life of the pool.
+     * @param[in] name the name of the worker threads.
+     * @return true if there are no workers or if the workers could be started.
+     */
+    inline bool Start(ForkJoinTaskI &taskIn,
+                      const char8 * const name);
+
+    /**
+     * @brief Executes the task on all the executors and waits for them to complete.
+     * @return false if any of the executors failed.
+     */
+    inline bool Run();
+
+    /**
+     * @brief Returns true if the worker threads were started.
+     */
+    inline bool IsRunning() const;
+
+    /**
+     * @brief Gets the number of worker threads.
+     */
+    inline uint32 GetNumberOfWorkers() const;
+
+    /**
+     * @brief Worker thread callback. Pins the worker at startup and then waits (busy) for the next Run().
+     * @return ErrorManagement::NoError.
+     */
+    inline virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+private:
+
+    /**
+     * @brief Pins the calling worker on its CPU of the ThreadPlacement mask.
+     */
+    inline void PinWorker(const uint32 worker) const;
+
+    /**
+     * The task executed by Run().
+     */
+    ForkJoinTaskI *task;
+
+    /**
+     * The number of worker threads.
+     */
+    uint32 numberOfWorkers;
+
+    /**
+     * The CPU placement and priority of the worker threads.
+     */
+    ThreadPlacement placement;
+
+    /**
+     * The worker threads.
+     */
+    MultiThreadService workers;
+
+    /**
+     * Incremented by Run() to release the workers.
+     */
+    volatile int32 generation;
+
+    /**
+     * The last generation executed by each worker.
+     */
+    int32 *workerGeneration;
+
+    /**
+     * The number of workers which completed the current Run().
+     */
+    volatile int32 completed;
+
+    /**
+     * The number of workers which failed in the current Run().
+     */
+    volatile int32 failures;
+
+    /**
+     * True if the worker threads were started.
+     */
+    bool started;
+
+    /**
+     * Busy-wait period, in HighResolutionTimer counts, after which a worker returns to the MultiThreadService (to allow it to be stopped).
+     */
+    uint64 spinTimeoutCounts;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+ForkJoinPool::ForkJoinPool() :
+        EmbeddedServiceMethodBinderI(),
+        workers(*this) {
+    task = NULL_PTR(ForkJoinTaskI *);
+    numberOfWorkers = 0u;
+    generation = 0;
+    workerGeneration = NULL_PTR(int32 *);
+    completed = 0;
+    failures = 0;
+    spinTimeoutCounts = 0u;
+    started = false;
+}
+
+/*lint -e{1551} the destructor must guarantee that the workers are stopped before the generations are freed.*/
+ForkJoinPool::~ForkJoinPool() {
+    if (!workers.Stop()) {
+        if (!workers.Stop()) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not stop MultiThreadService.");
+        }
+    }
+    if (workerGeneration != NULL_PTR(int32 *)) {
+        delete[] workerGeneration;
+    }
+    task = NULL_PTR(ForkJoinTaskI *);
+}
+
+bool ForkJoinPool::Initialise(StructuredDataI &data) {
+    bool ok = placement.Initialise(data);
+    if (ok) {
+        uint32 defaultNumberOfWorkers = 0u;
+        if (placement.HasCPUMask()) {
+            uint64 cpus = placement.GetCPUBits();
+            while (cpus != 0ull) {
+                defaultNumberOfWorkers++;
+                cpus &= (cpus - 1ull);
+            }
+        }
+        if (!data.Read("NumberOfWorkers", numberOfWorkers)) {
+            numberOfWorkers = defaultNumberOfWorkers;
+        }
+        ok = (numberOfWorkers <= FORK_JOIN_POOL_MAX_WORKERS);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "NumberOfWorkers shall be <= %u", FORK_JOIN_POOL_MAX_WORKERS);
+        }
+    }
+    return ok;
+}
+
+bool ForkJoinPool::Start(ForkJoinTaskI &taskIn,
+                         const char8 * const name) {
+    bool ok = true;
+    task = &taskIn;
+    if ((numberOfWorkers > 0u) && (!started)) {
+        if (workerGeneration == NULL_PTR(int32 *)) {
+            workerGeneration = new int32[numberOfWorkers];
+        }
+        for (uint32 t = 0u; t < numberOfWorkers; t++) {
+            workerGeneration[t] = generation;
+        }
+        spinTimeoutCounts = HighResolutionTimer::Frequency() / 1000u;
+        workers.SetName(name);
+        workers.SetNumberOfPoolThreads(numberOfWorkers);
+        placement.Apply(workers);
+        ok = (workers.Start() == ErrorManagement::NoError);
+        started = ok;
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not start the worker threads");
+        }
+    }
+    return ok;
+}
+
+bool ForkJoinPool::Run() {
+    bool ok = (task != NULL_PTR(ForkJoinTaskI *));
+    if (ok) {
+        bool forked = IsRunning();
+        if (forked) {
+            (void) Atomic::Exchange(&completed, 0);
+            //Full barrier: the workers see everything written by the caller before the new generation
+            Atomic::Increment(&generation);
+        }
+        ok = task->ExecuteTask(0u);
+        if (forked) {
+            while (completed < static_cast<int32>(numberOfWorkers)) {
+            }
+            if (failures > 0) {
+                (void) Atomic::Exchange(&failures, 0);
+                ok = false;
+            }
+        }
+        else {
+            for (uint32 e = 1u; e <= numberOfWorkers; e++) {
+                if (!task->ExecuteTask(e)) {
+                    ok = false;
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+bool ForkJoinPool::IsRunning() const {
+    return started;
+}
+
+uint32 ForkJoinPool::GetNumberOfWorkers() const {
+    return numberOfWorkers;
+}
+
+ErrorManagement::ErrorType ForkJoinPool::Execute(ExecutionInfo &info) {
+    uint32 t = info.GetThreadNumber();
+    if (info.GetStage() == ExecutionInfo::StartupStage) {
+        PinWorker(t);
+    }
+    else if (info.GetStage() == ExecutionInfo::MainStage) {
+        if ((t < numberOfWorkers) && (workerGeneration != NULL_PTR(int32 *)) && (task != NULL_PTR(ForkJoinTaskI *))) {
+            //Busy-wait the next Run(), returning periodically so that the service can be stopped
+            uint64 startCounter = HighResolutionTimer::Counter();
+            bool released = (generation != workerGeneration[t]);
+            while ((!released) && ((HighResolutionTimer::Counter() - startCounter) < spinTimeoutCounts)) {
+                released = (generation != workerGeneration[t]);
+            }
+            if (released) {
+                workerGeneration[t] = generation;
+                if (!task->ExecuteTask(t + 1u)) {
+                    Atomic::Increment(&failures);
+                }
+                //Full barrier: the caller sees the results of the worker before the completion
+                Atomic::Increment(&completed);
+            }
+        }
+    }
+    else {
+        //NOOP
+    }
+    return ErrorManagement::NoError;
+}
+
+void ForkJoinPool::PinWorker(const uint32 worker) const {
+    if (placement.HasCPUMask()) {
+        //Pin the worker on the (worker modulo number of CPUs)-th CPU of the mask
+        (void) ThreadPlacement::PinCallingThread(placement.GetCPUBits(), worker);
+    }
+}
+
+}
+
+#endif /* FORKJOINPOOL_H_ */
@@ -0,0 +1,368 @@
+/**
+ * @file HugePageHeap.cpp
+ * @brief Source file for class HugePageHeap
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HugePageHeap (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HeapManager.h"
+#include "HugePageHeap.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+HugePageHeap::HugePageHeap() :
+        Object(),
+        HeapI() {
+    arena = NULL_PTR(char8 *);
+    arenaSize = 0u;
+    hugeTLB = false;
+    registered = false;
+    mux.Create();
+}
+
+/*lint -e{1551} the destructor must unregister the heap and unmap the arena*/
+HugePageHeap::~HugePageHeap() {
+    if (registered) {
+        (void) HeapManager::RemoveHeap(this);
+    }
+    if (arena != NULL_PTR(char8 *)) {
+        (void) munlock(arena, static_cast<size_t>(arenaSize));
+        (void) munmap(arena, static_cast<size_t>(arenaSize));
+    }
+    arena = NULL_PTR(char8 *);
+}
+
+bool HugePageHeap::Initialise(StructuredDataI &data) {
+    bool ret = Object::Initialise(data);
+    uint64 size = 0u;
+    StreamString hugePages;
+    uint32 hugePageSize = 2097152u;
+    int32 numaNode = -1;
+    uint32 lock = 1u;
+    uint32 prefault = 1u;
+    if (ret) {
+        ret = data.Read("Size", size);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Size shall be specified");
+        }
+    }
+    if (ret) {
+        ret = (size > 0u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Size shall be > 0");
+        }
+    }
+    if (ret) {
+        if (!data.Read("HugePages", hugePages)) {
+            hugePages = "HugeTLB";
+        }
+        ret = ((hugePages == "HugeTLB") || (hugePages == "Transparent") || (hugePages == "None"));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "HugePages shall be HugeTLB, Transparent or None");
+        }
+    }
+    if (ret) {
+        if (!data.Read("HugePageSize", hugePageSize)) {
+            hugePageSize = 2097152u;
+        }
+        //Power of two
+        ret = ((hugePageSize > 0u) && ((hugePageSize & (hugePageSize - 1u)) == 0u));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "HugePageSize shall be a power of two");
+        }
+    }
+    if (ret) {
+        if (!data.Read("NUMANode", numaNode)) {
+            numaNode = -1;
+        }
+        ret = (numaNode < static_cast<int32>(HUGE_PAGE_HEAP_MAX_NUMA_NODES));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NUMANode shall be < %d", HUGE_PAGE_HEAP_MAX_NUMA_NODES);
+        }
+    }
+    if (ret) {
+        if (!data.Read("Lock", lock)) {
+            lock = 1u;
+        }
+        if (!data.Read("Prefault", prefault)) {
+            prefault = 1u;
+        }
+    }
+    uint64 pageSize = static_cast<uint64>(sysconf(_SC_PAGESIZE));
+    if (ret) {
+        uint64 granularity = (hugePages == "None") ? (pageSize) : (static_cast<uint64>(hugePageSize));
+        uint64 mappedSize = (((size + granularity) - 1u) / granularity) * granularity;
+        ret = (mappedSize <= 0xFFFFFFFFu);
+        if (ret) {
+            arenaSize = static_cast<uint32>(mappedSize);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Size shall be < 4 GB");
+        }
+    }
+    if (ret) {
+        void *mem = MAP_FAILED;
+        /*lint -e{9130} -e{9027} the flags of mmap are defined as int*/
+        int32 flags = MAP_PRIVATE | MAP_ANONYMOUS;
+        if (hugePages == "HugeTLB") {
+            int32 hugeFlags = flags | MAP_HUGETLB;
+#ifdef MAP_HUGE_SHIFT
+            int32 log2HugePageSize = 0;
+            uint32 p = hugePageSize;
+            while (p > 1u) {
+                p >>= 1u;
+                log2HugePageSize++;
+            }
+            hugeFlags |= (log2HugePageSize << MAP_HUGE_SHIFT);
+#endif
+            mem = mmap(NULL_PTR(void *), static_cast<size_t>(arenaSize), PROT_READ | PROT_WRITE, hugeFlags, -1, 0);
+            hugeTLB = (mem != MAP_FAILED);
+            if (!hugeTLB) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not map %u bytes of %u bytes huge pages (check /proc/sys/vm/nr_hugepages). Falling back to transparent huge pages",
+                             arenaSize, hugePageSize);
+                hugePages = "Transparent";
+            }
+        }
+        if (mem == MAP_FAILED) {
+            mem = mmap(NULL_PTR(void *), static_cast<size_t>(arenaSize), PROT_READ | PROT_WRITE, flags, -1, 0);
+        }
+        ret = (mem != MAP_FAILED);
+        if (ret) {
+            arena = static_cast<char8 *>(mem);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::OSError, "Could not map an arena of %u bytes", arenaSize);
+        }
+    }
+    if (ret) {
+        //Before touching the pages, so that they do not have to be moved
+        if (numaNode >= 0) {
+            unsigned long nodeMask = (1ul << static_cast<uint32>(numaNode));
+            long err = syscall(SYS_mbind, arena, static_cast<unsigned long>(arenaSize), MPOL_PREFERRED, &nodeMask,
+                               static_cast<unsigned long>(HUGE_PAGE_HEAP_MAX_NUMA_NODES + 1u), 0u);
+            if (err != 0) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not bind the arena to the NUMA node %d", numaNode);
+            }
+        }
+#ifdef MADV_HUGEPAGE
+        if (hugePages == "Transparent") {
+            if (madvise(arena, static_cast<size_t>(arenaSize), MADV_HUGEPAGE) != 0) {
+                REPORT_ERROR(ErrorManagement::Warning, "Transparent huge pages are not available");
+            }
+        }
+#endif
+        if (lock == 1u) {
+            if (mlock(arena, static_cast<size_t>(arenaSize)) != 0) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not lock the arena (check RLIMIT_MEMLOCK)");
+            }
+        }
+        if (prefault == 1u) {
+            //Writing is required: reading an anonymous page maps the shared zero page
+            (void) MemoryOperationsHelper::Set(arena, '\0', arenaSize);
+        }
+        BlockHeader *first = reinterpret_cast<BlockHeader *>(arena);
+        first->size = arenaSize;
+        first->used = false;
+    }
+    if (ret) {
+        ret = HeapManager::AddHeap(this);
+        registered = ret;
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not register the heap %s in the HeapManager", GetName());
+        }
+    }
+    return ret;
+}
+
+uint32 HugePageHeap::HeaderSize() {
+    uint32 headerSize = static_cast<uint32>(sizeof(BlockHeader));
+    return (((headerSize + HUGE_PAGE_HEAP_ALIGNMENT) - 1u) / HUGE_PAGE_HEAP_ALIGNMENT) * HUGE_PAGE_HEAP_ALIGNMENT;
+}
+
+void *HugePageHeap::Malloc(const uint32 size) {
+    void *ret = NULL_PTR(void *);
+    uint64 needed64 = static_cast<uint64>(HeaderSize()) + ((((static_cast<uint64>(size) + HUGE_PAGE_HEAP_ALIGNMENT) - 1u) / HUGE_PAGE_HEAP_ALIGNMENT) * HUGE_PAGE_HEAP_ALIGNMENT);
+    if ((arena != NULL_PTR(char8 *)) && (needed64 <= arenaSize)) {
+        uint32 needed = static_cast<uint32>(needed64);
+        if (mux.FastLock() == ErrorManagement::NoError) {
+            uint32 offset = 0u;
+            while ((offset < arenaSize) && (ret == NULL_PTR(void *))) {
+                BlockHeader *block = reinterpret_cast<BlockHeader *>(&arena[offset]);
+                if (!block->used) {
+                    //Coalesce with the following free blocks
+                    uint32 next = offset + block->size;
+                    while ((next < arenaSize) && (!reinterpret_cast<BlockHeader *>(&arena[next])->used)) {
+                        uint32 nextSize = reinterpret_cast<BlockHeader *>(&arena[next])->size;
+                        block->size += nextSize;
+                        next += nextSize;
+                    }
+                    if (block->size >= needed) {
+                        uint32 remainder = block->size - needed;
+                        if (remainder >= (HeaderSize() + HUGE_PAGE_HEAP_ALIGNMENT)) {
+                            BlockHeader *split = reinterpret_cast<BlockHeader *>(&arena[offset + needed]);
+                            split->size = remainder;
+                            split->used = false;
+                            block->size = needed;
+                        }
+                        block->used = true;
+                        ret = reinterpret_cast<void *>(&arena[offset + HeaderSize()]);
+                    }
+                }
+                offset += block->size;
+            }
+            mux.FastUnLock();
+        }
+    }
+    return ret;
+}
+
+HugePageHeap::BlockHeader *HugePageHeap::GetHeader(const void * const data) const {
+    BlockHeader *header = NULL_PTR(BlockHeader *);
+    /*lint -e{923} pointer to integer conversion required to check that the pointer belongs to the arena*/
+    uintp address = reinterpret_cast<uintp>(data);
+    if ((arena != NULL_PTR(char8 *)) && (address >= (FirstAddress() + HeaderSize())) && (address < LastAddress())) {
+        uint32 offset = static_cast<uint32>(address - FirstAddress()) - HeaderSize();
+        header = reinterpret_cast<BlockHeader *>(&arena[offset]);
+    }
+    return header;
+}
+
+void HugePageHeap::Free(void *&data) {
+    BlockHeader *header = GetHeader(data);
+    if (header != NULL_PTR(BlockHeader *)) {
+        if (mux.FastLock() == ErrorManagement::NoError) {
+            header->used = false;
+            mux.FastUnLock();
+        }
+        data = NULL_PTR(void *);
+    }
+    else if (data != NULL_PTR(void *)) {
+        REPORT_ERROR(ErrorManagement::FatalError, "The memory to be freed does not belong to the heap %s", GetName());
+    }
+    else {
+        //NULL is silently ignored
+    }
+}
+
+void *HugePageHeap::Realloc(void *&data,
+                            const uint32 newSize) {
+    if (data == NULL_PTR(void *)) {
+        data = Malloc(newSize);
+    }
+    else if (newSize == 0u) {
+        Free(data);
+    }
+    else {
+        BlockHeader *header = GetHeader(data);
+        void *newData = NULL_PTR(void *);
+        if (header != NULL_PTR(BlockHeader *)) {
+            newData = Malloc(newSize);
+        }
+        if (newData != NULL_PTR(void *)) {
+            uint32 oldSize = header->size - HeaderSize();
+            uint32 copySize = (oldSize < newSize) ? (oldSize) : (newSize);
+            (void) MemoryOperationsHelper::Copy(newData, data, copySize);
+            Free(data);
+        }
+        data = newData;
+    }
+    return data;
+}
+
+void *HugePageHeap::Duplicate(const void * const data,
+                              const uint32 size) {
+    void *duplicate = NULL_PTR(void *);
+    if (data != NULL_PTR(const void *)) {
+        uint32 duplicateSize = size;
+        if (duplicateSize == 0u) {
+            //As the StandardHeap, a size of zero duplicates a string
+            duplicateSize = StringHelper::Length(static_cast<const char8 *>(data)) + 1u;
+        }
+        duplicate = Malloc(duplicateSize);
+        if (duplicate != NULL_PTR(void *)) {
+            (void) MemoryOperationsHelper::Copy(duplicate, data, duplicateSize);
+        }
+    }
+    return duplicate;
+}
+
+uintp HugePageHeap::FirstAddress() const {
+    /*lint -e{923} pointer to integer conversion required by the HeapI interface*/
+    return reinterpret_cast<uintp>(arena);
+}
+
+uintp HugePageHeap::LastAddress() const {
+    uintp last = 0u;
+    if (arena != NULL_PTR(char8 *)) {
+        last = FirstAddress() + arenaSize;
+    }
+    return last;
+}
+
+const char8 *HugePageHeap::Name() const {
+    return GetName();
+}
+
+uint32 HugePageHeap::GetFreeSize() {
+    uint32 freeSize = 0u;
+    if (arena != NULL_PTR(char8 *)) {
+        if (mux.FastLock() == ErrorManagement::NoError) {
+            uint32 offset = 0u;
+            while (offset < arenaSize) {
+                BlockHeader *block = reinterpret_cast<BlockHeader *>(&arena[offset]);
+                if (!block->used) {
+                    freeSize += block->size;
+                }
+                offset += block->size;
+            }
+            mux.FastUnLock();
+        }
+    }
+    return freeSize;
+}
+
+bool HugePageHeap::IsHugeTLB() const {
+    return hugeTLB;
+}
+
+CLASS_REGISTER(HugePageHeap, "1.0")
+
+}
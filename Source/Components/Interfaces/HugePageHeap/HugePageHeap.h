@@ -0,0 +1,219 @@
+/**
+ * @file HugePageHeap.h
+ * @brief Header file for class HugePageHeap
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HugePageHeap
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef HUGEPAGEHEAP_H_
+#define HUGEPAGEHEAP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "FastPollingMutexSem.h"
+#include "HeapI.h"
+#include "Object.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The alignment (and minimum granularity) of the blocks returned by the HugePageHeap.
+ */
+const uint32 HUGE_PAGE_HEAP_ALIGNMENT = 64u;
+
+/**
+ * The maximum NUMA node which can be selected.
+ */
+const uint32 HUGE_PAGE_HEAP_MAX_NUMA_NODES = 64u;
+
+/**
+ * @brief A HeapI which allocates from a single arena that is huge page backed, prefaulted, locked in memory and, optionally, bound to a NUMA node.
+ *
+ * @details The arena is mapped once, when the object is initialised, and registered in the HeapManager with the name of the object,
+ * so that the components which accept a HeapName parameter (e.g. FileWriter, MDSWriter, UDPReceiver, NI6368ADC and the
+ * MemoryDataSourceI based DataSources such as the RealTimeThreadAsyncBridge) allocate their signal memory from it. As the pages are
+ * already resident (and locked) the first cycle after a state change does not take page faults nor TLB misses on small pages.
+ *
+ * The arena is managed with a first-fit list of blocks aligned to HUGE_PAGE_HEAP_ALIGNMENT bytes, which are coalesced with
+ * the following free block when freed. It is meant for the buffers that are allocated while configuring the application, not for
+ * frequent allocations in the real-time loop. Malloc returns NULL when the arena is exhausted (the arena never grows).
+ *
+ * The object must be declared before the components which use it, so that it is registered when they are initialised.
+ * The arena is unmapped when the object is destroyed: all the components which use it must have been destroyed before.
+ *
+ * The huge pages (HugePages = HugeTLB) are taken from the pool reserved with /proc/sys/vm/nr_hugepages (or the equivalent for
+ * 1GB pages). If the pool is exhausted the arena falls back to transparent huge pages (madvise) and a warning is issued.
+ *
+ * The configuration syntax is (names are only given as an example):
+ *
+ * <pre>
+ *    +HugePageHeap = {
+ *        Class = HugePageHeap
+ *        Size = 67108864 //Compulsory. The size of the arena in bytes. It is rounded up to the page size.
+ *        HugePages = HugeTLB //Optional. HugeTLB (MAP_HUGETLB), Transparent (madvise) or None. Default = HugeTLB.
+ *        HugePageSize = 2097152 //Optional. The size of the huge pages for HugePages = HugeTLB (2097152 or 1073741824). Default = 2097152.
+ *        NUMANode = 0 //Optional but < 64. Default = -1 (first touch). The NUMA node where the arena is placed.
+ *        Lock = 1 //Optional. If 1 the arena is locked in memory (mlock). Default = 1.
+ *        Prefault = 1 //Optional. If 1 all the pages of the arena are faulted in at initialisation. Default = 1.
+ *    }
+ * </pre>
+ */
+class HugePageHeap: public Object, public HeapI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   FirstAddress() == 0 &&
+     *   LastAddress() == 0
+     */
+    HugePageHeap();
+
+    /**
+     * @brief Removes the heap from the HeapManager and unmaps the arena.
+     */
+    virtual ~HugePageHeap();
+
+    /**
+     * @brief Maps, prefaults, locks and binds the arena and registers the heap in the HeapManager.
+     * @details See the class description for the parameters.
+     * @return true if all the parameters are valid and the arena could be mapped and registered.
+     * A failure to lock or to bind the arena is only reported as a warning.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @see HeapI::Malloc
+     * @return a block aligned to HUGE_PAGE_HEAP_ALIGNMENT bytes or NULL if there is not enough free space on the arena.
+     */
+    virtual void *Malloc(const uint32 size);
+
+    /**
+     * @see HeapI::Free
+     */
+    virtual void Free(void *&data);
+
+    /**
+     * @see HeapI::Realloc
+     */
+    virtual void *Realloc(void *&data,
+                          const uint32 newSize);
+
+    /**
+     * @see HeapI::Duplicate
+     */
+    virtual void *Duplicate(const void * const data,
+                            const uint32 size = 0U);
+
+    /**
+     * @see HeapI::FirstAddress
+     */
+    virtual uintp FirstAddress() const;
+
+    /**
+     * @see HeapI::LastAddress
+     */
+    virtual uintp LastAddress() const;
+
+    /**
+     * @see HeapI::Name
+     * @return the name of the object.
+     */
+    virtual const char8 *Name() const;
+
+    /**
+     * @brief Gets the number of bytes which are currently free on the arena (including the block headers).
+     */
+    uint32 GetFreeSize();
+
+    /**
+     * @brief Returns true if the arena is backed by MAP_HUGETLB huge pages.
+     */
+    bool IsHugeTLB() const;
+
+private:
+
+    /**
+     * @brief The header which precedes each block of the arena.
+     */
+    struct BlockHeader {
+        /**
+         * The size of the block (including this header).
+         */
+        uint32 size;
+        /**
+         * true if the block is allocated.
+         */
+        bool used;
+    };
+
+    /**
+     * @brief Gets the size of the block header rounded up to HUGE_PAGE_HEAP_ALIGNMENT.
+     */
+    static uint32 HeaderSize();
+
+    /**
+     * @brief Gets the header of the block which holds \a data or NULL if \a data was not returned by Malloc.
+     */
+    BlockHeader *GetHeader(const void * const data) const;
+
+    /**
+     * The arena.
+     */
+    char8 *arena;
+
+    /**
+     * The size of the arena.
+     */
+    uint32 arenaSize;
+
+    /**
+     * True if the arena was mapped with MAP_HUGETLB.
+     */
+    bool hugeTLB;
+
+    /**
+     * True if the heap was registered in the HeapManager.
+     */
+    bool registered;
+
+    /**
+     * Protects the list of blocks.
+     */
+    FastPollingMutexSem mux;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* HUGEPAGEHEAP_H_ */
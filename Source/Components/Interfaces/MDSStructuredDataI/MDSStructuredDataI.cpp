@@ -38,6 +38,55 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * The initial number of entries of the node and path caches.
+ */
+const MARTe::uint32 MDS_STRUCTURED_DATA_I_INITIAL_CACHE_SIZE = 64u;
+
+/**
+ * @brief Checks if the MDSplus dtype stores its values exactly as the MARTe type \a marteType.
+ */
+bool IsNativeType(const MARTe::char8 dtype,
+                  const MARTe::TypeDescriptor &marteType) {
+    using namespace MARTe;
+    bool ret = false;
+    if (dtype == static_cast<char8>(DTYPE_BU)) {
+        ret = (marteType == UnsignedInteger8Bit);
+    }
+    else if (dtype == static_cast<char8>(DTYPE_B)) {
+        ret = (marteType == SignedInteger8Bit);
+    }
+    else if (dtype == static_cast<char8>(DTYPE_WU)) {
+        ret = (marteType == UnsignedInteger16Bit);
+    }
+    else if (dtype == static_cast<char8>(DTYPE_W)) {
+        ret = (marteType == SignedInteger16Bit);
+    }
+    else if (dtype == static_cast<char8>(DTYPE_LU)) {
+        ret = (marteType == UnsignedInteger32Bit);
+    }
+    else if (dtype == static_cast<char8>(DTYPE_L)) {
+        ret = (marteType == SignedInteger32Bit);
+    }
+    else if (dtype == static_cast<char8>(DTYPE_QU)) {
+        ret = (marteType == UnsignedInteger64Bit);
+    }
+    else if (dtype == static_cast<char8>(DTYPE_Q)) {
+        ret = (marteType == SignedInteger64Bit);
+    }
+    else if (dtype == static_cast<char8>(DTYPE_FS)) {
+        ret = (marteType == Float32Bit);
+    }
+    else if (dtype == static_cast<char8>(DTYPE_FT)) {
+        ret = (marteType == Float64Bit);
+    }
+    else {
+        ret = false;
+    }
+    return ret;
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -52,6 +101,17 @@ MDSStructuredDataI::MDSStructuredDataI() :
     editModeSet = false;
     internallyCreated = false;
     isOpen = false;
+    rootEntry = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
+    currentEntry = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
+    nodes = NULL_PTR(MDSStructuredDataINode *);
+    numberOfNodes = 0u;
+    nodesCapacity = 0u;
+    nidEntries = NULL_PTR(uint32 *);
+    numberOfNids = 0u;
+    paths = NULL_PTR(MDSStructuredDataIPath *);
+    numberOfPaths = 0u;
+    pathsCapacity = 0u;
+    firstAbsolutePath = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
 }
 
 //lint -e{1551} Function may throw exception --> The exceptions are not managed
@@ -61,6 +121,7 @@ MDSStructuredDataI::~MDSStructuredDataI() {
     if (IsOpen()) {
         CloseTree();
     }
+    ClearCache(false);
 }
 
 bool MDSStructuredDataI::Read(const char8* const name,
@@ -74,7 +135,7 @@ bool MDSStructuredDataI::Read(const char8* const name,
         //lint -e{613} Possible use of null pointer 'MARTe::MDSStructuredDataI::rootNode' in left argument to operator '->'--> rootNode is not NULL because IsOpen() ensure that
         //the pointer is not NULL.
         try {
-            node = currentNode->getNode(name);
+            node = nodes[ResolvePath(name, false)].node;
         }
         catch (const MDSplus::MdsException &exc) {
             node = NULL_PTR(MDSplus::TreeNode *);
@@ -89,7 +150,39 @@ bool MDSStructuredDataI::Read(const char8* const name,
         TypeDescriptor marteType = value.GetTypeDescriptor();
         void *data = NULL_PTR(void *);
         int32 numberOfElements = 0;
-        if (marteType == UnsignedInteger8Bit) {
+        //Numeric nodes of the same type are copied straight from the node values, without converting them into a new array
+        char8 clazz = '\0';
+        char8 dtype = '\0';
+        int16 length = 0;
+        char8 nDims = '\0';
+        int32 *dims = NULL_PTR(int32 *);
+        bool native = false;
+        try {
+            dataD->getInfo(&clazz, &dtype, &length, &nDims, &dims, &data);
+            native = IsNativeType(dtype, marteType);
+        }
+        //lint -e{715} Symbol 'exc' not referenced --> only used to catch the exception. The values are converted below.
+        catch (const MDSplus::MdsException &exc) {
+            native = false;
+        }
+        if (native) {
+            native = (data != NULL_PTR(void *)) && ((clazz == static_cast<char8>(CLASS_S)) || (clazz == static_cast<char8>(CLASS_A)));
+        }
+        if (native) {
+            numberOfElements = 1;
+            if ((clazz == static_cast<char8>(CLASS_A)) && (dims != NULL_PTR(int32 *))) {
+                for (int32 d = 0; d < static_cast<int32>(nDims); d++) {
+                    numberOfElements *= dims[d];
+                }
+            }
+        }
+        if (dims != NULL_PTR(int32 *)) {
+            delete[] dims;
+        }
+        if (native) {
+            //data points to the values stored in dataD
+        }
+        else if (marteType == UnsignedInteger8Bit) {
             data = dataD->getByteUnsignedArray(&numberOfElements);
         }
         else if (marteType == SignedInteger8Bit) {
@@ -169,9 +262,7 @@ bool MDSStructuredDataI::Write(const char8 * const name,
     MDSplus::TreeNode *node = NULL_PTR(MDSplus::TreeNode *);
     if (ok) {
         try {
-            //lint -e{613} Possible use of null pointer 'MARTe::MDSStructuredDataI::rootNode' in left argument to operator '->'--> currentNode is not NULL because IsOpen() ensure that
-            //the pointer is not NULL.
-            node = currentNode->getNode(name);
+            node = nodes[ResolvePath(name, false)].node;
         }
         //lint -e{715} Symbol 'exc' (line 190) not referenced [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12] --> only used to catch the exception
         catch (const MDSplus::MdsException &exc) {
@@ -183,6 +274,9 @@ bool MDSStructuredDataI::Write(const char8 * const name,
             //the pointer is not NULL.
             node = currentNode->addNode(name, "ANY");
             REPORT_ERROR(ErrorManagement::Debug, "going to create Node %s", name);
+            if (node != NULL_PTR(MDSplus::TreeNode *)) {
+                node = nodes[CacheNode(node)].node;
+            }
         }
     }
     if (ok) {
@@ -260,7 +354,7 @@ AnyType MDSStructuredDataI::GetType(const char8* const name) {
         //lint -e{613} Possible use of null pointer 'MARTe::MDSStructuredDataI::rootNode' in left argument to operator '->'--> currentNode is not NULL because IsOpen() ensure that
         //the pointer is not NULL.
         try {
-            node = currentNode->getNode(name);
+            node = nodes[ResolvePath(name, false)].node;
         }
         catch (const MDSplus::MdsException &exc) {
             REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Impossible to GetType: %s", exc.what());
@@ -404,7 +498,7 @@ bool MDSStructuredDataI::MoveToRoot() {
 //lint -e{613} Possible use of null pointer 'MARTe::MDSStructuredDataI::rootNode' in left argument to operator '->'--> rootNode is not NULL because IsOpen() ensure that
 //the pointer is not NULL.
     if (ret) {
-        currentNode = rootNode;
+        SetCurrentEntry(rootEntry);
     }
     return ret;
 }
@@ -415,6 +509,7 @@ bool MDSStructuredDataI::MoveToAncestor(const uint32 generations) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Error. Tree closed. Open it before calling MoveToAncestor");
     }
     MDSplus::TreeNode *node = NULL_PTR(MDSplus::TreeNode *);
+    uint32 entry = currentEntry;
 //lint -e{613} Possible use of null pointer 'MARTe::MDSStructuredDataI::currentNode' in left argument to operator '->'--> currentNode is not NULL because IsOpen() ensures that
 //the pointer is not NULL.
     if (ok) {
@@ -425,6 +520,10 @@ bool MDSStructuredDataI::MoveToAncestor(const uint32 generations) {
         while ((i < generations) && (node != NULL_PTR(MDSplus::TreeNode *))) {
             try {
                 node = node->getParent();
+                if (node != NULL_PTR(MDSplus::TreeNode *)) {
+                    entry = CacheNode(node);
+                    node = nodes[entry].node;
+                }
             }
             catch (const MDSplus::MdsException &exc) {
                 REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Impossible to move ancestor: %s", exc.what());
@@ -440,13 +539,13 @@ bool MDSStructuredDataI::MoveToAncestor(const uint32 generations) {
         }
     }
     if (ok) {
-        currentNode = node;
+        SetCurrentEntry(entry);
     }
     return ok;
 }
 
 bool MDSStructuredDataI::MoveAbsolute(const char8* const path) {
-    MDSplus::TreeNode *node = NULL_PTR(MDSplus::TreeNode *);
+    uint32 entry = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
     bool ok = IsOpen();
     if (!ok) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Error. Tree closed. Open it before calling MoveAbsolute.");
@@ -454,86 +553,56 @@ bool MDSStructuredDataI::MoveAbsolute(const char8* const path) {
 //lint -e{613} Possible use of null pointer 'MARTe::MDSStructuredDataI::tree' in left argument to operator '->' IsOpen guarantees that the node is not NULL
     if (ok) {
         try {
-            node = tree->getNode(path);
+            entry = ResolvePath(path, true);
         }
         catch (const MDSplus::MdsException &exc) {
             REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Impossible to move to %s: %s", path, exc.what());
-            node = NULL_PTR(MDSplus::TreeNode *);
             ok = false;
         }
     }
     if (ok) {
-        currentNode = node;
+        SetCurrentEntry(entry);
     }
     return ok;
 }
 
 bool MDSStructuredDataI::MoveRelative(const char8* const path) {
-    MDSplus::TreeNode *node = NULL_PTR(MDSplus::TreeNode *);
+    uint32 entry = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
     bool ok = IsOpen();
     if (!ok) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Error. Tree closed. Open it before calling MoveRelative");
     }
     if (ok) {
-        //lint -e{613} Possible use of null pointer 'MARTe::MDSStructuredDataI::currentNode' in left argument to operator '->'. IsOpen() ensures that the currentNode is not NULL
         try {
-            node = currentNode->getNode(path);
+            entry = ResolvePath(path, false);
         }
         catch (const MDSplus::MdsException &exc) {
             REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not move to %s: %s", path, exc.what());
-            node = NULL_PTR(MDSplus::TreeNode *);
             ok = false;
         }
     }
     if (ok) {
-        //lint -e{613} Possible use of null pointer 'MARTe::MDSStructuredDataI::node' --> It was previously check. if node == NULL ok = false
-        currentNode = node;
+        SetCurrentEntry(entry);
     }
     return ok;
 }
 
 bool MDSStructuredDataI::MoveToChild(const uint32 childIdx) {
-    MDSplus::TreeNode *node = NULL_PTR(MDSplus::TreeNode *);
     bool ok = IsOpen();
     if (!ok) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Error. Tree closed. Open it before calling MoveToChild()");
     }
-//lint -e{613} Possible use of null pointer 'MARTe::MDSStructuredDataI::tree' in left argument to operator '->' IsOpen() guarantees that the currentNode is not NULL
     if (ok) {
-        try {
-            node = currentNode->getChild();
-        }
-        catch (const MDSplus::MdsException &exc) {
-            node = NULL_PTR(MDSplus::TreeNode *);
-            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Impossible to get child %u: %s", childIdx, exc.what());
-            ok = false;
-        }
+        ok = LoadChildren();
     }
-    uint32 i = 0u;
     if (ok) {
-        ok = (childIdx < GetNumberOfChildren());
-        if (!ok) {
-            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Child node does not exist");
-        }
-    }
-    while ((i < childIdx) && (node != NULL_PTR(MDSplus::TreeNode *))) {
-        try {
-            node = node->getBrother();
-        }
-        catch (const MDSplus::MdsException &exc) {        //Never should happen
-            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Child node does not exist. System error %s", exc.what());
-            node = NULL_PTR(MDSplus::TreeNode *);
-        }
-        i++;
-    }
-    if (ok) {
-        ok = (node != NULL_PTR(MDSplus::TreeNode *));
+        ok = (childIdx < nodes[currentEntry].numberOfChildren);
         if (!ok) {
             REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Child node does not exist");
         }
     }
     if (ok) {
-        currentNode = node;
+        SetCurrentEntry(nodes[currentEntry].children[childIdx]);
     }
     return ok;
 }
@@ -549,13 +618,13 @@ bool MDSStructuredDataI::CreateAbsolute(const char8* const path) {
             REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Trying to modify tree but it is not open in edit mode");
         }
     }
-    MDSplus::TreeNode *auxNode = NULL_PTR(MDSplus::TreeNode *);
+    uint32 auxEntry = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
     if (ok) {
-        auxNode = currentNode;
-        currentNode = rootNode;
+        auxEntry = currentEntry;
+        SetCurrentEntry(rootEntry);
         ok = CreateNodes(path);
         if (!ok) {
-            currentNode = auxNode;
+            SetCurrentEntry(auxEntry);
         }
     }
     return ok;
@@ -592,6 +661,7 @@ bool MDSStructuredDataI::Delete(const char8* const name) {
             try {
                 //lint -e{613} Possible use of null pointer --> Not Possible because IsOpen() returns false if tree == NULL
                 currentNode->remove(name);
+                InvalidateCache();
             }
             catch (const MDSplus::MdsException &exc) {
                 REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Fail deleting node %s: %s", name, exc.what());
@@ -609,47 +679,25 @@ const char8* MDSStructuredDataI::GetName() {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Error. Tree is closed. Open it before calling GetName()");
     }
     if (ok) {
-        //lint -e{613} Possible use of null pointer --> Not possible because IsOpen() return false if currentNode = NULL
-        retChar = currentNode->getNodeName();
+        retChar = nodes[currentEntry].name.BufferReference();
     }
     return retChar;
 }
 
 const char8* MDSStructuredDataI::GetChildName(const uint32 index) {
     const char8* ret = NULL_PTR(const char8*);
-    MDSplus::TreeNode *node = NULL_PTR(MDSplus::TreeNode *);
     bool ok = IsOpen();
     if (!ok) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Error. Tree is closed. Open it before calling GetChildName()");
     }
     if (ok) {
-        //lint -e{613} Possible use of null pointer --> Not possible because IsOpen() checks that the pointer is not NULL
-        try {
-            node = currentNode->getChild();
-        }
-        catch (const MDSplus::MdsException &exc) {
-            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Error::%s", exc.what());
-            ok = false;
-        }
+        ok = LoadChildren();
     }
     if (ok) {
-        ok = (index < GetNumberOfChildren()); //If the index is too high for sure the node name doesn't exist
+        ok = (index < nodes[currentEntry].numberOfChildren); //If the index is too high for sure the node name doesn't exist
     }
-    uint32 i = 0u;
     if (ok) {
-        while ((i < index) && (node != NULL_PTR(MDSplus::TreeNode *))) {
-            try {
-                node = node->getBrother();
-            }
-            catch (const MDSplus::MdsException &exc) {
-                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "No more brothers to consume. Child not found::%s", exc.what());
-                node = NULL_PTR(MDSplus::TreeNode *);
-            }
-            i++;
-        }
-        if (node != NULL_PTR(MDSplus::TreeNode *)) {
-            ret = node->getNodeName();
-        }
+        ret = nodes[nodes[currentEntry].children[index]].name.Buffer();
     }
     return ret;
 }
@@ -662,13 +710,8 @@ uint32 MDSStructuredDataI::GetNumberOfChildren() {
         ret = 0u;
     }
     else {
-        //lint -e{613} Possible use of null pointer --> Not possible because IsOpen() checks that the pointer is not NULL
-        try {
-            ret = static_cast<uint32>(currentNode->getNumChildren());
-        }
-        catch (const MDSplus::MdsException &exc) {
-            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Error::%s", exc.what());
-            ret = 0u;
+        if (LoadChildren()) {
+            ret = nodes[currentEntry].numberOfChildren;
         }
     }
     return ret;
@@ -688,9 +731,16 @@ bool MDSStructuredDataI::SetTree(MDSplus::Tree * const treeIn) {
     if (ret) {
         tree = treeIn;
         rootNode = tree->getDefault();
-        currentNode = rootNode;
         editModeSet = tree->isOpenForEdit();
-        isOpen = true;
+        try {
+            rootEntry = CacheNode(rootNode);
+            SetCurrentEntry(rootEntry);
+        }
+        catch (const MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Invalid default node: %s", exc.what());
+            ret = false;
+        }
+        isOpen = ret;
     }
     return ret;
 }
@@ -742,9 +792,16 @@ bool MDSStructuredDataI::OpenTree(const char8 * const treeName,
     if (ok) {
         //lint -e{613} Possible use of null pointer 'MARTe::MDSStructuredDataI::tree' in left argument to operator '->' --> tree pointer check previously.
         rootNode = tree->getDefault();
-        currentNode = rootNode;
         internallyCreated = true;
-        isOpen = true;
+        try {
+            rootEntry = CacheNode(rootNode);
+            SetCurrentEntry(rootEntry);
+        }
+        catch (const MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Invalid default node: %s", exc.what());
+            ok = false;
+        }
+        isOpen = ok;
     }
     return ok;
 }
@@ -755,6 +812,9 @@ bool MDSStructuredDataI::CloseTree() {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Error closing the tree. Tree was not opened");
     }
     if (ret) {
+        //The node handles are only destroyed if the tree was opened internally (as it is done for the rootNode), given that a tree
+        //set with SetTree may already have been destroyed.
+        ClearCache(internallyCreated);
         if (internallyCreated) {
             delete tree;
         }
@@ -846,7 +906,7 @@ bool MDSStructuredDataI::CreateNodes(const MARTe::char8 * const path) {
     StreamString token;
     char8 c;
     bool created = false;
-    MDSplus::TreeNode *currentNodeOld = currentNode;
+    uint32 currentEntryOld = currentEntry;
 
     while ((pathStr.GetToken(token, ".", c)) && (ok)) {
         ok = (token.Size() > 0u);
@@ -881,7 +941,9 @@ bool MDSStructuredDataI::CreateNodes(const MARTe::char8 * const path) {
         ok = created;
     }
     if (!ok) {
-        currentNode = currentNodeOld;
+        if (currentEntryOld != MDS_STRUCTURED_DATA_I_INVALID_INDEX) {
+            SetCurrentEntry(currentEntryOld);
+        }
     }
     return ok;
 }
@@ -913,14 +975,246 @@ bool MDSStructuredDataI::AddChildToCurrentNode(const MARTe::char8 * const path)
     }
     if (ok) {
         ok = (node != NULL_PTR(MDSplus::TreeNode *));
-        if (ok) {
-            currentNode = node;
+    }
+    if (ok) {
+        //The children of the parent are loaded again the next time that they are queried
+        MDSStructuredDataINode &parent = nodes[currentEntry];
+        if (parent.children != NULL_PTR(uint32 *)) {
+            delete[] parent.children;
+        }
+        parent.children = NULL_PTR(uint32 *);
+        parent.numberOfChildren = 0u;
+        parent.childrenLoaded = false;
+        try {
+            SetCurrentEntry(CacheNode(node));
+        }
+        catch (const MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Fail to cache node %s: %s", path, exc.what());
+            ok = false;
+        }
+    }
+
+    return ok;
+}
+
+uint32 MDSStructuredDataI::CacheNode(MDSplus::TreeNode * const node) {
+    uint32 nid = static_cast<uint32>(node->getNid());
+    uint32 entry = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
+    if (nid < numberOfNids) {
+        entry = nidEntries[nid];
+    }
+    if (entry != MDS_STRUCTURED_DATA_I_INVALID_INDEX) {
+        if (nodes[entry].node != node) {
+            delete node;
+        }
+    }
+    else {
+        char8 *nodeName = node->getNodeName();
+        if (nid >= numberOfNids) {
+            uint32 newNumberOfNids = (numberOfNids > 0u) ? (2u * numberOfNids) : MDS_STRUCTURED_DATA_I_INITIAL_CACHE_SIZE;
+            if (newNumberOfNids <= nid) {
+                newNumberOfNids = nid + 1u;
+            }
+            uint32 *newNidEntries = new uint32[newNumberOfNids];
+            uint32 n;
+            for (n = 0u; n < newNumberOfNids; n++) {
+                newNidEntries[n] = (n < numberOfNids) ? (nidEntries[n]) : (MDS_STRUCTURED_DATA_I_INVALID_INDEX);
+            }
+            if (nidEntries != NULL_PTR(uint32 *)) {
+                delete[] nidEntries;
+            }
+            nidEntries = newNidEntries;
+            numberOfNids = newNumberOfNids;
+        }
+        if (numberOfNodes == nodesCapacity) {
+            uint32 newCapacity = (nodesCapacity > 0u) ? (2u * nodesCapacity) : MDS_STRUCTURED_DATA_I_INITIAL_CACHE_SIZE;
+            MDSStructuredDataINode *newNodes = new MDSStructuredDataINode[newCapacity];
+            uint32 n;
+            for (n = 0u; n < numberOfNodes; n++) {
+                newNodes[n].node = nodes[n].node;
+                newNodes[n].nid = nodes[n].nid;
+                newNodes[n].name = nodes[n].name;
+                newNodes[n].children = nodes[n].children;
+                newNodes[n].numberOfChildren = nodes[n].numberOfChildren;
+                newNodes[n].childrenLoaded = nodes[n].childrenLoaded;
+                newNodes[n].firstPath = nodes[n].firstPath;
+            }
+            if (nodes != NULL_PTR(MDSStructuredDataINode *)) {
+                delete[] nodes;
+            }
+            nodes = newNodes;
+            nodesCapacity = newCapacity;
+        }
+        entry = numberOfNodes;
+        numberOfNodes++;
+        nodes[entry].node = node;
+        nodes[entry].nid = nid;
+        nodes[entry].name = nodeName;
+        nodes[entry].children = NULL_PTR(uint32 *);
+        nodes[entry].numberOfChildren = 0u;
+        nodes[entry].childrenLoaded = false;
+        nodes[entry].firstPath = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
+        nidEntries[nid] = entry;
+        MDSplus::deleteNativeArray(nodeName);
+    }
+    return entry;
+}
+
+uint32 MDSStructuredDataI::ResolvePath(const char8 * const path,
+                                       const bool absolute) {
+    uint32 head = absolute ? (firstAbsolutePath) : (nodes[currentEntry].firstPath);
+    uint32 p = head;
+    uint32 entry = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
+    while ((p != MDS_STRUCTURED_DATA_I_INVALID_INDEX) && (entry == MDS_STRUCTURED_DATA_I_INVALID_INDEX)) {
+        if (paths[p].path == path) {
+            entry = paths[p].node;
+        }
+        else {
+            p = paths[p].next;
+        }
+    }
+    if (entry == MDS_STRUCTURED_DATA_I_INVALID_INDEX) {
+        //lint -e{613} Possible use of null pointer --> Not possible because the callers check IsOpen()
+        MDSplus::TreeNode *node = absolute ? (tree->getNode(path)) : (currentNode->getNode(path));
+        uint32 baseEntry = currentEntry;
+        entry = CacheNode(node);
+        if (numberOfPaths == pathsCapacity) {
+            uint32 newCapacity = (pathsCapacity > 0u) ? (2u * pathsCapacity) : MDS_STRUCTURED_DATA_I_INITIAL_CACHE_SIZE;
+            MDSStructuredDataIPath *newPaths = new MDSStructuredDataIPath[newCapacity];
+            uint32 n;
+            for (n = 0u; n < numberOfPaths; n++) {
+                newPaths[n].path = paths[n].path;
+                newPaths[n].node = paths[n].node;
+                newPaths[n].next = paths[n].next;
+            }
+            if (paths != NULL_PTR(MDSStructuredDataIPath *)) {
+                delete[] paths;
+            }
+            paths = newPaths;
+            pathsCapacity = newCapacity;
+        }
+        p = numberOfPaths;
+        numberOfPaths++;
+        paths[p].path = path;
+        paths[p].node = entry;
+        paths[p].next = head;
+        if (absolute) {
+            firstAbsolutePath = p;
+        }
+        else {
+            nodes[baseEntry].firstPath = p;
         }
     }
+    return entry;
+}
 
+bool MDSStructuredDataI::LoadChildren() {
+    bool ok = true;
+    if (!nodes[currentEntry].childrenLoaded) {
+        int32 numberOfChildren = 0;
+        MDSplus::TreeNode **children = NULL_PTR(MDSplus::TreeNode **);
+        uint32 *childEntries = NULL_PTR(uint32 *);
+        int32 c = 0;
+        try {
+            //lint -e{613} Possible use of null pointer --> Not possible because the callers check IsOpen()
+            children = currentNode->getChildren(&numberOfChildren);
+            if (numberOfChildren > 0) {
+                childEntries = new uint32[numberOfChildren];
+            }
+            for (c = 0; c < numberOfChildren; c++) {
+                childEntries[c] = CacheNode(children[c]);
+            }
+        }
+        catch (const MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Error::%s", exc.what());
+            ok = false;
+        }
+        if (children != NULL_PTR(MDSplus::TreeNode **)) {
+            if (!ok) {
+                //The handles that were not cached are still owned by the array
+                for (int32 d = c; d < numberOfChildren; d++) {
+                    delete children[d];
+                }
+            }
+            delete[] children;
+        }
+        if (ok) {
+            nodes[currentEntry].children = childEntries;
+            nodes[currentEntry].numberOfChildren = static_cast<uint32>(numberOfChildren);
+            nodes[currentEntry].childrenLoaded = true;
+        }
+        else if (childEntries != NULL_PTR(uint32 *)) {
+            delete[] childEntries;
+        }
+        else {
+            //NOOP
+        }
+    }
     return ok;
 }
 
+void MDSStructuredDataI::SetCurrentEntry(const uint32 entry) {
+    currentEntry = entry;
+    currentNode = nodes[entry].node;
+}
+
+void MDSStructuredDataI::InvalidateCache() {
+    uint32 n;
+    for (n = 0u; n < numberOfNodes; n++) {
+        if (nodes[n].children != NULL_PTR(uint32 *)) {
+            delete[] nodes[n].children;
+        }
+        nodes[n].children = NULL_PTR(uint32 *);
+        nodes[n].numberOfChildren = 0u;
+        nodes[n].childrenLoaded = false;
+        nodes[n].firstPath = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
+    }
+    for (n = 0u; n < numberOfNids; n++) {
+        nidEntries[n] = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
+    }
+    //The identifiers of the removed nodes may be reused by new nodes
+    if (rootEntry != MDS_STRUCTURED_DATA_I_INVALID_INDEX) {
+        nidEntries[nodes[rootEntry].nid] = rootEntry;
+    }
+    if (currentEntry != MDS_STRUCTURED_DATA_I_INVALID_INDEX) {
+        nidEntries[nodes[currentEntry].nid] = currentEntry;
+    }
+    numberOfPaths = 0u;
+    firstAbsolutePath = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
+}
+
+void MDSStructuredDataI::ClearCache(const bool deleteNodes) {
+    uint32 n;
+    for (n = 0u; n < numberOfNodes; n++) {
+        if (deleteNodes && (nodes[n].node != rootNode)) {
+            delete nodes[n].node;
+        }
+        if (nodes[n].children != NULL_PTR(uint32 *)) {
+            delete[] nodes[n].children;
+        }
+    }
+    if (nodes != NULL_PTR(MDSStructuredDataINode *)) {
+        delete[] nodes;
+    }
+    if (nidEntries != NULL_PTR(uint32 *)) {
+        delete[] nidEntries;
+    }
+    if (paths != NULL_PTR(MDSStructuredDataIPath *)) {
+        delete[] paths;
+    }
+    nodes = NULL_PTR(MDSStructuredDataINode *);
+    numberOfNodes = 0u;
+    nodesCapacity = 0u;
+    nidEntries = NULL_PTR(uint32 *);
+    numberOfNids = 0u;
+    paths = NULL_PTR(MDSStructuredDataIPath *);
+    numberOfPaths = 0u;
+    pathsCapacity = 0u;
+    firstAbsolutePath = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
+    rootEntry = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
+    currentEntry = MDS_STRUCTURED_DATA_I_INVALID_INDEX;
+}
+
 CLASS_REGISTER(MDSStructuredDataI, "1.0")
 }
 
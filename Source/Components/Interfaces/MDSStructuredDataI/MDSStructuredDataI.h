@@ -35,18 +35,91 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "Object.h"
+#include "StreamString.h"
 #include "StructuredDataI.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+
+/**
+ * Marks an empty index in the node and path caches of the MDSStructuredDataI.
+ */
+const uint32 MDS_STRUCTURED_DATA_I_INVALID_INDEX = 0xFFFFFFFFu;
+
+/**
+ * @brief A node handle cached by the MDSStructuredDataI.
+ */
+struct MDSStructuredDataINode {
+    /**
+     * The MDSplus node handle.
+     */
+    MDSplus::TreeNode *node;
+
+    /**
+     * The node identifier.
+     */
+    uint32 nid;
+
+    /**
+     * The node name.
+     */
+    StreamString name;
+
+    /**
+     * The cache indices of the children (only valid if childrenLoaded).
+     */
+    uint32 *children;
+
+    /**
+     * The number of children (only valid if childrenLoaded).
+     */
+    uint32 numberOfChildren;
+
+    /**
+     * True if the children were already loaded from the tree.
+     */
+    bool childrenLoaded;
+
+    /**
+     * The first path (in the path cache) resolved relative to this node.
+     */
+    uint32 firstPath;
+};
+
+/**
+ * @brief A path resolved by the MDSStructuredDataI.
+ */
+struct MDSStructuredDataIPath {
+    /**
+     * The path as given to the StructuredDataI method.
+     */
+    StreamString path;
+
+    /**
+     * The cache index of the node which the path resolves to.
+     */
+    uint32 node;
+
+    /**
+     * The next path resolved from the same node.
+     */
+    uint32 next;
+};
+
 /**
  * @brief Wraps an MDSplus tree as a StructuredDataI.
  * @details Read/Write of string arrays is not supported.
  *
  * @details Operations in the StructuredDataI require the tree to be in a valid state.
  * See: SetTree, SetEditMode, OpenTree, CreateTree and SaveTree.
+ *
+ * @details The node handles are cached (by node identifier) while the tree is open and each path is resolved against the tree
+ * only the first time it is used from a given node (MoveRelative, MoveAbsolute, Read, Write and GetType).
+ * The children of a node are loaded the first time that they are queried (GetNumberOfChildren, GetChildName and MoveToChild).
+ * The caches are updated when the structure is edited (CreateAbsolute, CreateRelative and Delete) and are released by CloseTree.
+ * Read of numeric nodes whose type matches the destination type copies the node values straight into the destination memory.
  */
 class MDSStructuredDataI: public Object, public StructuredDataI {
 public:
@@ -344,6 +417,61 @@ private:
      */
     MDSplus::TreeNode *currentNode;
 
+    /**
+     * The cache index of the root node.
+     */
+    uint32 rootEntry;
+
+    /**
+     * The cache index of the current node.
+     */
+    uint32 currentEntry;
+
+    /**
+     * The cached node handles.
+     */
+    MDSStructuredDataINode *nodes;
+
+    /**
+     * The number of cached node handles.
+     */
+    uint32 numberOfNodes;
+
+    /**
+     * The number of node handles that can be stored in nodes.
+     */
+    uint32 nodesCapacity;
+
+    /**
+     * The cache index of each node identifier (MDS_STRUCTURED_DATA_I_INVALID_INDEX if not cached).
+     */
+    uint32 *nidEntries;
+
+    /**
+     * The number of elements of nidEntries.
+     */
+    uint32 numberOfNids;
+
+    /**
+     * The resolved paths.
+     */
+    MDSStructuredDataIPath *paths;
+
+    /**
+     * The number of resolved paths.
+     */
+    uint32 numberOfPaths;
+
+    /**
+     * The number of paths that can be stored in paths.
+     */
+    uint32 pathsCapacity;
+
+    /**
+     * The first resolved absolute path.
+     */
+    uint32 firstAbsolutePath;
+
     /**
      * True if the tree can be edited.
      */
@@ -379,6 +507,51 @@ private:
      * @return true if the node is added.
      */
     bool AddChildToCurrentNode(const MARTe::char8 * const path);
+
+    /**
+     * @brief Adds a node handle to the cache.
+     * @details If a handle to the same node is already cached, \a node is destroyed and the cached handle is used instead.
+     * @param[in] node the node handle. The cache takes its ownership.
+     * @return the cache index of the node.
+     * @throw MDSplus::MdsException if the node identifier or name cannot be queried.
+     */
+    uint32 CacheNode(MDSplus::TreeNode * const node);
+
+    /**
+     * @brief Resolves a path from the current node (or from the top of the tree if \a absolute is true).
+     * @details The path is only resolved against the tree the first time it is used from a given node.
+     * @param[in] path the path to resolve.
+     * @param[in] absolute true if the path is absolute.
+     * @return the cache index of the node.
+     * @throw MDSplus::MdsException if the node does not exist.
+     */
+    uint32 ResolvePath(const char8 * const path,
+                       const bool absolute);
+
+    /**
+     * @brief Loads the children of the current node, if they were not loaded yet.
+     * @return true if the children are loaded.
+     */
+    bool LoadChildren();
+
+    /**
+     * @brief Sets the current node.
+     * @param[in] entry the cache index of the new current node.
+     */
+    void SetCurrentEntry(const uint32 entry);
+
+    /**
+     * @brief Forgets the resolved paths, the loaded children and the node identifier map.
+     * @details The node handles are kept (as they may still be referenced by the current node) and only the
+     * root node and the current node are mapped again.
+     */
+    void InvalidateCache();
+
+    /**
+     * @brief Frees all the caches.
+     * @param[in] deleteNodes if true the cached node handles are destroyed.
+     */
+    void ClearCache(const bool deleteNodes);
 };
 }
 
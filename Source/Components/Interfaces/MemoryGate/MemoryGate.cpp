@@ -24,15 +24,40 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/statfs.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "MemoryGate.h"
+#include "Sleep.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Written by the creator in MemoryGateSharedHeader::magic once the header is initialised.
+ */
+const MARTe::int32 MEMORY_GATE_SHARED_MAGIC = 0x4D474154;
+
+/**
+ * The buffers start at this alignment after the header.
+ */
+const MARTe::uint64 MEMORY_GATE_SHARED_ALIGNMENT = 64u;
+
+/**
+ * Number of 10 ms polls waiting for the creator to size and initialise the segment.
+ */
+const MARTe::uint32 MEMORY_GATE_SHARED_ATTACH_POLLS = 100u;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -41,69 +66,115 @@
 namespace MARTe {
 
 MemoryGate::MemoryGate() :
-        ReferenceContainer(),
-        resetTimeout() {
+        ReferenceContainer() {
     mem = NULL_PTR(uint8*);
     memSize = 0u;
     numberOfBuffers = 2u;
     offsetStore = 0u;
     spinlocksRead = NULL_PTR(volatile int32 *);
-    spinlocksWrite = NULL_PTR(FastPollingMutexSem *);
-    whatIsNewestCounter = NULL_PTR(uint32 *);
-    whatIsNewestGlobCounter = 0u;
+    writeLocks = NULL_PTR(volatile int32 *);
+    writeOwners = NULL_PTR(volatile int32 *);
+    localNewestBuffer = 1;
+    newestBuffer = &localNewestBuffer;
+    numberOfProcesses = 1u;
+    processIdx = 0u;
+    sharedHeader = NULL_PTR(MemoryGateSharedHeader *);
+    sharedMemorySize = 0u;
 }
 
 MemoryGate::~MemoryGate() {
-    if (mem != NULL_PTR(uint8*)) {
-        delete[] mem;
-    }
-
-    if (spinlocksRead != NULL_PTR(volatile int32 *)) {
-        delete[] spinlocksRead;
-        spinlocksRead = NULL_PTR(volatile int32 *);
+    if (sharedHeader != NULL_PTR(MemoryGateSharedHeader *)) {
+        for (uint32 i = 0u; i < numberOfBuffers; i++) {
+            sharedHeader->readers[(processIdx * numberOfBuffers) + i] = 0;
+        }
+        sharedHeader->pids[processIdx] = 0;
+        sharedHeader->processes[processIdx] = 0;
+        /*lint -e{534} nothing to do if the segment cannot be unmapped.*/
+        munmap(sharedHeader, static_cast<size_t>(sharedMemorySize));
+        sharedHeader = NULL_PTR(MemoryGateSharedHeader *);
     }
-    if (spinlocksWrite != NULL_PTR(FastPollingMutexSem *)) {
-        delete[] spinlocksWrite;
-        spinlocksWrite = NULL_PTR(FastPollingMutexSem *);
+    else {
+        if (mem != NULL_PTR(uint8*)) {
+            delete[] mem;
+        }
 
+        if (spinlocksRead != NULL_PTR(volatile int32 *)) {
+            delete[] spinlocksRead;
+        }
+        if (writeLocks != NULL_PTR(volatile int32 *)) {
+            delete[] writeLocks;
+        }
     }
-    if (whatIsNewestCounter != NULL_PTR(uint32 *)) {
-        delete[] whatIsNewestCounter;
-        whatIsNewestCounter = NULL_PTR(uint32 *);
-    }
+    mem = NULL_PTR(uint8*);
+    spinlocksRead = NULL_PTR(volatile int32 *);
+    writeLocks = NULL_PTR(volatile int32 *);
+    writeOwners = NULL_PTR(volatile int32 *);
 }
 
 bool MemoryGate::Initialise(StructuredDataI &data) {
     bool ret = ReferenceContainer::Initialise(data);
     if (ret) {
+        uint32 numberOfReaders = 0u;
+        uint32 numberOfWriters = 1u;
+        bool readersSet = data.Read("NumberOfReaders", numberOfReaders);
+        if (!data.Read("NumberOfWriters", numberOfWriters)) {
+            numberOfWriters = 1u;
+        }
+        //Each reader and each writer holds at most one buffer which is not the newest one
+        uint32 minNumberOfBuffers = ((numberOfReaders + numberOfWriters) + 1u);
         if (!data.Read("NumberOfBuffers", numberOfBuffers)) {
-            numberOfBuffers = 2u;
+            if (readersSet) {
+                numberOfBuffers = minNumberOfBuffers;
+            }
+            else {
+                numberOfBuffers = 2u;
+            }
+        }
+        else {
+            if ((readersSet) && (numberOfBuffers < minNumberOfBuffers)) {
+                REPORT_ERROR(ErrorManagement::Warning, "NumberOfBuffers (%d) < NumberOfReaders + NumberOfWriters + 1 (%d): MemoryWrite may find all the buffers busy",
+                             numberOfBuffers, minNumberOfBuffers);
+            }
         }
 
-        ret = (numberOfBuffers <= 64u) && (numberOfBuffers > 0u);
+        ret = (numberOfBuffers <= MEMORY_GATE_MAX_BUFFERS) && (numberOfBuffers > 0u);
         if (!ret) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "The maximum allowed numberOfBuffers is 64");
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The maximum allowed numberOfBuffers is %d", MEMORY_GATE_MAX_BUFFERS);
         }
 
         if (ret) {
+            if (!data.Read("SharedMemoryName", sharedMemoryName)) {
+                sharedMemoryName = "";
+            }
+            if (!data.Read("HugePagesDirectory", hugePagesDirectory)) {
+                hugePagesDirectory = "";
+            }
+            if (sharedMemoryName.Size() > 0u) {
+                ret = (sharedMemoryName[0u] == '/');
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The SharedMemoryName %s shall start with /", sharedMemoryName.Buffer());
+                }
+            }
+            else {
+                ret = (hugePagesDirectory.Size() == 0u);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "HugePagesDirectory requires a SharedMemoryName");
+                }
+            }
+        }
+
+        //The control words of a shared MemoryGate are in the shared memory segment
+        if ((ret) && (sharedMemoryName.Size() == 0u)) {
             if (spinlocksRead == NULL) {
                 uint32 index = (numberOfBuffers);
                 spinlocksRead = new volatile int32[index];
                 ret = (spinlocksRead != NULL_PTR(volatile int32 *));
             }
             if (ret) {
-                if (spinlocksWrite == NULL) {
+                if (writeLocks == NULL) {
                     uint32 index = (numberOfBuffers);
-                    spinlocksWrite = new FastPollingMutexSem[index];
-                    ret = (spinlocksWrite != NULL_PTR(FastPollingMutexSem *));
-                }
-            }
-            if (ret) {
-
-                if (whatIsNewestCounter == NULL) {
-                    uint32 index = (numberOfBuffers);
-                    whatIsNewestCounter = new uint32[index];
-                    ret = (whatIsNewestCounter != NULL_PTR(uint32 *));
+                    writeLocks = new volatile int32[index];
+                    ret = (writeLocks != NULL_PTR(volatile int32 *));
                 }
             }
 
@@ -112,26 +183,21 @@ bool MemoryGate::Initialise(StructuredDataI &data) {
                     /*lint -e{613} NULL pointer checked.*/
                     spinlocksRead[i] = 0;
                     /*lint -e{613} NULL pointer checked.*/
-                    spinlocksWrite[i].Create(false);
-                    /*lint -e{613} NULL pointer checked.*/
-                    whatIsNewestCounter[i] = 0u;
+                    writeLocks[i] = 0;
                 }
+                //The first write goes to the buffer 0
+                localNewestBuffer = static_cast<int32>(numberOfBuffers - 1u);
             }
         }
 
         if (ret) {
             uint32 resetTimeoutT;
-            if (!data.Read("ResetMSecTimeout", resetTimeoutT)) {
-                resetTimeout = TTInfiniteWait;
-            }
-            else {
-                resetTimeout = resetTimeoutT;
+            if (data.Read("ResetMSecTimeout", resetTimeoutT)) {
+                REPORT_ERROR(ErrorManagement::Information, "ResetMSecTimeout is no longer needed and will be ignored");
             }
 
             if (data.Read("MemorySize", memSize)) {
-                uint32 totMemSize = (memSize * numberOfBuffers);
-                mem = new uint8[totMemSize];
-                ret = MemoryOperationsHelper::Set(mem, '\0', memSize);
+                ret = AllocateBuffers();
             }
             else {
                 memSize = 0u;
@@ -148,10 +214,7 @@ bool MemoryGate::SetMemorySize(uint32 size) {
     bool ret = true;
     if (mem == NULL) {
         memSize = size;
-        uint32 totMemSize = (memSize * numberOfBuffers);
-        mem = new uint8[totMemSize];
-
-        ret = MemoryOperationsHelper::Set(mem, '\0', memSize);
+        ret = AllocateBuffers();
     }
     else {
         ret = (memSize == size);
@@ -163,141 +226,301 @@ bool MemoryGate::SetMemorySize(uint32 size) {
     return ret;
 }
 
-bool MemoryGate::MemoryRead(uint8 * const bufferToFill) {
-    //get input offset
-    bool ok = false;
-    uint64 checkedMask = 0ull;
-    uint32 bufferIdx = 0u;
+bool MemoryGate::AllocateBuffers() {
+    bool ret;
+    if (sharedMemoryName.Size() > 0u) {
+        ret = MapSharedMemory();
+    }
+    else {
+        uint32 totMemSize = (memSize * numberOfBuffers);
+        mem = new uint8[totMemSize];
+        ret = MemoryOperationsHelper::Set(mem, '\0', totMemSize);
+    }
+    return ret;
+}
 
-    for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
-        //check the last written
-        bufferIdx = 0u;
-        uint32 max = 0u;
-        for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-            /*lint -e{613} NULL pointer checked.*/
-            if (spinlocksWrite[h].FastTryLock()) {
-                /*lint -e{613} NULL pointer checked.*/
-                uint32 tempMax = whatIsNewestCounter[h];
-                /*lint -e{613} NULL pointer checked.*/
-                spinlocksWrite[h].FastUnLock();
-                if ((tempMax >= max) && (((1ull << h) & checkedMask) == 0u)) {
-                    max = tempMax;
-                    bufferIdx = h;
+bool MemoryGate::MapSharedMemory() {
+    uint64 headerSize = static_cast<uint64>(sizeof(MemoryGateSharedHeader));
+    headerSize = (((headerSize + MEMORY_GATE_SHARED_ALIGNMENT) - 1u) / MEMORY_GATE_SHARED_ALIGNMENT) * MEMORY_GATE_SHARED_ALIGNMENT;
+    uint64 segmentSize = headerSize + (static_cast<uint64>(memSize) * numberOfBuffers);
+    bool created = false;
+    int32 fd;
+    StreamString path;
+    if (hugePagesDirectory.Size() > 0u) {
+        //The leading / of the name is the separator
+        bool ok = path.Printf("%s%s", hugePagesDirectory.Buffer(), sharedMemoryName.Buffer());
+        if (ok) {
+            fd = open(path.Buffer(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+            created = (fd >= 0);
+            if ((!created) && (errno == EEXIST)) {
+                fd = open(path.Buffer(), O_RDWR);
+            }
+        }
+        else {
+            fd = -1;
+        }
+        if (fd >= 0) {
+            struct statfs fsInfo;
+            if (fstatfs(fd, &fsInfo) == 0) {
+                uint64 hugePageSize = static_cast<uint64>(fsInfo.f_bsize);
+                segmentSize = (((segmentSize + hugePageSize) - 1u) / hugePageSize) * hugePageSize;
+            }
+        }
+    }
+    else {
+        path = sharedMemoryName;
+        fd = shm_open(path.Buffer(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+        created = (fd >= 0);
+        if ((!created) && (errno == EEXIST)) {
+            fd = shm_open(path.Buffer(), O_RDWR, 0);
+        }
+    }
+    bool ret = (fd >= 0);
+    if (!ret) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to open the shared memory %s", path.Buffer());
+    }
+    if (ret) {
+        if (created) {
+            ret = (ftruncate(fd, static_cast<off_t>(segmentSize)) == 0);
+        }
+        else {
+            //Wait for the creator to size the segment
+            ret = false;
+            for (uint32 n = 0u; (n < MEMORY_GATE_SHARED_ATTACH_POLLS) && (!ret); n++) {
+                struct stat fileInfo;
+                if (fstat(fd, &fileInfo) == 0) {
+                    ret = (static_cast<uint64>(fileInfo.st_size) >= segmentSize);
+                }
+                if (!ret) {
+                    Sleep::MSec(10u);
                 }
             }
         }
-
-        checkedMask |= (1ull << bufferIdx);
-        ok = false;
-        //try to lock the next buffer to write
-        /*lint -e{613} NULL pointer checked.*/
-        if (spinlocksWrite[bufferIdx].FastTryLock()) {
-            /*lint -e{613} NULL pointer checked.*/
-            Atomic::Increment(&spinlocksRead[bufferIdx]);
-            /*lint -e{613} NULL pointer checked.*/
-            spinlocksWrite[bufferIdx].FastUnLock();
-            ok = true;
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "The shared memory %s does not have the expected size (%d buffers of %d bytes)", path.Buffer(), numberOfBuffers, memSize);
         }
     }
-    //copy the memory to the data source buffer
-    if (ok) {
-        uint32 offset = (memSize * bufferIdx);
-        /*lint -e{613} NULL pointer checked.*/
-        ok = MemoryOperationsHelper::Copy(bufferToFill, &mem[offset], memSize);
+    if (ret) {
+        void *segment = mmap(NULL_PTR(void *), static_cast<size_t>(segmentSize), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        /*lint -e{923} MAP_FAILED is defined by the system.*/
+        ret = (segment != MAP_FAILED);
+        if (ret) {
+            sharedHeader = static_cast<MemoryGateSharedHeader *>(segment);
+            sharedMemorySize = segmentSize;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to map the shared memory %s", path.Buffer());
+        }
     }
-
-    if (ok) {
-        /*lint -e{613} NULL pointer checked.*/
-        Atomic::Decrement(&spinlocksRead[bufferIdx]);
-        //REPORT_ERROR(ErrorManagement::Information, "buffer read=%d", bufferIdx);
-
+    if (fd >= 0) {
+        (void) close(fd);
+    }
+    if (ret) {
+        if (created) {
+            //The segment is zeroed by ftruncate
+            sharedHeader->numberOfBuffers = numberOfBuffers;
+            sharedHeader->memSize = memSize;
+            //The first write goes to the buffer 0
+            sharedHeader->newestBuffer = static_cast<int32>(numberOfBuffers - 1u);
+            (void) Atomic::Exchange(&sharedHeader->magic, MEMORY_GATE_SHARED_MAGIC);
+        }
+        else {
+            ret = false;
+            for (uint32 n = 0u; (n < MEMORY_GATE_SHARED_ATTACH_POLLS) && (!ret); n++) {
+                ret = (sharedHeader->magic == MEMORY_GATE_SHARED_MAGIC);
+                if (!ret) {
+                    Sleep::MSec(10u);
+                }
+            }
+            if (ret) {
+                ret = ((sharedHeader->numberOfBuffers == numberOfBuffers) && (sharedHeader->memSize == memSize));
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "The shared memory %s was created with %d buffers of %d bytes (expected %d buffers of %d bytes)",
+                                 path.Buffer(), sharedHeader->numberOfBuffers, sharedHeader->memSize, numberOfBuffers, memSize);
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::FatalError, "The shared memory %s was not initialised by its creator", path.Buffer());
+            }
+        }
     }
+    if (ret) {
+        spinlocksRead = &sharedHeader->readers[0];
+        writeLocks = &sharedHeader->writeLocks[0];
+        writeOwners = &sharedHeader->writeOwners[0];
+        newestBuffer = &sharedHeader->newestBuffer;
+        numberOfProcesses = MEMORY_GATE_MAX_PROCESSES;
+        //No slot claimed yet
+        processIdx = MEMORY_GATE_MAX_PROCESSES;
+        RecoverDeadProcesses();
+        ret = false;
+        for (uint32 i = 0u; (i < MEMORY_GATE_MAX_PROCESSES) && (!ret); i++) {
+            ret = Atomic::TestAndSet(&sharedHeader->processes[i]);
+            if (ret) {
+                processIdx = i;
+                sharedHeader->pids[i] = static_cast<int32>(getpid());
+            }
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "More than %d processes attached to the shared memory %s", MEMORY_GATE_MAX_PROCESSES, path.Buffer());
+        }
+        /*lint -e{9016} the buffers follow the header.*/
+        mem = &(reinterpret_cast<uint8 *>(sharedHeader))[headerSize];
+    }
+    if ((!ret) && (sharedHeader != NULL_PTR(MemoryGateSharedHeader *))) {
+        (void) munmap(sharedHeader, static_cast<size_t>(sharedMemorySize));
+        sharedHeader = NULL_PTR(MemoryGateSharedHeader *);
+        mem = NULL_PTR(uint8 *);
+        spinlocksRead = NULL_PTR(volatile int32 *);
+        writeLocks = NULL_PTR(volatile int32 *);
+        writeOwners = NULL_PTR(volatile int32 *);
+        newestBuffer = &localNewestBuffer;
+        numberOfProcesses = 1u;
+        processIdx = 0u;
+    }
+    return ret;
+}
 
-    return ok;
+void MemoryGate::RecoverDeadProcesses() {
+    if (sharedHeader != NULL_PTR(MemoryGateSharedHeader *)) {
+        for (uint32 p = 0u; p < MEMORY_GATE_MAX_PROCESSES; p++) {
+            int32 pid = sharedHeader->pids[p];
+            //A claimed slot with pid 0 is being claimed or released
+            if ((p != processIdx) && (sharedHeader->processes[p] != 0) && (pid > 0)) {
+                bool dead = (kill(static_cast<pid_t>(pid), 0) != 0);
+                if (dead) {
+                    dead = (errno == ESRCH);
+                }
+                if (dead) {
+                    for (uint32 i = 0u; i < numberOfBuffers; i++) {
+                        sharedHeader->readers[(p * numberOfBuffers) + i] = 0;
+                        //The owner is cleared before the lock is released, so that a lock just taken by a live process is never released here
+                        if (sharedHeader->writeOwners[i] == static_cast<int32>(p + 1u)) {
+                            sharedHeader->writeOwners[i] = 0;
+                            sharedHeader->writeLocks[i] = 0;
+                        }
+                    }
+                    sharedHeader->pids[p] = 0;
+                    sharedHeader->processes[p] = 0;
+                    REPORT_ERROR(ErrorManagement::Warning, "Recovered the buffers held by the process %d which no longer exists", pid);
+                }
+            }
+        }
+    }
 }
 
-bool MemoryGate::MemoryWrite(const uint8 * const bufferToFlush) {
+uint8 *MemoryGate::GetMemory() const {
+    return mem;
+}
 
+bool MemoryGate::AcquireRead(uint32 &bufferIdx) {
     bool ok = false;
-    uint32 bufferIdx = 0u;
-    uint64 checkedMask = 0ull;
-    for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
-        //check the oldest written
-        uint32 min = 0xFFFFFFFFu;
-        bufferIdx = 0u;
-        for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-            uint32 index = h;
+    uint32 readersIdx = (processIdx * numberOfBuffers);
+    //Only fails if the writers publish, and then take again, the buffer between the load of the newest and the increment of its readers
+    for (uint32 k = 0u; (k <= numberOfBuffers) && (!ok); k++) {
+        bufferIdx = static_cast<uint32>(*newestBuffer);
+        /*lint -e{613} NULL pointer checked.*/
+        Atomic::Increment(&spinlocksRead[readersIdx + bufferIdx]);
+        //With more than one buffer the writers never take the newest one, so that a locked buffer can still be read while it is the newest
+        /*lint -e{613} NULL pointer checked.*/
+        ok = (writeLocks[bufferIdx] == 0);
+        if ((!ok) && (numberOfBuffers > 1u)) {
+            ok = (static_cast<uint32>(*newestBuffer) == bufferIdx);
+        }
+        if (!ok) {
             /*lint -e{613} NULL pointer checked.*/
-            uint32 tempMin = whatIsNewestCounter[index];
-            if ((tempMin < min) && (((1ull << h) & checkedMask) == 0ull)) {
-                min = tempMin;
-                bufferIdx = h;
-            }
+            Atomic::Decrement(&spinlocksRead[readersIdx + bufferIdx]);
         }
-        checkedMask |= (1ull << bufferIdx);
-        ok = false;
-        //try to lock the next buffer to write
-        /*lint -e{613} NULL pointer checked.*/
-        if (spinlocksWrite[bufferIdx].FastTryLock()) {
-            //no readers!
+    }
+    return ok;
+}
+
+void MemoryGate::ReleaseRead(const uint32 bufferIdx) {
+    /*lint -e{613} NULL pointer checked.*/
+    Atomic::Decrement(&spinlocksRead[(processIdx * numberOfBuffers) + bufferIdx]);
+}
+
+bool MemoryGate::AcquireWrite(uint32 &bufferIdx) {
+    bool ok = false;
+    uint32 newest = static_cast<uint32>(*newestBuffer);
+    //Start from the buffer after the newest, i.e. the oldest written
+    for (uint32 k = 1u; (k <= numberOfBuffers) && (!ok); k++) {
+        bufferIdx = ((newest + k) % numberOfBuffers);
+        if ((numberOfBuffers == 1u) || (bufferIdx != newest)) {
             /*lint -e{613} NULL pointer checked.*/
-            if (spinlocksRead[bufferIdx] == 0) {
+            if (Atomic::TestAndSet(&writeLocks[bufferIdx])) {
+                if (writeOwners != NULL_PTR(volatile int32 *)) {
+                    writeOwners[bufferIdx] = static_cast<int32>(processIdx + 1u);
+                }
+                //The readers increment their counter before checking writeLocks, so that either they see the lock or the writer sees them.
                 ok = true;
-            }
-            else {
-                /*lint -e{613} NULL pointer checked.*/
-                spinlocksWrite[bufferIdx].FastUnLock();
+                if (numberOfBuffers > 1u) {
+                    //Another writer may have published this buffer in the meanwhile
+                    ok = (static_cast<uint32>(*newestBuffer) != bufferIdx);
+                }
+                for (uint32 p = 0u; (p < numberOfProcesses) && (ok); p++) {
+                    /*lint -e{613} NULL pointer checked.*/
+                    ok = (spinlocksRead[(p * numberOfBuffers) + bufferIdx] == 0);
+                }
+                if (!ok) {
+                    if (writeOwners != NULL_PTR(volatile int32 *)) {
+                        writeOwners[bufferIdx] = 0;
+                    }
+                    /*lint -e{613} NULL pointer checked.*/
+                    writeLocks[bufferIdx] = 0;
+                }
             }
         }
     }
+    return ok;
+}
+
+void MemoryGate::ReleaseWrite(const uint32 bufferIdx) {
+    if (writeOwners != NULL_PTR(volatile int32 *)) {
+        writeOwners[bufferIdx] = 0;
+    }
+    (void) Atomic::Exchange(newestBuffer, static_cast<int32>(bufferIdx));
+    /*lint -e{613} NULL pointer checked.*/
+    writeLocks[bufferIdx] = 0;
+}
 
+bool MemoryGate::MemoryRead(uint8 * const bufferToFill) {
+    uint32 bufferIdx = 0u;
+    bool ok = AcquireRead(bufferIdx);
     //copy the memory to the data source buffer
     if (ok) {
         uint32 offset = (memSize * bufferIdx);
         /*lint -e{613} NULL pointer checked.*/
-        ok = MemoryOperationsHelper::Copy(&mem[offset], bufferToFlush, memSize);
+        ok = MemoryOperationsHelper::Copy(bufferToFill, &mem[offset], memSize);
+        ReleaseRead(bufferIdx);
     }
 
-    if (ok) {
-        //REPORT_ERROR(ErrorManagement::Information, "buffer write=%d", bufferIdx);
+    return ok;
+}
 
-        whatIsNewestGlobCounter++;
+bool MemoryGate::MemoryWrite(const uint8 * const bufferToFlush) {
+    uint32 bufferIdx = 0u;
+    bool ok = AcquireWrite(bufferIdx);
+    if ((!ok) && (sharedHeader != NULL_PTR(MemoryGateSharedHeader *))) {
+        //The buffers may be held by a process which died
+        RecoverDeadProcesses();
+        ok = AcquireWrite(bufferIdx);
+    }
+    //copy the memory to the data source buffer
+    if (ok) {
+        uint32 offset = (memSize * bufferIdx);
         /*lint -e{613} NULL pointer checked.*/
-        whatIsNewestCounter[bufferIdx] = whatIsNewestGlobCounter;
-
-        //overflow... subtract the smaller one
-        if (whatIsNewestGlobCounter == 0u) {
-
-            uint32 min = 0xFFFFFFFFu;
-            for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-                if (h != bufferIdx) {
-                    /*lint -e{613} NULL pointer checked.*/
-                    if (whatIsNewestCounter[h] < min) {
-                        /*lint -e{613} NULL pointer checked.*/
-                        min = whatIsNewestCounter[h];
-                    }
-                }
-            }
-
-            for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-                if (h != bufferIdx) {
-                    /*lint -e{613} NULL pointer checked.*/
-                    bool blocked = spinlocksWrite[h].FastLock(resetTimeout);
-                    if (blocked) {
-                        /*lint -e{613} NULL pointer checked.*/
-                        whatIsNewestCounter[h] -= min;
-                        /*lint -e{613} NULL pointer checked.*/
-                        spinlocksWrite[h].FastUnLock();
-                    }
-                }
+        ok = MemoryOperationsHelper::Copy(&mem[offset], bufferToFlush, memSize);
+        if (ok) {
+            ReleaseWrite(bufferIdx);
+        }
+        else {
+            if (writeOwners != NULL_PTR(volatile int32 *)) {
+                writeOwners[bufferIdx] = 0;
             }
-
-            whatIsNewestGlobCounter -= min;
             /*lint -e{613} NULL pointer checked.*/
-            whatIsNewestCounter[bufferIdx] -= min;
+            writeLocks[bufferIdx] = 0;
         }
-        /*lint -e{613} NULL pointer checked.*/
-        spinlocksWrite[bufferIdx].FastUnLock();
     }
     return ok;
 }
@@ -32,12 +32,73 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "ReferenceContainer.h"
+#include "StreamString.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 
 namespace MARTe{
 
+/**
+ * The maximum number of buffers.
+ */
+const uint32 MEMORY_GATE_MAX_BUFFERS = 64u;
+
+/**
+ * The maximum number of processes which can be attached to a shared memory MemoryGate.
+ */
+const uint32 MEMORY_GATE_MAX_PROCESSES = 16u;
+
+/**
+ * @brief The control words placed at the beginning of a shared memory MemoryGate, followed by the buffers.
+ */
+struct MemoryGateSharedHeader {
+    /**
+     * Set to MEMORY_GATE_SHARED_MAGIC by the creator once the header is initialised.
+     */
+    volatile int32 magic;
+
+    /**
+     * The number of buffers declared by the creator.
+     */
+    uint32 numberOfBuffers;
+
+    /**
+     * The size of each buffer declared by the creator.
+     */
+    uint32 memSize;
+
+    /**
+     * The index of the newest written buffer.
+     */
+    volatile int32 newestBuffer;
+
+    /**
+     * Set (with an atomic test-and-set) by each attached process on its slot.
+     */
+    volatile int32 processes[MEMORY_GATE_MAX_PROCESSES];
+
+    /**
+     * The pid of the process attached on each slot (0 while the slot is being claimed or released).
+     */
+    volatile int32 pids[MEMORY_GATE_MAX_PROCESSES];
+
+    /**
+     * Set (with an atomic test-and-set) on the buffer that is going to be written.
+     */
+    volatile int32 writeLocks[MEMORY_GATE_MAX_BUFFERS];
+
+    /**
+     * The process slot (+1) holding each write lock (0 if unknown).
+     */
+    volatile int32 writeOwners[MEMORY_GATE_MAX_BUFFERS];
+
+    /**
+     * The number of readers of each buffer for each process slot (slot * numberOfBuffers + buffer).
+     */
+    volatile int32 readers[MEMORY_GATE_MAX_PROCESSES * MEMORY_GATE_MAX_BUFFERS];
+};
+
 /**
  * @brief Allows asynchronous communication between any MARTe components.
  *
@@ -45,20 +106,38 @@ namespace MARTe{
  * that must be shared between all the components linked to this object. The function SetMemorySize() should be called
  * from all the linked components to agree the memory size and to instantiate it if it is not declared in the configuration.
  *
- * @details The readers call the function MemoryRead() that will fill the input buffer with the value of the last written available buffer.
- * If all the buffers are busy by writers, the MemoryRead() returns false. Parallel reads on the same buffer are allowed.
+ * @details The readers call the function MemoryRead() that will fill the input buffer with the value of the last written buffer.
+ * The index of the newest buffer is a single atomic variable: a reader loads it, increments the number of readers of that buffer and
+ * checks that the buffer is not being written or is still the newest. The writers never take the newest buffer, so that the reader only
+ * retries if the buffer was replaced as the newest and taken again by a writer in the meanwhile. Parallel reads on the same buffer are allowed.
+ *
+ * @details The writers call the function MemoryWrite() that will flush the input buffer to the oldest written buffer which is not
+ * being read or written. A writer takes a buffer with an atomic test-and-set and then checks that it has no readers; when the copy is
+ * complete the buffer is published as the newest with an atomic exchange. As each reader and each writer holds at most one buffer other
+ * than the newest, the MemoryWrite() always finds a free buffer if NumberOfBuffers >= NumberOfReaders + NumberOfWriters + 1, which is the
+ * default when NumberOfReaders is set. Otherwise, if all the buffers are busy, the MemoryWrite() returns false.
  *
- * @details The writers call the function MemoryWrite() that will flush the input buffer to the oldest written available buffer. If all
- * the buffers are busy by readers or other writers, the MemoryWrite() returns false.
+ * @details If SharedMemoryName is set, the buffers and the control words (see MemoryGateSharedHeader) are placed on a POSIX shared
+ * memory segment (shm_open/mmap), so that MemoryGate objects with the same name (and the same NumberOfBuffers and memory size) in
+ * different processes exchange the data with the same protocol. The first process creates and initialises the segment, the others attach
+ * to it. If HugePagesDirectory is set, the segment is a file on that hugetlbfs mount instead, and its size is rounded up to the huge page size.
+ * The segment is not removed when the processes terminate and it is reused by the next ones.
+ * Each process claims one of MEMORY_GATE_MAX_PROCESSES slots and counts its readers separately. When a process attaches, or when
+ * a MemoryWrite() finds no free buffer, the slots of the processes which no longer exist are recovered: their readers are cleared and
+ * the write locks they were holding are released, so that the death of a process does not leave buffers busy forever.
  *
  * The configuration syntax is (names are only given as an example):
  *
  * <pre>
  *    +SharedMem = {
  *        Class = MemoryGate
- *        NumberOfBuffers = 10 //The number of buffers that should be in [1-64]. Default = 2
- *        ResetMSecTimeout = 10 //The timeout in milliseconds used by the mutex to lock all the buffers to change the write operations counters in case of write overflow). Default is 0xFFFFFFFF.\n
+ *        NumberOfBuffers = 10 //The number of buffers that should be in [1-64]. Default = NumberOfReaders + NumberOfWriters + 1 if NumberOfReaders is set, 2 otherwise
+ *        NumberOfReaders = 2 //Optional. The number of components which read concurrently from this object.
+ *        NumberOfWriters = 1 //Optional. The number of components which write concurrently to this object. Default = 1
+ *        ResetMSecTimeout = 10 //Optional. Ignored (kept for compatibility: the newest buffer is no longer identified by a write counter which can overflow).
  *        MemorySize = 100 //The size of each buffer memory. If this parameter is not set or if it is equal to zero and the buffer size will be set by the first component that calls SetMemorySize().
+ *        SharedMemoryName = "/MyGate" //Optional. If set the buffers are shared with the MemoryGate objects with the same name in other processes.
+ *        HugePagesDirectory = "/dev/hugepages" //Optional. A hugetlbfs mount where the shared memory file is created (instead of shm_open).
  *    }
  * </pre>
  */
@@ -79,11 +158,15 @@ public:
     /**
      * @see ReferenceContainer::Initialise()
      * @details The user can specify the following configuration parameters:\n
-     *   - NumberOfBuffers = N (the number of buffers that should be in [1-64]. Default = 2)\n
-     *   - ResetMSecTimeout = N (the timeout in milliseconds used by the mutex to lock all the buffers to change the
-     *     write operations counters in case of overflow). Default is 0xFFFFFFFF.\n
+     *   - NumberOfBuffers = N (the number of buffers that should be in [1-64]. Default = NumberOfReaders + NumberOfWriters + 1
+     *     if NumberOfReaders is set, 2 otherwise)\n
+     *   - NumberOfReaders = N (the number of concurrent readers)\n
+     *   - NumberOfWriters = N (the number of concurrent writers. Default = 1)\n
+     *   - ResetMSecTimeout = N (ignored)\n
      *   - MemorySize = N (the size of each buffer memory. If this parameter is not set or if it is equal to zero,
-     *     the buffer size will be set by the first component that calls SetMemorySize()).
+     *     the buffer size will be set by the first component that calls SetMemorySize()).\n
+     *   - SharedMemoryName = "/name" (optional. The name of the shared memory segment)\n
+     *   - HugePagesDirectory = "path" (optional. The hugetlbfs mount where the shared memory file is created)
      */
     virtual bool Initialise(StructuredDataI &data);
 
@@ -92,7 +175,7 @@ public:
      * @details If by configuration the user has not declared the "MemorySize" parameter, or if it has
      * been declared equal to zero, then the first call to this function will set the buffer size and
      * allocates the memory. Successive calls will check if \a size in input is equal to the size of the
-     * allocated buffer memory.
+     * allocated buffer memory. With SharedMemoryName the shared memory segment is created or attached.
      * @param[in] size is the size of the buffer memory.
      * @return true if \a size in input is equal to the previous declared buffer size, false otherwise.
      */
@@ -100,26 +183,80 @@ public:
 
     /**
      * @brief The function called by readers.
-     * @details Browses the buffers to peek the last written available and copy its value to \a
-     * bufferToFill. If no buffer is available, it returns false.
+     * @details Acquires the last written buffer (see AcquireRead) and copies its value to \a
+     * bufferToFill.
      * @param[in] bufferToFill is the buffer to be filled with read data.
-     * @return true if at least one buffer is available, false otherwise.
+     * @return true if the newest buffer could be acquired, false otherwise.
      */
     virtual bool MemoryRead(uint8 * const bufferToFill);
 
 
     /**
      * @brief The function called by writers.
-     * @details Browses the buffers to peek the oldest written available one and copy on it the value of \a
-     * bufferToFlush. If no buffer is available, it returns false.
+     * @details Acquires the oldest written available buffer (see AcquireWrite), copies on it the value of \a
+     * bufferToFlush and publishes it as the newest. If no buffer is available, it returns false.
      * @param[in] bufferToFlush is the buffer contains the data to be written.
      * @return true if at least one buffer is available, false otherwise.
      */
     virtual bool MemoryWrite(const uint8 * const bufferToFlush);
 
 
+    /**
+     * @brief Acquires the newest buffer for reading.
+     * @details Retries at most NumberOfBuffers + 1 times, which is only needed if the writers publish and take again the
+     * buffer between the load of the newest index and the increment of its readers.
+     * The buffer can be held for longer than a copy (e.g. a full real-time cycle), in which case it counts as an additional
+     * reader for the NumberOfBuffers.
+     * @param[out] bufferIdx the acquired buffer (its memory starts at GetMemory() + bufferIdx * memory size).
+     * @return true if the buffer was acquired.
+     */
+    bool AcquireRead(uint32 &bufferIdx);
+
+    /**
+     * @brief Releases a buffer acquired with AcquireRead.
+     * @param[in] bufferIdx the buffer to release.
+     */
+    void ReleaseRead(const uint32 bufferIdx);
+
+    /**
+     * @brief Gets the memory of the buffers.
+     * @return the start of the first buffer (NULL if the memory size has not been set).
+     */
+    uint8 *GetMemory() const;
+
+
 protected:
 
+    /**
+     * @brief Acquires the oldest written buffer which is not the newest and has no readers.
+     * @param[out] bufferIdx the acquired buffer.
+     * @return true if a buffer was acquired.
+     */
+    bool AcquireWrite(uint32 &bufferIdx);
+
+    /**
+     * @brief Publishes a buffer acquired with AcquireWrite as the newest and releases it.
+     * @param[in] bufferIdx the buffer to publish.
+     */
+    void ReleaseWrite(const uint32 bufferIdx);
+
+    /**
+     * @brief Allocates the buffers (of \a memSize) in the heap or in the shared memory segment.
+     * @return true if the buffers are allocated.
+     */
+    bool AllocateBuffers();
+
+    /**
+     * @brief Creates or attaches the shared memory segment and claims a process slot.
+     * @return true if the segment is mapped and compatible with this object.
+     */
+    bool MapSharedMemory();
+
+    /**
+     * @brief Releases the readers and the write locks of the processes attached to the shared memory segment which no longer exist.
+     */
+    void RecoverDeadProcesses();
+
     /**
      * The total internal memory.
      */
@@ -141,30 +278,59 @@ protected:
     volatile int32 *spinlocksRead;
 
     /**
-     * A semaphore to lock the buffer that is going to be written.
+     * Set (with an atomic test-and-set) on the buffer that is going to be written.
      */
-    FastPollingMutexSem *spinlocksWrite;
+    volatile int32 *writeLocks;
 
     /**
-     * Used to denote the oldest and newest written buffers
+     * The process slot (+1) holding each write lock (shared memory only).
      */
-    uint32 *whatIsNewestCounter;
+    volatile int32 *writeOwners;
 
     /**
-     * The counter incremented for each signal at the end of the write operation
+     * The index of the newest written buffer (in the shared memory segment or \a localNewestBuffer).
      */
-    uint32 whatIsNewestGlobCounter;
+    volatile int32 *newestBuffer;
 
     /**
-     * Stores the signal offset in case of more write operations.
+     * The index of the newest written buffer if the memory is not shared.
      */
-    uint32 offsetStore;
+    volatile int32 localNewestBuffer;
+
+    /**
+     * The number of processes which count their readers separately (1 if the memory is not shared).
+     */
+    uint32 numberOfProcesses;
 
     /**
-     * The timeout in millisecs to lock the other \a spinlocksWrite semaphores
-     * in case of overflow of \a whatIsNewestCounter (to avoid a priority inversion)
+     * The process slot of this process in the shared memory segment.
      */
-    TimeoutType resetTimeout;
+    uint32 processIdx;
+
+    /**
+     * The name of the shared memory segment (empty if the memory is not shared).
+     */
+    StreamString sharedMemoryName;
+
+    /**
+     * The hugetlbfs directory where the shared memory file is created (empty to use shm_open).
+     */
+    StreamString hugePagesDirectory;
+
+    /**
+     * The mapped shared memory segment.
+     */
+    MemoryGateSharedHeader *sharedHeader;
+
+    /**
+     * The size of the mapped shared memory segment.
+     */
+    uint64 sharedMemorySize;
+
+    /**
+     * Stores the signal offset in case of more write operations.
+     */
+    uint32 offsetStore;
 };
 
 }
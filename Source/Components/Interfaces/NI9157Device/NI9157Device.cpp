@@ -284,6 +284,12 @@ NiFpga_Status NI9157Device::FindResource(const char8 * const varName, const bool
     if (status != 0) {
         status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_HostToTargetFifoBool, &resource);
     }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_ControlArrayBool, &resource);
+    }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_IndicatorArrayBool, &resource);
+    }
     varDescriptor = static_cast<uint32> (resource);
     return status;
 }
@@ -302,6 +308,12 @@ NiFpga_Status NI9157Device::FindResource(const char8 * const varName, const uint
     if (status != 0) {
         status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_HostToTargetFifoU8, &resource);
     }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_ControlArrayU8, &resource);
+    }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_IndicatorArrayU8, &resource);
+    }
     varDescriptor = static_cast<uint32> (resource);
     return status;
 }
@@ -320,6 +332,12 @@ NiFpga_Status NI9157Device::FindResource(const char8 * const varName, const int8
     if (status != 0) {
         status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_HostToTargetFifoI8, &resource);
     }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_ControlArrayI8, &resource);
+    }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_IndicatorArrayI8, &resource);
+    }
     varDescriptor = static_cast<uint32> (resource);
     return status;
 }
@@ -338,6 +356,12 @@ NiFpga_Status NI9157Device::FindResource(const char8 * const varName, const uint
     if (status != 0) {
         status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_HostToTargetFifoU16, &resource);
     }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_ControlArrayU16, &resource);
+    }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_IndicatorArrayU16, &resource);
+    }
     varDescriptor = static_cast<uint32> (resource);
     return status;
 }
@@ -356,6 +380,12 @@ NiFpga_Status NI9157Device::FindResource(const char8 * const varName, const int1
     if (status != 0) {
         status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_HostToTargetFifoI16, &resource);
     }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_ControlArrayI16, &resource);
+    }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_IndicatorArrayI16, &resource);
+    }
     varDescriptor = static_cast<uint32> (resource);
     return status;
 }
@@ -374,6 +404,12 @@ NiFpga_Status NI9157Device::FindResource(const char8 * const varName, const uint
     if (status != 0) {
         status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_HostToTargetFifoU32, &resource);
     }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_ControlArrayU32, &resource);
+    }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_IndicatorArrayU32, &resource);
+    }
     varDescriptor = static_cast<uint32> (resource);
     return status;
 }
@@ -392,6 +428,12 @@ NiFpga_Status NI9157Device::FindResource(const char8 * const varName, const int3
     if (status != 0) {
         status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_HostToTargetFifoI32, &resource);
     }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_ControlArrayI32, &resource);
+    }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_IndicatorArrayI32, &resource);
+    }
     varDescriptor = static_cast<uint32> (resource);
     return status;
 }
@@ -410,6 +452,12 @@ NiFpga_Status NI9157Device::FindResource(const char8 * const varName, const uint
     if (status != 0) {
         status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_HostToTargetFifoU64, &resource);
     }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_ControlArrayU64, &resource);
+    }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_IndicatorArrayU64, &resource);
+    }
     varDescriptor = static_cast<uint32> (resource);
     return status;
 }
@@ -428,6 +476,12 @@ NiFpga_Status NI9157Device::FindResource(const char8 * const varName, const int6
     if (status != 0) {
         status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_HostToTargetFifoI64, &resource);
     }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_ControlArrayI64, &resource);
+    }
+    if (status != 0) {
+        status = NiFpgaEx_FindResource(session, varName, NiFpgaEx_ResourceType_IndicatorArrayI64, &resource);
+    }
     varDescriptor = static_cast<uint32> (resource);
     return status;
 }
@@ -533,6 +587,78 @@ NiFpga_Status NI9157Device::NiWrite(const uint32 control, const uint64 value) co
     return NiFpga_WriteU64(session, static_cast<uint32_t> (control), static_cast<uint64_t> (value));
 }
 
+NiFpga_Status NI9157Device::NiReadArray(const uint32 indicator, bool * const array, const uint32 size) const {
+    return NiFpga_ReadArrayBool(session, static_cast<uint32_t> (indicator), reinterpret_cast<NiFpga_Bool*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiReadArray(const uint32 indicator, int8 * const array, const uint32 size) const {
+    return NiFpga_ReadArrayI8(session, static_cast<uint32_t> (indicator), reinterpret_cast<int8_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiReadArray(const uint32 indicator, uint8 * const array, const uint32 size) const {
+    return NiFpga_ReadArrayU8(session, static_cast<uint32_t> (indicator), reinterpret_cast<uint8_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiReadArray(const uint32 indicator, int16 * const array, const uint32 size) const {
+    return NiFpga_ReadArrayI16(session, static_cast<uint32_t> (indicator), reinterpret_cast<int16_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiReadArray(const uint32 indicator, uint16 * const array, const uint32 size) const {
+    return NiFpga_ReadArrayU16(session, static_cast<uint32_t> (indicator), reinterpret_cast<uint16_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiReadArray(const uint32 indicator, int32 * const array, const uint32 size) const {
+    return NiFpga_ReadArrayI32(session, static_cast<uint32_t> (indicator), reinterpret_cast<int32_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiReadArray(const uint32 indicator, uint32 * const array, const uint32 size) const {
+    return NiFpga_ReadArrayU32(session, static_cast<uint32_t> (indicator), reinterpret_cast<uint32_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiReadArray(const uint32 indicator, int64 * const array, const uint32 size) const {
+    return NiFpga_ReadArrayI64(session, static_cast<uint32_t> (indicator), reinterpret_cast<int64_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiReadArray(const uint32 indicator, uint64 * const array, const uint32 size) const {
+    return NiFpga_ReadArrayU64(session, static_cast<uint32_t> (indicator), reinterpret_cast<uint64_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiWriteArray(const uint32 control, const bool * const array, const uint32 size) const {
+    return NiFpga_WriteArrayBool(session, static_cast<uint32_t> (control), reinterpret_cast<const NiFpga_Bool*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiWriteArray(const uint32 control, const int8 * const array, const uint32 size) const {
+    return NiFpga_WriteArrayI8(session, static_cast<uint32_t> (control), reinterpret_cast<const int8_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiWriteArray(const uint32 control, const uint8 * const array, const uint32 size) const {
+    return NiFpga_WriteArrayU8(session, static_cast<uint32_t> (control), reinterpret_cast<const uint8_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiWriteArray(const uint32 control, const int16 * const array, const uint32 size) const {
+    return NiFpga_WriteArrayI16(session, static_cast<uint32_t> (control), reinterpret_cast<const int16_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiWriteArray(const uint32 control, const uint16 * const array, const uint32 size) const {
+    return NiFpga_WriteArrayU16(session, static_cast<uint32_t> (control), reinterpret_cast<const uint16_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiWriteArray(const uint32 control, const int32 * const array, const uint32 size) const {
+    return NiFpga_WriteArrayI32(session, static_cast<uint32_t> (control), reinterpret_cast<const int32_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiWriteArray(const uint32 control, const uint32 * const array, const uint32 size) const {
+    return NiFpga_WriteArrayU32(session, static_cast<uint32_t> (control), reinterpret_cast<const uint32_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiWriteArray(const uint32 control, const int64 * const array, const uint32 size) const {
+    return NiFpga_WriteArrayI64(session, static_cast<uint32_t> (control), reinterpret_cast<const int64_t*> (array), static_cast<size_t> (size));
+}
+
+NiFpga_Status NI9157Device::NiWriteArray(const uint32 control, const uint64 * const array, const uint32 size) const {
+    return NiFpga_WriteArrayU64(session, static_cast<uint32_t> (control), reinterpret_cast<const uint64_t*> (array), static_cast<size_t> (size));
+}
+
 NiFpga_Status NI9157Device::NiConfigureFifo(const uint32 fifo, const uint32 requestedDepth, uint32 &actualDepth) const {
     NiFpga_Status localStatus;
     NiFpgaEx_DmaFifo niFifo = static_cast<NiFpgaEx_Resource> (fifo);
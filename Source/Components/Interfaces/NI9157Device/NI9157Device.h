@@ -404,6 +404,204 @@ public:
     NiFpga_Status NiWrite(const uint32 control,
                             const uint64 value) const;
 
+    /**
+     * @brief Reads a boolean array from a given array indicator or control in a single transaction.
+     * @param[in] indicator array indicator or control from which to read
+     * @param[out] array outputs the data that was read
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiReadArray(const uint32 indicator,
+                            bool * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Reads a signed 8-bit integer array from a given array indicator or control in a single transaction.
+     * @param[in] indicator array indicator or control from which to read
+     * @param[out] array outputs the data that was read
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiReadArray(const uint32 indicator,
+                            int8 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Reads an unsigned 8-bit integer array from a given array indicator or control in a single transaction.
+     * @param[in] indicator array indicator or control from which to read
+     * @param[out] array outputs the data that was read
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiReadArray(const uint32 indicator,
+                            uint8 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Reads a signed 16-bit integer array from a given array indicator or control in a single transaction.
+     * @param[in] indicator array indicator or control from which to read
+     * @param[out] array outputs the data that was read
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiReadArray(const uint32 indicator,
+                            int16 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Reads an unsigned 16-bit integer array from a given array indicator or control in a single transaction.
+     * @param[in] indicator array indicator or control from which to read
+     * @param[out] array outputs the data that was read
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiReadArray(const uint32 indicator,
+                            uint16 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Reads a signed 32-bit integer array from a given array indicator or control in a single transaction.
+     * @param[in] indicator array indicator or control from which to read
+     * @param[out] array outputs the data that was read
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiReadArray(const uint32 indicator,
+                            int32 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Reads an unsigned 32-bit integer array from a given array indicator or control in a single transaction.
+     * @param[in] indicator array indicator or control from which to read
+     * @param[out] array outputs the data that was read
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiReadArray(const uint32 indicator,
+                            uint32 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Reads a signed 64-bit integer array from a given array indicator or control in a single transaction.
+     * @param[in] indicator array indicator or control from which to read
+     * @param[out] array outputs the data that was read
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiReadArray(const uint32 indicator,
+                            int64 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Reads an unsigned 64-bit integer array from a given array indicator or control in a single transaction.
+     * @param[in] indicator array indicator or control from which to read
+     * @param[out] array outputs the data that was read
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiReadArray(const uint32 indicator,
+                            uint64 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Writes a boolean array to a given array control or indicator in a single transaction.
+     * @param[in] control array control or indicator to which to write
+     * @param[in] array the data to write
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiWriteArray(const uint32 control,
+                            const bool * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Writes a signed 8-bit integer array to a given array control or indicator in a single transaction.
+     * @param[in] control array control or indicator to which to write
+     * @param[in] array the data to write
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiWriteArray(const uint32 control,
+                            const int8 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Writes an unsigned 8-bit integer array to a given array control or indicator in a single transaction.
+     * @param[in] control array control or indicator to which to write
+     * @param[in] array the data to write
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiWriteArray(const uint32 control,
+                            const uint8 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Writes a signed 16-bit integer array to a given array control or indicator in a single transaction.
+     * @param[in] control array control or indicator to which to write
+     * @param[in] array the data to write
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiWriteArray(const uint32 control,
+                            const int16 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Writes an unsigned 16-bit integer array to a given array control or indicator in a single transaction.
+     * @param[in] control array control or indicator to which to write
+     * @param[in] array the data to write
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiWriteArray(const uint32 control,
+                            const uint16 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Writes a signed 32-bit integer array to a given array control or indicator in a single transaction.
+     * @param[in] control array control or indicator to which to write
+     * @param[in] array the data to write
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiWriteArray(const uint32 control,
+                            const int32 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Writes an unsigned 32-bit integer array to a given array control or indicator in a single transaction.
+     * @param[in] control array control or indicator to which to write
+     * @param[in] array the data to write
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiWriteArray(const uint32 control,
+                            const uint32 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Writes a signed 64-bit integer array to a given array control or indicator in a single transaction.
+     * @param[in] control array control or indicator to which to write
+     * @param[in] array the data to write
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiWriteArray(const uint32 control,
+                            const int64 * const array,
+                            const uint32 size) const;
+
+    /**
+     * @brief Writes an unsigned 64-bit integer array to a given array control or indicator in a single transaction.
+     * @param[in] control array control or indicator to which to write
+     * @param[in] array the data to write
+     * @param[in] size the number of elements in the array
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     */
+    NiFpga_Status NiWriteArray(const uint32 control,
+                            const uint64 * const array,
+                            const uint32 size) const;
+
     /**
      * @brief Specifies the depth of the host memory part of the DMA FIFO. This method is
      * optional.
@@ -87,6 +87,18 @@ public:
      */
     virtual NiFpga_Status NiWrite(const uint32 control, void * const value) const;
 
+    /**
+     * @see NI9157DeviceOperatorTI::NiReadArray.
+     * @details Typed array read from the NI-9157 device depending on the template type.
+     */
+    virtual NiFpga_Status NiReadArray(const uint32 indicator, void * const array, const uint32 size) const;
+
+    /**
+     * @see NI9157DeviceOperatorTI::NiWriteArray.
+     * @details Typed array write to the NI-9157 device depending on the template type.
+     */
+    virtual NiFpga_Status NiWriteArray(const uint32 control, const void * const array, const uint32 size) const;
+
     /**
      * @see NI9157DeviceOperatorTI::NiReadFifo.
      * @details Typed read from the NI-9157 FIFO depending on the template type.
@@ -176,6 +188,16 @@ NiFpga_Status NI9157DeviceOperatorT<T>::NiWrite(const uint32 control, void * con
     return niDevice->NiWrite(control, *reinterpret_cast<T*>(value));
 }
 
+template<typename T>
+NiFpga_Status NI9157DeviceOperatorT<T>::NiReadArray(const uint32 indicator, void * const array, const uint32 size) const {
+    return niDevice->NiReadArray(indicator, reinterpret_cast<T*>(array), size);
+}
+
+template<typename T>
+NiFpga_Status NI9157DeviceOperatorT<T>::NiWriteArray(const uint32 control, const void * const array, const uint32 size) const {
+    return niDevice->NiWriteArray(control, reinterpret_cast<const T *>(array), size);
+}
+
 template<typename T>
 NiFpga_Status NI9157DeviceOperatorT<T>::NiReadFifo(const uint32 fifo, void * const data, const uint32 numberOfElements, const uint32 timeout, uint32 &elementsRemaining) const {
     return niDevice->NiReadFifo(fifo, reinterpret_cast<T*>(data), numberOfElements, timeout, elementsRemaining);
@@ -89,6 +89,28 @@ public:
      */
     virtual NiFpga_Status NiWrite(const uint32 control, void * const value) const =0;
 
+    /**
+     * @brief Reads an array indicator from NI-9157 device in a single transaction.
+     * @param[in] indicator array indicator or control from which to read.
+     * @param[out] array outputs the data that was read.
+     * @param[in] size number of elements in the array.
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     * @pre
+     *   IsValid() == true
+     */
+    virtual NiFpga_Status NiReadArray(const uint32 indicator, void * const array, const uint32 size) const =0;
+
+    /**
+     * @brief Writes an array control to NI-9157 device in a single transaction.
+     * @param[in] control array control or indicator to which to write.
+     * @param[in] array data to write.
+     * @param[in] size number of elements in the array.
+     * @return status=0 if succeeds, status=[error_code] if fails.
+     * @pre
+     *   IsValid() == true
+     */
+    virtual NiFpga_Status NiWriteArray(const uint32 control, const void * const array, const uint32 size) const =0;
+
     /**
      * @brief Reads from NI-9157 FIFO.
      * @param[in] fifo target-to-host FIFO from which to read.
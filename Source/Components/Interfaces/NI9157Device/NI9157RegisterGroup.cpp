@@ -0,0 +1,152 @@
+/**
+ * @file NI9157RegisterGroup.cpp
+ * @brief Source file for class NI9157RegisterGroup.
+ * @date 15/10/2026
+ * @author Pedro Lourenco
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ *
+ * @details This source file contains the definition of all the methods for
+ * the class NI9157RegisterGroup (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "NI9157RegisterGroup.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+NI9157RegisterGroup::NI9157RegisterGroup() {
+    registers = NULL_PTR(NI9157Register *);
+    numberOfRegisters = 0u;
+    maxNumberOfRegisters = 0u;
+}
+
+NI9157RegisterGroup::~NI9157RegisterGroup() {
+    if (registers != NULL_PTR(NI9157Register *)) {
+        delete[] registers;
+    }
+}
+
+bool NI9157RegisterGroup::Allocate(const uint32 maxNumberOfRegisters) {
+    if (registers != NULL_PTR(NI9157Register *)) {
+        delete[] registers;
+        registers = NULL_PTR(NI9157Register *);
+    }
+    numberOfRegisters = 0u;
+    this->maxNumberOfRegisters = 0u;
+    bool ret = (maxNumberOfRegisters > 0u);
+    if (ret) {
+        registers = new NI9157Register[maxNumberOfRegisters];
+        this->maxNumberOfRegisters = maxNumberOfRegisters;
+    }
+    return ret;
+}
+
+bool NI9157RegisterGroup::Add(NI9157DeviceOperatorTI * const deviceOperator,
+                              const uint32 descriptor,
+                              const uint32 numberOfElements,
+                              void * const value) {
+    bool ret = (numberOfRegisters < maxNumberOfRegisters);
+    if (ret) {
+        ret = (deviceOperator != NULL_PTR(NI9157DeviceOperatorTI *));
+    }
+    if (ret) {
+        ret = (value != NULL_PTR(void *));
+    }
+    if (ret) {
+        ret = (numberOfElements > 0u);
+    }
+    if (ret) {
+        /*lint -e{613} numberOfRegisters < maxNumberOfRegisters => registers != NULL*/
+        registers[numberOfRegisters].deviceOperator = deviceOperator;
+        registers[numberOfRegisters].descriptor = descriptor;
+        registers[numberOfRegisters].numberOfElements = numberOfElements;
+        registers[numberOfRegisters].value = value;
+        numberOfRegisters++;
+    }
+    return ret;
+}
+
+void NI9157RegisterGroup::Prepare() {
+    //Insertion sort: the groups are small and built only once
+    for (uint32 i = 1u; i < numberOfRegisters; i++) {
+        /*lint -e{613} numberOfRegisters > 0 => registers != NULL*/
+        NI9157Register reg = registers[i];
+        uint32 j = i;
+        while ((j > 0u) && (registers[j - 1u].descriptor > reg.descriptor)) {
+            registers[j] = registers[j - 1u];
+            j--;
+        }
+        registers[j] = reg;
+    }
+}
+
+NiFpga_Status NI9157RegisterGroup::Read() const {
+    NiFpga_Status status = 0;
+    for (uint32 i = 0u; (i < numberOfRegisters) && (status == 0); i++) {
+        /*lint -e{613} numberOfRegisters > 0 => registers != NULL*/
+        const NI9157Register &reg = registers[i];
+        if (reg.numberOfElements > 1u) {
+            status = reg.deviceOperator->NiReadArray(reg.descriptor, reg.value, reg.numberOfElements);
+        }
+        else {
+            status = reg.deviceOperator->NiRead(reg.descriptor, reg.value);
+        }
+    }
+    return status;
+}
+
+NiFpga_Status NI9157RegisterGroup::Write() const {
+    NiFpga_Status status = 0;
+    for (uint32 i = 0u; (i < numberOfRegisters) && (status == 0); i++) {
+        /*lint -e{613} numberOfRegisters > 0 => registers != NULL*/
+        const NI9157Register &reg = registers[i];
+        if (reg.numberOfElements > 1u) {
+            status = reg.deviceOperator->NiWriteArray(reg.descriptor, reg.value, reg.numberOfElements);
+        }
+        else {
+            status = reg.deviceOperator->NiWrite(reg.descriptor, reg.value);
+        }
+    }
+    return status;
+}
+
+uint32 NI9157RegisterGroup::GetNumberOfRegisters() const {
+    return numberOfRegisters;
+}
+
+uint32 NI9157RegisterGroup::GetDescriptor(const uint32 idx) const {
+    uint32 descriptor = 0xFFFFFFFFu;
+    if (idx < numberOfRegisters) {
+        /*lint -e{613} idx < numberOfRegisters => registers != NULL*/
+        descriptor = registers[idx].descriptor;
+    }
+    return descriptor;
+}
+
+}
@@ -0,0 +1,174 @@
+/**
+ * @file NI9157RegisterGroup.h
+ * @brief Header file for class NI9157RegisterGroup.
+ * @date 15/10/2026
+ * @author Pedro Lourenco
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ *
+ * @details This header file contains the declaration of the class
+ * NI9157RegisterGroup with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef NI9157REGISTERGROUP_H_
+#define NI9157REGISTERGROUP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "NI9157DeviceOperatorTI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief A list of NI-9157 controls and/or indicators which are transferred
+ * together.
+ * @details The registers are added once at setup time (Add) and then moved
+ * with a single Read or Write call. Registers with more than one element
+ * are LabVIEW array controls/indicators and are moved with one
+ * NiReadArray/NiWriteArray transaction, so that the number of MXI round
+ * trips is the number of registers and not the number of values. Packing
+ * many values in one array indicator on the FPGA side is therefore the way
+ * to move them in the fewest transactions.
+ * @details Prepare sorts the registers by descriptor (i.e. by offset in the
+ * FPGA register space), so that consecutive accesses hit adjacent
+ * registers.
+ */
+class NI9157RegisterGroup {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetNumberOfRegisters() == 0u
+     */
+    NI9157RegisterGroup();
+
+    /**
+     * @brief Destructor. Frees the register list.
+     */
+    ~NI9157RegisterGroup();
+
+    /**
+     * @brief Allocates the register list, removing any register previously
+     * added.
+     * @param[in] maxNumberOfRegisters the maximum number of registers which
+     * can be added.
+     * @return true if \a maxNumberOfRegisters > 0.
+     */
+    bool Allocate(const uint32 maxNumberOfRegisters);
+
+    /**
+     * @brief Adds a register to the group.
+     * @param[in] deviceOperator the typed operator used to access the register.
+     * @param[in] descriptor the register descriptor (see FindResource).
+     * @param[in] numberOfElements 1 for scalar registers, the array size for
+     * array controls/indicators.
+     * @param[in] value the host memory of the register.
+     * @return false if the list is full, if \a deviceOperator or \a value are
+     * NULL or if \a numberOfElements == 0.
+     */
+    bool Add(NI9157DeviceOperatorTI * const deviceOperator,
+             const uint32 descriptor,
+             const uint32 numberOfElements,
+             void * const value);
+
+    /**
+     * @brief Sorts the registers by descriptor.
+     */
+    void Prepare();
+
+    /**
+     * @brief Reads all the registers into their host memory.
+     * @return status=0 if succeeds, the status of the first failed access
+     * otherwise (the remaining registers are not read).
+     */
+    NiFpga_Status Read() const;
+
+    /**
+     * @brief Writes all the registers from their host memory.
+     * @return status=0 if succeeds, the status of the first failed access
+     * otherwise (the remaining registers are not written).
+     */
+    NiFpga_Status Write() const;
+
+    /**
+     * @brief Gets the number of registers in the group.
+     * @return the number of registers in the group.
+     */
+    uint32 GetNumberOfRegisters() const;
+
+    /**
+     * @brief Gets the descriptor of the register at position \a idx.
+     * @param[in] idx the register position (after Prepare, in descriptor order).
+     * @return the register descriptor or 0xFFFFFFFFu if \a idx is not valid.
+     */
+    uint32 GetDescriptor(const uint32 idx) const;
+
+private:
+
+    /**
+     * @brief One register of the group.
+     */
+    struct NI9157Register {
+        /**
+         * The typed operator.
+         */
+        NI9157DeviceOperatorTI *deviceOperator;
+        /**
+         * The register descriptor.
+         */
+        uint32 descriptor;
+        /**
+         * The number of elements (> 1 for arrays).
+         */
+        uint32 numberOfElements;
+        /**
+         * The host memory of the register.
+         */
+        void *value;
+    };
+
+    /**
+     * The register list.
+     */
+    NI9157Register *registers;
+
+    /**
+     * The number of registers added.
+     */
+    uint32 numberOfRegisters;
+
+    /**
+     * The maximum number of registers.
+     */
+    uint32 maxNumberOfRegisters;
+
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* NI9157REGISTERGROUP_H_ */
@@ -58,6 +58,9 @@ OPCUAMessageClient::OPCUAMessageClient() :
     values = NULL_PTR(AnyType**);
     methodNamespaceIndex = 0u;
     methodPath = "";
+    callMode = "";
+    maxCallsInFlight = 2u;
+    callTimeout = 1000u;
     signalAddresses = NULL_PTR(void**);
     filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
@@ -121,6 +124,30 @@ bool OPCUAMessageClient::Initialise(StructuredDataI &data) {
         if (!ok) {
             REPORT_ERROR(ErrorManagement::ParametersError, "Cannot read the Address attribute");
         }
+        if (ok) {
+            if (!data.Read("CallMode", callMode)) {
+                callMode = "Call";
+                REPORT_ERROR(ErrorManagement::Information, "CallMode option is not enabled. Using synchronous Method Call.");
+            }
+            ok = ((callMode == "Call") || (callMode == "AsyncCall"));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "CallMode shall be Call or AsyncCall");
+            }
+        }
+        if ((callMode == "AsyncCall") && (ok)) {
+            if (!data.Read("MaxCallsInFlight", maxCallsInFlight)) {
+                REPORT_ERROR(ErrorManagement::Information, "MaxCallsInFlight not set. Using default: %d", maxCallsInFlight);
+            }
+            ok = (maxCallsInFlight > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "MaxCallsInFlight shall be > 0");
+            }
+            if (ok) {
+                if (!data.Read("CallTimeout", callTimeout)) {
+                    REPORT_ERROR(ErrorManagement::Information, "CallTimeout not set. Using default: %d ms", callTimeout);
+                }
+            }
+        }
         /* Reading Method Informations */
         if (ok) {
             ok = data.MoveRelative("Method");
@@ -243,6 +270,7 @@ bool OPCUAMessageClient::Initialise(StructuredDataI &data) {
                 /* Setting up OPCUA Client */
                 masterClient = new OPCUAClientMethod();
                 masterClient->SetServerAddress(serverAddress);
+                masterClient->SetMaxCallsInFlight(maxCallsInFlight);
                 ok = masterClient->Connect();
                 if (ok) {
                     REPORT_ERROR(ErrorManagement::Information, "The connection with the OPCUA Server has been established successfully!");
@@ -322,7 +350,12 @@ ErrorManagement::ErrorType OPCUAMessageClient::OPCUAMethodCall(StructuredDataI &
     if (ok) {
         if (masterClient != NULL_PTR(OPCUAClientMethod*)) {
             REPORT_ERROR(ErrorManagement::Information, "OPCUA Method Call");
-            ok = masterClient->MethodCall();
+            if (callMode == "AsyncCall") {
+                ok = masterClient->MethodCallAsync(callTimeout);
+            }
+            else {
+                ok = masterClient->MethodCall();
+            }
         }
         if (ok) {
             err = ErrorManagement::NoError;
@@ -471,7 +504,10 @@ bool OPCUAMessageClient::MapStructuredData(StructuredDataI &data,
             if (entryArrayElements[index] == 1u) {
                 uint32 nOfBytes = entryTypes[index].numberOfBits;
                 nOfBytes /= 8u;
-                values[nodeCounter] = new AnyType(entryTypes[index], 0u, HeapManager::Malloc(nOfBytes));
+                /* The values are allocated with the first message and reused by the following ones */
+                if (values[nodeCounter] == NULL_PTR(AnyType*)) {
+                    values[nodeCounter] = new AnyType(entryTypes[index], 0u, new uint8[nOfBytes]);
+                }
                 ok = data.Read(entryMemberNames[index], *values[nodeCounter]);
                 if (ok) {
                     if ((signalAddresses != NULL_PTR(void**)) && (masterClient != NULL_PTR(OPCUAClientMethod*))) {
@@ -486,10 +522,12 @@ bool OPCUAMessageClient::MapStructuredData(StructuredDataI &data,
                 uint32 nOfBytes = entryTypes[index].numberOfBits;
                 nOfBytes /= 8u;
                 nOfBytes *= entryArrayElements[index];
-                uint8 *mem = new uint8[nOfBytes];
-                values[nodeCounter] = new AnyType(entryTypes[index], 0u, mem);
-                values[nodeCounter]->SetNumberOfDimensions(1u);
-                values[nodeCounter]->SetNumberOfElements(0u, entryArrayElements[index]);
+                if (values[nodeCounter] == NULL_PTR(AnyType*)) {
+                    uint8 *mem = new uint8[nOfBytes];
+                    values[nodeCounter] = new AnyType(entryTypes[index], 0u, mem);
+                    values[nodeCounter]->SetNumberOfDimensions(1u);
+                    values[nodeCounter]->SetNumberOfElements(0u, entryArrayElements[index]);
+                }
                 AnyType source = data.GetType(entryMemberNames[index]);
                 ok = TypeConvert(*values[nodeCounter], source);
 
@@ -55,6 +55,9 @@ namespace MARTe {
  * +OPCUAMessageClient = {
  *     Class = OPCUA::OPCUAMessageClient
  *     Address = "opc.tcp://192.168.130.20:4840" //The OPCUA Server Address
+ *     CallMode = "Call" //"Call" waits for the result of each Method Call, "AsyncCall" pipelines the Method Calls. (Optional) Default = "Call"
+ *     MaxCallsInFlight = 2 //(Optional) Only if CallMode is "AsyncCall". Maximum number of Method Calls in flight (> 0). Default = 2
+ *     CallTimeout = 1000 //(Optional) Only if CallMode is "AsyncCall". Maximum time (ms) to wait for a Method Call to complete when MaxCallsInFlight are in flight. Default = 1000
  *     Signals = {
  *         Structure = {
  *             SCU_Config = {
@@ -71,6 +74,10 @@ namespace MARTe {
  *     }
  * }
  * </pre>
+ *
+ * The client session is opened in Initialise and kept for all the messages. With CallMode = "AsyncCall" the OPCUAMethodCall returns as soon as
+ * the Method Call is sent, so that a burst of messages does not wait for the round trip of each call: a failed call is reported by the next
+ * message. The number of calls and their latency are available from the OPCUAClientMethod (see GetOPCUAClient).
  */
 class OPCUAMessageClient: public Object, public MessageI {
 public:
@@ -256,6 +263,21 @@ private:
      */
     StreamString methodPath;
 
+    /**
+     * Holds the value of the configuration parameter CallMode
+     */
+    StreamString callMode;
+
+    /**
+     * Holds the value of the configuration parameter MaxCallsInFlight
+     */
+    uint32 maxCallsInFlight;
+
+    /**
+     * Holds the value of the configuration parameter CallTimeout
+     */
+    uint32 callTimeout;
+
     /**
      * The MessageFilter
      */
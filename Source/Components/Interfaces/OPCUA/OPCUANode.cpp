@@ -43,10 +43,19 @@ namespace MARTe {
 OPCUANode::OPCUANode() :
         OPCUAReferenceContainer() {
     parentReferenceNodeId = 1u;
+    publishedMemory = NULL_PTR(void *);
+    publishedSize = 0u;
+    publishedType = NULL_PTR(const UA_DataType *);
+    publishedNElements = 0u;
+    publishedTime = 0;
+    publishedMux.Create();
 }
 
+/*lint -e{1551} no exception thrown*/
 OPCUANode::~OPCUANode() {
-
+    if (publishedMemory != NULL_PTR(void *)) {
+        (void) HeapManager::Free(publishedMemory);
+    }
 }
 /*lint -e{534} No returning value is ignored.*/
 /*lint -e{746} -e{1055} -e{534} -e{516} UA_Variant_setScalar is defined in open62541.*/
@@ -215,6 +224,84 @@ bool OPCUANode::InitArray(OPCUA::OPCUANodeSettings const & settings,
     return ok;
 }
 
+bool OPCUANode::InitPublishedValue(const UA_Variant &initialValue) {
+    bool ok = (initialValue.type != NULL_PTR(const UA_DataType *)) && (publishedMemory == NULL_PTR(void *));
+    if (ok) {
+        publishedType = initialValue.type;
+        publishedNElements = static_cast<uint32>(initialValue.arrayLength);
+        uint32 nElements = (publishedNElements > 0u) ? (publishedNElements) : (1u);
+        publishedSize = (static_cast<uint32>(publishedType->memSize) * nElements);
+        publishedMemory = HeapManager::Malloc(publishedSize);
+        ok = (publishedMemory != NULL_PTR(void *));
+    }
+    if (ok) {
+        if (initialValue.data != NULL_PTR(void *)) {
+            ok = MemoryOperationsHelper::Copy(publishedMemory, initialValue.data, publishedSize);
+        }
+        else {
+            ok = MemoryOperationsHelper::Set(publishedMemory, '\0', publishedSize);
+        }
+        /*lint -e{526} -e{628} -e{1055} -e{746} function defined in open62541*/
+        publishedTime = UA_DateTime_now();
+    }
+    return ok;
+}
+
+bool OPCUANode::SetPublishedValue(const void *const value,
+                                  const uint32 size) {
+    bool ok = (publishedMemory != NULL_PTR(void *)) && (size == publishedSize);
+    if (ok) {
+        /*lint -e{526} -e{628} -e{1055} -e{746} function defined in open62541*/
+        UA_DateTime now = UA_DateTime_now();
+        (void) publishedMux.FastLock();
+        ok = MemoryOperationsHelper::Copy(publishedMemory, value, size);
+        publishedTime = now;
+        publishedMux.FastUnLock();
+    }
+    return ok;
+}
+
+/*lint -e{746} -e{1055} -e{534} -e{516} open62541 functions.*/
+UA_StatusCode OPCUANode::GetPublishedValue(UA_DataValue &value,
+                                           const bool includeSourceTimeStamp,
+                                           const UA_NumericRange *const range) {
+    UA_StatusCode code = 0x80030000U; /* UA_STATUSCODE_BADINTERNALERROR */
+    if (publishedMemory != NULL_PTR(void *)) {
+        /* The variant only references the published buffer, it is copied to the DataValue below */
+        UA_Variant published;
+        UA_Variant_init(&published);
+        if (publishedNElements > 0u) {
+            UA_Variant_setArray(&published, publishedMemory, static_cast<osulong>(publishedNElements), publishedType);
+        }
+        else {
+            UA_Variant_setScalar(&published, publishedMemory, publishedType);
+        }
+        (void) publishedMux.FastLock();
+        if (range != NULL_PTR(const UA_NumericRange *)) {
+            code = UA_Variant_copyRange(&published, &value.value, *range);
+        }
+        else {
+            code = UA_Variant_copy(&published, &value.value);
+        }
+        UA_DateTime sourceTime = publishedTime;
+        publishedMux.FastUnLock();
+        if (code == 0x00U) { /* UA_STATUSCODE_GOOD */
+            /*lint -e{1013} -e{63} -e{40} members of struct UA_DataValue.*/
+            value.hasValue = true;
+            if (includeSourceTimeStamp) {
+                value.sourceTimestamp = sourceTime;
+                /*lint -e{1013} -e{63} -e{40} members of struct UA_DataValue.*/
+                value.hasSourceTimestamp = true;
+            }
+        }
+    }
+    return code;
+}
+
+uint32 OPCUANode::GetPublishedSize() const {
+    return publishedSize;
+}
+
 CLASS_REGISTER(OPCUANode, "");
 
 }
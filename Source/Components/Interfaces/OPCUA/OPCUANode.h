@@ -35,6 +35,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "ConfigurationDatabase.h"
+#include "FastPollingMutexSem.h"
 #include "ObjectRegistryDatabase.h"
 #include "OPCUAReferenceContainer.h"
 #include "ReferenceContainer.h"
@@ -48,7 +49,11 @@ namespace MARTe {
 
 /**
  * @brief Class that manages the OPCUA Node structure
- * @details The class inherit from OPCUAReferenceContainer and implements the GetOPCVariable method
+ * @details The class inherit from OPCUAReferenceContainer and implements the GetOPCVariable method.
+ *
+ * When the OPCUAServer PublishMode is "DataSource" the value of the node is held in a published buffer: it is written by a MARTe
+ * thread with SetPublishedValue and read by the OPCUA Server thread (through a UA_DataSource callback) with GetPublishedValue,
+ * each only holding a spinlock for the time of a memory copy.
  */
 class OPCUANode: public OPCUAReferenceContainer {
 public:
@@ -79,6 +84,41 @@ public:
      */
     virtual bool IsNode();
 
+    /**
+     * @brief Allocates the published buffer of the node.
+     * @param[in] initialValue the initial value of the node (which also defines the data type and the number of elements).
+     * @return true if the data type is known and the memory is allocated.
+     */
+    bool InitPublishedValue(const UA_Variant &initialValue);
+
+    /**
+     * @brief Copies a new value in the published buffer.
+     * @details Called by MARTe threads. The source timestamp of the value is also updated.
+     * @param[in] value the new value.
+     * @param[in] size the size of \a value in bytes. Shall be equal to GetPublishedSize.
+     * @return true if the published buffer exists and \a size is correct.
+     */
+    bool SetPublishedValue(const void *const value,
+                           const uint32 size);
+
+    /**
+     * @brief Copies the published buffer in an OPCUA DataValue.
+     * @details Called by the OPCUA Server thread when the value is read (or sampled for a MonitoredItem).
+     * @param[out] value the DataValue.
+     * @param[in] includeSourceTimeStamp if true the source timestamp is also set.
+     * @param[in] range the index range requested (NULL for the full value).
+     * @return the OPCUA status code of the copy.
+     */
+    UA_StatusCode GetPublishedValue(UA_DataValue &value,
+                                    const bool includeSourceTimeStamp,
+                                    const UA_NumericRange *const range);
+
+    /**
+     * @brief Gets the size of the published buffer.
+     * @return the size of the published buffer in bytes (0 if it was not allocated).
+     */
+    uint32 GetPublishedSize() const;
+
 private:
 
     /**
@@ -95,6 +135,36 @@ private:
      */
     uint32 parentReferenceNodeId;
 
+    /**
+     * The published buffer.
+     */
+    void *publishedMemory;
+
+    /**
+     * The size of the published buffer in bytes.
+     */
+    uint32 publishedSize;
+
+    /**
+     * The OPCUA data type of the published value.
+     */
+    const UA_DataType *publishedType;
+
+    /**
+     * The number of elements of the published value (0 for a scalar).
+     */
+    uint32 publishedNElements;
+
+    /**
+     * The source timestamp of the published value.
+     */
+    UA_DateTime publishedTime;
+
+    /**
+     * Protects the published buffer.
+     */
+    FastPollingMutexSem publishedMux;
+
 };
 
 }
@@ -36,6 +36,30 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief UA_DataSource read callback of the nodes published with PublishMode = "DataSource".
+ * @details The nodeContext is the OPCUANode which holds the published buffer.
+ */
+/*lint -e{715} -e{818} server, sessionId, sessionContext and nodeId are not needed as the node is the nodeContext. Signature defined by open62541.*/
+static UA_StatusCode OPCUAServerReadPublishedValue(UA_Server *server,
+                                                   const UA_NodeId *sessionId,
+                                                   void *sessionContext,
+                                                   const UA_NodeId *nodeId,
+                                                   void *nodeContext,
+                                                   UA_Boolean includeSourceTimeStamp,
+                                                   const UA_NumericRange *range,
+                                                   UA_DataValue *value) {
+    UA_StatusCode code = 0x80030000U; /* UA_STATUSCODE_BADINTERNALERROR */
+    OPCUANode *node = static_cast<OPCUANode *>(nodeContext);
+    if ((node != NULL_PTR(OPCUANode *)) && (value != NULL_PTR(UA_DataValue *))) {
+        code = node->GetPublishedValue(*value, includeSourceTimeStamp, range);
+    }
+    return code;
+}
+
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -55,6 +79,7 @@ OPCUAServer::OPCUAServer() :
     cpuMask = 0xffu;
     stackSize = THREADS_DEFAULT_STACKSIZE;
     nodeNumber = 3000u;
+    publishMode = "Variable";
 }
 /*lint -e{1551} No exception thrown.*/
 /*lint -e{1579} opcuaConfig and opcuaServer haven't been freed by any function before.*/
@@ -92,6 +117,18 @@ bool OPCUAServer::Initialise(StructuredDataI &data) {
             ok = true;
         }
     }
+    if (ok) {
+        ok = data.Read("PublishMode", publishMode);
+        if (!ok) {
+            publishMode = "Variable";
+            REPORT_ERROR(ErrorManagement::Information, "No PublishMode defined. It will be Variable.");
+            ok = true;
+        }
+        ok = ((publishMode == "Variable") || (publishMode == "DataSource"));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "PublishMode shall be Variable or DataSource");
+        }
+    }
     if (ok) {
         /*lint -e{118} no argument needed*/
         opcuaServer = UA_Server_new();
@@ -140,13 +177,12 @@ ErrorManagement::ErrorType OPCUAServer::Execute(ExecutionInfo & info) {
                     ReferenceT<OPCUAObject> mainObject("OPCUAObject", GlobalObjectsDatabase::Instance()->GetStandardHeap());
                     mainObject->SetName(cdb.GetChildName(i));
                     mainObject->SetFirst(true);
-                    const Introspection *intro = cri->GetIntrospection();
-                    ok = (intro != NULL_PTR(const Introspection *));
+                    ok = InsertStructure(mainObject, typeStr.Buffer());
                     if (ok) {
-                        ok = GetStructure(mainObject, intro);
-                        if (ok) {
-                            ok = InitAddressSpace(mainObject);
-                        }
+                        ok = InitAddressSpace(mainObject);
+                    }
+                    if ((ok) && (publishMode == "DataSource")) {
+                        ok = addressSpace.Insert(mainObject);
                     }
                 }
                 else {
@@ -164,6 +200,9 @@ ErrorManagement::ErrorType OPCUAServer::Execute(ExecutionInfo & info) {
                         REPORT_ERROR(ErrorManagement::Information, "Number Of Elements = %d", nElem);
                     }
                     ok = InitAddressSpace(mainNode);
+                    if ((ok) && (publishMode == "DataSource")) {
+                        ok = addressSpace.Insert(mainNode);
+                    }
                     if (ok) {
                         ok = cdb.MoveToAncestor(1u);
                     }
@@ -175,6 +214,8 @@ ErrorManagement::ErrorType OPCUAServer::Execute(ExecutionInfo & info) {
             }
             typeStr = "";
         }
+        /* The nodes are now owned by the server */
+        typeTemplates.Purge();
         if (ok) {
             SetRunning(true);
         }
@@ -234,10 +275,31 @@ bool OPCUAServer::InitAddressSpace(ReferenceT<OPCUAReferenceContainer> ref) {
         TypeDescriptor typeName = ref->GetNodeType();
         OPCUA::OPCUANodeSettings settings = new OPCUA::NodeProperties;
         ok = ref->GetOPCVariable(settings, typeName, nodeNumber);
+        OPCUANode *publishedNode = NULL_PTR(OPCUANode *);
+        UA_DataSource dataSource;
+        dataSource.read = &OPCUAServerReadPublishedValue;
+        dataSource.write = NULL_PTR(UA_StatusCode (*)(UA_Server *, const UA_NodeId *, void *, const UA_NodeId *, void *, const UA_NumericRange *, const UA_DataValue *));
+        if ((ok) && (publishMode == "DataSource")) {
+            ReferenceT<OPCUANode> node = ref;
+            ok = node.IsValid();
+            if (ok) {
+                publishedNode = node.operator->();
+                ok = publishedNode->InitPublishedValue(settings->attr.value);
+            }
+            /* The value is only written by MARTe */
+            settings->attr.accessLevel = 0x1u; /* UA_ACCESSLEVELMASK_READ */
+        }
         do {
             if (ok) {
-                code = UA_Server_addVariableNode(opcuaServer, settings->nodeId, settings->parentNodeId, settings->parentReferenceNodeId, settings->nodeName,
-                                                 UA_NODEID_NUMERIC(0u, 63u), settings->attr, NULL_PTR(void *), NULL_PTR(UA_NodeId *)); /* UA_NS0ID_BASEDATAVARIABLETYPE = 63 */
+                if (publishedNode != NULL_PTR(OPCUANode *)) {
+                    code = UA_Server_addDataSourceVariableNode(opcuaServer, settings->nodeId, settings->parentNodeId, settings->parentReferenceNodeId,
+                                                               settings->nodeName, UA_NODEID_NUMERIC(0u, 63u), settings->attr, dataSource, publishedNode,
+                                                               NULL_PTR(UA_NodeId *)); /* UA_NS0ID_BASEDATAVARIABLETYPE = 63 */
+                }
+                else {
+                    code = UA_Server_addVariableNode(opcuaServer, settings->nodeId, settings->parentNodeId, settings->parentReferenceNodeId, settings->nodeName,
+                                                     UA_NODEID_NUMERIC(0u, 63u), settings->attr, NULL_PTR(void *), NULL_PTR(UA_NodeId *)); /* UA_NS0ID_BASEDATAVARIABLETYPE = 63 */
+                }
             }
             if (code == 0x805E0000U) { /* UA_STATUSCODE_BADNODEIDEXISTS */
                 nodeNumber++;
@@ -245,7 +307,7 @@ bool OPCUAServer::InitAddressSpace(ReferenceT<OPCUAReferenceContainer> ref) {
                 settings->nodeId = UA_NODEID_NUMERIC(1u, nodeNumber);
             }
         }
-        while (code != 0x00U); /* UA_STATUSCODE_GOOD */
+        while ((ok) && (code != 0x00U)); /* UA_STATUSCODE_GOOD */
         delete settings;
     }
     else {
@@ -282,11 +344,7 @@ bool OPCUAServer::GetStructure(ReferenceT<OPCUAReferenceContainer> refContainer,
             node->SetName(memberName);
             ok = refContainer->Insert(node);
             if (ok) {
-                const ClassRegistryItem *cri = ClassRegistryDatabase::Instance()->Find(memberTypeName);
-                ok = (cri != NULL_PTR(const ClassRegistryItem *));
-                if (ok) {
-                    ok = GetStructure(node, cri->GetIntrospection());
-                }
+                ok = InsertStructure(node, memberTypeName);
             }
         }
         else {
@@ -313,6 +371,48 @@ bool OPCUAServer::GetStructure(ReferenceT<OPCUAReferenceContainer> refContainer,
     return ok;
 }
 
+bool OPCUAServer::InsertStructure(ReferenceT<OPCUAReferenceContainer> refContainer,
+                                  const char8 * const typeName) {
+    bool ok = true;
+    ReferenceT<OPCUAReferenceContainer> members;
+    if (publishMode == "Variable") {
+        members = typeTemplates.Find(typeName);
+    }
+    if (!members.IsValid()) {
+        const ClassRegistryItem *cri = ClassRegistryDatabase::Instance()->Find(typeName);
+        ok = (cri != NULL_PTR(const ClassRegistryItem *));
+        const Introspection *intro = NULL_PTR(const Introspection *);
+        if (ok) {
+            intro = cri->GetIntrospection();
+            ok = (intro != NULL_PTR(const Introspection *));
+        }
+        if (ok) {
+            if (publishMode == "Variable") {
+                ReferenceT<OPCUAObject> typeMembers("OPCUAObject", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+                typeMembers->SetName(typeName);
+                ok = GetStructure(typeMembers, intro);
+                if (ok) {
+                    ok = typeTemplates.Insert(typeMembers);
+                }
+                if (ok) {
+                    members = typeMembers;
+                }
+            }
+            else {
+                /* Each published variable holds its own value */
+                ok = GetStructure(refContainer, intro);
+            }
+        }
+    }
+    if (members.IsValid()) {
+        uint32 nOfMembers = members->Size();
+        for (uint32 i = 0u; (i < nOfMembers) && (ok); i++) {
+            ok = refContainer->Insert(members->Get(i));
+        }
+    }
+    return ok;
+}
+
 void OPCUAServer::SetRunning(bool const running) {
     opcuaRunning = running;
 }
@@ -333,6 +433,15 @@ const uint16 OPCUAServer::GetPort() const {
     return port;
 }
 
+ReferenceT<OPCUANode> OPCUAServer::GetPublishedNode(const char8 * const path) {
+    ReferenceT<OPCUANode> node;
+    /* The Address Space is constructed by the server thread before setting the running mode */
+    if ((GetRunning()) && (publishMode == "DataSource")) {
+        node = addressSpace.Find(path);
+    }
+    return node;
+}
+
 CLASS_REGISTER(OPCUAServer, "");
 
 }
@@ -62,6 +62,7 @@ namespace MARTe {
  *     Class = OPCUA::OPCUAServer
  *     Port = 4840 //Optional. Default is 4840
  *     CPUMask = 0x4
+ *     PublishMode = "Variable" //Optional. "Variable" or "DataSource". Default is "Variable"
  *     AddressSpace = {
  *         MyNodeStructure1 = {
  *             Type = MyIntrospectionStructure1
@@ -75,6 +76,15 @@ namespace MARTe {
  *         }
  *     }
  * </pre>
+ *
+ * With PublishMode = "DataSource" the variables are OPCUA DataSource nodes whose value is held in a buffer of the OPCUANode.
+ * MARTe threads get the node with GetPublishedNode (once, e.g. at the first cycle) and write the values with OPCUANode::SetPublishedValue,
+ * which only copies the value under a spinlock. The OPCUA Server thread copies the buffer when the node is read, or sampled at the rate
+ * requested by the MonitoredItems of the clients. These nodes are read-only for the clients.
+ *
+ * With PublishMode = "Variable" the nodes which describe the members of each structured type are only built once (from the Introspection
+ * of the type) and shared by all the instances of the type, in the Address Space and in other structures. The server only keeps them while
+ * the Address Space is being constructed.
  */
 class OPCUAServer: public Object, public EmbeddedServiceMethodBinderI {
 public:
@@ -138,6 +148,14 @@ public:
      */
     const uint16 GetPort() const;
 
+    /**
+     * @brief Gets a node published with PublishMode = "DataSource".
+     * @param[in] path the path of the node in the Address Space (e.g. MyNodeStructure1.Member1.Member2).
+     * @return the node or an invalid reference if the PublishMode is not "DataSource", if the Address Space
+     * has not yet been constructed (see GetRunning) or if no variable exists with the given path.
+     */
+    ReferenceT<OPCUANode> GetPublishedNode(const char8 * const path);
+
     /**
      * The thread that manage the OPC UA Server functionalities.
      */
@@ -154,6 +172,16 @@ private:
      */
     bool InitAddressSpace(ReferenceT<OPCUAReferenceContainer> ref);
 
+    /**
+     * Holds the value of the configuration parameter PublishMode
+     */
+    StreamString publishMode;
+
+    /**
+     * The roots of the Address Space (only kept with PublishMode = "DataSource").
+     */
+    ReferenceContainer addressSpace;
+
     /**
      * @brief Read the structure recursively from the configuration file and retrieve all the informations about node types.
      * @param[out] refContainer the OPCUAReferenceContainer which will be the starting point for the recursive function
@@ -162,6 +190,21 @@ private:
      */
     bool GetStructure(ReferenceT<OPCUAReferenceContainer> refContainer, const Introspection * const intro);
 
+    /**
+     * @brief Inserts the nodes of the members of a structured type.
+     * @details With PublishMode = "Variable" the nodes of the members of each type are built once (see GetStructure) and
+     * shared by all the instances of the type (see typeTemplates). With PublishMode = "DataSource" every instance has its own nodes.
+     * @param[out] refContainer the container where the nodes are inserted.
+     * @param[in] typeName the name of the registered structured type.
+     * @return true if the type is registered with an Introspection and its members were loaded correctly.
+     */
+    bool InsertStructure(ReferenceT<OPCUAReferenceContainer> refContainer, const char8 * const typeName);
+
+    /**
+     * The nodes of the members of the structured types, named as the type (only with PublishMode = "Variable", while the Address Space is constructed).
+     */
+    ReferenceContainer typeTemplates;
+
     /**
      * open62541 server object declaration
      */
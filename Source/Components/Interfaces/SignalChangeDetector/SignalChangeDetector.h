@@ -0,0 +1,381 @@
+/**
+ * @file SignalChangeDetector.h
+ * @brief Header file for class SignalChangeDetector
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SignalChangeDetector
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SIGNALCHANGEDETECTOR_H_
+#define SIGNALCHANGEDETECTOR_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Detects which signals of an output DataSource changed since the last cycle.
+ * @details The DataSource registers the address and the size of each of its signals (see Configure) and calls Update once per cycle,
+ * before transmitting. Update compares each signal with the copy taken in the previous call, 64 bits at a time (the loop has no
+ * data dependent branches, so that the compiler is free to vectorise it), and returns the number of signals which changed.
+ * The changed signals can then be queried one by one (IsDirty) or as ranges of contiguous memory (GetDirtyRange), so that a
+ * network DataSource can skip the transmission, or only transmit what changed.
+ *
+ * If fullRefreshPeriod > 0 all the signals are reported as changed every fullRefreshPeriod calls to Update (and on the first call),
+ * so that a late joining (or a lossy) receiver is refreshed even if the signals never change. Invalidate forces the next Update
+ * to report all the signals as changed (e.g. after a transmission failure).
+ *
+ * This class is shared by the output DataSources which implement the OnChange option (e.g. the UDPSender and the SDNPublisher)
+ * and is not thread safe: it is meant to be used by the thread which calls Synchronise.
+ */
+class SignalChangeDetector {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetNumberOfSignals() == 0
+     */
+    inline SignalChangeDetector();
+
+    /**
+     * @brief Frees the copies of the signals.
+     */
+    inline ~SignalChangeDetector();
+
+    /**
+     * @brief Registers the signals to be compared.
+     * @param[in] numberOfSignalsIn the number of signals.
+     * @param[in] signalAddressesIn the address of each signal. The memory shall remain valid while this object is used.
+     * @param[in] signalSizesIn the size in bytes of each signal.
+     * @param[in] fullRefreshPeriodIn all the signals are reported as changed every fullRefreshPeriodIn calls to Update (0 to disable).
+     * @return true if numberOfSignalsIn > 0 and the signals were not yet registered.
+     */
+    inline bool Configure(const uint32 numberOfSignalsIn,
+                          void * const * const signalAddressesIn,
+                          const uint32 * const signalSizesIn,
+                          const uint32 fullRefreshPeriodIn);
+
+    /**
+     * @brief Compares all the signals with their copy from the previous call and updates the copies of the ones which changed.
+     * @return the number of signals which changed (all of them on the first call, after Invalidate and on each full refresh).
+     */
+    inline uint32 Update();
+
+    /**
+     * @brief Forces the next Update to report all the signals as changed.
+     */
+    inline void Invalidate();
+
+    /**
+     * @brief Returns true if the signal \a signalIdx changed in the last Update.
+     */
+    inline bool IsDirty(const uint32 signalIdx) const;
+
+    /**
+     * @brief Gets the number of ranges of contiguous memory which changed in the last Update.
+     * @details Two changed signals belong to the same range if the second immediately follows the first in memory.
+     */
+    inline uint32 GetNumberOfDirtyRanges() const;
+
+    /**
+     * @brief Gets the range \a rangeIdx of contiguous memory which changed in the last Update.
+     * @param[in] rangeIdx the index of the range (< GetNumberOfDirtyRanges()).
+     * @param[out] firstSignalIdx the index of the first signal of the range.
+     * @param[out] address the address of the first byte of the range.
+     * @param[out] size the number of bytes of the range.
+     * @return true if rangeIdx < GetNumberOfDirtyRanges().
+     */
+    inline bool GetDirtyRange(const uint32 rangeIdx,
+                              uint32 &firstSignalIdx,
+                              void *&address,
+                              uint32 &size) const;
+
+    /**
+     * @brief Gets the number of registered signals.
+     */
+    inline uint32 GetNumberOfSignals() const;
+
+    /**
+     * @brief Compares two memory areas 64 bits at a time.
+     * @return true if the areas are different.
+     */
+    static inline bool Differs(const uint8 * const current,
+                               const uint8 * const previous,
+                               const uint32 size);
+
+private:
+
+    /**
+     * The number of signals.
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * The address of each signal.
+     */
+    uint8 **signalAddresses;
+
+    /**
+     * The size of each signal.
+     */
+    uint32 *signalSizes;
+
+    /**
+     * The offset of the copy of each signal in previous.
+     */
+    uint32 *previousOffsets;
+
+    /**
+     * The copies of all the signals (8 bytes aligned).
+     */
+    uint64 *previous;
+
+    /**
+     * True if the signal changed in the last Update.
+     */
+    bool *dirty;
+
+    /**
+     * The first signal of each dirty range.
+     */
+    uint32 *rangeFirstSignal;
+
+    /**
+     * The size of each dirty range.
+     */
+    uint32 *rangeSize;
+
+    /**
+     * The number of dirty ranges.
+     */
+    uint32 numberOfRanges;
+
+    /**
+     * All the signals are reported as changed every fullRefreshPeriod calls to Update.
+     */
+    uint32 fullRefreshPeriod;
+
+    /**
+     * The number of calls to Update since the last full refresh.
+     */
+    uint32 cyclesSinceRefresh;
+
+    /**
+     * True if the next Update shall report all the signals as changed.
+     */
+    bool invalid;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+SignalChangeDetector::SignalChangeDetector() {
+    numberOfSignals = 0u;
+    signalAddresses = NULL_PTR(uint8 **);
+    signalSizes = NULL_PTR(uint32 *);
+    previousOffsets = NULL_PTR(uint32 *);
+    previous = NULL_PTR(uint64 *);
+    dirty = NULL_PTR(bool *);
+    rangeFirstSignal = NULL_PTR(uint32 *);
+    rangeSize = NULL_PTR(uint32 *);
+    numberOfRanges = 0u;
+    fullRefreshPeriod = 0u;
+    cyclesSinceRefresh = 0u;
+    invalid = true;
+}
+
+SignalChangeDetector::~SignalChangeDetector() {
+    if (signalAddresses != NULL_PTR(uint8 **)) {
+        delete[] signalAddresses;
+    }
+    if (signalSizes != NULL_PTR(uint32 *)) {
+        delete[] signalSizes;
+    }
+    if (previousOffsets != NULL_PTR(uint32 *)) {
+        delete[] previousOffsets;
+    }
+    if (previous != NULL_PTR(uint64 *)) {
+        delete[] previous;
+    }
+    if (dirty != NULL_PTR(bool *)) {
+        delete[] dirty;
+    }
+    if (rangeFirstSignal != NULL_PTR(uint32 *)) {
+        delete[] rangeFirstSignal;
+    }
+    if (rangeSize != NULL_PTR(uint32 *)) {
+        delete[] rangeSize;
+    }
+}
+
+bool SignalChangeDetector::Configure(const uint32 numberOfSignalsIn,
+                                     void * const * const signalAddressesIn,
+                                     const uint32 * const signalSizesIn,
+                                     const uint32 fullRefreshPeriodIn) {
+    bool ok = (numberOfSignals == 0u) && (numberOfSignalsIn > 0u);
+    if (ok) {
+        numberOfSignals = numberOfSignalsIn;
+        fullRefreshPeriod = fullRefreshPeriodIn;
+        signalAddresses = new uint8*[numberOfSignals];
+        signalSizes = new uint32[numberOfSignals];
+        previousOffsets = new uint32[numberOfSignals];
+        dirty = new bool[numberOfSignals];
+        rangeFirstSignal = new uint32[numberOfSignals];
+        rangeSize = new uint32[numberOfSignals];
+        uint32 previousWords = 0u;
+        for (uint32 n = 0u; n < numberOfSignals; n++) {
+            signalAddresses[n] = static_cast<uint8 *>(signalAddressesIn[n]);
+            signalSizes[n] = signalSizesIn[n];
+            //Each copy starts on a 64 bit boundary
+            previousOffsets[n] = previousWords * 8u;
+            previousWords += ((signalSizes[n] + 7u) / 8u);
+            dirty[n] = true;
+        }
+        previous = new uint64[(previousWords > 0u) ? (previousWords) : (1u)];
+        invalid = true;
+    }
+    return ok;
+}
+
+bool SignalChangeDetector::Differs(const uint8 * const current,
+                                   const uint8 * const previous,
+                                   const uint32 size) {
+    //Blocks of 64 bytes are compared without branches and the comparison stops at the first block which differs
+    const uint32 blockSize = 64u;
+    uint64 diff = 0u;
+    uint32 i = 0u;
+    while (((i + blockSize) <= size) && (diff == 0u)) {
+        for (uint32 w = 0u; w < blockSize; w += 8u) {
+            uint64 a;
+            uint64 b;
+            //The signals are not necessarily aligned: the copies are optimised into unaligned loads
+            (void) MemoryOperationsHelper::Copy(&a, &current[i + w], 8u);
+            (void) MemoryOperationsHelper::Copy(&b, &previous[i + w], 8u);
+            diff |= (a ^ b);
+        }
+        i += blockSize;
+    }
+    while (((i + 8u) <= size) && (diff == 0u)) {
+        uint64 a;
+        uint64 b;
+        (void) MemoryOperationsHelper::Copy(&a, &current[i], 8u);
+        (void) MemoryOperationsHelper::Copy(&b, &previous[i], 8u);
+        diff |= (a ^ b);
+        i += 8u;
+    }
+    while ((i < size) && (diff == 0u)) {
+        diff |= static_cast<uint64>(current[i] ^ previous[i]);
+        i++;
+    }
+    return (diff != 0u);
+}
+
+uint32 SignalChangeDetector::Update() {
+    uint32 nOfDirty = 0u;
+    cyclesSinceRefresh++;
+    bool refresh = invalid;
+    if ((fullRefreshPeriod > 0u) && (cyclesSinceRefresh >= fullRefreshPeriod)) {
+        refresh = true;
+    }
+    if (refresh) {
+        cyclesSinceRefresh = 0u;
+        invalid = false;
+    }
+    /*lint -e{927} -e{826} the copies are stored in an array of uint64 to guarantee their alignment*/
+    uint8 *previousBytes = reinterpret_cast<uint8 *>(previous);
+    numberOfRanges = 0u;
+    for (uint32 n = 0u; n < numberOfSignals; n++) {
+        uint8 *copy = &previousBytes[previousOffsets[n]];
+        dirty[n] = refresh;
+        if (!refresh) {
+            dirty[n] = Differs(signalAddresses[n], copy, signalSizes[n]);
+        }
+        if (dirty[n]) {
+            nOfDirty++;
+            (void) MemoryOperationsHelper::Copy(copy, signalAddresses[n], signalSizes[n]);
+            bool merged = false;
+            if (numberOfRanges > 0u) {
+                uint32 last = numberOfRanges - 1u;
+                //Merge with the previous range if the signal immediately follows it in memory
+                merged = ((&signalAddresses[rangeFirstSignal[last]][rangeSize[last]]) == signalAddresses[n]);
+                if (merged) {
+                    rangeSize[last] += signalSizes[n];
+                }
+            }
+            if (!merged) {
+                rangeFirstSignal[numberOfRanges] = n;
+                rangeSize[numberOfRanges] = signalSizes[n];
+                numberOfRanges++;
+            }
+        }
+    }
+    return nOfDirty;
+}
+
+void SignalChangeDetector::Invalidate() {
+    invalid = true;
+}
+
+bool SignalChangeDetector::IsDirty(const uint32 signalIdx) const {
+    bool ret = (signalIdx < numberOfSignals);
+    if (ret) {
+        ret = dirty[signalIdx];
+    }
+    return ret;
+}
+
+uint32 SignalChangeDetector::GetNumberOfDirtyRanges() const {
+    return numberOfRanges;
+}
+
+bool SignalChangeDetector::GetDirtyRange(const uint32 rangeIdx,
+                                         uint32 &firstSignalIdx,
+                                         void *&address,
+                                         uint32 &size) const {
+    bool ok = (rangeIdx < numberOfRanges);
+    if (ok) {
+        firstSignalIdx = rangeFirstSignal[rangeIdx];
+        address = signalAddresses[firstSignalIdx];
+        size = rangeSize[rangeIdx];
+    }
+    return ok;
+}
+
+uint32 SignalChangeDetector::GetNumberOfSignals() const {
+    return numberOfSignals;
+}
+
+}
+
+#endif /* SIGNALCHANGEDETECTOR_H_ */
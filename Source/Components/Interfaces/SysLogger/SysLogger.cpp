@@ -24,105 +24,369 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
 #include <syslog.h>
+#include <time.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
 #include "ErrorInformation.h"
 #include "ErrorType.h"
+#include "MemoryOperationsHelper.h"
+#include "Sleep.h"
 #include "SysLogger.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Room reserved in each datagram for the syslog header (excluding the host name and the ident).
+ */
+static const uint32 SYSLOGGER_HEADER_SIZE = 64u;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
-SysLogger::SysLogger() : Object(), LoggerConsumerI() {
+SysLogger::SysLogger() :
+        Object(),
+        LoggerConsumerI(),
+        EmbeddedServiceMethodBinderI(),
+        executor(*this) {
     ident = "";
+    asynchronous = false;
+    rfc5424 = false;
+    overflowPolicy = SysLoggerDropOldest;
+    sampleRate = 10u;
+    sampleCounter = 0u;
+    queueSize = 256u;
+    messageSize = 1024u;
+    batchSize = 32u;
+    flushPeriod = 10u;
+    queueMemory = NULL_PTR(char8 *);
+    queueLengths = NULL_PTR(uint32 *);
+    queuePriorities = NULL_PTR(int32 *);
+    queueHead = 0u;
+    queueCount = 0u;
+    batchMemory = NULL_PTR(char8 *);
+    batchLengths = NULL_PTR(uint32 *);
+    batchPriorities = NULL_PTR(int32 *);
+    suppressedCount = 0u;
+    reportedSuppressedCount = 0u;
+    sendErrorCount = 0u;
+    socketPath = "/dev/log";
+    socketFd = -1;
+    datagram = NULL_PTR(char8 *);
+    cpuMask = 0u;
+    queueMux.Create();
 }
 
+/*lint -e{1551} the destructor must guarantee that the helper thread is stopped and the queued messages are not lost.*/
 SysLogger::~SysLogger() {
+    if (asynchronous) {
+        if (!executor.Stop()) {
+            if (!executor.Stop()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+            }
+        }
+        if ((queueMemory != NULL_PTR(char8 *)) && (batchMemory != NULL_PTR(char8 *)) && (datagram != NULL_PTR(char8 *))) {
+            uint32 nOfMessages = Dequeue();
+            while (nOfMessages > 0u) {
+                SendBatch(nOfMessages);
+                nOfMessages = Dequeue();
+            }
+            SendBatch(0u);
+        }
+    }
+    if (socketFd >= 0) {
+        (void) close(socketFd);
+    }
+    if (queueMemory != NULL_PTR(char8 *)) {
+        delete[] queueMemory;
+    }
+    if (queueLengths != NULL_PTR(uint32 *)) {
+        delete[] queueLengths;
+    }
+    if (queuePriorities != NULL_PTR(int32 *)) {
+        delete[] queuePriorities;
+    }
+    if (batchMemory != NULL_PTR(char8 *)) {
+        delete[] batchMemory;
+    }
+    if (batchLengths != NULL_PTR(uint32 *)) {
+        delete[] batchLengths;
+    }
+    if (batchPriorities != NULL_PTR(int32 *)) {
+        delete[] batchPriorities;
+    }
+    if (datagram != NULL_PTR(char8 *)) {
+        delete[] datagram;
+    }
+}
+
+int32 SysLogger::GetSyslogPriority(const ErrorManagement::ErrorType &errorType) {
+    int32 syslogErrorCode;
+    if (errorType == ErrorManagement::Information) {
+        syslogErrorCode = LOG_INFO;
+    }
+    else if (errorType == ErrorManagement::Warning) {
+        syslogErrorCode = LOG_WARNING;
+    }
+    else if (errorType == ErrorManagement::FatalError) {
+        syslogErrorCode = LOG_CRIT;
+    }
+    else if (errorType == ErrorManagement::RecoverableError) {
+        syslogErrorCode = LOG_ERR;
+    }
+    else if (errorType == ErrorManagement::Debug) {
+        syslogErrorCode = LOG_DEBUG;
+    }
+    else if (errorType == ErrorManagement::Timeout) {
+        syslogErrorCode = LOG_ERR;
+    }
+    else if (errorType == ErrorManagement::ParametersError) {
+        syslogErrorCode = LOG_CRIT;
+    }
+    else if (errorType == ErrorManagement::CommunicationError) {
+        syslogErrorCode = LOG_CRIT;
+    }
+    else if (errorType == ErrorManagement::NoError) {
+        syslogErrorCode = LOG_INFO;
+    }
+    else if (errorType == ErrorManagement::Completed) {
+        syslogErrorCode = LOG_WARNING;
+    }
+    else if (errorType == ErrorManagement::NotCompleted) {
+        syslogErrorCode = LOG_WARNING;
+    }
+    else if (errorType == ErrorManagement::ErrorAccessDenied) {
+        syslogErrorCode = LOG_ERR;
+    }
+    else if (errorType == ErrorManagement::InitialisationError) {
+        syslogErrorCode = LOG_CRIT;
+    }
+    else if (errorType == ErrorManagement::InternalSetupError) {
+        syslogErrorCode = LOG_CRIT;
+    }
+    else if (errorType == ErrorManagement::OSError) {
+        syslogErrorCode = LOG_CRIT;
+    }
+    else if (errorType == ErrorManagement::IllegalOperation) {
+        syslogErrorCode = LOG_ERR;
+    }
+    else if (errorType == ErrorManagement::ErrorSharing) {
+        syslogErrorCode = LOG_ERR;
+    }
+    else if (errorType == ErrorManagement::Exception) {
+        syslogErrorCode = LOG_CRIT;
+    }
+    else if (errorType == ErrorManagement::UnsupportedFeature) {
+        syslogErrorCode = LOG_CRIT;
+    }
+    else if (errorType == ErrorManagement::SyntaxError) {
+        syslogErrorCode = LOG_CRIT;
+    }
+    else {
+        syslogErrorCode = LOG_CRIT;
+    }
+    return syslogErrorCode;
 }
 
 void SysLogger::ConsumeLogMessage(LoggerPage * const logPage) {
     if (logPage != NULL_PTR(LoggerPage *)) {
-        /*lint -e{9130} -e{9117} the LOG_NDELAY and LOG_USER constants are defined by <syslog.h>*/
-        openlog(ident.Buffer(), LOG_NDELAY, LOG_USER);
-
         StreamString err;
         PrintToStream(logPage, err);
-        ErrorManagement::ErrorType errorType = logPage->errorInfo.header.errorType;
-
-        int32 syslogErrorCode;
-        if (errorType == ErrorManagement::Information) {
-            syslogErrorCode = LOG_INFO;
-        }
-        else if (errorType == ErrorManagement::Warning) {
-            syslogErrorCode = LOG_WARNING;
-        }
-        else if (errorType == ErrorManagement::FatalError) {
-            syslogErrorCode = LOG_CRIT;
-        }
-        else if (errorType == ErrorManagement::RecoverableError) {
-            syslogErrorCode = LOG_ERR;
+        int32 syslogErrorCode = GetSyslogPriority(logPage->errorInfo.header.errorType);
+        if (asynchronous) {
+            Enqueue(err, syslogErrorCode);
         }
-        else if (errorType == ErrorManagement::Debug) {
-            syslogErrorCode = LOG_DEBUG;
-        }
-        else if (errorType == ErrorManagement::Timeout) {
-            syslogErrorCode = LOG_ERR;
-        }
-        else if (errorType == ErrorManagement::ParametersError) {
-            syslogErrorCode = LOG_CRIT;
+        else {
+            /*lint -e{9130} -e{9117} the LOG_NDELAY and LOG_USER constants are defined by <syslog.h>*/
+            openlog(ident.Buffer(), LOG_NDELAY, LOG_USER);
+            syslog(syslogErrorCode, "%s", err.Buffer());
         }
-        else if (errorType == ErrorManagement::CommunicationError) {
-            syslogErrorCode = LOG_CRIT;
+    }
+}
+
+void SysLogger::Enqueue(const StreamString &message,
+                        const int32 priority) {
+    uint32 length = static_cast<uint32>(message.Size());
+    if (length > messageSize) {
+        length = messageSize;
+    }
+    if (queueMux.FastLock() == ErrorManagement::NoError) {
+        bool store = true;
+        if (overflowPolicy == SysLoggerSample) {
+            //Start sampling once the queue is half full so that the queue keeps a representative view of the storm
+            if (queueCount >= (queueSize / 2u)) {
+                sampleCounter++;
+                store = ((sampleCounter % sampleRate) == 0u);
+            }
+            else {
+                sampleCounter = 0u;
+            }
         }
-        else if (errorType == ErrorManagement::NoError) {
-            syslogErrorCode = LOG_INFO;
+        if ((store) && (queueCount == queueSize)) {
+            if (overflowPolicy == SysLoggerDropNewest) {
+                store = false;
+            }
+            else {
+                queueHead = ((queueHead + 1u) % queueSize);
+                queueCount--;
+                suppressedCount++;
+            }
         }
-        else if (errorType == ErrorManagement::Completed) {
-            syslogErrorCode = LOG_WARNING;
+        if (store) {
+            uint32 idx = ((queueHead + queueCount) % queueSize);
+            (void) MemoryOperationsHelper::Copy(&queueMemory[idx * messageSize], message.Buffer(), length);
+            queueLengths[idx] = length;
+            queuePriorities[idx] = priority;
+            queueCount++;
         }
-        else if (errorType == ErrorManagement::NotCompleted) {
-            syslogErrorCode = LOG_WARNING;
+        else {
+            suppressedCount++;
         }
-        else if (errorType == ErrorManagement::ErrorAccessDenied) {
-            syslogErrorCode = LOG_ERR;
+        queueMux.FastUnLock();
+    }
+}
+
+uint32 SysLogger::Dequeue() {
+    uint32 nOfMessages = 0u;
+    if (queueMux.FastLock() == ErrorManagement::NoError) {
+        while ((queueCount > 0u) && (nOfMessages < batchSize)) {
+            (void) MemoryOperationsHelper::Copy(&batchMemory[nOfMessages * messageSize], &queueMemory[queueHead * messageSize],
+                                                queueLengths[queueHead]);
+            batchLengths[nOfMessages] = queueLengths[queueHead];
+            batchPriorities[nOfMessages] = queuePriorities[queueHead];
+            queueHead = ((queueHead + 1u) % queueSize);
+            queueCount--;
+            nOfMessages++;
         }
-        else if (errorType == ErrorManagement::InitialisationError) {
-            syslogErrorCode = LOG_CRIT;
+        queueMux.FastUnLock();
+    }
+    return nOfMessages;
+}
+
+bool SysLogger::Connect() {
+    if (socketFd < 0) {
+        socketFd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    }
+    bool ok = (socketFd >= 0);
+    if (ok) {
+        struct sockaddr_un address;
+        (void) memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        (void) strncpy(&address.sun_path[0], socketPath.Buffer(), sizeof(address.sun_path) - 1u);
+        /*lint -e{740} -e{929} sockaddr_un is a sockaddr*/
+        ok = (connect(socketFd, reinterpret_cast<struct sockaddr *>(&address), static_cast<socklen_t>(sizeof(address))) == 0);
+        if (!ok) {
+            (void) close(socketFd);
+            socketFd = -1;
         }
-        else if (errorType == ErrorManagement::InternalSetupError) {
-            syslogErrorCode = LOG_CRIT;
+    }
+    return ok;
+}
+
+void SysLogger::Send(const char8 * const message,
+                     const uint32 messageLength,
+                     const int32 priority) {
+    if (socketFd >= 0) {
+        /*lint -e{9130} -e{9117} LOG_USER is defined by <syslog.h>*/
+        int32 pri = (LOG_USER | priority);
+        uint32 datagramSize = (messageSize + SYSLOGGER_HEADER_SIZE + static_cast<uint32>(ident.Size()) + static_cast<uint32>(hostName.Size()));
+        struct timeval now;
+        (void) gettimeofday(&now, NULL_PTR(struct timezone *));
+        struct tm nowTm;
+        char8 timeStamp[32];
+        int32 headerSize;
+        if (rfc5424) {
+            (void) gmtime_r(&now.tv_sec, &nowTm);
+            (void) strftime(&timeStamp[0], sizeof(timeStamp), "%Y-%m-%dT%H:%M:%S", &nowTm);
+            headerSize = snprintf(datagram, datagramSize, "<%d>1 %s.%06ldZ %s %s %d - - ", pri, &timeStamp[0], static_cast<long>(now.tv_usec),
+                                  hostName.Buffer(), ident.Buffer(), static_cast<int32>(getpid()));
         }
-        else if (errorType == ErrorManagement::OSError) {
-            syslogErrorCode = LOG_CRIT;
+        else {
+            (void) localtime_r(&now.tv_sec, &nowTm);
+            (void) strftime(&timeStamp[0], sizeof(timeStamp), "%b %e %H:%M:%S", &nowTm);
+            headerSize = snprintf(datagram, datagramSize, "<%d>%s %s[%d]: ", pri, &timeStamp[0], ident.Buffer(), static_cast<int32>(getpid()));
         }
-        else if (errorType == ErrorManagement::IllegalOperation) {
-            syslogErrorCode = LOG_ERR;
+        if (headerSize < 0) {
+            headerSize = 0;
         }
-        else if (errorType == ErrorManagement::ErrorSharing) {
-            syslogErrorCode = LOG_ERR;
+        uint32 totalSize = static_cast<uint32>(headerSize);
+        if (totalSize > (datagramSize - messageLength)) {
+            totalSize = (datagramSize - messageLength);
         }
-        else if (errorType == ErrorManagement::Exception) {
-            syslogErrorCode = LOG_CRIT;
+        (void) MemoryOperationsHelper::Copy(&datagram[totalSize], message, messageLength);
+        totalSize += messageLength;
+        bool ok = (send(socketFd, datagram, static_cast<size_t>(totalSize), MSG_NOSIGNAL) >= 0);
+        if (!ok) {
+            //The syslog daemon may have been restarted: reconnect once and retry
+            if ((errno == ECONNREFUSED) || (errno == ENOTCONN)) {
+                if (Connect()) {
+                    ok = (send(socketFd, datagram, static_cast<size_t>(totalSize), MSG_NOSIGNAL) >= 0);
+                }
+            }
         }
-        else if (errorType == ErrorManagement::UnsupportedFeature) {
-            syslogErrorCode = LOG_CRIT;
+        if (!ok) {
+            sendErrorCount++;
         }
-        else if (errorType == ErrorManagement::SyntaxError) {
-            syslogErrorCode = LOG_CRIT;
+    }
+    else {
+        syslog(priority, "%.*s", static_cast<int32>(messageLength), message);
+    }
+}
+
+void SysLogger::SendBatch(const uint32 nOfMessages) {
+    for (uint32 i = 0u; i < nOfMessages; i++) {
+        Send(&batchMemory[i * messageSize], batchLengths[i], batchPriorities[i]);
+    }
+    uint32 suppressed = 0u;
+    if (queueMux.FastLock() == ErrorManagement::NoError) {
+        suppressed = (suppressedCount - reportedSuppressedCount);
+        reportedSuppressedCount = suppressedCount;
+        queueMux.FastUnLock();
+    }
+    if (suppressed > 0u) {
+        char8 summary[64];
+        int32 summarySize = snprintf(&summary[0], sizeof(summary), "%u messages suppressed", suppressed);
+        if (summarySize > 0) {
+            uint32 summaryLength = static_cast<uint32>(summarySize);
+            if (summaryLength > messageSize) {
+                summaryLength = messageSize;
+            }
+            Send(&summary[0], summaryLength, LOG_WARNING);
         }
-        else {
-            syslogErrorCode = LOG_CRIT;
+    }
+}
+
+ErrorManagement::ErrorType SysLogger::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        uint32 nOfMessages = Dequeue();
+        SendBatch(nOfMessages);
+        if (nOfMessages == 0u) {
+            Sleep::MSec(flushPeriod);
         }
-        syslog(syslogErrorCode, "%s", err.Buffer());
     }
+    return ErrorManagement::NoError;
+}
+
+uint32 SysLogger::GetSuppressedCount() const {
+    return suppressedCount;
+}
+
+uint32 SysLogger::GetSendErrorCount() const {
+    return sendErrorCount;
 }
 
 bool SysLogger::Initialise(StructuredDataI &data) {
@@ -136,6 +400,105 @@ bool SysLogger::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "The Ident shall be specified");
         }
     }
+    if (ok) {
+        uint32 asynchronousIn = 0u;
+        if (!data.Read("Asynchronous", asynchronousIn)) {
+            asynchronousIn = 0u;
+        }
+        asynchronous = (asynchronousIn > 0u);
+    }
+    if ((ok) && (asynchronous)) {
+        if (!data.Read("QueueSize", queueSize)) {
+            queueSize = 256u;
+        }
+        if (!data.Read("MessageSize", messageSize)) {
+            messageSize = 1024u;
+        }
+        if (!data.Read("BatchSize", batchSize)) {
+            batchSize = 32u;
+        }
+        if (!data.Read("FlushPeriod", flushPeriod)) {
+            flushPeriod = 10u;
+        }
+        if (!data.Read("SampleRate", sampleRate)) {
+            sampleRate = 10u;
+        }
+        if (!data.Read("CPUMask", cpuMask)) {
+            cpuMask = 0u;
+        }
+        if (!data.Read("SocketPath", socketPath)) {
+            socketPath = "/dev/log";
+        }
+        ok = ((queueSize > 0u) && (messageSize > 0u) && (batchSize > 0u) && (sampleRate > 0u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "QueueSize, MessageSize, BatchSize and SampleRate shall be > 0");
+        }
+    }
+    if ((ok) && (asynchronous)) {
+        StreamString protocol;
+        if (!data.Read("Protocol", protocol)) {
+            protocol = "RFC3164";
+        }
+        if (protocol == "RFC5424") {
+            rfc5424 = true;
+        }
+        else if (protocol == "RFC3164") {
+            rfc5424 = false;
+        }
+        else {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "Protocol shall be RFC3164 or RFC5424");
+        }
+    }
+    if ((ok) && (asynchronous)) {
+        StreamString policy;
+        if (!data.Read("OverflowPolicy", policy)) {
+            policy = "DropOldest";
+        }
+        if (policy == "DropOldest") {
+            overflowPolicy = SysLoggerDropOldest;
+        }
+        else if (policy == "DropNewest") {
+            overflowPolicy = SysLoggerDropNewest;
+        }
+        else if (policy == "Sample") {
+            overflowPolicy = SysLoggerSample;
+        }
+        else {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "OverflowPolicy shall be DropOldest, DropNewest or Sample");
+        }
+    }
+    if ((ok) && (asynchronous)) {
+        char8 host[256];
+        (void) memset(&host[0], 0, sizeof(host));
+        if (gethostname(&host[0], sizeof(host) - 1u) != 0) {
+            host[0] = '-';
+        }
+        hostName = &host[0];
+        queueMemory = new char8[queueSize * messageSize];
+        queueLengths = new uint32[queueSize];
+        queuePriorities = new int32[queueSize];
+        batchMemory = new char8[batchSize * messageSize];
+        batchLengths = new uint32[batchSize];
+        batchPriorities = new int32[batchSize];
+        datagram = new char8[messageSize + SYSLOGGER_HEADER_SIZE + static_cast<uint32>(ident.Size()) + static_cast<uint32>(hostName.Size())];
+        if (!Connect()) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not connect to %s. The messages will be sent with syslog()", socketPath.Buffer());
+            /*lint -e{9130} -e{9117} the LOG_NDELAY and LOG_USER constants are defined by <syslog.h>*/
+            openlog(ident.Buffer(), LOG_NDELAY, LOG_USER);
+        }
+        executor.SetName(GetName());
+        if (cpuMask > 0u) {
+            executor.SetCPUMask(cpuMask);
+        }
+        //Sending to a slow syslog daemon must never compete with the real-time threads
+        executor.SetPriorityClass(Threads::IdlePriorityClass);
+        ok = (executor.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start the helper thread");
+        }
+    }
     return ok;
 }
 
@@ -31,8 +31,11 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderI.h"
+#include "FastPollingMutexSem.h"
 #include "LoggerConsumerI.h"
 #include "Object.h"
+#include "SingleThreadService.h"
 #include "StreamString.h"
 
 /*---------------------------------------------------------------------------*/
@@ -50,10 +53,26 @@ namespace MARTe {
  *     Format = ItOoFm //Compulsory. As described in LoggerConsumerI::LoadPrintPreferences
  *     PrintKeys = 1 //Optional. As described in LoggerConsumerI::LoadPrintPreferences
  *     Ident = myapp //Compulsory. Name of the syslog ident.
+ *     Asynchronous = 1 //Optional, defaults to 0. If 1 the messages are queued and sent by a helper thread.
+ *     QueueSize = 256 //Optional, defaults to 256. Maximum number of queued messages (only if Asynchronous = 1).
+ *     MessageSize = 1024 //Optional, defaults to 1024. Longer messages are truncated (only if Asynchronous = 1).
+ *     BatchSize = 32 //Optional, defaults to 32. Maximum number of messages sent per pass of the helper thread (only if Asynchronous = 1).
+ *     FlushPeriod = 10 //Optional, defaults to 10. Period in ms at which the helper thread polls an empty queue (only if Asynchronous = 1).
+ *     SocketPath = "/dev/log" //Optional, defaults to /dev/log. The local syslog datagram socket (only if Asynchronous = 1).
+ *     Protocol = RFC3164 //Optional, defaults to RFC3164. RFC3164 or RFC5424 (only if Asynchronous = 1).
+ *     OverflowPolicy = DropOldest //Optional, defaults to DropOldest. DropOldest, DropNewest or Sample (only if Asynchronous = 1).
+ *     SampleRate = 10 //Optional, defaults to 10. With OverflowPolicy = Sample, one in SampleRate messages is kept once the queue is half full.
+ *     CPUMask = 0x1 //Optional. CPU affinity of the helper thread (only if Asynchronous = 1).
  * }
  * </pre>
+ *
+ * With Asynchronous = 1 the ConsumeLogMessage never calls syslog(): the formatted message is copied into a bounded queue
+ *  and a helper thread, running with the idle priority class, sends the queued messages in batches over a datagram socket
+ *  which is kept connected to SocketPath. If the socket cannot be connected the helper thread falls back to syslog().
+ * When the queue is full the OverflowPolicy decides which message is discarded. The discarded messages are counted
+ *  (see GetSuppressedCount) and the helper thread sends a "N messages suppressed" warning after each batch where messages were lost.
  */
-class SysLogger: public Object, public LoggerConsumerI {
+class SysLogger: public Object, public LoggerConsumerI, public EmbeddedServiceMethodBinderI {
 public:
     CLASS_REGISTER_DECLARATION()
 
@@ -63,12 +82,12 @@ public:
     SysLogger();
 
     /**
-     * @brief Destructor. Closes the console.NOOP.
+     * @brief Destructor. Stops the helper thread, sends the messages which are still queued and closes the socket.
      */
     virtual ~SysLogger();
 
     /**
-     * @brief Prints the logPage in the console output.
+     * @brief Prints the logPage in the syslog or, if Asynchronous = 1, copies it into the queue.
      * @param logPage the log message to be printed.
      */
     virtual void ConsumeLogMessage(LoggerPage *logPage);
@@ -79,11 +98,218 @@ public:
      * @return true if Object::Initialise returns true and if the compulsory are correctly set..
      */
     virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Callback function for the helper thread (only if Asynchronous = 1).
+     * @details Sends up to BatchSize queued messages and, if any message was discarded since the last batch, a summary warning.
+     *  Sleeps FlushPeriod ms if the queue was empty.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Gets the number of messages discarded by the OverflowPolicy.
+     * @return the number of messages discarded by the OverflowPolicy.
+     */
+    uint32 GetSuppressedCount() const;
+
+    /**
+     * @brief Gets the number of messages which could not be written to the socket.
+     * @return the number of messages which could not be written to the socket.
+     */
+    uint32 GetSendErrorCount() const;
 private:
+    /**
+     * @brief Maps an ErrorManagement::ErrorType to a syslog priority.
+     * @param[in] errorType the error type to map.
+     * @return the syslog priority (LOG_INFO, LOG_WARNING, ...).
+     */
+    static int32 GetSyslogPriority(const ErrorManagement::ErrorType &errorType);
+
+    /**
+     * @brief Copies a message into the queue, applying the OverflowPolicy if the queue is full.
+     * @param[in] message the formatted message.
+     * @param[in] priority the syslog priority of the message.
+     */
+    void Enqueue(const StreamString &message,
+                 const int32 priority);
+
+    /**
+     * @brief Moves up to BatchSize messages from the queue into the batch buffer.
+     * @return the number of messages moved.
+     */
+    uint32 Dequeue();
+
+    /**
+     * @brief Sends one message with the selected Protocol (or with syslog() if the socket is not connected).
+     * @param[in] message the message (not necessarily zero terminated).
+     * @param[in] messageLength the number of bytes in message.
+     * @param[in] priority the syslog priority of the message.
+     */
+    void Send(const char8 * const message,
+              const uint32 messageLength,
+              const int32 priority);
+
+    /**
+     * @brief (Re)connects the socket to SocketPath.
+     * @return true if the socket is connected.
+     */
+    bool Connect();
+
+    /**
+     * @brief Sends the messages in the batch buffer and the suppressed messages summary.
+     * @param[in] nOfMessages the number of messages in the batch buffer.
+     */
+    void SendBatch(const uint32 nOfMessages);
+
+    /**
+     * The supported overflow policies.
+     */
+    enum SysLoggerOverflowPolicy {
+        SysLoggerDropOldest,
+        SysLoggerDropNewest,
+        SysLoggerSample
+    };
+
     /**
      * The syslog ident
      */
     StreamString ident;
+
+    /**
+     * True if the messages are sent by the helper thread.
+     */
+    bool asynchronous;
+
+    /**
+     * True if the RFC5424 format is to be used.
+     */
+    bool rfc5424;
+
+    /**
+     * The overflow policy.
+     */
+    SysLoggerOverflowPolicy overflowPolicy;
+
+    /**
+     * With the Sample policy, one in sampleRate messages is kept once the queue is half full.
+     */
+    uint32 sampleRate;
+
+    /**
+     * Counts the messages offered while sampling.
+     */
+    uint32 sampleCounter;
+
+    /**
+     * Maximum number of queued messages.
+     */
+    uint32 queueSize;
+
+    /**
+     * Maximum size of each message.
+     */
+    uint32 messageSize;
+
+    /**
+     * Maximum number of messages sent per pass of the helper thread.
+     */
+    uint32 batchSize;
+
+    /**
+     * Sleep period of the helper thread when the queue is empty.
+     */
+    uint32 flushPeriod;
+
+    /**
+     * Messages storage (queueSize * messageSize).
+     */
+    char8 *queueMemory;
+
+    /**
+     * Length of each queued message.
+     */
+    uint32 *queueLengths;
+
+    /**
+     * Priority of each queued message.
+     */
+    int32 *queuePriorities;
+
+    /**
+     * Index of the oldest queued message.
+     */
+    uint32 queueHead;
+
+    /**
+     * Number of queued messages.
+     */
+    uint32 queueCount;
+
+    /**
+     * Protects the queue indexes. Only held while copying messages in and out of the queue.
+     */
+    FastPollingMutexSem queueMux;
+
+    /**
+     * Messages being sent by the helper thread (batchSize * messageSize).
+     */
+    char8 *batchMemory;
+
+    /**
+     * Length of each message in the batch buffer.
+     */
+    uint32 *batchLengths;
+
+    /**
+     * Priority of each message in the batch buffer.
+     */
+    int32 *batchPriorities;
+
+    /**
+     * Number of messages discarded by the overflow policy (protected by the queueMux).
+     */
+    uint32 suppressedCount;
+
+    /**
+     * Number of discarded messages already reported by the helper thread.
+     */
+    uint32 reportedSuppressedCount;
+
+    /**
+     * Number of messages which could not be written to the socket.
+     */
+    uint32 sendErrorCount;
+
+    /**
+     * The syslog datagram socket path.
+     */
+    StreamString socketPath;
+
+    /**
+     * The persistent datagram socket.
+     */
+    int32 socketFd;
+
+    /**
+     * The host name (RFC5424 only).
+     */
+    StreamString hostName;
+
+    /**
+     * Buffer where each datagram is assembled (messageSize + header).
+     */
+    char8 *datagram;
+
+    /**
+     * The CPU mask of the helper thread.
+     */
+    uint32 cpuMask;
+
+    /**
+     * The helper thread.
+     */
+    SingleThreadService executor;
 };
 }
 
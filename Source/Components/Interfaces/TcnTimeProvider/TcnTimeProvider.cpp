@@ -50,6 +50,16 @@ TcnTimeProvider::TcnTimeProvider() : TimeProvider() {
     tolerance = TCNTIMEPROVIDER_DEFAULT_TOLERANCE;
     CounterProvider = &TcnTimeProvider::TCNCounter;
     BusySleepProvider = &TcnTimeProvider::NullDelegate;
+    resyncHRTTicks = 0u;
+    maxDrift = 0u;
+    cacheHRTReference = 0u;
+    cacheTCNReference = 0u;
+    cacheTicksRatio = 1.0;
+    cacheLastCounter = 0u;
+    resyncCount = 0u;
+    observedMaxDrift = 0u;
+    driftViolationCount = 0u;
+    cacheMux.Create();
 }
 
 TcnTimeProvider::~TcnTimeProvider() {
@@ -175,9 +185,42 @@ bool TcnTimeProvider::InnerInitialize(StructuredDataI &data) {
             }
         }
     }
+
+    if(ret) {
+        InitialiseCache(data);
+    }
     return ret;  
 }
 
+void TcnTimeProvider::InitialiseCache(StructuredDataI &data) {
+    uint8 cached = 0u;
+    if (!data.Read("Cached", cached)) {
+        cached = 0u;
+    }
+    if (cached > 0u) {
+        if (CounterProvider == &TcnTimeProvider::HRTCounter) {
+            REPORT_ERROR(ErrorManagement::Warning, "Cached parameter ignored, the Counter() is already backed by the HighResolutionTimer");
+        }
+        else {
+            uint32 resyncPeriod = 0u;
+            if (!data.Read("ResyncPeriod", resyncPeriod)) {
+                resyncPeriod = TCNTIMEPROVIDER_DEFAULT_RESYNC_PERIOD;
+            }
+            if (!data.Read("MaxDrift", maxDrift)) {
+                maxDrift = 0u;
+            }
+            resyncHRTTicks = static_cast<uint64>((static_cast<float64>(resyncPeriod) * 1e-6) * static_cast<float64>(HighResolutionTimer::Frequency()));
+            //Nominal ratio until the first interval has been measured
+            cacheTicksRatio = static_cast<float64>(tcnFrequency) / static_cast<float64>(HighResolutionTimer::Frequency());
+            cacheHRTReference = 0u;
+            cacheTCNReference = 0u;
+            cacheLastCounter = 0u;
+            CounterProvider = &TcnTimeProvider::CachedTCNCounter;
+            REPORT_ERROR(ErrorManagement::Information, "Cached counter enabled, tcn_get_time read every %d us", resyncPeriod);
+        }
+    }
+}
+
 bool TcnTimeProvider::Initialise(StructuredDataI &data) {
     bool ret = Object::Initialise(data);
     
@@ -238,6 +281,55 @@ uint64 TcnTimeProvider::TCNCounter() const {
     return tcnTime;
 }
 
+uint64 TcnTimeProvider::CachedTCNCounter() const {
+    uint64 counter = 0u;
+    if (cacheMux.FastLock() == ErrorManagement::NoError) {
+        uint64 hrtNow = HighResolutionTimer::Counter();
+        uint64 hrtElapsed = (hrtNow - cacheHRTReference);
+        counter = (cacheTCNReference + static_cast<uint64>(static_cast<float64>(hrtElapsed) * cacheTicksRatio));
+        if ((cacheHRTReference == 0u) || (hrtElapsed >= resyncHRTTicks)) {
+            uint64 tcnNow = TCNCounter();
+            //On failure keep interpolating from the last good read
+            if (tcnNow != 0u) {
+                if ((cacheHRTReference != 0u) && (hrtElapsed > 0u)) {
+                    uint64 drift = (tcnNow > counter) ? (tcnNow - counter) : (counter - tcnNow);
+                    if (drift > observedMaxDrift) {
+                        observedMaxDrift = drift;
+                    }
+                    if ((maxDrift > 0u) && (drift > maxDrift)) {
+                        driftViolationCount++;
+                    }
+                    cacheTicksRatio = (static_cast<float64>(tcnNow - cacheTCNReference) / static_cast<float64>(hrtElapsed));
+                    resyncCount++;
+                }
+                cacheTCNReference = tcnNow;
+                cacheHRTReference = hrtNow;
+                counter = tcnNow;
+            }
+        }
+        if (counter < cacheLastCounter) {
+            counter = cacheLastCounter;
+        }
+        else {
+            cacheLastCounter = counter;
+        }
+        cacheMux.FastUnLock();
+    }
+    return counter;
+}
+
+uint32 TcnTimeProvider::GetResyncCount() {
+    return resyncCount;
+}
+
+uint64 TcnTimeProvider::GetMaxDrift() {
+    return observedMaxDrift;
+}
+
+uint32 TcnTimeProvider::GetDriftViolationCount() {
+    return driftViolationCount;
+}
+
 uint64 TcnTimeProvider::Counter() {
     return (this->*CounterProvider)();
 }
@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "FastPollingMutexSem.h"
 #include "TimeProvider.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -50,6 +51,11 @@ const uint64 TCNTIMEPROVIDER_DEFAULT_FREQUENCY = 1000000000ull;
 */
 const uint32 TCNTIMEPROVIDER_DEFAULT_TOLERANCE = 1000u;
 
+/**
+* @brief Default period (in us) between two TCN reads when the Cached counter is enabled
+*/
+const uint32 TCNTIMEPROVIDER_DEFAULT_RESYNC_PERIOD = 1000u;
+
 /**
 * @brief An interface which implements the TimeProvider generic plugin interface to provide the base primitive for time and sleep source, backed by TCN.
 * @details The interface has essentially two main methods, beside ancillary ones, which can be used to:
@@ -89,9 +95,19 @@ const uint32 TCNTIMEPROVIDER_DEFAULT_TOLERANCE = 1000u;
                                                                 //The TcnPoll parameter presence overrides OperationMode. If both are present, only TcnPoll is considered.
             OperationMode = "[see above supported]"             //Optional, defaults to NoPollLegacyMode.
             Tolerance = 1000                                    //Optional, value in us only valid for HR modes (see above), defaults to 1000us.
+            Cached = 0|1                                        //Optional, defaults to 0. Only valid for the modes where Counter() is backed by tcn_get_time.
+            ResyncPeriod = 1000                                 //Optional, value in us only valid if Cached = 1, defaults to 1000us.
+            MaxDrift = 0                                        //Optional, value in provider ticks only valid if Cached = 1, defaults to 0 (not checked).
 *        }
 * }
 * 
+* Cached counter
+* With Cached = 1 the Counter() reads tcn_get_time at most once every ResyncPeriod us. In between, the TCN time is interpolated from the
+* HighResolutionTimer ticks elapsed since the last read, using the TCN/HighResolutionTimer rate measured between the last two reads.
+* At each read the difference between the interpolated and the TCN time (the drift) is measured: the largest absolute drift, the number of
+* reads (GetResyncCount) and the number of reads whose drift exceeded MaxDrift (GetDriftViolationCount) are exposed for validation.
+* The cached Counter() never goes backwards, i.e. a negative drift is absorbed by holding the counter until the TCN time catches up.
+*
 * Caveats
 * If the TCN initialisation fails, the DataSource immediately fails. Otherwise if an unsupported mode is selected, the Sleep function verbosely fails but the DataSource
 * may keep on running with the TCN library fallback implementation. Specific errors which may be produced from the TCN underlying library are propagated using either the
@@ -152,6 +168,24 @@ class TcnTimeProvider: public TimeProvider {
         */
         virtual bool BackwardCompatibilityInit(StructuredDataI &compatibilityData);
 
+        /**
+        * @brief Gets the number of tcn_get_time reads performed by the Cached counter, after the first one.
+        * @return the number of resynchronisations.
+        */
+        uint32 GetResyncCount();
+
+        /**
+        * @brief Gets the largest absolute difference, in provider ticks, between the interpolated and the TCN time measured at a resynchronisation.
+        * @return the largest absolute drift.
+        */
+        uint64 GetMaxDrift();
+
+        /**
+        * @brief Gets the number of resynchronisations where the absolute drift exceeded MaxDrift.
+        * @return the number of drift violations (always 0 if MaxDrift = 0).
+        */
+        uint32 GetDriftViolationCount();
+
     private:
         /**
         * @brief Holds the provider internal frequency, which in turn is used to compute the period
@@ -184,6 +218,67 @@ class TcnTimeProvider: public TimeProvider {
         */
         uint64 (TcnTimeProvider::*CounterProvider)() const;
 
+        /**
+        * @brief TCN counter source interpolated with the HighResolutionTimer between tcn_get_time reads (Cached = 1).
+        */
+        uint64 CachedTCNCounter() const;
+
+        /**
+        * @brief Reads the Cached, ResyncPeriod and MaxDrift parameters and, if required, selects the CachedTCNCounter.
+        * @param[in] data the configuration data.
+        */
+        void InitialiseCache(StructuredDataI &data);
+
+        /**
+        * @brief Number of HighResolutionTimer ticks between two tcn_get_time reads.
+        */
+        uint64 resyncHRTTicks;
+
+        /**
+        * @brief Maximum accepted absolute drift (0 = not checked).
+        */
+        uint64 maxDrift;
+
+        /**
+        * @brief HighResolutionTimer value at the last tcn_get_time read.
+        */
+        mutable uint64 cacheHRTReference;
+
+        /**
+        * @brief TCN time at the last tcn_get_time read.
+        */
+        mutable uint64 cacheTCNReference;
+
+        /**
+        * @brief TCN ticks per HighResolutionTimer tick, measured between the last two reads.
+        */
+        mutable float64 cacheTicksRatio;
+
+        /**
+        * @brief Last value returned by the cached counter (guarantees monotonicity).
+        */
+        mutable uint64 cacheLastCounter;
+
+        /**
+        * @brief See GetResyncCount.
+        */
+        mutable uint32 resyncCount;
+
+        /**
+        * @brief See GetMaxDrift.
+        */
+        mutable uint64 observedMaxDrift;
+
+        /**
+        * @brief See GetDriftViolationCount.
+        */
+        mutable uint32 driftViolationCount;
+
+        /**
+        * @brief Serialises the cache updates between the threads which query the Counter().
+        */
+        mutable FastPollingMutexSem cacheMux;
+
         bool InnerInitialize(StructuredDataI &data);
 
         /**
@@ -0,0 +1,523 @@
+/**
+ * @file ThreadPlacement.h
+ * @brief Header file for class ThreadPlacement
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ThreadPlacement
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef THREADPLACEMENT_H_
+#define THREADPLACEMENT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BitSet.h"
+#include "CompilerTypes.h"
+#include "ProcessorType.h"
+#include "StreamString.h"
+#include "StructuredDataI.h"
+#include "Threads.h"
+#include "TypeConversion.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The maximum NUMA node which can be selected.
+ */
+const uint32 THREAD_PLACEMENT_MAX_NUMA_NODES = 64u;
+
+/**
+ * @brief Places the helper thread (and the buffers) of a component on a set of CPUs, with a given scheduling priority and close
+ * to a NUMA node.
+ * @details The components that spawn a helper thread (e.g. the FileWriter, the MDSWriter, the UDPReceiver and the LinuxTimer)
+ * historically accept a CPUMask (or CPUs) parameter with slightly different semantics and leave the scheduling priority and the
+ * placement of their memory to the defaults. This class reads an optional ThreadPlacement block, with the same syntax for all the
+ * components, and applies it to the component's SingleThreadService/MultiThreadService and buffers.
+ *
+ * A NearDevice may be given instead of an explicit CPU set and node: the CPUs (local_cpulist) and the NUMA node (numa_node)
+ * are then read from sysfs, so that the thread that services a NIC (or a disk controller) runs on the socket the device is attached to.
+ * Explicit CPUs and NUMANode take precedence over the values derived from the NearDevice.
+ *
+ * Any parameter which is not set keeps the component's own default (e.g. the legacy CPUMask parameter), so that the block
+ * can be added to existing configurations without changing any other parameter.
+ *
+ * The configuration syntax is (names are only given as an example):
+ *
+ * <pre>
+ *    ThreadPlacement = { //Optional.
+ *        CPUs = 0x4 //Optional. The CPU mask of the helper thread. It overrides the component's CPUMask/CPUs.
+ *        NearDevice = "eth0" //Optional. A network interface name (resolved as /sys/class/net/NAME/device) or a sysfs device directory
+ *                            //(e.g. "/sys/block/nvme0n1/device"). The CPUs local to the device are used if CPUs is not set and its
+ *                            //NUMA node is used if NUMANode is not set.
+ *        NUMANode = 0 //Optional but < 64. The NUMA node where the buffers of the component are preferably placed.
+ *        PriorityClass = RealTimePriorityClass //Optional. IdlePriorityClass, NormalPriorityClass or RealTimePriorityClass (SCHED_FIFO).
+ *        PriorityLevel = 10 //Optional. The priority level within the class. Default = 0.
+ *    }
+ * </pre>
+ *
+ * This class is shared by several DataSources and is not thread safe: it is meant to be used while the component is being
+ * initialised and before the helper thread is started.
+ */
+class ThreadPlacement {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   !HasCPUMask() &&
+     *   !HasPriority() &&
+     *   GetNUMANode() == -1
+     */
+    inline ThreadPlacement();
+
+    /**
+     * @brief Reads the ThreadPlacement block (see the class description).
+     * @param[in] data the configuration of the component.
+     * @param[in] nodeName the name of the block.
+     * @return true if the block does not exist or if all its parameters are valid.
+     */
+    inline bool Initialise(StructuredDataI &data,
+                           const char8 * const nodeName = "ThreadPlacement");
+
+    /**
+     * @brief Returns true if a CPU mask was set (explicitly or from the NearDevice).
+     */
+    inline bool HasCPUMask() const;
+
+    /**
+     * @brief Gets the CPU mask.
+     * @pre
+     *   HasCPUMask()
+     */
+    inline ProcessorType GetCPUMask() const;
+
+    /**
+     * @brief Gets the CPU mask as a 64 bit mask (bit n set if the CPU n is allowed).
+     * @pre
+     *   HasCPUMask()
+     */
+    inline uint64 GetCPUBits() const;
+
+    /**
+     * @brief Returns true if a PriorityClass was set.
+     */
+    inline bool HasPriority() const;
+
+    /**
+     * @brief Gets the priority class.
+     */
+    inline Threads::PriorityClassType GetPriorityClass() const;
+
+    /**
+     * @brief Gets the priority level.
+     */
+    inline uint8 GetPriorityLevel() const;
+
+    /**
+     * @brief Gets the NUMA node or -1 if it was not set.
+     */
+    inline int32 GetNUMANode() const;
+
+    /**
+     * @brief Sets the CPU mask and the priority (only the ones that were configured) of a SingleThreadService or a MultiThreadService.
+     * @param[in] service the service to configure. It must not have been started.
+     */
+    template<class ServiceType>
+    void Apply(ServiceType &service) const;
+
+    /**
+     * @brief Sets the CPU mask of \a service to the configured one or to \a defaultMask if no CPU mask was configured,
+     * and sets the configured priority.
+     * @param[in] service the service to configure. It must not have been started.
+     * @param[in] defaultMask the component's own CPU mask.
+     */
+    template<class ServiceType>
+    void Apply(ServiceType &service,
+               const ProcessorType &defaultMask) const;
+
+    /**
+     * @brief Binds the pages fully contained in [memory, memory + size[ to the NUMA node (MPOL_PREFERRED) and moves them if they are
+     * already resident. Does nothing if no NUMA node was set.
+     * @return false if the binding failed (a warning is also reported).
+     */
+    inline bool BindMemory(void * const memory,
+                           const uint64 size) const;
+
+    /**
+     * @brief Pins the calling thread on the (\a index modulo number of CPUs)-th CPU of \a cpus.
+     * @details Used by the components which start several threads with the same mask, to spread them one per CPU.
+     * @param[in] cpus the CPU mask (one bit per CPU). Does nothing if zero.
+     * @param[in] index the index of the calling thread.
+     * @return false if sched_setaffinity failed (a warning is also reported).
+     */
+    static inline bool PinCallingThread(const uint64 cpus,
+                                        const uint32 index);
+
+private:
+
+    /**
+     * @brief Reads the numa_node and the local_cpulist of a sysfs device directory.
+     */
+    inline bool ReadNearDevice(const char8 * const nearDevice);
+
+    /**
+     * @brief Reads the first line of a (sysfs) file.
+     */
+    static inline bool ReadSysFile(const char8 * const path,
+                                   StreamString &line);
+
+    /**
+     * @brief Converts a cpu list (e.g. "0-3,8,10-11") in a mask. CPUs above 63 are ignored.
+     */
+    static inline bool ParseCPUList(const char8 * const list,
+                                    uint64 &mask);
+
+    /**
+     * The configured CPU mask (valid if hasCPUMask).
+     */
+    uint64 cpuMask;
+
+    /**
+     * True if a CPU mask was configured.
+     */
+    bool hasCPUMask;
+
+    /**
+     * The configured priority class (valid if hasPriority).
+     */
+    Threads::PriorityClassType priorityClass;
+
+    /**
+     * The configured priority level.
+     */
+    uint8 priorityLevel;
+
+    /**
+     * True if a priority class was configured.
+     */
+    bool hasPriority;
+
+    /**
+     * The NUMA node or -1.
+     */
+    int32 numaNode;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+ThreadPlacement::ThreadPlacement() {
+    cpuMask = 0ull;
+    hasCPUMask = false;
+    priorityClass = Threads::NormalPriorityClass;
+    priorityLevel = 0u;
+    hasPriority = false;
+    numaNode = -1;
+}
+
+bool ThreadPlacement::Initialise(StructuredDataI &data,
+                                 const char8 * const nodeName) {
+    bool ok = true;
+    if (data.MoveRelative(nodeName)) {
+        StreamString nearDevice;
+        if (data.Read("NearDevice", nearDevice)) {
+            ok = ReadNearDevice(nearDevice.Buffer());
+        }
+        uint64 cpusIn = 0ull;
+        if ((ok) && (data.Read("CPUs", cpusIn))) {
+            cpuMask = cpusIn;
+            hasCPUMask = true;
+        }
+        if (hasCPUMask) {
+            ok = (cpuMask != 0ull);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The ThreadPlacement CPU mask shall not be 0");
+            }
+        }
+        int32 numaNodeIn = 0;
+        if ((ok) && (data.Read("NUMANode", numaNodeIn))) {
+            numaNode = numaNodeIn;
+        }
+        if (ok) {
+            ok = (numaNode < static_cast<int32>(THREAD_PLACEMENT_MAX_NUMA_NODES));
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "NUMANode shall be < %d", THREAD_PLACEMENT_MAX_NUMA_NODES);
+            }
+        }
+        StreamString priorityClassIn;
+        if ((ok) && (data.Read("PriorityClass", priorityClassIn))) {
+            hasPriority = true;
+            if (priorityClassIn == "IdlePriorityClass") {
+                priorityClass = Threads::IdlePriorityClass;
+            }
+            else if (priorityClassIn == "NormalPriorityClass") {
+                priorityClass = Threads::NormalPriorityClass;
+            }
+            else if (priorityClassIn == "RealTimePriorityClass") {
+                priorityClass = Threads::RealTimePriorityClass;
+            }
+            else {
+                ok = false;
+                REPORT_ERROR_STATIC(ErrorManagement::InitialisationError,
+                                    "PriorityClass shall be IdlePriorityClass, NormalPriorityClass or RealTimePriorityClass");
+            }
+        }
+        if (ok) {
+            if (!data.Read("PriorityLevel", priorityLevel)) {
+                priorityLevel = 0u;
+            }
+        }
+        if (!data.MoveToAncestor(1u)) {
+            ok = false;
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not move back from the %s block", nodeName);
+        }
+    }
+    return ok;
+}
+
+bool ThreadPlacement::HasCPUMask() const {
+    return hasCPUMask;
+}
+
+ProcessorType ThreadPlacement::GetCPUMask() const {
+    ProcessorType mask;
+    mask = BitSet(cpuMask);
+    return mask;
+}
+
+uint64 ThreadPlacement::GetCPUBits() const {
+    return cpuMask;
+}
+
+bool ThreadPlacement::HasPriority() const {
+    return hasPriority;
+}
+
+Threads::PriorityClassType ThreadPlacement::GetPriorityClass() const {
+    return priorityClass;
+}
+
+uint8 ThreadPlacement::GetPriorityLevel() const {
+    return priorityLevel;
+}
+
+int32 ThreadPlacement::GetNUMANode() const {
+    return numaNode;
+}
+
+template<class ServiceType>
+void ThreadPlacement::Apply(ServiceType &service) const {
+    if (hasCPUMask) {
+        service.SetCPUMask(GetCPUMask());
+    }
+    if (hasPriority) {
+        service.SetPriorityClass(priorityClass);
+        service.SetPriorityLevel(priorityLevel);
+    }
+}
+
+template<class ServiceType>
+void ThreadPlacement::Apply(ServiceType &service,
+                            const ProcessorType &defaultMask) const {
+    if (!hasCPUMask) {
+        service.SetCPUMask(defaultMask);
+    }
+    Apply(service);
+}
+
+bool ThreadPlacement::BindMemory(void * const memory,
+                                 const uint64 size) const {
+    bool ok = true;
+    if ((numaNode >= 0) && (memory != NULL_PTR(void *)) && (size > 0u)) {
+        //Only the pages fully contained in the buffer can be moved without touching the neighbouring allocations.
+        uintp pageSize = static_cast<uintp>(sysconf(_SC_PAGESIZE));
+        /*lint -e{923} -e{9091} pointer to integer conversion required to compute the page boundaries.*/
+        uintp start = reinterpret_cast<uintp>(memory);
+        uintp alignedStart = ((start + pageSize) - 1u) & ~(pageSize - 1u);
+        uintp alignedEnd = (start + static_cast<uintp>(size)) & ~(pageSize - 1u);
+        if (alignedEnd > alignedStart) {
+            unsigned long nodeMask = (1ul << static_cast<uint32>(numaNode));
+            /*lint -e{923} -e{9091} integer to pointer conversion required by mbind.*/
+            long err = syscall(SYS_mbind, reinterpret_cast<void *>(alignedStart), static_cast<unsigned long>(alignedEnd - alignedStart), MPOL_PREFERRED, &nodeMask,
+                               static_cast<unsigned long>(THREAD_PLACEMENT_MAX_NUMA_NODES + 1u), MPOL_MF_MOVE);
+            ok = (err == 0);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not bind the buffers to the NUMA node %d", numaNode);
+            }
+        }
+    }
+    return ok;
+}
+
+bool ThreadPlacement::PinCallingThread(const uint64 cpus,
+                                       const uint32 index) {
+    bool ok = true;
+    uint32 nOfCPUs = 0u;
+    uint32 cpu;
+    for (cpu = 0u; cpu < 64u; cpu++) {
+        if (((cpus >> cpu) & 1ull) != 0ull) {
+            nOfCPUs++;
+        }
+    }
+    if (nOfCPUs > 0u) {
+        uint32 target = index % nOfCPUs;
+        uint32 found = 0u;
+        for (cpu = 0u; cpu < 64u; cpu++) {
+            if (((cpus >> cpu) & 1ull) != 0ull) {
+                if (found == target) {
+                    cpu_set_t cpuSet;
+                    /*lint -e{1924} -e{9130} CPU_ZERO and CPU_SET are the glibc interface to the affinity mask*/
+                    CPU_ZERO(&cpuSet);
+                    /*lint -e{1924} -e{9130} CPU_ZERO and CPU_SET are the glibc interface to the affinity mask*/
+                    CPU_SET(cpu, &cpuSet);
+                    ok = (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) == 0);
+                    if (!ok) {
+                        REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not pin the thread %u on the CPU %u", index, cpu);
+                    }
+                }
+                found++;
+            }
+        }
+    }
+    return ok;
+}
+
+bool ThreadPlacement::ReadNearDevice(const char8 * const nearDevice) {
+    StreamString deviceDir;
+    if (nearDevice[0] == '/') {
+        deviceDir = nearDevice;
+    }
+    else {
+        (void) deviceDir.Printf("/sys/class/net/%s/device", nearDevice);
+    }
+    StreamString path;
+    StreamString line;
+    (void) path.Printf("%s/numa_node", deviceDir.Buffer());
+    bool ok = ReadSysFile(path.Buffer(), line);
+    if (ok) {
+        int32 node = -1;
+        ok = TypeConvert(node, line);
+        //numa_node is -1 on single node machines (or if the firmware does not tell).
+        if ((ok) && (node >= 0)) {
+            numaNode = node;
+        }
+    }
+    if (ok) {
+        path = "";
+        line = "";
+        (void) path.Printf("%s/local_cpulist", deviceDir.Buffer());
+        ok = ReadSysFile(path.Buffer(), line);
+        if (ok) {
+            ok = ParseCPUList(line.Buffer(), cpuMask);
+        }
+        if (ok) {
+            hasCPUMask = true;
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not read the numa_node and the local_cpulist of the NearDevice %s", deviceDir.Buffer());
+    }
+    return ok;
+}
+
+bool ThreadPlacement::ReadSysFile(const char8 * const path,
+                                  StreamString &line) {
+    int32 fd = open(path, O_RDONLY);
+    bool ok = (fd >= 0);
+    if (ok) {
+        char8 buffer[256];
+        ssize_t nRead = read(fd, &buffer[0], (sizeof(buffer) - 1u));
+        ok = (nRead > 0);
+        if (ok) {
+            buffer[nRead] = '\0';
+            for (ssize_t i = 0; i < nRead; i++) {
+                if ((buffer[i] == '\n') || (buffer[i] == '\r')) {
+                    buffer[i] = '\0';
+                }
+            }
+            line = &buffer[0];
+        }
+        (void) close(fd);
+    }
+    return ok;
+}
+
+bool ThreadPlacement::ParseCPUList(const char8 * const list,
+                                   uint64 &mask) {
+    mask = 0ull;
+    bool ok = true;
+    uint32 i = 0u;
+    while ((ok) && (list[i] != '\0')) {
+        uint32 first = 0u;
+        bool hasDigits = false;
+        while ((list[i] >= '0') && (list[i] <= '9')) {
+            first = (first * 10u) + static_cast<uint32>(list[i] - '0');
+            hasDigits = true;
+            i++;
+        }
+        uint32 last = first;
+        if (list[i] == '-') {
+            i++;
+            last = 0u;
+            hasDigits = false;
+            while ((list[i] >= '0') && (list[i] <= '9')) {
+                last = (last * 10u) + static_cast<uint32>(list[i] - '0');
+                hasDigits = true;
+                i++;
+            }
+        }
+        ok = (hasDigits) && (last >= first);
+        if (ok) {
+            for (uint32 c = first; (c <= last) && (c < 64u); c++) {
+                mask |= (1ull << c);
+            }
+            if (list[i] == ',') {
+                i++;
+            }
+            else {
+                ok = (list[i] == '\0');
+            }
+        }
+    }
+    if (ok) {
+        ok = (mask != 0ull);
+    }
+    return ok;
+}
+
+}
+
+#endif /* THREADPLACEMENT_H_ */
@@ -0,0 +1,395 @@
+/**
+ * @file BenchmarkDataSource.cpp
+ * @brief Source file for class BenchmarkDataSource
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BenchmarkDataSource (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BenchmarkDataSource.h"
+#include "File.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+BenchmarkDataSource::BenchmarkDataSource() :
+        MemoryDataSourceI() {
+    randomState = 1u;
+    generators = NULL_PTR(BenchmarkGenerator *);
+    offsets = NULL_PTR(float64 *);
+    amplitudes = NULL_PTR(float64 *);
+    periods = NULL_PTR(uint64 *);
+    counters = NULL_PTR(uint64 *);
+    replayBuffers = NULL_PTR(char8 **);
+    replaySizes = NULL_PTR(uint64 *);
+    replayPositions = NULL_PTR(uint64 *);
+}
+
+BenchmarkDataSource::~BenchmarkDataSource() {
+    if (replayBuffers != NULL_PTR(char8 **)) {
+        uint32 nOfSignals = GetNumberOfSignals();
+        for (uint32 i = 0u; i < nOfSignals; i++) {
+            if (replayBuffers[i] != NULL_PTR(char8 *)) {
+                delete[] replayBuffers[i];
+            }
+        }
+        delete[] replayBuffers;
+    }
+    if (generators != NULL_PTR(BenchmarkGenerator *)) {
+        delete[] generators;
+    }
+    if (offsets != NULL_PTR(float64 *)) {
+        delete[] offsets;
+    }
+    if (amplitudes != NULL_PTR(float64 *)) {
+        delete[] amplitudes;
+    }
+    if (periods != NULL_PTR(uint64 *)) {
+        delete[] periods;
+    }
+    if (counters != NULL_PTR(uint64 *)) {
+        delete[] counters;
+    }
+    if (replaySizes != NULL_PTR(uint64 *)) {
+        delete[] replaySizes;
+    }
+    if (replayPositions != NULL_PTR(uint64 *)) {
+        delete[] replayPositions;
+    }
+}
+
+bool BenchmarkDataSource::Initialise(StructuredDataI &data) {
+    bool ok = MemoryDataSourceI::Initialise(data);
+    if (ok) {
+        if (!data.Read("Seed", randomState)) {
+            randomState = 1u;
+        }
+        //xorshift requires a non-zero state
+        if (randomState == 0u) {
+            randomState = 1u;
+        }
+        if (data.MoveRelative("Signals")) {
+            ok = data.Copy(signalsInformation);
+            if (ok) {
+                ok = data.MoveToAncestor(1u);
+            }
+        }
+    }
+    return ok;
+}
+
+bool BenchmarkDataSource::SetConfiguredDatabase(StructuredDataI &data) {
+    bool ok = MemoryDataSourceI::SetConfiguredDatabase(data);
+    uint32 nOfSignals = GetNumberOfSignals();
+    if (ok) {
+        generators = new BenchmarkGenerator[nOfSignals];
+        offsets = new float64[nOfSignals];
+        amplitudes = new float64[nOfSignals];
+        periods = new uint64[nOfSignals];
+        counters = new uint64[nOfSignals];
+        replayBuffers = new char8*[nOfSignals];
+        replaySizes = new uint64[nOfSignals];
+        replayPositions = new uint64[nOfSignals];
+    }
+    for (uint32 i = 0u; (i < nOfSignals) && (ok); i++) {
+        generators[i] = BenchmarkGeneratorConstant;
+        offsets[i] = 0.;
+        amplitudes[i] = 1.;
+        periods[i] = 0u;
+        counters[i] = 0u;
+        replayBuffers[i] = NULL_PTR(char8 *);
+        replaySizes[i] = 0u;
+        replayPositions[i] = 0u;
+        ok = ReadGenerator(i);
+    }
+    return ok;
+}
+
+bool BenchmarkDataSource::ReadGenerator(const uint32 signalIdx) {
+    StreamString signalName;
+    bool ok = GetSignalName(signalIdx, signalName);
+    if (ok) {
+        ok = signalsInformation.MoveToRoot();
+    }
+    if (ok) {
+        if (signalsInformation.MoveRelative(signalName.Buffer())) {
+            StreamString generatorName;
+            if (!signalsInformation.Read("Generator", generatorName)) {
+                generatorName = "Constant";
+            }
+            if (generatorName == "Constant") {
+                generators[signalIdx] = BenchmarkGeneratorConstant;
+                if (!signalsInformation.Read("Value", offsets[signalIdx])) {
+                    offsets[signalIdx] = 0.;
+                }
+            }
+            else if (generatorName == "Random") {
+                generators[signalIdx] = BenchmarkGeneratorRandom;
+                if (!signalsInformation.Read("Offset", offsets[signalIdx])) {
+                    offsets[signalIdx] = 0.;
+                }
+                if (!signalsInformation.Read("Amplitude", amplitudes[signalIdx])) {
+                    amplitudes[signalIdx] = 1.;
+                }
+            }
+            else if (generatorName == "Ramp") {
+                generators[signalIdx] = BenchmarkGeneratorRamp;
+                if (!signalsInformation.Read("Offset", offsets[signalIdx])) {
+                    offsets[signalIdx] = 0.;
+                }
+                if (!signalsInformation.Read("Step", amplitudes[signalIdx])) {
+                    amplitudes[signalIdx] = 1.;
+                }
+                if (!signalsInformation.Read("Period", periods[signalIdx])) {
+                    periods[signalIdx] = 0u;
+                }
+            }
+            else if (generatorName == "File") {
+                generators[signalIdx] = BenchmarkGeneratorFile;
+                StreamString fileName;
+                ok = signalsInformation.Read("FileName", fileName);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "FileName shall be specified for the signal %s", signalName.Buffer());
+                }
+                if (ok) {
+                    ok = LoadFile(signalIdx, fileName);
+                }
+            }
+            else {
+                ok = false;
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong Generator for the signal %s (expected values Constant, Random, Ramp or File)",
+                             signalName.Buffer());
+            }
+        }
+    }
+    if (ok) {
+        ok = WriteElement(signalIdx, NULL_PTR(void *), 0u, 0.);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Unsupported type for the signal %s", signalName.Buffer());
+        }
+    }
+    return ok;
+}
+
+bool BenchmarkDataSource::LoadFile(const uint32 signalIdx,
+                                   const StreamString &fileName) {
+    File replayFile;
+    bool ok = replayFile.Open(fileName.Buffer(), BasicFile::ACCESS_MODE_R);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Could not open the file %s", fileName.Buffer());
+    }
+    uint64 fileSize = 0u;
+    if (ok) {
+        fileSize = replayFile.Size();
+        uint64 elementSize = static_cast<uint64>(GetSignalType(signalIdx).numberOfBits) / 8u;
+        ok = (fileSize > 0u);
+        if (ok) {
+            ok = (elementSize > 0u);
+        }
+        if (ok) {
+            ok = ((fileSize % elementSize) == 0u);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The size of the file %s shall be a (non-zero) multiple of the signal element size",
+                         fileName.Buffer());
+        }
+    }
+    if (ok) {
+        replayBuffers[signalIdx] = new char8[fileSize];
+        uint32 readSize = static_cast<uint32>(fileSize);
+        ok = replayFile.Read(replayBuffers[signalIdx], readSize);
+        if (ok) {
+            ok = (static_cast<uint64>(readSize) == fileSize);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Could not read the file %s", fileName.Buffer());
+        }
+    }
+    if (ok) {
+        replaySizes[signalIdx] = fileSize;
+    }
+    if (replayFile.IsOpen()) {
+        (void) replayFile.Close();
+    }
+    return ok;
+}
+
+/*lint -e{613} signalMemory is only NULL when checking the type, in which case it is not dereferenced.*/
+bool BenchmarkDataSource::WriteElement(const uint32 signalIdx,
+                                       void * const signalMemory,
+                                       const uint32 index,
+                                       const float64 value) const {
+    TypeDescriptor signalType = GetSignalType(signalIdx);
+    bool write = (signalMemory != NULL_PTR(void *));
+    bool ok = true;
+    if (signalType == SignedInteger8Bit) {
+        if (write) {
+            static_cast<int8 *>(signalMemory)[index] = static_cast<int8>(value);
+        }
+    }
+    else if (signalType == UnsignedInteger8Bit) {
+        if (write) {
+            static_cast<uint8 *>(signalMemory)[index] = static_cast<uint8>(value);
+        }
+    }
+    else if (signalType == SignedInteger16Bit) {
+        if (write) {
+            static_cast<int16 *>(signalMemory)[index] = static_cast<int16>(value);
+        }
+    }
+    else if (signalType == UnsignedInteger16Bit) {
+        if (write) {
+            static_cast<uint16 *>(signalMemory)[index] = static_cast<uint16>(value);
+        }
+    }
+    else if (signalType == SignedInteger32Bit) {
+        if (write) {
+            static_cast<int32 *>(signalMemory)[index] = static_cast<int32>(value);
+        }
+    }
+    else if (signalType == UnsignedInteger32Bit) {
+        if (write) {
+            static_cast<uint32 *>(signalMemory)[index] = static_cast<uint32>(value);
+        }
+    }
+    else if (signalType == SignedInteger64Bit) {
+        if (write) {
+            static_cast<int64 *>(signalMemory)[index] = static_cast<int64>(value);
+        }
+    }
+    else if (signalType == UnsignedInteger64Bit) {
+        if (write) {
+            static_cast<uint64 *>(signalMemory)[index] = static_cast<uint64>(value);
+        }
+    }
+    else if (signalType == Float32Bit) {
+        if (write) {
+            static_cast<float32 *>(signalMemory)[index] = static_cast<float32>(value);
+        }
+    }
+    else if (signalType == Float64Bit) {
+        if (write) {
+            static_cast<float64 *>(signalMemory)[index] = value;
+        }
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+
+float64 BenchmarkDataSource::NextRandom() {
+    randomState ^= (randomState << 13u);
+    randomState ^= (randomState >> 7u);
+    randomState ^= (randomState << 17u);
+    //53 random bits mapped to [0, 2] and shifted to [-1, 1]
+    float64 value = static_cast<float64>(randomState >> 11u) / 4503599627370496.0;
+    return value - 1.0;
+}
+
+/*lint -e{613} the arrays are allocated in SetConfiguredDatabase, which is always called before the application is executed.*/
+bool BenchmarkDataSource::Generate() {
+    bool ok = true;
+    uint32 nOfSignals = GetNumberOfSignals();
+    for (uint32 i = 0u; (i < nOfSignals) && (ok); i++) {
+        void *signalMemory = NULL_PTR(void *);
+        uint32 byteSize = 0u;
+        ok = GetSignalMemoryBuffer(i, 0u, signalMemory);
+        if (ok) {
+            ok = GetSignalByteSize(i, byteSize);
+        }
+        if (ok) {
+            uint32 elementSize = static_cast<uint32>(GetSignalType(i).numberOfBits) / 8u;
+            uint32 nOfElements = byteSize / elementSize;
+            if (generators[i] == BenchmarkGeneratorConstant) {
+                for (uint32 n = 0u; (n < nOfElements) && (ok); n++) {
+                    ok = WriteElement(i, signalMemory, n, offsets[i]);
+                }
+            }
+            else if (generators[i] == BenchmarkGeneratorRandom) {
+                for (uint32 n = 0u; (n < nOfElements) && (ok); n++) {
+                    ok = WriteElement(i, signalMemory, n, offsets[i] + (amplitudes[i] * NextRandom()));
+                }
+            }
+            else if (generators[i] == BenchmarkGeneratorRamp) {
+                for (uint32 n = 0u; (n < nOfElements) && (ok); n++) {
+                    ok = WriteElement(i, signalMemory, n, offsets[i] + (amplitudes[i] * static_cast<float64>(counters[i])));
+                    counters[i]++;
+                    if ((periods[i] > 0u) && (counters[i] == periods[i])) {
+                        counters[i] = 0u;
+                    }
+                }
+            }
+            else {
+                //File: copy the next byteSize bytes, wrapping around at the end of the file
+                char8 *destination = static_cast<char8 *>(signalMemory);
+                uint64 remaining = static_cast<uint64>(byteSize);
+                while ((remaining > 0u) && (ok)) {
+                    uint64 available = replaySizes[i] - replayPositions[i];
+                    uint64 copySize = (remaining < available) ? (remaining) : (available);
+                    ok = MemoryOperationsHelper::Copy(destination, &replayBuffers[i][replayPositions[i]], static_cast<uint32>(copySize));
+                    destination = &destination[copySize];
+                    remaining -= copySize;
+                    replayPositions[i] += copySize;
+                    if (replayPositions[i] == replaySizes[i]) {
+                        replayPositions[i] = 0u;
+                    }
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+bool BenchmarkDataSource::Synchronise() {
+    return true;
+}
+
+bool BenchmarkDataSource::PrepareNextState(const char8 * const currentStateName,
+                                           const char8 * const nextStateName) {
+    return true;
+}
+
+const char8 *BenchmarkDataSource::GetBrokerName(StructuredDataI &data,
+                                                const SignalDirection direction) {
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == InputSignals) {
+        brokerName = "MemoryMapInputBroker";
+    }
+    return brokerName;
+}
+
+CLASS_REGISTER(BenchmarkDataSource, "1.0")
+
+}
@@ -0,0 +1,234 @@
+/**
+ * @file BenchmarkDataSource.h
+ * @brief Header file for class BenchmarkDataSource
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BenchmarkDataSource
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BENCHMARKDATASOURCE_H_
+#define BENCHMARKDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "MemoryDataSourceI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The synthetic waveforms which can be generated for a signal.
+ */
+enum BenchmarkGenerator {
+    BenchmarkGeneratorConstant,
+    BenchmarkGeneratorRandom,
+    BenchmarkGeneratorRamp,
+    BenchmarkGeneratorFile
+};
+
+/**
+ * @brief Input DataSource which generates synthetic signals for the MainBenchmark.
+ * @details The signals are only generated when Generate is called (i.e. outside of the measured GAM cycles) and are
+ * copied to the GAMs with a MemoryMapInputBroker. Only input signals are supported.
+ *
+ * Each signal may define in the Signals section of the DataSource the following (optional) properties:
+ *  - Generator = Constant (default) with Value (default 0): all the elements are set to Value.
+ *  - Generator = Random with Offset (default 0) and Amplitude (default 1): each element is uniformly distributed in
+ *    [Offset - Amplitude, Offset + Amplitude]. The sequence only depends on the Seed of the DataSource.
+ *  - Generator = Ramp with Offset (default 0), Step (default 1) and Period (default 0): the k-th generated element
+ *    (counted across cycles) is Offset + Step * k, restarting from Offset every Period elements if Period > 0.
+ *  - Generator = File with FileName: the file is read (raw, native endianness) in chunks of the signal byte size,
+ *    restarting from the beginning when its end is reached. Its size shall be a multiple of the signal element size.
+ *
+ * The values are converted (truncated) to the signal type. Signals which are not listed in the Signals section use
+ * Generator = Constant and Value = 0.
+ *
+ * <pre>
+ * +Input = {
+ *     Class = BenchmarkDataSource
+ *     Seed = 1 //Optional. Seed of the Random generator. Default = 1.
+ *     Signals = {
+ *         Probe = {
+ *             Generator = Random
+ *             Amplitude = 10
+ *         }
+ *         Time = {
+ *             Generator = Ramp
+ *             Step = 1000
+ *         }
+ *         Shot = {
+ *             Generator = File
+ *             FileName = "/tmp/shot.bin"
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class BenchmarkDataSource: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    BenchmarkDataSource();
+
+    /**
+     * @brief Destructor. Frees the generator parameters and the replay buffers.
+     */
+    virtual ~BenchmarkDataSource();
+
+    /**
+     * @brief Reads the Seed and stores the Signals section to read the generator properties in SetConfiguredDatabase.
+     * @param[in] data the DataSource configuration.
+     * @return true if MemoryDataSourceI::Initialise succeeds.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Reads the generator properties of each signal and loads the replay files.
+     * @param[in] data the configured database.
+     * @return true if all the generator properties are valid and the replay files could be loaded.
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI &data);
+
+    /**
+     * @brief Generates the next value of all the signals.
+     * @return true if all the signals could be generated.
+     */
+    bool Generate();
+
+    /**
+     * @brief NOOP (the cycles are triggered by calling Generate).
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief NOOP.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief See DataSourceI::GetBrokerName.
+     * @return "MemoryMapInputBroker" for InputSignals, NULL otherwise.
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction);
+
+private:
+
+    /**
+     * @brief Reads the generator properties of a signal from signalsInformation.
+     * @param[in] signalIdx the index of the signal.
+     * @return true if the properties are valid.
+     */
+    bool ReadGenerator(const uint32 signalIdx);
+
+    /**
+     * @brief Loads the replay file of a signal.
+     * @param[in] signalIdx the index of the signal.
+     * @param[in] fileName the name of the file.
+     * @return true if the file could be read and its size is a multiple of the signal element size.
+     */
+    bool LoadFile(const uint32 signalIdx,
+                  const StreamString &fileName);
+
+    /**
+     * @brief Writes a value in an element of a signal, converted to the signal type.
+     * @param[in] signalIdx the index of the signal.
+     * @param[in] signalMemory the memory of the signal.
+     * @param[in] index the index of the element.
+     * @param[in] value the value to write.
+     * @return true if the signal type is supported.
+     */
+    bool WriteElement(const uint32 signalIdx,
+                      void * const signalMemory,
+                      const uint32 index,
+                      const float64 value) const;
+
+    /**
+     * @brief Gets the next number of the Random generator.
+     * @return a number uniformly distributed in [-1, 1].
+     */
+    float64 NextRandom();
+
+    /**
+     * The Signals section of the DataSource configuration.
+     */
+    ConfigurationDatabase signalsInformation;
+
+    /**
+     * The state of the (xorshift64) Random generator.
+     */
+    uint64 randomState;
+
+    /**
+     * The generator of each signal.
+     */
+    BenchmarkGenerator *generators;
+
+    /**
+     * The Value or Offset of each signal.
+     */
+    float64 *offsets;
+
+    /**
+     * The Amplitude or Step of each signal.
+     */
+    float64 *amplitudes;
+
+    /**
+     * The Period of each Ramp signal (0 if the ramp does not restart).
+     */
+    uint64 *periods;
+
+    /**
+     * The number of elements generated for each Ramp signal (modulo the Period).
+     */
+    uint64 *counters;
+
+    /**
+     * The contents of the replay file of each File signal (NULL for the other signals).
+     */
+    char8 **replayBuffers;
+
+    /**
+     * The size and the current read position of each replay buffer.
+     */
+    uint64 *replaySizes;
+    uint64 *replayPositions;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BENCHMARKDATASOURCE_H_ */
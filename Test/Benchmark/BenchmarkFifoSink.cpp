@@ -0,0 +1,264 @@
+/**
+ * @file BenchmarkFifoSink.cpp
+ * @brief Source file for class BenchmarkFifoSink
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BenchmarkFifoSink (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BenchmarkFifoSink.h"
+#include "HighResolutionTimer.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * The maximum number of bytes read at once.
+ */
+const MARTe::uint32 BENCHMARK_FIFO_SINK_CHUNK_SIZE = 65536u;
+
+/**
+ * The size of the pipe buffer (one page).
+ */
+const MARTe::int32 BENCHMARK_FIFO_SINK_PIPE_SIZE = 4096;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+BenchmarkFifoSink::BenchmarkFifoSink() :
+        Object(),
+        EmbeddedServiceMethodBinderI(),
+        executor(*this) {
+    fd = -1;
+    created = false;
+    bytesPerSecond = 0u;
+    headerSize = 0u;
+    rowSize = 0u;
+    sequenceOffset = 0u;
+    timestampOffset = -1;
+    row = NULL_PTR(char8 *);
+    rowFill = 0u;
+    startCounter = 0u;
+    bytesRead = 0u;
+    numberOfRows = 0u;
+    numberOfDropped = 0u;
+    lastSequence = 0u;
+}
+
+/*lint -e{1551} the destructor must guarantee that the thread is stopped before the row is freed.*/
+BenchmarkFifoSink::~BenchmarkFifoSink() {
+    if (!executor.Stop()) {
+        if (!executor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    if (fd >= 0) {
+        (void) close(fd);
+    }
+    if (created) {
+        (void) unlink(path.Buffer());
+    }
+    if (row != NULL_PTR(char8 *)) {
+        delete[] row;
+    }
+}
+
+bool BenchmarkFifoSink::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    if (ok) {
+        ok = data.Read("Path", path);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Path shall be specified");
+        }
+    }
+    if (ok) {
+        if (!data.Read("BytesPerSecond", bytesPerSecond)) {
+            bytesPerSecond = 0u;
+        }
+        if (!data.Read("HeaderSize", headerSize)) {
+            headerSize = 0u;
+        }
+        if (!data.Read("RowSize", rowSize)) {
+            rowSize = 0u;
+        }
+        if (!data.Read("SequenceOffset", sequenceOffset)) {
+            sequenceOffset = 0u;
+        }
+        if (!data.Read("TimestampOffset", timestampOffset)) {
+            timestampOffset = -1;
+        }
+        if (!data.Read("Source", source)) {
+            source = "";
+        }
+        if (rowSize > 0u) {
+            ok = ((sequenceOffset + sizeof(uint64)) <= rowSize);
+            if ((ok) && (timestampOffset >= 0)) {
+                ok = ((static_cast<uint32>(timestampOffset) + sizeof(uint64)) <= rowSize);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The SequenceOffset and the TimestampOffset shall be within the RowSize");
+            }
+        }
+    }
+    if (ok) {
+        if (mkfifo(path.Buffer(), 0600) == 0) {
+            created = true;
+        }
+        else {
+            ok = (errno == EEXIST);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not create the FIFO %s", path.Buffer());
+            }
+        }
+    }
+    if (ok) {
+        //Non-blocking, so that the open of the writer does not block (nor fail) before the thread starts reading
+        fd = open(path.Buffer(), O_RDONLY | O_NONBLOCK);
+        ok = (fd >= 0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not open the FIFO %s", path.Buffer());
+        }
+    }
+    if (ok) {
+        if (fcntl(fd, F_SETPIPE_SZ, BENCHMARK_FIFO_SINK_PIPE_SIZE) < 0) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not reduce the pipe buffer of %s", path.Buffer());
+        }
+        if (rowSize > 0u) {
+            row = new char8[rowSize];
+        }
+        startCounter = HighResolutionTimer::Counter();
+        executor.SetName(GetName());
+        ok = (executor.Start() == ErrorManagement::NoError);
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType BenchmarkFifoSink::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        uint64 budget = BENCHMARK_FIFO_SINK_CHUNK_SIZE;
+        if (bytesPerSecond > 0u) {
+            float64 elapsed = static_cast<float64>(HighResolutionTimer::Counter() - startCounter) * HighResolutionTimer::Period();
+            uint64 allowed = static_cast<uint64>(elapsed * static_cast<float64>(bytesPerSecond));
+            budget = (allowed > bytesRead) ? (allowed - bytesRead) : (0u);
+            //Do not accumulate more than one second of budget (e.g. while the writer was not writing)
+            if (budget > bytesPerSecond) {
+                startCounter += static_cast<uint64>(static_cast<float64>(budget - bytesPerSecond) / static_cast<float64>(bytesPerSecond)
+                        * static_cast<float64>(HighResolutionTimer::Frequency()));
+                budget = bytesPerSecond;
+            }
+            if (budget > BENCHMARK_FIFO_SINK_CHUNK_SIZE) {
+                budget = BENCHMARK_FIFO_SINK_CHUNK_SIZE;
+            }
+        }
+        ssize_t readBytes = 0;
+        if (budget > 0u) {
+            char8 chunk[BENCHMARK_FIFO_SINK_CHUNK_SIZE];
+            readBytes = read(fd, &chunk[0], static_cast<size_t>(budget));
+            if (readBytes > 0) {
+                Consume(&chunk[0], static_cast<uint32>(readBytes));
+            }
+        }
+        if (readBytes <= 0) {
+            //Throttled, no data (EAGAIN) or no writer (0)
+            Sleep::MSec(1u);
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+void BenchmarkFifoSink::Consume(const char8 * const data,
+                                const uint32 size) {
+    uint32 idx = 0u;
+    if (bytesRead < headerSize) {
+        uint64 headerLeft = (headerSize - bytesRead);
+        idx = (headerLeft < size) ? (static_cast<uint32>(headerLeft)) : (size);
+    }
+    bytesRead += size;
+    while ((rowSize > 0u) && (idx < size)) {
+        uint32 toCopy = (rowSize - rowFill);
+        if (toCopy > (size - idx)) {
+            toCopy = (size - idx);
+        }
+        (void) MemoryOperationsHelper::Copy(&row[rowFill], &data[idx], toCopy);
+        rowFill += toCopy;
+        idx += toCopy;
+        if (rowFill == rowSize) {
+            uint64 now = HighResolutionTimer::Counter();
+            uint64 currentSequence = 0u;
+            (void) MemoryOperationsHelper::Copy(&currentSequence, &row[sequenceOffset], static_cast<uint32>(sizeof(uint64)));
+            if ((lastSequence != 0u) && (currentSequence > (lastSequence + 1u))) {
+                numberOfDropped += (currentSequence - lastSequence) - 1u;
+            }
+            lastSequence = currentSequence;
+            if (timestampOffset >= 0) {
+                uint64 sent = 0u;
+                (void) MemoryOperationsHelper::Copy(&sent, &row[timestampOffset], static_cast<uint32>(sizeof(uint64)));
+                if (now >= sent) {
+                    latencyHistogram.Add(now - sent);
+                }
+            }
+            numberOfRows++;
+            rowFill = 0u;
+        }
+    }
+}
+
+uint64 BenchmarkFifoSink::GetBytesRead() const {
+    return bytesRead;
+}
+
+uint64 BenchmarkFifoSink::GetNumberOfRows() const {
+    return numberOfRows;
+}
+
+uint64 BenchmarkFifoSink::GetNumberOfDropped() const {
+    return numberOfDropped;
+}
+
+uint64 BenchmarkFifoSink::GetLastSequence() const {
+    return lastSequence;
+}
+
+const StreamString &BenchmarkFifoSink::GetSource() const {
+    return source;
+}
+
+const BenchmarkHistogram &BenchmarkFifoSink::GetLatencyHistogram() const {
+    return latencyHistogram;
+}
+
+CLASS_REGISTER(BenchmarkFifoSink, "1.0")
+
+}
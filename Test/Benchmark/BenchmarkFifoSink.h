@@ -0,0 +1,183 @@
+/**
+ * @file BenchmarkFifoSink.h
+ * @brief Header file for class BenchmarkFifoSink
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BenchmarkFifoSink
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BENCHMARKFIFOSINK_H_
+#define BENCHMARKFIFOSINK_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BenchmarkHistogram.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "Object.h"
+#include "SingleThreadService.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Throttled reader of a named pipe (FIFO), used as the slow storage of a DataSource which writes to a file (see MainDataSourceBenchmark).
+ * @details The FIFO is created (if it does not exist) and opened (non-blocking) in Initialise, i.e. before the DataSource which writes
+ * to it (e.g. a FileWriter with Filename = Path, with the default IOBackend) is initialised, and it is read by a SingleThreadService at most at
+ * BytesPerSecond (0 = as fast as possible). The pipe buffer is reduced to one page, so that the data which is not read yet remains in the
+ * queue of the DataSource (e.g. in the buffers of its MemoryMapAsyncOutputBroker).
+ *
+ * If RowSize > 0, the data after the first HeaderSize bytes is split in rows of RowSize bytes (e.g. a binary FileWriter recording the
+ * signals of a BenchmarkSourceGAM) and the uint64 at SequenceOffset (and at TimestampOffset) of each row is interpreted as the Sequence (and
+ * the Timestamp) of the BenchmarkSourceGAM, to count the dropped rows and the latency as the BenchmarkSinkGAM does.
+ *
+ * <pre>
+ * Writer = {
+ *     Path = "/tmp/soak.fifo" //Compulsory.
+ *     BytesPerSecond = 1000000 //Optional. Default = 0 (not throttled).
+ *     HeaderSize = 122 //Optional. Default = 0. Bytes written once at the start (e.g. the header of a binary FileWriter: 4 + 38 * signals).
+ *     RowSize = 1040 //Optional. Default = 0 (the rows are not analysed).
+ *     SequenceOffset = 0 //Optional. Default = 0.
+ *     TimestampOffset = 8 //Optional. Default = none.
+ *     Source = Source //Optional. Default = the first BenchmarkSourceGAM of the application. BenchmarkSourceGAM which writes the Sequence.
+ * }
+ * </pre>
+ *
+ * The statistics are updated by the reading thread and may be read (approximately) at any time.
+ */
+class BenchmarkFifoSink: public Object, public EmbeddedServiceMethodBinderI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    BenchmarkFifoSink();
+
+    /**
+     * @brief Destructor. Stops the reading thread, closes and removes the FIFO (if created by this object).
+     */
+    virtual ~BenchmarkFifoSink();
+
+    /**
+     * @brief Reads the parameters, opens the FIFO and starts the reading thread.
+     * @return true if the Path is set, if the offsets are within the RowSize and if the FIFO could be opened.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Reads the FIFO (within the BytesPerSecond) and analyses the rows.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Gets the number of bytes read.
+     */
+    uint64 GetBytesRead() const;
+
+    /**
+     * @brief Gets the number of complete rows read.
+     */
+    uint64 GetNumberOfRows() const;
+
+    /**
+     * @brief Gets the number of rows dropped (gaps in the Sequence).
+     */
+    uint64 GetNumberOfDropped() const;
+
+    /**
+     * @brief Gets the Sequence of the last row (0 if none).
+     */
+    uint64 GetLastSequence() const;
+
+    /**
+     * @brief Gets the name of the BenchmarkSourceGAM which writes the Sequence.
+     */
+    const StreamString &GetSource() const;
+
+    /**
+     * @brief Gets the histogram of the latency of the rows (empty if TimestampOffset is not set).
+     */
+    const BenchmarkHistogram &GetLatencyHistogram() const;
+
+private:
+
+    /**
+     * @brief Analyses the bytes read.
+     */
+    void Consume(const char8 * const data,
+                 const uint32 size);
+
+    /**
+     * The reading thread.
+     */
+    SingleThreadService executor;
+
+    /**
+     * The FIFO.
+     */
+    StreamString path;
+    int32 fd;
+    bool created;
+
+    /**
+     * The configured parameters.
+     */
+    uint64 bytesPerSecond;
+    uint32 headerSize;
+    uint32 rowSize;
+    uint32 sequenceOffset;
+    int32 timestampOffset;
+    StreamString source;
+
+    /**
+     * The row being assembled and the number of bytes already in it.
+     */
+    char8 *row;
+    uint32 rowFill;
+
+    /**
+     * The HighResolutionTimer::Counter when the reading started (for the throttling).
+     */
+    uint64 startCounter;
+
+    /**
+     * The statistics described in the getters.
+     */
+    uint64 bytesRead;
+    uint64 numberOfRows;
+    uint64 numberOfDropped;
+    uint64 lastSequence;
+    BenchmarkHistogram latencyHistogram;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BENCHMARKFIFOSINK_H_ */
@@ -0,0 +1,162 @@
+/**
+ * @file BenchmarkHistogram.cpp
+ * @brief Source file for class BenchmarkHistogram
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BenchmarkHistogram (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "BenchmarkHistogram.h"
+#include "HighResolutionTimer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+BenchmarkHistogram::BenchmarkHistogram() {
+    Reset();
+}
+
+BenchmarkHistogram::~BenchmarkHistogram() {
+}
+
+void BenchmarkHistogram::Reset() {
+    for (uint32 b = 0u; b < BENCHMARK_HISTOGRAM_NUMBER_OF_BINS; b++) {
+        bins[b] = 0u;
+    }
+    numberOfValues = 0u;
+    sum = 0u;
+    minimum = 0u;
+    maximum = 0u;
+}
+
+void BenchmarkHistogram::Add(const uint64 value) {
+    uint32 bin = 0u;
+    uint64 remaining = value;
+    while ((remaining > 0u) && (bin < (BENCHMARK_HISTOGRAM_NUMBER_OF_BINS - 1u))) {
+        remaining >>= 1u;
+        bin++;
+    }
+    bins[bin]++;
+    if ((numberOfValues == 0u) || (value < minimum)) {
+        minimum = value;
+    }
+    if (value > maximum) {
+        maximum = value;
+    }
+    sum += value;
+    numberOfValues++;
+}
+
+uint64 BenchmarkHistogram::GetNumberOfValues() const {
+    return numberOfValues;
+}
+
+uint64 BenchmarkHistogram::GetMinimum() const {
+    return minimum;
+}
+
+uint64 BenchmarkHistogram::GetMaximum() const {
+    return maximum;
+}
+
+float64 BenchmarkHistogram::GetMean() const {
+    float64 mean = 0.;
+    if (numberOfValues > 0u) {
+        mean = static_cast<float64>(sum) / static_cast<float64>(numberOfValues);
+    }
+    return mean;
+}
+
+uint64 BenchmarkHistogram::GetBinCount(const uint32 bin) const {
+    uint64 count = 0u;
+    if (bin < BENCHMARK_HISTOGRAM_NUMBER_OF_BINS) {
+        count = bins[bin];
+    }
+    return count;
+}
+
+uint64 BenchmarkHistogram::GetQuantile(const float64 quantile) const {
+    float64 target = quantile * static_cast<float64>(numberOfValues);
+    uint64 cumulative = 0u;
+    uint64 upperLimit = 0u;
+    bool found = false;
+    for (uint32 b = 0u; (b < BENCHMARK_HISTOGRAM_NUMBER_OF_BINS) && (!found); b++) {
+        cumulative += bins[b];
+        found = (static_cast<float64>(cumulative) >= target);
+        if (found) {
+            //The upper limit of the bin b is 2^b - 1
+            upperLimit = (b == 0u) ? (0u) : (((static_cast<uint64>(1u) << (b - 1u)) << 1u) - 1u);
+        }
+    }
+    if ((!found) || (upperLimit > maximum)) {
+        upperLimit = maximum;
+    }
+    return upperLimit;
+}
+
+void BenchmarkHistogram::Difference(const BenchmarkHistogram &current,
+                                    const BenchmarkHistogram &previous) {
+    Reset();
+    bool first = true;
+    for (uint32 b = 0u; b < BENCHMARK_HISTOGRAM_NUMBER_OF_BINS; b++) {
+        bins[b] = (current.bins[b] > previous.bins[b]) ? (current.bins[b] - previous.bins[b]) : (0u);
+        if (bins[b] > 0u) {
+            uint64 lowerLimit = (b == 0u) ? (0u) : (static_cast<uint64>(1u) << (b - 1u));
+            uint64 upperLimit = (b == 0u) ? (0u) : (((static_cast<uint64>(1u) << (b - 1u)) << 1u) - 1u);
+            if (first) {
+                minimum = lowerLimit;
+                first = false;
+            }
+            maximum = (upperLimit < current.maximum) ? (upperLimit) : (current.maximum);
+            numberOfValues += bins[b];
+        }
+    }
+    sum = (current.sum > previous.sum) ? (current.sum - previous.sum) : (0u);
+}
+
+void BenchmarkHistogram::Print(const char8 * const name) const {
+    float64 periodMicroseconds = HighResolutionTimer::Period() * 1e6;
+    printf("    %s: %llu values, min = %.3f us, mean = %.3f us, p99 <= %.3f us, max = %.3f us\n", name,
+           static_cast<unsigned long long>(numberOfValues), static_cast<float64>(minimum) * periodMicroseconds, GetMean() * periodMicroseconds,
+           static_cast<float64>(GetQuantile(0.99)) * periodMicroseconds, static_cast<float64>(maximum) * periodMicroseconds);
+    for (uint32 b = 0u; b < BENCHMARK_HISTOGRAM_NUMBER_OF_BINS; b++) {
+        if (bins[b] > 0u) {
+            uint64 lowerLimit = (b == 0u) ? (0u) : (static_cast<uint64>(1u) << (b - 1u));
+            uint64 upperLimit = (b == 0u) ? (1u) : ((static_cast<uint64>(1u) << (b - 1u)) << 1u);
+            printf("        [%12.3f, %12.3f[ us %12llu\n", static_cast<float64>(lowerLimit) * periodMicroseconds,
+                   static_cast<float64>(upperLimit) * periodMicroseconds, static_cast<unsigned long long>(bins[b]));
+        }
+    }
+}
+
+}
@@ -0,0 +1,151 @@
+/**
+ * @file BenchmarkHistogram.h
+ * @brief Header file for class BenchmarkHistogram
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BenchmarkHistogram
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BENCHMARKHISTOGRAM_H_
+#define BENCHMARKHISTOGRAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The number of bins of a BenchmarkHistogram.
+ */
+static const uint32 BENCHMARK_HISTOGRAM_NUMBER_OF_BINS = 64u;
+
+/**
+ * @brief Histogram of HighResolutionTimer counts with power of 2 bins, which can be updated in real-time.
+ * @details The bin b (b > 0) counts the values in [2^(b-1), 2^b[ and the bin 0 counts the zeros.
+ */
+class BenchmarkHistogram {
+public:
+
+    /**
+     * @brief Constructor. Resets the histogram.
+     */
+    BenchmarkHistogram();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~BenchmarkHistogram();
+
+    /**
+     * @brief Clears all the bins and the statistics.
+     */
+    void Reset();
+
+    /**
+     * @brief Adds a value to the histogram.
+     * @param[in] value the value to add.
+     */
+    void Add(const uint64 value);
+
+    /**
+     * @brief Gets the number of values added.
+     * @return the number of values added.
+     */
+    uint64 GetNumberOfValues() const;
+
+    /**
+     * @brief Gets the smallest value added.
+     * @return the smallest value added (0 if no value was added).
+     */
+    uint64 GetMinimum() const;
+
+    /**
+     * @brief Gets the largest value added.
+     * @return the largest value added.
+     */
+    uint64 GetMaximum() const;
+
+    /**
+     * @brief Gets the average of the values added.
+     * @return the average of the values added (0 if no value was added).
+     */
+    float64 GetMean() const;
+
+    /**
+     * @brief Gets the number of values in a bin.
+     * @param[in] bin the bin (< BENCHMARK_HISTOGRAM_NUMBER_OF_BINS).
+     * @return the number of values in the bin.
+     */
+    uint64 GetBinCount(const uint32 bin) const;
+
+    /**
+     * @brief Gets an upper bound of a quantile (from the bins).
+     * @param[in] quantile the quantile in ]0, 1].
+     * @return the upper limit of the first bin where the cumulative number of values reaches quantile * GetNumberOfValues(),
+     * bounded by GetMaximum().
+     */
+    uint64 GetQuantile(const float64 quantile) const;
+
+    /**
+     * @brief Sets the histogram with the values which were added to a histogram after a previous copy of it.
+     * @details Used to compute the statistics of a reporting interval from the cumulative histograms. The minimum and the maximum
+     * are the limits of the lowest and of the highest non-empty bins (the maximum bounded by current.GetMaximum()).
+     * @param[in] current the histogram.
+     * @param[in] previous a previous copy of the histogram.
+     */
+    void Difference(const BenchmarkHistogram &current,
+                    const BenchmarkHistogram &previous);
+
+    /**
+     * @brief Prints (with printf) the statistics and the non-empty bins in microseconds.
+     * @param[in] name the name of the histogram.
+     */
+    void Print(const char8 * const name) const;
+
+private:
+
+    /**
+     * The number of values in each bin.
+     */
+    uint64 bins[BENCHMARK_HISTOGRAM_NUMBER_OF_BINS];
+
+    /**
+     * The number, the sum, the minimum and the maximum of the values added.
+     */
+    uint64 numberOfValues;
+    uint64 sum;
+    uint64 minimum;
+    uint64 maximum;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BENCHMARKHISTOGRAM_H_ */
@@ -0,0 +1,219 @@
+/**
+ * @file BenchmarkSinkGAM.cpp
+ * @brief Source file for class BenchmarkSinkGAM
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BenchmarkSinkGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BenchmarkSinkGAM.h"
+#include "HighResolutionTimer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+BenchmarkSinkGAM::BenchmarkSinkGAM() :
+        GAM(),
+        StatefulI() {
+    sequence = NULL_PTR(uint64 *);
+    timestamp = NULL_PTR(uint64 *);
+    cycleByteSize = 0u;
+    throttleCounts = 0u;
+    lastSequence = 0u;
+    numberOfReceived = 0u;
+    numberOfDropped = 0u;
+    numberOfRepeated = 0u;
+    numberOfOutOfOrder = 0u;
+    receivedBytes = 0u;
+    firstReceived = 0u;
+    lastReceived = 0u;
+    lastExecute = 0u;
+}
+
+BenchmarkSinkGAM::~BenchmarkSinkGAM() {
+}
+
+bool BenchmarkSinkGAM::Initialise(StructuredDataI &data) {
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        uint32 throttle = 0u;
+        if (data.Read("Throttle", throttle)) {
+            throttleCounts = static_cast<uint64>(static_cast<float64>(throttle) * 1e-6 * static_cast<float64>(HighResolutionTimer::Frequency()));
+        }
+        if (!data.Read("Source", source)) {
+            source = "";
+        }
+    }
+    return ok;
+}
+
+bool BenchmarkSinkGAM::Setup() {
+    uint32 nOfInputSignals = GetNumberOfInputSignals();
+    bool ok = true;
+    for (uint32 i = 0u; (i < nOfInputSignals) && (ok); i++) {
+        StreamString signalName;
+        uint32 byteSize = 0u;
+        uint32 nOfElements = 0u;
+        ok = GetSignalName(InputSignals, i, signalName);
+        if (ok) {
+            ok = GetSignalByteSize(InputSignals, i, byteSize);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(InputSignals, i, nOfElements);
+        }
+        if (ok) {
+            cycleByteSize += byteSize;
+            if ((signalName == "Sequence") || (signalName == "Timestamp")) {
+                ok = ((GetSignalType(InputSignals, i) == UnsignedInteger64Bit) && (nOfElements == 1u));
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The %s signal shall be a uint64 with one element", signalName.Buffer());
+                }
+                else if (signalName == "Sequence") {
+                    sequence = static_cast<uint64 *>(GetInputSignalMemory(i));
+                }
+                else {
+                    timestamp = static_cast<uint64 *>(GetInputSignalMemory(i));
+                }
+            }
+        }
+    }
+    if (ok) {
+        ok = (sequence != NULL_PTR(uint64 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The Sequence input signal shall be defined");
+        }
+    }
+    return ok;
+}
+
+/*lint -e{613} sequence cannot be NULL as otherwise Setup would have failed.*/
+bool BenchmarkSinkGAM::Execute() {
+    uint64 now = HighResolutionTimer::Counter();
+    if (lastExecute != 0u) {
+        cycleHistogram.Add(now - lastExecute);
+    }
+    lastExecute = now;
+    uint64 currentSequence = *sequence;
+    if (currentSequence != 0u) {
+        if (currentSequence == lastSequence) {
+            numberOfRepeated++;
+        }
+        else {
+            if (currentSequence < lastSequence) {
+                numberOfOutOfOrder++;
+            }
+            else if (lastSequence != 0u) {
+                numberOfDropped += (currentSequence - lastSequence) - 1u;
+            }
+            else {
+                //The first buffer received
+                firstReceived = now;
+            }
+            if (timestamp != NULL_PTR(uint64 *)) {
+                uint64 sent = *timestamp;
+                if (now >= sent) {
+                    latencyHistogram.Add(now - sent);
+                }
+            }
+            lastReceived = now;
+            lastSequence = currentSequence;
+            numberOfReceived++;
+            receivedBytes += cycleByteSize;
+        }
+    }
+    if (throttleCounts > 0u) {
+        while ((HighResolutionTimer::Counter() - now) < throttleCounts) {
+        }
+    }
+    return true;
+}
+
+bool BenchmarkSinkGAM::PrepareNextState(const char8 * const currentStateName,
+                                        const char8 * const nextStateName) {
+    lastSequence = 0u;
+    numberOfReceived = 0u;
+    numberOfDropped = 0u;
+    numberOfRepeated = 0u;
+    numberOfOutOfOrder = 0u;
+    receivedBytes = 0u;
+    firstReceived = 0u;
+    lastReceived = 0u;
+    lastExecute = 0u;
+    latencyHistogram.Reset();
+    cycleHistogram.Reset();
+    return true;
+}
+
+uint64 BenchmarkSinkGAM::GetNumberOfReceived() const {
+    return numberOfReceived;
+}
+
+uint64 BenchmarkSinkGAM::GetNumberOfDropped() const {
+    return numberOfDropped;
+}
+
+uint64 BenchmarkSinkGAM::GetNumberOfRepeated() const {
+    return numberOfRepeated;
+}
+
+uint64 BenchmarkSinkGAM::GetNumberOfOutOfOrder() const {
+    return numberOfOutOfOrder;
+}
+
+uint64 BenchmarkSinkGAM::GetLastSequence() const {
+    return lastSequence;
+}
+
+const StreamString &BenchmarkSinkGAM::GetSource() const {
+    return source;
+}
+
+uint64 BenchmarkSinkGAM::GetReceivedBytes() const {
+    return receivedBytes;
+}
+
+uint64 BenchmarkSinkGAM::GetElapsedCounts() const {
+    return (lastReceived - firstReceived);
+}
+
+const BenchmarkHistogram &BenchmarkSinkGAM::GetLatencyHistogram() const {
+    return latencyHistogram;
+}
+
+const BenchmarkHistogram &BenchmarkSinkGAM::GetCycleHistogram() const {
+    return cycleHistogram;
+}
+
+CLASS_REGISTER(BenchmarkSinkGAM, "1.0")
+
+}
@@ -0,0 +1,246 @@
+/**
+ * @file BenchmarkSinkGAM.h
+ * @brief Header file for class BenchmarkSinkGAM
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BenchmarkSinkGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BENCHMARKSINKGAM_H_
+#define BENCHMARKSINKGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BenchmarkHistogram.h"
+#include "GAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief GAM which consumes the data produced by a BenchmarkSourceGAM to benchmark the DataSources (see MainDataSourceBenchmark).
+ * @details The input signals are identified by their name:
+ *  - Sequence (uint64, compulsory): the sequence number written by the BenchmarkSourceGAM.
+ *  - Timestamp (uint64, optional): the HighResolutionTimer::Counter written by the BenchmarkSourceGAM.
+ *  - Any other signal is payload.
+ *
+ * In each cycle the Sequence is compared with the one of the previous cycle:
+ *  - 0: nothing was received yet (e.g. an asynchronous DataSource which was not written yet).
+ *  - equal: the same buffer was read again (repeated).
+ *  - greater by n: a new buffer was received and n - 1 buffers were dropped.
+ *  - smaller: a new buffer was received out of order (or the source changed state).
+ *
+ * For each new buffer the latency (HighResolutionTimer::Counter - Timestamp) is added to the latency histogram and
+ * the byte size of all the input signals is added to the received bytes. The time between two consecutive Execute is
+ * added to the cycle histogram. Output signals (e.g. for a Timer) are not written.
+ *
+ * Throttle emulates a slow consumer (e.g. to stress a DataSource with a queue between the writer and the reader) and Source
+ * identifies the BenchmarkSourceGAM which writes the Sequence, so that the MainDataSourceBenchmark can compute the backlog
+ * (buffers written but not yet read).
+ *
+ * <pre>
+ * +Sink = {
+ *     Class = BenchmarkSinkGAM
+ *     Throttle = 200 //Optional. Default = 0. Microseconds spent (busy waiting) in each Execute.
+ *     Source = Source //Optional. Default = the first BenchmarkSourceGAM of the application.
+ *     InputSignals = {
+ *         Sequence = {
+ *             DataSource = UDPReceiver
+ *             Type = uint64
+ *         }
+ *         Timestamp = {
+ *             DataSource = UDPReceiver
+ *             Type = uint64
+ *         }
+ *         Payload = {
+ *             DataSource = UDPReceiver
+ *             Type = uint8
+ *             NumberOfElements = 1024
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class BenchmarkSinkGAM: public GAM, public StatefulI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    BenchmarkSinkGAM();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~BenchmarkSinkGAM();
+
+    /**
+     * @brief Reads the optional Throttle and Source parameters.
+     * @return true if GAM::Initialise succeeds.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Identifies the input signals.
+     * @return true if the Sequence signal exists and the Sequence and Timestamp signals are uint64 with one element.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Compares the Sequence with the one of the previous cycle and updates the statistics.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Resets the statistics.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief Gets the number of new buffers received.
+     * @return the number of new buffers received.
+     */
+    uint64 GetNumberOfReceived() const;
+
+    /**
+     * @brief Gets the number of buffers dropped (gaps in the Sequence).
+     * @return the number of buffers dropped.
+     */
+    uint64 GetNumberOfDropped() const;
+
+    /**
+     * @brief Gets the number of cycles which read the same buffer of the previous cycle.
+     * @return the number of cycles which read the same buffer of the previous cycle.
+     */
+    uint64 GetNumberOfRepeated() const;
+
+    /**
+     * @brief Gets the number of buffers received out of order.
+     * @return the number of buffers received out of order.
+     */
+    uint64 GetNumberOfOutOfOrder() const;
+
+    /**
+     * @brief Gets the Sequence of the last new buffer received.
+     * @return the Sequence of the last new buffer received (0 if none).
+     */
+    uint64 GetLastSequence() const;
+
+    /**
+     * @brief Gets the name of the BenchmarkSourceGAM which writes the Sequence.
+     * @return the configured Source (empty if not set).
+     */
+    const StreamString &GetSource() const;
+
+    /**
+     * @brief Gets the number of bytes received in the new buffers.
+     * @return the number of bytes received in the new buffers.
+     */
+    uint64 GetReceivedBytes() const;
+
+    /**
+     * @brief Gets the number of HighResolutionTimer counts between the first and the last new buffer.
+     * @return the number of HighResolutionTimer counts between the first and the last new buffer.
+     */
+    uint64 GetElapsedCounts() const;
+
+    /**
+     * @brief Gets the histogram of the latency of the new buffers.
+     * @return the histogram of the latency of the new buffers (empty if the Timestamp signal is not defined).
+     */
+    const BenchmarkHistogram &GetLatencyHistogram() const;
+
+    /**
+     * @brief Gets the histogram of the time between two consecutive Execute.
+     * @return the histogram of the time between two consecutive Execute.
+     */
+    const BenchmarkHistogram &GetCycleHistogram() const;
+
+private:
+
+    /**
+     * The Sequence and the Timestamp signals (NULL if not defined).
+     */
+    uint64 *sequence;
+    uint64 *timestamp;
+
+    /**
+     * The number of bytes of all the input signals.
+     */
+    uint32 cycleByteSize;
+
+    /**
+     * The HighResolutionTimer counts spent in each Execute.
+     */
+    uint64 throttleCounts;
+
+    /**
+     * The name of the BenchmarkSourceGAM.
+     */
+    StreamString source;
+
+    /**
+     * The Sequence of the previous cycle.
+     */
+    uint64 lastSequence;
+
+    /**
+     * The statistics described in the getters.
+     */
+    uint64 numberOfReceived;
+    uint64 numberOfDropped;
+    uint64 numberOfRepeated;
+    uint64 numberOfOutOfOrder;
+    uint64 receivedBytes;
+
+    /**
+     * The HighResolutionTimer::Counter of the first and the last new buffer.
+     */
+    uint64 firstReceived;
+    uint64 lastReceived;
+
+    /**
+     * The HighResolutionTimer::Counter of the last Execute (0 before the first Execute).
+     */
+    uint64 lastExecute;
+
+    /**
+     * The histograms of the latency and of the time between two consecutive Execute.
+     */
+    BenchmarkHistogram latencyHistogram;
+    BenchmarkHistogram cycleHistogram;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BENCHMARKSINKGAM_H_ */
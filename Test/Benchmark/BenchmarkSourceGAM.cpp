@@ -0,0 +1,185 @@
+/**
+ * @file BenchmarkSourceGAM.cpp
+ * @brief Source file for class BenchmarkSourceGAM
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BenchmarkSourceGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BenchmarkSourceGAM.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+BenchmarkSourceGAM::BenchmarkSourceGAM() :
+        GAM(),
+        StatefulI() {
+    sequence = NULL_PTR(uint64 *);
+    timestamp = NULL_PTR(uint64 *);
+    trigger = NULL_PTR(uint8 *);
+    triggerNumberOfElements = 0u;
+    payloadSignals = NULL_PTR(uint32 *);
+    payloadByteSizes = NULL_PTR(uint32 *);
+    numberOfPayloadSignals = 0u;
+    cycleByteSize = 0u;
+    sequenceNumber = 0u;
+    firstExecute = 0u;
+    lastExecute = 0u;
+}
+
+BenchmarkSourceGAM::~BenchmarkSourceGAM() {
+    if (payloadSignals != NULL_PTR(uint32 *)) {
+        delete[] payloadSignals;
+    }
+    if (payloadByteSizes != NULL_PTR(uint32 *)) {
+        delete[] payloadByteSizes;
+    }
+}
+
+bool BenchmarkSourceGAM::Setup() {
+    uint32 nOfOutputSignals = GetNumberOfOutputSignals();
+    bool ok = (nOfOutputSignals > 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "At least the Sequence output signal shall be defined");
+    }
+    if (ok) {
+        payloadSignals = new uint32[nOfOutputSignals];
+        payloadByteSizes = new uint32[nOfOutputSignals];
+    }
+    for (uint32 i = 0u; (i < nOfOutputSignals) && (ok); i++) {
+        StreamString signalName;
+        uint32 byteSize = 0u;
+        uint32 nOfElements = 0u;
+        ok = GetSignalName(OutputSignals, i, signalName);
+        if (ok) {
+            ok = GetSignalByteSize(OutputSignals, i, byteSize);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(OutputSignals, i, nOfElements);
+        }
+        if (ok) {
+            cycleByteSize += byteSize;
+            TypeDescriptor signalType = GetSignalType(OutputSignals, i);
+            if ((signalName == "Sequence") || (signalName == "Timestamp")) {
+                ok = ((signalType == UnsignedInteger64Bit) && (nOfElements == 1u));
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The %s signal shall be a uint64 with one element", signalName.Buffer());
+                }
+                else if (signalName == "Sequence") {
+                    sequence = static_cast<uint64 *>(GetOutputSignalMemory(i));
+                }
+                else {
+                    timestamp = static_cast<uint64 *>(GetOutputSignalMemory(i));
+                }
+            }
+            else if (signalName == "Trigger") {
+                ok = (signalType == UnsignedInteger8Bit);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The Trigger signal shall be a uint8");
+                }
+                else {
+                    trigger = static_cast<uint8 *>(GetOutputSignalMemory(i));
+                    triggerNumberOfElements = nOfElements;
+                }
+            }
+            else {
+                payloadSignals[numberOfPayloadSignals] = i;
+                payloadByteSizes[numberOfPayloadSignals] = byteSize;
+                numberOfPayloadSignals++;
+            }
+        }
+    }
+    if (ok) {
+        ok = (sequence != NULL_PTR(uint64 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The Sequence output signal shall be defined");
+        }
+    }
+    return ok;
+}
+
+/*lint -e{613} sequence, payloadSignals and payloadByteSizes cannot be NULL as otherwise Setup would have failed.*/
+bool BenchmarkSourceGAM::Execute() {
+    uint64 now = HighResolutionTimer::Counter();
+    if (sequenceNumber == 0u) {
+        firstExecute = now;
+    }
+    else {
+        cycleHistogram.Add(now - lastExecute);
+    }
+    lastExecute = now;
+    sequenceNumber++;
+    uint8 pattern = static_cast<uint8>(sequenceNumber & 0xFFu);
+    for (uint32 p = 0u; p < numberOfPayloadSignals; p++) {
+        (void) MemoryOperationsHelper::Set(GetOutputSignalMemory(payloadSignals[p]), static_cast<char8>(pattern), payloadByteSizes[p]);
+    }
+    for (uint32 t = 0u; t < triggerNumberOfElements; t++) {
+        trigger[t] = 1u;
+    }
+    *sequence = sequenceNumber;
+    if (timestamp != NULL_PTR(uint64 *)) {
+        *timestamp = HighResolutionTimer::Counter();
+    }
+    return true;
+}
+
+bool BenchmarkSourceGAM::PrepareNextState(const char8 * const currentStateName,
+                                          const char8 * const nextStateName) {
+    sequenceNumber = 0u;
+    firstExecute = 0u;
+    lastExecute = 0u;
+    cycleHistogram.Reset();
+    return true;
+}
+
+uint64 BenchmarkSourceGAM::GetNumberOfCycles() const {
+    return sequenceNumber;
+}
+
+uint32 BenchmarkSourceGAM::GetCycleByteSize() const {
+    return cycleByteSize;
+}
+
+uint64 BenchmarkSourceGAM::GetElapsedCounts() const {
+    return (lastExecute - firstExecute);
+}
+
+const BenchmarkHistogram &BenchmarkSourceGAM::GetCycleHistogram() const {
+    return cycleHistogram;
+}
+
+CLASS_REGISTER(BenchmarkSourceGAM, "1.0")
+
+}
@@ -0,0 +1,192 @@
+/**
+ * @file BenchmarkSourceGAM.h
+ * @brief Header file for class BenchmarkSourceGAM
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BenchmarkSourceGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BENCHMARKSOURCEGAM_H_
+#define BENCHMARKSOURCEGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BenchmarkHistogram.h"
+#include "GAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief GAM which produces sequenced and timestamped data to benchmark the DataSources (see MainDataSourceBenchmark).
+ * @details The output signals are identified by their name:
+ *  - Sequence (uint64, compulsory): the number of the cycle, starting at 1 after each state change.
+ *  - Timestamp (uint64, optional): the HighResolutionTimer::Counter at the end of the Execute, used by the BenchmarkSinkGAM
+ *    to compute the latency (only meaningful if the sink runs on the same host).
+ *  - Trigger (uint8, optional): set to 1 in each cycle (e.g. for the DataSources with a MemoryMapAsyncTriggerOutputBroker).
+ *  - Any other signal is payload. All its bytes are set to the (least significant byte of the) sequence number.
+ *
+ * The input signals are ignored (e.g. a Timer signal which sets the rate of the thread).
+ *
+ * The GAM records the number of cycles and the histogram of the time between two consecutive Execute, which includes
+ * the blocking time of the Synchronise and of the output brokers of the DataSources under test.
+ *
+ * <pre>
+ * +Source = {
+ *     Class = BenchmarkSourceGAM
+ *     OutputSignals = {
+ *         Trigger = {
+ *             DataSource = UDPSender
+ *             Type = uint8
+ *         }
+ *         Sequence = {
+ *             DataSource = UDPSender
+ *             Type = uint64
+ *         }
+ *         Timestamp = {
+ *             DataSource = UDPSender
+ *             Type = uint64
+ *         }
+ *         Payload = {
+ *             DataSource = UDPSender
+ *             Type = uint8
+ *             NumberOfElements = 1024
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class BenchmarkSourceGAM: public GAM, public StatefulI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    BenchmarkSourceGAM();
+
+    /**
+     * @brief Destructor. Frees the payload signal indexes.
+     */
+    virtual ~BenchmarkSourceGAM();
+
+    /**
+     * @brief Identifies the output signals.
+     * @return true if the Sequence signal exists and the Sequence, Timestamp and Trigger signals have the types listed in
+     * the class description.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Writes the output signals and updates the statistics.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Resets the sequence number and the statistics.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief Gets the number of cycles executed since the last state change.
+     * @return the number of cycles executed since the last state change.
+     */
+    uint64 GetNumberOfCycles() const;
+
+    /**
+     * @brief Gets the number of bytes written in each cycle (all the output signals).
+     * @return the number of bytes written in each cycle.
+     */
+    uint32 GetCycleByteSize() const;
+
+    /**
+     * @brief Gets the number of HighResolutionTimer counts between the first and the last Execute.
+     * @return the number of HighResolutionTimer counts between the first and the last Execute.
+     */
+    uint64 GetElapsedCounts() const;
+
+    /**
+     * @brief Gets the histogram of the time between two consecutive Execute.
+     * @return the histogram of the time between two consecutive Execute.
+     */
+    const BenchmarkHistogram &GetCycleHistogram() const;
+
+private:
+
+    /**
+     * The Sequence, Timestamp and Trigger signals (NULL if not defined).
+     */
+    uint64 *sequence;
+    uint64 *timestamp;
+    uint8 *trigger;
+
+    /**
+     * The number of Trigger elements.
+     */
+    uint32 triggerNumberOfElements;
+
+    /**
+     * The index and the byte size of the output signals which are payload.
+     */
+    uint32 *payloadSignals;
+    uint32 *payloadByteSizes;
+
+    /**
+     * The number of payload signals.
+     */
+    uint32 numberOfPayloadSignals;
+
+    /**
+     * The number of bytes written in each cycle.
+     */
+    uint32 cycleByteSize;
+
+    /**
+     * The sequence number of the last cycle.
+     */
+    uint64 sequenceNumber;
+
+    /**
+     * The HighResolutionTimer::Counter of the first and the last Execute.
+     */
+    uint64 firstExecute;
+    uint64 lastExecute;
+
+    /**
+     * The histogram of the time between two consecutive Execute.
+     */
+    BenchmarkHistogram cycleHistogram;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BENCHMARKSOURCEGAM_H_ */
@@ -0,0 +1,810 @@
+/**
+ * @file MainBenchmark.cpp
+ * @brief Source file for the MainBenchmark executable
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details Runs one or more GAMs in isolation, feeding them with the synthetic signals of BenchmarkDataSource instances,
+ * and reports the statistics of the number of HighResolutionTimer counts spent in each GAM::Execute.
+ *
+ * Usage: MainBenchmark.ex -f <configuration> [-i iterations] [-w warmup] [-p] [-b baseline] [-t tolerance] [-o results]
+ *
+ * The configuration file has the following sections (names are only given as an example):
+ * <pre>
+ * Benchmark = { //Optional. The command line options override these values.
+ *     Iterations = 10000 //Number of measured cycles. Default = 10000.
+ *     Warmup = 100 //Number of cycles executed before the measurement. Default = 100.
+ *     PerformanceCounters = 1 //If 1, runs a second pass counting the hardware events of each GAM::Execute (-p). Default = 0.
+ *     IncludeBrokers = { Writer Reader } //GAMs whose measurement also includes their input and output brokers (e.g. to measure
+ *                                        //the copies to/from a DataSource). Default = none.
+ *     Baseline = "PerformanceBaseline.cfg" //Results of a previous run to compare with (-b). Default = none.
+ *     Tolerance = 10 //Maximum increase (in %) of the CountsPerElement with respect to the Baseline (-t). Default = 10.
+ *     Results = "PerformanceResults.cfg" //File where the results are written (-o). Default = none.
+ * }
+ * Functions = { //The GAMs to benchmark, executed in this order in each cycle.
+ *     +Filter = {
+ *         Class = FilterGAM
+ *         ...
+ *         InputSignals = {
+ *             Probe = {
+ *                 DataSource = Input
+ *                 Type = float32
+ *                 NumberOfElements = 1000
+ *             }
+ *         }
+ *         OutputSignals = {
+ *             Filtered = {
+ *                 DataSource = DDB //GAMDataSource which is always added by the benchmark (also the DefaultDataSource).
+ *                 Type = float32
+ *                 NumberOfElements = 1000
+ *             }
+ *         }
+ *     }
+ * }
+ * Data = { //The BenchmarkDataSource instances (and any other DataSource required by the GAMs).
+ *     +Input = {
+ *         Class = BenchmarkDataSource
+ *         Signals = {
+ *             Probe = {
+ *                 Generator = Random
+ *             }
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * Any other object at the root of the configuration (e.g. a +SharedMemory = { Class = MemoryGate }) is created before the application.
+ *
+ * The GAMs are wrapped in a RealTimeApplication (named Benchmark) with a single state and thread, which is configured
+ * but never started: each cycle generates the signals of all the BenchmarkDataSource instances and then, for each GAM,
+ * executes its input brokers, the (measured) GAM::Execute and its output brokers. The GAM classes which are not linked
+ * with the executable are loaded from the shared libraries found in the LD_LIBRARY_PATH (e.g. FilterGAM.so).
+ *
+ * The CountsPerElement of a GAM is its median number of counts divided by the number of elements (times the number of samples)
+ * of all its input signals (of its output signals if it has no inputs), so that the workloads can be compared across sizes. The
+ * results are written (with the same syntax of the configuration files) as:
+ * <pre>
+ * Results = {
+ *     Filter = {
+ *         Elements = 128000
+ *         Min = 51234 //Counts.
+ *         Median = 52001
+ *         P99 = 60321
+ *         Max = 80123
+ *         CountsPerElement = 0.406
+ *         Baseline = 0.400 //Only if the GAM is in the Baseline.
+ *         Deviation = 1.5 //%. Only if the GAM is in the Baseline.
+ *         Status = "Pass" //Pass, Fail (Deviation > Tolerance) or NoBaseline.
+ *     }
+ * }
+ * </pre>
+ * A results file can be used as the Baseline of the next runs. The executable returns a non-zero value if any GAM fails.
+ * PerformanceRegression.cfg holds the standard workloads of the performance regression suite and PerformanceBaseline.cfg their
+ * baseline (see the regression target of the Makefile.inc).
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BenchmarkDataSource.h"
+#include "BrokerI.h"
+#include "ConfigurationDatabase.h"
+#include "File.h"
+#include "GAM.h"
+#include "HighResolutionTimer.h"
+#include "ObjectRegistryDatabase.h"
+#include "PerformanceCounters.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * The state of a benchmarked GAM.
+ */
+struct BenchmarkedGAM {
+    /**
+     * The name of the GAM.
+     */
+    StreamString name;
+
+    /**
+     * The GAM.
+     */
+    ReferenceT<GAM> gam;
+
+    /**
+     * The input and the output brokers of the GAM.
+     */
+    ReferenceContainer inputBrokers;
+    ReferenceContainer outputBrokers;
+
+    /**
+     * The number of counts of each measured GAM::Execute.
+     */
+    uint64 *counts;
+
+    /**
+     * The sum of the hardware events counted in all the GAM::Execute.
+     */
+    uint64 events[PerformanceCounterNumberOfEvents];
+
+    /**
+     * The number of elements (times the number of samples) processed in each cycle.
+     */
+    uint64 elements;
+
+    /**
+     * True if the input and output brokers are included in the measurement.
+     */
+    bool includeBrokers;
+
+    /**
+     * The CountsPerElement of the baseline (if hasBaseline).
+     */
+    float64 baseline;
+    bool hasBaseline;
+};
+
+static void MainBenchmarkErrorProcessFunction(const ErrorManagement::ErrorInformation &errorInfo,
+                                              const char8 * const errorDescription) {
+    StreamString errorCodeStr;
+    ErrorManagement::ErrorCodeToStream(errorInfo.header.errorType, errorCodeStr);
+    printf("[%s - %s:%d]: %s\n", errorCodeStr.Buffer(), errorInfo.fileName, errorInfo.header.lineNumber, errorDescription);
+}
+
+static void PrintUsage() {
+    printf("Usage: MainBenchmark.ex -f <configuration> [-i iterations] [-w warmup] [-p] [-b baseline] [-t tolerance] [-o results]\n");
+    printf("    -f the configuration file with the Functions and Data sections (see MainBenchmark.cpp)\n");
+    printf("    -i the number of measured cycles\n");
+    printf("    -w the number of cycles executed before the measurement\n");
+    printf("    -p count the hardware events of each GAM::Execute in a second pass\n");
+    printf("    -b the results of a previous run to compare with\n");
+    printf("    -t the maximum increase (in %%) of the counts per element with respect to the baseline\n");
+    printf("    -o the file where the results are written\n");
+}
+
+static int CompareCounts(const void * const a,
+                         const void * const b) {
+    uint64 countA = *static_cast<const uint64 *>(a);
+    uint64 countB = *static_cast<const uint64 *>(b);
+    int ret = 0;
+    if (countA < countB) {
+        ret = -1;
+    }
+    else if (countA > countB) {
+        ret = 1;
+    }
+    else {
+        ret = 0;
+    }
+    return ret;
+}
+
+/**
+ * @brief Parses the configuration file.
+ */
+static bool ReadConfiguration(const char8 * const fileName,
+                              ConfigurationDatabase &cdb) {
+    File configurationFile;
+    bool ok = configurationFile.Open(fileName, BasicFile::ACCESS_MODE_R);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not open the file %s", fileName);
+    }
+    if (ok) {
+        StreamString parserError;
+        StandardParser parser(configurationFile, cdb, &parserError);
+        ok = parser.Parse();
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not parse the file %s: %s", fileName, parserError.Buffer());
+        }
+        (void) configurationFile.Close();
+    }
+    return ok;
+}
+
+/**
+ * @brief Wraps the Functions and the Data of the configuration in the Benchmark RealTimeApplication.
+ */
+static bool BuildApplication(ConfigurationDatabase &cdb,
+                             ConfigurationDatabase &applicationCdb,
+                             Vector<StreamString> &functionNames) {
+    bool ok = cdb.MoveAbsolute("Functions");
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The Functions section shall be specified");
+    }
+    uint32 nOfFunctions = 0u;
+    if (ok) {
+        nOfFunctions = cdb.GetNumberOfChildren();
+        ok = (nOfFunctions > 0u);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "At least one GAM shall be specified in the Functions section");
+        }
+    }
+    if (ok) {
+        functionNames.SetSize(nOfFunctions);
+        for (uint32 i = 0u; i < nOfFunctions; i++) {
+            const char8 * const childName = cdb.GetChildName(i);
+            //Remove the + of the object names
+            functionNames[i] = (childName[0] == '+') ? (&childName[1]) : (childName);
+        }
+    }
+    //The other objects (e.g. a MemoryGate) are created before the application, which may refer to them
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    uint32 nOfRootNodes = 0u;
+    if (ok) {
+        nOfRootNodes = cdb.GetNumberOfChildren();
+    }
+    for (uint32 i = 0u; (i < nOfRootNodes) && (ok); i++) {
+        StreamString nodeName = cdb.GetChildName(i);
+        if (nodeName.Buffer()[0] == '+') {
+            ok = applicationCdb.CreateAbsolute(nodeName.Buffer());
+            if (ok) {
+                ok = cdb.MoveRelative(nodeName.Buffer());
+            }
+            if (ok) {
+                ok = cdb.Copy(applicationCdb);
+            }
+            if (ok) {
+                ok = cdb.MoveToRoot();
+            }
+        }
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("Functions");
+    }
+    if (ok) {
+        ok = applicationCdb.CreateAbsolute("$Benchmark");
+    }
+    if (ok) {
+        ok = applicationCdb.Write("Class", "RealTimeApplication");
+    }
+    if (ok) {
+        ok = applicationCdb.CreateRelative("+Functions");
+    }
+    if (ok) {
+        ok = cdb.Copy(applicationCdb);
+    }
+    if (ok) {
+        ok = applicationCdb.Write("Class", "ReferenceContainer");
+    }
+    if (ok) {
+        ok = applicationCdb.CreateAbsolute("$Benchmark.+Data");
+    }
+    if (ok) {
+        if (cdb.MoveAbsolute("Data")) {
+            ok = cdb.Copy(applicationCdb);
+        }
+    }
+    if (ok) {
+        ok = applicationCdb.Write("Class", "ReferenceContainer");
+    }
+    if (ok) {
+        ok = applicationCdb.Write("DefaultDataSource", "DDB");
+    }
+    if (ok) {
+        ok = applicationCdb.CreateAbsolute("$Benchmark.+Data.+DDB");
+    }
+    if (ok) {
+        ok = applicationCdb.Write("Class", "GAMDataSource");
+    }
+    if (ok) {
+        ok = applicationCdb.CreateAbsolute("$Benchmark.+Data.+Timings");
+    }
+    if (ok) {
+        ok = applicationCdb.Write("Class", "TimingDataSource");
+    }
+    if (ok) {
+        ok = applicationCdb.CreateAbsolute("$Benchmark.+States");
+    }
+    if (ok) {
+        ok = applicationCdb.Write("Class", "ReferenceContainer");
+    }
+    if (ok) {
+        ok = applicationCdb.CreateRelative("+Benchmark");
+    }
+    if (ok) {
+        ok = applicationCdb.Write("Class", "RealTimeState");
+    }
+    if (ok) {
+        ok = applicationCdb.CreateRelative("+Threads");
+    }
+    if (ok) {
+        ok = applicationCdb.Write("Class", "ReferenceContainer");
+    }
+    if (ok) {
+        ok = applicationCdb.CreateRelative("+Thread1");
+    }
+    if (ok) {
+        ok = applicationCdb.Write("Class", "RealTimeThread");
+    }
+    if (ok) {
+        ok = applicationCdb.Write("Functions", functionNames);
+    }
+    if (ok) {
+        ok = applicationCdb.CreateAbsolute("$Benchmark.+Scheduler");
+    }
+    if (ok) {
+        ok = applicationCdb.Write("Class", "GAMScheduler");
+    }
+    if (ok) {
+        ok = applicationCdb.Write("TimingDataSource", "Timings");
+    }
+    if (ok) {
+        ok = applicationCdb.MoveToRoot();
+    }
+    return ok;
+}
+
+static bool ExecuteBrokers(ReferenceContainer &brokers) {
+    bool ok = true;
+    uint32 nOfBrokers = brokers.Size();
+    for (uint32 i = 0u; (i < nOfBrokers) && (ok); i++) {
+        ReferenceT<BrokerI> broker = brokers.Get(i);
+        ok = broker.IsValid();
+        if (ok) {
+            ok = broker->Execute();
+        }
+    }
+    return ok;
+}
+
+static bool GenerateSignals(ReferenceContainer &sources) {
+    bool ok = true;
+    uint32 nOfSources = sources.Size();
+    for (uint32 i = 0u; (i < nOfSources) && (ok); i++) {
+        ReferenceT<BenchmarkDataSource> source = sources.Get(i);
+        ok = source->Generate();
+    }
+    return ok;
+}
+
+/**
+ * @brief Executes a cycle of all the GAMs.
+ * @param[in] countIdx the index in the BenchmarkedGAM::counts where to store the measurement (or -1 not to store it).
+ * @param[in] counters if not NULL the hardware events are counted instead of the timer counts.
+ */
+static bool ExecuteCycle(ReferenceContainer &sources,
+                         BenchmarkedGAM * const gams,
+                         const uint32 nOfGAMs,
+                         const int32 countIdx,
+                         PerformanceCounters * const counters) {
+    bool ok = GenerateSignals(sources);
+    for (uint32 i = 0u; (i < nOfGAMs) && (ok); i++) {
+        uint64 start = HighResolutionTimer::Counter();
+        uint64 end = 0u;
+        ok = ExecuteBrokers(gams[i].inputBrokers);
+        if (ok) {
+            if (counters != NULL_PTR(PerformanceCounters *)) {
+                uint64 events[PerformanceCounterNumberOfEvents];
+                counters->Start();
+                ok = gams[i].gam->Execute();
+                if (counters->Stop(events)) {
+                    for (uint32 e = 0u; e < static_cast<uint32>(PerformanceCounterNumberOfEvents); e++) {
+                        gams[i].events[e] += events[e];
+                    }
+                }
+            }
+            else {
+                if (!gams[i].includeBrokers) {
+                    start = HighResolutionTimer::Counter();
+                }
+                ok = gams[i].gam->Execute();
+                end = HighResolutionTimer::Counter();
+            }
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "%s::Execute failed", gams[i].name.Buffer());
+            }
+        }
+        if (ok) {
+            ok = ExecuteBrokers(gams[i].outputBrokers);
+        }
+        if ((ok) && (counters == NULL_PTR(PerformanceCounters *)) && (countIdx >= 0)) {
+            if (gams[i].includeBrokers) {
+                end = HighResolutionTimer::Counter();
+            }
+            gams[i].counts[countIdx] = (end - start);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Counts the elements (times the samples) of the input signals of a GAM (of its output signals if it has no inputs).
+ */
+static uint64 CountElements(ReferenceT<GAM> gam) {
+    SignalDirection direction = (gam->GetNumberOfInputSignals() > 0u) ? (InputSignals) : (OutputSignals);
+    uint32 nOfSignals = (direction == InputSignals) ? (gam->GetNumberOfInputSignals()) : (gam->GetNumberOfOutputSignals());
+    uint64 elements = 0u;
+    for (uint32 s = 0u; s < nOfSignals; s++) {
+        uint32 nOfElements = 0u;
+        uint32 nOfSamples = 0u;
+        if ((gam->GetSignalNumberOfElements(direction, s, nOfElements)) && (gam->GetSignalNumberOfSamples(direction, s, nOfSamples))) {
+            elements += (static_cast<uint64>(nOfElements) * nOfSamples);
+        }
+    }
+    return elements;
+}
+
+/**
+ * @brief Reads the CountsPerElement of each GAM from the Results section of a previous run.
+ */
+static bool ReadBaseline(const char8 * const baselineFileName,
+                         BenchmarkedGAM * const gams,
+                         const uint32 nOfGAMs) {
+    ConfigurationDatabase baselineCdb;
+    bool ok = ReadConfiguration(baselineFileName, baselineCdb);
+    for (uint32 i = 0u; (i < nOfGAMs) && (ok); i++) {
+        StreamString path = "Results.";
+        path += gams[i].name;
+        if (baselineCdb.MoveAbsolute(path.Buffer())) {
+            gams[i].hasBaseline = baselineCdb.Read("CountsPerElement", gams[i].baseline);
+        }
+        if (!gams[i].hasBaseline) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "%s is not in the baseline %s", gams[i].name.Buffer(), baselineFileName);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Prints the statistics of a GAM, compares its CountsPerElement with the baseline and appends its results section.
+ * @return false if the CountsPerElement exceeds the baseline by more than tolerance %.
+ */
+static bool Report(BenchmarkedGAM &benchmarkedGAM,
+                   const uint32 iterations,
+                   const bool reportEvents,
+                   const float64 tolerance,
+                   StreamString &results) {
+    qsort(benchmarkedGAM.counts, iterations, sizeof(uint64), &CompareCounts);
+    uint32 p99Idx = static_cast<uint32>((static_cast<uint64>(iterations) * 99u) / 100u);
+    if (p99Idx >= iterations) {
+        p99Idx = (iterations - 1u);
+    }
+    const uint64 statistics[] = { benchmarkedGAM.counts[0], benchmarkedGAM.counts[iterations / 2u], benchmarkedGAM.counts[p99Idx],
+            benchmarkedGAM.counts[iterations - 1u] };
+    const char8 * const statisticsNames[] = { "Min", "Median", "P99", "Max" };
+    float64 periodMicroseconds = HighResolutionTimer::Period() * 1e6;
+    printf("%s\n", benchmarkedGAM.name.Buffer());
+    for (uint32 i = 0u; i < 4u; i++) {
+        printf("    %-8s %12llu counts %12.3f us\n", statisticsNames[i], static_cast<unsigned long long>(statistics[i]),
+               static_cast<float64>(statistics[i]) * periodMicroseconds);
+    }
+    if (reportEvents) {
+        for (uint32 e = 0u; e < static_cast<uint32>(PerformanceCounterNumberOfEvents); e++) {
+            printf("    %-12s %12.1f per Execute\n", PerformanceCounters::GetEventName(static_cast<PerformanceCounterEvent>(e)),
+                   static_cast<float64>(benchmarkedGAM.events[e]) / static_cast<float64>(iterations));
+        }
+    }
+
+    const uint32 LINE_SIZE = 128u;
+    char8 line[LINE_SIZE];
+    float64 countsPerElement = static_cast<float64>(statistics[1]);
+    if (benchmarkedGAM.elements > 0u) {
+        countsPerElement /= static_cast<float64>(benchmarkedGAM.elements);
+    }
+    printf("    %-8s %12.4f counts (%llu elements)\n", "PerElem", countsPerElement, static_cast<unsigned long long>(benchmarkedGAM.elements));
+    (void) snprintf(&line[0], LINE_SIZE, "    %s = {\n", benchmarkedGAM.name.Buffer());
+    results += &line[0];
+    (void) snprintf(&line[0], LINE_SIZE, "        Elements = %llu\n", static_cast<unsigned long long>(benchmarkedGAM.elements));
+    results += &line[0];
+    for (uint32 i = 0u; i < 4u; i++) {
+        (void) snprintf(&line[0], LINE_SIZE, "        %s = %llu\n", statisticsNames[i], static_cast<unsigned long long>(statistics[i]));
+        results += &line[0];
+    }
+    (void) snprintf(&line[0], LINE_SIZE, "        CountsPerElement = %.6g\n", countsPerElement);
+    results += &line[0];
+    bool pass = true;
+    const char8 *status = "NoBaseline";
+    if ((benchmarkedGAM.hasBaseline) && (benchmarkedGAM.baseline > 0.0)) {
+        float64 deviation = ((countsPerElement / benchmarkedGAM.baseline) - 1.0) * 100.0;
+        pass = (deviation <= tolerance);
+        status = (pass) ? ("Pass") : ("Fail");
+        printf("    %-8s %12.4f counts (%+.1f%% %s)\n", "Baseline", benchmarkedGAM.baseline, deviation, status);
+        (void) snprintf(&line[0], LINE_SIZE, "        Baseline = %.6g\n        Deviation = %.2f\n", benchmarkedGAM.baseline, deviation);
+        results += &line[0];
+    }
+    (void) snprintf(&line[0], LINE_SIZE, "        Status = \"%s\"\n    }\n", status);
+    results += &line[0];
+    return pass;
+}
+
+/**
+ * @brief Writes the results in a file.
+ */
+static bool WriteResults(const char8 * const resultsFileName,
+                         StreamString &results) {
+    File resultsFile;
+    bool ok = resultsFile.Open(resultsFileName, BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT | BasicFile::FLAG_TRUNC);
+    if (ok) {
+        uint32 size = static_cast<uint32>(results.Size());
+        ok = resultsFile.Write(results.Buffer(), size);
+        (void) resultsFile.Close();
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not write the results in %s", resultsFileName);
+    }
+    return ok;
+}
+
+int main(int argc,
+         char **argv) {
+    SetErrorProcessFunction(&MainBenchmarkErrorProcessFunction);
+
+    const char8 *fileName = NULL_PTR(const char8 *);
+    int32 iterations = -1;
+    int32 warmup = -1;
+    bool countEvents = false;
+    StreamString baselineFileName;
+    StreamString resultsFileName;
+    float64 tolerance = -1.0;
+    bool ok = true;
+    for (int32 a = 1; (a < argc) && (ok); a++) {
+        StreamString option = argv[a];
+        if (option == "-p") {
+            countEvents = true;
+        }
+        else if ((a + 1) < argc) {
+            if (option == "-f") {
+                fileName = argv[a + 1];
+            }
+            else if (option == "-i") {
+                iterations = static_cast<int32>(atoi(argv[a + 1]));
+            }
+            else if (option == "-w") {
+                warmup = static_cast<int32>(atoi(argv[a + 1]));
+            }
+            else if (option == "-b") {
+                baselineFileName = argv[a + 1];
+            }
+            else if (option == "-t") {
+                tolerance = static_cast<float64>(atof(argv[a + 1]));
+            }
+            else if (option == "-o") {
+                resultsFileName = argv[a + 1];
+            }
+            else {
+                ok = false;
+            }
+            a++;
+        }
+        else {
+            ok = false;
+        }
+    }
+    if (ok) {
+        ok = (fileName != NULL_PTR(const char8 *));
+    }
+    if (!ok) {
+        PrintUsage();
+    }
+
+    ConfigurationDatabase cdb;
+    Vector<StreamString> includeBrokers;
+    if (ok) {
+        ok = ReadConfiguration(fileName, cdb);
+    }
+    if (ok) {
+        uint32 value = 0u;
+        if (cdb.MoveAbsolute("Benchmark")) {
+            if ((iterations < 0) && (cdb.Read("Iterations", value))) {
+                iterations = static_cast<int32>(value);
+            }
+            if ((warmup < 0) && (cdb.Read("Warmup", value))) {
+                warmup = static_cast<int32>(value);
+            }
+            if ((!countEvents) && (cdb.Read("PerformanceCounters", value))) {
+                countEvents = (value == 1u);
+            }
+            if (baselineFileName.Size() == 0u) {
+                (void) cdb.Read("Baseline", baselineFileName);
+            }
+            if (resultsFileName.Size() == 0u) {
+                (void) cdb.Read("Results", resultsFileName);
+            }
+            if (tolerance < 0.0) {
+                if (!cdb.Read("Tolerance", tolerance)) {
+                    tolerance = -1.0;
+                }
+            }
+            AnyType includeBrokersType = cdb.GetType("IncludeBrokers");
+            if (!includeBrokersType.IsVoid()) {
+                uint32 nOfIncludeBrokers = includeBrokersType.GetNumberOfElements(0u);
+                includeBrokers.SetSize(nOfIncludeBrokers);
+                ok = cdb.Read("IncludeBrokers", includeBrokers);
+                if (!ok) {
+                    REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not read IncludeBrokers");
+                }
+            }
+        }
+        if (iterations < 0) {
+            iterations = 10000;
+        }
+        if (warmup < 0) {
+            warmup = 100;
+        }
+        if (tolerance < 0.0) {
+            tolerance = 10.0;
+        }
+        if (ok) {
+            ok = (iterations > 0);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The number of iterations shall be > 0");
+            }
+        }
+    }
+
+    ConfigurationDatabase applicationCdb;
+    Vector<StreamString> functionNames;
+    if (ok) {
+        ok = BuildApplication(cdb, applicationCdb, functionNames);
+    }
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        ok = ord->Initialise(applicationCdb);
+    }
+    if (ok) {
+        application = ord->Find("Benchmark");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("Benchmark");
+    }
+
+    //Find the BenchmarkDataSource instances
+    ReferenceContainer sources;
+    if (ok) {
+        ReferenceT<ReferenceContainer> data = ord->Find("Benchmark.Data");
+        ok = data.IsValid();
+        if (ok) {
+            uint32 nOfDataSources = data->Size();
+            for (uint32 i = 0u; (i < nOfDataSources) && (ok); i++) {
+                ReferenceT<BenchmarkDataSource> source = data->Get(i);
+                if (source.IsValid()) {
+                    ok = sources.Insert(source);
+                }
+            }
+        }
+    }
+
+    uint32 nOfGAMs = functionNames.GetNumberOfElements();
+    BenchmarkedGAM *gams = NULL_PTR(BenchmarkedGAM *);
+    if (ok) {
+        gams = new BenchmarkedGAM[nOfGAMs];
+        for (uint32 i = 0u; i < nOfGAMs; i++) {
+            gams[i].counts = NULL_PTR(uint64 *);
+        }
+        for (uint32 i = 0u; (i < nOfGAMs) && (ok); i++) {
+            gams[i].name = functionNames[i];
+            gams[i].counts = new uint64[static_cast<uint32>(iterations)];
+            for (uint32 e = 0u; e < static_cast<uint32>(PerformanceCounterNumberOfEvents); e++) {
+                gams[i].events[e] = 0u;
+            }
+            gams[i].elements = 0u;
+            gams[i].includeBrokers = false;
+            gams[i].baseline = 0.0;
+            gams[i].hasBaseline = false;
+            for (uint32 b = 0u; b < includeBrokers.GetNumberOfElements(); b++) {
+                if (includeBrokers[b] == gams[i].name) {
+                    gams[i].includeBrokers = true;
+                }
+            }
+            StreamString gamPath = "Benchmark.Functions.";
+            gamPath += functionNames[i];
+            gams[i].gam = ord->Find(gamPath.Buffer());
+            ok = gams[i].gam.IsValid();
+            if (ok) {
+                ok = gams[i].gam->GetInputBrokers(gams[i].inputBrokers);
+            }
+            if (ok) {
+                ok = gams[i].gam->GetOutputBrokers(gams[i].outputBrokers);
+            }
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not get the brokers of %s", gamPath.Buffer());
+            }
+            if (ok) {
+                gams[i].elements = CountElements(gams[i].gam);
+            }
+        }
+    }
+    if ((ok) && (baselineFileName.Size() > 0u)) {
+        ok = ReadBaseline(baselineFileName.Buffer(), gams, nOfGAMs);
+    }
+
+    for (int32 n = 0; (n < warmup) && (ok); n++) {
+        ok = ExecuteCycle(sources, gams, nOfGAMs, -1, NULL_PTR(PerformanceCounters *));
+    }
+    for (int32 n = 0; (n < iterations) && (ok); n++) {
+        ok = ExecuteCycle(sources, gams, nOfGAMs, n, NULL_PTR(PerformanceCounters *));
+    }
+    bool reportEvents = false;
+    if ((ok) && (countEvents)) {
+        PerformanceCounters counters;
+        reportEvents = counters.IsAvailable();
+        if (reportEvents) {
+            for (int32 n = 0; (n < iterations) && (ok); n++) {
+                ok = ExecuteCycle(sources, gams, nOfGAMs, -1, &counters);
+            }
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "The performance counters are not available");
+        }
+    }
+
+    if (ok) {
+        //The overhead of reading the timer is included in each measurement
+        uint64 overhead = 0u;
+        for (uint32 n = 0u; n < 1000u; n++) {
+            uint64 start = HighResolutionTimer::Counter();
+            uint64 delta = HighResolutionTimer::Counter() - start;
+            if ((n == 0u) || (delta < overhead)) {
+                overhead = delta;
+            }
+        }
+        printf("Iterations = %d Warmup = %d Timer frequency = %llu Hz Timer overhead = %llu counts\n", iterations, warmup,
+               static_cast<unsigned long long>(HighResolutionTimer::Frequency()), static_cast<unsigned long long>(overhead));
+        StreamString results;
+        const uint32 LINE_SIZE = 256u;
+        char8 line[LINE_SIZE];
+        (void) snprintf(&line[0], LINE_SIZE, "Benchmark = {\n    Iterations = %d\n    Warmup = %d\n    Frequency = %llu\n    Overhead = %llu\n    Tolerance = %.2f\n}\n",
+                        iterations, warmup, static_cast<unsigned long long>(HighResolutionTimer::Frequency()), static_cast<unsigned long long>(overhead),
+                        tolerance);
+        results += &line[0];
+        results += "Results = {\n";
+        uint32 nOfFailures = 0u;
+        for (uint32 i = 0u; i < nOfGAMs; i++) {
+            if (!Report(gams[i], static_cast<uint32>(iterations), reportEvents, tolerance, results)) {
+                nOfFailures++;
+            }
+        }
+        results += "}\n";
+        if (resultsFileName.Size() > 0u) {
+            ok = WriteResults(resultsFileName.Buffer(), results);
+        }
+        if (nOfFailures > 0u) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "%u GAM(s) exceeded the baseline by more than the Tolerance", nOfFailures);
+            ok = false;
+        }
+    }
+
+    if (gams != NULL_PTR(BenchmarkedGAM *)) {
+        for (uint32 i = 0u; i < nOfGAMs; i++) {
+            if (gams[i].counts != NULL_PTR(uint64 *)) {
+                delete[] gams[i].counts;
+            }
+        }
+        delete[] gams;
+    }
+    ord->Purge();
+    return ok ? 0 : -1;
+}
@@ -0,0 +1,634 @@
+/**
+ * @file MainDataSourceBenchmark.cpp
+ * @brief Source file for the MainDataSourceBenchmark executable
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details Runs a RealTimeApplication where the DataSources under test are written by BenchmarkSourceGAM instances
+ * and read back (loopback) by BenchmarkSinkGAM instances, and reports for each of these GAMs the sustained throughput,
+ * the histograms of the cycle time and of the latency and the number of dropped buffers.
+ *
+ * Usage: MainDataSourceBenchmark.ex -f <configuration> [-a application] [-s state] [-d seconds] [-r seconds] [-o report]
+ *
+ * The configuration file is a standard RealTimeApplication configuration (see the *Loopback.cfg examples) with an
+ * optional Benchmark section (the command line options override these values):
+ * <pre>
+ * Benchmark = {
+ *     Application = App //Default = the first RealTimeApplication.
+ *     State = State1 //Default = the first state of the application.
+ *     Duration = 10 //Seconds. Default = 10.
+ *     ReportPeriod = 60 //Seconds (-r). Default = 0 (only the final report).
+ *     Report = "soak.csv" //File where the periodic reports are written (-o). Default = none.
+ *     Fifos = { //Optional. Throttled readers of named pipes, created before the application (see BenchmarkFifoSink).
+ *         Writer = {
+ *             Path = "/tmp/soak.fifo"
+ *             BytesPerSecond = 1000000
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * Soak tests: with ReportPeriod > 0 the application is sampled every ReportPeriod seconds for the whole Duration (e.g. hours)
+ * and one line per BenchmarkSourceGAM, BenchmarkSinkGAM and BenchmarkFifoSink is written (CSV) in the Report with:
+ * Time (s), Name, Kind (Source, Sink or Fifo), Count (cycles, new buffers or rows), Dropped, Backlog (cycles of the Source not yet
+ * received by the sink, i.e. the occupancy of the queues between them), P50, P99 and Max (us, of the cycle time for a Source and of the
+ * latency for the sinks, in the reporting interval) and RSS (kB, resident memory of the process). At the end the maximum backlog, the
+ * growth of the backlog and of the RSS (least squares, per hour) are printed, so that the NumberOfBuffers of the asynchronous brokers
+ * can be sized from the data. A sink is throttled with its Throttle parameter (BenchmarkSinkGAM) or with BytesPerSecond (BenchmarkFifoSink,
+ * e.g. as the Filename of a FileWriter, see FileWriterSoak.cfg).
+ *
+ * The signal sizes are set by the NumberOfElements of the payload signals of the BenchmarkSourceGAM and BenchmarkSinkGAM.
+ * The throughput is computed from the first to the last cycle of the source and from the first to the last new buffer
+ * received by the sink. The DataSource and GAM classes which are not linked with the executable are loaded from the shared
+ * libraries found in the LD_LIBRARY_PATH.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BenchmarkFifoSink.h"
+#include "BenchmarkSinkGAM.h"
+#include "BenchmarkSourceGAM.h"
+#include "ConfigurationDatabase.h"
+#include "File.h"
+#include "GlobalObjectsDatabase.h"
+#include "HighResolutionTimer.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "Sleep.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+static void MainDataSourceBenchmarkErrorProcessFunction(const ErrorManagement::ErrorInformation &errorInfo,
+                                                        const char8 * const errorDescription) {
+    StreamString errorCodeStr;
+    ErrorManagement::ErrorCodeToStream(errorInfo.header.errorType, errorCodeStr);
+    printf("[%s - %s:%d]: %s\n", errorCodeStr.Buffer(), errorInfo.fileName, errorInfo.header.lineNumber, errorDescription);
+}
+
+static void PrintUsage() {
+    printf("Usage: MainDataSourceBenchmark.ex -f <configuration> [-a application] [-s state] [-d seconds] [-r seconds] [-o report]\n");
+    printf("    -f the RealTimeApplication configuration file (see MainDataSourceBenchmark.cpp)\n");
+    printf("    -a the name of the RealTimeApplication\n");
+    printf("    -s the name of the state to benchmark\n");
+    printf("    -d the duration of the benchmark in seconds\n");
+    printf("    -r the period of the soak test reports in seconds\n");
+    printf("    -o the file where the soak test reports are written (CSV)\n");
+}
+
+static float64 ToSeconds(const uint64 counts) {
+    return static_cast<float64>(counts) * HighResolutionTimer::Period();
+}
+
+static float64 ToMegaBytesPerSecond(const uint64 bytes,
+                                    const uint64 counts) {
+    float64 throughput = 0.;
+    if (counts > 0u) {
+        throughput = (static_cast<float64>(bytes) / ToSeconds(counts)) / 1e6;
+    }
+    return throughput;
+}
+
+static void ReportSource(ReferenceT<BenchmarkSourceGAM> &source) {
+    uint64 bytes = source->GetNumberOfCycles() * static_cast<uint64>(source->GetCycleByteSize());
+    printf("Source %s: %llu cycles of %u bytes in %.3f s, %.3f MB/s\n", source->GetName(), static_cast<unsigned long long>(source->GetNumberOfCycles()),
+           source->GetCycleByteSize(), ToSeconds(source->GetElapsedCounts()), ToMegaBytesPerSecond(bytes, source->GetElapsedCounts()));
+    source->GetCycleHistogram().Print("Cycle time");
+}
+
+static void ReportSink(ReferenceT<BenchmarkSinkGAM> &sink) {
+    printf("Sink %s: %llu received (%llu bytes) in %.3f s, %.3f MB/s, %llu dropped, %llu repeated, %llu out of order\n", sink->GetName(),
+           static_cast<unsigned long long>(sink->GetNumberOfReceived()), static_cast<unsigned long long>(sink->GetReceivedBytes()),
+           ToSeconds(sink->GetElapsedCounts()), ToMegaBytesPerSecond(sink->GetReceivedBytes(), sink->GetElapsedCounts()),
+           static_cast<unsigned long long>(sink->GetNumberOfDropped()), static_cast<unsigned long long>(sink->GetNumberOfRepeated()),
+           static_cast<unsigned long long>(sink->GetNumberOfOutOfOrder()));
+    sink->GetLatencyHistogram().Print("Latency");
+    sink->GetCycleHistogram().Print("Cycle time");
+}
+
+/**
+ * @brief Reports all the BenchmarkSourceGAM and BenchmarkSinkGAM in the container (and in its sub-containers, e.g. GAMGroup).
+ */
+static void Report(ReferenceT<ReferenceContainer> &container) {
+    uint32 nOfChildren = container->Size();
+    for (uint32 i = 0u; i < nOfChildren; i++) {
+        ReferenceT<BenchmarkSourceGAM> source = container->Get(i);
+        ReferenceT<BenchmarkSinkGAM> sink = container->Get(i);
+        ReferenceT<ReferenceContainer> subContainer = container->Get(i);
+        if (source.IsValid()) {
+            ReportSource(source);
+        }
+        else if (sink.IsValid()) {
+            ReportSink(sink);
+        }
+        else if (subContainer.IsValid()) {
+            Report(subContainer);
+        }
+        else {
+            //NOOP
+        }
+    }
+}
+
+/**
+ * An element of the soak test reports and its statistics at the previous report.
+ */
+struct SoakElement {
+    /**
+     * The BenchmarkSourceGAM (the element itself if sink and fifo are not valid, otherwise the one which feeds the sink).
+     */
+    ReferenceT<BenchmarkSourceGAM> source;
+
+    /**
+     * The BenchmarkSinkGAM or the BenchmarkFifoSink (if any).
+     */
+    ReferenceT<BenchmarkSinkGAM> sink;
+    ReferenceT<BenchmarkFifoSink> fifo;
+
+    /**
+     * The reported histogram at the previous report.
+     */
+    BenchmarkHistogram previousHistogram;
+
+    /**
+     * The maximum backlog.
+     */
+    uint64 maxBacklog;
+
+    /**
+     * The sums of the least squares fit of the backlog with time.
+     */
+    float64 sumTime;
+    float64 sumBacklog;
+    float64 sumTimeTime;
+    float64 sumTimeBacklog;
+    uint32 numberOfSamples;
+};
+
+/**
+ * @brief Collects the BenchmarkSourceGAM and BenchmarkSinkGAM in the container (and in its sub-containers).
+ */
+static void CollectSoakElements(ReferenceT<ReferenceContainer> &container,
+                                ReferenceContainer &sources,
+                                ReferenceContainer &sinks) {
+    uint32 nOfChildren = container->Size();
+    for (uint32 i = 0u; i < nOfChildren; i++) {
+        ReferenceT<BenchmarkSourceGAM> source = container->Get(i);
+        ReferenceT<BenchmarkSinkGAM> sink = container->Get(i);
+        ReferenceT<ReferenceContainer> subContainer = container->Get(i);
+        if (source.IsValid()) {
+            (void) sources.Insert(source);
+        }
+        else if (sink.IsValid()) {
+            (void) sinks.Insert(sink);
+        }
+        else if (subContainer.IsValid()) {
+            CollectSoakElements(subContainer, sources, sinks);
+        }
+        else {
+            //NOOP
+        }
+    }
+}
+
+/**
+ * @brief Finds the BenchmarkSourceGAM with a given name (the first one if the name is empty).
+ */
+static ReferenceT<BenchmarkSourceGAM> FindSoakSource(ReferenceContainer &sources,
+                                                      const StreamString &name) {
+    ReferenceT<BenchmarkSourceGAM> source;
+    uint32 nOfSources = sources.Size();
+    for (uint32 i = 0u; (i < nOfSources) && (!source.IsValid()); i++) {
+        ReferenceT<BenchmarkSourceGAM> candidate = sources.Get(i);
+        if ((name.Size() == 0u) || (name == candidate->GetName())) {
+            source = candidate;
+        }
+    }
+    if (!source.IsValid()) {
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not find the BenchmarkSourceGAM %s: the backlog will not be reported", name.Buffer());
+    }
+    return source;
+}
+
+/**
+ * @brief Gets the resident memory of the process in kB (0 if /proc/self/statm cannot be read).
+ */
+static uint64 GetResidentMemory() {
+    uint64 residentKB = 0u;
+    FILE *statm = fopen("/proc/self/statm", "r");
+    if (statm != NULL_PTR(FILE *)) {
+        unsigned long long sizePages = 0u;
+        unsigned long long residentPages = 0u;
+        if (fscanf(statm, "%llu %llu", &sizePages, &residentPages) == 2) {
+            residentKB = (static_cast<uint64>(residentPages) * static_cast<uint64>(sysconf(_SC_PAGESIZE))) / 1024u;
+        }
+        (void) fclose(statm);
+    }
+    return residentKB;
+}
+
+/**
+ * @brief Samples all the elements and writes one line per element in the report (and in the standard output).
+ */
+static void SampleSoakElements(SoakElement * const elements,
+                               const uint32 nOfElements,
+                               const float64 time,
+                               const uint64 residentKB,
+                               FILE * const report) {
+    float64 periodMicroseconds = HighResolutionTimer::Period() * 1e6;
+    for (uint32 e = 0u; e < nOfElements; e++) {
+        SoakElement &element = elements[e];
+        const char8 *name = "";
+        const char8 *kind = "";
+        uint64 count = 0u;
+        uint64 dropped = 0u;
+        uint64 lastSequence = 0u;
+        bool hasBacklog = element.source.IsValid();
+        BenchmarkHistogram current;
+        if (element.sink.IsValid()) {
+            name = element.sink->GetName();
+            kind = "Sink";
+            count = element.sink->GetNumberOfReceived();
+            dropped = element.sink->GetNumberOfDropped();
+            lastSequence = element.sink->GetLastSequence();
+            current = element.sink->GetLatencyHistogram();
+        }
+        else if (element.fifo.IsValid()) {
+            name = element.fifo->GetName();
+            kind = "Fifo";
+            count = element.fifo->GetNumberOfRows();
+            dropped = element.fifo->GetNumberOfDropped();
+            lastSequence = element.fifo->GetLastSequence();
+            current = element.fifo->GetLatencyHistogram();
+        }
+        else {
+            name = element.source->GetName();
+            kind = "Source";
+            count = element.source->GetNumberOfCycles();
+            current = element.source->GetCycleHistogram();
+            hasBacklog = false;
+        }
+        uint64 backlog = 0u;
+        if (hasBacklog) {
+            uint64 produced = element.source->GetNumberOfCycles();
+            backlog = (produced > lastSequence) ? (produced - lastSequence) : (0u);
+            if (backlog > element.maxBacklog) {
+                element.maxBacklog = backlog;
+            }
+            element.sumTime += time;
+            element.sumBacklog += static_cast<float64>(backlog);
+            element.sumTimeTime += (time * time);
+            element.sumTimeBacklog += (time * static_cast<float64>(backlog));
+            element.numberOfSamples++;
+        }
+        BenchmarkHistogram interval;
+        interval.Difference(current, element.previousHistogram);
+        element.previousHistogram = current;
+        float64 p50 = static_cast<float64>(interval.GetQuantile(0.5)) * periodMicroseconds;
+        float64 p99 = static_cast<float64>(interval.GetQuantile(0.99)) * periodMicroseconds;
+        float64 max = static_cast<float64>(interval.GetMaximum()) * periodMicroseconds;
+        printf("%10.1f s %-16s %-6s count = %llu dropped = %llu backlog = %llu p50 = %.1f us p99 = %.1f us max = %.1f us rss = %llu kB\n", time, name,
+               kind, static_cast<unsigned long long>(count), static_cast<unsigned long long>(dropped), static_cast<unsigned long long>(backlog), p50,
+               p99, max, static_cast<unsigned long long>(residentKB));
+        if (report != NULL_PTR(FILE *)) {
+            fprintf(report, "%.3f,%s,%s,%llu,%llu,%llu,%.3f,%.3f,%.3f,%llu\n", time, name, kind, static_cast<unsigned long long>(count),
+                    static_cast<unsigned long long>(dropped), static_cast<unsigned long long>(backlog), p50, p99, max,
+                    static_cast<unsigned long long>(residentKB));
+            (void) fflush(report);
+        }
+    }
+}
+
+/**
+ * @brief Least squares slope of y with x.
+ */
+static float64 Slope(const float64 sumX,
+                     const float64 sumY,
+                     const float64 sumXX,
+                     const float64 sumXY,
+                     const uint32 n) {
+    float64 slope = 0.;
+    float64 nF = static_cast<float64>(n);
+    float64 denominator = (nF * sumXX) - (sumX * sumX);
+    if ((n > 1u) && (denominator > 0.)) {
+        slope = ((nF * sumXY) - (sumX * sumY)) / denominator;
+    }
+    return slope;
+}
+
+/**
+ * @brief Runs the application for duration seconds, sampling it every reportPeriod seconds, and prints the soak test summary.
+ */
+static void RunSoakTest(ReferenceT<ReferenceContainer> &functions,
+                        ReferenceContainer &fifos,
+                        const float64 duration,
+                        const float64 reportPeriod,
+                        const StreamString &reportFileName) {
+    ReferenceContainer sources;
+    ReferenceContainer sinks;
+    CollectSoakElements(functions, sources, sinks);
+    uint32 nOfSources = sources.Size();
+    uint32 nOfSinks = sinks.Size();
+    uint32 nOfFifos = fifos.Size();
+    uint32 nOfElements = (nOfSources + nOfSinks + nOfFifos);
+    SoakElement *elements = new SoakElement[nOfElements];
+    for (uint32 e = 0u; e < nOfElements; e++) {
+        elements[e].maxBacklog = 0u;
+        elements[e].sumTime = 0.;
+        elements[e].sumBacklog = 0.;
+        elements[e].sumTimeTime = 0.;
+        elements[e].sumTimeBacklog = 0.;
+        elements[e].numberOfSamples = 0u;
+        if (e < nOfSources) {
+            elements[e].source = sources.Get(e);
+        }
+        else if (e < (nOfSources + nOfSinks)) {
+            elements[e].sink = sinks.Get(e - nOfSources);
+            elements[e].source = FindSoakSource(sources, elements[e].sink->GetSource());
+        }
+        else {
+            elements[e].fifo = fifos.Get(e - nOfSources - nOfSinks);
+            elements[e].source = FindSoakSource(sources, elements[e].fifo->GetSource());
+        }
+    }
+    FILE *report = NULL_PTR(FILE *);
+    if (reportFileName.Size() > 0u) {
+        report = fopen(reportFileName.Buffer(), "w");
+        if (report != NULL_PTR(FILE *)) {
+            fprintf(report, "Time,Name,Kind,Count,Dropped,Backlog,P50,P99,Max,RSS\n");
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not open the report %s", reportFileName.Buffer());
+        }
+    }
+    float64 sumTime = 0.;
+    float64 sumResident = 0.;
+    float64 sumTimeTime = 0.;
+    float64 sumTimeResident = 0.;
+    uint32 numberOfSamples = 0u;
+    uint64 firstResident = GetResidentMemory();
+    uint64 maxResident = firstResident;
+    uint64 start = HighResolutionTimer::Counter();
+    float64 time = 0.;
+    while (time < duration) {
+        float64 nextReport = (time + reportPeriod);
+        if (nextReport > duration) {
+            nextReport = duration;
+        }
+        //Sleep until the next report, compensating the time spent sampling
+        Sleep::Sec(nextReport - time);
+        time = ToSeconds(HighResolutionTimer::Counter() - start);
+        uint64 resident = GetResidentMemory();
+        if (resident > maxResident) {
+            maxResident = resident;
+        }
+        sumTime += time;
+        sumResident += static_cast<float64>(resident);
+        sumTimeTime += (time * time);
+        sumTimeResident += (time * static_cast<float64>(resident));
+        numberOfSamples++;
+        SampleSoakElements(elements, nOfElements, time, resident, report);
+    }
+    if (report != NULL_PTR(FILE *)) {
+        (void) fclose(report);
+    }
+    const float64 SECONDS_PER_HOUR = 3600.;
+    printf("Soak test summary (%.1f s, %u reports)\n", time, numberOfSamples);
+    printf("    RSS: first = %llu kB, max = %llu kB, growth = %.1f kB/hour\n", static_cast<unsigned long long>(firstResident),
+           static_cast<unsigned long long>(maxResident), Slope(sumTime, sumResident, sumTimeTime, sumTimeResident, numberOfSamples) * SECONDS_PER_HOUR);
+    for (uint32 e = 0u; e < nOfElements; e++) {
+        if (elements[e].numberOfSamples > 0u) {
+            const char8 *name = (elements[e].sink.IsValid()) ? (elements[e].sink->GetName()) : (elements[e].fifo->GetName());
+            printf("    %s: max backlog = %llu cycles, backlog growth = %.1f cycles/hour\n", name,
+                   static_cast<unsigned long long>(elements[e].maxBacklog),
+                   Slope(elements[e].sumTime, elements[e].sumBacklog, elements[e].sumTimeTime, elements[e].sumTimeBacklog, elements[e].numberOfSamples)
+                           * SECONDS_PER_HOUR);
+        }
+    }
+    delete[] elements;
+}
+
+/**
+ * @brief Creates the BenchmarkFifoSink instances of the Fifos section.
+ */
+static bool CreateFifos(ConfigurationDatabase &cdb,
+                        ReferenceContainer &fifos) {
+    bool ok = true;
+    if (cdb.MoveAbsolute("Benchmark.Fifos")) {
+        uint32 nOfFifos = cdb.GetNumberOfChildren();
+        for (uint32 i = 0u; (i < nOfFifos) && (ok); i++) {
+            StreamString fifoName = cdb.GetChildName(i);
+            ReferenceT<BenchmarkFifoSink> fifo(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+            fifo->SetName(fifoName.Buffer());
+            ok = cdb.MoveRelative(fifoName.Buffer());
+            if (ok) {
+                ok = fifo->Initialise(cdb);
+            }
+            if (ok) {
+                ok = fifos.Insert(fifo);
+            }
+            if (ok) {
+                ok = cdb.MoveToAncestor(1u);
+            }
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not create the fifo %s", fifoName.Buffer());
+            }
+        }
+    }
+    return ok;
+}
+
+int main(int argc,
+         char **argv) {
+    SetErrorProcessFunction(&MainDataSourceBenchmarkErrorProcessFunction);
+
+    const char8 *fileName = NULL_PTR(const char8 *);
+    StreamString applicationName;
+    StreamString stateName;
+    float64 duration = -1.0;
+    float64 reportPeriod = -1.0;
+    StreamString reportFileName;
+    bool ok = true;
+    for (int32 a = 1; (a < argc) && (ok); a++) {
+        StreamString option = argv[a];
+        ok = ((a + 1) < argc);
+        if (ok) {
+            if (option == "-f") {
+                fileName = argv[a + 1];
+            }
+            else if (option == "-a") {
+                applicationName = argv[a + 1];
+            }
+            else if (option == "-s") {
+                stateName = argv[a + 1];
+            }
+            else if (option == "-d") {
+                duration = atof(argv[a + 1]);
+            }
+            else if (option == "-r") {
+                reportPeriod = atof(argv[a + 1]);
+            }
+            else if (option == "-o") {
+                reportFileName = argv[a + 1];
+            }
+            else {
+                ok = false;
+            }
+            a++;
+        }
+    }
+    if (ok) {
+        ok = (fileName != NULL_PTR(const char8 *));
+    }
+    if (!ok) {
+        PrintUsage();
+    }
+
+    ConfigurationDatabase cdb;
+    if (ok) {
+        File configurationFile;
+        ok = configurationFile.Open(fileName, BasicFile::ACCESS_MODE_R);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not open the file %s", fileName);
+        }
+        if (ok) {
+            StreamString parserError;
+            StandardParser parser(configurationFile, cdb, &parserError);
+            ok = parser.Parse();
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not parse the file %s: %s", fileName, parserError.Buffer());
+            }
+            (void) configurationFile.Close();
+        }
+    }
+    if (ok) {
+        if (cdb.MoveAbsolute("Benchmark")) {
+            if (applicationName.Size() == 0u) {
+                (void) cdb.Read("Application", applicationName);
+            }
+            if (stateName.Size() == 0u) {
+                (void) cdb.Read("State", stateName);
+            }
+            if (duration < 0.0) {
+                (void) cdb.Read("Duration", duration);
+            }
+            if (reportPeriod < 0.0) {
+                (void) cdb.Read("ReportPeriod", reportPeriod);
+            }
+            if (reportFileName.Size() == 0u) {
+                (void) cdb.Read("Report", reportFileName);
+            }
+        }
+        if (duration < 0.0) {
+            duration = 10.0;
+        }
+    }
+    //The fifos shall be open before the DataSources which write to them
+    ReferenceContainer fifos;
+    if (ok) {
+        ok = CreateFifos(cdb, fifos);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    if (ok) {
+        if (applicationName.Size() > 0u) {
+            application = ord->Find(applicationName.Buffer());
+        }
+        else {
+            uint32 nOfObjects = ord->Size();
+            for (uint32 i = 0u; (i < nOfObjects) && (!application.IsValid()); i++) {
+                application = ord->Get(i);
+            }
+        }
+        ok = application.IsValid();
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not find the RealTimeApplication");
+        }
+    }
+    if (ok) {
+        applicationName = application->GetName();
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        if (stateName.Size() == 0u) {
+            StreamString statesPath = applicationName;
+            statesPath += ".States";
+            ReferenceT<ReferenceContainer> states = ord->Find(statesPath.Buffer());
+            ok = states.IsValid();
+            if (ok) {
+                ok = (states->Size() > 0u);
+            }
+            if (ok) {
+                stateName = states->Get(0u)->GetName();
+            }
+        }
+    }
+    if (ok) {
+        ok = application->PrepareNextState(stateName.Buffer());
+    }
+    if (ok) {
+        printf("Running %s in %s for %.3f s\n", applicationName.Buffer(), stateName.Buffer(), duration);
+        ok = application->StartNextStateExecution();
+    }
+    ReferenceT<ReferenceContainer> functions;
+    if (ok) {
+        StreamString functionsPath = applicationName;
+        functionsPath += ".Functions";
+        functions = ord->Find(functionsPath.Buffer());
+        ok = functions.IsValid();
+    }
+    if (ok) {
+        if (reportPeriod > 0.0) {
+            RunSoakTest(functions, fifos, duration, reportPeriod, reportFileName);
+        }
+        else {
+            Sleep::Sec(duration);
+        }
+        ok = application->StopCurrentStateExecution();
+    }
+    if (ok) {
+        Report(functions);
+        uint32 nOfFifos = fifos.Size();
+        for (uint32 i = 0u; i < nOfFifos; i++) {
+            ReferenceT<BenchmarkFifoSink> fifo = fifos.Get(i);
+            printf("Fifo %s: %llu bytes, %llu rows read, %llu dropped\n", fifo->GetName(), static_cast<unsigned long long>(fifo->GetBytesRead()),
+                   static_cast<unsigned long long>(fifo->GetNumberOfRows()), static_cast<unsigned long long>(fifo->GetNumberOfDropped()));
+            fifo->GetLatencyHistogram().Print("Latency");
+        }
+    }
+    ord->Purge();
+    fifos.Purge();
+    return ok ? 0 : -1;
+}
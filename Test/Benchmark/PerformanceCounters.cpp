@@ -0,0 +1,135 @@
+/**
+ * @file PerformanceCounters.cpp
+ * @brief Source file for class PerformanceCounters
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PerformanceCounters (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "PerformanceCounters.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+PerformanceCounters::PerformanceCounters() {
+    for (uint32 i = 0u; i < static_cast<uint32>(PerformanceCounterNumberOfEvents); i++) {
+        descriptors[i] = -1;
+    }
+#ifdef __linux__
+    const uint64 configs[PerformanceCounterNumberOfEvents] = { PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES };
+    for (uint32 i = 0u; i < static_cast<uint32>(PerformanceCounterNumberOfEvents); i++) {
+        struct perf_event_attr attributes;
+        (void) memset(&attributes, 0, sizeof(attributes));
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.size = sizeof(attributes);
+        attributes.config = configs[i];
+        attributes.disabled = 1u;
+        attributes.exclude_kernel = 1u;
+        attributes.exclude_hv = 1u;
+        //pid = 0 and cpu = -1: the calling thread on any CPU
+        descriptors[i] = static_cast<int32>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+    }
+#endif
+}
+
+PerformanceCounters::~PerformanceCounters() {
+#ifdef __linux__
+    for (uint32 i = 0u; i < static_cast<uint32>(PerformanceCounterNumberOfEvents); i++) {
+        if (descriptors[i] >= 0) {
+            (void) close(descriptors[i]);
+        }
+    }
+#endif
+}
+
+bool PerformanceCounters::IsAvailable() const {
+    bool ok = true;
+    for (uint32 i = 0u; (i < static_cast<uint32>(PerformanceCounterNumberOfEvents)) && (ok); i++) {
+        ok = (descriptors[i] >= 0);
+    }
+    return ok;
+}
+
+void PerformanceCounters::Start() {
+#ifdef __linux__
+    if (IsAvailable()) {
+        for (uint32 i = 0u; i < static_cast<uint32>(PerformanceCounterNumberOfEvents); i++) {
+            (void) ioctl(descriptors[i], PERF_EVENT_IOC_RESET, 0);
+        }
+        for (uint32 i = 0u; i < static_cast<uint32>(PerformanceCounterNumberOfEvents); i++) {
+            (void) ioctl(descriptors[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+bool PerformanceCounters::Stop(uint64 (&values)[PerformanceCounterNumberOfEvents]) {
+    bool ok = IsAvailable();
+#ifdef __linux__
+    if (ok) {
+        for (uint32 i = 0u; i < static_cast<uint32>(PerformanceCounterNumberOfEvents); i++) {
+            (void) ioctl(descriptors[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+        for (uint32 i = 0u; (i < static_cast<uint32>(PerformanceCounterNumberOfEvents)) && (ok); i++) {
+            ok = (read(descriptors[i], &values[i], sizeof(uint64)) == static_cast<ssize_t>(sizeof(uint64)));
+        }
+    }
+#endif
+    return ok;
+}
+
+const char8 *PerformanceCounters::GetEventName(const PerformanceCounterEvent event) {
+    const char8 *name = "Unknown";
+    if (event == PerformanceCounterInstructions) {
+        name = "Instructions";
+    }
+    else if (event == PerformanceCounterCacheMisses) {
+        name = "CacheMisses";
+    }
+    else if (event == PerformanceCounterBranchMisses) {
+        name = "BranchMisses";
+    }
+    else {
+        //NOOP
+    }
+    return name;
+}
+
+}
@@ -0,0 +1,109 @@
+/**
+ * @file PerformanceCounters.h
+ * @brief Header file for class PerformanceCounters
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class PerformanceCounters
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PERFORMANCECOUNTERS_H_
+#define PERFORMANCECOUNTERS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The hardware events which are counted.
+ */
+enum PerformanceCounterEvent {
+    PerformanceCounterInstructions = 0,
+    PerformanceCounterCacheMisses = 1,
+    PerformanceCounterBranchMisses = 2,
+    PerformanceCounterNumberOfEvents = 3
+};
+
+/**
+ * @brief Counts hardware events (instructions, cache misses and branch misses) of the calling thread.
+ * @details On Linux the events are counted with perf_event_open (which may require
+ * /proc/sys/kernel/perf_event_paranoid <= 2). On the other operating systems, or if the events cannot be opened,
+ * IsAvailable returns false and the other methods are NOOP.
+ */
+class PerformanceCounters {
+public:
+
+    /**
+     * @brief Constructor. Opens the counters (disabled).
+     */
+    PerformanceCounters();
+
+    /**
+     * @brief Destructor. Closes the counters.
+     */
+    ~PerformanceCounters();
+
+    /**
+     * @brief Checks if all the counters could be opened.
+     * @return true if all the counters could be opened.
+     */
+    bool IsAvailable() const;
+
+    /**
+     * @brief Resets and enables the counters.
+     */
+    void Start();
+
+    /**
+     * @brief Disables the counters and reads their values.
+     * @param[out] values the number of events counted since the last Start (indexed by PerformanceCounterEvent).
+     * @return true if all the counters could be read.
+     */
+    bool Stop(uint64 (&values)[PerformanceCounterNumberOfEvents]);
+
+    /**
+     * @brief Gets the name of an event.
+     * @param[in] event the event.
+     * @return the name of the event.
+     */
+    static const char8 *GetEventName(const PerformanceCounterEvent event);
+
+private:
+
+    /**
+     * The file descriptor of each counter (-1 if it could not be opened).
+     */
+    int32 descriptors[PerformanceCounterNumberOfEvents];
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PERFORMANCECOUNTERS_H_ */
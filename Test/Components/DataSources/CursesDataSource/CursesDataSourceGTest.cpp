@@ -0,0 +1,104 @@
+/**
+ * @file CursesDataSourceGTest.cpp
+ * @brief Source file for class CursesDataSourceGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CursesDataSourceGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "CursesDataSourceTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(CursesDataSourceGTest,TestConstructor) {
+    CursesDataSourceTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(CursesDataSourceGTest,TestInitialise) {
+    CursesDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(CursesDataSourceGTest,TestInitialise_False_RefreshPeriod) {
+    CursesDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_RefreshPeriod());
+}
+
+TEST(CursesDataSourceGTest,TestInitialise_False_SamplePeriod) {
+    CursesDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_SamplePeriod());
+}
+
+TEST(CursesDataSourceGTest,TestInitialise_False_MaxElements) {
+    CursesDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_MaxElements());
+}
+
+TEST(CursesDataSourceGTest,TestGetBrokerName) {
+    CursesDataSourceTest test;
+    ASSERT_TRUE(test.TestGetBrokerName());
+}
+
+TEST(CursesDataSourceGTest,TestGetInputBrokers) {
+    CursesDataSourceTest test;
+    ASSERT_TRUE(test.TestGetInputBrokers());
+}
+
+TEST(CursesDataSourceGTest,TestGetOutputBrokers) {
+    CursesDataSourceTest test;
+    ASSERT_TRUE(test.TestGetOutputBrokers());
+}
+
+TEST(CursesDataSourceGTest,TestSetConfiguredDatabase_False_Samples) {
+    CursesDataSourceTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_Samples());
+}
+
+TEST(CursesDataSourceGTest,TestSynchronise_SamplePeriod) {
+    CursesDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise_SamplePeriod());
+}
+
+TEST(CursesDataSourceGTest,TestRender) {
+    CursesDataSourceTest test;
+    ASSERT_TRUE(test.TestRender());
+}
+
+TEST(CursesDataSourceGTest,TestRender_NoSnapshot) {
+    CursesDataSourceTest test;
+    ASSERT_TRUE(test.TestRender_NoSnapshot());
+}
+
+TEST(CursesDataSourceGTest,TestRender_MaxElements) {
+    CursesDataSourceTest test;
+    ASSERT_TRUE(test.TestRender_MaxElements());
+}
@@ -0,0 +1,392 @@
+/**
+ * @file CursesDataSourceTest.cpp
+ * @brief Source file for class CursesDataSourceTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CursesDataSourceTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "CursesDataSourceTest.h"
+#include "GAM.h"
+#include "MemoryOperationsHelper.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class CursesDataSourceTestGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    virtual bool Setup();
+
+    virtual bool Execute();
+};
+
+bool CursesDataSourceTestGAM::Setup() {
+    return true;
+}
+
+bool CursesDataSourceTestGAM::Execute() {
+    return true;
+}
+
+CLASS_REGISTER(CursesDataSourceTestGAM, "1.0")
+
+/**
+ * @brief Configures an application where a CursesDataSourceTestGAM (GAMA) writes the signals of a CursesDataSource
+ * (Monitor) with the parameters in dataSourceConfig and the GAM output signals in signalsConfig.
+ */
+static bool InitialiseCursesApplication(const char8 * const dataSourceConfig,
+                                        const char8 * const signalsConfig) {
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = CursesDataSourceTestGAM"
+            "            OutputSignals = {";
+    config += signalsConfig;
+    config += ""
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Monitor = {"
+            "            Class = CursesDataSource";
+    config += dataSourceConfig;
+    config += ""
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    config.Seek(0);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * The GAM output signals.
+ */
+static const char8 * const cursesSignalsConfig = ""
+        "                Current = {"
+        "                    DataSource = Monitor"
+        "                    Type = float32"
+        "                }"
+        "                Counters = {"
+        "                    DataSource = Monitor"
+        "                    Type = uint32"
+        "                    NumberOfElements = 4"
+        "                }"
+        "                Mode = {"
+        "                    DataSource = Monitor"
+        "                    Type = char8"
+        "                    NumberOfElements = 8"
+        "                }";
+
+/**
+ * @brief Configures the application with the DataSource parameters in dataSourceConfig and gets the DataSource.
+ */
+static bool GetCursesDataSource(const char8 * const dataSourceConfig,
+                                ReferenceT<CursesDataSource> &dataSource) {
+    bool ok = InitialiseCursesApplication(dataSourceConfig, cursesSignalsConfig);
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Monitor");
+        ok = dataSource.IsValid();
+    }
+    return ok;
+}
+
+/**
+ * @brief Writes the value of the signals on the DataSource memory.
+ */
+static bool WriteCursesSignals(ReferenceT<CursesDataSource> &dataSource,
+                               const float32 current,
+                               const uint32 counterOffset,
+                               const char8 * const mode) {
+    uint32 idx = 0u;
+    void *address = NULL_PTR(void *);
+    bool ok = dataSource->GetSignalIndex(idx, "Current");
+    if (ok) {
+        ok = dataSource->GetSignalMemoryBuffer(idx, 0u, address);
+    }
+    if (ok) {
+        *static_cast<float32 *>(address) = current;
+        ok = dataSource->GetSignalIndex(idx, "Counters");
+    }
+    if (ok) {
+        ok = dataSource->GetSignalMemoryBuffer(idx, 0u, address);
+    }
+    if (ok) {
+        uint32 *counters = static_cast<uint32 *>(address);
+        for (uint32 i = 0u; i < 4u; i++) {
+            counters[i] = counterOffset + i;
+        }
+        ok = dataSource->GetSignalIndex(idx, "Mode");
+    }
+    if (ok) {
+        ok = dataSource->GetSignalMemoryBuffer(idx, 0u, address);
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Set(address, '\0', 8u);
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(address, mode, StringHelper::Length(mode));
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool CursesDataSourceTest::TestConstructor() {
+    CursesDataSource dataSource;
+    bool ret = (dataSource.GetRefreshPeriod() == 200u);
+    ret &= (dataSource.GetSamplePeriod() == 1u);
+    ret &= (dataSource.GetMaxElements() == 8u);
+    ret &= (dataSource.GetNumberOfSnapshots() == 0u);
+    return ret;
+}
+
+bool CursesDataSourceTest::TestInitialise() {
+    CursesDataSource dataSource;
+    ConfigurationDatabase cdb;
+    bool ret = cdb.Write("RefreshPeriod", 500);
+    ret &= cdb.Write("SamplePeriod", 10);
+    ret &= cdb.Write("MaxElements", 4);
+    ret &= cdb.CreateAbsolute("Signals");
+    ret &= cdb.MoveToRoot();
+    if (ret) {
+        ret = dataSource.Initialise(cdb);
+    }
+    if (ret) {
+        ret = (dataSource.GetRefreshPeriod() == 500u);
+        ret &= (dataSource.GetSamplePeriod() == 10u);
+        ret &= (dataSource.GetMaxElements() == 4u);
+    }
+    return ret;
+}
+
+bool CursesDataSourceTest::TestInitialise_False_RefreshPeriod() {
+    CursesDataSource dataSource;
+    ConfigurationDatabase cdb;
+    bool ret = cdb.Write("RefreshPeriod", 0);
+    ret &= cdb.CreateAbsolute("Signals");
+    ret &= cdb.MoveToRoot();
+    if (ret) {
+        ret = !dataSource.Initialise(cdb);
+    }
+    return ret;
+}
+
+bool CursesDataSourceTest::TestInitialise_False_SamplePeriod() {
+    CursesDataSource dataSource;
+    ConfigurationDatabase cdb;
+    bool ret = cdb.Write("SamplePeriod", 0);
+    ret &= cdb.CreateAbsolute("Signals");
+    ret &= cdb.MoveToRoot();
+    if (ret) {
+        ret = !dataSource.Initialise(cdb);
+    }
+    return ret;
+}
+
+bool CursesDataSourceTest::TestInitialise_False_MaxElements() {
+    CursesDataSource dataSource;
+    ConfigurationDatabase cdb;
+    bool ret = cdb.Write("MaxElements", 0);
+    ret &= cdb.CreateAbsolute("Signals");
+    ret &= cdb.MoveToRoot();
+    if (ret) {
+        ret = !dataSource.Initialise(cdb);
+    }
+    return ret;
+}
+
+bool CursesDataSourceTest::TestGetBrokerName() {
+    CursesDataSource dataSource;
+    ConfigurationDatabase cdb;
+    StreamString brokerName = dataSource.GetBrokerName(cdb, OutputSignals);
+    bool ret = (brokerName == "MemoryMapSynchronisedOutputBroker");
+    if (ret) {
+        ret = (dataSource.GetBrokerName(cdb, InputSignals) == NULL_PTR(const char8 *));
+    }
+    return ret;
+}
+
+bool CursesDataSourceTest::TestGetInputBrokers() {
+    CursesDataSource dataSource;
+    ReferenceContainer rc;
+    return !dataSource.GetInputBrokers(rc, "", NULL_PTR(void *));
+}
+
+bool CursesDataSourceTest::TestGetOutputBrokers() {
+    bool ret = InitialiseCursesApplication("", cursesSignalsConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool CursesDataSourceTest::TestSetConfiguredDatabase_False_Samples() {
+    const char8 * const signalsConfig = ""
+            "                Current = {"
+            "                    DataSource = Monitor"
+            "                    Type = float32"
+            "                    Samples = 2"
+            "                }";
+    bool ret = !InitialiseCursesApplication("", signalsConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool CursesDataSourceTest::TestSynchronise_SamplePeriod() {
+    ReferenceT<CursesDataSource> dataSource;
+    bool ret = GetCursesDataSource("            SamplePeriod = 3", dataSource);
+    for (uint32 i = 0u; (i < 7u) && (ret); i++) {
+        ret = dataSource->Synchronise();
+    }
+    if (ret) {
+        ret = (dataSource->GetNumberOfSnapshots() == 2u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool CursesDataSourceTest::TestRender() {
+    ReferenceT<CursesDataSource> dataSource;
+    bool ret = GetCursesDataSource("", dataSource);
+    if (ret) {
+        ret = WriteCursesSignals(dataSource, 1.5F, 10u, "RUN");
+    }
+    if (ret) {
+        ret = dataSource->Synchronise();
+    }
+    //Values written after the snapshot shall not be shown
+    if (ret) {
+        ret = WriteCursesSignals(dataSource, 2.5F, 20u, "STOP");
+    }
+    StreamString screen;
+    if (ret) {
+        ret = dataSource->Render(screen);
+    }
+    if (ret) {
+        ret = (StringHelper::SearchString(screen.Buffer(), "Current") != NULL_PTR(const char8 *));
+        ret &= (StringHelper::SearchString(screen.Buffer(), "1.5") != NULL_PTR(const char8 *));
+        ret &= (StringHelper::SearchString(screen.Buffer(), "10 11 12 13") != NULL_PTR(const char8 *));
+        ret &= (StringHelper::SearchString(screen.Buffer(), "\"RUN\"") != NULL_PTR(const char8 *));
+        ret &= (StringHelper::SearchString(screen.Buffer(), "STOP") == NULL_PTR(const char8 *));
+    }
+    if (ret) {
+        ret = dataSource->Synchronise();
+    }
+    if (ret) {
+        screen = "";
+        ret = dataSource->Render(screen);
+    }
+    if (ret) {
+        ret = (StringHelper::SearchString(screen.Buffer(), "20 21 22 23") != NULL_PTR(const char8 *));
+        ret &= (StringHelper::SearchString(screen.Buffer(), "\"STOP\"") != NULL_PTR(const char8 *));
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool CursesDataSourceTest::TestRender_NoSnapshot() {
+    ReferenceT<CursesDataSource> dataSource;
+    bool ret = GetCursesDataSource("", dataSource);
+    StreamString screen;
+    if (ret) {
+        ret = !dataSource->Render(screen);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool CursesDataSourceTest::TestRender_MaxElements() {
+    ReferenceT<CursesDataSource> dataSource;
+    bool ret = GetCursesDataSource("            MaxElements = 2", dataSource);
+    if (ret) {
+        ret = WriteCursesSignals(dataSource, 1.5F, 10u, "RUN");
+    }
+    if (ret) {
+        ret = dataSource->Synchronise();
+    }
+    StreamString screen;
+    if (ret) {
+        ret = dataSource->Render(screen);
+    }
+    if (ret) {
+        ret = (StringHelper::SearchString(screen.Buffer(), "10 11 ... (4 elements)") != NULL_PTR(const char8 *));
+        ret &= (StringHelper::SearchString(screen.Buffer(), "12") == NULL_PTR(const char8 *));
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file CursesDataSourceTest.h
+ * @brief Header file for class CursesDataSourceTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CursesDataSourceTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CURSESDATASOURCETEST_H_
+#define CURSESDATASOURCETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CursesDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the CursesDataSource methods
+ */
+class CursesDataSourceTest {
+public:
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails with RefreshPeriod = 0
+     */
+    bool TestInitialise_False_RefreshPeriod();
+
+    /**
+     * @brief Tests that the Initialise method fails with SamplePeriod = 0
+     */
+    bool TestInitialise_False_SamplePeriod();
+
+    /**
+     * @brief Tests that the Initialise method fails with MaxElements = 0
+     */
+    bool TestInitialise_False_MaxElements();
+
+    /**
+     * @brief Tests the GetBrokerName method
+     */
+    bool TestGetBrokerName();
+
+    /**
+     * @brief Tests that the GetInputBrokers method returns false
+     */
+    bool TestGetInputBrokers();
+
+    /**
+     * @brief Tests the GetOutputBrokers method in an application
+     */
+    bool TestGetOutputBrokers();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if a signal has more than one sample
+     */
+    bool TestSetConfiguredDatabase_False_Samples();
+
+    /**
+     * @brief Tests that the Synchronise method only publishes a snapshot every SamplePeriod calls
+     */
+    bool TestSynchronise_SamplePeriod();
+
+    /**
+     * @brief Tests that the Render method shows the values of the last published snapshot
+     */
+    bool TestRender();
+
+    /**
+     * @brief Tests that the Render method returns false if no snapshot was published
+     */
+    bool TestRender_NoSnapshot();
+
+    /**
+     * @brief Tests that the Render method truncates the arrays to MaxElements
+     */
+    bool TestRender_MaxElements();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* CURSESDATASOURCETEST_H_ */
@@ -109,6 +109,36 @@ TEST(DANSourceGTest,TestInitialise) {
     ASSERT_TRUE(test.TestInitialise());
 }
 
+TEST(DANSourceGTest,TestInitialise_Publishers) {
+    DANSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_Publishers());
+}
+
+TEST(DANSourceGTest,TestInitialise_False_PublisherQueueDepth_0) {
+    DANSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_PublisherQueueDepth_0());
+}
+
+TEST(DANSourceGTest,TestGetPublisherStatistics) {
+    DANSourceTest test;
+    ASSERT_TRUE(test.TestGetPublisherStatistics());
+}
+
+TEST(DANSourceGTest,TestInitialise_TriggerWindow) {
+    DANSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_TriggerWindow());
+}
+
+TEST(DANSourceGTest,TestInitialise_False_TriggerWindow_NoPublishers) {
+    DANSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_TriggerWindow_NoPublishers());
+}
+
+TEST(DANSourceGTest,TestInitialise_False_TriggerWindow_PublisherQueueDepth) {
+    DANSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_TriggerWindow_PublisherQueueDepth());
+}
+
 TEST(DANSourceGTest,TestInitialise_False_NumberOfBuffers) {
     DANSourceTest test;
     ASSERT_TRUE(test.TestInitialise_False_NumberOfBuffers());
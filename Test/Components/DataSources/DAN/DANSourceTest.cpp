@@ -2352,6 +2352,140 @@ bool DANSourceTest::TestInitialise() {
     return ok;
 }
 
+bool DANSourceTest::TestInitialise_Publishers() {
+    using namespace MARTe;
+    DANSource test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("DanBufferMultiplier", 4);
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("NumberOfPublishers", 2);
+    cdb.Write("PublisherCPUMask", 3);
+    cdb.Write("PublisherQueueDepth", 8);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetNumberOfPublishers() == 2);
+    ok &= (test.GetPublisherCPUMask() == 3);
+    ok &= (test.GetPublisherQueueDepth() == 8);
+    ok &= (test.GetStreamPublisher(0) == 0);
+    ok &= (test.GetStreamPublisher(3) == 1);
+    return ok;
+}
+
+bool DANSourceTest::TestInitialise_False_PublisherQueueDepth_0() {
+    using namespace MARTe;
+    DANSource test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("DanBufferMultiplier", 4);
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("NumberOfPublishers", 2);
+    cdb.Write("PublisherQueueDepth", 0);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool DANSourceTest::TestGetPublisherStatistics() {
+    using namespace MARTe;
+    DANSource test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("DanBufferMultiplier", 4);
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("NumberOfPublishers", 2);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ReferenceContainer emptyMessage;
+    if (ok) {
+        ok = (test.GetPublisherStatistics(emptyMessage) != ErrorManagement::NoError);
+    }
+    ReferenceT<ConfigurationDatabase> stats(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceContainer message;
+    if (ok) {
+        ok = message.Insert(stats);
+    }
+    if (ok) {
+        ok = (test.GetPublisherStatistics(message) == ErrorManagement::NoError);
+    }
+    uint32 numberOfPublishers = 0u;
+    if (ok) {
+        stats->MoveToRoot();
+        ok = stats->Read("NumberOfPublishers", numberOfPublishers);
+    }
+    if (ok) {
+        ok = (numberOfPublishers == 2u);
+    }
+    return ok;
+}
+
+bool DANSourceTest::TestInitialise_TriggerWindow() {
+    using namespace MARTe;
+    DANSource test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("DanBufferMultiplier", 4);
+    cdb.Write("StoreOnTrigger", 1);
+    cdb.Write("NumberOfPreTriggers", 6);
+    cdb.Write("NumberOfPostTriggers", 2);
+    cdb.Write("NumberOfPublishers", 1);
+    cdb.Write("PublisherQueueDepth", 10);
+    cdb.Write("TriggerWindow", 1);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = !test.IsTriggerWindow();
+    ok &= test.Initialise(cdb);
+    ok &= test.IsTriggerWindow();
+    ok &= (StringHelper::Compare(test.GetBrokerName(cdb, OutputSignals), "MemoryMapSynchronisedOutputBroker") == 0);
+    return ok;
+}
+
+bool DANSourceTest::TestInitialise_False_TriggerWindow_NoPublishers() {
+    using namespace MARTe;
+    DANSource test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("DanBufferMultiplier", 4);
+    cdb.Write("StoreOnTrigger", 1);
+    cdb.Write("NumberOfPreTriggers", 6);
+    cdb.Write("NumberOfPostTriggers", 2);
+    cdb.Write("TriggerWindow", 1);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool DANSourceTest::TestInitialise_False_TriggerWindow_PublisherQueueDepth() {
+    using namespace MARTe;
+    DANSource test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("DanBufferMultiplier", 4);
+    cdb.Write("StoreOnTrigger", 1);
+    cdb.Write("NumberOfPreTriggers", 6);
+    cdb.Write("NumberOfPostTriggers", 2);
+    cdb.Write("NumberOfPublishers", 1);
+    cdb.Write("PublisherQueueDepth", 6);
+    cdb.Write("TriggerWindow", 1);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
 bool DANSourceTest::TestInitialise_False_NumberOfBuffers() {
     using namespace MARTe;
     DANSource test;
@@ -120,6 +120,36 @@ public:
      */
     bool TestInitialise();
 
+    /**
+     * @brief Tests the Initialise method with the publisher threads parameters.
+     */
+    bool TestInitialise_Publishers();
+
+    /**
+     * @brief Tests the Initialise method with PublisherQueueDepth = 0.
+     */
+    bool TestInitialise_False_PublisherQueueDepth_0();
+
+    /**
+     * @brief Tests the GetPublisherStatistics method.
+     */
+    bool TestGetPublisherStatistics();
+
+    /**
+     * @brief Tests the Initialise method with TriggerWindow = 1.
+     */
+    bool TestInitialise_TriggerWindow();
+
+    /**
+     * @brief Tests the Initialise method with TriggerWindow = 1 and NumberOfPublishers = 0.
+     */
+    bool TestInitialise_False_TriggerWindow_NoPublishers();
+
+    /**
+     * @brief Tests the Initialise method with TriggerWindow = 1 and PublisherQueueDepth <= NumberOfPreTriggers.
+     */
+    bool TestInitialise_False_TriggerWindow_PublisherQueueDepth();
+
     /**
      * @brief Tests the Initialise method without specifying the number of buffers.
      */
@@ -79,6 +79,26 @@ TEST(DANStreamGTest,TestPutData_False) {
     ASSERT_TRUE(test.TestPutData_False());
 }
 
+TEST(DANStreamGTest,TestIsZeroCopy) {
+    DANStreamTest test;
+    ASSERT_TRUE(test.TestIsZeroCopy());
+}
+
+TEST(DANStreamGTest,TestPutData_Queue) {
+    DANStreamTest test;
+    ASSERT_TRUE(test.TestPutData_Queue());
+}
+
+TEST(DANStreamGTest,TestPublishQueued) {
+    DANStreamTest test;
+    ASSERT_TRUE(test.TestPublishQueued());
+}
+
+TEST(DANStreamGTest,TestPublishQueued_TriggerWindow) {
+    DANStreamTest test;
+    ASSERT_TRUE(test.TestPublishQueued_TriggerWindow());
+}
+
 TEST(DANStreamGTest,TestPutData_UInt16) {
     DANStreamTest test;
     ASSERT_TRUE(test.TestPutData_UInt16());
@@ -359,6 +359,200 @@ bool DANStreamTest::TestPutData_False() {
     return !ds.PutData();
 }
 
+bool DANStreamTest::TestIsZeroCopy() {
+    using namespace MARTe;
+
+    //This is required in order to create the dan_initLibrary
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 1);
+    cdb.Write("StackSize", 1048576);
+    cdb.Write("DanBufferMultiplier", 4);
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    DANSource danSource;
+    danSource.Initialise(cdb);
+
+    DANStream dsInterleave(Float32Bit, "DANStreamTestI", 4, 2e6, 1000, true);
+    dsInterleave.AddSignal(0u);
+    dsInterleave.AddSignal(2u);
+    dsInterleave.Finalise();
+    bool ok = !dsInterleave.IsZeroCopy();
+    ok &= dsInterleave.PutData();
+
+    DANStream dsNoInterleave(Float32Bit, "DANStreamTestN", 4, 2e6, 1000, false);
+    dsNoInterleave.AddSignal(0u);
+    dsNoInterleave.AddSignal(2u);
+    dsNoInterleave.Finalise();
+    ok &= dsNoInterleave.IsZeroCopy();
+
+    DANStream dsOneSample(UnsignedInteger16Bit, "DANStreamTestS", 4, 2e6, 1, true);
+    dsOneSample.AddSignal(0u);
+    dsOneSample.AddSignal(2u);
+    dsOneSample.Finalise();
+    ok &= dsOneSample.IsZeroCopy();
+
+    DANStream dsOneSignal(UnsignedInteger16Bit, "DANStreamTestO", 4, 2e6, 1000, true);
+    dsOneSignal.AddSignal(0u);
+    dsOneSignal.Finalise();
+    ok &= dsOneSignal.IsZeroCopy();
+    return ok;
+}
+
+bool DANStreamTest::TestPutData_Queue() {
+    using namespace MARTe;
+
+    //This is required in order to create the dan_initLibrary
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 1);
+    cdb.Write("StackSize", 1048576);
+    cdb.Write("DanBufferMultiplier", 4);
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    DANSource danSource;
+    bool ok = danSource.Initialise(cdb);
+
+    DANStream ds(Float32Bit, "DANStreamTest", 4, 1e3, 5, true);
+    ds.AddSignal(0u);
+    ds.AddSignal(2u);
+    ds.SetQueueDepth(2u);
+    ds.Finalise();
+    if (ok) {
+        ok = ds.PutData();
+    }
+    if (ok) {
+        ok = ds.PutData();
+    }
+    if (ok) {
+        ok = !ds.PutData();
+    }
+    if (ok) {
+        ok = (ds.GetBacklog() == 2u);
+    }
+    if (ok) {
+        ok = (ds.GetMaxBacklog() == 2u);
+    }
+    if (ok) {
+        ok = (ds.GetNumberOfQueueFull() == 1u);
+    }
+    return ok;
+}
+
+bool DANStreamTest::TestPublishQueued() {
+    using namespace MARTe;
+
+    //This is required in order to create the dan_initLibrary
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 1);
+    cdb.Write("StackSize", 1048576);
+    cdb.Write("DanBufferMultiplier", 4);
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    DANSource danSource;
+    bool ok = danSource.Initialise(cdb);
+
+    DANStream ds(Float32Bit, "DANStreamTest", 4, 1e3, 5, true);
+    ds.AddSignal(0u);
+    ds.AddSignal(2u);
+    ds.SetQueueDepth(4u);
+    ds.Finalise();
+    if (ok) {
+        ok = ds.OpenStream();
+    }
+    if (ok) {
+        ok = ds.PutData();
+    }
+    if (ok) {
+        ok = ds.PutData();
+    }
+    if (ok) {
+        ok = ds.PublishQueued();
+    }
+    if (ok) {
+        ok = (ds.GetBacklog() == 0u);
+    }
+    if (ok) {
+        ok = (ds.GetNumberOfPublished() == 2u);
+    }
+    if (ok) {
+        ok = ds.WaitQueued(0u);
+    }
+    if (ok) {
+        ok = ds.CloseStream();
+    }
+    return ok;
+}
+
+bool DANStreamTest::TestPublishQueued_TriggerWindow() {
+    using namespace MARTe;
+
+    //This is required in order to create the dan_initLibrary
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 1);
+    cdb.Write("StackSize", 1048576);
+    cdb.Write("DanBufferMultiplier", 4);
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    DANSource danSource;
+    bool ok = danSource.Initialise(cdb);
+
+    uint8 trigger = 0u;
+    DANStream ds(Float32Bit, "DANStreamTest", 4, 1e3, 5, true);
+    ds.AddSignal(0u);
+    ds.AddSignal(2u);
+    ds.SetQueueDepth(8u);
+    ds.SetTriggerWindow(2u, 1u);
+    ds.SetTriggerSignal(&trigger);
+    ds.Finalise();
+    if (ok) {
+        ok = ds.OpenStream();
+    }
+    //Blocks 1 and 2 are the pre-trigger blocks of the block 3. Block 0 falls out of the pre-trigger window and block 4 is the post-trigger.
+    const uint8 triggers[] = { 0u, 0u, 0u, 1u, 0u, 0u, 0u };
+    uint32 i;
+    for (i = 0u; (i < 7u) && (ok); i++) {
+        trigger = triggers[i];
+        ok = ds.PutData();
+    }
+    if (ok) {
+        ok = (ds.GetBacklog() == 5u);
+    }
+    if (ok) {
+        ok = ds.PublishQueued();
+    }
+    if (ok) {
+        ok = (ds.GetBacklog() == 0u);
+    }
+    if (ok) {
+        ok = (ds.GetNumberOfPublished() == 4u);
+    }
+    if (ok) {
+        ok = (ds.GetNumberOfSkipped() == 1u);
+    }
+    //The last two blocks are held as pre-trigger blocks of the next trigger
+    if (ok) {
+        trigger = 1u;
+        ok = ds.PutData();
+    }
+    if (ok) {
+        ok = ds.PublishQueued();
+    }
+    if (ok) {
+        ok = (ds.GetNumberOfPublished() == 7u);
+    }
+    if (ok) {
+        ok = ds.CloseStream();
+    }
+    return ok;
+}
+
 bool DANStreamTest::TestPutData_UInt16() {
     return TestPutDataT<MARTe::uint16>();
 }
@@ -84,6 +84,26 @@ public:
      */
     bool TestPutData_False();
 
+    /**
+     * @brief Tests the IsZeroCopy method.
+     */
+    bool TestIsZeroCopy();
+
+    /**
+     * @brief Tests the PutData method with a queue depth set (the data is discarded when the queue is full).
+     */
+    bool TestPutData_Queue();
+
+    /**
+     * @brief Tests the PublishQueued method.
+     */
+    bool TestPublishQueued();
+
+    /**
+     * @brief Tests the PublishQueued method with a trigger window.
+     */
+    bool TestPublishQueued_TriggerWindow();
+
     /**
      * @brief Tests the PutData method with uint16.
      */
@@ -139,4 +139,9 @@ TEST(EPICSCAInputGTest,TestExecute_Arrays) {
     EPICSCAInputTest test;
     ASSERT_TRUE(test.TestExecute_Arrays());
 }
+
+TEST(EPICSCAInputGTest,TestSynchronise) {
+    EPICSCAInputTest test;
+    ASSERT_TRUE(test.TestSynchronise());
+}
 	
@@ -963,7 +963,7 @@ bool EPICSCAInputTest::TestGetBrokerName() {
     using namespace MARTe;
     EPICSCAInput test;
     ConfigurationDatabase cdb;
-    bool ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "MemoryMapInputBroker") == 0);
+    bool ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "MemoryMapSynchronisedInputBroker") == 0);
 
     return ok;
 }
@@ -1050,6 +1050,16 @@ bool EPICSCAInputTest::TestSetConfiguredDatabase_False_WrongStringSize() {
     return !TestIntegratedInApplication(config7, true);
 }
 
+bool EPICSCAInputTest::TestSynchronise() {
+    using namespace MARTe;
+    EPICSCAInput test;
+    bool ok = test.Synchronise();
+    if (ok) {
+        ok = (test.GetNumberOfUpdatedPVs() == 0u);
+    }
+    return ok;
+}
+
 bool EPICSCAInputTest::TestExecute() {
     using namespace MARTe;
     bool ok = TestIntegratedInApplication(config1, false);
@@ -145,6 +145,11 @@ public:
      */
     bool TestExecute_Arrays();
 
+    /**
+     * @brief Tests the Synchronise method before the PVs are configured.
+     */
+    bool TestSynchronise();
+
 };
 
 /*---------------------------------------------------------------------------*/
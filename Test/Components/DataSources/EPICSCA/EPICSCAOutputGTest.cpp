@@ -155,6 +155,21 @@ TEST(EPICSCAOutputGTest,TestSetConfiguredDatabase_False_WrongStringSize) {
     ASSERT_TRUE(test.TestSetConfiguredDatabase_False_WrongStringSize());
 }
 
+TEST(EPICSCAOutputGTest,TestSetConfiguredDatabase_Deadband) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_Deadband());
+}
+
+TEST(EPICSCAOutputGTest,TestSetConfiguredDatabase_False_Deadband) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_Deadband());
+}
+
+TEST(EPICSCAOutputGTest,TestInitialise_PutOnChange) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_PutOnChange());
+}
+
 TEST(EPICSCAOutputGTest,TestExecute) {
     EPICSCAOutputTest test;
     ASSERT_TRUE(test.TestExecute());
@@ -993,6 +993,158 @@ static const MARTe::char8 * const config8 = ""
         "    }"
         "}";
 
+//Configuration with PutOnChange and Deadband
+static const MARTe::char8 * const config9 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = EPICSCAOutputGAMTestHelper"
+        "            OutputSignals = {"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAOutputTest"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = EPICSCAOutputTest"
+        "                }"
+        "                SignalFloat32 = {"
+        "                    Type = float32"
+        "                    DataSource = EPICSCAOutputTest"
+        "                }"
+        "                SignalFloat64 = {"
+        "                    Type = float64"
+        "                    DataSource = EPICSCAOutputTest"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +EPICSCAOutputTest = {"
+        "            Class = EPICSCAOutput"
+        "            CPUMask = 15"
+        "            StackSize = 10000000"
+        "            NumberOfBuffers = 8"
+        "            PutOnChange = 1"
+        "            Signals = {"
+        "                SignalUInt32 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::UInt32\""
+        "                }"
+        "                SignalInt32 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Int32\""
+        "                }"
+        "                SignalFloat32 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float32\""
+        "                    Deadband = 0.5"
+        "                }"
+        "                SignalFloat64 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = EPICSCAOutputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with a negative Deadband
+static const MARTe::char8 * const config10 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = EPICSCAOutputGAMTestHelper"
+        "            OutputSignals = {"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAOutputTest"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = EPICSCAOutputTest"
+        "                }"
+        "                SignalFloat32 = {"
+        "                    Type = float32"
+        "                    DataSource = EPICSCAOutputTest"
+        "                }"
+        "                SignalFloat64 = {"
+        "                    Type = float64"
+        "                    DataSource = EPICSCAOutputTest"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +EPICSCAOutputTest = {"
+        "            Class = EPICSCAOutput"
+        "            CPUMask = 15"
+        "            StackSize = 10000000"
+        "            NumberOfBuffers = 8"
+        "            PutOnChange = 1"
+        "            Signals = {"
+        "                SignalUInt32 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::UInt32\""
+        "                }"
+        "                SignalInt32 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Int32\""
+        "                }"
+        "                SignalFloat32 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float32\""
+        "                    Deadband = -1.0"
+        "                }"
+        "                SignalFloat64 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\""
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = EPICSCAOutputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -1149,6 +1301,54 @@ bool EPICSCAOutputTest::TestSetConfiguredDatabase_False_WrongStringSize() {
     return !TestIntegratedInApplication(config8, true);
 }
 
+bool EPICSCAOutputTest::TestSetConfiguredDatabase_Deadband() {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(config9, false);
+    ReferenceT<EPICSCAOutput> test;
+    if (ok) {
+        test = ObjectRegistryDatabase::Instance()->Find("Test.Data.EPICSCAOutputTest");
+        ok = test.IsValid();
+    }
+    if (ok) {
+        ok = test->IsPutOnChange();
+    }
+    uint32 signalIdx = 0u;
+    if (ok) {
+        ok = test->GetSignalIndex(signalIdx, "SignalFloat32");
+    }
+    if (ok) {
+        ok = (test->GetDeadband(signalIdx) == 0.5);
+    }
+    if (ok) {
+        ok = test->GetSignalIndex(signalIdx, "SignalFloat64");
+    }
+    if (ok) {
+        ok = (test->GetDeadband(signalIdx) == 0.0);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool EPICSCAOutputTest::TestSetConfiguredDatabase_False_Deadband() {
+    return !TestIntegratedInApplication(config10, true);
+}
+
+bool EPICSCAOutputTest::TestInitialise_PutOnChange() {
+    using namespace MARTe;
+    EPICSCAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("PutOnChange", 1);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = test.IsPutOnChange();
+        ok &= (test.GetNumberOfSkippedPuts() == 0u);
+    }
+    return ok;
+}
+
 bool EPICSCAOutputTest::TestGetCPUMask() {
     return TestInitialise();
 }
@@ -136,6 +136,21 @@ public:
      */
     bool TestSetConfiguredDatabase_False_WrongStringSize();
 
+    /**
+     * @brief Tests the SetConfiguredDatabase method with PutOnChange and Deadband.
+     */
+    bool TestSetConfiguredDatabase_Deadband();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method with a negative Deadband.
+     */
+    bool TestSetConfiguredDatabase_False_Deadband();
+
+    /**
+     * @brief Tests the Initialise method with PutOnChange.
+     */
+    bool TestInitialise_PutOnChange();
+
     /**
      * @brief Tests that the PV values are correctly written by the DataSourceI
      */
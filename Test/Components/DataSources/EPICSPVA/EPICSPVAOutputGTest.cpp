@@ -99,6 +99,16 @@ TEST(EPICSPVAOutputGTest,TestGetStackSize) {
     ASSERT_TRUE(test.TestGetStackSize());
 }
 
+TEST(EPICSPVAOutputGTest,TestGetMaxPutsInFlight) {
+    EPICSPVAOutputTest test;
+    ASSERT_TRUE(test.TestGetMaxPutsInFlight());
+}
+
+TEST(EPICSPVAOutputGTest,TestInitialise_False_MaxPutsInFlight) {
+    EPICSPVAOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_False_MaxPutsInFlight());
+}
+
 TEST(EPICSPVAOutputGTest,TestGetNumberOfBuffers) {
     EPICSPVAOutputTest test;
     ASSERT_TRUE(test.TestGetNumberOfBuffers());
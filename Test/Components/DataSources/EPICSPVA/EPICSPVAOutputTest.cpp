@@ -446,6 +446,7 @@ bool EPICSPVAOutputTest::TestInitialise() {
     cdb.Write("StackSize", 100000);
     cdb.Write("NumberOfBuffers", 10);
     cdb.Write("IgnoreBufferOverrun", 0);
+    cdb.Write("MaxPutsInFlight", 4);
     cdb.CreateAbsolute("Signals");
     cdb.MoveToRoot();
     bool ok = test.Initialise(cdb);
@@ -454,6 +455,7 @@ bool EPICSPVAOutputTest::TestInitialise() {
         ok &= (test.GetStackSize() == 100000);
         ok &= (test.GetNumberOfMemoryBuffers() == 1);
         ok &= (!test.IsIgnoringBufferOverrun());
+        ok &= (test.GetMaxPutsInFlight() == 4u);
     }
     return ok;
 }
@@ -471,10 +473,26 @@ bool EPICSPVAOutputTest::TestInitialise_Defaults() {
         ok &= (test.GetStackSize() == (THREADS_DEFAULT_STACKSIZE * 4u));
         ok &= (test.GetNumberOfMemoryBuffers() == 1);
         ok &= (test.IsIgnoringBufferOverrun());
+        ok &= (test.GetMaxPutsInFlight() == 2u);
     }
     return ok;
 }
 
+bool EPICSPVAOutputTest::TestInitialise_False_MaxPutsInFlight() {
+    using namespace MARTe;
+    EPICSPVAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 11);
+    cdb.Write("MaxPutsInFlight", 0);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool EPICSPVAOutputTest::TestGetMaxPutsInFlight() {
+    return TestInitialise();
+}
+
 bool EPICSPVAOutputTest::TestInitialise_False_Signals() {
     using namespace MARTe;
     EPICSPVAOutput test;
@@ -122,6 +122,16 @@ public:
      */
     bool TestGetStackSize();
 
+    /**
+     * @brief Tests the GetMaxPutsInFlight method.
+     */
+    bool TestGetMaxPutsInFlight();
+
+    /**
+     * @brief Tests the Initialise method with MaxPutsInFlight = 0.
+     */
+    bool TestInitialise_False_MaxPutsInFlight();
+
     /**
      * @brief Tests the GetNumberOfBuffers method.
      */
@@ -41,6 +41,10 @@
 
 static char NAME[] = "MARTe_PlatformTest_TestMakeShm";
 static char FULL_NAME[] = "/dev/shm/MARTe_PlatformTest_TestMakeShm";
+static char THP_NAME[] = "MARTe_PlatformTest_TestMakeShm_TransparentHugePages";
+static char THP_FULL_NAME[] = "/dev/shm/MARTe_PlatformTest_TestMakeShm_TransparentHugePages";
+static char HUGETLBFS_NAME[] = "MARTe_PlatformTest_TestMakeShm_HugeTLBFS";
+static char HUGETLBFS_DIR[] = "/tmp";
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -66,6 +70,16 @@ TEST(PlatformGTest,TestDestroyShm) {
     ASSERT_TRUE(test.TestDestroyShm(NAME, FULL_NAME));
 }
 
+TEST(PlatformGTest,TestMakeShm_TransparentHugePages) {
+    PlatformTest test;
+    ASSERT_TRUE(test.TestMakeShm_TransparentHugePages(THP_NAME, THP_FULL_NAME));
+}
+
+TEST(PlatformGTest,TestMakeShm_HugeTLBFS) {
+    PlatformTest test;
+    ASSERT_TRUE(test.TestMakeShm_HugeTLBFS(HUGETLBFS_NAME, HUGETLBFS_DIR));
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
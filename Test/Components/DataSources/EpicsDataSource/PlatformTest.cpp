@@ -321,3 +321,58 @@ bool PlatformTest::TestDestroyShm(const char* const name,
     ok = TestMasterSlaveWithTwoProcesses(name, fullname);
     return ok;
 }
+
+bool PlatformTest::TestMakeShm_TransparentHugePages(const char* const name,
+                                                    const char* const fullname) {
+    SDA::ShmPolicy policy;
+    policy.hugePages = SDA::ShmPolicy::TransparentHugePages;
+    policy.prefault = true;
+    const size_t size = 3u * 1024u * 1024u;
+    void* shm = SDA::Platform::MakeShm(name, size, policy);
+    bool ok = (shm != NULL);
+    if (ok) {
+        ShmMapping* map = reinterpret_cast<ShmMapping*>(shm);
+        ok = (map->size == size);
+        map->bytes[0] = 'M';
+        void* joined = SDA::Platform::JoinShm(name, policy);
+        ok &= (joined != NULL);
+        if (joined != NULL) {
+            ShmMapping* joinedMap = reinterpret_cast<ShmMapping*>(joined);
+            ok &= (joinedMap->size == size);
+            ok &= (joinedMap->bytes[0] == 'M');
+            ok &= SDA::Platform::DettachShm(joined, joinedMap->size);
+        }
+        ok &= SDA::Platform::DettachShm(shm, size);
+        ok &= SDA::Platform::DestroyShm(name, policy);
+        ok &= (access(fullname, R_OK | W_OK) == -1);
+    }
+    return ok;
+}
+
+bool PlatformTest::TestMakeShm_HugeTLBFS(const char* const name,
+                                         const char* const dir) {
+    SDA::ShmPolicy policy;
+    policy.hugePages = SDA::ShmPolicy::HugeTLBFSHugePages;
+    policy.hugeTLBFSPath = dir;
+    policy.hugePageSize = 2u * 1024u * 1024u;
+    void* shm = SDA::Platform::MakeShm(name, 100u, policy);
+    bool ok = (shm != NULL);
+    if (ok) {
+        ShmMapping* map = reinterpret_cast<ShmMapping*>(shm);
+        ok = (map->size == policy.hugePageSize);
+        map->bytes[0] = 'M';
+        //A joiner only needs to know the mount point of the hugetlbfs
+        SDA::ShmPolicy joinPolicy;
+        joinPolicy.hugeTLBFSPath = dir;
+        void* joined = SDA::Platform::JoinShm(name, joinPolicy);
+        ok &= (joined != NULL);
+        if (joined != NULL) {
+            ok &= (reinterpret_cast<ShmMapping*>(joined)->bytes[0] == 'M');
+            ok &= SDA::Platform::DettachShm(joined, policy.hugePageSize);
+        }
+        ok &= SDA::Platform::DettachShm(shm, policy.hugePageSize);
+        ok &= SDA::Platform::DestroyShm(name, policy);
+        ok &= (SDA::Platform::JoinShm(name, joinPolicy) == NULL);
+    }
+    return ok;
+}
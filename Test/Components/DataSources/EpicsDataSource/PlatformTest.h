@@ -78,6 +78,29 @@ public:
     bool TestDestroyShm(const char* const name,
                         const char* const fullname);
 
+    /**
+     * @brief Tests the MakeShm and JoinShm methods with a policy which asks
+     * for transparent huge pages and prefaults the mapping.
+     * @param[in] name The name of the shared area memory to create and use.
+     * @param[in] fullname The absolute name of the file which holds the
+     * shared area memory.
+     */
+    bool TestMakeShm_TransparentHugePages(const char* const name,
+                                          const char* const fullname);
+
+    /**
+     * @brief Tests the MakeShm, JoinShm and DestroyShm methods with a policy
+     * which puts the shared memory on a hugetlbfs mount.
+     * @details The mount is emulated by a plain directory, so the test checks
+     * that the size is rounded up to the huge page size, that JoinShm finds
+     * the file when there is no POSIX shared memory object with that name,
+     * and that DestroyShm removes it.
+     * @param[in] name The name of the shared area memory to create and use.
+     * @param[in] dir The directory which emulates the hugetlbfs mount.
+     */
+    bool TestMakeShm_HugeTLBFS(const char* const name,
+                               const char* const dir);
+
 private:
 
     /**
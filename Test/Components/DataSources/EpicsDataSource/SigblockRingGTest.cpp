@@ -0,0 +1,69 @@
+/**
+ * @file SigblockRingGTest.cpp
+ * @brief Source file for class SigblockRingGTest
+ * @date 15/10/2026
+ * @author Ivan Herrero
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SigblockRingGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "SigblockRingTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(SigblockRingGTest,TestInit) {
+    SigblockRingTest test;
+    ASSERT_TRUE(test.TestInit());
+}
+
+TEST(SigblockRingGTest,TestGet) {
+    SigblockRingTest test;
+    ASSERT_TRUE(test.TestGet());
+}
+
+TEST(SigblockRingGTest,TestPut) {
+    SigblockRingTest test;
+    ASSERT_TRUE(test.TestPut());
+}
+
+TEST(SigblockRingGTest,TestGetLatest) {
+    SigblockRingTest test;
+    ASSERT_TRUE(test.TestGetLatest());
+}
+
+TEST(SigblockRingGTest,TestSizeOf) {
+    SigblockRingTest test;
+    ASSERT_TRUE(test.TestSizeOf());
+}
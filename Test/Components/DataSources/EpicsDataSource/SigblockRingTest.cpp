@@ -0,0 +1,274 @@
+/**
+ * @file SigblockRingTest.cpp
+ * @brief Source file for class SigblockRingTest
+ * @date 15/10/2026
+ * @author Ivan Herrero
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SigblockRingTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <cstring>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "SigblockRing.h"
+#include "SigblockRingTest.h"
+#include "SigblockDoubleBufferSupport.h"
+#include "SigblockSupport.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+template bool SigblockRingTest::TestProducerConsumerInSingleThread<int>(const unsigned int,
+                                                                        const unsigned int,
+                                                                        const unsigned int);
+template bool SigblockRingTest::TestProducerConsumerInSingleThread<double>(const unsigned int,
+                                                                           const unsigned int,
+                                                                           const unsigned int);
+
+namespace {
+
+SDA::SigblockRing* MallocSigblockRing(std::size_t sizeOfSigblock,
+                                      unsigned int ringDepth) {
+    size_t memsize = SDA::SigblockRing::SizeOf(sizeOfSigblock, ringDepth);
+    char* mem = new char[memsize];
+    std::memset(mem, '\0', memsize);
+    return reinterpret_cast<SDA::SigblockRing*>(mem);
+}
+
+void FreeSigblockRing(SDA::SigblockRing*& ring) {
+    char* mem = reinterpret_cast<char*>(ring);
+    delete[] mem;
+    ring = NULL;
+}
+
+/**
+ * Fixture with a ring of int sigblocks and a dataset to feed it.
+ */
+struct RingFixture {
+    RingFixture(const unsigned int numberOfSignals,
+                const unsigned int maxTests,
+                const unsigned int ringDepth);
+    ~RingFixture();
+    DataSet dataset;
+    SDA::Sigblock::Metadata* metadata;
+    std::size_t sizeOfSigblock;
+    SDA::SigblockRing* ring;
+    SDA::Sigblock* sigblock;
+};
+
+RingFixture::RingFixture(const unsigned int numberOfSignals,
+                         const unsigned int maxTests,
+                         const unsigned int ringDepth) :
+        dataset(maxTests),
+        metadata(MallocSigblockMetadata(numberOfSignals)),
+        sizeOfSigblock(0u),
+        ring(NULL),
+        sigblock(NULL) {
+    SDA::Signal::Metadata rawMetadata[numberOfSignals];
+    GenerateMetadataForSigblock<int>(rawMetadata, numberOfSignals);
+    metadata->Init(numberOfSignals, rawMetadata);
+    sizeOfSigblock = metadata->GetTotalSize();
+    MallocDataSet(dataset, sizeOfSigblock);
+    InitDataSet<int>(dataset, numberOfSignals);
+    ring = MallocSigblockRing(sizeOfSigblock, ringDepth);
+    ring->Init(sizeOfSigblock, ringDepth);
+    sigblock = MallocSigblock(sizeOfSigblock);
+}
+
+RingFixture::~RingFixture() {
+    FreeSigblock(sigblock);
+    FreeSigblockRing(ring);
+    FreeDataSet(dataset);
+    FreeSigblockMetadata(metadata);
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool SigblockRingTest::TestInit() {
+    RingFixture fixture(10, 4, 4);
+    bool ok = (fixture.ring->GetDepth() == 4u);
+    ok &= (fixture.ring->GetPending() == 0u);
+    ok &= (fixture.ring->GetOverruns() == 0u);
+    ok &= (fixture.ring->GetSkipped() == 0u);
+    ok &= !fixture.ring->Get(*fixture.sigblock);
+    ok &= !fixture.ring->GetLatest(*fixture.sigblock);
+    return ok;
+}
+
+bool SigblockRingTest::TestGet() {
+    bool ok = false;
+    ok = TestProducerConsumerInSingleThread<int>(10, 25, 1);
+    ok &= TestProducerConsumerInSingleThread<int>(10, 25, 4);
+    ok &= TestProducerConsumerInSingleThread<double>(10, 25, 7);
+    return ok;
+}
+
+bool SigblockRingTest::TestPut() {
+    RingFixture fixture(10, 5, 4);
+    bool ok = true;
+    for (unsigned int i = 0u; (i < 4u) && ok; i++) {
+        ok = fixture.ring->Put(*(fixture.dataset.items[i]));
+    }
+    //The ring is full: the fifth sigblock is rejected and the first one is kept
+    ok &= !fixture.ring->Put(*(fixture.dataset.items[4]));
+    ok &= (fixture.ring->GetOverruns() == 1u);
+    ok &= (fixture.ring->GetPending() == 4u);
+    ok &= fixture.ring->Get(*fixture.sigblock);
+    ok &= (std::memcmp(fixture.sigblock, fixture.dataset.items[0], fixture.sizeOfSigblock) == 0);
+    //There is room again
+    ok &= fixture.ring->Put(*(fixture.dataset.items[4]));
+    ok &= (fixture.ring->GetOverruns() == 1u);
+    return ok;
+}
+
+bool SigblockRingTest::TestGetLatest() {
+    RingFixture fixture(10, 3, 4);
+    bool ok = true;
+    for (unsigned int i = 0u; (i < 3u) && ok; i++) {
+        ok = fixture.ring->Put(*(fixture.dataset.items[i]));
+    }
+    ok &= fixture.ring->GetLatest(*fixture.sigblock);
+    ok &= (std::memcmp(fixture.sigblock, fixture.dataset.items[2], fixture.sizeOfSigblock) == 0);
+    ok &= (fixture.ring->GetSkipped() == 2u);
+    ok &= (fixture.ring->GetPending() == 0u);
+    ok &= !fixture.ring->GetLatest(*fixture.sigblock);
+    return ok;
+}
+
+bool SigblockRingTest::TestSizeOf() {
+    const std::size_t cacheLine = SDA::SigblockRing::SIGBLOCKRING_CACHE_LINE;
+    bool ok = ((sizeof(SDA::SigblockRing) % cacheLine) == 0u);
+    ok &= (SDA::SigblockRing::SizeOf(1u, 4u) == (sizeof(SDA::SigblockRing) + (4u * cacheLine)));
+    ok &= (SDA::SigblockRing::SizeOf(cacheLine, 4u) == (sizeof(SDA::SigblockRing) + (4u * cacheLine)));
+    ok &= (SDA::SigblockRing::SizeOf(cacheLine + 1u, 2u) == (sizeof(SDA::SigblockRing) + (4u * cacheLine)));
+    return ok;
+}
+
+template<typename SignalType>
+bool SigblockRingTest::TestProducerConsumerInSingleThread(const unsigned int numberOfSignals,
+                                                          const unsigned int maxTests,
+                                                          const unsigned int ringDepth) {
+    DataSet dataset(maxTests);
+    bool ok = false;
+    SDA::Signal::Metadata rawMetadata[numberOfSignals];
+    SDA::Sigblock::Metadata* metadata;
+    std::size_t sizeOfSigblock;
+    SDA::SigblockRing* ring;
+
+    //Allocate memory for sigblock's metadata:
+    metadata = MallocSigblockMetadata(numberOfSignals);
+
+    //Check allocation of sigblock's metadata:
+    ok = (metadata != NULL);
+
+    if (ok) {
+
+        //Generate the metadata for the sigblocks to use in test:
+        GenerateMetadataForSigblock<SignalType>(rawMetadata, numberOfSignals);
+
+        //Init testing metadata values:
+        metadata->Init(numberOfSignals, rawMetadata);
+
+        //Get sigblock's size:
+        sizeOfSigblock = metadata->GetTotalSize();
+
+        //Allocate memory for dataset:
+        MallocDataSet(dataset, sizeOfSigblock);
+
+        //Initialize items of dataset:
+        InitDataSet<SignalType>(dataset, numberOfSignals);
+
+        //Allocate memory for shared sigblock ring:
+        ring = MallocSigblockRing(sizeOfSigblock, ringDepth);
+
+        //Check allocation of shared sigblock ring:
+        ok = (ring != NULL);
+
+        if (ok) {
+
+            //Initialize shared sigblock ring:
+            ring->Init(sizeOfSigblock, ringDepth);
+
+            //Write all the sigblocks of the dataset to the ring in bursts
+            //which fill it, checking that they are read back in the same
+            //order. The number of tests is not a multiple of the depth, so
+            //the indexes wrap around the ring at different slots.
+            {
+                SDA::Sigblock* sigblock = NULL;
+                unsigned int written = 0;
+                unsigned int read = 0;
+                bool error = false;
+
+                //Allocate memory for sigblock:
+                sigblock = MallocSigblock(sizeOfSigblock);
+
+                //Check allocation of sigblock:
+                ok = (sigblock != NULL);
+
+                if (ok) {
+                    while (read < maxTests && !error) {
+                        while (written < maxTests && ring->Put(*(dataset.items[written]))) {
+                            written++;
+                        }
+                        error = (ring->GetPending() != (written - read));
+                        while (!error && ring->Get(*sigblock)) {
+                            error = (std::memcmp(sigblock, dataset.items[read], sizeOfSigblock) != 0);
+                            read++;
+                        }
+                    }
+                    error |= (read != written);
+                    error |= (ring->GetSkipped() != 0u);
+                    //Each burst but the last one ended with one rejected Put
+                    error |= (ring->GetOverruns() != ((maxTests - 1u) / ringDepth));
+                }
+
+                //Free memory for sigblock:
+                FreeSigblock(sigblock);
+
+                //Check execution's status:
+                ok &= !error;
+            }
+        }
+
+        //Free memory of shared sigblock ring:
+        FreeSigblockRing(ring);
+
+        //Free memory of dataset:
+        FreeDataSet(dataset);
+
+    }
+
+    //Free memory of sigblock's metadata:
+    FreeSigblockMetadata(metadata);
+
+    //Return test's execution status:
+    return ok;
+}
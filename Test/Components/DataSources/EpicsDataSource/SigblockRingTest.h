@@ -0,0 +1,91 @@
+/**
+ * @file SigblockRingTest.h
+ * @brief Header file for class SigblockRingTest
+ * @date 15/10/2026
+ * @author Ivan Herrero
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SigblockRingTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SIGBLOCKRINGTEST_H_
+#define SIGBLOCKRINGTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Class for testing SigblockRing class.
+ */
+class SigblockRingTest {
+public:
+
+    /**
+     * @brief Tests the Init method.
+     */
+    bool TestInit();
+
+    /**
+     * @brief Tests that the Get method returns the sigblocks in FIFO order,
+     * also after the indexes have wrapped around the ring.
+     */
+    bool TestGet();
+
+    /**
+     * @brief Tests that the Put method fails and counts an overrun when
+     * the ring is full, without overwriting any sigblock.
+     */
+    bool TestPut();
+
+    /**
+     * @brief Tests that the GetLatest method returns the freshest sigblock
+     * and counts the discarded ones.
+     */
+    bool TestGetLatest();
+
+    /**
+     * @brief Tests that the SizeOf method reserves a cache line aligned
+     * slot for each sigblock.
+     */
+    bool TestSizeOf();
+
+private:
+
+    /**
+     * @brief Test the interchange of data between a producer and a consumer
+     * using one single thread, putting and getting sigblocks in bursts
+     * of (at most) ringDepth sigblocks.
+     */
+    template<typename SignalType>
+    bool TestProducerConsumerInSingleThread(const unsigned int numberOfSignals,
+                                            const unsigned int maxTests,
+                                            const unsigned int ringDepth);
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SIGBLOCKRINGTEST_H_ */
@@ -135,6 +135,16 @@ TEST(FileReaderGTest,TestInitialise_Preload_no) {
     ASSERT_TRUE(test.TestInitialise_Preload_no());
 }
 
+TEST(FileReaderGTest,TestInitialise_CSVCache) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_CSVCache());
+}
+
+TEST(FileReaderGTest,TestInitialise_False_CSVCache) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_CSVCache());
+}
+
 TEST(FileReaderGTest,TestInitialise_Preload_yes_NoMaxSize) {
     FileReaderTest test;
     ASSERT_TRUE(test.TestInitialise_Preload_yes_NoMaxSize());
@@ -145,6 +155,41 @@ TEST(FileReaderGTest,TestInitialise_Preload_yes_MaxSizeToLarge) {
     ASSERT_TRUE(test.TestInitialise_Preload_yes_MaxSizeToLarge());
 }
 
+TEST(FileReaderGTest,TestInitialise_MemoryMap) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_MemoryMap());
+}
+
+TEST(FileReaderGTest,TestInitialise_False_MemoryMap) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_MemoryMap());
+}
+
+TEST(FileReaderGTest,TestInitialise_Prefetch) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_Prefetch());
+}
+
+TEST(FileReaderGTest,TestInitialise_False_Prefetch) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Prefetch());
+}
+
+TEST(FileReaderGTest,TestInitialise_False_NumberOfPrefetchBuffers) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NumberOfPrefetchBuffers());
+}
+
+TEST(FileReaderGTest,TestInitialise_SeekIndex) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_SeekIndex());
+}
+
+TEST(FileReaderGTest,TestInitialise_False_SeekIndex) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_SeekIndex());
+}
+
 TEST(FileReaderGTest,TestSetConfiguredDatabase) {
     FileReaderTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase());
@@ -160,6 +205,11 @@ TEST(FileReaderGTest,TestSetConfiguredDatabase_False_NumberOfSamples) {
     ASSERT_TRUE(test.TestSetConfiguredDatabase_False_NumberOfSamples());
 }
 
+TEST(FileReaderGTest,TestSetConfiguredDatabase_NumberOfSamples_Interpolate) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_NumberOfSamples_Interpolate());
+}
+
 TEST(FileReaderGTest,TestSetConfiguredDatabase_WrongFileSize_CSV) {
     FileReaderTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase_WrongFileSize_CSV());
@@ -205,9 +255,9 @@ TEST(FileReaderGTest,TestGetBrokerName_OutputSignals) {
     ASSERT_TRUE(test.TestGetBrokerName_OutputSignals());
 }
 
-TEST(FileReaderGTest,TestGetBrokerName_MemoryMapInterpolatedInputBroker) {
+TEST(FileReaderGTest,TestGetBrokerName_FileReaderInterpolatedInputBroker) {
     FileReaderTest test;
-    ASSERT_TRUE(test.TestGetBrokerName_MemoryMapInterpolatedInputBroker());
+    ASSERT_TRUE(test.TestGetBrokerName_FileReaderInterpolatedInputBroker());
 }
 
 TEST(FileReaderGTest,TestGetBrokerName_MemoryMapInputBroker) {
@@ -230,6 +280,31 @@ TEST(FileReaderGTest,TestSynchronise_Binary) {
     ASSERT_TRUE(test.TestSynchronise_Binary());
 }
 
+TEST(FileReaderGTest,TestSynchronise_Binary_Compressed) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_Binary_Compressed());
+}
+
+TEST(FileReaderGTest,TestSynchronise_Binary_Columnar) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_Binary_Columnar());
+}
+
+TEST(FileReaderGTest,TestSynchronise_Binary_MemoryMap) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_Binary_MemoryMap());
+}
+
+TEST(FileReaderGTest,TestSynchronise_Binary_Prefetch) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_Binary_Prefetch());
+}
+
+TEST(FileReaderGTest,TestSynchronise_SeekIndex) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_SeekIndex());
+}
+
 TEST(FileReaderGTest,TestSynchronise_Binary_Interpolation) {
     FileReaderTest test;
     ASSERT_TRUE(test.TestSynchronise_Binary_Interpolation());
@@ -245,6 +320,11 @@ TEST(FileReaderGTest,TestSynchronise_CSV) {
     ASSERT_TRUE(test.TestSynchronise_CSV());
 }
 
+TEST(FileReaderGTest,TestSynchronise_CSV_Cache) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_CSV_Cache());
+}
+
 TEST(FileReaderGTest,TestSynchronise_CSV_Strings) {
     FileReaderTest test;
     ASSERT_TRUE(test.TestSynchronise_CSV_Strings());
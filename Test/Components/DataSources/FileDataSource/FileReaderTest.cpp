@@ -744,7 +744,9 @@ static void GenerateCSVFile(const MARTe::char8 *const filename,
 static void GenerateBinaryFile(const MARTe::char8 *const filename,
                                FRTSignalToVerify **signalToVerify,
                                MARTe::uint32 *signalToVerifyNumberOfElements,
-                               MARTe::uint32 signalToVerifyNumberOfSamples) {
+                               MARTe::uint32 signalToVerifyNumberOfSamples,
+                               const MARTe::char8 *const compression = NULL,
+                               bool columnar = false) {
     using namespace MARTe;
     const uint32 N_OF_SIGNALS = 10;
     const char8 *signalNames[N_OF_SIGNALS] = { "SignalUInt8", "SignalInt8", "SignalUInt16", "SignalInt16", "SignalUInt32", "SignalInt32", "SignalUInt64",
@@ -779,12 +781,62 @@ static void GenerateBinaryFile(const MARTe::char8 *const filename,
             f.Write(reinterpret_cast<const char8*>(&signalToVerifyNumberOfElements[n]), writeSize);
         }
         uint32 s;
-        for (s = 0; s < signalToVerifyNumberOfSamples; s++) {
+        FileFrameCodec codec;
+        if (compression != NULL) {
+            ok = codec.SetCodec(compression, 3);
+        }
+        FileColumnChunk chunk;
+        uint32 signalByteSizes[N_OF_SIGNALS];
+        for (n = 0u; n < N_OF_SIGNALS; n++) {
+            signalByteSizes[n] = signalToVerifyNumberOfElements[n] * signalTypes[n].numberOfBits / 8;
+        }
+        if (columnar) {
+            ok = chunk.SetSignals(N_OF_SIGNALS, &signalByteSizes[0]);
+        }
+        bool framed = (columnar) || (codec.GetCodec() != FILE_FRAME_CODEC_NONE);
+        //Each compressed sample is written in its own frame (as with FileWriter BatchCycles = 1) and all the columnar samples in one chunk
+        uint32 chunkSize = chunk.GetChunkSize(signalToVerifyNumberOfSamples);
+        char8 *sample = new char8[signalBinarySize * signalToVerifyNumberOfSamples];
+        char8 *chunkBuffer = new char8[chunkSize];
+        char8 *frame = new char8[codec.GetMaxFrameSize(signalBinarySize + chunkSize)];
+        uint32 sampleSize = 0u;
+        for (s = 0; (s < signalToVerifyNumberOfSamples) && (ok); s++) {
+            if (!columnar) {
+                sampleSize = 0u;
+            }
             for (n = 0u; n < N_OF_SIGNALS; n++) {
-                writeSize = signalToVerifyNumberOfElements[n] * signalTypes[n].numberOfBits / 8;
-                f.Write(reinterpret_cast<const char8*>(signalToVerify[s]->signalPtrs[n]), writeSize);
+                writeSize = signalByteSizes[n];
+                if (!framed) {
+                    f.Write(reinterpret_cast<const char8*>(signalToVerify[s]->signalPtrs[n]), writeSize);
+                }
+                else {
+                    MemoryOperationsHelper::Copy(&sample[sampleSize], signalToVerify[s]->signalPtrs[n], writeSize);
+                    sampleSize += writeSize;
+                }
+            }
+            if ((framed) && ((!columnar) || (s == (signalToVerifyNumberOfSamples - 1u)))) {
+                const char8 *data = sample;
+                uint32 dataSize = sampleSize;
+                uint32 numberOfCycles = columnar ? signalToVerifyNumberOfSamples : 1u;
+                uint64 firstCycle = columnar ? 0u : s;
+                if (columnar) {
+                    ok = chunk.Encode(sample, numberOfCycles, firstCycle, chunkBuffer, dataSize);
+                    data = chunkBuffer;
+                }
+                if ((ok) && (codec.GetCodec() != FILE_FRAME_CODEC_NONE)) {
+                    uint32 frameSize = 0u;
+                    ok = codec.Encode(data, dataSize, firstCycle, numberOfCycles, frame, frameSize);
+                    data = frame;
+                    dataSize = frameSize;
+                }
+                if (ok) {
+                    f.Write(data, dataSize);
+                }
             }
         }
+        delete[] sample;
+        delete[] chunkBuffer;
+        delete[] frame;
     }
     f.Flush();
     f.Close();
@@ -796,7 +848,9 @@ static bool TestIntegratedExecution(const MARTe::char8 *const config,
                                     const MARTe::char8 *const csvSeparator,
                                     bool forceEOFRewind = false,
                                     bool forceEOFLast = false,
-                                    bool forceEOFError = false) {
+                                    bool forceEOFError = false,
+                                    const MARTe::char8 *const compression = NULL,
+                                    bool columnar = false) {
     using namespace MARTe;
     const char8 *filename = "";
     bool ok = true;
@@ -817,7 +871,7 @@ static bool TestIntegratedExecution(const MARTe::char8 *const config,
     }
     else {
         filename = "TestIntegratedExecution.bin";
-        GenerateBinaryFile(filename, signals, numberOfElements, signalToVerifyNumberOfSamples);
+        GenerateBinaryFile(filename, signals, numberOfElements, signalToVerifyNumberOfSamples, compression, columnar);
         if (ok) {
             ok = TestIntegratedExecution(config, filename, signals, numberOfElements, signalToVerifyNumberOfSamples, false, 0, "", true, false, "",
                                          forceEOFRewind, forceEOFLast, forceEOFError);
@@ -884,6 +938,132 @@ static bool TestIntegratedExecutionInterpolation(const MARTe::char8 *const confi
     return ok;
 }
 
+static bool TestIntegratedExecutionSeek(const MARTe::char8 *const config,
+                                        bool csv,
+                                        bool preload,
+                                        MARTe::uint32 *signalToVerifyNumberOfElements) {
+    using namespace MARTe;
+    const char8 *filename = "";
+    const uint32 signalToVerifyNumberOfSamples = 5u;
+    FRTSignalToVerify **signalToVerify = new FRTSignalToVerify*[signalToVerifyNumberOfSamples];
+    uint32 i;
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        signalToVerify[i] = new FRTSignalToVerify(signalToVerifyNumberOfElements, i + 1);
+    }
+    if (csv) {
+        filename = "TestIntegratedExecutionSeek.csv";
+        GenerateCSVFile(filename, ";", signalToVerify, signalToVerifyNumberOfElements, signalToVerifyNumberOfSamples);
+    }
+    else {
+        filename = "TestIntegratedExecutionSeek.bin";
+        GenerateBinaryFile(filename, signalToVerify, signalToVerifyNumberOfElements, signalToVerifyNumberOfSamples);
+    }
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    cdb.MoveAbsolute("$Test.+Data.+Drv1");
+    cdb.Delete("Filename");
+    cdb.Write("Filename", filename);
+    cdb.Delete("FileFormat");
+    if (csv) {
+        cdb.Write("FileFormat", "csv");
+        cdb.Delete("CSVSeparator");
+        cdb.Write("CSVSeparator", ";");
+    }
+    else {
+        cdb.Write("FileFormat", "binary");
+    }
+    cdb.Delete("Preload");
+    cdb.Write("Preload", preload ? "yes" : "no");
+    cdb.Delete("XAxisSignal");
+    cdb.Write("XAxisSignal", "SignalUInt32");
+    cdb.Write("SeekIndexStep", 2);
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        cdb.MoveToRoot();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    ReferenceT<FileReaderSchedulerTestHelper> scheduler;
+    ReferenceT<FileReaderGAMTriggerTestHelper> gam;
+    ReferenceT<FileReader> fileReader;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        scheduler = application->Find("Scheduler");
+        gam = application->Find("Functions.GAM1");
+        fileReader = god->Find("Test.Data.Drv1");
+        ok = (scheduler.IsValid()) && (gam.IsValid()) && (fileReader.IsValid());
+    }
+    if (ok) {
+        ok = (fileReader->GetSeekIndexStep() == 2u) && (fileReader->GetSeekIndexSize() == 3u);
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    //The samples to read after each seek request: first cycle, SeekCycle(3), next cycle, SeekTime(2) and SeekTime(100) (after the last sample)
+    const uint32 expectedSamples[] = { 0u, 3u, 4u, 1u, 4u };
+    uint32 z;
+    uint32 c;
+    for (c = 0u; (c < 5u) && (ok); c++) {
+        if (c == 1u) {
+            ok = fileReader->SeekCycle(3u).ErrorsCleared();
+        }
+        else if (c == 3u) {
+            ok = fileReader->SeekTime(2u).ErrorsCleared();
+        }
+        else if (c == 4u) {
+            ok = fileReader->SeekTime(100u).ErrorsCleared();
+        }
+        else {
+            //NOOP
+        }
+        if (ok) {
+            ok = scheduler->ExecuteThreadCycle(0);
+        }
+        uint32 s = expectedSamples[c];
+        if (ok) {
+            FRT_VERIFY_SIGNAL(0, uint8);
+            FRT_VERIFY_SIGNAL(1, int8);
+            FRT_VERIFY_SIGNAL(2, uint16);
+            FRT_VERIFY_SIGNAL(3, int16);
+            FRT_VERIFY_SIGNAL(4, uint32);
+            FRT_VERIFY_SIGNAL(5, int32);
+            FRT_VERIFY_SIGNAL(6, uint64);
+            FRT_VERIFY_SIGNAL(7, int64);
+            FRT_VERIFY_SIGNAL(8, float32);
+            FRT_VERIFY_SIGNAL(9, float64);
+        }
+        if ((ok) && (c > 0u)) {
+            ok = (fileReader->GetLastSeekCycle() == ((c == 2u) ? 3u : s));
+        }
+    }
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    god->Purge();
+
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        delete signalToVerify[i];
+    }
+    delete signalToVerify;
+    DeleteTestFile(filename);
+    return ok;
+}
+
 //Standard configuration to be patched
 static const MARTe::char8 *const config1 = ""
         "$Test = {"
@@ -1098,7 +1278,7 @@ static const MARTe::char8 *const config1P = ""
         "}";
 
 //Standard configuration to be patched
-static const MARTe::char8 *const config1P_smallSize = ""
+static const MARTe::char8 *const config1C = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -1162,7 +1342,8 @@ static const MARTe::char8 *const config1P_smallSize = ""
         "            CSVSeparator = \";\""
         "            Interpolate = no"
         "            Preload = yes"
-        "            MaxFileByteSize = 4"
+        "            CSVCache = yes"
+        "            CSVBufferSize = 16"
         "            XAxisSignal = SignalUInt32"
         "            +Messages = {"
         "                Class = ReferenceContainer"
@@ -1206,7 +1387,7 @@ static const MARTe::char8 *const config1P_smallSize = ""
         "}";
 
 //Standard configuration to be patched
-static const MARTe::char8 *const config1P_B = ""
+static const MARTe::char8 *const config1M = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -1265,11 +1446,13 @@ static const MARTe::char8 *const config1P_B = ""
         "        }"
         "        +Drv1 = {"
         "            Class = FileReader"
-        "            Filename = \"filereader_test.bin\""
-        "            FileFormat = binary"
+        "            Filename = \"filereader_test.csv\""
+        "            FileFormat = csv"
         "            CSVSeparator = \";\""
         "            Interpolate = no"
-        "            Preload = yes"
+        "            MemoryMap = yes"
+        "            ReadAheadSize = 8192"
+        "            LockReadAhead = 1"
         "            XAxisSignal = SignalUInt32"
         "            +Messages = {"
         "                Class = ReferenceContainer"
@@ -1312,8 +1495,8 @@ static const MARTe::char8 *const config1P_B = ""
         "    }"
         "}";
 
-//Wrong configuration with samples
-static const MARTe::char8 *const config2 = ""
+//Standard configuration to be patched
+static const MARTe::char8 *const config1F = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -1324,7 +1507,6 @@ static const MARTe::char8 *const config2 = ""
         "                SignalUInt8 = {"
         "                    Type = uint8"
         "                    DataSource = Drv1"
-        "                    Samples = 2"
         "                }"
         "                SignalInt8 = {"
         "                    Type = int8"
@@ -1373,10 +1555,13 @@ static const MARTe::char8 *const config2 = ""
         "        }"
         "        +Drv1 = {"
         "            Class = FileReader"
-        "            Filename = \"config2.csv\""
+        "            Filename = \"filereader_test.csv\""
         "            FileFormat = csv"
         "            CSVSeparator = \";\""
         "            Interpolate = no"
+        "            PrefetchCycles = 2"
+        "            NumberOfPrefetchBuffers = 3"
+        "            CPUMask = 0x1"
         "            XAxisSignal = SignalUInt32"
         "            +Messages = {"
         "                Class = ReferenceContainer"
@@ -1407,6 +1592,9 @@ static const MARTe::char8 *const config2 = ""
         "        TimingDataSource = Timings"
         "    }"
         "}"
+        "+FileReaderTestHelper = {"
+        "    Class = FileReaderTestHelper"
+        "}"
         "+TestMessages = {"
         "    Class = ReferenceContainer"
         "    +MessageFlush = {"
@@ -1416,8 +1604,8 @@ static const MARTe::char8 *const config2 = ""
         "    }"
         "}";
 
-//Wrong configuration with more than one GAM interacting with the DataSource
-static const MARTe::char8 *const config3 = ""
+//Standard configuration to be patched
+static const MARTe::char8 *const config1P_smallSize = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -1457,11 +1645,6 @@ static const MARTe::char8 *const config3 = ""
         "                    Type = int64"
         "                    DataSource = Drv1"
         "                }"
-        "            }"
-        "        }"
-        "        +GAM2 = {"
-        "            Class = FileReaderGAMTriggerTestHelper"
-        "            InputSignals = {"
         "                SignalFloat32 = {"
         "                    Type = float32"
         "                    DataSource = Drv1"
@@ -1481,11 +1664,22 @@ static const MARTe::char8 *const config3 = ""
         "        }"
         "        +Drv1 = {"
         "            Class = FileReader"
-        "            Filename = \"config3.csv\""
+        "            Filename = \"filereader_test.csv\""
         "            FileFormat = csv"
         "            CSVSeparator = \";\""
-        "            XAxisSignal = SignalUInt32"
         "            Interpolate = no"
+        "            Preload = yes"
+        "            MaxFileByteSize = 4"
+        "            XAxisSignal = SignalUInt32"
+        "            +Messages = {"
+        "                Class = ReferenceContainer"
+        "                +FileRuntimeError = {"
+        "                    Class = Message"
+        "                    Destination = FileReaderTestHelper"
+        "                    Function = HandleRuntimeError"
+        "                    Mode = ExpectsReply"
+        "                }"
+        "            }"
         "        }"
         "    }"
         "    +States = {"
@@ -1496,7 +1690,7 @@ static const MARTe::char8 *const config3 = ""
         "                Class = ReferenceContainer"
         "                +Thread1 = {"
         "                    Class = RealTimeThread"
-        "                    Functions = {GAM1 GAM2}"
+        "                    Functions = {GAM1}"
         "                }"
         "            }"
         "        }"
@@ -1506,6 +1700,9 @@ static const MARTe::char8 *const config3 = ""
         "        TimingDataSource = Timings"
         "    }"
         "}"
+        "+FileReaderTestHelper = {"
+        "    Class = FileReaderTestHelper"
+        "}"
         "+TestMessages = {"
         "    Class = ReferenceContainer"
         "    +MessageFlush = {"
@@ -1515,8 +1712,8 @@ static const MARTe::char8 *const config3 = ""
         "    }"
         "}";
 
-//Invalid message destination for run time error
-static const MARTe::char8 *const config4 = ""
+//Standard configuration to be patched
+static const MARTe::char8 *const config1P_B = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -1575,16 +1772,17 @@ static const MARTe::char8 *const config4 = ""
         "        }"
         "        +Drv1 = {"
         "            Class = FileReader"
-        "            Filename = \"filereader_test.csv\""
-        "            FileFormat = csv"
+        "            Filename = \"filereader_test.bin\""
+        "            FileFormat = binary"
         "            CSVSeparator = \";\""
         "            Interpolate = no"
+        "            Preload = yes"
         "            XAxisSignal = SignalUInt32"
         "            +Messages = {"
         "                Class = ReferenceContainer"
         "                +FileRuntimeError = {"
         "                    Class = Message"
-        "                    Destination = FileReaderTestHelperError"
+        "                    Destination = FileReaderTestHelper"
         "                    Function = HandleRuntimeError"
         "                    Mode = ExpectsReply"
         "                }"
@@ -1621,8 +1819,8 @@ static const MARTe::char8 *const config4 = ""
         "    }"
         "}";
 
-//Invalid message destination for run time error
-static const MARTe::char8 *const config4P = ""
+//Wrong configuration with samples
+static const MARTe::char8 *const config2 = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -1633,6 +1831,7 @@ static const MARTe::char8 *const config4P = ""
         "                SignalUInt8 = {"
         "                    Type = uint8"
         "                    DataSource = Drv1"
+        "                    Samples = 2"
         "                }"
         "                SignalInt8 = {"
         "                    Type = int8"
@@ -1681,18 +1880,16 @@ static const MARTe::char8 *const config4P = ""
         "        }"
         "        +Drv1 = {"
         "            Class = FileReader"
-        "            Filename = \"filereader_test.csv\""
+        "            Filename = \"config2.csv\""
         "            FileFormat = csv"
         "            CSVSeparator = \";\""
-        "            Preload = yes"
-        "            EOF = Error"
         "            Interpolate = no"
         "            XAxisSignal = SignalUInt32"
         "            +Messages = {"
         "                Class = ReferenceContainer"
         "                +FileRuntimeError = {"
         "                    Class = Message"
-        "                    Destination = FileReaderTestHelperError"
+        "                    Destination = FileReaderTestHelper"
         "                    Function = HandleRuntimeError"
         "                    Mode = ExpectsReply"
         "                }"
@@ -1717,9 +1914,6 @@ static const MARTe::char8 *const config4P = ""
         "        TimingDataSource = Timings"
         "    }"
         "}"
-        "+FileReaderTestHelper = {"
-        "    Class = FileReaderTestHelper"
-        "}"
         "+TestMessages = {"
         "    Class = ReferenceContainer"
         "    +MessageFlush = {"
@@ -1729,8 +1923,8 @@ static const MARTe::char8 *const config4P = ""
         "    }"
         "}";
 
-//Invalid runtime error message name
-static const MARTe::char8 *const config5 = ""
+//Wrong configuration with more than one GAM interacting with the DataSource
+static const MARTe::char8 *const config3 = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -1770,6 +1964,11 @@ static const MARTe::char8 *const config5 = ""
         "                    Type = int64"
         "                    DataSource = Drv1"
         "                }"
+        "            }"
+        "        }"
+        "        +GAM2 = {"
+        "            Class = FileReaderGAMTriggerTestHelper"
+        "            InputSignals = {"
         "                SignalFloat32 = {"
         "                    Type = float32"
         "                    DataSource = Drv1"
@@ -1789,20 +1988,11 @@ static const MARTe::char8 *const config5 = ""
         "        }"
         "        +Drv1 = {"
         "            Class = FileReader"
-        "            Filename = \"filereader_test.csv\""
+        "            Filename = \"config3.csv\""
         "            FileFormat = csv"
         "            CSVSeparator = \";\""
-        "            Interpolate = no"
         "            XAxisSignal = SignalUInt32"
-        "            +Messages = {"
-        "                Class = ReferenceContainer"
-        "                +FileRuntimeErrorNew = {"
-        "                    Class = Message"
-        "                    Destination = FileReaderTestHelper"
-        "                    Function = HandleRuntimeError"
-        "                    Mode = ExpectsReply"
-        "                }"
-        "            }"
+        "            Interpolate = no"
         "        }"
         "    }"
         "    +States = {"
@@ -1813,7 +2003,7 @@ static const MARTe::char8 *const config5 = ""
         "                Class = ReferenceContainer"
         "                +Thread1 = {"
         "                    Class = RealTimeThread"
-        "                    Functions = {GAM1}"
+        "                    Functions = {GAM1 GAM2}"
         "                }"
         "            }"
         "        }"
@@ -1823,9 +2013,6 @@ static const MARTe::char8 *const config5 = ""
         "        TimingDataSource = Timings"
         "    }"
         "}"
-        "+FileReaderTestHelper = {"
-        "    Class = FileReaderTestHelper"
-        "}"
         "+TestMessages = {"
         "    Class = ReferenceContainer"
         "    +MessageFlush = {"
@@ -1835,8 +2022,8 @@ static const MARTe::char8 *const config5 = ""
         "    }"
         "}";
 
-//Invalid runtime error message type
-static const MARTe::char8 *const config6 = ""
+//Invalid message destination for run time error
+static const MARTe::char8 *const config4 = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -1903,8 +2090,8 @@ static const MARTe::char8 *const config6 = ""
         "            +Messages = {"
         "                Class = ReferenceContainer"
         "                +FileRuntimeError = {"
-        "                    Class = ReferenceContainer"
-        "                    Destination = FileReaderTestHelper"
+        "                    Class = Message"
+        "                    Destination = FileReaderTestHelperError"
         "                    Function = HandleRuntimeError"
         "                    Mode = ExpectsReply"
         "                }"
@@ -1941,8 +2128,8 @@ static const MARTe::char8 *const config6 = ""
         "    }"
         "}";
 
-//Invalid runtime error message type
-static const MARTe::char8 *const config6P = ""
+//Invalid message destination for run time error
+static const MARTe::char8 *const config4P = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -2004,14 +2191,15 @@ static const MARTe::char8 *const config6P = ""
         "            Filename = \"filereader_test.csv\""
         "            FileFormat = csv"
         "            CSVSeparator = \";\""
-        "            Interpolate = no"
         "            Preload = yes"
+        "            EOF = Error"
+        "            Interpolate = no"
         "            XAxisSignal = SignalUInt32"
         "            +Messages = {"
         "                Class = ReferenceContainer"
         "                +FileRuntimeError = {"
-        "                    Class = ReferenceContainer"
-        "                    Destination = FileReaderTestHelper"
+        "                    Class = Message"
+        "                    Destination = FileReaderTestHelperError"
         "                    Function = HandleRuntimeError"
         "                    Mode = ExpectsReply"
         "                }"
@@ -2048,8 +2236,8 @@ static const MARTe::char8 *const config6P = ""
         "    }"
         "}";
 
-//As config1 but with Frequency set
-static const MARTe::char8 *const config7 = ""
+//Invalid runtime error message name
+static const MARTe::char8 *const config5 = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -2076,7 +2264,6 @@ static const MARTe::char8 *const config7 = ""
         "                SignalUInt32 = {"
         "                    Type = uint32"
         "                    DataSource = Drv1"
-        "                    Frequency = 500000000"
         "                }"
         "                SignalInt32 = {"
         "                    Type = int32"
@@ -2112,10 +2299,11 @@ static const MARTe::char8 *const config7 = ""
         "            Filename = \"filereader_test.csv\""
         "            FileFormat = csv"
         "            CSVSeparator = \";\""
-        "            Interpolate = yes"
+        "            Interpolate = no"
+        "            XAxisSignal = SignalUInt32"
         "            +Messages = {"
         "                Class = ReferenceContainer"
-        "                +FileRuntimeError = {"
+        "                +FileRuntimeErrorNew = {"
         "                    Class = Message"
         "                    Destination = FileReaderTestHelper"
         "                    Function = HandleRuntimeError"
@@ -2154,8 +2342,8 @@ static const MARTe::char8 *const config7 = ""
         "    }"
         "}";
 
-//As config1 with strings
-static const MARTe::char8 *const config8 = ""
+//Invalid runtime error message type
+static const MARTe::char8 *const config6 = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -2203,16 +2391,6 @@ static const MARTe::char8 *const config8 = ""
         "                    Type = float64"
         "                    DataSource = Drv1"
         "                }"
-        "                SignalChar8 = {"
-        "                    Type = char8"
-        "                    DataSource = Drv1"
-        "                    NumberOfElements = 5"
-        "                }"
-        "                SignalString = {"
-        "                    Type = string"
-        "                    DataSource = Drv1"
-        "                    NumberOfElements = 7"
-        "                }"
         "            }"
         "        }"
         "    }"
@@ -2232,7 +2410,7 @@ static const MARTe::char8 *const config8 = ""
         "            +Messages = {"
         "                Class = ReferenceContainer"
         "                +FileRuntimeError = {"
-        "                    Class = Message"
+        "                    Class = ReferenceContainer"
         "                    Destination = FileReaderTestHelper"
         "                    Function = HandleRuntimeError"
         "                    Mode = ExpectsReply"
@@ -2270,8 +2448,8 @@ static const MARTe::char8 *const config8 = ""
         "    }"
         "}";
 
-//As config1 but with EOF set to Rewind
-static const MARTe::char8 *const config9 = ""
+//Invalid runtime error message type
+static const MARTe::char8 *const config6P = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -2334,12 +2512,12 @@ static const MARTe::char8 *const config9 = ""
         "            FileFormat = csv"
         "            CSVSeparator = \";\""
         "            Interpolate = no"
+        "            Preload = yes"
         "            XAxisSignal = SignalUInt32"
-        "            EOF = Rewind"
         "            +Messages = {"
         "                Class = ReferenceContainer"
         "                +FileRuntimeError = {"
-        "                    Class = Message"
+        "                    Class = ReferenceContainer"
         "                    Destination = FileReaderTestHelper"
         "                    Function = HandleRuntimeError"
         "                    Mode = ExpectsReply"
@@ -2377,8 +2555,8 @@ static const MARTe::char8 *const config9 = ""
         "    }"
         "}";
 
-//As config1 but with EOF set to Rewind
-static const MARTe::char8 *const config9P = ""
+//As config1 but with Frequency set
+static const MARTe::char8 *const config7 = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -2405,6 +2583,7 @@ static const MARTe::char8 *const config9P = ""
         "                SignalUInt32 = {"
         "                    Type = uint32"
         "                    DataSource = Drv1"
+        "                    Frequency = 500000000"
         "                }"
         "                SignalInt32 = {"
         "                    Type = int32"
@@ -2440,10 +2619,338 @@ static const MARTe::char8 *const config9P = ""
         "            Filename = \"filereader_test.csv\""
         "            FileFormat = csv"
         "            CSVSeparator = \";\""
-        "            Interpolate = no"
-        "            Preload = yes"
-        "            XAxisSignal = SignalUInt32"
-        "            EOF = Rewind"
+        "            Interpolate = yes"
+        "            +Messages = {"
+        "                Class = ReferenceContainer"
+        "                +FileRuntimeError = {"
+        "                    Class = Message"
+        "                    Destination = FileReaderTestHelper"
+        "                    Function = HandleRuntimeError"
+        "                    Mode = ExpectsReply"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = FileReaderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}"
+        "+FileReaderTestHelper = {"
+        "    Class = FileReaderTestHelper"
+        "}"
+        "+TestMessages = {"
+        "    Class = ReferenceContainer"
+        "    +MessageFlush = {"
+        "        Class = Message"
+        "        Destination = \"Test.Data.Drv1\""
+        "        Function = FlushFile"
+        "    }"
+        "}";
+
+//As config1 with strings
+static const MARTe::char8 *const config8 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = FileReaderGAMTriggerTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt8 = {"
+        "                    Type = uint8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt8 = {"
+        "                    Type = int8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt16 = {"
+        "                    Type = int16"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt64 = {"
+        "                    Type = int64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat32 = {"
+        "                    Type = float32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat64WhichIsAlsoAVeryLon = {"
+        "                    Type = float64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalChar8 = {"
+        "                    Type = char8"
+        "                    DataSource = Drv1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalString = {"
+        "                    Type = string"
+        "                    DataSource = Drv1"
+        "                    NumberOfElements = 7"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +Drv1 = {"
+        "            Class = FileReader"
+        "            Filename = \"filereader_test.csv\""
+        "            FileFormat = csv"
+        "            CSVSeparator = \";\""
+        "            Interpolate = no"
+        "            XAxisSignal = SignalUInt32"
+        "            +Messages = {"
+        "                Class = ReferenceContainer"
+        "                +FileRuntimeError = {"
+        "                    Class = Message"
+        "                    Destination = FileReaderTestHelper"
+        "                    Function = HandleRuntimeError"
+        "                    Mode = ExpectsReply"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = FileReaderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}"
+        "+FileReaderTestHelper = {"
+        "    Class = FileReaderTestHelper"
+        "}"
+        "+TestMessages = {"
+        "    Class = ReferenceContainer"
+        "    +MessageFlush = {"
+        "        Class = Message"
+        "        Destination = \"Test.Data.Drv1\""
+        "        Function = FlushFile"
+        "    }"
+        "}";
+
+//As config1 but with EOF set to Rewind
+static const MARTe::char8 *const config9 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = FileReaderGAMTriggerTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt8 = {"
+        "                    Type = uint8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt8 = {"
+        "                    Type = int8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt16 = {"
+        "                    Type = int16"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt64 = {"
+        "                    Type = int64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat32 = {"
+        "                    Type = float32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat64WhichIsAlsoAVeryLon = {"
+        "                    Type = float64"
+        "                    DataSource = Drv1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +Drv1 = {"
+        "            Class = FileReader"
+        "            Filename = \"filereader_test.csv\""
+        "            FileFormat = csv"
+        "            CSVSeparator = \";\""
+        "            Interpolate = no"
+        "            XAxisSignal = SignalUInt32"
+        "            EOF = Rewind"
+        "            +Messages = {"
+        "                Class = ReferenceContainer"
+        "                +FileRuntimeError = {"
+        "                    Class = Message"
+        "                    Destination = FileReaderTestHelper"
+        "                    Function = HandleRuntimeError"
+        "                    Mode = ExpectsReply"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = FileReaderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}"
+        "+FileReaderTestHelper = {"
+        "    Class = FileReaderTestHelper"
+        "}"
+        "+TestMessages = {"
+        "    Class = ReferenceContainer"
+        "    +MessageFlush = {"
+        "        Class = Message"
+        "        Destination = \"Test.Data.Drv1\""
+        "        Function = FlushFile"
+        "    }"
+        "}";
+
+//As config1 but with EOF set to Rewind
+static const MARTe::char8 *const config9P = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = FileReaderGAMTriggerTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt8 = {"
+        "                    Type = uint8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt8 = {"
+        "                    Type = int8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt16 = {"
+        "                    Type = int16"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt64 = {"
+        "                    Type = int64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat32 = {"
+        "                    Type = float32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat64WhichIsAlsoAVeryLon = {"
+        "                    Type = float64"
+        "                    DataSource = Drv1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +Drv1 = {"
+        "            Class = FileReader"
+        "            Filename = \"filereader_test.csv\""
+        "            FileFormat = csv"
+        "            CSVSeparator = \";\""
+        "            Interpolate = no"
+        "            Preload = yes"
+        "            XAxisSignal = SignalUInt32"
+        "            EOF = Rewind"
         "            +Messages = {"
         "                Class = ReferenceContainer"
         "                +FileRuntimeError = {"
@@ -2957,7 +3464,7 @@ bool FileReaderTest::TestGetBrokerName_OutputSignals() {
     return ok;
 }
 
-bool FileReaderTest::TestGetBrokerName_MemoryMapInterpolatedInputBroker() {
+bool FileReaderTest::TestGetBrokerName_FileReaderInterpolatedInputBroker() {
     using namespace MARTe;
     FileReader test;
     ConfigurationDatabase cdb;
@@ -2972,7 +3479,7 @@ bool FileReaderTest::TestGetBrokerName_MemoryMapInterpolatedInputBroker() {
     cdb.MoveToRoot();
     bool ok = test.Initialise(cdb);
     if (ok) {
-        ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "MemoryMapInterpolatedInputBroker") == 0);
+        ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "FileReaderInterpolatedInputBroker") == 0);
     }
     DeleteTestFile(filename);
     return ok;
@@ -3031,6 +3538,42 @@ bool FileReaderTest::TestSynchronise_CSV() {
     return ok;
 }
 
+bool FileReaderTest::TestSynchronise_CSV_Cache() {
+    using namespace MARTe;
+    const char8 *const filename = "TestIntegratedExecution.csv";
+    const char8 *const cacheFilename = "TestIntegratedExecution.csv.cache";
+    uint32 numberOfElements[] = { 2, 4, 5, 2, 3, 4, 3, 2, 4, 2 };
+    const uint32 signalToVerifyNumberOfSamples = 3u;
+    FRTSignalToVerify **signals = new FRTSignalToVerify*[signalToVerifyNumberOfSamples];
+    uint32 i;
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        signals[i] = new FRTSignalToVerify(numberOfElements, i + 1);
+    }
+    DeleteTestFile(cacheFilename);
+    GenerateCSVFile(filename, ";", signals, numberOfElements, signalToVerifyNumberOfSamples);
+    //The first execution decodes the csv file (with a read buffer smaller than the lines) and stores the sidecar file
+    bool ok = TestIntegratedExecution(config1C, filename, signals, numberOfElements, signalToVerifyNumberOfSamples, true, 0, "", true, false, ";");
+    if (ok) {
+        File cacheFile;
+        ok = cacheFile.Open(cacheFilename, BasicFile::ACCESS_MODE_R);
+        if (ok) {
+            ok = (cacheFile.Size() > 0u);
+            (void) cacheFile.Close();
+        }
+    }
+    //The second execution loads the sidecar file
+    if (ok) {
+        ok = TestIntegratedExecution(config1C, filename, signals, numberOfElements, signalToVerifyNumberOfSamples, true, 0, "", true, false, ";");
+    }
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        delete signals[i];
+    }
+    delete signals;
+    DeleteTestFile(filename);
+    DeleteTestFile(cacheFilename);
+    return ok;
+}
+
 bool FileReaderTest::TestSynchronise_CSV_Strings() {
     using namespace MARTe;
     const char8 *filename = "FileReaderTest_Test.csv";
@@ -3119,65 +3662,163 @@ bool FileReaderTest::TestSynchronise_CSV_Strings() {
     if (ok) {
         ok = application->StopCurrentStateExecution();
     }
-    god->Purge();
-
-    DeleteTestFile(filename);
-
+    god->Purge();
+
+    DeleteTestFile(filename);
+
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_CSV_Comma() {
+    using namespace MARTe;
+    bool ok = true;
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        ok = TestIntegratedExecution(config1, true, &numberOfElements[0], ",");
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 3, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecution(config1, true, &numberOfElements[0], ",");
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_CSV_Interpolation() {
+    using namespace MARTe;
+    bool ok = true;
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        ok = TestIntegratedExecutionInterpolation(config1, true, &numberOfElements[0]);
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 1, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecutionInterpolation(config1, true, &numberOfElements[0]);
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_CSV_Interpolation_Preload() {
+    using namespace MARTe;
+    bool ok = true;
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        ok = TestIntegratedExecutionInterpolation(config1P, true, &numberOfElements[0]);
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 1, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecutionInterpolation(config1P, true, &numberOfElements[0]);
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_Binary() {
+    using namespace MARTe;
+    bool ok = true;
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        ok = TestIntegratedExecution(config1, false, &numberOfElements[0], ";");
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 3, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecution(config1, false, &numberOfElements[0], ";");
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_Binary_Compressed() {
+    using namespace MARTe;
+    bool ok = true;
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        ok = TestIntegratedExecution(config1, false, &numberOfElements[0], ";", false, false, false, "lz4");
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 3, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecution(config1, false, &numberOfElements[0], ";", false, false, false, "lz4");
+    }
     return ok;
 }
 
-bool FileReaderTest::TestSynchronise_CSV_Comma() {
+bool FileReaderTest::TestSynchronise_Binary_Columnar() {
     using namespace MARTe;
     bool ok = true;
     if (ok) {
         uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
-        ok = TestIntegratedExecution(config1, true, &numberOfElements[0], ",");
+        ok = TestIntegratedExecution(config1, false, &numberOfElements[0], ";", false, false, false, NULL, true);
     }
     if (ok) {
         uint32 numberOfElements[] = { 2, 4, 5, 2, 3, 4, 3, 2, 4, 2 };
-        ok = TestIntegratedExecution(config1, true, &numberOfElements[0], ",");
+        ok = TestIntegratedExecution(config1, false, &numberOfElements[0], ";", false, false, false, NULL, true);
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 3, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecution(config1, false, &numberOfElements[0], ";", false, false, false, "lz4", true);
     }
     return ok;
 }
 
-bool FileReaderTest::TestSynchronise_CSV_Interpolation() {
+bool FileReaderTest::TestSynchronise_Binary_MemoryMap() {
     using namespace MARTe;
     bool ok = true;
     if (ok) {
         uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
-        ok = TestIntegratedExecutionInterpolation(config1, true, &numberOfElements[0]);
+        ok = TestIntegratedExecution(config1M, false, &numberOfElements[0], ";");
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 3, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecution(config1M, false, &numberOfElements[0], ";");
     }
     if (ok) {
         uint32 numberOfElements[] = { 2, 4, 5, 2, 1, 4, 3, 2, 4, 2 };
-        ok = TestIntegratedExecutionInterpolation(config1, true, &numberOfElements[0]);
+        ok = TestIntegratedExecutionInterpolation(config1M, false, &numberOfElements[0]);
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        ok = TestIntegratedExecution(config1M, false, &numberOfElements[0], ";", true, false, false);
     }
     return ok;
 }
 
-bool FileReaderTest::TestSynchronise_CSV_Interpolation_Preload() {
+bool FileReaderTest::TestSynchronise_Binary_Prefetch() {
     using namespace MARTe;
     bool ok = true;
     if (ok) {
         uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
-        ok = TestIntegratedExecutionInterpolation(config1P, true, &numberOfElements[0]);
+        ok = TestIntegratedExecution(config1F, false, &numberOfElements[0], ";");
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 3, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecution(config1F, false, &numberOfElements[0], ";");
     }
     if (ok) {
         uint32 numberOfElements[] = { 2, 4, 5, 2, 1, 4, 3, 2, 4, 2 };
-        ok = TestIntegratedExecutionInterpolation(config1P, true, &numberOfElements[0]);
+        ok = TestIntegratedExecutionInterpolation(config1F, false, &numberOfElements[0]);
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        ok = TestIntegratedExecution(config1F, false, &numberOfElements[0], ";", true, false, false);
     }
     return ok;
 }
 
-bool FileReaderTest::TestSynchronise_Binary() {
+bool FileReaderTest::TestSynchronise_SeekIndex() {
     using namespace MARTe;
     bool ok = true;
     if (ok) {
         uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
-        ok = TestIntegratedExecution(config1, false, &numberOfElements[0], ";");
+        ok = TestIntegratedExecutionSeek(config1, false, false, &numberOfElements[0]);
     }
     if (ok) {
-        uint32 numberOfElements[] = { 2, 4, 5, 2, 3, 4, 3, 2, 4, 2 };
-        ok = TestIntegratedExecution(config1, false, &numberOfElements[0], ";");
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 1, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecutionSeek(config1, false, true, &numberOfElements[0]);
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 1, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecutionSeek(config1, true, false, &numberOfElements[0]);
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        ok = TestIntegratedExecutionSeek(config1, true, true, &numberOfElements[0]);
     }
     return ok;
 }
@@ -3529,6 +4170,46 @@ bool FileReaderTest::TestInitialise_Preload_no() {
     return ok;
 }
 
+bool FileReaderTest::TestInitialise_CSVCache() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_TestInitialise.csv";
+    GenerateFile(filename);
+    cdb.Write("Filename", filename);
+    cdb.Write("Interpolate", "no");
+    cdb.Write("Preload", "yes");
+    cdb.Write("CSVSeparator", ";");
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("CSVCache", "yes");
+    cdb.Write("CSVBufferSize", 4096);
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.IsCSVCache());
+    ok &= (test.GetCSVBufferSize() == 4096);
+    DeleteTestFile(filename);
+    return ok;
+}
+
+bool FileReaderTest::TestInitialise_False_CSVCache() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_TestInitialise.csv";
+    GenerateFile(filename);
+    cdb.Write("Filename", filename);
+    cdb.Write("Interpolate", "no");
+    cdb.Write("Preload", "no");
+    cdb.Write("CSVSeparator", ";");
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("CSVCache", "yes");
+    cdb.MoveToRoot();
+    //The decoded data is only cached if the file is preloaded
+    bool ok = !test.Initialise(cdb);
+    DeleteTestFile(filename);
+    return ok;
+}
+
 bool FileReaderTest::TestInitialise_Preload_yes_NoMaxSize() {
     using namespace MARTe;
     FileReader test;
@@ -3566,6 +4247,200 @@ bool FileReaderTest::TestInitialise_Preload_yes_MaxSizeToLarge() {
     return ok;
 }
 
+bool FileReaderTest::TestInitialise_MemoryMap() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_TestInitialise.bin";
+    uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+    const uint32 signalToVerifyNumberOfSamples = 3u;
+    FRTSignalToVerify **signals = new FRTSignalToVerify*[signalToVerifyNumberOfSamples];
+    uint32 i;
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        signals[i] = new FRTSignalToVerify(numberOfElements, i + 1);
+    }
+    GenerateBinaryFile(filename, signals, numberOfElements, signalToVerifyNumberOfSamples);
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        delete signals[i];
+    }
+    delete signals;
+    cdb.Write("Filename", filename);
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Interpolate", "no");
+    cdb.Write("MemoryMap", "yes");
+    cdb.Write("ReadAheadSize", 65536);
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.IsMemoryMap());
+    ok &= (test.GetReadAheadSize() == 65536);
+    DeleteTestFile(filename);
+    return ok;
+}
+
+bool FileReaderTest::TestInitialise_False_MemoryMap() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_TestInitialise.csv";
+    GenerateFile(filename);
+    cdb.Write("Filename", filename);
+    cdb.Write("Interpolate", "no");
+    cdb.Write("CSVSeparator", ";");
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("MemoryMap", "yes");
+    cdb.MoveToRoot();
+    //Only binary files can be mapped
+    bool ok = !test.Initialise(cdb);
+    DeleteTestFile(filename);
+    return ok;
+}
+
+bool FileReaderTest::TestInitialise_Prefetch() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_TestInitialise.bin";
+    uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+    const uint32 signalToVerifyNumberOfSamples = 3u;
+    FRTSignalToVerify **signals = new FRTSignalToVerify*[signalToVerifyNumberOfSamples];
+    uint32 i;
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        signals[i] = new FRTSignalToVerify(numberOfElements, i + 1);
+    }
+    GenerateBinaryFile(filename, signals, numberOfElements, signalToVerifyNumberOfSamples);
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        delete signals[i];
+    }
+    delete signals;
+    cdb.Write("Filename", filename);
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Interpolate", "no");
+    cdb.Write("PrefetchCycles", 64);
+    cdb.Write("NumberOfPrefetchBuffers", 4);
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetPrefetchCycles() == 64);
+    ok &= (test.GetNumberOfPrefetchStalls() == 0u);
+    DeleteTestFile(filename);
+    return ok;
+}
+
+bool FileReaderTest::TestInitialise_False_Prefetch() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_TestInitialise.csv";
+    GenerateFile(filename);
+    cdb.Write("Filename", filename);
+    cdb.Write("Interpolate", "no");
+    cdb.Write("CSVSeparator", ";");
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("PrefetchCycles", 64);
+    cdb.MoveToRoot();
+    //Only binary files can be prefetched
+    bool ok = !test.Initialise(cdb);
+    DeleteTestFile(filename);
+    return ok;
+}
+
+bool FileReaderTest::TestInitialise_False_NumberOfPrefetchBuffers() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_TestInitialise.bin";
+    uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+    const uint32 signalToVerifyNumberOfSamples = 3u;
+    FRTSignalToVerify **signals = new FRTSignalToVerify*[signalToVerifyNumberOfSamples];
+    uint32 i;
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        signals[i] = new FRTSignalToVerify(numberOfElements, i + 1);
+    }
+    GenerateBinaryFile(filename, signals, numberOfElements, signalToVerifyNumberOfSamples);
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        delete signals[i];
+    }
+    delete signals;
+    cdb.Write("Filename", filename);
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Interpolate", "no");
+    cdb.Write("PrefetchCycles", 64);
+    cdb.Write("NumberOfPrefetchBuffers", 1);
+    cdb.MoveToRoot();
+    //At least two buffers are needed to read while the next one is filled
+    bool ok = !test.Initialise(cdb);
+    DeleteTestFile(filename);
+    return ok;
+}
+
+bool FileReaderTest::TestInitialise_SeekIndex() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_TestInitialise.csv";
+    GenerateFile(filename);
+    cdb.Write("Filename", filename);
+    cdb.Write("Interpolate", "no");
+    cdb.Write("CSVSeparator", ";");
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("SeekIndexStep", 100);
+    cdb.Write("SeekIndexCache", "yes");
+    cdb.Write("XAxisSignal", "SignalUInt32");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetSeekIndexStep() == 100u);
+    ok &= (test.GetXAxisSignal() == "SignalUInt32");
+    //The index is only built by SetConfiguredDatabase
+    ok &= (test.GetSeekIndexSize() == 0u);
+    ok &= !test.SeekCycle(0u).ErrorsCleared();
+    ok &= !test.SeekTime(0u).ErrorsCleared();
+    DeleteTestFile(filename);
+    return ok;
+}
+
+bool FileReaderTest::TestInitialise_False_SeekIndex() {
+    using namespace MARTe;
+    const char8 *const filename = "FileReaderTest_TestInitialise.bin";
+    uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+    const uint32 signalToVerifyNumberOfSamples = 3u;
+    FRTSignalToVerify **signals = new FRTSignalToVerify*[signalToVerifyNumberOfSamples];
+    uint32 i;
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        signals[i] = new FRTSignalToVerify(numberOfElements, i + 1);
+    }
+    GenerateBinaryFile(filename, signals, numberOfElements, signalToVerifyNumberOfSamples);
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        delete signals[i];
+    }
+    delete signals;
+    bool ok = true;
+    //The XAxisSignal is needed to index the file
+    if (ok) {
+        FileReader test;
+        ConfigurationDatabase cdb;
+        cdb.Write("Filename", filename);
+        cdb.Write("FileFormat", "binary");
+        cdb.Write("Interpolate", "no");
+        cdb.Write("SeekIndexStep", 10);
+        cdb.MoveToRoot();
+        ok = !test.Initialise(cdb);
+    }
+    //The prefetch thread owns the file position
+    if (ok) {
+        FileReader test;
+        ConfigurationDatabase cdb;
+        cdb.Write("Filename", filename);
+        cdb.Write("FileFormat", "binary");
+        cdb.Write("Interpolate", "no");
+        cdb.Write("SeekIndexStep", 10);
+        cdb.Write("XAxisSignal", "SignalUInt32");
+        cdb.Write("PrefetchCycles", 64);
+        cdb.MoveToRoot();
+        ok = !test.Initialise(cdb);
+    }
+    DeleteTestFile(filename);
+    return ok;
+}
+
 bool FileReaderTest::TestSetConfiguredDatabase() {
     using namespace MARTe;
     uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
@@ -3607,6 +4482,48 @@ bool FileReaderTest::TestSetConfiguredDatabase_False_NumberOfSamples() {
     return ok;
 }
 
+bool FileReaderTest::TestSetConfiguredDatabase_NumberOfSamples_Interpolate() {
+    using namespace MARTe;
+    const char8 *const filename = "config2.csv";
+    GenerateFile(filename);
+    ConfigurationDatabase cdb;
+    StreamString configStream = config2;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Data.+Drv1");
+    }
+    if (ok) {
+        ok = cdb.Delete("Interpolate");
+    }
+    if (ok) {
+        ok = cdb.Write("Interpolate", "yes");
+    }
+    if (ok) {
+        ok = cdb.Write("InterpolationPeriod", 2);
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    god->Purge();
+    DeleteTestFile(filename);
+    return ok;
+}
+
 bool FileReaderTest::TestSetConfiguredDatabase_WrongFileSize_CSV() {
     using namespace MARTe;
     const char8 *const filename = "filereader_test.csv";
@@ -67,9 +67,9 @@ public:
     bool TestGetBrokerName_OutputSignals();
 
     /**
-     * @brief Tests that the GetBrokerName method correctly returns a MemoryMapInterpolatedInputBroker.
+     * @brief Tests that the GetBrokerName method correctly returns a FileReaderInterpolatedInputBroker.
      */
-    bool TestGetBrokerName_MemoryMapInterpolatedInputBroker();
+    bool TestGetBrokerName_FileReaderInterpolatedInputBroker();
 
     /**
      * @brief Tests that the GetBrokerName method correctly returns a MemoryMapInputBroker.
@@ -101,6 +101,11 @@ public:
      */
     bool TestSynchronise_CSV_Strings();
 
+    /**
+     * @brief Tests the Synchronise method with csv files preloaded with CSVCache = yes (storing and then loading the sidecar file).
+     */
+    bool TestSynchronise_CSV_Cache();
+
     /**
      * @brief Tests the Synchronise method with csv files and interpolation.
      */
@@ -116,6 +121,31 @@ public:
      */
     bool TestSynchronise_Binary();
 
+    /**
+     * @brief Tests the Synchronise method with binary files compressed in frames (as written by the FileWriter with Compression = lz4).
+     */
+    bool TestSynchronise_Binary_Compressed();
+
+    /**
+     * @brief Tests the Synchronise method with binary files stored in columnar chunks (as written by the FileWriter with Layout = columnar).
+     */
+    bool TestSynchronise_Binary_Columnar();
+
+    /**
+     * @brief Tests the Synchronise method with binary files mapped in memory (MemoryMap = yes).
+     */
+    bool TestSynchronise_Binary_MemoryMap();
+
+    /**
+     * @brief Tests the Synchronise method with binary files read by the prefetch thread (PrefetchCycles > 0).
+     */
+    bool TestSynchronise_Binary_Prefetch();
+
+    /**
+     * @brief Tests the Synchronise method after the SeekCycle and SeekTime requests (SeekIndexStep > 0).
+     */
+    bool TestSynchronise_SeekIndex();
+
     /**
      * @brief Tests the Synchronise method with binary files and interpolation.
      */
@@ -216,6 +246,16 @@ public:
      */
     bool TestInitialise_Preload_no();
 
+    /**
+     * @brief Tests the Initialise method with CSVCache = yes and CSVBufferSize.
+     */
+    bool TestInitialise_CSVCache();
+
+    /**
+     * @brief Tests that the Initialise method fails with CSVCache = yes and Preload = no.
+     */
+    bool TestInitialise_False_CSVCache();
+
     /**
      * @brief Tests the Initialise method with Preaload = "yes" MaxFileByteSize not specified.
      */
@@ -226,6 +266,41 @@ public:
      */
     bool TestInitialise_Preload_yes_MaxSizeToLarge();
 
+    /**
+     * @brief Tests the Initialise method with MemoryMap = yes.
+     */
+    bool TestInitialise_MemoryMap();
+
+    /**
+     * @brief Tests that the Initialise method fails with MemoryMap = yes and FileFormat = csv.
+     */
+    bool TestInitialise_False_MemoryMap();
+
+    /**
+     * @brief Tests the Initialise method with PrefetchCycles > 0.
+     */
+    bool TestInitialise_Prefetch();
+
+    /**
+     * @brief Tests that the Initialise method fails with PrefetchCycles > 0 and FileFormat = csv.
+     */
+    bool TestInitialise_False_Prefetch();
+
+    /**
+     * @brief Tests that the Initialise method fails with NumberOfPrefetchBuffers < 2.
+     */
+    bool TestInitialise_False_NumberOfPrefetchBuffers();
+
+    /**
+     * @brief Tests the Initialise method with SeekIndexStep > 0 and SeekIndexCache = yes.
+     */
+    bool TestInitialise_SeekIndex();
+
+    /**
+     * @brief Tests that the Initialise method fails with SeekIndexStep > 0 and no XAxisSignal or PrefetchCycles > 0.
+     */
+    bool TestInitialise_False_SeekIndex();
+
     /**
      * @brief Tests the SetConfiguredDatabase.
      */
@@ -241,6 +316,11 @@ public:
      */
     bool TestSetConfiguredDatabase_False_NumberOfSamples();
 
+    /**
+     * @brief Tests the SetConfiguredDatabase with more than one sample and Interpolate = yes.
+     */
+    bool TestSetConfiguredDatabase_NumberOfSamples_Interpolate();
+
     /**
      * @brief Tests the SetConfiguredDatabase wrong file size.
      */
@@ -68,6 +68,81 @@ TEST(FileWriterGTest,TestInitialise_Binary) {
     ASSERT_TRUE(test.TestInitialise_Binary());
 }
 
+TEST(FileWriterGTest,TestInitialise_Batch) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_Batch());
+}
+
+TEST(FileWriterGTest,TestInitialise_False_BatchCycles_CSV) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BatchCycles_CSV());
+}
+
+TEST(FileWriterGTest,TestInitialise_False_NumberOfBatchBuffers) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NumberOfBatchBuffers());
+}
+
+TEST(FileWriterGTest,TestInitialise_Rotate) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_Rotate());
+}
+
+TEST(FileWriterGTest,TestInitialise_False_Rotate_NoBatchCycles) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Rotate_NoBatchCycles());
+}
+
+TEST(FileWriterGTest,TestInitialise_FlightRecorder) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_FlightRecorder());
+}
+
+TEST(FileWriterGTest,TestInitialise_False_FlightRecorder_StoreOnTrigger) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_FlightRecorder_StoreOnTrigger());
+}
+
+TEST(FileWriterGTest,TestInitialise_False_FlightRecorder_Window) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_FlightRecorder_Window());
+}
+
+TEST(FileWriterGTest,TestInitialise_False_IOBackend) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_IOBackend());
+}
+
+TEST(FileWriterGTest,TestInitialise_Compression) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_Compression());
+}
+
+TEST(FileWriterGTest,TestInitialise_False_Compression) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Compression());
+}
+
+TEST(FileWriterGTest,TestInitialise_Layout) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_Layout());
+}
+
+TEST(FileWriterGTest,TestInitialise_False_Layout) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Layout());
+}
+
+TEST(FileWriterGTest,TestInitialise_CSVFloatFormat) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_CSVFloatFormat());
+}
+
+TEST(FileWriterGTest,TestInitialise_False_CSVFloatFormat) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_CSVFloatFormat());
+}
+
 TEST(FileWriterGTest,TestInitialise_False_NumberOfBuffers) {
     FileWriterTest test;
     ASSERT_TRUE(test.TestInitialise_False_NumberOfBuffers());
@@ -88,6 +163,11 @@ TEST(FileWriterGTest,TestInitialise_False_NumberOfBuffers_GT_0) {
     ASSERT_TRUE(test.TestInitialise_False_NumberOfBuffers_GT_0());
 }
 
+TEST(FileWriterGTest,TestInitialise_False_HeapName) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_HeapName());
+}
+
 TEST(FileWriterGTest,TestInitialise_False_CPUMask) {
     FileWriterTest test;
     ASSERT_TRUE(test.TestInitialise_False_CPUMask());
@@ -198,6 +278,11 @@ TEST(FileWriterGTest,TestGetBrokerName_MemoryMapAsyncTriggerOutputBroker) {
     ASSERT_TRUE(test.TestGetBrokerName_MemoryMapAsyncTriggerOutputBroker());
 }
 
+TEST(FileWriterGTest,TestGetBrokerName_MemoryMapSynchronisedOutputBroker) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestGetBrokerName_MemoryMapSynchronisedOutputBroker());
+}
+
 TEST(FileWriterGTest,TestGetInputBrokers) {
     FileWriterTest test;
     ASSERT_TRUE(test.TestGetInputBrokers());
@@ -213,6 +298,21 @@ TEST(FileWriterGTest,TestSynchronise) {
     ASSERT_TRUE(test.TestSynchronise());
 }
 
+TEST(FileWriterGTest,TestSynchronise_Batch) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestSynchronise_Batch());
+}
+
+TEST(FileWriterGTest,TestSynchronise_Batch_IOUring) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestSynchronise_Batch_IOUring());
+}
+
+TEST(FileWriterGTest,TestSynchronise_FlightRecorder) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestSynchronise_FlightRecorder());
+}
+
 TEST(FileWriterGTest,TestPrepareNextState) {
     FileWriterTest test;
     ASSERT_TRUE(test.TestPrepareNextState());
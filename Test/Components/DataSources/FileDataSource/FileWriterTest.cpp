@@ -340,7 +340,9 @@ static bool TestIntegratedExecution(const MARTe::char8 * const config, MARTe::ui
                                     MARTe::uint32 numberOfPreTriggers, MARTe::uint32 numberOfPostTriggers, MARTe::float32 period,
                                     const MARTe::char8 * const filename, const MARTe::char8 * const expectedFileContent, bool csv,
                                     const MARTe::uint32 sleepMSec = 100, 
-                                    const MARTe::uint8 refreshContent = 0u, MARTe::uint32 * detectedSize = NULL) {
+                                    const MARTe::uint8 refreshContent = 0u, MARTe::uint32 * detectedSize = NULL,
+                                    const MARTe::uint32 batchCycles = 0u, const MARTe::char8 * const ioBackend = NULL,
+                                    const MARTe::uint32 flightRecorderCycles = 0u, const MARTe::char8 * const flightRecorderFile = NULL) {
     using namespace MARTe;
     ConfigurationDatabase cdb;
     StreamString configStream = config;
@@ -384,6 +386,23 @@ static bool TestIntegratedExecution(const MARTe::char8 * const config, MARTe::ui
     cdb.Write("StoreOnTrigger", storeOnTrigger);
     cdb.Delete("RefreshContent");
     cdb.Write("RefreshContent", refreshContent);
+    if (batchCycles > 0u) {
+        cdb.Delete("BatchCycles");
+        cdb.Write("BatchCycles", batchCycles);
+    }
+    if (ioBackend != NULL) {
+        cdb.Delete("IOBackend");
+        cdb.Write("IOBackend", ioBackend);
+    }
+    if (flightRecorderCycles > 0u) {
+        //The trigger is handled by the flight recorder and not by the broker
+        cdb.Delete("StoreOnTrigger");
+        cdb.Write("StoreOnTrigger", 0);
+        cdb.Write("FlightRecorderCycles", flightRecorderCycles);
+        if (flightRecorderFile != NULL) {
+            cdb.Write("FlightRecorderFile", flightRecorderFile);
+        }
+    }
 
     cdb.Delete("FileFormat");
     if (csv) {
@@ -2733,6 +2752,30 @@ bool FileWriterTest::TestGetBrokerName_MemoryMapAsyncTriggerOutputBroker() {
     return ok;
 }
 
+bool FileWriterTest::TestGetBrokerName_MemoryMapSynchronisedOutputBroker() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "TestGetBrokerName_MemoryMapSynchronisedOutputBroker");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("NumberOfPreTriggers", 2);
+    cdb.Write("NumberOfPostTriggers", 1);
+    cdb.Write("FlightRecorderCycles", 10);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (StringHelper::Compare(test.GetBrokerName(cdb, OutputSignals), "MemoryMapSynchronisedOutputBroker") == 0);
+    }
+
+    return ok;
+}
+
 bool FileWriterTest::TestGetInputBrokers() {
     using namespace MARTe;
     FileWriter test;
@@ -2745,6 +2788,36 @@ bool FileWriterTest::TestGetOutputBrokers() {
     return ok;
 }
 
+bool FileWriterTest::TestSynchronise_Batch() {
+    bool ok = TestIntegratedInApplication_NoTrigger("FileWriterTest_TestSynchronise_Batch_Full", false, 0u, NULL, 5u);
+    if (ok) {
+        //The last batch is only partially filled and is written when the file is closed
+        ok = TestIntegratedInApplication_NoTrigger("FileWriterTest_TestSynchronise_Batch_Partial", false, 0u, NULL, 2u);
+    }
+    return ok;
+}
+
+bool FileWriterTest::TestSynchronise_Batch_IOUring() {
+    //If the kernel does not support io_uring the pwrite backend is used and the file content shall be the same
+    bool ok = TestIntegratedInApplication_NoTrigger("FileWriterTest_TestSynchronise_Batch_IOUring_Full", false, 0u, NULL, 5u, "io_uring");
+    if (ok) {
+        ok = TestIntegratedInApplication_NoTrigger("FileWriterTest_TestSynchronise_Batch_IOUring_Partial", false, 0u, NULL, 2u, "io_uring");
+    }
+    return ok;
+}
+
+bool FileWriterTest::TestSynchronise_FlightRecorder() {
+    bool ok = TestIntegratedInApplication_FlightRecorder("FileWriterTest_TestSynchronise_FlightRecorder_Anonymous");
+    if (ok) {
+        ok = TestIntegratedInApplication_FlightRecorder("FileWriterTest_TestSynchronise_FlightRecorder_File", "FileWriterTest_TestSynchronise_FlightRecorder.ring");
+    }
+    if (ok) {
+        MARTe::Directory toDelete("FileWriterTest_TestSynchronise_FlightRecorder.ring");
+        ok = toDelete.Delete();
+    }
+    return ok;
+}
+
 bool FileWriterTest::TestSynchronise() {
     bool ok = true;
     if (ok) {
@@ -2878,6 +2951,338 @@ bool FileWriterTest::TestInitialise_Binary() {
     return ok;
 }
 
+bool FileWriterTest::TestInitialise_Batch() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise_Batch");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("BatchCycles", 10);
+    cdb.Write("NumberOfBatchBuffers", 3);
+    cdb.Write("DirectIO", 1);
+    cdb.Write("PreallocateSize", 1048576);
+    cdb.Write("IOBackend", "io_uring");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetBatchCycles() == 10);
+    ok &= (test.GetNumberOfBatchBuffers() == 3);
+    ok &= (test.IsDirectIO());
+    ok &= (test.GetIOBackend() == "io_uring");
+    return ok;
+}
+
+bool FileWriterTest::TestInitialise_FlightRecorder() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise_FlightRecorder");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("NumberOfPreTriggers", 1000);
+    cdb.Write("NumberOfPostTriggers", 100);
+    cdb.Write("FlightRecorderCycles", 100000);
+    cdb.Write("FlightRecorderFile", "FileWriterTest_TestInitialise_FlightRecorder.ring");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetFlightRecorderCycles() == 100000);
+    ok &= (test.GetFlightRecorderFile() == "FileWriterTest_TestInitialise_FlightRecorder.ring");
+    ok &= (test.GetNumberOfPreTriggers() == 1000);
+    ok &= (test.GetNumberOfPostTriggers() == 100);
+    return ok;
+}
+
+bool FileWriterTest::TestInitialise_False_FlightRecorder_StoreOnTrigger() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 1);
+    cdb.Write("NumberOfPreTriggers", 2);
+    cdb.Write("NumberOfPostTriggers", 1);
+    cdb.Write("FlightRecorderCycles", 100);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool FileWriterTest::TestInitialise_False_FlightRecorder_Window() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("NumberOfPreTriggers", 60);
+    cdb.Write("NumberOfPostTriggers", 39);
+    cdb.Write("FlightRecorderCycles", 100);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool FileWriterTest::TestInitialise_Rotate() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise_Rotate.bin");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("BatchCycles", 10);
+    cdb.Write("RotateSize", 1000000);
+    cdb.Write("RotatePeriod", 60);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetRotateSize() == 1000000);
+    ok &= (test.GetRotatePeriod() == 60);
+    return ok;
+}
+
+bool FileWriterTest::TestInitialise_False_Rotate_NoBatchCycles() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("RotateSize", 1000000);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool FileWriterTest::TestInitialise_False_IOBackend() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("BatchCycles", 10);
+    cdb.Write("IOBackend", "aio");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool FileWriterTest::TestInitialise_Compression() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("BatchCycles", 10);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetCompression() == "none");
+    FileWriter test2;
+    cdb.Write("Compression", "lz4");
+    ok &= test2.Initialise(cdb);
+    ok &= (test2.GetCompression() == "lz4");
+    return ok;
+}
+
+bool FileWriterTest::TestInitialise_False_Compression() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("BatchCycles", 10);
+    cdb.Write("Compression", "gzip");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = !test.Initialise(cdb);
+    //Compression is not supported with DirectIO
+    FileWriter test2;
+    cdb.Delete("Compression");
+    cdb.Write("Compression", "lz4");
+    cdb.Write("DirectIO", 1);
+    ok &= !test2.Initialise(cdb);
+    //Nor without BatchCycles
+    FileWriter test3;
+    cdb.Delete("DirectIO");
+    cdb.Delete("BatchCycles");
+    ok &= !test3.Initialise(cdb);
+    return ok;
+}
+
+bool FileWriterTest::TestInitialise_Layout() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("BatchCycles", 10);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetLayout() == "row");
+    FileWriter test2;
+    cdb.Write("Layout", "columnar");
+    ok &= test2.Initialise(cdb);
+    ok &= (test2.GetLayout() == "columnar");
+    FileWriter test3;
+    cdb.Write("Compression", "lz4");
+    ok &= test3.Initialise(cdb);
+    return ok;
+}
+
+bool FileWriterTest::TestInitialise_False_Layout() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("BatchCycles", 10);
+    cdb.Write("Layout", "hdf5");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = !test.Initialise(cdb);
+    //The columnar layout is not supported with io_uring
+    FileWriter test2;
+    cdb.Delete("Layout");
+    cdb.Write("Layout", "columnar");
+    cdb.Write("IOBackend", "io_uring");
+    ok &= !test2.Initialise(cdb);
+    //Nor without BatchCycles
+    FileWriter test3;
+    cdb.Delete("IOBackend");
+    cdb.Delete("BatchCycles");
+    ok &= !test3.Initialise(cdb);
+    return ok;
+}
+
+bool FileWriterTest::TestInitialise_CSVFloatFormat() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise");
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("CSVSeparator", ",");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetCSVFloatFormat() == "fixed");
+    FileWriter test2;
+    cdb.Write("CSVFloatFormat", "shortest");
+    ok &= test2.Initialise(cdb);
+    ok &= (test2.GetCSVFloatFormat() == "shortest");
+    return ok;
+}
+
+bool FileWriterTest::TestInitialise_False_CSVFloatFormat() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise");
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("CSVSeparator", ",");
+    cdb.Write("CSVFloatFormat", "scientific");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool FileWriterTest::TestInitialise_False_BatchCycles_CSV() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise");
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("CSVSeparator", ",");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("BatchCycles", 10);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool FileWriterTest::TestInitialise_False_NumberOfBatchBuffers() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("BatchCycles", 10);
+    cdb.Write("NumberOfBatchBuffers", 0);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
 bool FileWriterTest::TestInitialise_False_NumberOfBuffers() {
     using namespace MARTe;
     FileWriter test;
@@ -2916,6 +3321,26 @@ bool FileWriterTest::TestInitialise_False_NumberOfBuffers_GT_0() {
     return !test2.Initialise(cdb2);
 }
 
+bool FileWriterTest::TestInitialise_False_HeapName() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("HeapName", "FileWriterTest_NonExistentHeap");
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise");
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("CSVSeparator", ",");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 1);
+    cdb.Write("NumberOfPreTriggers", 2);
+    cdb.Write("NumberOfPostTriggers", 3);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
 bool FileWriterTest::TestInitialise_False_CPUMask() {
     using namespace MARTe;
     FileWriter test;
@@ -3133,7 +3558,7 @@ bool FileWriterTest::TestIntegratedInApplication_RefreshContent(const MARTe::cha
     return TestIntegratedInApplication_NoTrigger( filename, csv, 1u, detectedFileSize);
 }
 
-bool FileWriterTest::TestIntegratedInApplication_NoTrigger( const MARTe::char8 *filename, bool csv, MARTe::uint8 refreshContent, MARTe::uint32* detectedFileSize) {
+bool FileWriterTest::TestIntegratedInApplication_NoTrigger( const MARTe::char8 *filename, bool csv, MARTe::uint8 refreshContent, MARTe::uint32* detectedFileSize, MARTe::uint32 batchCycles, const MARTe::char8 *ioBackend) {
     using namespace MARTe;
     uint32 signalToGenerate[] = { 1, 2, 3, 4, 5 };
     uint32 numberOfElements = sizeof(signalToGenerate) / sizeof(uint32);
@@ -3251,7 +3676,7 @@ bool FileWriterTest::TestIntegratedInApplication_NoTrigger( const MARTe::char8 *
         }
     }
 
-    bool ok = TestIntegratedExecution(config1, signalToGenerate, numberOfElements, NULL, 1u, numberOfBuffers, 0, 0, period, filename, expectedFileContent, csv, 100, refreshContent, detectedFileSize);
+    bool ok = TestIntegratedExecution(config1, signalToGenerate, numberOfElements, NULL, 1u, numberOfBuffers, 0, 0, period, filename, expectedFileContent, csv, 100, refreshContent, detectedFileSize, batchCycles, ioBackend);
     if (!csv) {
         if (expectedFileContent != NULL) {
             char8 *mem = const_cast<char8 *>(&expectedFileContent[0]);
@@ -3477,6 +3902,100 @@ bool FileWriterTest::TestIntegratedInApplication_Trigger(const MARTe::char8 *fil
     return ok;
 }
 
+bool FileWriterTest::TestIntegratedInApplication_FlightRecorder(const MARTe::char8 *filename, const MARTe::char8 *ringFilename) {
+    using namespace MARTe;
+    uint32 signalToGenerate[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    //The second trigger arrives while the first window is being recorded and is ignored
+    uint8 triggerToGenerate[] = { 0, 0, 0, 1, 1, 0, 0, 0 };
+    uint32 numberOfElements = sizeof(signalToGenerate) / sizeof(uint32);
+    const uint32 N_OF_SIGNALS = 12;
+    const char8 *signalNames[N_OF_SIGNALS] = { "Trigger", "Time", "SignalUInt8", "SignalUInt16", "SignalUInt32", "SignalUInt64", "SignalInt8", "SignalInt16",
+            "SignalInt32", "SignalInt64", "SignalFloat32", "SignalFloat64WhichIsAlsoAVeryLon" };
+    const uint16 signalTypes[N_OF_SIGNALS] = { UnsignedInteger8Bit.all, UnsignedInteger32Bit.all, UnsignedInteger8Bit.all, UnsignedInteger16Bit.all,
+            UnsignedInteger32Bit.all, UnsignedInteger64Bit.all, SignedInteger8Bit.all, SignedInteger16Bit.all, SignedInteger32Bit.all, SignedInteger64Bit.all,
+            Float32Bit.all, Float64Bit.all };
+    const uint32 signalElements[N_OF_SIGNALS] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+    const uint32 numberOfBuffers = 16;
+    const uint32 numberOfPreTriggers = 2;
+    const uint32 numberOfPostTriggers = 1;
+    const uint32 flightRecorderCycles = 6;
+    //The window of the trigger at cycle 3
+    const uint32 firstCycle = 1;
+    const uint32 windowCycles = 4;
+    const float32 period = 2;
+
+    uint32 cycleWriteSize = sizeof(uint8); //trigger
+    cycleWriteSize += sizeof(uint32); //time
+    cycleWriteSize += sizeof(uint8); //signalUInt8
+    cycleWriteSize += sizeof(uint16); //signalUInt16
+    cycleWriteSize += sizeof(uint32); //signalUInt32
+    cycleWriteSize += sizeof(uint64); //signalUInt64
+    cycleWriteSize += sizeof(int8); //signalInt8
+    cycleWriteSize += sizeof(int16); //signalInt16
+    cycleWriteSize += sizeof(int32); //signalInt32
+    cycleWriteSize += sizeof(int64); //signalInt64
+    cycleWriteSize += sizeof(float32); //signalFloat32
+    cycleWriteSize += sizeof(float64); //signalFloat64
+
+    const uint32 SIGNAL_NAME_SIZE = 32;
+    uint32 headerSize = sizeof(uint32) + N_OF_SIGNALS * (sizeof(uint16) + SIGNAL_NAME_SIZE + sizeof(uint32));
+    uint32 memorySize = headerSize + (windowCycles * cycleWriteSize);
+    char8 *expectedFileContent = static_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(memorySize));
+
+    uint32 n;
+    //Header
+    char8 *header = &expectedFileContent[0];
+    MemoryOperationsHelper::Copy(header, reinterpret_cast<const char8 *>(&N_OF_SIGNALS), sizeof(uint32));
+    header += sizeof(uint32);
+    for (n = 0u; n < N_OF_SIGNALS; n++) {
+        MemoryOperationsHelper::Copy(header, &signalTypes[n], sizeof(uint16));
+        header += sizeof(uint16);
+        MemoryOperationsHelper::Set(header, '\0', SIGNAL_NAME_SIZE);
+        MemoryOperationsHelper::Copy(header, signalNames[n], StringHelper::Length(signalNames[n]));
+        header += SIGNAL_NAME_SIZE;
+        MemoryOperationsHelper::Copy(header, &signalElements[n], sizeof(uint32));
+        header += sizeof(uint32);
+    }
+
+    for (n = firstCycle; n < (firstCycle + windowCycles); n++) {
+        uint8 *triggerPointer = reinterpret_cast<uint8 *>(&expectedFileContent[headerSize + ((n - firstCycle) * cycleWriteSize)]);
+        uint32 *timerPointer = reinterpret_cast<uint32 *>(triggerPointer + 1);
+        uint8 *signalUInt8Pointer = reinterpret_cast<uint8 *>(timerPointer + 1);
+        uint16 *signalUInt16Pointer = reinterpret_cast<uint16 *>(signalUInt8Pointer + 1);
+        uint32 *signalUInt32Pointer = reinterpret_cast<uint32 *>(signalUInt16Pointer + 1);
+        uint64 *signalUInt64Pointer = reinterpret_cast<uint64 *>(signalUInt32Pointer + 1);
+        int8 *signalInt8Pointer = reinterpret_cast<int8 *>(signalUInt64Pointer + 1);
+        int16 *signalInt16Pointer = reinterpret_cast<int16 *>(signalInt8Pointer + 1);
+        int32 *signalInt32Pointer = reinterpret_cast<int32 *>(signalInt16Pointer + 1);
+        int64 *signalInt64Pointer = reinterpret_cast<int64 *>(signalInt32Pointer + 1);
+        float32 *signalFloat32Pointer = reinterpret_cast<float32 *>(signalInt64Pointer + 1);
+        float64 *signalFloat64Pointer = reinterpret_cast<float64 *>(signalFloat32Pointer + 1);
+
+        *triggerPointer = triggerToGenerate[n];
+        *timerPointer = static_cast<uint32>(period * 1e6) * n;
+        *signalUInt8Pointer = signalToGenerate[n];
+        *signalUInt16Pointer = signalToGenerate[n];
+        *signalUInt32Pointer = signalToGenerate[n];
+        *signalUInt64Pointer = signalToGenerate[n];
+        int32 multiplier = -1;
+        if ((n % 2) == 0) {
+            multiplier = 1;
+        }
+        *signalInt8Pointer = multiplier * signalToGenerate[n];
+        *signalInt16Pointer = multiplier * signalToGenerate[n];
+        *signalInt32Pointer = multiplier * signalToGenerate[n];
+        *signalInt64Pointer = static_cast<int64>(multiplier) * signalToGenerate[n];
+        *signalFloat32Pointer = static_cast<float32>(multiplier) * signalToGenerate[n];
+        *signalFloat64Pointer = static_cast<float64>(multiplier) * signalToGenerate[n];
+    }
+
+    bool ok = TestIntegratedExecution(config1, signalToGenerate, numberOfElements, triggerToGenerate, 1u, numberOfBuffers, numberOfPreTriggers,
+                                      numberOfPostTriggers, period, filename, expectedFileContent, false, 100, 0u, NULL, 0u, NULL, flightRecorderCycles,
+                                      ringFilename);
+    GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(expectedFileContent));
+    return ok;
+}
+
 bool FileWriterTest::TestOpenFile() {
     using namespace MARTe;
     bool ok = TestIntegratedInApplication(config5, false);
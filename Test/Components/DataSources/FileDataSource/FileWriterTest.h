@@ -76,6 +76,11 @@ public:
      */
     bool TestGetBrokerName_MemoryMapAsyncTriggerOutputBroker();
 
+    /**
+     * @brief Tests that the GetBrokerName method correctly returns a MemoryMapSynchronisedOutputBroker if FlightRecorderCycles > 0.
+     */
+    bool TestGetBrokerName_MemoryMapSynchronisedOutputBroker();
+
     /**
      * @brief Tests the GetInputBrokers method.
      */
@@ -91,6 +96,21 @@ public:
      */
     bool TestSynchronise();
 
+    /**
+     * @brief Tests the Synchronise method with the binary cycles written in batches by the I/O thread.
+     */
+    bool TestSynchronise_Batch();
+
+    /**
+     * @brief Tests the Synchronise method with the binary cycles written in batches by the I/O thread with IOBackend = io_uring.
+     */
+    bool TestSynchronise_Batch_IOUring();
+
+    /**
+     * @brief Tests the Synchronise method with FlightRecorderCycles > 0 (anonymous ring and FlightRecorderFile).
+     */
+    bool TestSynchronise_FlightRecorder();
+
     /**
      * @brief Tests the PrepareNextState method.
      */
@@ -111,6 +131,81 @@ public:
      */
     bool TestInitialise_False_Overwrite();
 
+    /**
+     * @brief Tests the Initialise method with the BatchCycles, NumberOfBatchBuffers and DirectIO parameters.
+     */
+    bool TestInitialise_Batch();
+
+    /**
+     * @brief Tests the Initialise method with the FlightRecorderCycles and FlightRecorderFile parameters.
+     */
+    bool TestInitialise_FlightRecorder();
+
+    /**
+     * @brief Tests that the Initialise method fails if FlightRecorderCycles is set with StoreOnTrigger = 1.
+     */
+    bool TestInitialise_False_FlightRecorder_StoreOnTrigger();
+
+    /**
+     * @brief Tests that the Initialise method fails if the trigger window does not fit in the FlightRecorderCycles.
+     */
+    bool TestInitialise_False_FlightRecorder_Window();
+
+    /**
+     * @brief Tests that the Initialise method fails if BatchCycles is set with the csv FileFormat.
+     */
+    bool TestInitialise_False_BatchCycles_CSV();
+
+    /**
+     * @brief Tests that the Initialise method fails if NumberOfBatchBuffers is zero.
+     */
+    bool TestInitialise_False_NumberOfBatchBuffers();
+
+    /**
+     * @brief Tests that the Initialise method fails if the IOBackend is not pwrite or io_uring.
+     */
+    bool TestInitialise_False_IOBackend();
+
+    /**
+     * @brief Tests the Initialise method with and without the Compression parameter.
+     */
+    bool TestInitialise_Compression();
+
+    /**
+     * @brief Tests that the Initialise method fails if the Compression is invalid or is set without BatchCycles or with DirectIO.
+     */
+    bool TestInitialise_False_Compression();
+
+    /**
+     * @brief Tests the Initialise method with and without the Layout parameter.
+     */
+    bool TestInitialise_Layout();
+
+    /**
+     * @brief Tests that the Initialise method fails if the Layout is invalid or is set to columnar without BatchCycles or with io_uring.
+     */
+    bool TestInitialise_False_Layout();
+
+    /**
+     * @brief Tests the Initialise method with and without the CSVFloatFormat parameter.
+     */
+    bool TestInitialise_CSVFloatFormat();
+
+    /**
+     * @brief Tests that the Initialise method fails if the CSVFloatFormat is not fixed or shortest.
+     */
+    bool TestInitialise_False_CSVFloatFormat();
+
+    /**
+     * @brief Tests the Initialise method with the RotateSize and RotatePeriod parameters.
+     */
+    bool TestInitialise_Rotate();
+
+    /**
+     * @brief Tests that the Initialise method fails if RotateSize is set with BatchCycles = 0.
+     */
+    bool TestInitialise_False_Rotate_NoBatchCycles();
+
     /**
      * @brief Tests the Initialise method specifying an invalid overwrite parameter.
      */
@@ -126,6 +221,11 @@ public:
      */
     bool TestInitialise_False_NumberOfBuffers_GT_0();
 
+    /**
+     * @brief Tests the Initialise method with a HeapName which is not registered in the HeapManager.
+     */
+    bool TestInitialise_False_HeapName();
+
     /**
      * @brief Tests the Initialise method without specifying the CPU mask.
      */
@@ -224,7 +324,7 @@ public:
     /**
      * @brief Tests the FileWriter integrated in an application which continuously stores data.
      */
-    bool TestIntegratedInApplication_NoTrigger(const MARTe::char8 *filename, bool csv = true, MARTe::uint8 refreshContent = 0u, MARTe::uint32* detectedFileSize = 0);
+    bool TestIntegratedInApplication_NoTrigger(const MARTe::char8 *filename, bool csv = true, MARTe::uint8 refreshContent = 0u, MARTe::uint32* detectedFileSize = 0, MARTe::uint32 batchCycles = 0u, const MARTe::char8 *ioBackend = NULL);
 
     /**
      * @brief Tests the FileWriter integrated in an application which continuously stores data.
@@ -241,6 +341,11 @@ public:
      */
     bool TestIntegratedInApplication_Trigger(const MARTe::char8 *filename, bool csv = true);
 
+    /**
+     * @brief Tests the FileWriter integrated in an application which stores the window of a trigger from the flight recorder ring.
+     */
+    bool TestIntegratedInApplication_FlightRecorder(const MARTe::char8 *filename, const MARTe::char8 *ringFilename = NULL);
+
     /**
      * @brief Tests the GetCPUMask method.
      */
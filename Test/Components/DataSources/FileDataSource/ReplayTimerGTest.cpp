@@ -0,0 +1,121 @@
+/**
+ * @file ReplayTimerGTest.cpp
+ * @brief Source file for class ReplayTimerGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ReplayTimerGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "gtest/gtest.h"
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ReplayTimerTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(ReplayTimerGTest,TestConstructor) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(ReplayTimerGTest,TestInitialise) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(ReplayTimerGTest,TestInitialise_False_No_Filename) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_No_Filename());
+}
+
+TEST(ReplayTimerGTest,TestInitialise_False_Missing_File) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Missing_File());
+}
+
+TEST(ReplayTimerGTest,TestInitialise_False_No_TimeSignal) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_No_TimeSignal());
+}
+
+TEST(ReplayTimerGTest,TestInitialise_False_TimeUnit) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_TimeUnit());
+}
+
+TEST(ReplayTimerGTest,TestInitialise_False_Acceleration) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Acceleration());
+}
+
+TEST(ReplayTimerGTest,TestInitialise_False_EOF) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_EOF());
+}
+
+TEST(ReplayTimerGTest,TestSetConfiguredDatabase) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase());
+}
+
+TEST(ReplayTimerGTest,TestSetConfiguredDatabase_False_TimeSignal) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_TimeSignal());
+}
+
+TEST(ReplayTimerGTest,TestSetConfiguredDatabase_False_Truncated) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_Truncated());
+}
+
+TEST(ReplayTimerGTest,TestGetBrokerName) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestGetBrokerName());
+}
+
+TEST(ReplayTimerGTest,TestSynchronise) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestSynchronise());
+}
+
+TEST(ReplayTimerGTest,TestSynchronise_Acceleration) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestSynchronise_Acceleration());
+}
+
+TEST(ReplayTimerGTest,TestSynchronise_Rewind) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestSynchronise_Rewind());
+}
+
+TEST(ReplayTimerGTest,TestSynchronise_Error) {
+    ReplayTimerTest test;
+    ASSERT_TRUE(test.TestSynchronise_Error());
+}
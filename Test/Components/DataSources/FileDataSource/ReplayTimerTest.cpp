@@ -0,0 +1,568 @@
+/**
+ * @file ReplayTimerTest.cpp
+ * @brief Source file for class ReplayTimerTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ReplayTimerTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Directory.h"
+#include "File.h"
+#include "GAM.h"
+#include "GAMSchedulerI.h"
+#include "HighResolutionTimer.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "ReplayTimerTest.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * The recording used by the tests.
+ */
+static const MARTe::char8 * const REPLAY_TIMER_TEST_FILE = "ReplayTimerTest.bin";
+
+/**
+ * Number of cycles of the recording.
+ */
+static const MARTe::uint32 REPLAY_TIMER_TEST_CYCLES = 5u;
+
+/**
+ * Recorded period in microseconds.
+ */
+static const MARTe::uint32 REPLAY_TIMER_TEST_PERIOD = 10000u;
+
+/**
+ * @brief Stores the Counter and Value signals replayed in each cycle.
+ */
+class ReplayTimerTestGAM: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    ReplayTimerTestGAM() :
+            MARTe::GAM() {
+        counter = 0u;
+        value = 0.F;
+    }
+
+    bool Setup() {
+        return (GetNumberOfInputSignals() == 2u);
+    }
+
+    bool Execute() {
+        using namespace MARTe;
+        counter = *reinterpret_cast<uint32 *>(GetInputSignalMemory(0u));
+        value = *reinterpret_cast<float32 *>(GetInputSignalMemory(1u));
+        return MemoryOperationsHelper::Copy(GetOutputSignalsMemory(), &counter, 4u);
+    }
+
+    MARTe::uint32 counter;
+
+    MARTe::float32 value;
+};
+
+CLASS_REGISTER(ReplayTimerTestGAM, "1.0")
+
+/**
+ * @brief Manual scheduler to test the correct interface between the ReplayTimer and the GAMs
+ */
+class ReplayTimerSchedulerTestHelper: public MARTe::GAMSchedulerI {
+public:
+
+    CLASS_REGISTER_DECLARATION()
+
+    ReplayTimerSchedulerTestHelper() :
+            MARTe::GAMSchedulerI() {
+        scheduledStates = NULL;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StartNextStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StopCurrentStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    bool ExecuteThreadCycle(MARTe::uint32 threadId) {
+        using namespace MARTe;
+        ReferenceT<RealTimeApplication> realTimeAppT = realTimeApp;
+        return ExecuteSingleCycle(scheduledStates[realTimeAppT->GetIndex()]->threads[threadId].executables,
+                                  scheduledStates[realTimeAppT->GetIndex()]->threads[threadId].numberOfExecutables);
+    }
+
+    virtual bool ConfigureScheduler(MARTe::Reference realTimeApp) {
+
+        bool ret = GAMSchedulerI::ConfigureScheduler(realTimeApp);
+        if (ret) {
+            scheduledStates = GetSchedulableStates();
+        }
+        return ret;
+    }
+
+    virtual void CustomPrepareNextState() {
+    }
+
+private:
+
+    MARTe::ScheduledState * const * scheduledStates;
+};
+
+CLASS_REGISTER(ReplayTimerSchedulerTestHelper, "1.0")
+
+/**
+ * @brief Writes a recording (as the FileWriter binary format) with a Counter, a Time (10 ms period, in microseconds) and a Value signal.
+ */
+static void GenerateRecording(const MARTe::uint32 extraBytes = 0u) {
+    using namespace MARTe;
+    const uint32 N_OF_SIGNALS = 3u;
+    const char8 *signalNames[N_OF_SIGNALS] = { "Counter", "Time", "Value" };
+    const TypeDescriptor signalTypes[N_OF_SIGNALS] = { UnsignedInteger32Bit, UnsignedInteger32Bit, Float32Bit };
+    const uint32 SIGNAL_NAME_SIZE = 32u;
+    File f;
+    if (f.Open(REPLAY_TIMER_TEST_FILE, BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT)) {
+        uint32 writeSize = sizeof(uint32);
+        f.Write(reinterpret_cast<const char8 *>(&N_OF_SIGNALS), writeSize);
+        for (uint32 n = 0u; n < N_OF_SIGNALS; n++) {
+            writeSize = sizeof(uint16);
+            f.Write(reinterpret_cast<const char8 *>(&signalTypes[n].all), writeSize);
+            char8 signalName32[SIGNAL_NAME_SIZE];
+            MemoryOperationsHelper::Set(&signalName32[0], '\0', SIGNAL_NAME_SIZE);
+            MemoryOperationsHelper::Copy(&signalName32[0], signalNames[n], StringHelper::Length(signalNames[n]));
+            writeSize = SIGNAL_NAME_SIZE;
+            f.Write(&signalName32[0], writeSize);
+            uint32 nOfElements = 1u;
+            writeSize = sizeof(uint32);
+            f.Write(reinterpret_cast<const char8 *>(&nOfElements), writeSize);
+        }
+        for (uint32 c = 0u; c < REPLAY_TIMER_TEST_CYCLES; c++) {
+            uint32 time = c * REPLAY_TIMER_TEST_PERIOD;
+            float32 value = static_cast<float32>(c) * 1.5F;
+            writeSize = sizeof(uint32);
+            f.Write(reinterpret_cast<const char8 *>(&c), writeSize);
+            writeSize = sizeof(uint32);
+            f.Write(reinterpret_cast<const char8 *>(&time), writeSize);
+            writeSize = sizeof(float32);
+            f.Write(reinterpret_cast<const char8 *>(&value), writeSize);
+        }
+        if (extraBytes > 0u) {
+            const char8 extra[4] = { 0, 0, 0, 0 };
+            writeSize = extraBytes;
+            f.Write(&extra[0], writeSize);
+        }
+        f.Flush();
+        f.Close();
+    }
+}
+
+static void DeleteRecording() {
+    using namespace MARTe;
+    Directory toDelete(REPLAY_TIMER_TEST_FILE);
+    toDelete.Delete();
+}
+
+/**
+ * @brief Builds an application where a ReplayTimer (with the given parameters) drives the only thread.
+ */
+static void BuildConfig(MARTe::StreamString &config,
+                        const MARTe::char8 * const replayParameters) {
+    config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMReplay = {"
+            "            Class = ReplayTimerTestGAM"
+            "            InputSignals = {"
+            "                Counter = {"
+            "                    DataSource = Replay"
+            "                    Type = uint32"
+            "                }"
+            "                Value = {"
+            "                    DataSource = Replay"
+            "                    Type = float32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                Counter = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Replay = {"
+            "            Class = ReplayTimer"
+            "            Filename = \"ReplayTimerTest.bin\"";
+    config += replayParameters;
+    config += ""
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMReplay}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = ReplayTimerSchedulerTestHelper"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+}
+
+/**
+ * @brief Configures the application and executes numberOfCycles cycles, verifying the Counter of each cycle against expectedCounters.
+ * @param[in] lastCycleFails if true the last cycle is expected to fail.
+ * @param[out] elapsedMSec the time taken by the cycles.
+ */
+static bool TestReplayExecution(const MARTe::char8 * const replayParameters,
+                                const MARTe::uint32 numberOfCycles,
+                                const MARTe::uint32 * const expectedCounters,
+                                const bool lastCycleFails,
+                                MARTe::float64 &elapsedMSec) {
+    using namespace MARTe;
+    GenerateRecording();
+    StreamString config;
+    BuildConfig(config, replayParameters);
+    ConfigurationDatabase cdb;
+    config.Seek(0LLU);
+    StandardParser parser(config, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    ReferenceT<ReplayTimerSchedulerTestHelper> scheduler;
+    ReferenceT<ReplayTimerTestGAM> gam;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        scheduler = application->Find("Scheduler");
+        gam = application->Find("Functions.GAMReplay");
+        ok = (scheduler.IsValid()) && (gam.IsValid());
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    uint64 start = HighResolutionTimer::Counter();
+    for (uint32 i = 0u; (i < numberOfCycles) && (ok); i++) {
+        bool cycleOk = scheduler->ExecuteThreadCycle(0u);
+        if ((lastCycleFails) && (i == (numberOfCycles - 1u))) {
+            ok = !cycleOk;
+        }
+        else {
+            ok = (cycleOk) && (gam->counter == expectedCounters[i]);
+            if (ok) {
+                ok = (gam->value == (static_cast<float32>(expectedCounters[i]) * 1.5F));
+            }
+        }
+    }
+    elapsedMSec = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period() * 1e3;
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    god->Purge();
+    DeleteRecording();
+    return ok;
+}
+
+/**
+ * @brief Configures the application (without executing it).
+ */
+static bool TestConfigureApplication(const MARTe::char8 * const replayParameters) {
+    using namespace MARTe;
+    StreamString config;
+    BuildConfig(config, replayParameters);
+    ConfigurationDatabase cdb;
+    config.Seek(0LLU);
+    StandardParser parser(config, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    god->Purge();
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool ReplayTimerTest::TestConstructor() {
+    using namespace MARTe;
+    ReplayTimer test;
+    bool ok = (test.GetFilename() == "");
+    ok &= (test.GetTimeSignal() == "");
+    ok &= (test.GetTimeUnit() == 1e-6);
+    ok &= (test.GetAcceleration() == 1.0);
+    ok &= (test.GetSpinMargin() == 50u);
+    ok &= (test.IsRewind());
+    ok &= (!test.IsLockMemory());
+    ok &= (test.GetNumberOfFileCycles() == 0u);
+    ok &= (test.GetNumberOfCycles() == 0u);
+    ok &= (test.GetOverruns() == 0u);
+    ok &= (test.GetMaxLateness() == 0u);
+    return ok;
+}
+
+bool ReplayTimerTest::TestInitialise() {
+    using namespace MARTe;
+    GenerateRecording();
+    ReplayTimer test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Filename", REPLAY_TIMER_TEST_FILE);
+    cdb.Write("TimeSignal", "Time");
+    cdb.Write("TimeUnit", 1e-3);
+    cdb.Write("Acceleration", 2.0);
+    cdb.Write("SpinMargin", 20);
+    cdb.Write("EOF", "Error");
+    cdb.Write("LockMemory", 1);
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetFilename() == REPLAY_TIMER_TEST_FILE);
+    ok &= (test.GetTimeSignal() == "Time");
+    ok &= (test.GetTimeUnit() == 1e-3);
+    ok &= (test.GetAcceleration() == 2.0);
+    ok &= (test.GetSpinMargin() == 20u);
+    ok &= (!test.IsRewind());
+    ok &= (test.IsLockMemory());
+    DeleteRecording();
+    return ok;
+}
+
+bool ReplayTimerTest::TestInitialise_False_No_Filename() {
+    using namespace MARTe;
+    ReplayTimer test;
+    ConfigurationDatabase cdb;
+    cdb.Write("TimeSignal", "Time");
+    return !test.Initialise(cdb);
+}
+
+bool ReplayTimerTest::TestInitialise_False_Missing_File() {
+    using namespace MARTe;
+    ReplayTimer test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Filename", "ReplayTimerTestMissing.bin");
+    cdb.Write("TimeSignal", "Time");
+    return !test.Initialise(cdb);
+}
+
+bool ReplayTimerTest::TestInitialise_False_No_TimeSignal() {
+    using namespace MARTe;
+    GenerateRecording();
+    ReplayTimer test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Filename", REPLAY_TIMER_TEST_FILE);
+    bool ok = !test.Initialise(cdb);
+    DeleteRecording();
+    return ok;
+}
+
+bool ReplayTimerTest::TestInitialise_False_TimeUnit() {
+    using namespace MARTe;
+    GenerateRecording();
+    ReplayTimer test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Filename", REPLAY_TIMER_TEST_FILE);
+    cdb.Write("TimeSignal", "Time");
+    cdb.Write("TimeUnit", 0.0);
+    bool ok = !test.Initialise(cdb);
+    DeleteRecording();
+    return ok;
+}
+
+bool ReplayTimerTest::TestInitialise_False_Acceleration() {
+    using namespace MARTe;
+    GenerateRecording();
+    ReplayTimer test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Filename", REPLAY_TIMER_TEST_FILE);
+    cdb.Write("TimeSignal", "Time");
+    cdb.Write("Acceleration", -1.0);
+    bool ok = !test.Initialise(cdb);
+    DeleteRecording();
+    return ok;
+}
+
+bool ReplayTimerTest::TestInitialise_False_EOF() {
+    using namespace MARTe;
+    GenerateRecording();
+    ReplayTimer test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Filename", REPLAY_TIMER_TEST_FILE);
+    cdb.Write("TimeSignal", "Time");
+    cdb.Write("EOF", "Last");
+    bool ok = !test.Initialise(cdb);
+    DeleteRecording();
+    return ok;
+}
+
+bool ReplayTimerTest::TestSetConfiguredDatabase() {
+    using namespace MARTe;
+    GenerateRecording();
+    StreamString config;
+    BuildConfig(config, "TimeSignal = Time Acceleration = 2.0");
+    ConfigurationDatabase cdb;
+    config.Seek(0LLU);
+    StandardParser parser(config, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    ReferenceT<ReplayTimer> replay;
+    if (ok) {
+        replay = application->Find("Data.Replay");
+        ok = replay.IsValid();
+    }
+    if (ok) {
+        ok = (replay->GetNumberOfFileCycles() == REPLAY_TIMER_TEST_CYCLES);
+    }
+    //10 ms recorded period replayed twice as fast
+    for (uint32 c = 0u; (c < REPLAY_TIMER_TEST_CYCLES) && (ok); c++) {
+        ok = (replay->GetDeadline(c) == (static_cast<uint64>(c) * 5000000u));
+    }
+    if (ok) {
+        ok = (replay->GetDeadline(REPLAY_TIMER_TEST_CYCLES) == 0u);
+    }
+    god->Purge();
+    DeleteRecording();
+    return ok;
+}
+
+bool ReplayTimerTest::TestSetConfiguredDatabase_False_TimeSignal() {
+    GenerateRecording();
+    bool ok = !TestConfigureApplication("TimeSignal = Missing");
+    DeleteRecording();
+    return ok;
+}
+
+bool ReplayTimerTest::TestSetConfiguredDatabase_False_Truncated() {
+    GenerateRecording(3u);
+    bool ok = !TestConfigureApplication("TimeSignal = Time");
+    DeleteRecording();
+    return ok;
+}
+
+bool ReplayTimerTest::TestGetBrokerName() {
+    using namespace MARTe;
+    ReplayTimer test;
+    ConfigurationDatabase cdb;
+    bool ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "MemoryMapSynchronisedInputBroker") == 0);
+    if (ok) {
+        ok = (test.GetBrokerName(cdb, OutputSignals) == NULL_PTR(const char8 *));
+    }
+    return ok;
+}
+
+bool ReplayTimerTest::TestSynchronise() {
+    using namespace MARTe;
+    const uint32 expectedCounters[] = { 0u, 1u, 2u, 3u, 4u };
+    float64 elapsedMSec = 0.0;
+    bool ok = TestReplayExecution("TimeSignal = Time", 5u, &expectedCounters[0], false, elapsedMSec);
+    //The first cycle is due immediately and the next four 10 ms apart
+    if (ok) {
+        ok = (elapsedMSec >= 39.0);
+    }
+    return ok;
+}
+
+bool ReplayTimerTest::TestSynchronise_Acceleration() {
+    using namespace MARTe;
+    const uint32 expectedCounters[] = { 0u, 1u, 2u, 3u, 4u };
+    float64 elapsedMSec = 0.0;
+    bool ok = TestReplayExecution("TimeSignal = Time Acceleration = 4.0", 5u, &expectedCounters[0], false, elapsedMSec);
+    if (ok) {
+        ok = (elapsedMSec >= 9.0) && (elapsedMSec < 39.0);
+    }
+    return ok;
+}
+
+bool ReplayTimerTest::TestSynchronise_Rewind() {
+    using namespace MARTe;
+    const uint32 expectedCounters[] = { 0u, 1u, 2u, 3u, 4u, 0u, 1u };
+    float64 elapsedMSec = 0.0;
+    bool ok = TestReplayExecution("TimeSignal = Time Acceleration = 10.0 EOF = Rewind", 7u, &expectedCounters[0], false, elapsedMSec);
+    //After the last cycle the replay waits one mean period (1 ms) before the first cycle
+    if (ok) {
+        ok = (elapsedMSec >= 5.0);
+    }
+    return ok;
+}
+
+bool ReplayTimerTest::TestSynchronise_Error() {
+    using namespace MARTe;
+    const uint32 expectedCounters[] = { 0u, 1u, 2u, 3u, 4u, 0u };
+    float64 elapsedMSec = 0.0;
+    return TestReplayExecution("TimeSignal = Time Acceleration = 0 EOF = Error", 6u, &expectedCounters[0], true, elapsedMSec);
+}
@@ -0,0 +1,129 @@
+/**
+ * @file ReplayTimerTest.h
+ * @brief Header file for class ReplayTimerTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ReplayTimerTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FILEDATASOURCE_REPLAYTIMERTEST_H_
+#define FILEDATASOURCE_REPLAYTIMERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ReplayTimer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the ReplayTimer public methods.
+ */
+class ReplayTimerTest {
+public:
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method with all the parameters.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails without Filename.
+     */
+    bool TestInitialise_False_No_Filename();
+
+    /**
+     * @brief Tests that the Initialise method fails with a file which does not exist.
+     */
+    bool TestInitialise_False_Missing_File();
+
+    /**
+     * @brief Tests that the Initialise method fails without TimeSignal.
+     */
+    bool TestInitialise_False_No_TimeSignal();
+
+    /**
+     * @brief Tests that the Initialise method fails with TimeUnit = 0.
+     */
+    bool TestInitialise_False_TimeUnit();
+
+    /**
+     * @brief Tests that the Initialise method fails with a negative Acceleration.
+     */
+    bool TestInitialise_False_Acceleration();
+
+    /**
+     * @brief Tests that the Initialise method fails with an unsupported EOF.
+     */
+    bool TestInitialise_False_EOF();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method (number of cycles and deadlines).
+     */
+    bool TestSetConfiguredDatabase();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails with a TimeSignal which is not recorded.
+     */
+    bool TestSetConfiguredDatabase_False_TimeSignal();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails with a file truncated in the middle of a cycle.
+     */
+    bool TestSetConfiguredDatabase_False_Truncated();
+
+    /**
+     * @brief Tests the GetBrokerName method.
+     */
+    bool TestGetBrokerName();
+
+    /**
+     * @brief Tests that the Synchronise method replays the cycles on the recorded timestamps.
+     */
+    bool TestSynchronise();
+
+    /**
+     * @brief Tests that the Synchronise method replays the cycles faster with Acceleration > 1.
+     */
+    bool TestSynchronise_Acceleration();
+
+    /**
+     * @brief Tests that the Synchronise method restarts from the first cycle with EOF = "Rewind".
+     */
+    bool TestSynchronise_Rewind();
+
+    /**
+     * @brief Tests that the Synchronise method fails after the last cycle with EOF = "Error".
+     */
+    bool TestSynchronise_Error();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FILEDATASOURCE_REPLAYTIMERTEST_H_ */
@@ -55,6 +55,11 @@ TEST(LinkDataSourceGTest,TestInitialise_FalseNoIsWriter) {
     ASSERT_TRUE(test.TestInitialise_FalseNoIsWriter());
 }
 
+TEST(LinkDataSourceGTest,TestInitialise_False_ZeroCopyWriter) {
+    LinkDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_ZeroCopyWriter());
+}
+
 TEST(LinkDataSourceGTest,TestInitialise_FalseNoLink) {
     LinkDataSourceTest test;
     ASSERT_TRUE(test.TestInitialise_FalseNoLink());
@@ -85,6 +90,11 @@ TEST(LinkDataSourceGTest,TestSynchronise) {
     ASSERT_TRUE(test.TestSynchronise());
 }
 
+TEST(LinkDataSourceGTest,TestSynchronise_ZeroCopy) {
+    LinkDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise_ZeroCopy());
+}
+
 TEST(LinkDataSourceGTest,TestGetBrokerName) {
     LinkDataSourceTest test;
     ASSERT_TRUE(test.TestGetBrokerName());
@@ -449,6 +449,153 @@ bool LinkDataSourceTest::TestInitialise_FalseNoIsWriter() {
     return ok;
 }
 
+bool LinkDataSourceTest::TestInitialise_False_ZeroCopyWriter() {
+
+    const char8 *config = ""
+            "+ExternalComponent1 = {"
+            "    Class = MemoryGate"
+            "    NumberOfBuffers = 2"
+            "}"
+            "+ExternalComponent2 = {"
+            "    Class = MemoryGate"
+            "    NumberOfBuffers = 2"
+            "}"
+            "$Application1 = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "             Class = IOGAM"
+            "             InputSignals = {"
+            "                 InputA = {"
+            "                     DataSource = InputGAM1"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 OutputA = {"
+            "                     DataSource = OutputGAM1"
+            "                     Type = uint32"
+            "                     Trigger = 1"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +InputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent2"
+            "            IsWriter = 0"
+            "        }"
+            "        +OutputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent1"
+            "            IsWriter = 1"
+            "            ZeroCopy = 1"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}"
+            "$Application2 = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "             Class = IOGAM"
+            "             InputSignals = {"
+            "                 InputA = {"
+            "                     DataSource = InputGAM1"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 OutputB = {"
+            "                     DataSource = OutputGAM1"
+            "                     Type = uint32"
+            "                     Trigger = 1"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +InputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent1"
+            "            IsWriter = 0"
+            "        }"
+            "        +OutputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent2"
+            "            IsWriter = 1"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = !god->Initialise(cdb);
+    }
+
+    return ok;
+}
+
 bool LinkDataSourceTest::TestInitialise_FalseNoLink() {
 
     const char8 *config = ""
@@ -1289,3 +1436,213 @@ bool LinkDataSourceTest::TestSynchronise() {
     return ret;
 }
 
+bool LinkDataSourceTest::TestSynchronise_ZeroCopy() {
+
+    const char8 *config = ""
+            "+ExternalComponent1 = {"
+            "    Class = MemoryGate"
+            "    NumberOfBuffers = 2"
+            "}"
+            "+ExternalComponent2 = {"
+            "    Class = MemoryGate"
+            "    NumberOfReaders = 2"
+            "}"
+            "$Application1 = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "             Class = IOGAM"
+            "             InputSignals = {"
+            "                 InputA = {"
+            "                     DataSource = InputGAM1"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 OutputA = {"
+            "                     DataSource = OutputGAM1"
+            "                     Type = uint32"
+            "                     Trigger = 1"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +InputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent2"
+            "            IsWriter = 0"
+            "            ZeroCopy = 1"
+            "        }"
+            "        +OutputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent1"
+            "            IsWriter = 1"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}"
+            "$Application2 = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "             Class = IOGAM"
+            "             InputSignals = {"
+            "                 InputA = {"
+            "                     DataSource = InputGAM1"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 OutputB = {"
+            "                     DataSource = OutputGAM1"
+            "                     Type = uint32"
+            "                     Trigger = 1"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +InputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent1"
+            "            IsWriter = 0"
+            "            ZeroCopy = 1"
+            "        }"
+            "        +OutputGAM1 = {"
+            "            Class = LinkDataSourceTestDS"
+            "            Link = ExternalComponent2"
+            "            IsWriter = 1"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<LinkDataSourceTestDS> ds1;
+    ReferenceT<LinkDataSourceTestDS> ds2;
+
+    if (ret) {
+        ds1 = god->Find("Application1.Data.InputGAM1");
+        ret = ds1.IsValid();
+    }
+
+    if (ret) {
+        ds2 = god->Find("Application1.Data.OutputGAM1");
+        ret = ds2.IsValid();
+    }
+
+    uint32 offset = 0u;
+    if (ret) {
+        //Nothing held before the first Synchronise
+        ret = !ds1->GetInputOffset(0u, 1u, offset);
+    }
+
+    uint8 *data1 = NULL;
+    if (ret) {
+        ret = ds1->GetSignalMemoryBuffer(0, 0, (void*&) data1);
+    }
+    if (ret) {
+        //The signal is read directly from the MemoryGate
+        ret = (data1 == ds1->GetLink()->GetMemory());
+    }
+
+    uint32 *data2 = NULL;
+    if (ret) {
+        ret = ds2->GetSignalMemoryBuffer(0, 0, (void*&) data2);
+    }
+
+    ReferenceT<LinkDataSourceTestDS> ds4;
+    if (ret) {
+        ds4 = god->Find("Application2.Data.OutputGAM1");
+        ret = ds4.IsValid();
+    }
+    uint32 *data4 = NULL;
+    if (ret) {
+        ret = ds4->GetSignalMemoryBuffer(0, 0, (void*&) data4);
+    }
+
+    if (ret) {
+        *data4 = 2;
+        ret &= ds4->Synchronise();
+    }
+    if (ret) {
+        ret = ds1->Synchronise();
+    }
+    if (ret) {
+        ret = ds1->GetInputOffset(0u, 1u, offset);
+    }
+    if (ret) {
+        ret = (*reinterpret_cast<uint32 *>(&data1[offset]) == 2u);
+    }
+    if (ret) {
+        //The held buffer is not overwritten by the following writes
+        uint32 heldOffset = offset;
+        *data4 = 3;
+        ret &= ds4->Synchronise();
+        *data4 = 4;
+        ret &= ds4->Synchronise();
+        ret &= (*reinterpret_cast<uint32 *>(&data1[heldOffset]) == 2u);
+    }
+    if (ret) {
+        ret = ds1->Synchronise();
+    }
+    if (ret) {
+        ret = ds1->GetInputOffset(0u, 1u, offset);
+    }
+    if (ret) {
+        ret = (*reinterpret_cast<uint32 *>(&data1[offset]) == 4u);
+    }
+
+    return ret;
+}
+
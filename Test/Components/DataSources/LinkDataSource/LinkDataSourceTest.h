@@ -70,6 +70,12 @@ public:
      */
     bool TestInitialise_FalseNoIsWriter();
 
+    /**
+     * @brief Tests the LinkDataSource::Initialise() method that fails if
+     * ZeroCopy is set on a writer
+     */
+    bool TestInitialise_False_ZeroCopyWriter();
+
     /**
      * @brief Tests the LinkDataSource::Initialise() method that fails if
      * Link is not defined
@@ -103,6 +109,11 @@ public:
      */
     bool TestSynchronise();
 
+    /**
+     * @brief Tests the LinkDataSource::Synchronise() method in ZeroCopy mode
+     */
+    bool TestSynchronise_ZeroCopy();
+
     /**
      * @brief Tests the LinkDataSource::GetBrokerName() method
      */
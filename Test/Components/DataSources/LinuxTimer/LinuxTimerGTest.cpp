@@ -101,6 +101,16 @@ TEST(LinuxTimerGTest, TestExecute_Busy_SleepPercentage) {
     ASSERT_TRUE(test.TestExecute_Busy_SleepPercentage());
 }
 
+TEST(LinuxTimerGTest, TestExecute_Deadline) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestExecute_Deadline());
+}
+
+TEST(LinuxTimerGTest, TestExecute_MasterSlave) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestExecute_MasterSlave());
+}
+
 TEST(LinuxTimerGTest, TestExecute_RTThread) {
     LinuxTimerTest test;
     ASSERT_TRUE(test.TestExecute_RTThread());
@@ -126,6 +136,16 @@ TEST(LinuxTimerGTest, TestExecute_RePhase) {
     ASSERT_TRUE(test.TestExecute_RePhase());
 }
 
+TEST(LinuxTimerGTest, TestExecute_Telemetry) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestExecute_Telemetry());
+}
+
+TEST(LinuxTimerGTest, TestGetTelemetry_False_NoStructuredData) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestGetTelemetry_False_NoStructuredData());
+}
+
 TEST(LinuxTimerGTest, TestExecute_StateChange) {
     LinuxTimerTest test;
     ASSERT_TRUE(test.TestExecute_StateChange());
@@ -165,11 +185,21 @@ TEST(LinuxTimerGTest, TestInitialise_Busy_SleepPercentage_gt_100) {
     LinuxTimerTest test;
     ASSERT_TRUE(test.TestInitialise_Busy_SleepPercentage_gt_100());
 }
+
+TEST(LinuxTimerGTest, TestInitialise_Deadline) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_Deadline());
+}
 TEST(LinuxTimerGTest, TestInitialise_CPUMask) {
     LinuxTimerTest test;
     ASSERT_TRUE(test.TestInitialise_CPUMask());
 }
 
+TEST(LinuxTimerGTest, TestInitialise_ThreadPlacement) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_ThreadPlacement());
+}
+
 TEST(LinuxTimerGTest, TestInitialise_StackSize) {
     LinuxTimerTest test;
     ASSERT_TRUE(test.TestInitialise_StackSize());
@@ -195,6 +225,21 @@ TEST(LinuxTimerGTest, TestInitialise_False_StackSize) {
     ASSERT_TRUE(test.TestInitialise_False_StackSize());
 }
 
+TEST(LinuxTimerGTest, TestInitialise_False_ThreadPlacement) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_ThreadPlacement());
+}
+
+TEST(LinuxTimerGTest, TestInitialise_False_LatencyHistogramBinWidth) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_LatencyHistogramBinWidth());
+}
+
+TEST(LinuxTimerGTest, TestInitialise_False_MasterPhase) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_MasterPhase());
+}
+
 TEST(LinuxTimerGTest, TestGetStackSize) {
     LinuxTimerTest test;
     ASSERT_TRUE(test.TestGetStackSize());
@@ -235,6 +280,16 @@ TEST(LinuxTimerGTest, TestSetConfiguredDatabase_False_InvalidSignal4) {
     ASSERT_TRUE(test.TestSetConfiguredDatabase_False_InvalidSignal4());
 }
 
+TEST(LinuxTimerGTest, TestSetConfiguredDatabase_False_InvalidTelemetrySignal) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_InvalidTelemetrySignal());
+}
+
+TEST(LinuxTimerGTest, TestSetConfiguredDatabase_False_InvalidMaster) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_InvalidMaster());
+}
+
 TEST(LinuxTimerGTest, TestSetConfiguredDatabase_False_NoFrequencySet) {
     LinuxTimerTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase_False_NoFrequencySet());
@@ -343,6 +343,365 @@ const MARTe::char8 *const config21 = ""
         "    }"
         "}";
 
+const MARTe::char8 *const config22 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                    Frequency = 1000"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            SleepNature = Deadline"
+        "            SpinMargin = 100"
+        "            AdaptiveSpinMargin = 1"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+const MARTe::char8 *const config23 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                    Frequency = 1000"
+        "                }"
+        "                AbsTime = {"
+        "                   DataSource = Timer"
+        "                   Type = uint64"
+        "                }"
+        "                DeltaTime = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "                RephaseTrigger = {"
+        "                    DataSource = Timer"
+        "                    Type = uint8"
+        "                }"
+        "                Lateness = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Overruns = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                MissedCycles = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                MaxLateness = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            ExecutionMode = RealTimeThread"
+        "            LatencyHistogramBins = 10"
+        "            LatencyHistogramBinWidth = 100000"
+        "            DumpTelemetry = 1"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+const MARTe::char8 *const config24 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                    Frequency = 1000"
+        "                }"
+        "                AbsTime = {"
+        "                   DataSource = Timer"
+        "                   Type = uint64"
+        "                }"
+        "                DeltaTime = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "                RephaseTrigger = {"
+        "                    DataSource = Timer"
+        "                    Type = uint8"
+        "                }"
+        "                Lateness = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Overruns = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                MissedCycles = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                MaxLateness = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            ExecutionMode = RealTimeThread"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+const MARTe::char8 *const config25 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                    Frequency = 1000"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer2"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer2"
+        "                    Type = uint32"
+        "                    Frequency = 500"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            ExecutionMode = IndependentThread"
+        "        }"
+        "        +Timer2 = {"
+        "            Class = LinuxTimer"
+        "            Master = \"Test.Data.Timer\""
+        "            MasterDivider = 2"
+        "            MasterPhase = 1"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+const MARTe::char8 *const config26 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                    Frequency = 1000"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer2"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer2"
+        "                    Type = uint32"
+        "                    Frequency = 500"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            ExecutionMode = IndependentThread"
+        "        }"
+        "        +Timer2 = {"
+        "            Class = LinuxTimer"
+        "            Master = \"Test.Data.Timings\""
+        "            MasterDivider = 2"
+        "            MasterPhase = 1"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 const MARTe::char8 *const config3 = ""
         "$Test = {"
         "    Class = RealTimeApplication"
@@ -1599,7 +1958,7 @@ bool LinuxTimerTest::TestGetSignalMemoryBuffer_False() {
     using namespace MARTe;
     LinuxTimer test;
     uint32 *ptr;
-    return !test.GetSignalMemoryBuffer(5, 0, (void*&) ptr);
+    return !test.GetSignalMemoryBuffer(9, 0, (void*&) ptr);
 }
 
 bool LinuxTimerTest::TestGetBrokerName() {
@@ -1648,6 +2007,10 @@ bool LinuxTimerTest::TestExecute_Busy_SleepPercentage() {
     return TestIntegratedInApplication(config21);
 }
 
+bool LinuxTimerTest::TestExecute_Deadline() {
+    return TestIntegratedInApplication(config22);
+}
+
 bool LinuxTimerTest::TestExecute_RTThread() {
     return TestIntegratedInApplication(config11);
 }
@@ -1660,6 +2023,188 @@ bool LinuxTimerTest::TestExecute_RTThread_WithPhase() {
     return TestIntegratedInApplication(config15);
 }
 
+bool LinuxTimerTest::TestExecute_Telemetry() {
+    using namespace MARTe;
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config23;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    ReferenceT<LinuxTimer> linuxTimer;
+    if (ok) {
+        linuxTimer = application->Find("Data.Timer");
+        ok = linuxTimer.IsValid();
+    }
+    if (ok) {
+        uint32 *counter;
+        linuxTimer->GetSignalMemoryBuffer(0, 0, (void*&) counter);
+        uint32 c = 0;
+        while ((c < 500) && ((*counter) <= 100)) {
+            Sleep::MSec(10);
+            c++;
+        }
+        ok = ((*counter) > 100);
+    }
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    ReferenceT<ConfigurationDatabase> telemetry(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    if (ok) {
+        ReferenceContainer message;
+        ok = message.Insert(telemetry);
+        if (ok) {
+            ok = linuxTimer->GetTelemetry(message).ErrorsCleared();
+        }
+    }
+    uint32 numberOfCycles = 0u;
+    if (ok) {
+        ok = telemetry->Read("NumberOfCycles", numberOfCycles);
+    }
+    if (ok) {
+        ok = (numberOfCycles > 100u);
+    }
+    uint32 maxLateness = 0u;
+    if (ok) {
+        ok = telemetry->Read("MaxLateness", maxLateness);
+    }
+    uint32 *lateness = NULL_PTR(uint32 *);
+    uint32 *maxLatenessSignal = NULL_PTR(uint32 *);
+    if (ok) {
+        ok = linuxTimer->GetSignalMemoryBuffer(5, 0, (void*&) lateness);
+    }
+    if (ok) {
+        ok = linuxTimer->GetSignalMemoryBuffer(8, 0, (void*&) maxLatenessSignal);
+    }
+    if (ok) {
+        ok = (*maxLatenessSignal == maxLateness) && (*lateness <= maxLateness);
+    }
+    if (ok) {
+        ok = (linuxTimer->GetLatencyHistogramBins() == 10u);
+    }
+    if (ok) {
+        uint32 histogram[10];
+        Vector<uint32> histogramVector(&histogram[0], 10u);
+        ok = telemetry->Read("LatencyHistogram", histogramVector);
+        uint32 total = 0u;
+        for (uint32 i = 0u; (i < 10u) && (ok); i++) {
+            ok = (histogram[i] == linuxTimer->GetLatencyHistogramCount(i));
+            total += histogram[i];
+        }
+        if (ok) {
+            ok = (total == numberOfCycles);
+        }
+    }
+    if (ok) {
+        ok = (linuxTimer->GetLatencyHistogramCount(10u) == 0u);
+    }
+    if (ok) {
+        ok = linuxTimer->PrintTelemetry().ErrorsCleared();
+    }
+    if (ok) {
+        ok = linuxTimer->ResetTelemetry().ErrorsCleared();
+    }
+    god->Purge();
+    return ok;
+}
+
+bool LinuxTimerTest::TestExecute_MasterSlave() {
+    using namespace MARTe;
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config25;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    ReferenceT<LinuxTimer> linuxTimer;
+    ReferenceT<LinuxTimer> linuxTimerSlave;
+    if (ok) {
+        linuxTimer = application->Find("Data.Timer");
+        linuxTimerSlave = application->Find("Data.Timer2");
+        ok = (linuxTimer.IsValid() && linuxTimerSlave.IsValid());
+    }
+    if (ok) {
+        ok = (linuxTimer->GetNumberOfSlaves() == 1u) && (linuxTimerSlave->GetNumberOfSlaves() == 0u);
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    uint32 *counter = NULL_PTR(uint32 *);
+    uint32 *counterSlave = NULL_PTR(uint32 *);
+    if (ok) {
+        ok = linuxTimer->GetSignalMemoryBuffer(0, 0, (void*&) counter);
+    }
+    if (ok) {
+        ok = linuxTimerSlave->GetSignalMemoryBuffer(0, 0, (void*&) counterSlave);
+    }
+    if (ok) {
+        uint32 c = 0;
+        while ((c < 500) && ((*counterSlave) <= 100)) {
+            Sleep::MSec(10);
+            c++;
+        }
+        ok = ((*counterSlave) > 100);
+    }
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    if (ok) {
+        //The slave fires on every other master cycle
+        uint32 expected = (*counter) / 2u;
+        ok = ((*counterSlave) <= (expected + 1u)) && (((*counterSlave) + 5u) >= expected);
+    }
+    god->Purge();
+    return ok;
+}
+
+bool LinuxTimerTest::TestGetTelemetry_False_NoStructuredData() {
+    using namespace MARTe;
+    LinuxTimer test;
+    ReferenceContainer message;
+    return !test.GetTelemetry(message).ErrorsCleared();
+}
+
 bool LinuxTimerTest::TestExecute_Phase() {
     using namespace MARTe;
 
@@ -2320,6 +2865,35 @@ bool LinuxTimerTest::TestInitialise_Busy_SleepPercentage_gt_100() {
     return ok;
 }
 
+bool LinuxTimerTest::TestInitialise_Deadline() {
+    using namespace MARTe;
+    LinuxTimer test;
+    ConfigurationDatabase cdb;
+    cdb.Write("SleepNature", "Deadline");
+    cdb.Write("SpinMargin", "100");
+    cdb.Write("AdaptiveSpinMargin", "0");
+    return test.Initialise(cdb);
+}
+
+bool LinuxTimerTest::TestInitialise_False_LatencyHistogramBinWidth() {
+    using namespace MARTe;
+    LinuxTimer test;
+    ConfigurationDatabase cdb;
+    cdb.Write("LatencyHistogramBins", 10);
+    cdb.Write("LatencyHistogramBinWidth", 0);
+    return !test.Initialise(cdb);
+}
+
+bool LinuxTimerTest::TestInitialise_False_MasterPhase() {
+    using namespace MARTe;
+    LinuxTimer test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Master", "Test.Data.Timer");
+    cdb.Write("MasterDivider", 2);
+    cdb.Write("MasterPhase", 2);
+    return !test.Initialise(cdb);
+}
+
 bool LinuxTimerTest::TestInitialise_CPUMask() {
     using namespace MARTe;
     LinuxTimer test;
@@ -2333,6 +2907,35 @@ bool LinuxTimerTest::TestInitialise_CPUMask() {
     return ok;
 }
 
+bool LinuxTimerTest::TestInitialise_ThreadPlacement() {
+    using namespace MARTe;
+    LinuxTimer test;
+    ConfigurationDatabase cdb;
+    uint32 cpuMask = 0x5;
+    cdb.Write("CPUMask", cpuMask);
+    bool ok = cdb.CreateRelative("ThreadPlacement");
+    if (ok) {
+        uint32 cpus = 0x3;
+        ok = cdb.Write("CPUs", cpus);
+    }
+    if (ok) {
+        ok = cdb.Write("PriorityClass", "RealTimePriorityClass");
+    }
+    if (ok) {
+        ok = cdb.Write("PriorityLevel", 15);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = test.Initialise(cdb);
+    }
+    if (ok) {
+        ok = (test.GetCPUMask() == 0x3u);
+    }
+    return ok;
+}
+
 bool LinuxTimerTest::TestInitialise_StackSize() {
     using namespace MARTe;
     LinuxTimer test;
@@ -2378,6 +2981,23 @@ bool LinuxTimerTest::TestInitialise_False_StackSize() {
     return !test.Initialise(cdb);
 }
 
+bool LinuxTimerTest::TestInitialise_False_ThreadPlacement() {
+    using namespace MARTe;
+    LinuxTimer test;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.CreateRelative("ThreadPlacement");
+    if (ok) {
+        ok = cdb.Write("PriorityClass", "False");
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = !test.Initialise(cdb);
+    }
+    return ok;
+}
+
 bool LinuxTimerTest::TestSetConfiguredDatabase() {
     return TestIntegratedInApplication(config3);
 }
@@ -2410,6 +3030,14 @@ bool LinuxTimerTest::TestSetConfiguredDatabase_False_InvalidSignal5() {
     return !TestIntegratedInApplication(config19);
 }
 
+bool LinuxTimerTest::TestSetConfiguredDatabase_False_InvalidTelemetrySignal() {
+    return !TestIntegratedInApplication(config24);
+}
+
+bool LinuxTimerTest::TestSetConfiguredDatabase_False_InvalidMaster() {
+    return !TestIntegratedInApplication(config26);
+}
+
 bool LinuxTimerTest::TestSetConfiguredDatabase_False_NoFrequencySet() {
     return !TestIntegratedInApplication(config7);
 }
@@ -101,6 +101,16 @@ public:
      */
     bool TestExecute_Busy_SleepPercentage();
 
+    /**
+     * @brief Tests the Execute method with Deadline sleep.
+     */
+    bool TestExecute_Deadline();
+
+    /**
+     * @brief Tests the Execute method of a master LinuxTimer waking a slave LinuxTimer every other cycle.
+     */
+    bool TestExecute_MasterSlave();
+
     /**
      * @brief Tests the Execute method in the context of the real-time thread.
      */
@@ -126,6 +136,16 @@ public:
      */
     bool TestExecute_RePhase();
 
+    /**
+     * @brief Tests the Execute method with the telemetry signals and the latency histogram.
+     */
+    bool TestExecute_Telemetry();
+
+    /**
+     * @brief Tests that the GetTelemetry method fails if the message does not contain a StructuredDataI.
+     */
+    bool TestGetTelemetry_False_NoStructuredData();
+
     /**
      * @brief Tests the Execute method with state change
      */
@@ -161,11 +181,21 @@ public:
      */
     bool TestInitialise_Busy_SleepPercentage_gt_100();
 
+    /**
+     * @brief Tests the Initialise method  with a Deadline SleepNature and specifying the SpinMargin.
+     */
+    bool TestInitialise_Deadline();
+
     /**
      * @brief Tests the Initialise method  with a CPUMask.
      */
     bool TestInitialise_CPUMask();
 
+    /**
+     * @brief Tests the Initialise method with a ThreadPlacement block.
+     */
+    bool TestInitialise_ThreadPlacement();
+
     /**
      * @brief Tests the Initialise method  with a StackSize.
      */
@@ -186,6 +216,21 @@ public:
      */
     bool TestInitialise_False_StackSize();
 
+    /**
+     * @brief Tests the Initialise method with an invalid ThreadPlacement PriorityClass.
+     */
+    bool TestInitialise_False_ThreadPlacement();
+
+    /**
+     * @brief Tests the Initialise method with LatencyHistogramBinWidth = 0.
+     */
+    bool TestInitialise_False_LatencyHistogramBinWidth();
+
+    /**
+     * @brief Tests the Initialise method with MasterPhase >= MasterDivider.
+     */
+    bool TestInitialise_False_MasterPhase();
+
     /**
      * @brief Tests the Initialise method by explicitly specifying the Time Provider class
      */
@@ -241,6 +286,16 @@ public:
      */
     bool TestSetConfiguredDatabase_False_InvalidSignal5();
 
+    /**
+     * @brief Tests the SetConfiguredDatabase method with a telemetry signal which is not a uint32.
+     */
+    bool TestSetConfiguredDatabase_False_InvalidTelemetrySignal();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method with a Master which is not a LinuxTimer.
+     */
+    bool TestSetConfiguredDatabase_False_InvalidMaster();
+
     /**
      * @brief Tests the SetConfiguredDatabase method specifying with a first signal that is not (Un)SignedInteged.
      */
@@ -0,0 +1,108 @@
+/**
+ * @file TscTimeProviderGTest.cpp
+ * @brief Source file for class TscTimeProviderGTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class TscTimeProviderGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "gtest/gtest.h"
+#include <limits.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "TscTimeProviderTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(TscTimeProviderGTest,TestConstructor) {
+    TscTimeProviderTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(TscTimeProviderGTest,TestCounter) {
+    TscTimeProviderTest test;
+    ASSERT_TRUE(test.TestCounter());
+}
+
+TEST(TscTimeProviderGTest,TestPeriod) {
+    TscTimeProviderTest test;
+    ASSERT_TRUE(test.TestPeriod());
+}
+
+TEST(TscTimeProviderGTest,TestFrequency) {
+    TscTimeProviderTest test;
+    ASSERT_TRUE(test.TestFrequency());
+}
+
+TEST(TscTimeProviderGTest,TestSleep) {
+    TscTimeProviderTest test;
+    ASSERT_TRUE(test.TestSleep());
+}
+
+TEST(TscTimeProviderGTest,TestInitialise_Auto) {
+    TscTimeProviderTest test;
+    ASSERT_TRUE(test.TestInitialise_Auto());
+}
+
+TEST(TscTimeProviderGTest,TestInitialise_Clock) {
+    TscTimeProviderTest test;
+    ASSERT_TRUE(test.TestInitialise_Clock());
+}
+
+TEST(TscTimeProviderGTest,TestInitialise_False_Source) {
+    TscTimeProviderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Source());
+}
+
+TEST(TscTimeProviderGTest,TestInitialise_False_CalibrationTime) {
+    TscTimeProviderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_CalibrationTime());
+}
+
+TEST(TscTimeProviderGTest,TestInitialise_False_SleepNature) {
+    TscTimeProviderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_SleepNature());
+}
+
+TEST(TscTimeProviderGTest,TestCounter_Monotonic) {
+    TscTimeProviderTest test;
+    ASSERT_TRUE(test.TestCounter_Monotonic());
+}
+
+TEST(TscTimeProviderGTest,TestSleep_Deadline) {
+    TscTimeProviderTest test;
+    ASSERT_TRUE(test.TestSleep_Deadline());
+}
+
+TEST(TscTimeProviderGTest,TestBackwardCompatibilityInit) {
+    TscTimeProviderTest test;
+    ASSERT_TRUE(test.TestBackwardCompatibilityInit());
+}
+
@@ -0,0 +1,174 @@
+/**
+ * @file TscTimeProviderTest.cpp
+ * @brief Source file for class TscTimeProviderTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class TscTimeProviderTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <time.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "TscTimeProvider.h"
+#include "TscTimeProviderTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+static MARTe::uint64 TscTimeProviderTestMonotonicNs() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (static_cast<MARTe::uint64>(now.tv_sec) * 1000000000ull) + static_cast<MARTe::uint64>(now.tv_nsec);
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+TscTimeProviderTest::TscTimeProviderTest() : TimeProviderTest(){
+    timeProvider = new TscTimeProvider();
+    ConfigurationDatabase cdb;
+    if (!timeProvider->Initialise(cdb)) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not initialise the TscTimeProvider");
+    }
+}
+
+TscTimeProviderTest::~TscTimeProviderTest() {
+}
+
+bool TscTimeProviderTest::TestInitialise_Auto() {
+    TscTimeProvider test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Source", "Auto");
+    cdb.Write("CalibrationTime", 10);
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (test.IsTscUsed()) ? (test.GetTscFrequency() > 0u) : (test.GetTscFrequency() == 0u);
+    }
+    if (ok) {
+        ok = (test.Frequency() == 1000000000u);
+    }
+    return ok;
+}
+
+bool TscTimeProviderTest::TestInitialise_Clock() {
+    TscTimeProvider test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Source", "Clock");
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = !test.IsTscUsed();
+    }
+    if (ok) {
+        uint64 before = TscTimeProviderTestMonotonicNs();
+        uint64 counter = test.Counter();
+        uint64 after = TscTimeProviderTestMonotonicNs();
+        ok = (before <= counter) && (counter <= after);
+    }
+    return ok;
+}
+
+bool TscTimeProviderTest::TestInitialise_False_Source() {
+    TscTimeProvider test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Source", "Invalid");
+    return !test.Initialise(cdb);
+}
+
+bool TscTimeProviderTest::TestInitialise_False_CalibrationTime() {
+    TscTimeProvider test;
+    ConfigurationDatabase cdb;
+    cdb.Write("CalibrationTime", 0);
+    return !test.Initialise(cdb);
+}
+
+bool TscTimeProviderTest::TestInitialise_False_SleepNature() {
+    TscTimeProvider test;
+    ConfigurationDatabase cdb;
+    cdb.Write("SleepNature", "Invalid");
+    return !test.Initialise(cdb);
+}
+
+bool TscTimeProviderTest::TestCounter_Monotonic() {
+    bool ok = (timeProvider != NULL);
+    uint64 last = 0u;
+    for (uint32 i = 0u; (i < 100000u) && (ok); i++) {
+        uint64 counter = timeProvider->Counter();
+        ok = (counter >= last);
+        last = counter;
+    }
+    if (ok) {
+        //Tolerance of 1 ms to the CLOCK_MONOTONIC to allow for the preemption between the two reads
+        uint64 monotonic = TscTimeProviderTestMonotonicNs();
+        uint64 counter = timeProvider->Counter();
+        uint64 difference = (counter > monotonic) ? (counter - monotonic) : (monotonic - counter);
+        ok = (difference < 1000000u);
+    }
+    return ok;
+}
+
+bool TscTimeProviderTest::TestSleep_Deadline() {
+    TscTimeProvider test;
+    ConfigurationDatabase cdb;
+    cdb.Write("SleepNature", "Deadline");
+    cdb.Write("SpinMargin", 100);
+    bool ok = test.Initialise(cdb);
+    for (uint32 i = 0u; (i < 10u) && (ok); i++) {
+        uint64 startTime = test.Counter();
+        uint64 deltaTime = 1000000u;
+        ok = test.Sleep(startTime, deltaTime);
+        if (ok) {
+            ok = ((test.Counter() - startTime) >= deltaTime);
+        }
+    }
+    return ok;
+}
+
+bool TscTimeProviderTest::TestBackwardCompatibilityInit() {
+    TscTimeProvider test;
+    ConfigurationDatabase cdb;
+    cdb.Write("SleepNature", "Busy");
+    cdb.Write("SleepPercentage", 50);
+    bool ok = test.BackwardCompatibilityInit(cdb);
+    if (ok) {
+        uint64 startTime = test.Counter();
+        uint64 deltaTime = 1000000u;
+        ok = test.Sleep(startTime, deltaTime);
+        if (ok) {
+            ok = ((test.Counter() - startTime) >= deltaTime);
+        }
+    }
+    if (ok) {
+        ConfigurationDatabase cdbInvalid;
+        cdbInvalid.Write("SleepNature", "Invalid");
+        ok = !test.BackwardCompatibilityInit(cdbInvalid);
+    }
+    return ok;
+}
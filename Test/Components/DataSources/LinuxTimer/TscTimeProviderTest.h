@@ -0,0 +1,93 @@
+/**
+ * @file TscTimeProviderTest.h
+ * @brief Header file for class TscTimeProviderTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class TscTimeProviderTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LINUXTIMERTEST_TSCTIMEPROVIDERTEST_H_
+#define LINUXTIMERTEST_TSCTIMEPROVIDERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "TimeProviderTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Tests the TscTimeProvider methods (including the common TimeProvider tests).
+ */
+class TscTimeProviderTest : public TimeProviderTest {
+    public:
+        TscTimeProviderTest();
+        ~TscTimeProviderTest();
+
+        /**
+         * @brief Tests the Initialise method with Source = Auto.
+         */
+        bool TestInitialise_Auto();
+
+        /**
+         * @brief Tests the Initialise method with Source = Clock.
+         */
+        bool TestInitialise_Clock();
+
+        /**
+         * @brief Tests that the Initialise method fails with an invalid Source.
+         */
+        bool TestInitialise_False_Source();
+
+        /**
+         * @brief Tests that the Initialise method fails with CalibrationTime = 0.
+         */
+        bool TestInitialise_False_CalibrationTime();
+
+        /**
+         * @brief Tests that the Initialise method fails with an invalid SleepNature.
+         */
+        bool TestInitialise_False_SleepNature();
+
+        /**
+         * @brief Tests that the Counter is monotonic and close to CLOCK_MONOTONIC.
+         */
+        bool TestCounter_Monotonic();
+
+        /**
+         * @brief Tests the Sleep method with SleepNature = Deadline.
+         */
+        bool TestSleep_Deadline();
+
+        /**
+         * @brief Tests the BackwardCompatibilityInit method.
+         */
+        bool TestBackwardCompatibilityInit();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LINUXTIMERTEST_TSCTIMEPROVIDERTEST_H_ */
@@ -56,6 +56,16 @@ TEST(LoggerBrokerGTest,TestExecute) {
     ASSERT_TRUE(test.TestExecute());
 }
 
+TEST(LoggerBrokerGTest,TestExecute_Deferred) {
+    LoggerBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_Deferred());
+}
+
+TEST(LoggerBrokerGTest,TestExecute_Deferred_Overflow) {
+    LoggerBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_Deferred_Overflow());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -35,9 +35,11 @@
 #include "GAM.h"
 #include "LoggerBroker.h"
 #include "LoggerBrokerTest.h"
+#include "LoggerDataSource.h"
 #include "MemoryOperationsHelper.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
+#include "Sleep.h"
 #include "StandardParser.h"
 
 /*---------------------------------------------------------------------------*/
@@ -157,6 +159,113 @@ void LoggerBrokerTestScheduler::CustomPrepareNextState() {
 
 CLASS_REGISTER(LoggerBrokerTestScheduler, "1.0")
 
+/**
+ * Application with a deferred LoggerDataSource. The RingSize and FlushPeriod are written by each test.
+ */
+static const MARTe::char8 * const deferredConfig = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LoggerBrokerTestGAM"
+        "            OutputSignals = {"
+        "                Signal1 = {"
+        "                    DataSource = LoggerDS"
+        "                    Type = uint32"
+        "                }"
+        "                Signal5 = {"
+        "                    DataSource = LoggerDS"
+        "                    Type = uint32"
+        "                    NumberOfElements = 2"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +LoggerDS = {"
+        "            Class = LoggerDataSource"
+        "            Deferred = 1"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = LoggerBrokerTestScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+static bool LoggerBrokerTestConfigureDeferred(const MARTe::uint32 ringSize,
+                                              const MARTe::uint32 flushPeriod,
+                                              MARTe::ReferenceT<LoggerBrokerTestScheduler> &scheduler,
+                                              MARTe::ReferenceT<MARTe::LoggerDataSource> &loggerDS) {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = deferredConfig;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Data.+LoggerDS");
+    }
+    if (ok) {
+        ok = cdb.Write("RingSize", ringSize);
+    }
+    if (ok) {
+        ok = cdb.Write("FlushPeriod", flushPeriod);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        scheduler = application->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        loggerDS = application->Find("Data.LoggerDS");
+        ok = loggerDS.IsValid();
+    }
+    if (ok) {
+        scheduler->PrepareNextState("", "State1");
+        ok = loggerDS->PrepareNextState("", "State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution().ErrorsCleared();
+    }
+    return ok;
+}
+
 static MARTe::StreamString lastError;
 void LoggerBrokerTestErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo,
                                           const char * const errorDescription) {
@@ -293,3 +402,51 @@ bool LoggerBrokerTest::TestInit() {
 bool LoggerBrokerTest::TestExecute() {
     return TestInit();
 }
+
+bool LoggerBrokerTest::TestExecute_Deferred() {
+    using namespace MARTe;
+    ReferenceT<LoggerBrokerTestScheduler> scheduler;
+    ReferenceT<LoggerDataSource> loggerDS;
+    bool ok = LoggerBrokerTestConfigureDeferred(4u, 10u, scheduler, loggerDS);
+    if (ok) {
+        lastError = "";
+        ErrorManagement::ErrorProcessFunctionType currentErrorMessageProcessFunction = MARTe::ErrorManagement::errorMessageProcessFunction;
+
+        SetErrorProcessFunction(&LoggerBrokerTestErrorProcessFunction);
+
+        scheduler->ExecuteThreadCycle(0);
+        //Give time to the background thread to flush the ring
+        Sleep::MSec(500u);
+
+        SetErrorProcessFunction(currentErrorMessageProcessFunction);
+    }
+    if (ok) {
+        ok = (loggerDS->GetOverflowCount() == 0u);
+    }
+    if (ok) {
+        ok = (loggerDS->GetRateLimitedCount() == 0u);
+    }
+    REPORT_ERROR_STATIC(ErrorManagement::Information, lastError.Buffer());
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (ok) {
+        ok = (lastError == "Signal1 [0:0]:1 Signal5 [0:1]:{ 1 2 } ");
+    }
+    return ok;
+}
+
+bool LoggerBrokerTest::TestExecute_Deferred_Overflow() {
+    using namespace MARTe;
+    ReferenceT<LoggerBrokerTestScheduler> scheduler;
+    ReferenceT<LoggerDataSource> loggerDS;
+    //The background thread waits one second before the first flush
+    bool ok = LoggerBrokerTestConfigureDeferred(2u, 1000u, scheduler, loggerDS);
+    if (ok) {
+        uint32 n;
+        for (n = 0u; n < 5u; n++) {
+            scheduler->ExecuteThreadCycle(0);
+        }
+        ok = (loggerDS->GetOverflowCount() == 3u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
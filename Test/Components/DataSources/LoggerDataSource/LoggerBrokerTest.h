@@ -55,6 +55,16 @@ public:
      * @brief Tests the Execute method.
      */
     bool TestExecute();
+
+    /**
+     * @brief Tests that in deferred mode the signals are printed by the background thread.
+     */
+    bool TestExecute_Deferred();
+
+    /**
+     * @brief Tests that in deferred mode the records which do not fit in the ring are discarded and counted.
+     */
+    bool TestExecute_Deferred_Overflow();
 };
 
 
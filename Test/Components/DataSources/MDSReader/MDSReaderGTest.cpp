@@ -81,6 +81,26 @@ TEST(MDSReaderGTest, TestInitialise) {
     ASSERT_TRUE(test.TestInitialise());
 }
 
+TEST(MDSReaderGTest, TestInitialiseReadAheadSegments) {
+    MDSReaderTest test;
+    ASSERT_TRUE(test.TestInitialiseReadAheadSegments());
+}
+
+TEST(MDSReaderGTest, TestInitialiseInvalidStackSize) {
+    MDSReaderTest test;
+    ASSERT_TRUE(test.TestInitialiseInvalidStackSize());
+}
+
+TEST(MDSReaderGTest, TestInitialiseServer) {
+    MDSReaderTest test;
+    ASSERT_TRUE(test.TestInitialiseServer());
+}
+
+TEST(MDSReaderGTest, TestInitialiseServerNoReadAheadSegments) {
+    MDSReaderTest test;
+    ASSERT_TRUE(test.TestInitialiseServerNoReadAheadSegments());
+}
+
 TEST(MDSReaderGTest, TestSetConfiguredDatabaseNoSignals) {
     MDSReaderTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabaseNoSignals());
@@ -630,6 +650,16 @@ TEST(MDSReaderGTest, TestSynchronise67) {
     ASSERT_TRUE(test.TestSynchronise67());
 }
 
+TEST(MDSReaderGTest, TestSynchroniseReadAhead) {
+    MDSReaderTest test;
+    ASSERT_TRUE(test.TestSynchroniseReadAhead());
+}
+
+TEST(MDSReaderGTest, TestSynchroniseReadAheadInterpolation) {
+    MDSReaderTest test;
+    ASSERT_TRUE(test.TestSynchroniseReadAheadInterpolation());
+}
+
 
 
 /*---------------------------------------------------------------------------*/
@@ -35,6 +35,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "MDSReaderTest.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -1530,6 +1531,78 @@ bool MDSReaderTest::TestInitialise() {
     return ok;
 }
 
+bool MDSReaderTest::TestInitialiseReadAheadSegments() {
+    bool ok;
+    MDSReader dS;
+    ConfigurationDatabase config;
+    config.Write("TreeName", treeName.Buffer());
+    config.Write("ShotNumber", 1);
+    config.Write("Frequency", 1);
+    config.Write("ReadAheadSegments", 4);
+    config.Write("CPUMask", 2);
+    config.Write("StackSize", 100000);
+    config.CreateRelative("Signals");
+    config.MoveToRoot();
+    ok = dS.Initialise(config);
+    if (ok) {
+        ok = (dS.GetReadAheadSegments() == 4u);
+    }
+    if (ok) {
+        ok = (dS.GetCPUMask() == 2u);
+    }
+    if (ok) {
+        ok = (dS.GetStackSize() == 100000u);
+    }
+    return ok;
+}
+
+bool MDSReaderTest::TestInitialiseInvalidStackSize() {
+    bool ok;
+    MDSReader dS;
+    ConfigurationDatabase config;
+    config.Write("TreeName", treeName.Buffer());
+    config.Write("ShotNumber", 1);
+    config.Write("Frequency", 1);
+    config.Write("ReadAheadSegments", 4);
+    config.Write("StackSize", 0);
+    config.CreateRelative("Signals");
+    config.MoveToRoot();
+    ok = !dS.Initialise(config);
+    return ok;
+}
+
+bool MDSReaderTest::TestInitialiseServer() {
+    bool ok;
+    MDSReader dS;
+    ConfigurationDatabase config;
+    config.Write("TreeName", treeName.Buffer());
+    config.Write("ShotNumber", 1);
+    config.Write("Frequency", 1);
+    config.Write("ReadAheadSegments", 4);
+    config.Write("Server", "localhost:8000");
+    config.CreateRelative("Signals");
+    config.MoveToRoot();
+    ok = dS.Initialise(config);
+    if (ok) {
+        ok = (StringHelper::Compare(dS.GetServer(), "localhost:8000") == 0);
+    }
+    return ok;
+}
+
+bool MDSReaderTest::TestInitialiseServerNoReadAheadSegments() {
+    bool ok;
+    MDSReader dS;
+    ConfigurationDatabase config;
+    config.Write("TreeName", treeName.Buffer());
+    config.Write("ShotNumber", 1);
+    config.Write("Frequency", 1);
+    config.Write("Server", "localhost:8000");
+    config.CreateRelative("Signals");
+    config.MoveToRoot();
+    ok = !dS.Initialise(config);
+    return ok;
+}
+
 bool MDSReaderTest::TestSetConfiguredDatabaseNoSignals() {
     bool ok;
     MDSReader dS;
@@ -8456,3 +8529,86 @@ bool MDSReaderTest::TestSynchronise67() {
     delete[] ptr;
     return ok;
 }
+
+bool MDSReaderTest::TestSynchroniseReadAhead() {
+    MDSReaderTestHelper dS(treeName);
+    bool ok;
+    ok = dS.CreateConfigurationFile();
+    if (ok) {
+        ok = dS.config.MoveToRoot();
+    }
+    if (ok) {
+        ok = dS.config.Write("ReadAheadSegments", 2);
+    }
+    if (ok) {
+        ok = dS.Initialise(dS.config);
+    }
+    if (ok) {
+        ok = dS.SetConfiguredDatabase(dS.config);
+    }
+    void **ptr = new void *[numberOfValidNodes];
+    for (uint32 i = 0u; (i < numberOfValidNodes) && ok; i++) {
+        ok = dS.GetSignalMemoryBuffer(i, 0, ptr[i]);
+    }
+    if (ok) {
+        for (uint32 i = 0u; (i < 20) && ok; i++) {
+            ok = dS.Synchronise();
+            if (ok) {
+                ok &= dS.CompareS_uint8(((uint8 *) ptr[0]), i, 1, dS.elementsRead);
+                ok &= dS.CompareS_int8(((int8 *) ptr[1]), i, 1, dS.elementsRead);
+                ok &= dS.CompareS_uint16(((uint16 *) ptr[2]), i, 2, dS.elementsRead);
+                ok &= dS.CompareS_int16(((int16 *) ptr[3]), i, 2, dS.elementsRead);
+                ok &= dS.CompareS_uint32(((uint32 *) ptr[4]), i, 4, dS.elementsRead);
+                ok &= dS.CompareS_int32(((int32 *) ptr[5]), i, 4, dS.elementsRead);
+                ok &= dS.CompareS_uint64(((uint64 *) ptr[6]), i, 8, dS.elementsRead);
+                ok &= dS.CompareS_int64(((int64 *) ptr[7]), i, 8, dS.elementsRead);
+                ok &= dS.CompareS_float32(((float32 *) ptr[8]), i, 0.1, dS.elementsRead);
+                ok &= dS.CompareS_float64(((float64 *) ptr[9]), i, 0.1, dS.elementsRead);
+            }
+        }
+    }
+    if (ok) {
+        ok = ((dS.GetCacheHits() + dS.GetCacheMisses()) > 0u);
+    }
+    delete[] ptr;
+    return ok;
+}
+
+bool MDSReaderTest::TestSynchroniseReadAheadInterpolation() {
+    MDSReaderTestHelper dS(treeName);
+    dS.elementsRead = 40;
+    bool ok;
+    ok = dS.CreateConfigurationFile(0.02, 1, 0, 1);
+    if (ok) {
+        ok = dS.config.MoveToRoot();
+    }
+    if (ok) {
+        ok = dS.config.Write("ReadAheadSegments", 4);
+    }
+    if (ok) {
+        ok = dS.Initialise(dS.config);
+    }
+    if (ok) {
+        ok = dS.SetConfiguredDatabase(dS.config);
+    }
+    void **ptr = new void *[numberOfValidNodes];
+    for (uint32 i = 0u; (i < numberOfValidNodes) && ok; i++) {
+        ok = dS.GetSignalMemoryBuffer(i, 0, ptr[i]);
+    }
+    uint32 elementsToCompare = 40;
+    for (uint32 i = 0u; (i < 249) && ok; i++) {
+        ok = dS.Synchronise();
+        if (ok) {
+            ok &= dS.CompareS_uint16(((uint16 *) ptr[2]), i, 0.4, elementsToCompare);
+            ok &= dS.CompareS_int16(((int16 *) ptr[3]), i, 2.0 / 5, elementsToCompare);
+            ok &= dS.CompareS_uint32(((uint32 *) ptr[4]), i, 4.0 / 5, elementsToCompare);
+            ok &= dS.CompareS_int32(((int32 *) ptr[5]), i, 4.0 / 5, elementsToCompare);
+            ok &= dS.CompareS_uint64(((uint64 *) ptr[6]), i, 8.0 / 5, elementsToCompare);
+            ok &= dS.CompareS_int64(((int64 *) ptr[7]), i, 8.0 / 5, elementsToCompare);
+            ok &= dS.CompareS_float32(((float32 *) ptr[8]), i, 0.02, elementsToCompare);
+            ok &= dS.CompareS_float64(((float64 *) ptr[9]), i, 0.1 / 5, elementsToCompare);
+        }
+    }
+    delete[] ptr;
+    return ok;
+}
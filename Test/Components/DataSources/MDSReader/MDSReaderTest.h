@@ -91,6 +91,26 @@ public:
      */
     bool TestInitialise();
 
+    /**
+     * @brief Tests that MDSReader::Initialise() reads ReadAheadSegments, CPUMask and StackSize.
+     */
+    bool TestInitialiseReadAheadSegments();
+
+    /**
+     * @brief Tests that MDSReader::Initialise() fails with StackSize = 0.
+     */
+    bool TestInitialiseInvalidStackSize();
+
+    /**
+     * @brief Tests that MDSReader::Initialise() reads the Server.
+     */
+    bool TestInitialiseServer();
+
+    /**
+     * @brief Tests that MDSReader::Initialise() fails if the Server is set without ReadAheadSegments.
+     */
+    bool TestInitialiseServerNoReadAheadSegments();
+
     /**
      * @brief Test message errors of MDSReader::SetConfiguredDatabase().
      */
@@ -938,6 +958,18 @@ public:
      */
     bool TestSynchronise67();
 
+    /**
+     * @brief Test Synchronise with the read-ahead thread and compare the output against the expected values
+     * @details Same as TestSynchronise with ReadAheadSegments = 2.
+     */
+    bool TestSynchroniseReadAhead();
+
+    /**
+     * @brief Test Synchronise with the read-ahead thread and compare the output against the expected values
+     * @details Same as TestSynchronise67 with ReadAheadSegments = 4.
+     */
+    bool TestSynchroniseReadAheadInterpolation();
+
 private:
     StreamString treeName;
     StreamString fullPath;
@@ -378,3 +378,28 @@ TEST(MDSWriterGTest,TestInvalidMessageType) {
     MDSWriterTest test;
     ASSERT_TRUE(test.TestInvalidMessageType());
 }
+
+TEST(MDSWriterGTest,TestInitialise_WriterThreads) {
+    MDSWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_WriterThreads());
+}
+
+TEST(MDSWriterGTest,TestInitialise_False_NumberOfSegmentBuffers) {
+    MDSWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NumberOfSegmentBuffers());
+}
+
+TEST(MDSWriterGTest,TestSetConfiguredDatabase_False_WriterThread) {
+    MDSWriterTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_WriterThread());
+}
+
+TEST(MDSWriterGTest,TestIntegratedInApplication_NoTrigger_WriterThreads) {
+    MDSWriterTest test;
+    ASSERT_TRUE(test.TestIntegratedInApplication_NoTrigger_WriterThreads());
+}
+
+TEST(MDSWriterGTest,TestGetWriterStatistics) {
+    MDSWriterTest test;
+    ASSERT_TRUE(test.TestGetWriterStatistics());
+}
@@ -59,6 +59,11 @@ TEST(MDSWriterNodeGTest,TestInitialise_SamplePhase) {
     ASSERT_TRUE(test.TestInitialise_SamplePhase());
 }
 
+TEST(MDSWriterNodeGTest,TestInitialise_NumberOfSegmentBuffers) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestInitialise_NumberOfSegmentBuffers());
+}
+
 TEST(MDSWriterNodeGTest,TestInitialise_False_BadMakeSegmentAfterNWrites) {
     MDSWriterNodeTest test;
     ASSERT_TRUE(test.TestInitialise_False_BadMakeSegmentAfterNWrites());
@@ -79,6 +84,11 @@ TEST(MDSWriterNodeGTest,TestInitialise_False_BadPeriod) {
     ASSERT_TRUE(test.TestInitialise_False_BadPeriod());
 }
 
+TEST(MDSWriterNodeGTest,TestInitialise_False_BadNumberOfSegmentBuffers) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BadNumberOfSegmentBuffers());
+}
+
 TEST(MDSWriterNodeGTest,TestInitialise_False_BadType) {
     MDSWriterNodeTest test;
     ASSERT_TRUE(test.TestInitialise_False_BadType());
@@ -293,3 +303,53 @@ TEST(MDSWriterNodeGTest,TestGetNumberOfExecuteCalls) {
     MDSWriterNodeTest test;
     ASSERT_TRUE(test.TestGetNumberOfExecuteCalls());
 }
+
+TEST(MDSWriterNodeGTest,TestInitialise_SegmentStreaming) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestInitialise_SegmentStreaming());
+}
+
+TEST(MDSWriterNodeGTest,TestInitialise_False_SegmentStreaming_AutomaticSegmentation) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestInitialise_False_SegmentStreaming_AutomaticSegmentation());
+}
+
+TEST(MDSWriterNodeGTest,TestInitialise_False_SegmentStreaming_NumberOfSegmentBuffers) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestInitialise_False_SegmentStreaming_NumberOfSegmentBuffers());
+}
+
+TEST(MDSWriterNodeGTest,TestExecute_SegmentStreaming) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestExecute_SegmentStreaming());
+}
+
+TEST(MDSWriterNodeGTest,TestInitialise_Compression) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestInitialise_Compression());
+}
+
+TEST(MDSWriterNodeGTest,TestInitialise_False_BadCompression) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BadCompression());
+}
+
+TEST(MDSWriterNodeGTest,TestExecute_Compression) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestExecute_Compression());
+}
+
+TEST(MDSWriterNodeGTest,TestInitialise_TimeDimension_Range) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestInitialise_TimeDimension_Range());
+}
+
+TEST(MDSWriterNodeGTest,TestInitialise_False_BadTimeDimension) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BadTimeDimension());
+}
+
+TEST(MDSWriterNodeGTest,TestExecute_TimeDimension_Range) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestExecute_TimeDimension_Range());
+}
@@ -166,6 +166,156 @@ bool MDSWriterNodeTest::TestInitialise_SamplePhase() {
     return ok;
 }
 
+bool MDSWriterNodeTest::TestInitialise_NumberOfSegmentBuffers() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "AAA");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 4);
+    cdb.Write("AutomaticSegmentation", 0);
+    cdb.Write("Samples", 100);
+    cdb.Write("NumberOfDimensions", 1);
+    cdb.Write("NumberOfSegmentBuffers", 3);
+    MDSWriterNode test;
+    bool ok = (test.GetNumberOfSegmentBuffers() == 1);
+    ok &= test.Initialise(cdb);
+    ok &= (test.GetNumberOfSegmentBuffers() == 3);
+    ok &= (test.GetBacklog() == 0);
+    ok &= (test.GetMaxBacklog() == 0);
+    ok &= (test.GetNumberOfQueueFull() == 0);
+    ok &= (test.GetNumberOfSegments() == 0);
+    ok &= (test.GetLastSegmentLatency() == 0);
+    ok &= (test.GetMaxSegmentLatency() == 0);
+    ok &= test.WaitQueuedSegments(0u);
+    ok &= test.WriteQueuedSegments();
+    return ok;
+}
+
+bool MDSWriterNodeTest::TestInitialise_SegmentStreaming() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "AAA");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 4);
+    cdb.Write("AutomaticSegmentation", 0);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 0);
+    cdb.Write("SegmentStreaming", 1);
+    MDSWriterNode test;
+    bool ok = !test.IsSegmentStreaming();
+    ok &= test.Initialise(cdb);
+    ok &= test.IsSegmentStreaming();
+    ok &= (test.GetNumberOfSegmentBuffers() == 1);
+    return ok;
+}
+
+bool MDSWriterNodeTest::TestInitialise_Compression() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "AAA");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 4);
+    cdb.Write("AutomaticSegmentation", 0);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 0);
+    cdb.Write("Compression", 1);
+    MDSWriterNode test;
+    bool ok = !test.IsCompression();
+    ok &= test.Initialise(cdb);
+    ok &= test.IsCompression();
+    return ok;
+}
+
+bool MDSWriterNodeTest::TestInitialise_False_BadCompression() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "AAA");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 4);
+    cdb.Write("AutomaticSegmentation", 0);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 0);
+    cdb.Write("Compression", 2);
+    MDSWriterNode test;
+    return !test.Initialise(cdb);
+}
+
+bool MDSWriterNodeTest::TestInitialise_False_SegmentStreaming_AutomaticSegmentation() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "AAA");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 4);
+    cdb.Write("AutomaticSegmentation", 1);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 0);
+    cdb.Write("SegmentStreaming", 1);
+    MDSWriterNode test;
+    return !test.Initialise(cdb);
+}
+
+bool MDSWriterNodeTest::TestInitialise_False_SegmentStreaming_NumberOfSegmentBuffers() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "AAA");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 4);
+    cdb.Write("AutomaticSegmentation", 0);
+    cdb.Write("NumberOfSegmentBuffers", 2);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 0);
+    cdb.Write("SegmentStreaming", 1);
+    MDSWriterNode test;
+    return !test.Initialise(cdb);
+}
+
+bool MDSWriterNodeTest::TestInitialise_TimeDimension_Range() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "AAA");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 4);
+    cdb.Write("AutomaticSegmentation", 1);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 0);
+    cdb.Write("TimeDimension", "Range");
+    MDSWriterNode test;
+    bool ok = test.Initialise(cdb);
+    ok &= test.IsSegmentStreaming();
+    ok &= (test.GetMakeSegmentAfterNWrites() == 4);
+    return ok;
+}
+
+bool MDSWriterNodeTest::TestInitialise_False_BadTimeDimension() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "AAA");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 4);
+    cdb.Write("AutomaticSegmentation", 1);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 0);
+    cdb.Write("TimeDimension", "Vector");
+    MDSWriterNode test;
+    return !test.Initialise(cdb);
+}
+
 bool MDSWriterNodeTest::TestInitialise_False_NoNodeName() {
     using namespace MARTe;
     ConfigurationDatabase cdb;
@@ -238,6 +388,22 @@ bool MDSWriterNodeTest::TestInitialise_False_BadPeriod() {
     return !test.Initialise(cdb);
 }
 
+bool MDSWriterNodeTest::TestInitialise_False_BadNumberOfSegmentBuffers() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "AAA");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 100);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 4);
+    cdb.Write("AutomaticSegmentation", 0);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 1);
+    cdb.Write("NumberOfSegmentBuffers", 0);
+    MDSWriterNode test;
+    return !test.Initialise(cdb);
+}
+
 bool MDSWriterNodeTest::TestInitialise_False_NoNumberOfElements() {
     using namespace MARTe;
     ConfigurationDatabase cdb;
@@ -657,6 +823,331 @@ bool MDSWriterNodeTest::TestExecute() {
 
 }
 
+bool MDSWriterNodeTest::TestExecute_TimeDimension_Range() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "SIGUINT16F");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 1e-6);
+    cdb.Write("MakeSegmentAfterNWrites", 4);
+    cdb.Write("AutomaticSegmentation", 1);
+    cdb.Write("TimeDimension", "Range");
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 0);
+    cdb.Write("DiscontinuityFactor", 0.5);
+    MDSWriterNode test;
+    bool ok = test.Initialise(cdb);
+    StreamString treeName = "mds_m2test";
+
+    MDSplus::Tree *tree = NULL;
+    int32 lastPulseNumber = -1;
+    try {
+        tree = new MDSplus::Tree(treeName.Buffer(), lastPulseNumber);
+        lastPulseNumber = tree->getCurrent(treeName.Buffer());
+    }
+    catch (MDSplus::MdsException &exc) {
+        ok = false;
+    }
+    delete tree;
+    tree = NULL_PTR(MDSplus::Tree *);
+    int32 currentPulseNumber = lastPulseNumber + 1;
+    try {
+        tree = new MDSplus::Tree(treeName.Buffer(), -1);
+        tree->setCurrent(treeName.Buffer(), currentPulseNumber);
+        tree->createPulse(currentPulseNumber);
+    }
+    catch (MDSplus::MdsException &exc) {
+        delete tree;
+        tree = NULL_PTR(MDSplus::Tree *);
+        ok = false;
+    }
+
+    MDSplus::TreeNode *sigUInt16F;
+    if (ok) {
+        try {
+            sigUInt16F = tree->getNode("SIGUINT16F");
+            sigUInt16F->deleteData();
+
+        }
+        catch (MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed opening node");
+            ok = false;
+        }
+    }
+
+    uint16 signal = 0u;
+    //Time in micro-seconds: a continuous run 10, 11, 12 and a discontinuity at 20
+    uint32 signalTime = 0u;
+    const uint32 times[] = { 10u, 11u, 12u, 20u, 21u };
+    if (ok) {
+        ok = test.AllocateTreeNode(tree);
+    }
+    if (ok) {
+        test.SetSignalMemory(&signal);
+        test.SetTimeSignalMemory(&signalTime, UnsignedInteger32Bit, 1e-6);
+        ok = test.IsSegmentStreaming();
+    }
+    uint16 i;
+    for (i = 0u; (i < 5u) && (ok); i++) {
+        signal = (i + 1u);
+        signalTime = times[i];
+        ok = test.Execute();
+    }
+    if (ok) {
+        ok = test.Flush();
+    }
+    //One segment for each continuous run
+    if (ok) {
+        ok = (sigUInt16F->getNumSegments() == 2);
+    }
+    const int32 expectedSamples[] = { 3, 2 };
+    const float64 expectedStart[] = { 10e-6, 20e-6 };
+    int32 s;
+    for (s = 0; (s < 2) && (ok); s++) {
+        try {
+            MDSplus::Array *data = sigUInt16F->getSegment(s);
+            int32 numberOfValues = 0;
+            uint16 *values = data->getShortUnsignedArray(&numberOfValues);
+            ok = (numberOfValues == expectedSamples[s]);
+            int32 j;
+            for (j = 0; (j < numberOfValues) && (ok); j++) {
+                ok = (values[j] == (j + 1 + (3 * s)));
+            }
+            delete[] values;
+            MDSplus::deleteData(data);
+            //The time dimension is a Range starting at the time of the first sample of the run
+            MDSplus::Data *dim = sigUInt16F->getSegmentDim(s);
+            MDSplus::Range *range = dynamic_cast<MDSplus::Range *>(dim);
+            if (ok) {
+                ok = (range != NULL_PTR(MDSplus::Range *));
+            }
+            if (ok) {
+                MDSplus::Data *beginD = range->getBegin();
+                MDSplus::Data *endD = range->getEnding();
+                float64 begin = beginD->getDouble();
+                float64 end = endD->getDouble();
+                ok = ((begin - expectedStart[s]) < 1e-12) && ((expectedStart[s] - begin) < 1e-12);
+                float64 expectedEnd = expectedStart[s] + (static_cast<float64>(expectedSamples[s] - 1) * 1e-6);
+                if (ok) {
+                    ok = ((end - expectedEnd) < 1e-12) && ((expectedEnd - end) < 1e-12);
+                }
+                MDSplus::deleteData(beginD);
+                MDSplus::deleteData(endD);
+            }
+            MDSplus::deleteData(dim);
+        }
+        catch (MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed reading the segments: %s", exc.what());
+            ok = false;
+        }
+    }
+
+    if (tree != NULL) {
+        delete tree;
+    }
+    return ok;
+}
+
+bool MDSWriterNodeTest::TestExecute_Compression() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "SIGUINT16F");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 1);
+    cdb.Write("AutomaticSegmentation", 0);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 0);
+    cdb.Write("Compression", 1);
+    MDSWriterNode test;
+    bool ok = test.Initialise(cdb);
+    StreamString treeName = "mds_m2test";
+
+    MDSplus::Tree *tree = NULL;
+    int32 lastPulseNumber = -1;
+    try {
+        tree = new MDSplus::Tree(treeName.Buffer(), lastPulseNumber);
+        lastPulseNumber = tree->getCurrent(treeName.Buffer());
+    }
+    catch (MDSplus::MdsException &exc) {
+        ok = false;
+    }
+    delete tree;
+    tree = NULL_PTR(MDSplus::Tree *);
+    int32 currentPulseNumber = lastPulseNumber + 1;
+    try {
+        tree = new MDSplus::Tree(treeName.Buffer(), -1);
+        tree->setCurrent(treeName.Buffer(), currentPulseNumber);
+        tree->createPulse(currentPulseNumber);
+    }
+    catch (MDSplus::MdsException &exc) {
+        delete tree;
+        tree = NULL_PTR(MDSplus::Tree *);
+        ok = false;
+    }
+
+    MDSplus::TreeNode *sigUInt16F;
+    if (ok) {
+        try {
+            sigUInt16F = tree->getNode("SIGUINT16F");
+            sigUInt16F->deleteData();
+
+        }
+        catch (MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed opening node");
+            ok = false;
+        }
+    }
+
+    uint16 signal;
+    if (ok) {
+        ok = test.AllocateTreeNode(tree);
+    }
+    if (ok) {
+        test.SetSignalMemory(&signal);
+    }
+    if (ok) {
+        ok = test.Execute();
+    }
+
+    if (ok) {
+        const uint64 maxTimeoutSeconds = 2;
+        uint64 maxTimeout = HighResolutionTimer::Counter() + maxTimeoutSeconds * HighResolutionTimer::Frequency();
+        while ((sigUInt16F->getNumSegments() != 1) && (ok)) {
+            Sleep::MSec(10);
+            ok = (HighResolutionTimer::Counter() < maxTimeout);
+        }
+    }
+    if (ok) {
+        ok = sigUInt16F->isCompressSegments();
+    }
+
+    if (tree != NULL) {
+        delete tree;
+    }
+    return ok;
+
+}
+
+bool MDSWriterNodeTest::TestExecute_SegmentStreaming() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "SIGUINT16F");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 4);
+    cdb.Write("AutomaticSegmentation", 0);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 0);
+    cdb.Write("SegmentStreaming", 1);
+    MDSWriterNode test;
+    bool ok = test.Initialise(cdb);
+    StreamString treeName = "mds_m2test";
+
+    MDSplus::Tree *tree = NULL;
+    int32 lastPulseNumber = -1;
+    try {
+        tree = new MDSplus::Tree(treeName.Buffer(), lastPulseNumber);
+        lastPulseNumber = tree->getCurrent(treeName.Buffer());
+    }
+    catch (MDSplus::MdsException &exc) {
+        ok = false;
+    }
+    delete tree;
+    tree = NULL_PTR(MDSplus::Tree *);
+    int32 currentPulseNumber = lastPulseNumber + 1;
+    try {
+        tree = new MDSplus::Tree(treeName.Buffer(), -1);
+        tree->setCurrent(treeName.Buffer(), currentPulseNumber);
+        tree->createPulse(currentPulseNumber);
+    }
+    catch (MDSplus::MdsException &exc) {
+        delete tree;
+        tree = NULL_PTR(MDSplus::Tree *);
+        ok = false;
+    }
+
+    MDSplus::TreeNode *sigUInt16F;
+    if (ok) {
+        try {
+            sigUInt16F = tree->getNode("SIGUINT16F");
+            sigUInt16F->deleteData();
+
+        }
+        catch (MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed opening node");
+            ok = false;
+        }
+    }
+
+    uint16 signal = 0u;
+    if (ok) {
+        ok = test.AllocateTreeNode(tree);
+    }
+    if (ok) {
+        test.SetSignalMemory(&signal);
+    }
+    //The segment is created by the first Execute
+    if (ok) {
+        signal = 1u;
+        ok = test.Execute();
+    }
+    if (ok) {
+        ok = (sigUInt16F->getNumSegments() == 1);
+    }
+    uint16 i;
+    for (i = 2u; (i < 7u) && (ok); i++) {
+        signal = i;
+        ok = test.Execute();
+    }
+    //Two segments: one complete and one with two samples
+    if (ok) {
+        ok = test.Flush();
+    }
+    if (ok) {
+        ok = (sigUInt16F->getNumSegments() == 2);
+    }
+    if (ok) {
+        ok = (test.GetNumberOfSegments() == 2);
+    }
+    if (ok) {
+        try {
+            MDSplus::Array *data = sigUInt16F->getSegment(0);
+            int32 numberOfValues = 0;
+            uint16 *values = data->getShortUnsignedArray(&numberOfValues);
+            ok = (numberOfValues == 4);
+            int32 j;
+            for (j = 0; (j < numberOfValues) && (ok); j++) {
+                ok = (values[j] == (j + 1));
+            }
+            delete[] values;
+            MDSplus::deleteData(data);
+            data = sigUInt16F->getSegment(1);
+            values = data->getShortUnsignedArray(&numberOfValues);
+            if (ok) {
+                ok = (numberOfValues == 2);
+            }
+            for (j = 0; (j < numberOfValues) && (ok); j++) {
+                ok = (values[j] == (j + 5));
+            }
+            delete[] values;
+            MDSplus::deleteData(data);
+        }
+        catch (MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed reading the segments: %s", exc.what());
+            ok = false;
+        }
+    }
+
+    if (tree != NULL) {
+        delete tree;
+    }
+    return ok;
+}
+
 bool MDSWriterNodeTest::TestExecute_Decimated() {
     using namespace MARTe;
     ConfigurationDatabase cdb;
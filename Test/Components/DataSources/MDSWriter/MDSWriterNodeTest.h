@@ -71,6 +71,11 @@ public:
      */
     bool TestInitialise_SamplePhase();
 
+    /**
+     * @brief Test the Initialise specifying the NumberOfSegmentBuffers
+     */
+    bool TestInitialise_NumberOfSegmentBuffers();
+
     /**
      * @brief Test the Initialise without specifying a NodeName
      */
@@ -96,6 +101,46 @@ public:
      */
     bool TestInitialise_False_BadPeriod();
 
+    /**
+     * @brief Test the Initialise specifying an invalid NumberOfSegmentBuffers
+     */
+    bool TestInitialise_False_BadNumberOfSegmentBuffers();
+
+    /**
+     * @brief Test the Initialise specifying SegmentStreaming
+     */
+    bool TestInitialise_SegmentStreaming();
+
+    /**
+     * @brief Test the Initialise specifying Compression
+     */
+    bool TestInitialise_Compression();
+
+    /**
+     * @brief Test the Initialise specifying an invalid Compression
+     */
+    bool TestInitialise_False_BadCompression();
+
+    /**
+     * @brief Test the Initialise specifying SegmentStreaming with AutomaticSegmentation
+     */
+    bool TestInitialise_False_SegmentStreaming_AutomaticSegmentation();
+
+    /**
+     * @brief Test the Initialise specifying SegmentStreaming with NumberOfSegmentBuffers > 1
+     */
+    bool TestInitialise_False_SegmentStreaming_NumberOfSegmentBuffers();
+
+    /**
+     * @brief Test the Initialise specifying TimeDimension = Range with AutomaticSegmentation
+     */
+    bool TestInitialise_TimeDimension_Range();
+
+    /**
+     * @brief Test the Initialise specifying an invalid TimeDimension
+     */
+    bool TestInitialise_False_BadTimeDimension();
+
     /**
      * @brief Test the Initialise without specifying the NumberOfElements
      */
@@ -211,6 +256,21 @@ public:
      */
     bool TestExecute_Decimated();
 
+    /**
+     * @brief Test the Execute method with SegmentStreaming
+     */
+    bool TestExecute_SegmentStreaming();
+
+    /**
+     * @brief Test the Execute method with TimeDimension = Range and a time signal with a discontinuity
+     */
+    bool TestExecute_TimeDimension_Range();
+
+    /**
+     * @brief Test the Execute method with Compression
+     */
+    bool TestExecute_Compression();
+
     /**
      * @brief Tests the Execute method without setting the Tree.
      */
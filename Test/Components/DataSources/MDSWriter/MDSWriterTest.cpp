@@ -35,6 +35,7 @@
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
 #include "StandardParser.h"
+#include "StringHelper.h"
 #include "ThreadInformation.h"
 
 /*---------------------------------------------------------------------------*/
@@ -807,6 +808,23 @@ static bool TestIntegratedExecution(const MARTe::char8 * const config, MARTe::ui
 }
 
 //Standard configuration with no trigger source
+/**
+ * @brief Inserts the writer thread parameters in the MDSWriter of a configuration (after NumberOfBuffers).
+ */
+static MARTe::StreamString GetWriterThreadsConfig(const MARTe::char8 * const config, const MARTe::char8 * const parameters) {
+    using namespace MARTe;
+    StreamString configThreads;
+    const char8 * const token = "NumberOfBuffers = 10";
+    const char8 * const found = StringHelper::SearchString(config, token);
+    if (found != NULL_PTR(const char8 *)) {
+        uint32 size = static_cast<uint32>(found - config);
+        (void) configThreads.Write(config, size);
+        configThreads += parameters;
+        configThreads += found;
+    }
+    return configThreads;
+}
+
 static const MARTe::char8 * const config1 = ""
         "$Test = {"
         "    Class = RealTimeApplication"
@@ -8116,3 +8134,145 @@ bool MDSWriterTest::TestInvalidMessageType() {
     bool ok = TestIntegratedInApplication(config19, true);
     return !ok;
 }
+
+bool MDSWriterTest::TestInitialise_WriterThreads() {
+    using namespace MARTe;
+    MDSWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("TreeName", "mds_m2test");
+    cdb.Write("PulseNumber", 10);
+    cdb.Write("EventName", "updatejScope");
+    cdb.Write("TimeRefresh", 5);
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("NumberOfWriterThreads", 2);
+    cdb.Write("NumberOfSegmentBuffers", 3);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = (test.GetNumberOfWriterThreads() == 0);
+    ok &= (test.GetNumberOfSegmentBuffers() == 4);
+    ok &= test.Initialise(cdb);
+    ok &= (test.GetNumberOfWriterThreads() == 2);
+    ok &= (test.GetNumberOfSegmentBuffers() == 3);
+    return ok;
+}
+
+bool MDSWriterTest::TestInitialise_False_NumberOfSegmentBuffers() {
+    using namespace MARTe;
+    MDSWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("TreeName", "mds_m2test");
+    cdb.Write("PulseNumber", 10);
+    cdb.Write("EventName", "updatejScope");
+    cdb.Write("TimeRefresh", 5);
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("NumberOfWriterThreads", 2);
+    cdb.Write("NumberOfSegmentBuffers", 1);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool MDSWriterTest::TestSetConfiguredDatabase_False_WriterThread() {
+    using namespace MARTe;
+    StreamString configThreads = GetWriterThreadsConfig(config1, "NumberOfWriterThreads = 2 ");
+    bool ok = (configThreads.Size() > 0u);
+    if (ok) {
+        //Assign the first node to a thread which does not exist
+        StreamString configBad;
+        const char8 * const token = "NodeName = ";
+        const char8 * const found = StringHelper::SearchString(configThreads.Buffer(), token);
+        ok = (found != NULL_PTR(const char8 *));
+        if (ok) {
+            uint32 size = static_cast<uint32>(found - configThreads.Buffer());
+            (void) configBad.Write(configThreads.Buffer(), size);
+            configBad += "WriterThread = 2 ";
+            configBad += found;
+            ok = !TestIntegratedInApplication(configBad.Buffer(), true);
+        }
+    }
+    return ok;
+}
+
+bool MDSWriterTest::TestIntegratedInApplication_NoTrigger_WriterThreads() {
+    using namespace MARTe;
+    uint32 signalToGenerate[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    uint32 timeToVerify[] = { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22 };
+    uint32 numberOfElements = sizeof(signalToGenerate) / sizeof(uint32);
+    const char8 * const treeName = "mds_m2test";
+    const uint32 numberOfBuffers = 16;
+    const uint32 pulseNumber = 1;
+    const uint32 writeAfterNSegments = 4;
+    const uint32 numberOfSegments = numberOfElements / writeAfterNSegments;
+    const float32 period = 2;
+    StreamString configThreads = GetWriterThreadsConfig(config1, "NumberOfWriterThreads = 3 NumberOfSegmentBuffers = 2 ");
+    bool ok = (configThreads.Size() > 0u);
+    if (ok) {
+        ok = TestIntegratedExecution(configThreads.Buffer(), signalToGenerate, numberOfElements, NULL, signalToGenerate, timeToVerify, numberOfElements, numberOfBuffers, 0, 0, period, treeName,
+                                     pulseNumber, numberOfSegments, false);
+    }
+    return ok;
+}
+
+bool MDSWriterTest::TestGetWriterStatistics() {
+    using namespace MARTe;
+    StreamString configThreads = GetWriterThreadsConfig(config1, "NumberOfWriterThreads = 2 ");
+    bool ok = (configThreads.Size() > 0u);
+    if (ok) {
+        ok = TestIntegratedInApplication(configThreads.Buffer(), false);
+    }
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+
+    ReferenceT<MDSWriter> mdsWriter;
+    if (ok) {
+        mdsWriter = godb->Find("Test.Data.Drv1");
+        ok = mdsWriter.IsValid();
+    }
+    if (ok) {
+        ok = (mdsWriter->GetNumberOfWriterThreads() == 2u);
+    }
+    if (ok) {
+        ok = (mdsWriter->GetNodeWriterThread(1u) == 1u);
+    }
+    ReferenceT<ConfigurationDatabase> stats(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceContainer message;
+    if (ok) {
+        ok = message.Insert(stats);
+    }
+    if (ok) {
+        ok = (mdsWriter->GetWriterStatistics(message) == ErrorManagement::NoError);
+    }
+    uint32 value = 0u;
+    if (ok) {
+        ok = stats->Read("NumberOfWriterThreads", value);
+    }
+    if (ok) {
+        ok = (value == 2u);
+    }
+    if (ok) {
+        ok = stats->MoveAbsolute("Node1");
+    }
+    if (ok) {
+        ok = stats->Read("WriterThread", value);
+    }
+    if (ok) {
+        ok = (value == 1u);
+    }
+    if (ok) {
+        ok = stats->Read("Backlog", value);
+    }
+    if (ok) {
+        ok = (value == 0u);
+    }
+    if (ok) {
+        ReferenceContainer badMessage;
+        ok = (mdsWriter->GetWriterStatistics(badMessage) != ErrorManagement::NoError);
+    }
+    godb->Purge();
+    return ok;
+}
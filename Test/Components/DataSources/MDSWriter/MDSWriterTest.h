@@ -387,6 +387,31 @@ public:
      * @brief Tests that an Invalid message type is correctly captured.
      */
     bool TestInvalidMessageType();
+
+    /**
+     * @brief Tests the Initialise method with NumberOfWriterThreads and NumberOfSegmentBuffers.
+     */
+    bool TestInitialise_WriterThreads();
+
+    /**
+     * @brief Tests that the Initialise method fails if NumberOfWriterThreads > 0 and NumberOfSegmentBuffers < 2.
+     */
+    bool TestInitialise_False_NumberOfSegmentBuffers();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if the WriterThread of a signal is >= NumberOfWriterThreads.
+     */
+    bool TestSetConfiguredDatabase_False_WriterThread();
+
+    /**
+     * @brief Tests the integration in an application with the segments written by the writer threads.
+     */
+    bool TestIntegratedInApplication_NoTrigger_WriterThreads();
+
+    /**
+     * @brief Tests the GetWriterStatistics method.
+     */
+    bool TestGetWriterStatistics();
 private:
     MDSWriterTreeTestHelper treeTestHelper;
 };
@@ -71,6 +71,16 @@ TEST(NI1588TimestampGTest,TestSetConfiguredDatabase_AllSignals) {
     ASSERT_TRUE(test.TestSetConfiguredDatabase_AllSignals());
 }
 
+TEST(NI1588TimestampGTest,TestSetConfiguredDatabase_Events) {
+    NI1588TimestampTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_Events());
+}
+
+TEST(NI1588TimestampGTest,TestSetConfiguredDatabase_False_Events_Nelements) {
+    NI1588TimestampTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_Events_Nelements());
+}
+
 TEST(NI1588TimestampGTest,TestSetConfiguredDatabase_False_InvalidTcnTimestamp_PFI0_Type) {
     NI1588TimestampTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase_False_InvalidTcnTimestamp_PFI0_Type());
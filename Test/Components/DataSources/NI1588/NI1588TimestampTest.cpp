@@ -553,6 +553,248 @@ bool NI1588TimestampTest::TestSetConfiguredDatabase_AllSignals() {
     return ret;
 }
 
+bool NI1588TimestampTest::TestSetConfiguredDatabase_Events() {
+
+    static const char8 * const config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = NI1588TimestampTestGAM1"
+            "             InputSignals = {"
+            "               EventPFI1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint8"
+            "                   Samples = 1"
+            "               }"
+            "               InternalTimeStamp = {"
+            "                   DataSource = Drv1"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 9"
+            "                   Type = uint64"
+            "                   Samples = 1"
+            "               }"
+            "               TerminalPFI1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   Samples = 1"
+            "               }"
+            "               ErrorCheck = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 9"
+            "                   Samples = 1"
+            "               }"
+            "               TerminalPFI0 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   Samples = 1"
+            "                   Frequency = 0"
+            "               }"
+            "               TerminalPFI2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   Samples = 1"
+            "               }"
+            "               EventPFI0 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint8"
+            "                   Samples = 1"
+            "               }"
+            "               EventPFI2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint8"
+            "                   Samples = 1"
+            "               }"
+            "               Events = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 32"
+            "                   Samples = 1"
+            "               }"
+            "               NumberOfEvents = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   Samples = 1"
+            "               }"
+            "               EventsOverflow = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   Samples = 1"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = NI1588TimestampTestDS"
+            "            NumberOfBuffers = 10"
+            "            CpuMask = 1"
+            "            ReceiverThreadPriority = 31"
+            "            PollMsecTimeout = 1000"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<NI1588TimestampTestDS> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        ret = dataSource->GetNumberOfSignals() == 11;
+    }
+    if (ret) {
+        uint32 *signalIndexes = dataSource->GetSignalIndexes();
+        if (ret) {
+            ret &= signalIndexes[0] == 4;
+            ret &= signalIndexes[1] == 2;
+            ret &= signalIndexes[2] == 5;
+            ret &= signalIndexes[3] == 6;
+            ret &= signalIndexes[4] == 0;
+            ret &= signalIndexes[5] == 7;
+            ret &= signalIndexes[6] == 8;
+            ret &= signalIndexes[7] == 9;
+            ret &= signalIndexes[8] == 10;
+        }
+    }
+
+    return ret;
+}
+
+bool NI1588TimestampTest::TestSetConfiguredDatabase_False_Events_Nelements() {
+
+    static const char8 * const config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = NI1588TimestampTestGAM1"
+            "             InputSignals = {"
+            "               EventPFI1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint8"
+            "                   Samples = 1"
+            "               }"
+            "               InternalTimeStamp = {"
+            "                   DataSource = Drv1"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 9"
+            "                   Type = uint64"
+            "                   Samples = 1"
+            "               }"
+            "               TerminalPFI1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   Samples = 1"
+            "               }"
+            "               ErrorCheck = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 9"
+            "                   Samples = 1"
+            "               }"
+            "               TerminalPFI0 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   Samples = 1"
+            "                   Frequency = 0"
+            "               }"
+            "               TerminalPFI2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   Samples = 1"
+            "               }"
+            "               EventPFI0 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint8"
+            "                   Samples = 1"
+            "               }"
+            "               EventPFI2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint8"
+            "                   Samples = 1"
+            "               }"
+            "               Events = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 31"
+            "                   Samples = 1"
+            "               }"
+            "               NumberOfEvents = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   Samples = 1"
+            "               }"
+            "               EventsOverflow = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   Samples = 1"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = NI1588TimestampTestDS"
+            "            NumberOfBuffers = 10"
+            "            CpuMask = 1"
+            "            ReceiverThreadPriority = 31"
+            "            PollMsecTimeout = 1000"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+    return !InitialiseMemoryMapInputBrokerEnviroment(config);
+}
+
 bool NI1588TimestampTest::TestSetConfiguredDatabase_False_InvalidTcnTimestamp_PFI0_Type() {
 
     static const char8 * const config = ""
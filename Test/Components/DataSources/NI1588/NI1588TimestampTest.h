@@ -82,6 +82,16 @@ public:
      */
     bool TestSetConfiguredDatabase_AllSignals();
 
+    /**
+     * @brief Tests the SetConfiguredDatabase method with the Events, NumberOfEvents and EventsOverflow signals.
+     */
+    bool TestSetConfiguredDatabase_Events();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if the Events signal has an odd number of elements.
+     */
+    bool TestSetConfiguredDatabase_False_Events_Nelements();
+
     /**
      * @brief Tests that the TestSetConfiguredDatabase method fails if TcnTimeStamp PFI0 signal type
      * is different than uint64
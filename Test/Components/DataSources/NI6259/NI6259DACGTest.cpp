@@ -109,6 +109,11 @@ TEST(NI6259DACGTest,TestInitialise_False_NoBoardId) {
     ASSERT_TRUE(test.TestInitialise_False_NoBoardId());
 }
 
+TEST(NI6259DACGTest,TestInitialise_False_BadOutputMode) {
+    NI6259DACTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BadOutputMode());
+}
+
 TEST(NI6259DACGTest,TestInitialise_False_NoSignals) {
     NI6259DACTest test;
     ASSERT_TRUE(test.TestInitialise_False_NoSignals());
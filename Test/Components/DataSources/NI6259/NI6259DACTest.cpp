@@ -827,6 +827,29 @@ bool NI6259DACTest::TestInitialise_False_NoBoardId() {
     return ok;
 }
 
+bool NI6259DACTest::TestInitialise_False_BadOutputMode() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config1;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    cdb.MoveAbsolute("$Test.+Data.+NI6259_0");
+    cdb.Write("OutputMode", "Stream");
+    if (ok) {
+        NI6259DAC test;
+        ok = !test.Initialise(cdb);
+    }
+    if (ok) {
+        cdb.Delete("OutputMode");
+        cdb.Write("OutputMode", "Waveform");
+        cdb.Write("PreloadBlocks", 0);
+        NI6259DAC test;
+        ok = !test.Initialise(cdb);
+    }
+    return ok;
+}
+
 bool NI6259DACTest::TestInitialise_False_NoSignals() {
     using namespace MARTe;
     ConfigurationDatabase cdb;
@@ -125,6 +125,16 @@ TEST(NI6368ADCGTest,TestInitialise_False_NoDMABufferSize) {
     ASSERT_TRUE(test.TestInitialise_False_NoDMABufferSize());
 }
 
+TEST(NI6368ADCGTest,TestInitialise_False_BadNumberOfBuffers) {
+    NI6368ADCTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BadNumberOfBuffers());
+}
+
+TEST(NI6368ADCGTest,TestGetNumberOfOverruns) {
+    NI6368ADCTest test;
+    ASSERT_TRUE(test.TestGetNumberOfOverruns());
+}
+
 TEST(NI6368ADCGTest,TestInitialise_False_NoScanIntervalCounterPeriod) {
     NI6368ADCTest test;
     ASSERT_TRUE(test.TestInitialise_False_NoScanIntervalCounterPeriod());
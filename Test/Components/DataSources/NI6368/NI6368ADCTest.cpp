@@ -2048,6 +2048,35 @@ bool NI6368ADCTest::TestInitialise_False_NoDMABufferSize() {
     return ok;
 }
 
+bool NI6368ADCTest::TestInitialise_False_BadNumberOfBuffers() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config1;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    cdb.MoveAbsolute("$Test.+Data.+NI6368_0");
+    cdb.Delete("NumberOfBuffers");
+    cdb.Write("NumberOfBuffers", 1);
+    if (ok) {
+        NI6368ADC test;
+        ok = !test.Initialise(cdb);
+    }
+    if (ok) {
+        cdb.Delete("NumberOfBuffers");
+        cdb.Write("NumberOfBuffers", NI6368ADC_MAX_NUMBER_OF_BUFFERS + 1u);
+        NI6368ADC test;
+        ok = !test.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool NI6368ADCTest::TestGetNumberOfOverruns() {
+    using namespace MARTe;
+    NI6368ADC ni6368ADC;
+    return (ni6368ADC.GetNumberOfOverruns() == 0u);
+}
+
 bool NI6368ADCTest::TestInitialise_False_NoScanIntervalCounterPeriod() {
     using namespace MARTe;
     ConfigurationDatabase cdb;
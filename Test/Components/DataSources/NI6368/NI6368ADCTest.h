@@ -126,6 +126,16 @@ public:
      */
     bool TestInitialise_False_NoDMABufferSize();
 
+    /**
+     * @brief Tests the Initialise method with an invalid NumberOfBuffers.
+     */
+    bool TestInitialise_False_BadNumberOfBuffers();
+
+    /**
+     * @brief Tests the GetNumberOfOverruns method.
+     */
+    bool TestGetNumberOfOverruns();
+
     /**
      * @brief Tests the Initialise method without specifying the ScanIntervalCounterPeriod.
      */
@@ -109,6 +109,11 @@ TEST(NI6368DACGTest,TestInitialise_False_NoBoardId) {
     ASSERT_TRUE(test.TestInitialise_False_NoBoardId());
 }
 
+TEST(NI6368DACGTest,TestInitialise_False_BadOutputMode) {
+    NI6368DACTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BadOutputMode());
+}
+
 TEST(NI6368DACGTest,TestInitialise_False_NoSignals) {
     NI6368DACTest test;
     ASSERT_TRUE(test.TestInitialise_False_NoSignals());
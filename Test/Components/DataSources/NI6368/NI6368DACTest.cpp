@@ -1022,6 +1022,29 @@ bool NI6368DACTest::TestInitialise_False_NoBoardId() {
     return ok;
 }
 
+bool NI6368DACTest::TestInitialise_False_BadOutputMode() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config1;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    cdb.MoveAbsolute("$Test.+Data.+NI6368_0");
+    cdb.Write("OutputMode", "Stream");
+    if (ok) {
+        NI6368DAC test;
+        ok = !test.Initialise(cdb);
+    }
+    if (ok) {
+        cdb.Delete("OutputMode");
+        cdb.Write("OutputMode", "Waveform");
+        cdb.Write("PreloadBlocks", 0);
+        NI6368DAC test;
+        ok = !test.Initialise(cdb);
+    }
+    return ok;
+}
+
 bool NI6368DACTest::TestInitialise_False_NoSignals() {
     using namespace MARTe;
     ConfigurationDatabase cdb;
@@ -111,6 +111,11 @@ public:
      */
     bool TestInitialise_False_NoBoardId();
 
+    /**
+     * @brief Tests the Initialise method with an invalid OutputMode and with an invalid PreloadBlocks.
+     */
+    bool TestInitialise_False_BadOutputMode();
+
     /**
      * @brief Tests the Initialise method without specifying the signals section.
      */
@@ -272,6 +272,16 @@ TEST(NI6368DIOGTest,TestInitialise_False_InvalidUpdateIntervalCounterDelay) {
     ASSERT_TRUE(test.TestInitialise_False_InvalidUpdateIntervalCounterDelay());
 }
 
+TEST(NI6368DIOGTest,TestInitialise_False_BadInputMode) {
+    NI6368DIOTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BadInputMode());
+}
+
+TEST(NI6368DIOGTest,TestInitialise_False_ChangeDetectionClockSampleSource) {
+    NI6368DIOTest test;
+    ASSERT_TRUE(test.TestInitialise_False_ChangeDetectionClockSampleSource());
+}
+
 TEST(NI6368DIOGTest,TestSetConfiguredDatabasel) {
     NI6368DIOTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase());
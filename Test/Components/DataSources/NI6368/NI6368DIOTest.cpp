@@ -3102,6 +3102,38 @@ bool NI6368DIOTest::TestInitialise_False_InvalidUpdateIntervalCounterDelay() {
     return ok;
 }
 
+bool NI6368DIOTest::TestInitialise_False_BadInputMode() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config1;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    cdb.MoveAbsolute("$Test.+Data.+NI6368_0");
+    cdb.Write("InputMode", "Interrupt");
+    NI6368DIO test;
+    if (ok) {
+        ok = !test.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool NI6368DIOTest::TestInitialise_False_ChangeDetectionClockSampleSource() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config1;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    cdb.MoveAbsolute("$Test.+Data.+NI6368_0");
+    cdb.Write("InputMode", "ChangeDetection");
+    NI6368DIO test;
+    if (ok) {
+        ok = !test.Initialise(cdb);
+    }
+    return ok;
+}
+
 bool NI6368DIOTest::TestInitialise_False_NoSignals() {
     using namespace MARTe;
     ConfigurationDatabase cdb;
@@ -272,6 +272,16 @@ public:
      */
     bool TestInitialise_False_InvalidUpdateIntervalCounterDelay();
 
+    /**
+     * @brief Tests the Initialise method with an unsupported InputMode.
+     */
+    bool TestInitialise_False_BadInputMode();
+
+    /**
+     * @brief Tests the Initialise method with InputMode = ChangeDetection and a ClockSampleSource other than DIO_CHGDETECT.
+     */
+    bool TestInitialise_False_ChangeDetectionClockSampleSource();
+
 
     /**
      * @brief Tests the SetConfiguredDatabase method.
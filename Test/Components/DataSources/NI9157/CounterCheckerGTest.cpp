@@ -134,3 +134,8 @@ TEST(CounterCheckerGTest,TestSynchronise_FalseFrameIsWrong) {
     CounterCheckerTest test;
     ASSERT_TRUE(test.TestSynchronise_FalseFrameIsWrong());
 }
+
+TEST(CounterCheckerGTest,TestSynchronise_CounterAfterFirstBlock) {
+    CounterCheckerTest test;
+    ASSERT_TRUE(test.TestSynchronise_CounterAfterFirstBlock());
+}
@@ -852,3 +852,59 @@ bool CounterCheckerTest::TestSynchronise_FalseFrameIsWrong() {
     ObjectRegistryDatabase::Instance()->Purge();
     return ret;
 }
+
+bool CounterCheckerTest::TestSynchronise_CounterAfterFirstBlock() {
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream =  counterCheckerTestconfig0;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ret = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ret) {
+        god->Purge();
+        ret = god->Initialise(cdb);
+    }
+    ReferenceT<CounterCheckerTestHelper> aCounterChecker;
+    if (ret) {
+        aCounterChecker = ObjectRegistryDatabase::Instance()->Find("ACounterChecker");
+        ret = aCounterChecker.IsValid();
+    }
+    if (ret) {
+        ret = (aCounterChecker->GetPacketCounter() == 2ull);
+        ret &= (aCounterChecker->GetAcquireFromCounter() == 1ull);
+        ret &= (aCounterChecker->GetCounterStep() == 1u);
+        ret &= (aCounterChecker->GetCheckCounterAfterNSteps() == 1u);
+        ret &= (aCounterChecker->GetNextPacketCheck() == 2ull);
+        ret &= (aCounterChecker->GetSampleSize() == 8u);
+        ret &= (aCounterChecker->GetNFrameForSync() == 2u);
+    }
+    if (ret) {
+        uint32 numberOfPackets = 4;
+        uint32 numberOfSamples = 40;
+        uint32 counterIdx = 21;
+        uint64 testPackets[numberOfSamples*numberOfPackets];
+        for (uint32 i = 0u; i < numberOfPackets; i++) {
+            for (uint32 j = 0u; j < numberOfSamples; j++) {
+                if (j == counterIdx) {
+                    testPackets[i*numberOfSamples + j] = static_cast<uint64>(i+1u);
+                }
+                else {
+                    testPackets[i*numberOfSamples + j] = static_cast<uint64>(i+1u)*1000ull + static_cast<uint64>(j);
+                }
+                
+            }
+        }
+        uint32 aSizeToRead = numberOfSamples * aCounterChecker->GetSampleSize();
+        uint32 aIdx = 0u;
+        bool aWrite = false;
+        ret = aCounterChecker->Synchronise(reinterpret_cast<uint8 *>(&testPackets[0]), aSizeToRead, aIdx, aWrite);
+        ret &= (aIdx == (counterIdx * aCounterChecker->GetSampleSize()));
+        ret &= aWrite;
+    }
+
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
@@ -170,6 +170,12 @@ public:
      */
     bool TestSynchronise_FalseFrameIsWrong();
 
+    /**
+     * @brief Tests the CounterChecker::Synchronise method with the packet
+     * counter placed after the first block of samples of the frame.
+     */
+    bool TestSynchronise_CounterAfterFirstBlock();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -708,3 +708,20 @@ TEST(NI9157CircularFifoReaderGTest,TestDriverRead_HeaderSizeCheckFrame) {
     }
     ASSERT_TRUE(ret);
 }
+
+TEST(NI9157CircularFifoReaderGTest,TestDriverRead_MaxPacketsPerRead) {
+    NI9157CircularFifoReaderTest test;
+    bool ret = true;
+    for (uint32 idx = 0; idx < nDevices; idx++) {
+        if(testAllRetTrue) {
+            ret &= test.TestDriverRead_MaxPacketsPerRead(idx);
+        }
+        else {
+            ret = test.TestDriverRead_MaxPacketsPerRead(idx);
+            if (ret) {
+                break;
+            }
+        }
+    }
+    ASSERT_TRUE(ret);
+}
@@ -2922,3 +2922,106 @@ bool NI9157CircularFifoReaderTest::TestDriverRead_HeaderSizeCheckFrame(uint32 mo
     ObjectRegistryDatabase::Instance()->Purge();
     return ret;
 }
+
+bool NI9157CircularFifoReaderTest::TestDriverRead_MaxPacketsPerRead(uint32 model) {
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream = multiIOConfig6;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ret = parser.Parse();
+
+    StreamString pathAndFile = "";
+    if (ret) {
+        ret = cdb.MoveAbsolute("+NiDevice");
+        ret &= cdb.Write("NiRioDeviceName", multiIOFirmware[nParams*model + 0]);
+        pathAndFile.Printf("%s/%s", firmwarePath, multiIOFirmware[nParams*model + 1]);
+        ret &= cdb.Write("NiRioGenFile", pathAndFile.Buffer());
+        ret &= cdb.Write("NiRioGenSignature", multiIOFirmware[nParams*model + 2]);
+        ret &= cdb.MoveToRoot();
+    }
+    if (ret) {
+        ret = cdb.MoveAbsolute("$Application1.+Data.+Drv1");
+        ret &= cdb.Write("MaxPacketsPerRead", "8");
+        ret &= cdb.MoveToRoot();
+    }
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ret) {
+        god->Purge();
+        ret = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ret) {
+        application = god->Find("Application1");
+        ret = application.IsValid();
+    }
+    if (ret) {
+        ret = application->ConfigureApplication();
+    }
+    ReferenceT < NI9157CircularFifoReaderTestDS > dataSource;
+    ReferenceT < NI9157CircularFifoReaderTestGAM2 > gam;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        ret = (dataSource->GetNiDeviceOperator() != NULL_PTR(NI9157DeviceOperatorTI *));
+    }
+    ReferenceContainer inputBrokers;
+    if (ret) {
+        ret = gam->GetInputBrokers(inputBrokers);
+    }
+    ReferenceT < MemoryMapSynchronisedMultiBufferInputBroker > brokerSync;
+    if (ret) {
+        brokerSync = inputBrokers.Get(0);
+        ret = brokerSync.IsValid();
+    }
+    if (ret) {
+        ret = dataSource->PrepareNextState("State1", "State1");
+    }
+    Sleep::MSec(100);
+    if (ret) {
+        ErrorManagement::ErrorType err;
+        err = dataSource->StopAcquisition();
+        ret = err.ErrorsCleared();
+    }
+    Sleep::MSec(100);
+    if (ret) {
+        ErrorManagement::ErrorType err;
+        err = dataSource->StartAcquisition();
+        ret = err.ErrorsCleared();
+    }
+    Sleep::MSec(100);
+    if (ret) {
+        uint32 numberOfReads = 8u;
+        uint32 numberOfValues = 2000u;
+        uint64* mem = (uint64*) gam->GetOutputMemoryBuffer();
+        uint64 counterStore = 0ull;
+        for (uint32 i = 0u; (i < numberOfReads) && (ret); i++) {
+            brokerSync->Execute();
+            gam->Execute();
+            for (uint32 j = 0u; (j < numberOfValues) && (ret); j++) {
+                if (j > 0) { 
+                    ret = ((mem[j] - counterStore) == 1u);
+                    if (!ret) {
+                        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed at mem[%u]=%u != mem[%u]=%u + 1", j , static_cast<uint32>(mem[j]), j-1, static_cast<uint32>(counterStore));
+                    }
+                }
+                counterStore = mem[j];
+            }
+        }
+        Sleep::MSec(100);
+        ErrorManagement::ErrorType err;
+        err = dataSource->StopAcquisition();
+        ret &= err.ErrorsCleared();
+    }
+
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
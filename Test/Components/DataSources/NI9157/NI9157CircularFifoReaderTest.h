@@ -309,6 +309,12 @@ public:
      */
     bool TestDriverRead_HeaderSizeCheckFrame(uint32 model);
 
+    /**
+     * @brief Tests the NI9157CircularFifoReaderTest::DriverRead method
+     * reading the FIFO in batches of up to MaxPacketsPerRead = 8 packets.
+     */
+    bool TestDriverRead_MaxPacketsPerRead(uint32 model);
+
 };
 
 /*---------------------------------------------------------------------------*/
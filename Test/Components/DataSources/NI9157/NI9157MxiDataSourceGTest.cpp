@@ -238,6 +238,23 @@ TEST(NI9157MxiDataSourceGTest,TestSynchronise_FIFOs) {
     ASSERT_TRUE(ret);
 }
 
+TEST(NI9157MxiDataSourceGTest,TestSynchronise_PrefetchReads) {
+    NI9157MxiDataSourceTest test;
+    bool ret = true;
+    for (uint32 idx = 0; idx < nDevices; idx++) {
+        if(testAllRetTrue) {
+            ret &= test.TestSynchronise_PrefetchReads(idx);
+        }
+        else {
+            ret = test.TestSynchronise_PrefetchReads(idx);
+            if (ret) {
+                break;
+            }
+        }
+    }
+    ASSERT_TRUE(ret);
+}
+
 TEST(NI9157MxiDataSourceGTest,TestSynchronise_InitialPatterns) {
     NI9157MxiDataSourceTest test;
     bool ret = true;
@@ -1029,6 +1029,131 @@ bool NI9157MxiDataSourceTest::TestSynchronise_FIFOs(uint32 model) {
     return ret;
 }
 
+bool NI9157MxiDataSourceTest::TestSynchronise_PrefetchReads(uint32 model) {
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream =  multiIOConfig3;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ret = parser.Parse();
+
+    StreamString pathAndFile = "";
+    if (ret) {
+        ret = cdb.MoveAbsolute("+NiDevice");
+        ret &= cdb.Write("NiRioDeviceName", multiIOFirmware[nParams*model + 0]);
+        pathAndFile.Printf("%s/%s", firmwarePath, multiIOFirmware[nParams*model + 1]);
+        ret &= cdb.Write("NiRioGenFile", pathAndFile.Buffer());
+        ret &= cdb.Write("NiRioGenSignature", multiIOFirmware[nParams*model + 2]);
+        ret &= cdb.MoveAbsolute("$Application1.+Data.+Drv1");
+        ret &= cdb.Write("PrefetchReads", 1);
+        ret &= cdb.MoveToRoot();
+    }
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ret) {
+        god->Purge();
+        ret = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ret) {
+        application = god->Find("Application1");
+        ret = application.IsValid();
+    }
+    if (ret) {
+        ret = application->ConfigureApplication();
+    }
+    ReferenceT<NI9157MxiDataSourceTestDS> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        ret = dataSource->PrepareNextState("State1", "State1");
+    }
+    ReferenceT < NI9157MxiDataSourceTestGAM2 > gam1;
+    if (ret) {
+        gam1 = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam1.IsValid();
+    }
+    ReferenceT<IOGAM> gam2;
+    if (ret) {
+        gam2 = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMB");
+        ret = gam2.IsValid();
+    }
+    ReferenceT < MemoryMapSynchronisedInputBroker > brokerSync;
+    ReferenceT < MemoryMapOutputBroker > brokerOut1;
+    ReferenceT < MemoryMapInputBroker > brokerIn2;
+    ReferenceT < MemoryMapOutputBroker > brokerOut2;
+    if (ret) {
+        ReferenceContainer inputBrokers1, outputBrokers1, inputBrokers2, outputBrokers2;
+        ret = gam1->GetInputBrokers(inputBrokers1);
+        if (ret) {
+            ret = gam1->GetOutputBrokers(outputBrokers1);
+        }
+        if (ret) {
+            ret = gam2->GetInputBrokers(inputBrokers2);
+        }
+        if (ret) {
+            ret = gam2->GetOutputBrokers(outputBrokers2);
+        }
+        if (ret) {
+            brokerSync = inputBrokers1.Get(0);
+            ret = brokerSync.IsValid();
+        }
+        if (ret) {
+            brokerOut1 = outputBrokers1.Get(0);
+            ret = brokerOut1.IsValid();
+        }
+        if (ret) {
+            brokerIn2 = inputBrokers2.Get(0);
+            ret = brokerIn2.IsValid();
+        }
+        if (ret) {
+            brokerOut2 = outputBrokers2.Get(0);
+            ret = brokerOut2.IsValid();
+        }
+    }
+    if (ret) {
+        uint64 *mem = (uint64 *) gam1->GetOutputMemoryBuffer();
+        uint32 nReads = 1000;
+        for (uint32 i = 0u; (i < nReads) && (ret); i++) {
+            brokerSync->Execute();
+            gam1->Execute();
+            brokerOut1->Execute();
+            brokerIn2->Execute();
+            gam2->Execute();
+            brokerOut2->Execute();
+            if (ret) {
+                ret = (mem[0] == ((2000 * i) + 1));
+                if (!ret) {
+                    REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Error at mem[%u]=%u != %u", i, static_cast<uint32>(mem[0]), ((2000 * i) + 1));
+                }
+            }
+        }
+    }
+    if (ret) {
+        uint32 signalIdx = 0u;
+        ret = dataSource->GetSignalIndex(signalIdx, "FIFO1_U64_R");
+        NI9157MxiAccessStatistics stats;
+        if (ret) {
+            ret = dataSource->GetAccessStatistics(signalIdx, stats);
+        }
+        if (ret) {
+            ret = (stats.numberOfAccesses >= 1000u);
+        }
+        if (ret) {
+            ret = (stats.minTicks <= stats.maxTicks);
+        }
+        if (ret) {
+            ret = dataSource->ReportAccessStatistics().ErrorsCleared();
+        }
+    }
+
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
 bool NI9157MxiDataSourceTest::TestSynchronise_InitialPatterns(uint32 model) {
 
     HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
@@ -145,6 +145,12 @@ public:
      */
     bool TestSynchronise_FIFOs(uint32 model);
 
+    /**
+     * @brief Tests the NI9157MxiDataSource::Synchronise method for IO FIFOs
+     * with the read-only FIFO read by the helper thread.
+     */
+    bool TestSynchronise_PrefetchReads(uint32 model);
+
     /**
      * @brief Tests the NI9157MxiDataSource::Synchronise using initial patterns.
      */
@@ -49,3 +49,13 @@ TEST(NI9157MemoryOperationsHelperGTest,TestFlatToInterleaved) {
     NI9157MemoryOperationsHelperTest test;
     ASSERT_TRUE(test.TestFlatToInterleaved());
 }
+
+TEST(NI9157MemoryOperationsHelperGTest,TestGetCopyKernel) {
+    NI9157MemoryOperationsHelperTest test;
+    ASSERT_TRUE(test.TestGetCopyKernel());
+}
+
+TEST(NI9157MemoryOperationsHelperGTest,TestCopyKernels) {
+    NI9157MemoryOperationsHelperTest test;
+    ASSERT_TRUE(test.TestCopyKernels());
+}
@@ -143,3 +143,57 @@ bool NI9157MemoryOperationsHelperTest::TestFlatToInterleaved() {
 
     return ret;
 }
+
+bool NI9157MemoryOperationsHelperTest::TestGetCopyKernel() {
+
+    const uint32 smallSize = 64u;
+    const uint32 largeSize = NI9157MemoryOperationsHelper::NON_TEMPORAL_COPY_MIN_SIZE;
+    bool ret = (NI9157MemoryOperationsHelper::GetCopyKernel(1u, smallSize, false) == &NI9157MemoryOperationsHelper::CopyU8);
+    ret &= (NI9157MemoryOperationsHelper::GetCopyKernel(2u, smallSize, false) == &NI9157MemoryOperationsHelper::CopyU16);
+    ret &= (NI9157MemoryOperationsHelper::GetCopyKernel(4u, smallSize, false) == &NI9157MemoryOperationsHelper::CopyU32);
+    ret &= (NI9157MemoryOperationsHelper::GetCopyKernel(8u, smallSize, false) == &NI9157MemoryOperationsHelper::CopyU64);
+    ret &= (NI9157MemoryOperationsHelper::GetCopyKernel(3u, smallSize, false) == &NI9157MemoryOperationsHelper::CopyU8);
+    ret &= (NI9157MemoryOperationsHelper::GetCopyKernel(8u, smallSize, true) == &NI9157MemoryOperationsHelper::CopyU64);
+    ret &= (NI9157MemoryOperationsHelper::GetCopyKernel(8u, largeSize, true) == &NI9157MemoryOperationsHelper::CopyNonTemporal);
+    ret &= (NI9157MemoryOperationsHelper::GetCopyKernel(8u, largeSize, false) == &NI9157MemoryOperationsHelper::CopyU64);
+
+    return ret;
+}
+
+bool NI9157MemoryOperationsHelperTest::TestCopyKernels() {
+
+    const uint32 memSize = 8192u;
+    const uint32 nKernels = 5u;
+    NI9157MemoryOperationsHelper::CopyKernel kernels[] = { &NI9157MemoryOperationsHelper::CopyU8, &NI9157MemoryOperationsHelper::CopyU16,
+            &NI9157MemoryOperationsHelper::CopyU32, &NI9157MemoryOperationsHelper::CopyU64, &NI9157MemoryOperationsHelper::CopyNonTemporal };
+    uint64 srcMem[memSize / 8u];
+    uint64 destMem[memSize / 8u];
+    uint8 *src = reinterpret_cast<uint8 *>(&srcMem[0]);
+    uint8 *dest = reinterpret_cast<uint8 *>(&destMem[0]);
+    for (uint32 i = 0u; i < memSize; i++) {
+        src[i] = static_cast<uint8>((i * 7u) + 1u);
+    }
+    const uint32 sizes[] = { 0u, 1u, 15u, 64u, 1000u, 5003u };
+    const uint32 offsets[] = { 0u, 1u, 8u };
+    bool ret = true;
+    for (uint32 k = 0u; (k < nKernels) && (ret); k++) {
+        for (uint32 s = 0u; (s < 6u) && (ret); s++) {
+            for (uint32 o = 0u; (o < 3u) && (ret); o++) {
+                uint32 offset = offsets[o];
+                uint32 size = sizes[s];
+                for (uint32 i = 0u; i < memSize; i++) {
+                    dest[i] = 0u;
+                }
+                kernels[k](&dest[offset], &src[offset], size);
+                for (uint32 i = 0u; (i < size) && (ret); i++) {
+                    ret = (dest[offset + i] == src[offset + i]);
+                }
+                if (ret) {
+                    ret = (dest[offset + size] == 0u);
+                }
+            }
+        }
+    }
+
+    return ret;
+}
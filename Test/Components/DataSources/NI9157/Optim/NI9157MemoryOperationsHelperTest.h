@@ -70,6 +70,18 @@ public:
      */
     bool TestFlatToInterleaved();
 
+    /**
+     * @brief Tests that NI9157MemoryOperationsHelper::GetCopyKernel selects
+     * the kernel by element size, block size and the non-temporal flag.
+     */
+    bool TestGetCopyKernel();
+
+    /**
+     * @brief Tests that all the copy kernels copy exactly the requested bytes
+     * for aligned and unaligned memories.
+     */
+    bool TestCopyKernels();
+
 };
 
 /*---------------------------------------------------------------------------*/
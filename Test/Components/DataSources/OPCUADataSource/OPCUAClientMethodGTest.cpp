@@ -90,4 +90,9 @@ TEST(OPCUAClientMethodGTest,Test_MethodCall) {
     OPCUAClientMethodTest test;
     ASSERT_TRUE(test.Test_MethodCall());
 }
+
+TEST(OPCUAClientMethodGTest,Test_MethodCallAsync) {
+    OPCUAClientMethodTest test;
+    ASSERT_TRUE(test.Test_MethodCallAsync());
+}
 	
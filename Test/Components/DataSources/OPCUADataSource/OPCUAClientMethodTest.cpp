@@ -442,3 +442,139 @@ ObjectRegistryDatabase::Instance()->Purge();
 return ok;
 }
 
+bool OPCUAClientMethodTest::Test_MethodCallAsync() {
+using namespace MARTe;
+OPCUATestServer ots;
+ots.service.Start();
+StreamString config = ""
+	"+OPCUATypes = {"
+	"    Class = ReferenceContainer"
+	"    +Point = {"
+	"        Class = IntrospectionStructure"
+	"        x = {"
+	"            Type = float32"
+	"            NumberOfElements = 1"
+	"        }"
+	"        y = {"
+	"            Type = float32"
+	"            NumberOfElements = 1"
+	"        }"
+	"        z = {"
+	"            Type = float32"
+	"            NumberOfElements = 1"
+	"        }"
+	"    }"
+	"}"
+	"+MessageClient = {"
+	"    Class = OPCUA::OPCUAMessageClient"
+	"    Address = \"opc.tcp://127.0.0.1:4840\""
+	"    CallMode = \"AsyncCall\""
+	"    MaxCallsInFlight = 2"
+	"    Method = {"
+	"        NamespaceIndex = 1"
+	"        Path = Test_Object.UpdatePoint"
+	"    }"
+	"    Structure = {"
+	"        Point = {"
+	"            NamespaceIndex = 1"
+	"            Path = Point"
+	"            NumberOfElements = 1"
+	"            Type = Point"
+	"        }"
+	"    }"
+	"}";
+config.Seek(0LLU);
+ConfigurationDatabase cdb;
+StandardParser parser(config, cdb, NULL);
+bool ok = parser.Parse();
+cdb.MoveToRoot();
+ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+if (ok) {
+ok = ord->Initialise(cdb);
+}
+if (ok) {
+ReferenceT<OPCUAMessageClient> omc;
+omc = ord->Find("MessageClient");
+ok = omc.IsValid();
+if (ok) {
+	OPCUAClientMethod *ocm = omc->GetOPCUAClient();
+	void *dataPtr = ocm->GetDataPtr();
+	uint8 *tempDataPtr = reinterpret_cast<uint8*>(dataPtr);
+	ok = (ocm->GetMaxCallsInFlight() == 2u);
+	float32 x = 4.0;
+	float32 y = 5.0;
+	float32 z = 6.0;
+	if (ok) {
+		ok = MemoryOperationsHelper::Copy(tempDataPtr, &x, sizeof(float32));
+	}
+	if (ok) {
+		tempDataPtr = &(tempDataPtr[sizeof(float32)]);
+		ok = MemoryOperationsHelper::Copy(tempDataPtr, &y, sizeof(float32));
+	}
+	if (ok) {
+		tempDataPtr = &(tempDataPtr[sizeof(float32)]);
+		ok = MemoryOperationsHelper::Copy(tempDataPtr, &z, sizeof(float32));
+	}
+	/* The same value is sent by a burst of pipelined calls */
+	for (uint32 n = 0u; (n < 5u) && (ok); n++) {
+		ok = ocm->MethodCallAsync(1000u);
+		if (ok) {
+			ok = (ocm->GetNumberOfCallsInFlight() <= 2u);
+		}
+	}
+	if (ok) {
+		ok = ocm->WaitForCalls(1000u);
+	}
+	if (ok) {
+		ok = (ocm->GetNumberOfCalls() == 5u);
+	}
+	if (ok) {
+		ok = (ocm->GetNumberOfCallsInFlight() == 0u);
+	}
+	if (ok) {
+		ok = (ocm->GetMaxCallLatency() > 0.0);
+	}
+	if (ok) {
+		ok = (ocm->GetMeanCallLatency() <= ocm->GetMaxCallLatency());
+	}
+	if (ok) {
+		UA_DataType types[1u];
+		types[0u] = PointType;
+		UA_DataTypeArray customDataTypes = { NULL, 1, types };
+		UA_Client *client = UA_Client_new();
+		UA_ClientConfig *cc = UA_Client_getConfig(client);
+		UA_ClientConfig_setDefault(cc);
+		cc->customDataTypes = &customDataTypes;
+		UA_StatusCode retval = UA_Client_connect(client,
+				"opc.tcp://localhost:4840");
+		if (retval == UA_STATUSCODE_GOOD) {
+			UA_Variant value; /* Variants can hold scalar values and arrays of any type */
+			UA_Variant_init(&value);
+			UA_NodeId nodeId = UA_NODEID_STRING(1u, const_cast<char8*>("Point"));
+			retval = UA_Client_readValueAttribute(client, nodeId, &value);
+
+			if (retval == UA_STATUSCODE_GOOD) {
+				Point *p = (Point*) value.data;
+				ok = (p->x == 4.0);
+				if (ok) {
+					ok = (p->y == 5.0);
+				}
+				if (ok) {
+					ok = (p->z == 6.0);
+				}
+			} else {
+				ok = false;
+			}
+		}
+		else {
+			ok = false;
+		}
+	}
+}
+}
+ots.SetRunning(false);
+ots.service.Stop();
+ObjectRegistryDatabase::Instance()->Purge();
+return ok;
+}
+
@@ -80,6 +80,8 @@ public:
 
     bool Test_MethodCall();
 
+    bool Test_MethodCallAsync();
+
 private:
     class OPCUATestServer: public MARTe::EmbeddedServiceMethodBinderI {
     public:
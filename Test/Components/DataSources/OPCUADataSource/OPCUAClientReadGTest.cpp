@@ -50,6 +50,11 @@ TEST(OPCUAClientReadGTest,Test_SetServiceRequest) {
     ASSERT_TRUE(test.Test_SetServiceRequest());
 }
 
+TEST(OPCUAClientReadGTest,Test_SetServiceRequest_NodeIdCache) {
+    OPCUAClientReadTest test;
+    ASSERT_TRUE(test.Test_SetServiceRequest_NodeIdCache());
+}
+
 TEST(OPCUAClientReadGTest,Test_GetExtensionObjectByteString) {
     OPCUAClientReadTest test;
     ASSERT_TRUE(test.Test_GetExtensionObjectByteString());
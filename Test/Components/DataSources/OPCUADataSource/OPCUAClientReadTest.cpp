@@ -32,6 +32,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "ConfigurationDatabase.h"
+#include "Directory.h"
 #include "ObjectRegistryDatabase.h"
 #include "StandardParser.h"
 #include "OPCUAClientRead.h"
@@ -89,6 +90,76 @@ bool OPCUAClientReadTest::Test_SetServiceRequest() {
     return ok;
 }
 
+bool OPCUAClientReadTest::Test_SetServiceRequest_NodeIdCache() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+ServerTest = {"
+            "     Class = OPCUA::OPCUAServer"
+            "     AddressSpace = {"
+            "         MyNode1 = {"
+            "             Type = uint8"
+            "         }"
+            "         MyNode2 = {"
+            "             Type = uint16"
+            "         }"
+            "         MyNode3 = {"
+            "             Type = uint32"
+            "         }"
+            "     }"
+            "}";
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    const char8 * const cacheFileName = "OPCUAClientReadTest_NodeIds.cache";
+    Directory toDelete(cacheFileName);
+    (void) toDelete.Delete();
+    const uint32 nOfNodes = 3u;
+    StreamString paths[nOfNodes];
+    paths[0u] = "MyNode1";
+    paths[1u] = "MyNode2";
+    paths[2u] = "MyNode3";
+    uint16 ns[nOfNodes] = { 1u, 1u, 1u };
+    //The first client translates the paths (in two requests) and writes the cache
+    OPCUAClientRead ocr1;
+    ocr1.SetServerAddress("opc.tcp://localhost:4840");
+    ocr1.SetNodeIdCacheFile(cacheFileName);
+    ocr1.SetTranslateBatchSize(2u);
+    if (ok) {
+        ok = ocr1.Connect();
+    }
+    Sleep::MSec(200);
+    if (ok) {
+        ok = ocr1.SetServiceRequest(&ns[0], &paths[0], nOfNodes);
+    }
+    if (ok) {
+        Directory cacheFile(cacheFileName);
+        ok = cacheFile.Exists();
+    }
+    //The second client loads the NodeIds from the cache
+    OPCUAClientRead ocr2;
+    ocr2.SetServerAddress("opc.tcp://localhost:4840");
+    ocr2.SetNodeIdCacheFile(cacheFileName);
+    if (ok) {
+        ok = ocr2.Connect();
+    }
+    Sleep::MSec(200);
+    if (ok) {
+        ok = ocr2.SetServiceRequest(&ns[0], &paths[0], nOfNodes);
+    }
+    for (uint32 i = 0u; (i < nOfNodes) && (ok); i++) {
+        ok = UA_NodeId_equal(&(ocr1.GetMonitoredNodes()[i]), &(ocr2.GetMonitoredNodes()[i]));
+    }
+    (void) toDelete.Delete();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
 bool OPCUAClientReadTest::Test_GetExtensionObjectByteString() {
     using namespace MARTe;
     OPCUATestServer ots;
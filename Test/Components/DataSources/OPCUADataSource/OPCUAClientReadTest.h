@@ -49,6 +49,8 @@ public:
 
     bool Test_SetServiceRequest();
 
+    bool Test_SetServiceRequest_NodeIdCache();
+
     bool Test_GetExtensionObjectByteString();
 
     bool Test_Read_Single();
@@ -66,6 +66,11 @@ TEST(OPCUADSInputGTest,TestSynchronise_Default) {
     ASSERT_TRUE(test.TestSynchronise_Default());
 }
 
+TEST(OPCUADSInputGTest,TestSynchronise_AsyncRead) {
+    OPCUADSInputTest test;
+    ASSERT_TRUE(test.TestSynchronise_AsyncRead());
+}
+
 TEST(OPCUADSInputGTest,TestSynchronise_Monitor) {
     OPCUADSInputTest test;
     ASSERT_TRUE(test.TestSynchronise_Monitor());
@@ -611,6 +611,156 @@ bool OPCUADSInputTest::TestSynchronise_Default() {
     return ok;
 }
 
+bool OPCUADSInputTest::TestSynchronise_AsyncRead() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+ServerTest = {"
+            "     Class = OPCUA::OPCUAServer"
+            "     Port = 4840"
+            "     AddressSpace = {"
+            "         MyNode = {"
+            "             Type = uint32"
+            "         }"
+            "     }"
+            "}"
+            "$Test = {\n"
+            "    Class = RealTimeApplication\n"
+            "    +Functions = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +GAMTimer = {\n"
+            "            Class = IOGAM\n"
+            "            InputSignals = {\n"
+            "                Counter = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = Timer\n"
+            "                }\n"
+            "                Time = {\n"
+            "                    Frequency = 1\n"
+            "                    Type = uint32\n"
+            "                    DataSource = Timer\n"
+            "                }\n"
+            "            }\n"
+            "            OutputSignals = {\n"
+            "                Counter = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = DDB1\n"
+            "                }\n"
+            "                Time = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = DDB1\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "        +GAMDisplay = {\n"
+            "            Class = IOGAM\n"
+            "            InputSignals = {\n"
+            "                MyNode = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = OPCUA\n"
+            "                }\n"
+            "            }\n"
+            "            OutputSignals = {\n"
+            "                MyNode = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = DDB1\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Data = {\n"
+            "        Class = ReferenceContainer\n"
+            "        DefaultDataSource = DDB1\n"
+            "    +DDB1 = {\n"
+            "      Class = GAMDataSource\n"
+            "    }\n"
+            "        +Timings = {\n"
+            "            Class = TimingDataSource\n"
+            "        }\n"
+            "        +OPCUA = {\n"
+            "            Class = OPCUADataSource::OPCUADSInput\n"
+            "            Address = \"opc.tcp://localhost.localdomain:4840\""
+            "            Synchronise = \"yes\""
+            "            ReadMode = \"AsyncRead\""
+            "            MaxReadsInFlight = 3"
+            "            Signals = {\n"
+            "                MyNode = {\n"
+            "                    NamespaceIndex = 1\n"
+            "                    Path = MyNode\n"
+            "                    Type = uint32\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    +Timer = {\n"
+            "      Class = LinuxTimer\n"
+            "      SleepNature = \"Default\"\n"
+            "      Signals = {\n"
+            "        Counter = {\n"
+            "          Type = uint32\n"
+            "        }\n"
+            "        Time = {\n"
+            "          Type = uint32\n"
+            "        }\n"
+            "      }\n"
+            "    }\n"
+            "    }\n"
+            "    +States = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +State1 = {\n"
+            "            Class = RealTimeState\n"
+            "            +Threads = {\n"
+            "                Class = ReferenceContainer\n"
+            "                +Thread1 = {\n"
+            "                    Class = RealTimeThread\n"
+            "                    Functions = {GAMTimer GAMDisplay}\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Scheduler = {\n"
+            "        Class = GAMScheduler\n"
+            "        TimingDataSource = Timings\n"
+            "    }\n"
+            "}\n";
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    Sleep::MSec(200);
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ord->Find("Test");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ReferenceT<OPCUADSInput> opcuaDS;
+    if (ok) {
+        opcuaDS = ord->Find("Test.Data.OPCUA");
+        ok = opcuaDS.IsValid();
+    }
+    if (ok) {
+        ok = (opcuaDS->GetOPCUAClient()->GetMaxReadsInFlight() == 3u);
+    }
+    for (uint32 n = 0u; (n < 50u) && (ok); n++) {
+        ok = opcuaDS->Synchronise();
+        if (ok) {
+            ok = (opcuaDS->GetOPCUAClient()->GetNumberOfReadsInFlight() <= 3u);
+        }
+        Sleep::MSec(10);
+    }
+    if (ok) {
+        ok = (opcuaDS->GetOPCUAClient()->GetNumberOfReadResponses() > 0u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
 bool OPCUADSInputTest::TestSynchronise_Monitor() {
     using namespace MARTe;
     StreamString config = ""
@@ -66,6 +66,11 @@ public:
      */
     bool TestSynchronise_Default();
 
+    /**
+     * @brief Tests the Synchronise method with Sync option enabled and ReadMode = AsyncRead.
+     */
+    bool TestSynchronise_AsyncRead();
+
     /**
      * @brief Tests the Synchronise method with Sync option and MonitoredItem service enabled.
      */
@@ -92,6 +92,16 @@ TEST(OPCUADSOutputGTest,Test_SetConfiguredDatabase_ExtensionObject) {
     OPCUADSOutputTest test;
     ASSERT_TRUE(test.Test_SetConfiguredDatabase_ExtensionObject());
 }
+
+TEST(OPCUADSOutputGTest,TestSynchronise_AsyncWrite) {
+    OPCUADSOutputTest test;
+    ASSERT_TRUE(test.TestSynchronise_AsyncWrite());
+}
+
+TEST(OPCUADSOutputGTest,TestInitialise_False_WriteMode) {
+    OPCUADSOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_False_WriteMode());
+}
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -1301,5 +1301,176 @@ bool OPCUADSOutputTest::Test_SetConfiguredDatabase_ExtensionObject() {
     return ok;
 }
 
+bool OPCUADSOutputTest::TestSynchronise_AsyncWrite() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+ServerTest = {"
+            "     Class = OPCUA::OPCUAServer"
+            "     Port = 4840"
+            "     AddressSpace = {"
+            "         MyNode = {"
+            "             Type = uint32"
+            "         }"
+            "     }"
+            "}"
+            "$Test = {\n"
+            "    Class = RealTimeApplication\n"
+            "    +Functions = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +GAMTimer = {\n"
+            "            Class = IOGAM\n"
+            "            InputSignals = {\n"
+            "                Counter = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = Timer\n"
+            "                }\n"
+            "                Time = {\n"
+            "                    Frequency = 1\n"
+            "                    Type = uint32\n"
+            "                    DataSource = Timer\n"
+            "                }\n"
+            "            }\n"
+            "            OutputSignals = {\n"
+            "                Counter = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = DDB1\n"
+            "                }\n"
+            "                Time = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = DDB1\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "        +GAMDisplay = {\n"
+            "            Class = IOGAM\n"
+            "            InputSignals = {\n"
+            "                Counter = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = DDB1\n"
+            "                }\n"
+            "            }\n"
+            "            OutputSignals = {\n"
+            "                MyNode = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = OPCUAOut\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Data = {\n"
+            "        Class = ReferenceContainer\n"
+            "        DefaultDataSource = DDB1\n"
+            "    +DDB1 = {\n"
+            "      Class = GAMDataSource\n"
+            "    }\n"
+            "        +Timings = {\n"
+            "            Class = TimingDataSource\n"
+            "        }\n"
+            "        +OPCUAOut = {\n"
+            "            Class = OPCUADataSource::OPCUADSOutput\n"
+            "            Address = \"opc.tcp://localhost.localdomain:4840\"\n"
+            "            WriteMode = \"AsyncWrite\"\n"
+            "            MaxWritesInFlight = 3\n"
+            "            Signals = {\n"
+            "                MyNode = {\n"
+            "                    NamespaceIndex = 1\n"
+            "                    Path = MyNode\n"
+            "                    Type = uint32\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    +Timer = {\n"
+            "      Class = LinuxTimer\n"
+            "      SleepNature = \"Default\"\n"
+            "      Signals = {\n"
+            "        Counter = {\n"
+            "          Type = uint32\n"
+            "        }\n"
+            "        Time = {\n"
+            "          Type = uint32\n"
+            "        }\n"
+            "      }\n"
+            "    }\n"
+            "    }\n"
+            "    +States = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +State1 = {\n"
+            "            Class = RealTimeState\n"
+            "            +Threads = {\n"
+            "                Class = ReferenceContainer\n"
+            "                +Thread1 = {\n"
+            "                    Class = RealTimeThread\n"
+            "                    Functions = {GAMTimer GAMDisplay}\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Scheduler = {\n"
+            "        Class = GAMScheduler\n"
+            "        TimingDataSource = Timings\n"
+            "    }\n"
+            "}\n";
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    Sleep::MSec(200);
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ord->Find("Test");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ReferenceT<OPCUADSOutput> opcuaDS;
+    if (ok) {
+        opcuaDS = ord->Find("Test.Data.OPCUAOut");
+        ok = opcuaDS.IsValid();
+    }
+    if (ok) {
+        ok = (opcuaDS->GetOPCUAClient()->GetMaxWritesInFlight() == 3u);
+    }
+    /* The value does not change: only the first write is sent */
+    for (uint32 n = 0u; (n < 50u) && (ok); n++) {
+        ok = opcuaDS->Synchronise();
+        if (ok) {
+            ok = (opcuaDS->GetOPCUAClient()->GetNumberOfWritesInFlight() <= 3u);
+        }
+        Sleep::MSec(10);
+    }
+    if (ok) {
+        ok = (opcuaDS->GetOPCUAClient()->GetNumberOfWrites() == 1u);
+    }
+    if (ok) {
+        ok = (opcuaDS->GetOPCUAClient()->GetNumberOfSkippedWrites() == 49u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
 
+bool OPCUADSOutputTest::TestInitialise_False_WriteMode() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("Address", "opc.tcp://localhost.localdomain:4840");
+    if (ok) {
+        ok = cdb.Write("WriteMode", "Monitor");
+    }
+    if (ok) {
+        ok = cdb.CreateAbsolute("Signals");
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    OPCUADSOutput opcuaDS;
+    if (ok) {
+        ok = !opcuaDS.Initialise(cdb);
+    }
+    return ok;
+}
 
@@ -96,6 +96,16 @@ public:
      */
     bool Test_SetConfiguredDatabase_ExtensionObject();
 
+    /**
+     * @brief Tests the Synchronise method with WriteMode = "AsyncWrite" and an unchanged value.
+     */
+    bool TestSynchronise_AsyncWrite();
+
+    /**
+     * @brief Tests the Initialise method with an unsupported WriteMode.
+     */
+    bool TestInitialise_False_WriteMode();
+
 };
 
 /*---------------------------------------------------------------------------*/
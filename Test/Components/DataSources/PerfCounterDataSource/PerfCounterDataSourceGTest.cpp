@@ -0,0 +1,89 @@
+/**
+ * @file PerfCounterDataSourceGTest.cpp
+ * @brief Source file for class PerfCounterDataSourceGTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PerfCounterDataSourceGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "PerfCounterDataSourceTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(PerfCounterDataSourceGTest,TestConstructor) {
+    PerfCounterDataSourceTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(PerfCounterDataSourceGTest,TestInitialise) {
+    PerfCounterDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(PerfCounterDataSourceGTest,TestInitialise_False) {
+    PerfCounterDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False());
+}
+
+TEST(PerfCounterDataSourceGTest,TestGetBrokerName) {
+    PerfCounterDataSourceTest test;
+    ASSERT_TRUE(test.TestGetBrokerName());
+}
+
+TEST(PerfCounterDataSourceGTest,TestSetConfiguredDatabase) {
+    PerfCounterDataSourceTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase());
+}
+
+TEST(PerfCounterDataSourceGTest,TestSetConfiguredDatabase_False_Type) {
+    PerfCounterDataSourceTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_Type());
+}
+
+TEST(PerfCounterDataSourceGTest,TestSetConfiguredDatabase_False_NumberOfElements) {
+    PerfCounterDataSourceTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_NumberOfElements());
+}
+
+TEST(PerfCounterDataSourceGTest,TestSetConfiguredDatabase_False_Event) {
+    PerfCounterDataSourceTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_Event());
+}
+
+TEST(PerfCounterDataSourceGTest,TestSynchronise) {
+    PerfCounterDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise());
+}
+
+TEST(PerfCounterDataSourceGTest,TestPrepareNextState) {
+    PerfCounterDataSourceTest test;
+    ASSERT_TRUE(test.TestPrepareNextState());
+}
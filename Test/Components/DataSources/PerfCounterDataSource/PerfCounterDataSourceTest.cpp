@@ -0,0 +1,350 @@
+/**
+ * @file PerfCounterDataSourceTest.cpp
+ * @brief Source file for class PerfCounterDataSourceTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PerfCounterDataSourceTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "GAM.h"
+#include "ObjectRegistryDatabase.h"
+#include "PerfCounterDataSourceTest.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class PerfCounterDataSourceTestGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    virtual bool Setup();
+
+    virtual bool Execute();
+};
+
+bool PerfCounterDataSourceTestGAM::Setup() {
+    return true;
+}
+
+bool PerfCounterDataSourceTestGAM::Execute() {
+    return true;
+}
+
+CLASS_REGISTER(PerfCounterDataSourceTestGAM, "1.0")
+
+/**
+ * @brief Configures an application where a PerfCounterDataSourceTestGAM (GAMA) reads the signals of a PerfCounterDataSource
+ * (Drv1) with the parameters in dataSourceConfig and the GAM input signals in signalsConfig.
+ */
+static bool InitialisePerfCounterApplication(const char8 * const dataSourceConfig,
+                                             const char8 * const signalsConfig) {
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = PerfCounterDataSourceTestGAM"
+            "            InputSignals = {";
+    config += signalsConfig;
+    config += ""
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = PerfCounterDataSource";
+    config += dataSourceConfig;
+    config += ""
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    config.Seek(0);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT < RealTimeApplication > application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * The DataSource configuration with software events only (which are available without a performance monitoring unit).
+ */
+static const char8 * const perfCounterDataSourceConfig = ""
+        "            Signals = {"
+        "                Switches = {"
+        "                    Type = uint64"
+        "                    Event = ContextSwitches"
+        "                }"
+        "            }";
+
+/**
+ * The GAM input signals with software events only.
+ */
+static const char8 * const perfCounterSignalsConfig = ""
+        "                TaskClock = {"
+        "                    DataSource = Drv1"
+        "                    Type = uint64"
+        "                }"
+        "                PageFaults = {"
+        "                    DataSource = Drv1"
+        "                    Type = uint64"
+        "                }"
+        "                Switches = {"
+        "                    DataSource = Drv1"
+        "                    Type = uint64"
+        "                }";
+
+/**
+ * @brief Configures the application with perfCounterDataSourceConfig and perfCounterSignalsConfig and gets the DataSource.
+ */
+static bool GetPerfCounterDataSource(ReferenceT<PerfCounterDataSource> &dataSource) {
+    bool ok = InitialisePerfCounterApplication(perfCounterDataSourceConfig, perfCounterSignalsConfig);
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ok = dataSource.IsValid();
+    }
+    return ok;
+}
+
+/**
+ * @brief Keeps the CPU busy for a while.
+ */
+static void PerfCounterDataSourceTestBusyLoop() {
+    volatile float64 sum = 0.;
+    for (uint32 i = 0u; i < 1000000u; i++) {
+        sum += static_cast<float64>(i);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+PerfCounterDataSourceTest::PerfCounterDataSourceTest() {
+}
+
+PerfCounterDataSourceTest::~PerfCounterDataSourceTest() {
+}
+
+bool PerfCounterDataSourceTest::TestConstructor() {
+    PerfCounterDataSource dataSource;
+    bool ret = dataSource.IsExcludeKernel();
+    ret &= !dataSource.IsUserSpaceRead(0u);
+    return ret;
+}
+
+bool PerfCounterDataSourceTest::TestInitialise() {
+    ConfigurationDatabase cdb;
+    bool ret = cdb.Write("ExcludeKernel", 0u);
+    PerfCounterDataSource dataSource;
+    if (ret) {
+        ret = dataSource.Initialise(cdb);
+    }
+    if (ret) {
+        ret = !dataSource.IsExcludeKernel();
+    }
+    return ret;
+}
+
+bool PerfCounterDataSourceTest::TestInitialise_False() {
+    ConfigurationDatabase cdb;
+    bool ret = cdb.Write("ExcludeKernel", 2u);
+    PerfCounterDataSource dataSource;
+    if (ret) {
+        ret = !dataSource.Initialise(cdb);
+    }
+    return ret;
+}
+
+bool PerfCounterDataSourceTest::TestGetBrokerName() {
+    PerfCounterDataSource dataSource;
+    ConfigurationDatabase cdb;
+    StreamString brokerName = dataSource.GetBrokerName(cdb, InputSignals);
+    bool ret = (brokerName == "MemoryMapSynchronisedInputBroker");
+    if (ret) {
+        ret = (dataSource.GetBrokerName(cdb, OutputSignals) == NULL_PTR(const char8 *));
+    }
+    return ret;
+}
+
+bool PerfCounterDataSourceTest::TestSetConfiguredDatabase() {
+    ReferenceT<PerfCounterDataSource> dataSource;
+    bool ret = GetPerfCounterDataSource(dataSource);
+    if (ret) {
+        ret = (dataSource->GetNumberOfSignals() == 3u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool PerfCounterDataSourceTest::TestSetConfiguredDatabase_False_Type() {
+    const char8 * const signalsConfig = ""
+            "                TaskClock = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                }";
+    bool ret = !InitialisePerfCounterApplication("", signalsConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool PerfCounterDataSourceTest::TestSetConfiguredDatabase_False_NumberOfElements() {
+    const char8 * const signalsConfig = ""
+            "                TaskClock = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint64"
+            "                    NumberOfElements = 2"
+            "                }";
+    bool ret = !InitialisePerfCounterApplication("", signalsConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool PerfCounterDataSourceTest::TestSetConfiguredDatabase_False_Event() {
+    const char8 * const signalsConfig = ""
+            "                Clock = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint64"
+            "                }";
+    bool ret = !InitialisePerfCounterApplication("", signalsConfig);
+    if (ret) {
+        const char8 * const dataSourceConfig = ""
+                "            Signals = {"
+                "                Clock = {"
+                "                    Event = WallClock"
+                "                }"
+                "            }";
+        ret = !InitialisePerfCounterApplication(dataSourceConfig, signalsConfig);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool PerfCounterDataSourceTest::TestSynchronise() {
+    ReferenceT<PerfCounterDataSource> dataSource;
+    bool ret = GetPerfCounterDataSource(dataSource);
+    uint64 *taskClock = NULL_PTR(uint64 *);
+    if (ret) {
+        void *signalAddress = NULL_PTR(void *);
+        ret = dataSource->GetSignalMemoryBuffer(0u, 0u, signalAddress);
+        taskClock = static_cast<uint64 *>(signalAddress);
+    }
+    if (ret) {
+        *taskClock = 1u;
+        //The first call opens the counters
+        ret = dataSource->Synchronise();
+    }
+    if (ret) {
+        ret = (*taskClock == 0u);
+    }
+    if (ret) {
+        PerfCounterDataSourceTestBusyLoop();
+        ret = dataSource->Synchronise();
+    }
+    if (ret) {
+        ret = (*taskClock > 0u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool PerfCounterDataSourceTest::TestPrepareNextState() {
+    ReferenceT<PerfCounterDataSource> dataSource;
+    bool ret = GetPerfCounterDataSource(dataSource);
+    uint64 *taskClock = NULL_PTR(uint64 *);
+    if (ret) {
+        void *signalAddress = NULL_PTR(void *);
+        ret = dataSource->GetSignalMemoryBuffer(0u, 0u, signalAddress);
+        taskClock = static_cast<uint64 *>(signalAddress);
+    }
+    if (ret) {
+        ret = dataSource->Synchronise();
+    }
+    if (ret) {
+        PerfCounterDataSourceTestBusyLoop();
+        ret = dataSource->Synchronise();
+    }
+    if (ret) {
+        ret = (*taskClock > 0u);
+    }
+    if (ret) {
+        ret = dataSource->PrepareNextState("State1", "State1");
+    }
+    if (ret) {
+        //The counters are opened again
+        PerfCounterDataSourceTestBusyLoop();
+        ret = dataSource->Synchronise();
+    }
+    if (ret) {
+        ret = (*taskClock == 0u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
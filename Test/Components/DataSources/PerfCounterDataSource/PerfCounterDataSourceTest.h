@@ -0,0 +1,109 @@
+/**
+ * @file PerfCounterDataSourceTest.h
+ * @brief Header file for class PerfCounterDataSourceTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class PerfCounterDataSourceTest
+
+#ifndef PERFCOUNTERDATASOURCETEST_H_
+#define PERFCOUNTERDATASOURCETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "PerfCounterDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the PerfCounterDataSource methods
+ */
+class PerfCounterDataSourceTest {
+public:
+
+    /**
+     * @brief Constructor
+     */
+    PerfCounterDataSourceTest();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~PerfCounterDataSourceTest();
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails with ExcludeKernel > 1
+     */
+    bool TestInitialise_False();
+
+    /**
+     * @brief Tests the GetBrokerName method
+     */
+    bool TestGetBrokerName();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method
+     */
+    bool TestSetConfiguredDatabase();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if a signal is not uint64
+     */
+    bool TestSetConfiguredDatabase_False_Type();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if a signal has more than one element
+     */
+    bool TestSetConfiguredDatabase_False_NumberOfElements();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if a signal does not count a supported event
+     */
+    bool TestSetConfiguredDatabase_False_Event();
+
+    /**
+     * @brief Tests that the Synchronise method writes the number of events since the previous call
+     */
+    bool TestSynchronise();
+
+    /**
+     * @brief Tests that the PrepareNextState method closes the counters, so that they are opened again by the next Synchronise
+     */
+    bool TestPrepareNextState();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PERFCOUNTERDATASOURCETEST_H_ */
@@ -59,6 +59,16 @@ TEST(RealTimeThreadAsyncBridgeGTest,TestInitialise_False_GreaterNumberOfBuffers)
     ASSERT_TRUE(test.TestInitialise_False_GreaterNumberOfBuffers());
 }
 
+TEST(RealTimeThreadAsyncBridgeGTest,TestInitialise_NUMANode) {
+    RealTimeThreadAsyncBridgeTest test;
+    ASSERT_TRUE(test.TestInitialise_NUMANode());
+}
+
+TEST(RealTimeThreadAsyncBridgeGTest,TestInitialise_False_NUMANode) {
+    RealTimeThreadAsyncBridgeTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NUMANode());
+}
+
 TEST(RealTimeThreadAsyncBridgeGTest,TestSetConfiguredDatabase) {
     RealTimeThreadAsyncBridgeTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase());
@@ -144,9 +154,9 @@ TEST(RealTimeThreadAsyncBridgeGTest,TestTerminateWrite) {
     ASSERT_TRUE(test.TestTerminateWrite());
 }
 
-TEST(RealTimeThreadAsyncBridgeGTest,TestTerminateWrite_ResetCounter) {
+TEST(RealTimeThreadAsyncBridgeGTest,TestTerminateWrite_RoundRobin) {
     RealTimeThreadAsyncBridgeTest test;
-    ASSERT_TRUE(test.TestTerminateWrite_ResetCounter());
+    ASSERT_TRUE(test.TestTerminateWrite_RoundRobin());
 }
 
 
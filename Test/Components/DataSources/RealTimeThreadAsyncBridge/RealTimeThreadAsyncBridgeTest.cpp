@@ -57,23 +57,20 @@ public:
 
     virtual ~RealTimeThreadAsyncBridgeTestDS();
 
-    volatile int32 *GetSpinlocksRead();
-
-    FastPollingMutexSem *GetSpinlocksWrite();
+    RealTimeThreadAsyncBridgeBufferControl *GetBufferControl();
 
     EventSem *GetEventRead();
 
     EventSem *GetEventWrite();
 
-    uint32 *GetWhatIsNewestCounter();
+    RealTimeThreadAsyncBridgeSignalControl *GetSignalControl();
+
+    int32 GetNUMANode();
 
     virtual void PrepareInputOffsets();
 
     virtual void PrepareOutputOffsets();
 
-    void SetNewestCounter(uint32 newestCounter,
-                          uint32 signalIdx);
-
     virtual const char8 *GetBrokerName(StructuredDataI &data,
                                        const SignalDirection direction);
 
@@ -95,17 +92,6 @@ RealTimeThreadAsyncBridgeTestDS::RealTimeThreadAsyncBridgeTestDS() {
     done = false;
 }
 
-void RealTimeThreadAsyncBridgeTestDS::SetNewestCounter(uint32 newestCounter,
-                                                       uint32 signalIdx) {
-    whatIsNewestGlobCounter[signalIdx] = newestCounter;
-
-    for (uint32 i = 0u; i < numberOfBuffers; i++) {
-        uint32 index = signalIdx * numberOfBuffers + i;
-        whatIsNewestCounter[index] = newestCounter;
-    }
-
-}
-
 void RealTimeThreadAsyncBridgeTestDS::Done() {
     done = true;
 }
@@ -138,14 +124,14 @@ void RealTimeThreadAsyncBridgeTestDS::PrepareOutputOffsets() {
     }
 }
 
-volatile int32 *RealTimeThreadAsyncBridgeTestDS::GetSpinlocksRead() {
-    return spinlocksRead;
+RealTimeThreadAsyncBridgeBufferControl *RealTimeThreadAsyncBridgeTestDS::GetBufferControl() {
+    return bufferControl;
 }
-FastPollingMutexSem *RealTimeThreadAsyncBridgeTestDS::GetSpinlocksWrite() {
-    return spinlocksWrite;
+RealTimeThreadAsyncBridgeSignalControl *RealTimeThreadAsyncBridgeTestDS::GetSignalControl() {
+    return signalControl;
 }
-uint32 *RealTimeThreadAsyncBridgeTestDS::GetWhatIsNewestCounter() {
-    return whatIsNewestCounter;
+int32 RealTimeThreadAsyncBridgeTestDS::GetNUMANode() {
+    return numaNode;
 }
 
 const char8 *RealTimeThreadAsyncBridgeTestDS::GetBrokerName(StructuredDataI &data,
@@ -576,9 +562,9 @@ bool RealTimeThreadAsyncBridgeTest::TestConstructor() {
 
     bool ret = true;
 
-    ret = dataSource.GetSpinlocksRead() == NULL;
-    ret &= dataSource.GetSpinlocksWrite() == NULL;
-    ret &= dataSource.GetWhatIsNewestCounter() == NULL;
+    ret = dataSource.GetBufferControl() == NULL;
+    ret &= dataSource.GetSignalControl() == NULL;
+    ret &= dataSource.GetNUMANode() == -1;
     return ret;
 
 }
@@ -625,6 +611,53 @@ bool RealTimeThreadAsyncBridgeTest::TestInitialise_False_GreaterNumberOfBuffers(
     return ret;
 }
 
+bool RealTimeThreadAsyncBridgeTest::TestInitialise_NUMANode() {
+    RealTimeThreadAsyncBridgeTestDS dataSource;
+    const char8 *conf1 = "        +Drv1 = {"
+            "            Class = RealTimeThreadAsyncBridgeTestDS"
+            "            NumberOfBuffers = 3"
+            "            NUMANode = 0"
+            "        }";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = conf1;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        cdb.MoveAbsolute("+Drv1");
+        ret = dataSource.Initialise(cdb);
+    }
+    if (ret) {
+        ret = (dataSource.GetNUMANode() == 0);
+    }
+
+    return ret;
+}
+
+bool RealTimeThreadAsyncBridgeTest::TestInitialise_False_NUMANode() {
+    RealTimeThreadAsyncBridgeTestDS dataSource;
+    const char8 *conf1 = "        +Drv1 = {"
+            "            Class = RealTimeThreadAsyncBridgeTestDS"
+            "            NumberOfBuffers = 3"
+            "            NUMANode = 64"
+            "        }";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = conf1;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        cdb.MoveAbsolute("+Drv1");
+        ret = !dataSource.Initialise(cdb);
+    }
+
+    return ret;
+}
+
 bool RealTimeThreadAsyncBridgeTest::TestSetConfiguredDatabase() {
 
     static const char8 * const config = ""
@@ -698,17 +731,23 @@ bool RealTimeThreadAsyncBridgeTest::TestSetConfiguredDatabase() {
     }
 
     if (ret) {
-        volatile int32 *spinRead = dataSource->GetSpinlocksRead();
-        FastPollingMutexSem *spinWrite = dataSource->GetSpinlocksWrite();
-        uint32 *newCount = dataSource->GetWhatIsNewestCounter();
+        RealTimeThreadAsyncBridgeBufferControl *bufferControl = dataSource->GetBufferControl();
+        RealTimeThreadAsyncBridgeSignalControl *signalControl = dataSource->GetSignalControl();
 
         uint32 nElements = dataSource->GetNumberOfSignals() * dataSource->GetNumberOfMemoryBuffers();
         for (uint32 i = 0u; (i < nElements) && (ret); i++) {
-            ret &= spinRead[i] == 0;
-            ret &= spinWrite[i].FastTryLock();
-            spinWrite[i].FastUnLock();
-            ret &= newCount[i] == 0;
+            ret &= bufferControl[i].readers == 0;
+            ret &= bufferControl[i].writeSem.FastTryLock();
+            bufferControl[i].writeSem.FastUnLock();
+            ret &= bufferControl[i].writeLock == 0;
+        }
+        //The first write goes to the buffer 0
+        for (uint32 i = 0u; (i < dataSource->GetNumberOfSignals()) && (ret); i++) {
+            ret &= signalControl[i].newest == (int32)(dataSource->GetNumberOfMemoryBuffers() - 1u);
         }
+        //Each control word is on its own cache line
+        ret &= (sizeof(RealTimeThreadAsyncBridgeBufferControl) % REAL_TIME_THREAD_ASYNC_BRIDGE_CACHE_LINE_SIZE) == 0u;
+        ret &= (sizeof(RealTimeThreadAsyncBridgeSignalControl) % REAL_TIME_THREAD_ASYNC_BRIDGE_CACHE_LINE_SIZE) == 0u;
     }
     return ret;
 }
@@ -2246,7 +2285,7 @@ bool RealTimeThreadAsyncBridgeTest::TestTerminateWrite() {
     return RealTimeThreadAsyncBridgeTest::TestGetOutputOffset();
 }
 
-bool RealTimeThreadAsyncBridgeTest::TestTerminateWrite_ResetCounter() {
+bool RealTimeThreadAsyncBridgeTest::TestTerminateWrite_RoundRobin() {
 
     static const char8 * const config = ""
             "$Application1 = {"
@@ -2326,15 +2365,6 @@ bool RealTimeThreadAsyncBridgeTest::TestTerminateWrite_ResetCounter() {
         gamReader1 = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMB");
         ret = gamReader1.IsValid();
     }
-    if (ret) {
-        uint32 newestCounter = (uint32)(-5);
-        uint32 nSignals = dataSource->GetNumberOfSignals();
-        for (uint32 i = 0u; i < nSignals; i++) {
-            dataSource->SetNewestCounter(newestCounter, i);
-        }
-
-    }
-
     ReferenceT<RealTimeApplication> app;
     if (ret) {
         app = ObjectRegistryDatabase::Instance()->Find("Application1");
@@ -69,6 +69,16 @@ public:
      */
     bool TestInitialise_False_GreaterNumberOfBuffers();
 
+    /**
+     * @brief Tests the Initialise method with a NUMANode.
+     */
+    bool TestInitialise_NUMANode();
+
+    /**
+     * @brief Tests that the Initialise method fails if NUMANode >= 64.
+     */
+    bool TestInitialise_False_NUMANode();
+
     /**
      * @brief Tests the SetConfiguredDatabase method
      */
@@ -157,9 +167,9 @@ public:
     bool TestTerminateWrite();
 
     /**
-     * @brief Tests the TerminateWrite method when the counter reaches the overflow and it should be reset
+     * @brief Tests that the TerminateWrite method publishes the buffers in round robin (the writer always takes the oldest one)
      */
-    bool TestTerminateWrite_ResetCounter();
+    bool TestTerminateWrite_RoundRobin();
 
     /**
      * @brief Tests the ResetSignalValue method
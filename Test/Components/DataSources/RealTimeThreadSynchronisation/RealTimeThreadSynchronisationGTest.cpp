@@ -145,3 +145,38 @@ TEST(RealTimeThreadSynchronisationGTest,TestSetConfiguredDatabase_WaitForNext) {
 }
 
 	
+
+TEST(RealTimeThreadSynchronisationGTest,TestSynchronise_SpinTime) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestSynchronise_SpinTime());
+}
+
+TEST(RealTimeThreadSynchronisationGTest,TestSynchronise_Timeout) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestSynchronise_Timeout());
+}
+
+TEST(RealTimeThreadSynchronisationGTest,TestSynchronise_Wakeup) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestSynchronise_Wakeup());
+}
+
+TEST(RealTimeThreadSynchronisationGTest,TestSetConfiguredDatabase_Consumers) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_Consumers());
+}
+
+TEST(RealTimeThreadSynchronisationGTest,TestSetConfiguredDatabase_False_Consumers) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_Consumers());
+}
+
+TEST(RealTimeThreadSynchronisationGTest,TestSynchronise_NonBlocking) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestSynchronise_NonBlocking());
+}
+
+TEST(RealTimeThreadSynchronisationGTest,TestSetConfiguredDatabase_False_NonBlockingCountSignal) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_NonBlockingCountSignal());
+}
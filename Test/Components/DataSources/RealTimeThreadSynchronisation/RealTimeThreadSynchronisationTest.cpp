@@ -36,9 +36,12 @@
 #include "RealTimeThreadSynchronisationTest.h"
 
 #include "GAM.h"
+#include "HighResolutionTimer.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
+#include "Sleep.h"
 #include "StandardParser.h"
+#include "Threads.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -164,10 +167,10 @@ RealTimeThreadSynchronisationSchedulerTestHelper    () : MARTe::GAMSchedulerI()
         return MARTe::ErrorManagement::NoError;
     }
 
-    void ExecuteThreadCycle(MARTe::uint32 threadId) {
+    bool ExecuteThreadCycle(MARTe::uint32 threadId) {
         using namespace MARTe;
         ReferenceT<RealTimeApplication> realTimeAppT = realTimeApp;
-        ExecuteSingleCycle(scheduledStates[realTimeAppT->GetIndex()]->threads[threadId].executables,
+        return ExecuteSingleCycle(scheduledStates[realTimeAppT->GetIndex()]->threads[threadId].executables,
                 scheduledStates[realTimeAppT->GetIndex()]->threads[threadId].numberOfExecutables);
     }
 
@@ -538,8 +541,8 @@ static const MARTe::char8 * const config1b = ""
         "}";
 
 
-//Configuration with no GAMs producing/consuming data from the RealTimeThreadSynchronisation which is OK
-static const MARTe::char8 * const config2 = ""
+//As config1 with SpinTime and per consumer settings
+static const MARTe::char8 * const config1c = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -661,9 +664,14 @@ static const MARTe::char8 * const config2 = ""
         "        }"
         "        +RealTimeThreadSynchronisationTest = {"
         "            Class = RealTimeThreadSynchronisation"
-        "        }"
-        "        +RealTimeThreadSynchronisationTestEmpty = {"
-        "            Class = RealTimeThreadSynchronisation"
+        "            SpinTime = 10"
+        "            Consumers = {"
+        "                GAM1Thread3 = {"
+        "                    SpinTime = 100"
+        "                }"
+        "                GAM1Thread4 = {"
+        "                }"
+        "            }"
         "        }"
         "    }"
         "    +States = {"
@@ -697,8 +705,9 @@ static const MARTe::char8 * const config2 = ""
         "    }"
         "}";
 
-//Configuration with one GAMs producing but no GAM consuming (which is OK)
-static const MARTe::char8 * const config3 = ""
+
+//As config1 with the producer in the Consumers
+static const MARTe::char8 * const config1d = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -728,6 +737,89 @@ static const MARTe::char8 * const config3 = ""
         "                }"
         "            }"
         "        }"
+        "        +GAM1Thread2 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread3 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread4 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "            }"
+        "        }"
         "    }"
         "    +Data = {"
         "        Class = ReferenceContainer"
@@ -737,6 +829,11 @@ static const MARTe::char8 * const config3 = ""
         "        }"
         "        +RealTimeThreadSynchronisationTest = {"
         "            Class = RealTimeThreadSynchronisation"
+        "            Consumers = {"
+        "                GAM1Thread1 = {"
+        "                    SpinTime = 100"
+        "                }"
+        "            }"
         "        }"
         "    }"
         "    +States = {"
@@ -749,6 +846,18 @@ static const MARTe::char8 * const config3 = ""
         "                    Class = RealTimeThread"
         "                    Functions = {GAM1Thread1}"
         "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread2}"
+        "                }"
+        "                +Thread3 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread3}"
+        "                }"
+        "                +Thread4 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread4}"
+        "                }"
         "            }"
         "        }"
         "    }"
@@ -758,12 +867,38 @@ static const MARTe::char8 * const config3 = ""
         "    }"
         "}";
 
-//Configuration with no GAMs producing consuming data from the RealTimeThreadSynchronisation which is wrong!
-static const MARTe::char8 * const config4 = ""
+
+//As config1 with a short timeout
+static const MARTe::char8 * const config1e = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
         "        Class = ReferenceContainer"
+        "        +GAM1Thread1 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            OutputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
         "        +GAM1Thread2 = {"
         "            Class = RealTimeThreadSynchronisationGAMTestHelper"
         "            InputSignals = {"
@@ -856,6 +991,7 @@ static const MARTe::char8 * const config4 = ""
         "        }"
         "        +RealTimeThreadSynchronisationTest = {"
         "            Class = RealTimeThreadSynchronisation"
+        "            Timeout = 10"
         "        }"
         "    }"
         "    +States = {"
@@ -864,6 +1000,10 @@ static const MARTe::char8 * const config4 = ""
         "            Class = RealTimeState"
         "            +Threads = {"
         "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread1}"
+        "                }"
         "                +Thread2 = {"
         "                    Class = RealTimeThread"
         "                    Functions = {GAM1Thread2}"
@@ -885,8 +1025,9 @@ static const MARTe::char8 * const config4 = ""
         "    }"
         "}";
 
-//Configuration with more than one producer
-static const MARTe::char8 * const config5 = ""
+
+//Configuration with no GAMs producing/consuming data from the RealTimeThreadSynchronisation which is OK
+static const MARTe::char8 * const config2 = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -904,11 +1045,6 @@ static const MARTe::char8 * const config5 = ""
         "                    Type = uint32"
         "                    DataSource = RealTimeThreadSynchronisationTest"
         "                }"
-        "            }"
-        "        }"
-        "        +GAM1Thread1B = {"
-        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
-        "            OutputSignals = {"
         "                SignalUInt64 = {"
         "                    Type = uint64"
         "                    DataSource = RealTimeThreadSynchronisationTest"
@@ -1014,6 +1150,9 @@ static const MARTe::char8 * const config5 = ""
         "        +RealTimeThreadSynchronisationTest = {"
         "            Class = RealTimeThreadSynchronisation"
         "        }"
+        "        +RealTimeThreadSynchronisationTestEmpty = {"
+        "            Class = RealTimeThreadSynchronisation"
+        "        }"
         "    }"
         "    +States = {"
         "        Class = ReferenceContainer"
@@ -1023,7 +1162,7 @@ static const MARTe::char8 * const config5 = ""
         "                Class = ReferenceContainer"
         "                +Thread1 = {"
         "                    Class = RealTimeThread"
-        "                    Functions = {GAM1Thread1 GAM1Thread1B}"
+        "                    Functions = {GAM1Thread1}"
         "                }"
         "                +Thread2 = {"
         "                    Class = RealTimeThread"
@@ -1046,8 +1185,8 @@ static const MARTe::char8 * const config5 = ""
         "    }"
         "}";
 
-//Configuration where not all signals are written
-static const MARTe::char8 * const config6 = ""
+//Configuration with one GAMs producing but no GAM consuming (which is OK)
+static const MARTe::char8 * const config3 = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -1061,6 +1200,10 @@ static const MARTe::char8 * const config6 = ""
         "                    NumberOfDimensions = 1"
         "                    NumberOfElements = 3"
         "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
         "                SignalUInt64 = {"
         "                    Type = uint64"
         "                    DataSource = RealTimeThreadSynchronisationTest"
@@ -1073,6 +1216,42 @@ static const MARTe::char8 * const config6 = ""
         "                }"
         "            }"
         "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +RealTimeThreadSynchronisationTest = {"
+        "            Class = RealTimeThreadSynchronisation"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = RealTimeThreadSynchronisationSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with no GAMs producing consuming data from the RealTimeThreadSynchronisation which is wrong!
+static const MARTe::char8 * const config4 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
         "        +GAM1Thread2 = {"
         "            Class = RealTimeThreadSynchronisationGAMTestHelper"
         "            InputSignals = {"
@@ -1165,11 +1344,6 @@ static const MARTe::char8 * const config6 = ""
         "        }"
         "        +RealTimeThreadSynchronisationTest = {"
         "            Class = RealTimeThreadSynchronisation"
-        "            Signals = {"
-        "                SignalUInt32 = {"
-        "                    Type = uint32"
-        "                }"
-        "            }"
         "        }"
         "    }"
         "    +States = {"
@@ -1178,10 +1352,6 @@ static const MARTe::char8 * const config6 = ""
         "            Class = RealTimeState"
         "            +Threads = {"
         "                Class = ReferenceContainer"
-        "                +Thread1 = {"
-        "                    Class = RealTimeThread"
-        "                    Functions = {GAM1Thread1}"
-        "                }"
         "                +Thread2 = {"
         "                    Class = RealTimeThread"
         "                    Functions = {GAM1Thread2}"
@@ -1203,8 +1373,8 @@ static const MARTe::char8 * const config6 = ""
         "    }"
         "}";
 
-//Configuration with more than one output sample
-static const MARTe::char8 * const config7 = ""
+//Configuration with more than one producer
+static const MARTe::char8 * const config5 = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -1217,24 +1387,25 @@ static const MARTe::char8 * const config7 = ""
         "                    DataSource = RealTimeThreadSynchronisationTest"
         "                    NumberOfDimensions = 1"
         "                    NumberOfElements = 3"
-        "                    Samples = 2"
         "                }"
         "                SignalUInt32 = {"
         "                    Type = uint32"
         "                    DataSource = RealTimeThreadSynchronisationTest"
-        "                    Samples = 2"
         "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread1B = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            OutputSignals = {"
         "                SignalUInt64 = {"
         "                    Type = uint64"
         "                    DataSource = RealTimeThreadSynchronisationTest"
         "                    NumberOfDimensions = 1"
         "                    NumberOfElements = 5"
-        "                    Samples = 2"
         "                }"
         "                SignalInt32 = {"
         "                    Type = int32"
         "                    DataSource = RealTimeThreadSynchronisationTest"
-        "                    Samples = 2"
         "                }"
         "            }"
         "        }"
@@ -1340,7 +1511,7 @@ static const MARTe::char8 * const config7 = ""
         "                Class = ReferenceContainer"
         "                +Thread1 = {"
         "                    Class = RealTimeThread"
-        "                    Functions = {GAM1Thread1}"
+        "                    Functions = {GAM1Thread1 GAM1Thread1B}"
         "                }"
         "                +Thread2 = {"
         "                    Class = RealTimeThread"
@@ -1363,8 +1534,8 @@ static const MARTe::char8 * const config7 = ""
         "    }"
         "}";
 
-//Configuration reading a different number of samples from the same GAM
-static const MARTe::char8 * const config8 = ""
+//Configuration where not all signals are written
+static const MARTe::char8 * const config6 = ""
         "$Test = {"
         "    Class = RealTimeApplication"
         "    +Functions = {"
@@ -1378,10 +1549,6 @@ static const MARTe::char8 * const config8 = ""
         "                    NumberOfDimensions = 1"
         "                    NumberOfElements = 3"
         "                }"
-        "                SignalUInt32 = {"
-        "                    Type = uint32"
-        "                    DataSource = RealTimeThreadSynchronisationTest"
-        "                }"
         "                SignalUInt64 = {"
         "                    Type = uint64"
         "                    DataSource = RealTimeThreadSynchronisationTest"
@@ -1432,7 +1599,7 @@ static const MARTe::char8 * const config8 = ""
         "                SignalUInt32 = {"
         "                    Type = uint32"
         "                    DataSource = RealTimeThreadSynchronisationTest"
-        "                    Samples = 4"
+        "                    Samples = 2"
         "                }"
         "                SignalUInt64 = {"
         "                    Type = uint64"
@@ -1486,6 +1653,11 @@ static const MARTe::char8 * const config8 = ""
         "        }"
         "        +RealTimeThreadSynchronisationTest = {"
         "            Class = RealTimeThreadSynchronisation"
+        "            Signals = {"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
         "        }"
         "    }"
         "    +States = {"
@@ -1518,25 +1690,479 @@ static const MARTe::char8 * const config8 = ""
         "        TimingDataSource = Timings"
         "    }"
         "}";
-/*---------------------------------------------------------------------------*/
-/*                           Method definitions                              */
-/*---------------------------------------------------------------------------*/
-
-bool RealTimeThreadSynchronisationTest::TestConstructor() {
-    using namespace MARTe;
-    RealTimeThreadSynchronisation test;
-    return true;
-}
-
-bool RealTimeThreadSynchronisationTest::TestAllocateMemory() {
-    using namespace MARTe;
-    RealTimeThreadSynchronisation test;
-    return test.AllocateMemory();
-}
 
-bool RealTimeThreadSynchronisationTest::TestGetNumberOfMemoryBuffers() {
-    using namespace MARTe;
-    RealTimeThreadSynchronisation test;
+//Configuration with more than one output sample
+static const MARTe::char8 * const config7 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1Thread1 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            OutputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                    Samples = 2"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                    Samples = 2"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread2 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread3 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread4 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +RealTimeThreadSynchronisationTest = {"
+        "            Class = RealTimeThreadSynchronisation"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread1}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread2}"
+        "                }"
+        "                +Thread3 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread3}"
+        "                }"
+        "                +Thread4 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread4}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = RealTimeThreadSynchronisationSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration reading a different number of samples from the same GAM
+static const MARTe::char8 * const config8 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1Thread1 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            OutputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread2 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread3 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread4 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +RealTimeThreadSynchronisationTest = {"
+        "            Class = RealTimeThreadSynchronisation"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread1}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread2}"
+        "                }"
+        "                +Thread3 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread3}"
+        "                }"
+        "                +Thread4 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread4}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = RealTimeThreadSynchronisationSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with a NonBlocking consumer
+static const MARTe::char8 * const config9 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1Thread1 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            OutputSignals = {"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread2 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "                Count = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +RealTimeThreadSynchronisationTest = {"
+        "            Class = RealTimeThreadSynchronisation"
+        "            Consumers = {"
+        "                GAM1Thread2 = {"
+        "                    NonBlocking = 1"
+        "                    CountSignal = Count"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread1}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread2}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = RealTimeThreadSynchronisationSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//As config9 with a CountSignal which is not read by the consumer
+static const MARTe::char8 * const config9b = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1Thread1 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            OutputSignals = {"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread2 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "                Count = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +RealTimeThreadSynchronisationTest = {"
+        "            Class = RealTimeThreadSynchronisation"
+        "            Consumers = {"
+        "                GAM1Thread2 = {"
+        "                    NonBlocking = 1"
+        "                    CountSignal = WrongCount"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread1}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread2}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = RealTimeThreadSynchronisationSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool RealTimeThreadSynchronisationTest::TestConstructor() {
+    using namespace MARTe;
+    RealTimeThreadSynchronisation test;
+    return true;
+}
+
+bool RealTimeThreadSynchronisationTest::TestAllocateMemory() {
+    using namespace MARTe;
+    RealTimeThreadSynchronisation test;
+    return test.AllocateMemory();
+}
+
+bool RealTimeThreadSynchronisationTest::TestGetNumberOfMemoryBuffers() {
+    using namespace MARTe;
+    RealTimeThreadSynchronisation test;
     return (test.GetNumberOfMemoryBuffers() == 1);
 }
 
@@ -1642,9 +2268,9 @@ bool RealTimeThreadSynchronisationTest::TestSetConfiguredDatabase_False_Differen
     return !TestIntegratedInApplication(config8, true);
 }
 
-bool RealTimeThreadSynchronisationTest::TestSynchronise() {
+static bool TestSynchroniseInApplication(const MARTe::char8 * const config) {
     using namespace MARTe;
-    bool ok = TestIntegratedInApplication(config1, false);
+    bool ok = TestIntegratedInApplication(config, false);
     ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
 
     ReferenceT<RealTimeThreadSynchronisationGAMTestHelper> gam1Thread1;
@@ -1772,3 +2398,209 @@ bool RealTimeThreadSynchronisationTest::TestSynchronise() {
     godb->Purge();
     return ok;
 }
+
+bool RealTimeThreadSynchronisationTest::TestSynchronise() {
+    return TestSynchroniseInApplication(config1);
+}
+
+bool RealTimeThreadSynchronisationTest::TestSynchronise_SpinTime() {
+    return TestSynchroniseInApplication(config1c);
+}
+
+bool RealTimeThreadSynchronisationTest::TestSetConfiguredDatabase_Consumers() {
+    return TestIntegratedInApplication(config1c, true);
+}
+
+bool RealTimeThreadSynchronisationTest::TestSetConfiguredDatabase_False_Consumers() {
+    return !TestIntegratedInApplication(config1d, true);
+}
+
+bool RealTimeThreadSynchronisationTest::TestSynchronise_Timeout() {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(config1e, false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+    ReferenceT<RealTimeThreadSynchronisationSchedulerTestHelper> scheduler;
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = godb->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        scheduler = godb->Find("Test.Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    //No sample was written => the consumer shall wait (at least) the timeout and fail
+    if (ok) {
+        uint64 startTicks = HighResolutionTimer::Counter();
+        ok = !scheduler->ExecuteThreadCycle(1);
+        if (ok) {
+            float64 elapsed = static_cast<float64>(HighResolutionTimer::Counter() - startTicks) * HighResolutionTimer::Period();
+            ok = (elapsed > 0.009);
+        }
+    }
+    if (ok) {
+        ok = scheduler->ExecuteThreadCycle(0);
+    }
+    if (ok) {
+        ok = scheduler->ExecuteThreadCycle(1);
+    }
+    godb->Purge();
+    return ok;
+}
+
+/**
+ * Executes the producer thread after the consumer went to sleep.
+ */
+static void RealTimeThreadSynchronisationTestProducer(const void * const params) {
+    using namespace MARTe;
+    RealTimeThreadSynchronisationSchedulerTestHelper *scheduler = static_cast<RealTimeThreadSynchronisationSchedulerTestHelper *>(const_cast<void *>(params));
+    Sleep::MSec(50);
+    (void) scheduler->ExecuteThreadCycle(0);
+}
+
+bool RealTimeThreadSynchronisationTest::TestSynchronise_Wakeup() {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(config1, false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+    ReferenceT<RealTimeThreadSynchronisationGAMTestHelper> gam1Thread1;
+    ReferenceT<RealTimeThreadSynchronisationGAMTestHelper> gam1Thread2;
+    ReferenceT<RealTimeThreadSynchronisationSchedulerTestHelper> scheduler;
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = godb->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        gam1Thread1 = godb->Find("Test.Functions.GAM1Thread1");
+        ok = gam1Thread1.IsValid();
+    }
+    if (ok) {
+        gam1Thread2 = godb->Find("Test.Functions.GAM1Thread2");
+        ok = gam1Thread2.IsValid();
+    }
+    if (ok) {
+        scheduler = godb->Find("Test.Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    if (ok) {
+        uint32 e;
+        for (e = 0u; (e < gam1Thread1->uint32SignalElements); e++) {
+            gam1Thread1->uint32Signal[e] = (7u + e);
+        }
+        ThreadIdentifier tid = Threads::BeginThread(&RealTimeThreadSynchronisationTestProducer, scheduler.operator ->());
+        //Sleeps on the futex (the spin time is zero) until the producer writes the sample
+        ok = scheduler->ExecuteThreadCycle(1);
+        while (Threads::IsAlive(tid)) {
+            Sleep::MSec(1);
+        }
+        for (e = 0u; (e < gam1Thread1->uint32SignalElements) && (ok); e++) {
+            ok = (gam1Thread2->uint32Signal[e] == (7u + e));
+        }
+    }
+    godb->Purge();
+    return ok;
+}
+
+/**
+ * Writes \a numberOfSamples samples (starting from \a firstValue) and checks that the NonBlocking consumer reads the \a expectedCount samples from \a firstExpected.
+ */
+static bool RealTimeThreadSynchronisationTestNonBlocking(RealTimeThreadSynchronisationSchedulerTestHelper * const scheduler,
+                                                         RealTimeThreadSynchronisationGAMTestHelper * const producer,
+                                                         RealTimeThreadSynchronisationGAMTestHelper * const consumer,
+                                                         MARTe::uint32 &nextValue,
+                                                         const MARTe::uint32 numberOfSamples,
+                                                         const MARTe::uint32 expectedCount,
+                                                         const MARTe::uint32 firstExpected) {
+    using namespace MARTe;
+    bool ok = true;
+    uint32 j;
+    for (j = 0u; (j < numberOfSamples) && (ok); j++) {
+        producer->uint64Signal[0] = nextValue;
+        nextValue++;
+        ok = scheduler->ExecuteThreadCycle(0);
+    }
+    //Never waits for the producer
+    if (ok) {
+        ok = scheduler->ExecuteThreadCycle(1);
+    }
+    if (ok) {
+        ok = (consumer->uint32Signal[0] == expectedCount);
+    }
+    for (j = 0u; (j < expectedCount) && (ok); j++) {
+        ok = (consumer->uint64Signal[j] == (firstExpected + j));
+    }
+    return ok;
+}
+
+bool RealTimeThreadSynchronisationTest::TestSynchronise_NonBlocking() {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(config9, false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+    ReferenceT<RealTimeThreadSynchronisationGAMTestHelper> gam1Thread1;
+    ReferenceT<RealTimeThreadSynchronisationGAMTestHelper> gam1Thread2;
+    ReferenceT<RealTimeThreadSynchronisationSchedulerTestHelper> scheduler;
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = godb->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        gam1Thread1 = godb->Find("Test.Functions.GAM1Thread1");
+        ok = gam1Thread1.IsValid();
+    }
+    if (ok) {
+        gam1Thread2 = godb->Find("Test.Functions.GAM1Thread2");
+        ok = gam1Thread2.IsValid();
+    }
+    if (ok) {
+        scheduler = godb->Find("Test.Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    uint32 nextValue = 0u;
+    //Less samples than the Samples of the consumer
+    if (ok) {
+        ok = RealTimeThreadSynchronisationTestNonBlocking(scheduler.operator ->(), gam1Thread1.operator ->(), gam1Thread2.operator ->(), nextValue, 3u, 3u, 0u);
+    }
+    //No new sample
+    if (ok) {
+        ok = RealTimeThreadSynchronisationTestNonBlocking(scheduler.operator ->(), gam1Thread1.operator ->(), gam1Thread2.operator ->(), nextValue, 0u, 0u, 0u);
+    }
+    //More samples than the Samples of the consumer: the others are read in the next cycle
+    if (ok) {
+        ok = RealTimeThreadSynchronisationTestNonBlocking(scheduler.operator ->(), gam1Thread1.operator ->(), gam1Thread2.operator ->(), nextValue, 6u, 4u, 3u);
+    }
+    if (ok) {
+        ok = RealTimeThreadSynchronisationTestNonBlocking(scheduler.operator ->(), gam1Thread1.operator ->(), gam1Thread2.operator ->(), nextValue, 0u, 2u, 7u);
+    }
+    //More samples than the ring (2 * 4 - 1): the oldest are lost
+    if (ok) {
+        ok = RealTimeThreadSynchronisationTestNonBlocking(scheduler.operator ->(), gam1Thread1.operator ->(), gam1Thread2.operator ->(), nextValue, 10u, 4u, 12u);
+    }
+    if (ok) {
+        ok = RealTimeThreadSynchronisationTestNonBlocking(scheduler.operator ->(), gam1Thread1.operator ->(), gam1Thread2.operator ->(), nextValue, 0u, 3u, 16u);
+    }
+    godb->Purge();
+    return ok;
+}
+
+bool RealTimeThreadSynchronisationTest::TestSetConfiguredDatabase_False_NonBlockingCountSignal() {
+    return !TestIntegratedInApplication(config9b, true);
+}
@@ -145,6 +145,41 @@ public:
      */
     bool TestSynchronise();
 
+    /**
+     * @brief Tests that the RealTimeThreads values are correctly synchronised with a SpinTime and per consumer settings.
+     */
+    bool TestSynchronise_SpinTime();
+
+    /**
+     * @brief Tests that a consumer fails after the timeout if no sample is written.
+     */
+    bool TestSynchronise_Timeout();
+
+    /**
+     * @brief Tests that a consumer sleeping on the futex is woken by the producer running on another thread.
+     */
+    bool TestSynchronise_Wakeup();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method with the Consumers settings.
+     */
+    bool TestSetConfiguredDatabase_Consumers();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method with a function in Consumers that does not read from the DataSourceI.
+     */
+    bool TestSetConfiguredDatabase_False_Consumers();
+
+    /**
+     * @brief Tests that a NonBlocking consumer reads all the samples written since its previous cycle (at most Samples) without waiting.
+     */
+    bool TestSynchronise_NonBlocking();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method with a CountSignal which is not read by the NonBlocking consumer.
+     */
+    bool TestSetConfiguredDatabase_False_NonBlockingCountSignal();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -288,6 +288,11 @@ TEST(SDNPublisherGTest, TestSynchronise_UCAST_Topic_1) {
     SDNPublisherTest test;
     ASSERT_TRUE(test.TestSynchronise_UCAST_Topic_1());
 }
+
+TEST(SDNPublisherGTest, TestSynchronise_Fragmented) {
+    SDNPublisherTest test;
+    ASSERT_TRUE(test.TestSynchronise_Fragmented());
+}
 #ifdef FEATURE_10840
 TEST(SDNPublisherGTest, TestSynchronise_NetworkByteOrder_Topic_1) {
     SDNPublisherTest test;
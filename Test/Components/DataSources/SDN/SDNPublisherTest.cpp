@@ -2760,3 +2760,180 @@ bool SDNPublisherTest::TestSynchronise_NetworkByteOrder_Topic_2() {
     return ok;
 }
 #endif
+
+bool SDNPublisherTest::TestSynchronise_Fragmented() {
+    using namespace MARTe;
+    //Standard configuration for testing
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Timer = {"
+            "            Class = SDNPublisherTestGAM"
+            "            OutputSignals = {"
+            "                Counter = {"
+            "                    DataSource = SDNPub"
+            "                    Type = uint64"
+            "                    Trigger = 1"
+            "                }"
+            "                Timestamp = {"
+            "                    DataSource = SDNPub"
+            "                    Type = uint64"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +SDNPub = {"
+            "            Class = SDNPublisher"
+            "            Topic = Fragmented"
+            "            Interface = lo"
+            "            FragmentSize = 12"
+            "            Signals = {"
+            "                Counter = {"
+            "                    Type = uint64"
+            "                }"
+            "                Timestamp = {"
+            "                    Type = uint64"
+            "                }"
+            "            }"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Timer}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = ConfigureApplication(config);
+
+    if (ok) {
+
+        ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+        ReferenceT<RealTimeApplication> application = god->Find("Test");
+        ReferenceT<SDNPublisher> publisher = application->Find("Data.SDNPub");
+        ReferenceT<SDNPublisherTestGAM> timer = application->Find("Functions.Timer");
+
+        ok = ((publisher.IsValid()) && (timer.IsValid()));
+        if (ok) {
+            // 16 bytes of payload in fragments of 12 bytes
+            ok = (publisher->GetFragmentSize() == 12u);
+        }
+        if (ok) {
+            ok = (publisher->GetNumberOfFragments() == 2u);
+        }
+
+        if (ok) {
+            // Instantiate a sdn::Metadata structure to configure the fragment topic
+            sdn::Metadata_t mdata;
+            sdn::Topic_InitializeMetadata(mdata, "Fragmented", 0);
+            // Instantiate SDN topic from metadata specification
+            sdn::Topic* topic = new sdn::Topic;
+            topic->SetMetadata(mdata);
+            sdn::Subscriber* subscriber;
+
+            if (ok) {
+                ok = (topic->AddAttribute(0u, "MessageCounter", "uint32") == STATUS_SUCCESS);
+            }
+            if (ok) {
+                ok = (topic->AddAttribute(1u, "Offset", "uint32") == STATUS_SUCCESS);
+            }
+            if (ok) {
+                ok = (topic->AddAttribute(2u, "TotalSize", "uint32") == STATUS_SUCCESS);
+            }
+            if (ok) {
+                ok = (topic->AddAttribute(3u, "Fragment", "uint8", 12u) == STATUS_SUCCESS);
+            }
+            if (ok) {
+                topic->SetUID(0u); // UID corresponds to the data type but it includes attributes name - Safer to clear with SDN core library 1.0.10
+                ok = (topic->Configure() == STATUS_SUCCESS);
+            }
+            if (ok) {
+                ok = topic->IsInitialized();
+            }
+            // Create sdn::Subscriber
+            if (ok) {
+                subscriber = new sdn::Subscriber(*topic);
+            }
+            if (ok) {
+                ok = (subscriber->SetInterface((char*) "lo") == STATUS_SUCCESS);
+            }
+            if (ok) {
+                ok = (subscriber->Configure() == STATUS_SUCCESS);
+            }
+            // Set test value and call SDNPublisher::Synchronise
+            MARTe::uint64 counter = 10ul;
+            void *counterAddress = NULL_PTR(void *);
+            if (ok) {
+                ok = publisher->GetSignalMemoryBuffer(0u, 0u, counterAddress);
+            }
+            if (ok) {
+                ok = MemoryOperationsHelper::Copy(counterAddress, &counter, sizeof(MARTe::uint64));
+            }
+            if (ok) {
+                ok = publisher->Synchronise();
+            }
+            // Test reception of both fragments
+            MARTe::uint32 *messageCounter = static_cast<MARTe::uint32 *>(topic->GetTypeDefinition()->GetAttributeReference(0u));
+            MARTe::uint32 *offset = static_cast<MARTe::uint32 *>(topic->GetTypeDefinition()->GetAttributeReference(1u));
+            MARTe::uint32 *totalSize = static_cast<MARTe::uint32 *>(topic->GetTypeDefinition()->GetAttributeReference(2u));
+            void *fragment = topic->GetTypeDefinition()->GetAttributeReference(3u);
+            if (ok) {
+                ok = (subscriber->Receive(0ul) == STATUS_SUCCESS);
+            }
+            if (ok) {
+                ok = ((*messageCounter == 1u) && (*offset == 0u) && (*totalSize == 16u));
+            }
+            if (ok) {
+                MARTe::uint64 receivedCounter = 0ul;
+                ok = MemoryOperationsHelper::Copy(&receivedCounter, fragment, sizeof(MARTe::uint64));
+                log_info("Received counter '%lu'", receivedCounter);
+                if (ok) {
+                    ok = (receivedCounter == counter);
+                }
+            }
+            if (ok) {
+                ok = (subscriber->Receive(0ul) == STATUS_SUCCESS);
+            }
+            if (ok) {
+                ok = ((*messageCounter == 1u) && (*offset == 12u) && (*totalSize == 16u));
+            }
+            // No more fragments
+            if (ok) {
+                ok = (subscriber->Receive(0ul) != STATUS_SUCCESS);
+            }
+            if (ok) {
+                ok = publisher->Synchronise();
+            }
+            if (ok) {
+                ok = (subscriber->Receive(0ul) == STATUS_SUCCESS);
+            }
+            if (ok) {
+                ok = (*messageCounter == 2u);
+            }
+            delete subscriber;
+            delete topic;
+        }
+    }
+
+    return ok;
+}
@@ -303,6 +303,11 @@ public:
      * @brief Tests the Synchronise method.
      */
     bool TestSynchronise_UCAST_Topic_1();
+
+    /**
+     * @brief Tests the Synchronise method with FragmentSize > 0.
+     */
+    bool TestSynchronise_Fragmented();
 #ifdef FEATURE_10840
     /**
      * @brief Tests the Synchronise method.
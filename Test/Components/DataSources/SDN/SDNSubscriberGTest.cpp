@@ -94,6 +94,21 @@ TEST(SDNSubscriberGTest, TestInitialise_CPUMask) {
     ASSERT_TRUE(test.TestInitialise_CPUMask());
 }
 
+TEST(SDNSubscriberGTest, TestInitialise_SharedThread) {
+    SDNSubscriberTest test;
+    ASSERT_TRUE(test.TestInitialise_SharedThread());
+}
+
+TEST(SDNSubscriberGTest, TestInitialise_FragmentSize) {
+    SDNSubscriberTest test;
+    ASSERT_TRUE(test.TestInitialise_FragmentSize());
+}
+
+TEST(SDNSubscriberGTest, TestInitialise_False_FragmentSize_RealTimeThread) {
+    SDNSubscriberTest test;
+    ASSERT_TRUE(test.TestInitialise_False_FragmentSize_RealTimeThread());
+}
+
 TEST(SDNSubscriberGTest, TestInitialise_Missing_Topic) {
     SDNSubscriberTest test;
     ASSERT_TRUE(test.TestInitialise_Missing_Topic());
@@ -154,6 +169,16 @@ TEST(SDNSubscriberGTest, TestSetConfiguredDatabase_Header) {
     ASSERT_TRUE(test.TestSetConfiguredDatabase_Header());
 }
 
+TEST(SDNSubscriberGTest, TestSetConfiguredDatabase_Statistics) {
+    SDNSubscriberTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_Statistics());
+}
+
+TEST(SDNSubscriberGTest, TestSetConfiguredDatabase_False_Statistics) {
+    SDNSubscriberTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_Statistics());
+}
+
 TEST(SDNSubscriberGTest, TestSetConfiguredDatabase_False_NOfSignals_1) {
     SDNSubscriberTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase_False_NOfSignals_1());
@@ -299,6 +324,16 @@ TEST(SDNSubscriberGTest, TestSynchronise_MCAST_Topic_RTT_GetLatest) {
     ASSERT_TRUE(test.TestSynchronise_MCAST_Topic_RTT_GetLatest());
 }
 
+TEST(SDNSubscriberGTest, TestSynchronise_MCAST_Topic_GetLatest) {
+    SDNSubscriberTest test;
+    ASSERT_TRUE(test.TestSynchronise_MCAST_Topic_GetLatest());
+}
+
+TEST(SDNSubscriberGTest, TestSynchronise_MCAST_Topic_SharedThread) {
+    SDNSubscriberTest test;
+    ASSERT_TRUE(test.TestSynchronise_MCAST_Topic_SharedThread());
+}
+
 TEST(SDNSubscriberGTest, TestSynchronise_MCAST_Timeout) {
     SDNSubscriberTest test;
     ASSERT_TRUE(test.TestSynchronise_MCAST_Timeout());
@@ -336,6 +371,11 @@ TEST(SDNSubscriberGTest, TestSynchronise_NetworkByteOrder_Topic_1_Header) {
     ASSERT_TRUE(test.TestSynchronise_NetworkByteOrder_Topic_1_Header());
 }
 #endif
+TEST(SDNSubscriberGTest, TestSynchronise_MCAST_Topic_Fragmented) {
+    SDNSubscriberTest test;
+    ASSERT_TRUE(test.TestSynchronise_MCAST_Topic_Fragmented());
+}
+
 TEST(SDNSubscriberGTest, TestExecute_False) {
     SDNSubscriberTest test;
     ASSERT_TRUE(test.TestExecute_False());
@@ -470,6 +470,166 @@ const MARTe::char8 * const config_default_header = ""
         "    }"
         "}";
 
+const MARTe::char8 * const config_default_statistics = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +Sink = {"
+        "            Class = SDNSubscriberTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = SDNSub"
+        "                    Type = uint64"
+        "                }"
+        "                Timestamp = {"
+        "                    DataSource = SDNSub"
+        "                    Type = uint64"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +SDNSub = {"
+        "            Class = SDNSubscriber"
+        "            Topic = Default"
+        "            Interface = lo"
+        "            Timeout = 100"
+        "            Statistics = 1"
+        "            LateThreshold = 1000000"
+        "            HistogramBinWidth = 10000"
+        "            HistogramWindow = 1000"
+        "            Signals = {"
+        "                Counter = {"
+        "                    Type = uint64"
+        "                }"
+        "                Timestamp = {"
+        "                    Type = uint64"
+        "                }"
+        "                Latency = {"
+        "                    Type = int64"
+        "                }"
+        "                MaxLatency = {"
+        "                    Type = int64"
+        "                }"
+        "                LostMessages = {"
+        "                    Type = uint32"
+        "                }"
+        "                LateMessages = {"
+        "                    Type = uint32"
+        "                }"
+        "                LatencyHistogram = {"
+        "                    Type = uint32"
+        "                    NumberOfElements = 10"
+        "                    NumberOfDimensions = 1"
+        "                }"
+        "            }"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +Running = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {Sink}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+const MARTe::char8 * const config_false_statistics = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +Sink = {"
+        "            Class = SDNSubscriberTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = SDNSub"
+        "                    Type = uint64"
+        "                }"
+        "                Timestamp = {"
+        "                    DataSource = SDNSub"
+        "                    Type = uint64"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +SDNSub = {"
+        "            Class = SDNSubscriber"
+        "            Topic = Default"
+        "            Interface = lo"
+        "            Timeout = 100"
+        "            Statistics = 1"
+        "            LateThreshold = 1000000"
+        "            HistogramBinWidth = 10000"
+        "            HistogramWindow = 1000"
+        "            Signals = {"
+        "                Counter = {"
+        "                    Type = uint64"
+        "                }"
+        "                Timestamp = {"
+        "                    Type = uint64"
+        "                }"
+        "                Latency = {"
+        "                    Type = uint64"
+        "                }"
+        "                MaxLatency = {"
+        "                    Type = int64"
+        "                }"
+        "                LostMessages = {"
+        "                    Type = uint32"
+        "                }"
+        "                LateMessages = {"
+        "                    Type = uint32"
+        "                }"
+        "                LatencyHistogram = {"
+        "                    Type = uint32"
+        "                    NumberOfElements = 10"
+        "                    NumberOfDimensions = 1"
+        "                }"
+        "            }"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +Running = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {Sink}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -570,6 +730,46 @@ bool SDNSubscriberTest::TestInitialise_CPUMask() {
     return test.Initialise(cdb);
 }
 
+bool SDNSubscriberTest::TestInitialise_SharedThread() {
+    using namespace MARTe;
+    SDNSubscriber test;
+    ConfigurationDatabase cdb;
+    uint32 idleSleep = 10u;
+    cdb.Write("Topic", "Default");
+    cdb.Write("Interface", "lo");
+    cdb.Write("ExecutionMode", "SharedThread");
+    cdb.Write("IdleSleep", idleSleep);
+    return test.Initialise(cdb);
+}
+
+bool SDNSubscriberTest::TestInitialise_FragmentSize() {
+    using namespace MARTe;
+    SDNSubscriber test;
+    ConfigurationDatabase cdb;
+    uint32 fragmentSize = 1400u;
+    cdb.Write("Topic", "Default");
+    cdb.Write("Interface", "lo");
+    cdb.Write("ExecutionMode", "IndependentThread");
+    cdb.Write("FragmentSize", fragmentSize);
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (test.GetFragmentSize() == fragmentSize);
+    }
+    return ok;
+}
+
+bool SDNSubscriberTest::TestInitialise_False_FragmentSize_RealTimeThread() {
+    using namespace MARTe;
+    SDNSubscriber test;
+    ConfigurationDatabase cdb;
+    uint32 fragmentSize = 1400u;
+    cdb.Write("Topic", "Default");
+    cdb.Write("Interface", "lo");
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("FragmentSize", fragmentSize);
+    return !test.Initialise(cdb);
+}
+
 bool SDNSubscriberTest::TestInitialise_Missing_Topic() {
     using namespace MARTe;
     SDNSubscriber test;
@@ -685,6 +885,15 @@ bool SDNSubscriberTest::TestSetConfiguredDatabase_Header() {
     return TestIntegratedInApplication(config_default_header);
 }
 
+bool SDNSubscriberTest::TestSetConfiguredDatabase_Statistics() {
+    return TestIntegratedInApplication(config_default_statistics);
+}
+
+bool SDNSubscriberTest::TestSetConfiguredDatabase_False_Statistics() {
+    bool ok = ConfigureApplication(config_false_statistics);
+    return !ok; // Expect failure
+}
+
 bool SDNSubscriberTest::TestSetConfiguredDatabase_False_NOfSignals_1() {
     //Standard configuration for testing
     const MARTe::char8 * const config = ""
@@ -2970,7 +3179,7 @@ bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_RTT() {
     return ok;
 }
 
-bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_RTT_Trigger() {
+bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_SharedThread() {
     using namespace MARTe;
     //Standard configuration for testing
     const MARTe::char8 * const config = ""
@@ -2983,7 +3192,7 @@ bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_RTT_Trigger() {
             "            InputSignals = {"
             "                Counter = {"
             "                    DataSource = SDNSub"
-            "                    Trigger = 1"
+            "                    Frequency = 1."
             "                    Type = uint64"
             "                }"
             "                Timestamp = {"
@@ -2997,7 +3206,8 @@ bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_RTT_Trigger() {
             "        Class = ReferenceContainer"
             "        DefaultDataSource = DDB1"
             "        +SDNSub = {"
-            "            ExecutionMode = RealTimeThread"
+            "            ExecutionMode = SharedThread"
+            "            CPUs = 1"
             "            Class = SDNSubscriber"
             "            Topic = Default"
             "            Interface = lo"
@@ -3140,7 +3350,7 @@ bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_RTT_Trigger() {
     return ok;
 }
 
-bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_RTT_GetLatest() {
+bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_RTT_Trigger() {
     using namespace MARTe;
     //Standard configuration for testing
     const MARTe::char8 * const config = ""
@@ -3153,7 +3363,7 @@ bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_RTT_GetLatest() {
             "            InputSignals = {"
             "                Counter = {"
             "                    DataSource = SDNSub"
-            "                    Frequency = 0."
+            "                    Trigger = 1"
             "                    Type = uint64"
             "                }"
             "                Timestamp = {"
@@ -3265,6 +3475,10 @@ bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_RTT_GetLatest() {
         ok = ConfigureApplication(config);
     }
 
+    if (ok) {
+        ok = StartApplication();
+    }
+
     if (ok) {
 
         ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
@@ -3274,7 +3488,7 @@ bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_RTT_GetLatest() {
         ok = subscriber.IsValid();
 
         // Prepare data
-        MARTe::uint64 counter = 1ul;
+        MARTe::uint64 counter = 10ul;
         MARTe::uint64 timestamp = get_time();
         if (ok) {
             ok = (topic->SetAttribute(0u, counter) == STATUS_SUCCESS);
@@ -3286,18 +3500,10 @@ bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_RTT_GetLatest() {
         if (ok) {
             ok = (publisher->Publish() == STATUS_SUCCESS);
         }
-
-        ReferenceContainer inputBrokers;
-        sink->GetInputBrokers(inputBrokers);
-
-        for (uint32 i = 0u; i < inputBrokers.Size(); i++) {
-            ReferenceT<BrokerI> broker = inputBrokers.Get(i);
-            if (broker.IsValid()) {
-                broker->Execute();
-            }
+        // Let the application run
+        if (ok) {
+            wait_for(500000000ul);
         }
-
-        sink->Execute();
         // Test reception
         if (ok) {
             ok = sink->TestCounter(counter);
@@ -3305,43 +3511,16 @@ bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_RTT_GetLatest() {
         if (ok) {
             ok = sink->TestTimestamp(timestamp);
         }
+    }
 
-        for (uint32 i = 0u; i < 10u; i++) {
-            // Prepare data
-            counter = i;
-            timestamp = get_time();
-            if (ok) {
-                ok = (topic->SetAttribute(0u, counter) == STATUS_SUCCESS);
-            }
-            if (ok) {
-                ok = (topic->SetAttribute(1u, timestamp) == STATUS_SUCCESS);
-            }
-            // Send data
-            if (ok) {
-                ok = (publisher->Publish() == STATUS_SUCCESS);
-            }
-        }
-
-        for (uint32 i = 0u; i < inputBrokers.Size(); i++) {
-            ReferenceT<BrokerI> broker = inputBrokers.Get(i);
-            if (broker.IsValid()) {
-                broker->Execute();
-            }
-        }
-        // Test reception last packet
-        sink->Execute();
-        if (ok) {
-            ok = sink->TestCounter(counter);
-        }
-        if (ok) {
-            ok = sink->TestTimestamp(timestamp);
-        }
+    if (ok) {
+        ok = StopApplication();
     }
 
     return ok;
 }
 
-bool SDNSubscriberTest::TestSynchronise_MCAST_Timeout() {
+bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_RTT_GetLatest() {
     using namespace MARTe;
     //Standard configuration for testing
     const MARTe::char8 * const config = ""
@@ -3368,10 +3547,11 @@ bool SDNSubscriberTest::TestSynchronise_MCAST_Timeout() {
             "        Class = ReferenceContainer"
             "        DefaultDataSource = DDB1"
             "        +SDNSub = {"
+            "            ExecutionMode = RealTimeThread"
             "            Class = SDNSubscriber"
             "            Topic = Default"
             "            Interface = lo"
-            "            Timeout = 1000"
+            "            InternalTimeout = 1000000"
             "            Signals = {"
             "                Counter = {"
             "                    Type = uint64"
@@ -3424,29 +3604,448 @@ bool SDNSubscriberTest::TestSynchronise_MCAST_Timeout() {
             "    }"
             "}";
 
-    bool ok = ConfigureApplication(config);
-
-    if (ok) {
+    // Instantiate a sdn::Metadata structure to configure the topic
+    sdn::Metadata_t mdata;
+    sdn::Topic_InitializeMetadata(mdata, "Default", 0);
+    // Instantiate SDN topic from metadata specification
+    sdn::Topic* topic = new sdn::Topic;
+    topic->SetMetadata(mdata);
+    sdn::Publisher* publisher;
 
-        ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
-        ReferenceT<RealTimeApplication> application = god->Find("Test");
-        ReferenceT<SDNSubscriber> subscriber = application->Find("Data.SDNSub");
-        ReferenceT<SDNSubscriberTestGAM> sink = application->Find("Functions.Sink");
-        ok = subscriber.IsValid();
+    bool ok = true;
 
-        if (ok) {
-            //fails after timeout
-            ok = !subscriber->Synchronise();
-        }
+    if (ok) {
+        ok = (topic->AddAttribute(0u, "Counter", "uint64") == STATUS_SUCCESS);
     }
-
-    return ok;
-}
-
-bool SDNSubscriberTest::TestSynchronise_MCAST_RTT_Timeout() {
-    using namespace MARTe;
-    //Standard configuration for testing
-    const MARTe::char8 * const config = ""
+    if (ok) {
+        ok = (topic->AddAttribute(1u, "Timestamp", "uint64") == STATUS_SUCCESS);
+    }
+    if (ok) {
+        ok = (topic->AddAttribute(2u, "Reserved", "uint8", 144) == STATUS_SUCCESS);
+    }
+    if (ok) {
+        topic->SetUID(0u); // UID corresponds to the data type but it includes attributes name - Safer to clear with SDN core library 1.0.10
+        ok = (topic->Configure() == STATUS_SUCCESS);
+    }
+    if (ok) {
+        ok = topic->IsInitialized();
+    }
+    // Create sdn::Publisher
+    if (ok) {
+        publisher = new sdn::Publisher(*topic);
+    }
+    if (ok) {
+        ok = (publisher->SetInterface((char*) "lo") == STATUS_SUCCESS);
+    }
+    if (ok) {
+        ok = (publisher->Configure() == STATUS_SUCCESS);
+    }
+
+    if (ok) {
+        ok = ConfigureApplication(config);
+    }
+
+    if (ok) {
+
+        ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+        ReferenceT<RealTimeApplication> application = god->Find("Test");
+        ReferenceT<SDNSubscriber> subscriber = application->Find("Data.SDNSub");
+        ReferenceT<SDNSubscriberTestGAM> sink = application->Find("Functions.Sink");
+        ok = subscriber.IsValid();
+
+        // Prepare data
+        MARTe::uint64 counter = 1ul;
+        MARTe::uint64 timestamp = get_time();
+        if (ok) {
+            ok = (topic->SetAttribute(0u, counter) == STATUS_SUCCESS);
+        }
+        if (ok) {
+            ok = (topic->SetAttribute(1u, timestamp) == STATUS_SUCCESS);
+        }
+        // Send data
+        if (ok) {
+            ok = (publisher->Publish() == STATUS_SUCCESS);
+        }
+
+        ReferenceContainer inputBrokers;
+        sink->GetInputBrokers(inputBrokers);
+
+        for (uint32 i = 0u; i < inputBrokers.Size(); i++) {
+            ReferenceT<BrokerI> broker = inputBrokers.Get(i);
+            if (broker.IsValid()) {
+                broker->Execute();
+            }
+        }
+
+        sink->Execute();
+        // Test reception
+        if (ok) {
+            ok = sink->TestCounter(counter);
+        }
+        if (ok) {
+            ok = sink->TestTimestamp(timestamp);
+        }
+
+        for (uint32 i = 0u; i < 10u; i++) {
+            // Prepare data
+            counter = i;
+            timestamp = get_time();
+            if (ok) {
+                ok = (topic->SetAttribute(0u, counter) == STATUS_SUCCESS);
+            }
+            if (ok) {
+                ok = (topic->SetAttribute(1u, timestamp) == STATUS_SUCCESS);
+            }
+            // Send data
+            if (ok) {
+                ok = (publisher->Publish() == STATUS_SUCCESS);
+            }
+        }
+
+        for (uint32 i = 0u; i < inputBrokers.Size(); i++) {
+            ReferenceT<BrokerI> broker = inputBrokers.Get(i);
+            if (broker.IsValid()) {
+                broker->Execute();
+            }
+        }
+        // Test reception last packet
+        sink->Execute();
+        if (ok) {
+            ok = sink->TestCounter(counter);
+        }
+        if (ok) {
+            ok = sink->TestTimestamp(timestamp);
+        }
+    }
+
+    return ok;
+}
+
+bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_GetLatest() {
+    using namespace MARTe;
+    //Standard configuration for testing
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Sink = {"
+            "            Class = SDNSubscriberTestGAM"
+            "            InputSignals = {"
+            "                Counter = {"
+            "                    DataSource = SDNSub"
+            "                    Frequency = 0."
+            "                    Type = uint64"
+            "                }"
+            "                Timestamp = {"
+            "                    DataSource = SDNSub"
+            "                    Type = uint64"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +SDNSub = {"
+            "            ExecutionMode = IndependentThread"
+            "            Timeout = 1000"
+            "            Class = SDNSubscriber"
+            "            Topic = Default"
+            "            Interface = lo"
+            "            InternalTimeout = 1000000"
+            "            Signals = {"
+            "                Counter = {"
+            "                    Type = uint64"
+            "                }"
+            "                Timestamp = {"
+            "                    Type = uint64"
+            "                }"
+            "                ArrayInt32_1D = {"
+            "                    Type = uint32"
+            "                    NumberOfElements = 10"
+            "                    NumberOfDimensions = 1"
+            "                }"
+            "                ArrayInt32_2D = {"
+            "                    Type = uint32"
+            "                    NumberOfElements = 4"
+            "                    NumberOfDimensions = 2"
+            "                }"
+            "                ArrayFlt32_1D = {"
+            "                    Type = float32"
+            "                    NumberOfElements = 10"
+            "                    NumberOfDimensions = 1"
+            "                }"
+            "                ArrayFlt32_2D = {"
+            "                    Type = float32"
+            "                    NumberOfElements = 4"
+            "                    NumberOfDimensions = 2"
+            "                }"
+            "            }"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Sink}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    // Instantiate a sdn::Metadata structure to configure the topic
+    sdn::Metadata_t mdata;
+    sdn::Topic_InitializeMetadata(mdata, "Default", 0);
+    // Instantiate SDN topic from metadata specification
+    sdn::Topic* topic = new sdn::Topic;
+    topic->SetMetadata(mdata);
+    sdn::Publisher* publisher;
+
+    bool ok = true;
+
+    if (ok) {
+        ok = (topic->AddAttribute(0u, "Counter", "uint64") == STATUS_SUCCESS);
+    }
+    if (ok) {
+        ok = (topic->AddAttribute(1u, "Timestamp", "uint64") == STATUS_SUCCESS);
+    }
+    if (ok) {
+        ok = (topic->AddAttribute(2u, "Reserved", "uint8", 144) == STATUS_SUCCESS);
+    }
+    if (ok) {
+        topic->SetUID(0u); // UID corresponds to the data type but it includes attributes name - Safer to clear with SDN core library 1.0.10
+        ok = (topic->Configure() == STATUS_SUCCESS);
+    }
+    if (ok) {
+        ok = topic->IsInitialized();
+    }
+    // Create sdn::Publisher
+    if (ok) {
+        publisher = new sdn::Publisher(*topic);
+    }
+    if (ok) {
+        ok = (publisher->SetInterface((char*) "lo") == STATUS_SUCCESS);
+    }
+    if (ok) {
+        ok = (publisher->Configure() == STATUS_SUCCESS);
+    }
+
+    if (ok) {
+        ok = ConfigureApplication(config);
+    }
+
+    if (ok) {
+
+        ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+        ReferenceT<RealTimeApplication> application = god->Find("Test");
+        ReferenceT<SDNSubscriber> subscriber = application->Find("Data.SDNSub");
+        ReferenceT<SDNSubscriberTestGAM> sink = application->Find("Functions.Sink");
+        ok = subscriber.IsValid();
+        // Start the receiver thread
+        if (ok) {
+            ok = subscriber->PrepareNextState("", "Running");
+        }
+
+        // Prepare data
+        MARTe::uint64 counter = 1ul;
+        MARTe::uint64 timestamp = get_time();
+        if (ok) {
+            ok = (topic->SetAttribute(0u, counter) == STATUS_SUCCESS);
+        }
+        if (ok) {
+            ok = (topic->SetAttribute(1u, timestamp) == STATUS_SUCCESS);
+        }
+        // Send data
+        if (ok) {
+            ok = (publisher->Publish() == STATUS_SUCCESS);
+        }
+
+        // Let the receiver thread publish the message
+        if (ok) {
+            wait_for(100000000ul);
+        }
+
+        ReferenceContainer inputBrokers;
+        sink->GetInputBrokers(inputBrokers);
+
+        for (uint32 i = 0u; i < inputBrokers.Size(); i++) {
+            ReferenceT<BrokerI> broker = inputBrokers.Get(i);
+            if (broker.IsValid()) {
+                broker->Execute();
+            }
+        }
+
+        sink->Execute();
+        // Test reception
+        if (ok) {
+            ok = sink->TestCounter(counter);
+        }
+        if (ok) {
+            ok = sink->TestTimestamp(timestamp);
+        }
+
+        for (uint32 i = 0u; i < 10u; i++) {
+            // Prepare data
+            counter = i;
+            timestamp = get_time();
+            if (ok) {
+                ok = (topic->SetAttribute(0u, counter) == STATUS_SUCCESS);
+            }
+            if (ok) {
+                ok = (topic->SetAttribute(1u, timestamp) == STATUS_SUCCESS);
+            }
+            // Send data
+            if (ok) {
+                ok = (publisher->Publish() == STATUS_SUCCESS);
+            }
+        }
+
+        // Let the receiver thread publish the messages
+        if (ok) {
+            wait_for(100000000ul);
+        }
+        for (uint32 i = 0u; i < inputBrokers.Size(); i++) {
+            ReferenceT<BrokerI> broker = inputBrokers.Get(i);
+            if (broker.IsValid()) {
+                broker->Execute();
+            }
+        }
+        // Test reception last packet
+        sink->Execute();
+        if (ok) {
+            ok = sink->TestCounter(counter);
+        }
+        if (ok) {
+            ok = sink->TestTimestamp(timestamp);
+        }
+        // The latest message was already read, Synchronise shall wait and time out
+        if (ok) {
+            ok = !subscriber->Synchronise();
+        }
+    }
+
+    return ok;
+}
+
+bool SDNSubscriberTest::TestSynchronise_MCAST_Timeout() {
+    using namespace MARTe;
+    //Standard configuration for testing
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Sink = {"
+            "            Class = SDNSubscriberTestGAM"
+            "            InputSignals = {"
+            "                Counter = {"
+            "                    DataSource = SDNSub"
+            "                    Frequency = 0."
+            "                    Type = uint64"
+            "                }"
+            "                Timestamp = {"
+            "                    DataSource = SDNSub"
+            "                    Type = uint64"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +SDNSub = {"
+            "            Class = SDNSubscriber"
+            "            Topic = Default"
+            "            Interface = lo"
+            "            Timeout = 1000"
+            "            Signals = {"
+            "                Counter = {"
+            "                    Type = uint64"
+            "                }"
+            "                Timestamp = {"
+            "                    Type = uint64"
+            "                }"
+            "                ArrayInt32_1D = {"
+            "                    Type = uint32"
+            "                    NumberOfElements = 10"
+            "                    NumberOfDimensions = 1"
+            "                }"
+            "                ArrayInt32_2D = {"
+            "                    Type = uint32"
+            "                    NumberOfElements = 4"
+            "                    NumberOfDimensions = 2"
+            "                }"
+            "                ArrayFlt32_1D = {"
+            "                    Type = float32"
+            "                    NumberOfElements = 10"
+            "                    NumberOfDimensions = 1"
+            "                }"
+            "                ArrayFlt32_2D = {"
+            "                    Type = float32"
+            "                    NumberOfElements = 4"
+            "                    NumberOfDimensions = 2"
+            "                }"
+            "            }"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Sink}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = ConfigureApplication(config);
+
+    if (ok) {
+
+        ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+        ReferenceT<RealTimeApplication> application = god->Find("Test");
+        ReferenceT<SDNSubscriber> subscriber = application->Find("Data.SDNSub");
+        ReferenceT<SDNSubscriberTestGAM> sink = application->Find("Functions.Sink");
+        ok = subscriber.IsValid();
+
+        if (ok) {
+            //fails after timeout
+            ok = !subscriber->Synchronise();
+        }
+    }
+
+    return ok;
+}
+
+bool SDNSubscriberTest::TestSynchronise_MCAST_RTT_Timeout() {
+    using namespace MARTe;
+    //Standard configuration for testing
+    const MARTe::char8 * const config = ""
             "$Test = {"
             "    Class = RealTimeApplication"
             "    +Functions = {"
@@ -4347,6 +4946,236 @@ bool SDNSubscriberTest::TestSynchronise_NetworkByteOrder_Topic_1_Header() {
 }
 
 #endif
+/**
+ * Publishes a fragment of the payload (Counter, Timestamp and ArrayInt32_1D) of TestSynchronise_MCAST_Topic_Fragmented.
+ */
+static bool SDNSubscriberTestPublishFragment(sdn::Topic *topic,
+                                             sdn::Publisher *publisher,
+                                             const MARTe::uint32 messageCounter,
+                                             const MARTe::uint32 offset,
+                                             const MARTe::uint32 totalSize,
+                                             const MARTe::char8 * const payload) {
+    using namespace MARTe;
+    const uint32 fragmentSize = 16u;
+    *static_cast<uint32 *>(topic->GetTypeDefinition()->GetAttributeReference(0u)) = messageCounter;
+    *static_cast<uint32 *>(topic->GetTypeDefinition()->GetAttributeReference(1u)) = offset;
+    *static_cast<uint32 *>(topic->GetTypeDefinition()->GetAttributeReference(2u)) = totalSize;
+    uint32 length = 56u - offset;
+    if (length > fragmentSize) {
+        length = fragmentSize;
+    }
+    bool ok = MemoryOperationsHelper::Copy(topic->GetTypeDefinition()->GetAttributeReference(3u), &payload[offset], length);
+    if (ok) {
+        ok = (publisher->Publish() == STATUS_SUCCESS);
+    }
+    return ok;
+}
+
+bool SDNSubscriberTest::TestSynchronise_MCAST_Topic_Fragmented() {
+    using namespace MARTe;
+    //Standard configuration for testing
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Sink = {"
+            "            Class = SDNSubscriberTestGAM"
+            "            InputSignals = {"
+            "                Counter = {"
+            "                    DataSource = SDNSub"
+            "                    Frequency = 1."
+            "                    Type = uint64"
+            "                }"
+            "                Timestamp = {"
+            "                    DataSource = SDNSub"
+            "                    Type = uint64"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +SDNSub = {"
+            "            ExecutionMode = IndependentThread"
+            "            Class = SDNSubscriber"
+            "            Topic = Fragmented"
+            "            Interface = lo"
+            "            InternalTimeout = 1000000"
+            "            FragmentSize = 16"
+            "            Signals = {"
+            "                Counter = {"
+            "                    Type = uint64"
+            "                }"
+            "                Timestamp = {"
+            "                    Type = uint64"
+            "                }"
+            "                ArrayInt32_1D = {"
+            "                    Type = uint32"
+            "                    NumberOfElements = 10"
+            "                    NumberOfDimensions = 1"
+            "                }"
+            "            }"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Sink}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    // Instantiate a sdn::Metadata structure to configure the fragment topic
+    sdn::Metadata_t mdata;
+    sdn::Topic_InitializeMetadata(mdata, "Fragmented", 0);
+    // Instantiate SDN topic from metadata specification
+    sdn::Topic* topic = new sdn::Topic;
+    topic->SetMetadata(mdata);
+    sdn::Publisher* publisher = NULL_PTR(sdn::Publisher*);
+
+    bool ok = true;
+
+    if (ok) {
+        ok = (topic->AddAttribute(0u, "MessageCounter", "uint32") == STATUS_SUCCESS);
+    }
+    if (ok) {
+        ok = (topic->AddAttribute(1u, "Offset", "uint32") == STATUS_SUCCESS);
+    }
+    if (ok) {
+        ok = (topic->AddAttribute(2u, "TotalSize", "uint32") == STATUS_SUCCESS);
+    }
+    if (ok) {
+        ok = (topic->AddAttribute(3u, "Fragment", "uint8", 16u) == STATUS_SUCCESS);
+    }
+    if (ok) {
+        topic->SetUID(0u); // UID corresponds to the data type but it includes attributes name - Safer to clear with SDN core library 1.0.10
+        ok = (topic->Configure() == STATUS_SUCCESS);
+    }
+    if (ok) {
+        ok = topic->IsInitialized();
+    }
+    // Create sdn::Publisher
+    if (ok) {
+        publisher = new sdn::Publisher(*topic);
+    }
+    if (ok) {
+        ok = (publisher->SetInterface((char*) "lo") == STATUS_SUCCESS);
+    }
+    if (ok) {
+        ok = (publisher->Configure() == STATUS_SUCCESS);
+    }
+
+    if (ok) {
+        ok = ConfigureApplication(config);
+    }
+
+    if (ok) {
+        ok = StartApplication();
+    }
+
+    if (ok) {
+
+        ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+        ReferenceT<RealTimeApplication> application = god->Find("Test");
+        ReferenceT<SDNSubscriber> subscriber = application->Find("Data.SDNSub");
+        ReferenceT<SDNSubscriberTestGAM> sink = application->Find("Functions.Sink");
+        ok = ((subscriber.IsValid()) && (sink.IsValid()));
+
+        // 56 bytes of payload in 4 fragments
+        char8 payload[56u];
+        MARTe::uint64 counter = 10ul;
+        MARTe::uint64 timestamp = get_time();
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(&payload[0], '\0', 56u);
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Copy(&payload[0], &counter, sizeof(MARTe::uint64));
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Copy(&payload[8], &timestamp, sizeof(MARTe::uint64));
+        }
+        // Out of order
+        if (ok) {
+            ok = SDNSubscriberTestPublishFragment(topic, publisher, 1u, 48u, 56u, &payload[0]);
+        }
+        if (ok) {
+            ok = SDNSubscriberTestPublishFragment(topic, publisher, 1u, 16u, 56u, &payload[0]);
+        }
+        if (ok) {
+            ok = SDNSubscriberTestPublishFragment(topic, publisher, 1u, 0u, 56u, &payload[0]);
+        }
+        if (ok) {
+            ok = SDNSubscriberTestPublishFragment(topic, publisher, 1u, 32u, 56u, &payload[0]);
+        }
+        if (ok) {
+            wait_for(500000000ul);
+        }
+        if (ok) {
+            ok = sink->TestCounter(counter);
+        }
+        if (ok) {
+            ok = sink->TestTimestamp(timestamp);
+        }
+        // Incomplete message followed by a complete one and by an invalid fragment
+        if (ok) {
+            counter = 11ul;
+            ok = MemoryOperationsHelper::Copy(&payload[0], &counter, sizeof(MARTe::uint64));
+        }
+        if (ok) {
+            ok = SDNSubscriberTestPublishFragment(topic, publisher, 2u, 0u, 56u, &payload[0]);
+        }
+        if (ok) {
+            counter = 12ul;
+            ok = MemoryOperationsHelper::Copy(&payload[0], &counter, sizeof(MARTe::uint64));
+        }
+        uint32 offset;
+        for (offset = 0u; (offset < 56u) && (ok); offset += 16u) {
+            ok = SDNSubscriberTestPublishFragment(topic, publisher, 3u, offset, 56u, &payload[0]);
+        }
+        if (ok) {
+            ok = SDNSubscriberTestPublishFragment(topic, publisher, 4u, 0u, 64u, &payload[0]);
+        }
+        if (ok) {
+            wait_for(500000000ul);
+        }
+        if (ok) {
+            ok = sink->TestCounter(counter);
+        }
+        if (ok) {
+            ok = (subscriber->GetNumberOfIncompleteMessages() == 1u);
+        }
+        if (ok) {
+            ok = (subscriber->GetNumberOfInvalidFragments() == 1u);
+        }
+    }
+
+    if (ok) {
+        ok = StopApplication();
+    }
+    if (publisher != NULL_PTR(sdn::Publisher*)) {
+        delete publisher;
+    }
+    delete topic;
+
+    return ok;
+}
+
 bool SDNSubscriberTest::TestExecute_False() {
     using namespace MARTe;
     SDNSubscriber test;
@@ -93,6 +93,21 @@ public:
      */
     bool TestInitialise_CPUMask();
 
+    /**
+     * @brief Tests the Initialise method with ExecutionMode = SharedThread.
+     */
+    bool TestInitialise_SharedThread();
+
+    /**
+     * @brief Tests the Initialise method with FragmentSize > 0.
+     */
+    bool TestInitialise_FragmentSize();
+
+    /**
+     * @brief Tests that the Initialise method fails with FragmentSize > 0 and ExecutionMode = RealTimeThread.
+     */
+    bool TestInitialise_False_FragmentSize_RealTimeThread();
+
     /**
      * @brief Tests the Initialise method with .
      */
@@ -158,6 +173,16 @@ public:
      */
     bool TestSetConfiguredDatabase_Header();
 
+    /**
+     * @brief Tests the SetConfiguredDatabase method with Statistics = 1.
+     */
+    bool TestSetConfiguredDatabase_Statistics();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method with Statistics = 1 and a wrong statistics signal type.
+     */
+    bool TestSetConfiguredDatabase_False_Statistics();
+
     /**
      * @brief Tests the SetConfiguredDatabase method without signals.
      */
@@ -303,6 +328,16 @@ public:
      */
     bool TestSynchronise_MCAST_Topic_RTT_GetLatest();
 
+    /**
+     * @brief Tests that the Synchronise method with IndependentThread returns the latest message only once.
+     */
+    bool TestSynchronise_MCAST_Topic_GetLatest();
+
+    /**
+     * @brief Tests the Synchronise method with ExecutionMode = SharedThread.
+     */
+    bool TestSynchronise_MCAST_Topic_SharedThread();
+
     /**
      * @brief Tests the Synchronise method.
      */
@@ -324,6 +359,11 @@ public:
      */
     bool TestSynchronise_MCAST_RTT_IgnoreTimeoutError();
 
+    /**
+     * @brief Tests the Synchronise method with a payload received in fragments (out of order, incomplete and invalid).
+     */
+    bool TestSynchronise_MCAST_Topic_Fragmented();
+
 #ifdef FEATURE_10840
     /**
      * @brief Tests the Synchronise method.
@@ -0,0 +1,91 @@
+/**
+ * @file TCPStreamReaderGTest.cpp
+ * @brief Source file for class TCPStreamReaderGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class TCPStreamReaderGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "gtest/gtest.h"
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "TCPStreamReaderTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(TCPStreamReaderGTest,TestConstructor) {
+    TCPStreamReaderTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(TCPStreamReaderGTest,TestInitialise) {
+    TCPStreamReaderTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(TCPStreamReaderGTest,TestInitialise_False_No_Port) {
+    TCPStreamReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_No_Port());
+}
+
+TEST(TCPStreamReaderGTest,TestSetConfiguredDatabase_False_Statistics) {
+    TCPStreamReaderTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_Statistics());
+}
+
+TEST(TCPStreamReaderGTest,TestSetConfiguredDatabase_False_No_Payload) {
+    TCPStreamReaderTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_No_Payload());
+}
+
+TEST(TCPStreamReaderGTest,TestGetBrokerName) {
+    TCPStreamReaderTest test;
+    ASSERT_TRUE(test.TestGetBrokerName());
+}
+
+TEST(TCPStreamReaderGTest,TestPrepareNextState) {
+    TCPStreamReaderTest test;
+    ASSERT_TRUE(test.TestPrepareNextState());
+}
+
+TEST(TCPStreamReaderGTest,TestSynchronise) {
+    TCPStreamReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise());
+}
+
+TEST(TCPStreamReaderGTest,TestSynchronise_Statistics) {
+    TCPStreamReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_Statistics());
+}
+
+TEST(TCPStreamReaderGTest,TestExecute_InvalidFrame) {
+    TCPStreamReaderTest test;
+    ASSERT_TRUE(test.TestExecute_InvalidFrame());
+}
@@ -0,0 +1,672 @@
+/**
+ * @file TCPStreamReaderTest.cpp
+ * @brief Source file for class TCPStreamReaderTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class TCPStreamReaderTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "GAMSchedulerI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+#include "TCPStreamReader.h"
+#include "TCPStreamReaderTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Manual scheduler to test the correct interface between the TCPStreamReader and the GAMs
+ */
+class TCPStreamReaderSchedulerTestHelper: public MARTe::GAMSchedulerI {
+public:
+
+    CLASS_REGISTER_DECLARATION()
+
+    TCPStreamReaderSchedulerTestHelper() :
+            MARTe::GAMSchedulerI() {
+        scheduledStates = NULL;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StartNextStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StopCurrentStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    void ExecuteThreadCycle(MARTe::uint32 threadId) {
+        using namespace MARTe;
+        ReferenceT<RealTimeApplication> rtAppT = realTimeApp;
+        ExecuteSingleCycle(scheduledStates[rtAppT->GetIndex()]->threads[threadId].executables,
+                scheduledStates[rtAppT->GetIndex()]->threads[threadId].numberOfExecutables);
+    }
+
+    virtual bool ConfigureScheduler(MARTe::Reference realTimeApp) {
+
+        bool ret = GAMSchedulerI::ConfigureScheduler(realTimeApp);
+        if (ret) {
+            scheduledStates = GetSchedulableStates();
+        }
+        return ret;
+    }
+
+    virtual void CustomPrepareNextState() {
+    }
+
+private:
+
+    MARTe::ScheduledState * const * scheduledStates;
+};
+
+CLASS_REGISTER(TCPStreamReaderSchedulerTestHelper, "1.0")
+
+/**
+ * @brief Stores the (up to three) uint32 input signals and copies the last one to the output.
+ */
+class TCPStreamReaderTestGAM: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    TCPStreamReaderTestGAM() :
+            MARTe::GAM() {
+        numberOfValues = 0u;
+        values[0u] = 0u;
+        values[1u] = 0u;
+        values[2u] = 0u;
+    }
+
+    bool Setup() {
+        numberOfValues = GetNumberOfInputSignals();
+        return (numberOfValues > 0u) && (numberOfValues <= 3u);
+    }
+
+    bool Execute() {
+        using namespace MARTe;
+        (void) MemoryOperationsHelper::Copy(&values[0u], GetInputSignalsMemory(), numberOfValues * 4u);
+        return MemoryOperationsHelper::Copy(GetOutputSignalsMemory(), &values[numberOfValues - 1u], 4u);
+    }
+
+    MARTe::uint32 GetValue(const MARTe::uint32 idx) const {
+        return values[idx];
+    }
+
+    MARTe::uint32 GetLastValue() const {
+        return values[numberOfValues - 1u];
+    }
+
+private:
+    MARTe::uint32 numberOfValues;
+
+    MARTe::uint32 values[3];
+};
+
+CLASS_REGISTER(TCPStreamReaderTestGAM, "1.0")
+
+/**
+ * @brief Connects to the reader and sends one frame for each sequence number, with payload sequence + 96.
+ */
+static bool SendFrames(const MARTe::uint16 port,
+                       const MARTe::uint64 * const sequences,
+                       const MARTe::uint32 numberOfFrames,
+                       const MARTe::uint32 magic) {
+    using namespace MARTe;
+    int32 fd = socket(AF_INET, SOCK_STREAM, 0);
+    bool ok = (fd >= 0);
+    if (ok) {
+        struct sockaddr_in destination;
+        (void) memset(&destination, 0, sizeof(destination));
+        destination.sin_family = AF_INET;
+        destination.sin_port = htons(port);
+        destination.sin_addr.s_addr = inet_addr("127.0.0.1");
+        ok = (connect(fd, reinterpret_cast<struct sockaddr *>(&destination), static_cast<socklen_t>(sizeof(destination))) == 0);
+    }
+    for (uint32 i = 0u; (i < numberOfFrames) && (ok); i++) {
+        char8 frame[TCP_STREAM_FRAME_HEADER_SIZE + 4u];
+        TCPStreamFrameHeader header;
+        header.magic = magic;
+        header.payloadSize = 4u;
+        header.sequence = sequences[i];
+        uint32 value = static_cast<uint32>(sequences[i]) + 96u;
+        (void) memcpy(&frame[0u], &header, TCP_STREAM_FRAME_HEADER_SIZE);
+        (void) memcpy(&frame[TCP_STREAM_FRAME_HEADER_SIZE], &value, 4u);
+        ok = (write(fd, &frame[0u], sizeof(frame)) == static_cast<ssize_t>(sizeof(frame)));
+    }
+    if (fd >= 0) {
+        (void) close(fd);
+    }
+    return ok;
+}
+
+/**
+ * @brief Loads the configuration, sends the frames and executes the Thread1 of State1 until the GAM receives 99
+ * (or the reader counts an invalid frame).
+ */
+static bool TestReceiveExecution(const MARTe::char8 * const config,
+                                 const MARTe::uint32 magic,
+                                 const bool statistics) {
+    using namespace MARTe;
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    ReferenceT<TCPStreamReaderSchedulerTestHelper> scheduler;
+    ReferenceT<TCPStreamReaderTestGAM> hGam;
+    ReferenceT<TCPStreamReader> reader;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        scheduler = application->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        hGam = application->Find("Functions.GAMReceiver");
+        ok = hGam.IsValid();
+    }
+    if (ok) {
+        reader = application->Find("Data.TCPReader");
+        ok = reader.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    const bool valid = (magic == TCP_STREAM_FRAME_MAGIC);
+    if (ok) {
+        //Frame 2 is missing
+        const uint64 sequences[] = { 0u, 1u, 3u };
+        ok = SendFrames(reader->GetPort(), &sequences[0u], 3u, magic);
+    }
+    if (ok) {
+        bool done = false;
+        for (uint32 i = 0u; (i < 100u) && (!done); i++) {
+            scheduler->ExecuteThreadCycle(0u);
+            Sleep::MSec(20);
+            if (valid) {
+                done = (hGam->GetLastValue() == 99u);
+            }
+            else {
+                done = (reader->GetNumberOfInvalidFrames() == 1u);
+            }
+        }
+        ok = done;
+    }
+    if (ok) {
+        if (valid) {
+            ok = (reader->GetNumberOfFrames() == 3u);
+            if (ok) {
+                ok = (reader->GetNumberOfLostFrames() == 1u);
+            }
+            if ((ok) && (statistics)) {
+                ok = (hGam->GetValue(0u) == 3u);
+                if (ok) {
+                    ok = (hGam->GetValue(1u) == 1u);
+                }
+            }
+        }
+        else {
+            ok = (reader->GetNumberOfFrames() == 0u);
+            if (ok) {
+                ok = (hGam->GetLastValue() == 0u);
+            }
+        }
+    }
+    if (ok) {
+        ok = (reader->GetNumberOfConnections() == 1u);
+    }
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    god->Purge();
+
+    return ok;
+}
+
+/**
+ * @brief Loads the configuration and configures the application.
+ */
+static bool TestConfigureApplication(const MARTe::char8 * const config) {
+    using namespace MARTe;
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    god->Purge();
+
+    return ok;
+}
+
+//Correct configuration
+static const MARTe::char8 * const config1 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TCPStreamReaderTestGAM"
+        "            InputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPReader"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +TCPReader = {"
+        "            Class = TCPStream::TCPStreamReader"
+        "            Port = 45694"
+        "            Signals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = TCPStreamReaderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//With the Statistics signals
+static const MARTe::char8 * const config2 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TCPStreamReaderTestGAM"
+        "            InputSignals = {"
+        "                FrameCount = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPReader"
+        "                }"
+        "                LostFrames = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPReader"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPReader"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +TCPReader = {"
+        "            Class = TCPStream::TCPStreamReader"
+        "            Port = 45695"
+        "            ReceiveBufferSize = 1048576"
+        "            Statistics = 1"
+        "            Signals = {"
+        "                FrameCount = {"
+        "                    Type = uint32"
+        "                }"
+        "                LostFrames = {"
+        "                    Type = uint32"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = TCPStreamReaderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Statistics signals which are not uint32
+static const MARTe::char8 * const config3 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TCPStreamReaderTestGAM"
+        "            InputSignals = {"
+        "                FrameCount = {"
+        "                    Type = float32"
+        "                    DataSource = TCPReader"
+        "                }"
+        "                LostFrames = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPReader"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPReader"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +TCPReader = {"
+        "            Class = TCPStream::TCPStreamReader"
+        "            Port = 45696"
+        "            Statistics = 1"
+        "            Signals = {"
+        "                FrameCount = {"
+        "                    Type = float32"
+        "                }"
+        "                LostFrames = {"
+        "                    Type = uint32"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = TCPStreamReaderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Only the Statistics signals
+static const MARTe::char8 * const config4 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TCPStreamReaderTestGAM"
+        "            InputSignals = {"
+        "                FrameCount = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPReader"
+        "                }"
+        "                LostFrames = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPReader"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +TCPReader = {"
+        "            Class = TCPStream::TCPStreamReader"
+        "            Port = 45696"
+        "            Statistics = 1"
+        "            Signals = {"
+        "                FrameCount = {"
+        "                    Type = uint32"
+        "                }"
+        "                LostFrames = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = TCPStreamReaderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool TCPStreamReaderTest::TestConstructor() {
+    using namespace MARTe;
+    TCPStreamReader test;
+    bool ok = (test.GetPort() == 0u);
+    ok &= (test.GetReceiveBufferSize() == 0u);
+    ok &= (test.GetCPUMask() == 0xFFFFFFFFu);
+    ok &= (test.GetStackSize() == THREADS_DEFAULT_STACKSIZE);
+    ok &= (!test.IsStatisticsEnabled());
+    ok &= (!test.IsConnected());
+    ok &= (test.GetNumberOfFrames() == 0u);
+    ok &= (test.GetNumberOfLostFrames() == 0u);
+    ok &= (test.GetNumberOfInvalidFrames() == 0u);
+    ok &= (test.GetNumberOfConnections() == 0u);
+    return ok;
+}
+
+bool TCPStreamReaderTest::TestInitialise() {
+    using namespace MARTe;
+    TCPStreamReader test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45694);
+    cdb.Write("ReceiveBufferSize", 4194304);
+    cdb.Write("Statistics", 1);
+    cdb.Write("CPUMask", 0x2);
+    cdb.Write("StackSize", 1048576);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetPort() == 45694u);
+    ok &= (test.GetReceiveBufferSize() == 4194304u);
+    ok &= (test.IsStatisticsEnabled());
+    ok &= (test.GetCPUMask() == 0x2u);
+    ok &= (test.GetStackSize() == 1048576u);
+    return ok;
+}
+
+bool TCPStreamReaderTest::TestInitialise_False_No_Port() {
+    using namespace MARTe;
+    TCPStreamReader test;
+    ConfigurationDatabase cdb;
+    cdb.Write("ReceiveBufferSize", 4194304);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool TCPStreamReaderTest::TestSetConfiguredDatabase_False_Statistics() {
+    return !TestConfigureApplication(config3);
+}
+
+bool TCPStreamReaderTest::TestSetConfiguredDatabase_False_No_Payload() {
+    return !TestConfigureApplication(config4);
+}
+
+bool TCPStreamReaderTest::TestGetBrokerName() {
+    using namespace MARTe;
+    TCPStreamReader test;
+    ConfigurationDatabase cdb;
+    bool ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "MemoryMapSynchronisedInputBroker") == 0);
+    if (ok) {
+        ok = (test.GetBrokerName(cdb, OutputSignals) == NULL_PTR(const char8 *));
+    }
+    return ok;
+}
+
+bool TCPStreamReaderTest::TestPrepareNextState() {
+    using namespace MARTe;
+    TCPStreamReader test;
+    return test.PrepareNextState("State1", "State1");
+}
+
+bool TCPStreamReaderTest::TestSynchronise() {
+    return TestReceiveExecution(config1, MARTe::TCP_STREAM_FRAME_MAGIC, false);
+}
+
+bool TCPStreamReaderTest::TestSynchronise_Statistics() {
+    return TestReceiveExecution(config2, MARTe::TCP_STREAM_FRAME_MAGIC, true);
+}
+
+bool TCPStreamReaderTest::TestExecute_InvalidFrame() {
+    return TestReceiveExecution(config1, 0xDEADBEEFu, false);
+}
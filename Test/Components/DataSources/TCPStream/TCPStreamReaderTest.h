@@ -0,0 +1,99 @@
+/**
+ * @file TCPStreamReaderTest.h
+ * @brief Header file for class TCPStreamReaderTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class TCPStreamReaderTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_COMPONENTS_DATASOURCES_TCPSTREAM_TCPSTREAMREADERTEST_H_
+#define TEST_COMPONENTS_DATASOURCES_TCPSTREAM_TCPSTREAMREADERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Tests the TCPStreamReader public methods.
+ */
+class TCPStreamReaderTest {
+public:
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method with all the parameters.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails without Port.
+     */
+    bool TestInitialise_False_No_Port();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails with statistics signals which are not uint32.
+     */
+    bool TestSetConfiguredDatabase_False_Statistics();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails without payload signals.
+     */
+    bool TestSetConfiguredDatabase_False_No_Payload();
+
+    /**
+     * @brief Tests the GetBrokerName method.
+     */
+    bool TestGetBrokerName();
+
+    /**
+     * @brief Tests the PrepareNextState method.
+     */
+    bool TestPrepareNextState();
+
+    /**
+     * @brief Tests the Synchronise method with frames sent by a raw socket, including a gap in the sequence numbers.
+     */
+    bool TestSynchronise();
+
+    /**
+     * @brief Tests the Synchronise method with the Statistics signals.
+     */
+    bool TestSynchronise_Statistics();
+
+    /**
+     * @brief Tests that the Execute method closes the connection on an invalid frame.
+     */
+    bool TestExecute_InvalidFrame();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_COMPONENTS_DATASOURCES_TCPSTREAM_TCPSTREAMREADERTEST_H_ */
@@ -0,0 +1,116 @@
+/**
+ * @file TCPStreamWriterGTest.cpp
+ * @brief Source file for class TCPStreamWriterGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class TCPStreamWriterGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "gtest/gtest.h"
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "TCPStreamWriterTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(TCPStreamWriterGTest,TestConstructor) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(TCPStreamWriterGTest,TestInitialise) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(TCPStreamWriterGTest,TestInitialise_Defaults) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_Defaults());
+}
+
+TEST(TCPStreamWriterGTest,TestInitialise_False_No_Address) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_No_Address());
+}
+
+TEST(TCPStreamWriterGTest,TestInitialise_False_Invalid_Address) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Invalid_Address());
+}
+
+TEST(TCPStreamWriterGTest,TestInitialise_False_No_Port) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_No_Port());
+}
+
+TEST(TCPStreamWriterGTest,TestInitialise_False_QueueSize) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_QueueSize());
+}
+
+TEST(TCPStreamWriterGTest,TestInitialise_False_ReconnectPeriod) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_ReconnectPeriod());
+}
+
+TEST(TCPStreamWriterGTest,TestSetConfiguredDatabase_False_QueueDepth) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_QueueDepth());
+}
+
+TEST(TCPStreamWriterGTest,TestSetConfiguredDatabase_False_No_Payload) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_No_Payload());
+}
+
+TEST(TCPStreamWriterGTest,TestGetBrokerName) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestGetBrokerName());
+}
+
+TEST(TCPStreamWriterGTest,TestPrepareNextState) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestPrepareNextState());
+}
+
+TEST(TCPStreamWriterGTest,TestSynchronise) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestSynchronise());
+}
+
+TEST(TCPStreamWriterGTest,TestSynchronise_QueueDepth) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestSynchronise_QueueDepth());
+}
+
+TEST(TCPStreamWriterGTest,TestSynchronise_Not_Connected) {
+    TCPStreamWriterTest test;
+    ASSERT_TRUE(test.TestSynchronise_Not_Connected());
+}
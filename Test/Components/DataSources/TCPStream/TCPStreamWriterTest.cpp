@@ -0,0 +1,774 @@
+/**
+ * @file TCPStreamWriterTest.cpp
+ * @brief Source file for class TCPStreamWriterTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class TCPStreamWriterTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "GAMSchedulerI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+#include "TCPStreamReader.h"
+#include "TCPStreamWriter.h"
+#include "TCPStreamWriterTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Manual scheduler to test the correct interface between the TCPStreamWriter and the GAMs
+ */
+class TCPStreamWriterSchedulerTestHelper: public MARTe::GAMSchedulerI {
+public:
+
+    CLASS_REGISTER_DECLARATION()
+
+    TCPStreamWriterSchedulerTestHelper() :
+            MARTe::GAMSchedulerI() {
+        scheduledStates = NULL;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StartNextStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StopCurrentStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    void ExecuteThreadCycle(MARTe::uint32 threadId) {
+        using namespace MARTe;
+        ReferenceT<RealTimeApplication> rtAppT = realTimeApp;
+        ExecuteSingleCycle(scheduledStates[rtAppT->GetIndex()]->threads[threadId].executables,
+                scheduledStates[rtAppT->GetIndex()]->threads[threadId].numberOfExecutables);
+    }
+
+    virtual bool ConfigureScheduler(MARTe::Reference realTimeApp) {
+
+        bool ret = GAMSchedulerI::ConfigureScheduler(realTimeApp);
+        if (ret) {
+            scheduledStates = GetSchedulableStates();
+        }
+        return ret;
+    }
+
+    virtual void CustomPrepareNextState() {
+    }
+
+private:
+
+    MARTe::ScheduledState * const * scheduledStates;
+};
+
+CLASS_REGISTER(TCPStreamWriterSchedulerTestHelper, "1.0")
+
+/**
+ * @brief Writes 99 in the output signal and stores the QueueDepth input signal (if any).
+ */
+class TCPStreamWriterSourceTestGAM: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    TCPStreamWriterSourceTestGAM() :
+            MARTe::GAM() {
+        queueDepth = 0u;
+    }
+
+    bool Setup() {
+        return true;
+    }
+
+    bool Execute() {
+        using namespace MARTe;
+        if (GetNumberOfInputSignals() > 0u) {
+            queueDepth = *reinterpret_cast<uint32 *>(GetInputSignalsMemory());
+        }
+        uint32 value = 99u;
+        return MemoryOperationsHelper::Copy(GetOutputSignalsMemory(), &value, 4u);
+    }
+
+    MARTe::uint32 GetQueueDepth() const {
+        return queueDepth;
+    }
+
+private:
+    MARTe::uint32 queueDepth;
+};
+
+CLASS_REGISTER(TCPStreamWriterSourceTestGAM, "1.0")
+
+/**
+ * @brief Stores the value received.
+ */
+class TCPStreamWriterSinkTestGAM: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    TCPStreamWriterSinkTestGAM() :
+            MARTe::GAM() {
+        value = 0u;
+    }
+
+    bool Setup() {
+        return true;
+    }
+
+    bool Execute() {
+        using namespace MARTe;
+        value = *reinterpret_cast<uint32 *>(GetInputSignalsMemory());
+        return MemoryOperationsHelper::Copy(GetOutputSignalsMemory(), GetInputSignalsMemory(), 4u);
+    }
+
+    MARTe::uint32 GetValue() const {
+        return value;
+    }
+
+private:
+    MARTe::uint32 value;
+};
+
+CLASS_REGISTER(TCPStreamWriterSinkTestGAM, "1.0")
+
+/**
+ * @brief Loads the configuration and executes the Thread1 of State1 until the sink GAM (if any) receives 99 or
+ * for numberOfCycles.
+ */
+static bool TestStreamExecution(const MARTe::char8 * const config,
+                                const bool expectReceived,
+                                MARTe::uint32 numberOfCycles = 100u) {
+    using namespace MARTe;
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    ReferenceT<TCPStreamWriterSchedulerTestHelper> scheduler;
+    ReferenceT<TCPStreamWriterSinkTestGAM> sinkGAM;
+    ReferenceT<TCPStreamWriterSourceTestGAM> sourceGAM;
+    ReferenceT<TCPStreamWriter> writer;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        scheduler = application->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        writer = application->Find("Data.TCPWriter");
+        ok = writer.IsValid();
+    }
+    if (ok) {
+        sourceGAM = application->Find("Functions.GAMWriter");
+        ok = sourceGAM.IsValid();
+    }
+    if (ok) {
+        sinkGAM = application->Find("Functions.GAMReader");
+        ok = (sinkGAM.IsValid() == expectReceived);
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    bool received = false;
+    if (ok) {
+        for (uint32 i = 0u; (i < numberOfCycles) && (!received); i++) {
+            scheduler->ExecuteThreadCycle(0u);
+            Sleep::MSec(20);
+            if (expectReceived) {
+                received = (sinkGAM->GetValue() == 99u);
+            }
+        }
+    }
+    if (ok) {
+        if (expectReceived) {
+            ok = received;
+            if (ok) {
+                ok = (writer->GetNumberOfSentFrames() > 0u);
+            }
+            if (ok) {
+                ok = (writer->GetNumberOfConnections() == 1u);
+            }
+            if (ok) {
+                ok = (sourceGAM->GetQueueDepth() <= writer->GetQueueSize());
+            }
+        }
+        else {
+            ok = (writer->GetNumberOfSentFrames() == 0u);
+            if (ok) {
+                ok = (writer->GetNumberOfDroppedFrames() == numberOfCycles);
+            }
+            if (ok) {
+                ok = (!writer->IsConnected());
+            }
+        }
+    }
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    god->Purge();
+
+    return ok;
+}
+
+//Writer and reader in the same application
+static const MARTe::char8 * const config1 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMWriter = {"
+        "            Class = TCPStreamWriterSourceTestGAM"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPWriter"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMReader = {"
+        "            Class = TCPStreamWriterSinkTestGAM"
+        "            InputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPReader"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +TCPWriter = {"
+        "            Class = TCPStream::TCPStreamWriter"
+        "            Address = \"127.0.0.1\""
+        "            Port = 45690"
+        "            ReconnectPeriod = 0.1"
+        "            SendBufferSize = 1048576"
+        "            Signals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "        +TCPReader = {"
+        "            Class = TCPStream::TCPStreamReader"
+        "            Port = 45690"
+        "            ReceiveBufferSize = 1048576"
+        "            Signals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMWriter GAMReader}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = TCPStreamWriterSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Writer and reader in the same application, with the QueueDepth signal
+static const MARTe::char8 * const config2 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMWriter = {"
+        "            Class = TCPStreamWriterSourceTestGAM"
+        "            InputSignals = {"
+        "                QueueDepth = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPWriter"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPWriter"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMReader = {"
+        "            Class = TCPStreamWriterSinkTestGAM"
+        "            InputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPReader"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +TCPWriter = {"
+        "            Class = TCPStream::TCPStreamWriter"
+        "            Address = \"127.0.0.1\""
+        "            Port = 45691"
+        "            ReconnectPeriod = 0.1"
+        "            QueueSize = 4"
+        "            QueueDepth = 1"
+        "            Signals = {"
+        "                QueueDepth = {"
+        "                    Type = uint32"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "        +TCPReader = {"
+        "            Class = TCPStream::TCPStreamReader"
+        "            Port = 45691"
+        "            Signals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMWriter GAMReader}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = TCPStreamWriterSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//QueueDepth signal which is not uint32
+static const MARTe::char8 * const config3 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMWriter = {"
+        "            Class = TCPStreamWriterSourceTestGAM"
+        "            InputSignals = {"
+        "                QueueDepth = {"
+        "                    Type = float32"
+        "                    DataSource = TCPWriter"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPWriter"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +TCPWriter = {"
+        "            Class = TCPStream::TCPStreamWriter"
+        "            Address = \"127.0.0.1\""
+        "            Port = 45692"
+        "            QueueDepth = 1"
+        "            Signals = {"
+        "                QueueDepth = {"
+        "                    Type = float32"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMWriter}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = TCPStreamWriterSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Only the QueueDepth signal
+static const MARTe::char8 * const config4 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMWriter = {"
+        "            Class = TCPStreamWriterSourceTestGAM"
+        "            InputSignals = {"
+        "                QueueDepth = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPWriter"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +TCPWriter = {"
+        "            Class = TCPStream::TCPStreamWriter"
+        "            Address = \"127.0.0.1\""
+        "            Port = 45692"
+        "            QueueDepth = 1"
+        "            Signals = {"
+        "                QueueDepth = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMWriter}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = TCPStreamWriterSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Writer without a reader (nobody listening on the port)
+static const MARTe::char8 * const config5 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMWriter = {"
+        "            Class = TCPStreamWriterSourceTestGAM"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = TCPWriter"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +TCPWriter = {"
+        "            Class = TCPStream::TCPStreamWriter"
+        "            Address = \"127.0.0.1\""
+        "            Port = 45693"
+        "            ReconnectPeriod = 0.1"
+        "            Signals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMWriter}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = TCPStreamWriterSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool TCPStreamWriterTest::TestConstructor() {
+    using namespace MARTe;
+    TCPStreamWriter test;
+    bool ok = (test.GetAddress() == "");
+    ok &= (test.GetPort() == 0u);
+    ok &= (test.GetQueueSize() == 16u);
+    ok &= (test.IsNoDelay());
+    ok &= (test.GetSendBufferSize() == 0u);
+    ok &= (test.GetReconnectPeriod() == 1000u);
+    ok &= (test.GetCPUMask() == 0xFFFFFFFFu);
+    ok &= (test.GetStackSize() == THREADS_DEFAULT_STACKSIZE);
+    ok &= (!test.IsQueueDepthEnabled());
+    ok &= (!test.IsConnected());
+    ok &= (test.GetQueueDepth() == 0u);
+    ok &= (test.GetNumberOfSentFrames() == 0u);
+    ok &= (test.GetNumberOfDroppedFrames() == 0u);
+    ok &= (test.GetNumberOfConnections() == 0u);
+    return ok;
+}
+
+bool TCPStreamWriterTest::TestInitialise() {
+    using namespace MARTe;
+    TCPStreamWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 45690);
+    cdb.Write("QueueSize", 64);
+    cdb.Write("NoDelay", 0);
+    cdb.Write("SendBufferSize", 4194304);
+    cdb.Write("ReconnectPeriod", 0.25);
+    cdb.Write("CPUMask", 0x2);
+    cdb.Write("StackSize", 1048576);
+    cdb.Write("QueueDepth", 1);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetAddress() == "127.0.0.1");
+    ok &= (test.GetPort() == 45690u);
+    ok &= (test.GetQueueSize() == 64u);
+    ok &= (!test.IsNoDelay());
+    ok &= (test.GetSendBufferSize() == 4194304u);
+    ok &= (test.GetReconnectPeriod() == 250u);
+    ok &= (test.GetCPUMask() == 0x2u);
+    ok &= (test.GetStackSize() == 1048576u);
+    ok &= (test.IsQueueDepthEnabled());
+    return ok;
+}
+
+bool TCPStreamWriterTest::TestInitialise_Defaults() {
+    using namespace MARTe;
+    TCPStreamWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 45690);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetQueueSize() == 16u);
+    ok &= (test.IsNoDelay());
+    ok &= (test.GetSendBufferSize() == 0u);
+    ok &= (test.GetReconnectPeriod() == 1000u);
+    ok &= (test.GetCPUMask() == 0xFFFFFFFFu);
+    ok &= (test.GetStackSize() == THREADS_DEFAULT_STACKSIZE);
+    ok &= (!test.IsQueueDepthEnabled());
+    return ok;
+}
+
+bool TCPStreamWriterTest::TestInitialise_False_No_Address() {
+    using namespace MARTe;
+    TCPStreamWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45690);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool TCPStreamWriterTest::TestInitialise_False_Invalid_Address() {
+    using namespace MARTe;
+    TCPStreamWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "127.0.0");
+    cdb.Write("Port", 45690);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool TCPStreamWriterTest::TestInitialise_False_No_Port() {
+    using namespace MARTe;
+    TCPStreamWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "127.0.0.1");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool TCPStreamWriterTest::TestInitialise_False_QueueSize() {
+    using namespace MARTe;
+    TCPStreamWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 45690);
+    cdb.Write("QueueSize", 0);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool TCPStreamWriterTest::TestInitialise_False_ReconnectPeriod() {
+    using namespace MARTe;
+    TCPStreamWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 45690);
+    cdb.Write("ReconnectPeriod", 0.0);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool TCPStreamWriterTest::TestSetConfiguredDatabase_False_QueueDepth() {
+    return !TestStreamExecution(config3, false, 1u);
+}
+
+bool TCPStreamWriterTest::TestSetConfiguredDatabase_False_No_Payload() {
+    return !TestStreamExecution(config4, false, 1u);
+}
+
+bool TCPStreamWriterTest::TestGetBrokerName() {
+    using namespace MARTe;
+    TCPStreamWriter test;
+    ConfigurationDatabase cdb;
+    bool ok = (StringHelper::Compare(test.GetBrokerName(cdb, OutputSignals), "MemoryMapSynchronisedOutputBroker") == 0);
+    if (ok) {
+        ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "MemoryMapInputBroker") == 0);
+    }
+    return ok;
+}
+
+bool TCPStreamWriterTest::TestPrepareNextState() {
+    using namespace MARTe;
+    TCPStreamWriter test;
+    return test.PrepareNextState("State1", "State1");
+}
+
+bool TCPStreamWriterTest::TestSynchronise() {
+    return TestStreamExecution(config1, true);
+}
+
+bool TCPStreamWriterTest::TestSynchronise_QueueDepth() {
+    return TestStreamExecution(config2, true);
+}
+
+bool TCPStreamWriterTest::TestSynchronise_Not_Connected() {
+    return TestStreamExecution(config5, false, 10u);
+}
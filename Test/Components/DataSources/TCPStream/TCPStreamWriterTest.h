@@ -0,0 +1,124 @@
+/**
+ * @file TCPStreamWriterTest.h
+ * @brief Header file for class TCPStreamWriterTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class TCPStreamWriterTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_COMPONENTS_DATASOURCES_TCPSTREAM_TCPSTREAMWRITERTEST_H_
+#define TEST_COMPONENTS_DATASOURCES_TCPSTREAM_TCPSTREAMWRITERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Tests the TCPStreamWriter public methods.
+ */
+class TCPStreamWriterTest {
+public:
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method with all the parameters.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests the Initialise method with the default values of the optional parameters.
+     */
+    bool TestInitialise_Defaults();
+
+    /**
+     * @brief Tests that the Initialise method fails without Address.
+     */
+    bool TestInitialise_False_No_Address();
+
+    /**
+     * @brief Tests that the Initialise method fails with an Address which is not an IPv4 address.
+     */
+    bool TestInitialise_False_Invalid_Address();
+
+    /**
+     * @brief Tests that the Initialise method fails without Port.
+     */
+    bool TestInitialise_False_No_Port();
+
+    /**
+     * @brief Tests that the Initialise method fails with QueueSize = 0.
+     */
+    bool TestInitialise_False_QueueSize();
+
+    /**
+     * @brief Tests that the Initialise method fails with ReconnectPeriod = 0.
+     */
+    bool TestInitialise_False_ReconnectPeriod();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails with a QueueDepth signal which is not uint32.
+     */
+    bool TestSetConfiguredDatabase_False_QueueDepth();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails without payload signals.
+     */
+    bool TestSetConfiguredDatabase_False_No_Payload();
+
+    /**
+     * @brief Tests the GetBrokerName method.
+     */
+    bool TestGetBrokerName();
+
+    /**
+     * @brief Tests the PrepareNextState method.
+     */
+    bool TestPrepareNextState();
+
+    /**
+     * @brief Tests the Synchronise method streaming to a TCPStreamReader.
+     */
+    bool TestSynchronise();
+
+    /**
+     * @brief Tests the Synchronise method with the QueueDepth signal.
+     */
+    bool TestSynchronise_QueueDepth();
+
+    /**
+     * @brief Tests that the Synchronise method drops the frames (without blocking) when there is no receiver.
+     */
+    bool TestSynchronise_Not_Connected();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_COMPONENTS_DATASOURCES_TCPSTREAM_TCPSTREAMWRITERTEST_H_ */
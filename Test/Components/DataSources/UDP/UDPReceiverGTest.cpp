@@ -119,3 +119,118 @@ TEST(UDPReceiverGTest,TestExecute_Timeout) {
     UDPReceiverTest test;
     ASSERT_TRUE(test.TestExecute_Timeout());
 }
+
+TEST(UDPReceiverGTest,TestInitialise_NumberOfPackets) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_NumberOfPackets());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_Wrong_PacketsMode) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_Wrong_PacketsMode());
+}
+
+TEST(UDPReceiverGTest,TestSetConfiguredDatabase_False_NumberOfPackets) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_NumberOfPackets());
+}
+
+TEST(UDPReceiverGTest,TestSynchronise_NumberOfPackets) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestSynchronise_NumberOfPackets());
+}
+
+TEST(UDPReceiverGTest,TestExecute_NumberOfPackets) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestExecute_NumberOfPackets());
+}
+
+TEST(UDPReceiverGTest,TestSynchronise_IndependentThread) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestSynchronise_IndependentThread());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_Wrong_Transport) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_Wrong_Transport());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_Transport_XDP) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_Transport_XDP());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_Transport_XDP_No_Interface) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_Transport_XDP_No_Interface());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_Transport_XDP_NumberOfPackets) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_Transport_XDP_NumberOfPackets());
+}
+
+TEST(UDPReceiverGTest,TestSynchronise_Transport_XDP_Fallback) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestSynchronise_Transport_XDP_Fallback());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_SequenceHeader) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_SequenceHeader());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_SequenceHeader_NumberOfPackets) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_SequenceHeader_NumberOfPackets());
+}
+
+TEST(UDPReceiverGTest,TestSetConfiguredDatabase_False_SequenceHeader) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_SequenceHeader());
+}
+
+TEST(UDPReceiverGTest,TestSynchronise_SequenceHeader) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestSynchronise_SequenceHeader());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_NumberOfQueues) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_NumberOfQueues());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_False_NumberOfQueues_RealTimeThread) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NumberOfQueues_RealTimeThread());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_False_NumberOfQueues_Address) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NumberOfQueues_Address());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_Wrong_Steering) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_Wrong_Steering());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_False_QueueStatistics) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_False_QueueStatistics());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_MulticastInterface) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_MulticastInterface());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_False_MulticastInterface_No_Address) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_False_MulticastInterface_No_Address());
+}
+
+TEST(UDPReceiverGTest,TestExecute_NumberOfQueues) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestExecute_NumberOfQueues());
+}
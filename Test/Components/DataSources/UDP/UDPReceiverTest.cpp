@@ -44,14 +44,18 @@
 //Helper Client to send test data
 class SenderClientHelper: public MARTe::EmbeddedServiceMethodBinderI {
 public:
-    SenderClientHelper() :
+    SenderClientHelper(const bool sequencedIn = false) :
             EmbeddedServiceMethodBinderI(),
             executor(*this) {
         using namespace MARTe;
         address = "127.0.0.1";
         memory = NULL_PTR(void*);
         port = 45678u;
+        sequenced = sequencedIn;
         totalMemorySize = 4u;
+        if (sequenced) {
+            totalMemorySize += UDP_SEQUENCE_HEADER_SIZE;
+        }
     }
 
     ~SenderClientHelper() {
@@ -79,7 +83,7 @@ public:
         if (ok) {
             memory = HeapManager::Malloc(totalMemorySize);
             uint32 value = 99u;
-            ok = MemoryOperationsHelper::Copy(memory, &value, totalMemorySize);
+            ok = MemoryOperationsHelper::Copy(&reinterpret_cast<char8*>(memory)[totalMemorySize - 4u], &value, 4u);
         }
         return ok;
     }
@@ -97,10 +101,14 @@ public:
 
     virtual MARTe::ErrorManagement::ErrorType Execute(MARTe::ExecutionInfo &info) {
         using namespace MARTe;
-        const char8 *const dataBuffer = reinterpret_cast<char8*>(memory);
-        bool ok = socket.Write(dataBuffer, totalMemorySize);
+        char8 *const dataBuffer = reinterpret_cast<char8*>(memory);
+        if (sequenced) {
+            sequence.Stamp(dataBuffer);
+        }
+        uint32 size = totalMemorySize;
+        bool ok = socket.Write(dataBuffer, size);
         if (ok) {
-            REPORT_ERROR_STATIC(ErrorManagement::Information, "Sent! %d", *reinterpret_cast<uint32*>(memory));
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Sent! %d", *reinterpret_cast<uint32*>(&dataBuffer[totalMemorySize - 4u]));
         }
         Sleep::MSec(100);
         return ok;
@@ -120,6 +128,10 @@ private:
 
     MARTe::uint32 totalMemorySize;
 
+    bool sequenced;
+
+    MARTe::UDPSequence sequence;
+
 };
 
 /**
@@ -259,11 +271,12 @@ static bool TestIntegratedExecution(const MARTe::char8 *const config,
 }
 
 static bool TestSendReceiveExecution(const MARTe::char8 *const config,
-                                     MARTe::uint32 sleepMSec = 10) {
+                                     MARTe::uint32 sleepMSec = 10,
+                                     bool sequenced = false) {
     using namespace MARTe;
 
     bool ok = true;
-    SenderClientHelper sndThread;
+    SenderClientHelper sndThread(sequenced);
     if (ok) {
         ok = sndThread.InitiliaseThread();
         if (ok) {
@@ -585,59 +598,591 @@ static const MARTe::char8 *const config4 = ""
         "    }"
         "}";
 
-/*---------------------------------------------------------------------------*/
-/*                           Method definitions                              */
-/*---------------------------------------------------------------------------*/
-
-bool UDPReceiverTest::TestConstructor() {
-    using namespace MARTe;
-    UDPReceiver test;
-    bool ok = (test.GetCPUMask() == 0u);
-    ok &= (test.GetStackSize() == THREADS_DEFAULT_STACKSIZE);
-    ok &= (test.GetPort() == 0u);
-    ok &= (test.GetAddress() == "");
-    ok &= (test.GetExecutionMode() == UDPReceiverExecutionModeRealTime);
-    return ok;
-}
+//Correct configuration with localhost and batched reception
+static const MARTe::char8 *const config5 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TestHelperGAM"
+        "            InputSignals = {"
+        "                Packets = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                    NumberOfElements = 4"
+        "                }"
+        "                PacketCount = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                DroppedPackets = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPReceiver"
+        "            ExecutionMode = RealTimeThread"
+        "            NumberOfPackets = 4"
+        "            Port = 45678"
+        "            Timeout = 4"
+        "            Signals = {"
+        "                PacketCount = {"
+        "                    Type = uint32"
+        "                }"
+        "                DroppedPackets = {"
+        "                    Type = uint32"
+        "                }"
+        "                Packets = {"
+        "                    Type = uint32"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPReceiverSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
 
-bool UDPReceiverTest::TestInitialise_No_Address() {
-    using namespace MARTe;
-    UDPReceiver test;
-    ConfigurationDatabase cdb;
-    cdb.Write("Port", 45678);
-    cdb.Write("Timeout", 10);
-    cdb.Write("ExecutionMode", "RealTimeThread");
-    cdb.CreateRelative("Signals");
-    cdb.MoveToRoot();
-    bool ok = test.Initialise(cdb);
-    ok &= (test.GetAddress() == "");
-    return ok;
-}
+//Correct configuration with localhost, decoupled thread and batched reception
+static const MARTe::char8 *const config6 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TestHelperGAM"
+        "            InputSignals = {"
+        "                Packets = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                    NumberOfElements = 4"
+        "                }"
+        "                PacketCount = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                DroppedPackets = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPReceiver"
+        "            ExecutionMode = IndependentThread"
+        "            NumberOfPackets = 4"
+        "            PacketsMode = Last"
+        "            Port = 45678"
+        "            Timeout = 4"
+        "            Signals = {"
+        "                PacketCount = {"
+        "                    Type = uint32"
+        "                }"
+        "                DroppedPackets = {"
+        "                    Type = uint32"
+        "                }"
+        "                Packets = {"
+        "                    Type = uint32"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPReceiverSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
 
-bool UDPReceiverTest::TestInitialise_No_Port() {
-    using namespace MARTe;
-    UDPReceiver test;
-    ConfigurationDatabase cdb;
-    cdb.Write("Timeout", 10);
-    cdb.Write("ExecutionMode", "RealTimeThread");
-    cdb.CreateRelative("Signals");
-    cdb.MoveToRoot();
-    bool ok = test.Initialise(cdb);
-    ok &= (test.GetPort() == 44488u);
-    return ok;
-}
+//Wrong configuration with a packets size which is not a multiple of NumberOfPackets
+static const MARTe::char8 *const config7 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TestHelperGAM"
+        "            InputSignals = {"
+        "                Packets = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                PacketCount = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                DroppedPackets = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPReceiver"
+        "            ExecutionMode = RealTimeThread"
+        "            NumberOfPackets = 4"
+        "            Port = 45678"
+        "            Timeout = 4"
+        "            Signals = {"
+        "                PacketCount = {"
+        "                    Type = uint32"
+        "                }"
+        "                DroppedPackets = {"
+        "                    Type = uint32"
+        "                }"
+        "                Packets = {"
+        "                    Type = uint32"
+        "                    NumberOfElements = 3"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPReceiverSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
 
-bool UDPReceiverTest::TestInitialise_Forbidden_Port() {
-    using namespace MARTe;
-    UDPReceiver test;
-    ConfigurationDatabase cdb;
-    cdb.Write("Port", 500);
-    cdb.Write("Timeout", 10);
-    cdb.Write("ExecutionMode", "RealTimeThread");
-    cdb.CreateRelative("Signals");
-    cdb.MoveToRoot();
-    bool ok = test.Initialise(cdb);
-    ok &= (test.GetPort() == 500);
+//XDP transport on an interface which does not exist (shall fall back to the UDPSocket)
+static const MARTe::char8 *const config8 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TestHelperGAM"
+        "            InputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPReceiver"
+        "            ExecutionMode = RealTimeThread"
+        "            Port = 45678"
+        "            Timeout = 4"
+        "            Transport = XDP"
+        "            Interface = \"nonexistent0\""
+        "            Signals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPReceiverSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Correct configuration with the sequence header
+static const MARTe::char8 *const config9 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TestHelperGAM"
+        "            InputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPReceiver"
+        "            ExecutionMode = RealTimeThread"
+        "            Port = 45678"
+        "            Timeout = 4"
+        "            SequenceHeader = 1"
+        "            Signals = {"
+        "                LostPackets = {"
+        "                    Type = uint32"
+        "                }"
+        "                DuplicatedPackets = {"
+        "                    Type = uint32"
+        "                }"
+        "                ReorderedPackets = {"
+        "                    Type = uint32"
+        "                }"
+        "                Latency = {"
+        "                    Type = int64"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPReceiverSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Wrong configuration with the sequence header and without the counter signals
+static const MARTe::char8 *const config10 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TestHelperGAM"
+        "            InputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPReceiver"
+        "            ExecutionMode = RealTimeThread"
+        "            Port = 45678"
+        "            Timeout = 4"
+        "            SequenceHeader = 1"
+        "            Signals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPReceiverSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with two SO_REUSEPORT receive queues, steered by CPU, and the per queue statistics
+static const MARTe::char8 *const config11 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TestHelperGAM"
+        "            InputSignals = {"
+        "                Packets = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                    NumberOfElements = 4"
+        "                }"
+        "                PacketCount = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                DroppedPackets = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                QueueStatistics = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPReceiver"
+        "            ExecutionMode = IndependentThread"
+        "            NumberOfPackets = 4"
+        "            PacketsMode = Last"
+        "            NumberOfQueues = 2"
+        "            Steering = CPU"
+        "            QueueStatistics = 1"
+        "            Port = 45678"
+        "            Timeout = 4"
+        "            Signals = {"
+        "                PacketCount = {"
+        "                    Type = uint32"
+        "                }"
+        "                DroppedPackets = {"
+        "                    Type = uint32"
+        "                }"
+        "                QueueStatistics = {"
+        "                    Type = uint32"
+        "                    NumberOfElements = 4"
+        "                }"
+        "                Packets = {"
+        "                    Type = uint32"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPReceiverSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool UDPReceiverTest::TestConstructor() {
+    using namespace MARTe;
+    UDPReceiver test;
+    bool ok = (test.GetCPUMask() == 0u);
+    ok &= (test.GetStackSize() == THREADS_DEFAULT_STACKSIZE);
+    ok &= (test.GetPort() == 0u);
+    ok &= (test.GetAddress() == "");
+    ok &= (test.GetExecutionMode() == UDPReceiverExecutionModeRealTime);
+    return ok;
+}
+
+bool UDPReceiverTest::TestInitialise_No_Address() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("Timeout", 10);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetAddress() == "");
+    return ok;
+}
+
+bool UDPReceiverTest::TestInitialise_No_Port() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Timeout", 10);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetPort() == 44488u);
+    return ok;
+}
+
+bool UDPReceiverTest::TestInitialise_Forbidden_Port() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 500);
+    cdb.Write("Timeout", 10);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetPort() == 500);
     return ok;
 }
 
@@ -821,3 +1366,259 @@ bool UDPReceiverTest::TestExecute_Timeout() {
 
     return ok;
 }
+
+bool UDPReceiverTest::TestInitialise_NumberOfPackets() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("NumberOfPackets", 8);
+    cdb.Write("PacketsMode", "Last");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = (test.GetNumberOfPackets() == 0u);
+    ok &= (test.GetPacketsMode() == UDPReceiverPacketsModeSinceLastCycle);
+    ok &= test.Initialise(cdb);
+    ok &= (test.GetNumberOfPackets() == 8u);
+    ok &= (test.GetPacketsMode() == UDPReceiverPacketsModeLast);
+    return ok;
+}
+
+bool UDPReceiverTest::TestInitialise_Wrong_PacketsMode() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("NumberOfPackets", 8);
+    cdb.Write("PacketsMode", "First");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    return !ok;
+}
+
+bool UDPReceiverTest::TestSetConfiguredDatabase_False_NumberOfPackets() {
+    return !TestIntegratedExecution(config7);
+}
+
+bool UDPReceiverTest::TestSynchronise_NumberOfPackets() {
+    return TestSendReceiveExecution(config5, 200u);
+}
+
+bool UDPReceiverTest::TestExecute_NumberOfPackets() {
+    return TestSendReceiveExecution(config6, 200u);
+}
+
+bool UDPReceiverTest::TestSynchronise_IndependentThread() {
+    return TestSendReceiveExecution(config4, 200u);
+}
+
+bool UDPReceiverTest::TestInitialise_Wrong_Transport() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("Transport", "DPDK");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    return !ok;
+}
+
+bool UDPReceiverTest::TestInitialise_Transport_XDP() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("Transport", "XDP");
+    cdb.Write("Interface", "eth0");
+    cdb.Write("QueueId", 1);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (test.GetTransport() == UDPTransportXDP);
+    }
+    return ok;
+}
+
+bool UDPReceiverTest::TestInitialise_Transport_XDP_No_Interface() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("Transport", "XDP");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    return !ok;
+}
+
+bool UDPReceiverTest::TestInitialise_Transport_XDP_NumberOfPackets() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("Transport", "XDP");
+    cdb.Write("Interface", "eth0");
+    cdb.Write("NumberOfPackets", 8);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    return !ok;
+}
+
+bool UDPReceiverTest::TestSynchronise_Transport_XDP_Fallback() {
+    return TestSendReceiveExecution(config8);
+}
+
+bool UDPReceiverTest::TestInitialise_SequenceHeader() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("SequenceHeader", 1);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = test.IsSequenceHeaderEnabled();
+    }
+    return ok;
+}
+
+bool UDPReceiverTest::TestInitialise_SequenceHeader_NumberOfPackets() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("SequenceHeader", 1);
+    cdb.Write("NumberOfPackets", 8);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    return !ok;
+}
+
+bool UDPReceiverTest::TestSetConfiguredDatabase_False_SequenceHeader() {
+    return !TestIntegratedExecution(config10);
+}
+
+bool UDPReceiverTest::TestSynchronise_SequenceHeader() {
+    return TestSendReceiveExecution(config9, 10u, true);
+}
+
+bool UDPReceiverTest::TestInitialise_NumberOfQueues() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "IndependentThread");
+    cdb.Write("NumberOfPackets", 8);
+    cdb.Write("NumberOfQueues", 4);
+    cdb.Write("Steering", "CPU");
+    cdb.Write("QueueStatistics", 1);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetNumberOfQueues() == 4u);
+    ok &= (test.GetSteering() == UDPReceiverSteeringCPU);
+    return ok;
+}
+
+bool UDPReceiverTest::TestInitialise_False_NumberOfQueues_RealTimeThread() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("NumberOfPackets", 8);
+    cdb.Write("NumberOfQueues", 2);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    return !ok;
+}
+
+bool UDPReceiverTest::TestInitialise_False_NumberOfQueues_Address() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "IndependentThread");
+    cdb.Write("Address", "230.168.129.30");
+    cdb.Write("NumberOfPackets", 8);
+    cdb.Write("NumberOfQueues", 2);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    return !ok;
+}
+
+bool UDPReceiverTest::TestInitialise_Wrong_Steering() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "IndependentThread");
+    cdb.Write("NumberOfPackets", 8);
+    cdb.Write("NumberOfQueues", 2);
+    cdb.Write("Steering", "Random");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    return !ok;
+}
+
+bool UDPReceiverTest::TestInitialise_False_QueueStatistics() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "IndependentThread");
+    cdb.Write("QueueStatistics", 1);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    return !ok;
+}
+
+bool UDPReceiverTest::TestInitialise_MulticastInterface() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("Address", "230.168.129.30");
+    cdb.Write("MulticastInterface", "lo");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetMulticastInterface() == "lo");
+    return ok;
+}
+
+bool UDPReceiverTest::TestInitialise_False_MulticastInterface_No_Address() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("MulticastInterface", "lo");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    return !ok;
+}
+
+bool UDPReceiverTest::TestExecute_NumberOfQueues() {
+    return TestSendReceiveExecution(config11, 200u);
+}
@@ -119,6 +119,121 @@ public:
      */
     bool TestExecute_Timeout();
 
+    /**
+     * @brief Tests the Initialise method with NumberOfPackets and PacketsMode.
+     */
+    bool TestInitialise_NumberOfPackets();
+
+    /**
+     * @brief Tests the Initialise method with a wrong PacketsMode.
+     */
+    bool TestInitialise_Wrong_PacketsMode();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method with a packets size which is not a multiple of NumberOfPackets.
+     */
+    bool TestSetConfiguredDatabase_False_NumberOfPackets();
+
+    /**
+     * @brief Tests the Synchronise method with NumberOfPackets in RealTimeThread mode.
+     */
+    bool TestSynchronise_NumberOfPackets();
+
+    /**
+     * @brief Tests the Execute method with NumberOfPackets in IndependentThread mode.
+     */
+    bool TestExecute_NumberOfPackets();
+
+    /**
+     * @brief Tests the Synchronise method in IndependentThread mode (triple buffer).
+     */
+    bool TestSynchronise_IndependentThread();
+
+    /**
+     * @brief Tests the Initialise method with a wrong Transport.
+     */
+    bool TestInitialise_Wrong_Transport();
+
+    /**
+     * @brief Tests the Initialise method with Transport = XDP.
+     */
+    bool TestInitialise_Transport_XDP();
+
+    /**
+     * @brief Tests that the Initialise method fails with Transport = XDP and no Interface.
+     */
+    bool TestInitialise_Transport_XDP_No_Interface();
+
+    /**
+     * @brief Tests that the Initialise method fails with Transport = XDP and NumberOfPackets > 0.
+     */
+    bool TestInitialise_Transport_XDP_NumberOfPackets();
+
+    /**
+     * @brief Tests that the Synchronise method falls back to the UDPSocket if the AF_XDP socket cannot be opened.
+     */
+    bool TestSynchronise_Transport_XDP_Fallback();
+
+    /**
+     * @brief Tests the Initialise method with SequenceHeader = 1.
+     */
+    bool TestInitialise_SequenceHeader();
+
+    /**
+     * @brief Tests that the Initialise method fails with SequenceHeader = 1 and NumberOfPackets > 0.
+     */
+    bool TestInitialise_SequenceHeader_NumberOfPackets();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails with SequenceHeader = 1 and without the counter signals.
+     */
+    bool TestSetConfiguredDatabase_False_SequenceHeader();
+
+    /**
+     * @brief Tests the Synchronise method with SequenceHeader = 1.
+     */
+    bool TestSynchronise_SequenceHeader();
+
+    /**
+     * @brief Tests the Initialise method with NumberOfQueues, Steering and QueueStatistics.
+     */
+    bool TestInitialise_NumberOfQueues();
+
+    /**
+     * @brief Tests that the Initialise method fails with NumberOfQueues > 1 in RealTimeThread mode.
+     */
+    bool TestInitialise_False_NumberOfQueues_RealTimeThread();
+
+    /**
+     * @brief Tests that the Initialise method fails with NumberOfQueues > 1 and a multicast Address.
+     */
+    bool TestInitialise_False_NumberOfQueues_Address();
+
+    /**
+     * @brief Tests that the Initialise method fails with an invalid Steering.
+     */
+    bool TestInitialise_Wrong_Steering();
+
+    /**
+     * @brief Tests that the Initialise method fails with QueueStatistics = 1 and NumberOfPackets = 0.
+     */
+    bool TestInitialise_False_QueueStatistics();
+
+    /**
+     * @brief Tests the Initialise method with a MulticastInterface.
+     */
+    bool TestInitialise_MulticastInterface();
+
+    /**
+     * @brief Tests that the Initialise method fails with a MulticastInterface and without Address.
+     */
+    bool TestInitialise_False_MulticastInterface_No_Address();
+
+    /**
+     * @brief Tests the Execute method with two receive queues and the per queue statistics.
+     */
+    bool TestExecute_NumberOfQueues();
+
 };
 
 
@@ -141,3 +141,47 @@ TEST(UDPSenderGTest,TestSynchronise_RealTimeThread) {
     ASSERT_TRUE(test.TestSynchronise_RealTimeThread());
 }
 
+TEST(UDPSenderGTest,TestInitialise_Wrong_Transport) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestInitialise_Wrong_Transport());
+}
+
+TEST(UDPSenderGTest,TestInitialise_Transport_XDP) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestInitialise_Transport_XDP());
+}
+
+TEST(UDPSenderGTest,TestInitialise_Transport_XDP_No_DestinationMAC) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestInitialise_Transport_XDP_No_DestinationMAC());
+}
+
+TEST(UDPSenderGTest,TestInitialise_BatchSize) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestInitialise_BatchSize());
+}
+
+TEST(UDPSenderGTest,TestInitialise_BatchSize_RealTimeThread) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestInitialise_BatchSize_RealTimeThread());
+}
+
+TEST(UDPSenderGTest,TestSynchronise_BatchSize) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestSynchronise_BatchSize());
+}
+
+TEST(UDPSenderGTest,TestInitialise_SequenceHeader) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestInitialise_SequenceHeader());
+}
+
+TEST(UDPSenderGTest,TestInitialise_OnChange) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestInitialise_OnChange());
+}
+
+TEST(UDPSenderGTest,TestInitialise_False_OnChange_BatchSize) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_OnChange_BatchSize());
+}
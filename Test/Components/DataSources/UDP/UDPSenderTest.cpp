@@ -596,6 +596,163 @@ static const MARTe::char8 *const config2 = ""
         "    }"
         "}";
 
+//Correct configuration with the datagrams transmitted in bursts
+static const MARTe::char8 *const config3 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMTimer = {"
+        "            Class = IOGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = Timer"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                    DataSource = Timer"
+        "                    Frequency = 1"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "        +TriggerGAM = {"
+        "            Class = ConstantGAM"
+        "            OutputSignals = {"
+        "                Trigger = {"
+        "                    Type = uint8"
+        "                    DataSource = DDB1"
+        "                    Default = 1"
+        "                }"
+        "            }"
+        "        }"
+        "        +PayloadGAM = {"
+        "            Class = ConstantGAM"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                    Default = 99"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMSender = {"
+        "            Class = IOGAM"
+        "            InputSignals = {"
+        "                Trigger = {"
+        "                    Type = uint8"
+        "                    DataSource = DDB1"
+        "                }"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Trigger = {"
+        "                    Type = uint8"
+        "                    DataSource = UDP"
+        "                }"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPSender"
+        "            CPUMask = 15"
+        "            StackSize = 10000000"
+        "            NumberOfPreTriggers = 0"
+        "            NumberOfPostTriggers = 0"
+        "            Address = \"127.0.0.1\""
+        "            Port = 45678"
+        "            ExecutionMode = IndependentThread"
+        "            BatchSize = 16"
+        "            Segmentation = 1"
+        "            Signals = {"
+        "                Trigger = {"
+        "                    Type = uint8"
+        "                }"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            SleepNature = \"Default\""
+        "            Signals = {"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMTimer TriggerGAM PayloadGAM GAMSender}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPSenderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -866,3 +1023,144 @@ bool UDPSenderTest::TestSetConfiguredDatabase_Correct() {
     return TestIntegratedExecution(config1);
 }
 
+bool UDPSenderTest::TestInitialise_Wrong_Transport() {
+    using namespace MARTe;
+    UDPSender test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "234.0.0.1");
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("Transport", "DPDK");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool UDPSenderTest::TestInitialise_Transport_XDP() {
+    using namespace MARTe;
+    UDPSender test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "234.0.0.1");
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("Transport", "XDP");
+    cdb.Write("Interface", "eth0");
+    cdb.Write("DestinationMAC", "01:00:5e:00:00:01");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (test.GetTransport() == UDPTransportXDP);
+    }
+    return ok;
+}
+
+bool UDPSenderTest::TestInitialise_Transport_XDP_No_DestinationMAC() {
+    using namespace MARTe;
+    UDPSender test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "234.0.0.1");
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("Transport", "XDP");
+    cdb.Write("Interface", "eth0");
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool UDPSenderTest::TestInitialise_BatchSize() {
+    using namespace MARTe;
+    UDPSender test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfPreTriggers", 10);
+    cdb.Write("NumberOfPostTriggers", 2);
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "IndependentThread");
+    cdb.Write("BatchSize", 16);
+    cdb.Write("Segmentation", 1);
+    cdb.CreateRelative("Signals");
+    cdb.CreateRelative("Trigger");
+    cdb.Write("Type", "uint8");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (test.GetBatchSize() == 16u);
+    }
+    return ok;
+}
+
+bool UDPSenderTest::TestInitialise_BatchSize_RealTimeThread() {
+    using namespace MARTe;
+    UDPSender test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("BatchSize", 16);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool UDPSenderTest::TestSynchronise_BatchSize() {
+    return TestSendReceiveApplication(config3);
+}
+
+bool UDPSenderTest::TestInitialise_SequenceHeader() {
+    using namespace MARTe;
+    UDPSender test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("SequenceHeader", 1);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = test.IsSequenceHeaderEnabled();
+    }
+    return ok;
+}
+
+bool UDPSenderTest::TestInitialise_OnChange() {
+    using namespace MARTe;
+    UDPSender test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("OnChange", 1);
+    cdb.Write("FullRefreshPeriod", 50);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = test.IsOnChangeEnabled();
+    }
+    if (ok) {
+        ok = (test.GetFullRefreshPeriod() == 50u);
+    }
+    if (ok) {
+        ok = (test.GetNumberOfSuppressedDatagrams() == 0u);
+    }
+    return ok;
+}
+
+bool UDPSenderTest::TestInitialise_False_OnChange_BatchSize() {
+    using namespace MARTe;
+    UDPSender test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "IndependentThread");
+    cdb.Write("BatchSize", 16);
+    cdb.Write("OnChange", 1);
+    cdb.CreateRelative("Signals");
+    cdb.CreateRelative("Trigger");
+    cdb.Write("Type", "uint8");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
@@ -142,6 +142,51 @@ public:
      * @brief Tests the SetConfiguredDatabase method.
      */
     bool TestSetConfiguredDatabase_Correct();
+
+    /**
+     * @brief Tests the Initialise method with a wrong Transport.
+     */
+    bool TestInitialise_Wrong_Transport();
+
+    /**
+     * @brief Tests the Initialise method with Transport = XDP.
+     */
+    bool TestInitialise_Transport_XDP();
+
+    /**
+     * @brief Tests that the Initialise method fails with Transport = XDP and no DestinationMAC.
+     */
+    bool TestInitialise_Transport_XDP_No_DestinationMAC();
+
+    /**
+     * @brief Tests the Initialise method with BatchSize > 0.
+     */
+    bool TestInitialise_BatchSize();
+
+    /**
+     * @brief Tests that the Initialise method fails with BatchSize > 0 and ExecutionMode = RealTimeThread.
+     */
+    bool TestInitialise_BatchSize_RealTimeThread();
+
+    /**
+     * @brief Tests the Synchronise method with BatchSize > 0 and Segmentation = 1.
+     */
+    bool TestSynchronise_BatchSize();
+
+    /**
+     * @brief Tests the Initialise method with SequenceHeader = 1.
+     */
+    bool TestInitialise_SequenceHeader();
+
+    /**
+     * @brief Tests the Initialise method with OnChange = 1 and FullRefreshPeriod.
+     */
+    bool TestInitialise_OnChange();
+
+    /**
+     * @brief Tests that the Initialise method fails with OnChange = 1 and BatchSize > 0.
+     */
+    bool TestInitialise_False_OnChange_BatchSize();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,330 @@
+/**
+ * @file AllocationTrackerGAMTest.cpp
+ * @brief Source file for class AllocationTrackerGAMTest
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class AllocationTrackerGAMTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AllocationTrackerGAMTest.h"
+#include "ConfigurationDatabase.h"
+#include "MemoryDataSourceI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class AllocationTrackerGAMTestGAM: public AllocationTrackerGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    void *GetOutputSignalMemory(const uint32 signalIdx);
+};
+
+void *AllocationTrackerGAMTestGAM::GetOutputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetOutputSignalMemory(signalIdx);
+}
+
+CLASS_REGISTER(AllocationTrackerGAMTestGAM, "1.0")
+
+class AllocationTrackerGAMTestDS: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+            const char8 * const nextStateName);
+
+    virtual bool Synchronise();
+
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+};
+CLASS_REGISTER(AllocationTrackerGAMTestDS, "1.0")
+
+bool AllocationTrackerGAMTestDS::PrepareNextState(const char8 * const currentStateName,
+        const char8 * const nextStateName) {
+    return true;
+}
+
+bool AllocationTrackerGAMTestDS::Synchronise() {
+    return true;
+}
+
+const char8 *AllocationTrackerGAMTestDS::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    return "MemoryMapInputBroker";
+}
+
+/**
+ * @brief Configures an application with a single AllocationTrackerGAMTestGAM (GAMA) with the parameters and signals in gamConfig.
+ * The input signals shall use the Drv1 DataSource and the output signals the DDB DataSource.
+ */
+static bool InitialiseAllocationTrackerApplication(const char8 * const gamConfig) {
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = AllocationTrackerGAMTestGAM";
+    config += gamConfig;
+    config += ""
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = AllocationTrackerGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    config.Seek(0);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT < RealTimeApplication > application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * The configuration of a GAM with both output signals.
+ */
+static const char8 * const allocationTrackerGAMConfig = ""
+        "            MaxReports = 2"
+        "            OutputSignals = {"
+        "                Allocations = {"
+        "                    DataSource = DDB"
+        "                    Type = uint32"
+        "                }"
+        "                CyclesWithAllocations = {"
+        "                    DataSource = DDB"
+        "                    Type = uint32"
+        "                }"
+        "            }";
+
+/**
+ * @brief Configures the application with allocationTrackerGAMConfig and gets the GAM.
+ */
+static bool GetAllocationTrackerGAM(ReferenceT<AllocationTrackerGAMTestGAM> &gam) {
+    bool ok = InitialiseAllocationTrackerApplication(allocationTrackerGAMConfig);
+    if (ok) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = gam.IsValid();
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+AllocationTrackerGAMTest::AllocationTrackerGAMTest() {
+}
+
+AllocationTrackerGAMTest::~AllocationTrackerGAMTest() {
+}
+
+bool AllocationTrackerGAMTest::TestConstructor() {
+    AllocationTrackerGAMTestGAM gam;
+    bool ret = !gam.IsTracking();
+    ret &= (gam.GetNumberOfAllocations() == 0u);
+    ret &= (gam.GetNumberOfCyclesWithAllocations() == 0u);
+    return ret;
+}
+
+bool AllocationTrackerGAMTest::TestInitialise() {
+    ConfigurationDatabase cdb;
+    bool ret = cdb.Write("MaxReports", 3u);
+    AllocationTrackerGAMTestGAM gam;
+    if (ret) {
+        ret = gam.Initialise(cdb);
+    }
+    if (ret) {
+        //The library is not preloaded by the test binary
+        ret = !gam.IsTracking();
+    }
+    return ret;
+}
+
+bool AllocationTrackerGAMTest::TestSetup() {
+    ReferenceT<AllocationTrackerGAMTestGAM> gam;
+    bool ret = GetAllocationTrackerGAM(gam);
+    if (ret) {
+        ret = (gam->GetNumberOfOutputSignals() == 2u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool AllocationTrackerGAMTest::TestSetup_FalseInputSignals() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                Input = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                Allocations = {"
+            "                    DataSource = DDB"
+            "                    Type = uint32"
+            "                }"
+            "            }";
+    bool ret = !InitialiseAllocationTrackerApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool AllocationTrackerGAMTest::TestSetup_FalseNumberOfOutputSignals() {
+    const char8 * const gamConfig = ""
+            "            OutputSignals = {"
+            "                Allocations = {"
+            "                    DataSource = DDB"
+            "                    Type = uint32"
+            "                }"
+            "                CyclesWithAllocations = {"
+            "                    DataSource = DDB"
+            "                    Type = uint32"
+            "                }"
+            "                Other = {"
+            "                    DataSource = DDB"
+            "                    Type = uint32"
+            "                }"
+            "            }";
+    bool ret = !InitialiseAllocationTrackerApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool AllocationTrackerGAMTest::TestSetup_FalseOutputType() {
+    const char8 * const gamConfig = ""
+            "            OutputSignals = {"
+            "                Allocations = {"
+            "                    DataSource = DDB"
+            "                    Type = uint64"
+            "                }"
+            "            }";
+    bool ret = !InitialiseAllocationTrackerApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool AllocationTrackerGAMTest::TestSetup_FalseOutputElements() {
+    const char8 * const gamConfig = ""
+            "            OutputSignals = {"
+            "                Allocations = {"
+            "                    DataSource = DDB"
+            "                    Type = uint32"
+            "                    NumberOfElements = 2"
+            "                }"
+            "            }";
+    bool ret = !InitialiseAllocationTrackerApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool AllocationTrackerGAMTest::TestExecute() {
+    ReferenceT<AllocationTrackerGAMTestGAM> gam;
+    bool ret = GetAllocationTrackerGAM(gam);
+    if (ret) {
+        uint32 *allocations = static_cast<uint32 *>(gam->GetOutputSignalMemory(0u));
+        uint32 *cycles = static_cast<uint32 *>(gam->GetOutputSignalMemory(1u));
+        *allocations = 1u;
+        *cycles = 1u;
+        for (uint32 k = 0u; (k < 10u) && (ret); k++) {
+            //Allocates between two executions, which is not flagged as the library is not preloaded
+            StreamString *string = new StreamString("allocated in the cycle");
+            delete string;
+            ret = gam->Execute();
+        }
+        if (ret) {
+            ret = ((*allocations == 0u) && (*cycles == 0u));
+        }
+        if (ret) {
+            ret = (gam->GetNumberOfAllocations() == 0u);
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool AllocationTrackerGAMTest::TestPrepareNextState() {
+    ReferenceT<AllocationTrackerGAMTestGAM> gam;
+    bool ret = GetAllocationTrackerGAM(gam);
+    if (ret) {
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = gam->PrepareNextState("State1", "State1");
+    }
+    if (ret) {
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (gam->GetNumberOfCyclesWithAllocations() == 0u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file AllocationTrackerGAMTest.h
+ * @brief Header file for class AllocationTrackerGAMTest
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class AllocationTrackerGAMTest
+
+#ifndef ALLOCATIONTRACKERGAMTEST_H_
+#define ALLOCATIONTRACKERGAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "AllocationTrackerGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the AllocationTrackerGAM methods. The test binary does not preload the library, so that no allocation is tracked.
+ */
+class AllocationTrackerGAMTest {
+public:
+
+    /**
+     * @brief Constructor
+     */
+    AllocationTrackerGAMTest();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~AllocationTrackerGAMTest();
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests the Setup method with two output signals
+     */
+    bool TestSetup();
+
+    /**
+     * @brief Tests that the Setup method fails if an input signal is defined
+     */
+    bool TestSetup_FalseInputSignals();
+
+    /**
+     * @brief Tests that the Setup method fails with more than two output signals
+     */
+    bool TestSetup_FalseNumberOfOutputSignals();
+
+    /**
+     * @brief Tests that the Setup method fails if an output signal is not uint32
+     */
+    bool TestSetup_FalseOutputType();
+
+    /**
+     * @brief Tests that the Setup method fails if an output signal has more than one element
+     */
+    bool TestSetup_FalseOutputElements();
+
+    /**
+     * @brief Tests that the Execute method writes zero in the output signals when the allocations are not tracked
+     */
+    bool TestExecute();
+
+    /**
+     * @brief Tests the PrepareNextState method
+     */
+    bool TestPrepareNextState();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* ALLOCATIONTRACKERGAMTEST_H_ */
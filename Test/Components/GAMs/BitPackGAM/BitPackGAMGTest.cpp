@@ -0,0 +1,74 @@
+/**
+ * @file BitPackGAMGTest.cpp
+ * @brief Source file for class BitPackGAMGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BitPackGAMGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "BitPackGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BitPackGAMGTest,TestConstructor) {
+    BitPackGAMTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BitPackGAMGTest,TestSetup) {
+    BitPackGAMTest test;
+    ASSERT_TRUE(test.TestSetup());
+}
+
+TEST(BitPackGAMGTest,TestSetup_FalseBadType) {
+    BitPackGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadType());
+}
+
+TEST(BitPackGAMGTest,TestSetup_FalseBadNumberOfElements) {
+    BitPackGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadNumberOfElements());
+}
+
+TEST(BitPackGAMGTest,TestSetup_FalseBitOutOfRange) {
+    BitPackGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBitOutOfRange());
+}
+
+TEST(BitPackGAMGTest,TestExecute) {
+    BitPackGAMTest test;
+    ASSERT_TRUE(test.TestExecute());
+}
+
+TEST(BitPackGAMGTest,TestExecute_BitsMap) {
+    BitPackGAMTest test;
+    ASSERT_TRUE(test.TestExecute_BitsMap());
+}
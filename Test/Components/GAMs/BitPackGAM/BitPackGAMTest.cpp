@@ -0,0 +1,335 @@
+/**
+ * @file BitPackGAMTest.cpp
+ * @brief Source file for class BitPackGAMTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BitPackGAMTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "BitPackGAMTest.h"
+#include "MemoryDataSourceI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class BitPackGAMTestGAM: public BitPackGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    void *GetInputSignalMemory(const uint32 signalIdx);
+
+    void *GetOutputSignalMemory(const uint32 signalIdx);
+};
+
+void *BitPackGAMTestGAM::GetInputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetInputSignalMemory(signalIdx);
+}
+
+void *BitPackGAMTestGAM::GetOutputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetOutputSignalMemory(signalIdx);
+}
+
+CLASS_REGISTER(BitPackGAMTestGAM, "1.0")
+
+class BitPackGAMTestDS: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+            const char8 * const nextStateName);
+
+    virtual bool Synchronise();
+
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+};
+CLASS_REGISTER(BitPackGAMTestDS, "1.0")
+
+bool BitPackGAMTestDS::PrepareNextState(const char8 * const currentStateName,
+        const char8 * const nextStateName) {
+    return true;
+}
+
+bool BitPackGAMTestDS::Synchronise() {
+    return true;
+}
+
+const char8 *BitPackGAMTestDS::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    return "MemoryMapInputBroker";
+}
+
+/**
+ * @brief Configures an application with a single BitPackGAMTestGAM (GAMA) with the parameters and signals in gamConfig.
+ * The input signals shall use the Drv1 DataSource and the output signals the DDB DataSource.
+ */
+static bool InitialiseBitPackApplication(const char8 * const gamConfig) {
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = BitPackGAMTestGAM";
+    config += gamConfig;
+    config += ""
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = BitPackGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    config.Seek(0);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT < RealTimeApplication > application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+
+/**
+ * @brief Signals of the tests: 64 bits packed in two uint32 words and 3 bits packed in the bits 15, 0 and 17 of two uint16 words.
+ */
+static const char8 * const bitPackSignals = ""
+        "            InputSignals = {"
+        "                ABits = {"
+        "                    DataSource = Drv1"
+        "                    Type = uint8"
+        "                    NumberOfElements = 64"
+        "                }"
+        "                BBits = {"
+        "                    DataSource = Drv1"
+        "                    Type = uint8"
+        "                    NumberOfElements = 3"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                A = {"
+        "                    DataSource = DDB"
+        "                    Type = uint32"
+        "                    NumberOfElements = 2"
+        "                }"
+        "                B = {"
+        "                    DataSource = DDB"
+        "                    Type = uint16"
+        "                    NumberOfElements = 2"
+        "                    Bits = {15 0 17}"
+        "                }"
+        "            }";
+
+/**
+ * @brief Configures the application with the bitPackSignals and gets the GAM.
+ */
+static bool InitialiseBitPackTest(ReferenceT<BitPackGAMTestGAM> &gam) {
+    bool ok = InitialiseBitPackApplication(bitPackSignals);
+    if (ok) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = gam.IsValid();
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+BitPackGAMTest::BitPackGAMTest() {
+}
+
+BitPackGAMTest::~BitPackGAMTest() {
+}
+
+bool BitPackGAMTest::TestConstructor() {
+    BitPackGAMTestGAM gam;
+    return (!gam.HasBitsMap(0u));
+}
+
+bool BitPackGAMTest::TestSetup() {
+    ReferenceT<BitPackGAMTestGAM> gam;
+    bool ret = InitialiseBitPackTest(gam);
+    if (ret) {
+        ret = (!gam->HasBitsMap(0u));
+        ret &= (gam->HasBitsMap(1u));
+        ret &= (!gam->HasBitsMap(2u));
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool BitPackGAMTest::TestSetup_FalseBadType() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                ABits = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint8"
+            "                    NumberOfElements = 32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                A = {"
+            "                    DataSource = DDB"
+            "                    Type = int32"
+            "                }"
+            "            }";
+    bool ret = !InitialiseBitPackApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool BitPackGAMTest::TestSetup_FalseBadNumberOfElements() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                ABits = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint8"
+            "                    NumberOfElements = 8"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                A = {"
+            "                    DataSource = DDB"
+            "                    Type = uint16"
+            "                }"
+            "            }";
+    bool ret = !InitialiseBitPackApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool BitPackGAMTest::TestSetup_FalseBitOutOfRange() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                ABits = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint8"
+            "                    NumberOfElements = 2"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                A = {"
+            "                    DataSource = DDB"
+            "                    Type = uint8"
+            "                    Bits = {3 8}"
+            "                }"
+            "            }";
+    bool ret = !InitialiseBitPackApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool BitPackGAMTest::TestExecute() {
+    ReferenceT<BitPackGAMTestGAM> gam;
+    bool ret = InitialiseBitPackTest(gam);
+    if (ret) {
+        uint8 *aBits = static_cast<uint8 *>(gam->GetInputSignalMemory(0u));
+        uint32 *a = static_cast<uint32 *>(gam->GetOutputSignalMemory(0u));
+        const uint32 expected[] = { 0x80000001u, 0x00F0A500u };
+        for (uint32 k = 0u; k < 64u; k++) {
+            //Any value other than 0 is a 1.
+            aBits[k] = static_cast<uint8>(((expected[k / 32u] >> (k % 32u)) & 1u) * (k + 1u));
+        }
+        ret = gam->Execute();
+        if (ret) {
+            ret = (a[0] == expected[0]) && (a[1] == expected[1]);
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool BitPackGAMTest::TestExecute_BitsMap() {
+    ReferenceT<BitPackGAMTestGAM> gam;
+    bool ret = InitialiseBitPackTest(gam);
+    if (ret) {
+        uint8 *bBits = static_cast<uint8 *>(gam->GetInputSignalMemory(1u));
+        uint16 *b = static_cast<uint16 *>(gam->GetOutputSignalMemory(1u));
+        bBits[0] = 1u;
+        bBits[1] = 0u;
+        bBits[2] = 1u;
+        ret = gam->Execute();
+        if (ret) {
+            ret = (b[0] == 0x8000u) && (b[1] == 0x0002u);
+        }
+        if (ret) {
+            bBits[0] = 0u;
+            bBits[1] = 1u;
+            bBits[2] = 0u;
+            ret = gam->Execute();
+        }
+        if (ret) {
+            ret = (b[0] == 0x0001u) && (b[1] == 0x0000u);
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
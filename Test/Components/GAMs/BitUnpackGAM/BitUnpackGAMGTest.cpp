@@ -0,0 +1,74 @@
+/**
+ * @file BitUnpackGAMGTest.cpp
+ * @brief Source file for class BitUnpackGAMGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BitUnpackGAMGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "BitUnpackGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BitUnpackGAMGTest,TestConstructor) {
+    BitUnpackGAMTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BitUnpackGAMGTest,TestSetup) {
+    BitUnpackGAMTest test;
+    ASSERT_TRUE(test.TestSetup());
+}
+
+TEST(BitUnpackGAMGTest,TestSetup_FalseBadType) {
+    BitUnpackGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadType());
+}
+
+TEST(BitUnpackGAMGTest,TestSetup_FalseBadNumberOfElements) {
+    BitUnpackGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadNumberOfElements());
+}
+
+TEST(BitUnpackGAMGTest,TestSetup_FalseBitOutOfRange) {
+    BitUnpackGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBitOutOfRange());
+}
+
+TEST(BitUnpackGAMGTest,TestExecute) {
+    BitUnpackGAMTest test;
+    ASSERT_TRUE(test.TestExecute());
+}
+
+TEST(BitUnpackGAMGTest,TestExecute_BitsMap) {
+    BitUnpackGAMTest test;
+    ASSERT_TRUE(test.TestExecute_BitsMap());
+}
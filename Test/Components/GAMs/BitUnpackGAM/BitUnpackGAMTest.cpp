@@ -0,0 +1,331 @@
+/**
+ * @file BitUnpackGAMTest.cpp
+ * @brief Source file for class BitUnpackGAMTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BitUnpackGAMTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "BitUnpackGAMTest.h"
+#include "MemoryDataSourceI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class BitUnpackGAMTestGAM: public BitUnpackGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    void *GetInputSignalMemory(const uint32 signalIdx);
+
+    void *GetOutputSignalMemory(const uint32 signalIdx);
+};
+
+void *BitUnpackGAMTestGAM::GetInputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetInputSignalMemory(signalIdx);
+}
+
+void *BitUnpackGAMTestGAM::GetOutputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetOutputSignalMemory(signalIdx);
+}
+
+CLASS_REGISTER(BitUnpackGAMTestGAM, "1.0")
+
+class BitUnpackGAMTestDS: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+            const char8 * const nextStateName);
+
+    virtual bool Synchronise();
+
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+};
+CLASS_REGISTER(BitUnpackGAMTestDS, "1.0")
+
+bool BitUnpackGAMTestDS::PrepareNextState(const char8 * const currentStateName,
+        const char8 * const nextStateName) {
+    return true;
+}
+
+bool BitUnpackGAMTestDS::Synchronise() {
+    return true;
+}
+
+const char8 *BitUnpackGAMTestDS::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    return "MemoryMapInputBroker";
+}
+
+/**
+ * @brief Configures an application with a single BitUnpackGAMTestGAM (GAMA) with the parameters and signals in gamConfig.
+ * The input signals shall use the Drv1 DataSource and the output signals the DDB DataSource.
+ */
+static bool InitialiseBitUnpackApplication(const char8 * const gamConfig) {
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = BitUnpackGAMTestGAM";
+    config += gamConfig;
+    config += ""
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = BitUnpackGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    config.Seek(0);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT < RealTimeApplication > application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+
+/**
+ * @brief Signals of the tests: all the bits of two uint32 words and the bits 15, 0, 17 and 0 of two uint16 words.
+ */
+static const char8 * const bitUnpackSignals = ""
+        "            InputSignals = {"
+        "                A = {"
+        "                    DataSource = Drv1"
+        "                    Type = uint32"
+        "                    NumberOfElements = 2"
+        "                }"
+        "                B = {"
+        "                    DataSource = Drv1"
+        "                    Type = uint16"
+        "                    NumberOfElements = 2"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                ABits = {"
+        "                    DataSource = DDB"
+        "                    Type = uint8"
+        "                    NumberOfElements = 64"
+        "                }"
+        "                BBits = {"
+        "                    DataSource = DDB"
+        "                    Type = uint8"
+        "                    NumberOfElements = 4"
+        "                    Bits = {15 0 17 0}"
+        "                }"
+        "            }";
+
+/**
+ * @brief Configures the application with the bitUnpackSignals and gets the GAM.
+ */
+static bool InitialiseBitUnpackTest(ReferenceT<BitUnpackGAMTestGAM> &gam) {
+    bool ok = InitialiseBitUnpackApplication(bitUnpackSignals);
+    if (ok) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = gam.IsValid();
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+BitUnpackGAMTest::BitUnpackGAMTest() {
+}
+
+BitUnpackGAMTest::~BitUnpackGAMTest() {
+}
+
+bool BitUnpackGAMTest::TestConstructor() {
+    BitUnpackGAMTestGAM gam;
+    return (!gam.HasBitsMap(0u));
+}
+
+bool BitUnpackGAMTest::TestSetup() {
+    ReferenceT<BitUnpackGAMTestGAM> gam;
+    bool ret = InitialiseBitUnpackTest(gam);
+    if (ret) {
+        ret = (!gam->HasBitsMap(0u));
+        ret &= (gam->HasBitsMap(1u));
+        ret &= (!gam->HasBitsMap(2u));
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool BitUnpackGAMTest::TestSetup_FalseBadType() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                A = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                ABits = {"
+            "                    DataSource = DDB"
+            "                    Type = uint8"
+            "                    NumberOfElements = 32"
+            "                }"
+            "            }";
+    bool ret = !InitialiseBitUnpackApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool BitUnpackGAMTest::TestSetup_FalseBadNumberOfElements() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                A = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint16"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                ABits = {"
+            "                    DataSource = DDB"
+            "                    Type = uint8"
+            "                    NumberOfElements = 8"
+            "                }"
+            "            }";
+    bool ret = !InitialiseBitUnpackApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool BitUnpackGAMTest::TestSetup_FalseBitOutOfRange() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                A = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint16"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                ABits = {"
+            "                    DataSource = DDB"
+            "                    Type = uint8"
+            "                    NumberOfElements = 2"
+            "                    Bits = {3 16}"
+            "                }"
+            "            }";
+    bool ret = !InitialiseBitUnpackApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool BitUnpackGAMTest::TestExecute() {
+    ReferenceT<BitUnpackGAMTestGAM> gam;
+    bool ret = InitialiseBitUnpackTest(gam);
+    if (ret) {
+        uint32 *a = static_cast<uint32 *>(gam->GetInputSignalMemory(0u));
+        uint8 *aBits = static_cast<uint8 *>(gam->GetOutputSignalMemory(0u));
+        a[0] = 0x80000001u;
+        a[1] = 0x00F0A500u;
+        ret = gam->Execute();
+        for (uint32 k = 0u; (k < 64u) && (ret); k++) {
+            uint32 expected = ((a[k / 32u] >> (k % 32u)) & 1u);
+            ret = (aBits[k] == expected);
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool BitUnpackGAMTest::TestExecute_BitsMap() {
+    ReferenceT<BitUnpackGAMTestGAM> gam;
+    bool ret = InitialiseBitUnpackTest(gam);
+    if (ret) {
+        uint16 *b = static_cast<uint16 *>(gam->GetInputSignalMemory(1u));
+        uint8 *bBits = static_cast<uint8 *>(gam->GetOutputSignalMemory(1u));
+        b[0] = 0x8000u;
+        b[1] = 0x0002u;
+        ret = gam->Execute();
+        if (ret) {
+            ret = (bBits[0] == 1u) && (bBits[1] == 0u) && (bBits[2] == 1u) && (bBits[3] == 0u);
+        }
+        if (ret) {
+            b[0] = 0x0001u;
+            b[1] = 0x0000u;
+            ret = gam->Execute();
+        }
+        if (ret) {
+            ret = (bBits[0] == 0u) && (bBits[1] == 1u) && (bBits[2] == 0u) && (bBits[3] == 1u);
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file BitUnpackGAMTest.h
+ * @brief Header file for class BitUnpackGAMTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BitUnpackGAMTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BITUNPACKGAMTEST_H_
+#define BITUNPACKGAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BitUnpackGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the BitUnpackGAM methods
+ */
+class BitUnpackGAMTest {
+public:
+
+    /**
+     * @brief Constructor
+     */
+    BitUnpackGAMTest();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~BitUnpackGAMTest();
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Setup method with and without a Bits map
+     */
+    bool TestSetup();
+
+    /**
+     * @brief Tests that the Setup method fails if an input signal is not an unsigned integer
+     */
+    bool TestSetup_FalseBadType();
+
+    /**
+     * @brief Tests that the Setup method fails if an output signal without Bits map does not have one element per input bit
+     */
+    bool TestSetup_FalseBadNumberOfElements();
+
+    /**
+     * @brief Tests that the Setup method fails if the Bits map has a bit which is not in the input signal
+     */
+    bool TestSetup_FalseBitOutOfRange();
+
+    /**
+     * @brief Tests the Execute method expanding all the bits
+     */
+    bool TestExecute();
+
+    /**
+     * @brief Tests the Execute method with a Bits map
+     */
+    bool TestExecute_BitsMap();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BITUNPACKGAMTEST_H_ */
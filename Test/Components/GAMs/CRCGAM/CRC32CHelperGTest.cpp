@@ -0,0 +1,68 @@
+/**
+ * @file CRC32CHelperGTest.cpp
+ * @brief Source file for class CRC32CHelperGTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CRC32CHelperGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "CRC32CHelperTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(CRC32CHelperGTest,TestCompute_CheckValue) {
+    CRC32CHelperTest test;
+    ASSERT_TRUE(test.TestCompute_CheckValue());
+}
+
+TEST(CRC32CHelperGTest,TestCompute_SameAsSlicing) {
+    CRC32CHelperTest test;
+    ASSERT_TRUE(test.TestCompute_SameAsSlicing());
+}
+
+TEST(CRC32CHelperGTest,TestCompute_InputInverted) {
+    CRC32CHelperTest test;
+    ASSERT_TRUE(test.TestCompute_InputInverted());
+}
+
+TEST(CRC32CHelperGTest,TestIsSupported) {
+    CRC32CHelperTest test;
+    ASSERT_TRUE(test.TestIsSupported());
+}
+
+TEST(CRC32CHelperGTest,TestCombine) {
+    CRC32CHelperTest test;
+    ASSERT_TRUE(test.TestCombine());
+}
@@ -0,0 +1,118 @@
+/**
+ * @file CRC32CHelperTest.cpp
+ * @brief Source file for class CRC32CHelperTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CRC32CHelperTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "CRC32CHelperTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+bool CRC32CHelperTest::TestCompute_CheckValue() {
+    const uint8 checkData[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    CRC32CHelper crc;
+    uint32 polynomial = crc32cPolynomial;
+    uint32 initCRC = 0xFFFFFFFFu;
+    uint32 ret = 0u;
+    crc.ComputeTable(&polynomial);
+    crc.Compute(&checkData[0], 9, &initCRC, false, &ret);
+    return (ret == ~0xE3069283u);
+}
+
+bool CRC32CHelperTest::TestCompute_SameAsSlicing() {
+    const uint32 size = 256u;
+    uint8 data[size];
+    for (uint32 i = 0u; i < size; i++) {
+        data[i] = static_cast<uint8>((i * 31u) + 7u);
+    }
+    CRC32CHelper crc;
+    CRCSlicingHelperT<uint32> slicing(true);
+    uint32 polynomial = crc32cPolynomial;
+    crc.ComputeTable(&polynomial);
+    slicing.ComputeTable(&polynomial);
+    bool ok = true;
+    for (uint32 offset = 0u; (offset < 8u) && (ok); offset++) {
+        for (uint32 n = 0u; (n < (size - offset)) && (ok); n++) {
+            uint32 initCRC = 0x12345678u;
+            uint32 ret = 0u;
+            uint32 expected = 0u;
+            crc.Compute(&data[offset], static_cast<int32>(n), &initCRC, false, &ret);
+            slicing.Compute(&data[offset], static_cast<int32>(n), &initCRC, false, &expected);
+            ok = (ret == expected);
+        }
+    }
+    return ok;
+}
+
+bool CRC32CHelperTest::TestCompute_InputInverted() {
+    const uint8 data[4] = { 1u, 2u, 3u, 4u };
+    const uint8 reversed[4] = { 4u, 3u, 2u, 1u };
+    CRC32CHelper crc;
+    uint32 initCRC = 0xFFFFFFFFu;
+    uint32 inverted = 0u;
+    uint32 expected = 0u;
+    crc.Compute(&data[3], 4, &initCRC, true, &inverted);
+    crc.Compute(&reversed[0], 4, &initCRC, false, &expected);
+    return (inverted == expected);
+}
+
+bool CRC32CHelperTest::TestIsSupported() {
+    bool supported = CRC32CHelper::IsSupported();
+    return (CRC32CHelper::IsSupported() == supported);
+}
+
+bool CRC32CHelperTest::TestCombine() {
+    const uint32 size = 100u;
+    uint8 data[size];
+    for (uint32 i = 0u; i < size; i++) {
+        data[i] = static_cast<uint8>((i * 17u) + 3u);
+    }
+    CRC32CHelper crc;
+    uint32 initCRC = 0xFFFFFFFFu;
+    uint32 expected = 0u;
+    crc.Compute(&data[0], static_cast<int32>(size), &initCRC, false, &expected);
+    uint32 op[crcOperatorSize];
+    bool ok = true;
+    for (uint32 split = 0u; (split <= size) && (ok); split++) {
+        uint32 crcValue = 0u;
+        uint32 nextCRC = 0u;
+        crc.Compute(&data[0], static_cast<int32>(split), &initCRC, false, &crcValue);
+        crc.Compute(&data[split], static_cast<int32>(size - split), &initCRC, false, &nextCRC);
+        crc.ComputeZerosOperator(size - split, &op[0]);
+        crc.Combine(&op[0], &crcValue, &nextCRC, &initCRC);
+        ok = (crcValue == expected);
+    }
+    return ok;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file CRC32CHelperTest.h
+ * @brief Header file for class CRC32CHelperTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CRC32CHelperTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_COMPONENTS_GAMS_CRCGAM_CRC32CHELPERTEST_H_
+#define TEST_COMPONENTS_GAMS_CRCGAM_CRC32CHELPERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CRC32CHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Test class for CRC32CHelper
+ */
+class CRC32CHelperTest {
+public:
+
+    /**
+     * @brief Tests that the CRC of "123456789" is the CRC-32C check value.
+     */
+    bool TestCompute_CheckValue();
+
+    /**
+     * @brief Tests that the CRC is the same of the reflected CRCSlicingHelperT<uint32> with the CRC-32C polynomial
+     * for all the lengths and alignments of the data.
+     */
+    bool TestCompute_SameAsSlicing();
+
+    /**
+     * @brief Tests the Compute with the bytes traversed in reverse order (inputInverted).
+     */
+    bool TestCompute_InputInverted();
+
+    /**
+     * @brief Tests that the IsSupported method does not change between calls.
+     */
+    bool TestIsSupported();
+
+    /**
+     * @brief Tests that combining the CRCs of two blocks gives the CRC of the concatenated blocks.
+     */
+    bool TestCombine();
+
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_COMPONENTS_GAMS_CRCGAM_CRC32CHELPERTEST_H_ */
@@ -76,6 +76,36 @@ TEST(CRCGAMGTest,TestInitialiseWrongInverted) {
     ASSERT_TRUE(test.TestInitialiseWrongInverted());
 }
 
+TEST(CRCGAMGTest,TestInitialiseReflected) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseReflected());
+}
+
+TEST(CRCGAMGTest,TestInitialiseWrongReflected) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongReflected());
+}
+
+TEST(CRCGAMGTest,TestInitialiseCombineCRCs) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseCombineCRCs());
+}
+
+TEST(CRCGAMGTest,TestInitialiseWrongCombineCRCs) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongCombineCRCs());
+}
+
+TEST(CRCGAMGTest,TestInitialiseCombineCRCsMissingBlockSizes) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseCombineCRCsMissingBlockSizes());
+}
+
+TEST(CRCGAMGTest,TestInitialiseCombineCRCsInverted) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseCombineCRCsInverted());
+}
+
 TEST(CRCGAMGTest,TestSetupUint8) {
     CRCGAMTest test;
     ASSERT_TRUE(test.TestSetupUint8());
@@ -122,11 +152,38 @@ TEST(CRCGAMGTest,TestExecuteUint32) {
     ASSERT_TRUE(test.TestExecuteUint32());
 }
 
+TEST(CRCGAMGTest,TestInitialiseVerify) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseVerify());
+}
+
+TEST(CRCGAMGTest,TestInitialiseVerifyInverted) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseVerifyInverted());
+}
+
+TEST(CRCGAMGTest,TestInitialiseVerifyWrongCRCOffset) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseVerifyWrongCRCOffset());
+}
+
+TEST(CRCGAMGTest,TestSetupVerifyTooManyFrames) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestSetupVerifyTooManyFrames());
+}
+
+TEST(CRCGAMGTest,TestExecuteVerify) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestExecuteVerify());
+}
+
+TEST(CRCGAMGTest,TestExecuteVerifyStopOnError) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestExecuteVerifyStopOnError());
+}
+
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 
-
-
-	
@@ -36,6 +36,7 @@
 #include "ConfigurationDatabase.h"
 #include "CRCGAMTest.h"
 #include "DataSourceI.h"
+#include "MemoryOperationsHelper.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
 #include "RealTimeApplication.h"
@@ -233,6 +234,114 @@ bool CRCGAMTest::TestInitialiseWrongInverted() {
     return ok;
 }
 
+bool CRCGAMTest::TestInitialiseReflected() {
+    using namespace MARTe;
+    CRCGAM gam;
+    bool ok;
+    ConfigurationDatabase config;
+    uint32 pol = 0x1EDC6F41u;
+    uint32 initCRC = 0xFFFFFFFFu;
+    uint8 inverted = 0;
+    uint8 reflected = 1;
+    config.Write("Polynomial", pol);
+    config.Write("InitialValue", initCRC);
+    config.Write("Inverted", inverted);
+    config.Write("Reflected", reflected);
+    ok = gam.Initialise(config);
+    return ok;
+}
+
+bool CRCGAMTest::TestInitialiseWrongReflected() {
+    using namespace MARTe;
+    CRCGAM gam;
+    bool ok;
+    ConfigurationDatabase config;
+    uint32 pol = 0;
+    uint32 initCRC = 0;
+    uint8 inverted = 0;
+    uint8 reflected = 2;
+    config.Write("Polynomial", pol);
+    config.Write("InitialValue", initCRC);
+    config.Write("Inverted", inverted);
+    config.Write("Reflected", reflected);
+    ok = !gam.Initialise(config);
+    return ok;
+}
+
+bool CRCGAMTest::TestInitialiseCombineCRCs() {
+    using namespace MARTe;
+    CRCGAM gam;
+    bool ok;
+    ConfigurationDatabase config;
+    uint32 pol = 0x4C11DB7u;
+    uint32 initCRC = 0xFFFFFFFFu;
+    uint8 inverted = 0;
+    uint8 combineCRCs = 1;
+    config.Write("Polynomial", pol);
+    config.Write("InitialValue", initCRC);
+    config.Write("Inverted", inverted);
+    config.Write("CombineCRCs", combineCRCs);
+    uint32 blockSizes[3] = { 4u, 16u, 8u };
+    config.Write("BlockSizes", blockSizes);
+    ok = gam.Initialise(config);
+    return ok;
+}
+
+bool CRCGAMTest::TestInitialiseWrongCombineCRCs() {
+    using namespace MARTe;
+    CRCGAM gam;
+    bool ok;
+    ConfigurationDatabase config;
+    uint32 pol = 0x4C11DB7u;
+    uint32 initCRC = 0xFFFFFFFFu;
+    uint8 inverted = 0;
+    uint8 combineCRCs = 2;
+    config.Write("Polynomial", pol);
+    config.Write("InitialValue", initCRC);
+    config.Write("Inverted", inverted);
+    config.Write("CombineCRCs", combineCRCs);
+    uint32 blockSizes[3] = { 4u, 16u, 8u };
+    config.Write("BlockSizes", blockSizes);
+    ok = !gam.Initialise(config);
+    return ok;
+}
+
+bool CRCGAMTest::TestInitialiseCombineCRCsMissingBlockSizes() {
+    using namespace MARTe;
+    CRCGAM gam;
+    bool ok;
+    ConfigurationDatabase config;
+    uint32 pol = 0x4C11DB7u;
+    uint32 initCRC = 0xFFFFFFFFu;
+    uint8 inverted = 0;
+    uint8 combineCRCs = 1;
+    config.Write("Polynomial", pol);
+    config.Write("InitialValue", initCRC);
+    config.Write("Inverted", inverted);
+    config.Write("CombineCRCs", combineCRCs);
+    ok = !gam.Initialise(config);
+    return ok;
+}
+
+bool CRCGAMTest::TestInitialiseCombineCRCsInverted() {
+    using namespace MARTe;
+    CRCGAM gam;
+    bool ok;
+    ConfigurationDatabase config;
+    uint32 pol = 0x4C11DB7u;
+    uint32 initCRC = 0xFFFFFFFFu;
+    uint8 inverted = 1;
+    uint8 combineCRCs = 1;
+    config.Write("Polynomial", pol);
+    config.Write("InitialValue", initCRC);
+    config.Write("Inverted", inverted);
+    config.Write("CombineCRCs", combineCRCs);
+    uint32 blockSizes[3] = { 4u, 16u, 8u };
+    config.Write("BlockSizes", blockSizes);
+    ok = !gam.Initialise(config);
+    return ok;
+}
+
 bool CRCGAMTest::TestSetupUint8() {
     using namespace MARTe;
     ConfigurationDatabase cdb;
@@ -541,3 +650,234 @@ bool CRCGAMTest::TestExecuteUint32() {
     return TestExecute<MARTe::uint32>(1024);
 }
 	
+
+static bool WriteVerifyInitialiseConfig(MARTe::ConfigurationDatabase &config) {
+    using namespace MARTe;
+    bool ok = config.Write("Polynomial", 0x1021);
+    if (ok) {
+        ok = config.Write("InitialValue", 0xFFFF);
+    }
+    if (ok) {
+        ok = config.Write("Inverted", 0);
+    }
+    if (ok) {
+        ok = config.Write("Verify", 1);
+    }
+    if (ok) {
+        ok = config.Write("CRCType", "uint16");
+    }
+    if (ok) {
+        ok = config.Write("FrameSize", 8);
+    }
+    return ok;
+}
+
+bool CRCGAMTest::TestInitialiseVerify() {
+    using namespace MARTe;
+    CRCGAM gam;
+    ConfigurationDatabase config;
+    bool ok = WriteVerifyInitialiseConfig(config);
+    if (ok) {
+        ok = gam.Initialise(config);
+    }
+    return ok;
+}
+
+bool CRCGAMTest::TestInitialiseVerifyInverted() {
+    using namespace MARTe;
+    CRCGAM gam;
+    ConfigurationDatabase config;
+    bool ok = WriteVerifyInitialiseConfig(config);
+    if (ok) {
+        ok = config.Delete("Inverted");
+    }
+    if (ok) {
+        ok = config.Write("Inverted", 1);
+    }
+    if (ok) {
+        ok = !gam.Initialise(config);
+    }
+    return ok;
+}
+
+bool CRCGAMTest::TestInitialiseVerifyWrongCRCOffset() {
+    using namespace MARTe;
+    CRCGAM gam;
+    ConfigurationDatabase config;
+    bool ok = WriteVerifyInitialiseConfig(config);
+    if (ok) {
+        ok = config.Write("CRCOffset", 7);
+    }
+    if (ok) {
+        ok = !gam.Initialise(config);
+    }
+    return ok;
+}
+
+bool CRCGAMTest::ConfigureVerify(const MARTe::uint32 numberOfFrames,
+                                 const MARTe::uint32 crcOffset,
+                                 const MARTe::uint8 stopOnError) {
+    using namespace MARTe;
+    StreamString configStream;
+    bool ok = configStream.Printf(""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = CRCTestHelper"
+            "            Polynomial = 0x1021"
+            "            InitialValue = 0xFFFF"
+            "            Inverted = 0"
+            "            Verify = 1"
+            "            CRCType = uint16"
+            "            FrameSize = 8"
+            "            CRCOffset = %u"
+            "            StopOnError = %u"
+            "            InputSignals = {"
+            "               Frames = {"
+            "                   DataSource = DDB1"
+            "                   Type = uint8"
+            "                   NumberOfElements = %u"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               ValidFrames = {"
+            "                   DataSource = DDB1"
+            "                   Type = uint8"
+            "               }"
+            "               InvalidFrames = {"
+            "                   DataSource = DDB1"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}", crcOffset, static_cast<uint32>(stopOnError), (numberOfFrames * 8u));
+    ConfigurationDatabase cdb;
+    if (ok) {
+        configStream.Seek(0LLU);
+        StandardParser parser(configStream, cdb);
+        ok = parser.Parse();
+    }
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        cdb.MoveToRoot();
+        ord->Purge();
+        ok = ord->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = ord->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+bool CRCGAMTest::ExecuteVerify(const MARTe::uint32 numberOfFrames,
+                               const MARTe::uint32 crcOffset,
+                               const MARTe::uint32 corrupted,
+                               const MARTe::uint8 expectedMask,
+                               const MARTe::uint32 expectedErrors) {
+    using namespace MARTe;
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ReferenceT<CRCTestHelper> gam = ord->Find("Test.Functions.GAM1");
+    bool ok = gam.IsValid();
+    if (ok) {
+        CRCSlicingHelperT<uint16> helper(false);
+        uint32 polynomial = 0x1021u;
+        helper.ComputeTable(&polynomial);
+        uint16 initialValue = 0xFFFFu;
+        uint8 *frames = reinterpret_cast<uint8 *>(gam->GetInputSignalMemory(0u));
+        uint32 n;
+        for (n = 0u; n < numberOfFrames; n++) {
+            uint8 *frame = &frames[n * 8u];
+            uint32 i;
+            for (i = 0u; i < 8u; i++) {
+                frame[i] = static_cast<uint8>((n * 8u) + i);
+            }
+            uint16 crc = 0u;
+            helper.Compute(frame, static_cast<int32>(crcOffset), &initialValue, false, &crc);
+            if ((crcOffset + 2u) < 8u) {
+                helper.Compute(&frame[crcOffset + 2u], static_cast<int32>(8u - crcOffset - 2u), &crc, false, &crc);
+            }
+            (void) MemoryOperationsHelper::Copy(&frame[crcOffset], &crc, 2u);
+            if (n == corrupted) {
+                frame[0] ^= 0x1u;
+            }
+        }
+        ok = gam->Execute();
+    }
+    if (ok) {
+        uint8 mask = *reinterpret_cast<uint8 *>(gam->GetOutputSignalMemory(0u));
+        uint32 errors = *reinterpret_cast<uint32 *>(gam->GetOutputSignalMemory(1u));
+        ok = (mask == expectedMask) && (errors == expectedErrors);
+    }
+    return ok;
+}
+
+bool CRCGAMTest::TestSetupVerifyTooManyFrames() {
+    using namespace MARTe;
+    bool ok = !ConfigureVerify(9u, 6u, 0u);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool CRCGAMTest::TestExecuteVerify() {
+    using namespace MARTe;
+    bool ok = ConfigureVerify(3u, 6u, 0u);
+    if (ok) {
+        ok = ExecuteVerify(3u, 6u, 0xFFFFFFFFu, 0x7u, 0u);
+    }
+    if (ok) {
+        ok = ExecuteVerify(3u, 6u, 1u, 0x5u, 1u);
+    }
+    if (ok) {
+        ok = ExecuteVerify(3u, 6u, 0u, 0x6u, 2u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool CRCGAMTest::TestExecuteVerifyStopOnError() {
+    using namespace MARTe;
+    bool ok = ConfigureVerify(4u, 2u, 1u);
+    if (ok) {
+        ok = ExecuteVerify(4u, 2u, 0xFFFFFFFFu, 0xFu, 0u);
+    }
+    if (ok) {
+        ok = ExecuteVerify(4u, 2u, 1u, 0x1u, 1u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
@@ -84,6 +84,38 @@ public:
      */
     bool TestInitialiseWrongInverted();
 
+    /**
+     * @brief Test the initialise function with the optional Reflected
+     * parameter equal to 1
+     */
+    bool TestInitialiseReflected();
+
+    /**
+     * @brief Test the initialise function when the Reflected
+     * parameter is greater then 1
+     */
+    bool TestInitialiseWrongReflected();
+
+    /**
+     * @brief Tests the Initialise method with CombineCRCs and BlockSizes.
+     */
+    bool TestInitialiseCombineCRCs();
+
+    /**
+     * @brief Tests that the Initialise method fails with CombineCRCs different from 0 and 1.
+     */
+    bool TestInitialiseWrongCombineCRCs();
+
+    /**
+     * @brief Tests that the Initialise method fails with CombineCRCs and no BlockSizes.
+     */
+    bool TestInitialiseCombineCRCsMissingBlockSizes();
+
+    /**
+     * @brief Tests that the Initialise method fails with CombineCRCs and Inverted.
+     */
+    bool TestInitialiseCombineCRCsInverted();
+
     /**
      * @brief Test the Setup function for output type = uint8
      */
@@ -135,6 +167,54 @@ public:
      * @brief Test the execute function for output type = uint32
      */
     bool TestExecuteUint32();
+
+    /**
+     * @brief Test the Initialise function with Verify = 1
+     */
+    bool TestInitialiseVerify();
+
+    /**
+     * @brief Test the Initialise function with Verify = 1 and Inverted = 1
+     */
+    bool TestInitialiseVerifyInverted();
+
+    /**
+     * @brief Test the Initialise function with Verify = 1 and a CRC field outside the frame
+     */
+    bool TestInitialiseVerifyWrongCRCOffset();
+
+    /**
+     * @brief Test the setup function with Verify = 1 and more frames than the bits of the bitmask
+     */
+    bool TestSetupVerifyTooManyFrames();
+
+    /**
+     * @brief Test the execute function with Verify = 1 and one corrupted frame
+     */
+    bool TestExecuteVerify();
+
+    /**
+     * @brief Test the execute function with Verify = 1, StopOnError = 1 and the CRC field in the middle of the frames
+     */
+    bool TestExecuteVerifyStopOnError();
+
+private:
+
+    /**
+     * @brief Configures a verify application with \a numberOfFrames frames of 8 bytes, the CRC (uint16) at \a crcOffset and a uint8 bitmask.
+     */
+    bool ConfigureVerify(const MARTe::uint32 numberOfFrames,
+                         const MARTe::uint32 crcOffset,
+                         const MARTe::uint8 stopOnError);
+
+    /**
+     * @brief Checks the frames of the verify application, after corrupting the frame \a corrupted (0xFFFFFFFF for none).
+     */
+    bool ExecuteVerify(const MARTe::uint32 numberOfFrames,
+                       const MARTe::uint32 crcOffset,
+                       const MARTe::uint32 corrupted,
+                       const MARTe::uint8 expectedMask,
+                       const MARTe::uint32 expectedErrors);
 };
 
 
@@ -0,0 +1,98 @@
+/**
+ * @file CRCSlicingHelperTGTest.cpp
+ * @brief Source file for class CRCSlicingHelperTGTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CRCSlicingHelperTGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "CRCSlicingHelperTTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(CRCSlicingHelperTGTest,TestCompute_CheckValues) {
+    CRCSlicingHelperTTest test;
+    ASSERT_TRUE(test.TestCompute_CheckValues());
+}
+
+TEST(CRCSlicingHelperTGTest,TestCompute_CheckValuesReflected) {
+    CRCSlicingHelperTTest test;
+    ASSERT_TRUE(test.TestCompute_CheckValuesReflected());
+}
+
+TEST(CRCSlicingHelperTGTest,TestCompute_SameAsCRCHelperTUint8) {
+    CRCSlicingHelperTTest test;
+    ASSERT_TRUE(test.TestCompute_SameAsCRCHelperTUint8());
+}
+
+TEST(CRCSlicingHelperTGTest,TestCompute_SameAsCRCHelperTUint16) {
+    CRCSlicingHelperTTest test;
+    ASSERT_TRUE(test.TestCompute_SameAsCRCHelperTUint16());
+}
+
+TEST(CRCSlicingHelperTGTest,TestCompute_SameAsCRCHelperTUint32) {
+    CRCSlicingHelperTTest test;
+    ASSERT_TRUE(test.TestCompute_SameAsCRCHelperTUint32());
+}
+
+TEST(CRCSlicingHelperTGTest,TestCompute_ReflectedBlocks) {
+    CRCSlicingHelperTTest test;
+    ASSERT_TRUE(test.TestCompute_ReflectedBlocks());
+}
+
+TEST(CRCSlicingHelperTGTest,TestCompute_InputInverted) {
+    CRCSlicingHelperTTest test;
+    ASSERT_TRUE(test.TestCompute_InputInverted());
+}
+
+TEST(CRCSlicingHelperTGTest,TestIsReflected) {
+    CRCSlicingHelperTTest test;
+    ASSERT_TRUE(test.TestIsReflected());
+}
+
+TEST(CRCSlicingHelperTGTest,TestCombineUint16) {
+    CRCSlicingHelperTTest test;
+    ASSERT_TRUE(test.TestCombineUint16());
+}
+
+TEST(CRCSlicingHelperTGTest,TestCombineUint32) {
+    CRCSlicingHelperTTest test;
+    ASSERT_TRUE(test.TestCombineUint32());
+}
+
+TEST(CRCSlicingHelperTGTest,TestCombineReflected) {
+    CRCSlicingHelperTTest test;
+    ASSERT_TRUE(test.TestCombineReflected());
+}
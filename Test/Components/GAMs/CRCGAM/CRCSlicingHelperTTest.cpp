@@ -0,0 +1,207 @@
+/**
+ * @file CRCSlicingHelperTTest.cpp
+ * @brief Source file for class CRCSlicingHelperTTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CRCSlicingHelperTTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "CRCHelperT.h"
+#include "CRCSlicingHelperTTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * The data of the check values of the CRC catalogues.
+ */
+static const uint8 checkData[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+/**
+ * Number of pseudo-random test bytes.
+ */
+static const uint32 testDataSize = 256u;
+
+static void FillTestData(uint8 * const data) {
+    uint32 x = 12345u;
+    for (uint32 i = 0u; i < testDataSize; i++) {
+        x = (x * 1103515245u) + 12345u;
+        data[i] = static_cast<uint8>(x >> 16u);
+    }
+}
+
+template<typename T>
+static T ComputeCRC(CRCHelper &helper,
+                    T polynomial,
+                    const uint8 * const data,
+                    const int32 size,
+                    T initCRC) {
+    T ret = 0u;
+    helper.ComputeTable(&polynomial);
+    helper.Compute(data, size, &initCRC, false, &ret);
+    return ret;
+}
+
+bool CRCSlicingHelperTTest::TestCompute_CheckValues() {
+    CRCSlicingHelperT<uint8> crc8;
+    CRCSlicingHelperT<uint16> crc16;
+    CRCSlicingHelperT<uint32> crc32;
+    bool ok = (ComputeCRC<uint8>(crc8, 0x7u, &checkData[0], 9, 0u) == 0xF4u);
+    if (ok) {
+        ok = (ComputeCRC<uint16>(crc16, 0x1021u, &checkData[0], 9, 0u) == 0x31C3u);
+    }
+    if (ok) {
+        ok = (ComputeCRC<uint32>(crc32, 0x4C11DB7u, &checkData[0], 9, 0xFFFFFFFFu) == 0x0376E6E7u);
+    }
+    return ok;
+}
+
+bool CRCSlicingHelperTTest::TestCompute_CheckValuesReflected() {
+    CRCSlicingHelperT<uint16> crc16(true);
+    CRCSlicingHelperT<uint32> crc32(true);
+    CRCSlicingHelperT<uint32> crc32c(true);
+    bool ok = (ComputeCRC<uint16>(crc16, 0x8005u, &checkData[0], 9, 0u) == 0xBB3Du);
+    if (ok) {
+        //No final xor is applied
+        ok = (ComputeCRC<uint32>(crc32, 0x4C11DB7u, &checkData[0], 9, 0xFFFFFFFFu) == ~0xCBF43926u);
+    }
+    if (ok) {
+        ok = (ComputeCRC<uint32>(crc32c, 0x1EDC6F41u, &checkData[0], 9, 0xFFFFFFFFu) == ~0xE3069283u);
+    }
+    return ok;
+}
+
+template<typename T>
+bool CRCSlicingHelperTTest::TestCompute_SameAsCRCHelperT(T polynomial,
+                                                         T initCRC) {
+    uint8 data[testDataSize];
+    FillTestData(&data[0]);
+    CRCSlicingHelperT<T> slicing;
+    CRCHelperT<T> reference;
+    bool ok = true;
+    for (uint32 offset = 0u; (offset < 8u) && (ok); offset++) {
+        for (uint32 size = 0u; (size < (testDataSize - offset)) && (ok); size++) {
+            T expected = ComputeCRC<T>(reference, polynomial, &data[offset], static_cast<int32>(size), initCRC);
+            ok = (ComputeCRC<T>(slicing, polynomial, &data[offset], static_cast<int32>(size), initCRC) == expected);
+        }
+    }
+    return ok;
+}
+
+bool CRCSlicingHelperTTest::TestCompute_SameAsCRCHelperTUint8() {
+    return TestCompute_SameAsCRCHelperT<uint8>(0x7u, 0x5Au);
+}
+
+bool CRCSlicingHelperTTest::TestCompute_SameAsCRCHelperTUint16() {
+    return TestCompute_SameAsCRCHelperT<uint16>(0x1021u, 0x1234u);
+}
+
+bool CRCSlicingHelperTTest::TestCompute_SameAsCRCHelperTUint32() {
+    return TestCompute_SameAsCRCHelperT<uint32>(0x4C11DB7u, 0xDEADBEEFu);
+}
+
+bool CRCSlicingHelperTTest::TestCompute_ReflectedBlocks() {
+    uint8 data[testDataSize];
+    FillTestData(&data[0]);
+    CRCSlicingHelperT<uint32> slicing(true);
+    uint32 polynomial = 0x4C11DB7u;
+    //The CRC of the whole buffer must be the CRC of the last byte with the CRC of the others as initial value
+    bool ok = true;
+    for (uint32 size = 1u; (size < testDataSize) && (ok); size++) {
+        uint32 head = ComputeCRC<uint32>(slicing, polynomial, &data[0], static_cast<int32>(size - 1u), 0xFFFFFFFFu);
+        uint32 expected = ComputeCRC<uint32>(slicing, polynomial, &data[size - 1u], 1, head);
+        ok = (ComputeCRC<uint32>(slicing, polynomial, &data[0], static_cast<int32>(size), 0xFFFFFFFFu) == expected);
+    }
+    return ok;
+}
+
+bool CRCSlicingHelperTTest::TestCompute_InputInverted() {
+    uint8 data[testDataSize];
+    FillTestData(&data[0]);
+    uint8 reversed[testDataSize];
+    for (uint32 i = 0u; i < testDataSize; i++) {
+        reversed[i] = data[(testDataSize - 1u) - i];
+    }
+    uint16 polynomial = 0x1021u;
+    uint16 initCRC = 0u;
+    uint16 inverted = 0u;
+    uint16 reflectedInverted = 0u;
+    CRCSlicingHelperT<uint16> slicing;
+    CRCSlicingHelperT<uint16> reflected(true);
+    slicing.ComputeTable(&polynomial);
+    reflected.ComputeTable(&polynomial);
+    slicing.Compute(&data[testDataSize - 1u], static_cast<int32>(testDataSize), &initCRC, true, &inverted);
+    reflected.Compute(&data[testDataSize - 1u], static_cast<int32>(testDataSize), &initCRC, true, &reflectedInverted);
+    bool ok = (inverted == ComputeCRC<uint16>(slicing, polynomial, &reversed[0], static_cast<int32>(testDataSize), initCRC));
+    if (ok) {
+        ok = (reflectedInverted == ComputeCRC<uint16>(reflected, polynomial, &reversed[0], static_cast<int32>(testDataSize), initCRC));
+    }
+    return ok;
+}
+
+bool CRCSlicingHelperTTest::TestIsReflected() {
+    CRCSlicingHelperT<uint8> normal;
+    CRCSlicingHelperT<uint8> reflected(true);
+    return (!normal.IsReflected()) && (reflected.IsReflected());
+}
+
+template<typename T>
+bool CRCSlicingHelperTTest::TestCombine(T polynomial,
+                                        T initCRC,
+                                        const bool reflected) {
+    uint8 data[testDataSize];
+    FillTestData(&data[0]);
+    CRCSlicingHelperT<T> slicing(reflected);
+    T expected = ComputeCRC<T>(slicing, polynomial, &data[0], static_cast<int32>(testDataSize), initCRC);
+    uint32 op[crcOperatorSize];
+    bool ok = true;
+    for (uint32 split = 0u; (split <= testDataSize) && (ok); split++) {
+        T crcValue = ComputeCRC<T>(slicing, polynomial, &data[0], static_cast<int32>(split), initCRC);
+        T nextCRC = ComputeCRC<T>(slicing, polynomial, &data[split], static_cast<int32>(testDataSize - split), initCRC);
+        slicing.ComputeZerosOperator(testDataSize - split, &op[0]);
+        slicing.Combine(&op[0], &crcValue, &nextCRC, &initCRC);
+        ok = (crcValue == expected);
+    }
+    return ok;
+}
+
+bool CRCSlicingHelperTTest::TestCombineUint16() {
+    return TestCombine<uint16>(0x1021u, 0xFFFFu, false);
+}
+
+bool CRCSlicingHelperTTest::TestCombineUint32() {
+    return TestCombine<uint32>(0x4C11DB7u, 0xFFFFFFFFu, false);
+}
+
+bool CRCSlicingHelperTTest::TestCombineReflected() {
+    return TestCombine<uint32>(0x1EDC6F41u, 0xFFFFFFFFu, true);
+}
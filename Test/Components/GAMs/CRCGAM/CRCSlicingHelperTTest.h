@@ -0,0 +1,122 @@
+/**
+ * @file CRCSlicingHelperTTest.h
+ * @brief Header file for class CRCSlicingHelperTTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CRCSlicingHelperTTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_COMPONENTS_GAMS_CRCGAM_CRCSLICINGHELPERTTEST_H_
+#define TEST_COMPONENTS_GAMS_CRCGAM_CRCSLICINGHELPERTTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CRCSlicingHelperT.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Test class for CRCSlicingHelperT
+ */
+class CRCSlicingHelperTTest {
+public:
+
+    /**
+     * @brief Tests that the CRC of "123456789" without reflection is the CRC-8, CRC-16/XMODEM and CRC-32/MPEG-2 check value.
+     */
+    bool TestCompute_CheckValues();
+
+    /**
+     * @brief Tests that the CRC of "123456789" with reflection is the CRC-16/ARC, CRC-32 and CRC-32C check value.
+     */
+    bool TestCompute_CheckValuesReflected();
+
+    /**
+     * @brief Tests that the CRC without reflection is the same of CRCHelperT for all the lengths and alignments of the data.
+     */
+    template<typename T>
+    bool TestCompute_SameAsCRCHelperT(T polynomial,
+                                      T initCRC);
+
+    /**
+     * @brief TestCompute_SameAsCRCHelperT with type = uint8
+     */
+    bool TestCompute_SameAsCRCHelperTUint8();
+
+    /**
+     * @brief TestCompute_SameAsCRCHelperT with type = uint16
+     */
+    bool TestCompute_SameAsCRCHelperTUint16();
+
+    /**
+     * @brief TestCompute_SameAsCRCHelperT with type = uint32
+     */
+    bool TestCompute_SameAsCRCHelperTUint32();
+
+    /**
+     * @brief Tests that the reflected CRC of eight bytes at a time is the same of one byte at a time.
+     */
+    bool TestCompute_ReflectedBlocks();
+
+    /**
+     * @brief Tests the Compute with the bytes traversed in reverse order (inputInverted).
+     */
+    bool TestCompute_InputInverted();
+
+    /**
+     * @brief Tests the IsReflected method.
+     */
+    bool TestIsReflected();
+
+    /**
+     * @brief Tests that combining the CRCs of two blocks gives the CRC of the concatenated blocks.
+     */
+    template<typename T>
+    bool TestCombine(T polynomial,
+                     T initCRC,
+                     const bool reflected);
+
+    /**
+     * @brief Tests the TestCombine with uint16 CRCs.
+     */
+    bool TestCombineUint16();
+
+    /**
+     * @brief Tests the TestCombine with uint32 CRCs.
+     */
+    bool TestCombineUint32();
+
+    /**
+     * @brief Tests the TestCombine with reflected uint32 CRCs.
+     */
+    bool TestCombineReflected();
+
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_COMPONENTS_GAMS_CRCGAM_CRCSLICINGHELPERTTEST_H_ */
@@ -123,6 +123,16 @@ TEST(ConstantGAMGTest,TestSetOutput_Error_InvalidValue) {
     ASSERT_TRUE(test.TestSetOutput_Error_InvalidValue());
 }
 
+TEST(ConstantGAMGTest,TestSetOutput_WriteOnce) {
+    ConstantGAMTest test;
+    ASSERT_TRUE(test.TestSetOutput_WriteOnce());
+}
+
+TEST(ConstantGAMGTest,TestInitialise_False_WriteOnce) {
+    ConstantGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_False_WriteOnce());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -1793,3 +1793,247 @@ bool ConstantGAMTest::TestSetOutput_Error_InvalidValue() {
     return !ok; // Expect failure
 }
 
+bool ConstantGAMTest::TestSetOutput_WriteOnce() {
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Constants = {"
+            "            Class = ConstantGAMHelper"
+            "            WriteOnce = 1"
+            "            OutputSignals = {"
+            "                Constant_1 = {"
+            "                    DataSource = DDB"
+            "                    Type = int8"
+            "                    Default = 0"
+            "                }"
+            "                Constant_2 = {"
+            "                    DataSource = DDB"
+            "                    Type = int8"
+            "                    Default = -10"
+            "                }"
+            "                Constant_3 = {"
+            "                    DataSource = DDB"
+            "                    Type = int8"
+            "                    Default = 127"
+            "                }"
+            "                Constant_4 = {"
+            "                    DataSource = DDB"
+            "                    Type = int8"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 4"
+            "                    Default = {0 -10 127 -1}"
+            "                }"
+            "                Constant_5 = {"
+            "                    DataSource = DDB"
+            "                    Type = int8"
+            "                    NumberOfDimensions = 2"
+            "                    NumberOfElements = 8"
+            "                    Default = {{0 -10 127 -1} {-1 127 -10 0}}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Constants}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = ConstantGAMTestHelper::ConfigureApplication(config);
+
+    using namespace MARTe;
+    
+    ReferenceT<Message> message = ReferenceT<Message>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+
+    if (ok) {
+        ok = cdb.Write("Destination", "Test.Functions.Constants");
+    }
+
+    if (ok) {
+        cdb.Write("Function", "SetOutput");
+    }
+    
+    if (ok) {                
+        ok = cdb.CreateAbsolute("+Parameters");            
+    }
+
+    if (ok) {                
+        ok = cdb.Write("Class", "ConfigurationDatabase");            
+    }            
+
+    if (ok) {                
+        ok = cdb.Write("SignalIndex", 0);
+    }            
+
+    if (ok) {                
+        ok = cdb.Write("SignalName", "Constant_1");
+    }            
+
+    if (ok) {                
+        ok = cdb.Write("SignalValue", "-1");            
+    }
+
+    if (ok) {                
+        ok = cdb.MoveToAncestor(1u);            
+    }    
+
+    if (ok) {
+        ok = message->Initialise(cdb);
+    }
+
+    if (ok) {
+        ErrorManagement::ErrorType status = MessageI::SendMessage(message, NULL);
+	ok = (status == ErrorManagement::NoError);
+    }
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<RealTimeApplication> application = god->Find("Test");
+    ReferenceT<ConstantGAMHelper> gam = application->Find("Functions.Constants");
+
+    if (ok) {
+        ok = gam.IsValid();
+    }
+
+    if (ok) {
+        ok = gam->IsWriteOnce();
+    }
+
+    int8 value = -1;
+
+    /* The output signal memory is only written by Execute */
+    if (ok) {
+        ok = (gam->GetOutput(0u, value) && (value == 0));
+    }
+
+    if (ok) {
+        ok = gam->Execute();
+    }
+
+    if (ok) {
+        ok = (gam->GetOutput(0u, value) && (value == -1));
+    }
+
+    if (ok) {
+        ok = (gam->GetOutput(1u, value) && (value == -10));
+    }
+
+    if (ok) {
+        ok = gam->PrepareNextState("Running", "Running");
+    }
+
+    if (ok) {
+        ok = gam->Execute();
+    }
+
+    if (ok) {
+        ok = (gam->GetOutput(0u, value) && (value == -1));
+    }
+
+    god->Purge();
+
+    return ok;
+}
+
+bool ConstantGAMTest::TestInitialise_False_WriteOnce() {
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Constants = {"
+            "            Class = ConstantGAMHelper"
+            "            WriteOnce = 2"
+            "            OutputSignals = {"
+            "                Constant_1 = {"
+            "                    DataSource = DDB"
+            "                    Type = int8"
+            "                    Default = 0"
+            "                }"
+            "                Constant_2 = {"
+            "                    DataSource = DDB"
+            "                    Type = int8"
+            "                    Default = -10"
+            "                }"
+            "                Constant_3 = {"
+            "                    DataSource = DDB"
+            "                    Type = int8"
+            "                    Default = 127"
+            "                }"
+            "                Constant_4 = {"
+            "                    DataSource = DDB"
+            "                    Type = int8"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 4"
+            "                    Default = {0 -10 127 -1}"
+            "                }"
+            "                Constant_5 = {"
+            "                    DataSource = DDB"
+            "                    Type = int8"
+            "                    NumberOfDimensions = 2"
+            "                    NumberOfElements = 8"
+            "                    Default = {{0 -10 127 -1} {-1 127 -10 0}}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Constants}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = !ConstantGAMTestHelper::ConfigureApplication(config);
+
+    MARTe::ObjectRegistryDatabase::Instance()->Purge();
+
+    return ok;
+}
@@ -167,6 +167,19 @@ public:
      */
     bool TestSetOutput_Error_InvalidValue();
 
+    /**
+     * @brief Tests the SetOutput() method with WriteOnce = 1
+     * @details Verify that the output is only written by Execute()
+     * @return true if SetOutput is invoked() and the output changes after Execute().
+     */
+    bool TestSetOutput_WriteOnce();
+
+    /**
+     * @brief Tests the Initialise() method with an invalid WriteOnce
+     * @return true if the application fails to be configured.
+     */
+    bool TestInitialise_False_WriteOnce();
+
 };
 
 /*---------------------------------------------------------------------------*/
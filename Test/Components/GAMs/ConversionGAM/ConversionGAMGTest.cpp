@@ -229,6 +229,21 @@ TEST(ConversionGAMGTest,TestSetup_False_InvalidOutputSamplesMismatch) {
     ASSERT_TRUE(test.TestSetup_False_InvalidOutputSamplesMismatch());
 }
 
+TEST(ConversionGAMGTest,TestSetup_False_InvalidSaturate) {
+    ConversionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_InvalidSaturate());
+}
+
+TEST(ConversionGAMGTest,TestSetup_False_InvalidCalibration) {
+    ConversionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_InvalidCalibration());
+}
+
+TEST(ConversionGAMGTest,TestExecute_ConversionPlans) {
+    ConversionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_ConversionPlans());
+}
+
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -402,4 +402,257 @@ bool ConversionGAMTest::TestSetup_False_InvalidOutputSamplesMismatch() {
     return ok;
 }
 
+bool ConversionGAMTest::TestSetup_False_InvalidSaturate() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = configFromBasicTypeTemplate;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    //Parse the template configuration file
+    bool ok = parser.Parse();
+
+    //Patch it with the type to be tested
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.OutputSignals.Signal1");
+    }
+    if (ok) {
+        ok = cdb.Write("Saturate", 2);
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    //Initialise the application
+    if (ok) {
+        cdb.MoveToRoot();
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = !application->ConfigureApplication();
+    }
+
+    god->Purge();
+    return ok;
+}
+
+bool ConversionGAMTest::TestSetup_False_InvalidCalibration() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = configFromBasicTypeTemplate;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    //Parse the template configuration file
+    bool ok = parser.Parse();
+
+    //Patch it with the type to be tested
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.OutputSignals.Signal1");
+    }
+    if (ok) {
+        //TableInput without TableOutput
+        ok = cdb.Write("TableInput", 2);
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    //Initialise the application
+    if (ok) {
+        cdb.MoveToRoot();
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = !application->ConfigureApplication();
+    }
+
+    god->Purge();
+    return ok;
+}
+
+//Signals 1 to 3, 4, 5 and 6 can be grouped in four plans. Signal 7 is saturated and signal 8 is too long.
+static const MARTe::char8 * const configConversionPlans = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = ConversionGAMTestHelper"
+        "            InputSignals = {"
+        "               Signal1 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int32"
+        "               }"
+        "               Signal2 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int32"
+        "               }"
+        "               Signal3 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int32"
+        "                   NumberOfElements = 3"
+        "               }"
+        "               Signal4 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int32"
+        "               }"
+        "               Signal5 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int32"
+        "               }"
+        "               Signal6 = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint16"
+        "               }"
+        "               Signal7 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int32"
+        "               }"
+        "               Signal8 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int32"
+        "                   NumberOfElements = 16"
+        "               }"
+        "            }"
+        "            OutputSignals = {"
+        "               Signal1 = {"
+        "                   DataSource = DDB1"
+        "                   Type = float32"
+        "               }"
+        "               Signal2 = {"
+        "                   DataSource = DDB1"
+        "                   Type = float32"
+        "               }"
+        "               Signal3 = {"
+        "                   DataSource = DDB1"
+        "                   Type = float32"
+        "                   NumberOfElements = 3"
+        "               }"
+        "               Signal4 = {"
+        "                   DataSource = DDB1"
+        "                   Type = float32"
+        "                   Gain = 2"
+        "               }"
+        "               Signal5 = {"
+        "                   DataSource = DDB1"
+        "                   Type = float32"
+        "                   Gain = 2 Offset = 1"
+        "               }"
+        "               Signal6 = {"
+        "                   DataSource = DDB1"
+        "                   Type = float64"
+        "                   Gain = 2"
+        "               }"
+        "               Signal7 = {"
+        "                   DataSource = DDB1"
+        "                   Type = float32"
+        "                   Saturate = 1"
+        "               }"
+        "               Signal8 = {"
+        "                   DataSource = DDB1"
+        "                   Type = float32"
+        "                   NumberOfElements = 16"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +Drv1 = {"
+        "            Class = ConversionGAMDataSourceHelper"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+bool ConversionGAMTest::TestExecute_ConversionPlans() {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(configConversionPlans, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<ConversionGAMTestHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = (gam->GetNumberOfConversionPlans() == 4u);
+    }
+    if (ok) {
+        ok = (gam->GetNumberOfUnplannedSignals() == 2u);
+    }
+    const uint32 numberOfSignals = 8u;
+    uint32 i;
+    uint32 e;
+    if (ok) {
+        for (i = 0u; i < numberOfSignals; i++) {
+            uint32 numberOfElements = 1u;
+            gam->GetSignalNumberOfElements(InputSignals, i, numberOfElements);
+            if (i == 5u) {
+                *static_cast<uint16 *>(gam->GetInputSignalMemory(i)) = 7u;
+            }
+            else {
+                int32 *input = static_cast<int32 *>(gam->GetInputSignalMemory(i));
+                for (e = 0u; e < numberOfElements; e++) {
+                    input[e] = static_cast<int32>((10u * (i + 1u)) + e);
+                }
+            }
+        }
+        ok = gam->Execute();
+    }
+    for (i = 0u; (i < numberOfSignals) && (ok); i++) {
+        uint32 numberOfElements = 1u;
+        gam->GetSignalNumberOfElements(OutputSignals, i, numberOfElements);
+        if (i == 5u) {
+            ok = (*static_cast<float64 *>(gam->GetOutputSignalMemory(i)) == 14.0);
+        }
+        else {
+            float32 *output = static_cast<float32 *>(gam->GetOutputSignalMemory(i));
+            for (e = 0u; (e < numberOfElements) && (ok); e++) {
+                float32 expected = static_cast<float32>((10u * (i + 1u)) + e);
+                if (i == 3u) {
+                    expected *= 2.0F;
+                }
+                else if (i == 4u) {
+                    expected = (expected * 2.0F) + 1.0F;
+                }
+                else {
+                    //NOOP
+                }
+                ok = (output[e] == expected);
+            }
+        }
+    }
+    god->Purge();
+    return ok;
+}
+
 
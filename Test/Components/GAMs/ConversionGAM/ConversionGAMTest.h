@@ -95,6 +95,22 @@ public:
      */
     bool TestSetup_False_InvalidOutputSamplesMismatch();
 
+    /**
+     * @brief Tests the Setup method with a Saturate option different from 0 and 1.
+     */
+    bool TestSetup_False_InvalidSaturate();
+
+    /**
+     * @brief Tests the Setup method with an invalid calibration.
+     */
+    bool TestSetup_False_InvalidCalibration();
+
+    /**
+     * @brief Tests that the short signals with the same types, Gain and Offset are grouped in ConversionPlan groups
+     * and that the Execute method converts both the planned and the unplanned signals.
+     */
+    bool TestExecute_ConversionPlans();
+
     /**
      * @brief Tests the Execute method for all the basic types.
      */
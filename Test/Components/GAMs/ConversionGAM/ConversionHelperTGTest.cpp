@@ -89,3 +89,73 @@ TEST(ConversionHelperTGTest,TestSetNumberOfSamples) {
 
 
 	
+
+TEST(ConversionHelperTGTest,TestLoadOffset) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestLoadOffset());
+}
+
+TEST(ConversionHelperTGTest,TestIsSaturated) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestIsSaturated());
+}
+
+TEST(ConversionHelperTGTest,TestSetSaturated) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestSetSaturated());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_GainOffset) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_GainOffset());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_Saturated) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_Saturated());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_SameAsScalarInt16Float32) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_SameAsScalarInt16Float32());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_SameAsScalarInt32Float32) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_SameAsScalarInt32Float32());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_SameAsScalarFloat32Int16Saturated) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_SameAsScalarFloat32Int16Saturated());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_SameAsScalarFloat32Float64) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_SameAsScalarFloat32Float64());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_SameAsScalarFloat64Float32) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_SameAsScalarFloat64Float32());
+}
+
+TEST(ConversionHelperTGTest,TestLoadCalibration) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestLoadCalibration());
+}
+
+TEST(ConversionHelperTGTest,TestIsCalibrated) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestIsCalibrated());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_Polynomial) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_Polynomial());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_Table) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_Table());
+}
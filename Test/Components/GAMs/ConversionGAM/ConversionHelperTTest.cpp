@@ -124,3 +124,352 @@ bool ConversionHelperTTest::TestGetOutputMemory() {
     }
     return ok;
 }
+
+bool ConversionHelperTTest::TestLoadOffset() {
+    using namespace MARTe;
+    ConversionHelperT<uint32, float32> test(NULL, NULL);
+    ConfigurationDatabase cdb;
+    bool ok = !test.LoadOffset(cdb);
+    cdb.Write("Offset", -10);
+    if (ok) {
+        ok = test.LoadOffset(cdb);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestIsSaturated() {
+    using namespace MARTe;
+    ConversionHelperT<uint32, float32> test(NULL, NULL);
+    bool ok = !test.IsSaturated();
+    if (ok) {
+        test.SetSaturated(true);
+        ok = test.IsSaturated();
+    }
+    if (ok) {
+        test.SetSaturated(false);
+        ok = !test.IsSaturated();
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestSetSaturated() {
+    return TestIsSaturated();
+}
+
+bool ConversionHelperTTest::TestConvert_GainOffset() {
+    using namespace MARTe;
+    int16 src[3] = { -2, 0, 5 };
+    float32 dest[3];
+    ConversionHelperT<int16, float32> test(&src[0], &dest[0]);
+    test.SetNumberOfElements(3u);
+    test.SetNumberOfSamples(1u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Offset", 1.5);
+    bool ok = test.LoadOffset(cdb);
+    if (ok) {
+        test.Convert();
+        ok = (dest[0] == -0.5F) && (dest[1] == 1.5F) && (dest[2] == 6.5F);
+    }
+    if (ok) {
+        cdb.Write("Gain", 2);
+        ok = test.LoadGain(cdb);
+    }
+    if (ok) {
+        test.Convert();
+        ok = (dest[0] == -2.5F) && (dest[1] == 1.5F) && (dest[2] == 11.5F);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_Saturated() {
+    using namespace MARTe;
+    float32 src[5] = { -1e6F, -32768.5F, 12.75F, 32767.5F, 1e6F };
+    int16 dest[5];
+    ConversionHelperT<float32, int16> test(&src[0], &dest[0]);
+    test.SetNumberOfElements(5u);
+    test.SetNumberOfSamples(1u);
+    test.SetSaturated(true);
+    test.Convert();
+    bool ok = (dest[0] == -32768) && (dest[1] == -32768) && (dest[2] == 12) && (dest[3] == 32767) && (dest[4] == 32767);
+    if (ok) {
+        uint8 srcU[3] = { 10u, 100u, 200u };
+        int8 destI[3];
+        ConversionHelperT<uint8, int8> test2(&srcU[0], &destI[0]);
+        test2.SetNumberOfElements(3u);
+        test2.SetNumberOfSamples(1u);
+        ConfigurationDatabase cdb;
+        cdb.Write("Offset", -50);
+        ok = test2.LoadOffset(cdb);
+        test2.SetSaturated(true);
+        test2.Convert();
+        ok = (destI[0] == -40) && (destI[1] == 50) && (destI[2] == 127);
+    }
+    return ok;
+}
+
+template<typename inputType, typename outputType>
+bool ConversionHelperTTest::TestConvert_SameAsScalar(const bool saturated,
+                                                     const bool scaled) {
+    using namespace MARTe;
+    const uint32 maxValues = 40u;
+    inputType src[maxValues];
+    outputType dest[maxValues + 1u];
+    uint32 x = 12345u;
+    uint32 i;
+    for (i = 0u; i < maxValues; i++) {
+        x = (x * 1103515245u) + 12345u;
+        float64 value = (static_cast<float64>(static_cast<int32>(x >> 8u)) / 65536.0) * 0.01;
+        //Include values out of the range of the small types
+        src[i] = static_cast<inputType>(((i % 7u) == 0u) ? (value * 1000.0) : value);
+    }
+    ConfigurationDatabase cdb;
+    if (scaled) {
+        cdb.Write("Gain", 3);
+        cdb.Write("Offset", -2);
+    }
+    float64 gain = scaled ? 3.0 : 1.0;
+    float64 offset = scaled ? -2.0 : 0.0;
+    bool ok = true;
+    uint32 n;
+    for (n = 0u; (n <= maxValues) && (ok); n++) {
+        ConversionHelperT<inputType, outputType> test(&src[0], &dest[0]);
+        test.SetNumberOfElements(n);
+        test.SetNumberOfSamples(1u);
+        test.SetSaturated(saturated);
+        (void) test.LoadGain(cdb);
+        (void) test.LoadOffset(cdb);
+        dest[n] = static_cast<outputType>(77);
+        test.Convert();
+        for (i = 0u; (i < n) && (ok); i++) {
+            outputType expected;
+            if (saturated) {
+                float64 value = (gain * static_cast<float64>(src[i])) + offset;
+                float64 maxValue = (sizeof(outputType) == sizeof(int16)) ? 32767.0 : 3.4028234663852886e+38;
+                float64 minValue = (sizeof(outputType) == sizeof(int16)) ? -32768.0 : -3.4028234663852886e+38;
+                if (value > maxValue) {
+                    value = maxValue;
+                }
+                if (value < minValue) {
+                    value = minValue;
+                }
+                expected = static_cast<outputType>(value);
+            }
+            else if (scaled) {
+                expected = (static_cast<outputType>(gain) * static_cast<outputType>(src[i])) + static_cast<outputType>(offset);
+            }
+            else {
+                expected = static_cast<outputType>(src[i]);
+            }
+            ok = (dest[i] == expected);
+        }
+        if (ok) {
+            ok = (dest[n] == static_cast<outputType>(77));
+        }
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_SameAsScalarInt16Float32() {
+    using namespace MARTe;
+    bool ok = TestConvert_SameAsScalar<int16, float32>(false, false);
+    if (ok) {
+        ok = TestConvert_SameAsScalar<int16, float32>(false, true);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_SameAsScalarInt32Float32() {
+    using namespace MARTe;
+    bool ok = TestConvert_SameAsScalar<int32, float32>(false, false);
+    if (ok) {
+        ok = TestConvert_SameAsScalar<int32, float32>(false, true);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_SameAsScalarFloat32Int16Saturated() {
+    using namespace MARTe;
+    bool ok = TestConvert_SameAsScalar<float32, int16>(true, false);
+    if (ok) {
+        ok = TestConvert_SameAsScalar<float32, int16>(true, true);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_SameAsScalarFloat32Float64() {
+    using namespace MARTe;
+    bool ok = TestConvert_SameAsScalar<float32, float64>(false, false);
+    if (ok) {
+        ok = TestConvert_SameAsScalar<float32, float64>(false, true);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_SameAsScalarFloat64Float32() {
+    using namespace MARTe;
+    bool ok = TestConvert_SameAsScalar<float64, float32>(false, false);
+    if (ok) {
+        ok = TestConvert_SameAsScalar<float64, float32>(false, true);
+    }
+    if (ok) {
+        ok = TestConvert_SameAsScalar<float64, float32>(true, true);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestLoadCalibration() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    float64 polynomial[3] = { 1.0, 2.0, 3.0 };
+    float64 tableInput[3] = { 0.0, 1.0, 3.0 };
+    float64 tableOutput[3] = { 1.0, 2.0, 0.0 };
+    float64 tableWrongInput[3] = { 0.0, 1.0, 1.0 };
+    Vector<float64> polynomialVector(&polynomial[0], 3u);
+    Vector<float64> tableInputVector(&tableInput[0], 3u);
+    Vector<float64> tableOutputVector(&tableOutput[0], 3u);
+    Vector<float64> tableWrongInputVector(&tableWrongInput[0], 3u);
+    bool ok;
+    {
+        ConversionHelperT<float32, float32> test(NULL, NULL);
+        ok = test.LoadCalibration(cdb);
+    }
+    if (ok) {
+        ConversionHelperT<float32, float32> test(NULL, NULL);
+        cdb.Write("Polynomial", polynomialVector);
+        ok = test.LoadCalibration(cdb);
+    }
+    if (ok) {
+        //Polynomial and table
+        ConversionHelperT<float32, float32> test(NULL, NULL);
+        cdb.Write("TableInput", tableInputVector);
+        cdb.Write("TableOutput", tableOutputVector);
+        ok = !test.LoadCalibration(cdb);
+        cdb.Delete("Polynomial");
+    }
+    if (ok) {
+        ConversionHelperT<float32, float32> test(NULL, NULL);
+        ok = test.LoadCalibration(cdb);
+    }
+    if (ok) {
+        //Missing TableOutput
+        ConversionHelperT<float32, float32> test(NULL, NULL);
+        cdb.Delete("TableOutput");
+        ok = !test.LoadCalibration(cdb);
+    }
+    if (ok) {
+        //TableInput not increasing
+        ConversionHelperT<float32, float32> test(NULL, NULL);
+        cdb.Delete("TableInput");
+        cdb.Write("TableInput", tableWrongInputVector);
+        cdb.Write("TableOutput", tableOutputVector);
+        ok = !test.LoadCalibration(cdb);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestIsCalibrated() {
+    using namespace MARTe;
+    ConversionHelperT<float32, float32> test(NULL, NULL);
+    ConfigurationDatabase cdb;
+    bool ok = test.LoadCalibration(cdb);
+    if (ok) {
+        ok = !test.IsCalibrated();
+    }
+    if (ok) {
+        float64 polynomial[2] = { 1.0, 2.0 };
+        Vector<float64> polynomialVector(&polynomial[0], 2u);
+        cdb.Write("Polynomial", polynomialVector);
+        ok = test.LoadCalibration(cdb);
+    }
+    if (ok) {
+        ok = test.IsCalibrated();
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_Polynomial() {
+    using namespace MARTe;
+    const uint32 numberOfValues = 150u;
+    int16 src[numberOfValues];
+    float64 dest[numberOfValues];
+    uint32 i;
+    for (i = 0u; i < numberOfValues; i++) {
+        src[i] = static_cast<int16>(i) - 75;
+    }
+    ConversionHelperT<int16, float64> test(&src[0], &dest[0]);
+    test.SetNumberOfElements(numberOfValues / 2u);
+    test.SetNumberOfSamples(2u);
+    ConfigurationDatabase cdb;
+    float64 polynomial[4] = { -1.0, 0.5, 0.25, 0.125 };
+    Vector<float64> polynomialVector(&polynomial[0], 4u);
+    cdb.Write("Polynomial", polynomialVector);
+    cdb.Write("Offset", 2.0);
+    bool ok = test.LoadCalibration(cdb);
+    (void) test.LoadOffset(cdb);
+    if (ok) {
+        test.Convert();
+        for (i = 0u; (i < numberOfValues) && (ok); i++) {
+            float64 x = static_cast<float64>(src[i]);
+            float64 expected = (((((0.125 * x) + 0.25) * x) + 0.5) * x) - 1.0 + 2.0;
+            float64 error = dest[i] - expected;
+            ok = (error < 1e-9) && (error > -1e-9);
+        }
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_Table() {
+    using namespace MARTe;
+    const uint32 numberOfValues = 100u;
+    float32 src[numberOfValues];
+    int16 dest[numberOfValues];
+    uint32 i;
+    for (i = 0u; i < numberOfValues; i++) {
+        src[i] = (static_cast<float32>(i) * 0.5F) - 10.0F;
+    }
+    ConfigurationDatabase cdb;
+    float64 uniformInput[5] = { 0.0, 5.0, 10.0, 15.0, 20.0 };
+    float64 otherInput[5] = { 0.0, 2.0, 10.0, 11.0, 20.0 };
+    float64 tableOutput[5] = { 0.0, 1000.0, 500.0, 500.0, 40000.0 };
+    Vector<float64> tableOutputVector(&tableOutput[0], 5u);
+    cdb.Write("TableOutput", tableOutputVector);
+    bool ok = true;
+    uint32 t;
+    for (t = 0u; (t < 2u) && (ok); t++) {
+        float64 * const tableInput = (t == 0u) ? &uniformInput[0] : &otherInput[0];
+        (void) cdb.Delete("TableInput");
+        Vector<float64> tableInputVector(tableInput, 5u);
+        cdb.Write("TableInput", tableInputVector);
+        ConversionHelperT<float32, int16> test(&src[0], &dest[0]);
+        test.SetNumberOfElements(numberOfValues);
+        test.SetNumberOfSamples(1u);
+        test.SetSaturated(true);
+        ok = test.LoadCalibration(cdb);
+        if (ok) {
+            test.Convert();
+        }
+        for (i = 0u; (i < numberOfValues) && (ok); i++) {
+            float64 x = static_cast<float64>(src[i]);
+            float64 expected;
+            if (x <= tableInput[0u]) {
+                expected = tableOutput[0u];
+            }
+            else if (x >= tableInput[4u]) {
+                expected = tableOutput[4u];
+            }
+            else {
+                uint32 k = 0u;
+                while (x >= tableInput[k + 1u]) {
+                    k++;
+                }
+                expected = tableOutput[k] + (((x - tableInput[k]) / (tableInput[k + 1u] - tableInput[k])) * (tableOutput[k + 1u] - tableOutput[k]));
+            }
+            if (expected > 32767.0) {
+                expected = 32767.0;
+            }
+            ok = (dest[i] == static_cast<int16>(expected));
+        }
+    }
+    return ok;
+}
+
@@ -86,6 +86,82 @@ public:
      */
     bool TestGetOutputMemory();
 
+    /**
+     * @brief Tests the LoadOffset method.
+     */
+    bool TestLoadOffset();
+
+    /**
+     * @brief Tests the IsSaturated method.
+     */
+    bool TestIsSaturated();
+
+    /**
+     * @brief Tests the SetSaturated method.
+     */
+    bool TestSetSaturated();
+
+    /**
+     * @brief Tests the Convert method with a gain and an offset.
+     */
+    bool TestConvert_GainOffset();
+
+    /**
+     * @brief Tests that the Convert method with saturation clamps the values to the output range.
+     */
+    bool TestConvert_Saturated();
+
+    /**
+     * @brief Tests that the Convert method gives, for all the number of values, the same result of the scalar conversion.
+     */
+    template<typename inputType, typename outputType>
+    bool TestConvert_SameAsScalar(const bool saturated, const bool scaled);
+
+    /**
+     * @brief Tests the TestConvert_SameAsScalar for int16 to float32.
+     */
+    bool TestConvert_SameAsScalarInt16Float32();
+
+    /**
+     * @brief Tests the TestConvert_SameAsScalar for int32 to float32.
+     */
+    bool TestConvert_SameAsScalarInt32Float32();
+
+    /**
+     * @brief Tests the TestConvert_SameAsScalar for float32 to int16 with saturation.
+     */
+    bool TestConvert_SameAsScalarFloat32Int16Saturated();
+
+    /**
+     * @brief Tests the TestConvert_SameAsScalar for float32 to float64.
+     */
+    bool TestConvert_SameAsScalarFloat32Float64();
+
+    /**
+     * @brief Tests the TestConvert_SameAsScalar for float64 to float32, with and without saturation.
+     */
+    bool TestConvert_SameAsScalarFloat64Float32();
+
+    /**
+     * @brief Tests the LoadCalibration method with valid and invalid calibrations.
+     */
+    bool TestLoadCalibration();
+
+    /**
+     * @brief Tests the IsCalibrated method.
+     */
+    bool TestIsCalibrated();
+
+    /**
+     * @brief Tests the Convert method with a polynomial calibration.
+     */
+    bool TestConvert_Polynomial();
+
+    /**
+     * @brief Tests the Convert method with equally spaced and not equally spaced lookup tables.
+     */
+    bool TestConvert_Table();
+
 };
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
@@ -0,0 +1,84 @@
+/**
+ * @file DecimationAggregatorGAMGTest.cpp
+ * @brief Source file for class DecimationAggregatorGAMGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DecimationAggregatorGAMGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "DecimationAggregatorGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(DecimationAggregatorGAMGTest,TestConstructor) {
+    DecimationAggregatorGAMTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(DecimationAggregatorGAMGTest,TestInitialise) {
+    DecimationAggregatorGAMTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(DecimationAggregatorGAMGTest,TestInitialise_FalseNoDecimation) {
+    DecimationAggregatorGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseNoDecimation());
+}
+
+TEST(DecimationAggregatorGAMGTest,TestInitialise_FalseBadStatistic) {
+    DecimationAggregatorGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadStatistic());
+}
+
+TEST(DecimationAggregatorGAMGTest,TestSetup) {
+    DecimationAggregatorGAMTest test;
+    ASSERT_TRUE(test.TestSetup());
+}
+
+TEST(DecimationAggregatorGAMGTest,TestSetup_FalseNumberOfOutputs) {
+    DecimationAggregatorGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseNumberOfOutputs());
+}
+
+TEST(DecimationAggregatorGAMGTest,TestSetup_FalseBadOutputElements) {
+    DecimationAggregatorGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadOutputElements());
+}
+
+TEST(DecimationAggregatorGAMGTest,TestSetup_FalseBadTrigger) {
+    DecimationAggregatorGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadTrigger());
+}
+
+TEST(DecimationAggregatorGAMGTest,TestExecute) {
+    DecimationAggregatorGAMTest test;
+    ASSERT_TRUE(test.TestExecute());
+}
@@ -0,0 +1,389 @@
+/**
+ * @file DecimationAggregatorGAMTest.cpp
+ * @brief Source file for class DecimationAggregatorGAMTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DecimationAggregatorGAMTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "DecimationAggregatorGAMTest.h"
+#include "MemoryDataSourceI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class DecimationAggregatorGAMTestGAM: public DecimationAggregatorGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    void *GetInputSignalMemory(const uint32 signalIdx);
+
+    void *GetOutputSignalMemory(const uint32 signalIdx);
+};
+
+void *DecimationAggregatorGAMTestGAM::GetInputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetInputSignalMemory(signalIdx);
+}
+
+void *DecimationAggregatorGAMTestGAM::GetOutputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetOutputSignalMemory(signalIdx);
+}
+
+CLASS_REGISTER(DecimationAggregatorGAMTestGAM, "1.0")
+
+class DecimationAggregatorGAMTestDS: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+            const char8 * const nextStateName);
+
+    virtual bool Synchronise();
+
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+};
+CLASS_REGISTER(DecimationAggregatorGAMTestDS, "1.0")
+
+bool DecimationAggregatorGAMTestDS::PrepareNextState(const char8 * const currentStateName,
+        const char8 * const nextStateName) {
+    return true;
+}
+
+bool DecimationAggregatorGAMTestDS::Synchronise() {
+    return true;
+}
+
+const char8 *DecimationAggregatorGAMTestDS::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    return "MemoryMapInputBroker";
+}
+
+/**
+ * @brief Configures an application with a single DecimationAggregatorGAMTestGAM (GAMA) with the parameters and signals in gamConfig.
+ * The input signals shall use the Drv1 DataSource and the output signals the DDB DataSource.
+ */
+static bool InitialiseDecimationAggregatorApplication(const char8 * const gamConfig) {
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = DecimationAggregatorGAMTestGAM";
+    config += gamConfig;
+    config += ""
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = DecimationAggregatorGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    config.Seek(0);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT < RealTimeApplication > application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * @brief Signals of the tests: a float32[2] and an int16 with 2 samples (3 channels).
+ */
+static const char8 * const aggregatorInputSignals = ""
+        "            InputSignals = {"
+        "                A = {"
+        "                    DataSource = Drv1"
+        "                    Type = float32"
+        "                    NumberOfElements = 2"
+        "                }"
+        "                B = {"
+        "                    DataSource = Drv1"
+        "                    Type = int16"
+        "                    NumberOfSamples = 2"
+        "                }"
+        "            }";
+
+/**
+ * @brief Output signals of the tests (Statistics = {Min Max Mean Last Trigger}).
+ */
+static const char8 * const aggregatorOutputSignals = ""
+        "            OutputSignals = {"
+        "                Min = {"
+        "                    DataSource = DDB"
+        "                    Type = float32"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                Max = {"
+        "                    DataSource = DDB"
+        "                    Type = float32"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                Mean = {"
+        "                    DataSource = DDB"
+        "                    Type = float64"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                Last = {"
+        "                    DataSource = DDB"
+        "                    Type = float64"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                Trigger = {"
+        "                    DataSource = DDB"
+        "                    Type = uint8"
+        "                }"
+        "            }";
+
+/**
+ * @brief Calls the DecimationAggregatorGAM::Initialise with the parameters in config.
+ */
+static bool InitialiseDecimationAggregatorGAM(const char8 * const config,
+                                              DecimationAggregatorGAMTestGAM &gam) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        cdb.MoveToRoot();
+        ok = gam.Initialise(cdb);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+DecimationAggregatorGAMTest::DecimationAggregatorGAMTest() {
+}
+
+DecimationAggregatorGAMTest::~DecimationAggregatorGAMTest() {
+}
+
+bool DecimationAggregatorGAMTest::TestConstructor() {
+    DecimationAggregatorGAMTestGAM gam;
+    bool ret = (gam.GetDecimation() == 0u);
+    ret &= (gam.GetNumberOfChannels() == 0u);
+    ret &= (gam.GetNumberOfWindows() == 0u);
+    return ret;
+}
+
+bool DecimationAggregatorGAMTest::TestInitialise() {
+    DecimationAggregatorGAMTestGAM gam;
+    bool ret = InitialiseDecimationAggregatorGAM("Decimation = 100\n"
+                                                 "Statistics = {Min Max Mean Last Trigger}\n", gam);
+    if (ret) {
+        ret = (gam.GetDecimation() == 100u);
+    }
+    return ret;
+}
+
+bool DecimationAggregatorGAMTest::TestInitialise_FalseNoDecimation() {
+    DecimationAggregatorGAMTestGAM gam;
+    bool ret = !InitialiseDecimationAggregatorGAM("Statistics = {Min Max}\n", gam);
+    if (ret) {
+        DecimationAggregatorGAMTestGAM gam2;
+        ret = !InitialiseDecimationAggregatorGAM("Decimation = 0\n"
+                                                 "Statistics = {Min Max}\n", gam2);
+    }
+    return ret;
+}
+
+bool DecimationAggregatorGAMTest::TestInitialise_FalseBadStatistic() {
+    DecimationAggregatorGAMTestGAM gam;
+    return !InitialiseDecimationAggregatorGAM("Decimation = 10\n"
+                                              "Statistics = {Min Median}\n", gam);
+}
+
+bool DecimationAggregatorGAMTest::TestSetup() {
+    StreamString config = ""
+            "            Decimation = 4"
+            "            Statistics = {Min Max Mean Last Trigger}";
+    config += aggregatorInputSignals;
+    config += aggregatorOutputSignals;
+    bool ret = InitialiseDecimationAggregatorApplication(config.Buffer());
+    ReferenceT<DecimationAggregatorGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        ret = (gam->GetNumberOfChannels() == 3u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool DecimationAggregatorGAMTest::TestSetup_FalseNumberOfOutputs() {
+    StreamString config = ""
+            "            Decimation = 4"
+            "            Statistics = {Min Max Mean}";
+    config += aggregatorInputSignals;
+    config += aggregatorOutputSignals;
+    bool ret = !InitialiseDecimationAggregatorApplication(config.Buffer());
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool DecimationAggregatorGAMTest::TestSetup_FalseBadOutputElements() {
+    StreamString config = ""
+            "            Decimation = 4"
+            "            Statistics = {Min}";
+    config += aggregatorInputSignals;
+    config += ""
+            "            OutputSignals = {"
+            "                Min = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 2"
+            "                }"
+            "            }";
+    bool ret = !InitialiseDecimationAggregatorApplication(config.Buffer());
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool DecimationAggregatorGAMTest::TestSetup_FalseBadTrigger() {
+    StreamString config = ""
+            "            Decimation = 4"
+            "            Statistics = {Trigger}";
+    config += aggregatorInputSignals;
+    config += ""
+            "            OutputSignals = {"
+            "                Trigger = {"
+            "                    DataSource = DDB"
+            "                    Type = uint32"
+            "                }"
+            "            }";
+    bool ret = !InitialiseDecimationAggregatorApplication(config.Buffer());
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool DecimationAggregatorGAMTest::TestExecute() {
+    StreamString config = ""
+            "            Decimation = 4"
+            "            Statistics = {Min Max Mean Last Trigger}";
+    config += aggregatorInputSignals;
+    config += aggregatorOutputSignals;
+    bool ret = InitialiseDecimationAggregatorApplication(config.Buffer());
+    ReferenceT<DecimationAggregatorGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    float32 *a = NULL_PTR(float32 *);
+    int16 *b = NULL_PTR(int16 *);
+    float32 *minimum = NULL_PTR(float32 *);
+    float32 *maximum = NULL_PTR(float32 *);
+    float64 *mean = NULL_PTR(float64 *);
+    float64 *last = NULL_PTR(float64 *);
+    uint8 *trigger = NULL_PTR(uint8 *);
+    if (ret) {
+        a = static_cast<float32 *>(gam->GetInputSignalMemory(0u));
+        b = static_cast<int16 *>(gam->GetInputSignalMemory(1u));
+        minimum = static_cast<float32 *>(gam->GetOutputSignalMemory(0u));
+        maximum = static_cast<float32 *>(gam->GetOutputSignalMemory(1u));
+        mean = static_cast<float64 *>(gam->GetOutputSignalMemory(2u));
+        last = static_cast<float64 *>(gam->GetOutputSignalMemory(3u));
+        trigger = static_cast<uint8 *>(gam->GetOutputSignalMemory(4u));
+    }
+    //Two windows of 4 cycles. In the window w and cycle n: a = {w * 10 + n, -n}, b = {n, -n}
+    for (uint32 w = 0u; (w < 2u) && (ret); w++) {
+        for (uint32 n = 0u; (n < 4u) && (ret); n++) {
+            a[0] = static_cast<float32>((w * 10u) + n);
+            a[1] = -static_cast<float32>(n);
+            b[0] = static_cast<int16>(n);
+            b[1] = -static_cast<int16>(n);
+            ret = gam->Execute();
+            if (ret) {
+                ret = (*trigger == ((n == 3u) ? 1u : 0u));
+            }
+        }
+        if (ret) {
+            float64 base = static_cast<float64>(w * 10u);
+            ret = (minimum[0] == static_cast<float32>(base)) && (maximum[0] == static_cast<float32>(base + 3.0));
+            ret &= (minimum[1] == -3.F) && (maximum[1] == 0.F);
+            ret &= (minimum[2] == -3.F) && (maximum[2] == 3.F);
+            ret &= (fabs(mean[0] - (base + 1.5)) < 1e-9) && (fabs(mean[1] + 1.5) < 1e-9) && (fabs(mean[2]) < 1e-9);
+            ret &= (last[0] == (base + 3.0)) && (last[1] == -3.0) && (last[2] == -3.0);
+        }
+        if (ret) {
+            ret = (gam->GetNumberOfWindows() == (w + 1u));
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file DecimationAggregatorGAMTest.h
+ * @brief Header file for class DecimationAggregatorGAMTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class DecimationAggregatorGAMTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef DECIMATIONAGGREGATORGAMTEST_H_
+#define DECIMATIONAGGREGATORGAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "DecimationAggregatorGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the DecimationAggregatorGAM methods
+ */
+class DecimationAggregatorGAMTest {
+public:
+
+    /**
+     * @brief Constructor
+     */
+    DecimationAggregatorGAMTest();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~DecimationAggregatorGAMTest();
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails without a Decimation (or with Decimation = 0)
+     */
+    bool TestInitialise_FalseNoDecimation();
+
+    /**
+     * @brief Tests that the Initialise method fails with an unsupported statistic
+     */
+    bool TestInitialise_FalseBadStatistic();
+
+    /**
+     * @brief Tests the Setup method with two input signals
+     */
+    bool TestSetup();
+
+    /**
+     * @brief Tests that the Setup method fails if the number of output signals is not the number of Statistics
+     */
+    bool TestSetup_FalseNumberOfOutputs();
+
+    /**
+     * @brief Tests that the Setup method fails if an output signal does not have one element per channel
+     */
+    bool TestSetup_FalseBadOutputElements();
+
+    /**
+     * @brief Tests that the Setup method fails if the Trigger output signal is not a uint8
+     */
+    bool TestSetup_FalseBadTrigger();
+
+    /**
+     * @brief Tests the Execute method with two input signals of different types, one with more than one sample
+     */
+    bool TestExecute();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DECIMATIONAGGREGATORGAMTEST_H_ */
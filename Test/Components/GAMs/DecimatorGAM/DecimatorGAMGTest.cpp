@@ -0,0 +1,135 @@
+/**
+ * @file DecimatorGAMGTest.cpp
+ * @brief Source file for class DecimatorGAMGTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DecimatorGAMGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "DecimatorGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(DecimatorGAMGTest,TestConstructor) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(DecimatorGAMGTest,TestInitialise) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(DecimatorGAMGTest,TestInitialiseInterpolate) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseInterpolate());
+}
+
+TEST(DecimatorGAMGTest,TestInitialiseNoNum) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseNoNum());
+}
+
+TEST(DecimatorGAMGTest,TestInitialiseNoFactor) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseNoFactor());
+}
+
+TEST(DecimatorGAMGTest,TestInitialiseWrongFactor) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongFactor());
+}
+
+TEST(DecimatorGAMGTest,TestInitialiseWrongMode) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongMode());
+}
+
+TEST(DecimatorGAMGTest,TestInitialiseWrongResetInEachState) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongResetInEachState());
+}
+
+TEST(DecimatorGAMGTest,TestSetup) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestSetup());
+}
+
+TEST(DecimatorGAMGTest,TestSetupNoSignals) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestSetupNoSignals());
+}
+
+TEST(DecimatorGAMGTest,TestSetupNotMultipleOfFactor) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestSetupNotMultipleOfFactor());
+}
+
+TEST(DecimatorGAMGTest,TestSetupWrongOutputElements) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestSetupWrongOutputElements());
+}
+
+TEST(DecimatorGAMGTest,TestSetupWrongInputType) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestSetupWrongInputType());
+}
+
+TEST(DecimatorGAMGTest,TestSetupWrongOutputType) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestSetupWrongOutputType());
+}
+
+TEST(DecimatorGAMGTest,TestExecuteDecimate) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestExecuteDecimate());
+}
+
+TEST(DecimatorGAMGTest,TestExecuteInterpolate) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestExecuteInterpolate());
+}
+
+TEST(DecimatorGAMGTest,TestPrepareNextState) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestPrepareNextState());
+}
+
+TEST(DecimatorGAMGTest,TestPrepareNextStateNoReset) {
+    DecimatorGAMTest test;
+    ASSERT_TRUE(test.TestPrepareNextStateNoReset());
+}
@@ -0,0 +1,441 @@
+/**
+ * @file DecimatorGAMTest.cpp
+ * @brief Source file for class DecimatorGAMTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DecimatorGAMTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "math.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "DecimatorGAM.h"
+#include "DecimatorGAMTest.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class DecimatorGAMTestHelper: public MARTe::DecimatorGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    DecimatorGAMTestHelper() {
+    }
+
+    virtual ~DecimatorGAMTestHelper() {
+    }
+
+    void *GetInputSignalsMemory(MARTe::uint32 idx) {
+        return MARTe::GAM::GetInputSignalMemory(idx);
+    }
+
+    void *GetOutputSignalsMemory(MARTe::uint32 idx) {
+        return MARTe::GAM::GetOutputSignalMemory(idx);
+    }
+
+    bool InitialiseDecimator(const MARTe::uint32 factor, const MARTe::char8 * const mode, const MARTe::uint32 resetInEachState = 1u) {
+        using namespace MARTe;
+        bool ok = true;
+        for (uint32 k = 0u; k < numberOfCoeff; k++) {
+            numH[k] = static_cast<float32>(0.1 + (0.05 * k));
+        }
+        Vector<float32> numVec(numH, numberOfCoeff);
+        ok &= config.Write("Num", numVec);
+        if (factor > 0u) {
+            ok &= config.Write("Factor", factor);
+        }
+        ok &= config.Write("Mode", mode);
+        ok &= config.Write("ResetInEachState", resetInEachState);
+        return ok;
+    }
+
+    bool InitialiseSignals(const MARTe::uint32 numberOfSignals, const MARTe::char8 * const inputType, const MARTe::uint32 inputTypeSize,
+                           const MARTe::uint32 numberOfInputElements, const MARTe::char8 * const outputType, const MARTe::uint32 outputTypeSize,
+                           const MARTe::uint32 numberOfOutputElements) {
+        using namespace MARTe;
+        bool ok = true;
+        for (uint32 d = 0u; d < 2u; d++) {
+            bool isInput = (d == 0u);
+            uint32 signalByteSize = isInput ? (numberOfInputElements * inputTypeSize) : (numberOfOutputElements * outputTypeSize);
+            ok &= configSignals.MoveToRoot();
+            ok &= configSignals.CreateAbsolute(isInput ? "Signals.InputSignals" : "Signals.OutputSignals");
+            for (uint32 s = 0u; s < numberOfSignals; s++) {
+                StreamString signalIdx;
+                signalIdx.Printf("%u", s);
+                StreamString signalName;
+                signalName.Printf(isInput ? "InputSignal%u" : "OutputSignal%u", s);
+                ok &= configSignals.CreateRelative(signalIdx.Buffer());
+                ok &= configSignals.Write("QualifiedName", signalName.Buffer());
+                ok &= configSignals.Write("DataSource", "TestDataSource");
+                ok &= configSignals.Write("Type", isInput ? inputType : outputType);
+                ok &= configSignals.Write("NumberOfDimensions", 1);
+                ok &= configSignals.Write("NumberOfElements", isInput ? numberOfInputElements : numberOfOutputElements);
+                ok &= configSignals.Write("ByteSize", signalByteSize);
+                ok &= configSignals.MoveToAncestor(1u);
+            }
+            ok &= configSignals.Write("ByteSize", signalByteSize * numberOfSignals);
+        }
+        ok &= configSignals.MoveToRoot();
+        return ok;
+    }
+
+    bool SetupSignals() {
+        bool ok = SetConfiguredDatabase(configSignals);
+        ok &= AllocateInputSignalsMemory();
+        ok &= AllocateOutputSignalsMemory();
+        if (ok) {
+            ok = Setup();
+        }
+        return ok;
+    }
+
+    static const MARTe::uint32 numberOfCoeff = 7u;
+    MARTe::float32 numH[numberOfCoeff];
+    MARTe::ConfigurationDatabase configSignals;
+    MARTe::ConfigurationDatabase config;
+};
+CLASS_REGISTER(DecimatorGAMTestHelper, "1.0")
+
+/**
+ * Runs a decimator (or an interpolator) over several cycles and compares the outputs with a full rate reference computed with float64.
+ */
+static bool DecimatorGAMTestCompare(const bool interpolate, const MARTe::uint32 factor, const MARTe::uint32 numberOfInputElements,
+                                    const MARTe::uint32 numberOfSignals) {
+    using namespace MARTe;
+    const uint32 numberOfCycles = 5u;
+    uint32 numberOfOutputElements = interpolate ? (numberOfInputElements * factor) : (numberOfInputElements / factor);
+    DecimatorGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseDecimator(factor, interpolate ? "Interpolate" : "Decimate");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseSignals(numberOfSignals, "int16", static_cast<uint32>(sizeof(int16)), numberOfInputElements, "float64",
+                                static_cast<uint32>(sizeof(float64)), numberOfOutputElements);
+    ok &= gam.SetupSignals();
+    uint32 totalSamples = numberOfCycles * numberOfInputElements;
+    float64 *x = new float64[totalSamples * numberOfSignals];
+    for (uint32 n = 0u; n < (totalSamples * numberOfSignals); n++) {
+        x[n] = static_cast<float64>(static_cast<int16>(100.0 * sin(0.37 * n)));
+    }
+    for (uint32 c = 0u; (c < numberOfCycles) && (ok); c++) {
+        for (uint32 s = 0u; s < numberOfSignals; s++) {
+            int16 *in = static_cast<int16 *>(gam.GetInputSignalsMemory(s));
+            for (uint32 n = 0u; n < numberOfInputElements; n++) {
+                in[n] = static_cast<int16>(x[(s * totalSamples) + (c * numberOfInputElements) + n]);
+            }
+        }
+        ok = gam.Execute();
+        for (uint32 s = 0u; (s < numberOfSignals) && (ok); s++) {
+            const float64 * const xs = &x[s * totalSamples];
+            float64 *out = static_cast<float64 *>(gam.GetOutputSignalsMemory(s));
+            for (uint32 o = 0u; (o < numberOfOutputElements) && (ok); o++) {
+                float64 reference = 0.0;
+                for (uint32 k = 0u; k < DecimatorGAMTestHelper::numberOfCoeff; k++) {
+                    if (interpolate) {
+                        //filter of the zero-stuffed input
+                        uint32 n = (c * numberOfOutputElements) + o;
+                        if ((n >= k) && (((n - k) % factor) == 0u)) {
+                            reference += gam.numH[k] * xs[(n - k) / factor];
+                        }
+                    }
+                    else {
+                        //full rate output at the kept sample
+                        uint32 n = (c * numberOfInputElements) + (o * factor);
+                        if (n >= k) {
+                            reference += gam.numH[k] * xs[n - k];
+                        }
+                    }
+                }
+                ok = (fabs(reference - out[o]) < 1e-3);
+            }
+        }
+    }
+    delete[] x;
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool DecimatorGAMTest::TestConstructor() {
+    using namespace MARTe;
+    DecimatorGAM gam;
+    float32 coeff = 0.0F;
+    bool ok = (gam.GetNumberOfNumCoeff() == 0u);
+    ok &= (gam.GetFactor() == 0u);
+    ok &= !gam.IsInterpolator();
+    ok &= (gam.GetNumberOfSignals() == 0u);
+    ok &= (gam.GetNumberOfInputSamples() == 0u);
+    ok &= (gam.GetNumberOfOutputSamples() == 0u);
+    ok &= gam.GetResetInEachState();
+    ok &= !gam.GetNumCoeff(&coeff);
+    return ok;
+}
+
+bool DecimatorGAMTest::TestInitialise() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    bool ok = gam.InitialiseDecimator(4u, "Decimate");
+    ok &= gam.Initialise(gam.config);
+    ok &= (gam.GetFactor() == 4u);
+    ok &= !gam.IsInterpolator();
+    ok &= (gam.GetNumberOfNumCoeff() == DecimatorGAMTestHelper::numberOfCoeff);
+    float32 coeff[DecimatorGAMTestHelper::numberOfCoeff];
+    ok &= gam.GetNumCoeff(&coeff[0]);
+    for (uint32 k = 0u; (k < DecimatorGAMTestHelper::numberOfCoeff) && (ok); k++) {
+        ok = (coeff[k] == gam.numH[k]);
+    }
+    return ok;
+}
+
+bool DecimatorGAMTest::TestInitialiseInterpolate() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    bool ok = gam.InitialiseDecimator(3u, "Interpolate");
+    ok &= gam.Initialise(gam.config);
+    ok &= (gam.GetFactor() == 3u);
+    ok &= gam.IsInterpolator();
+    return ok;
+}
+
+bool DecimatorGAMTest::TestInitialiseNoNum() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    bool ok = gam.config.Write("Factor", 2u);
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool DecimatorGAMTest::TestInitialiseNoFactor() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    //Factor = 0 is not written
+    bool ok = gam.InitialiseDecimator(0u, "Decimate");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool DecimatorGAMTest::TestInitialiseWrongFactor() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    bool ok = gam.InitialiseDecimator(1u, "Decimate");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool DecimatorGAMTest::TestInitialiseWrongMode() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    bool ok = gam.InitialiseDecimator(2u, "Resample");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool DecimatorGAMTest::TestInitialiseWrongResetInEachState() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    bool ok = gam.InitialiseDecimator(2u, "Decimate", 2u);
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool DecimatorGAMTest::TestSetup() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseDecimator(4u, "Decimate");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseSignals(3u, "float32", static_cast<uint32>(sizeof(float32)), 40u, "float32", static_cast<uint32>(sizeof(float32)), 10u);
+    ok &= gam.SetupSignals();
+    ok &= (gam.GetNumberOfSignals() == 3u);
+    ok &= (gam.GetNumberOfInputSamples() == 40u);
+    ok &= (gam.GetNumberOfOutputSamples() == 10u);
+    return ok;
+}
+
+bool DecimatorGAMTest::TestSetupNoSignals() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseDecimator(4u, "Decimate");
+    ok &= gam.Initialise(gam.config);
+    if (ok) {
+        ok = !gam.Setup();
+    }
+    return ok;
+}
+
+bool DecimatorGAMTest::TestSetupNotMultipleOfFactor() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseDecimator(4u, "Decimate");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseSignals(1u, "float32", static_cast<uint32>(sizeof(float32)), 10u, "float32", static_cast<uint32>(sizeof(float32)), 2u);
+    if (ok) {
+        ok = !gam.SetupSignals();
+    }
+    return ok;
+}
+
+bool DecimatorGAMTest::TestSetupWrongOutputElements() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseDecimator(2u, "Interpolate");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseSignals(1u, "float32", static_cast<uint32>(sizeof(float32)), 10u, "float32", static_cast<uint32>(sizeof(float32)), 5u);
+    if (ok) {
+        ok = !gam.SetupSignals();
+    }
+    return ok;
+}
+
+bool DecimatorGAMTest::TestSetupWrongInputType() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseDecimator(2u, "Decimate");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseSignals(1u, "uint32", static_cast<uint32>(sizeof(uint32)), 10u, "float32", static_cast<uint32>(sizeof(float32)), 5u);
+    if (ok) {
+        ok = !gam.SetupSignals();
+    }
+    return ok;
+}
+
+bool DecimatorGAMTest::TestSetupWrongOutputType() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseDecimator(2u, "Decimate");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseSignals(1u, "float32", static_cast<uint32>(sizeof(float32)), 10u, "int16", static_cast<uint32>(sizeof(int16)), 5u);
+    if (ok) {
+        ok = !gam.SetupSignals();
+    }
+    return ok;
+}
+
+bool DecimatorGAMTest::TestExecuteDecimate() {
+    bool ok = DecimatorGAMTestCompare(false, 4u, 16u, 2u);
+    if (ok) {
+        //fewer input samples than coefficients
+        ok = DecimatorGAMTestCompare(false, 2u, 4u, 1u);
+    }
+    return ok;
+}
+
+bool DecimatorGAMTest::TestExecuteInterpolate() {
+    bool ok = DecimatorGAMTestCompare(true, 3u, 5u, 3u);
+    if (ok) {
+        //a single input sample per cycle
+        ok = DecimatorGAMTestCompare(true, 4u, 1u, 1u);
+    }
+    return ok;
+}
+
+bool DecimatorGAMTest::TestPrepareNextState() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseDecimator(2u, "Decimate");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseSignals(1u, "float32", static_cast<uint32>(sizeof(float32)), 4u, "float32", static_cast<uint32>(sizeof(float32)), 2u);
+    ok &= gam.SetupSignals();
+    float32 *in = static_cast<float32 *>(gam.GetInputSignalsMemory(0u));
+    float32 *out = static_cast<float32 *>(gam.GetOutputSignalsMemory(0u));
+    for (uint32 n = 0u; n < 4u; n++) {
+        in[n] = 1.0F;
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    //the history is not zero: the first output after the reset only depends on the first input
+    if (ok) {
+        ok = gam.PrepareNextState("A", "B");
+    }
+    for (uint32 n = 0u; n < 4u; n++) {
+        in[n] = 0.0F;
+    }
+    in[0] = 1.0F;
+    if (ok) {
+        ok = gam.Execute();
+    }
+    if (ok) {
+        ok = (out[0] == gam.numH[0]);
+    }
+    return ok;
+}
+
+bool DecimatorGAMTest::TestPrepareNextStateNoReset() {
+    using namespace MARTe;
+    DecimatorGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseDecimator(2u, "Decimate", 0u);
+    ok &= gam.Initialise(gam.config);
+    ok &= !gam.GetResetInEachState();
+    ok &= gam.InitialiseSignals(1u, "float32", static_cast<uint32>(sizeof(float32)), 4u, "float32", static_cast<uint32>(sizeof(float32)), 2u);
+    ok &= gam.SetupSignals();
+    float32 *in = static_cast<float32 *>(gam.GetInputSignalsMemory(0u));
+    float32 *out = static_cast<float32 *>(gam.GetOutputSignalsMemory(0u));
+    for (uint32 n = 0u; n < 4u; n++) {
+        in[n] = 1.0F;
+    }
+    //A -> B: the GAM was not executed in the previous state (reset)
+    if (ok) {
+        ok = gam.PrepareNextState("A", "B");
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    //B -> C: the GAM was executed in B (no reset)
+    if (ok) {
+        ok = gam.PrepareNextState("B", "C");
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    //all the coefficients see a 1
+    float32 sum = 0.0F;
+    for (uint32 k = 0u; k < DecimatorGAMTestHelper::numberOfCoeff; k++) {
+        sum += gam.numH[k];
+    }
+    if (ok) {
+        ok = (fabs(out[1] - sum) < 1e-5);
+    }
+    return ok;
+}
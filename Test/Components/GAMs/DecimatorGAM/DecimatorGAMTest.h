@@ -0,0 +1,139 @@
+/**
+ * @file DecimatorGAMTest.h
+ * @brief Header file for class DecimatorGAMTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class DecimatorGAMTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_COMPONENTS_GAMS_DECIMATORGAM_DECIMATORGAMTEST_H_
+#define TEST_COMPONENTS_GAMS_DECIMATORGAM_DECIMATORGAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the DecimatorGAM public methods.
+ */
+class DecimatorGAMTest {
+public:
+
+    /**
+     * @brief Tests the default constructor post-conditions.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise() of a decimator.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests the Initialise() of an interpolator.
+     */
+    bool TestInitialiseInterpolate();
+
+    /**
+     * @brief Tests that Initialise() fails without Num.
+     */
+    bool TestInitialiseNoNum();
+
+    /**
+     * @brief Tests that Initialise() fails without Factor.
+     */
+    bool TestInitialiseNoFactor();
+
+    /**
+     * @brief Tests that Initialise() fails with Factor = 1.
+     */
+    bool TestInitialiseWrongFactor();
+
+    /**
+     * @brief Tests that Initialise() fails with an invalid Mode.
+     */
+    bool TestInitialiseWrongMode();
+
+    /**
+     * @brief Tests that Initialise() fails with an invalid ResetInEachState.
+     */
+    bool TestInitialiseWrongResetInEachState();
+
+    /**
+     * @brief Tests the Setup() post-conditions.
+     */
+    bool TestSetup();
+
+    /**
+     * @brief Tests that Setup() fails without signals.
+     */
+    bool TestSetupNoSignals();
+
+    /**
+     * @brief Tests that Setup() fails if the number of input elements is not a multiple of Factor.
+     */
+    bool TestSetupNotMultipleOfFactor();
+
+    /**
+     * @brief Tests that Setup() fails if the number of output elements is not consistent with the Factor.
+     */
+    bool TestSetupWrongOutputElements();
+
+    /**
+     * @brief Tests that Setup() fails with an unsupported input type.
+     */
+    bool TestSetupWrongInputType();
+
+    /**
+     * @brief Tests that Setup() fails with an unsupported output type.
+     */
+    bool TestSetupWrongOutputType();
+
+    /**
+     * @brief Tests the decimation (int16 inputs) against a full rate filter, over several cycles.
+     */
+    bool TestExecuteDecimate();
+
+    /**
+     * @brief Tests the interpolation against the filtering of the zero-stuffed input, over several cycles.
+     */
+    bool TestExecuteInterpolate();
+
+    /**
+     * @brief Tests that PrepareNextState() resets the states.
+     */
+    bool TestPrepareNextState();
+
+    /**
+     * @brief Tests that with ResetInEachState = 0 the states are only reset if the GAM was not executed in the previous state.
+     */
+    bool TestPrepareNextStateNoReset();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_COMPONENTS_GAMS_DECIMATORGAM_DECIMATORGAMTEST_H_ */
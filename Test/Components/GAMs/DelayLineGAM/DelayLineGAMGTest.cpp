@@ -0,0 +1,79 @@
+/**
+ * @file DelayLineGAMGTest.cpp
+ * @brief Source file for class DelayLineGAMGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DelayLineGAMGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "DelayLineGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(DelayLineGAMGTest,TestConstructor) {
+    DelayLineGAMTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(DelayLineGAMGTest,TestSetup) {
+    DelayLineGAMTest test;
+    ASSERT_TRUE(test.TestSetup());
+}
+
+TEST(DelayLineGAMGTest,TestSetup_FalseNumberOfOutputs) {
+    DelayLineGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseNumberOfOutputs());
+}
+
+TEST(DelayLineGAMGTest,TestSetup_FalseBadType) {
+    DelayLineGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadType());
+}
+
+TEST(DelayLineGAMGTest,TestSetup_FalseNoDelayNoWindow) {
+    DelayLineGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseNoDelayNoWindow());
+}
+
+TEST(DelayLineGAMGTest,TestSetup_FalseBadWindowSize) {
+    DelayLineGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadWindowSize());
+}
+
+TEST(DelayLineGAMGTest,TestExecute_Delay) {
+    DelayLineGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Delay());
+}
+
+TEST(DelayLineGAMGTest,TestExecute_Window) {
+    DelayLineGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Window());
+}
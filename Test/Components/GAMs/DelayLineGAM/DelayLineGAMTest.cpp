@@ -0,0 +1,379 @@
+/**
+ * @file DelayLineGAMTest.cpp
+ * @brief Source file for class DelayLineGAMTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DelayLineGAMTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "DelayLineGAMTest.h"
+#include "MemoryDataSourceI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class DelayLineGAMTestGAM: public DelayLineGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    void *GetInputSignalMemory(const uint32 signalIdx);
+
+    void *GetOutputSignalMemory(const uint32 signalIdx);
+};
+
+void *DelayLineGAMTestGAM::GetInputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetInputSignalMemory(signalIdx);
+}
+
+void *DelayLineGAMTestGAM::GetOutputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetOutputSignalMemory(signalIdx);
+}
+
+CLASS_REGISTER(DelayLineGAMTestGAM, "1.0")
+
+class DelayLineGAMTestDS: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+            const char8 * const nextStateName);
+
+    virtual bool Synchronise();
+
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+};
+CLASS_REGISTER(DelayLineGAMTestDS, "1.0")
+
+bool DelayLineGAMTestDS::PrepareNextState(const char8 * const currentStateName,
+        const char8 * const nextStateName) {
+    return true;
+}
+
+bool DelayLineGAMTestDS::Synchronise() {
+    return true;
+}
+
+const char8 *DelayLineGAMTestDS::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    return "MemoryMapInputBroker";
+}
+
+/**
+ * @brief Configures an application with a single DelayLineGAMTestGAM (GAMA) with the parameters and signals in gamConfig.
+ * The input signals shall use the Drv1 DataSource and the output signals the DDB DataSource.
+ */
+static bool InitialiseDelayLineApplication(const char8 * const gamConfig) {
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = DelayLineGAMTestGAM";
+    config += gamConfig;
+    config += ""
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = DelayLineGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    config.Seek(0);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT < RealTimeApplication > application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * @brief Signals of the tests: a uint16[2] delayed by 3 cycles and the window of the last 5 cycles of an int32.
+ */
+static const char8 * const delayLineSignals = ""
+        "            InputSignals = {"
+        "                A = {"
+        "                    DataSource = Drv1"
+        "                    Type = uint16"
+        "                    NumberOfElements = 2"
+        "                }"
+        "                B = {"
+        "                    DataSource = Drv1"
+        "                    Type = int32"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                ADelayed = {"
+        "                    DataSource = DDB"
+        "                    Type = uint16"
+        "                    NumberOfElements = 2"
+        "                    Delay = 3"
+        "                }"
+        "                BWindow = {"
+        "                    DataSource = DDB"
+        "                    Type = int32"
+        "                    NumberOfElements = 5"
+        "                    Window = 5"
+        "                }"
+        "            }";
+
+/**
+ * @brief Configures the application with the delayLineSignals and gets the GAM.
+ */
+static bool InitialiseDelayLineTest(ReferenceT<DelayLineGAMTestGAM> &gam) {
+    bool ok = InitialiseDelayLineApplication(delayLineSignals);
+    if (ok) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = gam.IsValid();
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+DelayLineGAMTest::DelayLineGAMTest() {
+}
+
+DelayLineGAMTest::~DelayLineGAMTest() {
+}
+
+bool DelayLineGAMTest::TestConstructor() {
+    DelayLineGAMTestGAM gam;
+    return (gam.GetNumberOfSlots(0u) == 0u);
+}
+
+bool DelayLineGAMTest::TestSetup() {
+    ReferenceT<DelayLineGAMTestGAM> gam;
+    bool ret = InitialiseDelayLineTest(gam);
+    if (ret) {
+        ret = (gam->GetNumberOfSlots(0u) == 4u);
+        ret &= (gam->GetNumberOfSlots(1u) == 8u);
+        ret &= (gam->GetNumberOfSlots(2u) == 0u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool DelayLineGAMTest::TestSetup_FalseNumberOfOutputs() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                A = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint16"
+            "                }"
+            "                B = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint16"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                ADelayed = {"
+            "                    DataSource = DDB"
+            "                    Type = uint16"
+            "                    Delay = 1"
+            "                }"
+            "            }";
+    bool ret = !InitialiseDelayLineApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool DelayLineGAMTest::TestSetup_FalseBadType() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                A = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint16"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                ADelayed = {"
+            "                    DataSource = DDB"
+            "                    Type = int16"
+            "                    Delay = 1"
+            "                }"
+            "            }";
+    bool ret = !InitialiseDelayLineApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool DelayLineGAMTest::TestSetup_FalseNoDelayNoWindow() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                A = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint16"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                ADelayed = {"
+            "                    DataSource = DDB"
+            "                    Type = uint16"
+            "                }"
+            "            }";
+    bool ret = !InitialiseDelayLineApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (ret) {
+        const char8 * const gamConfigBoth = ""
+                "            InputSignals = {"
+                "                A = {"
+                "                    DataSource = Drv1"
+                "                    Type = uint16"
+                "                }"
+                "            }"
+                "            OutputSignals = {"
+                "                ADelayed = {"
+                "                    DataSource = DDB"
+                "                    Type = uint16"
+                "                    Delay = 1"
+                "                    Window = 1"
+                "                }"
+                "            }";
+        ret = !InitialiseDelayLineApplication(gamConfigBoth);
+        ObjectRegistryDatabase::Instance()->Purge();
+    }
+    return ret;
+}
+
+bool DelayLineGAMTest::TestSetup_FalseBadWindowSize() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                A = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint16"
+            "                    NumberOfElements = 2"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                AWindow = {"
+            "                    DataSource = DDB"
+            "                    Type = uint16"
+            "                    NumberOfElements = 5"
+            "                    Window = 5"
+            "                }"
+            "            }";
+    bool ret = !InitialiseDelayLineApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool DelayLineGAMTest::TestExecute_Delay() {
+    ReferenceT<DelayLineGAMTestGAM> gam;
+    bool ret = InitialiseDelayLineTest(gam);
+    uint16 *a = NULL_PTR(uint16 *);
+    uint16 *aDelayed = NULL_PTR(uint16 *);
+    if (ret) {
+        a = static_cast<uint16 *>(gam->GetInputSignalMemory(0u));
+        aDelayed = static_cast<uint16 *>(gam->GetOutputSignalMemory(0u));
+    }
+    for (uint32 n = 0u; (n < 20u) && (ret); n++) {
+        a[0] = static_cast<uint16>(n + 1u);
+        a[1] = static_cast<uint16>(100u + n);
+        ret = gam->Execute();
+        if (ret) {
+            if (n < 3u) {
+                ret = (aDelayed[0] == 0u) && (aDelayed[1] == 0u);
+            }
+            else {
+                ret = (aDelayed[0] == static_cast<uint16>(n - 2u)) && (aDelayed[1] == static_cast<uint16>(97u + n));
+            }
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool DelayLineGAMTest::TestExecute_Window() {
+    ReferenceT<DelayLineGAMTestGAM> gam;
+    bool ret = InitialiseDelayLineTest(gam);
+    int32 *b = NULL_PTR(int32 *);
+    int32 *bWindow = NULL_PTR(int32 *);
+    if (ret) {
+        b = static_cast<int32 *>(gam->GetInputSignalMemory(1u));
+        bWindow = static_cast<int32 *>(gam->GetOutputSignalMemory(1u));
+    }
+    //More cycles than the 8 slots of the ring, so that the window wraps around
+    for (int32 n = 0; (n < 21) && (ret); n++) {
+        *b = -n;
+        ret = gam->Execute();
+        for (int32 w = 0; (w < 5) && (ret); w++) {
+            int32 cycle = (n - 4) + w;
+            int32 expected = (cycle < 0) ? (0) : (-cycle);
+            ret = (bWindow[w] == expected);
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
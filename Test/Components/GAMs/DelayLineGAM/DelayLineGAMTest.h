@@ -0,0 +1,102 @@
+/**
+ * @file DelayLineGAMTest.h
+ * @brief Header file for class DelayLineGAMTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class DelayLineGAMTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef DELAYLINEGAMTEST_H_
+#define DELAYLINEGAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "DelayLineGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the DelayLineGAM methods
+ */
+class DelayLineGAMTest {
+public:
+
+    /**
+     * @brief Constructor
+     */
+    DelayLineGAMTest();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~DelayLineGAMTest();
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Setup method with a Delay and a Window output
+     */
+    bool TestSetup();
+
+    /**
+     * @brief Tests that the Setup method fails if the number of output signals is not the number of input signals
+     */
+    bool TestSetup_FalseNumberOfOutputs();
+
+    /**
+     * @brief Tests that the Setup method fails if an output signal does not have the type of its input signal
+     */
+    bool TestSetup_FalseBadType();
+
+    /**
+     * @brief Tests that the Setup method fails if an output signal has neither a Delay nor a Window (or both)
+     */
+    bool TestSetup_FalseNoDelayNoWindow();
+
+    /**
+     * @brief Tests that the Setup method fails if a Window output signal is not Window times the size of the input signal
+     */
+    bool TestSetup_FalseBadWindowSize();
+
+    /**
+     * @brief Tests the Execute method with an array signal delayed by 3 cycles
+     */
+    bool TestExecute_Delay();
+
+    /**
+     * @brief Tests the Execute method with a Window which wraps around the ring
+     */
+    bool TestExecute_Window();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DELAYLINEGAMTEST_H_ */
@@ -169,3 +169,13 @@ TEST(DoubleHandshakeMasterGAMGTest,TestExecute_InteractiveManual) {
     ASSERT_TRUE(test.TestExecute_InteractiveManual());
 }
 */
+
+TEST(DoubleHandshakeMasterGAMGTest,TestSetup_PackedArrays_FalseSplitSignals) {
+    DoubleHandshakeMasterGAMTest test;
+    ASSERT_TRUE(test.TestSetup_PackedArrays_FalseSplitSignals());
+}
+
+TEST(DoubleHandshakeMasterGAMGTest,TestExecute_PackedArrays) {
+    DoubleHandshakeMasterGAMTest test;
+    ASSERT_TRUE(test.TestExecute_PackedArrays());
+}
@@ -78,6 +78,38 @@ void *DoubleHandShakeMasterGAMTestGAM::GetOutputMemoryX() {
 
 CLASS_REGISTER(DoubleHandShakeMasterGAMTestGAM, "1.0")
 
+/**
+ * DataSource which leaves the input memory of the GAM to be written by the test.
+ */
+class PackedChannelsMasterTestDS: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    virtual bool Synchronise();
+
+    virtual const char8 *GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction);
+};
+
+bool PackedChannelsMasterTestDS::PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName) {
+    return true;
+}
+
+bool PackedChannelsMasterTestDS::Synchronise() {
+    return true;
+}
+
+const char8 *PackedChannelsMasterTestDS::GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction) {
+    return "MemoryMapInputBroker";
+}
+
+CLASS_REGISTER(PackedChannelsMasterTestDS, "1.0")
+
 class CommandProviderDS: public MemoryDataSourceI, public MessageI {
 
 public:
@@ -5577,3 +5609,250 @@ bool DoubleHandshakeMasterGAMTest::TestExecute_InteractiveManual() {
 bool DoubleHandshakeMasterGAMTest::TestInitialise() {
     return TestExecute();
 }
+
+bool DoubleHandshakeMasterGAMTest::TestSetup_PackedArrays_FalseSplitSignals() {
+    static const char8 * const config = ""
+            "$Application = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = DoubleHandShakeMasterGAMTestGAM"
+            "            PackedArrays = 1"
+            "            InputSignals = {"
+            "                CommandIn0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 20"
+            "                }"
+            "                CommandIn1 = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 20"
+            "                }"
+            "                AckIn = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 40"
+            "                }"
+            "                ClearIn = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 40"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                CommandOut = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 40"
+            "                }"
+            "                InternalState = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint8"
+            "                    NumberOfElements = 40"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = PackedChannelsMasterTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool DoubleHandshakeMasterGAMTest::TestExecute_PackedArrays() {
+    static const char8 * const config = ""
+            "$Application = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = DoubleHandShakeMasterGAMTestGAM"
+            "            PackedArrays = 1"
+            "            InputSignals = {"
+            "                CommandIn = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 40"
+            "                }"
+            "                AckIn = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 40"
+            "                }"
+            "                ClearIn = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 40"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                CommandOut = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 40"
+            "                }"
+            "                InternalState = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint8"
+            "                    NumberOfElements = 40"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = PackedChannelsMasterTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<DoubleHandShakeMasterGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application.Functions.GAM1");
+        ret = gam.IsValid();
+    }
+
+    const uint32 numberOfChannels = 40u;
+    uint32 *commandIn = NULL;
+    uint32 *ackIn = NULL;
+    uint32 *clearIn = NULL;
+    uint32 *commandOut = NULL;
+    uint8 *internalState = NULL;
+    if (ret) {
+        commandIn = (uint32*) gam->GetInputMemoryX();
+        ackIn = &commandIn[numberOfChannels];
+        clearIn = &commandIn[2u * numberOfChannels];
+        commandOut = (uint32*) gam->GetOutputMemoryX();
+        internalState = (uint8*) (&commandOut[numberOfChannels]);
+        for (uint32 i = 0u; i < (3u * numberOfChannels); i++) {
+            commandIn[i] = 0u;
+        }
+        ret = gam->Execute();
+    }
+    for (uint32 i = 0u; (i < numberOfChannels) && (ret); i++) {
+        ret = (internalState[i] == 0u);
+    }
+    //channel 35 (second mask word) goes through the whole handshake and channel 3 goes to error
+    const uint32 ch = 35u;
+    if (ret) {
+        commandIn[ch] = 5u;
+        clearIn[ch] = 1u;
+        ackIn[3] = 7u;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (internalState[ch] == 1u) && (commandOut[ch] == 5u) && (internalState[3] == 4u);
+    }
+    for (uint32 i = 0u; (i < numberOfChannels) && (ret); i++) {
+        if ((i != ch) && (i != 3u)) {
+            ret = (internalState[i] == 0u) && (commandOut[i] == 0u);
+        }
+    }
+    if (ret) {
+        ackIn[ch] = 5u;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (internalState[ch] == 2u);
+    }
+    if (ret) {
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (internalState[ch] == 2u) && (commandOut[ch] == 5u);
+    }
+    if (ret) {
+        clearIn[ch] = 0u;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (internalState[ch] == 3u) && (commandOut[ch] == 0u);
+    }
+    if (ret) {
+        ackIn[ch] = 0u;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (internalState[ch] == 0u);
+    }
+    //recover channel 3
+    if (ret) {
+        commandIn[3] = 1u;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (internalState[3] == 4u);
+    }
+    if (ret) {
+        commandIn[3] = 0u;
+        ackIn[3] = 0u;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (internalState[3] == 0u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
@@ -174,6 +174,16 @@ public:
     * @brief Same as TestExecute() where the Initialise function is called
     */
     bool TestInitialise();
+
+    /**
+    * @brief Tests that the Setup fails with PackedArrays = 1 if the commands are split in more than one signal
+    */
+    bool TestSetup_PackedArrays_FalseSplitSignals();
+
+    /**
+    * @brief Tests the execution with PackedArrays = 1
+    */
+    bool TestExecute_PackedArrays();
 };
 
 /*---------------------------------------------------------------------------*/
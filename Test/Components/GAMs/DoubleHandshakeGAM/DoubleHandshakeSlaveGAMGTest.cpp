@@ -133,3 +133,12 @@ TEST(DoubleHandshakeSlaveGAMGTest,TestExecute_RecoverFromError) {
  }
  */
 
+TEST(DoubleHandshakeSlaveGAMGTest,TestSetup_PackedArrays_FalseSplitSignals) {
+    DoubleHandshakeSlaveGAMTest test;
+    ASSERT_TRUE(test.TestSetup_PackedArrays_FalseSplitSignals());
+}
+
+TEST(DoubleHandshakeSlaveGAMGTest,TestExecute_PackedArrays) {
+    DoubleHandshakeSlaveGAMTest test;
+    ASSERT_TRUE(test.TestExecute_PackedArrays());
+}
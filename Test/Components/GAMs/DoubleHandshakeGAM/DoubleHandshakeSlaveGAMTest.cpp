@@ -78,6 +78,38 @@ void *DoubleHandShakeSlaveGAMTestGAM::GetOutputMemoryX() {
 
 CLASS_REGISTER(DoubleHandShakeSlaveGAMTestGAM, "1.0")
 
+/**
+ * DataSource which leaves the input memory of the GAM to be written by the test.
+ */
+class PackedChannelsSlaveTestDS: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    virtual bool Synchronise();
+
+    virtual const char8 *GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction);
+};
+
+bool PackedChannelsSlaveTestDS::PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName) {
+    return true;
+}
+
+bool PackedChannelsSlaveTestDS::Synchronise() {
+    return true;
+}
+
+const char8 *PackedChannelsSlaveTestDS::GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction) {
+    return "MemoryMapInputBroker";
+}
+
+CLASS_REGISTER(PackedChannelsSlaveTestDS, "1.0")
+
 class PlcSimulatorSlaveDS: public MemoryDataSourceI, public MessageI {
 
 public:
@@ -3166,3 +3198,214 @@ bool DoubleHandshakeSlaveGAMTest::TestInitialise() {
     return TestExecute();
 }
 
+bool DoubleHandshakeSlaveGAMTest::TestSetup_PackedArrays_FalseSplitSignals() {
+    static const char8 * const config = ""
+            "$Application = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = DoubleHandShakeSlaveGAMTestGAM"
+            "            PackedArrays = 1"
+            "            InputSignals = {"
+            "                CommandIn = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 40"
+            "                }"
+            "                ClearIn0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 20"
+            "                }"
+            "                ClearIn1 = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 20"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                AckOut = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 40"
+            "                }"
+            "                InternalState = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint8"
+            "                    NumberOfElements = 40"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = PackedChannelsSlaveTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool DoubleHandshakeSlaveGAMTest::TestExecute_PackedArrays() {
+    static const char8 * const config = ""
+            "$Application = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = DoubleHandShakeSlaveGAMTestGAM"
+            "            PackedArrays = 1"
+            "            InputSignals = {"
+            "                CommandIn = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 40"
+            "                }"
+            "                ClearIn = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 40"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                AckOut = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 40"
+            "                }"
+            "                InternalState = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint8"
+            "                    NumberOfElements = 40"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = PackedChannelsSlaveTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<DoubleHandShakeSlaveGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application.Functions.GAM1");
+        ret = gam.IsValid();
+    }
+
+    const uint32 numberOfChannels = 40u;
+    uint32 *commandIn = NULL;
+    uint32 *clearIn = NULL;
+    uint32 *ackOut = NULL;
+    uint8 *internalState = NULL;
+    if (ret) {
+        commandIn = (uint32*) gam->GetInputMemoryX();
+        clearIn = &commandIn[numberOfChannels];
+        ackOut = (uint32*) gam->GetOutputMemoryX();
+        internalState = (uint8*) (&ackOut[numberOfChannels]);
+        for (uint32 i = 0u; i < (2u * numberOfChannels); i++) {
+            commandIn[i] = 0u;
+        }
+        ret = gam->Execute();
+    }
+    for (uint32 i = 0u; (i < numberOfChannels) && (ret); i++) {
+        ret = (internalState[i] == 0u);
+    }
+    //channel 33 (second mask word) goes through the whole handshake and channel 2 goes to error
+    const uint32 ch = 33u;
+    if (ret) {
+        commandIn[ch] = 9u;
+        clearIn[ch] = 1u;
+        commandIn[2] = 4u;
+        clearIn[2] = 1u;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (internalState[ch] == 1u) && (internalState[2] == 1u) && (ackOut[ch] == 0u);
+    }
+    for (uint32 i = 0u; (i < numberOfChannels) && (ret); i++) {
+        if ((i != ch) && (i != 2u)) {
+            ret = (internalState[i] == 0u) && (ackOut[i] == 0u);
+        }
+    }
+    if (ret) {
+        clearIn[ch] = 0u;
+        commandIn[2] = 6u;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (internalState[ch] == 2u) && (ackOut[ch] == 9u) && (internalState[2] == 3u);
+    }
+    if (ret) {
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (internalState[ch] == 2u) && (ackOut[ch] == 9u);
+    }
+    if (ret) {
+        commandIn[ch] = 0u;
+        commandIn[2] = 0u;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (internalState[ch] == 0u) && (ackOut[ch] == 0u) && (internalState[2] == 0u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
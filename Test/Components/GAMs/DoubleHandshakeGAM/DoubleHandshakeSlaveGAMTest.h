@@ -139,6 +139,16 @@ public:
     * @brief Same as TestExecute() where the Initialise method is used
     */
     bool TestInitialise();
+
+    /**
+    * @brief Tests that the Setup fails with PackedArrays = 1 if the clear triggers are split in more than one signal
+    */
+    bool TestSetup_PackedArrays_FalseSplitSignals();
+
+    /**
+    * @brief Tests the execution with PackedArrays = 1
+    */
+    bool TestExecute_PackedArrays();
 };
 
 /*---------------------------------------------------------------------------*/
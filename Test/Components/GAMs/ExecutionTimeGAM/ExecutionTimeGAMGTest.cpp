@@ -0,0 +1,144 @@
+/**
+ * @file ExecutionTimeGAMGTest.cpp
+ * @brief Source file for class ExecutionTimeGAMGTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutionTimeGAMGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ExecutionTimeGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(ExecutionTimeGAMGTest,TestConstructor) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(ExecutionTimeGAMGTest,TestInitialise) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(ExecutionTimeGAMGTest,TestInitialise_DefaultValues) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_DefaultValues());
+}
+
+TEST(ExecutionTimeGAMGTest,TestInitialise_FalseSignificantBits) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseSignificantBits());
+}
+
+TEST(ExecutionTimeGAMGTest,TestInitialise_FalseRefreshPeriod) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseRefreshPeriod());
+}
+
+TEST(ExecutionTimeGAMGTest,TestSetup) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestSetup());
+}
+
+TEST(ExecutionTimeGAMGTest,TestSetup_FalseNumberOfOutputSignals) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseNumberOfOutputSignals());
+}
+
+TEST(ExecutionTimeGAMGTest,TestSetup_FalseInputType) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseInputType());
+}
+
+TEST(ExecutionTimeGAMGTest,TestSetup_FalseInputElements) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseInputElements());
+}
+
+TEST(ExecutionTimeGAMGTest,TestSetup_FalseOutputType) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseOutputType());
+}
+
+TEST(ExecutionTimeGAMGTest,TestSetup_FalseOutputElements) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseOutputElements());
+}
+
+TEST(ExecutionTimeGAMGTest,TestExecute) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestExecute());
+}
+
+TEST(ExecutionTimeGAMGTest,TestExecute_Histogram) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Histogram());
+}
+
+TEST(ExecutionTimeGAMGTest,TestExecute_RefreshPeriod) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestExecute_RefreshPeriod());
+}
+
+TEST(ExecutionTimeGAMGTest,TestPrepareNextState) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestPrepareNextState());
+}
+
+TEST(ExecutionTimeGAMGTest,TestPrintStatistics) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestPrintStatistics());
+}
+
+TEST(ExecutionTimeGAMGTest,TestGetStatistics) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestGetStatistics());
+}
+
+TEST(ExecutionTimeGAMGTest,TestGetStatistics_False) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestGetStatistics_False());
+}
+
+TEST(ExecutionTimeGAMGTest,TestResetStatistics) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestResetStatistics());
+}
+
+TEST(ExecutionTimeGAMGTest,TestGetBinIndex) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestGetBinIndex());
+}
+
+TEST(ExecutionTimeGAMGTest,TestGetBinUpperBound) {
+    ExecutionTimeGAMTest test;
+    ASSERT_TRUE(test.TestGetBinUpperBound());
+}
@@ -0,0 +1,643 @@
+/**
+ * @file ExecutionTimeGAMTest.cpp
+ * @brief Source file for class ExecutionTimeGAMTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutionTimeGAMTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "ExecutionTimeGAMTest.h"
+#include "MemoryDataSourceI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class ExecutionTimeGAMTestGAM: public ExecutionTimeGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    void *GetInputSignalMemory(const uint32 signalIdx);
+
+    void *GetOutputSignalMemory(const uint32 signalIdx);
+};
+
+void *ExecutionTimeGAMTestGAM::GetInputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetInputSignalMemory(signalIdx);
+}
+
+void *ExecutionTimeGAMTestGAM::GetOutputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetOutputSignalMemory(signalIdx);
+}
+
+CLASS_REGISTER(ExecutionTimeGAMTestGAM, "1.0")
+
+class ExecutionTimeGAMTestDS: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+            const char8 * const nextStateName);
+
+    virtual bool Synchronise();
+
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+};
+CLASS_REGISTER(ExecutionTimeGAMTestDS, "1.0")
+
+bool ExecutionTimeGAMTestDS::PrepareNextState(const char8 * const currentStateName,
+        const char8 * const nextStateName) {
+    return true;
+}
+
+bool ExecutionTimeGAMTestDS::Synchronise() {
+    return true;
+}
+
+const char8 *ExecutionTimeGAMTestDS::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    return "MemoryMapInputBroker";
+}
+
+/**
+ * @brief Configures an application with a single ExecutionTimeGAMTestGAM (GAMA) with the parameters and signals in gamConfig.
+ * The input signals shall use the Drv1 DataSource and the output signals the DDB DataSource.
+ */
+static bool InitialiseExecutionTimeApplication(const char8 * const gamConfig) {
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = ExecutionTimeGAMTestGAM";
+    config += gamConfig;
+    config += ""
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = ExecutionTimeGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    config.Seek(0);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT < RealTimeApplication > application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * @brief Calls the ExecutionTimeGAM::Initialise with the parameters in config.
+ */
+static bool InitialiseExecutionTimeGAM(const char8 * const config) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        ExecutionTimeGAMTestGAM gam;
+        cdb.MoveToRoot();
+        ok = gam.Initialise(cdb);
+    }
+    return ok;
+}
+
+/**
+ * The configuration of a GAM with the cycle time of a thread and the timestamps of a GAM (SignificantBits = 2, i.e. 124 bins).
+ * The Execute output signal also contains the histogram.
+ */
+static const char8 * const executionTimeGAMConfig = ""
+        "            SignificantBits = 2"
+        "            InputSignals = {"
+        "                Thread1_CycleTime = {"
+        "                    DataSource = Drv1"
+        "                    Type = uint32"
+        "                }"
+        "                GAMB_ReadTime = {"
+        "                    DataSource = Drv1"
+        "                    Type = uint32"
+        "                }"
+        "                GAMB_ExecTime = {"
+        "                    DataSource = Drv1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Cycle = {"
+        "                    DataSource = DDB"
+        "                    Type = uint32"
+        "                    NumberOfElements = 7"
+        "                }"
+        "                Input = {"
+        "                    DataSource = DDB"
+        "                    Type = uint32"
+        "                    NumberOfElements = 7"
+        "                }"
+        "                Execute = {"
+        "                    DataSource = DDB"
+        "                    Type = uint32"
+        "                    NumberOfElements = 131"
+        "                }"
+        "            }";
+
+/**
+ * @brief Configures the application with executionTimeGAMConfig (and the additional parameters) and gets the GAM.
+ */
+static bool GetExecutionTimeGAM(ReferenceT<ExecutionTimeGAMTestGAM> &gam,
+                                const char8 * const parameters = "") {
+    StreamString gamConfig = parameters;
+    gamConfig += executionTimeGAMConfig;
+    bool ok = InitialiseExecutionTimeApplication(gamConfig.Buffer());
+    if (ok) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = gam.IsValid();
+    }
+    return ok;
+}
+
+/**
+ * @brief Executes the GAM with a cycle time of 1000 + (k % 3), GAMB_ReadTime = 5 and GAMB_ExecTime = 5 + k for k = 1...n.
+ */
+static void ExecuteExecutionTimeGAM(ReferenceT<ExecutionTimeGAMTestGAM> &gam,
+                                    const uint32 n) {
+    uint32 *cycleTime = static_cast<uint32 *>(gam->GetInputSignalMemory(0u));
+    uint32 *readTime = static_cast<uint32 *>(gam->GetInputSignalMemory(1u));
+    uint32 *execTime = static_cast<uint32 *>(gam->GetInputSignalMemory(2u));
+    for (uint32 k = 1u; k <= n; k++) {
+        *cycleTime = 1000u + (k % 3u);
+        *readTime = 5u;
+        *execTime = 5u + k;
+        (void) gam->Execute();
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+ExecutionTimeGAMTest::ExecutionTimeGAMTest() {
+}
+
+ExecutionTimeGAMTest::~ExecutionTimeGAMTest() {
+}
+
+bool ExecutionTimeGAMTest::TestConstructor() {
+    ExecutionTimeGAMTestGAM gam;
+    bool ret = (gam.GetNumberOfBins() == 0u);
+    ret &= (gam.GetNumberOfValues(0u) == 0u);
+    ret &= (gam.GetQuantile(0u, 0.5) == 0u);
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestInitialise() {
+    ConfigurationDatabase cdb;
+    bool ret = cdb.Write("SignificantBits", 3u);
+    ret &= cdb.Write("RefreshPeriod", 10u);
+    ExecutionTimeGAMTestGAM gam;
+    if (ret) {
+        ret = gam.Initialise(cdb);
+    }
+    if (ret) {
+        ret = (gam.GetNumberOfBins() == 240u);
+    }
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestInitialise_DefaultValues() {
+    ConfigurationDatabase cdb;
+    ExecutionTimeGAMTestGAM gam;
+    bool ret = gam.Initialise(cdb);
+    if (ret) {
+        ret = (gam.GetNumberOfBins() == 464u);
+    }
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestInitialise_FalseSignificantBits() {
+    bool ret = !InitialiseExecutionTimeGAM("SignificantBits = 0");
+    if (ret) {
+        ret = !InitialiseExecutionTimeGAM("SignificantBits = 11");
+    }
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestInitialise_FalseRefreshPeriod() {
+    return !InitialiseExecutionTimeGAM("RefreshPeriod = 0");
+}
+
+bool ExecutionTimeGAMTest::TestSetup() {
+    ReferenceT<ExecutionTimeGAMTestGAM> gam;
+    bool ret = GetExecutionTimeGAM(gam);
+    if (ret) {
+        ret = (gam->GetNumberOfBins() == 124u);
+        ret &= (gam->GetNumberOfValues(0u) == 0u);
+        ret &= (gam->GetNumberOfValues(2u) == 0u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestSetup_FalseNumberOfOutputSignals() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                GAMB_ReadTime = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                }"
+            "                GAMB_ExecTime = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                Execute = {"
+            "                    DataSource = DDB"
+            "                    Type = uint32"
+            "                    NumberOfElements = 7"
+            "                }"
+            "            }";
+    bool ret = !InitialiseExecutionTimeApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestSetup_FalseInputType() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                GAMB_ExecTime = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint64"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                Execute = {"
+            "                    DataSource = DDB"
+            "                    Type = uint32"
+            "                    NumberOfElements = 7"
+            "                }"
+            "            }";
+    bool ret = !InitialiseExecutionTimeApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestSetup_FalseInputElements() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                GAMB_ExecTime = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                    NumberOfElements = 2"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                Execute = {"
+            "                    DataSource = DDB"
+            "                    Type = uint32"
+            "                    NumberOfElements = 7"
+            "                }"
+            "            }";
+    bool ret = !InitialiseExecutionTimeApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestSetup_FalseOutputType() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                GAMB_ExecTime = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                Execute = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 7"
+            "                }"
+            "            }";
+    bool ret = !InitialiseExecutionTimeApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestSetup_FalseOutputElements() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                GAMB_ExecTime = {"
+            "                    DataSource = Drv1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                Execute = {"
+            "                    DataSource = DDB"
+            "                    Type = uint32"
+            "                    NumberOfElements = 8"
+            "                }"
+            "            }";
+    bool ret = !InitialiseExecutionTimeApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestExecute() {
+    ReferenceT<ExecutionTimeGAMTestGAM> gam;
+    bool ret = GetExecutionTimeGAM(gam);
+    if (ret) {
+        ExecuteExecutionTimeGAM(gam, 1000u);
+        uint32 *cycle = static_cast<uint32 *>(gam->GetOutputSignalMemory(0u));
+        uint32 *input = static_cast<uint32 *>(gam->GetOutputSignalMemory(1u));
+        uint32 *execute = static_cast<uint32 *>(gam->GetOutputSignalMemory(2u));
+        //The CycleTime is accumulated as is
+        ret = (cycle[0u] == 1001u);
+        ret &= (cycle[1u] == 1000u);
+        ret &= (cycle[2u] == 1002u);
+        ret &= (cycle[3u] == 1001u);
+        //The ReadTime is the first timestamp
+        ret &= (input[0u] == 5u);
+        ret &= (input[1u] == 5u);
+        ret &= (input[2u] == 5u);
+        ret &= (input[3u] == 5u);
+        //The ExecTime is accumulated relative to the ReadTime, i.e. 1...1000
+        ret &= (execute[0u] == 1000u);
+        ret &= (execute[1u] == 1u);
+        ret &= (execute[2u] == 1000u);
+        ret &= (execute[3u] == 500u);
+        ret &= (gam->GetNumberOfValues(2u) == 1000u);
+        ret &= (gam->GetMinimum(2u) == 1u);
+        ret &= (gam->GetMaximum(2u) == 1000u);
+        ret &= (gam->GetMean(2u) == 500u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestExecute_Histogram() {
+    ReferenceT<ExecutionTimeGAMTestGAM> gam;
+    bool ret = GetExecutionTimeGAM(gam);
+    if (ret) {
+        ExecuteExecutionTimeGAM(gam, 1000u);
+        uint32 *execute = static_cast<uint32 *>(gam->GetOutputSignalMemory(2u));
+        //With 2 significant bits the quantiles are the upper bounds of bins which are at most 25% wide
+        ret = (execute[4u] == gam->GetQuantile(2u, 0.5));
+        ret &= (execute[4u] >= 500u) && (execute[4u] < 625u);
+        ret &= (execute[5u] == gam->GetQuantile(2u, 0.99));
+        ret &= (execute[5u] >= 990u) && (execute[5u] <= 1000u);
+        ret &= (execute[6u] == 1000u);
+        uint32 sum = 0u;
+        uint32 b;
+        for (b = 0u; (b < gam->GetNumberOfBins()) && (ret); b++) {
+            ret = (execute[7u + b] == gam->GetBinCount(2u, b));
+            sum += execute[7u + b];
+        }
+        if (ret) {
+            ret = (sum == 1000u);
+        }
+        if (ret) {
+            ret = (execute[7u] == 0u);
+            ret &= (execute[8u] == 1u);
+            ret &= (execute[7u + gam->GetBinIndex(600u)] == (gam->GetBinUpperBound(gam->GetBinIndex(600u)) - gam->GetBinUpperBound(gam->GetBinIndex(600u) - 1u)));
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestExecute_RefreshPeriod() {
+    ReferenceT<ExecutionTimeGAMTestGAM> gam;
+    bool ret = GetExecutionTimeGAM(gam, "RefreshPeriod = 4 ");
+    if (ret) {
+        uint32 *execute = static_cast<uint32 *>(gam->GetOutputSignalMemory(2u));
+        ExecuteExecutionTimeGAM(gam, 3u);
+        //Not yet refreshed
+        ret = (execute[6u] == 0u);
+        ret &= (execute[3u] == 2u);
+        if (ret) {
+            ExecuteExecutionTimeGAM(gam, 1u);
+            ret = (execute[6u] == 3u);
+            ret &= (execute[7u + 1u] == 2u);
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestPrepareNextState() {
+    ReferenceT<ExecutionTimeGAMTestGAM> gam;
+    bool ret = GetExecutionTimeGAM(gam);
+    if (ret) {
+        ExecuteExecutionTimeGAM(gam, 10u);
+        ret = gam->PrepareNextState("State1", "State1");
+    }
+    if (ret) {
+        //The statistics are only reset by the next Execute
+        ret = (gam->GetNumberOfValues(0u) == 10u);
+    }
+    if (ret) {
+        ExecuteExecutionTimeGAM(gam, 1u);
+        ret = (gam->GetNumberOfValues(0u) == 1u);
+        ret &= (gam->GetMaximum(2u) == 1u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestPrintStatistics() {
+    ReferenceT<ExecutionTimeGAMTestGAM> gam;
+    bool ret = GetExecutionTimeGAM(gam);
+    if (ret) {
+        ExecuteExecutionTimeGAM(gam, 10u);
+        ret = (gam->PrintStatistics() == ErrorManagement::NoError);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestGetStatistics() {
+    ReferenceT<ExecutionTimeGAMTestGAM> gam;
+    bool ret = GetExecutionTimeGAM(gam);
+    ReferenceContainer message;
+    ReferenceT<ConfigurationDatabase> statistics(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    if (ret) {
+        ret = message.Insert(statistics);
+    }
+    if (ret) {
+        ExecuteExecutionTimeGAM(gam, 1000u);
+        ret = (gam->GetStatistics(message) == ErrorManagement::NoError);
+    }
+    if (ret) {
+        ret = statistics->MoveAbsolute("GAMB_ExecTime");
+    }
+    uint64 nOfValues = 0u;
+    uint32 minimum = 0u;
+    uint32 maximum = 0u;
+    uint32 mean = 0u;
+    uint32 quantile999 = 0u;
+    if (ret) {
+        ret = statistics->Read("NumberOfValues", nOfValues);
+        ret &= statistics->Read("Minimum", minimum);
+        ret &= statistics->Read("Maximum", maximum);
+        ret &= statistics->Read("Mean", mean);
+        ret &= statistics->Read("Quantile999", quantile999);
+    }
+    if (ret) {
+        ret = (nOfValues == 1000u);
+        ret &= (minimum == 1u);
+        ret &= (maximum == 1000u);
+        ret &= (mean == 500u);
+        ret &= (quantile999 == 1000u);
+    }
+    if (ret) {
+        ret = statistics->MoveAbsolute("Thread1_CycleTime");
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestGetStatistics_False() {
+    ReferenceT<ExecutionTimeGAMTestGAM> gam;
+    bool ret = GetExecutionTimeGAM(gam);
+    ReferenceContainer message;
+    if (ret) {
+        ret = (gam->GetStatistics(message) == ErrorManagement::ParametersError);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestResetStatistics() {
+    ReferenceT<ExecutionTimeGAMTestGAM> gam;
+    bool ret = GetExecutionTimeGAM(gam);
+    if (ret) {
+        ExecuteExecutionTimeGAM(gam, 10u);
+        ret = (gam->ResetStatistics() == ErrorManagement::NoError);
+    }
+    if (ret) {
+        ret = (gam->GetNumberOfValues(2u) == 10u);
+    }
+    if (ret) {
+        ExecuteExecutionTimeGAM(gam, 2u);
+        ret = (gam->GetNumberOfValues(2u) == 2u);
+        ret &= (gam->GetMinimum(2u) == 1u);
+        ret &= (gam->GetMaximum(2u) == 2u);
+        ret &= (gam->GetBinCount(2u, 5u) == 0u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestGetBinIndex() {
+    ConfigurationDatabase cdb;
+    bool ret = cdb.Write("SignificantBits", 3u);
+    ExecutionTimeGAMTestGAM gam;
+    if (ret) {
+        ret = gam.Initialise(cdb);
+    }
+    if (ret) {
+        //Width 1 below 16
+        ret = (gam.GetBinIndex(0u) == 0u);
+        ret &= (gam.GetBinIndex(15u) == 15u);
+        //Width 2 between 16 and 31
+        ret &= (gam.GetBinIndex(16u) == 16u);
+        ret &= (gam.GetBinIndex(17u) == 16u);
+        ret &= (gam.GetBinIndex(31u) == 23u);
+        ret &= (gam.GetBinIndex(32u) == 24u);
+        ret &= (gam.GetBinIndex(0xFFFFFFFFu) == (gam.GetNumberOfBins() - 1u));
+    }
+    return ret;
+}
+
+bool ExecutionTimeGAMTest::TestGetBinUpperBound() {
+    ConfigurationDatabase cdb;
+    bool ret = cdb.Write("SignificantBits", 3u);
+    ExecutionTimeGAMTestGAM gam;
+    if (ret) {
+        ret = gam.Initialise(cdb);
+    }
+    if (ret) {
+        ret = (gam.GetBinUpperBound(15u) == 15u);
+        ret &= (gam.GetBinUpperBound(16u) == 17u);
+        ret &= (gam.GetBinUpperBound(23u) == 31u);
+        ret &= (gam.GetBinUpperBound(24u) == 35u);
+        ret &= (gam.GetBinUpperBound(gam.GetNumberOfBins() - 1u) == 0xFFFFFFFFu);
+    }
+    uint32 b;
+    for (b = 1u; (b < gam.GetNumberOfBins()) && (ret); b++) {
+        ret = (gam.GetBinIndex(gam.GetBinUpperBound(b)) == b);
+        ret &= (gam.GetBinIndex(gam.GetBinUpperBound(b - 1u) + 1u) == b);
+    }
+    return ret;
+}
@@ -0,0 +1,164 @@
+/**
+ * @file ExecutionTimeGAMTest.h
+ * @brief Header file for class ExecutionTimeGAMTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ExecutionTimeGAMTest
+
+#ifndef EXECUTIONTIMEGAMTEST_H_
+#define EXECUTIONTIMEGAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ExecutionTimeGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the ExecutionTimeGAM methods
+ */
+class ExecutionTimeGAMTest {
+public:
+
+    /**
+     * @brief Constructor
+     */
+    ExecutionTimeGAMTest();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~ExecutionTimeGAMTest();
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method and the computed number of bins
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests the Initialise method without parameters
+     */
+    bool TestInitialise_DefaultValues();
+
+    /**
+     * @brief Tests that the Initialise method fails with SignificantBits = 0 or > 10
+     */
+    bool TestInitialise_FalseSignificantBits();
+
+    /**
+     * @brief Tests that the Initialise method fails with RefreshPeriod = 0
+     */
+    bool TestInitialise_FalseRefreshPeriod();
+
+    /**
+     * @brief Tests the Setup method
+     */
+    bool TestSetup();
+
+    /**
+     * @brief Tests that the Setup method fails if the number of output signals is not the number of input signals
+     */
+    bool TestSetup_FalseNumberOfOutputSignals();
+
+    /**
+     * @brief Tests that the Setup method fails if an input signal is not uint32
+     */
+    bool TestSetup_FalseInputType();
+
+    /**
+     * @brief Tests that the Setup method fails if an input signal has more than one element
+     */
+    bool TestSetup_FalseInputElements();
+
+    /**
+     * @brief Tests that the Setup method fails if an output signal is not uint32
+     */
+    bool TestSetup_FalseOutputType();
+
+    /**
+     * @brief Tests that the Setup method fails if an output signal has neither 7 nor 7 + GetNumberOfBins() elements
+     */
+    bool TestSetup_FalseOutputElements();
+
+    /**
+     * @brief Tests that the Execute method accumulates the cycle times and the differences of the timestamps
+     */
+    bool TestExecute();
+
+    /**
+     * @brief Tests that the Execute method writes the quantiles and the histogram
+     */
+    bool TestExecute_Histogram();
+
+    /**
+     * @brief Tests that the quantiles and the histogram are only written every RefreshPeriod cycles
+     */
+    bool TestExecute_RefreshPeriod();
+
+    /**
+     * @brief Tests that the PrepareNextState method resets the statistics in the next Execute
+     */
+    bool TestPrepareNextState();
+
+    /**
+     * @brief Tests the PrintStatistics method
+     */
+    bool TestPrintStatistics();
+
+    /**
+     * @brief Tests that the GetStatistics method writes the statistics in the message
+     */
+    bool TestGetStatistics();
+
+    /**
+     * @brief Tests that the GetStatistics method fails if the message does not contain a StructuredDataI
+     */
+    bool TestGetStatistics_False();
+
+    /**
+     * @brief Tests that the ResetStatistics method resets the statistics in the next Execute
+     */
+    bool TestResetStatistics();
+
+    /**
+     * @brief Tests the GetBinIndex method
+     */
+    bool TestGetBinIndex();
+
+    /**
+     * @brief Tests the GetBinUpperBound method
+     */
+    bool TestGetBinUpperBound();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EXECUTIONTIMEGAMTEST_H_ */
@@ -0,0 +1,112 @@
+/**
+ * @file FastFourierTransformTest.cpp
+ * @brief Source file for class FastFourierTransformTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FastFourierTransformTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "math.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "FastFourierTransform.h"
+#include "FastFourierTransformTest.h"
+#include "FastMath.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool FastFourierTransformTest::TestSetSize() {
+    using namespace MARTe;
+    FastFourierTransform fft;
+    bool ok = (fft.GetSize() == 0u);
+    ok &= !fft.SetSize(0u);
+    ok &= !fft.SetSize(1u);
+    ok &= !fft.SetSize(12u);
+    ok &= fft.SetSize(16u);
+    ok &= (fft.GetSize() == 16u);
+    ok &= fft.SetSize(2u);
+    ok &= (fft.GetSize() == 2u);
+    return ok;
+}
+
+bool FastFourierTransformTest::TestNextPowerOf2() {
+    using namespace MARTe;
+    bool ok = (FastFourierTransform::NextPowerOf2(1u) == 1u);
+    ok &= (FastFourierTransform::NextPowerOf2(2u) == 2u);
+    ok &= (FastFourierTransform::NextPowerOf2(3u) == 4u);
+    ok &= (FastFourierTransform::NextPowerOf2(129u) == 256u);
+    ok &= (FastFourierTransform::NextPowerOf2(1024u) == 1024u);
+    return ok;
+}
+
+bool FastFourierTransformTest::TestForward() {
+    using namespace MARTe;
+    const uint32 size = 32u;
+    float64 re[size];
+    float64 im[size];
+    float64 x[size];
+    FastFourierTransform fft;
+    bool ok = fft.SetSize(size);
+    for (uint32 n = 0u; n < size; n++) {
+        x[n] = sin(0.3 * n) + (0.1 * n);
+        re[n] = x[n];
+        im[n] = 0.0;
+    }
+    fft.Forward(re, im);
+    for (uint32 k = 0u; (k < size) && (ok); k++) {
+        float64 dftRe = 0.0;
+        float64 dftIm = 0.0;
+        for (uint32 n = 0u; n < size; n++) {
+            float64 angle = (-2.0 * FastMath::PI * k * n) / size;
+            dftRe += x[n] * cos(angle);
+            dftIm += x[n] * sin(angle);
+        }
+        ok = ((fabs(re[k] - dftRe) < 1e-9) && (fabs(im[k] - dftIm) < 1e-9));
+    }
+    return ok;
+}
+
+bool FastFourierTransformTest::TestInverse() {
+    using namespace MARTe;
+    const uint32 size = 64u;
+    float64 re[size];
+    float64 im[size];
+    FastFourierTransform fft;
+    bool ok = fft.SetSize(size);
+    for (uint32 n = 0u; n < size; n++) {
+        re[n] = cos(0.2 * n);
+        im[n] = 0.5 * n;
+    }
+    fft.Forward(re, im);
+    fft.Inverse(re, im);
+    for (uint32 n = 0u; (n < size) && (ok); n++) {
+        ok = ((fabs(re[n] - cos(0.2 * n)) < 1e-9) && (fabs(im[n] - (0.5 * n)) < 1e-9));
+    }
+    return ok;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file FastFourierTransformTest.h
+ * @brief Header file for class FastFourierTransformTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FastFourierTransformTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_COMPONENTS_GAMS_FILTERGAM_FASTFOURIERTRANSFORMTEST_H_
+#define TEST_COMPONENTS_GAMS_FILTERGAM_FASTFOURIERTRANSFORMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Test class for FastFourierTransform
+ */
+class FastFourierTransformTest {
+public:
+
+    /**
+     * @brief Tests that SetSize() accepts powers of 2 and rejects any other size.
+     */
+    bool TestSetSize();
+
+    /**
+     * @brief Tests NextPowerOf2().
+     */
+    bool TestNextPowerOf2();
+
+    /**
+     * @brief Tests Forward() against a direct computation of the DFT.
+     */
+    bool TestForward();
+
+    /**
+     * @brief Tests that Inverse() recovers the signal transformed with Forward().
+     */
+    bool TestInverse();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_COMPONENTS_GAMS_FILTERGAM_FASTFOURIERTRANSFORMTEST_H_ */
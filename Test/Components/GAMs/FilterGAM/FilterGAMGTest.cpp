@@ -284,6 +284,216 @@ TEST(FilterGAMGTest,TestResetOnlyWhenRequiredMemoryNotInit) {
     ASSERT_TRUE(test.TestResetOnlyWhenRequiredMemoryNotInit());
 }
 
+TEST(FilterGAMGTest,TestInitialiseWrongExecutionMode) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongExecutionMode());
+}
+
+TEST(FilterGAMGTest,TestExecuteLanesFIR) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteLanesFIR());
+}
+
+TEST(FilterGAMGTest,TestExecuteLanesIIR) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteLanesIIR());
+}
+
+TEST(FilterGAMGTest,TestExecuteLanesShortArrays) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteLanesShortArrays());
+}
+
+TEST(FilterGAMGTest,TestExecuteLanesReset) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteLanesReset());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOS) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOS());
+}
+
+TEST(FilterGAMGTest,TestInitialiseWrongStructure) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongStructure());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOSWrongNumberOfCoefficients) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOSWrongNumberOfCoefficients());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOSNoSOS) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOSNoSOS());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOSNotNormalised) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOSNotNormalised());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOSLanes) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOSLanes());
+}
+
+TEST(FilterGAMGTest,TestExecuteSOSSingleSection) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSOSSingleSection());
+}
+
+TEST(FilterGAMGTest,TestExecuteSOSCascade) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSOSCascade());
+}
+
+TEST(FilterGAMGTest,TestInitialiseWrongFIREngine) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongFIREngine());
+}
+
+TEST(FilterGAMGTest,TestInitialiseOverlapSaveIIR) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseOverlapSaveIIR());
+}
+
+TEST(FilterGAMGTest,TestInitialiseOverlapSaveLanes) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseOverlapSaveLanes());
+}
+
+TEST(FilterGAMGTest,TestExecuteOverlapSave) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteOverlapSave());
+}
+
+TEST(FilterGAMGTest,TestExecuteOverlapSaveOddSignals) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteOverlapSaveOddSignals());
+}
+
+TEST(FilterGAMGTest,TestExecuteOverlapSaveShortArrays) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteOverlapSaveShortArrays());
+}
+
+TEST(FilterGAMGTest,TestSetupAutoCrossover) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestSetupAutoCrossover());
+}
+
+TEST(FilterGAMGTest,TestSetupAutoBenchmark) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestSetupAutoBenchmark());
+}
+
+TEST(FilterGAMGTest,TestSetupAutoIIR) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestSetupAutoIIR());
+}
+
+TEST(FilterGAMGTest,TestExecuteInt16Input) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteInt16Input());
+}
+
+TEST(FilterGAMGTest,TestExecuteInt32InputFloat64Output) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteInt32InputFloat64Output());
+}
+
+TEST(FilterGAMGTest,TestExecuteFloat64Input) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteFloat64Input());
+}
+
+TEST(FilterGAMGTest,TestExecuteLanesInt16Input) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteLanesInt16Input());
+}
+
+TEST(FilterGAMGTest,TestExecuteSOSInt16Input) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSOSInt16Input());
+}
+
+TEST(FilterGAMGTest,TestSetupWrongOutputType) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestSetupWrongOutputType());
+}
+
+TEST(FilterGAMGTest,TestInitialiseWrongNumberOfWorkers) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongNumberOfWorkers());
+}
+
+TEST(FilterGAMGTest,TestExecuteWorkers) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteWorkers());
+}
+
+TEST(FilterGAMGTest,TestExecuteWorkersMoreThanSignals) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteWorkersMoreThanSignals());
+}
+
+TEST(FilterGAMGTest,TestExecuteLanesWorkers) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteLanesWorkers());
+}
+
+TEST(FilterGAMGTest,TestExecuteOverlapSaveWorkers) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteOverlapSaveWorkers());
+}
+
+TEST(FilterGAMGTest,TestExecuteSOSWorkers) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSOSWorkers());
+}
+
+TEST(FilterGAMGTest,TestLoadCoefficients) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestLoadCoefficients());
+}
+
+TEST(FilterGAMGTest,TestLoadCoefficientsWrongNumberOfCoefficients) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestLoadCoefficientsWrongNumberOfCoefficients());
+}
+
+TEST(FilterGAMGTest,TestLoadCoefficientsNotNormalised) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestLoadCoefficientsNotNormalised());
+}
+
+TEST(FilterGAMGTest,TestLoadCoefficientsBeforeSetup) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestLoadCoefficientsBeforeSetup());
+}
+
+TEST(FilterGAMGTest,TestLoadCoefficientsPending) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestLoadCoefficientsPending());
+}
+
+TEST(FilterGAMGTest,TestLoadCoefficientsTransferSOS) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestLoadCoefficientsTransferSOS());
+}
+
+TEST(FilterGAMGTest,TestLoadCoefficientsTransferInfiniteGain) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestLoadCoefficientsTransferInfiniteGain());
+}
+
+TEST(FilterGAMGTest,TestLoadCoefficientsOverlapSave) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestLoadCoefficientsOverlapSave());
+}
+
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
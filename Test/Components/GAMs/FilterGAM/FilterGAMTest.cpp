@@ -33,6 +33,7 @@
 
 #include "ConfigurationDatabase.h"
 #include "FilterGAM.h"
+#include "MemoryOperationsHelper.h"
 #include "FilterGAMTest.h"
 #include "Vector.h"
 #include "stdio.h"
@@ -147,9 +148,160 @@ FilterGAMTestHelper    (MARTe::uint32 elements=10, MARTe::uint32 samples=1) {
         return ret;
     }
 
+    bool InitialiseFilter(const MARTe::float32 * const numIn, const MARTe::uint32 numberOfNum, const MARTe::float32 * const denIn, const MARTe::uint32 numberOfDen) {
+        bool ret = true;
+        if(isInitialised == false) {
+            numH = new MARTe::float32[numberOfNum];
+            for (MARTe::uint32 i = 0u; i < numberOfNum; i++) {
+                numH[i] = numIn[i];
+            }
+            denH = new MARTe::float32[numberOfDen];
+            for (MARTe::uint32 i = 0u; i < numberOfDen; i++) {
+                denH[i] = denIn[i];
+            }
+            MARTe::Vector<MARTe::float32> numVec(numH, numberOfNum);
+            MARTe::Vector<MARTe::float32> denVec(denH, numberOfDen);
+            ret &= config.Write("Num", numVec);
+            ret &= config.Write("Den", denVec);
+            ret &= config.Write("ResetInEachState", 0);
+            isInitialised = ret;
+        }
+        else {
+            ret = false;
+        }
+        return ret;
+    }
+
+    bool InitialiseFilterSOS(MARTe::float64 * const sosIn, const MARTe::uint32 numberOfSections, const MARTe::float64 gain) {
+        bool ret = true;
+        if(isInitialised == false) {
+            MARTe::Matrix<MARTe::float64> sosMat(sosIn, numberOfSections, 6u);
+            ret &= config.Write("Structure", "SOS");
+            ret &= config.Write("SOS", sosMat);
+            ret &= config.Write("Gain", gain);
+            ret &= config.Write("ResetInEachState", 0);
+            isInitialised = ret;
+        }
+        else {
+            ret = false;
+        }
+        return ret;
+    }
+
     bool IsInitialised() {
         return isInitialised;
     }
+
+    bool InitialiseConfigDataBaseSignalN(MARTe::uint32 numberOfSignals) {
+        using namespace MARTe;
+        bool ok = true;
+        uint32 totalByteSize = byteSize * numberOfSignals;
+        uint32 numberOfOutputElements = (numberOfSamples > numberOfElements) ? numberOfSamples : numberOfElements;
+        for (uint32 s = 0u; s < numberOfSignals; s++) {
+            StreamString signalIdx;
+            signalIdx.Printf("%u", s);
+            StreamString signalName;
+            signalName.Printf("InputSignal%u", s);
+            ok &= configSignals.MoveToRoot();
+            if (s == 0u) {
+                ok &= configSignals.CreateAbsolute("Signals.InputSignals");
+            }
+            else {
+                ok &= configSignals.MoveAbsolute("Signals.InputSignals");
+            }
+            ok &= configSignals.CreateRelative(signalIdx.Buffer());
+            ok &= configSignals.Write("QualifiedName", signalName.Buffer());
+            ok &= configSignals.Write("DataSource", "TestDataSource");
+            ok &= configSignals.Write("Type", "float32");
+            ok &= configSignals.Write("NumberOfDimensions", 1);
+            ok &= configSignals.Write("NumberOfElements", numberOfElements);
+            ok &= configSignals.Write("ByteSize", byteSize);
+        }
+        ok &= configSignals.MoveAbsolute("Signals.InputSignals");
+        ok &= configSignals.Write("ByteSize", totalByteSize);
+        for (uint32 s = 0u; s < numberOfSignals; s++) {
+            StreamString signalIdx;
+            signalIdx.Printf("%u", s);
+            StreamString signalName;
+            signalName.Printf("OutputSignal%u", s);
+            ok &= configSignals.MoveToRoot();
+            if (s == 0u) {
+                ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
+            }
+            else {
+                ok &= configSignals.MoveAbsolute("Signals.OutputSignals");
+            }
+            ok &= configSignals.CreateRelative(signalIdx.Buffer());
+            ok &= configSignals.Write("QualifiedName", signalName.Buffer());
+            ok &= configSignals.Write("DataSource", "TestDataSource");
+            ok &= configSignals.Write("Type", "float32");
+            ok &= configSignals.Write("NumberOfDimensions", 1);
+            ok &= configSignals.Write("NumberOfElements", numberOfOutputElements);
+            ok &= configSignals.Write("ByteSize", byteSize);
+        }
+        ok &= configSignals.MoveAbsolute("Signals.OutputSignals");
+        ok &= configSignals.Write("ByteSize", totalByteSize);
+        ok &= configSignals.MoveToRoot();
+
+        ok &= configSignals.CreateAbsolute("Memory.InputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.CreateRelative("Signals");
+        for (uint32 s = 0u; s < numberOfSignals; s++) {
+            StreamString signalIdx;
+            signalIdx.Printf("%u", s);
+            ok &= configSignals.CreateRelative(signalIdx.Buffer());
+            ok &= configSignals.Write("Samples", numberOfSamples);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+        ok &= configSignals.CreateAbsolute("Memory.OutputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.CreateRelative("Signals");
+        for (uint32 s = 0u; s < numberOfSignals; s++) {
+            StreamString signalIdx;
+            signalIdx.Printf("%u", s);
+            ok &= configSignals.CreateRelative(signalIdx.Buffer());
+            ok &= configSignals.Write("Samples", 1);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+        ok &= configSignals.MoveToRoot();
+        return ok;
+    }
+    bool InitialiseConfigDataBaseSignalType(const MARTe::char8 * const inputType, const MARTe::uint32 inputTypeSize, const MARTe::char8 * const outputType,
+                                            const MARTe::uint32 outputTypeSize) {
+        bool ok = true;
+        MARTe::uint32 inputByteSize = numberOfElements * inputTypeSize;
+        MARTe::uint32 outputByteSize = numberOfElements * outputTypeSize;
+        ok &= configSignals.CreateAbsolute("Signals.InputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("QualifiedName", "InputSignal1");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.Write("Type", inputType);
+        ok &= configSignals.Write("NumberOfDimensions", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
+        ok &= configSignals.Write("ByteSize", inputByteSize);
+
+        ok &= configSignals.MoveToAncestor(1u);
+        ok &= configSignals.Write("ByteSize", inputByteSize);
+
+        ok &= configSignals.MoveToRoot();
+        ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("QualifiedName", "OutputSignal1");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.Write("Type", outputType);
+        ok &= configSignals.Write("NumberOfDimensions", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
+        ok &= configSignals.Write("ByteSize", outputByteSize);
+
+        ok &= configSignals.MoveToAncestor(1u);
+        ok &= configSignals.Write("ByteSize", outputByteSize);
+
+        ok &= configSignals.MoveToRoot();
+        return ok;
+    }
+
     bool InitialiseConfigDataBaseSignal1() {
         bool ok = true;
         MARTe::uint32 totalByteSize = byteSize;
@@ -411,6 +563,281 @@ private:
 };
 CLASS_REGISTER(FilterGAMTestHelper, "1.0")
 
+/**
+ * Filters a full input stream (starting from zero states) with the same sequence of operations of the FilterGAM.
+ */
+static void FilterGAMTestReference(const MARTe::float32 * const numIn, const MARTe::uint32 numberOfNum, const MARTe::float32 * const denIn,
+                                   const MARTe::uint32 numberOfDen, const MARTe::float32 * const x, MARTe::float32 * const y,
+                                   const MARTe::uint32 numberOfSamples) {
+    using namespace MARTe;
+    for (uint32 n = 0u; n < numberOfSamples; n++) {
+        float32 accumulator = 0.0F;
+        for (uint32 k = 0u; k < numberOfNum; k++) {
+            float32 xk = (n >= k) ? x[n - k] : 0.0F;
+            accumulator += xk * numIn[k];
+        }
+        for (uint32 k = 1u; k < numberOfDen; k++) {
+            float32 yk = (n >= k) ? y[n - k] : 0.0F;
+            accumulator -= yk * denIn[k];
+        }
+        y[n] = accumulator;
+    }
+}
+
+/**
+ * Runs the same filter in Scalar and in Lanes mode, over several cycles, and checks that the outputs are bit-for-bit identical
+ * and equal to the FilterGAMTestReference.
+ */
+static bool FilterGAMTestCompareLanes(const MARTe::uint32 numberOfSignals, const MARTe::uint32 numberOfElements, const MARTe::float32 * const numIn,
+                                      const MARTe::uint32 numberOfNum, const MARTe::float32 * const denIn, const MARTe::uint32 numberOfDen) {
+    using namespace MARTe;
+    const uint32 numberOfCycles = 4u;
+    FilterGAMTestHelper gamScalar(numberOfElements);
+    FilterGAMTestHelper gamLanes(numberOfElements);
+    gamScalar.SetName("Scalar");
+    gamLanes.SetName("Lanes");
+    bool ok = gamScalar.InitialiseFilter(numIn, numberOfNum, denIn, numberOfDen);
+    ok &= gamLanes.InitialiseFilter(numIn, numberOfNum, denIn, numberOfDen);
+    ok &= gamLanes.config.Write("ExecutionMode", "Lanes");
+    ok &= gamScalar.Initialise(gamScalar.config);
+    ok &= gamLanes.Initialise(gamLanes.config);
+    ok &= !gamScalar.IsLaneExecution();
+    ok &= gamLanes.IsLaneExecution();
+    ok &= gamScalar.InitialiseConfigDataBaseSignalN(numberOfSignals);
+    ok &= gamLanes.InitialiseConfigDataBaseSignalN(numberOfSignals);
+    ok &= gamScalar.SetConfiguredDatabase(gamScalar.configSignals);
+    ok &= gamLanes.SetConfiguredDatabase(gamLanes.configSignals);
+    ok &= gamScalar.AllocateInputSignalsMemory();
+    ok &= gamScalar.AllocateOutputSignalsMemory();
+    ok &= gamLanes.AllocateInputSignalsMemory();
+    ok &= gamLanes.AllocateOutputSignalsMemory();
+    ok &= gamScalar.Setup();
+    ok &= gamLanes.Setup();
+    uint32 totalSamples = numberOfCycles * numberOfElements;
+    float32 *x = new float32[numberOfSignals * totalSamples];
+    float32 *y = new float32[numberOfSignals * totalSamples];
+    for (uint32 s = 0u; s < numberOfSignals; s++) {
+        for (uint32 n = 0u; n < totalSamples; n++) {
+            x[(s * totalSamples) + n] = static_cast<float32>(sin(0.1 * (n + 1)) * (s + 1));
+        }
+        FilterGAMTestReference(numIn, numberOfNum, denIn, numberOfDen, &x[s * totalSamples], &y[s * totalSamples], totalSamples);
+    }
+    for (uint32 c = 0u; (c < numberOfCycles) && (ok); c++) {
+        for (uint32 s = 0u; s < numberOfSignals; s++) {
+            float32 *inScalar = static_cast<float32 *>(gamScalar.GetInputSignalsMemory(s));
+            float32 *inLanes = static_cast<float32 *>(gamLanes.GetInputSignalsMemory(s));
+            for (uint32 n = 0u; n < numberOfElements; n++) {
+                inScalar[n] = x[(s * totalSamples) + (c * numberOfElements) + n];
+                inLanes[n] = inScalar[n];
+            }
+        }
+        ok &= gamScalar.Execute();
+        ok &= gamLanes.Execute();
+        for (uint32 s = 0u; (s < numberOfSignals) && (ok); s++) {
+            float32 *outScalar = static_cast<float32 *>(gamScalar.GetOutputSignalsMemory(s));
+            float32 *outLanes = static_cast<float32 *>(gamLanes.GetOutputSignalsMemory(s));
+            uint32 size = numberOfElements * static_cast<uint32>(sizeof(float32));
+            ok = (MemoryOperationsHelper::Compare(outScalar, outLanes, size) == 0);
+            if (ok) {
+                ok = (MemoryOperationsHelper::Compare(outScalar, &y[(s * totalSamples) + (c * numberOfElements)], size) == 0);
+            }
+        }
+    }
+    delete[] x;
+    delete[] y;
+    return ok;
+}
+
+/**
+ * Filters, over several cycles, a signal of type InputType into a signal of type OutputType and checks that the output
+ * is equal to the FilterGAMTestReference computed on the input converted to float32.
+ */
+template<typename InputType, typename OutputType>
+static bool FilterGAMTestCompareTypes(const MARTe::char8 * const inputTypeName, const MARTe::char8 * const outputTypeName, const MARTe::char8 * const executionMode) {
+    using namespace MARTe;
+    const uint32 numberOfCycles = 4u;
+    const uint32 numberOfElements = 10u;
+    float32 numIn[] = { 0.0675F, 0.1349F, 0.0675F };
+    float32 denIn[] = { 1.0F, -1.1430F, 0.4128F };
+    FilterGAMTestHelper gam(numberOfElements);
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilter(numIn, 3u, denIn, 3u);
+    ok &= gam.config.Write("ExecutionMode", executionMode);
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignalType(inputTypeName, static_cast<uint32>(sizeof(InputType)), outputTypeName, static_cast<uint32>(sizeof(OutputType)));
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    uint32 totalSamples = numberOfCycles * numberOfElements;
+    float32 *x = new float32[totalSamples];
+    float32 *y = new float32[totalSamples];
+    InputType *gamMemoryIn = static_cast<InputType *>(gam.GetInputSignalsMemory());
+    OutputType *gamMemoryOut = static_cast<OutputType *>(gam.GetOutputSignalsMemory());
+    for (uint32 n = 0u; n < totalSamples; n++) {
+        x[n] = static_cast<float32>(static_cast<InputType>(1000.0 * sin(0.3 * (n + 1))));
+    }
+    FilterGAMTestReference(numIn, 3u, denIn, 3u, x, y, totalSamples);
+    for (uint32 c = 0u; (c < numberOfCycles) && (ok); c++) {
+        for (uint32 n = 0u; n < numberOfElements; n++) {
+            gamMemoryIn[n] = static_cast<InputType>(x[(c * numberOfElements) + n]);
+        }
+        ok = gam.Execute();
+        for (uint32 n = 0u; (n < numberOfElements) && (ok); n++) {
+            ok = (gamMemoryOut[n] == static_cast<OutputType>(y[(c * numberOfElements) + n]));
+        }
+    }
+    delete[] x;
+    delete[] y;
+    return ok;
+}
+
+/**
+ * Runs the same FIR filter with FIREngine = Direct and with the given FIREngine, over several cycles (with a reset in the middle),
+ * and checks that the outputs are equal within the float32 precision.
+ */
+static bool FilterGAMTestCompareOverlapSave(const MARTe::uint32 numberOfSignals, const MARTe::uint32 numberOfElements, const MARTe::uint32 numberOfNum,
+                                            const MARTe::char8 * const engine, const bool expectOverlapSave) {
+    using namespace MARTe;
+    const uint32 numberOfCycles = 6u;
+    float32 *numIn = new float32[numberOfNum];
+    float32 denIn[] = { 1.0F };
+    for (uint32 k = 0u; k < numberOfNum; k++) {
+        numIn[k] = static_cast<float32>((1.0 + (0.3 * sin(static_cast<float64>(k)))) / numberOfNum);
+    }
+    FilterGAMTestHelper gamDirect(numberOfElements);
+    FilterGAMTestHelper gamOverlapSave(numberOfElements);
+    gamDirect.SetName("Direct");
+    gamOverlapSave.SetName("OverlapSave");
+    bool ok = gamDirect.InitialiseFilter(numIn, numberOfNum, denIn, 1u);
+    ok &= gamOverlapSave.InitialiseFilter(numIn, numberOfNum, denIn, 1u);
+    ok &= gamOverlapSave.config.Write("FIREngine", engine);
+    ok &= gamDirect.Initialise(gamDirect.config);
+    ok &= gamOverlapSave.Initialise(gamOverlapSave.config);
+    ok &= gamDirect.InitialiseConfigDataBaseSignalN(numberOfSignals);
+    ok &= gamOverlapSave.InitialiseConfigDataBaseSignalN(numberOfSignals);
+    ok &= gamDirect.SetConfiguredDatabase(gamDirect.configSignals);
+    ok &= gamOverlapSave.SetConfiguredDatabase(gamOverlapSave.configSignals);
+    ok &= gamDirect.AllocateInputSignalsMemory();
+    ok &= gamDirect.AllocateOutputSignalsMemory();
+    ok &= gamOverlapSave.AllocateInputSignalsMemory();
+    ok &= gamOverlapSave.AllocateOutputSignalsMemory();
+    ok &= gamDirect.Setup();
+    ok &= gamOverlapSave.Setup();
+    ok &= !gamDirect.IsOverlapSave();
+    ok &= (gamOverlapSave.IsOverlapSave() == expectOverlapSave);
+    for (uint32 c = 0u; (c < numberOfCycles) && (ok); c++) {
+        if (c == (numberOfCycles / 2u)) {
+            ok &= gamDirect.PrepareNextState("A", "B");
+            ok &= gamOverlapSave.PrepareNextState("A", "B");
+        }
+        for (uint32 s = 0u; s < numberOfSignals; s++) {
+            float32 *inDirect = static_cast<float32 *>(gamDirect.GetInputSignalsMemory(s));
+            float32 *inOverlapSave = static_cast<float32 *>(gamOverlapSave.GetInputSignalsMemory(s));
+            for (uint32 n = 0u; n < numberOfElements; n++) {
+                inDirect[n] = static_cast<float32>(sin(0.1 * ((c * numberOfElements) + n + 1u)) * (s + 1u));
+                inOverlapSave[n] = inDirect[n];
+            }
+        }
+        ok &= gamDirect.Execute();
+        ok &= gamOverlapSave.Execute();
+        for (uint32 s = 0u; (s < numberOfSignals) && (ok); s++) {
+            float32 *outDirect = static_cast<float32 *>(gamDirect.GetOutputSignalsMemory(s));
+            float32 *outOverlapSave = static_cast<float32 *>(gamOverlapSave.GetOutputSignalsMemory(s));
+            for (uint32 n = 0u; (n < numberOfElements) && (ok); n++) {
+                ok = (fabs(outDirect[n] - outOverlapSave[n]) < 1e-5);
+            }
+        }
+    }
+    delete[] numIn;
+    return ok;
+}
+
+/**
+ * Runs the same filter without and with NumberOfWorkers helper threads, over several cycles (with a reset in the middle),
+ * and checks that the outputs are bit-for-bit identical.
+ */
+static bool FilterGAMTestCompareWorkers(const MARTe::uint32 numberOfSignals, const MARTe::uint32 numberOfElements, const MARTe::float32 * const numIn,
+                                        const MARTe::uint32 numberOfNum, const MARTe::float32 * const denIn, const MARTe::uint32 numberOfDen,
+                                        const MARTe::char8 * const executionMode, const MARTe::char8 * const engine, const MARTe::uint32 numberOfWorkers) {
+    using namespace MARTe;
+    const uint32 numberOfCycles = 6u;
+    FilterGAMTestHelper gamSingle(numberOfElements);
+    FilterGAMTestHelper gamWorkers(numberOfElements);
+    gamSingle.SetName("Single");
+    gamWorkers.SetName("Workers");
+    bool ok = gamSingle.InitialiseFilter(numIn, numberOfNum, denIn, numberOfDen);
+    ok &= gamWorkers.InitialiseFilter(numIn, numberOfNum, denIn, numberOfDen);
+    ok &= gamSingle.config.Write("ExecutionMode", executionMode);
+    ok &= gamWorkers.config.Write("ExecutionMode", executionMode);
+    ok &= gamSingle.config.Write("FIREngine", engine);
+    ok &= gamWorkers.config.Write("FIREngine", engine);
+    ok &= gamWorkers.config.Write("NumberOfWorkers", numberOfWorkers);
+    ok &= gamSingle.Initialise(gamSingle.config);
+    ok &= gamWorkers.Initialise(gamWorkers.config);
+    ok &= (gamSingle.GetNumberOfWorkers() == 0u);
+    ok &= (gamWorkers.GetNumberOfWorkers() == numberOfWorkers);
+    ok &= gamSingle.InitialiseConfigDataBaseSignalN(numberOfSignals);
+    ok &= gamWorkers.InitialiseConfigDataBaseSignalN(numberOfSignals);
+    ok &= gamSingle.SetConfiguredDatabase(gamSingle.configSignals);
+    ok &= gamWorkers.SetConfiguredDatabase(gamWorkers.configSignals);
+    ok &= gamSingle.AllocateInputSignalsMemory();
+    ok &= gamSingle.AllocateOutputSignalsMemory();
+    ok &= gamWorkers.AllocateInputSignalsMemory();
+    ok &= gamWorkers.AllocateOutputSignalsMemory();
+    ok &= gamSingle.Setup();
+    ok &= gamWorkers.Setup();
+    for (uint32 c = 0u; (c < numberOfCycles) && (ok); c++) {
+        if (c == (numberOfCycles / 2u)) {
+            ok &= gamSingle.PrepareNextState("A", "B");
+            ok &= gamWorkers.PrepareNextState("A", "B");
+        }
+        for (uint32 s = 0u; s < numberOfSignals; s++) {
+            float32 *inSingle = static_cast<float32 *>(gamSingle.GetInputSignalsMemory(s));
+            float32 *inWorkers = static_cast<float32 *>(gamWorkers.GetInputSignalsMemory(s));
+            for (uint32 n = 0u; n < numberOfElements; n++) {
+                inSingle[n] = static_cast<float32>(sin(0.1 * ((c * numberOfElements) + n + 1u)) * (s + 1u));
+                inWorkers[n] = inSingle[n];
+            }
+        }
+        ok &= gamSingle.Execute();
+        ok &= gamWorkers.Execute();
+        for (uint32 s = 0u; (s < numberOfSignals) && (ok); s++) {
+            float32 *outSingle = static_cast<float32 *>(gamSingle.GetOutputSignalsMemory(s));
+            float32 *outWorkers = static_cast<float32 *>(gamWorkers.GetOutputSignalsMemory(s));
+            ok = (MemoryOperationsHelper::Compare(outSingle, outWorkers, numberOfElements * static_cast<uint32>(sizeof(float32))) == 0);
+        }
+    }
+    return ok;
+}
+
+/**
+ * Stages a new set of coefficients with the LoadCoefficients RPC.
+ */
+static bool FilterGAMTestLoadCoefficients(FilterGAMTestHelper &gam, MARTe::ReferenceT<MARTe::ConfigurationDatabase> coefficients) {
+    using namespace MARTe;
+    ReferenceContainer message;
+    bool ok = message.Insert(coefficients);
+    if (ok) {
+        ok = gam.LoadCoefficients(message).ErrorsCleared();
+    }
+    return ok;
+}
+
+/**
+ * Creates the Num and Den of LoadCoefficients.
+ */
+static MARTe::ReferenceT<MARTe::ConfigurationDatabase> FilterGAMTestCoefficients(MARTe::float32 * const numIn, const MARTe::uint32 numberOfNum,
+                                                                                 MARTe::float32 * const denIn, const MARTe::uint32 numberOfDen) {
+    using namespace MARTe;
+    ReferenceT<ConfigurationDatabase> coefficients(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    Vector<float32> numVec(numIn, numberOfNum);
+    Vector<float32> denVec(denIn, numberOfDen);
+    (void) coefficients->Write("Num", numVec);
+    (void) coefficients->Write("Den", denVec);
+    return coefficients;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -2828,3 +3255,782 @@ bool FilterGAMTest::TestResetOnlyWhenRequiredMemoryNotInit() {
     return ok;
 }
 
+
+bool FilterGAMTest::TestInitialiseWrongExecutionMode() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.config.Write("ExecutionMode", "Vector");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteLanesFIR() {
+    using namespace MARTe;
+    float32 numIn[] = { 0.1F, 0.2F, 0.3F, 0.25F, 0.15F };
+    float32 denIn[] = { 1.0F };
+    return FilterGAMTestCompareLanes(11u, 10u, numIn, 5u, denIn, 1u);
+}
+
+bool FilterGAMTest::TestExecuteLanesIIR() {
+    using namespace MARTe;
+    float32 numIn[] = { 0.0675F, 0.1349F, 0.0675F };
+    float32 denIn[] = { 1.0F, -1.1430F, 0.4128F };
+    return FilterGAMTestCompareLanes(16u, 20u, numIn, 3u, denIn, 3u);
+}
+
+bool FilterGAMTest::TestExecuteLanesShortArrays() {
+    using namespace MARTe;
+    float32 numIn[] = { 0.2F, 0.2F, 0.2F, 0.2F, 0.2F, 0.2F };
+    float32 denIn[] = { 1.0F, -0.5F, 0.1F, -0.05F };
+    return FilterGAMTestCompareLanes(3u, 2u, numIn, 6u, denIn, 4u);
+}
+
+bool FilterGAMTest::TestExecuteLanesReset() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterIIR();
+    ok &= gam.config.Write("ExecutionMode", "Lanes");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignal2();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+
+    float32 *gamMemoryIn0 = static_cast<float32 *>(gam.GetInputSignalsMemory());
+    float32 *gamMemoryOut0 = static_cast<float32 *>(gam.GetOutputSignalsMemory());
+    float32 *gamMemoryIn1 = static_cast<float32 *>(gam.GetInputSignalsMemory(1));
+    float32 *gamMemoryOut1 = static_cast<float32 *>(gam.GetOutputSignalsMemory(1));
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        gamMemoryIn0[i] = 1;
+        gamMemoryIn1[i] = 2;
+    }
+    if (ok) {
+        ok = gam.PrepareNextState("", "A");
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    for (uint32 i = 0u; (i < gam.numberOfElements) && (ok); i++) {
+        ok = (gamMemoryOut0[i] == i + 1.0F);
+        ok &= (gamMemoryOut1[i] == 2.0F * (i + 1.0F));
+    }
+    //The filter was not executed in state C. It must be reset.
+    if (ok) {
+        ok = gam.PrepareNextState("C", "D");
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    for (uint32 i = 0u; (i < gam.numberOfElements) && (ok); i++) {
+        ok = (gamMemoryOut0[i] == i + 1.0F);
+        ok &= (gamMemoryOut1[i] == 2.0F * (i + 1.0F));
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOS() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    float64 sosH[] = { 0.0675, 0.1349, 0.0675, 1.0, -1.1430, 0.4128, 1.0, 2.0, 1.0, 1.0, -1.5, 0.8 };
+    bool ok = gam.InitialiseFilterSOS(sosH, 2u, 0.5);
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.IsSecondOrderSections();
+    ok &= (gam.GetNumberOfSections() == 2u);
+    ok &= (gam.GetNumberOfNumCoeff() == 0u);
+    ok &= (gam.GetNumberOfDenCoeff() == 0u);
+    ok &= gam.CheckNormalisation();
+    float64 sosRead[12];
+    ok &= gam.GetSOSCoeff(&sosRead[0]);
+    for (uint32 i = 0u; (i < 12u) && (ok); i++) {
+        ok = (sosRead[i] == sosH[i]);
+    }
+    bool isInfinite;
+    float64 expectedGain = 0.5 * ((0.0675 + 0.1349 + 0.0675) / (1.0 - 1.1430 + 0.4128)) * ((1.0 + 2.0 + 1.0) / (1.0 - 1.5 + 0.8));
+    float32 staticGain = gam.GetStaticGain(isInfinite);
+    ok &= (!isInfinite);
+    ok &= (staticGain == static_cast<float32>(expectedGain));
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseWrongStructure() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.config.Write("Structure", "Lattice");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOSWrongNumberOfCoefficients() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    float64 sosH[] = { 1.0, 2.0, 1.0, 1.0, -1.5 };
+    Matrix<float64> sosMat(&sosH[0], 1u, 5u);
+    bool ok = gam.config.Write("Structure", "SOS");
+    ok &= gam.config.Write("SOS", sosMat);
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOSNoSOS() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    bool ok = gam.config.Write("Structure", "SOS");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOSNotNormalised() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    float64 sosH[] = { 1.0, 2.0, 1.0, 1.0, -1.5, 0.8, 1.0, 2.0, 1.0, 2.0, -1.5, 0.8 };
+    bool ok = gam.InitialiseFilterSOS(sosH, 2u, 1.0);
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOSLanes() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    float64 sosH[] = { 1.0, 2.0, 1.0, 1.0, -1.5, 0.8 };
+    bool ok = gam.InitialiseFilterSOS(sosH, 1u, 1.0);
+    ok &= gam.config.Write("ExecutionMode", "Lanes");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteSOSSingleSection() {
+    using namespace MARTe;
+    float32 numIn[] = { 0.0675F, 0.1349F, 0.0675F };
+    float32 denIn[] = { 1.0F, -1.1430F, 0.4128F };
+    float64 sosH[] = { 0.0675F, 0.1349F, 0.0675F, 1.0F, -1.1430F, 0.4128F };
+    FilterGAMTestHelper gamDirect;
+    FilterGAMTestHelper gamSOS;
+    gamDirect.SetName("Direct");
+    gamSOS.SetName("SOS");
+    bool ok = gamDirect.InitialiseFilter(numIn, 3u, denIn, 3u);
+    ok &= gamSOS.InitialiseFilterSOS(sosH, 1u, 1.0);
+    ok &= gamDirect.Initialise(gamDirect.config);
+    ok &= gamSOS.Initialise(gamSOS.config);
+    ok &= gamDirect.InitialiseConfigDataBaseSignal2();
+    ok &= gamSOS.InitialiseConfigDataBaseSignal2();
+    ok &= gamDirect.SetConfiguredDatabase(gamDirect.configSignals);
+    ok &= gamSOS.SetConfiguredDatabase(gamSOS.configSignals);
+    ok &= gamDirect.AllocateInputSignalsMemory();
+    ok &= gamDirect.AllocateOutputSignalsMemory();
+    ok &= gamSOS.AllocateInputSignalsMemory();
+    ok &= gamSOS.AllocateOutputSignalsMemory();
+    ok &= gamDirect.Setup();
+    ok &= gamSOS.Setup();
+    for (uint32 c = 0u; (c < 5u) && (ok); c++) {
+        for (uint32 s = 0u; s < 2u; s++) {
+            float32 *inDirect = static_cast<float32 *>(gamDirect.GetInputSignalsMemory(s));
+            float32 *inSOS = static_cast<float32 *>(gamSOS.GetInputSignalsMemory(s));
+            for (uint32 n = 0u; n < gamDirect.numberOfElements; n++) {
+                inDirect[n] = static_cast<float32>(sin(0.3 * ((c * gamDirect.numberOfElements) + n)) * (s + 1));
+                inSOS[n] = inDirect[n];
+            }
+        }
+        ok &= gamDirect.Execute();
+        ok &= gamSOS.Execute();
+        for (uint32 s = 0u; (s < 2u) && (ok); s++) {
+            float32 *outDirect = static_cast<float32 *>(gamDirect.GetOutputSignalsMemory(s));
+            float32 *outSOS = static_cast<float32 *>(gamSOS.GetOutputSignalsMemory(s));
+            for (uint32 n = 0u; (n < gamDirect.numberOfElements) && (ok); n++) {
+                ok = (fabs(outDirect[n] - outSOS[n]) < 1e-5);
+            }
+        }
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteSOSCascade() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    float64 sosH[] = { 0.0675, 0.1349, 0.0675, 1.0, -1.1430, 0.4128, 1.0, 2.0, 1.0, 1.0, -1.5, 0.8 };
+    bool ok = gam.InitialiseFilterSOS(sosH, 2u, 0.5);
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignal1();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    float32 *gamMemoryIn = static_cast<float32 *>(gam.GetInputSignalsMemory());
+    float32 *gamMemoryOut = static_cast<float32 *>(gam.GetOutputSignalsMemory());
+    //reference computed with the same structure
+    float64 w[4] = { 0.0, 0.0, 0.0, 0.0 };
+    for (uint32 c = 0u; (c < 50u) && (ok); c++) {
+        for (uint32 n = 0u; n < gam.numberOfElements; n++) {
+            gamMemoryIn[n] = 1.0F;
+        }
+        ok = gam.Execute();
+        for (uint32 n = 0u; (n < gam.numberOfElements) && (ok); n++) {
+            float64 value = 0.5;
+            for (uint32 sec = 0u; sec < 2u; sec++) {
+                float64 *coeff = &sosH[sec * 6u];
+                float64 sectionOutput = coeff[0] * value + w[2u * sec];
+                w[2u * sec] = coeff[1] * value - coeff[4] * sectionOutput + w[(2u * sec) + 1u];
+                w[(2u * sec) + 1u] = coeff[2] * value - coeff[5] * sectionOutput;
+                value = sectionOutput;
+            }
+            ok = (gamMemoryOut[n] == static_cast<float32>(value));
+        }
+    }
+    //after the transient the output should be the static gain
+    bool isInfinite;
+    if (ok) {
+        ok = (fabs(gamMemoryOut[gam.numberOfElements - 1u] - gam.GetStaticGain(isInfinite)) < 1e-4);
+    }
+    //reset
+    if (ok) {
+        ok = gam.PrepareNextState("B", "C");
+    }
+    for (uint32 n = 0u; n < gam.numberOfElements; n++) {
+        gamMemoryIn[n] = 0.0F;
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    for (uint32 n = 0u; (n < gam.numberOfElements) && (ok); n++) {
+        ok = (gamMemoryOut[n] == 0.0F);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseWrongFIREngine() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.config.Write("FIREngine", "Winograd");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseOverlapSaveIIR() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    bool ok = gam.InitialiseFilterIIR();
+    ok &= gam.config.Write("FIREngine", "OverlapSave");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseOverlapSaveLanes() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.config.Write("FIREngine", "OverlapSave");
+    ok &= gam.config.Write("ExecutionMode", "Lanes");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteOverlapSave() {
+    return FilterGAMTestCompareOverlapSave(5u, 256u, 129u, "OverlapSave", true);
+}
+
+bool FilterGAMTest::TestExecuteOverlapSaveOddSignals() {
+    return FilterGAMTestCompareOverlapSave(3u, 10u, 5u, "OverlapSave", true);
+}
+
+bool FilterGAMTest::TestExecuteOverlapSaveShortArrays() {
+    return FilterGAMTestCompareOverlapSave(2u, 3u, 20u, "OverlapSave", true);
+}
+
+bool FilterGAMTest::TestSetupAutoCrossover() {
+    using namespace MARTe;
+    bool ok = true;
+    //Below and above the configured crossover
+    for (uint32 t = 0u; (t < 2u) && (ok); t++) {
+        FilterGAMTestHelper gam;
+        gam.SetName("Test");
+        ok = gam.InitialiseFilterFIR();
+        ok &= gam.config.Write("FIREngine", "Auto");
+        ok &= gam.config.Write("OverlapSaveMinimumTaps", (t == 0u) ? 100u : 2u);
+        ok &= gam.Initialise(gam.config);
+        ok &= gam.InitialiseConfigDataBaseSignal1();
+        ok &= gam.SetConfiguredDatabase(gam.configSignals);
+        ok &= gam.AllocateInputSignalsMemory();
+        ok &= gam.AllocateOutputSignalsMemory();
+        ok &= gam.Setup();
+        if (ok) {
+            ok = (gam.IsOverlapSave() == (t == 1u));
+        }
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestSetupAutoBenchmark() {
+    return FilterGAMTestCompareOverlapSave(2u, 1024u, 512u, "Auto", true);
+}
+
+bool FilterGAMTest::TestSetupAutoIIR() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterIIR();
+    ok &= gam.config.Write("FIREngine", "Auto");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignal1();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    if (ok) {
+        ok = !gam.IsOverlapSave();
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteInt16Input() {
+    using namespace MARTe;
+    return FilterGAMTestCompareTypes<int16, float32>("int16", "float32", "Scalar");
+}
+
+bool FilterGAMTest::TestExecuteInt32InputFloat64Output() {
+    using namespace MARTe;
+    return FilterGAMTestCompareTypes<int32, float64>("int32", "float64", "Scalar");
+}
+
+bool FilterGAMTest::TestExecuteFloat64Input() {
+    using namespace MARTe;
+    return FilterGAMTestCompareTypes<float64, float32>("float64", "float32", "Scalar");
+}
+
+bool FilterGAMTest::TestExecuteLanesInt16Input() {
+    using namespace MARTe;
+    return FilterGAMTestCompareTypes<int16, float64>("int16", "float64", "Lanes");
+}
+
+bool FilterGAMTest::TestExecuteSOSInt16Input() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    float64 sosIn[] = { 0.5, 0.5, 0.0, 1.0, 0.0, 0.0 };
+    bool ok = gam.InitialiseFilterSOS(sosIn, 1u, 1.0);
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignalType("int16", static_cast<uint32>(sizeof(int16)), "float64", static_cast<uint32>(sizeof(float64)));
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    int16 *gamMemoryIn = static_cast<int16 *>(gam.GetInputSignalsMemory());
+    float64 *gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+    for (uint32 n = 0u; n < gam.numberOfElements; n++) {
+        gamMemoryIn[n] = static_cast<int16>(2 * n);
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    //moving average of two samples
+    if (ok) {
+        ok = (gamMemoryOut[0] == 0.0);
+    }
+    for (uint32 n = 1u; (n < gam.numberOfElements) && (ok); n++) {
+        ok = (gamMemoryOut[n] == static_cast<float64>((2 * n) - 1u));
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestSetupWrongOutputType() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignalType("float32", static_cast<uint32>(sizeof(float32)), "int16", static_cast<uint32>(sizeof(int16)));
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    if (ok) {
+        ok = !gam.Setup();
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseWrongNumberOfWorkers() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.config.Write("NumberOfWorkers", 65);
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteWorkers() {
+    using namespace MARTe;
+    float32 numIn[] = { 0.0675F, 0.1349F, 0.0675F };
+    float32 denIn[] = { 1.0F, -1.1430F, 0.4128F };
+    return FilterGAMTestCompareWorkers(37u, 10u, numIn, 3u, denIn, 3u, "Scalar", "Direct", 3u);
+}
+
+bool FilterGAMTest::TestExecuteWorkersMoreThanSignals() {
+    using namespace MARTe;
+    float32 numIn[] = { 0.5F, 0.5F };
+    float32 denIn[] = { 1.0F };
+    return FilterGAMTestCompareWorkers(2u, 10u, numIn, 2u, denIn, 1u, "Scalar", "Direct", 4u);
+}
+
+bool FilterGAMTest::TestExecuteLanesWorkers() {
+    using namespace MARTe;
+    float32 numIn[] = { 0.1F, 0.2F, 0.3F, 0.25F, 0.15F };
+    float32 denIn[] = { 1.0F };
+    return FilterGAMTestCompareWorkers(37u, 10u, numIn, 5u, denIn, 1u, "Lanes", "Direct", 2u);
+}
+
+bool FilterGAMTest::TestExecuteOverlapSaveWorkers() {
+    using namespace MARTe;
+    float32 numIn[] = { 0.1F, 0.2F, 0.3F, 0.25F, 0.15F };
+    float32 denIn[] = { 1.0F };
+    return FilterGAMTestCompareWorkers(7u, 16u, numIn, 5u, denIn, 1u, "Scalar", "OverlapSave", 2u);
+}
+
+bool FilterGAMTest::TestExecuteSOSWorkers() {
+    using namespace MARTe;
+    float64 sosIn[] = { 0.0675, 0.1349, 0.0675, 1.0, -1.1430, 0.4128, 1.0, 2.0, 1.0, 1.0, -1.5, 0.8 };
+    const uint32 numberOfSignals = 9u;
+    const uint32 numberOfElements = 10u;
+    FilterGAMTestHelper gamSingle(numberOfElements);
+    FilterGAMTestHelper gamWorkers(numberOfElements);
+    gamSingle.SetName("Single");
+    gamWorkers.SetName("Workers");
+    bool ok = gamSingle.InitialiseFilterSOS(sosIn, 2u, 0.5);
+    ok &= gamWorkers.InitialiseFilterSOS(sosIn, 2u, 0.5);
+    ok &= gamWorkers.config.Write("NumberOfWorkers", 2);
+    ok &= gamSingle.Initialise(gamSingle.config);
+    ok &= gamWorkers.Initialise(gamWorkers.config);
+    ok &= gamSingle.InitialiseConfigDataBaseSignalN(numberOfSignals);
+    ok &= gamWorkers.InitialiseConfigDataBaseSignalN(numberOfSignals);
+    ok &= gamSingle.SetConfiguredDatabase(gamSingle.configSignals);
+    ok &= gamWorkers.SetConfiguredDatabase(gamWorkers.configSignals);
+    ok &= gamSingle.AllocateInputSignalsMemory();
+    ok &= gamSingle.AllocateOutputSignalsMemory();
+    ok &= gamWorkers.AllocateInputSignalsMemory();
+    ok &= gamWorkers.AllocateOutputSignalsMemory();
+    ok &= gamSingle.Setup();
+    ok &= gamWorkers.Setup();
+    for (uint32 c = 0u; (c < 4u) && (ok); c++) {
+        for (uint32 s = 0u; s < numberOfSignals; s++) {
+            float32 *inSingle = static_cast<float32 *>(gamSingle.GetInputSignalsMemory(s));
+            float32 *inWorkers = static_cast<float32 *>(gamWorkers.GetInputSignalsMemory(s));
+            for (uint32 n = 0u; n < numberOfElements; n++) {
+                inSingle[n] = static_cast<float32>(cos(0.2 * ((c * numberOfElements) + n)) * (s + 1u));
+                inWorkers[n] = inSingle[n];
+            }
+        }
+        ok &= gamSingle.Execute();
+        ok &= gamWorkers.Execute();
+        for (uint32 s = 0u; (s < numberOfSignals) && (ok); s++) {
+            ok = (MemoryOperationsHelper::Compare(gamSingle.GetOutputSignalsMemory(s), gamWorkers.GetOutputSignalsMemory(s),
+                                                  numberOfElements * static_cast<uint32>(sizeof(float32))) == 0);
+        }
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestLoadCoefficients() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignal1();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    float32 *gamMemoryIn = static_cast<float32 *>(gam.GetInputSignalsMemory());
+    float32 *gamMemoryOut = static_cast<float32 *>(gam.GetOutputSignalsMemory());
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        gamMemoryIn[i] = static_cast<float32>(i);
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    float32 numIn[] = { 0.6F, 0.4F };
+    float32 denIn[] = { 1.0F };
+    if (ok) {
+        ok = FilterGAMTestLoadCoefficients(gam, FilterGAMTestCoefficients(numIn, 2u, denIn, 1u));
+    }
+    if (ok) {
+        ok = gam.IsCoefficientsUpdatePending();
+    }
+    //The current coefficients are only replaced in the next Execute()
+    float32 coeff[2];
+    if (ok) {
+        ok = gam.GetNumCoeff(coeff);
+    }
+    if (ok) {
+        ok = ((coeff[0] == 0.5F) && (coeff[1] == 0.5F));
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    if (ok) {
+        ok = !gam.IsCoefficientsUpdatePending();
+    }
+    if (ok) {
+        ok = gam.GetNumCoeff(coeff);
+    }
+    if (ok) {
+        ok = ((coeff[0] == 0.6F) && (coeff[1] == 0.4F));
+    }
+    //The last input of the previous cycle (9) is kept
+    if (ok) {
+        ok = (fabs(gamMemoryOut[0] - 3.6F) < 1e-5);
+    }
+    for (uint32 i = 1u; (i < gam.numberOfElements) && (ok); i++) {
+        ok = (fabs(gamMemoryOut[i] - (static_cast<float32>(i) - 0.4F)) < 1e-5);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestLoadCoefficientsWrongNumberOfCoefficients() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignal1();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    float32 numIn[] = { 0.2F, 0.3F, 0.5F };
+    float32 denIn[] = { 1.0F };
+    if (ok) {
+        ok = !FilterGAMTestLoadCoefficients(gam, FilterGAMTestCoefficients(numIn, 3u, denIn, 1u));
+    }
+    if (ok) {
+        ok = !gam.IsCoefficientsUpdatePending();
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestLoadCoefficientsNotNormalised() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignal1();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    float32 numIn[] = { 0.6F, 0.4F };
+    float32 denIn[] = { 2.0F };
+    if (ok) {
+        ok = !FilterGAMTestLoadCoefficients(gam, FilterGAMTestCoefficients(numIn, 2u, denIn, 1u));
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestLoadCoefficientsBeforeSetup() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.Initialise(gam.config);
+    float32 numIn[] = { 0.6F, 0.4F };
+    float32 denIn[] = { 1.0F };
+    if (ok) {
+        ok = !FilterGAMTestLoadCoefficients(gam, FilterGAMTestCoefficients(numIn, 2u, denIn, 1u));
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestLoadCoefficientsPending() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignal1();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    float32 numIn[] = { 0.6F, 0.4F };
+    float32 numIn2[] = { 0.7F, 0.3F };
+    float32 denIn[] = { 1.0F };
+    if (ok) {
+        ok = FilterGAMTestLoadCoefficients(gam, FilterGAMTestCoefficients(numIn, 2u, denIn, 1u));
+    }
+    //The previous set was not applied yet
+    if (ok) {
+        ok = !FilterGAMTestLoadCoefficients(gam, FilterGAMTestCoefficients(numIn2, 2u, denIn, 1u));
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    if (ok) {
+        ok = FilterGAMTestLoadCoefficients(gam, FilterGAMTestCoefficients(numIn2, 2u, denIn, 1u));
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    float32 coeff[2];
+    if (ok) {
+        ok = gam.GetNumCoeff(coeff);
+    }
+    if (ok) {
+        ok = ((coeff[0] == 0.7F) && (coeff[1] == 0.3F));
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestLoadCoefficientsTransferSOS() {
+    using namespace MARTe;
+    //First order low-pass filters with unitary static gain: y[n] = 0.1 * x[n] + 0.9 * y[n - 1] and then y[n] = 0.2 * x[n] + 0.8 * y[n - 1]
+    float64 sosIn[] = { 0.1, 0.0, 0.0, 1.0, -0.9, 0.0 };
+    float64 sosNew[] = { 0.2, 0.0, 0.0, 1.0, -0.8, 0.0 };
+    float64 lastOutput[2];
+    float64 newOutput[2];
+    bool ok = true;
+    for (uint32 transfer = 0u; (transfer < 2u) && (ok); transfer++) {
+        FilterGAMTestHelper gam(1u);
+        gam.SetName("Test");
+        ok = gam.InitialiseFilterSOS(sosIn, 1u, 1.0);
+        ok &= gam.Initialise(gam.config);
+        ok &= gam.InitialiseConfigDataBaseSignalType("float64", static_cast<uint32>(sizeof(float64)), "float64", static_cast<uint32>(sizeof(float64)));
+        ok &= gam.SetConfiguredDatabase(gam.configSignals);
+        ok &= gam.AllocateInputSignalsMemory();
+        ok &= gam.AllocateOutputSignalsMemory();
+        ok &= gam.Setup();
+        float64 *gamMemoryIn = static_cast<float64 *>(gam.GetInputSignalsMemory());
+        float64 *gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+        //a ramp, so that the internal state is not the steady state of the new filter
+        for (uint32 n = 0u; (n < 20u) && (ok); n++) {
+            *gamMemoryIn = static_cast<float64>(n) * 0.1;
+            ok = gam.Execute();
+        }
+        lastOutput[transfer] = *gamMemoryOut;
+        ReferenceT<ConfigurationDatabase> coefficients(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        Matrix<float64> sosMat(sosNew, 1u, 6u);
+        ok &= coefficients->Write("SOS", sosMat);
+        ok &= coefficients->Write("Gain", 1.0);
+        ok &= coefficients->Write("Transfer", transfer);
+        if (ok) {
+            ok = FilterGAMTestLoadCoefficients(gam, coefficients);
+        }
+        //the input holds the output value
+        *gamMemoryIn = lastOutput[transfer];
+        if (ok) {
+            ok = gam.Execute();
+        }
+        newOutput[transfer] = *gamMemoryOut;
+    }
+    //Without transfer: 0.2 * x + 0.9 * y (the state of the old filter). With transfer the output does not change.
+    if (ok) {
+        ok = (fabs(newOutput[0] - (1.1 * lastOutput[0])) < 1e-9);
+    }
+    if (ok) {
+        ok = (fabs(newOutput[1] - lastOutput[1]) < 1e-9);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestLoadCoefficientsTransferInfiniteGain() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    float32 numIn[] = { 0.1F };
+    float32 denIn[] = { 1.0F, -0.9F };
+    bool ok = gam.InitialiseFilter(numIn, 1u, denIn, 2u);
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignal1();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    //integrator
+    float32 numNew[] = { 1.0F };
+    float32 denNew[] = { 1.0F, -1.0F };
+    ReferenceT<ConfigurationDatabase> coefficients = FilterGAMTestCoefficients(numNew, 1u, denNew, 2u);
+    ok &= coefficients->Write("Transfer", 1u);
+    if (ok) {
+        ok = !FilterGAMTestLoadCoefficients(gam, coefficients);
+    }
+    //Without transfer the integrator is accepted
+    if (ok) {
+        ok = FilterGAMTestLoadCoefficients(gam, FilterGAMTestCoefficients(numNew, 1u, denNew, 2u));
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestLoadCoefficientsOverlapSave() {
+    using namespace MARTe;
+    const uint32 numberOfElements = 16u;
+    float32 numIn[] = { 0.1F, 0.2F, 0.3F, 0.4F };
+    float32 numNew[] = { 0.4F, 0.3F, 0.2F, 0.1F };
+    float32 denIn[] = { 1.0F };
+    FilterGAMTestHelper gamDirect(numberOfElements);
+    FilterGAMTestHelper gamOverlapSave(numberOfElements);
+    gamDirect.SetName("Direct");
+    gamOverlapSave.SetName("OverlapSave");
+    bool ok = gamDirect.InitialiseFilter(numIn, 4u, denIn, 1u);
+    ok &= gamOverlapSave.InitialiseFilter(numIn, 4u, denIn, 1u);
+    ok &= gamOverlapSave.config.Write("FIREngine", "OverlapSave");
+    ok &= gamDirect.Initialise(gamDirect.config);
+    ok &= gamOverlapSave.Initialise(gamOverlapSave.config);
+    ok &= gamDirect.InitialiseConfigDataBaseSignalN(2u);
+    ok &= gamOverlapSave.InitialiseConfigDataBaseSignalN(2u);
+    ok &= gamDirect.SetConfiguredDatabase(gamDirect.configSignals);
+    ok &= gamOverlapSave.SetConfiguredDatabase(gamOverlapSave.configSignals);
+    ok &= gamDirect.AllocateInputSignalsMemory();
+    ok &= gamDirect.AllocateOutputSignalsMemory();
+    ok &= gamOverlapSave.AllocateInputSignalsMemory();
+    ok &= gamOverlapSave.AllocateOutputSignalsMemory();
+    ok &= gamDirect.Setup();
+    ok &= gamOverlapSave.Setup();
+    ok &= gamOverlapSave.IsOverlapSave();
+    for (uint32 c = 0u; (c < 4u) && (ok); c++) {
+        if (c == 2u) {
+            ok = FilterGAMTestLoadCoefficients(gamDirect, FilterGAMTestCoefficients(numNew, 4u, denIn, 1u));
+            ok &= FilterGAMTestLoadCoefficients(gamOverlapSave, FilterGAMTestCoefficients(numNew, 4u, denIn, 1u));
+        }
+        for (uint32 s = 0u; s < 2u; s++) {
+            float32 *inDirect = static_cast<float32 *>(gamDirect.GetInputSignalsMemory(s));
+            float32 *inOverlapSave = static_cast<float32 *>(gamOverlapSave.GetInputSignalsMemory(s));
+            for (uint32 n = 0u; n < numberOfElements; n++) {
+                inDirect[n] = static_cast<float32>(sin(0.1 * ((c * numberOfElements) + n + 1u)) * (s + 1u));
+                inOverlapSave[n] = inDirect[n];
+            }
+        }
+        ok &= gamDirect.Execute();
+        ok &= gamOverlapSave.Execute();
+        for (uint32 s = 0u; (s < 2u) && (ok); s++) {
+            float32 *outDirect = static_cast<float32 *>(gamDirect.GetOutputSignalsMemory(s));
+            float32 *outOverlapSave = static_cast<float32 *>(gamOverlapSave.GetOutputSignalsMemory(s));
+            for (uint32 n = 0u; (n < numberOfElements) && (ok); n++) {
+                ok = (fabs(outDirect[n] - outOverlapSave[n]) < 1e-5);
+            }
+        }
+    }
+    return ok;
+}
@@ -393,6 +393,258 @@ public:
      * @return true if PrepareNextState() fails.
      */
     bool TestResetOnlyWhenRequiredMemoryNotInit();
+
+    /**
+     * @brief Tests that Initialise() fails with an invalid ExecutionMode.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseWrongExecutionMode();
+
+    /**
+     * @brief Tests the Lanes ExecutionMode with a FIR filter and a number of signals which is not a multiple of the lane width.
+     * @return true if the outputs are bit-for-bit identical to the Scalar ExecutionMode.
+     */
+    bool TestExecuteLanesFIR();
+
+    /**
+     * @brief Tests the Lanes ExecutionMode with an IIR filter.
+     * @return true if the outputs are bit-for-bit identical to the Scalar ExecutionMode.
+     */
+    bool TestExecuteLanesIIR();
+
+    /**
+     * @brief Tests the Lanes ExecutionMode when the number of samples is smaller than the number of last states.
+     * @return true if the outputs are bit-for-bit identical to the Scalar ExecutionMode.
+     */
+    bool TestExecuteLanesShortArrays();
+
+    /**
+     * @brief Tests that PrepareNextState() resets the last states of the Lanes ExecutionMode.
+     * @return true if the filter output after the reset is the same as the one of the first execution.
+     */
+    bool TestExecuteLanesReset();
+
+    /**
+     * @brief Tests the initialisation with Structure = SOS.
+     * @return true if the sections, the coefficients and the static gain are correctly loaded.
+     */
+    bool TestInitialiseSOS();
+
+    /**
+     * @brief Tests that Initialise() fails with an invalid Structure.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseWrongStructure();
+
+    /**
+     * @brief Tests that Initialise() fails if the sections do not have 6 coefficients.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseSOSWrongNumberOfCoefficients();
+
+    /**
+     * @brief Tests that Initialise() fails if Structure = SOS and the SOS matrix is not specified.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseSOSNoSOS();
+
+    /**
+     * @brief Tests that Initialise() fails if a0 != 1 in any section.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseSOSNotNormalised();
+
+    /**
+     * @brief Tests that Initialise() fails if Structure = SOS and ExecutionMode = Lanes.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseSOSLanes();
+
+    /**
+     * @brief Tests that a single section produces the same output of the equivalent direct form filter.
+     * @return true if the outputs are equal within the float32 precision.
+     */
+    bool TestExecuteSOSSingleSection();
+
+    /**
+     * @brief Tests a cascade of two sections against a reference implementation, the static gain and the reset of the states.
+     * @return true if the outputs are as expected.
+     */
+    bool TestExecuteSOSCascade();
+
+    /**
+     * @brief Tests that Initialise() fails with an invalid FIREngine.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseWrongFIREngine();
+
+    /**
+     * @brief Tests that Initialise() fails if FIREngine = OverlapSave and the filter is IIR.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseOverlapSaveIIR();
+
+    /**
+     * @brief Tests that Initialise() fails if FIREngine = OverlapSave and ExecutionMode = Lanes.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseOverlapSaveLanes();
+
+    /**
+     * @brief Tests that a long FIR filter computed with the overlap-save engine produces the same output of the direct form.
+     * @return true if the outputs are equal within the float32 precision.
+     */
+    bool TestExecuteOverlapSave();
+
+    /**
+     * @brief Tests the overlap-save engine with an odd number of signals (the last signal is not paired).
+     * @return true if the outputs are equal within the float32 precision.
+     */
+    bool TestExecuteOverlapSaveOddSignals();
+
+    /**
+     * @brief Tests the overlap-save engine when the number of samples is smaller than the number of last inputs.
+     * @return true if the outputs are equal within the float32 precision.
+     */
+    bool TestExecuteOverlapSaveShortArrays();
+
+    /**
+     * @brief Tests that FIREngine = Auto selects the engine according to OverlapSaveMinimumTaps.
+     * @return true if the expected engine is selected.
+     */
+    bool TestSetupAutoCrossover();
+
+    /**
+     * @brief Tests that FIREngine = Auto selects the overlap-save, after benchmarking, for a long filter with a large number of samples.
+     * @return true if the overlap-save is selected and produces the same output of the direct form.
+     */
+    bool TestSetupAutoBenchmark();
+
+    /**
+     * @brief Tests that FIREngine = Auto selects the direct form for IIR filters.
+     * @return true if the direct form is selected.
+     */
+    bool TestSetupAutoIIR();
+
+    /**
+     * @brief Tests the filter with int16 inputs and float32 outputs.
+     * @return true if the output is equal to the one computed with the input converted to float32.
+     */
+    bool TestExecuteInt16Input();
+
+    /**
+     * @brief Tests the filter with int32 inputs and float64 outputs.
+     * @return true if the output is equal to the one computed with the input converted to float32.
+     */
+    bool TestExecuteInt32InputFloat64Output();
+
+    /**
+     * @brief Tests the filter with float64 inputs and float32 outputs.
+     * @return true if the output is equal to the one computed with the input converted to float32.
+     */
+    bool TestExecuteFloat64Input();
+
+    /**
+     * @brief Tests the Lanes ExecutionMode with int16 inputs and float64 outputs.
+     * @return true if the output is equal to the one computed with the input converted to float32.
+     */
+    bool TestExecuteLanesInt16Input();
+
+    /**
+     * @brief Tests the SOS structure with int16 inputs and float64 outputs.
+     * @return true if the output is as expected.
+     */
+    bool TestExecuteSOSInt16Input();
+
+    /**
+     * @brief Tests that Setup() fails if the output signal is not float32 or float64.
+     * @return true if Setup() fails.
+     */
+    bool TestSetupWrongOutputType();
+
+    /**
+     * @brief Tests that Initialise() fails if NumberOfWorkers > 64.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseWrongNumberOfWorkers();
+
+    /**
+     * @brief Tests the Scalar ExecutionMode with helper threads and a number of signals which is not a multiple of the number of threads.
+     * @return true if the outputs are bit-for-bit identical to the ones computed without helper threads.
+     */
+    bool TestExecuteWorkers();
+
+    /**
+     * @brief Tests the filter with more helper threads than signals.
+     * @return true if the outputs are bit-for-bit identical to the ones computed without helper threads.
+     */
+    bool TestExecuteWorkersMoreThanSignals();
+
+    /**
+     * @brief Tests the Lanes ExecutionMode with helper threads.
+     * @return true if the outputs are bit-for-bit identical to the ones computed without helper threads.
+     */
+    bool TestExecuteLanesWorkers();
+
+    /**
+     * @brief Tests the overlap-save engine with helper threads and an odd number of signals.
+     * @return true if the outputs are bit-for-bit identical to the ones computed without helper threads.
+     */
+    bool TestExecuteOverlapSaveWorkers();
+
+    /**
+     * @brief Tests the SOS structure with helper threads.
+     * @return true if the outputs are bit-for-bit identical to the ones computed without helper threads.
+     */
+    bool TestExecuteSOSWorkers();
+
+    /**
+     * @brief Tests that LoadCoefficients stages the coefficients and that they are applied in the next Execute().
+     * @return true if the test succeeds.
+     */
+    bool TestLoadCoefficients();
+
+    /**
+     * @brief Tests that LoadCoefficients fails if the number of coefficients changes.
+     * @return true if the test succeeds.
+     */
+    bool TestLoadCoefficientsWrongNumberOfCoefficients();
+
+    /**
+     * @brief Tests that LoadCoefficients fails if the new coefficients are not normalised.
+     * @return true if the test succeeds.
+     */
+    bool TestLoadCoefficientsNotNormalised();
+
+    /**
+     * @brief Tests that LoadCoefficients fails before the Setup().
+     * @return true if the test succeeds.
+     */
+    bool TestLoadCoefficientsBeforeSetup();
+
+    /**
+     * @brief Tests that LoadCoefficients fails while the previous set was not applied.
+     * @return true if the test succeeds.
+     */
+    bool TestLoadCoefficientsPending();
+
+    /**
+     * @brief Tests the bumpless transfer of the SOS states (with and without Transfer).
+     * @return true if the test succeeds.
+     */
+    bool TestLoadCoefficientsTransferSOS();
+
+    /**
+     * @brief Tests that Transfer = 1 fails with an infinite static gain.
+     * @return true if the test succeeds.
+     */
+    bool TestLoadCoefficientsTransferInfiniteGain();
+
+    /**
+     * @brief Tests that the overlap-save spectrum is updated with the new coefficients.
+     * @return true if the test succeeds.
+     */
+    bool TestLoadCoefficientsOverlapSave();
 };
 
 /*---------------------------------------------------------------------------*/
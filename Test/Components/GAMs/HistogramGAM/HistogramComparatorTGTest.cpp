@@ -192,3 +192,113 @@ TEST(HistogramComparatorTGTest,TestGetNumberOfBins) {
     HistogramComparatorTTest<uint8> test;
     ASSERT_TRUE(test.TestGetNumberOfBins());
 }
+
+TEST(HistogramComparatorTGTest,TestAccumulate_U8) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestAccumulate(10, 100, 11));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_I8) {
+    HistogramComparatorTTest<int8> test;
+    ASSERT_TRUE(test.TestAccumulate(-10, 80, 11));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_U16) {
+    HistogramComparatorTTest<uint16> test;
+    ASSERT_TRUE(test.TestAccumulate(100, 1000, 12));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_I16) {
+    HistogramComparatorTTest<int16> test;
+    ASSERT_TRUE(test.TestAccumulate(-1000, 1000, 12));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_U32) {
+    HistogramComparatorTTest<uint32> test;
+    ASSERT_TRUE(test.TestAccumulate(100, 100000, 22));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_I32) {
+    HistogramComparatorTTest<int32> test;
+    ASSERT_TRUE(test.TestAccumulate(-100000, 100000, 22));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_U64) {
+    HistogramComparatorTTest<uint64> test;
+    ASSERT_TRUE(test.TestAccumulate(100, 100000, 7));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_I64) {
+    HistogramComparatorTTest<int64> test;
+    ASSERT_TRUE(test.TestAccumulate(-100000, 100000, 7));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_F32) {
+    HistogramComparatorTTest<float32> test;
+    ASSERT_TRUE(test.TestAccumulate(-1.5, 2.5, 10));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_F64) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestAccumulate(-1.5, 2.5, 10));
+}
+
+TEST(HistogramComparatorTGTest,TestSetLogLinear_Invalid) {
+    HistogramComparatorTTest<uint32> test;
+    ASSERT_TRUE(test.TestSetLogLinear_Invalid());
+}
+
+TEST(HistogramComparatorTGTest,TestGetRequiredNumberOfBins_U32) {
+    HistogramComparatorTTest<uint32> test;
+    ASSERT_TRUE(test.TestGetRequiredNumberOfBins(0, 1000000, 2, 1783));
+}
+
+TEST(HistogramComparatorTGTest,TestGetRequiredNumberOfBins_I16) {
+    HistogramComparatorTTest<int16> test;
+    ASSERT_TRUE(test.TestGetRequiredNumberOfBins(-100, 100, 1, 76));
+}
+
+TEST(HistogramComparatorTGTest,TestGetRequiredNumberOfBins_EmptyRange) {
+    HistogramComparatorTTest<uint32> test;
+    ASSERT_TRUE(test.TestGetRequiredNumberOfBins(10, 10, 2, 3));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_LogLinear_U16) {
+    HistogramComparatorTTest<uint16> test;
+    ASSERT_TRUE(test.TestInRange_LogLinear(10, 60000, 1));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_LogLinear_I16) {
+    HistogramComparatorTTest<int16> test;
+    ASSERT_TRUE(test.TestInRange_LogLinear(-30000, 30000, 2));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_LogLinear_U32) {
+    HistogramComparatorTTest<uint32> test;
+    ASSERT_TRUE(test.TestInRange_LogLinear(0, 1000000, 2));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_LogLinear_I32) {
+    HistogramComparatorTTest<int32> test;
+    ASSERT_TRUE(test.TestInRange_LogLinear(-100000, 2000000000, 3));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_LogLinear_U64) {
+    HistogramComparatorTTest<uint64> test;
+    ASSERT_TRUE(test.TestInRange_LogLinear(1000, 1000000000000ull, 2));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_LogLinear_I64) {
+    HistogramComparatorTTest<int64> test;
+    ASSERT_TRUE(test.TestInRange_LogLinear(-1000000, 1000000000000ll, 3));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_LogLinear_F32) {
+    HistogramComparatorTTest<float32> test;
+    ASSERT_TRUE(test.TestInRange_LogLinear(0.0, 100000.0, 2));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_LogLinear_F64) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestInRange_LogLinear(-5.0, 1000000000.0, 4));
+}
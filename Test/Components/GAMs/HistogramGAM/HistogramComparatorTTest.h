@@ -85,6 +85,34 @@ public:
                      T value,
                      uint32 expected);
 
+    /**
+     * @brief Tests that the HistogramComparatorT::Accumulate method counts each value in the same bin as InRange.
+     */
+    bool TestAccumulate(T min,
+                        T max,
+                        uint32 nBins);
+
+    /**
+     * @brief Tests that the HistogramComparatorT::SetLogLinear method fails with 0 or more than 5 significant digits.
+     */
+    bool TestSetLogLinear_Invalid();
+
+    /**
+     * @brief Tests the HistogramComparatorT::GetRequiredNumberOfBins method.
+     */
+    bool TestGetRequiredNumberOfBins(T min,
+                                     T max,
+                                     uint32 significantDigits,
+                                     uint32 expected);
+
+    /**
+     * @brief Tests that with log-linear bins each value in [min, max) falls between the
+     * HistogramComparatorT::GetBinLowerEdge of its bin and of the next one, with the required relative resolution.
+     */
+    bool TestInRange_LogLinear(T min,
+                               T max,
+                               uint32 significantDigits);
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -140,5 +168,128 @@ bool HistogramComparatorTTest<T>::TestInRange(T min,
 
 }
 
+template<typename T>
+bool HistogramComparatorTTest<T>::TestAccumulate(T min,
+                                                 T max,
+                                                 uint32 nBins) {
+    HistogramComparatorT<T> test;
+
+    test.SetMin((void*) &min);
+    test.SetMax((void*) &max);
+    test.SetNumberOfBins(nBins);
+
+    //more than one block, the last one incomplete
+    const uint32 numberOfValues = 150u;
+    T values[numberOfValues];
+    float64 range = static_cast<float64>(max) - static_cast<float64>(min);
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        //sweep from min to above max
+        values[i] = static_cast<T>(static_cast<float64>(min) + ((range * static_cast<float64>(i % 50u)) / 40.0));
+    }
+    values[0] = static_cast<T>(min - static_cast<T>(1));
+    values[numberOfValues - 1u] = max;
+
+    uint32 *histogram = new uint32[nBins];
+    uint32 *expected = new uint32[nBins];
+    for (uint32 i = 0u; i < nBins; i++) {
+        histogram[i] = 0u;
+        expected[i] = 0u;
+    }
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        expected[test.InRange((void*) &values[i])]++;
+    }
+    test.Accumulate((void*) &values[0], numberOfValues, histogram);
+
+    bool ret = true;
+    for (uint32 i = 0u; (i < nBins) && (ret); i++) {
+        ret = (histogram[i] == expected[i]);
+    }
+    delete[] histogram;
+    delete[] expected;
+    return ret;
+}
+
+template<typename T>
+bool HistogramComparatorTTest<T>::TestSetLogLinear_Invalid() {
+    HistogramComparatorT<T> test;
+    bool ret = !test.SetLogLinear(0u);
+    if (ret) {
+        ret = !test.SetLogLinear(6u);
+    }
+    if (ret) {
+        ret = (test.GetSignificantDigits() == 0u);
+    }
+    if (ret) {
+        ret = test.SetLogLinear(5u);
+    }
+    if (ret) {
+        ret = (test.GetSignificantDigits() == 5u);
+    }
+    return ret;
+}
+
+template<typename T>
+bool HistogramComparatorTTest<T>::TestGetRequiredNumberOfBins(T min,
+                                                              T max,
+                                                              uint32 significantDigits,
+                                                              uint32 expected) {
+    HistogramComparatorT<T> test;
+
+    test.SetMin((void*) &min);
+    test.SetMax((void*) &max);
+    bool ret = (test.GetRequiredNumberOfBins() == 3u);
+    if (ret) {
+        ret = test.SetLogLinear(significantDigits);
+    }
+    if (ret) {
+        ret = (test.GetRequiredNumberOfBins() == expected);
+    }
+    return ret;
+}
+
+template<typename T>
+bool HistogramComparatorTTest<T>::TestInRange_LogLinear(T min,
+                                                        T max,
+                                                        uint32 significantDigits) {
+    HistogramComparatorT<T> test;
+
+    test.SetMin((void*) &min);
+    test.SetMax((void*) &max);
+    bool ret = test.SetLogLinear(significantDigits);
+    uint32 nBins = test.GetRequiredNumberOfBins();
+    test.SetNumberOfBins(nBins);
+
+    float64 resolution = 1.0;
+    for (uint32 i = 0u; i < significantDigits; i++) {
+        resolution /= 10.0;
+    }
+    float64 range = static_cast<float64>(max) - static_cast<float64>(min);
+    for (uint32 i = 0u; (i < 1000u) && (ret); i++) {
+        T value = static_cast<T>(static_cast<float64>(min) + ((range * static_cast<float64>(i)) / 1000.0));
+        uint32 bin = test.InRange((void*) &value);
+        ret = (bin > 0u) && (bin < (nBins - 1u));
+        if (ret) {
+            float64 lowerEdge = test.GetBinLowerEdge(bin);
+            float64 upperEdge = test.GetBinLowerEdge(bin + 1u);
+            ret = (lowerEdge <= static_cast<float64>(value)) && (static_cast<float64>(value) < upperEdge);
+            if (ret) {
+                float64 distance = (lowerEdge - static_cast<float64>(min));
+                //the bins of the first distances are one unit wide
+                ret = ((upperEdge - lowerEdge) <= 1.0) || (((upperEdge - lowerEdge) / distance) <= resolution);
+            }
+        }
+    }
+    if (ret) {
+        ret = (test.InRange((void*) &max) == (nBins - 1u));
+    }
+    if (ret) {
+        ret = (test.GetBinLowerEdge(1u) == static_cast<float64>(min));
+    }
+    if (ret) {
+        ret = (test.GetBinLowerEdge(nBins - 1u) == static_cast<float64>(max));
+    }
+    return ret;
+}
+
 #endif /* HISTOGRAM_COMPARATORTTEST_H_ */
 
@@ -64,9 +64,9 @@ TEST(HistogramGAMGTest,TestSetup_DifferentInputOutputNSignals) {
     ASSERT_TRUE(test.TestSetup_DifferentInputOutputNSignals());
 }
 
-TEST(HistogramGAMGTest,TestSetup_FalseInputNotScalar) {
+TEST(HistogramGAMGTest,TestSetup_ArrayInput) {
     HistogramGAMTest test;
-    ASSERT_TRUE(test.TestSetup_FalseInputNotScalar());
+    ASSERT_TRUE(test.TestSetup_ArrayInput());
 }
 
 TEST(HistogramGAMGTest,TestSetup_FalseSamplesNotOne) {
@@ -104,6 +104,51 @@ TEST(HistogramGAMGTest,TestExecute_BeginCycleNumber) {
     ASSERT_TRUE(test.TestExecute_BeginCycleNumber());
 }
 
+TEST(HistogramGAMGTest,TestExecute_ArrayInput) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestExecute_ArrayInput());
+}
+
+TEST(HistogramGAMGTest,TestSetup_LogLinear) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestSetup_LogLinear());
+}
+
+TEST(HistogramGAMGTest,TestSetup_LogLinear_WrongNumberOfElements) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestSetup_LogLinear_WrongNumberOfElements());
+}
+
+TEST(HistogramGAMGTest,TestSetup_InvalidBinMode) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestSetup_InvalidBinMode());
+}
+
+TEST(HistogramGAMGTest,TestSetup_InvalidSignificantDigits) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestSetup_InvalidSignificantDigits());
+}
+
+TEST(HistogramGAMGTest,TestExecute_LogLinear) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestExecute_LogLinear());
+}
+
+TEST(HistogramGAMGTest,TestExportHistogram) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestExportHistogram());
+}
+
+TEST(HistogramGAMGTest,TestMergeHistograms) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestMergeHistograms());
+}
+
+TEST(HistogramGAMGTest,TestMergeHistograms_DifferentBins) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestMergeHistograms_DifferentBins());
+}
+
 TEST(HistogramGAMGTest,TestPrepareNextState) {
     HistogramGAMTest test;
     ASSERT_TRUE(test.TestPrepareNextState());
@@ -119,4 +164,23 @@ TEST(HistogramGAMGTest,TestPrepareNextState_Reset_State) {
     ASSERT_TRUE(test.TestPrepareNextState_Reset_State());
 }
 
+TEST(HistogramGAMGTest,TestRegistry) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestRegistry());
+}
+
+TEST(HistogramGAMGTest,TestRegistry_DifferentBins) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestRegistry_DifferentBins());
+}
+
+TEST(HistogramGAMGTest,TestRegistry_InvalidRegistry) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestRegistry_InvalidRegistry());
+}
+
+TEST(HistogramGAMGTest,TestRegistry_ExportHistograms) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestRegistry_ExportHistograms());
+}
 
@@ -30,6 +30,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
+#include "BasicFile.h"
 #include "ConfigurationDatabase.h"
 #include "DataSourceI.h"
 #include "GAMSchedulerI.h"
@@ -43,7 +44,9 @@
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
 #include "StandardParser.h"
+#include "Vector.h"
 #include "HistogramGAMTest.h"
+#include "HistogramRegistry.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -235,6 +238,127 @@ static bool InitialiseMemoryMapInputBrokerEnviroment(const char8 * const config)
     return ok;
 }
 
+/**
+ * Helper function to create an application with two HistogramGAM (in two threads) which register their histograms
+ * with the same name in a HistogramRegistry.
+ */
+static bool InitialiseRegistryEnviroment(const char8 * const registryPath,
+                                         const char8 * const maxLim2) {
+    StreamString config;
+    bool ok = config.Printf("%s", ""
+            "+Histograms = {"
+            "    Class = HistogramRegistry"
+            "    MergePeriod = 100000"
+            "    Filename = \"/tmp/HistogramRegistryTest.cfg\""
+            "}"
+            "$Application = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "           Class = HistogramGAMTestGAM");
+    ok &= config.Printf("           Registry = \"%s\"", registryPath);
+    ok &= config.Printf("%s", ""
+            "           StateChangeResetName = All"
+            "             InputSignals = {"
+            "                 CycleTime1 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
+            "                     Type = uint32"
+            "                     RegistryName = CycleTime"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 Histogram1 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "             }"
+            "        }"
+            "       +GAM2 = {"
+            "           Class = HistogramGAMTestGAM");
+    ok &= config.Printf("           Registry = \"%s\"", registryPath);
+    ok &= config.Printf("%s", ""
+            "             InputSignals = {"
+            "                 CycleTime2 = {"
+            "                     DataSource = Input"
+            "                     MinLim = 0"
+            "                     Type = uint32"
+            "                     RegistryName = CycleTime");
+    ok &= config.Printf("                     MaxLim = %s", maxLim2);
+    ok &= config.Printf("%s", ""
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 Histogram2 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Input = {"
+            "            Class = HistogramGAMTestDS"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "                +Thread2 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM2 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}");
+    if (ok) {
+        ok = InitialiseMemoryMapInputBrokerEnviroment(config.Buffer());
+    }
+    return ok;
+}
+
+/**
+ * Helper function to read the Counts of the merged histogram CycleTime.
+ */
+static bool ReadRegistryCounts(ReferenceT<HistogramRegistry> registry,
+                               uint64 * const counts) {
+    ConfigurationDatabase cdb;
+    bool ok = registry->ExportHistogram("CycleTime", cdb);
+    if (ok) {
+        Vector<uint64> countsVector(counts, 12u);
+        ok = cdb.Read("Counts", countsVector);
+    }
+    return ok;
+}
+
 HistogramGAMTest::HistogramGAMTest() {
 
 }
@@ -635,7 +759,7 @@ bool HistogramGAMTest::TestSetup_DifferentInputOutputNSignals() {
     return ret;
 }
 
-bool HistogramGAMTest::TestSetup_FalseInputNotScalar() {
+bool HistogramGAMTest::TestSetup_ArrayInput() {
 
     const char8 *config = ""
             "$Application = {"
@@ -811,7 +935,7 @@ bool HistogramGAMTest::TestSetup_FalseInputNotScalar() {
             "}";
 
     ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
-    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
     god->Purge();
     return ret;
 }
@@ -2482,7 +2606,7 @@ bool HistogramGAMTest::TestExecute_BeginCycleNumber() {
     return ret;
 }
 
-bool HistogramGAMTest::TestPrepareNextState() {
+bool HistogramGAMTest::TestExecute_ArrayInput() {
 
     const char8 *config = ""
             "$Application = {"
@@ -2491,7 +2615,6 @@ bool HistogramGAMTest::TestPrepareNextState() {
             "       Class = ReferenceContainer"
             "       +GAM1 = {"
             "           Class = HistogramGAMTestGAM"
-            "           BeginCycleNumber = 5"
             "             InputSignals = {"
             "                 Source_U8 = {"
             "                     DataSource = Input"
@@ -2502,56 +2625,58 @@ bool HistogramGAMTest::TestPrepareNextState() {
             "                 }"
             "                 Source_I8 = {"
             "                     DataSource = Input"
-            "                     MaxLim = 11"
-            "                     MinLim = 1"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
             "                     Type = int8"
             "                 }"
             "                 Source_U16 = {"
             "                     DataSource = Input"
-            "                     MaxLim = 12"
-            "                     MinLim = 2"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
             "                     Type = uint16"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
             "                 }"
             "                 Source_I16 = {"
             "                     DataSource = Input"
-            "                     MaxLim = 13"
-            "                     MinLim = 3"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
             "                     Type = int16"
             "                 }"
             "                 Source_U32 = {"
             "                     DataSource = Input"
-            "                     MaxLim = 14"
-            "                     MinLim = 4"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
             "                     Type = uint32"
             "                 }"
             "                 Source_i32 = {"
             "                     DataSource = Input"
-            "                     MaxLim = 15"
-            "                     MinLim = 5"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
             "                     Type = int32"
             "                 }"
             "                 Source_U64 = {"
             "                     DataSource = Input"
-            "                     MaxLim = 16"
-            "                     MinLim = 6"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
             "                     Type = uint64"
             "                 }"
             "                 Source_I64 = {"
             "                     DataSource = Input"
-            "                     MaxLim = 17"
-            "                     MinLim = 7"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
             "                     Type = int64"
             "                 }"
             "                 Source_F32 = {"
             "                     DataSource = Input"
-            "                     MaxLim = 18"
-            "                     MinLim = 8"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
             "                     Type = float32"
             "                 }"
             "                 Source_F64 = {"
             "                     DataSource = Input"
-            "                     MaxLim = 19"
-            "                     MinLim = 9"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
             "                     Type = float64"
             "                 }"
             "             }"
@@ -2658,89 +2783,810 @@ bool HistogramGAMTest::TestPrepareNextState() {
     ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
     bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
     ReferenceT<HistogramGAMTestGAM> gam;
-    ReferenceT<HistogramGAMTestDS> ds;
     if (ret) {
         gam = god->Find("Application.Functions.GAM1");
         ret = gam.IsValid();
     }
     if (ret) {
-        ds = god->Find("Application.Data.Input");
-        ret = ds.IsValid();
-    }
-    if (ret) {
-        HistogramComparator **comps = gam->GetComps();
-        ret &= dynamic_cast<HistogramComparatorT<uint8>*>(comps[0]) != NULL;
-        ret &= dynamic_cast<HistogramComparatorT<int8>*>(comps[1]) != NULL;
-        ret &= dynamic_cast<HistogramComparatorT<uint16>*>(comps[2]) != NULL;
-        ret &= dynamic_cast<HistogramComparatorT<int16>*>(comps[3]) != NULL;
-        ret &= dynamic_cast<HistogramComparatorT<uint32>*>(comps[4]) != NULL;
-        ret &= dynamic_cast<HistogramComparatorT<int32>*>(comps[5]) != NULL;
-        ret &= dynamic_cast<HistogramComparatorT<uint64>*>(comps[6]) != NULL;
-        ret &= dynamic_cast<HistogramComparatorT<int64>*>(comps[7]) != NULL;
-        ret &= dynamic_cast<HistogramComparatorT<float32>*>(comps[8]) != NULL;
-        ret &= dynamic_cast<HistogramComparatorT<float64>*>(comps[9]) != NULL;
-    }
-    ReferenceT<MemoryMapSynchronisedInputBroker> brokerSync;
-    ReferenceT<MemoryMapInputBroker> broker;
-
-    if (ret) {
-        ReferenceContainer inputBrokers;
-        gam->GetInputBrokers(inputBrokers);
-        brokerSync = inputBrokers.Get(0);
-        ret = brokerSync.IsValid();
-        if (ret) {
-            broker = inputBrokers.Get(1);
-            ret = broker.IsValid();
+        //all the elements of Source_U16 (after Source_U8 and Source_I8) are counted
+        uint8 *inMem = (uint8*) gam->GetInputSignalsMemory();
+        uint16 *inMemU16 = (uint16*) (inMem + 2);
+        for (uint32 i = 0u; i < 12u; i++) {
+            inMemU16[i] = (uint16) i;
         }
+        ret = gam->Execute();
     }
     if (ret) {
-        ret = ds->PrepareNextState("State1", "State1");
+        uint32 *outMemU8 = (uint32*) gam->GetOutputSignalsMemory();
+        uint32 *outMemU16 = (outMemU8 + 24);
+        ret = (outMemU8[1] == 1u);
+        ret &= (outMemU16[0] == 0u);
+        for (uint32 j = 1u; (j < 11u) && (ret); j++) {
+            ret = (outMemU16[j] == 1u);
+        }
+        ret &= (outMemU16[11] == 2u);
     }
+    god->Purge();
+    return ret;
+}
 
-    uint32 *outMemU8 = (uint32*) gam->GetOutputSignalsMemory();
-    uint32 *outMemI8 = (outMemU8 + 12);
-    uint32 *outMemU16 = (outMemI8 + 12);
-    uint32 *outMemI16 = (outMemU16 + 12);
-    uint32 *outMemU32 = (outMemI16 + 12);
-    uint32 *outMemI32 = (outMemU32 + 12);
-    uint32 *outMemU64 = (outMemI32 + 12);
-    uint32 *outMemI64 = (outMemU64 + 12);
-    uint32 *outMemF32 = (outMemI64 + 12);
-    uint32 *outMemF64 = (outMemF32 + 12);
-    if (ret) {
-        //Force the BeginCycleNumber
-        for (uint32 i = 0u; (i < 5u) && (ret); i++) {
-            gam->Execute();
-        }
+bool HistogramGAMTest::TestSetup_LogLinear() {
 
-        for (uint32 i = 0u; (i < 20u) && (ret); i++) {
-            brokerSync->Execute();
-            broker->Execute();
-            gam->Execute();
-            for (uint32 j = 0u; (j < 12u) && (ret); j++) {
-                if (i >= 10) {
-                    ret &= (outMemU8[11] == (uint32) (i - 9));
-                }
-                else {
-                    if (j > 0 && j <= (i + 1)) {
-                        ret &= (outMemU8[j] == (uint32) 1);
-                    }
-                    else {
-                        ret &= (outMemU8[j] == (uint32) 0);
-                    }
-                }
+    const char8 *config = ""
+            "$Application = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "           Class = HistogramGAMTestGAM"
+            "             InputSignals = {"
+            "                 CycleTime = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 1000000"
+            "                     MinLim = 0"
+            "                     Type = uint32"
+            "                     BinMode = LogLinear"
+            "                     SignificantDigits = 2"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 Histogram = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 1783"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Input = {"
+            "            Class = HistogramGAMTestDS"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
 
-                if (i >= 11) {
-                    ret &= (outMemI8[11] == (uint32) (i - 10));
-                }
-                else if (i < 1) {
-                    ret &= (outMemI8[0] == (uint32) (i + 1));
-                }
-                else {
-                    if (j > 0 && j <= (i)) {
-                        ret &= (outMemI8[j] == (uint32) 1);
-                    }
-                    else if (j > i) {
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    god->Purge();
+    return ret;
+}
+
+bool HistogramGAMTest::TestSetup_LogLinear_WrongNumberOfElements() {
+
+    const char8 *config = ""
+            "$Application = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "           Class = HistogramGAMTestGAM"
+            "             InputSignals = {"
+            "                 CycleTime = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 1000000"
+            "                     MinLim = 0"
+            "                     Type = uint32"
+            "                     BinMode = LogLinear"
+            "                     SignificantDigits = 2"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 Histogram = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 1000"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Input = {"
+            "            Class = HistogramGAMTestDS"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    god->Purge();
+    return ret;
+}
+
+bool HistogramGAMTest::TestSetup_InvalidBinMode() {
+
+    const char8 *config = ""
+            "$Application = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "           Class = HistogramGAMTestGAM"
+            "             InputSignals = {"
+            "                 CycleTime = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 1000000"
+            "                     MinLim = 0"
+            "                     Type = uint32"
+            "                     BinMode = Logarithmic"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 Histogram = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 1783"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Input = {"
+            "            Class = HistogramGAMTestDS"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    god->Purge();
+    return ret;
+}
+
+bool HistogramGAMTest::TestSetup_InvalidSignificantDigits() {
+
+    const char8 *config = ""
+            "$Application = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "           Class = HistogramGAMTestGAM"
+            "             InputSignals = {"
+            "                 CycleTime = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 1000000"
+            "                     MinLim = 0"
+            "                     Type = uint32"
+            "                     BinMode = LogLinear"
+            "                     SignificantDigits = 6"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 Histogram = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 1783"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Input = {"
+            "            Class = HistogramGAMTestDS"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    god->Purge();
+    return ret;
+}
+
+bool HistogramGAMTest::TestExecute_LogLinear() {
+
+    const char8 *config = ""
+            "$Application = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "           Class = HistogramGAMTestGAM"
+            "             InputSignals = {"
+            "                 CycleTime = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 1000000"
+            "                     MinLim = 0"
+            "                     Type = uint32"
+            "                     BinMode = LogLinear"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 Histogram = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 1783"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Input = {"
+            "            Class = HistogramGAMTestDS"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<HistogramGAMTestGAM> gam;
+    if (ret) {
+        gam = god->Find("Application.Functions.GAM1");
+        ret = gam.IsValid();
+    }
+    uint32 *inMem = NULL_PTR(uint32 *);
+    uint32 *outMem = NULL_PTR(uint32 *);
+    if (ret) {
+        inMem = (uint32*) gam->GetInputSignalsMemory();
+        outMem = (uint32*) gam->GetOutputSignalsMemory();
+        //1500 = 187 * 2^3 + 4 -> bin 1 + 187 + 3 * 128
+        *inMem = 1500u;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (outMem[572] == 1u);
+        *inMem = 7u;
+        ret &= gam->Execute();
+        ret &= (outMem[8] == 1u);
+        *inMem = 1000000u;
+        ret &= gam->Execute();
+        ret &= (outMem[1782] == 1u);
+    }
+    god->Purge();
+    return ret;
+}
+
+bool HistogramGAMTest::TestExportHistogram() {
+
+    const char8 *config = ""
+            "$Application = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "           Class = HistogramGAMTestGAM"
+            "             InputSignals = {"
+            "                 CycleTime = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 1000000"
+            "                     MinLim = 0"
+            "                     Type = uint32"
+            "                     BinMode = LogLinear"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 Histogram = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 1783"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Input = {"
+            "            Class = HistogramGAMTestDS"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<HistogramGAMTestGAM> gam;
+    if (ret) {
+        gam = god->Find("Application.Functions.GAM1");
+        ret = gam.IsValid();
+    }
+    ConfigurationDatabase cdb;
+    if (ret) {
+        uint32 *inMem = (uint32*) gam->GetInputSignalsMemory();
+        *inMem = 1500u;
+        ret = gam->Execute();
+        ret &= gam->ExportHistogram(0u, cdb);
+        ret &= !gam->ExportHistogram(1u, cdb);
+    }
+    if (ret) {
+        StreamString binMode;
+        uint32 significantDigits = 0u;
+        ret = cdb.Read("BinMode", binMode);
+        ret &= (binMode == "LogLinear");
+        ret &= cdb.Read("SignificantDigits", significantDigits);
+        ret &= (significantDigits == 2u);
+    }
+    if (ret) {
+        AnyType edgesType = cdb.GetType("Edges");
+        AnyType countsType = cdb.GetType("Counts");
+        ret = (edgesType.GetNumberOfElements(0u) == 1782u);
+        ret &= (countsType.GetNumberOfElements(0u) == 1783u);
+    }
+    if (ret) {
+        float64 edges[1782];
+        uint64 counts[1783];
+        Vector<float64> edgesVector(&edges[0], 1782u);
+        Vector<uint64> countsVector(&counts[0], 1783u);
+        ret = cdb.Read("Edges", edgesVector);
+        ret &= cdb.Read("Counts", countsVector);
+        if (ret) {
+            ret = (edges[0] == 0.0);
+            ret &= (edges[1781] == 1000000.0);
+            //the bin 572 starts at edges[571]
+            ret &= (edges[571] <= 1500.0);
+            ret &= (edges[572] > 1500.0);
+            ret &= (counts[572] == 1u);
+            ret &= (counts[0] == 0u);
+        }
+    }
+    god->Purge();
+    return ret;
+}
+
+bool HistogramGAMTest::TestMergeHistograms() {
+    ConfigurationDatabase merged;
+    ConfigurationDatabase histogram;
+    float64 edges[3] = { 0.0, 5.0, 10.0 };
+    uint64 mergedCounts[4] = { 1u, 2u, 3u, 4u };
+    uint64 counts[4] = { 10u, 20u, 30u, 40u };
+    Vector<float64> edgesVector(&edges[0], 3u);
+    Vector<uint64> mergedCountsVector(&mergedCounts[0], 4u);
+    Vector<uint64> countsVector(&counts[0], 4u);
+    bool ret = merged.Write("Edges", edgesVector);
+    ret &= merged.Write("Counts", mergedCountsVector);
+    ret &= histogram.Write("Edges", edgesVector);
+    ret &= histogram.Write("Counts", countsVector);
+    if (ret) {
+        ret = HistogramGAM::MergeHistograms(merged, histogram);
+    }
+    if (ret) {
+        uint64 result[4];
+        Vector<uint64> resultVector(&result[0], 4u);
+        ret = merged.Read("Counts", resultVector);
+        for (uint32 i = 0u; (i < 4u) && (ret); i++) {
+            ret = (result[i] == (mergedCounts[i] + counts[i]));
+        }
+    }
+    return ret;
+}
+
+bool HistogramGAMTest::TestMergeHistograms_DifferentBins() {
+    ConfigurationDatabase merged;
+    ConfigurationDatabase histogram;
+    float64 edges[3] = { 0.0, 5.0, 10.0 };
+    float64 otherEdges[3] = { 0.0, 4.0, 10.0 };
+    uint64 counts[4] = { 10u, 20u, 30u, 40u };
+    Vector<float64> edgesVector(&edges[0], 3u);
+    Vector<float64> otherEdgesVector(&otherEdges[0], 3u);
+    Vector<uint64> countsVector(&counts[0], 4u);
+    bool ret = merged.Write("Edges", edgesVector);
+    ret &= merged.Write("Counts", countsVector);
+    ret &= histogram.Write("Edges", otherEdgesVector);
+    ret &= histogram.Write("Counts", countsVector);
+    if (ret) {
+        ret = !HistogramGAM::MergeHistograms(merged, histogram);
+    }
+    return ret;
+}
+
+bool HistogramGAMTest::TestPrepareNextState() {
+
+    const char8 *config = ""
+            "$Application = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "           Class = HistogramGAMTestGAM"
+            "           BeginCycleNumber = 5"
+            "             InputSignals = {"
+            "                 Source_U8 = {"
+            "                     DataSource = Input"
+            "                     Frequency = 1"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
+            "                     Type = uint8"
+            "                 }"
+            "                 Source_I8 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 11"
+            "                     MinLim = 1"
+            "                     Type = int8"
+            "                 }"
+            "                 Source_U16 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 12"
+            "                     MinLim = 2"
+            "                     Type = uint16"
+            "                 }"
+            "                 Source_I16 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 13"
+            "                     MinLim = 3"
+            "                     Type = int16"
+            "                 }"
+            "                 Source_U32 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 14"
+            "                     MinLim = 4"
+            "                     Type = uint32"
+            "                 }"
+            "                 Source_i32 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 15"
+            "                     MinLim = 5"
+            "                     Type = int32"
+            "                 }"
+            "                 Source_U64 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 16"
+            "                     MinLim = 6"
+            "                     Type = uint64"
+            "                 }"
+            "                 Source_I64 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 17"
+            "                     MinLim = 7"
+            "                     Type = int64"
+            "                 }"
+            "                 Source_F32 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 18"
+            "                     MinLim = 8"
+            "                     Type = float32"
+            "                 }"
+            "                 Source_F64 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 19"
+            "                     MinLim = 9"
+            "                     Type = float64"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 Statistics_U8 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "                 Statistics_I8 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "                 Statistics_U16 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "                 Statistics_I16 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "                 Statistics_U32 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "                 Statistics_I32 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "                 Statistics_U64 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "                 Statistics_I64 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "                 Statistics_F32 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "                 Statistics_F64 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +LoggerDataSource = {"
+            "            Class = LoggerDataSource"
+            "        }"
+            "        +Input = {"
+            "            Class = HistogramGAMTestDS"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<HistogramGAMTestGAM> gam;
+    ReferenceT<HistogramGAMTestDS> ds;
+    if (ret) {
+        gam = god->Find("Application.Functions.GAM1");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        ds = god->Find("Application.Data.Input");
+        ret = ds.IsValid();
+    }
+    if (ret) {
+        HistogramComparator **comps = gam->GetComps();
+        ret &= dynamic_cast<HistogramComparatorT<uint8>*>(comps[0]) != NULL;
+        ret &= dynamic_cast<HistogramComparatorT<int8>*>(comps[1]) != NULL;
+        ret &= dynamic_cast<HistogramComparatorT<uint16>*>(comps[2]) != NULL;
+        ret &= dynamic_cast<HistogramComparatorT<int16>*>(comps[3]) != NULL;
+        ret &= dynamic_cast<HistogramComparatorT<uint32>*>(comps[4]) != NULL;
+        ret &= dynamic_cast<HistogramComparatorT<int32>*>(comps[5]) != NULL;
+        ret &= dynamic_cast<HistogramComparatorT<uint64>*>(comps[6]) != NULL;
+        ret &= dynamic_cast<HistogramComparatorT<int64>*>(comps[7]) != NULL;
+        ret &= dynamic_cast<HistogramComparatorT<float32>*>(comps[8]) != NULL;
+        ret &= dynamic_cast<HistogramComparatorT<float64>*>(comps[9]) != NULL;
+    }
+    ReferenceT<MemoryMapSynchronisedInputBroker> brokerSync;
+    ReferenceT<MemoryMapInputBroker> broker;
+
+    if (ret) {
+        ReferenceContainer inputBrokers;
+        gam->GetInputBrokers(inputBrokers);
+        brokerSync = inputBrokers.Get(0);
+        ret = brokerSync.IsValid();
+        if (ret) {
+            broker = inputBrokers.Get(1);
+            ret = broker.IsValid();
+        }
+    }
+    if (ret) {
+        ret = ds->PrepareNextState("State1", "State1");
+    }
+
+    uint32 *outMemU8 = (uint32*) gam->GetOutputSignalsMemory();
+    uint32 *outMemI8 = (outMemU8 + 12);
+    uint32 *outMemU16 = (outMemI8 + 12);
+    uint32 *outMemI16 = (outMemU16 + 12);
+    uint32 *outMemU32 = (outMemI16 + 12);
+    uint32 *outMemI32 = (outMemU32 + 12);
+    uint32 *outMemU64 = (outMemI32 + 12);
+    uint32 *outMemI64 = (outMemU64 + 12);
+    uint32 *outMemF32 = (outMemI64 + 12);
+    uint32 *outMemF64 = (outMemF32 + 12);
+    if (ret) {
+        //Force the BeginCycleNumber
+        for (uint32 i = 0u; (i < 5u) && (ret); i++) {
+            gam->Execute();
+        }
+
+        for (uint32 i = 0u; (i < 20u) && (ret); i++) {
+            brokerSync->Execute();
+            broker->Execute();
+            gam->Execute();
+            for (uint32 j = 0u; (j < 12u) && (ret); j++) {
+                if (i >= 10) {
+                    ret &= (outMemU8[11] == (uint32) (i - 9));
+                }
+                else {
+                    if (j > 0 && j <= (i + 1)) {
+                        ret &= (outMemU8[j] == (uint32) 1);
+                    }
+                    else {
+                        ret &= (outMemU8[j] == (uint32) 0);
+                    }
+                }
+
+                if (i >= 11) {
+                    ret &= (outMemI8[11] == (uint32) (i - 10));
+                }
+                else if (i < 1) {
+                    ret &= (outMemI8[0] == (uint32) (i + 1));
+                }
+                else {
+                    if (j > 0 && j <= (i)) {
+                        ret &= (outMemI8[j] == (uint32) 1);
+                    }
+                    else if (j > i) {
                         ret &= (outMemI8[j] == (uint32) 0);
                     }
                 }
@@ -3686,3 +4532,159 @@ bool HistogramGAMTest::TestPrepareNextState_Reset_State() {
     god->Purge();
     return ret;
 }
+
+bool HistogramGAMTest::TestRegistry() {
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseRegistryEnviroment("Histograms", "10");
+    ReferenceT<HistogramGAMTestGAM> gam1;
+    ReferenceT<HistogramGAMTestGAM> gam2;
+    ReferenceT<HistogramRegistry> registry;
+    if (ret) {
+        gam1 = god->Find("Application.Functions.GAM1");
+        gam2 = god->Find("Application.Functions.GAM2");
+        registry = god->Find("Histograms");
+        ret = (gam1.IsValid()) && (gam2.IsValid()) && (registry.IsValid());
+    }
+    if (ret) {
+        ret = (registry->GetNumberOfHistograms() == 1u);
+        ret &= (registry->GetNumberOfShards() == 2u);
+    }
+    uint32 *inMem1 = NULL_PTR(uint32 *);
+    uint32 *inMem2 = NULL_PTR(uint32 *);
+    uint64 counts[12];
+    if (ret) {
+        inMem1 = (uint32*) gam1->GetInputSignalsMemory();
+        inMem2 = (uint32*) gam2->GetInputSignalsMemory();
+        *inMem1 = 5u;
+        ret = gam1->Execute();
+        ret &= gam1->Execute();
+        *inMem2 = 5u;
+        ret &= gam2->Execute();
+        *inMem2 = 20u;
+        ret &= gam2->Execute();
+    }
+    if (ret) {
+        registry->Merge();
+        ret = ReadRegistryCounts(registry, &counts[0]);
+    }
+    if (ret) {
+        ret = (counts[6] == 3u);
+        ret &= (counts[11] == 1u);
+        ret &= (counts[0] == 0u);
+    }
+    //The reset of GAM1 does not decrease the merged counts
+    if (ret) {
+        ret = gam1->PrepareNextState("Idle", "Idle");
+        ret &= (((uint32*) gam1->GetOutputSignalsMemory())[6] == 0u);
+        ret &= gam1->Execute();
+    }
+    if (ret) {
+        registry->Merge();
+        ret = ReadRegistryCounts(registry, &counts[0]);
+    }
+    if (ret) {
+        ret = (counts[6] == 4u);
+        ret &= (counts[11] == 1u);
+    }
+    //A merge without new occurrences does not change the counts
+    if (ret) {
+        registry->Merge();
+        ret = ReadRegistryCounts(registry, &counts[0]);
+    }
+    if (ret) {
+        ret = (counts[6] == 4u);
+    }
+    god->Purge();
+    return ret;
+}
+
+bool HistogramGAMTest::TestRegistry_DifferentBins() {
+    bool ret = !InitialiseRegistryEnviroment("Histograms", "20");
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HistogramGAMTest::TestRegistry_InvalidRegistry() {
+    bool ret = !InitialiseRegistryEnviroment("NotAHistogramRegistry", "10");
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HistogramGAMTest::TestRegistry_ExportHistograms() {
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseRegistryEnviroment("Histograms", "10");
+    ReferenceT<HistogramGAMTestGAM> gam1;
+    ReferenceT<HistogramRegistry> registry;
+    if (ret) {
+        gam1 = god->Find("Application.Functions.GAM1");
+        registry = god->Find("Histograms");
+        ret = (gam1.IsValid()) && (registry.IsValid());
+    }
+    if (ret) {
+        uint32 *inMem1 = (uint32*) gam1->GetInputSignalsMemory();
+        *inMem1 = 3u;
+        ret = gam1->Execute();
+    }
+    //The RPC merges before exporting
+    ReferenceT<ConfigurationDatabase> data(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    if (ret) {
+        ReferenceContainer message;
+        ret = message.Insert(data);
+        if (ret) {
+            ret = registry->ExportHistograms(message).ErrorsCleared();
+        }
+    }
+    if (ret) {
+        ret = data->MoveAbsolute("CycleTime");
+    }
+    uint64 counts[12];
+    if (ret) {
+        Vector<uint64> countsVector(&counts[0], 12u);
+        ret = data->Read("Counts", countsVector);
+    }
+    if (ret) {
+        ret = (counts[4] == 1u);
+    }
+    //The file can be read back as a configuration
+    if (ret) {
+        ret = registry->WriteFile();
+    }
+    ConfigurationDatabase fileData;
+    if (ret) {
+        BasicFile file;
+        ret = file.Open("/tmp/HistogramRegistryTest.cfg", BasicFile::ACCESS_MODE_R);
+        StreamString content;
+        if (ret) {
+            char8 buffer[256];
+            uint32 size = 256u;
+            while ((ret) && (size > 0u)) {
+                size = 256u;
+                ret = file.Read(&buffer[0], size);
+                if ((ret) && (size > 0u)) {
+                    ret = content.Write(&buffer[0], size);
+                }
+            }
+            (void) file.Close();
+        }
+        if (ret) {
+            ret = content.Seek(0LLU);
+        }
+        if (ret) {
+            StandardParser parser(content, fileData);
+            ret = parser.Parse();
+        }
+    }
+    if (ret) {
+        ret = fileData.MoveAbsolute("CycleTime");
+    }
+    if (ret) {
+        uint64 fileCounts[12];
+        Vector<uint64> countsVector(&fileCounts[0], 12u);
+        ret = fileData.Read("Counts", countsVector);
+        for (uint32 i = 0u; (i < 12u) && (ret); i++) {
+            ret = (fileCounts[i] == counts[i]);
+        }
+    }
+    god->Purge();
+    return ret;
+}
@@ -76,10 +76,10 @@ public:
     bool TestSetup_DifferentInputOutputNSignals();
 
     /**
-     * @brief Tests the HistogramGAM::Setup method that fails if one or more
-     * input signals have NumberOfElements>1
+     * @brief Tests the HistogramGAM::Setup method with an input signal
+     * with NumberOfElements>1
      */
-    bool TestSetup_FalseInputNotScalar();
+    bool TestSetup_ArrayInput();
 
     /**
      * @brief Tests the HistogramGAM::Setup method that fails if one or more
@@ -121,6 +121,52 @@ public:
      */
     bool TestExecute_BeginCycleNumber();
 
+    /**
+     * @brief Tests the HistogramGAM::Execute method counting all the elements of an array input signal.
+     */
+    bool TestExecute_ArrayInput();
+
+    /**
+     * @brief Tests the HistogramGAM::Setup method with log-linear bins.
+     */
+    bool TestSetup_LogLinear();
+
+    /**
+     * @brief Tests the HistogramGAM::Setup method that fails if the number of elements of the output
+     * signal is not the number of log-linear bins required to cover the range.
+     */
+    bool TestSetup_LogLinear_WrongNumberOfElements();
+
+    /**
+     * @brief Tests the HistogramGAM::Setup method that fails with an invalid BinMode.
+     */
+    bool TestSetup_InvalidBinMode();
+
+    /**
+     * @brief Tests the HistogramGAM::Setup method that fails if SignificantDigits > 5.
+     */
+    bool TestSetup_InvalidSignificantDigits();
+
+    /**
+     * @brief Tests the HistogramGAM::Execute method with log-linear bins.
+     */
+    bool TestExecute_LogLinear();
+
+    /**
+     * @brief Tests the HistogramGAM::ExportHistogram method.
+     */
+    bool TestExportHistogram();
+
+    /**
+     * @brief Tests the HistogramGAM::MergeHistograms method.
+     */
+    bool TestMergeHistograms();
+
+    /**
+     * @brief Tests that the HistogramGAM::MergeHistograms method fails if the bins are different.
+     */
+    bool TestMergeHistograms_DifferentBins();
+
     /**
      * @brief Tests the PrepareNextState without a reset
      */
@@ -136,6 +182,26 @@ public:
      */
     bool TestPrepareNextState_Reset_State();
 
+    /**
+     * @brief Tests that the histograms of two HistogramGAM are merged by a HistogramRegistry (also after a reset).
+     */
+    bool TestRegistry();
+
+    /**
+     * @brief Tests that the Setup fails if the histograms registered with the same name have different bins.
+     */
+    bool TestRegistry_DifferentBins();
+
+    /**
+     * @brief Tests that the Initialise fails if the Registry does not exist.
+     */
+    bool TestRegistry_InvalidRegistry();
+
+    /**
+     * @brief Tests the ExportHistograms RPC and the file written by the HistogramRegistry.
+     */
+    bool TestRegistry_ExportHistograms();
+
 };
 
 /*---------------------------------------------------------------------------*/
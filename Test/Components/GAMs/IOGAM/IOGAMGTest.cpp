@@ -72,6 +72,11 @@ TEST(IOGAMGTest,TestExecute_Samples) {
     IOGAMTest test;
     ASSERT_TRUE(test.TestExecute_Samples());
 }
+
+TEST(IOGAMGTest,TestExecute_FixedSizeCopy) {
+    IOGAMTest test;
+    ASSERT_TRUE(test.TestExecute_FixedSizeCopy());
+}
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
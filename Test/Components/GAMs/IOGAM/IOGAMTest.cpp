@@ -667,3 +667,90 @@ bool IOGAMTest::TestExecute_Samples() {
     return ok;
 
 }
+
+bool IOGAMTest::TestExecute_FixedSizeCopy() {
+    using namespace MARTe;
+    const MARTe::char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = IOGAMHelper"
+            "            InputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float32"
+            "                   NumberOfElements = 3"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "                   NumberOfElements = 3"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = IOGAMDataSourceHelper"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+    bool ok = TestIntegratedInApplication(config1, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<IOGAMHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        //3 x float32 = 12 bytes
+        ok = gam->IsFixedSizeCopy();
+    }
+    if (ok) {
+        float32 *inMem = static_cast<float32 *>(gam->GetInputSignalsMemory());
+        float32 *outMem = static_cast<float32 *>(gam->GetOutputSignalsMemory());
+        uint32 n;
+        for (n = 0; n < 3; n++) {
+            inMem[n] = static_cast<float32>(n) + 0.5F;
+            outMem[n] = 0.F;
+        }
+        ok = gam->Execute();
+    }
+    if (ok) {
+        float32 *outMem = static_cast<float32 *>(gam->GetOutputSignalsMemory());
+        uint32 n;
+        for (n = 0; (n < 3) && (ok); n++) {
+            ok = (outMem[n] == (static_cast<float32>(n) + 0.5F));
+        }
+    }
+    god->Purge();
+    return ok;
+}
@@ -74,6 +74,11 @@ public:
      * @brief Tests the Execute method with samples > 0.
      */
     bool TestExecute_Samples();
+
+    /**
+     * @brief Tests that the Execute method uses a FixedSizeCopy kernel for a small total size (3 x float32).
+     */
+    bool TestExecute_FixedSizeCopy();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -107,3 +107,23 @@ TEST(Interleaved2FlatGAMGTest,TestExecute_MultiPacketNoSamples) {
     Interleaved2FlatGAMTest test;
     ASSERT_TRUE(test.TestExecute_MultiPacketNoSamples());
 }
+
+TEST(Interleaved2FlatGAMGTest,TestStridedCopy) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestStridedCopy());
+}
+
+TEST(Interleaved2FlatGAMGTest,TestFixedSizeCopy) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestFixedSizeCopy());
+}
+
+TEST(Interleaved2FlatGAMGTest,TestTranspose_Uint16) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestTranspose_Uint16());
+}
+
+TEST(Interleaved2FlatGAMGTest,TestTranspose_Uint32) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestTranspose_Uint32());
+}
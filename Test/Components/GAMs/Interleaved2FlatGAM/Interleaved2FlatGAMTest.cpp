@@ -76,6 +76,14 @@ Interleaved2FlatGAMTestGAM    ();
     void *GetInputSignalsMemory1();
 
     void *GetOutputSignalsMemory1();
+
+    static void CallStridedCopy(uint8 * const destination,
+                                const uint8 * const source,
+                                const Interleaved2FlatGAMCopy &copy);
+
+    static void CallTranspose(uint8 * const destination,
+                              const uint8 * const source,
+                              const Interleaved2FlatGAMTranspose &transpose);
 };
 
 Interleaved2FlatGAMTestGAM::Interleaved2FlatGAMTestGAM() {
@@ -86,6 +94,18 @@ Interleaved2FlatGAMTestGAM::~Interleaved2FlatGAMTestGAM() {
 
 }
 
+void Interleaved2FlatGAMTestGAM::CallStridedCopy(uint8 * const destination,
+                                                 const uint8 * const source,
+                                                 const Interleaved2FlatGAMCopy &copy) {
+    StridedCopy(destination, source, copy);
+}
+
+void Interleaved2FlatGAMTestGAM::CallTranspose(uint8 * const destination,
+                                               const uint8 * const source,
+                                               const Interleaved2FlatGAMTranspose &transpose) {
+    Transpose(destination, source, transpose);
+}
+
 uint32 *Interleaved2FlatGAMTestGAM::GetNumberOfInputSamples() {
     return numberOfInputSamples;
 }
@@ -2994,3 +3014,125 @@ bool Interleaved2FlatGAMTest::TestExecute_MultiPacketNoSamples() {
     }
     return ret;
 }
+
+bool Interleaved2FlatGAMTest::TestStridedCopy() {
+    const uint32 count = 7u;
+    const uint32 size = 3u;
+    const uint32 sourceStride = 5u;
+    const uint32 destinationStride = 4u;
+    uint8 source[count * sourceStride];
+    uint8 destination[count * destinationStride];
+    uint32 i;
+    for (i = 0u; i < (count * sourceStride); i++) {
+        source[i] = static_cast<uint8>(i + 1u);
+    }
+    for (i = 0u; i < (count * destinationStride); i++) {
+        destination[i] = 0u;
+    }
+    Interleaved2FlatGAMCopy copy;
+    copy.sourceOffset = 0u;
+    copy.sourceStride = sourceStride;
+    copy.destinationOffset = 0u;
+    copy.destinationStride = destinationStride;
+    copy.size = size;
+    copy.count = count;
+    Interleaved2FlatGAMTestGAM::CallStridedCopy(&destination[0], &source[0], copy);
+    bool ret = true;
+    uint32 j;
+    for (i = 0u; (i < count) && (ret); i++) {
+        for (j = 0u; (j < destinationStride) && (ret); j++) {
+            uint8 expected = (j < size) ? source[(i * sourceStride) + j] : 0u;
+            ret = (destination[(i * destinationStride) + j] == expected);
+        }
+    }
+    return ret;
+}
+
+bool Interleaved2FlatGAMTest::TestTranspose_Uint16() {
+    const uint32 rows = 13u;
+    const uint32 columns = 11u;
+    uint16 source[rows * columns];
+    uint16 destination[rows * columns];
+    uint32 i;
+    for (i = 0u; i < (rows * columns); i++) {
+        source[i] = static_cast<uint16>((i * 7u) + 3u);
+        destination[i] = 0u;
+    }
+    Interleaved2FlatGAMTranspose transpose;
+    transpose.sourceOffset = 0u;
+    transpose.destinationOffset = 0u;
+    transpose.rows = rows;
+    transpose.columns = columns;
+    transpose.elementSize = static_cast<uint32>(sizeof(uint16));
+    Interleaved2FlatGAMTestGAM::CallTranspose(reinterpret_cast<uint8 *>(&destination[0]), reinterpret_cast<uint8 *>(&source[0]), transpose);
+    bool ret = true;
+    uint32 j;
+    for (i = 0u; (i < rows) && (ret); i++) {
+        for (j = 0u; (j < columns) && (ret); j++) {
+            ret = (destination[(j * rows) + i] == source[(i * columns) + j]);
+        }
+    }
+    return ret;
+}
+
+bool Interleaved2FlatGAMTest::TestTranspose_Uint32() {
+    const uint32 rows = 9u;
+    const uint32 columns = 14u;
+    uint32 source[rows * columns];
+    uint32 destination[rows * columns];
+    uint32 i;
+    for (i = 0u; i < (rows * columns); i++) {
+        source[i] = (i * 100003u) + 1u;
+        destination[i] = 0u;
+    }
+    Interleaved2FlatGAMTranspose transpose;
+    transpose.sourceOffset = 0u;
+    transpose.destinationOffset = 0u;
+    transpose.rows = rows;
+    transpose.columns = columns;
+    transpose.elementSize = static_cast<uint32>(sizeof(uint32));
+    Interleaved2FlatGAMTestGAM::CallTranspose(reinterpret_cast<uint8 *>(&destination[0]), reinterpret_cast<uint8 *>(&source[0]), transpose);
+    bool ret = true;
+    uint32 j;
+    for (i = 0u; (i < rows) && (ret); i++) {
+        for (j = 0u; (j < columns) && (ret); j++) {
+            ret = (destination[(j * rows) + i] == source[(i * columns) + j]);
+        }
+    }
+    return ret;
+}
+
+bool Interleaved2FlatGAMTest::TestFixedSizeCopy() {
+    const uint32 count = 8u;
+    const uint32 size = 16u;
+    const uint32 sourceStride = 40u;
+    const uint32 destinationStride = size;
+    uint8 source[count * sourceStride];
+    uint8 destination[(count * destinationStride) + 1u];
+    uint32 i;
+    for (i = 0u; i < (count * sourceStride); i++) {
+        source[i] = static_cast<uint8>(i + 1u);
+    }
+    for (i = 0u; i < ((count * destinationStride) + 1u); i++) {
+        destination[i] = 0u;
+    }
+    FixedSizeCopyFunction function = GetFixedSizeCopy(size, count);
+    bool ret = (function != NULL_PTR(FixedSizeCopyFunction));
+    if (ret) {
+        //Unaligned destination
+        function(&destination[1], &source[0], destinationStride, sourceStride);
+    }
+    uint32 j;
+    for (i = 0u; (i < count) && (ret); i++) {
+        for (j = 0u; (j < size) && (ret); j++) {
+            ret = (destination[1u + (i * destinationStride) + j] == source[(i * sourceStride) + j]);
+        }
+    }
+    if (ret) {
+        ret = (destination[0] == 0u);
+    }
+    if (ret) {
+        ret = (GetFixedSizeCopy(5u, 7u) == NULL_PTR(FixedSizeCopyFunction));
+    }
+    return ret;
+}
@@ -121,6 +121,26 @@ public:
      */
     bool TestExecute_MultiPacketNoSamples();
 
+    /**
+     * @brief Tests the StridedCopy kernel.
+     */
+    bool TestStridedCopy();
+
+    /**
+     * @brief Tests the Transpose kernel with 2 byte elements and sizes which are not multiple of the SIMD block.
+     */
+    bool TestTranspose_Uint16();
+
+    /**
+     * @brief Tests the Transpose kernel with 4 byte elements and sizes which are not multiple of the SIMD block.
+     */
+    bool TestTranspose_Uint32();
+
+    /**
+     * @brief Tests the FixedSizeCopy kernel selected for 8 blocks of 16 bytes and that there is no kernel for a size which is not in the table.
+     */
+    bool TestFixedSizeCopy();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,89 @@
+/**
+ * @file KalmanFilterGAMGTest.cpp
+ * @brief Source file for class KalmanFilterGAMGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class KalmanFilterGAMGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "KalmanFilterGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(KalmanFilterGAMGTest,TestConstructor) {
+    KalmanFilterGAMTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(KalmanFilterGAMGTest,TestInitialise) {
+    KalmanFilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(KalmanFilterGAMGTest,TestInitialise_Dynamic) {
+    KalmanFilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_Dynamic());
+}
+
+TEST(KalmanFilterGAMGTest,TestInitialise_FalseNoStateMatrix) {
+    KalmanFilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseNoStateMatrix());
+}
+
+TEST(KalmanFilterGAMGTest,TestInitialise_FalseWrongDimensions) {
+    KalmanFilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseWrongDimensions());
+}
+
+TEST(KalmanFilterGAMGTest,TestInitialise_FalseBadKernel) {
+    KalmanFilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadKernel());
+}
+
+TEST(KalmanFilterGAMGTest,TestSetup_FalseBadSignal) {
+    KalmanFilterGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadSignal());
+}
+
+TEST(KalmanFilterGAMGTest,TestExecute_Constant) {
+    KalmanFilterGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Constant());
+}
+
+TEST(KalmanFilterGAMGTest,TestExecute_FixedEqualsDynamic) {
+    KalmanFilterGAMTest test;
+    ASSERT_TRUE(test.TestExecute_FixedEqualsDynamic());
+}
+
+TEST(KalmanFilterGAMGTest,TestPrepareNextState) {
+    KalmanFilterGAMTest test;
+    ASSERT_TRUE(test.TestPrepareNextState());
+}
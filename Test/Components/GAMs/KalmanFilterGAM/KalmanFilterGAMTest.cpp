@@ -0,0 +1,492 @@
+/**
+ * @file KalmanFilterGAMTest.cpp
+ * @brief Source file for class KalmanFilterGAMTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class KalmanFilterGAMTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "KalmanFilterGAMTest.h"
+#include "MemoryDataSourceI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class KalmanFilterGAMTestGAM: public KalmanFilterGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    void *GetInputSignalMemory(const uint32 signalIdx);
+
+    void *GetOutputSignalMemory(const uint32 signalIdx);
+};
+
+void *KalmanFilterGAMTestGAM::GetInputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetInputSignalMemory(signalIdx);
+}
+
+void *KalmanFilterGAMTestGAM::GetOutputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetOutputSignalMemory(signalIdx);
+}
+
+CLASS_REGISTER(KalmanFilterGAMTestGAM, "1.0")
+
+class KalmanFilterGAMTestDS: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+            const char8 * const nextStateName);
+
+    virtual bool Synchronise();
+
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+};
+CLASS_REGISTER(KalmanFilterGAMTestDS, "1.0")
+
+bool KalmanFilterGAMTestDS::PrepareNextState(const char8 * const currentStateName,
+        const char8 * const nextStateName) {
+    return true;
+}
+
+bool KalmanFilterGAMTestDS::Synchronise() {
+    return true;
+}
+
+const char8 *KalmanFilterGAMTestDS::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    return "MemoryMapInputBroker";
+}
+
+/**
+ * @brief Configures an application with a single KalmanFilterGAMTestGAM (GAMA) with the parameters and signals in gamConfig.
+ * The input signals shall use the Drv1 DataSource and the output signals the DDB DataSource.
+ */
+static bool InitialiseKalmanFilterApplication(const char8 * const gamConfig) {
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = KalmanFilterGAMTestGAM";
+    config += gamConfig;
+    config += ""
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = KalmanFilterGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    config.Seek(0);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT < RealTimeApplication > application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+
+/**
+ * @brief Model of the tests with one constant state measured with unit noise variance.
+ */
+static const char8 * const scalarModel = ""
+        "            StateMatrix = {{1.0}}"
+        "            MeasurementMatrix = {{1.0}}"
+        "            ProcessNoise = {{0.0}}"
+        "            MeasurementNoise = {{1.0}}"
+        "            InitialCovariance = {{100.0}}";
+
+/**
+ * @brief Signals of the tests with the scalarModel.
+ */
+static const char8 * const scalarSignals = ""
+        "            InputSignals = {"
+        "                Z = {"
+        "                    DataSource = Drv1"
+        "                    Type = float64"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                X = {"
+        "                    DataSource = DDB"
+        "                    Type = float64"
+        "                }"
+        "                Variance = {"
+        "                    DataSource = DDB"
+        "                    Type = float64"
+        "                }"
+        "            }";
+
+/**
+ * @brief Model of the tests with a position and a velocity, driven by an acceleration and with the position measured.
+ */
+static const char8 * const cartModel = ""
+        "            StateMatrix = {{1.0 0.1} {0.0 1.0}}"
+        "            InputMatrix = {{0.005} {0.1}}"
+        "            MeasurementMatrix = {{1.0 0.0}}"
+        "            ProcessNoise = {{1e-6 0.0} {0.0 1e-4}}"
+        "            MeasurementNoise = {{0.01}}";
+
+/**
+ * @brief Signals of the tests with the cartModel.
+ */
+static const char8 * const cartSignals = ""
+        "            InputSignals = {"
+        "                Position = {"
+        "                    DataSource = Drv1"
+        "                    Type = float64"
+        "                }"
+        "                Acceleration = {"
+        "                    DataSource = Drv1"
+        "                    Type = float64"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                State = {"
+        "                    DataSource = DDB"
+        "                    Type = float64"
+        "                    NumberOfElements = 2"
+        "                }"
+        "                Variance = {"
+        "                    DataSource = DDB"
+        "                    Type = float64"
+        "                    NumberOfElements = 2"
+        "                }"
+        "            }";
+
+/**
+ * @brief Configures the application with the model, the extra parameters and the signals and gets the GAM.
+ */
+static bool InitialiseKalmanFilterTest(const char8 * const model,
+                                       const char8 * const parameters,
+                                       const char8 * const signals,
+                                       ReferenceT<KalmanFilterGAMTestGAM> &gam) {
+    StreamString gamConfig = model;
+    gamConfig += parameters;
+    gamConfig += signals;
+    bool ok = InitialiseKalmanFilterApplication(gamConfig.Buffer());
+    if (ok) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = gam.IsValid();
+    }
+    return ok;
+}
+
+/**
+ * @brief Number of cycles of the cart tests.
+ */
+static const uint32 cartCycles = 50u;
+
+/**
+ * @brief Executes the cart model with a constant acceleration and a noisy position and stores the estimates (position and velocity
+ * of each cycle) and their variances.
+ */
+static bool ExecuteCart(const char8 * const kernel,
+                        bool &fixedSize,
+                        float64 * const estimates,
+                        float64 * const variances) {
+    ReferenceT<KalmanFilterGAMTestGAM> gam;
+    bool ok = InitialiseKalmanFilterTest(cartModel, kernel, cartSignals, gam);
+    if (ok) {
+        fixedSize = gam->IsFixedSize();
+        float64 *position = static_cast<float64 *>(gam->GetInputSignalMemory(0u));
+        float64 *acceleration = static_cast<float64 *>(gam->GetInputSignalMemory(1u));
+        float64 *state = static_cast<float64 *>(gam->GetOutputSignalMemory(0u));
+        float64 *variance = static_cast<float64 *>(gam->GetOutputSignalMemory(1u));
+        for (uint32 n = 0u; (n < cartCycles) && (ok); n++) {
+            float64 t = 0.1 * static_cast<float64>(n + 1u);
+            *acceleration = 1.0;
+            *position = (0.5 * t * t) + (((n % 2u) == 0u) ? (0.05) : (-0.05));
+            ok = gam->Execute();
+            estimates[2u * n] = state[0];
+            estimates[(2u * n) + 1u] = state[1];
+            variances[2u * n] = variance[0];
+            variances[(2u * n) + 1u] = variance[1];
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+KalmanFilterGAMTest::KalmanFilterGAMTest() {
+}
+
+KalmanFilterGAMTest::~KalmanFilterGAMTest() {
+}
+
+bool KalmanFilterGAMTest::TestConstructor() {
+    KalmanFilterGAMTestGAM gam;
+    bool ret = (gam.GetNumberOfStates() == 0u);
+    ret &= (gam.GetNumberOfMeasurements() == 0u);
+    ret &= (!gam.IsFixedSize());
+    return ret;
+}
+
+bool KalmanFilterGAMTest::TestInitialise() {
+    ReferenceT<KalmanFilterGAMTestGAM> gam;
+    bool ret = InitialiseKalmanFilterTest(cartModel, "", cartSignals, gam);
+    if (ret) {
+        ret = (gam->GetNumberOfStates() == 2u);
+        ret &= (gam->GetNumberOfMeasurements() == 1u);
+        ret &= (gam->IsFixedSize());
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool KalmanFilterGAMTest::TestInitialise_Dynamic() {
+    ReferenceT<KalmanFilterGAMTestGAM> gam;
+    bool ret = InitialiseKalmanFilterTest(cartModel, "Kernel = Dynamic", cartSignals, gam);
+    if (ret) {
+        ret = (!gam->IsFixedSize());
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (ret) {
+        //There is no step specialised on 3 states and 2 measurements.
+        const char8 * const model = ""
+                "            StateMatrix = {{1.0 0.0 0.0} {0.0 1.0 0.0} {0.0 0.0 1.0}}"
+                "            MeasurementMatrix = {{1.0 0.0 0.0} {0.0 1.0 1.0}}"
+                "            ProcessNoise = {{1.0 0.0 0.0} {0.0 1.0 0.0} {0.0 0.0 1.0}}"
+                "            MeasurementNoise = {{1.0 0.0} {0.0 1.0}}";
+        const char8 * const signals = ""
+                "            InputSignals = {"
+                "                Z = {"
+                "                    DataSource = Drv1"
+                "                    Type = float64"
+                "                    NumberOfElements = 2"
+                "                }"
+                "            }"
+                "            OutputSignals = {"
+                "                X = {"
+                "                    DataSource = DDB"
+                "                    Type = float64"
+                "                    NumberOfElements = 3"
+                "                }"
+                "            }";
+        ret = InitialiseKalmanFilterTest(model, "", signals, gam);
+        if (ret) {
+            ret = (gam->GetNumberOfStates() == 3u);
+            ret &= (gam->GetNumberOfMeasurements() == 2u);
+            ret &= (!gam->IsFixedSize());
+        }
+        ObjectRegistryDatabase::Instance()->Purge();
+    }
+    return ret;
+}
+
+bool KalmanFilterGAMTest::TestInitialise_FalseNoStateMatrix() {
+    const char8 * const model = ""
+            "            MeasurementMatrix = {{1.0}}"
+            "            ProcessNoise = {{0.0}}"
+            "            MeasurementNoise = {{1.0}}";
+    ReferenceT<KalmanFilterGAMTestGAM> gam;
+    bool ret = !InitialiseKalmanFilterTest(model, "", scalarSignals, gam);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool KalmanFilterGAMTest::TestInitialise_FalseWrongDimensions() {
+    const char8 * const model = ""
+            "            StateMatrix = {{1.0 0.1} {0.0 1.0}}"
+            "            MeasurementMatrix = {{1.0 0.0 0.0}}"
+            "            ProcessNoise = {{1e-6 0.0} {0.0 1e-4}}"
+            "            MeasurementNoise = {{0.01}}";
+    ReferenceT<KalmanFilterGAMTestGAM> gam;
+    bool ret = !InitialiseKalmanFilterTest(model, "", cartSignals, gam);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool KalmanFilterGAMTest::TestInitialise_FalseBadKernel() {
+    ReferenceT<KalmanFilterGAMTestGAM> gam;
+    bool ret = !InitialiseKalmanFilterTest(cartModel, "Kernel = Fast", cartSignals, gam);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool KalmanFilterGAMTest::TestSetup_FalseBadSignal() {
+    //The cart model has a control input which is not in the scalarSignals.
+    ReferenceT<KalmanFilterGAMTestGAM> gam;
+    bool ret = !InitialiseKalmanFilterTest(cartModel, "", scalarSignals, gam);
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (ret) {
+        const char8 * const signals = ""
+                "            InputSignals = {"
+                "                Z = {"
+                "                    DataSource = Drv1"
+                "                    Type = float32"
+                "                }"
+                "            }"
+                "            OutputSignals = {"
+                "                X = {"
+                "                    DataSource = DDB"
+                "                    Type = float64"
+                "                }"
+                "            }";
+        ret = !InitialiseKalmanFilterTest(scalarModel, "", signals, gam);
+        ObjectRegistryDatabase::Instance()->Purge();
+    }
+    return ret;
+}
+
+bool KalmanFilterGAMTest::TestExecute_Constant() {
+    ReferenceT<KalmanFilterGAMTestGAM> gam;
+    bool ret = InitialiseKalmanFilterTest(scalarModel, "", scalarSignals, gam);
+    float64 *z = NULL_PTR(float64 *);
+    float64 *x = NULL_PTR(float64 *);
+    float64 *variance = NULL_PTR(float64 *);
+    if (ret) {
+        z = static_cast<float64 *>(gam->GetInputSignalMemory(0u));
+        x = static_cast<float64 *>(gam->GetOutputSignalMemory(0u));
+        variance = static_cast<float64 *>(gam->GetOutputSignalMemory(1u));
+    }
+    const uint32 numberOfCycles = 1000u;
+    for (uint32 n = 0u; (n < numberOfCycles) && (ret); n++) {
+        *z = 5.0 + (((n % 2u) == 0u) ? (0.5) : (-0.5));
+        ret = gam->Execute();
+    }
+    if (ret) {
+        //The estimate is the (weighted) mean of the measurements and its variance is 1 / (1 / 100 + numberOfCycles).
+        ret = (fabs(*x - 5.0) < 1e-3);
+        ret &= (fabs(*variance - (1.0 / (0.01 + static_cast<float64>(numberOfCycles)))) < 1e-9);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool KalmanFilterGAMTest::TestExecute_FixedEqualsDynamic() {
+    float64 fixedEstimates[2u * cartCycles];
+    float64 fixedVariances[2u * cartCycles];
+    float64 dynamicEstimates[2u * cartCycles];
+    float64 dynamicVariances[2u * cartCycles];
+    bool fixedSize = false;
+    bool ret = ExecuteCart("Kernel = Auto", fixedSize, &fixedEstimates[0], &fixedVariances[0]);
+    if (ret) {
+        ret = fixedSize;
+    }
+    if (ret) {
+        ret = ExecuteCart("Kernel = Dynamic", fixedSize, &dynamicEstimates[0], &dynamicVariances[0]);
+    }
+    if (ret) {
+        ret = !fixedSize;
+    }
+    for (uint32 i = 0u; (i < (2u * cartCycles)) && (ret); i++) {
+        ret = (fabs(fixedEstimates[i] - dynamicEstimates[i]) < 1e-12);
+        ret &= (fabs(fixedVariances[i] - dynamicVariances[i]) < 1e-12);
+    }
+    if (ret) {
+        //The estimate follows the trajectory (position 0.5 t^2, velocity t).
+        float64 t = 0.1 * static_cast<float64>(cartCycles);
+        ret = (fabs(fixedEstimates[2u * (cartCycles - 1u)] - (0.5 * t * t)) < 0.05);
+        ret &= (fabs(fixedEstimates[(2u * (cartCycles - 1u)) + 1u] - t) < 0.2);
+        ret &= (fixedVariances[2u * (cartCycles - 1u)] < 0.01);
+    }
+    return ret;
+}
+
+bool KalmanFilterGAMTest::TestPrepareNextState() {
+    ReferenceT<KalmanFilterGAMTestGAM> gam;
+    bool ret = InitialiseKalmanFilterTest(scalarModel, "ResetInEachState = 1", scalarSignals, gam);
+    float64 *z = NULL_PTR(float64 *);
+    float64 *x = NULL_PTR(float64 *);
+    float64 firstEstimate = 0.0;
+    if (ret) {
+        z = static_cast<float64 *>(gam->GetInputSignalMemory(0u));
+        x = static_cast<float64 *>(gam->GetOutputSignalMemory(0u));
+        *z = 10.0;
+        ret = gam->Execute();
+        firstEstimate = *x;
+    }
+    for (uint32 n = 0u; (n < 10u) && (ret); n++) {
+        *z = 0.0;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = gam->PrepareNextState("State1", "State1");
+    }
+    if (ret) {
+        *z = 10.0;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (*x == firstEstimate);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file KalmanFilterGAMTest.h
+ * @brief Header file for class KalmanFilterGAMTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class KalmanFilterGAMTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef KALMANFILTERGAMTEST_H_
+#define KALMANFILTERGAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "KalmanFilterGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the KalmanFilterGAM methods
+ */
+class KalmanFilterGAMTest {
+public:
+
+    /**
+     * @brief Constructor
+     */
+    KalmanFilterGAMTest();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~KalmanFilterGAMTest();
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method with a model which has a specialised step
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests the Initialise method with Kernel = Dynamic and with a model which has no specialised step
+     */
+    bool TestInitialise_Dynamic();
+
+    /**
+     * @brief Tests that the Initialise method fails if the StateMatrix is not set
+     */
+    bool TestInitialise_FalseNoStateMatrix();
+
+    /**
+     * @brief Tests that the Initialise method fails if the MeasurementMatrix does not have a column for each state
+     */
+    bool TestInitialise_FalseWrongDimensions();
+
+    /**
+     * @brief Tests that the Initialise method fails with an unknown Kernel
+     */
+    bool TestInitialise_FalseBadKernel();
+
+    /**
+     * @brief Tests that the Setup method fails if the signals do not match the model
+     */
+    bool TestSetup_FalseBadSignal();
+
+    /**
+     * @brief Tests the Execute method estimating a constant from noisy measurements
+     */
+    bool TestExecute_Constant();
+
+    /**
+     * @brief Tests that the specialised and the dynamic steps compute the same estimate
+     */
+    bool TestExecute_FixedEqualsDynamic();
+
+    /**
+     * @brief Tests that the PrepareNextState method resets the estimate with ResetInEachState = 1
+     */
+    bool TestPrepareNextState();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* KALMANFILTERGAMTEST_H_ */
@@ -0,0 +1,119 @@
+/**
+ * @file LockInGAMGTest.cpp
+ * @brief Source file for class LockInGAMGTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LockInGAMGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "LockInGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(LockInGAMGTest,TestConstructor) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(LockInGAMGTest,TestInitialise) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(LockInGAMGTest,TestInitialise_FalseNoSamplingFrequency) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseNoSamplingFrequency());
+}
+
+TEST(LockInGAMGTest,TestInitialise_FalseBadFrequency) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadFrequency());
+}
+
+TEST(LockInGAMGTest,TestInitialise_FalseBadCutOffFrequency) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadCutOffFrequency());
+}
+
+TEST(LockInGAMGTest,TestInitialise_FalseBadFilterOrder) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadFilterOrder());
+}
+
+TEST(LockInGAMGTest,TestInitialise_FalseBadOutput) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadOutput());
+}
+
+TEST(LockInGAMGTest,TestInitialise_FalseBadMethod) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadMethod());
+}
+
+TEST(LockInGAMGTest,TestSetup) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestSetup());
+}
+
+TEST(LockInGAMGTest,TestSetup_DefaultDecimation) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestSetup_DefaultDecimation());
+}
+
+TEST(LockInGAMGTest,TestSetup_FalseNumberOfOutputSignals) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseNumberOfOutputSignals());
+}
+
+TEST(LockInGAMGTest,TestSetup_FalseBadDecimation) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadDecimation());
+}
+
+TEST(LockInGAMGTest,TestSetup_FalseBadOutputNElements) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadOutputNElements());
+}
+
+TEST(LockInGAMGTest,TestSetup_FalseBadOutputType) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadOutputType());
+}
+
+TEST(LockInGAMGTest,TestExecute_AmplitudePhase) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestExecute_AmplitudePhase());
+}
+
+TEST(LockInGAMGTest,TestExecute_InPhaseQuadrature) {
+    LockInGAMTest test;
+    ASSERT_TRUE(test.TestExecute_InPhaseQuadrature());
+}
@@ -0,0 +1,597 @@
+/**
+ * @file LockInGAMTest.cpp
+ * @brief Source file for class LockInGAMTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LockInGAMTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "FastMath.h"
+#include "LockInGAMTest.h"
+#include "MemoryDataSourceI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class LockInGAMTestGAM: public LockInGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    void *GetInputSignalMemory(const uint32 signalIdx);
+
+    void *GetOutputSignalMemory(const uint32 signalIdx);
+};
+
+void *LockInGAMTestGAM::GetInputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetInputSignalMemory(signalIdx);
+}
+
+void *LockInGAMTestGAM::GetOutputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetOutputSignalMemory(signalIdx);
+}
+
+CLASS_REGISTER(LockInGAMTestGAM, "1.0")
+
+class LockInGAMTestDS: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+            const char8 * const nextStateName);
+
+    virtual bool Synchronise();
+
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+};
+CLASS_REGISTER(LockInGAMTestDS, "1.0")
+
+bool LockInGAMTestDS::PrepareNextState(const char8 * const currentStateName,
+        const char8 * const nextStateName) {
+    return true;
+}
+
+bool LockInGAMTestDS::Synchronise() {
+    return true;
+}
+
+const char8 *LockInGAMTestDS::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    return "MemoryMapInputBroker";
+}
+
+/**
+ * @brief Configures an application with a single LockInGAMTestGAM (GAMA) with the parameters and signals in gamConfig.
+ * The input signals shall use the Drv1 DataSource and the output signals the DDB DataSource.
+ */
+static bool InitialiseLockInApplication(const char8 * const gamConfig) {
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = LockInGAMTestGAM";
+    config += gamConfig;
+    config += ""
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = LockInGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    config.Seek(0);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT < RealTimeApplication > application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * @brief Calls the LockInGAM::Initialise with the parameters in config.
+ */
+static bool InitialiseLockInGAM(const char8 * const config) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        LockInGAMTestGAM gam;
+        cdb.MoveToRoot();
+        ok = gam.Initialise(cdb);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+LockInGAMTest::LockInGAMTest() {
+}
+
+LockInGAMTest::~LockInGAMTest() {
+}
+
+bool LockInGAMTest::TestConstructor() {
+    LockInGAMTestGAM gam;
+    bool ret = (gam.GetFilterGain() == 0.);
+    ret &= (gam.GetFilterOrder() == 1u);
+    ret &= (gam.GetDecimation() == 0u);
+    return ret;
+}
+
+bool LockInGAMTest::TestInitialise() {
+    const char8 * const config = ""
+            "SamplingFrequency = 16000\n"
+            "Frequency = 1000\n"
+            "CutOffFrequency = 16\n"
+            "FilterOrder = 3\n"
+            "Decimation = 16\n";
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ret = parser.Parse();
+    LockInGAMTestGAM gam;
+    if (ret) {
+        cdb.MoveToRoot();
+        ret = gam.Initialise(cdb);
+    }
+    if (ret) {
+        ret = (fabs(gam.GetFilterGain() - (1.0 - exp((-2.0 * FastMath::PI * 16.0) / 16000.0))) < 1e-12);
+        ret &= (gam.GetFilterOrder() == 3u);
+        ret &= (gam.GetDecimation() == 16u);
+    }
+    return ret;
+}
+
+bool LockInGAMTest::TestInitialise_FalseNoSamplingFrequency() {
+    return !InitialiseLockInGAM("Frequency = 1000\n"
+                                "CutOffFrequency = 16\n");
+}
+
+bool LockInGAMTest::TestInitialise_FalseBadFrequency() {
+    bool ret = !InitialiseLockInGAM("SamplingFrequency = 16000\n"
+                                    "Frequency = 8000\n"
+                                    "CutOffFrequency = 16\n");
+    if (ret) {
+        ret = !InitialiseLockInGAM("SamplingFrequency = 16000\n"
+                                   "CutOffFrequency = 16\n");
+    }
+    return ret;
+}
+
+bool LockInGAMTest::TestInitialise_FalseBadCutOffFrequency() {
+    return !InitialiseLockInGAM("SamplingFrequency = 16000\n"
+                                "Frequency = 1000\n"
+                                "CutOffFrequency = 0\n");
+}
+
+bool LockInGAMTest::TestInitialise_FalseBadFilterOrder() {
+    return !InitialiseLockInGAM("SamplingFrequency = 16000\n"
+                                "Frequency = 1000\n"
+                                "CutOffFrequency = 16\n"
+                                "FilterOrder = 9\n");
+}
+
+bool LockInGAMTest::TestInitialise_FalseBadOutput() {
+    return !InitialiseLockInGAM("SamplingFrequency = 16000\n"
+                                "Frequency = 1000\n"
+                                "CutOffFrequency = 16\n"
+                                "Output = Power\n");
+}
+
+bool LockInGAMTest::TestInitialise_FalseBadMethod() {
+    return !InitialiseLockInGAM("SamplingFrequency = 16000\n"
+                                "Frequency = 1000\n"
+                                "CutOffFrequency = 16\n"
+                                "Method = Polynomial\n");
+}
+
+bool LockInGAMTest::TestSetup() {
+    const char8 * const gamConfig = ""
+            "            SamplingFrequency = 16000"
+            "            Frequency = 1000"
+            "            CutOffFrequency = 16"
+            "            Decimation = 16"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = int16"
+            "                    NumberOfElements = 64"
+            "                }"
+            "                X1 = {"
+            "                    DataSource = Drv1"
+            "                    Type = int16"
+            "                    NumberOfElements = 64"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                A0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 4"
+            "                }"
+            "                P0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 4"
+            "                }"
+            "                A1 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 4"
+            "                }"
+            "                P1 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 4"
+            "                }"
+            "            }";
+    bool ret = InitialiseLockInApplication(gamConfig);
+    ReferenceT<LockInGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        ret = (gam->GetDecimation() == 16u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool LockInGAMTest::TestSetup_DefaultDecimation() {
+    const char8 * const gamConfig = ""
+            "            SamplingFrequency = 16000"
+            "            Frequency = 1000"
+            "            CutOffFrequency = 16"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                    NumberOfElements = 64"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                A0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 1"
+            "                }"
+            "                P0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 1"
+            "                }"
+            "            }";
+    bool ret = InitialiseLockInApplication(gamConfig);
+    ReferenceT<LockInGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        ret = (gam->GetDecimation() == 64u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool LockInGAMTest::TestSetup_FalseNumberOfOutputSignals() {
+    const char8 * const gamConfig = ""
+            "            SamplingFrequency = 16000"
+            "            Frequency = 1000"
+            "            CutOffFrequency = 16"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                    NumberOfElements = 64"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                A0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 1"
+            "                }"
+            "            }";
+    bool ret = !InitialiseLockInApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool LockInGAMTest::TestSetup_FalseBadDecimation() {
+    const char8 * const gamConfig = ""
+            "            SamplingFrequency = 16000"
+            "            Frequency = 1000"
+            "            CutOffFrequency = 16"
+            "            Decimation = 24"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                    NumberOfElements = 64"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                A0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 2"
+            "                }"
+            "                P0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 2"
+            "                }"
+            "            }";
+    bool ret = !InitialiseLockInApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool LockInGAMTest::TestSetup_FalseBadOutputNElements() {
+    const char8 * const gamConfig = ""
+            "            SamplingFrequency = 16000"
+            "            Frequency = 1000"
+            "            CutOffFrequency = 16"
+            "            Decimation = 16"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                    NumberOfElements = 64"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                A0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 4"
+            "                }"
+            "                P0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 2"
+            "                }"
+            "            }";
+    bool ret = !InitialiseLockInApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool LockInGAMTest::TestSetup_FalseBadOutputType() {
+    const char8 * const gamConfig = ""
+            "            SamplingFrequency = 16000"
+            "            Frequency = 1000"
+            "            CutOffFrequency = 16"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                    NumberOfElements = 64"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                A0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 1"
+            "                }"
+            "                P0 = {"
+            "                    DataSource = DDB"
+            "                    Type = int32"
+            "                    NumberOfElements = 1"
+            "                }"
+            "            }";
+    bool ret = !InitialiseLockInApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool LockInGAMTest::TestExecute_AmplitudePhase() {
+    const char8 * const gamConfig = ""
+            "            SamplingFrequency = 16000"
+            "            Frequency = 1000"
+            "            CutOffFrequency = 16"
+            "            Phase = 0.25"
+            "            FilterOrder = 2"
+            "            Decimation = 16"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                    NumberOfElements = 64"
+            "                }"
+            "                X1 = {"
+            "                    DataSource = Drv1"
+            "                    Type = int16"
+            "                    NumberOfElements = 64"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                A0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float64"
+            "                    NumberOfElements = 4"
+            "                }"
+            "                P0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float64"
+            "                    NumberOfElements = 4"
+            "                }"
+            "                A1 = {"
+            "                    DataSource = DDB"
+            "                    Type = float64"
+            "                    NumberOfElements = 4"
+            "                }"
+            "                P1 = {"
+            "                    DataSource = DDB"
+            "                    Type = float64"
+            "                    NumberOfElements = 4"
+            "                }"
+            "            }";
+    bool ret = InitialiseLockInApplication(gamConfig);
+    ReferenceT<LockInGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        float32 *x0 = static_cast<float32 *>(gam->GetInputSignalMemory(0u));
+        int16 *x1 = static_cast<int16 *>(gam->GetInputSignalMemory(1u));
+        uint32 sample = 0u;
+        /* The 2 kHz ripple of the mixer is attenuated by ~(16 / 2000)^2 after 400 cycles (> 20 time constants) */
+        for (uint32 c = 0u; (c < 400u) && (ret); c++) {
+            for (uint32 n = 0u; n < 64u; n++) {
+                float64 referencePhase = ((2.0 * FastMath::PI * 1000.0 * static_cast<float64>(sample)) / 16000.0) + 0.25;
+                x0[n] = static_cast<float32>(2.0 * cos(referencePhase + 0.5));
+                x1[n] = static_cast<int16>(floor((1000.0 * cos(referencePhase - 1.0)) + 0.5));
+                sample++;
+            }
+            ret = gam->Execute();
+        }
+    }
+    if (ret) {
+        float64 *a0 = static_cast<float64 *>(gam->GetOutputSignalMemory(0u));
+        float64 *p0 = static_cast<float64 *>(gam->GetOutputSignalMemory(1u));
+        float64 *a1 = static_cast<float64 *>(gam->GetOutputSignalMemory(2u));
+        float64 *p1 = static_cast<float64 *>(gam->GetOutputSignalMemory(3u));
+        for (uint32 i = 0u; (i < 4u) && (ret); i++) {
+            ret = (fabs(a0[i] - 2.0) < 2e-3);
+            ret &= (fabs(p0[i] - 0.5) < 2e-3);
+            ret &= (fabs(a1[i] - 1000.0) < 1.0);
+            ret &= (fabs(p1[i] + 1.0) < 2e-3);
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool LockInGAMTest::TestExecute_InPhaseQuadrature() {
+    const char8 * const gamConfig = ""
+            "            SamplingFrequency = 16000"
+            "            Frequency = 1000"
+            "            CutOffFrequency = 16"
+            "            Output = InPhaseQuadrature"
+            "            Method = Direct"
+            "            FilterOrder = 3"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = float64"
+            "                    NumberOfElements = 64"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                X = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 1"
+            "                }"
+            "                Y = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 1"
+            "                }"
+            "            }";
+    bool ret = InitialiseLockInApplication(gamConfig);
+    ReferenceT<LockInGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        float64 *x0 = static_cast<float64 *>(gam->GetInputSignalMemory(0u));
+        uint32 sample = 0u;
+        for (uint32 c = 0u; (c < 400u) && (ret); c++) {
+            for (uint32 n = 0u; n < 64u; n++) {
+                x0[n] = 3.0 * sin((2.0 * FastMath::PI * 1000.0 * static_cast<float64>(sample)) / 16000.0);
+                sample++;
+            }
+            ret = gam->Execute();
+        }
+    }
+    if (ret) {
+        /* sin = cos(phase - pi / 2), i.e. X = 0 and Y = -3 */
+        float32 *x = static_cast<float32 *>(gam->GetOutputSignalMemory(0u));
+        float32 *y = static_cast<float32 *>(gam->GetOutputSignalMemory(1u));
+        ret = (fabs(x[0]) < 2e-3);
+        ret &= (fabs(y[0] + 3.0) < 2e-3);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
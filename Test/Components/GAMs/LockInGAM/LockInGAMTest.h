@@ -0,0 +1,142 @@
+/**
+ * @file LockInGAMTest.h
+ * @brief Header file for class LockInGAMTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class LockInGAMTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LOCKINGAMTEST_H_
+#define LOCKINGAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "LockInGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the LockInGAM methods
+ */
+class LockInGAMTest {
+public:
+
+    /**
+     * @brief Constructor
+     */
+    LockInGAMTest();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~LockInGAMTest();
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method and the computed filter gain
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails without SamplingFrequency
+     */
+    bool TestInitialise_FalseNoSamplingFrequency();
+
+    /**
+     * @brief Tests that the Initialise method fails without Frequency or with Frequency >= SamplingFrequency / 2
+     */
+    bool TestInitialise_FalseBadFrequency();
+
+    /**
+     * @brief Tests that the Initialise method fails with CutOffFrequency = 0
+     */
+    bool TestInitialise_FalseBadCutOffFrequency();
+
+    /**
+     * @brief Tests that the Initialise method fails with FilterOrder > 8
+     */
+    bool TestInitialise_FalseBadFilterOrder();
+
+    /**
+     * @brief Tests that the Initialise method fails with an unknown Output
+     */
+    bool TestInitialise_FalseBadOutput();
+
+    /**
+     * @brief Tests that the Initialise method fails with an unknown Method
+     */
+    bool TestInitialise_FalseBadMethod();
+
+    /**
+     * @brief Tests the Setup method
+     */
+    bool TestSetup();
+
+    /**
+     * @brief Tests that the Setup method sets Decimation to the number of samples per cycle if not configured
+     */
+    bool TestSetup_DefaultDecimation();
+
+    /**
+     * @brief Tests that the Setup method fails if there are not two output signals per channel
+     */
+    bool TestSetup_FalseNumberOfOutputSignals();
+
+    /**
+     * @brief Tests that the Setup method fails if Decimation does not divide the number of samples per cycle
+     */
+    bool TestSetup_FalseBadDecimation();
+
+    /**
+     * @brief Tests that the Setup method fails if the output signals do not have the expected number of elements
+     */
+    bool TestSetup_FalseBadOutputNElements();
+
+    /**
+     * @brief Tests that the Setup method fails with an unsupported output type
+     */
+    bool TestSetup_FalseBadOutputType();
+
+    /**
+     * @brief Tests the Execute method with Output = AmplitudePhase and two channels of different types
+     */
+    bool TestExecute_AmplitudePhase();
+
+    /**
+     * @brief Tests the Execute method with Output = InPhaseQuadrature and Method = Direct
+     */
+    bool TestExecute_InPhaseQuadrature();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LOCKINGAMTEST_H_ */
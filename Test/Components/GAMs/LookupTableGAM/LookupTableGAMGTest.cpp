@@ -0,0 +1,104 @@
+/**
+ * @file LookupTableGAMGTest.cpp
+ * @brief Source file for class LookupTableGAMGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LookupTableGAMGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "LookupTableGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(LookupTableGAMGTest,TestConstructor) {
+    LookupTableGAMTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(LookupTableGAMGTest,TestInitialise_1D) {
+    LookupTableGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_1D());
+}
+
+TEST(LookupTableGAMGTest,TestInitialise_2D) {
+    LookupTableGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_2D());
+}
+
+TEST(LookupTableGAMGTest,TestInitialise_File) {
+    LookupTableGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_File());
+}
+
+TEST(LookupTableGAMGTest,TestInitialise_FalseNotIncreasing) {
+    LookupTableGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseNotIncreasing());
+}
+
+TEST(LookupTableGAMGTest,TestInitialise_FalseTableSize) {
+    LookupTableGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseTableSize());
+}
+
+TEST(LookupTableGAMGTest,TestInitialise_FalseBadExtrapolation) {
+    LookupTableGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadExtrapolation());
+}
+
+TEST(LookupTableGAMGTest,TestSetup_FalseNumberOfInputs) {
+    LookupTableGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseNumberOfInputs());
+}
+
+TEST(LookupTableGAMGTest,TestSetup_FalseBadType) {
+    LookupTableGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadType());
+}
+
+TEST(LookupTableGAMGTest,TestExecute_1D) {
+    LookupTableGAMTest test;
+    ASSERT_TRUE(test.TestExecute_1D());
+}
+
+TEST(LookupTableGAMGTest,TestExecute_2D) {
+    LookupTableGAMTest test;
+    ASSERT_TRUE(test.TestExecute_2D());
+}
+
+TEST(LookupTableGAMGTest,TestExecute_LinearExtrapolation) {
+    LookupTableGAMTest test;
+    ASSERT_TRUE(test.TestExecute_LinearExtrapolation());
+}
+
+TEST(LookupTableGAMGTest,TestExecute_CachedCells) {
+    LookupTableGAMTest test;
+    ASSERT_TRUE(test.TestExecute_CachedCells());
+}
@@ -0,0 +1,547 @@
+/**
+ * @file LookupTableGAMTest.cpp
+ * @brief Source file for class LookupTableGAMTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LookupTableGAMTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "BasicFile.h"
+#include "ConfigurationDatabase.h"
+#include "Directory.h"
+#include "LookupTableGAMTest.h"
+#include "MemoryDataSourceI.h"
+#include "MemoryOperationsHelper.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class LookupTableGAMTestGAM: public LookupTableGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    void *GetInputSignalMemory(const uint32 signalIdx);
+
+    void *GetOutputSignalMemory(const uint32 signalIdx);
+};
+
+void *LookupTableGAMTestGAM::GetInputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetInputSignalMemory(signalIdx);
+}
+
+void *LookupTableGAMTestGAM::GetOutputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetOutputSignalMemory(signalIdx);
+}
+
+CLASS_REGISTER(LookupTableGAMTestGAM, "1.0")
+
+class LookupTableGAMTestDS: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+            const char8 * const nextStateName);
+
+    virtual bool Synchronise();
+
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+};
+CLASS_REGISTER(LookupTableGAMTestDS, "1.0")
+
+bool LookupTableGAMTestDS::PrepareNextState(const char8 * const currentStateName,
+        const char8 * const nextStateName) {
+    return true;
+}
+
+bool LookupTableGAMTestDS::Synchronise() {
+    return true;
+}
+
+const char8 *LookupTableGAMTestDS::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    return "MemoryMapInputBroker";
+}
+
+/**
+ * @brief Configures an application with a single LookupTableGAMTestGAM (GAMA) with the parameters and signals in gamConfig.
+ * The input signals shall use the Drv1 DataSource and the output signals the DDB DataSource.
+ */
+static bool InitialiseLookupTableApplication(const char8 * const gamConfig) {
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = LookupTableGAMTestGAM";
+    config += gamConfig;
+    config += ""
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = LookupTableGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    config.Seek(0);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT < RealTimeApplication > application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * @brief Calls the LookupTableGAM::Initialise with the parameters in config.
+ */
+static bool InitialiseLookupTableGAM(const char8 * const config,
+                                     LookupTableGAMTestGAM &gam) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        cdb.MoveToRoot();
+        ok = gam.Initialise(cdb);
+    }
+    return ok;
+}
+
+/**
+ * @brief Signals of the 1D tests: 4 float32 x and one float32 output.
+ */
+static const char8 * const lookupTable1DSignals = ""
+        "            InputSignals = {"
+        "                X = {"
+        "                    DataSource = Drv1"
+        "                    Type = float32"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Y = {"
+        "                    DataSource = DDB"
+        "                    Type = float32"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }";
+
+/**
+ * @brief Checks that the output is equal to the expected values.
+ */
+template<typename T>
+static bool CheckOutput(const T * const output,
+                        const float64 * const expected,
+                        const uint32 numberOfElements) {
+    bool ok = true;
+    for (uint32 i = 0u; (i < numberOfElements) && (ok); i++) {
+        ok = (fabs(static_cast<float64>(output[i]) - expected[i]) < 1e-5);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+LookupTableGAMTest::LookupTableGAMTest() {
+}
+
+LookupTableGAMTest::~LookupTableGAMTest() {
+}
+
+bool LookupTableGAMTest::TestConstructor() {
+    LookupTableGAMTestGAM gam;
+    bool ret = (gam.GetNumberOfDimensions() == 0u);
+    ret &= (gam.GetNumberOfSearches() == 0u);
+    return ret;
+}
+
+bool LookupTableGAMTest::TestInitialise_1D() {
+    LookupTableGAMTestGAM gam;
+    bool ret = InitialiseLookupTableGAM("Breakpoints1 = {0.0 1.0 3.0}\n"
+                                        "Table = {0.0 10.0 30.0}\n", gam);
+    if (ret) {
+        ret = (gam.GetNumberOfDimensions() == 1u);
+    }
+    return ret;
+}
+
+bool LookupTableGAMTest::TestInitialise_2D() {
+    LookupTableGAMTestGAM gam;
+    bool ret = InitialiseLookupTableGAM("Breakpoints1 = {0.0 1.0 3.0}\n"
+                                        "Breakpoints2 = {0.0 10.0}\n"
+                                        "Table = {0.0 1.0 2.0 3.0 4.0 5.0}\n"
+                                        "Extrapolation = Linear\n", gam);
+    if (ret) {
+        ret = (gam.GetNumberOfDimensions() == 2u);
+    }
+    return ret;
+}
+
+bool LookupTableGAMTest::TestInitialise_File() {
+    const char8 * const filename = "LookupTableGAMTest_TestInitialise_File.bin";
+    const uint32 numberOfSignals = 3u;
+    const char8 * const names[] = { "Breakpoints1", "Time", "Table" };
+    TypeDescriptor types[] = { Float64Bit, UnsignedInteger32Bit, Float32Bit };
+    uint32 sizes[] = { 3u, 1u, 3u };
+    float64 breakpoints[] = { 0.0, 1.0, 3.0 };
+    uint32 time = 7u;
+    float32 values[] = { 0.F, 10.F, 30.F };
+    BasicFile f;
+    bool ret = f.Open(filename, BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
+    if (ret) {
+        uint32 writeSize = static_cast<uint32>(sizeof(uint32));
+        ret = f.Write(reinterpret_cast<const char8 *>(&numberOfSignals), writeSize);
+    }
+    for (uint32 n = 0u; (n < numberOfSignals) && (ret); n++) {
+        uint32 writeSize = static_cast<uint32>(sizeof(uint16));
+        ret = f.Write(reinterpret_cast<const char8 *>(&types[n].all), writeSize);
+        char8 name[32];
+        (void) MemoryOperationsHelper::Set(&name[0], '\0', 32u);
+        (void) MemoryOperationsHelper::Copy(&name[0], names[n], StringHelper::Length(names[n]));
+        writeSize = 32u;
+        if (ret) {
+            ret = f.Write(&name[0], writeSize);
+        }
+        writeSize = static_cast<uint32>(sizeof(uint32));
+        if (ret) {
+            ret = f.Write(reinterpret_cast<const char8 *>(&sizes[n]), writeSize);
+        }
+    }
+    if (ret) {
+        uint32 writeSize = static_cast<uint32>(sizeof(breakpoints));
+        ret = f.Write(reinterpret_cast<const char8 *>(&breakpoints[0]), writeSize);
+    }
+    if (ret) {
+        uint32 writeSize = static_cast<uint32>(sizeof(time));
+        ret = f.Write(reinterpret_cast<const char8 *>(&time), writeSize);
+    }
+    if (ret) {
+        uint32 writeSize = static_cast<uint32>(sizeof(values));
+        ret = f.Write(reinterpret_cast<const char8 *>(&values[0]), writeSize);
+    }
+    if (f.IsOpen()) {
+        (void) f.Close();
+    }
+    if (ret) {
+        StreamString config;
+        (void) config.Printf("Filename = \"%s\"\n", filename);
+        config += lookupTable1DSignals;
+        ret = InitialiseLookupTableApplication(config.Buffer());
+    }
+    ReferenceT<LookupTableGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        ret = (gam->GetNumberOfDimensions() == 1u);
+    }
+    if (ret) {
+        float32 *x = static_cast<float32 *>(gam->GetInputSignalMemory(0u));
+        x[0] = 0.5F;
+        x[1] = 2.F;
+        x[2] = 3.F;
+        x[3] = 0.F;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        float64 expected[] = { 5.0, 20.0, 30.0, 0.0 };
+        ret = CheckOutput(static_cast<float32 *>(gam->GetOutputSignalMemory(0u)), &expected[0], 4u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    Directory toDelete(filename);
+    (void) toDelete.Delete();
+    return ret;
+}
+
+bool LookupTableGAMTest::TestInitialise_FalseNotIncreasing() {
+    LookupTableGAMTestGAM gam;
+    bool ret = !InitialiseLookupTableGAM("Breakpoints1 = {0.0 1.0 1.0}\n"
+                                         "Table = {0.0 10.0 30.0}\n", gam);
+    if (ret) {
+        LookupTableGAMTestGAM gam2;
+        ret = !InitialiseLookupTableGAM("Breakpoints1 = {0.0}\n"
+                                        "Table = {0.0}\n", gam2);
+    }
+    return ret;
+}
+
+bool LookupTableGAMTest::TestInitialise_FalseTableSize() {
+    LookupTableGAMTestGAM gam;
+    bool ret = !InitialiseLookupTableGAM("Breakpoints1 = {0.0 1.0 3.0}\n"
+                                         "Breakpoints2 = {0.0 10.0}\n"
+                                         "Table = {0.0 10.0 30.0}\n", gam);
+    if (ret) {
+        LookupTableGAMTestGAM gam2;
+        ret = !InitialiseLookupTableGAM("Breakpoints1 = {0.0 1.0 3.0}\n", gam2);
+    }
+    return ret;
+}
+
+bool LookupTableGAMTest::TestInitialise_FalseBadExtrapolation() {
+    LookupTableGAMTestGAM gam;
+    return !InitialiseLookupTableGAM("Breakpoints1 = {0.0 1.0 3.0}\n"
+                                     "Table = {0.0 10.0 30.0}\n"
+                                     "Extrapolation = Cubic\n", gam);
+}
+
+bool LookupTableGAMTest::TestSetup_FalseNumberOfInputs() {
+    const char8 * const gamConfig = ""
+            "            Breakpoints1 = {0.0 1.0 3.0}"
+            "            Breakpoints2 = {0.0 10.0}"
+            "            Table = {0.0 1.0 2.0 3.0 4.0 5.0}";
+    StreamString config = gamConfig;
+    config += lookupTable1DSignals;
+    bool ret = !InitialiseLookupTableApplication(config.Buffer());
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool LookupTableGAMTest::TestSetup_FalseBadType() {
+    const char8 * const gamConfig = ""
+            "            Breakpoints1 = {0.0 1.0 3.0}"
+            "            Table = {0.0 10.0 30.0}"
+            "            InputSignals = {"
+            "                X = {"
+            "                    DataSource = Drv1"
+            "                    Type = int32"
+            "                    NumberOfElements = 4"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                Y = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 4"
+            "                }"
+            "            }";
+    bool ret = !InitialiseLookupTableApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool LookupTableGAMTest::TestExecute_1D() {
+    StreamString config = ""
+            "            Breakpoints1 = {0.0 1.0 3.0}"
+            "            Table = {0.0 10.0 30.0}";
+    config += lookupTable1DSignals;
+    bool ret = InitialiseLookupTableApplication(config.Buffer());
+    ReferenceT<LookupTableGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        float32 *x = static_cast<float32 *>(gam->GetInputSignalMemory(0u));
+        x[0] = 0.25F;
+        x[1] = 1.5F;
+        x[2] = -1.F;
+        x[3] = 4.F;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        float64 expected[] = { 2.5, 15.0, 0.0, 30.0 };
+        ret = CheckOutput(static_cast<float32 *>(gam->GetOutputSignalMemory(0u)), &expected[0], 4u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool LookupTableGAMTest::TestExecute_2D() {
+    const char8 * const gamConfig = ""
+            "            Breakpoints1 = {0.0 1.0 3.0}"
+            "            Breakpoints2 = {0.0 10.0}"
+            "            Table = {0.0 1.0 2.0 3.0 4.0 5.0}"
+            "            InputSignals = {"
+            "                X = {"
+            "                    DataSource = Drv1"
+            "                    Type = float64"
+            "                    NumberOfElements = 3"
+            "                }"
+            "                Z = {"
+            "                    DataSource = Drv1"
+            "                    Type = float64"
+            "                    NumberOfElements = 3"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                Y = {"
+            "                    DataSource = DDB"
+            "                    Type = float64"
+            "                    NumberOfElements = 3"
+            "                }"
+            "            }";
+    bool ret = InitialiseLookupTableApplication(gamConfig);
+    ReferenceT<LookupTableGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        float64 *x = static_cast<float64 *>(gam->GetInputSignalMemory(0u));
+        float64 *z = static_cast<float64 *>(gam->GetInputSignalMemory(1u));
+        x[0] = 0.5;
+        z[0] = 5.0;
+        x[1] = 2.0;
+        z[1] = 10.0;
+        x[2] = 5.0;
+        z[2] = -5.0;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        //(0.5, 5): mean of 0, 1, 2 and 3. (2, 10): mean of 3 and 5. (5, -5): clipped to (3, 0).
+        float64 expected[] = { 1.5, 4.0, 4.0 };
+        ret = CheckOutput(static_cast<float64 *>(gam->GetOutputSignalMemory(0u)), &expected[0], 3u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool LookupTableGAMTest::TestExecute_LinearExtrapolation() {
+    StreamString config = ""
+            "            Breakpoints1 = {0.0 1.0 3.0}"
+            "            Table = {0.0 10.0 30.0}"
+            "            Extrapolation = Linear";
+    config += lookupTable1DSignals;
+    bool ret = InitialiseLookupTableApplication(config.Buffer());
+    ReferenceT<LookupTableGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        float32 *x = static_cast<float32 *>(gam->GetInputSignalMemory(0u));
+        x[0] = -1.F;
+        x[1] = 4.F;
+        x[2] = 3.F;
+        x[3] = 0.F;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        float64 expected[] = { -10.0, 40.0, 30.0, 0.0 };
+        ret = CheckOutput(static_cast<float32 *>(gam->GetOutputSignalMemory(0u)), &expected[0], 4u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool LookupTableGAMTest::TestExecute_CachedCells() {
+    StreamString config = ""
+            "            Breakpoints1 = {0.0 1.0 2.0 3.0 4.0 5.0 6.0 7.0 8.0 9.0}"
+            "            Table = {0.0 1.0 2.0 3.0 4.0 5.0 6.0 7.0 8.0 9.0}";
+    config += lookupTable1DSignals;
+    bool ret = InitialiseLookupTableApplication(config.Buffer());
+    ReferenceT<LookupTableGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    float32 *x = NULL_PTR(float32 *);
+    float32 *y = NULL_PTR(float32 *);
+    if (ret) {
+        x = static_cast<float32 *>(gam->GetInputSignalMemory(0u));
+        y = static_cast<float32 *>(gam->GetOutputSignalMemory(0u));
+    }
+    //Ramp all the elements by less than one cell per cycle: no searches
+    for (uint32 n = 0u; (n < 20u) && (ret); n++) {
+        for (uint32 i = 0u; i < 4u; i++) {
+            x[i] = 0.45F * static_cast<float32>(n);
+        }
+        ret = gam->Execute();
+        if (ret) {
+            ret = (fabs(y[0] - x[0]) < 1e-5);
+        }
+    }
+    if (ret) {
+        ret = (gam->GetNumberOfSearches() == 0u);
+    }
+    //Jump of two elements across the table: one search each
+    if (ret) {
+        x[0] = 0.5F;
+        x[1] = 8.5F;
+        x[3] = 2.5F;
+        ret = gam->Execute();
+    }
+    if (ret) {
+        float64 expected[] = { 0.5, 8.5, 8.55, 2.5 };
+        ret = CheckOutput(y, &expected[0], 4u);
+    }
+    if (ret) {
+        ret = (gam->GetNumberOfSearches() == 2u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
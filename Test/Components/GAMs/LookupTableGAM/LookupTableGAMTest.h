@@ -0,0 +1,127 @@
+/**
+ * @file LookupTableGAMTest.h
+ * @brief Header file for class LookupTableGAMTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class LookupTableGAMTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LOOKUPTABLEGAMTEST_H_
+#define LOOKUPTABLEGAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "LookupTableGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the LookupTableGAM methods
+ */
+class LookupTableGAMTest {
+public:
+
+    /**
+     * @brief Constructor
+     */
+    LookupTableGAMTest();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~LookupTableGAMTest();
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method with a 1D table
+     */
+    bool TestInitialise_1D();
+
+    /**
+     * @brief Tests the Initialise method with a 2D table
+     */
+    bool TestInitialise_2D();
+
+    /**
+     * @brief Tests the Initialise method with a table read from a FileReader binary file
+     */
+    bool TestInitialise_File();
+
+    /**
+     * @brief Tests that the Initialise method fails if the breakpoints are not strictly increasing
+     */
+    bool TestInitialise_FalseNotIncreasing();
+
+    /**
+     * @brief Tests that the Initialise method fails if the table does not have one value for each point of the grid
+     */
+    bool TestInitialise_FalseTableSize();
+
+    /**
+     * @brief Tests that the Initialise method fails with an unsupported Extrapolation
+     */
+    bool TestInitialise_FalseBadExtrapolation();
+
+    /**
+     * @brief Tests that the Setup method fails if the number of input signals is not the number of dimensions
+     */
+    bool TestSetup_FalseNumberOfInputs();
+
+    /**
+     * @brief Tests that the Setup method fails with an unsupported input type
+     */
+    bool TestSetup_FalseBadType();
+
+    /**
+     * @brief Tests the Execute method with a 1D table, an array input and Extrapolation = Clip
+     */
+    bool TestExecute_1D();
+
+    /**
+     * @brief Tests the Execute method with a 2D table and float64 signals
+     */
+    bool TestExecute_2D();
+
+    /**
+     * @brief Tests the Execute method with Extrapolation = Linear
+     */
+    bool TestExecute_LinearExtrapolation();
+
+    /**
+     * @brief Tests that the binary search is only used when an input moves by more than one cell
+     */
+    bool TestExecute_CachedCells();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LOOKUPTABLEGAMTEST_H_ */
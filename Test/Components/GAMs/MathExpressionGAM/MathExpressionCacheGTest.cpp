@@ -0,0 +1,85 @@
+/**
+ * @file MathExpressionCacheGTest.cpp
+ * @brief Source file for class MathExpressionCacheGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionCacheGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "MathExpressionCacheTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(MathExpressionCacheGTest,TestConstructor) {
+    MathExpressionCacheTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(MathExpressionCacheGTest,TestAdd) {
+    MathExpressionCacheTest test;
+    ASSERT_TRUE(test.TestAdd());
+}
+
+TEST(MathExpressionCacheGTest,TestAdd_Grow) {
+    MathExpressionCacheTest test;
+    ASSERT_TRUE(test.TestAdd_Grow());
+}
+
+TEST(MathExpressionCacheGTest,TestFind) {
+    MathExpressionCacheTest test;
+    ASSERT_TRUE(test.TestFind());
+}
+
+TEST(MathExpressionCacheGTest,TestFind_Missing) {
+    MathExpressionCacheTest test;
+    ASSERT_TRUE(test.TestFind_Missing());
+}
+
+TEST(MathExpressionCacheGTest,TestReset) {
+    MathExpressionCacheTest test;
+    ASSERT_TRUE(test.TestReset());
+}
+
+TEST(MathExpressionCacheGTest,TestInstance) {
+    MathExpressionCacheTest test;
+    ASSERT_TRUE(test.TestInstance());
+}
+
+TEST(MathExpressionCacheGTest,TestNormaliseExpression) {
+    MathExpressionCacheTest test;
+    ASSERT_TRUE(test.TestNormaliseExpression());
+}
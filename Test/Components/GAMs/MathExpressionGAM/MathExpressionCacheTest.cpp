@@ -0,0 +1,188 @@
+/**
+ * @file MathExpressionCacheTest.cpp
+ * @brief Source file for class MathExpressionCacheTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionCacheTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MathExpressionCache.h"
+#include "MathExpressionCacheTest.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+bool MathExpressionCacheTest::TestConstructor() {
+    MathExpressionCache cache;
+    return (cache.GetNumberOfEntries() == 0u) && (cache.GetNumberOfHits() == 0u);
+}
+
+bool MathExpressionCacheTest::TestAdd() {
+    MathExpressionCache cache;
+    bool ok = cache.Add("Parse:A = B;", "READ B\nWRITE A\n");
+    if (ok) {
+        ok = !cache.Add("Parse:A = B;", "READ C\nWRITE A\n");
+    }
+    if (ok) {
+        ok = cache.Add("Parse:A = C;", "");
+    }
+    if (ok) {
+        ok = !cache.Add(NULL_PTR(const char8 *), "");
+    }
+    if (ok) {
+        ok = (cache.GetNumberOfEntries() == 2u);
+    }
+    StreamString program;
+    if (ok) {
+        ok = cache.Find("Parse:A = B;", program);
+    }
+    if (ok) {
+        ok = (program == "READ B\nWRITE A\n");
+    }
+    return ok;
+}
+
+bool MathExpressionCacheTest::TestAdd_Grow() {
+    MathExpressionCache cache;
+    const uint32 numberOfKeys = 1000u;
+    bool ok = true;
+    for (uint32 i = 0u; (i < numberOfKeys) && (ok); i++) {
+        StreamString key;
+        StreamString program;
+        ok = key.Printf("Parse:Out = In%u;", i);
+        if (ok) {
+            ok = program.Printf("READ In%u\nWRITE Out\n", i);
+        }
+        if (ok) {
+            ok = cache.Add(key.Buffer(), program.Buffer());
+        }
+    }
+    if (ok) {
+        ok = (cache.GetNumberOfEntries() == numberOfKeys);
+    }
+    for (uint32 i = 0u; (i < numberOfKeys) && (ok); i++) {
+        StreamString key;
+        StreamString expected;
+        StreamString program;
+        ok = key.Printf("Parse:Out = In%u;", i);
+        if (ok) {
+            ok = expected.Printf("READ In%u\nWRITE Out\n", i);
+        }
+        if (ok) {
+            ok = cache.Find(key.Buffer(), program);
+        }
+        if (ok) {
+            ok = (program == expected.Buffer());
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionCacheTest::TestFind() {
+    MathExpressionCache cache;
+    StreamString program;
+    bool ok = cache.Add("Optimise:READ B\nWRITE A\n", "");
+    if (ok) {
+        ok = cache.Find("Optimise:READ B\nWRITE A\n", program);
+    }
+    if (ok) {
+        ok = (program.Size() == 0u);
+    }
+    if (ok) {
+        ok = cache.Find("Optimise:READ B\nWRITE A\n", program);
+    }
+    if (ok) {
+        ok = (cache.GetNumberOfHits() == 2u);
+    }
+    return ok;
+}
+
+bool MathExpressionCacheTest::TestFind_Missing() {
+    MathExpressionCache cache;
+    StreamString program;
+    bool ok = cache.Add("Parse:A = B;", "READ B\nWRITE A\n");
+    if (ok) {
+        ok = !cache.Find("Parse:A = C;", program);
+    }
+    if (ok) {
+        ok = !cache.Find(NULL_PTR(const char8 *), program);
+    }
+    if (ok) {
+        ok = (cache.GetNumberOfHits() == 0u);
+    }
+    return ok;
+}
+
+bool MathExpressionCacheTest::TestReset() {
+    MathExpressionCache cache;
+    StreamString program;
+    bool ok = cache.Add("Parse:A = B;", "READ B\nWRITE A\n");
+    if (ok) {
+        ok = cache.Find("Parse:A = B;", program);
+    }
+    if (ok) {
+        cache.Reset();
+        ok = (cache.GetNumberOfEntries() == 0u) && (cache.GetNumberOfHits() == 0u);
+    }
+    if (ok) {
+        ok = !cache.Find("Parse:A = B;", program);
+    }
+    if (ok) {
+        ok = cache.Add("Parse:A = B;", "READ B\nWRITE A\n");
+    }
+    return ok;
+}
+
+bool MathExpressionCacheTest::TestInstance() {
+    MathExpressionCache &cache1 = MathExpressionCache::Instance();
+    MathExpressionCache &cache2 = MathExpressionCache::Instance();
+    return (&cache1 == &cache2);
+}
+
+bool MathExpressionCacheTest::TestNormaliseExpression() {
+    StreamString normalised1;
+    StreamString normalised2;
+    StreamString normalised3;
+    MathExpressionCache::NormaliseExpression("  \n  Out1 = In1  +\tIn2;  \n\n   Out2 = 10 * Out1;  \n ", normalised1);
+    MathExpressionCache::NormaliseExpression("Out1 = In1 + In2;\nOut2 = 10 * Out1;", normalised2);
+    MathExpressionCache::NormaliseExpression("Out1 = In1 + In2; Out2 = 10 * Out1;", normalised3);
+    bool ok = (normalised1 == "Out1 = In1 + In2;\nOut2 = 10 * Out1;");
+    if (ok) {
+        ok = (normalised1 == normalised2.Buffer());
+    }
+    if (ok) {
+        //The newline terminates the assignment and shall not be replaced by a space.
+        ok = !(normalised1 == normalised3.Buffer());
+    }
+    return ok;
+}
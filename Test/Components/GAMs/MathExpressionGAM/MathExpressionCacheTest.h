@@ -0,0 +1,91 @@
+/**
+ * @file MathExpressionCacheTest.h
+ * @brief Header file for class MathExpressionCacheTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MathExpressionCacheTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_COMPONENTS_GAMS_MATHEXPRESSIONGAM_MATHEXPRESSIONCACHETEST_H_
+#define TEST_COMPONENTS_GAMS_MATHEXPRESSIONGAM_MATHEXPRESSIONCACHETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Test class for MathExpressionCache
+ */
+class MathExpressionCacheTest {
+public:
+
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that Add() keeps the first program added with a key.
+     */
+    bool TestAdd();
+
+    /**
+     * @brief Tests that Add() grows the table beyond its initial size.
+     */
+    bool TestAdd_Grow();
+
+    /**
+     * @brief Tests that Find() returns the added program and counts the hits.
+     */
+    bool TestFind();
+
+    /**
+     * @brief Tests that Find() fails for a key which was not added.
+     */
+    bool TestFind_Missing();
+
+    /**
+     * @brief Tests that Reset() removes all the programs and the hits.
+     */
+    bool TestReset();
+
+    /**
+     * @brief Tests that Instance() always returns the same cache.
+     */
+    bool TestInstance();
+
+    /**
+     * @brief Tests that NormaliseExpression() only removes the formatting whitespaces.
+     */
+    bool TestNormaliseExpression();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_COMPONENTS_GAMS_MATHEXPRESSIONGAM_MATHEXPRESSIONCACHETEST_H_ */
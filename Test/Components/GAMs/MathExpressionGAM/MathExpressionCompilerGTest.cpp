@@ -0,0 +1,115 @@
+/**
+ * @file MathExpressionCompilerGTest.cpp
+ * @brief Source file for class MathExpressionCompilerGTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionCompilerGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "MathExpressionCompilerTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(MathExpressionCompilerGTest,TestConstructor) {
+    MathExpressionCompilerTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(MathExpressionCompilerGTest,TestInitialise) {
+    MathExpressionCompilerTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(MathExpressionCompilerGTest,TestAddVariable) {
+    MathExpressionCompilerTest test;
+    ASSERT_TRUE(test.TestAddVariable());
+}
+
+TEST(MathExpressionCompilerGTest,TestCompile) {
+    MathExpressionCompilerTest test;
+    ASSERT_TRUE(test.TestCompile());
+}
+
+TEST(MathExpressionCompilerGTest,TestCompile_UnsupportedOperation) {
+    MathExpressionCompilerTest test;
+    ASSERT_TRUE(test.TestCompile_UnsupportedOperation());
+}
+
+TEST(MathExpressionCompilerGTest,TestCompile_TypeMismatch) {
+    MathExpressionCompilerTest test;
+    ASSERT_TRUE(test.TestCompile_TypeMismatch());
+}
+
+TEST(MathExpressionCompilerGTest,TestCompile_UnknownVariable) {
+    MathExpressionCompilerTest test;
+    ASSERT_TRUE(test.TestCompile_UnknownVariable());
+}
+
+TEST(MathExpressionCompilerGTest,TestCompile_StackUnderflow) {
+    MathExpressionCompilerTest test;
+    ASSERT_TRUE(test.TestCompile_StackUnderflow());
+}
+
+TEST(MathExpressionCompilerGTest,TestExecute_Float64) {
+    MathExpressionCompilerTest test;
+    ASSERT_TRUE(test.TestExecute_Float64());
+}
+
+TEST(MathExpressionCompilerGTest,TestExecute_Float32) {
+    MathExpressionCompilerTest test;
+    ASSERT_TRUE(test.TestExecute_Float32());
+}
+
+TEST(MathExpressionCompilerGTest,TestExecute_Copy) {
+    MathExpressionCompilerTest test;
+    ASSERT_TRUE(test.TestExecute_Copy());
+}
+
+TEST(MathExpressionCompilerGTest,TestExecute_Array) {
+    MathExpressionCompilerTest test;
+    ASSERT_TRUE(test.TestExecute_Array());
+}
+
+TEST(MathExpressionCompilerGTest,TestCompile_WrongNumberOfElements) {
+    MathExpressionCompilerTest test;
+    ASSERT_TRUE(test.TestCompile_WrongNumberOfElements());
+}
+
+TEST(MathExpressionCompilerGTest,TestCompile_ArrayToScalar) {
+    MathExpressionCompilerTest test;
+    ASSERT_TRUE(test.TestCompile_ArrayToScalar());
+}
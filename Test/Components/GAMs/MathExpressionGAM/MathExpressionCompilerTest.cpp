@@ -0,0 +1,262 @@
+/**
+ * @file MathExpressionCompilerTest.cpp
+ * @brief Source file for class MathExpressionCompilerTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionCompilerTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "math.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MathExpressionCompiler.h"
+#include "MathExpressionCompilerTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool MathExpressionCompilerTest::TestConstructor() {
+    using namespace MARTe;
+    MathExpressionCompiler compiler;
+    return (compiler.GetNumberOfInstructions() == 0u);
+}
+
+bool MathExpressionCompilerTest::TestInitialise() {
+    using namespace MARTe;
+    MathExpressionCompiler compiler;
+    bool ok = compiler.Initialise("READ A WRITE B", 2u);
+    ok &= !compiler.Initialise("READ A WRITE B", 2u);
+    return ok;
+}
+
+bool MathExpressionCompilerTest::TestAddVariable() {
+    using namespace MARTe;
+    float64 a = 0.0;
+    float64 b = 0.0;
+    float64 c = 0.0;
+    MathExpressionCompiler compiler;
+    bool ok = !compiler.AddVariable("A", Float64Bit, &a, 1u);
+    ok &= compiler.Initialise("READ A WRITE B", 2u);
+    ok &= !compiler.AddVariable("A", Float64Bit, &a, 0u);
+    ok &= compiler.AddVariable("A", Float64Bit, &a, 1u);
+    ok &= !compiler.AddVariable("A", Float64Bit, &b, 1u);
+    ok &= compiler.AddVariable("B", Float64Bit, &b, 1u);
+    ok &= !compiler.AddVariable("C", Float64Bit, &c, 1u);
+    return ok;
+}
+
+bool MathExpressionCompilerTest::TestCompile() {
+    using namespace MARTe;
+    float64 a = 1.0;
+    float64 b = 2.0;
+    float64 c = 0.0;
+    MathExpressionCompiler compiler;
+    bool ok = compiler.Initialise("READ A\nREAD B\nADD\nCONST float64 2\nMUL\nWRITE C\n", 3u);
+    ok &= compiler.AddVariable("A", Float64Bit, &a, 1u);
+    ok &= compiler.AddVariable("B", Float64Bit, &b, 1u);
+    ok &= compiler.AddVariable("C", Float64Bit, &c, 1u);
+    ok &= compiler.Compile();
+    //READ and CONST do not generate instructions and the result of MUL is written directly to C.
+    ok &= (compiler.GetNumberOfInstructions() == 2u);
+    return ok;
+}
+
+bool MathExpressionCompilerTest::TestCompile_UnsupportedOperation() {
+    using namespace MARTe;
+    float64 a = 1.0;
+    float64 b = 2.0;
+    float64 c = 0.0;
+    MathExpressionCompiler compiler;
+    bool ok = compiler.Initialise("READ A READ B LT WRITE C", 3u);
+    ok &= compiler.AddVariable("A", Float64Bit, &a, 1u);
+    ok &= compiler.AddVariable("B", Float64Bit, &b, 1u);
+    ok &= compiler.AddVariable("C", Float64Bit, &c, 1u);
+    ok &= !compiler.Compile();
+    ok &= (compiler.GetNumberOfInstructions() == 0u);
+    return ok;
+}
+
+bool MathExpressionCompilerTest::TestCompile_TypeMismatch() {
+    using namespace MARTe;
+    float64 a = 1.0;
+    float32 b = 2.0F;
+    float64 c = 0.0;
+    MathExpressionCompiler compiler;
+    bool ok = compiler.Initialise("READ A READ B ADD WRITE C", 3u);
+    ok &= compiler.AddVariable("A", Float64Bit, &a, 1u);
+    ok &= compiler.AddVariable("B", Float32Bit, &b, 1u);
+    ok &= compiler.AddVariable("C", Float64Bit, &c, 1u);
+    ok &= !compiler.Compile();
+    return ok;
+}
+
+bool MathExpressionCompilerTest::TestCompile_UnknownVariable() {
+    using namespace MARTe;
+    float64 a = 1.0;
+    MathExpressionCompiler compiler;
+    bool ok = compiler.Initialise("READ X WRITE A", 1u);
+    ok &= compiler.AddVariable("A", Float64Bit, &a, 1u);
+    ok &= !compiler.Compile();
+    return ok;
+}
+
+bool MathExpressionCompilerTest::TestCompile_StackUnderflow() {
+    using namespace MARTe;
+    float64 a = 1.0;
+    MathExpressionCompiler compiler;
+    bool ok = compiler.Initialise("READ A ADD WRITE A", 1u);
+    ok &= compiler.AddVariable("A", Float64Bit, &a, 1u);
+    ok &= !compiler.Compile();
+    return ok;
+}
+
+bool MathExpressionCompilerTest::TestExecute_Float64() {
+    using namespace MARTe;
+    float64 a = 3.0;
+    float64 b = 0.5;
+    float64 c = 0.0;
+    MathExpressionCompiler compiler;
+    bool ok = compiler.Initialise("READ A READ A MUL READ B DIV READ A COS SUB CONST float64 2 POW WRITE C", 3u);
+    ok &= compiler.AddVariable("A", Float64Bit, &a, 1u);
+    ok &= compiler.AddVariable("B", Float64Bit, &b, 1u);
+    ok &= compiler.AddVariable("C", Float64Bit, &c, 1u);
+    ok &= compiler.Compile();
+    for (uint32 n = 0u; (n < 4u) && (ok); n++) {
+        a += 1.0;
+        compiler.Execute();
+        float64 expected = pow(((a * a) / b) - cos(a), 2.0);
+        ok = (fabs(c - expected) < (1e-12 * fabs(expected)));
+    }
+    return ok;
+}
+
+bool MathExpressionCompilerTest::TestExecute_Float32() {
+    using namespace MARTe;
+    float32 a = 0.5F;
+    int32 i = 4;
+    float32 o1 = 0.0F;
+    float64 o2 = 0.0;
+    MathExpressionCompiler compiler;
+    bool ok = compiler.Initialise("READ A SIN READ I CAST float32 MUL WRITE T "
+                                  "READ T CONST float64 1 CAST float32 SUB WRITE O1 "
+                                  "READ O1 CAST float64 READ I CAST float64 POW WRITE O2", 4u);
+    ok &= compiler.AddVariable("A", Float32Bit, &a, 1u);
+    ok &= compiler.AddVariable("I", SignedInteger32Bit, &i, 1u);
+    ok &= compiler.AddVariable("O1", Float32Bit, &o1, 1u);
+    ok &= compiler.AddVariable("O2", Float64Bit, &o2, 1u);
+    ok &= compiler.Compile();
+    if (ok) {
+        compiler.Execute();
+        float32 expected = (static_cast<float32>(sin(a)) * 4.0F) - 1.0F;
+        ok = (fabs(o1 - expected) < 1e-6);
+        ok &= (fabs(o2 - pow(static_cast<float64>(o1), 4.0)) < 1e-12);
+    }
+    return ok;
+}
+
+bool MathExpressionCompilerTest::TestExecute_Copy() {
+    using namespace MARTe;
+    float64 a = 1.0;
+    float64 b = 0.0;
+    MathExpressionCompiler compiler;
+    bool ok = compiler.Initialise("READ A WRITE B", 2u);
+    ok &= compiler.AddVariable("A", Float64Bit, &a, 1u);
+    ok &= compiler.AddVariable("B", Float64Bit, &b, 1u);
+    ok &= compiler.Compile();
+    ok &= (compiler.GetNumberOfInstructions() == 1u);
+    a = 7.0;
+    compiler.Execute();
+    ok &= (b == 7.0);
+    return ok;
+}
+
+bool MathExpressionCompilerTest::TestExecute_Array() {
+    using namespace MARTe;
+    const uint32 numberOfElements = 8u;
+    float32 in[numberOfElements];
+    float32 out1[numberOfElements];
+    float32 out2[numberOfElements];
+    float32 out3[numberOfElements];
+    float32 gain = 3.0F;
+    for (uint32 i = 0u; i < numberOfElements; i++) {
+        in[i] = static_cast<float32>(i) - 2.0F;
+        out1[i] = 0.0F;
+        out2[i] = 0.0F;
+        out3[i] = 0.0F;
+    }
+    MathExpressionCompiler compiler;
+    //Out1 = Gain * In + 1; T = In * In; Out2 = T - Out1 / Gain; Out3 = Gain;
+    bool ok = compiler.Initialise("READ Gain READ In MUL CONST float64 1 CAST float32 ADD WRITE Out1 "
+                                  "READ In READ In MUL WRITE T "
+                                  "READ T READ Out1 READ Gain DIV SUB WRITE Out2 "
+                                  "READ Gain WRITE Out3", 5u);
+    ok &= compiler.AddVariable("In", Float32Bit, &in[0], numberOfElements);
+    ok &= compiler.AddVariable("Gain", Float32Bit, &gain, 1u);
+    ok &= compiler.AddVariable("Out1", Float32Bit, &out1[0], numberOfElements);
+    ok &= compiler.AddVariable("Out2", Float32Bit, &out2[0], numberOfElements);
+    ok &= compiler.AddVariable("Out3", Float32Bit, &out3[0], numberOfElements);
+    ok &= compiler.Compile();
+    ok &= (compiler.GetNumberOfElements() == numberOfElements);
+    if (ok) {
+        compiler.Execute();
+    }
+    for (uint32 i = 0u; (i < numberOfElements) && (ok); i++) {
+        float32 expected1 = (gain * in[i]) + 1.0F;
+        float32 expected2 = (in[i] * in[i]) - (expected1 / gain);
+        ok = (out1[i] == expected1);
+        ok &= (out2[i] == expected2);
+        ok &= (out3[i] == gain);
+    }
+    return ok;
+}
+
+bool MathExpressionCompilerTest::TestCompile_WrongNumberOfElements() {
+    using namespace MARTe;
+    float64 a[4];
+    float64 b[4];
+    float64 c[3];
+    MathExpressionCompiler compiler;
+    bool ok = compiler.Initialise("READ A READ B ADD WRITE C", 3u);
+    ok &= compiler.AddVariable("A", Float64Bit, &a[0], 4u);
+    ok &= compiler.AddVariable("B", Float64Bit, &b[0], 4u);
+    ok &= compiler.AddVariable("C", Float64Bit, &c[0], 3u);
+    ok &= !compiler.Compile();
+    return ok;
+}
+
+bool MathExpressionCompilerTest::TestCompile_ArrayToScalar() {
+    using namespace MARTe;
+    float64 a[4];
+    float64 c = 0.0;
+    MathExpressionCompiler compiler;
+    bool ok = compiler.Initialise("READ A CONST float64 2 MUL WRITE C", 2u);
+    ok &= compiler.AddVariable("A", Float64Bit, &a[0], 4u);
+    ok &= compiler.AddVariable("C", Float64Bit, &c, 1u);
+    ok &= !compiler.Compile();
+    return ok;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file MathExpressionCompilerTest.h
+ * @brief Header file for class MathExpressionCompilerTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MathExpressionCompilerTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_COMPONENTS_GAMS_MATHEXPRESSIONGAM_MATHEXPRESSIONCOMPILERTEST_H_
+#define TEST_COMPONENTS_GAMS_MATHEXPRESSIONGAM_MATHEXPRESSIONCOMPILERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Test class for MathExpressionCompiler
+ */
+class MathExpressionCompilerTest {
+public:
+
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that Initialise() can only be called once.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that AddVariable() rejects repeated variables, zero elements and more than the declared number of variables.
+     */
+    bool TestAddVariable();
+
+    /**
+     * @brief Tests that Compile() redirects the result of each assignment to the assigned variable.
+     */
+    bool TestCompile();
+
+    /**
+     * @brief Tests that Compile() fails for operations which are not supported.
+     */
+    bool TestCompile_UnsupportedOperation();
+
+    /**
+     * @brief Tests that Compile() fails for binary operations with operands of different types.
+     */
+    bool TestCompile_TypeMismatch();
+
+    /**
+     * @brief Tests that Compile() fails if a variable is read before being added or written.
+     */
+    bool TestCompile_UnknownVariable();
+
+    /**
+     * @brief Tests that Compile() fails if an operation has not enough operands.
+     */
+    bool TestCompile_StackUnderflow();
+
+    /**
+     * @brief Tests Execute() with float64 arithmetic operations and constants.
+     */
+    bool TestExecute_Float64();
+
+    /**
+     * @brief Tests Execute() with float32 operations, casts and internal variables.
+     */
+    bool TestExecute_Float32();
+
+    /**
+     * @brief Tests Execute() for an assignment of a variable to another variable.
+     */
+    bool TestExecute_Copy();
+
+    /**
+     * @brief Tests Execute() with array variables, scalar variables and constants (element by element evaluation).
+     */
+    bool TestExecute_Array();
+
+    /**
+     * @brief Tests that Compile() fails if the array variables have a different number of elements.
+     */
+    bool TestCompile_WrongNumberOfElements();
+
+    /**
+     * @brief Tests that Compile() fails if an array is assigned to a scalar variable.
+     */
+    bool TestCompile_ArrayToScalar();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_COMPONENTS_GAMS_MATHEXPRESSIONGAM_MATHEXPRESSIONCOMPILERTEST_H_ */
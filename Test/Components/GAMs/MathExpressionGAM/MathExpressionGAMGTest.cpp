@@ -114,7 +114,46 @@ TEST(MathExpressionGAMGTest,TestExecute_MultipleExpressions) {
     ASSERT_TRUE(test.TestExecute_MultipleExpressions());
 }
 
+TEST(MathExpressionGAMGTest,TestInitialise_Failed_WrongBackend) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_Failed_WrongBackend());
+}
+
+TEST(MathExpressionGAMGTest,TestExecute_CompiledBackend) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_CompiledBackend());
+}
+
+TEST(MathExpressionGAMGTest,TestExecute_CompiledBackendFallback) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_CompiledBackendFallback());
+}
+
+TEST(MathExpressionGAMGTest,TestExecute_CompiledBackendArray) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_CompiledBackendArray());
+}
+
+TEST(MathExpressionGAMGTest,TestSetup_Failed_CompiledBackendArrayNotSupported) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_Failed_CompiledBackendArrayNotSupported());
+}
+
+TEST(MathExpressionGAMGTest,TestExecute_Optimise) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Optimise());
+}
+
+TEST(MathExpressionGAMGTest,TestExecute_OptimiseCompiledBackend) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_OptimiseCompiledBackend());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 
+TEST(MathExpressionGAMGTest,TestExecute_SharedProgram) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_SharedProgram());
+}
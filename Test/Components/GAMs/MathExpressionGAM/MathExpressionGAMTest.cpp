@@ -26,6 +26,7 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <math.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -1089,3 +1090,686 @@ bool MathExpressionGAMTest::TestExecute_MultipleExpressions() {
     god->Purge();
     return ok;
 }
+
+bool MathExpressionGAMTest::TestInitialise_Failed_WrongBackend() {
+    
+    MathExpressionGAM gam;
+    ConfigurationDatabase config;
+    
+    bool ok = config.Write("Expression", "Out = In1 + In2;");
+    if (ok) {
+        ok = config.Write("Backend", "Native");
+    }
+    if (ok) {
+        ok = !gam.Initialise(config);
+    }
+    return ok;
+}
+
+bool MathExpressionGAMTest::TestExecute_CompiledBackend() {
+    
+    const char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAMHelper"
+            "            Expression = \""
+            "                           Temp = In1 + In2;"
+            "                           Out1 = Temp * In1;"
+            "                           Out2 = Out1 - In2 / In1;"
+            "                         \""
+            "            Backend = Compiled"
+            "            InputSignals = {"
+            "               In1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "               In2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Out1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "               Out2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = MathExpressionGAMDataSourceHelper"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+            
+    bool ok = TestIntegratedInApplication(config1, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAMHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = gam->IsCompiled();
+    }
+    if (ok) {
+        float64 *in1 = static_cast<float64 *>(gam->GetInputSignalMemory(0u));
+        float64 *in2 = static_cast<float64 *>(gam->GetInputSignalMemory(1u));
+        float64 *out1 = static_cast<float64 *>(gam->GetOutputSignalMemory(0u));
+        float64 *out2 = static_cast<float64 *>(gam->GetOutputSignalMemory(1u));
+        *in1 = 2.0;
+        *in2 = 3.0;
+        ok = gam->Execute();
+        if (ok) {
+            ok = (*out1 == 10.0) && (*out2 == 8.5);
+        }
+    }
+    god->Purge();
+    return ok;
+}
+
+bool MathExpressionGAMTest::TestExecute_CompiledBackendFallback() {
+    
+    const char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAM"
+            "            Expression = \"GAM1_TotalTime = GAM1_ReadTime + GAM1_WriteTime + GAM1_ExecTime;\""
+            "            Backend = Compiled"
+            "            InputSignals = {"
+            "               GAM1_ReadTime = {"
+            "                   DataSource = Timings"
+            "                   Type = uint32"
+            "               }"
+            "               GAM1_WriteTime = {"
+            "                   DataSource = Timings"
+            "                   Type = uint32"
+            "               }"
+            "               GAM1_ExecTime = {"
+            "                   DataSource = Timings"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               GAM1_TotalTime = {"
+            "                   DataSource = DDB1"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+            
+    bool ok = TestIntegratedInApplication(config1, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAM> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = !gam->IsCompiled();
+    }
+    if (ok) {
+        ok = gam->Execute();
+    }
+    god->Purge();
+    return ok;
+}
+
+bool MathExpressionGAMTest::TestExecute_CompiledBackendArray() {
+    
+    const char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAMHelper"
+            "            Expression = \""
+            "                           Out = Gain * In + Offset;"
+            "                         \""
+            "            Backend = Compiled"
+            "            InputSignals = {"
+            "               In = {"
+            "                   DataSource = Drv1"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Gain = {"
+            "                   DataSource = Drv1"
+            "                   Type = float32"
+            "               }"
+            "               Offset = {"
+            "                   DataSource = Drv1"
+            "                   Type = float32"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Out = {"
+            "                   DataSource = Drv1"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = MathExpressionGAMDataSourceHelper"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+            
+    bool ok = TestIntegratedInApplication(config1, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAMHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = gam->IsCompiled();
+    }
+    if (ok) {
+        float32 *in = static_cast<float32 *>(gam->GetInputSignalMemory(0u));
+        float32 *gain = static_cast<float32 *>(gam->GetInputSignalMemory(1u));
+        float32 *offset = static_cast<float32 *>(gam->GetInputSignalMemory(2u));
+        float32 *out = static_cast<float32 *>(gam->GetOutputSignalMemory(0u));
+        for (uint32 i = 0u; i < 4u; i++) {
+            in[i] = static_cast<float32>(i);
+        }
+        *gain = 2.0F;
+        *offset = 0.5F;
+        ok = gam->Execute();
+        for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+            ok = (out[i] == ((2.0F * static_cast<float32>(i)) + 0.5F));
+        }
+    }
+    god->Purge();
+    return ok;
+}
+
+bool MathExpressionGAMTest::TestSetup_Failed_CompiledBackendArrayNotSupported() {
+    
+    const char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAMHelper"
+            "            Expression = \""
+            "                           Out = In + Offset;"
+            "                         \""
+            "            Backend = Compiled"
+            "            InputSignals = {"
+            "               In = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Offset = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Out = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = MathExpressionGAMDataSourceHelper"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+            
+    return !TestIntegratedInApplication(config1);
+}
+
+bool MathExpressionGAMTest::TestExecute_Optimise() {
+    
+    const char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAMHelper"
+            "            Expression = \""
+            "                           Out1 = sin(In1) * In2 * (2.0 * 3.0);"
+            "                           Out2 = sin(In1) + In2 * 1.0;"
+            "                         \""
+            "            Optimise = 1"
+            "            InputSignals = {"
+            "               In1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "               In2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Out1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "               Out2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = MathExpressionGAMDataSourceHelper"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+            
+    bool ok = TestIntegratedInApplication(config1, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAMHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = !gam->IsCompiled();
+    }
+    if (ok) {
+        float64 *in1 = static_cast<float64 *>(gam->GetInputSignalMemory(0u));
+        float64 *in2 = static_cast<float64 *>(gam->GetInputSignalMemory(1u));
+        float64 *out1 = static_cast<float64 *>(gam->GetOutputSignalMemory(0u));
+        float64 *out2 = static_cast<float64 *>(gam->GetOutputSignalMemory(1u));
+        *in1 = 2.0;
+        *in2 = 3.0;
+        ok = gam->Execute();
+        if (ok) {
+            ok = (fabs(*out1 - (sin(2.0) * 18.0)) < 1e-12) && (fabs(*out2 - (sin(2.0) + 3.0)) < 1e-12);
+        }
+    }
+    god->Purge();
+    return ok;
+}
+
+bool MathExpressionGAMTest::TestExecute_OptimiseCompiledBackend() {
+    
+    const char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAMHelper"
+            "            Expression = \""
+            "                           Out1 = sin(In1) * In2 * (2.0 * 3.0);"
+            "                           Out2 = sin(In1) + In2 * 1.0;"
+            "                         \""
+            "            Backend = Compiled"
+            "            Optimise = 1"
+            "            InputSignals = {"
+            "               In1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "               In2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Out1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "               Out2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = MathExpressionGAMDataSourceHelper"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+            
+    bool ok = TestIntegratedInApplication(config1, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAMHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = gam->IsCompiled();
+    }
+    if (ok) {
+        float64 *in1 = static_cast<float64 *>(gam->GetInputSignalMemory(0u));
+        float64 *in2 = static_cast<float64 *>(gam->GetInputSignalMemory(1u));
+        float64 *out1 = static_cast<float64 *>(gam->GetOutputSignalMemory(0u));
+        float64 *out2 = static_cast<float64 *>(gam->GetOutputSignalMemory(1u));
+        *in1 = 2.0;
+        *in2 = 3.0;
+        ok = gam->Execute();
+        if (ok) {
+            ok = (fabs(*out1 - (sin(2.0) * 18.0)) < 1e-12) && (fabs(*out2 - (sin(2.0) + 3.0)) < 1e-12);
+        }
+    }
+    god->Purge();
+    return ok;
+}
+
+bool MathExpressionGAMTest::TestExecute_SharedProgram() {
+    
+    const char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAMHelper"
+            "            Expression = \""
+            "                           Shared1 = sin(In1) * In2 * (2.0 * 3.0);"
+            "                           Shared2 = sin(In1) + In2 * 1.0;"
+            "                         \""
+            "            Optimise = 1"
+            "            InputSignals = {"
+            "               In1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "               In2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Shared1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "               Shared2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = float64"
+            "               }"
+            "            }"
+            "        }"
+            "        +GAM2 = {"
+            "            Class = MathExpressionGAMHelper"
+            "            Expression = \"Shared1 = sin(In1)   * In2 * (2.0 * 3.0); Shared2 = sin(In1) + In2 * 1.0;\""
+            "            Optimise = 1"
+            "            InputSignals = {"
+            "               In1 = {"
+            "                   DataSource = Drv1"
+            "                   Alias = In3"
+            "                   Type = float64"
+            "               }"
+            "               In2 = {"
+            "                   DataSource = Drv1"
+            "                   Alias = In4"
+            "                   Type = float64"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Shared1 = {"
+            "                   DataSource = Drv1"
+            "                   Alias = Shared3"
+            "                   Type = float64"
+            "               }"
+            "               Shared2 = {"
+            "                   DataSource = Drv1"
+            "                   Alias = Shared4"
+            "                   Type = float64"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = MathExpressionGAMDataSourceHelper"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1 GAM2}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+    
+    // the parse and the optimisation of GAM2 shall be found in the cache
+    uint32 hits = MathExpressionCache::Instance().GetNumberOfHits();
+    bool ok = TestIntegratedInApplication(config1, false);
+    if (ok) {
+        ok = (MathExpressionCache::Instance().GetNumberOfHits() >= (hits + 2u));
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAMHelper> gam1 = god->Find("Test.Functions.GAM1");
+    ReferenceT<MathExpressionGAMHelper> gam2 = god->Find("Test.Functions.GAM2");
+    if (ok) {
+        ok = (gam1.IsValid() && gam2.IsValid());
+    }
+    if (ok) {
+        ok = (gam1->GetEvaluator() != gam2->GetEvaluator());
+    }
+    if (ok) {
+        float64 *in1 = static_cast<float64 *>(gam1->GetInputSignalMemory(0u));
+        float64 *in2 = static_cast<float64 *>(gam1->GetInputSignalMemory(1u));
+        float64 *in3 = static_cast<float64 *>(gam2->GetInputSignalMemory(0u));
+        float64 *in4 = static_cast<float64 *>(gam2->GetInputSignalMemory(1u));
+        float64 *out1 = static_cast<float64 *>(gam1->GetOutputSignalMemory(0u));
+        float64 *out2 = static_cast<float64 *>(gam1->GetOutputSignalMemory(1u));
+        float64 *out3 = static_cast<float64 *>(gam2->GetOutputSignalMemory(0u));
+        float64 *out4 = static_cast<float64 *>(gam2->GetOutputSignalMemory(1u));
+        *in1 = 2.0;
+        *in2 = 3.0;
+        *in3 = 1.0;
+        *in4 = 5.0;
+        ok = gam1->Execute();
+        if (ok) {
+            ok = gam2->Execute();
+        }
+        if (ok) {
+            ok = (fabs(*out1 - (sin(2.0) * 18.0)) < 1e-12) && (fabs(*out2 - (sin(2.0) + 3.0)) < 1e-12);
+        }
+        if (ok) {
+            ok = (fabs(*out3 - (sin(1.0) * 30.0)) < 1e-12) && (fabs(*out4 - (sin(1.0) + 5.0)) < 1e-12);
+        }
+    }
+    god->Purge();
+    return ok;
+}
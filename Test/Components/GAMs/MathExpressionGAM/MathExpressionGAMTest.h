@@ -133,6 +133,65 @@ public:
      */
     bool TestExecute_MultipleExpressions();
 
+    /**
+     * @brief Tests that the Initialise method fails with an invalid Backend.
+     */
+    bool TestInitialise_Failed_WrongBackend();
+
+    /**
+     * @brief   Tests the Execute method with Backend = Compiled.
+     * @details Checks that the expression is evaluated by the
+     *          MathExpressionCompiler and that the output is correct.
+     */
+    bool TestExecute_CompiledBackend();
+
+    /**
+     * @brief   Tests the Execute method with Backend = Compiled.
+     * @details Checks that an expression which is not supported by
+     *          the MathExpressionCompiler (integer arithmetic) is
+     *          evaluated by the RuntimeEvaluator.
+     */
+    bool TestExecute_CompiledBackendFallback();
+
+    /**
+     * @brief   Tests the Execute method with Backend = Compiled and array signals.
+     * @details Checks that the expression is evaluated element by element
+     *          and that the scalar signals are broadcast.
+     */
+    bool TestExecute_CompiledBackendArray();
+
+    /**
+     * @brief   Tests the Setup method with Backend = Compiled and array signals.
+     * @details This test fails since the expression (integer arithmetic)
+     *          is not supported by the MathExpressionCompiler and the
+     *          RuntimeEvaluator can only evaluate scalars.
+     */
+    bool TestSetup_Failed_CompiledBackendArrayNotSupported();
+
+    /**
+     * @brief   Tests the Execute method with Optimise = 1.
+     * @details Checks that the optimised expression (folded constants,
+     *          removed identities and common subexpressions) is evaluated
+     *          by the RuntimeEvaluator and that the outputs are correct.
+     */
+    bool TestExecute_Optimise();
+
+    /**
+     * @brief   Tests the Execute method with Optimise = 1 and Backend = Compiled.
+     * @details Checks that the optimised expression is evaluated by the
+     *          MathExpressionCompiler and that the outputs are correct.
+     */
+    bool TestExecute_OptimiseCompiledBackend();
+
+    /**
+     * @brief   Tests that two instances with the same expression (with
+     *          different formatting) share the stack machine programs
+     *          and evaluate the expression on their own signals.
+     * @return  `true` if the second instance finds the programs in
+     *          the MathExpressionCache and both results are correct.
+     */
+    bool TestExecute_SharedProgram();
+
 };
 
 /*---------------------------------------------------------------------------*/
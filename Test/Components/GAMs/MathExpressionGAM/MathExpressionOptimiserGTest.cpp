@@ -0,0 +1,115 @@
+/**
+ * @file MathExpressionOptimiserGTest.cpp
+ * @brief Source file for class MathExpressionOptimiserGTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionOptimiserGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "MathExpressionOptimiserTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(MathExpressionOptimiserGTest,TestConstructor) {
+    MathExpressionOptimiserTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(MathExpressionOptimiserGTest,TestInitialise) {
+    MathExpressionOptimiserTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(MathExpressionOptimiserGTest,TestAddVariable) {
+    MathExpressionOptimiserTest test;
+    ASSERT_TRUE(test.TestAddVariable());
+}
+
+TEST(MathExpressionOptimiserGTest,TestOptimise_ConstantFolding) {
+    MathExpressionOptimiserTest test;
+    ASSERT_TRUE(test.TestOptimise_ConstantFolding());
+}
+
+TEST(MathExpressionOptimiserGTest,TestOptimise_ConstantPropagation) {
+    MathExpressionOptimiserTest test;
+    ASSERT_TRUE(test.TestOptimise_ConstantPropagation());
+}
+
+TEST(MathExpressionOptimiserGTest,TestOptimise_NotFinite) {
+    MathExpressionOptimiserTest test;
+    ASSERT_TRUE(test.TestOptimise_NotFinite());
+}
+
+TEST(MathExpressionOptimiserGTest,TestOptimise_Identities) {
+    MathExpressionOptimiserTest test;
+    ASSERT_TRUE(test.TestOptimise_Identities());
+}
+
+TEST(MathExpressionOptimiserGTest,TestOptimise_IdentitiesUnknownType) {
+    MathExpressionOptimiserTest test;
+    ASSERT_TRUE(test.TestOptimise_IdentitiesUnknownType());
+}
+
+TEST(MathExpressionOptimiserGTest,TestOptimise_CommonSubexpression) {
+    MathExpressionOptimiserTest test;
+    ASSERT_TRUE(test.TestOptimise_CommonSubexpression());
+}
+
+TEST(MathExpressionOptimiserGTest,TestOptimise_ReuseAssignedVariable) {
+    MathExpressionOptimiserTest test;
+    ASSERT_TRUE(test.TestOptimise_ReuseAssignedVariable());
+}
+
+TEST(MathExpressionOptimiserGTest,TestOptimise_OverwrittenVariable) {
+    MathExpressionOptimiserTest test;
+    ASSERT_TRUE(test.TestOptimise_OverwrittenVariable());
+}
+
+TEST(MathExpressionOptimiserGTest,TestOptimise_UnsupportedOperation) {
+    MathExpressionOptimiserTest test;
+    ASSERT_TRUE(test.TestOptimise_UnsupportedOperation());
+}
+
+TEST(MathExpressionOptimiserGTest,TestOptimise_IncompleteAssignment) {
+    MathExpressionOptimiserTest test;
+    ASSERT_TRUE(test.TestOptimise_IncompleteAssignment());
+}
+
+TEST(MathExpressionOptimiserGTest,TestIsTemporaryVariable) {
+    MathExpressionOptimiserTest test;
+    ASSERT_TRUE(test.TestIsTemporaryVariable());
+}
@@ -0,0 +1,296 @@
+/**
+ * @file MathExpressionOptimiserTest.cpp
+ * @brief Source file for class MathExpressionOptimiserTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionOptimiserTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "math.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MathExpressionCompiler.h"
+#include "MathExpressionOptimiser.h"
+#include "MathExpressionOptimiserTest.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * @brief Counts the instructions of the program which are equal to operation.
+ */
+MARTe::uint32 CountOperation(const MARTe::StreamString &program,
+                             const MARTe::char8 * const operation) {
+    using namespace MARTe;
+    uint32 count = 0u;
+    uint32 length = StringHelper::Length(operation);
+    const char8 *line = program.Buffer();
+    while (*line != '\0') {
+        if ((StringHelper::CompareN(line, operation, length) == 0) && ((line[length] == '\n') || (line[length] == ' '))) {
+            count++;
+        }
+        while ((*line != '\0') && (*line != '\n')) {
+            line++;
+        }
+        if (*line == '\n') {
+            line++;
+        }
+    }
+    return count;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool MathExpressionOptimiserTest::TestConstructor() {
+    using namespace MARTe;
+    MathExpressionOptimiser optimiser;
+    bool ok = (optimiser.GetNumberOfInstructions() == 0u);
+    ok &= (optimiser.GetNumberOfOptimisedInstructions() == 0u);
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestInitialise() {
+    using namespace MARTe;
+    MathExpressionOptimiser optimiser;
+    bool ok = optimiser.Initialise("READ A WRITE B", 2u);
+    ok &= !optimiser.Initialise("READ A WRITE B", 2u);
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestAddVariable() {
+    using namespace MARTe;
+    MathExpressionOptimiser optimiser;
+    bool ok = !optimiser.AddVariable("A", Float64Bit);
+    ok &= optimiser.Initialise("READ A WRITE B", 2u);
+    ok &= optimiser.AddVariable("A", Float64Bit);
+    ok &= !optimiser.AddVariable("A", Float32Bit);
+    ok &= optimiser.AddVariable("B", Float64Bit);
+    ok &= !optimiser.AddVariable("C", Float64Bit);
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestOptimise_ConstantFolding() {
+    using namespace MARTe;
+    MathExpressionOptimiser optimiser;
+    StreamString optimised;
+    bool ok = optimiser.Initialise("CONST float64 2 CONST float64 3 MUL READ A MUL WRITE B", 2u);
+    ok &= optimiser.AddVariable("A", Float64Bit);
+    ok &= optimiser.AddVariable("B", Float64Bit);
+    ok &= optimiser.Optimise(optimised);
+    ok &= (optimiser.GetNumberOfInstructions() == 6u);
+    ok &= (optimiser.GetNumberOfOptimisedInstructions() == 4u);
+    ok &= (CountOperation(optimised, "MUL") == 1u);
+    //Check that the result is preserved.
+    float64 a = 1.5;
+    float64 b = 0.0;
+    MathExpressionCompiler compiler;
+    ok &= compiler.Initialise(optimised.Buffer(), 2u);
+    ok &= compiler.AddVariable("A", Float64Bit, &a, 1u);
+    ok &= compiler.AddVariable("B", Float64Bit, &b, 1u);
+    ok &= compiler.Compile();
+    if (ok) {
+        compiler.Execute();
+        ok = (fabs(b - 9.0) < 1e-12);
+    }
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestOptimise_ConstantPropagation() {
+    using namespace MARTe;
+    MathExpressionOptimiser optimiser;
+    StreamString optimised;
+    bool ok = optimiser.Initialise("CONST float64 2 WRITE G READ G READ G MUL READ A MUL WRITE F", 2u);
+    ok &= optimiser.AddVariable("A", Float64Bit);
+    ok &= optimiser.AddVariable("F", Float64Bit);
+    ok &= optimiser.Optimise(optimised);
+    ok &= (optimiser.GetNumberOfInstructions() == 8u);
+    ok &= (optimiser.GetNumberOfOptimisedInstructions() == 6u);
+    ok &= (CountOperation(optimised, "MUL") == 1u);
+    float64 a = 3.0;
+    float64 f = 0.0;
+    MathExpressionCompiler compiler;
+    ok &= compiler.Initialise(optimised.Buffer(), 2u);
+    ok &= compiler.AddVariable("A", Float64Bit, &a, 1u);
+    ok &= compiler.AddVariable("F", Float64Bit, &f, 1u);
+    ok &= compiler.Compile();
+    if (ok) {
+        compiler.Execute();
+        ok = (fabs(f - 12.0) < 1e-12);
+    }
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestOptimise_NotFinite() {
+    using namespace MARTe;
+    MathExpressionOptimiser optimiser;
+    StreamString optimised;
+    bool ok = optimiser.Initialise("CONST float64 1 CONST float64 0 DIV WRITE B", 1u);
+    ok &= optimiser.AddVariable("B", Float64Bit);
+    ok &= optimiser.Optimise(optimised);
+    ok &= (optimiser.GetNumberOfOptimisedInstructions() == 4u);
+    ok &= (CountOperation(optimised, "DIV") == 1u);
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestOptimise_Identities() {
+    using namespace MARTe;
+    MathExpressionOptimiser optimiser;
+    StreamString optimised;
+    bool ok = optimiser.Initialise("CONST float32 1 READ A MUL CONST float32 0 ADD CAST float32 CONST float32 1 POW WRITE B", 2u);
+    ok &= optimiser.AddVariable("A", Float32Bit);
+    ok &= optimiser.AddVariable("B", Float32Bit);
+    ok &= optimiser.Optimise(optimised);
+    ok &= (optimiser.GetNumberOfInstructions() == 9u);
+    ok &= (optimiser.GetNumberOfOptimisedInstructions() == 2u);
+    ok &= (optimised == "READ A\nWRITE B\n");
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestOptimise_IdentitiesUnknownType() {
+    using namespace MARTe;
+    MathExpressionOptimiser optimiser;
+    StreamString optimised;
+    //The type of A is not known (it could be an integer and the multiplication a type conversion).
+    bool ok = optimiser.Initialise("READ A CONST float64 1 MUL WRITE B", 1u);
+    ok &= optimiser.AddVariable("B", Float64Bit);
+    ok &= optimiser.Optimise(optimised);
+    ok &= (optimiser.GetNumberOfOptimisedInstructions() == 4u);
+    ok &= (CountOperation(optimised, "MUL") == 1u);
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestOptimise_CommonSubexpression() {
+    using namespace MARTe;
+    MathExpressionOptimiser optimiser;
+    StreamString optimised;
+    bool ok = optimiser.Initialise("READ A SIN READ B MUL WRITE C READ A SIN READ D ADD WRITE E", 5u);
+    ok &= optimiser.AddVariable("A", Float64Bit);
+    ok &= optimiser.AddVariable("B", Float64Bit);
+    ok &= optimiser.AddVariable("C", Float64Bit);
+    ok &= optimiser.AddVariable("D", Float64Bit);
+    ok &= optimiser.AddVariable("E", Float64Bit);
+    ok &= optimiser.Optimise(optimised);
+    ok &= (CountOperation(optimised, "SIN") == 1u);
+    ok &= (CountOperation(optimised, "WRITE CSE@0") == 1u);
+    ok &= (CountOperation(optimised, "READ CSE@0") == 2u);
+    float64 a = 0.7;
+    float64 b = 2.0;
+    float64 c = 0.0;
+    float64 d = 3.0;
+    float64 e = 0.0;
+    MathExpressionCompiler compiler;
+    ok &= compiler.Initialise(optimised.Buffer(), 5u);
+    ok &= compiler.AddVariable("A", Float64Bit, &a, 1u);
+    ok &= compiler.AddVariable("B", Float64Bit, &b, 1u);
+    ok &= compiler.AddVariable("C", Float64Bit, &c, 1u);
+    ok &= compiler.AddVariable("D", Float64Bit, &d, 1u);
+    ok &= compiler.AddVariable("E", Float64Bit, &e, 1u);
+    ok &= compiler.Compile();
+    if (ok) {
+        compiler.Execute();
+        ok = (fabs(c - (sin(a) * b)) < 1e-12);
+        ok &= (fabs(e - (sin(a) + d)) < 1e-12);
+    }
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestOptimise_ReuseAssignedVariable() {
+    using namespace MARTe;
+    MathExpressionOptimiser optimiser;
+    StreamString optimised;
+    bool ok = optimiser.Initialise("READ A READ B ADD WRITE C READ A READ B ADD CONST float64 2 MUL WRITE D", 4u);
+    ok &= optimiser.AddVariable("A", Float64Bit);
+    ok &= optimiser.AddVariable("B", Float64Bit);
+    ok &= optimiser.AddVariable("C", Float64Bit);
+    ok &= optimiser.AddVariable("D", Float64Bit);
+    ok &= optimiser.Optimise(optimised);
+    ok &= (optimiser.GetNumberOfInstructions() == 10u);
+    ok &= (optimiser.GetNumberOfOptimisedInstructions() == 8u);
+    ok &= (CountOperation(optimised, "ADD") == 1u);
+    ok &= (CountOperation(optimised, "READ C") == 1u);
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestOptimise_OverwrittenVariable() {
+    using namespace MARTe;
+    MathExpressionOptimiser optimiser;
+    StreamString optimised;
+    bool ok = optimiser.Initialise("READ A READ B ADD WRITE C READ A WRITE C READ A READ B ADD WRITE D", 4u);
+    ok &= optimiser.AddVariable("A", Float64Bit);
+    ok &= optimiser.AddVariable("B", Float64Bit);
+    ok &= optimiser.AddVariable("C", Float64Bit);
+    ok &= optimiser.AddVariable("D", Float64Bit);
+    ok &= optimiser.Optimise(optimised);
+    ok &= (CountOperation(optimised, "ADD") == 2u);
+    float64 a = 1.0;
+    float64 b = 2.0;
+    float64 c = 0.0;
+    float64 d = 0.0;
+    MathExpressionCompiler compiler;
+    ok &= compiler.Initialise(optimised.Buffer(), 4u);
+    ok &= compiler.AddVariable("A", Float64Bit, &a, 1u);
+    ok &= compiler.AddVariable("B", Float64Bit, &b, 1u);
+    ok &= compiler.AddVariable("C", Float64Bit, &c, 1u);
+    ok &= compiler.AddVariable("D", Float64Bit, &d, 1u);
+    ok &= compiler.Compile();
+    if (ok) {
+        compiler.Execute();
+        ok = (c == 1.0);
+        ok &= (d == 3.0);
+    }
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestOptimise_UnsupportedOperation() {
+    using namespace MARTe;
+    MathExpressionOptimiser optimiser;
+    StreamString optimised;
+    bool ok = optimiser.Initialise("READ A READ B FOO WRITE C", 3u);
+    ok &= !optimiser.Optimise(optimised);
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestOptimise_IncompleteAssignment() {
+    using namespace MARTe;
+    MathExpressionOptimiser optimiser;
+    StreamString optimised;
+    bool ok = optimiser.Initialise("READ A READ B WRITE C", 3u);
+    ok &= !optimiser.Optimise(optimised);
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestIsTemporaryVariable() {
+    using namespace MARTe;
+    bool ok = MathExpressionOptimiser::IsTemporaryVariable("CSE@0");
+    ok &= !MathExpressionOptimiser::IsTemporaryVariable("CSE");
+    ok &= !MathExpressionOptimiser::IsTemporaryVariable("Out1");
+    return ok;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file MathExpressionOptimiserTest.h
+ * @brief Header file for class MathExpressionOptimiserTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MathExpressionOptimiserTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_COMPONENTS_GAMS_MATHEXPRESSIONGAM_MATHEXPRESSIONOPTIMISERTEST_H_
+#define TEST_COMPONENTS_GAMS_MATHEXPRESSIONGAM_MATHEXPRESSIONOPTIMISERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Test class for MathExpressionOptimiser
+ */
+class MathExpressionOptimiserTest {
+public:
+
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that Initialise() can only be called once.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that AddVariable() rejects repeated variables and more than the declared number of variables.
+     */
+    bool TestAddVariable();
+
+    /**
+     * @brief Tests that constant operations are folded.
+     */
+    bool TestOptimise_ConstantFolding();
+
+    /**
+     * @brief Tests that constants assigned to internal variables are folded where the variables are read.
+     */
+    bool TestOptimise_ConstantPropagation();
+
+    /**
+     * @brief Tests that operations with a non finite result are not folded.
+     */
+    bool TestOptimise_NotFinite();
+
+    /**
+     * @brief Tests that the identities and the casts to the same type are removed.
+     */
+    bool TestOptimise_Identities();
+
+    /**
+     * @brief Tests that the identities are not removed if the type of the operand is not known.
+     */
+    bool TestOptimise_IdentitiesUnknownType();
+
+    /**
+     * @brief Tests that a common subexpression is computed once and assigned to a temporary variable.
+     */
+    bool TestOptimise_CommonSubexpression();
+
+    /**
+     * @brief Tests that a common subexpression is read from the variable where it was assigned.
+     */
+    bool TestOptimise_ReuseAssignedVariable();
+
+    /**
+     * @brief Tests that a common subexpression is recomputed if the variable where it was assigned is overwritten.
+     */
+    bool TestOptimise_OverwrittenVariable();
+
+    /**
+     * @brief Tests that Optimise() fails for operations which are not known.
+     */
+    bool TestOptimise_UnsupportedOperation();
+
+    /**
+     * @brief Tests that Optimise() fails for assignments with other values pending in the stack.
+     */
+    bool TestOptimise_IncompleteAssignment();
+
+    /**
+     * @brief Tests IsTemporaryVariable().
+     */
+    bool TestIsTemporaryVariable();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_COMPONENTS_GAMS_MATHEXPRESSIONGAM_MATHEXPRESSIONOPTIMISERTEST_H_ */
@@ -0,0 +1,94 @@
+/**
+ * @file MedianFilterGAMGTest.cpp
+ * @brief Source file for class MedianFilterGAMGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MedianFilterGAMGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MedianFilterGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(MedianFilterGAMGTest,TestConstructor) {
+    MedianFilterGAMTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(MedianFilterGAMGTest,TestInitialise) {
+    MedianFilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(MedianFilterGAMGTest,TestInitialise_FalseNoWindowSize) {
+    MedianFilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseNoWindowSize());
+}
+
+TEST(MedianFilterGAMGTest,TestInitialise_FalseBadMode) {
+    MedianFilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadMode());
+}
+
+TEST(MedianFilterGAMGTest,TestSetup_FalseBadType) {
+    MedianFilterGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadType());
+}
+
+TEST(MedianFilterGAMGTest,TestSetup_FalseBadNumberOfElements) {
+    MedianFilterGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadNumberOfElements());
+}
+
+TEST(MedianFilterGAMGTest,TestExecute_Channels) {
+    MedianFilterGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Channels());
+}
+
+TEST(MedianFilterGAMGTest,TestExecute_Samples) {
+    MedianFilterGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Samples());
+}
+
+TEST(MedianFilterGAMGTest,TestPrepareNextState) {
+    MedianFilterGAMTest test;
+    ASSERT_TRUE(test.TestPrepareNextState());
+}
+
+TEST(MedianFilterGAMGTest,TestPrepareNextState_NoResetInEachState) {
+    MedianFilterGAMTest test;
+    ASSERT_TRUE(test.TestPrepareNextState_NoResetInEachState());
+}
+
+TEST(MedianFilterGAMGTest,TestInitialise_FalseBadResetInEachState) {
+    MedianFilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadResetInEachState());
+}
@@ -0,0 +1,457 @@
+/**
+ * @file MedianFilterGAMTest.cpp
+ * @brief Source file for class MedianFilterGAMTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MedianFilterGAMTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "MedianFilterGAMTest.h"
+#include "MemoryDataSourceI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class MedianFilterGAMTestGAM: public MedianFilterGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    void *GetInputSignalMemory(const uint32 signalIdx);
+
+    void *GetOutputSignalMemory(const uint32 signalIdx);
+};
+
+void *MedianFilterGAMTestGAM::GetInputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetInputSignalMemory(signalIdx);
+}
+
+void *MedianFilterGAMTestGAM::GetOutputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetOutputSignalMemory(signalIdx);
+}
+
+CLASS_REGISTER(MedianFilterGAMTestGAM, "1.0")
+
+class MedianFilterGAMTestDS: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+            const char8 * const nextStateName);
+
+    virtual bool Synchronise();
+
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+};
+CLASS_REGISTER(MedianFilterGAMTestDS, "1.0")
+
+bool MedianFilterGAMTestDS::PrepareNextState(const char8 * const currentStateName,
+        const char8 * const nextStateName) {
+    return true;
+}
+
+bool MedianFilterGAMTestDS::Synchronise() {
+    return true;
+}
+
+const char8 *MedianFilterGAMTestDS::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    return "MemoryMapInputBroker";
+}
+
+/**
+ * @brief Configures an application with a single MedianFilterGAMTestGAM (GAMA) with the parameters and signals in gamConfig.
+ * The input signals shall use the Drv1 DataSource and the output signals the DDB DataSource.
+ */
+static bool InitialiseMedianFilterApplication(const char8 * const gamConfig) {
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = MedianFilterGAMTestGAM";
+    config += gamConfig;
+    config += ""
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = MedianFilterGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    config.Seek(0);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT < RealTimeApplication > application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+
+/**
+ * @brief Gets the GAM of the application.
+ */
+static bool GetMedianFilterGAM(ReferenceT<MedianFilterGAMTestGAM> &gam) {
+    gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+    return gam.IsValid();
+}
+
+/**
+ * @brief Configuration of the tests with Mode = Channels: a window of 3 cycles over 2 float32 channels.
+ */
+static const char8 * const channelsConfig = ""
+        "            WindowSize = 3"
+        "            InputSignals = {"
+        "                A = {"
+        "                    DataSource = Drv1"
+        "                    Type = float32"
+        "                    NumberOfElements = 2"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                AFiltered = {"
+        "                    DataSource = DDB"
+        "                    Type = float32"
+        "                    NumberOfElements = 2"
+        "                }"
+        "            }";
+
+/**
+ * @brief Configuration of the tests with Mode = Samples: a window of 3 samples over blocks of 4 int16 samples.
+ */
+static const char8 * const samplesConfig = ""
+        "            WindowSize = 3"
+        "            Mode = Samples"
+        "            InputSignals = {"
+        "                A = {"
+        "                    DataSource = Drv1"
+        "                    Type = int16"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                AFiltered = {"
+        "                    DataSource = DDB"
+        "                    Type = int16"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }";
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+MedianFilterGAMTest::MedianFilterGAMTest() {
+}
+
+MedianFilterGAMTest::~MedianFilterGAMTest() {
+}
+
+bool MedianFilterGAMTest::TestConstructor() {
+    MedianFilterGAMTestGAM gam;
+    bool ret = (gam.GetWindowSize() == 0u);
+    ret &= (gam.GetMode() == MedianFilterGAMChannels);
+    return ret;
+}
+
+bool MedianFilterGAMTest::TestInitialise() {
+    ReferenceT<MedianFilterGAMTestGAM> gam;
+    bool ret = InitialiseMedianFilterApplication(samplesConfig);
+    if (ret) {
+        ret = GetMedianFilterGAM(gam);
+    }
+    if (ret) {
+        ret = (gam->GetWindowSize() == 3u);
+        ret &= (gam->GetMode() == MedianFilterGAMSamples);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool MedianFilterGAMTest::TestInitialise_FalseNoWindowSize() {
+    const char8 * const gamConfig = ""
+            "            InputSignals = {"
+            "                A = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                AFiltered = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                }"
+            "            }";
+    bool ret = !InitialiseMedianFilterApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool MedianFilterGAMTest::TestInitialise_FalseBadMode() {
+    const char8 * const gamConfig = ""
+            "            WindowSize = 3"
+            "            Mode = Elements"
+            "            InputSignals = {"
+            "                A = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                AFiltered = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                }"
+            "            }";
+    bool ret = !InitialiseMedianFilterApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool MedianFilterGAMTest::TestSetup_FalseBadType() {
+    const char8 * const gamConfig = ""
+            "            WindowSize = 3"
+            "            InputSignals = {"
+            "                A = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                AFiltered = {"
+            "                    DataSource = DDB"
+            "                    Type = float64"
+            "                }"
+            "            }";
+    bool ret = !InitialiseMedianFilterApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool MedianFilterGAMTest::TestSetup_FalseBadNumberOfElements() {
+    const char8 * const gamConfig = ""
+            "            WindowSize = 3"
+            "            InputSignals = {"
+            "                A = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                    NumberOfElements = 2"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                AFiltered = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                }"
+            "            }";
+    bool ret = !InitialiseMedianFilterApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool MedianFilterGAMTest::TestExecute_Channels() {
+    ReferenceT<MedianFilterGAMTestGAM> gam;
+    bool ret = InitialiseMedianFilterApplication(channelsConfig);
+    if (ret) {
+        ret = GetMedianFilterGAM(gam);
+    }
+    if (ret) {
+        float32 *a = static_cast<float32 *>(gam->GetInputSignalMemory(0u));
+        float32 *aFiltered = static_cast<float32 *>(gam->GetOutputSignalMemory(0u));
+        //Channel 0 is a ramp with a spike, channel 1 is constant with a negative spike.
+        const float32 channel0[] = { 1.0F, 2.0F, 100.0F, 4.0F, 5.0F, 6.0F };
+        const float32 channel1[] = { 7.0F, 7.0F, 7.0F, -50.0F, 7.0F, 7.0F };
+        const float32 expected0[] = { 1.0F, 1.0F, 2.0F, 4.0F, 5.0F, 5.0F };
+        for (uint32 n = 0u; (n < 6u) && (ret); n++) {
+            a[0] = channel0[n];
+            a[1] = channel1[n];
+            ret = gam->Execute();
+            if (ret) {
+                ret = (aFiltered[0] == expected0[n]) && (aFiltered[1] == 7.0F);
+            }
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool MedianFilterGAMTest::TestExecute_Samples() {
+    ReferenceT<MedianFilterGAMTestGAM> gam;
+    bool ret = InitialiseMedianFilterApplication(samplesConfig);
+    if (ret) {
+        ret = GetMedianFilterGAM(gam);
+    }
+    if (ret) {
+        int16 *a = static_cast<int16 *>(gam->GetInputSignalMemory(0u));
+        int16 *aFiltered = static_cast<int16 *>(gam->GetOutputSignalMemory(0u));
+        //Two blocks of a single channel: the window of the first samples of the second block has the last samples of the first block.
+        const int16 samples[] = { 10, 11, -90, 13, 14, 500, 16, 17 };
+        const int16 expected[] = { 10, 10, 10, 11, 13, 14, 16, 17 };
+        for (uint32 n = 0u; (n < 2u) && (ret); n++) {
+            for (uint32 s = 0u; s < 4u; s++) {
+                a[s] = samples[(4u * n) + s];
+            }
+            ret = gam->Execute();
+            for (uint32 s = 0u; (s < 4u) && (ret); s++) {
+                ret = (aFiltered[s] == expected[(4u * n) + s]);
+            }
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+/**
+ * @brief Executes the GAM with the value in the two channels and checks that the output is expected.
+ */
+static bool ExecuteMedianFilterCycle(ReferenceT<MedianFilterGAMTestGAM> &gam,
+                                     const float32 value,
+                                     const float32 expected) {
+    float32 *a = static_cast<float32 *>(gam->GetInputSignalMemory(0u));
+    float32 *aFiltered = static_cast<float32 *>(gam->GetOutputSignalMemory(0u));
+    a[0] = value;
+    a[1] = value;
+    bool ok = gam->Execute();
+    if (ok) {
+        ok = (aFiltered[0] == expected) && (aFiltered[1] == expected);
+    }
+    return ok;
+}
+
+bool MedianFilterGAMTest::TestPrepareNextState() {
+    ReferenceT<MedianFilterGAMTestGAM> gam;
+    bool ret = InitialiseMedianFilterApplication(channelsConfig);
+    if (ret) {
+        ret = GetMedianFilterGAM(gam);
+    }
+    if (ret) {
+        ret = gam->GetResetInEachState();
+    }
+    for (uint32 n = 0u; (n < 3u) && (ret); n++) {
+        ret = ExecuteMedianFilterCycle(gam, 7.0F, 7.0F);
+    }
+    if (ret) {
+        ret = gam->PrepareNextState("State1", "State1");
+    }
+    //Without the reset the window would be {7, 7, 1}
+    if (ret) {
+        ret = ExecuteMedianFilterCycle(gam, 1.0F, 1.0F);
+    }
+    if (ret) {
+        ret = ExecuteMedianFilterCycle(gam, 9.0F, 1.0F);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool MedianFilterGAMTest::TestPrepareNextState_NoResetInEachState() {
+    StreamString gamConfig = "            ResetInEachState = 0";
+    gamConfig += channelsConfig;
+    ReferenceT<MedianFilterGAMTestGAM> gam;
+    bool ret = InitialiseMedianFilterApplication(gamConfig.Buffer());
+    if (ret) {
+        ret = GetMedianFilterGAM(gam);
+    }
+    if (ret) {
+        ret = !gam->GetResetInEachState();
+    }
+    if (ret) {
+        ret = gam->PrepareNextState("", "State1");
+    }
+    for (uint32 n = 0u; (n < 3u) && (ret); n++) {
+        ret = ExecuteMedianFilterCycle(gam, 7.0F, 7.0F);
+    }
+    //Executed in State1: the windows are kept
+    if (ret) {
+        ret = gam->PrepareNextState("State1", "State2");
+    }
+    if (ret) {
+        ret = ExecuteMedianFilterCycle(gam, 1.0F, 7.0F);
+    }
+    //Not executed in State3: the windows are reset
+    if (ret) {
+        ret = gam->PrepareNextState("State3", "State1");
+    }
+    if (ret) {
+        ret = ExecuteMedianFilterCycle(gam, 1.0F, 1.0F);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool MedianFilterGAMTest::TestInitialise_FalseBadResetInEachState() {
+    StreamString gamConfig = "            ResetInEachState = 2";
+    gamConfig += channelsConfig;
+    bool ret = !InitialiseMedianFilterApplication(gamConfig.Buffer());
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file MedianFilterGAMTest.h
+ * @brief Header file for class MedianFilterGAMTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MedianFilterGAMTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MEDIANFILTERGAMTEST_H_
+#define MEDIANFILTERGAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MedianFilterGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the MedianFilterGAM methods
+ */
+class MedianFilterGAMTest {
+public:
+
+    /**
+     * @brief Constructor
+     */
+    MedianFilterGAMTest();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~MedianFilterGAMTest();
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails without WindowSize
+     */
+    bool TestInitialise_FalseNoWindowSize();
+
+    /**
+     * @brief Tests that the Initialise method fails with an unknown Mode
+     */
+    bool TestInitialise_FalseBadMode();
+
+    /**
+     * @brief Tests that the Setup method fails if an output signal does not have the type of its input signal
+     */
+    bool TestSetup_FalseBadType();
+
+    /**
+     * @brief Tests that the Setup method fails if an output signal does not have the number of elements of its input signal
+     */
+    bool TestSetup_FalseBadNumberOfElements();
+
+    /**
+     * @brief Tests the Execute method with Mode = Channels
+     */
+    bool TestExecute_Channels();
+
+    /**
+     * @brief Tests the Execute method with Mode = Samples, across two cycles
+     */
+    bool TestExecute_Samples();
+
+    /**
+     * @brief Tests that the PrepareNextState method resets the windows on each state change
+     */
+    bool TestPrepareNextState();
+
+    /**
+     * @brief Tests that with ResetInEachState = 0 the PrepareNextState method only resets the windows if the GAM was not executed in the previous state
+     */
+    bool TestPrepareNextState_NoResetInEachState();
+
+    /**
+     * @brief Tests that the Initialise method fails if ResetInEachState is not 0 or 1
+     */
+    bool TestInitialise_FalseBadResetInEachState();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEDIANFILTERGAMTEST_H_ */
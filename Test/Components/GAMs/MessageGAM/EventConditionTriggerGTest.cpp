@@ -80,6 +80,11 @@ TEST(EventConditionTriggerGTest,TestCheck) {
     ASSERT_TRUE(test.TestCheck());
 }
 
+TEST(EventConditionTriggerGTest,TestCheck_QueueOverflow) {
+    EventConditionTriggerTest test;
+    ASSERT_TRUE(test.TestCheck_QueueOverflow());
+}
+
 TEST(EventConditionTriggerGTest,TestExecute_ImmediateReply) {
     EventConditionTriggerTest test;
     ASSERT_TRUE(test.TestExecute_ImmediateReply());
@@ -124,3 +129,8 @@ TEST(EventConditionTriggerGTest,TestGetCPUMask) {
     EventConditionTriggerTest test;
     ASSERT_TRUE(test.TestGetCPUMask());
 }
+
+TEST(EventConditionTriggerGTest,TestGetCommandKey) {
+    EventConditionTriggerTest test;
+    ASSERT_TRUE(test.TestGetCommandKey());
+}
@@ -461,7 +461,11 @@ public:
 
     uint32 GetNumberOfConditions();
 
-    ReferenceContainer *GetMessageQueue();
+    uint32 GetNumberOfInsertedMessages();
+
+    uint32 GetNumberOfQueuedMessages();
+
+    void StopAndEmptyQueue();
 
 };
 
@@ -483,8 +487,18 @@ uint32 EventConditionTriggerTestComp::GetNumberOfConditions() {
     return numberOfConditions;
 }
 
-ReferenceContainer *EventConditionTriggerTestComp::GetMessageQueue() {
-    return &messageQueue;
+uint32 EventConditionTriggerTestComp::GetNumberOfInsertedMessages() {
+    return static_cast<uint32>(queueHead);
+}
+
+uint32 EventConditionTriggerTestComp::GetNumberOfQueuedMessages() {
+    return static_cast<uint32>(queueHead) - static_cast<uint32>(queueTail);
+}
+
+void EventConditionTriggerTestComp::StopAndEmptyQueue() {
+    (void) executor.Stop();
+    (void) executor.Stop();
+    queueTail = queueHead;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1185,9 +1199,61 @@ bool EventConditionTriggerTest::TestCheck() {
     }
 
     if (ret) {
-        ReferenceContainer* queue = comp.GetMessageQueue();
-        ret = queue->Size() == 3;
+        ret = comp.GetNumberOfInsertedMessages() == 3;
+    }
+    if (ret) {
+        ret = comp.GetOverflows() == 0;
+    }
+    return ret;
+}
+
+bool EventConditionTriggerTest::TestCheck_QueueOverflow() {
+    const char8 *config = ""
+            "                    Class = EventConditionTrigger"
+            "                    QueueSize = 2"
+            "                    EventTrigger = {"
+            "                        Command1 = 1"
+            "                    }"
+            "                    +StartStateMachine = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun1\""
+            "                        Mode = ExpectsReply"
+            "                    }";
 
+    SignalMetadata signalMetadata[1];
+    signalMetadata[0].isCommand = true;
+    signalMetadata[0].name = "Command1";
+    signalMetadata[0].offset = 0;
+    signalMetadata[0].type = UnsignedInteger32Bit;
+
+    EventConditionTriggerTestComp comp;
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        ret = comp.Initialise(cdb);
+    }
+    if (ret) {
+        ret = comp.SetMetadataConfig(signalMetadata, 1);
+    }
+    if (ret) {
+        //Nobody consumes the queue from now on
+        comp.StopAndEmptyQueue();
+        uint32 mem = 1u;
+        ret = comp.Check(reinterpret_cast<uint8 *>(&mem), &signalMetadata[0]);
+        ret &= comp.Check(reinterpret_cast<uint8 *>(&mem), &signalMetadata[0]);
+        ret &= !comp.Check(reinterpret_cast<uint8 *>(&mem), &signalMetadata[0]);
+    }
+    if (ret) {
+        ret = (comp.GetNumberOfQueuedMessages() == 2u);
+    }
+    if (ret) {
+        ret = (comp.GetOverflows() == 1u);
     }
     return ret;
 }
@@ -1675,3 +1741,68 @@ bool EventConditionTriggerTest::TestReplied_Mixed() {
 bool EventConditionTriggerTest::TestGetCPUMask() {
     return TestInitialise_CPUMask();
 }
+
+bool EventConditionTriggerTest::TestGetCommandKey() {
+    const char8 *config = ""
+            "                    Class = EventConditionTrigger"
+            "                    EventTrigger = {"
+            "                        Command1 = 258"
+            "                        State = -4"
+            "                    }"
+            "                    +StartStateMachine = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun1\""
+            "                        Mode = ExpectsReply"
+            "                    }";
+
+    SignalMetadata signalMetadata[3];
+    signalMetadata[0].isCommand = true;
+    signalMetadata[0].name = "Command1";
+    signalMetadata[0].offset = 0;
+    signalMetadata[0].type = UnsignedInteger16Bit;
+
+    signalMetadata[1].isCommand = true;
+    signalMetadata[1].name = "Command2";
+    signalMetadata[1].offset = 2;
+    signalMetadata[1].type = UnsignedInteger32Bit;
+
+    signalMetadata[2].isCommand = false;
+    signalMetadata[2].name = "State";
+    signalMetadata[2].offset = 6;
+    signalMetadata[2].type = SignedInteger32Bit;
+
+    EventConditionTriggerTestComp comp;
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        ret = comp.Initialise(cdb);
+    }
+    if (ret) {
+        ret = comp.SetMetadataConfig(signalMetadata, 3);
+    }
+    uint64 key = 0u;
+    if (ret) {
+        ret = comp.GetCommandKey(&signalMetadata[0], key);
+    }
+    if (ret) {
+        uint16 value = 258u;
+        ret = (key == EventConditionTrigger::GetKey(reinterpret_cast<uint8 *>(&value), 2u));
+        ret &= (key == 258u);
+    }
+    if (ret) {
+        //No condition on Command2
+        ret = !comp.GetCommandKey(&signalMetadata[1], key);
+    }
+    if (ret) {
+        int32 state = -4;
+        int32 otherState = -5;
+        ret = (EventConditionTrigger::GetKey(reinterpret_cast<uint8 *>(&state), 4u) != EventConditionTrigger::GetKey(reinterpret_cast<uint8 *>(&otherState), 4u));
+    }
+    return ret;
+}
@@ -103,6 +103,11 @@ public:
      */
     bool TestCheck();
 
+    /**
+     * @brief Tests that the event is not triggered (and the overflow is counted) when the queue is full.
+     */
+    bool TestCheck_QueueOverflow();
+
     /**
      * @brief Tests the EventConditionTrigger::Execute method
      * with messages with immediate replies
@@ -153,6 +158,11 @@ public:
     * @brief Same as TestExecute_ImmediateReply, which already uses the EventCondition field
     */
     bool TestEventConditionField();
+
+    /**
+    * @brief Tests the GetCommandKey and the GetKey methods
+    */
+    bool TestGetCommandKey();
 };
 
 /*---------------------------------------------------------------------------*/
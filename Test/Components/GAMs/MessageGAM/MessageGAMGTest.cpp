@@ -110,3 +110,8 @@ TEST(MessageGAMGTest,TestGetNumberOfEvents) {
     MessageGAMTest test;
     ASSERT_TRUE(test.TestGetNumberOfEvents());
 }
+
+TEST(MessageGAMGTest,TestExecute_IndexedEvents) {
+    MessageGAMTest test;
+    ASSERT_TRUE(test.TestExecute_IndexedEvents());
+}
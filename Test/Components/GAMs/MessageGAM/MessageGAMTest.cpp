@@ -1901,3 +1901,212 @@ bool MessageGAMTest::TestGetNumberOfEvents() {
     return TestSetup();
 }
 
+bool MessageGAMTest::TestExecute_IndexedEvents() {
+    const char8 *config = ""
+            "$Application = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "           Class = MessageGAMTestGAM"
+            "            +Events = {"
+            "                Class = ReferenceContainer"
+            "                +Event3 = {"
+            "                    Class = EventConditionTrigger"
+            "                    EventTrigger = {"
+            "                        Command = 3"
+            "                    }"
+            "                    +Fun3Mess = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun3\""
+            "                        Mode = ExpectsReply"
+            "                    }"
+            "                }"
+            "                +Event1 = {"
+            "                    Class = EventConditionTrigger"
+            "                    EventTrigger = {"
+            "                        Command = 1"
+            "                    }"
+            "                    +Fun1Mess = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun1\""
+            "                        Mode = ExpectsReply"
+            "                    }"
+            "                }"
+            "                +Event2 = {"
+            "                    Class = EventConditionTrigger"
+            "                    EventTrigger = {"
+            "                        Command = 2"
+            "                    }"
+            "                    +Fun2Mess = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun2\""
+            "                        Mode = ExpectsReply"
+            "                    }"
+            "                }"
+            "                +Event2Bis = {"
+            "                    Class = EventConditionTrigger"
+            "                    EventTrigger = {"
+            "                        Command = 2"
+            "                        State = 1"
+            "                    }"
+            "                    +Fun3Mess = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun3\""
+            "                        Mode = ExpectsReply"
+            "                    }"
+            "                }"
+            "                +Event1OnCommand1 = {"
+            "                    Class = EventConditionTrigger"
+            "                    EventTrigger = {"
+            "                        Command1 = 2"
+            "                    }"
+            "                    +Fun1Mess = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun1\""
+            "                        Mode = ExpectsReply"
+            "                    }"
+            "                }"
+            "             }"
+            "             InputSignals = {"
+            "                 Command = {"
+            "                     DataSource = Input"
+            "                     Frequency = 1"
+            "                     Type = uint32"
+            "                 }"
+            "                 Command1 = {"
+            "                     DataSource = Input"
+            "                     Type = uint32"
+            "                 }"
+            "                 State = {"
+            "                     DataSource = Input"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 ReplyState = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                 }"
+            "                 ReplyState1 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Input = {"
+            "            Class = MessageGAMTestDS"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<MessageGAMTestGAM> test;
+    if (ret) {
+        test = ObjectRegistryDatabase::Instance()->Find("Application.Functions.GAM1");
+        ret = test.IsValid();
+    }
+    ReferenceContainer inputBrokers;
+    ReferenceT < MemoryMapSynchronisedInputBroker > brokerIn;
+    ReferenceT < MemoryMapInputBroker > brokerIn1;
+    if (ret) {
+        test->GetInputBrokers(inputBrokers);
+        brokerIn = inputBrokers.Get(0);
+        ret = brokerIn.IsValid();
+    }
+    if (ret) {
+        brokerIn1 = inputBrokers.Get(1);
+        ret = brokerIn1.IsValid();
+    }
+    ReferenceT < MessageGAMTestDS > ds;
+    if (ret) {
+        ds = ObjectRegistryDatabase::Instance()->Find("Application.Data.Input");
+        ret = ds.IsValid();
+    }
+    uint32 *outMem = NULL;
+    if (ret) {
+        ret = (test->GetNumberOfEvents() == 5u);
+        outMem = (uint32*) test->GetOutputMemoryX();
+    }
+    if (ret) {
+        ds->ChangeCommand(0u, 10u);
+        brokerIn->Execute();
+        brokerIn1->Execute();
+        test->Execute();
+    }
+    //Only the events of Command with value 2 (and State == 1) are triggered
+    if (ret) {
+        ds->ResetFlag();
+        ds->ChangeCommand(0u, 2u);
+        ds->ChangeCommand(2u, 1u);
+        brokerIn->Execute();
+        brokerIn1->Execute();
+        test->Execute();
+        ret = (outMem[0] == 2u) && (outMem[1] == 0u);
+    }
+    if (ret) {
+        Sleep::Sec(1);
+        ret = (ds->GetFlag() == 0x6);
+    }
+    //The replies are collected only from the events of Command
+    if (ret) {
+        brokerIn->Execute();
+        brokerIn1->Execute();
+        test->Execute();
+        ret = (outMem[0] == 0u);
+    }
+    //A value without events
+    if (ret) {
+        ds->ResetFlag();
+        ds->ChangeCommand(0u, 4u);
+        brokerIn->Execute();
+        brokerIn1->Execute();
+        test->Execute();
+        ret = (outMem[0] == 0u);
+    }
+    if (ret) {
+        ds->ChangeCommand(0u, 3u);
+        brokerIn->Execute();
+        brokerIn1->Execute();
+        test->Execute();
+        ret = (outMem[0] == 1u);
+    }
+    if (ret) {
+        Sleep::Sec(1);
+        ret = (ds->GetFlag() == 0x4);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+
+    return ret;
+}
@@ -124,6 +124,11 @@ public:
     */
     bool TestGetNumberOfEvents();
 
+    /**
+    * @brief Tests that only the events expecting the current value of a command are checked (and queried for replies)
+    */
+    bool TestExecute_IndexedEvents();
+
 };
 
 /*---------------------------------------------------------------------------*/
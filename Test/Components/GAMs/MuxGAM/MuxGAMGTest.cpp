@@ -493,3 +493,18 @@ TEST(MuxGAMGTest,TestExecute4I2OInvalidSelectorSingle) {
 
 
 	
+
+TEST(MuxGAMGTest,TestExecute4I2OStaticInputSingle) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OStaticInput<float64>("float64", 80, 1));
+}
+
+TEST(MuxGAMGTest,TestExecute4I2OStaticInputArray) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OStaticInput<int16>("int16", 80, 80));
+}
+
+TEST(MuxGAMGTest,TestSetupWrongStaticInput) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestSetupWrongStaticInput());
+}
@@ -1667,5 +1667,24 @@ bool MuxGAMTest::TestSetup4I2O(StreamString strType,
 }
 
 
+bool MuxGAMTest::TestSetupWrongStaticInput() {
+    MuxGAMTestHelper gam;
+    StreamString staticInputs[] = { "InputSignal1", "Selector0" };
+    Vector<StreamString> staticInputsVector(staticInputs, 2u);
+    bool ok = gam.config.Write("StaticInputs", staticInputsVector);
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.Setup4Inputs2Outputs("float32", 4u, 1u);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+
+    if (ok) {
+        ok &= !gam.Setup();
+    }
+    return ok;
+}
+
+
 }
 
@@ -336,6 +336,24 @@ public:
                                         uint32 nOfElements,
                                         uint32 nOfSelectorElements);
 
+    /**
+     * @brief Test MuxGAM::Execute() with a static input signal.
+     * @details Verifies that an output routing a static input is not copied again while its selector does not change.
+     * @param[in] strType indicates the type of the input and output signals of the MuxGAM.
+     * @param[in] nOfElements indicates the elements of the input and output signals of the MuxGAM.
+     * @param[in] nOfSelectorElements indicates the elements of the selector signals of the MuxGAM.
+     */
+    template<typename T>
+    bool TestExecute4I2OStaticInput(StreamString strType,
+                                    uint32 nOfElements,
+                                    uint32 nOfSelectorElements);
+
+    /**
+     * @brief Test messages errors MuxGAM::Setup().
+     * @details A selector is declared in StaticInputs.
+     */
+    bool TestSetupWrongStaticInput();
+
 };
 
 }
@@ -448,6 +466,7 @@ public:
         ok &= configSignals.Write("ByteSize", sizeInputSelectors);
         ok &= configSignals.MoveToAncestor(1u);
         ok &= configSignals.CreateRelative("2");
+        ok &= configSignals.Write("QualifiedName", "InputSignal0");
         ok &= configSignals.Write("Type", strType.Buffer());
         ok &= configSignals.Write("NumberOfElements", nOfElements);
         ok &= configSignals.Write("NumberOfDimensions", 1);
@@ -455,6 +474,7 @@ public:
         ok &= configSignals.Write("ByteSize", sizeInputSignals);
         ok &= configSignals.MoveToAncestor(1u);
         ok &= configSignals.CreateRelative("3");
+        ok &= configSignals.Write("QualifiedName", "InputSignal1");
         ok &= configSignals.Write("Type", strType.Buffer());
         ok &= configSignals.Write("NumberOfElements", nOfElements);
         ok &= configSignals.Write("NumberOfDimensions", 1);
@@ -807,7 +827,72 @@ bool MuxGAMTest::TestExecute4I2OInvalidSelector(StreamString strType,
     }
     return ok;
 }
+
+template<typename T>
+bool MuxGAMTest::TestExecute4I2OStaticInput(StreamString strType,
+                                            uint32 nOfElements,
+                                            uint32 nOfSelectorElements) {
+    MuxGAMTestHelper gam;
+    StreamString staticInputs[] = { "InputSignal1" };
+    Vector<StreamString> staticInputsVector(staticInputs, 1u);
+    bool ok = gam.config.Write("StaticInputs", staticInputsVector);
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.Setup4Inputs2Outputs(strType, nOfElements, nOfSelectorElements);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+
+    if (ok) {
+        ok &= gam.Setup();
+    }
+    if (ok) {
+        uint32 * selector0 = static_cast<uint32 *>(gam.GetInputSignalsMemory(0u));
+        uint32 * selector1 = static_cast<uint32 *>(gam.GetInputSignalsMemory(1u));
+        T * input0 = static_cast<T *>(gam.GetInputSignalsMemory(2u));
+        T * input1 = static_cast<T *>(gam.GetInputSignalsMemory(3u));
+        T * Output0 = static_cast<T *>(gam.GetOutputSignalsMemory(0u));
+        T * Output1 = static_cast<T *>(gam.GetOutputSignalsMemory(1u));
+        for (uint32 i = 0u; i < nOfElements; i++) {
+            input0[i] = static_cast<T>(i + 1u);
+            input1[i] = static_cast<T>(i + 2u);
+        }
+        for (uint32 i = 0u; i < nOfSelectorElements; i++) {
+            selector0[i] = 0u;
+            selector1[i] = 1u;
+        }
+        ok &= gam.Execute();
+        //The static input is modified but its selector does not change: no copy (this does not happen with a real static input)
+        for (uint32 i = 0u; i < nOfElements; i++) {
+            input0[i] = static_cast<T>(i + 3u);
+            input1[i] = static_cast<T>(i + 4u);
+        }
+        if (ok) {
+            ok &= gam.Execute();
+        }
+        for (uint32 i = 0u; (i < nOfElements) && ok; i++) {
+            ok &= (Output0[i] == input0[i]);
+            if (ok) {
+                ok &= (Output1[i] == static_cast<T>(i + 2u));
+            }
+        }
+        //Selector change: the static input is copied again
+        for (uint32 i = 0u; i < nOfSelectorElements; i++) {
+            selector0[i] = 1u;
+            selector1[i] = 0u;
+        }
+        if (ok) {
+            ok &= gam.Execute();
+        }
+        for (uint32 i = 0u; (i < nOfElements) && ok; i++) {
+            ok &= (Output0[i] == input1[i]);
+            if (ok) {
+                ok &= (Output1[i] == input0[i]);
+            }
+        }
+    }
+    return ok;
+}
 }
 
 #endif /* MUXGAMTEST_H_ */
-
@@ -315,5 +315,87 @@ TEST(PIDGAMGTest, TestExecuteSaturationki3) {
     ASSERT_TRUE(test.TestExecuteSaturationki3());
 }
 
+TEST(PIDGAMGTest, TestInitialiseWrongParameterArrays) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongParameterArrays());
+}
+
+TEST(PIDGAMGTest, TestInitialiseWrongParameterArraysSaturation) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongParameterArraysSaturation());
+}
+
+TEST(PIDGAMGTest, TestSetupWrongNumberOfChannels) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestSetupWrongNumberOfChannels());
+}
+
+TEST(PIDGAMGTest, TestExecuteMultiChannel) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMultiChannel());
+}
+
+TEST(PIDGAMGTest, TestExecuteMultiChannelArrays) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMultiChannelArrays());
+}
+
+TEST(PIDGAMGTest, TestInitialiseWrongFractionalBits) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongFractionalBits());
+}
+
+TEST(PIDGAMGTest, TestSetupWrongSignalType) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestSetupWrongSignalType());
+}
+
+TEST(PIDGAMGTest, TestSetupWrongFixedPointGains) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestSetupWrongFixedPointGains());
+}
+
+TEST(PIDGAMGTest, TestExecuteFloat32) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestExecuteFloat32());
+}
+
+TEST(PIDGAMGTest, TestExecuteFixedPoint) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestExecuteFixedPoint());
+}
+
+TEST(PIDGAMGTest, TestInitialiseSchedule) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSchedule());
+}
+
+TEST(PIDGAMGTest, TestInitialiseScheduleWrongBreakpoints) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseScheduleWrongBreakpoints());
+}
+
+TEST(PIDGAMGTest, TestInitialiseScheduleWrongParameterArrays) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseScheduleWrongParameterArrays());
+}
+
+TEST(PIDGAMGTest, TestSetupScheduleWrongSchedulingVariable) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestSetupScheduleWrongSchedulingVariable());
+}
+
+TEST(PIDGAMGTest, TestExecuteSchedule) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSchedule());
+}
 
+TEST(PIDGAMGTest, TestExecuteScheduleBumpless) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestExecuteScheduleBumpless());
+}
 
+TEST(PIDGAMGTest, TestExecuteScheduleFixedPoint) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestExecuteScheduleFixedPoint());
+}
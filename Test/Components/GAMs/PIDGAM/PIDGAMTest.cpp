@@ -97,7 +97,7 @@ public:
 
         ok = configSignals.CreateAbsolute("Signals.InputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
@@ -116,7 +116,7 @@ public:
         ok &= configSignals.MoveToRoot();
         ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
@@ -136,26 +136,27 @@ public:
         return ok;
     }
 
-    bool HelperSetup2() {
+    bool HelperSetup2(const char8 * const typeName = "float64",
+                      const uint32 typeSize = sizeof(float64)) {
         bool ok;
         uint32 numberOfInputSignals = 2;
-        uint32 byteSizePerSignal = numberOfElements * sizeof(float64);
+        uint32 byteSizePerSignal = numberOfElements * typeSize;
         uint32 totalInputBytes = byteSizePerSignal*numberOfInputSignals;
         uint32 totalOutputBytes = byteSizePerSignal;
 
         ok = configSignals.CreateAbsolute("Signals.InputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
-        ok &= configSignals.Write("Type", "float64");
+        ok &= configSignals.Write("Type", typeName);
         ok &= configSignals.Write("ByteSize", byteSizePerSignal);
         ok &= configSignals.MoveAbsolute("Signals.InputSignals");
         ok &= configSignals.CreateRelative("1");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Measurement");
         ok &= configSignals.Write("NumberOfDimensions", 1);
-        ok &= configSignals.Write("Type", "float64");
+        ok &= configSignals.Write("Type", typeName);
         ok &= configSignals.Write("ByteSize", byteSizePerSignal);
         ok &= configSignals.MoveToAncestor(1u);
         ok &= configSignals.Write("ByteSize", totalInputBytes);
@@ -177,10 +178,10 @@ public:
         ok &= configSignals.MoveToRoot();
         ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
-        ok &= configSignals.Write("Type", "float64");
+        ok &= configSignals.Write("Type", typeName);
         ok &= configSignals.Write("ByteSize", byteSizePerSignal);
         ok &= configSignals.MoveAbsolute("Signals.OutputSignals");
         ok &= configSignals.Write("ByteSize", totalOutputBytes);
@@ -197,6 +198,34 @@ public:
         return ok;
     }
 
+    bool HelperSetupSchedule(const char8 * const typeName = "float64",
+                             const uint32 typeSize = sizeof(float64),
+                             const char8 * const schedulingTypeName = "float64",
+                             const uint32 schedulingElements = 1u) {
+        bool ok = HelperSetup2(typeName, typeSize);
+        uint32 byteSizePerSignal = numberOfElements * typeSize;
+        uint32 schedulingByteSize = schedulingElements * sizeof(float64);
+        ok &= configSignals.MoveAbsolute("Signals.InputSignals");
+        ok &= configSignals.Delete("ByteSize");
+        ok &= configSignals.Write("ByteSize", (2u * byteSizePerSignal) + schedulingByteSize);
+        ok &= configSignals.CreateRelative("2");
+        ok &= configSignals.Write("NumberOfElements", schedulingElements);
+        ok &= configSignals.Write("DataSource", "OperatingPoint");
+        ok &= configSignals.Write("NumberOfDimensions", (schedulingElements > 1u) ? 1 : 0);
+        ok &= configSignals.Write("Type", schedulingTypeName);
+        ok &= configSignals.Write("ByteSize", schedulingByteSize);
+
+        ok &= configSignals.MoveAbsolute("Memory.InputSignals");
+        ok &= configSignals.CreateRelative("2");
+        ok &= configSignals.Write("DataSource", "OperatingPoint");
+        ok &= configSignals.CreateRelative("Signals");
+        ok &= configSignals.CreateRelative("2");
+        ok &= configSignals.Write("Samples", 1);
+
+        ok &= configSignals.MoveToRoot();
+        return ok;
+    }
+
     bool IsEqualLargerMargins(float64 f1,
                               float64 f2) {
         float64 *min = reinterpret_cast<float64*>(const_cast<uint64*>(&EPSILON_FLOAT64));
@@ -2415,5 +2444,498 @@ bool PIDGAMTest::TestExecuteSaturationki3() {
     return ret;
 }
 
+bool PIDGAMTest::TestInitialiseWrongParameterArrays() {
+    PIDGAM gam;
+    ConfigurationDatabase config;
+    float64 kpArray[] = { 1.0, 2.0, 3.0 };
+    float64 kiArray[] = { 1.0, 2.0 };
+    Vector<float64> kpVector(kpArray, 3u);
+    Vector<float64> kiVector(kiArray, 2u);
+    bool ret = config.Write("Kp", kpVector);
+    ret &= config.Write("Ki", kiVector);
+    ret &= config.Write("SampleTime", 0.001);
+    if (ret) {
+        ret = !gam.Initialise(config);
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestInitialiseWrongParameterArraysSaturation() {
+    PIDGAM gam;
+    ConfigurationDatabase config;
+    float64 kpArray[] = { 1.0, 2.0, 3.0 };
+    float64 maxOutputArray[] = { 1.0, 2.0, -3.0 };
+    Vector<float64> kpVector(kpArray, 3u);
+    Vector<float64> maxOutputVector(maxOutputArray, 3u);
+    bool ret = config.Write("Kp", kpVector);
+    ret &= config.Write("SampleTime", 0.001);
+    ret &= config.Write("MaxOutput", maxOutputVector);
+    ret &= config.Write("MinOutput", -1.0);
+    if (ret) {
+        ret = !gam.Initialise(config);
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestSetupWrongNumberOfChannels() {
+    PIDGAMTestHelper gam(1.0, 1.2, 1.3, 0.001, 0x1.FFFFFFFFFFFFFp1023, -0x1.FFFFFFFFFFFFFp1023, 4u);
+    float64 kpArray[] = { 1.0, 2.0, 3.0 };
+    Vector<float64> kpVector(kpArray, 3u);
+    bool ret = gam.config.Write("Kp", kpVector);
+    ret &= gam.config.Write("SampleTime", 0.001);
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetup2();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    if (ret) {
+        ret = !gam.Setup();
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestExecuteMultiChannel() {
+    const uint32 numberOfChannels = 5u;
+    PIDGAMTestHelper gam(1.0, 1.2, 1.3, 0.001, 0x1.FFFFFFFFFFFFFp1023, -0x1.FFFFFFFFFFFFFp1023, numberOfChannels);
+    bool ret = gam.HelperInitialise();
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetup2();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+    if (ret) {
+        float64 *gamMemoryInR = static_cast<float64 *>(gam.GetInputSignalsMemory(0u));
+        float64 *gamMemoryInM = static_cast<float64 *>(gam.GetInputSignalsMemory(1u));
+        float64 *gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory(0u));
+        float64 lastError[numberOfChannels];
+        float64 lastIntegral[numberOfChannels];
+        for (uint32 c = 0u; c < numberOfChannels; c++) {
+            lastError[c] = 0.0;
+            lastIntegral[c] = 0.0;
+        }
+        for (uint32 i = 0u; (i < 10u) && (ret); i++) {
+            for (uint32 c = 0u; c < numberOfChannels; c++) {
+                gamMemoryInR[c] = static_cast<float64>(c + 1u);
+                gamMemoryInM[c] = static_cast<float64>(i) * 0.1;
+            }
+            gam.Execute();
+            for (uint32 c = 0u; (c < numberOfChannels) && (ret); c++) {
+                float64 error = gamMemoryInR[c] - gamMemoryInM[c];
+                float64 integral = (error * 1.2 * 0.001) + lastIntegral[c];
+                float64 expected = ((1.0 * error) + integral) + ((error - lastError[c]) * (1.3 / 0.001));
+                lastError[c] = error;
+                lastIntegral[c] = integral;
+                ret = gam.IsEqualLargerMargins(gamMemoryOut[c], expected);
+                if (!ret) {
+                    printf("output value = %.17lf. expectedValue = %.17lf. channel = %u \n", gamMemoryOut[c], expected, c);
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestExecuteMultiChannelArrays() {
+    const uint32 numberOfChannels = 3u;
+    float64 kpArray[] = { 0.0, 1.0, 0.5 };
+    float64 kiArray[] = { 500.0, 0.0, 500.0 };
+    float64 maxOutputArray[] = { 0.2, 0.1, 0x1.FFFFFFFFFFFFFp1023 };
+    float64 minOutputArray[] = { -0.2, -0.1, -0x1.FFFFFFFFFFFFFp1023 };
+    Vector<float64> kpVector(kpArray, numberOfChannels);
+    Vector<float64> kiVector(kiArray, numberOfChannels);
+    Vector<float64> maxOutputVector(maxOutputArray, numberOfChannels);
+    Vector<float64> minOutputVector(minOutputArray, numberOfChannels);
+    PIDGAMTestHelper gam(1.0, 1.2, 1.3, 0.001, 0x1.FFFFFFFFFFFFFp1023, -0x1.FFFFFFFFFFFFFp1023, numberOfChannels);
+    bool ret = gam.config.Write("Kp", kpVector);
+    ret &= gam.config.Write("Ki", kiVector);
+    ret &= gam.config.Write("SampleTime", 0.001);
+    ret &= gam.config.Write("MaxOutput", maxOutputVector);
+    ret &= gam.config.Write("MinOutput", minOutputVector);
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetup2();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+
+    //Each channel is compared against a single channel PIDGAM with the same parameters
+    PIDGAMTestHelper *single[numberOfChannels];
+    for (uint32 c = 0u; c < numberOfChannels; c++) {
+        single[c] = new PIDGAMTestHelper(kpArray[c], kiArray[c], 0.0, 0.001, maxOutputArray[c], minOutputArray[c]);
+        ret &= single[c]->HelperInitialise();
+        ret &= single[c]->Initialise(single[c]->config);
+        ret &= single[c]->HelperSetup2();
+        ret &= single[c]->SetConfiguredDatabase(single[c]->configSignals);
+        ret &= single[c]->AllocateInputSignalsMemory();
+        ret &= single[c]->AllocateOutputSignalsMemory();
+        ret &= single[c]->Setup();
+    }
+    if (ret) {
+        float64 *gamMemoryInR = static_cast<float64 *>(gam.GetInputSignalsMemory(0u));
+        float64 *gamMemoryInM = static_cast<float64 *>(gam.GetInputSignalsMemory(1u));
+        float64 *gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory(0u));
+        for (uint32 c = 0u; c < numberOfChannels; c++) {
+            gamMemoryInM[c] = 0.0;
+        }
+        for (uint32 i = 0u; (i < 7u) && (ret); i++) {
+            for (uint32 c = 0u; c < numberOfChannels; c++) {
+                gamMemoryInR[c] = (i < 3u) ? (1.0) : (0.0);
+                *static_cast<float64 *>(single[c]->GetInputSignalsMemory(0u)) = gamMemoryInR[c];
+                *static_cast<float64 *>(single[c]->GetInputSignalsMemory(1u)) = gamMemoryInM[c];
+                single[c]->Execute();
+            }
+            gam.Execute();
+            for (uint32 c = 0u; (c < numberOfChannels) && (ret); c++) {
+                float64 expected = *static_cast<float64 *>(single[c]->GetOutputSignalsMemory(0u));
+                ret = gam.IsEqualLargerMargins(gamMemoryOut[c], expected);
+                if (!ret) {
+                    printf("output value = %.17lf. expectedValue = %.17lf. channel = %u \n", gamMemoryOut[c], expected, c);
+                }
+                gamMemoryInM[c] = gamMemoryOut[c];
+            }
+        }
+    }
+    for (uint32 c = 0u; c < numberOfChannels; c++) {
+        delete single[c];
+    }
+    return ret;
 }
 
+bool PIDGAMTest::TestInitialiseWrongFractionalBits() {
+    PIDGAMTestHelper gam;
+    bool ret = gam.HelperInitialise();
+    ret &= gam.config.Write("FractionalBits", 31u);
+    if (ret) {
+        ret = !gam.Initialise(gam.config);
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestSetupWrongSignalType() {
+    PIDGAMTestHelper gam;
+    bool ret = gam.HelperInitialise();
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetup2("uint32", sizeof(uint32));
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    if (ret) {
+        ret = !gam.Setup();
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestSetupWrongFixedPointGains() {
+    //In Q16 the largest representable gain is 32767.99998
+    PIDGAMTestHelper gam(40000.0, 0.0, 0.0);
+    bool ret = gam.HelperInitialise();
+    ret &= gam.config.Write("FractionalBits", 16u);
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetup2("int32", sizeof(int32));
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    if (ret) {
+        ret = !gam.Setup();
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestExecuteFloat32() {
+    const uint32 numberOfChannels = 5u;
+    PIDGAMTestHelper gam(2.0, 0.0, 0.0, 0.001, 3.0, -3.0, numberOfChannels);
+    bool ret = gam.HelperInitialise();
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetup2("float32", sizeof(float32));
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+    if (ret) {
+        float32 *gamMemoryInR = static_cast<float32 *>(gam.GetInputSignalsMemory(0u));
+        float32 *gamMemoryInM = static_cast<float32 *>(gam.GetInputSignalsMemory(1u));
+        float32 *gamMemoryOut = static_cast<float32 *>(gam.GetOutputSignalsMemory(0u));
+        for (uint32 c = 0u; c < numberOfChannels; c++) {
+            gamMemoryInR[c] = static_cast<float32>(c) * 0.5F;
+            gamMemoryInM[c] = 0.25F;
+        }
+        gam.Execute();
+        for (uint32 c = 0u; (c < numberOfChannels) && (ret); c++) {
+            float32 expected = 2.0F * (gamMemoryInR[c] - 0.25F);
+            expected = (expected > 3.0F) ? (3.0F) : (expected);
+            ret = (gamMemoryOut[c] == expected);
+            if (!ret) {
+                printf("output value = %f. expectedValue = %f. channel = %u \n", gamMemoryOut[c], expected, c);
+            }
+        }
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestExecuteFixedPoint() {
+    const uint32 numberOfChannels = 3u;
+    const int32 one = 65536;
+    //Q16. kp = 0.5, ki * sampleTime = 0.25 and the output is limited to [-1.0, 1.0]
+    PIDGAMTestHelper gam(0.5, 250.0, 0.0, 0.001, 1.0, -1.0, numberOfChannels);
+    bool ret = gam.HelperInitialise();
+    ret &= gam.config.Write("FractionalBits", 16u);
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetup2("int32", sizeof(int32));
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+    if (ret) {
+        int32 *gamMemoryInR = static_cast<int32 *>(gam.GetInputSignalsMemory(0u));
+        int32 *gamMemoryInM = static_cast<int32 *>(gam.GetInputSignalsMemory(1u));
+        int32 *gamMemoryOut = static_cast<int32 *>(gam.GetOutputSignalsMemory(0u));
+        gamMemoryInR[0] = one / 2;
+        gamMemoryInR[1] = -one / 2;
+        gamMemoryInR[2] = 4 * one;
+        for (uint32 c = 0u; c < numberOfChannels; c++) {
+            gamMemoryInM[c] = 0;
+        }
+        //first cycle: 0.5 * e + 0.25 * e. second cycle: 0.5 * e + 0.5 * e.
+        int32 expected[2][3] = { { 3 * one / 8, -3 * one / 8, one }, { one / 2, -one / 2, one } };
+        for (uint32 i = 0u; (i < 2u) && (ret); i++) {
+            gam.Execute();
+            for (uint32 c = 0u; (c < numberOfChannels) && (ret); c++) {
+                ret = (gamMemoryOut[c] == expected[i][c]);
+                if (!ret) {
+                    printf("output value = %d. expectedValue = %d. channel = %u \n", gamMemoryOut[c], expected[i][c], c);
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestInitialiseSchedule() {
+    PIDGAM gam;
+    ConfigurationDatabase config;
+    float64 breakpoints[] = { 0.0, 1.0, 3.0 };
+    float64 kpArray[] = { 1.0, 2.0, 4.0 };
+    Vector<float64> breakpointsVector(breakpoints, 3u);
+    Vector<float64> kpVector(kpArray, 3u);
+    bool ret = config.CreateRelative("Schedule");
+    ret &= config.Write("Breakpoints", breakpointsVector);
+    ret &= config.Write("Kp", kpVector);
+    ret &= config.Write("Ki", 1.0);
+    ret &= config.MoveToRoot();
+    ret &= config.Write("SampleTime", 0.001);
+    if (ret) {
+        ret = gam.Initialise(config);
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestInitialiseScheduleWrongBreakpoints() {
+    PIDGAM gam;
+    ConfigurationDatabase config;
+    float64 breakpoints[] = { 0.0, 2.0, 1.0 };
+    Vector<float64> breakpointsVector(breakpoints, 3u);
+    bool ret = config.CreateRelative("Schedule");
+    ret &= config.Write("Breakpoints", breakpointsVector);
+    ret &= config.Write("Kp", 1.0);
+    ret &= config.MoveToRoot();
+    ret &= config.Write("SampleTime", 0.001);
+    if (ret) {
+        ret = !gam.Initialise(config);
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestInitialiseScheduleWrongParameterArrays() {
+    PIDGAM gam;
+    ConfigurationDatabase config;
+    float64 breakpoints[] = { 0.0, 1.0, 3.0 };
+    float64 kpArray[] = { 1.0, 2.0 };
+    Vector<float64> breakpointsVector(breakpoints, 3u);
+    Vector<float64> kpVector(kpArray, 2u);
+    bool ret = config.CreateRelative("Schedule");
+    ret &= config.Write("Breakpoints", breakpointsVector);
+    ret &= config.Write("Kp", kpVector);
+    ret &= config.MoveToRoot();
+    ret &= config.Write("SampleTime", 0.001);
+    if (ret) {
+        ret = !gam.Initialise(config);
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestSetupScheduleWrongSchedulingVariable() {
+    PIDGAMTestHelper gam;
+    float64 breakpoints[] = { 0.0, 1.0 };
+    Vector<float64> breakpointsVector(breakpoints, 2u);
+    bool ret = gam.config.CreateRelative("Schedule");
+    ret &= gam.config.Write("Breakpoints", breakpointsVector);
+    ret &= gam.config.Write("Kp", 1.0);
+    ret &= gam.config.MoveToRoot();
+    ret &= gam.config.Write("SampleTime", 0.001);
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetupSchedule("float64", sizeof(float64), "float64", 2u);
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    if (ret) {
+        ret = !gam.Setup();
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestExecuteSchedule() {
+    const uint32 numberOfChannels = 2u;
+    float64 breakpoints[] = { 0.0, 1.0, 3.0 };
+    float64 kpArray[] = { 1.0, 2.0, 4.0 };
+    Vector<float64> breakpointsVector(breakpoints, 3u);
+    Vector<float64> kpVector(kpArray, 3u);
+    PIDGAMTestHelper gam(1.0, 1.2, 1.3, 0.001, 0x1.FFFFFFFFFFFFFp1023, -0x1.FFFFFFFFFFFFFp1023, numberOfChannels);
+    bool ret = gam.config.CreateRelative("Schedule");
+    ret &= gam.config.Write("Breakpoints", breakpointsVector);
+    ret &= gam.config.Write("Kp", kpVector);
+    ret &= gam.config.MoveToRoot();
+    ret &= gam.config.Write("SampleTime", 0.001);
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetupSchedule();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+    if (ret) {
+        float64 *gamMemoryInR = static_cast<float64 *>(gam.GetInputSignalsMemory(0u));
+        float64 *gamMemoryInM = static_cast<float64 *>(gam.GetInputSignalsMemory(1u));
+        float64 *gamMemoryInS = static_cast<float64 *>(gam.GetInputSignalsMemory(2u));
+        float64 *gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory(0u));
+        //Crosses all the cells in both directions and goes out of the breakpoints
+        const float64 schedulingValues[] = { 0.0, 0.5, 1.0, 2.0, 5.0, 2.5, 2.5, -1.0, 0.25, 3.0 };
+        const uint32 numberOfCycles = sizeof(schedulingValues) / sizeof(float64);
+        float64 lastKp = 1.0;
+        float64 lastError[numberOfChannels];
+        float64 lastIntegral[numberOfChannels];
+        for (uint32 c = 0u; c < numberOfChannels; c++) {
+            lastError[c] = 0.0;
+            lastIntegral[c] = 0.0;
+        }
+        for (uint32 i = 0u; (i < numberOfCycles) && (ret); i++) {
+            float64 x = schedulingValues[i];
+            *gamMemoryInS = x;
+            for (uint32 c = 0u; c < numberOfChannels; c++) {
+                gamMemoryInR[c] = static_cast<float64>(c + 1u);
+                gamMemoryInM[c] = static_cast<float64>(i) * 0.1;
+            }
+            gam.Execute();
+            float64 expectedKp = (x < 1.0) ? (1.0 + x) : (2.0 + (x - 1.0));
+            expectedKp = (expectedKp > 1.0) ? (expectedKp) : (1.0);
+            expectedKp = (expectedKp < 4.0) ? (expectedKp) : (4.0);
+            for (uint32 c = 0u; (c < numberOfChannels) && (ret); c++) {
+                //Bumpless transfer: the integral absorbs the change of the proportional term at the last error
+                lastIntegral[c] = lastIntegral[c] + ((lastKp * lastError[c]) - (expectedKp * lastError[c]));
+                float64 error = gamMemoryInR[c] - gamMemoryInM[c];
+                float64 expected = (expectedKp * error) + lastIntegral[c];
+                lastError[c] = error;
+                float64 difference = gamMemoryOut[c] - expected;
+                ret = ((difference < 1e-12) && (difference > -1e-12));
+                if (!ret) {
+                    printf("output value = %.17lf. expectedValue = %.17lf. channel = %u. cycle = %u \n", gamMemoryOut[c], expected, c, i);
+                }
+            }
+            lastKp = expectedKp;
+        }
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestExecuteScheduleBumpless() {
+    float64 breakpoints[] = { 0.0, 1.0 };
+    float64 kpArray[] = { 1.0, 3.0 };
+    Vector<float64> breakpointsVector(breakpoints, 2u);
+    Vector<float64> kpVector(kpArray, 2u);
+    PIDGAMTestHelper gam;
+    bool ret = gam.config.CreateRelative("Schedule");
+    ret &= gam.config.Write("Breakpoints", breakpointsVector);
+    ret &= gam.config.Write("Kp", kpVector);
+    ret &= gam.config.Write("Ki", 100.0);
+    ret &= gam.config.MoveToRoot();
+    ret &= gam.config.Write("SampleTime", 0.001);
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetupSchedule();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+    if (ret) {
+        float64 *gamMemoryInR = static_cast<float64 *>(gam.GetInputSignalsMemory(0u));
+        float64 *gamMemoryInM = static_cast<float64 *>(gam.GetInputSignalsMemory(1u));
+        float64 *gamMemoryInS = static_cast<float64 *>(gam.GetInputSignalsMemory(2u));
+        float64 *gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory(0u));
+        *gamMemoryInR = 1.0;
+        *gamMemoryInM = 0.0;
+        float64 lastOutput = 0.0;
+        //With a constant error the output only grows with the integral (ki * sampleTime * error), also when kp changes from 1 to 3
+        for (uint32 i = 0u; (i < 10u) && (ret); i++) {
+            *gamMemoryInS = (i < 5u) ? (0.0) : (1.0);
+            gam.Execute();
+            if (i > 0u) {
+                float64 difference = (*gamMemoryOut - lastOutput) - 0.1;
+                ret = ((difference < 1e-9) && (difference > -1e-9));
+                if (!ret) {
+                    printf("output value = %.17lf. lastOutput = %.17lf. cycle = %u \n", *gamMemoryOut, lastOutput, i);
+                }
+            }
+            lastOutput = *gamMemoryOut;
+        }
+        //A change of the error is amplified by the new kp
+        if (ret) {
+            *gamMemoryInR = 2.0;
+            gam.Execute();
+            float64 difference = (*gamMemoryOut - lastOutput) - 3.2;
+            ret = ((difference < 1e-9) && (difference > -1e-9));
+            if (!ret) {
+                printf("output value = %.17lf. lastOutput = %.17lf \n", *gamMemoryOut, lastOutput);
+            }
+        }
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestExecuteScheduleFixedPoint() {
+    const int32 one = 65536;
+    float64 breakpoints[] = { 0.0, 1.0 };
+    float64 kpArray[] = { 0.5, 1.0 };
+    Vector<float64> breakpointsVector(breakpoints, 2u);
+    Vector<float64> kpVector(kpArray, 2u);
+    PIDGAMTestHelper gam;
+    bool ret = gam.config.CreateRelative("Schedule");
+    ret &= gam.config.Write("Breakpoints", breakpointsVector);
+    ret &= gam.config.Write("Kp", kpVector);
+    ret &= gam.config.MoveToRoot();
+    ret &= gam.config.Write("SampleTime", 0.001);
+    ret &= gam.config.Write("FractionalBits", 16u);
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetupSchedule("int32", sizeof(int32));
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+    if (ret) {
+        int32 *gamMemoryInR = static_cast<int32 *>(gam.GetInputSignalsMemory(0u));
+        int32 *gamMemoryInM = static_cast<int32 *>(gam.GetInputSignalsMemory(1u));
+        float64 *gamMemoryInS = static_cast<float64 *>(gam.GetInputSignalsMemory(2u));
+        int32 *gamMemoryOut = static_cast<int32 *>(gam.GetOutputSignalsMemory(0u));
+        *gamMemoryInM = 0;
+        //kp = 0.5 with e = 0.5. Then kp = 1.0 with the same error (bumpless). Then kp = 1.0 with e = 1.0
+        const int32 errors[] = { one / 2, one / 2, one };
+        const float64 schedulingValues[] = { 0.0, 1.0, 1.0 };
+        const int32 expected[] = { one / 4, one / 4, 3 * one / 4 };
+        for (uint32 i = 0u; (i < 3u) && (ret); i++) {
+            *gamMemoryInR = errors[i];
+            *gamMemoryInS = schedulingValues[i];
+            gam.Execute();
+            ret = (*gamMemoryOut == expected[i]);
+            if (!ret) {
+                printf("output value = %d. expectedValue = %d. cycle = %u \n", *gamMemoryOut, expected[i], i);
+            }
+        }
+    }
+    return ret;
+}
+}
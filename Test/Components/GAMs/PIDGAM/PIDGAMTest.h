@@ -345,6 +345,90 @@ public:
      */
     bool TestExecuteSaturationki3();
 
+    /**
+     * @brief Test error message of PIDGAM::Initialise() with parameter arrays of different sizes.
+     */
+    bool TestInitialiseWrongParameterArrays();
+
+    /**
+     * @brief Test error message of PIDGAM::Initialise() with a channel where maxOutput < minOutput.
+     */
+    bool TestInitialiseWrongParameterArraysSaturation();
+
+    /**
+     * @brief Test error message of PIDGAM::Setup() when the parameter arrays and the signals have a different number of elements.
+     */
+    bool TestSetupWrongNumberOfChannels();
+
+    /**
+     * @brief Test the PIDGAM::Execute() with several channels and scalar parameters.
+     */
+    bool TestExecuteMultiChannel();
+
+    /**
+     * @brief Test the PIDGAM::Execute() with several channels and per channel parameters (including saturation).
+     */
+    bool TestExecuteMultiChannelArrays();
+
+    /**
+     * @brief Test the PIDGAM::Initialise() with FractionalBits larger than 30.
+     */
+    bool TestInitialiseWrongFractionalBits();
+
+    /**
+     * @brief Test the PIDGAM::Setup() with a signal type which is not float64, float32 or int32.
+     */
+    bool TestSetupWrongSignalType();
+
+    /**
+     * @brief Test the PIDGAM::Setup() with a gain which cannot be represented in the int32 Q format.
+     */
+    bool TestSetupWrongFixedPointGains();
+
+    /**
+     * @brief Test the PIDGAM::Execute() with float32 signals.
+     */
+    bool TestExecuteFloat32();
+
+    /**
+     * @brief Test the PIDGAM::Execute() with int32 Q16 signals (including saturation).
+     */
+    bool TestExecuteFixedPoint();
+
+    /**
+     * @brief Test PIDGAM::Initialise() with a Schedule.
+     */
+    bool TestInitialiseSchedule();
+
+    /**
+     * @brief Test PIDGAM::Initialise() with Schedule Breakpoints which are not strictly increasing.
+     */
+    bool TestInitialiseScheduleWrongBreakpoints();
+
+    /**
+     * @brief Test PIDGAM::Initialise() with Schedule arrays which do not have one value for each breakpoint.
+     */
+    bool TestInitialiseScheduleWrongParameterArrays();
+
+    /**
+     * @brief Test PIDGAM::Setup() with a scheduling variable with more than one element.
+     */
+    bool TestSetupScheduleWrongSchedulingVariable();
+
+    /**
+     * @brief Test the PIDGAM::Execute() interpolation of the Schedule across the cells and outside of the breakpoints.
+     */
+    bool TestExecuteSchedule();
+
+    /**
+     * @brief Test that the PIDGAM::Execute() output does not jump when the scheduled kp changes.
+     */
+    bool TestExecuteScheduleBumpless();
+
+    /**
+     * @brief Test the PIDGAM::Execute() Schedule (and the bumpless transfer) with int32 Q16 signals.
+     */
+    bool TestExecuteScheduleFixedPoint();
 
 };
 
@@ -0,0 +1,84 @@
+/**
+ * @file ParallelGAMGroupGTest.cpp
+ * @brief Source file for class ParallelGAMGroupGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ParallelGAMGroupGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ParallelGAMGroupTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(ParallelGAMGroupGTest,TestConstructor) {
+    ParallelGAMGroupTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(ParallelGAMGroupGTest,TestInitialise) {
+    ParallelGAMGroupTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(ParallelGAMGroupGTest,TestInitialise_False_Signals) {
+    ParallelGAMGroupTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Signals());
+}
+
+TEST(ParallelGAMGroupGTest,TestInitialise_False_NoChildren) {
+    ParallelGAMGroupTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NoChildren());
+}
+
+TEST(ParallelGAMGroupGTest,TestInitialise_False_NumberOfWorkers) {
+    ParallelGAMGroupTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NumberOfWorkers());
+}
+
+TEST(ParallelGAMGroupGTest,TestSetup) {
+    ParallelGAMGroupTest test;
+    ASSERT_TRUE(test.TestSetup());
+}
+
+TEST(ParallelGAMGroupGTest,TestSetup_False_CircularDependency) {
+    ParallelGAMGroupTest test;
+    ASSERT_TRUE(test.TestSetup_False_CircularDependency());
+}
+
+TEST(ParallelGAMGroupGTest,TestExecute) {
+    ParallelGAMGroupTest test;
+    ASSERT_TRUE(test.TestExecute());
+}
+
+TEST(ParallelGAMGroupGTest,TestExecute_Workers) {
+    ParallelGAMGroupTest test;
+    ASSERT_TRUE(test.TestExecute_Workers());
+}
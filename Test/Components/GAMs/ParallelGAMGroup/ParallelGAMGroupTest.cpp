@@ -0,0 +1,449 @@
+/**
+ * @file ParallelGAMGroupTest.cpp
+ * @brief Source file for class ParallelGAMGroupTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ParallelGAMGroupTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "DataSourceI.h"
+#include "GAMScheduler.h"
+#include "MemoryMapInputBroker.h"
+#include "MemoryMapOutputBroker.h"
+#include "ObjectRegistryDatabase.h"
+#include "ParallelGAMGroupTest.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * Gives access to the ParallelGAMGroup signals memory.
+ */
+class ParallelGAMGroupTestHelper: public MARTe::ParallelGAMGroup {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    ParallelGAMGroupTestHelper() :
+            MARTe::ParallelGAMGroup() {
+    }
+
+    virtual ~ParallelGAMGroupTestHelper() {
+    }
+
+    MARTe::float32 *GetInput(const MARTe::uint32 signalIdx) {
+        return static_cast<MARTe::float32 *>(GetInputSignalMemory(signalIdx));
+    }
+
+    MARTe::float32 *GetOutput(const MARTe::uint32 signalIdx) {
+        return static_cast<MARTe::float32 *>(GetOutputSignalMemory(signalIdx));
+    }
+};
+CLASS_REGISTER(ParallelGAMGroupTestHelper, "1.0")
+
+/**
+ * A DataSource which provides the input signals of the group.
+ */
+class ParallelGAMGroupTestDataSource: public MARTe::DataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    ParallelGAMGroupTestDataSource() :
+            MARTe::DataSourceI() {
+    }
+
+    virtual ~ParallelGAMGroupTestDataSource() {
+    }
+
+    virtual bool AllocateMemory() {
+        return true;
+    }
+
+    virtual MARTe::uint32 GetNumberOfMemoryBuffers() {
+        return 0u;
+    }
+
+    virtual bool GetSignalMemoryBuffer(const MARTe::uint32 signalIdx,
+                                       const MARTe::uint32 bufferIdx,
+                                       void *&signalAddress) {
+        return true;
+    }
+
+    virtual const MARTe::char8 *GetBrokerName(MARTe::StructuredDataI &data,
+                                              const MARTe::SignalDirection direction) {
+        if (direction == MARTe::InputSignals) {
+            return "MemoryMapInputBroker";
+        }
+        return "MemoryMapOutputBroker";
+    }
+
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName) {
+        return true;
+    }
+
+    virtual bool GetInputBrokers(MARTe::ReferenceContainer &inputBrokers,
+                                 const MARTe::char8 * const functionName,
+                                 void * const gamMemPtr) {
+        MARTe::ReferenceT<MARTe::MemoryMapInputBroker> broker("MemoryMapInputBroker");
+        bool ret = broker.IsValid();
+        if (ret) {
+            ret = inputBrokers.Insert(broker);
+        }
+        return ret;
+    }
+
+    virtual bool GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers,
+                                  const MARTe::char8 * const functionName,
+                                  void * const gamMemPtr) {
+        MARTe::ReferenceT<MARTe::MemoryMapOutputBroker> broker("MemoryMapOutputBroker");
+        bool ret = broker.IsValid();
+        if (ret) {
+            ret = outputBrokers.Insert(broker);
+        }
+        return ret;
+    }
+
+    virtual bool Synchronise() {
+        return true;
+    }
+};
+CLASS_REGISTER(ParallelGAMGroupTestDataSource, "1.0")
+
+/**
+ * A group with three IOGAMs: A and C read from Drv1, B reads the output of A (i.e. A and C in stage 0, B in stage 1).
+ * The NUMBER_OF_WORKERS, A_INPUT, A_DATASOURCE and B_INPUT placeholders are replaced by each test.
+ */
+static const MARTe::char8 * const configTemplate = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +Parallel = {"
+        "            Class = ParallelGAMGroupTestHelper"
+        "            NumberOfWorkers = NUMBER_OF_WORKERS"
+        "            +A = {"
+        "                Class = IOGAM"
+        "                InputSignals = {"
+        "                    A_INPUT = {"
+        "                        DataSource = A_DATASOURCE"
+        "                        Type = float32"
+        "                        NumberOfElements = 4"
+        "                    }"
+        "                }"
+        "                OutputSignals = {"
+        "                    Signal1A = {"
+        "                        DataSource = DDB1"
+        "                        Type = float32"
+        "                        NumberOfElements = 4"
+        "                    }"
+        "                }"
+        "            }"
+        "            +B = {"
+        "                Class = IOGAM"
+        "                InputSignals = {"
+        "                    B_INPUT = {"
+        "                        DataSource = DDB1"
+        "                        Type = float32"
+        "                        NumberOfElements = 4"
+        "                    }"
+        "                }"
+        "                OutputSignals = {"
+        "                    Signal1B = {"
+        "                        DataSource = DDB1"
+        "                        Type = float32"
+        "                        NumberOfElements = 4"
+        "                    }"
+        "                }"
+        "            }"
+        "            +C = {"
+        "                Class = IOGAM"
+        "                InputSignals = {"
+        "                    Signal2 = {"
+        "                        DataSource = Drv1"
+        "                        Type = float32"
+        "                        NumberOfElements = 4"
+        "                    }"
+        "                }"
+        "                OutputSignals = {"
+        "                    Signal2C = {"
+        "                        DataSource = DDB1"
+        "                        Type = float32"
+        "                        NumberOfElements = 4"
+        "                    }"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +Drv1 = {"
+        "            Class = ParallelGAMGroupTestDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {Parallel}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * Configures the application of configTemplate. The application is left in the ObjectRegistryDatabase.
+ */
+static bool ConfigureApplication(const MARTe::char8 * const numberOfWorkers,
+                                 const MARTe::char8 * const aInput,
+                                 const MARTe::char8 * const aDataSource,
+                                 const MARTe::char8 * const bInput) {
+    using namespace MARTe;
+    StreamString config = configTemplate;
+    StreamString configStream;
+    (void) config.Seek(0LLU);
+    StreamString token;
+    char8 terminator;
+    //Replace the placeholders
+    while (config.GetToken(token, " ", terminator)) {
+        if (token == "NUMBER_OF_WORKERS") {
+            token = numberOfWorkers;
+        }
+        else if (token == "A_INPUT") {
+            token = aInput;
+        }
+        else if (token == "A_DATASOURCE") {
+            token = aDataSource;
+        }
+        else if (token == "B_INPUT") {
+            token = bInput;
+        }
+        (void) configStream.Printf("%s ", token.Buffer());
+        token = "";
+    }
+    (void) configStream.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * Executes the group of the configured application and checks that the outputs are copies of the inputs.
+ */
+static bool ExecuteApplication() {
+    using namespace MARTe;
+    ReferenceT<ParallelGAMGroupTestHelper> gam = ObjectRegistryDatabase::Instance()->Find("Test.Functions.Parallel");
+    bool ok = gam.IsValid();
+    //Inputs: A_Signal1, C_Signal2. Outputs: A_Signal1A, B_Signal1B, C_Signal2C.
+    for (uint32 cycle = 0u; (cycle < 10u) && (ok); cycle++) {
+        float32 *signal1 = gam->GetInput(0u);
+        float32 *signal2 = gam->GetInput(1u);
+        uint32 n;
+        for (n = 0u; n < 4u; n++) {
+            signal1[n] = static_cast<float32>(cycle + n);
+            signal2[n] = static_cast<float32>(100u + cycle + n);
+        }
+        ok = gam->Execute();
+        float32 *signal1A = gam->GetOutput(0u);
+        float32 *signal1B = gam->GetOutput(1u);
+        float32 *signal2C = gam->GetOutput(2u);
+        for (n = 0u; (n < 4u) && (ok); n++) {
+            ok = (signal1A[n] == signal1[n]);
+            if (ok) {
+                ok = (signal1B[n] == signal1[n]);
+            }
+            if (ok) {
+                ok = (signal2C[n] == signal2[n]);
+            }
+        }
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool ParallelGAMGroupTest::TestConstructor() {
+    ParallelGAMGroup gam;
+    bool ok = (gam.GetNumberOfChildren() == 0u);
+    if (ok) {
+        ok = (gam.GetNumberOfStages() == 0u);
+    }
+    if (ok) {
+        ok = (gam.GetNumberOfWorkers() == 0u);
+    }
+    return ok;
+}
+
+bool ParallelGAMGroupTest::TestInitialise() {
+    ParallelGAMGroup gam;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfWorkers", 2);
+    cdb.CreateAbsolute("+A");
+    cdb.Write("Class", "IOGAM");
+    cdb.CreateAbsolute("+A.InputSignals.In");
+    cdb.Write("Type", "uint32");
+    cdb.CreateAbsolute("+A.OutputSignals.Out");
+    cdb.Write("Type", "uint32");
+    cdb.CreateAbsolute("+B");
+    cdb.Write("Class", "IOGAM");
+    cdb.CreateAbsolute("+B.InputSignals.Out");
+    cdb.Write("Type", "uint32");
+    cdb.CreateAbsolute("+B.OutputSignals.Out2");
+    cdb.Write("Type", "uint32");
+    cdb.MoveToRoot();
+    bool ok = gam.Initialise(cdb);
+    if (ok) {
+        ok = (gam.GetNumberOfChildren() == 2u);
+    }
+    if (ok) {
+        ok = (gam.GetNumberOfWorkers() == 2u);
+    }
+    return ok;
+}
+
+bool ParallelGAMGroupTest::TestInitialise_False_Signals() {
+    ParallelGAMGroup gam;
+    ConfigurationDatabase cdb;
+    cdb.CreateAbsolute("InputSignals.In");
+    cdb.Write("Type", "uint32");
+    cdb.CreateAbsolute("+A");
+    cdb.Write("Class", "IOGAM");
+    cdb.CreateAbsolute("+A.InputSignals.In");
+    cdb.Write("Type", "uint32");
+    cdb.CreateAbsolute("+A.OutputSignals.Out");
+    cdb.Write("Type", "uint32");
+    cdb.MoveToRoot();
+    return !gam.Initialise(cdb);
+}
+
+bool ParallelGAMGroupTest::TestInitialise_False_NoChildren() {
+    ParallelGAMGroup gam;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfWorkers", 2);
+    return !gam.Initialise(cdb);
+}
+
+bool ParallelGAMGroupTest::TestInitialise_False_NumberOfWorkers() {
+    ParallelGAMGroup gam;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfWorkers", 65);
+    cdb.CreateAbsolute("+A");
+    cdb.Write("Class", "IOGAM");
+    cdb.CreateAbsolute("+A.InputSignals.In");
+    cdb.Write("Type", "uint32");
+    cdb.CreateAbsolute("+A.OutputSignals.Out");
+    cdb.Write("Type", "uint32");
+    cdb.MoveToRoot();
+    return !gam.Initialise(cdb);
+}
+
+bool ParallelGAMGroupTest::TestSetup() {
+    bool ok = ConfigureApplication("0", "Signal1", "Drv1", "Signal1A");
+    ReferenceT<ParallelGAMGroup> gam;
+    if (ok) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Test.Functions.Parallel");
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        //B_Signal1A is internal
+        ok = (gam->GetNumberOfInputSignals() == 2u);
+    }
+    if (ok) {
+        ok = (gam->GetNumberOfOutputSignals() == 3u);
+    }
+    if (ok) {
+        ok = (gam->GetNumberOfStages() == 2u);
+    }
+    if (ok) {
+        ok = (gam->GetChildStage(0u) == 0u);
+    }
+    if (ok) {
+        ok = (gam->GetChildStage(1u) == 1u);
+    }
+    if (ok) {
+        ok = (gam->GetChildStage(2u) == 0u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool ParallelGAMGroupTest::TestSetup_False_CircularDependency() {
+    //A reads the output of B and B reads the output of A
+    bool ok = !ConfigureApplication("0", "Signal1B", "DDB1", "Signal1A");
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool ParallelGAMGroupTest::TestExecute() {
+    bool ok = ConfigureApplication("0", "Signal1", "Drv1", "Signal1A");
+    if (ok) {
+        ok = ExecuteApplication();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool ParallelGAMGroupTest::TestExecute_Workers() {
+    bool ok = ConfigureApplication("2", "Signal1", "Drv1", "Signal1A");
+    if (ok) {
+        ok = ExecuteApplication();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
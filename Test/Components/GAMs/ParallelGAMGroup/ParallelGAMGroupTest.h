@@ -0,0 +1,97 @@
+/**
+ * @file ParallelGAMGroupTest.h
+ * @brief Header file for class ParallelGAMGroupTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ParallelGAMGroupTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PARALLELGAMGROUPTEST_H_
+#define PARALLELGAMGROUPTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ParallelGAMGroup.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the ParallelGAMGroup methods
+ */
+class ParallelGAMGroupTest {
+public:
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails if the group declares signals
+     */
+    bool TestInitialise_False_Signals();
+
+    /**
+     * @brief Tests that the Initialise method fails without children
+     */
+    bool TestInitialise_False_NoChildren();
+
+    /**
+     * @brief Tests that the Initialise method fails with NumberOfWorkers > 64
+     */
+    bool TestInitialise_False_NumberOfWorkers();
+
+    /**
+     * @brief Tests the Setup method in an application and that the children are sorted in stages
+     */
+    bool TestSetup();
+
+    /**
+     * @brief Tests that the Setup method fails if the children have circular dependencies
+     */
+    bool TestSetup_False_CircularDependency();
+
+    /**
+     * @brief Tests the Execute method without worker threads
+     */
+    bool TestExecute();
+
+    /**
+     * @brief Tests the Execute method with worker threads
+     */
+    bool TestExecute_Workers();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PARALLELGAMGROUPTEST_H_ */
@@ -219,6 +219,81 @@ TEST(SSMGAMGTest, TestExecuteSpringNoFeedthroughMatrix) {
     ASSERT_TRUE(test.TestExecuteSpringNoFeedthroughMatrix());
 }
 
+TEST(SSMGAMGTest, TestExecuteDiagonal1) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteDiagonal(1));
+}
+
+TEST(SSMGAMGTest, TestExecuteDiagonal3) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteDiagonal(3));
+}
+
+TEST(SSMGAMGTest, TestExecuteDiagonal16) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteDiagonal(16));
+}
+
+TEST(SSMGAMGTest, TestExecuteDiagonal17) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteDiagonal(17));
+}
+
+TEST(SSMGAMGTest, TestExecuteNoSetup) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteNoSetup());
+}
+
+TEST(SSMGAMGTest, TestExecuteMatrixFormatDense) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMatrixFormat(20u, "Dense", SSMGAMMatrixFormatDense));
+}
+
+TEST(SSMGAMGTest, TestExecuteMatrixFormatSparse) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMatrixFormat(20u, "Sparse", SSMGAMMatrixFormatSparse));
+}
+
+TEST(SSMGAMGTest, TestExecuteMatrixFormatBlockDiagonal) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMatrixFormat(20u, "BlockDiagonal", SSMGAMMatrixFormatBlockDiagonal));
+}
+
+TEST(SSMGAMGTest, TestExecuteMatrixFormatAuto) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMatrixFormat(20u, "Auto", SSMGAMMatrixFormatBlockDiagonal));
+}
+
+TEST(SSMGAMGTest, TestExecuteMatrixFormatAutoSmall) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMatrixFormat(8u, "Auto", SSMGAMMatrixFormatDense));
+}
+
+TEST(SSMGAMGTest, TestExecuteMatrixFormatDefault) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMatrixFormat(20u, NULL_PTR(const char8 *), SSMGAMMatrixFormatBlockDiagonal));
+}
+
+TEST(SSMGAMGTest, TestExecuteMatrixFormatCoupledSparse) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMatrixFormatCoupled("Sparse"));
+}
+
+TEST(SSMGAMGTest, TestExecuteMatrixFormatCoupledBlockDiagonal) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMatrixFormatCoupled("BlockDiagonal"));
+}
+
+TEST(SSMGAMGTest, TestExecuteMatrixFormatCoupledAuto) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMatrixFormatCoupled("Auto"));
+}
+
+TEST(SSMGAMGTest, TestInitialiseWrongMatrixFormat) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongMatrixFormat());
+}
+
 TEST(SSMGAMGTest, TestPrepareNextStateReset) {
     SSMGAMTest test;
     ASSERT_TRUE(test.TestPrepareNextStateReset(1));
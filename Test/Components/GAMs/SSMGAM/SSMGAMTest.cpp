@@ -352,6 +352,90 @@ SSMGAMTestHelper    () {
         ok &= configSignals.MoveToRoot();
         return ok;
     }
+    bool InitialiseConfigDiagonal(const uint32 numberOfStates,
+                                  const char8 * const matrixFormat = NULL_PTR(const char8 *),
+                                  const float64 coupling = 0.0) {
+        bool ok = true;
+        //numberOfStates independent states x[k+1] = 0.5 x[k] + u[k] and y[k] = sum(x[k]).
+        //If coupling != 0 the states are coupled in pairs with A_i = {{0.5 coupling}{-coupling 0.5}}.
+        float64 *stateMatrix = new float64[numberOfStates * numberOfStates];
+        float64 *inputMatrix = new float64[numberOfStates];
+        float64 *outputMatrix = new float64[numberOfStates];
+        for (uint32 i = 0u; i < numberOfStates; i++) {
+            for (uint32 j = 0u; j < numberOfStates; j++) {
+                stateMatrix[(i * numberOfStates) + j] = (i == j) ? 0.5 : 0.0;
+            }
+            if ((i % 2u) == 1u) {
+                stateMatrix[((i - 1u) * numberOfStates) + i] = coupling;
+                stateMatrix[(i * numberOfStates) + (i - 1u)] = -coupling;
+            }
+            inputMatrix[i] = (coupling == 0.0) ? 1.0 : static_cast<float64>((i % 3u) + 1u);
+            outputMatrix[i] = 1.0;
+        }
+        Matrix<float64> matrix(stateMatrix, numberOfStates, numberOfStates);
+        ok &= config.Write("StateMatrix", matrix);
+        Matrix<float64> matrix2(inputMatrix, numberOfStates, 1u);
+        ok &= config.Write("InputMatrix", matrix2);
+        Matrix<float64> matrix3(outputMatrix, 1u, numberOfStates);
+        ok &= config.Write("OutputMatrix", matrix3);
+        ok &= config.Write("ResetInEachState", 1);
+        if (matrixFormat != NULL_PTR(const char8 *)) {
+            ok &= config.Write("MatrixFormat", matrixFormat);
+        }
+        delete[] stateMatrix;
+        delete[] inputMatrix;
+        delete[] outputMatrix;
+        return ok;
+    }
+    bool InitialiseConfigSignalsDiagonal(const uint32 numberOfStates) {
+        bool ok = true;
+        ok &= configSignals.CreateAbsolute("Signals.InputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("Type", "float64");
+        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfDimensions", 1);
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.Write("ByteSize", 8);
+        ok &= configSignals.MoveToAncestor(1u);
+        ok &= configSignals.Write("ByteSize", 8);
+
+        //The output vector and the state vector.
+        ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
+        for (uint32 i = 0u; (i < (numberOfStates + 1u)) && ok; i++) {
+            StreamString signalIdx;
+            ok &= signalIdx.Printf("%u", i);
+            ok &= configSignals.CreateRelative(signalIdx.Buffer());
+            ok &= configSignals.Write("Type", "float64");
+            ok &= configSignals.Write("NumberOfElements", 1);
+            ok &= configSignals.Write("NumberOfDimensions", 0);
+            ok &= configSignals.Write("DataSource", "DataSourceOutputVector");
+            ok &= configSignals.Write("ByteSize", 8);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+        ok &= configSignals.Write("ByteSize", 8u * (numberOfStates + 1u));
+
+        ok &= configSignals.CreateAbsolute("Memory.InputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.CreateRelative("Signals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("Samples", 1);
+
+        ok &= configSignals.CreateAbsolute("Memory.OutputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "DataSourceOutputVector");
+        ok &= configSignals.CreateRelative("Signals");
+        for (uint32 i = 0u; (i < (numberOfStates + 1u)) && ok; i++) {
+            StreamString signalIdx;
+            ok &= signalIdx.Printf("%u", i);
+            ok &= configSignals.CreateRelative(signalIdx.Buffer());
+            ok &= configSignals.Write("Samples", 1);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+
+        ok &= configSignals.MoveToRoot();
+        return ok;
+    }
     bool IsEqualLargerMargins(const float64 f1, const float64 f2) {
         float64 *min=reinterpret_cast<float64*>(const_cast<uint64*>(&EPSILON_FLOAT64));
         float64 minLarger = 2 * *min;
@@ -2011,5 +2095,169 @@ bool SSMGAMTest::TestPrepareNextStateNoMemoryAllocated(uint32 resetEachStateConf
     return ok;
 }
 
+bool SSMGAMTest::TestExecuteDiagonal(uint32 numberOfStates) {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    //n = numberOfStates, p = 1 and q = 1
+    ok &= gam.InitialiseConfigDiagonal(numberOfStates);
+    if (ok) {
+        ok &= gam.Initialise(gam.config);
+    }
+    if (ok) {
+        ok &= gam.InitialiseConfigSignalsDiagonal(numberOfStates);
+    }
+    if (ok) {
+        ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    }
+    if (ok) {
+        ok &= gam.AllocateInputSignalsMemory();
+        ok &= gam.AllocateOutputSignalsMemory();
+    }
+    if (ok) {
+        ok &= gam.Setup();
+    }
+    float64 *gamMemoryIn = NULL_PTR(float64 *);
+    float64 *gamMemoryOutVector = NULL_PTR(float64 *);
+    if (ok) {
+        gamMemoryIn = static_cast<float64 *>(gam.GetInputSignalsMemory());
+        gamMemoryOutVector = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+        gamMemoryIn[0] = 1.0;
+    }
+    //x[0] = 0, x[1] = 1, x[2] = 1.5
+    float64 expectedState[] = { 0.0, 1.0, 1.5 };
+    for (uint32 k = 0u; (k < 3u) && ok; k++) {
+        ok &= gam.Execute();
+        for (uint32 i = 0u; (i < numberOfStates) && ok; i++) {
+            float64 *gamMemoryOutState = static_cast<float64 *>(gam.GetOutputSignalsMemory(i + 1u));
+            ok &= gam.IsEqualLargerMargins(*gamMemoryOutState, expectedState[k]);
+        }
+        if (ok) {
+            ok &= gam.IsEqualLargerMargins(*gamMemoryOutVector, static_cast<float64>(numberOfStates) * expectedState[k]);
+            if (!ok) {
+                printf("*gamMemoryOutVector = %.16lf\n", *gamMemoryOutVector);
+            }
+        }
+    }
+    return ok;
 }
 
+bool SSMGAMTest::TestExecuteMatrixFormat(uint32 numberOfStates,
+                                         const char8 * const matrixFormat,
+                                         SSMGAMMatrixFormat expectedMatrixFormat) {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    ok &= gam.InitialiseConfigDiagonal(numberOfStates, matrixFormat);
+    if (ok) {
+        ok &= gam.Initialise(gam.config);
+    }
+    if (ok) {
+        ok &= gam.InitialiseConfigSignalsDiagonal(numberOfStates);
+    }
+    if (ok) {
+        ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    }
+    if (ok) {
+        ok &= gam.AllocateInputSignalsMemory();
+        ok &= gam.AllocateOutputSignalsMemory();
+    }
+    if (ok) {
+        ok &= gam.Setup();
+    }
+    if (ok) {
+        ok &= (gam.GetMatrixFormat() == expectedMatrixFormat);
+    }
+    float64 *gamMemoryIn = NULL_PTR(float64 *);
+    float64 *gamMemoryOutVector = NULL_PTR(float64 *);
+    if (ok) {
+        gamMemoryIn = static_cast<float64 *>(gam.GetInputSignalsMemory());
+        gamMemoryOutVector = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+        gamMemoryIn[0] = 1.0;
+    }
+    //x[0] = 0, x[1] = 1, x[2] = 1.5
+    float64 expectedState[] = { 0.0, 1.0, 1.5 };
+    for (uint32 k = 0u; (k < 3u) && ok; k++) {
+        ok &= gam.Execute();
+        for (uint32 i = 0u; (i < numberOfStates) && ok; i++) {
+            float64 *gamMemoryOutState = static_cast<float64 *>(gam.GetOutputSignalsMemory(i + 1u));
+            ok &= gam.IsEqualLargerMargins(*gamMemoryOutState, expectedState[k]);
+        }
+        if (ok) {
+            ok &= gam.IsEqualLargerMargins(*gamMemoryOutVector, static_cast<float64>(numberOfStates) * expectedState[k]);
+        }
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestExecuteMatrixFormatCoupled(const char8 * const matrixFormat) {
+    const uint32 numberOfStates = 20u;
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    SSMGAMTestHelper gamDense;
+    ok &= gam.InitialiseConfigDiagonal(numberOfStates, matrixFormat, 0.25);
+    ok &= gamDense.InitialiseConfigDiagonal(numberOfStates, "Dense", 0.25);
+    if (ok) {
+        ok &= gam.Initialise(gam.config);
+        ok &= gamDense.Initialise(gamDense.config);
+    }
+    if (ok) {
+        ok &= gam.InitialiseConfigSignalsDiagonal(numberOfStates);
+        ok &= gamDense.InitialiseConfigSignalsDiagonal(numberOfStates);
+    }
+    if (ok) {
+        ok &= gam.SetConfiguredDatabase(gam.configSignals);
+        ok &= gamDense.SetConfiguredDatabase(gamDense.configSignals);
+    }
+    if (ok) {
+        ok &= gam.AllocateInputSignalsMemory();
+        ok &= gam.AllocateOutputSignalsMemory();
+        ok &= gamDense.AllocateInputSignalsMemory();
+        ok &= gamDense.AllocateOutputSignalsMemory();
+    }
+    if (ok) {
+        ok &= gam.Setup();
+        ok &= gamDense.Setup();
+    }
+    float64 *gamMemoryIn = NULL_PTR(float64 *);
+    float64 *gamDenseMemoryIn = NULL_PTR(float64 *);
+    if (ok) {
+        gamMemoryIn = static_cast<float64 *>(gam.GetInputSignalsMemory());
+        gamDenseMemoryIn = static_cast<float64 *>(gamDense.GetInputSignalsMemory());
+    }
+    for (uint32 k = 0u; (k < 10u) && ok; k++) {
+        *gamMemoryIn = static_cast<float64>(k % 4u) - 1.0;
+        *gamDenseMemoryIn = *gamMemoryIn;
+        ok &= gam.Execute();
+        ok &= gamDense.Execute();
+        for (uint32 i = 0u; (i < (numberOfStates + 1u)) && ok; i++) {
+            float64 *gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory(i));
+            float64 *gamDenseMemoryOut = static_cast<float64 *>(gamDense.GetOutputSignalsMemory(i));
+            ok &= gam.IsEqualLargerMargins(*gamMemoryOut, *gamDenseMemoryOut);
+        }
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestInitialiseWrongMatrixFormat() {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    ok &= gam.InitialiseConfigDiagonal(4u, "Banded");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestExecuteNoSetup() {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    ok &= gam.InitialiseConfigSpring();
+    if (ok) {
+        ok &= gam.Initialise(gam.config);
+    }
+    if (ok) {
+        ok = !gam.Execute();
+    }
+    return ok;
+}
+
+}
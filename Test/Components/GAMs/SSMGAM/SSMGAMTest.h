@@ -258,6 +258,41 @@ public:
      */
     bool TestExecuteSpringNoFeedthroughMatrix();
 
+    /**
+     * @brief Test SSM::Execute().
+     * @details The system has numberOfStates independent states with A = 0.5 I, B[nx1] = 1, C[1xn] = 1 and no D.
+     * The input is a step. Covers the fixed-size (2 to 16 states) and the generic implementation.
+     * @return true if the output and the states are as expected.
+     */
+    bool TestExecuteDiagonal(uint32 numberOfStates);
+
+    /**
+     * @brief Test SSM::Execute() with the configured MatrixFormat.
+     * @details Same system of TestExecuteDiagonal(). Checks also that SSMGAM::GetMatrixFormat() returns expectedMatrixFormat after Setup().
+     * @return true if the output, the states and the selected format are as expected.
+     */
+    bool TestExecuteMatrixFormat(uint32 numberOfStates,
+                                 const char8 * const matrixFormat,
+                                 SSMGAMMatrixFormat expectedMatrixFormat);
+
+    /**
+     * @brief Test SSM::Execute() with the configured MatrixFormat on 20 states coupled in 2x2 blocks.
+     * @return true if the output and the states are equal to the ones computed with the Dense MatrixFormat.
+     */
+    bool TestExecuteMatrixFormatCoupled(const char8 * const matrixFormat);
+
+    /**
+     * @brief Test SSM::Initialise() with an invalid MatrixFormat.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseWrongMatrixFormat();
+
+    /**
+     * @brief Test SSM::Execute() without calling SSM::Setup().
+     * @return true if Execute() fails.
+     */
+    bool TestExecuteNoSetup();
+
     /**
      * @brief Test the reset function
      */
@@ -72,6 +72,21 @@ TEST(SimulinkWrapperGAMGTest, TestInitialise_Failed_WrongNonVirtualBusMode) {
     ASSERT_TRUE(test.TestInitialise_Failed_WrongNonVirtualBusMode());
 }
 
+TEST(SimulinkWrapperGAMGTest, TestInitialise_Failed_ZeroCopyRootIOMissingSetRootIOFunction) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_Failed_ZeroCopyRootIOMissingSetRootIOFunction());
+}
+
+TEST(SimulinkWrapperGAMGTest, TestInitialise_Failed_ZeroNumberOfInstances) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_Failed_ZeroNumberOfInstances());
+}
+
+TEST(SimulinkWrapperGAMGTest, TestInitialise_Failed_NumberOfInstancesWithZeroCopyRootIO) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_Failed_NumberOfInstancesWithZeroCopyRootIO());
+}
+
 TEST(SimulinkWrapperGAMGTest, TestInitialise_Failed_LoadLibrary) {
     SimulinkWrapperGAMTest test;
     ASSERT_TRUE(test.TestInitialise_Failed_LoadLibrary());
@@ -173,6 +188,16 @@ TEST(SimulinkWrapperGAMGTest, TestSetup_Failed_WrongOutputName) {
     ASSERT_TRUE(test.TestSetup_Failed_WrongOutputName());
 }
 
+TEST(SimulinkWrapperGAMGTest, TestSetup_MultipleInstances) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.TestSetup_MultipleInstances());
+}
+
+TEST(SimulinkWrapperGAMGTest, TestSetup_Failed_MultipleInstancesMissingPrefix) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.TestSetup_Failed_MultipleInstancesMissingPrefix());
+}
+
 TEST(SimulinkWrapperGAMGTest, TestSetup_Failed_WrongNumberOfElements) {
     SimulinkWrapperGAMTest test;
     ASSERT_TRUE(test.TestSetup_Failed_WrongNumberOfElements());
@@ -267,11 +292,21 @@ TEST(SimulinkWrapperGAMGTest, TestParameterActualisation_Float) {
     ASSERT_TRUE(test.TestParameterActualisation_Float());
 }
 
+TEST(SimulinkWrapperGAMGTest, TestStageParameters) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.TestStageParameters());
+}
+
 TEST(SimulinkWrapperGAMGTest, TestExecute) {
     SimulinkWrapperGAMTest test;
     ASSERT_TRUE(test.TestExecute());
 }
 
+TEST(SimulinkWrapperGAMGTest, TestNameIndex) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.TestNameIndex());
+}
+
 TEST(SimulinkWrapperGAMGTest, TestPrintAlgoInfo) {
     SimulinkWrapperGAMTest test;
     ASSERT_TRUE(test.TestPrintAlgoInfo());
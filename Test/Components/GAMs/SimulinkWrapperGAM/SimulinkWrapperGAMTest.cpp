@@ -536,6 +536,73 @@ bool SimulinkWrapperGAMTest::TestInitialise_Failed_WrongNonVirtualBusMode() {
     
 }
 
+bool SimulinkWrapperGAMTest::TestInitialise_Failed_ZeroCopyRootIOMissingSetRootIOFunction() {
+    
+    MARTe::StreamString modelName, modelFolder, modelFullPath;
+    
+    modelFolder = testEnvironment.modelFolder;
+    modelName   = testEnvironment.CreateTestModel("createTestModel();");
+    
+    modelFullPath  = modelFolder;
+    modelFullPath += "/";
+    modelFullPath += modelName;
+    modelFullPath += ".so";
+    
+    MARTe::ConfigurationDatabase config;
+    
+    config.Write("Library",        modelFullPath);
+    config.Write("SymbolPrefix",   modelName);
+    config.Write("ZeroCopyRootIO", 1u);
+    
+    return !TestInitialiseWithConfiguration(config);
+    
+}
+
+
+bool SimulinkWrapperGAMTest::TestInitialise_Failed_ZeroNumberOfInstances() {
+    
+    MARTe::StreamString modelName, modelFolder, modelFullPath;
+    
+    modelFolder = testEnvironment.modelFolder;
+    modelName   = testEnvironment.CreateTestModel("createTestModel();");
+    
+    modelFullPath  = modelFolder;
+    modelFullPath += "/";
+    modelFullPath += modelName;
+    modelFullPath += ".so";
+    
+    MARTe::ConfigurationDatabase config;
+    
+    config.Write("Library",           modelFullPath);
+    config.Write("SymbolPrefix",      modelName);
+    config.Write("NumberOfInstances", 0u);
+    
+    return !TestInitialiseWithConfiguration(config);
+    
+}
+
+bool SimulinkWrapperGAMTest::TestInitialise_Failed_NumberOfInstancesWithZeroCopyRootIO() {
+    
+    MARTe::StreamString modelName, modelFolder, modelFullPath;
+    
+    modelFolder = testEnvironment.modelFolder;
+    modelName   = testEnvironment.CreateTestModel("createTestModel();");
+    
+    modelFullPath  = modelFolder;
+    modelFullPath += "/";
+    modelFullPath += modelName;
+    modelFullPath += ".so";
+    
+    MARTe::ConfigurationDatabase config;
+    
+    config.Write("Library",           modelFullPath);
+    config.Write("SymbolPrefix",      modelName);
+    config.Write("ZeroCopyRootIO",    1u);
+    config.Write("NumberOfInstances", 2u);
+    
+    return !TestInitialiseWithConfiguration(config);
+    
+}
 
 bool SimulinkWrapperGAMTest::TestInitialise_MissingTunableParamExternalSource() {
     
@@ -1690,6 +1757,176 @@ bool SimulinkWrapperGAMTest::TestSetup_Failed_WrongOutputName() {
     return !ok;
 }
 
+bool SimulinkWrapperGAMTest::TestSetup_MultipleInstances() {
+    
+    StreamString scriptCall = "createTestModel();";
+    
+    StreamString skipUnlinkedParams = "1";
+    
+    // The instance settings are written in the GAM node together with the signals
+    StreamString inputSignals = ""
+        "NumberOfInstances = 2"
+        "NumberOfWorkers = 1"
+        "InputSignals = { "
+        "Instance0_In1_ScalarDouble  = {"
+        "    DataSource = Drv1"
+        "    Type = float64"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Instance0_In2_ScalarUint32  = {"
+        "    DataSource = Drv1"
+        "    Type = uint32"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Instance1_In1_ScalarDouble  = {"
+        "    DataSource = Drv1"
+        "    Type = float64"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Instance1_In2_ScalarUint32  = {"
+        "    DataSource = Drv1"
+        "    Type = uint32"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "}";
+    
+    StreamString outputSignals = ""
+        "OutputSignals = { "
+        "Instance0_Out1_ScalarDouble = {"
+        "    DataSource = DDB1"
+        "    Type = float64"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Instance0_Out2_ScalarUint32  = {"
+        "    DataSource = DDB1"
+        "    Type = uint32"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Instance1_Out1_ScalarDouble = {"
+        "    DataSource = DDB1"
+        "    Type = float64"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Instance1_Out2_ScalarUint32  = {"
+        "    DataSource = DDB1"
+        "    Type = uint32"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "}";
+    
+    StreamString parameters = "";
+    
+    ObjectRegistryDatabase* ord = ObjectRegistryDatabase::Instance();
+    
+    bool ok = TestSetupWithTemplate(scriptCall, skipUnlinkedParams, inputSignals, outputSignals, parameters, ord);
+    
+    if (ok) {
+        ReferenceT<SimulinkWrapperGAMHelper> gam = ord->Find("Test.Functions.GAM1");
+        ok = gam.IsValid();
+        if (ok) {
+            ok = (gam->GetNumberOfInstances() == 2u);
+        }
+        // The ports of the second instance (from 4) are mapped to the Instance1_ signals
+        if (ok) {
+            ok = (gam->GetPort(4u)->address != gam->GetPort(0u)->address);
+        }
+        if (ok) {
+            ok = (gam->GetPort(4u)->MARTeAddress == gam->GetInputSignalMemoryTest(2u));
+        }
+        if (ok) {
+            ok = (gam->GetPort(6u)->MARTeAddress == gam->GetOutputSignalMemoryTest(2u));
+        }
+        for (uint32 cycle = 0u; (cycle < 10u) && ok; cycle++) {
+            ok = gam->Execute();
+        }
+    }
+    
+    ord->Purge();
+    
+    return ok;
+}
+
+bool SimulinkWrapperGAMTest::TestSetup_Failed_MultipleInstancesMissingPrefix() {
+    
+    StreamString scriptCall = "createTestModel();";
+    
+    StreamString skipUnlinkedParams = "1";
+    
+    // The instance settings are written in the GAM node together with the signals
+    StreamString inputSignals = ""
+        "NumberOfInstances = 2"
+        "NumberOfWorkers = 1"
+        "InputSignals = { "
+        "Instance0_In1_ScalarDouble  = {"
+        "    DataSource = Drv1"
+        "    Type = float64"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Instance0_In2_ScalarUint32  = {"
+        "    DataSource = Drv1"
+        "    Type = uint32"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Instance1_In1_ScalarDouble  = {"
+        "    DataSource = Drv1"
+        "    Type = float64"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "In2_ScalarUint32  = {"
+        "    DataSource = Drv1"
+        "    Type = uint32"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "}";
+    
+    StreamString outputSignals = ""
+        "OutputSignals = { "
+        "Instance0_Out1_ScalarDouble = {"
+        "    DataSource = DDB1"
+        "    Type = float64"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Instance0_Out2_ScalarUint32  = {"
+        "    DataSource = DDB1"
+        "    Type = uint32"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Instance1_Out1_ScalarDouble = {"
+        "    DataSource = DDB1"
+        "    Type = float64"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Instance1_Out2_ScalarUint32  = {"
+        "    DataSource = DDB1"
+        "    Type = uint32"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "}";
+    
+    StreamString parameters = "";
+    
+    // Test setup
+    bool ok = TestSetupWithTemplate(scriptCall, skipUnlinkedParams, inputSignals, outputSignals, parameters);
+    
+    return !ok;
+}
+
 bool SimulinkWrapperGAMTest::TestSetup_Failed_WrongDatatype() {
     
     StreamString scriptCall = "createTestModel();";
@@ -3014,6 +3251,137 @@ bool SimulinkWrapperGAMTest::TestParameterActualisation_Float() {
     return ok;
 }
 
+bool SimulinkWrapperGAMTest::TestStageParameters() {
+    
+    StreamString scriptCall = "createTestModel('modelComplexity', 3, 'useType', 4, 'hasInputs', false, 'hasTunableParams', true, 'hasStructParams', true);";
+    
+    StreamString skipUnlinkedParams = "0";
+    
+    StreamString inputSignals = "";
+
+    StreamString outputSignals = ""
+        "OutputSignals = { "
+        "Out1_ScalarDouble = {"
+        "    DataSource = DDB1"
+        "    Type = float64"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Out2_ScalarUint32  = {"
+        "    DataSource = DDB1"
+        "    Type = uint32"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Out3_VectorDouble = {"
+        "    DataSource = DDB1"
+        "    Type = float64"
+        "    NumberOfElements = 8"
+        "    NumberOfDimensions = 1"
+        "}"
+        "Out4_VectorUint32  = {"
+        "    DataSource = DDB1"
+        "    Type = uint32"
+        "    NumberOfElements = 8"
+        "    NumberOfDimensions = 1"
+        "}"
+        "Out5_MatrixDouble = {"
+        "    DataSource = DDB1"
+        "    Type = int32"
+        "    NumberOfElements = 36"
+        "    NumberOfDimensions = 2"
+        "}"
+        "Out6_MatrixUint32  = {"
+        "    DataSource = DDB1"
+        "    Type = float32"
+        "    NumberOfElements = 36"
+        "    NumberOfDimensions = 2"
+        "}"
+        "}";
+
+    StreamString parameters = ""
+        "matrixConstant = (float64) { {10, 10, 10}, {11, 11, 11}, {12, 12, 12} }"
+        "vectorConstant = (uint32) { 0, 1, 2, 3, 4, 5, 6, 7, 8, 10 }"
+        "structScalar-one         = (float64) 3.141592653 "
+        "structScalar-nested1-one = (float64) 2.718281828 "
+        "structScalar-nested1-two = (float64) 2.718281828 "
+        "structScalar-nested2-one = (float64) 1.414213562 "
+        "structScalar-nested2-two = (float64) 1.414213562 "
+        "vectorConstant2 = (float64) { 0, 1, 2, 3, 4, 5, 6, 7 }"
+        "matrixConstant2 = (int32) { {10, 10, 10, 10, 10, 10},"
+        "                              {11, 11, 11, 11, 11, 11},"
+        "                              {11, 11, 11, 11, 11, 11},"
+        "                              {11, 11, 11, 11, 11, 11},"
+        "                              {11, 11, 11, 11, 11, 11},"
+        "                              {12, 12, 12, 12, 12, 12}}"
+        "structMixed-one = (float64) 10 "
+        "structMixed-vec = (float64) { 0, 1, 2, 3, 4, 5, 6, 7 }"
+        "structMixed-mat = (float32)  { {10, 10, 10, 10, 10, 10},"
+        "                              {11, 11, 11, 11, 11, 11},"
+        "                              {11, 11, 11, 11, 11, 11},"
+        "                              {11, 11, 11, 11, 11, 11},"
+        "                              {11, 11, 11, 11, 11, 11},"
+        "                              {12, 12, 12, 12, 12, 12}}"
+        ;
+    
+    // Test setup
+    ObjectRegistryDatabase* ord = ObjectRegistryDatabase::Instance();
+    
+    bool ok = TestSetupWithTemplate(scriptCall, skipUnlinkedParams, inputSignals, outputSignals, parameters, ord);
+    
+    ReferenceT<SimulinkWrapperGAMHelper> gam;
+    ReferenceT<AnyObject> sourceParameter;
+    if (ok) {
+        gam = ord->Find("Test.Functions.GAM1");
+        sourceParameter = ord->Find("CfgParameterContainer.vectorConstant2");
+        ok = (gam.IsValid() && sourceParameter.IsValid());
+    }
+    
+    float64* modelValues = NULL_PTR(float64*);
+    for (uint32 paramIdx = 0u; ok && (paramIdx < gam->GetNumOfPars()); paramIdx++) {
+        if (gam->GetParameter(paramIdx)->fullName == "vectorConstant2") {
+            modelValues = static_cast<float64*>(gam->GetParameter(paramIdx)->address);
+        }
+    }
+    if (ok) {
+        ok = (modelValues != NULL_PTR(float64*));
+    }
+    
+    // Change the source of the parameter and stage it
+    if (ok) {
+        float64* sourceValues = static_cast<float64*>(sourceParameter->GetType().GetDataPointer());
+        for (uint32 i = 0u; i < 8u; i++) {
+            sourceValues[i] = 100.0 + static_cast<float64>(i);
+        }
+        ok = gam->StageParameters().ErrorsCleared();
+    }
+    
+    // The model still uses the previous set and a second set cannot be staged until it is applied
+    if (ok) {
+        ok = (modelValues[1] == 1.0);
+    }
+    if (ok) {
+        ok = !gam->StageParameters().ErrorsCleared();
+    }
+    
+    // The new set is applied at the beginning of the next step
+    if (ok) {
+        ok = gam->Execute();
+    }
+    for (uint32 i = 0u; (i < 8u) && ok; i++) {
+        ok = (modelValues[i] == (100.0 + static_cast<float64>(i)));
+    }
+    if (ok) {
+        ok = gam->StageParameters().ErrorsCleared();
+    }
+    
+    if (ok) {
+        ord->Purge();
+    }
+    
+    return ok;
+}
+
 bool SimulinkWrapperGAMTest::TestExecute() {
     
     StreamString scriptCall = " createTestModel('modelComplexity', 4, 'hasTunableParams', true);";
@@ -3324,6 +3692,58 @@ bool SimulinkWrapperGAMTest::TestExecute() {
     return ok;
 }
 
+bool SimulinkWrapperGAMTest::TestNameIndex() {
+    
+    SimulinkNameIndex index;
+    uint32 value = 0u;
+    
+    // Empty index
+    bool ok = !index.Find("one", value);
+    
+    // Enough names to grow the table several times
+    for (uint32 nameIdx = 0u; (nameIdx < 5000u) && ok; nameIdx++) {
+        StreamString name;
+        ok = name.Printf("structParam-nested%u-one", nameIdx);
+        if (ok) {
+            ok = index.Set(name.Buffer(), nameIdx);
+        }
+    }
+    if (ok) {
+        ok = (index.GetSize() == 5000u);
+    }
+    for (uint32 nameIdx = 0u; (nameIdx < 5000u) && ok; nameIdx++) {
+        StreamString name;
+        ok = name.Printf("structParam-nested%u-one", nameIdx);
+        if (ok) {
+            ok = index.Find(name.Buffer(), value);
+        }
+        if (ok) {
+            ok = (value == nameIdx);
+        }
+    }
+    if (ok) {
+        ok = !index.Find("structParam-nested5000-one", value);
+    }
+    
+    // The last value wins
+    if (ok) {
+        ok = index.Set("structParam-nested10-one", 1u);
+    }
+    if (ok) {
+        ok = index.Find("structParam-nested10-one", value);
+    }
+    if (ok) {
+        ok = (value == 1u) && (index.GetSize() == 5000u);
+    }
+    
+    if (ok) {
+        index.Reset();
+        ok = (index.GetSize() == 0u) && (!index.Find("structParam-nested10-one", value));
+    }
+    
+    return ok;
+}
+
 bool SimulinkWrapperGAMTest::TestPrintAlgoInfo() {
     
     bool ok = true;
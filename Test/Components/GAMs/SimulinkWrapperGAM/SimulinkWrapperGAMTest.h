@@ -145,6 +145,23 @@ public:
      */
     bool TestInitialise_Failed_WrongNonVirtualBusMode();
     
+    /**
+     * @brief Tests the Initialise() method if ZeroCopyRootIO is set
+     *        and the library has no custom SetRootIO function.
+     */
+    bool TestInitialise_Failed_ZeroCopyRootIOMissingSetRootIOFunction();
+    
+    /**
+     * @brief Tests the Initialise() method if NumberOfInstances is 0.
+     */
+    bool TestInitialise_Failed_ZeroNumberOfInstances();
+    
+    /**
+     * @brief Tests the Initialise() method if NumberOfInstances > 1
+     *        and ZeroCopyRootIO is set.
+     */
+    bool TestInitialise_Failed_NumberOfInstancesWithZeroCopyRootIO();
+    
     /**
      * @brief Tests the Initialise() method if the external .so cannot be loaded.
      */
@@ -252,6 +269,18 @@ public:
      */
     bool TestSetup_Failed_WrongOutputName();
     
+    /**
+     * @brief Tests the Setup() and Execute() methods with two instances
+     *        of the model stepped by the real-time thread and a worker.
+     */
+    bool TestSetup_MultipleInstances();
+    
+    /**
+     * @brief Tests the Setup() method with two instances of the model
+     *        when a signal has no instance prefix.
+     */
+    bool TestSetup_Failed_MultipleInstancesMissingPrefix();
+    
     /**
      * @brief Tests the Setup() method  when a signal number of elements
      *        does not match.
@@ -348,11 +377,22 @@ public:
      */
     bool TestParameterActualisation_Float();
     
+    /**
+     * @brief Tests the StageParameters() method.
+     */
+    bool TestStageParameters();
+    
     /**
      * @brief Tests the PrintAlgoInfo() method.
      */
     bool TestPrintAlgoInfo();
     
+    /**
+     * @brief Tests the SimulinkNameIndex used to match the model names
+     *        with the configuration.
+     */
+    bool TestNameIndex();
+    
     /**
      * @brief Test the behaviour when working in pure structured signal mode
      */
@@ -0,0 +1,119 @@
+/**
+ * @file SpectrumGAMGTest.cpp
+ * @brief Source file for class SpectrumGAMGTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SpectrumGAMGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "SpectrumGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(SpectrumGAMGTest,TestConstructor) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(SpectrumGAMGTest,TestInitialise) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(SpectrumGAMGTest,TestInitialise_FalseNoFFTSize) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseNoFFTSize());
+}
+
+TEST(SpectrumGAMGTest,TestInitialise_FalseFFTSizeNotPowerOf2) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseFFTSizeNotPowerOf2());
+}
+
+TEST(SpectrumGAMGTest,TestInitialise_FalseBadWindow) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadWindow());
+}
+
+TEST(SpectrumGAMGTest,TestInitialise_FalseBadOutput) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadOutput());
+}
+
+TEST(SpectrumGAMGTest,TestInitialise_FalseNoBands) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseNoBands());
+}
+
+TEST(SpectrumGAMGTest,TestInitialise_FalseBadBand) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadBand());
+}
+
+TEST(SpectrumGAMGTest,TestSetup) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestSetup());
+}
+
+TEST(SpectrumGAMGTest,TestSetup_FalseNumberOfOutputSignals) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseNumberOfOutputSignals());
+}
+
+TEST(SpectrumGAMGTest,TestSetup_FalseBadHopSize) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadHopSize());
+}
+
+TEST(SpectrumGAMGTest,TestSetup_FalseBadOutputNElements) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadOutputNElements());
+}
+
+TEST(SpectrumGAMGTest,TestSetup_FalseBadOutputType) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadOutputType());
+}
+
+TEST(SpectrumGAMGTest,TestExecute_Magnitude) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Magnitude());
+}
+
+TEST(SpectrumGAMGTest,TestExecute_MagnitudePhase) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestExecute_MagnitudePhase());
+}
+
+TEST(SpectrumGAMGTest,TestExecute_BandPowerOverlap) {
+    SpectrumGAMTest test;
+    ASSERT_TRUE(test.TestExecute_BandPowerOverlap());
+}
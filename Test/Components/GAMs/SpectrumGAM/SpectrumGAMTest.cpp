@@ -0,0 +1,568 @@
+/**
+ * @file SpectrumGAMTest.cpp
+ * @brief Source file for class SpectrumGAMTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SpectrumGAMTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "FastMath.h"
+#include "MemoryDataSourceI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "SpectrumGAMTest.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class SpectrumGAMTestGAM: public SpectrumGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    void *GetInputSignalMemory(const uint32 signalIdx);
+
+    void *GetOutputSignalMemory(const uint32 signalIdx);
+};
+
+void *SpectrumGAMTestGAM::GetInputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetInputSignalMemory(signalIdx);
+}
+
+void *SpectrumGAMTestGAM::GetOutputSignalMemory(const uint32 signalIdx) {
+    return GAM::GetOutputSignalMemory(signalIdx);
+}
+
+CLASS_REGISTER(SpectrumGAMTestGAM, "1.0")
+
+class SpectrumGAMTestDS: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+            const char8 * const nextStateName);
+
+    virtual bool Synchronise();
+
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+};
+CLASS_REGISTER(SpectrumGAMTestDS, "1.0")
+
+bool SpectrumGAMTestDS::PrepareNextState(const char8 * const currentStateName,
+        const char8 * const nextStateName) {
+    return true;
+}
+
+bool SpectrumGAMTestDS::Synchronise() {
+    return true;
+}
+
+const char8 *SpectrumGAMTestDS::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    return "MemoryMapInputBroker";
+}
+
+/**
+ * @brief Configures an application with a single SpectrumGAMTestGAM (GAMA) with the parameters and signals in gamConfig.
+ * The input signals shall use the Drv1 DataSource and the output signals the DDB DataSource.
+ */
+static bool InitialiseSpectrumApplication(const char8 * const gamConfig) {
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = SpectrumGAMTestGAM";
+    config += gamConfig;
+    config += ""
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = SpectrumGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    config.Seek(0);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT < RealTimeApplication > application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * @brief Calls the SpectrumGAM::Initialise with the parameters in config.
+ */
+static bool InitialiseSpectrumGAM(const char8 * const config) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        SpectrumGAMTestGAM gam;
+        cdb.MoveToRoot();
+        ok = gam.Initialise(cdb);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+SpectrumGAMTest::SpectrumGAMTest() {
+}
+
+SpectrumGAMTest::~SpectrumGAMTest() {
+}
+
+bool SpectrumGAMTest::TestConstructor() {
+    SpectrumGAMTestGAM gam;
+    bool ret = (gam.GetFFTSize() == 0u);
+    ret &= (gam.GetHopSize() == 0u);
+    ret &= (gam.GetNumberOfSpectra() == 0u);
+    ret &= (gam.GetWindow() == NULL);
+    return ret;
+}
+
+bool SpectrumGAMTest::TestInitialise() {
+    const char8 * const config = ""
+            "FFTSize = 16\n"
+            "HopSize = 4\n"
+            "Window = Hann\n";
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ret = parser.Parse();
+    SpectrumGAMTestGAM gam;
+    if (ret) {
+        cdb.MoveToRoot();
+        ret = gam.Initialise(cdb);
+    }
+    if (ret) {
+        ret = (gam.GetFFTSize() == 16u);
+        ret &= (gam.GetHopSize() == 4u);
+        ret &= (gam.GetWindow() != NULL);
+    }
+    if (ret) {
+        const float64 *window = gam.GetWindow();
+        ret = (fabs(window[0]) < 1e-12);
+        ret &= (fabs(window[4] - 0.5) < 1e-12);
+        ret &= (fabs(window[8] - 1.0) < 1e-12);
+        ret &= (fabs(window[12] - 0.5) < 1e-12);
+    }
+    return ret;
+}
+
+bool SpectrumGAMTest::TestInitialise_FalseNoFFTSize() {
+    return !InitialiseSpectrumGAM("Window = Hann\n");
+}
+
+bool SpectrumGAMTest::TestInitialise_FalseFFTSizeNotPowerOf2() {
+    bool ret = !InitialiseSpectrumGAM("FFTSize = 48\n");
+    if (ret) {
+        ret = !InitialiseSpectrumGAM("FFTSize = 2\n");
+    }
+    return ret;
+}
+
+bool SpectrumGAMTest::TestInitialise_FalseBadWindow() {
+    return !InitialiseSpectrumGAM("FFTSize = 16\n"
+                                  "Window = Triangular\n");
+}
+
+bool SpectrumGAMTest::TestInitialise_FalseBadOutput() {
+    return !InitialiseSpectrumGAM("FFTSize = 16\n"
+                                  "Output = Phase\n");
+}
+
+bool SpectrumGAMTest::TestInitialise_FalseNoBands() {
+    return !InitialiseSpectrumGAM("FFTSize = 16\n"
+                                  "Output = BandPower\n"
+                                  "BandFirstBin = {0 2}\n");
+}
+
+bool SpectrumGAMTest::TestInitialise_FalseBadBand() {
+    bool ret = !InitialiseSpectrumGAM("FFTSize = 16\n"
+                                      "Output = BandPower\n"
+                                      "BandFirstBin = {0 2}\n"
+                                      "BandLastBin = {1 9}\n");
+    if (ret) {
+        ret = !InitialiseSpectrumGAM("FFTSize = 16\n"
+                                     "Output = BandPower\n"
+                                     "BandFirstBin = {0 5}\n"
+                                     "BandLastBin = {1 4}\n");
+    }
+    return ret;
+}
+
+bool SpectrumGAMTest::TestSetup() {
+    const char8 * const gamConfig = ""
+            "            FFTSize = 64"
+            "            HopSize = 16"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = int16"
+            "                    NumberOfElements = 32"
+            "                }"
+            "                X1 = {"
+            "                    DataSource = Drv1"
+            "                    Type = int16"
+            "                    NumberOfElements = 32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                M0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 66"
+            "                }"
+            "                M1 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 66"
+            "                }"
+            "            }";
+    bool ret = InitialiseSpectrumApplication(gamConfig);
+    ReferenceT<SpectrumGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        ret = (gam->GetFFTSize() == 64u);
+        ret &= (gam->GetHopSize() == 16u);
+        ret &= (gam->GetNumberOfSpectra() == 2u);
+        ret &= (gam->GetNumberOfBins() == 33u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool SpectrumGAMTest::TestSetup_FalseNumberOfOutputSignals() {
+    const char8 * const gamConfig = ""
+            "            FFTSize = 32"
+            "            Output = MagnitudePhase"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                    NumberOfElements = 32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                M0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 17"
+            "                }"
+            "            }";
+    bool ret = !InitialiseSpectrumApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool SpectrumGAMTest::TestSetup_FalseBadHopSize() {
+    const char8 * const gamConfig = ""
+            "            FFTSize = 32"
+            "            HopSize = 12"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                    NumberOfElements = 32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                M0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 17"
+            "                }"
+            "            }";
+    bool ret = !InitialiseSpectrumApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool SpectrumGAMTest::TestSetup_FalseBadOutputNElements() {
+    const char8 * const gamConfig = ""
+            "            FFTSize = 32"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                    NumberOfElements = 32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                M0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 16"
+            "                }"
+            "            }";
+    bool ret = !InitialiseSpectrumApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool SpectrumGAMTest::TestSetup_FalseBadOutputType() {
+    const char8 * const gamConfig = ""
+            "            FFTSize = 32"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                    NumberOfElements = 32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                M0 = {"
+            "                    DataSource = DDB"
+            "                    Type = uint32"
+            "                    NumberOfElements = 17"
+            "                }"
+            "            }";
+    bool ret = !InitialiseSpectrumApplication(gamConfig);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool SpectrumGAMTest::TestExecute_Magnitude() {
+    const char8 * const gamConfig = ""
+            "            FFTSize = 64"
+            "            Window = Rectangular"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = float64"
+            "                    NumberOfElements = 64"
+            "                }"
+            "                X1 = {"
+            "                    DataSource = Drv1"
+            "                    Type = float64"
+            "                    NumberOfElements = 64"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                M0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float64"
+            "                    NumberOfElements = 33"
+            "                }"
+            "                M1 = {"
+            "                    DataSource = DDB"
+            "                    Type = float64"
+            "                    NumberOfElements = 33"
+            "                }"
+            "            }";
+    bool ret = InitialiseSpectrumApplication(gamConfig);
+    ReferenceT<SpectrumGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        float64 *x0 = static_cast<float64 *>(gam->GetInputSignalMemory(0u));
+        float64 *x1 = static_cast<float64 *>(gam->GetInputSignalMemory(1u));
+        for (uint32 n = 0u; n < 64u; n++) {
+            float64 phase = (2.0 * FastMath::PI * static_cast<float64>(n)) / 64.0;
+            x0[n] = 2.0 * cos(4.0 * phase);
+            x1[n] = (3.0 * sin(8.0 * phase)) + 1.0;
+        }
+        ret = gam->Execute();
+    }
+    if (ret) {
+        float64 *m0 = static_cast<float64 *>(gam->GetOutputSignalMemory(0u));
+        float64 *m1 = static_cast<float64 *>(gam->GetOutputSignalMemory(1u));
+        for (uint32 k = 0u; (k < 33u) && (ret); k++) {
+            float64 expected0 = (k == 4u) ? 2.0 : 0.0;
+            float64 expected1 = (k == 8u) ? 3.0 : ((k == 0u) ? 1.0 : 0.0);
+            ret = (fabs(m0[k] - expected0) < 1e-9);
+            if (ret) {
+                ret = (fabs(m1[k] - expected1) < 1e-9);
+            }
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool SpectrumGAMTest::TestExecute_MagnitudePhase() {
+    const char8 * const gamConfig = ""
+            "            FFTSize = 32"
+            "            Window = Hann"
+            "            Output = MagnitudePhase"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = float32"
+            "                    NumberOfElements = 32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                M0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 17"
+            "                }"
+            "                P0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfElements = 17"
+            "                }"
+            "            }";
+    bool ret = InitialiseSpectrumApplication(gamConfig);
+    ReferenceT<SpectrumGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        float32 *x0 = static_cast<float32 *>(gam->GetInputSignalMemory(0u));
+        for (uint32 n = 0u; n < 32u; n++) {
+            x0[n] = static_cast<float32>(cos((2.0 * FastMath::PI * 4.0 * static_cast<float64>(n)) / 32.0));
+        }
+        ret = gam->Execute();
+    }
+    if (ret) {
+        /* The Hann window spreads the sinusoid on the bins 3, 4 and 5 with magnitudes 0.5, 1 and 0.5 */
+        float32 *m0 = static_cast<float32 *>(gam->GetOutputSignalMemory(0u));
+        float32 *p0 = static_cast<float32 *>(gam->GetOutputSignalMemory(1u));
+        ret = (fabs(m0[4] - 1.0) < 1e-5);
+        ret &= (fabs(m0[3] - 0.5) < 1e-5);
+        ret &= (fabs(m0[5] - 0.5) < 1e-5);
+        ret &= (fabs(m0[10]) < 1e-5);
+        ret &= (fabs(p0[4]) < 1e-5);
+        ret &= (fabs(fabs(p0[3]) - FastMath::PI) < 1e-5);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool SpectrumGAMTest::TestExecute_BandPowerOverlap() {
+    const char8 * const gamConfig = ""
+            "            FFTSize = 32"
+            "            HopSize = 16"
+            "            Window = Rectangular"
+            "            Output = BandPower"
+            "            BandFirstBin = {0 1}"
+            "            BandLastBin = {0 16}"
+            "            InputSignals = {"
+            "                X0 = {"
+            "                    DataSource = Drv1"
+            "                    Type = int16"
+            "                    NumberOfElements = 32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                B0 = {"
+            "                    DataSource = DDB"
+            "                    Type = float64"
+            "                    NumberOfElements = 4"
+            "                }"
+            "            }";
+    bool ret = InitialiseSpectrumApplication(gamConfig);
+    ReferenceT<SpectrumGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    float64 *b0 = NULL_PTR(float64 *);
+    if (ret) {
+        int16 *x0 = static_cast<int16 *>(gam->GetInputSignalMemory(0u));
+        for (uint32 n = 0u; n < 32u; n++) {
+            x0[n] = 100;
+        }
+        b0 = static_cast<float64 *>(gam->GetOutputSignalMemory(0u));
+        ret = gam->Execute();
+    }
+    if (ret) {
+        /* The first spectrum has 16 zeros of the initial history and 16 samples of 100, i.e. a mean power of 5000, half of which is DC */
+        ret = (fabs(b0[0] - 2500.0) < 1e-6);
+        ret &= (fabs(b0[1] - 2500.0) < 1e-6);
+        ret &= (fabs(b0[2] - 10000.0) < 1e-6);
+        ret &= (fabs(b0[3]) < 1e-6);
+    }
+    if (ret) {
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (fabs(b0[0] - 10000.0) < 1e-6);
+        ret &= (fabs(b0[1]) < 1e-6);
+        ret &= (fabs(b0[2] - 10000.0) < 1e-6);
+        ret &= (fabs(b0[3]) < 1e-6);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
@@ -0,0 +1,142 @@
+/**
+ * @file SpectrumGAMTest.h
+ * @brief Header file for class SpectrumGAMTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SpectrumGAMTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SPECTRUMGAMTEST_H_
+#define SPECTRUMGAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SpectrumGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the SpectrumGAM methods
+ */
+class SpectrumGAMTest {
+public:
+
+    /**
+     * @brief Constructor
+     */
+    SpectrumGAMTest();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~SpectrumGAMTest();
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method and the computed Hann window
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails without FFTSize
+     */
+    bool TestInitialise_FalseNoFFTSize();
+
+    /**
+     * @brief Tests that the Initialise method fails if FFTSize is not a power of 2
+     */
+    bool TestInitialise_FalseFFTSizeNotPowerOf2();
+
+    /**
+     * @brief Tests that the Initialise method fails with an unknown Window
+     */
+    bool TestInitialise_FalseBadWindow();
+
+    /**
+     * @brief Tests that the Initialise method fails with an unknown Output
+     */
+    bool TestInitialise_FalseBadOutput();
+
+    /**
+     * @brief Tests that the Initialise method fails if Output = BandPower and the bands are not specified
+     */
+    bool TestInitialise_FalseNoBands();
+
+    /**
+     * @brief Tests that the Initialise method fails if a band is beyond FFTSize / 2
+     */
+    bool TestInitialise_FalseBadBand();
+
+    /**
+     * @brief Tests the Setup method
+     */
+    bool TestSetup();
+
+    /**
+     * @brief Tests that the Setup method fails with the wrong number of output signals
+     */
+    bool TestSetup_FalseNumberOfOutputSignals();
+
+    /**
+     * @brief Tests that the Setup method fails if HopSize does not divide the number of samples per cycle
+     */
+    bool TestSetup_FalseBadHopSize();
+
+    /**
+     * @brief Tests that the Setup method fails if the output signals do not have the expected number of elements
+     */
+    bool TestSetup_FalseBadOutputNElements();
+
+    /**
+     * @brief Tests that the Setup method fails with an unsupported output type
+     */
+    bool TestSetup_FalseBadOutputType();
+
+    /**
+     * @brief Tests the Execute method with two channels transformed as a pair
+     */
+    bool TestExecute_Magnitude();
+
+    /**
+     * @brief Tests the Execute method with Output = MagnitudePhase and a single channel
+     */
+    bool TestExecute_MagnitudePhase();
+
+    /**
+     * @brief Tests the Execute method with Output = BandPower and overlapping spectra (HopSize < FFTSize)
+     */
+    bool TestExecute_BandPowerOverlap();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SPECTRUMGAMTEST_H_ */
@@ -169,6 +169,56 @@ TEST(StatisticsGAMGTest,TestExecute_uint32_withAbsoluteMaxMin) {
     ASSERT_TRUE(test.TestExecute_uint32_withAbsoluteMaxMin());
 }
 
+TEST(StatisticsGAMGTest,TestExecute_MultipleSignals) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestExecute_MultipleSignals());
+}
+
+TEST(StatisticsGAMGTest,TestSetup_MultipleSignals_WrongNumberOfElements) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestSetup_MultipleSignals_WrongNumberOfElements());
+}
+
+TEST(StatisticsGAMGTest,TestSetup_MultipleSignals_DistinctTypes) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestSetup_MultipleSignals_DistinctTypes());
+}
+
+TEST(StatisticsGAMGTest,TestExecute_QuantilesCompensated) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestExecute_QuantilesCompensated());
+}
+
+TEST(StatisticsGAMGTest,TestSetup_Quantiles_WrongNumberOfOutputs) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestSetup_Quantiles_WrongNumberOfOutputs());
+}
+
+TEST(StatisticsGAMGTest,TestInitialise_WrongAccumulator) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_WrongAccumulator());
+}
+
+TEST(StatisticsGAMGTest,TestInitialise_WrongQuantiles) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_WrongQuantiles());
+}
+
+TEST(StatisticsGAMGTest,TestExecute_Windows) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Windows());
+}
+
+TEST(StatisticsGAMGTest,TestSetup_Windows_WrongNumberOfOutputs) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestSetup_Windows_WrongNumberOfOutputs());
+}
+
+TEST(StatisticsGAMGTest,TestInitialise_WrongWindows) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_WrongWindows());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -197,6 +197,7 @@ SinkGAM    ();
     virtual bool Setup();
     virtual bool Execute();
     template <typename Type> bool GetInput (uint32 index, Type& value);
+    template <typename Type> bool GetInputElement (uint32 index, uint32 elementIndex, Type& value);
 };
 
 SinkGAM::SinkGAM() :
@@ -257,6 +258,31 @@ template<typename Type> bool SinkGAM::GetInput(uint32 signalIndex, Type& value)
     return ret;
 }
 
+template<typename Type> bool SinkGAM::GetInputElement(uint32 signalIndex, uint32 elementIndex, Type& value) {
+
+    bool ret = (GetNumberOfInputSignals() > signalIndex);
+
+    if (!ret) {
+        REPORT_ERROR_PARAMETERS(ErrorManagement::InitialisationError, "GetNumberOfInputSignals() <= %u", signalIndex);
+    }
+
+    uint32 signalNumberOfElements = 0u;
+
+    if (ret) {
+        ret = GetSignalNumberOfElements(InputSignals, signalIndex, signalNumberOfElements);
+    }
+
+    if (ret) {
+        ret = (signalNumberOfElements > elementIndex);
+    }
+
+    if (ret) {
+        value = static_cast<Type *>(GetInputSignalMemory(signalIndex))[elementIndex];
+    }
+
+    return ret;
+}
+
 CLASS_REGISTER(SinkGAM, "1.0")
 
 }
@@ -1399,4 +1425,1017 @@ bool StatisticsGAMTest::TestExecute_uint32_withCycleCounter() {
 
 bool StatisticsGAMTest::TestExecute_uint32_withAbsoluteMaxMin() {
     return TestExecute_AnyType<MARTe::uint32>(324, 1, true);
+
+bool StatisticsGAMTest::TestExecute_MultipleSignals() {
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Constants = {"
+            "            Class = StatisticsGAMTestHelper_Constant"
+            "            OutputSignals = {"
+            "                Constant_a = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    Default = 1.5"
+            "                }"
+            "                Constant_b = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 3"
+            "                    Default = {-2.0 0.5 4.0}"
+            "                }"
+            "            }"
+            "        }"
+            "        +Statistics = {"
+            "            Class = StatisticsGAM"
+            "            WindowSize = 16"
+            "            InputSignals = {"
+            "               Constant_a = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "               Constant_b = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 3"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Average_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Stdev_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Min_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Max_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "            }"
+            "        }"
+            "        +Sink = {"
+            "            Class = SinkGAM"
+            "            InputSignals = {"
+            "               Average_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Stdev_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Min_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Max_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Constants Statistics Sink}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = StatisticsGAMTestHelper::ConfigureApplication(config);
+
+    if (ok) {
+        using namespace MARTe;
+
+        ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+        ReferenceT<RealTimeApplication> application = god->Find("Test");
+        ReferenceT<StatisticsGAM> gam = application->Find("Functions.Statistics");
+        ReferenceT<SinkGAM> sink = application->Find("Functions.Sink");
+
+        ok = (gam.IsValid() && sink.IsValid());
+
+        if (ok) {
+            ok = StatisticsGAMTestHelper::StartApplication();
+        }
+
+        if (ok) {
+            Sleep::Sec(1.0);
+        }
+
+        /* Channels are {Constant_a Constant_b[0] Constant_b[1] Constant_b[2]} */
+        float32 expected[] = { 1.5F, -2.0F, 0.5F, 4.0F };
+        uint32 channel;
+
+        for (channel = 0u; (channel < 4u) && (ok); channel++) {
+            float32 avg = 0.0F;
+            float32 std = 1.0F;
+            float32 min = 0.0F;
+            float32 max = 0.0F;
+
+            ok = sink->GetInputElement<float32>(0u, channel, avg);
+
+            if (ok) {
+                ok = sink->GetInputElement<float32>(1u, channel, std);
+            }
+
+            if (ok) {
+                ok = sink->GetInputElement<float32>(2u, channel, min);
+            }
+
+            if (ok) {
+                ok = sink->GetInputElement<float32>(3u, channel, max);
+            }
+
+            if (ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "Statistics[%u] - %! %! %! %!", channel, avg, std, min, max);
+                ok = ((avg == expected[channel]) && (std == 0.0F) && (min == expected[channel]) && (max == expected[channel]));
+            }
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::InternalSetupError, "Failure in ConfigureApplication");
+    }
+
+    if (ok) {
+        ok = StatisticsGAMTestHelper::StopApplication();
+    }
+
+    return ok;
+}
+
+bool StatisticsGAMTest::TestSetup_MultipleSignals_WrongNumberOfElements() {
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Constants = {"
+            "            Class = StatisticsGAMTestHelper_Constant"
+            "            OutputSignals = {"
+            "                Constant_a = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    Default = 1.5"
+            "                }"
+            "                Constant_b = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 3"
+            "                    Default = {-2.0 0.5 4.0}"
+            "                }"
+            "            }"
+            "        }"
+            "        +Statistics = {"
+            "            Class = StatisticsGAM"
+            "            WindowSize = 16"
+            "            InputSignals = {"
+            "               Constant_a = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "               Constant_b = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 3"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Average_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 3"
+            "               }"
+            "               Stdev_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 3"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Constants Statistics}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = StatisticsGAMTestHelper::ConfigureApplication(config);
+    return !ok; // Expect failure
+}
+
+bool StatisticsGAMTest::TestSetup_MultipleSignals_DistinctTypes() {
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Constants = {"
+            "            Class = StatisticsGAMTestHelper_Constant"
+            "            OutputSignals = {"
+            "                Constant_a = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    Default = 1.5"
+            "                }"
+            "                Constant_b = {"
+            "                    DataSource = DDB"
+            "                    Type = float64"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 3"
+            "                    Default = {-2.0 0.5 4.0}"
+            "                }"
+            "            }"
+            "        }"
+            "        +Statistics = {"
+            "            Class = StatisticsGAM"
+            "            WindowSize = 16"
+            "            InputSignals = {"
+            "               Constant_a = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "               Constant_b = {"
+            "                   DataSource = DDB"
+            "                   Type = float64"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 3"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Average_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Stdev_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Min_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Max_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Constants Statistics}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = StatisticsGAMTestHelper::ConfigureApplication(config);
+    return !ok; // Expect failure
+}
+
+bool StatisticsGAMTest::TestExecute_QuantilesCompensated() {
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Constants = {"
+            "            Class = StatisticsGAMTestHelper_Constant"
+            "            OutputSignals = {"
+            "                Constant_a = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    Default = 1.5"
+            "                }"
+            "                Constant_b = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 3"
+            "                    Default = {-2.0 0.5 4.0}"
+            "                }"
+            "            }"
+            "        }"
+            "        +Statistics = {"
+            "            Class = StatisticsGAM"
+            "            WindowSize = 16"
+            "            Accumulator = Compensated"
+            "            Quantiles = {0.5 0.99}"
+            "            InputSignals = {"
+            "               Constant_a = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "               Constant_b = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 3"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Average_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Stdev_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Min_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Max_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               P50_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               P99_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "            }"
+            "        }"
+            "        +Sink = {"
+            "            Class = SinkGAM"
+            "            InputSignals = {"
+            "               Average_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Stdev_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Min_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Max_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               P50_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               P99_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Constants Statistics Sink}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = StatisticsGAMTestHelper::ConfigureApplication(config);
+
+    if (ok) {
+        using namespace MARTe;
+
+        ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+        ReferenceT<RealTimeApplication> application = god->Find("Test");
+        ReferenceT<StatisticsGAM> gam = application->Find("Functions.Statistics");
+        ReferenceT<SinkGAM> sink = application->Find("Functions.Sink");
+
+        ok = (gam.IsValid() && sink.IsValid());
+
+        if (ok) {
+            ok = StatisticsGAMTestHelper::StartApplication();
+        }
+
+        if (ok) {
+            Sleep::Sec(1.0);
+        }
+
+        /* Channels are {Constant_a Constant_b[0] Constant_b[1] Constant_b[2]} */
+        float32 expected[] = { 1.5F, -2.0F, 0.5F, 4.0F };
+        uint32 channel;
+
+        for (channel = 0u; (channel < 4u) && (ok); channel++) {
+            float32 avg = 0.0F;
+            float32 std = 1.0F;
+            float32 p50 = 0.0F;
+            float32 p99 = 0.0F;
+
+            ok = sink->GetInputElement<float32>(0u, channel, avg);
+
+            if (ok) {
+                ok = sink->GetInputElement<float32>(1u, channel, std);
+            }
+
+            if (ok) {
+                ok = sink->GetInputElement<float32>(4u, channel, p50);
+            }
+
+            if (ok) {
+                ok = sink->GetInputElement<float32>(5u, channel, p99);
+            }
+
+            if (ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "Statistics[%u] - %! %! %! %!", channel, avg, std, p50, p99);
+                ok = ((avg == expected[channel]) && (std == 0.0F) && (p50 == expected[channel]) && (p99 == expected[channel]));
+            }
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::InternalSetupError, "Failure in ConfigureApplication");
+    }
+
+    if (ok) {
+        ok = StatisticsGAMTestHelper::StopApplication();
+    }
+
+    return ok;
+}
+
+bool StatisticsGAMTest::TestSetup_Quantiles_WrongNumberOfOutputs() {
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Constants = {"
+            "            Class = StatisticsGAMTestHelper_Constant"
+            "            OutputSignals = {"
+            "                Constant_a = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    Default = 1.5"
+            "                }"
+            "                Constant_b = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 3"
+            "                    Default = {-2.0 0.5 4.0}"
+            "                }"
+            "            }"
+            "        }"
+            "        +Statistics = {"
+            "            Class = StatisticsGAM"
+            "            WindowSize = 16"
+            "            Quantiles = {0.5 0.99}"
+            "            InputSignals = {"
+            "               Constant_a = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "               Constant_b = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 3"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Average_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Stdev_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Min_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Max_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               P50_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Constants Statistics}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = StatisticsGAMTestHelper::ConfigureApplication(config);
+    return !ok; // Expect failure
+}
+
+bool StatisticsGAMTest::TestInitialise_WrongAccumulator() {
+    using namespace MARTe;
+    StatisticsGAM gam;
+    ConfigurationDatabase config;
+
+    bool ok = config.Write("Accumulator", "Kahan");
+    if (ok) {
+        ok = !gam.Initialise(config);
+    }
+    return ok;
+}
+
+bool StatisticsGAMTest::TestExecute_Windows() {
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Constants = {"
+            "            Class = StatisticsGAMTestHelper_Constant"
+            "            OutputSignals = {"
+            "                Constant_a = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    Default = 1.5"
+            "                }"
+            "                Constant_b = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 3"
+            "                    Default = {-2.0 0.5 4.0}"
+            "                }"
+            "            }"
+            "        }"
+            "        +Statistics = {"
+            "            Class = StatisticsGAM"
+            "            DecimationRate = 4"
+            "            Windows = {4 16}"
+            "            InputSignals = {"
+            "               Constant_a = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "               Constant_b = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 3"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Average4_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Stdev4_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Average16_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Stdev16_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "            }"
+            "        }"
+            "        +Sink = {"
+            "            Class = SinkGAM"
+            "            InputSignals = {"
+            "               Average4_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Stdev4_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Average16_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Stdev16_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Constants Statistics Sink}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = StatisticsGAMTestHelper::ConfigureApplication(config);
+
+    if (ok) {
+        using namespace MARTe;
+
+        ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+        ReferenceT<RealTimeApplication> application = god->Find("Test");
+        ReferenceT<StatisticsGAM> gam = application->Find("Functions.Statistics");
+        ReferenceT<SinkGAM> sink = application->Find("Functions.Sink");
+
+        ok = (gam.IsValid() && sink.IsValid());
+
+        if (ok) {
+            ok = StatisticsGAMTestHelper::StartApplication();
+        }
+
+        if (ok) {
+            Sleep::Sec(1.0);
+        }
+
+        /* Channels are {Constant_a Constant_b[0] Constant_b[1] Constant_b[2]} */
+        float32 expected[] = { 1.5F, -2.0F, 0.5F, 4.0F };
+        uint32 channel;
+
+        for (channel = 0u; (channel < 4u) && (ok); channel++) {
+            /* {avg, std} of the window of 4 samples then of the window of 16 samples */
+            float32 statistics[] = { 0.0F, 1.0F, 0.0F, 1.0F };
+            uint32 signalIndex;
+
+            for (signalIndex = 0u; (signalIndex < 4u) && (ok); signalIndex++) {
+                ok = sink->GetInputElement<float32>(signalIndex, channel, statistics[signalIndex]);
+            }
+
+            if (ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "Statistics[%u] - %! %! %! %!", channel, statistics[0], statistics[1], statistics[2], statistics[3]);
+                ok = ((statistics[0] == expected[channel]) && (statistics[1] == 0.0F) && (statistics[2] == expected[channel]) && (statistics[3] == 0.0F));
+            }
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::InternalSetupError, "Failure in ConfigureApplication");
+    }
+
+    if (ok) {
+        ok = StatisticsGAMTestHelper::StopApplication();
+    }
+
+    return ok;
+}
+
+bool StatisticsGAMTest::TestSetup_Windows_WrongNumberOfOutputs() {
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Constants = {"
+            "            Class = StatisticsGAMTestHelper_Constant"
+            "            OutputSignals = {"
+            "                Constant_a = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    Default = 1.5"
+            "                }"
+            "                Constant_b = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 3"
+            "                    Default = {-2.0 0.5 4.0}"
+            "                }"
+            "            }"
+            "        }"
+            "        +Statistics = {"
+            "            Class = StatisticsGAM"
+            "            DecimationRate = 4"
+            "            Windows = {4 16}"
+            "            InputSignals = {"
+            "               Constant_a = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "               Constant_b = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 3"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Average_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Stdev_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Min_Channels = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Constants Statistics}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = StatisticsGAMTestHelper::ConfigureApplication(config);
+    return !ok; // Expect failure
+}
+
+bool StatisticsGAMTest::TestInitialise_WrongAccumulator() {
+    using namespace MARTe;
+    StatisticsGAM gam;
+    ConfigurationDatabase config;
+
+    bool ok = config.Write("Accumulator", "Kahan");
+    if (ok) {
+        ok = !gam.Initialise(config);
+    }
+    return ok;
+}
+
+bool StatisticsGAMTest::TestInitialise_WrongQuantiles() {
+    using namespace MARTe;
+    StatisticsGAM gam;
+    ConfigurationDatabase config;
+
+    float64 quantiles[] = { 0.5, 1.5 };
+    Vector<float64> quantilesVector(quantiles, 2u);
+    bool ok = config.Write("Quantiles", quantilesVector);
+    if (ok) {
+        ok = !gam.Initialise(config);
+    }
+    return ok;
+}
+
+bool StatisticsGAMTest::TestInitialise_WrongWindows() {
+    using namespace MARTe;
+    StatisticsGAM gam;
+    ConfigurationDatabase config;
+
+    /* 25 is not a multiple of the DecimationRate */
+    uint32 windows[] = { 10u, 25u };
+    Vector<uint32> windowsVector(windows, 2u);
+    bool ok = config.Write("Windows", windowsVector);
+    if (ok) {
+        ok = config.Write("DecimationRate", 10u);
+    }
+    if (ok) {
+        ok = !gam.Initialise(config);
+    }
+    return ok;
+}
 }
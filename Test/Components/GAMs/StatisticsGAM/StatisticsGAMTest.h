@@ -219,6 +219,66 @@ public:
      * @brief Tests the absolute Max/Min handling mode
      */
     bool TestExecute_uint32_withAbsoluteMaxMin();
+
+    /**
+     * @brief Tests the Execute method with a scalar and an array input signal.
+     * @return true if the computed statistics of the four channels are as expected.
+     */
+    bool TestExecute_MultipleSignals();
+
+    /**
+     * @brief Tests the Setup method with output signals which do not have one element per channel.
+     * @return true if Setup() fails.
+     */
+    bool TestSetup_MultipleSignals_WrongNumberOfElements();
+
+    /**
+     * @brief Tests the Setup method with input signals of different types.
+     * @return true if Setup() fails.
+     */
+    bool TestSetup_MultipleSignals_DistinctTypes();
+
+    /**
+     * @brief Tests the Execute method with the compensated accumulators and the p50 and p99 quantiles of four channels.
+     * @return true if the computed statistics of the four channels are as expected.
+     */
+    bool TestExecute_QuantilesCompensated();
+
+    /**
+     * @brief Tests the Setup method with less output signals than the configured quantiles.
+     * @return true if Setup() fails.
+     */
+    bool TestSetup_Quantiles_WrongNumberOfOutputs();
+
+    /**
+     * @brief Tests the Initialise method with an invalid Accumulator.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialise_WrongAccumulator();
+
+    /**
+     * @brief Tests the Initialise method with a quantile not in (0, 1).
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialise_WrongQuantiles();
+
+    /**
+     * @brief Tests the Execute method with two windows (average and standard deviation of each) of four channels, updated every 4 cycles.
+     * @return true if the computed statistics of the four channels are as expected.
+     */
+    bool TestExecute_Windows();
+
+    /**
+     * @brief Tests the Setup method with a number of output signals which is not a multiple of the number of windows.
+     * @return true if Setup() fails.
+     */
+    bool TestSetup_Windows_WrongNumberOfOutputs();
+
+    /**
+     * @brief Tests the Initialise method with a window which is not a multiple of the DecimationRate.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialise_WrongWindows();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -103,6 +103,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_uint8) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxSliding_uint8) {
+    StatisticsHelperTTest<uint8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxSliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMinSliding_uint8) {
+    StatisticsHelperTTest<uint8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMinSliding(32));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_uint8) {
     StatisticsHelperTTest<uint8> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -113,6 +123,16 @@ TEST(StatisticsHelperTGTest,TestGetStd_uint8) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetStdCompensated_uint8) {
+    StatisticsHelperTTest<uint8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensated());
+}
+
+TEST(StatisticsHelperTGTest,TestGetStdCompensatedOffset_uint8) {
+    StatisticsHelperTTest<uint8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensatedOffset(32));
+}
+
 /* uint16 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_uint16_32) {
@@ -175,6 +195,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_uint16) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxSliding_uint16) {
+    StatisticsHelperTTest<uint16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxSliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMinSliding_uint16) {
+    StatisticsHelperTTest<uint16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMinSliding(32));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_uint16) {
     StatisticsHelperTTest<uint16> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -185,6 +215,16 @@ TEST(StatisticsHelperTGTest,TestGetStd_uint16) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetStdCompensated_uint16) {
+    StatisticsHelperTTest<uint16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensated());
+}
+
+TEST(StatisticsHelperTGTest,TestGetStdCompensatedOffset_uint16) {
+    StatisticsHelperTTest<uint16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensatedOffset(32));
+}
+
 /* uint32 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_uint32_32) {
@@ -247,6 +287,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_uint32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxSliding_uint32) {
+    StatisticsHelperTTest<uint32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxSliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMinSliding_uint32) {
+    StatisticsHelperTTest<uint32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMinSliding(32));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_uint32) {
     StatisticsHelperTTest<uint32> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -257,6 +307,16 @@ TEST(StatisticsHelperTGTest,TestGetStd_uint32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetStdCompensated_uint32) {
+    StatisticsHelperTTest<uint32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensated());
+}
+
+TEST(StatisticsHelperTGTest,TestGetStdCompensatedOffset_uint32) {
+    StatisticsHelperTTest<uint32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensatedOffset(32));
+}
+
 /* uint64 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_uint64_32) {
@@ -319,6 +379,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_uint64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxSliding_uint64) {
+    StatisticsHelperTTest<uint64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxSliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMinSliding_uint64) {
+    StatisticsHelperTTest<uint64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMinSliding(32));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_uint64) {
     StatisticsHelperTTest<uint64> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -329,6 +399,16 @@ TEST(StatisticsHelperTGTest,TestGetStd_uint64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetStdCompensated_uint64) {
+    StatisticsHelperTTest<uint64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensated());
+}
+
+TEST(StatisticsHelperTGTest,TestGetStdCompensatedOffset_uint64) {
+    StatisticsHelperTTest<uint64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensatedOffset(32));
+}
+
 /* int8 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_int8_32) {
@@ -391,6 +471,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_int8) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxSliding_int8) {
+    StatisticsHelperTTest<int8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxSliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMinSliding_int8) {
+    StatisticsHelperTTest<int8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMinSliding(32));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_int8) {
     StatisticsHelperTTest<int8> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -401,6 +491,16 @@ TEST(StatisticsHelperTGTest,TestGetStd_int8) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetStdCompensated_int8) {
+    StatisticsHelperTTest<int8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensated());
+}
+
+TEST(StatisticsHelperTGTest,TestGetStdCompensatedOffset_int8) {
+    StatisticsHelperTTest<int8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensatedOffset(32));
+}
+
 /* int16 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_int16_32) {
@@ -463,6 +563,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_int16) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxSliding_int16) {
+    StatisticsHelperTTest<int16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxSliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMinSliding_int16) {
+    StatisticsHelperTTest<int16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMinSliding(32));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_int16) {
     StatisticsHelperTTest<int16> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -473,6 +583,16 @@ TEST(StatisticsHelperTGTest,TestGetStd_int16) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetStdCompensated_int16) {
+    StatisticsHelperTTest<int16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensated());
+}
+
+TEST(StatisticsHelperTGTest,TestGetStdCompensatedOffset_int16) {
+    StatisticsHelperTTest<int16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensatedOffset(32));
+}
+
 /* int32 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_int32_32) {
@@ -535,6 +655,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_int32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxSliding_int32) {
+    StatisticsHelperTTest<int32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxSliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMinSliding_int32) {
+    StatisticsHelperTTest<int32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMinSliding(32));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_int32) {
     StatisticsHelperTTest<int32> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -545,6 +675,16 @@ TEST(StatisticsHelperTGTest,TestGetStd_int32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetStdCompensated_int32) {
+    StatisticsHelperTTest<int32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensated());
+}
+
+TEST(StatisticsHelperTGTest,TestGetStdCompensatedOffset_int32) {
+    StatisticsHelperTTest<int32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensatedOffset(32));
+}
+
 /* int64 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_int64_32) {
@@ -607,6 +747,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_int64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxSliding_int64) {
+    StatisticsHelperTTest<int64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxSliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMinSliding_int64) {
+    StatisticsHelperTTest<int64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMinSliding(32));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_int64) {
     StatisticsHelperTTest<int64> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -617,6 +767,16 @@ TEST(StatisticsHelperTGTest,TestGetStd_int64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetStdCompensated_int64) {
+    StatisticsHelperTTest<int64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensated());
+}
+
+TEST(StatisticsHelperTGTest,TestGetStdCompensatedOffset_int64) {
+    StatisticsHelperTTest<int64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensatedOffset(32));
+}
+
 /* float32 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_float32_32) {
@@ -679,6 +839,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_float32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxSliding_float32) {
+    StatisticsHelperTTest<float32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxSliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMinSliding_float32) {
+    StatisticsHelperTTest<float32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMinSliding(32));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_float32) {
     StatisticsHelperTTest<float32> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -689,6 +859,16 @@ TEST(StatisticsHelperTGTest,TestGetStd_float32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetStdCompensated_float32) {
+    StatisticsHelperTTest<float32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensated());
+}
+
+TEST(StatisticsHelperTGTest,TestGetStdCompensatedOffset_float32) {
+    StatisticsHelperTTest<float32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensatedOffset(32));
+}
+
 /* float64 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_float64_32) {
@@ -751,6 +931,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_float64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxSliding_float64) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxSliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMinSliding_float64) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMinSliding(32));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_float64) {
     StatisticsHelperTTest<float64> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -761,3 +951,13 @@ TEST(StatisticsHelperTGTest,TestGetStd_float64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetStdCompensated_float64) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensated());
+}
+
+TEST(StatisticsHelperTGTest,TestGetStdCompensatedOffset_float64) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetStdCompensatedOffset(32));
+}
+
@@ -92,6 +92,18 @@ public:
      */
     bool TestGetMin(const uint32 windowSize);
 
+    /**
+     * @brief Tests the GetMax method while the samples leave the moving window.
+     * @details Compares the maximum against the maximum of the last windowSize samples after each PushSample.
+     */
+    bool TestGetMaxSliding(const uint32 windowSize);
+
+    /**
+     * @brief Tests the GetMin method while the samples leave the moving window.
+     * @details Compares the minimum against the minimum of the last windowSize samples after each PushSample.
+     */
+    bool TestGetMinSliding(const uint32 windowSize);
+
     /**
      * @brief Tests the GetRms method.
      */
@@ -107,6 +119,18 @@ public:
      */
     bool TestGetSum(const uint32 windowSize);
 
+    /**
+     * @brief Tests the GetAvg and GetStd methods with the compensated accumulators.
+     */
+    bool TestGetStdCompensated();
+
+    /**
+     * @brief Tests the GetAvg and GetStd methods with the compensated accumulators for a signal with a large offset.
+     * @details The samples alternate between 99 and 101 for 64 windows, i.e. the squared samples would overflow
+     * the narrow integer types.
+     */
+    bool TestGetStdCompensatedOffset(const uint32 windowSize);
+
 };
 }
 /*---------------------------------------------------------------------------*/
@@ -237,6 +261,70 @@ bool StatisticsHelperTTest<Type>::TestGetMin(const uint32 windowSize) {
     return (myStatisticsHelper.GetMin() == 0);
 }
 
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestGetMaxSliding(const uint32 windowSize) {
+    StatisticsHelperT<Type> myStatisticsHelper(windowSize);
+    const uint32 numberOfSamples = 8u * windowSize;
+    Type *mySample = new Type[numberOfSamples];
+    bool ok = true;
+    for (uint32 i = 0; (i < numberOfSamples) && (ok); i++) {
+        /* Increasing, decreasing and saw-tooth sequences */
+        if (i < (2u * windowSize)) {
+            mySample[i] = static_cast<Type>(i % 100u);
+        }
+        else if (i < (4u * windowSize)) {
+            mySample[i] = static_cast<Type>(100u - (i % 100u));
+        }
+        else {
+            mySample[i] = static_cast<Type>(((i * 7u) + ((i / 3u) * 5u)) % 23u);
+        }
+        ok = myStatisticsHelper.PushSample(mySample[i]);
+        Type max = mySample[i];
+        for (uint32 j = ((i < windowSize) ? 0u : (i + 1u - windowSize)); j < i; j++) {
+            if (mySample[j] > max) {
+                max = mySample[j];
+            }
+        }
+        if (ok) {
+            ok = (myStatisticsHelper.GetMax() == max);
+        }
+    }
+    delete[] mySample;
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestGetMinSliding(const uint32 windowSize) {
+    StatisticsHelperT<Type> myStatisticsHelper(windowSize);
+    const uint32 numberOfSamples = 8u * windowSize;
+    Type *mySample = new Type[numberOfSamples];
+    bool ok = true;
+    for (uint32 i = 0; (i < numberOfSamples) && (ok); i++) {
+        /* Increasing, decreasing and saw-tooth sequences */
+        if (i < (2u * windowSize)) {
+            mySample[i] = static_cast<Type>(i % 100u);
+        }
+        else if (i < (4u * windowSize)) {
+            mySample[i] = static_cast<Type>(100u - (i % 100u));
+        }
+        else {
+            mySample[i] = static_cast<Type>(((i * 7u) + ((i / 3u) * 5u)) % 23u);
+        }
+        ok = myStatisticsHelper.PushSample(mySample[i]);
+        Type min = mySample[i];
+        for (uint32 j = ((i < windowSize) ? 0u : (i + 1u - windowSize)); j < i; j++) {
+            if (mySample[j] < min) {
+                min = mySample[j];
+            }
+        }
+        if (ok) {
+            ok = (myStatisticsHelper.GetMin() == min);
+        }
+    }
+    delete[] mySample;
+    return ok;
+}
+
 template<typename Type>
 bool StatisticsHelperTTest<Type>::TestGetRms() {
     StatisticsHelperT<Type> myStatisticsHelper(4);
@@ -273,6 +361,46 @@ bool StatisticsHelperTTest<Type>::TestGetSum(const uint32 windowSize) {
     return (myStatisticsHelper.GetSum() == sum);
 }
 
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestGetStdCompensated() {
+    StatisticsHelperT<Type> myStatisticsHelper(4, true);
+    // 0149 = 3.5 (avg) 3.5 (std)
+    myStatisticsHelper.PushSample(static_cast<Type>(0));
+    myStatisticsHelper.PushSample(static_cast<Type>(1));
+    myStatisticsHelper.PushSample(static_cast<Type>(4));
+    myStatisticsHelper.PushSample(static_cast<Type>(9));
+    bool ok = myStatisticsHelper.IsCompensated();
+    if (ok) {
+        ok = (myStatisticsHelper.GetAvg() == static_cast<Type>(3.5));
+    }
+    if (ok) {
+        ok = (myStatisticsHelper.GetStd() == static_cast<Type>(3.5));
+    }
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestGetStdCompensatedOffset(const uint32 windowSize) {
+    StatisticsHelperT<Type> myStatisticsHelper(windowSize, true);
+    bool ok = true;
+    for (uint32 i = 0; (i < (64u * windowSize)) && (ok); i++) {
+        ok = myStatisticsHelper.PushSample(static_cast<Type>(((i % 2u) == 0u) ? 99 : 101));
+    }
+    if (ok) {
+        ok = (myStatisticsHelper.GetAvg() == static_cast<Type>(100));
+    }
+    if (ok) {
+        ok = (myStatisticsHelper.GetStd() == static_cast<Type>(1));
+    }
+    if (ok) {
+        ok = (myStatisticsHelper.GetMax() == static_cast<Type>(101));
+    }
+    if (ok) {
+        ok = (myStatisticsHelper.GetMin() == static_cast<Type>(99));
+    }
+    return ok;
+}
+
 } /*namespace MARTe*/
 #endif /* STATISTICSHELPERTTEST_H_ */
 
@@ -0,0 +1,82 @@
+/**
+ * @file StatisticsQuantileGTest.cpp
+ * @brief Source file for class StatisticsQuantileGTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class StatisticsQuantileGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "gtest/gtest.h"
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "StatisticsQuantileTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(StatisticsQuantileGTest,TestConstructor) {
+    StatisticsQuantileTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(StatisticsQuantileGTest,TestInitialise) {
+    StatisticsQuantileTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(StatisticsQuantileGTest,TestGetQuantile_FewSamples) {
+    StatisticsQuantileTest test;
+    ASSERT_TRUE(test.TestGetQuantile_FewSamples());
+}
+
+TEST(StatisticsQuantileGTest,TestGetQuantile_Median) {
+    StatisticsQuantileTest test;
+    ASSERT_TRUE(test.TestGetQuantile(0.5, 1001u, 25.0));
+}
+
+TEST(StatisticsQuantileGTest,TestGetQuantile_P90) {
+    StatisticsQuantileTest test;
+    ASSERT_TRUE(test.TestGetQuantile(0.9, 1001u, 25.0));
+}
+
+TEST(StatisticsQuantileGTest,TestGetQuantile_P99) {
+    StatisticsQuantileTest test;
+    ASSERT_TRUE(test.TestGetQuantile(0.99, 1001u, 25.0));
+}
+
+TEST(StatisticsQuantileGTest,TestGetQuantile_Windows) {
+    StatisticsQuantileTest test;
+    ASSERT_TRUE(test.TestGetQuantile_Windows());
+}
+
+TEST(StatisticsQuantileGTest,TestReset) {
+    StatisticsQuantileTest test;
+    ASSERT_TRUE(test.TestReset());
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
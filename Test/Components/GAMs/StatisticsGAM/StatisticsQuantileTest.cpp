@@ -0,0 +1,158 @@
+/**
+ * @file StatisticsQuantileTest.cpp
+ * @brief Source file for class StatisticsQuantileTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class StatisticsQuantileTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "StatisticsQuantile.h"
+#include "StatisticsQuantileTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+StatisticsQuantileTest::StatisticsQuantileTest() {
+}
+
+StatisticsQuantileTest::~StatisticsQuantileTest() {
+}
+
+bool StatisticsQuantileTest::TestConstructor() {
+    using namespace MARTe;
+    StatisticsQuantile quantile;
+    return ((quantile.GetQuantile() == 0.0) && (quantile.GetCounter() == 0u));
+}
+
+bool StatisticsQuantileTest::TestInitialise() {
+    using namespace MARTe;
+    StatisticsQuantile quantile;
+    bool ok = quantile.Initialise(0.5, 16u);
+    if (ok) {
+        ok = quantile.Initialise(0.99, 1u);
+    }
+    if (ok) {
+        ok = !quantile.Initialise(0.0, 16u);
+    }
+    if (ok) {
+        ok = !quantile.Initialise(1.0, 16u);
+    }
+    if (ok) {
+        ok = !quantile.Initialise(-0.5, 16u);
+    }
+    if (ok) {
+        ok = !quantile.Initialise(0.5, 0u);
+    }
+    return ok;
+}
+
+bool StatisticsQuantileTest::TestGetQuantile_FewSamples() {
+    using namespace MARTe;
+    StatisticsQuantile quantile;
+    bool ok = quantile.Initialise(0.5, 16u);
+    // 3 -> 3, 3 1 -> 1, 3 1 2 -> 2, 3 1 2 4 -> 2
+    float64 samples[] = { 3.0, 1.0, 2.0, 4.0 };
+    float64 expected[] = { 3.0, 1.0, 2.0, 2.0 };
+    uint32 i;
+    for (i = 0u; (i < 4u) && (ok); i++) {
+        quantile.PushSample(samples[i]);
+        ok = (quantile.GetQuantile() == expected[i]);
+    }
+    if (ok) {
+        ok = (quantile.GetCounter() == 4u);
+    }
+    return ok;
+}
+
+bool StatisticsQuantileTest::TestGetQuantile(const MARTe::float64 probability,
+                                             const MARTe::uint32 windowSize,
+                                             const MARTe::float64 tolerance) {
+    using namespace MARTe;
+    StatisticsQuantile quantile;
+    bool ok = quantile.Initialise(probability, windowSize);
+    uint32 i;
+    /* Permutation of 0 .. windowSize - 1 */
+    for (i = 0u; (i < windowSize) && (ok); i++) {
+        quantile.PushSample(static_cast<float64>((i * 337u) % windowSize));
+    }
+    if (ok) {
+        float64 exact = probability * static_cast<float64>(windowSize - 1u);
+        float64 error = quantile.GetQuantile() - exact;
+        ok = ((error < tolerance) && (error > -tolerance));
+    }
+    return ok;
+}
+
+bool StatisticsQuantileTest::TestGetQuantile_Windows() {
+    using namespace MARTe;
+    StatisticsQuantile quantile;
+    const uint32 windowSize = 101u;
+    bool ok = quantile.Initialise(0.5, windowSize);
+    uint32 i;
+    for (i = 0u; (i < windowSize) && (ok); i++) {
+        quantile.PushSample(static_cast<float64>((i * 37u) % windowSize));
+    }
+    float64 first = quantile.GetQuantile();
+    if (ok) {
+        ok = ((first > 45.0) && (first < 55.0) && (quantile.GetCounter() == 0u));
+    }
+    /* The second window is shifted by 1000, the first window estimate is kept until it is complete */
+    for (i = 0u; (i < (windowSize - 1u)) && (ok); i++) {
+        quantile.PushSample(1000.0 + static_cast<float64>((i * 37u) % windowSize));
+        ok = (quantile.GetQuantile() == first);
+    }
+    if (ok) {
+        quantile.PushSample(1000.0);
+        float64 second = quantile.GetQuantile();
+        ok = ((second > 1045.0) && (second < 1055.0));
+    }
+    return ok;
+}
+
+bool StatisticsQuantileTest::TestReset() {
+    using namespace MARTe;
+    StatisticsQuantile quantile;
+    bool ok = quantile.Initialise(0.5, 8u);
+    uint32 i;
+    for (i = 0u; (i < 12u) && (ok); i++) {
+        quantile.PushSample(static_cast<float64>(i + 1u));
+    }
+    if (ok) {
+        ok = ((quantile.GetQuantile() != 0.0) && (quantile.GetCounter() == 4u));
+    }
+    if (ok) {
+        quantile.Reset();
+        ok = ((quantile.GetQuantile() == 0.0) && (quantile.GetCounter() == 0u));
+    }
+    return ok;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file StatisticsQuantileTest.h
+ * @brief Header file for class StatisticsQuantileTest
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class StatisticsQuantileTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef STATISTICSQUANTILETEST_H_
+#define STATISTICSQUANTILETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "StatisticsQuantile.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the StatisticsQuantile public methods.
+ */
+class StatisticsQuantileTest {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    StatisticsQuantileTest();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~StatisticsQuantileTest();
+
+    /**
+     * @brief Tests the default constructor.
+     * @details checks all the post conditions.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method.
+     * @details checks that the quantile shall be > 0 and < 1 and the window size > 0.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests the GetQuantile method with less than five samples (nearest rank).
+     */
+    bool TestGetQuantile_FewSamples();
+
+    /**
+     * @brief Tests the GetQuantile method against the exact quantile of a permutation of windowSize integers.
+     * @param[in] probability the quantile to be estimated.
+     * @param[in] windowSize the window size.
+     * @param[in] tolerance the maximum distance from the exact quantile (the estimate is not exact).
+     */
+    bool TestGetQuantile(const MARTe::float64 probability,
+                         const MARTe::uint32 windowSize,
+                         const MARTe::float64 tolerance);
+
+    /**
+     * @brief Tests that the quantile of the last complete window is returned while the next window is populated.
+     */
+    bool TestGetQuantile_Windows();
+
+    /**
+     * @brief Tests the Reset method.
+     */
+    bool TestReset();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* STATISTICSQUANTILETEST_H_ */
@@ -0,0 +1,152 @@
+/**
+ * @file StatisticsWindowsTGTest.cpp
+ * @brief Source file for class StatisticsWindowsTGTest
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class StatisticsWindowsTGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "gtest/gtest.h"
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "StatisticsWindowsTTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/* uint8 */
+
+TEST(StatisticsWindowsTGTest,TestConstructor_uint8) {
+    StatisticsWindowsTTest<uint8> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestConstructor());
+}
+
+TEST(StatisticsWindowsTGTest,TestPushSample_uint8) {
+    StatisticsWindowsTTest<uint8> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestPushSample());
+}
+
+TEST(StatisticsWindowsTGTest,TestWindows_uint8) {
+    StatisticsWindowsTTest<uint8> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestWindows());
+}
+
+TEST(StatisticsWindowsTGTest,TestGetStd_uint8) {
+    StatisticsWindowsTTest<uint8> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestGetStd());
+}
+
+TEST(StatisticsWindowsTGTest,TestReset_uint8) {
+    StatisticsWindowsTTest<uint8> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestReset());
+}
+
+/* int32 */
+
+TEST(StatisticsWindowsTGTest,TestConstructor_int32) {
+    StatisticsWindowsTTest<int32> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestConstructor());
+}
+
+TEST(StatisticsWindowsTGTest,TestPushSample_int32) {
+    StatisticsWindowsTTest<int32> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestPushSample());
+}
+
+TEST(StatisticsWindowsTGTest,TestWindows_int32) {
+    StatisticsWindowsTTest<int32> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestWindows());
+}
+
+TEST(StatisticsWindowsTGTest,TestGetStd_int32) {
+    StatisticsWindowsTTest<int32> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestGetStd());
+}
+
+TEST(StatisticsWindowsTGTest,TestReset_int32) {
+    StatisticsWindowsTTest<int32> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestReset());
+}
+
+/* float32 */
+
+TEST(StatisticsWindowsTGTest,TestConstructor_float32) {
+    StatisticsWindowsTTest<float32> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestConstructor());
+}
+
+TEST(StatisticsWindowsTGTest,TestPushSample_float32) {
+    StatisticsWindowsTTest<float32> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestPushSample());
+}
+
+TEST(StatisticsWindowsTGTest,TestWindows_float32) {
+    StatisticsWindowsTTest<float32> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestWindows());
+}
+
+TEST(StatisticsWindowsTGTest,TestGetStd_float32) {
+    StatisticsWindowsTTest<float32> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestGetStd());
+}
+
+TEST(StatisticsWindowsTGTest,TestReset_float32) {
+    StatisticsWindowsTTest<float32> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestReset());
+}
+
+/* float64 */
+
+TEST(StatisticsWindowsTGTest,TestConstructor_float64) {
+    StatisticsWindowsTTest<float64> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestConstructor());
+}
+
+TEST(StatisticsWindowsTGTest,TestPushSample_float64) {
+    StatisticsWindowsTTest<float64> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestPushSample());
+}
+
+TEST(StatisticsWindowsTGTest,TestWindows_float64) {
+    StatisticsWindowsTTest<float64> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestWindows());
+}
+
+TEST(StatisticsWindowsTGTest,TestGetStd_float64) {
+    StatisticsWindowsTTest<float64> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestGetStd());
+}
+
+TEST(StatisticsWindowsTGTest,TestReset_float64) {
+    StatisticsWindowsTTest<float64> statisticsWindowsTTest;
+    ASSERT_TRUE(statisticsWindowsTTest.TestReset());
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,191 @@
+/**
+ * @file StatisticsWindowsTTest.h
+ * @brief Header file for class StatisticsWindowsTTest
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class StatisticsWindowsTTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef STATISTICSWINDOWSTTEST_H_
+#define STATISTICSWINDOWSTTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <limits>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "StatisticsWindowsT.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+template<typename Type>
+class StatisticsWindowsTTest {
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that the PushSample method returns true only at the end of each block.
+     */
+    bool TestPushSample();
+
+    /**
+     * @brief Tests the GetAvg, GetMin and GetMax methods of three windows against the statistics of the last samples.
+     */
+    bool TestWindows();
+
+    /**
+     * @brief Tests the GetStd method of two windows with alternating samples.
+     */
+    bool TestGetStd();
+
+    /**
+     * @brief Tests the Reset method.
+     */
+    bool TestReset();
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+template<typename Type>
+bool StatisticsWindowsTTest<Type>::TestConstructor() {
+    uint32 windowSizes[] = { 4u, 16u };
+    StatisticsWindowsT<Type> windows(4u, &windowSizes[0], 2u);
+    bool ok = (windows.GetBlockSize() == 4u);
+    if (ok) {
+        ok = (windows.GetNumberOfWindows() == 2u);
+    }
+    if (ok) {
+        ok = ((windows.GetCounter(0u) == 0u) && (windows.GetCounter(1u) == 0u));
+    }
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsWindowsTTest<Type>::TestPushSample() {
+    uint32 windowSizes[] = { 3u, 9u };
+    StatisticsWindowsT<Type> windows(3u, &windowSizes[0], 2u);
+    bool ok = true;
+    for (uint32 i = 0u; (i < 30u) && (ok); i++) {
+        bool completed = windows.PushSample(static_cast<Type>(i));
+        ok = (completed == (((i + 1u) % 3u) == 0u));
+    }
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsWindowsTTest<Type>::TestWindows() {
+    const uint32 numberOfWindows = 3u;
+    uint32 windowSizes[] = { 4u, 12u, 40u };
+    StatisticsWindowsT<Type> windows(4u, &windowSizes[0], numberOfWindows);
+    const uint32 numberOfSamples = 100u;
+    Type samples[numberOfSamples];
+    bool ok = true;
+    for (uint32 i = 0u; (i < numberOfSamples) && (ok); i++) {
+        /* Saw-tooth of period 7, so that the windows have distinct minimum and maximum */
+        samples[i] = static_cast<Type>(((i * 3u) % 7u) + (i / 10u));
+        if (windows.PushSample(samples[i])) {
+            for (uint32 w = 0u; (w < numberOfWindows) && (ok); w++) {
+                uint32 n = (windowSizes[w] < (i + 1u)) ? windowSizes[w] : (i + 1u);
+                float64 sum = 0.0;
+                Type min = samples[i];
+                Type max = samples[i];
+                for (uint32 k = (i + 1u) - n; k <= i; k++) {
+                    sum += static_cast<float64>(samples[k]);
+                    if (samples[k] < min) {
+                        min = samples[k];
+                    }
+                    if (samples[k] > max) {
+                        max = samples[k];
+                    }
+                }
+                ok = (windows.GetCounter(w) == n);
+                if (ok) {
+                    /* The integer types truncate the average */
+                    float64 tolerance = std::numeric_limits<Type>::is_integer ? 1.0 : 1e-4;
+                    float64 error = static_cast<float64>(windows.GetAvg(w)) - (sum / static_cast<float64>(n));
+                    ok = ((error < tolerance) && (error > -tolerance));
+                }
+                if (ok) {
+                    ok = ((windows.GetMin(w) == min) && (windows.GetMax(w) == max));
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsWindowsTTest<Type>::TestGetStd() {
+    uint32 windowSizes[] = { 2u, 8u };
+    StatisticsWindowsT<Type> windows(2u, &windowSizes[0], 2u);
+    bool ok = true;
+    /* Alternating 1 and 5: average 3 and standard deviation 2 over any even number of samples */
+    for (uint32 i = 0u; (i < 20u) && (ok); i++) {
+        if (windows.PushSample(static_cast<Type>(((i % 2u) == 0u) ? 1 : 5))) {
+            ok = ((windows.GetAvg(0u) == static_cast<Type>(3)) && (windows.GetAvg(1u) == static_cast<Type>(3)));
+            if (ok) {
+                ok = ((windows.GetStd(0u) == static_cast<Type>(2)) && (windows.GetStd(1u) == static_cast<Type>(2)));
+            }
+        }
+    }
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsWindowsTTest<Type>::TestReset() {
+    uint32 windowSizes[] = { 2u, 4u };
+    StatisticsWindowsT<Type> windows(2u, &windowSizes[0], 2u);
+    bool ok = true;
+    for (uint32 i = 0u; i < 8u; i++) {
+        (void) windows.PushSample(static_cast<Type>(7));
+    }
+    ok = (windows.GetCounter(1u) == 4u);
+    if (ok) {
+        windows.Reset();
+        ok = ((windows.GetCounter(0u) == 0u) && (windows.GetCounter(1u) == 0u));
+    }
+    if (ok) {
+        ok = (windows.GetAvg(1u) == static_cast<Type>(0));
+    }
+    if (ok) {
+        (void) windows.PushSample(static_cast<Type>(1));
+        ok = windows.PushSample(static_cast<Type>(3));
+    }
+    if (ok) {
+        ok = ((windows.GetCounter(1u) == 2u) && (windows.GetAvg(1u) == static_cast<Type>(2)));
+    }
+    return ok;
+}
+
+}
+
+#endif /* STATISTICSWINDOWSTTEST_H_ */
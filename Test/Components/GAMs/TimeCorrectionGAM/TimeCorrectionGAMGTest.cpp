@@ -64,6 +64,26 @@ TEST(TimeCorrectionGAMGTest,TestInitialise_FalseNoFilterGain) {
     ASSERT_TRUE(test.TestInitialise_FalseNoFilterGain());
 }
 
+TEST(TimeCorrectionGAMGTest,TestInitialise_PLL) {
+    TimeCorrectionGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_PLL());
+}
+
+TEST(TimeCorrectionGAMGTest,TestInitialise_FalsePLLNoGains) {
+    TimeCorrectionGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalsePLLNoGains());
+}
+
+TEST(TimeCorrectionGAMGTest,TestInitialise_FalsePLLUnstableGains) {
+    TimeCorrectionGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalsePLLUnstableGains());
+}
+
+TEST(TimeCorrectionGAMGTest,TestInitialise_FalseBadMode) {
+    TimeCorrectionGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadMode());
+}
+
 TEST(TimeCorrectionGAMGTest,TestSetup) {
     TimeCorrectionGAMTest test;
     ASSERT_TRUE(test.TestSetup());
@@ -133,3 +153,18 @@ TEST(TimeCorrectionGAMGTest,TestExecute_EstimationSlowChange) {
     TimeCorrectionGAMTest test;
     ASSERT_TRUE(test.TestExecute_EstimationSlowChange());
 }
+
+TEST(TimeCorrectionGAMGTest,TestExecute_PLL) {
+    TimeCorrectionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_PLL());
+}
+
+TEST(TimeCorrectionGAMGTest,TestExecute_PLLInterpolation) {
+    TimeCorrectionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_PLLInterpolation());
+}
+
+TEST(TimeCorrectionGAMGTest,TestExecute_MultipleStreams) {
+    TimeCorrectionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_MultipleStreams());
+}
@@ -50,6 +50,8 @@ public:
     uint64 GetDeltaTolerance();
     float GetFilterGain();
     uint64 GetEstimatedDelta();
+    float64 GetEstimatedDeltaF(uint32 i);
+    bool IsPLLMode();
     uint64 *GetInputTime();
     uint64 *GetCorrectedTime();
     uint8* GetCorrected();
@@ -76,23 +78,31 @@ float TimeCorrectionGAMTestGAM::GetFilterGain() {
 }
 
 uint64 TimeCorrectionGAMTestGAM::GetEstimatedDelta() {
-    return estimatedDelta;
+    return (estimatedDelta != NULL) ? estimatedDelta[0] : 0ull;
+}
+
+float64 TimeCorrectionGAMTestGAM::GetEstimatedDeltaF(uint32 i) {
+    return estimatedDelta[i];
 }
 
 uint64 *TimeCorrectionGAMTestGAM::GetInputTime() {
-    return inputTime;
+    return (inputTime != NULL) ? inputTime[0] : NULL;
 }
 
 uint64 *TimeCorrectionGAMTestGAM::GetCorrectedTime() {
-    return correctedTime;
+    return (correctedTime != NULL) ? correctedTime[0] : NULL;
 }
 
 uint8* TimeCorrectionGAMTestGAM::GetCorrected() {
-    return corrected;
+    return (corrected != NULL) ? corrected[0] : NULL;
 }
 
 uint64 TimeCorrectionGAMTestGAM::GetLastValidTime() {
-    return lastValidTime;
+    return (lastValidTime != NULL) ? lastValidTime[0] : 0ull;
+}
+
+bool TimeCorrectionGAMTestGAM::IsPLLMode() {
+    return pllMode;
 }
 
 void *TimeCorrectionGAMTestGAM::GetInputSignalsMemory() {
@@ -265,6 +275,91 @@ bool TimeCorrectionGAMTest::TestInitialise_FalseNoFilterGain() {
     return ret;
 }
 
+bool TimeCorrectionGAMTest::TestInitialise_PLL() {
+    const char8* config = "ExpectedDelta=1000000\n "
+            "DeltaTolerance=20\n "
+            "Mode=PLL\n "
+            "PhaseGain=0.1\n "
+            "FrequencyGain=0.0026\n ";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ret = parser.Parse();
+    if (ret) {
+        TimeCorrectionGAMTestGAM gam;
+        cdb.MoveToRoot();
+        ret = gam.Initialise(cdb);
+        if (ret) {
+            ret = gam.IsPLLMode();
+        }
+    }
+    return ret;
+}
+
+bool TimeCorrectionGAMTest::TestInitialise_FalsePLLNoGains() {
+    const char8* config = "ExpectedDelta=1000000\n "
+            "DeltaTolerance=20\n "
+            "FilterGain=0.9\n "
+            "Mode=PLL\n ";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ret = parser.Parse();
+    if (ret) {
+        TimeCorrectionGAMTestGAM gam;
+        cdb.MoveToRoot();
+        ret = !gam.Initialise(cdb);
+    }
+    return ret;
+}
+
+bool TimeCorrectionGAMTest::TestInitialise_FalsePLLUnstableGains() {
+    const char8* config = "ExpectedDelta=1000000\n "
+            "DeltaTolerance=20\n "
+            "Mode=PLL\n "
+            "PhaseGain=1.0\n "
+            "FrequencyGain=2.0\n ";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ret = parser.Parse();
+    if (ret) {
+        TimeCorrectionGAMTestGAM gam;
+        cdb.MoveToRoot();
+        ret = !gam.Initialise(cdb);
+    }
+    return ret;
+}
+
+bool TimeCorrectionGAMTest::TestInitialise_FalseBadMode() {
+    const char8* config = "ExpectedDelta=1000000\n "
+            "DeltaTolerance=20\n "
+            "FilterGain=0.9\n "
+            "Mode=Kalman\n ";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ret = parser.Parse();
+    if (ret) {
+        TimeCorrectionGAMTestGAM gam;
+        cdb.MoveToRoot();
+        ret = !gam.Initialise(cdb);
+    }
+    return ret;
+}
+
 bool TimeCorrectionGAMTest::TestSetup() {
 
     static const char8 * const config = ""
@@ -1332,3 +1427,307 @@ bool TimeCorrectionGAMTest::TestExecute_EstimationSlowChange() {
     return ret;
 }
 
+bool TimeCorrectionGAMTest::TestExecute_PLL() {
+
+    static const char8 * const config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = TimeCorrectionGAMTestGAM"
+            "           ExpectedDelta=1000000"
+            "           DeltaTolerance=200"
+            "           Mode=PLL"
+            "           PhaseGain=0.5"
+            "           FrequencyGain=0.1"
+            "            InputSignals = {"
+            "                InputTime = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   Frequency = 0"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "               CorrectedTime = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "               }"
+            "               IsCorrected = {"
+            "                   DataSource = DDB"
+            "                   Type = uint8"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = TimeCorrectionGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+
+    ReferenceT<TimeCorrectionGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    uint64* input = NULL;
+    uint64* output = NULL;
+    if (ret) {
+        input = (uint64*) gam->GetInputSignalsMemory();
+        output = (uint64*) gam->GetOutputSignalsMemory();
+        ret = (input != NULL) && (output != NULL);
+    }
+
+    if (ret) {
+        //the acquisition clock is 50 ppm faster than expected and has a jitter of +-10
+        uint32 nIterations = 1000;
+        uint32 outlierIdx = 500;
+        uint64 previousOutput = 0u;
+        for (uint32 i = 0u; (i < nIterations) && (ret); i++) {
+            uint64 trueTime = 1000u + (i * 1000050ull);
+            *input = ((i % 2) == 0) ? (trueTime - 10u) : (trueTime + 10u);
+            if (i == outlierIdx) {
+                *input += 5000u;
+            }
+            gam->Execute();
+            if (i > 0u) {
+                ret = (*output > previousOutput);
+            }
+            previousOutput = *output;
+            if (ret) {
+                uint8 isCorrected = *(uint8*) (&output[1]);
+                ret = (isCorrected == ((i == outlierIdx) ? 1u : 0u));
+            }
+            if ((ret) && (i > 100u)) {
+                int64 error = static_cast<int64>(*output - trueTime);
+                ret = ((error <= 10) && (error >= -10));
+            }
+        }
+    }
+    if (ret) {
+        float64 deltaError = gam->GetEstimatedDeltaF(0u) - 1000050.;
+        ret = ((deltaError < 2.) && (deltaError > -2.));
+    }
+    return ret;
+}
+
+bool TimeCorrectionGAMTest::TestExecute_PLLInterpolation() {
+
+    static const char8 * const config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = TimeCorrectionGAMTestGAM"
+            "           ExpectedDelta=1000000"
+            "           DeltaTolerance=20"
+            "           Mode=PLL"
+            "           PhaseGain=0.1"
+            "           FrequencyGain=0.0026"
+            "            InputSignals = {"
+            "                InputTime = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   Frequency = 0"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "               SampleTimes = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "                   NumberOfElements = 4"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = TimeCorrectionGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+
+    ReferenceT<TimeCorrectionGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    uint64* input = NULL;
+    uint64* output = NULL;
+    if (ret) {
+        input = (uint64*) gam->GetInputSignalsMemory();
+        output = (uint64*) gam->GetOutputSignalsMemory();
+        ret = (input != NULL) && (output != NULL);
+    }
+
+    if (ret) {
+        uint64 fakeTime = 0u;
+        uint32 nIterations = 100;
+        for (uint32 i = 0u; (i < nIterations) && (ret); i++) {
+            *input = fakeTime;
+            gam->Execute();
+            for (uint32 k = 0u; (k < 4u) && (ret); k++) {
+                ret = (output[k] == (fakeTime + (k * 250000u)));
+            }
+            fakeTime += 1000000;
+        }
+    }
+    return ret;
+}
+
+bool TimeCorrectionGAMTest::TestExecute_MultipleStreams() {
+
+    static const char8 * const config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = TimeCorrectionGAMTestGAM"
+            "           ExpectedDelta=1000000"
+            "           DeltaTolerance=20"
+            "           FilterGain=0.9"
+            "            InputSignals = {"
+            "                InputTime1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   Frequency = 0"
+            "                }"
+            "                InputTime2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "               CorrectedTime1 = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "               }"
+            "               CorrectedTime2 = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = TimeCorrectionGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+
+    ReferenceT<TimeCorrectionGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    uint64* input = NULL;
+    uint64* output = NULL;
+    if (ret) {
+        input = (uint64*) gam->GetInputSignalsMemory();
+        output = (uint64*) gam->GetOutputSignalsMemory();
+        ret = (input != NULL) && (output != NULL);
+    }
+
+    if (ret) {
+        uint64 fakeTime = 0u;
+        uint32 nIterations = 100;
+        uint32 jumpIdx = 10;
+        for (uint32 i = 0u; (i < nIterations) && (ret); i++) {
+            input[0] = fakeTime;
+            input[1] = fakeTime + 1000u;
+            if (i == jumpIdx) {
+                input[1] += 5000u;
+            }
+            gam->Execute();
+            ret = (output[0] == input[0]);
+            if (ret) {
+                ret = (output[1] == (fakeTime + 1000u));
+            }
+            fakeTime += 1000000;
+        }
+    }
+    return ret;
+}
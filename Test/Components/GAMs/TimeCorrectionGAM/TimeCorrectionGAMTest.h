@@ -82,6 +82,29 @@ public:
      */
     bool TestInitialise_FalseNoFilterGain();
 
+    /**
+     * @brief Tests the TimeCorrectionGAM::Initialise method with Mode = PLL
+     */
+    bool TestInitialise_PLL();
+
+    /**
+     * @brief Tests the TimeCorrectionGAM::Initialise method that fails if
+     * the PhaseGain and the FrequencyGain are not defined with Mode = PLL
+     */
+    bool TestInitialise_FalsePLLNoGains();
+
+    /**
+     * @brief Tests the TimeCorrectionGAM::Initialise method that fails if
+     * the PLL gains are out of the stability range
+     */
+    bool TestInitialise_FalsePLLUnstableGains();
+
+    /**
+     * @brief Tests the TimeCorrectionGAM::Initialise method that fails if
+     * the Mode is not Filter or PLL
+     */
+    bool TestInitialise_FalseBadMode();
+
     /**
      * @brief Tests the TimeCorrectionGAM::Setup method
      */
@@ -95,8 +118,8 @@ public:
     bool TestSetup_OneOutputSignal();
 
     /**
-     * @brief Tests the TimeCorrectionGAM::Setup method that fails if more
-     * than one input signal is defined
+     * @brief Tests the TimeCorrectionGAM::Setup method that fails if the number
+     * of output signals does not match the number of input signals
      */
     bool TestSetup_FalseNumberOfInputSignals();
 
@@ -165,6 +188,24 @@ public:
      */
     bool TestExecute_EstimationSlowChange();
 
+    /**
+     * @brief Tests the TimeCorrectionGAM::Execute method with Mode = PLL
+     * tracking a drifting clock with jitter and an outlier
+     */
+    bool TestExecute_PLL();
+
+    /**
+     * @brief Tests the TimeCorrectionGAM::Execute method with Mode = PLL
+     * and the interpolation of the sample times
+     */
+    bool TestExecute_PLLInterpolation();
+
+    /**
+     * @brief Tests the TimeCorrectionGAM::Execute method correcting
+     * two independent time streams
+     */
+    bool TestExecute_MultipleStreams();
+
 };
 
 /*---------------------------------------------------------------------------*/
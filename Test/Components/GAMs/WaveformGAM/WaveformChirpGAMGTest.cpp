@@ -85,6 +85,21 @@ TEST(WaveformChirpGAMTest, TestExecuteNyquistViolation) {
     ASSERT_TRUE(test.TestExecuteNyquistViolation());
 }
 
+TEST(WaveformChirpGAMTest, TestInitialiseWrongMethod) {
+    WaveformChirpGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongMethod());
+}
+
+TEST(WaveformChirpGAMTest, TestExecuteTable) {
+    WaveformChirpGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMethod("Table", 1e-5));
+}
+
+TEST(WaveformChirpGAMTest, TestExecuteRecurrence) {
+    WaveformChirpGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMethod("Recurrence", 1e-9));
+}
+
 TEST(WaveformChirpGAMTest, TestExecuteUInt8) {
     WaveformChirpGAMTest test;
     StreamString auxStr = "uint8";
@@ -283,5 +283,70 @@ bool WaveformChirpGAMTest::TestExecuteNyquistViolation() {
     return ok;
 }
 
+bool WaveformChirpGAMTest::TestInitialiseWrongMethod() {
+    bool ok = true;
+    uint32 sizeOutput = 4u;
+    WaveformChirpGAMTestHelper gam(1, 1, sizeOutput, 1);
+    gam.SetName("Test");
+    ok &= gam.InitialiseChirp1();
+    ok &= gam.config.Write("Method", "Interpolated");
+    gam.config.MoveToRoot();
+    ok &= gam.Initialise(gam.config);
+    return !ok;
 }
 
+bool WaveformChirpGAMTest::TestExecuteMethod(StreamString method,
+                                             float64 tolerance) {
+    bool ok = true;
+    uint32 timeIterationIncrement = 100000u;
+    uint32 numberOfIteration = 400u;
+    uint32 sizeOutput = 7u;
+    WaveformChirpGAMTestHelper gam(1, 1, sizeOutput, 1, "float64");
+
+    gam.SetName("Test");
+    ok &= gam.InitialiseChirp1();
+    ok &= gam.config.Write("Method", method.Buffer());
+    gam.config.MoveToRoot();
+    if (ok) {
+        ok &= gam.Initialise(gam.config);
+    }
+    if (ok) {
+        ok &= gam.InitialiseConfigDataBaseSignal1();
+    }
+    if (ok) {
+        ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    }
+    if (ok) {
+        ok &= gam.AllocateInputSignalsMemory();
+    }
+    if (ok) {
+        ok &= gam.AllocateOutputSignalsMemory();
+    }
+    if (ok) {
+        ok &= gam.Setup();
+    }
+    uint32 *timeIteration = NULL;
+    float64 *output = NULL;
+    if (ok) {
+        timeIteration = static_cast<uint32 *>(gam.GetInputSignalsMemory());
+        *timeIteration = 0;
+        output = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+    }
+    float64 w1 = 2.0 * FastMath::PI * gam.f1;
+    float64 w12 = 2.0 * FastMath::PI * (gam.f2 - gam.f1);
+    float64 timeIncrement = (static_cast<float64>(timeIterationIncrement) / sizeOutput) / 1e6;
+    for (uint32 i = 0u; (i < numberOfIteration) && ok; i++) {
+        ok = gam.Execute();
+        for (uint32 j = 0u; (j < sizeOutput) && ok && (i > 0u); j++) {
+            float64 t = (static_cast<float64>(*timeIteration) / 1e6) + (j * timeIncrement);
+            float64 expected = (gam.amplitude * sin(((w1 * t) + ((w12 * t * t) / (2.0 * gam.chirpDuration))) + gam.phase)) + gam.offset;
+            ok = (fabs(output[j] - expected) < tolerance);
+            if (!ok) {
+                REPORT_ERROR_STATIC_PARAMETERS(ErrorManagement::FatalError, "iteration which fails %u\n", i);
+            }
+        }
+        *timeIteration += timeIterationIncrement;
+    }
+    return ok;
+}
+}
@@ -99,6 +99,19 @@ public:
      */
     bool TestExecuteNyquistViolation();
 
+    /**
+     * @brief Test error message of WaveformChirp::Initialise() with a wrong Method.
+     */
+    bool TestInitialiseWrongMethod();
+
+    /**
+     * @brief Verifies the float64 output computed with the given Method against the sin of the chirp phase.
+     * @param[in] method the Method (Table or Recurrence).
+     * @param[in] tolerance the maximum absolute error.
+     */
+    bool TestExecuteMethod(StreamString method,
+                           float64 tolerance);
+
     /**
      * @brief Template test. Verifies the correctness of the data.
      */
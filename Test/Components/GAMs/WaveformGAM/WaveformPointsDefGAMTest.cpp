@@ -27,6 +27,7 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 #include "stdio.h"
+#include "math.h"
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
@@ -640,3 +641,33 @@ bool WaveformPointsDefGAMTest::TestExecuteLargeElements() {
     return ok;
 }
 
+bool WaveformPointsDefGAMTest::TestExecuteTimeJump() {
+    bool ok = true;
+    uint32 sizeOutput = 10u;
+    WaveformPointsDefGAMTestHelper gam(1, 1, sizeOutput, 1, "float64", 0, 0, 2, 2);
+    gam.SetName("Test");
+    //The sequence 0, 1, ..., 9 is repeated every second
+    ok &= gam.InitialisePointsdefSawtooth();
+    gam.config.MoveToRoot();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignal1();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    uint32 inputTimes[] = { 0u, 1000000u, 2000000u, 9000000u, 10000000u, 23000000u };
+    uint32 *timeIteration = static_cast<uint32 *>(gam.GetInputSignalsMemory());
+    float64 *output = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+    for (uint32 i = 0u; (i < 6u) && ok; i++) {
+        *timeIteration = inputTimes[i];
+        ok = gam.Execute();
+        for (uint32 j = 0u; (j < sizeOutput) && ok && (i > 0u); j++) {
+            ok = (fabs(output[j] - gam.refValues[j]) < 1e-9);
+            if (!ok) {
+                printf("Error. output = %f, refVal = %f, iteration %u\n", output[j], gam.refValues[j], i);
+            }
+        }
+    }
+    return ok;
+}
+
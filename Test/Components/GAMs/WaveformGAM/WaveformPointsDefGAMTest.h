@@ -182,6 +182,11 @@ public:
      * @details The origin of the test is the real time application with the Waveform() and UnpackGAM()
      */
     bool TestExecuteLargeElements();
+
+    /**
+     * @brief Test WaveformPointsDef::Execute() when the time jumps several repetitions of the sequence.
+     */
+    bool TestExecuteTimeJump();
 };
 
 /*---------------------------------------------------------------------------*/
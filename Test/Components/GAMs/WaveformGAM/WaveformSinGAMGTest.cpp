@@ -318,6 +318,28 @@ TEST(WaveformSinGAMTest, TestExecuteNegativeInput_2) {
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 
+TEST(WaveformSinGAMTest, TestInitialise_WrongMethod) {
+    WaveformSinGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_WrongMethod());
+}
 
+TEST(WaveformSinGAMTest, TestInitialise_WrongTableSize) {
+    WaveformSinGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_WrongTableSize());
+}
+
+TEST(WaveformSinGAMTest, TestInitialise_TableSizeWithoutTable) {
+    WaveformSinGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_TableSizeWithoutTable());
+}
+
+TEST(WaveformSinGAMTest, TestFloat64ExecuteTable) {
+    WaveformSinGAMTest test;
+    ASSERT_TRUE(test.TestFloat64ExecuteMethod("Table", 1e-5));
+}
+
+TEST(WaveformSinGAMTest, TestFloat64ExecuteRecurrence) {
+    WaveformSinGAMTest test;
+    ASSERT_TRUE(test.TestFloat64ExecuteMethod("Recurrence", 1e-9));
+}
 
-	
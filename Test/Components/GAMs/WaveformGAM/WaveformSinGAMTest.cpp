@@ -3698,3 +3698,83 @@ bool WaveformSinGAMTest::TestExecuteNegativeInput_2() {
     }
     return ok;
 }
+
+bool WaveformSinGAMTest::TestInitialise_WrongMethod() {
+    using namespace MARTe;
+    bool ok = true;
+    WaveformSinGAMTestHelper gam;
+    ok &= gam.InitialiseWaveSin();
+    ok &= gam.config.Write("Method", "Interpolated");
+    ok &= gam.Initialise(gam.config);
+    return !ok;
+}
+
+bool WaveformSinGAMTest::TestInitialise_WrongTableSize() {
+    using namespace MARTe;
+    bool ok = true;
+    WaveformSinGAMTestHelper gam;
+    ok &= gam.InitialiseWaveSin();
+    ok &= gam.config.Write("Method", "Table");
+    ok &= gam.config.Write("TableSize", 1000u);
+    ok &= gam.Initialise(gam.config);
+    return !ok;
+}
+
+bool WaveformSinGAMTest::TestInitialise_TableSizeWithoutTable() {
+    using namespace MARTe;
+    bool ok = true;
+    WaveformSinGAMTestHelper gam;
+    ok &= gam.InitialiseWaveSin();
+    ok &= gam.config.Write("TableSize", 1024u);
+    ok &= gam.Initialise(gam.config);
+    return !ok;
+}
+
+bool WaveformSinGAMTest::TestFloat64ExecuteMethod(StreamString method,
+                                                  float64 tolerance) {
+    using namespace MARTe;
+    bool ok = true;
+    uint32 elementsOut = 7u;
+    WaveformSinGAMTestHelper gamDirect(1, 1, elementsOut, 1);
+    WaveformSinGAMTestHelper gam(1, 1, elementsOut, 1);
+    gamDirect.SetName("TestDirect");
+    gam.SetName("Test");
+    ok &= gamDirect.InitialiseWaveSinTrigger(10.0, 1.0, 0.5, 1.0);
+    ok &= gam.InitialiseWaveSinTrigger(10.0, 1.0, 0.5, 1.0);
+    ok &= gam.config.Write("Method", method.Buffer());
+    gamDirect.config.MoveToRoot();
+    gam.config.MoveToRoot();
+    ok &= gamDirect.Initialise(gamDirect.config);
+    ok &= gam.Initialise(gam.config);
+    ok &= gamDirect.InitialiseConfigDataBaseSignal1(Float64Bit);
+    ok &= gam.InitialiseConfigDataBaseSignal1(Float64Bit);
+    ok &= gamDirect.SetConfiguredDatabase(gamDirect.configSignals);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gamDirect.AllocateInputSignalsMemory();
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gamDirect.AllocateOutputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gamDirect.Setup();
+    ok &= gam.Setup();
+    if (ok) {
+        uint32 *gamDirectMemoryIn = static_cast<uint32 *>(gamDirect.GetInputSignalsMemory());
+        uint32 *gamMemoryIn = static_cast<uint32 *>(gam.GetInputSignalsMemory());
+        float64 *gamDirectMemoryOut = static_cast<float64 *>(gamDirect.GetOutputSignalsMemory());
+        float64 *gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+        for (uint32 i = 0u; (i < 5u) && ok; i++) {
+            *gamDirectMemoryIn = i * 1000000u;
+            *gamMemoryIn = i * 1000000u;
+            ok = gamDirect.Execute();
+            ok &= gam.Execute();
+            for (uint32 j = 0u; (j < elementsOut) && ok; j++) {
+                if (gamDirectMemoryOut[j] == 0.0) {
+                    ok = (gamMemoryOut[j] == 0.0);
+                }
+                else {
+                    ok = (fabs(gamMemoryOut[j] - gamDirectMemoryOut[j]) < tolerance);
+                }
+            }
+        }
+    }
+    return ok;
+}
@@ -168,6 +168,30 @@ public:
      */
     bool TestExecuteNyquistViolation();
 
+    /**
+     * @brief Test message errors of WaveformSin::Initialise() with a wrong Method.
+     */
+    bool TestInitialise_WrongMethod();
+
+    /**
+     * @brief Test message errors of WaveformSin::Initialise() with a TableSize which is not a power of 2.
+     */
+    bool TestInitialise_WrongTableSize();
+
+    /**
+     * @brief Test message errors of WaveformSin::Initialise() with a TableSize and Method = Direct.
+     */
+    bool TestInitialise_TableSizeWithoutTable();
+
+    /**
+     * @brief Test the correctness of the float64 output (with the trigger mechanism) computed with the given Method against the output
+     * computed with Method = Direct.
+     * @param[in] method the Method (Table or Recurrence).
+     * @param[in] tolerance the maximum absolute error.
+     */
+    bool TestFloat64ExecuteMethod(StreamString method,
+                                  float64 tolerance);
+
     /**
      * @brief Test the correctness of the output with uint8.
      */
@@ -0,0 +1,117 @@
+/**
+ * @file WaveformStreamGAMGTest.cpp
+ * @brief Source file for class WaveformStreamGAMGTest
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class WaveformStreamGAMGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "WaveformStreamGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(WaveformStreamGAMTest, TestInitialise) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(WaveformStreamGAMTest, TestInitialise_MissingFilename) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_MissingFilename());
+}
+
+TEST(WaveformStreamGAMTest, TestInitialise_InvalidFilename) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_InvalidFilename());
+}
+
+TEST(WaveformStreamGAMTest, TestInitialise_MissingSamplingPeriod) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_MissingSamplingPeriod());
+}
+
+TEST(WaveformStreamGAMTest, TestInitialise_InvalidSignal) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_InvalidSignal());
+}
+
+TEST(WaveformStreamGAMTest, TestInitialise_InvalidElement) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_InvalidElement());
+}
+
+TEST(WaveformStreamGAMTest, TestInitialise_InvalidNumberOfBuffers) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_InvalidNumberOfBuffers());
+}
+
+TEST(WaveformStreamGAMTest, TestInitialise_InvalidEOF) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_InvalidEOF());
+}
+
+TEST(WaveformStreamGAMTest, TestInitialise_InvalidFileSize) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_InvalidFileSize());
+}
+
+TEST(WaveformStreamGAMTest, TestExecute_SamplingPeriod) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestExecute_SamplingPeriod());
+}
+
+TEST(WaveformStreamGAMTest, TestExecute_TimeSignal) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestExecute_TimeSignal());
+}
+
+TEST(WaveformStreamGAMTest, TestExecute_EOFZero) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestExecute_EOFZero());
+}
+
+TEST(WaveformStreamGAMTest, TestExecute_Trigger) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Trigger());
+}
+
+TEST(WaveformStreamGAMTest, TestExecute_Prefetch) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Prefetch());
+}
+
+TEST(WaveformStreamGAMTest, TestExecute_TimeNotIncreasing) {
+    WaveformStreamGAMTest test;
+    ASSERT_TRUE(test.TestExecute_TimeNotIncreasing());
+}
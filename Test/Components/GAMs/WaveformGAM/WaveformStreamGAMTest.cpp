@@ -0,0 +1,379 @@
+/**
+ * @file WaveformStreamGAMTest.cpp
+ * @brief Source file for class WaveformStreamGAMTest
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class WaveformStreamGAMTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Sleep.h"
+#include "WaveformStreamGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+static const MARTe::char8 * const WAVEFORM_STREAM_TEST_FILE = "/tmp/WaveformStreamGAMTest.bin";
+
+/**
+ * @brief Writes a binary file in the FileWriter format.
+ * @details If withTime the file has the signals Time (uint32) and Value (float32), otherwise it has the signal Value (float32[2]) with
+ * {-values[i], values[i]}.
+ */
+static bool WaveformStreamGAMTestWriteFile(const bool withTime,
+                                           const MARTe::uint32 numberOfSamples,
+                                           const MARTe::uint32 * const times,
+                                           const MARTe::float32 * const values) {
+    using namespace MARTe;
+    FILE *f = fopen(WAVEFORM_STREAM_TEST_FILE, "wb");
+    bool ok = (f != NULL);
+    if (ok) {
+        uint32 nOfSignals = (withTime) ? (2u) : (1u);
+        ok = (fwrite(&nOfSignals, sizeof(uint32), 1u, f) == 1u);
+        char8 name[32u];
+        if ((ok) && (withTime)) {
+            uint16 type = UnsignedInteger32Bit.all;
+            uint32 nOfElements = 1u;
+            memset(&name[0], 0, sizeof(name));
+            strncpy(&name[0], "Time", sizeof(name));
+            ok = (fwrite(&type, sizeof(uint16), 1u, f) == 1u);
+            ok &= (fwrite(&name[0], sizeof(name), 1u, f) == 1u);
+            ok &= (fwrite(&nOfElements, sizeof(uint32), 1u, f) == 1u);
+        }
+        if (ok) {
+            uint16 type = Float32Bit.all;
+            uint32 nOfElements = (withTime) ? (1u) : (2u);
+            memset(&name[0], 0, sizeof(name));
+            strncpy(&name[0], "Value", sizeof(name));
+            ok = (fwrite(&type, sizeof(uint16), 1u, f) == 1u);
+            ok &= (fwrite(&name[0], sizeof(name), 1u, f) == 1u);
+            ok &= (fwrite(&nOfElements, sizeof(uint32), 1u, f) == 1u);
+        }
+        for (uint32 i = 0u; (i < numberOfSamples) && (ok); i++) {
+            if (withTime) {
+                ok = (fwrite(&times[i], sizeof(uint32), 1u, f) == 1u);
+            }
+            else {
+                float32 negative = -values[i];
+                ok = (fwrite(&negative, sizeof(float32), 1u, f) == 1u);
+            }
+            ok &= (fwrite(&values[i], sizeof(float32), 1u, f) == 1u);
+        }
+        ok &= (fclose(f) == 0);
+    }
+    return ok;
+}
+
+/**
+ * @brief Writes a file without TimeSignal with the values 0, 1, ..., numberOfSamples - 1.
+ */
+static bool WaveformStreamGAMTestWriteRamp(const MARTe::uint32 numberOfSamples) {
+    using namespace MARTe;
+    float32 *values = new float32[numberOfSamples];
+    for (uint32 i = 0u; i < numberOfSamples; i++) {
+        values[i] = static_cast<float32>(i);
+    }
+    bool ok = WaveformStreamGAMTestWriteFile(false, numberOfSamples, NULL, values);
+    delete[] values;
+    return ok;
+}
+
+/**
+ * @brief Writes a file with the TimeSignal (in us) {1000, 2000, 4000, 7750} and the values {0, 10, 30, 67.5}, i.e. 10 per ms.
+ */
+static bool WaveformStreamGAMTestWriteTimed() {
+    using namespace MARTe;
+    uint32 times[] = { 1000u, 2000u, 4000u, 7750u };
+    float32 values[] = { 0.F, 10.F, 30.F, 67.5F };
+    return WaveformStreamGAMTestWriteFile(true, 4u, &times[0], &values[0]);
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+WaveformStreamGAMTest::WaveformStreamGAMTest() {
+}
+
+WaveformStreamGAMTest::~WaveformStreamGAMTest() {
+    (void) remove(WAVEFORM_STREAM_TEST_FILE);
+}
+
+bool WaveformStreamGAMTest::TestInitialise() {
+    bool ok = WaveformStreamGAMTestWriteTimed();
+    WaveformStreamGAMTestHelper gam;
+    ok &= gam.config.Write("Filename", WAVEFORM_STREAM_TEST_FILE);
+    ok &= gam.config.Write("TimeSignal", "Time");
+    ok &= gam.config.Write("Signal", "Value");
+    if (ok) {
+        ok = gam.Initialise(gam.config);
+    }
+    if (ok) {
+        ok = (gam.GetNumberOfSamples() == 4u);
+    }
+    if (ok) {
+        ok = (gam.GetNumberOfUnderruns() == 0u);
+    }
+    if (ok) {
+        ok = !gam.IsEndOfStream();
+    }
+    return ok;
+}
+
+bool WaveformStreamGAMTest::TestInitialise_MissingFilename() {
+    bool ok = WaveformStreamGAMTestWriteTimed();
+    WaveformStreamGAMTestHelper gam;
+    ok &= gam.config.Write("TimeSignal", "Time");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool WaveformStreamGAMTest::TestInitialise_InvalidFilename() {
+    WaveformStreamGAMTestHelper gam;
+    bool ok = gam.config.Write("Filename", "/tmp/WaveformStreamGAMTest_DoesNotExist.bin");
+    ok &= gam.config.Write("SamplingPeriod", 1e-3);
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool WaveformStreamGAMTest::TestInitialise_MissingSamplingPeriod() {
+    bool ok = WaveformStreamGAMTestWriteRamp(10u);
+    WaveformStreamGAMTestHelper gam;
+    ok &= gam.config.Write("Filename", WAVEFORM_STREAM_TEST_FILE);
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool WaveformStreamGAMTest::TestInitialise_InvalidSignal() {
+    bool ok = WaveformStreamGAMTestWriteTimed();
+    WaveformStreamGAMTestHelper gam;
+    ok &= gam.config.Write("Filename", WAVEFORM_STREAM_TEST_FILE);
+    ok &= gam.config.Write("TimeSignal", "Time");
+    ok &= gam.config.Write("Signal", "DoesNotExist");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool WaveformStreamGAMTest::TestInitialise_InvalidElement() {
+    bool ok = WaveformStreamGAMTestWriteRamp(10u);
+    WaveformStreamGAMTestHelper gam;
+    ok &= gam.config.Write("Filename", WAVEFORM_STREAM_TEST_FILE);
+    ok &= gam.config.Write("SamplingPeriod", 1e-3);
+    ok &= gam.config.Write("Element", 2);
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool WaveformStreamGAMTest::TestInitialise_InvalidNumberOfBuffers() {
+    bool ok = WaveformStreamGAMTestWriteRamp(10u);
+    WaveformStreamGAMTestHelper gam;
+    ok &= gam.config.Write("Filename", WAVEFORM_STREAM_TEST_FILE);
+    ok &= gam.config.Write("SamplingPeriod", 1e-3);
+    ok &= gam.config.Write("NumberOfBuffers", 1);
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool WaveformStreamGAMTest::TestInitialise_InvalidEOF() {
+    bool ok = WaveformStreamGAMTestWriteRamp(10u);
+    WaveformStreamGAMTestHelper gam;
+    ok &= gam.config.Write("Filename", WAVEFORM_STREAM_TEST_FILE);
+    ok &= gam.config.Write("SamplingPeriod", 1e-3);
+    ok &= gam.config.Write("EOF", "Rewind");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool WaveformStreamGAMTest::TestInitialise_InvalidFileSize() {
+    bool ok = WaveformStreamGAMTestWriteRamp(10u);
+    if (ok) {
+        FILE *f = fopen(WAVEFORM_STREAM_TEST_FILE, "ab");
+        ok = (f != NULL);
+        if (ok) {
+            uint8 extra[3] = { 1u, 2u, 3u };
+            ok = (fwrite(&extra[0], sizeof(extra), 1u, f) == 1u);
+            ok &= (fclose(f) == 0);
+        }
+    }
+    WaveformStreamGAMTestHelper gam;
+    ok &= gam.config.Write("Filename", WAVEFORM_STREAM_TEST_FILE);
+    ok &= gam.config.Write("SamplingPeriod", 1e-3);
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool WaveformStreamGAMTest::TestExecute_SamplingPeriod() {
+    bool ok = WaveformStreamGAMTestWriteRamp(10u);
+    WaveformStreamGAMTestHelper gam;
+    ok &= gam.config.Write("Filename", WAVEFORM_STREAM_TEST_FILE);
+    ok &= gam.config.Write("SamplingPeriod", 1e-3);
+    ok &= gam.config.Write("Element", 1);
+    if (ok) {
+        ok = gam.InitialiseAndSetup();
+    }
+    //4 elements every 2 ms, i.e. two output elements per sample of the file
+    float64 expected[6][4] = { { 0., 0., 0., 0. }, { 0., 0.5, 1., 1.5 }, { 2., 2.5, 3., 3.5 }, { 4., 4.5, 5., 5.5 }, { 6., 6.5, 7., 7.5 },
+            { 8., 8.5, 9., 9. } };
+    for (uint32 c = 0u; (c < 6u) && (ok); c++) {
+        ok = gam.ExecuteAndCompare(2000u * (c + 1u), &expected[c][0]);
+    }
+    if (ok) {
+        ok = gam.IsEndOfStream();
+    }
+    return ok;
+}
+
+bool WaveformStreamGAMTest::TestExecute_TimeSignal() {
+    bool ok = WaveformStreamGAMTestWriteTimed();
+    WaveformStreamGAMTestHelper gam;
+    ok &= gam.config.Write("Filename", WAVEFORM_STREAM_TEST_FILE);
+    ok &= gam.config.Write("TimeSignal", "Time");
+    ok &= gam.config.Write("EOF", "Last");
+    if (ok) {
+        ok = gam.InitialiseAndSetup();
+    }
+    float64 expected[6][4] = { { 0., 0., 0., 0. }, { 0., 5., 10., 15. }, { 20., 25., 30., 35. }, { 40., 45., 50., 55. }, { 60., 65., 67.5, 67.5 },
+            { 67.5, 67.5, 67.5, 67.5 } };
+    for (uint32 c = 0u; (c < 6u) && (ok); c++) {
+        ok = gam.ExecuteAndCompare(2000u * (c + 1u), &expected[c][0]);
+    }
+    return ok;
+}
+
+bool WaveformStreamGAMTest::TestExecute_EOFZero() {
+    bool ok = WaveformStreamGAMTestWriteTimed();
+    WaveformStreamGAMTestHelper gam;
+    ok &= gam.config.Write("Filename", WAVEFORM_STREAM_TEST_FILE);
+    ok &= gam.config.Write("TimeSignal", "Time");
+    ok &= gam.config.Write("EOF", "Zero");
+    if (ok) {
+        ok = gam.InitialiseAndSetup();
+    }
+    float64 expected[6][4] = { { 0., 0., 0., 0. }, { 0., 5., 10., 15. }, { 20., 25., 30., 35. }, { 40., 45., 50., 55. }, { 60., 65., 0., 0. }, { 0.,
+            0., 0., 0. } };
+    for (uint32 c = 0u; (c < 6u) && (ok); c++) {
+        ok = gam.ExecuteAndCompare(2000u * (c + 1u), &expected[c][0]);
+    }
+    return ok;
+}
+
+bool WaveformStreamGAMTest::TestExecute_Trigger() {
+    bool ok = WaveformStreamGAMTestWriteRamp(10u);
+    WaveformStreamGAMTestHelper gam;
+    ok &= gam.config.Write("Filename", WAVEFORM_STREAM_TEST_FILE);
+    ok &= gam.config.Write("SamplingPeriod", 1e-3);
+    ok &= gam.config.Write("Element", 1);
+    float64 startTriggerTime[] = { 0.0049, 0.020 };
+    float64 stopTriggerTime[] = { 0.0093 };
+    Vector<float64> startTriggerTimeVector(&startTriggerTime[0], 2u);
+    Vector<float64> stopTriggerTimeVector(&stopTriggerTime[0], 1u);
+    ok &= gam.config.Write("StartTriggerTime", startTriggerTimeVector);
+    ok &= gam.config.Write("StopTriggerTime", stopTriggerTimeVector);
+    if (ok) {
+        ok = gam.InitialiseAndSetup();
+    }
+    //The stream starts at 5 ms (the first element after 4.9 ms), is off from 9.3 ms to 20 ms and then holds the last sample
+    uint32 times[] = { 2000u, 4000u, 6000u, 8000u, 10000u, 12000u, 22000u };
+    float64 expected[7][4] = { { 0., 0., 0., 0. }, { 0., 0., 0., 0.5 }, { 1., 1.5, 2., 2.5 }, { 3., 3.5, 4., 0. }, { 0., 0., 0., 0. }, { 0., 0.,
+            0., 0. }, { 9., 9., 9., 9. } };
+    for (uint32 c = 0u; (c < 7u) && (ok); c++) {
+        ok = gam.ExecuteAndCompare(times[c], &expected[c][0]);
+    }
+    if (ok) {
+        ok = gam.IsEndOfStream();
+    }
+    return ok;
+}
+
+bool WaveformStreamGAMTest::TestExecute_Prefetch() {
+    const uint32 numberOfSamples = 200u;
+    bool ok = WaveformStreamGAMTestWriteRamp(numberOfSamples);
+    WaveformStreamGAMTestHelper gam;
+    ok &= gam.config.Write("Filename", WAVEFORM_STREAM_TEST_FILE);
+    ok &= gam.config.Write("SamplingPeriod", 1e-3);
+    ok &= gam.config.Write("Element", 1);
+    ok &= gam.config.Write("BufferSize", 4);
+    ok &= gam.config.Write("NumberOfBuffers", 2);
+    if (ok) {
+        ok = gam.InitialiseAndSetup();
+    }
+    float64 expected[4];
+    //Two samples per cycle: the ring (8 samples) is refilled many times
+    for (uint32 c = 0u; (c < 102u) && (ok); c++) {
+        for (uint32 e = 0u; e < 4u; e++) {
+            float64 t = (c == 0u) ? (0.) : (static_cast<float64>(c - 1u) * 2. + static_cast<float64>(e) * 0.5);
+            float64 last = static_cast<float64>(numberOfSamples - 1u);
+            expected[e] = (t < last) ? (t) : (last);
+        }
+        ok = gam.ExecuteAndCompare(2000u * (c + 1u), &expected[0]);
+        Sleep::MSec(5u);
+    }
+    if (ok) {
+        ok = (gam.GetNumberOfUnderruns() == 0u);
+    }
+    if (ok) {
+        ok = gam.IsEndOfStream();
+    }
+    return ok;
+}
+
+bool WaveformStreamGAMTest::TestExecute_TimeNotIncreasing() {
+    uint32 times[] = { 1000u, 2000u, 2000u, 3000u };
+    float32 values[] = { 0.F, 10.F, 20.F, 30.F };
+    bool ok = WaveformStreamGAMTestWriteFile(true, 4u, &times[0], &values[0]);
+    WaveformStreamGAMTestHelper gam;
+    ok &= gam.config.Write("Filename", WAVEFORM_STREAM_TEST_FILE);
+    ok &= gam.config.Write("TimeSignal", "Time");
+    if (ok) {
+        ok = gam.InitialiseAndSetup();
+    }
+    float64 expected[3][4] = { { 0., 0., 0., 0. }, { 0., 5., 10., 10. }, { 10., 10., 10., 10. } };
+    for (uint32 c = 0u; (c < 3u) && (ok); c++) {
+        ok = gam.ExecuteAndCompare(2000u * (c + 1u), &expected[c][0]);
+    }
+    if (ok) {
+        ok = gam.IsEndOfStream();
+    }
+    return ok;
+}
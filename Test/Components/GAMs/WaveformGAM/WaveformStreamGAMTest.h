@@ -0,0 +1,240 @@
+/**
+ * @file WaveformStreamGAMTest.h
+ * @brief Header file for class WaveformStreamGAMTest
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class WaveformStreamGAMTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef WAVEFORMSTREAMGAMTEST_H_
+#define WAVEFORMSTREAMGAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "GAM.h"
+#include "StreamString.h"
+#include "WaveformStream.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+class WaveformStreamGAMTest {
+public:
+
+    /**
+     * @brief default constructor
+     */
+    WaveformStreamGAMTest();
+
+    /**
+     * @brief default destructor. Removes the test file.
+     */
+    virtual ~WaveformStreamGAMTest();
+
+    /**
+     * @brief Tests the WaveformStream::Initialise() with a TimeSignal.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that WaveformStream::Initialise() fails without Filename.
+     */
+    bool TestInitialise_MissingFilename();
+
+    /**
+     * @brief Tests that WaveformStream::Initialise() fails if the file does not exist.
+     */
+    bool TestInitialise_InvalidFilename();
+
+    /**
+     * @brief Tests that WaveformStream::Initialise() fails without TimeSignal and SamplingPeriod.
+     */
+    bool TestInitialise_MissingSamplingPeriod();
+
+    /**
+     * @brief Tests that WaveformStream::Initialise() fails if the Signal is not in the file.
+     */
+    bool TestInitialise_InvalidSignal();
+
+    /**
+     * @brief Tests that WaveformStream::Initialise() fails if the Element is not in the Signal.
+     */
+    bool TestInitialise_InvalidElement();
+
+    /**
+     * @brief Tests that WaveformStream::Initialise() fails with NumberOfBuffers < 2.
+     */
+    bool TestInitialise_InvalidNumberOfBuffers();
+
+    /**
+     * @brief Tests that WaveformStream::Initialise() fails with an invalid EOF.
+     */
+    bool TestInitialise_InvalidEOF();
+
+    /**
+     * @brief Tests that WaveformStream::Initialise() fails if the data is not a multiple of the row size.
+     */
+    bool TestInitialise_InvalidFileSize();
+
+    /**
+     * @brief Tests the WaveformStream::Execute() with equally spaced samples (SamplingPeriod) and an Element of an array.
+     */
+    bool TestExecute_SamplingPeriod();
+
+    /**
+     * @brief Tests the WaveformStream::Execute() with the TimeSignal (not equally spaced) and EOF = "Last".
+     */
+    bool TestExecute_TimeSignal();
+
+    /**
+     * @brief Tests the WaveformStream::Execute() with EOF = "Zero".
+     */
+    bool TestExecute_EOFZero();
+
+    /**
+     * @brief Tests that the stream starts at the first StartTriggerTime and that it advances while the output is off.
+     */
+    bool TestExecute_Trigger();
+
+    /**
+     * @brief Tests that the prefetch thread refills the ring when the file does not fit in the ring.
+     */
+    bool TestExecute_Prefetch();
+
+    /**
+     * @brief Tests that only the samples before a not increasing TimeSignal are streamed.
+     */
+    bool TestExecute_TimeNotIncreasing();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+class WaveformStreamGAMTestHelper: public WaveformStream {
+public:
+
+    WaveformStreamGAMTestHelper(uint32 elementsOut = 4u) {
+        numberOfElementsOut = elementsOut;
+    }
+
+    virtual ~WaveformStreamGAMTestHelper() {
+    }
+
+    /**
+     * @brief Configures one uint32 input (the time) and one float64 output with numberOfElementsOut elements.
+     */
+    bool InitialiseConfigDataBaseSignal() {
+        bool ok = true;
+        uint32 totalByteSizeIn = static_cast<uint32>(sizeof(uint32));
+        ok &= configSignals.Write("QualifiedName", "WaveformStreamTest");
+        ok &= configSignals.CreateAbsolute("Signals.InputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("QualifiedName", "InputSignal1");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.Write("Type", "uint32");
+        ok &= configSignals.Write("NumberOfDimensions", 1);
+        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("ByteSize", totalByteSizeIn);
+        ok &= configSignals.MoveToAncestor(1u);
+        ok &= configSignals.Write("ByteSize", totalByteSizeIn);
+
+        uint32 totalByteSizeOut = numberOfElementsOut * static_cast<uint32>(sizeof(float64));
+        ok &= configSignals.MoveToRoot();
+        ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("QualifiedName", "OutputSignal1");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.Write("Type", "float64");
+        ok &= configSignals.Write("NumberOfDimensions", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElementsOut);
+        ok &= configSignals.Write("ByteSize", totalByteSizeOut);
+        ok &= configSignals.MoveToAncestor(1u);
+        ok &= configSignals.Write("ByteSize", totalByteSizeOut);
+        ok &= configSignals.MoveToRoot();
+
+        ok &= configSignals.CreateAbsolute("Memory.InputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.CreateRelative("Signals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("Samples", 1);
+
+        ok &= configSignals.CreateAbsolute("Memory.OutputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.CreateRelative("Signals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("Samples", 1);
+        ok &= configSignals.MoveToRoot();
+        return ok;
+    }
+
+    /**
+     * @brief Initialises the GAM with the config and sets up the signals.
+     */
+    bool InitialiseAndSetup() {
+        SetName("Test");
+        bool ok = config.MoveToRoot();
+        ok &= Initialise(config);
+        ok &= InitialiseConfigDataBaseSignal();
+        ok &= SetConfiguredDatabase(configSignals);
+        ok &= AllocateInputSignalsMemory();
+        ok &= AllocateOutputSignalsMemory();
+        ok &= Setup();
+        return ok;
+    }
+
+    /**
+     * @brief Executes a cycle at the input time \a time (in us) and compares the output with \a expected.
+     */
+    bool ExecuteAndCompare(uint32 time,
+                           const float64 * const expected) {
+        uint32 *inputTime = static_cast<uint32 *>(GetInputSignalsMemory());
+        *inputTime = time;
+        bool ok = Execute();
+        float64 *output = static_cast<float64 *>(GetOutputSignalsMemory());
+        for (uint32 i = 0u; (i < numberOfElementsOut) && (ok); i++) {
+            ok = (fabs(output[i] - expected[i]) < 1e-9);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "At the time %u the element %u is %f instead of %f", time, i, output[i], expected[i]);
+            }
+        }
+        return ok;
+    }
+
+    ConfigurationDatabase configSignals;
+    ConfigurationDatabase config;
+    uint32 numberOfElementsOut;
+};
+
+}
+
+#endif /* WAVEFORMSTREAMGAMTEST_H_ */
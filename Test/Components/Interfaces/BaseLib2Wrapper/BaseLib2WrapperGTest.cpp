@@ -65,3 +65,8 @@ TEST(BaseLib2WrapperGTest,TestHandleBaseLib2Message) {
     BaseLib2WrapperTest test;
     ASSERT_TRUE(test.TestHandleBaseLib2Message());
 }
+
+TEST(BaseLib2WrapperGTest,TestHandleBaseLib2Message_MessagePool) {
+    BaseLib2WrapperTest test;
+    ASSERT_TRUE(test.TestHandleBaseLib2Message_MessagePool());
+}
@@ -32,14 +32,46 @@
 /*---------------------------------------------------------------------------*/
 #include "BaseLib2Wrapper.h"
 #include "BaseLib2WrapperTest.h"
+#include "CLASSMETHODREGISTER.h"
 #include "ConfigurationDatabase.h"
 #include "ObjectRegistryDatabase.h"
+#include "RegisteredMethodsMessageFilter.h"
 #include "StandardParser.h"
 #include "StateMachine.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Counts the messages received.
+ */
+class BaseLib2WrapperTestCounter: public Object, public MessageI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    BaseLib2WrapperTestCounter() :
+            Object(),
+            MessageI() {
+        counter = 0u;
+        ReferenceT<RegisteredMethodsMessageFilter> filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        filter->SetDestination(this);
+        (void) MessageI::InstallMessageFilter(filter);
+    }
+
+    virtual ~BaseLib2WrapperTestCounter() {
+    }
+
+    ErrorManagement::ErrorType Count() {
+        counter++;
+        return ErrorManagement::NoError;
+    }
+
+    uint32 counter;
+};
+CLASS_REGISTER(BaseLib2WrapperTestCounter, "1.0")
+CLASS_METHOD_REGISTER(BaseLib2WrapperTestCounter, Count)
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -328,3 +360,55 @@ bool BaseLib2WrapperTest::TestHandleBaseLib2Message() {
     return ok;
 }
 
+bool BaseLib2WrapperTest::TestHandleBaseLib2Message_MessagePool() {
+    using namespace MARTe;
+    const char8 * const config = ""
+            "+Counter = {"
+            "    Class = BaseLib2WrapperTestCounter"
+            "}"
+            "+BaseLib2Wrapper = {"
+            "    Class = BaseLib2Wrapper"
+            "    MessagePoolSize = 2"
+            "    BaseLib2Config = \""
+            "        +AdapterMessageHandler = {"
+            "            Class = AdapterMessageHandler"
+            "        }"
+            "    \""
+            "}";
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        ord->Purge();
+        ok = ord->Initialise(cdb);
+    }
+    ReferenceT<BaseLib2Wrapper> wrapper;
+    ReferenceT<BaseLib2WrapperTestCounter> counter;
+    if (ok) {
+        wrapper = ord->Find("BaseLib2Wrapper");
+        counter = ord->Find("Counter");
+        ok = (wrapper.IsValid() && counter.IsValid());
+    }
+    if (ok) {
+        ok = (wrapper->GetMessagePoolSize() == 2u);
+    }
+    uint32 i;
+    for (i = 0u; (i < 5u) && (ok); i++) {
+        ok = wrapper->HandleBaseLib2Message("Counter", "Count", 0u);
+    }
+    if (ok) {
+        ok = (counter->counter == 5u);
+    }
+    if (ok) {
+        //The first message is allocated, the other ones are reused.
+        ok = (wrapper->GetNumberOfReusedMessages() == 4u);
+    }
+    ord->Purge();
+    return ok;
+}
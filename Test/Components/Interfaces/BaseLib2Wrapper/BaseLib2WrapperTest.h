@@ -64,6 +64,11 @@ public:
      * @brief Tests the HandleBaseLib2Message method.
      */
     bool TestHandleBaseLib2Message();
+
+    /**
+     * @brief Tests that the HandleBaseLib2Message reuses the pooled messages.
+     */
+    bool TestHandleBaseLib2Message_MessagePool();
 };
 
 /*---------------------------------------------------------------------------*/
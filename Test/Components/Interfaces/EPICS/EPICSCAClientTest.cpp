@@ -109,6 +109,7 @@ bool EPICSCAClientTest::TestInitialise_NoDefaults() {
             "    Class = EPICSCAClient"
             "    CPUs = 0x1"
             "    StackSize = 327680"
+            "    PutQueue = 1"
             "    +PV_1 = {"
             "        Class = EPICSPV"
             "        PVName = \"MARTe2::EPICSCA::Test::String\""
@@ -152,6 +153,9 @@ bool EPICSCAClientTest::TestInitialise_NoDefaults() {
     if (ok) {
         ok = (client->GetStackSize() == 327680);
     }
+    if (ok) {
+        ok = (client->IsPutQueueEnabled());
+    }
     ord->Purge();
     return ok;
 }
@@ -270,6 +270,21 @@ TEST(EPICSPVGTest,TestHandlePVEvent_FunctionMap) {
     ASSERT_TRUE(test.TestHandlePVEvent_FunctionMap());
 }
 
+TEST(EPICSPVGTest,TestHandlePVEvent_Deadband) {
+    EPICSPVTest test;
+    ASSERT_TRUE(test.TestHandlePVEvent_Deadband());
+}
+
+TEST(EPICSPVGTest,TestHandlePVEvent_MinimumInterval) {
+    EPICSPVTest test;
+    ASSERT_TRUE(test.TestHandlePVEvent_MinimumInterval());
+}
+
+TEST(EPICSPVGTest,TestInitialise_False_Deadband_String) {
+    EPICSPVTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Deadband_String());
+}
+
 TEST(EPICSPVGTest,TestHandlePVEvent_FunctionMap_NoKey) {
     EPICSPVTest test;
     ASSERT_TRUE(test.TestHandlePVEvent_FunctionMap_NoKey());
@@ -425,6 +440,11 @@ TEST(EPICSPVGTest,TestCAPutRaw) {
     ASSERT_TRUE(test.TestCAPutRaw());
 }
 
+TEST(EPICSPVGTest,TestCAPutRaw_PutQueue) {
+    EPICSPVTest test;
+    ASSERT_TRUE(test.TestCAPutRaw_PutQueue());
+}
+
 TEST(EPICSPVGTest,TestGetAnyType) {
     EPICSPVTest test;
     ASSERT_TRUE(test.TestGetAnyType());
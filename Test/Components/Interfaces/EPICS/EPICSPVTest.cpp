@@ -797,6 +797,168 @@ bool EPICSPVTest::TestHandlePVEvent_Function_NoParameter_False() {
     return ok;
 }
 
+bool EPICSPVTest::TestHandlePVEvent_Deadband() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+PV_1 = {"
+            "    Class = EPICSPV"
+            "    PVName = PVS::PV1"
+            "    PVType = int32"
+            "    Event = {"
+            "        PVValue = Parameter"
+            "        Destination = AnObject"
+            "        Function = Handle_int32"
+            "        Deadband = 5"
+            "    }"
+            "}"
+            "+AnObject = {"
+            "    Class = EPICSPVTestHelper"
+            "}";
+
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ReferenceT<EPICSPVTestHelper> anObject;
+    ReferenceT<EPICSPV> aPV;
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    if (ok) {
+        aPV = ord->Find("PV_1");
+        ok = aPV.IsValid();
+    }
+    if (ok) {
+        anObject = ord->Find("AnObject");
+        ok = anObject.IsValid();
+    }
+    if (ok) {
+        ok = (aPV->GetDeadband() == 5.0);
+    }
+    int32 value = 0;
+    struct event_handler_args args;
+    args.dbr = reinterpret_cast<const void *>(&value);
+    args.count = 1;
+    if (ok) {
+        //Initial value
+        aPV->HandlePVEvent(args);
+        value = 10;
+        aPV->HandlePVEvent(args);
+        ok = (anObject->int32Value == 10);
+    }
+    if (ok) {
+        value = 12;
+        aPV->HandlePVEvent(args);
+        ok = (anObject->int32Value == 10);
+    }
+    if (ok) {
+        value = 20;
+        aPV->HandlePVEvent(args);
+        ok = (anObject->int32Value == 20);
+    }
+    if (ok) {
+        ok = (aPV->GetNumberOfDroppedEvents() == 1u);
+    }
+    ord->Purge();
+    return ok;
+}
+
+bool EPICSPVTest::TestHandlePVEvent_MinimumInterval() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+PV_1 = {"
+            "    Class = EPICSPV"
+            "    PVName = PVS::PV1"
+            "    PVType = int32"
+            "    Event = {"
+            "        PVValue = Parameter"
+            "        Destination = AnObject"
+            "        Function = Handle_int32"
+            "        MinimumInterval = 0.2"
+            "    }"
+            "}"
+            "+AnObject = {"
+            "    Class = EPICSPVTestHelper"
+            "}";
+
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ReferenceT<EPICSPVTestHelper> anObject;
+    ReferenceT<EPICSPV> aPV;
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    if (ok) {
+        aPV = ord->Find("PV_1");
+        ok = aPV.IsValid();
+    }
+    if (ok) {
+        anObject = ord->Find("AnObject");
+        ok = anObject.IsValid();
+    }
+    if (ok) {
+        ok = (aPV->GetMinimumInterval() == 0.2);
+    }
+    int32 value = 0;
+    struct event_handler_args args;
+    args.dbr = reinterpret_cast<const void *>(&value);
+    args.count = 1;
+    if (ok) {
+        //Initial value
+        aPV->HandlePVEvent(args);
+        value = 1;
+        aPV->HandlePVEvent(args);
+        ok = (anObject->int32Value == 1);
+    }
+    if (ok) {
+        //Held
+        value = 2;
+        aPV->HandlePVEvent(args);
+        value = 3;
+        aPV->HandlePVEvent(args);
+        ok = (anObject->int32Value == 1);
+    }
+    if (ok) {
+        ok = (aPV->GetNumberOfCoalescedEvents() == 1u);
+    }
+    if (ok) {
+        ok = !aPV->FlushPendingEvent();
+    }
+    if (ok) {
+        Sleep::Sec(0.3);
+        ok = aPV->FlushPendingEvent();
+    }
+    if (ok) {
+        ok = (anObject->int32Value == 3);
+    }
+    if (ok) {
+        ok = !aPV->FlushPendingEvent();
+    }
+    ord->Purge();
+    return ok;
+}
+
+bool EPICSPVTest::TestInitialise_False_Deadband_String() {
+    using namespace MARTe;
+    EPICSPV pv;
+    ConfigurationDatabase cdb;
+    cdb.Write("PVName", "PVONED");
+    cdb.Write("PVType", "string");
+    cdb.CreateRelative("Event");
+    cdb.Write("PVValue", "Parameter");
+    cdb.Write("Destination", "AnObject");
+    cdb.Write("Function", "Handle_string");
+    cdb.Write("Deadband", 1.0);
+    cdb.MoveToRoot();
+    return !pv.Initialise(cdb);
+}
+
 bool EPICSPVTest::TestHandlePVEvent_FunctionMap() {
     using namespace MARTe;
     EPICSPV pv;
@@ -1619,6 +1781,85 @@ bool EPICSPVTest::TestCAPutRaw() {
     return ok;
 }
 
+bool EPICSPVTest::TestCAPutRaw_PutQueue() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+EPICSCA = {"
+            "    Class = EPICSCAClient"
+            "    PutQueue = 1"
+            "    +PV_1 = {"
+            "        Class = EPICSPV"
+            "        PVType = uint32"
+            "        PVName = MARTe2::EPICSCA::Test::uint32"
+            "    }"
+            "}"
+            "+TestCAPut = {"
+            "    Class = EPICSPVTestCAPut"
+            "}";
+
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ReferenceT<EPICSPV> aPV;
+    ReferenceT<EPICSPVTestCAPut> testCAPut;
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    if (ok) {
+        aPV = ord->Find("EPICSCA.PV_1");
+        ok = aPV.IsValid();
+    }
+    if (ok) {
+        testCAPut = ord->Find("TestCAPut");
+        ok = testCAPut.IsValid();
+    }
+    if (ok) {
+        uint32 timeoutCounts = 50;
+        uint32 i = 0u;
+        uint32 testValue = 88u;
+        ok = false;
+        while ((i < timeoutCounts) && (!ok)) {
+            ok = (testCAPut->TestCAPutRaw(testValue) == ErrorManagement::NoError);
+            if (!ok) {
+                Sleep::Sec(0.1);
+                i++;
+            }
+        }
+    }
+    if (ok) {
+        //Queue several values. At least the last one is written.
+        uint32 testValue;
+        for (testValue = 90u; (testValue < 100u) && (ok); testValue++) {
+            *static_cast<uint32 *>(aPV->GetAnyType().GetDataPointer()) = testValue;
+            ok = (aPV->CAPutRaw() == ErrorManagement::NoError);
+        }
+    }
+    if (ok) {
+        uint32 timeoutCounts = 50;
+        uint32 i = 0u;
+        ok = false;
+        while ((i < timeoutCounts) && (!ok)) {
+            uint32 value = *static_cast<uint32 *>(aPV->GetAnyType().GetDataPointer());
+            ok = (value == 99u);
+            if (!ok) {
+                Sleep::Sec(0.1);
+                i++;
+            }
+        }
+    }
+    if (ok) {
+        ok = (aPV->GetNumberOfCompletedPuts() > 0u);
+        ok &= (aPV->GetNumberOfCompletedPuts() <= 11u);
+        ok &= (aPV->GetNumberOfFailedPuts() == 0u);
+    }
+
+    ord->Purge();
+    return ok;
+}
+
 bool EPICSPVTest::TestGetAnyType() {
     using namespace MARTe;
     EPICSPV pv;
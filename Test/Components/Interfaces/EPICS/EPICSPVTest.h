@@ -228,6 +228,21 @@ public:
      */
     bool TestHandlePVEvent_FunctionMap_NoKey();
 
+    /**
+     * @brief Tests that the HandlePVEvent drops the value changes within the Deadband.
+     */
+    bool TestHandlePVEvent_Deadband();
+
+    /**
+     * @brief Tests that the HandlePVEvent holds the value changes within the MinimumInterval and that FlushPendingEvent sends the latest.
+     */
+    bool TestHandlePVEvent_MinimumInterval();
+
+    /**
+     * @brief Tests that the Initialise fails if the Deadband is set on a string PV.
+     */
+    bool TestInitialise_False_Deadband_String();
+
     /**
      * @brief Tests the HandlePVEvent method calling a function with an int16 parameter.
      */
@@ -433,6 +448,11 @@ public:
      */
     bool TestCAPutRaw();
 
+    /**
+     * @brief Tests the CAPutRaw method with the puts queued in the EPICSCAClient.
+     */
+    bool TestCAPutRaw_PutQueue();
+
     /**
      * @brief Tests the GetAnyType method.
      */
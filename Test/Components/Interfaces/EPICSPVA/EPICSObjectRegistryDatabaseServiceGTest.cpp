@@ -52,3 +52,18 @@ TEST(EPICSObjectRegistryDatabaseServiceGTest,TestConsumeMessage) {
 
 
 	
+
+TEST(EPICSObjectRegistryDatabaseServiceGTest,Testrequest_Paged) {
+    EPICSObjectRegistryDatabaseServiceTest test;
+    ASSERT_TRUE(test.Testrequest_Paged());
+}
+
+TEST(EPICSObjectRegistryDatabaseServiceGTest,Testrequest_PathDepth) {
+    EPICSObjectRegistryDatabaseServiceTest test;
+    ASSERT_TRUE(test.Testrequest_PathDepth());
+}
+
+TEST(EPICSObjectRegistryDatabaseServiceGTest,Testrequest_SinceGeneration) {
+    EPICSObjectRegistryDatabaseServiceTest test;
+    ASSERT_TRUE(test.Testrequest_SinceGeneration());
+}
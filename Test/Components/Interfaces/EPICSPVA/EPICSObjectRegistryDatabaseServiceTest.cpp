@@ -40,6 +40,54 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+static bool EPICSObjectRegistryDatabaseServiceTestLoad() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+App = {"
+            "    Class = ReferenceContainer"
+            "    +A = {"
+            "        Class = ReferenceContainer"
+            "        +A1 = {"
+            "            Class = ReferenceContainer"
+            "        }"
+            "        +A2 = {"
+            "            Class = ReferenceContainer"
+            "        }"
+            "    }"
+            "    +B = {"
+            "        Class = ReferenceContainer"
+            "    }"
+            "}";
+    ConfigurationDatabase cdb;
+    config.Seek(0LLU);
+    StandardParser parser(config, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        cdb.MoveToRoot();
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    return ok;
+}
+
+static epics::pvData::PVStructurePtr EPICSObjectRegistryDatabaseServiceTestArgs(const char * const path,
+                                                                               const MARTe::uint32 depth,
+                                                                               const MARTe::uint32 pageSize,
+                                                                               const MARTe::uint32 pageToken,
+                                                                               const MARTe::uint64 sinceGeneration) {
+    epics::pvData::FieldBuilderPtr fieldBuilder = epics::pvData::getFieldCreate()->createFieldBuilder();
+    fieldBuilder = fieldBuilder->add("path", epics::pvData::pvString);
+    fieldBuilder = fieldBuilder->add("depth", epics::pvData::pvUInt);
+    fieldBuilder = fieldBuilder->add("pageSize", epics::pvData::pvUInt);
+    fieldBuilder = fieldBuilder->add("pageToken", epics::pvData::pvUInt);
+    fieldBuilder = fieldBuilder->add("sinceGeneration", epics::pvData::pvULong);
+    epics::pvData::PVStructurePtr args(epics::pvData::getPVDataCreate()->createPVStructure(fieldBuilder->createStructure()));
+    args->getSubField<epics::pvData::PVString>("path")->put(path);
+    args->getSubField<epics::pvData::PVUInt>("depth")->put(depth);
+    args->getSubField<epics::pvData::PVUInt>("pageSize")->put(pageSize);
+    args->getSubField<epics::pvData::PVUInt>("pageToken")->put(pageToken);
+    args->getSubField<epics::pvData::PVULong>("sinceGeneration")->put(sinceGeneration);
+    return args;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -113,3 +161,106 @@ bool EPICSObjectRegistryDatabaseServiceTest::Testrequest() {
     ObjectRegistryDatabase::Instance()->Purge();
     return ok;
 }
+
+bool EPICSObjectRegistryDatabaseServiceTest::Testrequest_Paged() {
+    using namespace MARTe;
+    EPICSObjectRegistryDatabaseService service;
+    bool ok = EPICSObjectRegistryDatabaseServiceTestLoad();
+    uint32 pageToken = 0u;
+    uint32 nOfPages = 0u;
+    std::string allPaths;
+    while (ok) {
+        epics::pvData::PVStructurePtr reply = service.request(EPICSObjectRegistryDatabaseServiceTestArgs("", 0u, 2u, pageToken, 0u));
+        epics::pvData::PVStringArrayPtr paths = reply->getSubField<epics::pvData::PVStringArray>("path");
+        ok = (paths->getLength() <= 2u);
+        epics::pvData::PVStringArray::const_svector pathsData = paths->view();
+        for (uint32 i = 0u; i < pathsData.size(); i++) {
+            allPaths += pathsData[i];
+            allPaths += ";";
+        }
+        nOfPages++;
+        pageToken = reply->getSubField<epics::pvData::PVUInt>("nextPageToken")->get();
+        if (pageToken == 0u) {
+            break;
+        }
+    }
+    if (ok) {
+        ok = (nOfPages == 3u);
+    }
+    if (ok) {
+        ok = (allPaths == "App;App.A;App.A.A1;App.A.A2;App.B;");
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool EPICSObjectRegistryDatabaseServiceTest::Testrequest_PathDepth() {
+    using namespace MARTe;
+    EPICSObjectRegistryDatabaseService service;
+    bool ok = EPICSObjectRegistryDatabaseServiceTestLoad();
+    if (ok) {
+        epics::pvData::PVStructurePtr reply = service.request(EPICSObjectRegistryDatabaseServiceTestArgs("App", 1u, 0u, 0u, 0u));
+        epics::pvData::PVStringArray::const_svector paths = reply->getSubField<epics::pvData::PVStringArray>("path")->view();
+        epics::pvData::PVStringArray::const_svector classes = reply->getSubField<epics::pvData::PVStringArray>("class")->view();
+        ok = (paths.size() == 2u) && (classes.size() == 2u);
+        if (ok) {
+            ok = (paths[0] == "App.A") && (paths[1] == "App.B");
+        }
+        if (ok) {
+            ok = (classes[0] == "ReferenceContainer");
+        }
+        if (ok) {
+            ok = (reply->getSubField<epics::pvData::PVUInt>("nextPageToken")->get() == 0u);
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool EPICSObjectRegistryDatabaseServiceTest::Testrequest_SinceGeneration() {
+    using namespace MARTe;
+    EPICSObjectRegistryDatabaseService service;
+    bool ok = EPICSObjectRegistryDatabaseServiceTestLoad();
+    uint64 generation = 0u;
+    if (ok) {
+        epics::pvData::PVStructurePtr reply = service.request(EPICSObjectRegistryDatabaseServiceTestArgs("", 0u, 0u, 0u, 0u));
+        generation = reply->getSubField<epics::pvData::PVULong>("generation")->get();
+        ok = (generation > 0u);
+    }
+    if (ok) {
+        //Nothing changed
+        epics::pvData::PVStructurePtr reply = service.request(EPICSObjectRegistryDatabaseServiceTestArgs("", 0u, 0u, 0u, generation));
+        ok = (reply->getSubField<epics::pvData::PVULong>("generation")->get() == generation);
+        if (ok) {
+            ok = (reply->getSubField<epics::pvData::PVStringArray>("path")->getLength() == 0u);
+        }
+    }
+    ReferenceT<ReferenceContainer> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("App");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ReferenceT<ReferenceContainer> c(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        c->SetName("C");
+        ok = app->Insert(c);
+    }
+    if (ok) {
+        ReferenceT<ReferenceContainer> b = app->Find("B");
+        ok = app->Delete(b);
+    }
+    if (ok) {
+        epics::pvData::PVStructurePtr reply = service.request(EPICSObjectRegistryDatabaseServiceTestArgs("", 0u, 0u, 0u, generation));
+        ok = (reply->getSubField<epics::pvData::PVULong>("generation")->get() > generation);
+        epics::pvData::PVStringArray::const_svector paths = reply->getSubField<epics::pvData::PVStringArray>("path")->view();
+        epics::pvData::PVStringArray::const_svector removedPaths = reply->getSubField<epics::pvData::PVStringArray>("removed")->view();
+        if (ok) {
+            ok = (paths.size() == 1u) && (removedPaths.size() == 1u);
+        }
+        if (ok) {
+            ok = (paths[0] == "App.C") && (removedPaths[0] == "App.B");
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
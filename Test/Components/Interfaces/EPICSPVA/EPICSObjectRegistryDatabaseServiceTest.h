@@ -52,6 +52,21 @@ public:
      * @brief Tests the request message method.
      */
     bool Testrequest();
+
+    /**
+     * @brief Tests the request method with the tree exported in pages.
+     */
+    bool Testrequest_Paged();
+
+    /**
+     * @brief Tests the request method with the path and depth arguments.
+     */
+    bool Testrequest_PathDepth();
+
+    /**
+     * @brief Tests the request method with the sinceGeneration argument.
+     */
+    bool Testrequest_SinceGeneration();
 };
 
 
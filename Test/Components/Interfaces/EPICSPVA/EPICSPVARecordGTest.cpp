@@ -88,3 +88,28 @@ TEST(EPICSPVARecordGTest,TestGetRecordName) {
     EPICSPVARecordTest test;
     ASSERT_TRUE(test.TestGetRecordName());
 }
+
+TEST(EPICSPVARecordGTest,TestUpdateFields) {
+    EPICSPVARecordTest test;
+    ASSERT_TRUE(test.TestUpdateFields());
+}
+
+TEST(EPICSPVARecordGTest,TestUpdateFields_False_NoRecord) {
+    EPICSPVARecordTest test;
+    ASSERT_TRUE(test.TestUpdateFields_False_NoRecord());
+}
+
+TEST(EPICSPVARecordGTest,TestUpdateFields_MaxUpdateRate) {
+    EPICSPVARecordTest test;
+    ASSERT_TRUE(test.TestUpdateFields_MaxUpdateRate());
+}
+
+TEST(EPICSPVARecordGTest,TestFlushUpdates) {
+    EPICSPVARecordTest test;
+    ASSERT_TRUE(test.TestFlushUpdates());
+}
+
+TEST(EPICSPVARecordGTest,TestInitialise_False_MaxUpdateRate) {
+    EPICSPVARecordTest test;
+    ASSERT_TRUE(test.TestInitialise_False_MaxUpdateRate());
+}
@@ -226,3 +226,148 @@ bool EPICSPVARecordTest::TestGetRecordName() {
     return ok;
 }
 
+bool EPICSPVARecordTest::TestUpdateFields() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.CreateAbsolute("Structure.B");
+    cdb.Write("Type", "uint32");
+    cdb.Write("NumberOfElements", 1);
+    cdb.CreateAbsolute("Structure.C");
+    cdb.Write("Type", "float32");
+    cdb.Write("NumberOfElements", 1);
+    cdb.MoveToRoot();
+    EPICSPVARecord pvaRecord;
+    pvaRecord.SetName("EPICSPVARecordTestTestUpdateFields");
+    bool ok = pvaRecord.Initialise(cdb);
+    epics::pvDatabase::PVRecordPtr pvRecord;
+    if (ok) {
+        pvRecord = pvaRecord.CreatePVRecord();
+        ok = (pvRecord ? true : false);
+    }
+    if (ok) {
+        ConfigurationDatabase values;
+        values.Write("B", 7u);
+        values.Write("C", 2.5F);
+        ok = pvaRecord.UpdateFields(values);
+    }
+    if (ok) {
+        ok = (pvRecord->getPVStructure()->getSubField<epics::pvData::PVUInt>("B")->get() == 7u);
+    }
+    if (ok) {
+        ok = (pvRecord->getPVStructure()->getSubField<epics::pvData::PVFloat>("C")->get() == 2.5F);
+    }
+    if (ok) {
+        ok = (pvaRecord.GetNumberOfUpdates() == 1u);
+    }
+    if (ok) {
+        //Only B
+        ConfigurationDatabase values;
+        values.Write("B", 8u);
+        ok = pvaRecord.UpdateFields(values);
+    }
+    if (ok) {
+        ok = (pvRecord->getPVStructure()->getSubField<epics::pvData::PVUInt>("B")->get() == 8u);
+    }
+    if (ok) {
+        ok = (pvRecord->getPVStructure()->getSubField<epics::pvData::PVFloat>("C")->get() == 2.5F);
+    }
+    if (ok) {
+        ok = (pvaRecord.GetNumberOfUpdates() == 2u);
+    }
+    if (ok) {
+        ok = (pvaRecord.GetNumberOfCoalescedUpdates() == 0u);
+    }
+    return ok;
+}
+
+bool EPICSPVARecordTest::TestUpdateFields_False_NoRecord() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.CreateAbsolute("Structure.B");
+    cdb.Write("Type", "uint32");
+    cdb.Write("NumberOfElements", 1);
+    cdb.MoveToRoot();
+    EPICSPVARecord pvaRecord;
+    pvaRecord.SetName("EPICSPVARecordTestTestUpdateFields_False_NoRecord");
+    bool ok = pvaRecord.Initialise(cdb);
+    if (ok) {
+        ConfigurationDatabase values;
+        values.Write("B", 7u);
+        ok = !pvaRecord.UpdateFields(values);
+    }
+    if (ok) {
+        ok = !pvaRecord.FlushUpdates();
+    }
+    return ok;
+}
+
+bool EPICSPVARecordTest::TestUpdateFields_MaxUpdateRate() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("MaxUpdateRate", 0.001);
+    cdb.CreateAbsolute("Structure.B");
+    cdb.Write("Type", "uint32");
+    cdb.Write("NumberOfElements", 1);
+    cdb.MoveToRoot();
+    EPICSPVARecord pvaRecord;
+    pvaRecord.SetName("EPICSPVARecordTestTestUpdateFields_MaxUpdateRate");
+    bool ok = pvaRecord.Initialise(cdb);
+    epics::pvDatabase::PVRecordPtr pvRecord;
+    if (ok) {
+        ok = (pvaRecord.GetMaxUpdateRate() == 0.001);
+    }
+    if (ok) {
+        pvRecord = pvaRecord.CreatePVRecord();
+        ok = (pvRecord ? true : false);
+    }
+    if (ok) {
+        ConfigurationDatabase values;
+        values.Write("B", 1u);
+        ok = pvaRecord.UpdateFields(values);
+    }
+    if (ok) {
+        ok = (pvRecord->getPVStructure()->getSubField<epics::pvData::PVUInt>("B")->get() == 1u);
+    }
+    uint32 i;
+    for (i = 2u; (i < 5u) && (ok); i++) {
+        ConfigurationDatabase values;
+        values.Write("B", i);
+        ok = pvaRecord.UpdateFields(values);
+    }
+    if (ok) {
+        ok = (pvRecord->getPVStructure()->getSubField<epics::pvData::PVUInt>("B")->get() == 1u);
+    }
+    if (ok) {
+        ok = (pvaRecord.GetNumberOfUpdates() == 1u);
+    }
+    if (ok) {
+        ok = (pvaRecord.GetNumberOfCoalescedUpdates() == 3u);
+    }
+    if (ok) {
+        ok = pvaRecord.FlushUpdates();
+    }
+    if (ok) {
+        ok = (pvRecord->getPVStructure()->getSubField<epics::pvData::PVUInt>("B")->get() == 4u);
+    }
+    if (ok) {
+        ok = (pvaRecord.GetNumberOfUpdates() == 2u);
+    }
+    return ok;
+}
+
+bool EPICSPVARecordTest::TestFlushUpdates() {
+    return TestUpdateFields_MaxUpdateRate();
+}
+
+bool EPICSPVARecordTest::TestInitialise_False_MaxUpdateRate() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("MaxUpdateRate", -1.0);
+    cdb.CreateAbsolute("Structure.B");
+    cdb.Write("Type", "uint32");
+    cdb.Write("NumberOfElements", 1);
+    cdb.MoveToRoot();
+    EPICSPVARecord pvaRecord;
+    pvaRecord.SetName("EPICSPVARecordTestTestInitialise_False_MaxUpdateRate");
+    return !pvaRecord.Initialise(cdb);
+}
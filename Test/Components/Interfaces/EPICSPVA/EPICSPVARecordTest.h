@@ -91,6 +91,31 @@ public:
      * @brief Test the GetRecordName method.
      */
     bool TestGetRecordName();
+
+    /**
+     * @brief Tests the UpdateFields method.
+     */
+    bool TestUpdateFields();
+
+    /**
+     * @brief Tests that the UpdateFields method fails if CreatePVRecord was not called.
+     */
+    bool TestUpdateFields_False_NoRecord();
+
+    /**
+     * @brief Tests that the UpdateFields method coalesces the updates which exceed the MaxUpdateRate.
+     */
+    bool TestUpdateFields_MaxUpdateRate();
+
+    /**
+     * @brief Tests the FlushUpdates method.
+     */
+    bool TestFlushUpdates();
+
+    /**
+     * @brief Tests that the Initialise method fails if MaxUpdateRate < 0.
+     */
+    bool TestInitialise_False_MaxUpdateRate();
 };
 
 
@@ -529,6 +529,11 @@ TEST(EPICSPVAStructureDataIGTest,TestMoveToChild) {
     ASSERT_TRUE(test.TestMoveToChild());
 }
 
+TEST(EPICSPVAStructureDataIGTest,TestRead_SameNameDifferentNodes) {
+    EPICSPVAStructureDataITest test;
+    ASSERT_TRUE(test.TestRead_SameNameDifferentNodes());
+}
+
 TEST(EPICSPVAStructureDataIGTest,TestCreateAbsolute) {
     EPICSPVAStructureDataITest test;
     ASSERT_TRUE(test.TestCreateAbsolute());
@@ -1501,6 +1501,68 @@ bool EPICSPVAStructureDataITest::TestMoveToChild() {
     return ok;
 }
 
+bool EPICSPVAStructureDataITest::TestRead_SameNameDifferentNodes() {
+    using namespace MARTe;
+    EPICSPVAStructureDataI test;
+    test.InitStructure();
+    test.CreateAbsolute("A");
+    test.Write("V", static_cast<uint32>(1u));
+    test.Write("W", static_cast<uint32>(10u));
+    test.CreateAbsolute("B");
+    test.Write("V", static_cast<uint32>(2u));
+    bool ok = test.FinaliseStructure();
+    uint32 value = 0u;
+    if (ok) {
+        ok = test.MoveAbsolute("A");
+    }
+    if (ok) {
+        ok = test.Read("V", value);
+    }
+    if (ok) {
+        ok = (value == 1u);
+    }
+    if (ok) {
+        ok = test.Read("W", value);
+    }
+    if (ok) {
+        ok = (value == 10u);
+    }
+    if (ok) {
+        ok = test.MoveAbsolute("B");
+    }
+    if (ok) {
+        ok = test.Read("V", value);
+    }
+    if (ok) {
+        ok = (value == 2u);
+    }
+    if (ok) {
+        ok = test.Write("V", static_cast<uint32>(3u));
+    }
+    if (ok) {
+        ok = test.MoveAbsolute("A");
+    }
+    if (ok) {
+        ok = test.Read("V", value);
+    }
+    if (ok) {
+        ok = (value == 1u);
+    }
+    if (ok) {
+        ok = test.MoveAbsolute("B");
+    }
+    if (ok) {
+        ok = test.Read("V", value);
+    }
+    if (ok) {
+        ok = (value == 3u);
+    }
+    if (ok) {
+        ok = !test.Read("W", value);
+    }
+    return ok;
+}
+
 bool EPICSPVAStructureDataITest::TestCreateAbsolute() {
     using namespace MARTe;
     EPICSPVAStructureDataI test;
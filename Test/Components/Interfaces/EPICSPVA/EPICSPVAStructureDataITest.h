@@ -538,6 +538,11 @@ public:
      */
     bool TestMoveToChild();
 
+    /**
+     * @brief Tests that fields with the same name in different nodes are correctly read and written (i.e. that the field cache follows the current node).
+     */
+    bool TestRead_SameNameDifferentNodes();
+
     /**
      * @brief Tests the CreateAbsolute method.
      */
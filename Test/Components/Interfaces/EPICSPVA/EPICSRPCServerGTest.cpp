@@ -54,6 +54,16 @@ TEST(EPICSRPCServerGTest,TestInitialise_Defaults) {
     ASSERT_TRUE(test.TestInitialise_Defaults());
 }
 
+TEST(EPICSRPCServerGTest,TestInitialise_Workers) {
+    EPICSRPCServerTest test;
+    ASSERT_TRUE(test.TestInitialise_Workers());
+}
+
+TEST(EPICSRPCServerGTest,TestExecute_Workers) {
+    EPICSRPCServerTest test;
+    ASSERT_TRUE(test.TestExecute_Workers());
+}
+
 TEST(EPICSRPCServerGTest,TestStart) {
     EPICSRPCServerTest test;
     ASSERT_TRUE(test.TestStart());
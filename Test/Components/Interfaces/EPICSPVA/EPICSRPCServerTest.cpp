@@ -85,6 +85,40 @@ bool EPICSRPCServerTest::TestInitialise_Defaults() {
     return ok;
 }
 
+bool EPICSRPCServerTest::TestInitialise_Workers() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+EPICSRPCServer = {"
+            "    Class = EPICSPVA::EPICSRPCServer"
+            "    AutoStart = 0"
+            "    NumberOfWorkers = 2"
+            "    +EPICSObjectRegistryDatabaseService = {"
+            "        Class = EPICSPVA::EPICSObjectRegistryDatabaseService"
+            "        MaxConcurrentRequests = 1"
+            "    }"
+            "}";
+
+    ConfigurationDatabase cdb;
+    config.Seek(0LLU);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+    if (ok) {
+        cdb.MoveToRoot();
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<EPICSRPCServer> rpcServer;
+    if (ok) {
+        rpcServer = ObjectRegistryDatabase::Instance()->Find("EPICSRPCServer");
+        ok = rpcServer.IsValid();
+    }
+    if (ok) {
+        ok = (rpcServer->GetNumberOfWorkers() == 2u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
 bool EPICSRPCServerTest::TestStart() {
     using namespace MARTe;
     EPICSRPCServer rpcServer;
@@ -164,6 +198,72 @@ bool EPICSRPCServerTest::TestExecute() {
     return ok;
 }
 
+bool EPICSRPCServerTest::TestExecute_Workers() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+EPICSRPCServer = {"
+            "    Class = EPICSPVA::EPICSRPCServer"
+            "    NumberOfWorkers = 2"
+            "    +EPICSObjectRegistryDatabaseService = {"
+            "        Class = EPICSPVA::EPICSObjectRegistryDatabaseService"
+            "        MaxConcurrentRequests = 1"
+            "    }"
+            "}"
+            "+EPICSRPCClient = {"
+            "    Class = EPICSPVA::EPICSRPCClient"
+            "}";
+
+    ConfigurationDatabase cdb;
+    config.Seek(0LLU);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+    if (ok) {
+        cdb.MoveToRoot();
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    if (ok) {
+        ReferenceT<Message> msgStart(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ConfigurationDatabase msgConfig;
+        msgStart->SetName("EPICSRPCServerStart");
+        msgConfig.Write("Destination", "EPICSRPCServer");
+        msgConfig.Write("Function", "Start");
+        msgStart->Initialise(msgConfig);
+        MessageI::SendMessage(msgStart);
+    }
+    if (ok) {
+        ReferenceT<Message> msgStart(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ConfigurationDatabase msgConfig;
+        msgStart->SetName("EPICSRPCClientStart");
+        msgConfig.Write("Destination", "EPICSRPCClient");
+        msgConfig.Write("Function", "Start");
+        msgStart->Initialise(msgConfig);
+        MessageI::SendMessage(msgStart);
+    }
+    ReferenceT<Message> msg(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    if (ok) {
+        ConfigurationDatabase msgConfig;
+        msg->SetName("EPICSObjectRegistryDatabaseService");
+        msgConfig.Write("Destination", "EPICSRPCClient");
+        msgConfig.Write("Function", "");
+        msg->Initialise(msgConfig);
+        msg->SetExpectsReply(true);
+        Object notReallyUsed;
+        ok = MessageI::SendMessageAndWaitReply(msg, &notReallyUsed);
+    }
+    ReferenceT<StructuredDataI> replyStruct;
+    if (ok) {
+        replyStruct = msg->Get(0u);
+        ok = replyStruct.IsValid();
+    }
+    if (ok) {
+        ok = replyStruct->MoveAbsolute("EPICSRPCServer.EPICSObjectRegistryDatabaseService");
+    }
+    Sleep::Sec(0.5);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
 bool EPICSRPCServerTest::TestGetStatus() {
     return TestInitialise();
 }
@@ -57,6 +57,16 @@ public:
      */
     bool TestInitialise_Defaults();
 
+    /**
+     * @brief Tests the Initialise with NumberOfWorkers and MaxConcurrentRequests.
+     */
+    bool TestInitialise_Workers();
+
+    /**
+     * @brief Tests the Execute method with the requests executed by a pool of workers.
+     */
+    bool TestExecute_Workers();
+
     /**
      * @brief Tests the Start method.
      */
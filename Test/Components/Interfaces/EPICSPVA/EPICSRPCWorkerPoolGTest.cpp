@@ -0,0 +1,81 @@
+/**
+ * @file EPICSRPCWorkerPoolGTest.cpp
+ * @brief Source file for class EPICSRPCWorkerPoolGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class EPICSRPCWorkerPoolGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "EPICSRPCWorkerPoolTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(EPICSRPCWorkerPoolGTest,TestConstructor) {
+    EPICSRPCWorkerPoolTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(EPICSRPCWorkerPoolGTest,TestSetNumberOfServices) {
+    EPICSRPCWorkerPoolTest test;
+    ASSERT_TRUE(test.TestSetNumberOfServices());
+}
+
+TEST(EPICSRPCWorkerPoolGTest,TestSetService) {
+    EPICSRPCWorkerPoolTest test;
+    ASSERT_TRUE(test.TestSetService());
+}
+
+TEST(EPICSRPCWorkerPoolGTest,TestSetService_InvalidIndex) {
+    EPICSRPCWorkerPoolTest test;
+    ASSERT_TRUE(test.TestSetService_InvalidIndex());
+}
+
+TEST(EPICSRPCWorkerPoolGTest,TestEnqueue) {
+    EPICSRPCWorkerPoolTest test;
+    ASSERT_TRUE(test.TestEnqueue());
+}
+
+TEST(EPICSRPCWorkerPoolGTest,TestEnqueue_NotStarted) {
+    EPICSRPCWorkerPoolTest test;
+    ASSERT_TRUE(test.TestEnqueue_NotStarted());
+}
+
+TEST(EPICSRPCWorkerPoolGTest,TestExecute_MaxConcurrentRequests) {
+    EPICSRPCWorkerPoolTest test;
+    ASSERT_TRUE(test.TestExecute_MaxConcurrentRequests());
+}
+
+TEST(EPICSRPCWorkerPoolGTest,TestStop) {
+    EPICSRPCWorkerPoolTest test;
+    ASSERT_TRUE(test.TestStop());
+}
@@ -0,0 +1,242 @@
+/**
+ * @file EPICSRPCWorkerPoolTest.cpp
+ * @brief Source file for class EPICSRPCWorkerPoolTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class EPICSRPCWorkerPoolTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "EPICSRPCWorkerPool.h"
+#include "EPICSRPCWorkerPoolTest.h"
+#include "FastPollingMutexSem.h"
+#include "Object.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Service which sleeps the configured time.
+ */
+class EPICSRPCWorkerPoolTestService: public Object, public EPICSRPCService {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    EPICSRPCWorkerPoolTestService() :
+            Object(),
+            EPICSRPCService() {
+        sleepTime = 0.F;
+    }
+
+    virtual ~EPICSRPCWorkerPoolTestService() {
+    }
+
+    virtual epics::pvData::PVStructurePtr request(epics::pvData::PVStructure::shared_pointer const & args) {
+        Sleep::Sec(sleepTime);
+        return args;
+    }
+
+    float32 sleepTime;
+};
+CLASS_REGISTER(EPICSRPCWorkerPoolTestService, "1.0")
+
+/**
+ * @brief Records the order in which the replies are received.
+ */
+class EPICSRPCWorkerPoolTestCallback: public epics::pvAccess::RPCResponseCallback {
+public:
+    EPICSRPCWorkerPoolTestCallback(FastPollingMutexSem &muxIn,
+                                   uint32 &counterIn) :
+            epics::pvAccess::RPCResponseCallback(),
+            mux(muxIn),
+            counter(counterIn) {
+        order = 0u;
+        replied = false;
+        success = false;
+    }
+
+    virtual ~EPICSRPCWorkerPoolTestCallback() {
+    }
+
+    virtual void requestDone(epics::pvData::Status const & status,
+                             epics::pvData::PVStructure::shared_pointer const & result) {
+        (void) mux.FastLock();
+        counter++;
+        order = counter;
+        success = status.isSuccess();
+        replied = true;
+        mux.FastUnLock();
+    }
+
+    FastPollingMutexSem &mux;
+    uint32 &counter;
+    uint32 order;
+    bool replied;
+    bool success;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+bool EPICSRPCWorkerPoolTest::TestConstructor() {
+    using namespace MARTe;
+    EPICSRPCWorkerPool pool;
+    bool ok = (pool.GetNumberOfServices() == 0u);
+    ok &= (pool.GetNumberOfPendingRequests() == 0u);
+    return ok;
+}
+
+bool EPICSRPCWorkerPoolTest::TestSetNumberOfServices() {
+    using namespace MARTe;
+    EPICSRPCWorkerPool pool;
+    bool ok = pool.SetNumberOfServices(3u);
+    ok &= (pool.GetNumberOfServices() == 3u);
+    ok &= !pool.SetNumberOfServices(2u);
+    return ok;
+}
+
+bool EPICSRPCWorkerPoolTest::TestSetService() {
+    using namespace MARTe;
+    EPICSRPCWorkerPool pool;
+    ReferenceT<EPICSRPCWorkerPoolTestService> service(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = pool.SetNumberOfServices(1u);
+    ok &= pool.SetService(0u, service, 1u);
+    return ok;
+}
+
+bool EPICSRPCWorkerPoolTest::TestSetService_InvalidIndex() {
+    using namespace MARTe;
+    EPICSRPCWorkerPool pool;
+    ReferenceT<EPICSRPCWorkerPoolTestService> service(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = pool.SetNumberOfServices(1u);
+    ok &= !pool.SetService(1u, service, 1u);
+    return ok;
+}
+
+bool EPICSRPCWorkerPoolTest::TestEnqueue() {
+    using namespace MARTe;
+    EPICSRPCWorkerPool pool;
+    ReferenceT<EPICSRPCWorkerPoolTestService> service(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    FastPollingMutexSem mux;
+    uint32 counter = 0u;
+    std::shared_ptr<EPICSRPCWorkerPoolTestCallback> callback(new EPICSRPCWorkerPoolTestCallback(mux, counter));
+    bool ok = pool.SetNumberOfServices(1u);
+    ok &= pool.SetService(0u, service, 0u);
+    ok &= pool.Start(2u, 0xffu, THREADS_DEFAULT_STACKSIZE, "TestEnqueue");
+    if (ok) {
+        ok = pool.Enqueue(0u, epics::pvData::PVStructurePtr(), callback);
+    }
+    uint32 timeout = 50u;
+    while ((ok) && (!callback->replied) && (timeout > 0u)) {
+        Sleep::Sec(0.1);
+        timeout--;
+    }
+    ok &= (callback->replied);
+    ok &= (callback->success);
+    ok &= pool.Stop();
+    return ok;
+}
+
+bool EPICSRPCWorkerPoolTest::TestEnqueue_NotStarted() {
+    using namespace MARTe;
+    EPICSRPCWorkerPool pool;
+    ReferenceT<EPICSRPCWorkerPoolTestService> service(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    FastPollingMutexSem mux;
+    uint32 counter = 0u;
+    std::shared_ptr<EPICSRPCWorkerPoolTestCallback> callback(new EPICSRPCWorkerPoolTestCallback(mux, counter));
+    bool ok = pool.SetNumberOfServices(1u);
+    ok &= pool.SetService(0u, service, 0u);
+    ok &= !pool.Enqueue(0u, epics::pvData::PVStructurePtr(), callback);
+    ok &= !pool.Enqueue(1u, epics::pvData::PVStructurePtr(), callback);
+    return ok;
+}
+
+bool EPICSRPCWorkerPoolTest::TestExecute_MaxConcurrentRequests() {
+    using namespace MARTe;
+    EPICSRPCWorkerPool pool;
+    ReferenceT<EPICSRPCWorkerPoolTestService> slowService(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<EPICSRPCWorkerPoolTestService> fastService(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    slowService->sleepTime = 0.5F;
+    FastPollingMutexSem mux;
+    uint32 counter = 0u;
+    std::shared_ptr<EPICSRPCWorkerPoolTestCallback> slow1(new EPICSRPCWorkerPoolTestCallback(mux, counter));
+    std::shared_ptr<EPICSRPCWorkerPoolTestCallback> slow2(new EPICSRPCWorkerPoolTestCallback(mux, counter));
+    std::shared_ptr<EPICSRPCWorkerPoolTestCallback> fast(new EPICSRPCWorkerPoolTestCallback(mux, counter));
+    bool ok = pool.SetNumberOfServices(2u);
+    ok &= pool.SetService(0u, slowService, 1u);
+    ok &= pool.SetService(1u, fastService, 0u);
+    ok &= pool.Start(3u, 0xffu, THREADS_DEFAULT_STACKSIZE, "TestExecute_MaxConcurrentRequests");
+    //The second slow request waits for the first one (MaxConcurrentRequests = 1) and the fast request is executed meanwhile.
+    if (ok) {
+        ok = pool.Enqueue(0u, epics::pvData::PVStructurePtr(), slow1);
+    }
+    if (ok) {
+        ok = pool.Enqueue(0u, epics::pvData::PVStructurePtr(), slow2);
+    }
+    if (ok) {
+        ok = pool.Enqueue(1u, epics::pvData::PVStructurePtr(), fast);
+    }
+    uint32 timeout = 50u;
+    while ((ok) && (!slow2->replied) && (timeout > 0u)) {
+        Sleep::Sec(0.1);
+        timeout--;
+    }
+    ok &= (slow1->replied && slow2->replied && fast->replied);
+    ok &= (fast->order == 1u);
+    ok &= (slow1->order == 2u);
+    ok &= (slow2->order == 3u);
+    ok &= pool.Stop();
+    return ok;
+}
+
+bool EPICSRPCWorkerPoolTest::TestStop() {
+    using namespace MARTe;
+    EPICSRPCWorkerPool pool;
+    ReferenceT<EPICSRPCWorkerPoolTestService> slowService(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    slowService->sleepTime = 0.5F;
+    FastPollingMutexSem mux;
+    uint32 counter = 0u;
+    std::shared_ptr<EPICSRPCWorkerPoolTestCallback> slow1(new EPICSRPCWorkerPoolTestCallback(mux, counter));
+    std::shared_ptr<EPICSRPCWorkerPoolTestCallback> slow2(new EPICSRPCWorkerPoolTestCallback(mux, counter));
+    bool ok = pool.SetNumberOfServices(1u);
+    ok &= pool.SetService(0u, slowService, 1u);
+    ok &= pool.Start(1u, 0xffu, THREADS_DEFAULT_STACKSIZE, "TestStop");
+    if (ok) {
+        ok = pool.Enqueue(0u, epics::pvData::PVStructurePtr(), slow1);
+    }
+    if (ok) {
+        ok = pool.Enqueue(0u, epics::pvData::PVStructurePtr(), slow2);
+    }
+    Sleep::Sec(0.1);
+    ok &= pool.Stop();
+    ok &= (slow2->replied);
+    ok &= (!slow2->success);
+    ok &= (pool.GetNumberOfPendingRequests() == 0u);
+    return ok;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file EPICSRPCWorkerPoolTest.h
+ * @brief Header file for class EPICSRPCWorkerPoolTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class EPICSRPCWorkerPoolTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EPICSPVA_EPICSRPCWORKERPOOLTEST_H_
+#define EPICSPVA_EPICSRPCWORKERPOOLTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Tests the EPICSRPCWorkerPool public methods.
+ */
+class EPICSRPCWorkerPoolTest {
+public:
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the SetNumberOfServices method.
+     */
+    bool TestSetNumberOfServices();
+
+    /**
+     * @brief Tests the SetService method.
+     */
+    bool TestSetService();
+
+    /**
+     * @brief Tests the SetService method with an invalid index.
+     */
+    bool TestSetService_InvalidIndex();
+
+    /**
+     * @brief Tests the Enqueue method.
+     */
+    bool TestEnqueue();
+
+    /**
+     * @brief Tests that Enqueue fails if the pool was not started.
+     */
+    bool TestEnqueue_NotStarted();
+
+    /**
+     * @brief Tests that the requests of a fast service are executed while a slow service has reached its limit.
+     */
+    bool TestExecute_MaxConcurrentRequests();
+
+    /**
+     * @brief Tests that Stop replies to the queued requests with an error.
+     */
+    bool TestStop();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EPICSPVA_EPICSRPCWORKERPOOLTEST_H_ */
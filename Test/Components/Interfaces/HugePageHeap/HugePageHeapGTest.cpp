@@ -0,0 +1,104 @@
+/**
+ * @file HugePageHeapGTest.cpp
+ * @brief Source file for class HugePageHeapGTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HugePageHeapGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "HugePageHeapTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(HugePageHeapGTest,TestConstructor) {
+    HugePageHeapTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(HugePageHeapGTest,TestInitialise) {
+    HugePageHeapTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(HugePageHeapGTest,TestInitialise_HugeTLB) {
+    HugePageHeapTest test;
+    ASSERT_TRUE(test.TestInitialise_HugeTLB());
+}
+
+TEST(HugePageHeapGTest,TestInitialise_Transparent) {
+    HugePageHeapTest test;
+    ASSERT_TRUE(test.TestInitialise_Transparent());
+}
+
+TEST(HugePageHeapGTest,TestInitialise_False_Size) {
+    HugePageHeapTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Size());
+}
+
+TEST(HugePageHeapGTest,TestInitialise_False_HugePages) {
+    HugePageHeapTest test;
+    ASSERT_TRUE(test.TestInitialise_False_HugePages());
+}
+
+TEST(HugePageHeapGTest,TestInitialise_False_HugePageSize) {
+    HugePageHeapTest test;
+    ASSERT_TRUE(test.TestInitialise_False_HugePageSize());
+}
+
+TEST(HugePageHeapGTest,TestInitialise_False_NUMANode) {
+    HugePageHeapTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NUMANode());
+}
+
+TEST(HugePageHeapGTest,TestMalloc) {
+    HugePageHeapTest test;
+    ASSERT_TRUE(test.TestMalloc());
+}
+
+TEST(HugePageHeapGTest,TestFree) {
+    HugePageHeapTest test;
+    ASSERT_TRUE(test.TestFree());
+}
+
+TEST(HugePageHeapGTest,TestRealloc) {
+    HugePageHeapTest test;
+    ASSERT_TRUE(test.TestRealloc());
+}
+
+TEST(HugePageHeapGTest,TestDuplicate) {
+    HugePageHeapTest test;
+    ASSERT_TRUE(test.TestDuplicate());
+}
+
+TEST(HugePageHeapGTest,TestName) {
+    HugePageHeapTest test;
+    ASSERT_TRUE(test.TestName());
+}
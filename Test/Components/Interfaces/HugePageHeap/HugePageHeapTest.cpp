@@ -0,0 +1,249 @@
+/**
+ * @file HugePageHeapTest.cpp
+ * @brief Source file for class HugePageHeapTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HugePageHeapTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "HeapManager.h"
+#include "HugePageHeapTest.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+static const uint32 ARENA_SIZE = 1048576u;
+
+static bool InitialiseHeap(HugePageHeap &heap,
+                           const char8 * const hugePages,
+                           const char8 * const name = "HugePageHeapTest") {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("Size", ARENA_SIZE);
+    if (hugePages != NULL_PTR(const char8 *)) {
+        ok &= cdb.Write("HugePages", hugePages);
+    }
+    //Do not depend on the RLIMIT_MEMLOCK of the test environment
+    ok &= cdb.Write("Lock", 0u);
+    heap.SetName(name);
+    if (ok) {
+        ok = heap.Initialise(cdb);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool HugePageHeapTest::TestConstructor() {
+    HugePageHeap heap;
+    bool ok = (heap.FirstAddress() == 0u);
+    ok &= (heap.LastAddress() == 0u);
+    ok &= (heap.GetFreeSize() == 0u);
+    ok &= (heap.Malloc(10u) == NULL_PTR(void *));
+    return ok;
+}
+
+bool HugePageHeapTest::TestInitialise() {
+    HugePageHeap heap;
+    bool ok = InitialiseHeap(heap, "None");
+    if (ok) {
+        ok = (heap.FirstAddress() != 0u);
+        ok &= ((heap.LastAddress() - heap.FirstAddress()) == ARENA_SIZE);
+        ok &= (heap.GetFreeSize() == ARENA_SIZE);
+        ok &= (!heap.IsHugeTLB());
+    }
+    return ok;
+}
+
+bool HugePageHeapTest::TestInitialise_HugeTLB() {
+    HugePageHeap heap;
+    bool ok = InitialiseHeap(heap, NULL_PTR(const char8 *));
+    if (ok) {
+        //The arena is rounded up to the huge page size, whether it is HugeTLB or the fallback
+        ok = ((heap.LastAddress() - heap.FirstAddress()) == 2097152u);
+        void *mem = heap.Malloc(100u);
+        ok &= (mem != NULL_PTR(void *));
+        heap.Free(mem);
+    }
+    return ok;
+}
+
+bool HugePageHeapTest::TestInitialise_Transparent() {
+    HugePageHeap heap;
+    bool ok = InitialiseHeap(heap, "Transparent");
+    if (ok) {
+        ok = ((heap.LastAddress() - heap.FirstAddress()) == 2097152u);
+        ok &= (!heap.IsHugeTLB());
+    }
+    return ok;
+}
+
+bool HugePageHeapTest::TestInitialise_False_Size() {
+    HugePageHeap heap;
+    ConfigurationDatabase cdb;
+    cdb.Write("HugePages", "None");
+    return !heap.Initialise(cdb);
+}
+
+bool HugePageHeapTest::TestInitialise_False_HugePages() {
+    HugePageHeap heap;
+    return !InitialiseHeap(heap, "Invalid");
+}
+
+bool HugePageHeapTest::TestInitialise_False_HugePageSize() {
+    HugePageHeap heap;
+    ConfigurationDatabase cdb;
+    cdb.Write("Size", ARENA_SIZE);
+    cdb.Write("HugePageSize", 3000000u);
+    return !heap.Initialise(cdb);
+}
+
+bool HugePageHeapTest::TestInitialise_False_NUMANode() {
+    HugePageHeap heap;
+    ConfigurationDatabase cdb;
+    cdb.Write("Size", ARENA_SIZE);
+    cdb.Write("NUMANode", HUGE_PAGE_HEAP_MAX_NUMA_NODES);
+    return !heap.Initialise(cdb);
+}
+
+bool HugePageHeapTest::TestMalloc() {
+    HugePageHeap heap;
+    bool ok = InitialiseHeap(heap, "None");
+    void *mem1 = NULL_PTR(void *);
+    void *mem2 = NULL_PTR(void *);
+    if (ok) {
+        mem1 = heap.Malloc(100u);
+        mem2 = heap.Malloc(1u);
+        ok = (mem1 != NULL_PTR(void *)) && (mem2 != NULL_PTR(void *));
+    }
+    if (ok) {
+        uintp address1 = reinterpret_cast<uintp>(mem1);
+        uintp address2 = reinterpret_cast<uintp>(mem2);
+        ok = ((address1 % HUGE_PAGE_HEAP_ALIGNMENT) == 0u);
+        ok &= ((address2 % HUGE_PAGE_HEAP_ALIGNMENT) == 0u);
+        ok &= (address2 >= (address1 + 100u));
+        ok &= (address2 < heap.LastAddress());
+        ok &= (heap.GetFreeSize() < ARENA_SIZE);
+    }
+    if (ok) {
+        ok = (heap.Malloc(ARENA_SIZE) == NULL_PTR(void *));
+    }
+    return ok;
+}
+
+bool HugePageHeapTest::TestFree() {
+    HugePageHeap heap;
+    bool ok = InitialiseHeap(heap, "None");
+    const uint32 numberOfBlocks = 8u;
+    void *mem[numberOfBlocks];
+    uint32 i;
+    for (i = 0u; (i < numberOfBlocks) && (ok); i++) {
+        mem[i] = heap.Malloc(ARENA_SIZE / (2u * numberOfBlocks));
+        ok = (mem[i] != NULL_PTR(void *));
+    }
+    if (ok) {
+        //Does not fit until the blocks are freed and coalesced
+        ok = (heap.Malloc(ARENA_SIZE - 1024u) == NULL_PTR(void *));
+    }
+    for (i = 0u; (i < numberOfBlocks) && (ok); i++) {
+        heap.Free(mem[i]);
+        ok = (mem[i] == NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (heap.GetFreeSize() == ARENA_SIZE);
+    }
+    if (ok) {
+        void *big = heap.Malloc(ARENA_SIZE - 1024u);
+        ok = (big != NULL_PTR(void *));
+        heap.Free(big);
+    }
+    return ok;
+}
+
+bool HugePageHeapTest::TestRealloc() {
+    HugePageHeap heap;
+    bool ok = InitialiseHeap(heap, "None");
+    uint32 *mem = NULL_PTR(uint32 *);
+    if (ok) {
+        mem = static_cast<uint32 *>(heap.Malloc(4u * sizeof(uint32)));
+        ok = (mem != NULL_PTR(uint32 *));
+    }
+    if (ok) {
+        uint32 i;
+        for (i = 0u; i < 4u; i++) {
+            mem[i] = i + 1u;
+        }
+        void *data = mem;
+        mem = static_cast<uint32 *>(heap.Realloc(data, 1024u * sizeof(uint32)));
+        ok = (mem != NULL_PTR(uint32 *));
+        for (i = 0u; (i < 4u) && (ok); i++) {
+            ok = (mem[i] == (i + 1u));
+        }
+        heap.Free(data);
+    }
+    if (ok) {
+        ok = (heap.GetFreeSize() == ARENA_SIZE);
+    }
+    return ok;
+}
+
+bool HugePageHeapTest::TestDuplicate() {
+    HugePageHeap heap;
+    bool ok = InitialiseHeap(heap, "None");
+    if (ok) {
+        const char8 * const str = "HugePageHeapTest";
+        void *dup = heap.Duplicate(str);
+        ok = (dup != NULL_PTR(void *));
+        if (ok) {
+            ok = (StringHelper::Compare(static_cast<char8 *>(dup), str) == 0);
+        }
+        heap.Free(dup);
+    }
+    return ok;
+}
+
+bool HugePageHeapTest::TestName() {
+    HugePageHeap heap;
+    bool ok = InitialiseHeap(heap, "None", "HugePageHeapTestName");
+    if (ok) {
+        ok = (StringHelper::Compare(heap.Name(), "HugePageHeapTestName") == 0);
+    }
+    if (ok) {
+        ok = (HeapManager::FindHeap("HugePageHeapTestName") == &heap);
+    }
+    if (ok) {
+        void *mem = heap.Malloc(100u);
+        ok = (mem != NULL_PTR(void *));
+        if (ok) {
+            //The HeapManager finds the heap by address
+            ok = HeapManager::Free(mem);
+            ok &= (heap.GetFreeSize() == ARENA_SIZE);
+        }
+    }
+    return ok;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file HugePageHeapTest.h
+ * @brief Header file for class HugePageHeapTest
+ * @date 15/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HugePageHeapTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef HUGEPAGEHEAPTEST_H_
+#define HUGEPAGEHEAPTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "HugePageHeap.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests all the HugePageHeap methods
+ */
+class HugePageHeapTest {
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method without huge pages.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests the Initialise method with HugePages = HugeTLB (which falls back to transparent huge pages if the pool is empty).
+     */
+    bool TestInitialise_HugeTLB();
+
+    /**
+     * @brief Tests the Initialise method with HugePages = Transparent.
+     */
+    bool TestInitialise_Transparent();
+
+    /**
+     * @brief Tests that the Initialise method fails if Size is not set.
+     */
+    bool TestInitialise_False_Size();
+
+    /**
+     * @brief Tests that the Initialise method fails with an invalid HugePages.
+     */
+    bool TestInitialise_False_HugePages();
+
+    /**
+     * @brief Tests that the Initialise method fails if HugePageSize is not a power of two.
+     */
+    bool TestInitialise_False_HugePageSize();
+
+    /**
+     * @brief Tests that the Initialise method fails if NUMANode >= HUGE_PAGE_HEAP_MAX_NUMA_NODES.
+     */
+    bool TestInitialise_False_NUMANode();
+
+    /**
+     * @brief Tests that the Malloc method returns aligned and disjoint blocks and NULL when the arena is exhausted.
+     */
+    bool TestMalloc();
+
+    /**
+     * @brief Tests that the Free method coalesces the free blocks.
+     */
+    bool TestFree();
+
+    /**
+     * @brief Tests that the Realloc method preserves the content.
+     */
+    bool TestRealloc();
+
+    /**
+     * @brief Tests the Duplicate method.
+     */
+    bool TestDuplicate();
+
+    /**
+     * @brief Tests that the heap is registered in the HeapManager with the object name and that the HeapManager frees its memory.
+     */
+    bool TestName();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* HUGEPAGEHEAPTEST_H_ */
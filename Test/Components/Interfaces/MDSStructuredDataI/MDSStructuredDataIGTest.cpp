@@ -166,6 +166,11 @@ TEST(MDSStructuredDataITest, TestGetNumberOfChildren2) {
     ASSERT_TRUE(test.TestGetNumberOfChildren2());
 }
 
+TEST(MDSStructuredDataITest, TestGetNumberOfChildren_afterCreate) {
+    MDSStructuredDataITest test;
+    ASSERT_TRUE(test.TestGetNumberOfChildren_afterCreate());
+}
+
 TEST(MDSStructuredDataITest, TestGetNumberOfChildren_closedTree) {
     MDSStructuredDataITest test;
     ASSERT_TRUE(test.TestGetNumberOfChildren_closedTree());
@@ -301,6 +306,11 @@ TEST(MDSStructuredDataITest, TestMoveRelative2) {
     ASSERT_TRUE(test.TestMoveRelative2());
 }
 
+TEST(MDSStructuredDataITest, TestMoveRelative_samePath) {
+    MDSStructuredDataITest test;
+    ASSERT_TRUE(test.TestMoveRelative_samePath());
+}
+
 TEST(MDSStructuredDataITest, TestMoveRelative_InvalidNode) {
     MDSStructuredDataITest test;
     ASSERT_TRUE(test.TestMoveRelative_InvalidNode());
@@ -33,6 +33,7 @@
 #include "ConfigurationDatabase.h"
 #include "MDSStructuredDataITest.h"
 #include "StandardParser.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -690,6 +691,42 @@ bool MDSStructuredDataITest::TestGetNumberOfChildren2() {
     return ret;
 }
 
+bool MDSStructuredDataITest::TestGetNumberOfChildren_afterCreate() {
+    using namespace MARTe;
+    MDSStructuredDataI mdsStructuredDataI;
+    bool force = true;
+    bool ret = mdsStructuredDataI.CreateTree(treeName.Buffer(), force);
+    if (ret) {
+        remove_mds_sdi = true;
+    }
+    if (ret) {
+        mdsStructuredDataI.SetEditMode(true);
+        ret = mdsStructuredDataI.OpenTree(treeName.Buffer(), -1);
+    }
+    if (ret) {
+        ret = mdsStructuredDataI.CreateAbsolute("A.1");
+    }
+    if (ret) {
+        ret = mdsStructuredDataI.MoveToAncestor(1u);
+    }
+    if (ret) {
+        ret = (1u == mdsStructuredDataI.GetNumberOfChildren());
+    }
+    if (ret) {
+        ret = mdsStructuredDataI.CreateRelative("2");
+    }
+    if (ret) {
+        ret = mdsStructuredDataI.MoveToAncestor(1u);
+    }
+    if (ret) {
+        ret = (2u == mdsStructuredDataI.GetNumberOfChildren());
+    }
+    if (ret) {
+        ret = (StringHelper::Compare(mdsStructuredDataI.GetChildName(1u), "2") == 0);
+    }
+    return ret;
+}
+
 bool MDSStructuredDataITest::TestGetNumberOfChildren_closedTree() {
     using namespace MARTe;
     MDSStructuredDataI mdsStructuredDataI;
@@ -1595,6 +1632,34 @@ bool MDSStructuredDataITest::TestMoveRelative2() {
     return ret;
 }
 
+bool MDSStructuredDataITest::TestMoveRelative_samePath() {
+    using namespace MARTe;
+    MDSStructuredDataI mdsStructuredDataI;
+    bool force = true;
+    bool ret = mdsStructuredDataI.CreateTree(treeName.Buffer(), force);
+    if (ret) {
+        remove_mds_sdi = true;
+    }
+    if (ret) {
+        mdsStructuredDataI.SetEditMode(true);
+        ret = mdsStructuredDataI.OpenTree(treeName.Buffer(), -1);
+    }
+    if (ret) {
+        ret = mdsStructuredDataI.CreateAbsolute("A.B");
+    }
+    uint32 i;
+    for (i = 0u; (i < 3u) && (ret); i++) {
+        ret = mdsStructuredDataI.MoveToRoot();
+        if (ret) {
+            ret = mdsStructuredDataI.MoveRelative("A.B");
+        }
+        if (ret) {
+            ret = (StringHelper::Compare(mdsStructuredDataI.GetName(), "B") == 0);
+        }
+    }
+    return ret;
+}
+
 bool MDSStructuredDataITest::TestMoveRelative_InvalidNode() {
     using namespace MARTe;
     MDSStructuredDataI mdsStructuredDataI;
@@ -194,6 +194,11 @@ public:
      */
     bool TestGetNumberOfChildren2();
 
+    /**
+     * @brief Test MDSStructuredDataI::GetNumberOfChildren() after the children of a node were loaded and a new child was created.
+     */
+    bool TestGetNumberOfChildren_afterCreate();
+
     /**
      * @brief Test MDSStructuredDataI::GetNumberOfChildren() on error
      */
@@ -346,6 +351,12 @@ public:
      */
     bool TestMoveRelative2();
 
+    /**
+     * @brief Test MDSStructuredDataI::MoveRelative() on succeed.
+     * @details Move several times to the same relative path (resolved from the path cache after the first time).
+     */
+    bool TestMoveRelative_samePath();
+
     /**
      * @brief Test MDSStructuredDataI::MoveRelative() on error.
      * @details Move to an invalid node
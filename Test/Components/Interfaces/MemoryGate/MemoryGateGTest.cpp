@@ -54,9 +54,14 @@ TEST(MemoryGateGTest,TestInitialise_FalseTooManyBuffers) {
     ASSERT_TRUE(test.TestInitialise_FalseTooManyBuffers());
 }
 
-TEST(MemoryGateGTest,TestInitialise_DefaultTimeout) {
+TEST(MemoryGateGTest,TestInitialise_MaxNumberOfBuffers) {
     MemoryGateTest test;
-    ASSERT_TRUE(test.TestInitialise_DefaultTimeout());
+    ASSERT_TRUE(test.TestInitialise_MaxNumberOfBuffers());
+}
+
+TEST(MemoryGateGTest,TestInitialise_NumberOfReadersAndWriters) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestInitialise_NumberOfReadersAndWriters());
 }
 
 TEST(MemoryGateGTest,TestInitialise_DefaultNBuffers) {
@@ -89,8 +94,22 @@ TEST(MemoryGateGTest,TestMemoryWrite) {
     ASSERT_TRUE(test.TestMemoryWrite());
 }
 
-TEST(MemoryGateGTest,TestMemoryWrite_Overflow) {
+TEST(MemoryGateGTest,TestMemoryWrite_NumberOfReaders) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryWrite_NumberOfReaders());
+}
+
+TEST(MemoryGateGTest,TestInitialise_False_SharedMemoryName) {
     MemoryGateTest test;
-    ASSERT_TRUE(test.TestMemoryWrite_Overflow());
+    ASSERT_TRUE(test.TestInitialise_False_SharedMemoryName());
 }
 
+TEST(MemoryGateGTest,TestMemoryRead_SharedMemory) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryRead_SharedMemory());
+}
+
+TEST(MemoryGateGTest,TestSetMemorySize_False_SharedMemoryMismatch) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestSetMemorySize_False_SharedMemoryMismatch());
+}
@@ -48,6 +48,8 @@
 #include "StandardParser.h"
 #include "Threads.h"
 
+#include <sys/mman.h>
+
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -66,31 +68,20 @@ public:
     uint32 GetNumberOfBuffers();
 
     volatile int32 *GetSpinlocksRead();
-    FastPollingMutexSem *GetSpinlocksWrite();
 
-    uint32 *GetWhatIsNewestCounter();
+    volatile int32 *GetWriteLocks();
 
-    uint32 GetWhatIsNewestGlobCounter();
+    int32 GetNewestBuffer();
 
     uint32 GetOffsetStore();
 
-    uint32 GetResetTimeout();
-
     virtual bool MemoryRead(uint8 * const bufferToFill);
 
     virtual bool MemoryWrite(const uint8 * const bufferToFlush);
 
-    bool MemoryRead1(uint8 * const bufferToFill);
-
-    bool MemoryWrite1(const uint8 * const bufferToFlush);
-
     EventSem *GetReadSem();
     EventSem *GetWriteSem();
 
-    void SetCounters(uint32 globCounter);
-
-    uint32 *GetCounters();
-
 private:
     EventSem readEventSem;
     EventSem writeEventSem;
@@ -126,16 +117,12 @@ volatile int32 *MemoryGateTestInterface::GetSpinlocksRead() {
     return spinlocksRead;
 
 }
-FastPollingMutexSem *MemoryGateTestInterface::GetSpinlocksWrite() {
-    return spinlocksWrite;
-}
-
-uint32 *MemoryGateTestInterface::GetWhatIsNewestCounter() {
-    return whatIsNewestCounter;
+volatile int32 *MemoryGateTestInterface::GetWriteLocks() {
+    return writeLocks;
 }
 
-uint32 MemoryGateTestInterface::GetWhatIsNewestGlobCounter() {
-    return whatIsNewestGlobCounter;
+int32 MemoryGateTestInterface::GetNewestBuffer() {
+    return *newestBuffer;
 }
 
 uint32 MemoryGateTestInterface::GetOffsetStore() {
@@ -143,10 +130,6 @@ uint32 MemoryGateTestInterface::GetOffsetStore() {
 
 }
 
-uint32 MemoryGateTestInterface::GetResetTimeout() {
-    return resetTimeout.GetTimeoutMSec();
-}
-
 EventSem *MemoryGateTestInterface::GetReadSem() {
     return &readEventSem;
 }
@@ -158,35 +141,8 @@ EventSem *MemoryGateTestInterface::GetWriteSem() {
 bool MemoryGateTestInterface::MemoryRead(uint8 * const bufferToFill) {
 
     //get input offset
-    bool ok = false;
-    uint64 checkedMask = 0ull;
     uint32 bufferIdx = 0u;
-
-    for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
-        //check the last written
-        bufferIdx = 0u;
-        uint32 max = 0u;
-        for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-            if (spinlocksWrite[h].FastTryLock()) {
-                uint32 tempMax = whatIsNewestCounter[h];
-                spinlocksWrite[h].FastUnLock();
-                if ((tempMax >= max) && (((1ull << h) & checkedMask) == 0u)) {
-                    max = tempMax;
-                    bufferIdx = h;
-                }
-            }
-        }
-
-        checkedMask |= (1ull << bufferIdx);
-        ok = false;
-        //try to lock the next buffer to write
-
-        if (spinlocksWrite[bufferIdx].FastTryLock()) {
-            Atomic::Increment(&spinlocksRead[bufferIdx]);
-            spinlocksWrite[bufferIdx].FastUnLock();
-            ok = true;
-        }
-    }
+    bool ok = AcquireRead(bufferIdx);
 
     if (ok) {
         readEventSem.ResetWait(TTInfiniteWait);
@@ -196,13 +152,8 @@ bool MemoryGateTestInterface::MemoryRead(uint8 * const bufferToFill) {
     if (ok) {
         uint32 offset = (memSize * bufferIdx);
         ok = MemoryOperationsHelper::Copy(bufferToFill, &mem[offset], memSize);
-    }
-
-    if (ok) {
-
-        Atomic::Decrement(&spinlocksRead[bufferIdx]);
+        ReleaseRead(bufferIdx);
         REPORT_ERROR(ErrorManagement::Information, "buffer read=%d", bufferIdx);
-
     }
 
     return ok;
@@ -211,34 +162,9 @@ bool MemoryGateTestInterface::MemoryRead(uint8 * const bufferToFill) {
 
 bool MemoryGateTestInterface::MemoryWrite(const uint8 * const bufferToFlush) {
 
-    bool ok = false;
     uint32 bufferIdx = 0u;
-    uint64 checkedMask = 0ull;
-    for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
-        //check the oldest written
-        uint32 min = 0xFFFFFFFFu;
-        bufferIdx = 0u;
-        for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-            uint32 index = h;
-            uint32 tempMin = whatIsNewestCounter[index];
-            if ((tempMin < min) && (((1ull << h) & checkedMask) == 0ull)) {
-                min = tempMin;
-                bufferIdx = h;
-            }
-        }
-        checkedMask |= (1ull << bufferIdx);
-        ok = false;
-        //try to lock the next buffer to write
-        if (spinlocksWrite[bufferIdx].FastTryLock()) {
-            //no readers!
-            if (spinlocksRead[bufferIdx] == 0) {
-                ok = true;
-            }
-            else {
-                spinlocksWrite[bufferIdx].FastUnLock();
-            }
-        }
-    }
+    bool ok = AcquireWrite(bufferIdx);
+
     if (ok) {
         writeEventSem.ResetWait(TTInfiniteWait);
     }
@@ -247,77 +173,12 @@ bool MemoryGateTestInterface::MemoryWrite(const uint8 * const bufferToFlush) {
     if (ok) {
         uint32 offset = (memSize * bufferIdx);
         ok = MemoryOperationsHelper::Copy(&mem[offset], bufferToFlush, memSize);
-    }
-
-    if (ok) {
+        ReleaseWrite(bufferIdx);
         REPORT_ERROR(ErrorManagement::Information, "buffer write=%d", bufferIdx);
-
-        whatIsNewestGlobCounter++;
-        whatIsNewestCounter[bufferIdx] = whatIsNewestGlobCounter;
-
-        //overflow... subtract the smaller one
-        if (whatIsNewestGlobCounter == 0u) {
-
-            uint32 min = 0xFFFFFFFFu;
-            for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-                if (h != bufferIdx) {
-                    uint32 index1 = h;
-                    if (whatIsNewestCounter[index1] < min) {
-                        min = whatIsNewestCounter[index1];
-                    }
-                }
-            }
-
-            for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-                uint32 index1 = h;
-                if (h != bufferIdx) {
-                    bool blocked = spinlocksWrite[index1].FastLock(resetTimeout);
-                    if (blocked) {
-                        whatIsNewestCounter[index1] -= min;
-                        spinlocksWrite[index1].FastUnLock();
-                    }
-                }
-            }
-
-            whatIsNewestGlobCounter -= min;
-            whatIsNewestCounter[bufferIdx] -= min;
-        }
-        spinlocksWrite[bufferIdx].FastUnLock();
-
     }
     return ok;
 }
 
-bool MemoryGateTestInterface::MemoryRead1(uint8 * const bufferToFill){
-    bool ret=MemoryGate::MemoryRead(bufferToFill);
-    if(ret){
-        readEventSem.ResetWait(TTInfiniteWait);
-    }
-    return ret;
-}
-
-bool MemoryGateTestInterface::MemoryWrite1(const uint8 * const bufferToFlush){
-    bool ret=MemoryGate::MemoryWrite(bufferToFlush);
-    if(ret){
-        writeEventSem.ResetWait(TTInfiniteWait);
-    }
-    return ret;
-
-}
-
-void MemoryGateTestInterface::SetCounters(uint32 globCounter) {
-    uint32 initCounter = globCounter - numberOfBuffers + 1;
-    for (uint32 i = 0u; i < numberOfBuffers; i++) {
-        whatIsNewestCounter[i] = initCounter;
-        initCounter++;
-    }
-    whatIsNewestGlobCounter = globCounter;
-}
-
-uint32 *MemoryGateTestInterface::GetCounters() {
-    return whatIsNewestCounter;
-}
-
 CLASS_REGISTER(MemoryGateTestInterface, "1.0")
 
 /*---------------------------------------------------------------------------*/
@@ -339,15 +200,12 @@ bool MemoryGateTest::TestConstructor() {
 
     ret &= test.GetSpinlocksRead() == NULL;
 
-    ret &= test.GetSpinlocksWrite() == NULL;
+    ret &= test.GetWriteLocks() == NULL;
 
-    ret &= test.GetWhatIsNewestCounter() == NULL;
-    ret &= test.GetWhatIsNewestGlobCounter() == 0u;
+    ret &= test.GetNewestBuffer() == 1;
 
     ret &= test.GetOffsetStore() == 0u;
 
-    ret &= test.GetResetTimeout() == 0xffffffffu;
-
     return ret;
 }
 
@@ -371,7 +229,6 @@ bool MemoryGateTest::TestInitialise() {
 
     if (ok) {
         ok &= test.GetNumberOfBuffers() == 10u;
-        ok &= test.GetResetTimeout() == 100;
         ok &= test.GetMem() != NULL;
         ok &= test.GetMemSize() == 10u;
 
@@ -399,7 +256,7 @@ bool MemoryGateTest::TestInitialise_FalseTooManyBuffers() {
     return ok;
 }
 
-bool MemoryGateTest::TestInitialise_DefaultTimeout() {
+bool MemoryGateTest::TestInitialise_MaxNumberOfBuffers() {
     const char8* config = ""
             "NumberOfBuffers = 64\n"
             "MemorySize= 10";
@@ -418,7 +275,6 @@ bool MemoryGateTest::TestInitialise_DefaultTimeout() {
 
     if (ok) {
         ok &= test.GetNumberOfBuffers() == 64u;
-        ok &= test.GetResetTimeout() == 0xFFFFFFFF;
         ok &= test.GetMem() != NULL;
         ok &= test.GetMemSize() == 10u;
 
@@ -445,7 +301,6 @@ bool MemoryGateTest::TestInitialise_DefaultNBuffers() {
 
     if (ok) {
         ok &= test.GetNumberOfBuffers() == 2u;
-        ok &= test.GetResetTimeout() == 100;
         ok &= test.GetMem() != NULL;
         ok &= test.GetMemSize() == 10u;
 
@@ -473,7 +328,6 @@ bool MemoryGateTest::TestInitialise_NoMemSize() {
 
     if (ok) {
         ok &= test.GetNumberOfBuffers() == 10u;
-        ok &= test.GetResetTimeout() == 100;
         ok &= test.GetMem() == NULL;
         ok &= test.GetMemSize() == 0u;
     }
@@ -500,7 +354,6 @@ bool MemoryGateTest::TestSetMemorySize_Initialised() {
 
     if (ok) {
         ok &= test.GetNumberOfBuffers() == 10u;
-        ok &= test.GetResetTimeout() == 100;
         ok &= test.GetMem() != NULL;
         ok &= test.GetMemSize() == 10u;
 
@@ -532,7 +385,6 @@ bool MemoryGateTest::TestSetMemorySize_NotInitialised() {
 
     if (ok) {
         ok &= test.GetNumberOfBuffers() == 10u;
-        ok &= test.GetResetTimeout() == 100;
         ok &= test.GetMem() == NULL;
         ok &= test.GetMemSize() == 0u;
 
@@ -570,23 +422,24 @@ static void WriteFunction(ThreadArg &tt) {
 }
 
 
-static void ReadFunction1(ThreadArg &tt) {
-    Atomic::Increment(&tt.done);
+static bool WriteAndWait(MemoryGateTestInterface &test,
+                         uint8 value) {
+    ThreadArg writeArg;
+    writeArg.ptr = &test;
+    writeArg.buffer = value;
+    writeArg.ret = false;
+    writeArg.done = 0;
 
-    //tells to the main process that the thread begins
-    tt.ret = tt.ptr->MemoryRead1(&(tt.buffer));
-    Atomic::Increment(&tt.done);
-}
+    Threads::BeginThread((ThreadFunctionType) WriteFunction, &writeArg);
 
-static void WriteFunction1(ThreadArg &tt) {
-    Atomic::Increment(&tt.done);
-
-    //tells to the main process that the thread begins
-    tt.ret = tt.ptr->MemoryWrite1(&(tt.buffer));
-    Atomic::Increment(&tt.done);
+    Sleep::MSec(100);
+    test.GetWriteSem()->Post();
+    while (writeArg.done < 2) {
+        Sleep::MSec(100);
+    }
+    return writeArg.ret;
 }
 
-
 bool MemoryGateTest::TestMemoryRead() {
     const char8* config = ""
             "NumberOfBuffers = 2\n"
@@ -648,32 +501,8 @@ bool MemoryGateTest::TestMemoryRead() {
 
     if (ok) {
         //test 2... take always the last written
-        ThreadArg writeArg;
-        writeArg.ptr = &test;
-        writeArg.buffer = 1;
-        writeArg.ret = false;
-        writeArg.done = 0;
-
-        Threads::BeginThread((ThreadFunctionType) WriteFunction, &writeArg);
-
-        Sleep::MSec(100);
-        writeEventSem->Post();
-        while (writeArg.done == 0) {
-            Sleep::MSec(100);
-        }
-
-        writeArg.ptr = &test;
-        writeArg.buffer = 2;
-        writeArg.ret = false;
-        writeArg.done = 0;
-
-        Threads::BeginThread((ThreadFunctionType) WriteFunction, &writeArg);
-
-        Sleep::MSec(100);
-        writeEventSem->Post();
-        while (writeArg.done < 2) {
-            Sleep::MSec(100);
-        }
+        ok &= WriteAndWait(test, 1);
+        ok &= WriteAndWait(test, 2);
 
         ThreadArg readArg;
         readArg.ptr = &test;
@@ -693,22 +522,16 @@ bool MemoryGateTest::TestMemoryRead() {
     }
 
     if (ok) {
-        //test 3... return false if buffers are busy
-        ThreadArg writeArg[2];
-        writeArg[0].ptr = &test;
-        writeArg[0].buffer = 1;
-        writeArg[0].ret = false;
-        writeArg[0].done = 0;
-
-        writeArg[1].ptr = &test;
-        writeArg[1].buffer = 2;
-        writeArg[1].ret = false;
-        writeArg[1].done = 0;
+        //test 3... the readers are not blocked by a writer and get the newest complete buffer
+        ThreadArg writeArg;
+        writeArg.ptr = &test;
+        writeArg.buffer = 3;
+        writeArg.ret = false;
+        writeArg.done = 0;
 
-        Threads::BeginThread((ThreadFunctionType) WriteFunction, &writeArg[0]);
-        Threads::BeginThread((ThreadFunctionType) WriteFunction, &writeArg[1]);
+        Threads::BeginThread((ThreadFunctionType) WriteFunction, &writeArg);
 
-        while ((writeArg[0].done == 0) || (writeArg[1].done == 0)) {
+        while (writeArg.done == 0) {
             Sleep::MSec(100);
         }
 
@@ -725,17 +548,15 @@ bool MemoryGateTest::TestMemoryRead() {
         while (readArg.done < 2) {
             Sleep::MSec(100);
         }
-        //read should fail... no buffer available
-        ok &= !readArg.ret;
+        ok &= readArg.ret;
+        ok &= readArg.buffer == 2;
 
-        Sleep::MSec(200);
+        Sleep::MSec(100);
         writeEventSem->Post();
-        while (writeArg[0].done < 2) {
-            Sleep::MSec(100);
-        }
-        while (writeArg[1].done < 2) {
+        while (writeArg.done < 2) {
             Sleep::MSec(100);
         }
+        ok &= writeArg.ret;
     }
 
     return ok;
@@ -905,9 +726,9 @@ bool MemoryGateTest::TestMemoryWrite() {
     return ok;
 }
 
-bool MemoryGateTest::TestMemoryWrite_Overflow() {
+bool MemoryGateTest::TestMemoryWrite_NumberOfReaders() {
     const char8* config = ""
-            "NumberOfBuffers = 2\n"
+            "NumberOfReaders = 2\n"
             "MemorySize= 1";
 
     MemoryGateTestInterface test;
@@ -923,57 +744,183 @@ bool MemoryGateTest::TestMemoryWrite_Overflow() {
     }
 
     if (ok) {
-        ok &= test.GetNumberOfBuffers() == 2u;
+        ok &= test.GetNumberOfBuffers() == 4u;
         ok &= test.GetMem() != NULL;
         ok &= test.GetMemSize() == 1u;
     }
 
-    EventSem *readEventSem = test.GetReadSem();
-    EventSem *writeEventSem = test.GetWriteSem();
-
     if (ok) {
+        volatile int32 *spinlocksRead = test.GetSpinlocksRead();
+        ThreadArg readArg[2];
 
-        test.SetCounters(0xFFFFFFFF);
-        uint32 *counters = test.GetCounters();
-
-        ok &= (counters[0] == 0xFFFFFFFE);
-        ok &= (counters[1] == 0xFFFFFFFF);
+        //each reader holds a different buffer
+        for (uint32 i = 0u; (i < 2u) && (ok); i++) {
+            ok = WriteAndWait(test, static_cast<uint8>(i + 1u));
+            if (ok) {
+                readArg[i].ptr = &test;
+                readArg[i].buffer = 0;
+                readArg[i].ret = false;
+                readArg[i].done = 0;
 
-        ThreadArg writeArg;
-        writeArg.ptr = &test;
-        writeArg.buffer = 1;
-        writeArg.ret = false;
-        writeArg.done = 0;
+                Threads::BeginThread((ThreadFunctionType) ReadFunction, &readArg[i]);
+                while (spinlocksRead[i] == 0) {
+                    Sleep::MSec(10);
+                }
+            }
+        }
 
-        Threads::BeginThread((ThreadFunctionType) WriteFunction1, &writeArg);
+        //the writer always finds a free buffer
+        for (uint32 i = 0u; (i < 5u) && (ok); i++) {
+            ok = WriteAndWait(test, static_cast<uint8>(i + 3u));
+        }
 
-        Sleep::MSec(100);
-        writeEventSem->Post();
-        while (writeArg.done < 2) {
+        test.GetReadSem()->Post();
+        while ((readArg[0].done < 2) || (readArg[1].done < 2)) {
             Sleep::MSec(100);
         }
+        ok &= readArg[0].ret;
+        ok &= readArg[0].buffer == 1;
+        ok &= readArg[1].ret;
+        ok &= readArg[1].buffer == 2;
+    }
+    return ok;
+}
 
-        ThreadArg readArg;
-        readArg.ptr = &test;
-        readArg.buffer = 0;
-        readArg.ret = false;
-        readArg.done = 0;
+bool MemoryGateTest::TestInitialise_NumberOfReadersAndWriters() {
+    const char8* config = ""
+            "NumberOfReaders = 3\n"
+            "NumberOfWriters = 2\n"
+            "MemorySize= 10";
 
-        Threads::BeginThread((ThreadFunctionType) ReadFunction1, &readArg);
+    MemoryGateTestInterface test;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
 
-        Sleep::MSec(100);
-        readEventSem->Post();
-        while (readArg.done < 2) {
-            Sleep::MSec(100);
-        }
-        ok &= readArg.ret;
-        ok &= readArg.buffer == 1;
+    bool ok = parser.Parse();
 
-        //write on 0!
-        ok &= (counters[0] == 1);
-        ok &= (counters[1] == 0);
+    if (ok) {
+        ok = test.Initialise(cdb);
+    }
 
+    if (ok) {
+        ok &= test.GetNumberOfBuffers() == 6u;
+        ok &= test.GetNewestBuffer() == 5;
+        ok &= test.GetMem() != NULL;
+        ok &= test.GetMemSize() == 10u;
     }
     return ok;
 }
 
+bool MemoryGateTest::TestInitialise_False_SharedMemoryName() {
+    const char8* config = ""
+            "NumberOfBuffers = 3\n"
+            "SharedMemoryName = MemoryGateTest\n"
+            "MemorySize= 4";
+
+    MemoryGateTestInterface test;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    if (ok) {
+        ok = !test.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool MemoryGateTest::TestMemoryRead_SharedMemory() {
+    //Two objects with the same name share the buffers as if they were in different processes
+    const char8* config = ""
+            "NumberOfBuffers = 3\n"
+            "SharedMemoryName = \"/MemoryGateTest\"";
+
+    (void) shm_unlink("/MemoryGateTest");
+    MemoryGate writer;
+    MemoryGate reader;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    if (ok) {
+        ok = writer.Initialise(cdb);
+    }
+    if (ok) {
+        cdb.MoveToRoot();
+        ok = reader.Initialise(cdb);
+    }
+    if (ok) {
+        ok = writer.SetMemorySize(sizeof(uint32));
+    }
+    if (ok) {
+        ok = reader.SetMemorySize(sizeof(uint32));
+    }
+    if (ok) {
+        ok = (writer.GetMemory() != reader.GetMemory());
+    }
+    uint32 value = 0u;
+    if (ok) {
+        //The buffers of a new segment are zeroed
+        value = 1u;
+        ok = reader.MemoryRead(reinterpret_cast<uint8 *>(&value));
+        ok &= (value == 0u);
+    }
+    for (uint32 i = 1u; (i < 10u) && (ok); i++) {
+        ok = writer.MemoryWrite(reinterpret_cast<uint8 *>(&i));
+        if (ok) {
+            ok = reader.MemoryRead(reinterpret_cast<uint8 *>(&value));
+        }
+        if (ok) {
+            ok = (value == i);
+        }
+    }
+    (void) shm_unlink("/MemoryGateTest");
+    return ok;
+}
+
+bool MemoryGateTest::TestSetMemorySize_False_SharedMemoryMismatch() {
+    const char8* config1 = ""
+            "NumberOfBuffers = 3\n"
+            "SharedMemoryName = \"/MemoryGateTest\"";
+    const char8* config2 = ""
+            "NumberOfBuffers = 4\n"
+            "SharedMemoryName = \"/MemoryGateTest\"";
+
+    (void) shm_unlink("/MemoryGateTest");
+    MemoryGate gate1;
+    MemoryGate gate2;
+    ConfigurationDatabase cdb1;
+    StreamString configStream1 = config1;
+    configStream1.Seek(0);
+    StandardParser parser1(configStream1, cdb1);
+    ConfigurationDatabase cdb2;
+    StreamString configStream2 = config2;
+    configStream2.Seek(0);
+    StandardParser parser2(configStream2, cdb2);
+
+    bool ok = parser1.Parse();
+    if (ok) {
+        ok = parser2.Parse();
+    }
+    if (ok) {
+        ok = gate1.Initialise(cdb1);
+    }
+    if (ok) {
+        ok = gate2.Initialise(cdb2);
+    }
+    if (ok) {
+        ok = gate1.SetMemorySize(16u);
+    }
+    if (ok) {
+        ok = !gate2.SetMemorySize(16u);
+    }
+    (void) shm_unlink("/MemoryGateTest");
+    return ok;
+}
@@ -71,9 +71,15 @@ public:
     bool TestInitialise_FalseTooManyBuffers();
 
     /**
-     * @brief Tests the MemoryGateTest::Initialise method with default overflow timeout
+     * @brief Tests the MemoryGateTest::Initialise method with the maximum number of buffers
      */
-    bool TestInitialise_DefaultTimeout();
+    bool TestInitialise_MaxNumberOfBuffers();
+
+    /**
+     * @brief Tests that the MemoryGateTest::Initialise method derives the number of buffers
+     * from NumberOfReaders and NumberOfWriters.
+     */
+    bool TestInitialise_NumberOfReadersAndWriters();
 
     /**
      * @brief Tests the MemoryGateTest::Initialise method with default number of buffers
@@ -109,10 +115,28 @@ public:
     bool TestMemoryWrite();
 
     /**
-     * @brief Tests the MemoryGateTest::MemoryWrite method when all the
-     * write operations counters are reset in case of overflow.
+     * @brief Tests that the MemoryGateTest::MemoryWrite method always finds a free
+     * buffer while all the declared readers hold one.
+     */
+    bool TestMemoryWrite_NumberOfReaders();
+
+    /**
+     * @brief Tests that the MemoryGateTest::Initialise method fails if the
+     * SharedMemoryName does not start with /
+     */
+    bool TestInitialise_False_SharedMemoryName();
+
+    /**
+     * @brief Tests the MemoryGateTest::MemoryRead method between two objects
+     * sharing the same shared memory segment
+     */
+    bool TestMemoryRead_SharedMemory();
+
+    /**
+     * @brief Tests that the MemoryGateTest::SetMemorySize method fails if the
+     * shared memory segment was created with a different number of buffers
      */
-    bool TestMemoryWrite_Overflow();
+    bool TestSetMemorySize_False_SharedMemoryMismatch();
 
 };
 
@@ -0,0 +1,81 @@
+/**
+ * @file NI9157RegisterGroupGTest.cpp
+ * @brief Source file for class NI9157RegisterGroupGTest.
+ * @date 15/10/2026
+ * @author Pedro Lourenco
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ *
+ * @details This source file contains the definition of all the methods for
+ * the class NI9157RegisterGroupGTest (public, protected, and private). Be
+ * aware that some methods, such as those inline could be defined on the header
+ * file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "gtest/gtest.h"
+#include <limits.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "NI9157RegisterGroupTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(NI9157RegisterGroupGTest,TestConstructor) {
+    NI9157RegisterGroupTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(NI9157RegisterGroupGTest,TestAllocate) {
+    NI9157RegisterGroupTest test;
+    ASSERT_TRUE(test.TestAllocate());
+}
+
+TEST(NI9157RegisterGroupGTest,TestAllocate_False_ZeroRegisters) {
+    NI9157RegisterGroupTest test;
+    ASSERT_TRUE(test.TestAllocate_False_ZeroRegisters());
+}
+
+TEST(NI9157RegisterGroupGTest,TestAdd) {
+    NI9157RegisterGroupTest test;
+    ASSERT_TRUE(test.TestAdd());
+}
+
+TEST(NI9157RegisterGroupGTest,TestAdd_False_Full) {
+    NI9157RegisterGroupTest test;
+    ASSERT_TRUE(test.TestAdd_False_Full());
+}
+
+TEST(NI9157RegisterGroupGTest,TestAdd_False_InvalidParameters) {
+    NI9157RegisterGroupTest test;
+    ASSERT_TRUE(test.TestAdd_False_InvalidParameters());
+}
+
+TEST(NI9157RegisterGroupGTest,TestPrepare) {
+    NI9157RegisterGroupTest test;
+    ASSERT_TRUE(test.TestPrepare());
+}
+
+TEST(NI9157RegisterGroupGTest,TestGetDescriptor_InvalidIndex) {
+    NI9157RegisterGroupTest test;
+    ASSERT_TRUE(test.TestGetDescriptor_InvalidIndex());
+}
@@ -0,0 +1,216 @@
+/**
+ * @file NI9157RegisterGroupTest.cpp
+ * @brief Source file for class NI9157RegisterGroupTest.
+ * @date 15/10/2026
+ * @author Pedro Lourenco
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ *
+ * @details This source file contains the definition of all the methods for
+ * the class NI9157RegisterGroupTest (public, protected, and private). Be 
+ * aware that some methods, such as those inline could be defined on the header
+ * file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "NI9157RegisterGroupTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+NI9157RegisterGroupTest::NI9157RegisterGroupTest() {
+}
+
+NI9157RegisterGroupTest::~NI9157RegisterGroupTest() {
+}
+
+bool NI9157RegisterGroupTest::TestConstructor() {
+
+    NI9157RegisterGroup group;
+    bool ret = (group.GetNumberOfRegisters() == 0u);
+    if (ret) {
+        ret = (group.GetDescriptor(0u) == 0xFFFFFFFFu);
+    }
+    return ret;
+}
+
+bool NI9157RegisterGroupTest::TestAllocate() {
+
+    NI9157RegisterGroup group;
+    bool ret = group.Allocate(4u);
+    if (ret) {
+        ret = (group.GetNumberOfRegisters() == 0u);
+    }
+    return ret;
+}
+
+bool NI9157RegisterGroupTest::TestAllocate_False_ZeroRegisters() {
+
+    NI9157RegisterGroup group;
+    return !group.Allocate(0u);
+}
+
+bool NI9157RegisterGroupTest::TestAdd() {
+
+    NI9157DeviceOperatorTI *niDeviceOperator = NULL_PTR(NI9157DeviceOperatorTI *);
+    CreateNI9157DeviceOperatorI *creator = NI9157DeviceOperatorDatabase::GetCreateNI9157DeviceOperator(UnsignedInteger32Bit);
+    ReferenceT<NI9157Device> niDevice(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    NI9157RegisterGroup group;
+    uint32 scalar = 0u;
+    uint32 array[8];
+    bool ret = (creator != NULL_PTR(CreateNI9157DeviceOperatorI *));
+    if (ret) {
+        niDeviceOperator = creator->Create(niDevice);
+        ret = (niDeviceOperator != NULL_PTR(NI9157DeviceOperatorTI *));
+    }
+    if (ret) {
+        ret = group.Allocate(2u);
+    }
+    if (ret) {
+        ret = group.Add(niDeviceOperator, 10u, 1u, &scalar);
+    }
+    if (ret) {
+        ret = group.Add(niDeviceOperator, 20u, 8u, &array[0]);
+    }
+    if (ret) {
+        ret = (group.GetNumberOfRegisters() == 2u);
+    }
+    if (ret) {
+        ret = (group.GetDescriptor(0u) == 10u);
+    }
+    if (ret) {
+        ret = (group.GetDescriptor(1u) == 20u);
+    }
+    if (niDeviceOperator != NULL_PTR(NI9157DeviceOperatorTI *)) {
+        delete niDeviceOperator;
+    }
+    return ret;
+}
+
+bool NI9157RegisterGroupTest::TestAdd_False_Full() {
+
+    NI9157DeviceOperatorTI *niDeviceOperator = NULL_PTR(NI9157DeviceOperatorTI *);
+    CreateNI9157DeviceOperatorI *creator = NI9157DeviceOperatorDatabase::GetCreateNI9157DeviceOperator(UnsignedInteger32Bit);
+    ReferenceT<NI9157Device> niDevice(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    NI9157RegisterGroup group;
+    uint32 scalar = 0u;
+    bool ret = (creator != NULL_PTR(CreateNI9157DeviceOperatorI *));
+    if (ret) {
+        niDeviceOperator = creator->Create(niDevice);
+        ret = (niDeviceOperator != NULL_PTR(NI9157DeviceOperatorTI *));
+    }
+    if (ret) {
+        ret = !group.Add(niDeviceOperator, 10u, 1u, &scalar);
+    }
+    if (ret) {
+        ret = group.Allocate(1u);
+    }
+    if (ret) {
+        ret = group.Add(niDeviceOperator, 10u, 1u, &scalar);
+    }
+    if (ret) {
+        ret = !group.Add(niDeviceOperator, 11u, 1u, &scalar);
+    }
+    if (ret) {
+        ret = (group.GetNumberOfRegisters() == 1u);
+    }
+    if (niDeviceOperator != NULL_PTR(NI9157DeviceOperatorTI *)) {
+        delete niDeviceOperator;
+    }
+    return ret;
+}
+
+bool NI9157RegisterGroupTest::TestAdd_False_InvalidParameters() {
+
+    NI9157DeviceOperatorTI *niDeviceOperator = NULL_PTR(NI9157DeviceOperatorTI *);
+    CreateNI9157DeviceOperatorI *creator = NI9157DeviceOperatorDatabase::GetCreateNI9157DeviceOperator(UnsignedInteger32Bit);
+    ReferenceT<NI9157Device> niDevice(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    NI9157RegisterGroup group;
+    uint32 scalar = 0u;
+    bool ret = (creator != NULL_PTR(CreateNI9157DeviceOperatorI *));
+    if (ret) {
+        niDeviceOperator = creator->Create(niDevice);
+        ret = (niDeviceOperator != NULL_PTR(NI9157DeviceOperatorTI *));
+    }
+    if (ret) {
+        ret = group.Allocate(4u);
+    }
+    if (ret) {
+        ret = !group.Add(NULL_PTR(NI9157DeviceOperatorTI *), 10u, 1u, &scalar);
+    }
+    if (ret) {
+        ret = !group.Add(niDeviceOperator, 10u, 1u, NULL_PTR(void *));
+    }
+    if (ret) {
+        ret = !group.Add(niDeviceOperator, 10u, 0u, &scalar);
+    }
+    if (ret) {
+        ret = (group.GetNumberOfRegisters() == 0u);
+    }
+    if (niDeviceOperator != NULL_PTR(NI9157DeviceOperatorTI *)) {
+        delete niDeviceOperator;
+    }
+    return ret;
+}
+
+bool NI9157RegisterGroupTest::TestPrepare() {
+
+    NI9157DeviceOperatorTI *niDeviceOperator = NULL_PTR(NI9157DeviceOperatorTI *);
+    CreateNI9157DeviceOperatorI *creator = NI9157DeviceOperatorDatabase::GetCreateNI9157DeviceOperator(UnsignedInteger32Bit);
+    ReferenceT<NI9157Device> niDevice(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    NI9157RegisterGroup group;
+    uint32 values[4];
+    const uint32 descriptors[] = { 0x18040u, 0x18008u, 0x18100u, 0x18000u };
+    const uint32 sorted[] = { 0x18000u, 0x18008u, 0x18040u, 0x18100u };
+    bool ret = (creator != NULL_PTR(CreateNI9157DeviceOperatorI *));
+    if (ret) {
+        niDeviceOperator = creator->Create(niDevice);
+        ret = (niDeviceOperator != NULL_PTR(NI9157DeviceOperatorTI *));
+    }
+    if (ret) {
+        ret = group.Allocate(4u);
+    }
+    for (uint32 i = 0u; (i < 4u) && (ret); i++) {
+        ret = group.Add(niDeviceOperator, descriptors[i], 1u, &values[i]);
+    }
+    if (ret) {
+        group.Prepare();
+    }
+    for (uint32 i = 0u; (i < 4u) && (ret); i++) {
+        ret = (group.GetDescriptor(i) == sorted[i]);
+    }
+    if (niDeviceOperator != NULL_PTR(NI9157DeviceOperatorTI *)) {
+        delete niDeviceOperator;
+    }
+    return ret;
+}
+
+bool NI9157RegisterGroupTest::TestGetDescriptor_InvalidIndex() {
+
+    NI9157RegisterGroup group;
+    bool ret = group.Allocate(2u);
+    if (ret) {
+        ret = (group.GetDescriptor(1u) == 0xFFFFFFFFu);
+    }
+    return ret;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file NI9157RegisterGroupTest.h
+ * @brief Header file for class NI9157RegisterGroupTest.
+ * @date 15/10/2026
+ * @author Pedro Lourenco
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ *
+ * @details This header file contains the declaration of the class
+ * NI9157RegisterGroupTest with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef NI9157REGISTERGROUPTEST_H_
+#define NI9157REGISTERGROUPTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CreateNI9157DeviceOperatorI.h"
+#include "GlobalObjectsDatabase.h"
+#include "NI9157DeviceOperatorDatabase.h"
+#include "NI9157RegisterGroup.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * @brief Tests the NI9157RegisterGroup methods which do not access the device.
+ */
+class NI9157RegisterGroupTest {
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    NI9157RegisterGroupTest();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~NI9157RegisterGroupTest();
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Allocate method.
+     */
+    bool TestAllocate();
+
+    /**
+     * @brief Tests that the Allocate method fails with zero registers.
+     */
+    bool TestAllocate_False_ZeroRegisters();
+
+    /**
+     * @brief Tests the Add method.
+     */
+    bool TestAdd();
+
+    /**
+     * @brief Tests that the Add method fails when the group is full.
+     */
+    bool TestAdd_False_Full();
+
+    /**
+     * @brief Tests that the Add method fails with invalid parameters.
+     */
+    bool TestAdd_False_InvalidParameters();
+
+    /**
+     * @brief Tests that the Prepare method sorts the registers by descriptor.
+     */
+    bool TestPrepare();
+
+    /**
+     * @brief Tests the GetDescriptor method with an invalid index.
+     */
+    bool TestGetDescriptor_InvalidIndex();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* NI9157REGISTERGROUPTEST_H_ */
@@ -64,6 +64,11 @@ TEST(OPCUAServerGTest,TestExecute_Introspection) {
     ASSERT_TRUE(test.TestExecute_Introspection());
 }
 
+TEST(OPCUAServerGTest,TestExecute_IntrospectionShared) {
+    OPCUAServerTest test;
+    ASSERT_TRUE(test.TestExecute_IntrospectionShared());
+}
+
 TEST(OPCUAServerGTest,TestExecute_IntrospectionArray) {
     OPCUAServerTest test;
     ASSERT_TRUE(test.TestExecute_IntrospectionArray());
@@ -74,6 +79,16 @@ TEST(OPCUAServerGTest,TestExecute_WrongNDimensions) {
     ASSERT_TRUE(test.TestExecute_WrongNDimensions());
 }
 
+TEST(OPCUAServerGTest,TestExecute_PublishMode) {
+    OPCUAServerTest test;
+    ASSERT_TRUE(test.TestExecute_PublishMode());
+}
+
+TEST(OPCUAServerGTest,TestInitialise_WrongPublishMode) {
+    OPCUAServerTest test;
+    ASSERT_TRUE(test.TestInitialise_WrongPublishMode());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
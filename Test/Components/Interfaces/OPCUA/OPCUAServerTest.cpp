@@ -243,6 +243,98 @@ bool OPCUAServerTest::TestExecute_Introspection() {
 	return ok;
 }
 
+bool OPCUAServerTest::TestExecute_IntrospectionShared() {
+	using namespace MARTe;
+	StreamString config = ""
+			"+OPCUATypes = {"
+			"     Class = ReferenceContainer"
+			"     +SensorPackage = {"
+			"         Class = IntrospectionStructure"
+			"         Sensor1 = {"
+			"             Type = float64"
+			"             NumberOfElements = 1"
+			"         }"
+			"     }"
+			"     +MasterSet = {"
+			"         Class = IntrospectionStructure"
+			"         SensorPackage1 = {"
+			"             Type = SensorPackage"
+			"             NumberOfElements = 1"
+			"         }"
+			"         SensorPackage2 = {"
+			"             Type = SensorPackage"
+			"             NumberOfElements = 1"
+			"         }"
+			"     }"
+			"}"
+			"+ServerTest = {"
+			"     Class = OPCUA::OPCUAServer"
+			"     AddressSpace = {"
+			"         TestStructure1 = {"
+			"             Type = MasterSet"
+			"         }"
+			"         TestStructure2 = {"
+			"             Type = MasterSet"
+			"         }"
+			"     }"
+			"}";
+	config.Seek(0LLU);
+	ConfigurationDatabase cdb;
+	StandardParser parser(config, cdb, NULL);
+	bool ok = parser.Parse();
+	cdb.MoveToRoot();
+	ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+	if (ok) {
+		ok = ord->Initialise(cdb);
+	}
+	Sleep::MSec(100);
+	UA_Client *client = UA_Client_new();
+	UA_ClientConfig_setDefault(UA_Client_getConfig(client));
+	if (ok) {
+		UA_StatusCode retval = UA_Client_connect(client, "opc.tcp://localhost:4840");
+		ok = (retval == UA_STATUSCODE_GOOD);
+	}
+	//Every instance has its own variables, even if the nodes of the members are shared
+	const char8 * const paths[4][3] = { { "TestStructure1", "SensorPackage1", "Sensor1" }, { "TestStructure1", "SensorPackage2", "Sensor1" }, {
+			"TestStructure2", "SensorPackage1", "Sensor1" }, { "TestStructure2", "SensorPackage2", "Sensor1" } };
+	UA_NodeId nodeIds[4];
+	for (uint32 p = 0u; (p < 4u) && (ok); p++) {
+		UA_BrowsePath browsePath;
+		UA_BrowsePath_init(&browsePath);
+		browsePath.startingNode = UA_NODEID_NUMERIC(0u, UA_NS0ID_OBJECTSFOLDER);
+		browsePath.relativePath.elements = static_cast<UA_RelativePathElement *>(UA_Array_new(3u, &UA_TYPES[UA_TYPES_RELATIVEPATHELEMENT]));
+		browsePath.relativePath.elementsSize = 3u;
+		for (uint32 e = 0u; e < 3u; e++) {
+			browsePath.relativePath.elements[e].referenceTypeId = UA_NODEID_NUMERIC(0u, UA_NS0ID_HIERARCHICALREFERENCES);
+			browsePath.relativePath.elements[e].includeSubtypes = true;
+			browsePath.relativePath.elements[e].targetName = UA_QUALIFIEDNAME_ALLOC(1u, paths[p][e]);
+		}
+		UA_TranslateBrowsePathsToNodeIdsRequest tbpReq;
+		UA_TranslateBrowsePathsToNodeIdsRequest_init(&tbpReq);
+		tbpReq.browsePaths = &browsePath;
+		tbpReq.browsePathsSize = 1u;
+		UA_TranslateBrowsePathsToNodeIdsResponse tbpResp = UA_Client_Service_translateBrowsePathsToNodeIds(client, tbpReq);
+		ok = (tbpResp.responseHeader.serviceResult == UA_STATUSCODE_GOOD);
+		if (ok) {
+			ok = (tbpResp.resultsSize == 1u);
+		}
+		if (ok) {
+			ok = ((tbpResp.results[0].statusCode == UA_STATUSCODE_GOOD) && (tbpResp.results[0].targetsSize == 1u));
+		}
+		if (ok) {
+			(void) UA_NodeId_copy(&(tbpResp.results[0].targets[0].targetId.nodeId), &nodeIds[p]);
+		}
+		for (uint32 q = 0u; (q < p) && (ok); q++) {
+			ok = !UA_NodeId_equal(&nodeIds[p], &nodeIds[q]);
+		}
+		UA_TranslateBrowsePathsToNodeIdsResponse_clear(&tbpResp);
+		UA_BrowsePath_clear(&browsePath);
+	}
+	UA_Client_delete(client);
+	ord->Purge();
+	return ok;
+}
+
 bool OPCUAServerTest::TestExecute_IntrospectionArray() {
 	using namespace MARTe;
 	StreamString config = ""
@@ -341,6 +433,98 @@ bool OPCUAServerTest::TestExecute_WrongNDimensions() {
 	return !ok;
 }
 
+bool OPCUAServerTest::TestExecute_PublishMode() {
+	using namespace MARTe;
+	StreamString config = ""
+			"+ServerTest = {"
+			"     Class = OPCUA::OPCUAServer"
+			"     PublishMode = DataSource"
+			"     AddressSpace = {"
+			"         MyNode = {"
+			"             Type = uint32"
+			"         }"
+			"     }"
+			"}";
+	config.Seek(0LLU);
+	ConfigurationDatabase cdb;
+	StandardParser parser(config, cdb, NULL);
+	bool ok = parser.Parse();
+	cdb.MoveToRoot();
+	ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+	if (ok) {
+		ok = ord->Initialise(cdb);
+	}
+	Sleep::MSec(100);
+	ReferenceT<OPCUAServer> server;
+	if (ok) {
+		server = ord->Find("ServerTest");
+		ok = server.IsValid();
+	}
+	ReferenceT<OPCUANode> node;
+	if (ok) {
+		node = server->GetPublishedNode("MyNode");
+		ok = node.IsValid();
+	}
+	if (ok) {
+		ok = (node->GetPublishedSize() == sizeof(uint32));
+	}
+	uint32 value = 7u;
+	if (ok) {
+		ok = node->SetPublishedValue(&value, sizeof(uint32));
+	}
+	if (ok) {
+		ok = !node->SetPublishedValue(&value, sizeof(uint16));
+	}
+	UA_Client *client = UA_Client_new();
+	UA_ClientConfig_setDefault(UA_Client_getConfig(client));
+	if (ok) {
+		UA_StatusCode retval = UA_Client_connect(client, "opc.tcp://localhost:4840");
+		ok = (retval == UA_STATUSCODE_GOOD);
+	}
+	if (ok) {
+		UA_Variant readValue;
+		UA_Variant_init(&readValue);
+		UA_StatusCode retval = UA_Client_readValueAttribute(client, UA_NODEID_NUMERIC(1u, 3000u), &readValue);
+		ok = (retval == UA_STATUSCODE_GOOD);
+		if (ok) {
+			ok = UA_Variant_hasScalarType(&readValue, &UA_TYPES[UA_TYPES_UINT32]);
+		}
+		if (ok) {
+			ok = (*static_cast<uint32 *>(readValue.data) == 7u);
+		}
+		UA_Variant_clear(&readValue);
+	}
+	UA_Client_delete(client);
+	ord->Purge();
+	return ok;
+}
+
+bool OPCUAServerTest::TestInitialise_WrongPublishMode() {
+	using namespace MARTe;
+	StreamString config = ""
+			"+ServerTest = {"
+			"     Class = OPCUA::OPCUAServer"
+			"     PublishMode = Monitor"
+			"     AddressSpace = {"
+			"         MyNode = {"
+			"             Type = uint32"
+			"         }"
+			"     }"
+			"}";
+	config.Seek(0LLU);
+	ConfigurationDatabase cdb;
+	StandardParser parser(config, cdb, NULL);
+	bool ok = parser.Parse();
+	cdb.MoveToRoot();
+	ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+	if (ok) {
+		ok = ord->Initialise(cdb);
+	}
+	Sleep::MSec(100);
+	ord->Purge();
+	return !ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -71,11 +71,23 @@ public:
      */
     bool TestExecute_IntrospectionArray();
 
+    bool TestExecute_IntrospectionShared();
+
     /**
      * @brief Tests the Execute method when a variable number of dimensions is greater than 1.
      */
     bool TestExecute_WrongNDimensions();
 
+    /**
+     * @brief Tests the Execute method with PublishMode = "DataSource".
+     */
+    bool TestExecute_PublishMode();
+
+    /**
+     * @brief Tests the Initialise method with an unsupported PublishMode.
+     */
+    bool TestInitialise_WrongPublishMode();
+
 };
 
 
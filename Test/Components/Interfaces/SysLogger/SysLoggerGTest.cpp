@@ -64,4 +64,29 @@ TEST(SysLoggerGTest,TestConsumeLogMessage) {
     ASSERT_TRUE(test.TestConsumeLogMessage());
 }
 
+TEST(SysLoggerGTest,TestInitialise_Asynchronous) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_Asynchronous());
+}
+
+TEST(SysLoggerGTest,TestInitialise_False_OverflowPolicy) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_OverflowPolicy());
+}
+
+TEST(SysLoggerGTest,TestInitialise_False_Protocol) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Protocol());
+}
+
+TEST(SysLoggerGTest,TestConsumeLogMessage_Asynchronous) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestConsumeLogMessage_Asynchronous());
+}
+
+TEST(SysLoggerGTest,TestConsumeLogMessage_Asynchronous_Overflow) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestConsumeLogMessage_Asynchronous_Overflow());
+}
+
 	
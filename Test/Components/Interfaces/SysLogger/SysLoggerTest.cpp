@@ -24,6 +24,11 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -31,12 +36,43 @@
 #include "ConfigurationDatabase.h"
 #include "LoggerService.h"
 #include "ReferenceT.h"
+#include "StringHelper.h"
 #include "SysLogger.h"
 #include "SysLoggerTest.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+/**
+ * Local datagram socket which replaces /dev/log in the asynchronous tests.
+ */
+static const MARTe::char8 * const sysLoggerTestSocketPath = "/tmp/SysLoggerTest.sock";
+
+/**
+ * @brief Binds a datagram socket to sysLoggerTestSocketPath.
+ * @return the socket file descriptor or -1 on failure.
+ */
+static MARTe::int32 SysLoggerTestBind() {
+    (void) unlink(sysLoggerTestSocketPath);
+    MARTe::int32 fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (fd >= 0) {
+        struct sockaddr_un address;
+        (void) memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        (void) strncpy(&address.sun_path[0], sysLoggerTestSocketPath, sizeof(address.sun_path) - 1u);
+        if (bind(fd, reinterpret_cast<struct sockaddr *>(&address), sizeof(address)) != 0) {
+            (void) close(fd);
+            fd = -1;
+        }
+    }
+    if (fd >= 0) {
+        struct timeval timeout;
+        timeout.tv_sec = 2;
+        timeout.tv_usec = 0;
+        (void) setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    }
+    return fd;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -109,3 +145,114 @@ bool SysLoggerTest::TestConsumeLogMessage() {
 
     return ok;
 }
+
+bool SysLoggerTest::TestInitialise_Asynchronous() {
+    using namespace MARTe;
+    SysLogger test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Format", "EtOofFRmC");
+    cdb.Write("Ident", "MARTe2SysLoggerTest");
+    cdb.Write("Asynchronous", 1);
+    cdb.Write("QueueSize", 16);
+    cdb.Write("BatchSize", 4);
+    cdb.Write("OverflowPolicy", "Sample");
+    cdb.Write("SampleRate", 2);
+    return test.Initialise(cdb);
+}
+
+bool SysLoggerTest::TestInitialise_False_OverflowPolicy() {
+    using namespace MARTe;
+    SysLogger test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Format", "EtOofFRmC");
+    cdb.Write("Ident", "MARTe2SysLoggerTest");
+    cdb.Write("Asynchronous", 1);
+    cdb.Write("OverflowPolicy", "DropAll");
+    return !test.Initialise(cdb);
+}
+
+bool SysLoggerTest::TestInitialise_False_Protocol() {
+    using namespace MARTe;
+    SysLogger test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Format", "EtOofFRmC");
+    cdb.Write("Ident", "MARTe2SysLoggerTest");
+    cdb.Write("Asynchronous", 1);
+    cdb.Write("Protocol", "RFC1");
+    return !test.Initialise(cdb);
+}
+
+bool SysLoggerTest::TestConsumeLogMessage_Asynchronous() {
+    using namespace MARTe;
+    int32 fd = SysLoggerTestBind();
+    bool ok = (fd >= 0);
+    if (ok) {
+        SysLogger test;
+        ConfigurationDatabase cdb;
+        cdb.Write("Format", "m");
+        cdb.Write("Ident", "MARTe2SysLoggerTest");
+        cdb.Write("Asynchronous", 1);
+        cdb.Write("Protocol", "RFC5424");
+        cdb.Write("SocketPath", sysLoggerTestSocketPath);
+        ok = test.Initialise(cdb);
+        if (ok) {
+            LoggerPage page;
+            page.errorInfo.header.errorType = ErrorManagement::Warning;
+            ok = StringHelper::Copy(&page.errorStrBuffer[0], "TestConsumeLogMessage_Asynchronous");
+            test.ConsumeLogMessage(&page);
+        }
+        char8 received[1024];
+        ssize_t size = -1;
+        if (ok) {
+            size = recv(fd, &received[0], sizeof(received) - 1u, 0);
+            ok = (size > 0);
+        }
+        if (ok) {
+            received[size] = '\0';
+            //LOG_USER | LOG_WARNING
+            ok = (StringHelper::CompareN(&received[0], "<12>1 ", 6u) == 0);
+        }
+        if (ok) {
+            ok = (StringHelper::SearchString(&received[0], "MARTe2SysLoggerTest") != NULL_PTR(const char8 *));
+        }
+        if (ok) {
+            ok = (StringHelper::SearchString(&received[0], "TestConsumeLogMessage_Asynchronous") != NULL_PTR(const char8 *));
+        }
+        (void) close(fd);
+    }
+    (void) unlink(sysLoggerTestSocketPath);
+    return ok;
+}
+
+bool SysLoggerTest::TestConsumeLogMessage_Asynchronous_Overflow() {
+    using namespace MARTe;
+    int32 fd = SysLoggerTestBind();
+    bool ok = (fd >= 0);
+    if (ok) {
+        SysLogger test;
+        ConfigurationDatabase cdb;
+        cdb.Write("Format", "m");
+        cdb.Write("Ident", "MARTe2SysLoggerTest");
+        cdb.Write("Asynchronous", 1);
+        cdb.Write("QueueSize", 2);
+        cdb.Write("BatchSize", 1);
+        cdb.Write("SocketPath", sysLoggerTestSocketPath);
+        ok = test.Initialise(cdb);
+        if (ok) {
+            //Nobody reads fd, so the helper thread eventually blocks in send and the queue overflows
+            LoggerPage page;
+            page.errorInfo.header.errorType = ErrorManagement::Information;
+            ok = StringHelper::Copy(&page.errorStrBuffer[0], "TestConsumeLogMessage_Asynchronous_Overflow");
+            for (uint32 i = 0u; (i < 5000u) && (ok); i++) {
+                test.ConsumeLogMessage(&page);
+            }
+        }
+        if (ok) {
+            ok = (test.GetSuppressedCount() > 0u);
+        }
+        //Unblocks the helper thread before the SysLogger is destroyed
+        (void) close(fd);
+        (void) unlink(sysLoggerTestSocketPath);
+    }
+    return ok;
+}
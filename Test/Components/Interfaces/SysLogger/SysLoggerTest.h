@@ -65,6 +65,31 @@ public:
      * @brief Tests the ConsumeLogMessage method .
      */
     bool TestConsumeLogMessage();
+
+    /**
+     * @brief Tests the Initialise method with Asynchronous = 1.
+     */
+    bool TestInitialise_Asynchronous();
+
+    /**
+     * @brief Tests the Initialise method with an invalid OverflowPolicy.
+     */
+    bool TestInitialise_False_OverflowPolicy();
+
+    /**
+     * @brief Tests the Initialise method with an invalid Protocol.
+     */
+    bool TestInitialise_False_Protocol();
+
+    /**
+     * @brief Tests the ConsumeLogMessage method with Asynchronous = 1 and the RFC5424 Protocol.
+     */
+    bool TestConsumeLogMessage_Asynchronous();
+
+    /**
+     * @brief Tests that the ConsumeLogMessage method does not block and counts the discarded messages when the queue is full.
+     */
+    bool TestConsumeLogMessage_Asynchronous_Overflow();
 };
 
 /*---------------------------------------------------------------------------*/
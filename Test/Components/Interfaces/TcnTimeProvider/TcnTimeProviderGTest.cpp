@@ -135,6 +135,16 @@ TEST(TcnTimeProviderGTest,TestInitialise_WithFrequency) {
     ASSERT_TRUE(test.TestInitialise_WithFrequency());
 }
 
+TEST(TcnTimeProviderGTest,TestInitialise_Cached) {
+    TcnTimeProviderTest test(true);
+    ASSERT_TRUE(test.TestInitialise_Cached());
+}
+
+TEST(TcnTimeProviderGTest,TestInitialise_Cached_NoPollLegacyMode) {
+    TcnTimeProviderTest test(true);
+    ASSERT_TRUE(test.TestInitialise_Cached_NoPollLegacyMode());
+}
+
 TEST(TcnTimeProviderGTest, TestIntegrated_WithTcnPollDisabled) {
     TcnTimeProviderTest test(true);
     ASSERT_TRUE(test.TestIntegrated_WithTcnPollDisabled());
@@ -336,6 +336,47 @@ bool TcnTimeProviderTest::TestInitialise_WithFrequency() {
     return TestInitialise_ConfigurableMode(TcnTimeProviderTestInitialiseMode_SleepMode); 
 }
 
+bool TcnTimeProviderTest::TestInitialise_Cached() {
+    tcnCfg.Write("Cached", 1);
+    tcnCfg.Write("ResyncPeriod", 100);
+    bool retVal = TestInitialise_ConfigurableMode(TcnTimeProviderTestInitialiseMode_PollLegacyMode);
+    TcnTimeProvider *tcnTimeProvider = dynamic_cast<TcnTimeProvider *>(timeProvider);
+    if (retVal) {
+        retVal = (tcnTimeProvider != NULL);
+    }
+    if (retVal) {
+        uint64 lastCounter = timeProvider->Counter();
+        uint64 startHRT = HighResolutionTimer::Counter();
+        //Spin for 10 ms, i.e. ~100 resynchronisations
+        while ((retVal) && (static_cast<float64>(HighResolutionTimer::Counter() - startHRT) * HighResolutionTimer::Period() < 0.01)) {
+            uint64 counter = timeProvider->Counter();
+            retVal = (counter >= lastCounter);
+            lastCounter = counter;
+        }
+    }
+    if (retVal) {
+        retVal = (tcnTimeProvider->GetResyncCount() > 0u);
+    }
+    if (retVal) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Resyncs %d, max drift %d", tcnTimeProvider->GetResyncCount(), tcnTimeProvider->GetMaxDrift());
+    }
+    return retVal;
+}
+
+bool TcnTimeProviderTest::TestInitialise_Cached_NoPollLegacyMode() {
+    tcnCfg.Write("Cached", 1);
+    bool retVal = TestInitialise_ConfigurableMode(TcnTimeProviderTestInitialiseMode_NoPollLegacyMode);
+    TcnTimeProvider *tcnTimeProvider = dynamic_cast<TcnTimeProvider *>(timeProvider);
+    if (retVal) {
+        retVal = (tcnTimeProvider != NULL);
+    }
+    if (retVal) {
+        (void) timeProvider->Counter();
+        retVal = (tcnTimeProvider->GetResyncCount() == 0u);
+    }
+    return retVal;
+}
+
 static bool TestIntegratedRun(const MARTe::char8 * const configFile) {
     using namespace MARTe;
     ConfigurationDatabase cdb;
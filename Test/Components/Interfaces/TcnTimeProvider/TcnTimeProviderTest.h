@@ -146,6 +146,16 @@ class TcnTimeProviderTest : public TimeProviderTest {
         */
         bool TestInitialise_WithFrequency();
 
+        /**
+        * @brief Tests the Cached counter in Poll legacy mode, checking that it resynchronises and never goes backwards
+        */
+        bool TestInitialise_Cached();
+
+        /**
+        * @brief Tests that the Cached parameter is ignored when the Counter() is backed by the HighResolutionTimer
+        */
+        bool TestInitialise_Cached_NoPollLegacyMode();
+
         /**
         * @brief Tries an integrated run using TcnPoll=0 method
         */